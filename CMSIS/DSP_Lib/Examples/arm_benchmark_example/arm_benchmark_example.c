@@ -0,0 +1,823 @@
+/* ----------------------------------------------------------------------
+ * Copyright (C) 2010 ARM Limited. All rights reserved.
+ *
+ * $Date:           15. February 2012
+ * $Revision:       V1.1.0
+ *
+ * Project:         CMSIS DSP Library
+ * Title:           arm_benchmark_example.c
+ *
+ * Description:     Cycle count benchmark of the filtering, transform, matrix,
+ *                  statistics and conversion functions.
+ *
+ * Target Processor: Cortex-M4/Cortex-M3
+ * ------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup Benchmark Cycle Count Benchmark Example
+ *
+ * \par Description:
+ * \par
+ * Measures the number of cycles taken by the main kernel families of the library, for each
+ * data type and over a grid of block sizes, and prints the results as CSV lines:
+ * <pre>
+ *     kernel,type,size,cycles,cycles_per_sample
+ *     fir_32taps,f32,256,...
+ * </pre>
+ * The figures are used to choose between the variants of a kernel for a given block size,
+ * and to detect regressions of the compiler or of its options by comparing the output of
+ * two builds.
+ *
+ * \par Method:
+ * \par
+ * The cycles are counted by the <code>CYCCNT</code> counter of the DWT unit, which is
+ * enabled at the start through <code>TRCENA</code> in <code>DEMCR</code>. Each
+ * call is timed <code>BENCH_NUM_RUNS</code> times, the inputs being restored before each
+ * run outside of the timed region, and the smallest count is reported after subtraction
+ * of the cost of reading the counter, so that interrupts and cache or flash wait states
+ * of the first run do not bias the result. The inputs are pseudo-random, without zeros,
+ * denormals or saturation.
+ * \par
+ * <code>cycles_per_sample</code> divides the count by the number of samples of the block,
+ * by the FFT length for the transforms and by the number of output elements for the
+ * matrix functions, and is printed with two decimals.
+ *
+ * \par Output:
+ * \par
+ * The characters are sent on ITM stimulus port 0, as by <code>ITM_SendChar()</code>, to be
+ * read on SWO by the debugger, which enables the port. When
+ * <code>BENCH_SEMIHOSTING</code> is defined they are written with <code>putchar()</code>,
+ * retargeted to the host by the semihosting support of the toolchain, for example the
+ * <code>rdimon.specs</code> of GCC. A first line <code># build,BENCH_BUILD_TAG</code>
+ * identifies the build; the tag is a string defined on the command line, for instance
+ * with the compiler version and options.
+ *
+ * \par Native build:
+ * \par
+ * With <code>ARM_MATH_HOST</code>, the example and the sources of
+ * <code>CMSIS/DSP_Lib/Source</code> (except <code>arm_math_dispatch_init.c</code>) are built by
+ * the compiler of the development machine, for example
+ * <pre>
+ *     gcc -O2 -fno-strict-aliasing -DARM_MATH_HOST -DARM_MATH_CM4 -I CMSIS/Include ... -lm
+ * </pre>
+ * The run prints the CSV lines on the standard output, with the time of each call in
+ * nanoseconds in the <code>cycles</code> column, and returns. The C code of the Cortex-M4
+ * variant of the kernels runs with <code>ARM_MATH_CM4</code>, and the generic code with
+ * <code>ARM_MATH_CM0</code>: a build of each, compared line by line, checks that both
+ * compute the same outputs and gives their relative cost.
+ *
+ * \par Checksums:
+ * \par
+ * When <code>BENCH_CHECKSUM</code> is defined, which <code>ARM_MATH_HOST</code> does, a
+ * sixth column holds the FNV-1a hash of the output of the last run. The hashes of a
+ * kernel differ between two builds when its outputs are not bit-exact: expected for the
+ * floating-point kernels whose variants add in another order, and for the few
+ * fixed-point kernels whose variants round differently, a regression otherwise.
+ *
+ * \par Build:
+ * \par
+ * The example only calls functions of the prebuilt libraries, and can be linked either
+ * against <code>CMSIS/Lib/GCC/libarm_cortexM4lf_math.a</code> (or the library matching
+ * the core and the floating-point ABI) or against the sources of
+ * <code>CMSIS/DSP_Lib/Source</code> compiled with the options under test, with the same
+ * <code>ARM_MATH_CM4</code> or <code>ARM_MATH_CM3</code> define. The buffers take 56 KB of
+ * RAM.
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_fir_f32(), arm_fir_q31(), arm_fir_fast_q31(), arm_fir_q15(), arm_fir_fast_q15(), arm_fir_q7()
+ * - arm_biquad_cascade_df1_f32(), arm_biquad_cascade_df2T_f32(), arm_biquad_cascade_df1_q31(),
+ *   arm_biquad_cascade_df1_fast_q31(), arm_biquad_cascade_df1_q15(), arm_biquad_cascade_df1_fast_q15()
+ * - arm_cfft_radix4_f32(), arm_cfft_radix4_q31(), arm_cfft_radix4_q15()
+ * - arm_rfft_f32(), arm_rfft_q31(), arm_rfft_q15()
+ * - arm_mat_mult_f32(), arm_mat_mult_q31(), arm_mat_mult_fast_q31(), arm_mat_mult_q15(),
+ *   arm_mat_mult_fast_q15(), arm_mat_add_f32(), arm_mat_trans_f32(), arm_mat_inverse_f32()
+ * - arm_mean_f32(), arm_var_f32(), arm_rms_f32(), arm_max_f32() and their fixed-point variants
+ * - arm_float_to_q31(), arm_float_to_q15(), arm_float_to_q7(), arm_q31_to_float(),
+ *   arm_q15_to_float(), arm_q7_to_float(), arm_q31_to_q15(), arm_q15_to_q31(), arm_q7_to_q15()
+ *
+ * <b> Refer  </b>
+ * \link arm_benchmark_example.c \endlink
+ *
+ */
+
+
+/** \example arm_benchmark_example.c
+ */
+
+/* ----------------------------------------------------------------------
+** Include Files
+** ------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+#if defined (BENCH_SEMIHOSTING) || defined (ARM_MATH_HOST)
+#include <stdio.h>
+#endif
+
+#ifdef ARM_MATH_HOST
+#include <time.h>
+#endif
+
+/* ----------------------------------------------------------------------
+** Macro Defines
+** ------------------------------------------------------------------- */
+
+#ifndef BENCH_BUILD_TAG
+#define BENCH_BUILD_TAG     "unknown"
+#endif
+
+#if defined (ARM_MATH_HOST) && !defined (BENCH_CHECKSUM)
+#define BENCH_CHECKSUM
+#endif
+
+#define BENCH_NUM_RUNS      8u         /* Timed runs of each call, the minimum is reported */
+#define BENCH_NUM_SIZES     4u         /* Number of block sizes of the grid */
+#define BENCH_BUF_WORDS     4096u      /* Words of the work buffers */
+#define BENCH_REF_WORDS     2048u      /* Words of the reference inputs */
+
+#define BENCH_FIR_TAPS      32u
+#define BENCH_BIQUAD_STAGES 4u
+
+/* Debug registers, accessed directly as arm_math.h includes the core header without
+ * the peripheral definitions: DEMCR, DWT control and cycle counter, ITM port 0,
+ * trace enable and trace control */
+#define BENCH_DEMCR         (*(volatile uint32_t *) 0xE000EDFCu)
+#define BENCH_DEMCR_TRCENA  (1uL << 24)
+#define BENCH_DWT_CTRL      (*(volatile uint32_t *) 0xE0001000u)
+#define BENCH_DWT_CYCCNT    (*(volatile uint32_t *) 0xE0001004u)
+#define BENCH_ITM_PORT0     (*(volatile uint32_t *) 0xE0000000u)
+#define BENCH_ITM_PORT0_U8  (*(volatile uint8_t *) 0xE0000000u)
+#define BENCH_ITM_TER       (*(volatile uint32_t *) 0xE0000E00u)
+#define BENCH_ITM_TCR       (*(volatile uint32_t *) 0xE0000E80u)
+
+/* Time base: the cycle counter, or nanoseconds of the monotonic clock of
+ * a native build */
+#ifdef ARM_MATH_HOST
+#define BENCH_NOW()         bench_host_ns()
+#else
+#define BENCH_NOW()         BENCH_DWT_CYCCNT
+#endif
+
+/* ----------------------------------------------------------------------
+** Times the statement call: restores the inputs with the statement prep
+** before each run, and keeps the smallest count in the variable cycles.
+** ------------------------------------------------------------------- */
+
+#define BENCH_TIME(prep, call)                                  \
+  do                                                            \
+  {                                                             \
+    uint32_t run, start, count;                                 \
+    cycles = 0xFFFFFFFFu;                                       \
+    for (run = 0u; run < BENCH_NUM_RUNS; run++)                 \
+    {                                                           \
+      prep;                                                     \
+      start = BENCH_NOW();                                      \
+      call;                                                     \
+      count = (BENCH_NOW() - start) - overhead;                 \
+      if(count < cycles)                                        \
+      {                                                         \
+        cycles = count;                                         \
+      }                                                         \
+    }                                                           \
+  } while(0)
+
+/* ------------------------------------------------------------------
+ * Work buffers, used with the type of each benchmark, and reference
+ * inputs in each data type.
+ * ------------------------------------------------------------------- */
+
+static uint32_t bufA[BENCH_BUF_WORDS];
+static uint32_t bufB[BENCH_BUF_WORDS];
+static uint32_t bufC[BENCH_BUF_WORDS];
+static uint32_t bufRef[BENCH_REF_WORDS];
+
+static const uint32_t benchSizes[BENCH_NUM_SIZES] = { 16u, 64u, 256u, 1024u };
+static const uint16_t benchFftLen[4] = { 16u, 64u, 256u, 1024u };
+static const uint32_t benchRfftLen[3] = { 128u, 512u, 2048u };
+static const uint16_t benchMatDim[4] = { 4u, 8u, 16u, 32u };
+
+/* Cost of reading the cycle counter, subtracted from each count */
+static uint32_t overhead;
+
+/* Hash of the output of the last timed call */
+static uint32_t checksum;
+
+#ifdef ARM_MATH_HOST
+static uint32_t bench_host_ns(void)
+{
+  struct timespec ts;
+
+  (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t) ((uint32_t) ts.tv_sec * 1000000000u + (uint32_t) ts.tv_nsec);
+}
+#endif
+
+/* ----------------------------------------------------------------------
+** Output of the CSV lines
+** ------------------------------------------------------------------- */
+
+static void bench_putc(char c)
+{
+#if defined (BENCH_SEMIHOSTING) || defined (ARM_MATH_HOST)
+  (void) putchar(c);
+#else
+  /* Stimulus port 0, when enabled by the debugger, as ITM_SendChar() */
+  if(((BENCH_ITM_TCR & 1u) != 0u) && ((BENCH_ITM_TER & 1u) != 0u))
+  {
+    while(BENCH_ITM_PORT0 == 0u);
+    BENCH_ITM_PORT0_U8 = (uint8_t) c;
+  }
+#endif
+}
+
+static void bench_puts(const char *s)
+{
+  while(*s != '\0')
+  {
+    bench_putc(*s++);
+  }
+}
+
+static void bench_putu(uint32_t value)
+{
+  char digits[10];
+  uint32_t n = 0u;
+
+  do
+  {
+    digits[n++] = (char) ('0' + (value % 10u));
+    value /= 10u;
+  } while(value > 0u);
+
+  while(n > 0u)
+  {
+    bench_putc(digits[--n]);
+  }
+}
+
+/* FNV-1a hash of the n bytes of the output, printed with the next report */
+static void bench_check(const void *pOut, uint32_t n)
+{
+  const uint8_t *pByte = (const uint8_t *) pOut;
+  uint32_t hash = 2166136261u;
+
+  while(n > 0u)
+  {
+    hash = (hash ^ *pByte++) * 16777619u;
+    n--;
+  }
+
+  checksum = hash;
+}
+
+#ifdef BENCH_CHECKSUM
+static void bench_puthex(uint32_t value)
+{
+  uint32_t shift;
+
+  for (shift = 32u; shift > 0u; shift -= 4u)
+  {
+    bench_putc("0123456789abcdef"[(value >> (shift - 4u)) & 0xFu]);
+  }
+}
+#endif
+
+/* Prints kernel,type,size,cycles,cycles_per_sample[,checksum] */
+static void bench_report(const char *kernel, const char *type, uint32_t size,
+                         uint32_t numSamples, uint32_t cycles)
+{
+  uint32_t cps = (uint32_t) ((((uint64_t) cycles * 100u) + (numSamples / 2u)) / numSamples);
+
+  bench_puts(kernel);
+  bench_putc(',');
+  bench_puts(type);
+  bench_putc(',');
+  bench_putu(size);
+  bench_putc(',');
+  bench_putu(cycles);
+  bench_putc(',');
+  bench_putu(cps / 100u);
+  bench_putc('.');
+  bench_putc((char) ('0' + ((cps / 10u) % 10u)));
+  bench_putc((char) ('0' + (cps % 10u)));
+#ifdef BENCH_CHECKSUM
+  bench_putc(',');
+  bench_puthex(checksum);
+#endif
+  bench_putc('\n');
+}
+
+/* ----------------------------------------------------------------------
+** Reference inputs: pseudo-random values in [-0.5 0.5), without zeros
+** ------------------------------------------------------------------- */
+
+static float32_t *refF32(void)
+{
+  return (float32_t *) bufRef;
+}
+
+static void bench_init_inputs(void)
+{
+  float32_t *pRef = refF32();
+  uint32_t seed = 12345u;
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_REF_WORDS; i++)
+  {
+    seed = (seed * 1664525u) + 1013904223u;
+    pRef[i] = ((float32_t) (seed >> 8) * (1.0f / 16777216.0f)) - 0.5f;
+
+    if(pRef[i] == 0.0f)
+    {
+      pRef[i] = 0.25f;
+    }
+  }
+}
+
+/* Copies n reference samples, converted to the type, to the buffer */
+static void prep_f32(void *pDst, uint32_t n)
+{
+  arm_copy_f32(refF32(), (float32_t *) pDst, n);
+}
+
+static void prep_q31(void *pDst, uint32_t n)
+{
+  arm_float_to_q31(refF32(), (q31_t *) pDst, n);
+}
+
+static void prep_q15(void *pDst, uint32_t n)
+{
+  arm_float_to_q15(refF32(), (q15_t *) pDst, n);
+}
+
+static void prep_q7(void *pDst, uint32_t n)
+{
+  arm_float_to_q7(refF32(), (q7_t *) pDst, n);
+}
+
+/* Diagonally dominant, hence invertible, n x n matrix */
+static void prep_mat_inverse(void *pDst, uint32_t n)
+{
+  float32_t *pMat = (float32_t *) pDst;
+  uint32_t k;
+
+  prep_f32(pDst, n * n);
+
+  for (k = 0u; k < n; k++)
+  {
+    pMat[(k * n) + k] += (float32_t) n;
+  }
+}
+
+/* ----------------------------------------------------------------------
+** FIR filters: 32 taps
+** ------------------------------------------------------------------- */
+
+static void bench_fir(void)
+{
+  static float32_t coeffsF32[BENCH_FIR_TAPS];
+  static q31_t coeffsQ31[BENCH_FIR_TAPS];
+  static q15_t coeffsQ15[BENCH_FIR_TAPS];
+  static q7_t coeffsQ7[BENCH_FIR_TAPS];
+  arm_fir_instance_f32 Sf32;
+  arm_fir_instance_q31 Sq31;
+  arm_fir_instance_q15 Sq15;
+  arm_fir_instance_q7 Sq7;
+  uint32_t i, size, cycles;
+
+  for (i = 0u; i < BENCH_FIR_TAPS; i++)
+  {
+    coeffsF32[i] = 1.0f / (float32_t) (BENCH_FIR_TAPS + i);
+  }
+
+  arm_float_to_q31(coeffsF32, coeffsQ31, BENCH_FIR_TAPS);
+  arm_float_to_q15(coeffsF32, coeffsQ15, BENCH_FIR_TAPS);
+  arm_float_to_q7(coeffsF32, coeffsQ7, BENCH_FIR_TAPS);
+
+  for (i = 0u; i < BENCH_NUM_SIZES; i++)
+  {
+    size = benchSizes[i];
+
+    arm_fir_init_f32(&Sf32, BENCH_FIR_TAPS, coeffsF32, (float32_t *) bufC, size);
+    BENCH_TIME(prep_f32(bufA, size), arm_fir_f32(&Sf32, (float32_t *) bufA, (float32_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("fir_32taps", "f32", size, size, cycles);
+
+    arm_fir_init_q31(&Sq31, BENCH_FIR_TAPS, coeffsQ31, (q31_t *) bufC, size);
+    BENCH_TIME(prep_q31(bufA, size), arm_fir_q31(&Sq31, (q31_t *) bufA, (q31_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("fir_32taps", "q31", size, size, cycles);
+
+    BENCH_TIME(prep_q31(bufA, size), arm_fir_fast_q31(&Sq31, (q31_t *) bufA, (q31_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("fir_fast_32taps", "q31", size, size, cycles);
+
+    (void) arm_fir_init_q15(&Sq15, BENCH_FIR_TAPS, coeffsQ15, (q15_t *) bufC, size);
+    BENCH_TIME(prep_q15(bufA, size), arm_fir_q15(&Sq15, (q15_t *) bufA, (q15_t *) bufB, size));
+    bench_check(bufB, size * 2u);
+    bench_report("fir_32taps", "q15", size, size, cycles);
+
+    BENCH_TIME(prep_q15(bufA, size), arm_fir_fast_q15(&Sq15, (q15_t *) bufA, (q15_t *) bufB, size));
+    bench_check(bufB, size * 2u);
+    bench_report("fir_fast_32taps", "q15", size, size, cycles);
+
+    arm_fir_init_q7(&Sq7, BENCH_FIR_TAPS, coeffsQ7, (q7_t *) bufC, size);
+    BENCH_TIME(prep_q7(bufA, size), arm_fir_q7(&Sq7, (q7_t *) bufA, (q7_t *) bufB, size));
+    bench_check(bufB, size * 1u);
+    bench_report("fir_32taps", "q7", size, size, cycles);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Biquad cascades: 4 stages of a stable lowpass section
+** ------------------------------------------------------------------- */
+
+static void bench_biquad(void)
+{
+  static float32_t coeffsF32[5u * BENCH_BIQUAD_STAGES];
+  static q31_t coeffsQ31[5u * BENCH_BIQUAD_STAGES];
+  static q15_t coeffsQ15[6u * BENCH_BIQUAD_STAGES];
+  static const float32_t section[5] = { 0.0625f, 0.125f, 0.0625f, 0.75f, -0.25f };
+  arm_biquad_casd_df1_inst_f32 Sdf1;
+  arm_biquad_cascade_df2T_instance_f32 Sdf2T;
+  arm_biquad_casd_df1_inst_q31 Sq31;
+  arm_biquad_casd_df1_inst_q15 Sq15;
+  uint32_t i, size, cycles;
+
+  for (i = 0u; i < BENCH_BIQUAD_STAGES; i++)
+  {
+    arm_copy_f32((float32_t *) section, &coeffsF32[5u * i], 5u);
+  }
+
+  /* Fixed-point coefficients in 2.30 and 2.14 formats, with a postShift of 1 */
+  arm_scale_f32(coeffsF32, 0.5f, (float32_t *) bufC, 5u * BENCH_BIQUAD_STAGES);
+  arm_float_to_q31((float32_t *) bufC, coeffsQ31, 5u * BENCH_BIQUAD_STAGES);
+
+  for (i = 0u; i < BENCH_BIQUAD_STAGES; i++)
+  {
+    coeffsQ15[6u * i] = (q15_t) (section[0] * 16384.0f);
+    coeffsQ15[(6u * i) + 1u] = 0;
+    coeffsQ15[(6u * i) + 2u] = (q15_t) (section[1] * 16384.0f);
+    coeffsQ15[(6u * i) + 3u] = (q15_t) (section[2] * 16384.0f);
+    coeffsQ15[(6u * i) + 4u] = (q15_t) (section[3] * 16384.0f);
+    coeffsQ15[(6u * i) + 5u] = (q15_t) (section[4] * 16384.0f);
+  }
+
+  for (i = 0u; i < BENCH_NUM_SIZES; i++)
+  {
+    size = benchSizes[i];
+
+    arm_biquad_cascade_df1_init_f32(&Sdf1, BENCH_BIQUAD_STAGES, coeffsF32, (float32_t *) bufC);
+    BENCH_TIME(prep_f32(bufA, size), arm_biquad_cascade_df1_f32(&Sdf1, (float32_t *) bufA, (float32_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("biquad_df1_4stages", "f32", size, size, cycles);
+
+    arm_biquad_cascade_df2T_init_f32(&Sdf2T, BENCH_BIQUAD_STAGES, coeffsF32, (float32_t *) bufC);
+    BENCH_TIME(prep_f32(bufA, size), arm_biquad_cascade_df2T_f32(&Sdf2T, (float32_t *) bufA, (float32_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("biquad_df2T_4stages", "f32", size, size, cycles);
+
+    arm_biquad_cascade_df1_init_q31(&Sq31, BENCH_BIQUAD_STAGES, coeffsQ31, (q31_t *) bufC, 1);
+    BENCH_TIME(prep_q31(bufA, size), arm_biquad_cascade_df1_q31(&Sq31, (q31_t *) bufA, (q31_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("biquad_df1_4stages", "q31", size, size, cycles);
+
+    BENCH_TIME(prep_q31(bufA, size), arm_biquad_cascade_df1_fast_q31(&Sq31, (q31_t *) bufA, (q31_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("biquad_df1_fast_4stages", "q31", size, size, cycles);
+
+    arm_biquad_cascade_df1_init_q15(&Sq15, BENCH_BIQUAD_STAGES, coeffsQ15, (q15_t *) bufC, 1);
+    BENCH_TIME(prep_q15(bufA, size), arm_biquad_cascade_df1_q15(&Sq15, (q15_t *) bufA, (q15_t *) bufB, size));
+    bench_check(bufB, size * 2u);
+    bench_report("biquad_df1_4stages", "q15", size, size, cycles);
+
+    BENCH_TIME(prep_q15(bufA, size), arm_biquad_cascade_df1_fast_q15(&Sq15, (q15_t *) bufA, (q15_t *) bufB, size));
+    bench_check(bufB, size * 2u);
+    bench_report("biquad_df1_fast_4stages", "q15", size, size, cycles);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Complex FFTs per length, in place with bit reversal
+** ------------------------------------------------------------------- */
+
+static void bench_cfft(void)
+{
+  arm_cfft_radix4_instance_f32 Sf32;
+  arm_cfft_radix4_instance_q31 Sq31;
+  arm_cfft_radix4_instance_q15 Sq15;
+  uint32_t i, len, cycles;
+
+  for (i = 0u; i < 4u; i++)
+  {
+    len = benchFftLen[i];
+
+    if(arm_cfft_radix4_init_f32(&Sf32, (uint16_t) len, 0u, 1u) == ARM_MATH_SUCCESS)
+    {
+      BENCH_TIME(prep_f32(bufA, 2u * len), arm_cfft_radix4_f32(&Sf32, (float32_t *) bufA));
+      bench_check(bufA, 2u * len * 4u);
+      bench_report("cfft_radix4", "f32", len, len, cycles);
+    }
+
+    if(arm_cfft_radix4_init_q31(&Sq31, (uint16_t) len, 0u, 1u) == ARM_MATH_SUCCESS)
+    {
+      BENCH_TIME(prep_q31(bufA, 2u * len), arm_cfft_radix4_q31(&Sq31, (q31_t *) bufA));
+      bench_check(bufA, 2u * len * 4u);
+      bench_report("cfft_radix4", "q31", len, len, cycles);
+    }
+
+    if(arm_cfft_radix4_init_q15(&Sq15, (uint16_t) len, 0u, 1u) == ARM_MATH_SUCCESS)
+    {
+      BENCH_TIME(prep_q15(bufA, 2u * len), arm_cfft_radix4_q15(&Sq15, (q15_t *) bufA));
+      bench_check(bufA, 2u * len * 2u);
+      bench_report("cfft_radix4", "q15", len, len, cycles);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Real FFTs per length
+** ------------------------------------------------------------------- */
+
+static void bench_rfft(void)
+{
+  arm_rfft_instance_f32 Sf32;
+  arm_cfft_radix4_instance_f32 Cf32;
+  arm_rfft_instance_q31 Sq31;
+  arm_cfft_radix4_instance_q31 Cq31;
+  arm_rfft_instance_q15 Sq15;
+  arm_cfft_radix4_instance_q15 Cq15;
+  uint32_t i, len, cycles;
+
+  for (i = 0u; i < 3u; i++)
+  {
+    len = benchRfftLen[i];
+
+    if(arm_rfft_init_f32(&Sf32, &Cf32, len, 0u, 1u) == ARM_MATH_SUCCESS)
+    {
+      BENCH_TIME(prep_f32(bufA, len), arm_rfft_f32(&Sf32, (float32_t *) bufA, (float32_t *) bufB));
+      bench_check(bufB, 2u * len * 4u);
+      bench_report("rfft", "f32", len, len, cycles);
+    }
+
+    if(arm_rfft_init_q31(&Sq31, &Cq31, len, 0u, 1u) == ARM_MATH_SUCCESS)
+    {
+      BENCH_TIME(prep_q31(bufA, len), arm_rfft_q31(&Sq31, (q31_t *) bufA, (q31_t *) bufB));
+      bench_check(bufB, 2u * len * 4u);
+      bench_report("rfft", "q31", len, len, cycles);
+    }
+
+    if(arm_rfft_init_q15(&Sq15, &Cq15, len, 0u, 1u) == ARM_MATH_SUCCESS)
+    {
+      BENCH_TIME(prep_q15(bufA, len), arm_rfft_q15(&Sq15, (q15_t *) bufA, (q15_t *) bufB));
+      bench_check(bufB, 2u * len * 2u);
+      bench_report("rfft", "q15", len, len, cycles);
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Matrix functions on square matrices, per output element
+** ------------------------------------------------------------------- */
+
+static void bench_matrix(void)
+{
+  arm_matrix_instance_f32 Af32, Bf32, Cf32;
+  arm_matrix_instance_q31 Aq31, Bq31, Cq31;
+  arm_matrix_instance_q15 Aq15, Bq15, Cq15;
+  uint32_t i, n, numElem, cycles;
+
+  for (i = 0u; i < 4u; i++)
+  {
+    n = benchMatDim[i];
+    numElem = n * n;
+
+    /* B is the reference data, A is restored before each run */
+    arm_mat_init_f32(&Af32, (uint16_t) n, (uint16_t) n, (float32_t *) bufA);
+    arm_mat_init_f32(&Bf32, (uint16_t) n, (uint16_t) n, (float32_t *) bufB);
+    arm_mat_init_f32(&Cf32, (uint16_t) n, (uint16_t) n, (float32_t *) bufC);
+    prep_f32(bufB, numElem);
+
+    BENCH_TIME(prep_f32(bufA, numElem), (void) arm_mat_mult_f32(&Af32, &Bf32, &Cf32));
+    bench_check(bufC, numElem * 4u);
+    bench_report("mat_mult", "f32", n, numElem, cycles);
+
+    BENCH_TIME(prep_f32(bufA, numElem), (void) arm_mat_add_f32(&Af32, &Bf32, &Cf32));
+    bench_check(bufC, numElem * 4u);
+    bench_report("mat_add", "f32", n, numElem, cycles);
+
+    BENCH_TIME(prep_f32(bufA, numElem), (void) arm_mat_trans_f32(&Af32, &Cf32));
+    bench_check(bufC, numElem * 4u);
+    bench_report("mat_trans", "f32", n, numElem, cycles);
+
+    /* The inversion overwrites its input with the identity */
+    BENCH_TIME(prep_mat_inverse(bufA, n), (void) arm_mat_inverse_f32(&Af32, &Cf32));
+    bench_check(bufC, numElem * 4u);
+    bench_report("mat_inverse", "f32", n, numElem, cycles);
+
+    arm_mat_init_q31(&Aq31, (uint16_t) n, (uint16_t) n, (q31_t *) bufA);
+    arm_mat_init_q31(&Bq31, (uint16_t) n, (uint16_t) n, (q31_t *) bufB);
+    arm_mat_init_q31(&Cq31, (uint16_t) n, (uint16_t) n, (q31_t *) bufC);
+    prep_q31(bufB, numElem);
+
+    BENCH_TIME(prep_q31(bufA, numElem), (void) arm_mat_mult_q31(&Aq31, &Bq31, &Cq31));
+    bench_check(bufC, numElem * 4u);
+    bench_report("mat_mult", "q31", n, numElem, cycles);
+
+    BENCH_TIME(prep_q31(bufA, numElem), (void) arm_mat_mult_fast_q31(&Aq31, &Bq31, &Cq31));
+    bench_check(bufC, numElem * 4u);
+    bench_report("mat_mult_fast", "q31", n, numElem, cycles);
+
+    /* The Q15 products need a scratch buffer for the transpose of B */
+    arm_mat_init_q15(&Aq15, (uint16_t) n, (uint16_t) n, (q15_t *) bufA);
+    arm_mat_init_q15(&Bq15, (uint16_t) n, (uint16_t) n, (q15_t *) bufB);
+    arm_mat_init_q15(&Cq15, (uint16_t) n, (uint16_t) n, (q15_t *) bufC);
+    prep_q15(bufB, numElem);
+
+    BENCH_TIME(prep_q15(bufA, numElem),
+               (void) arm_mat_mult_q15(&Aq15, &Bq15, &Cq15, ((q15_t *) bufC) + numElem));
+    bench_check(bufC, numElem * 2u);
+    bench_report("mat_mult", "q15", n, numElem, cycles);
+
+    BENCH_TIME(prep_q15(bufA, numElem),
+               (void) arm_mat_mult_fast_q15(&Aq15, &Bq15, &Cq15, ((q15_t *) bufC) + numElem));
+    bench_check(bufC, numElem * 2u);
+    bench_report("mat_mult_fast", "q15", n, numElem, cycles);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Statistics functions
+** ------------------------------------------------------------------- */
+
+static void bench_stats(void)
+{
+  float32_t resF32;
+  q63_t resQ63;
+  q31_t resQ31;
+  q15_t resQ15;
+  q7_t resQ7;
+  uint32_t index;
+  uint32_t i, size, cycles;
+
+  for (i = 0u; i < BENCH_NUM_SIZES; i++)
+  {
+    size = benchSizes[i];
+
+    /* The inputs are not modified: one copy per data type */
+    prep_f32(bufA, size);
+    BENCH_TIME((void) 0, arm_mean_f32((float32_t *) bufA, size, &resF32));
+    bench_check(&resF32, sizeof(resF32));
+    bench_report("mean", "f32", size, size, cycles);
+    BENCH_TIME((void) 0, arm_var_f32((float32_t *) bufA, size, &resF32));
+    bench_check(&resF32, sizeof(resF32));
+    bench_report("var", "f32", size, size, cycles);
+    BENCH_TIME((void) 0, arm_rms_f32((float32_t *) bufA, size, &resF32));
+    bench_check(&resF32, sizeof(resF32));
+    bench_report("rms", "f32", size, size, cycles);
+    BENCH_TIME((void) 0, arm_max_f32((float32_t *) bufA, size, &resF32, &index));
+    bench_check(&resF32, sizeof(resF32));
+    bench_report("max", "f32", size, size, cycles);
+
+    prep_q31(bufA, size);
+    BENCH_TIME((void) 0, arm_mean_q31((q31_t *) bufA, size, &resQ31));
+    bench_check(&resQ31, sizeof(resQ31));
+    bench_report("mean", "q31", size, size, cycles);
+    BENCH_TIME((void) 0, arm_var_q31((q31_t *) bufA, size, &resQ63));
+    bench_check(&resQ63, sizeof(resQ63));
+    bench_report("var", "q31", size, size, cycles);
+    BENCH_TIME((void) 0, arm_rms_q31((q31_t *) bufA, size, &resQ31));
+    bench_check(&resQ31, sizeof(resQ31));
+    bench_report("rms", "q31", size, size, cycles);
+    BENCH_TIME((void) 0, arm_max_q31((q31_t *) bufA, size, &resQ31, &index));
+    bench_check(&resQ31, sizeof(resQ31));
+    bench_report("max", "q31", size, size, cycles);
+
+    prep_q15(bufA, size);
+    BENCH_TIME((void) 0, arm_mean_q15((q15_t *) bufA, size, &resQ15));
+    bench_check(&resQ15, sizeof(resQ15));
+    bench_report("mean", "q15", size, size, cycles);
+    BENCH_TIME((void) 0, arm_var_q15((q15_t *) bufA, size, &resQ31));
+    bench_check(&resQ31, sizeof(resQ31));
+    bench_report("var", "q15", size, size, cycles);
+    BENCH_TIME((void) 0, arm_rms_q15((q15_t *) bufA, size, &resQ15));
+    bench_check(&resQ15, sizeof(resQ15));
+    bench_report("rms", "q15", size, size, cycles);
+    BENCH_TIME((void) 0, arm_max_q15((q15_t *) bufA, size, &resQ15, &index));
+    bench_check(&resQ15, sizeof(resQ15));
+    bench_report("max", "q15", size, size, cycles);
+
+    prep_q7(bufA, size);
+    BENCH_TIME((void) 0, arm_mean_q7((q7_t *) bufA, size, &resQ7));
+    bench_check(&resQ7, sizeof(resQ7));
+    bench_report("mean", "q7", size, size, cycles);
+    BENCH_TIME((void) 0, arm_power_q7((q7_t *) bufA, size, &resQ31));
+    bench_check(&resQ31, sizeof(resQ31));
+    bench_report("power", "q7", size, size, cycles);
+    BENCH_TIME((void) 0, arm_max_q7((q7_t *) bufA, size, &resQ7, &index));
+    bench_check(&resQ7, sizeof(resQ7));
+    bench_report("max", "q7", size, size, cycles);
+  }
+}
+
+/* ----------------------------------------------------------------------
+** Conversion functions
+** ------------------------------------------------------------------- */
+
+static void bench_conversions(void)
+{
+  uint32_t i, size, cycles;
+
+  for (i = 0u; i < BENCH_NUM_SIZES; i++)
+  {
+    size = benchSizes[i];
+
+    prep_f32(bufA, size);
+    BENCH_TIME((void) 0, arm_float_to_q31((float32_t *) bufA, (q31_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("float_to_q31", "f32", size, size, cycles);
+    BENCH_TIME((void) 0, arm_float_to_q15((float32_t *) bufA, (q15_t *) bufB, size));
+    bench_check(bufB, size * 2u);
+    bench_report("float_to_q15", "f32", size, size, cycles);
+    BENCH_TIME((void) 0, arm_float_to_q7((float32_t *) bufA, (q7_t *) bufB, size));
+    bench_check(bufB, size * 1u);
+    bench_report("float_to_q7", "f32", size, size, cycles);
+
+    prep_q31(bufA, size);
+    BENCH_TIME((void) 0, arm_q31_to_float((q31_t *) bufA, (float32_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("q31_to_float", "q31", size, size, cycles);
+    BENCH_TIME((void) 0, arm_q31_to_q15((q31_t *) bufA, (q15_t *) bufB, size));
+    bench_check(bufB, size * 2u);
+    bench_report("q31_to_q15", "q31", size, size, cycles);
+
+    prep_q15(bufA, size);
+    BENCH_TIME((void) 0, arm_q15_to_float((q15_t *) bufA, (float32_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("q15_to_float", "q15", size, size, cycles);
+    BENCH_TIME((void) 0, arm_q15_to_q31((q15_t *) bufA, (q31_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("q15_to_q31", "q15", size, size, cycles);
+
+    prep_q7(bufA, size);
+    BENCH_TIME((void) 0, arm_q7_to_float((q7_t *) bufA, (float32_t *) bufB, size));
+    bench_check(bufB, size * 4u);
+    bench_report("q7_to_float", "q7", size, size, cycles);
+    BENCH_TIME((void) 0, arm_q7_to_q15((q7_t *) bufA, (q15_t *) bufB, size));
+    bench_check(bufB, size * 2u);
+    bench_report("q7_to_q15", "q7", size, size, cycles);
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Benchmark Example
+ * ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  uint32_t cycles;
+
+#ifndef ARM_MATH_HOST
+  /* Enable the DWT unit and its cycle counter */
+  BENCH_DEMCR |= BENCH_DEMCR_TRCENA;
+  BENCH_DWT_CYCCNT = 0u;
+  BENCH_DWT_CTRL |= 1u;
+#endif
+
+  /* Calibrate the cost of reading the counter around an empty statement */
+  overhead = 0u;
+  BENCH_TIME((void) 0, (void) 0);
+  overhead = cycles;
+
+  bench_init_inputs();
+
+  bench_puts("# build," BENCH_BUILD_TAG "\n");
+#ifdef BENCH_CHECKSUM
+  bench_puts("kernel,type,size,cycles,cycles_per_sample,checksum\n");
+#else
+  bench_puts("kernel,type,size,cycles,cycles_per_sample\n");
+#endif
+
+  bench_fir();
+  bench_biquad();
+  bench_cfft();
+  bench_rfft();
+  bench_matrix();
+  bench_stats();
+  bench_conversions();
+
+  bench_puts("# done\n");
+
+#ifdef ARM_MATH_HOST
+  return 0;
+#else
+  while(1);                             /* main function does not return */
+#endif
+}
+
+/** \endlink */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dot_prod_exact_q31.c
+*
+* Description:	Q31 dot product accumulating the full precision products.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup dot_prod
+ * @{
+ */
+
+/**
+ * @brief Dot product of Q31 vectors accumulating the full precision products.
+ * @param[in]       *pSrcA points to the first input vector
+ * @param[in]       *pSrcB points to the second input vector
+ * @param[in]       blockSize number of samples in each vector
+ * @param[out]      *result output result returned here
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * arm_dot_prod_q31() truncates each 2.62 product to 2.48 before the accumulation, so
+ * the result of a long vector is off by up to <code>blockSize</code> LSBs of 2.48.
+ * Here no bit of the products is discarded: the upper words of the products, signed,
+ * and their lower words, unsigned, are added in two separate 64-bit accumulators,
+ * neither of which can overflow. The exact sum is rounded once to the 16.48 format of
+ * arm_dot_prod_q31(), with 15 guard bits, and there is no risk of overflow as long as
+ * the length of the vectors is less than 2^16 elements.
+ * The return result is in 16.48 format.
+ */
+
+void arm_dot_prod_exact_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  uint32_t blockSize,
+  q63_t * result)
+{
+  q63_t sumHi = 0;                               /* Sum of the upper words of the products */
+  uint64_t sumLo = 0u;                           /* Sum of the lower words of the products */
+  q63_t prod;                                    /* Product in 2.62 format */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t inA1, inA2, inA3, inA4;                  /* Temporary variables of A */
+  q31_t inB1, inB2, inB3, inB4;                  /* Temporary variables of B */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    inA1 = *pSrcA++;
+    inA2 = *pSrcA++;
+    inA3 = *pSrcA++;
+    inA4 = *pSrcA++;
+    inB1 = *pSrcB++;
+    inB2 = *pSrcB++;
+    inB3 = *pSrcB++;
+    inB4 = *pSrcB++;
+
+    /* Accumulate the two words of each product */
+    prod = (q63_t) inA1 * inB1;
+    sumHi += (q31_t) (prod >> 32);
+    sumLo += (uint32_t) prod;
+
+    prod = (q63_t) inA2 * inB2;
+    sumHi += (q31_t) (prod >> 32);
+    sumLo += (uint32_t) prod;
+
+    prod = (q63_t) inA3 * inB3;
+    sumHi += (q31_t) (prod >> 32);
+    sumLo += (uint32_t) prod;
+
+    prod = (q63_t) inA4 * inB4;
+    sumHi += (q31_t) (prod >> 32);
+    sumLo += (uint32_t) prod;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    prod = (q63_t) * pSrcA++ * *pSrcB++;
+    sumHi += (q31_t) (prod >> 32);
+    sumLo += (uint32_t) prod;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* The exact sum is sumHi * 2^32 + sumLo in 2.62 format: shift it by 14 bits to
+   * 16.48 format, rounding the lower words */
+  *result = (sumHi << 18) + (q63_t) ((sumLo + 0x2000u) >> 14);
+}
+
+/**
+ * @} end of dot_prod group
+ */
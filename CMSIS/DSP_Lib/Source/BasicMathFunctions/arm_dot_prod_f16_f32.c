@@ -0,0 +1,95 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dot_prod_f16_f32.c
+*
+* Description:	Dot product of a half-precision vector and a floating-point vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup dot_prod
+ * @{
+ */
+
+/**
+ * @brief Dot product of a half-precision vector and a floating-point vector.
+ * @param[in]       *pSrcA points to the half-precision input vector, weights for instance
+ * @param[in]       *pSrcB points to the floating-point input vector
+ * @param[in]       blockSize number of samples in each vector
+ * @param[out]      *result output result returned here
+ * @return none.
+ *
+ * \par
+ * The values of <code>pSrcA</code> are converted while being loaded, and the products
+ * accumulated in single precision as by arm_dot_prod_f32().
+ */
+
+void arm_dot_prod_f16_f32(
+  float16_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result)
+{
+  float32_t sum = 0.0f;                          /* Temporary result storage */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+/* Run the below code for Cortex-M4 and Cortex-M3 */
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+    sum += arm_f16_to_f32_scalar(*pSrcA++) * (*pSrcB++);
+    sum += arm_f16_to_f32_scalar(*pSrcA++) * (*pSrcB++);
+    sum += arm_f16_to_f32_scalar(*pSrcA++) * (*pSrcB++);
+    sum += arm_f16_to_f32_scalar(*pSrcA++) * (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    sum += arm_f16_to_f32_scalar(*pSrcA++) * (*pSrcB++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the result back in the destination buffer */
+  *result = sum;
+}
+
+/**
+ * @} end of dot_prod group
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dot_prod_multi_q15.c
+*
+* Description:	Dot products of a Q15 vector with a set of templates.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMath
+ */
+
+/**
+ * @addtogroup dot_prod
+ * @{
+ */
+
+/**
+ * @brief Dot products of a Q15 vector with a set of Q15 templates.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       *pTemplates points to the <code>numTemplates</code> templates of <code>blockSize</code> samples, stored one after the other
+ * @param[in]       numTemplates number of templates
+ * @param[in]       blockSize number of samples in the input vector and in each template
+ * @param[out]      *pResults points to the <code>numTemplates</code> results
+ * @return none.
+ *
+ * \par
+ * Computes <code>pResults[k]</code>, the dot product of <code>pSrc</code> with the
+ * template <code>k</code>, for all the templates, as arm_dot_prod_q15() called once per
+ * template would. On Cortex-M4 and Cortex-M3 the templates are processed by pairs:
+ * each pair of input samples is loaded once for two templates, so that 3 words are
+ * loaded for 4 multiply-accumulates instead of 4. The last template of an odd number
+ * of templates is computed by arm_dot_prod_q15().
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As in arm_dot_prod_q15(), the 2.30 products are added to 64-bit accumulators in 34.30
+ * format without risk of overflow. The results are in 34.30 format.
+ */
+
+void arm_dot_prod_multi_q15(
+  q15_t * pSrc,
+  q15_t * pTemplates,
+  uint32_t numTemplates,
+  uint32_t blockSize,
+  q63_t * pResults)
+{
+  q15_t *pT0 = pTemplates;                       /* Pointer to the current template */
+  uint32_t tmplCnt;                              /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q15_t *pX, *pT1;                               /* Input pointer and pointer to the second template */
+  q63_t sum0, sum1;                              /* Accumulators of the two templates */
+  q31_t x1, x2;                                  /* Input samples packed in words */
+  uint32_t blkCnt;                               /* loop counter */
+
+  /* Two templates at a time */
+  tmplCnt = numTemplates >> 1u;
+
+  while(tmplCnt > 0u)
+  {
+    pX = pSrc;
+    pT1 = pT0 + blockSize;
+    sum0 = 0;
+    sum1 = 0;
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 products per
+     ** template at a time. a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* Read 4 input samples once for both templates */
+      x1 = *__SIMD32(pX)++;
+      x2 = *__SIMD32(pX)++;
+
+      /* C0 += A[n] * T0[n] + A[n+1] * T0[n+1], C1 += A[n] * T1[n] + A[n+1] * T1[n+1] */
+      sum0 = __SMLALD(x1, *__SIMD32(pT0)++, sum0);
+      sum1 = __SMLALD(x1, *__SIMD32(pT1)++, sum1);
+      sum0 = __SMLALD(x2, *__SIMD32(pT0)++, sum0);
+      sum1 = __SMLALD(x2, *__SIMD32(pT1)++, sum1);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4u;
+
+    while(blkCnt > 0u)
+    {
+      sum0 += (q63_t) ((q31_t) * pX * *pT0++);
+      sum1 += (q63_t) ((q31_t) * pX++ * *pT1++);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Store the results in 34.30 format */
+    *pResults++ = sum0;
+    *pResults++ = sum1;
+
+    /* The next pair of templates starts after the second one */
+    pT0 = pT1;
+
+    /* Decrement the loop counter */
+    tmplCnt--;
+  }
+
+  /* The last template of an odd number of templates */
+  tmplCnt = numTemplates & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* One template at a time */
+  tmplCnt = numTemplates;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(tmplCnt > 0u)
+  {
+    arm_dot_prod_q15(pSrc, pT0, blockSize, pResults++);
+
+    pT0 += blockSize;
+
+    /* Decrement the loop counter */
+    tmplCnt--;
+  }
+}
+
+/**
+ * @} end of dot_prod group
+ */
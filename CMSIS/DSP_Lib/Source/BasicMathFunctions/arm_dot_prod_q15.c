@@ -74,32 +74,40 @@ void arm_dot_prod_q15(
 
 /* Run the below code for Cortex-M4 and Cortex-M3 */
 
+  q63_t sum1 = 0;                                /* Second accumulator */
 
   /*loop Unrolling */
-  blkCnt = blockSize >> 2u;
+  blkCnt = blockSize >> 3u;
 
-  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
-   ** a second loop below computes the remaining 1 to 3 samples. */
+  /* First part of the processing with loop unrolling.  Compute 8 products at a time
+   ** into two independent accumulators, so that each multiply-accumulate does not wait
+   ** for the result of the previous one and the loop overhead is shared by 8 samples.
+   ** a second loop below computes the remaining 1 to 7 samples. */
   while(blkCnt > 0u)
   {
     /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
     /* Calculate dot product and then store the result in a temporary buffer. */
     sum = __SMLALD(*__SIMD32(pSrcA)++, *__SIMD32(pSrcB)++, sum);
+    sum1 = __SMLALD(*__SIMD32(pSrcA)++, *__SIMD32(pSrcB)++, sum1);
     sum = __SMLALD(*__SIMD32(pSrcA)++, *__SIMD32(pSrcB)++, sum);
+    sum1 = __SMLALD(*__SIMD32(pSrcA)++, *__SIMD32(pSrcB)++, sum1);
 
     /* Decrement the loop counter */
     blkCnt--;
   }
 
-  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+  /* Combine the two accumulators */
+  sum += sum1;
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here.    
    ** No loop unrolling is used. */
-  blkCnt = blockSize % 0x4u;
+  blkCnt = blockSize % 0x8u;
 
   while(blkCnt > 0u)
   {
     /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
     /* Calculate dot product and then store the results in a temporary buffer. */
-    sum = __SMLALD(*pSrcA++, *pSrcB++, sum);
+    sum += (q63_t) ((q31_t) * pSrcA++ * *pSrcB++);
 
     /* Decrement the loop counter */
     blkCnt--;
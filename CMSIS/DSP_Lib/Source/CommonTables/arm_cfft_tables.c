@@ -0,0 +1,6248 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_tables.c
+*
+* Description:	Twiddle factor and bit reversal tables of the mixed radix floating-point CFFT
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup CFFT_CIFFT
+ * @{
+ */
+
+/**
+* \par
+* Example code for the twiddle factors of one radix-8 stage of span L:
+* \par
+* <pre>for(j = 1; j < L/8; j++)
+* {
+*   for(q = 1; q < 8; q++)
+*   {
+*     *pCoef++ = cos(j * q * 2*PI/(float)L);
+*     *pCoef++ = sin(j * q * 2*PI/(float)L);
+*   }
+* } </pre>
+* \par
+* The stages of a N point CFFT have the spans N, N/8, N/64... down to 16,
+* the stage of span 8 needing no twiddles.
+*/
+
+/**    
+* @brief  Floating-point twiddle factors of the 1024 point mixed radix CFFT    
+* \par    
+* The twiddles of the radix-8 stages of span 1024, 128, 16, one stage after the other:    
+* the 128 and 16 point CFFTs start at index 1778 and 1988. Below ARM_MATH_MAX_FFT_LEN = 1024,    
+* the table starts at the first stage used: twiddleCoef_128 or twiddleCoef_16.    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+const float32_t twiddleCoef_1024[2002] = {
+  0.9999811753f, 0.0061358846f, 0.9999247018f, 0.0122715383f,
+  0.9998305818f, 0.0184067299f, 0.9996988187f, 0.0245412285f,
+  0.9995294175f, 0.0306748032f, 0.9993223846f, 0.0368072229f,
+  0.9990777278f, 0.0429382569f, 0.9999247018f, 0.0122715383f,
+  0.9996988187f, 0.0245412285f, 0.9993223846f, 0.0368072229f,
+  0.9987954562f, 0.0490676743f, 0.9981181129f, 0.0613207363f,
+  0.9972904567f, 0.0735645636f, 0.9963126122f, 0.0857973123f,
+  0.9998305818f, 0.0184067299f, 0.9993223846f, 0.0368072229f,
+  0.9984755806f, 0.0551952443f, 0.9972904567f, 0.0735645636f,
+  0.9957674145f, 0.0919089565f, 0.9939069700f, 0.1102222073f,
+  0.9917097537f, 0.1284981108f, 0.9996988187f, 0.0245412285f,
+  0.9987954562f, 0.0490676743f, 0.9972904567f, 0.0735645636f,
+  0.9951847267f, 0.0980171403f, 0.9924795346f, 0.1224106752f,
+  0.9891765100f, 0.1467304745f, 0.9852776424f, 0.1709618888f,
+  0.9995294175f, 0.0306748032f, 0.9981181129f, 0.0613207363f,
+  0.9957674145f, 0.0919089565f, 0.9924795346f, 0.1224106752f,
+  0.9882575677f, 0.1527971853f, 0.9831054874f, 0.1830398880f,
+  0.9770281427f, 0.2131103199f, 0.9993223846f, 0.0368072229f,
+  0.9972904567f, 0.0735645636f, 0.9939069700f, 0.1102222073f,
+  0.9891765100f, 0.1467304745f, 0.9831054874f, 0.1830398880f,
+  0.9757021300f, 0.2191012402f, 0.9669764710f, 0.2548656596f,
+  0.9990777278f, 0.0429382569f, 0.9963126122f, 0.0857973123f,
+  0.9917097537f, 0.1284981108f, 0.9852776424f, 0.1709618888f,
+  0.9770281427f, 0.2131103199f, 0.9669764710f, 0.2548656596f,
+  0.9551411683f, 0.2961508882f, 0.9987954562f, 0.0490676743f,
+  0.9951847267f, 0.0980171403f, 0.9891765100f, 0.1467304745f,
+  0.9807852804f, 0.1950903220f, 0.9700312532f, 0.2429801799f,
+  0.9569403357f, 0.2902846773f, 0.9415440652f, 0.3368898534f,
+  0.9984755806f, 0.0551952443f, 0.9939069700f, 0.1102222073f,
+  0.9863080972f, 0.1649131205f, 0.9757021300f, 0.2191012402f,
+  0.9621214043f, 0.2726213554f, 0.9456073254f, 0.3253102922f,
+  0.9262102421f, 0.3770074102f, 0.9981181129f, 0.0613207363f,
+  0.9924795346f, 0.1224106752f, 0.9831054874f, 0.1830398880f,
+  0.9700312532f, 0.2429801799f, 0.9533060404f, 0.3020059493f,
+  0.9329927988f, 0.3598950365f, 0.9091679831f, 0.4164295601f,
+  0.9977230666f, 0.0674439196f, 0.9909026354f, 0.1345807085f,
+  0.9795697657f, 0.2011046348f, 0.9637760658f, 0.2667127575f,
+  0.9435934582f, 0.3311063058f, 0.9191138517f, 0.3939920401f,
+  0.8904487232f, 0.4550835871f, 0.9972904567f, 0.0735645636f,
+  0.9891765100f, 0.1467304745f, 0.9757021300f, 0.2191012402f,
+  0.9569403357f, 0.2902846773f, 0.9329927988f, 0.3598950365f,
+  0.9039892931f, 0.4275550934f, 0.8700869911f, 0.4928981922f,
+  0.9968202993f, 0.0796824380f, 0.9873014182f, 0.1588581433f,
+  0.9715038910f, 0.2370236060f, 0.9495281806f, 0.3136817404f,
+  0.9215140393f, 0.3883450467f, 0.8876396204f, 0.4605387110f,
+  0.8481203448f, 0.5298036247f, 0.9963126122f, 0.0857973123f,
+  0.9852776424f, 0.1709618888f, 0.9669764710f, 0.2548656596f,
+  0.9415440652f, 0.3368898534f, 0.9091679831f, 0.4164295601f,
+  0.8700869911f, 0.4928981922f, 0.8245893028f, 0.5657318108f,
+  0.9957674145f, 0.0919089565f, 0.9831054874f, 0.1830398880f,
+  0.9621214043f, 0.2726213554f, 0.9329927988f, 0.3598950365f,
+  0.8959662498f, 0.4441221446f, 0.8513551931f, 0.5245896827f,
+  0.7995372691f, 0.6006164794f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.9945645707f, 0.1041216339f, 0.9783173707f, 0.2071113762f,
+  0.9514350210f, 0.3078496400f, 0.9142097557f, 0.4052413140f,
+  0.8670462455f, 0.4982276670f, 0.8104571983f, 0.5857978575f,
+  0.7450577854f, 0.6669999223f, 0.9939069700f, 0.1102222073f,
+  0.9757021300f, 0.2191012402f, 0.9456073254f, 0.3253102922f,
+  0.9039892931f, 0.4275550934f, 0.8513551931f, 0.5245896827f,
+  0.7883464276f, 0.6152315906f, 0.7157308253f, 0.6983762494f,
+  0.9932119492f, 0.1163186309f, 0.9729399522f, 0.2310581083f,
+  0.9394592236f, 0.3426607173f, 0.8932243012f, 0.4496113297f,
+  0.8348628750f, 0.5504579729f, 0.7651672656f, 0.6438315429f,
+  0.6850836678f, 0.7284643904f, 0.9924795346f, 0.1224106752f,
+  0.9700312532f, 0.2429801799f, 0.9329927988f, 0.3598950365f,
+  0.8819212643f, 0.4713967368f, 0.8175848132f, 0.5758081914f,
+  0.7409511254f, 0.6715589548f, 0.6531728430f, 0.7572088465f,
+  0.9917097537f, 0.1284981108f, 0.9669764710f, 0.2548656596f,
+  0.9262102421f, 0.3770074102f, 0.8700869911f, 0.4928981922f,
+  0.7995372691f, 0.6006164794f, 0.7157308253f, 0.6983762494f,
+  0.6200572118f, 0.7845565972f, 0.9909026354f, 0.1345807085f,
+  0.9637760658f, 0.2667127575f, 0.9191138517f, 0.3939920401f,
+  0.8577286100f, 0.5141027442f, 0.7807372286f, 0.6248594881f,
+  0.6895405447f, 0.7242470830f, 0.5857978575f, 0.8104571983f,
+  0.9900582103f, 0.1406582393f, 0.9604305194f, 0.2785196894f,
+  0.9117060320f, 0.4108431711f, 0.8448535652f, 0.5349976199f,
+  0.7612023855f, 0.6485144010f, 0.6624157776f, 0.7491363945f,
+  0.5504579729f, 0.8348628750f, 0.9891765100f, 0.1467304745f,
+  0.9569403357f, 0.2902846773f, 0.9039892931f, 0.4275550934f,
+  0.8314696123f, 0.5555702330f, 0.7409511254f, 0.6715589548f,
+  0.6343932842f, 0.7730104534f, 0.5141027442f, 0.8577286100f,
+  0.9882575677f, 0.1527971853f, 0.9533060404f, 0.3020059493f,
+  0.8959662498f, 0.4441221446f, 0.8175848132f, 0.5758081914f,
+  0.7200025080f, 0.6939714609f, 0.6055110414f, 0.7958369046f,
+  0.4767992301f, 0.8790122264f, 0.9873014182f, 0.1588581433f,
+  0.9495281806f, 0.3136817404f, 0.8876396204f, 0.4605387110f,
+  0.8032075315f, 0.5956993045f, 0.6983762494f, 0.7157308253f,
+  0.5758081914f, 0.8175848132f, 0.4386162385f, 0.8986744657f,
+  0.9863080972f, 0.1649131205f, 0.9456073254f, 0.3253102922f,
+  0.8790122264f, 0.4767992301f, 0.7883464276f, 0.6152315906f,
+  0.6760927036f, 0.7368165689f, 0.5453249884f, 0.8382247056f,
+  0.3996241998f, 0.9166790599f, 0.9852776424f, 0.1709618888f,
+  0.9415440652f, 0.3368898534f, 0.8700869911f, 0.4928981922f,
+  0.7730104534f, 0.6343932842f, 0.6531728430f, 0.7572088465f,
+  0.5141027442f, 0.8577286100f, 0.3598950365f, 0.9329927988f,
+  0.9842100924f, 0.1770042204f, 0.9373390119f, 0.3484186802f,
+  0.8608669386f, 0.5088301425f, 0.7572088465f, 0.6531728430f,
+  0.6296382389f, 0.7768884657f, 0.4821837721f, 0.8760700942f,
+  0.3195020308f, 0.9475855910f, 0.9831054874f, 0.1830398880f,
+  0.9329927988f, 0.3598950365f, 0.8513551931f, 0.5245896827f,
+  0.7409511254f, 0.6715589548f, 0.6055110414f, 0.7958369046f,
+  0.4496113297f, 0.8932243012f, 0.2785196894f, 0.9604305194f,
+  0.9819638691f, 0.1890686641f, 0.9285060805f, 0.3713171940f,
+  0.8415549774f, 0.5401714727f, 0.7242470830f, 0.6895405447f,
+  0.5808139581f, 0.8140363297f, 0.4164295601f, 0.9091679831f,
+  0.2370236060f, 0.9715038910f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9795697657f, 0.2011046348f, 0.9191138517f, 0.3939920401f,
+  0.8211025150f, 0.5707807459f, 0.6895405447f, 0.7242470830f,
+  0.5298036247f, 0.8481203448f, 0.3484186802f, 0.9373390119f,
+  0.1527971853f, 0.9882575677f, 0.9783173707f, 0.2071113762f,
+  0.9142097557f, 0.4052413140f, 0.8104571983f, 0.5857978575f,
+  0.6715589548f, 0.7409511254f, 0.5035383837f, 0.8639728561f,
+  0.3136817404f, 0.9495281806f, 0.1102222073f, 0.9939069700f,
+  0.9770281427f, 0.2131103199f, 0.9091679831f, 0.4164295601f,
+  0.7995372691f, 0.6006164794f, 0.6531728430f, 0.7572088465f,
+  0.4767992301f, 0.8790122264f, 0.2785196894f, 0.9604305194f,
+  0.0674439196f, 0.9977230666f, 0.9757021300f, 0.2191012402f,
+  0.9039892931f, 0.4275550934f, 0.7883464276f, 0.6152315906f,
+  0.6343932842f, 0.7730104534f, 0.4496113297f, 0.8932243012f,
+  0.2429801799f, 0.9700312532f, 0.0245412285f, 0.9996988187f,
+  0.9743393828f, 0.2250839114f, 0.8986744657f, 0.4386162385f,
+  0.7768884657f, 0.6296382389f, 0.6152315906f, 0.7883464276f,
+  0.4220002708f, 0.9065957045f, 0.2071113762f, 0.9783173707f,
+  -0.0184067299f, 0.9998305818f, 0.9729399522f, 0.2310581083f,
+  0.8932243012f, 0.4496113297f, 0.7651672656f, 0.6438315429f,
+  0.5956993045f, 0.8032075315f, 0.3939920401f, 0.9191138517f,
+  0.1709618888f, 0.9852776424f, -0.0613207363f, 0.9981181129f,
+  0.9715038910f, 0.2370236060f, 0.8876396204f, 0.4605387110f,
+  0.7531867990f, 0.6578066933f, 0.5758081914f, 0.8175848132f,
+  0.3656129978f, 0.9307669611f, 0.1345807085f, 0.9909026354f,
+  -0.1041216339f, 0.9945645707f, 0.9700312532f, 0.2429801799f,
+  0.8819212643f, 0.4713967368f, 0.7409511254f, 0.6715589548f,
+  0.5555702330f, 0.8314696123f, 0.3368898534f, 0.9415440652f,
+  0.0980171403f, 0.9951847267f, -0.1467304745f, 0.9891765100f,
+  0.9685220943f, 0.2489276057f, 0.8760700942f, 0.4821837721f,
+  0.7284643904f, 0.6850836678f, 0.5349976199f, 0.8448535652f,
+  0.3078496400f, 0.9514350210f, 0.0613207363f, 0.9981181129f,
+  -0.1890686641f, 0.9819638691f, 0.9669764710f, 0.2548656596f,
+  0.8700869911f, 0.4928981922f, 0.7157308253f, 0.6983762494f,
+  0.5141027442f, 0.8577286100f, 0.2785196894f, 0.9604305194f,
+  0.0245412285f, 0.9996988187f, -0.2310581083f, 0.9729399522f,
+  0.9653944417f, 0.2607941179f, 0.8639728561f, 0.5035383837f,
+  0.7027547445f, 0.7114321957f, 0.4928981922f, 0.8700869911f,
+  0.2489276057f, 0.9685220943f, -0.0122715383f, 0.9999247018f,
+  -0.2726213554f, 0.9621214043f, 0.9637760658f, 0.2667127575f,
+  0.8577286100f, 0.5141027442f, 0.6895405447f, 0.7242470830f,
+  0.4713967368f, 0.8819212643f, 0.2191012402f, 0.9757021300f,
+  -0.0490676743f, 0.9987954562f, -0.3136817404f, 0.9495281806f,
+  0.9621214043f, 0.2726213554f, 0.8513551931f, 0.5245896827f,
+  0.6760927036f, 0.7368165689f, 0.4496113297f, 0.8932243012f,
+  0.1890686641f, 0.9819638691f, -0.0857973123f, 0.9963126122f,
+  -0.3541635254f, 0.9351835099f, 0.9604305194f, 0.2785196894f,
+  0.8448535652f, 0.5349976199f, 0.6624157776f, 0.7491363945f,
+  0.4275550934f, 0.9039892931f, 0.1588581433f, 0.9873014182f,
+  -0.1224106752f, 0.9924795346f, -0.3939920401f, 0.9191138517f,
+  0.9587034749f, 0.2844075372f, 0.8382247056f, 0.5453249884f,
+  0.6485144010f, 0.7612023855f, 0.4052413140f, 0.9142097557f,
+  0.1284981108f, 0.9917097537f, -0.1588581433f, 0.9873014182f,
+  -0.4330938189f, 0.9013488470f, 0.9569403357f, 0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.6343932842f, 0.7730104534f,
+  0.3826834324f, 0.9238795325f, 0.0980171403f, 0.9951847267f,
+  -0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  0.9551411683f, 0.2961508882f, 0.8245893028f, 0.5657318108f,
+  0.6200572118f, 0.7845565972f, 0.3598950365f, 0.9329927988f,
+  0.0674439196f, 0.9977230666f, -0.2310581083f, 0.9729399522f,
+  -0.5088301425f, 0.8608669386f, 0.9533060404f, 0.3020059493f,
+  0.8175848132f, 0.5758081914f, 0.6055110414f, 0.7958369046f,
+  0.3368898534f, 0.9415440652f, 0.0368072229f, 0.9993223846f,
+  -0.2667127575f, 0.9637760658f, -0.5453249884f, 0.8382247056f,
+  0.9514350210f, 0.3078496400f, 0.8104571983f, 0.5857978575f,
+  0.5907597019f, 0.8068475535f, 0.3136817404f, 0.9495281806f,
+  0.0061358846f, 0.9999811753f, -0.3020059493f, 0.9533060404f,
+  -0.5808139581f, 0.8140363297f, 0.9495281806f, 0.3136817404f,
+  0.8032075315f, 0.5956993045f, 0.5758081914f, 0.8175848132f,
+  0.2902846773f, 0.9569403357f, -0.0245412285f, 0.9996988187f,
+  -0.3368898534f, 0.9415440652f, -0.6152315906f, 0.7883464276f,
+  0.9475855910f, 0.3195020308f, 0.7958369046f, 0.6055110414f,
+  0.5606615762f, 0.8280450453f, 0.2667127575f, 0.9637760658f,
+  -0.0551952443f, 0.9984755806f, -0.3713171940f, 0.9285060805f,
+  -0.6485144010f, 0.7612023855f, 0.9456073254f, 0.3253102922f,
+  0.7883464276f, 0.6152315906f, 0.5453249884f, 0.8382247056f,
+  0.2429801799f, 0.9700312532f, -0.0857973123f, 0.9963126122f,
+  -0.4052413140f, 0.9142097557f, -0.6806009978f, 0.7326542717f,
+  0.9435934582f, 0.3311063058f, 0.7807372286f, 0.6248594881f,
+  0.5298036247f, 0.8481203448f, 0.2191012402f, 0.9757021300f,
+  -0.1163186309f, 0.9932119492f, -0.4386162385f, 0.8986744657f,
+  -0.7114321957f, 0.7027547445f, 0.9415440652f, 0.3368898534f,
+  0.7730104534f, 0.6343932842f, 0.5141027442f, 0.8577286100f,
+  0.1950903220f, 0.9807852804f, -0.1467304745f, 0.9891765100f,
+  -0.4713967368f, 0.8819212643f, -0.7409511254f, 0.6715589548f,
+  0.9394592236f, 0.3426607173f, 0.7651672656f, 0.6438315429f,
+  0.4982276670f, 0.8670462455f, 0.1709618888f, 0.9852776424f,
+  -0.1770042204f, 0.9842100924f, -0.5035383837f, 0.8639728561f,
+  -0.7691033376f, 0.6391244449f, 0.9373390119f, 0.3484186802f,
+  0.7572088465f, 0.6531728430f, 0.4821837721f, 0.8760700942f,
+  0.1467304745f, 0.9891765100f, -0.2071113762f, 0.9783173707f,
+  -0.5349976199f, 0.8448535652f, -0.7958369046f, 0.6055110414f,
+  0.9351835099f, 0.3541635254f, 0.7491363945f, 0.6624157776f,
+  0.4659764958f, 0.8847970984f, 0.1224106752f, 0.9924795346f,
+  -0.2370236060f, 0.9715038910f, -0.5657318108f, 0.8245893028f,
+  -0.8211025150f, 0.5707807459f, 0.9329927988f, 0.3598950365f,
+  0.7409511254f, 0.6715589548f, 0.4496113297f, 0.8932243012f,
+  0.0980171403f, 0.9951847267f, -0.2667127575f, 0.9637760658f,
+  -0.5956993045f, 0.8032075315f, -0.8448535652f, 0.5349976199f,
+  0.9307669611f, 0.3656129978f, 0.7326542717f, 0.6806009978f,
+  0.4330938189f, 0.9013488470f, 0.0735645636f, 0.9972904567f,
+  -0.2961508882f, 0.9551411683f, -0.6248594881f, 0.7807372286f,
+  -0.8670462455f, 0.4982276670f, 0.9285060805f, 0.3713171940f,
+  0.7242470830f, 0.6895405447f, 0.4164295601f, 0.9091679831f,
+  0.0490676743f, 0.9987954562f, -0.3253102922f, 0.9456073254f,
+  -0.6531728430f, 0.7572088465f, -0.8876396204f, 0.4605387110f,
+  0.9262102421f, 0.3770074102f, 0.7157308253f, 0.6983762494f,
+  0.3996241998f, 0.9166790599f, 0.0245412285f, 0.9996988187f,
+  -0.3541635254f, 0.9351835099f, -0.6806009978f, 0.7326542717f,
+  -0.9065957045f, 0.4220002708f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.9215140393f, 0.3883450467f, 0.6983762494f, 0.7157308253f,
+  0.3656129978f, 0.9307669611f, -0.0245412285f, 0.9996988187f,
+  -0.4108431711f, 0.9117060320f, -0.7326542717f, 0.6806009978f,
+  -0.9394592236f, 0.3426607173f, 0.9191138517f, 0.3939920401f,
+  0.6895405447f, 0.7242470830f, 0.3484186802f, 0.9373390119f,
+  -0.0490676743f, 0.9987954562f, -0.4386162385f, 0.8986744657f,
+  -0.7572088465f, 0.6531728430f, -0.9533060404f, 0.3020059493f,
+  0.9166790599f, 0.3996241998f, 0.6806009978f, 0.7326542717f,
+  0.3311063058f, 0.9435934582f, -0.0735645636f, 0.9972904567f,
+  -0.4659764958f, 0.8847970984f, -0.7807372286f, 0.6248594881f,
+  -0.9653944417f, 0.2607941179f, 0.9142097557f, 0.4052413140f,
+  0.6715589548f, 0.7409511254f, 0.3136817404f, 0.9495281806f,
+  -0.0980171403f, 0.9951847267f, -0.4928981922f, 0.8700869911f,
+  -0.8032075315f, 0.5956993045f, -0.9757021300f, 0.2191012402f,
+  0.9117060320f, 0.4108431711f, 0.6624157776f, 0.7491363945f,
+  0.2961508882f, 0.9551411683f, -0.1224106752f, 0.9924795346f,
+  -0.5193559902f, 0.8545579884f, -0.8245893028f, 0.5657318108f,
+  -0.9842100924f, 0.1770042204f, 0.9091679831f, 0.4164295601f,
+  0.6531728430f, 0.7572088465f, 0.2785196894f, 0.9604305194f,
+  -0.1467304745f, 0.9891765100f, -0.5453249884f, 0.8382247056f,
+  -0.8448535652f, 0.5349976199f, -0.9909026354f, 0.1345807085f,
+  0.9065957045f, 0.4220002708f, 0.6438315429f, 0.7651672656f,
+  0.2607941179f, 0.9653944417f, -0.1709618888f, 0.9852776424f,
+  -0.5707807459f, 0.8211025150f, -0.8639728561f, 0.5035383837f,
+  -0.9957674145f, 0.0919089565f, 0.9039892931f, 0.4275550934f,
+  0.6343932842f, 0.7730104534f, 0.2429801799f, 0.9700312532f,
+  -0.1950903220f, 0.9807852804f, -0.5956993045f, 0.8032075315f,
+  -0.8819212643f, 0.4713967368f, -0.9987954562f, 0.0490676743f,
+  0.9013488470f, 0.4330938189f, 0.6248594881f, 0.7807372286f,
+  0.2250839114f, 0.9743393828f, -0.2191012402f, 0.9757021300f,
+  -0.6200572118f, 0.7845565972f, -0.8986744657f, 0.4386162385f,
+  -0.9999811753f, 0.0061358846f, 0.8986744657f, 0.4386162385f,
+  0.6152315906f, 0.7883464276f, 0.2071113762f, 0.9783173707f,
+  -0.2429801799f, 0.9700312532f, -0.6438315429f, 0.7651672656f,
+  -0.9142097557f, 0.4052413140f, -0.9993223846f, -0.0368072229f,
+  0.8959662498f, 0.4441221446f, 0.6055110414f, 0.7958369046f,
+  0.1890686641f, 0.9819638691f, -0.2667127575f, 0.9637760658f,
+  -0.6669999223f, 0.7450577854f, -0.9285060805f, 0.3713171940f,
+  -0.9968202993f, -0.0796824380f, 0.8932243012f, 0.4496113297f,
+  0.5956993045f, 0.8032075315f, 0.1709618888f, 0.9852776424f,
+  -0.2902846773f, 0.9569403357f, -0.6895405447f, 0.7242470830f,
+  -0.9415440652f, 0.3368898534f, -0.9924795346f, -0.1224106752f,
+  0.8904487232f, 0.4550835871f, 0.5857978575f, 0.8104571983f,
+  0.1527971853f, 0.9882575677f, -0.3136817404f, 0.9495281806f,
+  -0.7114321957f, 0.7027547445f, -0.9533060404f, 0.3020059493f,
+  -0.9863080972f, -0.1649131205f, 0.8876396204f, 0.4605387110f,
+  0.5758081914f, 0.8175848132f, 0.1345807085f, 0.9909026354f,
+  -0.3368898534f, 0.9415440652f, -0.7326542717f, 0.6806009978f,
+  -0.9637760658f, 0.2667127575f, -0.9783173707f, -0.2071113762f,
+  0.8847970984f, 0.4659764958f, 0.5657318108f, 0.8245893028f,
+  0.1163186309f, 0.9932119492f, -0.3598950365f, 0.9329927988f,
+  -0.7531867990f, 0.6578066933f, -0.9729399522f, 0.2310581083f,
+  -0.9685220943f, -0.2489276057f, 0.8819212643f, 0.4713967368f,
+  0.5555702330f, 0.8314696123f, 0.0980171403f, 0.9951847267f,
+  -0.3826834324f, 0.9238795325f, -0.7730104534f, 0.6343932842f,
+  -0.9807852804f, 0.1950903220f, -0.9569403357f, -0.2902846773f,
+  0.8790122264f, 0.4767992301f, 0.5453249884f, 0.8382247056f,
+  0.0796824380f, 0.9968202993f, -0.4052413140f, 0.9142097557f,
+  -0.7921065773f, 0.6103828063f, -0.9873014182f, 0.1588581433f,
+  -0.9435934582f, -0.3311063058f, 0.8760700942f, 0.4821837721f,
+  0.5349976199f, 0.8448535652f, 0.0613207363f, 0.9981181129f,
+  -0.4275550934f, 0.9039892931f, -0.8104571983f, 0.5857978575f,
+  -0.9924795346f, 0.1224106752f, -0.9285060805f, -0.3713171940f,
+  0.8730949784f, 0.4875501601f, 0.5245896827f, 0.8513551931f,
+  0.0429382569f, 0.9990777278f, -0.4496113297f, 0.8932243012f,
+  -0.8280450453f, 0.5606615762f, -0.9963126122f, 0.0857973123f,
+  -0.9117060320f, -0.4108431711f, 0.8700869911f, 0.4928981922f,
+  0.5141027442f, 0.8577286100f, 0.0245412285f, 0.9996988187f,
+  -0.4713967368f, 0.8819212643f, -0.8448535652f, 0.5349976199f,
+  -0.9987954562f, 0.0490676743f, -0.8932243012f, -0.4496113297f,
+  0.8670462455f, 0.4982276670f, 0.5035383837f, 0.8639728561f,
+  0.0061358846f, 0.9999811753f, -0.4928981922f, 0.8700869911f,
+  -0.8608669386f, 0.5088301425f, -0.9999247018f, 0.0122715383f,
+  -0.8730949784f, -0.4875501601f, 0.8639728561f, 0.5035383837f,
+  0.4928981922f, 0.8700869911f, -0.0122715383f, 0.9999247018f,
+  -0.5141027442f, 0.8577286100f, -0.8760700942f, 0.4821837721f,
+  -0.9996988187f, -0.0245412285f, -0.8513551931f, -0.5245896827f,
+  0.8608669386f, 0.5088301425f, 0.4821837721f, 0.8760700942f,
+  -0.0306748032f, 0.9995294175f, -0.5349976199f, 0.8448535652f,
+  -0.8904487232f, 0.4550835871f, -0.9981181129f, -0.0613207363f,
+  -0.8280450453f, -0.5606615762f, 0.8577286100f, 0.5141027442f,
+  0.4713967368f, 0.8819212643f, -0.0490676743f, 0.9987954562f,
+  -0.5555702330f, 0.8314696123f, -0.9039892931f, 0.4275550934f,
+  -0.9951847267f, -0.0980171403f, -0.8032075315f, -0.5956993045f,
+  0.8545579884f, 0.5193559902f, 0.4605387110f, 0.8876396204f,
+  -0.0674439196f, 0.9977230666f, -0.5758081914f, 0.8175848132f,
+  -0.9166790599f, 0.3996241998f, -0.9909026354f, -0.1345807085f,
+  -0.7768884657f, -0.6296382389f, 0.8513551931f, 0.5245896827f,
+  0.4496113297f, 0.8932243012f, -0.0857973123f, 0.9963126122f,
+  -0.5956993045f, 0.8032075315f, -0.9285060805f, 0.3713171940f,
+  -0.9852776424f, -0.1709618888f, -0.7491363945f, -0.6624157776f,
+  0.8481203448f, 0.5298036247f, 0.4386162385f, 0.8986744657f,
+  -0.1041216339f, 0.9945645707f, -0.6152315906f, 0.7883464276f,
+  -0.9394592236f, 0.3426607173f, -0.9783173707f, -0.2071113762f,
+  -0.7200025080f, -0.6939714609f, 0.8448535652f, 0.5349976199f,
+  0.4275550934f, 0.9039892931f, -0.1224106752f, 0.9924795346f,
+  -0.6343932842f, 0.7730104534f, -0.9495281806f, 0.3136817404f,
+  -0.9700312532f, -0.2429801799f, -0.6895405447f, -0.7242470830f,
+  0.8415549774f, 0.5401714727f, 0.4164295601f, 0.9091679831f,
+  -0.1406582393f, 0.9900582103f, -0.6531728430f, 0.7572088465f,
+  -0.9587034749f, 0.2844075372f, -0.9604305194f, -0.2785196894f,
+  -0.6578066933f, -0.7531867990f, 0.8382247056f, 0.5453249884f,
+  0.4052413140f, 0.9142097557f, -0.1588581433f, 0.9873014182f,
+  -0.6715589548f, 0.7409511254f, -0.9669764710f, 0.2548656596f,
+  -0.9495281806f, -0.3136817404f, -0.6248594881f, -0.7807372286f,
+  0.8348628750f, 0.5504579729f, 0.3939920401f, 0.9191138517f,
+  -0.1770042204f, 0.9842100924f, -0.6895405447f, 0.7242470830f,
+  -0.9743393828f, 0.2250839114f, -0.9373390119f, -0.3484186802f,
+  -0.5907597019f, -0.8068475535f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.8280450453f, 0.5606615762f, 0.3713171940f, 0.9285060805f,
+  -0.2131103199f, 0.9770281427f, -0.7242470830f, 0.6895405447f,
+  -0.9863080972f, 0.1649131205f, -0.9091679831f, -0.4164295601f,
+  -0.5193559902f, -0.8545579884f, 0.8245893028f, 0.5657318108f,
+  0.3598950365f, 0.9329927988f, -0.2310581083f, 0.9729399522f,
+  -0.7409511254f, 0.6715589548f, -0.9909026354f, 0.1345807085f,
+  -0.8932243012f, -0.4496113297f, -0.4821837721f, -0.8760700942f,
+  0.8211025150f, 0.5707807459f, 0.3484186802f, 0.9373390119f,
+  -0.2489276057f, 0.9685220943f, -0.7572088465f, 0.6531728430f,
+  -0.9945645707f, 0.1041216339f, -0.8760700942f, -0.4821837721f,
+  -0.4441221446f, -0.8959662498f, 0.8175848132f, 0.5758081914f,
+  0.3368898534f, 0.9415440652f, -0.2667127575f, 0.9637760658f,
+  -0.7730104534f, 0.6343932842f, -0.9972904567f, 0.0735645636f,
+  -0.8577286100f, -0.5141027442f, -0.4052413140f, -0.9142097557f,
+  0.8140363297f, 0.5808139581f, 0.3253102922f, 0.9456073254f,
+  -0.2844075372f, 0.9587034749f, -0.7883464276f, 0.6152315906f,
+  -0.9990777278f, 0.0429382569f, -0.8382247056f, -0.5453249884f,
+  -0.3656129978f, -0.9307669611f, 0.8104571983f, 0.5857978575f,
+  0.3136817404f, 0.9495281806f, -0.3020059493f, 0.9533060404f,
+  -0.8032075315f, 0.5956993045f, -0.9999247018f, 0.0122715383f,
+  -0.8175848132f, -0.5758081914f, -0.3253102922f, -0.9456073254f,
+  0.8068475535f, 0.5907597019f, 0.3020059493f, 0.9533060404f,
+  -0.3195020308f, 0.9475855910f, -0.8175848132f, 0.5758081914f,
+  -0.9998305818f, -0.0184067299f, -0.7958369046f, -0.6055110414f,
+  -0.2844075372f, -0.9587034749f, 0.8032075315f, 0.5956993045f,
+  0.2902846773f, 0.9569403357f, -0.3368898534f, 0.9415440652f,
+  -0.8314696123f, 0.5555702330f, -0.9987954562f, -0.0490676743f,
+  -0.7730104534f, -0.6343932842f, -0.2429801799f, -0.9700312532f,
+  0.7995372691f, 0.6006164794f, 0.2785196894f, 0.9604305194f,
+  -0.3541635254f, 0.9351835099f, -0.8448535652f, 0.5349976199f,
+  -0.9968202993f, -0.0796824380f, -0.7491363945f, -0.6624157776f,
+  -0.2011046348f, -0.9795697657f, 0.7958369046f, 0.6055110414f,
+  0.2667127575f, 0.9637760658f, -0.3713171940f, 0.9285060805f,
+  -0.8577286100f, 0.5141027442f, -0.9939069700f, -0.1102222073f,
+  -0.7242470830f, -0.6895405447f, -0.1588581433f, -0.9873014182f,
+  0.7921065773f, 0.6103828063f, 0.2548656596f, 0.9669764710f,
+  -0.3883450467f, 0.9215140393f, -0.8700869911f, 0.4928981922f,
+  -0.9900582103f, -0.1406582393f, -0.6983762494f, -0.7157308253f,
+  -0.1163186309f, -0.9932119492f, 0.7883464276f, 0.6152315906f,
+  0.2429801799f, 0.9700312532f, -0.4052413140f, 0.9142097557f,
+  -0.8819212643f, 0.4713967368f, -0.9852776424f, -0.1709618888f,
+  -0.6715589548f, -0.7409511254f, -0.0735645636f, -0.9972904567f,
+  0.7845565972f, 0.6200572118f, 0.2310581083f, 0.9729399522f,
+  -0.4220002708f, 0.9065957045f, -0.8932243012f, 0.4496113297f,
+  -0.9795697657f, -0.2011046348f, -0.6438315429f, -0.7651672656f,
+  -0.0306748032f, -0.9995294175f, 0.7807372286f, 0.6248594881f,
+  0.2191012402f, 0.9757021300f, -0.4386162385f, 0.8986744657f,
+  -0.9039892931f, 0.4275550934f, -0.9729399522f, -0.2310581083f,
+  -0.6152315906f, -0.7883464276f, 0.0122715383f, -0.9999247018f,
+  0.7768884657f, 0.6296382389f, 0.2071113762f, 0.9783173707f,
+  -0.4550835871f, 0.8904487232f, -0.9142097557f, 0.4052413140f,
+  -0.9653944417f, -0.2607941179f, -0.5857978575f, -0.8104571983f,
+  0.0551952443f, -0.9984755806f, 0.7730104534f, 0.6343932842f,
+  0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  -0.9238795325f, 0.3826834324f, -0.9569403357f, -0.2902846773f,
+  -0.5555702330f, -0.8314696123f, 0.0980171403f, -0.9951847267f,
+  0.7691033376f, 0.6391244449f, 0.1830398880f, 0.9831054874f,
+  -0.4875501601f, 0.8730949784f, -0.9329927988f, 0.3598950365f,
+  -0.9475855910f, -0.3195020308f, -0.5245896827f, -0.8513551931f,
+  0.1406582393f, -0.9900582103f, 0.7651672656f, 0.6438315429f,
+  0.1709618888f, 0.9852776424f, -0.5035383837f, 0.8639728561f,
+  -0.9415440652f, 0.3368898534f, -0.9373390119f, -0.3484186802f,
+  -0.4928981922f, -0.8700869911f, 0.1830398880f, -0.9831054874f,
+  0.7612023855f, 0.6485144010f, 0.1588581433f, 0.9873014182f,
+  -0.5193559902f, 0.8545579884f, -0.9495281806f, 0.3136817404f,
+  -0.9262102421f, -0.3770074102f, -0.4605387110f, -0.8876396204f,
+  0.2250839114f, -0.9743393828f, 0.7572088465f, 0.6531728430f,
+  0.1467304745f, 0.9891765100f, -0.5349976199f, 0.8448535652f,
+  -0.9569403357f, 0.2902846773f, -0.9142097557f, -0.4052413140f,
+  -0.4275550934f, -0.9039892931f, 0.2667127575f, -0.9637760658f,
+  0.7531867990f, 0.6578066933f, 0.1345807085f, 0.9909026354f,
+  -0.5504579729f, 0.8348628750f, -0.9637760658f, 0.2667127575f,
+  -0.9013488470f, -0.4330938189f, -0.3939920401f, -0.9191138517f,
+  0.3078496400f, -0.9514350210f, 0.7491363945f, 0.6624157776f,
+  0.1224106752f, 0.9924795346f, -0.5657318108f, 0.8245893028f,
+  -0.9700312532f, 0.2429801799f, -0.8876396204f, -0.4605387110f,
+  -0.3598950365f, -0.9329927988f, 0.3484186802f, -0.9373390119f,
+  0.7450577854f, 0.6669999223f, 0.1102222073f, 0.9939069700f,
+  -0.5808139581f, 0.8140363297f, -0.9757021300f, 0.2191012402f,
+  -0.8730949784f, -0.4875501601f, -0.3253102922f, -0.9456073254f,
+  0.3883450467f, -0.9215140393f, 0.7409511254f, 0.6715589548f,
+  0.0980171403f, 0.9951847267f, -0.5956993045f, 0.8032075315f,
+  -0.9807852804f, 0.1950903220f, -0.8577286100f, -0.5141027442f,
+  -0.2902846773f, -0.9569403357f, 0.4275550934f, -0.9039892931f,
+  0.7368165689f, 0.6760927036f, 0.0857973123f, 0.9963126122f,
+  -0.6103828063f, 0.7921065773f, -0.9852776424f, 0.1709618888f,
+  -0.8415549774f, -0.5401714727f, -0.2548656596f, -0.9669764710f,
+  0.4659764958f, -0.8847970984f, 0.7326542717f, 0.6806009978f,
+  0.0735645636f, 0.9972904567f, -0.6248594881f, 0.7807372286f,
+  -0.9891765100f, 0.1467304745f, -0.8245893028f, -0.5657318108f,
+  -0.2191012402f, -0.9757021300f, 0.5035383837f, -0.8639728561f,
+  0.7284643904f, 0.6850836678f, 0.0613207363f, 0.9981181129f,
+  -0.6391244449f, 0.7691033376f, -0.9924795346f, 0.1224106752f,
+  -0.8068475535f, -0.5907597019f, -0.1830398880f, -0.9831054874f,
+  0.5401714727f, -0.8415549774f, 0.7242470830f, 0.6895405447f,
+  0.0490676743f, 0.9987954562f, -0.6531728430f, 0.7572088465f,
+  -0.9951847267f, 0.0980171403f, -0.7883464276f, -0.6152315906f,
+  -0.1467304745f, -0.9891765100f, 0.5758081914f, -0.8175848132f,
+  0.7200025080f, 0.6939714609f, 0.0368072229f, 0.9993223846f,
+  -0.6669999223f, 0.7450577854f, -0.9972904567f, 0.0735645636f,
+  -0.7691033376f, -0.6391244449f, -0.1102222073f, -0.9939069700f,
+  0.6103828063f, -0.7921065773f, 0.7157308253f, 0.6983762494f,
+  0.0245412285f, 0.9996988187f, -0.6806009978f, 0.7326542717f,
+  -0.9987954562f, 0.0490676743f, -0.7491363945f, -0.6624157776f,
+  -0.0735645636f, -0.9972904567f, 0.6438315429f, -0.7651672656f,
+  0.7114321957f, 0.7027547445f, 0.0122715383f, 0.9999247018f,
+  -0.6939714609f, 0.7200025080f, -0.9996988187f, 0.0245412285f,
+  -0.7284643904f, -0.6850836678f, -0.0368072229f, -0.9993223846f,
+  0.6760927036f, -0.7368165689f, 0.9987954562f, 0.0490676743f,
+  0.9951847267f, 0.0980171403f, 0.9891765100f, 0.1467304745f,
+  0.9807852804f, 0.1950903220f, 0.9700312532f, 0.2429801799f,
+  0.9569403357f, 0.2902846773f, 0.9415440652f, 0.3368898534f,
+  0.9951847267f, 0.0980171403f, 0.9807852804f, 0.1950903220f,
+  0.9569403357f, 0.2902846773f, 0.9238795325f, 0.3826834324f,
+  0.8819212643f, 0.4713967368f, 0.8314696123f, 0.5555702330f,
+  0.7730104534f, 0.6343932842f, 0.9891765100f, 0.1467304745f,
+  0.9569403357f, 0.2902846773f, 0.9039892931f, 0.4275550934f,
+  0.8314696123f, 0.5555702330f, 0.7409511254f, 0.6715589548f,
+  0.6343932842f, 0.7730104534f, 0.5141027442f, 0.8577286100f,
+  0.9807852804f, 0.1950903220f, 0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.7071067812f, 0.7071067812f,
+  0.5555702330f, 0.8314696123f, 0.3826834324f, 0.9238795325f,
+  0.1950903220f, 0.9807852804f, 0.9700312532f, 0.2429801799f,
+  0.8819212643f, 0.4713967368f, 0.7409511254f, 0.6715589548f,
+  0.5555702330f, 0.8314696123f, 0.3368898534f, 0.9415440652f,
+  0.0980171403f, 0.9951847267f, -0.1467304745f, 0.9891765100f,
+  0.9569403357f, 0.2902846773f, 0.8314696123f, 0.5555702330f,
+  0.6343932842f, 0.7730104534f, 0.3826834324f, 0.9238795325f,
+  0.0980171403f, 0.9951847267f, -0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, 0.9415440652f, 0.3368898534f,
+  0.7730104534f, 0.6343932842f, 0.5141027442f, 0.8577286100f,
+  0.1950903220f, 0.9807852804f, -0.1467304745f, 0.9891765100f,
+  -0.4713967368f, 0.8819212643f, -0.7409511254f, 0.6715589548f,
+  0.9238795325f, 0.3826834324f, 0.7071067812f, 0.7071067812f,
+  0.3826834324f, 0.9238795325f, 0.0000000000f, 1.0000000000f,
+  -0.3826834324f, 0.9238795325f, -0.7071067812f, 0.7071067812f,
+  -0.9238795325f, 0.3826834324f, 0.9039892931f, 0.4275550934f,
+  0.6343932842f, 0.7730104534f, 0.2429801799f, 0.9700312532f,
+  -0.1950903220f, 0.9807852804f, -0.5956993045f, 0.8032075315f,
+  -0.8819212643f, 0.4713967368f, -0.9987954562f, 0.0490676743f,
+  0.8819212643f, 0.4713967368f, 0.5555702330f, 0.8314696123f,
+  0.0980171403f, 0.9951847267f, -0.3826834324f, 0.9238795325f,
+  -0.7730104534f, 0.6343932842f, -0.9807852804f, 0.1950903220f,
+  -0.9569403357f, -0.2902846773f, 0.8577286100f, 0.5141027442f,
+  0.4713967368f, 0.8819212643f, -0.0490676743f, 0.9987954562f,
+  -0.5555702330f, 0.8314696123f, -0.9039892931f, 0.4275550934f,
+  -0.9951847267f, -0.0980171403f, -0.8032075315f, -0.5956993045f,
+  0.8314696123f, 0.5555702330f, 0.3826834324f, 0.9238795325f,
+  -0.1950903220f, 0.9807852804f, -0.7071067812f, 0.7071067812f,
+  -0.9807852804f, 0.1950903220f, -0.9238795325f, -0.3826834324f,
+  -0.5555702330f, -0.8314696123f, 0.8032075315f, 0.5956993045f,
+  0.2902846773f, 0.9569403357f, -0.3368898534f, 0.9415440652f,
+  -0.8314696123f, 0.5555702330f, -0.9987954562f, -0.0490676743f,
+  -0.7730104534f, -0.6343932842f, -0.2429801799f, -0.9700312532f,
+  0.7730104534f, 0.6343932842f, 0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, -0.9238795325f, 0.3826834324f,
+  -0.9569403357f, -0.2902846773f, -0.5555702330f, -0.8314696123f,
+  0.0980171403f, -0.9951847267f, 0.7409511254f, 0.6715589548f,
+  0.0980171403f, 0.9951847267f, -0.5956993045f, 0.8032075315f,
+  -0.9807852804f, 0.1950903220f, -0.8577286100f, -0.5141027442f,
+  -0.2902846773f, -0.9569403357f, 0.4275550934f, -0.9039892931f,
+  0.9238795325f, 0.3826834324f, 0.7071067812f, 0.7071067812f,
+  0.3826834324f, 0.9238795325f, 0.0000000000f, 1.0000000000f,
+  -0.3826834324f, 0.9238795325f, -0.7071067812f, 0.7071067812f,
+  -0.9238795325f, 0.3826834324f
+};
+#elif (ARM_MATH_MAX_FFT_LEN >= 128)
+const float32_t twiddleCoef_128[224] = {
+  0.9987954562f, 0.0490676743f, 0.9951847267f, 0.0980171403f,
+  0.9891765100f, 0.1467304745f, 0.9807852804f, 0.1950903220f,
+  0.9700312532f, 0.2429801799f, 0.9569403357f, 0.2902846773f,
+  0.9415440652f, 0.3368898534f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.9891765100f, 0.1467304745f, 0.9569403357f, 0.2902846773f,
+  0.9039892931f, 0.4275550934f, 0.8314696123f, 0.5555702330f,
+  0.7409511254f, 0.6715589548f, 0.6343932842f, 0.7730104534f,
+  0.5141027442f, 0.8577286100f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9700312532f, 0.2429801799f, 0.8819212643f, 0.4713967368f,
+  0.7409511254f, 0.6715589548f, 0.5555702330f, 0.8314696123f,
+  0.3368898534f, 0.9415440652f, 0.0980171403f, 0.9951847267f,
+  -0.1467304745f, 0.9891765100f, 0.9569403357f, 0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.6343932842f, 0.7730104534f,
+  0.3826834324f, 0.9238795325f, 0.0980171403f, 0.9951847267f,
+  -0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  0.9415440652f, 0.3368898534f, 0.7730104534f, 0.6343932842f,
+  0.5141027442f, 0.8577286100f, 0.1950903220f, 0.9807852804f,
+  -0.1467304745f, 0.9891765100f, -0.4713967368f, 0.8819212643f,
+  -0.7409511254f, 0.6715589548f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.9039892931f, 0.4275550934f, 0.6343932842f, 0.7730104534f,
+  0.2429801799f, 0.9700312532f, -0.1950903220f, 0.9807852804f,
+  -0.5956993045f, 0.8032075315f, -0.8819212643f, 0.4713967368f,
+  -0.9987954562f, 0.0490676743f, 0.8819212643f, 0.4713967368f,
+  0.5555702330f, 0.8314696123f, 0.0980171403f, 0.9951847267f,
+  -0.3826834324f, 0.9238795325f, -0.7730104534f, 0.6343932842f,
+  -0.9807852804f, 0.1950903220f, -0.9569403357f, -0.2902846773f,
+  0.8577286100f, 0.5141027442f, 0.4713967368f, 0.8819212643f,
+  -0.0490676743f, 0.9987954562f, -0.5555702330f, 0.8314696123f,
+  -0.9039892931f, 0.4275550934f, -0.9951847267f, -0.0980171403f,
+  -0.8032075315f, -0.5956993045f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.8032075315f, 0.5956993045f, 0.2902846773f, 0.9569403357f,
+  -0.3368898534f, 0.9415440652f, -0.8314696123f, 0.5555702330f,
+  -0.9987954562f, -0.0490676743f, -0.7730104534f, -0.6343932842f,
+  -0.2429801799f, -0.9700312532f, 0.7730104534f, 0.6343932842f,
+  0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  -0.9238795325f, 0.3826834324f, -0.9569403357f, -0.2902846773f,
+  -0.5555702330f, -0.8314696123f, 0.0980171403f, -0.9951847267f,
+  0.7409511254f, 0.6715589548f, 0.0980171403f, 0.9951847267f,
+  -0.5956993045f, 0.8032075315f, -0.9807852804f, 0.1950903220f,
+  -0.8577286100f, -0.5141027442f, -0.2902846773f, -0.9569403357f,
+  0.4275550934f, -0.9039892931f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324
+};
+#elif (ARM_MATH_MAX_FFT_LEN >= 16)
+const float32_t twiddleCoef_16[14] = {
+  0.9238795325f, 0.3826834324f, 0.7071067812f, 0.7071067812f,
+  0.3826834324f, 0.9238795325f, 0.0000000000f, 1.0000000000f,
+  -0.3826834324f, 0.9238795325f, -0.7071067812f, 0.7071067812f,
+  -0.9238795325f, 0.3826834324
+};
+#endif
+
+/**    
+* @brief  Floating-point twiddle factors of the 2048 point mixed radix CFFT    
+* \par    
+* The twiddles of the radix-8 stages of span 2048, 256, 32, one stage after the other:    
+* the 256 and 32 point CFFTs start at index 3570 and 4004. Below ARM_MATH_MAX_FFT_LEN = 2048,    
+* the table starts at the first stage used: twiddleCoef_256 or twiddleCoef_32.    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
+const float32_t twiddleCoef_2048[4046] = {
+  0.9999952938f, 0.0030679568f, 0.9999811753f, 0.0061358846f,
+  0.9999576446f, 0.0092037548f, 0.9999247018f, 0.0122715383f,
+  0.9998823475f, 0.0153392063f, 0.9998305818f, 0.0184067299f,
+  0.9997694054f, 0.0214740803f, 0.9999811753f, 0.0061358846f,
+  0.9999247018f, 0.0122715383f, 0.9998305818f, 0.0184067299f,
+  0.9996988187f, 0.0245412285f, 0.9995294175f, 0.0306748032f,
+  0.9993223846f, 0.0368072229f, 0.9990777278f, 0.0429382569f,
+  0.9999576446f, 0.0092037548f, 0.9998305818f, 0.0184067299f,
+  0.9996188225f, 0.0276081458f, 0.9993223846f, 0.0368072229f,
+  0.9989412932f, 0.0460031821f, 0.9984755806f, 0.0551952443f,
+  0.9979252862f, 0.0643826309f, 0.9999247018f, 0.0122715383f,
+  0.9996988187f, 0.0245412285f, 0.9993223846f, 0.0368072229f,
+  0.9987954562f, 0.0490676743f, 0.9981181129f, 0.0613207363f,
+  0.9972904567f, 0.0735645636f, 0.9963126122f, 0.0857973123f,
+  0.9998823475f, 0.0153392063f, 0.9995294175f, 0.0306748032f,
+  0.9989412932f, 0.0460031821f, 0.9981181129f, 0.0613207363f,
+  0.9970600703f, 0.0766238614f, 0.9957674145f, 0.0919089565f,
+  0.9942404495f, 0.1071724250f, 0.9998305818f, 0.0184067299f,
+  0.9993223846f, 0.0368072229f, 0.9984755806f, 0.0551952443f,
+  0.9972904567f, 0.0735645636f, 0.9957674145f, 0.0919089565f,
+  0.9939069700f, 0.1102222073f, 0.9917097537f, 0.1284981108f,
+  0.9997694054f, 0.0214740803f, 0.9990777278f, 0.0429382569f,
+  0.9979252862f, 0.0643826309f, 0.9963126122f, 0.0857973123f,
+  0.9942404495f, 0.1071724250f, 0.9917097537f, 0.1284981108f,
+  0.9887216920f, 0.1497645347f, 0.9996988187f, 0.0245412285f,
+  0.9987954562f, 0.0490676743f, 0.9972904567f, 0.0735645636f,
+  0.9951847267f, 0.0980171403f, 0.9924795346f, 0.1224106752f,
+  0.9891765100f, 0.1467304745f, 0.9852776424f, 0.1709618888f,
+  0.9996188225f, 0.0276081458f, 0.9984755806f, 0.0551952443f,
+  0.9965711458f, 0.0827402645f, 0.9939069700f, 0.1102222073f,
+  0.9904850843f, 0.1376201216f, 0.9863080972f, 0.1649131205f,
+  0.9813791933f, 0.1920803970f, 0.9995294175f, 0.0306748032f,
+  0.9981181129f, 0.0613207363f, 0.9957674145f, 0.0919089565f,
+  0.9924795346f, 0.1224106752f, 0.9882575677f, 0.1527971853f,
+  0.9831054874f, 0.1830398880f, 0.9770281427f, 0.2131103199f,
+  0.9994306046f, 0.0337411719f, 0.9977230666f, 0.0674439196f,
+  0.9948793308f, 0.1010698628f, 0.9909026354f, 0.1345807085f,
+  0.9857975092f, 0.1679382950f, 0.9795697657f, 0.2011046348f,
+  0.9722264971f, 0.2340419586f, 0.9993223846f, 0.0368072229f,
+  0.9972904567f, 0.0735645636f, 0.9939069700f, 0.1102222073f,
+  0.9891765100f, 0.1467304745f, 0.9831054874f, 0.1830398880f,
+  0.9757021300f, 0.2191012402f, 0.9669764710f, 0.2548656596f,
+  0.9992047586f, 0.0398729276f, 0.9968202993f, 0.0796824380f,
+  0.9928504145f, 0.1193652148f, 0.9873014182f, 0.1588581433f,
+  0.9801821360f, 0.1980984107f, 0.9715038910f, 0.2370236060f,
+  0.9612804858f, 0.2755718193f, 0.9990777278f, 0.0429382569f,
+  0.9963126122f, 0.0857973123f, 0.9917097537f, 0.1284981108f,
+  0.9852776424f, 0.1709618888f, 0.9770281427f, 0.2131103199f,
+  0.9669764710f, 0.2548656596f, 0.9551411683f, 0.2961508882f,
+  0.9989412932f, 0.0460031821f, 0.9957674145f, 0.0919089565f,
+  0.9904850843f, 0.1376201216f, 0.9831054874f, 0.1830398880f,
+  0.9736442497f, 0.2280720832f, 0.9621214043f, 0.2726213554f,
+  0.9485613499f, 0.3165933756f, 0.9987954562f, 0.0490676743f,
+  0.9951847267f, 0.0980171403f, 0.9891765100f, 0.1467304745f,
+  0.9807852804f, 0.1950903220f, 0.9700312532f, 0.2429801799f,
+  0.9569403357f, 0.2902846773f, 0.9415440652f, 0.3368898534f,
+  0.9986402182f, 0.0521317047f, 0.9945645707f, 0.1041216339f,
+  0.9877841416f, 0.1558283977f, 0.9783173707f, 0.2071113762f,
+  0.9661900034f, 0.2578311022f, 0.9514350210f, 0.3078496400f,
+  0.9340925504f, 0.3570309612f, 0.9984755806f, 0.0551952443f,
+  0.9939069700f, 0.1102222073f, 0.9863080972f, 0.1649131205f,
+  0.9757021300f, 0.2191012402f, 0.9621214043f, 0.2726213554f,
+  0.9456073254f, 0.3253102922f, 0.9262102421f, 0.3770074102f,
+  0.9983015449f, 0.0582582645f, 0.9932119492f, 0.1163186309f,
+  0.9847485018f, 0.1739838734f, 0.9729399522f, 0.2310581083f,
+  0.9578264130f, 0.2873474595f, 0.9394592236f, 0.3426607173f,
+  0.9179007756f, 0.3968099874f, 0.9981181129f, 0.0613207363f,
+  0.9924795346f, 0.1224106752f, 0.9831054874f, 0.1830398880f,
+  0.9700312532f, 0.2429801799f, 0.9533060404f, 0.3020059493f,
+  0.9329927988f, 0.3598950365f, 0.9091679831f, 0.4164295601f,
+  0.9979252862f, 0.0643826309f, 0.9917097537f, 0.1284981108f,
+  0.9813791933f, 0.1920803970f, 0.9669764710f, 0.2548656596f,
+  0.9485613499f, 0.3165933756f, 0.9262102421f, 0.3770074102f,
+  0.9000158920f, 0.4358570799f, 0.9977230666f, 0.0674439196f,
+  0.9909026354f, 0.1345807085f, 0.9795697657f, 0.2011046348f,
+  0.9637760658f, 0.2667127575f, 0.9435934582f, 0.3311063058f,
+  0.9191138517f, 0.3939920401f, 0.8904487232f, 0.4550835871f,
+  0.9975114561f, 0.0705045734f, 0.9900582103f, 0.1406582393f,
+  0.9776773578f, 0.2101118369f, 0.9604305194f, 0.2785196894f,
+  0.9384035341f, 0.3455413250f, 0.9117060320f, 0.4108431711f,
+  0.8804708891f, 0.4741002147f, 0.9972904567f, 0.0735645636f,
+  0.9891765100f, 0.1467304745f, 0.9757021300f, 0.2191012402f,
+  0.9569403357f, 0.2902846773f, 0.9329927988f, 0.3598950365f,
+  0.9039892931f, 0.4275550934f, 0.8700869911f, 0.4928981922f,
+  0.9970600703f, 0.0766238614f, 0.9882575677f, 0.1527971853f,
+  0.9736442497f, 0.2280720832f, 0.9533060404f, 0.3020059493f,
+  0.9273625257f, 0.3741640630f, 0.8959662498f, 0.4441221446f,
+  0.8593018184f, 0.5114688504f, 0.9968202993f, 0.0796824380f,
+  0.9873014182f, 0.1588581433f, 0.9715038910f, 0.2370236060f,
+  0.9495281806f, 0.3136817404f, 0.9215140393f, 0.3883450467f,
+  0.8876396204f, 0.4605387110f, 0.8481203448f, 0.5298036247f,
+  0.9965711458f, 0.0827402645f, 0.9863080972f, 0.1649131205f,
+  0.9692812354f, 0.2459550503f, 0.9456073254f, 0.3253102922f,
+  0.9154487161f, 0.4024346509f, 0.8790122264f, 0.4767992301f,
+  0.8365477272f, 0.5478940592f, 0.9963126122f, 0.0857973123f,
+  0.9852776424f, 0.1709618888f, 0.9669764710f, 0.2548656596f,
+  0.9415440652f, 0.3368898534f, 0.9091679831f, 0.4164295601f,
+  0.8700869911f, 0.4928981922f, 0.8245893028f, 0.5657318108f,
+  0.9960447009f, 0.0888535526f, 0.9842100924f, 0.1770042204f,
+  0.9645897933f, 0.2637546790f, 0.9373390119f, 0.3484186802f,
+  0.9026733182f, 0.4303264813f, 0.8608669386f, 0.5088301425f,
+  0.8122505866f, 0.5833086529f, 0.9957674145f, 0.0919089565f,
+  0.9831054874f, 0.1830398880f, 0.9621214043f, 0.2726213554f,
+  0.9329927988f, 0.3598950365f, 0.8959662498f, 0.4441221446f,
+  0.8513551931f, 0.5245896827f, 0.7995372691f, 0.6006164794f,
+  0.9954807555f, 0.0949634953f, 0.9819638691f, 0.1890686641f,
+  0.9595715131f, 0.2814649379f, 0.9285060805f, 0.3713171940f,
+  0.8890483559f, 0.4578133036f, 0.8415549774f, 0.5401714727f,
+  0.7864552136f, 0.6176473079f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.9948793308f, 0.1010698628f, 0.9795697657f, 0.2011046348f,
+  0.9542280951f, 0.2990798263f, 0.9191138517f, 0.3939920401f,
+  0.8745866523f, 0.4848692480f, 0.8211025150f, 0.5707807459f,
+  0.7592091890f, 0.6508466850f, 0.9945645707f, 0.1041216339f,
+  0.9783173707f, 0.2071113762f, 0.9514350210f, 0.3078496400f,
+  0.9142097557f, 0.4052413140f, 0.8670462455f, 0.4982276670f,
+  0.8104571983f, 0.5857978575f, 0.7450577854f, 0.6669999223f,
+  0.9942404495f, 0.1071724250f, 0.9770281427f, 0.2131103199f,
+  0.9485613499f, 0.3165933756f, 0.9091679831f, 0.4164295601f,
+  0.8593018184f, 0.5114688504f, 0.7995372691f, 0.6006164794f,
+  0.7305627692f, 0.6828455464f, 0.9939069700f, 0.1102222073f,
+  0.9757021300f, 0.2191012402f, 0.9456073254f, 0.3253102922f,
+  0.9039892931f, 0.4275550934f, 0.8513551931f, 0.5245896827f,
+  0.7883464276f, 0.6152315906f, 0.7157308253f, 0.6983762494f,
+  0.9935641355f, 0.1132709522f, 0.9743393828f, 0.2250839114f,
+  0.9425731976f, 0.3339996514f, 0.8986744657f, 0.4386162385f,
+  0.8432082396f, 0.5375870763f, 0.7768884657f, 0.6296382389f,
+  0.7005687939f, 0.7135848688f, 0.9932119492f, 0.1163186309f,
+  0.9729399522f, 0.2310581083f, 0.9394592236f, 0.3426607173f,
+  0.8932243012f, 0.4496113297f, 0.8348628750f, 0.5504579729f,
+  0.7651672656f, 0.6438315429f, 0.6850836678f, 0.7284643904f,
+  0.9928504145f, 0.1193652148f, 0.9715038910f, 0.2370236060f,
+  0.9362656672f, 0.3512927561f, 0.8876396204f, 0.4605387110f,
+  0.8263210628f, 0.5631993440f, 0.7531867990f, 0.6578066933f,
+  0.6692825883f, 0.7430079521f, 0.9924795346f, 0.1224106752f,
+  0.9700312532f, 0.2429801799f, 0.9329927988f, 0.3598950365f,
+  0.8819212643f, 0.4713967368f, 0.8175848132f, 0.5758081914f,
+  0.7409511254f, 0.6715589548f, 0.6531728430f, 0.7572088465f,
+  0.9920993131f, 0.1254549834f, 0.9685220943f, 0.2489276057f,
+  0.9296408958f, 0.3684668300f, 0.8760700942f, 0.4821837721f,
+  0.8086561816f, 0.5882815482f, 0.7284643904f, 0.6850836678f,
+  0.6367618612f, 0.7710605243f, 0.9917097537f, 0.1284981108f,
+  0.9669764710f, 0.2548656596f, 0.9262102421f, 0.3770074102f,
+  0.8700869911f, 0.4928981922f, 0.7995372691f, 0.6006164794f,
+  0.7157308253f, 0.6983762494f, 0.6200572118f, 0.7845565972f,
+  0.9913108598f, 0.1315400287f, 0.9653944417f, 0.2607941179f,
+  0.9227011283f, 0.3855160538f, 0.8639728561f, 0.5035383837f,
+  0.7902302214f, 0.6128100824f, 0.7027547445f, 0.7114321957f,
+  0.6030665985f, 0.7976908409f, 0.9909026354f, 0.1345807085f,
+  0.9637760658f, 0.2667127575f, 0.9191138517f, 0.3939920401f,
+  0.8577286100f, 0.5141027442f, 0.7807372286f, 0.6248594881f,
+  0.6895405447f, 0.7242470830f, 0.5857978575f, 0.8104571983f,
+  0.9904850843f, 0.1376201216f, 0.9621214043f, 0.2726213554f,
+  0.9154487161f, 0.4024346509f, 0.8513551931f, 0.5245896827f,
+  0.7710605243f, 0.6367618612f, 0.6760927036f, 0.7368165689f,
+  0.5682589527f, 0.8228497814f, 0.9900582103f, 0.1406582393f,
+  0.9604305194f, 0.2785196894f, 0.9117060320f, 0.4108431711f,
+  0.8448535652f, 0.5349976199f, 0.7612023855f, 0.6485144010f,
+  0.6624157776f, 0.7491363945f, 0.5504579729f, 0.8348628750f,
+  0.9896220175f, 0.1436950332f, 0.9587034749f, 0.2844075372f,
+  0.9078861165f, 0.4192168884f, 0.8382247056f, 0.5453249884f,
+  0.7511651319f, 0.6601143421f, 0.6485144010f, 0.7612023855f,
+  0.5324031279f, 0.8464909388f, 0.9891765100f, 0.1467304745f,
+  0.9569403357f, 0.2902846773f, 0.9039892931f, 0.4275550934f,
+  0.8314696123f, 0.5555702330f, 0.7409511254f, 0.6715589548f,
+  0.6343932842f, 0.7730104534f, 0.5141027442f, 0.8577286100f,
+  0.9887216920f, 0.1497645347f, 0.9551411683f, 0.2961508882f,
+  0.9000158920f, 0.4358570799f, 0.8245893028f, 0.5657318108f,
+  0.7305627692f, 0.6828455464f, 0.6200572118f, 0.7845565972f,
+  0.4955652618f, 0.8685707060f, 0.9882575677f, 0.1527971853f,
+  0.9533060404f, 0.3020059493f, 0.8959662498f, 0.4441221446f,
+  0.8175848132f, 0.5758081914f, 0.7200025080f, 0.6939714609f,
+  0.6055110414f, 0.7958369046f, 0.4767992301f, 0.8790122264f,
+  0.9877841416f, 0.1558283977f, 0.9514350210f, 0.3078496400f,
+  0.8918407094f, 0.4523495872f, 0.8104571983f, 0.5857978575f,
+  0.7092728264f, 0.7049340804f, 0.5907597019f, 0.8068475535f,
+  0.4578133036f, 0.8890483559f, 0.9873014182f, 0.1588581433f,
+  0.9495281806f, 0.3136817404f, 0.8876396204f, 0.4605387110f,
+  0.8032075315f, 0.5956993045f, 0.6983762494f, 0.7157308253f,
+  0.5758081914f, 0.8175848132f, 0.4386162385f, 0.8986744657f,
+  0.9868094018f, 0.1618863938f, 0.9475855910f, 0.3195020308f,
+  0.8833633387f, 0.4686888220f, 0.7958369046f, 0.6055110414f,
+  0.6873153409f, 0.7263591551f, 0.5606615762f, 0.8280450453f,
+  0.4192168884f, 0.9078861165f, 0.9863080972f, 0.1649131205f,
+  0.9456073254f, 0.3253102922f, 0.8790122264f, 0.4767992301f,
+  0.7883464276f, 0.6152315906f, 0.6760927036f, 0.7368165689f,
+  0.5453249884f, 0.8382247056f, 0.3996241998f, 0.9166790599f,
+  0.9857975092f, 0.1679382950f, 0.9435934582f, 0.3311063058f,
+  0.8745866523f, 0.4848692480f, 0.7807372286f, 0.6248594881f,
+  0.6647109782f, 0.7471006060f, 0.5298036247f, 0.8481203448f,
+  0.3798472089f, 0.9250492408f, 0.9852776424f, 0.1709618888f,
+  0.9415440652f, 0.3368898534f, 0.8700869911f, 0.4928981922f,
+  0.7730104534f, 0.6343932842f, 0.6531728430f, 0.7572088465f,
+  0.5141027442f, 0.8577286100f, 0.3598950365f, 0.9329927988f,
+  0.9847485018f, 0.1739838734f, 0.9394592236f, 0.3426607173f,
+  0.8655136241f, 0.5008853826f, 0.7651672656f, 0.6438315429f,
+  0.6414810128f, 0.7671389119f, 0.4982276670f, 0.8670462455f,
+  0.3397768844f, 0.9405060706f, 0.9842100924f, 0.1770042204f,
+  0.9373390119f, 0.3484186802f, 0.8608669386f, 0.5088301425f,
+  0.7572088465f, 0.6531728430f, 0.6296382389f, 0.7768884657f,
+  0.4821837721f, 0.8760700942f, 0.3195020308f, 0.9475855910f,
+  0.9836624192f, 0.1800229014f, 0.9351835099f, 0.3541635254f,
+  0.8561473284f, 0.5167317990f, 0.7491363945f, 0.6624157776f,
+  0.6176473079f, 0.7864552136f, 0.4659764958f, 0.8847970984f,
+  0.2990798263f, 0.9542280951f, 0.9831054874f, 0.1830398880f,
+  0.9329927988f, 0.3598950365f, 0.8513551931f, 0.5245896827f,
+  0.7409511254f, 0.6715589548f, 0.6055110414f, 0.7958369046f,
+  0.4496113297f, 0.8932243012f, 0.2785196894f, 0.9604305194f,
+  0.9825393023f, 0.1860551517f, 0.9307669611f, 0.3656129978f,
+  0.8464909388f, 0.5324031279f, 0.7326542717f, 0.6806009978f,
+  0.5932322950f, 0.8050313311f, 0.4330938189f, 0.9013488470f,
+  0.2578311022f, 0.9661900034f, 0.9819638691f, 0.1890686641f,
+  0.9285060805f, 0.3713171940f, 0.8415549774f, 0.5401714727f,
+  0.7242470830f, 0.6895405447f, 0.5808139581f, 0.8140363297f,
+  0.4164295601f, 0.9091679831f, 0.2370236060f, 0.9715038910f,
+  0.9813791933f, 0.1920803970f, 0.9262102421f, 0.3770074102f,
+  0.8365477272f, 0.5478940592f, 0.7157308253f, 0.6983762494f,
+  0.5682589527f, 0.8228497814f, 0.3996241998f, 0.9166790599f,
+  0.2161067971f, 0.9763697313f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9801821360f, 0.1980984107f, 0.9215140393f, 0.3883450467f,
+  0.8263210628f, 0.5631993440f, 0.6983762494f, 0.7157308253f,
+  0.5427507849f, 0.8398937942f, 0.3656129978f, 0.9307669611f,
+  0.1739838734f, 0.9847485018f, 0.9795697657f, 0.2011046348f,
+  0.9191138517f, 0.3939920401f, 0.8211025150f, 0.5707807459f,
+  0.6895405447f, 0.7242470830f, 0.5298036247f, 0.8481203448f,
+  0.3484186802f, 0.9373390119f, 0.1527971853f, 0.9882575677f,
+  0.9789481753f, 0.2041089661f, 0.9166790599f, 0.3996241998f,
+  0.8158144108f, 0.5783137964f, 0.6806009978f, 0.7326542717f,
+  0.5167317990f, 0.8561473284f, 0.3311063058f, 0.9435934582f,
+  0.1315400287f, 0.9913108598f, 0.9783173707f, 0.2071113762f,
+  0.9142097557f, 0.4052413140f, 0.8104571983f, 0.5857978575f,
+  0.6715589548f, 0.7409511254f, 0.5035383837f, 0.8639728561f,
+  0.3136817404f, 0.9495281806f, 0.1102222073f, 0.9939069700f,
+  0.9776773578f, 0.2101118369f, 0.9117060320f, 0.4108431711f,
+  0.8050313311f, 0.5932322950f, 0.6624157776f, 0.7491363945f,
+  0.4902264833f, 0.8715950867f, 0.2961508882f, 0.9551411683f,
+  0.0888535526f, 0.9960447009f, 0.9770281427f, 0.2131103199f,
+  0.9091679831f, 0.4164295601f, 0.7995372691f, 0.6006164794f,
+  0.6531728430f, 0.7572088465f, 0.4767992301f, 0.8790122264f,
+  0.2785196894f, 0.9604305194f, 0.0674439196f, 0.9977230666f,
+  0.9763697313f, 0.2161067971f, 0.9065957045f, 0.4220002708f,
+  0.7939754776f, 0.6079497850f, 0.6438315429f, 0.7651672656f,
+  0.4632597836f, 0.8862225301f, 0.2607941179f, 0.9653944417f,
+  0.0460031821f, 0.9989412932f, 0.9757021300f, 0.2191012402f,
+  0.9039892931f, 0.4275550934f, 0.7883464276f, 0.6152315906f,
+  0.6343932842f, 0.7730104534f, 0.4496113297f, 0.8932243012f,
+  0.2429801799f, 0.9700312532f, 0.0245412285f, 0.9996988187f,
+  0.9750253451f, 0.2220936210f, 0.9013488470f, 0.4330938189f,
+  0.7826505962f, 0.6224612794f, 0.6248594881f, 0.7807372286f,
+  0.4358570799f, 0.9000158920f, 0.2250839114f, 0.9743393828f,
+  0.0030679568f, 0.9999952938f, 0.9743393828f, 0.2250839114f,
+  0.8986744657f, 0.4386162385f, 0.7768884657f, 0.6296382389f,
+  0.6152315906f, 0.7883464276f, 0.4220002708f, 0.9065957045f,
+  0.2071113762f, 0.9783173707f, -0.0184067299f, 0.9998305818f,
+  0.9736442497f, 0.2280720832f, 0.8959662498f, 0.4441221446f,
+  0.7710605243f, 0.6367618612f, 0.6055110414f, 0.7958369046f,
+  0.4080441629f, 0.9129621904f, 0.1890686641f, 0.9819638691f,
+  -0.0398729276f, 0.9992047586f, 0.9729399522f, 0.2310581083f,
+  0.8932243012f, 0.4496113297f, 0.7651672656f, 0.6438315429f,
+  0.5956993045f, 0.8032075315f, 0.3939920401f, 0.9191138517f,
+  0.1709618888f, 0.9852776424f, -0.0613207363f, 0.9981181129f,
+  0.9722264971f, 0.2340419586f, 0.8904487232f, 0.4550835871f,
+  0.7592091890f, 0.6508466850f, 0.5857978575f, 0.8104571983f,
+  0.3798472089f, 0.9250492408f, 0.1527971853f, 0.9882575677f,
+  -0.0827402645f, 0.9965711458f, 0.9715038910f, 0.2370236060f,
+  0.8876396204f, 0.4605387110f, 0.7531867990f, 0.6578066933f,
+  0.5758081914f, 0.8175848132f, 0.3656129978f, 0.9307669611f,
+  0.1345807085f, 0.9909026354f, -0.1041216339f, 0.9945645707f,
+  0.9707721407f, 0.2400030224f, 0.8847970984f, 0.4659764958f,
+  0.7471006060f, 0.6647109782f, 0.5657318108f, 0.8245893028f,
+  0.3512927561f, 0.9362656672f, 0.1163186309f, 0.9932119492f,
+  -0.1254549834f, 0.9920993131f, 0.9700312532f, 0.2429801799f,
+  0.8819212643f, 0.4713967368f, 0.7409511254f, 0.6715589548f,
+  0.5555702330f, 0.8314696123f, 0.3368898534f, 0.9415440652f,
+  0.0980171403f, 0.9951847267f, -0.1467304745f, 0.9891765100f,
+  0.9692812354f, 0.2459550503f, 0.8790122264f, 0.4767992301f,
+  0.7347388781f, 0.6783500431f, 0.5453249884f, 0.8382247056f,
+  0.3224076788f, 0.9466009131f, 0.0796824380f, 0.9968202993f,
+  -0.1679382950f, 0.9857975092f, 0.9685220943f, 0.2489276057f,
+  0.8760700942f, 0.4821837721f, 0.7284643904f, 0.6850836678f,
+  0.5349976199f, 0.8448535652f, 0.3078496400f, 0.9514350210f,
+  0.0613207363f, 0.9981181129f, -0.1890686641f, 0.9819638691f,
+  0.9677538371f, 0.2518978182f, 0.8730949784f, 0.4875501601f,
+  0.7221281939f, 0.6917592584f, 0.5245896827f, 0.8513551931f,
+  0.2932191627f, 0.9560452513f, 0.0429382569f, 0.9990777278f,
+  -0.2101118369f, 0.9776773578f, 0.9669764710f, 0.2548656596f,
+  0.8700869911f, 0.4928981922f, 0.7157308253f, 0.6983762494f,
+  0.5141027442f, 0.8577286100f, 0.2785196894f, 0.9604305194f,
+  0.0245412285f, 0.9996988187f, -0.2310581083f, 0.9729399522f,
+  0.9661900034f, 0.2578311022f, 0.8670462455f, 0.4982276670f,
+  0.7092728264f, 0.7049340804f, 0.5035383837f, 0.8639728561f,
+  0.2637546790f, 0.9645897933f, 0.0061358846f, 0.9999811753f,
+  -0.2518978182f, 0.9677538371f, 0.9653944417f, 0.2607941179f,
+  0.8639728561f, 0.5035383837f, 0.7027547445f, 0.7114321957f,
+  0.4928981922f, 0.8700869911f, 0.2489276057f, 0.9685220943f,
+  -0.0122715383f, 0.9999247018f, -0.2726213554f, 0.9621214043f,
+  0.9645897933f, 0.2637546790f, 0.8608669386f, 0.5088301425f,
+  0.6961771315f, 0.7178700451f, 0.4821837721f, 0.8760700942f,
+  0.2340419586f, 0.9722264971f, -0.0306748032f, 0.9995294175f,
+  -0.2932191627f, 0.9560452513f, 0.9637760658f, 0.2667127575f,
+  0.8577286100f, 0.5141027442f, 0.6895405447f, 0.7242470830f,
+  0.4713967368f, 0.8819212643f, 0.2191012402f, 0.9757021300f,
+  -0.0490676743f, 0.9987954562f, -0.3136817404f, 0.9495281806f,
+  0.9629532669f, 0.2696683256f, 0.8545579884f, 0.5193559902f,
+  0.6828455464f, 0.7305627692f, 0.4605387110f, 0.8876396204f,
+  0.2041089661f, 0.9789481753f, -0.0674439196f, 0.9977230666f,
+  -0.3339996514f, 0.9425731976f, 0.9621214043f, 0.2726213554f,
+  0.8513551931f, 0.5245896827f, 0.6760927036f, 0.7368165689f,
+  0.4496113297f, 0.8932243012f, 0.1890686641f, 0.9819638691f,
+  -0.0857973123f, 0.9963126122f, -0.3541635254f, 0.9351835099f,
+  0.9612804858f, 0.2755718193f, 0.8481203448f, 0.5298036247f,
+  0.6692825883f, 0.7430079521f, 0.4386162385f, 0.8986744657f,
+  0.1739838734f, 0.9847485018f, -0.1041216339f, 0.9945645707f,
+  -0.3741640630f, 0.9273625257f, 0.9604305194f, 0.2785196894f,
+  0.8448535652f, 0.5349976199f, 0.6624157776f, 0.7491363945f,
+  0.4275550934f, 0.9039892931f, 0.1588581433f, 0.9873014182f,
+  -0.1224106752f, 0.9924795346f, -0.3939920401f, 0.9191138517f,
+  0.9595715131f, 0.2814649379f, 0.8415549774f, 0.5401714727f,
+  0.6554928530f, 0.7552013769f, 0.4164295601f, 0.9091679831f,
+  0.1436950332f, 0.9896220175f, -0.1406582393f, 0.9900582103f,
+  -0.4136383122f, 0.9104412923f, 0.9587034749f, 0.2844075372f,
+  0.8382247056f, 0.5453249884f, 0.6485144010f, 0.7612023855f,
+  0.4052413140f, 0.9142097557f, 0.1284981108f, 0.9917097537f,
+  -0.1588581433f, 0.9873014182f, -0.4330938189f, 0.9013488470f,
+  0.9578264130f, 0.2873474595f, 0.8348628750f, 0.5504579729f,
+  0.6414810128f, 0.7671389119f, 0.3939920401f, 0.9191138517f,
+  0.1132709522f, 0.9935641355f, -0.1770042204f, 0.9842100924f,
+  -0.4523495872f, 0.8918407094f, 0.9569403357f, 0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.6343932842f, 0.7730104534f,
+  0.3826834324f, 0.9238795325f, 0.0980171403f, 0.9951847267f,
+  -0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  0.9560452513f, 0.2932191627f, 0.8280450453f, 0.5606615762f,
+  0.6272518155f, 0.7788165124f, 0.3713171940f, 0.9285060805f,
+  0.0827402645f, 0.9965711458f, -0.2131103199f, 0.9770281427f,
+  -0.4902264833f, 0.8715950867f, 0.9551411683f, 0.2961508882f,
+  0.8245893028f, 0.5657318108f, 0.6200572118f, 0.7845565972f,
+  0.3598950365f, 0.9329927988f, 0.0674439196f, 0.9977230666f,
+  -0.2310581083f, 0.9729399522f, -0.5088301425f, 0.8608669386f,
+  0.9542280951f, 0.2990798263f, 0.8211025150f, 0.5707807459f,
+  0.6128100824f, 0.7902302214f, 0.3484186802f, 0.9373390119f,
+  0.0521317047f, 0.9986402182f, -0.2489276057f, 0.9685220943f,
+  -0.5271991348f, 0.8497417680f, 0.9533060404f, 0.3020059493f,
+  0.8175848132f, 0.5758081914f, 0.6055110414f, 0.7958369046f,
+  0.3368898534f, 0.9415440652f, 0.0368072229f, 0.9993223846f,
+  -0.2667127575f, 0.9637760658f, -0.5453249884f, 0.8382247056f,
+  0.9523750127f, 0.3049292297f, 0.8140363297f, 0.5808139581f,
+  0.5981607070f, 0.8013761717f, 0.3253102922f, 0.9456073254f,
+  0.0214740803f, 0.9997694054f, -0.2844075372f, 0.9587034749f,
+  -0.5631993440f, 0.8263210628f, 0.9514350210f, 0.3078496400f,
+  0.8104571983f, 0.5857978575f, 0.5907597019f, 0.8068475535f,
+  0.3136817404f, 0.9495281806f, 0.0061358846f, 0.9999811753f,
+  -0.3020059493f, 0.9533060404f, -0.5808139581f, 0.8140363297f,
+  0.9504860739f, 0.3107671527f, 0.8068475535f, 0.5907597019f,
+  0.5833086529f, 0.8122505866f, 0.3020059493f, 0.9533060404f,
+  -0.0092037548f, 0.9999576446f, -0.3195020308f, 0.9475855910f,
+  -0.5981607070f, 0.8013761717f, 0.9495281806f, 0.3136817404f,
+  0.8032075315f, 0.5956993045f, 0.5758081914f, 0.8175848132f,
+  0.2902846773f, 0.9569403357f, -0.0245412285f, 0.9996988187f,
+  -0.3368898534f, 0.9415440652f, -0.6152315906f, 0.7883464276f,
+  0.9485613499f, 0.3165933756f, 0.7995372691f, 0.6006164794f,
+  0.5682589527f, 0.8228497814f, 0.2785196894f, 0.9604305194f,
+  -0.0398729276f, 0.9992047586f, -0.3541635254f, 0.9351835099f,
+  -0.6320187359f, 0.7749531066f, 0.9475855910f, 0.3195020308f,
+  0.7958369046f, 0.6055110414f, 0.5606615762f, 0.8280450453f,
+  0.2667127575f, 0.9637760658f, -0.0551952443f, 0.9984755806f,
+  -0.3713171940f, 0.9285060805f, -0.6485144010f, 0.7612023855f,
+  0.9466009131f, 0.3224076788f, 0.7921065773f, 0.6103828063f,
+  0.5530167056f, 0.8331701647f, 0.2548656596f, 0.9669764710f,
+  -0.0705045734f, 0.9975114561f, -0.3883450467f, 0.9215140393f,
+  -0.6647109782f, 0.7471006060f, 0.9456073254f, 0.3253102922f,
+  0.7883464276f, 0.6152315906f, 0.5453249884f, 0.8382247056f,
+  0.2429801799f, 0.9700312532f, -0.0857973123f, 0.9963126122f,
+  -0.4052413140f, 0.9142097557f, -0.6806009978f, 0.7326542717f,
+  0.9446048373f, 0.3282098436f, 0.7845565972f, 0.6200572118f,
+  0.5375870763f, 0.8432082396f, 0.2310581083f, 0.9729399522f,
+  -0.1010698628f, 0.9948793308f, -0.4220002708f, 0.9065957045f,
+  -0.6961771315f, 0.7178700451f, 0.9435934582f, 0.3311063058f,
+  0.7807372286f, 0.6248594881f, 0.5298036247f, 0.8481203448f,
+  0.2191012402f, 0.9757021300f, -0.1163186309f, 0.9932119492f,
+  -0.4386162385f, 0.8986744657f, -0.7114321957f, 0.7027547445f,
+  0.9425731976f, 0.3339996514f, 0.7768884657f, 0.6296382389f,
+  0.5219752929f, 0.8529606049f, 0.2071113762f, 0.9783173707f,
+  -0.1315400287f, 0.9913108598f, -0.4550835871f, 0.8904487232f,
+  -0.7263591551f, 0.6873153409f, 0.9415440652f, 0.3368898534f,
+  0.7730104534f, 0.6343932842f, 0.5141027442f, 0.8577286100f,
+  0.1950903220f, 0.9807852804f, -0.1467304745f, 0.9891765100f,
+  -0.4713967368f, 0.8819212643f, -0.7409511254f, 0.6715589548f,
+  0.9405060706f, 0.3397768844f, 0.7691033376f, 0.6391244449f,
+  0.5061866453f, 0.8624239561f, 0.1830398880f, 0.9831054874f,
+  -0.1618863938f, 0.9868094018f, -0.4875501601f, 0.8730949784f,
+  -0.7552013769f, 0.6554928530f, 0.9394592236f, 0.3426607173f,
+  0.7651672656f, 0.6438315429f, 0.4982276670f, 0.8670462455f,
+  0.1709618888f, 0.9852776424f, -0.1770042204f, 0.9842100924f,
+  -0.5035383837f, 0.8639728561f, -0.7691033376f, 0.6391244449f,
+  0.9384035341f, 0.3455413250f, 0.7612023855f, 0.6485144010f,
+  0.4902264833f, 0.8715950867f, 0.1588581433f, 0.9873014182f,
+  -0.1920803970f, 0.9813791933f, -0.5193559902f, 0.8545579884f,
+  -0.7826505962f, 0.6224612794f, 0.9373390119f, 0.3484186802f,
+  0.7572088465f, 0.6531728430f, 0.4821837721f, 0.8760700942f,
+  0.1467304745f, 0.9891765100f, -0.2071113762f, 0.9783173707f,
+  -0.5349976199f, 0.8448535652f, -0.7958369046f, 0.6055110414f,
+  0.9362656672f, 0.3512927561f, 0.7531867990f, 0.6578066933f,
+  0.4741002147f, 0.8804708891f, 0.1345807085f, 0.9909026354f,
+  -0.2220936210f, 0.9750253451f, -0.5504579729f, 0.8348628750f,
+  -0.8086561816f, 0.5882815482f, 0.9351835099f, 0.3541635254f,
+  0.7491363945f, 0.6624157776f, 0.4659764958f, 0.8847970984f,
+  0.1224106752f, 0.9924795346f, -0.2370236060f, 0.9715038910f,
+  -0.5657318108f, 0.8245893028f, -0.8211025150f, 0.5707807459f,
+  0.9340925504f, 0.3570309612f, 0.7450577854f, 0.6669999223f,
+  0.4578133036f, 0.8890483559f, 0.1102222073f, 0.9939069700f,
+  -0.2518978182f, 0.9677538371f, -0.5808139581f, 0.8140363297f,
+  -0.8331701647f, 0.5530167056f, 0.9329927988f, 0.3598950365f,
+  0.7409511254f, 0.6715589548f, 0.4496113297f, 0.8932243012f,
+  0.0980171403f, 0.9951847267f, -0.2667127575f, 0.9637760658f,
+  -0.5956993045f, 0.8032075315f, -0.8448535652f, 0.5349976199f,
+  0.9318842656f, 0.3627557244f, 0.7368165689f, 0.6760927036f,
+  0.4413712687f, 0.8973245807f, 0.0857973123f, 0.9963126122f,
+  -0.2814649379f, 0.9595715131f, -0.6103828063f, 0.7921065773f,
+  -0.8561473284f, 0.5167317990f, 0.9307669611f, 0.3656129978f,
+  0.7326542717f, 0.6806009978f, 0.4330938189f, 0.9013488470f,
+  0.0735645636f, 0.9972904567f, -0.2961508882f, 0.9551411683f,
+  -0.6248594881f, 0.7807372286f, -0.8670462455f, 0.4982276670f,
+  0.9296408958f, 0.3684668300f, 0.7284643904f, 0.6850836678f,
+  0.4247796812f, 0.9052967593f, 0.0613207363f, 0.9981181129f,
+  -0.3107671527f, 0.9504860739f, -0.6391244449f, 0.7691033376f,
+  -0.8775452902f, 0.4794937577f, 0.9285060805f, 0.3713171940f,
+  0.7242470830f, 0.6895405447f, 0.4164295601f, 0.9091679831f,
+  0.0490676743f, 0.9987954562f, -0.3253102922f, 0.9456073254f,
+  -0.6531728430f, 0.7572088465f, -0.8876396204f, 0.4605387110f,
+  0.9273625257f, 0.3741640630f, 0.7200025080f, 0.6939714609f,
+  0.4080441629f, 0.9129621904f, 0.0368072229f, 0.9993223846f,
+  -0.3397768844f, 0.9405060706f, -0.6669999223f, 0.7450577854f,
+  -0.8973245807f, 0.4413712687f, 0.9262102421f, 0.3770074102f,
+  0.7157308253f, 0.6983762494f, 0.3996241998f, 0.9166790599f,
+  0.0245412285f, 0.9996988187f, -0.3541635254f, 0.9351835099f,
+  -0.6806009978f, 0.7326542717f, -0.9065957045f, 0.4220002708f,
+  0.9250492408f, 0.3798472089f, 0.7114321957f, 0.7027547445f,
+  0.3911703843f, 0.9203182767f, 0.0122715383f, 0.9999247018f,
+  -0.3684668300f, 0.9296408958f, -0.6939714609f, 0.7200025080f,
+  -0.9154487161f, 0.4024346509f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.9227011283f, 0.3855160538f, 0.7027547445f, 0.7114321957f,
+  0.3741640630f, 0.9273625257f, -0.0122715383f, 0.9999247018f,
+  -0.3968099874f, 0.9179007756f, -0.7200025080f, 0.6939714609f,
+  -0.9318842656f, 0.3627557244f, 0.9215140393f, 0.3883450467f,
+  0.6983762494f, 0.7157308253f, 0.3656129978f, 0.9307669611f,
+  -0.0245412285f, 0.9996988187f, -0.4108431711f, 0.9117060320f,
+  -0.7326542717f, 0.6806009978f, -0.9394592236f, 0.3426607173f,
+  0.9203182767f, 0.3911703843f, 0.6939714609f, 0.7200025080f,
+  0.3570309612f, 0.9340925504f, -0.0368072229f, 0.9993223846f,
+  -0.4247796812f, 0.9052967593f, -0.7450577854f, 0.6669999223f,
+  -0.9466009131f, 0.3224076788f, 0.9191138517f, 0.3939920401f,
+  0.6895405447f, 0.7242470830f, 0.3484186802f, 0.9373390119f,
+  -0.0490676743f, 0.9987954562f, -0.4386162385f, 0.8986744657f,
+  -0.7572088465f, 0.6531728430f, -0.9533060404f, 0.3020059493f,
+  0.9179007756f, 0.3968099874f, 0.6850836678f, 0.7284643904f,
+  0.3397768844f, 0.9405060706f, -0.0613207363f, 0.9981181129f,
+  -0.4523495872f, 0.8918407094f, -0.7691033376f, 0.6391244449f,
+  -0.9595715131f, 0.2814649379f, 0.9166790599f, 0.3996241998f,
+  0.6806009978f, 0.7326542717f, 0.3311063058f, 0.9435934582f,
+  -0.0735645636f, 0.9972904567f, -0.4659764958f, 0.8847970984f,
+  -0.7807372286f, 0.6248594881f, -0.9653944417f, 0.2607941179f,
+  0.9154487161f, 0.4024346509f, 0.6760927036f, 0.7368165689f,
+  0.3224076788f, 0.9466009131f, -0.0857973123f, 0.9963126122f,
+  -0.4794937577f, 0.8775452902f, -0.7921065773f, 0.6103828063f,
+  -0.9707721407f, 0.2400030224f, 0.9142097557f, 0.4052413140f,
+  0.6715589548f, 0.7409511254f, 0.3136817404f, 0.9495281806f,
+  -0.0980171403f, 0.9951847267f, -0.4928981922f, 0.8700869911f,
+  -0.8032075315f, 0.5956993045f, -0.9757021300f, 0.2191012402f,
+  0.9129621904f, 0.4080441629f, 0.6669999223f, 0.7450577854f,
+  0.3049292297f, 0.9523750127f, -0.1102222073f, 0.9939069700f,
+  -0.5061866453f, 0.8624239561f, -0.8140363297f, 0.5808139581f,
+  -0.9801821360f, 0.1980984107f, 0.9117060320f, 0.4108431711f,
+  0.6624157776f, 0.7491363945f, 0.2961508882f, 0.9551411683f,
+  -0.1224106752f, 0.9924795346f, -0.5193559902f, 0.8545579884f,
+  -0.8245893028f, 0.5657318108f, -0.9842100924f, 0.1770042204f,
+  0.9104412923f, 0.4136383122f, 0.6578066933f, 0.7531867990f,
+  0.2873474595f, 0.9578264130f, -0.1345807085f, 0.9909026354f,
+  -0.5324031279f, 0.8464909388f, -0.8348628750f, 0.5504579729f,
+  -0.9877841416f, 0.1558283977f, 0.9091679831f, 0.4164295601f,
+  0.6531728430f, 0.7572088465f, 0.2785196894f, 0.9604305194f,
+  -0.1467304745f, 0.9891765100f, -0.5453249884f, 0.8382247056f,
+  -0.8448535652f, 0.5349976199f, -0.9909026354f, 0.1345807085f,
+  0.9078861165f, 0.4192168884f, 0.6485144010f, 0.7612023855f,
+  0.2696683256f, 0.9629532669f, -0.1588581433f, 0.9873014182f,
+  -0.5581185312f, 0.8297612338f, -0.8545579884f, 0.5193559902f,
+  -0.9935641355f, 0.1132709522f, 0.9065957045f, 0.4220002708f,
+  0.6438315429f, 0.7651672656f, 0.2607941179f, 0.9653944417f,
+  -0.1709618888f, 0.9852776424f, -0.5707807459f, 0.8211025150f,
+  -0.8639728561f, 0.5035383837f, -0.9957674145f, 0.0919089565f,
+  0.9052967593f, 0.4247796812f, 0.6391244449f, 0.7691033376f,
+  0.2518978182f, 0.9677538371f, -0.1830398880f, 0.9831054874f,
+  -0.5833086529f, 0.8122505866f, -0.8730949784f, 0.4875501601f,
+  -0.9975114561f, 0.0705045734f, 0.9039892931f, 0.4275550934f,
+  0.6343932842f, 0.7730104534f, 0.2429801799f, 0.9700312532f,
+  -0.1950903220f, 0.9807852804f, -0.5956993045f, 0.8032075315f,
+  -0.8819212643f, 0.4713967368f, -0.9987954562f, 0.0490676743f,
+  0.9026733182f, 0.4303264813f, 0.6296382389f, 0.7768884657f,
+  0.2340419586f, 0.9722264971f, -0.2071113762f, 0.9783173707f,
+  -0.6079497850f, 0.7939754776f, -0.8904487232f, 0.4550835871f,
+  -0.9996188225f, 0.0276081458f, 0.9013488470f, 0.4330938189f,
+  0.6248594881f, 0.7807372286f, 0.2250839114f, 0.9743393828f,
+  -0.2191012402f, 0.9757021300f, -0.6200572118f, 0.7845565972f,
+  -0.8986744657f, 0.4386162385f, -0.9999811753f, 0.0061358846f,
+  0.9000158920f, 0.4358570799f, 0.6200572118f, 0.7845565972f,
+  0.2161067971f, 0.9763697313f, -0.2310581083f, 0.9729399522f,
+  -0.6320187359f, 0.7749531066f, -0.9065957045f, 0.4220002708f,
+  -0.9998823475f, -0.0153392063f, 0.8986744657f, 0.4386162385f,
+  0.6152315906f, 0.7883464276f, 0.2071113762f, 0.9783173707f,
+  -0.2429801799f, 0.9700312532f, -0.6438315429f, 0.7651672656f,
+  -0.9142097557f, 0.4052413140f, -0.9993223846f, -0.0368072229f,
+  0.8973245807f, 0.4413712687f, 0.6103828063f, 0.7921065773f,
+  0.1980984107f, 0.9801821360f, -0.2548656596f, 0.9669764710f,
+  -0.6554928530f, 0.7552013769f, -0.9215140393f, 0.3883450467f,
+  -0.9983015449f, -0.0582582645f, 0.8959662498f, 0.4441221446f,
+  0.6055110414f, 0.7958369046f, 0.1890686641f, 0.9819638691f,
+  -0.2667127575f, 0.9637760658f, -0.6669999223f, 0.7450577854f,
+  -0.9285060805f, 0.3713171940f, -0.9968202993f, -0.0796824380f,
+  0.8945994856f, 0.4468688402f, 0.6006164794f, 0.7995372691f,
+  0.1800229014f, 0.9836624192f, -0.2785196894f, 0.9604305194f,
+  -0.6783500431f, 0.7347388781f, -0.9351835099f, 0.3541635254f,
+  -0.9948793308f, -0.1010698628f, 0.8932243012f, 0.4496113297f,
+  0.5956993045f, 0.8032075315f, 0.1709618888f, 0.9852776424f,
+  -0.2902846773f, 0.9569403357f, -0.6895405447f, 0.7242470830f,
+  -0.9415440652f, 0.3368898534f, -0.9924795346f, -0.1224106752f,
+  0.8918407094f, 0.4523495872f, 0.5907597019f, 0.8068475535f,
+  0.1618863938f, 0.9868094018f, -0.3020059493f, 0.9533060404f,
+  -0.7005687939f, 0.7135848688f, -0.9475855910f, 0.3195020308f,
+  -0.9896220175f, -0.1436950332f, 0.8904487232f, 0.4550835871f,
+  0.5857978575f, 0.8104571983f, 0.1527971853f, 0.9882575677f,
+  -0.3136817404f, 0.9495281806f, -0.7114321957f, 0.7027547445f,
+  -0.9533060404f, 0.3020059493f, -0.9863080972f, -0.1649131205f,
+  0.8890483559f, 0.4578133036f, 0.5808139581f, 0.8140363297f,
+  0.1436950332f, 0.9896220175f, -0.3253102922f, 0.9456073254f,
+  -0.7221281939f, 0.6917592584f, -0.9587034749f, 0.2844075372f,
+  -0.9825393023f, -0.1860551517f, 0.8876396204f, 0.4605387110f,
+  0.5758081914f, 0.8175848132f, 0.1345807085f, 0.9909026354f,
+  -0.3368898534f, 0.9415440652f, -0.7326542717f, 0.6806009978f,
+  -0.9637760658f, 0.2667127575f, -0.9783173707f, -0.2071113762f,
+  0.8862225301f, 0.4632597836f, 0.5707807459f, 0.8211025150f,
+  0.1254549834f, 0.9920993131f, -0.3484186802f, 0.9373390119f,
+  -0.7430079521f, 0.6692825883f, -0.9685220943f, 0.2489276057f,
+  -0.9736442497f, -0.2280720832f, 0.8847970984f, 0.4659764958f,
+  0.5657318108f, 0.8245893028f, 0.1163186309f, 0.9932119492f,
+  -0.3598950365f, 0.9329927988f, -0.7531867990f, 0.6578066933f,
+  -0.9729399522f, 0.2310581083f, -0.9685220943f, -0.2489276057f,
+  0.8833633387f, 0.4686888220f, 0.5606615762f, 0.8280450453f,
+  0.1071724250f, 0.9942404495f, -0.3713171940f, 0.9285060805f,
+  -0.7631884173f, 0.6461760130f, -0.9770281427f, 0.2131103199f,
+  -0.9629532669f, -0.2696683256f, 0.8819212643f, 0.4713967368f,
+  0.5555702330f, 0.8314696123f, 0.0980171403f, 0.9951847267f,
+  -0.3826834324f, 0.9238795325f, -0.7730104534f, 0.6343932842f,
+  -0.9807852804f, 0.1950903220f, -0.9569403357f, -0.2902846773f,
+  0.8804708891f, 0.4741002147f, 0.5504579729f, 0.8348628750f,
+  0.0888535526f, 0.9960447009f, -0.3939920401f, 0.9191138517f,
+  -0.7826505962f, 0.6224612794f, -0.9842100924f, 0.1770042204f,
+  -0.9504860739f, -0.3107671527f, 0.8790122264f, 0.4767992301f,
+  0.5453249884f, 0.8382247056f, 0.0796824380f, 0.9968202993f,
+  -0.4052413140f, 0.9142097557f, -0.7921065773f, 0.6103828063f,
+  -0.9873014182f, 0.1588581433f, -0.9435934582f, -0.3311063058f,
+  0.8775452902f, 0.4794937577f, 0.5401714727f, 0.8415549774f,
+  0.0705045734f, 0.9975114561f, -0.4164295601f, 0.9091679831f,
+  -0.8013761717f, 0.5981607070f, -0.9900582103f, 0.1406582393f,
+  -0.9362656672f, -0.3512927561f, 0.8760700942f, 0.4821837721f,
+  0.5349976199f, 0.8448535652f, 0.0613207363f, 0.9981181129f,
+  -0.4275550934f, 0.9039892931f, -0.8104571983f, 0.5857978575f,
+  -0.9924795346f, 0.1224106752f, -0.9285060805f, -0.3713171940f,
+  0.8745866523f, 0.4848692480f, 0.5298036247f, 0.8481203448f,
+  0.0521317047f, 0.9986402182f, -0.4386162385f, 0.8986744657f,
+  -0.8193475201f, 0.5732971667f, -0.9945645707f, 0.1041216339f,
+  -0.9203182767f, -0.3911703843f, 0.8730949784f, 0.4875501601f,
+  0.5245896827f, 0.8513551931f, 0.0429382569f, 0.9990777278f,
+  -0.4496113297f, 0.8932243012f, -0.8280450453f, 0.5606615762f,
+  -0.9963126122f, 0.0857973123f, -0.9117060320f, -0.4108431711f,
+  0.8715950867f, 0.4902264833f, 0.5193559902f, 0.8545579884f,
+  0.0337411719f, 0.9994306046f, -0.4605387110f, 0.8876396204f,
+  -0.8365477272f, 0.5478940592f, -0.9977230666f, 0.0674439196f,
+  -0.9026733182f, -0.4303264813f, 0.8700869911f, 0.4928981922f,
+  0.5141027442f, 0.8577286100f, 0.0245412285f, 0.9996988187f,
+  -0.4713967368f, 0.8819212643f, -0.8448535652f, 0.5349976199f,
+  -0.9987954562f, 0.0490676743f, -0.8932243012f, -0.4496113297f,
+  0.8685707060f, 0.4955652618f, 0.5088301425f, 0.8608669386f,
+  0.0153392063f, 0.9998823475f, -0.4821837721f, 0.8760700942f,
+  -0.8529606049f, 0.5219752929f, -0.9995294175f, 0.0306748032f,
+  -0.8833633387f, -0.4686888220f, 0.8670462455f, 0.4982276670f,
+  0.5035383837f, 0.8639728561f, 0.0061358846f, 0.9999811753f,
+  -0.4928981922f, 0.8700869911f, -0.8608669386f, 0.5088301425f,
+  -0.9999247018f, 0.0122715383f, -0.8730949784f, -0.4875501601f,
+  0.8655136241f, 0.5008853826f, 0.4982276670f, 0.8670462455f,
+  -0.0030679568f, 0.9999952938f, -0.5035383837f, 0.8639728561f,
+  -0.8685707060f, 0.4955652618f, -0.9999811753f, -0.0061358846f,
+  -0.8624239561f, -0.5061866453f, 0.8639728561f, 0.5035383837f,
+  0.4928981922f, 0.8700869911f, -0.0122715383f, 0.9999247018f,
+  -0.5141027442f, 0.8577286100f, -0.8760700942f, 0.4821837721f,
+  -0.9996988187f, -0.0245412285f, -0.8513551931f, -0.5245896827f,
+  0.8624239561f, 0.5061866453f, 0.4875501601f, 0.8730949784f,
+  -0.0214740803f, 0.9997694054f, -0.5245896827f, 0.8513551931f,
+  -0.8833633387f, 0.4686888220f, -0.9990777278f, -0.0429382569f,
+  -0.8398937942f, -0.5427507849f, 0.8608669386f, 0.5088301425f,
+  0.4821837721f, 0.8760700942f, -0.0306748032f, 0.9995294175f,
+  -0.5349976199f, 0.8448535652f, -0.8904487232f, 0.4550835871f,
+  -0.9981181129f, -0.0613207363f, -0.8280450453f, -0.5606615762f,
+  0.8593018184f, 0.5114688504f, 0.4767992301f, 0.8790122264f,
+  -0.0398729276f, 0.9992047586f, -0.5453249884f, 0.8382247056f,
+  -0.8973245807f, 0.4413712687f, -0.9968202993f, -0.0796824380f,
+  -0.8158144108f, -0.5783137964f, 0.8577286100f, 0.5141027442f,
+  0.4713967368f, 0.8819212643f, -0.0490676743f, 0.9987954562f,
+  -0.5555702330f, 0.8314696123f, -0.9039892931f, 0.4275550934f,
+  -0.9951847267f, -0.0980171403f, -0.8032075315f, -0.5956993045f,
+  0.8561473284f, 0.5167317990f, 0.4659764958f, 0.8847970984f,
+  -0.0582582645f, 0.9983015449f, -0.5657318108f, 0.8245893028f,
+  -0.9104412923f, 0.4136383122f, -0.9932119492f, -0.1163186309f,
+  -0.7902302214f, -0.6128100824f, 0.8545579884f, 0.5193559902f,
+  0.4605387110f, 0.8876396204f, -0.0674439196f, 0.9977230666f,
+  -0.5758081914f, 0.8175848132f, -0.9166790599f, 0.3996241998f,
+  -0.9909026354f, -0.1345807085f, -0.7768884657f, -0.6296382389f,
+  0.8529606049f, 0.5219752929f, 0.4550835871f, 0.8904487232f,
+  -0.0766238614f, 0.9970600703f, -0.5857978575f, 0.8104571983f,
+  -0.9227011283f, 0.3855160538f, -0.9882575677f, -0.1527971853f,
+  -0.7631884173f, -0.6461760130f, 0.8513551931f, 0.5245896827f,
+  0.4496113297f, 0.8932243012f, -0.0857973123f, 0.9963126122f,
+  -0.5956993045f, 0.8032075315f, -0.9285060805f, 0.3713171940f,
+  -0.9852776424f, -0.1709618888f, -0.7491363945f, -0.6624157776f,
+  0.8497417680f, 0.5271991348f, 0.4441221446f, 0.8959662498f,
+  -0.0949634953f, 0.9954807555f, -0.6055110414f, 0.7958369046f,
+  -0.9340925504f, 0.3570309612f, -0.9819638691f, -0.1890686641f,
+  -0.7347388781f, -0.6783500431f, 0.8481203448f, 0.5298036247f,
+  0.4386162385f, 0.8986744657f, -0.1041216339f, 0.9945645707f,
+  -0.6152315906f, 0.7883464276f, -0.9394592236f, 0.3426607173f,
+  -0.9783173707f, -0.2071113762f, -0.7200025080f, -0.6939714609f,
+  0.8464909388f, 0.5324031279f, 0.4330938189f, 0.9013488470f,
+  -0.1132709522f, 0.9935641355f, -0.6248594881f, 0.7807372286f,
+  -0.9446048373f, 0.3282098436f, -0.9743393828f, -0.2250839114f,
+  -0.7049340804f, -0.7092728264f, 0.8448535652f, 0.5349976199f,
+  0.4275550934f, 0.9039892931f, -0.1224106752f, 0.9924795346f,
+  -0.6343932842f, 0.7730104534f, -0.9495281806f, 0.3136817404f,
+  -0.9700312532f, -0.2429801799f, -0.6895405447f, -0.7242470830f,
+  0.8432082396f, 0.5375870763f, 0.4220002708f, 0.9065957045f,
+  -0.1315400287f, 0.9913108598f, -0.6438315429f, 0.7651672656f,
+  -0.9542280951f, 0.2990798263f, -0.9653944417f, -0.2607941179f,
+  -0.6738290004f, -0.7388873245f, 0.8415549774f, 0.5401714727f,
+  0.4164295601f, 0.9091679831f, -0.1406582393f, 0.9900582103f,
+  -0.6531728430f, 0.7572088465f, -0.9587034749f, 0.2844075372f,
+  -0.9604305194f, -0.2785196894f, -0.6578066933f, -0.7531867990f,
+  0.8398937942f, 0.5427507849f, 0.4108431711f, 0.9117060320f,
+  -0.1497645347f, 0.9887216920f, -0.6624157776f, 0.7491363945f,
+  -0.9629532669f, 0.2696683256f, -0.9551411683f, -0.2961508882f,
+  -0.6414810128f, -0.7671389119f, 0.8382247056f, 0.5453249884f,
+  0.4052413140f, 0.9142097557f, -0.1588581433f, 0.9873014182f,
+  -0.6715589548f, 0.7409511254f, -0.9669764710f, 0.2548656596f,
+  -0.9495281806f, -0.3136817404f, -0.6248594881f, -0.7807372286f,
+  0.8365477272f, 0.5478940592f, 0.3996241998f, 0.9166790599f,
+  -0.1679382950f, 0.9857975092f, -0.6806009978f, 0.7326542717f,
+  -0.9707721407f, 0.2400030224f, -0.9435934582f, -0.3311063058f,
+  -0.6079497850f, -0.7939754776f, 0.8348628750f, 0.5504579729f,
+  0.3939920401f, 0.9191138517f, -0.1770042204f, 0.9842100924f,
+  -0.6895405447f, 0.7242470830f, -0.9743393828f, 0.2250839114f,
+  -0.9373390119f, -0.3484186802f, -0.5907597019f, -0.8068475535f,
+  0.8331701647f, 0.5530167056f, 0.3883450467f, 0.9215140393f,
+  -0.1860551517f, 0.9825393023f, -0.6983762494f, 0.7157308253f,
+  -0.9776773578f, 0.2101118369f, -0.9307669611f, -0.3656129978f,
+  -0.5732971667f, -0.8193475201f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.8297612338f, 0.5581185312f, 0.3770074102f, 0.9262102421f,
+  -0.2041089661f, 0.9789481753f, -0.7157308253f, 0.6983762494f,
+  -0.9836624192f, 0.1800229014f, -0.9166790599f, -0.3996241998f,
+  -0.5375870763f, -0.8432082396f, 0.8280450453f, 0.5606615762f,
+  0.3713171940f, 0.9285060805f, -0.2131103199f, 0.9770281427f,
+  -0.7242470830f, 0.6895405447f, -0.9863080972f, 0.1649131205f,
+  -0.9091679831f, -0.4164295601f, -0.5193559902f, -0.8545579884f,
+  0.8263210628f, 0.5631993440f, 0.3656129978f, 0.9307669611f,
+  -0.2220936210f, 0.9750253451f, -0.7326542717f, 0.6806009978f,
+  -0.9887216920f, 0.1497645347f, -0.9013488470f, -0.4330938189f,
+  -0.5008853826f, -0.8655136241f, 0.8245893028f, 0.5657318108f,
+  0.3598950365f, 0.9329927988f, -0.2310581083f, 0.9729399522f,
+  -0.7409511254f, 0.6715589548f, -0.9909026354f, 0.1345807085f,
+  -0.8932243012f, -0.4496113297f, -0.4821837721f, -0.8760700942f,
+  0.8228497814f, 0.5682589527f, 0.3541635254f, 0.9351835099f,
+  -0.2400030224f, 0.9707721407f, -0.7491363945f, 0.6624157776f,
+  -0.9928504145f, 0.1193652148f, -0.8847970984f, -0.4659764958f,
+  -0.4632597836f, -0.8862225301f, 0.8211025150f, 0.5707807459f,
+  0.3484186802f, 0.9373390119f, -0.2489276057f, 0.9685220943f,
+  -0.7572088465f, 0.6531728430f, -0.9945645707f, 0.1041216339f,
+  -0.8760700942f, -0.4821837721f, -0.4441221446f, -0.8959662498f,
+  0.8193475201f, 0.5732971667f, 0.3426607173f, 0.9394592236f,
+  -0.2578311022f, 0.9661900034f, -0.7651672656f, 0.6438315429f,
+  -0.9960447009f, 0.0888535526f, -0.8670462455f, -0.4982276670f,
+  -0.4247796812f, -0.9052967593f, 0.8175848132f, 0.5758081914f,
+  0.3368898534f, 0.9415440652f, -0.2667127575f, 0.9637760658f,
+  -0.7730104534f, 0.6343932842f, -0.9972904567f, 0.0735645636f,
+  -0.8577286100f, -0.5141027442f, -0.4052413140f, -0.9142097557f,
+  0.8158144108f, 0.5783137964f, 0.3311063058f, 0.9435934582f,
+  -0.2755718193f, 0.9612804858f, -0.7807372286f, 0.6248594881f,
+  -0.9983015449f, 0.0582582645f, -0.8481203448f, -0.5298036247f,
+  -0.3855160538f, -0.9227011283f, 0.8140363297f, 0.5808139581f,
+  0.3253102922f, 0.9456073254f, -0.2844075372f, 0.9587034749f,
+  -0.7883464276f, 0.6152315906f, -0.9990777278f, 0.0429382569f,
+  -0.8382247056f, -0.5453249884f, -0.3656129978f, -0.9307669611f,
+  0.8122505866f, 0.5833086529f, 0.3195020308f, 0.9475855910f,
+  -0.2932191627f, 0.9560452513f, -0.7958369046f, 0.6055110414f,
+  -0.9996188225f, 0.0276081458f, -0.8280450453f, -0.5606615762f,
+  -0.3455413250f, -0.9384035341f, 0.8104571983f, 0.5857978575f,
+  0.3136817404f, 0.9495281806f, -0.3020059493f, 0.9533060404f,
+  -0.8032075315f, 0.5956993045f, -0.9999247018f, 0.0122715383f,
+  -0.8175848132f, -0.5758081914f, -0.3253102922f, -0.9456073254f,
+  0.8086561816f, 0.5882815482f, 0.3078496400f, 0.9514350210f,
+  -0.3107671527f, 0.9504860739f, -0.8104571983f, 0.5857978575f,
+  -0.9999952938f, -0.0030679568f, -0.8068475535f, -0.5907597019f,
+  -0.3049292297f, -0.9523750127f, 0.8068475535f, 0.5907597019f,
+  0.3020059493f, 0.9533060404f, -0.3195020308f, 0.9475855910f,
+  -0.8175848132f, 0.5758081914f, -0.9998305818f, -0.0184067299f,
+  -0.7958369046f, -0.6055110414f, -0.2844075372f, -0.9587034749f,
+  0.8050313311f, 0.5932322950f, 0.2961508882f, 0.9551411683f,
+  -0.3282098436f, 0.9446048373f, -0.8245893028f, 0.5657318108f,
+  -0.9994306046f, -0.0337411719f, -0.7845565972f, -0.6200572118f,
+  -0.2637546790f, -0.9645897933f, 0.8032075315f, 0.5956993045f,
+  0.2902846773f, 0.9569403357f, -0.3368898534f, 0.9415440652f,
+  -0.8314696123f, 0.5555702330f, -0.9987954562f, -0.0490676743f,
+  -0.7730104534f, -0.6343932842f, -0.2429801799f, -0.9700312532f,
+  0.8013761717f, 0.5981607070f, 0.2844075372f, 0.9587034749f,
+  -0.3455413250f, 0.9384035341f, -0.8382247056f, 0.5453249884f,
+  -0.9979252862f, -0.0643826309f, -0.7612023855f, -0.6485144010f,
+  -0.2220936210f, -0.9750253451f, 0.7995372691f, 0.6006164794f,
+  0.2785196894f, 0.9604305194f, -0.3541635254f, 0.9351835099f,
+  -0.8448535652f, 0.5349976199f, -0.9968202993f, -0.0796824380f,
+  -0.7491363945f, -0.6624157776f, -0.2011046348f, -0.9795697657f,
+  0.7976908409f, 0.6030665985f, 0.2726213554f, 0.9621214043f,
+  -0.3627557244f, 0.9318842656f, -0.8513551931f, 0.5245896827f,
+  -0.9954807555f, -0.0949634953f, -0.7368165689f, -0.6760927036f,
+  -0.1800229014f, -0.9836624192f, 0.7958369046f, 0.6055110414f,
+  0.2667127575f, 0.9637760658f, -0.3713171940f, 0.9285060805f,
+  -0.8577286100f, 0.5141027442f, -0.9939069700f, -0.1102222073f,
+  -0.7242470830f, -0.6895405447f, -0.1588581433f, -0.9873014182f,
+  0.7939754776f, 0.6079497850f, 0.2607941179f, 0.9653944417f,
+  -0.3798472089f, 0.9250492408f, -0.8639728561f, 0.5035383837f,
+  -0.9920993131f, -0.1254549834f, -0.7114321957f, -0.7027547445f,
+  -0.1376201216f, -0.9904850843f, 0.7921065773f, 0.6103828063f,
+  0.2548656596f, 0.9669764710f, -0.3883450467f, 0.9215140393f,
+  -0.8700869911f, 0.4928981922f, -0.9900582103f, -0.1406582393f,
+  -0.6983762494f, -0.7157308253f, -0.1163186309f, -0.9932119492f,
+  0.7902302214f, 0.6128100824f, 0.2489276057f, 0.9685220943f,
+  -0.3968099874f, 0.9179007756f, -0.8760700942f, 0.4821837721f,
+  -0.9877841416f, -0.1558283977f, -0.6850836678f, -0.7284643904f,
+  -0.0949634953f, -0.9954807555f, 0.7883464276f, 0.6152315906f,
+  0.2429801799f, 0.9700312532f, -0.4052413140f, 0.9142097557f,
+  -0.8819212643f, 0.4713967368f, -0.9852776424f, -0.1709618888f,
+  -0.6715589548f, -0.7409511254f, -0.0735645636f, -0.9972904567f,
+  0.7864552136f, 0.6176473079f, 0.2370236060f, 0.9715038910f,
+  -0.4136383122f, 0.9104412923f, -0.8876396204f, 0.4605387110f,
+  -0.9825393023f, -0.1860551517f, -0.6578066933f, -0.7531867990f,
+  -0.0521317047f, -0.9986402182f, 0.7845565972f, 0.6200572118f,
+  0.2310581083f, 0.9729399522f, -0.4220002708f, 0.9065957045f,
+  -0.8932243012f, 0.4496113297f, -0.9795697657f, -0.2011046348f,
+  -0.6438315429f, -0.7651672656f, -0.0306748032f, -0.9995294175f,
+  0.7826505962f, 0.6224612794f, 0.2250839114f, 0.9743393828f,
+  -0.4303264813f, 0.9026733182f, -0.8986744657f, 0.4386162385f,
+  -0.9763697313f, -0.2161067971f, -0.6296382389f, -0.7768884657f,
+  -0.0092037548f, -0.9999576446f, 0.7807372286f, 0.6248594881f,
+  0.2191012402f, 0.9757021300f, -0.4386162385f, 0.8986744657f,
+  -0.9039892931f, 0.4275550934f, -0.9729399522f, -0.2310581083f,
+  -0.6152315906f, -0.7883464276f, 0.0122715383f, -0.9999247018f,
+  0.7788165124f, 0.6272518155f, 0.2131103199f, 0.9770281427f,
+  -0.4468688402f, 0.8945994856f, -0.9091679831f, 0.4164295601f,
+  -0.9692812354f, -0.2459550503f, -0.6006164794f, -0.7995372691f,
+  0.0337411719f, -0.9994306046f, 0.7768884657f, 0.6296382389f,
+  0.2071113762f, 0.9783173707f, -0.4550835871f, 0.8904487232f,
+  -0.9142097557f, 0.4052413140f, -0.9653944417f, -0.2607941179f,
+  -0.5857978575f, -0.8104571983f, 0.0551952443f, -0.9984755806f,
+  0.7749531066f, 0.6320187359f, 0.2011046348f, 0.9795697657f,
+  -0.4632597836f, 0.8862225301f, -0.9191138517f, 0.3939920401f,
+  -0.9612804858f, -0.2755718193f, -0.5707807459f, -0.8211025150f,
+  0.0766238614f, -0.9970600703f, 0.7730104534f, 0.6343932842f,
+  0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  -0.9238795325f, 0.3826834324f, -0.9569403357f, -0.2902846773f,
+  -0.5555702330f, -0.8314696123f, 0.0980171403f, -0.9951847267f,
+  0.7710605243f, 0.6367618612f, 0.1890686641f, 0.9819638691f,
+  -0.4794937577f, 0.8775452902f, -0.9285060805f, 0.3713171940f,
+  -0.9523750127f, -0.3049292297f, -0.5401714727f, -0.8415549774f,
+  0.1193652148f, -0.9928504145f, 0.7691033376f, 0.6391244449f,
+  0.1830398880f, 0.9831054874f, -0.4875501601f, 0.8730949784f,
+  -0.9329927988f, 0.3598950365f, -0.9475855910f, -0.3195020308f,
+  -0.5245896827f, -0.8513551931f, 0.1406582393f, -0.9900582103f,
+  0.7671389119f, 0.6414810128f, 0.1770042204f, 0.9842100924f,
+  -0.4955652618f, 0.8685707060f, -0.9373390119f, 0.3484186802f,
+  -0.9425731976f, -0.3339996514f, -0.5088301425f, -0.8608669386f,
+  0.1618863938f, -0.9868094018f, 0.7651672656f, 0.6438315429f,
+  0.1709618888f, 0.9852776424f, -0.5035383837f, 0.8639728561f,
+  -0.9415440652f, 0.3368898534f, -0.9373390119f, -0.3484186802f,
+  -0.4928981922f, -0.8700869911f, 0.1830398880f, -0.9831054874f,
+  0.7631884173f, 0.6461760130f, 0.1649131205f, 0.9863080972f,
+  -0.5114688504f, 0.8593018184f, -0.9456073254f, 0.3253102922f,
+  -0.9318842656f, -0.3627557244f, -0.4767992301f, -0.8790122264f,
+  0.2041089661f, -0.9789481753f, 0.7612023855f, 0.6485144010f,
+  0.1588581433f, 0.9873014182f, -0.5193559902f, 0.8545579884f,
+  -0.9495281806f, 0.3136817404f, -0.9262102421f, -0.3770074102f,
+  -0.4605387110f, -0.8876396204f, 0.2250839114f, -0.9743393828f,
+  0.7592091890f, 0.6508466850f, 0.1527971853f, 0.9882575677f,
+  -0.5271991348f, 0.8497417680f, -0.9533060404f, 0.3020059493f,
+  -0.9203182767f, -0.3911703843f, -0.4441221446f, -0.8959662498f,
+  0.2459550503f, -0.9692812354f, 0.7572088465f, 0.6531728430f,
+  0.1467304745f, 0.9891765100f, -0.5349976199f, 0.8448535652f,
+  -0.9569403357f, 0.2902846773f, -0.9142097557f, -0.4052413140f,
+  -0.4275550934f, -0.9039892931f, 0.2667127575f, -0.9637760658f,
+  0.7552013769f, 0.6554928530f, 0.1406582393f, 0.9900582103f,
+  -0.5427507849f, 0.8398937942f, -0.9604305194f, 0.2785196894f,
+  -0.9078861165f, -0.4192168884f, -0.4108431711f, -0.9117060320f,
+  0.2873474595f, -0.9578264130f, 0.7531867990f, 0.6578066933f,
+  0.1345807085f, 0.9909026354f, -0.5504579729f, 0.8348628750f,
+  -0.9637760658f, 0.2667127575f, -0.9013488470f, -0.4330938189f,
+  -0.3939920401f, -0.9191138517f, 0.3078496400f, -0.9514350210f,
+  0.7511651319f, 0.6601143421f, 0.1284981108f, 0.9917097537f,
+  -0.5581185312f, 0.8297612338f, -0.9669764710f, 0.2548656596f,
+  -0.8945994856f, -0.4468688402f, -0.3770074102f, -0.9262102421f,
+  0.3282098436f, -0.9446048373f, 0.7491363945f, 0.6624157776f,
+  0.1224106752f, 0.9924795346f, -0.5657318108f, 0.8245893028f,
+  -0.9700312532f, 0.2429801799f, -0.8876396204f, -0.4605387110f,
+  -0.3598950365f, -0.9329927988f, 0.3484186802f, -0.9373390119f,
+  0.7471006060f, 0.6647109782f, 0.1163186309f, 0.9932119492f,
+  -0.5732971667f, 0.8193475201f, -0.9729399522f, 0.2310581083f,
+  -0.8804708891f, -0.4741002147f, -0.3426607173f, -0.9394592236f,
+  0.3684668300f, -0.9296408958f, 0.7450577854f, 0.6669999223f,
+  0.1102222073f, 0.9939069700f, -0.5808139581f, 0.8140363297f,
+  -0.9757021300f, 0.2191012402f, -0.8730949784f, -0.4875501601f,
+  -0.3253102922f, -0.9456073254f, 0.3883450467f, -0.9215140393f,
+  0.7430079521f, 0.6692825883f, 0.1041216339f, 0.9945645707f,
+  -0.5882815482f, 0.8086561816f, -0.9783173707f, 0.2071113762f,
+  -0.8655136241f, -0.5008853826f, -0.3078496400f, -0.9514350210f,
+  0.4080441629f, -0.9129621904f, 0.7409511254f, 0.6715589548f,
+  0.0980171403f, 0.9951847267f, -0.5956993045f, 0.8032075315f,
+  -0.9807852804f, 0.1950903220f, -0.8577286100f, -0.5141027442f,
+  -0.2902846773f, -0.9569403357f, 0.4275550934f, -0.9039892931f,
+  0.7388873245f, 0.6738290004f, 0.0919089565f, 0.9957674145f,
+  -0.6030665985f, 0.7976908409f, -0.9831054874f, 0.1830398880f,
+  -0.8497417680f, -0.5271991348f, -0.2726213554f, -0.9621214043f,
+  0.4468688402f, -0.8945994856f, 0.7368165689f, 0.6760927036f,
+  0.0857973123f, 0.9963126122f, -0.6103828063f, 0.7921065773f,
+  -0.9852776424f, 0.1709618888f, -0.8415549774f, -0.5401714727f,
+  -0.2548656596f, -0.9669764710f, 0.4659764958f, -0.8847970984f,
+  0.7347388781f, 0.6783500431f, 0.0796824380f, 0.9968202993f,
+  -0.6176473079f, 0.7864552136f, -0.9873014182f, 0.1588581433f,
+  -0.8331701647f, -0.5530167056f, -0.2370236060f, -0.9715038910f,
+  0.4848692480f, -0.8745866523f, 0.7326542717f, 0.6806009978f,
+  0.0735645636f, 0.9972904567f, -0.6248594881f, 0.7807372286f,
+  -0.9891765100f, 0.1467304745f, -0.8245893028f, -0.5657318108f,
+  -0.2191012402f, -0.9757021300f, 0.5035383837f, -0.8639728561f,
+  0.7305627692f, 0.6828455464f, 0.0674439196f, 0.9977230666f,
+  -0.6320187359f, 0.7749531066f, -0.9909026354f, 0.1345807085f,
+  -0.8158144108f, -0.5783137964f, -0.2011046348f, -0.9795697657f,
+  0.5219752929f, -0.8529606049f, 0.7284643904f, 0.6850836678f,
+  0.0613207363f, 0.9981181129f, -0.6391244449f, 0.7691033376f,
+  -0.9924795346f, 0.1224106752f, -0.8068475535f, -0.5907597019f,
+  -0.1830398880f, -0.9831054874f, 0.5401714727f, -0.8415549774f,
+  0.7263591551f, 0.6873153409f, 0.0551952443f, 0.9984755806f,
+  -0.6461760130f, 0.7631884173f, -0.9939069700f, 0.1102222073f,
+  -0.7976908409f, -0.6030665985f, -0.1649131205f, -0.9863080972f,
+  0.5581185312f, -0.8297612338f, 0.7242470830f, 0.6895405447f,
+  0.0490676743f, 0.9987954562f, -0.6531728430f, 0.7572088465f,
+  -0.9951847267f, 0.0980171403f, -0.7883464276f, -0.6152315906f,
+  -0.1467304745f, -0.9891765100f, 0.5758081914f, -0.8175848132f,
+  0.7221281939f, 0.6917592584f, 0.0429382569f, 0.9990777278f,
+  -0.6601143421f, 0.7511651319f, -0.9963126122f, 0.0857973123f,
+  -0.7788165124f, -0.6272518155f, -0.1284981108f, -0.9917097537f,
+  0.5932322950f, -0.8050313311f, 0.7200025080f, 0.6939714609f,
+  0.0368072229f, 0.9993223846f, -0.6669999223f, 0.7450577854f,
+  -0.9972904567f, 0.0735645636f, -0.7691033376f, -0.6391244449f,
+  -0.1102222073f, -0.9939069700f, 0.6103828063f, -0.7921065773f,
+  0.7178700451f, 0.6961771315f, 0.0306748032f, 0.9995294175f,
+  -0.6738290004f, 0.7388873245f, -0.9981181129f, 0.0613207363f,
+  -0.7592091890f, -0.6508466850f, -0.0919089565f, -0.9957674145f,
+  0.6272518155f, -0.7788165124f, 0.7157308253f, 0.6983762494f,
+  0.0245412285f, 0.9996988187f, -0.6806009978f, 0.7326542717f,
+  -0.9987954562f, 0.0490676743f, -0.7491363945f, -0.6624157776f,
+  -0.0735645636f, -0.9972904567f, 0.6438315429f, -0.7651672656f,
+  0.7135848688f, 0.7005687939f, 0.0184067299f, 0.9998305818f,
+  -0.6873153409f, 0.7263591551f, -0.9993223846f, 0.0368072229f,
+  -0.7388873245f, -0.6738290004f, -0.0551952443f, -0.9984755806f,
+  0.6601143421f, -0.7511651319f, 0.7114321957f, 0.7027547445f,
+  0.0122715383f, 0.9999247018f, -0.6939714609f, 0.7200025080f,
+  -0.9996988187f, 0.0245412285f, -0.7284643904f, -0.6850836678f,
+  -0.0368072229f, -0.9993223846f, 0.6760927036f, -0.7368165689f,
+  0.7092728264f, 0.7049340804f, 0.0061358846f, 0.9999811753f,
+  -0.7005687939f, 0.7135848688f, -0.9999247018f, 0.0122715383f,
+  -0.7178700451f, -0.6961771315f, -0.0184067299f, -0.9998305818f,
+  0.6917592584f, -0.7221281939f, 0.9996988187f, 0.0245412285f,
+  0.9987954562f, 0.0490676743f, 0.9972904567f, 0.0735645636f,
+  0.9951847267f, 0.0980171403f, 0.9924795346f, 0.1224106752f,
+  0.9891765100f, 0.1467304745f, 0.9852776424f, 0.1709618888f,
+  0.9987954562f, 0.0490676743f, 0.9951847267f, 0.0980171403f,
+  0.9891765100f, 0.1467304745f, 0.9807852804f, 0.1950903220f,
+  0.9700312532f, 0.2429801799f, 0.9569403357f, 0.2902846773f,
+  0.9415440652f, 0.3368898534f, 0.9972904567f, 0.0735645636f,
+  0.9891765100f, 0.1467304745f, 0.9757021300f, 0.2191012402f,
+  0.9569403357f, 0.2902846773f, 0.9329927988f, 0.3598950365f,
+  0.9039892931f, 0.4275550934f, 0.8700869911f, 0.4928981922f,
+  0.9951847267f, 0.0980171403f, 0.9807852804f, 0.1950903220f,
+  0.9569403357f, 0.2902846773f, 0.9238795325f, 0.3826834324f,
+  0.8819212643f, 0.4713967368f, 0.8314696123f, 0.5555702330f,
+  0.7730104534f, 0.6343932842f, 0.9924795346f, 0.1224106752f,
+  0.9700312532f, 0.2429801799f, 0.9329927988f, 0.3598950365f,
+  0.8819212643f, 0.4713967368f, 0.8175848132f, 0.5758081914f,
+  0.7409511254f, 0.6715589548f, 0.6531728430f, 0.7572088465f,
+  0.9891765100f, 0.1467304745f, 0.9569403357f, 0.2902846773f,
+  0.9039892931f, 0.4275550934f, 0.8314696123f, 0.5555702330f,
+  0.7409511254f, 0.6715589548f, 0.6343932842f, 0.7730104534f,
+  0.5141027442f, 0.8577286100f, 0.9852776424f, 0.1709618888f,
+  0.9415440652f, 0.3368898534f, 0.8700869911f, 0.4928981922f,
+  0.7730104534f, 0.6343932842f, 0.6531728430f, 0.7572088465f,
+  0.5141027442f, 0.8577286100f, 0.3598950365f, 0.9329927988f,
+  0.9807852804f, 0.1950903220f, 0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.7071067812f, 0.7071067812f,
+  0.5555702330f, 0.8314696123f, 0.3826834324f, 0.9238795325f,
+  0.1950903220f, 0.9807852804f, 0.9757021300f, 0.2191012402f,
+  0.9039892931f, 0.4275550934f, 0.7883464276f, 0.6152315906f,
+  0.6343932842f, 0.7730104534f, 0.4496113297f, 0.8932243012f,
+  0.2429801799f, 0.9700312532f, 0.0245412285f, 0.9996988187f,
+  0.9700312532f, 0.2429801799f, 0.8819212643f, 0.4713967368f,
+  0.7409511254f, 0.6715589548f, 0.5555702330f, 0.8314696123f,
+  0.3368898534f, 0.9415440652f, 0.0980171403f, 0.9951847267f,
+  -0.1467304745f, 0.9891765100f, 0.9637760658f, 0.2667127575f,
+  0.8577286100f, 0.5141027442f, 0.6895405447f, 0.7242470830f,
+  0.4713967368f, 0.8819212643f, 0.2191012402f, 0.9757021300f,
+  -0.0490676743f, 0.9987954562f, -0.3136817404f, 0.9495281806f,
+  0.9569403357f, 0.2902846773f, 0.8314696123f, 0.5555702330f,
+  0.6343932842f, 0.7730104534f, 0.3826834324f, 0.9238795325f,
+  0.0980171403f, 0.9951847267f, -0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, 0.9495281806f, 0.3136817404f,
+  0.8032075315f, 0.5956993045f, 0.5758081914f, 0.8175848132f,
+  0.2902846773f, 0.9569403357f, -0.0245412285f, 0.9996988187f,
+  -0.3368898534f, 0.9415440652f, -0.6152315906f, 0.7883464276f,
+  0.9415440652f, 0.3368898534f, 0.7730104534f, 0.6343932842f,
+  0.5141027442f, 0.8577286100f, 0.1950903220f, 0.9807852804f,
+  -0.1467304745f, 0.9891765100f, -0.4713967368f, 0.8819212643f,
+  -0.7409511254f, 0.6715589548f, 0.9329927988f, 0.3598950365f,
+  0.7409511254f, 0.6715589548f, 0.4496113297f, 0.8932243012f,
+  0.0980171403f, 0.9951847267f, -0.2667127575f, 0.9637760658f,
+  -0.5956993045f, 0.8032075315f, -0.8448535652f, 0.5349976199f,
+  0.9238795325f, 0.3826834324f, 0.7071067812f, 0.7071067812f,
+  0.3826834324f, 0.9238795325f, 0.0000000000f, 1.0000000000f,
+  -0.3826834324f, 0.9238795325f, -0.7071067812f, 0.7071067812f,
+  -0.9238795325f, 0.3826834324f, 0.9142097557f, 0.4052413140f,
+  0.6715589548f, 0.7409511254f, 0.3136817404f, 0.9495281806f,
+  -0.0980171403f, 0.9951847267f, -0.4928981922f, 0.8700869911f,
+  -0.8032075315f, 0.5956993045f, -0.9757021300f, 0.2191012402f,
+  0.9039892931f, 0.4275550934f, 0.6343932842f, 0.7730104534f,
+  0.2429801799f, 0.9700312532f, -0.1950903220f, 0.9807852804f,
+  -0.5956993045f, 0.8032075315f, -0.8819212643f, 0.4713967368f,
+  -0.9987954562f, 0.0490676743f, 0.8932243012f, 0.4496113297f,
+  0.5956993045f, 0.8032075315f, 0.1709618888f, 0.9852776424f,
+  -0.2902846773f, 0.9569403357f, -0.6895405447f, 0.7242470830f,
+  -0.9415440652f, 0.3368898534f, -0.9924795346f, -0.1224106752f,
+  0.8819212643f, 0.4713967368f, 0.5555702330f, 0.8314696123f,
+  0.0980171403f, 0.9951847267f, -0.3826834324f, 0.9238795325f,
+  -0.7730104534f, 0.6343932842f, -0.9807852804f, 0.1950903220f,
+  -0.9569403357f, -0.2902846773f, 0.8700869911f, 0.4928981922f,
+  0.5141027442f, 0.8577286100f, 0.0245412285f, 0.9996988187f,
+  -0.4713967368f, 0.8819212643f, -0.8448535652f, 0.5349976199f,
+  -0.9987954562f, 0.0490676743f, -0.8932243012f, -0.4496113297f,
+  0.8577286100f, 0.5141027442f, 0.4713967368f, 0.8819212643f,
+  -0.0490676743f, 0.9987954562f, -0.5555702330f, 0.8314696123f,
+  -0.9039892931f, 0.4275550934f, -0.9951847267f, -0.0980171403f,
+  -0.8032075315f, -0.5956993045f, 0.8448535652f, 0.5349976199f,
+  0.4275550934f, 0.9039892931f, -0.1224106752f, 0.9924795346f,
+  -0.6343932842f, 0.7730104534f, -0.9495281806f, 0.3136817404f,
+  -0.9700312532f, -0.2429801799f, -0.6895405447f, -0.7242470830f,
+  0.8314696123f, 0.5555702330f, 0.3826834324f, 0.9238795325f,
+  -0.1950903220f, 0.9807852804f, -0.7071067812f, 0.7071067812f,
+  -0.9807852804f, 0.1950903220f, -0.9238795325f, -0.3826834324f,
+  -0.5555702330f, -0.8314696123f, 0.8175848132f, 0.5758081914f,
+  0.3368898534f, 0.9415440652f, -0.2667127575f, 0.9637760658f,
+  -0.7730104534f, 0.6343932842f, -0.9972904567f, 0.0735645636f,
+  -0.8577286100f, -0.5141027442f, -0.4052413140f, -0.9142097557f,
+  0.8032075315f, 0.5956993045f, 0.2902846773f, 0.9569403357f,
+  -0.3368898534f, 0.9415440652f, -0.8314696123f, 0.5555702330f,
+  -0.9987954562f, -0.0490676743f, -0.7730104534f, -0.6343932842f,
+  -0.2429801799f, -0.9700312532f, 0.7883464276f, 0.6152315906f,
+  0.2429801799f, 0.9700312532f, -0.4052413140f, 0.9142097557f,
+  -0.8819212643f, 0.4713967368f, -0.9852776424f, -0.1709618888f,
+  -0.6715589548f, -0.7409511254f, -0.0735645636f, -0.9972904567f,
+  0.7730104534f, 0.6343932842f, 0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, -0.9238795325f, 0.3826834324f,
+  -0.9569403357f, -0.2902846773f, -0.5555702330f, -0.8314696123f,
+  0.0980171403f, -0.9951847267f, 0.7572088465f, 0.6531728430f,
+  0.1467304745f, 0.9891765100f, -0.5349976199f, 0.8448535652f,
+  -0.9569403357f, 0.2902846773f, -0.9142097557f, -0.4052413140f,
+  -0.4275550934f, -0.9039892931f, 0.2667127575f, -0.9637760658f,
+  0.7409511254f, 0.6715589548f, 0.0980171403f, 0.9951847267f,
+  -0.5956993045f, 0.8032075315f, -0.9807852804f, 0.1950903220f,
+  -0.8577286100f, -0.5141027442f, -0.2902846773f, -0.9569403357f,
+  0.4275550934f, -0.9039892931f, 0.7242470830f, 0.6895405447f,
+  0.0490676743f, 0.9987954562f, -0.6531728430f, 0.7572088465f,
+  -0.9951847267f, 0.0980171403f, -0.7883464276f, -0.6152315906f,
+  -0.1467304745f, -0.9891765100f, 0.5758081914f, -0.8175848132f,
+  0.9807852804f, 0.1950903220f, 0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.7071067812f, 0.7071067812f,
+  0.5555702330f, 0.8314696123f, 0.3826834324f, 0.9238795325f,
+  0.1950903220f, 0.9807852804f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.3826834324f, 0.9238795325f,
+  -0.1950903220f, 0.9807852804f, -0.7071067812f, 0.7071067812f,
+  -0.9807852804f, 0.1950903220f, -0.9238795325f, -0.3826834324f,
+  -0.5555702330f, -0.8314696123f
+};
+#elif (ARM_MATH_MAX_FFT_LEN >= 256)
+const float32_t twiddleCoef_256[476] = {
+  0.9996988187f, 0.0245412285f, 0.9987954562f, 0.0490676743f,
+  0.9972904567f, 0.0735645636f, 0.9951847267f, 0.0980171403f,
+  0.9924795346f, 0.1224106752f, 0.9891765100f, 0.1467304745f,
+  0.9852776424f, 0.1709618888f, 0.9987954562f, 0.0490676743f,
+  0.9951847267f, 0.0980171403f, 0.9891765100f, 0.1467304745f,
+  0.9807852804f, 0.1950903220f, 0.9700312532f, 0.2429801799f,
+  0.9569403357f, 0.2902846773f, 0.9415440652f, 0.3368898534f,
+  0.9972904567f, 0.0735645636f, 0.9891765100f, 0.1467304745f,
+  0.9757021300f, 0.2191012402f, 0.9569403357f, 0.2902846773f,
+  0.9329927988f, 0.3598950365f, 0.9039892931f, 0.4275550934f,
+  0.8700869911f, 0.4928981922f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.9924795346f, 0.1224106752f, 0.9700312532f, 0.2429801799f,
+  0.9329927988f, 0.3598950365f, 0.8819212643f, 0.4713967368f,
+  0.8175848132f, 0.5758081914f, 0.7409511254f, 0.6715589548f,
+  0.6531728430f, 0.7572088465f, 0.9891765100f, 0.1467304745f,
+  0.9569403357f, 0.2902846773f, 0.9039892931f, 0.4275550934f,
+  0.8314696123f, 0.5555702330f, 0.7409511254f, 0.6715589548f,
+  0.6343932842f, 0.7730104534f, 0.5141027442f, 0.8577286100f,
+  0.9852776424f, 0.1709618888f, 0.9415440652f, 0.3368898534f,
+  0.8700869911f, 0.4928981922f, 0.7730104534f, 0.6343932842f,
+  0.6531728430f, 0.7572088465f, 0.5141027442f, 0.8577286100f,
+  0.3598950365f, 0.9329927988f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9757021300f, 0.2191012402f, 0.9039892931f, 0.4275550934f,
+  0.7883464276f, 0.6152315906f, 0.6343932842f, 0.7730104534f,
+  0.4496113297f, 0.8932243012f, 0.2429801799f, 0.9700312532f,
+  0.0245412285f, 0.9996988187f, 0.9700312532f, 0.2429801799f,
+  0.8819212643f, 0.4713967368f, 0.7409511254f, 0.6715589548f,
+  0.5555702330f, 0.8314696123f, 0.3368898534f, 0.9415440652f,
+  0.0980171403f, 0.9951847267f, -0.1467304745f, 0.9891765100f,
+  0.9637760658f, 0.2667127575f, 0.8577286100f, 0.5141027442f,
+  0.6895405447f, 0.7242470830f, 0.4713967368f, 0.8819212643f,
+  0.2191012402f, 0.9757021300f, -0.0490676743f, 0.9987954562f,
+  -0.3136817404f, 0.9495281806f, 0.9569403357f, 0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.6343932842f, 0.7730104534f,
+  0.3826834324f, 0.9238795325f, 0.0980171403f, 0.9951847267f,
+  -0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  0.9495281806f, 0.3136817404f, 0.8032075315f, 0.5956993045f,
+  0.5758081914f, 0.8175848132f, 0.2902846773f, 0.9569403357f,
+  -0.0245412285f, 0.9996988187f, -0.3368898534f, 0.9415440652f,
+  -0.6152315906f, 0.7883464276f, 0.9415440652f, 0.3368898534f,
+  0.7730104534f, 0.6343932842f, 0.5141027442f, 0.8577286100f,
+  0.1950903220f, 0.9807852804f, -0.1467304745f, 0.9891765100f,
+  -0.4713967368f, 0.8819212643f, -0.7409511254f, 0.6715589548f,
+  0.9329927988f, 0.3598950365f, 0.7409511254f, 0.6715589548f,
+  0.4496113297f, 0.8932243012f, 0.0980171403f, 0.9951847267f,
+  -0.2667127575f, 0.9637760658f, -0.5956993045f, 0.8032075315f,
+  -0.8448535652f, 0.5349976199f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.9142097557f, 0.4052413140f, 0.6715589548f, 0.7409511254f,
+  0.3136817404f, 0.9495281806f, -0.0980171403f, 0.9951847267f,
+  -0.4928981922f, 0.8700869911f, -0.8032075315f, 0.5956993045f,
+  -0.9757021300f, 0.2191012402f, 0.9039892931f, 0.4275550934f,
+  0.6343932842f, 0.7730104534f, 0.2429801799f, 0.9700312532f,
+  -0.1950903220f, 0.9807852804f, -0.5956993045f, 0.8032075315f,
+  -0.8819212643f, 0.4713967368f, -0.9987954562f, 0.0490676743f,
+  0.8932243012f, 0.4496113297f, 0.5956993045f, 0.8032075315f,
+  0.1709618888f, 0.9852776424f, -0.2902846773f, 0.9569403357f,
+  -0.6895405447f, 0.7242470830f, -0.9415440652f, 0.3368898534f,
+  -0.9924795346f, -0.1224106752f, 0.8819212643f, 0.4713967368f,
+  0.5555702330f, 0.8314696123f, 0.0980171403f, 0.9951847267f,
+  -0.3826834324f, 0.9238795325f, -0.7730104534f, 0.6343932842f,
+  -0.9807852804f, 0.1950903220f, -0.9569403357f, -0.2902846773f,
+  0.8700869911f, 0.4928981922f, 0.5141027442f, 0.8577286100f,
+  0.0245412285f, 0.9996988187f, -0.4713967368f, 0.8819212643f,
+  -0.8448535652f, 0.5349976199f, -0.9987954562f, 0.0490676743f,
+  -0.8932243012f, -0.4496113297f, 0.8577286100f, 0.5141027442f,
+  0.4713967368f, 0.8819212643f, -0.0490676743f, 0.9987954562f,
+  -0.5555702330f, 0.8314696123f, -0.9039892931f, 0.4275550934f,
+  -0.9951847267f, -0.0980171403f, -0.8032075315f, -0.5956993045f,
+  0.8448535652f, 0.5349976199f, 0.4275550934f, 0.9039892931f,
+  -0.1224106752f, 0.9924795346f, -0.6343932842f, 0.7730104534f,
+  -0.9495281806f, 0.3136817404f, -0.9700312532f, -0.2429801799f,
+  -0.6895405447f, -0.7242470830f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.8175848132f, 0.5758081914f, 0.3368898534f, 0.9415440652f,
+  -0.2667127575f, 0.9637760658f, -0.7730104534f, 0.6343932842f,
+  -0.9972904567f, 0.0735645636f, -0.8577286100f, -0.5141027442f,
+  -0.4052413140f, -0.9142097557f, 0.8032075315f, 0.5956993045f,
+  0.2902846773f, 0.9569403357f, -0.3368898534f, 0.9415440652f,
+  -0.8314696123f, 0.5555702330f, -0.9987954562f, -0.0490676743f,
+  -0.7730104534f, -0.6343932842f, -0.2429801799f, -0.9700312532f,
+  0.7883464276f, 0.6152315906f, 0.2429801799f, 0.9700312532f,
+  -0.4052413140f, 0.9142097557f, -0.8819212643f, 0.4713967368f,
+  -0.9852776424f, -0.1709618888f, -0.6715589548f, -0.7409511254f,
+  -0.0735645636f, -0.9972904567f, 0.7730104534f, 0.6343932842f,
+  0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  -0.9238795325f, 0.3826834324f, -0.9569403357f, -0.2902846773f,
+  -0.5555702330f, -0.8314696123f, 0.0980171403f, -0.9951847267f,
+  0.7572088465f, 0.6531728430f, 0.1467304745f, 0.9891765100f,
+  -0.5349976199f, 0.8448535652f, -0.9569403357f, 0.2902846773f,
+  -0.9142097557f, -0.4052413140f, -0.4275550934f, -0.9039892931f,
+  0.2667127575f, -0.9637760658f, 0.7409511254f, 0.6715589548f,
+  0.0980171403f, 0.9951847267f, -0.5956993045f, 0.8032075315f,
+  -0.9807852804f, 0.1950903220f, -0.8577286100f, -0.5141027442f,
+  -0.2902846773f, -0.9569403357f, 0.4275550934f, -0.9039892931f,
+  0.7242470830f, 0.6895405447f, 0.0490676743f, 0.9987954562f,
+  -0.6531728430f, 0.7572088465f, -0.9951847267f, 0.0980171403f,
+  -0.7883464276f, -0.6152315906f, -0.1467304745f, -0.9891765100f,
+  0.5758081914f, -0.8175848132f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9238795325f, 0.3826834324f, 0.7071067812f, 0.7071067812f,
+  0.3826834324f, 0.9238795325f, 0.0000000000f, 1.0000000000f,
+  -0.3826834324f, 0.9238795325f, -0.7071067812f, 0.7071067812f,
+  -0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123
+};
+#elif (ARM_MATH_MAX_FFT_LEN >= 32)
+const float32_t twiddleCoef_32[42] = {
+  0.9807852804f, 0.1950903220f, 0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.7071067812f, 0.7071067812f,
+  0.5555702330f, 0.8314696123f, 0.3826834324f, 0.9238795325f,
+  0.1950903220f, 0.9807852804f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.3826834324f, 0.9238795325f,
+  -0.1950903220f, 0.9807852804f, -0.7071067812f, 0.7071067812f,
+  -0.9807852804f, 0.1950903220f, -0.9238795325f, -0.3826834324f,
+  -0.5555702330f, -0.8314696123
+};
+#endif
+
+/**    
+* @brief  Floating-point twiddle factors of the 4096 point mixed radix CFFT    
+* \par    
+* The twiddles of the radix-8 stages of span 4096, 512, 64, one stage after the other:    
+* the 512 and 64 point CFFTs start at index 7154 and 8036. Below ARM_MATH_MAX_FFT_LEN = 4096,    
+* the table starts at the first stage used: twiddleCoef_512 or twiddleCoef_64.    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
+const float32_t twiddleCoef_4096[8134] = {
+  0.9999988235f, 0.0015339802f, 0.9999952938f, 0.0030679568f,
+  0.9999894111f, 0.0046019261f, 0.9999811753f, 0.0061358846f,
+  0.9999705864f, 0.0076698287f, 0.9999576446f, 0.0092037548f,
+  0.9999423497f, 0.0107376592f, 0.9999952938f, 0.0030679568f,
+  0.9999811753f, 0.0061358846f, 0.9999576446f, 0.0092037548f,
+  0.9999247018f, 0.0122715383f, 0.9998823475f, 0.0153392063f,
+  0.9998305818f, 0.0184067299f, 0.9997694054f, 0.0214740803f,
+  0.9999894111f, 0.0046019261f, 0.9999576446f, 0.0092037548f,
+  0.9999047011f, 0.0138053885f, 0.9998305818f, 0.0184067299f,
+  0.9997352883f, 0.0230076815f, 0.9996188225f, 0.0276081458f,
+  0.9994811870f, 0.0322080254f, 0.9999811753f, 0.0061358846f,
+  0.9999247018f, 0.0122715383f, 0.9998305818f, 0.0184067299f,
+  0.9996988187f, 0.0245412285f, 0.9995294175f, 0.0306748032f,
+  0.9993223846f, 0.0368072229f, 0.9990777278f, 0.0429382569f,
+  0.9999705864f, 0.0076698287f, 0.9998823475f, 0.0153392063f,
+  0.9997352883f, 0.0230076815f, 0.9995294175f, 0.0306748032f,
+  0.9992647473f, 0.0383401204f, 0.9989412932f, 0.0460031821f,
+  0.9985590742f, 0.0536635377f, 0.9999576446f, 0.0092037548f,
+  0.9998305818f, 0.0184067299f, 0.9996188225f, 0.0276081458f,
+  0.9993223846f, 0.0368072229f, 0.9989412932f, 0.0460031821f,
+  0.9984755806f, 0.0551952443f, 0.9979252862f, 0.0643826309f,
+  0.9999423497f, 0.0107376592f, 0.9997694054f, 0.0214740803f,
+  0.9994811870f, 0.0322080254f, 0.9990777278f, 0.0429382569f,
+  0.9985590742f, 0.0536635377f, 0.9979252862f, 0.0643826309f,
+  0.9971764367f, 0.0750943008f, 0.9999247018f, 0.0122715383f,
+  0.9996988187f, 0.0245412285f, 0.9993223846f, 0.0368072229f,
+  0.9987954562f, 0.0490676743f, 0.9981181129f, 0.0613207363f,
+  0.9972904567f, 0.0735645636f, 0.9963126122f, 0.0857973123f,
+  0.9999047011f, 0.0138053885f, 0.9996188225f, 0.0276081458f,
+  0.9991424187f, 0.0414056410f, 0.9984755806f, 0.0551952443f,
+  0.9976184351f, 0.0689743276f, 0.9965711458f, 0.0827402645f,
+  0.9953339121f, 0.0964904314f, 0.9998823475f, 0.0153392063f,
+  0.9995294175f, 0.0306748032f, 0.9989412932f, 0.0460031821f,
+  0.9981181129f, 0.0613207363f, 0.9970600703f, 0.0766238614f,
+  0.9957674145f, 0.0919089565f, 0.9942404495f, 0.1071724250f,
+  0.9998576410f, 0.0168729879f, 0.9994306046f, 0.0337411719f,
+  0.9987190122f, 0.0505997490f, 0.9977230666f, 0.0674439196f,
+  0.9964430514f, 0.0842688876f, 0.9948793308f, 0.1010698628f,
+  0.9930323502f, 0.1178420615f, 0.9998305818f, 0.0184067299f,
+  0.9993223846f, 0.0368072229f, 0.9984755806f, 0.0551952443f,
+  0.9972904567f, 0.0735645636f, 0.9957674145f, 0.0919089565f,
+  0.9939069700f, 0.1102222073f, 0.9917097537f, 0.1284981108f,
+  0.9998011699f, 0.0199404286f, 0.9992047586f, 0.0398729276f,
+  0.9982110034f, 0.0597895707f, 0.9968202993f, 0.0796824380f,
+  0.9950331994f, 0.0995436187f, 0.9928504145f, 0.1193652148f,
+  0.9902728124f, 0.1391393442f, 0.9997694054f, 0.0214740803f,
+  0.9990777278f, 0.0429382569f, 0.9979252862f, 0.0643826309f,
+  0.9963126122f, 0.0857973123f, 0.9942404495f, 0.1071724250f,
+  0.9917097537f, 0.1284981108f, 0.9887216920f, 0.1497645347f,
+  0.9997352883f, 0.0230076815f, 0.9989412932f, 0.0460031821f,
+  0.9976184351f, 0.0689743276f, 0.9957674145f, 0.0919089565f,
+  0.9933892111f, 0.1147949266f, 0.9904850843f, 0.1376201216f,
+  0.9870565713f, 0.1603724572f, 0.9996988187f, 0.0245412285f,
+  0.9987954562f, 0.0490676743f, 0.9972904567f, 0.0735645636f,
+  0.9951847267f, 0.0980171403f, 0.9924795346f, 0.1224106752f,
+  0.9891765100f, 0.1467304745f, 0.9852776424f, 0.1709618888f,
+  0.9996599967f, 0.0260747178f, 0.9986402182f, 0.0521317047f,
+  0.9969413578f, 0.0781532416f, 0.9945645707f, 0.1041216339f,
+  0.9915114733f, 0.1300192227f, 0.9877841416f, 0.1558283977f,
+  0.9833851103f, 0.1815316083f, 0.9996188225f, 0.0276081458f,
+  0.9984755806f, 0.0551952443f, 0.9965711458f, 0.0827402645f,
+  0.9939069700f, 0.1102222073f, 0.9904850843f, 0.1376201216f,
+  0.9863080972f, 0.1649131205f, 0.9813791933f, 0.1920803970f,
+  0.9995752960f, 0.0291415088f, 0.9983015449f, 0.0582582645f,
+  0.9961798286f, 0.0873255352f, 0.9932119492f, 0.1163186309f,
+  0.9894004278f, 0.1452129247f, 0.9847485018f, 0.1739838734f,
+  0.9792601226f, 0.2026070388f, 0.9995294175f, 0.0306748032f,
+  0.9981181129f, 0.0613207363f, 0.9957674145f, 0.0919089565f,
+  0.9924795346f, 0.1224106752f, 0.9882575677f, 0.1527971853f,
+  0.9831054874f, 0.1830398880f, 0.9770281427f, 0.2131103199f,
+  0.9994811870f, 0.0322080254f, 0.9979252862f, 0.0643826309f,
+  0.9953339121f, 0.0964904314f, 0.9917097537f, 0.1284981108f,
+  0.9870565713f, 0.1603724572f, 0.9813791933f, 0.1920803970f,
+  0.9746835107f, 0.2235890292f, 0.9994306046f, 0.0337411719f,
+  0.9977230666f, 0.0674439196f, 0.9948793308f, 0.1010698628f,
+  0.9909026354f, 0.1345807085f, 0.9857975092f, 0.1679382950f,
+  0.9795697657f, 0.2011046348f, 0.9722264971f, 0.2340419586f,
+  0.9993776704f, 0.0352742389f, 0.9975114561f, 0.0705045734f,
+  0.9944036801f, 0.1056471537f, 0.9900582103f, 0.1406582393f,
+  0.9844804554f, 0.1754942534f, 0.9776773578f, 0.2101118369f,
+  0.9696573851f, 0.2444679027f, 0.9993223846f, 0.0368072229f,
+  0.9972904567f, 0.0735645636f, 0.9939069700f, 0.1102222073f,
+  0.9891765100f, 0.1467304745f, 0.9831054874f, 0.1830398880f,
+  0.9757021300f, 0.2191012402f, 0.9669764710f, 0.2548656596f,
+  0.9992647473f, 0.0383401204f, 0.9970600703f, 0.0766238614f,
+  0.9933892111f, 0.1147949266f, 0.9882575677f, 0.1527971853f,
+  0.9816726862f, 0.1905747548f, 0.9736442497f, 0.2280720832f,
+  0.9641840640f, 0.2652340303f, 0.9992047586f, 0.0398729276f,
+  0.9968202993f, 0.0796824380f, 0.9928504145f, 0.1193652148f,
+  0.9873014182f, 0.1588581433f, 0.9801821360f, 0.1980984107f,
+  0.9715038910f, 0.2370236060f, 0.9612804858f, 0.2755718193f,
+  0.9991424187f, 0.0414056410f, 0.9965711458f, 0.0827402645f,
+  0.9922905913f, 0.1239329751f, 0.9863080972f, 0.1649131205f,
+  0.9786339244f, 0.2056104131f, 0.9692812354f, 0.2459550503f,
+  0.9582660714f, 0.2858778347f, 0.9990777278f, 0.0429382569f,
+  0.9963126122f, 0.0857973123f, 0.9917097537f, 0.1284981108f,
+  0.9852776424f, 0.1709618888f, 0.9770281427f, 0.2131103199f,
+  0.9669764710f, 0.2548656596f, 0.9551411683f, 0.2961508882f,
+  0.9990106859f, 0.0444707719f, 0.9960447009f, 0.0888535526f,
+  0.9911079137f, 0.1330605252f, 0.9842100924f, 0.1770042204f,
+  0.9753648851f, 0.2205976901f, 0.9645897933f, 0.2637546790f,
+  0.9519061368f, 0.3063897954f, 0.9989412932f, 0.0460031821f,
+  0.9957674145f, 0.0919089565f, 0.9904850843f, 0.1376201216f,
+  0.9831054874f, 0.1830398880f, 0.9736442497f, 0.2280720832f,
+  0.9621214043f, 0.2726213554f, 0.9485613499f, 0.3165933756f,
+  0.9988695499f, 0.0475354842f, 0.9954807555f, 0.0949634953f,
+  0.9898412785f, 0.1421768035f, 0.9819638691f, 0.1890686641f,
+  0.9718663375f, 0.2355330594f, 0.9595715131f, 0.2814649379f,
+  0.9451071933f, 0.3267604523f, 0.9987954562f, 0.0490676743f,
+  0.9951847267f, 0.0980171403f, 0.9891765100f, 0.1467304745f,
+  0.9807852804f, 0.1950903220f, 0.9700312532f, 0.2429801799f,
+  0.9569403357f, 0.2902846773f, 0.9415440652f, 0.3368898534f,
+  0.9987190122f, 0.0505997490f, 0.9948793308f, 0.1010698628f,
+  0.9884907929f, 0.1512810380f, 0.9795697657f, 0.2011046348f,
+  0.9681391047f, 0.2504130066f, 0.9542280951f, 0.2990798263f,
+  0.9378723764f, 0.3469804108f, 0.9986402182f, 0.0521317047f,
+  0.9945645707f, 0.1041216339f, 0.9877841416f, 0.1558283977f,
+  0.9783173707f, 0.2071113762f, 0.9661900034f, 0.2578311022f,
+  0.9514350210f, 0.3078496400f, 0.9340925504f, 0.3570309612f,
+  0.9985590742f, 0.0536635377f, 0.9942404495f, 0.1071724250f,
+  0.9870565713f, 0.1603724572f, 0.9770281427f, 0.2131103199f,
+  0.9641840640f, 0.2652340303f, 0.9485613499f, 0.3165933756f,
+  0.9302050229f, 0.3670403457f, 0.9984755806f, 0.0551952443f,
+  0.9939069700f, 0.1102222073f, 0.9863080972f, 0.1649131205f,
+  0.9757021300f, 0.2191012402f, 0.9621214043f, 0.2726213554f,
+  0.9456073254f, 0.3253102922f, 0.9262102421f, 0.3770074102f,
+  0.9983897374f, 0.0567268212f, 0.9935641355f, 0.1132709522f,
+  0.9855387353f, 0.1694502912f, 0.9743393828f, 0.2250839114f,
+  0.9600021457f, 0.2799926431f, 0.9425731976f, 0.3339996514f,
+  0.9221086687f, 0.3869310055f, 0.9983015449f, 0.0582582645f,
+  0.9932119492f, 0.1163186309f, 0.9847485018f, 0.1739838734f,
+  0.9729399522f, 0.2310581083f, 0.9578264130f, 0.2873474595f,
+  0.9394592236f, 0.3426607173f, 0.9179007756f, 0.3968099874f,
+  0.9982110034f, 0.0597895707f, 0.9928504145f, 0.1193652148f,
+  0.9839374134f, 0.1785137709f, 0.9715038910f, 0.2370236060f,
+  0.9555943341f, 0.2946853722f, 0.9362656672f, 0.3512927561f,
+  0.9135870479f, 0.4066432169f, 0.9981181129f, 0.0613207363f,
+  0.9924795346f, 0.1224106752f, 0.9831054874f, 0.1830398880f,
+  0.9700312532f, 0.2429801799f, 0.9533060404f, 0.3020059493f,
+  0.9329927988f, 0.3598950365f, 0.9091679831f, 0.4164295601f,
+  0.9980228738f, 0.0628517576f, 0.9920993131f, 0.1254549834f,
+  0.9822527414f, 0.1875621286f, 0.9685220943f, 0.2489276057f,
+  0.9509616663f, 0.3093087603f, 0.9296408958f, 0.3684668300f,
+  0.9046440906f, 0.4261678887f, 0.9979252862f, 0.0643826309f,
+  0.9917097537f, 0.1284981108f, 0.9813791933f, 0.1920803970f,
+  0.9669764710f, 0.2548656596f, 0.9485613499f, 0.3165933756f,
+  0.9262102421f, 0.3770074102f, 0.9000158920f, 0.4358570799f,
+  0.9978253504f, 0.0659133528f, 0.9913108598f, 0.1315400287f,
+  0.9804848618f, 0.1965945977f, 0.9653944417f, 0.2607941179f,
+  0.9461052324f, 0.3238593665f, 0.9227011283f, 0.3855160538f,
+  0.8952839210f, 0.4454960165f, 0.9977230666f, 0.0674439196f,
+  0.9909026354f, 0.1345807085f, 0.9795697657f, 0.2011046348f,
+  0.9637760658f, 0.2667127575f, 0.9435934582f, 0.3311063058f,
+  0.9191138517f, 0.3939920401f, 0.8904487232f, 0.4550835871f,
+  0.9976184351f, 0.0689743276f, 0.9904850843f, 0.1376201216f,
+  0.9786339244f, 0.2056104131f, 0.9621214043f, 0.2726213554f,
+  0.9410261751f, 0.3383337670f, 0.9154487161f, 0.4024346509f,
+  0.8855108561f, 0.4646186863f, 0.9975114561f, 0.0705045734f,
+  0.9900582103f, 0.1406582393f, 0.9776773578f, 0.2101118369f,
+  0.9604305194f, 0.2785196894f, 0.9384035341f, 0.3455413250f,
+  0.9117060320f, 0.4108431711f, 0.8804708891f, 0.4741002147f,
+  0.9974021299f, 0.0720346532f, 0.9896220175f, 0.1436950332f,
+  0.9767000861f, 0.2146088110f, 0.9587034749f, 0.2844075372f,
+  0.9357256895f, 0.3527285558f, 0.9078861165f, 0.4192168884f,
+  0.8753294031f, 0.4835270789f, 0.9972904567f, 0.0735645636f,
+  0.9891765100f, 0.1467304745f, 0.9757021300f, 0.2191012402f,
+  0.9569403357f, 0.2902846773f, 0.9329927988f, 0.3598950365f,
+  0.9039892931f, 0.4275550934f, 0.8700869911f, 0.4928981922f,
+  0.9971764367f, 0.0750943008f, 0.9887216920f, 0.1497645347f,
+  0.9746835107f, 0.2235890292f, 0.9551411683f, 0.2961508882f,
+  0.9302050229f, 0.3670403457f, 0.9000158920f, 0.4358570799f,
+  0.8647442575f, 0.5022124740f, 0.9970600703f, 0.0766238614f,
+  0.9882575677f, 0.1527971853f, 0.9736442497f, 0.2280720832f,
+  0.9533060404f, 0.3020059493f, 0.9273625257f, 0.3741640630f,
+  0.8959662498f, 0.4441221446f, 0.8593018184f, 0.5114688504f,
+  0.9969413578f, 0.0781532416f, 0.9877841416f, 0.1558283977f,
+  0.9725843689f, 0.2325503070f, 0.9514350210f, 0.3078496400f,
+  0.9244654743f, 0.3812657692f, 0.8918407094f, 0.4523495872f,
+  0.8537603011f, 0.5206662541f, 0.9968202993f, 0.0796824380f,
+  0.9873014182f, 0.1588581433f, 0.9715038910f, 0.2370236060f,
+  0.9495281806f, 0.3136817404f, 0.9215140393f, 0.3883450467f,
+  0.8876396204f, 0.4605387110f, 0.8481203448f, 0.5298036247f,
+  0.9966968952f, 0.0812114468f, 0.9868094018f, 0.1618863938f,
+  0.9704028387f, 0.2414918853f, 0.9475855910f, 0.3195020308f,
+  0.9185083943f, 0.3954014789f, 0.8833633387f, 0.4686888220f,
+  0.8423825996f, 0.5388799085f, 0.9965711458f, 0.0827402645f,
+  0.9863080972f, 0.1649131205f, 0.9692812354f, 0.2459550503f,
+  0.9456073254f, 0.3253102922f, 0.9154487161f, 0.4024346509f,
+  0.8790122264f, 0.4767992301f, 0.8365477272f, 0.5478940592f,
+  0.9964430514f, 0.0842688876f, 0.9857975092f, 0.1679382950f,
+  0.9681391047f, 0.2504130066f, 0.9435934582f, 0.3311063058f,
+  0.9123351846f, 0.4094441487f, 0.8745866523f, 0.4848692480f,
+  0.8306164003f, 0.5568450373f, 0.9963126122f, 0.0857973123f,
+  0.9852776424f, 0.1709618888f, 0.9669764710f, 0.2548656596f,
+  0.9415440652f, 0.3368898534f, 0.9091679831f, 0.4164295601f,
+  0.8700869911f, 0.4928981922f, 0.8245893028f, 0.5657318108f,
+  0.9961798286f, 0.0873255352f, 0.9847485018f, 0.1739838734f,
+  0.9657933589f, 0.2593129151f, 0.9394592236f, 0.3426607173f,
+  0.9059472978f, 0.4233904741f, 0.8655136241f, 0.5008853826f,
+  0.8184671296f, 0.5745533550f, 0.9960447009f, 0.0888535526f,
+  0.9842100924f, 0.1770042204f, 0.9645897933f, 0.2637546790f,
+  0.9373390119f, 0.3484186802f, 0.9026733182f, 0.4303264813f,
+  0.8608669386f, 0.5088301425f, 0.8122505866f, 0.5833086529f,
+  0.9959072294f, 0.0903813609f, 0.9836624192f, 0.1800229014f,
+  0.9633657998f, 0.2681908571f, 0.9351835099f, 0.3541635254f,
+  0.8993462370f, 0.4372371737f, 0.8561473284f, 0.5167317990f,
+  0.8059403906f, 0.5919966950f, 0.9957674145f, 0.0919089565f,
+  0.9831054874f, 0.1830398880f, 0.9621214043f, 0.2726213554f,
+  0.9329927988f, 0.3598950365f, 0.8959662498f, 0.4441221446f,
+  0.8513551931f, 0.5245896827f, 0.7995372691f, 0.6006164794f,
+  0.9956252564f, 0.0934363358f, 0.9825393023f, 0.1860551517f,
+  0.9608566331f, 0.2770460803f, 0.9307669611f, 0.3656129978f,
+  0.8925335554f, 0.4509809890f, 0.8464909388f, 0.5324031279f,
+  0.7930419605f, 0.6091670123f, 0.9954807555f, 0.0949634953f,
+  0.9819638691f, 0.1890686641f, 0.9595715131f, 0.2814649379f,
+  0.9285060805f, 0.3713171940f, 0.8890483559f, 0.4578133036f,
+  0.8415549774f, 0.5401714727f, 0.7864552136f, 0.6176473079f,
+  0.9953339121f, 0.0964904314f, 0.9813791933f, 0.1920803970f,
+  0.9582660714f, 0.2858778347f, 0.9262102421f, 0.3770074102f,
+  0.8855108561f, 0.4646186863f, 0.8365477272f, 0.5478940592f,
+  0.7797777879f, 0.6260563884f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.9950331994f, 0.0995436187f, 0.9801821360f, 0.1980984107f,
+  0.9555943341f, 0.2946853722f, 0.9215140393f, 0.3883450467f,
+  0.8782797917f, 0.4781470564f, 0.8263210628f, 0.5631993440f,
+  0.7661539902f, 0.6426570340f, 0.9948793308f, 0.1010698628f,
+  0.9795697657f, 0.2011046348f, 0.9542280951f, 0.2990798263f,
+  0.9191138517f, 0.3939920401f, 0.8745866523f, 0.4848692480f,
+  0.8211025150f, 0.5707807459f, 0.7592091890f, 0.6508466850f,
+  0.9947231211f, 0.1025958690f, 0.9789481753f, 0.2041089661f,
+  0.9528416476f, 0.3034679466f, 0.9166790599f, 0.3996241998f,
+  0.8708420635f, 0.4915629161f, 0.8158144108f, 0.5783137964f,
+  0.7521768504f, 0.6589612930f, 0.9945645707f, 0.1041216339f,
+  0.9783173707f, 0.2071113762f, 0.9514350210f, 0.3078496400f,
+  0.9142097557f, 0.4052413140f, 0.8670462455f, 0.4982276670f,
+  0.8104571983f, 0.5857978575f, 0.7450577854f, 0.6669999223f,
+  0.9944036801f, 0.1056471537f, 0.9776773578f, 0.2101118369f,
+  0.9500082450f, 0.3122248139f, 0.9117060320f, 0.4108431711f,
+  0.8631994217f, 0.5048631085f, 0.8050313311f, 0.5932322950f,
+  0.7378528148f, 0.6749616461f, 0.9942404495f, 0.1071724250f,
+  0.9770281427f, 0.2131103199f, 0.9485613499f, 0.3165933756f,
+  0.9091679831f, 0.4164295601f, 0.8593018184f, 0.5114688504f,
+  0.7995372691f, 0.6006164794f, 0.7305627692f, 0.6828455464f,
+  0.9940748793f, 0.1086974440f, 0.9763697313f, 0.2161067971f,
+  0.9470943664f, 0.3209552324f, 0.9065957045f, 0.4220002708f,
+  0.8553536647f, 0.5180445041f, 0.7939754776f, 0.6079497850f,
+  0.7231884893f, 0.6906507141f, 0.9939069700f, 0.1102222073f,
+  0.9757021300f, 0.2191012402f, 0.9456073254f, 0.3253102922f,
+  0.9039892931f, 0.4275550934f, 0.8513551931f, 0.5245896827f,
+  0.7883464276f, 0.6152315906f, 0.7157308253f, 0.6983762494f,
+  0.9937367219f, 0.1117467112f, 0.9750253451f, 0.2220936210f,
+  0.9441002585f, 0.3296584625f, 0.9013488470f, 0.4330938189f,
+  0.8473066387f, 0.5311040012f, 0.7826505962f, 0.6224612794f,
+  0.7081906370f, 0.7060212614f, 0.9935641355f, 0.1132709522f,
+  0.9743393828f, 0.2250839114f, 0.9425731976f, 0.3339996514f,
+  0.8986744657f, 0.4386162385f, 0.8432082396f, 0.5375870763f,
+  0.7768884657f, 0.6296382389f, 0.7005687939f, 0.7135848688f,
+  0.9933892111f, 0.1147949266f, 0.9736442497f, 0.2280720832f,
+  0.9410261751f, 0.3383337670f, 0.8959662498f, 0.4441221446f,
+  0.8390602371f, 0.5440385267f, 0.7710605243f, 0.6367618612f,
+  0.6928661748f, 0.7210661993f, 0.9932119492f, 0.1163186309f,
+  0.9729399522f, 0.2310581083f, 0.9394592236f, 0.3426607173f,
+  0.8932243012f, 0.4496113297f, 0.8348628750f, 0.5504579729f,
+  0.7651672656f, 0.6438315429f, 0.6850836678f, 0.7284643904f,
+  0.9930323502f, 0.1178420615f, 0.9722264971f, 0.2340419586f,
+  0.9378723764f, 0.3469804108f, 0.8904487232f, 0.4550835871f,
+  0.8306164003f, 0.5568450373f, 0.7592091890f, 0.6508466850f,
+  0.6772221701f, 0.7357785892f, 0.9928504145f, 0.1193652148f,
+  0.9715038910f, 0.2370236060f, 0.9362656672f, 0.3512927561f,
+  0.8876396204f, 0.4605387110f, 0.8263210628f, 0.5631993440f,
+  0.7531867990f, 0.6578066933f, 0.6692825883f, 0.7430079521f,
+  0.9926661424f, 0.1208880872f, 0.9707721407f, 0.2400030224f,
+  0.9346391298f, 0.3555976617f, 0.8847970984f, 0.4659764958f,
+  0.8219771153f, 0.5695205193f, 0.7471006060f, 0.6647109782f,
+  0.6612658378f, 0.7501516458f, 0.9924795346f, 0.1224106752f,
+  0.9700312532f, 0.2429801799f, 0.9329927988f, 0.3598950365f,
+  0.8819212643f, 0.4713967368f, 0.8175848132f, 0.5758081914f,
+  0.7409511254f, 0.6715589548f, 0.6531728430f, 0.7572088465f,
+  0.9922905913f, 0.1239329751f, 0.9692812354f, 0.2459550503f,
+  0.9313267091f, 0.3641847896f, 0.8790122264f, 0.4767992301f,
+  0.8131444148f, 0.5820619903f, 0.7347388781f, 0.6783500431f,
+  0.6450045368f, 0.7641787405f, 0.9920993131f, 0.1254549834f,
+  0.9685220943f, 0.2489276057f, 0.9296408958f, 0.3684668300f,
+  0.8760700942f, 0.4821837721f, 0.8086561816f, 0.5882815482f,
+  0.7284643904f, 0.6850836678f, 0.6367618612f, 0.7710605243f,
+  0.9919057004f, 0.1269766965f, 0.9677538371f, 0.2518978182f,
+  0.9279353948f, 0.3727410670f, 0.8730949784f, 0.4875501601f,
+  0.8041203774f, 0.5944664992f, 0.7221281939f, 0.6917592584f,
+  0.6284457666f, 0.7778534042f, 0.9917097537f, 0.1284981108f,
+  0.9669764710f, 0.2548656596f, 0.9262102421f, 0.3770074102f,
+  0.8700869911f, 0.4928981922f, 0.7995372691f, 0.6006164794f,
+  0.7157308253f, 0.6983762494f, 0.6200572118f, 0.7845565972f,
+  0.9915114733f, 0.1300192227f, 0.9661900034f, 0.2578311022f,
+  0.9244654743f, 0.3812657692f, 0.8670462455f, 0.4982276670f,
+  0.7949071263f, 0.6067311270f, 0.7092728264f, 0.7049340804f,
+  0.6115971639f, 0.7911693302f, 0.9913108598f, 0.1315400287f,
+  0.9653944417f, 0.2607941179f, 0.9227011283f, 0.3855160538f,
+  0.8639728561f, 0.5035383837f, 0.7902302214f, 0.6128100824f,
+  0.7027547445f, 0.7114321957f, 0.6030665985f, 0.7976908409f,
+  0.9911079137f, 0.1330605252f, 0.9645897933f, 0.2637546790f,
+  0.9209172415f, 0.3897581741f, 0.8608669386f, 0.5088301425f,
+  0.7855068296f, 0.6188529880f, 0.6961771315f, 0.7178700451f,
+  0.5944664992f, 0.8041203774f, 0.9909026354f, 0.1345807085f,
+  0.9637760658f, 0.2667127575f, 0.9191138517f, 0.3939920401f,
+  0.8577286100f, 0.5141027442f, 0.7807372286f, 0.6248594881f,
+  0.6895405447f, 0.7242470830f, 0.5857978575f, 0.8104571983f,
+  0.9906950254f, 0.1361005752f, 0.9629532669f, 0.2696683256f,
+  0.9172909970f, 0.3982175622f, 0.8545579884f, 0.5193559902f,
+  0.7759216990f, 0.6308292296f, 0.6828455464f, 0.7305627692f,
+  0.5770616729f, 0.8167005729f, 0.9904850843f, 0.1376201216f,
+  0.9621214043f, 0.2726213554f, 0.9154487161f, 0.4024346509f,
+  0.8513551931f, 0.5245896827f, 0.7710605243f, 0.6367618612f,
+  0.6760927036f, 0.7368165689f, 0.5682589527f, 0.8228497814f,
+  0.9902728124f, 0.1391393442f, 0.9612804858f, 0.2755718193f,
+  0.9135870479f, 0.4066432169f, 0.8481203448f, 0.5298036247f,
+  0.7661539902f, 0.6426570340f, 0.6692825883f, 0.7430079521f,
+  0.5593907119f, 0.8289041148f, 0.9900582103f, 0.1406582393f,
+  0.9604305194f, 0.2785196894f, 0.9117060320f, 0.4108431711f,
+  0.8448535652f, 0.5349976199f, 0.7612023855f, 0.6485144010f,
+  0.6624157776f, 0.7491363945f, 0.5504579729f, 0.8348628750f,
+  0.9898412785f, 0.1421768035f, 0.9595715131f, 0.2814649379f,
+  0.9098057081f, 0.4150344245f, 0.8415549774f, 0.5401714727f,
+  0.7562060014f, 0.6543336178f, 0.6554928530f, 0.7552013769f,
+  0.5414617659f, 0.8407253750f, 0.9896220175f, 0.1436950332f,
+  0.9587034749f, 0.2844075372f, 0.9078861165f, 0.4192168884f,
+  0.8382247056f, 0.5453249884f, 0.7511651319f, 0.6601143421f,
+  0.6485144010f, 0.7612023855f, 0.5324031279f, 0.8464909388f,
+  0.9894004278f, 0.1452129247f, 0.9578264130f, 0.2873474595f,
+  0.9059472978f, 0.4233904741f, 0.8348628750f, 0.5504579729f,
+  0.7460800735f, 0.6658562337f, 0.6414810128f, 0.7671389119f,
+  0.5232831035f, 0.8521589016f, 0.9891765100f, 0.1467304745f,
+  0.9569403357f, 0.2902846773f, 0.9039892931f, 0.4275550934f,
+  0.8314696123f, 0.5555702330f, 0.7409511254f, 0.6715589548f,
+  0.6343932842f, 0.7730104534f, 0.5141027442f, 0.8577286100f,
+  0.9889502645f, 0.1482476790f, 0.9560452513f, 0.2932191627f,
+  0.9020121439f, 0.4317106580f, 0.8280450453f, 0.5606615762f,
+  0.7357785892f, 0.6772221701f, 0.6272518155f, 0.7788165124f,
+  0.5048631085f, 0.8631994217f, 0.9887216920f, 0.1497645347f,
+  0.9551411683f, 0.2961508882f, 0.9000158920f, 0.4358570799f,
+  0.8245893028f, 0.5657318108f, 0.7305627692f, 0.6828455464f,
+  0.6200572118f, 0.7845565972f, 0.4955652618f, 0.8685707060f,
+  0.9884907929f, 0.1512810380f, 0.9542280951f, 0.2990798263f,
+  0.8980005797f, 0.4399942713f, 0.8211025150f, 0.5707807459f,
+  0.7253039724f, 0.6884287528f, 0.6128100824f, 0.7902302214f,
+  0.4862102761f, 0.8738418435f, 0.9882575677f, 0.1527971853f,
+  0.9533060404f, 0.3020059493f, 0.8959662498f, 0.4441221446f,
+  0.8175848132f, 0.5758081914f, 0.7200025080f, 0.6939714609f,
+  0.6055110414f, 0.7958369046f, 0.4767992301f, 0.8790122264f,
+  0.9880220171f, 0.1543129730f, 0.9523750127f, 0.3049292297f,
+  0.8939129451f, 0.4482406123f, 0.8140363297f, 0.5808139581f,
+  0.7146586879f, 0.6994733446f, 0.5981607070f, 0.8013761717f,
+  0.4673332087f, 0.8840812587f, 0.9877841416f, 0.1558283977f,
+  0.9514350210f, 0.3078496400f, 0.8918407094f, 0.4523495872f,
+  0.8104571983f, 0.5857978575f, 0.7092728264f, 0.7049340804f,
+  0.5907597019f, 0.8068475535f, 0.4578133036f, 0.8890483559f,
+  0.9875439418f, 0.1573434556f, 0.9504860739f, 0.3107671527f,
+  0.8897495864f, 0.4564489824f, 0.8068475535f, 0.5907597019f,
+  0.7038452405f, 0.7103533469f, 0.5833086529f, 0.8122505866f,
+  0.4482406123f, 0.8939129451f, 0.9873014182f, 0.1588581433f,
+  0.9495281806f, 0.3136817404f, 0.8876396204f, 0.4605387110f,
+  0.8032075315f, 0.5956993045f, 0.6983762494f, 0.7157308253f,
+  0.5758081914f, 0.8175848132f, 0.4386162385f, 0.8986744657f,
+  0.9870565713f, 0.1603724572f, 0.9485613499f, 0.3165933756f,
+  0.8855108561f, 0.4646186863f, 0.7995372691f, 0.6006164794f,
+  0.6928661748f, 0.7210661993f, 0.5682589527f, 0.8228497814f,
+  0.4289412921f, 0.9033323685f, 0.9868094018f, 0.1618863938f,
+  0.9475855910f, 0.3195020308f, 0.8833633387f, 0.4686888220f,
+  0.7958369046f, 0.6055110414f, 0.6873153409f, 0.7263591551f,
+  0.5606615762f, 0.8280450453f, 0.4192168884f, 0.9078861165f,
+  0.9865599103f, 0.1633999494f, 0.9466009131f, 0.3224076788f,
+  0.8811971135f, 0.4727490320f, 0.7921065773f, 0.6103828063f,
+  0.6817240742f, 0.7316093812f, 0.5530167056f, 0.8331701647f,
+  0.4094441487f, 0.9123351846f, 0.9863080972f, 0.1649131205f,
+  0.9456073254f, 0.3253102922f, 0.8790122264f, 0.4767992301f,
+  0.7883464276f, 0.6152315906f, 0.6760927036f, 0.7368165689f,
+  0.5453249884f, 0.8382247056f, 0.3996241998f, 0.9166790599f,
+  0.9860539633f, 0.1664259035f, 0.9446048373f, 0.3282098436f,
+  0.8768087238f, 0.4808393306f, 0.7845565972f, 0.6200572118f,
+  0.6704215604f, 0.7419804117f, 0.5375870763f, 0.8432082396f,
+  0.3897581741f, 0.9209172415f, 0.9857975092f, 0.1679382950f,
+  0.9435934582f, 0.3311063058f, 0.8745866523f, 0.4848692480f,
+  0.7807372286f, 0.6248594881f, 0.6647109782f, 0.7471006060f,
+  0.5298036247f, 0.8481203448f, 0.3798472089f, 0.9250492408f,
+  0.9855387353f, 0.1694502912f, 0.9425731976f, 0.3339996514f,
+  0.8723460589f, 0.4888888969f, 0.7768884657f, 0.6296382389f,
+  0.6589612930f, 0.7521768504f, 0.5219752929f, 0.8529606049f,
+  0.3698924471f, 0.9290745813f, 0.9852776424f, 0.1709618888f,
+  0.9415440652f, 0.3368898534f, 0.8700869911f, 0.4928981922f,
+  0.7730104534f, 0.6343932842f, 0.6531728430f, 0.7572088465f,
+  0.5141027442f, 0.8577286100f, 0.3598950365f, 0.9329927988f,
+  0.9850142310f, 0.1724730840f, 0.9405060706f, 0.3397768844f,
+  0.8678094968f, 0.4968970490f, 0.7691033376f, 0.6391244449f,
+  0.6473459686f, 0.7621962981f, 0.5061866453f, 0.8624239561f,
+  0.3498561298f, 0.9368034417f, 0.9847485018f, 0.1739838734f,
+  0.9394592236f, 0.3426607173f, 0.8655136241f, 0.5008853826f,
+  0.7651672656f, 0.6438315429f, 0.6414810128f, 0.7671389119f,
+  0.4982276670f, 0.8670462455f, 0.3397768844f, 0.9405060706f,
+  0.9844804554f, 0.1754942534f, 0.9384035341f, 0.3455413250f,
+  0.8631994217f, 0.5048631085f, 0.7612023855f, 0.6485144010f,
+  0.6355783205f, 0.7720363972f, 0.4902264833f, 0.8715950867f,
+  0.3296584625f, 0.9441002585f, 0.9842100924f, 0.1770042204f,
+  0.9373390119f, 0.3484186802f, 0.8608669386f, 0.5088301425f,
+  0.7572088465f, 0.6531728430f, 0.6296382389f, 0.7768884657f,
+  0.4821837721f, 0.8760700942f, 0.3195020308f, 0.9475855910f,
+  0.9839374134f, 0.1785137709f, 0.9362656672f, 0.3512927561f,
+  0.8585162243f, 0.5127864006f, 0.7531867990f, 0.6578066933f,
+  0.6236611175f, 0.7816948321f, 0.4741002147f, 0.8804708891f,
+  0.3093087603f, 0.9509616663f, 0.9836624192f, 0.1800229014f,
+  0.9351835099f, 0.3541635254f, 0.8561473284f, 0.5167317990f,
+  0.7491363945f, 0.6624157776f, 0.6176473079f, 0.7864552136f,
+  0.4659764958f, 0.8847970984f, 0.2990798263f, 0.9542280951f,
+  0.9833851103f, 0.1815316083f, 0.9340925504f, 0.3570309612f,
+  0.8537603011f, 0.5206662541f, 0.7450577854f, 0.6669999223f,
+  0.6115971639f, 0.7911693302f, 0.4578133036f, 0.8890483559f,
+  0.2888164082f, 0.9573845008f, 0.9831054874f, 0.1830398880f,
+  0.9329927988f, 0.3598950365f, 0.8513551931f, 0.5245896827f,
+  0.7409511254f, 0.6715589548f, 0.6055110414f, 0.7958369046f,
+  0.4496113297f, 0.8932243012f, 0.2785196894f, 0.9604305194f,
+  0.9828235512f, 0.1845477369f, 0.9318842656f, 0.3627557244f,
+  0.8489320552f, 0.5285020015f, 0.7368165689f, 0.6760927036f,
+  0.5993892984f, 0.8004576622f, 0.4413712687f, 0.8973245807f,
+  0.2681908571f, 0.9633657998f, 0.9825393023f, 0.1860551517f,
+  0.9307669611f, 0.3656129978f, 0.8464909388f, 0.5324031279f,
+  0.7326542717f, 0.6806009978f, 0.5932322950f, 0.8050313311f,
+  0.4330938189f, 0.9013488470f, 0.2578311022f, 0.9661900034f,
+  0.9822527414f, 0.1875621286f, 0.9296408958f, 0.3684668300f,
+  0.8440318955f, 0.5362929791f, 0.7284643904f, 0.6850836678f,
+  0.5870403935f, 0.8095576424f, 0.4247796812f, 0.9052967593f,
+  0.2474416192f, 0.9689028048f, 0.9819638691f, 0.1890686641f,
+  0.9285060805f, 0.3713171940f, 0.8415549774f, 0.5401714727f,
+  0.7242470830f, 0.6895405447f, 0.5808139581f, 0.8140363297f,
+  0.4164295601f, 0.9091679831f, 0.2370236060f, 0.9715038910f,
+  0.9816726862f, 0.1905747548f, 0.9273625257f, 0.3741640630f,
+  0.8390602371f, 0.5440385267f, 0.7200025080f, 0.6939714609f,
+  0.5745533550f, 0.8184671296f, 0.4080441629f, 0.9129621904f,
+  0.2265782638f, 0.9739929622f, 0.9813791933f, 0.1920803970f,
+  0.9262102421f, 0.3770074102f, 0.8365477272f, 0.5478940592f,
+  0.7157308253f, 0.6983762494f, 0.5682589527f, 0.8228497814f,
+  0.3996241998f, 0.9166790599f, 0.2161067971f, 0.9763697313f,
+  0.9810833912f, 0.1935855873f, 0.9250492408f, 0.3798472089f,
+  0.8340175011f, 0.5517379884f, 0.7114321957f, 0.7027547445f,
+  0.5619311212f, 0.8271840273f, 0.3911703843f, 0.9203182767f,
+  0.2056104131f, 0.9786339244f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9804848618f, 0.1965945977f, 0.9227011283f, 0.3855160538f,
+  0.8289041148f, 0.5593907119f, 0.7027547445f, 0.7114321957f,
+  0.5491766622f, 0.8357062844f, 0.3741640630f, 0.9273625257f,
+  0.1845477369f, 0.9828235512f, 0.9801821360f, 0.1980984107f,
+  0.9215140393f, 0.3883450467f, 0.8263210628f, 0.5631993440f,
+  0.6983762494f, 0.7157308253f, 0.5427507849f, 0.8398937942f,
+  0.3656129978f, 0.9307669611f, 0.1739838734f, 0.9847485018f,
+  0.9798771037f, 0.1996017576f, 0.9203182767f, 0.3911703843f,
+  0.8237205112f, 0.5669960488f, 0.6939714609f, 0.7200025080f,
+  0.5362929791f, 0.8440318955f, 0.3570309612f, 0.9340925504f,
+  0.1633999494f, 0.9865599103f, 0.9795697657f, 0.2011046348f,
+  0.9191138517f, 0.3939920401f, 0.8211025150f, 0.5707807459f,
+  0.6895405447f, 0.7242470830f, 0.5298036247f, 0.8481203448f,
+  0.3484186802f, 0.9373390119f, 0.1527971853f, 0.9882575677f,
+  0.9792601226f, 0.2026070388f, 0.9179007756f, 0.3968099874f,
+  0.8184671296f, 0.5745533550f, 0.6850836678f, 0.7284643904f,
+  0.5232831035f, 0.8521589016f, 0.3397768844f, 0.9405060706f,
+  0.1421768035f, 0.9898412785f, 0.9789481753f, 0.2041089661f,
+  0.9166790599f, 0.3996241998f, 0.8158144108f, 0.5783137964f,
+  0.6806009978f, 0.7326542717f, 0.5167317990f, 0.8561473284f,
+  0.3311063058f, 0.9435934582f, 0.1315400287f, 0.9913108598f,
+  0.9786339244f, 0.2056104131f, 0.9154487161f, 0.4024346509f,
+  0.8131444148f, 0.5820619903f, 0.6760927036f, 0.7368165689f,
+  0.5101500967f, 0.8600853904f, 0.3224076788f, 0.9466009131f,
+  0.1208880872f, 0.9926661424f, 0.9783173707f, 0.2071113762f,
+  0.9142097557f, 0.4052413140f, 0.8104571983f, 0.5857978575f,
+  0.6715589548f, 0.7409511254f, 0.5035383837f, 0.8639728561f,
+  0.3136817404f, 0.9495281806f, 0.1102222073f, 0.9939069700f,
+  0.9779985149f, 0.2086118520f, 0.9129621904f, 0.4080441629f,
+  0.8077528179f, 0.5895213186f, 0.6669999223f, 0.7450577854f,
+  0.4968970490f, 0.8678094968f, 0.3049292297f, 0.9523750127f,
+  0.0995436187f, 0.9950331994f, 0.9776773578f, 0.2101118369f,
+  0.9117060320f, 0.4108431711f, 0.8050313311f, 0.5932322950f,
+  0.6624157776f, 0.7491363945f, 0.4902264833f, 0.8715950867f,
+  0.2961508882f, 0.9551411683f, 0.0888535526f, 0.9960447009f,
+  0.9773539001f, 0.2116113274f, 0.9104412923f, 0.4136383122f,
+  0.8022927955f, 0.5969307081f, 0.6578066933f, 0.7531867990f,
+  0.4835270789f, 0.8753294031f, 0.2873474595f, 0.9578264130f,
+  0.0781532416f, 0.9969413578f, 0.9770281427f, 0.2131103199f,
+  0.9091679831f, 0.4164295601f, 0.7995372691f, 0.6006164794f,
+  0.6531728430f, 0.7572088465f, 0.4767992301f, 0.8790122264f,
+  0.2785196894f, 0.9604305194f, 0.0674439196f, 0.9977230666f,
+  0.9767000861f, 0.2146088110f, 0.9078861165f, 0.4192168884f,
+  0.7967648102f, 0.6042895309f, 0.6485144010f, 0.7612023855f,
+  0.4700433325f, 0.8826433400f, 0.2696683256f, 0.9629532669f,
+  0.0567268212f, 0.9983897374f, 0.9763697313f, 0.2161067971f,
+  0.9065957045f, 0.4220002708f, 0.7939754776f, 0.6079497850f,
+  0.6438315429f, 0.7651672656f, 0.4632597836f, 0.8862225301f,
+  0.2607941179f, 0.9653944417f, 0.0460031821f, 0.9989412932f,
+  0.9760370790f, 0.2176042746f, 0.9052967593f, 0.4247796812f,
+  0.7911693302f, 0.6115971639f, 0.6391244449f, 0.7691033376f,
+  0.4564489824f, 0.8897495864f, 0.2518978182f, 0.9677538371f,
+  0.0352742389f, 0.9993776704f, 0.9757021300f, 0.2191012402f,
+  0.9039892931f, 0.4275550934f, 0.7883464276f, 0.6152315906f,
+  0.6343932842f, 0.7730104534f, 0.4496113297f, 0.8932243012f,
+  0.2429801799f, 0.9700312532f, 0.0245412285f, 0.9996988187f,
+  0.9753648851f, 0.2205976901f, 0.9026733182f, 0.4303264813f,
+  0.7855068296f, 0.6188529880f, 0.6296382389f, 0.7768884657f,
+  0.4427472276f, 0.8966464702f, 0.2340419586f, 0.9722264971f,
+  0.0138053885f, 0.9999047011f, 0.9750253451f, 0.2220936210f,
+  0.9013488470f, 0.4330938189f, 0.7826505962f, 0.6224612794f,
+  0.6248594881f, 0.7807372286f, 0.4358570799f, 0.9000158920f,
+  0.2250839114f, 0.9743393828f, 0.0030679568f, 0.9999952938f,
+  0.9746835107f, 0.2235890292f, 0.9000158920f, 0.4358570799f,
+  0.7797777879f, 0.6260563884f, 0.6200572118f, 0.7845565972f,
+  0.4289412921f, 0.9033323685f, 0.2161067971f, 0.9763697313f,
+  -0.0076698287f, 0.9999705864f, 0.9743393828f, 0.2250839114f,
+  0.8986744657f, 0.4386162385f, 0.7768884657f, 0.6296382389f,
+  0.6152315906f, 0.7883464276f, 0.4220002708f, 0.9065957045f,
+  0.2071113762f, 0.9783173707f, -0.0184067299f, 0.9998305818f,
+  0.9739929622f, 0.2265782638f, 0.8973245807f, 0.4413712687f,
+  0.7739826906f, 0.6332067551f, 0.6103828063f, 0.7921065773f,
+  0.4150344245f, 0.9098057081f, 0.1980984107f, 0.9801821360f,
+  -0.0291415088f, 0.9995752960f, 0.9736442497f, 0.2280720832f,
+  0.8959662498f, 0.4441221446f, 0.7710605243f, 0.6367618612f,
+  0.6055110414f, 0.7958369046f, 0.4080441629f, 0.9129621904f,
+  0.1890686641f, 0.9819638691f, -0.0398729276f, 0.9992047586f,
+  0.9732932461f, 0.2295653658f, 0.8945994856f, 0.4468688402f,
+  0.7681220285f, 0.6403034822f, 0.6006164794f, 0.7995372691f,
+  0.4010298972f, 0.9160649658f, 0.1800229014f, 0.9836624192f,
+  -0.0505997490f, 0.9987190122f, 0.9729399522f, 0.2310581083f,
+  0.8932243012f, 0.4496113297f, 0.7651672656f, 0.6438315429f,
+  0.5956993045f, 0.8032075315f, 0.3939920401f, 0.9191138517f,
+  0.1709618888f, 0.9852776424f, -0.0613207363f, 0.9981181129f,
+  0.9725843689f, 0.2325503070f, 0.8918407094f, 0.4523495872f,
+  0.7621962981f, 0.6473459686f, 0.5907597019f, 0.8068475535f,
+  0.3869310055f, 0.9221086687f, 0.1618863938f, 0.9868094018f,
+  -0.0720346532f, 0.9974021299f, 0.9722264971f, 0.2340419586f,
+  0.8904487232f, 0.4550835871f, 0.7592091890f, 0.6508466850f,
+  0.5857978575f, 0.8104571983f, 0.3798472089f, 0.9250492408f,
+  0.1527971853f, 0.9882575677f, -0.0827402645f, 0.9965711458f,
+  0.9718663375f, 0.2355330594f, 0.8890483559f, 0.4578133036f,
+  0.7562060014f, 0.6543336178f, 0.5808139581f, 0.8140363297f,
+  0.3727410670f, 0.9279353948f, 0.1436950332f, 0.9896220175f,
+  -0.0934363358f, 0.9956252564f, 0.9715038910f, 0.2370236060f,
+  0.8876396204f, 0.4605387110f, 0.7531867990f, 0.6578066933f,
+  0.5758081914f, 0.8175848132f, 0.3656129978f, 0.9307669611f,
+  0.1345807085f, 0.9909026354f, -0.1041216339f, 0.9945645707f,
+  0.9711391584f, 0.2385135948f, 0.8862225301f, 0.4632597836f,
+  0.7501516458f, 0.6612658378f, 0.5707807459f, 0.8211025150f,
+  0.3584634206f, 0.9335437730f, 0.1254549834f, 0.9920993131f,
+  -0.1147949266f, 0.9933892111f, 0.9707721407f, 0.2400030224f,
+  0.8847970984f, 0.4659764958f, 0.7471006060f, 0.6647109782f,
+  0.5657318108f, 0.8245893028f, 0.3512927561f, 0.9362656672f,
+  0.1163186309f, 0.9932119492f, -0.1254549834f, 0.9920993131f,
+  0.9704028387f, 0.2414918853f, 0.8833633387f, 0.4686888220f,
+  0.7440337442f, 0.6681420414f, 0.5606615762f, 0.8280450453f,
+  0.3441014260f, 0.9389324835f, 0.1071724250f, 0.9942404495f,
+  -0.1361005752f, 0.9906950254f, 0.9700312532f, 0.2429801799f,
+  0.8819212643f, 0.4713967368f, 0.7409511254f, 0.6715589548f,
+  0.5555702330f, 0.8314696123f, 0.3368898534f, 0.9415440652f,
+  0.0980171403f, 0.9951847267f, -0.1467304745f, 0.9891765100f,
+  0.9696573851f, 0.2444679027f, 0.8804708891f, 0.4741002147f,
+  0.7378528148f, 0.6749616461f, 0.5504579729f, 0.8348628750f,
+  0.3296584625f, 0.9441002585f, 0.0888535526f, 0.9960447009f,
+  -0.1573434556f, 0.9875439418f, 0.9692812354f, 0.2459550503f,
+  0.8790122264f, 0.4767992301f, 0.7347388781f, 0.6783500431f,
+  0.5453249884f, 0.8382247056f, 0.3224076788f, 0.9466009131f,
+  0.0796824380f, 0.9968202993f, -0.1679382950f, 0.9857975092f,
+  0.9689028048f, 0.2474416192f, 0.8775452902f, 0.4794937577f,
+  0.7316093812f, 0.6817240742f, 0.5401714727f, 0.8415549774f,
+  0.3151379288f, 0.9490458819f, 0.0705045734f, 0.9975114561f,
+  -0.1785137709f, 0.9839374134f, 0.9685220943f, 0.2489276057f,
+  0.8760700942f, 0.4821837721f, 0.7284643904f, 0.6850836678f,
+  0.5349976199f, 0.8448535652f, 0.3078496400f, 0.9514350210f,
+  0.0613207363f, 0.9981181129f, -0.1890686641f, 0.9819638691f,
+  0.9681391047f, 0.2504130066f, 0.8745866523f, 0.4848692480f,
+  0.7253039724f, 0.6884287528f, 0.5298036247f, 0.8481203448f,
+  0.3005432414f, 0.9537681899f, 0.0521317047f, 0.9986402182f,
+  -0.1996017576f, 0.9798771037f, 0.9677538371f, 0.2518978182f,
+  0.8730949784f, 0.4875501601f, 0.7221281939f, 0.6917592584f,
+  0.5245896827f, 0.8513551931f, 0.2932191627f, 0.9560452513f,
+  0.0429382569f, 0.9990777278f, -0.2101118369f, 0.9776773578f,
+  0.9673662922f, 0.2533820370f, 0.8715950867f, 0.4902264833f,
+  0.7189371224f, 0.6950751140f, 0.5193559902f, 0.8545579884f,
+  0.2858778347f, 0.9582660714f, 0.0337411719f, 0.9994306046f,
+  -0.2205976901f, 0.9753648851f, 0.9669764710f, 0.2548656596f,
+  0.8700869911f, 0.4928981922f, 0.7157308253f, 0.6983762494f,
+  0.5141027442f, 0.8577286100f, 0.2785196894f, 0.9604305194f,
+  0.0245412285f, 0.9996988187f, -0.2310581083f, 0.9729399522f,
+  0.9665843745f, 0.2563486825f, 0.8685707060f, 0.4955652618f,
+  0.7125093706f, 0.7016625947f, 0.5088301425f, 0.8608669386f,
+  0.2711451595f, 0.9625384680f, 0.0153392063f, 0.9998823475f,
+  -0.2414918853f, 0.9704028387f, 0.9661900034f, 0.2578311022f,
+  0.8670462455f, 0.4982276670f, 0.7092728264f, 0.7049340804f,
+  0.5035383837f, 0.8639728561f, 0.2637546790f, 0.9645897933f,
+  0.0061358846f, 0.9999811753f, -0.2518978182f, 0.9677538371f,
+  0.9657933589f, 0.2593129151f, 0.8655136241f, 0.5008853826f,
+  0.7060212614f, 0.7081906370f, 0.4982276670f, 0.8670462455f,
+  0.2563486825f, 0.9665843745f, -0.0030679568f, 0.9999952938f,
+  -0.2622747070f, 0.9649932529f, 0.9653944417f, 0.2607941179f,
+  0.8639728561f, 0.5035383837f, 0.7027547445f, 0.7114321957f,
+  0.4928981922f, 0.8700869911f, 0.2489276057f, 0.9685220943f,
+  -0.0122715383f, 0.9999247018f, -0.2726213554f, 0.9621214043f,
+  0.9649932529f, 0.2622747070f, 0.8624239561f, 0.5061866453f,
+  0.6994733446f, 0.7146586879f, 0.4875501601f, 0.8730949784f,
+  0.2414918853f, 0.9704028387f, -0.0214740803f, 0.9997694054f,
+  -0.2829365705f, 0.9591386225f, 0.9645897933f, 0.2637546790f,
+  0.8608669386f, 0.5088301425f, 0.6961771315f, 0.7178700451f,
+  0.4821837721f, 0.8760700942f, 0.2340419586f, 0.9722264971f,
+  -0.0306748032f, 0.9995294175f, -0.2932191627f, 0.9560452513f,
+  0.9641840640f, 0.2652340303f, 0.8593018184f, 0.5114688504f,
+  0.6928661748f, 0.7210661993f, 0.4767992301f, 0.8790122264f,
+  0.2265782638f, 0.9739929622f, -0.0398729276f, 0.9992047586f,
+  -0.3034679466f, 0.9528416476f, 0.9637760658f, 0.2667127575f,
+  0.8577286100f, 0.5141027442f, 0.6895405447f, 0.7242470830f,
+  0.4713967368f, 0.8819212643f, 0.2191012402f, 0.9757021300f,
+  -0.0490676743f, 0.9987954562f, -0.3136817404f, 0.9495281806f,
+  0.9633657998f, 0.2681908571f, 0.8561473284f, 0.5167317990f,
+  0.6862003117f, 0.7274126286f, 0.4659764958f, 0.8847970984f,
+  0.2116113274f, 0.9773539001f, -0.0582582645f, 0.9983015449f,
+  -0.3238593665f, 0.9461052324f, 0.9629532669f, 0.2696683256f,
+  0.8545579884f, 0.5193559902f, 0.6828455464f, 0.7305627692f,
+  0.4605387110f, 0.8876396204f, 0.2041089661f, 0.9789481753f,
+  -0.0674439196f, 0.9977230666f, -0.3339996514f, 0.9425731976f,
+  0.9625384680f, 0.2711451595f, 0.8529606049f, 0.5219752929f,
+  0.6794763199f, 0.7336974381f, 0.4550835871f, 0.8904487232f,
+  0.1965945977f, 0.9804848618f, -0.0766238614f, 0.9970600703f,
+  -0.3441014260f, 0.9389324835f, 0.9621214043f, 0.2726213554f,
+  0.8513551931f, 0.5245896827f, 0.6760927036f, 0.7368165689f,
+  0.4496113297f, 0.8932243012f, 0.1890686641f, 0.9819638691f,
+  -0.0857973123f, 0.9963126122f, -0.3541635254f, 0.9351835099f,
+  0.9617020765f, 0.2740969099f, 0.8497417680f, 0.5271991348f,
+  0.6726947691f, 0.7399200955f, 0.4441221446f, 0.8959662498f,
+  0.1815316083f, 0.9833851103f, -0.0949634953f, 0.9954807555f,
+  -0.3641847896f, 0.9313267091f, 0.9612804858f, 0.2755718193f,
+  0.8481203448f, 0.5298036247f, 0.6692825883f, 0.7430079521f,
+  0.4386162385f, 0.8986744657f, 0.1739838734f, 0.9847485018f,
+  -0.1041216339f, 0.9945645707f, -0.3741640630f, 0.9273625257f,
+  0.9608566331f, 0.2770460803f, 0.8464909388f, 0.5324031279f,
+  0.6658562337f, 0.7460800735f, 0.4330938189f, 0.9013488470f,
+  0.1664259035f, 0.9860539633f, -0.1132709522f, 0.9935641355f,
+  -0.3841001950f, 0.9232914167f, 0.9604305194f, 0.2785196894f,
+  0.8448535652f, 0.5349976199f, 0.6624157776f, 0.7491363945f,
+  0.4275550934f, 0.9039892931f, 0.1588581433f, 0.9873014182f,
+  -0.1224106752f, 0.9924795346f, -0.3939920401f, 0.9191138517f,
+  0.9600021457f, 0.2799926431f, 0.8432082396f, 0.5375870763f,
+  0.6589612930f, 0.7521768504f, 0.4220002708f, 0.9065957045f,
+  0.1512810380f, 0.9884907929f, -0.1315400287f, 0.9913108598f,
+  -0.4038384576f, 0.9148303122f, 0.9595715131f, 0.2814649379f,
+  0.8415549774f, 0.5401714727f, 0.6554928530f, 0.7552013769f,
+  0.4164295601f, 0.9091679831f, 0.1436950332f, 0.9896220175f,
+  -0.1406582393f, 0.9900582103f, -0.4136383122f, 0.9104412923f,
+  0.9591386225f, 0.2829365705f, 0.8398937942f, 0.5427507849f,
+  0.6520105311f, 0.7582099098f, 0.4108431711f, 0.9117060320f,
+  0.1361005752f, 0.9906950254f, -0.1497645347f, 0.9887216920f,
+  -0.4233904741f, 0.9059472978f, 0.9587034749f, 0.2844075372f,
+  0.8382247056f, 0.5453249884f, 0.6485144010f, 0.7612023855f,
+  0.4052413140f, 0.9142097557f, 0.1284981108f, 0.9917097537f,
+  -0.1588581433f, 0.9873014182f, -0.4330938189f, 0.9013488470f,
+  0.9582660714f, 0.2858778347f, 0.8365477272f, 0.5478940592f,
+  0.6450045368f, 0.7641787405f, 0.3996241998f, 0.9166790599f,
+  0.1208880872f, 0.9926661424f, -0.1679382950f, 0.9857975092f,
+  -0.4427472276f, 0.8966464702f, 0.9578264130f, 0.2873474595f,
+  0.8348628750f, 0.5504579729f, 0.6414810128f, 0.7671389119f,
+  0.3939920401f, 0.9191138517f, 0.1132709522f, 0.9935641355f,
+  -0.1770042204f, 0.9842100924f, -0.4523495872f, 0.8918407094f,
+  0.9573845008f, 0.2888164082f, 0.8331701647f, 0.5530167056f,
+  0.6379439036f, 0.7700828370f, 0.3883450467f, 0.9215140393f,
+  0.1056471537f, 0.9944036801f, -0.1860551517f, 0.9825393023f,
+  -0.4618997907f, 0.8869321188f, 0.9569403357f, 0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.6343932842f, 0.7730104534f,
+  0.3826834324f, 0.9238795325f, 0.0980171403f, 0.9951847267f,
+  -0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  0.9564939189f, 0.2917522632f, 0.8297612338f, 0.5581185312f,
+  0.6308292296f, 0.7759216990f, 0.3770074102f, 0.9262102421f,
+  0.0903813609f, 0.9959072294f, -0.2041089661f, 0.9789481753f,
+  -0.4808393306f, 0.8768087238f, 0.9560452513f, 0.2932191627f,
+  0.8280450453f, 0.5606615762f, 0.6272518155f, 0.7788165124f,
+  0.3713171940f, 0.9285060805f, 0.0827402645f, 0.9965711458f,
+  -0.2131103199f, 0.9770281427f, -0.4902264833f, 0.8715950867f,
+  0.9555943341f, 0.2946853722f, 0.8263210628f, 0.5631993440f,
+  0.6236611175f, 0.7816948321f, 0.3656129978f, 0.9307669611f,
+  0.0750943008f, 0.9971764367f, -0.2220936210f, 0.9750253451f,
+  -0.4995571125f, 0.8662809540f, 0.9551411683f, 0.2961508882f,
+  0.8245893028f, 0.5657318108f, 0.6200572118f, 0.7845565972f,
+  0.3598950365f, 0.9329927988f, 0.0674439196f, 0.9977230666f,
+  -0.2310581083f, 0.9729399522f, -0.5088301425f, 0.8608669386f,
+  0.9546857549f, 0.2976157074f, 0.8228497814f, 0.5682589527f,
+  0.6164401745f, 0.7874017470f, 0.3541635254f, 0.9351835099f,
+  0.0597895707f, 0.9982110034f, -0.2400030224f, 0.9707721407f,
+  -0.5180445041f, 0.8553536647f, 0.9542280951f, 0.2990798263f,
+  0.8211025150f, 0.5707807459f, 0.6128100824f, 0.7902302214f,
+  0.3484186802f, 0.9373390119f, 0.0521317047f, 0.9986402182f,
+  -0.2489276057f, 0.9685220943f, -0.5271991348f, 0.8497417680f,
+  0.9537681899f, 0.3005432414f, 0.8193475201f, 0.5732971667f,
+  0.6091670123f, 0.7930419605f, 0.3426607173f, 0.9394592236f,
+  0.0444707719f, 0.9990106859f, -0.2578311022f, 0.9661900034f,
+  -0.5362929791f, 0.8440318955f, 0.9533060404f, 0.3020059493f,
+  0.8175848132f, 0.5758081914f, 0.6055110414f, 0.7958369046f,
+  0.3368898534f, 0.9415440652f, 0.0368072229f, 0.9993223846f,
+  -0.2667127575f, 0.9637760658f, -0.5453249884f, 0.8382247056f,
+  0.9528416476f, 0.3034679466f, 0.8158144108f, 0.5783137964f,
+  0.6018422471f, 0.7986149946f, 0.3311063058f, 0.9435934582f,
+  0.0291415088f, 0.9995752960f, -0.2755718193f, 0.9612804858f,
+  -0.5542941215f, 0.8323208678f, 0.9523750127f, 0.3049292297f,
+  0.8140363297f, 0.5808139581f, 0.5981607070f, 0.8013761717f,
+  0.3253102922f, 0.9456073254f, 0.0214740803f, 0.9997694054f,
+  -0.2844075372f, 0.9587034749f, -0.5631993440f, 0.8263210628f,
+  0.9519061368f, 0.3063897954f, 0.8122505866f, 0.5833086529f,
+  0.5944664992f, 0.8041203774f, 0.3195020308f, 0.9475855910f,
+  0.0138053885f, 0.9999047011f, -0.2932191627f, 0.9560452513f,
+  -0.5720396293f, 0.8202259826f, 0.9514350210f, 0.3078496400f,
+  0.8104571983f, 0.5857978575f, 0.5907597019f, 0.8068475535f,
+  0.3136817404f, 0.9495281806f, 0.0061358846f, 0.9999811753f,
+  -0.3020059493f, 0.9533060404f, -0.5808139581f, 0.8140363297f,
+  0.9509616663f, 0.3093087603f, 0.8086561816f, 0.5882815482f,
+  0.5870403935f, 0.8095576424f, 0.3078496400f, 0.9514350210f,
+  -0.0015339802f, 0.9999988235f, -0.3107671527f, 0.9504860739f,
+  -0.5895213186f, 0.8077528179f, 0.9504860739f, 0.3107671527f,
+  0.8068475535f, 0.5907597019f, 0.5833086529f, 0.8122505866f,
+  0.3020059493f, 0.9533060404f, -0.0092037548f, 0.9999576446f,
+  -0.3195020308f, 0.9475855910f, -0.5981607070f, 0.8013761717f,
+  0.9500082450f, 0.3122248139f, 0.8050313311f, 0.5932322950f,
+  0.5795645591f, 0.8149263291f, 0.2961508882f, 0.9551411683f,
+  -0.0168729879f, 0.9998576410f, -0.3282098436f, 0.9446048373f,
+  -0.6067311270f, 0.7949071263f, 0.9495281806f, 0.3136817404f,
+  0.8032075315f, 0.5956993045f, 0.5758081914f, 0.8175848132f,
+  0.2902846773f, 0.9569403357f, -0.0245412285f, 0.9996988187f,
+  -0.3368898534f, 0.9415440652f, -0.6152315906f, 0.7883464276f,
+  0.9490458819f, 0.3151379288f, 0.8013761717f, 0.5981607070f,
+  0.5720396293f, 0.8202259826f, 0.2844075372f, 0.9587034749f,
+  -0.0322080254f, 0.9994811870f, -0.3455413250f, 0.9384035341f,
+  -0.6236611175f, 0.7816948321f, 0.9485613499f, 0.3165933756f,
+  0.7995372691f, 0.6006164794f, 0.5682589527f, 0.8228497814f,
+  0.2785196894f, 0.9604305194f, -0.0398729276f, 0.9992047586f,
+  -0.3541635254f, 0.9351835099f, -0.6320187359f, 0.7749531066f,
+  0.9480745859f, 0.3180480774f, 0.7976908409f, 0.6030665985f,
+  0.5644662415f, 0.8254561540f, 0.2726213554f, 0.9621214043f,
+  -0.0475354842f, 0.9988695499f, -0.3627557244f, 0.9318842656f,
+  -0.6403034822f, 0.7681220285f, 0.9475855910f, 0.3195020308f,
+  0.7958369046f, 0.6055110414f, 0.5606615762f, 0.8280450453f,
+  0.2667127575f, 0.9637760658f, -0.0551952443f, 0.9984755806f,
+  -0.3713171940f, 0.9285060805f, -0.6485144010f, 0.7612023855f,
+  0.9470943664f, 0.3209552324f, 0.7939754776f, 0.6079497850f,
+  0.5568450373f, 0.8306164003f, 0.2607941179f, 0.9653944417f,
+  -0.0628517576f, 0.9980228738f, -0.3798472089f, 0.9250492408f,
+  -0.6566505457f, 0.7541949753f, 0.9466009131f, 0.3224076788f,
+  0.7921065773f, 0.6103828063f, 0.5530167056f, 0.8331701647f,
+  0.2548656596f, 0.9669764710f, -0.0705045734f, 0.9975114561f,
+  -0.3883450467f, 0.9215140393f, -0.6647109782f, 0.7471006060f,
+  0.9461052324f, 0.3238593665f, 0.7902302214f, 0.6128100824f,
+  0.5491766622f, 0.8357062844f, 0.2489276057f, 0.9685220943f,
+  -0.0781532416f, 0.9969413578f, -0.3968099874f, 0.9179007756f,
+  -0.6726947691f, 0.7399200955f, 0.9456073254f, 0.3253102922f,
+  0.7883464276f, 0.6152315906f, 0.5453249884f, 0.8382247056f,
+  0.2429801799f, 0.9700312532f, -0.0857973123f, 0.9963126122f,
+  -0.4052413140f, 0.9142097557f, -0.6806009978f, 0.7326542717f,
+  0.9451071933f, 0.3267604523f, 0.7864552136f, 0.6176473079f,
+  0.5414617659f, 0.8407253750f, 0.2370236060f, 0.9715038910f,
+  -0.0934363358f, 0.9956252564f, -0.4136383122f, 0.9104412923f,
+  -0.6884287528f, 0.7253039724f, 0.9446048373f, 0.3282098436f,
+  0.7845565972f, 0.6200572118f, 0.5375870763f, 0.8432082396f,
+  0.2310581083f, 0.9729399522f, -0.1010698628f, 0.9948793308f,
+  -0.4220002708f, 0.9065957045f, -0.6961771315f, 0.7178700451f,
+  0.9441002585f, 0.3296584625f, 0.7826505962f, 0.6224612794f,
+  0.5337010018f, 0.8456732470f, 0.2250839114f, 0.9743393828f,
+  -0.1086974440f, 0.9940748793f, -0.4303264813f, 0.9026733182f,
+  -0.7038452405f, 0.7103533469f, 0.9435934582f, 0.3311063058f,
+  0.7807372286f, 0.6248594881f, 0.5298036247f, 0.8481203448f,
+  0.2191012402f, 0.9757021300f, -0.1163186309f, 0.9932119492f,
+  -0.4386162385f, 0.8986744657f, -0.7114321957f, 0.7027547445f,
+  0.9430844375f, 0.3325533699f, 0.7788165124f, 0.6272518155f,
+  0.5258950275f, 0.8505494813f, 0.2131103199f, 0.9770281427f,
+  -0.1239329751f, 0.9922905913f, -0.4468688402f, 0.8945994856f,
+  -0.7189371224f, 0.6950751140f, 0.9425731976f, 0.3339996514f,
+  0.7768884657f, 0.6296382389f, 0.5219752929f, 0.8529606049f,
+  0.2071113762f, 0.9783173707f, -0.1315400287f, 0.9913108598f,
+  -0.4550835871f, 0.8904487232f, -0.7263591551f, 0.6873153409f,
+  0.9420597398f, 0.3354451471f, 0.7749531066f, 0.6320187359f,
+  0.5180445041f, 0.8553536647f, 0.2011046348f, 0.9795697657f,
+  -0.1391393442f, 0.9902728124f, -0.4632597836f, 0.8862225301f,
+  -0.7336974381f, 0.6794763199f, 0.9415440652f, 0.3368898534f,
+  0.7730104534f, 0.6343932842f, 0.5141027442f, 0.8577286100f,
+  0.1950903220f, 0.9807852804f, -0.1467304745f, 0.9891765100f,
+  -0.4713967368f, 0.8819212643f, -0.7409511254f, 0.6715589548f,
+  0.9410261751f, 0.3383337670f, 0.7710605243f, 0.6367618612f,
+  0.5101500967f, 0.8600853904f, 0.1890686641f, 0.9819638691f,
+  -0.1543129730f, 0.9880220171f, -0.4794937577f, 0.8775452902f,
+  -0.7481193805f, 0.6635641586f, 0.9405060706f, 0.3397768844f,
+  0.7691033376f, 0.6391244449f, 0.5061866453f, 0.8624239561f,
+  0.1830398880f, 0.9831054874f, -0.1618863938f, 0.9868094018f,
+  -0.4875501601f, 0.8730949784f, -0.7552013769f, 0.6554928530f,
+  0.9399837530f, 0.3412192023f, 0.7671389119f, 0.6414810128f,
+  0.5022124740f, 0.8647442575f, 0.1770042204f, 0.9842100924f,
+  -0.1694502912f, 0.9855387353f, -0.4955652618f, 0.8685707060f,
+  -0.7621962981f, 0.6473459686f, 0.9394592236f, 0.3426607173f,
+  0.7651672656f, 0.6438315429f, 0.4982276670f, 0.8670462455f,
+  0.1709618888f, 0.9852776424f, -0.1770042204f, 0.9842100924f,
+  -0.5035383837f, 0.8639728561f, -0.7691033376f, 0.6391244449f,
+  0.9389324835f, 0.3441014260f, 0.7631884173f, 0.6461760130f,
+  0.4942323085f, 0.8693298713f, 0.1649131205f, 0.9863080972f,
+  -0.1845477369f, 0.9828235512f, -0.5114688504f, 0.8593018184f,
+  -0.7759216990f, 0.6308292296f, 0.9384035341f, 0.3455413250f,
+  0.7612023855f, 0.6485144010f, 0.4902264833f, 0.8715950867f,
+  0.1588581433f, 0.9873014182f, -0.1920803970f, 0.9813791933f,
+  -0.5193559902f, 0.8545579884f, -0.7826505962f, 0.6224612794f,
+  0.9378723764f, 0.3469804108f, 0.7592091890f, 0.6508466850f,
+  0.4862102761f, 0.8738418435f, 0.1527971853f, 0.9882575677f,
+  -0.1996017576f, 0.9798771037f, -0.5271991348f, 0.8497417680f,
+  -0.7892892532f, 0.6140215589f, 0.9373390119f, 0.3484186802f,
+  0.7572088465f, 0.6531728430f, 0.4821837721f, 0.8760700942f,
+  0.1467304745f, 0.9891765100f, -0.2071113762f, 0.9783173707f,
+  -0.5349976199f, 0.8448535652f, -0.7958369046f, 0.6055110414f,
+  0.9368034417f, 0.3498561298f, 0.7552013769f, 0.6554928530f,
+  0.4781470564f, 0.8782797917f, 0.1406582393f, 0.9900582103f,
+  -0.2146088110f, 0.9767000861f, -0.5427507849f, 0.8398937942f,
+  -0.8022927955f, 0.5969307081f, 0.9362656672f, 0.3512927561f,
+  0.7531867990f, 0.6578066933f, 0.4741002147f, 0.8804708891f,
+  0.1345807085f, 0.9909026354f, -0.2220936210f, 0.9750253451f,
+  -0.5504579729f, 0.8348628750f, -0.8086561816f, 0.5882815482f,
+  0.9357256895f, 0.3527285558f, 0.7511651319f, 0.6601143421f,
+  0.4700433325f, 0.8826433400f, 0.1284981108f, 0.9917097537f,
+  -0.2295653658f, 0.9732932461f, -0.5581185312f, 0.8297612338f,
+  -0.8149263291f, 0.5795645591f, 0.9351835099f, 0.3541635254f,
+  0.7491363945f, 0.6624157776f, 0.4659764958f, 0.8847970984f,
+  0.1224106752f, 0.9924795346f, -0.2370236060f, 0.9715038910f,
+  -0.5657318108f, 0.8245893028f, -0.8211025150f, 0.5707807459f,
+  0.9346391298f, 0.3555976617f, 0.7471006060f, 0.6647109782f,
+  0.4618997907f, 0.8869321188f, 0.1163186309f, 0.9932119492f,
+  -0.2444679027f, 0.9696573851f, -0.5732971667f, 0.8193475201f,
+  -0.8271840273f, 0.5619311212f, 0.9340925504f, 0.3570309612f,
+  0.7450577854f, 0.6669999223f, 0.4578133036f, 0.8890483559f,
+  0.1102222073f, 0.9939069700f, -0.2518978182f, 0.9677538371f,
+  -0.5808139581f, 0.8140363297f, -0.8331701647f, 0.5530167056f,
+  0.9335437730f, 0.3584634206f, 0.7430079521f, 0.6692825883f,
+  0.4537171210f, 0.8911457648f, 0.1041216339f, 0.9945645707f,
+  -0.2593129151f, 0.9657933589f, -0.5882815482f, 0.8086561816f,
+  -0.8390602371f, 0.5440385267f, 0.9329927988f, 0.3598950365f,
+  0.7409511254f, 0.6715589548f, 0.4496113297f, 0.8932243012f,
+  0.0980171403f, 0.9951847267f, -0.2667127575f, 0.9637760658f,
+  -0.5956993045f, 0.8032075315f, -0.8448535652f, 0.5349976199f,
+  0.9324396293f, 0.3613258056f, 0.7388873245f, 0.6738290004f,
+  0.4454960165f, 0.8952839210f, 0.0919089565f, 0.9957674145f,
+  -0.2740969099f, 0.9617020765f, -0.6030665985f, 0.7976908409f,
+  -0.8505494813f, 0.5258950275f, 0.9318842656f, 0.3627557244f,
+  0.7368165689f, 0.6760927036f, 0.4413712687f, 0.8973245807f,
+  0.0857973123f, 0.9963126122f, -0.2814649379f, 0.9595715131f,
+  -0.6103828063f, 0.7921065773f, -0.8561473284f, 0.5167317990f,
+  0.9313267091f, 0.3641847896f, 0.7347388781f, 0.6783500431f,
+  0.4372371737f, 0.8993462370f, 0.0796824380f, 0.9968202993f,
+  -0.2888164082f, 0.9573845008f, -0.6176473079f, 0.7864552136f,
+  -0.8616464611f, 0.5075089911f, 0.9307669611f, 0.3656129978f,
+  0.7326542717f, 0.6806009978f, 0.4330938189f, 0.9013488470f,
+  0.0735645636f, 0.9972904567f, -0.2961508882f, 0.9551411683f,
+  -0.6248594881f, 0.7807372286f, -0.8670462455f, 0.4982276670f,
+  0.9302050229f, 0.3670403457f, 0.7305627692f, 0.6828455464f,
+  0.4289412921f, 0.9033323685f, 0.0674439196f, 0.9977230666f,
+  -0.3034679466f, 0.9528416476f, -0.6320187359f, 0.7749531066f,
+  -0.8723460589f, 0.4888888969f, 0.9296408958f, 0.3684668300f,
+  0.7284643904f, 0.6850836678f, 0.4247796812f, 0.9052967593f,
+  0.0613207363f, 0.9981181129f, -0.3107671527f, 0.9504860739f,
+  -0.6391244449f, 0.7691033376f, -0.8775452902f, 0.4794937577f,
+  0.9290745813f, 0.3698924471f, 0.7263591551f, 0.6873153409f,
+  0.4206090744f, 0.9072419779f, 0.0551952443f, 0.9984755806f,
+  -0.3180480774f, 0.9480745859f, -0.6461760130f, 0.7631884173f,
+  -0.8826433400f, 0.4700433325f, 0.9285060805f, 0.3713171940f,
+  0.7242470830f, 0.6895405447f, 0.4164295601f, 0.9091679831f,
+  0.0490676743f, 0.9987954562f, -0.3253102922f, 0.9456073254f,
+  -0.6531728430f, 0.7572088465f, -0.8876396204f, 0.4605387110f,
+  0.9279353948f, 0.3727410670f, 0.7221281939f, 0.6917592584f,
+  0.4122412267f, 0.9110747341f, 0.0429382569f, 0.9990777278f,
+  -0.3325533699f, 0.9430844375f, -0.6601143421f, 0.7511651319f,
+  -0.8925335554f, 0.4509809890f, 0.9273625257f, 0.3741640630f,
+  0.7200025080f, 0.6939714609f, 0.4080441629f, 0.9129621904f,
+  0.0368072229f, 0.9993223846f, -0.3397768844f, 0.9405060706f,
+  -0.6669999223f, 0.7450577854f, -0.8973245807f, 0.4413712687f,
+  0.9267874743f, 0.3755861785f, 0.7178700451f, 0.6961771315f,
+  0.4038384576f, 0.9148303122f, 0.0306748032f, 0.9995294175f,
+  -0.3469804108f, 0.9378723764f, -0.6738290004f, 0.7388873245f,
+  -0.9020121439f, 0.4317106580f, 0.9262102421f, 0.3770074102f,
+  0.7157308253f, 0.6983762494f, 0.3996241998f, 0.9166790599f,
+  0.0245412285f, 0.9996988187f, -0.3541635254f, 0.9351835099f,
+  -0.6806009978f, 0.7326542717f, -0.9065957045f, 0.4220002708f,
+  0.9256308305f, 0.3784277548f, 0.7135848688f, 0.7005687939f,
+  0.3954014789f, 0.9185083943f, 0.0184067299f, 0.9998305818f,
+  -0.3613258056f, 0.9324396293f, -0.6873153409f, 0.7263591551f,
+  -0.9110747341f, 0.4122412267f, 0.9250492408f, 0.3798472089f,
+  0.7114321957f, 0.7027547445f, 0.3911703843f, 0.9203182767f,
+  0.0122715383f, 0.9999247018f, -0.3684668300f, 0.9296408958f,
+  -0.6939714609f, 0.7200025080f, -0.9154487161f, 0.4024346509f,
+  0.9244654743f, 0.3812657692f, 0.7092728264f, 0.7049340804f,
+  0.3869310055f, 0.9221086687f, 0.0061358846f, 0.9999811753f,
+  -0.3755861785f, 0.9267874743f, -0.7005687939f, 0.7135848688f,
+  -0.9197171463f, 0.3925816741f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.9232914167f, 0.3841001950f, 0.7049340804f, 0.7092728264f,
+  0.3784277548f, 0.9256308305f, -0.0061358846f, 0.9999811753f,
+  -0.3897581741f, 0.9209172415f, -0.7135848688f, 0.7005687939f,
+  -0.9279353948f, 0.3727410670f, 0.9227011283f, 0.3855160538f,
+  0.7027547445f, 0.7114321957f, 0.3741640630f, 0.9273625257f,
+  -0.0122715383f, 0.9999247018f, -0.3968099874f, 0.9179007756f,
+  -0.7200025080f, 0.6939714609f, -0.9318842656f, 0.3627557244f,
+  0.9221086687f, 0.3869310055f, 0.7005687939f, 0.7135848688f,
+  0.3698924471f, 0.9290745813f, -0.0184067299f, 0.9998305818f,
+  -0.4038384576f, 0.9148303122f, -0.7263591551f, 0.6873153409f,
+  -0.9357256895f, 0.3527285558f, 0.9215140393f, 0.3883450467f,
+  0.6983762494f, 0.7157308253f, 0.3656129978f, 0.9307669611f,
+  -0.0245412285f, 0.9996988187f, -0.4108431711f, 0.9117060320f,
+  -0.7326542717f, 0.6806009978f, -0.9394592236f, 0.3426607173f,
+  0.9209172415f, 0.3897581741f, 0.6961771315f, 0.7178700451f,
+  0.3613258056f, 0.9324396293f, -0.0306748032f, 0.9995294175f,
+  -0.4178237158f, 0.9085281187f, -0.7388873245f, 0.6738290004f,
+  -0.9430844375f, 0.3325533699f, 0.9203182767f, 0.3911703843f,
+  0.6939714609f, 0.7200025080f, 0.3570309612f, 0.9340925504f,
+  -0.0368072229f, 0.9993223846f, -0.4247796812f, 0.9052967593f,
+  -0.7450577854f, 0.6669999223f, -0.9466009131f, 0.3224076788f,
+  0.9197171463f, 0.3925816741f, 0.6917592584f, 0.7221281939f,
+  0.3527285558f, 0.9357256895f, -0.0429382569f, 0.9990777278f,
+  -0.4317106580f, 0.9020121439f, -0.7511651319f, 0.6601143421f,
+  -0.9500082450f, 0.3122248139f, 0.9191138517f, 0.3939920401f,
+  0.6895405447f, 0.7242470830f, 0.3484186802f, 0.9373390119f,
+  -0.0490676743f, 0.9987954562f, -0.4386162385f, 0.8986744657f,
+  -0.7572088465f, 0.6531728430f, -0.9533060404f, 0.3020059493f,
+  0.9185083943f, 0.3954014789f, 0.6873153409f, 0.7263591551f,
+  0.3441014260f, 0.9389324835f, -0.0551952443f, 0.9984755806f,
+  -0.4454960165f, 0.8952839210f, -0.7631884173f, 0.6461760130f,
+  -0.9564939189f, 0.2917522632f, 0.9179007756f, 0.3968099874f,
+  0.6850836678f, 0.7284643904f, 0.3397768844f, 0.9405060706f,
+  -0.0613207363f, 0.9981181129f, -0.4523495872f, 0.8918407094f,
+  -0.7691033376f, 0.6391244449f, -0.9595715131f, 0.2814649379f,
+  0.9172909970f, 0.3982175622f, 0.6828455464f, 0.7305627692f,
+  0.3354451471f, 0.9420597398f, -0.0674439196f, 0.9977230666f,
+  -0.4591765475f, 0.8883450333f, -0.7749531066f, 0.6320187359f,
+  -0.9625384680f, 0.2711451595f, 0.9166790599f, 0.3996241998f,
+  0.6806009978f, 0.7326542717f, 0.3311063058f, 0.9435934582f,
+  -0.0735645636f, 0.9972904567f, -0.4659764958f, 0.8847970984f,
+  -0.7807372286f, 0.6248594881f, -0.9653944417f, 0.2607941179f,
+  0.9160649658f, 0.4010298972f, 0.6783500431f, 0.7347388781f,
+  0.3267604523f, 0.9451071933f, -0.0796824380f, 0.9968202993f,
+  -0.4727490320f, 0.8811971135f, -0.7864552136f, 0.6176473079f,
+  -0.9681391047f, 0.2504130066f, 0.9154487161f, 0.4024346509f,
+  0.6760927036f, 0.7368165689f, 0.3224076788f, 0.9466009131f,
+  -0.0857973123f, 0.9963126122f, -0.4794937577f, 0.8775452902f,
+  -0.7921065773f, 0.6103828063f, -0.9707721407f, 0.2400030224f,
+  0.9148303122f, 0.4038384576f, 0.6738290004f, 0.7388873245f,
+  0.3180480774f, 0.9480745859f, -0.0919089565f, 0.9957674145f,
+  -0.4862102761f, 0.8738418435f, -0.7976908409f, 0.6030665985f,
+  -0.9732932461f, 0.2295653658f, 0.9142097557f, 0.4052413140f,
+  0.6715589548f, 0.7409511254f, 0.3136817404f, 0.9495281806f,
+  -0.0980171403f, 0.9951847267f, -0.4928981922f, 0.8700869911f,
+  -0.8032075315f, 0.5956993045f, -0.9757021300f, 0.2191012402f,
+  0.9135870479f, 0.4066432169f, 0.6692825883f, 0.7430079521f,
+  0.3093087603f, 0.9509616663f, -0.1041216339f, 0.9945645707f,
+  -0.4995571125f, 0.8662809540f, -0.8086561816f, 0.5882815482f,
+  -0.9779985149f, 0.2086118520f, 0.9129621904f, 0.4080441629f,
+  0.6669999223f, 0.7450577854f, 0.3049292297f, 0.9523750127f,
+  -0.1102222073f, 0.9939069700f, -0.5061866453f, 0.8624239561f,
+  -0.8140363297f, 0.5808139581f, -0.9801821360f, 0.1980984107f,
+  0.9123351846f, 0.4094441487f, 0.6647109782f, 0.7471006060f,
+  0.3005432414f, 0.9537681899f, -0.1163186309f, 0.9932119492f,
+  -0.5127864006f, 0.8585162243f, -0.8193475201f, 0.5732971667f,
+  -0.9822527414f, 0.1875621286f, 0.9117060320f, 0.4108431711f,
+  0.6624157776f, 0.7491363945f, 0.2961508882f, 0.9551411683f,
+  -0.1224106752f, 0.9924795346f, -0.5193559902f, 0.8545579884f,
+  -0.8245893028f, 0.5657318108f, -0.9842100924f, 0.1770042204f,
+  0.9110747341f, 0.4122412267f, 0.6601143421f, 0.7511651319f,
+  0.2917522632f, 0.9564939189f, -0.1284981108f, 0.9917097537f,
+  -0.5258950275f, 0.8505494813f, -0.8297612338f, 0.5581185312f,
+  -0.9860539633f, 0.1664259035f, 0.9104412923f, 0.4136383122f,
+  0.6578066933f, 0.7531867990f, 0.2873474595f, 0.9578264130f,
+  -0.1345807085f, 0.9909026354f, -0.5324031279f, 0.8464909388f,
+  -0.8348628750f, 0.5504579729f, -0.9877841416f, 0.1558283977f,
+  0.9098057081f, 0.4150344245f, 0.6554928530f, 0.7552013769f,
+  0.2829365705f, 0.9591386225f, -0.1406582393f, 0.9900582103f,
+  -0.5388799085f, 0.8423825996f, -0.8398937942f, 0.5427507849f,
+  -0.9894004278f, 0.1452129247f, 0.9091679831f, 0.4164295601f,
+  0.6531728430f, 0.7572088465f, 0.2785196894f, 0.9604305194f,
+  -0.1467304745f, 0.9891765100f, -0.5453249884f, 0.8382247056f,
+  -0.8448535652f, 0.5349976199f, -0.9909026354f, 0.1345807085f,
+  0.9085281187f, 0.4178237158f, 0.6508466850f, 0.7592091890f,
+  0.2740969099f, 0.9617020765f, -0.1527971853f, 0.9882575677f,
+  -0.5517379884f, 0.8340175011f, -0.8497417680f, 0.5271991348f,
+  -0.9922905913f, 0.1239329751f, 0.9078861165f, 0.4192168884f,
+  0.6485144010f, 0.7612023855f, 0.2696683256f, 0.9629532669f,
+  -0.1588581433f, 0.9873014182f, -0.5581185312f, 0.8297612338f,
+  -0.8545579884f, 0.5193559902f, -0.9935641355f, 0.1132709522f,
+  0.9072419779f, 0.4206090744f, 0.6461760130f, 0.7631884173f,
+  0.2652340303f, 0.9641840640f, -0.1649131205f, 0.9863080972f,
+  -0.5644662415f, 0.8254561540f, -0.8593018184f, 0.5114688504f,
+  -0.9947231211f, 0.1025958690f, 0.9065957045f, 0.4220002708f,
+  0.6438315429f, 0.7651672656f, 0.2607941179f, 0.9653944417f,
+  -0.1709618888f, 0.9852776424f, -0.5707807459f, 0.8211025150f,
+  -0.8639728561f, 0.5035383837f, -0.9957674145f, 0.0919089565f,
+  0.9059472978f, 0.4233904741f, 0.6414810128f, 0.7671389119f,
+  0.2563486825f, 0.9665843745f, -0.1770042204f, 0.9842100924f,
+  -0.5770616729f, 0.8167005729f, -0.8685707060f, 0.4955652618f,
+  -0.9966968952f, 0.0812114468f, 0.9052967593f, 0.4247796812f,
+  0.6391244449f, 0.7691033376f, 0.2518978182f, 0.9677538371f,
+  -0.1830398880f, 0.9831054874f, -0.5833086529f, 0.8122505866f,
+  -0.8730949784f, 0.4875501601f, -0.9975114561f, 0.0705045734f,
+  0.9046440906f, 0.4261678887f, 0.6367618612f, 0.7710605243f,
+  0.2474416192f, 0.9689028048f, -0.1890686641f, 0.9819638691f,
+  -0.5895213186f, 0.8077528179f, -0.8775452902f, 0.4794937577f,
+  -0.9982110034f, 0.0597895707f, 0.9039892931f, 0.4275550934f,
+  0.6343932842f, 0.7730104534f, 0.2429801799f, 0.9700312532f,
+  -0.1950903220f, 0.9807852804f, -0.5956993045f, 0.8032075315f,
+  -0.8819212643f, 0.4713967368f, -0.9987954562f, 0.0490676743f,
+  0.9033323685f, 0.4289412921f, 0.6320187359f, 0.7749531066f,
+  0.2385135948f, 0.9711391584f, -0.2011046348f, 0.9795697657f,
+  -0.6018422471f, 0.7986149946f, -0.8862225301f, 0.4632597836f,
+  -0.9992647473f, 0.0383401204f, 0.9026733182f, 0.4303264813f,
+  0.6296382389f, 0.7768884657f, 0.2340419586f, 0.9722264971f,
+  -0.2071113762f, 0.9783173707f, -0.6079497850f, 0.7939754776f,
+  -0.8904487232f, 0.4550835871f, -0.9996188225f, 0.0276081458f,
+  0.9020121439f, 0.4317106580f, 0.6272518155f, 0.7788165124f,
+  0.2295653658f, 0.9732932461f, -0.2131103199f, 0.9770281427f,
+  -0.6140215589f, 0.7892892532f, -0.8945994856f, 0.4468688402f,
+  -0.9998576410f, 0.0168729879f, 0.9013488470f, 0.4330938189f,
+  0.6248594881f, 0.7807372286f, 0.2250839114f, 0.9743393828f,
+  -0.2191012402f, 0.9757021300f, -0.6200572118f, 0.7845565972f,
+  -0.8986744657f, 0.4386162385f, -0.9999811753f, 0.0061358846f,
+  0.9006834292f, 0.4344759606f, 0.6224612794f, 0.7826505962f,
+  0.2205976901f, 0.9753648851f, -0.2250839114f, 0.9743393828f,
+  -0.6260563884f, 0.7797777879f, -0.9026733182f, 0.4303264813f,
+  -0.9999894111f, -0.0046019261f, 0.9000158920f, 0.4358570799f,
+  0.6200572118f, 0.7845565972f, 0.2161067971f, 0.9763697313f,
+  -0.2310581083f, 0.9729399522f, -0.6320187359f, 0.7749531066f,
+  -0.9065957045f, 0.4220002708f, -0.9998823475f, -0.0153392063f,
+  0.8993462370f, 0.4372371737f, 0.6176473079f, 0.7864552136f,
+  0.2116113274f, 0.9773539001f, -0.2370236060f, 0.9715038910f,
+  -0.6379439036f, 0.7700828370f, -0.9104412923f, 0.4136383122f,
+  -0.9996599967f, -0.0260747178f, 0.8986744657f, 0.4386162385f,
+  0.6152315906f, 0.7883464276f, 0.2071113762f, 0.9783173707f,
+  -0.2429801799f, 0.9700312532f, -0.6438315429f, 0.7651672656f,
+  -0.9142097557f, 0.4052413140f, -0.9993223846f, -0.0368072229f,
+  0.8980005797f, 0.4399942713f, 0.6128100824f, 0.7902302214f,
+  0.2026070388f, 0.9792601226f, -0.2489276057f, 0.9685220943f,
+  -0.6496813074f, 0.7602066817f, -0.9179007756f, 0.3968099874f,
+  -0.9988695499f, -0.0475354842f, 0.8973245807f, 0.4413712687f,
+  0.6103828063f, 0.7921065773f, 0.1980984107f, 0.9801821360f,
+  -0.2548656596f, 0.9669764710f, -0.6554928530f, 0.7552013769f,
+  -0.9215140393f, 0.3883450467f, -0.9983015449f, -0.0582582645f,
+  0.8966464702f, 0.4427472276f, 0.6079497850f, 0.7939754776f,
+  0.1935855873f, 0.9810833912f, -0.2607941179f, 0.9653944417f,
+  -0.6612658378f, 0.7501516458f, -0.9250492408f, 0.3798472089f,
+  -0.9976184351f, -0.0689743276f, 0.8959662498f, 0.4441221446f,
+  0.6055110414f, 0.7958369046f, 0.1890686641f, 0.9819638691f,
+  -0.2667127575f, 0.9637760658f, -0.6669999223f, 0.7450577854f,
+  -0.9285060805f, 0.3713171940f, -0.9968202993f, -0.0796824380f,
+  0.8952839210f, 0.4454960165f, 0.6030665985f, 0.7976908409f,
+  0.1845477369f, 0.9828235512f, -0.2726213554f, 0.9621214043f,
+  -0.6726947691f, 0.7399200955f, -0.9318842656f, 0.3627557244f,
+  -0.9959072294f, -0.0903813609f, 0.8945994856f, 0.4468688402f,
+  0.6006164794f, 0.7995372691f, 0.1800229014f, 0.9836624192f,
+  -0.2785196894f, 0.9604305194f, -0.6783500431f, 0.7347388781f,
+  -0.9351835099f, 0.3541635254f, -0.9948793308f, -0.1010698628f,
+  0.8939129451f, 0.4482406123f, 0.5981607070f, 0.8013761717f,
+  0.1754942534f, 0.9844804554f, -0.2844075372f, 0.9587034749f,
+  -0.6839654118f, 0.7295144381f, -0.9384035341f, 0.3455413250f,
+  -0.9937367219f, -0.1117467112f, 0.8932243012f, 0.4496113297f,
+  0.5956993045f, 0.8032075315f, 0.1709618888f, 0.9852776424f,
+  -0.2902846773f, 0.9569403357f, -0.6895405447f, 0.7242470830f,
+  -0.9415440652f, 0.3368898534f, -0.9924795346f, -0.1224106752f,
+  0.8925335554f, 0.4509809890f, 0.5932322950f, 0.8050313311f,
+  0.1664259035f, 0.9860539633f, -0.2961508882f, 0.9551411683f,
+  -0.6950751140f, 0.7189371224f, -0.9446048373f, 0.3282098436f,
+  -0.9911079137f, -0.1330605252f, 0.8918407094f, 0.4523495872f,
+  0.5907597019f, 0.8068475535f, 0.1618863938f, 0.9868094018f,
+  -0.3020059493f, 0.9533060404f, -0.7005687939f, 0.7135848688f,
+  -0.9475855910f, 0.3195020308f, -0.9896220175f, -0.1436950332f,
+  0.8911457648f, 0.4537171210f, 0.5882815482f, 0.8086561816f,
+  0.1573434556f, 0.9875439418f, -0.3078496400f, 0.9514350210f,
+  -0.7060212614f, 0.7081906370f, -0.9504860739f, 0.3107671527f,
+  -0.9880220171f, -0.1543129730f, 0.8904487232f, 0.4550835871f,
+  0.5857978575f, 0.8104571983f, 0.1527971853f, 0.9882575677f,
+  -0.3136817404f, 0.9495281806f, -0.7114321957f, 0.7027547445f,
+  -0.9533060404f, 0.3020059493f, -0.9863080972f, -0.1649131205f,
+  0.8897495864f, 0.4564489824f, 0.5833086529f, 0.8122505866f,
+  0.1482476790f, 0.9889502645f, -0.3195020308f, 0.9475855910f,
+  -0.7168012785f, 0.6972775108f, -0.9560452513f, 0.2932191627f,
+  -0.9844804554f, -0.1754942534f, 0.8890483559f, 0.4578133036f,
+  0.5808139581f, 0.8140363297f, 0.1436950332f, 0.9896220175f,
+  -0.3253102922f, 0.9456073254f, -0.7221281939f, 0.6917592584f,
+  -0.9587034749f, 0.2844075372f, -0.9825393023f, -0.1860551517f,
+  0.8883450333f, 0.4591765475f, 0.5783137964f, 0.8158144108f,
+  0.1391393442f, 0.9902728124f, -0.3311063058f, 0.9435934582f,
+  -0.7274126286f, 0.6862003117f, -0.9612804858f, 0.2755718193f,
+  -0.9804848618f, -0.1965945977f, 0.8876396204f, 0.4605387110f,
+  0.5758081914f, 0.8175848132f, 0.1345807085f, 0.9909026354f,
+  -0.3368898534f, 0.9415440652f, -0.7326542717f, 0.6806009978f,
+  -0.9637760658f, 0.2667127575f, -0.9783173707f, -0.2071113762f,
+  0.8869321188f, 0.4618997907f, 0.5732971667f, 0.8193475201f,
+  0.1300192227f, 0.9915114733f, -0.3426607173f, 0.9394592236f,
+  -0.7378528148f, 0.6749616461f, -0.9661900034f, 0.2578311022f,
+  -0.9760370790f, -0.2176042746f, 0.8862225301f, 0.4632597836f,
+  0.5707807459f, 0.8211025150f, 0.1254549834f, 0.9920993131f,
+  -0.3484186802f, 0.9373390119f, -0.7430079521f, 0.6692825883f,
+  -0.9685220943f, 0.2489276057f, -0.9736442497f, -0.2280720832f,
+  0.8855108561f, 0.4646186863f, 0.5682589527f, 0.8228497814f,
+  0.1208880872f, 0.9926661424f, -0.3541635254f, 0.9351835099f,
+  -0.7481193805f, 0.6635641586f, -0.9707721407f, 0.2400030224f,
+  -0.9711391584f, -0.2385135948f, 0.8847970984f, 0.4659764958f,
+  0.5657318108f, 0.8245893028f, 0.1163186309f, 0.9932119492f,
+  -0.3598950365f, 0.9329927988f, -0.7531867990f, 0.6578066933f,
+  -0.9729399522f, 0.2310581083f, -0.9685220943f, -0.2489276057f,
+  0.8840812587f, 0.4673332087f, 0.5631993440f, 0.8263210628f,
+  0.1117467112f, 0.9937367219f, -0.3656129978f, 0.9307669611f,
+  -0.7582099098f, 0.6520105311f, -0.9750253451f, 0.2220936210f,
+  -0.9657933589f, -0.2593129151f, 0.8833633387f, 0.4686888220f,
+  0.5606615762f, 0.8280450453f, 0.1071724250f, 0.9942404495f,
+  -0.3713171940f, 0.9285060805f, -0.7631884173f, 0.6461760130f,
+  -0.9770281427f, 0.2131103199f, -0.9629532669f, -0.2696683256f,
+  0.8826433400f, 0.4700433325f, 0.5581185312f, 0.8297612338f,
+  0.1025958690f, 0.9947231211f, -0.3770074102f, 0.9262102421f,
+  -0.7681220285f, 0.6403034822f, -0.9789481753f, 0.2041089661f,
+  -0.9600021457f, -0.2799926431f, 0.8819212643f, 0.4713967368f,
+  0.5555702330f, 0.8314696123f, 0.0980171403f, 0.9951847267f,
+  -0.3826834324f, 0.9238795325f, -0.7730104534f, 0.6343932842f,
+  -0.9807852804f, 0.1950903220f, -0.9569403357f, -0.2902846773f,
+  0.8811971135f, 0.4727490320f, 0.5530167056f, 0.8331701647f,
+  0.0934363358f, 0.9956252564f, -0.3883450467f, 0.9215140393f,
+  -0.7778534042f, 0.6284457666f, -0.9825393023f, 0.1860551517f,
+  -0.9537681899f, -0.3005432414f, 0.8804708891f, 0.4741002147f,
+  0.5504579729f, 0.8348628750f, 0.0888535526f, 0.9960447009f,
+  -0.3939920401f, 0.9191138517f, -0.7826505962f, 0.6224612794f,
+  -0.9842100924f, 0.1770042204f, -0.9504860739f, -0.3107671527f,
+  0.8797425928f, 0.4754502817f, 0.5478940592f, 0.8365477272f,
+  0.0842688876f, 0.9964430514f, -0.3996241998f, 0.9166790599f,
+  -0.7874017470f, 0.6164401745f, -0.9857975092f, 0.1679382950f,
+  -0.9470943664f, -0.3209552324f, 0.8790122264f, 0.4767992301f,
+  0.5453249884f, 0.8382247056f, 0.0796824380f, 0.9968202993f,
+  -0.4052413140f, 0.9142097557f, -0.7921065773f, 0.6103828063f,
+  -0.9873014182f, 0.1588581433f, -0.9435934582f, -0.3311063058f,
+  0.8782797917f, 0.4781470564f, 0.5427507849f, 0.8398937942f,
+  0.0750943008f, 0.9971764367f, -0.4108431711f, 0.9117060320f,
+  -0.7967648102f, 0.6042895309f, -0.9887216920f, 0.1497645347f,
+  -0.9399837530f, -0.3412192023f, 0.8775452902f, 0.4794937577f,
+  0.5401714727f, 0.8415549774f, 0.0705045734f, 0.9975114561f,
+  -0.4164295601f, 0.9091679831f, -0.8013761717f, 0.5981607070f,
+  -0.9900582103f, 0.1406582393f, -0.9362656672f, -0.3512927561f,
+  0.8768087238f, 0.4808393306f, 0.5375870763f, 0.8432082396f,
+  0.0659133528f, 0.9978253504f, -0.4220002708f, 0.9065957045f,
+  -0.8059403906f, 0.5919966950f, -0.9913108598f, 0.1315400287f,
+  -0.9324396293f, -0.3613258056f, 0.8760700942f, 0.4821837721f,
+  0.5349976199f, 0.8448535652f, 0.0613207363f, 0.9981181129f,
+  -0.4275550934f, 0.9039892931f, -0.8104571983f, 0.5857978575f,
+  -0.9924795346f, 0.1224106752f, -0.9285060805f, -0.3713171940f,
+  0.8753294031f, 0.4835270789f, 0.5324031279f, 0.8464909388f,
+  0.0567268212f, 0.9983897374f, -0.4330938189f, 0.9013488470f,
+  -0.8149263291f, 0.5795645591f, -0.9935641355f, 0.1132709522f,
+  -0.9244654743f, -0.3812657692f, 0.8745866523f, 0.4848692480f,
+  0.5298036247f, 0.8481203448f, 0.0521317047f, 0.9986402182f,
+  -0.4386162385f, 0.8986744657f, -0.8193475201f, 0.5732971667f,
+  -0.9945645707f, 0.1041216339f, -0.9203182767f, -0.3911703843f,
+  0.8738418435f, 0.4862102761f, 0.5271991348f, 0.8497417680f,
+  0.0475354842f, 0.9988695499f, -0.4441221446f, 0.8959662498f,
+  -0.8237205112f, 0.5669960488f, -0.9954807555f, 0.0949634953f,
+  -0.9160649658f, -0.4010298972f, 0.8730949784f, 0.4875501601f,
+  0.5245896827f, 0.8513551931f, 0.0429382569f, 0.9990777278f,
+  -0.4496113297f, 0.8932243012f, -0.8280450453f, 0.5606615762f,
+  -0.9963126122f, 0.0857973123f, -0.9117060320f, -0.4108431711f,
+  0.8723460589f, 0.4888888969f, 0.5219752929f, 0.8529606049f,
+  0.0383401204f, 0.9992647473f, -0.4550835871f, 0.8904487232f,
+  -0.8323208678f, 0.5542941215f, -0.9970600703f, 0.0766238614f,
+  -0.9072419779f, -0.4206090744f, 0.8715950867f, 0.4902264833f,
+  0.5193559902f, 0.8545579884f, 0.0337411719f, 0.9994306046f,
+  -0.4605387110f, 0.8876396204f, -0.8365477272f, 0.5478940592f,
+  -0.9977230666f, 0.0674439196f, -0.9026733182f, -0.4303264813f,
+  0.8708420635f, 0.4915629161f, 0.5167317990f, 0.8561473284f,
+  0.0291415088f, 0.9995752960f, -0.4659764958f, 0.8847970984f,
+  -0.8407253750f, 0.5414617659f, -0.9983015449f, 0.0582582645f,
+  -0.8980005797f, -0.4399942713f, 0.8700869911f, 0.4928981922f,
+  0.5141027442f, 0.8577286100f, 0.0245412285f, 0.9996988187f,
+  -0.4713967368f, 0.8819212643f, -0.8448535652f, 0.5349976199f,
+  -0.9987954562f, 0.0490676743f, -0.8932243012f, -0.4496113297f,
+  0.8693298713f, 0.4942323085f, 0.5114688504f, 0.8593018184f,
+  0.0199404286f, 0.9998011699f, -0.4767992301f, 0.8790122264f,
+  -0.8489320552f, 0.5285020015f, -0.9992047586f, 0.0398729276f,
+  -0.8883450333f, -0.4591765475f, 0.8685707060f, 0.4955652618f,
+  0.5088301425f, 0.8608669386f, 0.0153392063f, 0.9998823475f,
+  -0.4821837721f, 0.8760700942f, -0.8529606049f, 0.5219752929f,
+  -0.9995294175f, 0.0306748032f, -0.8833633387f, -0.4686888220f,
+  0.8678094968f, 0.4968970490f, 0.5061866453f, 0.8624239561f,
+  0.0107376592f, 0.9999423497f, -0.4875501601f, 0.8730949784f,
+  -0.8569389774f, 0.5154178780f, -0.9997694054f, 0.0214740803f,
+  -0.8782797917f, -0.4781470564f, 0.8670462455f, 0.4982276670f,
+  0.5035383837f, 0.8639728561f, 0.0061358846f, 0.9999811753f,
+  -0.4928981922f, 0.8700869911f, -0.8608669386f, 0.5088301425f,
+  -0.9999247018f, 0.0122715383f, -0.8730949784f, -0.4875501601f,
+  0.8662809540f, 0.4995571125f, 0.5008853826f, 0.8655136241f,
+  0.0015339802f, 0.9999988235f, -0.4982276670f, 0.8670462455f,
+  -0.8647442575f, 0.5022124740f, -0.9999952938f, 0.0030679568f,
+  -0.8678094968f, -0.4968970490f, 0.8655136241f, 0.5008853826f,
+  0.4982276670f, 0.8670462455f, -0.0030679568f, 0.9999952938f,
+  -0.5035383837f, 0.8639728561f, -0.8685707060f, 0.4955652618f,
+  -0.9999811753f, -0.0061358846f, -0.8624239561f, -0.5061866453f,
+  0.8647442575f, 0.5022124740f, 0.4955652618f, 0.8685707060f,
+  -0.0076698287f, 0.9999705864f, -0.5088301425f, 0.8608669386f,
+  -0.8723460589f, 0.4888888969f, -0.9998823475f, -0.0153392063f,
+  -0.8569389774f, -0.5154178780f, 0.8639728561f, 0.5035383837f,
+  0.4928981922f, 0.8700869911f, -0.0122715383f, 0.9999247018f,
+  -0.5141027442f, 0.8577286100f, -0.8760700942f, 0.4821837721f,
+  -0.9996988187f, -0.0245412285f, -0.8513551931f, -0.5245896827f,
+  0.8631994217f, 0.5048631085f, 0.4902264833f, 0.8715950867f,
+  -0.0168729879f, 0.9998576410f, -0.5193559902f, 0.8545579884f,
+  -0.8797425928f, 0.4754502817f, -0.9994306046f, -0.0337411719f,
+  -0.8456732470f, -0.5337010018f, 0.8624239561f, 0.5061866453f,
+  0.4875501601f, 0.8730949784f, -0.0214740803f, 0.9997694054f,
+  -0.5245896827f, 0.8513551931f, -0.8833633387f, 0.4686888220f,
+  -0.9990777278f, -0.0429382569f, -0.8398937942f, -0.5427507849f,
+  0.8616464611f, 0.5075089911f, 0.4848692480f, 0.8745866523f,
+  -0.0260747178f, 0.9996599967f, -0.5298036247f, 0.8481203448f,
+  -0.8869321188f, 0.4618997907f, -0.9986402182f, -0.0521317047f,
+  -0.8340175011f, -0.5517379884f, 0.8608669386f, 0.5088301425f,
+  0.4821837721f, 0.8760700942f, -0.0306748032f, 0.9995294175f,
+  -0.5349976199f, 0.8448535652f, -0.8904487232f, 0.4550835871f,
+  -0.9981181129f, -0.0613207363f, -0.8280450453f, -0.5606615762f,
+  0.8600853904f, 0.5101500967f, 0.4794937577f, 0.8775452902f,
+  -0.0352742389f, 0.9993776704f, -0.5401714727f, 0.8415549774f,
+  -0.8939129451f, 0.4482406123f, -0.9975114561f, -0.0705045734f,
+  -0.8219771153f, -0.5695205193f, 0.8593018184f, 0.5114688504f,
+  0.4767992301f, 0.8790122264f, -0.0398729276f, 0.9992047586f,
+  -0.5453249884f, 0.8382247056f, -0.8973245807f, 0.4413712687f,
+  -0.9968202993f, -0.0796824380f, -0.8158144108f, -0.5783137964f,
+  0.8585162243f, 0.5127864006f, 0.4741002147f, 0.8804708891f,
+  -0.0444707719f, 0.9990106859f, -0.5504579729f, 0.8348628750f,
+  -0.9006834292f, 0.4344759606f, -0.9960447009f, -0.0888535526f,
+  -0.8095576424f, -0.5870403935f, 0.8577286100f, 0.5141027442f,
+  0.4713967368f, 0.8819212643f, -0.0490676743f, 0.9987954562f,
+  -0.5555702330f, 0.8314696123f, -0.9039892931f, 0.4275550934f,
+  -0.9951847267f, -0.0980171403f, -0.8032075315f, -0.5956993045f,
+  0.8569389774f, 0.5154178780f, 0.4686888220f, 0.8833633387f,
+  -0.0536635377f, 0.9985590742f, -0.5606615762f, 0.8280450453f,
+  -0.9072419779f, 0.4206090744f, -0.9942404495f, -0.1071724250f,
+  -0.7967648102f, -0.6042895309f, 0.8561473284f, 0.5167317990f,
+  0.4659764958f, 0.8847970984f, -0.0582582645f, 0.9983015449f,
+  -0.5657318108f, 0.8245893028f, -0.9104412923f, 0.4136383122f,
+  -0.9932119492f, -0.1163186309f, -0.7902302214f, -0.6128100824f,
+  0.8553536647f, 0.5180445041f, 0.4632597836f, 0.8862225301f,
+  -0.0628517576f, 0.9980228738f, -0.5707807459f, 0.8211025150f,
+  -0.9135870479f, 0.4066432169f, -0.9920993131f, -0.1254549834f,
+  -0.7836045186f, -0.6212599765f, 0.8545579884f, 0.5193559902f,
+  0.4605387110f, 0.8876396204f, -0.0674439196f, 0.9977230666f,
+  -0.5758081914f, 0.8175848132f, -0.9166790599f, 0.3996241998f,
+  -0.9909026354f, -0.1345807085f, -0.7768884657f, -0.6296382389f,
+  0.8537603011f, 0.5206662541f, 0.4578133036f, 0.8890483559f,
+  -0.0720346532f, 0.9974021299f, -0.5808139581f, 0.8140363297f,
+  -0.9197171463f, 0.3925816741f, -0.9896220175f, -0.1436950332f,
+  -0.7700828370f, -0.6379439036f, 0.8529606049f, 0.5219752929f,
+  0.4550835871f, 0.8904487232f, -0.0766238614f, 0.9970600703f,
+  -0.5857978575f, 0.8104571983f, -0.9227011283f, 0.3855160538f,
+  -0.9882575677f, -0.1527971853f, -0.7631884173f, -0.6461760130f,
+  0.8521589016f, 0.5232831035f, 0.4523495872f, 0.8918407094f,
+  -0.0812114468f, 0.9966968952f, -0.5907597019f, 0.8068475535f,
+  -0.9256308305f, 0.3784277548f, -0.9868094018f, -0.1618863938f,
+  -0.7562060014f, -0.6543336178f, 0.8513551931f, 0.5245896827f,
+  0.4496113297f, 0.8932243012f, -0.0857973123f, 0.9963126122f,
+  -0.5956993045f, 0.8032075315f, -0.9285060805f, 0.3713171940f,
+  -0.9852776424f, -0.1709618888f, -0.7491363945f, -0.6624157776f,
+  0.8505494813f, 0.5258950275f, 0.4468688402f, 0.8945994856f,
+  -0.0903813609f, 0.9959072294f, -0.6006164794f, 0.7995372691f,
+  -0.9313267091f, 0.3641847896f, -0.9836624192f, -0.1800229014f,
+  -0.7419804117f, -0.6704215604f, 0.8497417680f, 0.5271991348f,
+  0.4441221446f, 0.8959662498f, -0.0949634953f, 0.9954807555f,
+  -0.6055110414f, 0.7958369046f, -0.9340925504f, 0.3570309612f,
+  -0.9819638691f, -0.1890686641f, -0.7347388781f, -0.6783500431f,
+  0.8489320552f, 0.5285020015f, 0.4413712687f, 0.8973245807f,
+  -0.0995436187f, 0.9950331994f, -0.6103828063f, 0.7921065773f,
+  -0.9368034417f, 0.3498561298f, -0.9801821360f, -0.1980984107f,
+  -0.7274126286f, -0.6862003117f, 0.8481203448f, 0.5298036247f,
+  0.4386162385f, 0.8986744657f, -0.1041216339f, 0.9945645707f,
+  -0.6152315906f, 0.7883464276f, -0.9394592236f, 0.3426607173f,
+  -0.9783173707f, -0.2071113762f, -0.7200025080f, -0.6939714609f,
+  0.8473066387f, 0.5311040012f, 0.4358570799f, 0.9000158920f,
+  -0.1086974440f, 0.9940748793f, -0.6200572118f, 0.7845565972f,
+  -0.9420597398f, 0.3354451471f, -0.9763697313f, -0.2161067971f,
+  -0.7125093706f, -0.7016625947f, 0.8464909388f, 0.5324031279f,
+  0.4330938189f, 0.9013488470f, -0.1132709522f, 0.9935641355f,
+  -0.6248594881f, 0.7807372286f, -0.9446048373f, 0.3282098436f,
+  -0.9743393828f, -0.2250839114f, -0.7049340804f, -0.7092728264f,
+  0.8456732470f, 0.5337010018f, 0.4303264813f, 0.9026733182f,
+  -0.1178420615f, 0.9930323502f, -0.6296382389f, 0.7768884657f,
+  -0.9470943664f, 0.3209552324f, -0.9722264971f, -0.2340419586f,
+  -0.6972775108f, -0.7168012785f, 0.8448535652f, 0.5349976199f,
+  0.4275550934f, 0.9039892931f, -0.1224106752f, 0.9924795346f,
+  -0.6343932842f, 0.7730104534f, -0.9495281806f, 0.3136817404f,
+  -0.9700312532f, -0.2429801799f, -0.6895405447f, -0.7242470830f,
+  0.8440318955f, 0.5362929791f, 0.4247796812f, 0.9052967593f,
+  -0.1269766965f, 0.9919057004f, -0.6391244449f, 0.7691033376f,
+  -0.9519061368f, 0.3063897954f, -0.9677538371f, -0.2518978182f,
+  -0.6817240742f, -0.7316093812f, 0.8432082396f, 0.5375870763f,
+  0.4220002708f, 0.9065957045f, -0.1315400287f, 0.9913108598f,
+  -0.6438315429f, 0.7651672656f, -0.9542280951f, 0.2990798263f,
+  -0.9653944417f, -0.2607941179f, -0.6738290004f, -0.7388873245f,
+  0.8423825996f, 0.5388799085f, 0.4192168884f, 0.9078861165f,
+  -0.1361005752f, 0.9906950254f, -0.6485144010f, 0.7612023855f,
+  -0.9564939189f, 0.2917522632f, -0.9629532669f, -0.2696683256f,
+  -0.6658562337f, -0.7460800735f, 0.8415549774f, 0.5401714727f,
+  0.4164295601f, 0.9091679831f, -0.1406582393f, 0.9900582103f,
+  -0.6531728430f, 0.7572088465f, -0.9587034749f, 0.2844075372f,
+  -0.9604305194f, -0.2785196894f, -0.6578066933f, -0.7531867990f,
+  0.8407253750f, 0.5414617659f, 0.4136383122f, 0.9104412923f,
+  -0.1452129247f, 0.9894004278f, -0.6578066933f, 0.7531867990f,
+  -0.9608566331f, 0.2770460803f, -0.9578264130f, -0.2873474595f,
+  -0.6496813074f, -0.7602066817f, 0.8398937942f, 0.5427507849f,
+  0.4108431711f, 0.9117060320f, -0.1497645347f, 0.9887216920f,
+  -0.6624157776f, 0.7491363945f, -0.9629532669f, 0.2696683256f,
+  -0.9551411683f, -0.2961508882f, -0.6414810128f, -0.7671389119f,
+  0.8390602371f, 0.5440385267f, 0.4080441629f, 0.9129621904f,
+  -0.1543129730f, 0.9880220171f, -0.6669999223f, 0.7450577854f,
+  -0.9649932529f, 0.2622747070f, -0.9523750127f, -0.3049292297f,
+  -0.6332067551f, -0.7739826906f, 0.8382247056f, 0.5453249884f,
+  0.4052413140f, 0.9142097557f, -0.1588581433f, 0.9873014182f,
+  -0.6715589548f, 0.7409511254f, -0.9669764710f, 0.2548656596f,
+  -0.9495281806f, -0.3136817404f, -0.6248594881f, -0.7807372286f,
+  0.8373872016f, 0.5466101669f, 0.4024346509f, 0.9154487161f,
+  -0.1633999494f, 0.9865599103f, -0.6760927036f, 0.7368165689f,
+  -0.9689028048f, 0.2474416192f, -0.9466009131f, -0.3224076788f,
+  -0.6164401745f, -0.7874017470f, 0.8365477272f, 0.5478940592f,
+  0.3996241998f, 0.9166790599f, -0.1679382950f, 0.9857975092f,
+  -0.6806009978f, 0.7326542717f, -0.9707721407f, 0.2400030224f,
+  -0.9435934582f, -0.3311063058f, -0.6079497850f, -0.7939754776f,
+  0.8357062844f, 0.5491766622f, 0.3968099874f, 0.9179007756f,
+  -0.1724730840f, 0.9850142310f, -0.6850836678f, 0.7284643904f,
+  -0.9725843689f, 0.2325503070f, -0.9405060706f, -0.3397768844f,
+  -0.5993892984f, -0.8004576622f, 0.8348628750f, 0.5504579729f,
+  0.3939920401f, 0.9191138517f, -0.1770042204f, 0.9842100924f,
+  -0.6895405447f, 0.7242470830f, -0.9743393828f, 0.2250839114f,
+  -0.9373390119f, -0.3484186802f, -0.5907597019f, -0.8068475535f,
+  0.8340175011f, 0.5517379884f, 0.3911703843f, 0.9203182767f,
+  -0.1815316083f, 0.9833851103f, -0.6939714609f, 0.7200025080f,
+  -0.9760370790f, 0.2176042746f, -0.9340925504f, -0.3570309612f,
+  -0.5820619903f, -0.8131444148f, 0.8331701647f, 0.5530167056f,
+  0.3883450467f, 0.9215140393f, -0.1860551517f, 0.9825393023f,
+  -0.6983762494f, 0.7157308253f, -0.9776773578f, 0.2101118369f,
+  -0.9307669611f, -0.3656129978f, -0.5732971667f, -0.8193475201f,
+  0.8323208678f, 0.5542941215f, 0.3855160538f, 0.9227011283f,
+  -0.1905747548f, 0.9816726862f, -0.7027547445f, 0.7114321957f,
+  -0.9792601226f, 0.2026070388f, -0.9273625257f, -0.3741640630f,
+  -0.5644662415f, -0.8254561540f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.8306164003f, 0.5568450373f, 0.3798472089f, 0.9250492408f,
+  -0.1996017576f, 0.9798771037f, -0.7114321957f, 0.7027547445f,
+  -0.9822527414f, 0.1875621286f, -0.9203182767f, -0.3911703843f,
+  -0.5466101669f, -0.8373872016f, 0.8297612338f, 0.5581185312f,
+  0.3770074102f, 0.9262102421f, -0.2041089661f, 0.9789481753f,
+  -0.7157308253f, 0.6983762494f, -0.9836624192f, 0.1800229014f,
+  -0.9166790599f, -0.3996241998f, -0.5375870763f, -0.8432082396f,
+  0.8289041148f, 0.5593907119f, 0.3741640630f, 0.9273625257f,
+  -0.2086118520f, 0.9779985149f, -0.7200025080f, 0.6939714609f,
+  -0.9850142310f, 0.1724730840f, -0.9129621904f, -0.4080441629f,
+  -0.5285020015f, -0.8489320552f, 0.8280450453f, 0.5606615762f,
+  0.3713171940f, 0.9285060805f, -0.2131103199f, 0.9770281427f,
+  -0.7242470830f, 0.6895405447f, -0.9863080972f, 0.1649131205f,
+  -0.9091679831f, -0.4164295601f, -0.5193559902f, -0.8545579884f,
+  0.8271840273f, 0.5619311212f, 0.3684668300f, 0.9296408958f,
+  -0.2176042746f, 0.9760370790f, -0.7284643904f, 0.6850836678f,
+  -0.9875439418f, 0.1573434556f, -0.9052967593f, -0.4247796812f,
+  -0.5101500967f, -0.8600853904f, 0.8263210628f, 0.5631993440f,
+  0.3656129978f, 0.9307669611f, -0.2220936210f, 0.9750253451f,
+  -0.7326542717f, 0.6806009978f, -0.9887216920f, 0.1497645347f,
+  -0.9013488470f, -0.4330938189f, -0.5008853826f, -0.8655136241f,
+  0.8254561540f, 0.5644662415f, 0.3627557244f, 0.9318842656f,
+  -0.2265782638f, 0.9739929622f, -0.7368165689f, 0.6760927036f,
+  -0.9898412785f, 0.1421768035f, -0.8973245807f, -0.4413712687f,
+  -0.4915629161f, -0.8708420635f, 0.8245893028f, 0.5657318108f,
+  0.3598950365f, 0.9329927988f, -0.2310581083f, 0.9729399522f,
+  -0.7409511254f, 0.6715589548f, -0.9909026354f, 0.1345807085f,
+  -0.8932243012f, -0.4496113297f, -0.4821837721f, -0.8760700942f,
+  0.8237205112f, 0.5669960488f, 0.3570309612f, 0.9340925504f,
+  -0.2355330594f, 0.9718663375f, -0.7450577854f, 0.6669999223f,
+  -0.9919057004f, 0.1269766965f, -0.8890483559f, -0.4578133036f,
+  -0.4727490320f, -0.8811971135f, 0.8228497814f, 0.5682589527f,
+  0.3541635254f, 0.9351835099f, -0.2400030224f, 0.9707721407f,
+  -0.7491363945f, 0.6624157776f, -0.9928504145f, 0.1193652148f,
+  -0.8847970984f, -0.4659764958f, -0.4632597836f, -0.8862225301f,
+  0.8219771153f, 0.5695205193f, 0.3512927561f, 0.9362656672f,
+  -0.2444679027f, 0.9696573851f, -0.7531867990f, 0.6578066933f,
+  -0.9937367219f, 0.1117467112f, -0.8804708891f, -0.4741002147f,
+  -0.4537171210f, -0.8911457648f, 0.8211025150f, 0.5707807459f,
+  0.3484186802f, 0.9373390119f, -0.2489276057f, 0.9685220943f,
+  -0.7572088465f, 0.6531728430f, -0.9945645707f, 0.1041216339f,
+  -0.8760700942f, -0.4821837721f, -0.4441221446f, -0.8959662498f,
+  0.8202259826f, 0.5720396293f, 0.3455413250f, 0.9384035341f,
+  -0.2533820370f, 0.9673662922f, -0.7612023855f, 0.6485144010f,
+  -0.9953339121f, 0.0964904314f, -0.8715950867f, -0.4902264833f,
+  -0.4344759606f, -0.9006834292f, 0.8193475201f, 0.5732971667f,
+  0.3426607173f, 0.9394592236f, -0.2578311022f, 0.9661900034f,
+  -0.7651672656f, 0.6438315429f, -0.9960447009f, 0.0888535526f,
+  -0.8670462455f, -0.4982276670f, -0.4247796812f, -0.9052967593f,
+  0.8184671296f, 0.5745533550f, 0.3397768844f, 0.9405060706f,
+  -0.2622747070f, 0.9649932529f, -0.7691033376f, 0.6391244449f,
+  -0.9966968952f, 0.0812114468f, -0.8624239561f, -0.5061866453f,
+  -0.4150344245f, -0.9098057081f, 0.8175848132f, 0.5758081914f,
+  0.3368898534f, 0.9415440652f, -0.2667127575f, 0.9637760658f,
+  -0.7730104534f, 0.6343932842f, -0.9972904567f, 0.0735645636f,
+  -0.8577286100f, -0.5141027442f, -0.4052413140f, -0.9142097557f,
+  0.8167005729f, 0.5770616729f, 0.3339996514f, 0.9425731976f,
+  -0.2711451595f, 0.9625384680f, -0.7768884657f, 0.6296382389f,
+  -0.9978253504f, 0.0659133528f, -0.8529606049f, -0.5219752929f,
+  -0.3954014789f, -0.9185083943f, 0.8158144108f, 0.5783137964f,
+  0.3311063058f, 0.9435934582f, -0.2755718193f, 0.9612804858f,
+  -0.7807372286f, 0.6248594881f, -0.9983015449f, 0.0582582645f,
+  -0.8481203448f, -0.5298036247f, -0.3855160538f, -0.9227011283f,
+  0.8149263291f, 0.5795645591f, 0.3282098436f, 0.9446048373f,
+  -0.2799926431f, 0.9600021457f, -0.7845565972f, 0.6200572118f,
+  -0.9987190122f, 0.0505997490f, -0.8432082396f, -0.5375870763f,
+  -0.3755861785f, -0.9267874743f, 0.8140363297f, 0.5808139581f,
+  0.3253102922f, 0.9456073254f, -0.2844075372f, 0.9587034749f,
+  -0.7883464276f, 0.6152315906f, -0.9990777278f, 0.0429382569f,
+  -0.8382247056f, -0.5453249884f, -0.3656129978f, -0.9307669611f,
+  0.8131444148f, 0.5820619903f, 0.3224076788f, 0.9466009131f,
+  -0.2888164082f, 0.9573845008f, -0.7921065773f, 0.6103828063f,
+  -0.9993776704f, 0.0352742389f, -0.8331701647f, -0.5530167056f,
+  -0.3555976617f, -0.9346391298f, 0.8122505866f, 0.5833086529f,
+  0.3195020308f, 0.9475855910f, -0.2932191627f, 0.9560452513f,
+  -0.7958369046f, 0.6055110414f, -0.9996188225f, 0.0276081458f,
+  -0.8280450453f, -0.5606615762f, -0.3455413250f, -0.9384035341f,
+  0.8113548470f, 0.5845539430f, 0.3165933756f, 0.9485613499f,
+  -0.2976157074f, 0.9546857549f, -0.7995372691f, 0.6006164794f,
+  -0.9998011699f, 0.0199404286f, -0.8228497814f, -0.5682589527f,
+  -0.3354451471f, -0.9420597398f, 0.8104571983f, 0.5857978575f,
+  0.3136817404f, 0.9495281806f, -0.3020059493f, 0.9533060404f,
+  -0.8032075315f, 0.5956993045f, -0.9999247018f, 0.0122715383f,
+  -0.8175848132f, -0.5758081914f, -0.3253102922f, -0.9456073254f,
+  0.8095576424f, 0.5870403935f, 0.3107671527f, 0.9504860739f,
+  -0.3063897954f, 0.9519061368f, -0.8068475535f, 0.5907597019f,
+  -0.9999894111f, 0.0046019261f, -0.8122505866f, -0.5833086529f,
+  -0.3151379288f, -0.9490458819f, 0.8086561816f, 0.5882815482f,
+  0.3078496400f, 0.9514350210f, -0.3107671527f, 0.9504860739f,
+  -0.8104571983f, 0.5857978575f, -0.9999952938f, -0.0030679568f,
+  -0.8068475535f, -0.5907597019f, -0.3049292297f, -0.9523750127f,
+  0.8077528179f, 0.5895213186f, 0.3049292297f, 0.9523750127f,
+  -0.3151379288f, 0.9490458819f, -0.8140363297f, 0.5808139581f,
+  -0.9999423497f, -0.0107376592f, -0.8013761717f, -0.5981607070f,
+  -0.2946853722f, -0.9555943341f, 0.8068475535f, 0.5907597019f,
+  0.3020059493f, 0.9533060404f, -0.3195020308f, 0.9475855910f,
+  -0.8175848132f, 0.5758081914f, -0.9998305818f, -0.0184067299f,
+  -0.7958369046f, -0.6055110414f, -0.2844075372f, -0.9587034749f,
+  0.8059403906f, 0.5919966950f, 0.2990798263f, 0.9542280951f,
+  -0.3238593665f, 0.9461052324f, -0.8211025150f, 0.5707807459f,
+  -0.9996599967f, -0.0260747178f, -0.7902302214f, -0.6128100824f,
+  -0.2740969099f, -0.9617020765f, 0.8050313311f, 0.5932322950f,
+  0.2961508882f, 0.9551411683f, -0.3282098436f, 0.9446048373f,
+  -0.8245893028f, 0.5657318108f, -0.9994306046f, -0.0337411719f,
+  -0.7845565972f, -0.6200572118f, -0.2637546790f, -0.9645897933f,
+  0.8041203774f, 0.5944664992f, 0.2932191627f, 0.9560452513f,
+  -0.3325533699f, 0.9430844375f, -0.8280450453f, 0.5606615762f,
+  -0.9991424187f, -0.0414056410f, -0.7788165124f, -0.6272518155f,
+  -0.2533820370f, -0.9673662922f, 0.8032075315f, 0.5956993045f,
+  0.2902846773f, 0.9569403357f, -0.3368898534f, 0.9415440652f,
+  -0.8314696123f, 0.5555702330f, -0.9987954562f, -0.0490676743f,
+  -0.7730104534f, -0.6343932842f, -0.2429801799f, -0.9700312532f,
+  0.8022927955f, 0.5969307081f, 0.2873474595f, 0.9578264130f,
+  -0.3412192023f, 0.9399837530f, -0.8348628750f, 0.5504579729f,
+  -0.9983897374f, -0.0567268212f, -0.7671389119f, -0.6414810128f,
+  -0.2325503070f, -0.9725843689f, 0.8013761717f, 0.5981607070f,
+  0.2844075372f, 0.9587034749f, -0.3455413250f, 0.9384035341f,
+  -0.8382247056f, 0.5453249884f, -0.9979252862f, -0.0643826309f,
+  -0.7612023855f, -0.6485144010f, -0.2220936210f, -0.9750253451f,
+  0.8004576622f, 0.5993892984f, 0.2814649379f, 0.9595715131f,
+  -0.3498561298f, 0.9368034417f, -0.8415549774f, 0.5401714727f,
+  -0.9974021299f, -0.0720346532f, -0.7552013769f, -0.6554928530f,
+  -0.2116113274f, -0.9773539001f, 0.7995372691f, 0.6006164794f,
+  0.2785196894f, 0.9604305194f, -0.3541635254f, 0.9351835099f,
+  -0.8448535652f, 0.5349976199f, -0.9968202993f, -0.0796824380f,
+  -0.7491363945f, -0.6624157776f, -0.2011046348f, -0.9795697657f,
+  0.7986149946f, 0.6018422471f, 0.2755718193f, 0.9612804858f,
+  -0.3584634206f, 0.9335437730f, -0.8481203448f, 0.5298036247f,
+  -0.9961798286f, -0.0873255352f, -0.7430079521f, -0.6692825883f,
+  -0.1905747548f, -0.9816726862f, 0.7976908409f, 0.6030665985f,
+  0.2726213554f, 0.9621214043f, -0.3627557244f, 0.9318842656f,
+  -0.8513551931f, 0.5245896827f, -0.9954807555f, -0.0949634953f,
+  -0.7368165689f, -0.6760927036f, -0.1800229014f, -0.9836624192f,
+  0.7967648102f, 0.6042895309f, 0.2696683256f, 0.9629532669f,
+  -0.3670403457f, 0.9302050229f, -0.8545579884f, 0.5193559902f,
+  -0.9947231211f, -0.1025958690f, -0.7305627692f, -0.6828455464f,
+  -0.1694502912f, -0.9855387353f, 0.7958369046f, 0.6055110414f,
+  0.2667127575f, 0.9637760658f, -0.3713171940f, 0.9285060805f,
+  -0.8577286100f, 0.5141027442f, -0.9939069700f, -0.1102222073f,
+  -0.7242470830f, -0.6895405447f, -0.1588581433f, -0.9873014182f,
+  0.7949071263f, 0.6067311270f, 0.2637546790f, 0.9645897933f,
+  -0.3755861785f, 0.9267874743f, -0.8608669386f, 0.5088301425f,
+  -0.9930323502f, -0.1178420615f, -0.7178700451f, -0.6961771315f,
+  -0.1482476790f, -0.9889502645f, 0.7939754776f, 0.6079497850f,
+  0.2607941179f, 0.9653944417f, -0.3798472089f, 0.9250492408f,
+  -0.8639728561f, 0.5035383837f, -0.9920993131f, -0.1254549834f,
+  -0.7114321957f, -0.7027547445f, -0.1376201216f, -0.9904850843f,
+  0.7930419605f, 0.6091670123f, 0.2578311022f, 0.9661900034f,
+  -0.3841001950f, 0.9232914167f, -0.8670462455f, 0.4982276670f,
+  -0.9911079137f, -0.1330605252f, -0.7049340804f, -0.7092728264f,
+  -0.1269766965f, -0.9919057004f, 0.7921065773f, 0.6103828063f,
+  0.2548656596f, 0.9669764710f, -0.3883450467f, 0.9215140393f,
+  -0.8700869911f, 0.4928981922f, -0.9900582103f, -0.1406582393f,
+  -0.6983762494f, -0.7157308253f, -0.1163186309f, -0.9932119492f,
+  0.7911693302f, 0.6115971639f, 0.2518978182f, 0.9677538371f,
+  -0.3925816741f, 0.9197171463f, -0.8730949784f, 0.4875501601f,
+  -0.9889502645f, -0.1482476790f, -0.6917592584f, -0.7221281939f,
+  -0.1056471537f, -0.9944036801f, 0.7902302214f, 0.6128100824f,
+  0.2489276057f, 0.9685220943f, -0.3968099874f, 0.9179007756f,
+  -0.8760700942f, 0.4821837721f, -0.9877841416f, -0.1558283977f,
+  -0.6850836678f, -0.7284643904f, -0.0949634953f, -0.9954807555f,
+  0.7892892532f, 0.6140215589f, 0.2459550503f, 0.9692812354f,
+  -0.4010298972f, 0.9160649658f, -0.8790122264f, 0.4767992301f,
+  -0.9865599103f, -0.1633999494f, -0.6783500431f, -0.7347388781f,
+  -0.0842688876f, -0.9964430514f, 0.7883464276f, 0.6152315906f,
+  0.2429801799f, 0.9700312532f, -0.4052413140f, 0.9142097557f,
+  -0.8819212643f, 0.4713967368f, -0.9852776424f, -0.1709618888f,
+  -0.6715589548f, -0.7409511254f, -0.0735645636f, -0.9972904567f,
+  0.7874017470f, 0.6164401745f, 0.2400030224f, 0.9707721407f,
+  -0.4094441487f, 0.9123351846f, -0.8847970984f, 0.4659764958f,
+  -0.9839374134f, -0.1785137709f, -0.6647109782f, -0.7471006060f,
+  -0.0628517576f, -0.9980228738f, 0.7864552136f, 0.6176473079f,
+  0.2370236060f, 0.9715038910f, -0.4136383122f, 0.9104412923f,
+  -0.8876396204f, 0.4605387110f, -0.9825393023f, -0.1860551517f,
+  -0.6578066933f, -0.7531867990f, -0.0521317047f, -0.9986402182f,
+  0.7855068296f, 0.6188529880f, 0.2340419586f, 0.9722264971f,
+  -0.4178237158f, 0.9085281187f, -0.8904487232f, 0.4550835871f,
+  -0.9810833912f, -0.1935855873f, -0.6508466850f, -0.7592091890f,
+  -0.0414056410f, -0.9991424187f, 0.7845565972f, 0.6200572118f,
+  0.2310581083f, 0.9729399522f, -0.4220002708f, 0.9065957045f,
+  -0.8932243012f, 0.4496113297f, -0.9795697657f, -0.2011046348f,
+  -0.6438315429f, -0.7651672656f, -0.0306748032f, -0.9995294175f,
+  0.7836045186f, 0.6212599765f, 0.2280720832f, 0.9736442497f,
+  -0.4261678887f, 0.9046440906f, -0.8959662498f, 0.4441221446f,
+  -0.9779985149f, -0.2086118520f, -0.6367618612f, -0.7710605243f,
+  -0.0199404286f, -0.9998011699f, 0.7826505962f, 0.6224612794f,
+  0.2250839114f, 0.9743393828f, -0.4303264813f, 0.9026733182f,
+  -0.8986744657f, 0.4386162385f, -0.9763697313f, -0.2161067971f,
+  -0.6296382389f, -0.7768884657f, -0.0092037548f, -0.9999576446f,
+  0.7816948321f, 0.6236611175f, 0.2220936210f, 0.9750253451f,
+  -0.4344759606f, 0.9006834292f, -0.9013488470f, 0.4330938189f,
+  -0.9746835107f, -0.2235890292f, -0.6224612794f, -0.7826505962f,
+  0.0015339802f, -0.9999988235f, 0.7807372286f, 0.6248594881f,
+  0.2191012402f, 0.9757021300f, -0.4386162385f, 0.8986744657f,
+  -0.9039892931f, 0.4275550934f, -0.9729399522f, -0.2310581083f,
+  -0.6152315906f, -0.7883464276f, 0.0122715383f, -0.9999247018f,
+  0.7797777879f, 0.6260563884f, 0.2161067971f, 0.9763697313f,
+  -0.4427472276f, 0.8966464702f, -0.9065957045f, 0.4220002708f,
+  -0.9711391584f, -0.2385135948f, -0.6079497850f, -0.7939754776f,
+  0.0230076815f, -0.9997352883f, 0.7788165124f, 0.6272518155f,
+  0.2131103199f, 0.9770281427f, -0.4468688402f, 0.8945994856f,
+  -0.9091679831f, 0.4164295601f, -0.9692812354f, -0.2459550503f,
+  -0.6006164794f, -0.7995372691f, 0.0337411719f, -0.9994306046f,
+  0.7778534042f, 0.6284457666f, 0.2101118369f, 0.9776773578f,
+  -0.4509809890f, 0.8925335554f, -0.9117060320f, 0.4108431711f,
+  -0.9673662922f, -0.2533820370f, -0.5932322950f, -0.8050313311f,
+  0.0444707719f, -0.9990106859f, 0.7768884657f, 0.6296382389f,
+  0.2071113762f, 0.9783173707f, -0.4550835871f, 0.8904487232f,
+  -0.9142097557f, 0.4052413140f, -0.9653944417f, -0.2607941179f,
+  -0.5857978575f, -0.8104571983f, 0.0551952443f, -0.9984755806f,
+  0.7759216990f, 0.6308292296f, 0.2041089661f, 0.9789481753f,
+  -0.4591765475f, 0.8883450333f, -0.9166790599f, 0.3996241998f,
+  -0.9633657998f, -0.2681908571f, -0.5783137964f, -0.8158144108f,
+  0.0659133528f, -0.9978253504f, 0.7749531066f, 0.6320187359f,
+  0.2011046348f, 0.9795697657f, -0.4632597836f, 0.8862225301f,
+  -0.9191138517f, 0.3939920401f, -0.9612804858f, -0.2755718193f,
+  -0.5707807459f, -0.8211025150f, 0.0766238614f, -0.9970600703f,
+  0.7739826906f, 0.6332067551f, 0.1980984107f, 0.9801821360f,
+  -0.4673332087f, 0.8840812587f, -0.9215140393f, 0.3883450467f,
+  -0.9591386225f, -0.2829365705f, -0.5631993440f, -0.8263210628f,
+  0.0873255352f, -0.9961798286f, 0.7730104534f, 0.6343932842f,
+  0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  -0.9238795325f, 0.3826834324f, -0.9569403357f, -0.2902846773f,
+  -0.5555702330f, -0.8314696123f, 0.0980171403f, -0.9951847267f,
+  0.7720363972f, 0.6355783205f, 0.1920803970f, 0.9813791933f,
+  -0.4754502817f, 0.8797425928f, -0.9262102421f, 0.3770074102f,
+  -0.9546857549f, -0.2976157074f, -0.5478940592f, -0.8365477272f,
+  0.1086974440f, -0.9940748793f, 0.7710605243f, 0.6367618612f,
+  0.1890686641f, 0.9819638691f, -0.4794937577f, 0.8775452902f,
+  -0.9285060805f, 0.3713171940f, -0.9523750127f, -0.3049292297f,
+  -0.5401714727f, -0.8415549774f, 0.1193652148f, -0.9928504145f,
+  0.7700828370f, 0.6379439036f, 0.1860551517f, 0.9825393023f,
+  -0.4835270789f, 0.8753294031f, -0.9307669611f, 0.3656129978f,
+  -0.9500082450f, -0.3122248139f, -0.5324031279f, -0.8464909388f,
+  0.1300192227f, -0.9915114733f, 0.7691033376f, 0.6391244449f,
+  0.1830398880f, 0.9831054874f, -0.4875501601f, 0.8730949784f,
+  -0.9329927988f, 0.3598950365f, -0.9475855910f, -0.3195020308f,
+  -0.5245896827f, -0.8513551931f, 0.1406582393f, -0.9900582103f,
+  0.7681220285f, 0.6403034822f, 0.1800229014f, 0.9836624192f,
+  -0.4915629161f, 0.8708420635f, -0.9351835099f, 0.3541635254f,
+  -0.9451071933f, -0.3267604523f, -0.5167317990f, -0.8561473284f,
+  0.1512810380f, -0.9884907929f, 0.7671389119f, 0.6414810128f,
+  0.1770042204f, 0.9842100924f, -0.4955652618f, 0.8685707060f,
+  -0.9373390119f, 0.3484186802f, -0.9425731976f, -0.3339996514f,
+  -0.5088301425f, -0.8608669386f, 0.1618863938f, -0.9868094018f,
+  0.7661539902f, 0.6426570340f, 0.1739838734f, 0.9847485018f,
+  -0.4995571125f, 0.8662809540f, -0.9394592236f, 0.3426607173f,
+  -0.9399837530f, -0.3412192023f, -0.5008853826f, -0.8655136241f,
+  0.1724730840f, -0.9850142310f, 0.7651672656f, 0.6438315429f,
+  0.1709618888f, 0.9852776424f, -0.5035383837f, 0.8639728561f,
+  -0.9415440652f, 0.3368898534f, -0.9373390119f, -0.3484186802f,
+  -0.4928981922f, -0.8700869911f, 0.1830398880f, -0.9831054874f,
+  0.7641787405f, 0.6450045368f, 0.1679382950f, 0.9857975092f,
+  -0.5075089911f, 0.8616464611f, -0.9435934582f, 0.3311063058f,
+  -0.9346391298f, -0.3555976617f, -0.4848692480f, -0.8745866523f,
+  0.1935855873f, -0.9810833912f, 0.7631884173f, 0.6461760130f,
+  0.1649131205f, 0.9863080972f, -0.5114688504f, 0.8593018184f,
+  -0.9456073254f, 0.3253102922f, -0.9318842656f, -0.3627557244f,
+  -0.4767992301f, -0.8790122264f, 0.2041089661f, -0.9789481753f,
+  0.7621962981f, 0.6473459686f, 0.1618863938f, 0.9868094018f,
+  -0.5154178780f, 0.8569389774f, -0.9475855910f, 0.3195020308f,
+  -0.9290745813f, -0.3698924471f, -0.4686888220f, -0.8833633387f,
+  0.2146088110f, -0.9767000861f, 0.7612023855f, 0.6485144010f,
+  0.1588581433f, 0.9873014182f, -0.5193559902f, 0.8545579884f,
+  -0.9495281806f, 0.3136817404f, -0.9262102421f, -0.3770074102f,
+  -0.4605387110f, -0.8876396204f, 0.2250839114f, -0.9743393828f,
+  0.7602066817f, 0.6496813074f, 0.1558283977f, 0.9877841416f,
+  -0.5232831035f, 0.8521589016f, -0.9514350210f, 0.3078496400f,
+  -0.9232914167f, -0.3841001950f, -0.4523495872f, -0.8918407094f,
+  0.2355330594f, -0.9718663375f, 0.7592091890f, 0.6508466850f,
+  0.1527971853f, 0.9882575677f, -0.5271991348f, 0.8497417680f,
+  -0.9533060404f, 0.3020059493f, -0.9203182767f, -0.3911703843f,
+  -0.4441221446f, -0.8959662498f, 0.2459550503f, -0.9692812354f,
+  0.7582099098f, 0.6520105311f, 0.1497645347f, 0.9887216920f,
+  -0.5311040012f, 0.8473066387f, -0.9551411683f, 0.2961508882f,
+  -0.9172909970f, -0.3982175622f, -0.4358570799f, -0.9000158920f,
+  0.2563486825f, -0.9665843745f, 0.7572088465f, 0.6531728430f,
+  0.1467304745f, 0.9891765100f, -0.5349976199f, 0.8448535652f,
+  -0.9569403357f, 0.2902846773f, -0.9142097557f, -0.4052413140f,
+  -0.4275550934f, -0.9039892931f, 0.2667127575f, -0.9637760658f,
+  0.7562060014f, 0.6543336178f, 0.1436950332f, 0.9896220175f,
+  -0.5388799085f, 0.8423825996f, -0.9587034749f, 0.2844075372f,
+  -0.9110747341f, -0.4122412267f, -0.4192168884f, -0.9078861165f,
+  0.2770460803f, -0.9608566331f, 0.7552013769f, 0.6554928530f,
+  0.1406582393f, 0.9900582103f, -0.5427507849f, 0.8398937942f,
+  -0.9604305194f, 0.2785196894f, -0.9078861165f, -0.4192168884f,
+  -0.4108431711f, -0.9117060320f, 0.2873474595f, -0.9578264130f,
+  0.7541949753f, 0.6566505457f, 0.1376201216f, 0.9904850843f,
+  -0.5466101669f, 0.8373872016f, -0.9621214043f, 0.2726213554f,
+  -0.9046440906f, -0.4261678887f, -0.4024346509f, -0.9154487161f,
+  0.2976157074f, -0.9546857549f, 0.7531867990f, 0.6578066933f,
+  0.1345807085f, 0.9909026354f, -0.5504579729f, 0.8348628750f,
+  -0.9637760658f, 0.2667127575f, -0.9013488470f, -0.4330938189f,
+  -0.3939920401f, -0.9191138517f, 0.3078496400f, -0.9514350210f,
+  0.7521768504f, 0.6589612930f, 0.1315400287f, 0.9913108598f,
+  -0.5542941215f, 0.8323208678f, -0.9653944417f, 0.2607941179f,
+  -0.8980005797f, -0.4399942713f, -0.3855160538f, -0.9227011283f,
+  0.3180480774f, -0.9480745859f, 0.7511651319f, 0.6601143421f,
+  0.1284981108f, 0.9917097537f, -0.5581185312f, 0.8297612338f,
+  -0.9669764710f, 0.2548656596f, -0.8945994856f, -0.4468688402f,
+  -0.3770074102f, -0.9262102421f, 0.3282098436f, -0.9446048373f,
+  0.7501516458f, 0.6612658378f, 0.1254549834f, 0.9920993131f,
+  -0.5619311212f, 0.8271840273f, -0.9685220943f, 0.2489276057f,
+  -0.8911457648f, -0.4537171210f, -0.3684668300f, -0.9296408958f,
+  0.3383337670f, -0.9410261751f, 0.7491363945f, 0.6624157776f,
+  0.1224106752f, 0.9924795346f, -0.5657318108f, 0.8245893028f,
+  -0.9700312532f, 0.2429801799f, -0.8876396204f, -0.4605387110f,
+  -0.3598950365f, -0.9329927988f, 0.3484186802f, -0.9373390119f,
+  0.7481193805f, 0.6635641586f, 0.1193652148f, 0.9928504145f,
+  -0.5695205193f, 0.8219771153f, -0.9715038910f, 0.2370236060f,
+  -0.8840812587f, -0.4673332087f, -0.3512927561f, -0.9362656672f,
+  0.3584634206f, -0.9335437730f, 0.7471006060f, 0.6647109782f,
+  0.1163186309f, 0.9932119492f, -0.5732971667f, 0.8193475201f,
+  -0.9729399522f, 0.2310581083f, -0.8804708891f, -0.4741002147f,
+  -0.3426607173f, -0.9394592236f, 0.3684668300f, -0.9296408958f,
+  0.7460800735f, 0.6658562337f, 0.1132709522f, 0.9935641355f,
+  -0.5770616729f, 0.8167005729f, -0.9743393828f, 0.2250839114f,
+  -0.8768087238f, -0.4808393306f, -0.3339996514f, -0.9425731976f,
+  0.3784277548f, -0.9256308305f, 0.7450577854f, 0.6669999223f,
+  0.1102222073f, 0.9939069700f, -0.5808139581f, 0.8140363297f,
+  -0.9757021300f, 0.2191012402f, -0.8730949784f, -0.4875501601f,
+  -0.3253102922f, -0.9456073254f, 0.3883450467f, -0.9215140393f,
+  0.7440337442f, 0.6681420414f, 0.1071724250f, 0.9942404495f,
+  -0.5845539430f, 0.8113548470f, -0.9770281427f, 0.2131103199f,
+  -0.8693298713f, -0.4942323085f, -0.3165933756f, -0.9485613499f,
+  0.3982175622f, -0.9172909970f, 0.7430079521f, 0.6692825883f,
+  0.1041216339f, 0.9945645707f, -0.5882815482f, 0.8086561816f,
+  -0.9783173707f, 0.2071113762f, -0.8655136241f, -0.5008853826f,
+  -0.3078496400f, -0.9514350210f, 0.4080441629f, -0.9129621904f,
+  0.7419804117f, 0.6704215604f, 0.1010698628f, 0.9948793308f,
+  -0.5919966950f, 0.8059403906f, -0.9795697657f, 0.2011046348f,
+  -0.8616464611f, -0.5075089911f, -0.2990798263f, -0.9542280951f,
+  0.4178237158f, -0.9085281187f, 0.7409511254f, 0.6715589548f,
+  0.0980171403f, 0.9951847267f, -0.5956993045f, 0.8032075315f,
+  -0.9807852804f, 0.1950903220f, -0.8577286100f, -0.5141027442f,
+  -0.2902846773f, -0.9569403357f, 0.4275550934f, -0.9039892931f,
+  0.7399200955f, 0.6726947691f, 0.0949634953f, 0.9954807555f,
+  -0.5993892984f, 0.8004576622f, -0.9819638691f, 0.1890686641f,
+  -0.8537603011f, -0.5206662541f, -0.2814649379f, -0.9595715131f,
+  0.4372371737f, -0.8993462370f, 0.7388873245f, 0.6738290004f,
+  0.0919089565f, 0.9957674145f, -0.6030665985f, 0.7976908409f,
+  -0.9831054874f, 0.1830398880f, -0.8497417680f, -0.5271991348f,
+  -0.2726213554f, -0.9621214043f, 0.4468688402f, -0.8945994856f,
+  0.7378528148f, 0.6749616461f, 0.0888535526f, 0.9960447009f,
+  -0.6067311270f, 0.7949071263f, -0.9842100924f, 0.1770042204f,
+  -0.8456732470f, -0.5337010018f, -0.2637546790f, -0.9645897933f,
+  0.4564489824f, -0.8897495864f, 0.7368165689f, 0.6760927036f,
+  0.0857973123f, 0.9963126122f, -0.6103828063f, 0.7921065773f,
+  -0.9852776424f, 0.1709618888f, -0.8415549774f, -0.5401714727f,
+  -0.2548656596f, -0.9669764710f, 0.4659764958f, -0.8847970984f,
+  0.7357785892f, 0.6772221701f, 0.0827402645f, 0.9965711458f,
+  -0.6140215589f, 0.7892892532f, -0.9863080972f, 0.1649131205f,
+  -0.8373872016f, -0.5466101669f, -0.2459550503f, -0.9692812354f,
+  0.4754502817f, -0.8797425928f, 0.7347388781f, 0.6783500431f,
+  0.0796824380f, 0.9968202993f, -0.6176473079f, 0.7864552136f,
+  -0.9873014182f, 0.1588581433f, -0.8331701647f, -0.5530167056f,
+  -0.2370236060f, -0.9715038910f, 0.4848692480f, -0.8745866523f,
+  0.7336974381f, 0.6794763199f, 0.0766238614f, 0.9970600703f,
+  -0.6212599765f, 0.7836045186f, -0.9882575677f, 0.1527971853f,
+  -0.8289041148f, -0.5593907119f, -0.2280720832f, -0.9736442497f,
+  0.4942323085f, -0.8693298713f, 0.7326542717f, 0.6806009978f,
+  0.0735645636f, 0.9972904567f, -0.6248594881f, 0.7807372286f,
+  -0.9891765100f, 0.1467304745f, -0.8245893028f, -0.5657318108f,
+  -0.2191012402f, -0.9757021300f, 0.5035383837f, -0.8639728561f,
+  0.7316093812f, 0.6817240742f, 0.0705045734f, 0.9975114561f,
+  -0.6284457666f, 0.7778534042f, -0.9900582103f, 0.1406582393f,
+  -0.8202259826f, -0.5720396293f, -0.2101118369f, -0.9776773578f,
+  0.5127864006f, -0.8585162243f, 0.7305627692f, 0.6828455464f,
+  0.0674439196f, 0.9977230666f, -0.6320187359f, 0.7749531066f,
+  -0.9909026354f, 0.1345807085f, -0.8158144108f, -0.5783137964f,
+  -0.2011046348f, -0.9795697657f, 0.5219752929f, -0.8529606049f,
+  0.7295144381f, 0.6839654118f, 0.0643826309f, 0.9979252862f,
+  -0.6355783205f, 0.7720363972f, -0.9917097537f, 0.1284981108f,
+  -0.8113548470f, -0.5845539430f, -0.1920803970f, -0.9813791933f,
+  0.5311040012f, -0.8473066387f, 0.7284643904f, 0.6850836678f,
+  0.0613207363f, 0.9981181129f, -0.6391244449f, 0.7691033376f,
+  -0.9924795346f, 0.1224106752f, -0.8068475535f, -0.5907597019f,
+  -0.1830398880f, -0.9831054874f, 0.5401714727f, -0.8415549774f,
+  0.7274126286f, 0.6862003117f, 0.0582582645f, 0.9983015449f,
+  -0.6426570340f, 0.7661539902f, -0.9932119492f, 0.1163186309f,
+  -0.8022927955f, -0.5969307081f, -0.1739838734f, -0.9847485018f,
+  0.5491766622f, -0.8357062844f, 0.7263591551f, 0.6873153409f,
+  0.0551952443f, 0.9984755806f, -0.6461760130f, 0.7631884173f,
+  -0.9939069700f, 0.1102222073f, -0.7976908409f, -0.6030665985f,
+  -0.1649131205f, -0.9863080972f, 0.5581185312f, -0.8297612338f,
+  0.7253039724f, 0.6884287528f, 0.0521317047f, 0.9986402182f,
+  -0.6496813074f, 0.7602066817f, -0.9945645707f, 0.1041216339f,
+  -0.7930419605f, -0.6091670123f, -0.1558283977f, -0.9877841416f,
+  0.5669960488f, -0.8237205112f, 0.7242470830f, 0.6895405447f,
+  0.0490676743f, 0.9987954562f, -0.6531728430f, 0.7572088465f,
+  -0.9951847267f, 0.0980171403f, -0.7883464276f, -0.6152315906f,
+  -0.1467304745f, -0.9891765100f, 0.5758081914f, -0.8175848132f,
+  0.7231884893f, 0.6906507141f, 0.0460031821f, 0.9989412932f,
+  -0.6566505457f, 0.7541949753f, -0.9957674145f, 0.0919089565f,
+  -0.7836045186f, -0.6212599765f, -0.1376201216f, -0.9904850843f,
+  0.5845539430f, -0.8113548470f, 0.7221281939f, 0.6917592584f,
+  0.0429382569f, 0.9990777278f, -0.6601143421f, 0.7511651319f,
+  -0.9963126122f, 0.0857973123f, -0.7788165124f, -0.6272518155f,
+  -0.1284981108f, -0.9917097537f, 0.5932322950f, -0.8050313311f,
+  0.7210661993f, 0.6928661748f, 0.0398729276f, 0.9992047586f,
+  -0.6635641586f, 0.7481193805f, -0.9968202993f, 0.0796824380f,
+  -0.7739826906f, -0.6332067551f, -0.1193652148f, -0.9928504145f,
+  0.6018422471f, -0.7986149946f, 0.7200025080f, 0.6939714609f,
+  0.0368072229f, 0.9993223846f, -0.6669999223f, 0.7450577854f,
+  -0.9972904567f, 0.0735645636f, -0.7691033376f, -0.6391244449f,
+  -0.1102222073f, -0.9939069700f, 0.6103828063f, -0.7921065773f,
+  0.7189371224f, 0.6950751140f, 0.0337411719f, 0.9994306046f,
+  -0.6704215604f, 0.7419804117f, -0.9977230666f, 0.0674439196f,
+  -0.7641787405f, -0.6450045368f, -0.1010698628f, -0.9948793308f,
+  0.6188529880f, -0.7855068296f, 0.7178700451f, 0.6961771315f,
+  0.0306748032f, 0.9995294175f, -0.6738290004f, 0.7388873245f,
+  -0.9981181129f, 0.0613207363f, -0.7592091890f, -0.6508466850f,
+  -0.0919089565f, -0.9957674145f, 0.6272518155f, -0.7788165124f,
+  0.7168012785f, 0.6972775108f, 0.0276081458f, 0.9996188225f,
+  -0.6772221701f, 0.7357785892f, -0.9984755806f, 0.0551952443f,
+  -0.7541949753f, -0.6566505457f, -0.0827402645f, -0.9965711458f,
+  0.6355783205f, -0.7720363972f, 0.7157308253f, 0.6983762494f,
+  0.0245412285f, 0.9996988187f, -0.6806009978f, 0.7326542717f,
+  -0.9987954562f, 0.0490676743f, -0.7491363945f, -0.6624157776f,
+  -0.0735645636f, -0.9972904567f, 0.6438315429f, -0.7651672656f,
+  0.7146586879f, 0.6994733446f, 0.0214740803f, 0.9997694054f,
+  -0.6839654118f, 0.7295144381f, -0.9990777278f, 0.0429382569f,
+  -0.7440337442f, -0.6681420414f, -0.0643826309f, -0.9979252862f,
+  0.6520105311f, -0.7582099098f, 0.7135848688f, 0.7005687939f,
+  0.0184067299f, 0.9998305818f, -0.6873153409f, 0.7263591551f,
+  -0.9993223846f, 0.0368072229f, -0.7388873245f, -0.6738290004f,
+  -0.0551952443f, -0.9984755806f, 0.6601143421f, -0.7511651319f,
+  0.7125093706f, 0.7016625947f, 0.0153392063f, 0.9998823475f,
+  -0.6906507141f, 0.7231884893f, -0.9995294175f, 0.0306748032f,
+  -0.7336974381f, -0.6794763199f, -0.0460031821f, -0.9989412932f,
+  0.6681420414f, -0.7440337442f, 0.7114321957f, 0.7027547445f,
+  0.0122715383f, 0.9999247018f, -0.6939714609f, 0.7200025080f,
+  -0.9996988187f, 0.0245412285f, -0.7284643904f, -0.6850836678f,
+  -0.0368072229f, -0.9993223846f, 0.6760927036f, -0.7368165689f,
+  0.7103533469f, 0.7038452405f, 0.0092037548f, 0.9999576446f,
+  -0.6972775108f, 0.7168012785f, -0.9998305818f, 0.0184067299f,
+  -0.7231884893f, -0.6906507141f, -0.0276081458f, -0.9996188225f,
+  0.6839654118f, -0.7295144381f, 0.7092728264f, 0.7049340804f,
+  0.0061358846f, 0.9999811753f, -0.7005687939f, 0.7135848688f,
+  -0.9999247018f, 0.0122715383f, -0.7178700451f, -0.6961771315f,
+  -0.0184067299f, -0.9998305818f, 0.6917592584f, -0.7221281939f,
+  0.7081906370f, 0.7060212614f, 0.0030679568f, 0.9999952938f,
+  -0.7038452405f, 0.7103533469f, -0.9999811753f, 0.0061358846f,
+  -0.7125093706f, -0.7016625947f, -0.0092037548f, -0.9999576446f,
+  0.6994733446f, -0.7146586879f, 0.9999247018f, 0.0122715383f,
+  0.9996988187f, 0.0245412285f, 0.9993223846f, 0.0368072229f,
+  0.9987954562f, 0.0490676743f, 0.9981181129f, 0.0613207363f,
+  0.9972904567f, 0.0735645636f, 0.9963126122f, 0.0857973123f,
+  0.9996988187f, 0.0245412285f, 0.9987954562f, 0.0490676743f,
+  0.9972904567f, 0.0735645636f, 0.9951847267f, 0.0980171403f,
+  0.9924795346f, 0.1224106752f, 0.9891765100f, 0.1467304745f,
+  0.9852776424f, 0.1709618888f, 0.9993223846f, 0.0368072229f,
+  0.9972904567f, 0.0735645636f, 0.9939069700f, 0.1102222073f,
+  0.9891765100f, 0.1467304745f, 0.9831054874f, 0.1830398880f,
+  0.9757021300f, 0.2191012402f, 0.9669764710f, 0.2548656596f,
+  0.9987954562f, 0.0490676743f, 0.9951847267f, 0.0980171403f,
+  0.9891765100f, 0.1467304745f, 0.9807852804f, 0.1950903220f,
+  0.9700312532f, 0.2429801799f, 0.9569403357f, 0.2902846773f,
+  0.9415440652f, 0.3368898534f, 0.9981181129f, 0.0613207363f,
+  0.9924795346f, 0.1224106752f, 0.9831054874f, 0.1830398880f,
+  0.9700312532f, 0.2429801799f, 0.9533060404f, 0.3020059493f,
+  0.9329927988f, 0.3598950365f, 0.9091679831f, 0.4164295601f,
+  0.9972904567f, 0.0735645636f, 0.9891765100f, 0.1467304745f,
+  0.9757021300f, 0.2191012402f, 0.9569403357f, 0.2902846773f,
+  0.9329927988f, 0.3598950365f, 0.9039892931f, 0.4275550934f,
+  0.8700869911f, 0.4928981922f, 0.9963126122f, 0.0857973123f,
+  0.9852776424f, 0.1709618888f, 0.9669764710f, 0.2548656596f,
+  0.9415440652f, 0.3368898534f, 0.9091679831f, 0.4164295601f,
+  0.8700869911f, 0.4928981922f, 0.8245893028f, 0.5657318108f,
+  0.9951847267f, 0.0980171403f, 0.9807852804f, 0.1950903220f,
+  0.9569403357f, 0.2902846773f, 0.9238795325f, 0.3826834324f,
+  0.8819212643f, 0.4713967368f, 0.8314696123f, 0.5555702330f,
+  0.7730104534f, 0.6343932842f, 0.9939069700f, 0.1102222073f,
+  0.9757021300f, 0.2191012402f, 0.9456073254f, 0.3253102922f,
+  0.9039892931f, 0.4275550934f, 0.8513551931f, 0.5245896827f,
+  0.7883464276f, 0.6152315906f, 0.7157308253f, 0.6983762494f,
+  0.9924795346f, 0.1224106752f, 0.9700312532f, 0.2429801799f,
+  0.9329927988f, 0.3598950365f, 0.8819212643f, 0.4713967368f,
+  0.8175848132f, 0.5758081914f, 0.7409511254f, 0.6715589548f,
+  0.6531728430f, 0.7572088465f, 0.9909026354f, 0.1345807085f,
+  0.9637760658f, 0.2667127575f, 0.9191138517f, 0.3939920401f,
+  0.8577286100f, 0.5141027442f, 0.7807372286f, 0.6248594881f,
+  0.6895405447f, 0.7242470830f, 0.5857978575f, 0.8104571983f,
+  0.9891765100f, 0.1467304745f, 0.9569403357f, 0.2902846773f,
+  0.9039892931f, 0.4275550934f, 0.8314696123f, 0.5555702330f,
+  0.7409511254f, 0.6715589548f, 0.6343932842f, 0.7730104534f,
+  0.5141027442f, 0.8577286100f, 0.9873014182f, 0.1588581433f,
+  0.9495281806f, 0.3136817404f, 0.8876396204f, 0.4605387110f,
+  0.8032075315f, 0.5956993045f, 0.6983762494f, 0.7157308253f,
+  0.5758081914f, 0.8175848132f, 0.4386162385f, 0.8986744657f,
+  0.9852776424f, 0.1709618888f, 0.9415440652f, 0.3368898534f,
+  0.8700869911f, 0.4928981922f, 0.7730104534f, 0.6343932842f,
+  0.6531728430f, 0.7572088465f, 0.5141027442f, 0.8577286100f,
+  0.3598950365f, 0.9329927988f, 0.9831054874f, 0.1830398880f,
+  0.9329927988f, 0.3598950365f, 0.8513551931f, 0.5245896827f,
+  0.7409511254f, 0.6715589548f, 0.6055110414f, 0.7958369046f,
+  0.4496113297f, 0.8932243012f, 0.2785196894f, 0.9604305194f,
+  0.9807852804f, 0.1950903220f, 0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.7071067812f, 0.7071067812f,
+  0.5555702330f, 0.8314696123f, 0.3826834324f, 0.9238795325f,
+  0.1950903220f, 0.9807852804f, 0.9783173707f, 0.2071113762f,
+  0.9142097557f, 0.4052413140f, 0.8104571983f, 0.5857978575f,
+  0.6715589548f, 0.7409511254f, 0.5035383837f, 0.8639728561f,
+  0.3136817404f, 0.9495281806f, 0.1102222073f, 0.9939069700f,
+  0.9757021300f, 0.2191012402f, 0.9039892931f, 0.4275550934f,
+  0.7883464276f, 0.6152315906f, 0.6343932842f, 0.7730104534f,
+  0.4496113297f, 0.8932243012f, 0.2429801799f, 0.9700312532f,
+  0.0245412285f, 0.9996988187f, 0.9729399522f, 0.2310581083f,
+  0.8932243012f, 0.4496113297f, 0.7651672656f, 0.6438315429f,
+  0.5956993045f, 0.8032075315f, 0.3939920401f, 0.9191138517f,
+  0.1709618888f, 0.9852776424f, -0.0613207363f, 0.9981181129f,
+  0.9700312532f, 0.2429801799f, 0.8819212643f, 0.4713967368f,
+  0.7409511254f, 0.6715589548f, 0.5555702330f, 0.8314696123f,
+  0.3368898534f, 0.9415440652f, 0.0980171403f, 0.9951847267f,
+  -0.1467304745f, 0.9891765100f, 0.9669764710f, 0.2548656596f,
+  0.8700869911f, 0.4928981922f, 0.7157308253f, 0.6983762494f,
+  0.5141027442f, 0.8577286100f, 0.2785196894f, 0.9604305194f,
+  0.0245412285f, 0.9996988187f, -0.2310581083f, 0.9729399522f,
+  0.9637760658f, 0.2667127575f, 0.8577286100f, 0.5141027442f,
+  0.6895405447f, 0.7242470830f, 0.4713967368f, 0.8819212643f,
+  0.2191012402f, 0.9757021300f, -0.0490676743f, 0.9987954562f,
+  -0.3136817404f, 0.9495281806f, 0.9604305194f, 0.2785196894f,
+  0.8448535652f, 0.5349976199f, 0.6624157776f, 0.7491363945f,
+  0.4275550934f, 0.9039892931f, 0.1588581433f, 0.9873014182f,
+  -0.1224106752f, 0.9924795346f, -0.3939920401f, 0.9191138517f,
+  0.9569403357f, 0.2902846773f, 0.8314696123f, 0.5555702330f,
+  0.6343932842f, 0.7730104534f, 0.3826834324f, 0.9238795325f,
+  0.0980171403f, 0.9951847267f, -0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, 0.9533060404f, 0.3020059493f,
+  0.8175848132f, 0.5758081914f, 0.6055110414f, 0.7958369046f,
+  0.3368898534f, 0.9415440652f, 0.0368072229f, 0.9993223846f,
+  -0.2667127575f, 0.9637760658f, -0.5453249884f, 0.8382247056f,
+  0.9495281806f, 0.3136817404f, 0.8032075315f, 0.5956993045f,
+  0.5758081914f, 0.8175848132f, 0.2902846773f, 0.9569403357f,
+  -0.0245412285f, 0.9996988187f, -0.3368898534f, 0.9415440652f,
+  -0.6152315906f, 0.7883464276f, 0.9456073254f, 0.3253102922f,
+  0.7883464276f, 0.6152315906f, 0.5453249884f, 0.8382247056f,
+  0.2429801799f, 0.9700312532f, -0.0857973123f, 0.9963126122f,
+  -0.4052413140f, 0.9142097557f, -0.6806009978f, 0.7326542717f,
+  0.9415440652f, 0.3368898534f, 0.7730104534f, 0.6343932842f,
+  0.5141027442f, 0.8577286100f, 0.1950903220f, 0.9807852804f,
+  -0.1467304745f, 0.9891765100f, -0.4713967368f, 0.8819212643f,
+  -0.7409511254f, 0.6715589548f, 0.9373390119f, 0.3484186802f,
+  0.7572088465f, 0.6531728430f, 0.4821837721f, 0.8760700942f,
+  0.1467304745f, 0.9891765100f, -0.2071113762f, 0.9783173707f,
+  -0.5349976199f, 0.8448535652f, -0.7958369046f, 0.6055110414f,
+  0.9329927988f, 0.3598950365f, 0.7409511254f, 0.6715589548f,
+  0.4496113297f, 0.8932243012f, 0.0980171403f, 0.9951847267f,
+  -0.2667127575f, 0.9637760658f, -0.5956993045f, 0.8032075315f,
+  -0.8448535652f, 0.5349976199f, 0.9285060805f, 0.3713171940f,
+  0.7242470830f, 0.6895405447f, 0.4164295601f, 0.9091679831f,
+  0.0490676743f, 0.9987954562f, -0.3253102922f, 0.9456073254f,
+  -0.6531728430f, 0.7572088465f, -0.8876396204f, 0.4605387110f,
+  0.9238795325f, 0.3826834324f, 0.7071067812f, 0.7071067812f,
+  0.3826834324f, 0.9238795325f, 0.0000000000f, 1.0000000000f,
+  -0.3826834324f, 0.9238795325f, -0.7071067812f, 0.7071067812f,
+  -0.9238795325f, 0.3826834324f, 0.9191138517f, 0.3939920401f,
+  0.6895405447f, 0.7242470830f, 0.3484186802f, 0.9373390119f,
+  -0.0490676743f, 0.9987954562f, -0.4386162385f, 0.8986744657f,
+  -0.7572088465f, 0.6531728430f, -0.9533060404f, 0.3020059493f,
+  0.9142097557f, 0.4052413140f, 0.6715589548f, 0.7409511254f,
+  0.3136817404f, 0.9495281806f, -0.0980171403f, 0.9951847267f,
+  -0.4928981922f, 0.8700869911f, -0.8032075315f, 0.5956993045f,
+  -0.9757021300f, 0.2191012402f, 0.9091679831f, 0.4164295601f,
+  0.6531728430f, 0.7572088465f, 0.2785196894f, 0.9604305194f,
+  -0.1467304745f, 0.9891765100f, -0.5453249884f, 0.8382247056f,
+  -0.8448535652f, 0.5349976199f, -0.9909026354f, 0.1345807085f,
+  0.9039892931f, 0.4275550934f, 0.6343932842f, 0.7730104534f,
+  0.2429801799f, 0.9700312532f, -0.1950903220f, 0.9807852804f,
+  -0.5956993045f, 0.8032075315f, -0.8819212643f, 0.4713967368f,
+  -0.9987954562f, 0.0490676743f, 0.8986744657f, 0.4386162385f,
+  0.6152315906f, 0.7883464276f, 0.2071113762f, 0.9783173707f,
+  -0.2429801799f, 0.9700312532f, -0.6438315429f, 0.7651672656f,
+  -0.9142097557f, 0.4052413140f, -0.9993223846f, -0.0368072229f,
+  0.8932243012f, 0.4496113297f, 0.5956993045f, 0.8032075315f,
+  0.1709618888f, 0.9852776424f, -0.2902846773f, 0.9569403357f,
+  -0.6895405447f, 0.7242470830f, -0.9415440652f, 0.3368898534f,
+  -0.9924795346f, -0.1224106752f, 0.8876396204f, 0.4605387110f,
+  0.5758081914f, 0.8175848132f, 0.1345807085f, 0.9909026354f,
+  -0.3368898534f, 0.9415440652f, -0.7326542717f, 0.6806009978f,
+  -0.9637760658f, 0.2667127575f, -0.9783173707f, -0.2071113762f,
+  0.8819212643f, 0.4713967368f, 0.5555702330f, 0.8314696123f,
+  0.0980171403f, 0.9951847267f, -0.3826834324f, 0.9238795325f,
+  -0.7730104534f, 0.6343932842f, -0.9807852804f, 0.1950903220f,
+  -0.9569403357f, -0.2902846773f, 0.8760700942f, 0.4821837721f,
+  0.5349976199f, 0.8448535652f, 0.0613207363f, 0.9981181129f,
+  -0.4275550934f, 0.9039892931f, -0.8104571983f, 0.5857978575f,
+  -0.9924795346f, 0.1224106752f, -0.9285060805f, -0.3713171940f,
+  0.8700869911f, 0.4928981922f, 0.5141027442f, 0.8577286100f,
+  0.0245412285f, 0.9996988187f, -0.4713967368f, 0.8819212643f,
+  -0.8448535652f, 0.5349976199f, -0.9987954562f, 0.0490676743f,
+  -0.8932243012f, -0.4496113297f, 0.8639728561f, 0.5035383837f,
+  0.4928981922f, 0.8700869911f, -0.0122715383f, 0.9999247018f,
+  -0.5141027442f, 0.8577286100f, -0.8760700942f, 0.4821837721f,
+  -0.9996988187f, -0.0245412285f, -0.8513551931f, -0.5245896827f,
+  0.8577286100f, 0.5141027442f, 0.4713967368f, 0.8819212643f,
+  -0.0490676743f, 0.9987954562f, -0.5555702330f, 0.8314696123f,
+  -0.9039892931f, 0.4275550934f, -0.9951847267f, -0.0980171403f,
+  -0.8032075315f, -0.5956993045f, 0.8513551931f, 0.5245896827f,
+  0.4496113297f, 0.8932243012f, -0.0857973123f, 0.9963126122f,
+  -0.5956993045f, 0.8032075315f, -0.9285060805f, 0.3713171940f,
+  -0.9852776424f, -0.1709618888f, -0.7491363945f, -0.6624157776f,
+  0.8448535652f, 0.5349976199f, 0.4275550934f, 0.9039892931f,
+  -0.1224106752f, 0.9924795346f, -0.6343932842f, 0.7730104534f,
+  -0.9495281806f, 0.3136817404f, -0.9700312532f, -0.2429801799f,
+  -0.6895405447f, -0.7242470830f, 0.8382247056f, 0.5453249884f,
+  0.4052413140f, 0.9142097557f, -0.1588581433f, 0.9873014182f,
+  -0.6715589548f, 0.7409511254f, -0.9669764710f, 0.2548656596f,
+  -0.9495281806f, -0.3136817404f, -0.6248594881f, -0.7807372286f,
+  0.8314696123f, 0.5555702330f, 0.3826834324f, 0.9238795325f,
+  -0.1950903220f, 0.9807852804f, -0.7071067812f, 0.7071067812f,
+  -0.9807852804f, 0.1950903220f, -0.9238795325f, -0.3826834324f,
+  -0.5555702330f, -0.8314696123f, 0.8245893028f, 0.5657318108f,
+  0.3598950365f, 0.9329927988f, -0.2310581083f, 0.9729399522f,
+  -0.7409511254f, 0.6715589548f, -0.9909026354f, 0.1345807085f,
+  -0.8932243012f, -0.4496113297f, -0.4821837721f, -0.8760700942f,
+  0.8175848132f, 0.5758081914f, 0.3368898534f, 0.9415440652f,
+  -0.2667127575f, 0.9637760658f, -0.7730104534f, 0.6343932842f,
+  -0.9972904567f, 0.0735645636f, -0.8577286100f, -0.5141027442f,
+  -0.4052413140f, -0.9142097557f, 0.8104571983f, 0.5857978575f,
+  0.3136817404f, 0.9495281806f, -0.3020059493f, 0.9533060404f,
+  -0.8032075315f, 0.5956993045f, -0.9999247018f, 0.0122715383f,
+  -0.8175848132f, -0.5758081914f, -0.3253102922f, -0.9456073254f,
+  0.8032075315f, 0.5956993045f, 0.2902846773f, 0.9569403357f,
+  -0.3368898534f, 0.9415440652f, -0.8314696123f, 0.5555702330f,
+  -0.9987954562f, -0.0490676743f, -0.7730104534f, -0.6343932842f,
+  -0.2429801799f, -0.9700312532f, 0.7958369046f, 0.6055110414f,
+  0.2667127575f, 0.9637760658f, -0.3713171940f, 0.9285060805f,
+  -0.8577286100f, 0.5141027442f, -0.9939069700f, -0.1102222073f,
+  -0.7242470830f, -0.6895405447f, -0.1588581433f, -0.9873014182f,
+  0.7883464276f, 0.6152315906f, 0.2429801799f, 0.9700312532f,
+  -0.4052413140f, 0.9142097557f, -0.8819212643f, 0.4713967368f,
+  -0.9852776424f, -0.1709618888f, -0.6715589548f, -0.7409511254f,
+  -0.0735645636f, -0.9972904567f, 0.7807372286f, 0.6248594881f,
+  0.2191012402f, 0.9757021300f, -0.4386162385f, 0.8986744657f,
+  -0.9039892931f, 0.4275550934f, -0.9729399522f, -0.2310581083f,
+  -0.6152315906f, -0.7883464276f, 0.0122715383f, -0.9999247018f,
+  0.7730104534f, 0.6343932842f, 0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, -0.9238795325f, 0.3826834324f,
+  -0.9569403357f, -0.2902846773f, -0.5555702330f, -0.8314696123f,
+  0.0980171403f, -0.9951847267f, 0.7651672656f, 0.6438315429f,
+  0.1709618888f, 0.9852776424f, -0.5035383837f, 0.8639728561f,
+  -0.9415440652f, 0.3368898534f, -0.9373390119f, -0.3484186802f,
+  -0.4928981922f, -0.8700869911f, 0.1830398880f, -0.9831054874f,
+  0.7572088465f, 0.6531728430f, 0.1467304745f, 0.9891765100f,
+  -0.5349976199f, 0.8448535652f, -0.9569403357f, 0.2902846773f,
+  -0.9142097557f, -0.4052413140f, -0.4275550934f, -0.9039892931f,
+  0.2667127575f, -0.9637760658f, 0.7491363945f, 0.6624157776f,
+  0.1224106752f, 0.9924795346f, -0.5657318108f, 0.8245893028f,
+  -0.9700312532f, 0.2429801799f, -0.8876396204f, -0.4605387110f,
+  -0.3598950365f, -0.9329927988f, 0.3484186802f, -0.9373390119f,
+  0.7409511254f, 0.6715589548f, 0.0980171403f, 0.9951847267f,
+  -0.5956993045f, 0.8032075315f, -0.9807852804f, 0.1950903220f,
+  -0.8577286100f, -0.5141027442f, -0.2902846773f, -0.9569403357f,
+  0.4275550934f, -0.9039892931f, 0.7326542717f, 0.6806009978f,
+  0.0735645636f, 0.9972904567f, -0.6248594881f, 0.7807372286f,
+  -0.9891765100f, 0.1467304745f, -0.8245893028f, -0.5657318108f,
+  -0.2191012402f, -0.9757021300f, 0.5035383837f, -0.8639728561f,
+  0.7242470830f, 0.6895405447f, 0.0490676743f, 0.9987954562f,
+  -0.6531728430f, 0.7572088465f, -0.9951847267f, 0.0980171403f,
+  -0.7883464276f, -0.6152315906f, -0.1467304745f, -0.9891765100f,
+  0.5758081914f, -0.8175848132f, 0.7157308253f, 0.6983762494f,
+  0.0245412285f, 0.9996988187f, -0.6806009978f, 0.7326542717f,
+  -0.9987954562f, 0.0490676743f, -0.7491363945f, -0.6624157776f,
+  -0.0735645636f, -0.9972904567f, 0.6438315429f, -0.7651672656f,
+  0.9951847267f, 0.0980171403f, 0.9807852804f, 0.1950903220f,
+  0.9569403357f, 0.2902846773f, 0.9238795325f, 0.3826834324f,
+  0.8819212643f, 0.4713967368f, 0.8314696123f, 0.5555702330f,
+  0.7730104534f, 0.6343932842f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9569403357f, 0.2902846773f, 0.8314696123f, 0.5555702330f,
+  0.6343932842f, 0.7730104534f, 0.3826834324f, 0.9238795325f,
+  0.0980171403f, 0.9951847267f, -0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.8819212643f, 0.4713967368f, 0.5555702330f, 0.8314696123f,
+  0.0980171403f, 0.9951847267f, -0.3826834324f, 0.9238795325f,
+  -0.7730104534f, 0.6343932842f, -0.9807852804f, 0.1950903220f,
+  -0.9569403357f, -0.2902846773f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.7730104534f, 0.6343932842f, 0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, -0.9238795325f, 0.3826834324f,
+  -0.9569403357f, -0.2902846773f, -0.5555702330f, -0.8314696123f,
+  0.0980171403f, -0.9951847267f
+};
+#elif (ARM_MATH_MAX_FFT_LEN >= 512)
+const float32_t twiddleCoef_512[980] = {
+  0.9999247018f, 0.0122715383f, 0.9996988187f, 0.0245412285f,
+  0.9993223846f, 0.0368072229f, 0.9987954562f, 0.0490676743f,
+  0.9981181129f, 0.0613207363f, 0.9972904567f, 0.0735645636f,
+  0.9963126122f, 0.0857973123f, 0.9996988187f, 0.0245412285f,
+  0.9987954562f, 0.0490676743f, 0.9972904567f, 0.0735645636f,
+  0.9951847267f, 0.0980171403f, 0.9924795346f, 0.1224106752f,
+  0.9891765100f, 0.1467304745f, 0.9852776424f, 0.1709618888f,
+  0.9993223846f, 0.0368072229f, 0.9972904567f, 0.0735645636f,
+  0.9939069700f, 0.1102222073f, 0.9891765100f, 0.1467304745f,
+  0.9831054874f, 0.1830398880f, 0.9757021300f, 0.2191012402f,
+  0.9669764710f, 0.2548656596f, 0.9987954562f, 0.0490676743f,
+  0.9951847267f, 0.0980171403f, 0.9891765100f, 0.1467304745f,
+  0.9807852804f, 0.1950903220f, 0.9700312532f, 0.2429801799f,
+  0.9569403357f, 0.2902846773f, 0.9415440652f, 0.3368898534f,
+  0.9981181129f, 0.0613207363f, 0.9924795346f, 0.1224106752f,
+  0.9831054874f, 0.1830398880f, 0.9700312532f, 0.2429801799f,
+  0.9533060404f, 0.3020059493f, 0.9329927988f, 0.3598950365f,
+  0.9091679831f, 0.4164295601f, 0.9972904567f, 0.0735645636f,
+  0.9891765100f, 0.1467304745f, 0.9757021300f, 0.2191012402f,
+  0.9569403357f, 0.2902846773f, 0.9329927988f, 0.3598950365f,
+  0.9039892931f, 0.4275550934f, 0.8700869911f, 0.4928981922f,
+  0.9963126122f, 0.0857973123f, 0.9852776424f, 0.1709618888f,
+  0.9669764710f, 0.2548656596f, 0.9415440652f, 0.3368898534f,
+  0.9091679831f, 0.4164295601f, 0.8700869911f, 0.4928981922f,
+  0.8245893028f, 0.5657318108f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.9939069700f, 0.1102222073f, 0.9757021300f, 0.2191012402f,
+  0.9456073254f, 0.3253102922f, 0.9039892931f, 0.4275550934f,
+  0.8513551931f, 0.5245896827f, 0.7883464276f, 0.6152315906f,
+  0.7157308253f, 0.6983762494f, 0.9924795346f, 0.1224106752f,
+  0.9700312532f, 0.2429801799f, 0.9329927988f, 0.3598950365f,
+  0.8819212643f, 0.4713967368f, 0.8175848132f, 0.5758081914f,
+  0.7409511254f, 0.6715589548f, 0.6531728430f, 0.7572088465f,
+  0.9909026354f, 0.1345807085f, 0.9637760658f, 0.2667127575f,
+  0.9191138517f, 0.3939920401f, 0.8577286100f, 0.5141027442f,
+  0.7807372286f, 0.6248594881f, 0.6895405447f, 0.7242470830f,
+  0.5857978575f, 0.8104571983f, 0.9891765100f, 0.1467304745f,
+  0.9569403357f, 0.2902846773f, 0.9039892931f, 0.4275550934f,
+  0.8314696123f, 0.5555702330f, 0.7409511254f, 0.6715589548f,
+  0.6343932842f, 0.7730104534f, 0.5141027442f, 0.8577286100f,
+  0.9873014182f, 0.1588581433f, 0.9495281806f, 0.3136817404f,
+  0.8876396204f, 0.4605387110f, 0.8032075315f, 0.5956993045f,
+  0.6983762494f, 0.7157308253f, 0.5758081914f, 0.8175848132f,
+  0.4386162385f, 0.8986744657f, 0.9852776424f, 0.1709618888f,
+  0.9415440652f, 0.3368898534f, 0.8700869911f, 0.4928981922f,
+  0.7730104534f, 0.6343932842f, 0.6531728430f, 0.7572088465f,
+  0.5141027442f, 0.8577286100f, 0.3598950365f, 0.9329927988f,
+  0.9831054874f, 0.1830398880f, 0.9329927988f, 0.3598950365f,
+  0.8513551931f, 0.5245896827f, 0.7409511254f, 0.6715589548f,
+  0.6055110414f, 0.7958369046f, 0.4496113297f, 0.8932243012f,
+  0.2785196894f, 0.9604305194f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9783173707f, 0.2071113762f, 0.9142097557f, 0.4052413140f,
+  0.8104571983f, 0.5857978575f, 0.6715589548f, 0.7409511254f,
+  0.5035383837f, 0.8639728561f, 0.3136817404f, 0.9495281806f,
+  0.1102222073f, 0.9939069700f, 0.9757021300f, 0.2191012402f,
+  0.9039892931f, 0.4275550934f, 0.7883464276f, 0.6152315906f,
+  0.6343932842f, 0.7730104534f, 0.4496113297f, 0.8932243012f,
+  0.2429801799f, 0.9700312532f, 0.0245412285f, 0.9996988187f,
+  0.9729399522f, 0.2310581083f, 0.8932243012f, 0.4496113297f,
+  0.7651672656f, 0.6438315429f, 0.5956993045f, 0.8032075315f,
+  0.3939920401f, 0.9191138517f, 0.1709618888f, 0.9852776424f,
+  -0.0613207363f, 0.9981181129f, 0.9700312532f, 0.2429801799f,
+  0.8819212643f, 0.4713967368f, 0.7409511254f, 0.6715589548f,
+  0.5555702330f, 0.8314696123f, 0.3368898534f, 0.9415440652f,
+  0.0980171403f, 0.9951847267f, -0.1467304745f, 0.9891765100f,
+  0.9669764710f, 0.2548656596f, 0.8700869911f, 0.4928981922f,
+  0.7157308253f, 0.6983762494f, 0.5141027442f, 0.8577286100f,
+  0.2785196894f, 0.9604305194f, 0.0245412285f, 0.9996988187f,
+  -0.2310581083f, 0.9729399522f, 0.9637760658f, 0.2667127575f,
+  0.8577286100f, 0.5141027442f, 0.6895405447f, 0.7242470830f,
+  0.4713967368f, 0.8819212643f, 0.2191012402f, 0.9757021300f,
+  -0.0490676743f, 0.9987954562f, -0.3136817404f, 0.9495281806f,
+  0.9604305194f, 0.2785196894f, 0.8448535652f, 0.5349976199f,
+  0.6624157776f, 0.7491363945f, 0.4275550934f, 0.9039892931f,
+  0.1588581433f, 0.9873014182f, -0.1224106752f, 0.9924795346f,
+  -0.3939920401f, 0.9191138517f, 0.9569403357f, 0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.6343932842f, 0.7730104534f,
+  0.3826834324f, 0.9238795325f, 0.0980171403f, 0.9951847267f,
+  -0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  0.9533060404f, 0.3020059493f, 0.8175848132f, 0.5758081914f,
+  0.6055110414f, 0.7958369046f, 0.3368898534f, 0.9415440652f,
+  0.0368072229f, 0.9993223846f, -0.2667127575f, 0.9637760658f,
+  -0.5453249884f, 0.8382247056f, 0.9495281806f, 0.3136817404f,
+  0.8032075315f, 0.5956993045f, 0.5758081914f, 0.8175848132f,
+  0.2902846773f, 0.9569403357f, -0.0245412285f, 0.9996988187f,
+  -0.3368898534f, 0.9415440652f, -0.6152315906f, 0.7883464276f,
+  0.9456073254f, 0.3253102922f, 0.7883464276f, 0.6152315906f,
+  0.5453249884f, 0.8382247056f, 0.2429801799f, 0.9700312532f,
+  -0.0857973123f, 0.9963126122f, -0.4052413140f, 0.9142097557f,
+  -0.6806009978f, 0.7326542717f, 0.9415440652f, 0.3368898534f,
+  0.7730104534f, 0.6343932842f, 0.5141027442f, 0.8577286100f,
+  0.1950903220f, 0.9807852804f, -0.1467304745f, 0.9891765100f,
+  -0.4713967368f, 0.8819212643f, -0.7409511254f, 0.6715589548f,
+  0.9373390119f, 0.3484186802f, 0.7572088465f, 0.6531728430f,
+  0.4821837721f, 0.8760700942f, 0.1467304745f, 0.9891765100f,
+  -0.2071113762f, 0.9783173707f, -0.5349976199f, 0.8448535652f,
+  -0.7958369046f, 0.6055110414f, 0.9329927988f, 0.3598950365f,
+  0.7409511254f, 0.6715589548f, 0.4496113297f, 0.8932243012f,
+  0.0980171403f, 0.9951847267f, -0.2667127575f, 0.9637760658f,
+  -0.5956993045f, 0.8032075315f, -0.8448535652f, 0.5349976199f,
+  0.9285060805f, 0.3713171940f, 0.7242470830f, 0.6895405447f,
+  0.4164295601f, 0.9091679831f, 0.0490676743f, 0.9987954562f,
+  -0.3253102922f, 0.9456073254f, -0.6531728430f, 0.7572088465f,
+  -0.8876396204f, 0.4605387110f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.9191138517f, 0.3939920401f, 0.6895405447f, 0.7242470830f,
+  0.3484186802f, 0.9373390119f, -0.0490676743f, 0.9987954562f,
+  -0.4386162385f, 0.8986744657f, -0.7572088465f, 0.6531728430f,
+  -0.9533060404f, 0.3020059493f, 0.9142097557f, 0.4052413140f,
+  0.6715589548f, 0.7409511254f, 0.3136817404f, 0.9495281806f,
+  -0.0980171403f, 0.9951847267f, -0.4928981922f, 0.8700869911f,
+  -0.8032075315f, 0.5956993045f, -0.9757021300f, 0.2191012402f,
+  0.9091679831f, 0.4164295601f, 0.6531728430f, 0.7572088465f,
+  0.2785196894f, 0.9604305194f, -0.1467304745f, 0.9891765100f,
+  -0.5453249884f, 0.8382247056f, -0.8448535652f, 0.5349976199f,
+  -0.9909026354f, 0.1345807085f, 0.9039892931f, 0.4275550934f,
+  0.6343932842f, 0.7730104534f, 0.2429801799f, 0.9700312532f,
+  -0.1950903220f, 0.9807852804f, -0.5956993045f, 0.8032075315f,
+  -0.8819212643f, 0.4713967368f, -0.9987954562f, 0.0490676743f,
+  0.8986744657f, 0.4386162385f, 0.6152315906f, 0.7883464276f,
+  0.2071113762f, 0.9783173707f, -0.2429801799f, 0.9700312532f,
+  -0.6438315429f, 0.7651672656f, -0.9142097557f, 0.4052413140f,
+  -0.9993223846f, -0.0368072229f, 0.8932243012f, 0.4496113297f,
+  0.5956993045f, 0.8032075315f, 0.1709618888f, 0.9852776424f,
+  -0.2902846773f, 0.9569403357f, -0.6895405447f, 0.7242470830f,
+  -0.9415440652f, 0.3368898534f, -0.9924795346f, -0.1224106752f,
+  0.8876396204f, 0.4605387110f, 0.5758081914f, 0.8175848132f,
+  0.1345807085f, 0.9909026354f, -0.3368898534f, 0.9415440652f,
+  -0.7326542717f, 0.6806009978f, -0.9637760658f, 0.2667127575f,
+  -0.9783173707f, -0.2071113762f, 0.8819212643f, 0.4713967368f,
+  0.5555702330f, 0.8314696123f, 0.0980171403f, 0.9951847267f,
+  -0.3826834324f, 0.9238795325f, -0.7730104534f, 0.6343932842f,
+  -0.9807852804f, 0.1950903220f, -0.9569403357f, -0.2902846773f,
+  0.8760700942f, 0.4821837721f, 0.5349976199f, 0.8448535652f,
+  0.0613207363f, 0.9981181129f, -0.4275550934f, 0.9039892931f,
+  -0.8104571983f, 0.5857978575f, -0.9924795346f, 0.1224106752f,
+  -0.9285060805f, -0.3713171940f, 0.8700869911f, 0.4928981922f,
+  0.5141027442f, 0.8577286100f, 0.0245412285f, 0.9996988187f,
+  -0.4713967368f, 0.8819212643f, -0.8448535652f, 0.5349976199f,
+  -0.9987954562f, 0.0490676743f, -0.8932243012f, -0.4496113297f,
+  0.8639728561f, 0.5035383837f, 0.4928981922f, 0.8700869911f,
+  -0.0122715383f, 0.9999247018f, -0.5141027442f, 0.8577286100f,
+  -0.8760700942f, 0.4821837721f, -0.9996988187f, -0.0245412285f,
+  -0.8513551931f, -0.5245896827f, 0.8577286100f, 0.5141027442f,
+  0.4713967368f, 0.8819212643f, -0.0490676743f, 0.9987954562f,
+  -0.5555702330f, 0.8314696123f, -0.9039892931f, 0.4275550934f,
+  -0.9951847267f, -0.0980171403f, -0.8032075315f, -0.5956993045f,
+  0.8513551931f, 0.5245896827f, 0.4496113297f, 0.8932243012f,
+  -0.0857973123f, 0.9963126122f, -0.5956993045f, 0.8032075315f,
+  -0.9285060805f, 0.3713171940f, -0.9852776424f, -0.1709618888f,
+  -0.7491363945f, -0.6624157776f, 0.8448535652f, 0.5349976199f,
+  0.4275550934f, 0.9039892931f, -0.1224106752f, 0.9924795346f,
+  -0.6343932842f, 0.7730104534f, -0.9495281806f, 0.3136817404f,
+  -0.9700312532f, -0.2429801799f, -0.6895405447f, -0.7242470830f,
+  0.8382247056f, 0.5453249884f, 0.4052413140f, 0.9142097557f,
+  -0.1588581433f, 0.9873014182f, -0.6715589548f, 0.7409511254f,
+  -0.9669764710f, 0.2548656596f, -0.9495281806f, -0.3136817404f,
+  -0.6248594881f, -0.7807372286f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.8245893028f, 0.5657318108f, 0.3598950365f, 0.9329927988f,
+  -0.2310581083f, 0.9729399522f, -0.7409511254f, 0.6715589548f,
+  -0.9909026354f, 0.1345807085f, -0.8932243012f, -0.4496113297f,
+  -0.4821837721f, -0.8760700942f, 0.8175848132f, 0.5758081914f,
+  0.3368898534f, 0.9415440652f, -0.2667127575f, 0.9637760658f,
+  -0.7730104534f, 0.6343932842f, -0.9972904567f, 0.0735645636f,
+  -0.8577286100f, -0.5141027442f, -0.4052413140f, -0.9142097557f,
+  0.8104571983f, 0.5857978575f, 0.3136817404f, 0.9495281806f,
+  -0.3020059493f, 0.9533060404f, -0.8032075315f, 0.5956993045f,
+  -0.9999247018f, 0.0122715383f, -0.8175848132f, -0.5758081914f,
+  -0.3253102922f, -0.9456073254f, 0.8032075315f, 0.5956993045f,
+  0.2902846773f, 0.9569403357f, -0.3368898534f, 0.9415440652f,
+  -0.8314696123f, 0.5555702330f, -0.9987954562f, -0.0490676743f,
+  -0.7730104534f, -0.6343932842f, -0.2429801799f, -0.9700312532f,
+  0.7958369046f, 0.6055110414f, 0.2667127575f, 0.9637760658f,
+  -0.3713171940f, 0.9285060805f, -0.8577286100f, 0.5141027442f,
+  -0.9939069700f, -0.1102222073f, -0.7242470830f, -0.6895405447f,
+  -0.1588581433f, -0.9873014182f, 0.7883464276f, 0.6152315906f,
+  0.2429801799f, 0.9700312532f, -0.4052413140f, 0.9142097557f,
+  -0.8819212643f, 0.4713967368f, -0.9852776424f, -0.1709618888f,
+  -0.6715589548f, -0.7409511254f, -0.0735645636f, -0.9972904567f,
+  0.7807372286f, 0.6248594881f, 0.2191012402f, 0.9757021300f,
+  -0.4386162385f, 0.8986744657f, -0.9039892931f, 0.4275550934f,
+  -0.9729399522f, -0.2310581083f, -0.6152315906f, -0.7883464276f,
+  0.0122715383f, -0.9999247018f, 0.7730104534f, 0.6343932842f,
+  0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  -0.9238795325f, 0.3826834324f, -0.9569403357f, -0.2902846773f,
+  -0.5555702330f, -0.8314696123f, 0.0980171403f, -0.9951847267f,
+  0.7651672656f, 0.6438315429f, 0.1709618888f, 0.9852776424f,
+  -0.5035383837f, 0.8639728561f, -0.9415440652f, 0.3368898534f,
+  -0.9373390119f, -0.3484186802f, -0.4928981922f, -0.8700869911f,
+  0.1830398880f, -0.9831054874f, 0.7572088465f, 0.6531728430f,
+  0.1467304745f, 0.9891765100f, -0.5349976199f, 0.8448535652f,
+  -0.9569403357f, 0.2902846773f, -0.9142097557f, -0.4052413140f,
+  -0.4275550934f, -0.9039892931f, 0.2667127575f, -0.9637760658f,
+  0.7491363945f, 0.6624157776f, 0.1224106752f, 0.9924795346f,
+  -0.5657318108f, 0.8245893028f, -0.9700312532f, 0.2429801799f,
+  -0.8876396204f, -0.4605387110f, -0.3598950365f, -0.9329927988f,
+  0.3484186802f, -0.9373390119f, 0.7409511254f, 0.6715589548f,
+  0.0980171403f, 0.9951847267f, -0.5956993045f, 0.8032075315f,
+  -0.9807852804f, 0.1950903220f, -0.8577286100f, -0.5141027442f,
+  -0.2902846773f, -0.9569403357f, 0.4275550934f, -0.9039892931f,
+  0.7326542717f, 0.6806009978f, 0.0735645636f, 0.9972904567f,
+  -0.6248594881f, 0.7807372286f, -0.9891765100f, 0.1467304745f,
+  -0.8245893028f, -0.5657318108f, -0.2191012402f, -0.9757021300f,
+  0.5035383837f, -0.8639728561f, 0.7242470830f, 0.6895405447f,
+  0.0490676743f, 0.9987954562f, -0.6531728430f, 0.7572088465f,
+  -0.9951847267f, 0.0980171403f, -0.7883464276f, -0.6152315906f,
+  -0.1467304745f, -0.9891765100f, 0.5758081914f, -0.8175848132f,
+  0.7157308253f, 0.6983762494f, 0.0245412285f, 0.9996988187f,
+  -0.6806009978f, 0.7326542717f, -0.9987954562f, 0.0490676743f,
+  -0.7491363945f, -0.6624157776f, -0.0735645636f, -0.9972904567f,
+  0.6438315429f, -0.7651672656f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.9807852804f, 0.1950903220f, 0.9238795325f, 0.3826834324f,
+  0.8314696123f, 0.5555702330f, 0.7071067812f, 0.7071067812f,
+  0.5555702330f, 0.8314696123f, 0.3826834324f, 0.9238795325f,
+  0.1950903220f, 0.9807852804f, 0.9569403357f, 0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.6343932842f, 0.7730104534f,
+  0.3826834324f, 0.9238795325f, 0.0980171403f, 0.9951847267f,
+  -0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  0.9238795325f, 0.3826834324f, 0.7071067812f, 0.7071067812f,
+  0.3826834324f, 0.9238795325f, 0.0000000000f, 1.0000000000f,
+  -0.3826834324f, 0.9238795325f, -0.7071067812f, 0.7071067812f,
+  -0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.5555702330f, 0.8314696123f, 0.0980171403f, 0.9951847267f,
+  -0.3826834324f, 0.9238795325f, -0.7730104534f, 0.6343932842f,
+  -0.9807852804f, 0.1950903220f, -0.9569403357f, -0.2902846773f,
+  0.8314696123f, 0.5555702330f, 0.3826834324f, 0.9238795325f,
+  -0.1950903220f, 0.9807852804f, -0.7071067812f, 0.7071067812f,
+  -0.9807852804f, 0.1950903220f, -0.9238795325f, -0.3826834324f,
+  -0.5555702330f, -0.8314696123f, 0.7730104534f, 0.6343932842f,
+  0.1950903220f, 0.9807852804f, -0.4713967368f, 0.8819212643f,
+  -0.9238795325f, 0.3826834324f, -0.9569403357f, -0.2902846773f,
+  -0.5555702330f, -0.8314696123f, 0.0980171403f, -0.9951847267
+};
+#elif (ARM_MATH_MAX_FFT_LEN >= 64)
+const float32_t twiddleCoef_64[98] = {
+  0.9951847267f, 0.0980171403f, 0.9807852804f, 0.1950903220f,
+  0.9569403357f, 0.2902846773f, 0.9238795325f, 0.3826834324f,
+  0.8819212643f, 0.4713967368f, 0.8314696123f, 0.5555702330f,
+  0.7730104534f, 0.6343932842f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f,
+  0.9569403357f, 0.2902846773f, 0.8314696123f, 0.5555702330f,
+  0.6343932842f, 0.7730104534f, 0.3826834324f, 0.9238795325f,
+  0.0980171403f, 0.9951847267f, -0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, 0.9238795325f, 0.3826834324f,
+  0.7071067812f, 0.7071067812f, 0.3826834324f, 0.9238795325f,
+  0.0000000000f, 1.0000000000f, -0.3826834324f, 0.9238795325f,
+  -0.7071067812f, 0.7071067812f, -0.9238795325f, 0.3826834324f,
+  0.8819212643f, 0.4713967368f, 0.5555702330f, 0.8314696123f,
+  0.0980171403f, 0.9951847267f, -0.3826834324f, 0.9238795325f,
+  -0.7730104534f, 0.6343932842f, -0.9807852804f, 0.1950903220f,
+  -0.9569403357f, -0.2902846773f, 0.8314696123f, 0.5555702330f,
+  0.3826834324f, 0.9238795325f, -0.1950903220f, 0.9807852804f,
+  -0.7071067812f, 0.7071067812f, -0.9807852804f, 0.1950903220f,
+  -0.9238795325f, -0.3826834324f, -0.5555702330f, -0.8314696123f,
+  0.7730104534f, 0.6343932842f, 0.1950903220f, 0.9807852804f,
+  -0.4713967368f, 0.8819212643f, -0.9238795325f, 0.3826834324f,
+  -0.9569403357f, -0.2902846773f, -0.5555702330f, -0.8314696123f,
+  0.0980171403f, -0.9951847267
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 16 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+const uint16_t armBitRevIndexTable16[12] = {
+  1, 8, 2, 4, 3, 12, 5, 10,
+  7, 14, 11, 13
+};
+
+/**    
+* @brief  Bit reversal table of the 32 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 32)
+const uint16_t armBitRevIndexTable32[24] = {
+  1, 16, 2, 8, 3, 24, 5, 20,
+  6, 12, 7, 28, 9, 18, 11, 26,
+  13, 22, 15, 30, 19, 25, 23, 29
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 64 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
+const uint16_t armBitRevIndexTable64[56] = {
+  1, 32, 2, 16, 3, 48, 4, 8,
+  5, 40, 6, 24, 7, 56, 9, 36,
+  10, 20, 11, 52, 13, 44, 14, 28,
+  15, 60, 17, 34, 19, 50, 21, 42,
+  22, 26, 23, 58, 25, 38, 27, 54,
+  29, 46, 31, 62, 35, 49, 37, 41,
+  39, 57, 43, 53, 47, 61, 55, 59
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 128 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 128)
+const uint16_t armBitRevIndexTable128[112] = {
+  1, 64, 2, 32, 3, 96, 4, 16,
+  5, 80, 6, 48, 7, 112, 9, 72,
+  10, 40, 11, 104, 12, 24, 13, 88,
+  14, 56, 15, 120, 17, 68, 18, 36,
+  19, 100, 21, 84, 22, 52, 23, 116,
+  25, 76, 26, 44, 27, 108, 29, 92,
+  30, 60, 31, 124, 33, 66, 35, 98,
+  37, 82, 38, 50, 39, 114, 41, 74,
+  43, 106, 45, 90, 46, 58, 47, 122,
+  49, 70, 51, 102, 53, 86, 55, 118,
+  57, 78, 59, 110, 61, 94, 63, 126,
+  67, 97, 69, 81, 71, 113, 75, 105,
+  77, 89, 79, 121, 83, 101, 87, 117,
+  91, 109, 95, 125, 103, 115, 111, 123
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 256 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
+const uint16_t armBitRevIndexTable256[240] = {
+  1, 128, 2, 64, 3, 192, 4, 32,
+  5, 160, 6, 96, 7, 224, 8, 16,
+  9, 144, 10, 80, 11, 208, 12, 48,
+  13, 176, 14, 112, 15, 240, 17, 136,
+  18, 72, 19, 200, 20, 40, 21, 168,
+  22, 104, 23, 232, 25, 152, 26, 88,
+  27, 216, 28, 56, 29, 184, 30, 120,
+  31, 248, 33, 132, 34, 68, 35, 196,
+  37, 164, 38, 100, 39, 228, 41, 148,
+  42, 84, 43, 212, 44, 52, 45, 180,
+  46, 116, 47, 244, 49, 140, 50, 76,
+  51, 204, 53, 172, 54, 108, 55, 236,
+  57, 156, 58, 92, 59, 220, 61, 188,
+  62, 124, 63, 252, 65, 130, 67, 194,
+  69, 162, 70, 98, 71, 226, 73, 146,
+  74, 82, 75, 210, 77, 178, 78, 114,
+  79, 242, 81, 138, 83, 202, 85, 170,
+  86, 106, 87, 234, 89, 154, 91, 218,
+  93, 186, 94, 122, 95, 250, 97, 134,
+  99, 198, 101, 166, 103, 230, 105, 150,
+  107, 214, 109, 182, 110, 118, 111, 246,
+  113, 142, 115, 206, 117, 174, 119, 238,
+  121, 158, 123, 222, 125, 190, 127, 254,
+  131, 193, 133, 161, 135, 225, 137, 145,
+  139, 209, 141, 177, 143, 241, 147, 201,
+  149, 169, 151, 233, 155, 217, 157, 185,
+  159, 249, 163, 197, 167, 229, 171, 213,
+  173, 181, 175, 245, 179, 205, 183, 237,
+  187, 221, 191, 253, 199, 227, 203, 211,
+  207, 243, 215, 235, 223, 251, 239, 247
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 512 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 512)
+const uint16_t armBitRevIndexTable512[480] = {
+  1, 256, 2, 128, 3, 384, 4, 64,
+  5, 320, 6, 192, 7, 448, 8, 32,
+  9, 288, 10, 160, 11, 416, 12, 96,
+  13, 352, 14, 224, 15, 480, 17, 272,
+  18, 144, 19, 400, 20, 80, 21, 336,
+  22, 208, 23, 464, 24, 48, 25, 304,
+  26, 176, 27, 432, 28, 112, 29, 368,
+  30, 240, 31, 496, 33, 264, 34, 136,
+  35, 392, 36, 72, 37, 328, 38, 200,
+  39, 456, 41, 296, 42, 168, 43, 424,
+  44, 104, 45, 360, 46, 232, 47, 488,
+  49, 280, 50, 152, 51, 408, 52, 88,
+  53, 344, 54, 216, 55, 472, 57, 312,
+  58, 184, 59, 440, 60, 120, 61, 376,
+  62, 248, 63, 504, 65, 260, 66, 132,
+  67, 388, 69, 324, 70, 196, 71, 452,
+  73, 292, 74, 164, 75, 420, 76, 100,
+  77, 356, 78, 228, 79, 484, 81, 276,
+  82, 148, 83, 404, 85, 340, 86, 212,
+  87, 468, 89, 308, 90, 180, 91, 436,
+  92, 116, 93, 372, 94, 244, 95, 500,
+  97, 268, 98, 140, 99, 396, 101, 332,
+  102, 204, 103, 460, 105, 300, 106, 172,
+  107, 428, 109, 364, 110, 236, 111, 492,
+  113, 284, 114, 156, 115, 412, 117, 348,
+  118, 220, 119, 476, 121, 316, 122, 188,
+  123, 444, 125, 380, 126, 252, 127, 508,
+  129, 258, 131, 386, 133, 322, 134, 194,
+  135, 450, 137, 290, 138, 162, 139, 418,
+  141, 354, 142, 226, 143, 482, 145, 274,
+  147, 402, 149, 338, 150, 210, 151, 466,
+  153, 306, 154, 178, 155, 434, 157, 370,
+  158, 242, 159, 498, 161, 266, 163, 394,
+  165, 330, 166, 202, 167, 458, 169, 298,
+  171, 426, 173, 362, 174, 234, 175, 490,
+  177, 282, 179, 410, 181, 346, 182, 218,
+  183, 474, 185, 314, 187, 442, 189, 378,
+  190, 250, 191, 506, 193, 262, 195, 390,
+  197, 326, 199, 454, 201, 294, 203, 422,
+  205, 358, 206, 230, 207, 486, 209, 278,
+  211, 406, 213, 342, 215, 470, 217, 310,
+  219, 438, 221, 374, 222, 246, 223, 502,
+  225, 270, 227, 398, 229, 334, 231, 462,
+  233, 302, 235, 430, 237, 366, 239, 494,
+  241, 286, 243, 414, 245, 350, 247, 478,
+  249, 318, 251, 446, 253, 382, 255, 510,
+  259, 385, 261, 321, 263, 449, 265, 289,
+  267, 417, 269, 353, 271, 481, 275, 401,
+  277, 337, 279, 465, 281, 305, 283, 433,
+  285, 369, 287, 497, 291, 393, 293, 329,
+  295, 457, 299, 425, 301, 361, 303, 489,
+  307, 409, 309, 345, 311, 473, 315, 441,
+  317, 377, 319, 505, 323, 389, 327, 453,
+  331, 421, 333, 357, 335, 485, 339, 405,
+  343, 469, 347, 437, 349, 373, 351, 501,
+  355, 397, 359, 461, 363, 429, 367, 493,
+  371, 413, 375, 477, 379, 445, 383, 509,
+  391, 451, 395, 419, 399, 483, 407, 467,
+  411, 435, 415, 499, 423, 459, 431, 491,
+  439, 475, 447, 507, 463, 487, 479, 503
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 1024 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+const uint16_t armBitRevIndexTable1024[992] = {
+  1, 512, 2, 256, 3, 768, 4, 128,
+  5, 640, 6, 384, 7, 896, 8, 64,
+  9, 576, 10, 320, 11, 832, 12, 192,
+  13, 704, 14, 448, 15, 960, 16, 32,
+  17, 544, 18, 288, 19, 800, 20, 160,
+  21, 672, 22, 416, 23, 928, 24, 96,
+  25, 608, 26, 352, 27, 864, 28, 224,
+  29, 736, 30, 480, 31, 992, 33, 528,
+  34, 272, 35, 784, 36, 144, 37, 656,
+  38, 400, 39, 912, 40, 80, 41, 592,
+  42, 336, 43, 848, 44, 208, 45, 720,
+  46, 464, 47, 976, 49, 560, 50, 304,
+  51, 816, 52, 176, 53, 688, 54, 432,
+  55, 944, 56, 112, 57, 624, 58, 368,
+  59, 880, 60, 240, 61, 752, 62, 496,
+  63, 1008, 65, 520, 66, 264, 67, 776,
+  68, 136, 69, 648, 70, 392, 71, 904,
+  73, 584, 74, 328, 75, 840, 76, 200,
+  77, 712, 78, 456, 79, 968, 81, 552,
+  82, 296, 83, 808, 84, 168, 85, 680,
+  86, 424, 87, 936, 88, 104, 89, 616,
+  90, 360, 91, 872, 92, 232, 93, 744,
+  94, 488, 95, 1000, 97, 536, 98, 280,
+  99, 792, 100, 152, 101, 664, 102, 408,
+  103, 920, 105, 600, 106, 344, 107, 856,
+  108, 216, 109, 728, 110, 472, 111, 984,
+  113, 568, 114, 312, 115, 824, 116, 184,
+  117, 696, 118, 440, 119, 952, 121, 632,
+  122, 376, 123, 888, 124, 248, 125, 760,
+  126, 504, 127, 1016, 129, 516, 130, 260,
+  131, 772, 133, 644, 134, 388, 135, 900,
+  137, 580, 138, 324, 139, 836, 140, 196,
+  141, 708, 142, 452, 143, 964, 145, 548,
+  146, 292, 147, 804, 148, 164, 149, 676,
+  150, 420, 151, 932, 153, 612, 154, 356,
+  155, 868, 156, 228, 157, 740, 158, 484,
+  159, 996, 161, 532, 162, 276, 163, 788,
+  165, 660, 166, 404, 167, 916, 169, 596,
+  170, 340, 171, 852, 172, 212, 173, 724,
+  174, 468, 175, 980, 177, 564, 178, 308,
+  179, 820, 181, 692, 182, 436, 183, 948,
+  185, 628, 186, 372, 187, 884, 188, 244,
+  189, 756, 190, 500, 191, 1012, 193, 524,
+  194, 268, 195, 780, 197, 652, 198, 396,
+  199, 908, 201, 588, 202, 332, 203, 844,
+  205, 716, 206, 460, 207, 972, 209, 556,
+  210, 300, 211, 812, 213, 684, 214, 428,
+  215, 940, 217, 620, 218, 364, 219, 876,
+  220, 236, 221, 748, 222, 492, 223, 1004,
+  225, 540, 226, 284, 227, 796, 229, 668,
+  230, 412, 231, 924, 233, 604, 234, 348,
+  235, 860, 237, 732, 238, 476, 239, 988,
+  241, 572, 242, 316, 243, 828, 245, 700,
+  246, 444, 247, 956, 249, 636, 250, 380,
+  251, 892, 253, 764, 254, 508, 255, 1020,
+  257, 514, 259, 770, 261, 642, 262, 386,
+  263, 898, 265, 578, 266, 322, 267, 834,
+  269, 706, 270, 450, 271, 962, 273, 546,
+  274, 290, 275, 802, 277, 674, 278, 418,
+  279, 930, 281, 610, 282, 354, 283, 866,
+  285, 738, 286, 482, 287, 994, 289, 530,
+  291, 786, 293, 658, 294, 402, 295, 914,
+  297, 594, 298, 338, 299, 850, 301, 722,
+  302, 466, 303, 978, 305, 562, 307, 818,
+  309, 690, 310, 434, 311, 946, 313, 626,
+  314, 370, 315, 882, 317, 754, 318, 498,
+  319, 1010, 321, 522, 323, 778, 325, 650,
+  326, 394, 327, 906, 329, 586, 331, 842,
+  333, 714, 334, 458, 335, 970, 337, 554,
+  339, 810, 341, 682, 342, 426, 343, 938,
+  345, 618, 346, 362, 347, 874, 349, 746,
+  350, 490, 351, 1002, 353, 538, 355, 794,
+  357, 666, 358, 410, 359, 922, 361, 602,
+  363, 858, 365, 730, 366, 474, 367, 986,
+  369, 570, 371, 826, 373, 698, 374, 442,
+  375, 954, 377, 634, 379, 890, 381, 762,
+  382, 506, 383, 1018, 385, 518, 387, 774,
+  389, 646, 391, 902, 393, 582, 395, 838,
+  397, 710, 398, 454, 399, 966, 401, 550,
+  403, 806, 405, 678, 406, 422, 407, 934,
+  409, 614, 411, 870, 413, 742, 414, 486,
+  415, 998, 417, 534, 419, 790, 421, 662,
+  423, 918, 425, 598, 427, 854, 429, 726,
+  430, 470, 431, 982, 433, 566, 435, 822,
+  437, 694, 439, 950, 441, 630, 443, 886,
+  445, 758, 446, 502, 447, 1014, 449, 526,
+  451, 782, 453, 654, 455, 910, 457, 590,
+  459, 846, 461, 718, 463, 974, 465, 558,
+  467, 814, 469, 686, 471, 942, 473, 622,
+  475, 878, 477, 750, 478, 494, 479, 1006,
+  481, 542, 483, 798, 485, 670, 487, 926,
+  489, 606, 491, 862, 493, 734, 495, 990,
+  497, 574, 499, 830, 501, 702, 503, 958,
+  505, 638, 507, 894, 509, 766, 511, 1022,
+  515, 769, 517, 641, 519, 897, 521, 577,
+  523, 833, 525, 705, 527, 961, 529, 545,
+  531, 801, 533, 673, 535, 929, 537, 609,
+  539, 865, 541, 737, 543, 993, 547, 785,
+  549, 657, 551, 913, 553, 593, 555, 849,
+  557, 721, 559, 977, 563, 817, 565, 689,
+  567, 945, 569, 625, 571, 881, 573, 753,
+  575, 1009, 579, 777, 581, 649, 583, 905,
+  587, 841, 589, 713, 591, 969, 595, 809,
+  597, 681, 599, 937, 601, 617, 603, 873,
+  605, 745, 607, 1001, 611, 793, 613, 665,
+  615, 921, 619, 857, 621, 729, 623, 985,
+  627, 825, 629, 697, 631, 953, 635, 889,
+  637, 761, 639, 1017, 643, 773, 647, 901,
+  651, 837, 653, 709, 655, 965, 659, 805,
+  661, 677, 663, 933, 667, 869, 669, 741,
+  671, 997, 675, 789, 679, 917, 683, 853,
+  685, 725, 687, 981, 691, 821, 695, 949,
+  699, 885, 701, 757, 703, 1013, 707, 781,
+  711, 909, 715, 845, 719, 973, 723, 813,
+  727, 941, 731, 877, 733, 749, 735, 1005,
+  739, 797, 743, 925, 747, 861, 751, 989,
+  755, 829, 759, 957, 763, 893, 767, 1021,
+  775, 899, 779, 835, 783, 963, 787, 803,
+  791, 931, 795, 867, 799, 995, 807, 915,
+  811, 851, 815, 979, 823, 947, 827, 883,
+  831, 1011, 839, 907, 847, 971, 855, 939,
+  859, 875, 863, 1003, 871, 923, 879, 987,
+  887, 955, 895, 1019, 911, 967, 919, 935,
+  927, 999, 943, 983, 959, 1015, 991, 1007
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 2048 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
+const uint16_t armBitRevIndexTable2048[1984] = {
+  1, 1024, 2, 512, 3, 1536, 4, 256,
+  5, 1280, 6, 768, 7, 1792, 8, 128,
+  9, 1152, 10, 640, 11, 1664, 12, 384,
+  13, 1408, 14, 896, 15, 1920, 16, 64,
+  17, 1088, 18, 576, 19, 1600, 20, 320,
+  21, 1344, 22, 832, 23, 1856, 24, 192,
+  25, 1216, 26, 704, 27, 1728, 28, 448,
+  29, 1472, 30, 960, 31, 1984, 33, 1056,
+  34, 544, 35, 1568, 36, 288, 37, 1312,
+  38, 800, 39, 1824, 40, 160, 41, 1184,
+  42, 672, 43, 1696, 44, 416, 45, 1440,
+  46, 928, 47, 1952, 48, 96, 49, 1120,
+  50, 608, 51, 1632, 52, 352, 53, 1376,
+  54, 864, 55, 1888, 56, 224, 57, 1248,
+  58, 736, 59, 1760, 60, 480, 61, 1504,
+  62, 992, 63, 2016, 65, 1040, 66, 528,
+  67, 1552, 68, 272, 69, 1296, 70, 784,
+  71, 1808, 72, 144, 73, 1168, 74, 656,
+  75, 1680, 76, 400, 77, 1424, 78, 912,
+  79, 1936, 81, 1104, 82, 592, 83, 1616,
+  84, 336, 85, 1360, 86, 848, 87, 1872,
+  88, 208, 89, 1232, 90, 720, 91, 1744,
+  92, 464, 93, 1488, 94, 976, 95, 2000,
+  97, 1072, 98, 560, 99, 1584, 100, 304,
+  101, 1328, 102, 816, 103, 1840, 104, 176,
+  105, 1200, 106, 688, 107, 1712, 108, 432,
+  109, 1456, 110, 944, 111, 1968, 113, 1136,
+  114, 624, 115, 1648, 116, 368, 117, 1392,
+  118, 880, 119, 1904, 120, 240, 121, 1264,
+  122, 752, 123, 1776, 124, 496, 125, 1520,
+  126, 1008, 127, 2032, 129, 1032, 130, 520,
+  131, 1544, 132, 264, 133, 1288, 134, 776,
+  135, 1800, 137, 1160, 138, 648, 139, 1672,
+  140, 392, 141, 1416, 142, 904, 143, 1928,
+  145, 1096, 146, 584, 147, 1608, 148, 328,
+  149, 1352, 150, 840, 151, 1864, 152, 200,
+  153, 1224, 154, 712, 155, 1736, 156, 456,
+  157, 1480, 158, 968, 159, 1992, 161, 1064,
+  162, 552, 163, 1576, 164, 296, 165, 1320,
+  166, 808, 167, 1832, 169, 1192, 170, 680,
+  171, 1704, 172, 424, 173, 1448, 174, 936,
+  175, 1960, 177, 1128, 178, 616, 179, 1640,
+  180, 360, 181, 1384, 182, 872, 183, 1896,
+  184, 232, 185, 1256, 186, 744, 187, 1768,
+  188, 488, 189, 1512, 190, 1000, 191, 2024,
+  193, 1048, 194, 536, 195, 1560, 196, 280,
+  197, 1304, 198, 792, 199, 1816, 201, 1176,
+  202, 664, 203, 1688, 204, 408, 205, 1432,
+  206, 920, 207, 1944, 209, 1112, 210, 600,
+  211, 1624, 212, 344, 213, 1368, 214, 856,
+  215, 1880, 217, 1240, 218, 728, 219, 1752,
+  220, 472, 221, 1496, 222, 984, 223, 2008,
+  225, 1080, 226, 568, 227, 1592, 228, 312,
+  229, 1336, 230, 824, 231, 1848, 233, 1208,
+  234, 696, 235, 1720, 236, 440, 237, 1464,
+  238, 952, 239, 1976, 241, 1144, 242, 632,
+  243, 1656, 244, 376, 245, 1400, 246, 888,
+  247, 1912, 249, 1272, 250, 760, 251, 1784,
+  252, 504, 253, 1528, 254, 1016, 255, 2040,
+  257, 1028, 258, 516, 259, 1540, 261, 1284,
+  262, 772, 263, 1796, 265, 1156, 266, 644,
+  267, 1668, 268, 388, 269, 1412, 270, 900,
+  271, 1924, 273, 1092, 274, 580, 275, 1604,
+  276, 324, 277, 1348, 278, 836, 279, 1860,
+  281, 1220, 282, 708, 283, 1732, 284, 452,
+  285, 1476, 286, 964, 287, 1988, 289, 1060,
+  290, 548, 291, 1572, 293, 1316, 294, 804,
+  295, 1828, 297, 1188, 298, 676, 299, 1700,
+  300, 420, 301, 1444, 302, 932, 303, 1956,
+  305, 1124, 306, 612, 307, 1636, 308, 356,
+  309, 1380, 310, 868, 311, 1892, 313, 1252,
+  314, 740, 315, 1764, 316, 484, 317, 1508,
+  318, 996, 319, 2020, 321, 1044, 322, 532,
+  323, 1556, 325, 1300, 326, 788, 327, 1812,
+  329, 1172, 330, 660, 331, 1684, 332, 404,
+  333, 1428, 334, 916, 335, 1940, 337, 1108,
+  338, 596, 339, 1620, 341, 1364, 342, 852,
+  343, 1876, 345, 1236, 346, 724, 347, 1748,
+  348, 468, 349, 1492, 350, 980, 351, 2004,
+  353, 1076, 354, 564, 355, 1588, 357, 1332,
+  358, 820, 359, 1844, 361, 1204, 362, 692,
+  363, 1716, 364, 436, 365, 1460, 366, 948,
+  367, 1972, 369, 1140, 370, 628, 371, 1652,
+  373, 1396, 374, 884, 375, 1908, 377, 1268,
+  378, 756, 379, 1780, 380, 500, 381, 1524,
+  382, 1012, 383, 2036, 385, 1036, 386, 524,
+  387, 1548, 389, 1292, 390, 780, 391, 1804,
+  393, 1164, 394, 652, 395, 1676, 397, 1420,
+  398, 908, 399, 1932, 401, 1100, 402, 588,
+  403, 1612, 405, 1356, 406, 844, 407, 1868,
+  409, 1228, 410, 716, 411, 1740, 412, 460,
+  413, 1484, 414, 972, 415, 1996, 417, 1068,
+  418, 556, 419, 1580, 421, 1324, 422, 812,
+  423, 1836, 425, 1196, 426, 684, 427, 1708,
+  429, 1452, 430, 940, 431, 1964, 433, 1132,
+  434, 620, 435, 1644, 437, 1388, 438, 876,
+  439, 1900, 441, 1260, 442, 748, 443, 1772,
+  444, 492, 445, 1516, 446, 1004, 447, 2028,
+  449, 1052, 450, 540, 451, 1564, 453, 1308,
+  454, 796, 455, 1820, 457, 1180, 458, 668,
+  459, 1692, 461, 1436, 462, 924, 463, 1948,
+  465, 1116, 466, 604, 467, 1628, 469, 1372,
+  470, 860, 471, 1884, 473, 1244, 474, 732,
+  475, 1756, 477, 1500, 478, 988, 479, 2012,
+  481, 1084, 482, 572, 483, 1596, 485, 1340,
+  486, 828, 487, 1852, 489, 1212, 490, 700,
+  491, 1724, 493, 1468, 494, 956, 495, 1980,
+  497, 1148, 498, 636, 499, 1660, 501, 1404,
+  502, 892, 503, 1916, 505, 1276, 506, 764,
+  507, 1788, 509, 1532, 510, 1020, 511, 2044,
+  513, 1026, 515, 1538, 517, 1282, 518, 770,
+  519, 1794, 521, 1154, 522, 642, 523, 1666,
+  525, 1410, 526, 898, 527, 1922, 529, 1090,
+  530, 578, 531, 1602, 533, 1346, 534, 834,
+  535, 1858, 537, 1218, 538, 706, 539, 1730,
+  541, 1474, 542, 962, 543, 1986, 545, 1058,
+  547, 1570, 549, 1314, 550, 802, 551, 1826,
+  553, 1186, 554, 674, 555, 1698, 557, 1442,
+  558, 930, 559, 1954, 561, 1122, 562, 610,
+  563, 1634, 565, 1378, 566, 866, 567, 1890,
+  569, 1250, 570, 738, 571, 1762, 573, 1506,
+  574, 994, 575, 2018, 577, 1042, 579, 1554,
+  581, 1298, 582, 786, 583, 1810, 585, 1170,
+  586, 658, 587, 1682, 589, 1426, 590, 914,
+  591, 1938, 593, 1106, 595, 1618, 597, 1362,
+  598, 850, 599, 1874, 601, 1234, 602, 722,
+  603, 1746, 605, 1490, 606, 978, 607, 2002,
+  609, 1074, 611, 1586, 613, 1330, 614, 818,
+  615, 1842, 617, 1202, 618, 690, 619, 1714,
+  621, 1458, 622, 946, 623, 1970, 625, 1138,
+  627, 1650, 629, 1394, 630, 882, 631, 1906,
+  633, 1266, 634, 754, 635, 1778, 637, 1522,
+  638, 1010, 639, 2034, 641, 1034, 643, 1546,
+  645, 1290, 646, 778, 647, 1802, 649, 1162,
+  651, 1674, 653, 1418, 654, 906, 655, 1930,
+  657, 1098, 659, 1610, 661, 1354, 662, 842,
+  663, 1866, 665, 1226, 666, 714, 667, 1738,
+  669, 1482, 670, 970, 671, 1994, 673, 1066,
+  675, 1578, 677, 1322, 678, 810, 679, 1834,
+  681, 1194, 683, 1706, 685, 1450, 686, 938,
+  687, 1962, 689, 1130, 691, 1642, 693, 1386,
+  694, 874, 695, 1898, 697, 1258, 698, 746,
+  699, 1770, 701, 1514, 702, 1002, 703, 2026,
+  705, 1050, 707, 1562, 709, 1306, 710, 794,
+  711, 1818, 713, 1178, 715, 1690, 717, 1434,
+  718, 922, 719, 1946, 721, 1114, 723, 1626,
+  725, 1370, 726, 858, 727, 1882, 729, 1242,
+  731, 1754, 733, 1498, 734, 986, 735, 2010,
+  737, 1082, 739, 1594, 741, 1338, 742, 826,
+  743, 1850, 745, 1210, 747, 1722, 749, 1466,
+  750, 954, 751, 1978, 753, 1146, 755, 1658,
+  757, 1402, 758, 890, 759, 1914, 761, 1274,
+  763, 1786, 765, 1530, 766, 1018, 767, 2042,
+  769, 1030, 771, 1542, 773, 1286, 775, 1798,
+  777, 1158, 779, 1670, 781, 1414, 782, 902,
+  783, 1926, 785, 1094, 787, 1606, 789, 1350,
+  790, 838, 791, 1862, 793, 1222, 795, 1734,
+  797, 1478, 798, 966, 799, 1990, 801, 1062,
+  803, 1574, 805, 1318, 807, 1830, 809, 1190,
+  811, 1702, 813, 1446, 814, 934, 815, 1958,
+  817, 1126, 819, 1638, 821, 1382, 822, 870,
+  823, 1894, 825, 1254, 827, 1766, 829, 1510,
+  830, 998, 831, 2022, 833, 1046, 835, 1558,
+  837, 1302, 839, 1814, 841, 1174, 843, 1686,
+  845, 1430, 846, 918, 847, 1942, 849, 1110,
+  851, 1622, 853, 1366, 855, 1878, 857, 1238,
+  859, 1750, 861, 1494, 862, 982, 863, 2006,
+  865, 1078, 867, 1590, 869, 1334, 871, 1846,
+  873, 1206, 875, 1718, 877, 1462, 878, 950,
+  879, 1974, 881, 1142, 883, 1654, 885, 1398,
+  887, 1910, 889, 1270, 891, 1782, 893, 1526,
+  894, 1014, 895, 2038, 897, 1038, 899, 1550,
+  901, 1294, 903, 1806, 905, 1166, 907, 1678,
+  909, 1422, 911, 1934, 913, 1102, 915, 1614,
+  917, 1358, 919, 1870, 921, 1230, 923, 1742,
+  925, 1486, 926, 974, 927, 1998, 929, 1070,
+  931, 1582, 933, 1326, 935, 1838, 937, 1198,
+  939, 1710, 941, 1454, 943, 1966, 945, 1134,
+  947, 1646, 949, 1390, 951, 1902, 953, 1262,
+  955, 1774, 957, 1518, 958, 1006, 959, 2030,
+  961, 1054, 963, 1566, 965, 1310, 967, 1822,
+  969, 1182, 971, 1694, 973, 1438, 975, 1950,
+  977, 1118, 979, 1630, 981, 1374, 983, 1886,
+  985, 1246, 987, 1758, 989, 1502, 991, 2014,
+  993, 1086, 995, 1598, 997, 1342, 999, 1854,
+  1001, 1214, 1003, 1726, 1005, 1470, 1007, 1982,
+  1009, 1150, 1011, 1662, 1013, 1406, 1015, 1918,
+  1017, 1278, 1019, 1790, 1021, 1534, 1023, 2046,
+  1027, 1537, 1029, 1281, 1031, 1793, 1033, 1153,
+  1035, 1665, 1037, 1409, 1039, 1921, 1041, 1089,
+  1043, 1601, 1045, 1345, 1047, 1857, 1049, 1217,
+  1051, 1729, 1053, 1473, 1055, 1985, 1059, 1569,
+  1061, 1313, 1063, 1825, 1065, 1185, 1067, 1697,
+  1069, 1441, 1071, 1953, 1073, 1121, 1075, 1633,
+  1077, 1377, 1079, 1889, 1081, 1249, 1083, 1761,
+  1085, 1505, 1087, 2017, 1091, 1553, 1093, 1297,
+  1095, 1809, 1097, 1169, 1099, 1681, 1101, 1425,
+  1103, 1937, 1107, 1617, 1109, 1361, 1111, 1873,
+  1113, 1233, 1115, 1745, 1117, 1489, 1119, 2001,
+  1123, 1585, 1125, 1329, 1127, 1841, 1129, 1201,
+  1131, 1713, 1133, 1457, 1135, 1969, 1139, 1649,
+  1141, 1393, 1143, 1905, 1145, 1265, 1147, 1777,
+  1149, 1521, 1151, 2033, 1155, 1545, 1157, 1289,
+  1159, 1801, 1163, 1673, 1165, 1417, 1167, 1929,
+  1171, 1609, 1173, 1353, 1175, 1865, 1177, 1225,
+  1179, 1737, 1181, 1481, 1183, 1993, 1187, 1577,
+  1189, 1321, 1191, 1833, 1195, 1705, 1197, 1449,
+  1199, 1961, 1203, 1641, 1205, 1385, 1207, 1897,
+  1209, 1257, 1211, 1769, 1213, 1513, 1215, 2025,
+  1219, 1561, 1221, 1305, 1223, 1817, 1227, 1689,
+  1229, 1433, 1231, 1945, 1235, 1625, 1237, 1369,
+  1239, 1881, 1243, 1753, 1245, 1497, 1247, 2009,
+  1251, 1593, 1253, 1337, 1255, 1849, 1259, 1721,
+  1261, 1465, 1263, 1977, 1267, 1657, 1269, 1401,
+  1271, 1913, 1275, 1785, 1277, 1529, 1279, 2041,
+  1283, 1541, 1287, 1797, 1291, 1669, 1293, 1413,
+  1295, 1925, 1299, 1605, 1301, 1349, 1303, 1861,
+  1307, 1733, 1309, 1477, 1311, 1989, 1315, 1573,
+  1319, 1829, 1323, 1701, 1325, 1445, 1327, 1957,
+  1331, 1637, 1333, 1381, 1335, 1893, 1339, 1765,
+  1341, 1509, 1343, 2021, 1347, 1557, 1351, 1813,
+  1355, 1685, 1357, 1429, 1359, 1941, 1363, 1621,
+  1367, 1877, 1371, 1749, 1373, 1493, 1375, 2005,
+  1379, 1589, 1383, 1845, 1387, 1717, 1389, 1461,
+  1391, 1973, 1395, 1653, 1399, 1909, 1403, 1781,
+  1405, 1525, 1407, 2037, 1411, 1549, 1415, 1805,
+  1419, 1677, 1423, 1933, 1427, 1613, 1431, 1869,
+  1435, 1741, 1437, 1485, 1439, 1997, 1443, 1581,
+  1447, 1837, 1451, 1709, 1455, 1965, 1459, 1645,
+  1463, 1901, 1467, 1773, 1469, 1517, 1471, 2029,
+  1475, 1565, 1479, 1821, 1483, 1693, 1487, 1949,
+  1491, 1629, 1495, 1885, 1499, 1757, 1503, 2013,
+  1507, 1597, 1511, 1853, 1515, 1725, 1519, 1981,
+  1523, 1661, 1527, 1917, 1531, 1789, 1535, 2045,
+  1543, 1795, 1547, 1667, 1551, 1923, 1555, 1603,
+  1559, 1859, 1563, 1731, 1567, 1987, 1575, 1827,
+  1579, 1699, 1583, 1955, 1587, 1635, 1591, 1891,
+  1595, 1763, 1599, 2019, 1607, 1811, 1611, 1683,
+  1615, 1939, 1623, 1875, 1627, 1747, 1631, 2003,
+  1639, 1843, 1643, 1715, 1647, 1971, 1655, 1907,
+  1659, 1779, 1663, 2035, 1671, 1803, 1679, 1931,
+  1687, 1867, 1691, 1739, 1695, 1995, 1703, 1835,
+  1711, 1963, 1719, 1899, 1723, 1771, 1727, 2027,
+  1735, 1819, 1743, 1947, 1751, 1883, 1759, 2011,
+  1767, 1851, 1775, 1979, 1783, 1915, 1791, 2043,
+  1807, 1927, 1815, 1863, 1823, 1991, 1839, 1959,
+  1847, 1895, 1855, 2023, 1871, 1943, 1887, 2007,
+  1903, 1975, 1919, 2039, 1951, 1999, 1983, 2031
+};
+#endif
+
+/**    
+* @brief  Bit reversal table of the 4096 point mixed radix CFFT: pairs of    
+* complex indexes to swap    
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
+const uint16_t armBitRevIndexTable4096[4032] = {
+  1, 2048, 2, 1024, 3, 3072, 4, 512,
+  5, 2560, 6, 1536, 7, 3584, 8, 256,
+  9, 2304, 10, 1280, 11, 3328, 12, 768,
+  13, 2816, 14, 1792, 15, 3840, 16, 128,
+  17, 2176, 18, 1152, 19, 3200, 20, 640,
+  21, 2688, 22, 1664, 23, 3712, 24, 384,
+  25, 2432, 26, 1408, 27, 3456, 28, 896,
+  29, 2944, 30, 1920, 31, 3968, 32, 64,
+  33, 2112, 34, 1088, 35, 3136, 36, 576,
+  37, 2624, 38, 1600, 39, 3648, 40, 320,
+  41, 2368, 42, 1344, 43, 3392, 44, 832,
+  45, 2880, 46, 1856, 47, 3904, 48, 192,
+  49, 2240, 50, 1216, 51, 3264, 52, 704,
+  53, 2752, 54, 1728, 55, 3776, 56, 448,
+  57, 2496, 58, 1472, 59, 3520, 60, 960,
+  61, 3008, 62, 1984, 63, 4032, 65, 2080,
+  66, 1056, 67, 3104, 68, 544, 69, 2592,
+  70, 1568, 71, 3616, 72, 288, 73, 2336,
+  74, 1312, 75, 3360, 76, 800, 77, 2848,
+  78, 1824, 79, 3872, 80, 160, 81, 2208,
+  82, 1184, 83, 3232, 84, 672, 85, 2720,
+  86, 1696, 87, 3744, 88, 416, 89, 2464,
+  90, 1440, 91, 3488, 92, 928, 93, 2976,
+  94, 1952, 95, 4000, 97, 2144, 98, 1120,
+  99, 3168, 100, 608, 101, 2656, 102, 1632,
+  103, 3680, 104, 352, 105, 2400, 106, 1376,
+  107, 3424, 108, 864, 109, 2912, 110, 1888,
+  111, 3936, 112, 224, 113, 2272, 114, 1248,
+  115, 3296, 116, 736, 117, 2784, 118, 1760,
+  119, 3808, 120, 480, 121, 2528, 122, 1504,
+  123, 3552, 124, 992, 125, 3040, 126, 2016,
+  127, 4064, 129, 2064, 130, 1040, 131, 3088,
+  132, 528, 133, 2576, 134, 1552, 135, 3600,
+  136, 272, 137, 2320, 138, 1296, 139, 3344,
+  140, 784, 141, 2832, 142, 1808, 143, 3856,
+  145, 2192, 146, 1168, 147, 3216, 148, 656,
+  149, 2704, 150, 1680, 151, 3728, 152, 400,
+  153, 2448, 154, 1424, 155, 3472, 156, 912,
+  157, 2960, 158, 1936, 159, 3984, 161, 2128,
+  162, 1104, 163, 3152, 164, 592, 165, 2640,
+  166, 1616, 167, 3664, 168, 336, 169, 2384,
+  170, 1360, 171, 3408, 172, 848, 173, 2896,
+  174, 1872, 175, 3920, 176, 208, 177, 2256,
+  178, 1232, 179, 3280, 180, 720, 181, 2768,
+  182, 1744, 183, 3792, 184, 464, 185, 2512,
+  186, 1488, 187, 3536, 188, 976, 189, 3024,
+  190, 2000, 191, 4048, 193, 2096, 194, 1072,
+  195, 3120, 196, 560, 197, 2608, 198, 1584,
+  199, 3632, 200, 304, 201, 2352, 202, 1328,
+  203, 3376, 204, 816, 205, 2864, 206, 1840,
+  207, 3888, 209, 2224, 210, 1200, 211, 3248,
+  212, 688, 213, 2736, 214, 1712, 215, 3760,
+  216, 432, 217, 2480, 218, 1456, 219, 3504,
+  220, 944, 221, 2992, 222, 1968, 223, 4016,
+  225, 2160, 226, 1136, 227, 3184, 228, 624,
+  229, 2672, 230, 1648, 231, 3696, 232, 368,
+  233, 2416, 234, 1392, 235, 3440, 236, 880,
+  237, 2928, 238, 1904, 239, 3952, 241, 2288,
+  242, 1264, 243, 3312, 244, 752, 245, 2800,
+  246, 1776, 247, 3824, 248, 496, 249, 2544,
+  250, 1520, 251, 3568, 252, 1008, 253, 3056,
+  254, 2032, 255, 4080, 257, 2056, 258, 1032,
+  259, 3080, 260, 520, 261, 2568, 262, 1544,
+  263, 3592, 265, 2312, 266, 1288, 267, 3336,
+  268, 776, 269, 2824, 270, 1800, 271, 3848,
+  273, 2184, 274, 1160, 275, 3208, 276, 648,
+  277, 2696, 278, 1672, 279, 3720, 280, 392,
+  281, 2440, 282, 1416, 283, 3464, 284, 904,
+  285, 2952, 286, 1928, 287, 3976, 289, 2120,
+  290, 1096, 291, 3144, 292, 584, 293, 2632,
+  294, 1608, 295, 3656, 296, 328, 297, 2376,
+  298, 1352, 299, 3400, 300, 840, 301, 2888,
+  302, 1864, 303, 3912, 305, 2248, 306, 1224,
+  307, 3272, 308, 712, 309, 2760, 310, 1736,
+  311, 3784, 312, 456, 313, 2504, 314, 1480,
+  315, 3528, 316, 968, 317, 3016, 318, 1992,
+  319, 4040, 321, 2088, 322, 1064, 323, 3112,
+  324, 552, 325, 2600, 326, 1576, 327, 3624,
+  329, 2344, 330, 1320, 331, 3368, 332, 808,
+  333, 2856, 334, 1832, 335, 3880, 337, 2216,
+  338, 1192, 339, 3240, 340, 680, 341, 2728,
+  342, 1704, 343, 3752, 344, 424, 345, 2472,
+  346, 1448, 347, 3496, 348, 936, 349, 2984,
+  350, 1960, 351, 4008, 353, 2152, 354, 1128,
+  355, 3176, 356, 616, 357, 2664, 358, 1640,
+  359, 3688, 361, 2408, 362, 1384, 363, 3432,
+  364, 872, 365, 2920, 366, 1896, 367, 3944,
+  369, 2280, 370, 1256, 371, 3304, 372, 744,
+  373, 2792, 374, 1768, 375, 3816, 376, 488,
+  377, 2536, 378, 1512, 379, 3560, 380, 1000,
+  381, 3048, 382, 2024, 383, 4072, 385, 2072,
+  386, 1048, 387, 3096, 388, 536, 389, 2584,
+  390, 1560, 391, 3608, 393, 2328, 394, 1304,
+  395, 3352, 396, 792, 397, 2840, 398, 1816,
+  399, 3864, 401, 2200, 402, 1176, 403, 3224,
+  404, 664, 405, 2712, 406, 1688, 407, 3736,
+  409, 2456, 410, 1432, 411, 3480, 412, 920,
+  413, 2968, 414, 1944, 415, 3992, 417, 2136,
+  418, 1112, 419, 3160, 420, 600, 421, 2648,
+  422, 1624, 423, 3672, 425, 2392, 426, 1368,
+  427, 3416, 428, 856, 429, 2904, 430, 1880,
+  431, 3928, 433, 2264, 434, 1240, 435, 3288,
+  436, 728, 437, 2776, 438, 1752, 439, 3800,
+  440, 472, 441, 2520, 442, 1496, 443, 3544,
+  444, 984, 445, 3032, 446, 2008, 447, 4056,
+  449, 2104, 450, 1080, 451, 3128, 452, 568,
+  453, 2616, 454, 1592, 455, 3640, 457, 2360,
+  458, 1336, 459, 3384, 460, 824, 461, 2872,
+  462, 1848, 463, 3896, 465, 2232, 466, 1208,
+  467, 3256, 468, 696, 469, 2744, 470, 1720,
+  471, 3768, 473, 2488, 474, 1464, 475, 3512,
+  476, 952, 477, 3000, 478, 1976, 479, 4024,
+  481, 2168, 482, 1144, 483, 3192, 484, 632,
+  485, 2680, 486, 1656, 487, 3704, 489, 2424,
+  490, 1400, 491, 3448, 492, 888, 493, 2936,
+  494, 1912, 495, 3960, 497, 2296, 498, 1272,
+  499, 3320, 500, 760, 501, 2808, 502, 1784,
+  503, 3832, 505, 2552, 506, 1528, 507, 3576,
+  508, 1016, 509, 3064, 510, 2040, 511, 4088,
+  513, 2052, 514, 1028, 515, 3076, 517, 2564,
+  518, 1540, 519, 3588, 521, 2308, 522, 1284,
+  523, 3332, 524, 772, 525, 2820, 526, 1796,
+  527, 3844, 529, 2180, 530, 1156, 531, 3204,
+  532, 644, 533, 2692, 534, 1668, 535, 3716,
+  537, 2436, 538, 1412, 539, 3460, 540, 900,
+  541, 2948, 542, 1924, 543, 3972, 545, 2116,
+  546, 1092, 547, 3140, 548, 580, 549, 2628,
+  550, 1604, 551, 3652, 553, 2372, 554, 1348,
+  555, 3396, 556, 836, 557, 2884, 558, 1860,
+  559, 3908, 561, 2244, 562, 1220, 563, 3268,
+  564, 708, 565, 2756, 566, 1732, 567, 3780,
+  569, 2500, 570, 1476, 571, 3524, 572, 964,
+  573, 3012, 574, 1988, 575, 4036, 577, 2084,
+  578, 1060, 579, 3108, 581, 2596, 582, 1572,
+  583, 3620, 585, 2340, 586, 1316, 587, 3364,
+  588, 804, 589, 2852, 590, 1828, 591, 3876,
+  593, 2212, 594, 1188, 595, 3236, 596, 676,
+  597, 2724, 598, 1700, 599, 3748, 601, 2468,
+  602, 1444, 603, 3492, 604, 932, 605, 2980,
+  606, 1956, 607, 4004, 609, 2148, 610, 1124,
+  611, 3172, 613, 2660, 614, 1636, 615, 3684,
+  617, 2404, 618, 1380, 619, 3428, 620, 868,
+  621, 2916, 622, 1892, 623, 3940, 625, 2276,
+  626, 1252, 627, 3300, 628, 740, 629, 2788,
+  630, 1764, 631, 3812, 633, 2532, 634, 1508,
+  635, 3556, 636, 996, 637, 3044, 638, 2020,
+  639, 4068, 641, 2068, 642, 1044, 643, 3092,
+  645, 2580, 646, 1556, 647, 3604, 649, 2324,
+  650, 1300, 651, 3348, 652, 788, 653, 2836,
+  654, 1812, 655, 3860, 657, 2196, 658, 1172,
+  659, 3220, 661, 2708, 662, 1684, 663, 3732,
+  665, 2452, 666, 1428, 667, 3476, 668, 916,
+  669, 2964, 670, 1940, 671, 3988, 673, 2132,
+  674, 1108, 675, 3156, 677, 2644, 678, 1620,
+  679, 3668, 681, 2388, 682, 1364, 683, 3412,
+  684, 852, 685, 2900, 686, 1876, 687, 3924,
+  689, 2260, 690, 1236, 691, 3284, 692, 724,
+  693, 2772, 694, 1748, 695, 3796, 697, 2516,
+  698, 1492, 699, 3540, 700, 980, 701, 3028,
+  702, 2004, 703, 4052, 705, 2100, 706, 1076,
+  707, 3124, 709, 2612, 710, 1588, 711, 3636,
+  713, 2356, 714, 1332, 715, 3380, 716, 820,
+  717, 2868, 718, 1844, 719, 3892, 721, 2228,
+  722, 1204, 723, 3252, 725, 2740, 726, 1716,
+  727, 3764, 729, 2484, 730, 1460, 731, 3508,
+  732, 948, 733, 2996, 734, 1972, 735, 4020,
+  737, 2164, 738, 1140, 739, 3188, 741, 2676,
+  742, 1652, 743, 3700, 745, 2420, 746, 1396,
+  747, 3444, 748, 884, 749, 2932, 750, 1908,
+  751, 3956, 753, 2292, 754, 1268, 755, 3316,
+  757, 2804, 758, 1780, 759, 3828, 761, 2548,
+  762, 1524, 763, 3572, 764, 1012, 765, 3060,
+  766, 2036, 767, 4084, 769, 2060, 770, 1036,
+  771, 3084, 773, 2572, 774, 1548, 775, 3596,
+  777, 2316, 778, 1292, 779, 3340, 781, 2828,
+  782, 1804, 783, 3852, 785, 2188, 786, 1164,
+  787, 3212, 789, 2700, 790, 1676, 791, 3724,
+  793, 2444, 794, 1420, 795, 3468, 796, 908,
+  797, 2956, 798, 1932, 799, 3980, 801, 2124,
+  802, 1100, 803, 3148, 805, 2636, 806, 1612,
+  807, 3660, 809, 2380, 810, 1356, 811, 3404,
+  812, 844, 813, 2892, 814, 1868, 815, 3916,
+  817, 2252, 818, 1228, 819, 3276, 821, 2764,
+  822, 1740, 823, 3788, 825, 2508, 826, 1484,
+  827, 3532, 828, 972, 829, 3020, 830, 1996,
+  831, 4044, 833, 2092, 834, 1068, 835, 3116,
+  837, 2604, 838, 1580, 839, 3628, 841, 2348,
+  842, 1324, 843, 3372, 845, 2860, 846, 1836,
+  847, 3884, 849, 2220, 850, 1196, 851, 3244,
+  853, 2732, 854, 1708, 855, 3756, 857, 2476,
+  858, 1452, 859, 3500, 860, 940, 861, 2988,
+  862, 1964, 863, 4012, 865, 2156, 866, 1132,
+  867, 3180, 869, 2668, 870, 1644, 871, 3692,
+  873, 2412, 874, 1388, 875, 3436, 877, 2924,
+  878, 1900, 879, 3948, 881, 2284, 882, 1260,
+  883, 3308, 885, 2796, 886, 1772, 887, 3820,
+  889, 2540, 890, 1516, 891, 3564, 892, 1004,
+  893, 3052, 894, 2028, 895, 4076, 897, 2076,
+  898, 1052, 899, 3100, 901, 2588, 902, 1564,
+  903, 3612, 905, 2332, 906, 1308, 907, 3356,
+  909, 2844, 910, 1820, 911, 3868, 913, 2204,
+  914, 1180, 915, 3228, 917, 2716, 918, 1692,
+  919, 3740, 921, 2460, 922, 1436, 923, 3484,
+  925, 2972, 926, 1948, 927, 3996, 929, 2140,
+  930, 1116, 931, 3164, 933, 2652, 934, 1628,
+  935, 3676, 937, 2396, 938, 1372, 939, 3420,
+  941, 2908, 942, 1884, 943, 3932, 945, 2268,
+  946, 1244, 947, 3292, 949, 2780, 950, 1756,
+  951, 3804, 953, 2524, 954, 1500, 955, 3548,
+  956, 988, 957, 3036, 958, 2012, 959, 4060,
+  961, 2108, 962, 1084, 963, 3132, 965, 2620,
+  966, 1596, 967, 3644, 969, 2364, 970, 1340,
+  971, 3388, 973, 2876, 974, 1852, 975, 3900,
+  977, 2236, 978, 1212, 979, 3260, 981, 2748,
+  982, 1724, 983, 3772, 985, 2492, 986, 1468,
+  987, 3516, 989, 3004, 990, 1980, 991, 4028,
+  993, 2172, 994, 1148, 995, 3196, 997, 2684,
+  998, 1660, 999, 3708, 1001, 2428, 1002, 1404,
+  1003, 3452, 1005, 2940, 1006, 1916, 1007, 3964,
+  1009, 2300, 1010, 1276, 1011, 3324, 1013, 2812,
+  1014, 1788, 1015, 3836, 1017, 2556, 1018, 1532,
+  1019, 3580, 1021, 3068, 1022, 2044, 1023, 4092,
+  1025, 2050, 1027, 3074, 1029, 2562, 1030, 1538,
+  1031, 3586, 1033, 2306, 1034, 1282, 1035, 3330,
+  1037, 2818, 1038, 1794, 1039, 3842, 1041, 2178,
+  1042, 1154, 1043, 3202, 1045, 2690, 1046, 1666,
+  1047, 3714, 1049, 2434, 1050, 1410, 1051, 3458,
+  1053, 2946, 1054, 1922, 1055, 3970, 1057, 2114,
+  1058, 1090, 1059, 3138, 1061, 2626, 1062, 1602,
+  1063, 3650, 1065, 2370, 1066, 1346, 1067, 3394,
+  1069, 2882, 1070, 1858, 1071, 3906, 1073, 2242,
+  1074, 1218, 1075, 3266, 1077, 2754, 1078, 1730,
+  1079, 3778, 1081, 2498, 1082, 1474, 1083, 3522,
+  1085, 3010, 1086, 1986, 1087, 4034, 1089, 2082,
+  1091, 3106, 1093, 2594, 1094, 1570, 1095, 3618,
+  1097, 2338, 1098, 1314, 1099, 3362, 1101, 2850,
+  1102, 1826, 1103, 3874, 1105, 2210, 1106, 1186,
+  1107, 3234, 1109, 2722, 1110, 1698, 1111, 3746,
+  1113, 2466, 1114, 1442, 1115, 3490, 1117, 2978,
+  1118, 1954, 1119, 4002, 1121, 2146, 1123, 3170,
+  1125, 2658, 1126, 1634, 1127, 3682, 1129, 2402,
+  1130, 1378, 1131, 3426, 1133, 2914, 1134, 1890,
+  1135, 3938, 1137, 2274, 1138, 1250, 1139, 3298,
+  1141, 2786, 1142, 1762, 1143, 3810, 1145, 2530,
+  1146, 1506, 1147, 3554, 1149, 3042, 1150, 2018,
+  1151, 4066, 1153, 2066, 1155, 3090, 1157, 2578,
+  1158, 1554, 1159, 3602, 1161, 2322, 1162, 1298,
+  1163, 3346, 1165, 2834, 1166, 1810, 1167, 3858,
+  1169, 2194, 1171, 3218, 1173, 2706, 1174, 1682,
+  1175, 3730, 1177, 2450, 1178, 1426, 1179, 3474,
+  1181, 2962, 1182, 1938, 1183, 3986, 1185, 2130,
+  1187, 3154, 1189, 2642, 1190, 1618, 1191, 3666,
+  1193, 2386, 1194, 1362, 1195, 3410, 1197, 2898,
+  1198, 1874, 1199, 3922, 1201, 2258, 1202, 1234,
+  1203, 3282, 1205, 2770, 1206, 1746, 1207, 3794,
+  1209, 2514, 1210, 1490, 1211, 3538, 1213, 3026,
+  1214, 2002, 1215, 4050, 1217, 2098, 1219, 3122,
+  1221, 2610, 1222, 1586, 1223, 3634, 1225, 2354,
+  1226, 1330, 1227, 3378, 1229, 2866, 1230, 1842,
+  1231, 3890, 1233, 2226, 1235, 3250, 1237, 2738,
+  1238, 1714, 1239, 3762, 1241, 2482, 1242, 1458,
+  1243, 3506, 1245, 2994, 1246, 1970, 1247, 4018,
+  1249, 2162, 1251, 3186, 1253, 2674, 1254, 1650,
+  1255, 3698, 1257, 2418, 1258, 1394, 1259, 3442,
+  1261, 2930, 1262, 1906, 1263, 3954, 1265, 2290,
+  1267, 3314, 1269, 2802, 1270, 1778, 1271, 3826,
+  1273, 2546, 1274, 1522, 1275, 3570, 1277, 3058,
+  1278, 2034, 1279, 4082, 1281, 2058, 1283, 3082,
+  1285, 2570, 1286, 1546, 1287, 3594, 1289, 2314,
+  1291, 3338, 1293, 2826, 1294, 1802, 1295, 3850,
+  1297, 2186, 1299, 3210, 1301, 2698, 1302, 1674,
+  1303, 3722, 1305, 2442, 1306, 1418, 1307, 3466,
+  1309, 2954, 1310, 1930, 1311, 3978, 1313, 2122,
+  1315, 3146, 1317, 2634, 1318, 1610, 1319, 3658,
+  1321, 2378, 1322, 1354, 1323, 3402, 1325, 2890,
+  1326, 1866, 1327, 3914, 1329, 2250, 1331, 3274,
+  1333, 2762, 1334, 1738, 1335, 3786, 1337, 2506,
+  1338, 1482, 1339, 3530, 1341, 3018, 1342, 1994,
+  1343, 4042, 1345, 2090, 1347, 3114, 1349, 2602,
+  1350, 1578, 1351, 3626, 1353, 2346, 1355, 3370,
+  1357, 2858, 1358, 1834, 1359, 3882, 1361, 2218,
+  1363, 3242, 1365, 2730, 1366, 1706, 1367, 3754,
+  1369, 2474, 1370, 1450, 1371, 3498, 1373, 2986,
+  1374, 1962, 1375, 4010, 1377, 2154, 1379, 3178,
+  1381, 2666, 1382, 1642, 1383, 3690, 1385, 2410,
+  1387, 3434, 1389, 2922, 1390, 1898, 1391, 3946,
+  1393, 2282, 1395, 3306, 1397, 2794, 1398, 1770,
+  1399, 3818, 1401, 2538, 1402, 1514, 1403, 3562,
+  1405, 3050, 1406, 2026, 1407, 4074, 1409, 2074,
+  1411, 3098, 1413, 2586, 1414, 1562, 1415, 3610,
+  1417, 2330, 1419, 3354, 1421, 2842, 1422, 1818,
+  1423, 3866, 1425, 2202, 1427, 3226, 1429, 2714,
+  1430, 1690, 1431, 3738, 1433, 2458, 1435, 3482,
+  1437, 2970, 1438, 1946, 1439, 3994, 1441, 2138,
+  1443, 3162, 1445, 2650, 1446, 1626, 1447, 3674,
+  1449, 2394, 1451, 3418, 1453, 2906, 1454, 1882,
+  1455, 3930, 1457, 2266, 1459, 3290, 1461, 2778,
+  1462, 1754, 1463, 3802, 1465, 2522, 1466, 1498,
+  1467, 3546, 1469, 3034, 1470, 2010, 1471, 4058,
+  1473, 2106, 1475, 3130, 1477, 2618, 1478, 1594,
+  1479, 3642, 1481, 2362, 1483, 3386, 1485, 2874,
+  1486, 1850, 1487, 3898, 1489, 2234, 1491, 3258,
+  1493, 2746, 1494, 1722, 1495, 3770, 1497, 2490,
+  1499, 3514, 1501, 3002, 1502, 1978, 1503, 4026,
+  1505, 2170, 1507, 3194, 1509, 2682, 1510, 1658,
+  1511, 3706, 1513, 2426, 1515, 3450, 1517, 2938,
+  1518, 1914, 1519, 3962, 1521, 2298, 1523, 3322,
+  1525, 2810, 1526, 1786, 1527, 3834, 1529, 2554,
+  1531, 3578, 1533, 3066, 1534, 2042, 1535, 4090,
+  1537, 2054, 1539, 3078, 1541, 2566, 1543, 3590,
+  1545, 2310, 1547, 3334, 1549, 2822, 1550, 1798,
+  1551, 3846, 1553, 2182, 1555, 3206, 1557, 2694,
+  1558, 1670, 1559, 3718, 1561, 2438, 1563, 3462,
+  1565, 2950, 1566, 1926, 1567, 3974, 1569, 2118,
+  1571, 3142, 1573, 2630, 1574, 1606, 1575, 3654,
+  1577, 2374, 1579, 3398, 1581, 2886, 1582, 1862,
+  1583, 3910, 1585, 2246, 1587, 3270, 1589, 2758,
+  1590, 1734, 1591, 3782, 1593, 2502, 1595, 3526,
+  1597, 3014, 1598, 1990, 1599, 4038, 1601, 2086,
+  1603, 3110, 1605, 2598, 1607, 3622, 1609, 2342,
+  1611, 3366, 1613, 2854, 1614, 1830, 1615, 3878,
+  1617, 2214, 1619, 3238, 1621, 2726, 1622, 1702,
+  1623, 3750, 1625, 2470, 1627, 3494, 1629, 2982,
+  1630, 1958, 1631, 4006, 1633, 2150, 1635, 3174,
+  1637, 2662, 1639, 3686, 1641, 2406, 1643, 3430,
+  1645, 2918, 1646, 1894, 1647, 3942, 1649, 2278,
+  1651, 3302, 1653, 2790, 1654, 1766, 1655, 3814,
+  1657, 2534, 1659, 3558, 1661, 3046, 1662, 2022,
+  1663, 4070, 1665, 2070, 1667, 3094, 1669, 2582,
+  1671, 3606, 1673, 2326, 1675, 3350, 1677, 2838,
+  1678, 1814, 1679, 3862, 1681, 2198, 1683, 3222,
+  1685, 2710, 1687, 3734, 1689, 2454, 1691, 3478,
+  1693, 2966, 1694, 1942, 1695, 3990, 1697, 2134,
+  1699, 3158, 1701, 2646, 1703, 3670, 1705, 2390,
+  1707, 3414, 1709, 2902, 1710, 1878, 1711, 3926,
+  1713, 2262, 1715, 3286, 1717, 2774, 1718, 1750,
+  1719, 3798, 1721, 2518, 1723, 3542, 1725, 3030,
+  1726, 2006, 1727, 4054, 1729, 2102, 1731, 3126,
+  1733, 2614, 1735, 3638, 1737, 2358, 1739, 3382,
+  1741, 2870, 1742, 1846, 1743, 3894, 1745, 2230,
+  1747, 3254, 1749, 2742, 1751, 3766, 1753, 2486,
+  1755, 3510, 1757, 2998, 1758, 1974, 1759, 4022,
+  1761, 2166, 1763, 3190, 1765, 2678, 1767, 3702,
+  1769, 2422, 1771, 3446, 1773, 2934, 1774, 1910,
+  1775, 3958, 1777, 2294, 1779, 3318, 1781, 2806,
+  1783, 3830, 1785, 2550, 1787, 3574, 1789, 3062,
+  1790, 2038, 1791, 4086, 1793, 2062, 1795, 3086,
+  1797, 2574, 1799, 3598, 1801, 2318, 1803, 3342,
+  1805, 2830, 1807, 3854, 1809, 2190, 1811, 3214,
+  1813, 2702, 1815, 3726, 1817, 2446, 1819, 3470,
+  1821, 2958, 1822, 1934, 1823, 3982, 1825, 2126,
+  1827, 3150, 1829, 2638, 1831, 3662, 1833, 2382,
+  1835, 3406, 1837, 2894, 1838, 1870, 1839, 3918,
+  1841, 2254, 1843, 3278, 1845, 2766, 1847, 3790,
+  1849, 2510, 1851, 3534, 1853, 3022, 1854, 1998,
+  1855, 4046, 1857, 2094, 1859, 3118, 1861, 2606,
+  1863, 3630, 1865, 2350, 1867, 3374, 1869, 2862,
+  1871, 3886, 1873, 2222, 1875, 3246, 1877, 2734,
+  1879, 3758, 1881, 2478, 1883, 3502, 1885, 2990,
+  1886, 1966, 1887, 4014, 1889, 2158, 1891, 3182,
+  1893, 2670, 1895, 3694, 1897, 2414, 1899, 3438,
+  1901, 2926, 1903, 3950, 1905, 2286, 1907, 3310,
+  1909, 2798, 1911, 3822, 1913, 2542, 1915, 3566,
+  1917, 3054, 1918, 2030, 1919, 4078, 1921, 2078,
+  1923, 3102, 1925, 2590, 1927, 3614, 1929, 2334,
+  1931, 3358, 1933, 2846, 1935, 3870, 1937, 2206,
+  1939, 3230, 1941, 2718, 1943, 3742, 1945, 2462,
+  1947, 3486, 1949, 2974, 1951, 3998, 1953, 2142,
+  1955, 3166, 1957, 2654, 1959, 3678, 1961, 2398,
+  1963, 3422, 1965, 2910, 1967, 3934, 1969, 2270,
+  1971, 3294, 1973, 2782, 1975, 3806, 1977, 2526,
+  1979, 3550, 1981, 3038, 1982, 2014, 1983, 4062,
+  1985, 2110, 1987, 3134, 1989, 2622, 1991, 3646,
+  1993, 2366, 1995, 3390, 1997, 2878, 1999, 3902,
+  2001, 2238, 2003, 3262, 2005, 2750, 2007, 3774,
+  2009, 2494, 2011, 3518, 2013, 3006, 2015, 4030,
+  2017, 2174, 2019, 3198, 2021, 2686, 2023, 3710,
+  2025, 2430, 2027, 3454, 2029, 2942, 2031, 3966,
+  2033, 2302, 2035, 3326, 2037, 2814, 2039, 3838,
+  2041, 2558, 2043, 3582, 2045, 3070, 2047, 4094,
+  2051, 3073, 2053, 2561, 2055, 3585, 2057, 2305,
+  2059, 3329, 2061, 2817, 2063, 3841, 2065, 2177,
+  2067, 3201, 2069, 2689, 2071, 3713, 2073, 2433,
+  2075, 3457, 2077, 2945, 2079, 3969, 2081, 2113,
+  2083, 3137, 2085, 2625, 2087, 3649, 2089, 2369,
+  2091, 3393, 2093, 2881, 2095, 3905, 2097, 2241,
+  2099, 3265, 2101, 2753, 2103, 3777, 2105, 2497,
+  2107, 3521, 2109, 3009, 2111, 4033, 2115, 3105,
+  2117, 2593, 2119, 3617, 2121, 2337, 2123, 3361,
+  2125, 2849, 2127, 3873, 2129, 2209, 2131, 3233,
+  2133, 2721, 2135, 3745, 2137, 2465, 2139, 3489,
+  2141, 2977, 2143, 4001, 2147, 3169, 2149, 2657,
+  2151, 3681, 2153, 2401, 2155, 3425, 2157, 2913,
+  2159, 3937, 2161, 2273, 2163, 3297, 2165, 2785,
+  2167, 3809, 2169, 2529, 2171, 3553, 2173, 3041,
+  2175, 4065, 2179, 3089, 2181, 2577, 2183, 3601,
+  2185, 2321, 2187, 3345, 2189, 2833, 2191, 3857,
+  2195, 3217, 2197, 2705, 2199, 3729, 2201, 2449,
+  2203, 3473, 2205, 2961, 2207, 3985, 2211, 3153,
+  2213, 2641, 2215, 3665, 2217, 2385, 2219, 3409,
+  2221, 2897, 2223, 3921, 2225, 2257, 2227, 3281,
+  2229, 2769, 2231, 3793, 2233, 2513, 2235, 3537,
+  2237, 3025, 2239, 4049, 2243, 3121, 2245, 2609,
+  2247, 3633, 2249, 2353, 2251, 3377, 2253, 2865,
+  2255, 3889, 2259, 3249, 2261, 2737, 2263, 3761,
+  2265, 2481, 2267, 3505, 2269, 2993, 2271, 4017,
+  2275, 3185, 2277, 2673, 2279, 3697, 2281, 2417,
+  2283, 3441, 2285, 2929, 2287, 3953, 2291, 3313,
+  2293, 2801, 2295, 3825, 2297, 2545, 2299, 3569,
+  2301, 3057, 2303, 4081, 2307, 3081, 2309, 2569,
+  2311, 3593, 2315, 3337, 2317, 2825, 2319, 3849,
+  2323, 3209, 2325, 2697, 2327, 3721, 2329, 2441,
+  2331, 3465, 2333, 2953, 2335, 3977, 2339, 3145,
+  2341, 2633, 2343, 3657, 2345, 2377, 2347, 3401,
+  2349, 2889, 2351, 3913, 2355, 3273, 2357, 2761,
+  2359, 3785, 2361, 2505, 2363, 3529, 2365, 3017,
+  2367, 4041, 2371, 3113, 2373, 2601, 2375, 3625,
+  2379, 3369, 2381, 2857, 2383, 3881, 2387, 3241,
+  2389, 2729, 2391, 3753, 2393, 2473, 2395, 3497,
+  2397, 2985, 2399, 4009, 2403, 3177, 2405, 2665,
+  2407, 3689, 2411, 3433, 2413, 2921, 2415, 3945,
+  2419, 3305, 2421, 2793, 2423, 3817, 2425, 2537,
+  2427, 3561, 2429, 3049, 2431, 4073, 2435, 3097,
+  2437, 2585, 2439, 3609, 2443, 3353, 2445, 2841,
+  2447, 3865, 2451, 3225, 2453, 2713, 2455, 3737,
+  2459, 3481, 2461, 2969, 2463, 3993, 2467, 3161,
+  2469, 2649, 2471, 3673, 2475, 3417, 2477, 2905,
+  2479, 3929, 2483, 3289, 2485, 2777, 2487, 3801,
+  2489, 2521, 2491, 3545, 2493, 3033, 2495, 4057,
+  2499, 3129, 2501, 2617, 2503, 3641, 2507, 3385,
+  2509, 2873, 2511, 3897, 2515, 3257, 2517, 2745,
+  2519, 3769, 2523, 3513, 2525, 3001, 2527, 4025,
+  2531, 3193, 2533, 2681, 2535, 3705, 2539, 3449,
+  2541, 2937, 2543, 3961, 2547, 3321, 2549, 2809,
+  2551, 3833, 2555, 3577, 2557, 3065, 2559, 4089,
+  2563, 3077, 2567, 3589, 2571, 3333, 2573, 2821,
+  2575, 3845, 2579, 3205, 2581, 2693, 2583, 3717,
+  2587, 3461, 2589, 2949, 2591, 3973, 2595, 3141,
+  2597, 2629, 2599, 3653, 2603, 3397, 2605, 2885,
+  2607, 3909, 2611, 3269, 2613, 2757, 2615, 3781,
+  2619, 3525, 2621, 3013, 2623, 4037, 2627, 3109,
+  2631, 3621, 2635, 3365, 2637, 2853, 2639, 3877,
+  2643, 3237, 2645, 2725, 2647, 3749, 2651, 3493,
+  2653, 2981, 2655, 4005, 2659, 3173, 2663, 3685,
+  2667, 3429, 2669, 2917, 2671, 3941, 2675, 3301,
+  2677, 2789, 2679, 3813, 2683, 3557, 2685, 3045,
+  2687, 4069, 2691, 3093, 2695, 3605, 2699, 3349,
+  2701, 2837, 2703, 3861, 2707, 3221, 2711, 3733,
+  2715, 3477, 2717, 2965, 2719, 3989, 2723, 3157,
+  2727, 3669, 2731, 3413, 2733, 2901, 2735, 3925,
+  2739, 3285, 2741, 2773, 2743, 3797, 2747, 3541,
+  2749, 3029, 2751, 4053, 2755, 3125, 2759, 3637,
+  2763, 3381, 2765, 2869, 2767, 3893, 2771, 3253,
+  2775, 3765, 2779, 3509, 2781, 2997, 2783, 4021,
+  2787, 3189, 2791, 3701, 2795, 3445, 2797, 2933,
+  2799, 3957, 2803, 3317, 2807, 3829, 2811, 3573,
+  2813, 3061, 2815, 4085, 2819, 3085, 2823, 3597,
+  2827, 3341, 2831, 3853, 2835, 3213, 2839, 3725,
+  2843, 3469, 2845, 2957, 2847, 3981, 2851, 3149,
+  2855, 3661, 2859, 3405, 2861, 2893, 2863, 3917,
+  2867, 3277, 2871, 3789, 2875, 3533, 2877, 3021,
+  2879, 4045, 2883, 3117, 2887, 3629, 2891, 3373,
+  2895, 3885, 2899, 3245, 2903, 3757, 2907, 3501,
+  2909, 2989, 2911, 4013, 2915, 3181, 2919, 3693,
+  2923, 3437, 2927, 3949, 2931, 3309, 2935, 3821,
+  2939, 3565, 2941, 3053, 2943, 4077, 2947, 3101,
+  2951, 3613, 2955, 3357, 2959, 3869, 2963, 3229,
+  2967, 3741, 2971, 3485, 2975, 3997, 2979, 3165,
+  2983, 3677, 2987, 3421, 2991, 3933, 2995, 3293,
+  2999, 3805, 3003, 3549, 3005, 3037, 3007, 4061,
+  3011, 3133, 3015, 3645, 3019, 3389, 3023, 3901,
+  3027, 3261, 3031, 3773, 3035, 3517, 3039, 4029,
+  3043, 3197, 3047, 3709, 3051, 3453, 3055, 3965,
+  3059, 3325, 3063, 3837, 3067, 3581, 3071, 4093,
+  3079, 3587, 3083, 3331, 3087, 3843, 3091, 3203,
+  3095, 3715, 3099, 3459, 3103, 3971, 3107, 3139,
+  3111, 3651, 3115, 3395, 3119, 3907, 3123, 3267,
+  3127, 3779, 3131, 3523, 3135, 4035, 3143, 3619,
+  3147, 3363, 3151, 3875, 3155, 3235, 3159, 3747,
+  3163, 3491, 3167, 4003, 3175, 3683, 3179, 3427,
+  3183, 3939, 3187, 3299, 3191, 3811, 3195, 3555,
+  3199, 4067, 3207, 3603, 3211, 3347, 3215, 3859,
+  3223, 3731, 3227, 3475, 3231, 3987, 3239, 3667,
+  3243, 3411, 3247, 3923, 3251, 3283, 3255, 3795,
+  3259, 3539, 3263, 4051, 3271, 3635, 3275, 3379,
+  3279, 3891, 3287, 3763, 3291, 3507, 3295, 4019,
+  3303, 3699, 3307, 3443, 3311, 3955, 3319, 3827,
+  3323, 3571, 3327, 4083, 3335, 3595, 3343, 3851,
+  3351, 3723, 3355, 3467, 3359, 3979, 3367, 3659,
+  3371, 3403, 3375, 3915, 3383, 3787, 3387, 3531,
+  3391, 4043, 3399, 3627, 3407, 3883, 3415, 3755,
+  3419, 3499, 3423, 4011, 3431, 3691, 3439, 3947,
+  3447, 3819, 3451, 3563, 3455, 4075, 3463, 3611,
+  3471, 3867, 3479, 3739, 3487, 3995, 3495, 3675,
+  3503, 3931, 3511, 3803, 3515, 3547, 3519, 4059,
+  3527, 3643, 3535, 3899, 3543, 3771, 3551, 4027,
+  3559, 3707, 3567, 3963, 3575, 3835, 3583, 4091,
+  3599, 3847, 3607, 3719, 3615, 3975, 3623, 3655,
+  3631, 3911, 3639, 3783, 3647, 4039, 3663, 3879,
+  3671, 3751, 3679, 4007, 3695, 3943, 3703, 3815,
+  3711, 4071, 3727, 3863, 3743, 3991, 3759, 3927,
+  3767, 3799, 3775, 4055, 3791, 3895, 3807, 4023,
+  3823, 3959, 3839, 4087, 3871, 3983, 3887, 3919,
+  3903, 4047, 3935, 4015, 3967, 4079, 4031, 4063
+};
+#endif
+
+/**
+* \par
+* Twiddle factors of the N point real FFT (arm_rfft_fast_f32), N/4 values:
+* \par
+* <pre>for(k = 0; k< N/4; k++)
+* {
+*	twiddleCoef_rfft_N[2*k]= cos(k * 2*PI/(float)N);
+*	twiddleCoef_rfft_N[2*k+1]= sin(k * 2*PI/(float)N);
+* } </pre>
+*/
+
+const float32_t twiddleCoef_rfft_32[16] = {
+  1.0000000000f, 0.0000000000f, 0.9807852804f, 0.1950903220f,
+  0.9238795325f, 0.3826834324f, 0.8314696123f, 0.5555702330f,
+  0.7071067812f, 0.7071067812f, 0.5555702330f, 0.8314696123f,
+  0.3826834324f, 0.9238795325f, 0.1950903220f, 0.9807852804f
+};
+
+#if (ARM_MATH_MAX_FFT_LEN >= 32)
+const float32_t twiddleCoef_rfft_64[32] = {
+  1.0000000000f, 0.0000000000f, 0.9951847267f, 0.0980171403f,
+  0.9807852804f, 0.1950903220f, 0.9569403357f, 0.2902846773f,
+  0.9238795325f, 0.3826834324f, 0.8819212643f, 0.4713967368f,
+  0.8314696123f, 0.5555702330f, 0.7730104534f, 0.6343932842f,
+  0.7071067812f, 0.7071067812f, 0.6343932842f, 0.7730104534f,
+  0.5555702330f, 0.8314696123f, 0.4713967368f, 0.8819212643f,
+  0.3826834324f, 0.9238795325f, 0.2902846773f, 0.9569403357f,
+  0.1950903220f, 0.9807852804f, 0.0980171403f, 0.9951847267f
+};
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
+const float32_t twiddleCoef_rfft_128[64] = {
+  1.0000000000f, 0.0000000000f, 0.9987954562f, 0.0490676743f,
+  0.9951847267f, 0.0980171403f, 0.9891765100f, 0.1467304745f,
+  0.9807852804f, 0.1950903220f, 0.9700312532f, 0.2429801799f,
+  0.9569403357f, 0.2902846773f, 0.9415440652f, 0.3368898534f,
+  0.9238795325f, 0.3826834324f, 0.9039892931f, 0.4275550934f,
+  0.8819212643f, 0.4713967368f, 0.8577286100f, 0.5141027442f,
+  0.8314696123f, 0.5555702330f, 0.8032075315f, 0.5956993045f,
+  0.7730104534f, 0.6343932842f, 0.7409511254f, 0.6715589548f,
+  0.7071067812f, 0.7071067812f, 0.6715589548f, 0.7409511254f,
+  0.6343932842f, 0.7730104534f, 0.5956993045f, 0.8032075315f,
+  0.5555702330f, 0.8314696123f, 0.5141027442f, 0.8577286100f,
+  0.4713967368f, 0.8819212643f, 0.4275550934f, 0.9039892931f,
+  0.3826834324f, 0.9238795325f, 0.3368898534f, 0.9415440652f,
+  0.2902846773f, 0.9569403357f, 0.2429801799f, 0.9700312532f,
+  0.1950903220f, 0.9807852804f, 0.1467304745f, 0.9891765100f,
+  0.0980171403f, 0.9951847267f, 0.0490676743f, 0.9987954562f
+};
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 128)
+const float32_t twiddleCoef_rfft_256[128] = {
+  1.0000000000f, 0.0000000000f, 0.9996988187f, 0.0245412285f,
+  0.9987954562f, 0.0490676743f, 0.9972904567f, 0.0735645636f,
+  0.9951847267f, 0.0980171403f, 0.9924795346f, 0.1224106752f,
+  0.9891765100f, 0.1467304745f, 0.9852776424f, 0.1709618888f,
+  0.9807852804f, 0.1950903220f, 0.9757021300f, 0.2191012402f,
+  0.9700312532f, 0.2429801799f, 0.9637760658f, 0.2667127575f,
+  0.9569403357f, 0.2902846773f, 0.9495281806f, 0.3136817404f,
+  0.9415440652f, 0.3368898534f, 0.9329927988f, 0.3598950365f,
+  0.9238795325f, 0.3826834324f, 0.9142097557f, 0.4052413140f,
+  0.9039892931f, 0.4275550934f, 0.8932243012f, 0.4496113297f,
+  0.8819212643f, 0.4713967368f, 0.8700869911f, 0.4928981922f,
+  0.8577286100f, 0.5141027442f, 0.8448535652f, 0.5349976199f,
+  0.8314696123f, 0.5555702330f, 0.8175848132f, 0.5758081914f,
+  0.8032075315f, 0.5956993045f, 0.7883464276f, 0.6152315906f,
+  0.7730104534f, 0.6343932842f, 0.7572088465f, 0.6531728430f,
+  0.7409511254f, 0.6715589548f, 0.7242470830f, 0.6895405447f,
+  0.7071067812f, 0.7071067812f, 0.6895405447f, 0.7242470830f,
+  0.6715589548f, 0.7409511254f, 0.6531728430f, 0.7572088465f,
+  0.6343932842f, 0.7730104534f, 0.6152315906f, 0.7883464276f,
+  0.5956993045f, 0.8032075315f, 0.5758081914f, 0.8175848132f,
+  0.5555702330f, 0.8314696123f, 0.5349976199f, 0.8448535652f,
+  0.5141027442f, 0.8577286100f, 0.4928981922f, 0.8700869911f,
+  0.4713967368f, 0.8819212643f, 0.4496113297f, 0.8932243012f,
+  0.4275550934f, 0.9039892931f, 0.4052413140f, 0.9142097557f,
+  0.3826834324f, 0.9238795325f, 0.3598950365f, 0.9329927988f,
+  0.3368898534f, 0.9415440652f, 0.3136817404f, 0.9495281806f,
+  0.2902846773f, 0.9569403357f, 0.2667127575f, 0.9637760658f,
+  0.2429801799f, 0.9700312532f, 0.2191012402f, 0.9757021300f,
+  0.1950903220f, 0.9807852804f, 0.1709618888f, 0.9852776424f,
+  0.1467304745f, 0.9891765100f, 0.1224106752f, 0.9924795346f,
+  0.0980171403f, 0.9951847267f, 0.0735645636f, 0.9972904567f,
+  0.0490676743f, 0.9987954562f, 0.0245412285f, 0.9996988187f
+};
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
+const float32_t twiddleCoef_rfft_512[256] = {
+  1.0000000000f, 0.0000000000f, 0.9999247018f, 0.0122715383f,
+  0.9996988187f, 0.0245412285f, 0.9993223846f, 0.0368072229f,
+  0.9987954562f, 0.0490676743f, 0.9981181129f, 0.0613207363f,
+  0.9972904567f, 0.0735645636f, 0.9963126122f, 0.0857973123f,
+  0.9951847267f, 0.0980171403f, 0.9939069700f, 0.1102222073f,
+  0.9924795346f, 0.1224106752f, 0.9909026354f, 0.1345807085f,
+  0.9891765100f, 0.1467304745f, 0.9873014182f, 0.1588581433f,
+  0.9852776424f, 0.1709618888f, 0.9831054874f, 0.1830398880f,
+  0.9807852804f, 0.1950903220f, 0.9783173707f, 0.2071113762f,
+  0.9757021300f, 0.2191012402f, 0.9729399522f, 0.2310581083f,
+  0.9700312532f, 0.2429801799f, 0.9669764710f, 0.2548656596f,
+  0.9637760658f, 0.2667127575f, 0.9604305194f, 0.2785196894f,
+  0.9569403357f, 0.2902846773f, 0.9533060404f, 0.3020059493f,
+  0.9495281806f, 0.3136817404f, 0.9456073254f, 0.3253102922f,
+  0.9415440652f, 0.3368898534f, 0.9373390119f, 0.3484186802f,
+  0.9329927988f, 0.3598950365f, 0.9285060805f, 0.3713171940f,
+  0.9238795325f, 0.3826834324f, 0.9191138517f, 0.3939920401f,
+  0.9142097557f, 0.4052413140f, 0.9091679831f, 0.4164295601f,
+  0.9039892931f, 0.4275550934f, 0.8986744657f, 0.4386162385f,
+  0.8932243012f, 0.4496113297f, 0.8876396204f, 0.4605387110f,
+  0.8819212643f, 0.4713967368f, 0.8760700942f, 0.4821837721f,
+  0.8700869911f, 0.4928981922f, 0.8639728561f, 0.5035383837f,
+  0.8577286100f, 0.5141027442f, 0.8513551931f, 0.5245896827f,
+  0.8448535652f, 0.5349976199f, 0.8382247056f, 0.5453249884f,
+  0.8314696123f, 0.5555702330f, 0.8245893028f, 0.5657318108f,
+  0.8175848132f, 0.5758081914f, 0.8104571983f, 0.5857978575f,
+  0.8032075315f, 0.5956993045f, 0.7958369046f, 0.6055110414f,
+  0.7883464276f, 0.6152315906f, 0.7807372286f, 0.6248594881f,
+  0.7730104534f, 0.6343932842f, 0.7651672656f, 0.6438315429f,
+  0.7572088465f, 0.6531728430f, 0.7491363945f, 0.6624157776f,
+  0.7409511254f, 0.6715589548f, 0.7326542717f, 0.6806009978f,
+  0.7242470830f, 0.6895405447f, 0.7157308253f, 0.6983762494f,
+  0.7071067812f, 0.7071067812f, 0.6983762494f, 0.7157308253f,
+  0.6895405447f, 0.7242470830f, 0.6806009978f, 0.7326542717f,
+  0.6715589548f, 0.7409511254f, 0.6624157776f, 0.7491363945f,
+  0.6531728430f, 0.7572088465f, 0.6438315429f, 0.7651672656f,
+  0.6343932842f, 0.7730104534f, 0.6248594881f, 0.7807372286f,
+  0.6152315906f, 0.7883464276f, 0.6055110414f, 0.7958369046f,
+  0.5956993045f, 0.8032075315f, 0.5857978575f, 0.8104571983f,
+  0.5758081914f, 0.8175848132f, 0.5657318108f, 0.8245893028f,
+  0.5555702330f, 0.8314696123f, 0.5453249884f, 0.8382247056f,
+  0.5349976199f, 0.8448535652f, 0.5245896827f, 0.8513551931f,
+  0.5141027442f, 0.8577286100f, 0.5035383837f, 0.8639728561f,
+  0.4928981922f, 0.8700869911f, 0.4821837721f, 0.8760700942f,
+  0.4713967368f, 0.8819212643f, 0.4605387110f, 0.8876396204f,
+  0.4496113297f, 0.8932243012f, 0.4386162385f, 0.8986744657f,
+  0.4275550934f, 0.9039892931f, 0.4164295601f, 0.9091679831f,
+  0.4052413140f, 0.9142097557f, 0.3939920401f, 0.9191138517f,
+  0.3826834324f, 0.9238795325f, 0.3713171940f, 0.9285060805f,
+  0.3598950365f, 0.9329927988f, 0.3484186802f, 0.9373390119f,
+  0.3368898534f, 0.9415440652f, 0.3253102922f, 0.9456073254f,
+  0.3136817404f, 0.9495281806f, 0.3020059493f, 0.9533060404f,
+  0.2902846773f, 0.9569403357f, 0.2785196894f, 0.9604305194f,
+  0.2667127575f, 0.9637760658f, 0.2548656596f, 0.9669764710f,
+  0.2429801799f, 0.9700312532f, 0.2310581083f, 0.9729399522f,
+  0.2191012402f, 0.9757021300f, 0.2071113762f, 0.9783173707f,
+  0.1950903220f, 0.9807852804f, 0.1830398880f, 0.9831054874f,
+  0.1709618888f, 0.9852776424f, 0.1588581433f, 0.9873014182f,
+  0.1467304745f, 0.9891765100f, 0.1345807085f, 0.9909026354f,
+  0.1224106752f, 0.9924795346f, 0.1102222073f, 0.9939069700f,
+  0.0980171403f, 0.9951847267f, 0.0857973123f, 0.9963126122f,
+  0.0735645636f, 0.9972904567f, 0.0613207363f, 0.9981181129f,
+  0.0490676743f, 0.9987954562f, 0.0368072229f, 0.9993223846f,
+  0.0245412285f, 0.9996988187f, 0.0122715383f, 0.9999247018f
+};
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 512)
+const float32_t twiddleCoef_rfft_1024[512] = {
+  1.0000000000f, 0.0000000000f, 0.9999811753f, 0.0061358846f,
+  0.9999247018f, 0.0122715383f, 0.9998305818f, 0.0184067299f,
+  0.9996988187f, 0.0245412285f, 0.9995294175f, 0.0306748032f,
+  0.9993223846f, 0.0368072229f, 0.9990777278f, 0.0429382569f,
+  0.9987954562f, 0.0490676743f, 0.9984755806f, 0.0551952443f,
+  0.9981181129f, 0.0613207363f, 0.9977230666f, 0.0674439196f,
+  0.9972904567f, 0.0735645636f, 0.9968202993f, 0.0796824380f,
+  0.9963126122f, 0.0857973123f, 0.9957674145f, 0.0919089565f,
+  0.9951847267f, 0.0980171403f, 0.9945645707f, 0.1041216339f,
+  0.9939069700f, 0.1102222073f, 0.9932119492f, 0.1163186309f,
+  0.9924795346f, 0.1224106752f, 0.9917097537f, 0.1284981108f,
+  0.9909026354f, 0.1345807085f, 0.9900582103f, 0.1406582393f,
+  0.9891765100f, 0.1467304745f, 0.9882575677f, 0.1527971853f,
+  0.9873014182f, 0.1588581433f, 0.9863080972f, 0.1649131205f,
+  0.9852776424f, 0.1709618888f, 0.9842100924f, 0.1770042204f,
+  0.9831054874f, 0.1830398880f, 0.9819638691f, 0.1890686641f,
+  0.9807852804f, 0.1950903220f, 0.9795697657f, 0.2011046348f,
+  0.9783173707f, 0.2071113762f, 0.9770281427f, 0.2131103199f,
+  0.9757021300f, 0.2191012402f, 0.9743393828f, 0.2250839114f,
+  0.9729399522f, 0.2310581083f, 0.9715038910f, 0.2370236060f,
+  0.9700312532f, 0.2429801799f, 0.9685220943f, 0.2489276057f,
+  0.9669764710f, 0.2548656596f, 0.9653944417f, 0.2607941179f,
+  0.9637760658f, 0.2667127575f, 0.9621214043f, 0.2726213554f,
+  0.9604305194f, 0.2785196894f, 0.9587034749f, 0.2844075372f,
+  0.9569403357f, 0.2902846773f, 0.9551411683f, 0.2961508882f,
+  0.9533060404f, 0.3020059493f, 0.9514350210f, 0.3078496400f,
+  0.9495281806f, 0.3136817404f, 0.9475855910f, 0.3195020308f,
+  0.9456073254f, 0.3253102922f, 0.9435934582f, 0.3311063058f,
+  0.9415440652f, 0.3368898534f, 0.9394592236f, 0.3426607173f,
+  0.9373390119f, 0.3484186802f, 0.9351835099f, 0.3541635254f,
+  0.9329927988f, 0.3598950365f, 0.9307669611f, 0.3656129978f,
+  0.9285060805f, 0.3713171940f, 0.9262102421f, 0.3770074102f,
+  0.9238795325f, 0.3826834324f, 0.9215140393f, 0.3883450467f,
+  0.9191138517f, 0.3939920401f, 0.9166790599f, 0.3996241998f,
+  0.9142097557f, 0.4052413140f, 0.9117060320f, 0.4108431711f,
+  0.9091679831f, 0.4164295601f, 0.9065957045f, 0.4220002708f,
+  0.9039892931f, 0.4275550934f, 0.9013488470f, 0.4330938189f,
+  0.8986744657f, 0.4386162385f, 0.8959662498f, 0.4441221446f,
+  0.8932243012f, 0.4496113297f, 0.8904487232f, 0.4550835871f,
+  0.8876396204f, 0.4605387110f, 0.8847970984f, 0.4659764958f,
+  0.8819212643f, 0.4713967368f, 0.8790122264f, 0.4767992301f,
+  0.8760700942f, 0.4821837721f, 0.8730949784f, 0.4875501601f,
+  0.8700869911f, 0.4928981922f, 0.8670462455f, 0.4982276670f,
+  0.8639728561f, 0.5035383837f, 0.8608669386f, 0.5088301425f,
+  0.8577286100f, 0.5141027442f, 0.8545579884f, 0.5193559902f,
+  0.8513551931f, 0.5245896827f, 0.8481203448f, 0.5298036247f,
+  0.8448535652f, 0.5349976199f, 0.8415549774f, 0.5401714727f,
+  0.8382247056f, 0.5453249884f, 0.8348628750f, 0.5504579729f,
+  0.8314696123f, 0.5555702330f, 0.8280450453f, 0.5606615762f,
+  0.8245893028f, 0.5657318108f, 0.8211025150f, 0.5707807459f,
+  0.8175848132f, 0.5758081914f, 0.8140363297f, 0.5808139581f,
+  0.8104571983f, 0.5857978575f, 0.8068475535f, 0.5907597019f,
+  0.8032075315f, 0.5956993045f, 0.7995372691f, 0.6006164794f,
+  0.7958369046f, 0.6055110414f, 0.7921065773f, 0.6103828063f,
+  0.7883464276f, 0.6152315906f, 0.7845565972f, 0.6200572118f,
+  0.7807372286f, 0.6248594881f, 0.7768884657f, 0.6296382389f,
+  0.7730104534f, 0.6343932842f, 0.7691033376f, 0.6391244449f,
+  0.7651672656f, 0.6438315429f, 0.7612023855f, 0.6485144010f,
+  0.7572088465f, 0.6531728430f, 0.7531867990f, 0.6578066933f,
+  0.7491363945f, 0.6624157776f, 0.7450577854f, 0.6669999223f,
+  0.7409511254f, 0.6715589548f, 0.7368165689f, 0.6760927036f,
+  0.7326542717f, 0.6806009978f, 0.7284643904f, 0.6850836678f,
+  0.7242470830f, 0.6895405447f, 0.7200025080f, 0.6939714609f,
+  0.7157308253f, 0.6983762494f, 0.7114321957f, 0.7027547445f,
+  0.7071067812f, 0.7071067812f, 0.7027547445f, 0.7114321957f,
+  0.6983762494f, 0.7157308253f, 0.6939714609f, 0.7200025080f,
+  0.6895405447f, 0.7242470830f, 0.6850836678f, 0.7284643904f,
+  0.6806009978f, 0.7326542717f, 0.6760927036f, 0.7368165689f,
+  0.6715589548f, 0.7409511254f, 0.6669999223f, 0.7450577854f,
+  0.6624157776f, 0.7491363945f, 0.6578066933f, 0.7531867990f,
+  0.6531728430f, 0.7572088465f, 0.6485144010f, 0.7612023855f,
+  0.6438315429f, 0.7651672656f, 0.6391244449f, 0.7691033376f,
+  0.6343932842f, 0.7730104534f, 0.6296382389f, 0.7768884657f,
+  0.6248594881f, 0.7807372286f, 0.6200572118f, 0.7845565972f,
+  0.6152315906f, 0.7883464276f, 0.6103828063f, 0.7921065773f,
+  0.6055110414f, 0.7958369046f, 0.6006164794f, 0.7995372691f,
+  0.5956993045f, 0.8032075315f, 0.5907597019f, 0.8068475535f,
+  0.5857978575f, 0.8104571983f, 0.5808139581f, 0.8140363297f,
+  0.5758081914f, 0.8175848132f, 0.5707807459f, 0.8211025150f,
+  0.5657318108f, 0.8245893028f, 0.5606615762f, 0.8280450453f,
+  0.5555702330f, 0.8314696123f, 0.5504579729f, 0.8348628750f,
+  0.5453249884f, 0.8382247056f, 0.5401714727f, 0.8415549774f,
+  0.5349976199f, 0.8448535652f, 0.5298036247f, 0.8481203448f,
+  0.5245896827f, 0.8513551931f, 0.5193559902f, 0.8545579884f,
+  0.5141027442f, 0.8577286100f, 0.5088301425f, 0.8608669386f,
+  0.5035383837f, 0.8639728561f, 0.4982276670f, 0.8670462455f,
+  0.4928981922f, 0.8700869911f, 0.4875501601f, 0.8730949784f,
+  0.4821837721f, 0.8760700942f, 0.4767992301f, 0.8790122264f,
+  0.4713967368f, 0.8819212643f, 0.4659764958f, 0.8847970984f,
+  0.4605387110f, 0.8876396204f, 0.4550835871f, 0.8904487232f,
+  0.4496113297f, 0.8932243012f, 0.4441221446f, 0.8959662498f,
+  0.4386162385f, 0.8986744657f, 0.4330938189f, 0.9013488470f,
+  0.4275550934f, 0.9039892931f, 0.4220002708f, 0.9065957045f,
+  0.4164295601f, 0.9091679831f, 0.4108431711f, 0.9117060320f,
+  0.4052413140f, 0.9142097557f, 0.3996241998f, 0.9166790599f,
+  0.3939920401f, 0.9191138517f, 0.3883450467f, 0.9215140393f,
+  0.3826834324f, 0.9238795325f, 0.3770074102f, 0.9262102421f,
+  0.3713171940f, 0.9285060805f, 0.3656129978f, 0.9307669611f,
+  0.3598950365f, 0.9329927988f, 0.3541635254f, 0.9351835099f,
+  0.3484186802f, 0.9373390119f, 0.3426607173f, 0.9394592236f,
+  0.3368898534f, 0.9415440652f, 0.3311063058f, 0.9435934582f,
+  0.3253102922f, 0.9456073254f, 0.3195020308f, 0.9475855910f,
+  0.3136817404f, 0.9495281806f, 0.3078496400f, 0.9514350210f,
+  0.3020059493f, 0.9533060404f, 0.2961508882f, 0.9551411683f,
+  0.2902846773f, 0.9569403357f, 0.2844075372f, 0.9587034749f,
+  0.2785196894f, 0.9604305194f, 0.2726213554f, 0.9621214043f,
+  0.2667127575f, 0.9637760658f, 0.2607941179f, 0.9653944417f,
+  0.2548656596f, 0.9669764710f, 0.2489276057f, 0.9685220943f,
+  0.2429801799f, 0.9700312532f, 0.2370236060f, 0.9715038910f,
+  0.2310581083f, 0.9729399522f, 0.2250839114f, 0.9743393828f,
+  0.2191012402f, 0.9757021300f, 0.2131103199f, 0.9770281427f,
+  0.2071113762f, 0.9783173707f, 0.2011046348f, 0.9795697657f,
+  0.1950903220f, 0.9807852804f, 0.1890686641f, 0.9819638691f,
+  0.1830398880f, 0.9831054874f, 0.1770042204f, 0.9842100924f,
+  0.1709618888f, 0.9852776424f, 0.1649131205f, 0.9863080972f,
+  0.1588581433f, 0.9873014182f, 0.1527971853f, 0.9882575677f,
+  0.1467304745f, 0.9891765100f, 0.1406582393f, 0.9900582103f,
+  0.1345807085f, 0.9909026354f, 0.1284981108f, 0.9917097537f,
+  0.1224106752f, 0.9924795346f, 0.1163186309f, 0.9932119492f,
+  0.1102222073f, 0.9939069700f, 0.1041216339f, 0.9945645707f,
+  0.0980171403f, 0.9951847267f, 0.0919089565f, 0.9957674145f,
+  0.0857973123f, 0.9963126122f, 0.0796824380f, 0.9968202993f,
+  0.0735645636f, 0.9972904567f, 0.0674439196f, 0.9977230666f,
+  0.0613207363f, 0.9981181129f, 0.0551952443f, 0.9984755806f,
+  0.0490676743f, 0.9987954562f, 0.0429382569f, 0.9990777278f,
+  0.0368072229f, 0.9993223846f, 0.0306748032f, 0.9995294175f,
+  0.0245412285f, 0.9996988187f, 0.0184067299f, 0.9998305818f,
+  0.0122715383f, 0.9999247018f, 0.0061358846f, 0.9999811753f
+};
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+const float32_t twiddleCoef_rfft_2048[1024] = {
+  1.0000000000f, 0.0000000000f, 0.9999952938f, 0.0030679568f,
+  0.9999811753f, 0.0061358846f, 0.9999576446f, 0.0092037548f,
+  0.9999247018f, 0.0122715383f, 0.9998823475f, 0.0153392063f,
+  0.9998305818f, 0.0184067299f, 0.9997694054f, 0.0214740803f,
+  0.9996988187f, 0.0245412285f, 0.9996188225f, 0.0276081458f,
+  0.9995294175f, 0.0306748032f, 0.9994306046f, 0.0337411719f,
+  0.9993223846f, 0.0368072229f, 0.9992047586f, 0.0398729276f,
+  0.9990777278f, 0.0429382569f, 0.9989412932f, 0.0460031821f,
+  0.9987954562f, 0.0490676743f, 0.9986402182f, 0.0521317047f,
+  0.9984755806f, 0.0551952443f, 0.9983015449f, 0.0582582645f,
+  0.9981181129f, 0.0613207363f, 0.9979252862f, 0.0643826309f,
+  0.9977230666f, 0.0674439196f, 0.9975114561f, 0.0705045734f,
+  0.9972904567f, 0.0735645636f, 0.9970600703f, 0.0766238614f,
+  0.9968202993f, 0.0796824380f, 0.9965711458f, 0.0827402645f,
+  0.9963126122f, 0.0857973123f, 0.9960447009f, 0.0888535526f,
+  0.9957674145f, 0.0919089565f, 0.9954807555f, 0.0949634953f,
+  0.9951847267f, 0.0980171403f, 0.9948793308f, 0.1010698628f,
+  0.9945645707f, 0.1041216339f, 0.9942404495f, 0.1071724250f,
+  0.9939069700f, 0.1102222073f, 0.9935641355f, 0.1132709522f,
+  0.9932119492f, 0.1163186309f, 0.9928504145f, 0.1193652148f,
+  0.9924795346f, 0.1224106752f, 0.9920993131f, 0.1254549834f,
+  0.9917097537f, 0.1284981108f, 0.9913108598f, 0.1315400287f,
+  0.9909026354f, 0.1345807085f, 0.9904850843f, 0.1376201216f,
+  0.9900582103f, 0.1406582393f, 0.9896220175f, 0.1436950332f,
+  0.9891765100f, 0.1467304745f, 0.9887216920f, 0.1497645347f,
+  0.9882575677f, 0.1527971853f, 0.9877841416f, 0.1558283977f,
+  0.9873014182f, 0.1588581433f, 0.9868094018f, 0.1618863938f,
+  0.9863080972f, 0.1649131205f, 0.9857975092f, 0.1679382950f,
+  0.9852776424f, 0.1709618888f, 0.9847485018f, 0.1739838734f,
+  0.9842100924f, 0.1770042204f, 0.9836624192f, 0.1800229014f,
+  0.9831054874f, 0.1830398880f, 0.9825393023f, 0.1860551517f,
+  0.9819638691f, 0.1890686641f, 0.9813791933f, 0.1920803970f,
+  0.9807852804f, 0.1950903220f, 0.9801821360f, 0.1980984107f,
+  0.9795697657f, 0.2011046348f, 0.9789481753f, 0.2041089661f,
+  0.9783173707f, 0.2071113762f, 0.9776773578f, 0.2101118369f,
+  0.9770281427f, 0.2131103199f, 0.9763697313f, 0.2161067971f,
+  0.9757021300f, 0.2191012402f, 0.9750253451f, 0.2220936210f,
+  0.9743393828f, 0.2250839114f, 0.9736442497f, 0.2280720832f,
+  0.9729399522f, 0.2310581083f, 0.9722264971f, 0.2340419586f,
+  0.9715038910f, 0.2370236060f, 0.9707721407f, 0.2400030224f,
+  0.9700312532f, 0.2429801799f, 0.9692812354f, 0.2459550503f,
+  0.9685220943f, 0.2489276057f, 0.9677538371f, 0.2518978182f,
+  0.9669764710f, 0.2548656596f, 0.9661900034f, 0.2578311022f,
+  0.9653944417f, 0.2607941179f, 0.9645897933f, 0.2637546790f,
+  0.9637760658f, 0.2667127575f, 0.9629532669f, 0.2696683256f,
+  0.9621214043f, 0.2726213554f, 0.9612804858f, 0.2755718193f,
+  0.9604305194f, 0.2785196894f, 0.9595715131f, 0.2814649379f,
+  0.9587034749f, 0.2844075372f, 0.9578264130f, 0.2873474595f,
+  0.9569403357f, 0.2902846773f, 0.9560452513f, 0.2932191627f,
+  0.9551411683f, 0.2961508882f, 0.9542280951f, 0.2990798263f,
+  0.9533060404f, 0.3020059493f, 0.9523750127f, 0.3049292297f,
+  0.9514350210f, 0.3078496400f, 0.9504860739f, 0.3107671527f,
+  0.9495281806f, 0.3136817404f, 0.9485613499f, 0.3165933756f,
+  0.9475855910f, 0.3195020308f, 0.9466009131f, 0.3224076788f,
+  0.9456073254f, 0.3253102922f, 0.9446048373f, 0.3282098436f,
+  0.9435934582f, 0.3311063058f, 0.9425731976f, 0.3339996514f,
+  0.9415440652f, 0.3368898534f, 0.9405060706f, 0.3397768844f,
+  0.9394592236f, 0.3426607173f, 0.9384035341f, 0.3455413250f,
+  0.9373390119f, 0.3484186802f, 0.9362656672f, 0.3512927561f,
+  0.9351835099f, 0.3541635254f, 0.9340925504f, 0.3570309612f,
+  0.9329927988f, 0.3598950365f, 0.9318842656f, 0.3627557244f,
+  0.9307669611f, 0.3656129978f, 0.9296408958f, 0.3684668300f,
+  0.9285060805f, 0.3713171940f, 0.9273625257f, 0.3741640630f,
+  0.9262102421f, 0.3770074102f, 0.9250492408f, 0.3798472089f,
+  0.9238795325f, 0.3826834324f, 0.9227011283f, 0.3855160538f,
+  0.9215140393f, 0.3883450467f, 0.9203182767f, 0.3911703843f,
+  0.9191138517f, 0.3939920401f, 0.9179007756f, 0.3968099874f,
+  0.9166790599f, 0.3996241998f, 0.9154487161f, 0.4024346509f,
+  0.9142097557f, 0.4052413140f, 0.9129621904f, 0.4080441629f,
+  0.9117060320f, 0.4108431711f, 0.9104412923f, 0.4136383122f,
+  0.9091679831f, 0.4164295601f, 0.9078861165f, 0.4192168884f,
+  0.9065957045f, 0.4220002708f, 0.9052967593f, 0.4247796812f,
+  0.9039892931f, 0.4275550934f, 0.9026733182f, 0.4303264813f,
+  0.9013488470f, 0.4330938189f, 0.9000158920f, 0.4358570799f,
+  0.8986744657f, 0.4386162385f, 0.8973245807f, 0.4413712687f,
+  0.8959662498f, 0.4441221446f, 0.8945994856f, 0.4468688402f,
+  0.8932243012f, 0.4496113297f, 0.8918407094f, 0.4523495872f,
+  0.8904487232f, 0.4550835871f, 0.8890483559f, 0.4578133036f,
+  0.8876396204f, 0.4605387110f, 0.8862225301f, 0.4632597836f,
+  0.8847970984f, 0.4659764958f, 0.8833633387f, 0.4686888220f,
+  0.8819212643f, 0.4713967368f, 0.8804708891f, 0.4741002147f,
+  0.8790122264f, 0.4767992301f, 0.8775452902f, 0.4794937577f,
+  0.8760700942f, 0.4821837721f, 0.8745866523f, 0.4848692480f,
+  0.8730949784f, 0.4875501601f, 0.8715950867f, 0.4902264833f,
+  0.8700869911f, 0.4928981922f, 0.8685707060f, 0.4955652618f,
+  0.8670462455f, 0.4982276670f, 0.8655136241f, 0.5008853826f,
+  0.8639728561f, 0.5035383837f, 0.8624239561f, 0.5061866453f,
+  0.8608669386f, 0.5088301425f, 0.8593018184f, 0.5114688504f,
+  0.8577286100f, 0.5141027442f, 0.8561473284f, 0.5167317990f,
+  0.8545579884f, 0.5193559902f, 0.8529606049f, 0.5219752929f,
+  0.8513551931f, 0.5245896827f, 0.8497417680f, 0.5271991348f,
+  0.8481203448f, 0.5298036247f, 0.8464909388f, 0.5324031279f,
+  0.8448535652f, 0.5349976199f, 0.8432082396f, 0.5375870763f,
+  0.8415549774f, 0.5401714727f, 0.8398937942f, 0.5427507849f,
+  0.8382247056f, 0.5453249884f, 0.8365477272f, 0.5478940592f,
+  0.8348628750f, 0.5504579729f, 0.8331701647f, 0.5530167056f,
+  0.8314696123f, 0.5555702330f, 0.8297612338f, 0.5581185312f,
+  0.8280450453f, 0.5606615762f, 0.8263210628f, 0.5631993440f,
+  0.8245893028f, 0.5657318108f, 0.8228497814f, 0.5682589527f,
+  0.8211025150f, 0.5707807459f, 0.8193475201f, 0.5732971667f,
+  0.8175848132f, 0.5758081914f, 0.8158144108f, 0.5783137964f,
+  0.8140363297f, 0.5808139581f, 0.8122505866f, 0.5833086529f,
+  0.8104571983f, 0.5857978575f, 0.8086561816f, 0.5882815482f,
+  0.8068475535f, 0.5907597019f, 0.8050313311f, 0.5932322950f,
+  0.8032075315f, 0.5956993045f, 0.8013761717f, 0.5981607070f,
+  0.7995372691f, 0.6006164794f, 0.7976908409f, 0.6030665985f,
+  0.7958369046f, 0.6055110414f, 0.7939754776f, 0.6079497850f,
+  0.7921065773f, 0.6103828063f, 0.7902302214f, 0.6128100824f,
+  0.7883464276f, 0.6152315906f, 0.7864552136f, 0.6176473079f,
+  0.7845565972f, 0.6200572118f, 0.7826505962f, 0.6224612794f,
+  0.7807372286f, 0.6248594881f, 0.7788165124f, 0.6272518155f,
+  0.7768884657f, 0.6296382389f, 0.7749531066f, 0.6320187359f,
+  0.7730104534f, 0.6343932842f, 0.7710605243f, 0.6367618612f,
+  0.7691033376f, 0.6391244449f, 0.7671389119f, 0.6414810128f,
+  0.7651672656f, 0.6438315429f, 0.7631884173f, 0.6461760130f,
+  0.7612023855f, 0.6485144010f, 0.7592091890f, 0.6508466850f,
+  0.7572088465f, 0.6531728430f, 0.7552013769f, 0.6554928530f,
+  0.7531867990f, 0.6578066933f, 0.7511651319f, 0.6601143421f,
+  0.7491363945f, 0.6624157776f, 0.7471006060f, 0.6647109782f,
+  0.7450577854f, 0.6669999223f, 0.7430079521f, 0.6692825883f,
+  0.7409511254f, 0.6715589548f, 0.7388873245f, 0.6738290004f,
+  0.7368165689f, 0.6760927036f, 0.7347388781f, 0.6783500431f,
+  0.7326542717f, 0.6806009978f, 0.7305627692f, 0.6828455464f,
+  0.7284643904f, 0.6850836678f, 0.7263591551f, 0.6873153409f,
+  0.7242470830f, 0.6895405447f, 0.7221281939f, 0.6917592584f,
+  0.7200025080f, 0.6939714609f, 0.7178700451f, 0.6961771315f,
+  0.7157308253f, 0.6983762494f, 0.7135848688f, 0.7005687939f,
+  0.7114321957f, 0.7027547445f, 0.7092728264f, 0.7049340804f,
+  0.7071067812f, 0.7071067812f, 0.7049340804f, 0.7092728264f,
+  0.7027547445f, 0.7114321957f, 0.7005687939f, 0.7135848688f,
+  0.6983762494f, 0.7157308253f, 0.6961771315f, 0.7178700451f,
+  0.6939714609f, 0.7200025080f, 0.6917592584f, 0.7221281939f,
+  0.6895405447f, 0.7242470830f, 0.6873153409f, 0.7263591551f,
+  0.6850836678f, 0.7284643904f, 0.6828455464f, 0.7305627692f,
+  0.6806009978f, 0.7326542717f, 0.6783500431f, 0.7347388781f,
+  0.6760927036f, 0.7368165689f, 0.6738290004f, 0.7388873245f,
+  0.6715589548f, 0.7409511254f, 0.6692825883f, 0.7430079521f,
+  0.6669999223f, 0.7450577854f, 0.6647109782f, 0.7471006060f,
+  0.6624157776f, 0.7491363945f, 0.6601143421f, 0.7511651319f,
+  0.6578066933f, 0.7531867990f, 0.6554928530f, 0.7552013769f,
+  0.6531728430f, 0.7572088465f, 0.6508466850f, 0.7592091890f,
+  0.6485144010f, 0.7612023855f, 0.6461760130f, 0.7631884173f,
+  0.6438315429f, 0.7651672656f, 0.6414810128f, 0.7671389119f,
+  0.6391244449f, 0.7691033376f, 0.6367618612f, 0.7710605243f,
+  0.6343932842f, 0.7730104534f, 0.6320187359f, 0.7749531066f,
+  0.6296382389f, 0.7768884657f, 0.6272518155f, 0.7788165124f,
+  0.6248594881f, 0.7807372286f, 0.6224612794f, 0.7826505962f,
+  0.6200572118f, 0.7845565972f, 0.6176473079f, 0.7864552136f,
+  0.6152315906f, 0.7883464276f, 0.6128100824f, 0.7902302214f,
+  0.6103828063f, 0.7921065773f, 0.6079497850f, 0.7939754776f,
+  0.6055110414f, 0.7958369046f, 0.6030665985f, 0.7976908409f,
+  0.6006164794f, 0.7995372691f, 0.5981607070f, 0.8013761717f,
+  0.5956993045f, 0.8032075315f, 0.5932322950f, 0.8050313311f,
+  0.5907597019f, 0.8068475535f, 0.5882815482f, 0.8086561816f,
+  0.5857978575f, 0.8104571983f, 0.5833086529f, 0.8122505866f,
+  0.5808139581f, 0.8140363297f, 0.5783137964f, 0.8158144108f,
+  0.5758081914f, 0.8175848132f, 0.5732971667f, 0.8193475201f,
+  0.5707807459f, 0.8211025150f, 0.5682589527f, 0.8228497814f,
+  0.5657318108f, 0.8245893028f, 0.5631993440f, 0.8263210628f,
+  0.5606615762f, 0.8280450453f, 0.5581185312f, 0.8297612338f,
+  0.5555702330f, 0.8314696123f, 0.5530167056f, 0.8331701647f,
+  0.5504579729f, 0.8348628750f, 0.5478940592f, 0.8365477272f,
+  0.5453249884f, 0.8382247056f, 0.5427507849f, 0.8398937942f,
+  0.5401714727f, 0.8415549774f, 0.5375870763f, 0.8432082396f,
+  0.5349976199f, 0.8448535652f, 0.5324031279f, 0.8464909388f,
+  0.5298036247f, 0.8481203448f, 0.5271991348f, 0.8497417680f,
+  0.5245896827f, 0.8513551931f, 0.5219752929f, 0.8529606049f,
+  0.5193559902f, 0.8545579884f, 0.5167317990f, 0.8561473284f,
+  0.5141027442f, 0.8577286100f, 0.5114688504f, 0.8593018184f,
+  0.5088301425f, 0.8608669386f, 0.5061866453f, 0.8624239561f,
+  0.5035383837f, 0.8639728561f, 0.5008853826f, 0.8655136241f,
+  0.4982276670f, 0.8670462455f, 0.4955652618f, 0.8685707060f,
+  0.4928981922f, 0.8700869911f, 0.4902264833f, 0.8715950867f,
+  0.4875501601f, 0.8730949784f, 0.4848692480f, 0.8745866523f,
+  0.4821837721f, 0.8760700942f, 0.4794937577f, 0.8775452902f,
+  0.4767992301f, 0.8790122264f, 0.4741002147f, 0.8804708891f,
+  0.4713967368f, 0.8819212643f, 0.4686888220f, 0.8833633387f,
+  0.4659764958f, 0.8847970984f, 0.4632597836f, 0.8862225301f,
+  0.4605387110f, 0.8876396204f, 0.4578133036f, 0.8890483559f,
+  0.4550835871f, 0.8904487232f, 0.4523495872f, 0.8918407094f,
+  0.4496113297f, 0.8932243012f, 0.4468688402f, 0.8945994856f,
+  0.4441221446f, 0.8959662498f, 0.4413712687f, 0.8973245807f,
+  0.4386162385f, 0.8986744657f, 0.4358570799f, 0.9000158920f,
+  0.4330938189f, 0.9013488470f, 0.4303264813f, 0.9026733182f,
+  0.4275550934f, 0.9039892931f, 0.4247796812f, 0.9052967593f,
+  0.4220002708f, 0.9065957045f, 0.4192168884f, 0.9078861165f,
+  0.4164295601f, 0.9091679831f, 0.4136383122f, 0.9104412923f,
+  0.4108431711f, 0.9117060320f, 0.4080441629f, 0.9129621904f,
+  0.4052413140f, 0.9142097557f, 0.4024346509f, 0.9154487161f,
+  0.3996241998f, 0.9166790599f, 0.3968099874f, 0.9179007756f,
+  0.3939920401f, 0.9191138517f, 0.3911703843f, 0.9203182767f,
+  0.3883450467f, 0.9215140393f, 0.3855160538f, 0.9227011283f,
+  0.3826834324f, 0.9238795325f, 0.3798472089f, 0.9250492408f,
+  0.3770074102f, 0.9262102421f, 0.3741640630f, 0.9273625257f,
+  0.3713171940f, 0.9285060805f, 0.3684668300f, 0.9296408958f,
+  0.3656129978f, 0.9307669611f, 0.3627557244f, 0.9318842656f,
+  0.3598950365f, 0.9329927988f, 0.3570309612f, 0.9340925504f,
+  0.3541635254f, 0.9351835099f, 0.3512927561f, 0.9362656672f,
+  0.3484186802f, 0.9373390119f, 0.3455413250f, 0.9384035341f,
+  0.3426607173f, 0.9394592236f, 0.3397768844f, 0.9405060706f,
+  0.3368898534f, 0.9415440652f, 0.3339996514f, 0.9425731976f,
+  0.3311063058f, 0.9435934582f, 0.3282098436f, 0.9446048373f,
+  0.3253102922f, 0.9456073254f, 0.3224076788f, 0.9466009131f,
+  0.3195020308f, 0.9475855910f, 0.3165933756f, 0.9485613499f,
+  0.3136817404f, 0.9495281806f, 0.3107671527f, 0.9504860739f,
+  0.3078496400f, 0.9514350210f, 0.3049292297f, 0.9523750127f,
+  0.3020059493f, 0.9533060404f, 0.2990798263f, 0.9542280951f,
+  0.2961508882f, 0.9551411683f, 0.2932191627f, 0.9560452513f,
+  0.2902846773f, 0.9569403357f, 0.2873474595f, 0.9578264130f,
+  0.2844075372f, 0.9587034749f, 0.2814649379f, 0.9595715131f,
+  0.2785196894f, 0.9604305194f, 0.2755718193f, 0.9612804858f,
+  0.2726213554f, 0.9621214043f, 0.2696683256f, 0.9629532669f,
+  0.2667127575f, 0.9637760658f, 0.2637546790f, 0.9645897933f,
+  0.2607941179f, 0.9653944417f, 0.2578311022f, 0.9661900034f,
+  0.2548656596f, 0.9669764710f, 0.2518978182f, 0.9677538371f,
+  0.2489276057f, 0.9685220943f, 0.2459550503f, 0.9692812354f,
+  0.2429801799f, 0.9700312532f, 0.2400030224f, 0.9707721407f,
+  0.2370236060f, 0.9715038910f, 0.2340419586f, 0.9722264971f,
+  0.2310581083f, 0.9729399522f, 0.2280720832f, 0.9736442497f,
+  0.2250839114f, 0.9743393828f, 0.2220936210f, 0.9750253451f,
+  0.2191012402f, 0.9757021300f, 0.2161067971f, 0.9763697313f,
+  0.2131103199f, 0.9770281427f, 0.2101118369f, 0.9776773578f,
+  0.2071113762f, 0.9783173707f, 0.2041089661f, 0.9789481753f,
+  0.2011046348f, 0.9795697657f, 0.1980984107f, 0.9801821360f,
+  0.1950903220f, 0.9807852804f, 0.1920803970f, 0.9813791933f,
+  0.1890686641f, 0.9819638691f, 0.1860551517f, 0.9825393023f,
+  0.1830398880f, 0.9831054874f, 0.1800229014f, 0.9836624192f,
+  0.1770042204f, 0.9842100924f, 0.1739838734f, 0.9847485018f,
+  0.1709618888f, 0.9852776424f, 0.1679382950f, 0.9857975092f,
+  0.1649131205f, 0.9863080972f, 0.1618863938f, 0.9868094018f,
+  0.1588581433f, 0.9873014182f, 0.1558283977f, 0.9877841416f,
+  0.1527971853f, 0.9882575677f, 0.1497645347f, 0.9887216920f,
+  0.1467304745f, 0.9891765100f, 0.1436950332f, 0.9896220175f,
+  0.1406582393f, 0.9900582103f, 0.1376201216f, 0.9904850843f,
+  0.1345807085f, 0.9909026354f, 0.1315400287f, 0.9913108598f,
+  0.1284981108f, 0.9917097537f, 0.1254549834f, 0.9920993131f,
+  0.1224106752f, 0.9924795346f, 0.1193652148f, 0.9928504145f,
+  0.1163186309f, 0.9932119492f, 0.1132709522f, 0.9935641355f,
+  0.1102222073f, 0.9939069700f, 0.1071724250f, 0.9942404495f,
+  0.1041216339f, 0.9945645707f, 0.1010698628f, 0.9948793308f,
+  0.0980171403f, 0.9951847267f, 0.0949634953f, 0.9954807555f,
+  0.0919089565f, 0.9957674145f, 0.0888535526f, 0.9960447009f,
+  0.0857973123f, 0.9963126122f, 0.0827402645f, 0.9965711458f,
+  0.0796824380f, 0.9968202993f, 0.0766238614f, 0.9970600703f,
+  0.0735645636f, 0.9972904567f, 0.0705045734f, 0.9975114561f,
+  0.0674439196f, 0.9977230666f, 0.0643826309f, 0.9979252862f,
+  0.0613207363f, 0.9981181129f, 0.0582582645f, 0.9983015449f,
+  0.0551952443f, 0.9984755806f, 0.0521317047f, 0.9986402182f,
+  0.0490676743f, 0.9987954562f, 0.0460031821f, 0.9989412932f,
+  0.0429382569f, 0.9990777278f, 0.0398729276f, 0.9992047586f,
+  0.0368072229f, 0.9993223846f, 0.0337411719f, 0.9994306046f,
+  0.0306748032f, 0.9995294175f, 0.0276081458f, 0.9996188225f,
+  0.0245412285f, 0.9996988187f, 0.0214740803f, 0.9997694054f,
+  0.0184067299f, 0.9998305818f, 0.0153392063f, 0.9998823475f,
+  0.0122715383f, 0.9999247018f, 0.0092037548f, 0.9999576446f,
+  0.0061358846f, 0.9999811753f, 0.0030679568f, 0.9999952938f
+};
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
+const float32_t twiddleCoef_rfft_4096[2048] = {
+  1.0000000000f, 0.0000000000f, 0.9999988235f, 0.0015339802f,
+  0.9999952938f, 0.0030679568f, 0.9999894111f, 0.0046019261f,
+  0.9999811753f, 0.0061358846f, 0.9999705864f, 0.0076698287f,
+  0.9999576446f, 0.0092037548f, 0.9999423497f, 0.0107376592f,
+  0.9999247018f, 0.0122715383f, 0.9999047011f, 0.0138053885f,
+  0.9998823475f, 0.0153392063f, 0.9998576410f, 0.0168729879f,
+  0.9998305818f, 0.0184067299f, 0.9998011699f, 0.0199404286f,
+  0.9997694054f, 0.0214740803f, 0.9997352883f, 0.0230076815f,
+  0.9996988187f, 0.0245412285f, 0.9996599967f, 0.0260747178f,
+  0.9996188225f, 0.0276081458f, 0.9995752960f, 0.0291415088f,
+  0.9995294175f, 0.0306748032f, 0.9994811870f, 0.0322080254f,
+  0.9994306046f, 0.0337411719f, 0.9993776704f, 0.0352742389f,
+  0.9993223846f, 0.0368072229f, 0.9992647473f, 0.0383401204f,
+  0.9992047586f, 0.0398729276f, 0.9991424187f, 0.0414056410f,
+  0.9990777278f, 0.0429382569f, 0.9990106859f, 0.0444707719f,
+  0.9989412932f, 0.0460031821f, 0.9988695499f, 0.0475354842f,
+  0.9987954562f, 0.0490676743f, 0.9987190122f, 0.0505997490f,
+  0.9986402182f, 0.0521317047f, 0.9985590742f, 0.0536635377f,
+  0.9984755806f, 0.0551952443f, 0.9983897374f, 0.0567268212f,
+  0.9983015449f, 0.0582582645f, 0.9982110034f, 0.0597895707f,
+  0.9981181129f, 0.0613207363f, 0.9980228738f, 0.0628517576f,
+  0.9979252862f, 0.0643826309f, 0.9978253504f, 0.0659133528f,
+  0.9977230666f, 0.0674439196f, 0.9976184351f, 0.0689743276f,
+  0.9975114561f, 0.0705045734f, 0.9974021299f, 0.0720346532f,
+  0.9972904567f, 0.0735645636f, 0.9971764367f, 0.0750943008f,
+  0.9970600703f, 0.0766238614f, 0.9969413578f, 0.0781532416f,
+  0.9968202993f, 0.0796824380f, 0.9966968952f, 0.0812114468f,
+  0.9965711458f, 0.0827402645f, 0.9964430514f, 0.0842688876f,
+  0.9963126122f, 0.0857973123f, 0.9961798286f, 0.0873255352f,
+  0.9960447009f, 0.0888535526f, 0.9959072294f, 0.0903813609f,
+  0.9957674145f, 0.0919089565f, 0.9956252564f, 0.0934363358f,
+  0.9954807555f, 0.0949634953f, 0.9953339121f, 0.0964904314f,
+  0.9951847267f, 0.0980171403f, 0.9950331994f, 0.0995436187f,
+  0.9948793308f, 0.1010698628f, 0.9947231211f, 0.1025958690f,
+  0.9945645707f, 0.1041216339f, 0.9944036801f, 0.1056471537f,
+  0.9942404495f, 0.1071724250f, 0.9940748793f, 0.1086974440f,
+  0.9939069700f, 0.1102222073f, 0.9937367219f, 0.1117467112f,
+  0.9935641355f, 0.1132709522f, 0.9933892111f, 0.1147949266f,
+  0.9932119492f, 0.1163186309f, 0.9930323502f, 0.1178420615f,
+  0.9928504145f, 0.1193652148f, 0.9926661424f, 0.1208880872f,
+  0.9924795346f, 0.1224106752f, 0.9922905913f, 0.1239329751f,
+  0.9920993131f, 0.1254549834f, 0.9919057004f, 0.1269766965f,
+  0.9917097537f, 0.1284981108f, 0.9915114733f, 0.1300192227f,
+  0.9913108598f, 0.1315400287f, 0.9911079137f, 0.1330605252f,
+  0.9909026354f, 0.1345807085f, 0.9906950254f, 0.1361005752f,
+  0.9904850843f, 0.1376201216f, 0.9902728124f, 0.1391393442f,
+  0.9900582103f, 0.1406582393f, 0.9898412785f, 0.1421768035f,
+  0.9896220175f, 0.1436950332f, 0.9894004278f, 0.1452129247f,
+  0.9891765100f, 0.1467304745f, 0.9889502645f, 0.1482476790f,
+  0.9887216920f, 0.1497645347f, 0.9884907929f, 0.1512810380f,
+  0.9882575677f, 0.1527971853f, 0.9880220171f, 0.1543129730f,
+  0.9877841416f, 0.1558283977f, 0.9875439418f, 0.1573434556f,
+  0.9873014182f, 0.1588581433f, 0.9870565713f, 0.1603724572f,
+  0.9868094018f, 0.1618863938f, 0.9865599103f, 0.1633999494f,
+  0.9863080972f, 0.1649131205f, 0.9860539633f, 0.1664259035f,
+  0.9857975092f, 0.1679382950f, 0.9855387353f, 0.1694502912f,
+  0.9852776424f, 0.1709618888f, 0.9850142310f, 0.1724730840f,
+  0.9847485018f, 0.1739838734f, 0.9844804554f, 0.1754942534f,
+  0.9842100924f, 0.1770042204f, 0.9839374134f, 0.1785137709f,
+  0.9836624192f, 0.1800229014f, 0.9833851103f, 0.1815316083f,
+  0.9831054874f, 0.1830398880f, 0.9828235512f, 0.1845477369f,
+  0.9825393023f, 0.1860551517f, 0.9822527414f, 0.1875621286f,
+  0.9819638691f, 0.1890686641f, 0.9816726862f, 0.1905747548f,
+  0.9813791933f, 0.1920803970f, 0.9810833912f, 0.1935855873f,
+  0.9807852804f, 0.1950903220f, 0.9804848618f, 0.1965945977f,
+  0.9801821360f, 0.1980984107f, 0.9798771037f, 0.1996017576f,
+  0.9795697657f, 0.2011046348f, 0.9792601226f, 0.2026070388f,
+  0.9789481753f, 0.2041089661f, 0.9786339244f, 0.2056104131f,
+  0.9783173707f, 0.2071113762f, 0.9779985149f, 0.2086118520f,
+  0.9776773578f, 0.2101118369f, 0.9773539001f, 0.2116113274f,
+  0.9770281427f, 0.2131103199f, 0.9767000861f, 0.2146088110f,
+  0.9763697313f, 0.2161067971f, 0.9760370790f, 0.2176042746f,
+  0.9757021300f, 0.2191012402f, 0.9753648851f, 0.2205976901f,
+  0.9750253451f, 0.2220936210f, 0.9746835107f, 0.2235890292f,
+  0.9743393828f, 0.2250839114f, 0.9739929622f, 0.2265782638f,
+  0.9736442497f, 0.2280720832f, 0.9732932461f, 0.2295653658f,
+  0.9729399522f, 0.2310581083f, 0.9725843689f, 0.2325503070f,
+  0.9722264971f, 0.2340419586f, 0.9718663375f, 0.2355330594f,
+  0.9715038910f, 0.2370236060f, 0.9711391584f, 0.2385135948f,
+  0.9707721407f, 0.2400030224f, 0.9704028387f, 0.2414918853f,
+  0.9700312532f, 0.2429801799f, 0.9696573851f, 0.2444679027f,
+  0.9692812354f, 0.2459550503f, 0.9689028048f, 0.2474416192f,
+  0.9685220943f, 0.2489276057f, 0.9681391047f, 0.2504130066f,
+  0.9677538371f, 0.2518978182f, 0.9673662922f, 0.2533820370f,
+  0.9669764710f, 0.2548656596f, 0.9665843745f, 0.2563486825f,
+  0.9661900034f, 0.2578311022f, 0.9657933589f, 0.2593129151f,
+  0.9653944417f, 0.2607941179f, 0.9649932529f, 0.2622747070f,
+  0.9645897933f, 0.2637546790f, 0.9641840640f, 0.2652340303f,
+  0.9637760658f, 0.2667127575f, 0.9633657998f, 0.2681908571f,
+  0.9629532669f, 0.2696683256f, 0.9625384680f, 0.2711451595f,
+  0.9621214043f, 0.2726213554f, 0.9617020765f, 0.2740969099f,
+  0.9612804858f, 0.2755718193f, 0.9608566331f, 0.2770460803f,
+  0.9604305194f, 0.2785196894f, 0.9600021457f, 0.2799926431f,
+  0.9595715131f, 0.2814649379f, 0.9591386225f, 0.2829365705f,
+  0.9587034749f, 0.2844075372f, 0.9582660714f, 0.2858778347f,
+  0.9578264130f, 0.2873474595f, 0.9573845008f, 0.2888164082f,
+  0.9569403357f, 0.2902846773f, 0.9564939189f, 0.2917522632f,
+  0.9560452513f, 0.2932191627f, 0.9555943341f, 0.2946853722f,
+  0.9551411683f, 0.2961508882f, 0.9546857549f, 0.2976157074f,
+  0.9542280951f, 0.2990798263f, 0.9537681899f, 0.3005432414f,
+  0.9533060404f, 0.3020059493f, 0.9528416476f, 0.3034679466f,
+  0.9523750127f, 0.3049292297f, 0.9519061368f, 0.3063897954f,
+  0.9514350210f, 0.3078496400f, 0.9509616663f, 0.3093087603f,
+  0.9504860739f, 0.3107671527f, 0.9500082450f, 0.3122248139f,
+  0.9495281806f, 0.3136817404f, 0.9490458819f, 0.3151379288f,
+  0.9485613499f, 0.3165933756f, 0.9480745859f, 0.3180480774f,
+  0.9475855910f, 0.3195020308f, 0.9470943664f, 0.3209552324f,
+  0.9466009131f, 0.3224076788f, 0.9461052324f, 0.3238593665f,
+  0.9456073254f, 0.3253102922f, 0.9451071933f, 0.3267604523f,
+  0.9446048373f, 0.3282098436f, 0.9441002585f, 0.3296584625f,
+  0.9435934582f, 0.3311063058f, 0.9430844375f, 0.3325533699f,
+  0.9425731976f, 0.3339996514f, 0.9420597398f, 0.3354451471f,
+  0.9415440652f, 0.3368898534f, 0.9410261751f, 0.3383337670f,
+  0.9405060706f, 0.3397768844f, 0.9399837530f, 0.3412192023f,
+  0.9394592236f, 0.3426607173f, 0.9389324835f, 0.3441014260f,
+  0.9384035341f, 0.3455413250f, 0.9378723764f, 0.3469804108f,
+  0.9373390119f, 0.3484186802f, 0.9368034417f, 0.3498561298f,
+  0.9362656672f, 0.3512927561f, 0.9357256895f, 0.3527285558f,
+  0.9351835099f, 0.3541635254f, 0.9346391298f, 0.3555976617f,
+  0.9340925504f, 0.3570309612f, 0.9335437730f, 0.3584634206f,
+  0.9329927988f, 0.3598950365f, 0.9324396293f, 0.3613258056f,
+  0.9318842656f, 0.3627557244f, 0.9313267091f, 0.3641847896f,
+  0.9307669611f, 0.3656129978f, 0.9302050229f, 0.3670403457f,
+  0.9296408958f, 0.3684668300f, 0.9290745813f, 0.3698924471f,
+  0.9285060805f, 0.3713171940f, 0.9279353948f, 0.3727410670f,
+  0.9273625257f, 0.3741640630f, 0.9267874743f, 0.3755861785f,
+  0.9262102421f, 0.3770074102f, 0.9256308305f, 0.3784277548f,
+  0.9250492408f, 0.3798472089f, 0.9244654743f, 0.3812657692f,
+  0.9238795325f, 0.3826834324f, 0.9232914167f, 0.3841001950f,
+  0.9227011283f, 0.3855160538f, 0.9221086687f, 0.3869310055f,
+  0.9215140393f, 0.3883450467f, 0.9209172415f, 0.3897581741f,
+  0.9203182767f, 0.3911703843f, 0.9197171463f, 0.3925816741f,
+  0.9191138517f, 0.3939920401f, 0.9185083943f, 0.3954014789f,
+  0.9179007756f, 0.3968099874f, 0.9172909970f, 0.3982175622f,
+  0.9166790599f, 0.3996241998f, 0.9160649658f, 0.4010298972f,
+  0.9154487161f, 0.4024346509f, 0.9148303122f, 0.4038384576f,
+  0.9142097557f, 0.4052413140f, 0.9135870479f, 0.4066432169f,
+  0.9129621904f, 0.4080441629f, 0.9123351846f, 0.4094441487f,
+  0.9117060320f, 0.4108431711f, 0.9110747341f, 0.4122412267f,
+  0.9104412923f, 0.4136383122f, 0.9098057081f, 0.4150344245f,
+  0.9091679831f, 0.4164295601f, 0.9085281187f, 0.4178237158f,
+  0.9078861165f, 0.4192168884f, 0.9072419779f, 0.4206090744f,
+  0.9065957045f, 0.4220002708f, 0.9059472978f, 0.4233904741f,
+  0.9052967593f, 0.4247796812f, 0.9046440906f, 0.4261678887f,
+  0.9039892931f, 0.4275550934f, 0.9033323685f, 0.4289412921f,
+  0.9026733182f, 0.4303264813f, 0.9020121439f, 0.4317106580f,
+  0.9013488470f, 0.4330938189f, 0.9006834292f, 0.4344759606f,
+  0.9000158920f, 0.4358570799f, 0.8993462370f, 0.4372371737f,
+  0.8986744657f, 0.4386162385f, 0.8980005797f, 0.4399942713f,
+  0.8973245807f, 0.4413712687f, 0.8966464702f, 0.4427472276f,
+  0.8959662498f, 0.4441221446f, 0.8952839210f, 0.4454960165f,
+  0.8945994856f, 0.4468688402f, 0.8939129451f, 0.4482406123f,
+  0.8932243012f, 0.4496113297f, 0.8925335554f, 0.4509809890f,
+  0.8918407094f, 0.4523495872f, 0.8911457648f, 0.4537171210f,
+  0.8904487232f, 0.4550835871f, 0.8897495864f, 0.4564489824f,
+  0.8890483559f, 0.4578133036f, 0.8883450333f, 0.4591765475f,
+  0.8876396204f, 0.4605387110f, 0.8869321188f, 0.4618997907f,
+  0.8862225301f, 0.4632597836f, 0.8855108561f, 0.4646186863f,
+  0.8847970984f, 0.4659764958f, 0.8840812587f, 0.4673332087f,
+  0.8833633387f, 0.4686888220f, 0.8826433400f, 0.4700433325f,
+  0.8819212643f, 0.4713967368f, 0.8811971135f, 0.4727490320f,
+  0.8804708891f, 0.4741002147f, 0.8797425928f, 0.4754502817f,
+  0.8790122264f, 0.4767992301f, 0.8782797917f, 0.4781470564f,
+  0.8775452902f, 0.4794937577f, 0.8768087238f, 0.4808393306f,
+  0.8760700942f, 0.4821837721f, 0.8753294031f, 0.4835270789f,
+  0.8745866523f, 0.4848692480f, 0.8738418435f, 0.4862102761f,
+  0.8730949784f, 0.4875501601f, 0.8723460589f, 0.4888888969f,
+  0.8715950867f, 0.4902264833f, 0.8708420635f, 0.4915629161f,
+  0.8700869911f, 0.4928981922f, 0.8693298713f, 0.4942323085f,
+  0.8685707060f, 0.4955652618f, 0.8678094968f, 0.4968970490f,
+  0.8670462455f, 0.4982276670f, 0.8662809540f, 0.4995571125f,
+  0.8655136241f, 0.5008853826f, 0.8647442575f, 0.5022124740f,
+  0.8639728561f, 0.5035383837f, 0.8631994217f, 0.5048631085f,
+  0.8624239561f, 0.5061866453f, 0.8616464611f, 0.5075089911f,
+  0.8608669386f, 0.5088301425f, 0.8600853904f, 0.5101500967f,
+  0.8593018184f, 0.5114688504f, 0.8585162243f, 0.5127864006f,
+  0.8577286100f, 0.5141027442f, 0.8569389774f, 0.5154178780f,
+  0.8561473284f, 0.5167317990f, 0.8553536647f, 0.5180445041f,
+  0.8545579884f, 0.5193559902f, 0.8537603011f, 0.5206662541f,
+  0.8529606049f, 0.5219752929f, 0.8521589016f, 0.5232831035f,
+  0.8513551931f, 0.5245896827f, 0.8505494813f, 0.5258950275f,
+  0.8497417680f, 0.5271991348f, 0.8489320552f, 0.5285020015f,
+  0.8481203448f, 0.5298036247f, 0.8473066387f, 0.5311040012f,
+  0.8464909388f, 0.5324031279f, 0.8456732470f, 0.5337010018f,
+  0.8448535652f, 0.5349976199f, 0.8440318955f, 0.5362929791f,
+  0.8432082396f, 0.5375870763f, 0.8423825996f, 0.5388799085f,
+  0.8415549774f, 0.5401714727f, 0.8407253750f, 0.5414617659f,
+  0.8398937942f, 0.5427507849f, 0.8390602371f, 0.5440385267f,
+  0.8382247056f, 0.5453249884f, 0.8373872016f, 0.5466101669f,
+  0.8365477272f, 0.5478940592f, 0.8357062844f, 0.5491766622f,
+  0.8348628750f, 0.5504579729f, 0.8340175011f, 0.5517379884f,
+  0.8331701647f, 0.5530167056f, 0.8323208678f, 0.5542941215f,
+  0.8314696123f, 0.5555702330f, 0.8306164003f, 0.5568450373f,
+  0.8297612338f, 0.5581185312f, 0.8289041148f, 0.5593907119f,
+  0.8280450453f, 0.5606615762f, 0.8271840273f, 0.5619311212f,
+  0.8263210628f, 0.5631993440f, 0.8254561540f, 0.5644662415f,
+  0.8245893028f, 0.5657318108f, 0.8237205112f, 0.5669960488f,
+  0.8228497814f, 0.5682589527f, 0.8219771153f, 0.5695205193f,
+  0.8211025150f, 0.5707807459f, 0.8202259826f, 0.5720396293f,
+  0.8193475201f, 0.5732971667f, 0.8184671296f, 0.5745533550f,
+  0.8175848132f, 0.5758081914f, 0.8167005729f, 0.5770616729f,
+  0.8158144108f, 0.5783137964f, 0.8149263291f, 0.5795645591f,
+  0.8140363297f, 0.5808139581f, 0.8131444148f, 0.5820619903f,
+  0.8122505866f, 0.5833086529f, 0.8113548470f, 0.5845539430f,
+  0.8104571983f, 0.5857978575f, 0.8095576424f, 0.5870403935f,
+  0.8086561816f, 0.5882815482f, 0.8077528179f, 0.5895213186f,
+  0.8068475535f, 0.5907597019f, 0.8059403906f, 0.5919966950f,
+  0.8050313311f, 0.5932322950f, 0.8041203774f, 0.5944664992f,
+  0.8032075315f, 0.5956993045f, 0.8022927955f, 0.5969307081f,
+  0.8013761717f, 0.5981607070f, 0.8004576622f, 0.5993892984f,
+  0.7995372691f, 0.6006164794f, 0.7986149946f, 0.6018422471f,
+  0.7976908409f, 0.6030665985f, 0.7967648102f, 0.6042895309f,
+  0.7958369046f, 0.6055110414f, 0.7949071263f, 0.6067311270f,
+  0.7939754776f, 0.6079497850f, 0.7930419605f, 0.6091670123f,
+  0.7921065773f, 0.6103828063f, 0.7911693302f, 0.6115971639f,
+  0.7902302214f, 0.6128100824f, 0.7892892532f, 0.6140215589f,
+  0.7883464276f, 0.6152315906f, 0.7874017470f, 0.6164401745f,
+  0.7864552136f, 0.6176473079f, 0.7855068296f, 0.6188529880f,
+  0.7845565972f, 0.6200572118f, 0.7836045186f, 0.6212599765f,
+  0.7826505962f, 0.6224612794f, 0.7816948321f, 0.6236611175f,
+  0.7807372286f, 0.6248594881f, 0.7797777879f, 0.6260563884f,
+  0.7788165124f, 0.6272518155f, 0.7778534042f, 0.6284457666f,
+  0.7768884657f, 0.6296382389f, 0.7759216990f, 0.6308292296f,
+  0.7749531066f, 0.6320187359f, 0.7739826906f, 0.6332067551f,
+  0.7730104534f, 0.6343932842f, 0.7720363972f, 0.6355783205f,
+  0.7710605243f, 0.6367618612f, 0.7700828370f, 0.6379439036f,
+  0.7691033376f, 0.6391244449f, 0.7681220285f, 0.6403034822f,
+  0.7671389119f, 0.6414810128f, 0.7661539902f, 0.6426570340f,
+  0.7651672656f, 0.6438315429f, 0.7641787405f, 0.6450045368f,
+  0.7631884173f, 0.6461760130f, 0.7621962981f, 0.6473459686f,
+  0.7612023855f, 0.6485144010f, 0.7602066817f, 0.6496813074f,
+  0.7592091890f, 0.6508466850f, 0.7582099098f, 0.6520105311f,
+  0.7572088465f, 0.6531728430f, 0.7562060014f, 0.6543336178f,
+  0.7552013769f, 0.6554928530f, 0.7541949753f, 0.6566505457f,
+  0.7531867990f, 0.6578066933f, 0.7521768504f, 0.6589612930f,
+  0.7511651319f, 0.6601143421f, 0.7501516458f, 0.6612658378f,
+  0.7491363945f, 0.6624157776f, 0.7481193805f, 0.6635641586f,
+  0.7471006060f, 0.6647109782f, 0.7460800735f, 0.6658562337f,
+  0.7450577854f, 0.6669999223f, 0.7440337442f, 0.6681420414f,
+  0.7430079521f, 0.6692825883f, 0.7419804117f, 0.6704215604f,
+  0.7409511254f, 0.6715589548f, 0.7399200955f, 0.6726947691f,
+  0.7388873245f, 0.6738290004f, 0.7378528148f, 0.6749616461f,
+  0.7368165689f, 0.6760927036f, 0.7357785892f, 0.6772221701f,
+  0.7347388781f, 0.6783500431f, 0.7336974381f, 0.6794763199f,
+  0.7326542717f, 0.6806009978f, 0.7316093812f, 0.6817240742f,
+  0.7305627692f, 0.6828455464f, 0.7295144381f, 0.6839654118f,
+  0.7284643904f, 0.6850836678f, 0.7274126286f, 0.6862003117f,
+  0.7263591551f, 0.6873153409f, 0.7253039724f, 0.6884287528f,
+  0.7242470830f, 0.6895405447f, 0.7231884893f, 0.6906507141f,
+  0.7221281939f, 0.6917592584f, 0.7210661993f, 0.6928661748f,
+  0.7200025080f, 0.6939714609f, 0.7189371224f, 0.6950751140f,
+  0.7178700451f, 0.6961771315f, 0.7168012785f, 0.6972775108f,
+  0.7157308253f, 0.6983762494f, 0.7146586879f, 0.6994733446f,
+  0.7135848688f, 0.7005687939f, 0.7125093706f, 0.7016625947f,
+  0.7114321957f, 0.7027547445f, 0.7103533469f, 0.7038452405f,
+  0.7092728264f, 0.7049340804f, 0.7081906370f, 0.7060212614f,
+  0.7071067812f, 0.7071067812f, 0.7060212614f, 0.7081906370f,
+  0.7049340804f, 0.7092728264f, 0.7038452405f, 0.7103533469f,
+  0.7027547445f, 0.7114321957f, 0.7016625947f, 0.7125093706f,
+  0.7005687939f, 0.7135848688f, 0.6994733446f, 0.7146586879f,
+  0.6983762494f, 0.7157308253f, 0.6972775108f, 0.7168012785f,
+  0.6961771315f, 0.7178700451f, 0.6950751140f, 0.7189371224f,
+  0.6939714609f, 0.7200025080f, 0.6928661748f, 0.7210661993f,
+  0.6917592584f, 0.7221281939f, 0.6906507141f, 0.7231884893f,
+  0.6895405447f, 0.7242470830f, 0.6884287528f, 0.7253039724f,
+  0.6873153409f, 0.7263591551f, 0.6862003117f, 0.7274126286f,
+  0.6850836678f, 0.7284643904f, 0.6839654118f, 0.7295144381f,
+  0.6828455464f, 0.7305627692f, 0.6817240742f, 0.7316093812f,
+  0.6806009978f, 0.7326542717f, 0.6794763199f, 0.7336974381f,
+  0.6783500431f, 0.7347388781f, 0.6772221701f, 0.7357785892f,
+  0.6760927036f, 0.7368165689f, 0.6749616461f, 0.7378528148f,
+  0.6738290004f, 0.7388873245f, 0.6726947691f, 0.7399200955f,
+  0.6715589548f, 0.7409511254f, 0.6704215604f, 0.7419804117f,
+  0.6692825883f, 0.7430079521f, 0.6681420414f, 0.7440337442f,
+  0.6669999223f, 0.7450577854f, 0.6658562337f, 0.7460800735f,
+  0.6647109782f, 0.7471006060f, 0.6635641586f, 0.7481193805f,
+  0.6624157776f, 0.7491363945f, 0.6612658378f, 0.7501516458f,
+  0.6601143421f, 0.7511651319f, 0.6589612930f, 0.7521768504f,
+  0.6578066933f, 0.7531867990f, 0.6566505457f, 0.7541949753f,
+  0.6554928530f, 0.7552013769f, 0.6543336178f, 0.7562060014f,
+  0.6531728430f, 0.7572088465f, 0.6520105311f, 0.7582099098f,
+  0.6508466850f, 0.7592091890f, 0.6496813074f, 0.7602066817f,
+  0.6485144010f, 0.7612023855f, 0.6473459686f, 0.7621962981f,
+  0.6461760130f, 0.7631884173f, 0.6450045368f, 0.7641787405f,
+  0.6438315429f, 0.7651672656f, 0.6426570340f, 0.7661539902f,
+  0.6414810128f, 0.7671389119f, 0.6403034822f, 0.7681220285f,
+  0.6391244449f, 0.7691033376f, 0.6379439036f, 0.7700828370f,
+  0.6367618612f, 0.7710605243f, 0.6355783205f, 0.7720363972f,
+  0.6343932842f, 0.7730104534f, 0.6332067551f, 0.7739826906f,
+  0.6320187359f, 0.7749531066f, 0.6308292296f, 0.7759216990f,
+  0.6296382389f, 0.7768884657f, 0.6284457666f, 0.7778534042f,
+  0.6272518155f, 0.7788165124f, 0.6260563884f, 0.7797777879f,
+  0.6248594881f, 0.7807372286f, 0.6236611175f, 0.7816948321f,
+  0.6224612794f, 0.7826505962f, 0.6212599765f, 0.7836045186f,
+  0.6200572118f, 0.7845565972f, 0.6188529880f, 0.7855068296f,
+  0.6176473079f, 0.7864552136f, 0.6164401745f, 0.7874017470f,
+  0.6152315906f, 0.7883464276f, 0.6140215589f, 0.7892892532f,
+  0.6128100824f, 0.7902302214f, 0.6115971639f, 0.7911693302f,
+  0.6103828063f, 0.7921065773f, 0.6091670123f, 0.7930419605f,
+  0.6079497850f, 0.7939754776f, 0.6067311270f, 0.7949071263f,
+  0.6055110414f, 0.7958369046f, 0.6042895309f, 0.7967648102f,
+  0.6030665985f, 0.7976908409f, 0.6018422471f, 0.7986149946f,
+  0.6006164794f, 0.7995372691f, 0.5993892984f, 0.8004576622f,
+  0.5981607070f, 0.8013761717f, 0.5969307081f, 0.8022927955f,
+  0.5956993045f, 0.8032075315f, 0.5944664992f, 0.8041203774f,
+  0.5932322950f, 0.8050313311f, 0.5919966950f, 0.8059403906f,
+  0.5907597019f, 0.8068475535f, 0.5895213186f, 0.8077528179f,
+  0.5882815482f, 0.8086561816f, 0.5870403935f, 0.8095576424f,
+  0.5857978575f, 0.8104571983f, 0.5845539430f, 0.8113548470f,
+  0.5833086529f, 0.8122505866f, 0.5820619903f, 0.8131444148f,
+  0.5808139581f, 0.8140363297f, 0.5795645591f, 0.8149263291f,
+  0.5783137964f, 0.8158144108f, 0.5770616729f, 0.8167005729f,
+  0.5758081914f, 0.8175848132f, 0.5745533550f, 0.8184671296f,
+  0.5732971667f, 0.8193475201f, 0.5720396293f, 0.8202259826f,
+  0.5707807459f, 0.8211025150f, 0.5695205193f, 0.8219771153f,
+  0.5682589527f, 0.8228497814f, 0.5669960488f, 0.8237205112f,
+  0.5657318108f, 0.8245893028f, 0.5644662415f, 0.8254561540f,
+  0.5631993440f, 0.8263210628f, 0.5619311212f, 0.8271840273f,
+  0.5606615762f, 0.8280450453f, 0.5593907119f, 0.8289041148f,
+  0.5581185312f, 0.8297612338f, 0.5568450373f, 0.8306164003f,
+  0.5555702330f, 0.8314696123f, 0.5542941215f, 0.8323208678f,
+  0.5530167056f, 0.8331701647f, 0.5517379884f, 0.8340175011f,
+  0.5504579729f, 0.8348628750f, 0.5491766622f, 0.8357062844f,
+  0.5478940592f, 0.8365477272f, 0.5466101669f, 0.8373872016f,
+  0.5453249884f, 0.8382247056f, 0.5440385267f, 0.8390602371f,
+  0.5427507849f, 0.8398937942f, 0.5414617659f, 0.8407253750f,
+  0.5401714727f, 0.8415549774f, 0.5388799085f, 0.8423825996f,
+  0.5375870763f, 0.8432082396f, 0.5362929791f, 0.8440318955f,
+  0.5349976199f, 0.8448535652f, 0.5337010018f, 0.8456732470f,
+  0.5324031279f, 0.8464909388f, 0.5311040012f, 0.8473066387f,
+  0.5298036247f, 0.8481203448f, 0.5285020015f, 0.8489320552f,
+  0.5271991348f, 0.8497417680f, 0.5258950275f, 0.8505494813f,
+  0.5245896827f, 0.8513551931f, 0.5232831035f, 0.8521589016f,
+  0.5219752929f, 0.8529606049f, 0.5206662541f, 0.8537603011f,
+  0.5193559902f, 0.8545579884f, 0.5180445041f, 0.8553536647f,
+  0.5167317990f, 0.8561473284f, 0.5154178780f, 0.8569389774f,
+  0.5141027442f, 0.8577286100f, 0.5127864006f, 0.8585162243f,
+  0.5114688504f, 0.8593018184f, 0.5101500967f, 0.8600853904f,
+  0.5088301425f, 0.8608669386f, 0.5075089911f, 0.8616464611f,
+  0.5061866453f, 0.8624239561f, 0.5048631085f, 0.8631994217f,
+  0.5035383837f, 0.8639728561f, 0.5022124740f, 0.8647442575f,
+  0.5008853826f, 0.8655136241f, 0.4995571125f, 0.8662809540f,
+  0.4982276670f, 0.8670462455f, 0.4968970490f, 0.8678094968f,
+  0.4955652618f, 0.8685707060f, 0.4942323085f, 0.8693298713f,
+  0.4928981922f, 0.8700869911f, 0.4915629161f, 0.8708420635f,
+  0.4902264833f, 0.8715950867f, 0.4888888969f, 0.8723460589f,
+  0.4875501601f, 0.8730949784f, 0.4862102761f, 0.8738418435f,
+  0.4848692480f, 0.8745866523f, 0.4835270789f, 0.8753294031f,
+  0.4821837721f, 0.8760700942f, 0.4808393306f, 0.8768087238f,
+  0.4794937577f, 0.8775452902f, 0.4781470564f, 0.8782797917f,
+  0.4767992301f, 0.8790122264f, 0.4754502817f, 0.8797425928f,
+  0.4741002147f, 0.8804708891f, 0.4727490320f, 0.8811971135f,
+  0.4713967368f, 0.8819212643f, 0.4700433325f, 0.8826433400f,
+  0.4686888220f, 0.8833633387f, 0.4673332087f, 0.8840812587f,
+  0.4659764958f, 0.8847970984f, 0.4646186863f, 0.8855108561f,
+  0.4632597836f, 0.8862225301f, 0.4618997907f, 0.8869321188f,
+  0.4605387110f, 0.8876396204f, 0.4591765475f, 0.8883450333f,
+  0.4578133036f, 0.8890483559f, 0.4564489824f, 0.8897495864f,
+  0.4550835871f, 0.8904487232f, 0.4537171210f, 0.8911457648f,
+  0.4523495872f, 0.8918407094f, 0.4509809890f, 0.8925335554f,
+  0.4496113297f, 0.8932243012f, 0.4482406123f, 0.8939129451f,
+  0.4468688402f, 0.8945994856f, 0.4454960165f, 0.8952839210f,
+  0.4441221446f, 0.8959662498f, 0.4427472276f, 0.8966464702f,
+  0.4413712687f, 0.8973245807f, 0.4399942713f, 0.8980005797f,
+  0.4386162385f, 0.8986744657f, 0.4372371737f, 0.8993462370f,
+  0.4358570799f, 0.9000158920f, 0.4344759606f, 0.9006834292f,
+  0.4330938189f, 0.9013488470f, 0.4317106580f, 0.9020121439f,
+  0.4303264813f, 0.9026733182f, 0.4289412921f, 0.9033323685f,
+  0.4275550934f, 0.9039892931f, 0.4261678887f, 0.9046440906f,
+  0.4247796812f, 0.9052967593f, 0.4233904741f, 0.9059472978f,
+  0.4220002708f, 0.9065957045f, 0.4206090744f, 0.9072419779f,
+  0.4192168884f, 0.9078861165f, 0.4178237158f, 0.9085281187f,
+  0.4164295601f, 0.9091679831f, 0.4150344245f, 0.9098057081f,
+  0.4136383122f, 0.9104412923f, 0.4122412267f, 0.9110747341f,
+  0.4108431711f, 0.9117060320f, 0.4094441487f, 0.9123351846f,
+  0.4080441629f, 0.9129621904f, 0.4066432169f, 0.9135870479f,
+  0.4052413140f, 0.9142097557f, 0.4038384576f, 0.9148303122f,
+  0.4024346509f, 0.9154487161f, 0.4010298972f, 0.9160649658f,
+  0.3996241998f, 0.9166790599f, 0.3982175622f, 0.9172909970f,
+  0.3968099874f, 0.9179007756f, 0.3954014789f, 0.9185083943f,
+  0.3939920401f, 0.9191138517f, 0.3925816741f, 0.9197171463f,
+  0.3911703843f, 0.9203182767f, 0.3897581741f, 0.9209172415f,
+  0.3883450467f, 0.9215140393f, 0.3869310055f, 0.9221086687f,
+  0.3855160538f, 0.9227011283f, 0.3841001950f, 0.9232914167f,
+  0.3826834324f, 0.9238795325f, 0.3812657692f, 0.9244654743f,
+  0.3798472089f, 0.9250492408f, 0.3784277548f, 0.9256308305f,
+  0.3770074102f, 0.9262102421f, 0.3755861785f, 0.9267874743f,
+  0.3741640630f, 0.9273625257f, 0.3727410670f, 0.9279353948f,
+  0.3713171940f, 0.9285060805f, 0.3698924471f, 0.9290745813f,
+  0.3684668300f, 0.9296408958f, 0.3670403457f, 0.9302050229f,
+  0.3656129978f, 0.9307669611f, 0.3641847896f, 0.9313267091f,
+  0.3627557244f, 0.9318842656f, 0.3613258056f, 0.9324396293f,
+  0.3598950365f, 0.9329927988f, 0.3584634206f, 0.9335437730f,
+  0.3570309612f, 0.9340925504f, 0.3555976617f, 0.9346391298f,
+  0.3541635254f, 0.9351835099f, 0.3527285558f, 0.9357256895f,
+  0.3512927561f, 0.9362656672f, 0.3498561298f, 0.9368034417f,
+  0.3484186802f, 0.9373390119f, 0.3469804108f, 0.9378723764f,
+  0.3455413250f, 0.9384035341f, 0.3441014260f, 0.9389324835f,
+  0.3426607173f, 0.9394592236f, 0.3412192023f, 0.9399837530f,
+  0.3397768844f, 0.9405060706f, 0.3383337670f, 0.9410261751f,
+  0.3368898534f, 0.9415440652f, 0.3354451471f, 0.9420597398f,
+  0.3339996514f, 0.9425731976f, 0.3325533699f, 0.9430844375f,
+  0.3311063058f, 0.9435934582f, 0.3296584625f, 0.9441002585f,
+  0.3282098436f, 0.9446048373f, 0.3267604523f, 0.9451071933f,
+  0.3253102922f, 0.9456073254f, 0.3238593665f, 0.9461052324f,
+  0.3224076788f, 0.9466009131f, 0.3209552324f, 0.9470943664f,
+  0.3195020308f, 0.9475855910f, 0.3180480774f, 0.9480745859f,
+  0.3165933756f, 0.9485613499f, 0.3151379288f, 0.9490458819f,
+  0.3136817404f, 0.9495281806f, 0.3122248139f, 0.9500082450f,
+  0.3107671527f, 0.9504860739f, 0.3093087603f, 0.9509616663f,
+  0.3078496400f, 0.9514350210f, 0.3063897954f, 0.9519061368f,
+  0.3049292297f, 0.9523750127f, 0.3034679466f, 0.9528416476f,
+  0.3020059493f, 0.9533060404f, 0.3005432414f, 0.9537681899f,
+  0.2990798263f, 0.9542280951f, 0.2976157074f, 0.9546857549f,
+  0.2961508882f, 0.9551411683f, 0.2946853722f, 0.9555943341f,
+  0.2932191627f, 0.9560452513f, 0.2917522632f, 0.9564939189f,
+  0.2902846773f, 0.9569403357f, 0.2888164082f, 0.9573845008f,
+  0.2873474595f, 0.9578264130f, 0.2858778347f, 0.9582660714f,
+  0.2844075372f, 0.9587034749f, 0.2829365705f, 0.9591386225f,
+  0.2814649379f, 0.9595715131f, 0.2799926431f, 0.9600021457f,
+  0.2785196894f, 0.9604305194f, 0.2770460803f, 0.9608566331f,
+  0.2755718193f, 0.9612804858f, 0.2740969099f, 0.9617020765f,
+  0.2726213554f, 0.9621214043f, 0.2711451595f, 0.9625384680f,
+  0.2696683256f, 0.9629532669f, 0.2681908571f, 0.9633657998f,
+  0.2667127575f, 0.9637760658f, 0.2652340303f, 0.9641840640f,
+  0.2637546790f, 0.9645897933f, 0.2622747070f, 0.9649932529f,
+  0.2607941179f, 0.9653944417f, 0.2593129151f, 0.9657933589f,
+  0.2578311022f, 0.9661900034f, 0.2563486825f, 0.9665843745f,
+  0.2548656596f, 0.9669764710f, 0.2533820370f, 0.9673662922f,
+  0.2518978182f, 0.9677538371f, 0.2504130066f, 0.9681391047f,
+  0.2489276057f, 0.9685220943f, 0.2474416192f, 0.9689028048f,
+  0.2459550503f, 0.9692812354f, 0.2444679027f, 0.9696573851f,
+  0.2429801799f, 0.9700312532f, 0.2414918853f, 0.9704028387f,
+  0.2400030224f, 0.9707721407f, 0.2385135948f, 0.9711391584f,
+  0.2370236060f, 0.9715038910f, 0.2355330594f, 0.9718663375f,
+  0.2340419586f, 0.9722264971f, 0.2325503070f, 0.9725843689f,
+  0.2310581083f, 0.9729399522f, 0.2295653658f, 0.9732932461f,
+  0.2280720832f, 0.9736442497f, 0.2265782638f, 0.9739929622f,
+  0.2250839114f, 0.9743393828f, 0.2235890292f, 0.9746835107f,
+  0.2220936210f, 0.9750253451f, 0.2205976901f, 0.9753648851f,
+  0.2191012402f, 0.9757021300f, 0.2176042746f, 0.9760370790f,
+  0.2161067971f, 0.9763697313f, 0.2146088110f, 0.9767000861f,
+  0.2131103199f, 0.9770281427f, 0.2116113274f, 0.9773539001f,
+  0.2101118369f, 0.9776773578f, 0.2086118520f, 0.9779985149f,
+  0.2071113762f, 0.9783173707f, 0.2056104131f, 0.9786339244f,
+  0.2041089661f, 0.9789481753f, 0.2026070388f, 0.9792601226f,
+  0.2011046348f, 0.9795697657f, 0.1996017576f, 0.9798771037f,
+  0.1980984107f, 0.9801821360f, 0.1965945977f, 0.9804848618f,
+  0.1950903220f, 0.9807852804f, 0.1935855873f, 0.9810833912f,
+  0.1920803970f, 0.9813791933f, 0.1905747548f, 0.9816726862f,
+  0.1890686641f, 0.9819638691f, 0.1875621286f, 0.9822527414f,
+  0.1860551517f, 0.9825393023f, 0.1845477369f, 0.9828235512f,
+  0.1830398880f, 0.9831054874f, 0.1815316083f, 0.9833851103f,
+  0.1800229014f, 0.9836624192f, 0.1785137709f, 0.9839374134f,
+  0.1770042204f, 0.9842100924f, 0.1754942534f, 0.9844804554f,
+  0.1739838734f, 0.9847485018f, 0.1724730840f, 0.9850142310f,
+  0.1709618888f, 0.9852776424f, 0.1694502912f, 0.9855387353f,
+  0.1679382950f, 0.9857975092f, 0.1664259035f, 0.9860539633f,
+  0.1649131205f, 0.9863080972f, 0.1633999494f, 0.9865599103f,
+  0.1618863938f, 0.9868094018f, 0.1603724572f, 0.9870565713f,
+  0.1588581433f, 0.9873014182f, 0.1573434556f, 0.9875439418f,
+  0.1558283977f, 0.9877841416f, 0.1543129730f, 0.9880220171f,
+  0.1527971853f, 0.9882575677f, 0.1512810380f, 0.9884907929f,
+  0.1497645347f, 0.9887216920f, 0.1482476790f, 0.9889502645f,
+  0.1467304745f, 0.9891765100f, 0.1452129247f, 0.9894004278f,
+  0.1436950332f, 0.9896220175f, 0.1421768035f, 0.9898412785f,
+  0.1406582393f, 0.9900582103f, 0.1391393442f, 0.9902728124f,
+  0.1376201216f, 0.9904850843f, 0.1361005752f, 0.9906950254f,
+  0.1345807085f, 0.9909026354f, 0.1330605252f, 0.9911079137f,
+  0.1315400287f, 0.9913108598f, 0.1300192227f, 0.9915114733f,
+  0.1284981108f, 0.9917097537f, 0.1269766965f, 0.9919057004f,
+  0.1254549834f, 0.9920993131f, 0.1239329751f, 0.9922905913f,
+  0.1224106752f, 0.9924795346f, 0.1208880872f, 0.9926661424f,
+  0.1193652148f, 0.9928504145f, 0.1178420615f, 0.9930323502f,
+  0.1163186309f, 0.9932119492f, 0.1147949266f, 0.9933892111f,
+  0.1132709522f, 0.9935641355f, 0.1117467112f, 0.9937367219f,
+  0.1102222073f, 0.9939069700f, 0.1086974440f, 0.9940748793f,
+  0.1071724250f, 0.9942404495f, 0.1056471537f, 0.9944036801f,
+  0.1041216339f, 0.9945645707f, 0.1025958690f, 0.9947231211f,
+  0.1010698628f, 0.9948793308f, 0.0995436187f, 0.9950331994f,
+  0.0980171403f, 0.9951847267f, 0.0964904314f, 0.9953339121f,
+  0.0949634953f, 0.9954807555f, 0.0934363358f, 0.9956252564f,
+  0.0919089565f, 0.9957674145f, 0.0903813609f, 0.9959072294f,
+  0.0888535526f, 0.9960447009f, 0.0873255352f, 0.9961798286f,
+  0.0857973123f, 0.9963126122f, 0.0842688876f, 0.9964430514f,
+  0.0827402645f, 0.9965711458f, 0.0812114468f, 0.9966968952f,
+  0.0796824380f, 0.9968202993f, 0.0781532416f, 0.9969413578f,
+  0.0766238614f, 0.9970600703f, 0.0750943008f, 0.9971764367f,
+  0.0735645636f, 0.9972904567f, 0.0720346532f, 0.9974021299f,
+  0.0705045734f, 0.9975114561f, 0.0689743276f, 0.9976184351f,
+  0.0674439196f, 0.9977230666f, 0.0659133528f, 0.9978253504f,
+  0.0643826309f, 0.9979252862f, 0.0628517576f, 0.9980228738f,
+  0.0613207363f, 0.9981181129f, 0.0597895707f, 0.9982110034f,
+  0.0582582645f, 0.9983015449f, 0.0567268212f, 0.9983897374f,
+  0.0551952443f, 0.9984755806f, 0.0536635377f, 0.9985590742f,
+  0.0521317047f, 0.9986402182f, 0.0505997490f, 0.9987190122f,
+  0.0490676743f, 0.9987954562f, 0.0475354842f, 0.9988695499f,
+  0.0460031821f, 0.9989412932f, 0.0444707719f, 0.9990106859f,
+  0.0429382569f, 0.9990777278f, 0.0414056410f, 0.9991424187f,
+  0.0398729276f, 0.9992047586f, 0.0383401204f, 0.9992647473f,
+  0.0368072229f, 0.9993223846f, 0.0352742389f, 0.9993776704f,
+  0.0337411719f, 0.9994306046f, 0.0322080254f, 0.9994811870f,
+  0.0306748032f, 0.9995294175f, 0.0291415088f, 0.9995752960f,
+  0.0276081458f, 0.9996188225f, 0.0260747178f, 0.9996599967f,
+  0.0245412285f, 0.9996988187f, 0.0230076815f, 0.9997352883f,
+  0.0214740803f, 0.9997694054f, 0.0199404286f, 0.9998011699f,
+  0.0184067299f, 0.9998305818f, 0.0168729879f, 0.9998576410f,
+  0.0153392063f, 0.9998823475f, 0.0138053885f, 0.9999047011f,
+  0.0122715383f, 0.9999247018f, 0.0107376592f, 0.9999423497f,
+  0.0092037548f, 0.9999576446f, 0.0076698287f, 0.9999705864f,
+  0.0061358846f, 0.9999811753f, 0.0046019261f, 0.9999894111f,
+  0.0030679568f, 0.9999952938f, 0.0015339802f, 0.9999988235f
+};
+#endif
+
+/**
+ * @} end of CFFT_CIFFT group
+ */
@@ -61,7 +61,7 @@
 *   y[l] = y[l] >> 1;    
 *  } </pre>    
 * \par    
-* where N = 4096	logN2 = 12   
+* where N = ARM_MATH_MAX_FFT_LEN (4096 by default) and logN2 = log2(N)   
 * \par    
 * N is the maximum FFT Size supported    
 */
@@ -69,6 +69,7 @@
 /*    
 * @brief  Table for bit reversal process    
 */
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
 const uint16_t armBitRevTable[1024] = {
   0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700,
   0x80, 0x480, 0x280, 0x680, 0x180, 0x580, 0x380,
@@ -218,6 +219,62 @@ const uint16_t armBitRevTable[1024] = {
   0xfe, 0x4fe, 0x2fe, 0x6fe, 0x1fe, 0x5fe, 0x3fe,
   0x7fe, 0x1
 };
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+const uint16_t armBitRevTable[256] = {
+  0x100, 0x80, 0x180, 0x40, 0x140, 0xc0, 0x1c0, 0x20,
+  0x120, 0xa0, 0x1a0, 0x60, 0x160, 0xe0, 0x1e0, 0x10,
+  0x110, 0x90, 0x190, 0x50, 0x150, 0xd0, 0x1d0, 0x30,
+  0x130, 0xb0, 0x1b0, 0x70, 0x170, 0xf0, 0x1f0, 0x8,
+  0x108, 0x88, 0x188, 0x48, 0x148, 0xc8, 0x1c8, 0x28,
+  0x128, 0xa8, 0x1a8, 0x68, 0x168, 0xe8, 0x1e8, 0x18,
+  0x118, 0x98, 0x198, 0x58, 0x158, 0xd8, 0x1d8, 0x38,
+  0x138, 0xb8, 0x1b8, 0x78, 0x178, 0xf8, 0x1f8, 0x4,
+  0x104, 0x84, 0x184, 0x44, 0x144, 0xc4, 0x1c4, 0x24,
+  0x124, 0xa4, 0x1a4, 0x64, 0x164, 0xe4, 0x1e4, 0x14,
+  0x114, 0x94, 0x194, 0x54, 0x154, 0xd4, 0x1d4, 0x34,
+  0x134, 0xb4, 0x1b4, 0x74, 0x174, 0xf4, 0x1f4, 0xc,
+  0x10c, 0x8c, 0x18c, 0x4c, 0x14c, 0xcc, 0x1cc, 0x2c,
+  0x12c, 0xac, 0x1ac, 0x6c, 0x16c, 0xec, 0x1ec, 0x1c,
+  0x11c, 0x9c, 0x19c, 0x5c, 0x15c, 0xdc, 0x1dc, 0x3c,
+  0x13c, 0xbc, 0x1bc, 0x7c, 0x17c, 0xfc, 0x1fc, 0x2,
+  0x102, 0x82, 0x182, 0x42, 0x142, 0xc2, 0x1c2, 0x22,
+  0x122, 0xa2, 0x1a2, 0x62, 0x162, 0xe2, 0x1e2, 0x12,
+  0x112, 0x92, 0x192, 0x52, 0x152, 0xd2, 0x1d2, 0x32,
+  0x132, 0xb2, 0x1b2, 0x72, 0x172, 0xf2, 0x1f2, 0xa,
+  0x10a, 0x8a, 0x18a, 0x4a, 0x14a, 0xca, 0x1ca, 0x2a,
+  0x12a, 0xaa, 0x1aa, 0x6a, 0x16a, 0xea, 0x1ea, 0x1a,
+  0x11a, 0x9a, 0x19a, 0x5a, 0x15a, 0xda, 0x1da, 0x3a,
+  0x13a, 0xba, 0x1ba, 0x7a, 0x17a, 0xfa, 0x1fa, 0x6,
+  0x106, 0x86, 0x186, 0x46, 0x146, 0xc6, 0x1c6, 0x26,
+  0x126, 0xa6, 0x1a6, 0x66, 0x166, 0xe6, 0x1e6, 0x16,
+  0x116, 0x96, 0x196, 0x56, 0x156, 0xd6, 0x1d6, 0x36,
+  0x136, 0xb6, 0x1b6, 0x76, 0x176, 0xf6, 0x1f6, 0xe,
+  0x10e, 0x8e, 0x18e, 0x4e, 0x14e, 0xce, 0x1ce, 0x2e,
+  0x12e, 0xae, 0x1ae, 0x6e, 0x16e, 0xee, 0x1ee, 0x1e,
+  0x11e, 0x9e, 0x19e, 0x5e, 0x15e, 0xde, 0x1de, 0x3e,
+  0x13e, 0xbe, 0x1be, 0x7e, 0x17e, 0xfe, 0x1fe, 0x1
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+const uint16_t armBitRevTable[64] = {
+  0x40, 0x20, 0x60, 0x10, 0x50, 0x30, 0x70, 0x8,
+  0x48, 0x28, 0x68, 0x18, 0x58, 0x38, 0x78, 0x4,
+  0x44, 0x24, 0x64, 0x14, 0x54, 0x34, 0x74, 0xc,
+  0x4c, 0x2c, 0x6c, 0x1c, 0x5c, 0x3c, 0x7c, 0x2,
+  0x42, 0x22, 0x62, 0x12, 0x52, 0x32, 0x72, 0xa,
+  0x4a, 0x2a, 0x6a, 0x1a, 0x5a, 0x3a, 0x7a, 0x6,
+  0x46, 0x26, 0x66, 0x16, 0x56, 0x36, 0x76, 0xe,
+  0x4e, 0x2e, 0x6e, 0x1e, 0x5e, 0x3e, 0x7e, 0x1
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+const uint16_t armBitRevTable[16] = {
+  0x10, 0x8, 0x18, 0x4, 0x14, 0xc, 0x1c, 0x2,
+  0x12, 0xa, 0x1a, 0x6, 0x16, 0xe, 0x1e, 0x1
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 16)
+const uint16_t armBitRevTable[4] = {
+  0x4, 0x2, 0x6, 0x1
+};
+#endif
 
 
 /*    
@@ -235,11 +292,12 @@ const uint16_t armBitRevTable[1024] = {
 *	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
 * } </pre>    
 * \par    
-* where N = 4096	and PI = 3.14159265358979    
+* where N = ARM_MATH_MAX_FFT_LEN (4096 by default) and PI = 3.14159265358979    
 * \par    
 * Cos and Sin values are in interleaved fashion    
 *     
 */
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
 const float32_t twiddleCoef[6144] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999998823451701880f,
     0.001533980186284766f, 0.999995293809576190f, 0.003067956762965976f,
@@ -2290,6 +2348,699 @@ const float32_t twiddleCoef[6144] = {
   -0.004601926120448350f, -0.999989411081928400f, -0.003067956762966483f,
     -0.999995293809576190f, -0.001533980186285111f, -0.999998823451701880f,
 };
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+const float32_t twiddleCoef[1536] = {
+  1.000000000000000000f, 0.000000000000000000f, 0.999981175282601110f,
+  0.006135884649154475f, 0.999924701839144500f, 0.012271538285719925f,
+  0.999830581795823400f, 0.018406729905804820f, 0.999698818696204250f,
+  0.024541228522912288f, 0.999529417501093140f, 0.030674803176636626f,
+  0.999322384588349540f, 0.036807222941358832f, 0.999077727752645360f,
+  0.042938256934940820f, 0.998795456205172410f, 0.049067674327418015f,
+  0.998475580573294770f, 0.055195244349689934f, 0.998118112900149180f,
+  0.061320736302208578f, 0.997723066644191640f, 0.067443919563664051f,
+  0.997290456678690210f, 0.073564563599667426f, 0.996820299291165670f,
+  0.079682437971430126f, 0.996312612182778000f, 0.085797312344439894f,
+  0.995767414467659820f, 0.091908956497132724f, 0.995184726672196930f,
+  0.098017140329560604f, 0.994564570734255420f, 0.104121633872054590f,
+  0.993906970002356060f, 0.110222207293883060f, 0.993211949234794500f,
+  0.116318630911904750f, 0.992479534598709970f, 0.122410675199216200f,
+  0.991709753669099530f, 0.128498110793793170f, 0.990902635427780010f,
+  0.134580708507126170f, 0.990058210262297120f, 0.140658239332849210f,
+  0.989176509964781010f, 0.146730474455361750f, 0.988257567730749460f,
+  0.152797185258443440f, 0.987301418157858430f, 0.158858143333861450f,
+  0.986308097244598670f, 0.164913120489969890f, 0.985277642388941220f,
+  0.170961888760301220f, 0.984210092386929030f, 0.177004220412148750f,
+  0.983105487431216290f, 0.183039887955140950f, 0.981963869109555240f,
+  0.189068664149806190f, 0.980785280403230430f, 0.195090322016128250f,
+  0.979569765685440520f, 0.201104634842091900f, 0.978317370719627650f,
+  0.207111376192218560f, 0.977028142657754390f, 0.213110319916091360f,
+  0.975702130038528570f, 0.219101240156869800f, 0.974339382785575860f,
+  0.225083911359792830f, 0.972939952205560180f, 0.231058108280671110f,
+  0.971503890986251780f, 0.237023605994367200f, 0.970031253194543970f,
+  0.242980179903263870f, 0.968522094274417380f, 0.248927605745720150f,
+  0.966976471044852070f, 0.254865659604514570f, 0.965394441697689400f,
+  0.260794117915275510f, 0.963776065795439840f, 0.266712757474898370f,
+  0.962121404269041580f, 0.272621355449948980f, 0.960430519415565790f,
+  0.278519689385053060f, 0.958703474895871600f, 0.284407537211271880f,
+  0.956940335732208820f, 0.290284677254462330f, 0.955141168305770780f,
+  0.296150888243623790f, 0.953306040354193860f, 0.302005949319228080f,
+  0.951435020969008340f, 0.307849640041534870f, 0.949528180593036670f,
+  0.313681740398891520f, 0.947585591017741090f, 0.319502030816015690f,
+  0.945607325380521280f, 0.325310292162262930f, 0.943593458161960390f,
+  0.331106305759876430f, 0.941544065183020810f, 0.336889853392220050f,
+  0.939459223602189920f, 0.342660717311994380f, 0.937339011912574960f,
+  0.348418680249434560f, 0.935183509938947610f, 0.354163525420490340f,
+  0.932992798834738960f, 0.359895036534988110f, 0.930766961078983710f,
+  0.365612997804773850f, 0.928506080473215590f, 0.371317193951837540f,
+  0.926210242138311380f, 0.377007410216418260f, 0.923879532511286740f,
+  0.382683432365089780f, 0.921514039342042010f, 0.388345046698826250f,
+  0.919113851690057770f, 0.393992040061048100f, 0.916679059921042700f,
+  0.399624199845646790f, 0.914209755703530690f, 0.405241314004989860f,
+  0.911706032005429880f, 0.410843171057903910f, 0.909167983090522380f,
+  0.416429560097637150f, 0.906595704514915330f, 0.422000270799799680f,
+  0.903989293123443340f, 0.427555093430282080f, 0.901348847046022030f,
+  0.433093818853151960f, 0.898674465693953820f, 0.438616238538527660f,
+  0.895966249756185220f, 0.444122144570429200f, 0.893224301195515320f,
+  0.449611329654606540f, 0.890448723244757880f, 0.455083587126343840f,
+  0.887639620402853930f, 0.460538710958240010f, 0.884797098430937790f,
+  0.465976495767966180f, 0.881921264348355050f, 0.471396736825997640f,
+  0.879012226428633530f, 0.476799230063322090f, 0.876070094195406600f,
+  0.482183772079122720f, 0.873094978418290090f, 0.487550160148436000f,
+  0.870086991108711460f, 0.492898192229784040f, 0.867046245515692650f,
+  0.498227666972781870f, 0.863972856121586810f, 0.503538383725717580f,
+  0.860866938637767310f, 0.508830142543106990f, 0.857728610000272120f,
+  0.514102744193221660f, 0.854557988365400530f, 0.519355990165589640f,
+  0.851355193105265200f, 0.524589682678468950f, 0.848120344803297230f,
+  0.529803624686294610f, 0.844853565249707120f, 0.534997619887097150f,
+  0.841554977436898440f, 0.540171472729892850f, 0.838224705554838080f,
+  0.545324988422046460f, 0.834862874986380010f, 0.550457972936604810f,
+  0.831469612302545240f, 0.555570233019602180f, 0.828045045257755800f,
+  0.560661576197336030f, 0.824589302785025290f, 0.565731810783613120f,
+  0.821102514991104650f, 0.570780745886967260f, 0.817584813151583710f,
+  0.575808191417845340f, 0.814036329705948410f, 0.580813958095764530f,
+  0.810457198252594770f, 0.585797857456438860f, 0.806847553543799330f,
+  0.590759701858874160f, 0.803207531480644940f, 0.595699304492433360f,
+  0.799537269107905010f, 0.600616479383868970f, 0.795836904608883570f,
+  0.605511041404325550f, 0.792106577300212390f, 0.610382806276309480f,
+  0.788346427626606340f, 0.615231590580626820f, 0.784556597155575240f,
+  0.620057211763289100f, 0.780737228572094490f, 0.624859488142386340f,
+  0.776888465673232440f, 0.629638238914926980f, 0.773010453362736990f,
+  0.634393284163645490f, 0.769103337645579700f, 0.639124444863775730f,
+  0.765167265622458960f, 0.643831542889791390f, 0.761202385484261780f,
+  0.648514401022112440f, 0.757208846506484570f, 0.653172842953776760f,
+  0.753186799043612520f, 0.657806693297078640f, 0.749136394523459370f,
+  0.662415777590171780f, 0.745057785441466060f, 0.666999922303637470f,
+  0.740951125354959110f, 0.671558954847018330f, 0.736816568877369900f,
+  0.676092703575315920f, 0.732654271672412820f, 0.680600997795453020f,
+  0.728464390448225200f, 0.685083667772700360f, 0.724247082951467000f,
+  0.689540544737066830f, 0.720002507961381650f, 0.693971460889654000f,
+  0.715730825283818590f, 0.698376249408972920f, 0.711432195745216430f,
+  0.702754744457225300f, 0.707106781186547570f, 0.707106781186547460f,
+  0.702754744457225300f, 0.711432195745216430f, 0.698376249408972920f,
+  0.715730825283818590f, 0.693971460889654000f, 0.720002507961381650f,
+  0.689540544737066940f, 0.724247082951466890f, 0.685083667772700360f,
+  0.728464390448225200f, 0.680600997795453130f, 0.732654271672412820f,
+  0.676092703575316030f, 0.736816568877369790f, 0.671558954847018330f,
+  0.740951125354959110f, 0.666999922303637470f, 0.745057785441465950f,
+  0.662415777590171780f, 0.749136394523459260f, 0.657806693297078640f,
+  0.753186799043612410f, 0.653172842953776760f, 0.757208846506484460f,
+  0.648514401022112550f, 0.761202385484261780f, 0.643831542889791500f,
+  0.765167265622458960f, 0.639124444863775730f, 0.769103337645579590f,
+  0.634393284163645490f, 0.773010453362736990f, 0.629638238914927100f,
+  0.776888465673232440f, 0.624859488142386450f, 0.780737228572094380f,
+  0.620057211763289210f, 0.784556597155575240f, 0.615231590580626820f,
+  0.788346427626606230f, 0.610382806276309480f, 0.792106577300212390f,
+  0.605511041404325550f, 0.795836904608883460f, 0.600616479383868970f,
+  0.799537269107905010f, 0.595699304492433470f, 0.803207531480644830f,
+  0.590759701858874280f, 0.806847553543799220f, 0.585797857456438860f,
+  0.810457198252594770f, 0.580813958095764530f, 0.814036329705948300f,
+  0.575808191417845340f, 0.817584813151583710f, 0.570780745886967370f,
+  0.821102514991104650f, 0.565731810783613230f, 0.824589302785025290f,
+  0.560661576197336030f, 0.828045045257755800f, 0.555570233019602290f,
+  0.831469612302545240f, 0.550457972936604810f, 0.834862874986380010f,
+  0.545324988422046460f, 0.838224705554837970f, 0.540171472729892970f,
+  0.841554977436898330f, 0.534997619887097260f, 0.844853565249707010f,
+  0.529803624686294830f, 0.848120344803297120f, 0.524589682678468840f,
+  0.851355193105265200f, 0.519355990165589530f, 0.854557988365400530f,
+  0.514102744193221660f, 0.857728610000272120f, 0.508830142543106990f,
+  0.860866938637767310f, 0.503538383725717580f, 0.863972856121586700f,
+  0.498227666972781870f, 0.867046245515692650f, 0.492898192229784090f,
+  0.870086991108711350f, 0.487550160148436050f, 0.873094978418290090f,
+  0.482183772079122830f, 0.876070094195406600f, 0.476799230063322250f,
+  0.879012226428633410f, 0.471396736825997810f, 0.881921264348354940f,
+  0.465976495767966130f, 0.884797098430937790f, 0.460538710958240010f,
+  0.887639620402853930f, 0.455083587126343840f, 0.890448723244757880f,
+  0.449611329654606600f, 0.893224301195515320f, 0.444122144570429260f,
+  0.895966249756185110f, 0.438616238538527710f, 0.898674465693953820f,
+  0.433093818853152010f, 0.901348847046022030f, 0.427555093430282200f,
+  0.903989293123443340f, 0.422000270799799790f, 0.906595704514915330f,
+  0.416429560097637320f, 0.909167983090522270f, 0.410843171057903910f,
+  0.911706032005429880f, 0.405241314004989860f, 0.914209755703530690f,
+  0.399624199845646790f, 0.916679059921042700f, 0.393992040061048100f,
+  0.919113851690057770f, 0.388345046698826300f, 0.921514039342041900f,
+  0.382683432365089840f, 0.923879532511286740f, 0.377007410216418310f,
+  0.926210242138311270f, 0.371317193951837600f, 0.928506080473215480f,
+  0.365612997804773960f, 0.930766961078983710f, 0.359895036534988280f,
+  0.932992798834738850f, 0.354163525420490510f, 0.935183509938947500f,
+  0.348418680249434510f, 0.937339011912574960f, 0.342660717311994380f,
+  0.939459223602189920f, 0.336889853392220050f, 0.941544065183020810f,
+  0.331106305759876430f, 0.943593458161960390f, 0.325310292162262980f,
+  0.945607325380521280f, 0.319502030816015750f, 0.947585591017741090f,
+  0.313681740398891570f, 0.949528180593036670f, 0.307849640041534980f,
+  0.951435020969008340f, 0.302005949319228200f, 0.953306040354193750f,
+  0.296150888243623960f, 0.955141168305770670f, 0.290284677254462330f,
+  0.956940335732208940f, 0.284407537211271820f, 0.958703474895871600f,
+  0.278519689385053060f, 0.960430519415565790f, 0.272621355449948980f,
+  0.962121404269041580f, 0.266712757474898420f, 0.963776065795439840f,
+  0.260794117915275570f, 0.965394441697689400f, 0.254865659604514630f,
+  0.966976471044852070f, 0.248927605745720260f, 0.968522094274417270f,
+  0.242980179903263980f, 0.970031253194543970f, 0.237023605994367340f,
+  0.971503890986251780f, 0.231058108280671280f, 0.972939952205560070f,
+  0.225083911359792780f, 0.974339382785575860f, 0.219101240156869770f,
+  0.975702130038528570f, 0.213110319916091360f, 0.977028142657754390f,
+  0.207111376192218560f, 0.978317370719627650f, 0.201104634842091960f,
+  0.979569765685440520f, 0.195090322016128330f, 0.980785280403230430f,
+  0.189068664149806280f, 0.981963869109555240f, 0.183039887955141060f,
+  0.983105487431216290f, 0.177004220412148860f, 0.984210092386929030f,
+  0.170961888760301360f, 0.985277642388941220f, 0.164913120489970090f,
+  0.986308097244598670f, 0.158858143333861390f, 0.987301418157858430f,
+  0.152797185258443410f, 0.988257567730749460f, 0.146730474455361750f,
+  0.989176509964781010f, 0.140658239332849240f, 0.990058210262297120f,
+  0.134580708507126220f, 0.990902635427780010f, 0.128498110793793220f,
+  0.991709753669099530f, 0.122410675199216280f, 0.992479534598709970f,
+  0.116318630911904880f, 0.993211949234794500f, 0.110222207293883180f,
+  0.993906970002356060f, 0.104121633872054730f, 0.994564570734255420f,
+  0.098017140329560770f, 0.995184726672196820f, 0.091908956497132696f,
+  0.995767414467659820f, 0.085797312344439880f, 0.996312612182778000f,
+  0.079682437971430126f, 0.996820299291165670f, 0.073564563599667454f,
+  0.997290456678690210f, 0.067443919563664106f, 0.997723066644191640f,
+  0.061320736302208648f, 0.998118112900149180f, 0.055195244349690031f,
+  0.998475580573294770f, 0.049067674327418126f, 0.998795456205172410f,
+  0.042938256934940959f, 0.999077727752645360f, 0.036807222941358991f,
+  0.999322384588349540f, 0.030674803176636581f, 0.999529417501093140f,
+  0.024541228522912264f, 0.999698818696204250f, 0.018406729905804820f,
+  0.999830581795823400f, 0.012271538285719944f, 0.999924701839144500f,
+  0.006135884649154515f, 0.999981175282601110f, 0.000000000000000061f,
+  1.000000000000000000f, -0.006135884649154393f, 0.999981175282601110f,
+  -0.012271538285719823f, 0.999924701839144500f, -0.018406729905804695f,
+  0.999830581795823400f, -0.024541228522912142f, 0.999698818696204250f,
+  -0.030674803176636459f, 0.999529417501093140f, -0.036807222941358866f,
+  0.999322384588349540f, -0.042938256934940834f, 0.999077727752645360f,
+  -0.049067674327418008f, 0.998795456205172410f, -0.055195244349689913f,
+  0.998475580573294770f, -0.061320736302208530f, 0.998118112900149180f,
+  -0.067443919563663982f, 0.997723066644191640f, -0.073564563599667329f,
+  0.997290456678690210f, -0.079682437971430015f, 0.996820299291165780f,
+  -0.085797312344439755f, 0.996312612182778000f, -0.091908956497132571f,
+  0.995767414467659820f, -0.098017140329560645f, 0.995184726672196930f,
+  -0.104121633872054600f, 0.994564570734255420f, -0.110222207293883060f,
+  0.993906970002356060f, -0.116318630911904750f, 0.993211949234794500f,
+  -0.122410675199216150f, 0.992479534598709970f, -0.128498110793793110f,
+  0.991709753669099530f, -0.134580708507126110f, 0.990902635427780010f,
+  -0.140658239332849130f, 0.990058210262297120f, -0.146730474455361640f,
+  0.989176509964781010f, -0.152797185258443300f, 0.988257567730749460f,
+  -0.158858143333861280f, 0.987301418157858430f, -0.164913120489969950f,
+  0.986308097244598670f, -0.170961888760301240f, 0.985277642388941220f,
+  -0.177004220412148750f, 0.984210092386929030f, -0.183039887955140920f,
+  0.983105487431216290f, -0.189068664149806160f, 0.981963869109555240f,
+  -0.195090322016128190f, 0.980785280403230430f, -0.201104634842091820f,
+  0.979569765685440520f, -0.207111376192218450f, 0.978317370719627650f,
+  -0.213110319916091250f, 0.977028142657754390f, -0.219101240156869660f,
+  0.975702130038528570f, -0.225083911359792670f, 0.974339382785575860f,
+  -0.231058108280671140f, 0.972939952205560180f, -0.237023605994367230f,
+  0.971503890986251780f, -0.242980179903263870f, 0.970031253194543970f,
+  -0.248927605745720120f, 0.968522094274417380f, -0.254865659604514520f,
+  0.966976471044852070f, -0.260794117915275460f, 0.965394441697689400f,
+  -0.266712757474898310f, 0.963776065795439840f, -0.272621355449948870f,
+  0.962121404269041580f, -0.278519689385052950f, 0.960430519415565900f,
+  -0.284407537211271710f, 0.958703474895871600f, -0.290284677254462160f,
+  0.956940335732208940f, -0.296150888243623840f, 0.955141168305770670f,
+  -0.302005949319228080f, 0.953306040354193860f, -0.307849640041534870f,
+  0.951435020969008340f, -0.313681740398891410f, 0.949528180593036670f,
+  -0.319502030816015640f, 0.947585591017741200f, -0.325310292162262870f,
+  0.945607325380521390f, -0.331106305759876320f, 0.943593458161960390f,
+  -0.336889853392219940f, 0.941544065183020810f, -0.342660717311994270f,
+  0.939459223602189920f, -0.348418680249434400f, 0.937339011912574960f,
+  -0.354163525420490400f, 0.935183509938947610f, -0.359895036534988170f,
+  0.932992798834738850f, -0.365612997804773850f, 0.930766961078983710f,
+  -0.371317193951837490f, 0.928506080473215590f, -0.377007410216418200f,
+  0.926210242138311380f, -0.382683432365089730f, 0.923879532511286740f,
+  -0.388345046698826190f, 0.921514039342042010f, -0.393992040061047990f,
+  0.919113851690057770f, -0.399624199845646680f, 0.916679059921042700f,
+  -0.405241314004989750f, 0.914209755703530690f, -0.410843171057903800f,
+  0.911706032005429880f, -0.416429560097636990f, 0.909167983090522490f,
+  -0.422000270799799680f, 0.906595704514915330f, -0.427555093430281860f,
+  0.903989293123443450f, -0.433093818853151900f, 0.901348847046022030f,
+  -0.438616238538527380f, 0.898674465693953930f, -0.444122144570429140f,
+  0.895966249756185220f, -0.449611329654606710f, 0.893224301195515210f,
+  -0.455083587126343720f, 0.890448723244757990f, -0.460538710958240060f,
+  0.887639620402853930f, -0.465976495767966010f, 0.884797098430937900f,
+  -0.471396736825997700f, 0.881921264348355050f, -0.476799230063321920f,
+  0.879012226428633530f, -0.482183772079122720f, 0.876070094195406600f,
+  -0.487550160148435720f, 0.873094978418290200f, -0.492898192229783980f,
+  0.870086991108711460f, -0.498227666972781590f, 0.867046245515692760f,
+  -0.503538383725717460f, 0.863972856121586810f, -0.508830142543107100f,
+  0.860866938637767200f, -0.514102744193221660f, 0.857728610000272120f,
+  -0.519355990165589640f, 0.854557988365400530f, -0.524589682678468730f,
+  0.851355193105265200f, -0.529803624686294720f, 0.848120344803297230f,
+  -0.534997619887097040f, 0.844853565249707230f, -0.540171472729892850f,
+  0.841554977436898440f, -0.545324988422046240f, 0.838224705554838190f,
+  -0.550457972936604700f, 0.834862874986380120f, -0.555570233019601960f,
+  0.831469612302545460f, -0.560661576197335920f, 0.828045045257755800f,
+  -0.565731810783613230f, 0.824589302785025180f, -0.570780745886967140f,
+  0.821102514991104760f, -0.575808191417845340f, 0.817584813151583710f,
+  -0.580813958095764420f, 0.814036329705948520f, -0.585797857456438860f,
+  0.810457198252594770f, -0.590759701858874050f, 0.806847553543799450f,
+  -0.595699304492433360f, 0.803207531480644940f, -0.600616479383868750f,
+  0.799537269107905240f, -0.605511041404325430f, 0.795836904608883570f,
+  -0.610382806276309590f, 0.792106577300212280f, -0.615231590580626710f,
+  0.788346427626606340f, -0.620057211763289210f, 0.784556597155575130f,
+  -0.624859488142386230f, 0.780737228572094600f, -0.629638238914927100f,
+  0.776888465673232440f, -0.634393284163645380f, 0.773010453362737100f,
+  -0.639124444863775730f, 0.769103337645579590f, -0.643831542889791280f,
+  0.765167265622459070f, -0.648514401022112440f, 0.761202385484261890f,
+  -0.653172842953776530f, 0.757208846506484680f, -0.657806693297078640f,
+  0.753186799043612520f, -0.662415777590171890f, 0.749136394523459260f,
+  -0.666999922303637360f, 0.745057785441466060f, -0.671558954847018440f,
+  0.740951125354958990f, -0.676092703575315810f, 0.736816568877370020f,
+  -0.680600997795453020f, 0.732654271672412820f, -0.685083667772700240f,
+  0.728464390448225310f, -0.689540544737066940f, 0.724247082951466890f,
+  -0.693971460889653780f, 0.720002507961381770f, -0.698376249408972800f,
+  0.715730825283818710f, -0.702754744457225080f, 0.711432195745216660f,
+  -0.707106781186547460f, 0.707106781186547570f, -0.711432195745216540f,
+  0.702754744457225190f, -0.715730825283818590f, 0.698376249408972920f,
+  -0.720002507961381650f, 0.693971460889654000f, -0.724247082951466780f,
+  0.689540544737067050f, -0.728464390448225200f, 0.685083667772700360f,
+  -0.732654271672412700f, 0.680600997795453240f, -0.736816568877369900f,
+  0.676092703575315920f, -0.740951125354958880f, 0.671558954847018550f,
+  -0.745057785441465950f, 0.666999922303637580f, -0.749136394523459150f,
+  0.662415777590172010f, -0.753186799043612410f, 0.657806693297078750f,
+  -0.757208846506484570f, 0.653172842953776640f, -0.761202385484261670f,
+  0.648514401022112550f, -0.765167265622458960f, 0.643831542889791390f,
+  -0.769103337645579480f, 0.639124444863775840f, -0.773010453362736990f,
+  0.634393284163645490f, -0.776888465673232330f, 0.629638238914927210f,
+  -0.780737228572094490f, 0.624859488142386340f, -0.784556597155575020f,
+  0.620057211763289430f, -0.788346427626606230f, 0.615231590580626930f,
+  -0.792106577300212170f, 0.610382806276309700f, -0.795836904608883460f,
+  0.605511041404325660f, -0.799537269107905120f, 0.600616479383868860f,
+  -0.803207531480644830f, 0.595699304492433470f, -0.806847553543799330f,
+  0.590759701858874160f, -0.810457198252594660f, 0.585797857456438980f,
+  -0.814036329705948410f, 0.580813958095764530f, -0.817584813151583600f,
+  0.575808191417845450f, -0.821102514991104650f, 0.570780745886967260f,
+  -0.824589302785025070f, 0.565731810783613450f, -0.828045045257755690f,
+  0.560661576197336140f, -0.831469612302545350f, 0.555570233019602180f,
+  -0.834862874986380010f, 0.550457972936604920f, -0.838224705554838080f,
+  0.545324988422046350f, -0.841554977436898330f, 0.540171472729892970f,
+  -0.844853565249707120f, 0.534997619887097150f, -0.848120344803297120f,
+  0.529803624686294830f, -0.851355193105265200f, 0.524589682678468950f,
+  -0.854557988365400420f, 0.519355990165589750f, -0.857728610000272010f,
+  0.514102744193221770f, -0.860866938637767090f, 0.508830142543107320f,
+  -0.863972856121586700f, 0.503538383725717690f, -0.867046245515692760f,
+  0.498227666972781760f, -0.870086991108711350f, 0.492898192229784150f,
+  -0.873094978418290090f, 0.487550160148435880f, -0.876070094195406490f,
+  0.482183772079122890f, -0.879012226428633530f, 0.476799230063322090f,
+  -0.881921264348354940f, 0.471396736825997860f, -0.884797098430937790f,
+  0.465976495767966180f, -0.887639620402853820f, 0.460538710958240230f,
+  -0.890448723244757880f, 0.455083587126343890f, -0.893224301195515210f,
+  0.449611329654606870f, -0.895966249756185110f, 0.444122144570429310f,
+  -0.898674465693953930f, 0.438616238538527550f, -0.901348847046021920f,
+  0.433093818853152070f, -0.903989293123443340f, 0.427555093430282030f,
+  -0.906595704514915330f, 0.422000270799799850f, -0.909167983090522380f,
+  0.416429560097637150f, -0.911706032005429770f, 0.410843171057904130f,
+  -0.914209755703530690f, 0.405241314004989920f, -0.916679059921042590f,
+  0.399624199845647070f, -0.919113851690057770f, 0.393992040061048150f,
+  -0.921514039342041790f, 0.388345046698826580f, -0.923879532511286740f,
+  0.382683432365089890f, -0.926210242138311380f, 0.377007410216418150f,
+  -0.928506080473215480f, 0.371317193951837710f, -0.930766961078983710f,
+  0.365612997804773800f, -0.932992798834738850f, 0.359895036534988330f,
+  -0.935183509938947610f, 0.354163525420490400f, -0.937339011912574850f,
+  0.348418680249434790f, -0.939459223602189920f, 0.342660717311994430f,
+  -0.941544065183020700f, 0.336889853392220330f, -0.943593458161960390f,
+  0.331106305759876480f, -0.945607325380521170f, 0.325310292162263260f,
+  -0.947585591017741090f, 0.319502030816015800f, -0.949528180593036670f,
+  0.313681740398891410f, -0.951435020969008340f, 0.307849640041535030f,
+  -0.953306040354193860f, 0.302005949319228030f, -0.955141168305770670f,
+  0.296150888243624010f, -0.956940335732208820f, 0.290284677254462390f,
+  -0.958703474895871490f, 0.284407537211272100f, -0.960430519415565790f,
+  0.278519689385053170f, -0.962121404269041470f, 0.272621355449949250f,
+  -0.963776065795439840f, 0.266712757474898480f, -0.965394441697689290f,
+  0.260794117915275850f, -0.966976471044852070f, 0.254865659604514680f,
+  -0.968522094274417380f, 0.248927605745720090f, -0.970031253194543970f,
+  0.242980179903264070f, -0.971503890986251780f, 0.237023605994367170f,
+  -0.972939952205560070f, 0.231058108280671330f, -0.974339382785575860f,
+  0.225083911359792830f, -0.975702130038528460f, 0.219101240156870050f,
+  -0.977028142657754390f, 0.213110319916091420f, -0.978317370719627540f,
+  0.207111376192218840f, -0.979569765685440520f, 0.201104634842092010f,
+  -0.980785280403230430f, 0.195090322016128610f, -0.981963869109555240f,
+  0.189068664149806360f, -0.983105487431216290f, 0.183039887955140900f,
+  -0.984210092386929030f, 0.177004220412148940f, -0.985277642388941220f,
+  0.170961888760301220f, -0.986308097244598560f, 0.164913120489970140f,
+  -0.987301418157858430f, 0.158858143333861470f, -0.988257567730749460f,
+  0.152797185258443690f, -0.989176509964781010f, 0.146730474455361800f,
+  -0.990058210262297010f, 0.140658239332849540f, -0.990902635427780010f,
+  0.134580708507126280f, -0.991709753669099530f, 0.128498110793793090f,
+  -0.992479534598709970f, 0.122410675199216350f, -0.993211949234794500f,
+  0.116318630911904710f, -0.993906970002356060f, 0.110222207293883240f,
+  -0.994564570734255420f, 0.104121633872054570f, -0.995184726672196820f,
+  0.098017140329560826f, -0.995767414467659820f, 0.091908956497132752f,
+  -0.996312612182778000f, 0.085797312344440158f, -0.996820299291165670f,
+  0.079682437971430195f, -0.997290456678690210f, 0.073564563599667732f,
+  -0.997723066644191640f, 0.067443919563664176f, -0.998118112900149180f,
+  0.061320736302208488f, -0.998475580573294770f, 0.055195244349690094f,
+  -0.998795456205172410f, 0.049067674327417966f, -0.999077727752645360f,
+  0.042938256934941021f, -0.999322384588349540f, 0.036807222941358832f,
+  -0.999529417501093140f, 0.030674803176636865f, -0.999698818696204250f,
+  0.024541228522912326f, -0.999830581795823400f, 0.018406729905805101f,
+  -0.999924701839144500f, 0.012271538285720007f, -0.999981175282601110f,
+  0.006135884649154799f, -1.000000000000000000f, 0.000000000000000122f,
+  -0.999981175282601110f, -0.006135884649154554f, -0.999924701839144500f,
+  -0.012271538285719762f, -0.999830581795823400f, -0.018406729905804858f,
+  -0.999698818696204250f, -0.024541228522912080f, -0.999529417501093140f,
+  -0.030674803176636619f, -0.999322384588349540f, -0.036807222941358582f,
+  -0.999077727752645360f, -0.042938256934940779f, -0.998795456205172410f,
+  -0.049067674327417724f, -0.998475580573294770f, -0.055195244349689851f,
+  -0.998118112900149180f, -0.061320736302208245f, -0.997723066644191640f,
+  -0.067443919563663926f, -0.997290456678690210f, -0.073564563599667496f,
+  -0.996820299291165780f, -0.079682437971429945f, -0.996312612182778000f,
+  -0.085797312344439922f, -0.995767414467659820f, -0.091908956497132516f,
+  -0.995184726672196930f, -0.098017140329560590f, -0.994564570734255530f,
+  -0.104121633872054320f, -0.993906970002356060f, -0.110222207293883000f,
+  -0.993211949234794610f, -0.116318630911904470f, -0.992479534598709970f,
+  -0.122410675199216100f, -0.991709753669099530f, -0.128498110793792840f,
+  -0.990902635427780010f, -0.134580708507126060f, -0.990058210262297120f,
+  -0.140658239332849290f, -0.989176509964781010f, -0.146730474455361580f,
+  -0.988257567730749460f, -0.152797185258443440f, -0.987301418157858430f,
+  -0.158858143333861220f, -0.986308097244598670f, -0.164913120489969890f,
+  -0.985277642388941330f, -0.170961888760300970f, -0.984210092386929140f,
+  -0.177004220412148690f, -0.983105487431216400f, -0.183039887955140650f,
+  -0.981963869109555240f, -0.189068664149806110f, -0.980785280403230430f,
+  -0.195090322016128360f, -0.979569765685440520f, -0.201104634842091760f,
+  -0.978317370719627650f, -0.207111376192218590f, -0.977028142657754390f,
+  -0.213110319916091200f, -0.975702130038528570f, -0.219101240156869800f,
+  -0.974339382785575860f, -0.225083911359792610f, -0.972939952205560180f,
+  -0.231058108280671080f, -0.971503890986251890f, -0.237023605994366950f,
+  -0.970031253194543970f, -0.242980179903263820f, -0.968522094274417380f,
+  -0.248927605745719870f, -0.966976471044852180f, -0.254865659604514460f,
+  -0.965394441697689400f, -0.260794117915275630f, -0.963776065795439950f,
+  -0.266712757474898250f, -0.962121404269041580f, -0.272621355449949030f,
+  -0.960430519415565900f, -0.278519689385052890f, -0.958703474895871600f,
+  -0.284407537211271820f, -0.956940335732208940f, -0.290284677254462110f,
+  -0.955141168305770780f, -0.296150888243623790f, -0.953306040354193970f,
+  -0.302005949319227810f, -0.951435020969008450f, -0.307849640041534810f,
+  -0.949528180593036790f, -0.313681740398891180f, -0.947585591017741200f,
+  -0.319502030816015580f, -0.945607325380521280f, -0.325310292162262980f,
+  -0.943593458161960390f, -0.331106305759876260f, -0.941544065183020810f,
+  -0.336889853392220110f, -0.939459223602190030f, -0.342660717311994210f,
+  -0.937339011912574960f, -0.348418680249434560f, -0.935183509938947720f,
+  -0.354163525420490120f, -0.932992798834738960f, -0.359895036534988110f,
+  -0.930766961078983820f, -0.365612997804773580f, -0.928506080473215590f,
+  -0.371317193951837430f, -0.926210242138311490f, -0.377007410216417930f,
+  -0.923879532511286850f, -0.382683432365089670f, -0.921514039342041900f,
+  -0.388345046698826360f, -0.919113851690057770f, -0.393992040061047930f,
+  -0.916679059921042700f, -0.399624199845646840f, -0.914209755703530690f,
+  -0.405241314004989690f, -0.911706032005429880f, -0.410843171057903910f,
+  -0.909167983090522490f, -0.416429560097636930f, -0.906595704514915450f,
+  -0.422000270799799630f, -0.903989293123443450f, -0.427555093430281810f,
+  -0.901348847046022030f, -0.433093818853151850f, -0.898674465693954040f,
+  -0.438616238538527330f, -0.895966249756185220f, -0.444122144570429090f,
+  -0.893224301195515320f, -0.449611329654606650f, -0.890448723244757990f,
+  -0.455083587126343670f, -0.887639620402853930f, -0.460538710958240060f,
+  -0.884797098430937900f, -0.465976495767965960f, -0.881921264348355050f,
+  -0.471396736825997640f, -0.879012226428633640f, -0.476799230063321870f,
+  -0.876070094195406600f, -0.482183772079122660f, -0.873094978418290200f,
+  -0.487550160148435660f, -0.870086991108711460f, -0.492898192229783930f,
+  -0.867046245515692870f, -0.498227666972781540f, -0.863972856121586810f,
+  -0.503538383725717460f, -0.860866938637767310f, -0.508830142543107100f,
+  -0.857728610000272120f, -0.514102744193221550f, -0.854557988365400530f,
+  -0.519355990165589640f, -0.851355193105265310f, -0.524589682678468730f,
+  -0.848120344803297230f, -0.529803624686294610f, -0.844853565249707230f,
+  -0.534997619887096930f, -0.841554977436898440f, -0.540171472729892850f,
+  -0.838224705554838190f, -0.545324988422046130f, -0.834862874986380120f,
+  -0.550457972936604700f, -0.831469612302545460f, -0.555570233019601960f,
+  -0.828045045257755800f, -0.560661576197335920f, -0.824589302785025290f,
+  -0.565731810783613230f, -0.821102514991104760f, -0.570780745886967140f,
+  -0.817584813151583710f, -0.575808191417845340f, -0.814036329705948520f,
+  -0.580813958095764300f, -0.810457198252594770f, -0.585797857456438860f,
+  -0.806847553543799450f, -0.590759701858873940f, -0.803207531480644940f,
+  -0.595699304492433250f, -0.799537269107905240f, -0.600616479383868640f,
+  -0.795836904608883570f, -0.605511041404325430f, -0.792106577300212280f,
+  -0.610382806276309480f, -0.788346427626606340f, -0.615231590580626710f,
+  -0.784556597155575240f, -0.620057211763289210f, -0.780737228572094600f,
+  -0.624859488142386230f, -0.776888465673232440f, -0.629638238914926980f,
+  -0.773010453362737100f, -0.634393284163645270f, -0.769103337645579700f,
+  -0.639124444863775730f, -0.765167265622459070f, -0.643831542889791280f,
+  -0.761202385484261890f, -0.648514401022112330f, -0.757208846506484790f,
+  -0.653172842953776530f, -0.753186799043612630f, -0.657806693297078530f,
+  -0.749136394523459260f, -0.662415777590171780f, -0.745057785441466060f,
+  -0.666999922303637360f, -0.740951125354959110f, -0.671558954847018440f,
+  -0.736816568877370020f, -0.676092703575315810f, -0.732654271672412820f,
+  -0.680600997795453020f, -0.728464390448225420f, -0.685083667772700130f,
+  -0.724247082951467000f, -0.689540544737066830f, -0.720002507961381880f,
+  -0.693971460889653780f, -0.715730825283818710f, -0.698376249408972800f,
+  -0.711432195745216660f, -0.702754744457225080f, -0.707106781186547680f,
+  -0.707106781186547460f, -0.702754744457225300f, -0.711432195745216430f,
+  -0.698376249408973030f, -0.715730825283818480f, -0.693971460889654000f,
+  -0.720002507961381650f, -0.689540544737067050f, -0.724247082951466780f,
+  -0.685083667772700360f, -0.728464390448225200f, -0.680600997795453240f,
+  -0.732654271672412590f, -0.676092703575316030f, -0.736816568877369790f,
+  -0.671558954847018660f, -0.740951125354958880f, -0.666999922303637580f,
+  -0.745057785441465840f, -0.662415777590172010f, -0.749136394523459040f,
+  -0.657806693297078750f, -0.753186799043612410f, -0.653172842953777090f,
+  -0.757208846506484230f, -0.648514401022112220f, -0.761202385484262000f,
+  -0.643831542889791500f, -0.765167265622458960f, -0.639124444863775950f,
+  -0.769103337645579480f, -0.634393284163645930f, -0.773010453362736660f,
+  -0.629638238914926870f, -0.776888465673232550f, -0.624859488142386450f,
+  -0.780737228572094380f, -0.620057211763289430f, -0.784556597155575020f,
+  -0.615231590580627260f, -0.788346427626605890f, -0.610382806276309360f,
+  -0.792106577300212390f, -0.605511041404325660f, -0.795836904608883460f,
+  -0.600616479383869310f, -0.799537269107904790f, -0.595699304492433130f,
+  -0.803207531480645050f, -0.590759701858874280f, -0.806847553543799220f,
+  -0.585797857456439090f, -0.810457198252594660f, -0.580813958095764970f,
+  -0.814036329705948080f, -0.575808191417845230f, -0.817584813151583820f,
+  -0.570780745886967370f, -0.821102514991104650f, -0.565731810783613450f,
+  -0.824589302785025070f, -0.560661576197336480f, -0.828045045257755460f,
+  -0.555570233019602180f, -0.831469612302545240f, -0.550457972936604920f,
+  -0.834862874986380010f, -0.545324988422046800f, -0.838224705554837860f,
+  -0.540171472729892740f, -0.841554977436898550f, -0.534997619887097260f,
+  -0.844853565249707010f, -0.529803624686294940f, -0.848120344803297120f,
+  -0.524589682678469390f, -0.851355193105264860f, -0.519355990165589420f,
+  -0.854557988365400640f, -0.514102744193221770f, -0.857728610000272010f,
+  -0.508830142543107320f, -0.860866938637767090f, -0.503538383725718020f,
+  -0.863972856121586470f, -0.498227666972781810f, -0.867046245515692650f,
+  -0.492898192229784200f, -0.870086991108711350f, -0.487550160148436330f,
+  -0.873094978418289870f, -0.482183772079122550f, -0.876070094195406710f,
+  -0.476799230063322140f, -0.879012226428633410f, -0.471396736825997860f,
+  -0.881921264348354940f, -0.465976495767966630f, -0.884797098430937570f,
+  -0.460538710958239890f, -0.887639620402854050f, -0.455083587126343950f,
+  -0.890448723244757880f, -0.449611329654606930f, -0.893224301195515210f,
+  -0.444122144570429760f, -0.895966249756184880f, -0.438616238538527600f,
+  -0.898674465693953820f, -0.433093818853152120f, -0.901348847046021920f,
+  -0.427555093430282470f, -0.903989293123443120f, -0.422000270799799520f,
+  -0.906595704514915450f, -0.416429560097637210f, -0.909167983090522380f,
+  -0.410843171057904190f, -0.911706032005429770f, -0.405241314004990360f,
+  -0.914209755703530470f, -0.399624199845646730f, -0.916679059921042700f,
+  -0.393992040061048210f, -0.919113851690057660f, -0.388345046698826630f,
+  -0.921514039342041790f, -0.382683432365090340f, -0.923879532511286520f,
+  -0.377007410216418200f, -0.926210242138311380f, -0.371317193951837770f,
+  -0.928506080473215480f, -0.365612997804774300f, -0.930766961078983600f,
+  -0.359895036534987940f, -0.932992798834738960f, -0.354163525420490450f,
+  -0.935183509938947610f, -0.348418680249434840f, -0.937339011912574850f,
+  -0.342660717311994880f, -0.939459223602189700f, -0.336889853392219940f,
+  -0.941544065183020810f, -0.331106305759876540f, -0.943593458161960270f,
+  -0.325310292162263310f, -0.945607325380521170f, -0.319502030816015410f,
+  -0.947585591017741200f, -0.313681740398891460f, -0.949528180593036670f,
+  -0.307849640041535090f, -0.951435020969008340f, -0.302005949319228530f,
+  -0.953306040354193750f, -0.296150888243623680f, -0.955141168305770780f,
+  -0.290284677254462440f, -0.956940335732208820f, -0.284407537211272150f,
+  -0.958703474895871490f, -0.278519689385053610f, -0.960430519415565680f,
+  -0.272621355449948870f, -0.962121404269041580f, -0.266712757474898530f,
+  -0.963776065795439840f, -0.260794117915275900f, -0.965394441697689290f,
+  -0.254865659604514350f, -0.966976471044852180f, -0.248927605745720150f,
+  -0.968522094274417270f, -0.242980179903264120f, -0.970031253194543970f,
+  -0.237023605994367670f, -0.971503890986251670f, -0.231058108280670940f,
+  -0.972939952205560180f, -0.225083911359792920f, -0.974339382785575860f,
+  -0.219101240156870100f, -0.975702130038528460f, -0.213110319916091920f,
+  -0.977028142657754280f, -0.207111376192218480f, -0.978317370719627650f,
+  -0.201104634842092070f, -0.979569765685440520f, -0.195090322016128660f,
+  -0.980785280403230320f, -0.189068664149805970f, -0.981963869109555350f,
+  -0.183039887955140950f, -0.983105487431216290f, -0.177004220412149000f,
+  -0.984210092386929030f, -0.170961888760301690f, -0.985277642388941110f,
+  -0.164913120489969760f, -0.986308097244598670f, -0.158858143333861530f,
+  -0.987301418157858320f, -0.152797185258443740f, -0.988257567730749460f,
+  -0.146730474455362300f, -0.989176509964780900f, -0.140658239332849160f,
+  -0.990058210262297120f, -0.134580708507126360f, -0.990902635427780010f,
+  -0.128498110793793590f, -0.991709753669099530f, -0.122410675199215960f,
+  -0.992479534598710080f, -0.116318630911904770f, -0.993211949234794500f,
+  -0.110222207293883310f, -0.993906970002356060f, -0.104121633872055070f,
+  -0.994564570734255420f, -0.098017140329560451f, -0.995184726672196930f,
+  -0.091908956497132821f, -0.995767414467659820f, -0.085797312344440227f,
+  -0.996312612182778000f, -0.079682437971430695f, -0.996820299291165670f,
+  -0.073564563599667357f, -0.997290456678690210f, -0.067443919563664231f,
+  -0.997723066644191640f, -0.061320736302208995f, -0.998118112900149180f,
+  -0.055195244349689712f, -0.998475580573294770f, -0.049067674327418029f,
+  -0.998795456205172410f, -0.042938256934941084f, -0.999077727752645360f,
+  -0.036807222941359331f, -0.999322384588349430f, -0.030674803176636484f,
+  -0.999529417501093140f, -0.024541228522912389f, -0.999698818696204250f,
+  -0.018406729905805164f, -0.999830581795823400f, -0.012271538285720512f,
+  -0.999924701839144500f, -0.006135884649154416f, -0.999981175282601110f
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+const float32_t twiddleCoef[384] = {
+  1.000000000000000000f, 0.000000000000000000f, 0.999698818696204250f,
+  0.024541228522912288f, 0.998795456205172410f, 0.049067674327418015f,
+  0.997290456678690210f, 0.073564563599667426f, 0.995184726672196930f,
+  0.098017140329560604f, 0.992479534598709970f, 0.122410675199216200f,
+  0.989176509964781010f, 0.146730474455361750f, 0.985277642388941220f,
+  0.170961888760301220f, 0.980785280403230430f, 0.195090322016128250f,
+  0.975702130038528570f, 0.219101240156869800f, 0.970031253194543970f,
+  0.242980179903263870f, 0.963776065795439840f, 0.266712757474898370f,
+  0.956940335732208820f, 0.290284677254462330f, 0.949528180593036670f,
+  0.313681740398891520f, 0.941544065183020810f, 0.336889853392220050f,
+  0.932992798834738960f, 0.359895036534988110f, 0.923879532511286740f,
+  0.382683432365089780f, 0.914209755703530690f, 0.405241314004989860f,
+  0.903989293123443340f, 0.427555093430282080f, 0.893224301195515320f,
+  0.449611329654606540f, 0.881921264348355050f, 0.471396736825997640f,
+  0.870086991108711460f, 0.492898192229784040f, 0.857728610000272120f,
+  0.514102744193221660f, 0.844853565249707120f, 0.534997619887097150f,
+  0.831469612302545240f, 0.555570233019602180f, 0.817584813151583710f,
+  0.575808191417845340f, 0.803207531480644940f, 0.595699304492433360f,
+  0.788346427626606340f, 0.615231590580626820f, 0.773010453362736990f,
+  0.634393284163645490f, 0.757208846506484570f, 0.653172842953776760f,
+  0.740951125354959110f, 0.671558954847018330f, 0.724247082951467000f,
+  0.689540544737066830f, 0.707106781186547570f, 0.707106781186547460f,
+  0.689540544737066940f, 0.724247082951466890f, 0.671558954847018330f,
+  0.740951125354959110f, 0.653172842953776760f, 0.757208846506484460f,
+  0.634393284163645490f, 0.773010453362736990f, 0.615231590580626820f,
+  0.788346427626606230f, 0.595699304492433470f, 0.803207531480644830f,
+  0.575808191417845340f, 0.817584813151583710f, 0.555570233019602290f,
+  0.831469612302545240f, 0.534997619887097260f, 0.844853565249707010f,
+  0.514102744193221660f, 0.857728610000272120f, 0.492898192229784090f,
+  0.870086991108711350f, 0.471396736825997810f, 0.881921264348354940f,
+  0.449611329654606600f, 0.893224301195515320f, 0.427555093430282200f,
+  0.903989293123443340f, 0.405241314004989860f, 0.914209755703530690f,
+  0.382683432365089840f, 0.923879532511286740f, 0.359895036534988280f,
+  0.932992798834738850f, 0.336889853392220050f, 0.941544065183020810f,
+  0.313681740398891570f, 0.949528180593036670f, 0.290284677254462330f,
+  0.956940335732208940f, 0.266712757474898420f, 0.963776065795439840f,
+  0.242980179903263980f, 0.970031253194543970f, 0.219101240156869770f,
+  0.975702130038528570f, 0.195090322016128330f, 0.980785280403230430f,
+  0.170961888760301360f, 0.985277642388941220f, 0.146730474455361750f,
+  0.989176509964781010f, 0.122410675199216280f, 0.992479534598709970f,
+  0.098017140329560770f, 0.995184726672196820f, 0.073564563599667454f,
+  0.997290456678690210f, 0.049067674327418126f, 0.998795456205172410f,
+  0.024541228522912264f, 0.999698818696204250f, 0.000000000000000061f,
+  1.000000000000000000f, -0.024541228522912142f, 0.999698818696204250f,
+  -0.049067674327418008f, 0.998795456205172410f, -0.073564563599667329f,
+  0.997290456678690210f, -0.098017140329560645f, 0.995184726672196930f,
+  -0.122410675199216150f, 0.992479534598709970f, -0.146730474455361640f,
+  0.989176509964781010f, -0.170961888760301240f, 0.985277642388941220f,
+  -0.195090322016128190f, 0.980785280403230430f, -0.219101240156869660f,
+  0.975702130038528570f, -0.242980179903263870f, 0.970031253194543970f,
+  -0.266712757474898310f, 0.963776065795439840f, -0.290284677254462160f,
+  0.956940335732208940f, -0.313681740398891410f, 0.949528180593036670f,
+  -0.336889853392219940f, 0.941544065183020810f, -0.359895036534988170f,
+  0.932992798834738850f, -0.382683432365089730f, 0.923879532511286740f,
+  -0.405241314004989750f, 0.914209755703530690f, -0.427555093430281860f,
+  0.903989293123443450f, -0.449611329654606710f, 0.893224301195515210f,
+  -0.471396736825997700f, 0.881921264348355050f, -0.492898192229783980f,
+  0.870086991108711460f, -0.514102744193221660f, 0.857728610000272120f,
+  -0.534997619887097040f, 0.844853565249707230f, -0.555570233019601960f,
+  0.831469612302545460f, -0.575808191417845340f, 0.817584813151583710f,
+  -0.595699304492433360f, 0.803207531480644940f, -0.615231590580626710f,
+  0.788346427626606340f, -0.634393284163645380f, 0.773010453362737100f,
+  -0.653172842953776530f, 0.757208846506484680f, -0.671558954847018440f,
+  0.740951125354958990f, -0.689540544737066940f, 0.724247082951466890f,
+  -0.707106781186547460f, 0.707106781186547570f, -0.724247082951466780f,
+  0.689540544737067050f, -0.740951125354958880f, 0.671558954847018550f,
+  -0.757208846506484570f, 0.653172842953776640f, -0.773010453362736990f,
+  0.634393284163645490f, -0.788346427626606230f, 0.615231590580626930f,
+  -0.803207531480644830f, 0.595699304492433470f, -0.817584813151583600f,
+  0.575808191417845450f, -0.831469612302545350f, 0.555570233019602180f,
+  -0.844853565249707120f, 0.534997619887097150f, -0.857728610000272010f,
+  0.514102744193221770f, -0.870086991108711350f, 0.492898192229784150f,
+  -0.881921264348354940f, 0.471396736825997860f, -0.893224301195515210f,
+  0.449611329654606870f, -0.903989293123443340f, 0.427555093430282030f,
+  -0.914209755703530690f, 0.405241314004989920f, -0.923879532511286740f,
+  0.382683432365089890f, -0.932992798834738850f, 0.359895036534988330f,
+  -0.941544065183020700f, 0.336889853392220330f, -0.949528180593036670f,
+  0.313681740398891410f, -0.956940335732208820f, 0.290284677254462390f,
+  -0.963776065795439840f, 0.266712757474898480f, -0.970031253194543970f,
+  0.242980179903264070f, -0.975702130038528460f, 0.219101240156870050f,
+  -0.980785280403230430f, 0.195090322016128610f, -0.985277642388941220f,
+  0.170961888760301220f, -0.989176509964781010f, 0.146730474455361800f,
+  -0.992479534598709970f, 0.122410675199216350f, -0.995184726672196820f,
+  0.098017140329560826f, -0.997290456678690210f, 0.073564563599667732f,
+  -0.998795456205172410f, 0.049067674327417966f, -0.999698818696204250f,
+  0.024541228522912326f, -1.000000000000000000f, 0.000000000000000122f,
+  -0.999698818696204250f, -0.024541228522912080f, -0.998795456205172410f,
+  -0.049067674327417724f, -0.997290456678690210f, -0.073564563599667496f,
+  -0.995184726672196930f, -0.098017140329560590f, -0.992479534598709970f,
+  -0.122410675199216100f, -0.989176509964781010f, -0.146730474455361580f,
+  -0.985277642388941330f, -0.170961888760300970f, -0.980785280403230430f,
+  -0.195090322016128360f, -0.975702130038528570f, -0.219101240156869800f,
+  -0.970031253194543970f, -0.242980179903263820f, -0.963776065795439950f,
+  -0.266712757474898250f, -0.956940335732208940f, -0.290284677254462110f,
+  -0.949528180593036790f, -0.313681740398891180f, -0.941544065183020810f,
+  -0.336889853392220110f, -0.932992798834738960f, -0.359895036534988110f,
+  -0.923879532511286850f, -0.382683432365089670f, -0.914209755703530690f,
+  -0.405241314004989690f, -0.903989293123443450f, -0.427555093430281810f,
+  -0.893224301195515320f, -0.449611329654606650f, -0.881921264348355050f,
+  -0.471396736825997640f, -0.870086991108711460f, -0.492898192229783930f,
+  -0.857728610000272120f, -0.514102744193221550f, -0.844853565249707230f,
+  -0.534997619887096930f, -0.831469612302545460f, -0.555570233019601960f,
+  -0.817584813151583710f, -0.575808191417845340f, -0.803207531480644940f,
+  -0.595699304492433250f, -0.788346427626606340f, -0.615231590580626710f,
+  -0.773010453362737100f, -0.634393284163645270f, -0.757208846506484790f,
+  -0.653172842953776530f, -0.740951125354959110f, -0.671558954847018440f,
+  -0.724247082951467000f, -0.689540544737066830f, -0.707106781186547680f,
+  -0.707106781186547460f, -0.689540544737067050f, -0.724247082951466780f,
+  -0.671558954847018660f, -0.740951125354958880f, -0.653172842953777090f,
+  -0.757208846506484230f, -0.634393284163645930f, -0.773010453362736660f,
+  -0.615231590580627260f, -0.788346427626605890f, -0.595699304492433130f,
+  -0.803207531480645050f, -0.575808191417845230f, -0.817584813151583820f,
+  -0.555570233019602180f, -0.831469612302545240f, -0.534997619887097260f,
+  -0.844853565249707010f, -0.514102744193221770f, -0.857728610000272010f,
+  -0.492898192229784200f, -0.870086991108711350f, -0.471396736825997860f,
+  -0.881921264348354940f, -0.449611329654606930f, -0.893224301195515210f,
+  -0.427555093430282470f, -0.903989293123443120f, -0.405241314004990360f,
+  -0.914209755703530470f, -0.382683432365090340f, -0.923879532511286520f,
+  -0.359895036534987940f, -0.932992798834738960f, -0.336889853392219940f,
+  -0.941544065183020810f, -0.313681740398891460f, -0.949528180593036670f,
+  -0.290284677254462440f, -0.956940335732208820f, -0.266712757474898530f,
+  -0.963776065795439840f, -0.242980179903264120f, -0.970031253194543970f,
+  -0.219101240156870100f, -0.975702130038528460f, -0.195090322016128660f,
+  -0.980785280403230320f, -0.170961888760301690f, -0.985277642388941110f,
+  -0.146730474455362300f, -0.989176509964780900f, -0.122410675199215960f,
+  -0.992479534598710080f, -0.098017140329560451f, -0.995184726672196930f,
+  -0.073564563599667357f, -0.997290456678690210f, -0.049067674327418029f,
+  -0.998795456205172410f, -0.024541228522912389f, -0.999698818696204250f
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+const float32_t twiddleCoef[96] = {
+  1.000000000000000000f, 0.000000000000000000f, 0.995184726672196930f,
+  0.098017140329560604f, 0.980785280403230430f, 0.195090322016128250f,
+  0.956940335732208820f, 0.290284677254462330f, 0.923879532511286740f,
+  0.382683432365089780f, 0.881921264348355050f, 0.471396736825997640f,
+  0.831469612302545240f, 0.555570233019602180f, 0.773010453362736990f,
+  0.634393284163645490f, 0.707106781186547570f, 0.707106781186547460f,
+  0.634393284163645490f, 0.773010453362736990f, 0.555570233019602290f,
+  0.831469612302545240f, 0.471396736825997810f, 0.881921264348354940f,
+  0.382683432365089840f, 0.923879532511286740f, 0.290284677254462330f,
+  0.956940335732208940f, 0.195090322016128330f, 0.980785280403230430f,
+  0.098017140329560770f, 0.995184726672196820f, 0.000000000000000061f,
+  1.000000000000000000f, -0.098017140329560645f, 0.995184726672196930f,
+  -0.195090322016128190f, 0.980785280403230430f, -0.290284677254462160f,
+  0.956940335732208940f, -0.382683432365089730f, 0.923879532511286740f,
+  -0.471396736825997700f, 0.881921264348355050f, -0.555570233019601960f,
+  0.831469612302545460f, -0.634393284163645380f, 0.773010453362737100f,
+  -0.707106781186547460f, 0.707106781186547570f, -0.773010453362736990f,
+  0.634393284163645490f, -0.831469612302545350f, 0.555570233019602180f,
+  -0.881921264348354940f, 0.471396736825997860f, -0.923879532511286740f,
+  0.382683432365089890f, -0.956940335732208820f, 0.290284677254462390f,
+  -0.980785280403230430f, 0.195090322016128610f, -0.995184726672196820f,
+  0.098017140329560826f, -1.000000000000000000f, 0.000000000000000122f,
+  -0.995184726672196930f, -0.098017140329560590f, -0.980785280403230430f,
+  -0.195090322016128360f, -0.956940335732208940f, -0.290284677254462110f,
+  -0.923879532511286850f, -0.382683432365089670f, -0.881921264348355050f,
+  -0.471396736825997640f, -0.831469612302545460f, -0.555570233019601960f,
+  -0.773010453362737100f, -0.634393284163645270f, -0.707106781186547680f,
+  -0.707106781186547460f, -0.634393284163645930f, -0.773010453362736660f,
+  -0.555570233019602180f, -0.831469612302545240f, -0.471396736825997860f,
+  -0.881921264348354940f, -0.382683432365090340f, -0.923879532511286520f,
+  -0.290284677254462440f, -0.956940335732208820f, -0.195090322016128660f,
+  -0.980785280403230320f, -0.098017140329560451f, -0.995184726672196930f
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 16)
+const float32_t twiddleCoef[24] = {
+  1.000000000000000000f, 0.000000000000000000f, 0.923879532511286740f,
+  0.382683432365089780f, 0.707106781186547570f, 0.707106781186547460f,
+  0.382683432365089840f, 0.923879532511286740f, 0.000000000000000061f,
+  1.000000000000000000f, -0.382683432365089730f, 0.923879532511286740f,
+  -0.707106781186547460f, 0.707106781186547570f, -0.923879532511286740f,
+  0.382683432365089890f, -1.000000000000000000f, 0.000000000000000122f,
+  -0.923879532511286850f, -0.382683432365089670f, -0.707106781186547680f,
+  -0.707106781186547460f, -0.382683432365090340f, -0.923879532511286520f
+};
+#endif
 
 /*    
 * @brief  Q31 Twiddle factors Table    
@@ -2305,7 +3056,7 @@ const float32_t twiddleCoef[6144] = {
 *    twiddleCoefQ31[2*i+1]= sin(i * 2*PI/(float)N);    
 * } </pre>    
 * \par    
-* where N = 4096	and PI = 3.14159265358979    
+* where N = ARM_MATH_MAX_FFT_LEN (4096 by default) and PI = 3.14159265358979    
 * \par    
 * Cos and Sin values are interleaved fashion    
 * \par    
@@ -2314,6 +3065,7 @@ const float32_t twiddleCoef[6144] = {
 *    
 */
 
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
 const q31_t twiddleCoefQ31[6144] = {
   0x7fffffff, 0x0, 0x7ffff621, 0x3243f5, 0x7fffd886, 0x6487e3, 0x7fffa72c,
     0x96cbc1,
@@ -3853,6 +4605,359 @@ const q31_t twiddleCoefQ31[6144] = {
     0xffcdbc0b, 0x800009df,
 
 };
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+const q31_t twiddleCoefQ31[1536] = {
+  0x7fffffff, 0x0, 0x7fff6216, 0xc90f88, 0x7ffd885a, 0x1921d20,
+  0x7ffa72d1, 0x25b26d7, 0x7ff62182, 0x3242abf, 0x7ff09478, 0x3ed26e6,
+  0x7fe9cbc0, 0x4b6195d, 0x7fe1c76b, 0x57f0035, 0x7fd8878e, 0x647d97c,
+  0x7fce0c3e, 0x710a345, 0x7fc25596, 0x7d95b9e, 0x7fb563b3, 0x8a2009a,
+  0x7fa736b4, 0x96a9049, 0x7f97cebd, 0xa3308bd, 0x7f872bf3, 0xafb6805,
+  0x7f754e80, 0xbc3ac35, 0x7f62368f, 0xc8bd35e, 0x7f4de451, 0xd53db92,
+  0x7f3857f6, 0xe1bc2e4, 0x7f2191b4, 0xee38766, 0x7f0991c4, 0xfab272b,
+  0x7ef05860, 0x1072a048, 0x7ed5e5c6, 0x1139f0cf, 0x7eba3a39, 0x120116d5,
+  0x7e9d55fc, 0x12c8106f, 0x7e7f3957, 0x138edbb1, 0x7e5fe493, 0x145576b1,
+  0x7e3f57ff, 0x151bdf86, 0x7e1d93ea, 0x15e21445, 0x7dfa98a8, 0x16a81305,
+  0x7dd6668f, 0x176dd9de, 0x7db0fdf8, 0x183366e9, 0x7d8a5f40, 0x18f8b83c,
+  0x7d628ac6, 0x19bdcbf3, 0x7d3980ec, 0x1a82a026, 0x7d0f4218, 0x1b4732ef,
+  0x7ce3ceb2, 0x1c0b826a, 0x7cb72724, 0x1ccf8cb3, 0x7c894bde, 0x1d934fe5,
+  0x7c5a3d50, 0x1e56ca1e, 0x7c29fbee, 0x1f19f97b, 0x7bf88830, 0x1fdcdc1b,
+  0x7bc5e290, 0x209f701c, 0x7b920b89, 0x2161b3a0, 0x7b5d039e, 0x2223a4c5,
+  0x7b26cb4f, 0x22e541af, 0x7aef6323, 0x23a6887f, 0x7ab6cba4, 0x24677758,
+  0x7a7d055b, 0x25280c5e, 0x7a4210d8, 0x25e845b6, 0x7a05eead, 0x26a82186,
+  0x79c89f6e, 0x27679df4, 0x798a23b1, 0x2826b928, 0x794a7c12, 0x28e5714b,
+  0x7909a92d, 0x29a3c485, 0x78c7aba2, 0x2a61b101, 0x78848414, 0x2b1f34eb,
+  0x78403329, 0x2bdc4e6f, 0x77fab989, 0x2c98fbba, 0x77b417df, 0x2d553afc,
+  0x776c4edb, 0x2e110a62, 0x77235f2d, 0x2ecc681e, 0x76d94989, 0x2f875262,
+  0x768e0ea6, 0x3041c761, 0x7641af3d, 0x30fbc54d, 0x75f42c0b, 0x31b54a5e,
+  0x75a585cf, 0x326e54c7, 0x7555bd4c, 0x3326e2c3, 0x7504d345, 0x33def287,
+  0x74b2c884, 0x34968250, 0x745f9dd1, 0x354d9057, 0x740b53fb, 0x36041ad9,
+  0x73b5ebd1, 0x36ba2014, 0x735f6626, 0x376f9e46, 0x7307c3d0, 0x382493b0,
+  0x72af05a7, 0x38d8fe93, 0x72552c85, 0x398cdd32, 0x71fa3949, 0x3a402dd2,
+  0x719e2cd2, 0x3af2eeb7, 0x71410805, 0x3ba51e29, 0x70e2cbc6, 0x3c56ba70,
+  0x708378ff, 0x3d07c1d6, 0x7023109a, 0x3db832a6, 0x6fc19385, 0x3e680b2c,
+  0x6f5f02b2, 0x3f1749b8, 0x6efb5f12, 0x3fc5ec98, 0x6e96a99d, 0x4073f21d,
+  0x6e30e34a, 0x4121589b, 0x6dca0d14, 0x41ce1e65, 0x6d6227fa, 0x427a41d0,
+  0x6cf934fc, 0x4325c135, 0x6c8f351c, 0x43d09aed, 0x6c242960, 0x447acd50,
+  0x6bb812d1, 0x452456bd, 0x6b4af279, 0x45cd358f, 0x6adcc964, 0x46756828,
+  0x6a6d98a4, 0x471cece7, 0x69fd614a, 0x47c3c22f, 0x698c246c, 0x4869e665,
+  0x6919e320, 0x490f57ee, 0x68a69e81, 0x49b41533, 0x683257ab, 0x4a581c9e,
+  0x67bd0fbd, 0x4afb6c98, 0x6746c7d8, 0x4b9e0390, 0x66cf8120, 0x4c3fdff4,
+  0x66573cbb, 0x4ce10034, 0x65ddfbd3, 0x4d8162c4, 0x6563bf92, 0x4e210617,
+  0x64e88926, 0x4ebfe8a5, 0x646c59bf, 0x4f5e08e3, 0x63ef3290, 0x4ffb654d,
+  0x637114cc, 0x5097fc5e, 0x62f201ac, 0x5133cc94, 0x6271fa69, 0x51ced46e,
+  0x61f1003f, 0x5269126e, 0x616f146c, 0x53028518, 0x60ec3830, 0x539b2af0,
+  0x60686ccf, 0x5433027d, 0x5fe3b38d, 0x54ca0a4b, 0x5f5e0db3, 0x556040e2,
+  0x5ed77c8a, 0x55f5a4d2, 0x5e50015d, 0x568a34a9, 0x5dc79d7c, 0x571deefa,
+  0x5d3e5237, 0x57b0d256, 0x5cb420e0, 0x5842dd54, 0x5c290acc, 0x58d40e8c,
+  0x5b9d1154, 0x59646498, 0x5b1035cf, 0x59f3de12, 0x5a82799a, 0x5a82799a,
+  0x59f3de12, 0x5b1035cf, 0x59646498, 0x5b9d1154, 0x58d40e8c, 0x5c290acc,
+  0x5842dd54, 0x5cb420e0, 0x57b0d256, 0x5d3e5237, 0x571deefa, 0x5dc79d7c,
+  0x568a34a9, 0x5e50015d, 0x55f5a4d2, 0x5ed77c8a, 0x556040e2, 0x5f5e0db3,
+  0x54ca0a4b, 0x5fe3b38d, 0x5433027d, 0x60686ccf, 0x539b2af0, 0x60ec3830,
+  0x53028518, 0x616f146c, 0x5269126e, 0x61f1003f, 0x51ced46e, 0x6271fa69,
+  0x5133cc94, 0x62f201ac, 0x5097fc5e, 0x637114cc, 0x4ffb654d, 0x63ef3290,
+  0x4f5e08e3, 0x646c59bf, 0x4ebfe8a5, 0x64e88926, 0x4e210617, 0x6563bf92,
+  0x4d8162c4, 0x65ddfbd3, 0x4ce10034, 0x66573cbb, 0x4c3fdff4, 0x66cf8120,
+  0x4b9e0390, 0x6746c7d8, 0x4afb6c98, 0x67bd0fbd, 0x4a581c9e, 0x683257ab,
+  0x49b41533, 0x68a69e81, 0x490f57ee, 0x6919e320, 0x4869e665, 0x698c246c,
+  0x47c3c22f, 0x69fd614a, 0x471cece7, 0x6a6d98a4, 0x46756828, 0x6adcc964,
+  0x45cd358f, 0x6b4af279, 0x452456bd, 0x6bb812d1, 0x447acd50, 0x6c242960,
+  0x43d09aed, 0x6c8f351c, 0x4325c135, 0x6cf934fc, 0x427a41d0, 0x6d6227fa,
+  0x41ce1e65, 0x6dca0d14, 0x4121589b, 0x6e30e34a, 0x4073f21d, 0x6e96a99d,
+  0x3fc5ec98, 0x6efb5f12, 0x3f1749b8, 0x6f5f02b2, 0x3e680b2c, 0x6fc19385,
+  0x3db832a6, 0x7023109a, 0x3d07c1d6, 0x708378ff, 0x3c56ba70, 0x70e2cbc6,
+  0x3ba51e29, 0x71410805, 0x3af2eeb7, 0x719e2cd2, 0x3a402dd2, 0x71fa3949,
+  0x398cdd32, 0x72552c85, 0x38d8fe93, 0x72af05a7, 0x382493b0, 0x7307c3d0,
+  0x376f9e46, 0x735f6626, 0x36ba2014, 0x73b5ebd1, 0x36041ad9, 0x740b53fb,
+  0x354d9057, 0x745f9dd1, 0x34968250, 0x74b2c884, 0x33def287, 0x7504d345,
+  0x3326e2c3, 0x7555bd4c, 0x326e54c7, 0x75a585cf, 0x31b54a5e, 0x75f42c0b,
+  0x30fbc54d, 0x7641af3d, 0x3041c761, 0x768e0ea6, 0x2f875262, 0x76d94989,
+  0x2ecc681e, 0x77235f2d, 0x2e110a62, 0x776c4edb, 0x2d553afc, 0x77b417df,
+  0x2c98fbba, 0x77fab989, 0x2bdc4e6f, 0x78403329, 0x2b1f34eb, 0x78848414,
+  0x2a61b101, 0x78c7aba2, 0x29a3c485, 0x7909a92d, 0x28e5714b, 0x794a7c12,
+  0x2826b928, 0x798a23b1, 0x27679df4, 0x79c89f6e, 0x26a82186, 0x7a05eead,
+  0x25e845b6, 0x7a4210d8, 0x25280c5e, 0x7a7d055b, 0x24677758, 0x7ab6cba4,
+  0x23a6887f, 0x7aef6323, 0x22e541af, 0x7b26cb4f, 0x2223a4c5, 0x7b5d039e,
+  0x2161b3a0, 0x7b920b89, 0x209f701c, 0x7bc5e290, 0x1fdcdc1b, 0x7bf88830,
+  0x1f19f97b, 0x7c29fbee, 0x1e56ca1e, 0x7c5a3d50, 0x1d934fe5, 0x7c894bde,
+  0x1ccf8cb3, 0x7cb72724, 0x1c0b826a, 0x7ce3ceb2, 0x1b4732ef, 0x7d0f4218,
+  0x1a82a026, 0x7d3980ec, 0x19bdcbf3, 0x7d628ac6, 0x18f8b83c, 0x7d8a5f40,
+  0x183366e9, 0x7db0fdf8, 0x176dd9de, 0x7dd6668f, 0x16a81305, 0x7dfa98a8,
+  0x15e21445, 0x7e1d93ea, 0x151bdf86, 0x7e3f57ff, 0x145576b1, 0x7e5fe493,
+  0x138edbb1, 0x7e7f3957, 0x12c8106f, 0x7e9d55fc, 0x120116d5, 0x7eba3a39,
+  0x1139f0cf, 0x7ed5e5c6, 0x1072a048, 0x7ef05860, 0xfab272b, 0x7f0991c4,
+  0xee38766, 0x7f2191b4, 0xe1bc2e4, 0x7f3857f6, 0xd53db92, 0x7f4de451,
+  0xc8bd35e, 0x7f62368f, 0xbc3ac35, 0x7f754e80, 0xafb6805, 0x7f872bf3,
+  0xa3308bd, 0x7f97cebd, 0x96a9049, 0x7fa736b4, 0x8a2009a, 0x7fb563b3,
+  0x7d95b9e, 0x7fc25596, 0x710a345, 0x7fce0c3e, 0x647d97c, 0x7fd8878e,
+  0x57f0035, 0x7fe1c76b, 0x4b6195d, 0x7fe9cbc0, 0x3ed26e6, 0x7ff09478,
+  0x3242abf, 0x7ff62182, 0x25b26d7, 0x7ffa72d1, 0x1921d20, 0x7ffd885a,
+  0xc90f88, 0x7fff6216, 0x0, 0x7fffffff, 0xff36f078, 0x7fff6216,
+  0xfe6de2e0, 0x7ffd885a, 0xfda4d929, 0x7ffa72d1, 0xfcdbd541, 0x7ff62182,
+  0xfc12d91a, 0x7ff09478, 0xfb49e6a3, 0x7fe9cbc0, 0xfa80ffcb, 0x7fe1c76b,
+  0xf9b82684, 0x7fd8878e, 0xf8ef5cbb, 0x7fce0c3e, 0xf826a462, 0x7fc25596,
+  0xf75dff66, 0x7fb563b3, 0xf6956fb7, 0x7fa736b4, 0xf5ccf743, 0x7f97cebd,
+  0xf50497fb, 0x7f872bf3, 0xf43c53cb, 0x7f754e80, 0xf3742ca2, 0x7f62368f,
+  0xf2ac246e, 0x7f4de451, 0xf1e43d1c, 0x7f3857f6, 0xf11c789a, 0x7f2191b4,
+  0xf054d8d5, 0x7f0991c4, 0xef8d5fb8, 0x7ef05860, 0xeec60f31, 0x7ed5e5c6,
+  0xedfee92b, 0x7eba3a39, 0xed37ef91, 0x7e9d55fc, 0xec71244f, 0x7e7f3957,
+  0xebaa894f, 0x7e5fe493, 0xeae4207a, 0x7e3f57ff, 0xea1debbb, 0x7e1d93ea,
+  0xe957ecfb, 0x7dfa98a8, 0xe8922622, 0x7dd6668f, 0xe7cc9917, 0x7db0fdf8,
+  0xe70747c4, 0x7d8a5f40, 0xe642340d, 0x7d628ac6, 0xe57d5fda, 0x7d3980ec,
+  0xe4b8cd11, 0x7d0f4218, 0xe3f47d96, 0x7ce3ceb2, 0xe330734d, 0x7cb72724,
+  0xe26cb01b, 0x7c894bde, 0xe1a935e2, 0x7c5a3d50, 0xe0e60685, 0x7c29fbee,
+  0xe02323e5, 0x7bf88830, 0xdf608fe4, 0x7bc5e290, 0xde9e4c60, 0x7b920b89,
+  0xdddc5b3b, 0x7b5d039e, 0xdd1abe51, 0x7b26cb4f, 0xdc597781, 0x7aef6323,
+  0xdb9888a8, 0x7ab6cba4, 0xdad7f3a2, 0x7a7d055b, 0xda17ba4a, 0x7a4210d8,
+  0xd957de7a, 0x7a05eead, 0xd898620c, 0x79c89f6e, 0xd7d946d8, 0x798a23b1,
+  0xd71a8eb5, 0x794a7c12, 0xd65c3b7b, 0x7909a92d, 0xd59e4eff, 0x78c7aba2,
+  0xd4e0cb15, 0x78848414, 0xd423b191, 0x78403329, 0xd3670446, 0x77fab989,
+  0xd2aac504, 0x77b417df, 0xd1eef59e, 0x776c4edb, 0xd13397e2, 0x77235f2d,
+  0xd078ad9e, 0x76d94989, 0xcfbe389f, 0x768e0ea6, 0xcf043ab3, 0x7641af3d,
+  0xce4ab5a2, 0x75f42c0b, 0xcd91ab39, 0x75a585cf, 0xccd91d3d, 0x7555bd4c,
+  0xcc210d79, 0x7504d345, 0xcb697db0, 0x74b2c884, 0xcab26fa9, 0x745f9dd1,
+  0xc9fbe527, 0x740b53fb, 0xc945dfec, 0x73b5ebd1, 0xc89061ba, 0x735f6626,
+  0xc7db6c50, 0x7307c3d0, 0xc727016d, 0x72af05a7, 0xc67322ce, 0x72552c85,
+  0xc5bfd22e, 0x71fa3949, 0xc50d1149, 0x719e2cd2, 0xc45ae1d7, 0x71410805,
+  0xc3a94590, 0x70e2cbc6, 0xc2f83e2a, 0x708378ff, 0xc247cd5a, 0x7023109a,
+  0xc197f4d4, 0x6fc19385, 0xc0e8b648, 0x6f5f02b2, 0xc03a1368, 0x6efb5f12,
+  0xbf8c0de3, 0x6e96a99d, 0xbedea765, 0x6e30e34a, 0xbe31e19b, 0x6dca0d14,
+  0xbd85be30, 0x6d6227fa, 0xbcda3ecb, 0x6cf934fc, 0xbc2f6513, 0x6c8f351c,
+  0xbb8532b0, 0x6c242960, 0xbadba943, 0x6bb812d1, 0xba32ca71, 0x6b4af279,
+  0xb98a97d8, 0x6adcc964, 0xb8e31319, 0x6a6d98a4, 0xb83c3dd1, 0x69fd614a,
+  0xb796199b, 0x698c246c, 0xb6f0a812, 0x6919e320, 0xb64beacd, 0x68a69e81,
+  0xb5a7e362, 0x683257ab, 0xb5049368, 0x67bd0fbd, 0xb461fc70, 0x6746c7d8,
+  0xb3c0200c, 0x66cf8120, 0xb31effcc, 0x66573cbb, 0xb27e9d3c, 0x65ddfbd3,
+  0xb1def9e9, 0x6563bf92, 0xb140175b, 0x64e88926, 0xb0a1f71d, 0x646c59bf,
+  0xb0049ab3, 0x63ef3290, 0xaf6803a2, 0x637114cc, 0xaecc336c, 0x62f201ac,
+  0xae312b92, 0x6271fa69, 0xad96ed92, 0x61f1003f, 0xacfd7ae8, 0x616f146c,
+  0xac64d510, 0x60ec3830, 0xabccfd83, 0x60686ccf, 0xab35f5b5, 0x5fe3b38d,
+  0xaa9fbf1e, 0x5f5e0db3, 0xaa0a5b2e, 0x5ed77c8a, 0xa975cb57, 0x5e50015d,
+  0xa8e21106, 0x5dc79d7c, 0xa84f2daa, 0x5d3e5237, 0xa7bd22ac, 0x5cb420e0,
+  0xa72bf174, 0x5c290acc, 0xa69b9b68, 0x5b9d1154, 0xa60c21ee, 0x5b1035cf,
+  0xa57d8666, 0x5a82799a, 0xa4efca31, 0x59f3de12, 0xa462eeac, 0x59646498,
+  0xa3d6f534, 0x58d40e8c, 0xa34bdf20, 0x5842dd54, 0xa2c1adc9, 0x57b0d256,
+  0xa2386284, 0x571deefa, 0xa1affea3, 0x568a34a9, 0xa1288376, 0x55f5a4d2,
+  0xa0a1f24d, 0x556040e2, 0xa01c4c73, 0x54ca0a4b, 0x9f979331, 0x5433027d,
+  0x9f13c7d0, 0x539b2af0, 0x9e90eb94, 0x53028518, 0x9e0effc1, 0x5269126e,
+  0x9d8e0597, 0x51ced46e, 0x9d0dfe54, 0x5133cc94, 0x9c8eeb34, 0x5097fc5e,
+  0x9c10cd70, 0x4ffb654d, 0x9b93a641, 0x4f5e08e3, 0x9b1776da, 0x4ebfe8a5,
+  0x9a9c406e, 0x4e210617, 0x9a22042d, 0x4d8162c4, 0x99a8c345, 0x4ce10034,
+  0x99307ee0, 0x4c3fdff4, 0x98b93828, 0x4b9e0390, 0x9842f043, 0x4afb6c98,
+  0x97cda855, 0x4a581c9e, 0x9759617f, 0x49b41533, 0x96e61ce0, 0x490f57ee,
+  0x9673db94, 0x4869e665, 0x96029eb6, 0x47c3c22f, 0x9592675c, 0x471cece7,
+  0x9523369c, 0x46756828, 0x94b50d87, 0x45cd358f, 0x9447ed2f, 0x452456bd,
+  0x93dbd6a0, 0x447acd50, 0x9370cae4, 0x43d09aed, 0x9306cb04, 0x4325c135,
+  0x929dd806, 0x427a41d0, 0x9235f2ec, 0x41ce1e65, 0x91cf1cb6, 0x4121589b,
+  0x91695663, 0x4073f21d, 0x9104a0ee, 0x3fc5ec98, 0x90a0fd4e, 0x3f1749b8,
+  0x903e6c7b, 0x3e680b2c, 0x8fdcef66, 0x3db832a6, 0x8f7c8701, 0x3d07c1d6,
+  0x8f1d343a, 0x3c56ba70, 0x8ebef7fb, 0x3ba51e29, 0x8e61d32e, 0x3af2eeb7,
+  0x8e05c6b7, 0x3a402dd2, 0x8daad37b, 0x398cdd32, 0x8d50fa59, 0x38d8fe93,
+  0x8cf83c30, 0x382493b0, 0x8ca099da, 0x376f9e46, 0x8c4a142f, 0x36ba2014,
+  0x8bf4ac05, 0x36041ad9, 0x8ba0622f, 0x354d9057, 0x8b4d377c, 0x34968250,
+  0x8afb2cbb, 0x33def287, 0x8aaa42b4, 0x3326e2c3, 0x8a5a7a31, 0x326e54c7,
+  0x8a0bd3f5, 0x31b54a5e, 0x89be50c3, 0x30fbc54d, 0x8971f15a, 0x3041c761,
+  0x8926b677, 0x2f875262, 0x88dca0d3, 0x2ecc681e, 0x8893b125, 0x2e110a62,
+  0x884be821, 0x2d553afc, 0x88054677, 0x2c98fbba, 0x87bfccd7, 0x2bdc4e6f,
+  0x877b7bec, 0x2b1f34eb, 0x8738545e, 0x2a61b101, 0x86f656d3, 0x29a3c485,
+  0x86b583ee, 0x28e5714b, 0x8675dc4f, 0x2826b928, 0x86376092, 0x27679df4,
+  0x85fa1153, 0x26a82186, 0x85bdef28, 0x25e845b6, 0x8582faa5, 0x25280c5e,
+  0x8549345c, 0x24677758, 0x85109cdd, 0x23a6887f, 0x84d934b1, 0x22e541af,
+  0x84a2fc62, 0x2223a4c5, 0x846df477, 0x2161b3a0, 0x843a1d70, 0x209f701c,
+  0x840777d0, 0x1fdcdc1b, 0x83d60412, 0x1f19f97b, 0x83a5c2b0, 0x1e56ca1e,
+  0x8376b422, 0x1d934fe5, 0x8348d8dc, 0x1ccf8cb3, 0x831c314e, 0x1c0b826a,
+  0x82f0bde8, 0x1b4732ef, 0x82c67f14, 0x1a82a026, 0x829d753a, 0x19bdcbf3,
+  0x8275a0c0, 0x18f8b83c, 0x824f0208, 0x183366e9, 0x82299971, 0x176dd9de,
+  0x82056758, 0x16a81305, 0x81e26c16, 0x15e21445, 0x81c0a801, 0x151bdf86,
+  0x81a01b6d, 0x145576b1, 0x8180c6a9, 0x138edbb1, 0x8162aa04, 0x12c8106f,
+  0x8145c5c7, 0x120116d5, 0x812a1a3a, 0x1139f0cf, 0x810fa7a0, 0x1072a048,
+  0x80f66e3c, 0xfab272b, 0x80de6e4c, 0xee38766, 0x80c7a80a, 0xe1bc2e4,
+  0x80b21baf, 0xd53db92, 0x809dc971, 0xc8bd35e, 0x808ab180, 0xbc3ac35,
+  0x8078d40d, 0xafb6805, 0x80683143, 0xa3308bd, 0x8058c94c, 0x96a9049,
+  0x804a9c4d, 0x8a2009a, 0x803daa6a, 0x7d95b9e, 0x8031f3c2, 0x710a345,
+  0x80277872, 0x647d97c, 0x801e3895, 0x57f0035, 0x80163440, 0x4b6195d,
+  0x800f6b88, 0x3ed26e6, 0x8009de7e, 0x3242abf, 0x80058d2f, 0x25b26d7,
+  0x800277a6, 0x1921d20, 0x80009dea, 0xc90f88, 0x80000000, 0x0,
+  0x80009dea, 0xff36f078, 0x800277a6, 0xfe6de2e0, 0x80058d2f, 0xfda4d929,
+  0x8009de7e, 0xfcdbd541, 0x800f6b88, 0xfc12d91a, 0x80163440, 0xfb49e6a3,
+  0x801e3895, 0xfa80ffcb, 0x80277872, 0xf9b82684, 0x8031f3c2, 0xf8ef5cbb,
+  0x803daa6a, 0xf826a462, 0x804a9c4d, 0xf75dff66, 0x8058c94c, 0xf6956fb7,
+  0x80683143, 0xf5ccf743, 0x8078d40d, 0xf50497fb, 0x808ab180, 0xf43c53cb,
+  0x809dc971, 0xf3742ca2, 0x80b21baf, 0xf2ac246e, 0x80c7a80a, 0xf1e43d1c,
+  0x80de6e4c, 0xf11c789a, 0x80f66e3c, 0xf054d8d5, 0x810fa7a0, 0xef8d5fb8,
+  0x812a1a3a, 0xeec60f31, 0x8145c5c7, 0xedfee92b, 0x8162aa04, 0xed37ef91,
+  0x8180c6a9, 0xec71244f, 0x81a01b6d, 0xebaa894f, 0x81c0a801, 0xeae4207a,
+  0x81e26c16, 0xea1debbb, 0x82056758, 0xe957ecfb, 0x82299971, 0xe8922622,
+  0x824f0208, 0xe7cc9917, 0x8275a0c0, 0xe70747c4, 0x829d753a, 0xe642340d,
+  0x82c67f14, 0xe57d5fda, 0x82f0bde8, 0xe4b8cd11, 0x831c314e, 0xe3f47d96,
+  0x8348d8dc, 0xe330734d, 0x8376b422, 0xe26cb01b, 0x83a5c2b0, 0xe1a935e2,
+  0x83d60412, 0xe0e60685, 0x840777d0, 0xe02323e5, 0x843a1d70, 0xdf608fe4,
+  0x846df477, 0xde9e4c60, 0x84a2fc62, 0xdddc5b3b, 0x84d934b1, 0xdd1abe51,
+  0x85109cdd, 0xdc597781, 0x8549345c, 0xdb9888a8, 0x8582faa5, 0xdad7f3a2,
+  0x85bdef28, 0xda17ba4a, 0x85fa1153, 0xd957de7a, 0x86376092, 0xd898620c,
+  0x8675dc4f, 0xd7d946d8, 0x86b583ee, 0xd71a8eb5, 0x86f656d3, 0xd65c3b7b,
+  0x8738545e, 0xd59e4eff, 0x877b7bec, 0xd4e0cb15, 0x87bfccd7, 0xd423b191,
+  0x88054677, 0xd3670446, 0x884be821, 0xd2aac504, 0x8893b125, 0xd1eef59e,
+  0x88dca0d3, 0xd13397e2, 0x8926b677, 0xd078ad9e, 0x8971f15a, 0xcfbe389f,
+  0x89be50c3, 0xcf043ab3, 0x8a0bd3f5, 0xce4ab5a2, 0x8a5a7a31, 0xcd91ab39,
+  0x8aaa42b4, 0xccd91d3d, 0x8afb2cbb, 0xcc210d79, 0x8b4d377c, 0xcb697db0,
+  0x8ba0622f, 0xcab26fa9, 0x8bf4ac05, 0xc9fbe527, 0x8c4a142f, 0xc945dfec,
+  0x8ca099da, 0xc89061ba, 0x8cf83c30, 0xc7db6c50, 0x8d50fa59, 0xc727016d,
+  0x8daad37b, 0xc67322ce, 0x8e05c6b7, 0xc5bfd22e, 0x8e61d32e, 0xc50d1149,
+  0x8ebef7fb, 0xc45ae1d7, 0x8f1d343a, 0xc3a94590, 0x8f7c8701, 0xc2f83e2a,
+  0x8fdcef66, 0xc247cd5a, 0x903e6c7b, 0xc197f4d4, 0x90a0fd4e, 0xc0e8b648,
+  0x9104a0ee, 0xc03a1368, 0x91695663, 0xbf8c0de3, 0x91cf1cb6, 0xbedea765,
+  0x9235f2ec, 0xbe31e19b, 0x929dd806, 0xbd85be30, 0x9306cb04, 0xbcda3ecb,
+  0x9370cae4, 0xbc2f6513, 0x93dbd6a0, 0xbb8532b0, 0x9447ed2f, 0xbadba943,
+  0x94b50d87, 0xba32ca71, 0x9523369c, 0xb98a97d8, 0x9592675c, 0xb8e31319,
+  0x96029eb6, 0xb83c3dd1, 0x9673db94, 0xb796199b, 0x96e61ce0, 0xb6f0a812,
+  0x9759617f, 0xb64beacd, 0x97cda855, 0xb5a7e362, 0x9842f043, 0xb5049368,
+  0x98b93828, 0xb461fc70, 0x99307ee0, 0xb3c0200c, 0x99a8c345, 0xb31effcc,
+  0x9a22042d, 0xb27e9d3c, 0x9a9c406e, 0xb1def9e9, 0x9b1776da, 0xb140175b,
+  0x9b93a641, 0xb0a1f71d, 0x9c10cd70, 0xb0049ab3, 0x9c8eeb34, 0xaf6803a2,
+  0x9d0dfe54, 0xaecc336c, 0x9d8e0597, 0xae312b92, 0x9e0effc1, 0xad96ed92,
+  0x9e90eb94, 0xacfd7ae8, 0x9f13c7d0, 0xac64d510, 0x9f979331, 0xabccfd83,
+  0xa01c4c73, 0xab35f5b5, 0xa0a1f24d, 0xaa9fbf1e, 0xa1288376, 0xaa0a5b2e,
+  0xa1affea3, 0xa975cb57, 0xa2386284, 0xa8e21106, 0xa2c1adc9, 0xa84f2daa,
+  0xa34bdf20, 0xa7bd22ac, 0xa3d6f534, 0xa72bf174, 0xa462eeac, 0xa69b9b68,
+  0xa4efca31, 0xa60c21ee, 0xa57d8666, 0xa57d8666, 0xa60c21ee, 0xa4efca31,
+  0xa69b9b68, 0xa462eeac, 0xa72bf174, 0xa3d6f534, 0xa7bd22ac, 0xa34bdf20,
+  0xa84f2daa, 0xa2c1adc9, 0xa8e21106, 0xa2386284, 0xa975cb57, 0xa1affea3,
+  0xaa0a5b2e, 0xa1288376, 0xaa9fbf1e, 0xa0a1f24d, 0xab35f5b5, 0xa01c4c73,
+  0xabccfd83, 0x9f979331, 0xac64d510, 0x9f13c7d0, 0xacfd7ae8, 0x9e90eb94,
+  0xad96ed92, 0x9e0effc1, 0xae312b92, 0x9d8e0597, 0xaecc336c, 0x9d0dfe54,
+  0xaf6803a2, 0x9c8eeb34, 0xb0049ab3, 0x9c10cd70, 0xb0a1f71d, 0x9b93a641,
+  0xb140175b, 0x9b1776da, 0xb1def9e9, 0x9a9c406e, 0xb27e9d3c, 0x9a22042d,
+  0xb31effcc, 0x99a8c345, 0xb3c0200c, 0x99307ee0, 0xb461fc70, 0x98b93828,
+  0xb5049368, 0x9842f043, 0xb5a7e362, 0x97cda855, 0xb64beacd, 0x9759617f,
+  0xb6f0a812, 0x96e61ce0, 0xb796199b, 0x9673db94, 0xb83c3dd1, 0x96029eb6,
+  0xb8e31319, 0x9592675c, 0xb98a97d8, 0x9523369c, 0xba32ca71, 0x94b50d87,
+  0xbadba943, 0x9447ed2f, 0xbb8532b0, 0x93dbd6a0, 0xbc2f6513, 0x9370cae4,
+  0xbcda3ecb, 0x9306cb04, 0xbd85be30, 0x929dd806, 0xbe31e19b, 0x9235f2ec,
+  0xbedea765, 0x91cf1cb6, 0xbf8c0de3, 0x91695663, 0xc03a1368, 0x9104a0ee,
+  0xc0e8b648, 0x90a0fd4e, 0xc197f4d4, 0x903e6c7b, 0xc247cd5a, 0x8fdcef66,
+  0xc2f83e2a, 0x8f7c8701, 0xc3a94590, 0x8f1d343a, 0xc45ae1d7, 0x8ebef7fb,
+  0xc50d1149, 0x8e61d32e, 0xc5bfd22e, 0x8e05c6b7, 0xc67322ce, 0x8daad37b,
+  0xc727016d, 0x8d50fa59, 0xc7db6c50, 0x8cf83c30, 0xc89061ba, 0x8ca099da,
+  0xc945dfec, 0x8c4a142f, 0xc9fbe527, 0x8bf4ac05, 0xcab26fa9, 0x8ba0622f,
+  0xcb697db0, 0x8b4d377c, 0xcc210d79, 0x8afb2cbb, 0xccd91d3d, 0x8aaa42b4,
+  0xcd91ab39, 0x8a5a7a31, 0xce4ab5a2, 0x8a0bd3f5, 0xcf043ab3, 0x89be50c3,
+  0xcfbe389f, 0x8971f15a, 0xd078ad9e, 0x8926b677, 0xd13397e2, 0x88dca0d3,
+  0xd1eef59e, 0x8893b125, 0xd2aac504, 0x884be821, 0xd3670446, 0x88054677,
+  0xd423b191, 0x87bfccd7, 0xd4e0cb15, 0x877b7bec, 0xd59e4eff, 0x8738545e,
+  0xd65c3b7b, 0x86f656d3, 0xd71a8eb5, 0x86b583ee, 0xd7d946d8, 0x8675dc4f,
+  0xd898620c, 0x86376092, 0xd957de7a, 0x85fa1153, 0xda17ba4a, 0x85bdef28,
+  0xdad7f3a2, 0x8582faa5, 0xdb9888a8, 0x8549345c, 0xdc597781, 0x85109cdd,
+  0xdd1abe51, 0x84d934b1, 0xdddc5b3b, 0x84a2fc62, 0xde9e4c60, 0x846df477,
+  0xdf608fe4, 0x843a1d70, 0xe02323e5, 0x840777d0, 0xe0e60685, 0x83d60412,
+  0xe1a935e2, 0x83a5c2b0, 0xe26cb01b, 0x8376b422, 0xe330734d, 0x8348d8dc,
+  0xe3f47d96, 0x831c314e, 0xe4b8cd11, 0x82f0bde8, 0xe57d5fda, 0x82c67f14,
+  0xe642340d, 0x829d753a, 0xe70747c4, 0x8275a0c0, 0xe7cc9917, 0x824f0208,
+  0xe8922622, 0x82299971, 0xe957ecfb, 0x82056758, 0xea1debbb, 0x81e26c16,
+  0xeae4207a, 0x81c0a801, 0xebaa894f, 0x81a01b6d, 0xec71244f, 0x8180c6a9,
+  0xed37ef91, 0x8162aa04, 0xedfee92b, 0x8145c5c7, 0xeec60f31, 0x812a1a3a,
+  0xef8d5fb8, 0x810fa7a0, 0xf054d8d5, 0x80f66e3c, 0xf11c789a, 0x80de6e4c,
+  0xf1e43d1c, 0x80c7a80a, 0xf2ac246e, 0x80b21baf, 0xf3742ca2, 0x809dc971,
+  0xf43c53cb, 0x808ab180, 0xf50497fb, 0x8078d40d, 0xf5ccf743, 0x80683143,
+  0xf6956fb7, 0x8058c94c, 0xf75dff66, 0x804a9c4d, 0xf826a462, 0x803daa6a,
+  0xf8ef5cbb, 0x8031f3c2, 0xf9b82684, 0x80277872, 0xfa80ffcb, 0x801e3895,
+  0xfb49e6a3, 0x80163440, 0xfc12d91a, 0x800f6b88, 0xfcdbd541, 0x8009de7e,
+  0xfda4d929, 0x80058d2f, 0xfe6de2e0, 0x800277a6, 0xff36f078, 0x80009dea
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+const q31_t twiddleCoefQ31[384] = {
+  0x7fffffff, 0x0, 0x7ff62182, 0x3242abf, 0x7fd8878e, 0x647d97c,
+  0x7fa736b4, 0x96a9049, 0x7f62368f, 0xc8bd35e, 0x7f0991c4, 0xfab272b,
+  0x7e9d55fc, 0x12c8106f, 0x7e1d93ea, 0x15e21445, 0x7d8a5f40, 0x18f8b83c,
+  0x7ce3ceb2, 0x1c0b826a, 0x7c29fbee, 0x1f19f97b, 0x7b5d039e, 0x2223a4c5,
+  0x7a7d055b, 0x25280c5e, 0x798a23b1, 0x2826b928, 0x78848414, 0x2b1f34eb,
+  0x776c4edb, 0x2e110a62, 0x7641af3d, 0x30fbc54d, 0x7504d345, 0x33def287,
+  0x73b5ebd1, 0x36ba2014, 0x72552c85, 0x398cdd32, 0x70e2cbc6, 0x3c56ba70,
+  0x6f5f02b2, 0x3f1749b8, 0x6dca0d14, 0x41ce1e65, 0x6c242960, 0x447acd50,
+  0x6a6d98a4, 0x471cece7, 0x68a69e81, 0x49b41533, 0x66cf8120, 0x4c3fdff4,
+  0x64e88926, 0x4ebfe8a5, 0x62f201ac, 0x5133cc94, 0x60ec3830, 0x539b2af0,
+  0x5ed77c8a, 0x55f5a4d2, 0x5cb420e0, 0x5842dd54, 0x5a82799a, 0x5a82799a,
+  0x5842dd54, 0x5cb420e0, 0x55f5a4d2, 0x5ed77c8a, 0x539b2af0, 0x60ec3830,
+  0x5133cc94, 0x62f201ac, 0x4ebfe8a5, 0x64e88926, 0x4c3fdff4, 0x66cf8120,
+  0x49b41533, 0x68a69e81, 0x471cece7, 0x6a6d98a4, 0x447acd50, 0x6c242960,
+  0x41ce1e65, 0x6dca0d14, 0x3f1749b8, 0x6f5f02b2, 0x3c56ba70, 0x70e2cbc6,
+  0x398cdd32, 0x72552c85, 0x36ba2014, 0x73b5ebd1, 0x33def287, 0x7504d345,
+  0x30fbc54d, 0x7641af3d, 0x2e110a62, 0x776c4edb, 0x2b1f34eb, 0x78848414,
+  0x2826b928, 0x798a23b1, 0x25280c5e, 0x7a7d055b, 0x2223a4c5, 0x7b5d039e,
+  0x1f19f97b, 0x7c29fbee, 0x1c0b826a, 0x7ce3ceb2, 0x18f8b83c, 0x7d8a5f40,
+  0x15e21445, 0x7e1d93ea, 0x12c8106f, 0x7e9d55fc, 0xfab272b, 0x7f0991c4,
+  0xc8bd35e, 0x7f62368f, 0x96a9049, 0x7fa736b4, 0x647d97c, 0x7fd8878e,
+  0x3242abf, 0x7ff62182, 0x0, 0x7fffffff, 0xfcdbd541, 0x7ff62182,
+  0xf9b82684, 0x7fd8878e, 0xf6956fb7, 0x7fa736b4, 0xf3742ca2, 0x7f62368f,
+  0xf054d8d5, 0x7f0991c4, 0xed37ef91, 0x7e9d55fc, 0xea1debbb, 0x7e1d93ea,
+  0xe70747c4, 0x7d8a5f40, 0xe3f47d96, 0x7ce3ceb2, 0xe0e60685, 0x7c29fbee,
+  0xdddc5b3b, 0x7b5d039e, 0xdad7f3a2, 0x7a7d055b, 0xd7d946d8, 0x798a23b1,
+  0xd4e0cb15, 0x78848414, 0xd1eef59e, 0x776c4edb, 0xcf043ab3, 0x7641af3d,
+  0xcc210d79, 0x7504d345, 0xc945dfec, 0x73b5ebd1, 0xc67322ce, 0x72552c85,
+  0xc3a94590, 0x70e2cbc6, 0xc0e8b648, 0x6f5f02b2, 0xbe31e19b, 0x6dca0d14,
+  0xbb8532b0, 0x6c242960, 0xb8e31319, 0x6a6d98a4, 0xb64beacd, 0x68a69e81,
+  0xb3c0200c, 0x66cf8120, 0xb140175b, 0x64e88926, 0xaecc336c, 0x62f201ac,
+  0xac64d510, 0x60ec3830, 0xaa0a5b2e, 0x5ed77c8a, 0xa7bd22ac, 0x5cb420e0,
+  0xa57d8666, 0x5a82799a, 0xa34bdf20, 0x5842dd54, 0xa1288376, 0x55f5a4d2,
+  0x9f13c7d0, 0x539b2af0, 0x9d0dfe54, 0x5133cc94, 0x9b1776da, 0x4ebfe8a5,
+  0x99307ee0, 0x4c3fdff4, 0x9759617f, 0x49b41533, 0x9592675c, 0x471cece7,
+  0x93dbd6a0, 0x447acd50, 0x9235f2ec, 0x41ce1e65, 0x90a0fd4e, 0x3f1749b8,
+  0x8f1d343a, 0x3c56ba70, 0x8daad37b, 0x398cdd32, 0x8c4a142f, 0x36ba2014,
+  0x8afb2cbb, 0x33def287, 0x89be50c3, 0x30fbc54d, 0x8893b125, 0x2e110a62,
+  0x877b7bec, 0x2b1f34eb, 0x8675dc4f, 0x2826b928, 0x8582faa5, 0x25280c5e,
+  0x84a2fc62, 0x2223a4c5, 0x83d60412, 0x1f19f97b, 0x831c314e, 0x1c0b826a,
+  0x8275a0c0, 0x18f8b83c, 0x81e26c16, 0x15e21445, 0x8162aa04, 0x12c8106f,
+  0x80f66e3c, 0xfab272b, 0x809dc971, 0xc8bd35e, 0x8058c94c, 0x96a9049,
+  0x80277872, 0x647d97c, 0x8009de7e, 0x3242abf, 0x80000000, 0x0,
+  0x8009de7e, 0xfcdbd541, 0x80277872, 0xf9b82684, 0x8058c94c, 0xf6956fb7,
+  0x809dc971, 0xf3742ca2, 0x80f66e3c, 0xf054d8d5, 0x8162aa04, 0xed37ef91,
+  0x81e26c16, 0xea1debbb, 0x8275a0c0, 0xe70747c4, 0x831c314e, 0xe3f47d96,
+  0x83d60412, 0xe0e60685, 0x84a2fc62, 0xdddc5b3b, 0x8582faa5, 0xdad7f3a2,
+  0x8675dc4f, 0xd7d946d8, 0x877b7bec, 0xd4e0cb15, 0x8893b125, 0xd1eef59e,
+  0x89be50c3, 0xcf043ab3, 0x8afb2cbb, 0xcc210d79, 0x8c4a142f, 0xc945dfec,
+  0x8daad37b, 0xc67322ce, 0x8f1d343a, 0xc3a94590, 0x90a0fd4e, 0xc0e8b648,
+  0x9235f2ec, 0xbe31e19b, 0x93dbd6a0, 0xbb8532b0, 0x9592675c, 0xb8e31319,
+  0x9759617f, 0xb64beacd, 0x99307ee0, 0xb3c0200c, 0x9b1776da, 0xb140175b,
+  0x9d0dfe54, 0xaecc336c, 0x9f13c7d0, 0xac64d510, 0xa1288376, 0xaa0a5b2e,
+  0xa34bdf20, 0xa7bd22ac, 0xa57d8666, 0xa57d8666, 0xa7bd22ac, 0xa34bdf20,
+  0xaa0a5b2e, 0xa1288376, 0xac64d510, 0x9f13c7d0, 0xaecc336c, 0x9d0dfe54,
+  0xb140175b, 0x9b1776da, 0xb3c0200c, 0x99307ee0, 0xb64beacd, 0x9759617f,
+  0xb8e31319, 0x9592675c, 0xbb8532b0, 0x93dbd6a0, 0xbe31e19b, 0x9235f2ec,
+  0xc0e8b648, 0x90a0fd4e, 0xc3a94590, 0x8f1d343a, 0xc67322ce, 0x8daad37b,
+  0xc945dfec, 0x8c4a142f, 0xcc210d79, 0x8afb2cbb, 0xcf043ab3, 0x89be50c3,
+  0xd1eef59e, 0x8893b125, 0xd4e0cb15, 0x877b7bec, 0xd7d946d8, 0x8675dc4f,
+  0xdad7f3a2, 0x8582faa5, 0xdddc5b3b, 0x84a2fc62, 0xe0e60685, 0x83d60412,
+  0xe3f47d96, 0x831c314e, 0xe70747c4, 0x8275a0c0, 0xea1debbb, 0x81e26c16,
+  0xed37ef91, 0x8162aa04, 0xf054d8d5, 0x80f66e3c, 0xf3742ca2, 0x809dc971,
+  0xf6956fb7, 0x8058c94c, 0xf9b82684, 0x80277872, 0xfcdbd541, 0x8009de7e
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+const q31_t twiddleCoefQ31[96] = {
+  0x7fffffff, 0x0, 0x7f62368f, 0xc8bd35e, 0x7d8a5f40, 0x18f8b83c,
+  0x7a7d055b, 0x25280c5e, 0x7641af3d, 0x30fbc54d, 0x70e2cbc6, 0x3c56ba70,
+  0x6a6d98a4, 0x471cece7, 0x62f201ac, 0x5133cc94, 0x5a82799a, 0x5a82799a,
+  0x5133cc94, 0x62f201ac, 0x471cece7, 0x6a6d98a4, 0x3c56ba70, 0x70e2cbc6,
+  0x30fbc54d, 0x7641af3d, 0x25280c5e, 0x7a7d055b, 0x18f8b83c, 0x7d8a5f40,
+  0xc8bd35e, 0x7f62368f, 0x0, 0x7fffffff, 0xf3742ca2, 0x7f62368f,
+  0xe70747c4, 0x7d8a5f40, 0xdad7f3a2, 0x7a7d055b, 0xcf043ab3, 0x7641af3d,
+  0xc3a94590, 0x70e2cbc6, 0xb8e31319, 0x6a6d98a4, 0xaecc336c, 0x62f201ac,
+  0xa57d8666, 0x5a82799a, 0x9d0dfe54, 0x5133cc94, 0x9592675c, 0x471cece7,
+  0x8f1d343a, 0x3c56ba70, 0x89be50c3, 0x30fbc54d, 0x8582faa5, 0x25280c5e,
+  0x8275a0c0, 0x18f8b83c, 0x809dc971, 0xc8bd35e, 0x80000000, 0x0,
+  0x809dc971, 0xf3742ca2, 0x8275a0c0, 0xe70747c4, 0x8582faa5, 0xdad7f3a2,
+  0x89be50c3, 0xcf043ab3, 0x8f1d343a, 0xc3a94590, 0x9592675c, 0xb8e31319,
+  0x9d0dfe54, 0xaecc336c, 0xa57d8666, 0xa57d8666, 0xaecc336c, 0x9d0dfe54,
+  0xb8e31319, 0x9592675c, 0xc3a94590, 0x8f1d343a, 0xcf043ab3, 0x89be50c3,
+  0xdad7f3a2, 0x8582faa5, 0xe70747c4, 0x8275a0c0, 0xf3742ca2, 0x809dc971
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 16)
+const q31_t twiddleCoefQ31[24] = {
+  0x7fffffff, 0x0, 0x7641af3d, 0x30fbc54d, 0x5a82799a, 0x5a82799a,
+  0x30fbc54d, 0x7641af3d, 0x0, 0x7fffffff, 0xcf043ab3, 0x7641af3d,
+  0xa57d8666, 0x5a82799a, 0x89be50c3, 0x30fbc54d, 0x80000000, 0x0,
+  0x89be50c3, 0xcf043ab3, 0xa57d8666, 0xa57d8666, 0xcf043ab3, 0x89be50c3
+};
+#endif
 
 
 /*    
@@ -3869,7 +4974,7 @@ const q31_t twiddleCoefQ31[6144] = {
 *	twiddleCoefQ15[2*i+1]= sin(i * 2*PI/(float)N);    
 * } </pre>    
 * \par    
-* where N = 4096	and PI = 3.14159265358979    
+* where N = ARM_MATH_MAX_FFT_LEN (4096 by default) and PI = 3.14159265358979    
 * \par    
 * Cos and Sin values are interleaved fashion    
 * \par    
@@ -3878,6 +4983,7 @@ const q31_t twiddleCoefQ31[6144] = {
 *    
 */
 
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
 const q15_t ALIGN4 twiddleCoefQ15[6144] = {
 
   0x7fff, 0x0, 0x7fff, 0x32, 0x7fff, 0x65, 0x7fff, 0x97,
@@ -4649,6 +5755,274 @@ const q15_t ALIGN4 twiddleCoefQ15[6144] = {
   0xfe6e, 0x8002, 0xfea0, 0x8002, 0xfed2, 0x8001, 0xff05, 0x8001,
   0xff37, 0x8001, 0xff69, 0x8000, 0xff9b, 0x8000, 0xffce, 0x8000,
 };
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+const q15_t ALIGN4 twiddleCoefQ15[1536] = {
+  0x7fff, 0x0, 0x7fff, 0xc9, 0x7ffe, 0x192, 0x7ffa, 0x25b,
+  0x7ff6, 0x324, 0x7ff1, 0x3ed, 0x7fea, 0x4b6, 0x7fe2, 0x57f,
+  0x7fd9, 0x648, 0x7fce, 0x711, 0x7fc2, 0x7d9, 0x7fb5, 0x8a2,
+  0x7fa7, 0x96b, 0x7f98, 0xa33, 0x7f87, 0xafb, 0x7f75, 0xbc4,
+  0x7f62, 0xc8c, 0x7f4e, 0xd54, 0x7f38, 0xe1c, 0x7f22, 0xee4,
+  0x7f0a, 0xfab, 0x7ef0, 0x1073, 0x7ed6, 0x113a, 0x7eba, 0x1201,
+  0x7e9d, 0x12c8, 0x7e7f, 0x138f, 0x7e60, 0x1455, 0x7e3f, 0x151c,
+  0x7e1e, 0x15e2, 0x7dfb, 0x16a8, 0x7dd6, 0x176e, 0x7db1, 0x1833,
+  0x7d8a, 0x18f9, 0x7d63, 0x19be, 0x7d3a, 0x1a83, 0x7d0f, 0x1b47,
+  0x7ce4, 0x1c0c, 0x7cb7, 0x1cd0, 0x7c89, 0x1d93, 0x7c5a, 0x1e57,
+  0x7c2a, 0x1f1a, 0x7bf9, 0x1fdd, 0x7bc6, 0x209f, 0x7b92, 0x2162,
+  0x7b5d, 0x2224, 0x7b27, 0x22e5, 0x7aef, 0x23a7, 0x7ab7, 0x2467,
+  0x7a7d, 0x2528, 0x7a42, 0x25e8, 0x7a06, 0x26a8, 0x79c9, 0x2768,
+  0x798a, 0x2827, 0x794a, 0x28e5, 0x790a, 0x29a4, 0x78c8, 0x2a62,
+  0x7885, 0x2b1f, 0x7840, 0x2bdc, 0x77fb, 0x2c99, 0x77b4, 0x2d55,
+  0x776c, 0x2e11, 0x7723, 0x2ecc, 0x76d9, 0x2f87, 0x768e, 0x3042,
+  0x7642, 0x30fc, 0x75f4, 0x31b5, 0x75a6, 0x326e, 0x7556, 0x3327,
+  0x7505, 0x33df, 0x74b3, 0x3497, 0x7460, 0x354e, 0x740b, 0x3604,
+  0x73b6, 0x36ba, 0x735f, 0x3770, 0x7308, 0x3825, 0x72af, 0x38d9,
+  0x7255, 0x398d, 0x71fa, 0x3a40, 0x719e, 0x3af3, 0x7141, 0x3ba5,
+  0x70e3, 0x3c57, 0x7083, 0x3d08, 0x7023, 0x3db8, 0x6fc2, 0x3e68,
+  0x6f5f, 0x3f17, 0x6efb, 0x3fc6, 0x6e97, 0x4074, 0x6e31, 0x4121,
+  0x6dca, 0x41ce, 0x6d62, 0x427a, 0x6cf9, 0x4326, 0x6c8f, 0x43d1,
+  0x6c24, 0x447b, 0x6bb8, 0x4524, 0x6b4b, 0x45cd, 0x6add, 0x4675,
+  0x6a6e, 0x471d, 0x69fd, 0x47c4, 0x698c, 0x486a, 0x691a, 0x490f,
+  0x68a7, 0x49b4, 0x6832, 0x4a58, 0x67bd, 0x4afb, 0x6747, 0x4b9e,
+  0x66d0, 0x4c40, 0x6657, 0x4ce1, 0x65de, 0x4d81, 0x6564, 0x4e21,
+  0x64e9, 0x4ec0, 0x646c, 0x4f5e, 0x63ef, 0x4ffb, 0x6371, 0x5098,
+  0x62f2, 0x5134, 0x6272, 0x51cf, 0x61f1, 0x5269, 0x616f, 0x5303,
+  0x60ec, 0x539b, 0x6068, 0x5433, 0x5fe4, 0x54ca, 0x5f5e, 0x5560,
+  0x5ed7, 0x55f6, 0x5e50, 0x568a, 0x5dc8, 0x571e, 0x5d3e, 0x57b1,
+  0x5cb4, 0x5843, 0x5c29, 0x58d4, 0x5b9d, 0x5964, 0x5b10, 0x59f4,
+  0x5a82, 0x5a82, 0x59f4, 0x5b10, 0x5964, 0x5b9d, 0x58d4, 0x5c29,
+  0x5843, 0x5cb4, 0x57b1, 0x5d3e, 0x571e, 0x5dc8, 0x568a, 0x5e50,
+  0x55f6, 0x5ed7, 0x5560, 0x5f5e, 0x54ca, 0x5fe4, 0x5433, 0x6068,
+  0x539b, 0x60ec, 0x5303, 0x616f, 0x5269, 0x61f1, 0x51cf, 0x6272,
+  0x5134, 0x62f2, 0x5098, 0x6371, 0x4ffb, 0x63ef, 0x4f5e, 0x646c,
+  0x4ec0, 0x64e9, 0x4e21, 0x6564, 0x4d81, 0x65de, 0x4ce1, 0x6657,
+  0x4c40, 0x66d0, 0x4b9e, 0x6747, 0x4afb, 0x67bd, 0x4a58, 0x6832,
+  0x49b4, 0x68a7, 0x490f, 0x691a, 0x486a, 0x698c, 0x47c4, 0x69fd,
+  0x471d, 0x6a6e, 0x4675, 0x6add, 0x45cd, 0x6b4b, 0x4524, 0x6bb8,
+  0x447b, 0x6c24, 0x43d1, 0x6c8f, 0x4326, 0x6cf9, 0x427a, 0x6d62,
+  0x41ce, 0x6dca, 0x4121, 0x6e31, 0x4074, 0x6e97, 0x3fc6, 0x6efb,
+  0x3f17, 0x6f5f, 0x3e68, 0x6fc2, 0x3db8, 0x7023, 0x3d08, 0x7083,
+  0x3c57, 0x70e3, 0x3ba5, 0x7141, 0x3af3, 0x719e, 0x3a40, 0x71fa,
+  0x398d, 0x7255, 0x38d9, 0x72af, 0x3825, 0x7308, 0x3770, 0x735f,
+  0x36ba, 0x73b6, 0x3604, 0x740b, 0x354e, 0x7460, 0x3497, 0x74b3,
+  0x33df, 0x7505, 0x3327, 0x7556, 0x326e, 0x75a6, 0x31b5, 0x75f4,
+  0x30fc, 0x7642, 0x3042, 0x768e, 0x2f87, 0x76d9, 0x2ecc, 0x7723,
+  0x2e11, 0x776c, 0x2d55, 0x77b4, 0x2c99, 0x77fb, 0x2bdc, 0x7840,
+  0x2b1f, 0x7885, 0x2a62, 0x78c8, 0x29a4, 0x790a, 0x28e5, 0x794a,
+  0x2827, 0x798a, 0x2768, 0x79c9, 0x26a8, 0x7a06, 0x25e8, 0x7a42,
+  0x2528, 0x7a7d, 0x2467, 0x7ab7, 0x23a7, 0x7aef, 0x22e5, 0x7b27,
+  0x2224, 0x7b5d, 0x2162, 0x7b92, 0x209f, 0x7bc6, 0x1fdd, 0x7bf9,
+  0x1f1a, 0x7c2a, 0x1e57, 0x7c5a, 0x1d93, 0x7c89, 0x1cd0, 0x7cb7,
+  0x1c0c, 0x7ce4, 0x1b47, 0x7d0f, 0x1a83, 0x7d3a, 0x19be, 0x7d63,
+  0x18f9, 0x7d8a, 0x1833, 0x7db1, 0x176e, 0x7dd6, 0x16a8, 0x7dfb,
+  0x15e2, 0x7e1e, 0x151c, 0x7e3f, 0x1455, 0x7e60, 0x138f, 0x7e7f,
+  0x12c8, 0x7e9d, 0x1201, 0x7eba, 0x113a, 0x7ed6, 0x1073, 0x7ef0,
+  0xfab, 0x7f0a, 0xee4, 0x7f22, 0xe1c, 0x7f38, 0xd54, 0x7f4e,
+  0xc8c, 0x7f62, 0xbc4, 0x7f75, 0xafb, 0x7f87, 0xa33, 0x7f98,
+  0x96b, 0x7fa7, 0x8a2, 0x7fb5, 0x7d9, 0x7fc2, 0x711, 0x7fce,
+  0x648, 0x7fd9, 0x57f, 0x7fe2, 0x4b6, 0x7fea, 0x3ed, 0x7ff1,
+  0x324, 0x7ff6, 0x25b, 0x7ffa, 0x192, 0x7ffe, 0xc9, 0x7fff,
+  0x0, 0x7fff, 0xff37, 0x7fff, 0xfe6e, 0x7ffe, 0xfda5, 0x7ffa,
+  0xfcdc, 0x7ff6, 0xfc13, 0x7ff1, 0xfb4a, 0x7fea, 0xfa81, 0x7fe2,
+  0xf9b8, 0x7fd9, 0xf8ef, 0x7fce, 0xf827, 0x7fc2, 0xf75e, 0x7fb5,
+  0xf695, 0x7fa7, 0xf5cd, 0x7f98, 0xf505, 0x7f87, 0xf43c, 0x7f75,
+  0xf374, 0x7f62, 0xf2ac, 0x7f4e, 0xf1e4, 0x7f38, 0xf11c, 0x7f22,
+  0xf055, 0x7f0a, 0xef8d, 0x7ef0, 0xeec6, 0x7ed6, 0xedff, 0x7eba,
+  0xed38, 0x7e9d, 0xec71, 0x7e7f, 0xebab, 0x7e60, 0xeae4, 0x7e3f,
+  0xea1e, 0x7e1e, 0xe958, 0x7dfb, 0xe892, 0x7dd6, 0xe7cd, 0x7db1,
+  0xe707, 0x7d8a, 0xe642, 0x7d63, 0xe57d, 0x7d3a, 0xe4b9, 0x7d0f,
+  0xe3f4, 0x7ce4, 0xe330, 0x7cb7, 0xe26d, 0x7c89, 0xe1a9, 0x7c5a,
+  0xe0e6, 0x7c2a, 0xe023, 0x7bf9, 0xdf61, 0x7bc6, 0xde9e, 0x7b92,
+  0xdddc, 0x7b5d, 0xdd1b, 0x7b27, 0xdc59, 0x7aef, 0xdb99, 0x7ab7,
+  0xdad8, 0x7a7d, 0xda18, 0x7a42, 0xd958, 0x7a06, 0xd898, 0x79c9,
+  0xd7d9, 0x798a, 0xd71b, 0x794a, 0xd65c, 0x790a, 0xd59e, 0x78c8,
+  0xd4e1, 0x7885, 0xd424, 0x7840, 0xd367, 0x77fb, 0xd2ab, 0x77b4,
+  0xd1ef, 0x776c, 0xd134, 0x7723, 0xd079, 0x76d9, 0xcfbe, 0x768e,
+  0xcf04, 0x7642, 0xce4b, 0x75f4, 0xcd92, 0x75a6, 0xccd9, 0x7556,
+  0xcc21, 0x7505, 0xcb69, 0x74b3, 0xcab2, 0x7460, 0xc9fc, 0x740b,
+  0xc946, 0x73b6, 0xc890, 0x735f, 0xc7db, 0x7308, 0xc727, 0x72af,
+  0xc673, 0x7255, 0xc5c0, 0x71fa, 0xc50d, 0x719e, 0xc45b, 0x7141,
+  0xc3a9, 0x70e3, 0xc2f8, 0x7083, 0xc248, 0x7023, 0xc198, 0x6fc2,
+  0xc0e9, 0x6f5f, 0xc03a, 0x6efb, 0xbf8c, 0x6e97, 0xbedf, 0x6e31,
+  0xbe32, 0x6dca, 0xbd86, 0x6d62, 0xbcda, 0x6cf9, 0xbc2f, 0x6c8f,
+  0xbb85, 0x6c24, 0xbadc, 0x6bb8, 0xba33, 0x6b4b, 0xb98b, 0x6add,
+  0xb8e3, 0x6a6e, 0xb83c, 0x69fd, 0xb796, 0x698c, 0xb6f1, 0x691a,
+  0xb64c, 0x68a7, 0xb5a8, 0x6832, 0xb505, 0x67bd, 0xb462, 0x6747,
+  0xb3c0, 0x66d0, 0xb31f, 0x6657, 0xb27f, 0x65de, 0xb1df, 0x6564,
+  0xb140, 0x64e9, 0xb0a2, 0x646c, 0xb005, 0x63ef, 0xaf68, 0x6371,
+  0xaecc, 0x62f2, 0xae31, 0x6272, 0xad97, 0x61f1, 0xacfd, 0x616f,
+  0xac65, 0x60ec, 0xabcd, 0x6068, 0xab36, 0x5fe4, 0xaaa0, 0x5f5e,
+  0xaa0a, 0x5ed7, 0xa976, 0x5e50, 0xa8e2, 0x5dc8, 0xa84f, 0x5d3e,
+  0xa7bd, 0x5cb4, 0xa72c, 0x5c29, 0xa69c, 0x5b9d, 0xa60c, 0x5b10,
+  0xa57e, 0x5a82, 0xa4f0, 0x59f4, 0xa463, 0x5964, 0xa3d7, 0x58d4,
+  0xa34c, 0x5843, 0xa2c2, 0x57b1, 0xa238, 0x571e, 0xa1b0, 0x568a,
+  0xa129, 0x55f6, 0xa0a2, 0x5560, 0xa01c, 0x54ca, 0x9f98, 0x5433,
+  0x9f14, 0x539b, 0x9e91, 0x5303, 0x9e0f, 0x5269, 0x9d8e, 0x51cf,
+  0x9d0e, 0x5134, 0x9c8f, 0x5098, 0x9c11, 0x4ffb, 0x9b94, 0x4f5e,
+  0x9b17, 0x4ec0, 0x9a9c, 0x4e21, 0x9a22, 0x4d81, 0x99a9, 0x4ce1,
+  0x9930, 0x4c40, 0x98b9, 0x4b9e, 0x9843, 0x4afb, 0x97ce, 0x4a58,
+  0x9759, 0x49b4, 0x96e6, 0x490f, 0x9674, 0x486a, 0x9603, 0x47c4,
+  0x9592, 0x471d, 0x9523, 0x4675, 0x94b5, 0x45cd, 0x9448, 0x4524,
+  0x93dc, 0x447b, 0x9371, 0x43d1, 0x9307, 0x4326, 0x929e, 0x427a,
+  0x9236, 0x41ce, 0x91cf, 0x4121, 0x9169, 0x4074, 0x9105, 0x3fc6,
+  0x90a1, 0x3f17, 0x903e, 0x3e68, 0x8fdd, 0x3db8, 0x8f7d, 0x3d08,
+  0x8f1d, 0x3c57, 0x8ebf, 0x3ba5, 0x8e62, 0x3af3, 0x8e06, 0x3a40,
+  0x8dab, 0x398d, 0x8d51, 0x38d9, 0x8cf8, 0x3825, 0x8ca1, 0x3770,
+  0x8c4a, 0x36ba, 0x8bf5, 0x3604, 0x8ba0, 0x354e, 0x8b4d, 0x3497,
+  0x8afb, 0x33df, 0x8aaa, 0x3327, 0x8a5a, 0x326e, 0x8a0c, 0x31b5,
+  0x89be, 0x30fc, 0x8972, 0x3042, 0x8927, 0x2f87, 0x88dd, 0x2ecc,
+  0x8894, 0x2e11, 0x884c, 0x2d55, 0x8805, 0x2c99, 0x87c0, 0x2bdc,
+  0x877b, 0x2b1f, 0x8738, 0x2a62, 0x86f6, 0x29a4, 0x86b6, 0x28e5,
+  0x8676, 0x2827, 0x8637, 0x2768, 0x85fa, 0x26a8, 0x85be, 0x25e8,
+  0x8583, 0x2528, 0x8549, 0x2467, 0x8511, 0x23a7, 0x84d9, 0x22e5,
+  0x84a3, 0x2224, 0x846e, 0x2162, 0x843a, 0x209f, 0x8407, 0x1fdd,
+  0x83d6, 0x1f1a, 0x83a6, 0x1e57, 0x8377, 0x1d93, 0x8349, 0x1cd0,
+  0x831c, 0x1c0c, 0x82f1, 0x1b47, 0x82c6, 0x1a83, 0x829d, 0x19be,
+  0x8276, 0x18f9, 0x824f, 0x1833, 0x822a, 0x176e, 0x8205, 0x16a8,
+  0x81e2, 0x15e2, 0x81c1, 0x151c, 0x81a0, 0x1455, 0x8181, 0x138f,
+  0x8163, 0x12c8, 0x8146, 0x1201, 0x812a, 0x113a, 0x8110, 0x1073,
+  0x80f6, 0xfab, 0x80de, 0xee4, 0x80c8, 0xe1c, 0x80b2, 0xd54,
+  0x809e, 0xc8c, 0x808b, 0xbc4, 0x8079, 0xafb, 0x8068, 0xa33,
+  0x8059, 0x96b, 0x804b, 0x8a2, 0x803e, 0x7d9, 0x8032, 0x711,
+  0x8027, 0x648, 0x801e, 0x57f, 0x8016, 0x4b6, 0x800f, 0x3ed,
+  0x800a, 0x324, 0x8006, 0x25b, 0x8002, 0x192, 0x8001, 0xc9,
+  0x8000, 0x0, 0x8001, 0xff37, 0x8002, 0xfe6e, 0x8006, 0xfda5,
+  0x800a, 0xfcdc, 0x800f, 0xfc13, 0x8016, 0xfb4a, 0x801e, 0xfa81,
+  0x8027, 0xf9b8, 0x8032, 0xf8ef, 0x803e, 0xf827, 0x804b, 0xf75e,
+  0x8059, 0xf695, 0x8068, 0xf5cd, 0x8079, 0xf505, 0x808b, 0xf43c,
+  0x809e, 0xf374, 0x80b2, 0xf2ac, 0x80c8, 0xf1e4, 0x80de, 0xf11c,
+  0x80f6, 0xf055, 0x8110, 0xef8d, 0x812a, 0xeec6, 0x8146, 0xedff,
+  0x8163, 0xed38, 0x8181, 0xec71, 0x81a0, 0xebab, 0x81c1, 0xeae4,
+  0x81e2, 0xea1e, 0x8205, 0xe958, 0x822a, 0xe892, 0x824f, 0xe7cd,
+  0x8276, 0xe707, 0x829d, 0xe642, 0x82c6, 0xe57d, 0x82f1, 0xe4b9,
+  0x831c, 0xe3f4, 0x8349, 0xe330, 0x8377, 0xe26d, 0x83a6, 0xe1a9,
+  0x83d6, 0xe0e6, 0x8407, 0xe023, 0x843a, 0xdf61, 0x846e, 0xde9e,
+  0x84a3, 0xdddc, 0x84d9, 0xdd1b, 0x8511, 0xdc59, 0x8549, 0xdb99,
+  0x8583, 0xdad8, 0x85be, 0xda18, 0x85fa, 0xd958, 0x8637, 0xd898,
+  0x8676, 0xd7d9, 0x86b6, 0xd71b, 0x86f6, 0xd65c, 0x8738, 0xd59e,
+  0x877b, 0xd4e1, 0x87c0, 0xd424, 0x8805, 0xd367, 0x884c, 0xd2ab,
+  0x8894, 0xd1ef, 0x88dd, 0xd134, 0x8927, 0xd079, 0x8972, 0xcfbe,
+  0x89be, 0xcf04, 0x8a0c, 0xce4b, 0x8a5a, 0xcd92, 0x8aaa, 0xccd9,
+  0x8afb, 0xcc21, 0x8b4d, 0xcb69, 0x8ba0, 0xcab2, 0x8bf5, 0xc9fc,
+  0x8c4a, 0xc946, 0x8ca1, 0xc890, 0x8cf8, 0xc7db, 0x8d51, 0xc727,
+  0x8dab, 0xc673, 0x8e06, 0xc5c0, 0x8e62, 0xc50d, 0x8ebf, 0xc45b,
+  0x8f1d, 0xc3a9, 0x8f7d, 0xc2f8, 0x8fdd, 0xc248, 0x903e, 0xc198,
+  0x90a1, 0xc0e9, 0x9105, 0xc03a, 0x9169, 0xbf8c, 0x91cf, 0xbedf,
+  0x9236, 0xbe32, 0x929e, 0xbd86, 0x9307, 0xbcda, 0x9371, 0xbc2f,
+  0x93dc, 0xbb85, 0x9448, 0xbadc, 0x94b5, 0xba33, 0x9523, 0xb98b,
+  0x9592, 0xb8e3, 0x9603, 0xb83c, 0x9674, 0xb796, 0x96e6, 0xb6f1,
+  0x9759, 0xb64c, 0x97ce, 0xb5a8, 0x9843, 0xb505, 0x98b9, 0xb462,
+  0x9930, 0xb3c0, 0x99a9, 0xb31f, 0x9a22, 0xb27f, 0x9a9c, 0xb1df,
+  0x9b17, 0xb140, 0x9b94, 0xb0a2, 0x9c11, 0xb005, 0x9c8f, 0xaf68,
+  0x9d0e, 0xaecc, 0x9d8e, 0xae31, 0x9e0f, 0xad97, 0x9e91, 0xacfd,
+  0x9f14, 0xac65, 0x9f98, 0xabcd, 0xa01c, 0xab36, 0xa0a2, 0xaaa0,
+  0xa129, 0xaa0a, 0xa1b0, 0xa976, 0xa238, 0xa8e2, 0xa2c2, 0xa84f,
+  0xa34c, 0xa7bd, 0xa3d7, 0xa72c, 0xa463, 0xa69c, 0xa4f0, 0xa60c,
+  0xa57e, 0xa57e, 0xa60c, 0xa4f0, 0xa69c, 0xa463, 0xa72c, 0xa3d7,
+  0xa7bd, 0xa34c, 0xa84f, 0xa2c2, 0xa8e2, 0xa238, 0xa976, 0xa1b0,
+  0xaa0a, 0xa129, 0xaaa0, 0xa0a2, 0xab36, 0xa01c, 0xabcd, 0x9f98,
+  0xac65, 0x9f14, 0xacfd, 0x9e91, 0xad97, 0x9e0f, 0xae31, 0x9d8e,
+  0xaecc, 0x9d0e, 0xaf68, 0x9c8f, 0xb005, 0x9c11, 0xb0a2, 0x9b94,
+  0xb140, 0x9b17, 0xb1df, 0x9a9c, 0xb27f, 0x9a22, 0xb31f, 0x99a9,
+  0xb3c0, 0x9930, 0xb462, 0x98b9, 0xb505, 0x9843, 0xb5a8, 0x97ce,
+  0xb64c, 0x9759, 0xb6f1, 0x96e6, 0xb796, 0x9674, 0xb83c, 0x9603,
+  0xb8e3, 0x9592, 0xb98b, 0x9523, 0xba33, 0x94b5, 0xbadc, 0x9448,
+  0xbb85, 0x93dc, 0xbc2f, 0x9371, 0xbcda, 0x9307, 0xbd86, 0x929e,
+  0xbe32, 0x9236, 0xbedf, 0x91cf, 0xbf8c, 0x9169, 0xc03a, 0x9105,
+  0xc0e9, 0x90a1, 0xc198, 0x903e, 0xc248, 0x8fdd, 0xc2f8, 0x8f7d,
+  0xc3a9, 0x8f1d, 0xc45b, 0x8ebf, 0xc50d, 0x8e62, 0xc5c0, 0x8e06,
+  0xc673, 0x8dab, 0xc727, 0x8d51, 0xc7db, 0x8cf8, 0xc890, 0x8ca1,
+  0xc946, 0x8c4a, 0xc9fc, 0x8bf5, 0xcab2, 0x8ba0, 0xcb69, 0x8b4d,
+  0xcc21, 0x8afb, 0xccd9, 0x8aaa, 0xcd92, 0x8a5a, 0xce4b, 0x8a0c,
+  0xcf04, 0x89be, 0xcfbe, 0x8972, 0xd079, 0x8927, 0xd134, 0x88dd,
+  0xd1ef, 0x8894, 0xd2ab, 0x884c, 0xd367, 0x8805, 0xd424, 0x87c0,
+  0xd4e1, 0x877b, 0xd59e, 0x8738, 0xd65c, 0x86f6, 0xd71b, 0x86b6,
+  0xd7d9, 0x8676, 0xd898, 0x8637, 0xd958, 0x85fa, 0xda18, 0x85be,
+  0xdad8, 0x8583, 0xdb99, 0x8549, 0xdc59, 0x8511, 0xdd1b, 0x84d9,
+  0xdddc, 0x84a3, 0xde9e, 0x846e, 0xdf61, 0x843a, 0xe023, 0x8407,
+  0xe0e6, 0x83d6, 0xe1a9, 0x83a6, 0xe26d, 0x8377, 0xe330, 0x8349,
+  0xe3f4, 0x831c, 0xe4b9, 0x82f1, 0xe57d, 0x82c6, 0xe642, 0x829d,
+  0xe707, 0x8276, 0xe7cd, 0x824f, 0xe892, 0x822a, 0xe958, 0x8205,
+  0xea1e, 0x81e2, 0xeae4, 0x81c1, 0xebab, 0x81a0, 0xec71, 0x8181,
+  0xed38, 0x8163, 0xedff, 0x8146, 0xeec6, 0x812a, 0xef8d, 0x8110,
+  0xf055, 0x80f6, 0xf11c, 0x80de, 0xf1e4, 0x80c8, 0xf2ac, 0x80b2,
+  0xf374, 0x809e, 0xf43c, 0x808b, 0xf505, 0x8079, 0xf5cd, 0x8068,
+  0xf695, 0x8059, 0xf75e, 0x804b, 0xf827, 0x803e, 0xf8ef, 0x8032,
+  0xf9b8, 0x8027, 0xfa81, 0x801e, 0xfb4a, 0x8016, 0xfc13, 0x800f,
+  0xfcdc, 0x800a, 0xfda5, 0x8006, 0xfe6e, 0x8002, 0xff37, 0x8001
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+const q15_t ALIGN4 twiddleCoefQ15[384] = {
+  0x7fff, 0x0, 0x7ff6, 0x324, 0x7fd9, 0x648, 0x7fa7, 0x96b,
+  0x7f62, 0xc8c, 0x7f0a, 0xfab, 0x7e9d, 0x12c8, 0x7e1e, 0x15e2,
+  0x7d8a, 0x18f9, 0x7ce4, 0x1c0c, 0x7c2a, 0x1f1a, 0x7b5d, 0x2224,
+  0x7a7d, 0x2528, 0x798a, 0x2827, 0x7885, 0x2b1f, 0x776c, 0x2e11,
+  0x7642, 0x30fc, 0x7505, 0x33df, 0x73b6, 0x36ba, 0x7255, 0x398d,
+  0x70e3, 0x3c57, 0x6f5f, 0x3f17, 0x6dca, 0x41ce, 0x6c24, 0x447b,
+  0x6a6e, 0x471d, 0x68a7, 0x49b4, 0x66d0, 0x4c40, 0x64e9, 0x4ec0,
+  0x62f2, 0x5134, 0x60ec, 0x539b, 0x5ed7, 0x55f6, 0x5cb4, 0x5843,
+  0x5a82, 0x5a82, 0x5843, 0x5cb4, 0x55f6, 0x5ed7, 0x539b, 0x60ec,
+  0x5134, 0x62f2, 0x4ec0, 0x64e9, 0x4c40, 0x66d0, 0x49b4, 0x68a7,
+  0x471d, 0x6a6e, 0x447b, 0x6c24, 0x41ce, 0x6dca, 0x3f17, 0x6f5f,
+  0x3c57, 0x70e3, 0x398d, 0x7255, 0x36ba, 0x73b6, 0x33df, 0x7505,
+  0x30fc, 0x7642, 0x2e11, 0x776c, 0x2b1f, 0x7885, 0x2827, 0x798a,
+  0x2528, 0x7a7d, 0x2224, 0x7b5d, 0x1f1a, 0x7c2a, 0x1c0c, 0x7ce4,
+  0x18f9, 0x7d8a, 0x15e2, 0x7e1e, 0x12c8, 0x7e9d, 0xfab, 0x7f0a,
+  0xc8c, 0x7f62, 0x96b, 0x7fa7, 0x648, 0x7fd9, 0x324, 0x7ff6,
+  0x0, 0x7fff, 0xfcdc, 0x7ff6, 0xf9b8, 0x7fd9, 0xf695, 0x7fa7,
+  0xf374, 0x7f62, 0xf055, 0x7f0a, 0xed38, 0x7e9d, 0xea1e, 0x7e1e,
+  0xe707, 0x7d8a, 0xe3f4, 0x7ce4, 0xe0e6, 0x7c2a, 0xdddc, 0x7b5d,
+  0xdad8, 0x7a7d, 0xd7d9, 0x798a, 0xd4e1, 0x7885, 0xd1ef, 0x776c,
+  0xcf04, 0x7642, 0xcc21, 0x7505, 0xc946, 0x73b6, 0xc673, 0x7255,
+  0xc3a9, 0x70e3, 0xc0e9, 0x6f5f, 0xbe32, 0x6dca, 0xbb85, 0x6c24,
+  0xb8e3, 0x6a6e, 0xb64c, 0x68a7, 0xb3c0, 0x66d0, 0xb140, 0x64e9,
+  0xaecc, 0x62f2, 0xac65, 0x60ec, 0xaa0a, 0x5ed7, 0xa7bd, 0x5cb4,
+  0xa57e, 0x5a82, 0xa34c, 0x5843, 0xa129, 0x55f6, 0x9f14, 0x539b,
+  0x9d0e, 0x5134, 0x9b17, 0x4ec0, 0x9930, 0x4c40, 0x9759, 0x49b4,
+  0x9592, 0x471d, 0x93dc, 0x447b, 0x9236, 0x41ce, 0x90a1, 0x3f17,
+  0x8f1d, 0x3c57, 0x8dab, 0x398d, 0x8c4a, 0x36ba, 0x8afb, 0x33df,
+  0x89be, 0x30fc, 0x8894, 0x2e11, 0x877b, 0x2b1f, 0x8676, 0x2827,
+  0x8583, 0x2528, 0x84a3, 0x2224, 0x83d6, 0x1f1a, 0x831c, 0x1c0c,
+  0x8276, 0x18f9, 0x81e2, 0x15e2, 0x8163, 0x12c8, 0x80f6, 0xfab,
+  0x809e, 0xc8c, 0x8059, 0x96b, 0x8027, 0x648, 0x800a, 0x324,
+  0x8000, 0x0, 0x800a, 0xfcdc, 0x8027, 0xf9b8, 0x8059, 0xf695,
+  0x809e, 0xf374, 0x80f6, 0xf055, 0x8163, 0xed38, 0x81e2, 0xea1e,
+  0x8276, 0xe707, 0x831c, 0xe3f4, 0x83d6, 0xe0e6, 0x84a3, 0xdddc,
+  0x8583, 0xdad8, 0x8676, 0xd7d9, 0x877b, 0xd4e1, 0x8894, 0xd1ef,
+  0x89be, 0xcf04, 0x8afb, 0xcc21, 0x8c4a, 0xc946, 0x8dab, 0xc673,
+  0x8f1d, 0xc3a9, 0x90a1, 0xc0e9, 0x9236, 0xbe32, 0x93dc, 0xbb85,
+  0x9592, 0xb8e3, 0x9759, 0xb64c, 0x9930, 0xb3c0, 0x9b17, 0xb140,
+  0x9d0e, 0xaecc, 0x9f14, 0xac65, 0xa129, 0xaa0a, 0xa34c, 0xa7bd,
+  0xa57e, 0xa57e, 0xa7bd, 0xa34c, 0xaa0a, 0xa129, 0xac65, 0x9f14,
+  0xaecc, 0x9d0e, 0xb140, 0x9b17, 0xb3c0, 0x9930, 0xb64c, 0x9759,
+  0xb8e3, 0x9592, 0xbb85, 0x93dc, 0xbe32, 0x9236, 0xc0e9, 0x90a1,
+  0xc3a9, 0x8f1d, 0xc673, 0x8dab, 0xc946, 0x8c4a, 0xcc21, 0x8afb,
+  0xcf04, 0x89be, 0xd1ef, 0x8894, 0xd4e1, 0x877b, 0xd7d9, 0x8676,
+  0xdad8, 0x8583, 0xdddc, 0x84a3, 0xe0e6, 0x83d6, 0xe3f4, 0x831c,
+  0xe707, 0x8276, 0xea1e, 0x81e2, 0xed38, 0x8163, 0xf055, 0x80f6,
+  0xf374, 0x809e, 0xf695, 0x8059, 0xf9b8, 0x8027, 0xfcdc, 0x800a
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+const q15_t ALIGN4 twiddleCoefQ15[96] = {
+  0x7fff, 0x0, 0x7f62, 0xc8c, 0x7d8a, 0x18f9, 0x7a7d, 0x2528,
+  0x7642, 0x30fc, 0x70e3, 0x3c57, 0x6a6e, 0x471d, 0x62f2, 0x5134,
+  0x5a82, 0x5a82, 0x5134, 0x62f2, 0x471d, 0x6a6e, 0x3c57, 0x70e3,
+  0x30fc, 0x7642, 0x2528, 0x7a7d, 0x18f9, 0x7d8a, 0xc8c, 0x7f62,
+  0x0, 0x7fff, 0xf374, 0x7f62, 0xe707, 0x7d8a, 0xdad8, 0x7a7d,
+  0xcf04, 0x7642, 0xc3a9, 0x70e3, 0xb8e3, 0x6a6e, 0xaecc, 0x62f2,
+  0xa57e, 0x5a82, 0x9d0e, 0x5134, 0x9592, 0x471d, 0x8f1d, 0x3c57,
+  0x89be, 0x30fc, 0x8583, 0x2528, 0x8276, 0x18f9, 0x809e, 0xc8c,
+  0x8000, 0x0, 0x809e, 0xf374, 0x8276, 0xe707, 0x8583, 0xdad8,
+  0x89be, 0xcf04, 0x8f1d, 0xc3a9, 0x9592, 0xb8e3, 0x9d0e, 0xaecc,
+  0xa57e, 0xa57e, 0xaecc, 0x9d0e, 0xb8e3, 0x9592, 0xc3a9, 0x8f1d,
+  0xcf04, 0x89be, 0xdad8, 0x8583, 0xe707, 0x8276, 0xf374, 0x809e
+};
+#elif (ARM_MATH_MAX_FFT_LEN == 16)
+const q15_t ALIGN4 twiddleCoefQ15[24] = {
+  0x7fff, 0x0, 0x7642, 0x30fc, 0x5a82, 0x5a82, 0x30fc, 0x7642,
+  0x0, 0x7fff, 0xcf04, 0x7642, 0xa57e, 0x5a82, 0x89be, 0x30fc,
+  0x8000, 0x0, 0x89be, 0xcf04, 0xa57e, 0xa57e, 0xcf04, 0x89be
+};
+#endif
 
 /**    
  * @} end of CFFT_CIFFT group    
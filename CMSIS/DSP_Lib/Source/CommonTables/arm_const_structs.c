@@ -0,0 +1,686 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_const_structs.c
+*
+* Description:	Constant instances of the Radix-4 floating-point CFFT & CIFFT
+*               for the 64, 256 and 1024 point lengths
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+
+#include "arm_const_structs.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Radix4_CFFT_CIFFT
+ * @{
+ */
+
+/**
+* \par
+* The tables below are trimmed to their length: the twiddle modifier and the
+* bit reversal factor of the instances are 1, the twiddles and the bit
+* reversal indexes being read one after the other. With ARM_MATH_CCM_TABLES
+* the tables are placed in the section ARM_CCM_SECTION_NAME (CCM data RAM
+* of the STM32F4, no wait state), to be copied there by the startup code.
+* \par
+* Example code for the twiddle factors of the N point instance:
+* \par
+* <pre>for(i = 0; i< 3N/4; i++)
+* {
+*	twiddleCoef_rad4_N[2*i]= cos(i * 2*PI/(float)N);
+*	twiddleCoef_rad4_N[2*i+1]= sin(i * 2*PI/(float)N);
+* } </pre>
+* \par
+* and the bit reversal indexes are armBitRevTable[(4096/N)*(k+1) - 1],
+* k = 0..N/4-1.
+*/
+
+/*
+* @brief  Twiddle factors of the 64 point instances
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
+ARM_CCM_TABLE float32_t twiddleCoef_rad4_64[96] ARM_CCM_SECTION = {
+  1.000000000000000000f, 0.000000000000000000f, 0.995184726672196929f, 0.098017140329560604f,
+  0.980785280403230431f, 0.195090322016128248f, 0.956940335732208824f, 0.290284677254462331f,
+  0.923879532511286738f, 0.382683432365089782f, 0.881921264348355050f, 0.471396736825997642f,
+  0.831469612302545236f, 0.555570233019602178f, 0.773010453362736993f, 0.634393284163645488f,
+  0.707106781186547573f, 0.707106781186547462f, 0.634393284163645488f, 0.773010453362736993f,
+  0.555570233019602289f, 0.831469612302545236f, 0.471396736825997809f, 0.881921264348354939f,
+  0.382683432365089837f, 0.923879532511286738f, 0.290284677254462331f, 0.956940335732208935f,
+  0.195090322016128331f, 0.980785280403230431f, 0.098017140329560770f, 0.995184726672196818f,
+  0.000000000000000061f, 1.000000000000000000f, -0.098017140329560645f, 0.995184726672196929f,
+  -0.195090322016128193f, 0.980785280403230431f, -0.290284677254462165f, 0.956940335732208935f,
+  -0.382683432365089726f, 0.923879532511286738f, -0.471396736825997698f, 0.881921264348355050f,
+  -0.555570233019601956f, 0.831469612302545458f, -0.634393284163645377f, 0.773010453362737104f,
+  -0.707106781186547462f, 0.707106781186547573f, -0.773010453362736993f, 0.634393284163645488f,
+  -0.831469612302545347f, 0.555570233019602178f, -0.881921264348354939f, 0.471396736825997864f,
+  -0.923879532511286738f, 0.382683432365089893f, -0.956940335732208824f, 0.290284677254462387f,
+  -0.980785280403230431f, 0.195090322016128609f, -0.995184726672196818f, 0.098017140329560826f,
+  -1.000000000000000000f, 0.000000000000000122f, -0.995184726672196929f, -0.098017140329560590f,
+  -0.980785280403230431f, -0.195090322016128359f, -0.956940335732208935f, -0.290284677254462109f,
+  -0.923879532511286850f, -0.382683432365089671f, -0.881921264348355050f, -0.471396736825997642f,
+  -0.831469612302545458f, -0.555570233019601956f, -0.773010453362737104f, -0.634393284163645266f,
+  -0.707106781186547684f, -0.707106781186547462f, -0.634393284163645932f, -0.773010453362736660f,
+  -0.555570233019602178f, -0.831469612302545236f, -0.471396736825997864f, -0.881921264348354939f,
+  -0.382683432365090337f, -0.923879532511286516f, -0.290284677254462442f, -0.956940335732208824f,
+  -0.195090322016128664f, -0.980785280403230320f, -0.098017140329560451f, -0.995184726672196929f
+};
+
+/*
+* @brief  Bit reversal table of the 64 point instances
+*/
+ARM_CCM_TABLE uint16_t armBitRevTable_rad4_64[16] ARM_CCM_SECTION = {
+  0x10, 0x8, 0x18, 0x4, 0x14, 0xc, 0x1c, 0x2,
+  0x12, 0xa, 0x1a, 0x6, 0x16, 0xe, 0x1e, 0x1
+};
+#endif
+
+/*
+* @brief  Twiddle factors of the 256 point instances
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
+ARM_CCM_TABLE float32_t twiddleCoef_rad4_256[384] ARM_CCM_SECTION = {
+  1.000000000000000000f, 0.000000000000000000f, 0.999698818696204250f, 0.024541228522912288f,
+  0.998795456205172405f, 0.049067674327418015f, 0.997290456678690207f, 0.073564563599667426f,
+  0.995184726672196929f, 0.098017140329560604f, 0.992479534598709967f, 0.122410675199216196f,
+  0.989176509964781014f, 0.146730474455361748f, 0.985277642388941222f, 0.170961888760301217f,
+  0.980785280403230431f, 0.195090322016128248f, 0.975702130038528570f, 0.219101240156869798f,
+  0.970031253194543974f, 0.242980179903263871f, 0.963776065795439840f, 0.266712757474898365f,
+  0.956940335732208824f, 0.290284677254462331f, 0.949528180593036675f, 0.313681740398891518f,
+  0.941544065183020806f, 0.336889853392220051f, 0.932992798834738957f, 0.359895036534988111f,
+  0.923879532511286738f, 0.382683432365089782f, 0.914209755703530691f, 0.405241314004989861f,
+  0.903989293123443338f, 0.427555093430282085f, 0.893224301195515324f, 0.449611329654606540f,
+  0.881921264348355050f, 0.471396736825997642f, 0.870086991108711461f, 0.492898192229784038f,
+  0.857728610000272118f, 0.514102744193221661f, 0.844853565249707117f, 0.534997619887097153f,
+  0.831469612302545236f, 0.555570233019602178f, 0.817584813151583711f, 0.575808191417845339f,
+  0.803207531480644943f, 0.595699304492433357f, 0.788346427626606339f, 0.615231590580626819f,
+  0.773010453362736993f, 0.634393284163645488f, 0.757208846506484567f, 0.653172842953776756f,
+  0.740951125354959106f, 0.671558954847018330f, 0.724247082951467003f, 0.689540544737066829f,
+  0.707106781186547573f, 0.707106781186547462f, 0.689540544737066941f, 0.724247082951466892f,
+  0.671558954847018330f, 0.740951125354959106f, 0.653172842953776756f, 0.757208846506484456f,
+  0.634393284163645488f, 0.773010453362736993f, 0.615231590580626819f, 0.788346427626606228f,
+  0.595699304492433468f, 0.803207531480644832f, 0.575808191417845339f, 0.817584813151583711f,
+  0.555570233019602289f, 0.831469612302545236f, 0.534997619887097264f, 0.844853565249707006f,
+  0.514102744193221661f, 0.857728610000272118f, 0.492898192229784093f, 0.870086991108711350f,
+  0.471396736825997809f, 0.881921264348354939f, 0.449611329654606595f, 0.893224301195515324f,
+  0.427555093430282196f, 0.903989293123443338f, 0.405241314004989861f, 0.914209755703530691f,
+  0.382683432365089837f, 0.923879532511286738f, 0.359895036534988277f, 0.932992798834738846f,
+  0.336889853392220051f, 0.941544065183020806f, 0.313681740398891573f, 0.949528180593036675f,
+  0.290284677254462331f, 0.956940335732208935f, 0.266712757474898421f, 0.963776065795439840f,
+  0.242980179903263982f, 0.970031253194543974f, 0.219101240156869770f, 0.975702130038528570f,
+  0.195090322016128331f, 0.980785280403230431f, 0.170961888760301356f, 0.985277642388941222f,
+  0.146730474455361748f, 0.989176509964781014f, 0.122410675199216279f, 0.992479534598709967f,
+  0.098017140329560770f, 0.995184726672196818f, 0.073564563599667454f, 0.997290456678690207f,
+  0.049067674327418126f, 0.998795456205172405f, 0.024541228522912264f, 0.999698818696204250f,
+  0.000000000000000061f, 1.000000000000000000f, -0.024541228522912142f, 0.999698818696204250f,
+  -0.049067674327418008f, 0.998795456205172405f, -0.073564563599667329f, 0.997290456678690207f,
+  -0.098017140329560645f, 0.995184726672196929f, -0.122410675199216154f, 0.992479534598709967f,
+  -0.146730474455361637f, 0.989176509964781014f, -0.170961888760301245f, 0.985277642388941222f,
+  -0.195090322016128193f, 0.980785280403230431f, -0.219101240156869659f, 0.975702130038528570f,
+  -0.242980179903263871f, 0.970031253194543974f, -0.266712757474898310f, 0.963776065795439840f,
+  -0.290284677254462165f, 0.956940335732208935f, -0.313681740398891407f, 0.949528180593036675f,
+  -0.336889853392219940f, 0.941544065183020806f, -0.359895036534988166f, 0.932992798834738846f,
+  -0.382683432365089726f, 0.923879532511286738f, -0.405241314004989750f, 0.914209755703530691f,
+  -0.427555093430281863f, 0.903989293123443449f, -0.449611329654606706f, 0.893224301195515213f,
+  -0.471396736825997698f, 0.881921264348355050f, -0.492898192229783982f, 0.870086991108711461f,
+  -0.514102744193221661f, 0.857728610000272118f, -0.534997619887097042f, 0.844853565249707228f,
+  -0.555570233019601956f, 0.831469612302545458f, -0.575808191417845339f, 0.817584813151583711f,
+  -0.595699304492433357f, 0.803207531480644943f, -0.615231590580626708f, 0.788346427626606339f,
+  -0.634393284163645377f, 0.773010453362737104f, -0.653172842953776533f, 0.757208846506484679f,
+  -0.671558954847018441f, 0.740951125354958995f, -0.689540544737066941f, 0.724247082951466892f,
+  -0.707106781186547462f, 0.707106781186547573f, -0.724247082951466781f, 0.689540544737067052f,
+  -0.740951125354958884f, 0.671558954847018552f, -0.757208846506484567f, 0.653172842953776644f,
+  -0.773010453362736993f, 0.634393284163645488f, -0.788346427626606228f, 0.615231590580626930f,
+  -0.803207531480644832f, 0.595699304492433468f, -0.817584813151583600f, 0.575808191417845450f,
+  -0.831469612302545347f, 0.555570233019602178f, -0.844853565249707117f, 0.534997619887097153f,
+  -0.857728610000272007f, 0.514102744193221772f, -0.870086991108711350f, 0.492898192229784149f,
+  -0.881921264348354939f, 0.471396736825997864f, -0.893224301195515213f, 0.449611329654606873f,
+  -0.903989293123443338f, 0.427555093430282029f, -0.914209755703530691f, 0.405241314004989917f,
+  -0.923879532511286738f, 0.382683432365089893f, -0.932992798834738846f, 0.359895036534988333f,
+  -0.941544065183020695f, 0.336889853392220329f, -0.949528180593036675f, 0.313681740398891407f,
+  -0.956940335732208824f, 0.290284677254462387f, -0.963776065795439840f, 0.266712757474898476f,
+  -0.970031253194543974f, 0.242980179903264065f, -0.975702130038528459f, 0.219101240156870047f,
+  -0.980785280403230431f, 0.195090322016128609f, -0.985277642388941222f, 0.170961888760301217f,
+  -0.989176509964781014f, 0.146730474455361803f, -0.992479534598709967f, 0.122410675199216348f,
+  -0.995184726672196818f, 0.098017140329560826f, -0.997290456678690207f, 0.073564563599667732f,
+  -0.998795456205172405f, 0.049067674327417966f, -0.999698818696204250f, 0.024541228522912326f,
+  -1.000000000000000000f, 0.000000000000000122f, -0.999698818696204250f, -0.024541228522912080f,
+  -0.998795456205172405f, -0.049067674327417724f, -0.997290456678690207f, -0.073564563599667496f,
+  -0.995184726672196929f, -0.098017140329560590f, -0.992479534598709967f, -0.122410675199216099f,
+  -0.989176509964781014f, -0.146730474455361581f, -0.985277642388941333f, -0.170961888760300967f,
+  -0.980785280403230431f, -0.195090322016128359f, -0.975702130038528570f, -0.219101240156869798f,
+  -0.970031253194543974f, -0.242980179903263815f, -0.963776065795439951f, -0.266712757474898254f,
+  -0.956940335732208935f, -0.290284677254462109f, -0.949528180593036786f, -0.313681740398891185f,
+  -0.941544065183020806f, -0.336889853392220107f, -0.932992798834738957f, -0.359895036534988111f,
+  -0.923879532511286850f, -0.382683432365089671f, -0.914209755703530691f, -0.405241314004989694f,
+  -0.903989293123443449f, -0.427555093430281807f, -0.893224301195515324f, -0.449611329654606651f,
+  -0.881921264348355050f, -0.471396736825997642f, -0.870086991108711461f, -0.492898192229783927f,
+  -0.857728610000272118f, -0.514102744193221550f, -0.844853565249707228f, -0.534997619887096931f,
+  -0.831469612302545458f, -0.555570233019601956f, -0.817584813151583711f, -0.575808191417845339f,
+  -0.803207531480644943f, -0.595699304492433246f, -0.788346427626606339f, -0.615231590580626708f,
+  -0.773010453362737104f, -0.634393284163645266f, -0.757208846506484790f, -0.653172842953776533f,
+  -0.740951125354959106f, -0.671558954847018441f, -0.724247082951467003f, -0.689540544737066829f,
+  -0.707106781186547684f, -0.707106781186547462f, -0.689540544737067052f, -0.724247082951466781f,
+  -0.671558954847018663f, -0.740951125354958884f, -0.653172842953777089f, -0.757208846506484234f,
+  -0.634393284163645932f, -0.773010453362736660f, -0.615231590580627263f, -0.788346427626605895f,
+  -0.595699304492433135f, -0.803207531480645054f, -0.575808191417845228f, -0.817584813151583822f,
+  -0.555570233019602178f, -0.831469612302545236f, -0.534997619887097264f, -0.844853565249707006f,
+  -0.514102744193221772f, -0.857728610000272007f, -0.492898192229784204f, -0.870086991108711350f,
+  -0.471396736825997864f, -0.881921264348354939f, -0.449611329654606928f, -0.893224301195515213f,
+  -0.427555093430282473f, -0.903989293123443116f, -0.405241314004990361f, -0.914209755703530469f,
+  -0.382683432365090337f, -0.923879532511286516f, -0.359895036534987944f, -0.932992798834738957f,
+  -0.336889853392219940f, -0.941544065183020806f, -0.313681740398891462f, -0.949528180593036675f,
+  -0.290284677254462442f, -0.956940335732208824f, -0.266712757474898532f, -0.963776065795439840f,
+  -0.242980179903264121f, -0.970031253194543974f, -0.219101240156870103f, -0.975702130038528459f,
+  -0.195090322016128664f, -0.980785280403230320f, -0.170961888760301689f, -0.985277642388941111f,
+  -0.146730474455362303f, -0.989176509964780903f, -0.122410675199215960f, -0.992479534598710078f,
+  -0.098017140329560451f, -0.995184726672196929f, -0.073564563599667357f, -0.997290456678690207f,
+  -0.049067674327418029f, -0.998795456205172405f, -0.024541228522912389f, -0.999698818696204250f
+};
+
+/*
+* @brief  Bit reversal table of the 256 point instances
+*/
+ARM_CCM_TABLE uint16_t armBitRevTable_rad4_256[64] ARM_CCM_SECTION = {
+  0x40, 0x20, 0x60, 0x10, 0x50, 0x30, 0x70, 0x8,
+  0x48, 0x28, 0x68, 0x18, 0x58, 0x38, 0x78, 0x4,
+  0x44, 0x24, 0x64, 0x14, 0x54, 0x34, 0x74, 0xc,
+  0x4c, 0x2c, 0x6c, 0x1c, 0x5c, 0x3c, 0x7c, 0x2,
+  0x42, 0x22, 0x62, 0x12, 0x52, 0x32, 0x72, 0xa,
+  0x4a, 0x2a, 0x6a, 0x1a, 0x5a, 0x3a, 0x7a, 0x6,
+  0x46, 0x26, 0x66, 0x16, 0x56, 0x36, 0x76, 0xe,
+  0x4e, 0x2e, 0x6e, 0x1e, 0x5e, 0x3e, 0x7e, 0x1
+};
+#endif
+
+/*
+* @brief  Twiddle factors of the 1024 point instances
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+ARM_CCM_TABLE float32_t twiddleCoef_rad4_1024[1536] ARM_CCM_SECTION = {
+  1.000000000000000000f, 0.000000000000000000f, 0.999981175282601109f, 0.006135884649154475f,
+  0.999924701839144503f, 0.012271538285719925f, 0.999830581795823403f, 0.018406729905804820f,
+  0.999698818696204250f, 0.024541228522912288f, 0.999529417501093143f, 0.030674803176636626f,
+  0.999322384588349544f, 0.036807222941358832f, 0.999077727752645361f, 0.042938256934940820f,
+  0.998795456205172405f, 0.049067674327418015f, 0.998475580573294774f, 0.055195244349689934f,
+  0.998118112900149179f, 0.061320736302208578f, 0.997723066644191636f, 0.067443919563664051f,
+  0.997290456678690207f, 0.073564563599667426f, 0.996820299291165668f, 0.079682437971430126f,
+  0.996312612182778001f, 0.085797312344439894f, 0.995767414467659817f, 0.091908956497132724f,
+  0.995184726672196929f, 0.098017140329560604f, 0.994564570734255415f, 0.104121633872054586f,
+  0.993906970002356061f, 0.110222207293883059f, 0.993211949234794500f, 0.116318630911904752f,
+  0.992479534598709967f, 0.122410675199216196f, 0.991709753669099525f, 0.128498110793793169f,
+  0.990902635427780010f, 0.134580708507126168f, 0.990058210262297123f, 0.140658239332849211f,
+  0.989176509964781014f, 0.146730474455361748f, 0.988257567730749464f, 0.152797185258443435f,
+  0.987301418157858435f, 0.158858143333861446f, 0.986308097244598669f, 0.164913120489969922f,
+  0.985277642388941222f, 0.170961888760301217f, 0.984210092386929025f, 0.177004220412148749f,
+  0.983105487431216285f, 0.183039887955140951f, 0.981963869109555243f, 0.189068664149806193f,
+  0.980785280403230431f, 0.195090322016128248f, 0.979569765685440519f, 0.201104634842091901f,
+  0.978317370719627655f, 0.207111376192218560f, 0.977028142657754395f, 0.213110319916091362f,
+  0.975702130038528570f, 0.219101240156869798f, 0.974339382785575858f, 0.225083911359792832f,
+  0.972939952205560177f, 0.231058108280671110f, 0.971503890986251784f, 0.237023605994367198f,
+  0.970031253194543974f, 0.242980179903263871f, 0.968522094274417378f, 0.248927605745720149f,
+  0.966976471044852071f, 0.254865659604514572f, 0.965394441697689398f, 0.260794117915275514f,
+  0.963776065795439840f, 0.266712757474898365f, 0.962121404269041580f, 0.272621355449948977f,
+  0.960430519415565787f, 0.278519689385053060f, 0.958703474895871599f, 0.284407537211271877f,
+  0.956940335732208824f, 0.290284677254462331f, 0.955141168305770782f, 0.296150888243623789f,
+  0.953306040354193862f, 0.302005949319228084f, 0.951435020969008338f, 0.307849640041534867f,
+  0.949528180593036675f, 0.313681740398891518f, 0.947585591017741091f, 0.319502030816015692f,
+  0.945607325380521280f, 0.325310292162262926f, 0.943593458161960386f, 0.331106305759876429f,
+  0.941544065183020806f, 0.336889853392220051f, 0.939459223602189919f, 0.342660717311994378f,
+  0.937339011912574960f, 0.348418680249434565f, 0.935183509938947610f, 0.354163525420490344f,
+  0.932992798834738957f, 0.359895036534988111f, 0.930766961078983712f, 0.365612997804773854f,
+  0.928506080473215589f, 0.371317193951837543f, 0.926210242138311379f, 0.377007410216418259f,
+  0.923879532511286738f, 0.382683432365089782f, 0.921514039342042013f, 0.388345046698826246f,
+  0.919113851690057770f, 0.393992040061048099f, 0.916679059921042705f, 0.399624199845646788f,
+  0.914209755703530691f, 0.405241314004989861f, 0.911706032005429878f, 0.410843171057903911f,
+  0.909167983090522380f, 0.416429560097637153f, 0.906595704514915335f, 0.422000270799799682f,
+  0.903989293123443338f, 0.427555093430282085f, 0.901348847046022028f, 0.433093818853151957f,
+  0.898674465693953817f, 0.438616238538527659f, 0.895966249756185218f, 0.444122144570429200f,
+  0.893224301195515324f, 0.449611329654606540f, 0.890448723244757878f, 0.455083587126343836f,
+  0.887639620402853935f, 0.460538710958240005f, 0.884797098430937790f, 0.465976495767966181f,
+  0.881921264348355050f, 0.471396736825997642f, 0.879012226428633525f, 0.476799230063322088f,
+  0.876070094195406601f, 0.482183772079122719f, 0.873094978418290091f, 0.487550160148435996f,
+  0.870086991108711461f, 0.492898192229784038f, 0.867046245515692648f, 0.498227666972781869f,
+  0.863972856121586807f, 0.503538383725717575f, 0.860866938637767309f, 0.508830142543106989f,
+  0.857728610000272118f, 0.514102744193221661f, 0.854557988365400534f, 0.519355990165589643f,
+  0.851355193105265196f, 0.524589682678468949f, 0.848120344803297233f, 0.529803624686294605f,
+  0.844853565249707117f, 0.534997619887097153f, 0.841554977436898444f, 0.540171472729892854f,
+  0.838224705554838079f, 0.545324988422046464f, 0.834862874986380010f, 0.550457972936604811f,
+  0.831469612302545236f, 0.555570233019602178f, 0.828045045257755796f, 0.560661576197336031f,
+  0.824589302785025291f, 0.565731810783613120f, 0.821102514991104648f, 0.570780745886967256f,
+  0.817584813151583711f, 0.575808191417845339f, 0.814036329705948414f, 0.580813958095764526f,
+  0.810457198252594768f, 0.585797857456438864f, 0.806847553543799334f, 0.590759701858874164f,
+  0.803207531480644943f, 0.595699304492433357f, 0.799537269107905013f, 0.600616479383868973f,
+  0.795836904608883566f, 0.605511041404325545f, 0.792106577300212389f, 0.610382806276309475f,
+  0.788346427626606339f, 0.615231590580626819f, 0.784556597155575242f, 0.620057211763289096f,
+  0.780737228572094488f, 0.624859488142386343f, 0.776888465673232442f, 0.629638238914926984f,
+  0.773010453362736993f, 0.634393284163645488f, 0.769103337645579699f, 0.639124444863775731f,
+  0.765167265622458959f, 0.643831542889791386f, 0.761202385484261779f, 0.648514401022112441f,
+  0.757208846506484567f, 0.653172842953776756f, 0.753186799043612520f, 0.657806693297078637f,
+  0.749136394523459370f, 0.662415777590171784f, 0.745057785441466058f, 0.666999922303637471f,
+  0.740951125354959106f, 0.671558954847018330f, 0.736816568877369904f, 0.676092703575315923f,
+  0.732654271672412816f, 0.680600997795453022f, 0.728464390448225196f, 0.685083667772700355f,
+  0.724247082951467003f, 0.689540544737066829f, 0.720002507961381655f, 0.693971460889654002f,
+  0.715730825283818595f, 0.698376249408972916f, 0.711432195745216434f, 0.702754744457225300f,
+  0.707106781186547573f, 0.707106781186547462f, 0.702754744457225300f, 0.711432195745216434f,
+  0.698376249408972916f, 0.715730825283818595f, 0.693971460889654002f, 0.720002507961381655f,
+  0.689540544737066941f, 0.724247082951466892f, 0.685083667772700355f, 0.728464390448225196f,
+  0.680600997795453133f, 0.732654271672412816f, 0.676092703575316034f, 0.736816568877369793f,
+  0.671558954847018330f, 0.740951125354959106f, 0.666999922303637471f, 0.745057785441465947f,
+  0.662415777590171784f, 0.749136394523459259f, 0.657806693297078637f, 0.753186799043612409f,
+  0.653172842953776756f, 0.757208846506484456f, 0.648514401022112552f, 0.761202385484261779f,
+  0.643831542889791497f, 0.765167265622458959f, 0.639124444863775731f, 0.769103337645579588f,
+  0.634393284163645488f, 0.773010453362736993f, 0.629638238914927095f, 0.776888465673232442f,
+  0.624859488142386454f, 0.780737228572094377f, 0.620057211763289207f, 0.784556597155575242f,
+  0.615231590580626819f, 0.788346427626606228f, 0.610382806276309475f, 0.792106577300212389f,
+  0.605511041404325545f, 0.795836904608883455f, 0.600616479383868973f, 0.799537269107905013f,
+  0.595699304492433468f, 0.803207531480644832f, 0.590759701858874275f, 0.806847553543799223f,
+  0.585797857456438864f, 0.810457198252594768f, 0.580813958095764526f, 0.814036329705948303f,
+  0.575808191417845339f, 0.817584813151583711f, 0.570780745886967367f, 0.821102514991104648f,
+  0.565731810783613231f, 0.824589302785025291f, 0.560661576197336031f, 0.828045045257755796f,
+  0.555570233019602289f, 0.831469612302545236f, 0.550457972936604811f, 0.834862874986380010f,
+  0.545324988422046464f, 0.838224705554837968f, 0.540171472729892965f, 0.841554977436898333f,
+  0.534997619887097264f, 0.844853565249707006f, 0.529803624686294827f, 0.848120344803297121f,
+  0.524589682678468838f, 0.851355193105265196f, 0.519355990165589532f, 0.854557988365400534f,
+  0.514102744193221661f, 0.857728610000272118f, 0.508830142543106989f, 0.860866938637767309f,
+  0.503538383725717575f, 0.863972856121586696f, 0.498227666972781869f, 0.867046245515692648f,
+  0.492898192229784093f, 0.870086991108711350f, 0.487550160148436051f, 0.873094978418290091f,
+  0.482183772079122830f, 0.876070094195406601f, 0.476799230063322255f, 0.879012226428633414f,
+  0.471396736825997809f, 0.881921264348354939f, 0.465976495767966126f, 0.884797098430937790f,
+  0.460538710958240005f, 0.887639620402853935f, 0.455083587126343836f, 0.890448723244757878f,
+  0.449611329654606595f, 0.893224301195515324f, 0.444122144570429256f, 0.895966249756185107f,
+  0.438616238538527714f, 0.898674465693953817f, 0.433093818853152013f, 0.901348847046022028f,
+  0.427555093430282196f, 0.903989293123443338f, 0.422000270799799793f, 0.906595704514915335f,
+  0.416429560097637319f, 0.909167983090522269f, 0.410843171057903911f, 0.911706032005429878f,
+  0.405241314004989861f, 0.914209755703530691f, 0.399624199845646788f, 0.916679059921042705f,
+  0.393992040061048099f, 0.919113851690057770f, 0.388345046698826302f, 0.921514039342041902f,
+  0.382683432365089837f, 0.923879532511286738f, 0.377007410216418315f, 0.926210242138311268f,
+  0.371317193951837599f, 0.928506080473215478f, 0.365612997804773965f, 0.930766961078983712f,
+  0.359895036534988277f, 0.932992798834738846f, 0.354163525420490510f, 0.935183509938947499f,
+  0.348418680249434509f, 0.937339011912574960f, 0.342660717311994378f, 0.939459223602189919f,
+  0.336889853392220051f, 0.941544065183020806f, 0.331106305759876429f, 0.943593458161960386f,
+  0.325310292162262982f, 0.945607325380521280f, 0.319502030816015747f, 0.947585591017741091f,
+  0.313681740398891573f, 0.949528180593036675f, 0.307849640041534978f, 0.951435020969008338f,
+  0.302005949319228195f, 0.953306040354193751f, 0.296150888243623955f, 0.955141168305770671f,
+  0.290284677254462331f, 0.956940335732208935f, 0.284407537211271821f, 0.958703474895871599f,
+  0.278519689385053060f, 0.960430519415565787f, 0.272621355449948977f, 0.962121404269041580f,
+  0.266712757474898421f, 0.963776065795439840f, 0.260794117915275570f, 0.965394441697689398f,
+  0.254865659604514627f, 0.966976471044852071f, 0.248927605745720260f, 0.968522094274417267f,
+  0.242980179903263982f, 0.970031253194543974f, 0.237023605994367337f, 0.971503890986251784f,
+  0.231058108280671276f, 0.972939952205560066f, 0.225083911359792777f, 0.974339382785575858f,
+  0.219101240156869770f, 0.975702130038528570f, 0.213110319916091362f, 0.977028142657754395f,
+  0.207111376192218560f, 0.978317370719627655f, 0.201104634842091956f, 0.979569765685440519f,
+  0.195090322016128331f, 0.980785280403230431f, 0.189068664149806276f, 0.981963869109555243f,
+  0.183039887955141062f, 0.983105487431216285f, 0.177004220412148860f, 0.984210092386929025f,
+  0.170961888760301356f, 0.985277642388941222f, 0.164913120489970089f, 0.986308097244598669f,
+  0.158858143333861390f, 0.987301418157858435f, 0.152797185258443408f, 0.988257567730749464f,
+  0.146730474455361748f, 0.989176509964781014f, 0.140658239332849239f, 0.990058210262297123f,
+  0.134580708507126223f, 0.990902635427780010f, 0.128498110793793224f, 0.991709753669099525f,
+  0.122410675199216279f, 0.992479534598709967f, 0.116318630911904877f, 0.993211949234794500f,
+  0.110222207293883184f, 0.993906970002356061f, 0.104121633872054725f, 0.994564570734255415f,
+  0.098017140329560770f, 0.995184726672196818f, 0.091908956497132696f, 0.995767414467659817f,
+  0.085797312344439880f, 0.996312612182778001f, 0.079682437971430126f, 0.996820299291165668f,
+  0.073564563599667454f, 0.997290456678690207f, 0.067443919563664106f, 0.997723066644191636f,
+  0.061320736302208648f, 0.998118112900149179f, 0.055195244349690031f, 0.998475580573294774f,
+  0.049067674327418126f, 0.998795456205172405f, 0.042938256934940959f, 0.999077727752645361f,
+  0.036807222941358991f, 0.999322384588349544f, 0.030674803176636581f, 0.999529417501093143f,
+  0.024541228522912264f, 0.999698818696204250f, 0.018406729905804820f, 0.999830581795823403f,
+  0.012271538285719944f, 0.999924701839144503f, 0.006135884649154515f, 0.999981175282601109f,
+  0.000000000000000061f, 1.000000000000000000f, -0.006135884649154393f, 0.999981175282601109f,
+  -0.012271538285719823f, 0.999924701839144503f, -0.018406729905804695f, 0.999830581795823403f,
+  -0.024541228522912142f, 0.999698818696204250f, -0.030674803176636459f, 0.999529417501093143f,
+  -0.036807222941358866f, 0.999322384588349544f, -0.042938256934940834f, 0.999077727752645361f,
+  -0.049067674327418008f, 0.998795456205172405f, -0.055195244349689913f, 0.998475580573294774f,
+  -0.061320736302208530f, 0.998118112900149179f, -0.067443919563663982f, 0.997723066644191636f,
+  -0.073564563599667329f, 0.997290456678690207f, -0.079682437971430015f, 0.996820299291165779f,
+  -0.085797312344439755f, 0.996312612182778001f, -0.091908956497132571f, 0.995767414467659817f,
+  -0.098017140329560645f, 0.995184726672196929f, -0.104121633872054600f, 0.994564570734255415f,
+  -0.110222207293883059f, 0.993906970002356061f, -0.116318630911904752f, 0.993211949234794500f,
+  -0.122410675199216154f, 0.992479534598709967f, -0.128498110793793113f, 0.991709753669099525f,
+  -0.134580708507126112f, 0.990902635427780010f, -0.140658239332849128f, 0.990058210262297123f,
+  -0.146730474455361637f, 0.989176509964781014f, -0.152797185258443297f, 0.988257567730749464f,
+  -0.158858143333861279f, 0.987301418157858435f, -0.164913120489969950f, 0.986308097244598669f,
+  -0.170961888760301245f, 0.985277642388941222f, -0.177004220412148749f, 0.984210092386929025f,
+  -0.183039887955140923f, 0.983105487431216285f, -0.189068664149806165f, 0.981963869109555243f,
+  -0.195090322016128193f, 0.980785280403230431f, -0.201104634842091817f, 0.979569765685440519f,
+  -0.207111376192218449f, 0.978317370719627655f, -0.213110319916091251f, 0.977028142657754395f,
+  -0.219101240156869659f, 0.975702130038528570f, -0.225083911359792666f, 0.974339382785575858f,
+  -0.231058108280671137f, 0.972939952205560177f, -0.237023605994367226f, 0.971503890986251784f,
+  -0.242980179903263871f, 0.970031253194543974f, -0.248927605745720121f, 0.968522094274417378f,
+  -0.254865659604514516f, 0.966976471044852071f, -0.260794117915275458f, 0.965394441697689398f,
+  -0.266712757474898310f, 0.963776065795439840f, -0.272621355449948866f, 0.962121404269041580f,
+  -0.278519689385052949f, 0.960430519415565898f, -0.284407537211271710f, 0.958703474895871599f,
+  -0.290284677254462165f, 0.956940335732208935f, -0.296150888243623844f, 0.955141168305770671f,
+  -0.302005949319228084f, 0.953306040354193862f, -0.307849640041534867f, 0.951435020969008338f,
+  -0.313681740398891407f, 0.949528180593036675f, -0.319502030816015636f, 0.947585591017741202f,
+  -0.325310292162262871f, 0.945607325380521391f, -0.331106305759876318f, 0.943593458161960386f,
+  -0.336889853392219940f, 0.941544065183020806f, -0.342660717311994267f, 0.939459223602189919f,
+  -0.348418680249434398f, 0.937339011912574960f, -0.354163525420490399f, 0.935183509938947610f,
+  -0.359895036534988166f, 0.932992798834738846f, -0.365612997804773854f, 0.930766961078983712f,
+  -0.371317193951837488f, 0.928506080473215589f, -0.377007410216418204f, 0.926210242138311379f,
+  -0.382683432365089726f, 0.923879532511286738f, -0.388345046698826191f, 0.921514039342042013f,
+  -0.393992040061047988f, 0.919113851690057770f, -0.399624199845646677f, 0.916679059921042705f,
+  -0.405241314004989750f, 0.914209755703530691f, -0.410843171057903800f, 0.911706032005429878f,
+  -0.416429560097636986f, 0.909167983090522491f, -0.422000270799799682f, 0.906595704514915335f,
+  -0.427555093430281863f, 0.903989293123443449f, -0.433093818853151902f, 0.901348847046022028f,
+  -0.438616238538527381f, 0.898674465693953928f, -0.444122144570429145f, 0.895966249756185218f,
+  -0.449611329654606706f, 0.893224301195515213f, -0.455083587126343725f, 0.890448723244757989f,
+  -0.460538710958240061f, 0.887639620402853935f, -0.465976495767966015f, 0.884797098430937901f,
+  -0.471396736825997698f, 0.881921264348355050f, -0.476799230063321922f, 0.879012226428633525f,
+  -0.482183772079122719f, 0.876070094195406601f, -0.487550160148435718f, 0.873094978418290202f,
+  -0.492898192229783982f, 0.870086991108711461f, -0.498227666972781591f, 0.867046245515692759f,
+  -0.503538383725717464f, 0.863972856121586807f, -0.508830142543107100f, 0.860866938637767198f,
+  -0.514102744193221661f, 0.857728610000272118f, -0.519355990165589643f, 0.854557988365400534f,
+  -0.524589682678468727f, 0.851355193105265196f, -0.529803624686294716f, 0.848120344803297233f,
+  -0.534997619887097042f, 0.844853565249707228f, -0.540171472729892854f, 0.841554977436898444f,
+  -0.545324988422046242f, 0.838224705554838190f, -0.550457972936604700f, 0.834862874986380121f,
+  -0.555570233019601956f, 0.831469612302545458f, -0.560661576197335920f, 0.828045045257755796f,
+  -0.565731810783613231f, 0.824589302785025180f, -0.570780745886967145f, 0.821102514991104759f,
+  -0.575808191417845339f, 0.817584813151583711f, -0.580813958095764415f, 0.814036329705948525f,
+  -0.585797857456438864f, 0.810457198252594768f, -0.590759701858874053f, 0.806847553543799445f,
+  -0.595699304492433357f, 0.803207531480644943f, -0.600616479383868751f, 0.799537269107905235f,
+  -0.605511041404325434f, 0.795836904608883566f, -0.610382806276309586f, 0.792106577300212278f,
+  -0.615231590580626708f, 0.788346427626606339f, -0.620057211763289207f, 0.784556597155575131f,
+  -0.624859488142386232f, 0.780737228572094599f, -0.629638238914927095f, 0.776888465673232442f,
+  -0.634393284163645377f, 0.773010453362737104f, -0.639124444863775731f, 0.769103337645579588f,
+  -0.643831542889791275f, 0.765167265622459070f, -0.648514401022112441f, 0.761202385484261890f,
+  -0.653172842953776533f, 0.757208846506484679f, -0.657806693297078637f, 0.753186799043612520f,
+  -0.662415777590171895f, 0.749136394523459259f, -0.666999922303637360f, 0.745057785441466058f,
+  -0.671558954847018441f, 0.740951125354958995f, -0.676092703575315812f, 0.736816568877370015f,
+  -0.680600997795453022f, 0.732654271672412816f, -0.685083667772700244f, 0.728464390448225307f,
+  -0.689540544737066941f, 0.724247082951466892f, -0.693971460889653780f, 0.720002507961381766f,
+  -0.698376249408972805f, 0.715730825283818706f, -0.702754744457225078f, 0.711432195745216656f,
+  -0.707106781186547462f, 0.707106781186547573f, -0.711432195745216545f, 0.702754744457225189f,
+  -0.715730825283818595f, 0.698376249408972916f, -0.720002507961381655f, 0.693971460889654002f,
+  -0.724247082951466781f, 0.689540544737067052f, -0.728464390448225196f, 0.685083667772700355f,
+  -0.732654271672412705f, 0.680600997795453244f, -0.736816568877369904f, 0.676092703575315923f,
+  -0.740951125354958884f, 0.671558954847018552f, -0.745057785441465947f, 0.666999922303637582f,
+  -0.749136394523459148f, 0.662415777590172006f, -0.753186799043612409f, 0.657806693297078748f,
+  -0.757208846506484567f, 0.653172842953776644f, -0.761202385484261668f, 0.648514401022112552f,
+  -0.765167265622458959f, 0.643831542889791386f, -0.769103337645579477f, 0.639124444863775842f,
+  -0.773010453362736993f, 0.634393284163645488f, -0.776888465673232331f, 0.629638238914927206f,
+  -0.780737228572094488f, 0.624859488142386343f, -0.784556597155575020f, 0.620057211763289429f,
+  -0.788346427626606228f, 0.615231590580626930f, -0.792106577300212167f, 0.610382806276309697f,
+  -0.795836904608883455f, 0.605511041404325656f, -0.799537269107905124f, 0.600616479383868862f,
+  -0.803207531480644832f, 0.595699304492433468f, -0.806847553543799334f, 0.590759701858874164f,
+  -0.810457198252594657f, 0.585797857456438975f, -0.814036329705948414f, 0.580813958095764526f,
+  -0.817584813151583600f, 0.575808191417845450f, -0.821102514991104648f, 0.570780745886967256f,
+  -0.824589302785025069f, 0.565731810783613454f, -0.828045045257755685f, 0.560661576197336142f,
+  -0.831469612302545347f, 0.555570233019602178f, -0.834862874986380010f, 0.550457972936604922f,
+  -0.838224705554838079f, 0.545324988422046353f, -0.841554977436898333f, 0.540171472729892965f,
+  -0.844853565249707117f, 0.534997619887097153f, -0.848120344803297121f, 0.529803624686294827f,
+  -0.851355193105265196f, 0.524589682678468949f, -0.854557988365400423f, 0.519355990165589754f,
+  -0.857728610000272007f, 0.514102744193221772f, -0.860866938637767087f, 0.508830142543107322f,
+  -0.863972856121586696f, 0.503538383725717686f, -0.867046245515692759f, 0.498227666972781758f,
+  -0.870086991108711350f, 0.492898192229784149f, -0.873094978418290091f, 0.487550160148435885f,
+  -0.876070094195406490f, 0.482183772079122885f, -0.879012226428633525f, 0.476799230063322088f,
+  -0.881921264348354939f, 0.471396736825997864f, -0.884797098430937790f, 0.465976495767966181f,
+  -0.887639620402853824f, 0.460538710958240227f, -0.890448723244757878f, 0.455083587126343891f,
+  -0.893224301195515213f, 0.449611329654606873f, -0.895966249756185107f, 0.444122144570429311f,
+  -0.898674465693953928f, 0.438616238538527548f, -0.901348847046021917f, 0.433093818853152068f,
+  -0.903989293123443338f, 0.427555093430282029f, -0.906595704514915335f, 0.422000270799799848f,
+  -0.909167983090522380f, 0.416429560097637153f, -0.911706032005429767f, 0.410843171057904133f,
+  -0.914209755703530691f, 0.405241314004989917f, -0.916679059921042594f, 0.399624199845647066f,
+  -0.919113851690057770f, 0.393992040061048154f, -0.921514039342041791f, 0.388345046698826579f,
+  -0.923879532511286738f, 0.382683432365089893f, -0.926210242138311379f, 0.377007410216418148f,
+  -0.928506080473215478f, 0.371317193951837710f, -0.930766961078983712f, 0.365612997804773798f,
+  -0.932992798834738846f, 0.359895036534988333f, -0.935183509938947610f, 0.354163525420490399f,
+  -0.937339011912574849f, 0.348418680249434787f, -0.939459223602189919f, 0.342660717311994434f,
+  -0.941544065183020695f, 0.336889853392220329f, -0.943593458161960386f, 0.331106305759876485f,
+  -0.945607325380521169f, 0.325310292162263259f, -0.947585591017741091f, 0.319502030816015803f,
+  -0.949528180593036675f, 0.313681740398891407f, -0.951435020969008338f, 0.307849640041535033f,
+  -0.953306040354193862f, 0.302005949319228029f, -0.955141168305770671f, 0.296150888243624011f,
+  -0.956940335732208824f, 0.290284677254462387f, -0.958703474895871488f, 0.284407537211272099f,
+  -0.960430519415565787f, 0.278519689385053171f, -0.962121404269041469f, 0.272621355449949254f,
+  -0.963776065795439840f, 0.266712757474898476f, -0.965394441697689287f, 0.260794117915275847f,
+  -0.966976471044852071f, 0.254865659604514683f, -0.968522094274417378f, 0.248927605745720093f,
+  -0.970031253194543974f, 0.242980179903264065f, -0.971503890986251784f, 0.237023605994367170f,
+  -0.972939952205560066f, 0.231058108280671332f, -0.974339382785575858f, 0.225083911359792832f,
+  -0.975702130038528459f, 0.219101240156870047f, -0.977028142657754395f, 0.213110319916091417f,
+  -0.978317370719627544f, 0.207111376192218838f, -0.979569765685440519f, 0.201104634842092012f,
+  -0.980785280403230431f, 0.195090322016128609f, -0.981963869109555243f, 0.189068664149806359f,
+  -0.983105487431216285f, 0.183039887955140895f, -0.984210092386929025f, 0.177004220412148944f,
+  -0.985277642388941222f, 0.170961888760301217f, -0.986308097244598558f, 0.164913120489970144f,
+  -0.987301418157858435f, 0.158858143333861473f, -0.988257567730749464f, 0.152797185258443685f,
+  -0.989176509964781014f, 0.146730474455361803f, -0.990058210262297012f, 0.140658239332849544f,
+  -0.990902635427780010f, 0.134580708507126279f, -0.991709753669099525f, 0.128498110793793086f,
+  -0.992479534598709967f, 0.122410675199216348f, -0.993211949234794500f, 0.116318630911904711f,
+  -0.993906970002356061f, 0.110222207293883240f, -0.994564570734255415f, 0.104121633872054573f,
+  -0.995184726672196818f, 0.098017140329560826f, -0.995767414467659817f, 0.091908956497132752f,
+  -0.996312612182778001f, 0.085797312344440158f, -0.996820299291165668f, 0.079682437971430195f,
+  -0.997290456678690207f, 0.073564563599667732f, -0.997723066644191636f, 0.067443919563664176f,
+  -0.998118112900149179f, 0.061320736302208488f, -0.998475580573294774f, 0.055195244349690094f,
+  -0.998795456205172405f, 0.049067674327417966f, -0.999077727752645361f, 0.042938256934941021f,
+  -0.999322384588349544f, 0.036807222941358832f, -0.999529417501093143f, 0.030674803176636865f,
+  -0.999698818696204250f, 0.024541228522912326f, -0.999830581795823403f, 0.018406729905805101f,
+  -0.999924701839144503f, 0.012271538285720007f, -0.999981175282601109f, 0.006135884649154799f,
+  -1.000000000000000000f, 0.000000000000000122f, -0.999981175282601109f, -0.006135884649154554f,
+  -0.999924701839144503f, -0.012271538285719762f, -0.999830581795823403f, -0.018406729905804858f,
+  -0.999698818696204250f, -0.024541228522912080f, -0.999529417501093143f, -0.030674803176636619f,
+  -0.999322384588349544f, -0.036807222941358582f, -0.999077727752645361f, -0.042938256934940779f,
+  -0.998795456205172405f, -0.049067674327417724f, -0.998475580573294774f, -0.055195244349689851f,
+  -0.998118112900149179f, -0.061320736302208245f, -0.997723066644191636f, -0.067443919563663926f,
+  -0.997290456678690207f, -0.073564563599667496f, -0.996820299291165779f, -0.079682437971429945f,
+  -0.996312612182778001f, -0.085797312344439922f, -0.995767414467659817f, -0.091908956497132516f,
+  -0.995184726672196929f, -0.098017140329560590f, -0.994564570734255526f, -0.104121633872054323f,
+  -0.993906970002356061f, -0.110222207293883004f, -0.993211949234794611f, -0.116318630911904475f,
+  -0.992479534598709967f, -0.122410675199216099f, -0.991709753669099525f, -0.128498110793792836f,
+  -0.990902635427780010f, -0.134580708507126057f, -0.990058210262297123f, -0.140658239332849294f,
+  -0.989176509964781014f, -0.146730474455361581f, -0.988257567730749464f, -0.152797185258443435f,
+  -0.987301418157858435f, -0.158858143333861224f, -0.986308097244598669f, -0.164913120489969894f,
+  -0.985277642388941333f, -0.170961888760300967f, -0.984210092386929136f, -0.177004220412148694f,
+  -0.983105487431216396f, -0.183039887955140645f, -0.981963869109555243f, -0.189068664149806109f,
+  -0.980785280403230431f, -0.195090322016128359f, -0.979569765685440519f, -0.201104634842091762f,
+  -0.978317370719627655f, -0.207111376192218588f, -0.977028142657754395f, -0.213110319916091195f,
+  -0.975702130038528570f, -0.219101240156869798f, -0.974339382785575858f, -0.225083911359792610f,
+  -0.972939952205560177f, -0.231058108280671082f, -0.971503890986251895f, -0.237023605994366948f,
+  -0.970031253194543974f, -0.242980179903263815f, -0.968522094274417378f, -0.248927605745719871f,
+  -0.966976471044852182f, -0.254865659604514461f, -0.965394441697689398f, -0.260794117915275625f,
+  -0.963776065795439951f, -0.266712757474898254f, -0.962121404269041580f, -0.272621355449949032f,
+  -0.960430519415565898f, -0.278519689385052893f, -0.958703474895871599f, -0.284407537211271821f,
+  -0.956940335732208935f, -0.290284677254462109f, -0.955141168305770782f, -0.296150888243623789f,
+  -0.953306040354193973f, -0.302005949319227807f, -0.951435020969008449f, -0.307849640041534811f,
+  -0.949528180593036786f, -0.313681740398891185f, -0.947585591017741202f, -0.319502030816015581f,
+  -0.945607325380521280f, -0.325310292162262982f, -0.943593458161960386f, -0.331106305759876263f,
+  -0.941544065183020806f, -0.336889853392220107f, -0.939459223602190030f, -0.342660717311994212f,
+  -0.937339011912574960f, -0.348418680249434565f, -0.935183509938947721f, -0.354163525420490122f,
+  -0.932992798834738957f, -0.359895036534988111f, -0.930766961078983823f, -0.365612997804773576f,
+  -0.928506080473215589f, -0.371317193951837432f, -0.926210242138311490f, -0.377007410216417926f,
+  -0.923879532511286850f, -0.382683432365089671f, -0.921514039342041902f, -0.388345046698826357f,
+  -0.919113851690057770f, -0.393992040061047932f, -0.916679059921042705f, -0.399624199845646844f,
+  -0.914209755703530691f, -0.405241314004989694f, -0.911706032005429878f, -0.410843171057903911f,
+  -0.909167983090522491f, -0.416429560097636930f, -0.906595704514915446f, -0.422000270799799626f,
+  -0.903989293123443449f, -0.427555093430281807f, -0.901348847046022028f, -0.433093818853151846f,
+  -0.898674465693954039f, -0.438616238538527325f, -0.895966249756185218f, -0.444122144570429089f,
+  -0.893224301195515324f, -0.449611329654606651f, -0.890448723244757989f, -0.455083587126343669f,
+  -0.887639620402853935f, -0.460538710958240061f, -0.884797098430937901f, -0.465976495767965959f,
+  -0.881921264348355050f, -0.471396736825997642f, -0.879012226428633636f, -0.476799230063321866f,
+  -0.876070094195406601f, -0.482183772079122663f, -0.873094978418290202f, -0.487550160148435663f,
+  -0.870086991108711461f, -0.492898192229783927f, -0.867046245515692870f, -0.498227666972781535f,
+  -0.863972856121586807f, -0.503538383725717464f, -0.860866938637767309f, -0.508830142543107100f,
+  -0.857728610000272118f, -0.514102744193221550f, -0.854557988365400534f, -0.519355990165589643f,
+  -0.851355193105265307f, -0.524589682678468727f, -0.848120344803297233f, -0.529803624686294605f,
+  -0.844853565249707228f, -0.534997619887096931f, -0.841554977436898444f, -0.540171472729892854f,
+  -0.838224705554838190f, -0.545324988422046131f, -0.834862874986380121f, -0.550457972936604700f,
+  -0.831469612302545458f, -0.555570233019601956f, -0.828045045257755796f, -0.560661576197335920f,
+  -0.824589302785025291f, -0.565731810783613231f, -0.821102514991104759f, -0.570780745886967145f,
+  -0.817584813151583711f, -0.575808191417845339f, -0.814036329705948525f, -0.580813958095764304f,
+  -0.810457198252594768f, -0.585797857456438864f, -0.806847553543799445f, -0.590759701858873942f,
+  -0.803207531480644943f, -0.595699304492433246f, -0.799537269107905235f, -0.600616479383868640f,
+  -0.795836904608883566f, -0.605511041404325434f, -0.792106577300212278f, -0.610382806276309475f,
+  -0.788346427626606339f, -0.615231590580626708f, -0.784556597155575242f, -0.620057211763289207f,
+  -0.780737228572094599f, -0.624859488142386232f, -0.776888465673232442f, -0.629638238914926984f,
+  -0.773010453362737104f, -0.634393284163645266f, -0.769103337645579699f, -0.639124444863775731f,
+  -0.765167265622459070f, -0.643831542889791275f, -0.761202385484261890f, -0.648514401022112330f,
+  -0.757208846506484790f, -0.653172842953776533f, -0.753186799043612631f, -0.657806693297078526f,
+  -0.749136394523459259f, -0.662415777590171784f, -0.745057785441466058f, -0.666999922303637360f,
+  -0.740951125354959106f, -0.671558954847018441f, -0.736816568877370015f, -0.676092703575315812f,
+  -0.732654271672412816f, -0.680600997795453022f, -0.728464390448225418f, -0.685083667772700133f,
+  -0.724247082951467003f, -0.689540544737066829f, -0.720002507961381877f, -0.693971460889653780f,
+  -0.715730825283818706f, -0.698376249408972805f, -0.711432195745216656f, -0.702754744457225078f,
+  -0.707106781186547684f, -0.707106781186547462f, -0.702754744457225300f, -0.711432195745216434f,
+  -0.698376249408973027f, -0.715730825283818484f, -0.693971460889654002f, -0.720002507961381655f,
+  -0.689540544737067052f, -0.724247082951466781f, -0.685083667772700355f, -0.728464390448225196f,
+  -0.680600997795453244f, -0.732654271672412594f, -0.676092703575316034f, -0.736816568877369793f,
+  -0.671558954847018663f, -0.740951125354958884f, -0.666999922303637582f, -0.745057785441465836f,
+  -0.662415777590172006f, -0.749136394523459037f, -0.657806693297078748f, -0.753186799043612409f,
+  -0.653172842953777089f, -0.757208846506484234f, -0.648514401022112219f, -0.761202385484262001f,
+  -0.643831542889791497f, -0.765167265622458959f, -0.639124444863775953f, -0.769103337645579477f,
+  -0.634393284163645932f, -0.773010453362736660f, -0.629638238914926873f, -0.776888465673232553f,
+  -0.624859488142386454f, -0.780737228572094377f, -0.620057211763289429f, -0.784556597155575020f,
+  -0.615231590580627263f, -0.788346427626605895f, -0.610382806276309364f, -0.792106577300212389f,
+  -0.605511041404325656f, -0.795836904608883455f, -0.600616479383869306f, -0.799537269107904791f,
+  -0.595699304492433135f, -0.803207531480645054f, -0.590759701858874275f, -0.806847553543799223f,
+  -0.585797857456439086f, -0.810457198252594657f, -0.580813958095764971f, -0.814036329705948081f,
+  -0.575808191417845228f, -0.817584813151583822f, -0.570780745886967367f, -0.821102514991104648f,
+  -0.565731810783613454f, -0.824589302785025069f, -0.560661576197336475f, -0.828045045257755463f,
+  -0.555570233019602178f, -0.831469612302545236f, -0.550457972936604922f, -0.834862874986380010f,
+  -0.545324988422046797f, -0.838224705554837857f, -0.540171472729892743f, -0.841554977436898555f,
+  -0.534997619887097264f, -0.844853565249707006f, -0.529803624686294938f, -0.848120344803297121f,
+  -0.524589682678469393f, -0.851355193105264862f, -0.519355990165589421f, -0.854557988365400645f,
+  -0.514102744193221772f, -0.857728610000272007f, -0.508830142543107322f, -0.860866938637767087f,
+  -0.503538383725718020f, -0.863972856121586474f, -0.498227666972781813f, -0.867046245515692648f,
+  -0.492898192229784204f, -0.870086991108711350f, -0.487550160148436329f, -0.873094978418289869f,
+  -0.482183772079122552f, -0.876070094195406712f, -0.476799230063322144f, -0.879012226428633414f,
+  -0.471396736825997864f, -0.881921264348354939f, -0.465976495767966625f, -0.884797098430937567f,
+  -0.460538710958239894f, -0.887639620402854046f, -0.455083587126343947f, -0.890448723244757878f,
+  -0.449611329654606928f, -0.893224301195515213f, -0.444122144570429755f, -0.895966249756184885f,
+  -0.438616238538527603f, -0.898674465693953817f, -0.433093818853152124f, -0.901348847046021917f,
+  -0.427555093430282473f, -0.903989293123443116f, -0.422000270799799515f, -0.906595704514915446f,
+  -0.416429560097637208f, -0.909167983090522380f, -0.410843171057904188f, -0.911706032005429767f,
+  -0.405241314004990361f, -0.914209755703530469f, -0.399624199845646733f, -0.916679059921042705f,
+  -0.393992040061048210f, -0.919113851690057659f, -0.388345046698826635f, -0.921514039342041791f,
+  -0.382683432365090337f, -0.923879532511286516f, -0.377007410216418204f, -0.926210242138311379f,
+  -0.371317193951837765f, -0.928506080473215478f, -0.365612997804774298f, -0.930766961078983601f,
+  -0.359895036534987944f, -0.932992798834738957f, -0.354163525420490455f, -0.935183509938947610f,
+  -0.348418680249434842f, -0.937339011912574849f, -0.342660717311994878f, -0.939459223602189697f,
+  -0.336889853392219940f, -0.941544065183020806f, -0.331106305759876540f, -0.943593458161960275f,
+  -0.325310292162263315f, -0.945607325380521169f, -0.319502030816015414f, -0.947585591017741202f,
+  -0.313681740398891462f, -0.949528180593036675f, -0.307849640041535089f, -0.951435020969008338f,
+  -0.302005949319228528f, -0.953306040354193751f, -0.296150888243623678f, -0.955141168305770782f,
+  -0.290284677254462442f, -0.956940335732208824f, -0.284407537211272154f, -0.958703474895871488f,
+  -0.278519689385053615f, -0.960430519415565676f, -0.272621355449948866f, -0.962121404269041580f,
+  -0.266712757474898532f, -0.963776065795439840f, -0.260794117915275903f, -0.965394441697689287f,
+  -0.254865659604514350f, -0.966976471044852182f, -0.248927605745720149f, -0.968522094274417267f,
+  -0.242980179903264121f, -0.970031253194543974f, -0.237023605994367670f, -0.971503890986251673f,
+  -0.231058108280670943f, -0.972939952205560177f, -0.225083911359792915f, -0.974339382785575858f,
+  -0.219101240156870103f, -0.975702130038528459f, -0.213110319916091917f, -0.977028142657754284f,
+  -0.207111376192218477f, -0.978317370719627655f, -0.201104634842092067f, -0.979569765685440519f,
+  -0.195090322016128664f, -0.980785280403230320f, -0.189068664149805971f, -0.981963869109555354f,
+  -0.183039887955140951f, -0.983105487431216285f, -0.177004220412148999f, -0.984210092386929025f,
+  -0.170961888760301689f, -0.985277642388941111f, -0.164913120489969756f, -0.986308097244598669f,
+  -0.158858143333861529f, -0.987301418157858324f, -0.152797185258443741f, -0.988257567730749464f,
+  -0.146730474455362303f, -0.989176509964780903f, -0.140658239332849155f, -0.990058210262297123f,
+  -0.134580708507126362f, -0.990902635427780010f, -0.128498110793793585f, -0.991709753669099525f,
+  -0.122410675199215960f, -0.992479534598710078f, -0.116318630911904766f, -0.993211949234794500f,
+  -0.110222207293883309f, -0.993906970002356061f, -0.104121633872055072f, -0.994564570734255415f,
+  -0.098017140329560451f, -0.995184726672196929f, -0.091908956497132821f, -0.995767414467659817f,
+  -0.085797312344440227f, -0.996312612182778001f, -0.079682437971430695f, -0.996820299291165668f,
+  -0.073564563599667357f, -0.997290456678690207f, -0.067443919563664231f, -0.997723066644191636f,
+  -0.061320736302208995f, -0.998118112900149179f, -0.055195244349689712f, -0.998475580573294774f,
+  -0.049067674327418029f, -0.998795456205172405f, -0.042938256934941084f, -0.999077727752645361f,
+  -0.036807222941359331f, -0.999322384588349433f, -0.030674803176636484f, -0.999529417501093143f,
+  -0.024541228522912389f, -0.999698818696204250f, -0.018406729905805164f, -0.999830581795823403f,
+  -0.012271538285720512f, -0.999924701839144503f, -0.006135884649154416f, -0.999981175282601109f
+};
+
+/*
+* @brief  Bit reversal table of the 1024 point instances
+*/
+ARM_CCM_TABLE uint16_t armBitRevTable_rad4_1024[256] ARM_CCM_SECTION = {
+  0x100, 0x80, 0x180, 0x40, 0x140, 0xc0, 0x1c0, 0x20,
+  0x120, 0xa0, 0x1a0, 0x60, 0x160, 0xe0, 0x1e0, 0x10,
+  0x110, 0x90, 0x190, 0x50, 0x150, 0xd0, 0x1d0, 0x30,
+  0x130, 0xb0, 0x1b0, 0x70, 0x170, 0xf0, 0x1f0, 0x8,
+  0x108, 0x88, 0x188, 0x48, 0x148, 0xc8, 0x1c8, 0x28,
+  0x128, 0xa8, 0x1a8, 0x68, 0x168, 0xe8, 0x1e8, 0x18,
+  0x118, 0x98, 0x198, 0x58, 0x158, 0xd8, 0x1d8, 0x38,
+  0x138, 0xb8, 0x1b8, 0x78, 0x178, 0xf8, 0x1f8, 0x4,
+  0x104, 0x84, 0x184, 0x44, 0x144, 0xc4, 0x1c4, 0x24,
+  0x124, 0xa4, 0x1a4, 0x64, 0x164, 0xe4, 0x1e4, 0x14,
+  0x114, 0x94, 0x194, 0x54, 0x154, 0xd4, 0x1d4, 0x34,
+  0x134, 0xb4, 0x1b4, 0x74, 0x174, 0xf4, 0x1f4, 0xc,
+  0x10c, 0x8c, 0x18c, 0x4c, 0x14c, 0xcc, 0x1cc, 0x2c,
+  0x12c, 0xac, 0x1ac, 0x6c, 0x16c, 0xec, 0x1ec, 0x1c,
+  0x11c, 0x9c, 0x19c, 0x5c, 0x15c, 0xdc, 0x1dc, 0x3c,
+  0x13c, 0xbc, 0x1bc, 0x7c, 0x17c, 0xfc, 0x1fc, 0x2,
+  0x102, 0x82, 0x182, 0x42, 0x142, 0xc2, 0x1c2, 0x22,
+  0x122, 0xa2, 0x1a2, 0x62, 0x162, 0xe2, 0x1e2, 0x12,
+  0x112, 0x92, 0x192, 0x52, 0x152, 0xd2, 0x1d2, 0x32,
+  0x132, 0xb2, 0x1b2, 0x72, 0x172, 0xf2, 0x1f2, 0xa,
+  0x10a, 0x8a, 0x18a, 0x4a, 0x14a, 0xca, 0x1ca, 0x2a,
+  0x12a, 0xaa, 0x1aa, 0x6a, 0x16a, 0xea, 0x1ea, 0x1a,
+  0x11a, 0x9a, 0x19a, 0x5a, 0x15a, 0xda, 0x1da, 0x3a,
+  0x13a, 0xba, 0x1ba, 0x7a, 0x17a, 0xfa, 0x1fa, 0x6,
+  0x106, 0x86, 0x186, 0x46, 0x146, 0xc6, 0x1c6, 0x26,
+  0x126, 0xa6, 0x1a6, 0x66, 0x166, 0xe6, 0x1e6, 0x16,
+  0x116, 0x96, 0x196, 0x56, 0x156, 0xd6, 0x1d6, 0x36,
+  0x136, 0xb6, 0x1b6, 0x76, 0x176, 0xf6, 0x1f6, 0xe,
+  0x10e, 0x8e, 0x18e, 0x4e, 0x14e, 0xce, 0x1ce, 0x2e,
+  0x12e, 0xae, 0x1ae, 0x6e, 0x16e, 0xee, 0x1ee, 0x1e,
+  0x11e, 0x9e, 0x19e, 0x5e, 0x15e, 0xde, 0x1de, 0x3e,
+  0x13e, 0xbe, 0x1be, 0x7e, 0x17e, 0xfe, 0x1fe, 0x1
+};
+#endif
+
+/*
+* @brief  64 point CFFT instance, output in normal order
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
+const arm_cfft_radix4_instance_f32 arm_cfft_radix4_sR_f32_len64 = {
+  64u, 0u, 1u, (float32_t *) twiddleCoef_rad4_64, (uint16_t *) armBitRevTable_rad4_64, 1u, 1u, 0.015625f
+};
+
+/*
+* @brief  64 point CIFFT instance, output in normal order
+*/
+const arm_cfft_radix4_instance_f32 arm_cifft_radix4_sR_f32_len64 = {
+  64u, 1u, 1u, (float32_t *) twiddleCoef_rad4_64, (uint16_t *) armBitRevTable_rad4_64, 1u, 1u, 0.015625f
+};
+#endif
+
+/*
+* @brief  256 point CFFT instance, output in normal order
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
+const arm_cfft_radix4_instance_f32 arm_cfft_radix4_sR_f32_len256 = {
+  256u, 0u, 1u, (float32_t *) twiddleCoef_rad4_256, (uint16_t *) armBitRevTable_rad4_256, 1u, 1u, 0.00390625f
+};
+
+/*
+* @brief  256 point CIFFT instance, output in normal order
+*/
+const arm_cfft_radix4_instance_f32 arm_cifft_radix4_sR_f32_len256 = {
+  256u, 1u, 1u, (float32_t *) twiddleCoef_rad4_256, (uint16_t *) armBitRevTable_rad4_256, 1u, 1u, 0.00390625f
+};
+#endif
+
+/*
+* @brief  1024 point CFFT instance, output in normal order
+*/
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+const arm_cfft_radix4_instance_f32 arm_cfft_radix4_sR_f32_len1024 = {
+  1024u, 0u, 1u, (float32_t *) twiddleCoef_rad4_1024, (uint16_t *) armBitRevTable_rad4_1024, 1u, 1u, 0.000976562500000000f
+};
+
+/*
+* @brief  1024 point CIFFT instance, output in normal order
+*/
+const arm_cfft_radix4_instance_f32 arm_cifft_radix4_sR_f32_len1024 = {
+  1024u, 1u, 1u, (float32_t *) twiddleCoef_rad4_1024, (uint16_t *) armBitRevTable_rad4_1024, 1u, 1u, 0.000976562500000000f
+};
+#endif
+
+/**
+ * @} end of Radix4_CFFT_CIFFT group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_deinterleave_f32.c
+*
+* Description:	Floating-point complex deinterleaving.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Floating-point interleaved to planar complex conversion.
+ * @param[in]  *pSrc   points to the interleaved input vector
+ * @param[out]  *pDstRe points to the real parts
+ * @param[out]  *pDstIm points to the imaginary parts
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ */
+
+void arm_cmplx_deinterleave_f32(
+  float32_t * pSrc,
+  float32_t * pDstRe,
+  float32_t * pDstIm,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t re0, re1, re2, re3, im0, im1, im2, im3; /* Temporary variables to hold the samples */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Re[i] = A[2 * i], Im[i] = A[2 * i + 1] */
+    re0 = pSrc[0];
+    im0 = pSrc[1];
+    re1 = pSrc[2];
+    im1 = pSrc[3];
+    re2 = pSrc[4];
+    im2 = pSrc[5];
+    re3 = pSrc[6];
+    im3 = pSrc[7];
+
+    pDstRe[0] = re0;
+    pDstRe[1] = re1;
+    pDstRe[2] = re2;
+    pDstRe[3] = re3;
+    pDstIm[0] = im0;
+    pDstIm[1] = im1;
+    pDstIm[2] = im2;
+    pDstIm[3] = im3;
+
+    /* update pointers */
+    pSrc += 8u;
+    pDstRe += 4u;
+    pDstIm += 4u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Re[i] = A[2 * i], Im[i] = A[2 * i + 1] */
+    *pDstRe++ = *pSrc++;
+    *pDstIm++ = *pSrc++;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
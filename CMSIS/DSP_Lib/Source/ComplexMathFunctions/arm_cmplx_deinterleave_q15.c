@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_deinterleave_q15.c
+*
+* Description:	Q15 complex deinterleaving.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Q15 interleaved to planar complex conversion.
+ * @param[in]  *pSrc   points to the interleaved input vector
+ * @param[out]  *pDstRe points to the real parts
+ * @param[out]  *pDstIm points to the imaginary parts
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ */
+
+void arm_cmplx_deinterleave_q15(
+  q15_t * pSrc,
+  q15_t * pDstRe,
+  q15_t * pDstIm,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in1, in2, in3, in4;                      /* Complex samples packed in words */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Re[i] = A[2 * i], Im[i] = A[2 * i + 1], one complex sample per word */
+    in1 = *__SIMD32(pSrc)++;
+    in2 = *__SIMD32(pSrc)++;
+    in3 = *__SIMD32(pSrc)++;
+    in4 = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDstRe)++ = __PKHBT(in1, in2, 16);
+    *__SIMD32(pDstIm)++ = __PKHTB(in2, in1, 16);
+    *__SIMD32(pDstRe)++ = __PKHBT(in3, in4, 16);
+    *__SIMD32(pDstIm)++ = __PKHTB(in4, in3, 16);
+
+#else
+
+    *__SIMD32(pDstRe)++ = __PKHTB(in1, in2, 16);
+    *__SIMD32(pDstIm)++ = __PKHBT(in2, in1, 16);
+    *__SIMD32(pDstRe)++ = __PKHTB(in3, in4, 16);
+    *__SIMD32(pDstIm)++ = __PKHBT(in4, in3, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Re[i] = A[2 * i], Im[i] = A[2 * i + 1] */
+    *pDstRe++ = *pSrc++;
+    *pDstIm++ = *pSrc++;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_interleave_q15.c
+*
+* Description:	Q15 complex interleaving.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Q15 planar to interleaved complex conversion.
+ * @param[in]  *pSrcRe points to the real parts
+ * @param[in]  *pSrcIm points to the imaginary parts
+ * @param[out]  *pDst  points to the interleaved output vector
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ */
+
+void arm_cmplx_interleave_q15(
+  q15_t * pSrcRe,
+  q15_t * pSrcIm,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t inRe, inIm, inRe2, inIm2;                /* Pairs of samples packed in words */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = Re[i], C[2 * i + 1] = Im[i], two samples of each array per word */
+    inRe = *__SIMD32(pSrcRe)++;
+    inIm = *__SIMD32(pSrcIm)++;
+    inRe2 = *__SIMD32(pSrcRe)++;
+    inIm2 = *__SIMD32(pSrcIm)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(inRe, inIm, 16);
+    *__SIMD32(pDst)++ = __PKHTB(inIm, inRe, 16);
+    *__SIMD32(pDst)++ = __PKHBT(inRe2, inIm2, 16);
+    *__SIMD32(pDst)++ = __PKHTB(inIm2, inRe2, 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHTB(inRe, inIm, 16);
+    *__SIMD32(pDst)++ = __PKHBT(inIm, inRe, 16);
+    *__SIMD32(pDst)++ = __PKHTB(inRe2, inIm2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(inIm2, inRe2, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = Re[i], C[2 * i + 1] = Im[i] */
+    *pDst++ = *pSrcRe++;
+    *pDst++ = *pSrcIm++;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_interleave_q31.c
+*
+* Description:	Q31 complex interleaving.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxInterleave
+ * @{
+ */
+
+/**
+ * @brief  Q31 planar to interleaved complex conversion.
+ * @param[in]  *pSrcRe points to the real parts
+ * @param[in]  *pSrcIm points to the imaginary parts
+ * @param[out]  *pDst  points to the interleaved output vector
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ */
+
+void arm_cmplx_interleave_q31(
+  q31_t * pSrcRe,
+  q31_t * pSrcIm,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t re0, re1, re2, re3, im0, im1, im2, im3;  /* Temporary variables to hold the samples */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = Re[i], C[2 * i + 1] = Im[i] */
+    re0 = pSrcRe[0];
+    re1 = pSrcRe[1];
+    re2 = pSrcRe[2];
+    re3 = pSrcRe[3];
+    im0 = pSrcIm[0];
+    im1 = pSrcIm[1];
+    im2 = pSrcIm[2];
+    im3 = pSrcIm[3];
+
+    pDst[0] = re0;
+    pDst[1] = im0;
+    pDst[2] = re1;
+    pDst[3] = im1;
+    pDst[4] = re2;
+    pDst[5] = im2;
+    pDst[6] = re3;
+    pDst[7] = im3;
+
+    /* update pointers */
+    pSrcRe += 4u;
+    pSrcIm += 4u;
+    pDst += 8u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = Re[i], C[2 * i + 1] = Im[i] */
+    *pDst++ = *pSrcRe++;
+    *pDst++ = *pSrcIm++;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxInterleave group
+ */
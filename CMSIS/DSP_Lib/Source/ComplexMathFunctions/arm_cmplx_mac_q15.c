@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mac_q15.c
+*
+* Description:	Q15 complex multiply-accumulate.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMAC
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex multiply-accumulate.
+ * @param[in]  *pSrcA points to the first input vector
+ * @param[in]  *pSrcB points to the second input vector
+ * @param[in,out]  *pAcc  points to the Q31 accumulator vector, in 3.29 format
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.15 by 1.15 multiplications. The sums of the 2.30 products are
+ * converted into 3.29 format and added to the accumulators with saturation.
+ * \par
+ * On Cortex-M3 and Cortex-M4 each complex sample is loaded as one word and the two products
+ * of each output are computed by one dual multiply: <code>__SMUSD</code> for the real part and
+ * <code>__SMUADX</code> for the imaginary part. The sum of the imaginary part is kept in 32 bits,
+ * which overflows only when both inputs are <code>-1 - 1j</code>.
+ */
+
+void arm_cmplx_mac_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q31_t * pAcc,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t inA, inB;                                /* Complex samples packed in words */
+  q31_t re, im;                                  /* Real and imaginary parts */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    re = __SMUSD(inA, inB);
+
+#else
+
+    re = -__SMUSD(inA, inB);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    im = __SMUADX(inA, inB);
+
+    pAcc[0] = __QADD(pAcc[0], re >> 1);
+    pAcc[1] = __QADD(pAcc[1], im >> 1);
+    pAcc += 2u;
+
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    re = __SMUSD(inA, inB);
+
+#else
+
+    re = -__SMUSD(inA, inB);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    im = __SMUADX(inA, inB);
+
+    pAcc[0] = __QADD(pAcc[0], re >> 1);
+    pAcc[1] = __QADD(pAcc[1], im >> 1);
+    pAcc += 2u;
+
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    re = __SMUSD(inA, inB);
+
+#else
+
+    re = -__SMUSD(inA, inB);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    im = __SMUADX(inA, inB);
+
+    pAcc[0] = __QADD(pAcc[0], re >> 1);
+    pAcc[1] = __QADD(pAcc[1], im >> 1);
+    pAcc += 2u;
+
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    re = __SMUSD(inA, inB);
+
+#else
+
+    re = -__SMUSD(inA, inB);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    im = __SMUADX(inA, inB);
+
+    pAcc[0] = __QADD(pAcc[0], re >> 1);
+    pAcc[1] = __QADD(pAcc[1], im >> 1);
+    pAcc += 2u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    re = __SMUSD(inA, inB);
+
+#else
+
+    re = -__SMUSD(inA, inB);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    im = __SMUADX(inA, inB);
+
+    pAcc[0] = __QADD(pAcc[0], re >> 1);
+    pAcc[1] = __QADD(pAcc[1], im >> 1);
+    pAcc += 2u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q15_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
+
+  blkCnt = numSamples;
+
+  while(blkCnt > 0u)
+  {
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    pAcc[0] = clip_q63_to_q31((q63_t) pAcc[0] + ((((q63_t) a * c) - ((q31_t) b * d)) >> 1));
+    pAcc[1] = clip_q63_to_q31((q63_t) pAcc[1] + ((((q63_t) a * d) + ((q31_t) b * c)) >> 1));
+    pAcc += 2u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of CmplxMAC group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mac_q31.c
+*
+* Description:	Q31 complex multiply-accumulate.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxMAC
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex multiply-accumulate.
+ * @param[in]  *pSrcA points to the first input vector
+ * @param[in]  *pSrcB points to the second input vector
+ * @param[in,out]  *pAcc  points to the accumulator vector, in 3.29 format
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are computed in 3.29 format as by arm_cmplx_mult_cmplx_q31(), and added to
+ * the accumulators with saturation.
+ */
+
+void arm_cmplx_mac_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pAcc,
+  uint32_t numSamples)
+{
+  q31_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    pAcc[0] = clip_q63_to_q31((q63_t) pAcc[0] + (((q63_t) a * c) >> 33) - (((q63_t) b * d) >> 33));
+    pAcc[1] = clip_q63_to_q31((q63_t) pAcc[1] + (((q63_t) a * d) >> 33) + (((q63_t) b * c) >> 33));
+    pAcc += 2u;
+
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    pAcc[0] = clip_q63_to_q31((q63_t) pAcc[0] + (((q63_t) a * c) >> 33) - (((q63_t) b * d) >> 33));
+    pAcc[1] = clip_q63_to_q31((q63_t) pAcc[1] + (((q63_t) a * d) >> 33) + (((q63_t) b * c) >> 33));
+    pAcc += 2u;
+
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    pAcc[0] = clip_q63_to_q31((q63_t) pAcc[0] + (((q63_t) a * c) >> 33) - (((q63_t) b * d) >> 33));
+    pAcc[1] = clip_q63_to_q31((q63_t) pAcc[1] + (((q63_t) a * d) >> 33) + (((q63_t) b * c) >> 33));
+    pAcc += 2u;
+
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    pAcc[0] = clip_q63_to_q31((q63_t) pAcc[0] + (((q63_t) a * c) >> 33) - (((q63_t) b * d) >> 33));
+    pAcc[1] = clip_q63_to_q31((q63_t) pAcc[1] + (((q63_t) a * d) >> 33) + (((q63_t) b * c) >> 33));
+    pAcc += 2u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* Acc[2 * i] += A[2 * i] * B[2 * i] - A[2 * i + 1] * B[2 * i + 1].  */
+    /* Acc[2 * i + 1] += A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    pAcc[0] = clip_q63_to_q31((q63_t) pAcc[0] + (((q63_t) a * c) >> 33) - (((q63_t) b * d) >> 33));
+    pAcc[1] = clip_q63_to_q31((q63_t) pAcc[1] + (((q63_t) a * d) >> 33) + (((q63_t) b * c) >> 33));
+    pAcc += 2u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxMAC group
+ */
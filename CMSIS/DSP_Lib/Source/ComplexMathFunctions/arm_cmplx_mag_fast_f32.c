@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_fast_f32.c
+*
+* Description:	Floating-point approximate complex magnitude.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup cmplx_mag_fast Approximate Complex Magnitude
+ *
+ * Computes the magnitude of the elements of a complex data vector to within a bounded
+ * relative error, without square root, for peak picking and detection where only the
+ * relative magnitude matters. The data layout and the output formats are those of
+ * \ref cmplx_mag, and the <code>type</code> argument selects the computation:
+ *
+ * - <code>ARM_CMPLX_MAG_EXACT</code>: calls <code>arm_cmplx_mag_xxx()</code>.
+ * - <code>ARM_CMPLX_MAG_SQUARED</code>: calls <code>arm_cmplx_mag_squared_xxx()</code>,
+ *   in its own output format.
+ * - <code>ARM_CMPLX_MAG_AMBM</code>: alpha max plus beta min, on the absolute values of
+ *   the real and imaginary parts,
+ * <pre>
+ *     pDst[n] = max(max, alpha * max + beta * min)   alpha = 0.898204193, beta = 0.485968200
+ * </pre>
+ *   The relative error is within +/-2.13%, plus 1 LSB of the output for the fixed-point
+ *   functions, whose products are truncated.
+ * - <code>ARM_CMPLX_MAG_NEWTON</code>: one Newton-Raphson step of the square root of the
+ *   squared magnitude from the alpha max plus beta min estimate,
+ * <pre>
+ *     pDst[n] = (y0 + (pSrc[(2*n)+0]^2 + pSrc[(2*n)+1]^2) / y0) / 2
+ * </pre>
+ *   The floating-point result never underestimates the magnitude and its relative error is
+ *   below 0.024%. The fixed-point functions use 32-bit divisions: their error is within
+ *   +0.03% and 1 LSB of the output.
+ *
+ * On Cortex-M4 with FPU the square root of <code>arm_cmplx_mag_f32()</code> takes the time
+ * of a division, so <code>ARM_CMPLX_MAG_NEWTON</code> brings no gain for the
+ * floating-point data type; <code>ARM_CMPLX_MAG_AMBM</code> still saves the squares and the
+ * square root.
+ *
+ * There are separate functions for floating-point, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup cmplx_mag_fast
+ * @{
+ */
+
+/**
+ * @brief Floating-point approximate complex magnitude.
+ * @param[in]       *pSrc points to complex input buffer
+ * @param[out]      *pDst points to real output buffer
+ * @param[in]       numSamples number of complex samples in the input vector
+ * @param[in]       type computation of the magnitude
+ * @return none.
+ */
+
+void arm_cmplx_mag_fast_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples,
+  arm_cmplx_mag_type type)
+{
+  float32_t re, im, mx, mn, y0;                  /* Temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(type == ARM_CMPLX_MAG_EXACT)
+  {
+    arm_cmplx_mag_f32(pSrc, pDst, numSamples);
+    return;
+  }
+  if(type == ARM_CMPLX_MAG_SQUARED)
+  {
+    arm_cmplx_mag_squared_f32(pSrc, pDst, numSamples);
+    return;
+  }
+
+  blkCnt = numSamples;
+
+  while(blkCnt > 0u)
+  {
+    re = *pSrc++;
+    im = *pSrc++;
+
+    /* absolute values sorted into max and min */
+    re = (re < 0.0f) ? -re : re;
+    im = (im < 0.0f) ? -im : im;
+    mx = (re > im) ? re : im;
+    mn = (re > im) ? im : re;
+
+    /* alpha max plus beta min, max alone for a small min */
+    y0 = 0.898204193f * mx + 0.485968200f * mn;
+    y0 = (y0 > mx) ? y0 : mx;
+
+    if((type == ARM_CMPLX_MAG_NEWTON) && (y0 > 0.0f))
+    {
+      /* y1 = (y0 + m^2 / y0) / 2 */
+      y0 = 0.5f * (y0 + ((re * re) + (im * im)) / y0);
+    }
+
+    *pDst++ = y0;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_fast group
+ */
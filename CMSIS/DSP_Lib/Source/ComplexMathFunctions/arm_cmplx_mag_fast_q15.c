@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_fast_q15.c
+*
+* Description:	Q15 approximate complex magnitude.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_fast
+ * @{
+ */
+
+/**
+ * @brief  Q15 approximate complex magnitude.
+ * @param  *pSrc points to the complex input vector
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples in the input vector
+ * @param  type computation of the magnitude
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 2.14 format, as for <code>arm_cmplx_mag_q15()</code>, or in 3.13 format
+ * for <code>ARM_CMPLX_MAG_SQUARED</code>. The alpha and beta coefficients are in 1.15 format
+ * and the estimate is computed in 2.30 format. The absolute value of -1 is saturated to
+ * <code>0x7FFF</code>.
+ * \par
+ * On Cortex-M3 and Cortex-M4 the absolute values are packed in a word: the two weightings
+ * alpha max plus beta min and alpha min plus beta max are computed by <code>__SMUAD</code>
+ * and <code>__SMUADX</code>, the larger being the first one. The squared magnitude of the
+ * Newton step is one <code>__SMUAD</code> on the input word, and its division by the estimate
+ * is a 32-bit one.
+ */
+
+void arm_cmplx_mag_fast_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples,
+  arm_cmplx_mag_type type)
+{
+  q31_t re, im;                                  /* Absolute values of the input */
+  q31_t est, tmp;                                /* Estimates in 2.30 format */
+  uint32_t y0, sq;                               /* Estimate in 1.15 format, squared magnitude in 2.30 format */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+#ifndef ARM_MATH_CM0
+  q31_t in;                                      /* Packed input sample */
+  q31_t coef = (q31_t) 0x3E3472F8;               /* beta : alpha in 1.15 format */
+#endif
+
+  if(type == ARM_CMPLX_MAG_EXACT)
+  {
+    arm_cmplx_mag_q15(pSrc, pDst, numSamples);
+    return;
+  }
+  if(type == ARM_CMPLX_MAG_SQUARED)
+  {
+    arm_cmplx_mag_squared_q15(pSrc, pDst, numSamples);
+    return;
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrc)++;
+
+    /* saturated absolute values, packed back in a word */
+    re = (q15_t) in;
+    im = in >> 16;
+    re = (re > 0) ? re : __SSAT(-re, 16);
+    im = (im > 0) ? im : __SSAT(-im, 16);
+
+    /* alpha max plus beta min is the larger of the two weightings */
+    tmp = __PKHBT(re, im, 16);
+    est = __SMUAD(tmp, coef);
+    tmp = __SMUADX(tmp, coef);
+    est = (est > tmp) ? est : tmp;
+
+    /* max alone for a small min */
+    tmp = ((re > im) ? re : im) << 15;
+    est = (est > tmp) ? est : tmp;
+
+    if(type == ARM_CMPLX_MAG_NEWTON)
+    {
+      /* y1 = (y0 + m^2 / y0) / 2, m^2 of -1 - j being 2.0 as an unsigned value */
+      y0 = (uint32_t) est >> 15;
+      sq = (uint32_t) __SMUAD(in, in);
+      *pDst++ = (y0 != 0u) ? (q15_t) ((y0 + (sq / y0)) >> 2) : 0;
+    }
+    else
+    {
+      *pDst++ = (q15_t) (est >> 16);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  while(blkCnt > 0u)
+  {
+    re = *pSrc++;
+    im = *pSrc++;
+
+    sq = (uint32_t) (re * re) + (uint32_t) (im * im);
+
+    re = (re > 0) ? re : __SSAT(-re, 16);
+    im = (im > 0) ? im : __SSAT(-im, 16);
+
+    if(re > im)
+    {
+      est = (re * 29432) + (im * 15924);
+      tmp = re << 15;
+    }
+    else
+    {
+      est = (im * 29432) + (re * 15924);
+      tmp = im << 15;
+    }
+    est = (est > tmp) ? est : tmp;
+
+    if(type == ARM_CMPLX_MAG_NEWTON)
+    {
+      y0 = (uint32_t) est >> 15;
+      *pDst++ = (y0 != 0u) ? (q15_t) ((y0 + (sq / y0)) >> 2) : 0;
+    }
+    else
+    {
+      *pDst++ = (q15_t) (est >> 16);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of cmplx_mag_fast group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mag_fast_q31.c
+*
+* Description:	Q31 approximate complex magnitude.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup cmplx_mag_fast
+ * @{
+ */
+
+/**
+ * @brief  Q31 approximate complex magnitude.
+ * @param  *pSrc points to the complex input vector
+ * @param  *pDst points to the real output vector
+ * @param  numSamples number of complex samples in the input vector
+ * @param  type computation of the magnitude
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is in 2.30 format, as for <code>arm_cmplx_mag_q31()</code>, or in 3.29 format
+ * for <code>ARM_CMPLX_MAG_SQUARED</code>. The alpha and beta coefficients are in 1.31 format
+ * and their 2.62 products are truncated to 2.30 format. The absolute value of -1 is saturated
+ * to <code>0x7FFFFFFF</code>.
+ * \par
+ * The Newton step avoids a 64-bit division: the estimate is normalized to [0.5 1) and the
+ * squared magnitude scaled alike, then the 32 most significant bits of the squared magnitude
+ * are divided by the 16 most significant bits of the estimate.
+ */
+
+void arm_cmplx_mag_fast_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t numSamples,
+  arm_cmplx_mag_type type)
+{
+  q31_t re, im, mx, mn;                          /* Input and absolute values */
+  q31_t est, tmp;                                /* Estimates in 2.30 format */
+  uint64_t sq;                                   /* Squared magnitude in 4.60 format */
+  uint32_t y0, q, shift;                         /* Normalized estimate, quotient and normalization */
+  uint32_t blkCnt = numSamples;                  /* loop counter */
+
+  if(type == ARM_CMPLX_MAG_EXACT)
+  {
+    arm_cmplx_mag_q31(pSrc, pDst, numSamples);
+    return;
+  }
+  if(type == ARM_CMPLX_MAG_SQUARED)
+  {
+    arm_cmplx_mag_squared_q31(pSrc, pDst, numSamples);
+    return;
+  }
+
+  while(blkCnt > 0u)
+  {
+    re = *pSrc++;
+    im = *pSrc++;
+
+    /* saturated absolute values sorted into max and min */
+    re = (re > 0) ? re : ((re == 0x80000000) ? 0x7FFFFFFF : -re);
+    im = (im > 0) ? im : ((im == 0x80000000) ? 0x7FFFFFFF : -im);
+    mx = (re > im) ? re : im;
+    mn = (re > im) ? im : re;
+
+    /* alpha max plus beta min, max alone for a small min */
+    est = (q31_t) ((((q63_t) mx * 0x72F85AE2) + ((q63_t) mn * 0x3E3434BB)) >> 32);
+    tmp = mx >> 1;
+    est = (est > tmp) ? est : tmp;
+
+    if((type == ARM_CMPLX_MAG_NEWTON) && (est != 0))
+    {
+      /* y1 = (y0 + m^2 / y0) / 2 with y0 normalized to bit 30 */
+      sq = (((uint64_t) ((q63_t) re * re)) + ((uint64_t) ((q63_t) im * im))) >> 2;
+      shift = __CLZ(est) - 1u;
+      y0 = (uint32_t) est << shift;
+      q = (uint32_t) ((sq << (2u * shift)) >> 32) / (y0 >> 16);
+      est = (q31_t) (((y0 >> 1) + (q << 15)) >> shift);
+    }
+
+    *pDst++ = est;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of cmplx_mag_fast group
+ */
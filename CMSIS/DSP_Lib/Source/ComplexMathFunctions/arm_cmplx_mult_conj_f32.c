@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mult_conj_f32.c
+*
+* Description:	Floating-point complex-by-complex conjugate multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup CmplxConjMult Complex-by-Complex Conjugate Multiplication
+ *
+ * Multiplies a complex vector by the complex conjugate of another complex vector,
+ * the product used by cross-correlation and cross-spectra in the frequency domain,
+ * without a separate conjugation pass.
+ *
+ * The data in the input arrays is stored in an interleaved fashion
+ * (real, imag, real, imag, ...).
+ * The parameter <code>numSamples</code> represents the number of complex
+ * samples processed.  The complex arrays have a total of <code>2*numSamples</code>
+ * real values.
+ *
+ * The underlying algorithm is used:
+ *
+ * <pre>
+ * for(n=0; n<numSamples; n++) {
+ *     pDst[(2*n)+0] = pSrcA[(2*n)+0] * pSrcB[(2*n)+0] + pSrcA[(2*n)+1] * pSrcB[(2*n)+1];
+ *     pDst[(2*n)+1] = pSrcA[(2*n)+1] * pSrcB[(2*n)+0] - pSrcA[(2*n)+0] * pSrcB[(2*n)+1];
+ * }
+ * </pre>
+ *
+ * There are separate functions for floating-point, Q15, and Q31 data types.
+ */
+
+/**
+ * @addtogroup CmplxConjMult
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex-by-complex conjugate multiplication.
+ * @param[in]  *pSrcA points to the first input vector
+ * @param[in]  *pSrcB points to the second input vector, conjugated
+ * @param[out]  *pDst  points to the output vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ */
+
+void arm_cmplx_mult_conj_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t a, b, c, d;                          /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t a1, b1, c1, d1;                      /* Temporary variables to store real and imaginary values */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = pSrcA[0];
+    b = pSrcA[1];
+    c = pSrcB[0];
+    d = pSrcB[1];
+    a1 = pSrcA[2];
+    b1 = pSrcA[3];
+    c1 = pSrcB[2];
+    d1 = pSrcB[3];
+
+    pDst[0] = (a * c) + (b * d);
+    pDst[1] = (b * c) - (a * d);
+    pDst[2] = (a1 * c1) + (b1 * d1);
+    pDst[3] = (b1 * c1) - (a1 * d1);
+
+    a = pSrcA[4];
+    b = pSrcA[5];
+    c = pSrcB[4];
+    d = pSrcB[5];
+    a1 = pSrcA[6];
+    b1 = pSrcA[7];
+    c1 = pSrcB[6];
+    d1 = pSrcB[7];
+
+    pDst[4] = (a * c) + (b * d);
+    pDst[5] = (b * c) - (a * d);
+    pDst[6] = (a1 * c1) + (b1 * d1);
+    pDst[7] = (b1 * c1) - (a1 * d1);
+
+    /* update pointers */
+    pSrcA += 8u;
+    pSrcB += 8u;
+    pDst += 8u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* store the result in the destination buffer. */
+    *pDst++ = (a * c) + (b * d);
+    *pDst++ = (b * c) - (a * d);
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxConjMult group
+ */
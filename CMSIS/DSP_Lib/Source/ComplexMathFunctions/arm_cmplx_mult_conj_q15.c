@@ -0,0 +1,227 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mult_conj_q15.c
+*
+* Description:	Q15 complex-by-complex conjugate multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxConjMult
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex-by-complex conjugate multiplication.
+ * @param[in]  *pSrcA points to the first input vector
+ * @param[in]  *pSrcB points to the second input vector, conjugated
+ * @param[out]  *pDst  points to the output vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.15 by 1.15 multiplications and finally output is converted into 3.13 format,
+ * as by arm_cmplx_mult_cmplx_q15().
+ * \par
+ * On Cortex-M3 and Cortex-M4 each complex sample is loaded as one word and the two products
+ * of each output are computed by one dual multiply: <code>__SMUAD</code> for the real part and
+ * <code>__SMUSDX</code> for the imaginary part. The sum of the real part is kept in 32 bits,
+ * which overflows only when both inputs are <code>-1 - 1j</code>.
+ */
+
+void arm_cmplx_mult_conj_q15(
+  q15_t * pSrcA,
+  q15_t * pSrcB,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t inA, inB;                                /* Complex samples packed in words */
+  q31_t re, im;                                  /* Real and imaginary parts */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    re = __SMUAD(inA, inB) >> 17;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    im = __SMUSDX(inB, inA) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(re, im, 16);
+
+#else
+
+    im = __SMUSDX(inA, inB) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(im, re, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    re = __SMUAD(inA, inB) >> 17;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    im = __SMUSDX(inB, inA) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(re, im, 16);
+
+#else
+
+    im = __SMUSDX(inA, inB) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(im, re, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    re = __SMUAD(inA, inB) >> 17;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    im = __SMUSDX(inB, inA) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(re, im, 16);
+
+#else
+
+    im = __SMUSDX(inA, inB) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(im, re, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    re = __SMUAD(inA, inB) >> 17;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    im = __SMUSDX(inB, inA) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(re, im, 16);
+
+#else
+
+    im = __SMUSDX(inA, inB) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(im, re, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    inA = *__SIMD32(pSrcA)++;
+    inB = *__SIMD32(pSrcB)++;
+
+    re = __SMUAD(inA, inB) >> 17;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    im = __SMUSDX(inB, inA) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(re, im, 16);
+
+#else
+
+    im = __SMUSDX(inA, inB) >> 17;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *__SIMD32(pDst)++ = __PKHBT(im, re, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q15_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
+
+  blkCnt = numSamples;
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* store the results in 3.13 format in the destination buffer. */
+    *pDst++ = (q15_t) ((((q31_t) a * c) >> 17) + (((q31_t) b * d) >> 17));
+    *pDst++ = (q15_t) ((((q31_t) b * c) >> 17) - (((q31_t) a * d) >> 17));
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of CmplxConjMult group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_mult_conj_q31.c
+*
+* Description:	Q31 complex-by-complex conjugate multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxConjMult
+ * @{
+ */
+
+/**
+ * @brief  Q31 complex-by-complex conjugate multiplication.
+ * @param[in]  *pSrcA points to the first input vector
+ * @param[in]  *pSrcB points to the second input vector, conjugated
+ * @param[out]  *pDst  points to the output vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function implements 1.31 by 1.31 multiplications and finally output is converted into 3.29 format,
+ * as by arm_cmplx_mult_cmplx_q31(). Input down scaling is not required.
+ */
+
+void arm_cmplx_mult_conj_q31(
+  q31_t * pSrcA,
+  q31_t * pSrcB,
+  q31_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t a, b, c, d;                              /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* store the results in 3.29 format in the destination buffer. */
+    *pDst++ = (q31_t) (((q63_t) a * c) >> 33) + (q31_t) (((q63_t) b * d) >> 33);
+    *pDst++ = (q31_t) (((q63_t) b * c) >> 33) - (q31_t) (((q63_t) a * d) >> 33);
+
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* store the results in 3.29 format in the destination buffer. */
+    *pDst++ = (q31_t) (((q63_t) a * c) >> 33) + (q31_t) (((q63_t) b * d) >> 33);
+    *pDst++ = (q31_t) (((q63_t) b * c) >> 33) - (q31_t) (((q63_t) a * d) >> 33);
+
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* store the results in 3.29 format in the destination buffer. */
+    *pDst++ = (q31_t) (((q63_t) a * c) >> 33) + (q31_t) (((q63_t) b * d) >> 33);
+    *pDst++ = (q31_t) (((q63_t) b * c) >> 33) - (q31_t) (((q63_t) a * d) >> 33);
+
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* store the results in 3.29 format in the destination buffer. */
+    *pDst++ = (q31_t) (((q63_t) a * c) >> 33) + (q31_t) (((q63_t) b * d) >> 33);
+    *pDst++ = (q31_t) (((q63_t) b * c) >> 33) - (q31_t) (((q63_t) a * d) >> 33);
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C[2 * i] = A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[2 * i] - A[2 * i] * B[2 * i + 1].  */
+    a = *pSrcA++;
+    b = *pSrcA++;
+    c = *pSrcB++;
+    d = *pSrcB++;
+
+    /* store the results in 3.29 format in the destination buffer. */
+    *pDst++ = (q31_t) (((q63_t) a * c) >> 33) + (q31_t) (((q63_t) b * d) >> 33);
+    *pDst++ = (q31_t) (((q63_t) b * c) >> 33) - (q31_t) (((q63_t) a * d) >> 33);
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxConjMult group
+ */
@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_nco_init_f32.c
+*
+* Description:	Floating-point recursive oscillator initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxNCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point recursive oscillator.
+ * @param[in,out] *S    points to an instance of the floating-point oscillator structure.
+ * @param[in]  omega    frequency in radians per sample, in the range [-pi pi]
+ * @param[in]  phase    initial phase in radians
+ * @return none.
+ */
+
+void arm_cmplx_nco_init_f32(
+  arm_cmplx_nco_instance_f32 * S,
+  float32_t omega,
+  float32_t phase)
+{
+  /* Initial value of the oscillator, e^(j*phase) */
+  S->oscRe = arm_cos_f32(phase);
+  S->oscIm = arm_sin_f32(phase);
+
+  /* Rotation per sample, e^(j*omega) */
+  S->stepRe = arm_cos_f32(omega);
+  S->stepIm = arm_sin_f32(omega);
+}
+
+/**
+ * @} end of CmplxNCO group
+ */
@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_nco_init_q15.c
+*
+* Description:	Q15 recursive oscillator initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxNCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 recursive oscillator.
+ * @param[in,out] *S    points to an instance of the Q15 oscillator structure.
+ * @param[in]  omega    frequency in the range [-1 0.9999] mapping to [-pi pi) radians per sample
+ * @param[in]  phase    initial phase in the range [-1 0.9999] mapping to [-pi pi)
+ * @return none.
+ *
+ * \par
+ * The angles are in the format of arm_cordic_sin_cos_q31(), which computes the rotation per
+ * sample to about 2<sup>-27</sup>, so that the frequency error does not accumulate into a
+ * phase drift visible in 1.15 format over long blocks.
+ */
+
+void arm_cmplx_nco_init_q15(
+  arm_cmplx_nco_instance_q15 * S,
+  q31_t omega,
+  q31_t phase)
+{
+  q31_t sinVal, cosVal;                          /* Sine and cosine */
+
+  /* Initial value of the oscillator, (1 - 2^-15) * e^(j*phase) */
+  arm_cordic_sin_cos_q31(phase, &sinVal, &cosVal);
+  S->oscRe = (q31_t) (((q63_t) cosVal * 0x7FFF0000) >> 31);
+  S->oscIm = (q31_t) (((q63_t) sinVal * 0x7FFF0000) >> 31);
+
+  /* Rotation per sample, e^(j*omega) */
+  arm_cordic_sin_cos_q31(omega, &S->stepIm, &S->stepRe);
+}
+
+/**
+ * @} end of CmplxNCO group
+ */
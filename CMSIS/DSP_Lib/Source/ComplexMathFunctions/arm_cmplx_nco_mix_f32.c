@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_nco_mix_f32.c
+*
+* Description:	Floating-point complex mixing by a recursive oscillator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @defgroup CmplxNCO Complex Mixing by a Numerically Controlled Oscillator
+ *
+ * Multiplies a complex signal by the complex exponential <code>e<sup>j(w*n+phi)</sup></code>,
+ * to shift its spectrum by <code>w</code> radians per sample, for example to bring a
+ * channel to baseband with a negative <code>w</code>:
+ *
+ * <pre>
+ *     y[n] = x[n] * e<sup>j(w*n+phi)</sup>
+ * </pre>
+ *
+ * The exponential is produced by a recursive oscillator, one complex multiplication by
+ * <code>e<sup>jw</sup></code> per sample, instead of a sine and a cosine per sample. The
+ * rounding errors of the recursion slowly change the magnitude of the oscillator, which is
+ * renormalized to 1 at the end of each block by a first-order Newton step, so that the
+ * magnitude error remains of the order of the block size times the rounding error. The
+ * phase is continuous from one block to the next.
+ *
+ * \par
+ * The data in the arrays is stored in an interleaved fashion
+ * (real, imag, real, imag, ...). The instance holds the oscillator and the rotation per
+ * sample, and is initialized by the init function.
+ */
+
+/**
+ * @addtogroup CmplxNCO
+ * @{
+ */
+
+/**
+ * @brief  Floating-point complex mixing by a recursive oscillator.
+ * @param[in,out] *S    points to an instance of the floating-point oscillator structure.
+ * @param[in]  *pSrc    points to the complex input vector
+ * @param[out]  *pDst   points to the complex output vector
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ *
+ * \par
+ * With single precision, blocks of up to a few thousand samples keep the magnitude of the
+ * oscillator within 1e-5 of 1 before the renormalization. The rounding of
+ * <code>e<sup>jw</sup></code> to single precision is a frequency error of the order of
+ * 1e-8 radians per sample, which accumulates in the phase: about 5e-4 radians after
+ * 50000 samples. The oscillator can be restarted by arm_cmplx_nco_init_f32() with the
+ * phase <code>w*n+phi</code> when the absolute phase matters over long signals.
+ */
+
+void arm_cmplx_nco_mix_f32(
+  arm_cmplx_nco_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t oscRe = S->oscRe;                    /* Real part of the oscillator */
+  float32_t oscIm = S->oscIm;                    /* Imaginary part of the oscillator */
+  float32_t stepRe = S->stepRe;                  /* Real part of the rotation per sample */
+  float32_t stepIm = S->stepIm;                  /* Imaginary part of the rotation per sample */
+  float32_t xRe, xIm, tmp;                       /* Input sample and temporary variable */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* y[n] = x[n] * osc, osc = osc * e^(jw) */
+    xRe = *pSrc++;
+    xIm = *pSrc++;
+    *pDst++ = (xRe * oscRe) - (xIm * oscIm);
+    *pDst++ = (xRe * oscIm) + (xIm * oscRe);
+
+    tmp = (oscRe * stepRe) - (oscIm * stepIm);
+    oscIm = (oscRe * stepIm) + (oscIm * stepRe);
+    oscRe = tmp;
+
+    /* y[n] = x[n] * osc, osc = osc * e^(jw) */
+    xRe = *pSrc++;
+    xIm = *pSrc++;
+    *pDst++ = (xRe * oscRe) - (xIm * oscIm);
+    *pDst++ = (xRe * oscIm) + (xIm * oscRe);
+
+    tmp = (oscRe * stepRe) - (oscIm * stepIm);
+    oscIm = (oscRe * stepIm) + (oscIm * stepRe);
+    oscRe = tmp;
+
+    /* y[n] = x[n] * osc, osc = osc * e^(jw) */
+    xRe = *pSrc++;
+    xIm = *pSrc++;
+    *pDst++ = (xRe * oscRe) - (xIm * oscIm);
+    *pDst++ = (xRe * oscIm) + (xIm * oscRe);
+
+    tmp = (oscRe * stepRe) - (oscIm * stepIm);
+    oscIm = (oscRe * stepIm) + (oscIm * stepRe);
+    oscRe = tmp;
+
+    /* y[n] = x[n] * osc, osc = osc * e^(jw) */
+    xRe = *pSrc++;
+    xIm = *pSrc++;
+    *pDst++ = (xRe * oscRe) - (xIm * oscIm);
+    *pDst++ = (xRe * oscIm) + (xIm * oscRe);
+
+    tmp = (oscRe * stepRe) - (oscIm * stepIm);
+    oscIm = (oscRe * stepIm) + (oscIm * stepRe);
+    oscRe = tmp;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* y[n] = x[n] * osc, osc = osc * e^(jw) */
+    xRe = *pSrc++;
+    xIm = *pSrc++;
+    *pDst++ = (xRe * oscRe) - (xIm * oscIm);
+    *pDst++ = (xRe * oscIm) + (xIm * oscRe);
+
+    tmp = (oscRe * stepRe) - (oscIm * stepIm);
+    oscIm = (oscRe * stepIm) + (oscIm * stepRe);
+    oscRe = tmp;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* Renormalize the oscillator: g = (3 - |osc|^2) / 2 is a Newton step towards 1 / |osc| */
+  tmp = 1.5f - (0.5f * ((oscRe * oscRe) + (oscIm * oscIm)));
+  S->oscRe = oscRe * tmp;
+  S->oscIm = oscIm * tmp;
+}
+
+/**
+ * @} end of CmplxNCO group
+ */
@@ -0,0 +1,259 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cmplx_nco_mix_q15.c
+*
+* Description:	Q15 complex mixing by a recursive oscillator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxNCO
+ * @{
+ */
+
+/**
+ * @brief  Q15 complex mixing by a recursive oscillator.
+ * @param[in,out] *S    points to an instance of the Q15 oscillator structure.
+ * @param[in]  *pSrc    points to the complex input vector
+ * @param[out]  *pDst   points to the complex output vector
+ * @param[in]  numSamples number of complex samples
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The oscillator is computed in 1.31 format with a magnitude of <code>1 - 2<sup>-15</sup></code>,
+ * and its 16 most significant bits multiply the 1.15 input. The 2.30 products are shifted to
+ * 1.15 format with saturation, as the magnitude of the output is that of the input, and its
+ * components may exceed 1 for inputs outside of the unit circle.
+ * \par
+ * On Cortex-M3 and Cortex-M4 each complex sample and the oscillator are packed in words, and
+ * the real and imaginary parts of each output are each computed by one dual multiply,
+ * <code>__SMUSD</code> and <code>__SMUADX</code>.
+ */
+
+void arm_cmplx_nco_mix_q15(
+  arm_cmplx_nco_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t numSamples)
+{
+  q31_t oscRe = S->oscRe;                        /* Real part of the oscillator */
+  q31_t oscIm = S->oscIm;                        /* Imaginary part of the oscillator */
+  q31_t stepRe = S->stepRe;                      /* Real part of the rotation per sample */
+  q31_t stepIm = S->stepIm;                      /* Imaginary part of the rotation per sample */
+  q31_t re, im, tmp;                             /* Output and temporary variables */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in, osc;                                 /* Input sample and oscillator packed in words */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* y[n] = x[n] * osc */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    osc = __PKHTB(oscIm, oscRe, 16);
+    re = __SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(re >> 15, 16), __SSAT(im >> 15, 16), 16);
+
+#else
+
+    osc = __PKHTB(oscRe, oscIm, 16);
+    re = -__SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(im >> 15, 16), __SSAT(re >> 15, 16), 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* osc = osc * e^(jw) */
+    tmp = (q31_t) ((((q63_t) oscRe * stepRe) - ((q63_t) oscIm * stepIm)) >> 31);
+    oscIm = (q31_t) ((((q63_t) oscRe * stepIm) + ((q63_t) oscIm * stepRe)) >> 31);
+    oscRe = tmp;
+
+    /* y[n] = x[n] * osc */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    osc = __PKHTB(oscIm, oscRe, 16);
+    re = __SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(re >> 15, 16), __SSAT(im >> 15, 16), 16);
+
+#else
+
+    osc = __PKHTB(oscRe, oscIm, 16);
+    re = -__SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(im >> 15, 16), __SSAT(re >> 15, 16), 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* osc = osc * e^(jw) */
+    tmp = (q31_t) ((((q63_t) oscRe * stepRe) - ((q63_t) oscIm * stepIm)) >> 31);
+    oscIm = (q31_t) ((((q63_t) oscRe * stepIm) + ((q63_t) oscIm * stepRe)) >> 31);
+    oscRe = tmp;
+
+    /* y[n] = x[n] * osc */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    osc = __PKHTB(oscIm, oscRe, 16);
+    re = __SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(re >> 15, 16), __SSAT(im >> 15, 16), 16);
+
+#else
+
+    osc = __PKHTB(oscRe, oscIm, 16);
+    re = -__SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(im >> 15, 16), __SSAT(re >> 15, 16), 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* osc = osc * e^(jw) */
+    tmp = (q31_t) ((((q63_t) oscRe * stepRe) - ((q63_t) oscIm * stepIm)) >> 31);
+    oscIm = (q31_t) ((((q63_t) oscRe * stepIm) + ((q63_t) oscIm * stepRe)) >> 31);
+    oscRe = tmp;
+
+    /* y[n] = x[n] * osc */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    osc = __PKHTB(oscIm, oscRe, 16);
+    re = __SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(re >> 15, 16), __SSAT(im >> 15, 16), 16);
+
+#else
+
+    osc = __PKHTB(oscRe, oscIm, 16);
+    re = -__SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(im >> 15, 16), __SSAT(re >> 15, 16), 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* osc = osc * e^(jw) */
+    tmp = (q31_t) ((((q63_t) oscRe * stepRe) - ((q63_t) oscIm * stepIm)) >> 31);
+    oscIm = (q31_t) ((((q63_t) oscRe * stepIm) + ((q63_t) oscIm * stepRe)) >> 31);
+    oscRe = tmp;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    /* y[n] = x[n] * osc */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    osc = __PKHTB(oscIm, oscRe, 16);
+    re = __SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(re >> 15, 16), __SSAT(im >> 15, 16), 16);
+
+#else
+
+    osc = __PKHTB(oscRe, oscIm, 16);
+    re = -__SMUSD(in, osc);
+    im = __SMUADX(in, osc);
+
+    *__SIMD32(pDst)++ = __PKHBT(__SSAT(im >> 15, 16), __SSAT(re >> 15, 16), 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* osc = osc * e^(jw) */
+    tmp = (q31_t) ((((q63_t) oscRe * stepRe) - ((q63_t) oscIm * stepIm)) >> 31);
+    oscIm = (q31_t) ((((q63_t) oscRe * stepIm) + ((q63_t) oscIm * stepRe)) >> 31);
+    oscRe = tmp;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q31_t xRe, xIm, oRe, oIm;                      /* Input sample and oscillator in 1.15 format */
+
+  blkCnt = numSamples;
+
+  while(blkCnt > 0u)
+  {
+    /* y[n] = x[n] * osc */
+    xRe = *pSrc++;
+    xIm = *pSrc++;
+    oRe = oscRe >> 16;
+    oIm = oscIm >> 16;
+
+    re = (xRe * oRe) - (xIm * oIm);
+    im = (xRe * oIm) + (xIm * oRe);
+
+    *pDst++ = (q15_t) __SSAT(re >> 15, 16);
+    *pDst++ = (q15_t) __SSAT(im >> 15, 16);
+
+    /* osc = osc * e^(jw) */
+    tmp = (q31_t) ((((q63_t) oscRe * stepRe) - ((q63_t) oscIm * stepIm)) >> 31);
+    oscIm = (q31_t) ((((q63_t) oscRe * stepIm) + ((q63_t) oscIm * stepRe)) >> 31);
+    oscRe = tmp;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* Renormalize the oscillator to its magnitude A = 1 - 2^-15: the correction
+   * (A^2 - |osc|^2) / 2 is a Newton step, A^2 being 0x7FFE0002 in 1.31 format */
+  tmp = (q31_t) ((((q63_t) oscRe * oscRe) + ((q63_t) oscIm * oscIm)) >> 31);
+  tmp = (0x7FFE0002 - tmp) >> 1;
+  S->oscRe = oscRe + (q31_t) (((q63_t) oscRe * tmp) >> 31);
+  S->oscIm = oscIm + (q31_t) (((q63_t) oscIm * tmp) >> 31);
+}
+
+/**
+ * @} end of CmplxNCO group
+ */
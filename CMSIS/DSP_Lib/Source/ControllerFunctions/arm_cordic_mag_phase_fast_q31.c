@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cordic_mag_phase_fast_q31.c
+*
+* Description:	Q31 CORDIC magnitude and phase with a given number of iterations.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 CORDIC magnitude and phase with a given number of iterations.
+ * @param[in]  x        real part, or abscissa, in 1.31 format
+ * @param[in]  y        imaginary part, or ordinate, in 1.31 format
+ * @param[in]  numIter  number of iterations, between 1 and 31
+ * @param[out] *pMag    points to the magnitude output, in 2.30 format.
+ * @param[out] *pPhase  points to the phase output, in the range [-1 0.9999] mapping to [-pi pi).
+ * @return none.
+ *
+ * \par
+ * The input is first normalized by the number of redundant sign bits common to
+ * <code>x</code> and <code>y</code>, so that small vectors keep the full phase accuracy,
+ * and scaled to 3.29 format so that the gain, up to 1.65, cannot overflow. A point of the
+ * left half-plane is rotated by pi, and the iterations rotate the vector onto the positive
+ * x-axis, accumulating the phase. The phase of pi saturates to 0x7FFFFFFF, and the
+ * magnitude and the phase of the origin are zero.
+ */
+
+void arm_cordic_mag_phase_fast_q31(
+  q31_t x,
+  q31_t y,
+  uint32_t numIter,
+  q31_t * pMag,
+  q31_t * pPhase)
+{
+  const q31_t *pAtan = armCordicAtanTableQ31;    /* Arctangents of 2^-i */
+  q31_t xi, yi, xs;                              /* Vector */
+  q63_t z = 0;                                   /* Accumulated phase */
+  uint32_t absx, absy;                           /* Absolute values of the input */
+  uint32_t norm = 0u;                            /* Normalization shift */
+  uint32_t i;                                    /* loop counter */
+
+  if(numIter > ARM_CORDIC_MAX_ITER)
+  {
+    numIter = ARM_CORDIC_MAX_ITER;
+  }
+  else if(numIter == 0u)
+  {
+    numIter = 1u;
+  }
+
+  if((x == 0) && (y == 0))
+  {
+    *pMag = 0;
+    *pPhase = 0;
+    return;
+  }
+
+  /* Normalize by the redundant sign bits of the larger component */
+  absx = (x < 0) ? (0u - (uint32_t) x) : (uint32_t) x;
+  absy = (y < 0) ? (0u - (uint32_t) y) : (uint32_t) y;
+  i = __CLZ((q31_t) (absx | absy));
+
+  if(i > 0u)
+  {
+    norm = i - 1u;
+  }
+
+  /* Scale to 3.29 format */
+  xi = (q31_t) ((uint32_t) x << norm) >> 2;
+  yi = (q31_t) ((uint32_t) y << norm) >> 2;
+
+  /* Rotate the left half-plane by pi */
+  if(xi < 0)
+  {
+    xi = -xi;
+    yi = -yi;
+    z = (y >= 0) ? 0x80000000LL : -0x80000000LL;
+  }
+
+  for (i = 0u; i < numIter; i++)
+  {
+    xs = xi;
+
+    if(yi > 0)
+    {
+      xi += yi >> i;
+      yi -= xs >> i;
+      z += pAtan[i];
+    }
+    else
+    {
+      xi -= yi >> i;
+      yi += xs >> i;
+      z -= pAtan[i];
+    }
+  }
+
+  /* Compensate the gain and the normalization: |v| / 4 in 1.31 format is |v| in 2.30 format */
+  *pMag = (q31_t) (((q63_t) xi * armCordicInvGainTableQ31[numIter - 1u]) >> (30u + norm));
+
+  *pPhase = clip_q63_to_q31(z);
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cordic_mag_phase_q15.c
+*
+* Description:	Q15 CORDIC magnitude and phase.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q15 CORDIC magnitude and phase.
+ * @param[in]  x        real part, or abscissa, in 1.15 format
+ * @param[in]  y        imaginary part, or ordinate, in 1.15 format
+ * @param[out] *pMag    points to the magnitude output, in 2.14 format.
+ * @param[out] *pPhase  points to the phase output, in the range [-1 0.9999] mapping to [-pi pi).
+ * @return none.
+ *
+ * \par
+ * 16 iterations give the full Q15 accuracy. The Q31 kernel outputs are truncated to
+ * 2.14 and 1.15 formats.
+ */
+
+void arm_cordic_mag_phase_q15(
+  q15_t x,
+  q15_t y,
+  q15_t * pMag,
+  q15_t * pPhase)
+{
+  q31_t mag, phase;                              /* Q31 outputs */
+
+  arm_cordic_mag_phase_fast_q31((q31_t) x << 16, (q31_t) y << 16, 16u, &mag, &phase);
+
+  /* Convert from 2.30 and 1.31 to 2.14 and 1.15 formats */
+  *pMag = (q15_t) (mag >> 16);
+  *pPhase = (q15_t) (phase >> 16);
+}
+
+/**
+ * @} end of CORDIC group
+ */
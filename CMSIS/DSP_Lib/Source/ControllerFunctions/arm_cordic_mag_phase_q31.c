@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cordic_mag_phase_q31.c
+*
+* Description:	Q31 CORDIC magnitude and phase.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 CORDIC magnitude and phase.
+ * @param[in]  x        real part, or abscissa, in 1.31 format
+ * @param[in]  y        imaginary part, or ordinate, in 1.31 format
+ * @param[out] *pMag    points to the magnitude output, in 2.30 format.
+ * @param[out] *pPhase  points to the phase output, in the range [-1 0.9999] mapping to [-pi pi).
+ * @return none.
+ *
+ * \par
+ * 30 iterations are performed, which give a phase to about 2<sup>-26</sup> of pi and a
+ * magnitude to about 2<sup>-25</sup>, the truncations of the iterations dominating.
+ */
+
+void arm_cordic_mag_phase_q31(
+  q31_t x,
+  q31_t y,
+  q31_t * pMag,
+  q31_t * pPhase)
+{
+  arm_cordic_mag_phase_fast_q31(x, y, 30u, pMag, pPhase);
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cordic_sin_cos_fast_q31.c
+*
+* Description:	Q31 CORDIC sine and cosine with a given number of iterations.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup CORDIC CORDIC Sine Cosine and Magnitude Phase
+ *
+ * The CORDIC kernels compute the sine and the cosine of an angle together (rotation
+ * mode), or the magnitude and the phase of a point together (vectoring mode), with
+ * shifts and additions only. Each iteration <code>i</code> rotates the vector
+ * <code>(x, y)</code> by <code>+/-atan(2<sup>-i</sup>)</code>:
+ * <pre>
+ *    x' = x -/+ (y >> i)
+ *    y' = y +/- (x >> i)
+ *    z' = z -/+ atan(2<sup>-i</sup>)
+ * </pre>
+ * choosing the sign which drives <code>z</code> to zero in rotation mode, or
+ * <code>y</code> to zero in vectoring mode. Each iteration adds about one bit of accuracy,
+ * and the vector is scaled by a gain which depends only on the number of iterations and
+ * is compensated from a table.
+ *
+ * \par
+ * Angles are in the format of arm_sin_cos_q31(): the angle divided by pi, in 1.31 or 1.15
+ * format, so that [-1 0.9999] maps to [-pi pi). In rotation mode the residual angle left
+ * after the last iteration is applied as a first-order rotation, one multiplication per
+ * output, which doubles the number of accurate bits: 16 iterations give about 27 bits of
+ * accuracy. The magnitude is returned in 2.30 or 2.14 format, as by arm_cmplx_mag_q31()
+ * and arm_cmplx_mag_q15(), without square root.
+ *
+ * \par
+ * The <code>_fast_</code> functions take the number of iterations, up to 31, to trade
+ * accuracy for cycles: for example 10 iterations give sine and cosine to about
+ * 2<sup>-19</sup>, and a phase to about 2<sup>-10</sup> of pi, for instance for a
+ * field-oriented control loop on a Cortex-M3 without FPU. The Q15 functions use the Q31
+ * kernels with fewer iterations, as the iterations cost the same on 32-bit registers.
+ */
+
+/**
+ * @brief  Arctangents of 2^-i divided by pi, in 1.31 format.
+ */
+const q31_t armCordicAtanTableQ31[ARM_CORDIC_MAX_ITER] = {
+  0x20000000, 0x12E4051E, 0x09FB385B, 0x051111D4, 0x028B0D43, 0x0145D7E1,
+  0x00A2F61E, 0x00517C55, 0x0028BE53, 0x00145F2F, 0x000A2F98, 0x000517CC,
+  0x00028BE6, 0x000145F3, 0x0000A2FA, 0x0000517D, 0x000028BE, 0x0000145F,
+  0x00000A30, 0x00000518, 0x0000028C, 0x00000146, 0x000000A3, 0x00000051,
+  0x00000029, 0x00000014, 0x0000000A, 0x00000005, 0x00000003, 0x00000001,
+  0x00000001
+};
+
+/**
+ * @brief  Inverse of the CORDIC gain after n iterations, in 1.31 format, at index n-1.
+ */
+const q31_t armCordicInvGainTableQ31[ARM_CORDIC_MAX_ITER] = {
+  0x5A82799A, 0x50F44D89, 0x4E8986EA, 0x4DEE4507, 0x4DC76B06, 0x4DBDB3EB,
+  0x4DBB461A, 0x4DBAAAA6, 0x4DBA83C9, 0x4DBA7A11, 0x4DBA77A3, 0x4DBA7708,
+  0x4DBA76E1, 0x4DBA76D7, 0x4DBA76D5, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4,
+  0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4,
+  0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4, 0x4DBA76D4,
+  0x4DBA76D4
+};
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 CORDIC sine and cosine with a given number of iterations.
+ * @param[in]  theta    input value in the range [-1 0.9999] mapping to [-pi pi)
+ * @param[in]  numIter  number of iterations, between 1 and 31
+ * @param[out] *pSinVal points to the processed sine output.
+ * @param[out] *pCosVal points to the processed cosine output.
+ * @return none.
+ *
+ * \par
+ * The angle is first brought to [-pi/2 pi/2] by a rotation of pi, which negates the
+ * results. The vector starts at <code>(1/K, 0)</code>, <code>K</code> being the gain of
+ * <code>numIter</code> iterations, in 2.30 format so that it cannot overflow.
+ */
+
+void arm_cordic_sin_cos_fast_q31(
+  q31_t theta,
+  uint32_t numIter,
+  q31_t * pSinVal,
+  q31_t * pCosVal)
+{
+  const q31_t *pAtan = armCordicAtanTableQ31;    /* Arctangents of 2^-i */
+  q31_t x, y, xs, z;                             /* Vector and residual angle */
+  q31_t zr;                                      /* Residual angle in radians */
+  uint32_t negate = 0u;                          /* Set when the angle is rotated by pi */
+  uint32_t i;                                    /* loop counter */
+
+  if(numIter > ARM_CORDIC_MAX_ITER)
+  {
+    numIter = ARM_CORDIC_MAX_ITER;
+  }
+  else if(numIter == 0u)
+  {
+    numIter = 1u;
+  }
+
+  /* Bring the angle to [-pi/2 pi/2]: a rotation of pi negates sine and cosine */
+  z = theta;
+
+  if((z > 0x40000000) || (z < -0x40000000))
+  {
+    z = (q31_t) ((uint32_t) z + 0x80000000u);
+    negate = 1u;
+  }
+
+  /* Start from the inverse of the gain, in 2.30 format */
+  x = armCordicInvGainTableQ31[numIter - 1u] >> 1;
+  y = 0;
+
+  for (i = 0u; i < numIter; i++)
+  {
+    xs = x;
+
+    if(z >= 0)
+    {
+      x -= y >> i;
+      y += xs >> i;
+      z -= pAtan[i];
+    }
+    else
+    {
+      x += y >> i;
+      y -= xs >> i;
+      z += pAtan[i];
+    }
+  }
+
+  /* Rotate by the residual angle, zr = z * pi in radians, to the first order */
+  zr = (q31_t) (((q63_t) z * 0x6487ED51) >> 29);
+  xs = x;
+  x -= (q31_t) (((q63_t) zr * y) >> 31);
+  y += (q31_t) (((q63_t) zr * xs) >> 31);
+
+  if(negate != 0u)
+  {
+    x = -x;
+    y = -y;
+  }
+
+  /* Convert from 2.30 to 1.31 format and saturate */
+  *pSinVal = clip_q63_to_q31((q63_t) y << 1);
+  *pCosVal = clip_q63_to_q31((q63_t) x << 1);
+}
+
+/**
+ * @} end of CORDIC group
+ */
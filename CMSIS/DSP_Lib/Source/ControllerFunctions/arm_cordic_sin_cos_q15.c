@@ -0,0 +1,54 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cordic_sin_cos_q15.c
+*
+* Description:	Q15 CORDIC sine and cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q15 CORDIC sine and cosine.
+ * @param[in]  theta    input value in the range [-1 0.9999] mapping to [-pi pi)
+ * @param[out] *pSinVal points to the processed sine output.
+ * @param[out] *pCosVal points to the processed cosine output.
+ * @return none.
+ *
+ * \par
+ * 9 iterations and the correction by the residual angle give the full Q15 accuracy.
+ * The Q31 kernel outputs are truncated to 1.15 format.
+ */
+
+void arm_cordic_sin_cos_q15(
+  q15_t theta,
+  q15_t * pSinVal,
+  q15_t * pCosVal)
+{
+  q31_t sinVal, cosVal;                          /* Q31 outputs */
+
+  arm_cordic_sin_cos_fast_q31((q31_t) theta << 16, 9u, &sinVal, &cosVal);
+
+  /* Convert from 1.31 to 1.15 format */
+  *pSinVal = (q15_t) (sinVal >> 16);
+  *pCosVal = (q15_t) (cosVal >> 16);
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,48 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cordic_sin_cos_q31.c
+*
+* Description:	Q31 CORDIC sine and cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup CORDIC
+ * @{
+ */
+
+/**
+ * @brief  Q31 CORDIC sine and cosine.
+ * @param[in]  theta    input value in the range [-1 0.9999] mapping to [-pi pi)
+ * @param[out] *pSinVal points to the processed sine output.
+ * @param[out] *pCosVal points to the processed cosine output.
+ * @return none.
+ *
+ * \par
+ * 16 iterations and the correction by the residual angle give a maximum error of
+ * about 2<sup>-27</sup>, the truncations of the iterations dominating.
+ */
+
+void arm_cordic_sin_cos_q31(
+  q31_t theta,
+  q31_t * pSinVal,
+  q31_t * pCosVal)
+{
+  arm_cordic_sin_cos_fast_q31(theta, 16u, pSinVal, pCosVal);
+}
+
+/**
+ * @} end of CORDIC group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_foc_init_q31.c
+*
+* Description:	Q31 field-oriented control step initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 field-oriented control step.
+ * @param[in,out] *S      points to an instance of the FOC structure, with the gains of pidD and pidQ set.
+ * @param[in]     vMax    limit of the d-axis and q-axis voltages, in 1.31 format.
+ * @param[in]     period  compare value of a duty cycle of 1.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The proportional, integral and derivative gains <code>Kp</code>, <code>Ki</code> and
+ * <code>Kd</code> of <code>S->pidD</code> and <code>S->pidQ</code> are set by the caller.
+ * The function computes the derived gains with arm_pid_init_q31() and clears the states.
+ * \par
+ * <code>period</code> is <code>ARR + 1</code> in edge-aligned mode and <code>ARR</code> in
+ * center-aligned mode, the auto-reload value being set with TIM_SetAutoreload().
+ */
+
+void arm_foc_init_q31(
+  arm_foc_instance_q31 * S,
+  q31_t vMax,
+  uint32_t period)
+{
+  /* Derived gains and cleared states of the PID controllers */
+  arm_pid_init_q31(&S->pidD, 1);
+  arm_pid_init_q31(&S->pidQ, 1);
+
+  /* Assign the limits */
+  S->vMax = (vMax < 0) ? 0 : vMax;
+  S->period = period;
+
+  /* Clear the measured currents */
+  S->Id = 0;
+  S->Iq = 0;
+}
+
+/**
+ * @} end of FOC group
+ */
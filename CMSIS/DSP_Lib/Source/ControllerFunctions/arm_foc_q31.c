@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_foc_q31.c
+*
+* Description:	Q31 field-oriented control step: Clarke, Park, PID, inverse Park
+*				and space vector PWM.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup FOC Field-Oriented Control Step
+ *
+ * The current loop of a field-oriented motor drive runs, at every PWM period, the
+ * Clarke transform of the phase currents, the Park transform by the rotor angle, a PID
+ * controller for each of the d-axis and q-axis currents, the inverse Park transform of
+ * the voltages, and space vector modulation of the result into the duty cycles of the
+ * three half-bridges. arm_foc_q31() performs this chain in one call: the sine and the
+ * cosine of the angle are computed once and shared by both Park transforms, the
+ * intermediate values stay in registers, and the 64-bit products of each stage are
+ * saturated once, where the separate functions truncate and saturate each product.
+ *
+ * \par Scaling:
+ * The currents are in 1.31 format. The voltages are in 1.31 format relative to
+ * <code>Vdc/sqrt(3)</code>, the largest phase voltage amplitude of space vector
+ * modulation: a voltage vector of magnitude 1 reaches a duty cycle of 0 or 1 once per
+ * electrical period, and larger vectors are clipped. With <code>vMax</code> equal to
+ * 0x5A82799A, 1/sqrt(2), the voltage vector remains in the linear range for any pair of
+ * d-axis and q-axis voltages.
+ *
+ * \par Space vector modulation:
+ * The modulation adds to the three phase voltages the common-mode voltage
+ * <code>-(max + min) / 2</code>, which is equivalent to the sector-based space vector
+ * modulation with centered zero vectors, and scales the results to compare values between
+ * 0 and <code>period</code>, to be written with TIM_SetCompare1(), TIM_SetCompare2() and
+ * TIM_SetCompare3().
+ */
+
+/**
+ * @addtogroup FOC
+ * @{
+ */
+
+/**
+ * @brief  Q31 field-oriented control step: Clarke, Park, PID, inverse Park and space vector PWM.
+ * @param[in,out] *S      points to an instance of the FOC structure.
+ * @param[in]     Ia      phase a current.
+ * @param[in]     Ib      phase b current.
+ * @param[in]     theta   rotor angle in the range [-1 0.9999] mapping to [-180 179] degrees.
+ * @param[in]     IdRef   d-axis current reference.
+ * @param[in]     IqRef   q-axis current reference.
+ * @param[out]    *pDuty  points to the 3 compare values of phases a, b and c.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The Clarke and Park transforms accumulate both products of each output in 64 bits and
+ * saturate the sum to 1.31 format. The PID controllers are computed as by arm_pid_q31(),
+ * with the output saturated to <code>[-vMax vMax]</code> before it is stored in the state:
+ * as the controller is incremental, the saturation also stops the integration. The
+ * inverse Park transform and the modulation are computed in 2.30 format and cannot
+ * overflow, and the compare values are clipped to <code>[0 period]</code>.
+ * The measured currents <code>Id</code> and <code>Iq</code> are stored in the instance.
+ */
+
+void arm_foc_q31(
+  arm_foc_instance_q31 * S,
+  q31_t Ia,
+  q31_t Ib,
+  q31_t theta,
+  q31_t IdRef,
+  q31_t IqRef,
+  uint32_t * pDuty)
+{
+  arm_pid_instance_q31 *pid;                     /* PID controller */
+  q31_t sinVal, cosVal;                          /* Sine and cosine of the angle */
+  q31_t Ialpha, Ibeta, Id, Iq;                   /* Currents */
+  q31_t Vd, Vq, Valpha, Vbeta;                   /* Voltages, Valpha and Vbeta in 2.30 format */
+  q31_t Va, Vb, Vc, Vmax, Vmin, Voff;            /* Phase voltages and common mode, in 2.30 format */
+  q31_t err, duty;                               /* PID input and duty cycle */
+  q31_t vMax = S->vMax;                          /* Voltage limit */
+  uint32_t period = S->period;                   /* Compare value of a duty cycle of 1 */
+  q63_t acc;                                     /* Accumulator */
+
+  /* Sine and cosine of the angle, shared by the Park and inverse Park transforms */
+  arm_sin_cos_q31(theta, &sinVal, &cosVal);
+
+  /* Clarke transform: Ialpha = Ia, Ibeta = (1/sqrt(3)) * Ia + (2/sqrt(3)) * Ib */
+  Ialpha = Ia;
+  Ibeta = clip_q63_to_q31(((q63_t) Ia * 0x24F34E8B + (q63_t) Ib * 0x49E69D16) >> 30);
+
+  /* Park transform: Id = Ialpha * cos + Ibeta * sin, Iq = Ibeta * cos - Ialpha * sin */
+  Id = clip_q63_to_q31(((q63_t) Ialpha * cosVal + (q63_t) Ibeta * sinVal) >> 31);
+  Iq = clip_q63_to_q31(((q63_t) Ibeta * cosVal - (q63_t) Ialpha * sinVal) >> 31);
+
+  S->Id = Id;
+  S->Iq = Iq;
+
+  /* d-axis PID: y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+  pid = &S->pidD;
+  err = __QSUB(IdRef, Id);
+  acc = (q63_t) pid->A0 * err + (q63_t) pid->A1 * pid->state[0] +
+    (q63_t) pid->A2 * pid->state[1];
+  Vd = clip_q63_to_q31((acc >> 31) + pid->state[2]);
+  Vd = (Vd > vMax) ? vMax : ((Vd < -vMax) ? -vMax : Vd);
+
+  pid->state[1] = pid->state[0];
+  pid->state[0] = err;
+  pid->state[2] = Vd;
+
+  /* q-axis PID */
+  pid = &S->pidQ;
+  err = __QSUB(IqRef, Iq);
+  acc = (q63_t) pid->A0 * err + (q63_t) pid->A1 * pid->state[0] +
+    (q63_t) pid->A2 * pid->state[1];
+  Vq = clip_q63_to_q31((acc >> 31) + pid->state[2]);
+  Vq = (Vq > vMax) ? vMax : ((Vq < -vMax) ? -vMax : Vq);
+
+  pid->state[1] = pid->state[0];
+  pid->state[0] = err;
+  pid->state[2] = Vq;
+
+  /* Inverse Park transform in 2.30 format: Valpha = Vd * cos - Vq * sin, Vbeta = Vd * sin + Vq * cos */
+  Valpha = (q31_t) (((q63_t) Vd * cosVal - (q63_t) Vq * sinVal) >> 32);
+  Vbeta = (q31_t) (((q63_t) Vd * sinVal + (q63_t) Vq * cosVal) >> 32);
+
+  /* Inverse Clarke transform: Va = Valpha, Vb,c = -Valpha / 2 +/- (sqrt(3) / 2) * Vbeta */
+  Va = Valpha;
+  Vbeta = (q31_t) (((q63_t) Vbeta * 0x6ED9EBA1) >> 31);
+  Vb = -(Valpha >> 1) + Vbeta;
+  Vc = -(Valpha >> 1) - Vbeta;
+
+  /* Common-mode voltage -(max + min) / 2 of space vector modulation */
+  Vmax = (Va > Vb) ? Va : Vb;
+  Vmin = (Va > Vb) ? Vb : Va;
+  Vmax = (Vc > Vmax) ? Vc : Vmax;
+  Vmin = (Vc < Vmin) ? Vc : Vmin;
+  Voff = -((Vmax + Vmin) >> 1);
+
+  /* Duty cycle / 2 = 1/4 + (V + Voff) / sqrt(3), in 1.31 format, clipped to [0 1/2] */
+  duty = 0x20000000 + (q31_t) (((q63_t) (Va + Voff) * 0x49E69D16) >> 31);
+  duty = (duty < 0) ? 0 : ((duty > 0x40000000) ? 0x40000000 : duty);
+  pDuty[0] = (uint32_t) (((q63_t) duty * period) >> 30);
+
+  duty = 0x20000000 + (q31_t) (((q63_t) (Vb + Voff) * 0x49E69D16) >> 31);
+  duty = (duty < 0) ? 0 : ((duty > 0x40000000) ? 0x40000000 : duty);
+  pDuty[1] = (uint32_t) (((q63_t) duty * period) >> 30);
+
+  duty = 0x20000000 + (q31_t) (((q63_t) (Vc + Voff) * 0x49E69D16) >> 31);
+  duty = (duty < 0) ? 0 : ((duty > 0x40000000) ? 0x40000000 : duty);
+  pDuty[2] = (uint32_t) (((q63_t) duty * period) >> 30);
+}
+
+/**
+ * @} end of FOC group
+ */
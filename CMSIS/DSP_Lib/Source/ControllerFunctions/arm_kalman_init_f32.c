@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_init_f32.c
+*
+* Description:	Floating-point Kalman filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Kalman filter.
+ * @param[in,out] *S          points to an instance of the Kalman filter structure.
+ * @param[in]     numStates   number of states.
+ * @param[in]     josephFlag  1 for the Joseph form of the covariance update, 0 for the standard form.
+ * @param[in]     initVar     initial variance of every state, the state estimate being cleared.
+ * @param[in]     *pArena     points to the memory of the state, the covariance and the scratch buffers.
+ * @param[in]     arenaSize   number of float32_t in the arena, at least ARM_KALMAN_ARENA_SIZE_F32(numStates).
+ * @return The function returns ARM_MATH_ARGUMENT_ERROR if the arena is too small, ARM_MATH_SUCCESS otherwise.
+ *
+ * \par Description:
+ * The arena holds, in this order, the state estimate <code>pX</code>, the packed
+ * covariance <code>pP</code> and the scratch buffers of the prediction and of the update:
+ * a filter takes <code>n*n + n*(n+1)/2 + 4*n</code> words, with no other buffer. A
+ * different initial estimate or covariance is written in <code>pX</code> and
+ * <code>pP</code> after this function.
+ */
+
+arm_status arm_kalman_init_f32(
+  arm_kalman_instance_f32 * S,
+  uint16_t numStates,
+  uint8_t josephFlag,
+  float32_t initVar,
+  float32_t * pArena,
+  uint32_t arenaSize)
+{
+  uint32_t n = numStates;
+  uint32_t i;
+
+  if((n == 0u) || (arenaSize < ARM_KALMAN_ARENA_SIZE_F32(n)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numStates = numStates;
+  S->josephFlag = josephFlag;
+
+  /* Carve the buffers out of the arena */
+  S->pX = pArena;
+  S->pP = S->pX + n;
+  S->pT = S->pP + ((n * (n + 1u)) / 2u);
+  S->pU = S->pT + (n * n);
+  S->pX0 = S->pU + n;
+  S->pIdx = (uint32_t *) (S->pX0 + n);
+
+  /* Zero state, diagonal covariance */
+  memset(S->pX, 0, n * sizeof(float32_t));
+  memset(S->pP, 0, ((n * (n + 1u)) / 2u) * sizeof(float32_t));
+
+  for (i = 0u; i < n; i++)
+  {
+    S->pP[ARM_KALMAN_P_INDEX(n, i, i)] = initVar;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,176 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_predict_f32.c
+*
+* Description:	Floating-point Kalman filter prediction step.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Prediction step of the floating-point Kalman filter.
+ * @param[in,out] *S       points to an instance of the Kalman filter structure.
+ * @param[in]     *pF      points to the n x n transition matrix, or its Jacobian for the extended filter.
+ * @param[in]     *pQ      points to the process noise covariance, packed as the covariance, or NULL for none.
+ * @param[in]     *pXPred  points to the n predicted states f(x) of the extended filter, or NULL for F * x.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+ *
+ * \par
+ * <code>T = F * P</code> is accumulated row by row in the scratch, the zero elements of
+ * <code>F</code> being skipped, and only the upper triangle of <code>T * F^T + Q</code> is
+ * computed, straight into the packed covariance: the method of arm_mat_sym_update_f32()
+ * without the full copies of <code>P</code> and of the result.
+ */
+
+arm_status arm_kalman_predict_f32(
+  arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pF,
+  const float32_t * pQ,
+  const float32_t * pXPred)
+{
+  float32_t *pFd = pF->pData;                    /* transition matrix pointer */
+  float32_t *pP = S->pP;                         /* packed covariance pointer */
+  float32_t *pX = S->pX;                         /* state pointer */
+  float32_t *pT, *pIn1, *pIn2;                   /* rows of T, P and F */
+  float32_t coef, sum;                           /* multiplier of a row and accumulator */
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t i, j, k, c, col;                      /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pF->numRows != n) || (pF->numCols != n))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* T(i,:) = F(i,0) * P(0,:) + ... + F(i,n-1) * P(n-1,:) */
+  for (i = 0u; i < n; i++)
+  {
+    pT = S->pT + (i * n);
+    memset(pT, 0, n * sizeof(float32_t));
+
+    for (k = 0u; k < n; k++)
+    {
+      coef = pFd[(i * n) + k];
+
+      if(coef == 0.0f)
+      {
+        continue;
+      }
+
+      /* Row k of P: the column k of the upper triangle up to the diagonal */
+      pIn1 = pP + k;
+
+      for (c = 0u; c < k; c++)
+      {
+        pT[c] += coef * *pIn1;
+        pIn1 += (n - 1u) - c;
+      }
+
+      /* then the row k of the upper triangle */
+      for (c = k; c < n; c++)
+      {
+        pT[c] += coef * *pIn1++;
+      }
+    }
+  }
+
+  /* Upper triangle of T * F^T + Q, P(i,j) = T(i,:) . F(j,:) + Q(i,j) */
+  for (i = 0u; i < n; i++)
+  {
+    for (j = i; j < n; j++)
+    {
+      pIn1 = S->pT + (i * n);
+      pIn2 = pFd + (j * n);
+      sum = (pQ != NULL) ? *pQ++ : 0.0f;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling. Process 4 columns at a time. */
+      col = n >> 2u;
+
+      while(col > 0u)
+      {
+        sum += pIn1[0] * pIn2[0];
+        sum += pIn1[1] * pIn2[1];
+        sum += pIn1[2] * pIn2[2];
+        sum += pIn1[3] * pIn2[3];
+        pIn1 += 4u;
+        pIn2 += 4u;
+
+        col--;
+      }
+
+      col = n % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      col = n;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(col > 0u)
+      {
+        sum += *pIn1++ * *pIn2++;
+
+        col--;
+      }
+
+      *pP++ = sum;
+    }
+  }
+
+  /* State prediction */
+  if(pXPred != NULL)
+  {
+    memcpy(pX, pXPred, n * sizeof(float32_t));
+  }
+  else
+  {
+    for (i = 0u; i < n; i++)
+    {
+      sum = 0.0f;
+      pIn2 = pFd + (i * n);
+
+      for (k = 0u; k < n; k++)
+      {
+        sum += pIn2[k] * pX[k];
+      }
+
+      S->pU[i] = sum;
+    }
+
+    memcpy(pX, S->pU, n * sizeof(float32_t));
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
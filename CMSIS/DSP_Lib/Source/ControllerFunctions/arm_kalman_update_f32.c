@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_kalman_update_f32.c
+*
+* Description:	Floating-point Kalman filter update step.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupController
+ */
+
+/**
+ * @defgroup Kalman Kalman Filter
+ *
+ * A linear or extended Kalman filter of <code>n</code> states, whose memory is one arena
+ * sized by ARM_KALMAN_ARENA_SIZE_F32() and given to arm_kalman_init_f32(). The prediction
+ * <pre>
+ *     x = F * x   (or f(x))
+ *     P = F * P * F^T + Q
+ * </pre>
+ * is done by arm_kalman_predict_f32(), and the update by a measurement
+ * <code>z = H * x + v</code> (or <code>h(x) + v</code>) by arm_kalman_update_f32().
+ *
+ * \par Storage
+ * The covariance <code>P</code> and the process noise <code>Q</code> are symmetric: only
+ * their upper triangle is stored, packed by rows, the element <code>(i, j)</code>,
+ * <code>i <= j</code>, at ARM_KALMAN_P_INDEX(n, i, j). This halves their memory and the
+ * work of every step, and keeps <code>P</code> exactly symmetric.
+ *
+ * \par Sequential update
+ * The measurement noises are independent, <code>R</code> being given by its diagonal, and
+ * the rows of <code>H</code> are processed one at a time as scalar measurements: the
+ * innovation variance <code>s = h * P * h^T + r</code> is a scalar and the gain is
+ * <code>k = P * h^T / s</code>, so no matrix is inverted. The zero elements of a row
+ * of <code>H</code> are skipped, so that a measurement of one state costs
+ * <code>O(n)</code> operations before the covariance update, <code>O(n*n/2)</code>.
+ * For correlated noises, the measurement is decorrelated beforehand by the Cholesky
+ * factor of <code>R</code> (arm_mat_cholesky_f32(), arm_mat_solve_lower_triangular_f32()).
+ *
+ * \par Extended filter
+ * The application gives <code>f(x)</code> and <code>h(x)</code> at the current estimate
+ * with their Jacobians <code>F</code> and <code>H</code>. Within an update, the predicted
+ * measurement of a row is corrected by the change of the state since the start of the
+ * update, <code>h(x0) + H * (x - x0)</code>, as the sequential update needs.
+ */
+
+/**
+ * @addtogroup Kalman
+ * @{
+ */
+
+/**
+ * @brief  Update step of the floating-point Kalman filter, one scalar measurement at a time.
+ * @param[in,out] *S      points to an instance of the Kalman filter structure.
+ * @param[in]     *pH     points to the m x n measurement matrix, or its Jacobian for the extended filter.
+ * @param[in]     *pZ     points to the m measurements.
+ * @param[in]     *pR     points to the m measurement noise variances, the diagonal of R.
+ * @param[in]     *pHx    points to the m predicted measurements h(x) of the extended filter, or NULL for H * x.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+ * ARM_MATH_SINGULAR if an innovation variance is not positive, ARM_MATH_SUCCESS otherwise.
+ *
+ * \par
+ * With <code>u = P * h^T</code>, the standard form of the covariance update is
+ * <code>P = P - u * u^T / s</code>. The Joseph form
+ * <code>(I - k*h) * P * (I - k*h)^T + k * r * k^T</code> reduces for a scalar measurement
+ * to <code>P - k*u^T - u*k^T + s * k*k^T</code>: the same cost order, two more
+ * multiply-accumulates per element, and a covariance which stays positive semi-definite
+ * when the rounding of <code>k</code> makes the two forms differ. If
+ * ARM_MATH_SINGULAR is returned, the measurements before the failing row are applied.
+ */
+
+arm_status arm_kalman_update_f32(
+  arm_kalman_instance_f32 * S,
+  const arm_matrix_instance_f32 * pH,
+  const float32_t * pZ,
+  const float32_t * pR,
+  const float32_t * pHx)
+{
+  float32_t *pP;                                 /* packed covariance pointer */
+  float32_t *pX = S->pX;                         /* state pointer */
+  float32_t *pX0 = S->pX0;                       /* state before the update */
+  float32_t *pU = S->pU;                         /* P * h^T */
+  uint32_t *pIdx = S->pIdx;                      /* nonzero elements of h */
+  float32_t *pRow;                               /* row h of H */
+  float32_t y, s, inv, sum, ki, ui;
+  uint32_t n = S->numStates;                     /* number of states */
+  uint32_t m = pH->numRows;                      /* number of measurements */
+  uint32_t r, i, j, k, c, nnz;                   /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if(pH->numCols != n)
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  if(pHx != NULL)
+  {
+    memcpy(pX0, pX, n * sizeof(float32_t));
+  }
+
+  for (r = 0u; r < m; r++)
+  {
+    pRow = pH->pData + (r * n);
+
+    /* Nonzero elements of the row */
+    nnz = 0u;
+    for (k = 0u; k < n; k++)
+    {
+      if(pRow[k] != 0.0f)
+      {
+        pIdx[nnz++] = k;
+      }
+    }
+
+    /* Innovation y = z - h * x, or z - h(x0) - h * (x - x0) */
+    if(pHx != NULL)
+    {
+      y = pZ[r] - pHx[r];
+      for (i = 0u; i < nnz; i++)
+      {
+        k = pIdx[i];
+        y -= pRow[k] * (pX[k] - pX0[k]);
+      }
+    }
+    else
+    {
+      y = pZ[r];
+      for (i = 0u; i < nnz; i++)
+      {
+        k = pIdx[i];
+        y -= pRow[k] * pX[k];
+      }
+    }
+
+    /* u = P * h^T, on the nonzero elements of h */
+    for (c = 0u; c < n; c++)
+    {
+      sum = 0.0f;
+      for (i = 0u; i < nnz; i++)
+      {
+        k = pIdx[i];
+        sum += pRow[k] * S->pP[(c <= k) ? ARM_KALMAN_P_INDEX(n, c, k) : ARM_KALMAN_P_INDEX(n, k, c)];
+      }
+      pU[c] = sum;
+    }
+
+    /* Innovation variance s = h * u + r */
+    s = pR[r];
+    for (i = 0u; i < nnz; i++)
+    {
+      k = pIdx[i];
+      s += pRow[k] * pU[k];
+    }
+
+    if(!(s > 0.0f))
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    inv = 1.0f / s;
+
+    /* State x = x + k * y, k = u / s */
+    sum = y * inv;
+    for (c = 0u; c < n; c++)
+    {
+      pX[c] += pU[c] * sum;
+    }
+
+    /* Upper triangle of the covariance */
+    pP = S->pP;
+
+    if(S->josephFlag)
+    {
+      for (i = 0u; i < n; i++)
+      {
+        ui = pU[i];
+        ki = ui * inv;
+        for (j = i; j < n; j++)
+        {
+          *pP++ += (((s * ki) - ui) * (pU[j] * inv)) - (ki * pU[j]);
+        }
+      }
+    }
+    else
+    {
+      for (i = 0u; i < n; i++)
+      {
+        ki = pU[i] * inv;
+        for (j = i; j < n; j++)
+        {
+          *pP++ -= ki * pU[j];
+        }
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Kalman group
+ */
@@ -0,0 +1,70 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_pid_ext_block_f32.c
+*
+* Description:	Floating-point extended PID Control of a block of independent loops.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Process function for a block of independent floating-point extended PID Controls.
+ * @param[in,out] *S points to an array of <code>numLoops</code> extended PID instances
+ * @param[in]     *pIn points to the <code>numLoops</code> errors
+ * @param[in]     *pFf points to the <code>numLoops</code> feed-forward inputs, or NULL for none
+ * @param[out]    *pOut points to the <code>numLoops</code> outputs, which may be <code>pIn</code>
+ * @param[in]     numLoops number of control loops
+ * @return none
+ * \par Description:
+ * The loop <code>n</code> computes <code>pOut[n] = arm_pid_ext_f32(&S[n], pIn[n], pFf[n])</code>,
+ * with a feed-forward input of zero when <code>pFf</code> is NULL. All the loops of a
+ * multi-axis controller are updated in one call from the interrupt service routine,
+ * without the call overhead of each loop.
+ */
+
+void arm_pid_ext_block_f32(
+  arm_pid_ext_instance_f32 * S,
+  float32_t * pIn,
+  float32_t * pFf,
+  float32_t * pOut,
+  uint32_t numLoops)
+{
+  uint32_t blkCnt = numLoops;                    /* loop counter */
+
+  if(pFf != NULL)
+  {
+    while(blkCnt > 0u)
+    {
+      *pOut++ = arm_pid_ext_f32(S++, *pIn++, *pFf++);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      *pOut++ = arm_pid_ext_f32(S++, *pIn++, 0.0f);
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,55 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_pid_ext_init_f32.c
+*
+* Description:	Floating-point extended PID Control initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point extended PID Control.
+ * @param[in,out] *S points to an instance of the extended PID structure.
+ * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state & 1 = reset the state.
+ * @return none.
+ * \par Description:
+ * The function computes the derived gains <code>Ad</code> and <code>Bd</code> of the
+ * derivative filter from the derivative gain \c Kd and the smoothing factor \c alpha. The
+ * other gains and the output limits are used as set in the structure. The gains can be
+ * changed between two samples by calling the function again with
+ * <code>resetStateFlag</code> = 0.
+ */
+
+void arm_pid_ext_init_f32(
+  arm_pid_ext_instance_f32 * S,
+  int32_t resetStateFlag)
+{
+  /* Derived coefficient Ad */
+  S->Ad = 1.0f - S->alpha;
+
+  /* Derived coefficient Bd */
+  S->Bd = S->alpha * S->Kd;
+
+  /* Check whether state needs reset or not */
+  if(resetStateFlag)
+  {
+    /* Clear the state buffer.  The size will be always 3 samples */
+    memset(S->state, 0, 3u * sizeof(float32_t));
+  }
+}
+
+/**
+ * @} end of PID group
+ */
@@ -0,0 +1,39 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_pid_ext_reset_f32.c
+*
+* Description:	Floating-point extended PID Control reset function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup PID
+ * @{
+ */
+
+/**
+ * @brief  Reset function for the floating-point extended PID Control.
+ * @param[in] *S	Instance pointer of extended PID control data structure.
+ * @return none.
+ * \par Description:
+ * The function resets the integrator, the derivative filter and the previous error to zeros.
+ */
+
+void arm_pid_ext_reset_f32(
+  arm_pid_ext_instance_f32 * S)
+{
+  /* Clear the state buffer.  The size will be always 3 samples */
+  memset(S->state, 0, 3u * sizeof(float32_t));
+}
+
+/**
+ * @} end of PID group
+ */
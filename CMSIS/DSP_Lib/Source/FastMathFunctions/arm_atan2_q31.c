@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_atan2_q31.c
+*
+* Description:	Q31 vector four-quadrant arctangent.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup Atan2
+ * @{
+ */
+
+/**
+ * @brief  Q31 vector four-quadrant arctangent.
+ * @param[in]  *pSrcY     points to the vector of ordinates
+ * @param[in]  *pSrcX     points to the vector of abscissas
+ * @param[out] *pDst      points to the output vector of angles divided by pi, in 1.31 format
+ * @param[in]  blockSize  number of samples in each vector
+ * @return none.
+ *
+ * \par
+ * The reduced argument <code>t</code> is computed in 1.31 format by a 64-bit division,
+ * and <code>atan(t)/pi</code> by a polynomial of degree 11 whose coefficients, fitted on
+ * [0, tan(pi/8)], are in 1.31 format:
+ * <pre>
+ *    atan(t)/pi = t * (c0 + c1 * t<sup>2</sup> + c2 * t<sup>4</sup> + ... + c5 * t<sup>10</sup>)
+ * </pre>
+ * evaluated by Horner's rule with 32 x 32 multiplications.
+ */
+
+void arm_atan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t x, y;                                    /* Point */
+  q63_t a, b, tmp;                               /* min(|x|,|y|) and max(|x|,|y|) */
+  q31_t t, z, p, base;                           /* Reduced argument and polynomial */
+  q63_t angle;                                   /* Angle divided by pi */
+  uint32_t swap;                                 /* Set when |y| > |x| */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    y = *pSrcY++;
+    x = *pSrcX++;
+
+    /* a = min(|x|,|y|), b = max(|x|,|y|), up to 2^31 */
+    a = (y < 0) ? -y : y;
+    b = (x < 0) ? -x : x;
+    swap = 0u;
+
+    if(a > b)
+    {
+      tmp = a;
+      a = b;
+      b = tmp;
+      swap = 1u;
+    }
+
+    if(b == 0)
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* Reduce the argument below tan(pi/8), 0x6A09E668 in 0.32 format */
+      if(a > ((b * 0x6A09E668LL) >> 32))
+      {
+        t = (q31_t) (((a - b) << 31) / (a + b));
+        base = 0x20000000;
+      }
+      else
+      {
+        t = (q31_t) ((a << 31) / b);
+        base = 0;
+      }
+
+      /* atan(t)/pi = t * (c0 + c1 * z + ... + c5 * z^5), z = t^2 */
+      z = (q31_t) (((q63_t) t * t) >> 31);
+      p = (q31_t) 0xFD9F2448;
+      p = 0x044524DD + (q31_t) (((q63_t) p * z) >> 31);
+      p = (q31_t) 0xFA345EBB + (q31_t) (((q63_t) p * z) >> 31);
+      p = 0x0825C3CF + (q31_t) (((q63_t) p * z) >> 31);
+      p = (q31_t) 0xF26B36B6 + (q31_t) (((q63_t) p * z) >> 31);
+      p = 0x28BE60D9 + (q31_t) (((q63_t) p * z) >> 31);
+      angle = base + (((q63_t) p * t) >> 31);
+
+      /* Restore the octant: pi/2 and pi are 0x40000000 and 0x80000000 */
+      if(swap != 0u)
+      {
+        angle = 0x40000000 - angle;
+      }
+
+      if(x < 0)
+      {
+        angle = 0x80000000LL - angle;
+      }
+
+      if(y < 0)
+      {
+        angle = -angle;
+      }
+
+      *pDst++ = clip_q63_to_q31(angle);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Atan2 group
+ */
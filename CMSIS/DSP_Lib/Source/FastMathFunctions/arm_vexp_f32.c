@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vexp_f32.c
+*
+* Description:	Floating-point vector exponential.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup VExp Vector Exponential
+ *
+ * Computes the natural exponential of each element of a floating-point vector:
+ * <pre>
+ *    x = n * ln(2) + r,    |r| <= ln(2) / 2
+ *    exp(x) = 2<sup>n</sup> * exp(r)
+ * </pre>
+ * The reduction subtracts <code>n * ln(2)</code> in two parts, the first exact, and
+ * <code>exp(r)</code> is a polynomial of degree 7 evaluated in single precision. The scale
+ * by <code>2<sup>n</sup></code> is applied to the exponent field. There is no table and
+ * no division, so on the Cortex-M4 FPU the cost per element is about 15 floating-point
+ * operations.
+ *
+ * \par
+ * The maximum error measured over the whole input range is 1 ULP. Inputs above 88.72
+ * give +infinity and inputs below -87.33, whose result would be denormal, give zero.
+ */
+
+/**
+ * @addtogroup VExp
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector exponential.
+ * @param[in]  *pSrc      points to the input vector
+ * @param[out] *pDst      points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return none.
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t in, fn, r, z, p;                     /* Input, reduction and polynomial */
+  int32_t n;                                     /* Exponent of the result */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } scale;                                       /* 2^n built in the exponent field */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(in > 88.7228317f)
+    {
+      /* Overflow: +infinity */
+      scale.i = 0x7F800000;
+      *pDst++ = scale.f;
+    }
+    else if(in < -87.3365479f)
+    {
+      /* Underflow below the smallest normal number */
+      *pDst++ = 0.0f;
+    }
+    else
+    {
+      /* n = round(x / ln(2)) */
+      fn = (in * 1.44269504088896341f) + 0.5f;
+      n = (int32_t) fn;
+
+      if(fn < (float32_t) n)
+      {
+        n--;
+      }
+
+      fn = (float32_t) n;
+
+      /* r = x - n * ln(2), with ln(2) = 0.693359375 - 2.12194440e-4 */
+      r = (in - (fn * 0.693359375f)) + (fn * 2.12194440e-4f);
+
+      /* exp(r) = 1 + r + r^2 * P(r) */
+      z = r * r;
+      p = (((((1.9875691500e-4f * r) + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r +
+            4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f;
+      p = (p * z) + r + 1.0f;
+
+      /* The exponent field holds n up to 127 */
+      if(n > 127)
+      {
+        p *= 2.0f;
+        n--;
+      }
+
+      scale.i = (n + 127) << 23;
+      *pDst++ = p * scale.f;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VExp group
+ */
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vlog_f32.c
+*
+* Description:	Floating-point vector natural logarithm.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup VLog Vector Natural Logarithm
+ *
+ * Computes the natural logarithm of each element of a floating-point vector:
+ * <pre>
+ *    x = 2<sup>e</sup> * m,    sqrt(1/2) <= m < sqrt(2)
+ *    log(x) = e * ln(2) + log(1 + f),    f = m - 1
+ * </pre>
+ * <code>e</code> and <code>m</code> are read from the exponent and mantissa fields, and
+ * <code>log(1 + f) = f - f<sup>2</sup>/2 + f<sup>3</sup> * P(f)</code> with a polynomial of
+ * degree 8. <code>e * ln(2)</code> is added in two parts, the first exact. There is no
+ * table and no division.
+ *
+ * \par
+ * The maximum error measured over the positive normal and denormal inputs is 1 ULP.
+ * Zero gives -infinity, negative inputs give NaN, and +infinity and NaN are returned
+ * unchanged.
+ */
+
+/**
+ * @addtogroup VLog
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector natural logarithm.
+ * @param[in]  *pSrc      points to the input vector
+ * @param[out] *pDst      points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t f, z, y, fe;                         /* Reduced argument and polynomial */
+  int32_t e;                                     /* Exponent of the input */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } in;                                          /* Input and its bit pattern */
+
+  while(blkCnt > 0u)
+  {
+    in.f = *pSrc++;
+
+    if(in.i <= 0)
+    {
+      /* Zero gives -infinity, negative inputs NaN */
+      in.i = ((in.i & 0x7FFFFFFF) == 0) ? (int32_t) 0xFF800000 : 0x7FC00000;
+      *pDst++ = in.f;
+    }
+    else if(in.i >= 0x7F800000)
+    {
+      /* +infinity and NaN */
+      *pDst++ = in.f;
+    }
+    else
+    {
+      e = 0;
+
+      /* Normalize a denormal input */
+      if(in.i < 0x00800000)
+      {
+        in.f *= 33554432.0f;
+        e = -25;
+      }
+
+      /* x = 2^e * m with 1 <= m < 2 */
+      e += (in.i >> 23) - 127;
+      in.i = (in.i & 0x007FFFFF) | 0x3F800000;
+
+      /* Center the mantissa on 1 */
+      if(in.f > 1.41421356f)
+      {
+        in.f *= 0.5f;
+        e++;
+      }
+
+      f = in.f - 1.0f;
+      fe = (float32_t) e;
+
+      /* log(1 + f) = f - f^2 / 2 + f^3 * P(f) */
+      z = f * f;
+      y = (((((((((7.0376836292e-2f * f) - 1.1514610310e-1f) * f + 1.1676998740e-1f) * f -
+                1.2420140846e-1f) * f + 1.4249322787e-1f) * f - 1.6668057665e-1f) * f +
+             2.0000714765e-1f) * f - 2.4999993993e-1f) * f + 3.3333331174e-1f) * f * z;
+
+      /* Add e * ln(2), with ln(2) = 0.693359375 - 2.12194440e-4 */
+      y -= fe * 2.12194440e-4f;
+      y -= 0.5f * z;
+
+      *pDst++ = (f + y) + (fe * 0.693359375f);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VLog group
+ */
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vsin_cos_f32.c
+*
+* Description:	Floating-point vector sine and cosine.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup VSinCos Vector Sine Cosine
+ *
+ * Computes the sine and the cosine of each element of a floating-point vector, in
+ * radians. The argument is reduced to the quadrant <code>j</code> and the remainder
+ * <code>r</code>:
+ * <pre>
+ *    x = j * pi/2 + r,    |r| <= pi/4
+ * </pre>
+ * subtracting <code>j * pi/2</code> in three parts, the first exact for <code>|j|</code> up to
+ * 2<sup>16</sup>. <code>sin(r)</code> and <code>cos(r)</code> are odd and even polynomials of
+ * degree 7 and 8, which the quadrant exchanges and negates. Unlike arm_sin_f32() and
+ * arm_cos_f32(), which interpolate a table of 256 values with an error of a few
+ * 10<sup>-6</sup>, the result has nearly full single precision and both functions share
+ * the reduction.
+ *
+ * \par
+ * The maximum error measured for <code>|x| <= 8192</code> is 2 ULP, relative to the
+ * magnitude of the result or 2<sup>-24</sup>, whichever is larger. The reduction is
+ * designed for <code>|x|</code> up to about 10<sup>5</sup>; beyond, the accuracy degrades.
+ */
+
+/**
+ * @addtogroup VSinCos
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector sine and cosine.
+ * @param[in]  *pSrc      points to the input vector, in radians
+ * @param[out] *pSinDst   points to the output vector of sines
+ * @param[out] *pCosDst   points to the output vector of cosines
+ * @param[in]  blockSize  number of samples in each vector
+ * @return none.
+ */
+
+void arm_vsin_cos_f32(
+  float32_t * pSrc,
+  float32_t * pSinDst,
+  float32_t * pCosDst,
+  uint32_t blockSize)
+{
+  float32_t in, fj, r, z, s, c;                  /* Input, reduction and polynomials */
+  int32_t j;                                     /* Quadrant */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    /* j = round(x / (pi/2)) */
+    fj = in * 0.636619772367581343f;
+    j = (int32_t) (fj + ((fj >= 0.0f) ? 0.5f : -0.5f));
+    fj = (float32_t) j;
+
+    /* r = x - j * pi/2, with pi/2 = 1.5703125 + 4.837512969970703125e-4 + 7.54978995489188216e-8 */
+    r = ((in - (fj * 1.5703125f)) - (fj * 4.837512969970703125e-4f)) -
+      (fj * 7.54978995489188216e-8f);
+
+    /* Polynomials of sin(r) and cos(r) */
+    z = r * r;
+    s = r + ((r * z) * (((-1.9515295891e-4f * z) + 8.3321608736e-3f) * z -
+                        1.6666654611e-1f));
+    c = (1.0f - (0.5f * z)) +
+      ((z * z) * (((2.443315711809948e-5f * z) - 1.388731625493765e-3f) * z +
+                  4.166664568298827e-2f));
+
+    /* Exchange and negate according to the quadrant */
+    switch (j & 3)
+    {
+    case 0:
+      *pSinDst++ = s;
+      *pCosDst++ = c;
+      break;
+
+    case 1:
+      *pSinDst++ = c;
+      *pCosDst++ = -s;
+      break;
+
+    case 2:
+      *pSinDst++ = -s;
+      *pCosDst++ = -c;
+      break;
+
+    default:
+      *pSinDst++ = -c;
+      *pCosDst++ = s;
+      break;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VSinCos group
+ */
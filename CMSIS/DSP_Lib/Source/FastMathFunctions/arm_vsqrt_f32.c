@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_vsqrt_f32.c
+*
+* Description:	Floating-point vector square root.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup VSqrt Vector Square Root
+ *
+ * Computes the square root of each element of a floating-point vector. Each element is
+ * computed by arm_sqrt_f32(), which uses the VSQRT instruction of the Cortex-M4 FPU and is
+ * correctly rounded (0.5 ULP): the block function saves the call and status handling per
+ * element, and interleaves four independent square roots on Cortex-M3 and Cortex-M4.
+ * Negative elements give zero, as with arm_sqrt_f32().
+ */
+
+/**
+ * @addtogroup VSqrt
+ * @{
+ */
+
+/**
+ * @brief  Floating-point vector square root.
+ * @param[in]  *pSrc      points to the input vector
+ * @param[out] *pDst      points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return none.
+ */
+
+void arm_vsqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A) */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    (void) arm_sqrt_f32(in1, &pDst[0]);
+    (void) arm_sqrt_f32(in2, &pDst[1]);
+    (void) arm_sqrt_f32(in3, &pDst[2]);
+    (void) arm_sqrt_f32(in4, &pDst[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C = sqrt(A) */
+    (void) arm_sqrt_f32(*pSrc++, pDst++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of VSqrt group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_create_q31.c
+*
+* Description:	Creation of the Q31 Biquad cascade filter in a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Initializes the Q31 Biquad cascade filter with its state allocated from a RAM arena.
+ * @param[in,out] *S         points to an instance of the Q31 Biquad cascade filter structure.
+ * @param[in]     numStages  number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients.
+ * @param[in]     postShift  shift to be applied to the output.
+ * @param[in,out] *A         points to an instance of the RAM arena structure.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when
+ * the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The state, <code>ARM_BIQUAD_DF1_STATE_SIZE(numStages)</code> samples, is allocated from the
+ * arena, aligned on 8 bytes, and the filter is initialized by arm_biquad_cascade_df1_init_q31().
+ * In an arena in the CCM data RAM, the state, read and written for every sample, is
+ * accessed with no wait state. With an arena planning the memory, the size is counted
+ * and the instance is not modified.
+ */
+
+arm_status arm_biquad_cascade_df1_create_q31(
+  arm_biquad_casd_df1_inst_q31 * S,
+  uint8_t numStages,
+  q31_t *pCoeffs,
+  int8_t postShift,
+  arm_ram_arena_instance * A)
+{
+  q31_t *pState;                               /* State allocated from the arena */
+
+  pState = (q31_t *) arm_ram_arena_alloc(A, ARM_BIQUAD_DF1_STATE_SIZE(numStages) * sizeof(q31_t));
+
+  if(pState == NULL)
+  {
+    /* A planning arena counts the size only */
+    return ((A->pBase == NULL) ? ARM_MATH_SUCCESS : ARM_MATH_LENGTH_ERROR);
+  }
+
+  arm_biquad_cascade_df1_init_q31(S, numStages, pCoeffs, pState, postShift);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
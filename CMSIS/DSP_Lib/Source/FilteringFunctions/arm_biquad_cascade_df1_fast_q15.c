@@ -132,6 +132,7 @@ void arm_biquad_cascade_df1_fast_q15(
       acc = __SMLAD(a1, state_out, acc);
 
       /* The result is converted from 3.29 to 1.31 and then saturation is applied */
+      ARM_SAT_STATS_Q15(S, acc >> shift);
       out = __SSAT((acc >> shift), 16);
 
       /* Every time after the output is computed state should be updated. */
@@ -163,6 +164,7 @@ void arm_biquad_cascade_df1_fast_q15(
       acc = __SMLAD(a1, state_out, acc);
 
       /* The result is converted from 3.29 to 1.31 and then saturation is applied */
+      ARM_SAT_STATS_Q15(S, acc >> shift);
       out = __SSAT((acc >> shift), 16);
 
 
@@ -231,6 +233,7 @@ void arm_biquad_cascade_df1_fast_q15(
       acc = __SMLAD(a1, state_out, acc);
 
       /* The result is converted from 3.29 to 1.31 and then saturation is applied */
+      ARM_SAT_STATS_Q15(S, acc >> shift);
       out = __SSAT((acc >> shift), 16);
 
       /* Store the output in the destination buffer. */
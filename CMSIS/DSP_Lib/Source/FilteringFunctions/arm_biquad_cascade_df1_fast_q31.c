@@ -131,6 +131,7 @@ void arm_biquad_cascade_df1_fast_q31(
       acc = (q31_t) ((((q63_t) acc << 32) + ((q63_t) a2 * (Yn2))) >> 32);
 
       /* The result is converted to 1.31 , Yn2 variable is reused */
+      ARM_SAT_STATS_Q31(S, (q63_t) acc << shift);
       Yn2 = acc << shift;
 
       /* Read the second input */
@@ -152,6 +153,7 @@ void arm_biquad_cascade_df1_fast_q31(
       acc = (q31_t) ((((q63_t) acc << 32) + ((q63_t) a2 * (Yn1))) >> 32);
 
       /* The result is converted to 1.31, Yn1 variable is reused  */
+      ARM_SAT_STATS_Q31(S, (q63_t) acc << shift);
       Yn1 = acc << shift;
 
       /* Read the third input  */
@@ -173,6 +175,7 @@ void arm_biquad_cascade_df1_fast_q31(
       acc = (q31_t) ((((q63_t) acc << 32) + ((q63_t) a2 * (Yn2))) >> 32);
 
       /* The result is converted to 1.31, Yn2 variable is reused  */
+      ARM_SAT_STATS_Q31(S, (q63_t) acc << shift);
       Yn2 = acc << shift;
 
       /* Read the forth input */
@@ -200,6 +203,7 @@ void arm_biquad_cascade_df1_fast_q31(
       Xn2 = Xn1;
 
       /* The result is converted to 1.31, Yn1 variable is reused  */
+      ARM_SAT_STATS_Q31(S, (q63_t) acc << shift);
       Yn1 = acc << shift;
 
       /* Xn1 = Xn     */
@@ -234,6 +238,7 @@ void arm_biquad_cascade_df1_fast_q31(
       /* acc +=  a2 * y[n-2] */
       acc = (q31_t) ((((q63_t) acc << 32) + ((q63_t) a2 * (Yn2))) >> 32);
       /* The result is converted to 1.31  */
+      ARM_SAT_STATS_Q31(S, (q63_t) acc << shift);
       acc = acc << shift;
 
       /* Every time after the output is computed state should be updated. */
@@ -102,6 +102,9 @@ void arm_biquad_cascade_df1_init_q31(
 
   /* Assign state pointer */
   S->pState = pState;
+
+  /* Clear the saturation statistics */
+  ARM_SAT_STATS_RESET(S);
 }
 
 /**    
@@ -148,6 +148,7 @@ void arm_biquad_cascade_df1_q15(
       /* Apply shift for lower part of acc and upper part of acc */
       out = (uint32_t) acc_l >> lShift | acc_h << uShift;
 
+      ARM_SAT_STATS_Q15(S, acc >> lShift);
       out = __SSAT(out, 16);
 
       /* Every time after the output is computed state should be updated. */
@@ -188,6 +189,7 @@ void arm_biquad_cascade_df1_q15(
       /* Apply shift for lower part of acc and upper part of acc */
       out = (uint32_t) acc_l >> lShift | acc_h << uShift;
 
+      ARM_SAT_STATS_Q15(S, acc >> lShift);
       out = __SSAT(out, 16);
 
       /* Store the output in the destination buffer. */
@@ -263,6 +265,7 @@ void arm_biquad_cascade_df1_q15(
       /* Apply shift for lower part of acc and upper part of acc */
       out = (uint32_t) acc_l >> lShift | acc_h << uShift;
 
+      ARM_SAT_STATS_Q15(S, acc >> lShift);
       out = __SSAT(out, 16);
 
       /* Store the output in the destination buffer. */
@@ -363,6 +366,7 @@ void arm_biquad_cascade_df1_q15(
       acc += (q31_t) a2 *Yn2;
 
       /* The result is converted to 1.31  */
+      ARM_SAT_STATS_Q15(S, acc >> shift);
       acc = __SSAT((acc >> shift), 16);
 
       /* Every time after the output is computed state should be updated. */
@@ -146,6 +146,7 @@ void arm_biquad_cascade_df1_q31(
       acc_h = (acc >> 32) & 0xffffffff;
 
       /* Apply shift for lower part of acc and upper part of acc */
+      ARM_SAT_STATS_Q31(S, acc >> lShift);
       Yn2 = (uint32_t) acc_l >> lShift | acc_h << uShift;
 
       /* Store the output in the destination buffer. */
@@ -178,6 +179,7 @@ void arm_biquad_cascade_df1_q31(
 
 
       /* Apply shift for lower part of acc and upper part of acc */
+      ARM_SAT_STATS_Q31(S, acc >> lShift);
       Yn1 = (uint32_t) acc_l >> lShift | acc_h << uShift;
 
       /* Store the output in the destination buffer. */
@@ -208,6 +210,7 @@ void arm_biquad_cascade_df1_q31(
 
 
       /* Apply shift for lower part of acc and upper part of acc */
+      ARM_SAT_STATS_Q31(S, acc >> lShift);
       Yn2 = (uint32_t) acc_l >> lShift | acc_h << uShift;
 
       /* Store the output in the destination buffer. */
@@ -237,6 +240,7 @@ void arm_biquad_cascade_df1_q31(
       acc_h = (acc >> 32) & 0xffffffff;
 
       /* Apply shift for lower part of acc and upper part of acc */
+      ARM_SAT_STATS_Q31(S, acc >> lShift);
       Yn1 = (uint32_t) acc_l >> lShift | acc_h << uShift;
 
       /* Every time after the output is computed state should be updated. */
@@ -280,6 +284,8 @@ void arm_biquad_cascade_df1_q31(
       /* The result is converted to 1.31  */
       acc = acc >> lShift;
 
+      ARM_SAT_STATS_Q31(S, acc);
+
       /* Every time after the output is computed state should be updated. */
       /* The states should be updated as:  */
       /* Xn2 = Xn1    */
@@ -359,6 +365,8 @@ void arm_biquad_cascade_df1_q31(
       /* The result is converted to 1.31  */
       acc = acc >> lShift;
 
+      ARM_SAT_STATS_Q31(S, acc);
+
       /* Every time after the output is computed state should be updated. */
       /* The states should be updated as:  */
       /* Xn2 = Xn1    */
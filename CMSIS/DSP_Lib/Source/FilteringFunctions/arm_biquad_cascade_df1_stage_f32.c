@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_stage_f32.c
+*
+* Description:	Staging of the floating-point Biquad cascade filter in fast RAM.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Copies the coefficients and the state of the floating-point Biquad cascade filter into a RAM arena.
+ * @param[in,out] *S  points to an instance of the floating-point Biquad cascade filter structure.
+ * @param[in,out] *A  points to an instance of the RAM arena structure.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when
+ * the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The <code>5*numStages</code> coefficients and the <code>4*numStages</code> state
+ * variables are copied into the arena, which should be in a RAM with no wait state such as
+ * the CCM data RAM, and <code>S->pCoeffs</code> and <code>S->pState</code> are rebound to
+ * the copies. When the arena is too small, it is left as it was and the instance is not
+ * modified.
+ */
+
+arm_status arm_biquad_cascade_df1_stage_f32(
+  arm_biquad_casd_df1_inst_f32 * S,
+  arm_ram_arena_instance * A)
+{
+  float32_t *pCoeffs, *pState;                   /* Copies of the coefficients and of the state */
+  uint32_t numStages = (uint32_t) S->numStages;  /* Number of stages */
+  uint32_t used = A->used;                       /* Arena allocation before staging */
+
+  pCoeffs = (float32_t *) arm_ram_arena_stage(A, S->pCoeffs, (5u * numStages) * sizeof(float32_t));
+  pState = (float32_t *) arm_ram_arena_stage(A, S->pState, (4u * numStages) * sizeof(float32_t));
+
+  if((pCoeffs == NULL) || (pState == NULL))
+  {
+    /* Release the copies */
+    A->used = used;
+
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_stereo_init_q15.c
+*
+* Description:	Q15 stereo Biquad cascade DirectFormI(DF1) filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Biquad cascade filter on interleaved stereo data.
+ * @param[in,out] *S           points to an instance of the Q15 stereo Biquad cascade structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs     points to the filter coefficients, shared by both channels.
+ * @param[in]     *pState      points to the state buffer.
+ * @param[in]     postShift    Shift to be applied to the accumulator result. Varies according to the coefficients format
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are ordered as for arm_biquad_cascade_df1_init_q15(), with the zero
+ * coefficient after <code>b0</code>, a total of <code>6*numStages</code> values.
+ * Each stage has 8 state variables arranged as
+ * <pre>
+ *     {xL[n-1], xL[n-2], xR[n-1], xR[n-2], yL[n-1], yL[n-2], yR[n-1], yR[n-2]}
+ * </pre>
+ * and the state array has a total length of <code>8*numStages</code> values.
+ * The state buffer is cleared.
+ */
+
+void arm_biquad_cascade_df1_stereo_init_q15(
+  arm_biquad_casd_df1_stereo_inst_q15 * S,
+  uint8_t numStages,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  int8_t postShift)
+{
+  /* Assign filter stages */
+  S->numStages = numStages;
+
+  /* Assign postShift to be applied to the output */
+  S->postShift = postShift;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 8 * numStages */
+  memset(pState, 0, (8u * (uint32_t) numStages) * sizeof(q15_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,272 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df1_stereo_q15.c
+*
+* Description:	Processing function for the Q15 Biquad cascade DirectFormI(DF1)
+*               filter on interleaved stereo data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Biquad cascade filter on interleaved stereo data.
+ * @param[in]  *S points to an instance of the Q15 stereo Biquad cascade structure.
+ * @param[in]  *pSrc points to the block of interleaved stereo input data.
+ * @param[out] *pDst points to the block of interleaved stereo output data.
+ * @param[in]  blockSize number of stereo frames to process per call.
+ * @return none.
+ *
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> frames
+ * {left, right}. Both channels are filtered by the same coefficients, each with its own
+ * state variables. On Cortex-M3 and Cortex-M4 a frame is read and written as one 32-bit
+ * word and each stage keeps its coefficients and the packed states of both channels in
+ * registers: <code>__SMUAD</code> and <code>__SMUADX</code> pick the left or the right
+ * sample of the frame for the b0 term, and <code>__SMLALD</code> computes the two
+ * feedforward and the two feedback terms of each channel.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Same as arm_biquad_cascade_df1_q15(): the 2.30 products are accumulated in a 64-bit
+ * accumulator in 34.30 format, shifted by <code>postShift</code> to 1.15 format and saturated.
+ */
+
+void arm_biquad_cascade_df1_stereo_q15(
+  const arm_biquad_casd_df1_stereo_inst_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pOut = pDst;                            /*  Destination pointer                          */
+  q31_t in;                                      /*  Input frame, left and right samples          */
+  q31_t outL, outR;                              /*  Output values of the left and right channel  */
+  q31_t b0;                                      /*  Temporary variable to hold bo value          */
+  q31_t b1, a1;                                  /*  Filter coefficients                          */
+  q31_t inL, inR, stOutL, stOutR;                /*  Packed state variables of the two channels   */
+  q31_t acc_l, acc_h;
+  q63_t acc;                                     /*  Accumulator                                  */
+  int32_t lShift = (15 - (int32_t) S->postShift);       /*  Post shift                                   */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  uint32_t sample, stage = (uint32_t) S->numStages;     /*  Stage loop counter                           */
+  int32_t uShift = (32 - lShift);
+
+  do
+  {
+    /* Read the b0 and 0 coefficients using SIMD  */
+    b0 = *__SIMD32(pCoeffs)++;
+
+    /* Read the b1 and b2 coefficients using SIMD */
+    b1 = *__SIMD32(pCoeffs)++;
+
+    /* Read the a1 and a2 coefficients using SIMD */
+    a1 = *__SIMD32(pCoeffs)++;
+
+    /* Read the state values of both channels:  x[n-1], x[n-2], then y[n-1], y[n-2] */
+    inL = *__SIMD32(pState);
+    inR = *(__SIMD32(pState) + 1);
+    stOutL = *(__SIMD32(pState) + 2);
+    stOutR = *(__SIMD32(pState) + 3);
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the left and right samples of the frame */
+      in = *__SIMD32(pIn)++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      /* Left channel:  b0 * left + 0 * right */
+      acc = __SMLALD(b1, inL, __SMUAD(b0, in));
+      acc = __SMLALD(a1, stOutL, acc);
+
+      /* The result is converted from 34.30 to 1.15 format and saturated */
+      acc_l = acc & 0xffffffff;
+      acc_h = (acc >> 32) & 0xffffffff;
+      outL = (uint32_t) acc_l >> lShift | acc_h << uShift;
+      outL = __SSAT(outL, 16);
+
+      /* Right channel:  b0 * right + 0 * left */
+      acc = __SMLALD(b1, inR, __SMUADX(b0, in));
+      acc = __SMLALD(a1, stOutR, acc);
+
+      acc_l = acc & 0xffffffff;
+      acc_h = (acc >> 32) & 0xffffffff;
+      outR = (uint32_t) acc_l >> lShift | acc_h << uShift;
+      outR = __SSAT(outR, 16);
+
+      /* Every time after the output is computed state should be updated. */
+      /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc, for each channel */
+
+#ifndef  ARM_MATH_BIG_ENDIAN
+
+      inL = __PKHBT(in, inL, 16);
+      inR = __PKHBT(in >> 16, inR, 16);
+      stOutL = __PKHBT(outL, stOutL, 16);
+      stOutR = __PKHBT(outR, stOutR, 16);
+
+      /* Store the output frame in the destination buffer. */
+      *__SIMD32(pOut)++ = __PKHBT(outL, outR, 16);
+
+#else
+
+      inL = __PKHBT(inL >> 16, in >> 16, 16);
+      inR = __PKHBT(inR >> 16, in, 16);
+      stOutL = __PKHBT(stOutL >> 16, outL, 16);
+      stOutR = __PKHBT(stOutR >> 16, outR, 16);
+
+      /* Store the output frame in the destination buffer. */
+      *__SIMD32(pOut)++ = __PKHBT(outR, outL, 16);
+
+#endif /*      #ifndef  ARM_MATH_BIG_ENDIAN    */
+
+      /* Decrement the loop counter */
+      sample--;
+    }
+
+    /*  The first stage goes from the input wire to the output wire.  */
+    /*  Subsequent numStages occur in-place in the output wire  */
+    pIn = pDst;
+
+    /* Reset the output pointer */
+    pOut = pDst;
+
+    /*  Store the updated state variables back into the state array */
+    *__SIMD32(pState)++ = inL;
+    *__SIMD32(pState)++ = inR;
+    *__SIMD32(pState)++ = stOutL;
+    *__SIMD32(pState)++ = stOutR;
+
+    /* Decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q15_t *pIn = pSrc;                             /*  Source pointer                               */
+  q15_t *pOut = pDst;                            /*  Destination pointer                          */
+  q15_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q15_t XL1, XL2, YL1, YL2;                      /*  Left channel state variables  */
+  q15_t XR1, XR2, YR1, YR2;                      /*  Right channel state variables */
+  q15_t XL, XR;                                  /*  temporary inputs              */
+  q63_t accL, accR;                              /*  Accumulators                                 */
+  int32_t shift = (15 - (int32_t) S->postShift); /*  Post shift                                   */
+  q15_t *pState = S->pState;                     /*  State pointer                                */
+  q15_t *pCoeffs = S->pCoeffs;                   /*  Coefficient pointer                          */
+  uint32_t sample, stage = (uint32_t) S->numStages;     /*  Stage loop counter                           */
+
+  do
+  {
+    /* Reading the coefficients, skipping the 0 after b0 */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[2];
+    b2 = pCoeffs[3];
+    a1 = pCoeffs[4];
+    a2 = pCoeffs[5];
+    pCoeffs += 6u;
+
+    /* Reading the state values */
+    XL1 = pState[0];
+    XL2 = pState[1];
+    XR1 = pState[2];
+    XR2 = pState[3];
+    YL1 = pState[4];
+    YL2 = pState[5];
+    YR1 = pState[6];
+    YR2 = pState[7];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the input frame */
+      XL = *pIn++;
+      XR = *pIn++;
+
+      /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+      accL = (q31_t) b0 *XL;
+      accR = (q31_t) b0 *XR;
+      accL += (q31_t) b1 *XL1;
+      accR += (q31_t) b1 *XR1;
+      accL += (q31_t) b2 *XL2;
+      accR += (q31_t) b2 *XR2;
+      accL += (q31_t) a1 *YL1;
+      accR += (q31_t) a1 *YR1;
+      accL += (q31_t) a2 *YL2;
+      accR += (q31_t) a2 *YR2;
+
+      /* The results are converted to 1.15 format and saturated */
+      accL = __SSAT((accL >> shift), 16);
+      accR = __SSAT((accR >> shift), 16);
+
+      /* Every time after the output is computed state should be updated. */
+      XL2 = XL1;
+      XL1 = XL;
+      XR2 = XR1;
+      XR1 = XR;
+      YL2 = YL1;
+      YL1 = (q15_t) accL;
+      YR2 = YR1;
+      YR1 = (q15_t) accR;
+
+      /* Store the output frame in the destination buffer. */
+      *pOut++ = (q15_t) accL;
+      *pOut++ = (q15_t) accR;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pIn = pDst;
+
+    /* Reset to destination pointer */
+    pOut = pDst;
+
+    /*  Store the updated state variables back into the pState array */
+    *pState++ = XL1;
+    *pState++ = XL2;
+    *pState++ = XR1;
+    *pState++ = XR2;
+    *pState++ = YL1;
+    *pState++ = YL2;
+    *pState++ = YR1;
+    *pState++ = YR2;
+
+  } while(--stage);
+
+#endif /*     #ifndef ARM_MATH_CM0 */
+
+}
+
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_multichannel_f32.c
+*
+* Description:	Processing function for the floating-point transposed
+*               direct form II Biquad cascade filter on interleaved channels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter on interleaved channels.
+ * @param[in]  *S        points to an instance of the multichannel filter data structure.
+ * @param[in]  *pSrc     points to the block of interleaved input data.
+ * @param[out] *pDst     points to the block of interleaved output data, which may be the input block.
+ * @param[in]  blockSize number of samples to process per channel.
+ * @return none.
+ *
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> frames of
+ * <code>numChannels</code> samples, {x0[0], x1[0], ..., x0[1], x1[1], ...}. All the channels
+ * are filtered by the same coefficients, each with its own state variables. Each stage
+ * loads its coefficients once for all the channels and runs through the frames with a
+ * stride of <code>numChannels</code>, so no deinterleaving copy is needed. On Cortex-M3
+ * and Cortex-M4 two channels are filtered at a time, their independent recursions
+ * hiding each other's latency.
+ */
+
+void arm_biquad_cascade_df2T_multichannel_f32(
+  const arm_biquad_cascade_df2T_multichannel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *px, *pOut;                          /*  channel pointers          */
+  float32_t *pState;                             /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t acc0;                                /*  accumulator               */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn;                                  /*  temporary input           */
+  float32_t d1, d2;                              /*  state variables           */
+  uint32_t numChannels = S->numChannels;         /*  number of channels        */
+  uint32_t stateStride = 2u * S->numStages;      /*  state values per channel  */
+  uint32_t sample, chan, stage;                  /*  loop counters             */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *pOut1;                              /*  second channel pointer    */
+  float32_t Xn1, acc1;                           /*  second channel values     */
+  float32_t d11, d21;                            /*  second channel states     */
+
+#endif /*  #ifndef ARM_MATH_CM0         */
+
+  for (stage = 0u; stage < S->numStages; stage++)
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /* State variables of this stage in the first channel */
+    pState = S->pState + (2u * stage);
+
+    chan = 0u;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Two channels at a time */
+    while((chan + 1u) < numChannels)
+    {
+      d1 = pState[0];
+      d2 = pState[1];
+      d11 = pState[stateStride];
+      d21 = pState[stateStride + 1u];
+
+      px = pIn + chan;
+      pOut = pDst + chan;
+      pOut1 = pOut + 1u;
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the inputs of both channels */
+        Xn = px[0];
+        Xn1 = px[1];
+        px += numChannels;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc0 = (b0 * Xn) + d1;
+        acc1 = (b0 * Xn1) + d11;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn) + (a1 * acc0)) + d2;
+        d11 = ((b1 * Xn1) + (a1 * acc1)) + d21;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn) + (a2 * acc0);
+        d21 = (b2 * Xn1) + (a2 * acc1);
+
+        /* Store the results in the destination buffer. */
+        *pOut = acc0;
+        *pOut1 = acc1;
+        pOut += numChannels;
+        pOut1 += numChannels;
+
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state arrays */
+      pState[0] = d1;
+      pState[1] = d2;
+      pState[stateStride] = d11;
+      pState[stateStride + 1u] = d21;
+
+      pState += 2u * stateStride;
+      chan += 2u;
+    }
+
+#endif /*  #ifndef ARM_MATH_CM0         */
+
+    /* One channel at a time */
+    while(chan < numChannels)
+    {
+      d1 = pState[0];
+      d2 = pState[1];
+
+      px = pIn + chan;
+      pOut = pDst + chan;
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *px;
+        px += numChannels;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc0 = (b0 * Xn) + d1;
+
+        /* Store the result in the destination buffer. */
+        *pOut = acc0;
+        pOut += numChannels;
+
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn) + (a1 * acc0)) + d2;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn) + (a2 * acc0);
+
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[0] = d1;
+      pState[1] = d2;
+
+      pState += stateStride;
+      chan++;
+    }
+
+    /* The current stage output is the input of the next stage */
+    pIn = pDst;
+  }
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_multichannel_init_f32.c
+*
+* Description:	Initialization function for the floating-point transposed
+*               direct form II Biquad cascade filter on interleaved channels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter on interleaved channels.
+ * @param[in,out] *S            points to an instance of the multichannel filter data structure.
+ * @param[in]     numStages     number of 2nd order stages in the filter.
+ * @param[in]     numChannels   number of interleaved channels.
+ * @param[in]     *pCoeffs      points to the filter coefficients, shared by all the channels.
+ * @param[in]     *pState       points to the state buffer.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are ordered as for arm_biquad_cascade_df2T_init_f32(), a total of
+ * <code>5*numStages</code> values. Each channel has its own state array of
+ * <code>2*numStages</code> values ordered as for the single channel filter, and the arrays
+ * of the channels follow each other: <code>pState</code> has a total length of
+ * <code>2*numStages*numChannels</code> values. The state buffer is cleared.
+ */
+
+void arm_biquad_cascade_df2T_multichannel_init_f32(
+  arm_biquad_cascade_df2T_multichannel_instance_f32 * S,
+  uint8_t numStages,
+  uint8_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2u * (uint32_t) numStages * numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
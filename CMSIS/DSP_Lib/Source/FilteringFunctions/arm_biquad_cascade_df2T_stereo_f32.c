@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_stereo_f32.c
+*
+* Description:	Processing function for the floating-point transposed
+*               direct form II Biquad cascade filter on interleaved stereo data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter on interleaved stereo data.
+ * @param[in]  *S        points to an instance of the stereo filter data structure.
+ * @param[in]  *pSrc     points to the block of interleaved stereo input data.
+ * @param[out] *pDst     points to the block of interleaved stereo output data.
+ * @param[in]  blockSize number of stereo frames to process.
+ * @return none.
+ *
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> frames
+ * {left, right}. Both channels are filtered by the same coefficients. Each stage keeps
+ * its 5 coefficients and the 4 state variables of the two channels in registers for the
+ * whole block, and the two independent recursions are interleaved so that each hides
+ * the latency of the other.
+ */
+
+void arm_biquad_cascade_df2T_stereo_f32(
+  const arm_biquad_cascade_df2T_stereo_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pOut = pDst;                        /*  destination pointer       */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t accL, accR;                          /*  accumulators              */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t XnL, XnR;                            /*  temporary inputs          */
+  float32_t d1L, d2L, d1R, d2R;                  /*  state variables           */
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    /*Reading the state values */
+    d1L = pState[0];
+    d2L = pState[1];
+    d1R = pState[2];
+    d2R = pState[3];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Read the input frame */
+      XnL = *pIn++;
+      XnR = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      accL = (b0 * XnL) + d1L;
+      accR = (b0 * XnR) + d1R;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1L = ((b1 * XnL) + (a1 * accL)) + d2L;
+      d1R = ((b1 * XnR) + (a1 * accR)) + d2R;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2L = (b2 * XnL) + (a2 * accL);
+      d2R = (b2 * XnR) + (a2 * accR);
+
+      /* Store the output frame in the destination buffer. */
+      *pOut++ = accL;
+      *pOut++ = accR;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1L;
+    *pState++ = d2L;
+    *pState++ = d1R;
+    *pState++ = d2R;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /*Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_stereo_init_f32.c
+*
+* Description:	Initialization function for the floating-point transposed
+*               direct form II Biquad cascade filter on interleaved stereo data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter on interleaved stereo data.
+ * @param[in,out] *S           points to an instance of the stereo filter data structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs     points to the filter coefficients, shared by both channels.
+ * @param[in]     *pState      points to the state buffer.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are ordered as for arm_biquad_cascade_df2T_init_f32(), a total of
+ * <code>5*numStages</code> values. Each stage has 4 state variables arranged as
+ * <pre>
+ *     {d1 left, d2 left, d1 right, d2 right}
+ * </pre>
+ * and the state array has a total length of <code>4*numStages</code> values. The state
+ * buffer is cleared.
+ */
+
+void arm_biquad_cascade_df2T_stereo_init_f32(
+  arm_biquad_cascade_df2T_stereo_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  /* Assign filter stages */
+  S->numStages = numStages;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 4 * numStages */
+  memset(pState, 0, (4u * (uint32_t) numStages) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_tv_f32.c
+*
+* Description:	Processing function for the floating-point time-varying
+*               transposed direct form II Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point time-varying transposed direct form II Biquad cascade filter.
+ * @param[in,out] *S        points to an instance of the time-varying filter data structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ *
+ * \par Coefficient interpolation:
+ * \par
+ * Swapping <code>pCoeffs</code> between two blocks steps the response of the filter, heard
+ * as zipper noise when a gain or a frequency moves. Here the application writes the new
+ * coefficients in <code>pTarget</code>, e.g. with arm_biquad_design_f32(), and each stage
+ * moves linearly from <code>pCoeffs</code> to <code>pTarget</code> across the block: every
+ * sample adds the 5 increments before the difference equation. At the end of the block the
+ * targets are copied into <code>pCoeffs</code>, so a block without a new target runs at the
+ * cost of arm_biquad_cascade_df2T_f32() plus the 5 additions per sample and stage.
+ *
+ * \par
+ * The intermediate coefficients are not checked for stability: between two stable
+ * responses of close parameters, as the blocks of a control ramp give, they stay stable.
+ */
+
+void arm_biquad_cascade_df2T_tv_f32(
+  const arm_biquad_cascade_df2T_tv_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /*  source pointer            */
+  float32_t *pOut = pDst;                        /*  destination pointer       */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t *pTarget = S->pTarget;               /*  target pointer            */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t db0, db1, db2, da1, da2;             /*  Per sample increments     */
+  float32_t Xn, acc0, d1, d2, inv;
+  uint32_t sample, stage = S->numStages;         /*  loop counters             */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+  inv = 1.0f / (float32_t) blockSize;
+
+  do
+  {
+    /* Reading the coefficients and their increments */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    db0 = (pTarget[0] - b0) * inv;
+    db1 = (pTarget[1] - b1) * inv;
+    db2 = (pTarget[2] - b2) * inv;
+    da1 = (pTarget[3] - a1) * inv;
+    da2 = (pTarget[4] - a2) * inv;
+
+    /*Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+    while(sample > 0u)
+    {
+      /* Coefficients of this sample */
+      b0 += db0;
+      b1 += db1;
+      b2 += db2;
+      a1 += da1;
+      a2 += da2;
+
+      /* Read the input */
+      Xn = *pIn++;
+
+      /* y[n] = b0 * x[n] + d1 */
+      acc0 = (b0 * Xn) + d1;
+
+      /* Store the result in the accumulator in the destination buffer. */
+      *pOut++ = acc0;
+
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      d1 = ((b1 * Xn) + (a1 * acc0)) + d2;
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2 = (b2 * Xn) + (a2 * acc0);
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The targets are reached, without the rounding of the increments */
+    memcpy(pCoeffs, pTarget, 5u * sizeof(float32_t));
+    pCoeffs += 5u;
+    pTarget += 5u;
+
+    /*The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /*Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
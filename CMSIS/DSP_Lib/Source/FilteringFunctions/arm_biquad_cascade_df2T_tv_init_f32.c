@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_cascade_df2T_tv_init_f32.c
+*
+* Description:	Initialization function for the floating-point time-varying
+*               transposed direct form II Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point time-varying transposed direct form II Biquad cascade filter.
+ * @param[in,out] *S           points to an instance of the time-varying filter data structure.
+ * @param[in]     numStages    number of 2nd order stages in the filter.
+ * @param[in]     *pCoeffs     points to the initial filter coefficients, updated by the processing function.
+ * @param[in]     *pTarget     points to the target coefficients, receiving a copy of the initial ones.
+ * @param[in]     *pState      points to the state buffer.
+ * @return        none
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * Both coefficient arrays are ordered as for arm_biquad_cascade_df2T_init_f32(), a total of
+ * <code>5*numStages</code> values each, and the state array holds <code>2*numStages</code>
+ * values, cleared. The filter starts with no pending change: the targets are a copy of the
+ * initial coefficients.
+ */
+
+void arm_biquad_cascade_df2T_tv_init_f32(
+  arm_biquad_cascade_df2T_tv_instance_f32 * S,
+  uint8_t numStages,
+  float32_t * pCoeffs,
+  float32_t * pTarget,
+  float32_t * pState)
+{
+  /* Assign filter stages */
+  S->numStages = numStages;
+
+  /* Assign coefficient pointers, no change pending */
+  S->pCoeffs = pCoeffs;
+  S->pTarget = pTarget;
+  memcpy(pTarget, pCoeffs, (5u * (uint32_t) numStages) * sizeof(float32_t));
+
+  /* Clear state buffer and size is always 2 * numStages */
+  memset(pState, 0, (2u * (uint32_t) numStages) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
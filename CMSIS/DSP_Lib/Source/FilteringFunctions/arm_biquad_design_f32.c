@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_biquad_design_f32.c
+*
+* Description:	Floating-point Biquad coefficient design for equalizers
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Coefficients of a Biquad stage from its response parameters, without trigonometric or power function calls.
+ * @param[in]  type     response type.
+ * @param[in]  freq     center or cutoff frequency divided by the sample rate, 0 < freq < 0.5.
+ * @param[in]  q        quality factor, or shelf slope, above 0.
+ * @param[in]  gainDb   gain of the peaking and shelf responses in dB, -48 to 48.
+ * @param[out] *pCoeffs points to the 5 coefficients <code>{b0, b1, b2, a1, a2}</code> of the stage.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for a parameter out of range.
+ *
+ * \par
+ * The coefficients follow the audio EQ cookbook (R. Bristow-Johnson), normalized by
+ * <code>a0</code>, with the feedback coefficients negated for the CMSIS difference
+ * equation. <code>sin(w0)</code> and <code>cos(w0)</code> are interpolated linearly in the
+ * 4096 point table of the CFFT twiddle factors (error below 3e-7), or computed by
+ * arm_sin_f32() and arm_cos_f32() when ARM_MATH_MAX_FFT_LEN trims that table, and the shelf and
+ * peaking amplitude <code>A = 10^(gainDb/40)</code> comes from arm_vexp_f32(): a design
+ * costs a few tens of operations, cheap enough to follow a control every block, the
+ * coefficients going to the <code>pTarget</code> of arm_biquad_cascade_df2T_tv_f32().
+ */
+
+arm_status arm_biquad_design_f32(
+  arm_biquad_type type,
+  float32_t freq,
+  float32_t q,
+  float32_t gainDb,
+  float32_t * pCoeffs)
+{
+  float32_t idx, sn, cs, alpha, A, sqrtA, inv;
+  float32_t b0, b1, b2, a0, a1, a2;
+  float32_t ln[2], amp[2];
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
+  float32_t frac;
+  uint32_t k;
+#endif
+
+  if((freq <= 0.0f) || (freq >= 0.5f) || (q <= 0.0f) ||
+     (gainDb < -48.0f) || (gainDb > 48.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
+  /* sin and cos of w0 = 2 pi freq, from the table of cos/sin(2 pi i / 4096) */
+  idx = freq * 4096.0f;
+  k = (uint32_t) idx;
+  frac = idx - (float32_t) k;
+  cs = twiddleCoef[2u * k] + (frac * (twiddleCoef[(2u * k) + 2u] - twiddleCoef[2u * k]));
+  sn = twiddleCoef[(2u * k) + 1u] +
+    (frac * (twiddleCoef[(2u * k) + 3u] - twiddleCoef[(2u * k) + 1u]));
+#else
+  /* The table of the CFFT twiddles is too coarse below 4096 points */
+  idx = freq * 6.283185307f;
+  cs = arm_cos_f32(idx);
+  sn = arm_sin_f32(idx);
+#endif
+
+  alpha = sn / (2.0f * q);
+
+  /* A = 10^(gainDb/40) and its square root */
+  ln[0] = gainDb * (2.302585093f / 40.0f);
+  ln[1] = gainDb * (2.302585093f / 80.0f);
+  arm_vexp_f32(ln, amp, 2u);
+  A = amp[0];
+  sqrtA = amp[1];
+
+  switch (type)
+  {
+  case ARM_BIQUAD_LOWPASS:
+    b1 = 1.0f - cs;
+    b0 = 0.5f * b1;
+    b2 = b0;
+    a0 = 1.0f + alpha;
+    a1 = -2.0f * cs;
+    a2 = 1.0f - alpha;
+    break;
+
+  case ARM_BIQUAD_HIGHPASS:
+    b1 = -(1.0f + cs);
+    b0 = -0.5f * b1;
+    b2 = b0;
+    a0 = 1.0f + alpha;
+    a1 = -2.0f * cs;
+    a2 = 1.0f - alpha;
+    break;
+
+  case ARM_BIQUAD_PEAKING:
+    b0 = 1.0f + (alpha * A);
+    b1 = -2.0f * cs;
+    b2 = 1.0f - (alpha * A);
+    a0 = 1.0f + (alpha / A);
+    a1 = -2.0f * cs;
+    a2 = 1.0f - (alpha / A);
+    break;
+
+  case ARM_BIQUAD_LOWSHELF:
+    b0 = A * (((A + 1.0f) - ((A - 1.0f) * cs)) + (2.0f * sqrtA * alpha));
+    b1 = 2.0f * A * ((A - 1.0f) - ((A + 1.0f) * cs));
+    b2 = A * (((A + 1.0f) - ((A - 1.0f) * cs)) - (2.0f * sqrtA * alpha));
+    a0 = ((A + 1.0f) + ((A - 1.0f) * cs)) + (2.0f * sqrtA * alpha);
+    a1 = -2.0f * ((A - 1.0f) + ((A + 1.0f) * cs));
+    a2 = ((A + 1.0f) + ((A - 1.0f) * cs)) - (2.0f * sqrtA * alpha);
+    break;
+
+  case ARM_BIQUAD_HIGHSHELF:
+    b0 = A * (((A + 1.0f) + ((A - 1.0f) * cs)) + (2.0f * sqrtA * alpha));
+    b1 = -2.0f * A * ((A - 1.0f) + ((A + 1.0f) * cs));
+    b2 = A * (((A + 1.0f) + ((A - 1.0f) * cs)) - (2.0f * sqrtA * alpha));
+    a0 = ((A + 1.0f) - ((A - 1.0f) * cs)) + (2.0f * sqrtA * alpha);
+    a1 = 2.0f * ((A - 1.0f) - ((A + 1.0f) * cs));
+    a2 = ((A + 1.0f) - ((A - 1.0f) * cs)) - (2.0f * sqrtA * alpha);
+    break;
+
+  default:
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Normalized by a0, feedback coefficients negated */
+  inv = 1.0f / a0;
+  pCoeffs[0] = b0 * inv;
+  pCoeffs[1] = b1 * inv;
+  pCoeffs[2] = b2 * inv;
+  pCoeffs[3] = -a1 * inv;
+  pCoeffs[4] = -a2 * inv;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cic_compensation_f32.c
+*
+* Description:	Design of the FIR filter compensating the droop of a CIC decimator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Design of the floating-point FIR filter compensating the droop of a CIC decimator.
+ * @param[in]  numStages  order of the CIC filter.
+ * @param[in]  diffDelay  differential delay of the CIC filter.
+ * @param[in]  R          decimation factor of the CIC filter.
+ * @param[in]  cutoff     passband edge, normalized to the CIC output rate, below 0.5 and <code>1/diffDelay</code>.
+ * @param[in]  numTaps    number of filter coefficients.
+ * @param[out] *pCoeffs   points to the coefficient buffer of <code>numTaps</code> values.
+ * @return none.
+ *
+ * <b>Description:</b>
+ * \par
+ * The response of the CIC decimator at the frequency <code>f</code>, normalized to its output
+ * rate, is
+ * <pre>
+ *    |H(f)| = |sin(pi*D*f) / (R*D*sin(pi*D*f/R))|^N
+ * </pre>
+ * The coefficients approximate the linear phase filter of response <code>1/|H(f)|</code>
+ * up to <code>cutoff</code> and zero above, by numerical integration of its inverse
+ * Fourier transform, and are weighted by a Hamming window and scaled for a unit DC gain.
+ * A cutoff of <code>0.4/M</code> suits an FIR decimator by <code>M</code>.
+ *
+ * \par
+ * The filter is symmetric, so the coefficients are also in the time reversed order
+ * expected by arm_fir_decimate_init_f32(). Convert them with arm_float_to_q31() or
+ * arm_float_to_q15() for the fixed-point decimators, feeding them the CIC output.
+ * The design runs <code>8*numTaps*numTaps</code> cosine evaluations and is meant
+ * for initialization time.
+ */
+
+void arm_cic_compensation_f32(
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  float32_t cutoff,
+  uint16_t numTaps,
+  float32_t * pCoeffs)
+{
+  float32_t f, df;                               /* Frequency and integration step */
+  float32_t num, den;                            /* Numerator and denominator of the CIC response */
+  float32_t amp, ratio;                          /* Compensation amplitude */
+  float32_t t, sum;                              /* Time from the center and accumulator */
+  float32_t D = (float32_t) diffDelay;           /* Differential delay */
+  float32_t center = 0.5f * (float32_t) (numTaps - 1u);        /* Center of symmetry */
+  uint32_t numPoints = 8u * numTaps;             /* Number of integration intervals */
+  uint32_t i, n, k;                              /* Loop counters */
+
+  for (n = 0u; n < numTaps; n++)
+  {
+    pCoeffs[n] = 0.0f;
+  }
+
+  df = cutoff / (float32_t) numPoints;
+
+  for (i = 0u; i <= numPoints; i++)
+  {
+    f = (float32_t) i * df;
+
+    /* Compensation amplitude 1/|H(f)|, 1 at DC */
+    amp = 1.0f;
+
+    if(i > 0u)
+    {
+      num = sinf(PI * D * f);
+      den = (float32_t) R * D * sinf((PI * D * f) / (float32_t) R);
+
+      ratio = den / num;
+
+      for (k = 0u; k < numStages; k++)
+      {
+        amp *= ratio;
+      }
+    }
+
+    /* Trapezoidal rule, half weight at both ends */
+    if((i == 0u) || (i == numPoints))
+    {
+      amp *= 0.5f;
+    }
+
+    for (n = 0u; n < numTaps; n++)
+    {
+      t = (float32_t) n - center;
+      pCoeffs[n] += amp * cosf(2.0f * PI * f * t);
+    }
+  }
+
+  /* Hamming window and DC gain */
+  sum = 0.0f;
+
+  for (n = 0u; n < numTaps; n++)
+  {
+    if(numTaps > 1u)
+    {
+      pCoeffs[n] *=
+        0.54f - 0.46f * cosf((2.0f * PI * (float32_t) n) / (float32_t) (numTaps - 1u));
+    }
+
+    sum += pCoeffs[n];
+  }
+
+  for (n = 0u; n < numTaps; n++)
+  {
+    pCoeffs[n] /= sum;
+  }
+}
+
+/**
+ * @} end of CIC group
+ */
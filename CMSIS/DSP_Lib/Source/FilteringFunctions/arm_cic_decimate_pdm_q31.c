@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cic_decimate_pdm_q31.c
+*
+* Description:	CIC decimator converting 1-bit packed PDM input to Q31 PCM.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 CIC decimator on 1-bit packed PDM input.
+ * @param[in,out] *S        points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     *pSrc     points to the block of packed input bits, <code>blockSize/8</code> bytes.
+ * @param[out]    *pDst     points to the block of output data in 1.31 format.
+ * @param[in]     blockSize number of input bits to process per call, a multiple of <code>R</code> and of 8.
+ * @return none.
+ *
+ * \par
+ * The bits are read from the most significant bit of each byte, in the order they are
+ * shifted out by SPI and I2S peripherals. A set bit is fed to the integrators as
+ * <code>+1</code> and a cleared bit as <code>-1</code>, so that the unpacking costs a shift
+ * and an add per bit and no intermediate buffer is needed. The instance is initialized
+ * by arm_cic_decimate_init_q31() with <code>inputBits</code> set to 2.
+ *
+ * \par
+ * An output at full scale in 1.31 format corresponds to a stream of ones or zeros. The
+ * output is computed from the comb result shifted by <code>postShift+1</code> bits and
+ * saturated, so that a stream of ones gives <code>0x7FFFFFFF</code>.
+ */
+
+void arm_cic_decimate_pdm_q31(
+  const arm_cic_decimate_instance_q31 * S,
+  uint8_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t *pInt = (uint32_t *) S->pState;       /* Integrator states */
+  uint32_t *pComb;                               /* Comb delay line pointer */
+  uint32_t acc, in;                              /* Accumulator and comb input */
+  uint32_t bits = 0u;                            /* Input bits not yet processed, left aligned */
+  uint32_t bitCnt = 0u;                          /* Number of input bits left in bits */
+  uint32_t numStages = S->numStages;             /* Order of the filter */
+  uint32_t D = S->diffDelay;                     /* Differential delay */
+  uint32_t R = S->R;                             /* Decimation factor */
+  uint32_t k, d, i, blkCnt;                      /* Loop counters */
+
+  blkCnt = blockSize / R;
+
+  while(blkCnt > 0u)
+  {
+    /* Integrators at the bit rate, the last one is the downsampled value */
+    i = R;
+
+    do
+    {
+      /* Read the next byte when all the bits of the previous one are used */
+      if(bitCnt == 0u)
+      {
+        bits = (uint32_t) * pSrc++ << 24;
+        bitCnt = 8u;
+      }
+
+      /* Map the bit to +1 or -1 */
+      acc = ((bits >> 30) & 0x2u) - 1u;
+      bits <<= 1;
+      bitCnt--;
+
+      for (k = 0u; k < numStages; k++)
+      {
+        /* w[n] = w[n-1] + x[n] */
+        acc += pInt[k];
+        pInt[k] = acc;
+      }
+
+      i--;
+    } while(i > 0u);
+
+    /* Combs at the output rate */
+    pComb = pInt + numStages;
+
+    for (k = 0u; k < numStages; k++)
+    {
+      in = acc;
+
+      /* y[m] = x[m] - x[m-D] */
+      acc = in - pComb[D - 1u];
+
+      /* Shift the delay line of the comb */
+      for (d = D - 1u; d > 0u; d--)
+      {
+        pComb[d] = pComb[d - 1u];
+      }
+
+      pComb[0] = in;
+      pComb += D;
+    }
+
+    /* Normalize the output to 1.31 format, saturating the positive full scale */
+    *pDst++ = clip_q63_to_q31((q63_t) (q31_t) acc << (S->postShift + 1u));
+
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CIC group
+ */
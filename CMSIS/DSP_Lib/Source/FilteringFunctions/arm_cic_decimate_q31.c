@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cic_decimate_q31.c
+*
+* Description:	Cascaded integrator-comb (CIC) decimator with Q31 accumulators.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup CIC Cascaded Integrator-Comb (CIC) Filters
+ *
+ * CIC filters change the sample rate by a large integer factor <code>R</code> without
+ * multiplications. A decimator is a cascade of <code>N</code> integrators running at the
+ * input rate, followed by a downsampler and <code>N</code> combs running at the output rate:
+ * <pre>
+ *    integrator:  w[n] = w[n-1] + x[n]
+ *    comb:        y[m] = x[m] - x[m-D]
+ * </pre>
+ * where <code>N</code> is the order <code>numStages</code> and <code>D</code> the
+ * differential delay <code>diffDelay</code>, usually 1 or 2. The interpolator runs the combs
+ * first at the input rate, inserts <code>R-1</code> zeros after each sample and runs the
+ * integrators at the output rate. The cost is <code>N</code> additions per high rate sample
+ * and <code>N</code> subtractions per low rate sample, whatever the factor, where
+ * arm_fir_decimate_q15() would need a filter of several times <code>R</code> taps.
+ *
+ * \par
+ * The response of both filters is
+ * <pre>
+ *    H(z) = ((1 - z^(-R*D)) / (1 - z^(-1)))^N
+ * </pre>
+ * with a DC gain of <code>(R*D)^N</code> for the decimator and <code>(R*D)^N/R</code> for the
+ * interpolator. It droops across the passband and only attenuates the aliases near the
+ * multiples of the output rate, so a CIC decimator is normally followed by a short FIR
+ * decimator by 2 to 4, whose coefficients compensate the droop: see arm_cic_compensation_f32().
+ *
+ * \par
+ * The state array <code>pState</code> holds the <code>N</code> integrators followed by the
+ * <code>D</code> delayed values of each comb, <code>N*(D+1)</code> words in all.
+ *
+ * \par PDM to PCM conversion:
+ * arm_cic_decimate_pdm_q31() takes 1-bit packed input, as received by SPI or I2S DMA from a
+ * PDM microphone, and feeds each bit to the integrators as <code>+1</code> or <code>-1</code>.
+ * A decimation by 64 with <code>N=5</code> followed by a compensation FIR decimator by 2
+ * converts a 3.072 MHz stream to 24 kHz.
+ *
+ * \par Fixed-Point Behavior
+ * The integrators and combs use 32-bit two's complement arithmetic and wrap around on
+ * overflow, which the combs cancel: the output is exact provided it fits in 32 bits. The
+ * input samples are limited to <code>inputBits</code> significant bits, sign included,
+ * and the initialization function checks that <code>inputBits</code> plus the bit growth
+ * <code>ceil(log2(gain))</code> does not exceed 32. For example 16-bit samples allow a
+ * decimation by 16 with <code>N=4</code>. The output is shifted left by the remaining
+ * <code>postShift</code> bits so that an input at full scale gives an output at full scale in
+ * 1.31 format. When the gain is not a power of two, the output is smaller by the ratio of
+ * the gain to <code>2^ceil(log2(gain))</code>.
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 CIC decimator.
+ * @param[in,out] *S        points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     *pSrc     points to the block of input data, of at most <code>inputBits</code> significant bits.
+ * @param[out]    *pDst     points to the block of output data in 1.31 format.
+ * @param[in]     blockSize number of input samples to process per call, a multiple of <code>R</code>.
+ * @return none.
+ */
+
+void arm_cic_decimate_q31(
+  const arm_cic_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t *pInt = (uint32_t *) S->pState;       /* Integrator states */
+  uint32_t *pComb;                               /* Comb delay line pointer */
+  uint32_t acc, in;                              /* Accumulator and comb input */
+  uint32_t numStages = S->numStages;             /* Order of the filter */
+  uint32_t D = S->diffDelay;                     /* Differential delay */
+  uint32_t R = S->R;                             /* Decimation factor */
+  uint32_t k, d, i, blkCnt;                      /* Loop counters */
+
+  blkCnt = blockSize / R;
+
+  while(blkCnt > 0u)
+  {
+    /* Integrators at the input rate, the last one is the downsampled value */
+    i = R;
+
+    do
+    {
+      acc = (uint32_t) * pSrc++;
+
+      for (k = 0u; k < numStages; k++)
+      {
+        /* w[n] = w[n-1] + x[n] */
+        acc += pInt[k];
+        pInt[k] = acc;
+      }
+
+      i--;
+    } while(i > 0u);
+
+    /* Combs at the output rate */
+    pComb = pInt + numStages;
+
+    for (k = 0u; k < numStages; k++)
+    {
+      in = acc;
+
+      /* y[m] = x[m] - x[m-D] */
+      acc = in - pComb[D - 1u];
+
+      /* Shift the delay line of the comb */
+      for (d = D - 1u; d > 0u; d--)
+      {
+        pComb[d] = pComb[d - 1u];
+      }
+
+      pComb[0] = in;
+      pComb += D;
+    }
+
+    /* Normalize the output to 1.31 format */
+    *pDst++ = (q31_t) (acc << S->postShift);
+
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cic_interpolate_init_q31.c
+*
+* Description:	Initialization function for the Q31 CIC interpolator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 CIC interpolator.
+ * @param[in,out] *S         points to an instance of the Q31 CIC interpolator structure.
+ * @param[in]     numStages  order of the filter, the number of combs and of integrators.
+ * @param[in]     diffDelay  differential delay of the combs.
+ * @param[in]     R          interpolation factor.
+ * @param[in]     inputBits  number of significant bits of the input samples, sign included.
+ * @param[in]     *pState    points to the state buffer.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+ * ARM_MATH_ARGUMENT_ERROR if a parameter is zero or if the output would not fit in 32 bits.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to the array of state variables of length
+ * <code>numStages*(diffDelay+1)</code> words. The state buffer is cleared and
+ * <code>postShift</code> is set to <code>32-inputBits-ceil(log2((R*diffDelay)^numStages/R))</code>.
+ */
+
+arm_status arm_cic_interpolate_init_q31(
+  arm_cic_interpolate_instance_q31 * S,
+  uint8_t numStages,
+  uint8_t diffDelay,
+  uint16_t R,
+  uint8_t inputBits,
+  q31_t * pState)
+{
+  arm_status status;
+  q63_t gain = 1;                                /* DC gain of the filter */
+  uint32_t growth = 0u;                          /* Bit growth, ceil(log2(gain)) */
+  uint32_t k;                                    /* Loop counter */
+
+  if((numStages == 0u) || (diffDelay == 0u) || (R == 0u) || (inputBits == 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Gain (R*D)^N/R, stopping as soon as it exceeds 32 bits */
+    gain = (q63_t) diffDelay;
+
+    for (k = 1u; (k < numStages) && (gain <= 0x100000000LL); k++)
+    {
+      gain *= (q63_t) R *diffDelay;
+    }
+
+    while((growth < 33u) && (((q63_t) 1 << growth) < gain))
+    {
+      growth++;
+    }
+
+    if((growth + inputBits) > 32u)
+    {
+      /* The output would overflow the accumulators */
+      status = ARM_MATH_ARGUMENT_ERROR;
+    }
+    else
+    {
+      /* Assign the filter parameters */
+      S->numStages = numStages;
+      S->diffDelay = diffDelay;
+      S->R = R;
+      S->postShift = (uint8_t) (32u - inputBits - growth);
+
+      /* Clear the integrators and the comb delay lines */
+      memset(pState, 0,
+             (uint32_t) numStages * (diffDelay + 1u) * sizeof(q31_t));
+
+      /* Assign state pointer */
+      S->pState = pState;
+
+      status = ARM_MATH_SUCCESS;
+    }
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of CIC group
+ */
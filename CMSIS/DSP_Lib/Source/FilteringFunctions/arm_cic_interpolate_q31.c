@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cic_interpolate_q31.c
+*
+* Description:	Cascaded integrator-comb (CIC) interpolator with Q31 accumulators.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 CIC interpolator.
+ * @param[in,out] *S        points to an instance of the Q31 CIC interpolator structure.
+ * @param[in]     *pSrc     points to the block of input data, of at most <code>inputBits</code> significant bits.
+ * @param[out]    *pDst     points to the block of output data in 1.31 format, of <code>blockSize*R</code> samples.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return none.
+ */
+
+void arm_cic_interpolate_q31(
+  const arm_cic_interpolate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t *pInt = (uint32_t *) S->pState;       /* Integrator states */
+  uint32_t *pComb;                               /* Comb delay line pointer */
+  uint32_t acc, in;                              /* Accumulator and comb input */
+  uint32_t numStages = S->numStages;             /* Order of the filter */
+  uint32_t D = S->diffDelay;                     /* Differential delay */
+  uint32_t R = S->R;                             /* Interpolation factor */
+  uint32_t postShift = S->postShift;             /* Output normalization */
+  uint32_t k, d, i, blkCnt;                      /* Loop counters */
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Combs at the input rate */
+    acc = (uint32_t) * pSrc++;
+    pComb = pInt + numStages;
+
+    for (k = 0u; k < numStages; k++)
+    {
+      in = acc;
+
+      /* y[m] = x[m] - x[m-D] */
+      acc = in - pComb[D - 1u];
+
+      /* Shift the delay line of the comb */
+      for (d = D - 1u; d > 0u; d--)
+      {
+        pComb[d] = pComb[d - 1u];
+      }
+
+      pComb[0] = in;
+      pComb += D;
+    }
+
+    /* Integrators at the output rate, the comb output followed by R-1 zeros */
+    for (k = 0u; k < numStages; k++)
+    {
+      /* w[n] = w[n-1] + x[n] */
+      acc += pInt[k];
+      pInt[k] = acc;
+    }
+
+    *pDst++ = (q31_t) (acc << postShift);
+
+    i = R - 1u;
+
+    while(i > 0u)
+    {
+      /* The first integrator holds its value on the zero inputs */
+      acc = pInt[0];
+
+      for (k = 1u; k < numStages; k++)
+      {
+        acc += pInt[k];
+        pInt[k] = acc;
+      }
+
+      *pDst++ = (q31_t) (acc << postShift);
+
+      i--;
+    }
+
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CIC group
+ */
@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dynamics_f32.c
+*
+* Description:	Floating-point block dynamics processor: compressor,
+*               limiter and AGC with look-ahead.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Dynamics Dynamics Processors
+ *
+ * A compressor changes the gain of a signal from its level: with the level
+ * <code>L</code> and the threshold <code>T</code> in dB, the gain is
+ * <pre>
+ *     G = M - (1 - 1/ratio) * max(L - T, 0)
+ * </pre>
+ * where <code>M</code> is the makeup gain. An infinite ratio makes a limiter, the level
+ * staying at <code>T + M</code>; an infinite ratio with a positive makeup gain makes an
+ * automatic gain control, every level above <code>T</code> being brought to
+ * <code>T + M</code> and the lower levels amplified by at most <code>M</code>.
+ *
+ * \par Detector
+ * The level follows the absolute value of the input (peak detector) or its square (RMS
+ * detector), through a one-pole smoother whose coefficient is <code>attack</code> when
+ * the input is above the level and <code>release</code> otherwise. For a time constant of
+ * <code>tau</code> seconds at the rate <code>fs</code>, the coefficient is
+ * <code>1 - exp(-1/(tau*fs))</code>.
+ *
+ * \par Block processing
+ * The detector runs on every sample, with one multiply-accumulate. The gain is computed
+ * once per block, from the largest level of the block, in the logarithmic domain; from
+ * one block to the next it moves linearly across the samples, and a constant gain is
+ * applied by arm_scale_f32() or arm_scale_q31(). The logarithm and the exponential cost a
+ * few tens of cycles per block instead of per sample: arm_vlog_f32() and arm_vexp_f32()
+ * for floating-point, interpolated tables of <code>log2</code> and <code>2^x</code> in
+ * integer arithmetic for Q31.
+ *
+ * \par Look-ahead
+ * With a delay of <code>delay</code> samples, the output is the input delayed, through a
+ * circular delay line written and read by arm_circularWrite_f32() and
+ * arm_circularRead_f32(). The gain of a block reaches its value at the end of the block,
+ * so with a delay of at least the block size it is in place before the samples which set
+ * it: a limiter does not overshoot.
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point dynamics processor.
+ * @param[in,out] *S        points to an instance of the floating-point dynamics processor structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, which may be the input.
+ * @param[in]     blockSize number of samples to process, as given to arm_dynamics_init_f32().
+ * @return        none.
+ */
+
+void arm_dynamics_f32(
+  arm_dynamics_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Input pointer */
+  float32_t env = S->env;                        /* Detector state */
+  float32_t envMax;                              /* Largest level of the block */
+  float32_t in, level, gain, step;               /* Sample, log level, gain and its step */
+  int32_t readIndex;                             /* Read index of the delay line */
+  uint32_t delaySize = S->delay + blockSize;     /* Delay line length */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* Detector, one-pole smoother with attack and release */
+  envMax = 0.0f;
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pIn++;
+    in = (S->rmsFlag != 0u) ? (in * in) : ((in < 0.0f) ? -in : in);
+    env += ((in > env) ? S->attack : S->release) * (in - env);
+
+    if(env > envMax)
+    {
+      envMax = env;
+    }
+  }
+  S->env = env;
+
+  /* Gain in the log domain, G = M - slope * max(L - T, 0) */
+  arm_vlog_f32(&envMax, &level, 1u);
+  if(S->rmsFlag != 0u)
+  {
+    level *= 0.5f;
+  }
+
+  level -= S->thresh;
+  level = S->makeup - ((level > 0.0f) ? (S->slope * level) : 0.0f);
+  arm_vexp_f32(&level, &gain, 1u);
+
+  /* Look-ahead delay */
+  if(S->delay != 0u)
+  {
+    arm_circularWrite_f32((int32_t *) S->pDelay, (int32_t) delaySize, &S->delayIndex, 1,
+                          (int32_t *) pSrc, 1, blockSize);
+
+    readIndex = ((int32_t) S->delayIndex - (int32_t) blockSize) - (int32_t) S->delay;
+    if(readIndex < 0)
+    {
+      readIndex += (int32_t) delaySize;
+    }
+
+    arm_circularRead_f32((int32_t *) S->pDelay, (int32_t) delaySize, &readIndex, 1,
+                         (int32_t *) pDst, (int32_t *) pDst, (int32_t) blockSize, 1,
+                         blockSize);
+    pSrc = pDst;
+  }
+
+  if(gain == S->gain)
+  {
+    /* Steady gain */
+    arm_scale_f32(pSrc, gain, pDst, blockSize);
+  }
+  else
+  {
+    /* Linear ramp from the gain of the last block */
+    step = (gain - S->gain) / (float32_t) blockSize;
+    in = S->gain;
+
+    for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+    {
+      in += step;
+      *pDst++ = *pSrc++ * in;
+    }
+
+    S->gain = gain;
+  }
+}
+
+/**
+ * @} end of Dynamics group
+ */
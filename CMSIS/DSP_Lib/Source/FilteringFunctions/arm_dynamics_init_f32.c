@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dynamics_init_f32.c
+*
+* Description:	Floating-point dynamics processor initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point dynamics processor.
+ * @param[in,out] *S         points to an instance of the floating-point dynamics processor structure.
+ * @param[in]     threshDb   threshold in dB relative to full scale, the level 1.0 being 0 dB.
+ * @param[in]     ratio      compression ratio, at least 1, or 0 for an infinite ratio.
+ * @param[in]     makeupDb   makeup gain in dB.
+ * @param[in]     attack     detector coefficient for a rising level, in (0 1].
+ * @param[in]     release    detector coefficient for a falling level, in (0 1].
+ * @param[in]     rmsFlag    1 for an RMS detector, 0 for a peak detector.
+ * @param[in]     delay      look-ahead delay in samples.
+ * @param[in]     *pDelay    points to the delay line, of length <code>delay+blockSize</code>, unused if <code>delay</code> is 0.
+ * @param[in]     blockSize  number of samples processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for a parameter out of range.
+ *
+ * \par
+ * The detector, the delay line and the gain are reset, the gain to the makeup gain. The
+ * parameters may be changed between two blocks by setting the fields of the instance,
+ * in the logarithmic domain: <code>thresh</code> and <code>makeup</code> are the natural
+ * logarithms of the linear values.
+ */
+
+arm_status arm_dynamics_init_f32(
+  arm_dynamics_instance_f32 * S,
+  float32_t threshDb,
+  float32_t ratio,
+  float32_t makeupDb,
+  float32_t attack,
+  float32_t release,
+  uint8_t rmsFlag,
+  uint16_t delay,
+  float32_t * pDelay,
+  uint32_t blockSize)
+{
+  if(((ratio != 0.0f) && (ratio < 1.0f)) || (attack <= 0.0f) || (attack > 1.0f) ||
+     (release <= 0.0f) || (release > 1.0f) || (blockSize == 0u) ||
+     (((uint32_t) delay + blockSize) > 0xFFFFu))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* dB to natural logarithm, ln(10) / 20 */
+  S->thresh = threshDb * 0.115129255f;
+  S->makeup = makeupDb * 0.115129255f;
+  S->slope = (ratio == 0.0f) ? 1.0f : (1.0f - (1.0f / ratio));
+  S->attack = attack;
+  S->release = release;
+  S->rmsFlag = rmsFlag;
+  S->env = 0.0f;
+  arm_vexp_f32(&S->makeup, &S->gain, 1u);
+
+  /* Clear the delay line, of length delay + blockSize */
+  S->delay = delay;
+  S->delayIndex = 0u;
+  S->pDelay = pDelay;
+  if(delay != 0u)
+  {
+    memset(pDelay, 0, ((uint32_t) delay + blockSize) * sizeof(float32_t));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Dynamics group
+ */
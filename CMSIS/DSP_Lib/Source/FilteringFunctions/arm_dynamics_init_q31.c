@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dynamics_init_q31.c
+*
+* Description:	Q31 dynamics processor initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 dynamics processor.
+ * @param[in,out] *S         points to an instance of the Q31 dynamics processor structure.
+ * @param[in]     threshDb   threshold in dB relative to full scale, -180 to 0.
+ * @param[in]     ratio      compression ratio, at least 1, or 0 for an infinite ratio.
+ * @param[in]     makeupDb   makeup gain in dB, -90 to 90.
+ * @param[in]     attack     detector coefficient for a rising level, in (0 1].
+ * @param[in]     release    detector coefficient for a falling level, in (0 1].
+ * @param[in]     rmsFlag    1 for an RMS detector, 0 for a peak detector.
+ * @param[in]     delay      look-ahead delay in samples.
+ * @param[in]     *pDelay    points to the delay line, of length <code>delay+blockSize</code>, unused if <code>delay</code> is 0.
+ * @param[in]     blockSize  number of samples processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for a parameter out of range.
+ *
+ * \par
+ * The parameters are converted once to the fixed-point fields of the instance, which may
+ * be changed between two blocks: <code>thresh</code> and <code>makeup</code> are base 2
+ * logarithms in 16.16 format, a dB being 0.1661 in this unit. The detector, the delay line
+ * and the gain are reset, the gain to the makeup gain.
+ */
+
+arm_status arm_dynamics_init_q31(
+  arm_dynamics_instance_q31 * S,
+  float32_t threshDb,
+  float32_t ratio,
+  float32_t makeupDb,
+  float32_t attack,
+  float32_t release,
+  uint8_t rmsFlag,
+  uint16_t delay,
+  q31_t * pDelay,
+  uint32_t blockSize)
+{
+  if(((ratio != 0.0f) && (ratio < 1.0f)) || (attack <= 0.0f) || (attack > 1.0f) ||
+     (release <= 0.0f) || (release > 1.0f) || (threshDb < -180.0f) || (threshDb > 0.0f) ||
+     (makeupDb < -90.0f) || (makeupDb > 90.0f) || (blockSize == 0u) ||
+     (((uint32_t) delay + blockSize) > 0xFFFFu))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* dB to base 2 logarithm in 16.16 format, 65536 / 20log10(2) */
+  S->thresh = (int32_t) (threshDb * 10885.3f);
+  S->makeup = (int32_t) (makeupDb * 10885.3f);
+  S->gain = S->makeup;
+
+  /* 1 - 1/ratio and the coefficients in 1.31 format */
+  S->slope = (ratio == 0.0f) ? 0x7FFFFFFF :
+    clip_q63_to_q31((q63_t) ((1.0f - (1.0f / ratio)) * 2147483648.0f));
+  S->attack = clip_q63_to_q31((q63_t) (attack * 2147483648.0f));
+  S->release = clip_q63_to_q31((q63_t) (release * 2147483648.0f));
+  S->rmsFlag = rmsFlag;
+  S->env = 0;
+
+  /* Clear the delay line, of length delay + blockSize */
+  S->delay = delay;
+  S->delayIndex = 0u;
+  S->pDelay = pDelay;
+  if(delay != 0u)
+  {
+    memset(pDelay, 0, ((uint32_t) delay + blockSize) * sizeof(q31_t));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Dynamics group
+ */
@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dynamics_q31.c
+*
+* Description:	Q31 block dynamics processor: compressor, limiter and AGC
+*               with look-ahead.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Dynamics
+ * @{
+ */
+
+/* log2(1 + i/32) in 16.16 format */
+static const int32_t armDynLog2Table[33] = {
+  0, 2909, 5732, 8473, 11136, 13727,
+  16248, 18704, 21098, 23433, 25711, 27936,
+  30109, 32234, 34312, 36346, 38336, 40286,
+  42196, 44068, 45904, 47705, 49472, 51207,
+  52911, 54584, 56229, 57845, 59434, 60997,
+  62534, 64047, 65536
+};
+
+/* 2^(i/32 - 1) in 1.31 format */
+static const q31_t armDynExp2Table[33] = {
+  0x40000000, 0x4166C34C, 0x42D561B4, 0x444C0740, 0x45CAE0F2, 0x47521CC6,
+  0x48E1E9BA, 0x4A7A77D4, 0x4C1BF829, 0x4DC69CDD, 0x4F7A9930, 0x51382182,
+  0x52FF6B55, 0x54D0AD5A, 0x56AC1F75, 0x5891FAC1, 0x5A82799A, 0x5C7DD7A4,
+  0x5E8451D0, 0x60962665, 0x62B39509, 0x64DCDEC3, 0x6712460B, 0x69540EC9,
+  0x6BA27E65, 0x6DFDDBCC, 0x70666F76, 0x72DC8374, 0x75606374, 0x77F25CCE,
+  0x7A92BE8B, 0x7D41D96E, 0x7FFFFFFF
+};
+
+/* Lowest gain, 2^-30 */
+#define ARM_DYN_GAIN_MIN     (-30 * 65536)
+
+/**
+ * @brief Base 2 logarithm of a positive 1.31 value, in 16.16 format.
+ */
+
+static __INLINE int32_t arm_dynamics_log2_q31(
+  q31_t x)
+{
+  uint32_t n, idx, frac;
+  int32_t norm, y0;
+
+  if(x <= 0)
+  {
+    return (-32 * 65536);
+  }
+
+  /* x = m * 2^-n, the mantissa m in [1 2) being read in 2.30 format */
+  n = __CLZ(x);
+  norm = x << (n - 1u);
+  idx = ((uint32_t) norm >> 25u) & 0x1Fu;
+  frac = ((uint32_t) norm >> 9u) & 0xFFFFu;
+
+  y0 = armDynLog2Table[idx];
+  y0 += ((armDynLog2Table[idx + 1u] - y0) * (int32_t) frac) >> 16;
+
+  return (y0 - (int32_t) (n << 16));
+}
+
+/**
+ * @brief 2 to the power of a 16.16 value, as the scale and shift of arm_scale_q31().
+ */
+
+static __INLINE void arm_dynamics_exp2_q31(
+  int32_t x,
+  q31_t * pFract,
+  int8_t * pShift)
+{
+  uint32_t f = (uint32_t) x & 0xFFFFu;          /* fractional part */
+  uint32_t idx = f >> 11u;
+  q31_t y0 = armDynExp2Table[idx];
+
+  /* 2^x = 2^(f-1) * 2^(floor(x)+1) */
+  *pFract = y0 + (q31_t) (((q63_t) (armDynExp2Table[idx + 1u] - y0) * (int32_t) (f & 0x7FFu)) >> 11);
+  *pShift = (int8_t) ((x >> 16) + 1);
+}
+
+/**
+ * @brief Processing function for the Q31 dynamics processor.
+ * @param[in,out] *S        points to an instance of the Q31 dynamics processor structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, which may be the input.
+ * @param[in]     blockSize number of samples to process, as given to arm_dynamics_init_q31().
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The detector works in 1.31 format, the RMS detector on the squares of the samples, and
+ * its level is converted to a base 2 logarithm in 16.16 format, with an error below
+ * 0.001 dB. The gain, from 2^-30 up, is applied with a 64-bit product and the output is
+ * saturated to 1.31 format, as in arm_scale_q31().
+ */
+
+void arm_dynamics_q31(
+  arm_dynamics_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /* Input pointer */
+  q31_t env = S->env;                            /* Detector state */
+  q31_t envMax;                                  /* Largest level of the block */
+  q31_t in, out, fract0, fract1, step;           /* Sample and gain scales */
+  int32_t level, gain;                           /* Logarithms of the level and of the gain */
+  int32_t readIndex;                             /* Read index of the delay line */
+  int8_t shift0, shift1, kShift;                 /* Gain shifts */
+  uint32_t delaySize = S->delay + blockSize;     /* Delay line length */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* Detector, one-pole smoother with attack and release */
+  envMax = 0;
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pIn++;
+    in = (in > 0) ? in : (q31_t) __QSUB(0, in);
+
+    if(S->rmsFlag != 0u)
+    {
+      in = (q31_t) (((q63_t) in * in) >> 31);
+    }
+
+    env += (q31_t) (((q63_t) (in - env) * ((in > env) ? S->attack : S->release)) >> 31);
+
+    if(env > envMax)
+    {
+      envMax = env;
+    }
+  }
+  S->env = env;
+
+  /* Gain in the log domain, G = M - slope * max(L - T, 0) */
+  level = arm_dynamics_log2_q31(envMax);
+  if(S->rmsFlag != 0u)
+  {
+    level >>= 1;
+  }
+
+  level -= S->thresh;
+  gain = S->makeup;
+  if(level > 0)
+  {
+    gain -= (int32_t) (((q63_t) level * S->slope) >> 31);
+  }
+
+  if(gain < ARM_DYN_GAIN_MIN)
+  {
+    gain = ARM_DYN_GAIN_MIN;
+  }
+
+  /* Look-ahead delay */
+  if(S->delay != 0u)
+  {
+    arm_circularWrite_f32((int32_t *) S->pDelay, (int32_t) delaySize, &S->delayIndex, 1,
+                          (int32_t *) pSrc, 1, blockSize);
+
+    readIndex = ((int32_t) S->delayIndex - (int32_t) blockSize) - (int32_t) S->delay;
+    if(readIndex < 0)
+    {
+      readIndex += (int32_t) delaySize;
+    }
+
+    arm_circularRead_f32((int32_t *) S->pDelay, (int32_t) delaySize, &readIndex, 1,
+                         (int32_t *) pDst, (int32_t *) pDst, (int32_t) blockSize, 1,
+                         blockSize);
+    pSrc = pDst;
+  }
+
+  arm_dynamics_exp2_q31(gain, &fract1, &shift1);
+
+  if(gain == S->gain)
+  {
+    /* Steady gain */
+    arm_scale_q31(pSrc, fract1, shift1, pDst, blockSize);
+  }
+  else
+  {
+    /* Linear ramp from the gain of the last block, on a common shift */
+    arm_dynamics_exp2_q31(S->gain, &fract0, &shift0);
+
+    if(shift0 > shift1)
+    {
+      fract1 = ((shift0 - shift1) > 31) ? 0 : (fract1 >> (shift0 - shift1));
+      shift1 = shift0;
+    }
+    else
+    {
+      fract0 = ((shift1 - shift0) > 31) ? 0 : (fract0 >> (shift1 - shift0));
+    }
+
+    step = (fract1 - fract0) / (int32_t) blockSize;
+    kShift = shift1 + 1;
+
+    for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+    {
+      fract0 += step;
+      in = (q31_t) (((q63_t) *pSrc++ * fract0) >> 32);
+
+      if(kShift >= 0)
+      {
+        out = in << kShift;
+        if(in != (out >> kShift))
+          out = 0x7FFFFFFF ^ (in >> 31);
+      }
+      else
+      {
+        out = in >> -kShift;
+      }
+
+      *pDst++ = out;
+    }
+
+    S->gain = gain;
+  }
+}
+
+/**
+ * @} end of Dynamics group
+ */
@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_circ_init_q15.c
+*
+* Description:	Q15 circular FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 FIR filter with a circular state buffer.
+ * @param[in,out] *S         points to an instance of the Q15 circular FIR structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients, in time reversed order.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     blockSize  largest number of samples processed per call.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> holds the delay line and its mirrored copy and must be of length
+ * <code>2*(numTaps+blockSize-1)</code>. The state buffer is cleared.
+ */
+
+void arm_fir_circ_init_q15(
+  arm_fir_circ_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  /* Assign filter taps and coefficient pointer */
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+
+  /* Delay line of numTaps-1 past samples and one block */
+  S->stateLen = (uint16_t) (numTaps + blockSize - 1u);
+  S->stateIndex = 0u;
+
+  /* Clear the delay line and its mirrored copy */
+  memset(pState, 0, 2u * S->stateLen * sizeof(q15_t));
+
+  S->pState = pState;
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,216 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_circ_q15.c
+*
+* Description:	Q15 FIR filter with a circular state buffer.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FIR filter with a circular state buffer.
+ * @param[in,out] *S         points to an instance of the Q15 circular FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given at initialization.
+ * @return none.
+ *
+ * \par Circular state buffer:
+ * \par
+ * arm_fir_q15() moves the last <code>numTaps-1</code> samples to the start of its state
+ * buffer after each block, a cost that dominates with long filters and short blocks.
+ * Here the state is a delay line of <code>stateLen = numTaps+blockSize-1</code> samples
+ * written circularly twice, at <code>stateIndex</code> and <code>stateIndex+stateLen</code>,
+ * with arm_circularWrite_q15(). Any <code>stateLen</code> consecutive values of the mirrored
+ * buffer are then the delay line in order, and the block is filtered in place from the
+ * oldest sample needed: the only extra cost is the second write of each new sample.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As in arm_fir_q15(), the 2.30 products are accumulated in a 64-bit accumulator in 34.30
+ * format without risk of overflow. The accumulator is truncated to 34.15 format and
+ * saturated to yield the 1.15 output.
+ */
+
+void arm_fir_circ_q15(
+  arm_fir_circ_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState;                                 /* Oldest sample of the block */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  int32_t stateLen = (int32_t) S->stateLen;      /* Length of the delay line */
+  int32_t readIndex;                             /* Index of the oldest sample of the block */
+  uint16_t mirrorIndex = S->stateIndex;          /* Write index of the mirrored copy */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+  q15_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  q63_t acc;                                     /* Accumulator */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* Oldest sample needed by the block, numTaps-1 samples before the first new one */
+  readIndex = (int32_t) S->stateIndex - (int32_t) (numTaps - 1u);
+  if(readIndex < 0)
+  {
+    readIndex += stateLen;
+  }
+
+  /* Write the new samples to the delay line and to its mirrored copy */
+  arm_circularWrite_q15(S->pState, stateLen, &S->stateIndex, 1,
+                        pSrc, 1, blockSize);
+  arm_circularWrite_q15(S->pState + stateLen, stateLen, &mirrorIndex, 1,
+                        pSrc, 1, blockSize);
+
+  pState = S->pState + readIndex;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Compute 4 outputs at a time, sharing each coefficient load */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    /* Set all accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    px = pState;
+    pb = pCoeffs;
+
+    /* Read the first three samples of the 4 outputs */
+    x0 = *px++;
+    x1 = *px++;
+    x2 = *px++;
+
+    i = numTaps;
+
+    do
+    {
+      /* Read the coefficient and the next sample */
+      c0 = *pb++;
+      x3 = *px++;
+
+      /* acc0 +=  b[numTaps-1-k] * x[n-numTaps+1+k], acc1..acc3 one sample later each */
+      acc0 += ((q63_t) x0 * c0);
+      acc1 += ((q63_t) x1 * c0);
+      acc2 += ((q63_t) x2 * c0);
+      acc3 += ((q63_t) x3 * c0);
+
+      /* Shift the samples for the next coefficient */
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      i--;
+    } while(i > 0u);
+
+    /* Convert the 4 outputs and store them in the destination buffer */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc1 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc2 >> 15), 16));
+    *pDst++ = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+    /* Advance the state pointer by 4 for the next 4 outputs */
+    pState += 4u;
+
+    blkCnt--;
+  }
+
+  /* Compute the remaining 1 to 3 outputs */
+  blkCnt = blockSize % 0x4u;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+    px = pState;
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    do
+    {
+      acc0 += (q63_t) * px++ * *pb++;
+      i--;
+    } while(i > 0u);
+
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    pState++;
+
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Set the accumulator to zero */
+    acc = 0;
+
+    px = pState;
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    /* Perform the multiply-accumulates */
+    do
+    {
+      /* acc =  b[numTaps-1] * x[n-numTaps+1] + b[numTaps-2] * x[n-numTaps+2] +...+ b[0] * x[n] */
+      acc += (q63_t) * px++ * *pb++;
+      i--;
+    } while(i > 0u);
+
+    /* Convert the result and store it in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Advance state pointer by 1 for the next sample */
+    pState++;
+
+    blkCnt--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+}
+
+/**
+ * @} end of FIR group
+ */
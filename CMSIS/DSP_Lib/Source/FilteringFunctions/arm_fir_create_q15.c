@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_create_q15.c
+*
+* Description:	Creation of the Q15 FIR filter in a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initializes the Q15 FIR filter with its state allocated from a RAM arena.
+ * @param[in,out] *S         points to an instance of the Q15 FIR filter structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients.
+ * @param[in]     blockSize  number of samples that are processed per call.
+ * @param[in,out] *A         points to an instance of the RAM arena structure.
+ * @return        The function returns ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise
+ * the status returned by arm_fir_init_q15().
+ *
+ * \par Description:
+ * \par
+ * The state, <code>ARM_FIR_STATE_SIZE_Q15(numTaps, blockSize)</code> samples, is allocated from the
+ * arena, aligned on 8 bytes, and the filter is initialized by arm_fir_init_q15().
+ * In an arena in the CCM data RAM, the state, read and written for every sample, is
+ * accessed with no wait state. With an arena planning the memory, the size is counted
+ * and the instance is not modified.
+ */
+
+arm_status arm_fir_create_q15(
+  arm_fir_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t *pCoeffs,
+  uint32_t blockSize,
+  arm_ram_arena_instance * A)
+{
+  q15_t *pState;                               /* State allocated from the arena */
+  uint32_t used = A->used;                     /* Arena allocation before the state */
+  arm_status status;
+
+  pState = (q15_t *) arm_ram_arena_alloc(A, ARM_FIR_STATE_SIZE_Q15(numTaps, blockSize) * sizeof(q15_t));
+
+  if(pState == NULL)
+  {
+    /* A planning arena counts the size only */
+    return ((A->pBase == NULL) ? ARM_MATH_SUCCESS : ARM_MATH_LENGTH_ERROR);
+  }
+
+  status = arm_fir_init_q15(S, numTaps, pCoeffs, pState, blockSize);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    /* Release the state */
+    A->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_create_q7.c
+*
+* Description:	Creation of the Q7 FIR filter in a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initializes the Q7 FIR filter with its state allocated from a RAM arena.
+ * @param[in,out] *S         points to an instance of the Q7 FIR filter structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients.
+ * @param[in]     blockSize  number of samples that are processed per call.
+ * @param[in,out] *A         points to an instance of the RAM arena structure.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when
+ * the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The state, <code>ARM_FIR_STATE_SIZE(numTaps, blockSize)</code> samples, is allocated from the
+ * arena, aligned on 8 bytes, and the filter is initialized by arm_fir_init_q7().
+ * In an arena in the CCM data RAM, the state, read and written for every sample, is
+ * accessed with no wait state. With an arena planning the memory, the size is counted
+ * and the instance is not modified.
+ */
+
+arm_status arm_fir_create_q7(
+  arm_fir_instance_q7 * S,
+  uint16_t numTaps,
+  q7_t *pCoeffs,
+  uint32_t blockSize,
+  arm_ram_arena_instance * A)
+{
+  q7_t *pState;                                /* State allocated from the arena */
+
+  pState = (q7_t *) arm_ram_arena_alloc(A, ARM_FIR_STATE_SIZE(numTaps, blockSize) * sizeof(q7_t));
+
+  if(pState == NULL)
+  {
+    /* A planning arena counts the size only */
+    return ((A->pBase == NULL) ? ARM_MATH_SUCCESS : ARM_MATH_LENGTH_ERROR);
+  }
+
+  arm_fir_init_q7(S, numTaps, pCoeffs, pState, blockSize);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_decimate_create_q31.c
+*
+* Description:	Creation of the Q31 FIR decimator in a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+/**
+ * @brief  Initializes the Q31 FIR decimator with its state allocated from a RAM arena.
+ * @param[in,out] *S         points to an instance of the Q31 FIR decimator structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     M          decimation factor.
+ * @param[in]     *pCoeffs   points to the filter coefficients.
+ * @param[in]     blockSize  number of samples that are processed per call.
+ * @param[in,out] *A         points to an instance of the RAM arena structure.
+ * @return        The function returns ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise
+ * the status returned by arm_fir_decimate_init_q31().
+ *
+ * \par Description:
+ * \par
+ * The state, <code>ARM_FIR_DECIMATE_STATE_SIZE(numTaps, blockSize)</code> samples, is allocated from the
+ * arena, aligned on 8 bytes, and the filter is initialized by arm_fir_decimate_init_q31().
+ * In an arena in the CCM data RAM, the state, read and written for every sample, is
+ * accessed with no wait state. With an arena planning the memory, the size is counted
+ * and the instance is not modified.
+ */
+
+arm_status arm_fir_decimate_create_q31(
+  arm_fir_decimate_instance_q31 * S,
+  uint16_t numTaps,
+  uint8_t M,
+  q31_t *pCoeffs,
+  uint32_t blockSize,
+  arm_ram_arena_instance * A)
+{
+  q31_t *pState;                               /* State allocated from the arena */
+  uint32_t used = A->used;                     /* Arena allocation before the state */
+  arm_status status;
+
+  pState = (q31_t *) arm_ram_arena_alloc(A, ARM_FIR_DECIMATE_STATE_SIZE(numTaps, blockSize) * sizeof(q31_t));
+
+  if(pState == NULL)
+  {
+    /* A planning arena counts the size only */
+    return ((A->pBase == NULL) ? ARM_MATH_SUCCESS : ARM_MATH_LENGTH_ERROR);
+  }
+
+  status = arm_fir_decimate_init_q31(S, numTaps, M, pCoeffs, pState, blockSize);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    /* Release the state */
+    A->used = used;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
@@ -0,0 +1,56 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_f16_f32.c
+*
+* Description:	Floating-point FIR filter with half-precision input samples.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR filter, with half-precision input.
+ * @param[in]  *S points to an instance of the floating-point FIR filter structure.
+ * @param[in]  *pSrc points to the block of half-precision input data.
+ * @param[out] *pDst points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     none.
+ *
+ * \par
+ * The input samples are converted by arm_f16_to_f32() straight into the state buffer,
+ * where arm_fir_f32() would copy them, and arm_fir_f32() filters them from there: the
+ * copy it makes of its input is then in place, and no intermediate block is needed.
+ * The instance and the state are the ones of arm_fir_f32().
+ */
+
+void arm_fir_f16_f32(
+  const arm_fir_instance_f32 * S,
+  float16_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pStateCurnt = &(S->pState[(S->numTaps - 1u)]);  /* Points to the new samples in the state */
+
+  arm_f16_to_f32(pSrc, pStateCurnt, blockSize);
+
+  arm_fir_f32(S, pStateCurnt, pDst, blockSize);
+}
+
+/**
+ * @} end of FIR group
+ */
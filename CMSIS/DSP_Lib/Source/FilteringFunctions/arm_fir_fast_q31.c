@@ -218,6 +218,10 @@ void arm_fir_fast_q31(
 
     /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.31    
      ** Then store the 4 outputs in the destination buffer. */
+    ARM_SAT_STATS_Q31(S, (q63_t) acc0 << 1);
+    ARM_SAT_STATS_Q31(S, (q63_t) acc1 << 1);
+    ARM_SAT_STATS_Q31(S, (q63_t) acc2 << 1);
+    ARM_SAT_STATS_Q31(S, (q63_t) acc3 << 1);
     *pDst++ = (q31_t) (acc0 << 1);
     *pDst++ = (q31_t) (acc1 << 1);
     *pDst++ = (q31_t) (acc2 << 1);
@@ -259,6 +263,7 @@ void arm_fir_fast_q31(
 
     /* The result is in 2.30 format.  Convert to 1.31    
      ** Then store the output in the destination buffer. */
+    ARM_SAT_STATS_Q31(S, (q63_t) acc0 << 1);
     *pDst++ = (q31_t) (acc0 << 1);
 
     /* Advance state pointer by 1 for the next sample */
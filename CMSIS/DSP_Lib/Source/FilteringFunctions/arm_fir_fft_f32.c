@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_f32.c
+*
+* Description:	Floating-point FIR filter through overlap-save FFT convolution
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_FFT FFT Based FIR Filters
+ *
+ * \par
+ * arm_fir_f32() costs <code>numTaps</code> multiply-accumulates per output sample, millions per
+ * block for the 512 to 2048 taps of reverbs and matched filters. These functions compute the
+ * same filter by overlap-save fast convolution: each block of new samples, preceded by the last
+ * <code>numTaps-1</code> samples of the previous blocks and padded with zeros to
+ * <code>fftLen</code>, is transformed by the radix-4 CFFT, multiplied by the spectrum of the
+ * coefficients computed once at initialization and transformed back, and the
+ * <code>blockSize</code> outputs are read past the first <code>numTaps-1</code> values.
+ *
+ * \par
+ * <code>fftLen</code> is the smallest radix-4 length, 16 to 4096, not below
+ * <code>numTaps+blockSize-1</code>, so that the circular convolution does not wrap.
+ * The initialization compares the cost of the two FFTs of <code>fftLen</code> points with the
+ * one of the direct form for the block, and selects the direct form, arm_fir_f32() or
+ * arm_fir_q31(), below the crossover or when no radix-4 length is long enough: the
+ * caller sees one filter, with the same output, whichever path runs.
+ *
+ * \par
+ * The coefficients are stored in time reversed order as for arm_fir_f32():
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ *
+ * \par Instance Structure
+ * The state buffer is of length <code>numTaps+blockSize-1</code>, used by the direct form or
+ * holding the last <code>numTaps-1</code> samples. The spectrum and scratch buffers are of
+ * length <code>2*fftLen</code> each, and are not used when the direct form is selected.
+ * A separate instance structure must be defined for each filter.
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 version runs the block floating point CFFT/CIFFT, arm_cfft_radix4_bfp_q31(), and
+ * scales the output back with the exponents of the three transforms, saturating it to 1.31.
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @param[in]  *S         points to an instance of the floating-point FFT based FIR structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process, at most the <code>blockSize</code> given at initialization.
+ * @return none.
+ */
+
+void arm_fir_fft_f32(
+  const arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->Sfir.pState;
+  float32_t *pScratch = S->pScratch;
+  uint32_t history = (uint32_t) S->numTaps - 1u;
+  uint32_t i;
+
+  if(S->fftLen == 0u)
+  {
+    /*  Direct form below the crossover */
+    arm_fir_f32(&S->Sfir, pSrc, pDst, blockSize);
+    return;
+  }
+
+  /*  Frame of the last numTaps-1 samples and the new block, real, padded with zeros */
+  for (i = 0u; i < history; i++)
+  {
+    pScratch[2u * i] = pState[i];
+    pScratch[(2u * i) + 1u] = 0.0f;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pScratch[2u * (history + i)] = pSrc[i];
+    pScratch[(2u * (history + i)) + 1u] = 0.0f;
+  }
+
+  memset(&pScratch[2u * (history + blockSize)], 0,
+         2u * (S->fftLen - history - blockSize) * sizeof(float32_t));
+
+  /*  The last numTaps-1 samples of the frame for the next block */
+  for (i = 0u; i < history; i++)
+  {
+    pState[i] = pScratch[2u * (blockSize + i)];
+  }
+
+  /*  Circular convolution with the coefficients, including the 1/fftLen scaling */
+  arm_cfft_radix4_f32(&S->Sfft, pScratch);
+  arm_cmplx_mult_cmplx_f32(pScratch, S->pSpectrum, pScratch, S->fftLen);
+  arm_cfft_radix4_f32(&S->Sifft, pScratch);
+
+  /*  The outputs past the first numTaps-1 values */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pDst[i] = pScratch[2u * (history + i)];
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
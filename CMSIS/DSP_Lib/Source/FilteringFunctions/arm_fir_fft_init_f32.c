@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_init_f32.c
+*
+* Description:	Floating-point FFT based FIR filter initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @param[in,out] *S          points to an instance of the floating-point FFT based FIR structure.
+ * @param[in]     numTaps     number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the filter coefficients, in time reversed order.
+ * @param[in]     *pState     points to the state buffer of <code>numTaps+blockSize-1</code> samples.
+ * @param[in]     *pSpectrum  points to the spectrum buffer of <code>2*fftLen</code> values.
+ * @param[in]     *pScratch   points to the scratch buffer of <code>2*fftLen</code> values.
+ * @param[in]     blockSize   largest number of samples processed per call.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * Selects the direct form or the FFT path with arm_fir_fft_len(), and computes the spectrum
+ * of the coefficients for the FFT path. The state buffer is cleared.
+ */
+
+void arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pSpectrum,
+  float32_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t i;
+
+  /*  Direct form instance, also holding the coefficients and the state */
+  arm_fir_init_f32(&S->Sfir, numTaps, pCoeffs, pState, blockSize);
+
+  S->numTaps = numTaps;
+  S->pSpectrum = pSpectrum;
+  S->pScratch = pScratch;
+  S->fftLen = arm_fir_fft_len(numTaps, blockSize);
+
+  if(S->fftLen != 0u)
+  {
+    arm_cfft_radix4_init_f32(&S->Sfft, S->fftLen, 0u, 1u);
+    arm_cfft_radix4_init_f32(&S->Sifft, S->fftLen, 1u, 1u);
+
+    /*  Spectrum of b[0], b[1], ..., b[numTaps-1] padded with zeros */
+    memset(pSpectrum, 0, 2u * S->fftLen * sizeof(float32_t));
+    for (i = 0u; i < numTaps; i++)
+    {
+      pSpectrum[2u * i] = pCoeffs[numTaps - 1u - i];
+    }
+
+    arm_cfft_radix4_f32(&S->Sfft, pSpectrum);
+  }
+}
+
+/**
+ * @brief  Length of the FFTs of the FFT based FIR filters.
+ * @param[in]  numTaps    number of filter coefficients in the filter.
+ * @param[in]  blockSize  largest number of samples processed per call.
+ * @return The radix-4 length of the FFTs, or 0 when the direct form is cheaper.
+ *
+ * \par
+ * The FFT path costs two radix-4 transforms of <code>fftLen</code> points, about
+ * <code>8*fftLen*log2(fftLen)</code> cycles, and the spectrum product and copies, about
+ * <code>8*fftLen</code> cycles per block; the direct form costs about one cycle per tap
+ * and output sample. The buffers of the FFT path are sized with the returned length.
+ */
+
+uint16_t arm_fir_fft_len(
+  uint16_t numTaps,
+  uint32_t blockSize)
+{
+  uint32_t fftLen = 16u;
+  uint32_t log2Len = 4u;
+
+  /*  Smallest radix-4 length holding numTaps-1 past and blockSize new samples */
+  while((fftLen < ((uint32_t) numTaps + blockSize - 1u)) && (fftLen < 4096u))
+  {
+    fftLen <<= 2u;
+    log2Len += 2u;
+  }
+
+  if((fftLen < ((uint32_t) numTaps + blockSize - 1u)) ||
+     (((8u * fftLen * log2Len) + (8u * fftLen)) >= ((uint32_t) numTaps * blockSize)))
+  {
+    /*  Direct form */
+    fftLen = 0u;
+  }
+
+  return ((uint16_t) fftLen);
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_init_q31.c
+*
+* Description:	Q31 FFT based FIR filter initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @param[in,out] *S          points to an instance of the Q31 FFT based FIR structure.
+ * @param[in]     numTaps     number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the filter coefficients, in time reversed order.
+ * @param[in]     *pState     points to the state buffer of <code>numTaps+blockSize-1</code> samples.
+ * @param[in]     *pSpectrum  points to the spectrum buffer of <code>2*fftLen</code> values.
+ * @param[in]     *pScratch   points to the scratch buffer of <code>2*fftLen</code> values.
+ * @param[in]     blockSize   largest number of samples processed per call.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * Selects the direct form or the FFT path with arm_fir_fft_len(), and computes the block
+ * floating point spectrum of the coefficients for the FFT path. The state buffer is cleared.
+ */
+
+void arm_fir_fft_init_q31(
+  arm_fir_fft_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pSpectrum,
+  q31_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t i, len;
+  int32_t exponent;
+
+  /*  Direct form instance, also holding the coefficients and the state */
+  arm_fir_init_q31(&S->Sfir, numTaps, pCoeffs, pState, blockSize);
+
+  S->numTaps = numTaps;
+  S->pSpectrum = pSpectrum;
+  S->pScratch = pScratch;
+  S->postShift = 0;
+  S->fftLen = arm_fir_fft_len(numTaps, blockSize);
+
+  if(S->fftLen != 0u)
+  {
+    arm_cfft_radix4_init_q31(&S->Sfft, S->fftLen, 0u, 1u);
+    arm_cfft_radix4_init_q31(&S->Sifft, S->fftLen, 1u, 1u);
+
+    /*  Spectrum of b[0], b[1], ..., b[numTaps-1] padded with zeros */
+    memset(pSpectrum, 0, 2u * S->fftLen * sizeof(q31_t));
+    for (i = 0u; i < numTaps; i++)
+    {
+      pSpectrum[2u * i] = pCoeffs[numTaps - 1u - i];
+    }
+
+    exponent = arm_cfft_radix4_bfp_q31(&S->Sfft, pSpectrum);
+
+    /*  Exponent of the spectrum, plus 2 for the 3.29 product, minus log2(fftLen) */
+    exponent += 2;
+    for (len = S->fftLen; len > 1u; len >>= 1u)
+    {
+      exponent--;
+    }
+
+    S->postShift = (int8_t) exponent;
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_fft_q31.c
+*
+* Description:	Q31 FIR filter through overlap-save FFT convolution
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @param[in]  *S         points to an instance of the Q31 FFT based FIR structure.
+ * @param[in]  *pSrc      points to the block of input data.
+ * @param[out] *pDst      points to the block of output data.
+ * @param[in]  blockSize  number of samples to process, at most the <code>blockSize</code> given at initialization.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The block floating point transforms keep the significant bits of the frame whatever its
+ * level. The output is the filtered signal in 1.31 format, saturated, as arm_fir_q31()
+ * would give it without its accumulator overflow.
+ */
+
+void arm_fir_fft_q31(
+  const arm_fir_fft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->Sfir.pState;
+  q31_t *pScratch = S->pScratch;
+  uint32_t history = (uint32_t) S->numTaps - 1u;
+  uint32_t i;
+  int32_t exponent;
+
+  if(S->fftLen == 0u)
+  {
+    /*  Direct form below the crossover */
+    arm_fir_q31(&S->Sfir, pSrc, pDst, blockSize);
+    return;
+  }
+
+  /*  Frame of the last numTaps-1 samples and the new block, real, padded with zeros */
+  for (i = 0u; i < history; i++)
+  {
+    pScratch[2u * i] = pState[i];
+    pScratch[(2u * i) + 1u] = 0;
+  }
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pScratch[2u * (history + i)] = pSrc[i];
+    pScratch[(2u * (history + i)) + 1u] = 0;
+  }
+
+  memset(&pScratch[2u * (history + blockSize)], 0,
+         2u * (S->fftLen - history - blockSize) * sizeof(q31_t));
+
+  /*  The last numTaps-1 samples of the frame for the next block */
+  for (i = 0u; i < history; i++)
+  {
+    pState[i] = pScratch[2u * (blockSize + i)];
+  }
+
+  /*  Circular convolution with the coefficients, the 3.29 product adding 2 to the exponent */
+  exponent = arm_cfft_radix4_bfp_q31(&S->Sfft, pScratch);
+  arm_cmplx_mult_cmplx_q31(pScratch, S->pSpectrum, pScratch, S->fftLen);
+  exponent += arm_cfft_radix4_bfp_q31(&S->Sifft, pScratch);
+
+  /*  Exponent of the spectrum, the 3.29 format and the 1/fftLen scaling */
+  exponent += S->postShift;
+
+  /*  The outputs past the first numTaps-1 values, scaled back */
+  if(exponent > 32)
+  {
+    /*  Any nonzero output saturates */
+    exponent = 32;
+  }
+  else if(exponent < -31)
+  {
+    exponent = -31;
+  }
+
+  if(exponent >= 0)
+  {
+    for (i = 0u; i < blockSize; i++)
+    {
+      pDst[i] = clip_q63_to_q31((q63_t) pScratch[2u * (history + i)] << exponent);
+    }
+  }
+  else
+  {
+    for (i = 0u; i < blockSize; i++)
+    {
+      pDst[i] = pScratch[2u * (history + i)] >> (-exponent);
+    }
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
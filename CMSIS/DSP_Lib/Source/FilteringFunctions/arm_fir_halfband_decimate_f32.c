@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_decimate_f32.c
+*
+* Description:	Floating-point half-band FIR decimator by 2.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point half-band FIR decimator by 2.
+ * @param[in]  *S        points to an instance of the floating-point half-band decimator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, of <code>blockSize/2</code> samples.
+ * @param[in]  blockSize number of input samples to process per call, a multiple of 2.
+ * @return     none.
+ *
+ * \par Half-band filters:
+ * \par
+ * A half-band lowpass filter of cutoff a quarter of the input rate has a length
+ * <code>numTaps=4*K-1</code>, symmetric coefficients, a center coefficient <code>b[2*K-1]</code>
+ * close to 0.5, and every other coefficient equal to zero:
+ * <pre>
+ *    b[2*K-1+2*m] = 0 for m != 0
+ * </pre>
+ * Only the <code>K</code> distinct nonzero coefficients on each side of the center are
+ * multiplied, each by the sum of the two mirrored samples, plus the center coefficient: an
+ * output costs <code>K+1</code> multiplications where arm_fir_decimate_f32() would need
+ * <code>4*K-1</code>.
+ */
+
+void arm_fir_halfband_decimate_f32(
+  const arm_fir_halfband_decimate_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *py, *pb;                       /* Oldest and newest samples and coefficient pointers */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Number of nonzero coefficients on each side */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(float32_t));
+
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* The center tap */
+    acc0 = pState[numTaps >> 1u] * pCoeffs[numPairs];
+
+    /* px runs forward from the oldest sample, py backward from the newest one */
+    px = pState;
+    py = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 coefficients at a time. */
+    i = numPairs >> 2u;
+
+    while(i > 0u)
+    {
+      /* acc +=  b[2*k] * (x[n-numTaps+1+2*k] + x[n-2*k]) */
+      acc0 += (px[0] + py[0]) * pb[0];
+      acc0 += (px[2] + py[-2]) * pb[1];
+      acc0 += (px[4] + py[-4]) * pb[2];
+      acc0 += (px[6] + py[-6]) * pb[3];
+
+      px += 8u;
+      py -= 8u;
+      pb += 4u;
+
+      i--;
+    }
+
+    i = numPairs % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    i = numPairs;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(i > 0u)
+    {
+      acc0 += (*px + *py) * *pb++;
+      px += 2u;
+      py -= 2u;
+
+      i--;
+    }
+
+    /* The result is stored in the destination buffer. */
+    *pDst++ = acc0;
+
+    /* Advance the state pointer by the decimation factor */
+    pState += 2u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
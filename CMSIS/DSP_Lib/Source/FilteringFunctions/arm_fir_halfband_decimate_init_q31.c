@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_decimate_init_q31.c
+*
+* Description:	Q31 half-band FIR decimator initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 half-band FIR decimator by 2.
+ * @param[in,out] *S         points to an instance of the Q31 half-band decimator structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter, of the form <code>4*K-1</code>.
+ * @param[in]     *pCoeffs   points to the nonzero filter coefficients of the first half.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+ * <code>numTaps</code> is not of the form <code>4*K-1</code> or <code>blockSize</code> is not a multiple of 2.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the <code>K</code> nonzero coefficients before the center
+ * followed by the center coefficient, <code>K+1</code> values in all:
+ * <pre>
+ *    {b[0], b[2], ..., b[2*K-2], b[2*K-1]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables of length
+ * <code>numTaps+blockSize-1</code>. The state buffer is cleared.
+ */
+
+arm_status arm_fir_halfband_decimate_init_q31(
+  arm_fir_halfband_decimate_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if(((numTaps & 0x3u) != 0x3u) || ((blockSize & 0x1u) != 0u))
+  {
+    /* Set status as ARM_MATH_LENGTH_ERROR */
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps */
+    S->numTaps = numTaps;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and size is always blockSize + numTaps - 1 */
+    memset(pState, 0, (numTaps + (blockSize - 1u)) * sizeof(q31_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_decimate_q15.c
+*
+* Description:	Q15 half-band FIR decimator by 2.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 half-band FIR decimator by 2.
+ * @param[in]  *S        points to an instance of the Q15 half-band decimator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, of <code>blockSize/2</code> samples.
+ * @param[in]  blockSize number of input samples to process per call, a multiple of 2.
+ * @return     none.
+ *
+ * \par
+ * Each output costs <code>K+1</code> multiplications for a filter of <code>numTaps=4*K-1</code>
+ * coefficients, as described for arm_fir_halfband_decimate_f32().
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The mirrored samples are added in 32 bits without loss. The products are accumulated in
+ * a 64-bit accumulator in 34.30 format, which is truncated to 34.15 format and saturated
+ * to 1.15 format as in arm_fir_decimate_q15().
+ */
+
+void arm_fir_halfband_decimate_q15(
+  const arm_fir_halfband_decimate_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                 /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  q15_t *pStateCurnt;                        /* Points to the current sample of the state */
+  q15_t *px, *py, *pb;                       /* Oldest and newest samples and coefficient pointers */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Number of nonzero coefficients on each side */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(q15_t));
+
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* The center tap */
+    acc0 = (q31_t) pState[numTaps >> 1u] * pCoeffs[numPairs];
+
+    /* px runs forward from the oldest sample, py backward from the newest one */
+    px = pState;
+    py = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 coefficients at a time. */
+    i = numPairs >> 2u;
+
+    while(i > 0u)
+    {
+      /* acc +=  b[2*k] * (x[n-numTaps+1+2*k] + x[n-2*k]) */
+      acc0 += (q63_t) ((q31_t) px[0] + py[0]) * pb[0];
+      acc0 += (q63_t) ((q31_t) px[2] + py[-2]) * pb[1];
+      acc0 += (q63_t) ((q31_t) px[4] + py[-4]) * pb[2];
+      acc0 += (q63_t) ((q31_t) px[6] + py[-6]) * pb[3];
+
+      px += 8u;
+      py -= 8u;
+      pb += 4u;
+
+      i--;
+    }
+
+    i = numPairs % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    i = numPairs;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(i > 0u)
+    {
+      acc0 += (q63_t) ((q31_t) * px + *py) * *pb++;
+      px += 2u;
+      py -= 2u;
+
+      i--;
+    }
+
+    /* The result is in 2.30 format.  Convert to 1.15 with saturation.
+     ** Then store the output in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    /* Advance the state pointer by the decimation factor */
+    pState += 2u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(q15_t));
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
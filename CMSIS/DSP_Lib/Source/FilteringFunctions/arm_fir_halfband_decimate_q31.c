@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_halfband_decimate_q31.c
+*
+* Description:	Q31 half-band FIR decimator by 2.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 half-band FIR decimator by 2.
+ * @param[in]  *S        points to an instance of the Q31 half-band decimator structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, of <code>blockSize/2</code> samples.
+ * @param[in]  blockSize number of input samples to process per call, a multiple of 2.
+ * @return     none.
+ *
+ * \par
+ * Each output costs <code>K+1</code> multiplications for a filter of <code>numTaps=4*K-1</code>
+ * coefficients, as described for arm_fir_halfband_decimate_f32().
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As in arm_fir_sym_q31(), the mirrored samples are halved before being added and the
+ * products are accumulated in a 64-bit accumulator in 3.61 format, then truncated to
+ * 1.31 format.
+ */
+
+void arm_fir_halfband_decimate_q31(
+  const arm_fir_halfband_decimate_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                 /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  q31_t *pStateCurnt;                        /* Points to the current sample of the state */
+  q31_t *px, *py, *pb;                       /* Oldest and newest samples and coefficient pointers */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Number of nonzero coefficients on each side */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (numTaps - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(q31_t));
+
+  blkCnt = blockSize >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    /* The center tap, in the 3.61 format of the halved sums */
+    acc0 = ((q63_t) pState[numTaps >> 1u] * pCoeffs[numPairs]) >> 1;
+
+    /* px runs forward from the oldest sample, py backward from the newest one */
+    px = pState;
+    py = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 coefficients at a time. */
+    i = numPairs >> 2u;
+
+    while(i > 0u)
+    {
+      /* acc +=  b[2*k] * (x[n-numTaps+1+2*k] + x[n-2*k]) / 2 */
+      acc0 += (q63_t) ((px[0] >> 1) + (py[0] >> 1)) * pb[0];
+      acc0 += (q63_t) ((px[2] >> 1) + (py[-2] >> 1)) * pb[1];
+      acc0 += (q63_t) ((px[4] >> 1) + (py[-4] >> 1)) * pb[2];
+      acc0 += (q63_t) ((px[6] >> 1) + (py[-6] >> 1)) * pb[3];
+
+      px += 8u;
+      py -= 8u;
+      pb += 4u;
+
+      i--;
+    }
+
+    i = numPairs % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    i = numPairs;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(i > 0u)
+    {
+      acc0 += (q63_t) ((*px >> 1) + (*py >> 1)) * *pb++;
+      px += 2u;
+      py -= 2u;
+
+      i--;
+    }
+
+    /* The result is in 3.61 format.  Convert to 1.31 and store in the destination buffer. */
+    *pDst++ = (q31_t) (acc0 >> 30);
+
+    /* Advance the state pointer by the decimation factor */
+    pState += 2u;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(q31_t));
+}
+
+/**
+ * @} end of FIR_decimate group
+ */
@@ -118,6 +118,9 @@ arm_status arm_fir_init_q15(
     /* Assign state pointer */
     S->pState = pState;
 
+    /* Clear the saturation statistics */
+    ARM_SAT_STATS_RESET(S);
+
     status = ARM_MATH_SUCCESS;
   }
 
@@ -139,6 +142,9 @@ arm_status arm_fir_init_q15(
   /* Assign state pointer */
   S->pState = pState;
 
+  /* Clear the saturation statistics */
+  ARM_SAT_STATS_RESET(S);
+
   status = ARM_MATH_SUCCESS;
 
   return (status);
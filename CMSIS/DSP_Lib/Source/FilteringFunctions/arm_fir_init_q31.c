@@ -87,6 +87,9 @@ void arm_fir_init_q31(
   /* Assign state pointer */
   S->pState = pState;
 
+  /* Clear the saturation statistics */
+  ARM_SAT_STATS_RESET(S);
+
 }
 
 /**    
@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_lattice_create_q31.c
+*
+* Description:	Creation of the Q31 FIR lattice filter in a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Lattice
+ * @{
+ */
+
+/**
+ * @brief  Initializes the Q31 FIR lattice filter with its state allocated from a RAM arena.
+ * @param[in,out] *S         points to an instance of the Q31 FIR lattice filter structure.
+ * @param[in]     numStages  number of stages in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients.
+ * @param[in,out] *A         points to an instance of the RAM arena structure.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when
+ * the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The state, <code>ARM_FIR_LATTICE_STATE_SIZE(numStages)</code> samples, is allocated from the
+ * arena, aligned on 8 bytes, and the filter is initialized by arm_fir_lattice_init_q31().
+ * In an arena in the CCM data RAM, the state, read and written for every sample, is
+ * accessed with no wait state. With an arena planning the memory, the size is counted
+ * and the instance is not modified.
+ */
+
+arm_status arm_fir_lattice_create_q31(
+  arm_fir_lattice_instance_q31 * S,
+  uint16_t numStages,
+  q31_t *pCoeffs,
+  arm_ram_arena_instance * A)
+{
+  q31_t *pState;                               /* State allocated from the arena */
+
+  pState = (q31_t *) arm_ram_arena_alloc(A, ARM_FIR_LATTICE_STATE_SIZE(numStages) * sizeof(q31_t));
+
+  if(pState == NULL)
+  {
+    /* A planning arena counts the size only */
+    return ((A->pBase == NULL) ? ARM_MATH_SUCCESS : ARM_MATH_LENGTH_ERROR);
+  }
+
+  arm_fir_lattice_init_q31(S, numStages, pCoeffs, pState);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Lattice group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multichannel_f32.c
+*
+* Description:	Floating-point FIR filter processing function on interleaved channels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR filter on interleaved channels.
+ * @param[in]  *S        points to an instance of the floating-point multichannel FIR filter structure.
+ * @param[in]  *pSrc     points to the block of interleaved input data.
+ * @param[out] *pDst     points to the block of interleaved output data.
+ * @param[in]  blockSize number of samples to process per channel.
+ * @return     none.
+ *
+ * \par
+ * <code>pSrc</code> and <code>pDst</code> hold <code>blockSize</code> frames of
+ * <code>numChannels</code> samples, {x0[0], x1[0], ..., x0[1], x1[1], ...}. All the channels
+ * are filtered by the same coefficients. The state buffer keeps the frames interleaved,
+ * so the new block is appended with a single copy and each output frame is computed by
+ * running once through the coefficients: on Cortex-M3 and Cortex-M4 each coefficient
+ * load serves 4 channels, the 4 accumulators staying in registers.
+ */
+
+void arm_fir_multichannel_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0, c0;                            /* Accumulator and coefficient */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numChannels = S->numChannels;         /* Number of interleaved channels */
+  uint32_t i, chan, blkCnt;                      /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* Append the new frames after the numTaps-1 previous ones */
+  memcpy(pState + ((numTaps - 1u) * numChannels), pSrc,
+         blockSize * numChannels * sizeof(float32_t));
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    chan = 0u;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Four channels at a time */
+    while((chan + 3u) < numChannels)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      px = pState + chan;
+      pb = pCoeffs;
+
+      i = numTaps;
+
+      do
+      {
+        /* acc =  b[numTaps-1] * x[n-numTaps+1] +...+ b[0] * x[n], for each channel */
+        c0 = *pb++;
+
+        acc0 += px[0] * c0;
+        acc1 += px[1] * c0;
+        acc2 += px[2] * c0;
+        acc3 += px[3] * c0;
+
+        px += numChannels;
+
+        i--;
+      } while(i > 0u);
+
+      pDst[0] = acc0;
+      pDst[1] = acc1;
+      pDst[2] = acc2;
+      pDst[3] = acc3;
+      pDst += 4u;
+
+      chan += 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* One channel at a time */
+    while(chan < numChannels)
+    {
+      acc0 = 0.0f;
+
+      px = pState + chan;
+      pb = pCoeffs;
+
+      i = numTaps;
+
+      do
+      {
+        c0 = *pb++;
+        acc0 += *px * c0;
+        px += numChannels;
+
+        i--;
+      } while(i > 0u);
+
+      *pDst++ = acc0;
+
+      chan++;
+    }
+
+    /* Advance the state pointer by one frame for the next output frame */
+    pState += numChannels;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1u) * numChannels * sizeof(float32_t));
+}
+
+/**
+ * @} end of FIR group
+ */
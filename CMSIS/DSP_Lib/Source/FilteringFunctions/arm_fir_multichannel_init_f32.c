@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_multichannel_init_f32.c
+*
+* Description:	Floating-point multichannel FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point FIR filter on interleaved channels.
+ * @param[in,out] *S           points to an instance of the floating-point multichannel FIR filter structure.
+ * @param[in]     numTaps      number of filter coefficients in the filter.
+ * @param[in]     numChannels  number of interleaved channels.
+ * @param[in]     *pCoeffs     points to the filter coefficients, in time reversed order.
+ * @param[in]     *pState      points to the state buffer.
+ * @param[in]     blockSize    number of samples per channel that are processed per call.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> holds the interleaved frames of all the channels and must be of length
+ * <code>(numTaps+blockSize-1)*numChannels</code>. The state buffer is cleared.
+ */
+
+void arm_fir_multichannel_init_f32(
+  arm_fir_multichannel_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  /* Assign filter taps, channels and coefficient pointer */
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the state buffer, numTaps+blockSize-1 frames of numChannels samples */
+  memset(pState, 0, (numTaps + (blockSize - 1u)) * numChannels * sizeof(float32_t));
+
+  S->pState = pState;
+}
+
+/**
+ * @} end of FIR group
+ */
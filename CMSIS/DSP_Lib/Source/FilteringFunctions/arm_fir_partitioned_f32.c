@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_partitioned_f32.c
+*
+* Description:	Floating-point FIR filter through uniformly partitioned FFT convolution
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point partitioned FIR filter.
+ * @param[in,out] *S         points to an instance of the floating-point partitioned FIR structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process, a multiple of <code>partLen</code>.
+ * @return none.
+ *
+ * \par Uniformly partitioned convolution:
+ * \par
+ * Overlap-save (arm_fir_fft_f32()) transforms the whole impulse response at once and
+ * processes blocks as long as it, one block of latency. Here the impulse response is cut
+ * into <code>numParts</code> partitions of <code>partLen</code> taps, each transformed once at
+ * initialization by the in-place real FFT of <code>2*partLen</code> points. Each block of
+ * <code>partLen</code> new samples, preceded by the previous block, is transformed once into
+ * the frequency domain delay line, a ring of <code>numParts</code> spectra. The spectrum of
+ * the output is the sum of the products of the partitions by the spectra of the delay line,
+ * the partition p with the block p blocks old, and one inverse real FFT gives the
+ * <code>partLen</code> outputs: the latency is one partition, 64 samples for 8192 taps cut
+ * into 128 partitions.
+ *
+ * \par
+ * The spectra are in the packed format of arm_rfft_fast_f32(): bins 0 and
+ * <code>partLen</code> are real and share the first complex slot.
+ */
+
+void arm_fir_partitioned_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pX, *pH, *pAcc;
+  float32_t xr, xi, hr, hi;
+  uint32_t partLen = S->partLen;
+  uint32_t specLen = 2u * partLen;
+  uint32_t blkCnt, p, slot, k;
+
+  for (blkCnt = blockSize / partLen; blkCnt > 0u; blkCnt--)
+  {
+    /*  Frame of the previous and the new block, transformed in its delay line slot */
+    pX = S->pFdl + (S->fdlIndex * specLen);
+    memcpy(pX, S->pState, partLen * sizeof(float32_t));
+    memcpy(pX + partLen, pSrc, partLen * sizeof(float32_t));
+    memcpy(S->pState, pSrc, partLen * sizeof(float32_t));
+
+    arm_rfft_fast_f32(&S->Srfft, pX, 0u);
+
+    /*  Sum of the products of the partitions by the delay line, newest block first */
+    memset(S->pScratch, 0, specLen * sizeof(float32_t));
+    slot = S->fdlIndex;
+    pH = S->pSpectra;
+
+    for (p = 0u; p < S->numParts; p++)
+    {
+      pX = S->pFdl + (slot * specLen);
+      pAcc = S->pScratch;
+
+      /*  Bins 0 and partLen, real */
+      pAcc[0] += pX[0] * pH[0];
+      pAcc[1] += pX[1] * pH[1];
+
+      for (k = 2u; k < specLen; k += 2u)
+      {
+        xr = pX[k];
+        xi = pX[k + 1u];
+        hr = pH[k];
+        hi = pH[k + 1u];
+
+        pAcc[k] += (xr * hr) - (xi * hi);
+        pAcc[k + 1u] += (xr * hi) + (xi * hr);
+      }
+
+      pH += specLen;
+      slot = (slot == 0u) ? (S->numParts - 1u) : (slot - 1u);
+    }
+
+    /*  Output of the block, past the first partLen values */
+    arm_rfft_fast_f32(&S->Srfft, S->pScratch, 1u);
+    memcpy(pDst, S->pScratch + partLen, partLen * sizeof(float32_t));
+
+    /*  Next slot of the delay line */
+    S->fdlIndex = (S->fdlIndex == (S->numParts - 1u)) ? 0u : (S->fdlIndex + 1u);
+
+    pSrc += partLen;
+    pDst += partLen;
+  }
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_partitioned_init_f32.c
+*
+* Description:	Floating-point partitioned FIR filter initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_FFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point partitioned FIR filter.
+ * @param[in,out] *S         points to an instance of the floating-point partitioned FIR structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients, in time reversed order.
+ * @param[in]     partLen    length of the partitions and latency, a power of two from 16 to 2048.
+ * @param[in]     *pArena    points to the spectra arena of <code>4*numParts*partLen</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>partLen</code> samples.
+ * @param[in]     *pScratch  points to the scratch buffer of <code>2*partLen</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>partLen</code> is not a supported value.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>numParts</code> is <code>numTaps/partLen</code> rounded up. The first half of the arena
+ * receives the spectra of the partitions of the coefficients, the second half is the frequency
+ * domain delay line, cleared with the state buffer. No memory is allocated at run time.
+ */
+
+arm_status arm_fir_partitioned_init_f32(
+  arm_fir_partitioned_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  uint16_t partLen,
+  float32_t * pArena,
+  float32_t * pState,
+  float32_t * pScratch)
+{
+  arm_status status;
+  float32_t *pH;
+  uint32_t specLen = 2u * (uint32_t) partLen;
+  uint32_t p, k, n;
+
+  /*  Real FFT of two partitions, checking the length */
+  status = arm_rfft_fast_init_f32(&S->Srfft, (uint16_t) specLen);
+  if((partLen < 16u) || (status != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->partLen = partLen;
+  S->numParts = (uint16_t) ((numTaps + partLen - 1u) / partLen);
+  S->fdlIndex = 0u;
+  S->pSpectra = pArena;
+  S->pFdl = pArena + (S->numParts * specLen);
+  S->pState = pState;
+  S->pScratch = pScratch;
+
+  /*  Spectra of the partitions b[p*partLen] to b[p*partLen+partLen-1], padded with zeros */
+  pH = S->pSpectra;
+  for (p = 0u; p < S->numParts; p++)
+  {
+    memset(pH, 0, specLen * sizeof(float32_t));
+    for (k = 0u; k < partLen; k++)
+    {
+      n = (p * partLen) + k;
+      if(n < numTaps)
+      {
+        pH[k] = pCoeffs[numTaps - 1u - n];
+      }
+    }
+
+    arm_rfft_fast_f32(&S->Srfft, pH, 0u);
+    pH += specLen;
+  }
+
+  /*  Clear the delay line and the state buffer */
+  memset(S->pFdl, 0, S->numParts * specLen * sizeof(float32_t));
+  memset(pState, 0, partLen * sizeof(float32_t));
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_FFT group
+ */
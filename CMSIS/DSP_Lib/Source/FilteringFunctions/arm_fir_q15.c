@@ -221,6 +221,12 @@ void arm_fir_q15(
     /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 with saturation.       
      ** Then store the 4 outputs in the destination buffer. */
 
+    /* Account the 4 outputs in the saturation statistics */
+    ARM_SAT_STATS_Q15(S, acc0 >> 15);
+    ARM_SAT_STATS_Q15(S, acc1 >> 15);
+    ARM_SAT_STATS_Q15(S, acc2 >> 15);
+    ARM_SAT_STATS_Q15(S, acc3 >> 15);
+
 #ifndef ARM_MATH_BIG_ENDIAN
 
     *__SIMD32(pDst)++ =
@@ -278,6 +284,7 @@ void arm_fir_q15(
 
     /* The result is in 2.30 format.  Convert to 1.15 with saturation.       
      ** Then store the output in the destination buffer. */
+    ARM_SAT_STATS_Q15(S, acc0 >> 15);
     *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
 
     /* Advance state pointer by 1 for the next sample */
@@ -495,6 +502,12 @@ void arm_fir_q15(
     /* The results in the 4 accumulators are in 2.30 format.  Convert to 1.15 with saturation.       
      ** Then store the 4 outputs in the destination buffer. */
 
+    /* Account the 4 outputs in the saturation statistics */
+    ARM_SAT_STATS_Q15(S, acc0 >> 15);
+    ARM_SAT_STATS_Q15(S, acc1 >> 15);
+    ARM_SAT_STATS_Q15(S, acc2 >> 15);
+    ARM_SAT_STATS_Q15(S, acc3 >> 15);
+
 #ifndef ARM_MATH_BIG_ENDIAN
 
     *__SIMD32(pDst)++ =
@@ -547,6 +560,7 @@ void arm_fir_q15(
 
     /* The result is in 2.30 format.  Convert to 1.15 with saturation.      
      ** Then store the output in the destination buffer. */
+    ARM_SAT_STATS_Q15(S, acc0 >> 15);
     *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
 
     /* Advance state pointer by 1 for the next sample */
@@ -649,6 +663,7 @@ void arm_fir_q15(
 
     /* The result is in 2.30 format.  Convert to 1.15         
      ** Then store the output in the destination buffer. */
+    ARM_SAT_STATS_Q15(S, acc >> 15u);
     *pDst++ = (q15_t) __SSAT((acc >> 15u), 16);
 
     /* Advance state pointer by 1 for the next sample */
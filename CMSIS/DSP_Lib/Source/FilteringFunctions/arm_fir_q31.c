@@ -204,6 +204,9 @@ void arm_fir_q31(
 
     /* The results in the 3 accumulators are in 2.30 format.  Convert to 1.31    
      ** Then store the 3 outputs in the destination buffer. */
+    ARM_SAT_STATS_Q31(S, acc0 >> 31u);
+    ARM_SAT_STATS_Q31(S, acc1 >> 31u);
+    ARM_SAT_STATS_Q31(S, acc2 >> 31u);
     *pDst++ = (q31_t) (acc0 >> 31u);
     *pDst++ = (q31_t) (acc1 >> 31u);
     *pDst++ = (q31_t) (acc2 >> 31u);
@@ -240,6 +243,7 @@ void arm_fir_q31(
 
     /* The result is in 2.62 format.  Convert to 1.31    
      ** Then store the output in the destination buffer. */
+    ARM_SAT_STATS_Q31(S, acc0 >> 31u);
     *pDst++ = (q31_t) (acc0 >> 31u);
 
     /* Advance state pointer by 1 for the next sample */
@@ -325,6 +329,7 @@ void arm_fir_q31(
 
     /* The result is in 2.62 format.  Convert to 1.31         
      ** Then store the output in the destination buffer. */
+    ARM_SAT_STATS_Q31(S, acc >> 31u);
     *pDst++ = (q31_t) (acc >> 31u);
 
     /* Advance state pointer by 1 for the next sample */
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_f32.c
+*
+* Description:	Rational L/M polyphase resampler for floating-point sequences.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+ *
+ * These functions change the sample rate by a rational factor <code>L/M</code>, for
+ * example 160/147 from 44.1 kHz to 48 kHz. Conceptually they upsample by <code>L</code>,
+ * filter with a lowpass filter of normalized cutoff <code>1/max(L, M)</code> and
+ * downsample by <code>M</code>, as in the block diagram of arm_fir_interpolate_f32()
+ * followed by arm_fir_decimate_f32(). Chaining these functions would run the filter at
+ * <code>L</code> times the input rate; here only the outputs kept by the downsampler are
+ * computed, each with one branch of the polyphase coefficient bank.
+ *
+ * \par Algorithm:
+ * The upsampled time of output <code>k</code> is <code>k*M = n*L + j</code>, and the output is
+ * the polyphase component <code>j</code> of the filter applied to the input samples up to
+ * <code>x[n]</code>:
+ * <pre>
+ *    y[k] = b[j] * x[n] + b[L+j] * x[n-1] + ... + b[L*(phaseLength-1)+j] * x[n-phaseLength+1]
+ * </pre>
+ * The cost is <code>phaseLength=numTaps/L</code> multiply-accumulates per output sample.
+ * The phase <code>j</code> is kept in the instance between calls, and each call produces
+ * the outputs falling within its block of inputs: between <code>floor(blockSize*L/M)</code>
+ * and <code>ceil(blockSize*L/M)</code> samples, the count being returned.
+ *
+ * \par
+ * <code>pCoeffs</code> points to the prototype filter of <code>numTaps</code> coefficients
+ * designed at the upsampled rate with a gain of <code>L</code>, stored in time reversed
+ * order as for the FIR interpolator. <code>numTaps</code> must be a multiple of <code>L</code>.
+ * <code>pState</code> points to a state array of size <code>phaseLength+blockSize-1</code>
+ * ordered as for the FIR interpolator.
+ *
+ * \par Fractional resampler:
+ * arm_fir_resample_frac_f32() steps through the same coefficient bank by an arbitrary
+ * ratio held in 8.24 format, interpolating linearly between adjacent polyphase branches.
+ * The ratio may be changed between calls, to track the drift between two clocks, for
+ * example from the feedback of an asynchronous USB audio stream.
+ *
+ * \par Fixed-Point Behavior
+ * The accumulators of the fixed-point versions behave as those of the FIR interpolators.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point rational resampler.
+ * @param[in,out] *S        points to an instance of the floating-point rational resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, of at least <code>ceil(blockSize*L/M)</code> samples.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phase = S->phase;                     /* Upsampled time of the next output past the current input */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t outCnt = 0u;                          /* Number of outputs */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Outputs falling between this input and the next one */
+    while(phase < L)
+    {
+      sum = 0.0f;
+
+      px = pState;
+      pb = pCoeffs + ((L - 1u) - phase);
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      i = phaseLen >> 2u;
+
+      while(i > 0u)
+      {
+        sum += px[0] * pb[0];
+        sum += px[1] * pb[L];
+        sum += px[2] * pb[2u * L];
+        sum += px[3] * pb[3u * L];
+
+        px += 4u;
+        pb += 4u * L;
+
+        i--;
+      }
+
+      i = phaseLen % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      i = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(i > 0u)
+      {
+        /* Perform the multiply-accumulate */
+        sum += *px++ * *pb;
+
+        /* Increment the coefficient pointer by upsample factor times. */
+        pb += L;
+
+        i--;
+      }
+
+      /* The result is in the accumulator, store in the destination buffer. */
+      *pDst++ = sum;
+      outCnt++;
+
+      /* Upsampled time of the next output */
+      phase += M;
+    }
+
+    /* Move to the next input */
+    phase -= L;
+
+    /* Advance the state pointer by 1 */
+    pState = pState + 1;
+
+    blkCnt--;
+  }
+
+  S->phase = (uint16_t) phase;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (phaseLen - 1u) * sizeof(float32_t));
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
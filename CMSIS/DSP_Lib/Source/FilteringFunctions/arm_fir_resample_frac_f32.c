@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_frac_f32.c
+*
+* Description:	Fractional ratio polyphase resampler for floating-point sequences.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Output of one polyphase branch.
+ * @param[in]  *px       points to the oldest state sample of the branch.
+ * @param[in]  *pb       points to the first coefficient of the branch.
+ * @param[in]  L         number of branches, the coefficient stride.
+ * @param[in]  phaseLen  length of each branch.
+ * @return     sum of the products of the branch by the state samples.
+ */
+
+static float32_t arm_fir_resample_branch_f32(
+  const float32_t * px,
+  const float32_t * pb,
+  uint32_t L,
+  uint32_t phaseLen)
+{
+  float32_t sum = 0.0f;                          /* Accumulator */
+  uint32_t i;                                    /* Loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling.  Process 4 taps at a time. */
+  i = phaseLen >> 2u;
+
+  while(i > 0u)
+  {
+    sum += px[0] * pb[0];
+    sum += px[1] * pb[L];
+    sum += px[2] * pb[2u * L];
+    sum += px[3] * pb[3u * L];
+
+    px += 4u;
+    pb += 4u * L;
+
+    i--;
+  }
+
+  i = phaseLen % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  i = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(i > 0u)
+  {
+    sum += *px++ * *pb;
+    pb += L;
+
+    i--;
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Processing function for the floating-point fractional ratio resampler.
+ * @param[in,out] *S        points to an instance of the floating-point fractional resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, of at least <code>ceil(blockSize/ratio)</code> samples.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * \par
+ * <code>S->step</code> is the number of input samples per output sample in 8.24 format,
+ * <code>fsIn/fsOut*2^24</code>, and may be written between calls to follow a drifting
+ * clock. Each output position between the inputs <code>x[n]</code> and <code>x[n+1]</code>
+ * falls between two adjacent branches of the <code>L</code> branch coefficient bank, the
+ * branch after the last one being the first branch one input later. The output is the
+ * linear interpolation of the outputs of the two branches, at the cost of
+ * <code>2*phaseLength</code> multiply-accumulates, and is delayed by one input sample
+ * with respect to arm_fir_resample_f32().
+ */
+
+uint32_t arm_fir_resample_frac_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t y0, y1, frac;                        /* Branch outputs and interpolation weight */
+  uint32_t L = S->L;                             /* Number of polyphase branches */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t pos = S->pos;                         /* Position of the next output past x[n], 8.24 */
+  uint32_t step = S->step;                       /* Input samples per output, 8.24 */
+  uint32_t outCnt = 0u;                          /* Number of outputs */
+  uint32_t blkCnt;                               /* Loop counter */
+  q63_t phase;                                   /* Position in branches, 8.24 */
+  uint32_t j;                                    /* Branch index */
+
+  /* S->pState buffer contains previous frame phaseLen samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + phaseLen;
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy new input sample x[n+1] into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Outputs falling between x[n] and x[n+1] */
+    while(pos < 0x1000000u)
+    {
+      phase = (q63_t) pos * L;
+      j = (uint32_t) (phase >> 24u);
+      frac = (float32_t) ((uint32_t) phase & 0xFFFFFFu) * (1.0f / 16777216.0f);
+
+      /* Branches j and j+1 on the samples up to x[n], or the first branch up to x[n+1] */
+      y0 = arm_fir_resample_branch_f32(pState, pCoeffs + ((L - 1u) - j), L, phaseLen);
+
+      if((j + 1u) < L)
+      {
+        y1 = arm_fir_resample_branch_f32(pState, pCoeffs + ((L - 2u) - j), L, phaseLen);
+      }
+      else
+      {
+        y1 = arm_fir_resample_branch_f32(pState + 1, pCoeffs + (L - 1u), L, phaseLen);
+      }
+
+      *pDst++ = y0 + (frac * (y1 - y0));
+      outCnt++;
+
+      pos += step;
+    }
+
+    /* Move to the next input */
+    pos -= 0x1000000u;
+
+    /* Advance the state pointer by 1 */
+    pState = pState + 1;
+
+    blkCnt--;
+  }
+
+  S->pos = pos;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, phaseLen * sizeof(float32_t));
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
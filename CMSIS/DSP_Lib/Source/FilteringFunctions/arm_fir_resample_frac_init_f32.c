@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_frac_init_f32.c
+*
+* Description:	Floating-point fractional ratio resampler initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point fractional ratio resampler.
+ * @param[in,out] *S        points to an instance of the floating-point fractional resampler structure.
+ * @param[in]     L         number of polyphase branches of the coefficient bank.
+ * @param[in]     numTaps   number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+ * @param[in]     *pState   points to the state buffer.
+ * @param[in]     step      input samples per output sample in 8.24 format.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+ * the filter length <code>numTaps</code> is not a multiple of <code>L</code>, or
+ * ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>step</code> is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the prototype filter of <code>numTaps</code> coefficients in
+ * time reversed order, designed at <code>L</code> times the input rate with a gain of
+ * <code>L</code>; the larger <code>L</code>, the smaller the error of the interpolation between
+ * branches. <code>pState</code> points to the array of state variables of length
+ * <code>(numTaps/L)+blockSize</code> words. The state buffer is cleared.
+ */
+
+arm_status arm_fir_resample_frac_init_f32(
+  arm_fir_resample_frac_instance_f32 * S,
+  uint16_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t step,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if((L == 0u) || (step == 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else if((numTaps % L) != 0u)
+  {
+    /* The filter length must be a multiple of the number of branches */
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Assign the bank geometry and the ratio */
+    S->L = L;
+    S->phaseLength = numTaps / L;
+    S->step = step;
+    S->pos = 0u;
+
+    /* Clear state buffer and size of state array is always phaseLength + blockSize */
+    memset(pState, 0,
+           (blockSize + (uint32_t) S->phaseLength) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_init_q15.c
+*
+* Description:	Q15 rational resampler initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 rational resampler.
+ * @param[in,out] *S        points to an instance of the Q15 rational resampler structure.
+ * @param[in]     L         upsample factor.
+ * @param[in]     M         downsample factor.
+ * @param[in]     numTaps   number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+ * @param[in]     *pState   points to the state buffer.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+ * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>, or
+ * ARM_MATH_ARGUMENT_ERROR if a factor is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[numTaps-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables of length
+ * <code>(numTaps/L)+blockSize-1</code> words. The state buffer is cleared and the first output
+ * is aligned with the first input sample.
+ */
+
+arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if((L == 0u) || (M == 0u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else if((numTaps % L) != 0u)
+  {
+    /* The filter length must be a multiple of the upsample factor */
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Assign the factors and the polyphase length */
+    S->L = L;
+    S->M = M;
+    S->phaseLength = numTaps / L;
+    S->phase = 0u;
+
+    /* Clear state buffer and size of state array is always phaseLength + blockSize - 1 */
+    memset(pState, 0,
+           (blockSize +
+            ((uint32_t) S->phaseLength - 1u)) * sizeof(q15_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
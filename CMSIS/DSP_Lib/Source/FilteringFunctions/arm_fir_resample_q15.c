@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_resample_q15.c
+*
+* Description:	Rational L/M polyphase resampler for Q15 sequences.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 rational resampler.
+ * @param[in,out] *S        points to an instance of the Q15 rational resampler structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data, of at least <code>ceil(blockSize*L/M)</code> samples.
+ * @param[in]     blockSize number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As in arm_fir_interpolate_q15(), the 2.30 products are accumulated in a 64-bit accumulator in
+ * 34.30 format without risk of overflow, truncated to 34.15 format and saturated to 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t sum;                                     /* Accumulator */
+  uint32_t L = S->L, M = S->M;                   /* Upsample and downsample factors */
+  uint32_t phase = S->phase;                     /* Upsampled time of the next output past the current input */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t outCnt = 0u;                          /* Number of outputs */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Copy new input sample into the state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Outputs falling between this input and the next one */
+    while(phase < L)
+    {
+      sum = 0;
+
+      px = pState;
+      pb = pCoeffs + ((L - 1u) - phase);
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling.  Process 4 taps at a time. */
+      i = phaseLen >> 2u;
+
+      while(i > 0u)
+      {
+        sum += (q63_t) px[0] * pb[0];
+        sum += (q63_t) px[1] * pb[L];
+        sum += (q63_t) px[2] * pb[2u * L];
+        sum += (q63_t) px[3] * pb[3u * L];
+
+        px += 4u;
+        pb += 4u * L;
+
+        i--;
+      }
+
+      i = phaseLen % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      i = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(i > 0u)
+      {
+        /* Perform the multiply-accumulate */
+        sum += (q63_t) * px++ * *pb;
+
+        /* Increment the coefficient pointer by upsample factor times. */
+        pb += L;
+
+        i--;
+      }
+
+      /* Convert the result and store it in the destination buffer. */
+      *pDst++ = (q15_t) (__SSAT((sum >> 15), 16));
+      outCnt++;
+
+      /* Upsampled time of the next output */
+      phase += M;
+    }
+
+    /* Move to the next input */
+    phase -= L;
+
+    /* Advance the state pointer by 1 */
+    pState = pState + 1;
+
+    blkCnt--;
+  }
+
+  S->phase = (uint16_t) phase;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (phaseLen - 1u) * sizeof(q15_t));
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,195 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sparse_rl_f32.c
+*
+* Description:	Floating-point sparse FIR filter with run-length compressed taps.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Sparse
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point sparse FIR filter with run-length compressed taps.
+ * @param[in]  *S          points to an instance of the floating-point sparse FIR run-length structure.
+ * @param[in]  *pSrc       points to the block of input data.
+ * @param[out] *pDst       points to the block of output data
+ * @param[in]  *pScratchIn points to a temporary buffer of size <code>blockSize+maxRunLength-1</code>.
+ * @param[in]  blockSize   number of input samples to process per call.
+ * @return none.
+ *
+ * \par Runs of taps:
+ * \par
+ * arm_fir_sparse_f32() reads <code>blockSize</code> samples from the circular state
+ * buffer for each tap, wrapping the read index at every sample. The taps of multi-tap
+ * delay lines and early reflections are often clustered, and a run of <code>L</code>
+ * taps of consecutive delays <code>d, ..., d+L-1</code> only needs the
+ * <code>blockSize+L-1</code> contiguous samples ending at delay <code>d</code>. The
+ * wrap of the circular buffer is resolved once per run: the samples are read in place
+ * when they do not cross the end of the buffer, and otherwise gathered by two block
+ * copies into <code>pScratchIn</code>. The run is then computed as a small FIR filter on
+ * these samples, with contiguous loads and without index arithmetic.
+ * \par
+ * The results are identical to those of arm_fir_sparse_f32() for the same taps, up to
+ * the order of the floating-point additions.
+ */
+
+void arm_fir_sparse_rl_f32(
+  arm_fir_sparse_rl_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratchIn,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pSeg;                               /* Samples of the current run */
+  float32_t *px, *pb;                            /* Temporary pointers for samples and coefficients */
+  float32_t acc0;                                /* Accumulator */
+  int32_t *pRunDelay = S->pRunDelay;             /* Smallest delay of each run */
+  uint16_t *pRunLength = S->pRunLength;          /* Number of taps of each run */
+  uint32_t delaySize = S->maxDelay + blockSize;  /* state length */
+  uint32_t runLength, segLength, first;          /* Run length, samples of the run and samples before the wrap */
+  int32_t readIndex;                             /* Read index of the state buffer */
+  uint32_t runCnt, tapCnt, n;                    /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t x0, x1, x2, x3, c0;                  /* Temporary variables to hold state and coefficient values */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* BlockSize of Input samples are copied into the state buffer */
+  /* StateIndex points to the starting position to write in the state buffer */
+  arm_circularWrite_f32((int32_t *) pState, delaySize, &S->stateIndex, 1,
+                        (int32_t *) pSrc, 1, blockSize);
+
+  memset(pDst, 0, blockSize * sizeof(float32_t));
+
+  for (runCnt = S->numRuns; runCnt > 0u; runCnt--)
+  {
+    runLength = *pRunLength++;
+    segLength = blockSize + runLength - 1u;
+
+    /* Index of the oldest sample of the run, x[n-d-L+1] for the first output.
+     * The wrap is resolved once for the whole run. */
+    readIndex = (((int32_t) S->stateIndex - (int32_t) blockSize) - *pRunDelay++) -
+      ((int32_t) runLength - 1);
+
+    if(readIndex < 0)
+    {
+      readIndex += (int32_t) delaySize;
+    }
+
+    if(((uint32_t) readIndex + segLength) <= delaySize)
+    {
+      /* The samples are contiguous in the state buffer */
+      pSeg = pState + readIndex;
+    }
+    else
+    {
+      /* Gather the samples before and after the wrap */
+      first = delaySize - (uint32_t) readIndex;
+      memcpy(pScratchIn, pState + readIndex, first * sizeof(float32_t));
+      memcpy(pScratchIn + first, pState, (segLength - first) * sizeof(float32_t));
+      pSeg = pScratchIn;
+    }
+
+    /* y[n] += b[k] * x[n-d] + b[k+1] * x[n-d-1] + ... + b[k+L-1] * x[n-d-L+1],
+     * the sample x[n-d-j] being at pSeg[n+L-1-j] */
+    n = 0u;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time, sharing each coefficient load */
+    while((n + 3u) < blockSize)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      px = pSeg + n + (runLength - 1u);
+      pb = pCoeffs;
+
+      x1 = px[1];
+      x2 = px[2];
+      x3 = px[3];
+
+      tapCnt = runLength;
+
+      do
+      {
+        c0 = *pb++;
+        x0 = *px--;
+
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      pDst[n] += acc0;
+      pDst[n + 1u] += acc1;
+      pDst[n + 2u] += acc2;
+      pDst[n + 3u] += acc3;
+
+      n += 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(n < blockSize)
+    {
+      acc0 = 0.0f;
+
+      px = pSeg + n + (runLength - 1u);
+      pb = pCoeffs;
+
+      tapCnt = runLength;
+
+      do
+      {
+        acc0 += *px-- * *pb++;
+
+        tapCnt--;
+      } while(tapCnt > 0u);
+
+      pDst[n] += acc0;
+
+      n++;
+    }
+
+    /* Coefficients of the next run */
+    pCoeffs += runLength;
+  }
+}
+
+/**
+ * @} end of FIR_Sparse group
+ */
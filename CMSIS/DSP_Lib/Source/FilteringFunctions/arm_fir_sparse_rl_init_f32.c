@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sparse_rl_init_f32.c
+*
+* Description:	Floating-point sparse FIR filter with run-length compressed taps
+*				initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Sparse
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sparse FIR filter with run-length compressed taps.
+ * @param[in,out] *S          points to an instance of the floating-point sparse FIR run-length structure.
+ * @param[in]     numTaps     number of nonzero coefficients in the filter.
+ * @param[in]     *pCoeffs    points to the array of filter coefficients, in the order of the delays.
+ * @param[in]     *pState     points to the state buffer.
+ * @param[in]     *pTapDelay  points to the array of offset times, in increasing order.
+ * @param[in]     maxDelay    maximum offset time supported.
+ * @param[out]    *pRunDelay  points to an array of <code>numTaps</code> words receiving the delay of each run.
+ * @param[out]    *pRunLength points to an array of <code>numTaps</code> halfwords receiving the length of each run.
+ * @param[in]     blockSize   number of samples that will be processed per block.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> is zero or if the delays are not strictly increasing or exceed
+ * <code>maxDelay</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * The taps of consecutive delays <code>d, d+1, ..., d+L-1</code> are grouped in a run,
+ * stored as its smallest delay <code>d</code> in <code>pRunDelay</code> and its length
+ * <code>L</code> in <code>pRunLength</code>. The two arrays are only used up to
+ * <code>numRuns</code> entries, at most <code>numTaps</code>. <code>pTapDelay</code> is
+ * not referenced by the instance after the call.
+ * \par
+ * <code>pState</code> must be of length <code>maxDelay + blockSize</code>.
+ */
+
+arm_status arm_fir_sparse_rl_init_f32(
+  arm_fir_sparse_rl_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  int32_t * pTapDelay,
+  uint16_t maxDelay,
+  int32_t * pRunDelay,
+  uint16_t * pRunLength,
+  uint32_t blockSize)
+{
+  uint32_t i, numRuns = 0u, maxRunLength = 0u;   /* Loop counter, number and longest length of the runs */
+
+  if((numTaps == 0u) || (pTapDelay[0] < 0) || (pTapDelay[numTaps - 1u] > (int32_t) maxDelay))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numTaps; i++)
+  {
+    if((i > 0u) && (pTapDelay[i] <= pTapDelay[i - 1u]))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    if((i > 0u) && (pTapDelay[i] == (pTapDelay[i - 1u] + 1)))
+    {
+      /* The tap extends the current run */
+      pRunLength[numRuns - 1u]++;
+    }
+    else
+    {
+      /* The tap starts a new run */
+      pRunDelay[numRuns] = pTapDelay[i];
+      pRunLength[numRuns] = 1u;
+      numRuns++;
+    }
+
+    if(pRunLength[numRuns - 1u] > maxRunLength)
+    {
+      maxRunLength = pRunLength[numRuns - 1u];
+    }
+  }
+
+  /* Assign the runs */
+  S->numRuns = (uint16_t) numRuns;
+  S->maxRunLength = (uint16_t) maxRunLength;
+  S->pRunDelay = pRunDelay;
+  S->pRunLength = pRunLength;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Assign MaxDelay */
+  S->maxDelay = maxDelay;
+
+  /* reset the stateIndex to 0 */
+  S->stateIndex = 0u;
+
+  /* Clear state buffer and size is always maxDelay + blockSize */
+  memset(pState, 0, (maxDelay + blockSize) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Sparse group
+ */
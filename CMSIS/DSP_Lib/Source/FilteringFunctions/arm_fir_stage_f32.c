@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_stage_f32.c
+*
+* Description:	Staging of the floating-point FIR filter in fast RAM.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Copies the coefficients and the state of the floating-point FIR filter into a RAM arena.
+ * @param[in,out] *S         points to an instance of the floating-point FIR filter structure.
+ * @param[in,out] *A         points to an instance of the RAM arena structure.
+ * @param[in]     blockSize  number of samples that are processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when
+ * the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The <code>numTaps</code> coefficients and the <code>numTaps+blockSize-1</code> state
+ * samples are copied into the arena, which should be in a RAM with no wait state such as
+ * the CCM data RAM, and <code>S->pCoeffs</code> and <code>S->pState</code> are rebound to
+ * the copies. The filter may be staged after it has run, its state being kept. When the
+ * arena is too small, it is left as it was and the instance is not modified.
+ */
+
+arm_status arm_fir_stage_f32(
+  arm_fir_instance_f32 * S,
+  arm_ram_arena_instance * A,
+  uint32_t blockSize)
+{
+  float32_t *pCoeffs, *pState;                   /* Copies of the coefficients and of the state */
+  uint32_t used = A->used;                       /* Arena allocation before staging */
+
+  pCoeffs = (float32_t *) arm_ram_arena_stage(A, S->pCoeffs, S->numTaps * sizeof(float32_t));
+  pState = (float32_t *) arm_ram_arena_stage(A, S->pState,
+                                               (S->numTaps + blockSize - 1u) * sizeof(float32_t));
+
+  if((pCoeffs == NULL) || (pState == NULL))
+  {
+    /* Release the copies */
+    A->used = used;
+
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sym_f32.c
+*
+* Description:	Floating-point FIR filter with symmetric coefficients.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR filter with symmetric coefficients.
+ * @param[in]  *S        points to an instance of the floating-point symmetric FIR structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     none.
+ *
+ * \par Symmetric coefficients:
+ * \par
+ * The coefficients of a linear phase filter satisfy <code>b[k] = b[numTaps-1-k]</code>.
+ * The two samples sharing a coefficient are added before the multiplication:
+ * <pre>
+ *    y[n] = b[0] * (x[n] + x[n-numTaps+1]) + b[1] * (x[n-1] + x[n-numTaps+2]) + ...
+ * </pre>
+ * which halves the number of multiplications and of coefficient loads. Only the first
+ * <code>(numTaps+1)/2</code> coefficients are stored, <code>pCoeffs</code> pointing to
+ * <code>{b[0], b[1], ..., b[(numTaps-1)/2]}</code>. With an odd <code>numTaps</code> the
+ * center coefficient multiplies a single sample.
+ */
+
+void arm_fir_sym_f32(
+  const arm_fir_sym_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *py, *pb;                       /* Oldest and newest samples and coefficient pointers */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = numTaps >> 1u;             /* Number of coefficients shared by two samples */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Copy the new input samples into the state buffer */
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(float32_t));
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0.0f;
+
+    /* px runs forward from x[n-numTaps+1], py backward from x[n] */
+    px = pState;
+    py = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 coefficients at a time. */
+    i = numPairs >> 2u;
+
+    while(i > 0u)
+    {
+      /* acc +=  b[k] * (x[n-numTaps+1+k] + x[n-k]) */
+      acc0 += (px[0] + py[0]) * pb[0];
+      acc0 += (px[1] + py[-1]) * pb[1];
+      acc0 += (px[2] + py[-2]) * pb[2];
+      acc0 += (px[3] + py[-3]) * pb[3];
+
+      px += 4u;
+      py -= 4u;
+      pb += 4u;
+
+      i--;
+    }
+
+    i = numPairs % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    i = numPairs;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(i > 0u)
+    {
+      acc0 += (*px++ + *py--) * *pb++;
+
+      i--;
+    }
+
+    /* The center coefficient of an odd length filter */
+    if((numTaps & 1u) != 0u)
+    {
+      acc0 += *px * *pb;
+    }
+
+    /* The result is stored in the destination buffer. */
+    *pDst++ = acc0;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState++;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/**
+ * @} end of FIR group
+ */
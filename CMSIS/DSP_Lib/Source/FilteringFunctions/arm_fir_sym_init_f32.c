@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sym_init_f32.c
+*
+* Description:	Floating-point symmetric FIR filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point FIR filter with symmetric coefficients.
+ * @param[in,out] *S         points to an instance of the floating-point symmetric FIR structure.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the first half of the filter coefficients.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     blockSize  number of samples that are processed per call.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the first <code>(numTaps+1)/2</code> coefficients of the
+ * filter, the others being their mirror image:
+ * <pre>
+ *    {b[0], b[1], ..., b[(numTaps-1)/2]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to the array of state variables of length
+ * <code>numTaps+blockSize-1</code>. The state buffer is cleared.
+ */
+
+void arm_fir_sym_init_f32(
+  arm_fir_sym_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  /* Assign filter taps and coefficient pointer */
+  S->numTaps = numTaps;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and the size of state buffer is (blockSize + numTaps - 1) */
+  memset(pState, 0, (numTaps + (blockSize - 1u)) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sym_q15.c
+*
+* Description:	Q15 FIR filter with symmetric coefficients.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 FIR filter with symmetric coefficients.
+ * @param[in]  *S        points to an instance of the Q15 symmetric FIR structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     none.
+ *
+ * \par
+ * On Cortex-M3 and Cortex-M4 two pairs of mirrored samples are added at a time with
+ * <code>__QADD16</code>, the backward pair being swapped by a <code>__PKHBT</code>, and the
+ * two sums are multiplied by two coefficients with <code>__SMLALD</code>.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples sharing a coefficient are added with saturation to 1.15 format. The
+ * result is exact when no sum saturates, which the input signal guarantees when it is
+ * scaled to half of the full scale. The 2.30 products are then accumulated in a 64-bit
+ * accumulator in 34.30 format, which is truncated to 34.15 format and saturated to 1.15
+ * format as in arm_fir_q15(). All the code paths give identical results.
+ */
+
+void arm_fir_sym_q15(
+  const arm_fir_sym_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q15_t *px, *py, *pb;                           /* Oldest and newest samples and coefficient pointers */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = numTaps >> 1u;             /* Number of coefficients shared by two samples */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t x0, x1, c0;                              /* Packed samples and coefficients */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Copy the new input samples into the state buffer */
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(q15_t));
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+
+    /* px runs forward from x[n-numTaps+1], py backward from x[n] */
+    px = pState;
+    py = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Process 2 coefficients at a time. */
+    i = numPairs >> 1u;
+
+    /* py points to the lower sample of the backward pair */
+    py--;
+
+    while(i > 0u)
+    {
+      /* Read x[n-numTaps+1+k] and x[n-numTaps+2+k] */
+      x0 = *__SIMD32(px)++;
+
+      /* Read x[n-k-1] and x[n-k], and swap them */
+      x1 = *__SIMD32(py);
+      x1 = __PKHBT(x1 >> 16, x1, 16);
+      py -= 2u;
+
+      /* Read b[k] and b[k+1] */
+      c0 = *__SIMD32(pb)++;
+
+      /* acc +=  b[k] * (x[n-numTaps+1+k] + x[n-k]) + b[k+1] * (x[n-numTaps+2+k] + x[n-k-1]) */
+      acc0 = __SMLALD(__QADD16(x0, x1), c0, acc0);
+
+      i--;
+    }
+
+    py++;
+
+    i = numPairs & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    i = numPairs;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(i > 0u)
+    {
+      acc0 += (q31_t) __SSAT((q31_t) * px++ + *py--, 16) * *pb++;
+
+      i--;
+    }
+
+    /* The center coefficient of an odd length filter */
+    if((numTaps & 1u) != 0u)
+    {
+      acc0 += (q31_t) * px * *pb;
+    }
+
+    /* The result is in 2.30 format.  Convert to 1.15 with saturation.
+     ** Then store the output in the destination buffer. */
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    /* Advance state pointer by 1 for the next sample */
+    pState++;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(q15_t));
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_fir_sym_q31.c
+*
+* Description:	Q31 FIR filter with symmetric coefficients.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR filter with symmetric coefficients.
+ * @param[in]  *S        points to an instance of the Q31 symmetric FIR structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process per call.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The two samples sharing a coefficient are halved before being added, so that their sum
+ * fits in 1.31 format, and the least significant bit of each is lost. The products of the
+ * halved sums by the 1.31 coefficients are accumulated in a 64-bit accumulator in 3.61
+ * format, which is shifted right by 30 bits and truncated to 1.31 format as in arm_fir_q31().
+ * The input signal should be scaled down by <code>log2(numTaps)</code> bits to avoid overflows.
+ */
+
+void arm_fir_sym_q31(
+  const arm_fir_sym_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+  q31_t *px, *py, *pb;                           /* Oldest and newest samples and coefficient pointers */
+  q63_t acc0;                                    /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = numTaps >> 1u;             /* Number of coefficients shared by two samples */
+  uint32_t i, blkCnt;                            /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1u)]);
+
+  /* Copy the new input samples into the state buffer */
+  memcpy(pStateCurnt, pSrc, blockSize * sizeof(q31_t));
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    acc0 = 0;
+
+    /* px runs forward from x[n-numTaps+1], py backward from x[n] */
+    px = pState;
+    py = pState + (numTaps - 1u);
+    pb = pCoeffs;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Process 4 coefficients at a time. */
+    i = numPairs >> 2u;
+
+    while(i > 0u)
+    {
+      /* acc +=  b[k] * (x[n-numTaps+1+k] + x[n-k]) / 2 */
+      acc0 += (q63_t) ((px[0] >> 1) + (py[0] >> 1)) * pb[0];
+      acc0 += (q63_t) ((px[1] >> 1) + (py[-1] >> 1)) * pb[1];
+      acc0 += (q63_t) ((px[2] >> 1) + (py[-2] >> 1)) * pb[2];
+      acc0 += (q63_t) ((px[3] >> 1) + (py[-3] >> 1)) * pb[3];
+
+      px += 4u;
+      py -= 4u;
+      pb += 4u;
+
+      i--;
+    }
+
+    i = numPairs % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    i = numPairs;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(i > 0u)
+    {
+      acc0 += (q63_t) ((*px++ >> 1) + (*py-- >> 1)) * *pb++;
+
+      i--;
+    }
+
+    /* The center coefficient of an odd length filter, in the same 3.61 format */
+    if((numTaps & 1u) != 0u)
+    {
+      acc0 += ((q63_t) * px * *pb) >> 1;
+    }
+
+    /* The result is in 3.61 format.  Convert to 1.31 and store in the destination buffer. */
+    *pDst++ = (q31_t) (acc0 >> 30);
+
+    /* Advance state pointer by 1 for the next sample */
+    pState++;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(q31_t));
+}
+
+/**
+ * @} end of FIR group
+ */
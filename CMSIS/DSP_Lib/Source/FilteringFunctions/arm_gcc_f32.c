@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_gcc_f32.c
+*
+* Description:	Floating-point FFT based cross-correlation with PHAT weighting
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup GCC Generalized Cross-Correlation
+ *
+ * \par
+ * arm_correlate_f32() computes the correlation of two sequences directly, about
+ * <code>N*M</code> multiply-accumulates: a million for two frames of 1024 samples. The time
+ * delay between two microphones only needs the lags up to the acoustic path between them,
+ * and the correlation is computed here in the frequency domain:
+ * <pre>
+ *   r[l] = sum(a[n] * b[n - l]) = RIFFT(A[k] * conj(B[k]))[l]
+ * </pre>
+ * where A and B are the spectra of the frames padded with zeros to <code>fftLen</code>.
+ * arm_gcc_spectrum_f32() computes the spectrum of each channel once per frame, and each pair
+ * then costs one complex product per bin and one inverse real FFT: four microphone pairs over
+ * four channels take four forward and four inverse FFTs.
+ *
+ * \par
+ * The PHAT weighting (phase transform) divides each bin of the cross-spectrum by its
+ * magnitude, so that all the frequencies weigh the same: the peak gets sharp on
+ * reverberant or narrowband signals, where the plain correlation is broad.
+ *
+ * \par
+ * The lag of the peak is refined by the parabola through the peak and its two neighbours:
+ * <pre>
+ *   lag = l + 0.5 * (r[l-1] - r[l+1]) / (r[l-1] - 2 r[l] + r[l+1])
+ * </pre>
+ * It is not refined at <code>-maxLag</code> and <code>maxLag</code>.
+ *
+ * \par Instance Structure
+ * The instance holds the real FFT of <code>fftLen</code> points and the scratch buffer,
+ * shared by all the channels and pairs of the same frame length. It is initialized by
+ * arm_gcc_init_f32().
+ */
+
+/**
+ * @addtogroup GCC
+ * @{
+ */
+
+/**
+ * @brief Cross-correlation of two channels from their spectra, with the sub-sample lag of its peak.
+ * @param[in]  *S         points to an instance of the floating-point GCC structure.
+ * @param[in]  *pSpecA    points to the spectrum of the channel A, from arm_gcc_spectrum_f32().
+ * @param[in]  *pSpecB    points to the spectrum of the channel B, from arm_gcc_spectrum_f32().
+ * @param[in]  phatFlag   selects the plain (phatFlag=0) or the PHAT weighted (phatFlag=1) correlation.
+ * @param[out] *pCorr     points to the <code>2*maxLag+1</code> correlation values, lags <code>-maxLag</code> to <code>maxLag</code>.
+ * @param[out] *pLag      lag of the peak in samples, positive when A is delayed from B.
+ * @param[out] *pPeak     value of the peak.
+ * @return none.
+ */
+
+void arm_gcc_f32(
+  const arm_gcc_instance_f32 * S,
+  const float32_t * pSpecA,
+  const float32_t * pSpecB,
+  uint8_t phatFlag,
+  float32_t * pCorr,
+  float32_t * pLag,
+  float32_t * pPeak)
+{
+  float32_t *pX = S->pScratch;
+  float32_t ar, ai, br, bi, xr, xi, mag, w;
+  float32_t ym, y0, yp, den, delta;
+  uint32_t fftLen = S->fftLen;
+  uint32_t maxLag = S->maxLag;
+  uint32_t k, peak;
+
+  /*  Cross-spectrum A * conj(B), bins 0 and fftLen/2 real */
+  pX[0] = pSpecA[0] * pSpecB[0];
+  pX[1] = pSpecA[1] * pSpecB[1];
+
+  for (k = 2u; k < fftLen; k += 2u)
+  {
+    ar = pSpecA[k];
+    ai = pSpecA[k + 1u];
+    br = pSpecB[k];
+    bi = pSpecB[k + 1u];
+
+    pX[k] = (ar * br) + (ai * bi);
+    pX[k + 1u] = (ai * br) - (ar * bi);
+  }
+
+  if(phatFlag != 0u)
+  {
+    /*  Unit magnitude bins, the empty ones stay null */
+    pX[0] = (pX[0] > 0.0f) ? 1.0f : ((pX[0] < 0.0f) ? -1.0f : 0.0f);
+    pX[1] = (pX[1] > 0.0f) ? 1.0f : ((pX[1] < 0.0f) ? -1.0f : 0.0f);
+
+    for (k = 2u; k < fftLen; k += 2u)
+    {
+      xr = pX[k];
+      xi = pX[k + 1u];
+      arm_sqrt_f32((xr * xr) + (xi * xi), &mag);
+      w = (mag > 1.0e-20f) ? (1.0f / mag) : 0.0f;
+      pX[k] = xr * w;
+      pX[k + 1u] = xi * w;
+    }
+  }
+
+  arm_rfft_fast_f32(&S->Srfft, pX, 1u);
+
+  /*  Lags -maxLag to -1 at the end of the circular correlation, then 0 to maxLag */
+  memcpy(pCorr, pX + (fftLen - maxLag), maxLag * sizeof(float32_t));
+  memcpy(pCorr + maxLag, pX, (maxLag + 1u) * sizeof(float32_t));
+
+  /*  Peak, refined by the parabola through its neighbours */
+  peak = 0u;
+  for (k = 1u; k <= (2u * maxLag); k++)
+  {
+    if(pCorr[k] > pCorr[peak])
+    {
+      peak = k;
+    }
+  }
+
+  y0 = pCorr[peak];
+  delta = 0.0f;
+  if((peak > 0u) && (peak < (2u * maxLag)))
+  {
+    ym = pCorr[peak - 1u];
+    yp = pCorr[peak + 1u];
+    den = ym - (2.0f * y0) + yp;
+    if(den < 0.0f)
+    {
+      delta = 0.5f * (ym - yp) / den;
+      y0 = y0 - (0.25f * (ym - yp) * delta);
+    }
+  }
+
+  *pLag = ((float32_t) peak - (float32_t) maxLag) + delta;
+  *pPeak = y0;
+}
+
+/**
+ * @} end of GCC group
+ */
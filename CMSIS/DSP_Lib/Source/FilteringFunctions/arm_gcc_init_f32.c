@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_gcc_init_f32.c
+*
+* Description:	Floating-point FFT based cross-correlation initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup GCC
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point FFT based cross-correlation.
+ * @param[in,out] *S         points to an instance of the floating-point GCC structure.
+ * @param[in]     frameLen   number of samples per frame.
+ * @param[in]     maxLag     largest lag searched, below <code>frameLen</code>.
+ * @param[in]     *pScratch  points to the scratch buffer of <code>fftLen</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>frameLen+maxLag</code> exceeds 4096 or <code>maxLag</code> is not below <code>frameLen</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>fftLen</code> is the smallest power of two, 32 to 4096, not below
+ * <code>frameLen+maxLag</code>: the lags up to <code>maxLag</code> do not wrap around the
+ * circular correlation. The scratch buffer and the spectra passed to arm_gcc_f32() hold
+ * <code>fftLen</code> values, 2048 for frames of 1024 samples and lags up to 1024.
+ */
+
+arm_status arm_gcc_init_f32(
+  arm_gcc_instance_f32 * S,
+  uint16_t frameLen,
+  uint16_t maxLag,
+  float32_t * pScratch)
+{
+  uint32_t fftLen = 32u;
+
+  if((frameLen == 0u) || (maxLag >= frameLen) ||
+     (((uint32_t) frameLen + maxLag) > 4096u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  while(fftLen < ((uint32_t) frameLen + maxLag))
+  {
+    fftLen <<= 1u;
+  }
+
+  S->frameLen = frameLen;
+  S->fftLen = (uint16_t) fftLen;
+  S->maxLag = maxLag;
+  S->pScratch = pScratch;
+
+  return (arm_rfft_fast_init_f32(&S->Srfft, (uint16_t) fftLen));
+}
+
+/**
+ * @} end of GCC group
+ */
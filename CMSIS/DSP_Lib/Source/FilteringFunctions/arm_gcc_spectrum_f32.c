@@ -0,0 +1,52 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_gcc_spectrum_f32.c
+*
+* Description:	Floating-point spectrum of a frame for the FFT based cross-correlation
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup GCC
+ * @{
+ */
+
+/**
+ * @brief Spectrum of a frame, computed once per channel and shared by its pairs.
+ * @param[in]  *S     points to an instance of the floating-point GCC structure.
+ * @param[in]  *pSrc  points to the frame of <code>frameLen</code> samples.
+ * @param[out] *pSpec points to the packed spectrum, <code>fftLen</code> values.
+ * @return none.
+ *
+ * \par
+ * The frame, padded with zeros to <code>fftLen</code>, is transformed in
+ * <code>pSpec</code> by the in-place real FFT: the spectrum has the packed format of
+ * arm_rfft_fast_f32().
+ */
+
+void arm_gcc_spectrum_f32(
+  const arm_gcc_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pSpec)
+{
+  memcpy(pSpec, pSrc, S->frameLen * sizeof(float32_t));
+  memset(pSpec + S->frameLen, 0, (S->fftLen - S->frameLen) * sizeof(float32_t));
+
+  arm_rfft_fast_f32(&S->Srfft, pSpec, 0u);
+}
+
+/**
+ * @} end of GCC group
+ */
@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_hampel_f32.c
+*
+* Description:	Floating-point Hampel outlier removal filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static float32_t arm_hampel_select_f32(
+  float32_t * pSrc,
+  int32_t blockSize,
+  int32_t k);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup HampelFilter Hampel Filters
+ *
+ * The Hampel filter removes outliers: each sample is compared to the median
+ * <code>m</code> of the window of <code>windowLen=2*K+1</code> samples centered on it,
+ * and replaced by <code>m</code> when it is too far from it for the spread of the window,
+ * measured by the median absolute deviation (MAD):
+ * <pre>
+ *    MAD  = median(|x[n-K] - m|, ..., |x[n+K] - m|)
+ *    y[n] = m      if |x[n] - m| > threshold * MAD
+ *    y[n] = x[n]   otherwise
+ * </pre>
+ * <code>1.4826*MAD</code> estimates the standard deviation of Gaussian noise, so a
+ * threshold of <code>3*1.4826=4.45</code> replaces the samples farther than three standard
+ * deviations. Samples that are not outliers are passed unchanged.
+ *
+ * \par
+ * The output is delayed by <code>K</code> samples, the window being centered. The median
+ * is tracked with a running median filter, in <code>O(log(windowLen))</code> operations per
+ * sample, and the MAD is selected from the deviations of the window in
+ * <code>O(windowLen)</code> operations on average.
+ *
+ * \par
+ * <code>pState</code> and <code>pIndex</code> are the buffers of the running median filter,
+ * of <code>windowLen</code> samples and <code>2*windowLen</code> halfwords, and
+ * <code>pScratch</code> holds the <code>windowLen</code> deviations.
+ */
+
+/**
+ * @addtogroup HampelFilter
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point Hampel filter.
+ * @param[in,out] *S         points to an instance of the floating-point Hampel filter structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data, delayed by <code>(windowLen-1)/2</code> samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_hampel_f32(
+  arm_hampel_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->median.pState;          /* Samples of the window */
+  float32_t *pScratch = S->pScratch;             /* Deviations of the window */
+  float32_t med, center, mad;                    /* Median, center sample and median absolute deviation */
+  float32_t dev;                                 /* Deviation of the center sample */
+  uint32_t windowLen = S->median.windowLen;      /* Number of samples in the window */
+  uint32_t half = windowLen >> 1u;               /* Delay of the center sample */
+  uint32_t blkCnt, i;                            /* Loop counters */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* Median of the window, with the new sample */
+    arm_median_filter_f32(&S->median, pSrc++, &med, 1u);
+
+    /* Center sample, half samples after the oldest one */
+    i = S->median.stateIndex + half;
+    center = pState[(i >= windowLen) ? (i - windowLen) : i];
+
+    /* Deviations from the median, and their median */
+    for (i = 0u; i < windowLen; i++)
+    {
+      pScratch[i] = fabsf(pState[i] - med);
+    }
+
+    mad = arm_hampel_select_f32(pScratch, (int32_t) windowLen, (int32_t) half);
+
+    dev = fabsf(center - med);
+
+    *pDst++ = (dev > (S->threshold * mad)) ? med : center;
+  }
+}
+
+/**
+ * @} end of HampelFilter group
+ */
+
+/* Returns the k-th smallest of the blockSize values of pSrc, which are reordered */
+static float32_t arm_hampel_select_f32(
+  float32_t * pSrc,
+  int32_t blockSize,
+  int32_t k)
+{
+  float32_t pivot, temp;                         /* Pivot and exchanged value */
+  int32_t lo = 0, hi = blockSize - 1;            /* Bounds of the part holding the k-th value */
+  int32_t i, j;                                  /* Partition indices */
+
+  while(lo < hi)
+  {
+    pivot = pSrc[(lo + hi) >> 1];
+    i = lo;
+    j = hi;
+
+    /* Values not larger than the pivot to the left, not smaller to the right */
+    do
+    {
+      while(pSrc[i] < pivot)
+      {
+        i++;
+      }
+
+      while(pivot < pSrc[j])
+      {
+        j--;
+      }
+
+      if(i <= j)
+      {
+        temp = pSrc[i];
+        pSrc[i] = pSrc[j];
+        pSrc[j] = temp;
+        i++;
+        j--;
+      }
+    } while(i <= j);
+
+    if(k <= j)
+    {
+      hi = j;
+    }
+    else if(k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return (pSrc[k]);
+}
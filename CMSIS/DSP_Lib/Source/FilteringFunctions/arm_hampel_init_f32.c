@@ -0,0 +1,59 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_hampel_init_f32.c
+*
+* Description:	Floating-point Hampel filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup HampelFilter
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Hampel filter.
+ * @param[in,out] *S              points to an instance of the floating-point Hampel filter structure.
+ * @param[in]     windowLen       number of samples in the window, odd, from 1 to 32767.
+ * @param[in]     threshold       threshold of the deviation, in units of the MAD.
+ * @param[in]     *pState         points to the state buffer of <code>windowLen</code> samples.
+ * @param[in]     *pIndex         points to the index buffer of <code>2*windowLen</code> halfwords.
+ * @param[in]     *pScratch       points to a buffer of <code>windowLen</code> samples.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is even or out of range.
+ */
+
+arm_status arm_hampel_init_f32(
+  arm_hampel_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t threshold,
+  float32_t * pState,
+  int16_t * pIndex,
+  float32_t * pScratch)
+{
+  if((windowLen & 1u) == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->threshold = threshold;
+  S->pScratch = pScratch;
+
+  return (arm_median_filter_init_f32(&S->median, windowLen, pState, pIndex));
+}
+
+/**
+ * @} end of HampelFilter group
+ */
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_hampel_init_q31.c
+*
+* Description:	Q31 Hampel filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup HampelFilter
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Hampel filter.
+ * @param[in,out] *S              points to an instance of the Q31 Hampel filter structure.
+ * @param[in]     windowLen       number of samples in the window, odd, from 1 to 32767.
+ * @param[in]     thresholdFract  fractional part of the threshold, in 1.31 format.
+ * @param[in]     thresholdShift  number of bits to shift the threshold left, from 0 to 31.
+ * @param[in]     *pState         points to the state buffer of <code>windowLen</code> samples.
+ * @param[in]     *pIndex         points to the index buffer of <code>2*windowLen</code> halfwords.
+ * @param[in]     *pScratch       points to a buffer of <code>windowLen</code> samples.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is even or out of range.
+ *
+ * <b>Description:</b>
+ * \par
+ * The threshold, in units of the MAD, is <code>thresholdFract * 2^thresholdShift</code>,
+ * as the scale factor of arm_scale_q31(): 4.45 is given by <code>0x472A3055</code> and a
+ * shift of 3.
+ */
+
+arm_status arm_hampel_init_q31(
+  arm_hampel_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t thresholdFract,
+  int8_t thresholdShift,
+  q31_t * pState,
+  int16_t * pIndex,
+  q31_t * pScratch)
+{
+  if((windowLen & 1u) == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->thresholdFract = thresholdFract;
+  S->thresholdShift = thresholdShift;
+  S->pScratch = pScratch;
+
+  return (arm_median_filter_init_q31(&S->median, windowLen, pState, pIndex));
+}
+
+/**
+ * @} end of HampelFilter group
+ */
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_hampel_q31.c
+*
+* Description:	Q31 Hampel outlier removal filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static q31_t arm_hampel_select_q31(
+  q31_t * pSrc,
+  int32_t blockSize,
+  int32_t k);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup HampelFilter
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 Hampel filter.
+ * @param[in,out] *S         points to an instance of the Q31 Hampel filter structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data, delayed by <code>(windowLen-1)/2</code> samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The deviations are computed in 64 bits and saturated to 1.31 format before the
+ * selection of the MAD, which can only reduce a MAD larger than the full scale. The
+ * threshold is applied to the MAD in 64 bits.
+ */
+
+void arm_hampel_q31(
+  arm_hampel_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->median.pState;              /* Samples of the window */
+  q31_t *pScratch = S->pScratch;                 /* Deviations of the window */
+  q31_t med, center, mad;                        /* Median, center sample and median absolute deviation */
+  q63_t dev;                                     /* Deviation of the center sample */
+  uint32_t windowLen = S->median.windowLen;      /* Number of samples in the window */
+  uint32_t half = windowLen >> 1u;               /* Delay of the center sample */
+  uint32_t blkCnt, i;                            /* Loop counters */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* Median of the window, with the new sample */
+    arm_median_filter_q31(&S->median, pSrc++, &med, 1u);
+
+    /* Center sample, half samples after the oldest one */
+    i = S->median.stateIndex + half;
+    center = pState[(i >= windowLen) ? (i - windowLen) : i];
+
+    /* Deviations from the median, and their median */
+    for (i = 0u; i < windowLen; i++)
+    {
+      pScratch[i] = clip_q63_to_q31(((q63_t) pState[i] > med) ? ((q63_t) pState[i] - med) : ((q63_t) med - pState[i]));
+    }
+
+    mad = arm_hampel_select_q31(pScratch, (int32_t) windowLen, (int32_t) half);
+
+    dev = (center > med) ? ((q63_t) center - med) : ((q63_t) med - center);
+
+    *pDst++ = (dev > (((q63_t) mad * S->thresholdFract) >> (31 - S->thresholdShift))) ? med : center;
+  }
+}
+
+/**
+ * @} end of HampelFilter group
+ */
+
+/* Returns the k-th smallest of the blockSize values of pSrc, which are reordered */
+static q31_t arm_hampel_select_q31(
+  q31_t * pSrc,
+  int32_t blockSize,
+  int32_t k)
+{
+  q31_t pivot, temp;                             /* Pivot and exchanged value */
+  int32_t lo = 0, hi = blockSize - 1;            /* Bounds of the part holding the k-th value */
+  int32_t i, j;                                  /* Partition indices */
+
+  while(lo < hi)
+  {
+    pivot = pSrc[(lo + hi) >> 1];
+    i = lo;
+    j = hi;
+
+    /* Values not larger than the pivot to the left, not smaller to the right */
+    do
+    {
+      while(pSrc[i] < pivot)
+      {
+        i++;
+      }
+
+      while(pivot < pSrc[j])
+      {
+        j--;
+      }
+
+      if(i <= j)
+      {
+        temp = pSrc[i];
+        pSrc[i] = pSrc[j];
+        pSrc[j] = temp;
+        i++;
+        j--;
+      }
+    } while(i <= j);
+
+    if(k <= j)
+    {
+      hi = j;
+    }
+    else if(k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return (pSrc[k]);
+}
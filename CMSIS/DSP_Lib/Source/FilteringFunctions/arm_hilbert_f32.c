@@ -0,0 +1,242 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_hilbert_f32.c
+*
+* Description:	Floating-point Hilbert transformer, envelope and
+*               instantaneous frequency.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Hilbert Hilbert Transformer
+ *
+ * Computes the analytic signal <code>x[n-c] + i*y[n]</code> of a real input, where
+ * <code>y</code> is the output of an antisymmetric FIR Hilbert transformer of length
+ * <code>numTaps = 4*K-1</code> and <code>c = 2*K-1</code> its delay. As a half-band filter,
+ * the transformer has every other coefficient equal to zero, the center one included:
+ * <pre>
+ *    h[c+m] = 0 for even m,      h[c-m] = -h[c+m]
+ * </pre>
+ * Only the <code>K</code> distinct nonzero coefficients are multiplied, each by the
+ * difference of the two mirrored samples:
+ * <pre>
+ *    y[n] = sum(k=0..K-1) h[c+2*k+1] * (x[n-c-2*k-1] - x[n-c+2*k+1])
+ * </pre>
+ * an output costs <code>K</code> multiplications where arm_fir_f32() would need
+ * <code>4*K-1</code>, and the real part is the delayed input, without multiplication.
+ *
+ * \par
+ * arm_hilbert_f32() writes the analytic signal as complex interleaved samples, the format
+ * of the complex math functions. arm_hilbert_envelope_f32() and
+ * arm_hilbert_inst_freq_f32() reduce each analytic sample as it is computed, with no
+ * intermediate buffer:
+ * - the envelope is its magnitude, <code>sqrt(x^2 + y^2)</code>;
+ * - the instantaneous frequency is the phase step between two analytic samples,
+ *   <code>atan2(Im(z[n]*conj(z[n-1])), Re(z[n]*conj(z[n-1]))) / (2*pi)</code>, in cycles per
+ *   sample, with the polynomial arctangent of arm_atan2_f32(). Unlike the difference of two
+ *   phases, the step needs no unwrapping.
+ *
+ * \par
+ * The three functions share the state of an instance: a stream is processed by one of them.
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief Analytic sample of the window centered on <code>pCenter</code>.
+ */
+
+static __INLINE void arm_hilbert_sample_f32(
+  const float32_t * pCenter,
+  const float32_t * pCoeffs,
+  uint32_t numPairs,
+  float32_t * pRe,
+  float32_t * pIm)
+{
+  const float32_t *px = pCenter - 1;             /* Older samples, running backward */
+  const float32_t *py = pCenter + 1;             /* Newer samples, running forward */
+  float32_t acc0 = 0.0f;                         /* Accumulator */
+  uint32_t i;                                    /* Loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Loop unrolling.  Process 4 coefficients at a time. */
+  i = numPairs >> 2u;
+
+  while(i > 0u)
+  {
+    /* acc +=  h[c+2*k+1] * (x[n-c-2*k-1] - x[n-c+2*k+1]) */
+    acc0 += (px[0] - py[0]) * pCoeffs[0];
+    acc0 += (px[-2] - py[2]) * pCoeffs[1];
+    acc0 += (px[-4] - py[4]) * pCoeffs[2];
+    acc0 += (px[-6] - py[6]) * pCoeffs[3];
+
+    px -= 8u;
+    py += 8u;
+    pCoeffs += 4u;
+
+    i--;
+  }
+
+  i = numPairs % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  i = numPairs;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(i > 0u)
+  {
+    acc0 += (*px - *py) * *pCoeffs++;
+    px -= 2u;
+    py += 2u;
+
+    i--;
+  }
+
+  *pRe = *pCenter;
+  *pIm = acc0;
+}
+
+/**
+ * @brief Processing function for the floating-point Hilbert transformer.
+ * @param[in]  *S        points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of complex output data, <code>2*blockSize</code> values.
+ * @param[in]  blockSize number of samples to process.
+ * @return     none.
+ */
+
+void arm_hilbert_f32(
+  arm_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Number of nonzero coefficients on each side */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* Copy the new input samples after the numTaps - 1 previous ones */
+  memcpy(S->pState + (numTaps - 1u), pSrc, blockSize * sizeof(float32_t));
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    arm_hilbert_sample_f32(pState + (numTaps >> 1u), S->pCoeffs, numPairs, pDst, pDst + 1);
+    pDst += 2u;
+    pState++;
+  }
+
+  /* Keep the last numTaps - 1 samples for the next call */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/**
+ * @brief Envelope of a floating-point signal, the magnitude of its analytic signal.
+ * @param[in]  *S        points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data.
+ * @param[in]  blockSize number of samples to process.
+ * @return     none.
+ */
+
+void arm_hilbert_envelope_f32(
+  arm_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t re, im;                              /* Analytic sample */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Number of nonzero coefficients on each side */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* Copy the new input samples after the numTaps - 1 previous ones */
+  memcpy(S->pState + (numTaps - 1u), pSrc, blockSize * sizeof(float32_t));
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    arm_hilbert_sample_f32(pState + (numTaps >> 1u), S->pCoeffs, numPairs, &re, &im);
+    arm_sqrt_f32((re * re) + (im * im), pDst++);
+    pState++;
+  }
+
+  /* Keep the last numTaps - 1 samples for the next call */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/**
+ * @brief Instantaneous frequency of a floating-point signal, in cycles per sample.
+ * @param[in]  *S        points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]  *pSrc     points to the block of input data.
+ * @param[out] *pDst     points to the block of output data, between -0.5 and 0.5.
+ * @param[in]  blockSize number of samples to process.
+ * @return     none.
+ *
+ * \par
+ * The output is delayed by <code>c</code> samples, as the analytic signal, and
+ * multiplied by the sample rate gives Hertz. While the signal is zero, the output is 0.
+ */
+
+void arm_hilbert_inst_freq_f32(
+  arm_hilbert_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t re, im;                              /* Analytic sample */
+  float32_t pRe = S->prev[0];                    /* Previous analytic sample */
+  float32_t pIm = S->prev[1];
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t numPairs = (numTaps + 1u) >> 2u;      /* Number of nonzero coefficients on each side */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  /* Copy the new input samples after the numTaps - 1 previous ones */
+  memcpy(S->pState + (numTaps - 1u), pSrc, blockSize * sizeof(float32_t));
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    arm_hilbert_sample_f32(pState + (numTaps >> 1u), S->pCoeffs, numPairs, &re, &im);
+
+    /* Phase of z[n] * conj(z[n-1]) */
+    *pDst++ = arm_atan2_scalar_f32((im * pRe) - (re * pIm), (re * pRe) + (im * pIm)) *
+      (1.0f / (2.0f * PI));
+
+    pRe = re;
+    pIm = im;
+    pState++;
+  }
+
+  S->prev[0] = pRe;
+  S->prev[1] = pIm;
+
+  /* Keep the last numTaps - 1 samples for the next call */
+  memmove(S->pState, pState, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/**
+ * @} end of Hilbert group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_hilbert_init_f32.c
+*
+* Description:	Floating-point Hilbert transformer initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Hilbert
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Hilbert transformer.
+ * @param[in,out] *S         points to an instance of the floating-point Hilbert transformer structure.
+ * @param[in]     numTaps    number of coefficients of the antisymmetric filter, of the form <code>4*K-1</code>.
+ * @param[in]     *pCoeffs   points to the <code>K</code> nonzero coefficients of the second half.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     blockSize  number of samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+ * <code>numTaps</code> is not of the form <code>4*K-1</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * With <code>c = 2*K-1</code> the center of the filter, <code>pCoeffs</code> points to
+ * the <code>K</code> nonzero coefficients after the center:
+ * <pre>
+ *    {h[c+1], h[c+3], ..., h[c+2*K-1]}
+ * </pre>
+ * For a windowed ideal transformer, <code>h[c+m] = w[c+m] * 2/(pi*m)</code> for odd
+ * <code>m</code>.
+ * \par
+ * <code>pState</code> points to the array of state variables of length
+ * <code>numTaps+blockSize-1</code>. The state buffer and the last analytic sample are cleared.
+ */
+
+arm_status arm_hilbert_init_f32(
+  arm_hilbert_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize)
+{
+  arm_status status;
+
+  if((numTaps & 0x3u) != 0x3u)
+  {
+    /* Set status as ARM_MATH_LENGTH_ERROR */
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign filter taps */
+    S->numTaps = numTaps;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and size is always blockSize + numTaps - 1 */
+    memset(pState, 0, (numTaps + (blockSize - 1u)) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    /* No previous analytic sample */
+    S->prev[0] = 0.0f;
+    S->prev[1] = 0.0f;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Hilbert group
+ */
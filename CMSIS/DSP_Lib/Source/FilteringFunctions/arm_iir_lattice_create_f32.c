@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_iir_lattice_create_f32.c
+*
+* Description:	Creation of the floating-point IIR lattice filter in a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup IIR_Lattice
+ * @{
+ */
+
+/**
+ * @brief  Initializes the floating-point IIR lattice filter with its state allocated from a RAM arena.
+ * @param[in,out] *S         points to an instance of the floating-point IIR lattice filter structure.
+ * @param[in]     numStages  number of stages in the filter.
+ * @param[in]     *pkCoeffs  points to the reflection coefficients, numStages values.
+ * @param[in]     *pvCoeffs  points to the ladder coefficients, numStages+1 values.
+ * @param[in]     blockSize  number of samples that are processed per call.
+ * @param[in,out] *A         points to an instance of the RAM arena structure.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when
+ * the arena is too small.
+ *
+ * \par Description:
+ * \par
+ * The state, <code>ARM_IIR_LATTICE_STATE_SIZE(numStages, blockSize)</code> samples, is allocated from the
+ * arena, aligned on 8 bytes, and the filter is initialized by arm_iir_lattice_init_f32().
+ * In an arena in the CCM data RAM, the state, read and written for every sample, is
+ * accessed with no wait state. With an arena planning the memory, the size is counted
+ * and the instance is not modified.
+ */
+
+arm_status arm_iir_lattice_create_f32(
+  arm_iir_lattice_instance_f32 * S,
+  uint16_t numStages,
+  float32_t *pkCoeffs,
+  float32_t *pvCoeffs,
+  uint32_t blockSize,
+  arm_ram_arena_instance * A)
+{
+  float32_t *pState;                           /* State allocated from the arena */
+
+  pState = (float32_t *) arm_ram_arena_alloc(A, ARM_IIR_LATTICE_STATE_SIZE(numStages, blockSize) * sizeof(float32_t));
+
+  if(pState == NULL)
+  {
+    /* A planning arena counts the size only */
+    return ((A->pBase == NULL) ? ARM_MATH_SUCCESS : ARM_MATH_LENGTH_ERROR);
+  }
+
+  arm_iir_lattice_init_f32(S, numStages, pkCoeffs, pvCoeffs, pState, blockSize);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of IIR_Lattice group
+ */
@@ -0,0 +1,252 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_lms_block_norm_f32.c
+*
+* Description:	Floating-point block normalized LMS filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_NORM
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point block normalized LMS filter.
+ * @param[in,out] *S         points to an instance of the floating-point block normalized LMS structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     *pRef      points to the block of reference data.
+ * @param[out]    *pOut      points to the block of output data.
+ * @param[out]    *pErr      points to the block of error data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * \par Block update:
+ * \par
+ * arm_lms_norm_f32() updates the coefficients after each sample. Here the
+ * <code>blockSize</code> outputs and errors of a call are computed with the same
+ * coefficients, which are then updated once with the gradient accumulated over the block:
+ * <pre>
+ *    b[k] = b[k] + mu / (blockSize * E) * (e[0] * x[-k] + e[1] * x[1-k] + ... + e[blockSize-1] * x[blockSize-1-k])
+ * </pre>
+ * where <code>E</code> is the energy of the last <code>numTaps</code> input samples. Both the
+ * filtering and the gradient are then correlations of fixed sequences, which are computed
+ * four outputs or four coefficients at a time on Cortex-M3 and Cortex-M4, sharing each load.
+ * The adaptation is slower for a given <code>mu</code> and the block is typically short,
+ * from 4 to 32 samples. For long filters arm_lms_fd_f32() runs the block update in the
+ * frequency domain.
+ */
+
+void arm_lms_block_norm_f32(
+  arm_lms_block_norm_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *px, *pb, *pe;                       /* Temporary pointers for state, coefficient and error buffers */
+  float32_t energy = S->energy;                  /* Energy of the last numTaps input samples */
+  float32_t x0 = S->x0;                          /* Sample leaving the energy window */
+  float32_t w, in;                               /* Weighting factor and input sample */
+  float32_t acc0;                                /* Accumulator */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t i, n, k;                              /* Loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* Copy the new input samples after the previous numTaps - 1 samples */
+  memcpy(pState + (numTaps - 1u), pSrc, blockSize * sizeof(float32_t));
+
+  /* Update the energy calculation */
+  for (n = 0u; n < blockSize; n++)
+  {
+    in = pState[(numTaps - 1u) + n];
+    energy -= x0 * x0;
+    energy += in * in;
+    x0 = pState[n];
+  }
+
+  n = 0u;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Filter 4 outputs at a time, sharing each coefficient load */
+  while((n + 3u) < blockSize)
+  {
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    px = pState + n;
+    pb = pCoeffs;
+
+    x0 = *px++;
+    x1 = *px++;
+    x2 = *px++;
+
+    i = numTaps;
+
+    do
+    {
+      c0 = *pb++;
+      x3 = *px++;
+
+      acc0 += x0 * c0;
+      acc1 += x1 * c0;
+      acc2 += x2 * c0;
+      acc3 += x3 * c0;
+
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      i--;
+    } while(i > 0u);
+
+    pOut[n] = acc0;
+    pOut[n + 1u] = acc1;
+    pOut[n + 2u] = acc2;
+    pOut[n + 3u] = acc3;
+
+    n += 4u;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(n < blockSize)
+  {
+    acc0 = 0.0f;
+
+    px = pState + n;
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    do
+    {
+      acc0 += *px++ * *pb++;
+      i--;
+    } while(i > 0u);
+
+    pOut[n] = acc0;
+
+    n++;
+  }
+
+  /* Compute and store the errors */
+  for (n = 0u; n < blockSize; n++)
+  {
+    pErr[n] = pRef[n] - pOut[n];
+  }
+
+  /* Calculation of Weighting factor for updating filter coefficients */
+  /* epsilon value 0.000000119209289f */
+  w = S->mu / (((float32_t) blockSize * energy) + 0.000000119209289f);
+
+  k = 0u;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Update 4 coefficients at a time, sharing each error load */
+  while((k + 3u) < numTaps)
+  {
+    acc0 = 0.0f;
+    acc1 = 0.0f;
+    acc2 = 0.0f;
+    acc3 = 0.0f;
+
+    px = pState + k;
+    pe = pErr;
+
+    x0 = *px++;
+    x1 = *px++;
+    x2 = *px++;
+
+    i = blockSize;
+
+    do
+    {
+      c0 = *pe++;
+      x3 = *px++;
+
+      acc0 += x0 * c0;
+      acc1 += x1 * c0;
+      acc2 += x2 * c0;
+      acc3 += x3 * c0;
+
+      x0 = x1;
+      x1 = x2;
+      x2 = x3;
+
+      i--;
+    } while(i > 0u);
+
+    pCoeffs[k] += w * acc0;
+    pCoeffs[k + 1u] += w * acc1;
+    pCoeffs[k + 2u] += w * acc2;
+    pCoeffs[k + 3u] += w * acc3;
+
+    k += 4u;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(k < numTaps)
+  {
+    acc0 = 0.0f;
+
+    px = pState + k;
+    pe = pErr;
+
+    i = blockSize;
+
+    do
+    {
+      acc0 += *px++ * *pe++;
+      i--;
+    } while(i > 0u);
+
+    pCoeffs[k] += w * acc0;
+
+    k++;
+  }
+
+  S->energy = energy;
+  S->x0 = pState[blockSize - 1u];
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  memmove(pState, pState + blockSize, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/**
+ * @} end of LMS_NORM group
+ */
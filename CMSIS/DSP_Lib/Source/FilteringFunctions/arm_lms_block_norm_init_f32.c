@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_lms_block_norm_init_f32.c
+*
+* Description:	Floating-point block normalized LMS filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_NORM
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point block normalized LMS filter.
+ * @param[in,out] *S         points to an instance of the floating-point block normalized LMS structure.
+ * @param[in]     numTaps    number of filter coefficients.
+ * @param[in]     *pCoeffs   points to coefficient buffer.
+ * @param[in]     *pState    points to state buffer.
+ * @param[in]     mu         step size that controls filter coefficient updates.
+ * @param[in]     blockSize  number of samples to process per call, the length of the update blocks.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed
+ * order, as for arm_lms_norm_init_f32(). The initial filter coefficients serve as a starting
+ * point for the adaptive filter. <code>pState</code> points to an array of length
+ * <code>numTaps+blockSize-1</code> samples, which is cleared.
+ */
+
+void arm_lms_block_norm_init_f32(
+  arm_lms_block_norm_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t mu,
+  uint32_t blockSize)
+{
+  /* Assign filter taps */
+  S->numTaps = numTaps;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always blockSize + numTaps - 1 */
+  memset(pState, 0, (numTaps + (blockSize - 1u)) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  /* Assign the step size value */
+  S->mu = mu;
+
+  /* Initialise the energy and the sample leaving its window */
+  S->energy = 0.0f;
+  S->x0 = 0.0f;
+}
+
+/**
+ * @} end of LMS_NORM group
+ */
@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_lms_fd_f32.c
+*
+* Description:	Floating-point partitioned frequency-domain LMS adaptive filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup LMS_FD Frequency-Domain LMS Filters
+ *
+ * The LMS and normalized LMS filters filter and update <code>numTaps</code> coefficients
+ * for every sample, which is too slow for the impulse responses of a few thousand taps met
+ * in acoustic echo cancellation. This filter runs the same adaptation block by block in the
+ * frequency domain, as the multidelay block frequency-domain (MDF) adaptive filter: the
+ * filter is cut into <code>numParts</code> partitions of <code>partLen</code> taps, each
+ * represented by its spectrum, and filtering, error correlation and update are products of
+ * spectra, computed with the real FFT of <code>2*partLen</code> points.
+ *
+ * \par Algorithm:
+ * For each block of <code>partLen</code> new samples:
+ * - the frame of the previous and the new input block is transformed into the frequency
+ *   domain delay line <code>X[p]</code>, <code>X[0]</code> being the newest spectrum, as in
+ *   arm_fir_partitioned_f32();
+ * - the output is the second half of the inverse transform of <code>sum(W[p] * X[p])</code>,
+ *   and the error is <code>e = d - y</code>;
+ * - the power of each bin of the input is tracked by
+ * <pre>
+ *    P[k] = beta * P[k] + (1 - beta) * |X[0][k]|^2
+ * </pre>
+ * - the spectrum <code>E</code> of <code>partLen</code> zeros followed by the error block is
+ *   normalized per bin and each partition is updated:
+ * <pre>
+ *    W[p][k] = W[p][k] + mu / (numParts * P[k]) * conj(X[p][k]) * E[k]
+ * </pre>
+ * \par
+ * The products of spectra correspond to circular correlations, so the second half of the
+ * impulse response of each partition must be kept at zero. One partition per block is
+ * constrained, in turn, by an inverse FFT, a clearing of the second half and an FFT:
+ * each block costs 5 real FFTs and <code>2*numParts</code> spectrum products, that is
+ * <code>O(log(partLen)+numParts)</code> operations per sample where the normalized LMS
+ * filter needs <code>O(numParts*partLen)</code>.
+ *
+ * \par
+ * The step size <code>mu</code>, between 0 and 1, and the power smoothing factor
+ * <code>beta</code> are fields of the instance, which may be changed between calls, for
+ * example to freeze the adaptation during double talk.
+ */
+
+/**
+ * @addtogroup LMS_FD
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point frequency-domain LMS filter.
+ * @param[in,out] *S         points to an instance of the floating-point frequency-domain LMS structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     *pRef      points to the block of reference data.
+ * @param[out]    *pOut      points to the block of output data.
+ * @param[out]    *pErr      points to the block of error data.
+ * @param[in]     blockSize  number of samples to process, a multiple of <code>partLen</code>.
+ * @return none.
+ */
+
+void arm_lms_fd_f32(
+  arm_lms_fd_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pOut,
+  float32_t * pErr,
+  uint32_t blockSize)
+{
+  float32_t *pX, *pW, *pAcc;
+  float32_t *pErrSpec = S->pScratch + (2u * S->partLen);
+  float32_t *pPower = S->pState + S->partLen;
+  float32_t xr, xi, wr, wi, er, ei;
+  float32_t beta = S->beta;
+  float32_t norm = S->mu / (float32_t) S->numParts;
+  uint32_t partLen = S->partLen;
+  uint32_t specLen = 2u * partLen;
+  uint32_t blkCnt, p, slot, k;
+
+  for (blkCnt = blockSize / partLen; blkCnt > 0u; blkCnt--)
+  {
+    /*  Frame of the previous and the new block, transformed in its delay line slot */
+    pX = S->pFdl + (S->fdlIndex * specLen);
+    memcpy(pX, S->pState, partLen * sizeof(float32_t));
+    memcpy(pX + partLen, pSrc, partLen * sizeof(float32_t));
+    memcpy(S->pState, pSrc, partLen * sizeof(float32_t));
+
+    arm_rfft_fast_f32(&S->Srfft, pX, 0u);
+
+    /*  Power of the input in each bin, bins 0 and partLen being real */
+    pPower[0] = (beta * pPower[0]) + ((1.0f - beta) * (pX[0] * pX[0]));
+    pPower[partLen] = (beta * pPower[partLen]) + ((1.0f - beta) * (pX[1] * pX[1]));
+
+    for (k = 1u; k < partLen; k++)
+    {
+      xr = pX[2u * k];
+      xi = pX[(2u * k) + 1u];
+      pPower[k] = (beta * pPower[k]) + ((1.0f - beta) * ((xr * xr) + (xi * xi)));
+    }
+
+    /*  Output spectrum, sum of the products of the partitions by the delay line */
+    memset(S->pScratch, 0, specLen * sizeof(float32_t));
+    slot = S->fdlIndex;
+    pW = S->pCoeffs;
+
+    for (p = 0u; p < S->numParts; p++)
+    {
+      pX = S->pFdl + (slot * specLen);
+      pAcc = S->pScratch;
+
+      pAcc[0] += pX[0] * pW[0];
+      pAcc[1] += pX[1] * pW[1];
+
+      for (k = 2u; k < specLen; k += 2u)
+      {
+        xr = pX[k];
+        xi = pX[k + 1u];
+        wr = pW[k];
+        wi = pW[k + 1u];
+
+        pAcc[k] += (xr * wr) - (xi * wi);
+        pAcc[k + 1u] += (xr * wi) + (xi * wr);
+      }
+
+      pW += specLen;
+      slot = (slot == 0u) ? (S->numParts - 1u) : (slot - 1u);
+    }
+
+    arm_rfft_fast_f32(&S->Srfft, S->pScratch, 1u);
+
+    /*  Output and error of the block, the error frame preceded by zeros */
+    memset(pErrSpec, 0, partLen * sizeof(float32_t));
+
+    for (k = 0u; k < partLen; k++)
+    {
+      pOut[k] = S->pScratch[partLen + k];
+      pErr[k] = pRef[k] - pOut[k];
+      pErrSpec[partLen + k] = pErr[k];
+    }
+
+    arm_rfft_fast_f32(&S->Srfft, pErrSpec, 0u);
+
+    /*  Error spectrum normalized by the power of each bin */
+    /*  epsilon value 0.000000119209289f */
+    pErrSpec[0] *= norm / (pPower[0] + 0.000000119209289f);
+    pErrSpec[1] *= norm / (pPower[partLen] + 0.000000119209289f);
+
+    for (k = 1u; k < partLen; k++)
+    {
+      er = norm / (pPower[k] + 0.000000119209289f);
+      pErrSpec[2u * k] *= er;
+      pErrSpec[(2u * k) + 1u] *= er;
+    }
+
+    /*  W[p] += conj(X[p]) * E, the partition p with the block p blocks old */
+    slot = S->fdlIndex;
+    pW = S->pCoeffs;
+
+    for (p = 0u; p < S->numParts; p++)
+    {
+      pX = S->pFdl + (slot * specLen);
+
+      pW[0] += pX[0] * pErrSpec[0];
+      pW[1] += pX[1] * pErrSpec[1];
+
+      for (k = 2u; k < specLen; k += 2u)
+      {
+        xr = pX[k];
+        xi = pX[k + 1u];
+        er = pErrSpec[k];
+        ei = pErrSpec[k + 1u];
+
+        pW[k] += (xr * er) + (xi * ei);
+        pW[k + 1u] += (xr * ei) - (xi * er);
+      }
+
+      pW += specLen;
+      slot = (slot == 0u) ? (S->numParts - 1u) : (slot - 1u);
+    }
+
+    /*  Constrain one partition to partLen taps, in turn */
+    pW = S->pCoeffs + (S->constrainIndex * specLen);
+    arm_rfft_fast_f32(&S->Srfft, pW, 1u);
+    memset(pW + partLen, 0, partLen * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->Srfft, pW, 0u);
+
+    S->constrainIndex = (S->constrainIndex == (S->numParts - 1u)) ? 0u : (S->constrainIndex + 1u);
+
+    /*  Next slot of the delay line */
+    S->fdlIndex = (S->fdlIndex == (S->numParts - 1u)) ? 0u : (S->fdlIndex + 1u);
+
+    pSrc += partLen;
+    pRef += partLen;
+    pOut += partLen;
+    pErr += partLen;
+  }
+}
+
+/**
+ * @} end of LMS_FD group
+ */
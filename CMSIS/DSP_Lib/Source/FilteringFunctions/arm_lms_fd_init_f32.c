@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_lms_fd_init_f32.c
+*
+* Description:	Floating-point frequency-domain LMS filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup LMS_FD
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point frequency-domain LMS filter.
+ * @param[in,out] *S         points to an instance of the floating-point frequency-domain LMS structure.
+ * @param[in]     numParts   number of partitions of the filter.
+ * @param[in]     partLen    length of the partitions and of the blocks, a power of two from 16 to 2048.
+ * @param[in]     mu         step size, between 0 and 1.
+ * @param[in]     *pArena    points to the spectra arena of <code>4*numParts*partLen</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*partLen+1</code> values.
+ * @param[in]     *pScratch  points to the scratch buffer of <code>4*partLen</code> values.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>partLen</code> is not a supported value or <code>numParts</code> is zero.
+ *
+ * <b>Description:</b>
+ * \par
+ * The filter has <code>numParts*partLen</code> taps, initially zero. The first half of the
+ * arena receives the spectra of the partitions of the coefficients, the second half is the
+ * frequency domain delay line. The state buffer holds the previous input block followed by
+ * the power of the <code>partLen+1</code> bins. All are cleared, and <code>beta</code> is set
+ * to 0.9. No memory is allocated at run time.
+ */
+
+arm_status arm_lms_fd_init_f32(
+  arm_lms_fd_instance_f32 * S,
+  uint16_t numParts,
+  uint16_t partLen,
+  float32_t mu,
+  float32_t * pArena,
+  float32_t * pState,
+  float32_t * pScratch)
+{
+  arm_status status;
+  uint32_t specLen = 2u * (uint32_t) partLen;
+
+  /*  Real FFT of two partitions, checking the length */
+  status = arm_rfft_fast_init_f32(&S->Srfft, (uint16_t) specLen);
+  if((partLen < 16u) || (numParts == 0u) || (status != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->partLen = partLen;
+  S->numParts = numParts;
+  S->fdlIndex = 0u;
+  S->constrainIndex = 0u;
+  S->mu = mu;
+  S->beta = 0.9f;
+  S->pCoeffs = pArena;
+  S->pFdl = pArena + (numParts * specLen);
+  S->pState = pState;
+  S->pScratch = pScratch;
+
+  /*  Clear the coefficients, the delay line, the previous block and the bin powers */
+  memset(pArena, 0, 2u * numParts * specLen * sizeof(float32_t));
+  memset(pState, 0, (specLen + 1u) * sizeof(float32_t));
+
+  return (status);
+}
+
+/**
+ * @} end of LMS_FD group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_median_filter_init_q31.c
+*
+* Description:	Q31 running median filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MedianFilter
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 running median filter.
+ * @param[in,out] *S          points to an instance of the Q31 running median filter structure.
+ * @param[in]     windowLen   number of samples in the window, from 1 to 32767.
+ * @param[in]     *pState     points to the state buffer of <code>windowLen</code> samples.
+ * @param[in]     *pIndex     points to the index buffer of <code>2*windowLen</code> halfwords.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is out of range.
+ *
+ * <b>Description:</b>
+ * \par
+ * The window is filled with zeros, which are placed alternately in the min heap and the
+ * max heap.
+ */
+
+arm_status arm_median_filter_init_q31(
+  arm_median_filter_instance_q31 * S,
+  uint16_t windowLen,
+  q31_t * pState,
+  int16_t * pIndex)
+{
+  int32_t k;                                     /* Loop counter */
+
+  if((windowLen == 0u) || (windowLen > 0x7FFFu))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Clear state buffer */
+  memset(pState, 0, windowLen * sizeof(q31_t));
+
+  S->windowLen = windowLen;
+  S->stateIndex = 0u;
+  S->pState = pState;
+  S->pIndex = pIndex;
+
+  /* The heap positions run from -windowLen/2 to (windowLen-1)/2 */
+  S->pHeap = pIndex + windowLen + (windowLen / 2u);
+
+  /* Sample k at position 0, -1, 1, -2, 2, ... */
+  for (k = 0; k < (int32_t) windowLen; k++)
+  {
+    pIndex[k] = (int16_t) (((k + 1) / 2) * (((k & 1) != 0) ? -1 : 1));
+    S->pHeap[pIndex[k]] = (int16_t) k;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MedianFilter group
+ */
@@ -0,0 +1,229 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_median_filter_q31.c
+*
+* Description:	Q31 running median filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static void arm_median_filter_exchange_q31(
+  arm_median_filter_instance_q31 * S,
+  int32_t i,
+  int32_t j);
+
+static void arm_median_filter_min_down_q31(
+  arm_median_filter_instance_q31 * S,
+  int32_t i);
+
+static void arm_median_filter_max_down_q31(
+  arm_median_filter_instance_q31 * S,
+  int32_t i);
+
+static void arm_median_filter_center_q31(
+  arm_median_filter_instance_q31 * S);
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MedianFilter
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 running median filter.
+ * @param[in,out] *S         points to an instance of the Q31 running median filter structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_median_filter_q31(
+  arm_median_filter_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* Samples of the window */
+  int16_t *pPos = S->pIndex;                     /* Heap position of each sample */
+  int16_t *pHeap = S->pHeap;                     /* Sample index at each heap position */
+  q31_t in, old;                                 /* New and oldest samples */
+  int32_t p;                                     /* Heap position of the oldest sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    /* The new sample replaces the oldest one, at the same heap position */
+    in = *pSrc++;
+    p = pPos[S->stateIndex];
+    old = pState[S->stateIndex];
+    pState[S->stateIndex] = in;
+
+    S->stateIndex++;
+
+    if(S->stateIndex == S->windowLen)
+    {
+      S->stateIndex = 0u;
+    }
+
+    if(p > 0)
+    {
+      /* In the min heap: move down when larger than the replaced sample, up otherwise */
+      if(in > old)
+      {
+        arm_median_filter_min_down_q31(S, p);
+      }
+      else
+      {
+        while((p > 0) && (pState[pHeap[p]] < pState[pHeap[p / 2]]))
+        {
+          arm_median_filter_exchange_q31(S, p, p / 2);
+          p /= 2;
+        }
+
+        if(p == 0)
+        {
+          arm_median_filter_center_q31(S);
+        }
+      }
+    }
+    else if(p < 0)
+    {
+      /* In the max heap: move down when smaller than the replaced sample, up otherwise */
+      if(in < old)
+      {
+        arm_median_filter_max_down_q31(S, p);
+      }
+      else
+      {
+        while((p < 0) && (pState[pHeap[p / 2]] < pState[pHeap[p]]))
+        {
+          arm_median_filter_exchange_q31(S, p / 2, p);
+          p /= 2;
+        }
+
+        if(p == 0)
+        {
+          arm_median_filter_center_q31(S);
+        }
+      }
+    }
+    else
+    {
+      /* The median itself was replaced */
+      arm_median_filter_center_q31(S);
+    }
+
+    /* The median, or the mean of the two middle samples for an even window */
+    if((S->windowLen & 1u) != 0u)
+    {
+      *pDst++ = pState[pHeap[0]];
+    }
+    else
+    {
+      *pDst++ = (q31_t) (((q63_t) pState[pHeap[0]] + pState[pHeap[-1]]) >> 1);
+    }
+  }
+}
+
+/**
+ * @} end of MedianFilter group
+ */
+
+/* Exchanges the samples at heap positions i and j */
+static void arm_median_filter_exchange_q31(
+  arm_median_filter_instance_q31 * S,
+  int32_t i,
+  int32_t j)
+{
+  int16_t *pHeap = S->pHeap;                     /* Sample index at each heap position */
+  int16_t k = pHeap[i];                          /* Exchanged sample index */
+
+  pHeap[i] = pHeap[j];
+  pHeap[j] = k;
+  S->pIndex[pHeap[i]] = (int16_t) i;
+  S->pIndex[pHeap[j]] = (int16_t) j;
+}
+
+/* Moves the sample at position i > 0 down the min heap, positions 1 to (windowLen-1)/2 */
+static void arm_median_filter_min_down_q31(
+  arm_median_filter_instance_q31 * S,
+  int32_t i)
+{
+  q31_t *pState = S->pState;                     /* Samples of the window */
+  int16_t *pHeap = S->pHeap;                     /* Sample index at each heap position */
+  int32_t last = ((int32_t) S->windowLen - 1) / 2; /* Last position of the min heap */
+  int32_t c;                                     /* Smaller child */
+
+  for (c = 2 * i; c <= last; c = 2 * i)
+  {
+    if((c < last) && (pState[pHeap[c + 1]] < pState[pHeap[c]]))
+    {
+      c++;
+    }
+
+    if(!(pState[pHeap[c]] < pState[pHeap[i]]))
+    {
+      break;
+    }
+
+    arm_median_filter_exchange_q31(S, c, i);
+    i = c;
+  }
+}
+
+/* Moves the sample at position i < 0 down the max heap, positions -1 to -windowLen/2 */
+static void arm_median_filter_max_down_q31(
+  arm_median_filter_instance_q31 * S,
+  int32_t i)
+{
+  q31_t *pState = S->pState;                     /* Samples of the window */
+  int16_t *pHeap = S->pHeap;                     /* Sample index at each heap position */
+  int32_t last = -((int32_t) S->windowLen / 2);  /* Last position of the max heap */
+  int32_t c;                                     /* Larger child */
+
+  for (c = 2 * i; c >= last; c = 2 * i)
+  {
+    if((c > last) && (pState[pHeap[c]] < pState[pHeap[c - 1]]))
+    {
+      c--;
+    }
+
+    if(!(pState[pHeap[i]] < pState[pHeap[c]]))
+    {
+      break;
+    }
+
+    arm_median_filter_exchange_q31(S, c, i);
+    i = c;
+  }
+}
+
+/* Restores the order of the median and the roots of the two heaps */
+static void arm_median_filter_center_q31(
+  arm_median_filter_instance_q31 * S)
+{
+  q31_t *pState = S->pState;                     /* Samples of the window */
+  int16_t *pHeap = S->pHeap;                     /* Sample index at each heap position */
+
+  if((S->windowLen > 1u) && (pState[pHeap[0]] < pState[pHeap[-1]]))
+  {
+    arm_median_filter_exchange_q31(S, 0, -1);
+    arm_median_filter_max_down_q31(S, -1);
+  }
+  else if((S->windowLen > 2u) && (pState[pHeap[1]] < pState[pHeap[0]]))
+  {
+    arm_median_filter_exchange_q31(S, 0, 1);
+    arm_median_filter_min_down_q31(S, 1);
+  }
+}
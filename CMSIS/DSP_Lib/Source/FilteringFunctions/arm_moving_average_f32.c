@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_f32.c
+*
+* Description:	Floating-point moving average filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup MovingAverage Moving Average Filters
+ *
+ * The moving average filter outputs the mean of the last <code>windowLen</code> input
+ * samples:
+ * <pre>
+ *    y[n] = (x[n] + x[n-1] + ... + x[n-windowLen+1]) / windowLen
+ * </pre>
+ * It is computed with a running sum, which adds the new sample and subtracts the one
+ * leaving the window: the cost per sample does not depend on <code>windowLen</code>, where
+ * an FIR filter with equal coefficients needs <code>windowLen</code> multiply-accumulates.
+ *
+ * \par
+ * <code>pState</code> holds the <code>windowLen</code> samples of the window, which the
+ * initialization function fills with zeros. The Q15 and Q31 sums are exact, in 32 and 64
+ * bits. The floating-point sum accumulates rounding errors, so it is computed again from
+ * the window each time the window has been renewed.
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point moving average filter.
+ * @param[in,out] *S         points to an instance of the floating-point moving average filter structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_moving_average_f32(
+  arm_moving_average_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* Samples of the window */
+  float32_t sum = S->sum;                        /* Running sum of the window */
+  float32_t in;                                  /* New sample */
+  uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+  uint32_t index = S->stateIndex;                /* Index of the oldest sample */
+  uint32_t blkCnt, i;                            /* Loop counters */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    /* Add the new sample and subtract the one leaving the window */
+    sum += in - pState[index];
+    pState[index] = in;
+
+    index++;
+
+    if(index == windowLen)
+    {
+      index = 0u;
+
+      /* Sum the renewed window again, discarding the accumulated rounding errors */
+      sum = 0.0f;
+
+      for (i = 0u; i < windowLen; i++)
+      {
+        sum += pState[i];
+      }
+    }
+
+    *pDst++ = sum * S->scale;
+  }
+
+  S->sum = sum;
+  S->stateIndex = (uint16_t) index;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
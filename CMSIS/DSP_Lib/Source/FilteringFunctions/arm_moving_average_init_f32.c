@@ -0,0 +1,51 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_init_f32.c
+*
+* Description:	Floating-point moving average filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point moving average filter.
+ * @param[in,out] *S          points to an instance of the floating-point moving average filter structure.
+ * @param[in]     windowLen   number of samples in the window.
+ * @param[in]     *pState     points to the state buffer of <code>windowLen</code> samples.
+ * @return        none.
+ */
+
+void arm_moving_average_init_f32(
+  arm_moving_average_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pState)
+{
+  /* Clear state buffer */
+  memset(pState, 0, windowLen * sizeof(float32_t));
+
+  S->windowLen = windowLen;
+  S->stateIndex = 0u;
+  S->pState = pState;
+  S->sum = 0.0f;
+  S->scale = 1.0f / (float32_t) windowLen;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_init_q15.c
+*
+* Description:	Q15 moving average filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 moving average filter.
+ * @param[in,out] *S          points to an instance of the Q15 moving average filter structure.
+ * @param[in]     windowLen   number of samples in the window.
+ * @param[in]     *pState     points to the state buffer of <code>windowLen</code> samples.
+ * @return        none.
+ */
+
+void arm_moving_average_init_q15(
+  arm_moving_average_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pState)
+{
+  /* Clear state buffer */
+  memset(pState, 0, windowLen * sizeof(q15_t));
+
+  S->windowLen = windowLen;
+  S->stateIndex = 0u;
+  S->pState = pState;
+  S->sum = 0;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
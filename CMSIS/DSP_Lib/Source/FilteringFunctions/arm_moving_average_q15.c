@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_q15.c
+*
+* Description:	Q15 moving average filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 moving average filter.
+ * @param[in,out] *S         points to an instance of the Q15 moving average filter structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum is kept in a 32-bit accumulator, in which it cannot overflow, and the mean is
+ * truncated to 1.15 format.
+ */
+
+void arm_moving_average_q15(
+  arm_moving_average_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* Samples of the window */
+  q31_t sum = S->sum;                            /* Running sum of the window */
+  q15_t in;                                      /* New sample */
+  uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+  uint32_t index = S->stateIndex;                /* Index of the oldest sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    /* Add the new sample and subtract the one leaving the window */
+    sum += (q31_t) in - pState[index];
+    pState[index] = in;
+
+    index++;
+
+    if(index == windowLen)
+    {
+      index = 0u;
+    }
+
+    *pDst++ = (q15_t) (sum / (q31_t) windowLen);
+  }
+
+  S->sum = sum;
+  S->stateIndex = (uint16_t) index;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_average_q31.c
+*
+* Description:	Q31 moving average filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingAverage
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 moving average filter.
+ * @param[in,out] *S         points to an instance of the Q31 moving average filter structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum is kept in a 64-bit accumulator, in which it cannot overflow, and the mean is
+ * truncated to 1.31 format.
+ */
+
+void arm_moving_average_q31(
+  arm_moving_average_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* Samples of the window */
+  q63_t sum = S->sum;                            /* Running sum of the window */
+  q31_t in;                                      /* New sample */
+  uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+  uint32_t index = S->stateIndex;                /* Index of the oldest sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    /* Add the new sample and subtract the one leaving the window */
+    sum += (q63_t) in - pState[index];
+    pState[index] = in;
+
+    index++;
+
+    if(index == windowLen)
+    {
+      index = 0u;
+    }
+
+    *pDst++ = (q31_t) (sum / (q63_t) windowLen);
+  }
+
+  S->sum = sum;
+  S->stateIndex = (uint16_t) index;
+}
+
+/**
+ * @} end of MovingAverage group
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_minmax_f32.c
+*
+* Description:	Floating-point moving minimum and maximum filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup MovingMinMax Moving Minimum and Maximum Filters
+ *
+ * These filters output the minimum and the maximum of the last <code>windowLen</code>
+ * input samples, as used for envelope followers, peak detectors and morphological
+ * erosion and dilation.
+ *
+ * \par Algorithm:
+ * Scanning the window costs <code>windowLen</code> comparisons per sample. Here each
+ * extremum is tracked with a monotonic queue: the queue of the maximum holds the samples
+ * of the window that no later sample exceeds, in decreasing order, with the time of each.
+ * A new sample removes from the back of the queue the samples it exceeds, which can no
+ * longer be the maximum, and is added at the back; the sample at the front leaves when it
+ * leaves the window, and is the maximum. Each sample enters and leaves a queue once, so
+ * the cost is constant per sample on average, whatever <code>windowLen</code>.
+ *
+ * \par
+ * <code>pState</code> holds the two queues of <code>windowLen</code> samples and
+ * <code>pTime</code> the times of their samples. The initialization function starts from
+ * a window of zeros.
+ */
+
+/**
+ * @addtogroup MovingMinMax
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point moving minimum and maximum filter.
+ * @param[in,out] *S         points to an instance of the floating-point moving minimum and maximum structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pMin      points to the block of output minima.
+ * @param[out]    *pMax      points to the block of output maxima.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_moving_minmax_f32(
+  arm_moving_minmax_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMin,
+  float32_t * pMax,
+  uint32_t blockSize)
+{
+  float32_t *pMinVal = S->pState;                /* Queue of the minimum */
+  float32_t *pMaxVal = S->pState + S->windowLen; /* Queue of the maximum */
+  uint32_t *pMinTime = S->pTime;                 /* Times of the queue of the minimum */
+  uint32_t *pMaxTime = S->pTime + S->windowLen;  /* Times of the queue of the maximum */
+  uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+  uint32_t time = S->time;                       /* Time of the new sample */
+  uint32_t minHead = S->minHead, minCount = S->minCount; /* Front and length of the queue of the minimum */
+  uint32_t maxHead = S->maxHead, maxCount = S->maxCount; /* Front and length of the queue of the maximum */
+  uint32_t back;                                 /* Back of a queue */
+  float32_t in;                                  /* New sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    /* Remove the fronts that leave the window */
+    if((minCount > 0u) && ((time - pMinTime[minHead]) >= windowLen))
+    {
+      minHead = (minHead == (windowLen - 1u)) ? 0u : (minHead + 1u);
+      minCount--;
+    }
+
+    if((maxCount > 0u) && ((time - pMaxTime[maxHead]) >= windowLen))
+    {
+      maxHead = (maxHead == (windowLen - 1u)) ? 0u : (maxHead + 1u);
+      maxCount--;
+    }
+
+    /* Remove the backs that can no longer be the minimum, and add the new sample */
+    while(minCount > 0u)
+    {
+      back = minHead + minCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+
+      if(pMinVal[back] < in)
+      {
+        break;
+      }
+
+      minCount--;
+    }
+
+    back = minHead + minCount;
+    back = (back >= windowLen) ? (back - windowLen) : back;
+    pMinVal[back] = in;
+    pMinTime[back] = time;
+    minCount++;
+
+    /* Remove the backs that can no longer be the maximum, and add the new sample */
+    while(maxCount > 0u)
+    {
+      back = maxHead + maxCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+
+      if(pMaxVal[back] > in)
+      {
+        break;
+      }
+
+      maxCount--;
+    }
+
+    back = maxHead + maxCount;
+    back = (back >= windowLen) ? (back - windowLen) : back;
+    pMaxVal[back] = in;
+    pMaxTime[back] = time;
+    maxCount++;
+
+    /* The fronts are the extrema of the window */
+    *pMin++ = pMinVal[minHead];
+    *pMax++ = pMaxVal[maxHead];
+
+    time++;
+  }
+
+  S->time = time;
+  S->minHead = (uint16_t) minHead;
+  S->minCount = (uint16_t) minCount;
+  S->maxHead = (uint16_t) maxHead;
+  S->maxCount = (uint16_t) maxCount;
+}
+
+/**
+ * @} end of MovingMinMax group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_minmax_init_q15.c
+*
+* Description:	Q15 moving minimum and maximum filter initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingMinMax
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 moving minimum and maximum filter.
+ * @param[in,out] *S          points to an instance of the Q15 moving minimum and maximum structure.
+ * @param[in]     windowLen   number of samples in the window.
+ * @param[in]     *pState     points to the state buffer of <code>2*windowLen</code> samples.
+ * @param[in]     *pTime      points to the buffer of <code>2*windowLen</code> words holding the times of the samples.
+ * @return        none.
+ *
+ * <b>Description:</b>
+ * \par
+ * Each queue starts with a zero, dated just before the first sample, which stands for
+ * the window of zeros.
+ */
+
+void arm_moving_minmax_init_q15(
+  arm_moving_minmax_instance_q15 * S,
+  uint16_t windowLen,
+  q15_t * pState,
+  uint32_t * pTime)
+{
+  /* Clear state buffer */
+  memset(pState, 0, (2u * windowLen) * sizeof(q15_t));
+
+  S->windowLen = windowLen;
+  S->pState = pState;
+  S->pTime = pTime;
+  S->time = 0u;
+
+  /* A zero at time -1 in each queue */
+  pTime[0] = 0xFFFFFFFFu;
+  pTime[windowLen] = 0xFFFFFFFFu;
+
+  S->minHead = 0u;
+  S->minCount = 1u;
+  S->maxHead = 0u;
+  S->maxCount = 1u;
+}
+
+/**
+ * @} end of MovingMinMax group
+ */
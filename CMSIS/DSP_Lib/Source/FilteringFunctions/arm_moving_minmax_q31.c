@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_moving_minmax_q31.c
+*
+* Description:	Q31 moving minimum and maximum filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup MovingMinMax
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 moving minimum and maximum filter.
+ * @param[in,out] *S         points to an instance of the Q31 moving minimum and maximum structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pMin      points to the block of output minima.
+ * @param[out]    *pMax      points to the block of output maxima.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_moving_minmax_q31(
+  arm_moving_minmax_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pMin,
+  q31_t * pMax,
+  uint32_t blockSize)
+{
+  q31_t *pMinVal = S->pState;                    /* Queue of the minimum */
+  q31_t *pMaxVal = S->pState + S->windowLen;     /* Queue of the maximum */
+  uint32_t *pMinTime = S->pTime;                 /* Times of the queue of the minimum */
+  uint32_t *pMaxTime = S->pTime + S->windowLen;  /* Times of the queue of the maximum */
+  uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+  uint32_t time = S->time;                       /* Time of the new sample */
+  uint32_t minHead = S->minHead, minCount = S->minCount; /* Front and length of the queue of the minimum */
+  uint32_t maxHead = S->maxHead, maxCount = S->maxCount; /* Front and length of the queue of the maximum */
+  uint32_t back;                                 /* Back of a queue */
+  q31_t in;                                      /* New sample */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    /* Remove the fronts that leave the window */
+    if((minCount > 0u) && ((time - pMinTime[minHead]) >= windowLen))
+    {
+      minHead = (minHead == (windowLen - 1u)) ? 0u : (minHead + 1u);
+      minCount--;
+    }
+
+    if((maxCount > 0u) && ((time - pMaxTime[maxHead]) >= windowLen))
+    {
+      maxHead = (maxHead == (windowLen - 1u)) ? 0u : (maxHead + 1u);
+      maxCount--;
+    }
+
+    /* Remove the backs that can no longer be the minimum, and add the new sample */
+    while(minCount > 0u)
+    {
+      back = minHead + minCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+
+      if(pMinVal[back] < in)
+      {
+        break;
+      }
+
+      minCount--;
+    }
+
+    back = minHead + minCount;
+    back = (back >= windowLen) ? (back - windowLen) : back;
+    pMinVal[back] = in;
+    pMinTime[back] = time;
+    minCount++;
+
+    /* Remove the backs that can no longer be the maximum, and add the new sample */
+    while(maxCount > 0u)
+    {
+      back = maxHead + maxCount - 1u;
+      back = (back >= windowLen) ? (back - windowLen) : back;
+
+      if(pMaxVal[back] > in)
+      {
+        break;
+      }
+
+      maxCount--;
+    }
+
+    back = maxHead + maxCount;
+    back = (back >= windowLen) ? (back - windowLen) : back;
+    pMaxVal[back] = in;
+    pMaxTime[back] = time;
+    maxCount++;
+
+    /* The fronts are the extrema of the window */
+    *pMin++ = pMinVal[minHead];
+    *pMax++ = pMaxVal[maxHead];
+
+    time++;
+  }
+
+  S->time = time;
+  S->minHead = (uint16_t) minHead;
+  S->minCount = (uint16_t) minCount;
+  S->maxHead = (uint16_t) maxHead;
+  S->maxCount = (uint16_t) maxCount;
+}
+
+/**
+ * @} end of MovingMinMax group
+ */
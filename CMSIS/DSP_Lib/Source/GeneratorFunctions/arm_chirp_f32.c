@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_chirp_f32.c
+*
+* Description:	Chirp generator with floating-point output.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @defgroup Chirp Chirp Generator
+ *
+ * The chirp generator sweeps a sine from the frequency <code>f0</code> to the frequency
+ * <code>f1</code> in <code>length</code> samples, then restarts from <code>f0</code>,
+ * for frequency response measurements and built-in self tests. The sine is computed as by
+ * the numerically controlled oscillator, from a 32-bit phase accumulator, and the phase
+ * stays continuous within and between the sweeps.
+ *
+ * For a linear sweep, ARM_CHIRP_LINEAR, the phase increment changes by a constant step
+ * per sample. For a logarithmic sweep, ARM_CHIRP_LOG, it is multiplied by a constant
+ * ratio per sample, so that each octave lasts the same time; the increment is then kept
+ * in floating-point, which costs a multiplication and a conversion per sample. The output
+ * is at full scale.
+ */
+
+/**
+ * @addtogroup Chirp
+ * @{
+ */
+
+/**
+ * @brief  Chirp generator with floating-point output.
+ * @param[in,out]   *S points to an instance of the chirp generator
+ * @param[out]      *pDst points to the output block
+ * @param[in]       blockSize number of samples to generate
+ * @return none.
+ */
+
+void arm_chirp_f32(
+  arm_chirp_instance * S,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Current phase increment */
+  uint32_t count = S->count;                     /* Samples of the current sweep */
+  uint32_t length = S->length;                   /* Samples of a sweep */
+  int32_t incStep = S->incStep;                  /* Change of the increment per sample, linear sweep */
+  float32_t incF = S->incF;                      /* Increment in floating-point, logarithmic sweep */
+  float32_t incRatio = S->incRatio;              /* Ratio of the increment per sample, logarithmic sweep */
+  float32_t scale = 1.0f / 2147483648.0f;        /* 1.31 to floating-point */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  if(S->type == ARM_CHIRP_LINEAR)
+  {
+    while(blkCnt > 0u)
+    {
+      *pDst++ = (float32_t) arm_nco_sin_q31(phase) * scale;
+      phase += phaseInc;
+
+      /* The sweep restarts from the start frequency, with a continuous phase */
+      if(++count == length)
+      {
+        count = 0u;
+        phaseInc = S->incStart;
+      }
+      else
+      {
+        phaseInc += (uint32_t) incStep;
+      }
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      *pDst++ = (float32_t) arm_nco_sin_q31(phase) * scale;
+      phase += phaseInc;
+
+      /* The sweep restarts from the start frequency, with a continuous phase */
+      if(++count == length)
+      {
+        count = 0u;
+        incF = (float32_t) S->incStart;
+      }
+      else
+      {
+        incF *= incRatio;
+      }
+
+      phaseInc = (uint32_t) incF;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    S->incF = incF;
+  }
+
+  S->phase = phase;
+  S->phaseInc = phaseInc;
+  S->count = count;
+}
+
+/**
+ * @} end of Chirp group
+ */
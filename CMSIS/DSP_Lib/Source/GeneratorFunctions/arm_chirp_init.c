@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_chirp_init.c
+*
+* Description:	Initialization function for the chirp generator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @addtogroup Chirp
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the chirp generator.
+ * @param[out]      *S points to an instance of the chirp generator
+ * @param[in]       type linear or logarithmic sweep
+ * @param[in]       f0 start frequency, divided by the sampling frequency, in [0 0.5)
+ * @param[in]       f1 end frequency, divided by the sampling frequency, in [0 0.5)
+ * @param[in]       length number of samples of a sweep
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a frequency is out of range, the
+ * length is 0, or a frequency of a logarithmic sweep is 0.
+ *
+ * \par
+ * <code>f1</code> may be lower than <code>f0</code> for a downward sweep. The sweep
+ * starts at the phase 0.
+ */
+
+arm_status arm_chirp_init(
+  arm_chirp_instance * S,
+  arm_chirp_type type,
+  float32_t f0,
+  float32_t f1,
+  uint32_t length)
+{
+  if((f0 < 0.0f) || (f0 >= 0.5f) || (f1 < 0.0f) || (f1 >= 0.5f) || (length == 0u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if((type == ARM_CHIRP_LOG) && ((f0 == 0.0f) || (f1 == 0.0f)))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Phase increments in 0.32 format */
+  S->incStart = (uint32_t) (f0 * 4294967296.0f);
+  S->incF = (float32_t) S->incStart;
+
+  /* Linear sweep: constant step of the increment, f1 reached after length samples */
+  S->incStep = (int32_t) (((f1 - f0) * 4294967296.0f) / (float32_t) length);
+
+  /* Logarithmic sweep: constant ratio of the increment, (f1 / f0)^(1 / length) */
+  S->incRatio = (type == ARM_CHIRP_LOG) ? expf(logf(f1 / f0) / (float32_t) length) : 1.0f;
+
+  S->phase = 0u;
+  S->phaseInc = S->incStart;
+  S->length = length;
+  S->count = 0u;
+  S->type = type;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Chirp group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_chirp_q15.c
+*
+* Description:	Chirp generator with Q15 output.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @addtogroup Chirp
+ * @{
+ */
+
+/**
+ * @brief  Chirp generator with Q15 output.
+ * @param[in,out]   *S points to an instance of the chirp generator
+ * @param[out]      *pDst points to the output block
+ * @param[in]       blockSize number of samples to generate
+ * @return none.
+ *
+ * The 1.31 sine is rounded to 1.15.
+ */
+
+void arm_chirp_q15(
+  arm_chirp_instance * S,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Current phase increment */
+  uint32_t count = S->count;                     /* Samples of the current sweep */
+  uint32_t length = S->length;                   /* Samples of a sweep */
+  int32_t incStep = S->incStep;                  /* Change of the increment per sample, linear sweep */
+  float32_t incF = S->incF;                      /* Increment in floating-point, logarithmic sweep */
+  float32_t incRatio = S->incRatio;              /* Ratio of the increment per sample, logarithmic sweep */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  if(S->type == ARM_CHIRP_LINEAR)
+  {
+    while(blkCnt > 0u)
+    {
+      *pDst++ = (q15_t) __SSAT(((arm_nco_sin_q31(phase) >> 15) + 1) >> 1, 16);
+      phase += phaseInc;
+
+      /* The sweep restarts from the start frequency, with a continuous phase */
+      if(++count == length)
+      {
+        count = 0u;
+        phaseInc = S->incStart;
+      }
+      else
+      {
+        phaseInc += (uint32_t) incStep;
+      }
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    while(blkCnt > 0u)
+    {
+      *pDst++ = (q15_t) __SSAT(((arm_nco_sin_q31(phase) >> 15) + 1) >> 1, 16);
+      phase += phaseInc;
+
+      /* The sweep restarts from the start frequency, with a continuous phase */
+      if(++count == length)
+      {
+        count = 0u;
+        incF = (float32_t) S->incStart;
+      }
+      else
+      {
+        incF *= incRatio;
+      }
+
+      phaseInc = (uint32_t) incF;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    S->incF = incF;
+  }
+
+  S->phase = phase;
+  S->phaseInc = phaseInc;
+  S->count = count;
+}
+
+/**
+ * @} end of Chirp group
+ */
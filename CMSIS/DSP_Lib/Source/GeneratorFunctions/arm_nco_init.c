@@ -0,0 +1,59 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_init.c
+*
+* Description:	Initialization function for the numerically controlled oscillator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the numerically controlled oscillator.
+ * @param[out]      *S points to an instance of the oscillator
+ * @param[in]       freq frequency, divided by the sampling frequency
+ * @param[in]       phase initial phase, in periods
+ * @return none.
+ *
+ * \par
+ * The frequency and the phase are taken modulo 1: a negative frequency, for the
+ * conjugate of a complex tone, is a frequency close to 1, and the phase 0.25 starts a
+ * cosine.
+ */
+
+void arm_nco_init(
+  arm_nco_instance * S,
+  float32_t freq,
+  float32_t phase)
+{
+  float32_t x;                                   /* Fraction of a period */
+
+  /* Phase increment, frequency modulo 1 in 0.32 format */
+  x = freq - floorf(freq);
+  x = x * 4294967296.0f;
+  S->phaseInc = (x < 4294967296.0f) ? (uint32_t) x : 0u;
+
+  /* Initial phase, modulo 1 in 0.32 format */
+  x = phase - floorf(phase);
+  x = x * 4294967296.0f;
+  S->phase = (x < 4294967296.0f) ? (uint32_t) x : 0u;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_q15.c
+*
+* Description:	Numerically controlled oscillator with Q15 output.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Numerically controlled oscillator with Q15 output.
+ * @param[in,out]   *S points to an instance of the oscillator
+ * @param[out]      *pDst points to the output block
+ * @param[in]       blockSize number of samples to generate
+ * @return none.
+ *
+ * The 1.31 sine is rounded to 1.15.
+ */
+
+void arm_nco_q15(
+  arm_nco_instance * S,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) __SSAT(((arm_nco_sin_q31(phase) >> 15) + 1) >> 1, 16);
+    phase += phaseInc;
+    *pDst++ = (q15_t) __SSAT(((arm_nco_sin_q31(phase) >> 15) + 1) >> 1, 16);
+    phase += phaseInc;
+    *pDst++ = (q15_t) __SSAT(((arm_nco_sin_q31(phase) >> 15) + 1) >> 1, 16);
+    phase += phaseInc;
+    *pDst++ = (q15_t) __SSAT(((arm_nco_sin_q31(phase) >> 15) + 1) >> 1, 16);
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) __SSAT(((arm_nco_sin_q31(phase) >> 15) + 1) >> 1, 16);
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
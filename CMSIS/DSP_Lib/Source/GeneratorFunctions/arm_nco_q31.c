@@ -0,0 +1,205 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nco_q31.c
+*
+* Description:	Numerically controlled oscillator with Q31 output.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @defgroup NCO Numerically Controlled Oscillator
+ *
+ * The numerically controlled oscillator generates a sine from a 32-bit phase accumulator:
+ * <pre>
+ *     pDst[n] = sin(2 * pi * phase / 2^32)
+ *     phase = phase + phaseInc   (modulo 2^32)
+ * </pre>
+ * The increment <code>phaseInc = f / fs * 2^32</code> sets the frequency with a
+ * resolution of <code>fs / 2^32</code>, and the phase wraps around without error, so a
+ * tone stays phase-continuous over any number of blocks, which per-sample calls of
+ * arm_sin_f32() with a growing argument do not. <code>phaseInc</code> can be changed
+ * between two blocks, for frequency modulation or frequency-shift keying, without a
+ * phase jump.
+ *
+ * The sine is interpolated linearly between the 513 points of the table
+ * armNcoSinTableQ31, with an error below 2<sup>-15</sup>. The output is at full scale:
+ * arm_scale_q15() or the conversion functions of the Support group give it the amplitude
+ * and the offset of a DAC.
+ */
+
+/**
+ * @addtogroup NCO
+ * @{
+ */
+
+/**
+ * @brief  Sine table of the signal generators, 512 points per period and the first point repeated, in 1.31 format.
+ */
+const q31_t armNcoSinTableQ31[513] = {
+  0x00000000, 0x01921D20, 0x03242ABF, 0x04B6195D, 0x0647D97C, 0x07D95B9E,
+  0x096A9049, 0x0AFB6805, 0x0C8BD35E, 0x0E1BC2E4, 0x0FAB272B, 0x1139F0CF,
+  0x12C8106E, 0x145576B1, 0x15E21444, 0x176DD9DE, 0x18F8B83C, 0x1A82A025,
+  0x1C0B826A, 0x1D934FE5, 0x1F19F97B, 0x209F701C, 0x2223A4C5, 0x23A6887E,
+  0x25280C5D, 0x26A82185, 0x2826B928, 0x29A3C485, 0x2B1F34EB, 0x2C98FBBA,
+  0x2E110A62, 0x2F875262, 0x30FBC54D, 0x326E54C7, 0x33DEF287, 0x354D9056,
+  0x36BA2013, 0x382493B0, 0x398CDD32, 0x3AF2EEB7, 0x3C56BA70, 0x3DB832A5,
+  0x3F1749B7, 0x4073F21D, 0x41CE1E64, 0x4325C135, 0x447ACD50, 0x45CD358F,
+  0x471CECE6, 0x4869E664, 0x49B41533, 0x4AFB6C97, 0x4C3FDFF3, 0x4D8162C3,
+  0x4EBFE8A4, 0x4FFB654C, 0x5133CC94, 0x5269126E, 0x539B2AEF, 0x54CA0A4A,
+  0x55F5A4D2, 0x571DEEF9, 0x5842DD54, 0x59646497, 0x5A827999, 0x5B9D1153,
+  0x5CB420DF, 0x5DC79D7B, 0x5ED77C89, 0x5FE3B38D, 0x60EC382F, 0x61F1003E,
+  0x62F201AC, 0x63EF328F, 0x64E88925, 0x65DDFBD2, 0x66CF811F, 0x67BD0FBC,
+  0x68A69E80, 0x698C246B, 0x6A6D98A3, 0x6B4AF278, 0x6C24295F, 0x6CF934FB,
+  0x6DCA0D14, 0x6E96A99C, 0x6F5F02B1, 0x70231099, 0x70E2CBC5, 0x719E2CD1,
+  0x72552C84, 0x7307C3CF, 0x73B5EBD0, 0x745F9DD0, 0x7504D344, 0x75A585CE,
+  0x7641AF3C, 0x76D94988, 0x776C4EDA, 0x77FAB988, 0x78848413, 0x7909A92C,
+  0x798A23B0, 0x7A05EEAC, 0x7A7D055A, 0x7AEF6323, 0x7B5D039D, 0x7BC5E28F,
+  0x7C29FBED, 0x7C894BDD, 0x7CE3CEB1, 0x7D3980EB, 0x7D8A5F3F, 0x7DD6668E,
+  0x7E1D93E9, 0x7E5FE492, 0x7E9D55FB, 0x7ED5E5C5, 0x7F0991C3, 0x7F3857F5,
+  0x7F62368E, 0x7F872BF2, 0x7FA736B3, 0x7FC25595, 0x7FD8878D, 0x7FE9CBBF,
+  0x7FF62181, 0x7FFD8859, 0x7FFFFFFF, 0x7FFD8859, 0x7FF62181, 0x7FE9CBBF,
+  0x7FD8878D, 0x7FC25595, 0x7FA736B3, 0x7F872BF2, 0x7F62368E, 0x7F3857F5,
+  0x7F0991C3, 0x7ED5E5C5, 0x7E9D55FB, 0x7E5FE492, 0x7E1D93E9, 0x7DD6668E,
+  0x7D8A5F3F, 0x7D3980EB, 0x7CE3CEB1, 0x7C894BDD, 0x7C29FBED, 0x7BC5E28F,
+  0x7B5D039D, 0x7AEF6323, 0x7A7D055A, 0x7A05EEAC, 0x798A23B0, 0x7909A92C,
+  0x78848413, 0x77FAB988, 0x776C4EDA, 0x76D94988, 0x7641AF3C, 0x75A585CE,
+  0x7504D344, 0x745F9DD0, 0x73B5EBD0, 0x7307C3CF, 0x72552C84, 0x719E2CD1,
+  0x70E2CBC5, 0x70231099, 0x6F5F02B1, 0x6E96A99C, 0x6DCA0D14, 0x6CF934FB,
+  0x6C24295F, 0x6B4AF278, 0x6A6D98A3, 0x698C246B, 0x68A69E80, 0x67BD0FBC,
+  0x66CF811F, 0x65DDFBD2, 0x64E88925, 0x63EF328F, 0x62F201AC, 0x61F1003E,
+  0x60EC382F, 0x5FE3B38D, 0x5ED77C89, 0x5DC79D7B, 0x5CB420DF, 0x5B9D1153,
+  0x5A827999, 0x59646497, 0x5842DD54, 0x571DEEF9, 0x55F5A4D2, 0x54CA0A4A,
+  0x539B2AEF, 0x5269126E, 0x5133CC94, 0x4FFB654C, 0x4EBFE8A4, 0x4D8162C3,
+  0x4C3FDFF3, 0x4AFB6C97, 0x49B41533, 0x4869E664, 0x471CECE6, 0x45CD358F,
+  0x447ACD50, 0x4325C135, 0x41CE1E64, 0x4073F21D, 0x3F1749B7, 0x3DB832A5,
+  0x3C56BA70, 0x3AF2EEB7, 0x398CDD32, 0x382493B0, 0x36BA2013, 0x354D9056,
+  0x33DEF287, 0x326E54C7, 0x30FBC54D, 0x2F875262, 0x2E110A62, 0x2C98FBBA,
+  0x2B1F34EB, 0x29A3C485, 0x2826B928, 0x26A82185, 0x25280C5D, 0x23A6887E,
+  0x2223A4C5, 0x209F701C, 0x1F19F97B, 0x1D934FE5, 0x1C0B826A, 0x1A82A025,
+  0x18F8B83C, 0x176DD9DE, 0x15E21444, 0x145576B1, 0x12C8106E, 0x1139F0CF,
+  0x0FAB272B, 0x0E1BC2E4, 0x0C8BD35E, 0x0AFB6805, 0x096A9049, 0x07D95B9E,
+  0x0647D97C, 0x04B6195D, 0x03242ABF, 0x01921D20, 0x00000000, 0xFE6DE2E0,
+  0xFCDBD541, 0xFB49E6A3, 0xF9B82684, 0xF826A462, 0xF6956FB7, 0xF50497FB,
+  0xF3742CA2, 0xF1E43D1C, 0xF054D8D5, 0xEEC60F31, 0xED37EF92, 0xEBAA894F,
+  0xEA1DEBBC, 0xE8922622, 0xE70747C4, 0xE57D5FDB, 0xE3F47D96, 0xE26CB01B,
+  0xE0E60685, 0xDF608FE4, 0xDDDC5B3B, 0xDC597782, 0xDAD7F3A3, 0xD957DE7B,
+  0xD7D946D8, 0xD65C3B7B, 0xD4E0CB15, 0xD3670446, 0xD1EEF59E, 0xD078AD9E,
+  0xCF043AB3, 0xCD91AB39, 0xCC210D79, 0xCAB26FAA, 0xC945DFED, 0xC7DB6C50,
+  0xC67322CE, 0xC50D1149, 0xC3A94590, 0xC247CD5B, 0xC0E8B649, 0xBF8C0DE3,
+  0xBE31E19C, 0xBCDA3ECB, 0xBB8532B0, 0xBA32CA71, 0xB8E3131A, 0xB796199C,
+  0xB64BEACD, 0xB5049369, 0xB3C0200D, 0xB27E9D3D, 0xB140175C, 0xB0049AB4,
+  0xAECC336C, 0xAD96ED92, 0xAC64D511, 0xAB35F5B6, 0xAA0A5B2E, 0xA8E21107,
+  0xA7BD22AC, 0xA69B9B69, 0xA57D8667, 0xA462EEAD, 0xA34BDF21, 0xA2386285,
+  0xA1288377, 0xA01C4C73, 0x9F13C7D1, 0x9E0EFFC2, 0x9D0DFE54, 0x9C10CD71,
+  0x9B1776DB, 0x9A22042E, 0x99307EE1, 0x9842F044, 0x97596180, 0x9673DB95,
+  0x9592675D, 0x94B50D88, 0x93DBD6A1, 0x9306CB05, 0x9235F2EC, 0x91695664,
+  0x90A0FD4F, 0x8FDCEF67, 0x8F1D343B, 0x8E61D32F, 0x8DAAD37C, 0x8CF83C31,
+  0x8C4A1430, 0x8BA06230, 0x8AFB2CBC, 0x8A5A7A32, 0x89BE50C4, 0x8926B678,
+  0x8893B126, 0x88054678, 0x877B7BED, 0x86F656D4, 0x8675DC50, 0x85FA1154,
+  0x8582FAA6, 0x85109CDD, 0x84A2FC63, 0x843A1D71, 0x83D60413, 0x8376B423,
+  0x831C314F, 0x82C67F15, 0x8275A0C1, 0x82299972, 0x81E26C17, 0x81A01B6E,
+  0x8162AA05, 0x812A1A3B, 0x80F66E3D, 0x80C7A80B, 0x809DC972, 0x8078D40E,
+  0x8058C94D, 0x803DAA6B, 0x80277873, 0x80163441, 0x8009DE7F, 0x800277A7,
+  0x80000001, 0x800277A7, 0x8009DE7F, 0x80163441, 0x80277873, 0x803DAA6B,
+  0x8058C94D, 0x8078D40E, 0x809DC972, 0x80C7A80B, 0x80F66E3D, 0x812A1A3B,
+  0x8162AA05, 0x81A01B6E, 0x81E26C17, 0x82299972, 0x8275A0C1, 0x82C67F15,
+  0x831C314F, 0x8376B423, 0x83D60413, 0x843A1D71, 0x84A2FC63, 0x85109CDD,
+  0x8582FAA6, 0x85FA1154, 0x8675DC50, 0x86F656D4, 0x877B7BED, 0x88054678,
+  0x8893B126, 0x8926B678, 0x89BE50C4, 0x8A5A7A32, 0x8AFB2CBC, 0x8BA06230,
+  0x8C4A1430, 0x8CF83C31, 0x8DAAD37C, 0x8E61D32F, 0x8F1D343B, 0x8FDCEF67,
+  0x90A0FD4F, 0x91695664, 0x9235F2EC, 0x9306CB05, 0x93DBD6A1, 0x94B50D88,
+  0x9592675D, 0x9673DB95, 0x97596180, 0x9842F044, 0x99307EE1, 0x9A22042E,
+  0x9B1776DB, 0x9C10CD71, 0x9D0DFE54, 0x9E0EFFC2, 0x9F13C7D1, 0xA01C4C73,
+  0xA1288377, 0xA2386285, 0xA34BDF21, 0xA462EEAD, 0xA57D8667, 0xA69B9B69,
+  0xA7BD22AC, 0xA8E21107, 0xAA0A5B2E, 0xAB35F5B6, 0xAC64D511, 0xAD96ED92,
+  0xAECC336C, 0xB0049AB4, 0xB140175C, 0xB27E9D3D, 0xB3C0200D, 0xB5049369,
+  0xB64BEACD, 0xB796199C, 0xB8E3131A, 0xBA32CA71, 0xBB8532B0, 0xBCDA3ECB,
+  0xBE31E19C, 0xBF8C0DE3, 0xC0E8B649, 0xC247CD5B, 0xC3A94590, 0xC50D1149,
+  0xC67322CE, 0xC7DB6C50, 0xC945DFED, 0xCAB26FAA, 0xCC210D79, 0xCD91AB39,
+  0xCF043AB3, 0xD078AD9E, 0xD1EEF59E, 0xD3670446, 0xD4E0CB15, 0xD65C3B7B,
+  0xD7D946D8, 0xD957DE7B, 0xDAD7F3A3, 0xDC597782, 0xDDDC5B3B, 0xDF608FE4,
+  0xE0E60685, 0xE26CB01B, 0xE3F47D96, 0xE57D5FDB, 0xE70747C4, 0xE8922622,
+  0xEA1DEBBC, 0xEBAA894F, 0xED37EF92, 0xEEC60F31, 0xF054D8D5, 0xF1E43D1C,
+  0xF3742CA2, 0xF50497FB, 0xF6956FB7, 0xF826A462, 0xF9B82684, 0xFB49E6A3,
+  0xFCDBD541, 0xFE6DE2E0, 0x00000000
+};
+
+/**
+ * @brief  Numerically controlled oscillator with Q31 output.
+ * @param[in,out]   *S points to an instance of the oscillator
+ * @param[out]      *pDst points to the output block
+ * @param[in]       blockSize number of samples to generate
+ * @return none.
+ */
+
+void arm_nco_q31(
+  arm_nco_instance * S,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase accumulator */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_nco_sin_q31(phase);
+    phase += phaseInc;
+    *pDst++ = arm_nco_sin_q31(phase);
+    phase += phaseInc;
+    *pDst++ = arm_nco_sin_q31(phase);
+    phase += phaseInc;
+    *pDst++ = arm_nco_sin_q31(phase);
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_nco_sin_q31(phase);
+    phase += phaseInc;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->phase = phase;
+}
+
+/**
+ * @} end of NCO group
+ */
@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_noise_f32.c
+*
+* Description:	Noise generator with floating-point output.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @defgroup Noise Noise Generator
+ *
+ * The noise generator produces white noise, with a flat spectrum, or pink noise, whose
+ * power falls by 3 dB per octave, at full scale in [-1 +1).
+ *
+ * The random numbers come from the function <code>pRandFunc</code>, such as
+ * <code>RNG_GetRandomNumber()</code> of the STM32F2 and STM32F4 random number generator,
+ * or, when it is NULL, from a 32-bit xorshift generator with a period of
+ * 2<sup>32</sup> - 1. The hardware generator gives a new number every 40 periods of its
+ * clock: for faster output rates, seed the xorshift generator with it at initialization.
+ *
+ * The pink noise is computed with the Voss-McCartney algorithm: the sum of
+ * ARM_NOISE_PINK_ROWS random rows, the row <code>k</code> renewed every
+ * 2<sup>k+1</sup> samples, and of a white row renewed every sample. Its spectrum
+ * follows 1/f, with ripples of about 1 dB, over the ARM_NOISE_PINK_ROWS octaves below
+ * <code>fs / 4</code>, and is flat below them.
+ */
+
+/**
+ * @addtogroup Noise
+ * @{
+ */
+
+/**
+ * @brief  Noise generator with floating-point output.
+ * @param[in,out]   *S points to an instance of the noise generator
+ * @param[out]      *pDst points to the output block
+ * @param[in]       blockSize number of samples to generate
+ * @return none.
+ */
+
+void arm_noise_f32(
+  arm_noise_instance * S,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t scale = 1.0f / 32768.0f;             /* 1.15 to floating-point */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (float32_t) arm_noise_sample_q15(S) * scale;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Noise group
+ */
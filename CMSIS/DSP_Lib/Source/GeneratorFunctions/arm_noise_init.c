@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_noise_init.c
+*
+* Description:	Initialization function for the noise generator.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @addtogroup Noise
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the noise generator.
+ * @param[out]      *S points to an instance of the noise generator
+ * @param[in]       type white or pink noise
+ * @param[in]       *pRandFunc source of 32-bit random numbers, or NULL for the xorshift generator
+ * @param[in]       seed seed of the xorshift generator, 0 is replaced by a fixed seed
+ * @return none.
+ *
+ * \par
+ * The rows of the pink noise start at zero, so its low frequencies take
+ * 2<sup>ARM_NOISE_PINK_ROWS</sup> samples to reach their level.
+ */
+
+void arm_noise_init(
+  arm_noise_instance * S,
+  arm_noise_type type,
+  uint32_t (*pRandFunc) (void),
+  uint32_t seed)
+{
+  S->type = type;
+  S->pRandFunc = pRandFunc;
+
+  /* The xorshift generator stays at 0 from 0 */
+  S->seed = (seed != 0u) ? seed : 0x92D68CA2u;
+
+  S->counter = 0u;
+  S->sum = 0;
+  memset(S->rows, 0, ARM_NOISE_PINK_ROWS * sizeof(q15_t));
+}
+
+/**
+ * @} end of Noise group
+ */
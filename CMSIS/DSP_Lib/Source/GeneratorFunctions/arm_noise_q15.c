@@ -0,0 +1,52 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_noise_q15.c
+*
+* Description:	Noise generator with Q15 output.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupGenerator
+ */
+
+/**
+ * @addtogroup Noise
+ * @{
+ */
+
+/**
+ * @brief  Noise generator with Q15 output.
+ * @param[in,out]   *S points to an instance of the noise generator
+ * @param[out]      *pDst points to the output block
+ * @param[in]       blockSize number of samples to generate
+ * @return none.
+ */
+
+void arm_noise_q15(
+  arm_noise_instance * S,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_noise_sample_q15(S);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Noise group
+ */
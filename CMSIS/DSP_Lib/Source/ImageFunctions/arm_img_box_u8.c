@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_box_u8.c
+*
+* Description:	Box filter of 8-bit images.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @defgroup ImgBox Box Filter
+ *
+ * Averages an image over squares of <code>K</code> x <code>K</code> pixels,
+ * <code>K = 2 * radius + 1</code>:
+ * <pre>
+ *     pDst[y * dstWidth + x] = sum(pSrc[(y + i) * width + x + j]) / K<sup>2</sup>
+ *                              for 0 <= i, j < K
+ * </pre>
+ * with <code>dstWidth = width - K + 1</code>.
+ *
+ * The cost per pixel does not depend on the radius. The sums of the pixels are computed
+ * by differences, as with an integral image, but without storing one: the line buffer
+ * holds the sums of the <code>K</code> last rows of each column, updated for the next
+ * output row by adding the entering row and subtracting the leaving one, two columns at a
+ * time with the dual 16-bit additions. Along the row the sum of <code>K</code> columns is
+ * updated by one addition and one subtraction per pixel. The division by
+ * <code>K<sup>2</sup></code> is a multiplication by its reciprocal.
+ *
+ * The leaving rows are read again from the source image, which must therefore stay in
+ * place during the call.
+ */
+
+/**
+ * @addtogroup ImgBox
+ * @{
+ */
+
+/**
+ * @brief Box filter of an 8-bit image.
+ * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+ * @param[in]       width number of pixels per row
+ * @param[in]       height number of rows
+ * @param[in]       radius radius of the box, from 1 to 63
+ * @param[in]       *pState points to the line buffer of <code>width</code> values
+ * @param[out]      *pDst points to the output image
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sums of the columns, at most <code>127 * 255</code>, fit in 16 bits and the sums of
+ * the boxes in 32 bits. The mean is rounded to the nearest integer.
+ */
+
+arm_status arm_img_box_u8(
+  uint8_t * pSrc,
+  uint16_t width,
+  uint16_t height,
+  uint16_t radius,
+  q15_t * pState,
+  uint8_t * pDst)
+{
+  uint8_t *pIn, *pOut;                           /* Entering and leaving rows */
+  q15_t *pCol;                                   /* Sums of the columns */
+  q31_t sum;                                     /* Sum of the box */
+  uint32_t recip;                                /* 2^24 / K^2 */
+  uint32_t size = (2u * radius) + 1u;            /* Size K of the box */
+  uint32_t dstWidth, dstHeight;                  /* Output size */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t x, y;                                 /* loop counters */
+#ifndef ARM_MATH_CM0
+  q31_t in, out, even, odd, diff0, diff1;        /* Pixels and differences, in pairs */
+#endif
+
+  if((radius < 1u) || (radius > 63u))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  if((width < size) || (height < size))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  dstWidth = (uint32_t) width - size + 1u;
+  dstHeight = (uint32_t) height - size + 1u;
+  recip = ((1u << 24) + ((size * size) >> 1u)) / (size * size);
+
+  /* Sums of the first K rows */
+  arm_fill_q15(0, pState, width);
+  pIn = pSrc;
+
+  for (y = 0u; y < size; y++)
+  {
+    pCol = pState;
+    for (x = 0u; x < (uint32_t) width; x++)
+    {
+      *pCol++ += *pIn++;
+    }
+  }
+
+  for (y = 0u; y < dstHeight; y++)
+  {
+    if(y > 0u)
+    {
+      /* Row y + K - 1 enters the box and row y - 1 leaves it */
+      pIn = pSrc + ((y + size - 1u) * width);
+      pOut = pSrc + ((y - 1u) * width);
+      pCol = pState;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      blkCnt = (uint32_t) width >> 2u;
+
+      while(blkCnt > 0u)
+      {
+        in = *__SIMD32(pIn)++;
+        out = *__SIMD32(pOut)++;
+
+        /* differences of bytes 0 and 2, and of bytes 1 and 3 */
+        even = __QSUB16((q31_t) __UXTB16((uint32_t) in), (q31_t) __UXTB16((uint32_t) out));
+        odd = __QSUB16((q31_t) __UXTB16((uint32_t) in >> 8),
+                       (q31_t) __UXTB16((uint32_t) out >> 8));
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+        diff0 = __PKHBT(even, odd, 16);
+        diff1 = __PKHTB(odd, even, 16);
+
+#else
+
+        diff0 = __PKHTB(odd, even, 16);
+        diff1 = __PKHBT(even, odd, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+        *__SIMD32(pCol) = __QADD16(*__SIMD32(pCol), diff0);
+        pCol += 2;
+        *__SIMD32(pCol) = __QADD16(*__SIMD32(pCol), diff1);
+        pCol += 2;
+
+        blkCnt--;
+      }
+
+      blkCnt = (uint32_t) width % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+      blkCnt = width;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(blkCnt > 0u)
+      {
+        *pCol++ += (q15_t) (*pIn++ - *pOut++);
+
+        blkCnt--;
+      }
+    }
+
+    /* Sum of the first K columns, then slid along the row */
+    pCol = pState;
+    sum = 0;
+    for (x = 0u; x < size; x++)
+    {
+      sum += pCol[x];
+    }
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+      *pDst++ = (uint8_t) __USAT((q31_t) ((((q63_t) sum * recip) + (1 << 23)) >> 24), 8);
+
+      if(x + 1u < dstWidth)
+      {
+        sum += pCol[x + size] - pCol[x];
+      }
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of ImgBox group
+ */
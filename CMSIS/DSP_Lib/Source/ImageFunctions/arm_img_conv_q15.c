@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_conv_q15.c
+*
+* Description:	3x3 and 5x5 convolution of Q15 images.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @addtogroup ImgConv
+ * @{
+ */
+
+/**
+ * @brief 3x3 or 5x5 convolution of a Q15 image.
+ * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+ * @param[in]       width number of pixels per row
+ * @param[in]       height number of rows
+ * @param[in]       *pKernel points to the <code>kernelSize</code> x <code>kernelSize</code> Q15 coefficients
+ * @param[in]       kernelSize 3 or 5
+ * @param[out]      *pDst points to the output image
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 1.15 by 1.15 products are accumulated in a 64-bit accumulator in 34.30 format
+ * without overflow. The accumulator is truncated to 34.15 format and saturated to 1.15
+ * format.
+ * \par
+ * No line buffer is needed: the rows of the window are read in place.
+ */
+
+arm_status arm_img_conv_q15(
+  q15_t * pSrc,
+  uint16_t width,
+  uint16_t height,
+  q15_t * pKernel,
+  uint16_t kernelSize,
+  q15_t * pDst)
+{
+  q15_t coef[30] = {0};                          /* Coefficients, rows of 6 */
+  q15_t *px;                                     /* Pixels of the current row */
+  q15_t *pk;                                     /* Coefficients of the current row */
+  q63_t acc;                                     /* Accumulator */
+#ifndef ARM_MATH_CM0
+  q31_t kPair[5][2];                             /* Pairs of coefficients of each row */
+#endif
+  uint32_t dstWidth, dstHeight;                  /* Output size */
+  uint32_t x, y, i;                              /* loop counters */
+#ifdef ARM_MATH_CM0
+  uint32_t j;                                    /* loop counter */
+#endif
+
+  if((kernelSize != 3u) && (kernelSize != 5u))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  if((width < kernelSize) || (height < kernelSize))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  dstWidth = (uint32_t) width - kernelSize + 1u;
+  dstHeight = (uint32_t) height - kernelSize + 1u;
+
+  for (i = 0u; i < (uint32_t) kernelSize * kernelSize; i++)
+  {
+    coef[((i / kernelSize) * 6u) + (i % kernelSize)] = pKernel[i];
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Pairs of coefficients read as the pairs of pixels, the last one of each row being
+   ** multiplied alone */
+  for (i = 0u; i < kernelSize; i++)
+  {
+    pk = &coef[i * 6u];
+    kPair[i][0] = *__SIMD32(pk)++;
+    kPair[i][1] = *__SIMD32(pk)++;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  for (y = 0u; y < dstHeight; y++)
+  {
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    if(kernelSize == 3u)
+    {
+      for (x = 0u; x < dstWidth; x++)
+      {
+        px = pSrc + x;
+        acc = __SMLALD(*__SIMD32(px)++, kPair[0][0], 0);
+        acc += (q31_t) * px * coef[2];
+        px = pSrc + width + x;
+        acc = __SMLALD(*__SIMD32(px)++, kPair[1][0], acc);
+        acc += (q31_t) * px * coef[8];
+        px = pSrc + (2u * width) + x;
+        acc = __SMLALD(*__SIMD32(px)++, kPair[2][0], acc);
+        acc += (q31_t) * px * coef[14];
+
+        *pDst++ = (q15_t) __SSAT((q31_t) (acc >> 15), 16);
+      }
+    }
+    else
+    {
+      for (x = 0u; x < dstWidth; x++)
+      {
+        acc = 0;
+
+        for (i = 0u; i < 5u; i++)
+        {
+          px = pSrc + (i * width) + x;
+          acc = __SMLALD(*__SIMD32(px)++, kPair[i][0], acc);
+          acc = __SMLALD(*__SIMD32(px)++, kPair[i][1], acc);
+          acc += (q31_t) * px * coef[(i * 6u) + 4u];
+        }
+
+        *pDst++ = (q15_t) __SSAT((q31_t) (acc >> 15), 16);
+      }
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+      acc = 0;
+      pk = coef;
+
+      for (i = 0u; i < kernelSize; i++)
+      {
+        px = pSrc + (i * width) + x;
+        for (j = 0u; j < kernelSize; j++)
+        {
+          acc += (q31_t) px[j] * pk[j];
+        }
+        pk += 6;
+      }
+
+      *pDst++ = (q15_t) __SSAT((q31_t) (acc >> 15), 16);
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    pSrc += width;
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of ImgConv group
+ */
@@ -0,0 +1,215 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_conv_u8.c
+*
+* Description:	3x3 and 5x5 convolution of 8-bit images.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @defgroup ImgConv 2-D Convolution
+ *
+ * Convolves an image with a square kernel of <code>kernelSize</code> x
+ * <code>kernelSize</code> coefficients, 3 or 5, given row after row:
+ * <pre>
+ *     pDst[y * dstWidth + x] = sum(pKernel[i * kernelSize + j] * pSrc[(y + i) * width + x + j])
+ *                              for 0 <= i, j < kernelSize
+ * </pre>
+ * with <code>dstWidth = width - kernelSize + 1</code>. As in the 1-D filters of the
+ * library, the kernel is applied without being flipped; the kernels of symmetric
+ * filters, such as the smoothing ones, are not affected.
+ *
+ * arm_img_conv_u8() filters 8-bit images with Q7 coefficients: each row entering the line
+ * buffer is widened to 16 bits once, and each output pixel then takes
+ * <code>(kernelSize - 1) / 2</code> dual multiplies per row of the kernel, plus one
+ * multiply for the last coefficient of the row. arm_img_conv_q15() filters Q15 images
+ * with Q15 coefficients in the same way, directly from the source rows.
+ *
+ * The functions return <code>ARM_MATH_ARGUMENT_ERROR</code> for another kernel size and
+ * <code>ARM_MATH_SIZE_MISMATCH</code> for an image smaller than the kernel.
+ */
+
+/**
+ * @addtogroup ImgConv
+ * @{
+ */
+
+/**
+ * @brief 3x3 or 5x5 convolution of an 8-bit image.
+ * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+ * @param[in]       width number of pixels per row
+ * @param[in]       height number of rows
+ * @param[in]       *pKernel points to the <code>kernelSize</code> x <code>kernelSize</code> Q7 coefficients
+ * @param[in]       kernelSize 3 or 5
+ * @param[in]       shift right shift of the accumulator to the 8-bit output, rounded
+ * @param[in]       *pState points to the line buffer of <code>kernelSize * width</code> values
+ * @param[out]      *pDst points to the output image
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products of the pixels by the coefficients are accumulated in 32 bits without
+ * overflow; the accumulator is shifted right by <code>shift</code> with rounding and
+ * saturated to [0 255]. The coefficients of a smoothing kernel summing to
+ * <code>2<sup>shift</sup></code> keep the brightness.
+ */
+
+arm_status arm_img_conv_u8(
+  uint8_t * pSrc,
+  uint16_t width,
+  uint16_t height,
+  q7_t * pKernel,
+  uint16_t kernelSize,
+  uint16_t shift,
+  q15_t * pState,
+  uint8_t * pDst)
+{
+  q15_t coef[30] = {0};                          /* Coefficients widened to 16 bits, rows of 6 */
+  q15_t *pRow[5];                                /* Rows of the window in the line buffer */
+  q15_t *px;                                     /* Pixels of the current row */
+  q15_t *pk;                                     /* Coefficients of the current row */
+  q31_t acc;                                     /* Accumulator */
+#ifndef ARM_MATH_CM0
+  q31_t kPair[5][2];                             /* Pairs of coefficients of each row */
+#endif
+  q31_t round = (shift > 0u) ? (1 << (shift - 1u)) : 0;  /* Rounding of the output */
+  uint32_t dstWidth, dstHeight;                  /* Output size */
+  uint32_t next;                                 /* Line buffer slot of the next source row */
+  uint32_t x, y, i;                              /* loop counters */
+#ifdef ARM_MATH_CM0
+  uint32_t j;                                    /* loop counter */
+#endif
+
+  if((kernelSize != 3u) && (kernelSize != 5u))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  if((width < kernelSize) || (height < kernelSize))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  dstWidth = (uint32_t) width - kernelSize + 1u;
+  dstHeight = (uint32_t) height - kernelSize + 1u;
+
+  for (i = 0u; i < (uint32_t) kernelSize * kernelSize; i++)
+  {
+    coef[((i / kernelSize) * 6u) + (i % kernelSize)] = pKernel[i];
+  }
+
+#ifndef ARM_MATH_CM0
+
+  /* Pairs of coefficients read as the pairs of pixels, the last one of each row being
+   ** multiplied alone */
+  for (i = 0u; i < kernelSize; i++)
+  {
+    pk = &coef[i * 6u];
+    kPair[i][0] = *__SIMD32(pk)++;
+    kPair[i][1] = *__SIMD32(pk)++;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* Fill the line buffer with the first kernelSize - 1 rows */
+  for (i = 0u; i < (uint32_t) kernelSize - 1u; i++)
+  {
+    arm_img_u8_to_q15(pSrc, pState + (i * width), width);
+    pSrc += width;
+  }
+  next = kernelSize - 1u;
+
+  for (y = 0u; y < dstHeight; y++)
+  {
+    /* The next row replaces the oldest one */
+    arm_img_u8_to_q15(pSrc, pState + (next * width), width);
+    pSrc += width;
+
+    for (i = 0u; i < kernelSize; i++)
+    {
+      pRow[i] = pState + (((next + 1u + i) % kernelSize) * width);
+    }
+    next = (next + 1u) % kernelSize;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    if(kernelSize == 3u)
+    {
+      for (x = 0u; x < dstWidth; x++)
+      {
+        px = pRow[0] + x;
+        acc = __SMLAD(*__SIMD32(px)++, kPair[0][0], 0);
+        acc += *px * coef[2];
+        px = pRow[1] + x;
+        acc = __SMLAD(*__SIMD32(px)++, kPair[1][0], acc);
+        acc += *px * coef[8];
+        px = pRow[2] + x;
+        acc = __SMLAD(*__SIMD32(px)++, kPair[2][0], acc);
+        acc += *px * coef[14];
+
+        *pDst++ = (uint8_t) __USAT((acc + round) >> shift, 8);
+      }
+    }
+    else
+    {
+      for (x = 0u; x < dstWidth; x++)
+      {
+        acc = 0;
+
+        for (i = 0u; i < 5u; i++)
+        {
+          px = pRow[i] + x;
+          acc = __SMLAD(*__SIMD32(px)++, kPair[i][0], acc);
+          acc = __SMLAD(*__SIMD32(px)++, kPair[i][1], acc);
+          acc += *px * coef[(i * 6u) + 4u];
+        }
+
+        *pDst++ = (uint8_t) __USAT((acc + round) >> shift, 8);
+      }
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+      acc = 0;
+      pk = coef;
+
+      for (i = 0u; i < kernelSize; i++)
+      {
+        px = pRow[i] + x;
+        for (j = 0u; j < kernelSize; j++)
+        {
+          acc += px[j] * pk[j];
+        }
+        pk += 6;
+      }
+
+      *pDst++ = (uint8_t) __USAT((acc + round) >> shift, 8);
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of ImgConv group
+ */
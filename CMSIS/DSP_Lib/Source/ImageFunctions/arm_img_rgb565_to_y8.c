@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_rgb565_to_y8.c
+*
+* Description:	Luma of RGB565 pixels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @addtogroup ImgColor
+ * @{
+ */
+
+/**
+ * @brief Computes the luma of RGB565 pixels as 8-bit grayscale pixels.
+ * @param[in]       *pSrc points to the RGB565 pixels
+ * @param[out]      *pDst points to the 8-bit pixels
+ * @param[in]       numPixels number of pixels
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The weights of the components include their expansion to 8 bits, in 8.8 format:
+ * <pre>
+ *     Y = (630 * R5 + 608 * G6 + 240 * B5 + 128) >> 8
+ * </pre>
+ * from 0 for black to 255 for white. On Cortex-M3 and Cortex-M4 the components of two
+ * pixels are extracted together from a word, and the red and green terms of each pixel
+ * computed by one dual multiply.
+ */
+
+void arm_img_rgb565_to_y8(
+  uint16_t * pSrc,
+  uint8_t * pDst,
+  uint32_t numPixels)
+{
+  q31_t in;                                      /* Source pixel */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t r, g, b;                                 /* Components of two pixels */
+  q31_t lo1, hi1, lo2, hi2;                      /* Luma of the halves of two words */
+  q31_t coef = (608 << 16) | 630;                /* Weights of red and green */
+
+  /*loop Unrolling */
+  blkCnt = numPixels >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrc)++;
+    r = (in >> 11) & 0x001F001F;
+    g = (in >> 5) & 0x003F003F;
+    b = in & 0x001F001F;
+    lo1 = __SMLAD(__PKHBT(r, g, 16), coef, (240 * (b & 0xFFFF)) + 128) >> 8;
+    hi1 = __SMLAD(__PKHTB(g, r, 16), coef, (240 * (b >> 16)) + 128) >> 8;
+
+    in = *__SIMD32(pSrc)++;
+    r = (in >> 11) & 0x001F001F;
+    g = (in >> 5) & 0x003F003F;
+    b = in & 0x001F001F;
+    lo2 = __SMLAD(__PKHBT(r, g, 16), coef, (240 * (b & 0xFFFF)) + 128) >> 8;
+    hi2 = __SMLAD(__PKHTB(g, r, 16), coef, (240 * (b >> 16)) + 128) >> 8;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = lo1 | (hi1 << 8) | (lo2 << 16) | (hi2 << 24);
+
+#else
+
+    *__SIMD32(pDst)++ = lo2 | (hi2 << 8) | (lo1 << 16) | (hi1 << 24);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numPixels is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = numPixels % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numPixels;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    *pDst++ = (uint8_t) (((630 * (in >> 11)) + (608 * ((in >> 5) & 0x3F)) +
+                          (240 * (in & 0x1F)) + 128) >> 8);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of ImgColor group
+ */
@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_sep_filter_q15.c
+*
+* Description:	Separable filter of Q15 images.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @addtogroup ImgSepFilter
+ * @{
+ */
+
+/**
+ * @brief Separable filter of a Q15 image.
+ * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+ * @param[in]       width number of pixels per row
+ * @param[in]       height number of rows
+ * @param[in]       *pRowKernel points to the <code>kernelLen</code> Q15 coefficients of the row kernel
+ * @param[in]       *pColKernel points to the <code>kernelLen</code> Q15 coefficients of the column kernel
+ * @param[in]       kernelLen odd number of coefficients of each kernel
+ * @param[in]       *pState points to the line buffer of <code>kernelLen * (width - kernelLen + 1)</code> values
+ * @param[out]      *pDst points to the output image
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each pass accumulates its 1.15 by 1.15 products in a 64-bit accumulator in 34.30
+ * format, truncated to 34.15 format and saturated to 1.15 format. The rows filtered by
+ * the row kernel are thus saturated before the column pass.
+ */
+
+arm_status arm_img_sep_filter_q15(
+  q15_t * pSrc,
+  uint16_t width,
+  uint16_t height,
+  q15_t * pRowKernel,
+  q15_t * pColKernel,
+  uint16_t kernelLen,
+  q15_t * pState,
+  q15_t * pDst)
+{
+  q15_t coef[ARM_IMG_MAX_KERNEL + 1] = {0};     /* Row kernel */
+  q15_t *pRow[ARM_IMG_MAX_KERNEL];               /* Filtered rows of the window */
+  q15_t *px, *pOut;                              /* Pixels of the current row */
+  q63_t acc;                                     /* Accumulator */
+#ifndef ARM_MATH_CM0
+  q15_t *pk;                                     /* Pairs of coefficients */
+  q31_t kPair[ARM_IMG_MAX_KERNEL / 2];           /* Pairs of coefficients of the row kernel */
+  uint32_t numPairs = (uint32_t) kernelLen >> 1u;  /* Pairs of coefficients before the last one */
+#endif
+  uint32_t dstWidth;                             /* Output width */
+  uint32_t next;                                 /* Line buffer slot of the next filtered row */
+  uint32_t x, y, i;                              /* loop counters */
+
+  if(((kernelLen & 1u) == 0u) || (kernelLen < 3u) || (kernelLen > ARM_IMG_MAX_KERNEL))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  if((width < kernelLen) || (height < kernelLen))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  dstWidth = (uint32_t) width - kernelLen + 1u;
+
+  for (i = 0u; i < kernelLen; i++)
+  {
+    coef[i] = pRowKernel[i];
+  }
+
+#ifndef ARM_MATH_CM0
+
+  pk = coef;
+  for (i = 0u; i < numPairs; i++)
+  {
+    kPair[i] = *__SIMD32(pk)++;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  next = 0u;
+
+  for (y = 0u; y < (uint32_t) height; y++)
+  {
+    /* Row pass: the source row filtered into the oldest slot */
+    pOut = pState + (next * dstWidth);
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+      px = pSrc + x;
+      acc = 0;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      for (i = 0u; i < numPairs; i++)
+      {
+        acc = __SMLALD(*__SIMD32(px)++, kPair[i], acc);
+      }
+      acc += (q31_t) * px * coef[kernelLen - 1u];
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+      for (i = 0u; i < kernelLen; i++)
+      {
+        acc += (q31_t) px[i] * coef[i];
+      }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      *pOut++ = (q15_t) __SSAT((q31_t) (acc >> 15), 16);
+    }
+
+    pSrc += width;
+    next = (next + 1u) % kernelLen;
+
+    if(y + 1u < kernelLen)
+    {
+      continue;
+    }
+
+    /* Column pass over the last kernelLen filtered rows, oldest first */
+    for (i = 0u; i < kernelLen; i++)
+    {
+      pRow[i] = pState + (((next + i) % kernelLen) * dstWidth);
+    }
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+      acc = 0;
+      for (i = 0u; i < kernelLen; i++)
+      {
+        acc += (q31_t) pRow[i][x] * pColKernel[i];
+      }
+
+      *pDst++ = (q15_t) __SSAT((q31_t) (acc >> 15), 16);
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of ImgSepFilter group
+ */
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_sep_filter_u8.c
+*
+* Description:	Separable filter of 8-bit images.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @defgroup ImgSepFilter Separable Filter
+ *
+ * Filters an image with the kernel of <code>kernelLen</code> x <code>kernelLen</code>
+ * coefficients that is the outer product of a column kernel and a row kernel, such as the
+ * Gaussian and the box kernels and the two kernels of the Sobel operator:
+ * <pre>
+ *     pDst[y * dstWidth + x] = sum(pColKernel[i] * pRowKernel[j] * pSrc[(y + i) * width + x + j])
+ *                              for 0 <= i, j < kernelLen
+ * </pre>
+ * with <code>dstWidth = width - kernelLen + 1</code>. <code>kernelLen</code> is odd, from
+ * 3 to <code>ARM_IMG_MAX_KERNEL</code>.
+ *
+ * Each source row is filtered by the row kernel once, with the dual multiplies, when it
+ * enters the line buffer; the output row is then the column kernel applied to the last
+ * <code>kernelLen</code> filtered rows. An output pixel takes <code>2 * kernelLen</code>
+ * multiplies instead of <code>kernelLen<sup>2</sup></code>.
+ *
+ * The functions return <code>ARM_MATH_ARGUMENT_ERROR</code> for a wrong kernel length and
+ * <code>ARM_MATH_SIZE_MISMATCH</code> for an image smaller than the kernel.
+ */
+
+/**
+ * @addtogroup ImgSepFilter
+ * @{
+ */
+
+/**
+ * @brief Separable filter of an 8-bit image.
+ * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+ * @param[in]       width number of pixels per row
+ * @param[in]       height number of rows
+ * @param[in]       *pRowKernel points to the <code>kernelLen</code> Q7 coefficients of the row kernel
+ * @param[in]       *pColKernel points to the <code>kernelLen</code> Q7 coefficients of the column kernel
+ * @param[in]       kernelLen odd number of coefficients of each kernel
+ * @param[in]       shift right shift of the product of the kernels to the 8-bit output, at least 3
+ * @param[in]       *pState points to the line buffer of <code>width + kernelLen * (width - kernelLen + 1)</code> values
+ * @param[out]      *pDst points to the output image
+ * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The rows filtered by the row kernel are kept in 16 bits divided by 8, which cannot
+ * overflow. The column kernel is accumulated in 32 bits, shifted right by
+ * <code>shift - 3</code> with rounding and saturated to [0 255]: two smoothing kernels
+ * summing to <code>2<sup>7</sup></code> each keep the brightness with a
+ * <code>shift</code> of 14.
+ */
+
+arm_status arm_img_sep_filter_u8(
+  uint8_t * pSrc,
+  uint16_t width,
+  uint16_t height,
+  q7_t * pRowKernel,
+  q7_t * pColKernel,
+  uint16_t kernelLen,
+  uint16_t shift,
+  q15_t * pState,
+  uint8_t * pDst)
+{
+  q15_t coef[ARM_IMG_MAX_KERNEL + 1] = {0};     /* Row kernel widened to 16 bits */
+  q15_t *pRow[ARM_IMG_MAX_KERNEL];               /* Filtered rows of the window */
+  q15_t *pLine = pState;                         /* Widened source row */
+  q15_t *pRing = pState + width;                 /* Filtered rows */
+  q15_t *px, *pOut;                              /* Pixels of the current row */
+  q31_t acc;                                     /* Accumulator */
+  q31_t round;                                   /* Rounding of the output */
+#ifndef ARM_MATH_CM0
+  q15_t *pk;                                     /* Pairs of coefficients */
+  q31_t kPair[ARM_IMG_MAX_KERNEL / 2];           /* Pairs of coefficients of the row kernel */
+  uint32_t numPairs = (uint32_t) kernelLen >> 1u;  /* Pairs of coefficients before the last one */
+#endif
+  uint32_t dstWidth;                             /* Output width */
+  uint32_t next;                                 /* Line buffer slot of the next filtered row */
+  uint32_t x, y, i;                              /* loop counters */
+
+  if(((kernelLen & 1u) == 0u) || (kernelLen < 3u) || (kernelLen > ARM_IMG_MAX_KERNEL) ||
+     (shift < 3u))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  if((width < kernelLen) || (height < kernelLen))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  dstWidth = (uint32_t) width - kernelLen + 1u;
+  shift -= 3u;
+  round = (shift > 0u) ? (1 << (shift - 1u)) : 0;
+
+  for (i = 0u; i < kernelLen; i++)
+  {
+    coef[i] = pRowKernel[i];
+  }
+
+#ifndef ARM_MATH_CM0
+
+  pk = coef;
+  for (i = 0u; i < numPairs; i++)
+  {
+    kPair[i] = *__SIMD32(pk)++;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  next = 0u;
+
+  for (y = 0u; y < (uint32_t) height; y++)
+  {
+    /* Row pass: the widened source row filtered into the oldest slot */
+    arm_img_u8_to_q15(pSrc, pLine, width);
+    pSrc += width;
+    pOut = pRing + (next * dstWidth);
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+      px = pLine + x;
+      acc = 0;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      for (i = 0u; i < numPairs; i++)
+      {
+        acc = __SMLAD(*__SIMD32(px)++, kPair[i], acc);
+      }
+      acc += *px * coef[kernelLen - 1u];
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+      for (i = 0u; i < kernelLen; i++)
+      {
+        acc += px[i] * coef[i];
+      }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      *pOut++ = (q15_t) (acc >> 3);
+    }
+
+    next = (next + 1u) % kernelLen;
+
+    if(y + 1u < kernelLen)
+    {
+      continue;
+    }
+
+    /* Column pass over the last kernelLen filtered rows, oldest first */
+    for (i = 0u; i < kernelLen; i++)
+    {
+      pRow[i] = pRing + (((next + i) % kernelLen) * dstWidth);
+    }
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+      acc = 0;
+      for (i = 0u; i < kernelLen; i++)
+      {
+        acc += pRow[i][x] * pColKernel[i];
+      }
+
+      *pDst++ = (uint8_t) __USAT((acc + round) >> shift, 8);
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of ImgSepFilter group
+ */
@@ -0,0 +1,230 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_sobel_u8.c
+*
+* Description:	Sobel gradient magnitude of 8-bit images.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @defgroup ImgSobel Sobel Edge Detection
+ *
+ * Computes the horizontal and vertical gradients of an image with the 3x3 Sobel kernels
+ * <pre>
+ *          | -1  0  1 |          | -1 -2 -1 |
+ *     Gx = | -2  0  2 |     Gy = |  0  0  0 |
+ *          | -1  0  1 |          |  1  2  1 |
+ * </pre>
+ * and their magnitude, approximated without square root by alpha max plus beta min as in
+ * \ref cmplx_mag_fast:
+ * <pre>
+ *     mag = max(max, 0.898204193 * max + 0.485968200 * min)    max, min = |gx|, |gy| sorted
+ * </pre>
+ * within +/-2.13% of <code>sqrt(gx<sup>2</sup> + gy<sup>2</sup>)</code>, plus 1 for the truncated
+ * products.
+ *
+ * Both kernels are separable: each row entering the line buffer is widened once, the
+ * vertical smoothing <code>[1 2 1]</code> and difference <code>[-1 0 1]</code> of the three
+ * rows are computed once per column, with the dual 16-bit additions, and the gradients
+ * then take three additions per pixel.
+ *
+ * The magnitude ranges from 0 to 1443. With a zero <code>threshold</code> the output is
+ * the magnitude divided by 4 and saturated to 255; otherwise the output is the edge map,
+ * 255 where the magnitude reaches <code>threshold</code> and 0 elsewhere.
+ */
+
+/**
+ * @addtogroup ImgSobel
+ * @{
+ */
+
+/**
+ * @brief Sobel gradient magnitude of an 8-bit image.
+ * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+ * @param[in]       width number of pixels per row
+ * @param[in]       height number of rows
+ * @param[in]       threshold edge threshold on the magnitude, 0 for the magnitude itself
+ * @param[in]       *pState points to the line buffer of <code>5 * width</code> values
+ * @param[out]      *pDst points to the <code>width - 2</code> x <code>height - 2</code> output image
+ * @return ARM_MATH_SUCCESS or ARM_MATH_SIZE_MISMATCH for an image smaller than 3x3.
+ */
+
+arm_status arm_img_sobel_u8(
+  uint8_t * pSrc,
+  uint16_t width,
+  uint16_t height,
+  uint16_t threshold,
+  q15_t * pState,
+  uint8_t * pDst)
+{
+  q15_t *pRow[3];                                /* Rows of the window in the line buffer */
+  q15_t *pSum = pState + (3u * width);           /* Vertical smoothing of the columns */
+  q15_t *pDiff = pState + (4u * width);          /* Vertical difference of the columns */
+  q15_t *p0, *p1, *p2, *pS, *pD;                 /* Temporary pointers */
+  q31_t gx, gy, mx, mn, mag;                     /* Gradients and magnitude */
+  uint32_t dstWidth, dstHeight;                  /* Output size */
+  uint32_t next;                                 /* Line buffer slot of the next source row */
+  uint32_t blkCnt;                               /* loop counter */
+  uint32_t x, y, i;                              /* loop counters */
+#ifndef ARM_MATH_CM0
+  q31_t in0, in1, in2, sx, gxy[2];               /* Pairs of values */
+#endif
+
+  if((width < 3u) || (height < 3u))
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  dstWidth = (uint32_t) width - 2u;
+  dstHeight = (uint32_t) height - 2u;
+
+  /* Fill the line buffer with the first two rows */
+  for (i = 0u; i < 2u; i++)
+  {
+    arm_img_u8_to_q15(pSrc, pState + (i * width), width);
+    pSrc += width;
+  }
+  next = 2u;
+
+  for (y = 0u; y < dstHeight; y++)
+  {
+    /* The next row replaces the oldest one */
+    arm_img_u8_to_q15(pSrc, pState + (next * width), width);
+    pSrc += width;
+
+    for (i = 0u; i < 3u; i++)
+    {
+      pRow[i] = pState + (((next + 1u + i) % 3u) * width);
+    }
+    next = (next + 1u) % 3u;
+
+    /* Vertical passes: sum = r0 + 2 * r1 + r2, diff = r2 - r0 */
+    p0 = pRow[0];
+    p1 = pRow[1];
+    p2 = pRow[2];
+    pS = pSum;
+    pD = pDiff;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+    blkCnt = (uint32_t) width >> 1u;
+
+    while(blkCnt > 0u)
+    {
+      in0 = *__SIMD32(p0)++;
+      in1 = *__SIMD32(p1)++;
+      in2 = *__SIMD32(p2)++;
+
+      *__SIMD32(pS)++ = __QADD16(__QADD16(in0, in2), __QADD16(in1, in1));
+      *__SIMD32(pD)++ = __QSUB16(in2, in0);
+
+      blkCnt--;
+    }
+
+    blkCnt = (uint32_t) width & 1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    blkCnt = width;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(blkCnt > 0u)
+    {
+      *pS++ = *p0 + (2 * *p1) + *p2;
+      *pD++ = *p2 - *p0;
+      p0++;
+      p1++;
+      p2++;
+
+      blkCnt--;
+    }
+
+    /* Horizontal passes: gx = sum[x+2] - sum[x], gy = diff[x] + 2 * diff[x+1] + diff[x+2] */
+    pS = pSum;
+    pD = pDiff;
+
+    for (x = 0u; x < dstWidth; x++)
+    {
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      if(x < (dstWidth & ~1u))
+      {
+        if((x & 1u) == 0u)
+        {
+          /* Gradients of two pixels at a time */
+          p0 = pS + x;
+          p1 = pS + x + 2u;
+          sx = __QSUB16(*__SIMD32(p1), *__SIMD32(p0));
+          p0 = pD + x;
+          in0 = *__SIMD32(p0)++;
+          in1 = *__SIMD32(p0);
+          p0 = pD + x + 1u;
+          in2 = *__SIMD32(p0);
+          in2 = __QADD16(__QADD16(in0, in1), __QADD16(in2, in2));
+
+#ifndef ARM_MATH_BIG_ENDIAN
+          gxy[0] = __PKHBT(sx, in2, 16);
+          gxy[1] = __PKHTB(in2, sx, 16);
+#else
+          gxy[0] = __PKHTB(in2, sx, 16);
+          gxy[1] = __PKHBT(sx, in2, 16);
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+        }
+
+        gx = (q15_t) gxy[x & 1u];
+        gy = (q15_t) (gxy[x & 1u] >> 16);
+      }
+      else
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      {
+        /* Last pixel of an odd width, and Cortex-M0 */
+        gx = pS[x + 2u] - pS[x];
+        gy = pD[x] + (2 * pD[x + 1u]) + pD[x + 2u];
+      }
+
+      /* absolute values sorted into max and min */
+      gx = (gx < 0) ? -gx : gx;
+      gy = (gy < 0) ? -gy : gy;
+      mx = (gx > gy) ? gx : gy;
+      mn = (gx > gy) ? gy : gx;
+
+      /* alpha max plus beta min in Q15, max alone for a small min */
+      mag = ((29432 * mx) + (15924 * mn)) >> 15;
+      mag = (mag > mx) ? mag : mx;
+
+      if(threshold != 0u)
+      {
+        *pDst++ = (mag >= (q31_t) threshold) ? 255u : 0u;
+      }
+      else
+      {
+        *pDst++ = (uint8_t) __USAT(mag >> 2, 8);
+      }
+    }
+  }
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of ImgSobel group
+ */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_u8_to_q15.c
+*
+* Description:	Widening of 8-bit pixels to 16-bit values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @defgroup ImgConvert Pixel Widening
+ *
+ * Widens unsigned 8-bit pixels to 16-bit values without scaling, so that the filters
+ * can process them in pairs with the dual 16-bit multiplies:
+ * <pre>
+ *     pDst[n] = (q15_t) pSrc[n],   0 <= n < blockSize
+ * </pre>
+ * The filters of the 8-bit images call it on each row entering their line buffers.
+ */
+
+/**
+ * @addtogroup ImgConvert
+ * @{
+ */
+
+/**
+ * @brief Widens 8-bit pixels to 16-bit values.
+ * @param[in]       *pSrc points to the 8-bit pixels
+ * @param[out]      *pDst points to the 16-bit values
+ * @param[in]       blockSize number of pixels
+ * @return none.
+ *
+ * On Cortex-M3 and Cortex-M4 four pixels are read at a time: <code>__UXTB16</code>
+ * extracts the even and the odd bytes, packed back in order by <code>__PKHBT</code> and
+ * <code>__PKHTB</code>.
+ */
+
+void arm_img_u8_to_q15(
+  uint8_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in, even, odd;                           /* Input word and its extracted bytes */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrc)++;
+
+    /* bytes 0 and 2, bytes 1 and 3 */
+    even = (q31_t) __UXTB16((uint32_t) in);
+    odd = (q31_t) __UXTB16((uint32_t) in >> 8);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(even, odd, 16);
+    *__SIMD32(pDst)++ = __PKHTB(odd, even, 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHTB(odd, even, 16);
+    *__SIMD32(pDst)++ = __PKHBT(even, odd, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = (q15_t) * pSrc++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of ImgConvert group
+ */
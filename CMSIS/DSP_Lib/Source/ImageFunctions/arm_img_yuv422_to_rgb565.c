@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_yuv422_to_rgb565.c
+*
+* Description:	Conversion of YUV 4:2:2 pixels to RGB565.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @defgroup ImgColor Pixel Format Conversion
+ *
+ * Converts the pixels of the cameras and of the displays:
+ * - arm_img_yuv422_to_rgb565() converts YUV 4:2:2 pixels to RGB565 for a display,
+ * - arm_img_yuv422_to_y8() extracts the luma of YUV 4:2:2 pixels as an 8-bit grayscale
+ *   image,
+ * - arm_img_rgb565_to_y8() computes the luma of RGB565 pixels as an 8-bit grayscale image.
+ *
+ * YUV 4:2:2 pixels go by pairs sharing their chroma, two bytes per pixel, in the order
+ * Y0 U Y1 V (<code>ARM_IMG_YUYV</code>) or U Y0 V Y1 (<code>ARM_IMG_UYVY</code>) set by the
+ * camera. The conversions follow ITU-R BT.601 with the luma from 16 to 235:
+ * <pre>
+ *     R = 1.164 * (Y - 16) + 1.596 * (V - 128)
+ *     G = 1.164 * (Y - 16) - 0.391 * (U - 128) - 0.813 * (V - 128)
+ *     B = 1.164 * (Y - 16) + 2.018 * (U - 128)
+ *     Y = 0.299 * R + 0.587 * G + 0.114 * B
+ * </pre>
+ *
+ * The functions keep no state and take any even number of pixels, so a frame can be
+ * converted by strips, such as the DMA segments of the DCMI capture as soon as each one
+ * is received, while the next ones are being captured. They read the source by words of
+ * two pixels, which must therefore be aligned on 4 bytes, and may convert in place: each
+ * output pixel is not larger than the source one.
+ */
+
+/**
+ * @addtogroup ImgColor
+ * @{
+ */
+
+/**
+ * @brief Converts YUV 4:2:2 pixels to RGB565.
+ * @param[in]       *pSrc points to the YUV 4:2:2 pixels
+ * @param[out]      *pDst points to the RGB565 pixels
+ * @param[in]       numPixels even number of pixels
+ * @param[in]       order order of the bytes of a pair of pixels
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The coefficients are in 10.6 format and each component is rounded and saturated to
+ * [0 255] before being truncated to 5 or 6 bits. On Cortex-M3 and Cortex-M4 the pixels of
+ * a pair are computed together in the halves of a word: the luma of the two pixels is
+ * scaled by one multiplication, the chroma terms are added with <code>__QADD16</code>
+ * and the components saturated with <code>__USAT16</code>.
+ */
+
+void arm_img_yuv422_to_rgb565(
+  uint8_t * pSrc,
+  uint16_t * pDst,
+  uint32_t numPixels,
+  arm_img_yuv_order order)
+{
+  q31_t u, v;                                    /* Chroma of a pair of pixels */
+  q31_t r, g, b;                                 /* Chroma terms of the components */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t in, luma, chroma;                     /* Pair of pixels, luma and chroma pairs */
+  q31_t yy;                                      /* Scaled luma of the pair */
+  uint32_t rr, gg, bb;                           /* Components of the pair */
+
+  blkCnt = numPixels >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrc)++;
+
+    /* Bytes 0 and 2, and bytes 1 and 3 of the pair in memory */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    luma = __UXTB16(in);
+    chroma = __UXTB16(in >> 8);
+
+#else
+
+    luma = __UXTB16(in >> 8);
+    chroma = __UXTB16(in);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    if(order == ARM_IMG_UYVY)
+    {
+      yy = (q31_t) luma;
+      luma = chroma;
+      chroma = (uint32_t) yy;
+    }
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    u = (q31_t) (chroma & 0xFFu) - 128;
+    v = (q31_t) (chroma >> 16) - 128;
+#else
+    u = (q31_t) (chroma >> 16) - 128;
+    v = (q31_t) (chroma & 0xFFu) - 128;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* 1.164 * (Y - 16) of both pixels, the luma of each half being below 256 */
+    yy = __QSUB16((q31_t) (luma * 75u), 0x04B004B0);
+
+    /* Chroma terms with the rounding, shared by the two pixels */
+    r = (102 * v) + 32;
+    g = (-25 * u) - (52 * v) + 32;
+    b = (129 * u) + 32;
+
+    rr = __USAT16(__QADD16(yy, __PKHBT(r, r, 16)), 14);
+    gg = __USAT16(__QADD16(yy, __PKHBT(g, g, 16)), 14);
+    bb = __USAT16(__QADD16(yy, __PKHBT(b, b, 16)), 14);
+
+    /* Components of 14 bits truncated to 5, 6 and 5 bits in each half */
+    rr = (rr >> 9) & 0x001F001Fu;
+    gg = (gg >> 8) & 0x003F003Fu;
+    bb = (bb >> 9) & 0x001F001Fu;
+
+    *__SIMD32(pDst)++ = (q31_t) ((rr << 11) | (gg << 5) | bb);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  q31_t y0, y1;                                  /* Scaled luma of the pair */
+
+  blkCnt = numPixels >> 1u;
+
+  while(blkCnt > 0u)
+  {
+    if(order == ARM_IMG_YUYV)
+    {
+      y0 = pSrc[0];
+      u = pSrc[1];
+      y1 = pSrc[2];
+      v = pSrc[3];
+    }
+    else
+    {
+      u = pSrc[0];
+      y0 = pSrc[1];
+      v = pSrc[2];
+      y1 = pSrc[3];
+    }
+    pSrc += 4u;
+
+    u -= 128;
+    v -= 128;
+    y0 = 75 * (y0 - 16);
+    y1 = 75 * (y1 - 16);
+
+    r = (102 * v) + 32;
+    g = (-25 * u) - (52 * v) + 32;
+    b = (129 * u) + 32;
+
+    *pDst++ = (uint16_t) (((__USAT(y0 + r, 14) >> 9) << 11) |
+                          ((__USAT(y0 + g, 14) >> 8) << 5) | (__USAT(y0 + b, 14) >> 9));
+    *pDst++ = (uint16_t) (((__USAT(y1 + r, 14) >> 9) << 11) |
+                          ((__USAT(y1 + g, 14) >> 8) << 5) | (__USAT(y1 + b, 14) >> 9));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+}
+
+/**
+ * @} end of ImgColor group
+ */
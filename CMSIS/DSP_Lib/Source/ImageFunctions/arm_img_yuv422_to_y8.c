@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_img_yuv422_to_y8.c
+*
+* Description:	Luma of YUV 4:2:2 pixels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupImage
+ */
+
+/**
+ * @addtogroup ImgColor
+ * @{
+ */
+
+/**
+ * @brief Extracts the luma of YUV 4:2:2 pixels as 8-bit grayscale pixels.
+ * @param[in]       *pSrc points to the YUV 4:2:2 pixels
+ * @param[out]      *pDst points to the 8-bit pixels
+ * @param[in]       numPixels even number of pixels
+ * @param[in]       order order of the bytes of a pair of pixels
+ * @return none.
+ *
+ * The luma is copied as it is, from 16 to 235. On Cortex-M3 and Cortex-M4 four pixels
+ * are read in two words and their luma bytes packed into one word.
+ */
+
+void arm_img_yuv422_to_y8(
+  uint8_t * pSrc,
+  uint8_t * pDst,
+  uint32_t numPixels,
+  arm_img_yuv_order order)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t in1, in2;                             /* Two pairs of pixels */
+
+  /*loop Unrolling */
+  blkCnt = numPixels >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 2 samples. */
+  while(blkCnt > 0u)
+  {
+    in1 = *__SIMD32(pSrc)++;
+    in2 = *__SIMD32(pSrc)++;
+
+    /* Luma bytes of each pair in the halves of a word, packed in the low half */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    if(order == ARM_IMG_UYVY)
+    {
+      in1 >>= 8;
+      in2 >>= 8;
+    }
+    in1 = __UXTB16(in1);
+    in2 = __UXTB16(in2);
+    in1 |= in1 >> 8;
+    in2 |= in2 >> 8;
+
+    *__SIMD32(pDst)++ = __PKHBT(in1, in2, 16);
+
+#else
+
+    if(order == ARM_IMG_YUYV)
+    {
+      in1 >>= 8;
+      in2 >>= 8;
+    }
+    in1 = __UXTB16(in1);
+    in2 = __UXTB16(in2);
+    in1 |= in1 >> 8;
+    in2 |= in2 >> 8;
+
+    *__SIMD32(pDst)++ = __PKHBT(in2, in1, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the numPixels is not a multiple of 4, compute the remaining pair here.
+   ** No loop unrolling is used. */
+  blkCnt = (numPixels % 0x4u) >> 1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = numPixels >> 1u;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  if(order == ARM_IMG_UYVY)
+  {
+    pSrc++;
+  }
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = pSrc[0];
+    *pDst++ = pSrc[2];
+    pSrc += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of ImgColor group
+ */
@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_bilinear_interp_nu_block_f32.c
+*
+* Description:	Floating-point non-uniform bilinear interpolation of a block of points.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup BilinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief Floating-point non-uniform bilinear interpolation of a block of points.
+ * @param[in,out]   *S points to an instance of the floating-point non-uniform bilinear interpolation structure
+ * @param[in]       *pX points to the X coordinates
+ * @param[in]       *pY points to the Y coordinates
+ * @param[out]      *pDst points to the output samples, which may be <code>pX</code> or <code>pY</code>
+ * @param[in]       blockSize number of points to process
+ * @return none.
+ *
+ * Each output is the output of arm_bilinear_interp_nu_f32() for the same coordinates.
+ * The cell of each point is searched from the cell of the previous point, and
+ * <code>lastCol</code> and <code>lastRow</code> are left at the cell of the last point.
+ */
+
+void arm_bilinear_interp_nu_block_f32(
+  arm_bilinear_interp_nu_instance_f32 * S,
+  float32_t * pX,
+  float32_t * pY,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pData = S->pData;                   /* pointer to the data table */
+  float32_t *pXData = S->pXData;                 /* pointer to the X breakpoints */
+  float32_t *pYData = S->pYData;                 /* pointer to the Y breakpoints */
+  uint32_t nCols = S->numCols;                   /* Number of columns */
+  uint32_t nRows = S->numRows;                   /* Number of rows */
+  uint32_t lastCol = S->lastCol;                 /* Column of the previous point */
+  uint32_t lastRow = S->lastRow;                 /* Row of the previous point */
+  float32_t *pCell;                              /* Lower left corner of the cell */
+  float32_t xfract, yfract;                      /* Position in the cell */
+  float32_t f0, f1;                              /* Interpolated rows */
+  uint32_t cI, rI;                               /* Column and row of the cell */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    cI = arm_interp_nu_index_f32(pXData, nCols, *pX++, &lastCol, &xfract);
+    rI = arm_interp_nu_index_f32(pYData, nRows, *pY++, &lastRow, &yfract);
+
+    pCell = pData + (rI * nCols) + cI;
+
+    /* Interpolation along X in the two rows of the cell, then along Y */
+    f0 = pCell[0] + xfract * (pCell[1] - pCell[0]);
+    f1 = pCell[nCols] + xfract * (pCell[nCols + 1u] - pCell[nCols]);
+
+    *pDst++ = f0 + yfract * (f1 - f0);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->lastCol = lastCol;
+  S->lastRow = lastRow;
+}
+
+/**
+ * @} end of BilinearInterpolate group
+ */
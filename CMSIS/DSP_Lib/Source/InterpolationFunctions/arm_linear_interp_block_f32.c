@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_linear_interp_block_f32.c
+*
+* Description:	Floating-point Linear Interpolation of a block of samples.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief Floating-point Linear Interpolation of a block of samples.
+ * @param[in]       *S points to an instance of the floating-point Linear Interpolation structure
+ * @param[in]       *pSrc points to the input samples
+ * @param[out]      *pDst points to the output samples, which may be <code>pSrc</code>
+ * @param[in]       blockSize number of samples to process
+ * @return none.
+ *
+ * Each output is the output of arm_linear_interp_f32() for the same input: the first
+ * value of the table below the range and the last value at and above its end. The
+ * position of a sample in the table is computed with the reciprocal of
+ * <code>xSpacing</code>, computed once per block.
+ */
+
+void arm_linear_interp_block_f32(
+  const arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pYData = S->pYData;                 /* pointer to output table */
+  float32_t x1 = S->x1;                          /* First input value of the table */
+  float32_t invSpacing = 1.0f / S->xSpacing;     /* Reciprocal of the spacing */
+  float32_t xLast = (float32_t) (S->nValues - 1u);       /* Position of the last value */
+  float32_t yFirst = pYData[0];                  /* Output below the table */
+  float32_t yLast = pYData[S->nValues - 1u];     /* Output above the table */
+  float32_t pos;                                 /* Position of the input in the table */
+  float32_t y0;                                  /* Nearest output value */
+  uint32_t i;                                    /* Index of the interval */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    pos = (*pSrc++ - x1) * invSpacing;
+
+    /* The range is checked on the position, before its conversion to an integer */
+    if(pos < 0.0f)
+    {
+      *pDst++ = yFirst;
+    }
+    else if(pos >= xLast)
+    {
+      *pDst++ = yLast;
+    }
+    else
+    {
+      i = (uint32_t) pos;
+      y0 = pYData[i];
+
+      *pDst++ = y0 + (pos - (float32_t) i) * (pYData[i + 1u] - y0);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
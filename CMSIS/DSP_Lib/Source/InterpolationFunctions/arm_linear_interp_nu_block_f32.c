@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_linear_interp_nu_block_f32.c
+*
+* Description:	Floating-point non-uniform Linear Interpolation of a block of samples.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief Floating-point non-uniform Linear Interpolation of a block of samples.
+ * @param[in,out]   *S points to an instance of the floating-point non-uniform Linear Interpolation structure
+ * @param[in]       *pSrc points to the input samples
+ * @param[out]      *pDst points to the output samples, which may be <code>pSrc</code>
+ * @param[in]       blockSize number of samples to process
+ * @return none.
+ *
+ * Each output is the output of arm_linear_interp_nu_f32() for the same input. The search
+ * of each sample starts from the interval of the previous one, so sorted or slowly
+ * varying inputs are located in one or two comparisons, and <code>lastIndex</code> is
+ * left at the interval of the last sample.
+ */
+
+void arm_linear_interp_nu_block_f32(
+  arm_linear_interp_nu_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pXData = S->pXData;                 /* pointer to input table */
+  float32_t *pYData = S->pYData;                 /* pointer to output table */
+  uint32_t nValues = S->nValues;                 /* Number of breakpoints */
+  uint32_t index = S->lastIndex;                 /* Interval of the previous sample */
+  float32_t fract;                               /* Position of the input in its interval */
+  float32_t y0;                                  /* Nearest output value */
+  uint32_t i;                                    /* Interval of the input */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  while(blkCnt > 0u)
+  {
+    i = arm_interp_nu_index_f32(pXData, nValues, *pSrc++, &index, &fract);
+    y0 = pYData[i];
+
+    *pDst++ = y0 + fract * (pYData[i + 1u] - y0);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->lastIndex = index;
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
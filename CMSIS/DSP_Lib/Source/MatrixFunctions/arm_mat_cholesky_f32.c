@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_cholesky_f32.c
+*
+* Description:	Floating-point Cholesky decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky and LDL^T Decompositions
+ *
+ * Decompose a symmetric positive-definite matrix <code>A</code> as
+ * <pre>
+ *     A = L * L^T           (Cholesky)
+ *     A = L * D * L^T       (LDL^T)
+ * </pre>
+ * where <code>L</code> is lower triangular, with a unit diagonal for the LDL^T
+ * decomposition, and <code>D</code> is diagonal.
+ *
+ * The covariance matrices of Kalman filters and the normal equations of least squares
+ * problems are symmetric positive-definite. Solving their systems by a decomposition and
+ * two triangular solves, with arm_mat_cholesky_solve_f32(), costs about
+ * <code>n^3/3</code> multiply-accumulates for the decomposition where the Gauss-Jordan
+ * inversion of arm_mat_inverse_f32() costs <code>n^3</code>, followed by a matrix
+ * multiplication, and is more accurate: no pivoting is needed and the errors grow with the
+ * square root of the condition number rather than with it.
+ *
+ * Only the lower triangle of the input is read. The output may be the input matrix, which is
+ * then overwritten by its decomposition.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]       *pSrc points to the instance of the input symmetric positive-definite matrix structure.
+ * @param[out]      *pDst points to the instance of the output lower triangular matrix structure.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive-definite, the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The columns of <code>L</code> are computed from left to right, the upper triangle of
+ * the output being cleared:
+ * <pre>
+ *     L(j,j) = sqrt(A(j,j) - L(j,0)^2 - ... - L(j,j-1)^2)
+ *     L(i,j) = (A(i,j) - L(i,0) * L(j,0) - ... - L(i,j-1) * L(j,j-1)) / L(j,j)     for i > j
+ * </pre>
+ * Each sum is a dot product of the beginnings of two rows, read contiguously.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* Rows of the output */
+  float32_t sum, diag, invDiag;                  /* Accumulator, diagonal and its inverse */
+  uint32_t n = pSrc->numRows;                    /* Size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (j = 0u; j < n; j++)
+  {
+    pRowJ = pL + (j * n);
+
+    /* Diagonal element */
+    sum = pA[(j * n) + j];
+
+    for (k = 0u; k < j; k++)
+    {
+      sum -= pRowJ[k] * pRowJ[k];
+    }
+
+    if(sum <= 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    (void) arm_sqrt_f32(sum, &diag);
+    invDiag = 1.0f / diag;
+    pRowJ[j] = diag;
+
+    /* Elements below the diagonal */
+    for (i = j + 1u; i < n; i++)
+    {
+      pRowI = pL + (i * n);
+      sum = pA[(i * n) + j];
+
+      for (k = 0u; k < j; k++)
+      {
+        sum -= pRowI[k] * pRowJ[k];
+      }
+
+      pRowI[j] = sum * invDiag;
+    }
+
+    /* Clear the upper triangle of the row */
+    for (k = j + 1u; k < n; k++)
+    {
+      pRowJ[k] = 0.0f;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_cholesky_solve_f32.c
+*
+* Description:	Floating-point solver of a system decomposed by Cholesky.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Solves a floating-point system of equations decomposed by arm_mat_cholesky_f32().
+ * @param[in]       *pSrcL points to the instance of the lower triangular Cholesky factor structure.
+ * @param[in]       *pSrcB points to the instance of the right-hand side matrix structure.
+ * @param[out]      *pDst points to the instance of the solution matrix structure.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match, or
+ * <code>ARM_MATH_SINGULAR</code> if a diagonal element of <code>L</code> is zero.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Solves <code>A * X = B</code> with <code>A = L * L^T</code>: the forward substitution
+ * <code>L * Y = B</code> of arm_mat_solve_lower_triangular_f32() is followed by the back
+ * substitution <code>L^T * X = Y</code>, which reads the columns of <code>L</code> so that
+ * the transpose is not needed. The gain of a Kalman filter, <code>K = P * H^T * S^-1</code>,
+ * is computed as the solution of <code>S * K^T = H * P</code> without inverting
+ * <code>S</code>.
+ */
+
+arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL = pSrcL->pData;                  /* Lower triangular matrix pointer */
+  float32_t *pX, *pXi, *pRowX;                   /* Rows of the output */
+  float32_t coef;                                /* Multiplier of a row */
+  uint32_t n = pDst->numRows;                    /* Number of equations */
+  uint32_t m = pDst->numCols;                    /* Number of right-hand sides */
+  uint32_t i, k, col;                            /* loop counters */
+  arm_status status;                             /* status of the forward substitution */
+
+  /* L * Y = B, Y in the output */
+  status = arm_mat_solve_lower_triangular_f32(pSrcL, pSrcB, pDst);
+
+  if(status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* L^T * X = Y in place, L^T(i,k) = L(k,i) */
+  for (i = n; i > 0u; i--)
+  {
+    pRowX = pDst->pData + ((i - 1u) * m);
+
+    for (k = i; k < n; k++)
+    {
+      /* X(i,:) -= pL[(k * n) + (i - 1u)] * X(k,:) */
+      coef = pL[(k * n) + (i - 1u)];
+      pX = pDst->pData + (k * m);
+      pXi = pRowX;
+      col = m;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling. Process 4 columns at a time. */
+      col = m >> 2u;
+
+      while(col > 0u)
+      {
+        pXi[0] -= coef * pX[0];
+        pXi[1] -= coef * pX[1];
+        pXi[2] -= coef * pX[2];
+        pXi[3] -= coef * pX[3];
+        pXi += 4u;
+        pX += 4u;
+
+        col--;
+      }
+
+      col = m % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(col > 0u)
+      {
+        *pXi++ -= coef * *pX++;
+
+        col--;
+      }
+    }
+
+    /* X(i,:) /= pL[((i - 1u) * n) + (i - 1u)] */
+    if(pL[((i - 1u) * n) + (i - 1u)] == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    coef = 1.0f / pL[((i - 1u) * n) + (i - 1u)];
+
+    for (col = 0u; col < m; col++)
+    {
+      pRowX[col] *= coef;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
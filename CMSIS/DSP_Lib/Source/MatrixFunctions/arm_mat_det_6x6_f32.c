@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_det_6x6_f32.c
+*
+* Description:	Floating-point 6x6 matrix determinant.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSmall
+ * @{
+ */
+
+/**
+ * @brief  Floating-point 6x6 matrix determinant.
+ * @param[in]  *pA    points to the input matrix.
+ * @return determinant of the matrix.
+ *
+ * \par
+ * The matrix is copied and reduced to upper triangular form by Gaussian elimination with
+ * partial pivoting; the determinant is the product of the pivots, its sign changed at
+ * each exchange of rows.
+ */
+
+float32_t arm_mat_det_6x6_f32(
+  const float32_t * pA)
+{
+  float32_t a[36];                               /* Copy of the matrix */
+  float32_t det = 1.0f;                          /* Product of the pivots */
+  float32_t pivot, factor, temp;                 /* Pivot, multiplier and exchanged value */
+  uint32_t i, j, k, p;                           /* loop counters and pivot row */
+
+  memcpy(a, pA, sizeof(a));
+
+  for (k = 0u; k < 6u; k++)
+  {
+    /* Largest element of the column as the pivot */
+    p = k;
+
+    for (i = k + 1u; i < 6u; i++)
+    {
+      if(fabsf(a[(i * 6u) + k]) > fabsf(a[(p * 6u) + k]))
+      {
+        p = i;
+      }
+    }
+
+    pivot = a[(p * 6u) + k];
+
+    if(pivot == 0.0f)
+    {
+      return (0.0f);
+    }
+
+    if(p != k)
+    {
+      for (j = k; j < 6u; j++)
+      {
+        temp = a[(k * 6u) + j];
+        a[(k * 6u) + j] = a[(p * 6u) + j];
+        a[(p * 6u) + j] = temp;
+      }
+
+      det = -det;
+    }
+
+    det *= pivot;
+
+    /* Eliminate the column below the pivot */
+    for (i = k + 1u; i < 6u; i++)
+    {
+      factor = a[(i * 6u) + k] / pivot;
+
+      for (j = k + 1u; j < 6u; j++)
+      {
+        a[(i * 6u) + j] -= factor * a[(k * 6u) + j];
+      }
+    }
+  }
+
+  return (det);
+}
+
+/**
+ * @} end of MatrixSmall group
+ */
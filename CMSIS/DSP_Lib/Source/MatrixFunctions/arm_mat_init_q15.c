@@ -71,6 +71,9 @@ void arm_mat_init_q15(
 
   /* Assign Data pointer */
   S->pData = pData;
+
+  /* Clear the saturation statistics */
+  ARM_SAT_STATS_RESET(S);
 }
 
 /**    
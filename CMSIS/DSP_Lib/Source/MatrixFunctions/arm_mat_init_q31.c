@@ -75,6 +75,9 @@ void arm_mat_init_q31(
 
   /* Assign Data pointer */
   S->pData = pData;
+
+  /* Clear the saturation statistics */
+  ARM_SAT_STATS_RESET(S);
 }
 
 /**    
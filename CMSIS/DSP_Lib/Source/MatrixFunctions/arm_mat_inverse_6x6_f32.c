@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_inverse_6x6_f32.c
+*
+* Description:	Floating-point 6x6 matrix inverse.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSmall
+ * @{
+ */
+
+/**
+ * @brief  Floating-point 6x6 matrix inverse.
+ * @param[in]  *pA    points to the input matrix.
+ * @param[out] *pDst  points to the output inverse matrix.
+ * @return The function returns ARM_MATH_SINGULAR if the matrix is singular, and
+ * ARM_MATH_SUCCESS otherwise.
+ *
+ * \par
+ * Gauss-Jordan elimination with partial pivoting, as in arm_mat_inverse_f32(), on a copy
+ * of the matrix: the input is not modified, and the loops of constant bounds avoid the
+ * size checks and the index arithmetic of the generic function.
+ */
+
+arm_status arm_mat_inverse_6x6_f32(
+  const float32_t * pA,
+  float32_t * pDst)
+{
+  float32_t a[36];                               /* Copy of the matrix */
+  float32_t pivot, factor, temp;                 /* Pivot, multiplier and exchanged value */
+  uint32_t i, j, k, p;                           /* loop counters and pivot row */
+
+  memcpy(a, pA, sizeof(a));
+
+  /* Start from the identity matrix */
+  memset(pDst, 0, 36u * sizeof(float32_t));
+
+  for (i = 0u; i < 36u; i += 7u)
+  {
+    pDst[i] = 1.0f;
+  }
+
+  for (k = 0u; k < 6u; k++)
+  {
+    /* Largest element of the column as the pivot */
+    p = k;
+
+    for (i = k + 1u; i < 6u; i++)
+    {
+      if(fabsf(a[(i * 6u) + k]) > fabsf(a[(p * 6u) + k]))
+      {
+        p = i;
+      }
+    }
+
+    if(a[(p * 6u) + k] == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    if(p != k)
+    {
+      for (j = 0u; j < 6u; j++)
+      {
+        temp = a[(k * 6u) + j];
+        a[(k * 6u) + j] = a[(p * 6u) + j];
+        a[(p * 6u) + j] = temp;
+
+        temp = pDst[(k * 6u) + j];
+        pDst[(k * 6u) + j] = pDst[(p * 6u) + j];
+        pDst[(p * 6u) + j] = temp;
+      }
+    }
+
+    /* Normalize the pivot row */
+    pivot = 1.0f / a[(k * 6u) + k];
+
+    for (j = 0u; j < 6u; j++)
+    {
+      a[(k * 6u) + j] *= pivot;
+      pDst[(k * 6u) + j] *= pivot;
+    }
+
+    /* Eliminate the column from the other rows */
+    for (i = 0u; i < 6u; i++)
+    {
+      if(i != k)
+      {
+        factor = a[(i * 6u) + k];
+
+        for (j = 0u; j < 6u; j++)
+        {
+          a[(i * 6u) + j] -= factor * a[(k * 6u) + j];
+          pDst[(i * 6u) + j] -= factor * pDst[(k * 6u) + j];
+        }
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSmall group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_ldlt_f32.c
+*
+* Description:	Floating-point LDL^T decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL^T decomposition.
+ * @param[in]       *pSrc points to the instance of the input symmetric matrix structure.
+ * @param[out]      *pDst points to the instance of the output unit lower triangular matrix structure.
+ * @param[out]      *pD points to the output vector of the <code>numRows</code> diagonal elements of <code>D</code>.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If a diagonal element of <code>D</code> is zero, the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The decomposition needs no square root, and also exists for some symmetric matrices that
+ * are not positive-definite, such as those of a stationary Kalman filter that has lost its
+ * positive-definiteness to rounding errors; the signs of <code>D</code> then reveal it. No
+ * pivoting is performed.
+ * <pre>
+ *     D(j)   = A(j,j) - L(j,0)^2 * D(0) - ... - L(j,j-1)^2 * D(j-1)
+ *     L(i,j) = (A(i,j) - L(i,0) * L(j,0) * D(0) - ... - L(i,j-1) * L(j,j-1) * D(j-1)) / D(j)     for i > j
+ * </pre>
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pD)
+{
+  float32_t *pA = pSrc->pData;                   /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* Rows of the output */
+  float32_t sum, invD;                           /* Accumulator and inverse of the diagonal */
+  uint32_t n = pSrc->numRows;                    /* Size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (j = 0u; j < n; j++)
+  {
+    pRowJ = pL + (j * n);
+
+    /* Diagonal element */
+    sum = pA[(j * n) + j];
+
+    for (k = 0u; k < j; k++)
+    {
+      sum -= pRowJ[k] * pRowJ[k] * pD[k];
+    }
+
+    if(sum == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    pD[j] = sum;
+    invD = 1.0f / sum;
+    pRowJ[j] = 1.0f;
+
+    /* Elements below the diagonal */
+    for (i = j + 1u; i < n; i++)
+    {
+      pRowI = pL + (i * n);
+      sum = pA[(i * n) + j];
+
+      for (k = 0u; k < j; k++)
+      {
+        sum -= pRowI[k] * pRowJ[k] * pD[k];
+      }
+
+      pRowI[j] = sum * invD;
+    }
+
+    /* Clear the upper triangle of the row */
+    for (k = j + 1u; k < n; k++)
+    {
+      pRowJ[k] = 0.0f;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
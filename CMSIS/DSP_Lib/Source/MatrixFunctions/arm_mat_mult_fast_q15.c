@@ -333,6 +333,7 @@ arm_status arm_mat_mult_fast_q15(
         }
 
         /* Saturate and store the result in the destination buffer */
+        ARM_SAT_STATS_Q15(pDst, sum >> 15);
         *px = (q15_t) (sum >> 15);
         px++;
 
@@ -186,6 +186,7 @@ arm_status arm_mat_mult_fast_q31(
         }
 
         /* Convert the result from 2.30 to 1.31 format and store in destination buffer */
+        ARM_SAT_STATS_Q31(pDst, (q63_t) sum << 1);
         *px++ = sum << 1;
 
         /* Update the pointer pIn2 to point to the  starting address of the next column */
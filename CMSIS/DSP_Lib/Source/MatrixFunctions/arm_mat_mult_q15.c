@@ -350,6 +350,7 @@ arm_status arm_mat_mult_q15(
         }
 
         /* Saturate and store the result in the destination buffer */
+        ARM_SAT_STATS_Q15(pDst, sum >> 15);
         *px = (q15_t) (__SSAT((sum >> 15), 16));
         px++;
 
@@ -434,6 +435,7 @@ arm_status arm_mat_mult_q15(
 
         /* Convert the result from 34.30 to 1.15 format and store the saturated value in destination buffer */
         /* Saturate and store the result in the destination buffer */
+        ARM_SAT_STATS_Q15(pDst, sum >> 15);
         *px++ = (q15_t) __SSAT((sum >> 15), 16);
 
         /* Decrement the column loop counter */
@@ -187,6 +187,7 @@ arm_status arm_mat_mult_q31(
         }
 
         /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
+        ARM_SAT_STATS_Q31(pDst, sum >> 31);
         *px++ = (q31_t) (sum >> 31);
 
         /* Update the pointer pIn2 to point to the  starting address of the next column */
@@ -259,6 +260,7 @@ arm_status arm_mat_mult_q31(
         }
 
         /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
+        ARM_SAT_STATS_Q31(pDst, sum >> 31);
         *px++ = (q31_t) (sum >> 31);
 
         /* Decrement the column loop counter */
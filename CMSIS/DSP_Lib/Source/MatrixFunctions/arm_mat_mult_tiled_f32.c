@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_mult_tiled_f32.c
+*
+* Description:	Floating-point matrix multiplication with 4x4 register tiles.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * Number of multiply-accumulates, <code>numRowsA*numColsA*numColsB</code>, below which
+ * arm_mat_mult_tiled_f32() calls arm_mat_mult_f32(): the transposition of B then costs
+ * more than it saves.
+ */
+#ifndef ARM_MAT_MULT_TILED_MIN_MACS
+#define ARM_MAT_MULT_TILED_MIN_MACS    512u
+#endif
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix multiplication with 4x4 register tiles.
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pState points to a buffer of <code>numRowsB*numColsB</code> samples holding the transpose of B
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * arm_mat_mult_f32() computes each output as the dot product of a row of A with a column
+ * of B, which is read with a stride of <code>numColsB</code> samples and loaded again for
+ * every row of A. Here B is transposed once into <code>pState</code>, as in
+ * arm_mat_mult_q15(), and on Cortex-M3 and Cortex-M4 the output is computed in tiles of 4x4
+ * samples: each step of the inner loop loads 4 samples of 4 rows of A and 4 samples of 4
+ * rows of the transpose, all contiguous, and performs 16 multiply-accumulates into 16
+ * accumulators held in registers, where arm_mat_mult_f32() needs 2 loads per
+ * multiply-accumulate. The outputs of the last rows and columns that do not fill a tile
+ * are computed one at a time.
+ * \par
+ * Below <code>ARM_MAT_MULT_TILED_MIN_MACS</code> multiply-accumulates, 512 by default, the
+ * function calls arm_mat_mult_f32() and <code>pState</code> is not used.
+ */
+
+arm_status arm_mat_mult_tiled_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pState)
+{
+  float32_t *pInA = pSrcA->pData;                /* input data matrix pointer A */
+  float32_t *pSrcBT = pState;                    /* input data matrix pointer for transpose of B */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pIn1, *pIn2;                        /* Row pointers of A and of the transpose */
+  float32_t sum;                                 /* Accumulator */
+  arm_matrix_instance_f32 BT;                    /* Transpose of B */
+  uint32_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint32_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint32_t row, col, colCnt;                     /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *pA1, *pA2, *pA3, *pB1, *pB2, *pB3;  /* Row pointers of a tile */
+  float32_t a0, a1, a2, a3, b0, b1, b2, b3;      /* Samples of the rows of a tile */
+  float32_t c00, c01, c02, c03, c10, c11, c12, c13;     /* Accumulators of a tile */
+  float32_t c20, c21, c22, c23, c30, c31, c32, c33;     /* Accumulators of a tile */
+  float32_t *px;                                 /* Output pointer of a tile */
+  uint32_t i;                                    /* Row counter of a tile */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* Small products are faster without the transposition */
+  if((numRowsA * numColsA * numColsB) < ARM_MAT_MULT_TILED_MIN_MACS)
+  {
+    return (arm_mat_mult_f32(pSrcA, pSrcB, pDst));
+  }
+
+  /* Transpose B once: the columns of B become contiguous rows */
+  arm_mat_init_f32(&BT, pSrcB->numCols, pSrcB->numRows, pSrcBT);
+  (void) arm_mat_trans_f32(pSrcB, &BT);
+
+  row = 0u;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Tiles of 4 rows of A by 4 columns of B */
+  while((row + 3u) < numRowsA)
+  {
+    col = 0u;
+
+    while((col + 3u) < numColsB)
+    {
+      c00 = c01 = c02 = c03 = 0.0f;
+      c10 = c11 = c12 = c13 = 0.0f;
+      c20 = c21 = c22 = c23 = 0.0f;
+      c30 = c31 = c32 = c33 = 0.0f;
+
+      pIn1 = pInA + (row * numColsA);
+      pA1 = pIn1 + numColsA;
+      pA2 = pA1 + numColsA;
+      pA3 = pA2 + numColsA;
+
+      pIn2 = pSrcBT + (col * numColsA);
+      pB1 = pIn2 + numColsA;
+      pB2 = pB1 + numColsA;
+      pB3 = pB2 + numColsA;
+
+      colCnt = numColsA;
+
+      do
+      {
+        /* c(m,n) += a(m,k) * b(k,n) for the 4x4 outputs of the tile */
+        a0 = *pIn1++;
+        a1 = *pA1++;
+        a2 = *pA2++;
+        a3 = *pA3++;
+
+        b0 = *pIn2++;
+        b1 = *pB1++;
+        b2 = *pB2++;
+        b3 = *pB3++;
+
+        c00 += a0 * b0;
+        c01 += a0 * b1;
+        c02 += a0 * b2;
+        c03 += a0 * b3;
+
+        c10 += a1 * b0;
+        c11 += a1 * b1;
+        c12 += a1 * b2;
+        c13 += a1 * b3;
+
+        c20 += a2 * b0;
+        c21 += a2 * b1;
+        c22 += a2 * b2;
+        c23 += a2 * b3;
+
+        c30 += a3 * b0;
+        c31 += a3 * b1;
+        c32 += a3 * b2;
+        c33 += a3 * b3;
+
+        /* Decrement the loop counter */
+        colCnt--;
+      } while(colCnt > 0u);
+
+      /* Store the tile in the destination buffer */
+      px = pOut + (row * numColsB) + col;
+      px[0] = c00;
+      px[1] = c01;
+      px[2] = c02;
+      px[3] = c03;
+      px += numColsB;
+      px[0] = c10;
+      px[1] = c11;
+      px[2] = c12;
+      px[3] = c13;
+      px += numColsB;
+      px[0] = c20;
+      px[1] = c21;
+      px[2] = c22;
+      px[3] = c23;
+      px += numColsB;
+      px[0] = c30;
+      px[1] = c31;
+      px[2] = c32;
+      px[3] = c33;
+
+      col += 4u;
+    }
+
+    /* The last columns of the 4 rows, one output at a time */
+    for (; col < numColsB; col++)
+    {
+      for (i = row; i < (row + 4u); i++)
+      {
+        pIn1 = pInA + (i * numColsA);
+        pIn2 = pSrcBT + (col * numColsA);
+
+        sum = 0.0f;
+        colCnt = numColsA;
+
+        while(colCnt > 0u)
+        {
+          sum += *pIn1++ * *pIn2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        pOut[(i * numColsB) + col] = sum;
+      }
+    }
+
+    row += 4u;
+  }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  /* The last rows, or all the rows on Cortex-M0, one output at a time */
+  for (; row < numRowsA; row++)
+  {
+    for (col = 0u; col < numColsB; col++)
+    {
+      /* c(m,n) = a(m,1) * bT(n,1) + ... + a(m,p) * bT(n,p), both rows being contiguous */
+      pIn1 = pInA + (row * numColsA);
+      pIn2 = pSrcBT + (col * numColsA);
+
+      sum = 0.0f;
+      colCnt = numColsA;
+
+      while(colCnt > 0u)
+      {
+        sum += *pIn1++ * *pIn2++;
+
+        /* Decrement the loop counter */
+        colCnt--;
+      }
+
+      pOut[(row * numColsB) + col] = sum;
+    }
+  }
+
+  /* Set status as ARM_MATH_SUCCESS */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_qr_f32.c
+*
+* Description:	Floating-point Householder QR decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixQR QR Decomposition and Least Squares
+ *
+ * Decompose an <code>m x n</code> matrix <code>A</code>, with <code>m >= n</code>, as
+ * <pre>
+ *     A = Q * R
+ * </pre>
+ * where <code>Q</code> is an <code>m x m</code> orthogonal matrix and <code>R</code> an
+ * <code>m x n</code> upper triangular matrix, and solve the overdetermined systems
+ * <code>A * X = B</code> in the least squares sense, minimizing the norm of each column of
+ * <code>A * X - B</code>:
+ * <pre>
+ *     R(0:n-1,:) * X = (Q^T * B)(0:n-1,:)
+ * </pre>
+ *
+ * Solving the normal equations <code>A^T * A * X = A^T * B</code>, with
+ * arm_mat_trans_f32(), arm_mat_mult_f32() and arm_mat_inverse_f32(), squares the
+ * condition number of the problem: in single precision a fit with a condition number of
+ * 10^3 already loses most of its digits. The QR decomposition works on <code>A</code>
+ * itself and costs about <code>n^2 * (m - n/3)</code> multiply-accumulates, less than
+ * forming <code>A^T * A</code> and inverting it.
+ *
+ * arm_mat_qr_f32() computes the decomposition with Householder reflections, in place if
+ * needed, and arm_mat_qr_solve_f32() solves the least squares problem with it.
+ * arm_mat_qr_update_f32() adds a row to <code>A</code> and <code>B</code> with Givens
+ * rotations, in <code>n^2</code> operations instead of a new decomposition, for the
+ * recursive least squares estimators of online calibrations:
+ * <pre>
+ *     R, Z = 0                                                  n x n and n x k
+ *     for each new row a of A and b of B:
+ *         arm_mat_qr_update_f32(&R, &Z, a, b, lambda)
+ *         arm_mat_solve_upper_triangular_f32(&R, &Z, &X)        when X is needed
+ * </pre>
+ * The forgetting factor <code>lambda</code> weights the row added <code>p</code> rows
+ * before the last one by <code>lambda^p</code>.
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Floating-point Householder QR decomposition.
+ * @param[in]       *pSrc points to the instance of the input m x n matrix structure.
+ * @param[out]      *pDst points to the instance of the output m x n matrix structure.
+ * @param[out]      *pTau points to the output vector of the n scale factors of the reflections.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix has fewer rows than columns or
+ * if the size of the output matrix does not match the size of the input matrix.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The output holds <code>R</code> in its upper triangle and <code>Q</code> in a compact
+ * form below the diagonal: <code>Q = H(0) * H(1) * ... * H(n-1)</code>, each reflection
+ * being
+ * <pre>
+ *     H(j) = I - pTau[j] * v * v^T
+ * </pre>
+ * where <code>v</code> is zero above the row <code>j</code>, one at the row
+ * <code>j</code>, and <code>pDst(i,j)</code> for <code>i > j</code>. The output may be
+ * the input matrix. A rank deficient matrix gives a zero on the diagonal of
+ * <code>R</code>, detected by arm_mat_qr_solve_f32().
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pTau)
+{
+  float32_t *pA = pDst->pData;                   /* output data matrix pointer */
+  float32_t *pCol;                               /* Column being reflected */
+  float32_t alpha, beta, norm, scale, w;         /* Temporary variables */
+  uint32_t m = pSrc->numRows;                    /* Number of rows */
+  uint32_t n = pSrc->numCols;                    /* Number of columns */
+  uint32_t i, j, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((m < n) || (pDst->numRows != m) || (pDst->numCols != n))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  if(pA != pSrc->pData)
+  {
+    memcpy(pA, pSrc->pData, m * n * sizeof(float32_t));
+  }
+
+  for (j = 0u; j < n; j++)
+  {
+    /* Norm of the column below the diagonal */
+    pCol = pA + (j * n) + j;
+    alpha = *pCol;
+    norm = 0.0f;
+
+    for (i = j + 1u; i < m; i++)
+    {
+      pCol += n;
+      norm += *pCol * *pCol;
+    }
+
+    if(norm == 0.0f)
+    {
+      /* Nothing to eliminate: H(j) = I */
+      pTau[j] = 0.0f;
+      continue;
+    }
+
+    /* beta = -sign(alpha) * norm of the column, so that alpha - beta does not cancel */
+    (void) arm_sqrt_f32((alpha * alpha) + norm, &beta);
+    if(alpha >= 0.0f)
+    {
+      beta = -beta;
+    }
+
+    pTau[j] = (beta - alpha) / beta;
+    scale = 1.0f / (alpha - beta);
+
+    /* v = column / (alpha - beta), stored below the diagonal, R(j,j) = beta */
+    pCol = pA + (j * n) + j;
+    *pCol = beta;
+
+    for (i = j + 1u; i < m; i++)
+    {
+      pCol += n;
+      *pCol *= scale;
+    }
+
+    /* Reflection of the columns on the right: A(:,c) -= tau * v * (v^T * A(:,c)) */
+    for (c = j + 1u; c < n; c++)
+    {
+      w = pA[(j * n) + c];
+      for (i = j + 1u; i < m; i++)
+      {
+        w += pA[(i * n) + j] * pA[(i * n) + c];
+      }
+
+      w *= pTau[j];
+
+      pA[(j * n) + c] -= w;
+      for (i = j + 1u; i < m; i++)
+      {
+        pA[(i * n) + c] -= w * pA[(i * n) + j];
+      }
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_qr_solve_f32.c
+*
+* Description:	Floating-point least squares solver.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Solves a floating-point least squares problem decomposed by arm_mat_qr_f32().
+ * @param[in]       *pSrcQR points to the instance of the m x n decomposition structure.
+ * @param[in]       *pTau points to the n scale factors of the reflections.
+ * @param[in]       *pSrcB points to the instance of the m x k right-hand side matrix structure.
+ * @param[out]      *pDst points to the instance of the n x k solution matrix structure.
+ * @param[out]      *pScratch points to a buffer of m*k samples.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match, or
+ * <code>ARM_MATH_SINGULAR</code> if <code>A</code> is rank deficient.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * The buffer receives <code>Q^T * B</code>, and <code>R(0:n-1,:) * X</code> equal to its
+ * first <code>n</code> rows is solved by arm_mat_solve_upper_triangular_f32(). Its last
+ * <code>m - n</code> rows are left with the rotated residuals: the sum of their squares
+ * in a column is the squared norm of the residual of the fit of that column. Its first
+ * <code>n</code> rows are the matrix <code>Z</code> to start arm_mat_qr_update_f32() with.
+ */
+
+arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pSrcQR,
+  const float32_t * pTau,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pScratch)
+{
+  float32_t *pA = pSrcQR->pData;                 /* decomposition data matrix pointer */
+  float32_t *pB;                                 /* Column of Q^T * B */
+  float32_t w;                                   /* Projection on the reflection vector */
+  arm_matrix_instance_f32 R, Z;                  /* Triangular system */
+  uint32_t m = pSrcQR->numRows;                  /* Number of rows */
+  uint32_t n = pSrcQR->numCols;                  /* Number of unknowns */
+  uint32_t k = pSrcB->numCols;                   /* Number of right-hand sides */
+  uint32_t i, j, c;                              /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((m < n) || (pSrcB->numRows != m) || (pDst->numRows != n) || (pDst->numCols != k))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  memcpy(pScratch, pSrcB->pData, m * k * sizeof(float32_t));
+
+  /* Q^T * B = H(n-1) * ... * H(0) * B */
+  for (j = 0u; j < n; j++)
+  {
+    if(pTau[j] == 0.0f)
+    {
+      continue;
+    }
+
+    for (c = 0u; c < k; c++)
+    {
+      pB = pScratch + c;
+      w = pB[j * k];
+      for (i = j + 1u; i < m; i++)
+      {
+        w += pA[(i * n) + j] * pB[i * k];
+      }
+
+      w *= pTau[j];
+
+      pB[j * k] -= w;
+      for (i = j + 1u; i < m; i++)
+      {
+        pB[i * k] -= w * pA[(i * n) + j];
+      }
+    }
+  }
+
+  /* R and Q^T * B restricted to their first n rows, with the same row lengths */
+  arm_mat_init_f32(&R, (uint16_t) n, (uint16_t) n, pA);
+  arm_mat_init_f32(&Z, (uint16_t) n, (uint16_t) k, pScratch);
+
+  return (arm_mat_solve_upper_triangular_f32(&R, &Z, pDst));
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_qr_update_f32.c
+*
+* Description:	Floating-point QR update by Givens rotations.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixQR
+ * @{
+ */
+
+/**
+ * @brief Adds a row to a floating-point least squares problem by Givens rotations.
+ * @param[in,out]   *pR points to the instance of the n x n upper triangular matrix structure.
+ * @param[in,out]   *pZ points to the instance of the n x k rotated right-hand side matrix structure.
+ * @param[in,out]   *pRow points to the n values of the new row of <code>A</code>, overwritten.
+ * @param[in,out]   *pRhs points to the k values of the new row of <code>B</code>, overwritten.
+ * @param[in]       lambda forgetting factor, in (0 1], 1 to keep all the rows.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * <code>R</code> and <code>Z</code> are first scaled by <code>sqrt(lambda)</code>. The
+ * rotation <code>j</code> then combines the row <code>j</code> of <code>R</code> and
+ * <code>Z</code> with the new row to clear its element <code>j</code>:
+ * <pre>
+ *     r = sqrt(R(j,j)^2 + a(j)^2),   c = R(j,j) / r,   s = a(j) / r
+ *     R(j,l), a(l) = c * R(j,l) + s * a(l), c * a(l) - s * R(j,l)      for l >= j
+ *     Z(j,l), b(l) = c * Z(j,l) + s * b(l), c * b(l) - s * Z(j,l)
+ * </pre>
+ * Only the upper triangle of <code>R</code> is read and written: <code>R</code> may be
+ * the first n rows of the output of arm_mat_qr_f32(), and <code>Z</code> the first n rows
+ * of the buffer of arm_mat_qr_solve_f32(), or both may start at zero. On return the
+ * square of each value of <code>pRhs</code> is the increase of the weighted sum of the
+ * squared residuals of the column: the prediction error of the new row, for outlier
+ * detection.
+ */
+
+arm_status arm_mat_qr_update_f32(
+  arm_matrix_instance_f32 * pR,
+  arm_matrix_instance_f32 * pZ,
+  float32_t * pRow,
+  float32_t * pRhs,
+  float32_t lambda)
+{
+  float32_t *pRowR, *pRowZ;                      /* Rows of R and Z */
+  float32_t r, c, s, t;                          /* Rotation */
+  float32_t gain;                                /* sqrt(lambda) */
+  uint32_t n = pR->numRows;                      /* Number of unknowns */
+  uint32_t k = pZ->numCols;                      /* Number of right-hand sides */
+  uint32_t j, l;                                 /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pR->numCols != n) || (pZ->numRows != n))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  if(lambda != 1.0f)
+  {
+    (void) arm_sqrt_f32(lambda, &gain);
+
+    for (j = 0u; j < n; j++)
+    {
+      pRowR = pR->pData + (j * n);
+      for (l = j; l < n; l++)
+      {
+        pRowR[l] *= gain;
+      }
+    }
+    arm_scale_f32(pZ->pData, gain, pZ->pData, n * k);
+  }
+
+  for (j = 0u; j < n; j++)
+  {
+    if(pRow[j] == 0.0f)
+    {
+      /* Nothing to clear: identity rotation */
+      continue;
+    }
+
+    pRowR = pR->pData + (j * n);
+    pRowZ = pZ->pData + (j * k);
+
+    (void) arm_sqrt_f32((pRowR[j] * pRowR[j]) + (pRow[j] * pRow[j]), &r);
+    c = pRowR[j] / r;
+    s = pRow[j] / r;
+
+    pRowR[j] = r;
+    pRow[j] = 0.0f;
+
+    for (l = j + 1u; l < n; l++)
+    {
+      t = pRowR[l];
+      pRowR[l] = (c * t) + (s * pRow[l]);
+      pRow[l] = (c * pRow[l]) - (s * t);
+    }
+
+    for (l = 0u; l < k; l++)
+    {
+      t = pRowZ[l];
+      pRowZ[l] = (c * t) + (s * pRhs[l]);
+      pRhs[l] = (c * pRhs[l]) - (s * t);
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixQR group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_solve_lower_triangular_f32.c
+*
+* Description:	Floating-point lower triangular system solver.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSolve Triangular System Solvers
+ *
+ * Solve the systems of equations <code>T * X = B</code>, where <code>T</code> is an
+ * <code>n x n</code> lower or upper triangular matrix, by forward or back substitution,
+ * and <code>B</code> and <code>X</code> are <code>n x m</code> matrices holding
+ * <code>m</code> right-hand sides and solutions. arm_mat_cholesky_solve_f32() solves
+ * <code>L * L^T * X = B</code> with the output of arm_mat_cholesky_f32().
+ *
+ * The rows of the solution are computed in turn, each row being updated with the rows
+ * already solved: all the accesses to <code>B</code> and <code>X</code> are contiguous.
+ * The output may be the matrix <code>B</code>, which is then overwritten by the solution.
+ * When a diagonal element of <code>T</code> is zero, the functions return
+ * <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Solves a floating-point lower triangular system of equations by forward substitution.
+ * @param[in]       *pSrcL points to the instance of the lower triangular matrix structure.
+ * @param[in]       *pSrcB points to the instance of the right-hand side matrix structure.
+ * @param[out]      *pDst points to the instance of the solution matrix structure.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match, or
+ * <code>ARM_MATH_SINGULAR</code> if a diagonal element of <code>L</code> is zero.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Only the lower triangle of <code>L</code> is read.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pL = pSrcL->pData;                  /* Lower triangular matrix pointer */
+  float32_t *pX, *pXi, *pRowX;                   /* Rows of the output */
+  float32_t coef;                                /* Multiplier of a row */
+  uint32_t n = pDst->numRows;                    /* Number of equations */
+  uint32_t m = pDst->numCols;                    /* Number of right-hand sides */
+  uint32_t i, k, col;                            /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcL->numRows != pSrcL->numCols) || (pSrcL->numRows != pSrcB->numRows)
+     || (pSrcB->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = 0u; i < n; i++)
+  {
+    pRowX = pDst->pData + (i * m);
+
+    /* X(i,:) = B(i,:) */
+    if(pRowX != (pSrcB->pData + (i * m)))
+    {
+      memcpy(pRowX, pSrcB->pData + (i * m), m * sizeof(float32_t));
+    }
+
+    for (k = 0u; k < i; k++)
+    {
+      /* X(i,:) -= pL[(i * n) + k] * X(k,:) */
+      coef = pL[(i * n) + k];
+      pX = pDst->pData + (k * m);
+      pXi = pRowX;
+      col = m;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling. Process 4 columns at a time. */
+      col = m >> 2u;
+
+      while(col > 0u)
+      {
+        pXi[0] -= coef * pX[0];
+        pXi[1] -= coef * pX[1];
+        pXi[2] -= coef * pX[2];
+        pXi[3] -= coef * pX[3];
+        pXi += 4u;
+        pX += 4u;
+
+        col--;
+      }
+
+      col = m % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(col > 0u)
+      {
+        *pXi++ -= coef * *pX++;
+
+        col--;
+      }
+    }
+
+    /* X(i,:) /= pL[(i * n) + i] */
+    if(pL[(i * n) + i] == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    coef = 1.0f / pL[(i * n) + i];
+
+    for (col = 0u; col < m; col++)
+    {
+      pRowX[col] *= coef;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_solve_upper_triangular_f32.c
+*
+* Description:	Floating-point upper triangular system solver.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Solves a floating-point upper triangular system of equations by back substitution.
+ * @param[in]       *pSrcU points to the instance of the upper triangular matrix structure.
+ * @param[in]       *pSrcB points to the instance of the right-hand side matrix structure.
+ * @param[out]      *pDst points to the instance of the solution matrix structure.
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the sizes of the matrices do not match, or
+ * <code>ARM_MATH_SINGULAR</code> if a diagonal element of <code>U</code> is zero.
+ * Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * \par
+ * Only the upper triangle of <code>U</code> is read.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pU = pSrcU->pData;                  /* Upper triangular matrix pointer */
+  float32_t *pX, *pXi, *pRowX;                   /* Rows of the output */
+  float32_t coef;                                /* Multiplier of a row */
+  uint32_t n = pDst->numRows;                    /* Number of equations */
+  uint32_t m = pDst->numCols;                    /* Number of right-hand sides */
+  uint32_t i, k, col;                            /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcU->numRows != pSrcU->numCols) || (pSrcU->numRows != pSrcB->numRows)
+     || (pSrcB->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (i = n; i > 0u; i--)
+  {
+    pRowX = pDst->pData + ((i - 1u) * m);
+
+    /* X(i,:) = B(i,:) */
+    if(pRowX != (pSrcB->pData + ((i - 1u) * m)))
+    {
+      memcpy(pRowX, pSrcB->pData + ((i - 1u) * m), m * sizeof(float32_t));
+    }
+
+    for (k = i; k < n; k++)
+    {
+      /* X(i,:) -= pU[((i - 1u) * n) + k] * X(k,:) */
+      coef = pU[((i - 1u) * n) + k];
+      pX = pDst->pData + (k * m);
+      pXi = pRowX;
+      col = m;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling. Process 4 columns at a time. */
+      col = m >> 2u;
+
+      while(col > 0u)
+      {
+        pXi[0] -= coef * pX[0];
+        pXi[1] -= coef * pX[1];
+        pXi[2] -= coef * pX[2];
+        pXi[3] -= coef * pX[3];
+        pXi += 4u;
+        pX += 4u;
+
+        col--;
+      }
+
+      col = m % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(col > 0u)
+      {
+        *pXi++ -= coef * *pX++;
+
+        col--;
+      }
+    }
+
+    /* X(i,:) /= pU[((i - 1u) * n) + (i - 1u)] */
+    if(pU[((i - 1u) * n) + (i - 1u)] == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    coef = 1.0f / pU[((i - 1u) * n) + (i - 1u)];
+
+    for (col = 0u; col < m; col++)
+    {
+      pRowX[col] *= coef;
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
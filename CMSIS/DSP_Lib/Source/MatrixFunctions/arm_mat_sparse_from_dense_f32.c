@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sparse_from_dense_f32.c
+*
+* Description:	Conversion of a Floating-point dense matrix to sparse storage.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Conversion of a Floating-point dense matrix to sparse storage.
+ * @param[in]  *pSrc   points to the instance of the dense matrix structure.
+ * @param[out] *pDst   points to the instance of the sparse matrix structure, with buffers of maxNnz elements.
+ * @param[in]  maxNnz  capacity of the pData and pColIdx buffers of pDst.
+ * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+ * ARM_MATH_ARGUMENT_ERROR if the matrix has more than maxNnz nonzero elements.
+ *
+ * \par
+ * The nonzero elements are stored row after row and <code>nnz</code> is set. The row
+ * offsets buffer holds <code>numRows+1</code> values. On ARM_MATH_ARGUMENT_ERROR, the
+ * content of <code>pDst</code> is not valid.
+ */
+
+arm_status arm_mat_sparse_from_dense_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_sparse_instance_f32 * pDst,
+  uint32_t maxNnz)
+{
+  float32_t *pIn = pSrc->pData;                 /* input data matrix pointer */
+  float32_t in;                                 /* element of the input */
+  uint32_t nnz = 0u;                            /* number of stored elements */
+  uint16_t row, col;                            /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pDst->numRows) || (pSrc->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (row = 0u; row < pSrc->numRows; row++)
+  {
+    pDst->pRowPtr[row] = nnz;
+
+    for (col = 0u; col < pSrc->numCols; col++)
+    {
+      in = *pIn++;
+
+      if(in != 0.0f)
+      {
+        if(nnz == maxNnz)
+        {
+          return (ARM_MATH_ARGUMENT_ERROR);
+        }
+
+        pDst->pData[nnz] = in;
+        pDst->pColIdx[nnz] = col;
+        nnz++;
+      }
+    }
+  }
+
+  pDst->pRowPtr[pSrc->numRows] = nnz;
+  pDst->nnz = nnz;
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
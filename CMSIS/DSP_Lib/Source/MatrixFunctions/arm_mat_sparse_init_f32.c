@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sparse_init_f32.c
+*
+* Description:	Floating-point sparse matrix initialization.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief  Floating-point sparse matrix initialization.
+ * @param[in,out] *S          points to an instance of the Floating-point sparse matrix structure.
+ * @param[in]     nRows       number of rows in the matrix.
+ * @param[in]     nColumns    number of columns in the matrix.
+ * @param[in]     nnz         number of stored elements.
+ * @param[in]     *pData      points to the stored elements.
+ * @param[in]     *pColIdx    points to the column indexes of the stored elements.
+ * @param[in]     *pRowPtr    points to the nRows+1 row offsets.
+ * @return        none
+ */
+
+void arm_mat_sparse_init_f32(
+  arm_matrix_sparse_instance_f32 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  uint32_t nnz,
+  float32_t * pData,
+  uint16_t * pColIdx,
+  uint32_t * pRowPtr)
+{
+  /* Assign Number of Rows */
+  S->numRows = nRows;
+
+  /* Assign Number of Columns */
+  S->numCols = nColumns;
+
+  /* Assign Number of stored elements */
+  S->nnz = nnz;
+
+  /* Assign Data, Column index and Row offset pointers */
+  S->pData = pData;
+  S->pColIdx = pColIdx;
+  S->pRowPtr = pRowPtr;
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
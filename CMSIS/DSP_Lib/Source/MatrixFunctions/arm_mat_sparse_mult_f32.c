@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sparse_mult_f32.c
+*
+* Description:	Floating-point sparse by dense matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point sparse by dense matrix multiplication.
+ * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+ * @param[in]  *pSrcB  points to the instance of the dense matrix structure.
+ * @param[out] *pDst   points to the instance of the dense output matrix structure.
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * The row <code>i</code> of the output is the sum of the rows <code>k</code> of
+ * <code>B</code> scaled by the stored elements <code>A(i,k)</code>: every access of
+ * <code>B</code> and of the output is contiguous, and the cost is
+ * <code>nnz*numColsB</code> multiply-accumulates.
+ */
+
+arm_status arm_mat_sparse_mult_f32(
+  const arm_matrix_sparse_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrcA->pData;                 /* stored elements pointer */
+  uint16_t *pIdx = pSrcA->pColIdx;              /* column indexes pointer */
+  uint32_t *pRow = pSrcA->pRowPtr;              /* row offsets pointer */
+  float32_t *pOut = pDst->pData;                /* output data matrix pointer */
+  float32_t *pIn1, *pIn2;                       /* rows of the output and of B */
+  float32_t coef;                               /* stored element */
+  uint32_t n = pSrcB->numCols;                  /* columns of B and of the output */
+  uint32_t row, cnt, col;                       /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) || (pDst->numRows != pSrcA->numRows)
+     || (pDst->numCols != n))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (row = 0u; row < pSrcA->numRows; row++)
+  {
+    memset(pOut, 0, n * sizeof(float32_t));
+
+    for (cnt = pRow[row + 1u] - pRow[row]; cnt > 0u; cnt--)
+    {
+      coef = *pA++;
+      pIn1 = pOut;
+      pIn2 = pSrcB->pData + (*pIdx++ * n);
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling. Process 4 columns at a time. */
+      col = n >> 2u;
+
+      while(col > 0u)
+      {
+        pIn1[0] += coef * pIn2[0];
+        pIn1[1] += coef * pIn2[1];
+        pIn1[2] += coef * pIn2[2];
+        pIn1[3] += coef * pIn2[3];
+        pIn1 += 4u;
+        pIn2 += 4u;
+
+        col--;
+      }
+
+      col = n % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      col = n;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(col > 0u)
+      {
+        *pIn1++ += coef * *pIn2++;
+
+        col--;
+      }
+    }
+
+    pOut += n;
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sparse_mult_q31.c
+*
+* Description:	Q31 sparse by dense matrix multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q31 sparse by dense matrix multiplication.
+ * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+ * @param[in]  *pSrcB  points to the instance of the dense matrix structure.
+ * @param[out] *pDst   points to the instance of the dense output matrix structure.
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * Each output element is accumulated over the stored elements of its row of
+ * <code>A</code> in a 64-bit accumulator in 2.62 format, shifted right by 31 bits and
+ * saturated to 1.31 format, as arm_mat_sparse_vec_mult_q31().
+ */
+
+arm_status arm_mat_sparse_mult_q31(
+  const arm_matrix_sparse_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+  arm_matrix_instance_q31 * pDst)
+{
+  q31_t *pA;                                    /* stored elements pointer */
+  uint16_t *pIdx;                               /* column indexes pointer */
+  uint32_t *pRow = pSrcA->pRowPtr;              /* row offsets pointer */
+  q31_t *pOut = pDst->pData;                    /* output data matrix pointer */
+  q31_t *pB;                                    /* column of B */
+  q63_t sum;                                    /* accumulator */
+  uint32_t n = pSrcB->numCols;                  /* columns of B and of the output */
+  uint32_t row, cnt, col;                       /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) || (pDst->numRows != pSrcA->numRows)
+     || (pDst->numCols != n))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (row = 0u; row < pSrcA->numRows; row++)
+  {
+    for (col = 0u; col < n; col++)
+    {
+      /* Dot product of the stored elements of the row with the column of B */
+      pA = pSrcA->pData + pRow[row];
+      pIdx = pSrcA->pColIdx + pRow[row];
+      pB = pSrcB->pData + col;
+      sum = 0;
+
+      for (cnt = pRow[row + 1u] - pRow[row]; cnt > 0u; cnt--)
+      {
+        sum += (q63_t) *pA++ * pB[*pIdx++ * n];
+      }
+
+      *pOut++ = clip_q63_to_q31(sum >> 31);
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
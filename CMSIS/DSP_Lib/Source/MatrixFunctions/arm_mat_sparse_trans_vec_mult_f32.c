@@ -0,0 +1,76 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sparse_trans_vec_mult_f32.c
+*
+* Description:	Floating-point transposed sparse matrix by vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point transposed sparse matrix by vector multiplication.
+ * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+ * @param[in]  *pVec   points to the input vector of numRows elements.
+ * @param[out] *pDst   points to the output vector of numCols elements.
+ * @return none.
+ *
+ * \par
+ * The output is cleared, then the row <code>i</code> of the matrix, scaled by
+ * <code>pVec[i]</code>, is added to it: <code>pDst = A^T * pVec</code> with the storage
+ * of <code>A</code>, without building its transpose.
+ */
+
+void arm_mat_sparse_trans_vec_mult_f32(
+  const arm_matrix_sparse_instance_f32 * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t *pA = pSrcA->pData;                 /* stored elements pointer */
+  uint16_t *pIdx = pSrcA->pColIdx;              /* column indexes pointer */
+  uint32_t *pRow = pSrcA->pRowPtr;              /* row offsets pointer */
+  float32_t in;                                 /* element of the input vector */
+  uint32_t row, cnt;                            /* loop counters */
+
+  memset(pDst, 0, pSrcA->numCols * sizeof(float32_t));
+
+  for (row = 0u; row < pSrcA->numRows; row++)
+  {
+    in = *pVec++;
+    cnt = pRow[row + 1u] - pRow[row];
+
+    if(in == 0.0f)
+    {
+      /* Nothing to add, skip the row */
+      pA += cnt;
+      pIdx += cnt;
+      continue;
+    }
+
+    while(cnt > 0u)
+    {
+      pDst[*pIdx++] += *pA++ * in;
+
+      cnt--;
+    }
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
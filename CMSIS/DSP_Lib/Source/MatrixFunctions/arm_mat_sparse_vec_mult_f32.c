@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sparse_vec_mult_f32.c
+*
+* Description:	Floating-point sparse matrix by vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSparse Sparse Matrix Functions
+ *
+ * Matrices whose elements are mostly zeros, stored in compressed sparse row (CSR)
+ * format: only the <code>nnz</code> nonzero elements are kept, row after row, with their
+ * column indexes, and <code>pRowPtr[i]</code> is the offset of the row <code>i</code>,
+ * <code>pRowPtr[numRows]</code> being <code>nnz</code>. For example
+ * <pre>
+ *     | 5 0 0 1 |        pData   = { 5, 1, 2, 3 }
+ *     | 0 0 0 0 |        pColIdx = { 0, 3, 1, 2 }
+ *     | 0 2 3 0 |        pRowPtr = { 0, 2, 2, 4 }
+ * </pre>
+ * The memory and the cycles of the products are proportional to <code>nnz</code>
+ * instead of <code>numRows*numCols</code>. A sparse matrix is built by the application
+ * from its structure, or converted from a dense matrix by
+ * arm_mat_sparse_from_dense_f32() and arm_mat_sparse_from_dense_q31().
+ *
+ * \par
+ * The product by a vector reads the matrix row by row. The product of the transpose by a
+ * vector, arm_mat_sparse_trans_vec_mult_f32(), scatters each row instead: it covers the
+ * column-major (CSC) use, e.g. <code>H^T * y</code> with the same storage as <code>H * x</code>.
+ * The column indexes are <code>uint16_t</code>, as the dimensions of the dense matrices.
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Floating-point sparse matrix by vector multiplication.
+ * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+ * @param[in]  *pVec   points to the input vector of numCols elements.
+ * @param[out] *pDst   points to the output vector of numRows elements.
+ * @return none.
+ */
+
+void arm_mat_sparse_vec_mult_f32(
+  const arm_matrix_sparse_instance_f32 * pSrcA,
+  const float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t *pA = pSrcA->pData;                 /* stored elements pointer */
+  uint16_t *pIdx = pSrcA->pColIdx;              /* column indexes pointer */
+  uint32_t *pRow = pSrcA->pRowPtr;              /* row offsets pointer */
+  float32_t sum;                                /* accumulator */
+  uint32_t row, cnt;                            /* loop counters */
+
+  for (row = 0u; row < pSrcA->numRows; row++)
+  {
+    sum = 0.0f;
+    cnt = pRow[row + 1u] - pRow[row];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling. Process 4 elements at a time. */
+    while(cnt >= 4u)
+    {
+      sum += pA[0] * pVec[pIdx[0]];
+      sum += pA[1] * pVec[pIdx[1]];
+      sum += pA[2] * pVec[pIdx[2]];
+      sum += pA[3] * pVec[pIdx[3]];
+      pA += 4u;
+      pIdx += 4u;
+
+      cnt -= 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(cnt > 0u)
+    {
+      sum += *pA++ * pVec[*pIdx++];
+
+      cnt--;
+    }
+
+    *pDst++ = sum;
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
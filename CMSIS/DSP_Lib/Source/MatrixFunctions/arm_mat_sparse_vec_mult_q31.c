@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sparse_vec_mult_q31.c
+*
+* Description:	Q31 sparse matrix by vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSparse
+ * @{
+ */
+
+/**
+ * @brief Q31 sparse matrix by vector multiplication.
+ * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+ * @param[in]  *pVec   points to the input vector of numCols elements.
+ * @param[out] *pDst   points to the output vector of numRows elements.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products are accumulated in a 64-bit accumulator in 2.62 format, which is shifted
+ * right by 31 bits and saturated to 1.31 format. Only the stored elements of a row are
+ * added: the inputs are scaled down by log2 of the largest number of elements of a row
+ * to avoid intermediate overflows, instead of log2(numCols) for arm_mat_mult_q31().
+ */
+
+void arm_mat_sparse_vec_mult_q31(
+  const arm_matrix_sparse_instance_q31 * pSrcA,
+  const q31_t * pVec,
+  q31_t * pDst)
+{
+  q31_t *pA = pSrcA->pData;                     /* stored elements pointer */
+  uint16_t *pIdx = pSrcA->pColIdx;              /* column indexes pointer */
+  uint32_t *pRow = pSrcA->pRowPtr;              /* row offsets pointer */
+  q63_t sum;                                    /* accumulator */
+  uint32_t row, cnt;                            /* loop counters */
+
+  for (row = 0u; row < pSrcA->numRows; row++)
+  {
+    sum = 0;
+    cnt = pRow[row + 1u] - pRow[row];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling. Process 4 elements at a time. */
+    while(cnt >= 4u)
+    {
+      sum += (q63_t) pA[0] * pVec[pIdx[0]];
+      sum += (q63_t) pA[1] * pVec[pIdx[1]];
+      sum += (q63_t) pA[2] * pVec[pIdx[2]];
+      sum += (q63_t) pA[3] * pVec[pIdx[3]];
+      pA += 4u;
+      pIdx += 4u;
+
+      cnt -= 4u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(cnt > 0u)
+    {
+      sum += (q63_t) *pA++ * pVec[*pIdx++];
+
+      cnt--;
+    }
+
+    *pDst++ = clip_q63_to_q31(sum >> 31);
+  }
+}
+
+/**
+ * @} end of MatrixSparse group
+ */
@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_sym_update_f32.c
+*
+* Description:	Floating-point symmetric update A * P * A^T + Q.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSymUpdate Symmetric Matrix Update
+ *
+ * Computes the symmetric matrix
+ * <pre>
+ *     P' = A * P * A^T + Q
+ * </pre>
+ * where <code>P</code> is an <code>n x n</code> symmetric matrix, <code>A</code> an
+ * <code>m x n</code> matrix and <code>Q</code> an <code>m x m</code> symmetric matrix: the
+ * covariance prediction of a Kalman filter, and with <code>A = H</code> and
+ * <code>Q = R</code> its innovation covariance <code>S</code>.
+ */
+
+/**
+ * @addtogroup MatrixSymUpdate
+ * @{
+ */
+
+/**
+ * @brief Floating-point symmetric update A * P * A^T + Q.
+ * @param[in]       *pSrcA points to the instance of the <code>m x n</code> matrix structure A.
+ * @param[in]       *pSrcP points to the instance of the <code>n x n</code> symmetric matrix structure P.
+ * @param[in]       *pSrcQ points to the instance of the <code>m x m</code> symmetric matrix structure Q.
+ * @param[out]      *pDst points to the instance of the <code>m x m</code> output matrix structure.
+ * @param[in]       *pScratch points to a buffer of <code>m*n</code> samples.
+ * @return     		The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * \par
+ * <code>T = A * P</code> is computed into <code>pScratch</code>, with the rows of
+ * <code>P</code> read contiguously, then only the upper triangle of
+ * <code>T * A^T + Q</code>, each element being the dot product of two rows; the lower
+ * triangle is copied from it. The result is exactly symmetric, which the two matrix
+ * multiplications of arm_mat_mult_f32() do not guarantee, and costs
+ * <code>m*n*n + m*m*n/2</code> multiply-accumulates instead of
+ * <code>m*n*n + m*m*n</code>. The output may be the matrix <code>Q</code>.
+ */
+
+arm_status arm_mat_sym_update_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcP,
+  const arm_matrix_instance_f32 * pSrcQ,
+  arm_matrix_instance_f32 * pDst,
+  float32_t * pScratch)
+{
+  float32_t *pA = pSrcA->pData;                  /* Matrix A pointer */
+  float32_t *pP = pSrcP->pData;                  /* Matrix P pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pT, *pIn1, *pIn2;                   /* Rows of T, A and P */
+  float32_t coef, sum;                           /* Multiplier of a row and accumulator */
+  uint32_t m = pSrcA->numRows;                   /* Size of the output */
+  uint32_t n = pSrcA->numCols;                   /* Size of P */
+  uint32_t i, j, k, col;                         /* loop counters */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcP->numRows != n) || (pSrcP->numCols != n) || (pSrcQ->numRows != m)
+     || (pSrcQ->numCols != m) || (pDst->numRows != m) || (pDst->numCols != m))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  /* T = A * P, T(i,:) = A(i,0) * P(0,:) + ... + A(i,n-1) * P(n-1,:) */
+  for (i = 0u; i < m; i++)
+  {
+    pT = pScratch + (i * n);
+    memset(pT, 0, n * sizeof(float32_t));
+
+    for (k = 0u; k < n; k++)
+    {
+      coef = pA[(i * n) + k];
+      pIn2 = pP + (k * n);
+      pIn1 = pT;
+      col = n;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling. Process 4 columns at a time. */
+      col = n >> 2u;
+
+      while(col > 0u)
+      {
+        pIn1[0] += coef * pIn2[0];
+        pIn1[1] += coef * pIn2[1];
+        pIn1[2] += coef * pIn2[2];
+        pIn1[3] += coef * pIn2[3];
+        pIn1 += 4u;
+        pIn2 += 4u;
+
+        col--;
+      }
+
+      col = n % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(col > 0u)
+      {
+        *pIn1++ += coef * *pIn2++;
+
+        col--;
+      }
+    }
+  }
+
+  /* Upper triangle of T * A^T + Q, P'(i,j) = T(i,:) . A(j,:) + Q(i,j) */
+  for (i = 0u; i < m; i++)
+  {
+    for (j = i; j < m; j++)
+    {
+      pIn1 = pScratch + (i * n);
+      pIn2 = pA + (j * n);
+      sum = pSrcQ->pData[(i * m) + j];
+      col = n;
+
+#ifndef ARM_MATH_CM0
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop unrolling. Process 4 columns at a time. */
+      col = n >> 2u;
+
+      while(col > 0u)
+      {
+        sum += pIn1[0] * pIn2[0];
+        sum += pIn1[1] * pIn2[1];
+        sum += pIn1[2] * pIn2[2];
+        sum += pIn1[3] * pIn2[3];
+        pIn1 += 4u;
+        pIn2 += 4u;
+
+        col--;
+      }
+
+      col = n % 0x4u;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+      while(col > 0u)
+      {
+        sum += *pIn1++ * *pIn2++;
+
+        col--;
+      }
+
+      pOut[(i * m) + j] = sum;
+    }
+  }
+
+  /* Lower triangle, copied from the upper one */
+  for (i = 1u; i < m; i++)
+  {
+    for (j = 0u; j < i; j++)
+    {
+      pOut[(i * m) + j] = pOut[(j * m) + i];
+    }
+  }
+
+  /* Return to application */
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MatrixSymUpdate group
+ */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mat_vec_mult_f16_f32.c
+*
+* Description:	Half-precision matrix by floating-point vector multiplication.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Half-precision matrix by floating-point vector multiplication.
+ * @param[in]  *pSrcMat points to the instance of the half-precision matrix structure.
+ * @param[in]  *pVec    points to the floating-point vector of numCols values.
+ * @param[out] *pDst    points to the floating-point output vector of numRows values.
+ * @return none.
+ *
+ * \par
+ * The matrix, the weights of a dense layer for instance, stays in half precision in
+ * memory: each element is converted while being loaded, and the products of a row are
+ * accumulated in single precision.
+ */
+
+void arm_mat_vec_mult_f16_f32(
+  const arm_matrix_instance_f16 * pSrcMat,
+  float32_t * pVec,
+  float32_t * pDst)
+{
+  float16_t *pIn = pSrcMat->pData;               /* input data matrix pointer */
+  float32_t *pX;                                 /* input vector pointer */
+  float32_t sum;                                 /* accumulator */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint16_t row, col;                             /* loop counters */
+
+  row = numRows;
+
+  while(row > 0u)
+  {
+    sum = 0.0f;
+    pX = pVec;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling: 4 columns at a time */
+    col = numCols >> 2u;
+
+    while(col > 0u)
+    {
+      sum += arm_f16_to_f32_scalar(*pIn++) * (*pX++);
+      sum += arm_f16_to_f32_scalar(*pIn++) * (*pX++);
+      sum += arm_f16_to_f32_scalar(*pIn++) * (*pX++);
+      sum += arm_f16_to_f32_scalar(*pIn++) * (*pX++);
+
+      /* Decrement the loop counter */
+      col--;
+    }
+
+    col = numCols % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    col = numCols;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(col > 0u)
+    {
+      sum += arm_f16_to_f32_scalar(*pIn++) * (*pX++);
+
+      /* Decrement the loop counter */
+      col--;
+    }
+
+    *pDst++ = sum;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixMult group
+ */
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nn_activation_q15.c
+*
+* Description:	Q15 sigmoid and tanh activation functions by table lookup.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNActivation
+ * @{
+ */
+
+/**
+ * \par
+ * Tables of the sigmoid and of the tanh, sampled over [-8 +8] in steps of 1/16,
+ * 257 values in Q15 format rounded to the nearest and saturated to [0x8000 0x7FFF].
+ * \par
+ * sigmoidTableQ15[i] = 1 / (1 + exp(-x)), tanhTableQ15[i] = tanh(x), with x = -8 + i / 16
+ */
+
+static const q15_t sigmoidTableQ15[257] = {
+  0xb, 0xc, 0xc, 0xd, 0xe, 0xf, 0x10, 0x11,
+  0x12, 0x13, 0x15, 0x16, 0x17, 0x19, 0x1a, 0x1c,
+  0x1e, 0x20, 0x22, 0x24, 0x26, 0x29, 0x2b, 0x2e,
+  0x31, 0x34, 0x38, 0x3b, 0x3f, 0x43, 0x48, 0x4c,
+  0x51, 0x56, 0x5c, 0x62, 0x68, 0x6f, 0x76, 0x7d,
+  0x85, 0x8e, 0x97, 0xa1, 0xab, 0xb6, 0xc2, 0xce,
+  0xdb, 0xe9, 0xf8, 0x108, 0x119, 0x12b, 0x13e, 0x152,
+  0x168, 0x17f, 0x197, 0x1b1, 0x1cd, 0x1ea, 0x209, 0x22a,
+  0x24d, 0x273, 0x29a, 0x2c4, 0x2f1, 0x320, 0x353, 0x388,
+  0x3c1, 0x3fd, 0x43c, 0x480, 0x4c7, 0x513, 0x563, 0x5b8,
+  0x612, 0x671, 0x6d6, 0x740, 0x7b1, 0x828, 0x8a5, 0x92a,
+  0x9b6, 0xa49, 0xae5, 0xb88, 0xc34, 0xcea, 0xda8, 0xe70,
+  0xf42, 0x101e, 0x1105, 0x11f7, 0x12f3, 0x13fb, 0x150f, 0x162e,
+  0x175a, 0x1891, 0x19d5, 0x1b25, 0x1c81, 0x1dea, 0x1f5f, 0x20e0,
+  0x226d, 0x2405, 0x25a9, 0x2758, 0x2911, 0x2ad4, 0x2ca0, 0x2e76,
+  0x3053, 0x3238, 0x3424, 0x3615, 0x380b, 0x3a04, 0x3c01, 0x3e00,
+  0x4000, 0x4200, 0x43ff, 0x45fc, 0x47f5, 0x49eb, 0x4bdc, 0x4dc8,
+  0x4fad, 0x518a, 0x5360, 0x552c, 0x56ef, 0x58a8, 0x5a57, 0x5bfb,
+  0x5d93, 0x5f20, 0x60a1, 0x6216, 0x637f, 0x64db, 0x662b, 0x676f,
+  0x68a6, 0x69d2, 0x6af1, 0x6c05, 0x6d0d, 0x6e09, 0x6efb, 0x6fe2,
+  0x70be, 0x7190, 0x7258, 0x7316, 0x73cc, 0x7478, 0x751b, 0x75b7,
+  0x764a, 0x76d6, 0x775b, 0x77d8, 0x784f, 0x78c0, 0x792a, 0x798f,
+  0x79ee, 0x7a48, 0x7a9d, 0x7aed, 0x7b39, 0x7b80, 0x7bc4, 0x7c03,
+  0x7c3f, 0x7c78, 0x7cad, 0x7ce0, 0x7d0f, 0x7d3c, 0x7d66, 0x7d8d,
+  0x7db3, 0x7dd6, 0x7df7, 0x7e16, 0x7e33, 0x7e4f, 0x7e69, 0x7e81,
+  0x7e98, 0x7eae, 0x7ec2, 0x7ed5, 0x7ee7, 0x7ef8, 0x7f08, 0x7f17,
+  0x7f25, 0x7f32, 0x7f3e, 0x7f4a, 0x7f55, 0x7f5f, 0x7f69, 0x7f72,
+  0x7f7b, 0x7f83, 0x7f8a, 0x7f91, 0x7f98, 0x7f9e, 0x7fa4, 0x7faa,
+  0x7faf, 0x7fb4, 0x7fb8, 0x7fbd, 0x7fc1, 0x7fc5, 0x7fc8, 0x7fcc,
+  0x7fcf, 0x7fd2, 0x7fd5, 0x7fd7, 0x7fda, 0x7fdc, 0x7fde, 0x7fe0,
+  0x7fe2, 0x7fe4, 0x7fe6, 0x7fe7, 0x7fe9, 0x7fea, 0x7feb, 0x7fed,
+  0x7fee, 0x7fef, 0x7ff0, 0x7ff1, 0x7ff2, 0x7ff3, 0x7ff4, 0x7ff4,
+  0x7ff5
+};
+
+static const q15_t tanhTableQ15[257] = {
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000,
+  0x8000, 0x8000, 0x8001, 0x8001, 0x8001, 0x8001, 0x8001, 0x8001,
+  0x8001, 0x8001, 0x8001, 0x8002, 0x8002, 0x8002, 0x8002, 0x8003,
+  0x8003, 0x8003, 0x8004, 0x8004, 0x8005, 0x8006, 0x8006, 0x8007,
+  0x8008, 0x8009, 0x800a, 0x800c, 0x800d, 0x800f, 0x8011, 0x8013,
+  0x8016, 0x8019, 0x801c, 0x8020, 0x8024, 0x8029, 0x802f, 0x8035,
+  0x803c, 0x8044, 0x804d, 0x8057, 0x8062, 0x806f, 0x807e, 0x808f,
+  0x80a2, 0x80b8, 0x80d0, 0x80ec, 0x810b, 0x812e, 0x8156, 0x8183,
+  0x81b7, 0x81f1, 0x8232, 0x827c, 0x82d0, 0x832f, 0x839a, 0x8412,
+  0x849b, 0x8535, 0x85e2, 0x86a5, 0x8781, 0x8878, 0x898e, 0x8ac6,
+  0x8c24, 0x8dac, 0x8f62, 0x914b, 0x936b, 0x95c9, 0x9869, 0x9b50,
+  0x9e84, 0xa20a, 0xa5e6, 0xaa1e, 0xaeb3, 0xb3aa, 0xb903, 0xbebe,
+  0xc4d9, 0xcb52, 0xd221, 0xd941, 0xe0a7, 0xe847, 0xf015, 0xf803,
+  0x0, 0x7fd, 0xfeb, 0x17b9, 0x1f59, 0x26bf, 0x2ddf, 0x34ae,
+  0x3b27, 0x4142, 0x46fd, 0x4c56, 0x514d, 0x55e2, 0x5a1a, 0x5df6,
+  0x617c, 0x64b0, 0x6797, 0x6a37, 0x6c95, 0x6eb5, 0x709e, 0x7254,
+  0x73dc, 0x753a, 0x7672, 0x7788, 0x787f, 0x795b, 0x7a1e, 0x7acb,
+  0x7b65, 0x7bee, 0x7c66, 0x7cd1, 0x7d30, 0x7d84, 0x7dce, 0x7e0f,
+  0x7e49, 0x7e7d, 0x7eaa, 0x7ed2, 0x7ef5, 0x7f14, 0x7f30, 0x7f48,
+  0x7f5e, 0x7f71, 0x7f82, 0x7f91, 0x7f9e, 0x7fa9, 0x7fb3, 0x7fbc,
+  0x7fc4, 0x7fcb, 0x7fd1, 0x7fd7, 0x7fdc, 0x7fe0, 0x7fe4, 0x7fe7,
+  0x7fea, 0x7fed, 0x7fef, 0x7ff1, 0x7ff3, 0x7ff4, 0x7ff6, 0x7ff7,
+  0x7ff8, 0x7ff9, 0x7ffa, 0x7ffa, 0x7ffb, 0x7ffc, 0x7ffc, 0x7ffd,
+  0x7ffd, 0x7ffd, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7fff, 0x7fff,
+  0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
+  0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
+  0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
+  0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
+  0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
+  0x7fff
+};
+
+/**
+ * @brief Q15 sigmoid and tanh activation functions, in place.
+ * @param[in,out]   *pData points to the activations
+ * @param[in]       blockSize number of activations
+ * @param[in]       intBits number of integer bits of the input format, 0 for Q15, 3 for Q3.12
+ * @param[in]       type ARM_NN_SIGMOID or ARM_NN_TANH
+ * @return none.
+ *
+ * \par
+ * The inputs, in Q<code>intBits</code>.<code>15-intBits</code> format, are brought to
+ * Q3.12, the range [-8 +8) of the tables, with saturation when <code>intBits</code> is
+ * greater than 3. The 4 upper fractional bits select a segment of the table and the 8
+ * lower bits interpolate linearly between its ends. The outputs are in Q15 format, in
+ * [0 +1) for the sigmoid and in [-1 +1) for the tanh. The error is less than 0.001.
+ */
+
+void arm_nn_activation_q15(
+  q15_t * pData,
+  uint32_t blockSize,
+  uint16_t intBits,
+  arm_nn_activation_type type)
+{
+  const q15_t *pTable;                           /* Table of the activation */
+  q31_t in;                                      /* Input in Q3.12 format */
+  q31_t y0, y1;                                  /* Ends of the segment */
+  uint32_t index, frac;                          /* Segment and position in the segment */
+  uint32_t blkCnt;                               /* loop counter */
+
+  pTable = (type == ARM_NN_TANH) ? tanhTableQ15 : sigmoidTableQ15;
+
+  blkCnt = blockSize;
+
+  while(blkCnt > 0u)
+  {
+    /* Bring the input to Q3.12 */
+    if(intBits <= 3u)
+    {
+      in = (q31_t) * pData >> (3u - intBits);
+    }
+    else
+    {
+      in = __SSAT((q31_t) * pData << (intBits - 3u), 16);
+    }
+
+    /* Offset the input to [0 65535]: 8 bits of segment, 8 bits of position */
+    index = (uint32_t) (in + 32768) >> 8;
+    frac = (uint32_t) (in + 32768) & 0xFFu;
+
+    y0 = pTable[index];
+    y1 = pTable[index + 1u];
+
+    /* y = y0 + (y1 - y0) * frac */
+    *pData++ = (q15_t) (y0 + (((y1 - y0) * (q31_t) frac) >> 8));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of NNActivation group
+ */
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nn_conv1d_q7_q15.c
+*
+* Description:	1-dimensional convolution layer with Q7 weights and Q15 activations.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNConv 1-D Convolution Layers
+ *
+ * The convolution layers work on sequences of <code>srcLen</code> time steps of
+ * <code>numCh</code> channels, stored channel-last: the sample of channel
+ * <code>c</code> at time <code>t</code> is <code>pSrc[t * numCh + c]</code>. The
+ * convolution is computed on the valid positions only, with
+ * <pre>
+ *     dstLen = (srcLen - kernelLen) / stride + 1
+ * </pre>
+ * outputs, the padding being left to the application.
+ *
+ * arm_nn_conv1d_q7_q15() is a standard convolution: every output channel is a weighted
+ * sum of <code>kernelLen</code> time steps of all the input channels. With the
+ * channel-last layout, the inputs of one output time step are contiguous, so each time
+ * step is a fully connected layer of <code>kernelLen * numInCh</code> inputs computed
+ * by arm_nn_fc_q7_q15(), without copying the inputs into a column buffer.
+ *
+ * arm_nn_depthwise_conv1d_q7_q15() is a depthwise convolution: every channel is
+ * filtered by its own kernel and the number of channels is kept.
+ *
+ * The scaling, the rounding and the saturation are those of the fully connected layer.
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief 1-dimensional convolution layer with Q7 weights and Q15 activations.
+ * @param[in]       *pSrc points to the <code>srcLen</code> x <code>numInCh</code> channel-last inputs
+ * @param[in]       srcLen number of input time steps
+ * @param[in]       numInCh number of input channels
+ * @param[in]       *pWeights points to <code>numOutCh</code> rows of <code>kernelLen * numInCh</code> weights, reordered by arm_nn_fc_reorder_q7()
+ * @param[in]       *pBias points to the <code>numOutCh</code> biases
+ * @param[in]       kernelLen number of time steps of the kernel
+ * @param[in]       numOutCh number of output channels
+ * @param[in]       stride distance in time steps between two outputs
+ * @param[in]       biasShift left shift of the biases to the format of the accumulator
+ * @param[in]       outShift right shift of the accumulator to the format of the outputs
+ * @param[out]      *pDst points to the <code>dstLen</code> x <code>numOutCh</code> channel-last outputs
+ * @return none.
+ *
+ * The weights of an output channel are ordered as its inputs,
+ * <code>w[k * numInCh + c]</code> for the kernel tap <code>k</code> and the input channel
+ * <code>c</code>, before the reordering. <code>kernelLen * numInCh</code> must be less
+ * than 65536.
+ */
+
+void arm_nn_conv1d_q7_q15(
+  q15_t * pSrc,
+  uint16_t srcLen,
+  uint16_t numInCh,
+  q7_t * pWeights,
+  q15_t * pBias,
+  uint16_t kernelLen,
+  uint16_t numOutCh,
+  uint16_t stride,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst)
+{
+  uint32_t numCols = (uint32_t) kernelLen * numInCh;     /* Inputs of one output time step */
+  uint32_t dstCnt;                               /* loop counter */
+
+  if(srcLen < kernelLen)
+  {
+    return;
+  }
+
+  dstCnt = (((uint32_t) srcLen - kernelLen) / stride) + 1u;
+
+  while(dstCnt > 0u)
+  {
+    /* The kernelLen time steps of the window are contiguous */
+    arm_nn_fc_q7_q15(pSrc, pWeights, pBias, (uint16_t) numCols, numOutCh, biasShift,
+                     outShift, pDst);
+
+    pSrc += (uint32_t) stride * numInCh;
+    pDst += numOutCh;
+
+    /* Decrement the loop counter */
+    dstCnt--;
+  }
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nn_depthwise_conv1d_q7_q15.c
+*
+* Description:	1-dimensional depthwise convolution layer with Q7 weights and
+*               Q15 activations.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+/**
+ * @brief 1-dimensional depthwise convolution layer with Q7 weights and Q15 activations.
+ * @param[in]       *pSrc points to the <code>srcLen</code> x <code>numCh</code> channel-last inputs
+ * @param[in]       srcLen number of input time steps
+ * @param[in]       numCh number of channels
+ * @param[in]       *pWeights points to the <code>kernelLen</code> x <code>numCh</code> channel-last weights
+ * @param[in]       *pBias points to the <code>numCh</code> biases
+ * @param[in]       kernelLen number of time steps of the kernel
+ * @param[in]       stride distance in time steps between two outputs
+ * @param[in]       biasShift left shift of the biases to the format of the accumulator
+ * @param[in]       outShift right shift of the accumulator to the format of the outputs
+ * @param[out]      *pDst points to the <code>dstLen</code> x <code>numCh</code> channel-last outputs
+ * @return none.
+ *
+ * <pre>
+ *     pDst[t][c] = sat((pBias[c] << biasShift) + sum(pWeights[k][c] * pSrc[t * stride + k][c]) >> outShift)
+ * </pre>
+ * The weights are in their natural order, not reordered.
+ */
+
+void arm_nn_depthwise_conv1d_q7_q15(
+  q15_t * pSrc,
+  uint16_t srcLen,
+  uint16_t numCh,
+  q7_t * pWeights,
+  q15_t * pBias,
+  uint16_t kernelLen,
+  uint16_t stride,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst)
+{
+  q15_t *pX;                                     /* Input pointer of a channel */
+  q7_t *pW;                                      /* Weight pointer of a channel */
+  q31_t acc0;                                    /* Accumulator */
+  q31_t rnd;                                     /* Rounding constant of the output shift */
+  uint32_t dstCnt, ch, tapCnt;                   /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t acc1;                                    /* Accumulator of the second channel */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  if(srcLen < kernelLen)
+  {
+    return;
+  }
+
+  rnd = (outShift > 0u) ? ((q31_t) 1 << (outShift - 1u)) : 0;
+
+  dstCnt = (((uint32_t) srcLen - kernelLen) / stride) + 1u;
+
+  while(dstCnt > 0u)
+  {
+    ch = 0u;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Two adjacent channels at a time, sharing the pointer updates */
+    while((ch + 1u) < numCh)
+    {
+      pX = pSrc + ch;
+      pW = pWeights + ch;
+
+      acc0 = ((q31_t) pBias[ch] << biasShift) + rnd;
+      acc1 = ((q31_t) pBias[ch + 1u] << biasShift) + rnd;
+
+      tapCnt = kernelLen;
+
+      while(tapCnt > 0u)
+      {
+        acc0 += (q31_t) pW[0] * pX[0];
+        acc1 += (q31_t) pW[1] * pX[1];
+
+        pX += numCh;
+        pW += numCh;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      pDst[ch] = (q15_t) __SSAT(acc0 >> outShift, 16);
+      pDst[ch + 1u] = (q15_t) __SSAT(acc1 >> outShift, 16);
+
+      ch += 2u;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* The last channel of an odd number of channels, or all the channels on Cortex-M0 */
+    while(ch < numCh)
+    {
+      pX = pSrc + ch;
+      pW = pWeights + ch;
+
+      acc0 = ((q31_t) pBias[ch] << biasShift) + rnd;
+
+      tapCnt = kernelLen;
+
+      while(tapCnt > 0u)
+      {
+        acc0 += (q31_t) * pW * *pX;
+
+        pX += numCh;
+        pW += numCh;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      pDst[ch] = (q15_t) __SSAT(acc0 >> outShift, 16);
+
+      ch++;
+    }
+
+    pSrc += (uint32_t) stride * numCh;
+    pDst += numCh;
+
+    /* Decrement the loop counter */
+    dstCnt--;
+  }
+}
+
+/**
+ * @} end of NNConv group
+ */
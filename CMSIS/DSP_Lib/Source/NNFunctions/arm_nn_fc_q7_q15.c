@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nn_fc_q7_q15.c
+*
+* Description:	Fully connected layer with Q7 weights and Q15 activations.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNFullyConnected Fully Connected Layer
+ *
+ * A fully connected layer multiplies the vector of its <code>numCols</code> inputs by
+ * a matrix of <code>numRows</code> x <code>numCols</code> weights and adds a bias:
+ * <pre>
+ *     pDst[r] = sat((pBias[r] << biasShift) + sum(pWeights[r][c] * pSrc[c]) >> outShift)
+ * </pre>
+ * arm_mat_mult_fast_q15() computes the same products with the overhead of the matrix
+ * instances and with 16-bit weights. Here the weights are Q7, half the memory, and the
+ * products of a Q7 weight, 1.7, and of a Q15 input, 1.15, are accumulated in 32 bits in
+ * 10.22 format.
+ *
+ * \par Reordered weights:
+ * On Cortex-M4, <code>__SXTB16</code> sign-extends the bytes 0 and 2 of a word into two
+ * halfwords, which <code>__SMLAD</code> multiplies by two Q15 inputs in one instruction.
+ * To feed it, each group of 4 weights <code>w0 w1 w2 w3</code> of a row is stored as
+ * <code>w0 w2 w1 w3</code>: one word of weights then gives the pairs
+ * <code>(w0, w1)</code> and, shifted by 8 bits, <code>(w2, w3)</code>, matching the
+ * input pairs <code>(x0, x1)</code> and <code>(x2, x3)</code>. arm_nn_fc_reorder_q7()
+ * converts a row-major weight matrix to this layout once, at initialization or offline;
+ * the last <code>numCols % 4</code> weights of each row are not moved. All the functions
+ * of the group that take reordered weights read the same layout on all the processors
+ * and with both endiannesses.
+ *
+ * \par Scaling and Overflow Behavior:
+ * The 32-bit accumulator has 9 guard bits over a single product, so there is no risk of
+ * overflow for up to 512 inputs at full scale. The sum is shifted right by
+ * <code>outShift</code> bits with rounding and saturated to Q15.
+ */
+
+/**
+ * @addtogroup NNFullyConnected
+ * @{
+ */
+
+/**
+ * @brief Fully connected layer with Q7 weights and Q15 activations.
+ * @param[in]       *pSrc points to the input vector of <code>numCols</code> samples
+ * @param[in]       *pWeights points to the reordered weights, <code>numRows</code> rows of <code>numCols</code> samples
+ * @param[in]       *pBias points to the <code>numRows</code> biases
+ * @param[in]       numCols number of inputs
+ * @param[in]       numRows number of outputs
+ * @param[in]       biasShift left shift of the biases to the format of the accumulator
+ * @param[in]       outShift right shift of the accumulator to the format of the outputs
+ * @param[out]      *pDst points to the output vector of <code>numRows</code> samples
+ * @return none.
+ */
+
+void arm_nn_fc_q7_q15(
+  q15_t * pSrc,
+  q7_t * pWeights,
+  q15_t * pBias,
+  uint16_t numCols,
+  uint16_t numRows,
+  uint16_t biasShift,
+  uint16_t outShift,
+  q15_t * pDst)
+{
+  q7_t *pW0 = pWeights;                          /* Weights of the current row */
+  q15_t *pX;                                     /* Input pointer */
+  q31_t acc0;                                    /* Accumulator */
+  q31_t rnd;                                     /* Rounding constant of the output shift */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q7_t *pW1;                                     /* Weights of the second row */
+  q31_t acc1;                                    /* Accumulator of the second row */
+  q31_t x01, x23;                                /* Pairs of inputs */
+  q31_t w0, w1;                                  /* Groups of 4 reordered weights */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  rnd = (outShift > 0u) ? ((q31_t) 1 << (outShift - 1u)) : 0;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* Two rows at a time, sharing the loads of the inputs */
+  rowCnt = (uint32_t) numRows >> 1u;
+
+  while(rowCnt > 0u)
+  {
+    pW1 = pW0 + numCols;
+    pX = pSrc;
+
+    acc0 = ((q31_t) * pBias++ << biasShift) + rnd;
+    acc1 = ((q31_t) * pBias++ << biasShift) + rnd;
+
+    /* 4 inputs at a time, one word of weights per row */
+    colCnt = (uint32_t) numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      x01 = *__SIMD32(pX)++;
+      x23 = *__SIMD32(pX)++;
+      w0 = *__SIMD32(pW0)++;
+      w1 = *__SIMD32(pW1)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      /* acc += w0 * x0 + w1 * x1, then acc += w2 * x2 + w3 * x3 */
+      acc0 = __SMLAD(__SXTB16(w0), x01, acc0);
+      acc1 = __SMLAD(__SXTB16(w1), x01, acc1);
+      acc0 = __SMLAD(__SXTB16(w0 >> 8), x23, acc0);
+      acc1 = __SMLAD(__SXTB16(w1 >> 8), x23, acc1);
+
+#else
+
+      /* The bytes 0 and 2 of a big-endian word are w3 and w2 */
+      acc0 = __SMLAD(__SXTB16(w0), x23, acc0);
+      acc1 = __SMLAD(__SXTB16(w1), x23, acc1);
+      acc0 = __SMLAD(__SXTB16(w0 >> 8), x01, acc0);
+      acc1 = __SMLAD(__SXTB16(w1 >> 8), x01, acc1);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* The last 1 to 3 weights of the rows are in their original order */
+    colCnt = (uint32_t) numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      acc0 += (q31_t) * pW0++ * *pX;
+      acc1 += (q31_t) * pW1++ * *pX++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = (q15_t) __SSAT(acc0 >> outShift, 16);
+    *pDst++ = (q15_t) __SSAT(acc1 >> outShift, 16);
+
+    /* The next pair of rows starts after the second one */
+    pW0 = pW1;
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+
+  /* The last row of an odd number of rows */
+  rowCnt = (uint32_t) numRows & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  rowCnt = numRows;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(rowCnt > 0u)
+  {
+    pX = pSrc;
+
+    acc0 = ((q31_t) * pBias++ << biasShift) + rnd;
+
+    /* The groups of 4 weights are stored as w0 w2 w1 w3 */
+    colCnt = (uint32_t) numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      acc0 += (q31_t) pW0[0] * pX[0];
+      acc0 += (q31_t) pW0[2] * pX[1];
+      acc0 += (q31_t) pW0[1] * pX[2];
+      acc0 += (q31_t) pW0[3] * pX[3];
+
+      pW0 += 4u;
+      pX += 4u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    colCnt = (uint32_t) numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      acc0 += (q31_t) * pW0++ * *pX++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    *pDst++ = (q15_t) __SSAT(acc0 >> outShift, 16);
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+}
+
+/**
+ * @} end of NNFullyConnected group
+ */
@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nn_fc_reorder_q7.c
+*
+* Description:	Reorders Q7 weights for the fully connected and convolution layers.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNFullyConnected
+ * @{
+ */
+
+/**
+ * @brief Reorders row-major Q7 weights for arm_nn_fc_q7_q15() and arm_nn_conv1d_q7_q15().
+ * @param[in]       *pSrc points to the <code>numRows</code> x <code>numCols</code> row-major weights
+ * @param[out]      *pDst points to the reordered weights, which may be <code>pSrc</code>
+ * @param[in]       numRows number of rows
+ * @param[in]       numCols number of columns
+ * @return none.
+ *
+ * Each group of 4 weights <code>w0 w1 w2 w3</code> of a row is stored as
+ * <code>w0 w2 w1 w3</code>; the last <code>numCols % 4</code> weights of each row are
+ * copied unchanged.
+ */
+
+void arm_nn_fc_reorder_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint16_t numRows,
+  uint16_t numCols)
+{
+  q7_t w1;                                       /* Weight moved to the third place */
+  uint32_t rowCnt, colCnt;                       /* loop counters */
+
+  rowCnt = numRows;
+
+  while(rowCnt > 0u)
+  {
+    /* w0 w1 w2 w3 becomes w0 w2 w1 w3 */
+    colCnt = (uint32_t) numCols >> 2u;
+
+    while(colCnt > 0u)
+    {
+      w1 = pSrc[1];
+      pDst[0] = pSrc[0];
+      pDst[1] = pSrc[2];
+      pDst[2] = w1;
+      pDst[3] = pSrc[3];
+
+      pSrc += 4u;
+      pDst += 4u;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    colCnt = (uint32_t) numCols % 0x4u;
+
+    while(colCnt > 0u)
+    {
+      *pDst++ = *pSrc++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+}
+
+/**
+ * @} end of NNFullyConnected group
+ */
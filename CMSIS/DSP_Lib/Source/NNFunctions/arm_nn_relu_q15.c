@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nn_relu_q15.c
+*
+* Description:	Q15 ReLU activation function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @defgroup NNActivation Activation Functions
+ *
+ * The activation functions are applied in place to the outputs of a layer.
+ *
+ * arm_nn_relu_q15() and arm_nn_relu_q7() set the negative activations to zero. On
+ * Cortex-M4 and Cortex-M3 they process a 32-bit word, 2 Q15 or 4 Q7 activations, at a
+ * time: the sign bits of the word are spread into a mask that clears the negative
+ * samples, without a comparison per sample.
+ *
+ * arm_nn_activation_q15() computes the sigmoid or the tanh by linear interpolation in
+ * tables of 257 values over [-8 +8), whatever the number of integer bits of the input.
+ */
+
+/**
+ * @addtogroup NNActivation
+ * @{
+ */
+
+/**
+ * @brief Q15 ReLU activation function, in place.
+ * @param[in,out]   *pData points to the activations
+ * @param[in]       blockSize number of activations
+ * @return none.
+ *
+ * <pre>
+ *     pData[n] = max(pData[n], 0);   0 <= n < blockSize.
+ * </pre>
+ */
+
+void arm_nn_relu_q15(
+  q15_t * pData,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2;                                /* Two pairs of activations */
+  q31_t mask1, mask2;                            /* Masks of the negative activations */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in1 = __SIMD32(pData)[0];
+    in2 = __SIMD32(pData)[1];
+
+    /* 0xFFFF in each halfword whose sign bit is set */
+    mask1 = (q31_t) ((((uint32_t) in1 & 0x80008000u) >> 15) * 0xFFFFu);
+    mask2 = (q31_t) ((((uint32_t) in2 & 0x80008000u) >> 15) * 0xFFFFu);
+
+    *__SIMD32(pData)++ = in1 & ~mask1;
+    *__SIMD32(pData)++ = in2 & ~mask2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    if(*pData < 0)
+    {
+      *pData = 0;
+    }
+
+    pData++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of NNActivation group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_nn_relu_q7.c
+*
+* Description:	Q7 ReLU activation function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNActivation
+ * @{
+ */
+
+/**
+ * @brief Q7 ReLU activation function, in place.
+ * @param[in,out]   *pData points to the activations
+ * @param[in]       blockSize number of activations
+ * @return none.
+ *
+ * <pre>
+ *     pData[n] = max(pData[n], 0);   0 <= n < blockSize.
+ * </pre>
+ */
+
+void arm_nn_relu_q7(
+  q7_t * pData,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2;                                /* Two groups of 4 activations */
+  q31_t mask1, mask2;                            /* Masks of the negative activations */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 3u;
+
+  /* First part of the processing with loop unrolling.  Compute 8 outputs at a time.
+   ** a second loop below computes the remaining 1 to 7 samples. */
+  while(blkCnt > 0u)
+  {
+    in1 = __SIMD32(pData)[0];
+    in2 = __SIMD32(pData)[1];
+
+    /* 0xFF in each byte whose sign bit is set */
+    mask1 = (q31_t) ((((uint32_t) in1 & 0x80808080u) >> 7) * 0xFFu);
+    mask2 = (q31_t) ((((uint32_t) in2 & 0x80808080u) >> 7) * 0xFFu);
+
+    *__SIMD32(pData)++ = in1 & ~mask1;
+    *__SIMD32(pData)++ = in2 & ~mask2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 8, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x8u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    if(*pData < 0)
+    {
+      *pData = 0;
+    }
+
+    pData++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of NNActivation group
+ */
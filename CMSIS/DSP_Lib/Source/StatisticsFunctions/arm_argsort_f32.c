@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_argsort_f32.c
+*
+* Description:	Indexes which sort a floating-point vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief  Indexes which sort a floating-point vector in increasing order.
+ * @param[in]  *pSrc      points to the input vector, unchanged.
+ * @param[out] *pIndex    points to the <code>blockSize</code> indexes of the sorted values.
+ * @param[in]  *pScratch  points to a scratch buffer of <code>4*blockSize</code> words.
+ * @param[in]  blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par
+ * The values are mapped to integers of the same order as in arm_sort_radix_f32(), and sorted by arm_argsort_q31().
+ */
+
+void arm_argsort_f32(
+  const float32_t * pSrc,
+  uint32_t * pIndex,
+  uint32_t * pScratch,
+  uint32_t blockSize)
+{
+  const q31_t *pKey = (const q31_t *) pSrc;      /* Bit patterns of the values */
+  q31_t *pKeyDst = (q31_t *) (pScratch + (3u * blockSize));  /* Keys */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pKeyDst[i] = ((pKey[i] < 0) ? (pKey[i] ^ 0x7FFFFFFF) : pKey[i]);
+  }
+
+  arm_argsort_q31(pKeyDst, pIndex, pScratch, blockSize);
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_argsort_q15.c
+*
+* Description:	Indexes which sort a Q15 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief  Indexes which sort a Q15 vector in increasing order.
+ * @param[in]  *pSrc      points to the input vector, unchanged.
+ * @param[out] *pIndex    points to the <code>blockSize</code> indexes of the sorted values.
+ * @param[in]  *pScratch  points to a scratch buffer of <code>4*blockSize</code> words.
+ * @param[in]  blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par
+ * The values are shifted to the upper half of Q31 keys, so that the radix passes of the lower half are skipped, and sorted by arm_argsort_q31().
+ */
+
+void arm_argsort_q15(
+  const q15_t * pSrc,
+  uint32_t * pIndex,
+  uint32_t * pScratch,
+  uint32_t blockSize)
+{
+  q31_t *pKeyDst = (q31_t *) (pScratch + (3u * blockSize));  /* Keys */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < blockSize; i++)
+  {
+    pKeyDst[i] = ((q31_t) pSrc[i] << 16);
+  }
+
+  arm_argsort_q31(pKeyDst, pIndex, pScratch, blockSize);
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_argsort_q31.c
+*
+* Description:	Indexes which sort a Q31 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief  Indexes which sort a Q31 vector in increasing order.
+ * @param[in]  *pSrc      points to the input vector, unchanged.
+ * @param[out] *pIndex    points to the <code>blockSize</code> indexes of the sorted values.
+ * @param[in]  *pScratch  points to a scratch buffer of <code>3*blockSize</code> words.
+ * @param[in]  blockSize  length of the input vector.
+ * @return none.
+ *
+ * \par
+ * <code>pSrc[pIndex[0]]</code> is the smallest value. Equal values keep the order of
+ * their indexes. The digit counts take 1 KB of stack.
+ */
+
+void arm_argsort_q31(
+  const q31_t * pSrc,
+  uint32_t * pIndex,
+  uint32_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* Digit counts, then offsets */
+  uint32_t *pKeyIn = pScratch;                   /* Keys and indexes to distribute */
+  uint32_t *pIdxIn = pIndex;
+  uint32_t *pKeyOut = pScratch + blockSize;      /* Keys and indexes distributed */
+  uint32_t *pIdxOut = pScratch + (2u * blockSize);
+  uint32_t *pTmp;
+  uint32_t shift, digit, sum, tmp;               /* Digit position */
+  uint32_t i;                                    /* loop counter */
+
+  /* Keys with the sign bit flipped, in the order of unsigned integers */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pKeyIn[i] = (uint32_t) pSrc[i] ^ 0x80000000u;
+    pIdxIn[i] = i;
+  }
+
+  if(blockSize < 2u)
+  {
+    return;
+  }
+
+  for (shift = 0u; shift < 32u; shift += 8u)
+  {
+    /* Digit counts */
+    memset(count, 0, sizeof(count));
+    for (i = 0u; i < blockSize; i++)
+    {
+      count[(pKeyIn[i] >> shift) & 0xFFu]++;
+    }
+
+    /* A digit shared by all the values leaves the order unchanged */
+    if(count[(pKeyIn[0] >> shift) & 0xFFu] == blockSize)
+    {
+      continue;
+    }
+
+    /* Offsets of the digits */
+    sum = 0u;
+    for (digit = 0u; digit < 256u; digit++)
+    {
+      tmp = count[digit];
+      count[digit] = sum;
+      sum += tmp;
+    }
+
+    /* Stable distribution of the keys with their indexes */
+    for (i = 0u; i < blockSize; i++)
+    {
+      digit = (pKeyIn[i] >> shift) & 0xFFu;
+      pKeyOut[count[digit]] = pKeyIn[i];
+      pIdxOut[count[digit]++] = pIdxIn[i];
+    }
+
+    pTmp = pKeyIn;
+    pKeyIn = pKeyOut;
+    pKeyOut = pTmp;
+
+    pTmp = pIdxIn;
+    pIdxIn = pIdxOut;
+    pIdxOut = pTmp;
+  }
+
+  /* After an odd number of passes the indexes are in the scratch */
+  if(pIdxIn != pIndex)
+  {
+    memcpy(pIndex, pIdxIn, blockSize * sizeof(uint32_t));
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_exp_moving_stats_init_f32.c
+*
+* Description:	Floating-point exponential moving statistics initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup ExpMovingStats Exponential Moving Statistics
+ *
+ * The exponential moving statistics weight the past samples by a factor decreasing
+ * geometrically with their age, so that they follow a signal whose level changes, with
+ * a state of three values whatever the time constant:
+ * <pre>
+ *    diff = x[n] - mean
+ *    mean = mean + alpha * diff
+ *    var  = (1 - alpha) * (var + alpha * diff<sup>2</sup>)
+ * </pre>
+ * The time constant is about <code>1/alpha</code> samples. The first sample initializes
+ * the mean, so that the statistics are not biased towards zero at start-up. The state is
+ * carried from block to block, so that the blocks of a record may have any length.
+ */
+
+/**
+ * @addtogroup ExpMovingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point exponential moving statistics.
+ * @param[out] *S     points to an instance of the floating-point exponential moving statistics structure.
+ * @param[in]  alpha  weight of the new sample, between 0 and 1.
+ * @return none.
+ */
+
+void arm_exp_moving_stats_init_f32(
+  arm_exp_moving_stats_instance_f32 * S,
+  float32_t alpha)
+{
+  /* Assign the weight of the new sample */
+  S->alpha = alpha;
+
+  /* Start from an empty record */
+  S->count = 0u;
+  S->mean = 0.0f;
+  S->var = 0.0f;
+}
+
+/**
+ * @} end of ExpMovingStats group
+ */
@@ -0,0 +1,45 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_exp_moving_stats_query_f32.c
+*
+* Description:	Floating-point exponential moving statistics query.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ExpMovingStats
+ * @{
+ */
+
+/**
+ * @brief  Mean and variance of the floating-point exponential moving statistics.
+ * @param[in]  *S     points to an instance of the floating-point exponential moving statistics structure.
+ * @param[out] *pMean mean value returned here.
+ * @param[out] *pVar  variance value returned here.
+ * @return none.
+ */
+
+void arm_exp_moving_stats_query_f32(
+  const arm_exp_moving_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar)
+{
+  *pMean = S->mean;
+  *pVar = S->var;
+}
+
+/**
+ * @} end of ExpMovingStats group
+ */
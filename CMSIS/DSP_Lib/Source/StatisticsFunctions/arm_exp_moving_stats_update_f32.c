@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_exp_moving_stats_update_f32.c
+*
+* Description:	Floating-point exponential moving statistics update.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ExpMovingStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of samples to the floating-point exponential moving statistics.
+ * @param[in,out] *S         points to an instance of the floating-point exponential moving statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_exp_moving_stats_update_f32(
+  arm_exp_moving_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t alpha = S->alpha;                    /* Weight of the new sample */
+  float32_t beta = 1.0f - alpha;                 /* Weight of the past samples */
+  float32_t mean = S->mean;                      /* Moving mean */
+  float32_t var = S->var;                        /* Moving variance */
+  float32_t diff, incr;                          /* Deviation of the sample and update of the mean */
+  uint32_t blkCnt = blockSize;                   /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the record initializes the mean */
+  if(S->count == 0u)
+  {
+    mean = *pSrc++;
+    var = 0.0f;
+    blkCnt--;
+  }
+
+  while(blkCnt > 0u)
+  {
+    diff = *pSrc++ - mean;
+    incr = alpha * diff;
+    mean += incr;
+    var = beta * (var + (diff * incr));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->mean = mean;
+  S->var = var;
+
+  /* Saturate the number of samples */
+  S->count = ((S->count + blockSize) < S->count) ? 0xFFFFFFFFu : (S->count + blockSize);
+}
+
+/**
+ * @} end of ExpMovingStats group
+ */
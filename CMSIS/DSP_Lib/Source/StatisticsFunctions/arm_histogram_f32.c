@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_f32.c
+*
+* Description:	Histogram of a floating-point vector with arbitrary bin edges.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Histogram Histogram
+ *
+ * Counts the samples of a vector falling in each of <code>numBins</code> bins. The bins
+ * are given either by <code>numBins+1</code> edges in increasing order, bin
+ * <code>i</code> holding the samples with <code>pEdges[i] <= x < pEdges[i+1]</code>, or
+ * as a uniform division of the interval from <code>minVal</code> to <code>maxVal</code>.
+ * Samples below the first edge are counted in the first bin and samples at or above the
+ * last edge in the last bin, so that the tails of the distribution are kept.
+ *
+ * \par
+ * The counts are added to <code>pCounts</code>, which the caller clears before the first
+ * block: the histogram of a long record is accumulated block by block. The uniform
+ * functions compute the bin of each sample with a multiplication, in time linear in the
+ * number of samples; with arbitrary edges the bin is found by a binary search over the
+ * edges.
+ *
+ * \par
+ * arm_histogram_percentile_f32() and arm_histogram_percentile_q15() estimate a percentile
+ * of the samples from the histogram, interpolating linearly inside the bin where the
+ * cumulated count reaches the requested fraction of the total. Their accuracy is that of
+ * the bin width, with a cost linear in the number of bins, independent of the number of
+ * samples.
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a floating-point vector with arbitrary bin edges.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       *pEdges points to the <code>numBins+1</code> bin edges, in increasing order
+ * @param[in]       numBins number of bins
+ * @param[in,out]   *pCounts points to the <code>numBins</code> counts, incremented by the samples of each bin
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is zero.
+ */
+
+arm_status arm_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  const float32_t * pEdges,
+  uint16_t numBins,
+  uint32_t * pCounts)
+{
+  float32_t in;                                  /* Input value */
+  uint32_t lo, hi, mid;                          /* Bounds of the binary search */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(numBins == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    /* Largest bin whose lower edge is not above the sample, the first bin for
+     * the samples below pEdges[1] and the last one for those above pEdges[numBins-1] */
+    lo = 0u;
+    hi = numBins;
+
+    while((hi - lo) > 1u)
+    {
+      mid = (lo + hi) >> 1u;
+
+      if(in >= pEdges[mid])
+      {
+        lo = mid;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    pCounts[lo]++;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_percentile_f32.c
+*
+* Description:	Percentile estimated from a floating-point histogram.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Percentile estimated from a histogram with floating-point bin edges.
+ * @param[in]       *pCounts points to the <code>numBins</code> counts
+ * @param[in]       *pEdges points to the <code>numBins+1</code> bin edges, in increasing order
+ * @param[in]       numBins number of bins
+ * @param[in]       fraction fraction of the samples below the percentile, between 0 and 1: 0.5 for the median, 0.99 for P99
+ * @param[out]      *pResult percentile value returned here
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is zero, <code>fraction</code> is out of range or the histogram is empty.
+ *
+ * \par
+ * For a histogram with uniform bins, the edges are
+ * <code>minVal + i * (maxVal - minVal) / numBins</code>.
+ */
+
+arm_status arm_histogram_percentile_f32(
+  const uint32_t * pCounts,
+  const float32_t * pEdges,
+  uint16_t numBins,
+  float32_t fraction,
+  float32_t * pResult)
+{
+  float32_t target;                              /* Number of samples below the percentile */
+  uint32_t total = 0u, cum = 0u;                 /* Total and cumulated counts */
+  uint32_t i;                                    /* loop counter */
+
+  if((numBins == 0u) || (fraction < 0.0f) || (fraction > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    total += pCounts[i];
+  }
+
+  if(total == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  target = fraction * (float32_t) total;
+
+  /* Bin where the cumulated count reaches the target */
+  for (i = 0u; i < (numBins - 1u); i++)
+  {
+    if((float32_t) (cum + pCounts[i]) >= target)
+    {
+      break;
+    }
+
+    cum += pCounts[i];
+  }
+
+  /* Linear interpolation inside the bin */
+  if(pCounts[i] == 0u)
+  {
+    *pResult = pEdges[i];
+  }
+  else
+  {
+    *pResult = pEdges[i] + (((target - (float32_t) cum) / (float32_t) pCounts[i]) *
+                            (pEdges[i + 1u] - pEdges[i]));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
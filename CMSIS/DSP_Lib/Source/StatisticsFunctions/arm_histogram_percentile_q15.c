@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_percentile_q15.c
+*
+* Description:	Percentile estimated from a Q15 histogram.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Percentile estimated from a histogram with Q15 bin edges.
+ * @param[in]       *pCounts points to the <code>numBins</code> counts
+ * @param[in]       *pEdges points to the <code>numBins+1</code> bin edges, in increasing order
+ * @param[in]       numBins number of bins
+ * @param[in]       fraction fraction of the samples below the percentile in 1.15 format, between 0 and 0x7FFF
+ * @param[out]      *pResult percentile value returned here
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is zero, <code>fraction</code> is negative or the histogram is empty.
+ *
+ * \par
+ * The target count <code>fraction * total</code> is kept in 64 bits with its 15
+ * fractional bits, and the interpolation inside the bin is computed in 64 bits, so that
+ * the result is exact to the truncation.
+ */
+
+arm_status arm_histogram_percentile_q15(
+  const uint32_t * pCounts,
+  const q15_t * pEdges,
+  uint16_t numBins,
+  q15_t fraction,
+  q15_t * pResult)
+{
+  q63_t target;                                  /* Number of samples below the percentile, 15 fractional bits */
+  q63_t total = 0, cum = 0;                      /* Total and cumulated counts, 15 fractional bits */
+  q63_t width;                                   /* Width of the bin */
+  uint32_t i;                                    /* loop counter */
+
+  if((numBins == 0u) || (fraction < 0))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    total += pCounts[i];
+  }
+
+  if(total == 0)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  target = total * fraction;
+
+  /* Bin where the cumulated count reaches the target */
+  for (i = 0u; i < (numBins - 1u); i++)
+  {
+    if(((cum + pCounts[i]) << 15) >= target)
+    {
+      break;
+    }
+
+    cum += pCounts[i];
+  }
+
+  /* Linear interpolation inside the bin */
+  if(pCounts[i] == 0u)
+  {
+    *pResult = pEdges[i];
+  }
+  else
+  {
+    width = (q63_t) pEdges[i + 1u] - pEdges[i];
+    *pResult = (q15_t) (pEdges[i] + (((target - (cum << 15)) * width) /
+                                     ((q63_t) pCounts[i] << 15)));
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_q15.c
+*
+* Description:	Histogram of a Q15 vector with arbitrary bin edges.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a Q15 vector with arbitrary bin edges.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       *pEdges points to the <code>numBins+1</code> bin edges, in increasing order
+ * @param[in]       numBins number of bins
+ * @param[in,out]   *pCounts points to the <code>numBins</code> counts, incremented by the samples of each bin
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is zero.
+ */
+
+arm_status arm_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  const q15_t * pEdges,
+  uint16_t numBins,
+  uint32_t * pCounts)
+{
+  q15_t in;                                      /* Input value */
+  uint32_t lo, hi, mid;                          /* Bounds of the binary search */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(numBins == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    /* Largest bin whose lower edge is not above the sample, the first bin for
+     * the samples below pEdges[1] and the last one for those above pEdges[numBins-1] */
+    lo = 0u;
+    hi = numBins;
+
+    while((hi - lo) > 1u)
+    {
+      mid = (lo + hi) >> 1u;
+
+      if(in >= pEdges[mid])
+      {
+        lo = mid;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    pCounts[lo]++;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
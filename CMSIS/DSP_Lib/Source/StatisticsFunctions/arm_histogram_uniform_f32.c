@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_uniform_f32.c
+*
+* Description:	Histogram of a floating-point vector with uniform bins.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a floating-point vector with uniform bins.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       maxVal upper edge of the last bin
+ * @param[in]       numBins number of bins
+ * @param[in,out]   *pCounts points to the <code>numBins</code> counts, incremented by the samples of each bin
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is zero or <code>maxVal</code> is not above <code>minVal</code>.
+ */
+
+arm_status arm_histogram_uniform_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minVal,
+  float32_t maxVal,
+  uint16_t numBins,
+  uint32_t * pCounts)
+{
+  float32_t scale;                               /* Number of bins per unit */
+  float32_t bin;                                 /* Position of the sample in bins */
+  float32_t last = (float32_t) numBins;          /* Number of bins */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t bin1, bin2, bin3;                    /* Positions of the samples in bins */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  if((numBins == 0u) || (maxVal <= minVal))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  scale = last / (maxVal - minVal);
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Positions of four samples, computed before the counts are updated */
+    bin = (pSrc[0] - minVal) * scale;
+    bin1 = (pSrc[1] - minVal) * scale;
+    bin2 = (pSrc[2] - minVal) * scale;
+    bin3 = (pSrc[3] - minVal) * scale;
+
+    /* Saturate to the first and last bins */
+    bin = (bin < 0.0f) ? 0.0f : ((bin < last) ? bin : (last - 1.0f));
+    bin1 = (bin1 < 0.0f) ? 0.0f : ((bin1 < last) ? bin1 : (last - 1.0f));
+    bin2 = (bin2 < 0.0f) ? 0.0f : ((bin2 < last) ? bin2 : (last - 1.0f));
+    bin3 = (bin3 < 0.0f) ? 0.0f : ((bin3 < last) ? bin3 : (last - 1.0f));
+
+    pCounts[(uint32_t) bin]++;
+    pCounts[(uint32_t) bin1]++;
+    pCounts[(uint32_t) bin2]++;
+    pCounts[(uint32_t) bin3]++;
+
+    pSrc += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    bin = (*pSrc++ - minVal) * scale;
+    bin = (bin < 0.0f) ? 0.0f : ((bin < last) ? bin : (last - 1.0f));
+
+    pCounts[(uint32_t) bin]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
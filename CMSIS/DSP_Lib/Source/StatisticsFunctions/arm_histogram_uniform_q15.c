@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_histogram_uniform_q15.c
+*
+* Description:	Histogram of a Q15 vector with uniform bins.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief Histogram of a Q15 vector with uniform bins.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       minVal lower edge of the first bin
+ * @param[in]       maxVal upper edge of the last bin
+ * @param[in]       numBins number of bins
+ * @param[in,out]   *pCounts points to the <code>numBins</code> counts, incremented by the samples of each bin
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is zero or <code>maxVal</code> is not above <code>minVal</code>.
+ *
+ * \par
+ * The bin of a sample <code>x</code> is <code>((x - minVal) * numBins) / (maxVal - minVal)</code>.
+ * The division is replaced by a multiplication by the reciprocal
+ * <code>numBins * 2<sup>32</sup> / (maxVal - minVal)</code>, rounded up, and a shift by
+ * 32 bits: as the offset and the range of the samples are below 2<sup>16</sup>, the
+ * rounding never changes the bin.
+ */
+
+arm_status arm_histogram_uniform_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minVal,
+  q15_t maxVal,
+  uint16_t numBins,
+  uint32_t * pCounts)
+{
+  uint64_t recip;                                /* numBins * 2^32 / (maxVal - minVal), rounded up */
+  uint32_t range;                                /* Width of the histogram */
+  int32_t in;                                    /* Offset of the sample from minVal */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if((numBins == 0u) || (maxVal <= minVal))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  range = (uint32_t) ((int32_t) maxVal - minVal);
+  recip = ((((uint64_t) numBins) << 32) + (range - 1u)) / range;
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = (int32_t) *pSrc++ - minVal;
+
+    /* Saturate to the first and last bins */
+    if(in < 0)
+    {
+      pCounts[0]++;
+    }
+    else if((uint32_t) in >= range)
+    {
+      pCounts[numBins - 1u]++;
+    }
+    else
+    {
+      pCounts[(uint32_t) (((uint64_t) (uint32_t) in * recip) >> 32)]++;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_select_f32.c
+*
+* Description:	Selection of the k-th smallest value of a floating-point vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief  Selection of the k-th smallest value of a floating-point vector.
+ * @param[in,out] *pSrc      points to the input vector, partially reordered.
+ * @param[in]     blockSize  length of the input vector.
+ * @param[in]     k          rank of the value to select, 0 for the minimum.
+ * @param[out]    *pResult   k-th smallest value.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>k</code> is not below <code>blockSize</code>.
+ *
+ * \par
+ * Each step partitions the range holding the rank <code>k</code> around the median of
+ * its first, middle and last values, and keeps the side holding <code>k</code>: about
+ * <code>3*blockSize</code> comparisons on average, sorted and reversed inputs included.
+ */
+
+arm_status arm_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult)
+{
+  float32_t pivot, tmp;                              /* Pivot and exchanged value */
+  int32_t lo, hi, mid, i, j;                     /* Range and partition indexes */
+
+  if(k >= blockSize)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  lo = 0;
+  hi = (int32_t) blockSize - 1;
+
+  while(hi > lo)
+  {
+    /* Median of three: pSrc[lo] <= pSrc[mid] <= pSrc[hi], the sentinels of the scans */
+    mid = lo + ((hi - lo) >> 1);
+
+    if(pSrc[mid] < pSrc[lo])
+    {
+      tmp = pSrc[mid];
+      pSrc[mid] = pSrc[lo];
+      pSrc[lo] = tmp;
+    }
+
+    if(pSrc[hi] < pSrc[mid])
+    {
+      tmp = pSrc[hi];
+      pSrc[hi] = pSrc[mid];
+      pSrc[mid] = tmp;
+
+      if(pSrc[mid] < pSrc[lo])
+      {
+        tmp = pSrc[mid];
+        pSrc[mid] = pSrc[lo];
+        pSrc[lo] = tmp;
+      }
+    }
+
+    pivot = pSrc[mid];
+
+    /* Partition: pSrc[lo..j] <= pivot <= pSrc[i..hi] */
+    i = lo;
+    j = hi;
+
+    while(i <= j)
+    {
+      while(pSrc[i] < pivot)
+      {
+        i++;
+      }
+
+      while(pSrc[j] > pivot)
+      {
+        j--;
+      }
+
+      if(i <= j)
+      {
+        tmp = pSrc[i];
+        pSrc[i] = pSrc[j];
+        pSrc[j] = tmp;
+        i++;
+        j--;
+      }
+    }
+
+    /* Keep the side holding k; between the two, the values equal the pivot */
+    if((int32_t) k <= j)
+    {
+      hi = j;
+    }
+    else if((int32_t) k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  *pResult = pSrc[k];
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Sort group
+ */
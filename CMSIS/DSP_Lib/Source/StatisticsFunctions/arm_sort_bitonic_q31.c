@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sort_bitonic_q31.c
+*
+* Description:	Bitonic sort of a short Q31 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/* Compare-exchange: a gets the smaller value, b the larger */
+#define ARM_SORT_CE(a, b)   { if((a) > (b)) { tmp = (a); (a) = (b); (b) = tmp; } }
+
+/**
+ * @brief  Bitonic sort of a short Q31 vector, in increasing order.
+ * @param[in,out] *pSrcDst   points to the vector, sorted in place.
+ * @param[in]     blockSize  length of the vector, a power of 2 from 2 to 64.
+ * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR for an unsupported length.
+ *
+ * \par
+ * A vector of 8 values is sorted by 19 compare-exchanges, 64 values by 19*8 in
+ * registers plus 3 bitonic merges of 32 compare-exchanges per stage, 240 in all.
+ */
+
+arm_status arm_sort_bitonic_q31(
+  q31_t * pSrcDst,
+  uint32_t blockSize)
+{
+  q31_t x0, x1, x2, x3, x4, x5, x6, x7, tmp;    /* Group of 8 values */
+  q31_t *p;                                      /* Group pointer */
+  uint32_t i, j, k, l;                           /* Stage and element counters */
+
+  if((blockSize < 2u) || (blockSize > 64u) || ((blockSize & (blockSize - 1u)) != 0u))
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  k = 2u;
+
+  if(blockSize >= 8u)
+  {
+    /* Groups of 8 sorted in registers, alternately increasing and decreasing */
+    for (p = pSrcDst; p < (pSrcDst + blockSize); p += 8u)
+    {
+      x0 = p[0];
+      x1 = p[1];
+      x2 = p[2];
+      x3 = p[3];
+      x4 = p[4];
+      x5 = p[5];
+      x6 = p[6];
+      x7 = p[7];
+
+      ARM_SORT_CE(x0, x1);
+      ARM_SORT_CE(x2, x3);
+      ARM_SORT_CE(x4, x5);
+      ARM_SORT_CE(x6, x7);
+      ARM_SORT_CE(x0, x2);
+      ARM_SORT_CE(x1, x3);
+      ARM_SORT_CE(x4, x6);
+      ARM_SORT_CE(x5, x7);
+      ARM_SORT_CE(x1, x2);
+      ARM_SORT_CE(x5, x6);
+      ARM_SORT_CE(x0, x4);
+      ARM_SORT_CE(x1, x5);
+      ARM_SORT_CE(x2, x6);
+      ARM_SORT_CE(x3, x7);
+      ARM_SORT_CE(x2, x4);
+      ARM_SORT_CE(x3, x5);
+      ARM_SORT_CE(x1, x2);
+      ARM_SORT_CE(x3, x4);
+      ARM_SORT_CE(x5, x6);
+
+      if((((uint32_t) (p - pSrcDst)) & 8u) == 0u)
+      {
+        p[0] = x0;
+        p[1] = x1;
+        p[2] = x2;
+        p[3] = x3;
+        p[4] = x4;
+        p[5] = x5;
+        p[6] = x6;
+        p[7] = x7;
+      }
+      else
+      {
+        p[0] = x7;
+        p[1] = x6;
+        p[2] = x5;
+        p[3] = x4;
+        p[4] = x3;
+        p[5] = x2;
+        p[6] = x1;
+        p[7] = x0;
+      }
+    }
+
+    k = 16u;
+  }
+
+  /* Bitonic merges of the sorted sequences of length k/2 */
+  for (; k <= blockSize; k <<= 1u)
+  {
+    for (j = k >> 1u; j > 0u; j >>= 1u)
+    {
+      for (i = 0u; i < blockSize; i++)
+      {
+        l = i ^ j;
+
+        if(l > i)
+        {
+          /* Increasing when bit k of i is clear, or for the last merge */
+          if(((i & k) == 0u) ? (pSrcDst[i] > pSrcDst[l]) : (pSrcDst[i] < pSrcDst[l]))
+          {
+            tmp = pSrcDst[i];
+            pSrcDst[i] = pSrcDst[l];
+            pSrcDst[l] = tmp;
+          }
+        }
+      }
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Sort group
+ */
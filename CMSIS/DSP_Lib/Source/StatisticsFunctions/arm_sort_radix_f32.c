@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sort_radix_f32.c
+*
+* Description:	Radix sort of a floating-point vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief  Radix sort of a floating-point vector, in increasing order.
+ * @param[in,out] *pSrcDst   points to the vector, sorted in place.
+ * @param[in]     *pScratch  points to a scratch buffer of <code>blockSize</code> values.
+ * @param[in]     blockSize  length of the vector.
+ * @return none.
+ *
+ * \par
+ * The values are sorted as integers by arm_sort_radix_q31(), their bit patterns being
+ * mapped in place to integers of the same order and back. -0.0 comes before +0.0; the
+ * vector should not hold NaN.
+ */
+
+void arm_sort_radix_f32(
+  float32_t * pSrcDst,
+  float32_t * pScratch,
+  uint32_t blockSize)
+{
+  q31_t *pKey = (q31_t *) pSrcDst;               /* Bit patterns of the values */
+  uint32_t i;                                    /* loop counter */
+
+  /* Negative values: the magnitude bits are flipped, the order is reversed */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pKey[i] = (pKey[i] < 0) ? (pKey[i] ^ 0x7FFFFFFF) : pKey[i];
+  }
+
+  arm_sort_radix_q31(pKey, (q31_t *) pScratch, blockSize);
+
+  /* The mapping is its own inverse */
+  for (i = 0u; i < blockSize; i++)
+  {
+    pKey[i] = (pKey[i] < 0) ? (pKey[i] ^ 0x7FFFFFFF) : pKey[i];
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sort_radix_q15.c
+*
+* Description:	Radix sort of a Q15 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief  Radix sort of a Q15 vector, in increasing order.
+ * @param[in,out] *pSrcDst   points to the vector, sorted in place.
+ * @param[in]     *pScratch  points to a scratch buffer of <code>blockSize</code> values.
+ * @param[in]     blockSize  length of the vector.
+ * @return none.
+ *
+ * \par
+ * The digit counts take 1 KB of stack.
+ */
+
+void arm_sort_radix_q15(
+  q15_t * pSrcDst,
+  q15_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* Digit counts, then offsets */
+  q15_t *pIn = pSrcDst;                          /* Values to distribute */
+  q15_t *pOut = pScratch;                        /* Values distributed */
+  q15_t *pTmp;
+  uint32_t shift, flip, digit, sum, tmp;         /* Digit position and sign flip */
+  uint32_t i;                                    /* loop counter */
+
+  if(blockSize < 2u)
+  {
+    return;
+  }
+
+  for (shift = 0u; shift < 16u; shift += 8u)
+  {
+    /* The sign bit is flipped so that the negative values come first */
+    flip = (shift == 8u) ? 0x80u : 0u;
+
+    /* Digit counts */
+    memset(count, 0, sizeof(count));
+    for (i = 0u; i < blockSize; i++)
+    {
+      count[(((uint16_t) pIn[i] >> shift) & 0xFFu) ^ flip]++;
+    }
+
+    /* A digit shared by all the values leaves the order unchanged */
+    if(count[(((uint16_t) pIn[0] >> shift) & 0xFFu) ^ flip] == blockSize)
+    {
+      continue;
+    }
+
+    /* Offsets of the digits */
+    sum = 0u;
+    for (digit = 0u; digit < 256u; digit++)
+    {
+      tmp = count[digit];
+      count[digit] = sum;
+      sum += tmp;
+    }
+
+    /* Stable distribution */
+    for (i = 0u; i < blockSize; i++)
+    {
+      digit = (((uint16_t) pIn[i] >> shift) & 0xFFu) ^ flip;
+      pOut[count[digit]++] = pIn[i];
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* After an odd number of passes the result is in the scratch */
+  if(pIn != pSrcDst)
+  {
+    memcpy(pSrcDst, pIn, blockSize * sizeof(q15_t));
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
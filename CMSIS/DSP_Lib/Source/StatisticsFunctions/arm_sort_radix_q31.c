@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sort_radix_q31.c
+*
+* Description:	Radix sort of a Q31 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Sort Sorting and Selection
+ *
+ * Sorting and order statistics without comparison callbacks, for median, percentile
+ * and rank filters:
+ * - arm_sort_radix_q31(), arm_sort_radix_q15() and arm_sort_radix_f32() sort a vector by
+ *   least significant digit radix sort, 8 bits per pass: 4 passes of 2 reads and 1 write
+ *   of the vector for 32-bit values, 2 for Q15, whatever the order of the input. A pass
+ *   whose digit is the same for all the values is skipped. The result is in place, the
+ *   passes alternating with a scratch buffer. Floating-point values are mapped to
+ *   integers of the same order by flipping the magnitude bits of the negative ones.
+ * - arm_sort_bitonic_f32(), arm_sort_bitonic_q31() and arm_sort_bitonic_q15() sort short
+ *   vectors of 2 to 64 values with a fixed network of compare-exchanges and no data
+ *   dependent branch structure: each group of 8 values is sorted in local variables,
+ *   held in registers, by the 19 comparators of Batcher's network, then the groups are
+ *   merged by bitonic merges.
+ * - arm_argsort_f32(), arm_argsort_q31() and arm_argsort_q15() return the indexes which
+ *   sort a vector, the input being unchanged: a radix sort of the values carrying their
+ *   indexes, stable, so that equal values keep their order.
+ * - arm_select_f32(), arm_select_q31() and arm_select_q15() return the k-th smallest value
+ *   (nth_element) in <code>O(blockSize)</code> average time by quickselect, with a median of
+ *   three pivot: the median is <code>k = blockSize/2</code>, the percentile p is
+ *   <code>k = p*(blockSize-1)</code>. The vector is partially reordered, the values before
+ *   the k-th being below or equal, the ones after above or equal.
+ *
+ * \par
+ * For the <code>k</code> largest values of a long vector, arm_topk_f32() is faster.
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief  Radix sort of a Q31 vector, in increasing order.
+ * @param[in,out] *pSrcDst   points to the vector, sorted in place.
+ * @param[in]     *pScratch  points to a scratch buffer of <code>blockSize</code> values.
+ * @param[in]     blockSize  length of the vector.
+ * @return none.
+ *
+ * \par
+ * The digit counts take 1 KB of stack.
+ */
+
+void arm_sort_radix_q31(
+  q31_t * pSrcDst,
+  q31_t * pScratch,
+  uint32_t blockSize)
+{
+  uint32_t count[256];                           /* Digit counts, then offsets */
+  q31_t *pIn = pSrcDst;                          /* Values to distribute */
+  q31_t *pOut = pScratch;                        /* Values distributed */
+  q31_t *pTmp;
+  uint32_t shift, flip, digit, sum, tmp;         /* Digit position and sign flip */
+  uint32_t i;                                    /* loop counter */
+
+  if(blockSize < 2u)
+  {
+    return;
+  }
+
+  for (shift = 0u; shift < 32u; shift += 8u)
+  {
+    /* The sign bit is flipped so that the negative values come first */
+    flip = (shift == 24u) ? 0x80u : 0u;
+
+    /* Digit counts */
+    memset(count, 0, sizeof(count));
+    for (i = 0u; i < blockSize; i++)
+    {
+      count[(((uint32_t) pIn[i] >> shift) & 0xFFu) ^ flip]++;
+    }
+
+    /* A digit shared by all the values leaves the order unchanged */
+    if(count[(((uint32_t) pIn[0] >> shift) & 0xFFu) ^ flip] == blockSize)
+    {
+      continue;
+    }
+
+    /* Offsets of the digits */
+    sum = 0u;
+    for (digit = 0u; digit < 256u; digit++)
+    {
+      tmp = count[digit];
+      count[digit] = sum;
+      sum += tmp;
+    }
+
+    /* Stable distribution */
+    for (i = 0u; i < blockSize; i++)
+    {
+      digit = (((uint32_t) pIn[i] >> shift) & 0xFFu) ^ flip;
+      pOut[count[digit]++] = pIn[i];
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* After an odd number of passes the result is in the scratch */
+  if(pIn != pSrcDst)
+  {
+    memcpy(pSrcDst, pIn, blockSize * sizeof(q31_t));
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
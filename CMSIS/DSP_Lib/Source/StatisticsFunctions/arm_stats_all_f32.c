@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_all_f32.c
+*
+* Description:	Single-pass statistics of a floating-point vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup StatsAll Combined Statistics
+ *
+ * Computes in a single pass over the input the statistics otherwise given by
+ * arm_mean, arm_var, arm_std, arm_rms, arm_min and arm_max, together with the
+ * peak-to-peak value and the crest factor:
+ *
+ * <pre>
+ *     mean        = sum / blockSize
+ *     var         = (sumOfSquares - sum<sup>2</sup> / blockSize) / (blockSize - 1)
+ *     std         = sqrt(var)
+ *     rms         = sqrt(sumOfSquares / blockSize)
+ *     peakToPeak  = max - min
+ *     crestFactor = max(|max|, |min|) / rms
+ *
+ *    where, sumOfSquares = pSrc[0] * pSrc[0] + pSrc[1] * pSrc[1] + ... + pSrc[blockSize-1] * pSrc[blockSize-1]
+ *
+ *                    sum = pSrc[0] + pSrc[1] + pSrc[2] + ... + pSrc[blockSize-1]
+ * </pre>
+ *
+ * Calling the individual functions on the same buffer reads it five times and
+ * computes the sum of squares three times; here each sample is loaded once and
+ * the results are written to a structure. The indices of the minimum and the
+ * maximum are those of their first occurrence, as in arm_min and arm_max.
+ * The variance and the standard deviation are zero when <code>blockSize</code>
+ * is 1, and the crest factor is zero when the rms value is zero.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup StatsAll
+ * @{
+ */
+
+/**
+ * @brief Single-pass statistics of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector, at least 1
+ * @param[out]      *pResult points to the structure receiving the statistics
+ * @return none.
+ */
+
+void arm_stats_all_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t sum = 0.0f;                          /* Sum of the samples */
+  float32_t sumOfSquares = 0.0f;                 /* Sum of squares */
+  float32_t minVal = pSrc[0], maxVal = pSrc[0];  /* Minimum and maximum values */
+  float32_t in, peak, var = 0.0f;                /* Input value, peak value and variance */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the minimum and maximum */
+  uint32_t blkCnt, count = 0u;                   /* loop counter and index of the current sample */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  float32_t sum1 = 0.0f, sumOfSquares1 = 0.0f;   /* Second pair of accumulators */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read four samples from source buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    /* Accumulate the sums and the sums of squares in two independent chains */
+    sum += in1;
+    sumOfSquares += in1 * in1;
+    sum1 += in2;
+    sumOfSquares1 += in2 * in2;
+    sum += in3;
+    sumOfSquares += in3 * in3;
+    sum1 += in4;
+    sumOfSquares1 += in4 * in4;
+
+    /* Track the extremes and their first occurrence */
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIndex = count;
+    }
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIndex = count;
+    }
+    if(in2 > maxVal)
+    {
+      maxVal = in2;
+      maxIndex = count + 1u;
+    }
+    if(in2 < minVal)
+    {
+      minVal = in2;
+      minIndex = count + 1u;
+    }
+    if(in3 > maxVal)
+    {
+      maxVal = in3;
+      maxIndex = count + 2u;
+    }
+    if(in3 < minVal)
+    {
+      minVal = in3;
+      minIndex = count + 2u;
+    }
+    if(in4 > maxVal)
+    {
+      maxVal = in4;
+      maxIndex = count + 3u;
+    }
+    if(in4 < minVal)
+    {
+      minVal = in4;
+      minIndex = count + 3u;
+    }
+
+    /* update source buffer to process next samples */
+    pSrc += 4u;
+    count += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* add the two pairs of accumulators */
+  sum += sum1;
+  sumOfSquares += sumOfSquares1;
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += in * in;
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = count;
+    }
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = count;
+    }
+
+    count++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  pResult->mean = sum / (float32_t) blockSize;
+
+  if(blockSize > 1u)
+  {
+    var = (sumOfSquares - ((sum * sum) / (float32_t) blockSize)) /
+      (float32_t) (blockSize - 1u);
+
+    /* Cancellation may leave a small negative value for a constant input */
+    if(var < 0.0f)
+    {
+      var = 0.0f;
+    }
+  }
+
+  pResult->var = var;
+  arm_sqrt_f32(var, &pResult->std);
+  arm_sqrt_f32(sumOfSquares / (float32_t) blockSize, &pResult->rms);
+
+  pResult->min = minVal;
+  pResult->minIndex = minIndex;
+  pResult->max = maxVal;
+  pResult->maxIndex = maxIndex;
+  pResult->peakToPeak = maxVal - minVal;
+
+  /* Crest factor, ratio of the peak value to the rms value */
+  peak = (maxVal > -minVal) ? maxVal : -minVal;
+  pResult->crestFactor = (pResult->rms > 0.0f) ? (peak / pResult->rms) : 0.0f;
+}
+
+/**
+ * @} end of StatsAll group
+ */
@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_all_q15.c
+*
+* Description:	Single-pass statistics of a Q15 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsAll
+ * @{
+ */
+
+/**
+ * @brief Single-pass statistics of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector, at least 1
+ * @param[out]      *pResult points to the structure receiving the statistics
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ *\par
+ * The sum of the samples is accumulated in 32 bits, and cannot overflow for a
+ * <code>blockSize</code> up to 65536. The squares, in 2.30 format, are accumulated
+ * in 64 bits with full precision. The mean, variance, standard deviation, rms and extreme
+ * values are returned in 1.15 format, the variance and the peak-to-peak value being
+ * saturated. The crest factor, which is at least 1, is returned in 16.16 format.
+ */
+
+void arm_stats_all_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+  q31_t sum = 0;                                 /* Sum of the samples */
+  q63_t sumOfSquares = 0;                        /* Sum of squares in 34.30 format */
+  q63_t var = 0, peak;                           /* Variance in 34.30 format and peak value */
+  q15_t minVal = pSrc[0], maxVal = pSrc[0];      /* Minimum and maximum values */
+  q15_t in1, mean, rms;                          /* Input value, mean and rms values */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the minimum and maximum */
+  uint32_t blkCnt, count = 0u;                   /* loop counter and index of the current sample */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in;                                      /* Two packed input samples */
+  q15_t in2;                                     /* Temporary input variable */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Two samples per load, squared and accumulated by a single SMLALD */
+    in = *__SIMD32(pSrc)++;
+    sumOfSquares = __SMLALD(in, in, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    in1 = (q15_t) in;
+    in2 = (q15_t) (in >> 16);
+#else
+    in1 = (q15_t) (in >> 16);
+    in2 = (q15_t) in;
+#endif /*      #ifndef ARM_MATH_BIG_ENDIAN    */
+
+    sum += in1 + in2;
+
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIndex = count;
+    }
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIndex = count;
+    }
+    if(in2 > maxVal)
+    {
+      maxVal = in2;
+      maxIndex = count + 1u;
+    }
+    if(in2 < minVal)
+    {
+      minVal = in2;
+      minIndex = count + 1u;
+    }
+
+    in = *__SIMD32(pSrc)++;
+    sumOfSquares = __SMLALD(in, in, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    in1 = (q15_t) in;
+    in2 = (q15_t) (in >> 16);
+#else
+    in1 = (q15_t) (in >> 16);
+    in2 = (q15_t) in;
+#endif /*      #ifndef ARM_MATH_BIG_ENDIAN    */
+
+    sum += in1 + in2;
+
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIndex = count + 2u;
+    }
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIndex = count + 2u;
+    }
+    if(in2 > maxVal)
+    {
+      maxVal = in2;
+      maxIndex = count + 3u;
+    }
+    if(in2 < minVal)
+    {
+      minVal = in2;
+      minIndex = count + 3u;
+    }
+
+    count += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in1 = *pSrc++;
+    sum += in1;
+    sumOfSquares += ((q31_t) in1 * in1);
+
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIndex = count;
+    }
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIndex = count;
+    }
+
+    count++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  mean = (q15_t) (sum / (q31_t) blockSize);
+  pResult->mean = mean;
+
+  if(blockSize > 1u)
+  {
+    /* sumOfSquares - blockSize * mean * mean, in 34.30 format */
+    var = sumOfSquares - ((q63_t) blockSize * ((q31_t) mean * mean));
+
+    /* Truncation of the mean may leave a small negative value */
+    if(var < 0)
+    {
+      var = 0;
+    }
+
+    var = var / (q63_t) (blockSize - 1u);
+  }
+
+  /* Convert data in 34.30 to 1.15 by 15 right shifts and saturate */
+  pResult->var = (q15_t) __SSAT((q31_t) (var >> 15), 16);
+  arm_sqrt_q15(pResult->var, &pResult->std);
+
+  arm_sqrt_q15((q15_t) __SSAT((q31_t) ((sumOfSquares / (q63_t) blockSize) >> 15), 16), &rms);
+  pResult->rms = rms;
+
+  pResult->min = minVal;
+  pResult->minIndex = minIndex;
+  pResult->max = maxVal;
+  pResult->maxIndex = maxIndex;
+  pResult->peakToPeak = (q15_t) __SSAT((q31_t) maxVal - minVal, 16);
+
+  /* Crest factor, ratio of the peak value to the rms value, in 16.16 format */
+  peak = ((q31_t) maxVal > -(q31_t) minVal) ? (q63_t) maxVal : -(q63_t) minVal;
+  pResult->crestFactor = (rms > 0) ? clip_q63_to_q31((peak << 16) / rms) : 0;
+}
+
+/**
+ * @} end of StatsAll group
+ */
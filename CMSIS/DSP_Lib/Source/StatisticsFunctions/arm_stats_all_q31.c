@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stats_all_q31.c
+*
+* Description:	Single-pass statistics of a Q31 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup StatsAll
+ * @{
+ */
+
+/**
+ * @brief Single-pass statistics of a Q31 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector, at least 1
+ * @param[out]      *pResult points to the structure receiving the statistics
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ *\par
+ * The sum of the samples is accumulated in 64 bits. The squares, in 2.62 format, are
+ * truncated to 16.48 format before they are accumulated in 64 bits, as in arm_power_q31(),
+ * so that the accumulator cannot overflow for a <code>blockSize</code> up to 32767.
+ * The mean, variance, standard deviation, rms and extreme values are returned in 1.31
+ * format, the variance and the peak-to-peak value being saturated. The crest factor,
+ * which is at least 1, is returned in 16.16 format.
+ */
+
+void arm_stats_all_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t sum = 0;                                 /* Sum of the samples */
+  q63_t sumOfSquares = 0;                        /* Sum of squares in 16.48 format */
+  q63_t var = 0, peak;                           /* Variance in 16.48 format and peak value */
+  q31_t minVal = pSrc[0], maxVal = pSrc[0];      /* Minimum and maximum values */
+  q31_t in, mean, rms;                           /* Input value, mean and rms values */
+  uint32_t minIndex = 0u, maxIndex = 0u;         /* Indices of the minimum and maximum */
+  uint32_t blkCnt, count = 0u;                   /* loop counter and index of the current sample */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in1, in2, in3, in4;                      /* Temporary input variables */
+  q63_t sumOfSquares1 = 0;                       /* Second accumulator of squares */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 samples at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* read four samples from source buffer */
+    in1 = pSrc[0];
+    in2 = pSrc[1];
+    in3 = pSrc[2];
+    in4 = pSrc[3];
+
+    /* Accumulate the sums and the sums of squares */
+    sum += in1;
+    sumOfSquares += ((q63_t) in1 * in1) >> 14;
+    sum += in2;
+    sumOfSquares1 += ((q63_t) in2 * in2) >> 14;
+    sum += in3;
+    sumOfSquares += ((q63_t) in3 * in3) >> 14;
+    sum += in4;
+    sumOfSquares1 += ((q63_t) in4 * in4) >> 14;
+
+    /* Track the extremes and their first occurrence */
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIndex = count;
+    }
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIndex = count;
+    }
+    if(in2 > maxVal)
+    {
+      maxVal = in2;
+      maxIndex = count + 1u;
+    }
+    if(in2 < minVal)
+    {
+      minVal = in2;
+      minIndex = count + 1u;
+    }
+    if(in3 > maxVal)
+    {
+      maxVal = in3;
+      maxIndex = count + 2u;
+    }
+    if(in3 < minVal)
+    {
+      minVal = in3;
+      minIndex = count + 2u;
+    }
+    if(in4 > maxVal)
+    {
+      maxVal = in4;
+      maxIndex = count + 3u;
+    }
+    if(in4 < minVal)
+    {
+      minVal = in4;
+      minIndex = count + 3u;
+    }
+
+    /* update source buffer to process next samples */
+    pSrc += 4u;
+    count += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* add two accumulators */
+  sumOfSquares += sumOfSquares1;
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += ((q63_t) in * in) >> 14;
+
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = count;
+    }
+    if(in < minVal)
+    {
+      minVal = in;
+      minIndex = count;
+    }
+
+    count++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  mean = (q31_t) (sum / (q63_t) blockSize);
+  pResult->mean = mean;
+
+  if(blockSize > 1u)
+  {
+    /* sumOfSquares - blockSize * mean * mean, in 16.48 format */
+    var = sumOfSquares - ((q63_t) blockSize * (((q63_t) mean * mean) >> 14));
+
+    /* Truncation of the mean may leave a small negative value */
+    if(var < 0)
+    {
+      var = 0;
+    }
+
+    var = var / (q63_t) (blockSize - 1u);
+  }
+
+  /* Convert data in 16.48 to 1.31 by 17 right shifts and saturate */
+  pResult->var = clip_q63_to_q31(var >> 17);
+  arm_sqrt_q31(pResult->var, &pResult->std);
+
+  arm_sqrt_q31(clip_q63_to_q31((sumOfSquares / (q63_t) blockSize) >> 17), &rms);
+  pResult->rms = rms;
+
+  pResult->min = minVal;
+  pResult->minIndex = minIndex;
+  pResult->max = maxVal;
+  pResult->maxIndex = maxIndex;
+  pResult->peakToPeak = clip_q63_to_q31((q63_t) maxVal - minVal);
+
+  /* Crest factor, ratio of the peak value to the rms value, in 16.16 format */
+  peak = ((q63_t) maxVal > -(q63_t) minVal) ? (q63_t) maxVal : -(q63_t) minVal;
+  pResult->crestFactor = (rms > 0) ? clip_q63_to_q31((peak << 16) / rms) : 0;
+}
+
+/**
+ * @} end of StatsAll group
+ */
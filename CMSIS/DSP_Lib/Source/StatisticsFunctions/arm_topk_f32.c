@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_topk_f32.c
+*
+* Description:	Top-K selection of a floating-point vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static void arm_topk_sift_f32(
+  float32_t * pVal,
+  uint32_t * pIdx,
+  uint32_t numNodes,
+  uint32_t node);
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup TopK Top-K Selection
+ *
+ * Selects the <code>k</code> largest values of a vector with their indices, for example
+ * the strongest bins of a magnitude spectrum, and returns them in decreasing order.
+ * Equal values are ordered by increasing index.
+ *
+ * \par
+ * The <code>k</code> values kept so far form a min-heap in <code>pDst</code> and
+ * <code>pIndex</code>, whose root is the smallest of them: a sample which is not larger
+ * than the root is rejected by a single comparison, and a larger one replaces the root,
+ * which is sifted down in <code>log2(k)</code> steps. For <code>k</code> much smaller than
+ * <code>blockSize</code> nearly all samples are rejected, and the cost is close to that of
+ * arm_max, where sorting the vector is not linear in its length. The heap is finally
+ * sorted in place.
+ */
+
+/**
+ * @addtogroup TopK
+ * @{
+ */
+
+/**
+ * @brief Top-K selection of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k number of values to select
+ * @param[out]      *pDst points to the <code>k</code> largest values, in decreasing order
+ * @param[out]      *pIndex points to the indices of the <code>k</code> largest values
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>k</code> is zero or larger than <code>blockSize</code>.
+ */
+
+arm_status arm_topk_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pDst,
+  uint32_t * pIndex)
+{
+  float32_t in, tmp;                             /* Input value and exchanged value */
+  uint32_t tmpIdx;                               /* Exchanged index */
+  uint32_t i, n;                                 /* loop counters */
+
+  if((k == 0u) || (k > blockSize))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The first k samples, arranged in a min-heap */
+  for (i = 0u; i < k; i++)
+  {
+    pDst[i] = pSrc[i];
+    pIndex[i] = i;
+  }
+
+  for (i = k >> 1u; i > 0u; i--)
+  {
+    arm_topk_sift_f32(pDst, pIndex, k, i - 1u);
+  }
+
+  /* A sample larger than the smallest value kept replaces it */
+  for (i = k; i < blockSize; i++)
+  {
+    in = pSrc[i];
+
+    if(in > pDst[0])
+    {
+      pDst[0] = in;
+      pIndex[0] = i;
+      arm_topk_sift_f32(pDst, pIndex, k, 0u);
+    }
+  }
+
+  /* Sort the heap in place: the smallest value is moved to the end at each step */
+  for (n = k - 1u; n > 0u; n--)
+  {
+    tmp = pDst[0];
+    pDst[0] = pDst[n];
+    pDst[n] = tmp;
+
+    tmpIdx = pIndex[0];
+    pIndex[0] = pIndex[n];
+    pIndex[n] = tmpIdx;
+
+    arm_topk_sift_f32(pDst, pIndex, n, 0u);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of TopK group
+ */
+
+/**
+ * @brief  Sifts a node down a min-heap of values and indices. A value is below another
+ * when it is smaller, or equal with a larger index.
+ * @param[in,out] *pVal    points to the values of the heap.
+ * @param[in,out] *pIdx    points to the indices of the heap.
+ * @param[in]     numNodes number of nodes of the heap.
+ * @param[in]     node     node to sift down.
+ * @return none.
+ */
+
+static void arm_topk_sift_f32(
+  float32_t * pVal,
+  uint32_t * pIdx,
+  uint32_t numNodes,
+  uint32_t node)
+{
+  float32_t val = pVal[node];                    /* Value of the node */
+  uint32_t idx = pIdx[node];                     /* Index of the node */
+  uint32_t child = (2u * node) + 1u;             /* Smaller child */
+
+  while(child < numNodes)
+  {
+    /* Smaller of the two children */
+    if(((child + 1u) < numNodes) &&
+       ((pVal[child + 1u] < pVal[child]) ||
+        ((pVal[child + 1u] == pVal[child]) && (pIdx[child + 1u] > pIdx[child]))))
+    {
+      child++;
+    }
+
+    /* Stop when the node is below its smaller child */
+    if((val < pVal[child]) || ((val == pVal[child]) && (idx > pIdx[child])))
+    {
+      break;
+    }
+
+    pVal[node] = pVal[child];
+    pIdx[node] = pIdx[child];
+    node = child;
+    child = (2u * node) + 1u;
+  }
+
+  pVal[node] = val;
+  pIdx[node] = idx;
+}
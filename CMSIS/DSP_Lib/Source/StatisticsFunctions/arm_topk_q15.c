@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_topk_q15.c
+*
+* Description:	Top-K selection of a Q15 vector.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static void arm_topk_sift_q15(
+  q15_t * pVal,
+  uint32_t * pIdx,
+  uint32_t numNodes,
+  uint32_t node);
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup TopK
+ * @{
+ */
+
+/**
+ * @brief Top-K selection of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k number of values to select
+ * @param[out]      *pDst points to the <code>k</code> largest values, in decreasing order
+ * @param[out]      *pIndex points to the indices of the <code>k</code> largest values
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>k</code> is zero or larger than <code>blockSize</code>.
+ */
+
+arm_status arm_topk_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pDst,
+  uint32_t * pIndex)
+{
+  q15_t in, tmp;                                 /* Input value and exchanged value */
+  uint32_t tmpIdx;                               /* Exchanged index */
+  uint32_t i, n;                                 /* loop counters */
+
+  if((k == 0u) || (k > blockSize))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The first k samples, arranged in a min-heap */
+  for (i = 0u; i < k; i++)
+  {
+    pDst[i] = pSrc[i];
+    pIndex[i] = i;
+  }
+
+  for (i = k >> 1u; i > 0u; i--)
+  {
+    arm_topk_sift_q15(pDst, pIndex, k, i - 1u);
+  }
+
+  /* A sample larger than the smallest value kept replaces it */
+  for (i = k; i < blockSize; i++)
+  {
+    in = pSrc[i];
+
+    if(in > pDst[0])
+    {
+      pDst[0] = in;
+      pIndex[0] = i;
+      arm_topk_sift_q15(pDst, pIndex, k, 0u);
+    }
+  }
+
+  /* Sort the heap in place: the smallest value is moved to the end at each step */
+  for (n = k - 1u; n > 0u; n--)
+  {
+    tmp = pDst[0];
+    pDst[0] = pDst[n];
+    pDst[n] = tmp;
+
+    tmpIdx = pIndex[0];
+    pIndex[0] = pIndex[n];
+    pIndex[n] = tmpIdx;
+
+    arm_topk_sift_q15(pDst, pIndex, n, 0u);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of TopK group
+ */
+
+/**
+ * @brief  Sifts a node down a min-heap of values and indices. A value is below another
+ * when it is smaller, or equal with a larger index.
+ * @param[in,out] *pVal    points to the values of the heap.
+ * @param[in,out] *pIdx    points to the indices of the heap.
+ * @param[in]     numNodes number of nodes of the heap.
+ * @param[in]     node     node to sift down.
+ * @return none.
+ */
+
+static void arm_topk_sift_q15(
+  q15_t * pVal,
+  uint32_t * pIdx,
+  uint32_t numNodes,
+  uint32_t node)
+{
+  q15_t val = pVal[node];                        /* Value of the node */
+  uint32_t idx = pIdx[node];                     /* Index of the node */
+  uint32_t child = (2u * node) + 1u;             /* Smaller child */
+
+  while(child < numNodes)
+  {
+    /* Smaller of the two children */
+    if(((child + 1u) < numNodes) &&
+       ((pVal[child + 1u] < pVal[child]) ||
+        ((pVal[child + 1u] == pVal[child]) && (pIdx[child + 1u] > pIdx[child]))))
+    {
+      child++;
+    }
+
+    /* Stop when the node is below its smaller child */
+    if((val < pVal[child]) || ((val == pVal[child]) && (idx > pIdx[child])))
+    {
+      break;
+    }
+
+    pVal[node] = pVal[child];
+    pIdx[node] = pIdx[child];
+    node = child;
+    child = (2u * node) + 1u;
+  }
+
+  pVal[node] = val;
+  pIdx[node] = idx;
+}
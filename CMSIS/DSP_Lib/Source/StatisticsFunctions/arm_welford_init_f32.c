@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_welford_init_f32.c
+*
+* Description:	Floating-point running statistics initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup RunningStats Running Statistics
+ *
+ * arm_mean, arm_var and arm_std need the whole record in memory. The running statistics
+ * accumulate the count, the mean and the sum of squared deviations from the mean
+ * <code>M2</code> of a record received block by block, so that the mean and the variance
+ * of an arbitrarily long record are available at any time:
+ * <pre>
+ *    mean = (x[0] + x[1] + ... + x[count-1]) / count
+ *    var  = M2 / (count - 1)
+ * </pre>
+ * Unlike the sum of squares used by arm_var_f32(), <code>M2</code> does not suffer from
+ * cancellation when the mean is large compared to the standard deviation.
+ *
+ * \par
+ * arm_welford_update_f32() computes the mean and <code>M2</code> of each block in two passes
+ * over the block, then merges them into the instance with the update of Chan, Golub and
+ * LeVeque. This gives the result of Welford's algorithm, with one division per block
+ * instead of one per sample. arm_welford_merge_f32() uses the same update to combine two
+ * instances which accumulated separate records, for example segments processed by
+ * different tasks, into the statistics of the whole.
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point running statistics.
+ * @param[out] *S points to an instance of the floating-point running statistics structure.
+ * @return none.
+ */
+
+void arm_welford_init_f32(
+  arm_welford_instance_f32 * S)
+{
+  /* Start from an empty record */
+  S->count = 0u;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+}
+
+/**
+ * @} end of RunningStats group
+ */
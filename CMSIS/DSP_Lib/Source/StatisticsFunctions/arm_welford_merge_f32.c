@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_welford_merge_f32.c
+*
+* Description:	Merge of two floating-point running statistics.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/**
+ * @brief  Merges two floating-point running statistics.
+ * @param[in,out] *S    points to the instance receiving the statistics of both records.
+ * @param[in]     *pSrc points to the instance of the second record.
+ * @return none.
+ *
+ * \par
+ * With <code>delta</code> the difference of the means of the two records, of
+ * <code>nA</code> and <code>nB</code> samples:
+ * <pre>
+ *    mean = meanA + delta * nB / (nA + nB)
+ *    M2   = M2A + M2B + delta<sup>2</sup> * nA * nB / (nA + nB)
+ * </pre>
+ */
+
+void arm_welford_merge_f32(
+  arm_welford_instance_f32 * S,
+  const arm_welford_instance_f32 * pSrc)
+{
+  float32_t delta, ratio;                        /* Difference of the means and nB / (nA + nB) */
+  uint32_t count = S->count + pSrc->count;       /* Number of samples of both records */
+
+  if(pSrc->count == 0u)
+  {
+    return;
+  }
+
+  delta = pSrc->mean - S->mean;
+  ratio = (float32_t) pSrc->count / (float32_t) count;
+
+  S->mean += delta * ratio;
+  S->m2 += pSrc->m2 + ((delta * delta) * ((float32_t) S->count * ratio));
+  S->count = count;
+}
+
+/**
+ * @} end of RunningStats group
+ */
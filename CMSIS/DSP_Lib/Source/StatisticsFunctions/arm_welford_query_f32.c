@@ -0,0 +1,45 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_welford_query_f32.c
+*
+* Description:	Floating-point running statistics query.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/**
+ * @brief  Mean and variance of the samples added to the floating-point running statistics.
+ * @param[in]  *S     points to an instance of the floating-point running statistics structure.
+ * @param[out] *pMean mean value returned here.
+ * @param[out] *pVar  variance value returned here, zero for less than 2 samples.
+ * @return none.
+ */
+
+void arm_welford_query_f32(
+  const arm_welford_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar)
+{
+  *pMean = S->mean;
+  *pVar = (S->count > 1u) ? (S->m2 / (float32_t) (S->count - 1u)) : 0.0f;
+}
+
+/**
+ * @} end of RunningStats group
+ */
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_welford_update_f32.c
+*
+* Description:	Floating-point running statistics update.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup RunningStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of samples to the floating-point running statistics.
+ * @param[in,out] *S         points to an instance of the floating-point running statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_welford_update_f32(
+  arm_welford_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  arm_welford_instance_f32 block;                /* Statistics of the block */
+  float32_t *px = pSrc;                          /* Temporary pointer for the input */
+  float32_t sum = 0.0f, m2 = 0.0f;               /* Accumulators */
+  float32_t mean, in;                            /* Mean of the block and deviation of a sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  float32_t acc1 = 0.0f;                         /* Second accumulator */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* First pass: mean of the block */
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in1 = px[0];
+    in2 = px[1];
+    in3 = px[2];
+    in4 = px[3];
+
+    sum += in1;
+    acc1 += in2;
+    sum += in3;
+    acc1 += in4;
+
+    px += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  sum += acc1;
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    sum += *px++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  mean = sum / (float32_t) blockSize;
+
+  /* Second pass: sum of the squared deviations from the mean of the block */
+  px = pSrc;
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  acc1 = 0.0f;
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    in1 = px[0] - mean;
+    in2 = px[1] - mean;
+    in3 = px[2] - mean;
+    in4 = px[3] - mean;
+
+    m2 += in1 * in1;
+    acc1 += in2 * in2;
+    m2 += in3 * in3;
+    acc1 += in4 * in4;
+
+    px += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  m2 += acc1;
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    in = *px++ - mean;
+    m2 += in * in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Merge the block into the record */
+  block.count = blockSize;
+  block.mean = mean;
+  block.m2 = m2;
+
+  arm_welford_merge_f32(S, &block);
+}
+
+/**
+ * @} end of RunningStats group
+ */
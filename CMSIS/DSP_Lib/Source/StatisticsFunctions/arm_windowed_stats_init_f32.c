@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_windowed_stats_init_f32.c
+*
+* Description:	Floating-point windowed statistics initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup WindowedStats Windowed Statistics
+ *
+ * The windowed statistics give the mean and the variance of the last
+ * <code>windowLen</code> samples of a record received block by block. The samples of the
+ * window are kept in the circular buffer <code>pState</code>, together with the sum and
+ * the sum of squares of their deviations from a reference value <code>shift</code>, which
+ * are updated at each sample by adding the new sample and subtracting the one leaving
+ * the window:
+ * <pre>
+ *    mean = shift + sum / count
+ *    var  = (sumOfSquares - sum<sup>2</sup> / count) / (count - 1)
+ * </pre>
+ * where <code>count</code> is <code>windowLen</code> once the window is full, and the
+ * number of samples received before. Each time the window has been renewed,
+ * <code>shift</code> is set to the mean of the window and the sums are computed again from
+ * the window: the deviations stay small when the mean is large compared to the standard
+ * deviation, which avoids the cancellation of the plain sum of squares, and the rounding
+ * errors accumulated by the running sums are discarded.
+ */
+
+/**
+ * @addtogroup WindowedStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point windowed statistics.
+ * @param[out] *S         points to an instance of the floating-point windowed statistics structure.
+ * @param[in]  windowLen  number of samples in the window.
+ * @param[in]  *pState    points to the state buffer of <code>windowLen</code> samples.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>windowLen</code> is zero.
+ */
+
+arm_status arm_windowed_stats_init_f32(
+  arm_windowed_stats_instance_f32 * S,
+  uint16_t windowLen,
+  float32_t * pState)
+{
+  if(windowLen == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Assign the window length */
+  S->windowLen = windowLen;
+
+  /* Clear the window and the sums */
+  memset(pState, 0, windowLen * sizeof(float32_t));
+  S->pState = pState;
+  S->stateIndex = 0u;
+  S->count = 0u;
+  S->shift = 0.0f;
+  S->sum = 0.0f;
+  S->sumOfSquares = 0.0f;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of WindowedStats group
+ */
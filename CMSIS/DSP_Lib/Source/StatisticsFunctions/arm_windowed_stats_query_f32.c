@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_windowed_stats_query_f32.c
+*
+* Description:	Floating-point windowed statistics query.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup WindowedStats
+ * @{
+ */
+
+/**
+ * @brief  Mean and variance of the window of the floating-point windowed statistics.
+ * @param[in]  *S     points to an instance of the floating-point windowed statistics structure.
+ * @param[out] *pMean mean value returned here, zero for an empty window.
+ * @param[out] *pVar  variance value returned here, zero for less than 2 samples.
+ * @return none.
+ */
+
+void arm_windowed_stats_query_f32(
+  const arm_windowed_stats_instance_f32 * S,
+  float32_t * pMean,
+  float32_t * pVar)
+{
+  float32_t mean = 0.0f, var = 0.0f;             /* Mean of the deviations and variance */
+
+  if(S->count > 0u)
+  {
+    mean = S->sum / (float32_t) S->count;
+  }
+
+  if(S->count > 1u)
+  {
+    var = (S->sumOfSquares - (S->sum * mean)) / (float32_t) (S->count - 1u);
+
+    /* Rounding may leave a small negative value for a constant input */
+    if(var < 0.0f)
+    {
+      var = 0.0f;
+    }
+  }
+
+  *pMean = S->shift + mean;
+  *pVar = var;
+}
+
+/**
+ * @} end of WindowedStats group
+ */
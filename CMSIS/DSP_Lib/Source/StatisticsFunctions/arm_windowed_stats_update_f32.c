@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_windowed_stats_update_f32.c
+*
+* Description:	Floating-point windowed statistics update.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup WindowedStats
+ * @{
+ */
+
+/**
+ * @brief  Adds a block of samples to the floating-point windowed statistics.
+ * @param[in,out] *S         points to an instance of the floating-point windowed statistics structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_windowed_stats_update_f32(
+  arm_windowed_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* Samples of the window */
+  float32_t shift = S->shift;                    /* Reference value of the sums */
+  float32_t sum = S->sum;                        /* Running sum of the deviations */
+  float32_t sumOfSquares = S->sumOfSquares;      /* Running sum of the squared deviations */
+  float32_t in, d;                               /* New sample and deviation */
+  uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+  uint32_t index = S->stateIndex;                /* Index of the oldest sample */
+  uint32_t count = S->count;                     /* Number of valid samples in the window */
+  uint32_t blkCnt, i;                            /* Loop counters */
+
+  /* The first sample of the record is the first reference value */
+  if((count == 0u) && (blockSize > 0u))
+  {
+    shift = pSrc[0];
+  }
+
+  for (blkCnt = blockSize; blkCnt > 0u; blkCnt--)
+  {
+    in = *pSrc++;
+
+    if(count == windowLen)
+    {
+      /* Subtract the sample leaving the window */
+      d = pState[index] - shift;
+      sum -= d;
+      sumOfSquares -= d * d;
+    }
+    else
+    {
+      count++;
+    }
+
+    /* Add the new sample */
+    d = in - shift;
+    sum += d;
+    sumOfSquares += d * d;
+    pState[index] = in;
+
+    index++;
+
+    if(index == windowLen)
+    {
+      index = 0u;
+
+      /* Center the renewed window on its mean and sum it again,
+       * discarding the accumulated rounding errors */
+      shift += sum / (float32_t) windowLen;
+      sum = 0.0f;
+      sumOfSquares = 0.0f;
+
+      for (i = 0u; i < windowLen; i++)
+      {
+        d = pState[i] - shift;
+        sum += d;
+        sumOfSquares += d * d;
+      }
+    }
+  }
+
+  S->shift = shift;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->stateIndex = (uint16_t) index;
+  S->count = (uint16_t) count;
+}
+
+/**
+ * @} end of WindowedStats group
+ */
@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_copy_strided_q15.c
+*
+* Description:	Copies a Q15 vector between two strides.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Copies a Q15 vector between two strides.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       srcStride distance in samples between two inputs
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       dstStride distance in samples between two outputs
+ * @param[in]       blockSize number of samples to copy
+ * @return none.
+ *
+ * <pre>
+ *     pDst[n * dstStride] = pSrc[n * srcStride];   0 <= n < blockSize.
+ * </pre>
+ */
+
+void arm_copy_strided_q15(
+  q15_t * pSrc,
+  uint32_t srcStride,
+  q15_t * pDst,
+  uint32_t dstStride,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q15_t in1, in2, in3, in4;                      /* Temporary variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* C[n * dstStride] = A[n * srcStride] */
+    /* The 4 loads are issued before the stores */
+    in1 = pSrc[0];
+    in2 = pSrc[srcStride];
+    in3 = pSrc[2u * srcStride];
+    in4 = pSrc[3u * srcStride];
+    pSrc += 4u * srcStride;
+
+    pDst[0] = in1;
+    pDst[dstStride] = in2;
+    pDst[2u * dstStride] = in3;
+    pDst[3u * dstStride] = in4;
+    pDst += 4u * dstStride;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C[n * dstStride] = A[n * srcStride] */
+    *pDst = *pSrc;
+    pSrc += srcStride;
+    pDst += dstStride;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
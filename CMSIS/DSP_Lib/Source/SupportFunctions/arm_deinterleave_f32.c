@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_deinterleave_f32.c
+*
+* Description:	Splits interleaved floating-point frames into planar channels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Interleave Interleave, Deinterleave and Strided Copy
+ *
+ * Multi-channel data is usually moved by DMA as interleaved frames, one sample of
+ * every channel after the other, as the regular sequence of an ADC in scan mode writes
+ * it, while the processing functions work on planar buffers, one per channel.
+ * <pre>
+ *     interleaved:  x0[0] x1[0] ... xN-1[0]  x0[1] x1[1] ... xN-1[1]  ...
+ *     planar:       x0[0] x0[1] ...          x1[0] x1[1] ...          ...
+ * </pre>
+ * arm_deinterleave_f32() and its Q31 and Q15 variants split <code>numFrames</code>
+ * interleaved frames of <code>numChannels</code> samples into the buffers pointed to by
+ * the array <code>ppDst</code>, and arm_interleave_f32() and its variants do the
+ * inverse. Two channels have the layout of complex samples and use
+ * arm_cmplx_deinterleave_f32() and arm_cmplx_interleave_f32(); four channels are moved
+ * one whole frame at a time, the Q15 samples by pairs in 32-bit words with
+ * <code>__PKHBT</code> and <code>__PKHTB</code> on Cortex-M4 and Cortex-M3; other
+ * channel counts are moved one channel at a time by strided copies.
+ *
+ * arm_copy_strided_f32() and its variants copy samples between any two strides:
+ * <pre>
+ *     pDst[n * dstStride] = pSrc[n * srcStride];   0 <= n < blockSize.
+ * </pre>
+ * which is a gather with <code>dstStride</code> equal to 1 and a scatter with
+ * <code>srcStride</code> equal to 1.
+ *
+ * arm_deinterleave_q15_to_float() fuses the deinterleave with the conversion of the
+ * 16-bit samples to floating-point, applying a scale and an offset, so that raw ADC
+ * data is converted to planar floating-point buffers in one pass.
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved floating-point frames into planar channels.
+ * @param[in]       *pSrc points to the <code>numFrames*numChannels</code> interleaved samples
+ * @param[out]      **ppDst points to an array of <code>numChannels</code> pointers to the output channels
+ * @param[in]       numChannels number of channels of a frame
+ * @param[in]       numFrames number of frames
+ * @return none.
+ *
+ * <pre>
+ *     ppDst[c][n] = pSrc[n * numChannels + c];   0 <= c < numChannels, 0 <= n < numFrames.
+ * </pre>
+ */
+
+void arm_deinterleave_f32(
+  float32_t * pSrc,
+  float32_t ** ppDst,
+  uint16_t numChannels,
+  uint32_t numFrames)
+{
+  float32_t *pD0, *pD1, *pD2, *pD3;              /* Output channel pointers */
+  uint32_t blkCnt, ch;                           /* loop counters */
+
+  if(numChannels == 2u)
+  {
+    /* Two channels have the layout of complex samples */
+    arm_cmplx_deinterleave_f32(pSrc, ppDst[0], ppDst[1], numFrames);
+  }
+  else if(numChannels == 4u)
+  {
+    pD0 = ppDst[0];
+    pD1 = ppDst[1];
+    pD2 = ppDst[2];
+    pD3 = ppDst[3];
+
+    blkCnt = numFrames;
+
+    /* One frame of 4 samples at a time */
+    while(blkCnt > 0u)
+    {
+      *pD0++ = *pSrc++;
+      *pD1++ = *pSrc++;
+      *pD2++ = *pSrc++;
+      *pD3++ = *pSrc++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Any other number of channels, one strided copy per channel */
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      arm_copy_strided_f32(pSrc + ch, numChannels, ppDst[ch], 1u, numFrames);
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
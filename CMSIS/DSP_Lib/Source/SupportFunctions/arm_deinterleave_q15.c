@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_deinterleave_q15.c
+*
+* Description:	Splits interleaved Q15 frames into planar channels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved Q15 frames into planar channels.
+ * @param[in]       *pSrc points to the <code>numFrames*numChannels</code> interleaved samples
+ * @param[out]      **ppDst points to an array of <code>numChannels</code> pointers to the output channels
+ * @param[in]       numChannels number of channels of a frame
+ * @param[in]       numFrames number of frames
+ * @return none.
+ *
+ * <pre>
+ *     ppDst[c][n] = pSrc[n * numChannels + c];   0 <= c < numChannels, 0 <= n < numFrames.
+ * </pre>
+ */
+
+void arm_deinterleave_q15(
+  q15_t * pSrc,
+  q15_t ** ppDst,
+  uint16_t numChannels,
+  uint32_t numFrames)
+{
+  q15_t *pD0, *pD1, *pD2, *pD3;                  /* Output channel pointers */
+  uint32_t blkCnt, ch;                           /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2, in3, in4;                      /* Two frames packed in words */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  if(numChannels == 2u)
+  {
+    /* Two channels have the layout of complex samples */
+    arm_cmplx_deinterleave_q15(pSrc, ppDst[0], ppDst[1], numFrames);
+  }
+  else if(numChannels == 4u)
+  {
+    pD0 = ppDst[0];
+    pD1 = ppDst[1];
+    pD2 = ppDst[2];
+    pD3 = ppDst[3];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = numFrames >> 1u;
+
+    /* Two frames at a time: a frame is two words, each output word takes one
+     * half of a word of each frame */
+    while(blkCnt > 0u)
+    {
+      in1 = *__SIMD32(pSrc)++;
+      in2 = *__SIMD32(pSrc)++;
+      in3 = *__SIMD32(pSrc)++;
+      in4 = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      *__SIMD32(pD0)++ = __PKHBT(in1, in3, 16);
+      *__SIMD32(pD1)++ = __PKHTB(in3, in1, 16);
+      *__SIMD32(pD2)++ = __PKHBT(in2, in4, 16);
+      *__SIMD32(pD3)++ = __PKHTB(in4, in2, 16);
+
+#else
+
+      *__SIMD32(pD0)++ = __PKHTB(in1, in3, 16);
+      *__SIMD32(pD1)++ = __PKHBT(in3, in1, 16);
+      *__SIMD32(pD2)++ = __PKHTB(in2, in4, 16);
+      *__SIMD32(pD3)++ = __PKHBT(in4, in2, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* The last frame of an odd number of frames */
+    blkCnt = numFrames & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    blkCnt = numFrames;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* One frame of 4 samples at a time */
+    while(blkCnt > 0u)
+    {
+      *pD0++ = *pSrc++;
+      *pD1++ = *pSrc++;
+      *pD2++ = *pSrc++;
+      *pD3++ = *pSrc++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Any other number of channels, one strided copy per channel */
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      arm_copy_strided_q15(pSrc + ch, numChannels, ppDst[ch], 1u, numFrames);
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_deinterleave_q15_to_float.c
+*
+* Description:	Splits interleaved 16-bit frames into planar floating-point channels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved 16-bit frames into planar floating-point channels.
+ * @param[in]       *pSrc points to the <code>numFrames*numChannels</code> interleaved samples
+ * @param[in]       scale scale applied to the samples
+ * @param[in]       offset offset added after the scale
+ * @param[out]      **ppDst points to an array of <code>numChannels</code> pointers to the output channels
+ * @param[in]       numChannels number of channels of a frame
+ * @param[in]       numFrames number of frames
+ * @return none.
+ *
+ * <pre>
+ *     ppDst[c][n] = pSrc[n * numChannels + c] * scale + offset;   0 <= c < numChannels, 0 <= n < numFrames.
+ * </pre>
+ * \par
+ * The samples are read as signed 16-bit integers. A <code>scale</code> of 1/32768 and an
+ * <code>offset</code> of 0 give the result of arm_q15_to_float(). The right aligned
+ * 12-bit data of an ADC, 0 to 4095, is centered on [-1 +1) with a <code>scale</code>
+ * of 1/2048 and an <code>offset</code> of -1.
+ */
+
+void arm_deinterleave_q15_to_float(
+  q15_t * pSrc,
+  float32_t scale,
+  float32_t offset,
+  float32_t ** ppDst,
+  uint16_t numChannels,
+  uint32_t numFrames)
+{
+  q15_t *pIn;                                    /* Input pointer of a channel */
+  float32_t *pOut;                               /* Output pointer of a channel */
+  uint32_t blkCnt, ch;                           /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q15_t in1, in2, in3, in4;                      /* Temporary input variables */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    pIn = pSrc + ch;
+    pOut = ppDst[ch];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = numFrames >> 2u;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while(blkCnt > 0u)
+    {
+      /* C[c][n] = A[n * numChannels + c] * scale + offset */
+      in1 = pIn[0];
+      in2 = pIn[numChannels];
+      in3 = pIn[2u * numChannels];
+      in4 = pIn[3u * numChannels];
+      pIn += 4u * numChannels;
+
+      pOut[0] = ((float32_t) in1 * scale) + offset;
+      pOut[1] = ((float32_t) in2 * scale) + offset;
+      pOut[2] = ((float32_t) in3 * scale) + offset;
+      pOut[3] = ((float32_t) in4 * scale) + offset;
+      pOut += 4u;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the numFrames is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = numFrames % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    blkCnt = numFrames;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    while(blkCnt > 0u)
+    {
+      /* C[c][n] = A[n * numChannels + c] * scale + offset */
+      *pOut++ = ((float32_t) * pIn * scale) + offset;
+      pIn += numChannels;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_deinterleave_q31.c
+*
+* Description:	Splits interleaved Q31 frames into planar channels.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Splits interleaved Q31 frames into planar channels.
+ * @param[in]       *pSrc points to the <code>numFrames*numChannels</code> interleaved samples
+ * @param[out]      **ppDst points to an array of <code>numChannels</code> pointers to the output channels
+ * @param[in]       numChannels number of channels of a frame
+ * @param[in]       numFrames number of frames
+ * @return none.
+ *
+ * <pre>
+ *     ppDst[c][n] = pSrc[n * numChannels + c];   0 <= c < numChannels, 0 <= n < numFrames.
+ * </pre>
+ */
+
+void arm_deinterleave_q31(
+  q31_t * pSrc,
+  q31_t ** ppDst,
+  uint16_t numChannels,
+  uint32_t numFrames)
+{
+  q31_t *pD0, *pD1, *pD2, *pD3;                  /* Output channel pointers */
+  uint32_t blkCnt, ch;                           /* loop counters */
+
+  if(numChannels == 2u)
+  {
+    /* Two channels have the layout of complex samples */
+    arm_cmplx_deinterleave_q31(pSrc, ppDst[0], ppDst[1], numFrames);
+  }
+  else if(numChannels == 4u)
+  {
+    pD0 = ppDst[0];
+    pD1 = ppDst[1];
+    pD2 = ppDst[2];
+    pD3 = ppDst[3];
+
+    blkCnt = numFrames;
+
+    /* One frame of 4 samples at a time */
+    while(blkCnt > 0u)
+    {
+      *pD0++ = *pSrc++;
+      *pD1++ = *pSrc++;
+      *pD2++ = *pSrc++;
+      *pD3++ = *pSrc++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Any other number of channels, one strided copy per channel */
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      arm_copy_strided_q31(pSrc + ch, numChannels, ppDst[ch], 1u, numFrames);
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_f16_to_f32.c
+*
+* Description:	Converts the elements of a half-precision vector to floating-point.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup f16_to_x  Convert 16-bit floating point value
+ *
+ * Half-precision vectors, float16_t, take half the memory and the bandwidth of
+ * floating-point vectors for the samples and the coefficients which do not need more
+ * than 11 significant bits.  They are converted to floating-point in blocks, or while
+ * being loaded by arm_dot_prod_f16_f32(), arm_fir_f16_f32() and arm_mat_vec_mult_f16_f32().
+ *
+ * \par
+ * On the Cortex-M4 with FPU the conversions are made by the VCVTB and VCVTT instructions,
+ * two values per word loaded or stored; elsewhere by arm_f16_to_f32_scalar() and
+ * arm_f32_to_f16_scalar(), with the same results.
+ */
+
+/**
+ * @addtogroup f16_to_x
+ * @{
+ */
+
+/**
+ * @brief  Converts the elements of a half-precision vector to floating-point.
+ * @param[in]       *pSrc points to the half-precision input vector
+ * @param[out]      *pDst points to the floating-point output vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par
+ * The conversion is exact.  On the Cortex-M4 with FPU <code>pSrc</code> should be
+ * word aligned.
+ */
+
+void arm_f16_to_f32(
+  float16_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float16_t *pIn = pSrc;                         /* Src pointer */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_F16_HW)
+
+  /* Run the below code for Cortex-M4 with FPU */
+
+  q31_t in1, in2;                                /* Two values per word */
+  float32_t bot1, top1, bot2, top2;              /* Converted halves */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    in1 = *__SIMD32(pIn)++;
+    in2 = *__SIMD32(pIn)++;
+
+    /* VCVTB converts the bottom half of the register, VCVTT the top half */
+    __ASM volatile ("vmov %0, %2\n\tvcvtt.f32.f16 %1, %0\n\tvcvtb.f32.f16 %0, %0":"=&t" (bot1), "=t" (top1):"r" (in1));
+    __ASM volatile ("vmov %0, %2\n\tvcvtt.f32.f16 %1, %0\n\tvcvtb.f32.f16 %0, %0":"=&t" (bot2), "=t" (top2):"r" (in2));
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *pDst++ = bot1;
+    *pDst++ = top1;
+    *pDst++ = bot2;
+    *pDst++ = top2;
+
+#else
+
+    *pDst++ = top1;
+    *pDst++ = bot1;
+    *pDst++ = top2;
+    *pDst++ = bot2;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#elif !defined (ARM_MATH_CM0)
+
+  /* Run the below code for Cortex-M4 without FPU and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_f16_to_f32_scalar(*pIn++);
+    *pDst++ = arm_f16_to_f32_scalar(*pIn++);
+    *pDst++ = arm_f16_to_f32_scalar(*pIn++);
+    *pDst++ = arm_f16_to_f32_scalar(*pIn++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_F16_HW) */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_f16_to_f32_scalar(*pIn++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of f16_to_x group
+ */
@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_f32_to_f16.c
+*
+* Description:	Converts the elements of a floating-point vector to half-precision.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup float_to_x
+ * @{
+ */
+
+/**
+ * @brief  Converts the elements of a floating-point vector to half-precision.
+ * @param[in]       *pSrc points to the floating-point input vector
+ * @param[out]      *pDst points to the half-precision output vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par
+ * The values are rounded to nearest even.  The values above 65504 in magnitude become
+ * infinite, the ones below 2^-14 subnormal or zero.  On the Cortex-M4 with FPU
+ * <code>pDst</code> should be word aligned.
+ */
+
+void arm_f32_to_f16(
+  float32_t * pSrc,
+  float16_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Src pointer */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_F16_HW)
+
+  /* Run the below code for Cortex-M4 with FPU */
+
+  q31_t out1, out2;                              /* Two values per word */
+  float32_t tmp1, tmp2;                          /* Registers holding the halves */
+  float32_t in1, in2, in3, in4;                  /* Input values */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    in1 = *pIn++;
+    in2 = *pIn++;
+    in3 = *pIn++;
+    in4 = *pIn++;
+
+#else
+
+    in2 = *pIn++;
+    in1 = *pIn++;
+    in4 = *pIn++;
+    in3 = *pIn++;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* VCVTB writes the bottom half of the register, VCVTT the top half */
+    __ASM volatile ("vcvtb.f16.f32 %1, %2\n\tvcvtt.f16.f32 %1, %3\n\tvmov %0, %1":"=r" (out1), "=&t" (tmp1):"t" (in1), "t" (in2));
+    __ASM volatile ("vcvtb.f16.f32 %1, %2\n\tvcvtt.f16.f32 %1, %3\n\tvmov %0, %1":"=r" (out2), "=&t" (tmp2):"t" (in3), "t" (in4));
+
+    *__SIMD32(pDst)++ = out1;
+    *__SIMD32(pDst)++ = out2;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#elif !defined (ARM_MATH_CM0)
+
+  /* Run the below code for Cortex-M4 without FPU and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_f32_to_f16_scalar(*pIn++);
+    *pDst++ = arm_f32_to_f16_scalar(*pIn++);
+    *pDst++ = arm_f32_to_f16_scalar(*pIn++);
+    *pDst++ = arm_f32_to_f16_scalar(*pIn++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_F16_HW) */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_f32_to_f16_scalar(*pIn++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of float_to_x group
+ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_float_to_q15_dither.c
+*
+* Description:	Converts a floating-point vector to Q15 with a gain, an offset
+*               and a TPDF dither.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup ScaledConvert
+ * @{
+ */
+
+/**
+ * @brief Converts a floating-point vector to Q15 with a gain, an offset and a TPDF dither.
+ * @param[in]       *pSrc points to the floating-point input vector
+ * @param[in]       gain gain applied to the inputs
+ * @param[in]       offset offset added after the gain, in the floating-point range [-1 +1)
+ * @param[out]      *pDst points to the Q15 output vector, which may be <code>pSrc</code>
+ * @param[in,out]   *pSeed points to the state of the random generator, any value to start
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par Description:
+ * <pre>
+ *     pDst[n] = (q15_t) round((pSrc[n] * gain + offset) * 32768 + d[n]);   0 <= n < blockSize.
+ * </pre>
+ * where <code>d[n]</code> is the sum of two independent uniform variables in
+ * [-0.5 +0.5) LSB, which has a triangular density over [-1 +1) LSB. This dither makes
+ * the mean and the variance of the quantization error independent of the signal, at
+ * the cost of a noise floor raised by 4.8 dB over the undithered rounding.
+ * \par
+ * The uniform variables are the upper bits of two steps of the linear congruential
+ * generator <code>seed = seed * 1664525 + 1013904223</code>, whose state is kept in
+ * <code>*pSeed</code> from one block to the next.
+ * \par Scaling and Overflow Behavior:
+ * The results are saturated to the Q15 range [0x8000 0x7FFF].
+ */
+
+void arm_float_to_q15_dither(
+  float32_t * pSrc,
+  float32_t gain,
+  float32_t offset,
+  q15_t * pDst,
+  uint32_t * pSeed,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Src pointer */
+  float32_t g = gain * 32768.0f;                 /* Gain in Q15 units */
+  float32_t o = (offset * 32768.0f) + 32768.5f;  /* Offset in Q15 units, biased for the rounding */
+  uint32_t seed = *pSeed;                        /* State of the random generator */
+  uint32_t r1;                                   /* Random word */
+  float32_t d;                                   /* Dither */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2;                            /* Temporary input variables */
+  uint32_t r2;                                   /* Random word */
+  q31_t out1, out2;                              /* Temporary output variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time,
+   ** one packed word. A second step below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 2 inputs before the output, for the conversion in place */
+    in1 = *pIn++;
+    in2 = *pIn++;
+
+    /* d = (r1 + r2) * 2^-32, r1 and r2 being signed uniform words halved
+     * so that their sum does not overflow */
+    r1 = (seed * 1664525u) + 1013904223u;
+    r2 = (r1 * 1664525u) + 1013904223u;
+    d = (float32_t) (((int32_t) r1 >> 1) + ((int32_t) r2 >> 1)) * 4.656612873e-10f;
+    out1 = (q31_t) __USAT((q31_t) (((in1 * g) + o) + d), 16) - 32768;
+
+    r1 = (r2 * 1664525u) + 1013904223u;
+    seed = (r1 * 1664525u) + 1013904223u;
+    d = (float32_t) (((int32_t) r1 >> 1) + ((int32_t) seed >> 1)) * 4.656612873e-10f;
+    out2 = (q31_t) __USAT((q31_t) (((in2 * g) + o) + d), 16) - 32768;
+
+    /* Pack two 16-bit outputs in a 32-bit word and store */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(out1, out2, 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHBT(out2, out1, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is odd, compute the last output sample here. */
+  blkCnt = blockSize & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* TPDF dither of [-1 +1) LSB */
+    r1 = (seed * 1664525u) + 1013904223u;
+    seed = (r1 * 1664525u) + 1013904223u;
+    d = (float32_t) (((int32_t) r1 >> 1) + ((int32_t) seed >> 1)) * 4.656612873e-10f;
+
+    /* C = A * gain + offset + d */
+    /* convert to q15 and then store the result in the destination buffer */
+    *pDst++ = (q15_t) ((q31_t) __USAT((q31_t) (((*pIn++ * g) + o) + d), 16) - 32768);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the state of the random generator for the next block */
+  *pSeed = seed;
+}
+
+/**
+ * @} end of ScaledConvert group
+ */
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_float_to_q15_scaled.c
+*
+* Description:	Converts a floating-point vector to Q15 with a gain and an offset.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup ScaledConvert Convert with Gain and Offset
+ *
+ * A conversion to a fixed-point output stage is often written as three passes over
+ * the block: arm_scale_f32() for the gain, arm_float_to_q15() for the conversion and
+ * arm_offset_q15() for the offset. The functions of this group compute
+ * <pre>
+ *     pDst[n] = saturate(round((pSrc[n] * gain + offset) * 2^k))
+ * </pre>
+ * in a single pass, where <code>k</code> is 15 or 31 according to the output type. The
+ * gain and the offset are folded into one multiply-accumulate per sample, and on
+ * Cortex-M4 and Cortex-M3 the Q15 outputs are packed by pairs with <code>__PKHBT</code>
+ * and stored as 32-bit words.
+ *
+ * \par In-place operation:
+ * The narrowing conversions can be computed in place: <code>pDst</code> may point to the
+ * same buffer as <code>pSrc</code>, the outputs then occupying the first half, or the
+ * first quarter, of the bytes of the input. Every output is written after the inputs
+ * that share its memory have been read, so no second buffer is needed.
+ *
+ * \par Dither:
+ * arm_float_to_q15_dither() adds a triangular probability density (TPDF) dither of
+ * &plusmn;1 LSB before the rounding, for audio outputs where the quantization error of
+ * low level signals would otherwise be correlated with the signal.
+ */
+
+/**
+ * @addtogroup ScaledConvert
+ * @{
+ */
+
+/**
+ * @brief Converts a floating-point vector to Q15 with a gain and an offset.
+ * @param[in]       *pSrc points to the floating-point input vector
+ * @param[in]       gain gain applied to the inputs
+ * @param[in]       offset offset added after the gain, in the floating-point range [-1 +1)
+ * @param[out]      *pDst points to the Q15 output vector, which may be <code>pSrc</code>
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par Description:
+ * <pre>
+ *     pDst[n] = (q15_t) round((pSrc[n] * gain + offset) * 32768);   0 <= n < blockSize.
+ * </pre>
+ * \par Scaling and Overflow Behavior:
+ * The results are rounded to the nearest and saturated to the Q15 range [0x8000 0x7FFF].
+ */
+
+void arm_float_to_q15_scaled(
+  float32_t * pSrc,
+  float32_t gain,
+  float32_t offset,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Src pointer */
+  float32_t g = gain * 32768.0f;                 /* Gain in Q15 units */
+  float32_t o = (offset * 32768.0f) + 32768.5f;  /* Offset in Q15 units, biased for the rounding */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+  q31_t out1, out2, out3, out4;                  /* Temporary output variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The 4 inputs are read before the outputs are stored, which overwrite at most
+     * the memory of these inputs when the conversion is done in place */
+    in1 = *pIn++;
+    in2 = *pIn++;
+    in3 = *pIn++;
+    in4 = *pIn++;
+
+    /* C = A * gain + offset, biased by 32768.5: the truncation becomes a rounding to
+     * the nearest and the unsigned saturation to [0 65535] the saturation to Q15 */
+    out1 = (q31_t) __USAT((q31_t) ((in1 * g) + o), 16) - 32768;
+    out2 = (q31_t) __USAT((q31_t) ((in2 * g) + o), 16) - 32768;
+    out3 = (q31_t) __USAT((q31_t) ((in3 * g) + o), 16) - 32768;
+    out4 = (q31_t) __USAT((q31_t) ((in4 * g) + o), 16) - 32768;
+
+    /* Pack two 16-bit outputs in a 32-bit word and store */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(out1, out2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(out3, out4, 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHBT(out2, out1, 16);
+    *__SIMD32(pDst)++ = __PKHBT(out4, out3, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C = A * gain + offset */
+    /* convert to q15 and then store the result in the destination buffer */
+    *pDst++ = (q15_t) ((q31_t) __USAT((q31_t) ((*pIn++ * g) + o), 16) - 32768);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of ScaledConvert group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_float_to_q31_scaled.c
+*
+* Description:	Converts a floating-point vector to Q31 with a gain and an offset.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup ScaledConvert
+ * @{
+ */
+
+/**
+ * @brief Converts a floating-point vector to Q31 with a gain and an offset.
+ * @param[in]       *pSrc points to the floating-point input vector
+ * @param[in]       gain gain applied to the inputs
+ * @param[in]       offset offset added after the gain, in the floating-point range [-1 +1)
+ * @param[out]      *pDst points to the Q31 output vector, which may be <code>pSrc</code>
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par Description:
+ * <pre>
+ *     pDst[n] = (q31_t) ((pSrc[n] * gain + offset) * 2147483648);   0 <= n < blockSize.
+ * </pre>
+ * \par Scaling and Overflow Behavior:
+ * The results are saturated to the Q31 range [0x80000000 0x7FFFFFFF]. The 24-bit
+ * mantissa of the inputs makes a rounding of the last bits meaningless, so none is done.
+ */
+
+void arm_float_to_q31_scaled(
+  float32_t * pSrc,
+  float32_t gain,
+  float32_t offset,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Src pointer */
+  float32_t g = gain * 2147483648.0f;            /* Gain in Q31 units */
+  float32_t o = offset * 2147483648.0f;          /* Offset in Q31 units */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t in1, in2, in3, in4;                  /* Temporary input variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs before the outputs, for the conversion in place */
+    in1 = *pIn++;
+    in2 = *pIn++;
+    in3 = *pIn++;
+    in4 = *pIn++;
+
+    /* C = A * gain + offset */
+    /* convert to q31 and then store the results in the destination buffer */
+    *pDst++ = clip_q63_to_q31((q63_t) ((in1 * g) + o));
+    *pDst++ = clip_q63_to_q31((q63_t) ((in2 * g) + o));
+    *pDst++ = clip_q63_to_q31((q63_t) ((in3 * g) + o));
+    *pDst++ = clip_q63_to_q31((q63_t) ((in4 * g) + o));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C = A * gain + offset */
+    /* convert to q31 and then store the result in the destination buffer */
+    *pDst++ = clip_q63_to_q31((q63_t) ((*pIn++ * g) + o));
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of ScaledConvert group
+ */
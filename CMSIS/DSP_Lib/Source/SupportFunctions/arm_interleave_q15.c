@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_interleave_q15.c
+*
+* Description:	Merges planar Q15 channels into interleaved frames.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Merges planar Q15 channels into interleaved frames.
+ * @param[in]       **ppSrc points to an array of <code>numChannels</code> pointers to the input channels
+ * @param[out]      *pDst points to the <code>numFrames*numChannels</code> interleaved samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[in]       numFrames number of frames
+ * @return none.
+ *
+ * <pre>
+ *     pDst[n * numChannels + c] = ppSrc[c][n];   0 <= c < numChannels, 0 <= n < numFrames.
+ * </pre>
+ */
+
+void arm_interleave_q15(
+  q15_t ** ppSrc,
+  q15_t * pDst,
+  uint16_t numChannels,
+  uint32_t numFrames)
+{
+  q15_t *pS0, *pS1, *pS2, *pS3;                  /* Input channel pointers */
+  uint32_t blkCnt, ch;                           /* loop counters */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2, in3, in4;                      /* Two frames packed in words */
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  if(numChannels == 2u)
+  {
+    /* Two channels have the layout of complex samples */
+    arm_cmplx_interleave_q15(ppSrc[0], ppSrc[1], pDst, numFrames);
+  }
+  else if(numChannels == 4u)
+  {
+    pS0 = ppSrc[0];
+    pS1 = ppSrc[1];
+    pS2 = ppSrc[2];
+    pS3 = ppSrc[3];
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*loop Unrolling */
+    blkCnt = numFrames >> 1u;
+
+    /* Two frames at a time: each word of a channel holds one sample of each frame */
+    while(blkCnt > 0u)
+    {
+      in1 = *__SIMD32(pS0)++;
+      in2 = *__SIMD32(pS1)++;
+      in3 = *__SIMD32(pS2)++;
+      in4 = *__SIMD32(pS3)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      *__SIMD32(pDst)++ = __PKHBT(in1, in2, 16);
+      *__SIMD32(pDst)++ = __PKHBT(in3, in4, 16);
+      *__SIMD32(pDst)++ = __PKHTB(in2, in1, 16);
+      *__SIMD32(pDst)++ = __PKHTB(in4, in3, 16);
+
+#else
+
+      *__SIMD32(pDst)++ = __PKHTB(in1, in2, 16);
+      *__SIMD32(pDst)++ = __PKHTB(in3, in4, 16);
+      *__SIMD32(pDst)++ = __PKHBT(in2, in1, 16);
+      *__SIMD32(pDst)++ = __PKHBT(in4, in3, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* The last frame of an odd number of frames */
+    blkCnt = numFrames & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    blkCnt = numFrames;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    /* One frame of 4 samples at a time */
+    while(blkCnt > 0u)
+    {
+      *pDst++ = *pS0++;
+      *pDst++ = *pS1++;
+      *pDst++ = *pS2++;
+      *pDst++ = *pS3++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Any other number of channels, one strided copy per channel */
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      arm_copy_strided_q15(ppSrc[ch], 1u, pDst + ch, numChannels, numFrames);
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
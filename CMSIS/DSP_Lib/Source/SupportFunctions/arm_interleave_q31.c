@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_interleave_q31.c
+*
+* Description:	Merges planar Q31 channels into interleaved frames.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Interleave
+ * @{
+ */
+
+/**
+ * @brief Merges planar Q31 channels into interleaved frames.
+ * @param[in]       **ppSrc points to an array of <code>numChannels</code> pointers to the input channels
+ * @param[out]      *pDst points to the <code>numFrames*numChannels</code> interleaved samples
+ * @param[in]       numChannels number of channels of a frame
+ * @param[in]       numFrames number of frames
+ * @return none.
+ *
+ * <pre>
+ *     pDst[n * numChannels + c] = ppSrc[c][n];   0 <= c < numChannels, 0 <= n < numFrames.
+ * </pre>
+ */
+
+void arm_interleave_q31(
+  q31_t ** ppSrc,
+  q31_t * pDst,
+  uint16_t numChannels,
+  uint32_t numFrames)
+{
+  q31_t *pS0, *pS1, *pS2, *pS3;                  /* Input channel pointers */
+  uint32_t blkCnt, ch;                           /* loop counters */
+
+  if(numChannels == 2u)
+  {
+    /* Two channels have the layout of complex samples */
+    arm_cmplx_interleave_q31(ppSrc[0], ppSrc[1], pDst, numFrames);
+  }
+  else if(numChannels == 4u)
+  {
+    pS0 = ppSrc[0];
+    pS1 = ppSrc[1];
+    pS2 = ppSrc[2];
+    pS3 = ppSrc[3];
+
+    blkCnt = numFrames;
+
+    /* One frame of 4 samples at a time */
+    while(blkCnt > 0u)
+    {
+      *pDst++ = *pS0++;
+      *pDst++ = *pS1++;
+      *pDst++ = *pS2++;
+      *pDst++ = *pS3++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+  }
+  else
+  {
+    /* Any other number of channels, one strided copy per channel */
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      arm_copy_strided_q31(ppSrc[ch], 1u, pDst + ch, numChannels, numFrames);
+    }
+  }
+}
+
+/**
+ * @} end of Interleave group
+ */
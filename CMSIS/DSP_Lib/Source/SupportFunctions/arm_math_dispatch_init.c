@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_math_dispatch_init.c
+*
+* Description:	Selection of the kernel variants at run time.
+*
+* Target Processor: Cortex-M4/Cortex-M3
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Dispatch Kernel Selection at Run Time
+ *
+ * A library build targets one processor: ARM_MATH_CM4 uses the DSP instructions and,
+ * with <code>__FPU_PRESENT</code>, the floating-point unit, which a Cortex-M3 cannot
+ * execute, and ARM_MATH_CM3 leaves the Cortex-M4 instructions unused. An image meant
+ * for both, such as one firmware for STM32F1, STM32F2 and STM32F4 boards, can link the
+ * two variants of the most used kernels and select them at startup:
+ *
+ * - the library is built for Cortex-M3 with ARM_MATH_DISPATCH added, which compiles
+ *   arm_math_dispatch_init() with the references to both variants;
+ * - the source files of the kernels of arm_math_dispatch_table are built a second time
+ *   with ARM_MATH_CM3 and ARM_MATH_DISPATCH_CM3, and a third time with ARM_MATH_CM4,
+ *   <code>__FPU_PRESENT = 1</code> and ARM_MATH_DISPATCH_CM4, and the Cortex-M4
+ *   options of the compiler. arm_math.h adds the suffix <code>_cm3</code> or
+ *   <code>_cm4</code> to their names.
+ *
+ * All the objects must use the same calling convention: with GCC, the Cortex-M4
+ * variant is compiled with <code>-mfloat-abi=softfp</code>, which passes the
+ * floating-point arguments in the integer registers like the Cortex-M3 code.
+ *
+ * arm_math_dispatch_init() reads the part number of the processor in the CPUID
+ * register and, on a Cortex-M4, the presence of the floating-point unit in MVFR0,
+ * which it then enables. It fills a table with the Cortex-M4 variants of the
+ * fixed-point kernels on a Cortex-M4, of the floating-point kernels if the unit is
+ * present, and with the Cortex-M3 variants otherwise. The selection is meant to be
+ * done once, at the creation of a processing instance, by keeping the function pointer
+ * next to the instance:
+ * <pre>
+ *     arm_math_dispatch_init(&kernels);
+ *     arm_fir_init_q15(&S, numTaps, pCoeffs, pState, blockSize);
+ *     firProcess = kernels.fir_q15;
+ *     ...
+ *     firProcess(&S, pSrc, pDst, blockSize);
+ * </pre>
+ *
+ * Without ARM_MATH_DISPATCH, the table is filled with the kernels of the library build
+ * and the function only checks that the processor can execute them.
+ */
+
+/**
+ * @addtogroup Dispatch
+ * @{
+ */
+
+/* System control registers, not declared with __CMSIS_GENERIC */
+#define DISPATCH_CPUID          (*(volatile uint32_t *) 0xE000ED00u)
+#define DISPATCH_CPACR          (*(volatile uint32_t *) 0xE000ED88u)
+#define DISPATCH_MVFR0          (*(volatile uint32_t *) 0xE000EF40u)
+
+/* Part numbers of the CPUID register */
+#define DISPATCH_PARTNO_CM3     0xC23u
+#define DISPATCH_PARTNO_CM4     0xC24u
+
+/* Full access to the coprocessors CP10 and CP11, the floating-point unit */
+#define DISPATCH_CPACR_FPU      (0xFu << 20)
+
+#if defined (ARM_MATH_DISPATCH)
+
+/* Both variants of each kernel */
+#define DISPATCH_DECLARE(ret, f, args)  ret f##_cm3 args; ret f##_cm4 args
+
+DISPATCH_DECLARE(void, arm_fir_f32, (const arm_fir_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize));
+DISPATCH_DECLARE(void, arm_fir_q31, (const arm_fir_instance_q31 * S, q31_t * pSrc, q31_t * pDst, uint32_t blockSize));
+DISPATCH_DECLARE(void, arm_fir_q15, (const arm_fir_instance_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize));
+DISPATCH_DECLARE(void, arm_fir_fast_q15, (const arm_fir_instance_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize));
+DISPATCH_DECLARE(void, arm_biquad_cascade_df1_f32, (const arm_biquad_casd_df1_inst_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize));
+DISPATCH_DECLARE(void, arm_biquad_cascade_df1_q31, (const arm_biquad_casd_df1_inst_q31 * S, q31_t * pSrc, q31_t * pDst, uint32_t blockSize));
+DISPATCH_DECLARE(void, arm_biquad_cascade_df1_q15, (const arm_biquad_casd_df1_inst_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize));
+DISPATCH_DECLARE(void, arm_dot_prod_f32, (float32_t * pSrcA, float32_t * pSrcB, uint32_t blockSize, float32_t * result));
+DISPATCH_DECLARE(void, arm_dot_prod_q31, (q31_t * pSrcA, q31_t * pSrcB, uint32_t blockSize, q63_t * result));
+DISPATCH_DECLARE(void, arm_dot_prod_q15, (q15_t * pSrcA, q15_t * pSrcB, uint32_t blockSize, q63_t * result));
+DISPATCH_DECLARE(arm_status, arm_mat_mult_f32, (const arm_matrix_instance_f32 * pSrcA, const arm_matrix_instance_f32 * pSrcB, arm_matrix_instance_f32 * pDst));
+DISPATCH_DECLARE(arm_status, arm_mat_mult_q15, (const arm_matrix_instance_q15 * pSrcA, const arm_matrix_instance_q15 * pSrcB, arm_matrix_instance_q15 * pDst, q15_t * pState));
+
+/* Selection of the variant v of a kernel */
+#define DISPATCH_SET(D, k, v)   (D)->k = arm_##k##_##v
+
+#endif /* #if defined (ARM_MATH_DISPATCH) */
+
+/**
+ * @brief  Selects the kernel variants for the processor that runs the code.
+ * @param[out]      *D points to the table of kernels to fill
+ * @return ARM_MATH_SUCCESS on a Cortex-M3 or a Cortex-M4, ARM_MATH_ARGUMENT_ERROR on another processor.
+ *
+ * Without ARM_MATH_DISPATCH, ARM_MATH_ARGUMENT_ERROR is also returned when the
+ * processor cannot execute the library build. The table is not modified when an
+ * error is returned.
+ */
+
+arm_status arm_math_dispatch_init(
+  arm_math_dispatch_table * D)
+{
+  uint32_t partNo;                               /* Part number of the processor */
+  uint32_t features;                             /* Detected features */
+
+  partNo = (DISPATCH_CPUID >> 4) & 0xFFFu;
+
+  if(partNo == DISPATCH_PARTNO_CM4)
+  {
+    features = ARM_MATH_FEATURE_CM4;
+
+    /* MVFR0 reads as zero without a floating-point unit */
+    if(DISPATCH_MVFR0 != 0u)
+    {
+      features |= ARM_MATH_FEATURE_FPU;
+
+      /* Enable the unit before any floating-point kernel runs */
+      DISPATCH_CPACR |= DISPATCH_CPACR_FPU;
+      __DSB();
+      __ISB();
+    }
+  }
+  else if(partNo == DISPATCH_PARTNO_CM3)
+  {
+    features = ARM_MATH_FEATURE_CM3;
+  }
+  else
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+#if defined (ARM_MATH_DISPATCH)
+
+  /* Fixed-point kernels: the DSP instructions of the Cortex-M4 */
+  if((features & ARM_MATH_FEATURE_CM4) != 0u)
+  {
+    DISPATCH_SET(D, fir_q31, cm4);
+    DISPATCH_SET(D, fir_q15, cm4);
+    DISPATCH_SET(D, fir_fast_q15, cm4);
+    DISPATCH_SET(D, biquad_cascade_df1_q31, cm4);
+    DISPATCH_SET(D, biquad_cascade_df1_q15, cm4);
+    DISPATCH_SET(D, dot_prod_q31, cm4);
+    DISPATCH_SET(D, dot_prod_q15, cm4);
+    DISPATCH_SET(D, mat_mult_q15, cm4);
+  }
+  else
+  {
+    DISPATCH_SET(D, fir_q31, cm3);
+    DISPATCH_SET(D, fir_q15, cm3);
+    DISPATCH_SET(D, fir_fast_q15, cm3);
+    DISPATCH_SET(D, biquad_cascade_df1_q31, cm3);
+    DISPATCH_SET(D, biquad_cascade_df1_q15, cm3);
+    DISPATCH_SET(D, dot_prod_q31, cm3);
+    DISPATCH_SET(D, dot_prod_q15, cm3);
+    DISPATCH_SET(D, mat_mult_q15, cm3);
+  }
+
+  /* Floating-point kernels: the floating-point unit of the Cortex-M4 */
+  if((features & ARM_MATH_FEATURE_FPU) != 0u)
+  {
+    DISPATCH_SET(D, fir_f32, cm4);
+    DISPATCH_SET(D, biquad_cascade_df1_f32, cm4);
+    DISPATCH_SET(D, dot_prod_f32, cm4);
+    DISPATCH_SET(D, mat_mult_f32, cm4);
+  }
+  else
+  {
+    DISPATCH_SET(D, fir_f32, cm3);
+    DISPATCH_SET(D, biquad_cascade_df1_f32, cm3);
+    DISPATCH_SET(D, dot_prod_f32, cm3);
+    DISPATCH_SET(D, mat_mult_f32, cm3);
+  }
+
+#else
+
+  /* Single variant: check that the processor can execute it */
+#if defined (ARM_MATH_CM4)
+
+  if((features & ARM_MATH_FEATURE_CM4) == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+#if (__FPU_USED == 1)
+
+  if((features & ARM_MATH_FEATURE_FPU) == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+#endif /* #if (__FPU_USED == 1) */
+
+#endif /* #if defined (ARM_MATH_CM4) */
+
+  D->fir_f32 = arm_fir_f32;
+  D->fir_q31 = arm_fir_q31;
+  D->fir_q15 = arm_fir_q15;
+  D->fir_fast_q15 = arm_fir_fast_q15;
+  D->biquad_cascade_df1_f32 = arm_biquad_cascade_df1_f32;
+  D->biquad_cascade_df1_q31 = arm_biquad_cascade_df1_q31;
+  D->biquad_cascade_df1_q15 = arm_biquad_cascade_df1_q15;
+  D->dot_prod_f32 = arm_dot_prod_f32;
+  D->dot_prod_q31 = arm_dot_prod_q31;
+  D->dot_prod_q15 = arm_dot_prod_q15;
+  D->mat_mult_f32 = arm_mat_mult_f32;
+  D->mat_mult_q15 = arm_mat_mult_q15;
+
+#endif /* #if defined (ARM_MATH_DISPATCH) */
+
+  D->features = features;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Dispatch group
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_q31_to_q15_scaled.c
+*
+* Description:	Converts a Q31 vector to Q15 with a gain and an offset.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup ScaledConvert
+ * @{
+ */
+
+/**
+ * @brief Converts a Q31 vector to Q15 with a gain and an offset.
+ * @param[in]       *pSrc points to the Q31 input vector
+ * @param[in]       scaleFract fractional portion of the gain
+ * @param[in]       shift number of bits to shift the result by, in the range [-15 15]
+ * @param[in]       offset Q15 offset added after the gain
+ * @param[out]      *pDst points to the Q15 output vector, which may be <code>pSrc</code>
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * \par Description:
+ * The gain is <code>scaleFract * 2^shift</code>, as in arm_scale_q31():
+ * <pre>
+ *     pDst[n] = (q15_t) round(pSrc[n] * scaleFract * 2^shift / 2^16) + offset;   0 <= n < blockSize.
+ * </pre>
+ * \par Scaling and Overflow Behavior:
+ * The product of the input and of <code>scaleFract</code> is kept in 64 bits and shifted
+ * once to the Q15 format with a rounding to the nearest, so the gain loses no precision
+ * before the narrowing. The sum with the offset is saturated to the Q15 range
+ * [0x8000 0x7FFF].
+ */
+
+void arm_q31_to_q15_scaled(
+  q31_t * pSrc,
+  q31_t scaleFract,
+  int8_t shift,
+  q15_t offset,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pIn = pSrc;                             /* Src pointer */
+  q63_t rnd = (q63_t) 1 << (46 - shift);         /* Rounding constant of the shift to Q15 */
+  uint32_t rShift = 15u - (uint32_t) (int32_t) shift;   /* Shift of the upper word of the product */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  q31_t in1, in2, in3, in4;                      /* Temporary input variables */
+  q31_t out1, out2, out3, out4;                  /* Temporary output variables */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Read the 4 inputs before the outputs, for the conversion in place */
+    in1 = *pIn++;
+    in2 = *pIn++;
+    in3 = *pIn++;
+    in4 = *pIn++;
+
+    /* C = A * scale >> (47 - shift) + offset, the upper word of the rounded
+     * 64-bit product being shifted by the remaining 15 - shift bits */
+    out1 = (q31_t) ((rnd + ((q63_t) in1 * scaleFract)) >> 32) >> rShift;
+    out2 = (q31_t) ((rnd + ((q63_t) in2 * scaleFract)) >> 32) >> rShift;
+    out3 = (q31_t) ((rnd + ((q63_t) in3 * scaleFract)) >> 32) >> rShift;
+    out4 = (q31_t) ((rnd + ((q63_t) in4 * scaleFract)) >> 32) >> rShift;
+
+    out1 = __SSAT(out1 + offset, 16);
+    out2 = __SSAT(out2 + offset, 16);
+    out3 = __SSAT(out3 + offset, 16);
+    out4 = __SSAT(out4 + offset, 16);
+
+    /* Pack two 16-bit outputs in a 32-bit word and store */
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    *__SIMD32(pDst)++ = __PKHBT(out1, out2, 16);
+    *__SIMD32(pDst)++ = __PKHBT(out3, out4, 16);
+
+#else
+
+    *__SIMD32(pDst)++ = __PKHBT(out2, out1, 16);
+    *__SIMD32(pDst)++ = __PKHBT(out4, out3, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+  while(blkCnt > 0u)
+  {
+    /* C = A * scale >> (47 - shift) + offset */
+    /* convert to q15 and then store the result in the destination buffer */
+    *pDst++ = (q15_t) __SSAT(((q31_t) ((rnd + ((q63_t) * pIn++ * scaleFract)) >> 32) >>
+                              rShift) + offset, 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of ScaledConvert group
+ */
@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_ram_arena_alloc.c
+*
+* Description:	Scratch allocation from a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup RAMArena
+ * @{
+ */
+
+/**
+ * @brief  Allocates an uninitialized buffer from a RAM arena.
+ * @param[in,out] *S        points to an instance of the RAM arena structure.
+ * @param[in]     numBytes  number of bytes to allocate.
+ * @return        pointer to the buffer, aligned on 8 bytes, or NULL when the arena is too small
+ * or plans the memory.
+ *
+ * \par
+ * The arena can also hold the scratch buffers of a processing chain, such as the
+ * intermediate activations between the layers of a neural network. The allocations
+ * are released in the reverse order of their allocation by arm_ram_arena_release(), to
+ * the value of <code>S->used</code> saved before them:
+ * <pre>
+ *     uint32_t mark = A.used;
+ *     q15_t *pHidden = (q15_t *) arm_ram_arena_alloc(&A, 64u * sizeof(q15_t));
+ *
+ *     arm_nn_fc_q7_q15(pInput, pW1, pB1, 40u, 64u, 0u, 7u, pHidden);
+ *     arm_nn_relu_q15(pHidden, 64u);
+ *     arm_nn_fc_q7_q15(pHidden, pW2, pB2, 64u, 8u, 0u, 7u, pOutput);
+ *
+ *     arm_ram_arena_release(&A, mark);
+ * </pre>
+ */
+
+void *arm_ram_arena_alloc(
+  arm_ram_arena_instance * S,
+  uint32_t numBytes)
+{
+  uint8_t *pDst;                                 /* Points to the buffer */
+  uint32_t pad;                                  /* Bytes skipped to align the buffer */
+  uint32_t limit;                                /* End of the allocations: start of the shared scratch */
+
+  if(S->pBase == NULL)
+  {
+    /* Planning arena: only the size is counted, for a base aligned on 8 bytes */
+    S->used += ((0u - S->used) & 0x7u) + numBytes;
+
+    return (NULL);
+  }
+
+  /* Align the buffer on 8 bytes, for the 64-bit accesses of the double word loads */
+  pad = (0u - (uint32_t) (uintptr_t) (S->pBase + S->used)) & 0x7u;
+  limit = S->size - S->scratch;
+
+  if((S->used + pad > limit) || (numBytes > limit - (S->used + pad)))
+  {
+    return (NULL);
+  }
+
+  pDst = S->pBase + S->used + pad;
+
+  S->used += pad + numBytes;
+
+  return (pDst);
+}
+
+/**
+ * @brief  Releases the allocations made from a RAM arena after a mark.
+ * @param[in,out] *S     points to an instance of the RAM arena structure.
+ * @param[in]     mark   value of <code>S->used</code> saved before the allocations to release.
+ * @return        none.
+ */
+
+void arm_ram_arena_release(
+  arm_ram_arena_instance * S,
+  uint32_t mark)
+{
+  if(mark < S->used)
+  {
+    S->used = mark;
+  }
+}
+
+/**
+ * @} end of RAMArena group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_ram_arena_init.c
+*
+* Description:	Initialization function for a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup RAMArena Staging in Fast RAM
+ *
+ * Coefficient tables are usually const, so they are read from flash, through the
+ * wait states of the flash and the prefetch buffer, by filters that read every
+ * coefficient for every sample. Copying the coefficients and the states of the filters
+ * that run most often into a RAM with no wait state, such as the 64 KB CCM data RAM of
+ * the STM32F4, removes these stalls and the contention with the DMA on the bus matrix.
+ *
+ * A RAM arena is a buffer provided by the application, typically declared with
+ * ARM_CCM_DATA, from which the staging functions of the filters, such as
+ * arm_fir_stage_f32() or arm_biquad_cascade_df1_stage_q31(), allocate the copies and
+ * rebind the pointers of an instance to them:
+ * <pre>
+ *     static uint64_t arena[2048] ARM_CCM_DATA;
+ *     arm_ram_arena_instance A;
+ *
+ *     arm_ram_arena_init(&A, arena, sizeof(arena));
+ *     arm_fir_init_f32(&S, numTaps, firCoeffs, firState, blockSize);
+ *     if(arm_fir_stage_f32(&S, &A, blockSize) != ARM_MATH_SUCCESS)
+ *     {
+ *         ...  the filter keeps running from its original buffers
+ *     }
+ * </pre>
+ * Each copy is aligned on 8 bytes. The arena grows like a stack: the allocations are
+ * released all together by calling arm_ram_arena_init() again, or down to a saved mark
+ * by arm_ram_arena_release(), and arm_ram_arena_alloc() provides uninitialized scratch
+ * buffers from the same memory.
+ *
+ * \par
+ * The CCM data RAM is not accessible to the DMA. Buffers written or read by the DMA must
+ * stay in SRAM, and only coefficients and states should be staged in CCM.
+ *
+ * \par Creating the instances in an arena
+ * The create functions, such as arm_fir_create_f32() or arm_lms_norm_create_q15(), take
+ * the same arguments as the initialization functions except the state, which they
+ * allocate from the arena with the size required by the instance. The sizes are also
+ * given by macros such as ARM_FIR_STATE_SIZE(), to declare buffers statically.
+ *
+ * \par
+ * Scratch buffers, such as the ones of the sparse FIR filters, hold nothing from one call
+ * to the next. The kernels that never run at the same time, for example the ones called
+ * one after the other by the same task, can share a single buffer returned by
+ * arm_ram_arena_scratch(): it is placed at the end of the arena and grows to the largest
+ * size requested, so it costs the largest scratch rather than the sum of them.
+ *
+ * \par
+ * An arena initialized with a NULL base plans the memory: the create functions and
+ * arm_ram_arena_scratch() count the sizes without initializing anything, and
+ * arm_ram_arena_required() returns the size of the arena to provide:
+ * <pre>
+ *     arm_ram_arena_init(&A, NULL, 0u);
+ *     arm_fir_create_f32(&S1, 64u, firCoeffs, 32u, &A);
+ *     arm_biquad_cascade_df1_create_f32(&S2, 4u, iirCoeffs, &A);
+ *     arm_ram_arena_scratch(&A, 32u * sizeof(float32_t));
+ *     size = arm_ram_arena_required(&A);
+ * </pre>
+ * The sizes assume an arena aligned on 8 bytes, such as an array of uint64_t.
+ */
+
+/**
+ * @addtogroup RAMArena
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for a RAM arena.
+ * @param[in,out] *S     points to an instance of the RAM arena structure.
+ * @param[in]     *pBase points to the memory of the arena, or NULL to plan the memory.
+ * @param[in]     size   size of the arena in bytes.
+ * @return        none.
+ */
+
+void arm_ram_arena_init(
+  arm_ram_arena_instance * S,
+  void *pBase,
+  uint32_t size)
+{
+  S->pBase = (uint8_t *) pBase;
+  S->size = size;
+  S->used = 0u;
+  S->scratch = 0u;
+}
+
+/**
+ * @} end of RAMArena group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_ram_arena_scratch.c
+*
+* Description:	Shared scratch buffer and memory planning of a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup RAMArena
+ * @{
+ */
+
+/**
+ * @brief  Returns the scratch buffer shared by the kernels using a RAM arena.
+ * @param[in,out] *S        points to an instance of the RAM arena structure.
+ * @param[in]     numBytes  number of bytes needed by the kernel.
+ * @return        pointer to the buffer, aligned on 8 bytes, or NULL when the arena is too small
+ * or plans the memory.
+ *
+ * \par
+ * The buffer is placed at the end of the arena, below which arm_ram_arena_alloc() does not
+ * allocate, and grows downwards to the largest size requested: a buffer returned
+ * earlier stays inside it. Its content is not kept, so the kernels sharing it must not run
+ * at the same time, or be interrupted by one another:
+ * <pre>
+ *     pScratchIn = (float32_t *) arm_ram_arena_scratch(&A, blockSize * sizeof(float32_t));
+ *     arm_fir_sparse_f32(&S, pSrc, pDst, pScratchIn, blockSize);
+ * </pre>
+ * The buffer is released with the other allocations by arm_ram_arena_init() only.
+ */
+
+void *arm_ram_arena_scratch(
+  arm_ram_arena_instance * S,
+  uint32_t numBytes)
+{
+  uint8_t *pEnd;                                 /* End of the arena */
+  uint32_t scratch;                              /* Bytes of the buffer, with its alignment */
+
+  if(S->pBase == NULL)
+  {
+    /* Planning arena: the largest size is counted */
+    scratch = ARM_RAM_ARENA_ALIGN(numBytes);
+
+    if(scratch > S->scratch)
+    {
+      S->scratch = scratch;
+    }
+
+    return (NULL);
+  }
+
+  if(numBytes > S->size - S->used)
+  {
+    return (NULL);
+  }
+
+  /* Start of the buffer aligned down on 8 bytes */
+  pEnd = S->pBase + S->size;
+  scratch = numBytes + ((uint32_t) (uintptr_t) (pEnd - numBytes) & 0x7u);
+
+  if(scratch > S->scratch)
+  {
+    if(scratch > S->size - S->used)
+    {
+      return (NULL);
+    }
+
+    S->scratch = scratch;
+  }
+
+  return (pEnd - S->scratch);
+}
+
+/**
+ * @brief  Returns the size of the arena used by the allocations and the shared scratch.
+ * @param[in] *S points to an instance of the RAM arena structure.
+ * @return    number of bytes. For an arena planning the memory, the size of the arena to
+ * provide, aligned on 8 bytes.
+ */
+
+uint32_t arm_ram_arena_required(
+  const arm_ram_arena_instance * S)
+{
+  return (ARM_RAM_ARENA_ALIGN(S->used) + S->scratch);
+}
+
+/**
+ * @} end of RAMArena group
+ */
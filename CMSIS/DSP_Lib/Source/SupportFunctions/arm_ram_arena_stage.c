@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_ram_arena_stage.c
+*
+* Description:	Copies a buffer into a RAM arena.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup RAMArena
+ * @{
+ */
+
+/**
+ * @brief  Copies a buffer into a RAM arena.
+ * @param[in,out] *S        points to an instance of the RAM arena structure.
+ * @param[in]     *pSrc     points to the buffer to copy, or NULL to clear the allocated bytes.
+ * @param[in]     numBytes  number of bytes to copy.
+ * @return        pointer to the copy, aligned on 8 bytes, or NULL when the arena is too small.
+ */
+
+void *arm_ram_arena_stage(
+  arm_ram_arena_instance * S,
+  const void *pSrc,
+  uint32_t numBytes)
+{
+  uint8_t *pDst;                                 /* Points to the copy */
+
+  pDst = (uint8_t *) arm_ram_arena_alloc(S, numBytes);
+
+  if(pDst == NULL)
+  {
+    return (NULL);
+  }
+
+  if(pSrc != NULL)
+  {
+    memcpy(pDst, pSrc, numBytes);
+  }
+  else
+  {
+    memset(pDst, 0, numBytes);
+  }
+
+  return (pDst);
+}
+
+/**
+ * @} end of RAMArena group
+ */
@@ -0,0 +1,366 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_f32.c
+*
+* Description:	Mixed Radix-8/4/2 Decimation in Frequency Floating-point CFFT & CIFFT
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static __INLINE void arm_radix8_bfly_f32(
+  float32_t * pSrc,
+  uint32_t stride,
+  const float32_t * pCoef);
+
+static void arm_radix8_butterfly_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  const float32_t * pCoef);
+
+static void arm_cfft_bitreversal_f32(
+  float32_t * pSrc,
+  uint16_t bitRevLen,
+  const uint16_t * pBitRevTab);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Mixed_CFFT_CIFFT Mixed Radix Complex FFT Functions
+ *
+ * \par
+ * Complex Fast Fourier Transform(CFFT) and Complex Inverse Fast Fourier Transform(CIFFT)
+ * of all the power of two lengths from 16 to 4096, where the radix-4 functions only take
+ * the powers of four.
+ *
+ * \par
+ * The transform runs radix-8 stages as long as the length allows, then one radix-4 or
+ * radix-2 stage for the lengths that are not a power of eight: 2048 = 8 x 8 x 8 x 4.
+ * Each radix-8 butterfly merges three radix-2 stages, so the data is read and written
+ * three times less than by the radix-2 functions and the twiddle multiplications are
+ * cut by the same factor. The twiddles of each length are laid out stage after stage
+ * in the order they are read, and the bit reversal swaps the pairs of a table computed
+ * beforehand, with no index arithmetic left at run time.
+ *
+ * \par
+ * The input and output are interleaved complex values, processed in-place:
+ * <pre>{real[0], imag[0], real[1], imag[1],..} </pre>
+ *
+ * \par
+ * The CIFFT conjugates the input and output of the CFFT and scales the output by
+ * 1/fftLen.
+ *
+ * \par Instance Structure
+ * A separate instance structure must be defined for each transform, initialized by
+ * arm_cfft_init_f32().
+ */
+
+/**
+ * @addtogroup Mixed_CFFT_CIFFT
+ * @{
+ */
+
+/**
+ * @details
+ * @brief Processing function for the floating-point mixed radix CFFT/CIFFT.
+ * @param[in]      *S    points to an instance of the floating-point mixed radix CFFT/CIFFT structure.
+ * @param[in, out] *pSrc points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @return none.
+ */
+
+void arm_cfft_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * pSrc)
+{
+  float32_t *pIn;
+  uint32_t i;
+
+  if(S->ifftFlag == 1u)
+  {
+    /*  Conjugate the input */
+    pIn = pSrc + 1u;
+    for (i = 0u; i < S->fftLen; i++)
+    {
+      *pIn = -*pIn;
+      pIn += 2u;
+    }
+  }
+
+  /*  Radix-8 stages, then the radix-4 or radix-2 stage if any */
+  arm_radix8_butterfly_f32(pSrc, S->fftLen, S->pTwiddle);
+
+  if(S->bitReverseFlag == 1u)
+  {
+    /*  Bit Reversal */
+    arm_cfft_bitreversal_f32(pSrc, S->bitRevLength, S->pBitRevTable);
+  }
+
+  if(S->ifftFlag == 1u)
+  {
+    /*  Conjugate and scale the output */
+    pIn = pSrc;
+    for (i = 0u; i < S->fftLen; i++)
+    {
+      pIn[0] = pIn[0] * S->onebyfftLen;
+      pIn[1] = -pIn[1] * S->onebyfftLen;
+      pIn += 2u;
+    }
+  }
+}
+
+/**
+ * @} end of Mixed_CFFT_CIFFT group
+ */
+
+/*
+ * @brief  Radix-8 DIF butterfly on x[m] = pSrc[2*m*stride], m = 0..7.
+ * @param[in, out] *pSrc   points to x[0].
+ * @param[in]      stride  distance between the inputs, in complex values.
+ * @param[in]      *pCoef  points to the twiddles W^q, q = 1..7, 0 for none.
+ * @return none.
+ *
+ * The output X[q] is written to slot bitrev3(q), so that the stages leave the
+ * whole transform in bit reversed order as the radix-2 stages do.
+ */
+
+static __INLINE void arm_radix8_bfly_f32(
+  float32_t * pSrc,
+  uint32_t stride,
+  const float32_t * pCoef)
+{
+  float32_t *p0, *p1, *p2, *p3, *p4, *p5, *p6, *p7;
+  float32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+  float32_t a4r, a4i, a5r, a5i, a6r, a6i, a7r, a7i;
+  float32_t e0r, e0i, e1r, e1i, e2r, e2i, e3r, e3i;
+  float32_t o0r, o0i, o1r, o1i, o2r, o2i, o3r, o3i;
+  float32_t t1r, t1i, t3r, t3i;
+  float32_t x[16];
+  float32_t c, s;
+  uint32_t q;
+
+  p0 = pSrc;
+  p1 = p0 + (2u * stride);
+  p2 = p1 + (2u * stride);
+  p3 = p2 + (2u * stride);
+  p4 = p3 + (2u * stride);
+  p5 = p4 + (2u * stride);
+  p6 = p5 + (2u * stride);
+  p7 = p6 + (2u * stride);
+
+  /*  Length-2 butterflies of x[m], x[m+4] */
+  a0r = p0[0] + p4[0];
+  a0i = p0[1] + p4[1];
+  a1r = p0[0] - p4[0];
+  a1i = p0[1] - p4[1];
+  a2r = p2[0] + p6[0];
+  a2i = p2[1] + p6[1];
+  a3r = p2[0] - p6[0];
+  a3i = p2[1] - p6[1];
+  a4r = p1[0] + p5[0];
+  a4i = p1[1] + p5[1];
+  a5r = p1[0] - p5[0];
+  a5i = p1[1] - p5[1];
+  a6r = p3[0] + p7[0];
+  a6i = p3[1] + p7[1];
+  a7r = p3[0] - p7[0];
+  a7i = p3[1] - p7[1];
+
+  /*  4 point DFTs of the even and odd inputs */
+  e0r = a0r + a2r;
+  e0i = a0i + a2i;
+  e2r = a0r - a2r;
+  e2i = a0i - a2i;
+  e1r = a1r + a3i;
+  e1i = a1i - a3r;
+  e3r = a1r - a3i;
+  e3i = a1i + a3r;
+
+  o0r = a4r + a6r;
+  o0i = a4i + a6i;
+  o2r = a4r - a6r;
+  o2i = a4i - a6i;
+  o1r = a5r + a7i;
+  o1i = a5i - a7r;
+  o3r = a5r - a7i;
+  o3i = a5i + a7r;
+
+  /*  Odd outputs times W8^1, W8^2 = -j and W8^3 */
+  t1r = (o1r + o1i) * 0.707106781186548f;
+  t1i = (o1i - o1r) * 0.707106781186548f;
+  t3r = (o3i - o3r) * 0.707106781186548f;
+  t3i = -(o3i + o3r) * 0.707106781186548f;
+
+  /*  X[q] in x[2q], x[2q+1] */
+  x[0] = e0r + o0r;
+  x[1] = e0i + o0i;
+  x[8] = e0r - o0r;
+  x[9] = e0i - o0i;
+  x[2] = e1r + t1r;
+  x[3] = e1i + t1i;
+  x[10] = e1r - t1r;
+  x[11] = e1i - t1i;
+  x[4] = e2r + o2i;
+  x[5] = e2i - o2r;
+  x[12] = e2r - o2i;
+  x[13] = e2i + o2r;
+  x[6] = e3r + t3r;
+  x[7] = e3i + t3i;
+  x[14] = e3r - t3r;
+  x[15] = e3i - t3i;
+
+  if(pCoef != 0)
+  {
+    /*  X[q] * (cos - j sin) */
+    for (q = 1u; q < 8u; q++)
+    {
+      c = pCoef[2u * (q - 1u)];
+      s = pCoef[(2u * (q - 1u)) + 1u];
+      t1r = x[2u * q];
+      t1i = x[(2u * q) + 1u];
+      x[2u * q] = (t1r * c) + (t1i * s);
+      x[(2u * q) + 1u] = (t1i * c) - (t1r * s);
+    }
+  }
+
+  /*  Slot p gets X[bitrev3(p)] */
+  p0[0] = x[0];
+  p0[1] = x[1];
+  p1[0] = x[8];
+  p1[1] = x[9];
+  p2[0] = x[4];
+  p2[1] = x[5];
+  p3[0] = x[12];
+  p3[1] = x[13];
+  p4[0] = x[2];
+  p4[1] = x[3];
+  p5[0] = x[10];
+  p5[1] = x[11];
+  p6[0] = x[6];
+  p6[1] = x[7];
+  p7[0] = x[14];
+  p7[1] = x[15];
+}
+
+/*
+ * @brief  Stages of the mixed radix CFFT.
+ * @param[in, out] *pSrc   points to the in-place buffer.
+ * @param[in]      fftLen  length of the FFT.
+ * @param[in]      *pCoef  points to the twiddles of the radix-8 stages.
+ * @return none.
+ */
+
+static void arm_radix8_butterfly_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  const float32_t * pCoef)
+{
+  float32_t *p;
+  float32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+  uint32_t n1, n2, i, j;
+
+  /*  Radix-8 stages of span n1, the butterflies n2 = n1/8 apart */
+  n1 = fftLen;
+  while(n1 >= 8u)
+  {
+    n2 = n1 >> 3u;
+
+    /*  j = 0: all the twiddles are 1 */
+    for (i = 0u; i < fftLen; i += n1)
+    {
+      arm_radix8_bfly_f32(pSrc + (2u * i), n2, 0);
+    }
+
+    /*  The same 7 twiddles for the butterflies at j of every group */
+    for (j = 1u; j < n2; j++)
+    {
+      for (i = j; i < fftLen; i += n1)
+      {
+        arm_radix8_bfly_f32(pSrc + (2u * i), n2, pCoef);
+      }
+      pCoef += 14u;
+    }
+
+    n1 = n2;
+  }
+
+  if(n1 == 4u)
+  {
+    /*  Last stage radix-4, the output in bit reversed order */
+    p = pSrc;
+    for (i = 0u; i < fftLen; i += 4u)
+    {
+      a0r = p[0] + p[4];
+      a0i = p[1] + p[5];
+      a1r = p[0] - p[4];
+      a1i = p[1] - p[5];
+      a2r = p[2] + p[6];
+      a2i = p[3] + p[7];
+      a3r = p[2] - p[6];
+      a3i = p[3] - p[7];
+
+      p[0] = a0r + a2r;
+      p[1] = a0i + a2i;
+      p[2] = a0r - a2r;
+      p[3] = a0i - a2i;
+      p[4] = a1r + a3i;
+      p[5] = a1i - a3r;
+      p[6] = a1r - a3i;
+      p[7] = a1i + a3r;
+      p += 8u;
+    }
+  }
+  else if(n1 == 2u)
+  {
+    /*  Last stage radix-2 */
+    p = pSrc;
+    for (i = 0u; i < fftLen; i += 2u)
+    {
+      a0r = p[0] + p[2];
+      a0i = p[1] + p[3];
+      p[2] = p[0] - p[2];
+      p[3] = p[1] - p[3];
+      p[0] = a0r;
+      p[1] = a0i;
+      p += 4u;
+    }
+  }
+}
+
+/*
+ * @brief  In-place bit reversal through a table of index pairs.
+ * @param[in, out] *pSrc        points to the in-place buffer.
+ * @param[in]      bitRevLen    number of entries of the table.
+ * @param[in]      *pBitRevTab  points to the pairs of complex indexes to swap.
+ * @return none.
+ */
+
+static void arm_cfft_bitreversal_f32(
+  float32_t * pSrc,
+  uint16_t bitRevLen,
+  const uint16_t * pBitRevTab)
+{
+  float32_t *pA, *pB;
+  float32_t inR, inI;
+  uint32_t i;
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    pA = pSrc + (2u * pBitRevTab[i]);
+    pB = pSrc + (2u * pBitRevTab[i + 1u]);
+
+    inR = pA[0];
+    inI = pA[1];
+    pA[0] = pB[0];
+    pA[1] = pB[1];
+    pB[0] = inR;
+    pB[1] = inI;
+  }
+}
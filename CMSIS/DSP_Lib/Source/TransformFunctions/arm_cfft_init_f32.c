@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_init_f32.c
+*
+* Description:	Mixed Radix Decimation in Frequency Floating-point CFFT & CIFFT Initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Mixed_CFFT_CIFFT
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point mixed radix CFFT/CIFFT.
+* @param[in,out] *S             points to an instance of the floating-point mixed radix CFFT/CIFFT structure.
+* @param[in]     fftLen         length of the FFT.
+* @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+* @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code>	Specifies length of CFFT/CIFFT process. Supported FFT Lengths are 16, 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* \par
+* The twiddles of a length are the tail of the table of the length eight times longer
+* (twiddleCoef_1024, twiddleCoef_2048 or twiddleCoef_4096), so that one table only is
+* linked for the lengths of a same residue of log2(fftLen) modulo 3. The lengths above
+* ARM_MATH_MAX_FFT_LEN are not supported, their tables being left out.
+*/
+
+arm_status arm_cfft_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the FFT length */
+  S->fftLen = fftLen;
+
+  /*  Initialise the Flag for selection of CFFT or CIFFT */
+  S->ifftFlag = ifftFlag;
+
+  /*  Initialise the Flag for calculation Bit reversal or not */
+  S->bitReverseFlag = bitReverseFlag;
+
+  /*  Initializations of structure parameters depending on the FFT length */
+  switch (S->fftLen)
+  {
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
+  case 4096u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_4096;
+    S->pBitRevTable = armBitRevIndexTable4096;
+    S->bitRevLength = ARMBITREVINDEXTABLE4096_LENGTH;
+    S->onebyfftLen = 0.000244140625f;
+    break;
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
+  case 2048u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_2048;
+    S->pBitRevTable = armBitRevIndexTable2048;
+    S->bitRevLength = ARMBITREVINDEXTABLE2048_LENGTH;
+    S->onebyfftLen = 0.00048828125f;
+    break;
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+  case 1024u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_1024;
+    S->pBitRevTable = armBitRevIndexTable1024;
+    S->bitRevLength = ARMBITREVINDEXTABLE1024_LENGTH;
+    S->onebyfftLen = 0.0009765625f;
+    break;
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 512)
+  case 512u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_512;
+    S->pBitRevTable = armBitRevIndexTable512;
+    S->bitRevLength = ARMBITREVINDEXTABLE512_LENGTH;
+    S->onebyfftLen = 0.001953125f;
+    break;
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
+  case 256u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_256;
+    S->pBitRevTable = armBitRevIndexTable256;
+    S->bitRevLength = ARMBITREVINDEXTABLE256_LENGTH;
+    S->onebyfftLen = 0.00390625f;
+    break;
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 128)
+  case 128u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_128;
+    S->pBitRevTable = armBitRevIndexTable128;
+    S->bitRevLength = ARMBITREVINDEXTABLE128_LENGTH;
+    S->onebyfftLen = 0.0078125f;
+    break;
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
+  case 64u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_64;
+    S->pBitRevTable = armBitRevIndexTable64;
+    S->bitRevLength = ARMBITREVINDEXTABLE64_LENGTH;
+    S->onebyfftLen = 0.015625f;
+    break;
+#endif
+
+#if (ARM_MATH_MAX_FFT_LEN >= 32)
+  case 32u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_32;
+    S->pBitRevTable = armBitRevIndexTable32;
+    S->bitRevLength = ARMBITREVINDEXTABLE32_LENGTH;
+    S->onebyfftLen = 0.03125f;
+    break;
+#endif
+
+  case 16u:
+    S->pTwiddle = ARM_CFFT_TWIDDLE_16;
+    S->pBitRevTable = armBitRevIndexTable16;
+    S->bitRevLength = ARMBITREVINDEXTABLE16_LENGTH;
+    S->onebyfftLen = 0.0625f;
+    break;
+
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Mixed_CFFT_CIFFT group
+ */
@@ -62,7 +62,7 @@
 * The parameter <code>bitReverseFlag</code> controls whether output is in normal order or bit reversed order.   
 * Set(=1) bitReverseFlag for output to be in normal order otherwise output is in bit reversed order.   
 * \par   
-* The parameter <code>fftLen</code>	Specifies length of CFFT/CIFFT process. Supported FFT Lengths are 16, 64, 256, 1024.   
+* The parameter <code>fftLen</code>	Specifies length of CFFT/CIFFT process. Supported FFT Lengths are 16, 64, 256, 1024, 4096, up to ARM_MATH_MAX_FFT_LEN.   
 * \par   
 * This Function also initializes Twiddle factor table pointer and Bit reversal table pointer.   
 */
@@ -91,95 +91,111 @@ arm_status arm_cfft_radix2_init_f32(
   switch (S->fftLen)
   {
 
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
   case 4096u:
     /*  Initializations of structure parameters for 4096 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 1u;
+    S->twidCoefModifier = ARM_TABLE_STRIDE(4096u);
     /*  Initialise the bit reversal table modifier */
-    S->bitRevFactor = 1u;
+    S->bitRevFactor = ARM_TABLE_STRIDE(4096u);
     /*  Initialise the bit reversal table pointer */
-    S->pBitRevTable = (uint16_t *) armBitRevTable;
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(4096u) - 1u];
     /*  Initialise the 1/fftLen Value */
     S->onebyfftLen = 0.000244140625;
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
   case 2048u:
     /*  Initializations of structure parameters for 2048 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 2u;
+    S->twidCoefModifier = ARM_TABLE_STRIDE(2048u);
     /*  Initialise the bit reversal table modifier */
-    S->bitRevFactor = 2u;
+    S->bitRevFactor = ARM_TABLE_STRIDE(2048u);
     /*  Initialise the bit reversal table pointer */
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[1];
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(2048u) - 1u];
     /*  Initialise the 1/fftLen Value */
     S->onebyfftLen = 0.00048828125;
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
   case 1024u:
     /*  Initializations of structure parameters for 1024 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 4u;
+    S->twidCoefModifier = ARM_TABLE_STRIDE(1024u);
     /*  Initialise the bit reversal table modifier */
-    S->bitRevFactor = 4u;
+    S->bitRevFactor = ARM_TABLE_STRIDE(1024u);
     /*  Initialise the bit reversal table pointer */
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[3];
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(1024u) - 1u];
     /*  Initialise the 1/fftLen Value */
     S->onebyfftLen = 0.0009765625f;
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 512)
   case 512u:
     /*  Initializations of structure parameters for 512 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 8u;
+    S->twidCoefModifier = ARM_TABLE_STRIDE(512u);
     /*  Initialise the bit reversal table modifier */
-    S->bitRevFactor = 8u;
+    S->bitRevFactor = ARM_TABLE_STRIDE(512u);
     /*  Initialise the bit reversal table pointer */
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[7];
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(512u) - 1u];
     /*  Initialise the 1/fftLen Value */
     S->onebyfftLen = 0.001953125;
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
   case 256u:
     /*  Initializations of structure parameters for 256 point FFT */
-    S->twidCoefModifier = 16u;
-    S->bitRevFactor = 16u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[15];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(256u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(256u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(256u) - 1u];
     S->onebyfftLen = 0.00390625f;
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 128)
   case 128u:
     /*  Initializations of structure parameters for 128 point FFT */
-    S->twidCoefModifier = 32u;
-    S->bitRevFactor = 32u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[31];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(128u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(128u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(128u) - 1u];
     S->onebyfftLen = 0.0078125;
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   case 64u:
     /*  Initializations of structure parameters for 64 point FFT */
-    S->twidCoefModifier = 64u;
-    S->bitRevFactor = 64u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[63];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(64u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(64u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(64u) - 1u];
     S->onebyfftLen = 0.015625f;
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 32)
   case 32u:
     /*  Initializations of structure parameters for 64 point FFT */
-    S->twidCoefModifier = 128u;
-    S->bitRevFactor = 128u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[127];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(32u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(32u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(32u) - 1u];
     S->onebyfftLen = 0.03125;
     break;
+#endif
 
   case 16u:
     /*  Initializations of structure parameters for 16 point FFT */
-    S->twidCoefModifier = 256u;
-    S->bitRevFactor = 256u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[255];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(16u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(16u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(16u) - 1u];
     S->onebyfftLen = 0.0625f;
     break;
 
@@ -0,0 +1,291 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_radix4_batch_f32.c
+*
+* Description:	Radix-4 Decimation in Frequency Floating-point CFFT & CIFFT of several channels
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static void arm_radix4_batch_butterfly_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier,
+  uint32_t numChannels,
+  uint32_t sampleStride,
+  uint32_t channelStride);
+
+static void arm_bitreversal_batch_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint16_t bitRevFactor,
+  const uint16_t * pBitRevTab,
+  uint32_t numChannels,
+  uint32_t sampleStride,
+  uint32_t channelStride);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Radix4_CFFT_CIFFT
+ * @{
+ */
+
+/**
+ * @details
+ * @brief Processing function for the floating-point Radix-4 CFFT/CIFFT of several channels.
+ * @param[in]      *S              points to an instance of the floating-point Radix-4 CFFT/CIFFT structure.
+ * @param[in, out] *pSrc           points to the complex data of the channels, <code>2*fftLen*numChannels</code> values. Processing occurs in-place.
+ * @param[in]      numChannels     number of signals transformed.
+ * @param[in]      interleaveFlag  selects planar (interleaveFlag=0) or interleaved (interleaveFlag=1) channels.
+ * @return none.
+ *
+ * \par
+ * The planar channels follow each other, the channel c at <code>pSrc + 2*fftLen*c</code>.
+ * The interleaved channels alternate sample by sample, the complex sample n of the channel
+ * c at <code>pSrc[2*(n*numChannels + c)]</code>, as a multi-channel ADC or DMA writes them.
+ *
+ * \par
+ * Each output is the one of arm_cfft_radix4_f32() on the channel alone. The butterflies
+ * sharing the twiddles of a stage are run for all the channels once the twiddles are
+ * loaded, and one bit reversal pass swaps the samples of all the channels. The CIFFT
+ * conjugates the data around the CFFT butterflies, the last pass scaling by 1/fftLen.
+ */
+
+void arm_cfft_radix4_batch_f32(
+  const arm_cfft_radix4_instance_f32 * S,
+  float32_t * pSrc,
+  uint16_t numChannels,
+  uint8_t interleaveFlag)
+{
+  uint32_t sampleStride, channelStride, i;
+  uint32_t total = 2u * (uint32_t) S->fftLen * numChannels;
+
+  /*  Distances of the complex samples and of the channels, in complex values */
+  if(interleaveFlag == 1u)
+  {
+    sampleStride = numChannels;
+    channelStride = 1u;
+  }
+  else
+  {
+    sampleStride = 1u;
+    channelStride = S->fftLen;
+  }
+
+  if(S->ifftFlag == 1u)
+  {
+    /*  CIFFT(x) = conj(CFFT(conj(x))) / fftLen */
+    for (i = 1u; i < total; i += 2u)
+    {
+      pSrc[i] = -pSrc[i];
+    }
+  }
+
+  arm_radix4_batch_butterfly_f32(pSrc, S->fftLen, S->pTwiddle, S->twidCoefModifier,
+                                 numChannels, sampleStride, channelStride);
+
+  if(S->bitReverseFlag == 1u)
+  {
+    /*  Bit Reversal */
+    arm_bitreversal_batch_f32(pSrc, S->fftLen, S->bitRevFactor, S->pBitRevTable,
+                              numChannels, sampleStride, channelStride);
+  }
+
+  if(S->ifftFlag == 1u)
+  {
+    for (i = 0u; i < total; i += 2u)
+    {
+      pSrc[i] = pSrc[i] * S->onebyfftLen;
+      pSrc[i + 1u] = -pSrc[i + 1u] * S->onebyfftLen;
+    }
+  }
+}
+
+/**
+ * @} end of Radix4_CFFT_CIFFT group
+ */
+
+/*
+ * @brief  Radix-4 CFFT butterflies of several channels.
+ * @param[in, out] *pSrc             points to the complex data of the channels.
+ * @param[in]      fftLen            length of the FFT.
+ * @param[in]      *pCoef            points to the twiddle coefficient buffer.
+ * @param[in]      twidCoefModifier  twiddle coefficient modifier of the FFT length.
+ * @param[in]      numChannels       number of channels.
+ * @param[in]      sampleStride      distance of two samples of a channel, in complex values.
+ * @param[in]      channelStride     distance of two channels, in complex values.
+ * @return none.
+ */
+
+static void arm_radix4_batch_butterfly_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  const float32_t * pCoef,
+  uint32_t twidCoefModifier,
+  uint32_t numChannels,
+  uint32_t sampleStride,
+  uint32_t channelStride)
+{
+  float32_t co1, co2, co3, si1, si2, si3;
+  float32_t t1, t2, r1, r2, s1, s2;
+  float32_t *p0, *p1, *p2, *p3;
+  uint32_t ia1, ia2, ia3;
+  uint32_t i0, n1, n2, j, k, ch;
+  uint32_t step = 2u * sampleStride;
+
+  n2 = fftLen;
+  for (k = fftLen; k > 1u; k >>= 2u)
+  {
+    n1 = n2;
+    n2 >>= 2u;
+    ia1 = 0u;
+
+    for (j = 0u; j < n2; j++)
+    {
+      /*  Twiddles of the butterflies j, j+n1, ... loaded once for all the channels */
+      ia2 = ia1 + ia1;
+      ia3 = ia2 + ia1;
+      co1 = pCoef[ia1 * 2u];
+      si1 = pCoef[(ia1 * 2u) + 1u];
+      co2 = pCoef[ia2 * 2u];
+      si2 = pCoef[(ia2 * 2u) + 1u];
+      co3 = pCoef[ia3 * 2u];
+      si3 = pCoef[(ia3 * 2u) + 1u];
+
+      ia1 = ia1 + twidCoefModifier;
+
+      for (ch = 0u; ch < numChannels; ch++)
+      {
+        for (i0 = j; i0 < fftLen; i0 += n1)
+        {
+          /*  pSrc[i0], pSrc[i0 + n2], pSrc[i0 + 2*n2], pSrc[i0 + 3*n2] of the channel */
+          p0 = pSrc + (2u * ((i0 * sampleStride) + (ch * channelStride)));
+          p1 = p0 + (n2 * step);
+          p2 = p1 + (n2 * step);
+          p3 = p2 + (n2 * step);
+
+          /* xa + xc, xa - xc, ya + yc, ya - yc */
+          r1 = p0[0] + p2[0];
+          r2 = p0[0] - p2[0];
+          s1 = p0[1] + p2[1];
+          s2 = p0[1] - p2[1];
+
+          /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+          t1 = p1[0] + p3[0];
+          t2 = p1[1] + p3[1];
+          p0[0] = r1 + t1;
+          p0[1] = s1 + t2;
+          r1 = r1 - t1;
+          s1 = s1 - t2;
+
+          /* (yb - yd), (xb - xd) */
+          t1 = p1[1] - p3[1];
+          t2 = p1[0] - p3[0];
+
+          /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+          p1[0] = (r1 * co2) + (s1 * si2);
+          p1[1] = (s1 * co2) - (r1 * si2);
+
+          r1 = r2 + t1;
+          r2 = r2 - t1;
+          s1 = s2 - t2;
+          s2 = s2 + t2;
+
+          /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+          p2[0] = (r1 * co1) + (s1 * si1);
+          p2[1] = (s1 * co1) - (r1 * si1);
+
+          /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+          p3[0] = (r2 * co3) + (s2 * si3);
+          p3[1] = (s2 * co3) - (r2 * si3);
+        }
+      }
+    }
+    twidCoefModifier <<= 2u;
+  }
+}
+
+/*
+ * @brief  Swap of the complex samples a and b of all the channels.
+ */
+
+static __INLINE void arm_batch_swap_f32(
+  float32_t * pSrc,
+  uint32_t a,
+  uint32_t b,
+  uint32_t numChannels,
+  uint32_t sampleStride,
+  uint32_t channelStride)
+{
+  float32_t *pA = pSrc + (2u * a * sampleStride);
+  float32_t *pB = pSrc + (2u * b * sampleStride);
+  float32_t in;
+  uint32_t ch;
+
+  for (ch = 0u; ch < numChannels; ch++)
+  {
+    in = pA[0];
+    pA[0] = pB[0];
+    pB[0] = in;
+    in = pA[1];
+    pA[1] = pB[1];
+    pB[1] = in;
+
+    pA += 2u * channelStride;
+    pB += 2u * channelStride;
+  }
+}
+
+/*
+ * @brief  In-place bit reversal of several channels, the pairs of arm_bitreversal_f32().
+ * @param[in, out] *pSrc           points to the complex data of the channels.
+ * @param[in]      fftLen          length of the FFT.
+ * @param[in]      bitRevFactor    bit reversal modifier of the FFT length.
+ * @param[in]      *pBitRevTab     points to the bit reversal table.
+ * @param[in]      numChannels     number of channels.
+ * @param[in]      sampleStride    distance of two samples of a channel, in complex values.
+ * @param[in]      channelStride   distance of two channels, in complex values.
+ * @return none.
+ */
+
+static void arm_bitreversal_batch_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint16_t bitRevFactor,
+  const uint16_t * pBitRevTab,
+  uint32_t numChannels,
+  uint32_t sampleStride,
+  uint32_t channelStride)
+{
+  uint32_t fftLenBy2 = fftLen >> 1u;
+  uint32_t fftLenBy2p1 = fftLenBy2 + 1u;
+  uint32_t i, j = 0u;
+
+  for (i = 0u; i <= (fftLenBy2 - 2u); i += 2u)
+  {
+    if(i < j)
+    {
+      arm_batch_swap_f32(pSrc, i, j, numChannels, sampleStride, channelStride);
+      arm_batch_swap_f32(pSrc, i + fftLenBy2p1, j + fftLenBy2p1, numChannels,
+                         sampleStride, channelStride);
+    }
+
+    arm_batch_swap_f32(pSrc, i + 1u, j + fftLenBy2, numChannels, sampleStride,
+                       channelStride);
+
+    /*  Reading the index for the bit reversal */
+    j = *pBitRevTab;
+    pBitRevTab += bitRevFactor;
+  }
+}
@@ -0,0 +1,281 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_cfft_radix4_bfp_q15.c
+*
+* Description:	Block floating point Radix-4 Decimation in Frequency Q15 CFFT & CIFFT
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static uint32_t arm_radix4_bfp_stage_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n1,
+  const q15_t * pCoef,
+  uint32_t twidCoefModifier,
+  uint32_t shift,
+  uint32_t re,
+  uint32_t im);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Radix4_CFFT_CIFFT
+ * @{
+ */
+
+/**
+ * @details
+ * @brief Block floating point processing function for the Q15 CFFT/CIFFT.
+ * @param[in]      *S    points to an instance of the Q15 CFFT/CIFFT structure.
+ * @param[in, out] *pSrc points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @return The exponent of the output: the transform is <code>pSrc[n] * 2^exponent</code>.
+ *
+ * \par Block floating point:
+ * \par
+ * arm_cfft_radix4_q15() downscales by 4 at every stage whatever the data, so that the
+ * output of a 1024 point transform of a low level input keeps few significant bits. This
+ * function measures the headroom of the whole buffer before each stage, with <code>__CLZ</code>
+ * on the OR of the magnitudes, and shifts only the bits a radix-4 butterfly may need: the
+ * output of a stage is at most 4*sqrt(2) times its largest input, so that 3 bits of headroom
+ * are kept, no more. The headroom of the next stage is gathered while the outputs are written.
+ * A low level input is scaled up first, to use the full range of the first stage.
+ *
+ * \par
+ * The returned exponent counts the shifts: the output times <code>2^exponent</code> is the
+ * unscaled sum of the transform, for the CFFT as for the CIFFT. The exponent may be negative
+ * for a low level input. Subtract <code>log2(fftLen)</code> for the CIFFT normalized by 1/fftLen.
+ *
+ * \par
+ * The same instance as arm_cfft_radix4_q15() is used, initialized by arm_cfft_radix4_init_q15().
+ */
+
+int32_t arm_cfft_radix4_bfp_q15(
+  const arm_cfft_radix4_instance_q15 * S,
+  q15_t * pSrc)
+{
+  uint32_t re, im, bits, head, shift, n1, modifier, i;
+  int32_t exponent = 0;
+
+  /*  The CIFFT is the CFFT of the swapped real and imaginary parts, swapped back */
+  re = (S->ifftFlag == 1u) ? 1u : 0u;
+  im = 1u - re;
+
+  /*  Headroom of the input */
+  bits = 0u;
+  for (i = 0u; i < (2u * S->fftLen); i++)
+  {
+    bits |= (uint32_t) (pSrc[i] ^ (pSrc[i] >> 15));
+  }
+
+  if(bits == 0u)
+  {
+    /*  All zero input, nothing to scale */
+    return (0);
+  }
+
+  /*  Scale a low level input up to the 3 guard bits */
+  head = __CLZ((q31_t) bits) - 17u;
+  if(head > 3u)
+  {
+    shift = head - 3u;
+    for (i = 0u; i < (2u * S->fftLen); i++)
+    {
+      pSrc[i] = (q15_t) (pSrc[i] << shift);
+    }
+    exponent = -(int32_t) shift;
+    bits <<= shift;
+  }
+
+  n1 = S->fftLen;
+  modifier = S->twidCoefModifier;
+  while(n1 >= 4u)
+  {
+    /*  Only the shift the 3 guard bits require */
+    head = __CLZ((q31_t) bits) - 17u;
+    shift = (head < 3u) ? (3u - head) : 0u;
+    exponent += (int32_t) shift;
+
+    bits = arm_radix4_bfp_stage_q15(pSrc, S->fftLen, n1, S->pTwiddle, modifier,
+                                    shift, re, im);
+
+    n1 >>= 2u;
+    modifier <<= 2u;
+  }
+
+  if(S->bitReverseFlag == 1u)
+  {
+    /*  Bit Reversal */
+    arm_bitreversal_q15(pSrc, S->fftLen, S->bitRevFactor, S->pBitRevTable);
+  }
+
+  return (exponent);
+}
+
+/**
+ * @} end of Radix4_CFFT_CIFFT group
+ */
+
+/*
+ * @brief  One radix-4 DIF stage of span n1, the inputs shifted right first.
+ * @param[in, out] *pSrc            points to the in-place buffer.
+ * @param[in]      fftLen           length of the FFT.
+ * @param[in]      n1               span of the butterflies of the stage.
+ * @param[in]      *pCoef           points to the twiddle coefficient buffer.
+ * @param[in]      twidCoefModifier twiddle index step of the stage.
+ * @param[in]      shift            right shift of the inputs.
+ * @param[in]      re               offset of the real part, 1 for the CIFFT.
+ * @param[in]      im               offset of the imaginary part, 0 for the CIFFT.
+ * @return         The OR of the magnitudes of the outputs.
+ *
+ * The outputs W^1 and W^2 are swapped, as in arm_radix4_butterfly_q15(), so that
+ * the stages leave the transform in bit reversed order.
+ */
+
+static uint32_t arm_radix4_bfp_stage_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n1,
+  const q15_t * pCoef,
+  uint32_t twidCoefModifier,
+  uint32_t shift,
+  uint32_t re,
+  uint32_t im)
+{
+  q15_t *p0, *p1, *p2, *p3;
+  q31_t xa, xb, xc, xd, ya, yb, yc, yd;
+  q31_t r1, r2, s1, s2, t1, t2, out;
+  q31_t co1, co2, co3, si1, si2, si3;
+  uint32_t n2, ia1, i0, j;
+  uint32_t bits = 0u;
+
+  n2 = n1 >> 2u;
+  ia1 = 0u;
+
+  for (j = 0u; j < n2; j++)
+  {
+    co1 = pCoef[2u * ia1];
+    si1 = pCoef[(2u * ia1) + 1u];
+    co2 = pCoef[4u * ia1];
+    si2 = pCoef[(4u * ia1) + 1u];
+    co3 = pCoef[6u * ia1];
+    si3 = pCoef[(6u * ia1) + 1u];
+    ia1 += twidCoefModifier;
+
+    for (i0 = j; i0 < fftLen; i0 += n1)
+    {
+      p0 = pSrc + (2u * i0);
+      p1 = p0 + (2u * n2);
+      p2 = p1 + (2u * n2);
+      p3 = p2 + (2u * n2);
+
+      xa = p0[re] >> shift;
+      ya = p0[im] >> shift;
+      xb = p1[re] >> shift;
+      yb = p1[im] >> shift;
+      xc = p2[re] >> shift;
+      yc = p2[im] >> shift;
+      xd = p3[re] >> shift;
+      yd = p3[im] >> shift;
+
+      /* xa + xc, xa - xc, ya + yc, ya - yc */
+      r1 = xa + xc;
+      r2 = xa - xc;
+      s1 = ya + yc;
+      s2 = ya - yc;
+
+      /* xb + xd, yb + yd */
+      t1 = xb + xd;
+      t2 = yb + yd;
+
+      /* xa' = xa + xb + xc + xd, ya' = ya + yb + yc + yd */
+      out = r1 + t1;
+      p0[re] = (q15_t) out;
+      bits |= (uint32_t) (out ^ (out >> 31));
+      out = s1 + t2;
+      p0[im] = (q15_t) out;
+      bits |= (uint32_t) (out ^ (out >> 31));
+
+      /* (xa + xc) - (xb + xd), (ya + yc) - (yb + yd) */
+      r1 = r1 - t1;
+      s1 = s1 - t2;
+
+      /* yb - yd, xb - xd */
+      t1 = yb - yd;
+      t2 = xb - xd;
+
+      if(j == 0u)
+      {
+        /* All the twiddles are 1 */
+        out = r1;
+        p1[re] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+        out = s1;
+        p1[im] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+
+        out = r2 + t1;
+        p2[re] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+        out = s2 - t2;
+        p2[im] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+
+        out = r2 - t1;
+        p3[re] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+        out = s2 + t2;
+        p3[im] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+      }
+      else
+      {
+        /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+        out = (((r1 * co2) + (s1 * si2)) >> 15);
+        p1[re] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+        /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+        out = (((s1 * co2) - (r1 * si2)) >> 15);
+        p1[im] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+
+        /* (xa - xc) + (yb - yd), (ya - yc) - (xb - xd) */
+        r1 = r2 + t1;
+        s1 = s2 - t2;
+
+        /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+        out = (((r1 * co1) + (s1 * si1)) >> 15);
+        p2[re] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+        /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+        out = (((s1 * co1) - (r1 * si1)) >> 15);
+        p2[im] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+
+        /* (xa - xc) - (yb - yd), (ya - yc) + (xb - xd) */
+        r2 = r2 - t1;
+        s2 = s2 + t2;
+
+        /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+        out = (((r2 * co3) + (s2 * si3)) >> 15);
+        p3[re] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+        /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+        out = (((s2 * co3) - (r2 * si3)) >> 15);
+        p3[im] = (q15_t) out;
+        bits |= (uint32_t) (out ^ (out >> 31));
+      }
+    }
+  }
+
+  return (bits);
+}
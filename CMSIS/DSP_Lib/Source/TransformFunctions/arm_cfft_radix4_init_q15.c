@@ -66,7 +66,7 @@
 * The parameter <code>bitReverseFlag</code> controls whether output is in normal order or bit reversed order.    
 * Set(=1) bitReverseFlag for output to be in normal order otherwise output is in bit reversed order.    
 * \par    
-* The parameter <code>fftLen</code>	Specifies length of CFFT/CIFFT process. Supported FFT Lengths are 16, 64, 256, 1024.    
+* The parameter <code>fftLen</code>	Specifies length of CFFT/CIFFT process. Supported FFT Lengths are 16, 64, 256, 1024, 4096, up to ARM_MATH_MAX_FFT_LEN.    
 * \par    
 * This Function also initializes Twiddle factor table pointer and Bit reversal table pointer.    
 */
@@ -91,47 +91,55 @@ arm_status arm_cfft_radix4_init_q15(
   /*  Initializations of structure parameters depending on the FFT length */
   switch (S->fftLen)
   {
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
   case 4096u:
     /*  Initializations of structure parameters for 4096 point FFT */
 
     /*  Initialise the twiddle coef modifier value */
-    S->twidCoefModifier = 1u;
+    S->twidCoefModifier = ARM_TABLE_STRIDE(4096u);
     /*  Initialise the bit reversal table modifier */
-    S->bitRevFactor = 1u;
+    S->bitRevFactor = ARM_TABLE_STRIDE(4096u);
     /*  Initialise the bit reversal table pointer */
-    S->pBitRevTable = (uint16_t *) armBitRevTable;
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(4096u) - 1u];
 
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
   case 1024u:
     /*  Initializations of structure parameters for 1024 point FFT */
-    S->twidCoefModifier = 4u;
-    S->bitRevFactor = 4u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[3];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(1024u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(1024u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(1024u) - 1u];
 
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
   case 256u:
     /*  Initializations of structure parameters for 256 point FFT */
-    S->twidCoefModifier = 16u;
-    S->bitRevFactor = 16u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[15];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(256u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(256u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(256u) - 1u];
 
     break;
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   case 64u:
     /*  Initializations of structure parameters for 64 point FFT */
-    S->twidCoefModifier = 64u;
-    S->bitRevFactor = 64u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[63];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(64u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(64u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(64u) - 1u];
 
     break;
+#endif
 
   case 16u:
     /*  Initializations of structure parameters for 16 point FFT */
-    S->twidCoefModifier = 256u;
-    S->bitRevFactor = 256u;
-    S->pBitRevTable = (uint16_t *) & armBitRevTable[255];
+    S->twidCoefModifier = ARM_TABLE_STRIDE(16u);
+    S->bitRevFactor = ARM_TABLE_STRIDE(16u);
+    S->pBitRevTable = (uint16_t *) & armBitRevTable[ARM_TABLE_STRIDE(16u) - 1u];
 
     break;
 
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dct2_f32.c
+*
+* Description:	Floating point DCT type II and type III process functions
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup DCT2_DCT3 DCT Type II and Type III Functions
+ *
+ * \par
+ * The N-point type-II DCT and its inverse, the type-III DCT, are computed with one real FFT
+ * of N points (arm_rfft_fast_f32()) and no weight table of their own:
+ * <pre>
+ *    DCT-II:  X[k] = sum(x[n] * cos(pi * (2n+1) * k / (2N))), n = 0 to N-1
+ *    DCT-III: x[n] = (2/N) * (X[0]/2 + sum(X[k] * cos(pi * (2n+1) * k / (2N)))), k = 1 to N-1
+ * </pre>
+ *
+ * \par
+ * The DCT-II reorders the input, the even samples first and the odd samples reversed,
+ * runs the real FFT and rotates each bin k by exp(-j*pi*k/(2N)): the real part of the
+ * rotated bin k is X[k] and its negated imaginary part is X[N-k]. The DCT-III runs the
+ * same steps backwards, so that arm_dct3_f32() returns the input of arm_dct2_f32().
+ *
+ * \par
+ * The rotations are read from the split step twiddles of the 4096 point real FFT, the
+ * quarter wave table twiddleCoef_rfft_4096, with a stride: the DCT-II/III and the MDCT
+ * share the tables of the FFTs instead of linking weight and cosine factor tables of
+ * their own as the DCT4 does.
+ *
+ * \par Lengths supported by the transform:
+ * 32, 64, 128, 256, 512 and 1024.
+ *
+ * \par Instance Structure
+ * The same instance computes the DCT-II and the DCT-III, initialized by arm_dct2_init_f32().
+ */
+
+/**
+ * @addtogroup DCT2_DCT3
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point DCT type II.
+ * @param[in]      *S              points to an instance of the floating-point DCT2/DCT3 structure.
+ * @param[in]      *pState         points to a state buffer of length N.
+ * @param[in,out]  *pInlineBuffer  points to the in/out data buffer of length N.
+ * @return none.
+ */
+
+void arm_dct2_f32(
+  const arm_dct2_instance_f32 * S,
+  float32_t * pState,
+  float32_t * pInlineBuffer)
+{
+  const float32_t *pCoef = S->pTwiddle;
+  float32_t *pV;
+  float32_t vr, vi, c, s;
+  uint32_t N = S->N;
+  uint32_t modifier = S->twidCoefModifier;
+  uint32_t k;
+
+  /*  Even samples first, odd samples reversed */
+  for (k = 0u; k < (N >> 1u); k++)
+  {
+    pState[k] = pInlineBuffer[2u * k];
+    pState[N - 1u - k] = pInlineBuffer[(2u * k) + 1u];
+  }
+
+  /*  Packed spectrum of the reordered sequence */
+  arm_rfft_fast_f32(&S->Srfft, pState, 0u);
+
+  /*  Bins 0 and N/2, real */
+  pInlineBuffer[0] = pState[0];
+  pInlineBuffer[N >> 1u] = pState[1] * 0.707106781186548f;
+
+  pV = pState + 2u;
+  for (k = 1u; k < (N >> 1u); k++)
+  {
+    /*  exp(-j*pi*k/(2N)) = c - j*s */
+    c = pCoef[2u * k * modifier];
+    s = pCoef[(2u * k * modifier) + 1u];
+    vr = pV[0];
+    vi = pV[1];
+
+    pInlineBuffer[k] = (vr * c) + (vi * s);
+    pInlineBuffer[N - k] = (vr * s) - (vi * c);
+
+    pV += 2u;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point DCT type III.
+ * @param[in]      *S              points to an instance of the floating-point DCT2/DCT3 structure.
+ * @param[in]      *pState         points to a state buffer of length N.
+ * @param[in,out]  *pInlineBuffer  points to the in/out data buffer of length N.
+ * @return none.
+ *
+ * \par
+ * The output is scaled by 2/N, the exact inverse of arm_dct2_f32().
+ */
+
+void arm_dct3_f32(
+  const arm_dct2_instance_f32 * S,
+  float32_t * pState,
+  float32_t * pInlineBuffer)
+{
+  const float32_t *pCoef = S->pTwiddle;
+  float32_t *pV;
+  float32_t xr, xi, c, s;
+  uint32_t N = S->N;
+  uint32_t modifier = S->twidCoefModifier;
+  uint32_t k;
+
+  /*  Bins 0 and N/2, real */
+  pState[0] = pInlineBuffer[0];
+  pState[1] = pInlineBuffer[N >> 1u] * 1.414213562373095f;
+
+  pV = pState + 2u;
+  for (k = 1u; k < (N >> 1u); k++)
+  {
+    /*  V[k] = exp(j*pi*k/(2N)) * (X[k] - j*X[N-k]) */
+    c = pCoef[2u * k * modifier];
+    s = pCoef[(2u * k * modifier) + 1u];
+    xr = pInlineBuffer[k];
+    xi = -pInlineBuffer[N - k];
+
+    pV[0] = (xr * c) - (xi * s);
+    pV[1] = (xr * s) + (xi * c);
+
+    pV += 2u;
+  }
+
+  /*  Real sequence of the packed spectrum, scaled by 1/N */
+  arm_rfft_fast_f32(&S->Srfft, pState, 1u);
+
+  /*  Even samples from the first half, odd samples from the reversed second half */
+  for (k = 0u; k < (N >> 1u); k++)
+  {
+    pInlineBuffer[2u * k] = pState[k];
+    pInlineBuffer[(2u * k) + 1u] = pState[N - 1u - k];
+  }
+}
+
+/**
+ * @} end of DCT2_DCT3 group
+ */
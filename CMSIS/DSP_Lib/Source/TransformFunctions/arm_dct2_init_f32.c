@@ -0,0 +1,64 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_dct2_init_f32.c
+*
+* Description:	Floating point DCT type II and type III initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup DCT2_DCT3
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point DCT2/DCT3.
+ * @param[in,out] *S  points to an instance of the floating-point DCT2/DCT3 structure.
+ * @param[in]     N   length of the DCT2/DCT3.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * Supported lengths are 32, 64, 128, 256, 512 and 1024, up to ARM_RFFT_TWIDDLE_MAX_LEN/4. The
+ * rotations exp(-j*pi*k/(2N)) are the entries <code>k*(ARM_RFFT_TWIDDLE_MAX_LEN/4)/N</code> of
+ * ARM_RFFT_TWIDDLE_MAX (twiddleCoef_rfft_4096 by default), the internal real FFT is
+ * initialized by arm_rfft_fast_init_f32().
+ */
+
+arm_status arm_dct2_init_f32(
+  arm_dct2_instance_f32 * S,
+  uint16_t N)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;
+
+  if((N >= 32u) && (N <= (ARM_RFFT_TWIDDLE_MAX_LEN / 4u)))
+  {
+    /*  Internal real FFT of N points, checking the power of two */
+    status = arm_rfft_fast_init_f32(&S->Srfft, N);
+  }
+
+  S->N = N;
+  S->pTwiddle = ARM_RFFT_TWIDDLE_MAX;
+  S->twidCoefModifier =
+    (status == ARM_MATH_SUCCESS) ? (uint16_t) ((ARM_RFFT_TWIDDLE_MAX_LEN / 4u) / N) : 0u;
+
+  return (status);
+}
+
+/**
+ * @} end of DCT2_DCT3 group
+ */
@@ -32,6 +32,7 @@
 
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**    
  * @ingroup groupTransforms    
@@ -64,6 +65,7 @@
 * array length is <code>2*N</code>.    
 */
 
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
 static const float32_t Weights_128[256] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999924701839144500f,
   -0.012271538285719925f,
@@ -194,7 +196,9 @@ static const float32_t Weights_128[256] = {
   0.024541228522912264f, -0.999698818696204250f, 0.012271538285719944f,
   -0.999924701839144500f
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
 static const float32_t Weights_512[1024] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999995293809576190f,
   -0.003067956762965976f,
@@ -709,7 +713,9 @@ static const float32_t Weights_512[1024] = {
   0.006135884649154515f, -0.999981175282601110f, 0.003067956762966138f,
   -0.999995293809576190f
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
 static const float32_t Weights_2048[4096] = {
   1.000000000000000000f, 0.000000000000000000f, 0.999999705862882230f,
   -0.000766990318742704f,
@@ -2760,7 +2766,9 @@ static const float32_t Weights_2048[4096] = {
   0.001533980186284766f, -0.999998823451701880f, 0.000766990318742846f,
   -0.999999705862882230f
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
 static const float32_t Weights_8192[16384] = {
   1.000000000000000000, -0.000000000000000000, 0.999999981616429330,
     -0.000191747597310703,
@@ -10956,6 +10964,7 @@ static const float32_t Weights_8192[16384] = {
     -0.999999981616429330,
 
 };
+#endif
 
 /**    
 * \par    
@@ -10970,6 +10979,7 @@ static const float32_t Weights_8192[16384] = {
 * \par    
 * where <code>N</code> is the number of factors to generate and <code>c</code> is <code>pi/(2*N)</code>    
 */
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
 static const float32_t cos_factors_128[128] = {
   0.999981175282601110f, 0.999830581795823400f, 0.999529417501093140f,
   0.999077727752645360f,
@@ -11036,7 +11046,9 @@ static const float32_t cos_factors_128[128] = {
   0.042938256934940959f, 0.030674803176636581f, 0.018406729905804820f,
   0.006135884649154515f
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
 static const float32_t cos_factors_512[512] = {
   0.999998823451701880f, 0.999989411081928400f, 0.999970586430974140f,
   0.999942349676023910f,
@@ -11295,7 +11307,9 @@ static const float32_t cos_factors_512[512] = {
   0.010737659167264572f, 0.007669828739531077f, 0.004601926120448672f,
   0.001533980186284766f
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
 static const float32_t cos_factors_2048[2048] = {
   0.999999926465717890f, 0.999999338191525530f, 0.999998161643486980f,
   0.999996396822294350f,
@@ -12322,7 +12336,9 @@ static const float32_t cos_factors_2048[2048] = {
   0.002684463154596083f, 0.001917474809855460f, 0.001150485337113809f,
   0.000383495187571497f
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
 static const float32_t cos_factors_8192[8192] = {
   1.999999990808214700, 1.999999917273932200, 1.999999770205369800,
     1.999999549602533100,
@@ -16422,6 +16438,7 @@ static const float32_t cos_factors_8192[8192] = {
     0.000191747598192208,
 
 };
+#endif
 
 /**    
  * @brief  Initialization function for the floating-point DCT4/IDCT4.   
@@ -16449,18 +16466,6 @@ arm_status arm_dct4_init_f32(
   /*  Initialize the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
-  /* Initializing the pointer array with the weight table base addresses of different lengths */
-  float32_t *twiddlePtr[4] =
-    { (float32_t *) Weights_128, (float32_t *) Weights_512,
-    (float32_t *) Weights_2048, (float32_t *) Weights_8192
-  };
-
-  /* Initializing the pointer array with the cos factor table base addresses of different lengths */
-  float32_t *pCosFactor[4] =
-    { (float32_t *) cos_factors_128, (float32_t *) cos_factors_512,
-    (float32_t *) cos_factors_2048, (float32_t *) cos_factors_8192
-  };
-
   /* Initialize the DCT4 length */
   S->N = N;
 
@@ -16479,22 +16484,30 @@ arm_status arm_dct4_init_f32(
   switch (N)
   {
     /* Initialize the table modifier values */
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
   case 8192u:
-    S->pTwiddle = twiddlePtr[3];
-    S->pCosFactor = pCosFactor[3];
+    S->pTwiddle = (float32_t *) Weights_8192;
+    S->pCosFactor = (float32_t *) cos_factors_8192;
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
   case 2048u:
-    S->pTwiddle = twiddlePtr[2];
-    S->pCosFactor = pCosFactor[2];
+    S->pTwiddle = (float32_t *) Weights_2048;
+    S->pCosFactor = (float32_t *) cos_factors_2048;
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
   case 512u:
-    S->pTwiddle = twiddlePtr[1];
-    S->pCosFactor = pCosFactor[1];
+    S->pTwiddle = (float32_t *) Weights_512;
+    S->pCosFactor = (float32_t *) cos_factors_512;
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   case 128u:
-    S->pTwiddle = twiddlePtr[0];
-    S->pCosFactor = pCosFactor[0];
+    S->pTwiddle = (float32_t *) Weights_128;
+    S->pCosFactor = (float32_t *) cos_factors_128;
     break;
+#endif
   default:
     status = ARM_MATH_ARGUMENT_ERROR;
   }
@@ -32,6 +32,7 @@
 
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**    
  * @ingroup groupTransforms    
@@ -66,6 +67,7 @@
 * array length is <code>2*N</code>.    
 */
 
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
 static const q15_t ALIGN4 WeightsQ15_128[256] = {
   0x7fff, 0x0, 0x7ffd, 0xfe6e, 0x7ff6, 0xfcdc, 0x7fe9, 0xfb4a,
   0x7fd8, 0xf9b9, 0x7fc2, 0xf827, 0x7fa7, 0xf696, 0x7f87, 0xf505,
@@ -100,7 +102,9 @@ static const q15_t ALIGN4 WeightsQ15_128[256] = {
   0xc8b, 0x809e, 0xafb, 0x8079, 0x96a, 0x8059, 0x7d9, 0x803e,
   0x647, 0x8028, 0x4b6, 0x8017, 0x324, 0x800a, 0x192, 0x8003,
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
 static const q15_t ALIGN4 WeightsQ15_512[1024] = {
   0x7fff, 0x0, 0x7fff, 0xff9c, 0x7fff, 0xff37, 0x7ffe, 0xfed3,
   0x7ffd, 0xfe6e, 0x7ffc, 0xfe0a, 0x7ffa, 0xfda5, 0x7ff8, 0xfd41,
@@ -231,7 +235,9 @@ static const q15_t ALIGN4 WeightsQ15_512[1024] = {
   0x324, 0x800a, 0x2bf, 0x8008, 0x25b, 0x8006, 0x1f6, 0x8004,
   0x192, 0x8003, 0x12d, 0x8002, 0xc9, 0x8001, 0x64, 0x8001,
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
 static const q15_t ALIGN4 WeightsQ15_2048[4096] = {
   0x7fff, 0x0, 0x7fff, 0xffe7, 0x7fff, 0xffce, 0x7fff, 0xffb5,
   0x7fff, 0xff9c, 0x7fff, 0xff83, 0x7fff, 0xff6a, 0x7fff, 0xff51,
@@ -746,7 +752,9 @@ static const q15_t ALIGN4 WeightsQ15_2048[4096] = {
   0xc9, 0x8001, 0xaf, 0x8001, 0x96, 0x8001, 0x7d, 0x8001,
   0x64, 0x8001, 0x4b, 0x8001, 0x32, 0x8001, 0x19, 0x8001,
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
 static const q15_t ALIGN4 WeightsQ15_8192[16384] = {
   0x7fff, 0x0, 0x7fff, 0xfffa, 0x7fff, 0xfff4, 0x7fff, 0xffee,
   0x7fff, 0xffe7, 0x7fff, 0xffe1, 0x7fff, 0xffdb, 0x7fff, 0xffd5,
@@ -2797,6 +2805,7 @@ static const q15_t ALIGN4 WeightsQ15_8192[16384] = {
   0x32, 0x8001, 0x2b, 0x8001, 0x25, 0x8001, 0x1f, 0x8001,
   0x19, 0x8001, 0x12, 0x8001, 0xc, 0x8001, 0x6, 0x8001,
 };
+#endif
 
 
 /**    
@@ -2816,6 +2825,7 @@ static const q15_t ALIGN4 WeightsQ15_8192[16384] = {
     
 */
 
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
 static const q15_t ALIGN4 cos_factorsQ15_128[128] = {
   0x7fff, 0x7ffa, 0x7ff0, 0x7fe1, 0x7fce, 0x7fb5, 0x7f97, 0x7f75,
   0x7f4d, 0x7f21, 0x7ef0, 0x7eba, 0x7e7f, 0x7e3f, 0x7dfa, 0x7db0,
@@ -2834,7 +2844,9 @@ static const q15_t ALIGN4 cos_factorsQ15_128[128] = {
   0x1833, 0x16a8, 0x151b, 0x138e, 0x1201, 0x1072, 0xee3, 0xd53,
   0xbc3, 0xa33, 0x8a2, 0x710, 0x57f, 0x3ed, 0x25b, 0xc9
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
 static const q15_t ALIGN4 cos_factorsQ15_512[512] = {
   0x7fff, 0x7fff, 0x7fff, 0x7ffe, 0x7ffc, 0x7ffb, 0x7ff9, 0x7ff7,
   0x7ff4, 0x7ff2, 0x7fee, 0x7feb, 0x7fe7, 0x7fe3, 0x7fdf, 0x7fda,
@@ -2901,7 +2913,9 @@ static const q15_t ALIGN4 cos_factorsQ15_512[512] = {
   0x615, 0x5b1, 0x54c, 0x4e8, 0x483, 0x41f, 0x3ba, 0x356,
   0x2f1, 0x28d, 0x228, 0x1c4, 0x15f, 0xfb, 0x96, 0x32,
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
 static const q15_t ALIGN4 cos_factorsQ15_2048[2048] = {
   0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
   0x7fff, 0x7fff, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffd, 0x7ffd,
@@ -3161,7 +3175,9 @@ static const q15_t ALIGN4 cos_factorsQ15_2048[2048] = {
   0xbc, 0xa3, 0x8a, 0x71, 0x57, 0x3e, 0x25, 0xc,
 
 };
+#endif
 
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
 static const q15_t ALIGN4 cos_factorsQ15_8192[8192] = {
   0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
   0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff, 0x7fff,
@@ -4188,6 +4204,7 @@ static const q15_t ALIGN4 cos_factorsQ15_8192[8192] = {
   0x61, 0x5b, 0x54, 0x4e, 0x48, 0x41, 0x3b, 0x35,
   0x2f, 0x28, 0x22, 0x1c, 0x15, 0xf, 0x9, 0x3,
 };
+#endif
 
 /**    
  * @brief  Initialization function for the Q15 DCT4/IDCT4.   
@@ -4215,17 +4232,6 @@ arm_status arm_dct4_init_q15(
   /*  Initialise the default arm status */
   arm_status status = ARM_MATH_SUCCESS;
 
-  /* Initializing the pointer array with the weight table base addresses of different lengths */
-  q15_t *twiddlePtr[4] = { (q15_t *) WeightsQ15_128, (q15_t *) WeightsQ15_512,
-    (q15_t *) WeightsQ15_2048, (q15_t *) WeightsQ15_8192
-  };
-
-  /* Initializing the pointer array with the cos factor table base addresses of different lengths */
-  q15_t *pCosFactor[4] =
-    { (q15_t *) cos_factorsQ15_128, (q15_t *) cos_factorsQ15_512,
-    (q15_t *) cos_factorsQ15_2048, (q15_t *) cos_factorsQ15_8192
-  };
-
   /* Initialize the DCT4 length */
   S->N = N;
 
@@ -4244,22 +4250,30 @@ arm_status arm_dct4_init_q15(
   switch (N)
   {
     /* Initialize the table modifier values */
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
   case 8192u:
-    S->pTwiddle = twiddlePtr[3];
-    S->pCosFactor = pCosFactor[3];
+    S->pTwiddle = (q15_t *) WeightsQ15_8192;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_8192;
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
   case 2048u:
-    S->pTwiddle = twiddlePtr[2];
-    S->pCosFactor = pCosFactor[2];
+    S->pTwiddle = (q15_t *) WeightsQ15_2048;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_2048;
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
   case 512u:
-    S->pTwiddle = twiddlePtr[1];
-    S->pCosFactor = pCosFactor[1];
+    S->pTwiddle = (q15_t *) WeightsQ15_512;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_512;
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   case 128u:
-    S->pTwiddle = twiddlePtr[0];
-    S->pCosFactor = pCosFactor[0];
+    S->pTwiddle = (q15_t *) WeightsQ15_128;
+    S->pCosFactor = (q15_t *) cos_factorsQ15_128;
     break;
+#endif
   default:
     status = ARM_MATH_ARGUMENT_ERROR;
   }
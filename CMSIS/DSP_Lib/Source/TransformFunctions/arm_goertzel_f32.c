@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_f32.c
+*
+* Description:	Floating point multi-bin Goertzel process and power functions
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Algorithm
+ *
+ * \par
+ * The Goertzel algorithm computes single bins of the DFT with a second order recursion
+ * per bin, where a complex FFT computes all of them: tone detection, line frequency
+ * harmonics. For a handful of bins the cost per sample is proportional to the number of bins.
+ *
+ * \par
+ * For each bin of frequency w = 2*pi*k/N:
+ * <pre>
+ *    s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]
+ *    |X(w)|^2 = s[N-1]^2 + s[N-2]^2 - 2*cos(w)*s[N-1]*s[N-2]
+ * </pre>
+ * k need not be an integer: any frequency below fs/2 can be detected.
+ *
+ * \par
+ * The process function runs the recursions of all the bins over a block of samples. It may
+ * be called several times for the N samples of the analysis, in blocks of any size. The power
+ * function gives the power of each bin and clears the state for the next N samples.
+ *
+ * \par Instance Structure
+ * The coefficients are the cosines <code>cos(w)</code> of the bins, one per bin, in the
+ * format of the data. The state holds two values per bin. A separate instance structure must
+ * be defined for each set of bins, initialized by the init function of the data type.
+ *
+ * \par Fixed-Point Behavior
+ * The recursions are not saturated. The state of the Q15 functions is kept in 32 bits,
+ * in 17.15 format, which leaves 16 guard bits for the growth of the state over the N samples.
+ * The Q31 functions shift the input right by <code>shift</code> bits, at least log2(N),
+ * to keep the 1.31 state in range. The powers are given in 64 bits.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point Goertzel algorithm.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  const float32_t *pIn;
+  float32_t *pState = S->pState;
+  float32_t coef, s0, s1, s2;
+  uint32_t i, blkCnt;
+
+  /*  One bin after the other, the state in registers */
+  for (i = 0u; i < S->numBins; i++)
+  {
+    coef = 2.0f * S->pCoeffs[i];
+    s1 = pState[0];
+    s2 = pState[1];
+    pIn = pSrc;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*  Two samples per iteration, the state rotated through the registers */
+    blkCnt = blockSize >> 1u;
+    while(blkCnt > 0u)
+    {
+      s2 = *pIn++ + (coef * s1) - s2;
+      s1 = *pIn++ + (coef * s2) - s1;
+
+      blkCnt--;
+    }
+
+    if((blockSize & 1u) != 0u)
+    {
+      s0 = *pIn + (coef * s1) - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = blockSize;
+    while(blkCnt > 0u)
+    {
+      s0 = *pIn++ + (coef * s1) - s2;
+      s2 = s1;
+      s1 = s0;
+
+      blkCnt--;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    pState[0] = s1;
+    pState[1] = s2;
+    pState += 2u;
+  }
+}
+
+/**
+ * @brief Power of the bins of the floating-point Goertzel algorithm.
+ * @param[in,out] *S     points to an instance of the floating-point Goertzel structure.
+ * @param[out]    *pDst  points to the output buffer of <code>numBins</code> powers.
+ * @return none.
+ *
+ * \par
+ * pDst[i] is the squared magnitude of the DFT of the samples processed since the last
+ * call, at the frequency of bin i. The state is cleared.
+ */
+
+void arm_goertzel_power_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pDst)
+{
+  float32_t *pState = S->pState;
+  float32_t s1, s2;
+  uint32_t i;
+
+  for (i = 0u; i < S->numBins; i++)
+  {
+    s1 = pState[0];
+    s2 = pState[1];
+
+    /*  |X|^2 = s1^2 + s2^2 - 2*cos(w)*s1*s2 */
+    *pDst++ = (s1 * s1) + (s2 * s2) - (2.0f * S->pCoeffs[i] * s1 * s2);
+
+    *pState++ = 0.0f;
+    *pState++ = 0.0f;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,54 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_f32.c
+*
+* Description:	Floating point Goertzel initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Goertzel algorithm.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     numBins    number of bins.
+ * @param[in]     *pCoeffs   points to the cosines of the bin frequencies, <code>numBins</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*numBins</code> values.
+ * @return none.
+ *
+ * \par
+ * The state buffer is cleared.
+ */
+
+void arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pCoeffs,
+  float32_t * pState)
+{
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /*  Clear the state buffer */
+  memset(pState, 0, 2u * numBins * sizeof(float32_t));
+}
+
+/**
+ * @} end of Goertzel group
+ */
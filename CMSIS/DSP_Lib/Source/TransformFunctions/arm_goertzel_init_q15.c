@@ -0,0 +1,54 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_q15.c
+*
+* Description:	Q15 Goertzel initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 Goertzel algorithm.
+ * @param[in,out] *S         points to an instance of the Q15 Goertzel structure.
+ * @param[in]     numBins    number of bins.
+ * @param[in]     *pCoeffs   points to the cosines of the bin frequencies, <code>numBins</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*numBins</code> values.
+ * @return none.
+ *
+ * \par
+ * The state buffer is cleared.
+ */
+
+void arm_goertzel_init_q15(
+  arm_goertzel_instance_q15 * S,
+  uint16_t numBins,
+  const q15_t * pCoeffs,
+  q31_t * pState)
+{
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /*  Clear the state buffer */
+  memset(pState, 0, 2u * numBins * sizeof(q31_t));
+}
+
+/**
+ * @} end of Goertzel group
+ */
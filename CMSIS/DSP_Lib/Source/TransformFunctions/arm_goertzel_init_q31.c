@@ -0,0 +1,57 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_init_q31.c
+*
+* Description:	Q31 Goertzel initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel algorithm.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins    number of bins.
+ * @param[in]     *pCoeffs   points to the cosines of the bin frequencies, <code>numBins</code> values.
+ * @param[in]     *pState    points to the state buffer of <code>2*numBins</code> values.
+ * @param[in]     shift      number of bits the input is shifted right by, at least log2 of the analysis length.
+ * @return none.
+ *
+ * \par
+ * The state buffer is cleared.
+ */
+
+void arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const q31_t * pCoeffs,
+  q31_t * pState,
+  uint8_t shift)
+{
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->shift = shift;
+
+  /*  Clear the state buffer */
+  memset(pState, 0, 2u * numBins * sizeof(q31_t));
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_q15.c
+*
+* Description:	Q15 multi-bin Goertzel process and power functions
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 Goertzel algorithm.
+ * @param[in,out] *S         points to an instance of the Q15 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The state is kept in 17.15 format and the recursion is not saturated: the samples
+ * are added unscaled and 2*cos(w)*s[n-1] is computed in 64 bits.
+ */
+
+void arm_goertzel_q15(
+  arm_goertzel_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q15_t *pIn;
+  q31_t *pState = S->pState;
+  q31_t s0, s1, s2;
+  q15_t coef;
+  uint32_t i, blkCnt;
+
+#ifndef ARM_MATH_CM0
+  q31_t in;
+#endif
+
+  /*  One bin after the other, the state in registers */
+  for (i = 0u; i < S->numBins; i++)
+  {
+    coef = S->pCoeffs[i];
+    s1 = pState[0];
+    s2 = pState[1];
+    pIn = pSrc;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*  Two samples read at once, the state rotated through the registers */
+    blkCnt = blockSize >> 1u;
+    while(blkCnt > 0u)
+    {
+      in = *__SIMD32(pIn)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      s2 = (q31_t) (q15_t) in + (q31_t) (((q63_t) s1 * coef) >> 14) - s2;
+      s1 = (in >> 16) + (q31_t) (((q63_t) s2 * coef) >> 14) - s1;
+
+#else
+
+      s2 = (in >> 16) + (q31_t) (((q63_t) s1 * coef) >> 14) - s2;
+      s1 = (q31_t) (q15_t) in + (q31_t) (((q63_t) s2 * coef) >> 14) - s1;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+      blkCnt--;
+    }
+
+    if((blockSize & 1u) != 0u)
+    {
+      s0 = (q31_t) * pIn + (q31_t) (((q63_t) s1 * coef) >> 14) - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = blockSize;
+    while(blkCnt > 0u)
+    {
+      s0 = (q31_t) * pIn++ + (q31_t) (((q63_t) s1 * coef) >> 14) - s2;
+      s2 = s1;
+      s1 = s0;
+
+      blkCnt--;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    pState[0] = s1;
+    pState[1] = s2;
+    pState += 2u;
+  }
+}
+
+/**
+ * @brief Power of the bins of the Q15 Goertzel algorithm.
+ * @param[in,out] *S     points to an instance of the Q15 Goertzel structure.
+ * @param[out]    *pDst  points to the output buffer of <code>numBins</code> powers.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products of the 17.15 states are in 34.30 format: the powers are given in
+ * 34.30 format. The state is cleared.
+ */
+
+void arm_goertzel_power_q15(
+  arm_goertzel_instance_q15 * S,
+  q63_t * pDst)
+{
+  q31_t *pState = S->pState;
+  q31_t s1, s2;
+  uint32_t i;
+
+  for (i = 0u; i < S->numBins; i++)
+  {
+    s1 = pState[0];
+    s2 = pState[1];
+
+    /*  |X|^2 = s1^2 + s2^2 - 2*cos(w)*s1*s2 */
+    *pDst++ = ((q63_t) s1 * s1) + ((q63_t) s2 * s2) -
+      ((((q63_t) s1 * S->pCoeffs[i]) >> 14) * s2);
+
+    *pState++ = 0;
+    *pState++ = 0;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_goertzel_q31.c
+*
+* Description:	Q31 multi-bin Goertzel process and power functions
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 Goertzel algorithm.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The samples are shifted right by <code>shift</code> bits before they are added to
+ * the 1.31 state, and the recursion is not saturated: <code>shift</code> must be at least
+ * log2(N) for a full scale input.
+ */
+
+void arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t *pIn;
+  q31_t *pState = S->pState;
+  q31_t s0, s1, s2, coef;
+  uint32_t shift = S->shift;
+  uint32_t i, blkCnt;
+
+  /*  One bin after the other, the state in registers */
+  for (i = 0u; i < S->numBins; i++)
+  {
+    coef = S->pCoeffs[i];
+    s1 = pState[0];
+    s2 = pState[1];
+    pIn = pSrc;
+
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*  Two samples per iteration, the state rotated through the registers */
+    blkCnt = blockSize >> 1u;
+    while(blkCnt > 0u)
+    {
+      s2 = (*pIn++ >> shift) + (q31_t) (((q63_t) s1 * coef) >> 30) - s2;
+      s1 = (*pIn++ >> shift) + (q31_t) (((q63_t) s2 * coef) >> 30) - s1;
+
+      blkCnt--;
+    }
+
+    if((blockSize & 1u) != 0u)
+    {
+      s0 = (*pIn >> shift) + (q31_t) (((q63_t) s1 * coef) >> 30) - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = blockSize;
+    while(blkCnt > 0u)
+    {
+      s0 = (*pIn++ >> shift) + (q31_t) (((q63_t) s1 * coef) >> 30) - s2;
+      s2 = s1;
+      s1 = s0;
+
+      blkCnt--;
+    }
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    pState[0] = s1;
+    pState[1] = s2;
+    pState += 2u;
+  }
+}
+
+/**
+ * @brief Power of the bins of the Q31 Goertzel algorithm.
+ * @param[in,out] *S     points to an instance of the Q31 Goertzel structure.
+ * @param[out]    *pDst  points to the output buffer of <code>numBins</code> powers.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products of the 1.31 states are in 2.62 format: the powers are given in 2.62
+ * format, the power of the unscaled input divided by <code>2^(2*shift)</code>. The state
+ * is cleared.
+ */
+
+void arm_goertzel_power_q31(
+  arm_goertzel_instance_q31 * S,
+  q63_t * pDst)
+{
+  q31_t *pState = S->pState;
+  q31_t s1, s2;
+  uint32_t i;
+
+  for (i = 0u; i < S->numBins; i++)
+  {
+    s1 = pState[0];
+    s2 = pState[1];
+
+    /*  |X|^2 = s1^2 + s2^2 - 2*cos(w)*s1*s2 */
+    *pDst++ = ((q63_t) s1 * s1) + ((q63_t) s2 * s2) -
+      ((((q63_t) s1 * S->pCoeffs[i]) >> 30) * s2);
+
+    *pState++ = 0;
+    *pState++ = 0;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
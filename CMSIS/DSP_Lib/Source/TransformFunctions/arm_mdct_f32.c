@@ -0,0 +1,224 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mdct_f32.c
+*
+* Description:	Floating point MDCT and IMDCT process functions
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static void arm_mdct_dct4_f32(
+  const arm_mdct_instance_f32 * S,
+  float32_t * pBuf);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MDCT_IMDCT MDCT and IMDCT Functions
+ *
+ * \par
+ * The Modified Discrete Cosine Transform gives N coefficients for each frame of 2N samples,
+ * the frames overlapping by N samples, and the IMDCT with the overlap-add of the frames
+ * returns the signal (time domain aliasing cancellation):
+ * <pre>
+ *    X[k] = sum(w[n] * x[n] * cos(pi/N * (n + 1/2 + N/2) * (k + 1/2))), n = 0 to 2N-1
+ * </pre>
+ * The window <code>w</code> of 2N coefficients must verify w[n]^2 + w[n+N]^2 = 1, a sine or a
+ * Kaiser-Bessel derived window for example, and is applied at the analysis and at the synthesis.
+ *
+ * \par
+ * The frame is folded into N values, whose DCT type IV is the MDCT. The DCT-IV is computed
+ * in-place with a complex FFT of N/2 points, a quarter of the frame length: the values 2n and
+ * N-1-2n form the complex value n, rotated by exp(-j*pi*(n+1/4)/N) before the FFT, and the
+ * bin k rotated by exp(-j*pi*k/N) gives the coefficients 2k and N-1-2k. The IMDCT runs the
+ * same DCT-IV and unfolds it into the 2N windowed samples.
+ *
+ * \par
+ * The rotations are read from twiddleCoef_rfft_4096 with a stride, the constant 1/4 offset
+ * being one rotation per length: the MDCT shares the tables of the FFTs with the DCT-II/III.
+ *
+ * \par
+ * arm_mdct_f32() takes N new samples per call, the state keeping the previous N, and gives
+ * the N coefficients of the frame. arm_imdct_f32() takes the N coefficients of a frame and
+ * gives N output samples, the state keeping the second half of the frame for the next call:
+ * the output of the IMDCT is the input of the MDCT delayed by N samples.
+ *
+ * \par Lengths supported by the transform:
+ * N = 32, 64, 128, 256, 512, 1024 and 2048 coefficients, frames of 64 to 4096 samples.
+ *
+ * \par Instance Structure
+ * A separate instance structure must be defined for the analysis and for the synthesis
+ * of each stream, initialized by arm_mdct_init_f32().
+ */
+
+/**
+ * @addtogroup MDCT_IMDCT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point MDCT.
+ * @param[in,out] *S     points to an instance of the floating-point MDCT/IMDCT structure.
+ * @param[in]     *pSrc  points to the N new samples.
+ * @param[out]    *pDst  points to the N coefficients of the frame.
+ * @return none.
+ */
+
+void arm_mdct_f32(
+  arm_mdct_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst)
+{
+  const float32_t *pW = S->pWindow;
+  float32_t *pState = S->pState;
+  uint32_t N = S->N;
+  uint32_t h = N >> 1u;
+  uint32_t n;
+
+  /*  Fold of the windowed frame [state, new samples] into the N values of the DCT-IV */
+  for (n = 0u; n < h; n++)
+  {
+    /*  u[n] = -x[3N/2-1-n] - x[3N/2+n] */
+    pDst[n] = -(pW[N + h - 1u - n] * pSrc[h - 1u - n]) - (pW[N + h + n] * pSrc[h + n]);
+
+    /*  u[n+N/2] = x[n] - x[N-1-n] */
+    pDst[h + n] = (pW[n] * pState[n]) - (pW[N - 1u - n] * pState[N - 1u - n]);
+  }
+
+  /*  The new samples are the first half of the next frame */
+  memcpy(pState, pSrc, N * sizeof(float32_t));
+
+  arm_mdct_dct4_f32(S, pDst);
+}
+
+/**
+ * @brief Processing function for the floating-point IMDCT.
+ * @param[in,out] *S     points to an instance of the floating-point MDCT/IMDCT structure.
+ * @param[in,out] *pSrc  points to the N coefficients of the frame, overwritten.
+ * @param[out]    *pDst  points to the N output samples.
+ * @return none.
+ *
+ * \par
+ * The samples are scaled by 2/N, so that the overlap-add of the frames returns the
+ * input of arm_mdct_f32().
+ */
+
+void arm_imdct_f32(
+  arm_mdct_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  const float32_t *pW = S->pWindow;
+  float32_t *pState = S->pState;
+  float32_t scale = S->normalize;
+  float32_t a, b;
+  uint32_t N = S->N;
+  uint32_t h = N >> 1u;
+  uint32_t n;
+
+  arm_mdct_dct4_f32(S, pSrc);
+
+  /*  Unfold into the windowed frame, the first half added to the state */
+  for (n = 0u; n < h; n++)
+  {
+    /*  y[n] = u[N/2+n], y[N-1-n] = -u[n+N/2] */
+    a = scale * pSrc[h + n];
+    pDst[n] = pState[n] + (pW[n] * a);
+    pDst[N - 1u - n] = pState[N - 1u - n] - (pW[N - 1u - n] * a);
+  }
+
+  /*  The second half is the state of the next frame */
+  for (n = 0u; n < h; n++)
+  {
+    /*  y[3N/2-1-n] = -u[n], y[3N/2+n] = -u[n] */
+    b = scale * pSrc[n];
+    pState[h - 1u - n] = -(pW[N + h - 1u - n] * b);
+    pState[h + n] = -(pW[N + h + n] * b);
+  }
+}
+
+/**
+ * @} end of MDCT_IMDCT group
+ */
+
+/**
+ * @brief  In-place DCT-IV of N values through a complex FFT of N/2 points.
+ * @param[in]      *S     points to an instance of the floating-point MDCT/IMDCT structure.
+ * @param[in, out] *pBuf  points to the N values, overwritten by their DCT-IV.
+ * @return none.
+ *
+ * \par
+ * The complex value n is built from the values 2n and N-1-2n and the bin k gives the values
+ * 2k and N-1-2k: the values n and N/2-1-n are processed together, so that each pass reads
+ * and writes the same four positions.
+ */
+
+static void arm_mdct_dct4_f32(
+  const arm_mdct_instance_f32 * S,
+  float32_t * pBuf)
+{
+  const float32_t *pCoef = S->pTwiddle;
+  float32_t ar, ai, br, bi, c, s, wr, wi;
+  uint32_t N = S->N;
+  uint32_t modifier = S->twidCoefModifier;
+  uint32_t n, m;
+
+  /*  Pre-rotation by exp(-j*pi*(n+1/4)/N) */
+  for (n = 0u; n < (N >> 2u); n++)
+  {
+    m = (N >> 1u) - 1u - n;
+
+    ar = pBuf[2u * n];
+    ai = pBuf[N - 1u - (2u * n)];
+    br = pBuf[2u * m];
+    bi = pBuf[N - 1u - (2u * m)];
+
+    /*  w = exp(-j*pi*n/N) * exp(-j*pi/(4N)) */
+    c = pCoef[2u * n * modifier];
+    s = pCoef[(2u * n * modifier) + 1u];
+    wr = (c * S->cosOffset) - (s * S->sinOffset);
+    wi = -((s * S->cosOffset) + (c * S->sinOffset));
+    pBuf[2u * n] = (ar * wr) - (ai * wi);
+    pBuf[(2u * n) + 1u] = (ar * wi) + (ai * wr);
+
+    c = pCoef[2u * m * modifier];
+    s = pCoef[(2u * m * modifier) + 1u];
+    wr = (c * S->cosOffset) - (s * S->sinOffset);
+    wi = -((s * S->cosOffset) + (c * S->sinOffset));
+    pBuf[2u * m] = (br * wr) - (bi * wi);
+    pBuf[(2u * m) + 1u] = (br * wi) + (bi * wr);
+  }
+
+  /*  Complex FFT of N/2 points */
+  arm_cfft_f32(&S->Scfft, pBuf);
+
+  /*  Post-rotation by exp(-j*pi*k/N): the real part to 2k, the negated imaginary part to N-1-2k */
+  for (n = 0u; n < (N >> 2u); n++)
+  {
+    m = (N >> 1u) - 1u - n;
+
+    c = pCoef[2u * n * modifier];
+    s = pCoef[(2u * n * modifier) + 1u];
+    ar = (pBuf[2u * n] * c) + (pBuf[(2u * n) + 1u] * s);
+    ai = (pBuf[2u * n] * s) - (pBuf[(2u * n) + 1u] * c);
+
+    c = pCoef[2u * m * modifier];
+    s = pCoef[(2u * m * modifier) + 1u];
+    br = (pBuf[2u * m] * c) + (pBuf[(2u * m) + 1u] * s);
+    bi = (pBuf[2u * m] * s) - (pBuf[(2u * m) + 1u] * c);
+
+    pBuf[2u * n] = ar;
+    pBuf[N - 1u - (2u * n)] = ai;
+    pBuf[2u * m] = br;
+    pBuf[N - 1u - (2u * m)] = bi;
+  }
+}
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_mdct_init_f32.c
+*
+* Description:	Floating point MDCT and IMDCT initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MDCT_IMDCT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point MDCT/IMDCT.
+ * @param[in,out] *S        points to an instance of the floating-point MDCT/IMDCT structure.
+ * @param[in]     N         number of coefficients, half of the frame length.
+ * @param[in]     *pWindow  points to the window, <code>2*N</code> coefficients.
+ * @param[in]     *pState   points to the state buffer of <code>N</code> samples.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * Supported lengths are N = 32, 64, 128, 256, 512, 1024 and 2048, up to ARM_RFFT_TWIDDLE_MAX_LEN/2.
+ * The rotations exp(-j*pi*n/N) are the entries <code>n*(ARM_RFFT_TWIDDLE_MAX_LEN/2)/N</code> of
+ * ARM_RFFT_TWIDDLE_MAX (twiddleCoef_rfft_4096 by default), the internal CFFT of N/2
+ * points is initialized by arm_cfft_init_f32(). The state buffer is cleared.
+ */
+
+arm_status arm_mdct_init_f32(
+  arm_mdct_instance_f32 * S,
+  uint16_t N,
+  const float32_t * pWindow,
+  float32_t * pState)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  S->N = N;
+  S->pWindow = pWindow;
+  S->pState = pState;
+  S->pTwiddle = ARM_RFFT_TWIDDLE_MAX;
+
+  /*  Rotation by pi/(4N), the offset of the pre-rotation */
+  switch (N)
+  {
+  case 2048u:
+    S->cosOffset = 0.9999999265f;
+    S->sinOffset = 0.0003834952f;
+    break;
+
+  case 1024u:
+    S->cosOffset = 0.9999997059f;
+    S->sinOffset = 0.0007669903f;
+    break;
+
+  case 512u:
+    S->cosOffset = 0.9999988235f;
+    S->sinOffset = 0.0015339802f;
+    break;
+
+  case 256u:
+    S->cosOffset = 0.9999952938f;
+    S->sinOffset = 0.0030679568f;
+    break;
+
+  case 128u:
+    S->cosOffset = 0.9999811753f;
+    S->sinOffset = 0.0061358846f;
+    break;
+
+  case 64u:
+    S->cosOffset = 0.9999247018f;
+    S->sinOffset = 0.0122715383f;
+    break;
+
+  case 32u:
+    S->cosOffset = 0.9996988187f;
+    S->sinOffset = 0.0245412285f;
+    break;
+
+  default:
+    /*  Reporting argument error if N is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  /*  The rotations of N coefficients are read in a table of at least 2N points */
+  if(N > (ARM_RFFT_TWIDDLE_MAX_LEN / 2u))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    S->twidCoefModifier = (uint16_t) ((ARM_RFFT_TWIDDLE_MAX_LEN / 2u) / N);
+    S->normalize = 2.0f / (float32_t) N;
+
+    /*  Internal CFFT of N/2 points, forward, with the bit reversal */
+    status = arm_cfft_init_f32(&S->Scfft, (uint16_t) (N >> 1u), 0u, 1u);
+
+    /*  Clear the state buffer */
+    memset(pState, 0, N * sizeof(float32_t));
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of MDCT_IMDCT group
+ */
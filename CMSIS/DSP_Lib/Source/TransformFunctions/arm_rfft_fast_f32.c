@@ -0,0 +1,345 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rfft_fast_f32.c
+*
+* Description:	In-place RFFT & RIFFT Floating point process function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+static void arm_split_rfft_fast_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  const float32_t * pCoef);
+
+static void arm_split_rifft_fast_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  const float32_t * pCoef);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup RFFT_Fast In-place Real FFT Functions
+ *
+ * \par
+ * Real FFT and Real Inverse FFT of the power of two lengths from 32 to 4096, processed
+ * in-place in a buffer of <code>fftLen</code> values: no output buffer twice the length
+ * of the input and no scratch as arm_rfft_f32() needs.
+ *
+ * \par
+ * The N real values are read as N/2 complex values z[m] = x[2m] + j x[2m+1], transformed
+ * by the mixed radix CFFT of length N/2 (arm_cfft_f32()), then the split step gives the
+ * spectrum: with W = exp(-j 2 PI k / N),
+ * <pre>
+ *   X[k] = (Z[k] + conj(Z[N/2-k])) / 2 - j W (Z[k] - conj(Z[N/2-k])) / 2
+ * </pre>
+ * Each pass of the split step reads the bins k and N/2-k and writes both back, so the
+ * spectrum replaces the CFFT output with no extra memory.
+ *
+ * \par
+ * The spectrum of a real sequence is conjugate symmetric, the N/2+1 bins 0 to N/2 hold it
+ * all and the bins 0 and N/2 are real. The output is packed in the N values of the input:
+ * <pre>{real(0), real(N/2), real(1), imag(1), real(2), imag(2), ..., real(N/2-1), imag(N/2-1)}</pre>
+ * The RIFFT takes the same packing and gives the N real values back: the forward then the
+ * inverse transform return the input, the 1/N scaling is included in the inverse.
+ *
+ * \par
+ * arm_rfft_fast_mag_f32() computes the split step and the magnitude of each bin in one
+ * pass, where arm_rfft_fast_f32() followed by arm_cmplx_mag_f32() would write the spectrum
+ * and read it back.
+ *
+ * \par Instance Structure
+ * A separate instance structure must be defined for each transform length, initialized
+ * by arm_rfft_fast_init_f32(). The same instance computes the RFFT and the RIFFT.
+ */
+
+/**
+ * @addtogroup RFFT_Fast
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point in-place RFFT/RIFFT.
+ * @param[in]      *S       points to an instance of the floating-point in-place RFFT/RIFFT structure.
+ * @param[in, out] *pSrc    points to the buffer of <code>fftLen</code> values. Processing occurs in-place.
+ * @param[in]      ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return none.
+ *
+ * \par
+ * The forward transform overwrites the real sequence by its packed spectrum, the inverse
+ * transform the packed spectrum by the real sequence.
+ */
+
+void arm_rfft_fast_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  float32_t * pSrc,
+  uint8_t ifftFlag)
+{
+  arm_cfft_instance_f32 Sint;
+
+  if(ifftFlag == 1u)
+  {
+    /*  Merge the spectrum into the one of the N/2 complex values */
+    arm_split_rifft_fast_f32(pSrc, S->fftLenRFFT, S->pTwiddleRFFT);
+
+    /*  Complex IFFT of N/2 points, including the 1/(N/2) scaling */
+    Sint = S->Sint;
+    Sint.ifftFlag = 1u;
+    arm_cfft_f32(&Sint, pSrc);
+  }
+  else
+  {
+    /*  Complex FFT of N/2 points */
+    arm_cfft_f32(&S->Sint, pSrc);
+
+    /*  Split the CFFT output into the spectrum of the real sequence */
+    arm_split_rfft_fast_f32(pSrc, S->fftLenRFFT, S->pTwiddleRFFT);
+  }
+}
+
+/**
+ * @brief Magnitude spectrum of a real sequence.
+ * @param[in]      *S    points to an instance of the floating-point in-place RFFT/RIFFT structure.
+ * @param[in, out] *pSrc points to the real sequence of <code>fftLen</code> values, overwritten by the CFFT.
+ * @param[out]     *pMag points to the output buffer of <code>fftLen/2</code> magnitudes.
+ * @return none.
+ *
+ * \par
+ * pMag[k] is the magnitude |X[k]| of the bin k, for k = 0 to fftLen/2-1. The bin fftLen/2
+ * is not written, so that the output is the length of the usual spectrum display. The
+ * magnitudes are not scaled.
+ */
+
+void arm_rfft_fast_mag_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMag)
+{
+  const float32_t *pCoef = S->pTwiddleRFFT;
+  float32_t *pA, *pB;
+  float32_t er, ei, tr, ti, odr, odi, c, s;
+  uint32_t M = (uint32_t) S->fftLenRFFT >> 1u;
+  uint32_t k;
+
+  /*  Complex FFT of N/2 points */
+  arm_cfft_f32(&S->Sint, pSrc);
+
+  /*  Bin 0, real: the sum of the real and imaginary parts of Z[0] */
+  er = pSrc[0] + pSrc[1];
+  pMag[0] = (er < 0.0f) ? -er : er;
+
+  /*  Bin N/4: conj(Z[N/4]) */
+  arm_sqrt_f32((pSrc[M] * pSrc[M]) + (pSrc[M + 1u] * pSrc[M + 1u]), &pMag[M >> 1u]);
+
+  pA = pSrc + 2u;
+  pB = pSrc + (2u * (M - 1u));
+
+  for (k = 1u; k < (M >> 1u); k++)
+  {
+    c = pCoef[2u * k];
+    s = pCoef[(2u * k) + 1u];
+
+    /*  E = (Z[k] + conj(Z[M-k])) / 2, O = (Z[k] - conj(Z[M-k])) / 2 */
+    er = 0.5f * (pA[0] + pB[0]);
+    ei = 0.5f * (pA[1] - pB[1]);
+    odr = 0.5f * (pA[0] - pB[0]);
+    odi = 0.5f * (pA[1] + pB[1]);
+
+    /*  T = -j W O */
+    tr = (c * odi) - (s * odr);
+    ti = -((c * odr) + (s * odi));
+
+    /*  |X[k]| = |E + T|, |X[M-k]| = |E - T| */
+    arm_sqrt_f32(((er + tr) * (er + tr)) + ((ei + ti) * (ei + ti)), &pMag[k]);
+    arm_sqrt_f32(((er - tr) * (er - tr)) + ((ei - ti) * (ei - ti)), &pMag[M - k]);
+
+    pA += 2u;
+    pB -= 2u;
+  }
+}
+
+/**
+ * @brief Power spectrum of a real sequence.
+ * @param[in]      *S    points to an instance of the floating-point in-place RFFT/RIFFT structure.
+ * @param[in, out] *pSrc points to the real sequence of <code>fftLen</code> values, overwritten by the CFFT.
+ * @param[out]     *pPow points to the output buffer of <code>fftLen/2</code> squared magnitudes.
+ * @return none.
+ *
+ * \par
+ * pPow[k] is |X[k]|^2, for k = 0 to fftLen/2-1 as arm_rfft_fast_mag_f32(), without the
+ * square roots: the power spectrum of spectrograms and band energies.
+ */
+
+void arm_rfft_fast_power_f32(
+  const arm_rfft_fast_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pPow)
+{
+  const float32_t *pCoef = S->pTwiddleRFFT;
+  float32_t *pA, *pB;
+  float32_t er, ei, tr, ti, odr, odi, c, s;
+  uint32_t M = (uint32_t) S->fftLenRFFT >> 1u;
+  uint32_t k;
+
+  /*  Complex FFT of N/2 points */
+  arm_cfft_f32(&S->Sint, pSrc);
+
+  /*  Bin 0, real: the sum of the real and imaginary parts of Z[0] */
+  er = pSrc[0] + pSrc[1];
+  pPow[0] = er * er;
+
+  /*  Bin N/4: conj(Z[N/4]) */
+  pPow[M >> 1u] = (pSrc[M] * pSrc[M]) + (pSrc[M + 1u] * pSrc[M + 1u]);
+
+  pA = pSrc + 2u;
+  pB = pSrc + (2u * (M - 1u));
+
+  for (k = 1u; k < (M >> 1u); k++)
+  {
+    c = pCoef[2u * k];
+    s = pCoef[(2u * k) + 1u];
+
+    /*  E = (Z[k] + conj(Z[M-k])) / 2, O = (Z[k] - conj(Z[M-k])) / 2 */
+    er = 0.5f * (pA[0] + pB[0]);
+    ei = 0.5f * (pA[1] - pB[1]);
+    odr = 0.5f * (pA[0] - pB[0]);
+    odi = 0.5f * (pA[1] + pB[1]);
+
+    /*  T = -j W O */
+    tr = (c * odi) - (s * odr);
+    ti = -((c * odr) + (s * odi));
+
+    /*  |X[k]|^2 = |E + T|^2, |X[M-k]|^2 = |E - T|^2 */
+    pPow[k] = ((er + tr) * (er + tr)) + ((ei + ti) * (ei + ti));
+    pPow[M - k] = ((er - tr) * (er - tr)) + ((ei - ti) * (ei - ti));
+
+    pA += 2u;
+    pB -= 2u;
+  }
+}
+
+/**
+ * @} end of RFFT_Fast group
+ */
+
+/*
+ * @brief  In-place split step of the RFFT.
+ * @param[in, out] *p      points to the CFFT output, overwritten by the packed spectrum.
+ * @param[in]      fftLen  length of the real sequence.
+ * @param[in]      *pCoef  points to the twiddles cos, sin of the bins 0 to fftLen/4-1.
+ * @return none.
+ */
+
+static void arm_split_rfft_fast_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  const float32_t * pCoef)
+{
+  float32_t *pA, *pB;
+  float32_t er, ei, tr, ti, odr, odi, c, s;
+  uint32_t M = fftLen >> 1u;
+  uint32_t k;
+
+  /*  Bins 0 and N/2, both real, packed in the place of Z[0] */
+  er = p[0];
+  ei = p[1];
+  p[0] = er + ei;
+  p[1] = er - ei;
+
+  /*  Bin N/4 = conj(Z[N/4]) */
+  p[M + 1u] = -p[M + 1u];
+
+  pA = p + 2u;
+  pB = p + (2u * (M - 1u));
+
+  for (k = 1u; k < (M >> 1u); k++)
+  {
+    c = pCoef[2u * k];
+    s = pCoef[(2u * k) + 1u];
+
+    /*  E = (Z[k] + conj(Z[M-k])) / 2, O = (Z[k] - conj(Z[M-k])) / 2 */
+    er = 0.5f * (pA[0] + pB[0]);
+    ei = 0.5f * (pA[1] - pB[1]);
+    odr = 0.5f * (pA[0] - pB[0]);
+    odi = 0.5f * (pA[1] + pB[1]);
+
+    /*  T = -j W O */
+    tr = (c * odi) - (s * odr);
+    ti = -((c * odr) + (s * odi));
+
+    /*  X[k] = E + T, X[M-k] = conj(E - T) */
+    pA[0] = er + tr;
+    pA[1] = ei + ti;
+    pB[0] = er - tr;
+    pB[1] = ti - ei;
+
+    pA += 2u;
+    pB -= 2u;
+  }
+}
+
+/*
+ * @brief  In-place merge step of the RIFFT, inverse of the split step.
+ * @param[in, out] *p      points to the packed spectrum, overwritten by the CFFT input.
+ * @param[in]      fftLen  length of the real sequence.
+ * @param[in]      *pCoef  points to the twiddles cos, sin of the bins 0 to fftLen/4-1.
+ * @return none.
+ */
+
+static void arm_split_rifft_fast_f32(
+  float32_t * p,
+  uint32_t fftLen,
+  const float32_t * pCoef)
+{
+  float32_t *pA, *pB;
+  float32_t er, ei, tr, ti, ur, ui, c, s;
+  uint32_t M = fftLen >> 1u;
+  uint32_t k;
+
+  /*  Z[0] from the bins 0 and N/2 */
+  er = p[0];
+  ei = p[1];
+  p[0] = 0.5f * (er + ei);
+  p[1] = 0.5f * (er - ei);
+
+  /*  Z[N/4] = conj(X[N/4]) */
+  p[M + 1u] = -p[M + 1u];
+
+  pA = p + 2u;
+  pB = p + (2u * (M - 1u));
+
+  for (k = 1u; k < (M >> 1u); k++)
+  {
+    c = pCoef[2u * k];
+    s = pCoef[(2u * k) + 1u];
+
+    /*  E = (X[k] + conj(X[M-k])) / 2, T = (X[k] - conj(X[M-k])) / 2 */
+    er = 0.5f * (pA[0] + pB[0]);
+    ei = 0.5f * (pA[1] - pB[1]);
+    tr = 0.5f * (pA[0] - pB[0]);
+    ti = 0.5f * (pA[1] + pB[1]);
+
+    /*  U = conj(W) T */
+    ur = (c * tr) - (s * ti);
+    ui = (c * ti) + (s * tr);
+
+    /*  Z[k] = E + j U, Z[M-k] = conj(E - j U) */
+    pA[0] = er - ui;
+    pA[1] = ei + ur;
+    pB[0] = er + ui;
+    pB[1] = ur - ei;
+
+    pA += 2u;
+    pB -= 2u;
+  }
+}
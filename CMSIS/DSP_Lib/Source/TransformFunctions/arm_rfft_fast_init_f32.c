@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_rfft_fast_init_f32.c
+*
+* Description:	In-place RFFT & RIFFT Floating point initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RFFT_Fast
+ * @{
+ */
+
+/**
+* @brief  Initialization function for the floating-point in-place RFFT/RIFFT.
+* @param[in,out] *S      points to an instance of the floating-point in-place RFFT/RIFFT structure.
+* @param[in]     fftLen  length of the real sequence.
+* @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+*
+* \par Description:
+* \par
+* The parameter <code>fftLen</code>	Specifies length of RFFT/RIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096, up to twice ARM_MATH_MAX_FFT_LEN.
+* \par
+* The internal CFFT of length fftLen/2 is initialized by arm_cfft_init_f32(), forward and
+* with the bit reversal, the inverse transform selects the CIFFT at run time.
+*/
+
+arm_status arm_rfft_fast_init_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen)
+{
+  /*  Initialise the default arm status */
+  arm_status status = ARM_MATH_SUCCESS;
+
+  /*  Initialise the RFFT length */
+  S->fftLenRFFT = fftLen;
+
+  /*  Initializations of the split step twiddles depending on the FFT length */
+  switch (fftLen)
+  {
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
+  case 4096u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_4096;
+    break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+  case 2048u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_2048;
+    break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 512)
+  case 1024u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_1024;
+    break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
+  case 512u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_512;
+    break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 128)
+  case 256u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_256;
+    break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
+  case 128u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_128;
+    break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 32)
+  case 64u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_64;
+    break;
+#endif
+  case 32u:
+    S->pTwiddleRFFT = twiddleCoef_rfft_32;
+    break;
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    status = ARM_MATH_ARGUMENT_ERROR;
+    break;
+  }
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    /*  Internal complex FFT of half the length */
+    status = arm_cfft_init_f32(&S->Sint, fftLen >> 1u, 0u, 1u);
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of RFFT_Fast group
+ */
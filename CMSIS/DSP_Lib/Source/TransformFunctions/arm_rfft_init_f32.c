@@ -35,6 +35,7 @@
 
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**    
  * @ingroup groupTransforms    
@@ -49,7 +50,7 @@
 * \par    
 * Generation of realCoefA array:    
 * \par    
-* 	n = 4096    
+* 	n = ARM_MATH_MAX_FFT_LEN (4096 by default)    
 * <pre>for (i = 0; i < n; i++)    
 *  {    
 *    pATable[2 * i] = 0.5 * (1.0 - sin (2 * PI / (double) (2 * n) * (double) i));    
@@ -59,6 +60,8 @@
 
 
 
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
+
 static const float32_t realCoefA[8192] = {
   0.500000000000000f, -0.500000000000000f, 0.499616503715515f,
     -0.499999850988388f,
@@ -4158,12 +4161,701 @@ static const float32_t realCoefA[8192] = {
     0.499999850988388f,
 };
 
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+
+static const float32_t realCoefA[2048] = {
+  0.500000000000000f, -0.500000000000000f, 0.498466014862061f, -0.499997645616531f,
+  0.496932059526443f, -0.499990582466125f, 0.495398133993149f, -0.499978810548782f,
+  0.493864238262177f, -0.499962359666824f, 0.492330402135849f, -0.499941170215607f,
+  0.490796625614166f, -0.499915301799774f, 0.489262968301773f, -0.499884694814682f,
+  0.487729400396347f, -0.499849408864975f, 0.486195921897888f, -0.499809414148331f,
+  0.484662592411041f, -0.499764710664749f, 0.483129411935806f, -0.499715298414230f,
+  0.481596380472183f, -0.499661177396774f, 0.480063527822495f, -0.499602377414703f,
+  0.478530883789063f, -0.499538868665695f, 0.476998418569565f, -0.499470651149750f,
+  0.475466161966324f, -0.499397724866867f, 0.473934143781662f, -0.499320119619370f,
+  0.472402364015579f, -0.499237775802612f, 0.470870882272720f, -0.499150782823563f,
+  0.469339638948441f, -0.499059051275253f, 0.467808693647385f, -0.498962640762329f,
+  0.466278046369553f, -0.498861521482468f, 0.464747726917267f, -0.498755723237991f,
+  0.463217705488205f, -0.498645216226578f, 0.461688071489334f, -0.498530030250549f,
+  0.460158795118332f, -0.498410135507584f, 0.458629876375198f, -0.498285561800003f,
+  0.457101345062256f, -0.498156309127808f, 0.455573230981827f, -0.498022347688675f,
+  0.454045534133911f, -0.497883707284927f, 0.452518254518509f, -0.497740387916565f,
+  0.450991421937943f, -0.497592359781265f, 0.449465066194534f, -0.497439652681351f,
+  0.447939187288284f, -0.497282296419144f, 0.446413785219193f, -0.497120231389999f,
+  0.444888889789581f, -0.496953487396240f, 0.443364530801773f, -0.496782064437866f,
+  0.441840678453445f, -0.496605962514877f, 0.440317392349243f, -0.496425211429596f,
+  0.438794672489166f, -0.496239781379700f, 0.437272518873215f, -0.496049642562866f,
+  0.435750931501389f, -0.495854884386063f, 0.434229999780655f, -0.495655417442322f,
+  0.432709634304047f, -0.495451331138611f, 0.431189924478531f, -0.495242536067963f,
+  0.429670870304108f, -0.495029091835022f, 0.428152471780777f, -0.494810998439789f,
+  0.426634758710861f, -0.494588255882263f, 0.425117731094360f, -0.494360834360123f,
+  0.423601418733597f, -0.494128793478012f, 0.422085791826248f, -0.493892073631287f,
+  0.420570939779282f, -0.493650704622269f, 0.419056802988052f, -0.493404686450958f,
+  0.417543441057205f, -0.493154048919678f, 0.416030853986740f, -0.492898762226105f,
+  0.414519041776657f, -0.492638826370239f, 0.413008064031601f, -0.492374241352081f,
+  0.411497890949249f, -0.492105036973953f, 0.409988552331924f, -0.491831213235855f,
+  0.408480048179626f, -0.491552740335464f, 0.406972438097000f, -0.491269648075104f,
+  0.405465662479401f, -0.490981936454773f, 0.403959810733795f, -0.490689605474472f,
+  0.402454853057861f, -0.490392625331879f, 0.400950789451599f, -0.490091055631638f,
+  0.399447679519653f, -0.489784896373749f, 0.397945523262024f, -0.489474087953568f,
+  0.396444320678711f, -0.489158689975739f, 0.394944071769714f, -0.488838672637939f,
+  0.393444836139679f, -0.488514065742493f, 0.391946613788605f, -0.488184869289398f,
+  0.390449374914169f, -0.487851053476334f, 0.388953179121017f, -0.487512677907944f,
+  0.387458056211472f, -0.487169682979584f, 0.385963946580887f, -0.486822128295898f,
+  0.384470939636230f, -0.486469984054565f, 0.382979035377502f, -0.486113250255585f,
+  0.381488204002380f, -0.485751956701279f, 0.379998475313187f, -0.485386073589325f,
+  0.378509908914566f, -0.485015630722046f, 0.377022475004196f, -0.484640628099442f,
+  0.375536203384399f, -0.484261035919189f, 0.374051094055176f, -0.483876913785934f,
+  0.372567176818848f, -0.483488231897354f, 0.371084451675415f, -0.483094990253448f,
+  0.369602948427200f, -0.482697218656540f, 0.368122667074203f, -0.482294887304306f,
+  0.366643607616425f, -0.481888025999069f, 0.365165829658508f, -0.481476634740829f,
+  0.363689333200455f, -0.481060713529587f, 0.362214088439941f, -0.480640232563019f,
+  0.360740154981613f, -0.480215251445770f, 0.359267532825470f, -0.479785770177841f,
+  0.357796221971512f, -0.479351729154587f, 0.356326282024384f, -0.478913217782974f,
+  0.354857653379440f, -0.478470176458359f, 0.353390425443649f, -0.478022634983063f,
+  0.351924568414688f, -0.477570593357086f, 0.350460082292557f, -0.477114051580429f,
+  0.348997026681900f, -0.476653009653091f, 0.347535371780396f, -0.476187497377396f,
+  0.346075177192688f, -0.475717514753342f, 0.344616413116455f, -0.475243031978607f,
+  0.343159139156342f, -0.474764078855515f, 0.341703325510025f, -0.474280685186386f,
+  0.340248972177505f, -0.473792791366577f, 0.338796168565750f, -0.473300457000732f,
+  0.337344855070114f, -0.472803652286530f, 0.335895091295242f, -0.472302407026291f,
+  0.334446847438812f, -0.471796721220016f, 0.333000183105469f, -0.471286594867706f,
+  0.331555068492889f, -0.470772027969360f, 0.330111563205719f, -0.470253020524979f,
+  0.328669637441635f, -0.469729602336884f, 0.327229350805283f, -0.469201773405075f,
+  0.325790673494339f, -0.468669503927231f, 0.324353635311127f, -0.468132823705673f,
+  0.322918236255646f, -0.467591762542725f, 0.321484506130219f, -0.467046260833740f,
+  0.320052474737167f, -0.466496407985687f, 0.318622142076492f, -0.465942144393921f,
+  0.317193508148193f, -0.465383470058441f, 0.315766572952271f, -0.464820444583893f,
+  0.314341396093369f, -0.464253038167953f, 0.312917977571487f, -0.463681250810623f,
+  0.311496287584305f, -0.463105112314224f, 0.310076385736465f, -0.462524622678757f,
+  0.308658272027969f, -0.461939752101898f, 0.307241976261139f, -0.461350560188293f,
+  0.305827468633652f, -0.460757017135620f, 0.304414808750153f, -0.460159152746201f,
+  0.303003966808319f, -0.459556937217712f, 0.301595002412796f, -0.458950400352478f,
+  0.300187885761261f, -0.458339542150497f, 0.298782676458359f, -0.457724362611771f,
+  0.297379344701767f, -0.457104891538620f, 0.295977920293808f, -0.456481099128723f,
+  0.294578403234482f, -0.455853015184402f, 0.293180853128433f, -0.455220639705658f,
+  0.291785210371017f, -0.454584002494812f, 0.290391564369202f, -0.453943043947220f,
+  0.288999855518341f, -0.453297853469849f, 0.287610173225403f, -0.452648371458054f,
+  0.286222457885742f, -0.451994657516479f, 0.284836769104004f, -0.451336652040482f,
+  0.283453077077866f, -0.450674414634705f, 0.282071471214294f, -0.450007945299149f,
+  0.280691891908646f, -0.449337244033813f, 0.279314368963242f, -0.448662281036377f,
+  0.277938932180405f, -0.447983115911484f, 0.276565581560135f, -0.447299748659134f,
+  0.275194346904755f, -0.446612149477005f, 0.273825198411942f, -0.445920348167419f,
+  0.272458195686340f, -0.445224374532700f, 0.271093338727951f, -0.444524168968201f,
+  0.269730657339096f, -0.443819820880890f, 0.268370121717453f, -0.443111270666122f,
+  0.267011761665344f, -0.442398548126221f, 0.265655577182770f, -0.441681683063507f,
+  0.264301627874374f, -0.440960645675659f, 0.262949883937836f, -0.440235435962677f,
+  0.261600375175476f, -0.439506113529205f, 0.260253131389618f, -0.438772648572922f,
+  0.258908122777939f, -0.438035041093826f, 0.257565379142761f, -0.437293320894241f,
+  0.256224930286407f, -0.436547487974167f, 0.254886746406555f, -0.435797542333603f,
+  0.253550916910172f, -0.435043483972549f, 0.252217382192612f, -0.434285342693329f,
+  0.250886172056198f, -0.433523118495941f, 0.249557301402092f, -0.432756811380386f,
+  0.248230814933777f, -0.431986421346664f, 0.246906682848930f, -0.431211978197098f,
+  0.245584934949875f, -0.430433481931686f, 0.244265571236610f, -0.429650902748108f,
+  0.242948621511459f, -0.428864300251007f, 0.241634100675583f, -0.428073674440384f,
+  0.240322008728981f, -0.427278995513916f, 0.239012360572815f, -0.426480293273926f,
+  0.237705156207085f, -0.425677597522736f, 0.236400425434113f, -0.424870878458023f,
+  0.235098183155060f, -0.424060165882111f, 0.233798429369926f, -0.423245459794998f,
+  0.232501193881035f, -0.422426789999008f, 0.231206461787224f, -0.421604126691818f,
+  0.229914262890816f, -0.420777499675751f, 0.228624612092972f, -0.419946908950806f,
+  0.227337509393692f, -0.419112354516983f, 0.226052969694138f, -0.418273866176605f,
+  0.224771007895470f, -0.417431443929672f, 0.223491653800011f, -0.416585087776184f,
+  0.222214877605438f, -0.415734797716141f, 0.220940738916397f, -0.414880603551865f,
+  0.219669207930565f, -0.414022535085678f, 0.218400329351425f, -0.413160532712936f,
+  0.217134088277817f, -0.412294656038284f, 0.215870529413223f, -0.411424905061722f,
+  0.214609622955322f, -0.410551249980927f, 0.213351413607597f, -0.409673750400543f,
+  0.212095901370049f, -0.408792406320572f, 0.210843101143837f, -0.407907217741013f,
+  0.209593027830124f, -0.407018154859543f, 0.208345666527748f, -0.406125307083130f,
+  0.207101076841354f, -0.405228585004807f, 0.205859228968620f, -0.404328078031540f,
+  0.204620152711868f, -0.403423786163330f, 0.203383848071098f, -0.402515679597855f,
+  0.202150344848633f, -0.401603758335114f, 0.200919643044472f, -0.400688081979752f,
+  0.199691757559776f, -0.399768620729446f, 0.198466703295708f, -0.398845434188843f,
+  0.197244480252266f, -0.397918462753296f, 0.196025103330612f, -0.396987736225128f,
+  0.194808602333069f, -0.396053284406662f, 0.193594962358475f, -0.395115107297897f,
+  0.192384198307991f, -0.394173204898834f, 0.191176339983940f, -0.393227607011795f,
+  0.189971387386322f, -0.392278283834457f, 0.188769355416298f, -0.391325294971466f,
+  0.187570258975029f, -0.390368610620499f, 0.186374098062515f, -0.389408260583878f,
+  0.185180887579918f, -0.388444244861603f, 0.183990627527237f, -0.387476563453674f,
+  0.182803362607956f, -0.386505216360092f, 0.181619063019753f, -0.385530263185501f,
+  0.180437773466110f, -0.384551674127579f, 0.179259493947029f, -0.383569449186325f,
+  0.178084224462509f, -0.382583618164063f, 0.176911994814873f, -0.381594210863113f,
+  0.175742805004120f, -0.380601197481155f, 0.174576655030251f, -0.379604607820511f,
+  0.173413574695587f, -0.378604412078857f, 0.172253578901291f, -0.377600699663162f,
+  0.171096652746201f, -0.376593410968781f, 0.169942826032639f, -0.375582575798035f,
+  0.168792113661766f, -0.374568194150925f, 0.167644515633583f, -0.373550295829773f,
+  0.166500031948090f, -0.372528880834579f, 0.165358707308769f, -0.371503978967667f,
+  0.164220526814461f, -0.370475560426712f, 0.163085505366325f, -0.369443655014038f,
+  0.161953642964363f, -0.368408292531967f, 0.160824984312058f, -0.367369443178177f,
+  0.159699499607086f, -0.366327136754990f, 0.158577233552933f, -0.365281373262405f,
+  0.157458171248436f, -0.364232182502747f, 0.156342327594757f, -0.363179564476013f,
+  0.155229732394218f, -0.362123548984528f, 0.154120370745659f, -0.361064106225967f,
+  0.153014272451401f, -0.360001266002655f, 0.151911437511444f, -0.358935028314590f,
+  0.150811880826950f, -0.357865422964096f, 0.149715602397919f, -0.356792420148849f,
+  0.148622632026672f, -0.355716109275818f, 0.147532954812050f, -0.354636400938034f,
+  0.146446615457535f, -0.353553384542465f, 0.145363584160805f, -0.352467030286789f,
+  0.144283905625343f, -0.351377367973328f, 0.143207564949989f, -0.350284397602081f,
+  0.142134591937065f, -0.349188119173050f, 0.141064971685410f, -0.348088562488556f,
+  0.139998748898506f, -0.346985727548599f, 0.138935908675194f, -0.345879614353180f,
+  0.137876465916634f, -0.344770282506943f, 0.136820420622826f, -0.343657672405243f,
+  0.135767802596092f, -0.342541843652725f, 0.134718611836433f, -0.341422766447067f,
+  0.133672863245010f, -0.340300500392914f, 0.132630556821823f, -0.339175015687943f,
+  0.131591722369194f, -0.338046342134476f, 0.130556344985962f, -0.336914509534836f,
+  0.129524439573288f, -0.335779488086700f, 0.128496021032333f, -0.334641307592392f,
+  0.127471104264259f, -0.333499968051910f, 0.126449704170227f, -0.332355499267578f,
+  0.125431805849075f, -0.331207901239395f, 0.124417431652546f, -0.330057173967361f,
+  0.123406603932381f, -0.328903347253799f, 0.122399315237999f, -0.327746421098709f,
+  0.121395580470562f, -0.326586425304413f, 0.120395407080650f, -0.325423330068588f,
+  0.119398809969425f, -0.324257194995880f, 0.118405789136887f, -0.323088020086288f,
+  0.117416366934776f, -0.321915775537491f, 0.116430543363094f, -0.320740520954132f,
+  0.115448333323002f, -0.319562226533890f, 0.114469736814499f, -0.318380922079086f,
+  0.113494776189327f, -0.317196637392044f, 0.112523443996906f, -0.316009372472763f,
+  0.111555770039558f, -0.314819127321243f, 0.110591746866703f, -0.313625901937485f,
+  0.109631389379501f, -0.312429755926132f, 0.108674705028534f, -0.311230629682541f,
+  0.107721701264381f, -0.310028612613678f, 0.106772392988205f, -0.308823645114899f,
+  0.105826787650585f, -0.307615786790848f, 0.104884892702103f, -0.306405037641525f,
+  0.103946708142757f, -0.305191397666931f, 0.103012263774872f, -0.303974896669388f,
+  0.102081544697285f, -0.302755534648895f, 0.101154580712318f, -0.301533311605453f,
+  0.100231364369392f, -0.300308227539063f, 0.099311910569668f, -0.299080342054367f,
+  0.098396234214306f, -0.297849655151367f, 0.097484335303307f, -0.296616137027740f,
+  0.096576221287251f, -0.295379847288132f, 0.095671907067299f, -0.294140785932541f,
+  0.094771400094032f, -0.292898923158646f, 0.093874707818031f, -0.291654318571091f,
+  0.092981837689877f, -0.290406972169876f, 0.092092797160149f, -0.289156883955002f,
+  0.091207593679428f, -0.287904083728790f, 0.090326242148876f, -0.286648571491241f,
+  0.089448742568493f, -0.285390377044678f, 0.088575109839439f, -0.284129470586777f,
+  0.087705351412296f, -0.282865911722183f, 0.086839467287064f, -0.281599670648575f,
+  0.085977479815483f, -0.280330777168274f, 0.085119381546974f, -0.279059261083603f,
+  0.084265194833279f, -0.277785122394562f, 0.083414919674397f, -0.276508361101151f,
+  0.082568563520908f, -0.275228977203369f, 0.081726133823395f, -0.273947030305862f,
+  0.080887645483017f, -0.272662490606308f, 0.080053105950356f, -0.271375387907028f,
+  0.079222507774830f, -0.270085722208023f, 0.078395880758762f, -0.268793523311615f,
+  0.077573217451572f, -0.267498821020126f, 0.076754532754421f, -0.266201555728912f,
+  0.075939826667309f, -0.264901816844940f, 0.075129114091396f, -0.263599574565887f,
+  0.074322402477264f, -0.262294828891754f, 0.073519699275494f, -0.260987639427185f,
+  0.072721004486084f, -0.259678006172180f, 0.071926333010197f, -0.258365899324417f,
+  0.071135692298412f, -0.257051378488541f, 0.070349089801311f, -0.255734413862228f,
+  0.069566532969475f, -0.254415065050125f, 0.068788021802902f, -0.253093332052231f,
+  0.068013571202755f, -0.251769185066223f, 0.067243188619614f, -0.250442683696747f,
+  0.066476874053478f, -0.249113827943802f, 0.065714649856091f, -0.247782632708550f,
+  0.064956501126289f, -0.246449097990990f, 0.064202457666397f, -0.245113238692284f,
+  0.063452512025833f, -0.243775084614754f, 0.062706671655178f, -0.242434620857239f,
+  0.061964951455593f, -0.241091892123222f, 0.061227355152369f, -0.239746883511543f,
+  0.060493886470795f, -0.238399609923363f, 0.059764556586742f, -0.237050101161003f,
+  0.059039369225502f, -0.235698372125626f, 0.058318331837654f, -0.234344407916069f,
+  0.057601451873779f, -0.232988253235817f, 0.056888736784458f, -0.231629893183708f,
+  0.056180190294981f, -0.230269357562065f, 0.055475823581219f, -0.228906646370888f,
+  0.054775636643171f, -0.227541789412498f, 0.054079644382000f, -0.226174786686897f,
+  0.053387850522995f, -0.224805667996407f, 0.052700258791447f, -0.223434418439865f,
+  0.052016876637936f, -0.222061067819595f, 0.051337707787752f, -0.220685631036758f,
+  0.050662767142057f, -0.219308122992516f, 0.049992054700851f, -0.217928543686867f,
+  0.049325577914715f, -0.216546908020973f, 0.048663340508938f, -0.215163245797157f,
+  0.048005353659391f, -0.213777542114258f, 0.047351621091366f, -0.212389841675758f,
+  0.046702146530151f, -0.211000129580498f, 0.046056941151619f, -0.209608450531960f,
+  0.045416008681059f, -0.208214774727821f, 0.044779352843761f, -0.206819161772728f,
+  0.044146984815598f, -0.205421581864357f, 0.043518904596567f, -0.204022079706192f,
+  0.042895123362541f, -0.202620655298233f, 0.042275641113520f, -0.201217323541641f,
+  0.041660469025373f, -0.199812099337578f, 0.041049610823393f, -0.198404997587204f,
+  0.040443073958158f, -0.196996018290520f, 0.039840862154961f, -0.195585191249847f,
+  0.039242979139090f, -0.194172516465187f, 0.038649436086416f, -0.192758023738861f,
+  0.038060232996941f, -0.191341713070869f, 0.037475381046534f, -0.189923599362373f,
+  0.036894880235195f, -0.188503712415695f, 0.036318738013506f, -0.187082037329674f,
+  0.035746958106756f, -0.185658603906631f, 0.035179551690817f, -0.184233412146568f,
+  0.034616518765688f, -0.182806491851807f, 0.034057866781950f, -0.181377857923508f,
+  0.033503599464893f, -0.179947525262833f, 0.032953724265099f, -0.178515478968620f,
+  0.032408244907856f, -0.177081763744354f, 0.031867165118456f, -0.175646379590034f,
+  0.031330492347479f, -0.174209341406822f, 0.030798232182860f, -0.172770664095879f,
+  0.030270388349891f, -0.171330362558365f, 0.029746964573860f, -0.169888436794281f,
+  0.029227968305349f, -0.168444931507111f, 0.028713401407003f, -0.166999831795692f,
+  0.028203271329403f, -0.165553152561188f, 0.027697581797838f, -0.164104923605919f,
+  0.027196336537600f, -0.162655144929886f, 0.026699542999268f, -0.161203846335411f,
+  0.026207204908133f, -0.159751012921333f, 0.025719324126840f, -0.158296689391136f,
+  0.025235909968615f, -0.156840875744820f, 0.024756962433457f, -0.155383571982384f,
+  0.024282488971949f, -0.153924822807312f, 0.023812493309379f, -0.152464613318443f,
+  0.023346979171038f, -0.151002973318100f, 0.022885952144861f, -0.149539917707443f,
+  0.022429415956140f, -0.148075446486473f, 0.021977374330163f, -0.146609574556351f,
+  0.021529832854867f, -0.145142331719399f, 0.021086793392897f, -0.143673732876778f,
+  0.020648263394833f, -0.142203763127327f, 0.020214242860675f, -0.140732467174530f,
+  0.019784741103649f, -0.139259845018387f, 0.019359756261110f, -0.137785911560059f,
+  0.018939297646284f, -0.136310681700706f, 0.018523367121816f, -0.134834155440331f,
+  0.018111966550350f, -0.133356377482414f, 0.017705103382468f, -0.131877332925797f,
+  0.017302779480815f, -0.130397051572800f, 0.016904998570681f, -0.128915548324585f,
+  0.016511764377356f, -0.127432823181152f, 0.016123080626130f, -0.125948905944824f,
+  0.015738952904940f, -0.124463804066181f, 0.015359382145107f, -0.122977524995804f,
+  0.014984373003244f, -0.121490091085434f, 0.014613929204643f, -0.120001509785652f,
+  0.014248054474592f, -0.118511803448200f, 0.013886751607060f, -0.117020979523659f,
+  0.013530024327338f, -0.115529052913189f, 0.013177875429392f, -0.114036038517952f,
+  0.012830308638513f, -0.112541958689690f, 0.012487327679992f, -0.111046813428402f,
+  0.012148935347795f, -0.109550617635250f, 0.011815134435892f, -0.108053401112556f,
+  0.011485928669572f, -0.106555156409740f, 0.011161320842803f, -0.105055920779705f,
+  0.010841314680874f, -0.103555686771870f, 0.010525912046432f, -0.102054484188557f,
+  0.010215117596090f, -0.100552320480347f, 0.009908932261169f, -0.099049203097820f,
+  0.009607359766960f, -0.097545161843300f, 0.009310402907431f, -0.096040196716785f,
+  0.009018065407872f, -0.094534330070019f, 0.008730349130929f, -0.093027576804161f,
+  0.008447255939245f, -0.091519944369793f, 0.008168790489435f, -0.090011447668076f,
+  0.007894953712821f, -0.088502109050751f, 0.007625748869032f, -0.086991935968399f,
+  0.007361178752035f, -0.085480943322182f, 0.007101245224476f, -0.083969146013260f,
+  0.006845951545984f, -0.082456558942795f, 0.006595299113542f, -0.080943197011948f,
+  0.006349290721118f, -0.079429075121880f, 0.006107929162681f, -0.077914200723171f,
+  0.005871216300875f, -0.076398596167564f, 0.005639153998345f, -0.074882268905640f,
+  0.005411745049059f, -0.073365233838558f, 0.005188991315663f, -0.071847513318062f,
+  0.004970894660801f, -0.070329122245312f, 0.004757457878441f, -0.068810060620308f,
+  0.004548682365566f, -0.067290350794792f, 0.004344569984823f, -0.065770015120506f,
+  0.004145123064518f, -0.064249053597450f, 0.003950343467295f, -0.062727488577366f,
+  0.003760232590139f, -0.061205338686705f, 0.003574792761356f, -0.059682607650757f,
+  0.003394025377929f, -0.058159314095974f, 0.003217932302505f, -0.056635476648808f,
+  0.003046514932066f, -0.055111102759838f, 0.002879775362089f, -0.053586211055517f,
+  0.002717714523897f, -0.052060816437006f, 0.002560334512964f, -0.050534930080175f,
+  0.002407636726275f, -0.049008570611477f, 0.002259622327983f, -0.047481749206781f,
+  0.002116292715073f, -0.045954477041960f, 0.001977649517357f, -0.044426776468754f,
+  0.001843693898991f, -0.042898654937744f, 0.001714427140541f, -0.041370131075382f,
+  0.001589850406162f, -0.039841219782829f, 0.001469964860007f, -0.038311932235956f,
+  0.001354771666229f, -0.036782283335924f, 0.001244271872565f, -0.035252287983894f,
+  0.001138466643170f, -0.033721961081028f, 0.001037356909364f, -0.032191313803196f,
+  0.000940943544265f, -0.030660368502140f, 0.000849227537401f, -0.029129132628441f,
+  0.000762209703680f, -0.027597622945905f, 0.000679890916217f, -0.026065852493048f,
+  0.000602271873504f, -0.024533838033676f, 0.000529353390448f, -0.023001590743661f,
+  0.000461136136437f, -0.021469129249454f, 0.000397620693548f, -0.019936462864280f,
+  0.000338807702065f, -0.018403612077236f, 0.000284697714960f, -0.016870586201549f,
+  0.000235291256104f, -0.015337402001023f, 0.000190588747500f, -0.013804072514176f,
+  0.000150590654812f, -0.012270614504814f, 0.000115297327284f, -0.010737040080130f,
+  0.000084709099610f, -0.009203365072608f, 0.000058826273744f, -0.007669602986425f,
+  0.000037649078877f, -0.006135769188404f, 0.000021177724193f, -0.004601877182722f,
+  0.000009412358850f, -0.003067942336202f, 0.000002353095169f, -0.001533978385851f,
+  0.000000000000000f, -0.000000000000023f, 0.000002353095169f, 0.001533978385851f,
+  0.000009412358850f, 0.003067942336202f, 0.000021177724193f, 0.004601877182722f,
+  0.000037649078877f, 0.006135769188404f, 0.000058826273744f, 0.007669602986425f,
+  0.000084709099610f, 0.009203365072608f, 0.000115297327284f, 0.010737040080130f,
+  0.000150590654812f, 0.012270614504814f, 0.000190588747500f, 0.013804072514176f,
+  0.000235291256104f, 0.015337402001023f, 0.000284697714960f, 0.016870586201549f,
+  0.000338807702065f, 0.018403612077236f, 0.000397620693548f, 0.019936462864280f,
+  0.000461136136437f, 0.021469129249454f, 0.000529353390448f, 0.023001590743661f,
+  0.000602271873504f, 0.024533838033676f, 0.000679890916217f, 0.026065852493048f,
+  0.000762209703680f, 0.027597622945905f, 0.000849227537401f, 0.029129132628441f,
+  0.000940943544265f, 0.030660368502140f, 0.001037356909364f, 0.032191313803196f,
+  0.001138466643170f, 0.033721961081028f, 0.001244271872565f, 0.035252287983894f,
+  0.001354771666229f, 0.036782283335924f, 0.001469964860007f, 0.038311932235956f,
+  0.001589850406162f, 0.039841219782829f, 0.001714427140541f, 0.041370131075382f,
+  0.001843693898991f, 0.042898654937744f, 0.001977649517357f, 0.044426776468754f,
+  0.002116292715073f, 0.045954477041960f, 0.002259622327983f, 0.047481749206781f,
+  0.002407636726275f, 0.049008570611477f, 0.002560334512964f, 0.050534930080175f,
+  0.002717714523897f, 0.052060816437006f, 0.002879775362089f, 0.053586211055517f,
+  0.003046514932066f, 0.055111102759838f, 0.003217932302505f, 0.056635476648808f,
+  0.003394025377929f, 0.058159314095974f, 0.003574792761356f, 0.059682607650757f,
+  0.003760232590139f, 0.061205338686705f, 0.003950343467295f, 0.062727488577366f,
+  0.004145123064518f, 0.064249053597450f, 0.004344569984823f, 0.065770015120506f,
+  0.004548682365566f, 0.067290350794792f, 0.004757457878441f, 0.068810060620308f,
+  0.004970894660801f, 0.070329122245312f, 0.005188991315663f, 0.071847513318062f,
+  0.005411745049059f, 0.073365233838558f, 0.005639153998345f, 0.074882268905640f,
+  0.005871216300875f, 0.076398596167564f, 0.006107929162681f, 0.077914200723171f,
+  0.006349290721118f, 0.079429075121880f, 0.006595299113542f, 0.080943197011948f,
+  0.006845951545984f, 0.082456558942795f, 0.007101245224476f, 0.083969146013260f,
+  0.007361178752035f, 0.085480943322182f, 0.007625748869032f, 0.086991935968399f,
+  0.007894953712821f, 0.088502109050751f, 0.008168790489435f, 0.090011447668076f,
+  0.008447255939245f, 0.091519944369793f, 0.008730349130929f, 0.093027576804161f,
+  0.009018065407872f, 0.094534330070019f, 0.009310402907431f, 0.096040196716785f,
+  0.009607359766960f, 0.097545161843300f, 0.009908932261169f, 0.099049203097820f,
+  0.010215117596090f, 0.100552320480347f, 0.010525912046432f, 0.102054484188557f,
+  0.010841314680874f, 0.103555686771870f, 0.011161320842803f, 0.105055920779705f,
+  0.011485928669572f, 0.106555156409740f, 0.011815134435892f, 0.108053401112556f,
+  0.012148935347795f, 0.109550617635250f, 0.012487327679992f, 0.111046813428402f,
+  0.012830308638513f, 0.112541958689690f, 0.013177875429392f, 0.114036038517952f,
+  0.013530024327338f, 0.115529052913189f, 0.013886751607060f, 0.117020979523659f,
+  0.014248054474592f, 0.118511803448200f, 0.014613929204643f, 0.120001509785652f,
+  0.014984373003244f, 0.121490091085434f, 0.015359382145107f, 0.122977524995804f,
+  0.015738952904940f, 0.124463804066181f, 0.016123080626130f, 0.125948905944824f,
+  0.016511764377356f, 0.127432823181152f, 0.016904998570681f, 0.128915548324585f,
+  0.017302779480815f, 0.130397051572800f, 0.017705103382468f, 0.131877332925797f,
+  0.018111966550350f, 0.133356377482414f, 0.018523367121816f, 0.134834155440331f,
+  0.018939297646284f, 0.136310681700706f, 0.019359756261110f, 0.137785911560059f,
+  0.019784741103649f, 0.139259845018387f, 0.020214242860675f, 0.140732467174530f,
+  0.020648263394833f, 0.142203763127327f, 0.021086793392897f, 0.143673732876778f,
+  0.021529832854867f, 0.145142331719399f, 0.021977374330163f, 0.146609574556351f,
+  0.022429415956140f, 0.148075446486473f, 0.022885952144861f, 0.149539917707443f,
+  0.023346979171038f, 0.151002973318100f, 0.023812493309379f, 0.152464613318443f,
+  0.024282488971949f, 0.153924822807312f, 0.024756962433457f, 0.155383571982384f,
+  0.025235909968615f, 0.156840875744820f, 0.025719324126840f, 0.158296689391136f,
+  0.026207204908133f, 0.159751012921333f, 0.026699542999268f, 0.161203846335411f,
+  0.027196336537600f, 0.162655144929886f, 0.027697581797838f, 0.164104923605919f,
+  0.028203271329403f, 0.165553152561188f, 0.028713401407003f, 0.166999831795692f,
+  0.029227968305349f, 0.168444931507111f, 0.029746964573860f, 0.169888436794281f,
+  0.030270388349891f, 0.171330362558365f, 0.030798232182860f, 0.172770664095879f,
+  0.031330492347479f, 0.174209341406822f, 0.031867165118456f, 0.175646379590034f,
+  0.032408244907856f, 0.177081763744354f, 0.032953724265099f, 0.178515478968620f,
+  0.033503599464893f, 0.179947525262833f, 0.034057866781950f, 0.181377857923508f,
+  0.034616518765688f, 0.182806491851807f, 0.035179551690817f, 0.184233412146568f,
+  0.035746958106756f, 0.185658603906631f, 0.036318738013506f, 0.187082037329674f,
+  0.036894880235195f, 0.188503712415695f, 0.037475381046534f, 0.189923599362373f,
+  0.038060232996941f, 0.191341713070869f, 0.038649436086416f, 0.192758023738861f,
+  0.039242979139090f, 0.194172516465187f, 0.039840862154961f, 0.195585191249847f,
+  0.040443073958158f, 0.196996018290520f, 0.041049610823393f, 0.198404997587204f,
+  0.041660469025373f, 0.199812099337578f, 0.042275641113520f, 0.201217323541641f,
+  0.042895123362541f, 0.202620655298233f, 0.043518904596567f, 0.204022079706192f,
+  0.044146984815598f, 0.205421581864357f, 0.044779352843761f, 0.206819161772728f,
+  0.045416008681059f, 0.208214774727821f, 0.046056941151619f, 0.209608450531960f,
+  0.046702146530151f, 0.211000129580498f, 0.047351621091366f, 0.212389841675758f,
+  0.048005353659391f, 0.213777542114258f, 0.048663340508938f, 0.215163245797157f,
+  0.049325577914715f, 0.216546908020973f, 0.049992054700851f, 0.217928543686867f,
+  0.050662767142057f, 0.219308122992516f, 0.051337707787752f, 0.220685631036758f,
+  0.052016876637936f, 0.222061067819595f, 0.052700258791447f, 0.223434418439865f,
+  0.053387850522995f, 0.224805667996407f, 0.054079644382000f, 0.226174786686897f,
+  0.054775636643171f, 0.227541789412498f, 0.055475823581219f, 0.228906646370888f,
+  0.056180190294981f, 0.230269357562065f, 0.056888736784458f, 0.231629893183708f,
+  0.057601451873779f, 0.232988253235817f, 0.058318331837654f, 0.234344407916069f,
+  0.059039369225502f, 0.235698372125626f, 0.059764556586742f, 0.237050101161003f,
+  0.060493886470795f, 0.238399609923363f, 0.061227355152369f, 0.239746883511543f,
+  0.061964951455593f, 0.241091892123222f, 0.062706671655178f, 0.242434620857239f,
+  0.063452512025833f, 0.243775084614754f, 0.064202457666397f, 0.245113238692284f,
+  0.064956501126289f, 0.246449097990990f, 0.065714649856091f, 0.247782632708550f,
+  0.066476874053478f, 0.249113827943802f, 0.067243188619614f, 0.250442683696747f,
+  0.068013571202755f, 0.251769185066223f, 0.068788021802902f, 0.253093332052231f,
+  0.069566532969475f, 0.254415065050125f, 0.070349089801311f, 0.255734413862228f,
+  0.071135692298412f, 0.257051378488541f, 0.071926333010197f, 0.258365899324417f,
+  0.072721004486084f, 0.259678006172180f, 0.073519699275494f, 0.260987639427185f,
+  0.074322402477264f, 0.262294828891754f, 0.075129114091396f, 0.263599574565887f,
+  0.075939826667309f, 0.264901816844940f, 0.076754532754421f, 0.266201555728912f,
+  0.077573217451572f, 0.267498821020126f, 0.078395880758762f, 0.268793523311615f,
+  0.079222507774830f, 0.270085722208023f, 0.080053105950356f, 0.271375387907028f,
+  0.080887645483017f, 0.272662490606308f, 0.081726133823395f, 0.273947030305862f,
+  0.082568563520908f, 0.275228977203369f, 0.083414919674397f, 0.276508361101151f,
+  0.084265194833279f, 0.277785122394562f, 0.085119381546974f, 0.279059261083603f,
+  0.085977479815483f, 0.280330777168274f, 0.086839467287064f, 0.281599670648575f,
+  0.087705351412296f, 0.282865911722183f, 0.088575109839439f, 0.284129470586777f,
+  0.089448742568493f, 0.285390377044678f, 0.090326242148876f, 0.286648571491241f,
+  0.091207593679428f, 0.287904083728790f, 0.092092797160149f, 0.289156883955002f,
+  0.092981837689877f, 0.290406972169876f, 0.093874707818031f, 0.291654318571091f,
+  0.094771400094032f, 0.292898923158646f, 0.095671907067299f, 0.294140785932541f,
+  0.096576221287251f, 0.295379847288132f, 0.097484335303307f, 0.296616137027740f,
+  0.098396234214306f, 0.297849655151367f, 0.099311910569668f, 0.299080342054367f,
+  0.100231364369392f, 0.300308227539063f, 0.101154580712318f, 0.301533311605453f,
+  0.102081544697285f, 0.302755534648895f, 0.103012263774872f, 0.303974896669388f,
+  0.103946708142757f, 0.305191397666931f, 0.104884892702103f, 0.306405037641525f,
+  0.105826787650585f, 0.307615786790848f, 0.106772392988205f, 0.308823645114899f,
+  0.107721701264381f, 0.310028612613678f, 0.108674705028534f, 0.311230629682541f,
+  0.109631389379501f, 0.312429755926132f, 0.110591746866703f, 0.313625901937485f,
+  0.111555770039558f, 0.314819127321243f, 0.112523443996906f, 0.316009372472763f,
+  0.113494776189327f, 0.317196637392044f, 0.114469736814499f, 0.318380922079086f,
+  0.115448333323002f, 0.319562226533890f, 0.116430543363094f, 0.320740520954132f,
+  0.117416366934776f, 0.321915775537491f, 0.118405789136887f, 0.323088020086288f,
+  0.119398809969425f, 0.324257194995880f, 0.120395407080650f, 0.325423330068588f,
+  0.121395580470562f, 0.326586425304413f, 0.122399315237999f, 0.327746421098709f,
+  0.123406603932381f, 0.328903347253799f, 0.124417431652546f, 0.330057173967361f,
+  0.125431805849075f, 0.331207901239395f, 0.126449704170227f, 0.332355499267578f,
+  0.127471104264259f, 0.333499968051910f, 0.128496021032333f, 0.334641307592392f,
+  0.129524439573288f, 0.335779488086700f, 0.130556344985962f, 0.336914509534836f,
+  0.131591722369194f, 0.338046342134476f, 0.132630556821823f, 0.339175015687943f,
+  0.133672863245010f, 0.340300500392914f, 0.134718611836433f, 0.341422766447067f,
+  0.135767802596092f, 0.342541843652725f, 0.136820420622826f, 0.343657672405243f,
+  0.137876465916634f, 0.344770282506943f, 0.138935908675194f, 0.345879614353180f,
+  0.139998748898506f, 0.346985727548599f, 0.141064971685410f, 0.348088562488556f,
+  0.142134591937065f, 0.349188119173050f, 0.143207564949989f, 0.350284397602081f,
+  0.144283905625343f, 0.351377367973328f, 0.145363584160805f, 0.352467030286789f,
+  0.146446615457535f, 0.353553384542465f, 0.147532954812050f, 0.354636400938034f,
+  0.148622632026672f, 0.355716109275818f, 0.149715602397919f, 0.356792420148849f,
+  0.150811880826950f, 0.357865422964096f, 0.151911437511444f, 0.358935028314590f,
+  0.153014272451401f, 0.360001266002655f, 0.154120370745659f, 0.361064106225967f,
+  0.155229732394218f, 0.362123548984528f, 0.156342327594757f, 0.363179564476013f,
+  0.157458171248436f, 0.364232182502747f, 0.158577233552933f, 0.365281373262405f,
+  0.159699499607086f, 0.366327136754990f, 0.160824984312058f, 0.367369443178177f,
+  0.161953642964363f, 0.368408292531967f, 0.163085505366325f, 0.369443655014038f,
+  0.164220526814461f, 0.370475560426712f, 0.165358707308769f, 0.371503978967667f,
+  0.166500031948090f, 0.372528880834579f, 0.167644515633583f, 0.373550295829773f,
+  0.168792113661766f, 0.374568194150925f, 0.169942826032639f, 0.375582575798035f,
+  0.171096652746201f, 0.376593410968781f, 0.172253578901291f, 0.377600699663162f,
+  0.173413574695587f, 0.378604412078857f, 0.174576655030251f, 0.379604607820511f,
+  0.175742805004120f, 0.380601197481155f, 0.176911994814873f, 0.381594210863113f,
+  0.178084224462509f, 0.382583618164063f, 0.179259493947029f, 0.383569449186325f,
+  0.180437773466110f, 0.384551674127579f, 0.181619063019753f, 0.385530263185501f,
+  0.182803362607956f, 0.386505216360092f, 0.183990627527237f, 0.387476563453674f,
+  0.185180887579918f, 0.388444244861603f, 0.186374098062515f, 0.389408260583878f,
+  0.187570258975029f, 0.390368610620499f, 0.188769355416298f, 0.391325294971466f,
+  0.189971387386322f, 0.392278283834457f, 0.191176339983940f, 0.393227607011795f,
+  0.192384198307991f, 0.394173204898834f, 0.193594962358475f, 0.395115107297897f,
+  0.194808602333069f, 0.396053284406662f, 0.196025103330612f, 0.396987736225128f,
+  0.197244480252266f, 0.397918462753296f, 0.198466703295708f, 0.398845434188843f,
+  0.199691757559776f, 0.399768620729446f, 0.200919643044472f, 0.400688081979752f,
+  0.202150344848633f, 0.401603758335114f, 0.203383848071098f, 0.402515679597855f,
+  0.204620152711868f, 0.403423786163330f, 0.205859228968620f, 0.404328078031540f,
+  0.207101076841354f, 0.405228585004807f, 0.208345666527748f, 0.406125307083130f,
+  0.209593027830124f, 0.407018154859543f, 0.210843101143837f, 0.407907217741013f,
+  0.212095901370049f, 0.408792406320572f, 0.213351413607597f, 0.409673750400543f,
+  0.214609622955322f, 0.410551249980927f, 0.215870529413223f, 0.411424905061722f,
+  0.217134088277817f, 0.412294656038284f, 0.218400329351425f, 0.413160532712936f,
+  0.219669207930565f, 0.414022535085678f, 0.220940738916397f, 0.414880603551865f,
+  0.222214877605438f, 0.415734797716141f, 0.223491653800011f, 0.416585087776184f,
+  0.224771007895470f, 0.417431443929672f, 0.226052969694138f, 0.418273866176605f,
+  0.227337509393692f, 0.419112354516983f, 0.228624612092972f, 0.419946908950806f,
+  0.229914262890816f, 0.420777499675751f, 0.231206461787224f, 0.421604126691818f,
+  0.232501193881035f, 0.422426789999008f, 0.233798429369926f, 0.423245459794998f,
+  0.235098183155060f, 0.424060165882111f, 0.236400425434113f, 0.424870878458023f,
+  0.237705156207085f, 0.425677597522736f, 0.239012360572815f, 0.426480293273926f,
+  0.240322008728981f, 0.427278995513916f, 0.241634100675583f, 0.428073674440384f,
+  0.242948621511459f, 0.428864300251007f, 0.244265571236610f, 0.429650902748108f,
+  0.245584934949875f, 0.430433481931686f, 0.246906682848930f, 0.431211978197098f,
+  0.248230814933777f, 0.431986421346664f, 0.249557301402092f, 0.432756811380386f,
+  0.250886172056198f, 0.433523118495941f, 0.252217382192612f, 0.434285342693329f,
+  0.253550916910172f, 0.435043483972549f, 0.254886746406555f, 0.435797542333603f,
+  0.256224930286407f, 0.436547487974167f, 0.257565379142761f, 0.437293320894241f,
+  0.258908122777939f, 0.438035041093826f, 0.260253131389618f, 0.438772648572922f,
+  0.261600375175476f, 0.439506113529205f, 0.262949883937836f, 0.440235435962677f,
+  0.264301627874374f, 0.440960645675659f, 0.265655577182770f, 0.441681683063507f,
+  0.267011761665344f, 0.442398548126221f, 0.268370121717453f, 0.443111270666122f,
+  0.269730657339096f, 0.443819820880890f, 0.271093338727951f, 0.444524168968201f,
+  0.272458195686340f, 0.445224374532700f, 0.273825198411942f, 0.445920348167419f,
+  0.275194346904755f, 0.446612149477005f, 0.276565581560135f, 0.447299748659134f,
+  0.277938932180405f, 0.447983115911484f, 0.279314368963242f, 0.448662281036377f,
+  0.280691891908646f, 0.449337244033813f, 0.282071471214294f, 0.450007945299149f,
+  0.283453077077866f, 0.450674414634705f, 0.284836769104004f, 0.451336652040482f,
+  0.286222457885742f, 0.451994657516479f, 0.287610173225403f, 0.452648371458054f,
+  0.288999855518341f, 0.453297853469849f, 0.290391564369202f, 0.453943043947220f,
+  0.291785210371017f, 0.454584002494812f, 0.293180853128433f, 0.455220639705658f,
+  0.294578403234482f, 0.455853015184402f, 0.295977920293808f, 0.456481099128723f,
+  0.297379344701767f, 0.457104891538620f, 0.298782676458359f, 0.457724362611771f,
+  0.300187885761261f, 0.458339542150497f, 0.301595002412796f, 0.458950400352478f,
+  0.303003966808319f, 0.459556937217712f, 0.304414808750153f, 0.460159152746201f,
+  0.305827468633652f, 0.460757017135620f, 0.307241976261139f, 0.461350560188293f,
+  0.308658272027969f, 0.461939752101898f, 0.310076385736465f, 0.462524622678757f,
+  0.311496287584305f, 0.463105112314224f, 0.312917977571487f, 0.463681250810623f,
+  0.314341396093369f, 0.464253038167953f, 0.315766572952271f, 0.464820444583893f,
+  0.317193508148193f, 0.465383470058441f, 0.318622142076492f, 0.465942144393921f,
+  0.320052474737167f, 0.466496407985687f, 0.321484506130219f, 0.467046260833740f,
+  0.322918236255646f, 0.467591762542725f, 0.324353635311127f, 0.468132823705673f,
+  0.325790673494339f, 0.468669503927231f, 0.327229350805283f, 0.469201773405075f,
+  0.328669637441635f, 0.469729602336884f, 0.330111563205719f, 0.470253020524979f,
+  0.331555068492889f, 0.470772027969360f, 0.333000183105469f, 0.471286594867706f,
+  0.334446847438812f, 0.471796721220016f, 0.335895091295242f, 0.472302407026291f,
+  0.337344855070114f, 0.472803652286530f, 0.338796168565750f, 0.473300457000732f,
+  0.340248972177505f, 0.473792791366577f, 0.341703325510025f, 0.474280685186386f,
+  0.343159139156342f, 0.474764078855515f, 0.344616413116455f, 0.475243031978607f,
+  0.346075177192688f, 0.475717514753342f, 0.347535371780396f, 0.476187497377396f,
+  0.348997026681900f, 0.476653009653091f, 0.350460082292557f, 0.477114051580429f,
+  0.351924568414688f, 0.477570593357086f, 0.353390425443649f, 0.478022634983063f,
+  0.354857653379440f, 0.478470176458359f, 0.356326282024384f, 0.478913217782974f,
+  0.357796221971512f, 0.479351729154587f, 0.359267532825470f, 0.479785770177841f,
+  0.360740154981613f, 0.480215251445770f, 0.362214088439941f, 0.480640232563019f,
+  0.363689333200455f, 0.481060713529587f, 0.365165829658508f, 0.481476634740829f,
+  0.366643607616425f, 0.481888025999069f, 0.368122667074203f, 0.482294887304306f,
+  0.369602948427200f, 0.482697218656540f, 0.371084451675415f, 0.483094990253448f,
+  0.372567176818848f, 0.483488231897354f, 0.374051094055176f, 0.483876913785934f,
+  0.375536203384399f, 0.484261035919189f, 0.377022475004196f, 0.484640628099442f,
+  0.378509908914566f, 0.485015630722046f, 0.379998475313187f, 0.485386073589325f,
+  0.381488204002380f, 0.485751956701279f, 0.382979035377502f, 0.486113250255585f,
+  0.384470939636230f, 0.486469984054565f, 0.385963946580887f, 0.486822128295898f,
+  0.387458056211472f, 0.487169682979584f, 0.388953179121017f, 0.487512677907944f,
+  0.390449374914169f, 0.487851053476334f, 0.391946613788605f, 0.488184869289398f,
+  0.393444836139679f, 0.488514065742493f, 0.394944071769714f, 0.488838672637939f,
+  0.396444320678711f, 0.489158689975739f, 0.397945523262024f, 0.489474087953568f,
+  0.399447679519653f, 0.489784896373749f, 0.400950789451599f, 0.490091055631638f,
+  0.402454853057861f, 0.490392625331879f, 0.403959810733795f, 0.490689605474472f,
+  0.405465662479401f, 0.490981936454773f, 0.406972438097000f, 0.491269648075104f,
+  0.408480048179626f, 0.491552740335464f, 0.409988552331924f, 0.491831213235855f,
+  0.411497890949249f, 0.492105036973953f, 0.413008064031601f, 0.492374241352081f,
+  0.414519041776657f, 0.492638826370239f, 0.416030853986740f, 0.492898762226105f,
+  0.417543441057205f, 0.493154048919678f, 0.419056802988052f, 0.493404686450958f,
+  0.420570939779282f, 0.493650704622269f, 0.422085791826248f, 0.493892073631287f,
+  0.423601418733597f, 0.494128793478012f, 0.425117731094360f, 0.494360834360123f,
+  0.426634758710861f, 0.494588255882263f, 0.428152471780777f, 0.494810998439789f,
+  0.429670870304108f, 0.495029091835022f, 0.431189924478531f, 0.495242536067963f,
+  0.432709634304047f, 0.495451331138611f, 0.434229999780655f, 0.495655417442322f,
+  0.435750931501389f, 0.495854884386063f, 0.437272518873215f, 0.496049642562866f,
+  0.438794672489166f, 0.496239781379700f, 0.440317392349243f, 0.496425211429596f,
+  0.441840678453445f, 0.496605962514877f, 0.443364530801773f, 0.496782064437866f,
+  0.444888889789581f, 0.496953487396240f, 0.446413785219193f, 0.497120231389999f,
+  0.447939187288284f, 0.497282296419144f, 0.449465066194534f, 0.497439652681351f,
+  0.450991421937943f, 0.497592359781265f, 0.452518254518509f, 0.497740387916565f,
+  0.454045534133911f, 0.497883707284927f, 0.455573230981827f, 0.498022347688675f,
+  0.457101345062256f, 0.498156309127808f, 0.458629876375198f, 0.498285561800003f,
+  0.460158795118332f, 0.498410135507584f, 0.461688071489334f, 0.498530030250549f,
+  0.463217705488205f, 0.498645216226578f, 0.464747726917267f, 0.498755723237991f,
+  0.466278046369553f, 0.498861521482468f, 0.467808693647385f, 0.498962640762329f,
+  0.469339638948441f, 0.499059051275253f, 0.470870882272720f, 0.499150782823563f,
+  0.472402364015579f, 0.499237775802612f, 0.473934143781662f, 0.499320119619370f,
+  0.475466161966324f, 0.499397724866867f, 0.476998418569565f, 0.499470651149750f,
+  0.478530883789063f, 0.499538868665695f, 0.480063527822495f, 0.499602377414703f,
+  0.481596380472183f, 0.499661177396774f, 0.483129411935806f, 0.499715298414230f,
+  0.484662592411041f, 0.499764710664749f, 0.486195921897888f, 0.499809414148331f,
+  0.487729400396347f, 0.499849408864975f, 0.489262968301773f, 0.499884694814682f,
+  0.490796625614166f, 0.499915301799774f, 0.492330402135849f, 0.499941170215607f,
+  0.493864238262177f, 0.499962359666824f, 0.495398133993149f, 0.499978810548782f,
+  0.496932059526443f, 0.499990582466125f, 0.498466014862061f, 0.499997645616531f
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+
+static const float32_t realCoefA[512] = {
+  0.500000000000000f, -0.500000000000000f, 0.493864238262177f, -0.499962359666824f,
+  0.487729400396347f, -0.499849408864975f, 0.481596380472183f, -0.499661177396774f,
+  0.475466161966324f, -0.499397724866867f, 0.469339638948441f, -0.499059051275253f,
+  0.463217705488205f, -0.498645216226578f, 0.457101345062256f, -0.498156309127808f,
+  0.450991421937943f, -0.497592359781265f, 0.444888889789581f, -0.496953487396240f,
+  0.438794672489166f, -0.496239781379700f, 0.432709634304047f, -0.495451331138611f,
+  0.426634758710861f, -0.494588255882263f, 0.420570939779282f, -0.493650704622269f,
+  0.414519041776657f, -0.492638826370239f, 0.408480048179626f, -0.491552740335464f,
+  0.402454853057861f, -0.490392625331879f, 0.396444320678711f, -0.489158689975739f,
+  0.390449374914169f, -0.487851053476334f, 0.384470939636230f, -0.486469984054565f,
+  0.378509908914566f, -0.485015630722046f, 0.372567176818848f, -0.483488231897354f,
+  0.366643607616425f, -0.481888025999069f, 0.360740154981613f, -0.480215251445770f,
+  0.354857653379440f, -0.478470176458359f, 0.348997026681900f, -0.476653009653091f,
+  0.343159139156342f, -0.474764078855515f, 0.337344855070114f, -0.472803652286530f,
+  0.331555068492889f, -0.470772027969360f, 0.325790673494339f, -0.468669503927231f,
+  0.320052474737167f, -0.466496407985687f, 0.314341396093369f, -0.464253038167953f,
+  0.308658272027969f, -0.461939752101898f, 0.303003966808319f, -0.459556937217712f,
+  0.297379344701767f, -0.457104891538620f, 0.291785210371017f, -0.454584002494812f,
+  0.286222457885742f, -0.451994657516479f, 0.280691891908646f, -0.449337244033813f,
+  0.275194346904755f, -0.446612149477005f, 0.269730657339096f, -0.443819820880890f,
+  0.264301627874374f, -0.440960645675659f, 0.258908122777939f, -0.438035041093826f,
+  0.253550916910172f, -0.435043483972549f, 0.248230814933777f, -0.431986421346664f,
+  0.242948621511459f, -0.428864300251007f, 0.237705156207085f, -0.425677597522736f,
+  0.232501193881035f, -0.422426789999008f, 0.227337509393692f, -0.419112354516983f,
+  0.222214877605438f, -0.415734797716141f, 0.217134088277817f, -0.412294656038284f,
+  0.212095901370049f, -0.408792406320572f, 0.207101076841354f, -0.405228585004807f,
+  0.202150344848633f, -0.401603758335114f, 0.197244480252266f, -0.397918462753296f,
+  0.192384198307991f, -0.394173204898834f, 0.187570258975029f, -0.390368610620499f,
+  0.182803362607956f, -0.386505216360092f, 0.178084224462509f, -0.382583618164063f,
+  0.173413574695587f, -0.378604412078857f, 0.168792113661766f, -0.374568194150925f,
+  0.164220526814461f, -0.370475560426712f, 0.159699499607086f, -0.366327136754990f,
+  0.155229732394218f, -0.362123548984528f, 0.150811880826950f, -0.357865422964096f,
+  0.146446615457535f, -0.353553384542465f, 0.142134591937065f, -0.349188119173050f,
+  0.137876465916634f, -0.344770282506943f, 0.133672863245010f, -0.340300500392914f,
+  0.129524439573288f, -0.335779488086700f, 0.125431805849075f, -0.331207901239395f,
+  0.121395580470562f, -0.326586425304413f, 0.117416366934776f, -0.321915775537491f,
+  0.113494776189327f, -0.317196637392044f, 0.109631389379501f, -0.312429755926132f,
+  0.105826787650585f, -0.307615786790848f, 0.102081544697285f, -0.302755534648895f,
+  0.098396234214306f, -0.297849655151367f, 0.094771400094032f, -0.292898923158646f,
+  0.091207593679428f, -0.287904083728790f, 0.087705351412296f, -0.282865911722183f,
+  0.084265194833279f, -0.277785122394562f, 0.080887645483017f, -0.272662490606308f,
+  0.077573217451572f, -0.267498821020126f, 0.074322402477264f, -0.262294828891754f,
+  0.071135692298412f, -0.257051378488541f, 0.068013571202755f, -0.251769185066223f,
+  0.064956501126289f, -0.246449097990990f, 0.061964951455593f, -0.241091892123222f,
+  0.059039369225502f, -0.235698372125626f, 0.056180190294981f, -0.230269357562065f,
+  0.053387850522995f, -0.224805667996407f, 0.050662767142057f, -0.219308122992516f,
+  0.048005353659391f, -0.213777542114258f, 0.045416008681059f, -0.208214774727821f,
+  0.042895123362541f, -0.202620655298233f, 0.040443073958158f, -0.196996018290520f,
+  0.038060232996941f, -0.191341713070869f, 0.035746958106756f, -0.185658603906631f,
+  0.033503599464893f, -0.179947525262833f, 0.031330492347479f, -0.174209341406822f,
+  0.029227968305349f, -0.168444931507111f, 0.027196336537600f, -0.162655144929886f,
+  0.025235909968615f, -0.156840875744820f, 0.023346979171038f, -0.151002973318100f,
+  0.021529832854867f, -0.145142331719399f, 0.019784741103649f, -0.139259845018387f,
+  0.018111966550350f, -0.133356377482414f, 0.016511764377356f, -0.127432823181152f,
+  0.014984373003244f, -0.121490091085434f, 0.013530024327338f, -0.115529052913189f,
+  0.012148935347795f, -0.109550617635250f, 0.010841314680874f, -0.103555686771870f,
+  0.009607359766960f, -0.097545161843300f, 0.008447255939245f, -0.091519944369793f,
+  0.007361178752035f, -0.085480943322182f, 0.006349290721118f, -0.079429075121880f,
+  0.005411745049059f, -0.073365233838558f, 0.004548682365566f, -0.067290350794792f,
+  0.003760232590139f, -0.061205338686705f, 0.003046514932066f, -0.055111102759838f,
+  0.002407636726275f, -0.049008570611477f, 0.001843693898991f, -0.042898654937744f,
+  0.001354771666229f, -0.036782283335924f, 0.000940943544265f, -0.030660368502140f,
+  0.000602271873504f, -0.024533838033676f, 0.000338807702065f, -0.018403612077236f,
+  0.000150590654812f, -0.012270614504814f, 0.000037649078877f, -0.006135769188404f,
+  0.000000000000000f, -0.000000000000023f, 0.000037649078877f, 0.006135769188404f,
+  0.000150590654812f, 0.012270614504814f, 0.000338807702065f, 0.018403612077236f,
+  0.000602271873504f, 0.024533838033676f, 0.000940943544265f, 0.030660368502140f,
+  0.001354771666229f, 0.036782283335924f, 0.001843693898991f, 0.042898654937744f,
+  0.002407636726275f, 0.049008570611477f, 0.003046514932066f, 0.055111102759838f,
+  0.003760232590139f, 0.061205338686705f, 0.004548682365566f, 0.067290350794792f,
+  0.005411745049059f, 0.073365233838558f, 0.006349290721118f, 0.079429075121880f,
+  0.007361178752035f, 0.085480943322182f, 0.008447255939245f, 0.091519944369793f,
+  0.009607359766960f, 0.097545161843300f, 0.010841314680874f, 0.103555686771870f,
+  0.012148935347795f, 0.109550617635250f, 0.013530024327338f, 0.115529052913189f,
+  0.014984373003244f, 0.121490091085434f, 0.016511764377356f, 0.127432823181152f,
+  0.018111966550350f, 0.133356377482414f, 0.019784741103649f, 0.139259845018387f,
+  0.021529832854867f, 0.145142331719399f, 0.023346979171038f, 0.151002973318100f,
+  0.025235909968615f, 0.156840875744820f, 0.027196336537600f, 0.162655144929886f,
+  0.029227968305349f, 0.168444931507111f, 0.031330492347479f, 0.174209341406822f,
+  0.033503599464893f, 0.179947525262833f, 0.035746958106756f, 0.185658603906631f,
+  0.038060232996941f, 0.191341713070869f, 0.040443073958158f, 0.196996018290520f,
+  0.042895123362541f, 0.202620655298233f, 0.045416008681059f, 0.208214774727821f,
+  0.048005353659391f, 0.213777542114258f, 0.050662767142057f, 0.219308122992516f,
+  0.053387850522995f, 0.224805667996407f, 0.056180190294981f, 0.230269357562065f,
+  0.059039369225502f, 0.235698372125626f, 0.061964951455593f, 0.241091892123222f,
+  0.064956501126289f, 0.246449097990990f, 0.068013571202755f, 0.251769185066223f,
+  0.071135692298412f, 0.257051378488541f, 0.074322402477264f, 0.262294828891754f,
+  0.077573217451572f, 0.267498821020126f, 0.080887645483017f, 0.272662490606308f,
+  0.084265194833279f, 0.277785122394562f, 0.087705351412296f, 0.282865911722183f,
+  0.091207593679428f, 0.287904083728790f, 0.094771400094032f, 0.292898923158646f,
+  0.098396234214306f, 0.297849655151367f, 0.102081544697285f, 0.302755534648895f,
+  0.105826787650585f, 0.307615786790848f, 0.109631389379501f, 0.312429755926132f,
+  0.113494776189327f, 0.317196637392044f, 0.117416366934776f, 0.321915775537491f,
+  0.121395580470562f, 0.326586425304413f, 0.125431805849075f, 0.331207901239395f,
+  0.129524439573288f, 0.335779488086700f, 0.133672863245010f, 0.340300500392914f,
+  0.137876465916634f, 0.344770282506943f, 0.142134591937065f, 0.349188119173050f,
+  0.146446615457535f, 0.353553384542465f, 0.150811880826950f, 0.357865422964096f,
+  0.155229732394218f, 0.362123548984528f, 0.159699499607086f, 0.366327136754990f,
+  0.164220526814461f, 0.370475560426712f, 0.168792113661766f, 0.374568194150925f,
+  0.173413574695587f, 0.378604412078857f, 0.178084224462509f, 0.382583618164063f,
+  0.182803362607956f, 0.386505216360092f, 0.187570258975029f, 0.390368610620499f,
+  0.192384198307991f, 0.394173204898834f, 0.197244480252266f, 0.397918462753296f,
+  0.202150344848633f, 0.401603758335114f, 0.207101076841354f, 0.405228585004807f,
+  0.212095901370049f, 0.408792406320572f, 0.217134088277817f, 0.412294656038284f,
+  0.222214877605438f, 0.415734797716141f, 0.227337509393692f, 0.419112354516983f,
+  0.232501193881035f, 0.422426789999008f, 0.237705156207085f, 0.425677597522736f,
+  0.242948621511459f, 0.428864300251007f, 0.248230814933777f, 0.431986421346664f,
+  0.253550916910172f, 0.435043483972549f, 0.258908122777939f, 0.438035041093826f,
+  0.264301627874374f, 0.440960645675659f, 0.269730657339096f, 0.443819820880890f,
+  0.275194346904755f, 0.446612149477005f, 0.280691891908646f, 0.449337244033813f,
+  0.286222457885742f, 0.451994657516479f, 0.291785210371017f, 0.454584002494812f,
+  0.297379344701767f, 0.457104891538620f, 0.303003966808319f, 0.459556937217712f,
+  0.308658272027969f, 0.461939752101898f, 0.314341396093369f, 0.464253038167953f,
+  0.320052474737167f, 0.466496407985687f, 0.325790673494339f, 0.468669503927231f,
+  0.331555068492889f, 0.470772027969360f, 0.337344855070114f, 0.472803652286530f,
+  0.343159139156342f, 0.474764078855515f, 0.348997026681900f, 0.476653009653091f,
+  0.354857653379440f, 0.478470176458359f, 0.360740154981613f, 0.480215251445770f,
+  0.366643607616425f, 0.481888025999069f, 0.372567176818848f, 0.483488231897354f,
+  0.378509908914566f, 0.485015630722046f, 0.384470939636230f, 0.486469984054565f,
+  0.390449374914169f, 0.487851053476334f, 0.396444320678711f, 0.489158689975739f,
+  0.402454853057861f, 0.490392625331879f, 0.408480048179626f, 0.491552740335464f,
+  0.414519041776657f, 0.492638826370239f, 0.420570939779282f, 0.493650704622269f,
+  0.426634758710861f, 0.494588255882263f, 0.432709634304047f, 0.495451331138611f,
+  0.438794672489166f, 0.496239781379700f, 0.444888889789581f, 0.496953487396240f,
+  0.450991421937943f, 0.497592359781265f, 0.457101345062256f, 0.498156309127808f,
+  0.463217705488205f, 0.498645216226578f, 0.469339638948441f, 0.499059051275253f,
+  0.475466161966324f, 0.499397724866867f, 0.481596380472183f, 0.499661177396774f,
+  0.487729400396347f, 0.499849408864975f, 0.493864238262177f, 0.499962359666824f
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+
+static const float32_t realCoefA[128] = {
+  0.500000000000000f, -0.500000000000000f, 0.475466161966324f, -0.499397724866867f,
+  0.450991421937943f, -0.497592359781265f, 0.426634758710861f, -0.494588255882263f,
+  0.402454853057861f, -0.490392625331879f, 0.378509908914566f, -0.485015630722046f,
+  0.354857653379440f, -0.478470176458359f, 0.331555068492889f, -0.470772027969360f,
+  0.308658272027969f, -0.461939752101898f, 0.286222457885742f, -0.451994657516479f,
+  0.264301627874374f, -0.440960645675659f, 0.242948621511459f, -0.428864300251007f,
+  0.222214877605438f, -0.415734797716141f, 0.202150344848633f, -0.401603758335114f,
+  0.182803362607956f, -0.386505216360092f, 0.164220526814461f, -0.370475560426712f,
+  0.146446615457535f, -0.353553384542465f, 0.129524439573288f, -0.335779488086700f,
+  0.113494776189327f, -0.317196637392044f, 0.098396234214306f, -0.297849655151367f,
+  0.084265194833279f, -0.277785122394562f, 0.071135692298412f, -0.257051378488541f,
+  0.059039369225502f, -0.235698372125626f, 0.048005353659391f, -0.213777542114258f,
+  0.038060232996941f, -0.191341713070869f, 0.029227968305349f, -0.168444931507111f,
+  0.021529832854867f, -0.145142331719399f, 0.014984373003244f, -0.121490091085434f,
+  0.009607359766960f, -0.097545161843300f, 0.005411745049059f, -0.073365233838558f,
+  0.002407636726275f, -0.049008570611477f, 0.000602271873504f, -0.024533838033676f,
+  0.000000000000000f, -0.000000000000023f, 0.000602271873504f, 0.024533838033676f,
+  0.002407636726275f, 0.049008570611477f, 0.005411745049059f, 0.073365233838558f,
+  0.009607359766960f, 0.097545161843300f, 0.014984373003244f, 0.121490091085434f,
+  0.021529832854867f, 0.145142331719399f, 0.029227968305349f, 0.168444931507111f,
+  0.038060232996941f, 0.191341713070869f, 0.048005353659391f, 0.213777542114258f,
+  0.059039369225502f, 0.235698372125626f, 0.071135692298412f, 0.257051378488541f,
+  0.084265194833279f, 0.277785122394562f, 0.098396234214306f, 0.297849655151367f,
+  0.113494776189327f, 0.317196637392044f, 0.129524439573288f, 0.335779488086700f,
+  0.146446615457535f, 0.353553384542465f, 0.164220526814461f, 0.370475560426712f,
+  0.182803362607956f, 0.386505216360092f, 0.202150344848633f, 0.401603758335114f,
+  0.222214877605438f, 0.415734797716141f, 0.242948621511459f, 0.428864300251007f,
+  0.264301627874374f, 0.440960645675659f, 0.286222457885742f, 0.451994657516479f,
+  0.308658272027969f, 0.461939752101898f, 0.331555068492889f, 0.470772027969360f,
+  0.354857653379440f, 0.478470176458359f, 0.378509908914566f, 0.485015630722046f,
+  0.402454853057861f, 0.490392625331879f, 0.426634758710861f, 0.494588255882263f,
+  0.450991421937943f, 0.497592359781265f, 0.475466161966324f, 0.499397724866867f
+};
+
+#endif
+
 
 /**    
 * \par   
 * Generation of realCoefB array:    
 * \par   
-* n = 4096    
+* n = ARM_MATH_MAX_FFT_LEN (4096 by default)    
 * <pre>for (i = 0; i < n; i++)    
 * {    
 *    pBTable[2 * i] = 0.5 * (1.0 + sin (2 * PI / (double) (2 * n) * (double) i));    
@@ -4171,6 +4863,8 @@ static const float32_t realCoefA[8192] = {
 *  } </pre>    
 *    
 */
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
+
 static const float32_t realCoefB[8192] = {
   0.500000000000000f, 0.500000000000000f, 0.500383496284485f,
     0.499999850988388f,
@@ -8270,6 +8964,695 @@ static const float32_t realCoefB[8192] = {
     -0.499999850988388f,
 };
 
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+
+static const float32_t realCoefB[2048] = {
+  0.500000000000000f, 0.500000000000000f, 0.501533985137939f, 0.499997645616531f,
+  0.503067970275879f, 0.499990582466125f, 0.504601895809174f, 0.499978810548782f,
+  0.506135761737823f, 0.499962359666824f, 0.507669627666473f, 0.499941170215607f,
+  0.509203374385834f, 0.499915301799774f, 0.510737061500549f, 0.499884694814682f,
+  0.512270629405975f, 0.499849408864975f, 0.513804078102112f, 0.499809414148331f,
+  0.515337407588959f, 0.499764710664749f, 0.516870558261871f, 0.499715298414230f,
+  0.518403589725494f, 0.499661177396774f, 0.519936442375183f, 0.499602377414703f,
+  0.521469116210938f, 0.499538868665695f, 0.523001611232758f, 0.499470651149750f,
+  0.524533808231354f, 0.499397724866867f, 0.526065826416016f, 0.499320119619370f,
+  0.527597606182098f, 0.499237775802612f, 0.529129147529602f, 0.499150782823563f,
+  0.530660390853882f, 0.499059051275253f, 0.532191336154938f, 0.498962640762329f,
+  0.533721983432770f, 0.498861521482468f, 0.535252273082733f, 0.498755723237991f,
+  0.536782264709473f, 0.498645216226578f, 0.538311958312988f, 0.498530030250549f,
+  0.539841234683990f, 0.498410135507584f, 0.541370153427124f, 0.498285561800003f,
+  0.542898654937744f, 0.498156309127808f, 0.544426798820496f, 0.498022347688675f,
+  0.545954465866089f, 0.497883707284927f, 0.547481775283813f, 0.497740387916565f,
+  0.549008548259735f, 0.497592359781265f, 0.550534904003143f, 0.497439652681351f,
+  0.552060842514038f, 0.497282296419144f, 0.553586184978485f, 0.497120231389999f,
+  0.555111110210419f, 0.496953487396240f, 0.556635499000549f, 0.496782064437866f,
+  0.558159291744232f, 0.496605962514877f, 0.559682607650757f, 0.496425211429596f,
+  0.561205327510834f, 0.496239781379700f, 0.562727510929108f, 0.496049642562866f,
+  0.564249038696289f, 0.495854884386063f, 0.565770030021667f, 0.495655417442322f,
+  0.567290365695953f, 0.495451331138611f, 0.568810045719147f, 0.495242536067963f,
+  0.570329129695892f, 0.495029091835022f, 0.571847498416901f, 0.494810998439789f,
+  0.573365211486816f, 0.494588255882263f, 0.574882268905640f, 0.494360834360123f,
+  0.576398611068726f, 0.494128793478012f, 0.577914178371429f, 0.493892073631287f,
+  0.579429090023041f, 0.493650704622269f, 0.580943167209625f, 0.493404686450958f,
+  0.582456588745117f, 0.493154048919678f, 0.583969175815582f, 0.492898762226105f,
+  0.585480928421021f, 0.492638826370239f, 0.586991965770721f, 0.492374241352081f,
+  0.588502109050751f, 0.492105036973953f, 0.590011477470398f, 0.491831213235855f,
+  0.591519951820374f, 0.491552740335464f, 0.593027591705322f, 0.491269648075104f,
+  0.594534337520599f, 0.490981936454773f, 0.596040189266205f, 0.490689605474472f,
+  0.597545146942139f, 0.490392625331879f, 0.599049210548401f, 0.490091055631638f,
+  0.600552320480347f, 0.489784896373749f, 0.602054476737976f, 0.489474087953568f,
+  0.603555679321289f, 0.489158689975739f, 0.605055928230286f, 0.488838672637939f,
+  0.606555163860321f, 0.488514065742493f, 0.608053386211395f, 0.488184869289398f,
+  0.609550595283508f, 0.487851053476334f, 0.611046791076660f, 0.487512677907944f,
+  0.612541973590851f, 0.487169682979584f, 0.614036023616791f, 0.486822128295898f,
+  0.615529060363770f, 0.486469984054565f, 0.617020964622498f, 0.486113250255585f,
+  0.618511795997620f, 0.485751956701279f, 0.620001494884491f, 0.485386073589325f,
+  0.621490061283112f, 0.485015630722046f, 0.622977554798126f, 0.484640628099442f,
+  0.624463796615601f, 0.484261035919189f, 0.625948905944824f, 0.483876913785934f,
+  0.627432823181152f, 0.483488231897354f, 0.628915548324585f, 0.483094990253448f,
+  0.630397081375122f, 0.482697218656540f, 0.631877362728119f, 0.482294887304306f,
+  0.633356392383575f, 0.481888025999069f, 0.634834170341492f, 0.481476634740829f,
+  0.636310696601868f, 0.481060713529587f, 0.637785911560059f, 0.480640232563019f,
+  0.639259815216064f, 0.480215251445770f, 0.640732467174530f, 0.479785770177841f,
+  0.642203748226166f, 0.479351729154587f, 0.643673717975616f, 0.478913217782974f,
+  0.645142316818237f, 0.478470176458359f, 0.646609604358673f, 0.478022634983063f,
+  0.648075461387634f, 0.477570593357086f, 0.649539887905121f, 0.477114051580429f,
+  0.651003003120422f, 0.476653009653091f, 0.652464628219604f, 0.476187497377396f,
+  0.653924822807312f, 0.475717514753342f, 0.655383586883545f, 0.475243031978607f,
+  0.656840860843658f, 0.474764078855515f, 0.658296704292297f, 0.474280685186386f,
+  0.659750998020172f, 0.473792791366577f, 0.661203861236572f, 0.473300457000732f,
+  0.662655174732208f, 0.472803652286530f, 0.664104938507080f, 0.472302407026291f,
+  0.665553152561188f, 0.471796721220016f, 0.666999816894531f, 0.471286594867706f,
+  0.668444931507111f, 0.470772027969360f, 0.669888436794281f, 0.470253020524979f,
+  0.671330332756042f, 0.469729602336884f, 0.672770678997040f, 0.469201773405075f,
+  0.674209356307983f, 0.468669503927231f, 0.675646364688873f, 0.468132823705673f,
+  0.677081763744354f, 0.467591762542725f, 0.678515493869781f, 0.467046260833740f,
+  0.679947495460510f, 0.466496407985687f, 0.681377887725830f, 0.465942144393921f,
+  0.682806491851807f, 0.465383470058441f, 0.684233427047729f, 0.464820444583893f,
+  0.685658574104309f, 0.464253038167953f, 0.687082052230835f, 0.463681250810623f,
+  0.688503682613373f, 0.463105112314224f, 0.689923584461212f, 0.462524622678757f,
+  0.691341698169708f, 0.461939752101898f, 0.692758023738861f, 0.461350560188293f,
+  0.694172501564026f, 0.460757017135620f, 0.695585191249847f, 0.460159152746201f,
+  0.696996033191681f, 0.459556937217712f, 0.698404967784882f, 0.458950400352478f,
+  0.699812114238739f, 0.458339542150497f, 0.701217353343964f, 0.457724362611771f,
+  0.702620685100555f, 0.457104891538620f, 0.704022109508514f, 0.456481099128723f,
+  0.705421566963196f, 0.455853015184402f, 0.706819176673889f, 0.455220639705658f,
+  0.708214759826660f, 0.454584002494812f, 0.709608435630798f, 0.453943043947220f,
+  0.711000144481659f, 0.453297853469849f, 0.712389826774597f, 0.452648371458054f,
+  0.713777542114258f, 0.451994657516479f, 0.715163230895996f, 0.451336652040482f,
+  0.716546893119812f, 0.450674414634705f, 0.717928528785706f, 0.450007945299149f,
+  0.719308137893677f, 0.449337244033813f, 0.720685660839081f, 0.448662281036377f,
+  0.722061097621918f, 0.447983115911484f, 0.723434448242188f, 0.447299748659134f,
+  0.724805653095245f, 0.446612149477005f, 0.726174771785736f, 0.445920348167419f,
+  0.727541804313660f, 0.445224374532700f, 0.728906631469727f, 0.444524168968201f,
+  0.730269372463226f, 0.443819820880890f, 0.731629908084869f, 0.443111270666122f,
+  0.732988238334656f, 0.442398548126221f, 0.734344422817230f, 0.441681683063507f,
+  0.735698342323303f, 0.440960645675659f, 0.737050116062164f, 0.440235435962677f,
+  0.738399624824524f, 0.439506113529205f, 0.739746868610382f, 0.438772648572922f,
+  0.741091907024384f, 0.438035041093826f, 0.742434620857239f, 0.437293320894241f,
+  0.743775069713593f, 0.436547487974167f, 0.745113253593445f, 0.435797542333603f,
+  0.746449112892151f, 0.435043483972549f, 0.747782647609711f, 0.434285342693329f,
+  0.749113857746124f, 0.433523118495941f, 0.750442683696747f, 0.432756811380386f,
+  0.751769185066223f, 0.431986421346664f, 0.753093302249908f, 0.431211978197098f,
+  0.754415094852448f, 0.430433481931686f, 0.755734443664551f, 0.429650902748108f,
+  0.757051348686218f, 0.428864300251007f, 0.758365929126740f, 0.428073674440384f,
+  0.759678006172180f, 0.427278995513916f, 0.760987639427185f, 0.426480293273926f,
+  0.762294828891754f, 0.425677597522736f, 0.763599574565887f, 0.424870878458023f,
+  0.764901816844940f, 0.424060165882111f, 0.766201555728912f, 0.423245459794998f,
+  0.767498791217804f, 0.422426789999008f, 0.768793523311615f, 0.421604126691818f,
+  0.770085752010345f, 0.420777499675751f, 0.771375417709351f, 0.419946908950806f,
+  0.772662520408630f, 0.419112354516983f, 0.773947000503540f, 0.418273866176605f,
+  0.775228977203369f, 0.417431443929672f, 0.776508331298828f, 0.416585087776184f,
+  0.777785122394562f, 0.415734797716141f, 0.779059290885925f, 0.414880603551865f,
+  0.780330777168274f, 0.414022535085678f, 0.781599700450897f, 0.413160532712936f,
+  0.782865881919861f, 0.412294656038284f, 0.784129500389099f, 0.411424905061722f,
+  0.785390377044678f, 0.410551249980927f, 0.786648571491241f, 0.409673750400543f,
+  0.787904083728790f, 0.408792406320572f, 0.789156913757324f, 0.407907217741013f,
+  0.790407001972198f, 0.407018154859543f, 0.791654348373413f, 0.406125307083130f,
+  0.792898952960968f, 0.405228585004807f, 0.794140756130219f, 0.404328078031540f,
+  0.795379877090454f, 0.403423786163330f, 0.796616137027740f, 0.402515679597855f,
+  0.797849655151367f, 0.401603758335114f, 0.799080371856689f, 0.400688081979752f,
+  0.800308227539063f, 0.399768620729446f, 0.801533281803131f, 0.398845434188843f,
+  0.802755534648895f, 0.397918462753296f, 0.803974866867065f, 0.396987736225128f,
+  0.805191397666931f, 0.396053284406662f, 0.806405067443848f, 0.395115107297897f,
+  0.807615816593170f, 0.394173204898834f, 0.808823645114899f, 0.393227607011795f,
+  0.810028612613678f, 0.392278283834457f, 0.811230659484863f, 0.391325294971466f,
+  0.812429726123810f, 0.390368610620499f, 0.813625931739807f, 0.389408260583878f,
+  0.814819097518921f, 0.388444244861603f, 0.816009342670441f, 0.387476563453674f,
+  0.817196667194366f, 0.386505216360092f, 0.818380951881409f, 0.385530263185501f,
+  0.819562196731567f, 0.384551674127579f, 0.820740520954132f, 0.383569449186325f,
+  0.821915745735168f, 0.382583618164063f, 0.823087990283966f, 0.381594210863113f,
+  0.824257194995880f, 0.380601197481155f, 0.825423359870911f, 0.379604607820511f,
+  0.826586425304413f, 0.378604412078857f, 0.827746450901031f, 0.377600699663162f,
+  0.828903317451477f, 0.376593410968781f, 0.830057144165039f, 0.375582575798035f,
+  0.831207871437073f, 0.374568194150925f, 0.832355499267578f, 0.373550295829773f,
+  0.833499968051910f, 0.372528880834579f, 0.834641277790070f, 0.371503978967667f,
+  0.835779488086700f, 0.370475560426712f, 0.836914479732513f, 0.369443655014038f,
+  0.838046371936798f, 0.368408292531967f, 0.839175045490265f, 0.367369443178177f,
+  0.840300500392914f, 0.366327136754990f, 0.841422796249390f, 0.365281373262405f,
+  0.842541813850403f, 0.364232182502747f, 0.843657672405243f, 0.363179564476013f,
+  0.844770252704620f, 0.362123548984528f, 0.845879614353180f, 0.361064106225967f,
+  0.846985757350922f, 0.360001266002655f, 0.848088562488556f, 0.358935028314590f,
+  0.849188148975372f, 0.357865422964096f, 0.850284397602081f, 0.356792420148849f,
+  0.851377367973328f, 0.355716109275818f, 0.852467060089111f, 0.354636400938034f,
+  0.853553414344788f, 0.353553384542465f, 0.854636430740356f, 0.352467030286789f,
+  0.855716109275818f, 0.351377367973328f, 0.856792449951172f, 0.350284397602081f,
+  0.857865393161774f, 0.349188119173050f, 0.858934998512268f, 0.348088562488556f,
+  0.860001266002655f, 0.346985727548599f, 0.861064076423645f, 0.345879614353180f,
+  0.862123548984528f, 0.344770282506943f, 0.863179564476013f, 0.343657672405243f,
+  0.864232182502747f, 0.342541843652725f, 0.865281403064728f, 0.341422766447067f,
+  0.866327106952667f, 0.340300500392914f, 0.867369413375854f, 0.339175015687943f,
+  0.868408262729645f, 0.338046342134476f, 0.869443655014038f, 0.336914509534836f,
+  0.870475590229034f, 0.335779488086700f, 0.871503949165344f, 0.334641307592392f,
+  0.872528910636902f, 0.333499968051910f, 0.873550295829773f, 0.332355499267578f,
+  0.874568223953247f, 0.331207901239395f, 0.875582575798035f, 0.330057173967361f,
+  0.876593410968781f, 0.328903347253799f, 0.877600669860840f, 0.327746421098709f,
+  0.878604412078857f, 0.326586425304413f, 0.879604578018188f, 0.325423330068588f,
+  0.880601167678833f, 0.324257194995880f, 0.881594181060791f, 0.323088020086288f,
+  0.882583618164063f, 0.321915775537491f, 0.883569478988647f, 0.320740520954132f,
+  0.884551644325256f, 0.319562226533890f, 0.885530233383179f, 0.318380922079086f,
+  0.886505246162415f, 0.317196637392044f, 0.887476563453674f, 0.316009372472763f,
+  0.888444244861603f, 0.314819127321243f, 0.889408230781555f, 0.313625901937485f,
+  0.890368640422821f, 0.312429755926132f, 0.891325294971466f, 0.311230629682541f,
+  0.892278313636780f, 0.310028612613678f, 0.893227577209473f, 0.308823645114899f,
+  0.894173204898834f, 0.307615786790848f, 0.895115137100220f, 0.306405037641525f,
+  0.896053314208984f, 0.305191397666931f, 0.896987736225128f, 0.303974896669388f,
+  0.897918462753296f, 0.302755534648895f, 0.898845434188843f, 0.301533311605453f,
+  0.899768650531769f, 0.300308227539063f, 0.900688111782074f, 0.299080342054367f,
+  0.901603758335114f, 0.297849655151367f, 0.902515649795532f, 0.296616137027740f,
+  0.903423786163330f, 0.295379847288132f, 0.904328107833862f, 0.294140785932541f,
+  0.905228614807129f, 0.292898923158646f, 0.906125307083130f, 0.291654318571091f,
+  0.907018184661865f, 0.290406972169876f, 0.907907187938690f, 0.289156883955002f,
+  0.908792436122894f, 0.287904083728790f, 0.909673750400543f, 0.286648571491241f,
+  0.910551249980927f, 0.285390377044678f, 0.911424875259399f, 0.284129470586777f,
+  0.912294626235962f, 0.282865911722183f, 0.913160502910614f, 0.281599670648575f,
+  0.914022505283356f, 0.280330777168274f, 0.914880633354187f, 0.279059261083603f,
+  0.915734827518463f, 0.277785122394562f, 0.916585087776184f, 0.276508361101151f,
+  0.917431414127350f, 0.275228977203369f, 0.918273866176605f, 0.273947030305862f,
+  0.919112324714661f, 0.272662490606308f, 0.919946908950806f, 0.271375387907028f,
+  0.920777499675751f, 0.270085722208023f, 0.921604096889496f, 0.268793523311615f,
+  0.922426760196686f, 0.267498821020126f, 0.923245489597321f, 0.266201555728912f,
+  0.924060165882111f, 0.264901816844940f, 0.924870908260345f, 0.263599574565887f,
+  0.925677597522736f, 0.262294828891754f, 0.926480293273926f, 0.260987639427185f,
+  0.927278995513916f, 0.259678006172180f, 0.928073644638062f, 0.258365899324417f,
+  0.928864300251007f, 0.257051378488541f, 0.929650902748108f, 0.255734413862228f,
+  0.930433452129364f, 0.254415065050125f, 0.931211948394775f, 0.253093332052231f,
+  0.931986451148987f, 0.251769185066223f, 0.932756841182709f, 0.250442683696747f,
+  0.933523118495941f, 0.249113827943802f, 0.934285342693329f, 0.247782632708550f,
+  0.935043513774872f, 0.246449097990990f, 0.935797572135925f, 0.245113238692284f,
+  0.936547517776489f, 0.243775084614754f, 0.937293350696564f, 0.242434620857239f,
+  0.938035070896149f, 0.241091892123222f, 0.938772618770599f, 0.239746883511543f,
+  0.939506113529205f, 0.238399609923363f, 0.940235435962677f, 0.237050101161003f,
+  0.940960645675659f, 0.235698372125626f, 0.941681683063507f, 0.234344407916069f,
+  0.942398548126221f, 0.232988253235817f, 0.943111240863800f, 0.231629893183708f,
+  0.943819820880890f, 0.230269357562065f, 0.944524168968201f, 0.228906646370888f,
+  0.945224344730377f, 0.227541789412498f, 0.945920348167419f, 0.226174786686897f,
+  0.946612179279327f, 0.224805667996407f, 0.947299718856812f, 0.223434418439865f,
+  0.947983145713806f, 0.222061067819595f, 0.948662281036377f, 0.220685631036758f,
+  0.949337244033813f, 0.219308122992516f, 0.950007975101471f, 0.217928543686867f,
+  0.950674414634705f, 0.216546908020973f, 0.951336681842804f, 0.215163245797157f,
+  0.951994657516479f, 0.213777542114258f, 0.952648401260376f, 0.212389841675758f,
+  0.953297853469849f, 0.211000129580498f, 0.953943073749542f, 0.209608450531960f,
+  0.954584002494812f, 0.208214774727821f, 0.955220639705658f, 0.206819161772728f,
+  0.955853044986725f, 0.205421581864357f, 0.956481099128723f, 0.204022079706192f,
+  0.957104861736298f, 0.202620655298233f, 0.957724332809448f, 0.201217323541641f,
+  0.958339512348175f, 0.199812099337578f, 0.958950400352478f, 0.198404997587204f,
+  0.959556937217712f, 0.196996018290520f, 0.960159122943878f, 0.195585191249847f,
+  0.960757017135620f, 0.194172516465187f, 0.961350560188293f, 0.192758023738861f,
+  0.961939752101898f, 0.191341713070869f, 0.962524592876434f, 0.189923599362373f,
+  0.963105142116547f, 0.188503712415695f, 0.963681280612946f, 0.187082037329674f,
+  0.964253067970276f, 0.185658603906631f, 0.964820444583893f, 0.184233412146568f,
+  0.965383470058441f, 0.182806491851807f, 0.965942144393921f, 0.181377857923508f,
+  0.966496407985687f, 0.179947525262833f, 0.967046260833740f, 0.178515478968620f,
+  0.967591762542725f, 0.177081763744354f, 0.968132853507996f, 0.175646379590034f,
+  0.968669533729553f, 0.174209341406822f, 0.969201743602753f, 0.172770664095879f,
+  0.969729602336884f, 0.171330362558365f, 0.970253050327301f, 0.169888436794281f,
+  0.970772027969360f, 0.168444931507111f, 0.971286594867706f, 0.166999831795692f,
+  0.971796751022339f, 0.165553152561188f, 0.972302436828613f, 0.164104923605919f,
+  0.972803652286530f, 0.162655144929886f, 0.973300457000732f, 0.161203846335411f,
+  0.973792791366577f, 0.159751012921333f, 0.974280655384064f, 0.158296689391136f,
+  0.974764108657837f, 0.156840875744820f, 0.975243031978607f, 0.155383571982384f,
+  0.975717484951019f, 0.153924822807312f, 0.976187527179718f, 0.152464613318443f,
+  0.976653039455414f, 0.151002973318100f, 0.977114021778107f, 0.149539917707443f,
+  0.977570593357086f, 0.148075446486473f, 0.978022634983063f, 0.146609574556351f,
+  0.978470146656036f, 0.145142331719399f, 0.978913187980652f, 0.143673732876778f,
+  0.979351758956909f, 0.142203763127327f, 0.979785740375519f, 0.140732467174530f,
+  0.980215251445770f, 0.139259845018387f, 0.980640232563019f, 0.137785911560059f,
+  0.981060683727264f, 0.136310681700706f, 0.981476604938507f, 0.134834155440331f,
+  0.981888055801392f, 0.133356377482414f, 0.982294917106628f, 0.131877332925797f,
+  0.982697248458862f, 0.130397051572800f, 0.983094990253448f, 0.128915548324585f,
+  0.983488261699677f, 0.127432823181152f, 0.983876943588257f, 0.125948905944824f,
+  0.984261035919189f, 0.124463804066181f, 0.984640598297119f, 0.122977524995804f,
+  0.985015630722046f, 0.121490091085434f, 0.985386073589325f, 0.120001509785652f,
+  0.985751926898956f, 0.118511803448200f, 0.986113250255585f, 0.117020979523659f,
+  0.986469984054565f, 0.115529052913189f, 0.986822128295898f, 0.114036038517952f,
+  0.987169682979584f, 0.112541958689690f, 0.987512648105621f, 0.111046813428402f,
+  0.987851083278656f, 0.109550617635250f, 0.988184869289398f, 0.108053401112556f,
+  0.988514065742493f, 0.106555156409740f, 0.988838672637939f, 0.105055920779705f,
+  0.989158689975739f, 0.103555686771870f, 0.989474058151245f, 0.102054484188557f,
+  0.989784896373749f, 0.100552320480347f, 0.990091085433960f, 0.099049203097820f,
+  0.990392625331879f, 0.097545161843300f, 0.990689575672150f, 0.096040196716785f,
+  0.990981936454773f, 0.094534330070019f, 0.991269648075104f, 0.093027576804161f,
+  0.991552770137787f, 0.091519944369793f, 0.991831183433533f, 0.090011447668076f,
+  0.992105066776276f, 0.088502109050751f, 0.992374241352081f, 0.086991935968399f,
+  0.992638826370239f, 0.085480943322182f, 0.992898762226105f, 0.083969146013260f,
+  0.993154048919678f, 0.082456558942795f, 0.993404686450958f, 0.080943197011948f,
+  0.993650734424591f, 0.079429075121880f, 0.993892073631287f, 0.077914200723171f,
+  0.994128763675690f, 0.076398596167564f, 0.994360864162445f, 0.074882268905640f,
+  0.994588255882263f, 0.073365233838558f, 0.994810998439789f, 0.071847513318062f,
+  0.995029091835022f, 0.070329122245312f, 0.995242536067963f, 0.068810060620308f,
+  0.995451331138611f, 0.067290350794792f, 0.995655417442322f, 0.065770015120506f,
+  0.995854854583740f, 0.064249053597450f, 0.996049642562866f, 0.062727488577366f,
+  0.996239781379700f, 0.061205338686705f, 0.996425211429596f, 0.059682607650757f,
+  0.996605992317200f, 0.058159314095974f, 0.996782064437866f, 0.056635476648808f,
+  0.996953487396240f, 0.055111102759838f, 0.997120201587677f, 0.053586211055517f,
+  0.997282266616821f, 0.052060816437006f, 0.997439682483673f, 0.050534930080175f,
+  0.997592389583588f, 0.049008570611477f, 0.997740387916565f, 0.047481749206781f,
+  0.997883677482605f, 0.045954477041960f, 0.998022377490997f, 0.044426776468754f,
+  0.998156309127808f, 0.042898654937744f, 0.998285591602325f, 0.041370131075382f,
+  0.998410165309906f, 0.039841219782829f, 0.998530030250549f, 0.038311932235956f,
+  0.998645246028900f, 0.036782283335924f, 0.998755753040314f, 0.035252287983894f,
+  0.998861551284790f, 0.033721961081028f, 0.998962640762329f, 0.032191313803196f,
+  0.999059081077576f, 0.030660368502140f, 0.999150753021240f, 0.029129132628441f,
+  0.999237775802612f, 0.027597622945905f, 0.999320089817047f, 0.026065852493048f,
+  0.999397754669189f, 0.024533838033676f, 0.999470651149750f, 0.023001590743661f,
+  0.999538838863373f, 0.021469129249454f, 0.999602377414703f, 0.019936462864280f,
+  0.999661207199097f, 0.018403612077236f, 0.999715328216553f, 0.016870586201549f,
+  0.999764680862427f, 0.015337402001023f, 0.999809384346008f, 0.013804072514176f,
+  0.999849438667297f, 0.012270614504814f, 0.999884724617004f, 0.010737040080130f,
+  0.999915301799774f, 0.009203365072608f, 0.999941170215607f, 0.007669602986425f,
+  0.999962329864502f, 0.006135769188404f, 0.999978840351105f, 0.004601877182722f,
+  0.999990582466125f, 0.003067942336202f, 0.999997675418854f, 0.001533978385851f,
+  1.000000000000000f, 0.000000000000023f, 0.999997675418854f, -0.001533978385851f,
+  0.999990582466125f, -0.003067942336202f, 0.999978840351105f, -0.004601877182722f,
+  0.999962329864502f, -0.006135769188404f, 0.999941170215607f, -0.007669602986425f,
+  0.999915301799774f, -0.009203365072608f, 0.999884724617004f, -0.010737040080130f,
+  0.999849438667297f, -0.012270614504814f, 0.999809384346008f, -0.013804072514176f,
+  0.999764680862427f, -0.015337402001023f, 0.999715328216553f, -0.016870586201549f,
+  0.999661207199097f, -0.018403612077236f, 0.999602377414703f, -0.019936462864280f,
+  0.999538838863373f, -0.021469129249454f, 0.999470651149750f, -0.023001590743661f,
+  0.999397754669189f, -0.024533838033676f, 0.999320089817047f, -0.026065852493048f,
+  0.999237775802612f, -0.027597622945905f, 0.999150753021240f, -0.029129132628441f,
+  0.999059081077576f, -0.030660368502140f, 0.998962640762329f, -0.032191313803196f,
+  0.998861551284790f, -0.033721961081028f, 0.998755753040314f, -0.035252287983894f,
+  0.998645246028900f, -0.036782283335924f, 0.998530030250549f, -0.038311932235956f,
+  0.998410165309906f, -0.039841219782829f, 0.998285591602325f, -0.041370131075382f,
+  0.998156309127808f, -0.042898654937744f, 0.998022377490997f, -0.044426776468754f,
+  0.997883677482605f, -0.045954477041960f, 0.997740387916565f, -0.047481749206781f,
+  0.997592389583588f, -0.049008570611477f, 0.997439682483673f, -0.050534930080175f,
+  0.997282266616821f, -0.052060816437006f, 0.997120201587677f, -0.053586211055517f,
+  0.996953487396240f, -0.055111102759838f, 0.996782064437866f, -0.056635476648808f,
+  0.996605992317200f, -0.058159314095974f, 0.996425211429596f, -0.059682607650757f,
+  0.996239781379700f, -0.061205338686705f, 0.996049642562866f, -0.062727488577366f,
+  0.995854854583740f, -0.064249053597450f, 0.995655417442322f, -0.065770015120506f,
+  0.995451331138611f, -0.067290350794792f, 0.995242536067963f, -0.068810060620308f,
+  0.995029091835022f, -0.070329122245312f, 0.994810998439789f, -0.071847513318062f,
+  0.994588255882263f, -0.073365233838558f, 0.994360864162445f, -0.074882268905640f,
+  0.994128763675690f, -0.076398596167564f, 0.993892073631287f, -0.077914200723171f,
+  0.993650734424591f, -0.079429075121880f, 0.993404686450958f, -0.080943197011948f,
+  0.993154048919678f, -0.082456558942795f, 0.992898762226105f, -0.083969146013260f,
+  0.992638826370239f, -0.085480943322182f, 0.992374241352081f, -0.086991935968399f,
+  0.992105066776276f, -0.088502109050751f, 0.991831183433533f, -0.090011447668076f,
+  0.991552770137787f, -0.091519944369793f, 0.991269648075104f, -0.093027576804161f,
+  0.990981936454773f, -0.094534330070019f, 0.990689575672150f, -0.096040196716785f,
+  0.990392625331879f, -0.097545161843300f, 0.990091085433960f, -0.099049203097820f,
+  0.989784896373749f, -0.100552320480347f, 0.989474058151245f, -0.102054484188557f,
+  0.989158689975739f, -0.103555686771870f, 0.988838672637939f, -0.105055920779705f,
+  0.988514065742493f, -0.106555156409740f, 0.988184869289398f, -0.108053401112556f,
+  0.987851083278656f, -0.109550617635250f, 0.987512648105621f, -0.111046813428402f,
+  0.987169682979584f, -0.112541958689690f, 0.986822128295898f, -0.114036038517952f,
+  0.986469984054565f, -0.115529052913189f, 0.986113250255585f, -0.117020979523659f,
+  0.985751926898956f, -0.118511803448200f, 0.985386073589325f, -0.120001509785652f,
+  0.985015630722046f, -0.121490091085434f, 0.984640598297119f, -0.122977524995804f,
+  0.984261035919189f, -0.124463804066181f, 0.983876943588257f, -0.125948905944824f,
+  0.983488261699677f, -0.127432823181152f, 0.983094990253448f, -0.128915548324585f,
+  0.982697248458862f, -0.130397051572800f, 0.982294917106628f, -0.131877332925797f,
+  0.981888055801392f, -0.133356377482414f, 0.981476604938507f, -0.134834155440331f,
+  0.981060683727264f, -0.136310681700706f, 0.980640232563019f, -0.137785911560059f,
+  0.980215251445770f, -0.139259845018387f, 0.979785740375519f, -0.140732467174530f,
+  0.979351758956909f, -0.142203763127327f, 0.978913187980652f, -0.143673732876778f,
+  0.978470146656036f, -0.145142331719399f, 0.978022634983063f, -0.146609574556351f,
+  0.977570593357086f, -0.148075446486473f, 0.977114021778107f, -0.149539917707443f,
+  0.976653039455414f, -0.151002973318100f, 0.976187527179718f, -0.152464613318443f,
+  0.975717484951019f, -0.153924822807312f, 0.975243031978607f, -0.155383571982384f,
+  0.974764108657837f, -0.156840875744820f, 0.974280655384064f, -0.158296689391136f,
+  0.973792791366577f, -0.159751012921333f, 0.973300457000732f, -0.161203846335411f,
+  0.972803652286530f, -0.162655144929886f, 0.972302436828613f, -0.164104923605919f,
+  0.971796751022339f, -0.165553152561188f, 0.971286594867706f, -0.166999831795692f,
+  0.970772027969360f, -0.168444931507111f, 0.970253050327301f, -0.169888436794281f,
+  0.969729602336884f, -0.171330362558365f, 0.969201743602753f, -0.172770664095879f,
+  0.968669533729553f, -0.174209341406822f, 0.968132853507996f, -0.175646379590034f,
+  0.967591762542725f, -0.177081763744354f, 0.967046260833740f, -0.178515478968620f,
+  0.966496407985687f, -0.179947525262833f, 0.965942144393921f, -0.181377857923508f,
+  0.965383470058441f, -0.182806491851807f, 0.964820444583893f, -0.184233412146568f,
+  0.964253067970276f, -0.185658603906631f, 0.963681280612946f, -0.187082037329674f,
+  0.963105142116547f, -0.188503712415695f, 0.962524592876434f, -0.189923599362373f,
+  0.961939752101898f, -0.191341713070869f, 0.961350560188293f, -0.192758023738861f,
+  0.960757017135620f, -0.194172516465187f, 0.960159122943878f, -0.195585191249847f,
+  0.959556937217712f, -0.196996018290520f, 0.958950400352478f, -0.198404997587204f,
+  0.958339512348175f, -0.199812099337578f, 0.957724332809448f, -0.201217323541641f,
+  0.957104861736298f, -0.202620655298233f, 0.956481099128723f, -0.204022079706192f,
+  0.955853044986725f, -0.205421581864357f, 0.955220639705658f, -0.206819161772728f,
+  0.954584002494812f, -0.208214774727821f, 0.953943073749542f, -0.209608450531960f,
+  0.953297853469849f, -0.211000129580498f, 0.952648401260376f, -0.212389841675758f,
+  0.951994657516479f, -0.213777542114258f, 0.951336681842804f, -0.215163245797157f,
+  0.950674414634705f, -0.216546908020973f, 0.950007975101471f, -0.217928543686867f,
+  0.949337244033813f, -0.219308122992516f, 0.948662281036377f, -0.220685631036758f,
+  0.947983145713806f, -0.222061067819595f, 0.947299718856812f, -0.223434418439865f,
+  0.946612179279327f, -0.224805667996407f, 0.945920348167419f, -0.226174786686897f,
+  0.945224344730377f, -0.227541789412498f, 0.944524168968201f, -0.228906646370888f,
+  0.943819820880890f, -0.230269357562065f, 0.943111240863800f, -0.231629893183708f,
+  0.942398548126221f, -0.232988253235817f, 0.941681683063507f, -0.234344407916069f,
+  0.940960645675659f, -0.235698372125626f, 0.940235435962677f, -0.237050101161003f,
+  0.939506113529205f, -0.238399609923363f, 0.938772618770599f, -0.239746883511543f,
+  0.938035070896149f, -0.241091892123222f, 0.937293350696564f, -0.242434620857239f,
+  0.936547517776489f, -0.243775084614754f, 0.935797572135925f, -0.245113238692284f,
+  0.935043513774872f, -0.246449097990990f, 0.934285342693329f, -0.247782632708550f,
+  0.933523118495941f, -0.249113827943802f, 0.932756841182709f, -0.250442683696747f,
+  0.931986451148987f, -0.251769185066223f, 0.931211948394775f, -0.253093332052231f,
+  0.930433452129364f, -0.254415065050125f, 0.929650902748108f, -0.255734413862228f,
+  0.928864300251007f, -0.257051378488541f, 0.928073644638062f, -0.258365899324417f,
+  0.927278995513916f, -0.259678006172180f, 0.926480293273926f, -0.260987639427185f,
+  0.925677597522736f, -0.262294828891754f, 0.924870908260345f, -0.263599574565887f,
+  0.924060165882111f, -0.264901816844940f, 0.923245489597321f, -0.266201555728912f,
+  0.922426760196686f, -0.267498821020126f, 0.921604096889496f, -0.268793523311615f,
+  0.920777499675751f, -0.270085722208023f, 0.919946908950806f, -0.271375387907028f,
+  0.919112324714661f, -0.272662490606308f, 0.918273866176605f, -0.273947030305862f,
+  0.917431414127350f, -0.275228977203369f, 0.916585087776184f, -0.276508361101151f,
+  0.915734827518463f, -0.277785122394562f, 0.914880633354187f, -0.279059261083603f,
+  0.914022505283356f, -0.280330777168274f, 0.913160502910614f, -0.281599670648575f,
+  0.912294626235962f, -0.282865911722183f, 0.911424875259399f, -0.284129470586777f,
+  0.910551249980927f, -0.285390377044678f, 0.909673750400543f, -0.286648571491241f,
+  0.908792436122894f, -0.287904083728790f, 0.907907187938690f, -0.289156883955002f,
+  0.907018184661865f, -0.290406972169876f, 0.906125307083130f, -0.291654318571091f,
+  0.905228614807129f, -0.292898923158646f, 0.904328107833862f, -0.294140785932541f,
+  0.903423786163330f, -0.295379847288132f, 0.902515649795532f, -0.296616137027740f,
+  0.901603758335114f, -0.297849655151367f, 0.900688111782074f, -0.299080342054367f,
+  0.899768650531769f, -0.300308227539063f, 0.898845434188843f, -0.301533311605453f,
+  0.897918462753296f, -0.302755534648895f, 0.896987736225128f, -0.303974896669388f,
+  0.896053314208984f, -0.305191397666931f, 0.895115137100220f, -0.306405037641525f,
+  0.894173204898834f, -0.307615786790848f, 0.893227577209473f, -0.308823645114899f,
+  0.892278313636780f, -0.310028612613678f, 0.891325294971466f, -0.311230629682541f,
+  0.890368640422821f, -0.312429755926132f, 0.889408230781555f, -0.313625901937485f,
+  0.888444244861603f, -0.314819127321243f, 0.887476563453674f, -0.316009372472763f,
+  0.886505246162415f, -0.317196637392044f, 0.885530233383179f, -0.318380922079086f,
+  0.884551644325256f, -0.319562226533890f, 0.883569478988647f, -0.320740520954132f,
+  0.882583618164063f, -0.321915775537491f, 0.881594181060791f, -0.323088020086288f,
+  0.880601167678833f, -0.324257194995880f, 0.879604578018188f, -0.325423330068588f,
+  0.878604412078857f, -0.326586425304413f, 0.877600669860840f, -0.327746421098709f,
+  0.876593410968781f, -0.328903347253799f, 0.875582575798035f, -0.330057173967361f,
+  0.874568223953247f, -0.331207901239395f, 0.873550295829773f, -0.332355499267578f,
+  0.872528910636902f, -0.333499968051910f, 0.871503949165344f, -0.334641307592392f,
+  0.870475590229034f, -0.335779488086700f, 0.869443655014038f, -0.336914509534836f,
+  0.868408262729645f, -0.338046342134476f, 0.867369413375854f, -0.339175015687943f,
+  0.866327106952667f, -0.340300500392914f, 0.865281403064728f, -0.341422766447067f,
+  0.864232182502747f, -0.342541843652725f, 0.863179564476013f, -0.343657672405243f,
+  0.862123548984528f, -0.344770282506943f, 0.861064076423645f, -0.345879614353180f,
+  0.860001266002655f, -0.346985727548599f, 0.858934998512268f, -0.348088562488556f,
+  0.857865393161774f, -0.349188119173050f, 0.856792449951172f, -0.350284397602081f,
+  0.855716109275818f, -0.351377367973328f, 0.854636430740356f, -0.352467030286789f,
+  0.853553414344788f, -0.353553384542465f, 0.852467060089111f, -0.354636400938034f,
+  0.851377367973328f, -0.355716109275818f, 0.850284397602081f, -0.356792420148849f,
+  0.849188148975372f, -0.357865422964096f, 0.848088562488556f, -0.358935028314590f,
+  0.846985757350922f, -0.360001266002655f, 0.845879614353180f, -0.361064106225967f,
+  0.844770252704620f, -0.362123548984528f, 0.843657672405243f, -0.363179564476013f,
+  0.842541813850403f, -0.364232182502747f, 0.841422796249390f, -0.365281373262405f,
+  0.840300500392914f, -0.366327136754990f, 0.839175045490265f, -0.367369443178177f,
+  0.838046371936798f, -0.368408292531967f, 0.836914479732513f, -0.369443655014038f,
+  0.835779488086700f, -0.370475560426712f, 0.834641277790070f, -0.371503978967667f,
+  0.833499968051910f, -0.372528880834579f, 0.832355499267578f, -0.373550295829773f,
+  0.831207871437073f, -0.374568194150925f, 0.830057144165039f, -0.375582575798035f,
+  0.828903317451477f, -0.376593410968781f, 0.827746450901031f, -0.377600699663162f,
+  0.826586425304413f, -0.378604412078857f, 0.825423359870911f, -0.379604607820511f,
+  0.824257194995880f, -0.380601197481155f, 0.823087990283966f, -0.381594210863113f,
+  0.821915745735168f, -0.382583618164063f, 0.820740520954132f, -0.383569449186325f,
+  0.819562196731567f, -0.384551674127579f, 0.818380951881409f, -0.385530263185501f,
+  0.817196667194366f, -0.386505216360092f, 0.816009342670441f, -0.387476563453674f,
+  0.814819097518921f, -0.388444244861603f, 0.813625931739807f, -0.389408260583878f,
+  0.812429726123810f, -0.390368610620499f, 0.811230659484863f, -0.391325294971466f,
+  0.810028612613678f, -0.392278283834457f, 0.808823645114899f, -0.393227607011795f,
+  0.807615816593170f, -0.394173204898834f, 0.806405067443848f, -0.395115107297897f,
+  0.805191397666931f, -0.396053284406662f, 0.803974866867065f, -0.396987736225128f,
+  0.802755534648895f, -0.397918462753296f, 0.801533281803131f, -0.398845434188843f,
+  0.800308227539063f, -0.399768620729446f, 0.799080371856689f, -0.400688081979752f,
+  0.797849655151367f, -0.401603758335114f, 0.796616137027740f, -0.402515679597855f,
+  0.795379877090454f, -0.403423786163330f, 0.794140756130219f, -0.404328078031540f,
+  0.792898952960968f, -0.405228585004807f, 0.791654348373413f, -0.406125307083130f,
+  0.790407001972198f, -0.407018154859543f, 0.789156913757324f, -0.407907217741013f,
+  0.787904083728790f, -0.408792406320572f, 0.786648571491241f, -0.409673750400543f,
+  0.785390377044678f, -0.410551249980927f, 0.784129500389099f, -0.411424905061722f,
+  0.782865881919861f, -0.412294656038284f, 0.781599700450897f, -0.413160532712936f,
+  0.780330777168274f, -0.414022535085678f, 0.779059290885925f, -0.414880603551865f,
+  0.777785122394562f, -0.415734797716141f, 0.776508331298828f, -0.416585087776184f,
+  0.775228977203369f, -0.417431443929672f, 0.773947000503540f, -0.418273866176605f,
+  0.772662520408630f, -0.419112354516983f, 0.771375417709351f, -0.419946908950806f,
+  0.770085752010345f, -0.420777499675751f, 0.768793523311615f, -0.421604126691818f,
+  0.767498791217804f, -0.422426789999008f, 0.766201555728912f, -0.423245459794998f,
+  0.764901816844940f, -0.424060165882111f, 0.763599574565887f, -0.424870878458023f,
+  0.762294828891754f, -0.425677597522736f, 0.760987639427185f, -0.426480293273926f,
+  0.759678006172180f, -0.427278995513916f, 0.758365929126740f, -0.428073674440384f,
+  0.757051348686218f, -0.428864300251007f, 0.755734443664551f, -0.429650902748108f,
+  0.754415094852448f, -0.430433481931686f, 0.753093302249908f, -0.431211978197098f,
+  0.751769185066223f, -0.431986421346664f, 0.750442683696747f, -0.432756811380386f,
+  0.749113857746124f, -0.433523118495941f, 0.747782647609711f, -0.434285342693329f,
+  0.746449112892151f, -0.435043483972549f, 0.745113253593445f, -0.435797542333603f,
+  0.743775069713593f, -0.436547487974167f, 0.742434620857239f, -0.437293320894241f,
+  0.741091907024384f, -0.438035041093826f, 0.739746868610382f, -0.438772648572922f,
+  0.738399624824524f, -0.439506113529205f, 0.737050116062164f, -0.440235435962677f,
+  0.735698342323303f, -0.440960645675659f, 0.734344422817230f, -0.441681683063507f,
+  0.732988238334656f, -0.442398548126221f, 0.731629908084869f, -0.443111270666122f,
+  0.730269372463226f, -0.443819820880890f, 0.728906631469727f, -0.444524168968201f,
+  0.727541804313660f, -0.445224374532700f, 0.726174771785736f, -0.445920348167419f,
+  0.724805653095245f, -0.446612149477005f, 0.723434448242188f, -0.447299748659134f,
+  0.722061097621918f, -0.447983115911484f, 0.720685660839081f, -0.448662281036377f,
+  0.719308137893677f, -0.449337244033813f, 0.717928528785706f, -0.450007945299149f,
+  0.716546893119812f, -0.450674414634705f, 0.715163230895996f, -0.451336652040482f,
+  0.713777542114258f, -0.451994657516479f, 0.712389826774597f, -0.452648371458054f,
+  0.711000144481659f, -0.453297853469849f, 0.709608435630798f, -0.453943043947220f,
+  0.708214759826660f, -0.454584002494812f, 0.706819176673889f, -0.455220639705658f,
+  0.705421566963196f, -0.455853015184402f, 0.704022109508514f, -0.456481099128723f,
+  0.702620685100555f, -0.457104891538620f, 0.701217353343964f, -0.457724362611771f,
+  0.699812114238739f, -0.458339542150497f, 0.698404967784882f, -0.458950400352478f,
+  0.696996033191681f, -0.459556937217712f, 0.695585191249847f, -0.460159152746201f,
+  0.694172501564026f, -0.460757017135620f, 0.692758023738861f, -0.461350560188293f,
+  0.691341698169708f, -0.461939752101898f, 0.689923584461212f, -0.462524622678757f,
+  0.688503682613373f, -0.463105112314224f, 0.687082052230835f, -0.463681250810623f,
+  0.685658574104309f, -0.464253038167953f, 0.684233427047729f, -0.464820444583893f,
+  0.682806491851807f, -0.465383470058441f, 0.681377887725830f, -0.465942144393921f,
+  0.679947495460510f, -0.466496407985687f, 0.678515493869781f, -0.467046260833740f,
+  0.677081763744354f, -0.467591762542725f, 0.675646364688873f, -0.468132823705673f,
+  0.674209356307983f, -0.468669503927231f, 0.672770678997040f, -0.469201773405075f,
+  0.671330332756042f, -0.469729602336884f, 0.669888436794281f, -0.470253020524979f,
+  0.668444931507111f, -0.470772027969360f, 0.666999816894531f, -0.471286594867706f,
+  0.665553152561188f, -0.471796721220016f, 0.664104938507080f, -0.472302407026291f,
+  0.662655174732208f, -0.472803652286530f, 0.661203861236572f, -0.473300457000732f,
+  0.659750998020172f, -0.473792791366577f, 0.658296704292297f, -0.474280685186386f,
+  0.656840860843658f, -0.474764078855515f, 0.655383586883545f, -0.475243031978607f,
+  0.653924822807312f, -0.475717514753342f, 0.652464628219604f, -0.476187497377396f,
+  0.651003003120422f, -0.476653009653091f, 0.649539887905121f, -0.477114051580429f,
+  0.648075461387634f, -0.477570593357086f, 0.646609604358673f, -0.478022634983063f,
+  0.645142316818237f, -0.478470176458359f, 0.643673717975616f, -0.478913217782974f,
+  0.642203748226166f, -0.479351729154587f, 0.640732467174530f, -0.479785770177841f,
+  0.639259815216064f, -0.480215251445770f, 0.637785911560059f, -0.480640232563019f,
+  0.636310696601868f, -0.481060713529587f, 0.634834170341492f, -0.481476634740829f,
+  0.633356392383575f, -0.481888025999069f, 0.631877362728119f, -0.482294887304306f,
+  0.630397081375122f, -0.482697218656540f, 0.628915548324585f, -0.483094990253448f,
+  0.627432823181152f, -0.483488231897354f, 0.625948905944824f, -0.483876913785934f,
+  0.624463796615601f, -0.484261035919189f, 0.622977554798126f, -0.484640628099442f,
+  0.621490061283112f, -0.485015630722046f, 0.620001494884491f, -0.485386073589325f,
+  0.618511795997620f, -0.485751956701279f, 0.617020964622498f, -0.486113250255585f,
+  0.615529060363770f, -0.486469984054565f, 0.614036023616791f, -0.486822128295898f,
+  0.612541973590851f, -0.487169682979584f, 0.611046791076660f, -0.487512677907944f,
+  0.609550595283508f, -0.487851053476334f, 0.608053386211395f, -0.488184869289398f,
+  0.606555163860321f, -0.488514065742493f, 0.605055928230286f, -0.488838672637939f,
+  0.603555679321289f, -0.489158689975739f, 0.602054476737976f, -0.489474087953568f,
+  0.600552320480347f, -0.489784896373749f, 0.599049210548401f, -0.490091055631638f,
+  0.597545146942139f, -0.490392625331879f, 0.596040189266205f, -0.490689605474472f,
+  0.594534337520599f, -0.490981936454773f, 0.593027591705322f, -0.491269648075104f,
+  0.591519951820374f, -0.491552740335464f, 0.590011477470398f, -0.491831213235855f,
+  0.588502109050751f, -0.492105036973953f, 0.586991965770721f, -0.492374241352081f,
+  0.585480928421021f, -0.492638826370239f, 0.583969175815582f, -0.492898762226105f,
+  0.582456588745117f, -0.493154048919678f, 0.580943167209625f, -0.493404686450958f,
+  0.579429090023041f, -0.493650704622269f, 0.577914178371429f, -0.493892073631287f,
+  0.576398611068726f, -0.494128793478012f, 0.574882268905640f, -0.494360834360123f,
+  0.573365211486816f, -0.494588255882263f, 0.571847498416901f, -0.494810998439789f,
+  0.570329129695892f, -0.495029091835022f, 0.568810045719147f, -0.495242536067963f,
+  0.567290365695953f, -0.495451331138611f, 0.565770030021667f, -0.495655417442322f,
+  0.564249038696289f, -0.495854884386063f, 0.562727510929108f, -0.496049642562866f,
+  0.561205327510834f, -0.496239781379700f, 0.559682607650757f, -0.496425211429596f,
+  0.558159291744232f, -0.496605962514877f, 0.556635499000549f, -0.496782064437866f,
+  0.555111110210419f, -0.496953487396240f, 0.553586184978485f, -0.497120231389999f,
+  0.552060842514038f, -0.497282296419144f, 0.550534904003143f, -0.497439652681351f,
+  0.549008548259735f, -0.497592359781265f, 0.547481775283813f, -0.497740387916565f,
+  0.545954465866089f, -0.497883707284927f, 0.544426798820496f, -0.498022347688675f,
+  0.542898654937744f, -0.498156309127808f, 0.541370153427124f, -0.498285561800003f,
+  0.539841234683990f, -0.498410135507584f, 0.538311958312988f, -0.498530030250549f,
+  0.536782264709473f, -0.498645216226578f, 0.535252273082733f, -0.498755723237991f,
+  0.533721983432770f, -0.498861521482468f, 0.532191336154938f, -0.498962640762329f,
+  0.530660390853882f, -0.499059051275253f, 0.529129147529602f, -0.499150782823563f,
+  0.527597606182098f, -0.499237775802612f, 0.526065826416016f, -0.499320119619370f,
+  0.524533808231354f, -0.499397724866867f, 0.523001611232758f, -0.499470651149750f,
+  0.521469116210938f, -0.499538868665695f, 0.519936442375183f, -0.499602377414703f,
+  0.518403589725494f, -0.499661177396774f, 0.516870558261871f, -0.499715298414230f,
+  0.515337407588959f, -0.499764710664749f, 0.513804078102112f, -0.499809414148331f,
+  0.512270629405975f, -0.499849408864975f, 0.510737061500549f, -0.499884694814682f,
+  0.509203374385834f, -0.499915301799774f, 0.507669627666473f, -0.499941170215607f,
+  0.506135761737823f, -0.499962359666824f, 0.504601895809174f, -0.499978810548782f,
+  0.503067970275879f, -0.499990582466125f, 0.501533985137939f, -0.499997645616531f
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+
+static const float32_t realCoefB[512] = {
+  0.500000000000000f, 0.500000000000000f, 0.506135761737823f, 0.499962359666824f,
+  0.512270629405975f, 0.499849408864975f, 0.518403589725494f, 0.499661177396774f,
+  0.524533808231354f, 0.499397724866867f, 0.530660390853882f, 0.499059051275253f,
+  0.536782264709473f, 0.498645216226578f, 0.542898654937744f, 0.498156309127808f,
+  0.549008548259735f, 0.497592359781265f, 0.555111110210419f, 0.496953487396240f,
+  0.561205327510834f, 0.496239781379700f, 0.567290365695953f, 0.495451331138611f,
+  0.573365211486816f, 0.494588255882263f, 0.579429090023041f, 0.493650704622269f,
+  0.585480928421021f, 0.492638826370239f, 0.591519951820374f, 0.491552740335464f,
+  0.597545146942139f, 0.490392625331879f, 0.603555679321289f, 0.489158689975739f,
+  0.609550595283508f, 0.487851053476334f, 0.615529060363770f, 0.486469984054565f,
+  0.621490061283112f, 0.485015630722046f, 0.627432823181152f, 0.483488231897354f,
+  0.633356392383575f, 0.481888025999069f, 0.639259815216064f, 0.480215251445770f,
+  0.645142316818237f, 0.478470176458359f, 0.651003003120422f, 0.476653009653091f,
+  0.656840860843658f, 0.474764078855515f, 0.662655174732208f, 0.472803652286530f,
+  0.668444931507111f, 0.470772027969360f, 0.674209356307983f, 0.468669503927231f,
+  0.679947495460510f, 0.466496407985687f, 0.685658574104309f, 0.464253038167953f,
+  0.691341698169708f, 0.461939752101898f, 0.696996033191681f, 0.459556937217712f,
+  0.702620685100555f, 0.457104891538620f, 0.708214759826660f, 0.454584002494812f,
+  0.713777542114258f, 0.451994657516479f, 0.719308137893677f, 0.449337244033813f,
+  0.724805653095245f, 0.446612149477005f, 0.730269372463226f, 0.443819820880890f,
+  0.735698342323303f, 0.440960645675659f, 0.741091907024384f, 0.438035041093826f,
+  0.746449112892151f, 0.435043483972549f, 0.751769185066223f, 0.431986421346664f,
+  0.757051348686218f, 0.428864300251007f, 0.762294828891754f, 0.425677597522736f,
+  0.767498791217804f, 0.422426789999008f, 0.772662520408630f, 0.419112354516983f,
+  0.777785122394562f, 0.415734797716141f, 0.782865881919861f, 0.412294656038284f,
+  0.787904083728790f, 0.408792406320572f, 0.792898952960968f, 0.405228585004807f,
+  0.797849655151367f, 0.401603758335114f, 0.802755534648895f, 0.397918462753296f,
+  0.807615816593170f, 0.394173204898834f, 0.812429726123810f, 0.390368610620499f,
+  0.817196667194366f, 0.386505216360092f, 0.821915745735168f, 0.382583618164063f,
+  0.826586425304413f, 0.378604412078857f, 0.831207871437073f, 0.374568194150925f,
+  0.835779488086700f, 0.370475560426712f, 0.840300500392914f, 0.366327136754990f,
+  0.844770252704620f, 0.362123548984528f, 0.849188148975372f, 0.357865422964096f,
+  0.853553414344788f, 0.353553384542465f, 0.857865393161774f, 0.349188119173050f,
+  0.862123548984528f, 0.344770282506943f, 0.866327106952667f, 0.340300500392914f,
+  0.870475590229034f, 0.335779488086700f, 0.874568223953247f, 0.331207901239395f,
+  0.878604412078857f, 0.326586425304413f, 0.882583618164063f, 0.321915775537491f,
+  0.886505246162415f, 0.317196637392044f, 0.890368640422821f, 0.312429755926132f,
+  0.894173204898834f, 0.307615786790848f, 0.897918462753296f, 0.302755534648895f,
+  0.901603758335114f, 0.297849655151367f, 0.905228614807129f, 0.292898923158646f,
+  0.908792436122894f, 0.287904083728790f, 0.912294626235962f, 0.282865911722183f,
+  0.915734827518463f, 0.277785122394562f, 0.919112324714661f, 0.272662490606308f,
+  0.922426760196686f, 0.267498821020126f, 0.925677597522736f, 0.262294828891754f,
+  0.928864300251007f, 0.257051378488541f, 0.931986451148987f, 0.251769185066223f,
+  0.935043513774872f, 0.246449097990990f, 0.938035070896149f, 0.241091892123222f,
+  0.940960645675659f, 0.235698372125626f, 0.943819820880890f, 0.230269357562065f,
+  0.946612179279327f, 0.224805667996407f, 0.949337244033813f, 0.219308122992516f,
+  0.951994657516479f, 0.213777542114258f, 0.954584002494812f, 0.208214774727821f,
+  0.957104861736298f, 0.202620655298233f, 0.959556937217712f, 0.196996018290520f,
+  0.961939752101898f, 0.191341713070869f, 0.964253067970276f, 0.185658603906631f,
+  0.966496407985687f, 0.179947525262833f, 0.968669533729553f, 0.174209341406822f,
+  0.970772027969360f, 0.168444931507111f, 0.972803652286530f, 0.162655144929886f,
+  0.974764108657837f, 0.156840875744820f, 0.976653039455414f, 0.151002973318100f,
+  0.978470146656036f, 0.145142331719399f, 0.980215251445770f, 0.139259845018387f,
+  0.981888055801392f, 0.133356377482414f, 0.983488261699677f, 0.127432823181152f,
+  0.985015630722046f, 0.121490091085434f, 0.986469984054565f, 0.115529052913189f,
+  0.987851083278656f, 0.109550617635250f, 0.989158689975739f, 0.103555686771870f,
+  0.990392625331879f, 0.097545161843300f, 0.991552770137787f, 0.091519944369793f,
+  0.992638826370239f, 0.085480943322182f, 0.993650734424591f, 0.079429075121880f,
+  0.994588255882263f, 0.073365233838558f, 0.995451331138611f, 0.067290350794792f,
+  0.996239781379700f, 0.061205338686705f, 0.996953487396240f, 0.055111102759838f,
+  0.997592389583588f, 0.049008570611477f, 0.998156309127808f, 0.042898654937744f,
+  0.998645246028900f, 0.036782283335924f, 0.999059081077576f, 0.030660368502140f,
+  0.999397754669189f, 0.024533838033676f, 0.999661207199097f, 0.018403612077236f,
+  0.999849438667297f, 0.012270614504814f, 0.999962329864502f, 0.006135769188404f,
+  1.000000000000000f, 0.000000000000023f, 0.999962329864502f, -0.006135769188404f,
+  0.999849438667297f, -0.012270614504814f, 0.999661207199097f, -0.018403612077236f,
+  0.999397754669189f, -0.024533838033676f, 0.999059081077576f, -0.030660368502140f,
+  0.998645246028900f, -0.036782283335924f, 0.998156309127808f, -0.042898654937744f,
+  0.997592389583588f, -0.049008570611477f, 0.996953487396240f, -0.055111102759838f,
+  0.996239781379700f, -0.061205338686705f, 0.995451331138611f, -0.067290350794792f,
+  0.994588255882263f, -0.073365233838558f, 0.993650734424591f, -0.079429075121880f,
+  0.992638826370239f, -0.085480943322182f, 0.991552770137787f, -0.091519944369793f,
+  0.990392625331879f, -0.097545161843300f, 0.989158689975739f, -0.103555686771870f,
+  0.987851083278656f, -0.109550617635250f, 0.986469984054565f, -0.115529052913189f,
+  0.985015630722046f, -0.121490091085434f, 0.983488261699677f, -0.127432823181152f,
+  0.981888055801392f, -0.133356377482414f, 0.980215251445770f, -0.139259845018387f,
+  0.978470146656036f, -0.145142331719399f, 0.976653039455414f, -0.151002973318100f,
+  0.974764108657837f, -0.156840875744820f, 0.972803652286530f, -0.162655144929886f,
+  0.970772027969360f, -0.168444931507111f, 0.968669533729553f, -0.174209341406822f,
+  0.966496407985687f, -0.179947525262833f, 0.964253067970276f, -0.185658603906631f,
+  0.961939752101898f, -0.191341713070869f, 0.959556937217712f, -0.196996018290520f,
+  0.957104861736298f, -0.202620655298233f, 0.954584002494812f, -0.208214774727821f,
+  0.951994657516479f, -0.213777542114258f, 0.949337244033813f, -0.219308122992516f,
+  0.946612179279327f, -0.224805667996407f, 0.943819820880890f, -0.230269357562065f,
+  0.940960645675659f, -0.235698372125626f, 0.938035070896149f, -0.241091892123222f,
+  0.935043513774872f, -0.246449097990990f, 0.931986451148987f, -0.251769185066223f,
+  0.928864300251007f, -0.257051378488541f, 0.925677597522736f, -0.262294828891754f,
+  0.922426760196686f, -0.267498821020126f, 0.919112324714661f, -0.272662490606308f,
+  0.915734827518463f, -0.277785122394562f, 0.912294626235962f, -0.282865911722183f,
+  0.908792436122894f, -0.287904083728790f, 0.905228614807129f, -0.292898923158646f,
+  0.901603758335114f, -0.297849655151367f, 0.897918462753296f, -0.302755534648895f,
+  0.894173204898834f, -0.307615786790848f, 0.890368640422821f, -0.312429755926132f,
+  0.886505246162415f, -0.317196637392044f, 0.882583618164063f, -0.321915775537491f,
+  0.878604412078857f, -0.326586425304413f, 0.874568223953247f, -0.331207901239395f,
+  0.870475590229034f, -0.335779488086700f, 0.866327106952667f, -0.340300500392914f,
+  0.862123548984528f, -0.344770282506943f, 0.857865393161774f, -0.349188119173050f,
+  0.853553414344788f, -0.353553384542465f, 0.849188148975372f, -0.357865422964096f,
+  0.844770252704620f, -0.362123548984528f, 0.840300500392914f, -0.366327136754990f,
+  0.835779488086700f, -0.370475560426712f, 0.831207871437073f, -0.374568194150925f,
+  0.826586425304413f, -0.378604412078857f, 0.821915745735168f, -0.382583618164063f,
+  0.817196667194366f, -0.386505216360092f, 0.812429726123810f, -0.390368610620499f,
+  0.807615816593170f, -0.394173204898834f, 0.802755534648895f, -0.397918462753296f,
+  0.797849655151367f, -0.401603758335114f, 0.792898952960968f, -0.405228585004807f,
+  0.787904083728790f, -0.408792406320572f, 0.782865881919861f, -0.412294656038284f,
+  0.777785122394562f, -0.415734797716141f, 0.772662520408630f, -0.419112354516983f,
+  0.767498791217804f, -0.422426789999008f, 0.762294828891754f, -0.425677597522736f,
+  0.757051348686218f, -0.428864300251007f, 0.751769185066223f, -0.431986421346664f,
+  0.746449112892151f, -0.435043483972549f, 0.741091907024384f, -0.438035041093826f,
+  0.735698342323303f, -0.440960645675659f, 0.730269372463226f, -0.443819820880890f,
+  0.724805653095245f, -0.446612149477005f, 0.719308137893677f, -0.449337244033813f,
+  0.713777542114258f, -0.451994657516479f, 0.708214759826660f, -0.454584002494812f,
+  0.702620685100555f, -0.457104891538620f, 0.696996033191681f, -0.459556937217712f,
+  0.691341698169708f, -0.461939752101898f, 0.685658574104309f, -0.464253038167953f,
+  0.679947495460510f, -0.466496407985687f, 0.674209356307983f, -0.468669503927231f,
+  0.668444931507111f, -0.470772027969360f, 0.662655174732208f, -0.472803652286530f,
+  0.656840860843658f, -0.474764078855515f, 0.651003003120422f, -0.476653009653091f,
+  0.645142316818237f, -0.478470176458359f, 0.639259815216064f, -0.480215251445770f,
+  0.633356392383575f, -0.481888025999069f, 0.627432823181152f, -0.483488231897354f,
+  0.621490061283112f, -0.485015630722046f, 0.615529060363770f, -0.486469984054565f,
+  0.609550595283508f, -0.487851053476334f, 0.603555679321289f, -0.489158689975739f,
+  0.597545146942139f, -0.490392625331879f, 0.591519951820374f, -0.491552740335464f,
+  0.585480928421021f, -0.492638826370239f, 0.579429090023041f, -0.493650704622269f,
+  0.573365211486816f, -0.494588255882263f, 0.567290365695953f, -0.495451331138611f,
+  0.561205327510834f, -0.496239781379700f, 0.555111110210419f, -0.496953487396240f,
+  0.549008548259735f, -0.497592359781265f, 0.542898654937744f, -0.498156309127808f,
+  0.536782264709473f, -0.498645216226578f, 0.530660390853882f, -0.499059051275253f,
+  0.524533808231354f, -0.499397724866867f, 0.518403589725494f, -0.499661177396774f,
+  0.512270629405975f, -0.499849408864975f, 0.506135761737823f, -0.499962359666824f
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+
+static const float32_t realCoefB[128] = {
+  0.500000000000000f, 0.500000000000000f, 0.524533808231354f, 0.499397724866867f,
+  0.549008548259735f, 0.497592359781265f, 0.573365211486816f, 0.494588255882263f,
+  0.597545146942139f, 0.490392625331879f, 0.621490061283112f, 0.485015630722046f,
+  0.645142316818237f, 0.478470176458359f, 0.668444931507111f, 0.470772027969360f,
+  0.691341698169708f, 0.461939752101898f, 0.713777542114258f, 0.451994657516479f,
+  0.735698342323303f, 0.440960645675659f, 0.757051348686218f, 0.428864300251007f,
+  0.777785122394562f, 0.415734797716141f, 0.797849655151367f, 0.401603758335114f,
+  0.817196667194366f, 0.386505216360092f, 0.835779488086700f, 0.370475560426712f,
+  0.853553414344788f, 0.353553384542465f, 0.870475590229034f, 0.335779488086700f,
+  0.886505246162415f, 0.317196637392044f, 0.901603758335114f, 0.297849655151367f,
+  0.915734827518463f, 0.277785122394562f, 0.928864300251007f, 0.257051378488541f,
+  0.940960645675659f, 0.235698372125626f, 0.951994657516479f, 0.213777542114258f,
+  0.961939752101898f, 0.191341713070869f, 0.970772027969360f, 0.168444931507111f,
+  0.978470146656036f, 0.145142331719399f, 0.985015630722046f, 0.121490091085434f,
+  0.990392625331879f, 0.097545161843300f, 0.994588255882263f, 0.073365233838558f,
+  0.997592389583588f, 0.049008570611477f, 0.999397754669189f, 0.024533838033676f,
+  1.000000000000000f, 0.000000000000023f, 0.999397754669189f, -0.024533838033676f,
+  0.997592389583588f, -0.049008570611477f, 0.994588255882263f, -0.073365233838558f,
+  0.990392625331879f, -0.097545161843300f, 0.985015630722046f, -0.121490091085434f,
+  0.978470146656036f, -0.145142331719399f, 0.970772027969360f, -0.168444931507111f,
+  0.961939752101898f, -0.191341713070869f, 0.951994657516479f, -0.213777542114258f,
+  0.940960645675659f, -0.235698372125626f, 0.928864300251007f, -0.257051378488541f,
+  0.915734827518463f, -0.277785122394562f, 0.901603758335114f, -0.297849655151367f,
+  0.886505246162415f, -0.317196637392044f, 0.870475590229034f, -0.335779488086700f,
+  0.853553414344788f, -0.353553384542465f, 0.835779488086700f, -0.370475560426712f,
+  0.817196667194366f, -0.386505216360092f, 0.797849655151367f, -0.401603758335114f,
+  0.777785122394562f, -0.415734797716141f, 0.757051348686218f, -0.428864300251007f,
+  0.735698342323303f, -0.440960645675659f, 0.713777542114258f, -0.451994657516479f,
+  0.691341698169708f, -0.461939752101898f, 0.668444931507111f, -0.470772027969360f,
+  0.645142316818237f, -0.478470176458359f, 0.621490061283112f, -0.485015630722046f,
+  0.597545146942139f, -0.490392625331879f, 0.573365211486816f, -0.494588255882263f,
+  0.549008548259735f, -0.497592359781265f, 0.524533808231354f, -0.499397724866867f
+};
+
+#endif
+
 
 
 /**    
@@ -8283,7 +9666,7 @@ static const float32_t realCoefB[8192] = {
 *    
 * \par Description:   
 * \par   
-* The parameter <code>fftLenReal</code>	Specifies length of RFFT/RIFFT Process. Supported FFT Lengths are 128, 512, 2048.    
+* The parameter <code>fftLenReal</code>	Specifies length of RFFT/RIFFT Process. Supported FFT Lengths are 128, 512, 2048, 8192, up to twice ARM_MATH_MAX_FFT_LEN.    
 * \par    
 * The parameter <code>ifftFlagR</code> controls whether a forward or inverse transform is computed.    
 * Set(=1) ifftFlagR to calculate RIFFT, otherwise RFFT is calculated.    
@@ -8311,11 +9694,13 @@ arm_status arm_rfft_init_f32(
   /*  Initialize the Complex FFT length */
   S->fftLenBy2 = (uint16_t) fftLenReal / 2u;
 
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   /*  Initialize the Twiddle coefficientA pointer */
   S->pTwiddleAReal = (float32_t *) realCoefA;
 
   /*  Initialize the Twiddle coefficientB pointer */
   S->pTwiddleBReal = (float32_t *) realCoefB;
+#endif
 
   /*  Initialize the Flag for selection of RFFT or RIFFT */
   S->ifftFlagR = (uint8_t) ifftFlagR;
@@ -8327,18 +9712,26 @@ arm_status arm_rfft_init_f32(
   switch (S->fftLenReal)
   {
     /* Init table modifier value */
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
   case 8192u:
-    S->twidCoefRModifier = 1u;
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(8192u);
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
   case 2048u:
-    S->twidCoefRModifier = 4u;
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(2048u);
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
   case 512u:
-    S->twidCoefRModifier = 16u;
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(512u);
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   case 128u:
-    S->twidCoefRModifier = 64u;
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(128u);
     break;
+#endif
   default:
     /*  Reporting argument error if rfftSize is not valid value */
     status = ARM_MATH_ARGUMENT_ERROR;
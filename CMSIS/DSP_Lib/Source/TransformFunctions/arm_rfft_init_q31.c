@@ -34,6 +34,7 @@
 * -------------------------------------------------------------------- */
 
 #include "arm_math.h"
+#include "arm_common_tables.h"
 
 /**    
  * @ingroup groupTransforms    
@@ -48,7 +49,7 @@
 * \par    
 * Generation floating point realCoefAQ31 array:    
 * \par    
-* n = 4096    
+* n = ARM_MATH_MAX_FFT_LEN (4096 by default)    
 * <pre>for (i = 0; i < n; i++)    
 * {    
 *    pATable[2 * i] = 0.5 * (1.0 - sin (2 * PI / (double) (2 * n) * (double) i));    
@@ -60,6 +61,8 @@
 */
 
 
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
+
 static const q31_t realCoefAQ31[8192] = {
   0x40000000, 0xc0000000, 0x3ff36f02, 0xc000013c,
   0x3fe6de05, 0xc00004ef, 0x3fda4d09, 0xc0000b1a,
@@ -2111,12 +2114,701 @@ static const q31_t realCoefAQ31[8192] = {
   0x3fe6de05, 0x3ffffb11, 0x3ff36f02, 0x3ffffec4,
 };
 
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+
+static const q31_t realCoefAQ31[2048] = {
+  0x40000000, 0xc0000000, 0x3fcdbc0f, 0xc00013bd,
+  0x3f9b783c, 0xc0004ef5, 0x3f6934a8, 0xc000b1a7,
+  0x3f36f170, 0xc0013bd3, 0x3f04aeb5, 0xc001ed78,
+  0x3ed26c94, 0xc002c697, 0x3ea02b2e, 0xc003c72f,
+  0x3e6deaa1, 0xc004ef3f, 0x3e3bab0b, 0xc0063ec6,
+  0x3e096c8d, 0xc007b5c4, 0x3dd72f45, 0xc0095438,
+  0x3da4f351, 0xc00b1a20, 0x3d72b8d2, 0xc00d077c,
+  0x3d407fe6, 0xc00f1c4a, 0x3d0e48ab, 0xc011588a,
+  0x3cdc1342, 0xc013bc39, 0x3ca9dfc8, 0xc0164757,
+  0x3c77ae5e, 0xc018f9e1, 0x3c457f21, 0xc01bd3d6,
+  0x3c135231, 0xc01ed535, 0x3be127ac, 0xc021fdfb,
+  0x3baeffb3, 0xc0254e27, 0x3b7cda63, 0xc028c5b6,
+  0x3b4ab7db, 0xc02c64a6, 0x3b18983b, 0xc0302af5,
+  0x3ae67ba2, 0xc03418a2, 0x3ab4622d, 0xc0382da8,
+  0x3a824bfd, 0xc03c6a07, 0x3a503930, 0xc040cdba,
+  0x3a1e29e5, 0xc04558c0, 0x39ec1e3b, 0xc04a0b16,
+  0x39ba1651, 0xc04ee4b8, 0x39881245, 0xc053e5a5,
+  0x39561237, 0xc0590dd8, 0x39241645, 0xc05e5d4e,
+  0x38f21e8e, 0xc063d405, 0x38c02b31, 0xc06971f9,
+  0x388e3c4d, 0xc06f3726, 0x385c5201, 0xc0752389,
+  0x382a6c6a, 0xc07b371e, 0x37f88ba9, 0xc08171e2,
+  0x37c6afdc, 0xc087d3d0, 0x3794d922, 0xc08e5ce5,
+  0x37630799, 0xc0950d1d, 0x37313b60, 0xc09be473,
+  0x36ff7496, 0xc0a2e2e3, 0x36cdb359, 0xc0aa086a,
+  0x369bf7c9, 0xc0b15502, 0x366a4203, 0xc0b8c8a7,
+  0x36389228, 0xc0c06355, 0x3606e854, 0xc0c82506,
+  0x35d544a7, 0xc0d00db6, 0x35a3a740, 0xc0d81d61,
+  0x3572103d, 0xc0e05401, 0x35407fbd, 0xc0e8b190,
+  0x350ef5de, 0xc0f1360b, 0x34dd72be, 0xc0f9e16b,
+  0x34abf67e, 0xc102b3ac, 0x347a8139, 0xc10bacc8,
+  0x34491311, 0xc114ccb9, 0x3417ac22, 0xc11e1379,
+  0x33e64c8c, 0xc1278104, 0x33b4f46c, 0xc1311553,
+  0x3383a3e2, 0xc13ad060, 0x33525b0b, 0xc144b225,
+  0x33211a07, 0xc14eba9d, 0x32efe0f2, 0xc158e9c1,
+  0x32beafed, 0xc1633f8a, 0x328d8715, 0xc16dbbf3,
+  0x325c6688, 0xc1785ef4, 0x322b4e66, 0xc1832888,
+  0x31fa3ecb, 0xc18e18a7, 0x31c937d6, 0xc1992f4c,
+  0x319839a6, 0xc1a46c6e, 0x31674459, 0xc1afd007,
+  0x3136580d, 0xc1bb5a11, 0x310574e0, 0xc1c70a84,
+  0x30d49af1, 0xc1d2e158, 0x30a3ca5d, 0xc1dede87,
+  0x30730342, 0xc1eb0209, 0x304245c0, 0xc1f74bd6,
+  0x301191f3, 0xc203bbe8, 0x2fe0e7f9, 0xc2105236,
+  0x2fb047f2, 0xc21d0eb8, 0x2f7fb1fa, 0xc229f167,
+  0x2f4f2630, 0xc236fa3b, 0x2f1ea4b2, 0xc244292c,
+  0x2eee2d9d, 0xc2517e31, 0x2ebdc110, 0xc25ef943,
+  0x2e8d5f29, 0xc26c9a58, 0x2e5d0804, 0xc27a616a,
+  0x2e2cbbc1, 0xc2884e6e, 0x2dfc7a7c, 0xc296615d,
+  0x2dcc4454, 0xc2a49a2e, 0x2d9c1967, 0xc2b2f8d8,
+  0x2d6bf9d1, 0xc2c17d52, 0x2d3be5b1, 0xc2d02794,
+  0x2d0bdd25, 0xc2def794, 0x2cdbe04a, 0xc2eded49,
+  0x2cabef3d, 0xc2fd08a9, 0x2c7c0a1d, 0xc30c49ad,
+  0x2c4c3106, 0xc31bb049, 0x2c1c6417, 0xc32b3c75,
+  0x2beca36c, 0xc33aee27, 0x2bbcef23, 0xc34ac556,
+  0x2b8d475b, 0xc35ac1f7, 0x2b5dac2f, 0xc36ae401,
+  0x2b2e1dbe, 0xc37b2b6a, 0x2afe9c24, 0xc38b9827,
+  0x2acf277f, 0xc39c2a2f, 0x2a9fbfed, 0xc3ace178,
+  0x2a70658a, 0xc3bdbdf6, 0x2a411874, 0xc3cebfa0,
+  0x2a11d8c8, 0xc3dfe66c, 0x29e2a6a3, 0xc3f1324e,
+  0x29b38223, 0xc402a33c, 0x29846b63, 0xc414392b,
+  0x29556282, 0xc425f410, 0x2926679c, 0xc437d3e1,
+  0x28f77acf, 0xc449d892, 0x28c89c37, 0xc45c0219,
+  0x2899cbf1, 0xc46e5069, 0x286b0a1a, 0xc480c379,
+  0x283c56cf, 0xc4935b3c, 0x280db22d, 0xc4a617a6,
+  0x27df1c50, 0xc4b8f8ad, 0x27b09555, 0xc4cbfe45,
+  0x27821d59, 0xc4df2862, 0x2753b479, 0xc4f276f7,
+  0x27255ad1, 0xc505e9fb, 0x26f7107e, 0xc519815f,
+  0x26c8d59c, 0xc52d3d18, 0x269aaa48, 0xc5411d1b,
+  0x266c8e9f, 0xc555215a, 0x263e82bc, 0xc56949ca,
+  0x261086bc, 0xc57d965d, 0x25e29abc, 0xc5920708,
+  0x25b4bed8, 0xc5a69bbe, 0x2586f32c, 0xc5bb5472,
+  0x255937d5, 0xc5d03118, 0x252b8cee, 0xc5e531a1,
+  0x24fdf294, 0xc5fa5603, 0x24d068e2, 0xc60f9e2e,
+  0x24a2eff6, 0xc6250a18, 0x247587eb, 0xc63a99b1,
+  0x244830dd, 0xc6504ced, 0x241aeae8, 0xc66623be,
+  0x23edb628, 0xc67c1e18, 0x23c092b9, 0xc6923bec,
+  0x239380b6, 0xc6a87d2d, 0x2366803c, 0xc6bee1cd,
+  0x23399167, 0xc6d569be, 0x230cb451, 0xc6ec14f2,
+  0x22dfe917, 0xc702e35c, 0x22b32fd4, 0xc719d4ed,
+  0x228688a4, 0xc730e997, 0x2259f3a3, 0xc748214c,
+  0x222d70eb, 0xc75f7bfe, 0x22010099, 0xc776f99d,
+  0x21d4a2c8, 0xc78e9a1d, 0x21a85793, 0xc7a65d6e,
+  0x217c1f15, 0xc7be4381, 0x214ff96a, 0xc7d64c47,
+  0x2123e6ad, 0xc7ee77b3, 0x20f7e6f9, 0xc806c5b5,
+  0x20cbfa6a, 0xc81f363d, 0x20a0211a, 0xc837c93e,
+  0x20745b24, 0xc8507ea7, 0x2048a8a4, 0xc869566a,
+  0x201d09b4, 0xc8825077, 0x1ff17e70, 0xc89b6cbf,
+  0x1fc606f1, 0xc8b4ab32, 0x1f9aa354, 0xc8ce0bc0,
+  0x1f6f53b3, 0xc8e78e5b, 0x1f441828, 0xc90132f2,
+  0x1f18f0ce, 0xc91af976, 0x1eedddc0, 0xc934e1d6,
+  0x1ec2df18, 0xc94eec03, 0x1e97f4f1, 0xc96917ec,
+  0x1e6d1f65, 0xc9836582, 0x1e425e8f, 0xc99dd4b4,
+  0x1e17b28a, 0xc9b86572, 0x1ded1b6e, 0xc9d317ab,
+  0x1dc29958, 0xc9edeb50, 0x1d982c60, 0xca08e04f,
+  0x1d6dd4a2, 0xca23f698, 0x1d439236, 0xca3f2e19,
+  0x1d196538, 0xca5a86c4, 0x1cef4dc2, 0xca760086,
+  0x1cc54bec, 0xca919b4e, 0x1c9b5fd2, 0xcaad570c,
+  0x1c71898d, 0xcac933ae, 0x1c47c936, 0xcae53123,
+  0x1c1e1ee9, 0xcb014f5b, 0x1bf48abd, 0xcb1d8e43,
+  0x1bcb0cce, 0xcb39edca, 0x1ba1a534, 0xcb566ddf,
+  0x1b785409, 0xcb730e70, 0x1b4f1967, 0xcb8fcf6b,
+  0x1b25f566, 0xcbacb0bf, 0x1afce821, 0xcbc9b25a,
+  0x1ad3f1b1, 0xcbe6d42b, 0x1aab122f, 0xcc04161e,
+  0x1a8249b4, 0xcc217822, 0x1a599859, 0xcc3efa25,
+  0x1a30fe38, 0xcc5c9c14, 0x1a087b69, 0xcc7a5dde,
+  0x19e01006, 0xcc983f70, 0x19b7bc27, 0xccb640b8,
+  0x198f7fe6, 0xccd461a2, 0x19675b5a, 0xccf2a21d,
+  0x193f4e9e, 0xcd110216, 0x191759c9, 0xcd2f817b,
+  0x18ef7cf4, 0xcd4e2037, 0x18c7b838, 0xcd6cde39,
+  0x18a00bae, 0xcd8bbb6d, 0x1878776d, 0xcdaab7c0,
+  0x1850fb8e, 0xcdc9d320, 0x1829982b, 0xcde90d79,
+  0x18024d59, 0xce0866b8, 0x17db1b34, 0xce27dec9,
+  0x17b401d1, 0xce47759a, 0x178d014a, 0xce672b16,
+  0x176619b6, 0xce86ff2a, 0x173f4b2e, 0xcea6f1c2,
+  0x171895c9, 0xcec702cb, 0x16f1f99f, 0xcee73231,
+  0x16cb76c9, 0xcf077fe1, 0x16a50d5d, 0xcf27ebc5,
+  0x167ebd74, 0xcf4875ca, 0x16588725, 0xcf691ddd,
+  0x16326a88, 0xcf89e3e8, 0x160c67b4, 0xcfaac7d8,
+  0x15e67ec1, 0xcfcbc999, 0x15c0afc6, 0xcfece915,
+  0x159afadb, 0xd00e2639, 0x15756016, 0xd02f80f1,
+  0x154fdf8f, 0xd050f926, 0x152a795d, 0xd0728ec6,
+  0x15052d97, 0xd09441bb, 0x14dffc54, 0xd0b611f1,
+  0x14bae5ab, 0xd0d7ff51, 0x1495e9b3, 0xd0fa09c9,
+  0x14710883, 0xd11c3142, 0x144c4232, 0xd13e75a8,
+  0x142796d5, 0xd160d6e5, 0x14030684, 0xd18354e4,
+  0x13de9156, 0xd1a5ef90, 0x13ba3760, 0xd1c8a6d4,
+  0x1395f8ba, 0xd1eb7a9a, 0x1371d579, 0xd20e6acc,
+  0x134dcdb4, 0xd2317756, 0x1329e181, 0xd254a021,
+  0x130610f7, 0xd277e518, 0x12e25c2b, 0xd29b4626,
+  0x12bec333, 0xd2bec333, 0x129b4626, 0xd2e25c2b,
+  0x1277e518, 0xd30610f7, 0x1254a021, 0xd329e181,
+  0x12317756, 0xd34dcdb4, 0x120e6acc, 0xd371d579,
+  0x11eb7a9a, 0xd395f8ba, 0x11c8a6d4, 0xd3ba3760,
+  0x11a5ef90, 0xd3de9156, 0x118354e4, 0xd4030684,
+  0x1160d6e5, 0xd42796d5, 0x113e75a8, 0xd44c4232,
+  0x111c3142, 0xd4710883, 0x10fa09c9, 0xd495e9b3,
+  0x10d7ff51, 0xd4bae5ab, 0x10b611f1, 0xd4dffc54,
+  0x109441bb, 0xd5052d97, 0x10728ec6, 0xd52a795d,
+  0x1050f926, 0xd54fdf8f, 0x102f80f1, 0xd5756016,
+  0x100e2639, 0xd59afadb, 0xfece915, 0xd5c0afc6,
+  0xfcbc999, 0xd5e67ec1, 0xfaac7d8, 0xd60c67b4,
+  0xf89e3e8, 0xd6326a88, 0xf691ddd, 0xd6588725,
+  0xf4875ca, 0xd67ebd74, 0xf27ebc5, 0xd6a50d5d,
+  0xf077fe1, 0xd6cb76c9, 0xee73231, 0xd6f1f99f,
+  0xec702cb, 0xd71895c9, 0xea6f1c2, 0xd73f4b2e,
+  0xe86ff2a, 0xd76619b6, 0xe672b16, 0xd78d014a,
+  0xe47759a, 0xd7b401d1, 0xe27dec9, 0xd7db1b34,
+  0xe0866b8, 0xd8024d59, 0xde90d79, 0xd829982b,
+  0xdc9d320, 0xd850fb8e, 0xdaab7c0, 0xd878776d,
+  0xd8bbb6d, 0xd8a00bae, 0xd6cde39, 0xd8c7b838,
+  0xd4e2037, 0xd8ef7cf4, 0xd2f817b, 0xd91759c9,
+  0xd110216, 0xd93f4e9e, 0xcf2a21d, 0xd9675b5a,
+  0xcd461a2, 0xd98f7fe6, 0xcb640b8, 0xd9b7bc27,
+  0xc983f70, 0xd9e01006, 0xc7a5dde, 0xda087b69,
+  0xc5c9c14, 0xda30fe38, 0xc3efa25, 0xda599859,
+  0xc217822, 0xda8249b4, 0xc04161e, 0xdaab122f,
+  0xbe6d42b, 0xdad3f1b1, 0xbc9b25a, 0xdafce821,
+  0xbacb0bf, 0xdb25f566, 0xb8fcf6b, 0xdb4f1967,
+  0xb730e70, 0xdb785409, 0xb566ddf, 0xdba1a534,
+  0xb39edca, 0xdbcb0cce, 0xb1d8e43, 0xdbf48abd,
+  0xb014f5b, 0xdc1e1ee9, 0xae53123, 0xdc47c936,
+  0xac933ae, 0xdc71898d, 0xaad570c, 0xdc9b5fd2,
+  0xa919b4e, 0xdcc54bec, 0xa760086, 0xdcef4dc2,
+  0xa5a86c4, 0xdd196538, 0xa3f2e19, 0xdd439236,
+  0xa23f698, 0xdd6dd4a2, 0xa08e04f, 0xdd982c60,
+  0x9edeb50, 0xddc29958, 0x9d317ab, 0xdded1b6e,
+  0x9b86572, 0xde17b28a, 0x99dd4b4, 0xde425e8f,
+  0x9836582, 0xde6d1f65, 0x96917ec, 0xde97f4f1,
+  0x94eec03, 0xdec2df18, 0x934e1d6, 0xdeedddc0,
+  0x91af976, 0xdf18f0ce, 0x90132f2, 0xdf441828,
+  0x8e78e5b, 0xdf6f53b3, 0x8ce0bc0, 0xdf9aa354,
+  0x8b4ab32, 0xdfc606f1, 0x89b6cbf, 0xdff17e70,
+  0x8825077, 0xe01d09b4, 0x869566a, 0xe048a8a4,
+  0x8507ea7, 0xe0745b24, 0x837c93e, 0xe0a0211a,
+  0x81f363d, 0xe0cbfa6a, 0x806c5b5, 0xe0f7e6f9,
+  0x7ee77b3, 0xe123e6ad, 0x7d64c47, 0xe14ff96a,
+  0x7be4381, 0xe17c1f15, 0x7a65d6e, 0xe1a85793,
+  0x78e9a1d, 0xe1d4a2c8, 0x776f99d, 0xe2010099,
+  0x75f7bfe, 0xe22d70eb, 0x748214c, 0xe259f3a3,
+  0x730e997, 0xe28688a4, 0x719d4ed, 0xe2b32fd4,
+  0x702e35c, 0xe2dfe917, 0x6ec14f2, 0xe30cb451,
+  0x6d569be, 0xe3399167, 0x6bee1cd, 0xe366803c,
+  0x6a87d2d, 0xe39380b6, 0x6923bec, 0xe3c092b9,
+  0x67c1e18, 0xe3edb628, 0x66623be, 0xe41aeae8,
+  0x6504ced, 0xe44830dd, 0x63a99b1, 0xe47587eb,
+  0x6250a18, 0xe4a2eff6, 0x60f9e2e, 0xe4d068e2,
+  0x5fa5603, 0xe4fdf294, 0x5e531a1, 0xe52b8cee,
+  0x5d03118, 0xe55937d5, 0x5bb5472, 0xe586f32c,
+  0x5a69bbe, 0xe5b4bed8, 0x5920708, 0xe5e29abc,
+  0x57d965d, 0xe61086bc, 0x56949ca, 0xe63e82bc,
+  0x555215a, 0xe66c8e9f, 0x5411d1b, 0xe69aaa48,
+  0x52d3d18, 0xe6c8d59c, 0x519815f, 0xe6f7107e,
+  0x505e9fb, 0xe7255ad1, 0x4f276f7, 0xe753b479,
+  0x4df2862, 0xe7821d59, 0x4cbfe45, 0xe7b09555,
+  0x4b8f8ad, 0xe7df1c50, 0x4a617a6, 0xe80db22d,
+  0x4935b3c, 0xe83c56cf, 0x480c379, 0xe86b0a1a,
+  0x46e5069, 0xe899cbf1, 0x45c0219, 0xe8c89c37,
+  0x449d892, 0xe8f77acf, 0x437d3e1, 0xe926679c,
+  0x425f410, 0xe9556282, 0x414392b, 0xe9846b63,
+  0x402a33c, 0xe9b38223, 0x3f1324e, 0xe9e2a6a3,
+  0x3dfe66c, 0xea11d8c8, 0x3cebfa0, 0xea411874,
+  0x3bdbdf6, 0xea70658a, 0x3ace178, 0xea9fbfed,
+  0x39c2a2f, 0xeacf277f, 0x38b9827, 0xeafe9c24,
+  0x37b2b6a, 0xeb2e1dbe, 0x36ae401, 0xeb5dac2f,
+  0x35ac1f7, 0xeb8d475b, 0x34ac556, 0xebbcef23,
+  0x33aee27, 0xebeca36c, 0x32b3c75, 0xec1c6417,
+  0x31bb049, 0xec4c3106, 0x30c49ad, 0xec7c0a1d,
+  0x2fd08a9, 0xecabef3d, 0x2eded49, 0xecdbe04a,
+  0x2def794, 0xed0bdd25, 0x2d02794, 0xed3be5b1,
+  0x2c17d52, 0xed6bf9d1, 0x2b2f8d8, 0xed9c1967,
+  0x2a49a2e, 0xedcc4454, 0x296615d, 0xedfc7a7c,
+  0x2884e6e, 0xee2cbbc1, 0x27a616a, 0xee5d0804,
+  0x26c9a58, 0xee8d5f29, 0x25ef943, 0xeebdc110,
+  0x2517e31, 0xeeee2d9d, 0x244292c, 0xef1ea4b2,
+  0x236fa3b, 0xef4f2630, 0x229f167, 0xef7fb1fa,
+  0x21d0eb8, 0xefb047f2, 0x2105236, 0xefe0e7f9,
+  0x203bbe8, 0xf01191f3, 0x1f74bd6, 0xf04245c0,
+  0x1eb0209, 0xf0730342, 0x1dede87, 0xf0a3ca5d,
+  0x1d2e158, 0xf0d49af1, 0x1c70a84, 0xf10574e0,
+  0x1bb5a11, 0xf136580d, 0x1afd007, 0xf1674459,
+  0x1a46c6e, 0xf19839a6, 0x1992f4c, 0xf1c937d6,
+  0x18e18a7, 0xf1fa3ecb, 0x1832888, 0xf22b4e66,
+  0x1785ef4, 0xf25c6688, 0x16dbbf3, 0xf28d8715,
+  0x1633f8a, 0xf2beafed, 0x158e9c1, 0xf2efe0f2,
+  0x14eba9d, 0xf3211a07, 0x144b225, 0xf3525b0b,
+  0x13ad060, 0xf383a3e2, 0x1311553, 0xf3b4f46c,
+  0x1278104, 0xf3e64c8c, 0x11e1379, 0xf417ac22,
+  0x114ccb9, 0xf4491311, 0x10bacc8, 0xf47a8139,
+  0x102b3ac, 0xf4abf67e, 0xf9e16b, 0xf4dd72be,
+  0xf1360b, 0xf50ef5de, 0xe8b190, 0xf5407fbd,
+  0xe05401, 0xf572103d, 0xd81d61, 0xf5a3a740,
+  0xd00db6, 0xf5d544a7, 0xc82506, 0xf606e854,
+  0xc06355, 0xf6389228, 0xb8c8a7, 0xf66a4203,
+  0xb15502, 0xf69bf7c9, 0xaa086a, 0xf6cdb359,
+  0xa2e2e3, 0xf6ff7496, 0x9be473, 0xf7313b60,
+  0x950d1d, 0xf7630799, 0x8e5ce5, 0xf794d922,
+  0x87d3d0, 0xf7c6afdc, 0x8171e2, 0xf7f88ba9,
+  0x7b371e, 0xf82a6c6a, 0x752389, 0xf85c5201,
+  0x6f3726, 0xf88e3c4d, 0x6971f9, 0xf8c02b31,
+  0x63d405, 0xf8f21e8e, 0x5e5d4e, 0xf9241645,
+  0x590dd8, 0xf9561237, 0x53e5a5, 0xf9881245,
+  0x4ee4b8, 0xf9ba1651, 0x4a0b16, 0xf9ec1e3b,
+  0x4558c0, 0xfa1e29e5, 0x40cdba, 0xfa503930,
+  0x3c6a07, 0xfa824bfd, 0x382da8, 0xfab4622d,
+  0x3418a2, 0xfae67ba2, 0x302af5, 0xfb18983b,
+  0x2c64a6, 0xfb4ab7db, 0x28c5b6, 0xfb7cda63,
+  0x254e27, 0xfbaeffb3, 0x21fdfb, 0xfbe127ac,
+  0x1ed535, 0xfc135231, 0x1bd3d6, 0xfc457f21,
+  0x18f9e1, 0xfc77ae5e, 0x164757, 0xfca9dfc8,
+  0x13bc39, 0xfcdc1342, 0x11588a, 0xfd0e48ab,
+  0xf1c4a, 0xfd407fe6, 0xd077c, 0xfd72b8d2,
+  0xb1a20, 0xfda4f351, 0x95438, 0xfdd72f45,
+  0x7b5c4, 0xfe096c8d, 0x63ec6, 0xfe3bab0b,
+  0x4ef3f, 0xfe6deaa1, 0x3c72f, 0xfea02b2e,
+  0x2c697, 0xfed26c94, 0x1ed78, 0xff04aeb5,
+  0x13bd3, 0xff36f170, 0xb1a7, 0xff6934a8,
+  0x4ef5, 0xff9b783c, 0x13bd, 0xffcdbc0f,
+  0x0, 0x0, 0x13bd, 0x3243f1,
+  0x4ef5, 0x6487c4, 0xb1a7, 0x96cb58,
+  0x13bd3, 0xc90e90, 0x1ed78, 0xfb514b,
+  0x2c697, 0x12d936c, 0x3c72f, 0x15fd4d2,
+  0x4ef3f, 0x192155f, 0x63ec6, 0x1c454f5,
+  0x7b5c4, 0x1f69373, 0x95438, 0x228d0bb,
+  0xb1a20, 0x25b0caf, 0xd077c, 0x28d472e,
+  0xf1c4a, 0x2bf801a, 0x11588a, 0x2f1b755,
+  0x13bc39, 0x323ecbe, 0x164757, 0x3562038,
+  0x18f9e1, 0x38851a2, 0x1bd3d6, 0x3ba80df,
+  0x1ed535, 0x3ecadcf, 0x21fdfb, 0x41ed854,
+  0x254e27, 0x451004d, 0x28c5b6, 0x483259d,
+  0x2c64a6, 0x4b54825, 0x302af5, 0x4e767c5,
+  0x3418a2, 0x519845e, 0x382da8, 0x54b9dd3,
+  0x3c6a07, 0x57db403, 0x40cdba, 0x5afc6d0,
+  0x4558c0, 0x5e1d61b, 0x4a0b16, 0x613e1c5,
+  0x4ee4b8, 0x645e9af, 0x53e5a5, 0x677edbb,
+  0x590dd8, 0x6a9edc9, 0x5e5d4e, 0x6dbe9bb,
+  0x63d405, 0x70de172, 0x6971f9, 0x73fd4cf,
+  0x6f3726, 0x771c3b3, 0x752389, 0x7a3adff,
+  0x7b371e, 0x7d59396, 0x8171e2, 0x8077457,
+  0x87d3d0, 0x8395024, 0x8e5ce5, 0x86b26de,
+  0x950d1d, 0x89cf867, 0x9be473, 0x8cec4a0,
+  0xa2e2e3, 0x9008b6a, 0xaa086a, 0x9324ca7,
+  0xb15502, 0x9640837, 0xb8c8a7, 0x995bdfd,
+  0xc06355, 0x9c76dd8, 0xc82506, 0x9f917ac,
+  0xd00db6, 0xa2abb59, 0xd81d61, 0xa5c58c0,
+  0xe05401, 0xa8defc3, 0xe8b190, 0xabf8043,
+  0xf1360b, 0xaf10a22, 0xf9e16b, 0xb228d42,
+  0x102b3ac, 0xb540982, 0x10bacc8, 0xb857ec7,
+  0x114ccb9, 0xbb6ecef, 0x11e1379, 0xbe853de,
+  0x1278104, 0xc19b374, 0x1311553, 0xc4b0b94,
+  0x13ad060, 0xc7c5c1e, 0x144b225, 0xcada4f5,
+  0x14eba9d, 0xcdee5f9, 0x158e9c1, 0xd101f0e,
+  0x1633f8a, 0xd415013, 0x16dbbf3, 0xd7278eb,
+  0x1785ef4, 0xda39978, 0x1832888, 0xdd4b19a,
+  0x18e18a7, 0xe05c135, 0x1992f4c, 0xe36c82a,
+  0x1a46c6e, 0xe67c65a, 0x1afd007, 0xe98bba7,
+  0x1bb5a11, 0xec9a7f3, 0x1c70a84, 0xefa8b20,
+  0x1d2e158, 0xf2b650f, 0x1dede87, 0xf5c35a3,
+  0x1eb0209, 0xf8cfcbe, 0x1f74bd6, 0xfbdba40,
+  0x203bbe8, 0xfee6e0d, 0x2105236, 0x101f1807,
+  0x21d0eb8, 0x104fb80e, 0x229f167, 0x10804e06,
+  0x236fa3b, 0x10b0d9d0, 0x244292c, 0x10e15b4e,
+  0x2517e31, 0x1111d263, 0x25ef943, 0x11423ef0,
+  0x26c9a58, 0x1172a0d7, 0x27a616a, 0x11a2f7fc,
+  0x2884e6e, 0x11d3443f, 0x296615d, 0x12038584,
+  0x2a49a2e, 0x1233bbac, 0x2b2f8d8, 0x1263e699,
+  0x2c17d52, 0x1294062f, 0x2d02794, 0x12c41a4f,
+  0x2def794, 0x12f422db, 0x2eded49, 0x13241fb6,
+  0x2fd08a9, 0x135410c3, 0x30c49ad, 0x1383f5e3,
+  0x31bb049, 0x13b3cefa, 0x32b3c75, 0x13e39be9,
+  0x33aee27, 0x14135c94, 0x34ac556, 0x144310dd,
+  0x35ac1f7, 0x1472b8a5, 0x36ae401, 0x14a253d1,
+  0x37b2b6a, 0x14d1e242, 0x38b9827, 0x150163dc,
+  0x39c2a2f, 0x1530d881, 0x3ace178, 0x15604013,
+  0x3bdbdf6, 0x158f9a76, 0x3cebfa0, 0x15bee78c,
+  0x3dfe66c, 0x15ee2738, 0x3f1324e, 0x161d595d,
+  0x402a33c, 0x164c7ddd, 0x414392b, 0x167b949d,
+  0x425f410, 0x16aa9d7e, 0x437d3e1, 0x16d99864,
+  0x449d892, 0x17088531, 0x45c0219, 0x173763c9,
+  0x46e5069, 0x1766340f, 0x480c379, 0x1794f5e6,
+  0x4935b3c, 0x17c3a931, 0x4a617a6, 0x17f24dd3,
+  0x4b8f8ad, 0x1820e3b0, 0x4cbfe45, 0x184f6aab,
+  0x4df2862, 0x187de2a7, 0x4f276f7, 0x18ac4b87,
+  0x505e9fb, 0x18daa52f, 0x519815f, 0x1908ef82,
+  0x52d3d18, 0x19372a64, 0x5411d1b, 0x196555b8,
+  0x555215a, 0x19937161, 0x56949ca, 0x19c17d44,
+  0x57d965d, 0x19ef7944, 0x5920708, 0x1a1d6544,
+  0x5a69bbe, 0x1a4b4128, 0x5bb5472, 0x1a790cd4,
+  0x5d03118, 0x1aa6c82b, 0x5e531a1, 0x1ad47312,
+  0x5fa5603, 0x1b020d6c, 0x60f9e2e, 0x1b2f971e,
+  0x6250a18, 0x1b5d100a, 0x63a99b1, 0x1b8a7815,
+  0x6504ced, 0x1bb7cf23, 0x66623be, 0x1be51518,
+  0x67c1e18, 0x1c1249d8, 0x6923bec, 0x1c3f6d47,
+  0x6a87d2d, 0x1c6c7f4a, 0x6bee1cd, 0x1c997fc4,
+  0x6d569be, 0x1cc66e99, 0x6ec14f2, 0x1cf34baf,
+  0x702e35c, 0x1d2016e9, 0x719d4ed, 0x1d4cd02c,
+  0x730e997, 0x1d79775c, 0x748214c, 0x1da60c5d,
+  0x75f7bfe, 0x1dd28f15, 0x776f99d, 0x1dfeff67,
+  0x78e9a1d, 0x1e2b5d38, 0x7a65d6e, 0x1e57a86d,
+  0x7be4381, 0x1e83e0eb, 0x7d64c47, 0x1eb00696,
+  0x7ee77b3, 0x1edc1953, 0x806c5b5, 0x1f081907,
+  0x81f363d, 0x1f340596, 0x837c93e, 0x1f5fdee6,
+  0x8507ea7, 0x1f8ba4dc, 0x869566a, 0x1fb7575c,
+  0x8825077, 0x1fe2f64c, 0x89b6cbf, 0x200e8190,
+  0x8b4ab32, 0x2039f90f, 0x8ce0bc0, 0x20655cac,
+  0x8e78e5b, 0x2090ac4d, 0x90132f2, 0x20bbe7d8,
+  0x91af976, 0x20e70f32, 0x934e1d6, 0x21122240,
+  0x94eec03, 0x213d20e8, 0x96917ec, 0x21680b0f,
+  0x9836582, 0x2192e09b, 0x99dd4b4, 0x21bda171,
+  0x9b86572, 0x21e84d76, 0x9d317ab, 0x2212e492,
+  0x9edeb50, 0x223d66a8, 0xa08e04f, 0x2267d3a0,
+  0xa23f698, 0x22922b5e, 0xa3f2e19, 0x22bc6dca,
+  0xa5a86c4, 0x22e69ac8, 0xa760086, 0x2310b23e,
+  0xa919b4e, 0x233ab414, 0xaad570c, 0x2364a02e,
+  0xac933ae, 0x238e7673, 0xae53123, 0x23b836ca,
+  0xb014f5b, 0x23e1e117, 0xb1d8e43, 0x240b7543,
+  0xb39edca, 0x2434f332, 0xb566ddf, 0x245e5acc,
+  0xb730e70, 0x2487abf7, 0xb8fcf6b, 0x24b0e699,
+  0xbacb0bf, 0x24da0a9a, 0xbc9b25a, 0x250317df,
+  0xbe6d42b, 0x252c0e4f, 0xc04161e, 0x2554edd1,
+  0xc217822, 0x257db64c, 0xc3efa25, 0x25a667a7,
+  0xc5c9c14, 0x25cf01c8, 0xc7a5dde, 0x25f78497,
+  0xc983f70, 0x261feffa, 0xcb640b8, 0x264843d9,
+  0xcd461a2, 0x2670801a, 0xcf2a21d, 0x2698a4a6,
+  0xd110216, 0x26c0b162, 0xd2f817b, 0x26e8a637,
+  0xd4e2037, 0x2710830c, 0xd6cde39, 0x273847c8,
+  0xd8bbb6d, 0x275ff452, 0xdaab7c0, 0x27878893,
+  0xdc9d320, 0x27af0472, 0xde90d79, 0x27d667d5,
+  0xe0866b8, 0x27fdb2a7, 0xe27dec9, 0x2824e4cc,
+  0xe47759a, 0x284bfe2f, 0xe672b16, 0x2872feb6,
+  0xe86ff2a, 0x2899e64a, 0xea6f1c2, 0x28c0b4d2,
+  0xec702cb, 0x28e76a37, 0xee73231, 0x290e0661,
+  0xf077fe1, 0x29348937, 0xf27ebc5, 0x295af2a3,
+  0xf4875ca, 0x2981428c, 0xf691ddd, 0x29a778db,
+  0xf89e3e8, 0x29cd9578, 0xfaac7d8, 0x29f3984c,
+  0xfcbc999, 0x2a19813f, 0xfece915, 0x2a3f503a,
+  0x100e2639, 0x2a650525, 0x102f80f1, 0x2a8a9fea,
+  0x1050f926, 0x2ab02071, 0x10728ec6, 0x2ad586a3,
+  0x109441bb, 0x2afad269, 0x10b611f1, 0x2b2003ac,
+  0x10d7ff51, 0x2b451a55, 0x10fa09c9, 0x2b6a164d,
+  0x111c3142, 0x2b8ef77d, 0x113e75a8, 0x2bb3bdce,
+  0x1160d6e5, 0x2bd8692b, 0x118354e4, 0x2bfcf97c,
+  0x11a5ef90, 0x2c216eaa, 0x11c8a6d4, 0x2c45c8a0,
+  0x11eb7a9a, 0x2c6a0746, 0x120e6acc, 0x2c8e2a87,
+  0x12317756, 0x2cb2324c, 0x1254a021, 0x2cd61e7f,
+  0x1277e518, 0x2cf9ef09, 0x129b4626, 0x2d1da3d5,
+  0x12bec333, 0x2d413ccd, 0x12e25c2b, 0x2d64b9da,
+  0x130610f7, 0x2d881ae8, 0x1329e181, 0x2dab5fdf,
+  0x134dcdb4, 0x2dce88aa, 0x1371d579, 0x2df19534,
+  0x1395f8ba, 0x2e148566, 0x13ba3760, 0x2e37592c,
+  0x13de9156, 0x2e5a1070, 0x14030684, 0x2e7cab1c,
+  0x142796d5, 0x2e9f291b, 0x144c4232, 0x2ec18a58,
+  0x14710883, 0x2ee3cebe, 0x1495e9b3, 0x2f05f637,
+  0x14bae5ab, 0x2f2800af, 0x14dffc54, 0x2f49ee0f,
+  0x15052d97, 0x2f6bbe45, 0x152a795d, 0x2f8d713a,
+  0x154fdf8f, 0x2faf06da, 0x15756016, 0x2fd07f0f,
+  0x159afadb, 0x2ff1d9c7, 0x15c0afc6, 0x301316eb,
+  0x15e67ec1, 0x30343667, 0x160c67b4, 0x30553828,
+  0x16326a88, 0x30761c18, 0x16588725, 0x3096e223,
+  0x167ebd74, 0x30b78a36, 0x16a50d5d, 0x30d8143b,
+  0x16cb76c9, 0x30f8801f, 0x16f1f99f, 0x3118cdcf,
+  0x171895c9, 0x3138fd35, 0x173f4b2e, 0x31590e3e,
+  0x176619b6, 0x317900d6, 0x178d014a, 0x3198d4ea,
+  0x17b401d1, 0x31b88a66, 0x17db1b34, 0x31d82137,
+  0x18024d59, 0x31f79948, 0x1829982b, 0x3216f287,
+  0x1850fb8e, 0x32362ce0, 0x1878776d, 0x32554840,
+  0x18a00bae, 0x32744493, 0x18c7b838, 0x329321c7,
+  0x18ef7cf4, 0x32b1dfc9, 0x191759c9, 0x32d07e85,
+  0x193f4e9e, 0x32eefdea, 0x19675b5a, 0x330d5de3,
+  0x198f7fe6, 0x332b9e5e, 0x19b7bc27, 0x3349bf48,
+  0x19e01006, 0x3367c090, 0x1a087b69, 0x3385a222,
+  0x1a30fe38, 0x33a363ec, 0x1a599859, 0x33c105db,
+  0x1a8249b4, 0x33de87de, 0x1aab122f, 0x33fbe9e2,
+  0x1ad3f1b1, 0x34192bd5, 0x1afce821, 0x34364da6,
+  0x1b25f566, 0x34534f41, 0x1b4f1967, 0x34703095,
+  0x1b785409, 0x348cf190, 0x1ba1a534, 0x34a99221,
+  0x1bcb0cce, 0x34c61236, 0x1bf48abd, 0x34e271bd,
+  0x1c1e1ee9, 0x34feb0a5, 0x1c47c936, 0x351acedd,
+  0x1c71898d, 0x3536cc52, 0x1c9b5fd2, 0x3552a8f4,
+  0x1cc54bec, 0x356e64b2, 0x1cef4dc2, 0x3589ff7a,
+  0x1d196538, 0x35a5793c, 0x1d439236, 0x35c0d1e7,
+  0x1d6dd4a2, 0x35dc0968, 0x1d982c60, 0x35f71fb1,
+  0x1dc29958, 0x361214b0, 0x1ded1b6e, 0x362ce855,
+  0x1e17b28a, 0x36479a8e, 0x1e425e8f, 0x36622b4c,
+  0x1e6d1f65, 0x367c9a7e, 0x1e97f4f1, 0x3696e814,
+  0x1ec2df18, 0x36b113fd, 0x1eedddc0, 0x36cb1e2a,
+  0x1f18f0ce, 0x36e5068a, 0x1f441828, 0x36fecd0e,
+  0x1f6f53b3, 0x371871a5, 0x1f9aa354, 0x3731f440,
+  0x1fc606f1, 0x374b54ce, 0x1ff17e70, 0x37649341,
+  0x201d09b4, 0x377daf89, 0x2048a8a4, 0x3796a996,
+  0x20745b24, 0x37af8159, 0x20a0211a, 0x37c836c2,
+  0x20cbfa6a, 0x37e0c9c3, 0x20f7e6f9, 0x37f93a4b,
+  0x2123e6ad, 0x3811884d, 0x214ff96a, 0x3829b3b9,
+  0x217c1f15, 0x3841bc7f, 0x21a85793, 0x3859a292,
+  0x21d4a2c8, 0x387165e3, 0x22010099, 0x38890663,
+  0x222d70eb, 0x38a08402, 0x2259f3a3, 0x38b7deb4,
+  0x228688a4, 0x38cf1669, 0x22b32fd4, 0x38e62b13,
+  0x22dfe917, 0x38fd1ca4, 0x230cb451, 0x3913eb0e,
+  0x23399167, 0x392a9642, 0x2366803c, 0x39411e33,
+  0x239380b6, 0x395782d3, 0x23c092b9, 0x396dc414,
+  0x23edb628, 0x3983e1e8, 0x241aeae8, 0x3999dc42,
+  0x244830dd, 0x39afb313, 0x247587eb, 0x39c5664f,
+  0x24a2eff6, 0x39daf5e8, 0x24d068e2, 0x39f061d2,
+  0x24fdf294, 0x3a05a9fd, 0x252b8cee, 0x3a1ace5f,
+  0x255937d5, 0x3a2fcee8, 0x2586f32c, 0x3a44ab8e,
+  0x25b4bed8, 0x3a596442, 0x25e29abc, 0x3a6df8f8,
+  0x261086bc, 0x3a8269a3, 0x263e82bc, 0x3a96b636,
+  0x266c8e9f, 0x3aaadea6, 0x269aaa48, 0x3abee2e5,
+  0x26c8d59c, 0x3ad2c2e8, 0x26f7107e, 0x3ae67ea1,
+  0x27255ad1, 0x3afa1605, 0x2753b479, 0x3b0d8909,
+  0x27821d59, 0x3b20d79e, 0x27b09555, 0x3b3401bb,
+  0x27df1c50, 0x3b470753, 0x280db22d, 0x3b59e85a,
+  0x283c56cf, 0x3b6ca4c4, 0x286b0a1a, 0x3b7f3c87,
+  0x2899cbf1, 0x3b91af97, 0x28c89c37, 0x3ba3fde7,
+  0x28f77acf, 0x3bb6276e, 0x2926679c, 0x3bc82c1f,
+  0x29556282, 0x3bda0bf0, 0x29846b63, 0x3bebc6d5,
+  0x29b38223, 0x3bfd5cc4, 0x29e2a6a3, 0x3c0ecdb2,
+  0x2a11d8c8, 0x3c201994, 0x2a411874, 0x3c314060,
+  0x2a70658a, 0x3c42420a, 0x2a9fbfed, 0x3c531e88,
+  0x2acf277f, 0x3c63d5d1, 0x2afe9c24, 0x3c7467d9,
+  0x2b2e1dbe, 0x3c84d496, 0x2b5dac2f, 0x3c951bff,
+  0x2b8d475b, 0x3ca53e09, 0x2bbcef23, 0x3cb53aaa,
+  0x2beca36c, 0x3cc511d9, 0x2c1c6417, 0x3cd4c38b,
+  0x2c4c3106, 0x3ce44fb7, 0x2c7c0a1d, 0x3cf3b653,
+  0x2cabef3d, 0x3d02f757, 0x2cdbe04a, 0x3d1212b7,
+  0x2d0bdd25, 0x3d21086c, 0x2d3be5b1, 0x3d2fd86c,
+  0x2d6bf9d1, 0x3d3e82ae, 0x2d9c1967, 0x3d4d0728,
+  0x2dcc4454, 0x3d5b65d2, 0x2dfc7a7c, 0x3d699ea3,
+  0x2e2cbbc1, 0x3d77b192, 0x2e5d0804, 0x3d859e96,
+  0x2e8d5f29, 0x3d9365a8, 0x2ebdc110, 0x3da106bd,
+  0x2eee2d9d, 0x3dae81cf, 0x2f1ea4b2, 0x3dbbd6d4,
+  0x2f4f2630, 0x3dc905c5, 0x2f7fb1fa, 0x3dd60e99,
+  0x2fb047f2, 0x3de2f148, 0x2fe0e7f9, 0x3defadca,
+  0x301191f3, 0x3dfc4418, 0x304245c0, 0x3e08b42a,
+  0x30730342, 0x3e14fdf7, 0x30a3ca5d, 0x3e212179,
+  0x30d49af1, 0x3e2d1ea8, 0x310574e0, 0x3e38f57c,
+  0x3136580d, 0x3e44a5ef, 0x31674459, 0x3e502ff9,
+  0x319839a6, 0x3e5b9392, 0x31c937d6, 0x3e66d0b4,
+  0x31fa3ecb, 0x3e71e759, 0x322b4e66, 0x3e7cd778,
+  0x325c6688, 0x3e87a10c, 0x328d8715, 0x3e92440d,
+  0x32beafed, 0x3e9cc076, 0x32efe0f2, 0x3ea7163f,
+  0x33211a07, 0x3eb14563, 0x33525b0b, 0x3ebb4ddb,
+  0x3383a3e2, 0x3ec52fa0, 0x33b4f46c, 0x3eceeaad,
+  0x33e64c8c, 0x3ed87efc, 0x3417ac22, 0x3ee1ec87,
+  0x34491311, 0x3eeb3347, 0x347a8139, 0x3ef45338,
+  0x34abf67e, 0x3efd4c54, 0x34dd72be, 0x3f061e95,
+  0x350ef5de, 0x3f0ec9f5, 0x35407fbd, 0x3f174e70,
+  0x3572103d, 0x3f1fabff, 0x35a3a740, 0x3f27e29f,
+  0x35d544a7, 0x3f2ff24a, 0x3606e854, 0x3f37dafa,
+  0x36389228, 0x3f3f9cab, 0x366a4203, 0x3f473759,
+  0x369bf7c9, 0x3f4eaafe, 0x36cdb359, 0x3f55f796,
+  0x36ff7496, 0x3f5d1d1d, 0x37313b60, 0x3f641b8d,
+  0x37630799, 0x3f6af2e3, 0x3794d922, 0x3f71a31b,
+  0x37c6afdc, 0x3f782c30, 0x37f88ba9, 0x3f7e8e1e,
+  0x382a6c6a, 0x3f84c8e2, 0x385c5201, 0x3f8adc77,
+  0x388e3c4d, 0x3f90c8da, 0x38c02b31, 0x3f968e07,
+  0x38f21e8e, 0x3f9c2bfb, 0x39241645, 0x3fa1a2b2,
+  0x39561237, 0x3fa6f228, 0x39881245, 0x3fac1a5b,
+  0x39ba1651, 0x3fb11b48, 0x39ec1e3b, 0x3fb5f4ea,
+  0x3a1e29e5, 0x3fbaa740, 0x3a503930, 0x3fbf3246,
+  0x3a824bfd, 0x3fc395f9, 0x3ab4622d, 0x3fc7d258,
+  0x3ae67ba2, 0x3fcbe75e, 0x3b18983b, 0x3fcfd50b,
+  0x3b4ab7db, 0x3fd39b5a, 0x3b7cda63, 0x3fd73a4a,
+  0x3baeffb3, 0x3fdab1d9, 0x3be127ac, 0x3fde0205,
+  0x3c135231, 0x3fe12acb, 0x3c457f21, 0x3fe42c2a,
+  0x3c77ae5e, 0x3fe7061f, 0x3ca9dfc8, 0x3fe9b8a9,
+  0x3cdc1342, 0x3fec43c7, 0x3d0e48ab, 0x3feea776,
+  0x3d407fe6, 0x3ff0e3b6, 0x3d72b8d2, 0x3ff2f884,
+  0x3da4f351, 0x3ff4e5e0, 0x3dd72f45, 0x3ff6abc8,
+  0x3e096c8d, 0x3ff84a3c, 0x3e3bab0b, 0x3ff9c13a,
+  0x3e6deaa1, 0x3ffb10c1, 0x3ea02b2e, 0x3ffc38d1,
+  0x3ed26c94, 0x3ffd3969, 0x3f04aeb5, 0x3ffe1288,
+  0x3f36f170, 0x3ffec42d, 0x3f6934a8, 0x3fff4e59,
+  0x3f9b783c, 0x3fffb10b, 0x3fcdbc0f, 0x3fffec43
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+
+static const q31_t realCoefAQ31[512] = {
+  0x40000000, 0xc0000000, 0x3f36f170, 0xc0013bd3,
+  0x3e6deaa1, 0xc004ef3f, 0x3da4f351, 0xc00b1a20,
+  0x3cdc1342, 0xc013bc39, 0x3c135231, 0xc01ed535,
+  0x3b4ab7db, 0xc02c64a6, 0x3a824bfd, 0xc03c6a07,
+  0x39ba1651, 0xc04ee4b8, 0x38f21e8e, 0xc063d405,
+  0x382a6c6a, 0xc07b371e, 0x37630799, 0xc0950d1d,
+  0x369bf7c9, 0xc0b15502, 0x35d544a7, 0xc0d00db6,
+  0x350ef5de, 0xc0f1360b, 0x34491311, 0xc114ccb9,
+  0x3383a3e2, 0xc13ad060, 0x32beafed, 0xc1633f8a,
+  0x31fa3ecb, 0xc18e18a7, 0x3136580d, 0xc1bb5a11,
+  0x30730342, 0xc1eb0209, 0x2fb047f2, 0xc21d0eb8,
+  0x2eee2d9d, 0xc2517e31, 0x2e2cbbc1, 0xc2884e6e,
+  0x2d6bf9d1, 0xc2c17d52, 0x2cabef3d, 0xc2fd08a9,
+  0x2beca36c, 0xc33aee27, 0x2b2e1dbe, 0xc37b2b6a,
+  0x2a70658a, 0xc3bdbdf6, 0x29b38223, 0xc402a33c,
+  0x28f77acf, 0xc449d892, 0x283c56cf, 0xc4935b3c,
+  0x27821d59, 0xc4df2862, 0x26c8d59c, 0xc52d3d18,
+  0x261086bc, 0xc57d965d, 0x255937d5, 0xc5d03118,
+  0x24a2eff6, 0xc6250a18, 0x23edb628, 0xc67c1e18,
+  0x23399167, 0xc6d569be, 0x228688a4, 0xc730e997,
+  0x21d4a2c8, 0xc78e9a1d, 0x2123e6ad, 0xc7ee77b3,
+  0x20745b24, 0xc8507ea7, 0x1fc606f1, 0xc8b4ab32,
+  0x1f18f0ce, 0xc91af976, 0x1e6d1f65, 0xc9836582,
+  0x1dc29958, 0xc9edeb50, 0x1d196538, 0xca5a86c4,
+  0x1c71898d, 0xcac933ae, 0x1bcb0cce, 0xcb39edca,
+  0x1b25f566, 0xcbacb0bf, 0x1a8249b4, 0xcc217822,
+  0x19e01006, 0xcc983f70, 0x193f4e9e, 0xcd110216,
+  0x18a00bae, 0xcd8bbb6d, 0x18024d59, 0xce0866b8,
+  0x176619b6, 0xce86ff2a, 0x16cb76c9, 0xcf077fe1,
+  0x16326a88, 0xcf89e3e8, 0x159afadb, 0xd00e2639,
+  0x15052d97, 0xd09441bb, 0x14710883, 0xd11c3142,
+  0x13de9156, 0xd1a5ef90, 0x134dcdb4, 0xd2317756,
+  0x12bec333, 0xd2bec333, 0x12317756, 0xd34dcdb4,
+  0x11a5ef90, 0xd3de9156, 0x111c3142, 0xd4710883,
+  0x109441bb, 0xd5052d97, 0x100e2639, 0xd59afadb,
+  0xf89e3e8, 0xd6326a88, 0xf077fe1, 0xd6cb76c9,
+  0xe86ff2a, 0xd76619b6, 0xe0866b8, 0xd8024d59,
+  0xd8bbb6d, 0xd8a00bae, 0xd110216, 0xd93f4e9e,
+  0xc983f70, 0xd9e01006, 0xc217822, 0xda8249b4,
+  0xbacb0bf, 0xdb25f566, 0xb39edca, 0xdbcb0cce,
+  0xac933ae, 0xdc71898d, 0xa5a86c4, 0xdd196538,
+  0x9edeb50, 0xddc29958, 0x9836582, 0xde6d1f65,
+  0x91af976, 0xdf18f0ce, 0x8b4ab32, 0xdfc606f1,
+  0x8507ea7, 0xe0745b24, 0x7ee77b3, 0xe123e6ad,
+  0x78e9a1d, 0xe1d4a2c8, 0x730e997, 0xe28688a4,
+  0x6d569be, 0xe3399167, 0x67c1e18, 0xe3edb628,
+  0x6250a18, 0xe4a2eff6, 0x5d03118, 0xe55937d5,
+  0x57d965d, 0xe61086bc, 0x52d3d18, 0xe6c8d59c,
+  0x4df2862, 0xe7821d59, 0x4935b3c, 0xe83c56cf,
+  0x449d892, 0xe8f77acf, 0x402a33c, 0xe9b38223,
+  0x3bdbdf6, 0xea70658a, 0x37b2b6a, 0xeb2e1dbe,
+  0x33aee27, 0xebeca36c, 0x2fd08a9, 0xecabef3d,
+  0x2c17d52, 0xed6bf9d1, 0x2884e6e, 0xee2cbbc1,
+  0x2517e31, 0xeeee2d9d, 0x21d0eb8, 0xefb047f2,
+  0x1eb0209, 0xf0730342, 0x1bb5a11, 0xf136580d,
+  0x18e18a7, 0xf1fa3ecb, 0x1633f8a, 0xf2beafed,
+  0x13ad060, 0xf383a3e2, 0x114ccb9, 0xf4491311,
+  0xf1360b, 0xf50ef5de, 0xd00db6, 0xf5d544a7,
+  0xb15502, 0xf69bf7c9, 0x950d1d, 0xf7630799,
+  0x7b371e, 0xf82a6c6a, 0x63d405, 0xf8f21e8e,
+  0x4ee4b8, 0xf9ba1651, 0x3c6a07, 0xfa824bfd,
+  0x2c64a6, 0xfb4ab7db, 0x1ed535, 0xfc135231,
+  0x13bc39, 0xfcdc1342, 0xb1a20, 0xfda4f351,
+  0x4ef3f, 0xfe6deaa1, 0x13bd3, 0xff36f170,
+  0x0, 0x0, 0x13bd3, 0xc90e90,
+  0x4ef3f, 0x192155f, 0xb1a20, 0x25b0caf,
+  0x13bc39, 0x323ecbe, 0x1ed535, 0x3ecadcf,
+  0x2c64a6, 0x4b54825, 0x3c6a07, 0x57db403,
+  0x4ee4b8, 0x645e9af, 0x63d405, 0x70de172,
+  0x7b371e, 0x7d59396, 0x950d1d, 0x89cf867,
+  0xb15502, 0x9640837, 0xd00db6, 0xa2abb59,
+  0xf1360b, 0xaf10a22, 0x114ccb9, 0xbb6ecef,
+  0x13ad060, 0xc7c5c1e, 0x1633f8a, 0xd415013,
+  0x18e18a7, 0xe05c135, 0x1bb5a11, 0xec9a7f3,
+  0x1eb0209, 0xf8cfcbe, 0x21d0eb8, 0x104fb80e,
+  0x2517e31, 0x1111d263, 0x2884e6e, 0x11d3443f,
+  0x2c17d52, 0x1294062f, 0x2fd08a9, 0x135410c3,
+  0x33aee27, 0x14135c94, 0x37b2b6a, 0x14d1e242,
+  0x3bdbdf6, 0x158f9a76, 0x402a33c, 0x164c7ddd,
+  0x449d892, 0x17088531, 0x4935b3c, 0x17c3a931,
+  0x4df2862, 0x187de2a7, 0x52d3d18, 0x19372a64,
+  0x57d965d, 0x19ef7944, 0x5d03118, 0x1aa6c82b,
+  0x6250a18, 0x1b5d100a, 0x67c1e18, 0x1c1249d8,
+  0x6d569be, 0x1cc66e99, 0x730e997, 0x1d79775c,
+  0x78e9a1d, 0x1e2b5d38, 0x7ee77b3, 0x1edc1953,
+  0x8507ea7, 0x1f8ba4dc, 0x8b4ab32, 0x2039f90f,
+  0x91af976, 0x20e70f32, 0x9836582, 0x2192e09b,
+  0x9edeb50, 0x223d66a8, 0xa5a86c4, 0x22e69ac8,
+  0xac933ae, 0x238e7673, 0xb39edca, 0x2434f332,
+  0xbacb0bf, 0x24da0a9a, 0xc217822, 0x257db64c,
+  0xc983f70, 0x261feffa, 0xd110216, 0x26c0b162,
+  0xd8bbb6d, 0x275ff452, 0xe0866b8, 0x27fdb2a7,
+  0xe86ff2a, 0x2899e64a, 0xf077fe1, 0x29348937,
+  0xf89e3e8, 0x29cd9578, 0x100e2639, 0x2a650525,
+  0x109441bb, 0x2afad269, 0x111c3142, 0x2b8ef77d,
+  0x11a5ef90, 0x2c216eaa, 0x12317756, 0x2cb2324c,
+  0x12bec333, 0x2d413ccd, 0x134dcdb4, 0x2dce88aa,
+  0x13de9156, 0x2e5a1070, 0x14710883, 0x2ee3cebe,
+  0x15052d97, 0x2f6bbe45, 0x159afadb, 0x2ff1d9c7,
+  0x16326a88, 0x30761c18, 0x16cb76c9, 0x30f8801f,
+  0x176619b6, 0x317900d6, 0x18024d59, 0x31f79948,
+  0x18a00bae, 0x32744493, 0x193f4e9e, 0x32eefdea,
+  0x19e01006, 0x3367c090, 0x1a8249b4, 0x33de87de,
+  0x1b25f566, 0x34534f41, 0x1bcb0cce, 0x34c61236,
+  0x1c71898d, 0x3536cc52, 0x1d196538, 0x35a5793c,
+  0x1dc29958, 0x361214b0, 0x1e6d1f65, 0x367c9a7e,
+  0x1f18f0ce, 0x36e5068a, 0x1fc606f1, 0x374b54ce,
+  0x20745b24, 0x37af8159, 0x2123e6ad, 0x3811884d,
+  0x21d4a2c8, 0x387165e3, 0x228688a4, 0x38cf1669,
+  0x23399167, 0x392a9642, 0x23edb628, 0x3983e1e8,
+  0x24a2eff6, 0x39daf5e8, 0x255937d5, 0x3a2fcee8,
+  0x261086bc, 0x3a8269a3, 0x26c8d59c, 0x3ad2c2e8,
+  0x27821d59, 0x3b20d79e, 0x283c56cf, 0x3b6ca4c4,
+  0x28f77acf, 0x3bb6276e, 0x29b38223, 0x3bfd5cc4,
+  0x2a70658a, 0x3c42420a, 0x2b2e1dbe, 0x3c84d496,
+  0x2beca36c, 0x3cc511d9, 0x2cabef3d, 0x3d02f757,
+  0x2d6bf9d1, 0x3d3e82ae, 0x2e2cbbc1, 0x3d77b192,
+  0x2eee2d9d, 0x3dae81cf, 0x2fb047f2, 0x3de2f148,
+  0x30730342, 0x3e14fdf7, 0x3136580d, 0x3e44a5ef,
+  0x31fa3ecb, 0x3e71e759, 0x32beafed, 0x3e9cc076,
+  0x3383a3e2, 0x3ec52fa0, 0x34491311, 0x3eeb3347,
+  0x350ef5de, 0x3f0ec9f5, 0x35d544a7, 0x3f2ff24a,
+  0x369bf7c9, 0x3f4eaafe, 0x37630799, 0x3f6af2e3,
+  0x382a6c6a, 0x3f84c8e2, 0x38f21e8e, 0x3f9c2bfb,
+  0x39ba1651, 0x3fb11b48, 0x3a824bfd, 0x3fc395f9,
+  0x3b4ab7db, 0x3fd39b5a, 0x3c135231, 0x3fe12acb,
+  0x3cdc1342, 0x3fec43c7, 0x3da4f351, 0x3ff4e5e0,
+  0x3e6deaa1, 0x3ffb10c1, 0x3f36f170, 0x3ffec42d
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+
+static const q31_t realCoefAQ31[128] = {
+  0x40000000, 0xc0000000, 0x3cdc1342, 0xc013bc39,
+  0x39ba1651, 0xc04ee4b8, 0x369bf7c9, 0xc0b15502,
+  0x3383a3e2, 0xc13ad060, 0x30730342, 0xc1eb0209,
+  0x2d6bf9d1, 0xc2c17d52, 0x2a70658a, 0xc3bdbdf6,
+  0x27821d59, 0xc4df2862, 0x24a2eff6, 0xc6250a18,
+  0x21d4a2c8, 0xc78e9a1d, 0x1f18f0ce, 0xc91af976,
+  0x1c71898d, 0xcac933ae, 0x19e01006, 0xcc983f70,
+  0x176619b6, 0xce86ff2a, 0x15052d97, 0xd09441bb,
+  0x12bec333, 0xd2bec333, 0x109441bb, 0xd5052d97,
+  0xe86ff2a, 0xd76619b6, 0xc983f70, 0xd9e01006,
+  0xac933ae, 0xdc71898d, 0x91af976, 0xdf18f0ce,
+  0x78e9a1d, 0xe1d4a2c8, 0x6250a18, 0xe4a2eff6,
+  0x4df2862, 0xe7821d59, 0x3bdbdf6, 0xea70658a,
+  0x2c17d52, 0xed6bf9d1, 0x1eb0209, 0xf0730342,
+  0x13ad060, 0xf383a3e2, 0xb15502, 0xf69bf7c9,
+  0x4ee4b8, 0xf9ba1651, 0x13bc39, 0xfcdc1342,
+  0x0, 0x0, 0x13bc39, 0x323ecbe,
+  0x4ee4b8, 0x645e9af, 0xb15502, 0x9640837,
+  0x13ad060, 0xc7c5c1e, 0x1eb0209, 0xf8cfcbe,
+  0x2c17d52, 0x1294062f, 0x3bdbdf6, 0x158f9a76,
+  0x4df2862, 0x187de2a7, 0x6250a18, 0x1b5d100a,
+  0x78e9a1d, 0x1e2b5d38, 0x91af976, 0x20e70f32,
+  0xac933ae, 0x238e7673, 0xc983f70, 0x261feffa,
+  0xe86ff2a, 0x2899e64a, 0x109441bb, 0x2afad269,
+  0x12bec333, 0x2d413ccd, 0x15052d97, 0x2f6bbe45,
+  0x176619b6, 0x317900d6, 0x19e01006, 0x3367c090,
+  0x1c71898d, 0x3536cc52, 0x1f18f0ce, 0x36e5068a,
+  0x21d4a2c8, 0x387165e3, 0x24a2eff6, 0x39daf5e8,
+  0x27821d59, 0x3b20d79e, 0x2a70658a, 0x3c42420a,
+  0x2d6bf9d1, 0x3d3e82ae, 0x30730342, 0x3e14fdf7,
+  0x3383a3e2, 0x3ec52fa0, 0x369bf7c9, 0x3f4eaafe,
+  0x39ba1651, 0x3fb11b48, 0x3cdc1342, 0x3fec43c7
+};
+
+#endif
+
 
 /**    
 * \par   
 * Generation of realCoefBQ31 array:    
 * \par    
-*  n = 4096        
+*  n = ARM_MATH_MAX_FFT_LEN (4096 by default)        
 * <pre>for (i = 0; i < n; i++)    
 * {    
 *    pBTable[2 * i] = 0.5 * (1.0 + sin (2 * PI / (double) (2 * n) * (double) i));    
@@ -2128,6 +2820,8 @@ static const q31_t realCoefAQ31[8192] = {
 *    
 */
 
+#if (ARM_MATH_MAX_FFT_LEN == 4096)
+
 static const q31_t realCoefBQ31[8192] = {
   0x40000000, 0x40000000, 0x400c90fe, 0x3ffffec4,
   0x401921fb, 0x3ffffb11, 0x4025b2f7, 0x3ffff4e6,
@@ -4179,6 +4873,695 @@ static const q31_t realCoefBQ31[8192] = {
   0x401921fb, 0xc00004ef, 0x400c90fe, 0xc000013c,
 };
 
+#elif (ARM_MATH_MAX_FFT_LEN == 1024)
+
+static const q31_t realCoefBQ31[2048] = {
+  0x40000000, 0x40000000, 0x403243f1, 0x3fffec43,
+  0x406487c4, 0x3fffb10b, 0x4096cb58, 0x3fff4e59,
+  0x40c90e90, 0x3ffec42d, 0x40fb514b, 0x3ffe1288,
+  0x412d936c, 0x3ffd3969, 0x415fd4d2, 0x3ffc38d1,
+  0x4192155f, 0x3ffb10c1, 0x41c454f5, 0x3ff9c13a,
+  0x41f69373, 0x3ff84a3c, 0x4228d0bb, 0x3ff6abc8,
+  0x425b0caf, 0x3ff4e5e0, 0x428d472e, 0x3ff2f884,
+  0x42bf801a, 0x3ff0e3b6, 0x42f1b755, 0x3feea776,
+  0x4323ecbe, 0x3fec43c7, 0x43562038, 0x3fe9b8a9,
+  0x438851a2, 0x3fe7061f, 0x43ba80df, 0x3fe42c2a,
+  0x43ecadcf, 0x3fe12acb, 0x441ed854, 0x3fde0205,
+  0x4451004d, 0x3fdab1d9, 0x4483259d, 0x3fd73a4a,
+  0x44b54825, 0x3fd39b5a, 0x44e767c5, 0x3fcfd50b,
+  0x4519845e, 0x3fcbe75e, 0x454b9dd3, 0x3fc7d258,
+  0x457db403, 0x3fc395f9, 0x45afc6d0, 0x3fbf3246,
+  0x45e1d61b, 0x3fbaa740, 0x4613e1c5, 0x3fb5f4ea,
+  0x4645e9af, 0x3fb11b48, 0x4677edbb, 0x3fac1a5b,
+  0x46a9edc9, 0x3fa6f228, 0x46dbe9bb, 0x3fa1a2b2,
+  0x470de172, 0x3f9c2bfb, 0x473fd4cf, 0x3f968e07,
+  0x4771c3b3, 0x3f90c8da, 0x47a3adff, 0x3f8adc77,
+  0x47d59396, 0x3f84c8e2, 0x48077457, 0x3f7e8e1e,
+  0x48395024, 0x3f782c30, 0x486b26de, 0x3f71a31b,
+  0x489cf867, 0x3f6af2e3, 0x48cec4a0, 0x3f641b8d,
+  0x49008b6a, 0x3f5d1d1d, 0x49324ca7, 0x3f55f796,
+  0x49640837, 0x3f4eaafe, 0x4995bdfd, 0x3f473759,
+  0x49c76dd8, 0x3f3f9cab, 0x49f917ac, 0x3f37dafa,
+  0x4a2abb59, 0x3f2ff24a, 0x4a5c58c0, 0x3f27e29f,
+  0x4a8defc3, 0x3f1fabff, 0x4abf8043, 0x3f174e70,
+  0x4af10a22, 0x3f0ec9f5, 0x4b228d42, 0x3f061e95,
+  0x4b540982, 0x3efd4c54, 0x4b857ec7, 0x3ef45338,
+  0x4bb6ecef, 0x3eeb3347, 0x4be853de, 0x3ee1ec87,
+  0x4c19b374, 0x3ed87efc, 0x4c4b0b94, 0x3eceeaad,
+  0x4c7c5c1e, 0x3ec52fa0, 0x4cada4f5, 0x3ebb4ddb,
+  0x4cdee5f9, 0x3eb14563, 0x4d101f0e, 0x3ea7163f,
+  0x4d415013, 0x3e9cc076, 0x4d7278eb, 0x3e92440d,
+  0x4da39978, 0x3e87a10c, 0x4dd4b19a, 0x3e7cd778,
+  0x4e05c135, 0x3e71e759, 0x4e36c82a, 0x3e66d0b4,
+  0x4e67c65a, 0x3e5b9392, 0x4e98bba7, 0x3e502ff9,
+  0x4ec9a7f3, 0x3e44a5ef, 0x4efa8b20, 0x3e38f57c,
+  0x4f2b650f, 0x3e2d1ea8, 0x4f5c35a3, 0x3e212179,
+  0x4f8cfcbe, 0x3e14fdf7, 0x4fbdba40, 0x3e08b42a,
+  0x4fee6e0d, 0x3dfc4418, 0x501f1807, 0x3defadca,
+  0x504fb80e, 0x3de2f148, 0x50804e06, 0x3dd60e99,
+  0x50b0d9d0, 0x3dc905c5, 0x50e15b4e, 0x3dbbd6d4,
+  0x5111d263, 0x3dae81cf, 0x51423ef0, 0x3da106bd,
+  0x5172a0d7, 0x3d9365a8, 0x51a2f7fc, 0x3d859e96,
+  0x51d3443f, 0x3d77b192, 0x52038584, 0x3d699ea3,
+  0x5233bbac, 0x3d5b65d2, 0x5263e699, 0x3d4d0728,
+  0x5294062f, 0x3d3e82ae, 0x52c41a4f, 0x3d2fd86c,
+  0x52f422db, 0x3d21086c, 0x53241fb6, 0x3d1212b7,
+  0x535410c3, 0x3d02f757, 0x5383f5e3, 0x3cf3b653,
+  0x53b3cefa, 0x3ce44fb7, 0x53e39be9, 0x3cd4c38b,
+  0x54135c94, 0x3cc511d9, 0x544310dd, 0x3cb53aaa,
+  0x5472b8a5, 0x3ca53e09, 0x54a253d1, 0x3c951bff,
+  0x54d1e242, 0x3c84d496, 0x550163dc, 0x3c7467d9,
+  0x5530d881, 0x3c63d5d1, 0x55604013, 0x3c531e88,
+  0x558f9a76, 0x3c42420a, 0x55bee78c, 0x3c314060,
+  0x55ee2738, 0x3c201994, 0x561d595d, 0x3c0ecdb2,
+  0x564c7ddd, 0x3bfd5cc4, 0x567b949d, 0x3bebc6d5,
+  0x56aa9d7e, 0x3bda0bf0, 0x56d99864, 0x3bc82c1f,
+  0x57088531, 0x3bb6276e, 0x573763c9, 0x3ba3fde7,
+  0x5766340f, 0x3b91af97, 0x5794f5e6, 0x3b7f3c87,
+  0x57c3a931, 0x3b6ca4c4, 0x57f24dd3, 0x3b59e85a,
+  0x5820e3b0, 0x3b470753, 0x584f6aab, 0x3b3401bb,
+  0x587de2a7, 0x3b20d79e, 0x58ac4b87, 0x3b0d8909,
+  0x58daa52f, 0x3afa1605, 0x5908ef82, 0x3ae67ea1,
+  0x59372a64, 0x3ad2c2e8, 0x596555b8, 0x3abee2e5,
+  0x59937161, 0x3aaadea6, 0x59c17d44, 0x3a96b636,
+  0x59ef7944, 0x3a8269a3, 0x5a1d6544, 0x3a6df8f8,
+  0x5a4b4128, 0x3a596442, 0x5a790cd4, 0x3a44ab8e,
+  0x5aa6c82b, 0x3a2fcee8, 0x5ad47312, 0x3a1ace5f,
+  0x5b020d6c, 0x3a05a9fd, 0x5b2f971e, 0x39f061d2,
+  0x5b5d100a, 0x39daf5e8, 0x5b8a7815, 0x39c5664f,
+  0x5bb7cf23, 0x39afb313, 0x5be51518, 0x3999dc42,
+  0x5c1249d8, 0x3983e1e8, 0x5c3f6d47, 0x396dc414,
+  0x5c6c7f4a, 0x395782d3, 0x5c997fc4, 0x39411e33,
+  0x5cc66e99, 0x392a9642, 0x5cf34baf, 0x3913eb0e,
+  0x5d2016e9, 0x38fd1ca4, 0x5d4cd02c, 0x38e62b13,
+  0x5d79775c, 0x38cf1669, 0x5da60c5d, 0x38b7deb4,
+  0x5dd28f15, 0x38a08402, 0x5dfeff67, 0x38890663,
+  0x5e2b5d38, 0x387165e3, 0x5e57a86d, 0x3859a292,
+  0x5e83e0eb, 0x3841bc7f, 0x5eb00696, 0x3829b3b9,
+  0x5edc1953, 0x3811884d, 0x5f081907, 0x37f93a4b,
+  0x5f340596, 0x37e0c9c3, 0x5f5fdee6, 0x37c836c2,
+  0x5f8ba4dc, 0x37af8159, 0x5fb7575c, 0x3796a996,
+  0x5fe2f64c, 0x377daf89, 0x600e8190, 0x37649341,
+  0x6039f90f, 0x374b54ce, 0x60655cac, 0x3731f440,
+  0x6090ac4d, 0x371871a5, 0x60bbe7d8, 0x36fecd0e,
+  0x60e70f32, 0x36e5068a, 0x61122240, 0x36cb1e2a,
+  0x613d20e8, 0x36b113fd, 0x61680b0f, 0x3696e814,
+  0x6192e09b, 0x367c9a7e, 0x61bda171, 0x36622b4c,
+  0x61e84d76, 0x36479a8e, 0x6212e492, 0x362ce855,
+  0x623d66a8, 0x361214b0, 0x6267d3a0, 0x35f71fb1,
+  0x62922b5e, 0x35dc0968, 0x62bc6dca, 0x35c0d1e7,
+  0x62e69ac8, 0x35a5793c, 0x6310b23e, 0x3589ff7a,
+  0x633ab414, 0x356e64b2, 0x6364a02e, 0x3552a8f4,
+  0x638e7673, 0x3536cc52, 0x63b836ca, 0x351acedd,
+  0x63e1e117, 0x34feb0a5, 0x640b7543, 0x34e271bd,
+  0x6434f332, 0x34c61236, 0x645e5acc, 0x34a99221,
+  0x6487abf7, 0x348cf190, 0x64b0e699, 0x34703095,
+  0x64da0a9a, 0x34534f41, 0x650317df, 0x34364da6,
+  0x652c0e4f, 0x34192bd5, 0x6554edd1, 0x33fbe9e2,
+  0x657db64c, 0x33de87de, 0x65a667a7, 0x33c105db,
+  0x65cf01c8, 0x33a363ec, 0x65f78497, 0x3385a222,
+  0x661feffa, 0x3367c090, 0x664843d9, 0x3349bf48,
+  0x6670801a, 0x332b9e5e, 0x6698a4a6, 0x330d5de3,
+  0x66c0b162, 0x32eefdea, 0x66e8a637, 0x32d07e85,
+  0x6710830c, 0x32b1dfc9, 0x673847c8, 0x329321c7,
+  0x675ff452, 0x32744493, 0x67878893, 0x32554840,
+  0x67af0472, 0x32362ce0, 0x67d667d5, 0x3216f287,
+  0x67fdb2a7, 0x31f79948, 0x6824e4cc, 0x31d82137,
+  0x684bfe2f, 0x31b88a66, 0x6872feb6, 0x3198d4ea,
+  0x6899e64a, 0x317900d6, 0x68c0b4d2, 0x31590e3e,
+  0x68e76a37, 0x3138fd35, 0x690e0661, 0x3118cdcf,
+  0x69348937, 0x30f8801f, 0x695af2a3, 0x30d8143b,
+  0x6981428c, 0x30b78a36, 0x69a778db, 0x3096e223,
+  0x69cd9578, 0x30761c18, 0x69f3984c, 0x30553828,
+  0x6a19813f, 0x30343667, 0x6a3f503a, 0x301316eb,
+  0x6a650525, 0x2ff1d9c7, 0x6a8a9fea, 0x2fd07f0f,
+  0x6ab02071, 0x2faf06da, 0x6ad586a3, 0x2f8d713a,
+  0x6afad269, 0x2f6bbe45, 0x6b2003ac, 0x2f49ee0f,
+  0x6b451a55, 0x2f2800af, 0x6b6a164d, 0x2f05f637,
+  0x6b8ef77d, 0x2ee3cebe, 0x6bb3bdce, 0x2ec18a58,
+  0x6bd8692b, 0x2e9f291b, 0x6bfcf97c, 0x2e7cab1c,
+  0x6c216eaa, 0x2e5a1070, 0x6c45c8a0, 0x2e37592c,
+  0x6c6a0746, 0x2e148566, 0x6c8e2a87, 0x2df19534,
+  0x6cb2324c, 0x2dce88aa, 0x6cd61e7f, 0x2dab5fdf,
+  0x6cf9ef09, 0x2d881ae8, 0x6d1da3d5, 0x2d64b9da,
+  0x6d413ccd, 0x2d413ccd, 0x6d64b9da, 0x2d1da3d5,
+  0x6d881ae8, 0x2cf9ef09, 0x6dab5fdf, 0x2cd61e7f,
+  0x6dce88aa, 0x2cb2324c, 0x6df19534, 0x2c8e2a87,
+  0x6e148566, 0x2c6a0746, 0x6e37592c, 0x2c45c8a0,
+  0x6e5a1070, 0x2c216eaa, 0x6e7cab1c, 0x2bfcf97c,
+  0x6e9f291b, 0x2bd8692b, 0x6ec18a58, 0x2bb3bdce,
+  0x6ee3cebe, 0x2b8ef77d, 0x6f05f637, 0x2b6a164d,
+  0x6f2800af, 0x2b451a55, 0x6f49ee0f, 0x2b2003ac,
+  0x6f6bbe45, 0x2afad269, 0x6f8d713a, 0x2ad586a3,
+  0x6faf06da, 0x2ab02071, 0x6fd07f0f, 0x2a8a9fea,
+  0x6ff1d9c7, 0x2a650525, 0x701316eb, 0x2a3f503a,
+  0x70343667, 0x2a19813f, 0x70553828, 0x29f3984c,
+  0x70761c18, 0x29cd9578, 0x7096e223, 0x29a778db,
+  0x70b78a36, 0x2981428c, 0x70d8143b, 0x295af2a3,
+  0x70f8801f, 0x29348937, 0x7118cdcf, 0x290e0661,
+  0x7138fd35, 0x28e76a37, 0x71590e3e, 0x28c0b4d2,
+  0x717900d6, 0x2899e64a, 0x7198d4ea, 0x2872feb6,
+  0x71b88a66, 0x284bfe2f, 0x71d82137, 0x2824e4cc,
+  0x71f79948, 0x27fdb2a7, 0x7216f287, 0x27d667d5,
+  0x72362ce0, 0x27af0472, 0x72554840, 0x27878893,
+  0x72744493, 0x275ff452, 0x729321c7, 0x273847c8,
+  0x72b1dfc9, 0x2710830c, 0x72d07e85, 0x26e8a637,
+  0x72eefdea, 0x26c0b162, 0x730d5de3, 0x2698a4a6,
+  0x732b9e5e, 0x2670801a, 0x7349bf48, 0x264843d9,
+  0x7367c090, 0x261feffa, 0x7385a222, 0x25f78497,
+  0x73a363ec, 0x25cf01c8, 0x73c105db, 0x25a667a7,
+  0x73de87de, 0x257db64c, 0x73fbe9e2, 0x2554edd1,
+  0x74192bd5, 0x252c0e4f, 0x74364da6, 0x250317df,
+  0x74534f41, 0x24da0a9a, 0x74703095, 0x24b0e699,
+  0x748cf190, 0x2487abf7, 0x74a99221, 0x245e5acc,
+  0x74c61236, 0x2434f332, 0x74e271bd, 0x240b7543,
+  0x74feb0a5, 0x23e1e117, 0x751acedd, 0x23b836ca,
+  0x7536cc52, 0x238e7673, 0x7552a8f4, 0x2364a02e,
+  0x756e64b2, 0x233ab414, 0x7589ff7a, 0x2310b23e,
+  0x75a5793c, 0x22e69ac8, 0x75c0d1e7, 0x22bc6dca,
+  0x75dc0968, 0x22922b5e, 0x75f71fb1, 0x2267d3a0,
+  0x761214b0, 0x223d66a8, 0x762ce855, 0x2212e492,
+  0x76479a8e, 0x21e84d76, 0x76622b4c, 0x21bda171,
+  0x767c9a7e, 0x2192e09b, 0x7696e814, 0x21680b0f,
+  0x76b113fd, 0x213d20e8, 0x76cb1e2a, 0x21122240,
+  0x76e5068a, 0x20e70f32, 0x76fecd0e, 0x20bbe7d8,
+  0x771871a5, 0x2090ac4d, 0x7731f440, 0x20655cac,
+  0x774b54ce, 0x2039f90f, 0x77649341, 0x200e8190,
+  0x777daf89, 0x1fe2f64c, 0x7796a996, 0x1fb7575c,
+  0x77af8159, 0x1f8ba4dc, 0x77c836c2, 0x1f5fdee6,
+  0x77e0c9c3, 0x1f340596, 0x77f93a4b, 0x1f081907,
+  0x7811884d, 0x1edc1953, 0x7829b3b9, 0x1eb00696,
+  0x7841bc7f, 0x1e83e0eb, 0x7859a292, 0x1e57a86d,
+  0x787165e3, 0x1e2b5d38, 0x78890663, 0x1dfeff67,
+  0x78a08402, 0x1dd28f15, 0x78b7deb4, 0x1da60c5d,
+  0x78cf1669, 0x1d79775c, 0x78e62b13, 0x1d4cd02c,
+  0x78fd1ca4, 0x1d2016e9, 0x7913eb0e, 0x1cf34baf,
+  0x792a9642, 0x1cc66e99, 0x79411e33, 0x1c997fc4,
+  0x795782d3, 0x1c6c7f4a, 0x796dc414, 0x1c3f6d47,
+  0x7983e1e8, 0x1c1249d8, 0x7999dc42, 0x1be51518,
+  0x79afb313, 0x1bb7cf23, 0x79c5664f, 0x1b8a7815,
+  0x79daf5e8, 0x1b5d100a, 0x79f061d2, 0x1b2f971e,
+  0x7a05a9fd, 0x1b020d6c, 0x7a1ace5f, 0x1ad47312,
+  0x7a2fcee8, 0x1aa6c82b, 0x7a44ab8e, 0x1a790cd4,
+  0x7a596442, 0x1a4b4128, 0x7a6df8f8, 0x1a1d6544,
+  0x7a8269a3, 0x19ef7944, 0x7a96b636, 0x19c17d44,
+  0x7aaadea6, 0x19937161, 0x7abee2e5, 0x196555b8,
+  0x7ad2c2e8, 0x19372a64, 0x7ae67ea1, 0x1908ef82,
+  0x7afa1605, 0x18daa52f, 0x7b0d8909, 0x18ac4b87,
+  0x7b20d79e, 0x187de2a7, 0x7b3401bb, 0x184f6aab,
+  0x7b470753, 0x1820e3b0, 0x7b59e85a, 0x17f24dd3,
+  0x7b6ca4c4, 0x17c3a931, 0x7b7f3c87, 0x1794f5e6,
+  0x7b91af97, 0x1766340f, 0x7ba3fde7, 0x173763c9,
+  0x7bb6276e, 0x17088531, 0x7bc82c1f, 0x16d99864,
+  0x7bda0bf0, 0x16aa9d7e, 0x7bebc6d5, 0x167b949d,
+  0x7bfd5cc4, 0x164c7ddd, 0x7c0ecdb2, 0x161d595d,
+  0x7c201994, 0x15ee2738, 0x7c314060, 0x15bee78c,
+  0x7c42420a, 0x158f9a76, 0x7c531e88, 0x15604013,
+  0x7c63d5d1, 0x1530d881, 0x7c7467d9, 0x150163dc,
+  0x7c84d496, 0x14d1e242, 0x7c951bff, 0x14a253d1,
+  0x7ca53e09, 0x1472b8a5, 0x7cb53aaa, 0x144310dd,
+  0x7cc511d9, 0x14135c94, 0x7cd4c38b, 0x13e39be9,
+  0x7ce44fb7, 0x13b3cefa, 0x7cf3b653, 0x1383f5e3,
+  0x7d02f757, 0x135410c3, 0x7d1212b7, 0x13241fb6,
+  0x7d21086c, 0x12f422db, 0x7d2fd86c, 0x12c41a4f,
+  0x7d3e82ae, 0x1294062f, 0x7d4d0728, 0x1263e699,
+  0x7d5b65d2, 0x1233bbac, 0x7d699ea3, 0x12038584,
+  0x7d77b192, 0x11d3443f, 0x7d859e96, 0x11a2f7fc,
+  0x7d9365a8, 0x1172a0d7, 0x7da106bd, 0x11423ef0,
+  0x7dae81cf, 0x1111d263, 0x7dbbd6d4, 0x10e15b4e,
+  0x7dc905c5, 0x10b0d9d0, 0x7dd60e99, 0x10804e06,
+  0x7de2f148, 0x104fb80e, 0x7defadca, 0x101f1807,
+  0x7dfc4418, 0xfee6e0d, 0x7e08b42a, 0xfbdba40,
+  0x7e14fdf7, 0xf8cfcbe, 0x7e212179, 0xf5c35a3,
+  0x7e2d1ea8, 0xf2b650f, 0x7e38f57c, 0xefa8b20,
+  0x7e44a5ef, 0xec9a7f3, 0x7e502ff9, 0xe98bba7,
+  0x7e5b9392, 0xe67c65a, 0x7e66d0b4, 0xe36c82a,
+  0x7e71e759, 0xe05c135, 0x7e7cd778, 0xdd4b19a,
+  0x7e87a10c, 0xda39978, 0x7e92440d, 0xd7278eb,
+  0x7e9cc076, 0xd415013, 0x7ea7163f, 0xd101f0e,
+  0x7eb14563, 0xcdee5f9, 0x7ebb4ddb, 0xcada4f5,
+  0x7ec52fa0, 0xc7c5c1e, 0x7eceeaad, 0xc4b0b94,
+  0x7ed87efc, 0xc19b374, 0x7ee1ec87, 0xbe853de,
+  0x7eeb3347, 0xbb6ecef, 0x7ef45338, 0xb857ec7,
+  0x7efd4c54, 0xb540982, 0x7f061e95, 0xb228d42,
+  0x7f0ec9f5, 0xaf10a22, 0x7f174e70, 0xabf8043,
+  0x7f1fabff, 0xa8defc3, 0x7f27e29f, 0xa5c58c0,
+  0x7f2ff24a, 0xa2abb59, 0x7f37dafa, 0x9f917ac,
+  0x7f3f9cab, 0x9c76dd8, 0x7f473759, 0x995bdfd,
+  0x7f4eaafe, 0x9640837, 0x7f55f796, 0x9324ca7,
+  0x7f5d1d1d, 0x9008b6a, 0x7f641b8d, 0x8cec4a0,
+  0x7f6af2e3, 0x89cf867, 0x7f71a31b, 0x86b26de,
+  0x7f782c30, 0x8395024, 0x7f7e8e1e, 0x8077457,
+  0x7f84c8e2, 0x7d59396, 0x7f8adc77, 0x7a3adff,
+  0x7f90c8da, 0x771c3b3, 0x7f968e07, 0x73fd4cf,
+  0x7f9c2bfb, 0x70de172, 0x7fa1a2b2, 0x6dbe9bb,
+  0x7fa6f228, 0x6a9edc9, 0x7fac1a5b, 0x677edbb,
+  0x7fb11b48, 0x645e9af, 0x7fb5f4ea, 0x613e1c5,
+  0x7fbaa740, 0x5e1d61b, 0x7fbf3246, 0x5afc6d0,
+  0x7fc395f9, 0x57db403, 0x7fc7d258, 0x54b9dd3,
+  0x7fcbe75e, 0x519845e, 0x7fcfd50b, 0x4e767c5,
+  0x7fd39b5a, 0x4b54825, 0x7fd73a4a, 0x483259d,
+  0x7fdab1d9, 0x451004d, 0x7fde0205, 0x41ed854,
+  0x7fe12acb, 0x3ecadcf, 0x7fe42c2a, 0x3ba80df,
+  0x7fe7061f, 0x38851a2, 0x7fe9b8a9, 0x3562038,
+  0x7fec43c7, 0x323ecbe, 0x7feea776, 0x2f1b755,
+  0x7ff0e3b6, 0x2bf801a, 0x7ff2f884, 0x28d472e,
+  0x7ff4e5e0, 0x25b0caf, 0x7ff6abc8, 0x228d0bb,
+  0x7ff84a3c, 0x1f69373, 0x7ff9c13a, 0x1c454f5,
+  0x7ffb10c1, 0x192155f, 0x7ffc38d1, 0x15fd4d2,
+  0x7ffd3969, 0x12d936c, 0x7ffe1288, 0xfb514b,
+  0x7ffec42d, 0xc90e90, 0x7fff4e59, 0x96cb58,
+  0x7fffb10b, 0x6487c4, 0x7fffec43, 0x3243f1,
+  0x7fffffff, 0x0, 0x7fffec43, 0xffcdbc0f,
+  0x7fffb10b, 0xff9b783c, 0x7fff4e59, 0xff6934a8,
+  0x7ffec42d, 0xff36f170, 0x7ffe1288, 0xff04aeb5,
+  0x7ffd3969, 0xfed26c94, 0x7ffc38d1, 0xfea02b2e,
+  0x7ffb10c1, 0xfe6deaa1, 0x7ff9c13a, 0xfe3bab0b,
+  0x7ff84a3c, 0xfe096c8d, 0x7ff6abc8, 0xfdd72f45,
+  0x7ff4e5e0, 0xfda4f351, 0x7ff2f884, 0xfd72b8d2,
+  0x7ff0e3b6, 0xfd407fe6, 0x7feea776, 0xfd0e48ab,
+  0x7fec43c7, 0xfcdc1342, 0x7fe9b8a9, 0xfca9dfc8,
+  0x7fe7061f, 0xfc77ae5e, 0x7fe42c2a, 0xfc457f21,
+  0x7fe12acb, 0xfc135231, 0x7fde0205, 0xfbe127ac,
+  0x7fdab1d9, 0xfbaeffb3, 0x7fd73a4a, 0xfb7cda63,
+  0x7fd39b5a, 0xfb4ab7db, 0x7fcfd50b, 0xfb18983b,
+  0x7fcbe75e, 0xfae67ba2, 0x7fc7d258, 0xfab4622d,
+  0x7fc395f9, 0xfa824bfd, 0x7fbf3246, 0xfa503930,
+  0x7fbaa740, 0xfa1e29e5, 0x7fb5f4ea, 0xf9ec1e3b,
+  0x7fb11b48, 0xf9ba1651, 0x7fac1a5b, 0xf9881245,
+  0x7fa6f228, 0xf9561237, 0x7fa1a2b2, 0xf9241645,
+  0x7f9c2bfb, 0xf8f21e8e, 0x7f968e07, 0xf8c02b31,
+  0x7f90c8da, 0xf88e3c4d, 0x7f8adc77, 0xf85c5201,
+  0x7f84c8e2, 0xf82a6c6a, 0x7f7e8e1e, 0xf7f88ba9,
+  0x7f782c30, 0xf7c6afdc, 0x7f71a31b, 0xf794d922,
+  0x7f6af2e3, 0xf7630799, 0x7f641b8d, 0xf7313b60,
+  0x7f5d1d1d, 0xf6ff7496, 0x7f55f796, 0xf6cdb359,
+  0x7f4eaafe, 0xf69bf7c9, 0x7f473759, 0xf66a4203,
+  0x7f3f9cab, 0xf6389228, 0x7f37dafa, 0xf606e854,
+  0x7f2ff24a, 0xf5d544a7, 0x7f27e29f, 0xf5a3a740,
+  0x7f1fabff, 0xf572103d, 0x7f174e70, 0xf5407fbd,
+  0x7f0ec9f5, 0xf50ef5de, 0x7f061e95, 0xf4dd72be,
+  0x7efd4c54, 0xf4abf67e, 0x7ef45338, 0xf47a8139,
+  0x7eeb3347, 0xf4491311, 0x7ee1ec87, 0xf417ac22,
+  0x7ed87efc, 0xf3e64c8c, 0x7eceeaad, 0xf3b4f46c,
+  0x7ec52fa0, 0xf383a3e2, 0x7ebb4ddb, 0xf3525b0b,
+  0x7eb14563, 0xf3211a07, 0x7ea7163f, 0xf2efe0f2,
+  0x7e9cc076, 0xf2beafed, 0x7e92440d, 0xf28d8715,
+  0x7e87a10c, 0xf25c6688, 0x7e7cd778, 0xf22b4e66,
+  0x7e71e759, 0xf1fa3ecb, 0x7e66d0b4, 0xf1c937d6,
+  0x7e5b9392, 0xf19839a6, 0x7e502ff9, 0xf1674459,
+  0x7e44a5ef, 0xf136580d, 0x7e38f57c, 0xf10574e0,
+  0x7e2d1ea8, 0xf0d49af1, 0x7e212179, 0xf0a3ca5d,
+  0x7e14fdf7, 0xf0730342, 0x7e08b42a, 0xf04245c0,
+  0x7dfc4418, 0xf01191f3, 0x7defadca, 0xefe0e7f9,
+  0x7de2f148, 0xefb047f2, 0x7dd60e99, 0xef7fb1fa,
+  0x7dc905c5, 0xef4f2630, 0x7dbbd6d4, 0xef1ea4b2,
+  0x7dae81cf, 0xeeee2d9d, 0x7da106bd, 0xeebdc110,
+  0x7d9365a8, 0xee8d5f29, 0x7d859e96, 0xee5d0804,
+  0x7d77b192, 0xee2cbbc1, 0x7d699ea3, 0xedfc7a7c,
+  0x7d5b65d2, 0xedcc4454, 0x7d4d0728, 0xed9c1967,
+  0x7d3e82ae, 0xed6bf9d1, 0x7d2fd86c, 0xed3be5b1,
+  0x7d21086c, 0xed0bdd25, 0x7d1212b7, 0xecdbe04a,
+  0x7d02f757, 0xecabef3d, 0x7cf3b653, 0xec7c0a1d,
+  0x7ce44fb7, 0xec4c3106, 0x7cd4c38b, 0xec1c6417,
+  0x7cc511d9, 0xebeca36c, 0x7cb53aaa, 0xebbcef23,
+  0x7ca53e09, 0xeb8d475b, 0x7c951bff, 0xeb5dac2f,
+  0x7c84d496, 0xeb2e1dbe, 0x7c7467d9, 0xeafe9c24,
+  0x7c63d5d1, 0xeacf277f, 0x7c531e88, 0xea9fbfed,
+  0x7c42420a, 0xea70658a, 0x7c314060, 0xea411874,
+  0x7c201994, 0xea11d8c8, 0x7c0ecdb2, 0xe9e2a6a3,
+  0x7bfd5cc4, 0xe9b38223, 0x7bebc6d5, 0xe9846b63,
+  0x7bda0bf0, 0xe9556282, 0x7bc82c1f, 0xe926679c,
+  0x7bb6276e, 0xe8f77acf, 0x7ba3fde7, 0xe8c89c37,
+  0x7b91af97, 0xe899cbf1, 0x7b7f3c87, 0xe86b0a1a,
+  0x7b6ca4c4, 0xe83c56cf, 0x7b59e85a, 0xe80db22d,
+  0x7b470753, 0xe7df1c50, 0x7b3401bb, 0xe7b09555,
+  0x7b20d79e, 0xe7821d59, 0x7b0d8909, 0xe753b479,
+  0x7afa1605, 0xe7255ad1, 0x7ae67ea1, 0xe6f7107e,
+  0x7ad2c2e8, 0xe6c8d59c, 0x7abee2e5, 0xe69aaa48,
+  0x7aaadea6, 0xe66c8e9f, 0x7a96b636, 0xe63e82bc,
+  0x7a8269a3, 0xe61086bc, 0x7a6df8f8, 0xe5e29abc,
+  0x7a596442, 0xe5b4bed8, 0x7a44ab8e, 0xe586f32c,
+  0x7a2fcee8, 0xe55937d5, 0x7a1ace5f, 0xe52b8cee,
+  0x7a05a9fd, 0xe4fdf294, 0x79f061d2, 0xe4d068e2,
+  0x79daf5e8, 0xe4a2eff6, 0x79c5664f, 0xe47587eb,
+  0x79afb313, 0xe44830dd, 0x7999dc42, 0xe41aeae8,
+  0x7983e1e8, 0xe3edb628, 0x796dc414, 0xe3c092b9,
+  0x795782d3, 0xe39380b6, 0x79411e33, 0xe366803c,
+  0x792a9642, 0xe3399167, 0x7913eb0e, 0xe30cb451,
+  0x78fd1ca4, 0xe2dfe917, 0x78e62b13, 0xe2b32fd4,
+  0x78cf1669, 0xe28688a4, 0x78b7deb4, 0xe259f3a3,
+  0x78a08402, 0xe22d70eb, 0x78890663, 0xe2010099,
+  0x787165e3, 0xe1d4a2c8, 0x7859a292, 0xe1a85793,
+  0x7841bc7f, 0xe17c1f15, 0x7829b3b9, 0xe14ff96a,
+  0x7811884d, 0xe123e6ad, 0x77f93a4b, 0xe0f7e6f9,
+  0x77e0c9c3, 0xe0cbfa6a, 0x77c836c2, 0xe0a0211a,
+  0x77af8159, 0xe0745b24, 0x7796a996, 0xe048a8a4,
+  0x777daf89, 0xe01d09b4, 0x77649341, 0xdff17e70,
+  0x774b54ce, 0xdfc606f1, 0x7731f440, 0xdf9aa354,
+  0x771871a5, 0xdf6f53b3, 0x76fecd0e, 0xdf441828,
+  0x76e5068a, 0xdf18f0ce, 0x76cb1e2a, 0xdeedddc0,
+  0x76b113fd, 0xdec2df18, 0x7696e814, 0xde97f4f1,
+  0x767c9a7e, 0xde6d1f65, 0x76622b4c, 0xde425e8f,
+  0x76479a8e, 0xde17b28a, 0x762ce855, 0xdded1b6e,
+  0x761214b0, 0xddc29958, 0x75f71fb1, 0xdd982c60,
+  0x75dc0968, 0xdd6dd4a2, 0x75c0d1e7, 0xdd439236,
+  0x75a5793c, 0xdd196538, 0x7589ff7a, 0xdcef4dc2,
+  0x756e64b2, 0xdcc54bec, 0x7552a8f4, 0xdc9b5fd2,
+  0x7536cc52, 0xdc71898d, 0x751acedd, 0xdc47c936,
+  0x74feb0a5, 0xdc1e1ee9, 0x74e271bd, 0xdbf48abd,
+  0x74c61236, 0xdbcb0cce, 0x74a99221, 0xdba1a534,
+  0x748cf190, 0xdb785409, 0x74703095, 0xdb4f1967,
+  0x74534f41, 0xdb25f566, 0x74364da6, 0xdafce821,
+  0x74192bd5, 0xdad3f1b1, 0x73fbe9e2, 0xdaab122f,
+  0x73de87de, 0xda8249b4, 0x73c105db, 0xda599859,
+  0x73a363ec, 0xda30fe38, 0x7385a222, 0xda087b69,
+  0x7367c090, 0xd9e01006, 0x7349bf48, 0xd9b7bc27,
+  0x732b9e5e, 0xd98f7fe6, 0x730d5de3, 0xd9675b5a,
+  0x72eefdea, 0xd93f4e9e, 0x72d07e85, 0xd91759c9,
+  0x72b1dfc9, 0xd8ef7cf4, 0x729321c7, 0xd8c7b838,
+  0x72744493, 0xd8a00bae, 0x72554840, 0xd878776d,
+  0x72362ce0, 0xd850fb8e, 0x7216f287, 0xd829982b,
+  0x71f79948, 0xd8024d59, 0x71d82137, 0xd7db1b34,
+  0x71b88a66, 0xd7b401d1, 0x7198d4ea, 0xd78d014a,
+  0x717900d6, 0xd76619b6, 0x71590e3e, 0xd73f4b2e,
+  0x7138fd35, 0xd71895c9, 0x7118cdcf, 0xd6f1f99f,
+  0x70f8801f, 0xd6cb76c9, 0x70d8143b, 0xd6a50d5d,
+  0x70b78a36, 0xd67ebd74, 0x7096e223, 0xd6588725,
+  0x70761c18, 0xd6326a88, 0x70553828, 0xd60c67b4,
+  0x70343667, 0xd5e67ec1, 0x701316eb, 0xd5c0afc6,
+  0x6ff1d9c7, 0xd59afadb, 0x6fd07f0f, 0xd5756016,
+  0x6faf06da, 0xd54fdf8f, 0x6f8d713a, 0xd52a795d,
+  0x6f6bbe45, 0xd5052d97, 0x6f49ee0f, 0xd4dffc54,
+  0x6f2800af, 0xd4bae5ab, 0x6f05f637, 0xd495e9b3,
+  0x6ee3cebe, 0xd4710883, 0x6ec18a58, 0xd44c4232,
+  0x6e9f291b, 0xd42796d5, 0x6e7cab1c, 0xd4030684,
+  0x6e5a1070, 0xd3de9156, 0x6e37592c, 0xd3ba3760,
+  0x6e148566, 0xd395f8ba, 0x6df19534, 0xd371d579,
+  0x6dce88aa, 0xd34dcdb4, 0x6dab5fdf, 0xd329e181,
+  0x6d881ae8, 0xd30610f7, 0x6d64b9da, 0xd2e25c2b,
+  0x6d413ccd, 0xd2bec333, 0x6d1da3d5, 0xd29b4626,
+  0x6cf9ef09, 0xd277e518, 0x6cd61e7f, 0xd254a021,
+  0x6cb2324c, 0xd2317756, 0x6c8e2a87, 0xd20e6acc,
+  0x6c6a0746, 0xd1eb7a9a, 0x6c45c8a0, 0xd1c8a6d4,
+  0x6c216eaa, 0xd1a5ef90, 0x6bfcf97c, 0xd18354e4,
+  0x6bd8692b, 0xd160d6e5, 0x6bb3bdce, 0xd13e75a8,
+  0x6b8ef77d, 0xd11c3142, 0x6b6a164d, 0xd0fa09c9,
+  0x6b451a55, 0xd0d7ff51, 0x6b2003ac, 0xd0b611f1,
+  0x6afad269, 0xd09441bb, 0x6ad586a3, 0xd0728ec6,
+  0x6ab02071, 0xd050f926, 0x6a8a9fea, 0xd02f80f1,
+  0x6a650525, 0xd00e2639, 0x6a3f503a, 0xcfece915,
+  0x6a19813f, 0xcfcbc999, 0x69f3984c, 0xcfaac7d8,
+  0x69cd9578, 0xcf89e3e8, 0x69a778db, 0xcf691ddd,
+  0x6981428c, 0xcf4875ca, 0x695af2a3, 0xcf27ebc5,
+  0x69348937, 0xcf077fe1, 0x690e0661, 0xcee73231,
+  0x68e76a37, 0xcec702cb, 0x68c0b4d2, 0xcea6f1c2,
+  0x6899e64a, 0xce86ff2a, 0x6872feb6, 0xce672b16,
+  0x684bfe2f, 0xce47759a, 0x6824e4cc, 0xce27dec9,
+  0x67fdb2a7, 0xce0866b8, 0x67d667d5, 0xcde90d79,
+  0x67af0472, 0xcdc9d320, 0x67878893, 0xcdaab7c0,
+  0x675ff452, 0xcd8bbb6d, 0x673847c8, 0xcd6cde39,
+  0x6710830c, 0xcd4e2037, 0x66e8a637, 0xcd2f817b,
+  0x66c0b162, 0xcd110216, 0x6698a4a6, 0xccf2a21d,
+  0x6670801a, 0xccd461a2, 0x664843d9, 0xccb640b8,
+  0x661feffa, 0xcc983f70, 0x65f78497, 0xcc7a5dde,
+  0x65cf01c8, 0xcc5c9c14, 0x65a667a7, 0xcc3efa25,
+  0x657db64c, 0xcc217822, 0x6554edd1, 0xcc04161e,
+  0x652c0e4f, 0xcbe6d42b, 0x650317df, 0xcbc9b25a,
+  0x64da0a9a, 0xcbacb0bf, 0x64b0e699, 0xcb8fcf6b,
+  0x6487abf7, 0xcb730e70, 0x645e5acc, 0xcb566ddf,
+  0x6434f332, 0xcb39edca, 0x640b7543, 0xcb1d8e43,
+  0x63e1e117, 0xcb014f5b, 0x63b836ca, 0xcae53123,
+  0x638e7673, 0xcac933ae, 0x6364a02e, 0xcaad570c,
+  0x633ab414, 0xca919b4e, 0x6310b23e, 0xca760086,
+  0x62e69ac8, 0xca5a86c4, 0x62bc6dca, 0xca3f2e19,
+  0x62922b5e, 0xca23f698, 0x6267d3a0, 0xca08e04f,
+  0x623d66a8, 0xc9edeb50, 0x6212e492, 0xc9d317ab,
+  0x61e84d76, 0xc9b86572, 0x61bda171, 0xc99dd4b4,
+  0x6192e09b, 0xc9836582, 0x61680b0f, 0xc96917ec,
+  0x613d20e8, 0xc94eec03, 0x61122240, 0xc934e1d6,
+  0x60e70f32, 0xc91af976, 0x60bbe7d8, 0xc90132f2,
+  0x6090ac4d, 0xc8e78e5b, 0x60655cac, 0xc8ce0bc0,
+  0x6039f90f, 0xc8b4ab32, 0x600e8190, 0xc89b6cbf,
+  0x5fe2f64c, 0xc8825077, 0x5fb7575c, 0xc869566a,
+  0x5f8ba4dc, 0xc8507ea7, 0x5f5fdee6, 0xc837c93e,
+  0x5f340596, 0xc81f363d, 0x5f081907, 0xc806c5b5,
+  0x5edc1953, 0xc7ee77b3, 0x5eb00696, 0xc7d64c47,
+  0x5e83e0eb, 0xc7be4381, 0x5e57a86d, 0xc7a65d6e,
+  0x5e2b5d38, 0xc78e9a1d, 0x5dfeff67, 0xc776f99d,
+  0x5dd28f15, 0xc75f7bfe, 0x5da60c5d, 0xc748214c,
+  0x5d79775c, 0xc730e997, 0x5d4cd02c, 0xc719d4ed,
+  0x5d2016e9, 0xc702e35c, 0x5cf34baf, 0xc6ec14f2,
+  0x5cc66e99, 0xc6d569be, 0x5c997fc4, 0xc6bee1cd,
+  0x5c6c7f4a, 0xc6a87d2d, 0x5c3f6d47, 0xc6923bec,
+  0x5c1249d8, 0xc67c1e18, 0x5be51518, 0xc66623be,
+  0x5bb7cf23, 0xc6504ced, 0x5b8a7815, 0xc63a99b1,
+  0x5b5d100a, 0xc6250a18, 0x5b2f971e, 0xc60f9e2e,
+  0x5b020d6c, 0xc5fa5603, 0x5ad47312, 0xc5e531a1,
+  0x5aa6c82b, 0xc5d03118, 0x5a790cd4, 0xc5bb5472,
+  0x5a4b4128, 0xc5a69bbe, 0x5a1d6544, 0xc5920708,
+  0x59ef7944, 0xc57d965d, 0x59c17d44, 0xc56949ca,
+  0x59937161, 0xc555215a, 0x596555b8, 0xc5411d1b,
+  0x59372a64, 0xc52d3d18, 0x5908ef82, 0xc519815f,
+  0x58daa52f, 0xc505e9fb, 0x58ac4b87, 0xc4f276f7,
+  0x587de2a7, 0xc4df2862, 0x584f6aab, 0xc4cbfe45,
+  0x5820e3b0, 0xc4b8f8ad, 0x57f24dd3, 0xc4a617a6,
+  0x57c3a931, 0xc4935b3c, 0x5794f5e6, 0xc480c379,
+  0x5766340f, 0xc46e5069, 0x573763c9, 0xc45c0219,
+  0x57088531, 0xc449d892, 0x56d99864, 0xc437d3e1,
+  0x56aa9d7e, 0xc425f410, 0x567b949d, 0xc414392b,
+  0x564c7ddd, 0xc402a33c, 0x561d595d, 0xc3f1324e,
+  0x55ee2738, 0xc3dfe66c, 0x55bee78c, 0xc3cebfa0,
+  0x558f9a76, 0xc3bdbdf6, 0x55604013, 0xc3ace178,
+  0x5530d881, 0xc39c2a2f, 0x550163dc, 0xc38b9827,
+  0x54d1e242, 0xc37b2b6a, 0x54a253d1, 0xc36ae401,
+  0x5472b8a5, 0xc35ac1f7, 0x544310dd, 0xc34ac556,
+  0x54135c94, 0xc33aee27, 0x53e39be9, 0xc32b3c75,
+  0x53b3cefa, 0xc31bb049, 0x5383f5e3, 0xc30c49ad,
+  0x535410c3, 0xc2fd08a9, 0x53241fb6, 0xc2eded49,
+  0x52f422db, 0xc2def794, 0x52c41a4f, 0xc2d02794,
+  0x5294062f, 0xc2c17d52, 0x5263e699, 0xc2b2f8d8,
+  0x5233bbac, 0xc2a49a2e, 0x52038584, 0xc296615d,
+  0x51d3443f, 0xc2884e6e, 0x51a2f7fc, 0xc27a616a,
+  0x5172a0d7, 0xc26c9a58, 0x51423ef0, 0xc25ef943,
+  0x5111d263, 0xc2517e31, 0x50e15b4e, 0xc244292c,
+  0x50b0d9d0, 0xc236fa3b, 0x50804e06, 0xc229f167,
+  0x504fb80e, 0xc21d0eb8, 0x501f1807, 0xc2105236,
+  0x4fee6e0d, 0xc203bbe8, 0x4fbdba40, 0xc1f74bd6,
+  0x4f8cfcbe, 0xc1eb0209, 0x4f5c35a3, 0xc1dede87,
+  0x4f2b650f, 0xc1d2e158, 0x4efa8b20, 0xc1c70a84,
+  0x4ec9a7f3, 0xc1bb5a11, 0x4e98bba7, 0xc1afd007,
+  0x4e67c65a, 0xc1a46c6e, 0x4e36c82a, 0xc1992f4c,
+  0x4e05c135, 0xc18e18a7, 0x4dd4b19a, 0xc1832888,
+  0x4da39978, 0xc1785ef4, 0x4d7278eb, 0xc16dbbf3,
+  0x4d415013, 0xc1633f8a, 0x4d101f0e, 0xc158e9c1,
+  0x4cdee5f9, 0xc14eba9d, 0x4cada4f5, 0xc144b225,
+  0x4c7c5c1e, 0xc13ad060, 0x4c4b0b94, 0xc1311553,
+  0x4c19b374, 0xc1278104, 0x4be853de, 0xc11e1379,
+  0x4bb6ecef, 0xc114ccb9, 0x4b857ec7, 0xc10bacc8,
+  0x4b540982, 0xc102b3ac, 0x4b228d42, 0xc0f9e16b,
+  0x4af10a22, 0xc0f1360b, 0x4abf8043, 0xc0e8b190,
+  0x4a8defc3, 0xc0e05401, 0x4a5c58c0, 0xc0d81d61,
+  0x4a2abb59, 0xc0d00db6, 0x49f917ac, 0xc0c82506,
+  0x49c76dd8, 0xc0c06355, 0x4995bdfd, 0xc0b8c8a7,
+  0x49640837, 0xc0b15502, 0x49324ca7, 0xc0aa086a,
+  0x49008b6a, 0xc0a2e2e3, 0x48cec4a0, 0xc09be473,
+  0x489cf867, 0xc0950d1d, 0x486b26de, 0xc08e5ce5,
+  0x48395024, 0xc087d3d0, 0x48077457, 0xc08171e2,
+  0x47d59396, 0xc07b371e, 0x47a3adff, 0xc0752389,
+  0x4771c3b3, 0xc06f3726, 0x473fd4cf, 0xc06971f9,
+  0x470de172, 0xc063d405, 0x46dbe9bb, 0xc05e5d4e,
+  0x46a9edc9, 0xc0590dd8, 0x4677edbb, 0xc053e5a5,
+  0x4645e9af, 0xc04ee4b8, 0x4613e1c5, 0xc04a0b16,
+  0x45e1d61b, 0xc04558c0, 0x45afc6d0, 0xc040cdba,
+  0x457db403, 0xc03c6a07, 0x454b9dd3, 0xc0382da8,
+  0x4519845e, 0xc03418a2, 0x44e767c5, 0xc0302af5,
+  0x44b54825, 0xc02c64a6, 0x4483259d, 0xc028c5b6,
+  0x4451004d, 0xc0254e27, 0x441ed854, 0xc021fdfb,
+  0x43ecadcf, 0xc01ed535, 0x43ba80df, 0xc01bd3d6,
+  0x438851a2, 0xc018f9e1, 0x43562038, 0xc0164757,
+  0x4323ecbe, 0xc013bc39, 0x42f1b755, 0xc011588a,
+  0x42bf801a, 0xc00f1c4a, 0x428d472e, 0xc00d077c,
+  0x425b0caf, 0xc00b1a20, 0x4228d0bb, 0xc0095438,
+  0x41f69373, 0xc007b5c4, 0x41c454f5, 0xc0063ec6,
+  0x4192155f, 0xc004ef3f, 0x415fd4d2, 0xc003c72f,
+  0x412d936c, 0xc002c697, 0x40fb514b, 0xc001ed78,
+  0x40c90e90, 0xc0013bd3, 0x4096cb58, 0xc000b1a7,
+  0x406487c4, 0xc0004ef5, 0x403243f1, 0xc00013bd
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 256)
+
+static const q31_t realCoefBQ31[512] = {
+  0x40000000, 0x40000000, 0x40c90e90, 0x3ffec42d,
+  0x4192155f, 0x3ffb10c1, 0x425b0caf, 0x3ff4e5e0,
+  0x4323ecbe, 0x3fec43c7, 0x43ecadcf, 0x3fe12acb,
+  0x44b54825, 0x3fd39b5a, 0x457db403, 0x3fc395f9,
+  0x4645e9af, 0x3fb11b48, 0x470de172, 0x3f9c2bfb,
+  0x47d59396, 0x3f84c8e2, 0x489cf867, 0x3f6af2e3,
+  0x49640837, 0x3f4eaafe, 0x4a2abb59, 0x3f2ff24a,
+  0x4af10a22, 0x3f0ec9f5, 0x4bb6ecef, 0x3eeb3347,
+  0x4c7c5c1e, 0x3ec52fa0, 0x4d415013, 0x3e9cc076,
+  0x4e05c135, 0x3e71e759, 0x4ec9a7f3, 0x3e44a5ef,
+  0x4f8cfcbe, 0x3e14fdf7, 0x504fb80e, 0x3de2f148,
+  0x5111d263, 0x3dae81cf, 0x51d3443f, 0x3d77b192,
+  0x5294062f, 0x3d3e82ae, 0x535410c3, 0x3d02f757,
+  0x54135c94, 0x3cc511d9, 0x54d1e242, 0x3c84d496,
+  0x558f9a76, 0x3c42420a, 0x564c7ddd, 0x3bfd5cc4,
+  0x57088531, 0x3bb6276e, 0x57c3a931, 0x3b6ca4c4,
+  0x587de2a7, 0x3b20d79e, 0x59372a64, 0x3ad2c2e8,
+  0x59ef7944, 0x3a8269a3, 0x5aa6c82b, 0x3a2fcee8,
+  0x5b5d100a, 0x39daf5e8, 0x5c1249d8, 0x3983e1e8,
+  0x5cc66e99, 0x392a9642, 0x5d79775c, 0x38cf1669,
+  0x5e2b5d38, 0x387165e3, 0x5edc1953, 0x3811884d,
+  0x5f8ba4dc, 0x37af8159, 0x6039f90f, 0x374b54ce,
+  0x60e70f32, 0x36e5068a, 0x6192e09b, 0x367c9a7e,
+  0x623d66a8, 0x361214b0, 0x62e69ac8, 0x35a5793c,
+  0x638e7673, 0x3536cc52, 0x6434f332, 0x34c61236,
+  0x64da0a9a, 0x34534f41, 0x657db64c, 0x33de87de,
+  0x661feffa, 0x3367c090, 0x66c0b162, 0x32eefdea,
+  0x675ff452, 0x32744493, 0x67fdb2a7, 0x31f79948,
+  0x6899e64a, 0x317900d6, 0x69348937, 0x30f8801f,
+  0x69cd9578, 0x30761c18, 0x6a650525, 0x2ff1d9c7,
+  0x6afad269, 0x2f6bbe45, 0x6b8ef77d, 0x2ee3cebe,
+  0x6c216eaa, 0x2e5a1070, 0x6cb2324c, 0x2dce88aa,
+  0x6d413ccd, 0x2d413ccd, 0x6dce88aa, 0x2cb2324c,
+  0x6e5a1070, 0x2c216eaa, 0x6ee3cebe, 0x2b8ef77d,
+  0x6f6bbe45, 0x2afad269, 0x6ff1d9c7, 0x2a650525,
+  0x70761c18, 0x29cd9578, 0x70f8801f, 0x29348937,
+  0x717900d6, 0x2899e64a, 0x71f79948, 0x27fdb2a7,
+  0x72744493, 0x275ff452, 0x72eefdea, 0x26c0b162,
+  0x7367c090, 0x261feffa, 0x73de87de, 0x257db64c,
+  0x74534f41, 0x24da0a9a, 0x74c61236, 0x2434f332,
+  0x7536cc52, 0x238e7673, 0x75a5793c, 0x22e69ac8,
+  0x761214b0, 0x223d66a8, 0x767c9a7e, 0x2192e09b,
+  0x76e5068a, 0x20e70f32, 0x774b54ce, 0x2039f90f,
+  0x77af8159, 0x1f8ba4dc, 0x7811884d, 0x1edc1953,
+  0x787165e3, 0x1e2b5d38, 0x78cf1669, 0x1d79775c,
+  0x792a9642, 0x1cc66e99, 0x7983e1e8, 0x1c1249d8,
+  0x79daf5e8, 0x1b5d100a, 0x7a2fcee8, 0x1aa6c82b,
+  0x7a8269a3, 0x19ef7944, 0x7ad2c2e8, 0x19372a64,
+  0x7b20d79e, 0x187de2a7, 0x7b6ca4c4, 0x17c3a931,
+  0x7bb6276e, 0x17088531, 0x7bfd5cc4, 0x164c7ddd,
+  0x7c42420a, 0x158f9a76, 0x7c84d496, 0x14d1e242,
+  0x7cc511d9, 0x14135c94, 0x7d02f757, 0x135410c3,
+  0x7d3e82ae, 0x1294062f, 0x7d77b192, 0x11d3443f,
+  0x7dae81cf, 0x1111d263, 0x7de2f148, 0x104fb80e,
+  0x7e14fdf7, 0xf8cfcbe, 0x7e44a5ef, 0xec9a7f3,
+  0x7e71e759, 0xe05c135, 0x7e9cc076, 0xd415013,
+  0x7ec52fa0, 0xc7c5c1e, 0x7eeb3347, 0xbb6ecef,
+  0x7f0ec9f5, 0xaf10a22, 0x7f2ff24a, 0xa2abb59,
+  0x7f4eaafe, 0x9640837, 0x7f6af2e3, 0x89cf867,
+  0x7f84c8e2, 0x7d59396, 0x7f9c2bfb, 0x70de172,
+  0x7fb11b48, 0x645e9af, 0x7fc395f9, 0x57db403,
+  0x7fd39b5a, 0x4b54825, 0x7fe12acb, 0x3ecadcf,
+  0x7fec43c7, 0x323ecbe, 0x7ff4e5e0, 0x25b0caf,
+  0x7ffb10c1, 0x192155f, 0x7ffec42d, 0xc90e90,
+  0x7fffffff, 0x0, 0x7ffec42d, 0xff36f170,
+  0x7ffb10c1, 0xfe6deaa1, 0x7ff4e5e0, 0xfda4f351,
+  0x7fec43c7, 0xfcdc1342, 0x7fe12acb, 0xfc135231,
+  0x7fd39b5a, 0xfb4ab7db, 0x7fc395f9, 0xfa824bfd,
+  0x7fb11b48, 0xf9ba1651, 0x7f9c2bfb, 0xf8f21e8e,
+  0x7f84c8e2, 0xf82a6c6a, 0x7f6af2e3, 0xf7630799,
+  0x7f4eaafe, 0xf69bf7c9, 0x7f2ff24a, 0xf5d544a7,
+  0x7f0ec9f5, 0xf50ef5de, 0x7eeb3347, 0xf4491311,
+  0x7ec52fa0, 0xf383a3e2, 0x7e9cc076, 0xf2beafed,
+  0x7e71e759, 0xf1fa3ecb, 0x7e44a5ef, 0xf136580d,
+  0x7e14fdf7, 0xf0730342, 0x7de2f148, 0xefb047f2,
+  0x7dae81cf, 0xeeee2d9d, 0x7d77b192, 0xee2cbbc1,
+  0x7d3e82ae, 0xed6bf9d1, 0x7d02f757, 0xecabef3d,
+  0x7cc511d9, 0xebeca36c, 0x7c84d496, 0xeb2e1dbe,
+  0x7c42420a, 0xea70658a, 0x7bfd5cc4, 0xe9b38223,
+  0x7bb6276e, 0xe8f77acf, 0x7b6ca4c4, 0xe83c56cf,
+  0x7b20d79e, 0xe7821d59, 0x7ad2c2e8, 0xe6c8d59c,
+  0x7a8269a3, 0xe61086bc, 0x7a2fcee8, 0xe55937d5,
+  0x79daf5e8, 0xe4a2eff6, 0x7983e1e8, 0xe3edb628,
+  0x792a9642, 0xe3399167, 0x78cf1669, 0xe28688a4,
+  0x787165e3, 0xe1d4a2c8, 0x7811884d, 0xe123e6ad,
+  0x77af8159, 0xe0745b24, 0x774b54ce, 0xdfc606f1,
+  0x76e5068a, 0xdf18f0ce, 0x767c9a7e, 0xde6d1f65,
+  0x761214b0, 0xddc29958, 0x75a5793c, 0xdd196538,
+  0x7536cc52, 0xdc71898d, 0x74c61236, 0xdbcb0cce,
+  0x74534f41, 0xdb25f566, 0x73de87de, 0xda8249b4,
+  0x7367c090, 0xd9e01006, 0x72eefdea, 0xd93f4e9e,
+  0x72744493, 0xd8a00bae, 0x71f79948, 0xd8024d59,
+  0x717900d6, 0xd76619b6, 0x70f8801f, 0xd6cb76c9,
+  0x70761c18, 0xd6326a88, 0x6ff1d9c7, 0xd59afadb,
+  0x6f6bbe45, 0xd5052d97, 0x6ee3cebe, 0xd4710883,
+  0x6e5a1070, 0xd3de9156, 0x6dce88aa, 0xd34dcdb4,
+  0x6d413ccd, 0xd2bec333, 0x6cb2324c, 0xd2317756,
+  0x6c216eaa, 0xd1a5ef90, 0x6b8ef77d, 0xd11c3142,
+  0x6afad269, 0xd09441bb, 0x6a650525, 0xd00e2639,
+  0x69cd9578, 0xcf89e3e8, 0x69348937, 0xcf077fe1,
+  0x6899e64a, 0xce86ff2a, 0x67fdb2a7, 0xce0866b8,
+  0x675ff452, 0xcd8bbb6d, 0x66c0b162, 0xcd110216,
+  0x661feffa, 0xcc983f70, 0x657db64c, 0xcc217822,
+  0x64da0a9a, 0xcbacb0bf, 0x6434f332, 0xcb39edca,
+  0x638e7673, 0xcac933ae, 0x62e69ac8, 0xca5a86c4,
+  0x623d66a8, 0xc9edeb50, 0x6192e09b, 0xc9836582,
+  0x60e70f32, 0xc91af976, 0x6039f90f, 0xc8b4ab32,
+  0x5f8ba4dc, 0xc8507ea7, 0x5edc1953, 0xc7ee77b3,
+  0x5e2b5d38, 0xc78e9a1d, 0x5d79775c, 0xc730e997,
+  0x5cc66e99, 0xc6d569be, 0x5c1249d8, 0xc67c1e18,
+  0x5b5d100a, 0xc6250a18, 0x5aa6c82b, 0xc5d03118,
+  0x59ef7944, 0xc57d965d, 0x59372a64, 0xc52d3d18,
+  0x587de2a7, 0xc4df2862, 0x57c3a931, 0xc4935b3c,
+  0x57088531, 0xc449d892, 0x564c7ddd, 0xc402a33c,
+  0x558f9a76, 0xc3bdbdf6, 0x54d1e242, 0xc37b2b6a,
+  0x54135c94, 0xc33aee27, 0x535410c3, 0xc2fd08a9,
+  0x5294062f, 0xc2c17d52, 0x51d3443f, 0xc2884e6e,
+  0x5111d263, 0xc2517e31, 0x504fb80e, 0xc21d0eb8,
+  0x4f8cfcbe, 0xc1eb0209, 0x4ec9a7f3, 0xc1bb5a11,
+  0x4e05c135, 0xc18e18a7, 0x4d415013, 0xc1633f8a,
+  0x4c7c5c1e, 0xc13ad060, 0x4bb6ecef, 0xc114ccb9,
+  0x4af10a22, 0xc0f1360b, 0x4a2abb59, 0xc0d00db6,
+  0x49640837, 0xc0b15502, 0x489cf867, 0xc0950d1d,
+  0x47d59396, 0xc07b371e, 0x470de172, 0xc063d405,
+  0x4645e9af, 0xc04ee4b8, 0x457db403, 0xc03c6a07,
+  0x44b54825, 0xc02c64a6, 0x43ecadcf, 0xc01ed535,
+  0x4323ecbe, 0xc013bc39, 0x425b0caf, 0xc00b1a20,
+  0x4192155f, 0xc004ef3f, 0x40c90e90, 0xc0013bd3
+};
+
+#elif (ARM_MATH_MAX_FFT_LEN == 64)
+
+static const q31_t realCoefBQ31[128] = {
+  0x40000000, 0x40000000, 0x4323ecbe, 0x3fec43c7,
+  0x4645e9af, 0x3fb11b48, 0x49640837, 0x3f4eaafe,
+  0x4c7c5c1e, 0x3ec52fa0, 0x4f8cfcbe, 0x3e14fdf7,
+  0x5294062f, 0x3d3e82ae, 0x558f9a76, 0x3c42420a,
+  0x587de2a7, 0x3b20d79e, 0x5b5d100a, 0x39daf5e8,
+  0x5e2b5d38, 0x387165e3, 0x60e70f32, 0x36e5068a,
+  0x638e7673, 0x3536cc52, 0x661feffa, 0x3367c090,
+  0x6899e64a, 0x317900d6, 0x6afad269, 0x2f6bbe45,
+  0x6d413ccd, 0x2d413ccd, 0x6f6bbe45, 0x2afad269,
+  0x717900d6, 0x2899e64a, 0x7367c090, 0x261feffa,
+  0x7536cc52, 0x238e7673, 0x76e5068a, 0x20e70f32,
+  0x787165e3, 0x1e2b5d38, 0x79daf5e8, 0x1b5d100a,
+  0x7b20d79e, 0x187de2a7, 0x7c42420a, 0x158f9a76,
+  0x7d3e82ae, 0x1294062f, 0x7e14fdf7, 0xf8cfcbe,
+  0x7ec52fa0, 0xc7c5c1e, 0x7f4eaafe, 0x9640837,
+  0x7fb11b48, 0x645e9af, 0x7fec43c7, 0x323ecbe,
+  0x7fffffff, 0x0, 0x7fec43c7, 0xfcdc1342,
+  0x7fb11b48, 0xf9ba1651, 0x7f4eaafe, 0xf69bf7c9,
+  0x7ec52fa0, 0xf383a3e2, 0x7e14fdf7, 0xf0730342,
+  0x7d3e82ae, 0xed6bf9d1, 0x7c42420a, 0xea70658a,
+  0x7b20d79e, 0xe7821d59, 0x79daf5e8, 0xe4a2eff6,
+  0x787165e3, 0xe1d4a2c8, 0x76e5068a, 0xdf18f0ce,
+  0x7536cc52, 0xdc71898d, 0x7367c090, 0xd9e01006,
+  0x717900d6, 0xd76619b6, 0x6f6bbe45, 0xd5052d97,
+  0x6d413ccd, 0xd2bec333, 0x6afad269, 0xd09441bb,
+  0x6899e64a, 0xce86ff2a, 0x661feffa, 0xcc983f70,
+  0x638e7673, 0xcac933ae, 0x60e70f32, 0xc91af976,
+  0x5e2b5d38, 0xc78e9a1d, 0x5b5d100a, 0xc6250a18,
+  0x587de2a7, 0xc4df2862, 0x558f9a76, 0xc3bdbdf6,
+  0x5294062f, 0xc2c17d52, 0x4f8cfcbe, 0xc1eb0209,
+  0x4c7c5c1e, 0xc13ad060, 0x49640837, 0xc0b15502,
+  0x4645e9af, 0xc04ee4b8, 0x4323ecbe, 0xc013bc39
+};
+
+#endif
+
 /**    
 * @brief  Initialization function for the Q31 RFFT/RIFFT.   
 * @param[in, out] *S             points to an instance of the Q31 RFFT/RIFFT structure.   
@@ -4190,7 +5573,7 @@ static const q31_t realCoefBQ31[8192] = {
 *    
 * \par Description:   
 * \par   
-* The parameter <code>fftLenReal</code>	Specifies length of RFFT/RIFFT Process. Supported FFT Lengths are 128, 512, 2048.    
+* The parameter <code>fftLenReal</code>	Specifies length of RFFT/RIFFT Process. Supported FFT Lengths are 128, 512, 2048, 8192, up to twice ARM_MATH_MAX_FFT_LEN.    
 * \par    
 * The parameter <code>ifftFlagR</code> controls whether a forward or inverse transform is computed.    
 * Set(=1) ifftFlagR to calculate RIFFT, otherwise RFFT is calculated.    
@@ -4217,11 +5600,13 @@ arm_status arm_rfft_init_q31(
   /*  Initialize the Complex FFT length */
   S->fftLenBy2 = (uint16_t) fftLenReal / 2u;
 
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   /*  Initialize the Twiddle coefficientA pointer */
   S->pTwiddleAReal = (q31_t *) realCoefAQ31;
 
   /*  Initialize the Twiddle coefficientB pointer */
   S->pTwiddleBReal = (q31_t *) realCoefBQ31;
+#endif
 
   /*  Initialize the Flag for selection of RFFT or RIFFT */
   S->ifftFlagR = (uint8_t) ifftFlagR;
@@ -4232,18 +5617,26 @@ arm_status arm_rfft_init_q31(
   /*  Initialization of coef modifier depending on the FFT length */
   switch (S->fftLenReal)
   {
-  case 8192:
-    S->twidCoefRModifier = 1u;
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
+  case 8192u:
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(8192u);
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
   case 2048u:
-    S->twidCoefRModifier = 4u;
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(2048u);
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 256)
   case 512u:
-    S->twidCoefRModifier = 16u;
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(512u);
     break;
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 64)
   case 128u:
-    S->twidCoefRModifier = 64u;
+    S->twidCoefRModifier = ARM_RFFT_TABLE_STRIDE(128u);
     break;
+#endif
   default:
     /*  Reporting argument error if rfftSize is not valid value */
     status = ARM_MATH_ARGUMENT_ERROR;
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sdft_f32.c
+*
+* Description:	Floating point multi-bin sliding DFT process function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SDFT Sliding DFT
+ *
+ * \par
+ * The sliding DFT updates selected bins of the N point DFT of the last N samples at every
+ * sample, where the Goertzel algorithm gives them once per block of N samples. Each new
+ * sample costs one complex multiplication per bin:
+ * <pre>
+ *    X[k] = (X[k] + x[n] - x[n-N]) * exp(j*2*pi*k/N)
+ * </pre>
+ * so that after each call the bins hold the DFT of the window ending at the last sample:
+ * <pre>
+ *    X[k] = sum(x[n-N+1+m] * exp(-j*2*pi*k*m/N)), m = 0 to N-1
+ * </pre>
+ *
+ * \par
+ * The samples of the window are kept in a circular delay line of N samples. The bins are
+ * kept in the state buffer, in complex interleaved form, and are read there after each call.
+ * The process function runs the bins one after the other over the whole block, the bin
+ * in registers, and updates the delay line last.
+ *
+ * \par Instance Structure
+ * The twiddles are the complex exponentials <code>exp(j*2*pi*k/N)</code> of the bins, in
+ * interleaved form {cos, sin}, one pair per bin, k an integer from 0 to N-1. A separate
+ * instance structure must be defined for each set of bins, initialized by the init function
+ * of the data type.
+ *
+ * \par
+ * The floating-point recursion adds the rounding errors of all the samples: reinitialize the
+ * instance now and then when it runs for long periods. With Q15 twiddles rounded to a
+ * magnitude just below one, the Q15 recursion is slightly damped and its errors stay bounded.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 input is shifted right by log2(N), rounded up, so that the bins hold the DFT
+ * divided by <code>2^shift</code> in 1.15 format and cannot overflow.
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize)
+{
+  const float32_t *pIn;
+  float32_t *pState = S->pState;
+  float32_t *pDelay = S->pDelay;
+  float32_t re, im, a, c, s, old;
+  uint32_t fftLen = S->fftLen;
+  uint32_t i, n, j;
+
+  /*  One bin after the other, over the whole block */
+  for (i = 0u; i < S->numBins; i++)
+  {
+    c = S->pTwiddle[2u * i];
+    s = S->pTwiddle[(2u * i) + 1u];
+    re = pState[0];
+    im = pState[1];
+    pIn = pSrc;
+    j = S->delayIndex;
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      /*  x[n-N], from the delay line or from the block itself */
+      if(n < fftLen)
+      {
+        old = pDelay[j];
+        j = (j == (fftLen - 1u)) ? 0u : (j + 1u);
+      }
+      else
+      {
+        old = pSrc[n - fftLen];
+      }
+
+      /*  X = (X + x[n] - x[n-N]) * W */
+      a = re + (*pIn++ - old);
+      re = (a * c) - (im * s);
+      im = (a * s) + (im * c);
+    }
+
+    pState[0] = re;
+    pState[1] = im;
+    pState += 2u;
+  }
+
+  /*  The block enters the delay line */
+  j = S->delayIndex;
+  for (n = 0u; n < blockSize; n++)
+  {
+    pDelay[j] = pSrc[n];
+    j = (j == (fftLen - 1u)) ? 0u : (j + 1u);
+  }
+
+  S->delayIndex = (uint16_t) j;
+}
+
+/**
+ * @} end of SDFT group
+ */
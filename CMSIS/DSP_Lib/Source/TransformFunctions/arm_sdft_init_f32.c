@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sdft_init_f32.c
+*
+* Description:	Floating point sliding DFT initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding DFT.
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     fftLen     length N of the DFT window, 2 or more.
+ * @param[in]     numBins    number of bins.
+ * @param[in]     *pTwiddle  points to the twiddles {cos, sin} of the bins, <code>2*numBins</code> values.
+ * @param[in]     *pDelay    points to the delay line of <code>fftLen</code> samples.
+ * @param[in]     *pState    points to the bins, <code>2*numBins</code> values.
+ * @return none.
+ *
+ * \par
+ * The delay line and the bins are cleared.
+ */
+
+void arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const float32_t * pTwiddle,
+  float32_t * pDelay,
+  float32_t * pState)
+{
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->delayIndex = 0u;
+  S->pTwiddle = pTwiddle;
+  S->pDelay = pDelay;
+  S->pState = pState;
+
+  /*  Clear the delay line and the bins */
+  memset(pDelay, 0, fftLen * sizeof(float32_t));
+  memset(pState, 0, 2u * numBins * sizeof(float32_t));
+}
+
+/**
+ * @} end of SDFT group
+ */
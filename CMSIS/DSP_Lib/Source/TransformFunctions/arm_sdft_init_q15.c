@@ -0,0 +1,69 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sdft_init_q15.c
+*
+* Description:	Q15 sliding DFT initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 sliding DFT.
+ * @param[in,out] *S         points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     fftLen     length N of the DFT window, 2 or more.
+ * @param[in]     numBins    number of bins.
+ * @param[in]     *pTwiddle  points to the twiddles {cos, sin} of the bins, <code>2*numBins</code> values.
+ * @param[in]     *pDelay    points to the delay line of <code>fftLen</code> samples.
+ * @param[in]     *pState    points to the bins, <code>2*numBins</code> values.
+ * @return none.
+ *
+ * \par
+ * The delay line and the bins are cleared.
+ */
+
+void arm_sdft_init_q15(
+  arm_sdft_instance_q15 * S,
+  uint16_t fftLen,
+  uint16_t numBins,
+  const q15_t * pTwiddle,
+  q15_t * pDelay,
+  q15_t * pState)
+{
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->delayIndex = 0u;
+  S->pTwiddle = pTwiddle;
+  S->pDelay = pDelay;
+  S->pState = pState;
+
+  /*  Input shift, log2(fftLen) rounded up */
+  S->shift = 0u;
+  while((1u << S->shift) < fftLen)
+  {
+    S->shift++;
+  }
+
+  /*  Clear the delay line and the bins */
+  memset(pDelay, 0, fftLen * sizeof(q15_t));
+  memset(pState, 0, 2u * numBins * sizeof(q15_t));
+}
+
+/**
+ * @} end of SDFT group
+ */
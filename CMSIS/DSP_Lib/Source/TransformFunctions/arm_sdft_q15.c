@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_sdft_q15.c
+*
+* Description:	Q15 multi-bin sliding DFT process function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 sliding DFT.
+ * @param[in,out] *S         points to an instance of the Q15 sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The samples are shifted right by <code>shift</code> bits, log2(N) rounded up, and
+ * the bins are kept in 1.15 format: the DFT divided by <code>2^shift</code>. The rotation
+ * is computed with the dual 16-bit multiplications on the packed bin, the products in
+ * 2.30 format truncated back to 1.15.
+ */
+
+void arm_sdft_q15(
+  arm_sdft_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q15_t *pIn;
+  const q15_t *pTw = S->pTwiddle;
+  q15_t *pState = S->pState;
+  q15_t *pDelay = S->pDelay;
+  q15_t old;
+  q31_t d;
+  uint32_t shift = S->shift;
+  uint32_t fftLen = S->fftLen;
+  uint32_t i, n, j;
+
+#ifndef ARM_MATH_CM0
+  q31_t x, w, re, im;
+#else
+  q31_t a, b, c, s;
+#endif
+
+  /*  One bin after the other, over the whole block */
+  for (i = 0u; i < S->numBins; i++)
+  {
+#ifndef ARM_MATH_CM0
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /*  The bin and its twiddle, packed */
+    x = *__SIMD32(pState);
+    w = *__SIMD32(pTw);
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    a = pState[0];
+    b = pState[1];
+    c = pTw[0];
+    s = pTw[1];
+
+#endif /* #ifndef ARM_MATH_CM0 */
+
+    pIn = pSrc;
+    j = S->delayIndex;
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      /*  x[n-N], from the delay line or from the block itself */
+      if(n < fftLen)
+      {
+        old = pDelay[j];
+        j = (j == (fftLen - 1u)) ? 0u : (j + 1u);
+      }
+      else
+      {
+        old = pSrc[n - fftLen];
+      }
+
+      d = ((q31_t) * pIn++ >> shift) - ((q31_t) old >> shift);
+
+#ifndef ARM_MATH_CM0
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+      /*  Real part in the lower half: re = a*c - b*s, im = a*s + b*c */
+      x = __QADD16(x, d & 0x0000FFFF);
+      re = __SMUSD(x, w) >> 15;
+      im = __SMUADX(x, w) >> 15;
+      x = __PKHBT(re, im, 16);
+
+#else
+
+      /*  Real part in the upper half: the difference of the halves is negated */
+      x = __QADD16(x, d << 16);
+      re = -(__SMUSD(x, w) >> 15);
+      im = __SMUADX(x, w) >> 15;
+      x = __PKHBT(im, re, 16);
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+#else
+
+      a = __SSAT(a + d, 16);
+      d = (a * c - b * s) >> 15;
+      b = (a * s + b * c) >> 15;
+      a = d;
+
+#endif /* #ifndef ARM_MATH_CM0 */
+    }
+
+#ifndef ARM_MATH_CM0
+    *__SIMD32(pState) = x;
+#else
+    pState[0] = (q15_t) a;
+    pState[1] = (q15_t) b;
+#endif
+
+    pState += 2u;
+    pTw += 2u;
+  }
+
+  /*  The block enters the delay line */
+  j = S->delayIndex;
+  for (n = 0u; n < blockSize; n++)
+  {
+    pDelay[j] = pSrc[n];
+    j = (j == (fftLen - 1u)) ? 0u : (j + 1u);
+  }
+
+  S->delayIndex = (uint16_t) j;
+}
+
+/**
+ * @} end of SDFT group
+ */
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stft_f32.c
+*
+* Description:	Floating point Short Time Fourier Transform process function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup STFT Short Time Fourier Transform
+ *
+ * \par
+ * The Short Time Fourier Transform (STFT) cuts a stream of samples into overlapping frames
+ * of <code>fftLen</code> samples, one every <code>hopSize</code> samples, multiplies each
+ * frame by a window and gives the magnitude or power spectrum of each frame: the columns
+ * of a spectrogram.
+ *
+ * \par
+ * The samples are written to a circular state buffer of <code>fftLen</code> samples
+ * with arm_circularWrite_f32(), in blocks of any size. When <code>hopSize</code> new samples
+ * are in, the frame is read from the oldest sample on and multiplied by the window in the same
+ * pass, into the scratch buffer where the in-place real FFT (arm_rfft_fast_f32()) runs, and the
+ * split step of the FFT computes the magnitudes or the powers directly
+ * (arm_rfft_fast_mag_f32(), arm_rfft_fast_power_f32()). A frame costs two passes besides the
+ * FFT stages, where a copy, arm_mult_f32(), the FFT and arm_cmplx_mag_f32() take four, and
+ * no buffer holds the complex spectrum.
+ *
+ * \par
+ * Each frame gives <code>fftLen/2</code> values, the bins 0 to fftLen/2-1. The state
+ * buffer starts with zeros: the first frames hold the beginning of the stream at their end.
+ *
+ * \par Instance Structure
+ * A separate instance structure must be defined for each stream, initialized by
+ * arm_stft_init_f32(). The window is a table of <code>fftLen</code> coefficients given by
+ * the application, a Hann window for example.
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point STFT.
+ * @param[in,out] *S         points to an instance of the floating-point STFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process, any number.
+ * @param[out]    *pDst      points to the frames, <code>fftLen/2</code> values each.
+ * @return The number of frames written to <code>pDst</code>.
+ *
+ * \par
+ * <code>pDst</code> must hold <code>blockSize/hopSize + 1</code> frames.
+ */
+
+uint32_t arm_stft_f32(
+  arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  const float32_t *pWin;
+  float32_t *pIn, *pOut;
+  uint32_t frames = 0u;
+  uint32_t blkCnt, i, tail;
+
+  while(blockSize > 0u)
+  {
+    /*  Samples up to the next frame */
+    blkCnt = (uint32_t) S->hopSize - S->count;
+    if(blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+
+    arm_circularWrite_f32((int32_t *) S->pState, (int32_t) S->fftLen,
+                          &S->writeOffset, 1, (const int32_t *) pSrc, 1, blkCnt);
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->count += (uint16_t) blkCnt;
+
+    if(S->count == S->hopSize)
+    {
+      S->count = 0u;
+
+      /*  Windowed copy of the frame, the oldest sample at writeOffset */
+      pWin = S->pWindow;
+      pOut = S->pScratch;
+      pIn = S->pState + S->writeOffset;
+      tail = (uint32_t) S->fftLen - S->writeOffset;
+
+      for (i = 0u; i < tail; i++)
+      {
+        *pOut++ = *pIn++ * *pWin++;
+      }
+
+      pIn = S->pState;
+      for (i = tail; i < S->fftLen; i++)
+      {
+        *pOut++ = *pIn++ * *pWin++;
+      }
+
+      /*  FFT and split step computing the frame */
+      if(S->powerFlag == 1u)
+      {
+        arm_rfft_fast_power_f32(&S->Srfft, S->pScratch, pDst);
+      }
+      else
+      {
+        arm_rfft_fast_mag_f32(&S->Srfft, S->pScratch, pDst);
+      }
+
+      pDst += (S->fftLen >> 1u);
+      frames++;
+    }
+  }
+
+  return (frames);
+}
+
+/**
+ * @} end of STFT group
+ */
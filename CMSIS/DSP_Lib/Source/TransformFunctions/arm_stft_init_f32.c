@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_stft_init_f32.c
+*
+* Description:	Floating point Short Time Fourier Transform initialization function
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup STFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point STFT.
+ * @param[in,out] *S         points to an instance of the floating-point STFT structure.
+ * @param[in]     fftLen     length of the frames and of the real FFT.
+ * @param[in]     hopSize    number of samples between two frames, 1 to <code>fftLen</code>.
+ * @param[in]     *pWindow   points to the window, <code>fftLen</code> coefficients.
+ * @param[in]     *pState    points to the state buffer of <code>fftLen</code> samples.
+ * @param[in]     *pScratch  points to the scratch buffer of <code>fftLen</code> values.
+ * @param[in]     powerFlag  selects the magnitude (powerFlag=0) or the power (powerFlag=1) output.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> or <code>hopSize</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * Supported FFT Lengths are those of arm_rfft_fast_init_f32(): 32, 64, 128, 256, 512, 1024, 2048, 4096.
+ * The state buffer is cleared. The scratch buffer may be shared between the instances
+ * processed from the same context.
+ */
+
+arm_status arm_stft_init_f32(
+  arm_stft_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t hopSize,
+  const float32_t * pWindow,
+  float32_t * pState,
+  float32_t * pScratch,
+  uint8_t powerFlag)
+{
+  arm_status status;
+
+  /*  Internal real FFT, checking the length */
+  status = arm_rfft_fast_init_f32(&S->Srfft, fftLen);
+
+  if((hopSize == 0u) || (hopSize > fftLen))
+  {
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->writeOffset = 0u;
+  S->count = 0u;
+  S->powerFlag = powerFlag;
+  S->pWindow = pWindow;
+  S->pState = pState;
+  S->pScratch = pScratch;
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+    /*  Clear the state buffer */
+    memset(pState, 0, fftLen * sizeof(float32_t));
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of STFT group
+ */
@@ -26,10 +26,121 @@
  
 #include "arm_math.h" 
  
-extern uint16_t armBitRevTable[256]; 
-extern q15_t armRecipTableQ15[64]; 
-extern q31_t armRecipTableQ31[64]; 
-extern const q31_t realCoefAQ31[1024];
-extern const q31_t realCoefBQ31[1024];
+#if (ARM_MATH_MAX_FFT_LEN != 4096) && (ARM_MATH_MAX_FFT_LEN != 1024) && \
+    (ARM_MATH_MAX_FFT_LEN != 256) && (ARM_MATH_MAX_FFT_LEN != 64) && (ARM_MATH_MAX_FFT_LEN != 16)
+#error "ARM_MATH_MAX_FFT_LEN must be 16, 64, 256, 1024 or 4096"
+#endif
+
+/* Tables of the radix-2 and radix-4 CFFTs, shared by the lengths up to ARM_MATH_MAX_FFT_LEN
+   with the stride ARM_TABLE_STRIDE(fftLen): 3/4 of a period of twiddles, and the bit reversal
+   indexes of the largest length, the table of a length starting at index ARM_TABLE_STRIDE(fftLen) - 1 */
+#define ARM_TWIDDLE_TABLE_LEN		(3u * ARM_MATH_MAX_FFT_LEN / 2u)
+#define ARM_BITREV_TABLE_LEN		(ARM_MATH_MAX_FFT_LEN / 4u)
+#define ARM_TABLE_STRIDE(fftLen)	(ARM_MATH_MAX_FFT_LEN / (fftLen))
+
+/* Tables of the real FFTs of arm_rfft_init_q15/q31/f32.c, up to twice ARM_MATH_MAX_FFT_LEN real points */
+#define ARM_RFFT_TABLE_LEN		(2u * ARM_MATH_MAX_FFT_LEN)
+#define ARM_RFFT_TABLE_STRIDE(fftLenReal)	((2u * ARM_MATH_MAX_FFT_LEN) / (fftLenReal))
+
+extern const uint16_t armBitRevTable[ARM_BITREV_TABLE_LEN]; 
+extern const q15_t armRecipTableQ15[64]; 
+extern const q31_t armRecipTableQ31[64]; 
+extern const float32_t twiddleCoef[ARM_TWIDDLE_TABLE_LEN];
+extern const q31_t twiddleCoefQ31[ARM_TWIDDLE_TABLE_LEN];
+extern const q15_t twiddleCoefQ15[ARM_TWIDDLE_TABLE_LEN];
+
+/* Mixed radix floating-point CFFT, see arm_cfft_init_f32.c: ARM_CFFT_TWIDDLE_<fftLen> is the
+   twiddle table of a length, the tail of the table of the length eight times longer */
+#if (ARM_MATH_MAX_FFT_LEN >= 1024)
+extern const float32_t twiddleCoef_1024[2002];
+#define ARM_CFFT_TWIDDLE_1024		(twiddleCoef_1024)
+#define ARM_CFFT_TWIDDLE_128		(&twiddleCoef_1024[1778])
+#define ARM_CFFT_TWIDDLE_16		(&twiddleCoef_1024[1988])
+#elif (ARM_MATH_MAX_FFT_LEN >= 128)
+extern const float32_t twiddleCoef_128[224];
+#define ARM_CFFT_TWIDDLE_128		(twiddleCoef_128)
+#define ARM_CFFT_TWIDDLE_16		(&twiddleCoef_128[210])
+#elif (ARM_MATH_MAX_FFT_LEN >= 16)
+extern const float32_t twiddleCoef_16[14];
+#define ARM_CFFT_TWIDDLE_16		(twiddleCoef_16)
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
+extern const float32_t twiddleCoef_2048[4046];
+#define ARM_CFFT_TWIDDLE_2048		(twiddleCoef_2048)
+#define ARM_CFFT_TWIDDLE_256		(&twiddleCoef_2048[3570])
+#define ARM_CFFT_TWIDDLE_32		(&twiddleCoef_2048[4004])
+#elif (ARM_MATH_MAX_FFT_LEN >= 256)
+extern const float32_t twiddleCoef_256[476];
+#define ARM_CFFT_TWIDDLE_256		(twiddleCoef_256)
+#define ARM_CFFT_TWIDDLE_32		(&twiddleCoef_256[434])
+#elif (ARM_MATH_MAX_FFT_LEN >= 32)
+extern const float32_t twiddleCoef_32[42];
+#define ARM_CFFT_TWIDDLE_32		(twiddleCoef_32)
+#endif
+#if (ARM_MATH_MAX_FFT_LEN >= 4096)
+extern const float32_t twiddleCoef_4096[8134];
+#define ARM_CFFT_TWIDDLE_4096		(twiddleCoef_4096)
+#define ARM_CFFT_TWIDDLE_512		(&twiddleCoef_4096[7154])
+#define ARM_CFFT_TWIDDLE_64		(&twiddleCoef_4096[8036])
+#elif (ARM_MATH_MAX_FFT_LEN >= 512)
+extern const float32_t twiddleCoef_512[980];
+#define ARM_CFFT_TWIDDLE_512		(twiddleCoef_512)
+#define ARM_CFFT_TWIDDLE_64		(&twiddleCoef_512[882])
+#elif (ARM_MATH_MAX_FFT_LEN >= 64)
+extern const float32_t twiddleCoef_64[98];
+#define ARM_CFFT_TWIDDLE_64		(twiddleCoef_64)
+#endif
+
+#define ARMBITREVINDEXTABLE16_LENGTH ((uint16_t)12)
+#define ARMBITREVINDEXTABLE32_LENGTH ((uint16_t)24)
+#define ARMBITREVINDEXTABLE64_LENGTH ((uint16_t)56)
+#define ARMBITREVINDEXTABLE128_LENGTH ((uint16_t)112)
+#define ARMBITREVINDEXTABLE256_LENGTH ((uint16_t)240)
+#define ARMBITREVINDEXTABLE512_LENGTH ((uint16_t)480)
+#define ARMBITREVINDEXTABLE1024_LENGTH ((uint16_t)992)
+#define ARMBITREVINDEXTABLE2048_LENGTH ((uint16_t)1984)
+#define ARMBITREVINDEXTABLE4096_LENGTH ((uint16_t)4032)
+
+extern const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE16_LENGTH];
+extern const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE32_LENGTH];
+extern const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE64_LENGTH];
+extern const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE128_LENGTH];
+extern const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE256_LENGTH];
+extern const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE512_LENGTH];
+extern const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_LENGTH];
+extern const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_LENGTH];
+extern const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_LENGTH];
+
+/* Real FFT of arm_rfft_fast_f32, see arm_rfft_fast_init_f32.c */
+extern const float32_t twiddleCoef_rfft_32[16];
+extern const float32_t twiddleCoef_rfft_64[32];
+extern const float32_t twiddleCoef_rfft_128[64];
+extern const float32_t twiddleCoef_rfft_256[128];
+extern const float32_t twiddleCoef_rfft_512[256];
+extern const float32_t twiddleCoef_rfft_1024[512];
+extern const float32_t twiddleCoef_rfft_2048[1024];
+extern const float32_t twiddleCoef_rfft_4096[2048];
+
+/* Largest split step table linked, quarter wave read with a stride by the DCT-II/III and the MDCT */
+#if (ARM_MATH_MAX_FFT_LEN >= 2048)
+#define ARM_RFFT_TWIDDLE_MAX_LEN	4096u
+#define ARM_RFFT_TWIDDLE_MAX		(twiddleCoef_rfft_4096)
+#elif (ARM_MATH_MAX_FFT_LEN >= 1024)
+#define ARM_RFFT_TWIDDLE_MAX_LEN	2048u
+#define ARM_RFFT_TWIDDLE_MAX		(twiddleCoef_rfft_2048)
+#elif (ARM_MATH_MAX_FFT_LEN >= 256)
+#define ARM_RFFT_TWIDDLE_MAX_LEN	512u
+#define ARM_RFFT_TWIDDLE_MAX		(twiddleCoef_rfft_512)
+#elif (ARM_MATH_MAX_FFT_LEN >= 64)
+#define ARM_RFFT_TWIDDLE_MAX_LEN	128u
+#define ARM_RFFT_TWIDDLE_MAX		(twiddleCoef_rfft_128)
+#else
+#define ARM_RFFT_TWIDDLE_MAX_LEN	32u
+#define ARM_RFFT_TWIDDLE_MAX		(twiddleCoef_rfft_32)
+#endif
+
+/* CORDIC kernels, see arm_cordic_sin_cos_fast_q31.c */
+extern const q31_t armCordicAtanTableQ31[ARM_CORDIC_MAX_ITER];
+extern const q31_t armCordicInvGainTableQ31[ARM_CORDIC_MAX_ITER];
  
 #endif /*  ARM_COMMON_TABLES_H */ 
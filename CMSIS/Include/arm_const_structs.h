@@ -0,0 +1,50 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010 ARM Limited. All rights reserved.
+*
+* $Date:        15. February 2012
+* $Revision: 	V1.1.0
+*
+* Project: 	    CMSIS DSP Library
+* Title:	    arm_const_structs.h
+*
+* Description:	Constant instances of the Radix-4 floating-point CFFT & CIFFT,
+*               set up at compile time with the tables of their length
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_CONST_STRUCTS_H
+#define _ARM_CONST_STRUCTS_H
+
+#include "arm_math.h"
+
+/* ARM_MATH_CCM_TABLES: tables of the instances in RAM, section
+   ARM_CCM_SECTION_NAME (".ccmram" by default, the CCM data RAM of the
+   STM32F4) that the linker script and startup code load from flash */
+#ifdef ARM_MATH_CCM_TABLES
+ #define ARM_CCM_TABLE
+ #define ARM_CCM_SECTION          ARM_CCM_DATA
+#else
+ #define ARM_CCM_TABLE            const
+ #define ARM_CCM_SECTION
+#endif
+
+/* The tables and instances of a length are defined up to ARM_MATH_MAX_FFT_LEN */
+extern ARM_CCM_TABLE float32_t twiddleCoef_rad4_64[96];
+extern ARM_CCM_TABLE float32_t twiddleCoef_rad4_256[384];
+extern ARM_CCM_TABLE float32_t twiddleCoef_rad4_1024[1536];
+extern ARM_CCM_TABLE uint16_t armBitRevTable_rad4_64[16];
+extern ARM_CCM_TABLE uint16_t armBitRevTable_rad4_256[64];
+extern ARM_CCM_TABLE uint16_t armBitRevTable_rad4_1024[256];
+
+/* Forward transforms */
+extern const arm_cfft_radix4_instance_f32 arm_cfft_radix4_sR_f32_len64;
+extern const arm_cfft_radix4_instance_f32 arm_cfft_radix4_sR_f32_len256;
+extern const arm_cfft_radix4_instance_f32 arm_cfft_radix4_sR_f32_len1024;
+
+/* Inverse transforms */
+extern const arm_cfft_radix4_instance_f32 arm_cifft_radix4_sR_f32_len64;
+extern const arm_cfft_radix4_instance_f32 arm_cifft_radix4_sR_f32_len256;
+extern const arm_cfft_radix4_instance_f32 arm_cifft_radix4_sR_f32_len1024;
+
+#endif /* _ARM_CONST_STRUCTS_H */
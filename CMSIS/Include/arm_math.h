@@ -113,9 +113,39 @@
    * <b>ARM_MATH_ROUNDING:</b>
    * Define macro for rounding on support functions
    *
+   * <b>ARM_MATH_SAT_STATS:</b>
+   * Define macro ARM_MATH_SAT_STATS to count, in the instances of the Q15 and Q31 FIR and Biquad cascade DF1 filters and
+   * in the destination matrix of the Q15 and Q31 matrix multiplications, the output samples out of the range of the
+   * output type, and to track the peak magnitude of the accumulator at the output (at the output of every stage for
+   * the Biquad cascades). The counts are read back with ARM_SAT_STATS_GET() and cleared by the initialization functions.
+   * They are written by the kernels: the instances must be in RAM. Without the macro the instances and the kernels
+   * are unchanged.
+   *
+   * <b>ARM_MATH_MAX_FFT_LEN:</b>
+   * Largest complex FFT length of the application, 16, 64, 256, 1024 or 4096 (the default). The twiddle factor and
+   * bit reversal tables of the transforms are generated for that length, and the lengths above it are rejected by the
+   * initialization functions: an image using 256 point FFTs only, built with ARM_MATH_MAX_FFT_LEN = 256, carries
+   * the tables of 256 points instead of 4096. The real FFTs and the DCTs go up to twice that length.
+   * Define it to the same value for the library and for the application.
+   *
    * <b>__FPU_PRESENT:</b>
    * Initialize macro __FPU_PRESENT = 1 when building on FPU supported Targets. Enable this macro for M4bf and M4lf libraries 
    *
+   * <b>ARM_MATH_HOST:</b>
+   * Define macro ARM_MATH_HOST, with ARM_MATH_CM4, ARM_MATH_CM3 or ARM_MATH_CM0, to build the C code of that variant
+   * with a native compiler of the development machine. The core header is not included and the intrinsics are replaced
+   * by their C definitions, so that the outputs of the variants can be compared and the kernels timed without a target.
+   * The sources access the q15 and q7 data by words: build them with strict aliasing disabled (-fno-strict-aliasing).
+   * arm_math_dispatch_init() is not available.
+   *
+   * <b>ARM_MATH_DISPATCH:</b>
+   * Define macro ARM_MATH_DISPATCH to let arm_math_dispatch_init() select the Cortex-M3 or the Cortex-M4 variants of the main kernels at run time.
+   *
+   * <b>ARM_MATH_DISPATCH_CM3, ARM_MATH_DISPATCH_CM4:</b>
+   * Define one of these macros, with ARM_MATH_CM3 or ARM_MATH_CM4, to build the Cortex-M3 or the Cortex-M4 variant
+   * of the kernels selected at run time by arm_math_dispatch_init(). Their names get the suffix <code>_cm3</code>
+   * or <code>_cm4</code>, so that both variants link into one image.
+   *
    *
    * The project can be built by opening the appropriate project in MDK-ARM 4.21 chain and defining the optional pre processor MACROs detailed above.
    *
@@ -238,6 +268,32 @@
  * @defgroup groupSupport Support Functions
  */
 
+/**
+ * @defgroup groupNN Neural Network Functions
+ * This set of functions provides the layers of small fixed-point neural networks:
+ * fully connected and 1-dimensional convolution layers with Q7 weights and Q15
+ * activations, and the ReLU, sigmoid and tanh activation functions.
+ * The intermediate buffers between the layers can be allocated from a RAM arena with
+ * arm_ram_arena_alloc() and released together with arm_ram_arena_release().
+ */
+
+/**
+ * @defgroup groupImage Image Processing Functions
+ * This set of functions filters 8-bit grayscale and Q15 images, such as the frames
+ * captured by the DCMI: 3x3 and 5x5 convolutions, separable filters, the Sobel gradient
+ * magnitude with an optional threshold, and the box filter. It also converts the YUV
+ * 4:2:2 pixels of the cameras to RGB565 and to grayscale.
+ * The images are stored row after row, <code>width</code> pixels per row, and the
+ * filters produce the valid part of the output only: the output of a filter of
+ * <code>K</code> x <code>K</code> pixels has <code>width - K + 1</code> pixels per row and
+ * <code>height - K + 1</code> rows, stored row after row, the borders being left to the
+ * application. The functions go through the image once, from top to bottom, and keep the
+ * last <code>K</code> rows in line buffers given by the application, which may be placed
+ * in the CCM data RAM. As the line buffers hold no state between two calls, a frame can be
+ * processed in strips of rows: strips overlapping by <code>K - 1</code> rows give
+ * consecutive output rows.
+ */
+
 /**
  * @defgroup groupInterpolation Interpolation Functions
  * These functions perform 1- and 2-dimensional interpolation of data.
@@ -245,6 +301,14 @@
  * bilinear interpolation is used for 2-dimensional data.
  */
 
+/**
+ * @defgroup groupGenerator Signal Generator Functions
+ * This set of functions fills blocks with test and modulation signals: sines from a
+ * numerically controlled oscillator, linear and logarithmic chirps, and white and pink
+ * noise. The generators keep their phase or their state from one block to the next, so
+ * consecutive blocks, such as the halves of a DAC DMA buffer, join without discontinuity.
+ */
+
 /**
  * @defgroup groupExamples Examples
  */
@@ -253,7 +317,15 @@
 
 #define __CMSIS_GENERIC              /* disable NVIC and Systick functions */
 
-#if defined (ARM_MATH_CM4)
+#if defined (ARM_MATH_HOST)
+  #include "stdint.h"
+  #define __INLINE         inline
+  #define __I              volatile const
+  #define __O              volatile
+  #define __IO             volatile
+  #define __DSB()
+  #define __ISB()
+#elif defined (ARM_MATH_CM4)
   #include "core_cm4.h"
 #elif defined (ARM_MATH_CM3)
   #include "core_cm3.h"
@@ -265,6 +337,32 @@
 #endif
 
 #undef  __CMSIS_GENERIC              /* enable NVIC and Systick functions */
+
+  /**
+   * @brief Names of the kernels selected at run time, in their Cortex-M3 and Cortex-M4 variant builds
+   */
+
+#if defined (ARM_MATH_DISPATCH_CM4)
+#define ARM_MATH_DISPATCH_NAME(f)	f##_cm4
+#elif defined (ARM_MATH_DISPATCH_CM3)
+#define ARM_MATH_DISPATCH_NAME(f)	f##_cm3
+#endif
+
+#ifdef ARM_MATH_DISPATCH_NAME
+#define arm_fir_f32			ARM_MATH_DISPATCH_NAME(arm_fir_f32)
+#define arm_fir_q31			ARM_MATH_DISPATCH_NAME(arm_fir_q31)
+#define arm_fir_q15			ARM_MATH_DISPATCH_NAME(arm_fir_q15)
+#define arm_fir_fast_q15		ARM_MATH_DISPATCH_NAME(arm_fir_fast_q15)
+#define arm_biquad_cascade_df1_f32	ARM_MATH_DISPATCH_NAME(arm_biquad_cascade_df1_f32)
+#define arm_biquad_cascade_df1_q31	ARM_MATH_DISPATCH_NAME(arm_biquad_cascade_df1_q31)
+#define arm_biquad_cascade_df1_q15	ARM_MATH_DISPATCH_NAME(arm_biquad_cascade_df1_q15)
+#define arm_dot_prod_f32		ARM_MATH_DISPATCH_NAME(arm_dot_prod_f32)
+#define arm_dot_prod_q31		ARM_MATH_DISPATCH_NAME(arm_dot_prod_q31)
+#define arm_dot_prod_q15		ARM_MATH_DISPATCH_NAME(arm_dot_prod_q15)
+#define arm_mat_mult_f32		ARM_MATH_DISPATCH_NAME(arm_mat_mult_f32)
+#define arm_mat_mult_q15		ARM_MATH_DISPATCH_NAME(arm_mat_mult_q15)
+#endif /* #ifdef ARM_MATH_DISPATCH_NAME */
+
 #include "string.h"
     #include "math.h"
 #ifdef	__cplusplus
@@ -297,6 +395,30 @@ extern "C"
   /* -1 to +1 is divided into 360 values so total spacing is (2/360) */
 #define INPUT_SPACING			0xB60B61
 
+  /**
+   * @brief Macros placing tables, coefficients and buffers in a given RAM.
+   * The CCM data RAM of the STM32F4 is accessed by the core with no wait state and no
+   * contention with the DMA, but it is not accessible to the DMA.  An object declared with
+   * ARM_CCM_DATA must not be const, and is loaded from flash by the startup code when the
+   * linker script gives its section a load address.
+   */
+#ifndef ARM_CCM_SECTION_NAME
+#define ARM_CCM_SECTION_NAME	".ccmram"
+#endif
+#ifndef ARM_SRAM_SECTION_NAME
+#define ARM_SRAM_SECTION_NAME	".data"
+#endif
+#define ARM_SECTION(name)		__attribute__((section(name)))
+#define ARM_CCM_DATA			ARM_SECTION(ARM_CCM_SECTION_NAME)
+#define ARM_SRAM_DATA			ARM_SECTION(ARM_SRAM_SECTION_NAME)
+
+  /**
+   * @brief Largest complex FFT length, sizing the transform tables: 16, 64, 256, 1024 or 4096.
+   */
+#ifndef ARM_MATH_MAX_FFT_LEN
+#define ARM_MATH_MAX_FFT_LEN	4096u
+#endif
+
 
   /**
    * @brief Error status returned by some functions in the library.
@@ -343,18 +465,61 @@ extern "C"
    */
   typedef double float64_t;
 
+  /**
+   * @brief 16-bit floating-point storage type: the bits of an IEEE 754 half-precision
+   * value, 1 sign, 5 exponent and 10 fraction bits.  Values are converted to
+   * float32_t for the computations, by the VCVTB/VCVTT instructions on the
+   * Cortex-M4 with FPU (ARM_MATH_F16_HW).
+   */
+  typedef uint16_t float16_t;
+
+  /**
+   * @brief Half-precision conversions by the FPU, for GCC on the Cortex-M4 with FPU.
+   * The FPSCR must select the IEEE half-precision format (AHP bit clear, the reset value)
+   * and the round to nearest mode.
+   */
+#if defined (ARM_MATH_CM4) && defined (__GNUC__) && !defined (ARM_MATH_HOST)
+#if (__FPU_USED == 1)
+#define ARM_MATH_F16_HW
+#endif
+#endif
+
   /**
    * @brief definition to read/write two 16 bit values.
    */
 #define __SIMD32(addr)  (*(int32_t **) & (addr))
 
-#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0)
+  /**
+   * @brief definition to read/write two 32 bit values.
+   */
+#define __SIMD64(addr)  (*(int64_t **) & (addr))
+
+  /**
+   * @brief definition to read/write two 16 bit values at an offset, without increment.
+   */
+#define _SIMD32_OFFSET(addr)  (*(int32_t *) (addr))
+
+  /**
+   * @brief definition to align a table on a word boundary, for the 32 bit accesses.
+   */
+#if defined ( __CC_ARM )
+#define ALIGN4 __align(4)
+#elif defined ( __ICCARM__ )
+#define ALIGN4 _Pragma("data_alignment=4")
+#else
+#define ALIGN4 __attribute__((aligned(4)))
+#endif
+
+#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0) || defined (ARM_MATH_HOST)
   /**
    * @brief definition to pack two 16 bit values.
    */
 #define __PKHBT(ARG1, ARG2, ARG3)      ( (((int32_t)(ARG1) <<  0) & (int32_t)0x0000FFFF) | \
                                          (((int32_t)(ARG2) << ARG3) & (int32_t)0xFFFF0000)  )
 
+#define __PKHTB(ARG1, ARG2, ARG3)      ( (((int32_t)(ARG1) <<  0) & (int32_t)0xFFFF0000) | \
+                                         (((int32_t)(ARG2) >> ARG3) & (int32_t)0x0000FFFF)  )
+
 #endif
 
 
@@ -434,7 +599,7 @@ extern "C"
 #define __CLZ __clz
 #endif 
 
-#if defined (ARM_MATH_CM0) && ((defined (__ICCARM__)) ||(defined (__GNUC__)) || defined (__TASKING__) )
+#if (defined (ARM_MATH_CM0) || defined (ARM_MATH_HOST)) && ((defined (__ICCARM__)) ||(defined (__GNUC__)) || defined (__TASKING__) )
 
   static __INLINE  uint32_t __CLZ(q31_t data);
 
@@ -562,7 +727,7 @@ extern "C"
   /*
    * @brief C custom defined intrinisic function for only M0 processors
    */
-#if defined(ARM_MATH_CM0)
+#if defined(ARM_MATH_CM0) || defined (ARM_MATH_HOST)
 
   static __INLINE q31_t __SSAT(
 			       q31_t x,
@@ -600,6 +765,34 @@ extern "C"
 
   }
 
+  static __INLINE uint32_t __USAT(
+				  q31_t x,
+				  uint32_t y)
+  {
+    int32_t posMax;
+    uint32_t i;
+
+    posMax = 1;
+    for (i = 0; i < y; i++)
+      {
+	posMax = posMax * 2;
+      }
+
+    posMax = (posMax - 1);
+
+    if(x < 0)
+      {
+	x = 0;
+      }
+    else if(x > posMax)
+      {
+	x = posMax;
+      }
+
+    return ((uint32_t) x);
+
+  }
+
 #endif /* end of ARM_MATH_CM0 */
 
 
@@ -607,7 +800,7 @@ extern "C"
   /*
    * @brief C custom defined intrinsic function for M3 and M0 processors
    */
-#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0)
+#if defined (ARM_MATH_CM3) || defined (ARM_MATH_CM0) || defined (ARM_MATH_HOST)
 
   /*
    * @brief C custom defined QADD8 for M3 and M0 processors
@@ -964,10 +1157,123 @@ extern "C"
             (((x << 16) >> 16) * ((y << 16) >> 16)));
   }
 
+  /*
+   * @brief C custom defined SXTB16 for M3 and M0 processors
+   */
+  static __INLINE q31_t __SXTB16(
+				 q31_t x)
+  {
+
+    return ((((x << 24) >> 24) & 0x0000FFFF) |
+            (((x << 8) >> 8) & 0xFFFF0000));
+  }
+
+  /*
+   * @brief C custom defined UXTB16 for M3 and M0 processors
+   */
+  static __INLINE uint32_t __UXTB16(
+				    uint32_t x)
+  {
+
+    return (x & 0x00FF00FFu);
+  }
+
+  /*
+   * @brief C custom defined USAT16 for M3 and M0 processors
+   */
+  static __INLINE uint32_t __USAT16(
+				    q31_t x,
+				    uint32_t y)
+  {
+    q31_t lo = (q15_t) x;
+    q31_t hi = x >> 16;
+    q31_t max = (1 << y) - 1;
+
+    lo = (lo < 0) ? 0 : ((lo > max) ? max : lo);
+    hi = (hi < 0) ? 0 : ((hi > max) ? max : hi);
+
+    return ((uint32_t) lo | ((uint32_t) hi << 16));
+  }
+
+
+
+
+#endif /* (ARM_MATH_CM3) || defined (ARM_MATH_CM0) || defined (ARM_MATH_HOST) */
+
+
+#if defined (ARM_MATH_HOST)
+
+  /*
+   * @brief C custom defined ROR for native builds
+   */
+  static __INLINE uint32_t __ROR(
+				 uint32_t op1,
+				 uint32_t op2)
+  {
+    op2 &= 31u;
+
+    return ((op2 == 0u) ? op1 : ((op1 >> op2) | (op1 << (32u - op2))));
+  }
+
+#endif /* #if defined (ARM_MATH_HOST) */
+
+
+  /**
+   * @brief Saturation statistics of a fixed-point instance, built with ARM_MATH_SAT_STATS.
+   */
+  typedef struct
+  {
+    uint32_t numSamples;     /**< number of output samples computed, of every stage for the Biquad cascades. */
+    uint32_t numSat;         /**< number of output samples out of the range of the output type: saturated, or wrapped by the kernels which truncate. */
+    q63_t peak;              /**< largest magnitude of the accumulator, scaled to the output format. */
+  } arm_sat_stats;
+
+  /**
+   * @brief Accounts one output sample in saturation statistics.
+   * @param[in,out] *pStats points to the statistics.
+   * @param[in]     value   accumulator scaled to the output format, before saturation.
+   * @param[in]     limit   largest value of the output type.
+   */
+  static __INLINE void arm_sat_stats_update(
+					    arm_sat_stats * pStats,
+					    q63_t value,
+					    q63_t limit)
+  {
+    q63_t mag = (value < 0) ? -value : value;
+
+    pStats->numSamples++;
+
+    if((value > limit) || (value < (-limit - 1)))
+    {
+      pStats->numSat++;
+    }
+
+    if(mag > pStats->peak)
+    {
+      pStats->peak = mag;
+    }
+  }
+
+#ifdef ARM_MATH_SAT_STATS
 
+  /*
+   * The kernels take their instances as const: the statistics are written through a cast.
+   */
+#define ARM_SAT_STATS_MEMBER        arm_sat_stats satStats;
+#define ARM_SAT_STATS_RESET(S)      memset(&(S)->satStats, 0, sizeof(arm_sat_stats))
+#define ARM_SAT_STATS_GET(S, pStats)  (*(pStats) = (S)->satStats)
+#define ARM_SAT_STATS_Q15(S, v)     arm_sat_stats_update((arm_sat_stats *) &(S)->satStats, (q63_t) (v), 0x7FFF)
+#define ARM_SAT_STATS_Q31(S, v)     arm_sat_stats_update((arm_sat_stats *) &(S)->satStats, (q63_t) (v), 0x7FFFFFFF)
+
+#else
 
+#define ARM_SAT_STATS_MEMBER
+#define ARM_SAT_STATS_RESET(S)
+#define ARM_SAT_STATS_GET(S, pStats)  memset((pStats), 0, sizeof(arm_sat_stats))
+#define ARM_SAT_STATS_Q15(S, v)
+#define ARM_SAT_STATS_Q31(S, v)
 
-#endif /* (ARM_MATH_CM3) || defined (ARM_MATH_CM0) */
+#endif /* #ifdef ARM_MATH_SAT_STATS */
 
 
   /**
@@ -988,6 +1294,7 @@ extern "C"
     uint16_t numTaps;         /**< number of filter coefficients in the filter. */
     q15_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
     q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    ARM_SAT_STATS_MEMBER
   } arm_fir_instance_q15;
 
   /**
@@ -998,6 +1305,7 @@ extern "C"
     uint16_t numTaps;         /**< number of filter coefficients in the filter. */
     q31_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
     q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+    ARM_SAT_STATS_MEMBER
   } arm_fir_instance_q31;
 
   /**
@@ -1147,6 +1455,20 @@ extern "C"
 		   float32_t * pDst,
 		   uint32_t blockSize);
 
+  /**
+   * @brief Processing function for the floating-point FIR filter, with half-precision input.
+   * @param[in] *S points to an instance of the floating-point FIR structure.
+   * @param[in] *pSrc points to the block of half-precision input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_fir_f16_f32(
+		   const arm_fir_instance_f32 * S,
+		   float16_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
+
   /**
    * @brief  Initialization function for the floating-point FIR filter.
    * @param[in,out] *S points to an instance of the floating-point FIR filter structure.
@@ -1163,116 +1485,451 @@ extern "C"
 			float32_t * pState,
 			uint32_t blockSize);
 
-
   /**
-   * @brief Instance structure for the Q15 Biquad cascade filter.
+   * @brief Instance structure for the Q15 FIR filter with a circular state buffer.
    */
   typedef struct
   {
-    int8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q15_t *pState;            /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
-    q15_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 5*numStages. */
-    int8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
-
-  } arm_biquad_casd_df1_inst_q15;
-
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateLen;        /**< length of the delay line, numTaps+blockSize-1. */
+    uint16_t stateIndex;      /**< write index of the next input sample in the delay line. */
+    q15_t *pState;            /**< points to the delay line and its mirrored copy.  The array is of length 2*stateLen. */
+    q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q15;
 
   /**
-   * @brief Instance structure for the Q31 Biquad cascade filter.
+   * @brief  Initialization function for the Q15 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q15 circular FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in] 	blockSize largest number of samples that are processed at a time.
+   * @return    	none.
    */
-  typedef struct
-  {
-    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+  void arm_fir_circ_init_q15(
+			     arm_fir_circ_instance_q15 * S,
+			     uint16_t numTaps,
+			     q15_t * pCoeffs,
+			     q15_t * pState,
+			     uint32_t blockSize);
 
-  } arm_biquad_casd_df1_inst_q31;
+  /**
+   * @brief Processing function for the Q15 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q15 circular FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+  void arm_fir_circ_q15(
+			arm_fir_circ_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the floating-point Biquad cascade filter.
+   * @brief Instance structure for the Q31 FIR filter with a circular state buffer.
    */
   typedef struct
   {
-    uint32_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;          /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
-    float32_t *pCoeffs;         /**< Points to the array of coefficients.  The array is of length 5*numStages. */
-
-
-  } arm_biquad_casd_df1_inst_f32;
-
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateLen;        /**< length of the delay line, numTaps+blockSize-1. */
+    uint16_t stateIndex;      /**< write index of the next input sample in the delay line. */
+    q31_t *pState;            /**< points to the delay line and its mirrored copy.  The array is of length 2*stateLen. */
+    q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q31;
 
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q31 circular FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in] 	blockSize largest number of samples that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_circ_init_q31(
+			     arm_fir_circ_instance_q31 * S,
+			     uint16_t numTaps,
+			     q31_t * pCoeffs,
+			     q31_t * pState,
+			     uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 Biquad cascade filter.
-   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
+   * @brief Processing function for the Q31 FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the Q31 circular FIR structure.
    * @param[in]  *pSrc points to the block of input data.
    * @param[out] *pDst points to the block of output data.
    * @param[in]  blockSize number of samples to process.
    * @return     none.
    */
-
-  void arm_biquad_cascade_df1_q15(
-				  const arm_biquad_casd_df1_inst_q15 * S,
-				   q15_t * pSrc,
-				  q15_t * pDst,
-				  uint32_t blockSize);
+  void arm_fir_circ_q31(
+			arm_fir_circ_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q15 Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the Q15 Biquad cascade structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
+   * @brief Instance structure for the floating-point FIR filter with a circular state buffer.
    */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t stateLen;        /**< length of the delay line, numTaps+blockSize-1. */
+    uint16_t stateIndex;      /**< write index of the next input sample in the delay line. */
+    float32_t *pState;         /**< points to the delay line and its mirrored copy.  The array is of length 2*stateLen. */
+    float32_t *pCoeffs;        /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_f32;
 
-  void arm_biquad_cascade_df1_init_q15(
-				       arm_biquad_casd_df1_inst_q15 * S,
-				       uint8_t numStages,
-				       q15_t * pCoeffs,
-				       q15_t * pState,
-				       int8_t postShift);
-
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the floating-point circular FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer of length 2*(numTaps+blockSize-1).
+   * @param[in] 	blockSize largest number of samples that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_circ_init_f32(
+			     arm_fir_circ_instance_f32 * S,
+			     uint16_t numTaps,
+			     float32_t * pCoeffs,
+			     float32_t * pState,
+			     uint32_t blockSize);
 
   /**
-   * @brief Fast but less precise processing function for the Q15 Biquad cascade filter for Cortex-M3 and Cortex-M4.
-   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
+   * @brief Processing function for the floating-point FIR filter with a circular state buffer.
+   * @param[in,out] *S points to an instance of the floating-point circular FIR structure.
    * @param[in]  *pSrc points to the block of input data.
    * @param[out] *pDst points to the block of output data.
    * @param[in]  blockSize number of samples to process.
    * @return     none.
    */
-
-  void arm_biquad_cascade_df1_fast_q15(
-				       const arm_biquad_casd_df1_inst_q15 * S,
-				        q15_t * pSrc,
-				       q15_t * pDst,
-				       uint32_t blockSize);
-
+  void arm_fir_circ_f32(
+			arm_fir_circ_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 Biquad cascade filter
-   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
-   * @param[in]  *pSrc      points to the block of input data.
-   * @param[out] *pDst      points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
-   * @return     none.
+   * @brief Instance structure for the floating-point FIR filter on interleaved channels.
    */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;     /**< number of interleaved channels. */
+    float32_t *pState;        /**< points to the interleaved state frames.  The array is of length (numTaps+blockSize-1)*numChannels. */
+    float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multichannel_instance_f32;
 
-  void arm_biquad_cascade_df1_q31(
-				  const arm_biquad_casd_df1_inst_q31 * S,
-				   q31_t * pSrc,
-				  q31_t * pDst,
-				  uint32_t blockSize);
+  /**
+   * @brief  Initialization function for the floating-point FIR filter on interleaved channels.
+   * @param[in,out] *S points to an instance of the floating-point multichannel FIR filter structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	numChannels  Number of interleaved channels.
+   * @param[in] 	*pCoeffs points to the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of samples per channel that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_multichannel_init_f32(
+				     arm_fir_multichannel_instance_f32 * S,
+				     uint16_t numTaps,
+				     uint16_t numChannels,
+				     float32_t * pCoeffs,
+				     float32_t * pState,
+				     uint32_t blockSize);
 
   /**
-   * @brief Fast but less precise processing function for the Q31 Biquad cascade filter for Cortex-M3 and Cortex-M4.
-   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
-   * @param[in]  *pSrc      points to the block of input data.
-   * @param[out] *pDst      points to the block of output data.
-   * @param[in]  blockSize  number of samples to process.
+   * @brief Processing function for the floating-point FIR filter on interleaved channels.
+   * @param[in]  *S points to an instance of the floating-point multichannel FIR filter structure.
+   * @param[in]  *pSrc points to the block of interleaved input data.
+   * @param[out] *pDst points to the block of interleaved output data.
+   * @param[in]  blockSize number of samples to process per channel.
+   * @return     none.
+   */
+  void arm_fir_multichannel_f32(
+				const arm_fir_multichannel_instance_f32 * S,
+				float32_t * pSrc,
+				float32_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 FIR filter with symmetric coefficients.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    q15_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;           /**< points to the first half of the coefficient array. The array is of length (numTaps+1)/2. */
+  } arm_fir_sym_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 FIR filter with symmetric coefficients.
+   * @param[in]  *S points to an instance of the Q15 symmetric FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_sym_q15(
+			const arm_fir_sym_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter with symmetric coefficients.
+   * @param[in,out] *S points to an instance of the Q15 symmetric FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	*pCoeffs points to the first half of the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of samples that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_sym_init_q15(
+			     arm_fir_sym_instance_q15 * S,
+			     uint16_t numTaps,
+			     q15_t * pCoeffs,
+			     q15_t * pState,
+			     uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 FIR filter with symmetric coefficients.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    q31_t *pState;            /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;           /**< points to the first half of the coefficient array. The array is of length (numTaps+1)/2. */
+  } arm_fir_sym_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 FIR filter with symmetric coefficients.
+   * @param[in]  *S points to an instance of the Q31 symmetric FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_sym_q31(
+			const arm_fir_sym_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with symmetric coefficients.
+   * @param[in,out] *S points to an instance of the Q31 symmetric FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	*pCoeffs points to the first half of the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of samples that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_sym_init_q31(
+			     arm_fir_sym_instance_q31 * S,
+			     uint16_t numTaps,
+			     q31_t * pCoeffs,
+			     q31_t * pState,
+			     uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with symmetric coefficients.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+    float32_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;       /**< points to the first half of the coefficient array. The array is of length (numTaps+1)/2. */
+  } arm_fir_sym_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with symmetric coefficients.
+   * @param[in]  *S points to an instance of the floating-point symmetric FIR structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_sym_f32(
+			const arm_fir_sym_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with symmetric coefficients.
+   * @param[in,out] *S points to an instance of the floating-point symmetric FIR structure.
+   * @param[in] 	numTaps  Number of filter coefficients in the filter.
+   * @param[in] 	*pCoeffs points to the first half of the filter coefficients.
+   * @param[in] 	*pState points to the state buffer.
+   * @param[in] 	blockSize number of samples that are processed at a time.
+   * @return    	none.
+   */
+  void arm_fir_sym_init_f32(
+			     arm_fir_sym_instance_f32 * S,
+			     uint16_t numTaps,
+			     float32_t * pCoeffs,
+			     float32_t * pState,
+			     uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q15 Biquad cascade filter.
+   */
+  typedef struct
+  {
+    int8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q15_t *pState;            /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+    q15_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    int8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
+    ARM_SAT_STATS_MEMBER
+
+  } arm_biquad_casd_df1_inst_q15;
+
+
+  /**
+   * @brief Instance structure for the Q31 Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+    ARM_SAT_STATS_MEMBER
+
+  } arm_biquad_casd_df1_inst_q31;
+
+  /**
+   * @brief Instance structure for the floating-point Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint32_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;          /**< Points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;         /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+
+
+  } arm_biquad_casd_df1_inst_f32;
+
+
+
+  /**
+   * @brief Processing function for the Q15 Biquad cascade filter.
+   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void arm_biquad_cascade_df1_q15(
+				  const arm_biquad_casd_df1_inst_q15 * S,
+				   q15_t * pSrc,
+				  q15_t * pDst,
+				  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_init_q15(
+				       arm_biquad_casd_df1_inst_q15 * S,
+				       uint8_t numStages,
+				       q15_t * pCoeffs,
+				       q15_t * pState,
+				       int8_t postShift);
+
+  /**
+   * @brief Instance structure for the Q15 Biquad cascade filter on interleaved stereo data.
+   */
+  typedef struct
+  {
+    int8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q15_t *pState;            /**< Points to the array of state coefficients.  The array is of length 8*numStages. */
+    q15_t *pCoeffs;           /**< Points to the array of coefficients.  The array is of length 6*numStages. */
+    int8_t postShift;         /**< Additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_casd_df1_stereo_inst_q15;
+
+  /**
+   * @brief Processing function for the Q15 Biquad cascade filter on interleaved stereo data.
+   * @param[in]  *S points to an instance of the Q15 stereo Biquad cascade structure.
+   * @param[in]  *pSrc points to the block of interleaved stereo input data.
+   * @param[out] *pDst points to the block of interleaved stereo output data.
+   * @param[in]  blockSize number of stereo frames to process per call.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df1_stereo_q15(
+					 const arm_biquad_casd_df1_stereo_inst_q15 * S,
+					 q15_t * pSrc,
+					 q15_t * pDst,
+					 uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 Biquad cascade filter on interleaved stereo data.
+   * @param[in,out] *S           points to an instance of the Q15 stereo Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df1_stereo_init_q15(
+					      arm_biquad_casd_df1_stereo_inst_q15 * S,
+					      uint8_t numStages,
+					      q15_t * pCoeffs,
+					      q15_t * pState,
+					      int8_t postShift);
+
+
+  /**
+   * @brief Fast but less precise processing function for the Q15 Biquad cascade filter for Cortex-M3 and Cortex-M4.
+   * @param[in]  *S points to an instance of the Q15 Biquad cascade structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void arm_biquad_cascade_df1_fast_q15(
+				       const arm_biquad_casd_df1_inst_q15 * S,
+				        q15_t * pSrc,
+				       q15_t * pDst,
+				       uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 Biquad cascade filter
+   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return     none.
+   */
+
+  void arm_biquad_cascade_df1_q31(
+				  const arm_biquad_casd_df1_inst_q31 * S,
+				   q31_t * pSrc,
+				  q31_t * pDst,
+				  uint32_t blockSize);
+
+  /**
+   * @brief Fast but less precise processing function for the Q31 Biquad cascade filter for Cortex-M3 and Cortex-M4.
+   * @param[in]  *S         points to an instance of the Q31 Biquad cascade structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
    * @return     none.
    */
 
@@ -1350,6 +2007,7 @@ extern "C"
     uint16_t numRows;     /**< number of rows of the matrix.     */
     uint16_t numCols;     /**< number of columns of the matrix.  */
     q15_t *pData;         /**< points to the data of the matrix. */
+    ARM_SAT_STATS_MEMBER
 
   } arm_matrix_instance_q15;
 
@@ -1362,9 +2020,49 @@ extern "C"
     uint16_t numRows;     /**< number of rows of the matrix.     */
     uint16_t numCols;     /**< number of columns of the matrix.  */
     q31_t *pData;         /**< points to the data of the matrix. */
+    ARM_SAT_STATS_MEMBER
 
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the half-precision matrix structure.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    float16_t *pData;     /**< points to the data of the matrix. */
+  } arm_matrix_instance_f16;
+
+  /**
+   * @brief Instance structure for the floating-point sparse matrix structure, in compressed sparse row (CSR) storage.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint32_t nnz;         /**< number of stored elements. */
+    float32_t *pData;     /**< points to the nnz stored elements, row after row. */
+    uint16_t *pColIdx;    /**< points to the nnz column indexes of the stored elements. */
+    uint32_t *pRowPtr;    /**< points to the numRows+1 offsets of the rows in pData, pRowPtr[numRows] = nnz. */
+  } arm_matrix_sparse_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse matrix structure, in compressed sparse row (CSR) storage.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    uint32_t nnz;         /**< number of stored elements. */
+    q31_t *pData;         /**< points to the nnz stored elements, row after row. */
+    uint16_t *pColIdx;    /**< points to the nnz column indexes of the stored elements. */
+    uint32_t *pRowPtr;    /**< points to the numRows+1 offsets of the rows in pData, pRowPtr[numRows] = nnz. */
+  } arm_matrix_sparse_instance_q31;
+
 
 
   /**
@@ -1462,6 +2160,22 @@ extern "C"
 			      const arm_matrix_instance_f32 * pSrcB,
 			      arm_matrix_instance_f32 * pDst);
 
+  /**
+   * @brief Floating-point matrix multiplication with 4x4 register tiles
+   * @param[in]       *pSrcA points to the first input matrix structure
+   * @param[in]       *pSrcB points to the second input matrix structure
+   * @param[out]      *pDst points to output matrix structure
+   * @param[in]       *pState points to a buffer of numRowsB*numColsB samples holding the transpose of B
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+
+  arm_status arm_mat_mult_tiled_f32(
+				    const arm_matrix_instance_f32 * pSrcA,
+				    const arm_matrix_instance_f32 * pSrcB,
+				    arm_matrix_instance_f32 * pDst,
+				    float32_t * pState);
+
   /**
    * @brief Q15 matrix multiplication
    * @param[in]       *pSrcA points to the first input matrix structure
@@ -1705,6 +2419,23 @@ extern "C"
     float32_t Kd;               /**< The derivative gain. */
   } arm_pid_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point extended PID Control.
+   */
+  typedef struct
+  {
+    float32_t Kp;          /**< The proportional gain. */
+    float32_t Ki;          /**< The integral gain, per sample. */
+    float32_t Kd;          /**< The derivative gain, per sample. */
+    float32_t Kff;         /**< The feed-forward gain. */
+    float32_t alpha;       /**< The smoothing factor of the derivative filter, in (0 1], 1 for no filtering. */
+    float32_t outMin;      /**< The lower limit of the output. */
+    float32_t outMax;      /**< The upper limit of the output. */
+    float32_t Ad;          /**< The derived gain, Ad = 1 - alpha. */
+    float32_t Bd;          /**< The derived gain, Bd = alpha * Kd. */
+    float32_t state[3];    /**< The state array of length 3: integrator, filtered derivative, previous error. */
+  } arm_pid_ext_instance_f32;
+
 
 
   /**
@@ -1764,9 +2495,162 @@ extern "C"
   void arm_pid_reset_q15(
 			 arm_pid_instance_q15 * S);
 
+  /**
+   * @brief  Initialization function for the floating-point extended PID Control.
+   * @param[in,out] *S      points to an instance of the extended PID structure.
+   * @param[in]     resetStateFlag  flag to reset the state. 0 = no change in state 1 = reset the state.
+   * @return none.
+   */
+  void arm_pid_ext_init_f32(
+			    arm_pid_ext_instance_f32 * S,
+			    int32_t resetStateFlag);
 
   /**
-   * @brief Instance structure for the floating-point Linear Interpolate function.
+   * @brief  Reset function for the floating-point extended PID Control.
+   * @param[in,out] *S is an instance of the floating-point extended PID Control structure
+   * @return none
+   */
+  void arm_pid_ext_reset_f32(
+			     arm_pid_ext_instance_f32 * S);
+
+  /**
+   * @brief  Process function for a block of independent floating-point extended PID Controls.
+   * @param[in,out] *S points to an array of <code>numLoops</code> extended PID instances
+   * @param[in]     *pIn points to the <code>numLoops</code> errors
+   * @param[in]     *pFf points to the <code>numLoops</code> feed-forward inputs, or NULL for none
+   * @param[out]    *pOut points to the <code>numLoops</code> outputs
+   * @param[in]     numLoops number of control loops
+   * @return none
+   */
+  void arm_pid_ext_block_f32(
+			     arm_pid_ext_instance_f32 * S,
+			     float32_t * pIn,
+			     float32_t * pFf,
+			     float32_t * pOut,
+			     uint32_t numLoops);
+
+  /**
+   * @brief Number of float32_t of the arena of a Kalman filter of <code>n</code> states.
+   */
+#define ARM_KALMAN_ARENA_SIZE_F32(n)  (((n) * (n)) + (((n) * ((n) + 1u)) / 2u) + (4u * (n)))
+
+  /**
+   * @brief Index of the element (i, j), i <= j, of the symmetric covariance of <code>n</code> states in its packed storage.
+   */
+#define ARM_KALMAN_P_INDEX(n, i, j)   (((i) * (n)) - (((i) * ((i) - 1u)) / 2u) + ((j) - (i)))
+
+  /**
+   * @brief Instance structure for the floating-point Kalman filter.
+   */
+  typedef struct
+  {
+    uint16_t numStates;    /**< number of states n. */
+    uint8_t josephFlag;    /**< 1 for the Joseph form of the covariance update, 0 for the standard form. */
+    float32_t *pX;         /**< points to the state estimate, n values. */
+    float32_t *pP;         /**< points to the covariance, upper triangle packed by rows, n*(n+1)/2 values. */
+    float32_t *pT;         /**< points to the n*n scratch of the prediction. */
+    float32_t *pU;         /**< points to the n scratch values of P*h^T. */
+    float32_t *pX0;        /**< points to the n scratch values of the state before an update. */
+    uint32_t *pIdx;        /**< points to the n scratch indexes of the nonzero elements of a row. */
+  } arm_kalman_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point Kalman filter.
+   * @param[in,out] *S          points to an instance of the Kalman filter structure.
+   * @param[in]     numStates   number of states.
+   * @param[in]     josephFlag  1 for the Joseph form of the covariance update, 0 for the standard form.
+   * @param[in]     initVar     initial variance of every state, the state estimate being cleared.
+   * @param[in]     *pArena     points to the memory of the state, the covariance and the scratch buffers.
+   * @param[in]     arenaSize   number of float32_t in the arena, at least ARM_KALMAN_ARENA_SIZE_F32(numStates).
+   * @return The function returns ARM_MATH_ARGUMENT_ERROR if the arena is too small, ARM_MATH_SUCCESS otherwise.
+   */
+  arm_status arm_kalman_init_f32(
+				 arm_kalman_instance_f32 * S,
+				 uint16_t numStates,
+				 uint8_t josephFlag,
+				 float32_t initVar,
+				 float32_t * pArena,
+				 uint32_t arenaSize);
+
+  /**
+   * @brief  Prediction step of the floating-point Kalman filter.
+   * @param[in,out] *S       points to an instance of the Kalman filter structure.
+   * @param[in]     *pF      points to the n x n transition matrix, or its Jacobian for the extended filter.
+   * @param[in]     *pQ      points to the process noise covariance, packed as the covariance, or NULL for none.
+   * @param[in]     *pXPred  points to the n predicted states f(x) of the extended filter, or NULL for F * x.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_kalman_predict_f32(
+				    arm_kalman_instance_f32 * S,
+				    const arm_matrix_instance_f32 * pF,
+				    const float32_t * pQ,
+				    const float32_t * pXPred);
+
+  /**
+   * @brief  Update step of the floating-point Kalman filter, one scalar measurement at a time.
+   * @param[in,out] *S      points to an instance of the Kalman filter structure.
+   * @param[in]     *pH     points to the m x n measurement matrix, or its Jacobian for the extended filter.
+   * @param[in]     *pZ     points to the m measurements.
+   * @param[in]     *pR     points to the m measurement noise variances, the diagonal of R.
+   * @param[in]     *pHx    points to the m predicted measurements h(x) of the extended filter, or NULL for H * x.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * ARM_MATH_SINGULAR if an innovation variance is not positive, ARM_MATH_SUCCESS otherwise.
+   */
+  arm_status arm_kalman_update_f32(
+				   arm_kalman_instance_f32 * S,
+				   const arm_matrix_instance_f32 * pH,
+				   const float32_t * pZ,
+				   const float32_t * pR,
+				   const float32_t * pHx);
+
+  /**
+   * @brief Instance structure for the Q31 field-oriented control step.
+   */
+  typedef struct
+  {
+    arm_pid_instance_q31 pidD;   /**< PID controller of the d-axis current. */
+    arm_pid_instance_q31 pidQ;   /**< PID controller of the q-axis current. */
+    q31_t vMax;                  /**< Limit of the d-axis and q-axis voltages, which also stops the integration. */
+    uint32_t period;             /**< Compare value of a duty cycle of 1, ARR + 1 in edge-aligned mode or ARR in center-aligned mode. */
+    q31_t Id;                    /**< Last measured d-axis current. */
+    q31_t Iq;                    /**< Last measured q-axis current. */
+  } arm_foc_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 field-oriented control step.
+   * @param[in,out] *S      points to an instance of the FOC structure, with the gains of pidD and pidQ set.
+   * @param[in]     vMax    limit of the d-axis and q-axis voltages, in 1.31 format.
+   * @param[in]     period  compare value of a duty cycle of 1.
+   * @return none.
+   */
+  void arm_foc_init_q31(
+			arm_foc_instance_q31 * S,
+			q31_t vMax,
+			uint32_t period);
+
+  /**
+   * @brief  Q31 field-oriented control step: Clarke, Park, PID, inverse Park and space vector PWM.
+   * @param[in,out] *S      points to an instance of the FOC structure.
+   * @param[in]     Ia      phase a current.
+   * @param[in]     Ib      phase b current.
+   * @param[in]     theta   rotor angle in the range [-1 0.9999] mapping to [-180 179] degrees.
+   * @param[in]     IdRef   d-axis current reference.
+   * @param[in]     IqRef   q-axis current reference.
+   * @param[out]    *pDuty  points to the 3 compare values of phases a, b and c.
+   * @return none.
+   */
+  void arm_foc_q31(
+		   arm_foc_instance_q31 * S,
+		   q31_t Ia,
+		   q31_t Ib,
+		   q31_t theta,
+		   q31_t IdRef,
+		   q31_t IqRef,
+		   uint32_t * pDuty);
+
+
+  /**
+   * @brief Instance structure for the floating-point Linear Interpolate function.
    */
   typedef struct
   {
@@ -1776,6 +2660,17 @@ extern "C"
     float32_t *pYData;          /**< pointer to the table of Y values */
   } arm_linear_interp_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point non-uniform Linear Interpolate function.
+   */
+  typedef struct
+  {
+    uint32_t nValues;           /**< number of breakpoints, at least 2 */
+    float32_t *pXData;          /**< pointer to the increasing table of X breakpoints */
+    float32_t *pYData;          /**< pointer to the table of Y values */
+    uint32_t lastIndex;         /**< interval of the previous lookup, the start of the next search */
+  } arm_linear_interp_nu_instance_f32;
+
   /**
    * @brief Instance structure for the floating-point bilinear interpolation function.
    */
@@ -1787,6 +2682,21 @@ extern "C"
     float32_t *pData;	/**< points to the data table. */
   } arm_bilinear_interp_instance_f32;
 
+  /**
+   * @brief Instance structure for the floating-point non-uniform bilinear interpolation function.
+   */
+
+  typedef struct
+  {
+    uint16_t numRows;	/**< number of rows in the data table, Y breakpoints, at least 2. */
+    uint16_t numCols;	/**< number of columns in the data table, X breakpoints, at least 2. */
+    float32_t *pData;	/**< points to the row-major data table. */
+    float32_t *pXData;	/**< points to the increasing table of X breakpoints. */
+    float32_t *pYData;	/**< points to the increasing table of Y breakpoints. */
+    uint32_t lastCol;	/**< column interval of the previous lookup. */
+    uint32_t lastRow;	/**< row interval of the previous lookup. */
+  } arm_bilinear_interp_nu_instance_f32;
+
    /**
    * @brief Instance structure for the Q31 bilinear interpolation function.
    */
@@ -1820,6 +2730,53 @@ extern "C"
     q7_t *pData;		/**< points to the data table. */
   } arm_bilinear_interp_instance_q7;
 
+  /**
+   * @brief Floating-point Linear Interpolation of a block of samples.
+   * @param[in]       *S points to an instance of the floating-point Linear Interpolation structure
+   * @param[in]       *pSrc points to the input samples
+   * @param[out]      *pDst points to the output samples
+   * @param[in]       blockSize number of samples to process
+   * @return none.
+   */
+
+  void arm_linear_interp_block_f32(
+	const arm_linear_interp_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+
+  /**
+   * @brief Floating-point non-uniform Linear Interpolation of a block of samples.
+   * @param[in,out]   *S points to an instance of the floating-point non-uniform Linear Interpolation structure
+   * @param[in]       *pSrc points to the input samples
+   * @param[out]      *pDst points to the output samples
+   * @param[in]       blockSize number of samples to process
+   * @return none.
+   */
+
+  void arm_linear_interp_nu_block_f32(
+	arm_linear_interp_nu_instance_f32 * S,
+	float32_t * pSrc,
+	float32_t * pDst,
+	uint32_t blockSize);
+
+  /**
+   * @brief Floating-point non-uniform bilinear interpolation of a block of points.
+   * @param[in,out]   *S points to an instance of the floating-point non-uniform bilinear interpolation structure
+   * @param[in]       *pX points to the X coordinates
+   * @param[in]       *pY points to the Y coordinates
+   * @param[out]      *pDst points to the output samples
+   * @param[in]       blockSize number of points to process
+   * @return none.
+   */
+
+  void arm_bilinear_interp_nu_block_f32(
+	arm_bilinear_interp_nu_instance_f32 * S,
+	float32_t * pX,
+	float32_t * pY,
+	float32_t * pDst,
+	uint32_t blockSize);
+
 
   /**
    * @brief Q7 vector multiplication.
@@ -1954,6 +2911,17 @@ extern "C"
 				      uint8_t ifftFlag,
 				      uint8_t bitReverseFlag);
 
+  /**
+   * @brief Block floating point processing function for the Q15 CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the Q15 CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex data buffer. Processing occurs in-place.
+   * @return         exponent of the output, the transform is pSrc[n] * 2^exponent.
+   */
+
+  int32_t arm_cfft_radix4_bfp_q15(
+				const arm_cfft_radix4_instance_q15 * S,
+				q15_t * pSrc);
+
   /**
    * @brief Processing function for the Q31 CFFT/CIFFT.
    * @param[in]      *S    points to an instance of the Q31 CFFT/CIFFT structure.
@@ -1980,6 +2948,17 @@ extern "C"
 				      uint8_t ifftFlag,
 				      uint8_t bitReverseFlag);
 
+  /**
+   * @brief Block floating point processing function for the Q31 CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the Q31 CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex data buffer. Processing occurs in-place.
+   * @return         exponent of the output, the transform is pSrc[n] * 2^exponent.
+   */
+
+  int32_t arm_cfft_radix4_bfp_q31(
+				const arm_cfft_radix4_instance_q31 * S,
+				q31_t * pSrc);
+
   /**
    * @brief Processing function for the floating-point CFFT/CIFFT.
    * @param[in]      *S    points to an instance of the floating-point CFFT/CIFFT structure.
@@ -1991,6 +2970,135 @@ extern "C"
 			   const arm_cfft_radix4_instance_f32 * S,
 			   float32_t * pSrc);
 
+  /**
+   * @brief Processing function for the floating-point CFFT/CIFFT of several channels.
+   * @param[in]      *S              points to an instance of the floating-point CFFT/CIFFT structure.
+   * @param[in, out] *pSrc           points to the complex data of the channels. Processing occurs in-place.
+   * @param[in]      numChannels     number of signals transformed.
+   * @param[in]      interleaveFlag  selects planar (interleaveFlag=0) or interleaved (interleaveFlag=1) channels.
+   * @return none.
+   */
+
+  void arm_cfft_radix4_batch_f32(
+				 const arm_cfft_radix4_instance_f32 * S,
+				 float32_t * pSrc,
+				 uint16_t numChannels,
+				 uint8_t interleaveFlag);
+
+  /**
+   * @brief Instance structure for the floating-point FFT based FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;                  /**< number of filter coefficients in the filter. */
+    uint16_t fftLen;                   /**< length of the FFTs, 0 when the direct form is used. */
+    arm_fir_instance_f32 Sfir;         /**< direct form instance, holding the coefficients and the state. */
+    arm_cfft_radix4_instance_f32 Sfft; /**< forward CFFT instance of length fftLen. */
+    arm_cfft_radix4_instance_f32 Sifft; /**< inverse CFFT instance of length fftLen. */
+    float32_t *pSpectrum;              /**< points to the spectrum of the coefficients, of length 2*fftLen. */
+    float32_t *pScratch;               /**< points to the scratch buffer of length 2*fftLen. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point FFT based FIR filter.
+   * @param[in,out] *S          points to an instance of the floating-point FFT based FIR structure.
+   * @param[in]     numTaps     number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs    points to the filter coefficients, in time reversed order.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     *pSpectrum  points to the spectrum buffer of 2*fftLen values.
+   * @param[in]     *pScratch   points to the scratch buffer of 2*fftLen values.
+   * @param[in]     blockSize   largest number of samples processed per call.
+   * @return        none.
+   */
+
+  void arm_fir_fft_init_f32(
+			    arm_fir_fft_instance_f32 * S,
+			    uint16_t numTaps,
+			    float32_t * pCoeffs,
+			    float32_t * pState,
+			    float32_t * pSpectrum,
+			    float32_t * pScratch,
+			    uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FFT based FIR filter.
+   * @param[in]  *S         points to an instance of the floating-point FFT based FIR structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void arm_fir_fft_f32(
+		       const arm_fir_fft_instance_f32 * S,
+		       float32_t * pSrc,
+		       float32_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 FFT based FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;                  /**< number of filter coefficients in the filter. */
+    uint16_t fftLen;                   /**< length of the FFTs, 0 when the direct form is used. */
+    int8_t postShift;                  /**< exponent of the spectrum, plus 2 for the product and minus log2(fftLen). */
+    arm_fir_instance_q31 Sfir;         /**< direct form instance, holding the coefficients and the state. */
+    arm_cfft_radix4_instance_q31 Sfft; /**< forward CFFT instance of length fftLen. */
+    arm_cfft_radix4_instance_q31 Sifft; /**< inverse CFFT instance of length fftLen. */
+    q31_t *pSpectrum;                  /**< points to the spectrum of the coefficients, of length 2*fftLen. */
+    q31_t *pScratch;                   /**< points to the scratch buffer of length 2*fftLen. */
+  } arm_fir_fft_instance_q31;
+
+  /**
+   * @brief  Initialization function for the Q31 FFT based FIR filter.
+   * @param[in,out] *S          points to an instance of the Q31 FFT based FIR structure.
+   * @param[in]     numTaps     number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs    points to the filter coefficients, in time reversed order.
+   * @param[in]     *pState     points to the state buffer of numTaps+blockSize-1 samples.
+   * @param[in]     *pSpectrum  points to the spectrum buffer of 2*fftLen values.
+   * @param[in]     *pScratch   points to the scratch buffer of 2*fftLen values.
+   * @param[in]     blockSize   largest number of samples processed per call.
+   * @return        none.
+   */
+
+  void arm_fir_fft_init_q31(
+			    arm_fir_fft_instance_q31 * S,
+			    uint16_t numTaps,
+			    q31_t * pCoeffs,
+			    q31_t * pState,
+			    q31_t * pSpectrum,
+			    q31_t * pScratch,
+			    uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FFT based FIR filter.
+   * @param[in]  *S         points to an instance of the Q31 FFT based FIR structure.
+   * @param[in]  *pSrc      points to the block of input data.
+   * @param[out] *pDst      points to the block of output data.
+   * @param[in]  blockSize  number of samples to process.
+   * @return none.
+   */
+
+  void arm_fir_fft_q31(
+		       const arm_fir_fft_instance_q31 * S,
+		       q31_t * pSrc,
+		       q31_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief  Length of the FFTs of the FFT based FIR filters.
+   * @param[in]  numTaps    number of filter coefficients in the filter.
+   * @param[in]  blockSize  largest number of samples processed per call.
+   * @return The radix-4 length of the FFTs, or 0 when the direct form is cheaper.
+   */
+
+  uint16_t arm_fir_fft_len(
+			   uint16_t numTaps,
+			   uint32_t blockSize);
+
   /**
    * @brief  Initialization function for the floating-point CFFT/CIFFT.
    * @param[in,out] *S             points to an instance of the floating-point CFFT/CIFFT structure.
@@ -2006,6 +3114,171 @@ extern "C"
 				      uint8_t ifftFlag,
 				      uint8_t bitReverseFlag);
 
+  /**
+   * @brief Instance structure for the Q15 radix-2 CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t  fftLen;                /**< length of the FFT. */
+    uint8_t   ifftFlag;              /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t   bitReverseFlag;        /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    q15_t     *pTwiddle;             /**< points to the twiddle factor table. */
+    uint16_t  *pBitRevTable;         /**< points to the bit reversal table. */
+    uint16_t  twidCoefModifier;      /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t  bitRevFactor;          /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+  } arm_cfft_radix2_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 radix-2 CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t    fftLen;              /**< length of the FFT. */
+    uint8_t     ifftFlag;            /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t     bitReverseFlag;      /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    q31_t       *pTwiddle;           /**< points to the twiddle factor table. */
+    uint16_t    *pBitRevTable;       /**< points to the bit reversal table. */
+    uint16_t    twidCoefModifier;    /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t    bitRevFactor;        /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+  } arm_cfft_radix2_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point radix-2 CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t     fftLen;               /**< length of the FFT. */
+    uint8_t      ifftFlag;             /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t      bitReverseFlag;       /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    float32_t    *pTwiddle;            /**< points to the twiddle factor table. */
+    uint16_t     *pBitRevTable;        /**< points to the bit reversal table. */
+    uint16_t     twidCoefModifier;     /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    uint16_t     bitRevFactor;         /**< bit reversal modifier that supports different size FFTs with the same bit reversal table. */
+    float32_t    onebyfftLen;          /**< value of 1/fftLen. */
+  } arm_cfft_radix2_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 radix-2 CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the Q15 radix-2 CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex data buffer. Processing occurs in-place.
+   * @return none.
+   */
+
+  void arm_cfft_radix2_q15(
+			   const arm_cfft_radix2_instance_q15 * S,
+			   q15_t * pSrc);
+
+  /**
+   * @brief Initialization function for the Q15 radix-2 CFFT/CIFFT.
+   * @param[in,out] *S             points to an instance of the Q15 radix-2 CFFT/CIFFT structure.
+   * @param[in]     fftLen         length of the FFT, a power of 2 from 16 to 1024.
+   * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @return        arm_status     function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+   */
+
+  arm_status arm_cfft_radix2_init_q15(
+				      arm_cfft_radix2_instance_q15 * S,
+				      uint16_t fftLen,
+				      uint8_t ifftFlag,
+				      uint8_t bitReverseFlag);
+
+  /**
+   * @brief Processing function for the Q31 radix-2 CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the Q31 radix-2 CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex data buffer. Processing occurs in-place.
+   * @return none.
+   */
+
+  void arm_cfft_radix2_q31(
+			   const arm_cfft_radix2_instance_q31 * S,
+			   q31_t * pSrc);
+
+  /**
+   * @brief Initialization function for the Q31 radix-2 CFFT/CIFFT.
+   * @param[in,out] *S             points to an instance of the Q31 radix-2 CFFT/CIFFT structure.
+   * @param[in]     fftLen         length of the FFT, a power of 2 from 16 to 1024.
+   * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @return        arm_status     function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+   */
+
+  arm_status arm_cfft_radix2_init_q31(
+				      arm_cfft_radix2_instance_q31 * S,
+				      uint16_t fftLen,
+				      uint8_t ifftFlag,
+				      uint8_t bitReverseFlag);
+
+  /**
+   * @brief Processing function for the floating-point radix-2 CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the floating-point radix-2 CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex data buffer. Processing occurs in-place.
+   * @return none.
+   */
+
+  void arm_cfft_radix2_f32(
+			   const arm_cfft_radix2_instance_f32 * S,
+			   float32_t * pSrc);
+
+  /**
+   * @brief Initialization function for the floating-point radix-2 CFFT/CIFFT.
+   * @param[in,out] *S             points to an instance of the floating-point radix-2 CFFT/CIFFT structure.
+   * @param[in]     fftLen         length of the FFT, a power of 2 from 16 to 1024.
+   * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @return        arm_status     function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+   */
+
+  arm_status arm_cfft_radix2_init_f32(
+				      arm_cfft_radix2_instance_f32 * S,
+				      uint16_t fftLen,
+				      uint8_t ifftFlag,
+				      uint8_t bitReverseFlag);
+
+  /**
+   * @brief Instance structure for the floating-point mixed radix CFFT/CIFFT function.
+   */
+
+  typedef struct
+  {
+    uint16_t     fftLen;               /**< length of the FFT. */
+    uint8_t      ifftFlag;             /**< flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform. */
+    uint8_t      bitReverseFlag;       /**< flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output. */
+    const float32_t *pTwiddle;         /**< points to the twiddle factors of the radix-8 stages. */
+    const uint16_t  *pBitRevTable;     /**< points to the pairs of indexes swapped by the bit reversal. */
+    uint16_t     bitRevLength;         /**< number of entries of the bit reversal table. */
+    float32_t    onebyfftLen;          /**< value of 1/fftLen. */
+  } arm_cfft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point mixed radix CFFT/CIFFT.
+   * @param[in]      *S    points to an instance of the floating-point mixed radix CFFT/CIFFT structure.
+   * @param[in, out] *pSrc points to the complex data buffer. Processing occurs in-place.
+   * @return none.
+   */
+
+  void arm_cfft_f32(
+		    const arm_cfft_instance_f32 * S,
+		    float32_t * pSrc);
+
+  /**
+   * @brief  Initialization function for the floating-point mixed radix CFFT/CIFFT.
+   * @param[in,out] *S             points to an instance of the floating-point mixed radix CFFT/CIFFT structure.
+   * @param[in]     fftLen         length of the FFT, a power of two from 16 to 4096.
+   * @param[in]     ifftFlag       flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+   * @param[in]     bitReverseFlag flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
+   */
+
+  arm_status arm_cfft_init_f32(
+			       arm_cfft_instance_f32 * S,
+			       uint16_t fftLen,
+			       uint8_t ifftFlag,
+			       uint8_t bitReverseFlag);
+
 
 
   /*----------------------------------------------------------------------
@@ -2150,23 +3423,70 @@ extern "C"
 			   uint16_t *pBitRevTab);
 
   /**
-   * @brief Instance structure for the Q15 RFFT/RIFFT function.
+   * @brief  Core functions of the radix-2 CFFT and CIFFT butterfly processes, in each data type.
+   * @param[in, out] *pSrc            points to the in-place buffer.
+   * @param[in]      fftLen           length of the FFT.
+   * @param[in]      *pCoef           points to twiddle coefficient buffer.
+   * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table.
+   * @param[in]      onebyfftLen      value of 1/fftLen, for the floating-point CIFFT.
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint32_t fftLenReal;                      /**< length of the real FFT. */
-    uint32_t fftLenBy2;                       /**< length of the complex FFT. */
-    uint8_t  ifftFlagR;                       /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
-	uint8_t  bitReverseFlagR;                 /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
-    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */  
-    q15_t    *pTwiddleAReal;                  /**< points to the real twiddle factor table. */
-    q15_t    *pTwiddleBReal;                  /**< points to the imag twiddle factor table. */
-    arm_cfft_radix4_instance_q15 *pCfft;	  /**< points to the complex FFT instance. */
-  } arm_rfft_instance_q15;
+  void arm_radix2_butterfly_f32(
+				float32_t * pSrc,
+				uint32_t fftLen,
+				float32_t * pCoef,
+				uint16_t twidCoefModifier);
 
-  /**
-   * @brief Instance structure for the Q31 RFFT/RIFFT function.
+  void arm_radix2_butterfly_inverse_f32(
+					float32_t * pSrc,
+					uint32_t fftLen,
+					float32_t * pCoef,
+					uint16_t twidCoefModifier,
+					float32_t onebyfftLen);
+
+  void arm_radix2_butterfly_q31(
+				q31_t * pSrc,
+				uint32_t fftLen,
+				q31_t * pCoef,
+				uint16_t twidCoefModifier);
+
+  void arm_radix2_butterfly_inverse_q31(
+					q31_t * pSrc,
+					uint32_t fftLen,
+					q31_t * pCoef,
+					uint16_t twidCoefModifier);
+
+  void arm_radix2_butterfly_q15(
+				q15_t * pSrc,
+				uint32_t fftLen,
+				q15_t * pCoef,
+				uint16_t twidCoefModifier);
+
+  void arm_radix2_butterfly_inverse_q15(
+					q15_t * pSrc,
+					uint32_t fftLen,
+					q15_t * pCoef,
+					uint16_t twidCoefModifier);
+
+  /**
+   * @brief Instance structure for the Q15 RFFT/RIFFT function.
+   */
+
+  typedef struct
+  {
+    uint32_t fftLenReal;                      /**< length of the real FFT. */
+    uint32_t fftLenBy2;                       /**< length of the complex FFT. */
+    uint8_t  ifftFlagR;                       /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+	uint8_t  bitReverseFlagR;                 /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+    uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */  
+    q15_t    *pTwiddleAReal;                  /**< points to the real twiddle factor table. */
+    q15_t    *pTwiddleBReal;                  /**< points to the imag twiddle factor table. */
+    arm_cfft_radix4_instance_q15 *pCfft;	  /**< points to the complex FFT instance. */
+  } arm_rfft_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 RFFT/RIFFT function.
    */
 
   typedef struct
@@ -2288,1957 +3608,2121 @@ extern "C"
 		    float32_t * pDst);
 
   /**
-   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
+   * @brief Instance structure for the floating-point in-place RFFT/RIFFT function.
    */
 
   typedef struct
   {
-    uint16_t N;                         /**< length of the DCT4. */
-    uint16_t Nby2;                      /**< half of the length of the DCT4. */
-    float32_t normalize;                /**< normalizing factor. */
-    float32_t *pTwiddle;                /**< points to the twiddle factor table. */
-    float32_t *pCosFactor;              /**< points to the cosFactor table. */
-    arm_rfft_instance_f32 *pRfft;        /**< points to the real FFT instance. */
-    arm_cfft_radix4_instance_f32 *pCfft; /**< points to the complex FFT instance. */
-  } arm_dct4_instance_f32;
+    arm_cfft_instance_f32 Sint;        /**< internal CFFT structure of length fftLenRFFT/2. */
+    uint16_t     fftLenRFFT;           /**< length of the real sequence. */
+    const float32_t *pTwiddleRFFT;     /**< points to the twiddle factors of the split step. */
+  } arm_rfft_fast_instance_f32;
 
   /**
-   * @brief  Initialization function for the floating-point DCT4/IDCT4.
-   * @param[in,out] *S         points to an instance of floating-point DCT4/IDCT4 structure.
-   * @param[in]     *S_RFFT    points to an instance of floating-point RFFT/RIFFT structure.
-   * @param[in]     *S_CFFT    points to an instance of floating-point CFFT/CIFFT structure.
-   * @param[in]     N          length of the DCT4.
-   * @param[in]     Nby2       half of the length of the DCT4.
-   * @param[in]     normalize  normalizing factor.
-   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported transform length.
+   * @brief  Initialization function for the floating-point in-place RFFT/RIFFT.
+   * @param[in,out] *S      points to an instance of the floating-point in-place RFFT/RIFFT structure.
+   * @param[in]     fftLen  length of the real sequence, a power of two from 32 to 4096.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> is not a supported value.
    */
 
-  arm_status arm_dct4_init_f32(
-			       arm_dct4_instance_f32 * S,
-			       arm_rfft_instance_f32 * S_RFFT,
-			       arm_cfft_radix4_instance_f32 * S_CFFT,
-			       uint16_t N,
-			       uint16_t Nby2,
-			       float32_t normalize);
+  arm_status arm_rfft_fast_init_f32(
+				    arm_rfft_fast_instance_f32 * S,
+				    uint16_t fftLen);
 
   /**
-   * @brief Processing function for the floating-point DCT4/IDCT4.
-   * @param[in]       *S             points to an instance of the floating-point DCT4/IDCT4 structure.
-   * @param[in]       *pState        points to state buffer.
-   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
+   * @brief Processing function for the floating-point in-place RFFT/RIFFT.
+   * @param[in]      *S       points to an instance of the floating-point in-place RFFT/RIFFT structure.
+   * @param[in, out] *pSrc    points to the buffer of fftLen values: the real sequence, or the packed spectrum for the RIFFT.
+   * @param[in]      ifftFlag flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
    * @return none.
    */
 
-  void arm_dct4_f32(
-		    const arm_dct4_instance_f32 * S,
-		    float32_t * pState,
-		    float32_t * pInlineBuffer);
+  void arm_rfft_fast_f32(
+			 const arm_rfft_fast_instance_f32 * S,
+			 float32_t * pSrc,
+			 uint8_t ifftFlag);
 
   /**
-   * @brief Instance structure for the Q31 DCT4/IDCT4 function.
+   * @brief Magnitude spectrum of a real sequence, the split step of the RFFT computing the magnitudes.
+   * @param[in]      *S    points to an instance of the floating-point in-place RFFT/RIFFT structure.
+   * @param[in, out] *pSrc points to the real sequence of fftLen values, overwritten.
+   * @param[out]     *pMag points to the fftLen/2 magnitudes, bins 0 to fftLen/2-1.
+   * @return none.
+   */
+
+  void arm_rfft_fast_mag_f32(
+			     const arm_rfft_fast_instance_f32 * S,
+			     float32_t * pSrc,
+			     float32_t * pMag);
+
+  /**
+   * @brief Power spectrum of a real sequence, the split step of the RFFT computing the squared magnitudes.
+   * @param[in]      *S    points to an instance of the floating-point in-place RFFT/RIFFT structure.
+   * @param[in, out] *pSrc points to the real sequence of fftLen values, overwritten.
+   * @param[out]     *pPow points to the fftLen/2 squared magnitudes, bins 0 to fftLen/2-1.
+   * @return none.
+   */
+
+  void arm_rfft_fast_power_f32(
+			       const arm_rfft_fast_instance_f32 * S,
+			       float32_t * pSrc,
+			       float32_t * pPow);
+
+  /**
+   * @brief Instance structure for the floating-point partitioned FIR filter.
    */
 
   typedef struct
   {
-    uint16_t N;                         /**< length of the DCT4. */
-    uint16_t Nby2;                      /**< half of the length of the DCT4. */
-    q31_t normalize;                    /**< normalizing factor. */
-    q31_t *pTwiddle;                    /**< points to the twiddle factor table. */
-    q31_t *pCosFactor;                  /**< points to the cosFactor table. */
-    arm_rfft_instance_q31 *pRfft;        /**< points to the real FFT instance. */
-    arm_cfft_radix4_instance_q31 *pCfft; /**< points to the complex FFT instance. */
-  } arm_dct4_instance_q31;
+    arm_rfft_fast_instance_f32 Srfft;  /**< internal real FFT structure of length 2*partLen. */
+    uint16_t partLen;                  /**< length of the partitions, the number of samples per block. */
+    uint16_t numParts;                 /**< number of partitions of the coefficients. */
+    uint16_t fdlIndex;                 /**< slot of the delay line receiving the next block. */
+    float32_t *pSpectra;               /**< points to the numParts spectra of the partitions of the coefficients. */
+    float32_t *pFdl;                   /**< points to the frequency domain delay line of numParts spectra. */
+    float32_t *pState;                 /**< points to the state buffer of length partLen. */
+    float32_t *pScratch;               /**< points to the scratch buffer of length 2*partLen. */
+  } arm_fir_partitioned_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FIR filter.
+   * @param[in,out] *S         points to an instance of the floating-point partitioned FIR structure.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the filter coefficients, in time reversed order.
+   * @param[in]     partLen    length of the partitions and latency, a power of two from 16 to 2048.
+   * @param[in]     *pArena    points to the spectra arena of 4*numParts*partLen values.
+   * @param[in]     *pState    points to the state buffer of partLen samples.
+   * @param[in]     *pScratch  points to the scratch buffer of 2*partLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>partLen</code> is not a supported value.
+   */
+
+  arm_status arm_fir_partitioned_init_f32(
+					  arm_fir_partitioned_instance_f32 * S,
+					  uint16_t numTaps,
+					  float32_t * pCoeffs,
+					  uint16_t partLen,
+					  float32_t * pArena,
+					  float32_t * pState,
+					  float32_t * pScratch);
 
   /**
-   * @brief  Initialization function for the Q31 DCT4/IDCT4.
-   * @param[in,out] *S         points to an instance of Q31 DCT4/IDCT4 structure.
-   * @param[in]     *S_RFFT    points to an instance of Q31 RFFT/RIFFT structure
-   * @param[in]     *S_CFFT    points to an instance of Q31 CFFT/CIFFT structure
-   * @param[in]     N          length of the DCT4.
-   * @param[in]     Nby2       half of the length of the DCT4.
-   * @param[in]     normalize  normalizing factor.
-   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   * @brief Processing function for the floating-point partitioned FIR filter.
+   * @param[in,out] *S         points to an instance of the floating-point partitioned FIR structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[out]    *pDst      points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of partLen.
+   * @return none.
    */
 
-  arm_status arm_dct4_init_q31(
-			       arm_dct4_instance_q31 * S,
-			       arm_rfft_instance_q31 * S_RFFT,
-			       arm_cfft_radix4_instance_q31 * S_CFFT,
-			       uint16_t N,
-			       uint16_t Nby2,
-			       q31_t normalize);
+  void arm_fir_partitioned_f32(
+			       arm_fir_partitioned_instance_f32 * S,
+			       float32_t * pSrc,
+			       float32_t * pDst,
+			       uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 DCT4/IDCT4.
-   * @param[in]       *S             points to an instance of the Q31 DCT4 structure.
-   * @param[in]       *pState        points to state buffer.
-   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
-   * @return none.
+   * @brief Instance structure for the floating-point STFT.
    */
 
-  void arm_dct4_q31(
-		    const arm_dct4_instance_q31 * S,
-		    q31_t * pState,
-		    q31_t * pInlineBuffer);
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 Srfft;  /**< internal real FFT structure of length fftLen. */
+    uint16_t fftLen;                   /**< length of the frames. */
+    uint16_t hopSize;                  /**< number of samples between two frames. */
+    uint16_t writeOffset;              /**< write offset in the circular state buffer, the oldest sample. */
+    uint16_t count;                    /**< number of samples written since the last frame. */
+    uint8_t powerFlag;                 /**< flag that selects the magnitude (powerFlag=0) or the power (powerFlag=1) output. */
+    const float32_t *pWindow;          /**< points to the window coefficients of length fftLen. */
+    float32_t *pState;                 /**< points to the circular state buffer of length fftLen. */
+    float32_t *pScratch;               /**< points to the scratch buffer of length fftLen. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point STFT.
+   * @param[in,out] *S         points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen     length of the frames and of the real FFT.
+   * @param[in]     hopSize    number of samples between two frames, 1 to fftLen.
+   * @param[in]     *pWindow   points to the window, fftLen coefficients.
+   * @param[in]     *pState    points to the state buffer of fftLen samples.
+   * @param[in]     *pScratch  points to the scratch buffer of fftLen values.
+   * @param[in]     powerFlag  selects the magnitude (powerFlag=0) or the power (powerFlag=1) output.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code> or <code>hopSize</code> is not a supported value.
+   */
+
+  arm_status arm_stft_init_f32(
+			       arm_stft_instance_f32 * S,
+			       uint16_t fftLen,
+			       uint16_t hopSize,
+			       const float32_t * pWindow,
+			       float32_t * pState,
+			       float32_t * pScratch,
+			       uint8_t powerFlag);
 
   /**
-   * @brief Instance structure for the Q15 DCT4/IDCT4 function.
+   * @brief Processing function for the floating-point STFT.
+   * @param[in,out] *S         points to an instance of the floating-point STFT structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[out]    *pDst      points to the frames, fftLen/2 values each.
+   * @return The number of frames written to <code>pDst</code>.
+   */
+
+  uint32_t arm_stft_f32(
+			arm_stft_instance_f32 * S,
+			const float32_t * pSrc,
+			uint32_t blockSize,
+			float32_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point FFT based cross-correlation (GCC).
    */
 
   typedef struct
   {
-    uint16_t N;                         /**< length of the DCT4. */
-    uint16_t Nby2;                      /**< half of the length of the DCT4. */
-    q15_t normalize;                    /**< normalizing factor. */
-    q15_t *pTwiddle;                    /**< points to the twiddle factor table. */
-    q15_t *pCosFactor;                  /**< points to the cosFactor table. */
-    arm_rfft_instance_q15 *pRfft;        /**< points to the real FFT instance. */
-    arm_cfft_radix4_instance_q15 *pCfft; /**< points to the complex FFT instance. */
-  } arm_dct4_instance_q15;
+    arm_rfft_fast_instance_f32 Srfft;  /**< internal real FFT structure of length fftLen. */
+    uint16_t frameLen;                 /**< number of samples per frame. */
+    uint16_t fftLen;                   /**< length of the spectra, at least frameLen+maxLag. */
+    uint16_t maxLag;                   /**< largest lag searched, in samples. */
+    float32_t *pScratch;               /**< points to the scratch buffer of length fftLen. */
+  } arm_gcc_instance_f32;
 
   /**
-   * @brief  Initialization function for the Q15 DCT4/IDCT4.
-   * @param[in,out] *S         points to an instance of Q15 DCT4/IDCT4 structure.
-   * @param[in]     *S_RFFT    points to an instance of Q15 RFFT/RIFFT structure.
-   * @param[in]     *S_CFFT    points to an instance of Q15 CFFT/CIFFT structure.
-   * @param[in]     N          length of the DCT4.
-   * @param[in]     Nby2       half of the length of the DCT4.
-   * @param[in]     normalize  normalizing factor.
-   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   * @brief  Initialization function for the floating-point FFT based cross-correlation.
+   * @param[in,out] *S         points to an instance of the floating-point GCC structure.
+   * @param[in]     frameLen   number of samples per frame.
+   * @param[in]     maxLag     largest lag searched, below frameLen.
+   * @param[in]     *pScratch  points to the scratch buffer of fftLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>frameLen+maxLag</code> exceeds 4096 or <code>maxLag</code> is not below <code>frameLen</code>.
    */
 
-  arm_status arm_dct4_init_q15(
-			       arm_dct4_instance_q15 * S,
-			       arm_rfft_instance_q15 * S_RFFT,
-			       arm_cfft_radix4_instance_q15 * S_CFFT,
-			       uint16_t N,
-			       uint16_t Nby2,
-			       q15_t normalize);
+  arm_status arm_gcc_init_f32(
+			      arm_gcc_instance_f32 * S,
+			      uint16_t frameLen,
+			      uint16_t maxLag,
+			      float32_t * pScratch);
 
   /**
-   * @brief Processing function for the Q15 DCT4/IDCT4.
-   * @param[in]       *S             points to an instance of the Q15 DCT4 structure.
-   * @param[in]       *pState        points to state buffer.
-   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
+   * @brief Spectrum of a frame, computed once per channel and shared by its pairs.
+   * @param[in]  *S     points to an instance of the floating-point GCC structure.
+   * @param[in]  *pSrc  points to the frame of frameLen samples.
+   * @param[out] *pSpec points to the packed spectrum, fftLen values.
    * @return none.
    */
 
-  void arm_dct4_q15(
-		    const arm_dct4_instance_q15 * S,
-		    q15_t * pState,
-		    q15_t * pInlineBuffer);
+  void arm_gcc_spectrum_f32(
+			    const arm_gcc_instance_f32 * S,
+			    const float32_t * pSrc,
+			    float32_t * pSpec);
 
   /**
-   * @brief Floating-point vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief Cross-correlation of two channels from their spectra, with the sub-sample lag of its peak.
+   * @param[in]  *S         points to an instance of the floating-point GCC structure.
+   * @param[in]  *pSpecA    points to the spectrum of the channel A.
+   * @param[in]  *pSpecB    points to the spectrum of the channel B.
+   * @param[in]  phatFlag   selects the plain (phatFlag=0) or the PHAT weighted (phatFlag=1) correlation.
+   * @param[out] *pCorr     points to the 2*maxLag+1 correlation values, lags -maxLag to maxLag.
+   * @param[out] *pLag      lag of the peak in samples, positive when A is delayed from B.
+   * @param[out] *pPeak     value of the peak.
    * @return none.
    */
 
-  void arm_add_f32(
-		   float32_t * pSrcA,
-		   float32_t * pSrcB,
-		   float32_t * pDst,
-		   uint32_t blockSize);
+  void arm_gcc_f32(
+		   const arm_gcc_instance_f32 * S,
+		   const float32_t * pSpecA,
+		   const float32_t * pSpecB,
+		   uint8_t phatFlag,
+		   float32_t * pCorr,
+		   float32_t * pLag,
+		   float32_t * pPeak);
 
   /**
-   * @brief Q7 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Instance structure for the floating-point Goertzel algorithm.
    */
 
-  void arm_add_q7(
-		  q7_t * pSrcA,
-		  q7_t * pSrcB,
-		  q7_t * pDst,
-		  uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    const float32_t *pCoeffs;          /**< points to the cosines of the bin frequencies. */
+    float32_t *pState;                 /**< points to the state buffer of length 2*numBins. */
+  } arm_goertzel_instance_f32;
 
   /**
-   * @brief Q15 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  Initialization function for the floating-point Goertzel algorithm.
+   * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     *pCoeffs   points to the cosines of the bin frequencies.
+   * @param[in]     *pState    points to the state buffer of 2*numBins values.
    * @return none.
    */
 
-  void arm_add_q15(
-		    q15_t * pSrcA,
-		    q15_t * pSrcB,
-		   q15_t * pDst,
-		   uint32_t blockSize);
+  void arm_goertzel_init_f32(
+				  arm_goertzel_instance_f32 * S,
+				  uint16_t numBins,
+				  const float32_t * pCoeffs,
+				  float32_t * pState);
 
   /**
-   * @brief Q31 vector addition.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief Processing function for the floating-point Goertzel algorithm.
+   * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
    * @return none.
    */
 
-  void arm_add_q31(
-		    q31_t * pSrcA,
-		    q31_t * pSrcB,
-		   q31_t * pDst,
-		   uint32_t blockSize);
+  void arm_goertzel_f32(
+			 arm_goertzel_instance_f32 * S,
+			 const float32_t * pSrc,
+			 uint32_t blockSize);
 
   /**
-   * @brief Floating-point vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief Power of the bins of the floating-point Goertzel algorithm, clearing the state.
+   * @param[in,out] *S     points to an instance of the floating-point Goertzel structure.
+   * @param[out]    *pDst  points to the numBins powers.
    * @return none.
    */
 
-  void arm_sub_f32(
-		    float32_t * pSrcA,
-		    float32_t * pSrcB,
-		   float32_t * pDst,
-		   uint32_t blockSize);
+  void arm_goertzel_power_f32(
+			       arm_goertzel_instance_f32 * S,
+			       float32_t * pDst);
 
   /**
-   * @brief Q7 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Instance structure for the Q15 Goertzel algorithm.
    */
 
-  void arm_sub_q7(
-		   q7_t * pSrcA,
-		   q7_t * pSrcB,
-		  q7_t * pDst,
-		  uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    const q15_t *pCoeffs;              /**< points to the cosines of the bin frequencies. */
+    q31_t *pState;                     /**< points to the state buffer of length 2*numBins. */
+  } arm_goertzel_instance_q15;
 
   /**
-   * @brief Q15 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  Initialization function for the Q15 Goertzel algorithm.
+   * @param[in,out] *S         points to an instance of the Q15 Goertzel structure.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     *pCoeffs   points to the cosines of the bin frequencies.
+   * @param[in]     *pState    points to the state buffer of 2*numBins values.
    * @return none.
    */
 
-  void arm_sub_q15(
-		    q15_t * pSrcA,
-		    q15_t * pSrcB,
-		   q15_t * pDst,
-		   uint32_t blockSize);
+  void arm_goertzel_init_q15(
+				  arm_goertzel_instance_q15 * S,
+				  uint16_t numBins,
+				  const q15_t * pCoeffs,
+				  q31_t * pState);
 
   /**
-   * @brief Q31 vector subtraction.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in each vector
+   * @brief Processing function for the Q15 Goertzel algorithm.
+   * @param[in,out] *S         points to an instance of the Q15 Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
    * @return none.
    */
 
-  void arm_sub_q31(
-		    q31_t * pSrcA,
-		    q31_t * pSrcB,
-		   q31_t * pDst,
-		   uint32_t blockSize);
+  void arm_goertzel_q15(
+			 arm_goertzel_instance_q15 * S,
+			 q15_t * pSrc,
+			 uint32_t blockSize);
 
   /**
-   * @brief Multiplies a floating-point vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scale scale factor to be applied
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
+   * @brief Power of the bins of the Q15 Goertzel algorithm, clearing the state.
+   * @param[in,out] *S     points to an instance of the Q15 Goertzel structure.
+   * @param[out]    *pDst  points to the numBins powers.
    * @return none.
    */
 
-  void arm_scale_f32(
-		      float32_t * pSrc,
-		     float32_t scale,
-		     float32_t * pDst,
-		     uint32_t blockSize);
+  void arm_goertzel_power_q15(
+			       arm_goertzel_instance_q15 * S,
+			       q63_t * pDst);
 
   /**
-   * @brief Multiplies a Q7 vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scaleFract fractional portion of the scale value
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
-   * @return none.
+   * @brief Instance structure for the Q31 Goertzel algorithm.
    */
 
-  void arm_scale_q7(
-		     q7_t * pSrc,
-		    q7_t scaleFract,
-		    int8_t shift,
-		    q7_t * pDst,
-		    uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t numBins;                  /**< number of bins. */
+    uint8_t shift;                     /**< number of bits the input is shifted right by. */
+    const q31_t *pCoeffs;              /**< points to the cosines of the bin frequencies. */
+    q31_t *pState;                     /**< points to the state buffer of length 2*numBins. */
+  } arm_goertzel_instance_q31;
 
   /**
-   * @brief Multiplies a Q15 vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scaleFract fractional portion of the scale value
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
+   * @brief  Initialization function for the Q31 Goertzel algorithm.
+   * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     *pCoeffs   points to the cosines of the bin frequencies.
+   * @param[in]     *pState    points to the state buffer of 2*numBins values.
+   * @param[in]     shift      number of bits the input is shifted right by.
    * @return none.
    */
 
-  void arm_scale_q15(
-		      q15_t * pSrc,
-		     q15_t scaleFract,
-		     int8_t shift,
-		     q15_t * pDst,
-		     uint32_t blockSize);
+  void arm_goertzel_init_q31(
+				  arm_goertzel_instance_q31 * S,
+				  uint16_t numBins,
+				  const q31_t * pCoeffs,
+				  q31_t * pState,
+				  uint8_t shift);
 
   /**
-   * @brief Multiplies a Q31 vector by a scalar.
-   * @param[in]       *pSrc points to the input vector
-   * @param[in]       scaleFract fractional portion of the scale value
-   * @param[in]       shift number of bits to shift the result by
-   * @param[out]      *pDst points to the output vector
-   * @param[in]       blockSize number of samples in the vector
+   * @brief Processing function for the Q31 Goertzel algorithm.
+   * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
    * @return none.
    */
 
-  void arm_scale_q31(
-		      q31_t * pSrc,
-		     q31_t scaleFract,
-		     int8_t shift,
-		     q31_t * pDst,
-		     uint32_t blockSize);
+  void arm_goertzel_q31(
+			 arm_goertzel_instance_q31 * S,
+			 q31_t * pSrc,
+			 uint32_t blockSize);
 
   /**
-   * @brief Q7 vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
+   * @brief Power of the bins of the Q31 Goertzel algorithm, clearing the state.
+   * @param[in,out] *S     points to an instance of the Q31 Goertzel structure.
+   * @param[out]    *pDst  points to the numBins powers.
    * @return none.
    */
 
-  void arm_abs_q7(
-		   q7_t * pSrc,
-		  q7_t * pDst,
-		  uint32_t blockSize);
+  void arm_goertzel_power_q31(
+			       arm_goertzel_instance_q31 * S,
+			       q63_t * pDst);
 
   /**
-   * @brief Floating-point vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
-   * @return none.
+   * @brief Instance structure for the floating-point sliding DFT.
    */
 
-  void arm_abs_f32(
-		    float32_t * pSrc,
-		   float32_t * pDst,
-		   uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the DFT window. */
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t delayIndex;               /**< index of the oldest sample in the delay line. */
+    const float32_t *pTwiddle;         /**< points to the twiddles of the bins, interleaved cos and sin. */
+    float32_t *pDelay;                 /**< points to the delay line of length fftLen. */
+    float32_t *pState;                 /**< points to the bins, complex interleaved, of length 2*numBins. */
+  } arm_sdft_instance_f32;
 
   /**
-   * @brief Q15 vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     fftLen     length of the DFT window.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     *pTwiddle  points to the twiddles of the bins, 2*numBins values.
+   * @param[in]     *pDelay    points to the delay line of fftLen samples.
+   * @param[in]     *pState    points to the bins, 2*numBins values.
    * @return none.
    */
 
-  void arm_abs_q15(
-		    q15_t * pSrc,
-		   q15_t * pDst,
-		   uint32_t blockSize);
+  void arm_sdft_init_f32(
+			 arm_sdft_instance_f32 * S,
+			 uint16_t fftLen,
+			 uint16_t numBins,
+			 const float32_t * pTwiddle,
+			 float32_t * pDelay,
+			 float32_t * pState);
 
   /**
-   * @brief Q31 vector absolute value.
-   * @param[in]       *pSrc points to the input buffer
-   * @param[out]      *pDst points to the output buffer
-   * @param[in]       blockSize number of samples in each vector
+   * @brief Processing function for the floating-point sliding DFT.
+   * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
    * @return none.
    */
 
-  void arm_abs_q31(
-		    q31_t * pSrc,
-		   q31_t * pDst,
-		   uint32_t blockSize);
+  void arm_sdft_f32(
+		    arm_sdft_instance_f32 * S,
+		    const float32_t * pSrc,
+		    uint32_t blockSize);
 
   /**
-   * @brief Dot product of floating-point vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
-   * @return none.
+   * @brief Instance structure for the Q15 sliding DFT.
    */
 
-  void arm_dot_prod_f32(
-			 float32_t * pSrcA,
-			 float32_t * pSrcB,
-			uint32_t blockSize,
-			float32_t * result);
+  typedef struct
+  {
+    uint16_t fftLen;                   /**< length of the DFT window. */
+    uint16_t numBins;                  /**< number of bins. */
+    uint16_t delayIndex;               /**< index of the oldest sample in the delay line. */
+    uint8_t shift;                     /**< number of bits the input is shifted right by, log2(fftLen) rounded up. */
+    const q15_t *pTwiddle;             /**< points to the twiddles of the bins, interleaved cos and sin. */
+    q15_t *pDelay;                     /**< points to the delay line of length fftLen. */
+    q15_t *pState;                     /**< points to the bins, complex interleaved, of length 2*numBins. */
+  } arm_sdft_instance_q15;
 
   /**
-   * @brief Dot product of Q7 vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
+   * @brief  Initialization function for the Q15 sliding DFT.
+   * @param[in,out] *S         points to an instance of the Q15 sliding DFT structure.
+   * @param[in]     fftLen     length of the DFT window.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     *pTwiddle  points to the twiddles of the bins, 2*numBins values.
+   * @param[in]     *pDelay    points to the delay line of fftLen samples.
+   * @param[in]     *pState    points to the bins, 2*numBins values.
    * @return none.
    */
 
-  void arm_dot_prod_q7(
-		        q7_t * pSrcA,
-		        q7_t * pSrcB,
-		       uint32_t blockSize,
-		       q31_t * result);
+  void arm_sdft_init_q15(
+			 arm_sdft_instance_q15 * S,
+			 uint16_t fftLen,
+			 uint16_t numBins,
+			 const q15_t * pTwiddle,
+			 q15_t * pDelay,
+			 q15_t * pState);
 
   /**
-   * @brief Dot product of Q15 vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
+   * @brief Processing function for the Q15 sliding DFT.
+   * @param[in,out] *S         points to an instance of the Q15 sliding DFT structure.
+   * @param[in]     *pSrc      points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
    * @return none.
    */
 
-  void arm_dot_prod_q15(
-			 q15_t * pSrcA,
-			 q15_t * pSrcB,
-			uint32_t blockSize,
-			q63_t * result);
+  void arm_sdft_q15(
+		    arm_sdft_instance_q15 * S,
+		    q15_t * pSrc,
+		    uint32_t blockSize);
 
   /**
-   * @brief Dot product of Q31 vectors.
-   * @param[in]       *pSrcA points to the first input vector
-   * @param[in]       *pSrcB points to the second input vector
-   * @param[in]       blockSize number of samples in each vector
-   * @param[out]      *result output result returned here
-   * @return none.
+   * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
 
-  void arm_dot_prod_q31(
-			 q31_t * pSrcA,
-			 q31_t * pSrcB,
-			uint32_t blockSize,
-			q63_t * result);
+  typedef struct
+  {
+    uint16_t N;                         /**< length of the DCT4. */
+    uint16_t Nby2;                      /**< half of the length of the DCT4. */
+    float32_t normalize;                /**< normalizing factor. */
+    float32_t *pTwiddle;                /**< points to the twiddle factor table. */
+    float32_t *pCosFactor;              /**< points to the cosFactor table. */
+    arm_rfft_instance_f32 *pRfft;        /**< points to the real FFT instance. */
+    arm_cfft_radix4_instance_f32 *pCfft; /**< points to the complex FFT instance. */
+  } arm_dct4_instance_f32;
 
   /**
-   * @brief  Shifts the elements of a Q7 vector a specified number of bits.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief  Initialization function for the floating-point DCT4/IDCT4.
+   * @param[in,out] *S         points to an instance of floating-point DCT4/IDCT4 structure.
+   * @param[in]     *S_RFFT    points to an instance of floating-point RFFT/RIFFT structure.
+   * @param[in]     *S_CFFT    points to an instance of floating-point CFFT/CIFFT structure.
+   * @param[in]     N          length of the DCT4.
+   * @param[in]     Nby2       half of the length of the DCT4.
+   * @param[in]     normalize  normalizing factor.
+   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>fftLenReal</code> is not a supported transform length.
    */
 
-  void arm_shift_q7(
-		     q7_t * pSrc,
-		    int8_t shiftBits,
-		    q7_t * pDst,
-		    uint32_t blockSize);
+  arm_status arm_dct4_init_f32(
+			       arm_dct4_instance_f32 * S,
+			       arm_rfft_instance_f32 * S_RFFT,
+			       arm_cfft_radix4_instance_f32 * S_CFFT,
+			       uint16_t N,
+			       uint16_t Nby2,
+			       float32_t normalize);
 
   /**
-   * @brief  Shifts the elements of a Q15 vector a specified number of bits.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Processing function for the floating-point DCT4/IDCT4.
+   * @param[in]       *S             points to an instance of the floating-point DCT4/IDCT4 structure.
+   * @param[in]       *pState        points to state buffer.
+   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
    * @return none.
    */
 
-  void arm_shift_q15(
-		      q15_t * pSrc,
-		     int8_t shiftBits,
-		     q15_t * pDst,
-		     uint32_t blockSize);
+  void arm_dct4_f32(
+		    const arm_dct4_instance_f32 * S,
+		    float32_t * pState,
+		    float32_t * pInlineBuffer);
 
   /**
-   * @brief  Shifts the elements of a Q31 vector a specified number of bits.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Instance structure for the floating-point DCT2/DCT3 function.
    */
 
-  void arm_shift_q31(
-		      q31_t * pSrc,
-		     int8_t shiftBits,
-		     q31_t * pDst,
-		     uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t N;                        /**< length of the DCT2/DCT3. */
+    uint16_t twidCoefModifier;         /**< stride of the rotations in the shared twiddle table. */
+    const float32_t *pTwiddle;         /**< points to the shared quarter wave twiddle table. */
+    arm_rfft_fast_instance_f32 Srfft;  /**< internal real FFT structure of length N. */
+  } arm_dct2_instance_f32;
 
   /**
-   * @brief  Adds a constant offset to a floating-point vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief  Initialization function for the floating-point DCT2/DCT3.
+   * @param[in,out] *S  points to an instance of the floating-point DCT2/DCT3 structure.
+   * @param[in]     N   length of the DCT2/DCT3, a power of two from 32 to 1024.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported value.
    */
 
-  void arm_offset_f32(
-		       float32_t * pSrc,
-		      float32_t offset,
-		      float32_t * pDst,
-		      uint32_t blockSize);
+  arm_status arm_dct2_init_f32(
+			       arm_dct2_instance_f32 * S,
+			       uint16_t N);
 
   /**
-   * @brief  Adds a constant offset to a Q7 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Processing function for the floating-point DCT type II.
+   * @param[in]       *S             points to an instance of the floating-point DCT2/DCT3 structure.
+   * @param[in]       *pState        points to a state buffer of length N.
+   * @param[in,out]   *pInlineBuffer points to the in/out data buffer of length N.
    * @return none.
    */
 
-  void arm_offset_q7(
-		      q7_t * pSrc,
-		     q7_t offset,
-		     q7_t * pDst,
-		     uint32_t blockSize);
+  void arm_dct2_f32(
+		    const arm_dct2_instance_f32 * S,
+		    float32_t * pState,
+		    float32_t * pInlineBuffer);
 
   /**
-   * @brief  Adds a constant offset to a Q15 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Processing function for the floating-point DCT type III, the inverse of the DCT type II.
+   * @param[in]       *S             points to an instance of the floating-point DCT2/DCT3 structure.
+   * @param[in]       *pState        points to a state buffer of length N.
+   * @param[in,out]   *pInlineBuffer points to the in/out data buffer of length N.
    * @return none.
    */
 
-  void arm_offset_q15(
-		       q15_t * pSrc,
-		      q15_t offset,
-		      q15_t * pDst,
-		      uint32_t blockSize);
+  void arm_dct3_f32(
+		    const arm_dct2_instance_f32 * S,
+		    float32_t * pState,
+		    float32_t * pInlineBuffer);
 
   /**
-   * @brief  Adds a constant offset to a Q31 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[in]  offset is the offset to be added
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Instance structure for the floating-point MDCT/IMDCT function.
    */
 
-  void arm_offset_q31(
-		       q31_t * pSrc,
-		      q31_t offset,
-		      q31_t * pDst,
-		      uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t N;                        /**< number of coefficients, half of the frame length. */
+    uint16_t twidCoefModifier;         /**< stride of the rotations in the shared twiddle table. */
+    float32_t normalize;               /**< scaling of the IMDCT, 2/N. */
+    float32_t cosOffset;               /**< cosine of the offset pi/(4N) of the pre-rotation. */
+    float32_t sinOffset;               /**< sine of the offset pi/(4N) of the pre-rotation. */
+    const float32_t *pTwiddle;         /**< points to the shared quarter wave twiddle table. */
+    const float32_t *pWindow;          /**< points to the window of length 2*N. */
+    float32_t *pState;                 /**< points to the state buffer of length N. */
+    arm_cfft_instance_f32 Scfft;       /**< internal complex FFT structure of length N/2. */
+  } arm_mdct_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point MDCT/IMDCT.
+   * @param[in,out] *S        points to an instance of the floating-point MDCT/IMDCT structure.
+   * @param[in]     N         number of coefficients, a power of two from 32 to 2048.
+   * @param[in]     *pWindow  points to the window of 2*N coefficients.
+   * @param[in]     *pState   points to the state buffer of N samples.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported value.
+   */
+
+  arm_status arm_mdct_init_f32(
+			       arm_mdct_instance_f32 * S,
+			       uint16_t N,
+			       const float32_t * pWindow,
+			       float32_t * pState);
 
   /**
-   * @brief  Negates the elements of a floating-point vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Processing function for the floating-point MDCT.
+   * @param[in,out] *S     points to an instance of the floating-point MDCT/IMDCT structure.
+   * @param[in]     *pSrc  points to the N new samples.
+   * @param[out]    *pDst  points to the N coefficients.
    * @return none.
    */
 
-  void arm_negate_f32(
-		       float32_t * pSrc,
-		      float32_t * pDst,
-		      uint32_t blockSize);
+  void arm_mdct_f32(
+		    arm_mdct_instance_f32 * S,
+		    const float32_t * pSrc,
+		    float32_t * pDst);
 
   /**
-   * @brief  Negates the elements of a Q7 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief Processing function for the floating-point IMDCT with overlap-add.
+   * @param[in,out] *S     points to an instance of the floating-point MDCT/IMDCT structure.
+   * @param[in,out] *pSrc  points to the N coefficients, overwritten.
+   * @param[out]    *pDst  points to the N output samples.
    * @return none.
    */
 
-  void arm_negate_q7(
-		      q7_t * pSrc,
-		     q7_t * pDst,
-		     uint32_t blockSize);
+  void arm_imdct_f32(
+		     arm_mdct_instance_f32 * S,
+		     float32_t * pSrc,
+		     float32_t * pDst);
 
   /**
-   * @brief  Negates the elements of a Q15 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
-   * @return none.
+   * @brief Instance structure for the Q31 DCT4/IDCT4 function.
    */
 
-  void arm_negate_q15(
-		       q15_t * pSrc,
-		      q15_t * pDst,
-		      uint32_t blockSize);
+  typedef struct
+  {
+    uint16_t N;                         /**< length of the DCT4. */
+    uint16_t Nby2;                      /**< half of the length of the DCT4. */
+    q31_t normalize;                    /**< normalizing factor. */
+    q31_t *pTwiddle;                    /**< points to the twiddle factor table. */
+    q31_t *pCosFactor;                  /**< points to the cosFactor table. */
+    arm_rfft_instance_q31 *pRfft;        /**< points to the real FFT instance. */
+    arm_cfft_radix4_instance_q31 *pCfft; /**< points to the complex FFT instance. */
+  } arm_dct4_instance_q31;
 
   /**
-   * @brief  Negates the elements of a Q31 vector.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  blockSize number of samples in the vector
+   * @brief  Initialization function for the Q31 DCT4/IDCT4.
+   * @param[in,out] *S         points to an instance of Q31 DCT4/IDCT4 structure.
+   * @param[in]     *S_RFFT    points to an instance of Q31 RFFT/RIFFT structure
+   * @param[in]     *S_CFFT    points to an instance of Q31 CFFT/CIFFT structure
+   * @param[in]     N          length of the DCT4.
+   * @param[in]     Nby2       half of the length of the DCT4.
+   * @param[in]     normalize  normalizing factor.
+   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   */
+
+  arm_status arm_dct4_init_q31(
+			       arm_dct4_instance_q31 * S,
+			       arm_rfft_instance_q31 * S_RFFT,
+			       arm_cfft_radix4_instance_q31 * S_CFFT,
+			       uint16_t N,
+			       uint16_t Nby2,
+			       q31_t normalize);
+
+  /**
+   * @brief Processing function for the Q31 DCT4/IDCT4.
+   * @param[in]       *S             points to an instance of the Q31 DCT4 structure.
+   * @param[in]       *pState        points to state buffer.
+   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
    * @return none.
    */
 
-  void arm_negate_q31(
-		       q31_t * pSrc,
-		      q31_t * pDst,
-		      uint32_t blockSize);
+  void arm_dct4_q31(
+		    const arm_dct4_instance_q31 * S,
+		    q31_t * pState,
+		    q31_t * pInlineBuffer);
+
   /**
-   * @brief  Copies the elements of a floating-point vector. 
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Instance structure for the Q15 DCT4/IDCT4 function.
+   */
+
+  typedef struct
+  {
+    uint16_t N;                         /**< length of the DCT4. */
+    uint16_t Nby2;                      /**< half of the length of the DCT4. */
+    q15_t normalize;                    /**< normalizing factor. */
+    q15_t *pTwiddle;                    /**< points to the twiddle factor table. */
+    q15_t *pCosFactor;                  /**< points to the cosFactor table. */
+    arm_rfft_instance_q15 *pRfft;        /**< points to the real FFT instance. */
+    arm_cfft_radix4_instance_q15 *pCfft; /**< points to the complex FFT instance. */
+  } arm_dct4_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 DCT4/IDCT4.
+   * @param[in,out] *S         points to an instance of Q15 DCT4/IDCT4 structure.
+   * @param[in]     *S_RFFT    points to an instance of Q15 RFFT/RIFFT structure.
+   * @param[in]     *S_CFFT    points to an instance of Q15 CFFT/CIFFT structure.
+   * @param[in]     N          length of the DCT4.
+   * @param[in]     Nby2       half of the length of the DCT4.
+   * @param[in]     normalize  normalizing factor.
+   * @return		arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
+   */
+
+  arm_status arm_dct4_init_q15(
+			       arm_dct4_instance_q15 * S,
+			       arm_rfft_instance_q15 * S_RFFT,
+			       arm_cfft_radix4_instance_q15 * S_CFFT,
+			       uint16_t N,
+			       uint16_t Nby2,
+			       q15_t normalize);
+
+  /**
+   * @brief Processing function for the Q15 DCT4/IDCT4.
+   * @param[in]       *S             points to an instance of the Q15 DCT4 structure.
+   * @param[in]       *pState        points to state buffer.
+   * @param[in,out]   *pInlineBuffer points to the in-place input and output buffer.
    * @return none.
    */
-  void arm_copy_f32(
-		     float32_t * pSrc,
-		    float32_t * pDst,
-		    uint32_t blockSize);
+
+  void arm_dct4_q15(
+		    const arm_dct4_instance_q15 * S,
+		    q15_t * pState,
+		    q15_t * pInlineBuffer);
 
   /**
-   * @brief  Copies the elements of a Q7 vector. 
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Floating-point vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
-  void arm_copy_q7(
-		    q7_t * pSrc,
-		   q7_t * pDst,
+
+  void arm_add_f32(
+		   float32_t * pSrcA,
+		   float32_t * pSrcB,
+		   float32_t * pDst,
 		   uint32_t blockSize);
 
   /**
-   * @brief  Copies the elements of a Q15 vector. 
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Q7 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
-  void arm_copy_q15(
-		     q15_t * pSrc,
-		    q15_t * pDst,
-		    uint32_t blockSize);
+
+  void arm_add_q7(
+		  q7_t * pSrcA,
+		  q7_t * pSrcB,
+		  q7_t * pDst,
+		  uint32_t blockSize);
 
   /**
-   * @brief  Copies the elements of a Q31 vector. 
-   * @param[in]  *pSrc input pointer
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Q15 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
-  void arm_copy_q31(
-		     q31_t * pSrc,
-		    q31_t * pDst,
-		    uint32_t blockSize);
+
+  void arm_add_q15(
+		    q15_t * pSrcA,
+		    q15_t * pSrcB,
+		   q15_t * pDst,
+		   uint32_t blockSize);
+
   /**
-   * @brief  Fills a constant value into a floating-point vector. 
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Q31 vector addition.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
-  void arm_fill_f32(
-		     float32_t value,
-		    float32_t * pDst,
-		    uint32_t blockSize);
+
+  void arm_add_q31(
+		    q31_t * pSrcA,
+		    q31_t * pSrcB,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief  Fills a constant value into a Q7 vector. 
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Floating-point vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
-  void arm_fill_q7(
-		    q7_t value,
-		   q7_t * pDst,
+
+  void arm_sub_f32(
+		    float32_t * pSrcA,
+		    float32_t * pSrcB,
+		   float32_t * pDst,
 		   uint32_t blockSize);
 
   /**
-   * @brief  Fills a constant value into a Q15 vector. 
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Q7 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
-  void arm_fill_q15(
-		     q15_t value,
-		    q15_t * pDst,
-		    uint32_t blockSize);
+
+  void arm_sub_q7(
+		   q7_t * pSrcA,
+		   q7_t * pSrcB,
+		  q7_t * pDst,
+		  uint32_t blockSize);
 
   /**
-   * @brief  Fills a constant value into a Q31 vector. 
-   * @param[in]  value input value to be filled
-   * @param[out]  *pDst output pointer
-   * @param[in]  blockSize number of samples to process
+   * @brief Q15 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
    * @return none.
    */
-  void arm_fill_q31(
-		     q31_t value,
-		    q31_t * pDst,
-		    uint32_t blockSize);
 
-/**  
- * @brief Convolution of floating-point sequences.  
- * @param[in] *pSrcA points to the first input sequence.  
- * @param[in] srcALen length of the first input sequence.  
- * @param[in] *pSrcB points to the second input sequence.  
- * @param[in] srcBLen length of the second input sequence.  
- * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.  
- * @return none.  
- */ 
+  void arm_sub_q15(
+		    q15_t * pSrcA,
+		    q15_t * pSrcB,
+		   q15_t * pDst,
+		   uint32_t blockSize);
 
-  void arm_conv_f32(
-		     float32_t * pSrcA,
-		    uint32_t srcALen,
-		     float32_t * pSrcB,
-		    uint32_t srcBLen,
-		    float32_t * pDst);
-
-/**  
- * @brief Convolution of Q15 sequences.  
- * @param[in] *pSrcA points to the first input sequence.  
- * @param[in] srcALen length of the first input sequence.  
- * @param[in] *pSrcB points to the second input sequence.  
- * @param[in] srcBLen length of the second input sequence.  
- * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.  
- * @return none.  
- */
+  /**
+   * @brief Q31 vector subtraction.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
+   */
 
-  void arm_conv_q15(
-		     q15_t * pSrcA,
-		    uint32_t srcALen,
-		     q15_t * pSrcB,
-		    uint32_t srcBLen,
-		    q15_t * pDst);
+  void arm_sub_q31(
+		    q31_t * pSrcA,
+		    q31_t * pSrcB,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief Multiplies a floating-point vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scale scale factor to be applied
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
    * @return none.
    */
 
-  void arm_conv_fast_q15(
-			  q15_t * pSrcA,
-			 uint32_t srcALen,
-			  q15_t * pSrcB,
-			 uint32_t srcBLen,
-			 q15_t * pDst);
+  void arm_scale_f32(
+		      float32_t * pSrc,
+		     float32_t scale,
+		     float32_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Convolution of Q31 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief Multiplies a Q7 vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
    * @return none.
    */
 
-  void arm_conv_q31(
-		     q31_t * pSrcA,
-		    uint32_t srcALen,
-		     q31_t * pSrcB,
-		    uint32_t srcBLen,
-		    q31_t * pDst);
+  void arm_scale_q7(
+		     q7_t * pSrc,
+		    q7_t scaleFract,
+		    int8_t shift,
+		    q7_t * pDst,
+		    uint32_t blockSize);
 
   /**
-   * @brief Convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief Multiplies a Q15 vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
    * @return none.
    */
 
-  void arm_conv_fast_q31(
-			  q31_t * pSrcA,
-			 uint32_t srcALen,
-			  q31_t * pSrcB,
-			 uint32_t srcBLen,
-			 q31_t * pDst);
+  void arm_scale_q15(
+		      q15_t * pSrc,
+		     q15_t scaleFract,
+		     int8_t shift,
+		     q15_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Convolution of Q7 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
+   * @brief Multiplies a Q31 vector by a scalar.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       scaleFract fractional portion of the scale value
+   * @param[in]       shift number of bits to shift the result by
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       blockSize number of samples in the vector
    * @return none.
    */
 
-  void arm_conv_q7(
-		    q7_t * pSrcA,
-		   uint32_t srcALen,
-		    q7_t * pSrcB,
-		   uint32_t srcBLen,
-		   q7_t * pDst);
+  void arm_scale_q31(
+		      q31_t * pSrc,
+		     q31_t scaleFract,
+		     int8_t shift,
+		     q31_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Partial convolution of floating-point sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Q7 vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
    */
 
-  arm_status arm_conv_partial_f32(
-				   float32_t * pSrcA,
-				  uint32_t srcALen,
-				   float32_t * pSrcB,
-				  uint32_t srcBLen,
-				  float32_t * pDst,
-				  uint32_t firstIndex,
-				  uint32_t numPoints);
+  void arm_abs_q7(
+		   q7_t * pSrc,
+		  q7_t * pDst,
+		  uint32_t blockSize);
 
   /**
-   * @brief Partial convolution of Q15 sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Floating-point vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
    */
 
-  arm_status arm_conv_partial_q15(
-				   q15_t * pSrcA,
-				  uint32_t srcALen,
-				   q15_t * pSrcB,
-				  uint32_t srcBLen,
-				  q15_t * pDst,
-				  uint32_t firstIndex,
-				  uint32_t numPoints);
+  void arm_abs_f32(
+		    float32_t * pSrc,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Q15 vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
    */
 
-  arm_status arm_conv_partial_fast_q15(
-				        q15_t * pSrcA,
-				       uint32_t srcALen,
-				        q15_t * pSrcB,
-				       uint32_t srcBLen,
-				       q15_t * pDst,
-				       uint32_t firstIndex,
-				       uint32_t numPoints);
+  void arm_abs_q15(
+		    q15_t * pSrc,
+		   q15_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief Partial convolution of Q31 sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Q31 vector absolute value.
+   * @param[in]       *pSrc points to the input buffer
+   * @param[out]      *pDst points to the output buffer
+   * @param[in]       blockSize number of samples in each vector
+   * @return none.
    */
 
-  arm_status arm_conv_partial_q31(
-				   q31_t * pSrcA,
-				  uint32_t srcALen,
-				   q31_t * pSrcB,
-				  uint32_t srcBLen,
-				  q31_t * pDst,
-				  uint32_t firstIndex,
-				  uint32_t numPoints);
+  void arm_abs_q31(
+		    q31_t * pSrc,
+		   q31_t * pDst,
+		   uint32_t blockSize);
+
+  /**
+   * @brief Dot product of floating-point vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
+   */
 
+  void arm_dot_prod_f32(
+			 float32_t * pSrcA,
+			 float32_t * pSrcB,
+			uint32_t blockSize,
+			float32_t * result);
 
   /**
-   * @brief Partial convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Dot product of a half-precision vector and a floating-point vector.
+   * @param[in]       *pSrcA points to the half-precision input vector
+   * @param[in]       *pSrcB points to the floating-point input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
    */
 
-  arm_status arm_conv_partial_fast_q31(
-				        q31_t * pSrcA,
-				       uint32_t srcALen,
-				        q31_t * pSrcB,
-				       uint32_t srcBLen,
-				       q31_t * pDst,
-				       uint32_t firstIndex,
-				       uint32_t numPoints);
+  void arm_dot_prod_f16_f32(
+			 float16_t * pSrcA,
+			 float32_t * pSrcB,
+			uint32_t blockSize,
+			float32_t * result);
 
   /**
-   * @brief Partial convolution of Q7 sequences.
-   * @param[in]       *pSrcA points to the first input sequence.
-   * @param[in]       srcALen length of the first input sequence.
-   * @param[in]       *pSrcB points to the second input sequence.
-   * @param[in]       srcBLen length of the second input sequence.
-   * @param[out]      *pDst points to the block of output data
-   * @param[in]       firstIndex is the first output sample to start with.
-   * @param[in]       numPoints is the number of output points to be computed.
-   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   * @brief Dot product of Q7 vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
    */
 
-  arm_status arm_conv_partial_q7(
-				  q7_t * pSrcA,
-				 uint32_t srcALen,
-				  q7_t * pSrcB,
-				 uint32_t srcBLen,
-				 q7_t * pDst,
-				 uint32_t firstIndex,
-				 uint32_t numPoints);
-
+  void arm_dot_prod_q7(
+		        q7_t * pSrcA,
+		        q7_t * pSrcB,
+		       uint32_t blockSize,
+		       q31_t * result);
 
   /**
-   * @brief Instance structure for the Q15 FIR decimator.
+   * @brief Dot product of Q15 vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t M;                      /**< decimation factor. */
-    uint16_t numTaps;               /**< number of coefficients in the filter. */
-    q15_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
-    q15_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-  } arm_fir_decimate_instance_q15;
+  void arm_dot_prod_q15(
+			 q15_t * pSrcA,
+			 q15_t * pSrcB,
+			uint32_t blockSize,
+			q63_t * result);
 
   /**
-   * @brief Instance structure for the Q31 FIR decimator.
+   * @brief Dot product of Q31 vectors.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t M;                  /**< decimation factor. */
-    uint16_t numTaps;           /**< number of coefficients in the filter. */
-    q31_t *pCoeffs;              /**< points to the coefficient array. The array is of length numTaps.*/
-    q31_t *pState;               /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-
-  } arm_fir_decimate_instance_q31;
+  void arm_dot_prod_q31(
+			 q31_t * pSrcA,
+			 q31_t * pSrcB,
+			uint32_t blockSize,
+			q63_t * result);
 
   /**
-   * @brief Instance structure for the floating-point FIR decimator.
+   * @brief Dot product of Q31 vectors accumulating the full precision products.
+   * @param[in]       *pSrcA points to the first input vector
+   * @param[in]       *pSrcB points to the second input vector
+   * @param[in]       blockSize number of samples in each vector
+   * @param[out]      *result output result returned here
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t M;                          /**< decimation factor. */
-    uint16_t numTaps;                   /**< number of coefficients in the filter. */
-    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
-    float32_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-
-  } arm_fir_decimate_instance_f32;
-
-
+  void arm_dot_prod_exact_q31(
+			      q31_t * pSrcA,
+			      q31_t * pSrcB,
+			      uint32_t blockSize,
+			      q63_t * result);
 
   /**
-   * @brief Processing function for the floating-point FIR decimator.
-   * @param[in] *S points to an instance of the floating-point FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief Dot products of a Q15 vector with a set of Q15 templates.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       *pTemplates points to the templates, stored one after the other
+   * @param[in]       numTemplates number of templates
+   * @param[in]       blockSize number of samples in the input vector and in each template
+   * @param[out]      *pResults points to the numTemplates results
+   * @return none.
    */
 
-  void arm_fir_decimate_f32(
-			    const arm_fir_decimate_instance_f32 * S,
-			     float32_t * pSrc,
-			    float32_t * pDst,
-			    uint32_t blockSize);
-
+  void arm_dot_prod_multi_q15(
+			      q15_t * pSrc,
+			      q15_t * pTemplates,
+			      uint32_t numTemplates,
+			      uint32_t blockSize,
+			      q63_t * pResults);
 
   /**
-   * @brief  Initialization function for the floating-point FIR decimator.
-   * @param[in,out] *S points to an instance of the floating-point FIR decimator structure.
-   * @param[in] numTaps  number of coefficients in the filter.
-   * @param[in] M  decimation factor.
-   * @param[in] *pCoeffs points to the filter coefficients.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Shifts the elements of a Q7 vector a specified number of bits.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  arm_status arm_fir_decimate_init_f32(
-				       arm_fir_decimate_instance_f32 * S,
-				       uint16_t numTaps,
-				       uint8_t M,
-				       float32_t * pCoeffs,
-				       float32_t * pState,
-				       uint32_t blockSize);
+  void arm_shift_q7(
+		     q7_t * pSrc,
+		    int8_t shiftBits,
+		    q7_t * pDst,
+		    uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 FIR decimator.
-   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Shifts the elements of a Q15 vector a specified number of bits.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  void arm_fir_decimate_q15(
-			    const arm_fir_decimate_instance_q15 * S,
-			     q15_t * pSrc,
-			    q15_t * pDst,
-			    uint32_t blockSize);
+  void arm_shift_q15(
+		      q15_t * pSrc,
+		     int8_t shiftBits,
+		     q15_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
-   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Shifts the elements of a Q31 vector a specified number of bits.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  shiftBits number of bits to shift.  A positive value shifts left; a negative value shifts right.
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  void arm_fir_decimate_fast_q15(
-				 const arm_fir_decimate_instance_q15 * S,
-				  q15_t * pSrc,
-				 q15_t * pDst,
-				 uint32_t blockSize);
-
-
+  void arm_shift_q31(
+		      q31_t * pSrc,
+		     int8_t shiftBits,
+		     q31_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q15 FIR decimator.
-   * @param[in,out] *S points to an instance of the Q15 FIR decimator structure.
-   * @param[in] numTaps  number of coefficients in the filter.
-   * @param[in] M  decimation factor.
-   * @param[in] *pCoeffs points to the filter coefficients.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Adds a constant offset to a floating-point vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  arm_status arm_fir_decimate_init_q15(
-				       arm_fir_decimate_instance_q15 * S,
-				       uint16_t numTaps,
-				       uint8_t M,
-				       q15_t * pCoeffs,
-				       q15_t * pState,
-				       uint32_t blockSize);
+  void arm_offset_f32(
+		       float32_t * pSrc,
+		      float32_t offset,
+		      float32_t * pDst,
+		      uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 FIR decimator.
-   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Adds a constant offset to a Q7 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  void arm_fir_decimate_q31(
-			    const arm_fir_decimate_instance_q31 * S,
-			     q31_t * pSrc,
-			    q31_t * pDst,
-			    uint32_t blockSize);
+  void arm_offset_q7(
+		      q7_t * pSrc,
+		     q7_t offset,
+		     q7_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
-   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data
-   * @param[in] blockSize number of input samples to process per call.
-   * @return none
+   * @brief  Adds a constant offset to a Q15 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  void arm_fir_decimate_fast_q31(
-				 arm_fir_decimate_instance_q31 * S,
-				  q31_t * pSrc,
-				 q31_t * pDst,
-				 uint32_t blockSize);
-
+  void arm_offset_q15(
+		       q15_t * pSrc,
+		      q15_t offset,
+		      q15_t * pDst,
+		      uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q31 FIR decimator.
-   * @param[in,out] *S points to an instance of the Q31 FIR decimator structure.
-   * @param[in] numTaps  number of coefficients in the filter.
-   * @param[in] M  decimation factor.
-   * @param[in] *pCoeffs points to the filter coefficients.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] blockSize number of input samples to process per call.
-   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   * @brief  Adds a constant offset to a Q31 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[in]  offset is the offset to be added
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  arm_status arm_fir_decimate_init_q31(
-				       arm_fir_decimate_instance_q31 * S,
-				       uint16_t numTaps,
-				       uint8_t M,
-				       q31_t * pCoeffs,
-				       q31_t * pState,
-				       uint32_t blockSize);
+  void arm_offset_q31(
+		       q31_t * pSrc,
+		      q31_t offset,
+		      q31_t * pDst,
+		      uint32_t blockSize);
 
+  /**
+   * @brief  Negates the elements of a floating-point vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
+   */
 
+  void arm_negate_f32(
+		       float32_t * pSrc,
+		      float32_t * pDst,
+		      uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the Q15 FIR interpolator.
+   * @brief  Negates the elements of a Q7 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } arm_fir_interpolate_instance_q15;
+  void arm_negate_q7(
+		      q7_t * pSrc,
+		     q7_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the Q31 FIR interpolator.
+   * @brief  Negates the elements of a Q15 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t L;                      /**< upsample factor. */
-    uint16_t phaseLength;           /**< length of each polyphase filter component. */
-    q31_t *pCoeffs;                  /**< points to the coefficient array. The array is of length L*phaseLength. */
-    q31_t *pState;                   /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
-  } arm_fir_interpolate_instance_q31;
+  void arm_negate_q15(
+		       q15_t * pSrc,
+		      q15_t * pDst,
+		      uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the floating-point FIR interpolator.
+   * @brief  Negates the elements of a Q31 vector.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  blockSize number of samples in the vector
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t L;                     /**< upsample factor. */
-    uint16_t phaseLength;          /**< length of each polyphase filter component. */
-    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
-    float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
-  } arm_fir_interpolate_instance_f32;
-
+  void arm_negate_q31(
+		       q31_t * pSrc,
+		      q31_t * pDst,
+		      uint32_t blockSize);
+  /**
+   * @brief  Copies the elements of a floating-point vector. 
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void arm_copy_f32(
+		     float32_t * pSrc,
+		    float32_t * pDst,
+		    uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 FIR interpolator.
-   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
+   * @brief  Copies the elements of a Q7 vector. 
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
    * @return none.
    */
+  void arm_copy_q7(
+		    q7_t * pSrc,
+		   q7_t * pDst,
+		   uint32_t blockSize);
 
-  void arm_fir_interpolate_q15(
-			       const arm_fir_interpolate_instance_q15 * S,
-			        q15_t * pSrc,
-			       q15_t * pDst,
-			       uint32_t blockSize);
+  /**
+   * @brief  Copies the elements of a Q15 vector. 
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void arm_copy_q15(
+		     q15_t * pSrc,
+		    q15_t * pDst,
+		    uint32_t blockSize);
 
+  /**
+   * @brief  Copies the elements of a Q31 vector. 
+   * @param[in]  *pSrc input pointer
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void arm_copy_q31(
+		     q31_t * pSrc,
+		    q31_t * pDst,
+		    uint32_t blockSize);
+  /**
+   * @brief  Fills a constant value into a floating-point vector. 
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void arm_fill_f32(
+		     float32_t value,
+		    float32_t * pDst,
+		    uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q15 FIR interpolator.
-   * @param[in,out] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief  Fills a constant value into a Q7 vector. 
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
    */
+  void arm_fill_q7(
+		    q7_t value,
+		   q7_t * pDst,
+		   uint32_t blockSize);
 
-  arm_status arm_fir_interpolate_init_q15(
-					  arm_fir_interpolate_instance_q15 * S,
-					  uint8_t L,
-					  uint16_t numTaps,
-					  q15_t * pCoeffs,
-					  q15_t * pState,
-					  uint32_t blockSize);
+  /**
+   * @brief  Fills a constant value into a Q15 vector. 
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
+   * @return none.
+   */
+  void arm_fill_q15(
+		     q15_t value,
+		    q15_t * pDst,
+		    uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 FIR interpolator.
-   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
+   * @brief  Fills a constant value into a Q31 vector. 
+   * @param[in]  value input value to be filled
+   * @param[out]  *pDst output pointer
+   * @param[in]  blockSize number of samples to process
    * @return none.
    */
+  void arm_fill_q31(
+		     q31_t value,
+		    q31_t * pDst,
+		    uint32_t blockSize);
 
-  void arm_fir_interpolate_q31(
-			       const arm_fir_interpolate_instance_q31 * S,
-			        q31_t * pSrc,
-			       q31_t * pDst,
-			       uint32_t blockSize);
+  /**
+   * @brief Instance structure for a RAM arena receiving staged coefficients and states.
+   */
+
+  typedef struct
+  {
+    uint8_t *pBase;          /**< points to the start of the arena. */
+    uint32_t size;           /**< size of the arena in bytes. */
+    uint32_t used;           /**< number of bytes allocated from the start of the arena. */
+    uint32_t scratch;        /**< number of bytes of the shared scratch buffer at the end of the arena. */
+  } arm_ram_arena_instance;
 
   /**
-   * @brief  Initialization function for the Q31 FIR interpolator.
-   * @param[in,out] *S        points to an instance of the Q31 FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief Number of bytes taken in a RAM arena by a buffer of <code>n</code> bytes, aligned on 8 bytes.
    */
+#define ARM_RAM_ARENA_ALIGN(n)                      (((n) + 7u) & ~7u)
 
-  arm_status arm_fir_interpolate_init_q31(
-					  arm_fir_interpolate_instance_q31 * S,
-					  uint8_t L,
-					  uint16_t numTaps,
-					  q31_t * pCoeffs,
-					  q31_t * pState,
-					  uint32_t blockSize);
+  /**
+   * @brief Number of samples of the state of the filter instances, to size the buffers
+   * given to the initialization functions or the arenas of the create functions.
+   */
+#define ARM_FIR_STATE_SIZE(numTaps, blockSize)      ((numTaps) + (blockSize) - 1u)
+#define ARM_FIR_STATE_SIZE_Q15(numTaps, blockSize)  ((numTaps) + (blockSize))
+#define ARM_FIR_DECIMATE_STATE_SIZE(numTaps, blockSize)  ((numTaps) + (blockSize) - 1u)
+#define ARM_FIR_INTERPOLATE_STATE_SIZE(L, numTaps, blockSize)  (((numTaps) / (L)) + (blockSize) - 1u)
+#define ARM_FIR_LATTICE_STATE_SIZE(numStages)       (numStages)
+#define ARM_IIR_LATTICE_STATE_SIZE(numStages, blockSize)  ((numStages) + (blockSize))
+#define ARM_FIR_SPARSE_STATE_SIZE(maxDelay, blockSize)  ((maxDelay) + (blockSize))
+#define ARM_BIQUAD_DF1_STATE_SIZE(numStages)        (4u * (numStages))
+#define ARM_BIQUAD_DF2T_STATE_SIZE(numStages)       (2u * (numStages))
+#define ARM_LMS_STATE_SIZE(numTaps, blockSize)      ((numTaps) + (blockSize) - 1u)
 
+  /**
+   * @brief Number of samples of each scratch buffer of the sparse FIR filters: the input
+   * scratch of the type of the filter and, for Q15 and Q7, the q31_t output scratch.
+   */
+#define ARM_FIR_SPARSE_SCRATCH_SIZE(blockSize)      (blockSize)
 
   /**
-   * @brief Processing function for the floating-point FIR interpolator.
-   * @param[in] *S        points to an instance of the floating-point FIR interpolator structure.
-   * @param[in] *pSrc     points to the block of input data.
-   * @param[out] *pDst    points to the block of output data.
-   * @param[in] blockSize number of input samples to process per call.
+   * @brief  Initialization function for a RAM arena.
+   * @param[in,out] *S points to an instance of the RAM arena structure.
+   * @param[in] *pBase points to the memory of the arena, for example a buffer declared with ARM_CCM_DATA, or NULL to plan the memory.
+   * @param[in] size size of the arena in bytes.
    * @return none.
    */
 
-  void arm_fir_interpolate_f32(
-			       const arm_fir_interpolate_instance_f32 * S,
-			        float32_t * pSrc,
-			       float32_t * pDst,
-			       uint32_t blockSize);
+  void arm_ram_arena_init(
+			  arm_ram_arena_instance * S,
+			  void *pBase,
+			  uint32_t size);
 
   /**
-   * @brief  Initialization function for the floating-point FIR interpolator.
-   * @param[in,out] *S        points to an instance of the floating-point FIR interpolator structure.
-   * @param[in]     L         upsample factor.
-   * @param[in]     numTaps   number of filter coefficients in the filter.
-   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
-   * @param[in]     *pState   points to the state buffer.
-   * @param[in]     blockSize number of input samples to process per call.
-   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
-   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   * @brief  Copies a buffer into a RAM arena.
+   * @param[in,out] *S points to an instance of the RAM arena structure.
+   * @param[in] *pSrc points to the buffer to copy, or NULL to clear the allocated bytes.
+   * @param[in] numBytes number of bytes to copy.
+   * @return pointer to the copy, aligned on 8 bytes, or NULL when the arena is too small.
    */
 
-  arm_status arm_fir_interpolate_init_f32(
-					  arm_fir_interpolate_instance_f32 * S,
-					  uint8_t L,
-					  uint16_t numTaps,
-					  float32_t * pCoeffs,
-					  float32_t * pState,
-					  uint32_t blockSize);
+  void *arm_ram_arena_stage(
+			    arm_ram_arena_instance * S,
+			    const void *pSrc,
+			    uint32_t numBytes);
 
   /**
-   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   * @brief  Allocates an uninitialized buffer from a RAM arena.
+   * @param[in,out] *S points to an instance of the RAM arena structure.
+   * @param[in] numBytes number of bytes to allocate.
+   * @return pointer to the buffer, aligned on 8 bytes, or NULL when the arena is too small.
    */
 
-  typedef struct
-  {
-    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
-    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
-    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
-
-  } arm_biquad_cas_df1_32x64_ins_q31;
-
+  void *arm_ram_arena_alloc(
+			    arm_ram_arena_instance * S,
+			    uint32_t numBytes);
 
   /**
-   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @brief  Releases the allocations made from a RAM arena after a mark.
+   * @param[in,out] *S points to an instance of the RAM arena structure.
+   * @param[in] mark value of S->used saved before the allocations to release.
    * @return none.
    */
 
-  void arm_biquad_cas_df1_32x64_q31(
-				    const arm_biquad_cas_df1_32x64_ins_q31 * S,
-				     q31_t * pSrc,
-				    q31_t * pDst,
-				    uint32_t blockSize);
+  void arm_ram_arena_release(
+			     arm_ram_arena_instance * S,
+			     uint32_t mark);
+
+  /**
+   * @brief  Returns the scratch buffer shared by the kernels using a RAM arena.
+   * @param[in,out] *S points to an instance of the RAM arena structure.
+   * @param[in] numBytes number of bytes needed by the kernel.
+   * @return pointer to the buffer at the end of the arena, aligned on 8 bytes, or NULL when the arena is too small or plans the memory.
+   */
 
+  void *arm_ram_arena_scratch(
+			      arm_ram_arena_instance * S,
+			      uint32_t numBytes);
 
   /**
-   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
-   * @return        none
+   * @brief  Returns the size of a RAM arena used by the allocations and the shared scratch.
+   * @param[in] *S points to an instance of the RAM arena structure.
+   * @return number of bytes, the size of the arena to provide for an arena planning the memory.
    */
 
-  void arm_biquad_cas_df1_32x64_init_q31(
-					 arm_biquad_cas_df1_32x64_ins_q31 * S,
-					 uint8_t numStages,
-					 q31_t * pCoeffs,
-					 q63_t * pState,
-					 uint8_t postShift);
+  uint32_t arm_ram_arena_required(
+				  const arm_ram_arena_instance * S);
 
+  /**
+   * @brief Fully connected layer with Q7 weights and Q15 activations.
+   * @param[in]       *pSrc points to the input vector of numCols samples
+   * @param[in]       *pWeights points to the weights reordered by arm_nn_fc_reorder_q7()
+   * @param[in]       *pBias points to the numRows biases
+   * @param[in]       numCols number of inputs
+   * @param[in]       numRows number of outputs
+   * @param[in]       biasShift left shift of the biases to the format of the accumulator
+   * @param[in]       outShift right shift of the accumulator to the format of the outputs
+   * @param[out]      *pDst points to the output vector of numRows samples
+   * @return none.
+   */
 
+  void arm_nn_fc_q7_q15(
+			q15_t * pSrc,
+			q7_t * pWeights,
+			q15_t * pBias,
+			uint16_t numCols,
+			uint16_t numRows,
+			uint16_t biasShift,
+			uint16_t outShift,
+			q15_t * pDst);
 
   /**
-   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   * @brief Reorders row-major Q7 weights for arm_nn_fc_q7_q15() and arm_nn_conv1d_q7_q15().
+   * @param[in]       *pSrc points to the row-major weights
+   * @param[out]      *pDst points to the reordered weights, which may be pSrc
+   * @param[in]       numRows number of rows
+   * @param[in]       numCols number of columns
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
-    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
-    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
-  } arm_biquad_cascade_df2T_instance_f32;
+  void arm_nn_fc_reorder_q7(
+			    q7_t * pSrc,
+			    q7_t * pDst,
+			    uint16_t numRows,
+			    uint16_t numCols);
+
+  /**
+   * @brief 1-dimensional convolution layer with Q7 weights and Q15 activations.
+   * @param[in]       *pSrc points to the channel-last inputs
+   * @param[in]       srcLen number of input time steps
+   * @param[in]       numInCh number of input channels
+   * @param[in]       *pWeights points to numOutCh rows of kernelLen*numInCh reordered weights
+   * @param[in]       *pBias points to the numOutCh biases
+   * @param[in]       kernelLen number of time steps of the kernel
+   * @param[in]       numOutCh number of output channels
+   * @param[in]       stride distance in time steps between two outputs
+   * @param[in]       biasShift left shift of the biases to the format of the accumulator
+   * @param[in]       outShift right shift of the accumulator to the format of the outputs
+   * @param[out]      *pDst points to the channel-last outputs
+   * @return none.
+   */
 
+  void arm_nn_conv1d_q7_q15(
+			    q15_t * pSrc,
+			    uint16_t srcLen,
+			    uint16_t numInCh,
+			    q7_t * pWeights,
+			    q15_t * pBias,
+			    uint16_t kernelLen,
+			    uint16_t numOutCh,
+			    uint16_t stride,
+			    uint16_t biasShift,
+			    uint16_t outShift,
+			    q15_t * pDst);
+
+  /**
+   * @brief 1-dimensional depthwise convolution layer with Q7 weights and Q15 activations.
+   * @param[in]       *pSrc points to the channel-last inputs
+   * @param[in]       srcLen number of input time steps
+   * @param[in]       numCh number of channels
+   * @param[in]       *pWeights points to the kernelLen x numCh channel-last weights
+   * @param[in]       *pBias points to the numCh biases
+   * @param[in]       kernelLen number of time steps of the kernel
+   * @param[in]       stride distance in time steps between two outputs
+   * @param[in]       biasShift left shift of the biases to the format of the accumulator
+   * @param[in]       outShift right shift of the accumulator to the format of the outputs
+   * @param[out]      *pDst points to the channel-last outputs
+   * @return none.
+   */
+
+  void arm_nn_depthwise_conv1d_q7_q15(
+				      q15_t * pSrc,
+				      uint16_t srcLen,
+				      uint16_t numCh,
+				      q7_t * pWeights,
+				      q15_t * pBias,
+				      uint16_t kernelLen,
+				      uint16_t stride,
+				      uint16_t biasShift,
+				      uint16_t outShift,
+				      q15_t * pDst);
+
+  /**
+   * @brief Q15 ReLU activation function, in place.
+   * @param[in,out]   *pData points to the activations
+   * @param[in]       blockSize number of activations
+   * @return none.
+   */
+
+  void arm_nn_relu_q15(
+		       q15_t * pData,
+		       uint32_t blockSize);
 
   /**
-   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in]  *S        points to an instance of the filter data structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
+   * @brief Q7 ReLU activation function, in place.
+   * @param[in,out]   *pData points to the activations
+   * @param[in]       blockSize number of activations
    * @return none.
    */
 
-  void arm_biquad_cascade_df2T_f32(
-				   const arm_biquad_cascade_df2T_instance_f32 * S,
-				    float32_t * pSrc,
-				   float32_t * pDst,
-				   uint32_t blockSize);
+  void arm_nn_relu_q7(
+		      q7_t * pData,
+		      uint32_t blockSize);
 
+  /**
+   * @brief Activation functions computed by table lookup.
+   */
+  typedef enum
+  {
+    ARM_NN_SIGMOID = 0,        /**< 1 / (1 + exp(-x)) */
+    ARM_NN_TANH = 1            /**< tanh(x) */
+  } arm_nn_activation_type;
 
   /**
-   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
-   * @param[in,out] *S           points to an instance of the filter data structure.
-   * @param[in]     numStages    number of 2nd order stages in the filter.
-   * @param[in]     *pCoeffs     points to the filter coefficients.
-   * @param[in]     *pState      points to the state buffer.
-   * @return        none
+   * @brief Q15 sigmoid and tanh activation functions, in place.
+   * @param[in,out]   *pData points to the activations
+   * @param[in]       blockSize number of activations
+   * @param[in]       intBits number of integer bits of the input format
+   * @param[in]       type ARM_NN_SIGMOID or ARM_NN_TANH
+   * @return none.
    */
 
-  void arm_biquad_cascade_df2T_init_f32(
-					arm_biquad_cascade_df2T_instance_f32 * S,
-					uint8_t numStages,
-					float32_t * pCoeffs,
-					float32_t * pState);
+  void arm_nn_activation_q15(
+			     q15_t * pData,
+			     uint32_t blockSize,
+			     uint16_t intBits,
+			     arm_nn_activation_type type);
 
+  /**
+   * @brief Largest kernel length of the separable image filters.
+   */
 
+#define ARM_IMG_MAX_KERNEL	7u
 
   /**
-   * @brief Instance structure for the Q15 FIR lattice filter.
+   * @brief Widens 8-bit pixels to 16-bit values.
+   * @param[in]       *pSrc points to the 8-bit pixels
+   * @param[out]      *pDst points to the 16-bit values
+   * @param[in]       blockSize number of pixels
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint16_t numStages;                          /**< number of filter stages. */
-    q15_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
-    q15_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_q15;
+  void arm_img_u8_to_q15(
+			 uint8_t * pSrc,
+			 q15_t * pDst,
+			 uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the Q31 FIR lattice filter.
+   * @brief 3x3 or 5x5 convolution of an 8-bit image.
+   * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+   * @param[in]       width number of pixels per row
+   * @param[in]       height number of rows
+   * @param[in]       *pKernel points to the <code>kernelSize</code> x <code>kernelSize</code> Q7 coefficients
+   * @param[in]       kernelSize 3 or 5
+   * @param[in]       shift right shift of the accumulator to the 8-bit output, rounded
+   * @param[in]       *pState points to the line buffer of <code>kernelSize * width</code> values
+   * @param[out]      *pDst points to the output image
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+   */
+
+  arm_status arm_img_conv_u8(
+			     uint8_t * pSrc,
+			     uint16_t width,
+			     uint16_t height,
+			     q7_t * pKernel,
+			     uint16_t kernelSize,
+			     uint16_t shift,
+			     q15_t * pState,
+			     uint8_t * pDst);
+
+  /**
+   * @brief 3x3 or 5x5 convolution of a Q15 image.
+   * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+   * @param[in]       width number of pixels per row
+   * @param[in]       height number of rows
+   * @param[in]       *pKernel points to the <code>kernelSize</code> x <code>kernelSize</code> Q15 coefficients
+   * @param[in]       kernelSize 3 or 5
+   * @param[out]      *pDst points to the output image
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
    */
 
-  typedef struct
-  {
-    uint16_t numStages;                          /**< number of filter stages. */
-    q31_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
-    q31_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_q31;
+  arm_status arm_img_conv_q15(
+			      q15_t * pSrc,
+			      uint16_t width,
+			      uint16_t height,
+			      q15_t * pKernel,
+			      uint16_t kernelSize,
+			      q15_t * pDst);
 
   /**
-   * @brief Instance structure for the floating-point FIR lattice filter.
+   * @brief Separable filter of an 8-bit image.
+   * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+   * @param[in]       width number of pixels per row
+   * @param[in]       height number of rows
+   * @param[in]       *pRowKernel points to the Q7 coefficients of the row kernel
+   * @param[in]       *pColKernel points to the Q7 coefficients of the column kernel
+   * @param[in]       kernelLen odd number of coefficients of each kernel, at most ARM_IMG_MAX_KERNEL
+   * @param[in]       shift right shift of the product of the kernels to the 8-bit output, at least 3
+   * @param[in]       *pState points to the line buffer of <code>width + kernelLen * (width - kernelLen + 1)</code> values
+   * @param[out]      *pDst points to the output image
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+   */
+
+  arm_status arm_img_sep_filter_u8(
+				   uint8_t * pSrc,
+				   uint16_t width,
+				   uint16_t height,
+				   q7_t * pRowKernel,
+				   q7_t * pColKernel,
+				   uint16_t kernelLen,
+				   uint16_t shift,
+				   q15_t * pState,
+				   uint8_t * pDst);
+
+  /**
+   * @brief Separable filter of a Q15 image.
+   * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+   * @param[in]       width number of pixels per row
+   * @param[in]       height number of rows
+   * @param[in]       *pRowKernel points to the Q15 coefficients of the row kernel
+   * @param[in]       *pColKernel points to the Q15 coefficients of the column kernel
+   * @param[in]       kernelLen odd number of coefficients of each kernel, at most ARM_IMG_MAX_KERNEL
+   * @param[in]       *pState points to the line buffer of <code>kernelLen * (width - kernelLen + 1)</code> values
+   * @param[out]      *pDst points to the output image
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
+   */
+
+  arm_status arm_img_sep_filter_q15(
+				    q15_t * pSrc,
+				    uint16_t width,
+				    uint16_t height,
+				    q15_t * pRowKernel,
+				    q15_t * pColKernel,
+				    uint16_t kernelLen,
+				    q15_t * pState,
+				    q15_t * pDst);
+
+  /**
+   * @brief Sobel gradient magnitude of an 8-bit image.
+   * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+   * @param[in]       width number of pixels per row
+   * @param[in]       height number of rows
+   * @param[in]       threshold edge threshold on the magnitude, 0 for the magnitude itself
+   * @param[in]       *pState points to the line buffer of <code>5 * width</code> values
+   * @param[out]      *pDst points to the <code>width - 2</code> x <code>height - 2</code> output image
+   * @return ARM_MATH_SUCCESS or ARM_MATH_SIZE_MISMATCH.
+   */
+
+  arm_status arm_img_sobel_u8(
+			      uint8_t * pSrc,
+			      uint16_t width,
+			      uint16_t height,
+			      uint16_t threshold,
+			      q15_t * pState,
+			      uint8_t * pDst);
+
+  /**
+   * @brief Box filter of an 8-bit image.
+   * @param[in]       *pSrc points to the <code>width</code> x <code>height</code> image
+   * @param[in]       width number of pixels per row
+   * @param[in]       height number of rows
+   * @param[in]       radius radius of the box, from 1 to 63
+   * @param[in]       *pState points to the line buffer of <code>width</code> values
+   * @param[out]      *pDst points to the output image
+   * @return ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR or ARM_MATH_SIZE_MISMATCH.
    */
 
-  typedef struct
+  arm_status arm_img_box_u8(
+			    uint8_t * pSrc,
+			    uint16_t width,
+			    uint16_t height,
+			    uint16_t radius,
+			    q15_t * pState,
+			    uint8_t * pDst);
+
+  /**
+   * @brief Order of the bytes of a pair of YUV 4:2:2 pixels.
+   */
+  typedef enum
   {
-    uint16_t numStages;                  /**< number of filter stages. */
-    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
-    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
-  } arm_fir_lattice_instance_f32;
+    ARM_IMG_YUYV = 0,          /**< Y0 U Y1 V */
+    ARM_IMG_UYVY = 1           /**< U Y0 V Y1 */
+  } arm_img_yuv_order;
 
   /**
-   * @brief Initialization function for the Q15 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages. 
-   * @param[in] *pState points to the state buffer.  The array is of length numStages. 
+   * @brief Converts YUV 4:2:2 pixels to RGB565.
+   * @param[in]       *pSrc points to the YUV 4:2:2 pixels
+   * @param[out]      *pDst points to the RGB565 pixels
+   * @param[in]       numPixels even number of pixels
+   * @param[in]       order order of the bytes of a pair of pixels
    * @return none.
    */
 
-  void arm_fir_lattice_init_q15(
-				arm_fir_lattice_instance_q15 * S,
-				uint16_t numStages,
-				q15_t * pCoeffs,
-				q15_t * pState);
-
+  void arm_img_yuv422_to_rgb565(
+				uint8_t * pSrc,
+				uint16_t * pDst,
+				uint32_t numPixels,
+				arm_img_yuv_order order);
 
   /**
-   * @brief Processing function for the Q15 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Extracts the luma of YUV 4:2:2 pixels as 8-bit grayscale pixels.
+   * @param[in]       *pSrc points to the YUV 4:2:2 pixels
+   * @param[out]      *pDst points to the 8-bit pixels
+   * @param[in]       numPixels even number of pixels
+   * @param[in]       order order of the bytes of a pair of pixels
    * @return none.
    */
-  void arm_fir_lattice_q15(
-			   const arm_fir_lattice_instance_q15 * S,
-			    q15_t * pSrc,
-			   q15_t * pDst,
-			   uint32_t blockSize);
+
+  void arm_img_yuv422_to_y8(
+			    uint8_t * pSrc,
+			    uint8_t * pDst,
+			    uint32_t numPixels,
+			    arm_img_yuv_order order);
 
   /**
-   * @brief Initialization function for the Q31 FIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 FIR lattice structure.
-   * @param[in] numStages  number of filter stages.
-   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
-   * @param[in] *pState points to the state buffer.   The array is of length numStages.
+   * @brief Computes the luma of RGB565 pixels as 8-bit grayscale pixels.
+   * @param[in]       *pSrc points to the RGB565 pixels
+   * @param[out]      *pDst points to the 8-bit pixels
+   * @param[in]       numPixels number of pixels
    * @return none.
    */
 
-  void arm_fir_lattice_init_q31(
-				arm_fir_lattice_instance_q31 * S,
-				uint16_t numStages,
-				q31_t * pCoeffs,
-				q31_t * pState);
-
+  void arm_img_rgb565_to_y8(
+			    uint16_t * pSrc,
+			    uint8_t * pDst,
+			    uint32_t numPixels);
 
   /**
-   * @brief Processing function for the Q31 FIR lattice filter.
-   * @param[in]  *S        points to an instance of the Q31 FIR lattice structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @brief Processor features detected by arm_math_dispatch_init().
    */
 
-  void arm_fir_lattice_q31(
-			   const arm_fir_lattice_instance_q31 * S,
-			    q31_t * pSrc,
-			   q31_t * pDst,
-			   uint32_t blockSize);
+#define ARM_MATH_FEATURE_CM3	0x1u	/**< Cortex-M3 */
+#define ARM_MATH_FEATURE_CM4	0x2u	/**< Cortex-M4, with the DSP instructions */
+#define ARM_MATH_FEATURE_FPU	0x4u	/**< single precision floating-point unit */
 
-/**
- * @brief Initialization function for the floating-point FIR lattice filter.
- * @param[in] *S points to an instance of the floating-point FIR lattice structure.
- * @param[in] numStages  number of filter stages.
- * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
- * @param[in] *pState points to the state buffer.  The array is of length numStages.
- * @return none.
- */
+  /**
+   * @brief Table of the kernels selected at run time.
+   */
 
-  void arm_fir_lattice_init_f32(
-				arm_fir_lattice_instance_f32 * S,
-				uint16_t numStages,
-				float32_t * pCoeffs,
-				float32_t * pState);
+  typedef struct
+  {
+    uint32_t features;	/**< ARM_MATH_FEATURE_ flags of the processor. */
+    void (*fir_f32) (const arm_fir_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+    void (*fir_q31) (const arm_fir_instance_q31 * S, q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+    void (*fir_q15) (const arm_fir_instance_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+    void (*fir_fast_q15) (const arm_fir_instance_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+    void (*biquad_cascade_df1_f32) (const arm_biquad_casd_df1_inst_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+    void (*biquad_cascade_df1_q31) (const arm_biquad_casd_df1_inst_q31 * S, q31_t * pSrc, q31_t * pDst, uint32_t blockSize);
+    void (*biquad_cascade_df1_q15) (const arm_biquad_casd_df1_inst_q15 * S, q15_t * pSrc, q15_t * pDst, uint32_t blockSize);
+    void (*dot_prod_f32) (float32_t * pSrcA, float32_t * pSrcB, uint32_t blockSize, float32_t * result);
+    void (*dot_prod_q31) (q31_t * pSrcA, q31_t * pSrcB, uint32_t blockSize, q63_t * result);
+    void (*dot_prod_q15) (q15_t * pSrcA, q15_t * pSrcB, uint32_t blockSize, q63_t * result);
+    arm_status (*mat_mult_f32) (const arm_matrix_instance_f32 * pSrcA, const arm_matrix_instance_f32 * pSrcB, arm_matrix_instance_f32 * pDst);
+    arm_status (*mat_mult_q15) (const arm_matrix_instance_q15 * pSrcA, const arm_matrix_instance_q15 * pSrcB, arm_matrix_instance_q15 * pDst, q15_t * pState);
+  } arm_math_dispatch_table;
 
   /**
-   * @brief Processing function for the floating-point FIR lattice filter.
-   * @param[in]  *S        points to an instance of the floating-point FIR lattice structure.
-   * @param[in]  *pSrc     points to the block of input data.
-   * @param[out] *pDst     points to the block of output data
-   * @param[in]  blockSize number of samples to process.
-   * @return none.
+   * @brief  Selects the kernel variants for the processor that runs the code.
+   * @param[out]      *D points to the table of kernels to fill
+   * @return ARM_MATH_SUCCESS on a Cortex-M3 or a Cortex-M4, ARM_MATH_ARGUMENT_ERROR on another processor.
    */
 
-  void arm_fir_lattice_f32(
-			   const arm_fir_lattice_instance_f32 * S,
-			    float32_t * pSrc,
-			   float32_t * pDst,
-			   uint32_t blockSize);
+  arm_status arm_math_dispatch_init(
+				    arm_math_dispatch_table * D);
 
   /**
-   * @brief Instance structure for the Q15 IIR lattice filter.
+   * @brief Instance structure for the numerically controlled oscillator.
    */
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    q15_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q15_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
-    q15_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_q15;
+    uint32_t phase;            /**< phase accumulator, 2^32 for one period. */
+    uint32_t phaseInc;         /**< phase increment per sample, frequency / sampling frequency * 2^32. */
+  } arm_nco_instance;
 
   /**
-   * @brief Instance structure for the Q31 IIR lattice filter.
+   * @brief Type of frequency sweep of a chirp.
+   */
+  typedef enum
+  {
+    ARM_CHIRP_LINEAR = 0,      /**< frequency increasing or decreasing by a constant step per sample */
+    ARM_CHIRP_LOG = 1          /**< frequency multiplied by a constant ratio per sample */
+  } arm_chirp_type;
+
+  /**
+   * @brief Instance structure for the chirp generator.
    */
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    q31_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
-    q31_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
-    q31_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_q31;
+    uint32_t phase;            /**< phase accumulator, 2^32 for one period. */
+    uint32_t phaseInc;         /**< current phase increment per sample. */
+    uint32_t incStart;         /**< phase increment at the start of a sweep. */
+    int32_t incStep;           /**< change of the phase increment per sample, linear chirp. */
+    float32_t incF;            /**< current phase increment per sample, logarithmic chirp. */
+    float32_t incRatio;        /**< ratio of the phase increment per sample, logarithmic chirp. */
+    uint32_t length;           /**< number of samples of a sweep. */
+    uint32_t count;            /**< number of samples generated in the current sweep. */
+    arm_chirp_type type;       /**< type of frequency sweep. */
+  } arm_chirp_instance;
+
+#define ARM_NOISE_PINK_ROWS	15	/**< number of random rows summed by the pink noise generator */
 
   /**
-   * @brief Instance structure for the floating-point IIR lattice filter.
+   * @brief Spectrum of a noise generator.
+   */
+  typedef enum
+  {
+    ARM_NOISE_WHITE = 0,       /**< flat spectrum */
+    ARM_NOISE_PINK = 1         /**< spectrum falling by 3 dB per octave */
+  } arm_noise_type;
+
+  /**
+   * @brief Instance structure for the noise generator.
    */
   typedef struct
   {
-    uint16_t numStages;                         /**< number of stages in the filter. */
-    float32_t *pState;                          /**< points to the state variable array. The array is of length numStages+blockSize. */
-    float32_t *pkCoeffs;                        /**< points to the reflection coefficient array. The array is of length numStages. */
-    float32_t *pvCoeffs;                        /**< points to the ladder coefficient array. The array is of length numStages+1. */
-  } arm_iir_lattice_instance_f32;
+    arm_noise_type type;       /**< spectrum of the noise. */
+    uint32_t (*pRandFunc) (void);      /**< source of 32-bit random numbers, such as RNG_GetRandomNumber(), or NULL for the xorshift generator. */
+    uint32_t seed;             /**< state of the xorshift generator, never 0. */
+    uint32_t counter;          /**< sample counter selecting the pink noise row to update. */
+    q31_t sum;                 /**< sum of the pink noise rows. */
+    q15_t rows[ARM_NOISE_PINK_ROWS];   /**< pink noise rows. */
+  } arm_noise_instance;
 
   /**
-   * @brief Processing function for the floating-point IIR lattice filter.
-   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
+   * @brief  Initialization function for the numerically controlled oscillator.
+   * @param[out]      *S points to an instance of the oscillator
+   * @param[in]       freq frequency, divided by the sampling frequency
+   * @param[in]       phase initial phase, in periods
    * @return none.
    */
 
-  void arm_iir_lattice_f32(
-			   const arm_iir_lattice_instance_f32 * S,
-			    float32_t * pSrc,
-			   float32_t * pDst,
-			   uint32_t blockSize);
+  void arm_nco_init(
+		    arm_nco_instance * S,
+		    float32_t freq,
+		    float32_t phase);
 
   /**
-   * @brief Initialization function for the floating-point IIR lattice filter.
-   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
-   * @param[in] numStages number of stages in the filter.
-   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize-1.
-   * @param[in] blockSize number of samples to process.
+   * @brief  Numerically controlled oscillator with Q31 output.
+   * @param[in,out]   *S points to an instance of the oscillator
+   * @param[out]      *pDst points to the output block
+   * @param[in]       blockSize number of samples to generate
    * @return none.
    */
 
-  void arm_iir_lattice_init_f32(
-				arm_iir_lattice_instance_f32 * S,
-				uint16_t numStages,
-				float32_t *pkCoeffs,
-				float32_t *pvCoeffs,
-				float32_t *pState,
-				uint32_t blockSize);
-
+  void arm_nco_q31(
+		   arm_nco_instance * S,
+		   q31_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q31 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
+   * @brief  Numerically controlled oscillator with Q15 output.
+   * @param[in,out]   *S points to an instance of the oscillator
+   * @param[out]      *pDst points to the output block
+   * @param[in]       blockSize number of samples to generate
    * @return none.
    */
 
-  void arm_iir_lattice_q31(
-			   const arm_iir_lattice_instance_q31 * S,
-			    q31_t * pSrc,
-			   q31_t * pDst,
-			   uint32_t blockSize);
-
+  void arm_nco_q15(
+		   arm_nco_instance * S,
+		   q15_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief Initialization function for the Q31 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
-   * @param[in] numStages number of stages in the filter.
-   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
-   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
-   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize.
-   * @param[in] blockSize number of samples to process.
+   * @brief  Numerically controlled oscillator with floating-point output.
+   * @param[in,out]   *S points to an instance of the oscillator
+   * @param[out]      *pDst points to the output block
+   * @param[in]       blockSize number of samples to generate
    * @return none.
    */
 
-  void arm_iir_lattice_init_q31(
-				arm_iir_lattice_instance_q31 * S,
-				uint16_t numStages,
-				q31_t *pkCoeffs,
-				q31_t *pvCoeffs,
-				q31_t *pState,
-				uint32_t blockSize);
-
+  void arm_nco_f32(
+		   arm_nco_instance * S,
+		   float32_t * pDst,
+		   uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 IIR lattice filter.
-   * @param[in] *S points to an instance of the Q15 IIR lattice structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[out] *pDst points to the block of output data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief  Initialization function for the chirp generator.
+   * @param[out]      *S points to an instance of the chirp generator
+   * @param[in]       type linear or logarithmic sweep
+   * @param[in]       f0 start frequency, divided by the sampling frequency, in [0 0.5)
+   * @param[in]       f1 end frequency, divided by the sampling frequency, in [0 0.5)
+   * @param[in]       length number of samples of a sweep
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if a frequency is out of range, the
+   * length is 0, or a frequency of a logarithmic sweep is 0.
    */
 
-  void arm_iir_lattice_q15(
-			   const arm_iir_lattice_instance_q15 * S,
-			    q15_t * pSrc,
-			   q15_t * pDst,
-			   uint32_t blockSize);
-
+  arm_status arm_chirp_init(
+			    arm_chirp_instance * S,
+			    arm_chirp_type type,
+			    float32_t f0,
+			    float32_t f1,
+			    uint32_t length);
 
-/**
- * @brief Initialization function for the Q15 IIR lattice filter.
- * @param[in] *S points to an instance of the fixed-point Q15 IIR lattice structure.
- * @param[in] numStages  number of stages in the filter.
- * @param[in] *pkCoeffs points to reflection coefficient buffer.  The array is of length numStages.
- * @param[in] *pvCoeffs points to ladder coefficient buffer.  The array is of length numStages+1.
- * @param[in] *pState points to state buffer.  The array is of length numStages+blockSize.
- * @param[in] blockSize number of samples to process per call.
- * @return none.
- */
+  /**
+   * @brief  Chirp generator with Q15 output.
+   * @param[in,out]   *S points to an instance of the chirp generator
+   * @param[out]      *pDst points to the output block
+   * @param[in]       blockSize number of samples to generate
+   * @return none.
+   */
 
-  void arm_iir_lattice_init_q15(
-				arm_iir_lattice_instance_q15 * S,
-				uint16_t numStages,
-				q15_t *pkCoeffs,
-				q15_t *pvCoeffs,
-				q15_t *pState,
-				uint32_t blockSize);
+  void arm_chirp_q15(
+		     arm_chirp_instance * S,
+		     q15_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the floating-point LMS filter.
+   * @brief  Chirp generator with floating-point output.
+   * @param[in,out]   *S points to an instance of the chirp generator
+   * @param[out]      *pDst points to the output block
+   * @param[in]       blockSize number of samples to generate
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;        /**< step size that controls filter coefficient updates. */
-  } arm_lms_instance_f32;
+  void arm_chirp_f32(
+		     arm_chirp_instance * S,
+		     float32_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Processing function for floating-point LMS filter.
-   * @param[in]  *S points to an instance of the floating-point LMS filter structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[in]  *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in]  blockSize number of samples to process.
-   * @return     none.
+   * @brief  Initialization function for the noise generator.
+   * @param[out]      *S points to an instance of the noise generator
+   * @param[in]       type white or pink noise
+   * @param[in]       *pRandFunc source of 32-bit random numbers, or NULL for the xorshift generator
+   * @param[in]       seed seed of the xorshift generator
+   * @return none.
    */
 
-  void arm_lms_f32(
-		   const arm_lms_instance_f32 * S,
-		    float32_t * pSrc,
-		    float32_t * pRef,
-		   float32_t * pOut,
-		   float32_t * pErr,
-		   uint32_t blockSize);
+  void arm_noise_init(
+		      arm_noise_instance * S,
+		      arm_noise_type type,
+		      uint32_t (*pRandFunc) (void),
+		      uint32_t seed);
 
   /**
-   * @brief Initialization function for floating-point LMS filter.
-   * @param[in] *S points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to the coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
+   * @brief  Noise generator with Q15 output.
+   * @param[in,out]   *S points to an instance of the noise generator
+   * @param[out]      *pDst points to the output block
+   * @param[in]       blockSize number of samples to generate
    * @return none.
    */
 
-  void arm_lms_init_f32(
-			arm_lms_instance_f32 * S,
-			uint16_t numTaps,
-			float32_t * pCoeffs,
-			float32_t * pState,
-			float32_t mu,
-			uint32_t blockSize);
+  void arm_noise_q15(
+		     arm_noise_instance * S,
+		     q15_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Instance structure for the Q15 LMS filter.
+   * @brief  Noise generator with floating-point output.
+   * @param[in,out]   *S points to an instance of the noise generator
+   * @param[out]      *pDst points to the output block
+   * @param[in]       blockSize number of samples to generate
+   * @return none.
    */
 
-  typedef struct
-  {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
-  } arm_lms_instance_q15;
-
+  void arm_noise_f32(
+		     arm_noise_instance * S,
+		     float32_t * pDst,
+		     uint32_t blockSize);
 
   /**
-   * @brief Initialization function for the Q15 LMS filter.
-   * @param[in] *S points to an instance of the Q15 LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to the coefficient buffer.
-   * @param[in] *pState points to the state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return    none.
+   * @brief Sine table of the signal generators, 512 points per period and the first point repeated, in 1.31 format.
    */
-
-  void arm_lms_init_q15(
-			arm_lms_instance_q15 * S,
-			uint16_t numTaps,
-			q15_t * pCoeffs,
-			q15_t * pState,
-			q15_t mu,
-			uint32_t blockSize,
-			uint32_t postShift);
+  extern const q31_t armNcoSinTableQ31[513];
 
   /**
-   * @brief Processing function for Q15 LMS filter.
-   * @param[in] *S points to an instance of the Q15 LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
+   * @brief  Sine of a phase, by linear interpolation in armNcoSinTableQ31.
+   * @param[in]       phase phase, 2^32 for one period
+   * @return sin(2 * pi * phase / 2^32) in 1.31 format.
    */
 
-  void arm_lms_q15(
-		   const arm_lms_instance_q15 * S,
-		    q15_t * pSrc,
-		    q15_t * pRef,
-		   q15_t * pOut,
-		   q15_t * pErr,
-		   uint32_t blockSize);
+  static __INLINE q31_t arm_nco_sin_q31(
+					uint32_t phase)
+  {
+    const q31_t *pTable = &armNcoSinTableQ31[phase >> 23];       /* Nearest lower point */
+    q31_t y0 = pTable[0];
 
+    /* The 23 low bits of the phase are the fraction between two points */
+    return (y0 + (q31_t) (((q63_t) (pTable[1] - y0) * (q31_t) (phase & 0x7FFFFFu)) >> 23));
+  }
 
   /**
-   * @brief Instance structure for the Q31 LMS filter.
+   * @brief  Next sample of a noise generator.
+   * @param[in,out]   *S points to an instance of the noise generator
+   * @return noise sample in 1.15 format.
    */
 
-  typedef struct
+  static __INLINE q15_t arm_noise_sample_q15(
+					     arm_noise_instance * S)
   {
-    uint16_t numTaps;    /**< number of coefficients in the filter. */
-    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;            /**< step size that controls filter coefficient updates. */
-    uint32_t postShift;  /**< bit shift applied to coefficients. */
+    uint32_t r;                                  /* Random number */
+    uint32_t cnt;                                /* Counter shifted to its lowest set bit */
+    uint32_t k;                                  /* Row to update */
 
-  } arm_lms_instance_q31;
+    if(S->pRandFunc != NULL)
+    {
+      r = S->pRandFunc();
+    }
+    else
+    {
+      /* xorshift32 */
+      r = S->seed;
+      r ^= r << 13;
+      r ^= r >> 17;
+      r ^= r << 5;
+      S->seed = r;
+    }
+
+    if(S->type == ARM_NOISE_WHITE)
+    {
+      return ((q15_t) (r >> 16));
+    }
 
-  /**
-   * @brief Processing function for Q31 LMS filter.
-   * @param[in]  *S points to an instance of the Q15 LMS filter structure.
-   * @param[in]  *pSrc points to the block of input data.
-   * @param[in]  *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in]  blockSize number of samples to process.
-   * @return     none.
-   */
+    /* Voss-McCartney: the row k is renewed every 2^(k + 1) samples, from the 12 high bits
+     ** of the random number, and the 12 next bits are a white row renewed every sample */
+    cnt = ++S->counter;
+    k = 0u;
 
-  void arm_lms_q31(
-		   const arm_lms_instance_q31 * S,
-		    q31_t * pSrc,
-		    q31_t * pRef,
-		   q31_t * pOut,
-		   q31_t * pErr,
-		   uint32_t blockSize);
+    while(((cnt & 0x1u) == 0u) && (k < ARM_NOISE_PINK_ROWS))
+    {
+      cnt >>= 1u;
+      k++;
+    }
 
-  /**
-   * @brief Initialization function for Q31 LMS filter.
-   * @param[in] *S points to an instance of the Q31 LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
-   */
+    if(k < ARM_NOISE_PINK_ROWS)
+    {
+      S->sum -= S->rows[k];
+      S->rows[k] = (q15_t) ((int32_t) r >> 20);
+      S->sum += S->rows[k];
+    }
 
-  void arm_lms_init_q31(
-			arm_lms_instance_q31 * S,
-			uint16_t numTaps,
-			q31_t *pCoeffs,
-			q31_t *pState,
-			q31_t mu,
-			uint32_t blockSize,
-			uint32_t postShift);
+    /* The sum of 16 rows of 12 bits is in the range of 1.15 */
+    return ((q15_t) (S->sum + ((int32_t) (r << 12) >> 20)));
+  }
 
-  /**
-   * @brief Instance structure for the floating-point normalized LMS filter.
-   */
+/**  
+ * @brief Convolution of floating-point sequences.  
+ * @param[in] *pSrcA points to the first input sequence.  
+ * @param[in] srcALen length of the first input sequence.  
+ * @param[in] *pSrcB points to the second input sequence.  
+ * @param[in] srcBLen length of the second input sequence.  
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.  
+ * @return none.  
+ */ 
 
-  typedef struct
-  {
-    uint16_t  numTaps;    /**< number of coefficients in the filter. */
-    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
-    float32_t mu;        /**< step size that control filter coefficient updates. */
-    float32_t energy;    /**< saves previous frame energy. */
-    float32_t x0;        /**< saves previous input sample. */
-  } arm_lms_norm_instance_f32;
+  void arm_conv_f32(
+		     float32_t * pSrcA,
+		    uint32_t srcALen,
+		     float32_t * pSrcB,
+		    uint32_t srcBLen,
+		    float32_t * pDst);
+
+/**  
+ * @brief Convolution of Q15 sequences.  
+ * @param[in] *pSrcA points to the first input sequence.  
+ * @param[in] srcALen length of the first input sequence.  
+ * @param[in] *pSrcB points to the second input sequence.  
+ * @param[in] srcBLen length of the second input sequence.  
+ * @param[out] *pDst points to the location where the output result is written.  Length srcALen+srcBLen-1.  
+ * @return none.  
+ */
+
+  void arm_conv_q15(
+		     q15_t * pSrcA,
+		    uint32_t srcALen,
+		     q15_t * pSrcB,
+		    uint32_t srcBLen,
+		    q15_t * pDst);
 
   /**
-   * @brief Processing function for floating-point normalized LMS filter.
-   * @param[in] *S points to an instance of the floating-point normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
+   * @brief Convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
    * @return none.
    */
 
-  void arm_lms_norm_f32(
-			arm_lms_norm_instance_f32 * S,
-			 float32_t * pSrc,
-			 float32_t * pRef,
-			float32_t * pOut,
-			float32_t * pErr,
-			uint32_t blockSize);
-
-  /**
-   * @brief Initialization function for floating-point normalized LMS filter.
-   * @param[in] *S points to an instance of the floating-point LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
-   */
-
-  void arm_lms_norm_init_f32(
-			     arm_lms_norm_instance_f32 * S,
-			     uint16_t numTaps,
-			     float32_t * pCoeffs,
-			     float32_t * pState,
-			     float32_t mu,
-			     uint32_t blockSize);
-
-
-  /**
-   * @brief Instance structure for the Q31 normalized LMS filter.
-   */
-  typedef struct
-  {
-    uint16_t numTaps;     /**< number of coefficients in the filter. */
-    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q31_t mu;             /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;    /**< bit shift applied to coefficients. */
-    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
-    q31_t energy;         /**< saves previous frame energy. */
-    q31_t x0;             /**< saves previous input sample. */
-  } arm_lms_norm_instance_q31;
-
-  /**
-   * @brief Processing function for Q31 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
-   */
-
-  void arm_lms_norm_q31(
-			arm_lms_norm_instance_q31 * S,
-			 q31_t * pSrc,
-			 q31_t * pRef,
-			q31_t * pOut,
-			q31_t * pErr,
-			uint32_t blockSize);
-
-  /**
-   * @brief Initialization function for Q31 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
-   */
-
-  void arm_lms_norm_init_q31(
-			     arm_lms_norm_instance_q31 * S,
-			     uint16_t numTaps,
-			     q31_t * pCoeffs,
-			     q31_t * pState,
-			     q31_t mu,
-			     uint32_t blockSize,
-			     uint8_t postShift);
-
-  /**
-   * @brief Instance structure for the Q15 normalized LMS filter.
-   */
-
-  typedef struct
-  {
-    uint16_t numTaps;    /**< Number of coefficients in the filter. */
-    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
-    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
-    q15_t mu;            /**< step size that controls filter coefficient updates. */
-    uint8_t postShift;   /**< bit shift applied to coefficients. */
-    q15_t *recipTable;   /**< Points to the reciprocal initial value table. */
-    q15_t energy;        /**< saves previous frame energy. */
-    q15_t x0;            /**< saves previous input sample. */
-  } arm_lms_norm_instance_q15;
-
-  /**
-   * @brief Processing function for Q15 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in] *pSrc points to the block of input data.
-   * @param[in] *pRef points to the block of reference data.
-   * @param[out] *pOut points to the block of output data.
-   * @param[out] *pErr points to the block of error data.
-   * @param[in] blockSize number of samples to process.
-   * @return none.
-   */
-
-  void arm_lms_norm_q15(
-			arm_lms_norm_instance_q15 * S,
-			 q15_t * pSrc,
-			 q15_t * pRef,
-			q15_t * pOut,
-			q15_t * pErr,
-			uint32_t blockSize);
-
-
-  /**
-   * @brief Initialization function for Q15 normalized LMS filter.
-   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
-   * @param[in] numTaps  number of filter coefficients.
-   * @param[in] *pCoeffs points to coefficient buffer.
-   * @param[in] *pState points to state buffer.
-   * @param[in] mu step size that controls filter coefficient updates.
-   * @param[in] blockSize number of samples to process.
-   * @param[in] postShift bit shift applied to coefficients.
-   * @return none.
-   */
-
-  void arm_lms_norm_init_q15(
-			     arm_lms_norm_instance_q15 * S,
-			     uint16_t numTaps,
-			     q15_t * pCoeffs,
-			     q15_t * pState,
-			     q15_t mu,
-			     uint32_t blockSize,
-			     uint8_t postShift);
-
-  /**
-   * @brief Correlation of floating-point sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
-   */
-
-  void arm_correlate_f32(
-			  float32_t * pSrcA,
-			 uint32_t srcALen,
-			  float32_t * pSrcB,
-			 uint32_t srcBLen,
-			 float32_t * pDst);
-
-  /**
-   * @brief Correlation of Q15 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
-   */
-
-  void arm_correlate_q15(
+  void arm_conv_fast_q15(
 			  q15_t * pSrcA,
 			 uint32_t srcALen,
 			  q15_t * pSrcB,
@@ -4246,33 +5730,33 @@ extern "C"
 			 q15_t * pDst);
 
   /**
-   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+   * @brief Convolution of Q31 sequences.
    * @param[in] *pSrcA points to the first input sequence.
    * @param[in] srcALen length of the first input sequence.
    * @param[in] *pSrcB points to the second input sequence.
    * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
    * @return none.
    */
 
-  void arm_correlate_fast_q15(
-			       q15_t * pSrcA,
-			      uint32_t srcALen,
-			       q15_t * pSrcB,
-			      uint32_t srcBLen,
-			      q15_t * pDst);
+  void arm_conv_q31(
+		     q31_t * pSrcA,
+		    uint32_t srcALen,
+		     q31_t * pSrcB,
+		    uint32_t srcBLen,
+		    q31_t * pDst);
 
   /**
-   * @brief Correlation of Q31 sequences.
+   * @brief Convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
    * @param[in] *pSrcA points to the first input sequence.
    * @param[in] srcALen length of the first input sequence.
    * @param[in] *pSrcB points to the second input sequence.
    * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
    * @return none.
    */
 
-  void arm_correlate_q31(
+  void arm_conv_fast_q31(
 			  q31_t * pSrcA,
 			 uint32_t srcALen,
 			  q31_t * pSrcB,
@@ -4280,583 +5764,4751 @@ extern "C"
 			 q31_t * pDst);
 
   /**
-   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @brief Convolution of Q7 sequences.
    * @param[in] *pSrcA points to the first input sequence.
    * @param[in] srcALen length of the first input sequence.
    * @param[in] *pSrcB points to the second input sequence.
    * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[out] *pDst points to the block of output data  Length srcALen+srcBLen-1.
    * @return none.
    */
 
-  void arm_correlate_fast_q31(
-			       q31_t * pSrcA,
-			      uint32_t srcALen,
-			       q31_t * pSrcB,
-			      uint32_t srcBLen,
-			      q31_t * pDst);
+  void arm_conv_q7(
+		    q7_t * pSrcA,
+		   uint32_t srcALen,
+		    q7_t * pSrcB,
+		   uint32_t srcBLen,
+		   q7_t * pDst);
 
   /**
-   * @brief Correlation of Q7 sequences.
-   * @param[in] *pSrcA points to the first input sequence.
-   * @param[in] srcALen length of the first input sequence.
-   * @param[in] *pSrcB points to the second input sequence.
-   * @param[in] srcBLen length of the second input sequence.
-   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
-   * @return none.
+   * @brief Partial convolution of floating-point sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
 
-  void arm_correlate_q7(
-			 q7_t * pSrcA,
-			uint32_t srcALen,
-			 q7_t * pSrcB,
-			uint32_t srcBLen,
-			q7_t * pDst);
-
-  /**
-   * @brief Instance structure for the floating-point sparse FIR filter.
-   */
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_f32;
+  arm_status arm_conv_partial_f32(
+				   float32_t * pSrcA,
+				  uint32_t srcALen,
+				   float32_t * pSrcB,
+				  uint32_t srcBLen,
+				  float32_t * pDst,
+				  uint32_t firstIndex,
+				  uint32_t numPoints);
 
   /**
-   * @brief Instance structure for the Q31 sparse FIR filter.
+   * @brief Partial convolution of Q15 sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
    */
 
-  typedef struct
-  {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q31;
+  arm_status arm_conv_partial_q15(
+				   q15_t * pSrcA,
+				  uint32_t srcALen,
+				   q15_t * pSrcB,
+				  uint32_t srcBLen,
+				  q15_t * pDst,
+				  uint32_t firstIndex,
+				  uint32_t numPoints);
 
   /**
-   * @brief Instance structure for the Q15 sparse FIR filter.
+   * @brief Partial convolution of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  arm_status arm_conv_partial_fast_q15(
+				        q15_t * pSrcA,
+				       uint32_t srcALen,
+				        q15_t * pSrcB,
+				       uint32_t srcBLen,
+				       q15_t * pDst,
+				       uint32_t firstIndex,
+				       uint32_t numPoints);
+
+  /**
+   * @brief Partial convolution of Q31 sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  arm_status arm_conv_partial_q31(
+				   q31_t * pSrcA,
+				  uint32_t srcALen,
+				   q31_t * pSrcB,
+				  uint32_t srcBLen,
+				  q31_t * pDst,
+				  uint32_t firstIndex,
+				  uint32_t numPoints);
+
+
+  /**
+   * @brief Partial convolution of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  arm_status arm_conv_partial_fast_q31(
+				        q31_t * pSrcA,
+				       uint32_t srcALen,
+				        q31_t * pSrcB,
+				       uint32_t srcBLen,
+				       q31_t * pDst,
+				       uint32_t firstIndex,
+				       uint32_t numPoints);
+
+  /**
+   * @brief Partial convolution of Q7 sequences.
+   * @param[in]       *pSrcA points to the first input sequence.
+   * @param[in]       srcALen length of the first input sequence.
+   * @param[in]       *pSrcB points to the second input sequence.
+   * @param[in]       srcBLen length of the second input sequence.
+   * @param[out]      *pDst points to the block of output data
+   * @param[in]       firstIndex is the first output sample to start with.
+   * @param[in]       numPoints is the number of output points to be computed.
+   * @return  Returns either ARM_MATH_SUCCESS if the function completed correctly or ARM_MATH_ARGUMENT_ERROR if the requested subset is not in the range [0 srcALen+srcBLen-2].
+   */
+
+  arm_status arm_conv_partial_q7(
+				  q7_t * pSrcA,
+				 uint32_t srcALen,
+				  q7_t * pSrcB,
+				 uint32_t srcBLen,
+				 q7_t * pDst,
+				 uint32_t firstIndex,
+				 uint32_t numPoints);
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR decimator.
    */
 
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q15;
+    uint8_t M;                      /**< decimation factor. */
+    uint16_t numTaps;               /**< number of coefficients in the filter. */
+    q15_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
+    q15_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_decimate_instance_q15;
 
   /**
-   * @brief Instance structure for the Q7 sparse FIR filter.
+   * @brief Instance structure for the Q31 FIR decimator.
    */
 
   typedef struct
   {
-    uint16_t numTaps;             /**< number of coefficients in the filter. */
-    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
-    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
-    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
-    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
-    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
-  } arm_fir_sparse_instance_q7;
+    uint8_t M;                  /**< decimation factor. */
+    uint16_t numTaps;           /**< number of coefficients in the filter. */
+    q31_t *pCoeffs;              /**< points to the coefficient array. The array is of length numTaps.*/
+    q31_t *pState;               /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+
+  } arm_fir_decimate_instance_q31;
 
   /**
-   * @brief Processing function for the floating-point sparse FIR filter.
-   * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.
-   * @param[in]  *pSrc       points to the block of input data.
-   * @param[out] *pDst       points to the block of output data
-   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
-   * @return none.
+   * @brief Instance structure for the floating-point FIR decimator.
    */
 
-  void arm_fir_sparse_f32(
-			  arm_fir_sparse_instance_f32 * S,
-			   float32_t * pSrc,
-			  float32_t * pDst,
-			  float32_t * pScratchIn,
-			  uint32_t blockSize);
+  typedef struct
+  {
+    uint8_t M;                          /**< decimation factor. */
+    uint16_t numTaps;                   /**< number of coefficients in the filter. */
+    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numTaps.*/
+    float32_t *pState;                   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+
+  } arm_fir_decimate_instance_f32;
+
+
 
   /**
-   * @brief  Initialization function for the floating-point sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the floating-point sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @brief Processing function for the floating-point FIR decimator.
+   * @param[in] *S points to an instance of the floating-point FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
    * @return none
    */
 
-  void arm_fir_sparse_init_f32(
-			       arm_fir_sparse_instance_f32 * S,
-			       uint16_t numTaps,
-			       float32_t * pCoeffs,
-			       float32_t * pState,
-			       int32_t * pTapDelay,
-			       uint16_t maxDelay,
-			       uint32_t blockSize);
+  void arm_fir_decimate_f32(
+			    const arm_fir_decimate_instance_f32 * S,
+			     float32_t * pSrc,
+			    float32_t * pDst,
+			    uint32_t blockSize);
+
 
   /**
-   * @brief Processing function for the Q31 sparse FIR filter.
-   * @param[in]  *S          points to an instance of the Q31 sparse FIR structure.
-   * @param[in]  *pSrc       points to the block of input data.
-   * @param[out] *pDst       points to the block of output data
-   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize   number of input samples to process per call.
-   * @return none.
+   * @brief  Initialization function for the floating-point FIR decimator.
+   * @param[in,out] *S points to an instance of the floating-point FIR decimator structure.
+   * @param[in] numTaps  number of coefficients in the filter.
+   * @param[in] M  decimation factor.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
    */
 
-  void arm_fir_sparse_q31(
-			  arm_fir_sparse_instance_q31 * S,
-			   q31_t * pSrc,
-			  q31_t * pDst,
-			  q31_t * pScratchIn,
-			  uint32_t blockSize);
+  arm_status arm_fir_decimate_init_f32(
+				       arm_fir_decimate_instance_f32 * S,
+				       uint16_t numTaps,
+				       uint8_t M,
+				       float32_t * pCoeffs,
+				       float32_t * pState,
+				       uint32_t blockSize);
 
   /**
-   * @brief  Initialization function for the Q31 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q31 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @brief Processing function for the Q15 FIR decimator.
+   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
    * @return none
    */
 
-  void arm_fir_sparse_init_q31(
-			       arm_fir_sparse_instance_q31 * S,
-			       uint16_t numTaps,
-			       q31_t * pCoeffs,
-			       q31_t * pState,
-			       int32_t * pTapDelay,
-			       uint16_t maxDelay,
-			       uint32_t blockSize);
+  void arm_fir_decimate_q15(
+			    const arm_fir_decimate_instance_q15 * S,
+			     q15_t * pSrc,
+			    q15_t * pDst,
+			    uint32_t blockSize);
 
   /**
-   * @brief Processing function for the Q15 sparse FIR filter.
-   * @param[in]  *S           points to an instance of the Q15 sparse FIR structure.
-   * @param[in]  *pSrc        points to the block of input data.
-   * @param[out] *pDst        points to the block of output data
-   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
-   * @return none.
+   * @brief Processing function for the Q15 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
+   * @param[in] *S points to an instance of the Q15 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
    */
 
-  void arm_fir_sparse_q15(
-			  arm_fir_sparse_instance_q15 * S,
-			   q15_t * pSrc,
-			  q15_t * pDst,
-			  q15_t * pScratchIn,
-			  q31_t * pScratchOut,
-			  uint32_t blockSize);
+  void arm_fir_decimate_fast_q15(
+				 const arm_fir_decimate_instance_q15 * S,
+				  q15_t * pSrc,
+				 q15_t * pDst,
+				 uint32_t blockSize);
+
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR decimator.
+   * @param[in,out] *S points to an instance of the Q15 FIR decimator structure.
+   * @param[in] numTaps  number of coefficients in the filter.
+   * @param[in] M  decimation factor.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+
+  arm_status arm_fir_decimate_init_q15(
+				       arm_fir_decimate_instance_q15 * S,
+				       uint16_t numTaps,
+				       uint8_t M,
+				       q15_t * pCoeffs,
+				       q15_t * pState,
+				       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR decimator.
+   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
+   */
+
+  void arm_fir_decimate_q31(
+			    const arm_fir_decimate_instance_q31 * S,
+			     q31_t * pSrc,
+			    q31_t * pDst,
+			    uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR decimator (fast variant) for Cortex-M3 and Cortex-M4.
+   * @param[in] *S points to an instance of the Q31 FIR decimator structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none
+   */
+
+  void arm_fir_decimate_fast_q31(
+				 arm_fir_decimate_instance_q31 * S,
+				  q31_t * pSrc,
+				 q31_t * pDst,
+				 uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR decimator.
+   * @param[in,out] *S points to an instance of the Q31 FIR decimator structure.
+   * @param[in] numTaps  number of coefficients in the filter.
+   * @param[in] M  decimation factor.
+   * @param[in] *pCoeffs points to the filter coefficients.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>M</code>.
+   */
+
+  arm_status arm_fir_decimate_init_q31(
+				       arm_fir_decimate_instance_q31 * S,
+				       uint16_t numTaps,
+				       uint8_t M,
+				       q31_t * pCoeffs,
+				       q31_t * pState,
+				       uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 half-band FIR decimator by 2.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of coefficients in the filter, of the form 4*K-1. */
+    q15_t *pCoeffs;                 /**< points to the nonzero coefficients of the first half and the center one. The array is of length (numTaps+5)/4. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_halfband_decimate_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 half-band FIR decimator by 2.
+   * @param[in]  *S points to an instance of the Q15 half-band decimator structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_halfband_decimate_q15(
+				      const arm_fir_halfband_decimate_instance_q15 * S,
+				      q15_t * pSrc,
+				      q15_t * pDst,
+				      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 half-band FIR decimator by 2.
+   * @param[in,out] *S points to an instance of the Q15 half-band decimator structure.
+   * @param[in] numTaps number of coefficients in the filter, of the form 4*K-1.
+   * @param[in] *pCoeffs points to the nonzero coefficients of the first half and the center one.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not of the form 4*K-1 or <code>blockSize</code> is not a multiple of 2.
+   */
+  arm_status arm_fir_halfband_decimate_init_q15(
+						 arm_fir_halfband_decimate_instance_q15 * S,
+						 uint16_t numTaps,
+						 q15_t * pCoeffs,
+						 q15_t * pState,
+						 uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 half-band FIR decimator by 2.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of coefficients in the filter, of the form 4*K-1. */
+    q31_t *pCoeffs;                 /**< points to the nonzero coefficients of the first half and the center one. The array is of length (numTaps+5)/4. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_halfband_decimate_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 half-band FIR decimator by 2.
+   * @param[in]  *S points to an instance of the Q31 half-band decimator structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_halfband_decimate_q31(
+				      const arm_fir_halfband_decimate_instance_q31 * S,
+				      q31_t * pSrc,
+				      q31_t * pDst,
+				      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 half-band FIR decimator by 2.
+   * @param[in,out] *S points to an instance of the Q31 half-band decimator structure.
+   * @param[in] numTaps number of coefficients in the filter, of the form 4*K-1.
+   * @param[in] *pCoeffs points to the nonzero coefficients of the first half and the center one.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not of the form 4*K-1 or <code>blockSize</code> is not a multiple of 2.
+   */
+  arm_status arm_fir_halfband_decimate_init_q31(
+						 arm_fir_halfband_decimate_instance_q31 * S,
+						 uint16_t numTaps,
+						 q31_t * pCoeffs,
+						 q31_t * pState,
+						 uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point half-band FIR decimator by 2.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of coefficients in the filter, of the form 4*K-1. */
+    float32_t *pCoeffs;             /**< points to the nonzero coefficients of the first half and the center one. The array is of length (numTaps+5)/4. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+  } arm_fir_halfband_decimate_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point half-band FIR decimator by 2.
+   * @param[in]  *S points to an instance of the floating-point half-band decimator structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of input samples to process per call.
+   * @return     none.
+   */
+  void arm_fir_halfband_decimate_f32(
+				      const arm_fir_halfband_decimate_instance_f32 * S,
+				      float32_t * pSrc,
+				      float32_t * pDst,
+				      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point half-band FIR decimator by 2.
+   * @param[in,out] *S points to an instance of the floating-point half-band decimator structure.
+   * @param[in] numTaps number of coefficients in the filter, of the form 4*K-1.
+   * @param[in] *pCoeffs points to the nonzero coefficients of the first half and the center one.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not of the form 4*K-1 or <code>blockSize</code> is not a multiple of 2.
+   */
+  arm_status arm_fir_halfband_decimate_init_f32(
+						 arm_fir_halfband_decimate_instance_f32 * S,
+						 uint16_t numTaps,
+						 float32_t * pCoeffs,
+						 float32_t * pState,
+						 uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point Hilbert transformer.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;               /**< number of coefficients of the antisymmetric filter, of the form 4*K-1. */
+    float32_t *pCoeffs;             /**< points to the K nonzero coefficients of the second half, h[c+1], h[c+3], ... */
+    float32_t *pState;              /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t prev[2];              /**< last analytic sample, for the instantaneous frequency. */
+  } arm_hilbert_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point Hilbert transformer.
+   * @param[in]  *S points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of complex output data, 2*blockSize values.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+  void arm_hilbert_f32(
+		       arm_hilbert_instance_f32 * S,
+		       float32_t * pSrc,
+		       float32_t * pDst,
+		       uint32_t blockSize);
+
+  /**
+   * @brief Envelope of a floating-point signal, the magnitude of its analytic signal.
+   * @param[in]  *S points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+  void arm_hilbert_envelope_f32(
+				arm_hilbert_instance_f32 * S,
+				float32_t * pSrc,
+				float32_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief Instantaneous frequency of a floating-point signal, in cycles per sample.
+   * @param[in]  *S points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data, between -0.5 and 0.5.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+  void arm_hilbert_inst_freq_f32(
+				 arm_hilbert_instance_f32 * S,
+				 float32_t * pSrc,
+				 float32_t * pDst,
+				 uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point Hilbert transformer.
+   * @param[in,out] *S points to an instance of the floating-point Hilbert transformer structure.
+   * @param[in] numTaps number of coefficients of the antisymmetric filter, of the form 4*K-1.
+   * @param[in] *pCoeffs points to the K nonzero coefficients of the second half.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] blockSize number of samples processed per call.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * <code>numTaps</code> is not of the form 4*K-1.
+   */
+  arm_status arm_hilbert_init_f32(
+				  arm_hilbert_instance_f32 * S,
+				  uint16_t numTaps,
+				  float32_t * pCoeffs,
+				  float32_t * pState,
+				  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point dynamics processor.
+   */
+  typedef struct
+  {
+    float32_t attack;               /**< detector coefficient for a rising level, in (0 1]. */
+    float32_t release;              /**< detector coefficient for a falling level, in (0 1]. */
+    float32_t env;                  /**< detector state, the level or the squared level. */
+    float32_t thresh;               /**< threshold, natural logarithm of the level. */
+    float32_t slope;                /**< gain reduction per unit over the threshold, 1 - 1/ratio. */
+    float32_t makeup;               /**< makeup gain, natural logarithm. */
+    float32_t gain;                 /**< linear gain at the end of the last block. */
+    uint8_t rmsFlag;                /**< 1 for an RMS detector, 0 for a peak detector. */
+    uint16_t delay;                 /**< look-ahead delay in samples. */
+    uint16_t delayIndex;            /**< write index of the next input sample in the delay line. */
+    float32_t *pDelay;              /**< points to the delay line, of length delay+blockSize. */
+  } arm_dynamics_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 dynamics processor.
+   */
+  typedef struct
+  {
+    q31_t attack;                   /**< detector coefficient for a rising level, in 1.31 format. */
+    q31_t release;                  /**< detector coefficient for a falling level, in 1.31 format. */
+    q31_t env;                      /**< detector state, the level or the squared level. */
+    int32_t thresh;                 /**< threshold, base 2 logarithm of the level in 16.16 format. */
+    q31_t slope;                    /**< gain reduction per unit over the threshold, 1 - 1/ratio, in 1.31 format. */
+    int32_t makeup;                 /**< makeup gain, base 2 logarithm in 16.16 format. */
+    int32_t gain;                   /**< gain at the end of the last block, base 2 logarithm in 16.16 format. */
+    uint8_t rmsFlag;                /**< 1 for an RMS detector, 0 for a peak detector. */
+    uint16_t delay;                 /**< look-ahead delay in samples. */
+    uint16_t delayIndex;            /**< write index of the next input sample in the delay line. */
+    q31_t *pDelay;                  /**< points to the delay line, of length delay+blockSize. */
+  } arm_dynamics_instance_q31;
+
+  /**
+   * @brief Processing function for the floating-point dynamics processor.
+   * @param[in,out] *S points to an instance of the floating-point dynamics processor structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of output data.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+  void arm_dynamics_f32(
+			arm_dynamics_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 dynamics processor.
+   * @param[in,out] *S points to an instance of the Q31 dynamics processor structure.
+   * @param[in]     *pSrc points to the block of input data.
+   * @param[out]    *pDst points to the block of output data.
+   * @param[in]     blockSize number of samples to process.
+   * @return        none.
+   */
+  void arm_dynamics_q31(
+			arm_dynamics_instance_q31 * S,
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point dynamics processor.
+   * @param[in,out] *S points to an instance of the floating-point dynamics processor structure.
+   * @param[in] threshDb threshold in dB relative to full scale.
+   * @param[in] ratio compression ratio, at least 1, or 0 for an infinite ratio.
+   * @param[in] makeupDb makeup gain in dB.
+   * @param[in] attack detector coefficient for a rising level, in (0 1].
+   * @param[in] release detector coefficient for a falling level, in (0 1].
+   * @param[in] rmsFlag 1 for an RMS detector, 0 for a peak detector.
+   * @param[in] delay look-ahead delay in samples.
+   * @param[in] *pDelay points to the delay line, of length delay+blockSize, unused if delay is 0.
+   * @param[in] blockSize number of samples processed per call.
+   * @return    The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for a parameter out of range.
+   */
+  arm_status arm_dynamics_init_f32(
+				   arm_dynamics_instance_f32 * S,
+				   float32_t threshDb,
+				   float32_t ratio,
+				   float32_t makeupDb,
+				   float32_t attack,
+				   float32_t release,
+				   uint8_t rmsFlag,
+				   uint16_t delay,
+				   float32_t * pDelay,
+				   uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 dynamics processor.
+   * @param[in,out] *S points to an instance of the Q31 dynamics processor structure.
+   * @param[in] threshDb threshold in dB relative to full scale.
+   * @param[in] ratio compression ratio, at least 1, or 0 for an infinite ratio.
+   * @param[in] makeupDb makeup gain in dB, -90 to 90.
+   * @param[in] attack detector coefficient for a rising level, in (0 1].
+   * @param[in] release detector coefficient for a falling level, in (0 1].
+   * @param[in] rmsFlag 1 for an RMS detector, 0 for a peak detector.
+   * @param[in] delay look-ahead delay in samples.
+   * @param[in] *pDelay points to the delay line, of length delay+blockSize, unused if delay is 0.
+   * @param[in] blockSize number of samples processed per call.
+   * @return    The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR for a parameter out of range.
+   */
+  arm_status arm_dynamics_init_q31(
+				   arm_dynamics_instance_q31 * S,
+				   float32_t threshDb,
+				   float32_t ratio,
+				   float32_t makeupDb,
+				   float32_t attack,
+				   float32_t release,
+				   uint8_t rmsFlag,
+				   uint16_t delay,
+				   q31_t * pDelay,
+				   uint32_t blockSize);
+
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_interpolate_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    q31_t *pCoeffs;                  /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                   /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_interpolate_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t L;                     /**< upsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+numTaps-1. */
+  } arm_fir_interpolate_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR interpolator.
+   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_interpolate_q15(
+			       const arm_fir_interpolate_instance_q15 * S,
+			        q15_t * pSrc,
+			       q15_t * pDst,
+			       uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  arm_status arm_fir_interpolate_init_q15(
+					  arm_fir_interpolate_instance_q15 * S,
+					  uint8_t L,
+					  uint16_t numTaps,
+					  q15_t * pCoeffs,
+					  q15_t * pState,
+					  uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR interpolator.
+   * @param[in] *S        points to an instance of the Q15 FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_interpolate_q31(
+			       const arm_fir_interpolate_instance_q31 * S,
+			        q31_t * pSrc,
+			       q31_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR interpolator.
+   * @param[in,out] *S        points to an instance of the Q31 FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  arm_status arm_fir_interpolate_init_q31(
+					  arm_fir_interpolate_instance_q31 * S,
+					  uint8_t L,
+					  uint16_t numTaps,
+					  q31_t * pCoeffs,
+					  q31_t * pState,
+					  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR interpolator.
+   * @param[in] *S        points to an instance of the floating-point FIR interpolator structure.
+   * @param[in] *pSrc     points to the block of input data.
+   * @param[out] *pDst    points to the block of output data.
+   * @param[in] blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_interpolate_f32(
+			       const arm_fir_interpolate_instance_f32 * S,
+			        float32_t * pSrc,
+			       float32_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR interpolator.
+   * @param[in,out] *S        points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+
+  arm_status arm_fir_interpolate_init_f32(
+					  arm_fir_interpolate_instance_f32 * S,
+					  uint8_t L,
+					  uint16_t numTaps,
+					  float32_t * pCoeffs,
+					  float32_t * pState,
+					  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 rational resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint16_t phase;                /**< upsampled time of the next output past the current input sample. */
+    q15_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Processing function for the Q15 rational resampler.
+   * @param[in,out] *S        points to an instance of the Q15 rational resampler structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+
+  uint32_t arm_fir_resample_q15(
+			       arm_fir_resample_instance_q15 * S,
+			       q15_t * pSrc,
+			       q15_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 rational resampler.
+   * @param[in,out] *S        points to an instance of the Q15 rational resampler structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         downsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>, or ARM_MATH_ARGUMENT_ERROR if a factor is zero.
+   */
+
+  arm_status arm_fir_resample_init_q15(
+				      arm_fir_resample_instance_q15 * S,
+				      uint16_t L,
+				      uint16_t M,
+				      uint16_t numTaps,
+				      q15_t * pCoeffs,
+				      q15_t * pState,
+				      uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 rational resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint16_t phase;                /**< upsampled time of the next output past the current input sample. */
+    q31_t *pCoeffs;                /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 rational resampler.
+   * @param[in,out] *S        points to an instance of the Q31 rational resampler structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+
+  uint32_t arm_fir_resample_q31(
+			       arm_fir_resample_instance_q31 * S,
+			       q31_t * pSrc,
+			       q31_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 rational resampler.
+   * @param[in,out] *S        points to an instance of the Q31 rational resampler structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         downsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>, or ARM_MATH_ARGUMENT_ERROR if a factor is zero.
+   */
+
+  arm_status arm_fir_resample_init_q31(
+				      arm_fir_resample_instance_q31 * S,
+				      uint16_t L,
+				      uint16_t M,
+				      uint16_t numTaps,
+				      q31_t * pCoeffs,
+				      q31_t * pState,
+				      uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point rational resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint16_t phase;                /**< upsampled time of the next output past the current input sample. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize-1. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point rational resampler.
+   * @param[in,out] *S        points to an instance of the floating-point rational resampler structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+
+  uint32_t arm_fir_resample_f32(
+			       arm_fir_resample_instance_f32 * S,
+			       float32_t * pSrc,
+			       float32_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point rational resampler.
+   * @param[in,out] *S        points to an instance of the floating-point rational resampler structure.
+   * @param[in]     L         upsample factor.
+   * @param[in]     M         downsample factor.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the upsample factor <code>L</code>, or ARM_MATH_ARGUMENT_ERROR if a factor is zero.
+   */
+
+  arm_status arm_fir_resample_init_f32(
+				      arm_fir_resample_instance_f32 * S,
+				      uint16_t L,
+				      uint16_t M,
+				      uint16_t numTaps,
+				      float32_t * pCoeffs,
+				      float32_t * pState,
+				      uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point fractional ratio resampler.
+   */
+
+  typedef struct
+  {
+    uint16_t L;                    /**< number of polyphase branches of the coefficient bank. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint32_t step;                 /**< input samples per output sample in 8.24 format, may be updated between calls. */
+    uint32_t pos;                  /**< position of the next output past the current input sample in 8.24 format. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_fir_resample_frac_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point fractional ratio resampler.
+   * @param[in,out] *S        points to an instance of the floating-point fractional resampler structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+
+  uint32_t arm_fir_resample_frac_f32(
+				    arm_fir_resample_frac_instance_f32 * S,
+				    float32_t * pSrc,
+				    float32_t * pDst,
+				    uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point fractional ratio resampler.
+   * @param[in,out] *S        points to an instance of the floating-point fractional resampler structure.
+   * @param[in]     L         number of polyphase branches of the coefficient bank.
+   * @param[in]     numTaps   number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs  points to the filter coefficient buffer.
+   * @param[in]     *pState   points to the state buffer.
+   * @param[in]     step      input samples per output sample in 8.24 format.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of <code>L</code>, or ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>step</code> is zero.
+   */
+
+  arm_status arm_fir_resample_frac_init_f32(
+					   arm_fir_resample_frac_instance_f32 * S,
+					   uint16_t L,
+					   uint16_t numTaps,
+					   float32_t * pCoeffs,
+					   float32_t * pState,
+					   uint32_t step,
+					   uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q31 CIC decimator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;             /**< order of the filter, the number of integrators and of combs. */
+    uint8_t diffDelay;             /**< differential delay of the combs. */
+    uint16_t R;                    /**< decimation factor. */
+    uint8_t postShift;             /**< left shift normalizing the output to 1.31 format. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length numStages*(diffDelay+1). */
+  } arm_cic_decimate_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q31 CIC interpolator.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;             /**< order of the filter, the number of combs and of integrators. */
+    uint8_t diffDelay;             /**< differential delay of the combs. */
+    uint16_t R;                    /**< interpolation factor. */
+    uint8_t postShift;             /**< left shift normalizing the output to 1.31 format. */
+    q31_t *pState;                 /**< points to the state variable array. The array is of length numStages*(diffDelay+1). */
+  } arm_cic_interpolate_instance_q31;
+
+  /**
+   * @brief Processing function for the Q31 CIC decimator.
+   * @param[in,out] *S        points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_cic_decimate_q31(
+			    const arm_cic_decimate_instance_q31 * S,
+			    q31_t * pSrc,
+			    q31_t * pDst,
+			    uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 CIC decimator on 1-bit packed PDM input.
+   * @param[in,out] *S        points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     *pSrc     points to the block of packed input bits, most significant bit first.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of input bits to process per call.
+   * @return none.
+   */
+
+  void arm_cic_decimate_pdm_q31(
+				const arm_cic_decimate_instance_q31 * S,
+				uint8_t * pSrc,
+				q31_t * pDst,
+				uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 CIC decimator.
+   * @param[in,out] *S         points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     numStages  order of the filter.
+   * @param[in]     diffDelay  differential delay of the combs.
+   * @param[in]     R          decimation factor.
+   * @param[in]     inputBits  number of significant bits of the input samples, sign included.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful, ARM_MATH_LENGTH_ERROR if
+   * <code>blockSize</code> is not a multiple of <code>R</code>, or ARM_MATH_ARGUMENT_ERROR if a parameter is zero
+   * or if the output would not fit in 32 bits.
+   */
+
+  arm_status arm_cic_decimate_init_q31(
+				       arm_cic_decimate_instance_q31 * S,
+				       uint8_t numStages,
+				       uint8_t diffDelay,
+				       uint16_t R,
+				       uint8_t inputBits,
+				       q31_t * pState,
+				       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 CIC interpolator.
+   * @param[in,out] *S        points to an instance of the Q31 CIC interpolator structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data, of blockSize*R samples.
+   * @param[in]     blockSize number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_cic_interpolate_q31(
+			       const arm_cic_interpolate_instance_q31 * S,
+			       q31_t * pSrc,
+			       q31_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 CIC interpolator.
+   * @param[in,out] *S         points to an instance of the Q31 CIC interpolator structure.
+   * @param[in]     numStages  order of the filter.
+   * @param[in]     diffDelay  differential delay of the combs.
+   * @param[in]     R          interpolation factor.
+   * @param[in]     inputBits  number of significant bits of the input samples, sign included.
+   * @param[in]     *pState    points to the state buffer.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization was successful or
+   * ARM_MATH_ARGUMENT_ERROR if a parameter is zero or if the output would not fit in 32 bits.
+   */
+
+  arm_status arm_cic_interpolate_init_q31(
+					  arm_cic_interpolate_instance_q31 * S,
+					  uint8_t numStages,
+					  uint8_t diffDelay,
+					  uint16_t R,
+					  uint8_t inputBits,
+					  q31_t * pState);
+
+  /**
+   * @brief  Design of the floating-point FIR filter compensating the droop of a CIC decimator.
+   * @param[in]  numStages  order of the CIC filter.
+   * @param[in]  diffDelay  differential delay of the CIC filter.
+   * @param[in]  R          decimation factor of the CIC filter.
+   * @param[in]  cutoff     passband edge, normalized to the CIC output rate.
+   * @param[in]  numTaps    number of filter coefficients.
+   * @param[out] *pCoeffs   points to the coefficient buffer.
+   * @return none.
+   */
+
+  void arm_cic_compensation_f32(
+				uint8_t numStages,
+				uint8_t diffDelay,
+				uint16_t R,
+				float32_t cutoff,
+				uint16_t numTaps,
+				float32_t * pCoeffs);
+
+  /**
+   * @brief Instance structure for the high precision Q31 Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    q63_t *pState;           /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    q31_t *pCoeffs;          /**< points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< additional shift, in bits, applied to each output sample. */
+
+  } arm_biquad_cas_df1_32x64_ins_q31;
+
+
+  /**
+   * @param[in]  *S        points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cas_df1_32x64_q31(
+				    const arm_biquad_cas_df1_32x64_ins_q31 * S,
+				     q31_t * pSrc,
+				    q31_t * pDst,
+				    uint32_t blockSize);
+
+
+  /**
+   * @param[in,out] *S           points to an instance of the high precision Q31 Biquad cascade filter structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @param[in]     postShift    shift to be applied to the output. Varies according to the coefficients format
+   * @return        none
+   */
+
+  void arm_biquad_cas_df1_32x64_init_q31(
+					 arm_biquad_cas_df1_32x64_ins_q31 * S,
+					 uint8_t numStages,
+					 q31_t * pCoeffs,
+					 q63_t * pState,
+					 uint8_t postShift);
+
+
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_biquad_cascade_df2T_f32(
+				   const arm_biquad_cascade_df2T_instance_f32 * S,
+				    float32_t * pSrc,
+				   float32_t * pDst,
+				   uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+
+  void arm_biquad_cascade_df2T_init_f32(
+					arm_biquad_cascade_df2T_instance_f32 * S,
+					uint8_t numStages,
+					float32_t * pCoeffs,
+					float32_t * pState);
+
+  /**
+   * @brief  Copies the coefficients and the state of the floating-point FIR filter into a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point FIR filter structure, whose pointers are rebound to the copies.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @param[in] blockSize number of samples that are processed per call.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_stage_f32(
+			arm_fir_instance_f32 * S,
+			arm_ram_arena_instance * A,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Copies the coefficients and the state of the Q31 FIR filter into a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 FIR filter structure, whose pointers are rebound to the copies.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @param[in] blockSize number of samples that are processed per call.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_stage_q31(
+			arm_fir_instance_q31 * S,
+			arm_ram_arena_instance * A,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Copies the coefficients and the state of the Q15 FIR filter into a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 FIR filter structure, whose pointers are rebound to the copies.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @param[in] blockSize number of samples that are processed per call.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_stage_q15(
+			arm_fir_instance_q15 * S,
+			arm_ram_arena_instance * A,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Copies the coefficients and the state of the floating-point Biquad cascade filter into a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point Biquad cascade filter structure, whose pointers are rebound to the copies.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df1_stage_f32(
+					arm_biquad_casd_df1_inst_f32 * S,
+					arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Copies the coefficients and the state of the Q31 Biquad cascade filter into a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 Biquad cascade filter structure, whose pointers are rebound to the copies.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df1_stage_q31(
+					arm_biquad_casd_df1_inst_q31 * S,
+					arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Copies the coefficients and the state of the Q15 Biquad cascade filter into a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 Biquad cascade filter structure, whose pointers are rebound to the copies.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df1_stage_q15(
+					arm_biquad_casd_df1_inst_q15 * S,
+					arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Copies the coefficients and the state of the floating-point transposed direct form II Biquad cascade filter into a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point transposed direct form II Biquad cascade filter structure, whose pointers are rebound to the copies.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df2T_stage_f32(
+					arm_biquad_cascade_df2T_instance_f32 * S,
+					arm_ram_arena_instance * A);
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter on interleaved channels.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint8_t   numChannels;     /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the state arrays of the channels.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_multichannel_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter on interleaved channels.
+   * @param[in]  *S        points to an instance of the multichannel filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved input data.
+   * @param[out] *pDst     points to the block of interleaved output data.
+   * @param[in]  blockSize number of samples to process per channel.
+   * @return none.
+   */
+  void arm_biquad_cascade_df2T_multichannel_f32(
+						const arm_biquad_cascade_df2T_multichannel_instance_f32 * S,
+						float32_t * pSrc,
+						float32_t * pDst,
+						uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter on interleaved channels.
+   * @param[in,out] *S           points to an instance of the multichannel filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+  void arm_biquad_cascade_df2T_multichannel_init_f32(
+						     arm_biquad_cascade_df2T_multichannel_instance_f32 * S,
+						     uint8_t numStages,
+						     uint8_t numChannels,
+						     float32_t * pCoeffs,
+						     float32_t * pState);
+
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter on interleaved stereo data.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_stereo_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter on interleaved stereo data.
+   * @param[in]  *S        points to an instance of the stereo filter data structure.
+   * @param[in]  *pSrc     points to the block of interleaved stereo input data.
+   * @param[out] *pDst     points to the block of interleaved stereo output data.
+   * @param[in]  blockSize number of stereo frames to process.
+   * @return none.
+   */
+  void arm_biquad_cascade_df2T_stereo_f32(
+					  const arm_biquad_cascade_df2T_stereo_instance_f32 * S,
+					  float32_t * pSrc,
+					  float32_t * pDst,
+					  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter on interleaved stereo data.
+   * @param[in,out] *S           points to an instance of the stereo filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the filter coefficients.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+  void arm_biquad_cascade_df2T_stereo_init_f32(
+					       arm_biquad_cascade_df2T_stereo_instance_f32 * S,
+					       uint8_t numStages,
+					       float32_t * pCoeffs,
+					       float32_t * pState);
+
+  /**
+   * @brief Instance structure for the floating-point time-varying transposed direct form II Biquad cascade filter.
+   */
+
+  typedef struct
+  {
+    uint8_t   numStages;       /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages. */
+    float32_t *pCoeffs;        /**< points to the coefficients in use, reached at the end of the last block.  The array is of length 5*numStages. */
+    float32_t *pTarget;        /**< points to the coefficients reached at the end of the next block.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_df2T_tv_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point time-varying transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S        points to an instance of the time-varying filter data structure.
+   * @param[in]     *pSrc     points to the block of input data.
+   * @param[out]    *pDst     points to the block of output data.
+   * @param[in]     blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_biquad_cascade_df2T_tv_f32(
+				      const arm_biquad_cascade_df2T_tv_instance_f32 * S,
+				      float32_t * pSrc,
+				      float32_t * pDst,
+				      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point time-varying transposed direct form II Biquad cascade filter.
+   * @param[in,out] *S           points to an instance of the time-varying filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs     points to the initial filter coefficients, updated by the processing function.
+   * @param[in]     *pTarget     points to the target coefficients, receiving a copy of the initial ones.
+   * @param[in]     *pState      points to the state buffer.
+   * @return        none
+   */
+  void arm_biquad_cascade_df2T_tv_init_f32(
+					   arm_biquad_cascade_df2T_tv_instance_f32 * S,
+					   uint8_t numStages,
+					   float32_t * pCoeffs,
+					   float32_t * pTarget,
+					   float32_t * pState);
+
+  /**
+   * @brief Response types of arm_biquad_design_f32().
+   */
+
+  typedef enum
+  {
+    ARM_BIQUAD_LOWPASS = 0,    /**< 2nd order low-pass, gain ignored. */
+    ARM_BIQUAD_HIGHPASS = 1,   /**< 2nd order high-pass, gain ignored. */
+    ARM_BIQUAD_PEAKING = 2,    /**< peaking equalizer. */
+    ARM_BIQUAD_LOWSHELF = 3,   /**< low shelf, q is the shelf slope. */
+    ARM_BIQUAD_HIGHSHELF = 4   /**< high shelf, q is the shelf slope. */
+  } arm_biquad_type;
+
+  /**
+   * @brief Coefficients of a Biquad stage from its response parameters, without trigonometric or power function calls.
+   * @param[in]  type     response type.
+   * @param[in]  freq     center or cutoff frequency divided by the sample rate, 0 < freq < 0.5.
+   * @param[in]  q        quality factor, or shelf slope, above 0.
+   * @param[in]  gainDb   gain of the peaking and shelf responses in dB, -48 to 48.
+   * @param[out] *pCoeffs points to the 5 coefficients {b0, b1, b2, a1, a2} of the stage.
+   * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for a parameter out of range.
+   */
+  arm_status arm_biquad_design_f32(
+				   arm_biquad_type type,
+				   float32_t freq,
+				   float32_t q,
+				   float32_t gainDb,
+				   float32_t * pCoeffs);
+
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR lattice filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStages;                          /**< number of filter stages. */
+    q15_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
+    q15_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR lattice filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStages;                          /**< number of filter stages. */
+    q31_t *pState;                               /**< points to the state variable array. The array is of length numStages. */
+    q31_t *pCoeffs;                              /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR lattice filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numStages;                  /**< number of filter stages. */
+    float32_t *pState;                   /**< points to the state variable array. The array is of length numStages. */
+    float32_t *pCoeffs;                  /**< points to the coefficient array. The array is of length numStages. */
+  } arm_fir_lattice_instance_f32;
+
+  /**
+   * @brief Initialization function for the Q15 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages. 
+   * @param[in] *pState points to the state buffer.  The array is of length numStages. 
+   * @return none.
+   */
+
+  void arm_fir_lattice_init_q15(
+				arm_fir_lattice_instance_q15 * S,
+				uint16_t numStages,
+				q15_t * pCoeffs,
+				q15_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q15 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 FIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+  void arm_fir_lattice_q15(
+			   const arm_fir_lattice_instance_q15 * S,
+			    q15_t * pSrc,
+			   q15_t * pDst,
+			   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the Q31 FIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 FIR lattice structure.
+   * @param[in] numStages  number of filter stages.
+   * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
+   * @param[in] *pState points to the state buffer.   The array is of length numStages.
+   * @return none.
+   */
+
+  void arm_fir_lattice_init_q31(
+				arm_fir_lattice_instance_q31 * S,
+				uint16_t numStages,
+				q31_t * pCoeffs,
+				q31_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR lattice filter.
+   * @param[in]  *S        points to an instance of the Q31 FIR lattice structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_fir_lattice_q31(
+			   const arm_fir_lattice_instance_q31 * S,
+			    q31_t * pSrc,
+			   q31_t * pDst,
+			   uint32_t blockSize);
+
+/**
+ * @brief Initialization function for the floating-point FIR lattice filter.
+ * @param[in] *S points to an instance of the floating-point FIR lattice structure.
+ * @param[in] numStages  number of filter stages.
+ * @param[in] *pCoeffs points to the coefficient buffer.  The array is of length numStages.
+ * @param[in] *pState points to the state buffer.  The array is of length numStages.
+ * @return none.
+ */
+
+  void arm_fir_lattice_init_f32(
+				arm_fir_lattice_instance_f32 * S,
+				uint16_t numStages,
+				float32_t * pCoeffs,
+				float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point FIR lattice filter.
+   * @param[in]  *S        points to an instance of the floating-point FIR lattice structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_fir_lattice_f32(
+			   const arm_fir_lattice_instance_f32 * S,
+			    float32_t * pSrc,
+			   float32_t * pDst,
+			   uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    q15_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q15_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
+    q15_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    q31_t *pState;                              /**< points to the state variable array. The array is of length numStages+blockSize. */
+    q31_t *pkCoeffs;                            /**< points to the reflection coefficient array. The array is of length numStages. */
+    q31_t *pvCoeffs;                            /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point IIR lattice filter.
+   */
+  typedef struct
+  {
+    uint16_t numStages;                         /**< number of stages in the filter. */
+    float32_t *pState;                          /**< points to the state variable array. The array is of length numStages+blockSize. */
+    float32_t *pkCoeffs;                        /**< points to the reflection coefficient array. The array is of length numStages. */
+    float32_t *pvCoeffs;                        /**< points to the ladder coefficient array. The array is of length numStages+1. */
+  } arm_iir_lattice_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point IIR lattice filter.
+   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_f32(
+			   const arm_iir_lattice_instance_f32 * S,
+			    float32_t * pSrc,
+			   float32_t * pDst,
+			   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the floating-point IIR lattice filter.
+   * @param[in] *S points to an instance of the floating-point IIR lattice structure.
+   * @param[in] numStages number of stages in the filter.
+   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize-1.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_init_f32(
+				arm_iir_lattice_instance_f32 * S,
+				uint16_t numStages,
+				float32_t *pkCoeffs,
+				float32_t *pvCoeffs,
+				float32_t *pState,
+				uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_q31(
+			   const arm_iir_lattice_instance_q31 * S,
+			    q31_t * pSrc,
+			   q31_t * pDst,
+			   uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for the Q31 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q31 IIR lattice structure.
+   * @param[in] numStages number of stages in the filter.
+   * @param[in] *pkCoeffs points to the reflection coefficient buffer.  The array is of length numStages.
+   * @param[in] *pvCoeffs points to the ladder coefficient buffer.  The array is of length numStages+1.
+   * @param[in] *pState points to the state buffer.  The array is of length numStages+blockSize.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_init_q31(
+				arm_iir_lattice_instance_q31 * S,
+				uint16_t numStages,
+				q31_t *pkCoeffs,
+				q31_t *pvCoeffs,
+				q31_t *pState,
+				uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q15 IIR lattice filter.
+   * @param[in] *S points to an instance of the Q15 IIR lattice structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_iir_lattice_q15(
+			   const arm_iir_lattice_instance_q15 * S,
+			    q15_t * pSrc,
+			   q15_t * pDst,
+			   uint32_t blockSize);
+
+
+/**
+ * @brief Initialization function for the Q15 IIR lattice filter.
+ * @param[in] *S points to an instance of the fixed-point Q15 IIR lattice structure.
+ * @param[in] numStages  number of stages in the filter.
+ * @param[in] *pkCoeffs points to reflection coefficient buffer.  The array is of length numStages.
+ * @param[in] *pvCoeffs points to ladder coefficient buffer.  The array is of length numStages+1.
+ * @param[in] *pState points to state buffer.  The array is of length numStages+blockSize.
+ * @param[in] blockSize number of samples to process per call.
+ * @return none.
+ */
+
+  void arm_iir_lattice_init_q15(
+				arm_iir_lattice_instance_q15 * S,
+				uint16_t numStages,
+				q15_t *pkCoeffs,
+				q15_t *pvCoeffs,
+				q15_t *pState,
+				uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    float32_t *pState;   /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;  /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;        /**< step size that controls filter coefficient updates. */
+  } arm_lms_instance_f32;
+
+  /**
+   * @brief Processing function for floating-point LMS filter.
+   * @param[in]  *S points to an instance of the floating-point LMS filter structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[in]  *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void arm_lms_f32(
+		   const arm_lms_instance_f32 * S,
+		    float32_t * pSrc,
+		    float32_t * pRef,
+		   float32_t * pOut,
+		   float32_t * pErr,
+		   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for floating-point LMS filter.
+   * @param[in] *S points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to the coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_init_f32(
+			arm_lms_instance_f32 * S,
+			uint16_t numTaps,
+			float32_t * pCoeffs,
+			float32_t * pState,
+			float32_t mu,
+			uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q15_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+  } arm_lms_instance_q15;
+
+
+  /**
+   * @brief Initialization function for the Q15 LMS filter.
+   * @param[in] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to the coefficient buffer.
+   * @param[in] *pState points to the state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return    none.
+   */
+
+  void arm_lms_init_q15(
+			arm_lms_instance_q15 * S,
+			uint16_t numTaps,
+			q15_t * pCoeffs,
+			q15_t * pState,
+			q15_t mu,
+			uint32_t blockSize,
+			uint32_t postShift);
+
+  /**
+   * @brief Processing function for Q15 LMS filter.
+   * @param[in] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_q15(
+		   const arm_lms_instance_q15 * S,
+		    q15_t * pSrc,
+		    q15_t * pRef,
+		   q15_t * pOut,
+		   q15_t * pErr,
+		   uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the Q31 LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< number of coefficients in the filter. */
+    q31_t *pState;       /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;      /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;            /**< step size that controls filter coefficient updates. */
+    uint32_t postShift;  /**< bit shift applied to coefficients. */
+
+  } arm_lms_instance_q31;
+
+  /**
+   * @brief Processing function for Q31 LMS filter.
+   * @param[in]  *S points to an instance of the Q15 LMS filter structure.
+   * @param[in]  *pSrc points to the block of input data.
+   * @param[in]  *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in]  blockSize number of samples to process.
+   * @return     none.
+   */
+
+  void arm_lms_q31(
+		   const arm_lms_instance_q31 * S,
+		    q31_t * pSrc,
+		    q31_t * pRef,
+		   q31_t * pOut,
+		   q31_t * pErr,
+		   uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for Q31 LMS filter.
+   * @param[in] *S points to an instance of the Q31 LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void arm_lms_init_q31(
+			arm_lms_instance_q31 * S,
+			uint16_t numTaps,
+			q31_t *pCoeffs,
+			q31_t *pState,
+			q31_t mu,
+			uint32_t blockSize,
+			uint32_t postShift);
+
+  /**
+   * @brief Instance structure for the floating-point normalized LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t  numTaps;    /**< number of coefficients in the filter. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;        /**< step size that control filter coefficient updates. */
+    float32_t energy;    /**< saves previous frame energy. */
+    float32_t x0;        /**< saves previous input sample. */
+  } arm_lms_norm_instance_f32;
+
+  /**
+   * @brief Processing function for floating-point normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_f32(
+			arm_lms_norm_instance_f32 * S,
+			 float32_t * pSrc,
+			 float32_t * pRef,
+			float32_t * pOut,
+			float32_t * pErr,
+			uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for floating-point normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_init_f32(
+			     arm_lms_norm_instance_f32 * S,
+			     uint16_t numTaps,
+			     float32_t * pCoeffs,
+			     float32_t * pState,
+			     float32_t mu,
+			     uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point block normalized LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t  numTaps;    /**< number of coefficients in the filter. */
+    float32_t *pState;    /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps. */
+    float32_t mu;         /**< step size that control filter coefficient updates. */
+    float32_t energy;     /**< energy of the last numTaps input samples. */
+    float32_t x0;         /**< saves the sample leaving the energy window with the next input. */
+  } arm_lms_block_norm_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point block normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point block normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process, the length of the update block.
+   * @return none.
+   */
+
+  void arm_lms_block_norm_f32(
+			      arm_lms_block_norm_instance_f32 * S,
+			      float32_t * pSrc,
+			      float32_t * pRef,
+			      float32_t * pOut,
+			      float32_t * pErr,
+			      uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for the floating-point block normalized LMS filter.
+   * @param[in] *S points to an instance of the floating-point block normalized LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process per call.
+   * @return none.
+   */
+
+  void arm_lms_block_norm_init_f32(
+				   arm_lms_block_norm_instance_f32 * S,
+				   uint16_t numTaps,
+				   float32_t * pCoeffs,
+				   float32_t * pState,
+				   float32_t mu,
+				   uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point frequency-domain LMS filter.
+   */
+
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 Srfft;  /**< internal real FFT structure of length 2*partLen. */
+    uint16_t partLen;                  /**< length of the partitions, the number of samples per block. */
+    uint16_t numParts;                 /**< number of partitions of the filter. */
+    uint16_t fdlIndex;                 /**< slot of the delay line receiving the next block. */
+    uint16_t constrainIndex;           /**< partition constrained after the next block. */
+    float32_t mu;                      /**< step size, between 0 and 1. */
+    float32_t beta;                    /**< smoothing factor of the power of the input bins. */
+    float32_t *pCoeffs;                /**< points to the numParts spectra of the partitions of the filter. */
+    float32_t *pFdl;                   /**< points to the frequency domain delay line of numParts spectra. */
+    float32_t *pState;                 /**< points to the previous input block and the bin powers, 2*partLen+1 values. */
+    float32_t *pScratch;               /**< points to the scratch buffer of length 4*partLen. */
+  } arm_lms_fd_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point frequency-domain LMS filter.
+   * @param[in,out] *S         points to an instance of the floating-point frequency-domain LMS structure.
+   * @param[in]     *pSrc      points to the block of input data.
+   * @param[in]     *pRef      points to the block of reference data.
+   * @param[out]    *pOut      points to the block of output data.
+   * @param[out]    *pErr      points to the block of error data.
+   * @param[in]     blockSize  number of samples to process, a multiple of partLen.
+   * @return none.
+   */
+
+  void arm_lms_fd_f32(
+		      arm_lms_fd_instance_f32 * S,
+		      float32_t * pSrc,
+		      float32_t * pRef,
+		      float32_t * pOut,
+		      float32_t * pErr,
+		      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point frequency-domain LMS filter.
+   * @param[in,out] *S         points to an instance of the floating-point frequency-domain LMS structure.
+   * @param[in]     numParts   number of partitions of the filter.
+   * @param[in]     partLen    length of the partitions and of the blocks, a power of two from 16 to 2048.
+   * @param[in]     mu         step size, between 0 and 1.
+   * @param[in]     *pArena    points to the spectra arena of 4*numParts*partLen values.
+   * @param[in]     *pState    points to the state buffer of 2*partLen+1 values.
+   * @param[in]     *pScratch  points to the scratch buffer of 4*partLen values.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>partLen</code> is not a supported value or <code>numParts</code> is zero.
+   */
+
+  arm_status arm_lms_fd_init_f32(
+				 arm_lms_fd_instance_f32 * S,
+				 uint16_t numParts,
+				 uint16_t partLen,
+				 float32_t mu,
+				 float32_t * pArena,
+				 float32_t * pState,
+				 float32_t * pScratch);
+
+
+  /**
+   * @brief Instance structure for the Q31 normalized LMS filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;     /**< number of coefficients in the filter. */
+    q31_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q31_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q31_t mu;             /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;    /**< bit shift applied to coefficients. */
+    q31_t *recipTable;    /**< points to the reciprocal initial value table. */
+    q31_t energy;         /**< saves previous frame energy. */
+    q31_t x0;             /**< saves previous input sample. */
+  } arm_lms_norm_instance_q31;
+
+  /**
+   * @brief Processing function for Q31 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_q31(
+			arm_lms_norm_instance_q31 * S,
+			 q31_t * pSrc,
+			 q31_t * pRef,
+			q31_t * pOut,
+			q31_t * pErr,
+			uint32_t blockSize);
+
+  /**
+   * @brief Initialization function for Q31 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void arm_lms_norm_init_q31(
+			     arm_lms_norm_instance_q31 * S,
+			     uint16_t numTaps,
+			     q31_t * pCoeffs,
+			     q31_t * pState,
+			     q31_t mu,
+			     uint32_t blockSize,
+			     uint8_t postShift);
+
+  /**
+   * @brief Instance structure for the Q15 normalized LMS filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;    /**< Number of coefficients in the filter. */
+    q15_t *pState;        /**< points to the state variable array. The array is of length numTaps+blockSize-1. */
+    q15_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+    q15_t mu;            /**< step size that controls filter coefficient updates. */
+    uint8_t postShift;   /**< bit shift applied to coefficients. */
+    q15_t *recipTable;   /**< Points to the reciprocal initial value table. */
+    q15_t energy;        /**< saves previous frame energy. */
+    q15_t x0;            /**< saves previous input sample. */
+  } arm_lms_norm_instance_q15;
+
+  /**
+   * @brief Processing function for Q15 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] *pRef points to the block of reference data.
+   * @param[out] *pOut points to the block of output data.
+   * @param[out] *pErr points to the block of error data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_lms_norm_q15(
+			arm_lms_norm_instance_q15 * S,
+			 q15_t * pSrc,
+			 q15_t * pRef,
+			q15_t * pOut,
+			q15_t * pErr,
+			uint32_t blockSize);
+
+
+  /**
+   * @brief Initialization function for Q15 normalized LMS filter.
+   * @param[in] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in] numTaps  number of filter coefficients.
+   * @param[in] *pCoeffs points to coefficient buffer.
+   * @param[in] *pState points to state buffer.
+   * @param[in] mu step size that controls filter coefficient updates.
+   * @param[in] blockSize number of samples to process.
+   * @param[in] postShift bit shift applied to coefficients.
+   * @return none.
+   */
+
+  void arm_lms_norm_init_q15(
+			     arm_lms_norm_instance_q15 * S,
+			     uint16_t numTaps,
+			     q15_t * pCoeffs,
+			     q15_t * pState,
+			     q15_t mu,
+			     uint32_t blockSize,
+			     uint8_t postShift);
+
+  /**
+   * @brief Correlation of floating-point sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_f32(
+			  float32_t * pSrcA,
+			 uint32_t srcALen,
+			  float32_t * pSrcB,
+			 uint32_t srcBLen,
+			 float32_t * pDst);
+
+  /**
+   * @brief Correlation of Q15 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_q15(
+			  q15_t * pSrcA,
+			 uint32_t srcALen,
+			  q15_t * pSrcB,
+			 uint32_t srcBLen,
+			 q15_t * pDst);
+
+  /**
+   * @brief Correlation of Q15 sequences (fast version) for Cortex-M3 and Cortex-M4.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_fast_q15(
+			       q15_t * pSrcA,
+			      uint32_t srcALen,
+			       q15_t * pSrcB,
+			      uint32_t srcBLen,
+			      q15_t * pDst);
+
+  /**
+   * @brief Correlation of Q31 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_q31(
+			  q31_t * pSrcA,
+			 uint32_t srcALen,
+			  q31_t * pSrcB,
+			 uint32_t srcBLen,
+			 q31_t * pDst);
+
+  /**
+   * @brief Correlation of Q31 sequences (fast version) for Cortex-M3 and Cortex-M4
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_fast_q31(
+			       q31_t * pSrcA,
+			      uint32_t srcALen,
+			       q31_t * pSrcB,
+			      uint32_t srcBLen,
+			      q31_t * pDst);
+
+  /**
+   * @brief Correlation of Q7 sequences.
+   * @param[in] *pSrcA points to the first input sequence.
+   * @param[in] srcALen length of the first input sequence.
+   * @param[in] *pSrcB points to the second input sequence.
+   * @param[in] srcBLen length of the second input sequence.
+   * @param[out] *pDst points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @return none.
+   */
+
+  void arm_correlate_q7(
+			 q7_t * pSrcA,
+			uint32_t srcALen,
+			 q7_t * pSrcB,
+			uint32_t srcBLen,
+			q7_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q31_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q15_t *pState;                /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 sparse FIR filter.
+   */
+
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of coefficients in the filter. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    q7_t *pState;                 /**< points to the state buffer array. The array is of length maxDelay+blockSize-1. */
+    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    int32_t *pTapDelay;           /**< points to the array of delay values.  The array is of length numTaps. */
+  } arm_fir_sparse_instance_q7;
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter.
+   * @param[in]  *S          points to an instance of the floating-point sparse FIR structure.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data
+   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_f32(
+			  arm_fir_sparse_instance_f32 * S,
+			   float32_t * pSrc,
+			  float32_t * pDst,
+			  float32_t * pScratchIn,
+			  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the floating-point sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_f32(
+			       arm_fir_sparse_instance_f32 * S,
+			       uint16_t numTaps,
+			       float32_t * pCoeffs,
+			       float32_t * pState,
+			       int32_t * pTapDelay,
+			       uint16_t maxDelay,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 sparse FIR filter.
+   * @param[in]  *S          points to an instance of the Q31 sparse FIR structure.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data
+   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize   number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_q31(
+			  arm_fir_sparse_instance_q31 * S,
+			   q31_t * pSrc,
+			  q31_t * pDst,
+			  q31_t * pScratchIn,
+			  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q31 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_q31(
+			       arm_fir_sparse_instance_q31 * S,
+			       uint16_t numTaps,
+			       q31_t * pCoeffs,
+			       q31_t * pState,
+			       int32_t * pTapDelay,
+			       uint16_t maxDelay,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 sparse FIR filter.
+   * @param[in]  *S           points to an instance of the Q15 sparse FIR structure.
+   * @param[in]  *pSrc        points to the block of input data.
+   * @param[out] *pDst        points to the block of output data
+   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_q15(
+			  arm_fir_sparse_instance_q15 * S,
+			   q15_t * pSrc,
+			  q15_t * pDst,
+			  q15_t * pScratchIn,
+			  q31_t * pScratchOut,
+			  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q15 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_q15(
+			       arm_fir_sparse_instance_q15 * S,
+			       uint16_t numTaps,
+			       q15_t * pCoeffs,
+			       q15_t * pState,
+			       int32_t * pTapDelay,
+			       uint16_t maxDelay,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q7 sparse FIR filter.
+   * @param[in]  *S           points to an instance of the Q7 sparse FIR structure.
+   * @param[in]  *pSrc        points to the block of input data.
+   * @param[out] *pDst        points to the block of output data
+   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
+   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
+   * @param[in]  blockSize    number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_q7(
+			 arm_fir_sparse_instance_q7 * S,
+			  q7_t * pSrc,
+			 q7_t * pDst,
+			 q7_t * pScratchIn,
+			 q31_t * pScratchOut,
+			 uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 sparse FIR filter.
+   * @param[in,out] *S         points to an instance of the Q7 sparse FIR structure.
+   * @param[in]     numTaps    number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs   points to the array of filter coefficients.
+   * @param[in]     *pState    points to the state buffer.
+   * @param[in]     *pTapDelay points to the array of offset times.
+   * @param[in]     maxDelay   maximum offset time supported.
+   * @param[in]     blockSize  number of samples that will be processed per block.
+   * @return none
+   */
+
+  void arm_fir_sparse_init_q7(
+			      arm_fir_sparse_instance_q7 * S,
+			      uint16_t numTaps,
+			      q7_t * pCoeffs,
+			      q7_t * pState,
+			      int32_t *pTapDelay,
+			      uint16_t maxDelay,
+			      uint32_t blockSize);
+
+  /**
+   * @brief  Initializes the floating-point FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_create_f32(
+			arm_fir_instance_f32 * S,
+			uint16_t numTaps,
+			float32_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_create_q31(
+			arm_fir_instance_q31 * S,
+			uint16_t numTaps,
+			q31_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise the status returned by arm_fir_init_q15().
+   */
+
+  arm_status arm_fir_create_q15(
+			arm_fir_instance_q15 * S,
+			uint16_t numTaps,
+			q15_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q7 FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q7 FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_create_q7(
+			arm_fir_instance_q7 * S,
+			uint16_t numTaps,
+			q7_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point FIR decimator with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point FIR decimator structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     M decimation factor.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise the status returned by arm_fir_decimate_init_f32().
+   */
+
+  arm_status arm_fir_decimate_create_f32(
+			arm_fir_decimate_instance_f32 * S,
+			uint16_t numTaps,
+			uint8_t M,
+			float32_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point FIR interpolator with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point FIR interpolator structure.
+   * @param[in]     L upsample factor.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise the status returned by arm_fir_interpolate_init_f32().
+   */
+
+  arm_status arm_fir_interpolate_create_f32(
+			arm_fir_interpolate_instance_f32 * S,
+			uint8_t L,
+			uint16_t numTaps,
+			float32_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point FIR lattice filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point FIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_lattice_create_f32(
+			arm_fir_lattice_instance_f32 * S,
+			uint16_t numStages,
+			float32_t *pCoeffs,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point IIR lattice filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point IIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pkCoeffs points to the reflection coefficients, numStages values.
+   * @param[in]     *pvCoeffs points to the ladder coefficients, numStages+1 values.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_iir_lattice_create_f32(
+			arm_iir_lattice_instance_f32 * S,
+			uint16_t numStages,
+			float32_t *pkCoeffs,
+			float32_t *pvCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point Biquad cascade filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df1_create_f32(
+			arm_biquad_casd_df1_inst_f32 * S,
+			uint8_t numStages,
+			float32_t *pCoeffs,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point LMS filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point LMS filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     mu step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_lms_create_f32(
+			arm_lms_instance_f32 * S,
+			uint16_t numTaps,
+			float32_t *pCoeffs,
+			float32_t mu,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point normalized LMS filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point normalized LMS filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     mu step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_lms_norm_create_f32(
+			arm_lms_norm_instance_f32 * S,
+			uint16_t numTaps,
+			float32_t *pCoeffs,
+			float32_t mu,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 FIR decimator with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 FIR decimator structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     M decimation factor.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise the status returned by arm_fir_decimate_init_q31().
+   */
+
+  arm_status arm_fir_decimate_create_q31(
+			arm_fir_decimate_instance_q31 * S,
+			uint16_t numTaps,
+			uint8_t M,
+			q31_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 FIR interpolator with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 FIR interpolator structure.
+   * @param[in]     L upsample factor.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise the status returned by arm_fir_interpolate_init_q31().
+   */
+
+  arm_status arm_fir_interpolate_create_q31(
+			arm_fir_interpolate_instance_q31 * S,
+			uint8_t L,
+			uint16_t numTaps,
+			q31_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 FIR lattice filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 FIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_lattice_create_q31(
+			arm_fir_lattice_instance_q31 * S,
+			uint16_t numStages,
+			q31_t *pCoeffs,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 IIR lattice filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 IIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pkCoeffs points to the reflection coefficients, numStages values.
+   * @param[in]     *pvCoeffs points to the ladder coefficients, numStages+1 values.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_iir_lattice_create_q31(
+			arm_iir_lattice_instance_q31 * S,
+			uint16_t numStages,
+			q31_t *pkCoeffs,
+			q31_t *pvCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 Biquad cascade filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     postShift shift to be applied to the output.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df1_create_q31(
+			arm_biquad_casd_df1_inst_q31 * S,
+			uint8_t numStages,
+			q31_t *pCoeffs,
+			int8_t postShift,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 LMS filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 LMS filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     mu step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_lms_create_q31(
+			arm_lms_instance_q31 * S,
+			uint16_t numTaps,
+			q31_t *pCoeffs,
+			q31_t mu,
+			uint32_t blockSize,
+			uint32_t postShift,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 normalized LMS filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 normalized LMS filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     mu step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_lms_norm_create_q31(
+			arm_lms_norm_instance_q31 * S,
+			uint16_t numTaps,
+			q31_t *pCoeffs,
+			q31_t mu,
+			uint32_t blockSize,
+			uint8_t postShift,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 FIR decimator with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 FIR decimator structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     M decimation factor.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise the status returned by arm_fir_decimate_init_q15().
+   */
+
+  arm_status arm_fir_decimate_create_q15(
+			arm_fir_decimate_instance_q15 * S,
+			uint16_t numTaps,
+			uint8_t M,
+			q15_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 FIR interpolator with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 FIR interpolator structure.
+   * @param[in]     L upsample factor.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return ARM_MATH_LENGTH_ERROR when the arena is too small, otherwise the status returned by arm_fir_interpolate_init_q15().
+   */
+
+  arm_status arm_fir_interpolate_create_q15(
+			arm_fir_interpolate_instance_q15 * S,
+			uint8_t L,
+			uint16_t numTaps,
+			q15_t *pCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 FIR lattice filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 FIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_lattice_create_q15(
+			arm_fir_lattice_instance_q15 * S,
+			uint16_t numStages,
+			q15_t *pCoeffs,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 IIR lattice filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 IIR lattice filter structure.
+   * @param[in]     numStages number of stages in the filter.
+   * @param[in]     *pkCoeffs points to the reflection coefficients, numStages values.
+   * @param[in]     *pvCoeffs points to the ladder coefficients, numStages+1 values.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_iir_lattice_create_q15(
+			arm_iir_lattice_instance_q15 * S,
+			uint16_t numStages,
+			q15_t *pkCoeffs,
+			q15_t *pvCoeffs,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 Biquad cascade filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     postShift shift to be applied to the output.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df1_create_q15(
+			arm_biquad_casd_df1_inst_q15 * S,
+			uint8_t numStages,
+			q15_t *pCoeffs,
+			int8_t postShift,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 LMS filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 LMS filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     mu step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_lms_create_q15(
+			arm_lms_instance_q15 * S,
+			uint16_t numTaps,
+			q15_t *pCoeffs,
+			q15_t mu,
+			uint32_t blockSize,
+			uint32_t postShift,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 normalized LMS filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 normalized LMS filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     mu step size that controls filter coefficient updates.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in]     postShift bit shift applied to coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_lms_norm_create_q15(
+			arm_lms_norm_instance_q15 * S,
+			uint16_t numTaps,
+			q15_t *pCoeffs,
+			q15_t mu,
+			uint32_t blockSize,
+			uint8_t postShift,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point sparse FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point sparse FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     *pTapDelay points to the array of tap delays, numTaps values.
+   * @param[in]     maxDelay maximum tap delay.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_sparse_create_f32(
+			arm_fir_sparse_instance_f32 * S,
+			uint16_t numTaps,
+			float32_t *pCoeffs,
+			int32_t *pTapDelay,
+			uint16_t maxDelay,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 sparse FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 sparse FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     *pTapDelay points to the array of tap delays, numTaps values.
+   * @param[in]     maxDelay maximum tap delay.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_sparse_create_q31(
+			arm_fir_sparse_instance_q31 * S,
+			uint16_t numTaps,
+			q31_t *pCoeffs,
+			int32_t *pTapDelay,
+			uint16_t maxDelay,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q15 sparse FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q15 sparse FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     *pTapDelay points to the array of tap delays, numTaps values.
+   * @param[in]     maxDelay maximum tap delay.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_sparse_create_q15(
+			arm_fir_sparse_instance_q15 * S,
+			uint16_t numTaps,
+			q15_t *pCoeffs,
+			int32_t *pTapDelay,
+			uint16_t maxDelay,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q7 sparse FIR filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q7 sparse FIR filter structure.
+   * @param[in]     numTaps number of filter coefficients in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     *pTapDelay points to the array of tap delays, numTaps values.
+   * @param[in]     maxDelay maximum tap delay.
+   * @param[in]     blockSize number of samples that are processed per call.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_fir_sparse_create_q7(
+			arm_fir_sparse_instance_q7 * S,
+			uint16_t numTaps,
+			q7_t *pCoeffs,
+			int32_t *pTapDelay,
+			uint16_t maxDelay,
+			uint32_t blockSize,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the Q31 high precision Biquad cascade filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the Q31 high precision Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in]     postShift shift to be applied to the output.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cas_df1_32x64_create_q31(
+			arm_biquad_cas_df1_32x64_ins_q31 * S,
+			uint8_t numStages,
+			q31_t *pCoeffs,
+			uint8_t postShift,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief  Initializes the floating-point transposed direct form II Biquad cascade filter with its state allocated from a RAM arena.
+   * @param[in,out] *S points to an instance of the floating-point transposed direct form II Biquad cascade filter structure.
+   * @param[in]     numStages number of 2nd order stages in the filter.
+   * @param[in]     *pCoeffs points to the filter coefficients.
+   * @param[in,out] *A points to an instance of the RAM arena structure.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR when the arena is too small.
+   */
+
+  arm_status arm_biquad_cascade_df2T_create_f32(
+			arm_biquad_cascade_df2T_instance_f32 * S,
+			uint8_t numStages,
+			float32_t *pCoeffs,
+			arm_ram_arena_instance * A);
+
+  /**
+   * @brief Instance structure for the floating-point sparse FIR filter with run-length compressed taps.
+   */
+  typedef struct
+  {
+    uint16_t numRuns;             /**< number of runs of consecutive delays. */
+    uint16_t stateIndex;          /**< state buffer index.  Points to the oldest sample in the state buffer. */
+    float32_t *pState;            /**< points to the state buffer array. The array is of length maxDelay+blockSize. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps.*/
+    uint16_t maxDelay;            /**< maximum offset specified by the pTapDelay array. */
+    uint16_t maxRunLength;        /**< number of taps of the longest run. */
+    int32_t *pRunDelay;           /**< points to the array of the smallest delay of each run.  The array is of length numRuns. */
+    uint16_t *pRunLength;         /**< points to the array of the number of taps of each run.  The array is of length numRuns. */
+  } arm_fir_sparse_rl_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point sparse FIR filter with run-length compressed taps.
+   * @param[in]  *S          points to an instance of the floating-point sparse FIR run-length structure.
+   * @param[in]  *pSrc       points to the block of input data.
+   * @param[out] *pDst       points to the block of output data
+   * @param[in]  *pScratchIn points to a temporary buffer of size blockSize+maxRunLength-1.
+   * @param[in]  blockSize   number of input samples to process per call.
+   * @return none.
+   */
+
+  void arm_fir_sparse_rl_f32(
+			     arm_fir_sparse_rl_instance_f32 * S,
+			     float32_t * pSrc,
+			     float32_t * pDst,
+			     float32_t * pScratchIn,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sparse FIR filter with run-length compressed taps.
+   * @param[in,out] *S          points to an instance of the floating-point sparse FIR run-length structure.
+   * @param[in]     numTaps     number of nonzero coefficients in the filter.
+   * @param[in]     *pCoeffs    points to the array of filter coefficients, in the order of the delays.
+   * @param[in]     *pState     points to the state buffer.
+   * @param[in]     *pTapDelay  points to the array of offset times, in increasing order.
+   * @param[in]     maxDelay    maximum offset time supported.
+   * @param[out]    *pRunDelay  points to an array of numTaps words receiving the delay of each run.
+   * @param[out]    *pRunLength points to an array of numTaps halfwords receiving the length of each run.
+   * @param[in]     blockSize   number of samples that will be processed per block.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the delays
+   * are not increasing or exceed maxDelay.
+   */
+
+  arm_status arm_fir_sparse_rl_init_f32(
+					arm_fir_sparse_rl_instance_f32 * S,
+					uint16_t numTaps,
+					float32_t * pCoeffs,
+					float32_t * pState,
+					int32_t * pTapDelay,
+					uint16_t maxDelay,
+					int32_t * pRunDelay,
+					uint16_t * pRunLength,
+					uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< index of the oldest sample in the window. */
+    float32_t *pState;        /**< points to the state buffer array. The array is of length windowLen. */
+    int16_t *pIndex;          /**< points to the heap position of each sample. The array is of length 2*windowLen. */
+    int16_t *pHeap;           /**< points to the median within pIndex, heap positions running from -windowLen/2 to (windowLen-1)/2. */
+  } arm_median_filter_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< index of the oldest sample in the window. */
+    q31_t *pState;            /**< points to the state buffer array. The array is of length windowLen. */
+    int16_t *pIndex;          /**< points to the heap position of each sample. The array is of length 2*windowLen. */
+    int16_t *pHeap;           /**< points to the median within pIndex, heap positions running from -windowLen/2 to (windowLen-1)/2. */
+  } arm_median_filter_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< index of the oldest sample in the window. */
+    q15_t *pState;            /**< points to the state buffer array. The array is of length windowLen. */
+    int16_t *pIndex;          /**< points to the heap position of each sample. The array is of length 2*windowLen. */
+    int16_t *pHeap;           /**< points to the median within pIndex, heap positions running from -windowLen/2 to (windowLen-1)/2. */
+  } arm_median_filter_instance_q15;
+
+  /**
+   * @brief Processing function for the floating-point running median filter.
+   * @param[in,out] *S points to an instance of the floating-point running median filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_median_filter_f32(
+			     arm_median_filter_instance_f32 * S,
+			     float32_t * pSrc,
+			     float32_t * pDst,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point running median filter.
+   * @param[in,out] *S points to an instance of the floating-point running median filter structure.
+   * @param[in] windowLen number of samples in the window, from 1 to 32767.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @param[in] *pIndex points to the index buffer of 2*windowLen halfwords.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is out of range.
+   */
+
+  arm_status arm_median_filter_init_f32(
+					arm_median_filter_instance_f32 * S,
+					uint16_t windowLen,
+					float32_t * pState,
+					int16_t * pIndex);
+
+  /**
+   * @brief Processing function for the Q31 running median filter.
+   * @param[in,out] *S points to an instance of the Q31 running median filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_median_filter_q31(
+			     arm_median_filter_instance_q31 * S,
+			     q31_t * pSrc,
+			     q31_t * pDst,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 running median filter.
+   * @param[in,out] *S points to an instance of the Q31 running median filter structure.
+   * @param[in] windowLen number of samples in the window, from 1 to 32767.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @param[in] *pIndex points to the index buffer of 2*windowLen halfwords.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is out of range.
+   */
+
+  arm_status arm_median_filter_init_q31(
+					arm_median_filter_instance_q31 * S,
+					uint16_t windowLen,
+					q31_t * pState,
+					int16_t * pIndex);
+
+  /**
+   * @brief Processing function for the Q15 running median filter.
+   * @param[in,out] *S points to an instance of the Q15 running median filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_median_filter_q15(
+			     arm_median_filter_instance_q15 * S,
+			     q15_t * pSrc,
+			     q15_t * pDst,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 running median filter.
+   * @param[in,out] *S points to an instance of the Q15 running median filter structure.
+   * @param[in] windowLen number of samples in the window, from 1 to 32767.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @param[in] *pIndex points to the index buffer of 2*windowLen halfwords.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is out of range.
+   */
+
+  arm_status arm_median_filter_init_q15(
+					arm_median_filter_instance_q15 * S,
+					uint16_t windowLen,
+					q15_t * pState,
+					int16_t * pIndex);
+
+  /**
+   * @brief Instance structure for the floating-point moving average filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< index of the oldest sample in the window. */
+    float32_t *pState;        /**< points to the state buffer array. The array is of length windowLen. */
+    float32_t sum;            /**< running sum of the window. */
+    float32_t scale;          /**< inverse of windowLen. */
+  } arm_moving_average_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 moving average filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< index of the oldest sample in the window. */
+    q31_t *pState;            /**< points to the state buffer array. The array is of length windowLen. */
+    q63_t sum;                /**< running sum of the window. */
+  } arm_moving_average_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 moving average filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< index of the oldest sample in the window. */
+    q15_t *pState;            /**< points to the state buffer array. The array is of length windowLen. */
+    q31_t sum;                /**< running sum of the window. */
+  } arm_moving_average_instance_q15;
+
+  /**
+   * @brief Processing function for the floating-point moving average filter.
+   * @param[in,out] *S points to an instance of the floating-point moving average filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_moving_average_f32(
+			      arm_moving_average_instance_f32 * S,
+			      float32_t * pSrc,
+			      float32_t * pDst,
+			      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point moving average filter.
+   * @param[in,out] *S points to an instance of the floating-point moving average filter structure.
+   * @param[in] windowLen number of samples in the window.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @return none.
+   */
+
+  void arm_moving_average_init_f32(
+				   arm_moving_average_instance_f32 * S,
+				   uint16_t windowLen,
+				   float32_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 moving average filter.
+   * @param[in,out] *S points to an instance of the Q31 moving average filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_moving_average_q31(
+			      arm_moving_average_instance_q31 * S,
+			      q31_t * pSrc,
+			      q31_t * pDst,
+			      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 moving average filter.
+   * @param[in,out] *S points to an instance of the Q31 moving average filter structure.
+   * @param[in] windowLen number of samples in the window.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @return none.
+   */
+
+  void arm_moving_average_init_q31(
+				   arm_moving_average_instance_q31 * S,
+				   uint16_t windowLen,
+				   q31_t * pState);
+
+  /**
+   * @brief Processing function for the Q15 moving average filter.
+   * @param[in,out] *S points to an instance of the Q15 moving average filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_moving_average_q15(
+			      arm_moving_average_instance_q15 * S,
+			      q15_t * pSrc,
+			      q15_t * pDst,
+			      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 moving average filter.
+   * @param[in,out] *S points to an instance of the Q15 moving average filter structure.
+   * @param[in] windowLen number of samples in the window.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @return none.
+   */
+
+  void arm_moving_average_init_q15(
+				   arm_moving_average_instance_q15 * S,
+				   uint16_t windowLen,
+				   q15_t * pState);
+
+  /**
+   * @brief Instance structure for the floating-point moving minimum and maximum filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t minHead;         /**< front of the queue of the minimum. */
+    uint16_t minCount;        /**< number of samples in the queue of the minimum. */
+    uint16_t maxHead;         /**< front of the queue of the maximum. */
+    uint16_t maxCount;        /**< number of samples in the queue of the maximum. */
+    uint32_t time;            /**< time of the next input sample. */
+    float32_t *pState;        /**< points to the queues of the minimum and the maximum. The array is of length 2*windowLen. */
+    uint32_t *pTime;          /**< points to the times of the samples of the queues. The array is of length 2*windowLen. */
+  } arm_moving_minmax_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 moving minimum and maximum filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t minHead;         /**< front of the queue of the minimum. */
+    uint16_t minCount;        /**< number of samples in the queue of the minimum. */
+    uint16_t maxHead;         /**< front of the queue of the maximum. */
+    uint16_t maxCount;        /**< number of samples in the queue of the maximum. */
+    uint32_t time;            /**< time of the next input sample. */
+    q31_t *pState;            /**< points to the queues of the minimum and the maximum. The array is of length 2*windowLen. */
+    uint32_t *pTime;          /**< points to the times of the samples of the queues. The array is of length 2*windowLen. */
+  } arm_moving_minmax_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 moving minimum and maximum filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t minHead;         /**< front of the queue of the minimum. */
+    uint16_t minCount;        /**< number of samples in the queue of the minimum. */
+    uint16_t maxHead;         /**< front of the queue of the maximum. */
+    uint16_t maxCount;        /**< number of samples in the queue of the maximum. */
+    uint32_t time;            /**< time of the next input sample. */
+    q15_t *pState;            /**< points to the queues of the minimum and the maximum. The array is of length 2*windowLen. */
+    uint32_t *pTime;          /**< points to the times of the samples of the queues. The array is of length 2*windowLen. */
+  } arm_moving_minmax_instance_q15;
+
+  /**
+   * @brief Processing function for the floating-point moving minimum and maximum filter.
+   * @param[in,out] *S points to an instance of the floating-point moving minimum and maximum structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pMin points to the block of output minima.
+   * @param[out] *pMax points to the block of output maxima.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_moving_minmax_f32(
+			     arm_moving_minmax_instance_f32 * S,
+			     float32_t * pSrc,
+			     float32_t * pMin,
+			     float32_t * pMax,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point moving minimum and maximum filter.
+   * @param[in,out] *S points to an instance of the floating-point moving minimum and maximum structure.
+   * @param[in] windowLen number of samples in the window.
+   * @param[in] *pState points to the state buffer of 2*windowLen samples.
+   * @param[in] *pTime points to the buffer of 2*windowLen words holding the times of the samples.
+   * @return none.
+   */
+
+  void arm_moving_minmax_init_f32(
+				  arm_moving_minmax_instance_f32 * S,
+				  uint16_t windowLen,
+				  float32_t * pState,
+				  uint32_t * pTime);
+
+  /**
+   * @brief Processing function for the Q31 moving minimum and maximum filter.
+   * @param[in,out] *S points to an instance of the Q31 moving minimum and maximum structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pMin points to the block of output minima.
+   * @param[out] *pMax points to the block of output maxima.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_moving_minmax_q31(
+			     arm_moving_minmax_instance_q31 * S,
+			     q31_t * pSrc,
+			     q31_t * pMin,
+			     q31_t * pMax,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 moving minimum and maximum filter.
+   * @param[in,out] *S points to an instance of the Q31 moving minimum and maximum structure.
+   * @param[in] windowLen number of samples in the window.
+   * @param[in] *pState points to the state buffer of 2*windowLen samples.
+   * @param[in] *pTime points to the buffer of 2*windowLen words holding the times of the samples.
+   * @return none.
+   */
+
+  void arm_moving_minmax_init_q31(
+				  arm_moving_minmax_instance_q31 * S,
+				  uint16_t windowLen,
+				  q31_t * pState,
+				  uint32_t * pTime);
+
+  /**
+   * @brief Processing function for the Q15 moving minimum and maximum filter.
+   * @param[in,out] *S points to an instance of the Q15 moving minimum and maximum structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pMin points to the block of output minima.
+   * @param[out] *pMax points to the block of output maxima.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_moving_minmax_q15(
+			     arm_moving_minmax_instance_q15 * S,
+			     q15_t * pSrc,
+			     q15_t * pMin,
+			     q15_t * pMax,
+			     uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 moving minimum and maximum filter.
+   * @param[in,out] *S points to an instance of the Q15 moving minimum and maximum structure.
+   * @param[in] windowLen number of samples in the window.
+   * @param[in] *pState points to the state buffer of 2*windowLen samples.
+   * @param[in] *pTime points to the buffer of 2*windowLen words holding the times of the samples.
+   * @return none.
+   */
+
+  void arm_moving_minmax_init_q15(
+				  arm_moving_minmax_instance_q15 * S,
+				  uint16_t windowLen,
+				  q15_t * pState,
+				  uint32_t * pTime);
+
+  /**
+   * @brief Instance structure for the floating-point Hampel filter.
+   */
+  typedef struct
+  {
+    arm_median_filter_instance_f32 median; /**< running median of the window. */
+    float32_t threshold;                   /**< threshold of the deviation, in units of the MAD. */
+    float32_t *pScratch;                   /**< points to the deviations of the window. The array is of length windowLen. */
+  } arm_hampel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Hampel filter.
+   */
+  typedef struct
+  {
+    arm_median_filter_instance_q31 median; /**< running median of the window. */
+    q31_t thresholdFract;                  /**< fractional part of the threshold. */
+    int8_t thresholdShift;                 /**< number of bits to shift the threshold left. */
+    q31_t *pScratch;                       /**< points to the deviations of the window. The array is of length windowLen. */
+  } arm_hampel_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 Hampel filter.
+   */
+  typedef struct
+  {
+    arm_median_filter_instance_q15 median; /**< running median of the window. */
+    q15_t thresholdFract;                  /**< fractional part of the threshold. */
+    int8_t thresholdShift;                 /**< number of bits to shift the threshold left. */
+    q15_t *pScratch;                       /**< points to the deviations of the window. The array is of length windowLen. */
+  } arm_hampel_instance_q15;
+
+  /**
+   * @brief Processing function for the floating-point Hampel filter.
+   * @param[in,out] *S points to an instance of the floating-point Hampel filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data, delayed by (windowLen-1)/2 samples.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_hampel_f32(
+		      arm_hampel_instance_f32 * S,
+		      float32_t * pSrc,
+		      float32_t * pDst,
+		      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point Hampel filter.
+   * @param[in,out] *S points to an instance of the floating-point Hampel filter structure.
+   * @param[in] windowLen number of samples in the window, odd, from 1 to 32767.
+   * @param[in] threshold threshold of the deviation, in units of the MAD.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @param[in] *pIndex points to the index buffer of 2*windowLen halfwords.
+   * @param[in] *pScratch points to a buffer of windowLen samples.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is even or out of range.
+   */
+
+  arm_status arm_hampel_init_f32(
+				 arm_hampel_instance_f32 * S,
+				 uint16_t windowLen,
+				 float32_t threshold,
+				 float32_t * pState,
+				 int16_t * pIndex,
+				 float32_t * pScratch);
+
+  /**
+   * @brief Processing function for the Q31 Hampel filter.
+   * @param[in,out] *S points to an instance of the Q31 Hampel filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data, delayed by (windowLen-1)/2 samples.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_hampel_q31(
+		      arm_hampel_instance_q31 * S,
+		      q31_t * pSrc,
+		      q31_t * pDst,
+		      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 Hampel filter.
+   * @param[in,out] *S points to an instance of the Q31 Hampel filter structure.
+   * @param[in] windowLen number of samples in the window, odd, from 1 to 32767.
+   * @param[in] thresholdFract fractional part of the threshold.
+   * @param[in] thresholdShift number of bits to shift the threshold left.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @param[in] *pIndex points to the index buffer of 2*windowLen halfwords.
+   * @param[in] *pScratch points to a buffer of windowLen samples.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is even or out of range.
+   */
+
+  arm_status arm_hampel_init_q31(
+				 arm_hampel_instance_q31 * S,
+				 uint16_t windowLen,
+				 q31_t thresholdFract,
+				 int8_t thresholdShift,
+				 q31_t * pState,
+				 int16_t * pIndex,
+				 q31_t * pScratch);
+
+  /**
+   * @brief Processing function for the Q15 Hampel filter.
+   * @param[in,out] *S points to an instance of the Q15 Hampel filter structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[out] *pDst points to the block of output data, delayed by (windowLen-1)/2 samples.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
+
+  void arm_hampel_q15(
+		      arm_hampel_instance_q15 * S,
+		      q15_t * pSrc,
+		      q15_t * pDst,
+		      uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 Hampel filter.
+   * @param[in,out] *S points to an instance of the Q15 Hampel filter structure.
+   * @param[in] windowLen number of samples in the window, odd, from 1 to 32767.
+   * @param[in] thresholdFract fractional part of the threshold.
+   * @param[in] thresholdShift number of bits to shift the threshold left.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @param[in] *pIndex points to the index buffer of 2*windowLen halfwords.
+   * @param[in] *pScratch points to a buffer of windowLen samples.
+   * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is even or out of range.
+   */
+
+  arm_status arm_hampel_init_q15(
+				 arm_hampel_instance_q15 * S,
+				 uint16_t windowLen,
+				 q15_t thresholdFract,
+				 int8_t thresholdShift,
+				 q15_t * pState,
+				 int16_t * pIndex,
+				 q15_t * pScratch);
+
+
+  /*
+   * @brief  Floating-point sin_cos function.
+   * @param[in]  theta    input value in degrees 
+   * @param[out] *pSinVal points to the processed sine output. 
+   * @param[out] *pCosVal points to the processed cos output. 
+   * @return none.
+   */
+
+  void arm_sin_cos_f32(
+		       float32_t theta,
+		       float32_t *pSinVal,
+		       float32_t *pCcosVal);
+
+  /*
+   * @brief  Q31 sin_cos function.
+   * @param[in]  theta    scaled input value in degrees 
+   * @param[out] *pSinVal points to the processed sine output. 
+   * @param[out] *pCosVal points to the processed cosine output. 
+   * @return none.
+   */
+
+  void arm_sin_cos_q31(
+		       q31_t theta,
+		       q31_t *pSinVal,
+		       q31_t *pCosVal);
+
+  /**
+   * @brief  Maximum number of iterations of the CORDIC kernels.
+   */
+#define ARM_CORDIC_MAX_ITER    31u
+
+  /**
+   * @brief  Q31 CORDIC sine and cosine.
+   * @param[in]  theta    input value in the range [-1 0.9999] mapping to [-pi pi)
+   * @param[out] *pSinVal points to the processed sine output.
+   * @param[out] *pCosVal points to the processed cosine output.
+   * @return none.
+   */
+
+  void arm_cordic_sin_cos_q31(
+			      q31_t theta,
+			      q31_t * pSinVal,
+			      q31_t * pCosVal);
+
+  /**
+   * @brief  Q31 CORDIC sine and cosine with a given number of iterations.
+   * @param[in]  theta    input value in the range [-1 0.9999] mapping to [-pi pi)
+   * @param[in]  numIter  number of iterations, between 1 and 31
+   * @param[out] *pSinVal points to the processed sine output.
+   * @param[out] *pCosVal points to the processed cosine output.
+   * @return none.
+   */
+
+  void arm_cordic_sin_cos_fast_q31(
+				   q31_t theta,
+				   uint32_t numIter,
+				   q31_t * pSinVal,
+				   q31_t * pCosVal);
+
+  /**
+   * @brief  Q15 CORDIC sine and cosine.
+   * @param[in]  theta    input value in the range [-1 0.9999] mapping to [-pi pi)
+   * @param[out] *pSinVal points to the processed sine output.
+   * @param[out] *pCosVal points to the processed cosine output.
+   * @return none.
+   */
+
+  void arm_cordic_sin_cos_q15(
+			      q15_t theta,
+			      q15_t * pSinVal,
+			      q15_t * pCosVal);
+
+  /**
+   * @brief  Q15 CORDIC sine and cosine with a given number of iterations.
+   * @param[in]  theta    input value in the range [-1 0.9999] mapping to [-pi pi)
+   * @param[in]  numIter  number of iterations, between 1 and 31
+   * @param[out] *pSinVal points to the processed sine output.
+   * @param[out] *pCosVal points to the processed cosine output.
+   * @return none.
+   */
+
+  void arm_cordic_sin_cos_fast_q15(
+				   q15_t theta,
+				   uint32_t numIter,
+				   q15_t * pSinVal,
+				   q15_t * pCosVal);
+
+  /**
+   * @brief  Q31 CORDIC magnitude and phase.
+   * @param[in]  x        real part in 1.31 format
+   * @param[in]  y        imaginary part in 1.31 format
+   * @param[out] *pMag    points to the magnitude output, in 2.30 format.
+   * @param[out] *pPhase  points to the phase output, in the range [-1 0.9999] mapping to [-pi pi).
+   * @return none.
+   */
+
+  void arm_cordic_mag_phase_q31(
+				q31_t x,
+				q31_t y,
+				q31_t * pMag,
+				q31_t * pPhase);
+
+  /**
+   * @brief  Q31 CORDIC magnitude and phase with a given number of iterations.
+   * @param[in]  x        real part in 1.31 format
+   * @param[in]  y        imaginary part in 1.31 format
+   * @param[in]  numIter  number of iterations, between 1 and 31
+   * @param[out] *pMag    points to the magnitude output, in 2.30 format.
+   * @param[out] *pPhase  points to the phase output, in the range [-1 0.9999] mapping to [-pi pi).
+   * @return none.
+   */
+
+  void arm_cordic_mag_phase_fast_q31(
+				     q31_t x,
+				     q31_t y,
+				     uint32_t numIter,
+				     q31_t * pMag,
+				     q31_t * pPhase);
+
+  /**
+   * @brief  Q15 CORDIC magnitude and phase.
+   * @param[in]  x        real part in 1.15 format
+   * @param[in]  y        imaginary part in 1.15 format
+   * @param[out] *pMag    points to the magnitude output, in 2.14 format.
+   * @param[out] *pPhase  points to the phase output, in the range [-1 0.9999] mapping to [-pi pi).
+   * @return none.
+   */
+
+  void arm_cordic_mag_phase_q15(
+				q15_t x,
+				q15_t y,
+				q15_t * pMag,
+				q15_t * pPhase);
+
+  /**
+   * @brief  Q15 CORDIC magnitude and phase with a given number of iterations.
+   * @param[in]  x        real part in 1.15 format
+   * @param[in]  y        imaginary part in 1.15 format
+   * @param[in]  numIter  number of iterations, between 1 and 31
+   * @param[out] *pMag    points to the magnitude output, in 2.14 format.
+   * @param[out] *pPhase  points to the phase output, in the range [-1 0.9999] mapping to [-pi pi).
+   * @return none.
+   */
+
+  void arm_cordic_mag_phase_fast_q15(
+				     q15_t x,
+				     q15_t y,
+				     uint32_t numIter,
+				     q15_t * pMag,
+				     q15_t * pPhase);
+
+
+  /**
+   * @brief  Floating-point complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_f32(
+			   float32_t * pSrc,
+			  float32_t * pDst,
+			  uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_q31(
+			   q31_t * pSrc,
+			  q31_t * pDst,
+			  uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex conjugate.
+   * @param[in]  *pSrc points to the input vector
+   * @param[out]  *pDst points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_conj_q15(
+			   q15_t * pSrc,
+			  q15_t * pDst,
+			  uint32_t numSamples);
+
+
+
+  /**
+   * @brief  Floating-point complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_f32(
+				  float32_t * pSrc,
+				 float32_t * pDst,
+				 uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_q31(
+				  q31_t * pSrc,
+				 q31_t * pDst,
+				 uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex magnitude squared
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @return none.
+   */
+
+  void arm_cmplx_mag_squared_q15(
+				  q15_t * pSrc,
+				 q15_t * pDst,
+				 uint32_t numSamples);
+
+
+ /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup PID PID Motor Control
+   *
+   * A Proportional Integral Derivative (PID) controller is a generic feedback control 
+   * loop mechanism widely used in industrial control systems.
+   * A PID controller is the most commonly used type of feedback controller.
+   *
+   * This set of functions implements (PID) controllers
+   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
+   * of data and each call to the function returns a single processed value.
+   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
+   * is the input sample value. The functions return the output value.
+   *
+   * \par Algorithm:
+   * <pre>
+   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
+   *    A0 = Kp + Ki + Kd
+   *    A1 = (-Kp ) - (2 * Kd )
+   *    A2 = Kd  </pre>
+   *
+   * \par
+   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
+   * 
+   * \par 
+   * \image html PID.gif "Proportional Integral Derivative Controller" 
+   *
+   * \par
+   * The PID controller calculates an "error" value as the difference between
+   * the measured output and the reference input.
+   * The controller attempts to minimize the error by adjusting the process control inputs.  
+   * The proportional value determines the reaction to the current error, 
+   * the integral value determines the reaction based on the sum of recent errors, 
+   * and the derivative value determines the reaction based on the rate at which the error has been changing.
+   *
+   * \par Instance Structure 
+   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure. 
+   * A separate instance structure must be defined for each PID Controller. 
+   * There are separate instance structure declarations for each of the 3 supported data types. 
+   * 
+   * \par Reset Functions 
+   * There is also an associated reset function for each data type which clears the state array. 
+   *
+   * \par Initialization Functions 
+   * There is also an associated initialization function for each data type. 
+   * The initialization function performs the following operations: 
+   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
+   * - Zeros out the values in the state buffer.   
+   * 
+   * \par 
+   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function. 
+   *
+   * \par Fixed-Point Behavior 
+   * Care must be taken when using the fixed-point versions of the PID Controller functions. 
+   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered. 
+   * Refer to the function specific documentation below for usage guidelines. 
+   *
+   * \par Extended PID Controller
+   * arm_pid_ext_f32() computes the PID in positional form, with the output limits, the
+   * derivative filter and the feed-forward term that production loops add around
+   * arm_pid_f32():
+   * <pre>
+   *    d[n] = Ad * d[n-1] + Bd * (x[n] - x[n-1])
+   *    y[n] = sat(Kp * x[n] + i[n-1] + Ki * x[n] + d[n] + Kff * ff[n], outMin, outMax)
+   *    Ad = 1 - alpha
+   *    Bd = alpha * Kd  </pre>
+   * where \c x is the error, \c ff the feed-forward input, such as the set point or a
+   * measured disturbance, and \c alpha the smoothing factor of the first-order derivative
+   * filter. The integrator <code>i[n] = i[n-1] + Ki * x[n]</code> is not updated when the
+   * output is saturated and the error would drive it further into saturation, so that the
+   * loop leaves the limits without windup. arm_pid_ext_block_f32() updates an array of
+   * independent loops, such as the axes of a multi-axis controller, in one call.
+   */
+
+  /**
+   * @addtogroup PID
+   * @{
+   */
+
+  /**
+   * @brief  Process function for the floating-point PID Control.
+   * @param[in,out] *S is an instance of the floating-point PID Control structure
+   * @param[in] in input sample to process
+   * @return out processed output sample.
+   */
+
+
+  static __INLINE float32_t arm_pid_f32(
+					arm_pid_instance_f32 * S,
+					float32_t in)
+  {
+    float32_t out;
+
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
+    out = (S->A0 * in) +
+      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+   * @brief  Process function for the Q31 PID Control.
+   * @param[in,out] *S points to an instance of the Q31 PID Control structure
+   * @param[in] in input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b> 
+   * \par 
+   * The function is implemented using an internal 64-bit accumulator. 
+   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit. 
+   * Thus, if the accumulator result overflows it wraps around rather than clip. 
+   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions. 
+   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format. 
+   */
+
+  static __INLINE q31_t arm_pid_q31(
+				    arm_pid_instance_q31 * S,
+				    q31_t in)
+  {
+    q63_t acc;
+	q31_t out;
+
+    /* acc = A0 * x[n]  */
+    acc = (q63_t) S->A0 * in;
+
+    /* acc += A1 * x[n-1] */
+    acc += (q63_t) S->A1 * S->state[0];
+
+    /* acc += A2 * x[n-2]  */
+    acc += (q63_t) S->A2 * S->state[1];
+
+    /* convert output to 1.31 format to add y[n-1] */
+    out = (q31_t) (acc >> 31u);
+
+    /* out += y[n-1] */
+    out += S->state[2];
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
+
+    /* return to application */
+    return (out);
+
+  }
+
+  /**
+   * @brief  Process function for the Q15 PID Control.
+   * @param[in,out] *S points to an instance of the Q15 PID Control structure
+   * @param[in] in input sample to process
+   * @return out processed output sample.
+   *
+   * <b>Scaling and Overflow Behavior:</b> 
+   * \par 
+   * The function is implemented using a 64-bit internal accumulator. 
+   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result. 
+   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format. 
+   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved. 
+   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits. 
+   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   */
+
+  static __INLINE q15_t arm_pid_q15(
+				    arm_pid_instance_q15 * S,
+				    q15_t in)
+  {
+    q63_t acc;
+    q15_t out;
+
+    /* Implementation of PID controller */
+
+	#ifdef ARM_MATH_CM0
+
+ 	/* acc = A0 * x[n]  */
+	acc = ((q31_t) S->A0 )* in ;
+
+    #else
+				
+    /* acc = A0 * x[n]  */
+    acc = (q31_t) __SMUAD(S->A0, in);
+	
+	#endif
+
+	#ifdef ARM_MATH_CM0
+						   
+	/* acc += A1 * x[n-1] + A2 * x[n-2]  */
+	acc += (q31_t) S->A1  *  S->state[0] ;
+	acc += (q31_t) S->A2  *  S->state[1] ;
+
+	#else
+
+    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
+    acc = __SMLALD(S->A1, _SIMD32_OFFSET(S->state), acc);
+
+	#endif
+
+    /* acc += y[n-1] */
+    acc += (q31_t) S->state[2] << 15;
+
+    /* saturate the output */
+    out = (q15_t) (__SSAT((acc >> 15), 16));
+
+    /* Update state */
+    S->state[1] = S->state[0];
+    S->state[0] = in;
+    S->state[2] = out;
 
+    /* return to application */
+    return (out);
 
+  }
+  
   /**
-   * @brief  Initialization function for the Q15 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q15 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
+   * @brief  Process function for the floating-point extended PID Control.
+   * @param[in,out] *S is an instance of the floating-point extended PID Control structure
+   * @param[in] in error to process
+   * @param[in] ff feed-forward input
+   * @return out processed output sample, between <code>outMin</code> and <code>outMax</code>.
    */
 
-  void arm_fir_sparse_init_q15(
-			       arm_fir_sparse_instance_q15 * S,
-			       uint16_t numTaps,
-			       q15_t * pCoeffs,
-			       q15_t * pState,
-			       int32_t * pTapDelay,
-			       uint16_t maxDelay,
-			       uint32_t blockSize);
-
-  /**
-   * @brief Processing function for the Q7 sparse FIR filter.
-   * @param[in]  *S           points to an instance of the Q7 sparse FIR structure.
-   * @param[in]  *pSrc        points to the block of input data.
-   * @param[out] *pDst        points to the block of output data
-   * @param[in]  *pScratchIn  points to a temporary buffer of size blockSize.
-   * @param[in]  *pScratchOut points to a temporary buffer of size blockSize.
-   * @param[in]  blockSize    number of input samples to process per call.
-   * @return none.
-   */
+  static __INLINE float32_t arm_pid_ext_f32(
+					    arm_pid_ext_instance_f32 * S,
+					    float32_t in,
+					    float32_t ff)
+  {
+    float32_t iTerm, dTerm;                      /* Integrator and derivative */
+    float32_t out;
 
-  void arm_fir_sparse_q7(
-			 arm_fir_sparse_instance_q7 * S,
-			  q7_t * pSrc,
-			 q7_t * pDst,
-			 q7_t * pScratchIn,
-			 q31_t * pScratchOut,
-			 uint32_t blockSize);
+    /* d[n] = Ad * d[n-1] + Bd * (x[n] - x[n-1]) */
+    dTerm = (S->Ad * S->state[1]) + (S->Bd * (in - S->state[2]));
 
-  /**
-   * @brief  Initialization function for the Q7 sparse FIR filter.
-   * @param[in,out] *S         points to an instance of the Q7 sparse FIR structure.
-   * @param[in]     numTaps    number of nonzero coefficients in the filter.
-   * @param[in]     *pCoeffs   points to the array of filter coefficients.
-   * @param[in]     *pState    points to the state buffer.
-   * @param[in]     *pTapDelay points to the array of offset times.
-   * @param[in]     maxDelay   maximum offset time supported.
-   * @param[in]     blockSize  number of samples that will be processed per block.
-   * @return none
-   */
+    /* i[n] = i[n-1] + Ki * x[n] */
+    iTerm = S->state[0] + (S->Ki * in);
 
-  void arm_fir_sparse_init_q7(
-			      arm_fir_sparse_instance_q7 * S,
-			      uint16_t numTaps,
-			      q7_t * pCoeffs,
-			      q7_t * pState,
-			      int32_t *pTapDelay,
-			      uint16_t maxDelay,
-			      uint32_t blockSize);
+    out = (S->Kp * in) + iTerm + dTerm + (S->Kff * ff);
 
+    /* Saturate the output, and keep the integrator if it would go further into the limit */
+    if(out > S->outMax)
+    {
+      out = S->outMax;
 
-  /*
-   * @brief  Floating-point sin_cos function.
-   * @param[in]  theta    input value in degrees 
-   * @param[out] *pSinVal points to the processed sine output. 
-   * @param[out] *pCosVal points to the processed cos output. 
-   * @return none.
-   */
+      if(iTerm > S->state[0])
+      {
+        iTerm = S->state[0];
+      }
+    }
+    else if(out < S->outMin)
+    {
+      out = S->outMin;
 
-  void arm_sin_cos_f32(
-		       float32_t theta,
-		       float32_t *pSinVal,
-		       float32_t *pCcosVal);
+      if(iTerm < S->state[0])
+      {
+        iTerm = S->state[0];
+      }
+    }
 
-  /*
-   * @brief  Q31 sin_cos function.
-   * @param[in]  theta    scaled input value in degrees 
-   * @param[out] *pSinVal points to the processed sine output. 
-   * @param[out] *pCosVal points to the processed cosine output. 
-   * @return none.
-   */
+    /* Update state */
+    S->state[0] = iTerm;
+    S->state[1] = dTerm;
+    S->state[2] = in;
 
-  void arm_sin_cos_q31(
-		       q31_t theta,
-		       q31_t *pSinVal,
-		       q31_t *pCosVal);
+    /* return to application */
+    return (out);
 
+  }
 
   /**
-   * @brief  Floating-point complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @} end of PID group
    */
 
-  void arm_cmplx_conj_f32(
-			   float32_t * pSrc,
-			  float32_t * pDst,
-			  uint32_t numSamples);
-
   /**
-   * @brief  Q31 complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
-   * @return none.
+   * @ingroup groupFilters
    */
 
-  void arm_cmplx_conj_q31(
-			   q31_t * pSrc,
-			  q31_t * pDst,
-			  uint32_t numSamples);
+  /**
+   * @addtogroup BiquadCascadeDF2T
+   * @{
+   */
 
   /**
-   * @brief  Q15 complex conjugate.
-   * @param[in]  *pSrc points to the input vector
-   * @param[out]  *pDst points to the output vector
-   * @param[in]  numSamples number of complex samples in each vector
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter on short blocks.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data, which may be <code>pSrc</code>.
+   * @param[in]  blockSize number of samples to process.
    * @return none.
-   */
+   *
+   * \par
+   * arm_biquad_cascade_df2T_f32() filters the whole block through a stage before the next
+   * one, which reads the coefficients and the state of each stage once per block but passes
+   * the block through <code>pDst</code> between the stages. This function filters each
+   * sample through all the stages, with the states of up to 4 stages kept in local
+   * variables, that the compiler holds in registers, from the start to the end of the
+   * block. It is faster for the blocks of 1 to 8 samples of control loops. Filters of more
+   * than 4 stages are processed by arm_biquad_cascade_df2T_f32().
+   */
+
+  static __INLINE void arm_biquad_cascade_df2T_short_f32(
+							 const arm_biquad_cascade_df2T_instance_f32 * S,
+							 float32_t * pSrc,
+							 float32_t * pDst,
+							 uint32_t blockSize)
+  {
+    float32_t *pState = S->pState;               /*  State pointer             */
+    float32_t *pC = S->pCoeffs;                  /*  coefficient pointer       */
+    uint32_t numStages = S->numStages;           /*  number of stages          */
+    float32_t d11, d12, d21 = 0.0f, d22 = 0.0f;  /*  state variables           */
+    float32_t d31 = 0.0f, d32 = 0.0f, d41 = 0.0f, d42 = 0.0f;
+    float32_t Xn, acc;                           /*  input and output of a stage */
+    uint32_t sample = blockSize;                 /*  loop counter              */
+
+    if(numStages > 4u)
+    {
+      arm_biquad_cascade_df2T_f32(S, pSrc, pDst, blockSize);
+      return;
+    }
 
-  void arm_cmplx_conj_q15(
-			   q15_t * pSrc,
-			  q15_t * pDst,
-			  uint32_t numSamples);
+    /* Reading the state values of all the stages */
+    d11 = pState[0];
+    d12 = pState[1];
 
+    if(numStages > 1u)
+    {
+      d21 = pState[2];
+      d22 = pState[3];
+    }
 
+    if(numStages > 2u)
+    {
+      d31 = pState[4];
+      d32 = pState[5];
+    }
 
-  /**
-   * @brief  Floating-point complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
-   */
+    if(numStages > 3u)
+    {
+      d41 = pState[6];
+      d42 = pState[7];
+    }
 
-  void arm_cmplx_mag_squared_f32(
-				  float32_t * pSrc,
-				 float32_t * pDst,
-				 uint32_t numSamples);
+    while(sample > 0u)
+    {
+      /* y[n] = b0 * x[n] + d1 */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      Xn = *pSrc++;
+      acc = (pC[0] * Xn) + d11;
+      d11 = ((pC[1] * Xn) + (pC[3] * acc)) + d12;
+      d12 = (pC[2] * Xn) + (pC[4] * acc);
+
+      /* The output of a stage is the input of the next one */
+      if(numStages > 1u)
+      {
+        Xn = acc;
+        acc = (pC[5] * Xn) + d21;
+        d21 = ((pC[6] * Xn) + (pC[8] * acc)) + d22;
+        d22 = (pC[7] * Xn) + (pC[9] * acc);
+
+        if(numStages > 2u)
+        {
+          Xn = acc;
+          acc = (pC[10] * Xn) + d31;
+          d31 = ((pC[11] * Xn) + (pC[13] * acc)) + d32;
+          d32 = (pC[12] * Xn) + (pC[14] * acc);
+
+          if(numStages > 3u)
+          {
+            Xn = acc;
+            acc = (pC[15] * Xn) + d41;
+            d41 = ((pC[16] * Xn) + (pC[18] * acc)) + d42;
+            d42 = (pC[17] * Xn) + (pC[19] * acc);
+          }
+        }
+      }
+
+      *pDst++ = acc;
+
+      /* decrement the loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    pState[0] = d11;
+    pState[1] = d12;
+
+    if(numStages > 1u)
+    {
+      pState[2] = d21;
+      pState[3] = d22;
+    }
+
+    if(numStages > 2u)
+    {
+      pState[4] = d31;
+      pState[5] = d32;
+    }
+
+    if(numStages > 3u)
+    {
+      pState[6] = d41;
+      pState[7] = d42;
+    }
+  }
 
   /**
-   * @brief  Q31 complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter on one sample.
+   * @param[in]  *S        points to an instance of the filter data structure.
+   * @param[in]  in        input sample to process.
+   * @return out processed output sample.
+   *
+   * \par
+   * The sample is processed by arm_biquad_cascade_df2T_short_f32().
    */
 
-  void arm_cmplx_mag_squared_q31(
-				  q31_t * pSrc,
-				 q31_t * pDst,
-				 uint32_t numSamples);
+  static __INLINE float32_t arm_biquad_cascade_df2T_sample_f32(
+							       const arm_biquad_cascade_df2T_instance_f32 * S,
+							       float32_t in)
+  {
+    float32_t out;
+
+    arm_biquad_cascade_df2T_short_f32(S, &in, &out, 1u);
+
+    /* return to application */
+    return (out);
+  }
 
   /**
-   * @brief  Q15 complex magnitude squared
-   * @param[in]  *pSrc points to the complex input vector
-   * @param[out]  *pDst points to the real output vector
-   * @param[in]  numSamples number of complex samples in the input vector
-   * @return none.
+   * @} end of BiquadCascadeDF2T group
    */
 
-  void arm_cmplx_mag_squared_q15(
-				  q15_t * pSrc,
-				 q15_t * pDst,
-				 uint32_t numSamples);
-
+  /**
+   * @ingroup groupFilters
+   */
 
- /**
-   * @ingroup groupController
+  /**
+   * @addtogroup IIR_Lattice
+   * @{
    */
 
   /**
-   * @defgroup PID PID Motor Control
-   *
-   * A Proportional Integral Derivative (PID) controller is a generic feedback control 
-   * loop mechanism widely used in industrial control systems.
-   * A PID controller is the most commonly used type of feedback controller.
-   *
-   * This set of functions implements (PID) controllers
-   * for Q15, Q31, and floating-point data types.  The functions operate on a single sample
-   * of data and each call to the function returns a single processed value.
-   * <code>S</code> points to an instance of the PID control data structure.  <code>in</code>
-   * is the input sample value. The functions return the output value.
-   *
-   * \par Algorithm:
-   * <pre>
-   *    y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]
-   *    A0 = Kp + Ki + Kd
-   *    A1 = (-Kp ) - (2 * Kd )
-   *    A2 = Kd  </pre>
-   *
-   * \par
-   * where \c Kp is proportional constant, \c Ki is Integral constant and \c Kd is Derivative constant
-   * 
-   * \par 
-   * \image html PID.gif "Proportional Integral Derivative Controller" 
+   * @brief Processing function for the floating-point IIR lattice filter on short blocks.
+   * @param[in]  *S        points to an instance of the floating-point IIR lattice structure.
+   * @param[in]  *pSrc     points to the block of input data.
+   * @param[out] *pDst     points to the block of output data, which may be <code>pSrc</code>.
+   * @param[in]  blockSize number of samples to process.
+   * @return none.
    *
    * \par
-   * The PID controller calculates an "error" value as the difference between
-   * the measured output and the reference input.
-   * The controller attempts to minimize the error by adjusting the process control inputs.  
-   * The proportional value determines the reaction to the current error, 
-   * the integral value determines the reaction based on the sum of recent errors, 
-   * and the derivative value determines the reaction based on the rate at which the error has been changing.
-   *
-   * \par Instance Structure 
-   * The Gains A0, A1, A2 and state variables for a PID controller are stored together in an instance data structure. 
-   * A separate instance structure must be defined for each PID Controller. 
-   * There are separate instance structure declarations for each of the 3 supported data types. 
-   * 
-   * \par Reset Functions 
-   * There is also an associated reset function for each data type which clears the state array. 
-   *
-   * \par Initialization Functions 
-   * There is also an associated initialization function for each data type. 
-   * The initialization function performs the following operations: 
-   * - Initializes the Gains A0, A1, A2 from Kp,Ki, Kd gains.
-   * - Zeros out the values in the state buffer.   
-   * 
-   * \par 
-   * Instance structure cannot be placed into a const data section and it is recommended to use the initialization function. 
+   * arm_iir_lattice_f32() writes the states of all the stages to <code>pState</code> for
+   * each sample and moves them back to the start of the buffer at the end of the block.
+   * For filters of 1 to 4 stages, this function keeps the states in local variables, that
+   * the compiler holds in registers, and writes them to <code>pState[0]</code> to
+   * <code>pState[numStages - 1]</code> once, at the end of the block, where
+   * arm_iir_lattice_f32() leaves them: both functions can process the same instance. It
+   * is faster for the blocks of 1 to 8 samples of control loops. Other filters are
+   * processed by arm_iir_lattice_f32().
+   */
+
+  static __INLINE void arm_iir_lattice_short_f32(
+						 const arm_iir_lattice_instance_f32 * S,
+						 float32_t * pSrc,
+						 float32_t * pDst,
+						 uint32_t blockSize)
+  {
+    float32_t *pState = S->pState;               /* State pointer */
+    float32_t *pk = S->pkCoeffs;                 /* Reflection coefficient pointer */
+    float32_t *pv = S->pvCoeffs;                 /* Ladder coefficient pointer */
+    uint32_t numStages = S->numStages;           /* number of stages */
+    float32_t g0, g1 = 0.0f, g2 = 0.0f, g3 = 0.0f;       /* States of the stages */
+    float32_t fcurr, gnext;                      /* Temporary variables for lattice stages */
+    float32_t acc;                               /* Accumulator */
+    float32_t vLast;                             /* Last ladder coefficient */
+    uint32_t blkCnt = blockSize;                 /* Loop counter */
+
+    if((numStages == 0u) || (numStages > 4u))
+    {
+      arm_iir_lattice_f32(S, pSrc, pDst, blockSize);
+      return;
+    }
+
+    vLast = pv[numStages];
+
+    /* Reading the state values of all the stages */
+    g0 = pState[0];
+
+    if(numStages > 1u)
+    {
+      g1 = pState[1];
+    }
+
+    if(numStages > 2u)
+    {
+      g2 = pState[2];
+    }
+
+    if(numStages > 3u)
+    {
+      g3 = pState[3];
+    }
+
+    while(blkCnt > 0u)
+    {
+      /* fN(n) = x(n) */
+      fcurr = *pSrc++;
+
+      /* fm-1(n) = fm(n) - km * gm-1(n-1), gm(n) = km * fm-1(n) + gm-1(n-1) */
+      fcurr = fcurr - (pk[0] * g0);
+      acc = ((fcurr * pk[0]) + g0) * pv[0];
+
+      /* Each state moves to the previous stage, the last state is the last forward error */
+      if(numStages > 1u)
+      {
+        fcurr = fcurr - (pk[1] * g1);
+        gnext = (fcurr * pk[1]) + g1;
+        acc += gnext * pv[1];
+        g0 = gnext;
+
+        if(numStages > 2u)
+        {
+          fcurr = fcurr - (pk[2] * g2);
+          gnext = (fcurr * pk[2]) + g2;
+          acc += gnext * pv[2];
+          g1 = gnext;
+
+          if(numStages > 3u)
+          {
+            fcurr = fcurr - (pk[3] * g3);
+            gnext = (fcurr * pk[3]) + g3;
+            acc += gnext * pv[3];
+            g2 = gnext;
+            g3 = fcurr;
+          }
+          else
+          {
+            g2 = fcurr;
+          }
+        }
+        else
+        {
+          g1 = fcurr;
+        }
+      }
+      else
+      {
+        g0 = fcurr;
+      }
+
+      /* y(n) += f0(n) * vN */
+      acc += fcurr * vLast;
+
+      /* write out into pDst */
+      *pDst++ = acc;
+
+      blkCnt--;
+    }
+
+    /* Store the updated state variables at the start of the state buffer */
+    pState[0] = g0;
+
+    if(numStages > 1u)
+    {
+      pState[1] = g1;
+    }
+
+    if(numStages > 2u)
+    {
+      pState[2] = g2;
+    }
+
+    if(numStages > 3u)
+    {
+      pState[3] = g3;
+    }
+  }
+
+  /**
+   * @brief Processing function for the floating-point IIR lattice filter on one sample.
+   * @param[in]  *S        points to an instance of the floating-point IIR lattice structure.
+   * @param[in]  in        input sample to process.
+   * @return out processed output sample.
    *
-   * \par Fixed-Point Behavior 
-   * Care must be taken when using the fixed-point versions of the PID Controller functions. 
-   * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered. 
-   * Refer to the function specific documentation below for usage guidelines. 
+   * \par
+   * The sample is processed by arm_iir_lattice_short_f32().
    */
 
+  static __INLINE float32_t arm_iir_lattice_sample_f32(
+						       const arm_iir_lattice_instance_f32 * S,
+						       float32_t in)
+  {
+    float32_t out;
+
+    arm_iir_lattice_short_f32(S, &in, &out, 1u);
+
+    /* return to application */
+    return (out);
+  }
+
   /**
-   * @addtogroup PID
-   * @{
+   * @} end of IIR_Lattice group
    */
 
+
   /**
-   * @brief  Process function for the floating-point PID Control.
-   * @param[in,out] *S is an instance of the floating-point PID Control structure
-   * @param[in] in input sample to process
-   * @return out processed output sample.
+   * @brief Floating-point matrix inverse.
+   * @param[in]  *src points to the instance of the input floating-point matrix structure.
+   * @param[out] *dst points to the instance of the output floating-point matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
    */
 
+  arm_status arm_mat_inverse_f32(
+				 const arm_matrix_instance_f32 * src,
+				 arm_matrix_instance_f32 * dst);
 
-  static __INLINE float32_t arm_pid_f32(
-					arm_pid_instance_f32 * S,
-					float32_t in)
-  {
-    float32_t out;
+  /**
+   * @brief Floating-point Cholesky decomposition.
+   * @param[in]  *src points to the instance of the input symmetric positive-definite matrix structure.
+   * @param[out] *dst points to the instance of the output lower triangular matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive-definite, then the function returns ARM_MATH_SINGULAR.
+   */
 
-    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2]  */
-    out = (S->A0 * in) +
-      (S->A1 * S->state[0]) + (S->A2 * S->state[1]) + (S->state[2]);
+  arm_status arm_mat_cholesky_f32(
+				  const arm_matrix_instance_f32 * src,
+				  arm_matrix_instance_f32 * dst);
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  /**
+   * @brief Floating-point LDL^T decomposition.
+   * @param[in]  *src points to the instance of the input symmetric matrix structure.
+   * @param[out] *dst points to the instance of the output unit lower triangular matrix structure.
+   * @param[out] *pD points to the output vector of the diagonal elements of D.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of D is zero, then the function returns ARM_MATH_SINGULAR.
+   */
 
-    /* return to application */
-    return (out);
+  arm_status arm_mat_ldlt_f32(
+			      const arm_matrix_instance_f32 * src,
+			      arm_matrix_instance_f32 * dst,
+			      float32_t * pD);
 
-  }
+  /**
+   * @brief Solves a floating-point lower triangular system of equations by forward substitution.
+   * @param[in]  *pSrcL points to the instance of the lower triangular matrix structure.
+   * @param[in]  *pSrcB points to the instance of the right-hand side matrix structure.
+   * @param[out] *pDst points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of L is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+
+  arm_status arm_mat_solve_lower_triangular_f32(
+						const arm_matrix_instance_f32 * pSrcL,
+						const arm_matrix_instance_f32 * pSrcB,
+						arm_matrix_instance_f32 * pDst);
 
   /**
-   * @brief  Process function for the Q31 PID Control.
-   * @param[in,out] *S points to an instance of the Q31 PID Control structure
-   * @param[in] in input sample to process
-   * @return out processed output sample.
-   *
-   * <b>Scaling and Overflow Behavior:</b> 
-   * \par 
-   * The function is implemented using an internal 64-bit accumulator. 
-   * The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit. 
-   * Thus, if the accumulator result overflows it wraps around rather than clip. 
-   * In order to avoid overflows completely the input signal must be scaled down by 2 bits as there are four additions. 
-   * After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.32 format and then saturated to 1.31 format. 
+   * @brief Solves a floating-point upper triangular system of equations by back substitution.
+   * @param[in]  *pSrcU points to the instance of the upper triangular matrix structure.
+   * @param[in]  *pSrcB points to the instance of the right-hand side matrix structure.
+   * @param[out] *pDst points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of U is zero, then the function returns ARM_MATH_SINGULAR.
    */
 
-  static __INLINE q31_t arm_pid_q31(
-				    arm_pid_instance_q31 * S,
-				    q31_t in)
-  {
-    q63_t acc;
-	q31_t out;
+  arm_status arm_mat_solve_upper_triangular_f32(
+						const arm_matrix_instance_f32 * pSrcU,
+						const arm_matrix_instance_f32 * pSrcB,
+						arm_matrix_instance_f32 * pDst);
 
-    /* acc = A0 * x[n]  */
-    acc = (q63_t) S->A0 * in;
+  /**
+   * @brief Solves a floating-point system of equations decomposed by arm_mat_cholesky_f32().
+   * @param[in]  *pSrcL points to the instance of the lower triangular Cholesky factor structure.
+   * @param[in]  *pSrcB points to the instance of the right-hand side matrix structure.
+   * @param[out] *pDst points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of L is zero, then the function returns ARM_MATH_SINGULAR.
+   */
 
-    /* acc += A1 * x[n-1] */
-    acc += (q63_t) S->A1 * S->state[0];
+  arm_status arm_mat_cholesky_solve_f32(
+					const arm_matrix_instance_f32 * pSrcL,
+					const arm_matrix_instance_f32 * pSrcB,
+					arm_matrix_instance_f32 * pDst);
 
-    /* acc += A2 * x[n-2]  */
-    acc += (q63_t) S->A2 * S->state[1];
+  /**
+   * @brief Floating-point Householder QR decomposition.
+   * @param[in]  *pSrc points to the instance of the input m x n matrix structure, m >= n.
+   * @param[out] *pDst points to the instance of the output m x n matrix structure.
+   * @param[out] *pTau points to the output vector of the n scale factors of the reflections.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
 
-    /* convert output to 1.31 format to add y[n-1] */
-    out = (q31_t) (acc >> 31u);
+  arm_status arm_mat_qr_f32(
+			    const arm_matrix_instance_f32 * pSrc,
+			    arm_matrix_instance_f32 * pDst,
+			    float32_t * pTau);
 
-    /* out += y[n-1] */
-    out += S->state[2];
+  /**
+   * @brief Solves a floating-point least squares problem decomposed by arm_mat_qr_f32().
+   * @param[in]  *pSrcQR points to the instance of the m x n decomposition structure.
+   * @param[in]  *pTau points to the n scale factors of the reflections.
+   * @param[in]  *pSrcB points to the instance of the m x k right-hand side matrix structure.
+   * @param[out] *pDst points to the instance of the n x k solution matrix structure.
+   * @param[out] *pScratch points to a buffer of m*k samples.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the matrix is rank deficient, then the function returns ARM_MATH_SINGULAR.
+   */
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  arm_status arm_mat_qr_solve_f32(
+				  const arm_matrix_instance_f32 * pSrcQR,
+				  const float32_t * pTau,
+				  const arm_matrix_instance_f32 * pSrcB,
+				  arm_matrix_instance_f32 * pDst,
+				  float32_t * pScratch);
 
-    /* return to application */
-    return (out);
+  /**
+   * @brief Adds a row to a floating-point least squares problem by Givens rotations.
+   * @param[in,out] *pR points to the instance of the n x n upper triangular matrix structure.
+   * @param[in,out] *pZ points to the instance of the n x k rotated right-hand side matrix structure.
+   * @param[in,out] *pRow points to the n values of the new row of A, overwritten.
+   * @param[in,out] *pRhs points to the k values of the new row of B, overwritten.
+   * @param[in]     lambda forgetting factor, in (0 1], 1 to keep all the rows.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
 
-  }
+  arm_status arm_mat_qr_update_f32(
+				   arm_matrix_instance_f32 * pR,
+				   arm_matrix_instance_f32 * pZ,
+				   float32_t * pRow,
+				   float32_t * pRhs,
+				   float32_t lambda);
 
   /**
-   * @brief  Process function for the Q15 PID Control.
-   * @param[in,out] *S points to an instance of the Q15 PID Control structure
-   * @param[in] in input sample to process
-   * @return out processed output sample.
-   *
-   * <b>Scaling and Overflow Behavior:</b> 
-   * \par 
-   * The function is implemented using a 64-bit internal accumulator. 
-   * Both Gains and state variables are represented in 1.15 format and multiplications yield a 2.30 result. 
-   * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format. 
-   * There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved. 
-   * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits. 
-   * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+   * @brief Floating-point symmetric update A * P * A^T + Q.
+   * @param[in]  *pSrcA points to the instance of the m x n matrix structure A.
+   * @param[in]  *pSrcP points to the instance of the n x n symmetric matrix structure P.
+   * @param[in]  *pSrcQ points to the instance of the m x m symmetric matrix structure Q.
+   * @param[out] *pDst points to the instance of the m x m output matrix structure.
+   * @param[in]  *pScratch points to a buffer of m*n samples.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
    */
 
-  static __INLINE q15_t arm_pid_q15(
-				    arm_pid_instance_q15 * S,
-				    q15_t in)
-  {
-    q63_t acc;
-    q15_t out;
+  arm_status arm_mat_sym_update_f32(
+				    const arm_matrix_instance_f32 * pSrcA,
+				    const arm_matrix_instance_f32 * pSrcP,
+				    const arm_matrix_instance_f32 * pSrcQ,
+				    arm_matrix_instance_f32 * pDst,
+				    float32_t * pScratch);
 
-    /* Implementation of PID controller */
+  /**
+   * @brief  Floating-point sparse matrix initialization.
+   * @param[in,out] *S          points to an instance of the floating-point sparse matrix structure.
+   * @param[in]     nRows       number of rows in the matrix.
+   * @param[in]     nColumns    number of columns in the matrix.
+   * @param[in]     nnz         number of stored elements.
+   * @param[in]     *pData      points to the stored elements.
+   * @param[in]     *pColIdx    points to the column indexes of the stored elements.
+   * @param[in]     *pRowPtr    points to the nRows+1 row offsets.
+   * @return        none
+   */
 
-	#ifdef ARM_MATH_CM0
+  void arm_mat_sparse_init_f32(
+			       arm_matrix_sparse_instance_f32 * S,
+			       uint16_t nRows,
+			       uint16_t nColumns,
+			       uint32_t nnz,
+			       float32_t * pData,
+			       uint16_t * pColIdx,
+			       uint32_t * pRowPtr);
+
+  /**
+   * @brief  Q31 sparse matrix initialization.
+   * @param[in,out] *S          points to an instance of the Q31 sparse matrix structure.
+   * @param[in]     nRows       number of rows in the matrix.
+   * @param[in]     nColumns    number of columns in the matrix.
+   * @param[in]     nnz         number of stored elements.
+   * @param[in]     *pData      points to the stored elements.
+   * @param[in]     *pColIdx    points to the column indexes of the stored elements.
+   * @param[in]     *pRowPtr    points to the nRows+1 row offsets.
+   * @return        none
+   */
 
- 	/* acc = A0 * x[n]  */
-	acc = ((q31_t) S->A0 )* in ;
+  void arm_mat_sparse_init_q31(
+			       arm_matrix_sparse_instance_q31 * S,
+			       uint16_t nRows,
+			       uint16_t nColumns,
+			       uint32_t nnz,
+			       q31_t * pData,
+			       uint16_t * pColIdx,
+			       uint32_t * pRowPtr);
 
-    #else
-				
-    /* acc = A0 * x[n]  */
-    acc = (q31_t) __SMUAD(S->A0, in);
-	
-	#endif
+  /**
+   * @brief Conversion of a floating-point dense matrix to sparse storage.
+   * @param[in]  *pSrc   points to the instance of the dense matrix structure.
+   * @param[out] *pDst   points to the instance of the sparse matrix structure, with buffers of maxNnz elements.
+   * @param[in]  maxNnz  capacity of the pData and pColIdx buffers of pDst.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * ARM_MATH_ARGUMENT_ERROR if the matrix has more than maxNnz nonzero elements.
+   */
 
-	#ifdef ARM_MATH_CM0
-						   
-	/* acc += A1 * x[n-1] + A2 * x[n-2]  */
-	acc += (q31_t) S->A1  *  S->state[0] ;
-	acc += (q31_t) S->A2  *  S->state[1] ;
+  arm_status arm_mat_sparse_from_dense_f32(
+					   const arm_matrix_instance_f32 * pSrc,
+					   arm_matrix_sparse_instance_f32 * pDst,
+					   uint32_t maxNnz);
 
-	#else
+  /**
+   * @brief Conversion of a Q31 dense matrix to sparse storage.
+   * @param[in]  *pSrc   points to the instance of the dense matrix structure.
+   * @param[out] *pDst   points to the instance of the sparse matrix structure, with buffers of maxNnz elements.
+   * @param[in]  maxNnz  capacity of the pData and pColIdx buffers of pDst.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * ARM_MATH_ARGUMENT_ERROR if the matrix has more than maxNnz nonzero elements.
+   */
 
-    /* acc += A1 * x[n-1] + A2 * x[n-2]  */
-    acc = __SMLALD(S->A1, (q31_t)__SIMD32(S->state), acc);
+  arm_status arm_mat_sparse_from_dense_q31(
+					   const arm_matrix_instance_q31 * pSrc,
+					   arm_matrix_sparse_instance_q31 * pDst,
+					   uint32_t maxNnz);
 
-	#endif
+  /**
+   * @brief Floating-point sparse matrix by vector multiplication.
+   * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+   * @param[in]  *pVec   points to the input vector of numCols elements.
+   * @param[out] *pDst   points to the output vector of numRows elements.
+   * @return none.
+   */
 
-    /* acc += y[n-1] */
-    acc += (q31_t) S->state[2] << 15;
+  void arm_mat_sparse_vec_mult_f32(
+				   const arm_matrix_sparse_instance_f32 * pSrcA,
+				   const float32_t * pVec,
+				   float32_t * pDst);
 
-    /* saturate the output */
-    out = (q15_t) (__SSAT((acc >> 15), 16));
+  /**
+   * @brief Q31 sparse matrix by vector multiplication.
+   * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+   * @param[in]  *pVec   points to the input vector of numCols elements.
+   * @param[out] *pDst   points to the output vector of numRows elements.
+   * @return none.
+   */
 
-    /* Update state */
-    S->state[1] = S->state[0];
-    S->state[0] = in;
-    S->state[2] = out;
+  void arm_mat_sparse_vec_mult_q31(
+				   const arm_matrix_sparse_instance_q31 * pSrcA,
+				   const q31_t * pVec,
+				   q31_t * pDst);
 
-    /* return to application */
-    return (out);
+  /**
+   * @brief Floating-point transposed sparse matrix by vector multiplication.
+   * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+   * @param[in]  *pVec   points to the input vector of numRows elements.
+   * @param[out] *pDst   points to the output vector of numCols elements.
+   * @return none.
+   */
+
+  void arm_mat_sparse_trans_vec_mult_f32(
+					 const arm_matrix_sparse_instance_f32 * pSrcA,
+					 const float32_t * pVec,
+					 float32_t * pDst);
 
-  }
-  
   /**
-   * @} end of PID group
+   * @brief Floating-point sparse by dense matrix multiplication.
+   * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+   * @param[in]  *pSrcB  points to the instance of the dense matrix structure.
+   * @param[out] *pDst   points to the instance of the dense output matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
    */
 
+  arm_status arm_mat_sparse_mult_f32(
+				     const arm_matrix_sparse_instance_f32 * pSrcA,
+				     const arm_matrix_instance_f32 * pSrcB,
+				     arm_matrix_instance_f32 * pDst);
 
   /**
-   * @brief Floating-point matrix inverse.
-   * @param[in]  *src points to the instance of the input floating-point matrix structure.
-   * @param[out] *dst points to the instance of the output floating-point matrix structure.
+   * @brief Q31 sparse by dense matrix multiplication.
+   * @param[in]  *pSrcA  points to the instance of the sparse matrix structure.
+   * @param[in]  *pSrcB  points to the instance of the dense matrix structure.
+   * @param[out] *pDst   points to the instance of the dense output matrix structure.
    * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
-   * If the input matrix is singular (does not have an inverse), then the algorithm terminates and returns error status ARM_MATH_SINGULAR.
    */
 
-  arm_status arm_mat_inverse_f32(
-				 const arm_matrix_instance_f32 * src,
-				 arm_matrix_instance_f32 * dst);
+  arm_status arm_mat_sparse_mult_q31(
+				     const arm_matrix_sparse_instance_q31 * pSrcA,
+				     const arm_matrix_instance_q31 * pSrcB,
+				     arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Half-precision matrix by floating-point vector multiplication.
+   * @param[in]  *pSrcMat points to the instance of the half-precision matrix structure.
+   * @param[in]  *pVec    points to the floating-point vector of numCols values.
+   * @param[out] *pDst    points to the floating-point output vector of numRows values.
+   * @return none.
+   */
+
+  void arm_mat_vec_mult_f16_f32(
+				const arm_matrix_instance_f16 * pSrcMat,
+				float32_t * pVec,
+				float32_t * pDst);
 
   
  
@@ -5359,6 +11011,24 @@ extern "C"
    * \par
    * if x is outside of the table boundary, Linear interpolation returns first value of the table 
    * if x is below input range and returns last value of table if x is above range.  
+   *
+   * \par Non-uniform tables:
+   * arm_linear_interp_nu_f32() interpolates a table whose breakpoints <code>pXData</code>
+   * are not evenly spaced, such as a calibration curve that is dense where it bends.
+   * The interval of <code>x</code> is not computed but searched, starting from the
+   * interval of the previous call, kept in <code>lastIndex</code>: the search first checks
+   * that interval, then steps away from it by 1, 2, 4... breakpoints until <code>x</code>
+   * is bracketed, and ends with a bisection. An input that moves slowly, as most measured
+   * quantities do, costs one or two comparisons per call instead of the
+   * <code>log2(nValues)</code> of a binary search, and a jump across the table costs at
+   * most twice as much as a binary search. The instance is written by each call and must
+   * not be shared between inputs. Outside of the table the first or the last value is
+   * returned.
+   *
+   * \par Blocks of samples:
+   * arm_linear_interp_block_f32() and arm_linear_interp_nu_block_f32() process an array of
+   * inputs. arm_linear_interp_block_f32() uses the instance of arm_linear_interp_f32() and
+   * replaces its division per sample by a multiplication by the reciprocal of the spacing.
    */
 
   /**
@@ -5414,8 +11084,154 @@ extern "C"
 		
 	  }
 
-      /* returns output value */
-	  return (y);
+      /* returns output value */
+	  return (y);
+  }
+
+  /**
+   * @brief  Searches the interval of a non-uniform table that contains a value.
+   * @param[in] *pXData points to the increasing table of breakpoints
+   * @param[in] nValues number of breakpoints, at least 2
+   * @param[in] x value to locate, pXData[0] <= x < pXData[nValues - 1]
+   * @param[in] index interval of the previous search
+   * @return i such that pXData[i] <= x < pXData[i + 1].
+   *
+   * The search starts from the interval <code>index</code> and steps away from it by
+   * 1, 2, 4... breakpoints until <code>x</code> is bracketed, then bisects.
+   */
+
+  static __INLINE uint32_t arm_interp_hunt_f32(
+					       const float32_t * pXData,
+					       uint32_t nValues,
+					       float32_t x,
+					       uint32_t index)
+  {
+    uint32_t lo, hi, mid;                        /* Bracket of x and its middle */
+    uint32_t step = 1u;                          /* Search step */
+
+    if(index > (nValues - 2u))
+    {
+      index = nValues - 2u;
+    }
+
+    if(x >= pXData[index])
+    {
+      /* Same interval as the previous search */
+      if(x < pXData[index + 1u])
+      {
+        return (index);
+      }
+
+      /* Hunt upwards, pXData[lo] <= x */
+      lo = index + 1u;
+      hi = lo + 1u;
+
+      while((hi < (nValues - 1u)) && (x >= pXData[hi]))
+      {
+        lo = hi;
+        step <<= 1u;
+        hi = lo + step;
+      }
+
+      if(hi > (nValues - 1u))
+      {
+        hi = nValues - 1u;
+      }
+    }
+    else
+    {
+      /* Hunt downwards, x < pXData[hi] */
+      hi = index;
+
+      while((hi > step) && (x < pXData[hi - step]))
+      {
+        hi -= step;
+        step <<= 1u;
+      }
+
+      lo = (hi > step) ? (hi - step) : 0u;
+    }
+
+    /* Bisection of the bracket */
+    while((hi - lo) > 1u)
+    {
+      mid = (lo + hi) >> 1u;
+
+      if(x >= pXData[mid])
+      {
+        lo = mid;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    return (lo);
+  }
+
+  /**
+   * @brief  Locates a value in a non-uniform table, clamped to the table.
+   * @param[in] *pXData points to the increasing table of breakpoints
+   * @param[in] nValues number of breakpoints, at least 2
+   * @param[in] x value to locate
+   * @param[in,out] *pIndex interval of the previous search, updated with the result
+   * @param[out] *pFract position of x in the interval, in [0 1]
+   * @return i, the interval of x in [0 nValues - 2].
+   */
+
+  static __INLINE uint32_t arm_interp_nu_index_f32(
+						   const float32_t * pXData,
+						   uint32_t nValues,
+						   float32_t x,
+						   uint32_t * pIndex,
+						   float32_t * pFract)
+  {
+    uint32_t i;                                  /* Interval of x */
+
+    if(x <= pXData[0])
+    {
+      /* Below the table */
+      i = 0u;
+      *pFract = 0.0f;
+    }
+    else if(x >= pXData[nValues - 1u])
+    {
+      /* Above the table */
+      i = nValues - 2u;
+      *pFract = 1.0f;
+    }
+    else
+    {
+      i = arm_interp_hunt_f32(pXData, nValues, x, *pIndex);
+      *pFract = (x - pXData[i]) / (pXData[i + 1u] - pXData[i]);
+    }
+
+    *pIndex = i;
+
+    return (i);
+  }
+
+  /**
+   * @brief  Process function for the floating-point non-uniform Linear Interpolation Function.
+   * @param[in,out] *S is an instance of the floating-point non-uniform Linear Interpolation structure
+   * @param[in] x input sample to process
+   * @return y processed output sample.
+   *
+   */
+
+  static __INLINE float32_t arm_linear_interp_nu_f32(
+						     arm_linear_interp_nu_instance_f32 * S,
+						     float32_t x)
+  {
+    float32_t *pYData = S->pYData;               /* pointer to output table */
+    float32_t fract;                             /* Position of x in its interval */
+    uint32_t i;                                  /* Interval of x */
+
+    i = arm_interp_nu_index_f32(S->pXData, S->nValues, x, &S->lastIndex, &fract);
+
+    /* returns output value */
+    return (pYData[i] + fract * (pYData[i + 1u] - pYData[i]));
   }
 
    /**
@@ -5736,6 +11552,152 @@ extern "C"
   arm_status arm_sqrt_q15(
 		      q15_t in, q15_t *pOut);
 
+  /**
+   * @brief  Floating-point vector square root.
+   * @param[in] *pSrc points to the input vector.
+   * @param[out] *pDst points to the output vector.
+   * @param[in] blockSize number of samples in each vector.
+   * @return none.
+   */
+
+  void arm_vsqrt_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector exponential.
+   * @param[in] *pSrc points to the input vector.
+   * @param[out] *pDst points to the output vector.
+   * @param[in] blockSize number of samples in each vector.
+   * @return none.
+   */
+
+  void arm_vexp_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector natural logarithm.
+   * @param[in] *pSrc points to the input vector.
+   * @param[out] *pDst points to the output vector.
+   * @param[in] blockSize number of samples in each vector.
+   * @return none.
+   */
+
+  void arm_vlog_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector sine and cosine.
+   * @param[in] *pSrc points to the input vector, in radians.
+   * @param[out] *pSinDst points to the output vector of sines.
+   * @param[out] *pCosDst points to the output vector of cosines.
+   * @param[in] blockSize number of samples in each vector.
+   * @return none.
+   */
+
+  void arm_vsin_cos_f32(
+			float32_t * pSrc,
+			float32_t * pSinDst,
+			float32_t * pCosDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point vector four-quadrant arctangent.
+   * @param[in] *pSrcY points to the vector of ordinates.
+   * @param[in] *pSrcX points to the vector of abscissas.
+   * @param[out] *pDst points to the output vector of angles, in radians.
+   * @param[in] blockSize number of samples in each vector.
+   * @return none.
+   */
+
+  void arm_atan2_f32(
+			float32_t * pSrcY,
+			float32_t * pSrcX,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Q31 vector four-quadrant arctangent.
+   * @param[in] *pSrcY points to the vector of ordinates.
+   * @param[in] *pSrcX points to the vector of abscissas.
+   * @param[out] *pDst points to the output vector of angles divided by pi, in 1.31 format.
+   * @param[in] blockSize number of samples in each vector.
+   * @return none.
+   */
+
+  void arm_atan2_q31(
+			q31_t * pSrcY,
+			q31_t * pSrcX,
+			q31_t * pDst,
+			uint32_t blockSize);
+
+  /**
+   * @brief  Floating-point four-quadrant arctangent of one point, the core of arm_atan2_f32().
+   * @param[in] y ordinate.
+   * @param[in] x abscissa.
+   * @return The angle of the point, in radians, in the range [-pi, pi]; 0 for (0, 0).
+   */
+
+  static __INLINE float32_t arm_atan2_scalar_f32(
+					     float32_t y,
+					     float32_t x)
+  {
+    float32_t a, b, t, z, base;                  /* Reduced argument and polynomial */
+    uint32_t swap = 0u;                          /* Set when |y| > |x| */
+
+    /* a = min(|x|,|y|), b = max(|x|,|y|) */
+    a = (y < 0.0f) ? -y : y;
+    b = (x < 0.0f) ? -x : x;
+
+    if(a > b)
+    {
+      t = a;
+      a = b;
+      b = t;
+      swap = 1u;
+    }
+
+    if(b == 0.0f)
+    {
+      return (0.0f);
+    }
+
+    /* Reduce the argument below tan(pi/8) */
+    if(a > (b * 0.414213562373095f))
+    {
+      t = (a - b) / (a + b);
+      base = PI / 4.0f;
+    }
+    else
+    {
+      t = a / b;
+      base = 0.0f;
+    }
+
+    /* atan(t) = t + t^3 * P(t^2) */
+    z = t * t;
+    z = base + t + ((t * z) * ((((8.05374449538e-2f * z) - 1.38776856032e-1f) * z +
+                                1.99777106478e-1f) * z - 3.33329491539e-1f));
+
+    /* Restore the octant */
+    if(swap != 0u)
+    {
+      z = (PI / 2.0f) - z;
+    }
+
+    if(x < 0.0f)
+    {
+      z = PI - z;
+    }
+
+    return ((y < 0.0f) ? -z : z);
+  }
+
   /**
    * @} end of SQRT group
    */
@@ -5746,17 +11708,221 @@ extern "C"
 
 
   /**
-   * @brief floating-point Circular write function.
+   * @brief floating-point Circular write function.
+   */
+
+  static __INLINE void arm_circularWrite_f32(
+					     int32_t * circBuffer,
+					     int32_t L,
+					     uint16_t * writeOffset,
+					     int32_t bufferInc,
+					     const int32_t * src,
+					     int32_t srcInc,
+					     uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t wOffset;
+
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+      {
+	/* copy the input sample to the circular buffer */
+	circBuffer[wOffset] = *src;
+
+	/* Update the input pointer */
+	src += srcInc;
+
+	/* Circularly update wOffset.  Watch out for positive and negative value */
+	wOffset += bufferInc;
+	if(wOffset >= L)
+	  wOffset -= L;
+
+	/* Decrement the loop counter */
+	i--;
+      }
+
+    /* Update the index pointer */
+    *writeOffset = wOffset;
+  }
+
+
+
+  /**
+   * @brief floating-point Circular Read function.
+   */
+  static __INLINE void arm_circularRead_f32(
+					    int32_t * circBuffer,
+					    int32_t L,
+					    int32_t * readOffset,
+					    int32_t bufferInc,
+					    int32_t * dst,
+					    int32_t * dst_base,
+					    int32_t dst_length,
+					    int32_t dstInc,
+					    uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t rOffset;
+    int32_t *dst_end;
+
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
+    dst_end = dst_base + dst_length;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+      {
+	/* copy the sample from the circular buffer to the destination buffer */
+	*dst = circBuffer[rOffset];
+
+	/* Update the input pointer */
+	dst += dstInc;
+
+	if(dst == dst_end)
+	  {
+	    dst = dst_base;
+	  }
+
+	/* Circularly update rOffset.  Watch out for positive and negative value  */
+	rOffset += bufferInc;
+
+	if(rOffset >= L)
+	  {
+	    rOffset -= L;
+	  }
+
+	/* Decrement the loop counter */
+	i--;
+      }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
+  }
+
+  /**
+   * @brief Q15 Circular write function.
+   */
+
+  static __INLINE void arm_circularWrite_q15(
+					     q15_t * circBuffer,
+					     int32_t L,
+					     uint16_t * writeOffset,
+					     int32_t bufferInc,
+					     const q15_t * src,
+					     int32_t srcInc,
+					     uint32_t blockSize)
+  {
+    uint32_t i = 0u;
+    int32_t wOffset;
+
+    /* Copy the value of Index pointer that points
+     * to the current location where the input samples to be copied */
+    wOffset = *writeOffset;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+      {
+	/* copy the input sample to the circular buffer */
+	circBuffer[wOffset] = *src;
+
+	/* Update the input pointer */
+	src += srcInc;
+
+	/* Circularly update wOffset.  Watch out for positive and negative value */
+	wOffset += bufferInc;
+	if(wOffset >= L)
+	  wOffset -= L;
+
+	/* Decrement the loop counter */
+	i--;
+      }
+
+    /* Update the index pointer */
+    *writeOffset = wOffset;
+  }
+
+
+
+  /**
+   * @brief Q15 Circular Read function.
+   */
+  static __INLINE void arm_circularRead_q15(
+					    q15_t * circBuffer,
+					    int32_t L,
+					    int32_t * readOffset,
+					    int32_t bufferInc,
+					    q15_t * dst,
+					    q15_t * dst_base,
+					    int32_t dst_length,
+					    int32_t dstInc,
+					    uint32_t blockSize)
+  {
+    uint32_t i = 0;
+    int32_t rOffset;
+    q15_t *dst_end;
+
+    /* Copy the value of Index pointer that points
+     * to the current location from where the input samples to be read */
+    rOffset = *readOffset;
+
+    dst_end = dst_base + dst_length;
+
+    /* Loop over the blockSize */
+    i = blockSize;
+
+    while(i > 0u)
+      {
+	/* copy the sample from the circular buffer to the destination buffer */
+	*dst = circBuffer[rOffset];
+
+	/* Update the input pointer */
+	dst += dstInc;
+
+	if(dst == dst_end)
+	  {
+	    dst = dst_base;
+	  }
+
+	/* Circularly update wOffset.  Watch out for positive and negative value */
+	rOffset += bufferInc;
+
+	if(rOffset >= L)
+	  {
+	    rOffset -= L;
+	  }
+
+	/* Decrement the loop counter */
+	i--;
+      }
+
+    /* Update the index pointer */
+    *readOffset = rOffset;
+  }
+
+
+  /**
+   * @brief Q7 Circular write function.
    */
 
-  static __INLINE void arm_circularWrite_f32(
-					     int32_t * circBuffer,
-					     int32_t L,
-					     uint16_t * writeOffset,
-					     int32_t bufferInc,
-					     const int32_t * src,
-					     int32_t srcInc,
-					     uint32_t blockSize)
+  static __INLINE void arm_circularWrite_q7(
+					    q7_t * circBuffer,
+					    int32_t L,
+					    uint16_t * writeOffset,
+					    int32_t bufferInc,
+					    const q7_t * src,
+					    int32_t srcInc,
+					    uint32_t blockSize)
   {
     uint32_t i = 0u;
     int32_t wOffset;
@@ -5792,26 +11958,28 @@ extern "C"
 
 
   /**
-   * @brief floating-point Circular Read function.
+   * @brief Q7 Circular Read function.
    */
-  static __INLINE void arm_circularRead_f32(
-					    int32_t * circBuffer,
-					    int32_t L,
-					    int32_t * readOffset,
-					    int32_t bufferInc,
-					    int32_t * dst,
-					    int32_t * dst_base,
-					    int32_t dst_length,
-					    int32_t dstInc,
-					    uint32_t blockSize)
+  static __INLINE void arm_circularRead_q7(
+					   q7_t * circBuffer,
+					   int32_t L,
+					   int32_t * readOffset,
+					   int32_t bufferInc,
+					   q7_t * dst,
+					   q7_t * dst_base,
+					   int32_t dst_length,
+					   int32_t dstInc,
+					   uint32_t blockSize)
   {
-    uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    uint32_t i = 0;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5824,12 +11992,12 @@ extern "C"
 	/* Update the input pointer */
 	dst += dstInc;
 
-	if(dst == (int32_t *) dst_end)
+	if(dst == dst_end)
 	  {
 	    dst = dst_base;
 	  }
 
-	/* Circularly update rOffset.  Watch out for positive and negative value  */
+	/* Circularly update rOffset.  Watch out for positive and negative value */
 	rOffset += bufferInc;
 
 	if(rOffset >= L)
@@ -5845,427 +12013,776 @@ extern "C"
     *readOffset = rOffset;
   }
 
+
   /**
-   * @brief Q15 Circular write function.
+   * @brief  Sum of the squares of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
    */
 
-  static __INLINE void arm_circularWrite_q15(
-					     q15_t * circBuffer,
-					     int32_t L,
-					     uint16_t * writeOffset,
-					     int32_t bufferInc,
-					     const q15_t * src,
-					     int32_t srcInc,
-					     uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
+  void arm_power_q31(
+		      q31_t * pSrc,
+		     uint32_t blockSize,
+		     q63_t * pResult);
+
+  /**
+   * @brief  Sum of the squares of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_power_f32(
+		      float32_t * pSrc,
+		     uint32_t blockSize,
+		     float32_t * pResult);
+
+  /**
+   * @brief  Sum of the squares of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_power_q15(
+		      q15_t * pSrc,
+		     uint32_t blockSize,
+		     q63_t * pResult);
+
+  /**
+   * @brief  Sum of the squares of the elements of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_power_q7(
+		     q7_t * pSrc,
+		    uint32_t blockSize,
+		    q31_t * pResult);
+
+  /**
+   * @brief  Mean value of a Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_mean_q7(
+		    q7_t * pSrc,
+		   uint32_t blockSize,
+		   q7_t * pResult);
+
+  /**
+   * @brief  Mean value of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+  void arm_mean_q15(
+		     q15_t * pSrc,
+		    uint32_t blockSize,
+		    q15_t * pResult);
+
+  /**
+   * @brief  Mean value of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+  void arm_mean_q31(
+		     q31_t * pSrc,
+		    uint32_t blockSize,
+		    q31_t * pResult);
+
+  /**
+   * @brief  Mean value of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+  void arm_mean_f32(
+		     float32_t * pSrc,
+		    uint32_t blockSize,
+		    float32_t * pResult);
+
+  /**
+   * @brief  Variance of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_var_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult);
+
+  /**
+   * @brief  Variance of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_var_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q63_t * pResult);
+
+  /**
+   * @brief  Variance of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_var_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_rms_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_rms_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult);
+
+  /**
+   * @brief  Root Mean Square of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
+
+  void arm_rms_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q15_t * pResult);
+
+  /**
+   * @brief  Standard deviation of the elements of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
 
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  void arm_std_f32(
+		    float32_t * pSrc,
+		   uint32_t blockSize,
+		   float32_t * pResult);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief  Standard deviation of the elements of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
 
-    while(i > 0u)
-      {
-	/* copy the input sample to the circular buffer */
-	circBuffer[wOffset] = *src;
+  void arm_std_q31(
+		    q31_t * pSrc,
+		   uint32_t blockSize,
+		   q31_t * pResult);
 
-	/* Update the input pointer */
-	src += srcInc;
+  /**
+   * @brief  Standard deviation of the elements of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult is output value.
+   * @return none.
+   */
 
-	/* Circularly update wOffset.  Watch out for positive and negative value */
-	wOffset += bufferInc;
-	if(wOffset >= L)
-	  wOffset -= L;
+  void arm_std_q15(
+		    q15_t * pSrc,
+		   uint32_t blockSize,
+		   q15_t * pResult);
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  /**
+   * @brief Results of the floating-point single-pass statistics.
+   */
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  typedef struct
+  {
+    float32_t mean;             /**< mean value. */
+    float32_t var;              /**< variance. */
+    float32_t std;              /**< standard deviation. */
+    float32_t rms;              /**< root mean square value. */
+    float32_t min;              /**< minimum value. */
+    uint32_t minIndex;          /**< index of the first occurrence of the minimum. */
+    float32_t max;              /**< maximum value. */
+    uint32_t maxIndex;          /**< index of the first occurrence of the maximum. */
+    float32_t peakToPeak;       /**< difference of the maximum and minimum values. */
+    float32_t crestFactor;      /**< ratio of the peak value to the rms value. */
+  } arm_stats_result_f32;
 
+  /**
+   * @brief Results of the Q31 single-pass statistics.
+   */
 
+  typedef struct
+  {
+    q31_t mean;                 /**< mean value. */
+    q31_t var;                  /**< variance, saturated. */
+    q31_t std;                  /**< standard deviation. */
+    q31_t rms;                  /**< root mean square value. */
+    q31_t min;                  /**< minimum value. */
+    uint32_t minIndex;          /**< index of the first occurrence of the minimum. */
+    q31_t max;                  /**< maximum value. */
+    uint32_t maxIndex;          /**< index of the first occurrence of the maximum. */
+    q31_t peakToPeak;           /**< difference of the maximum and minimum values, saturated. */
+    q31_t crestFactor;          /**< ratio of the peak value to the rms value in 16.16 format. */
+  } arm_stats_result_q31;
 
   /**
-   * @brief Q15 Circular Read function.
+   * @brief Results of the Q15 single-pass statistics.
    */
-  static __INLINE void arm_circularRead_q15(
-					    q15_t * circBuffer,
-					    int32_t L,
-					    int32_t * readOffset,
-					    int32_t bufferInc,
-					    q15_t * dst,
-					    q15_t * dst_base,
-					    int32_t dst_length,
-					    int32_t dstInc,
-					    uint32_t blockSize)
-  {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
+  typedef struct
+  {
+    q15_t mean;                 /**< mean value. */
+    q15_t var;                  /**< variance, saturated. */
+    q15_t std;                  /**< standard deviation. */
+    q15_t rms;                  /**< root mean square value. */
+    q15_t min;                  /**< minimum value. */
+    uint32_t minIndex;          /**< index of the first occurrence of the minimum. */
+    q15_t max;                  /**< maximum value. */
+    uint32_t maxIndex;          /**< index of the first occurrence of the maximum. */
+    q15_t peakToPeak;           /**< difference of the maximum and minimum values, saturated. */
+    q31_t crestFactor;          /**< ratio of the peak value to the rms value in 16.16 format. */
+  } arm_stats_result_q15;
+
+  /**
+   * @brief  Single-pass statistics of a floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult points to the structure receiving the statistics.
+   * @return none.
+   */
 
-    dst_end = (int32_t) (dst_base + dst_length);
+  void arm_stats_all_f32(
+			  float32_t * pSrc,
+			 uint32_t blockSize,
+			 arm_stats_result_f32 * pResult);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief  Single-pass statistics of a Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult points to the structure receiving the statistics.
+   * @return none.
+   */
 
-    while(i > 0u)
-      {
-	/* copy the sample from the circular buffer to the destination buffer */
-	*dst = circBuffer[rOffset];
+  void arm_stats_all_q31(
+			  q31_t * pSrc,
+			 uint32_t blockSize,
+			 arm_stats_result_q31 * pResult);
 
-	/* Update the input pointer */
-	dst += dstInc;
+  /**
+   * @brief  Single-pass statistics of a Q15 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @param[out]  *pResult points to the structure receiving the statistics.
+   * @return none.
+   */
 
-	if(dst == (q15_t *) dst_end)
-	  {
-	    dst = dst_base;
-	  }
+  void arm_stats_all_q15(
+			  q15_t * pSrc,
+			 uint32_t blockSize,
+			 arm_stats_result_q15 * pResult);
 
-	/* Circularly update wOffset.  Watch out for positive and negative value */
-	rOffset += bufferInc;
+  /**
+   * @brief Instance structure for the floating-point running statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;           /**< number of samples of the record. */
+    float32_t mean;           /**< mean of the record. */
+    float32_t m2;             /**< sum of the squared deviations from the mean. */
+  } arm_welford_instance_f32;
 
-	if(rOffset >= L)
-	  {
-	    rOffset -= L;
-	  }
+  /**
+   * @brief Instance structure for the floating-point exponential moving statistics.
+   */
+  typedef struct
+  {
+    float32_t alpha;          /**< weight of the new sample. */
+    float32_t mean;           /**< moving mean. */
+    float32_t var;            /**< moving variance. */
+    uint32_t count;           /**< number of samples received, saturated. */
+  } arm_exp_moving_stats_instance_f32;
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  /**
+   * @brief Instance structure for the floating-point windowed statistics.
+   */
+  typedef struct
+  {
+    uint16_t windowLen;       /**< number of samples in the window. */
+    uint16_t stateIndex;      /**< index of the oldest sample in the window. */
+    uint16_t count;           /**< number of valid samples in the window. */
+    float32_t *pState;        /**< points to the state buffer array. The array is of length windowLen. */
+    float32_t shift;          /**< reference value subtracted from the samples before summation. */
+    float32_t sum;            /**< running sum of the deviations from shift. */
+    float32_t sumOfSquares;   /**< running sum of the squared deviations from shift. */
+  } arm_windowed_stats_instance_f32;
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief  Initialization function for the floating-point running statistics.
+   * @param[out] *S points to an instance of the floating-point running statistics structure.
+   * @return none.
+   */
 
+  void arm_welford_init_f32(
+			arm_welford_instance_f32 * S);
 
   /**
-   * @brief Q7 Circular write function.
+   * @brief  Adds a block of samples to the floating-point running statistics.
+   * @param[in,out] *S points to an instance of the floating-point running statistics structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
    */
 
-  static __INLINE void arm_circularWrite_q7(
-					    q7_t * circBuffer,
-					    int32_t L,
-					    uint16_t * writeOffset,
-					    int32_t bufferInc,
-					    const q7_t * src,
-					    int32_t srcInc,
-					    uint32_t blockSize)
-  {
-    uint32_t i = 0u;
-    int32_t wOffset;
-
-    /* Copy the value of Index pointer that points
-     * to the current location where the input samples to be copied */
-    wOffset = *writeOffset;
+  void arm_welford_update_f32(
+			arm_welford_instance_f32 * S,
+			float32_t * pSrc,
+			uint32_t blockSize);
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  /**
+   * @brief  Merges two floating-point running statistics.
+   * @param[in,out] *S points to the instance receiving the statistics of both records.
+   * @param[in] *pSrc points to the instance of the second record.
+   * @return none.
+   */
 
-    while(i > 0u)
-      {
-	/* copy the input sample to the circular buffer */
-	circBuffer[wOffset] = *src;
+  void arm_welford_merge_f32(
+			arm_welford_instance_f32 * S,
+			const arm_welford_instance_f32 * pSrc);
 
-	/* Update the input pointer */
-	src += srcInc;
+  /**
+   * @brief  Mean and variance of the floating-point running statistics.
+   * @param[in] *S points to an instance of the floating-point running statistics structure.
+   * @param[out] *pMean mean value returned here.
+   * @param[out] *pVar variance value returned here.
+   * @return none.
+   */
 
-	/* Circularly update wOffset.  Watch out for positive and negative value */
-	wOffset += bufferInc;
-	if(wOffset >= L)
-	  wOffset -= L;
+  void arm_welford_query_f32(
+			const arm_welford_instance_f32 * S,
+			float32_t * pMean,
+			float32_t * pVar);
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  /**
+   * @brief  Initialization function for the floating-point exponential moving statistics.
+   * @param[out] *S points to an instance of the floating-point exponential moving statistics structure.
+   * @param[in] alpha weight of the new sample, between 0 and 1.
+   * @return none.
+   */
 
-    /* Update the index pointer */
-    *writeOffset = wOffset;
-  }
+  void arm_exp_moving_stats_init_f32(
+			arm_exp_moving_stats_instance_f32 * S,
+			float32_t alpha);
 
+  /**
+   * @brief  Adds a block of samples to the floating-point exponential moving statistics.
+   * @param[in,out] *S points to an instance of the floating-point exponential moving statistics structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
 
+  void arm_exp_moving_stats_update_f32(
+			arm_exp_moving_stats_instance_f32 * S,
+			float32_t * pSrc,
+			uint32_t blockSize);
 
   /**
-   * @brief Q7 Circular Read function.
+   * @brief  Mean and variance of the floating-point exponential moving statistics.
+   * @param[in] *S points to an instance of the floating-point exponential moving statistics structure.
+   * @param[out] *pMean mean value returned here.
+   * @param[out] *pVar variance value returned here.
+   * @return none.
    */
-  static __INLINE void arm_circularRead_q7(
-					   q7_t * circBuffer,
-					   int32_t L,
-					   int32_t * readOffset,
-					   int32_t bufferInc,
-					   q7_t * dst,
-					   q7_t * dst_base,
-					   int32_t dst_length,
-					   int32_t dstInc,
-					   uint32_t blockSize)
-  {
-    uint32_t i = 0;
-    int32_t rOffset, dst_end;
 
-    /* Copy the value of Index pointer that points
-     * to the current location from where the input samples to be read */
-    rOffset = *readOffset;
+  void arm_exp_moving_stats_query_f32(
+			const arm_exp_moving_stats_instance_f32 * S,
+			float32_t * pMean,
+			float32_t * pVar);
 
-    dst_end = (int32_t) (dst_base + dst_length);
+  /**
+   * @brief  Initialization function for the floating-point windowed statistics.
+   * @param[out] *S points to an instance of the floating-point windowed statistics structure.
+   * @param[in] windowLen number of samples in the window.
+   * @param[in] *pState points to the state buffer of windowLen samples.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if windowLen is zero.
+   */
 
-    /* Loop over the blockSize */
-    i = blockSize;
+  arm_status arm_windowed_stats_init_f32(
+			arm_windowed_stats_instance_f32 * S,
+			uint16_t windowLen,
+			float32_t * pState);
 
-    while(i > 0u)
-      {
-	/* copy the sample from the circular buffer to the destination buffer */
-	*dst = circBuffer[rOffset];
+  /**
+   * @brief  Adds a block of samples to the floating-point windowed statistics.
+   * @param[in,out] *S points to an instance of the floating-point windowed statistics structure.
+   * @param[in] *pSrc points to the block of input data.
+   * @param[in] blockSize number of samples to process.
+   * @return none.
+   */
 
-	/* Update the input pointer */
-	dst += dstInc;
+  void arm_windowed_stats_update_f32(
+			arm_windowed_stats_instance_f32 * S,
+			float32_t * pSrc,
+			uint32_t blockSize);
 
-	if(dst == (q7_t *) dst_end)
-	  {
-	    dst = dst_base;
-	  }
+  /**
+   * @brief  Mean and variance of the window of the floating-point windowed statistics.
+   * @param[in] *S points to an instance of the floating-point windowed statistics structure.
+   * @param[out] *pMean mean value returned here.
+   * @param[out] *pVar variance value returned here.
+   * @return none.
+   */
 
-	/* Circularly update rOffset.  Watch out for positive and negative value */
-	rOffset += bufferInc;
+  void arm_windowed_stats_query_f32(
+			const arm_windowed_stats_instance_f32 * S,
+			float32_t * pMean,
+			float32_t * pVar);
 
-	if(rOffset >= L)
-	  {
-	    rOffset -= L;
-	  }
+  /**
+   * @brief  Histogram of a floating-point vector with arbitrary bin edges.
+   * @param[in] *pSrc points to the input vector.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] *pEdges points to the numBins+1 bin edges, in increasing order.
+   * @param[in] numBins number of bins.
+   * @param[in,out] *pCounts points to the numBins counts, incremented by the samples of each bin.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
+   */
 
-	/* Decrement the loop counter */
-	i--;
-      }
+  arm_status arm_histogram_f32(
+			float32_t * pSrc,
+			uint32_t blockSize,
+			const float32_t * pEdges,
+			uint16_t numBins,
+			uint32_t * pCounts);
 
-    /* Update the index pointer */
-    *readOffset = rOffset;
-  }
+  /**
+   * @brief  Histogram of a Q15 vector with arbitrary bin edges.
+   * @param[in] *pSrc points to the input vector.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] *pEdges points to the numBins+1 bin edges, in increasing order.
+   * @param[in] numBins number of bins.
+   * @param[in,out] *pCounts points to the numBins counts, incremented by the samples of each bin.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
+   */
 
+  arm_status arm_histogram_q15(
+			q15_t * pSrc,
+			uint32_t blockSize,
+			const q15_t * pEdges,
+			uint16_t numBins,
+			uint32_t * pCounts);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Histogram of a floating-point vector with uniform bins.
+   * @param[in] *pSrc points to the input vector.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] minVal lower edge of the first bin.
+   * @param[in] maxVal upper edge of the last bin.
+   * @param[in] numBins number of bins.
+   * @param[in,out] *pCounts points to the numBins counts, incremented by the samples of each bin.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
    */
 
-  void arm_power_q31(
-		      q31_t * pSrc,
-		     uint32_t blockSize,
-		     q63_t * pResult);
+  arm_status arm_histogram_uniform_f32(
+			float32_t * pSrc,
+			uint32_t blockSize,
+			float32_t minVal,
+			float32_t maxVal,
+			uint16_t numBins,
+			uint32_t * pCounts);
 
   /**
-   * @brief  Sum of the squares of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Histogram of a Q15 vector with uniform bins.
+   * @param[in] *pSrc points to the input vector.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] minVal lower edge of the first bin.
+   * @param[in] maxVal upper edge of the last bin.
+   * @param[in] numBins number of bins.
+   * @param[in,out] *pCounts points to the numBins counts, incremented by the samples of each bin.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
+   */
+
+  arm_status arm_histogram_uniform_q15(
+			q15_t * pSrc,
+			uint32_t blockSize,
+			q15_t minVal,
+			q15_t maxVal,
+			uint16_t numBins,
+			uint32_t * pCounts);
+
+  /**
+   * @brief  Percentile estimated from a histogram with floating-point bin edges.
+   * @param[in] *pCounts points to the numBins counts.
+   * @param[in] *pEdges points to the numBins+1 bin edges, in increasing order.
+   * @param[in] numBins number of bins.
+   * @param[in] fraction fraction of the samples below the percentile, between 0 and 1.
+   * @param[out] *pResult percentile value returned here.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
    */
 
-  void arm_power_f32(
-		      float32_t * pSrc,
-		     uint32_t blockSize,
-		     float32_t * pResult);
+  arm_status arm_histogram_percentile_f32(
+			const uint32_t * pCounts,
+			const float32_t * pEdges,
+			uint16_t numBins,
+			float32_t fraction,
+			float32_t * pResult);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Percentile estimated from a histogram with Q15 bin edges.
+   * @param[in] *pCounts points to the numBins counts.
+   * @param[in] *pEdges points to the numBins+1 bin edges, in increasing order.
+   * @param[in] numBins number of bins.
+   * @param[in] fraction fraction of the samples below the percentile, in 1.15 format.
+   * @param[out] *pResult percentile value returned here.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
    */
 
-  void arm_power_q15(
-		      q15_t * pSrc,
-		     uint32_t blockSize,
-		     q63_t * pResult);
+  arm_status arm_histogram_percentile_q15(
+			const uint32_t * pCounts,
+			const q15_t * pEdges,
+			uint16_t numBins,
+			q15_t fraction,
+			q15_t * pResult);
 
   /**
-   * @brief  Sum of the squares of the elements of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Top-K selection of a floating-point vector.
+   * @param[in] *pSrc points to the input vector.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] k number of values to select.
+   * @param[out] *pDst points to the k largest values, in decreasing order.
+   * @param[out] *pIndex points to the indices of the k largest values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
    */
 
-  void arm_power_q7(
-		     q7_t * pSrc,
-		    uint32_t blockSize,
-		    q31_t * pResult);
+  arm_status arm_topk_f32(
+			float32_t * pSrc,
+			uint32_t blockSize,
+			uint32_t k,
+			float32_t * pDst,
+			uint32_t * pIndex);
 
   /**
-   * @brief  Mean value of a Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Top-K selection of a Q15 vector.
+   * @param[in] *pSrc points to the input vector.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] k number of values to select.
+   * @param[out] *pDst points to the k largest values, in decreasing order.
+   * @param[out] *pIndex points to the indices of the k largest values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for invalid arguments.
    */
 
-  void arm_mean_q7(
-		    q7_t * pSrc,
-		   uint32_t blockSize,
-		   q7_t * pResult);
+  arm_status arm_topk_q15(
+			q15_t * pSrc,
+			uint32_t blockSize,
+			uint32_t k,
+			q15_t * pDst,
+			uint32_t * pIndex);
 
   /**
-   * @brief  Mean value of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Radix sort of a Q31 vector, in increasing order.
+   * @param[in,out] *pSrcDst points to the vector, sorted in place.
+   * @param[in] *pScratch points to a scratch buffer of blockSize values.
+   * @param[in] blockSize length of the vector.
    * @return none.
    */
-  void arm_mean_q15(
-		     q15_t * pSrc,
-		    uint32_t blockSize,
-		    q15_t * pResult);
+
+  void arm_sort_radix_q31(
+			q31_t * pSrcDst,
+			q31_t * pScratch,
+			uint32_t blockSize);
 
   /**
-   * @brief  Mean value of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Radix sort of a Q15 vector, in increasing order.
+   * @param[in,out] *pSrcDst points to the vector, sorted in place.
+   * @param[in] *pScratch points to a scratch buffer of blockSize values.
+   * @param[in] blockSize length of the vector.
    * @return none.
    */
-  void arm_mean_q31(
-		     q31_t * pSrc,
-		    uint32_t blockSize,
-		    q31_t * pResult);
+
+  void arm_sort_radix_q15(
+			q15_t * pSrcDst,
+			q15_t * pScratch,
+			uint32_t blockSize);
 
   /**
-   * @brief  Mean value of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Radix sort of a floating-point vector, in increasing order.
+   * @param[in,out] *pSrcDst points to the vector, sorted in place.
+   * @param[in] *pScratch points to a scratch buffer of blockSize values.
+   * @param[in] blockSize length of the vector.
    * @return none.
    */
-  void arm_mean_f32(
-		     float32_t * pSrc,
-		    uint32_t blockSize,
-		    float32_t * pResult);
+
+  void arm_sort_radix_f32(
+			float32_t * pSrcDst,
+			float32_t * pScratch,
+			uint32_t blockSize);
 
   /**
-   * @brief  Variance of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Bitonic sort of a short floating-point vector, in increasing order.
+   * @param[in,out] *pSrcDst points to the vector, sorted in place.
+   * @param[in] blockSize length of the vector, a power of 2 from 2 to 64.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR for an unsupported length.
    */
 
-  void arm_var_f32(
-		    float32_t * pSrc,
-		   uint32_t blockSize,
-		   float32_t * pResult);
+  arm_status arm_sort_bitonic_f32(
+			float32_t * pSrcDst,
+			uint32_t blockSize);
 
   /**
-   * @brief  Variance of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Bitonic sort of a short Q31 vector, in increasing order.
+   * @param[in,out] *pSrcDst points to the vector, sorted in place.
+   * @param[in] blockSize length of the vector, a power of 2 from 2 to 64.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR for an unsupported length.
    */
 
-  void arm_var_q31(
-		    q31_t * pSrc,
-		   uint32_t blockSize,
-		   q63_t * pResult);
+  arm_status arm_sort_bitonic_q31(
+			q31_t * pSrcDst,
+			uint32_t blockSize);
 
   /**
-   * @brief  Variance of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Bitonic sort of a short Q15 vector, in increasing order.
+   * @param[in,out] *pSrcDst points to the vector, sorted in place.
+   * @param[in] blockSize length of the vector, a power of 2 from 2 to 64.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR for an unsupported length.
    */
 
-  void arm_var_q15(
-		    q15_t * pSrc,
-		   uint32_t blockSize,
-		   q31_t * pResult);
+  arm_status arm_sort_bitonic_q15(
+			q15_t * pSrcDst,
+			uint32_t blockSize);
 
   /**
-   * @brief  Root Mean Square of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Indexes which sort a floating-point vector in increasing order.
+   * @param[in] *pSrc points to the input vector, unchanged.
+   * @param[out] *pIndex points to the blockSize indexes of the sorted values.
+   * @param[in] *pScratch points to a scratch buffer of 4*blockSize words.
+   * @param[in] blockSize length of the input vector.
    * @return none.
    */
 
-  void arm_rms_f32(
-		    float32_t * pSrc,
-		   uint32_t blockSize,
-		   float32_t * pResult);
+  void arm_argsort_f32(
+			const float32_t * pSrc,
+			uint32_t * pIndex,
+			uint32_t * pScratch,
+			uint32_t blockSize);
 
   /**
-   * @brief  Root Mean Square of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Indexes which sort a Q31 vector in increasing order.
+   * @param[in] *pSrc points to the input vector, unchanged.
+   * @param[out] *pIndex points to the blockSize indexes of the sorted values.
+   * @param[in] *pScratch points to a scratch buffer of 3*blockSize words.
+   * @param[in] blockSize length of the input vector.
    * @return none.
    */
 
-  void arm_rms_q31(
-		    q31_t * pSrc,
-		   uint32_t blockSize,
-		   q31_t * pResult);
+  void arm_argsort_q31(
+			const q31_t * pSrc,
+			uint32_t * pIndex,
+			uint32_t * pScratch,
+			uint32_t blockSize);
 
   /**
-   * @brief  Root Mean Square of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
+   * @brief  Indexes which sort a Q15 vector in increasing order.
+   * @param[in] *pSrc points to the input vector, unchanged.
+   * @param[out] *pIndex points to the blockSize indexes of the sorted values.
+   * @param[in] *pScratch points to a scratch buffer of 4*blockSize words.
+   * @param[in] blockSize length of the input vector.
    * @return none.
    */
 
-  void arm_rms_q15(
-		    q15_t * pSrc,
-		   uint32_t blockSize,
-		   q15_t * pResult);
+  void arm_argsort_q15(
+			const q15_t * pSrc,
+			uint32_t * pIndex,
+			uint32_t * pScratch,
+			uint32_t blockSize);
 
   /**
-   * @brief  Standard deviation of the elements of a floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Selection of the k-th smallest value of a floating-point vector.
+   * @param[in,out] *pSrc points to the input vector, partially reordered.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] k rank of the value to select, 0 for the minimum.
+   * @param[out] *pResult k-th smallest value.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if k is not below blockSize.
    */
 
-  void arm_std_f32(
-		    float32_t * pSrc,
-		   uint32_t blockSize,
-		   float32_t * pResult);
+  arm_status arm_select_f32(
+			float32_t * pSrc,
+			uint32_t blockSize,
+			uint32_t k,
+			float32_t * pResult);
 
   /**
-   * @brief  Standard deviation of the elements of a Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Selection of the k-th smallest value of a Q31 vector.
+   * @param[in,out] *pSrc points to the input vector, partially reordered.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] k rank of the value to select, 0 for the minimum.
+   * @param[out] *pResult k-th smallest value.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if k is not below blockSize.
    */
 
-  void arm_std_q31(
-		    q31_t * pSrc,
-		   uint32_t blockSize,
-		   q31_t * pResult);
+  arm_status arm_select_q31(
+			q31_t * pSrc,
+			uint32_t blockSize,
+			uint32_t k,
+			q31_t * pResult);
 
   /**
-   * @brief  Standard deviation of the elements of a Q15 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[in]  blockSize is the number of samples to process
-   * @param[out]  *pResult is output value.
-   * @return none.
+   * @brief  Selection of the k-th smallest value of a Q15 vector.
+   * @param[in,out] *pSrc points to the input vector, partially reordered.
+   * @param[in] blockSize length of the input vector.
+   * @param[in] k rank of the value to select, 0 for the minimum.
+   * @param[out] *pResult k-th smallest value.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if k is not below blockSize.
    */
 
-  void arm_std_q15(
-		    q15_t * pSrc,
-		   uint32_t blockSize,
-		   q15_t * pResult);
+  arm_status arm_select_q15(
+			q15_t * pSrc,
+			uint32_t blockSize,
+			uint32_t k,
+			q15_t * pResult);
 
   /**
    * @brief  Floating-point complex magnitude
@@ -6306,6 +12823,62 @@ extern "C"
 			 q15_t * pDst,
 			 uint32_t numSamples);
 
+  /**
+   * @brief Computation selected by the approximate complex magnitude functions.
+   */
+  typedef enum
+  {
+    ARM_CMPLX_MAG_EXACT = 0,   /**< square root of the squared magnitude, as arm_cmplx_mag_xxx(). */
+    ARM_CMPLX_MAG_SQUARED = 1, /**< squared magnitude, as arm_cmplx_mag_squared_xxx(). */
+    ARM_CMPLX_MAG_AMBM = 2,    /**< alpha max plus beta min, within +/-2.13% (and 1 LSB). */
+    ARM_CMPLX_MAG_NEWTON = 3   /**< one Newton step from alpha max plus beta min, within +0.03% (and 1 LSB). */
+  } arm_cmplx_mag_type;
+
+  /**
+   * @brief  Floating-point approximate complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @param[in]  type computation of the magnitude
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_f32(
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t numSamples,
+			arm_cmplx_mag_type type);
+
+  /**
+   * @brief  Q31 approximate complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @param[in]  type computation of the magnitude
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_q31(
+			q31_t * pSrc,
+			q31_t * pDst,
+			uint32_t numSamples,
+			arm_cmplx_mag_type type);
+
+  /**
+   * @brief  Q15 approximate complex magnitude
+   * @param[in]  *pSrc points to the complex input vector
+   * @param[out]  *pDst points to the real output vector
+   * @param[in]  numSamples number of complex samples in the input vector
+   * @param[in]  type computation of the magnitude
+   * @return none.
+   */
+
+  void arm_cmplx_mag_fast_q15(
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t numSamples,
+			arm_cmplx_mag_type type);
+
   /**
    * @brief  Q15 complex dot product
    * @param[in]  *pSrcA points to the first input vector
@@ -6522,49 +13095,307 @@ extern "C"
 		   uint32_t * pIndex);
 
   /**
-   * @brief  Q15 complex-by-complex multiplication
+   * @brief  Q15 complex-by-complex multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_cmplx_q15(
+			        q15_t * pSrcA,
+			        q15_t * pSrcB,
+			       q15_t * pDst,
+			       uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex-by-complex multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_cmplx_q31(
+			        q31_t * pSrcA,
+			        q31_t * pSrcB,
+			       q31_t * pDst,
+			       uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex-by-complex multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_cmplx_f32(
+			        float32_t * pSrcA,
+			        float32_t * pSrcB,
+			       float32_t * pDst,
+			       uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex-by-complex conjugate multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector, conjugated
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_conj_q15(
+			q15_t * pSrcA,
+			q15_t * pSrcB,
+			q15_t * pDst,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Q31 complex-by-complex conjugate multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector, conjugated
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_conj_q31(
+			q31_t * pSrcA,
+			q31_t * pSrcB,
+			q31_t * pDst,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point complex-by-complex conjugate multiplication
+   * @param[in]  *pSrcA points to the first input vector
+   * @param[in]  *pSrcB points to the second input vector, conjugated
+   * @param[out]  *pDst  points to the output vector
+   * @param[in]  numSamples number of complex samples in each vector
+   * @return none.
+   */
+
+  void arm_cmplx_mult_conj_f32(
+			float32_t * pSrcA,
+			float32_t * pSrcB,
+			float32_t * pDst,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Q15 complex multiply-accumulate
    * @param[in]  *pSrcA points to the first input vector
    * @param[in]  *pSrcB points to the second input vector
-   * @param[out]  *pDst  points to the output vector
+   * @param[in,out]  *pAcc  points to the accumulator vector, in 3.29 format
    * @param[in]  numSamples number of complex samples in each vector
    * @return none.
    */
 
-  void arm_cmplx_mult_cmplx_q15(
-			        q15_t * pSrcA,
-			        q15_t * pSrcB,
-			       q15_t * pDst,
-			       uint32_t numSamples);
+  void arm_cmplx_mac_q15(
+			q15_t * pSrcA,
+			q15_t * pSrcB,
+			q31_t * pAcc,
+			uint32_t numSamples);
 
   /**
-   * @brief  Q31 complex-by-complex multiplication
+   * @brief  Q31 complex multiply-accumulate
    * @param[in]  *pSrcA points to the first input vector
    * @param[in]  *pSrcB points to the second input vector
-   * @param[out]  *pDst  points to the output vector
+   * @param[in,out]  *pAcc  points to the accumulator vector, in 3.29 format
    * @param[in]  numSamples number of complex samples in each vector
    * @return none.
    */
 
-  void arm_cmplx_mult_cmplx_q31(
-			        q31_t * pSrcA,
-			        q31_t * pSrcB,
-			       q31_t * pDst,
-			       uint32_t numSamples);
+  void arm_cmplx_mac_q31(
+			q31_t * pSrcA,
+			q31_t * pSrcB,
+			q31_t * pAcc,
+			uint32_t numSamples);
 
   /**
-   * @brief  Floating-point complex-by-complex multiplication
+   * @brief  Floating-point complex multiply-accumulate
    * @param[in]  *pSrcA points to the first input vector
    * @param[in]  *pSrcB points to the second input vector
-   * @param[out]  *pDst  points to the output vector
+   * @param[in,out]  *pAcc  points to the accumulator vector
    * @param[in]  numSamples number of complex samples in each vector
    * @return none.
    */
 
-  void arm_cmplx_mult_cmplx_f32(
-			        float32_t * pSrcA,
-			        float32_t * pSrcB,
-			       float32_t * pDst,
-			       uint32_t numSamples);
+  void arm_cmplx_mac_f32(
+			float32_t * pSrcA,
+			float32_t * pSrcB,
+			float32_t * pAcc,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Q15 planar to interleaved complex conversion
+   * @param[in]  *pSrcRe points to the real parts
+   * @param[in]  *pSrcIm points to the imaginary parts
+   * @param[out]  *pDst  points to the interleaved output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_interleave_q15(
+			q15_t * pSrcRe,
+			q15_t * pSrcIm,
+			q15_t * pDst,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Q15 interleaved to planar complex conversion
+   * @param[in]  *pSrc   points to the interleaved input vector
+   * @param[out]  *pDstRe points to the real parts
+   * @param[out]  *pDstIm points to the imaginary parts
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_deinterleave_q15(
+			q15_t * pSrc,
+			q15_t * pDstRe,
+			q15_t * pDstIm,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Q31 planar to interleaved complex conversion
+   * @param[in]  *pSrcRe points to the real parts
+   * @param[in]  *pSrcIm points to the imaginary parts
+   * @param[out]  *pDst  points to the interleaved output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_interleave_q31(
+			q31_t * pSrcRe,
+			q31_t * pSrcIm,
+			q31_t * pDst,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Q31 interleaved to planar complex conversion
+   * @param[in]  *pSrc   points to the interleaved input vector
+   * @param[out]  *pDstRe points to the real parts
+   * @param[out]  *pDstIm points to the imaginary parts
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_deinterleave_q31(
+			q31_t * pSrc,
+			q31_t * pDstRe,
+			q31_t * pDstIm,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point planar to interleaved complex conversion
+   * @param[in]  *pSrcRe points to the real parts
+   * @param[in]  *pSrcIm points to the imaginary parts
+   * @param[out]  *pDst  points to the interleaved output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_interleave_f32(
+			float32_t * pSrcRe,
+			float32_t * pSrcIm,
+			float32_t * pDst,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Floating-point interleaved to planar complex conversion
+   * @param[in]  *pSrc   points to the interleaved input vector
+   * @param[out]  *pDstRe points to the real parts
+   * @param[out]  *pDstIm points to the imaginary parts
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_deinterleave_f32(
+			float32_t * pSrc,
+			float32_t * pDstRe,
+			float32_t * pDstIm,
+			uint32_t numSamples);
+
+  /**
+   * @brief Instance structure for the floating-point recursive oscillator.
+   */
+  typedef struct
+  {
+    float32_t oscRe;        /**< Real part of the oscillator. */
+    float32_t oscIm;        /**< Imaginary part of the oscillator. */
+    float32_t stepRe;       /**< Real part of the rotation per sample, cos(omega). */
+    float32_t stepIm;       /**< Imaginary part of the rotation per sample, sin(omega). */
+  } arm_cmplx_nco_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 recursive oscillator.
+   */
+  typedef struct
+  {
+    q31_t oscRe;            /**< Real part of the oscillator, in 1.31 format. */
+    q31_t oscIm;            /**< Imaginary part of the oscillator, in 1.31 format. */
+    q31_t stepRe;           /**< Real part of the rotation per sample, in 1.31 format. */
+    q31_t stepIm;           /**< Imaginary part of the rotation per sample, in 1.31 format. */
+  } arm_cmplx_nco_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point recursive oscillator.
+   * @param[in,out] *S    points to an instance of the floating-point oscillator structure.
+   * @param[in]  omega    frequency in radians per sample, in the range [-pi pi]
+   * @param[in]  phase    initial phase in radians
+   * @return none.
+   */
+
+  void arm_cmplx_nco_init_f32(
+			arm_cmplx_nco_instance_f32 * S,
+			float32_t omega,
+			float32_t phase);
+
+  /**
+   * @brief  Floating-point complex mixing by a recursive oscillator.
+   * @param[in,out] *S    points to an instance of the floating-point oscillator structure.
+   * @param[in]  *pSrc    points to the complex input vector
+   * @param[out]  *pDst   points to the complex output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_nco_mix_f32(
+			arm_cmplx_nco_instance_f32 * S,
+			float32_t * pSrc,
+			float32_t * pDst,
+			uint32_t numSamples);
+
+  /**
+   * @brief  Initialization function for the Q15 recursive oscillator.
+   * @param[in,out] *S    points to an instance of the Q15 oscillator structure.
+   * @param[in]  omega    frequency in the range [-1 0.9999] mapping to [-pi pi) radians per sample
+   * @param[in]  phase    initial phase in the range [-1 0.9999] mapping to [-pi pi)
+   * @return none.
+   */
+
+  void arm_cmplx_nco_init_q15(
+			arm_cmplx_nco_instance_q15 * S,
+			q31_t omega,
+			q31_t phase);
+
+  /**
+   * @brief  Q15 complex mixing by a recursive oscillator.
+   * @param[in,out] *S    points to an instance of the Q15 oscillator structure.
+   * @param[in]  *pSrc    points to the complex input vector
+   * @param[out]  *pDst   points to the complex output vector
+   * @param[in]  numSamples number of complex samples
+   * @return none.
+   */
+
+  void arm_cmplx_nco_mix_q15(
+			arm_cmplx_nco_instance_q15 * S,
+			q15_t * pSrc,
+			q15_t * pDst,
+			uint32_t numSamples);
 
   /**
    * @brief Converts the elements of the floating-point vector to Q31 vector. 
@@ -6602,6 +13433,150 @@ extern "C"
 			     q7_t * pDst,
 			     uint32_t blockSize);
 
+  /**
+   * @brief  Converts a half-precision value to floating-point, exactly.
+   * @param[in]  in  half-precision value.
+   * @return floating-point value.
+   */
+  static __INLINE float32_t arm_f16_to_f32_scalar(
+  float16_t in)
+  {
+    union
+    {
+      float32_t f;
+      uint32_t u;
+    } out;
+#ifdef ARM_MATH_F16_HW
+
+    __ASM volatile ("vmov %0, %1\n\tvcvtb.f32.f16 %0, %0":"=t" (out.f):"r" ((uint32_t) in));
+
+#else
+    uint32_t sign = ((uint32_t) in & 0x8000u) << 16;
+    uint32_t exp = ((uint32_t) in >> 10) & 0x1Fu;
+    uint32_t mant = (uint32_t) in & 0x3FFu;
+
+    if(exp == 0x1Fu)
+    {
+      /* Infinity and NaN */
+      out.u = sign | 0x7F800000u | (mant << 13);
+    }
+    else if(exp != 0u)
+    {
+      /* Normal value: exponent rebiased from 15 to 127 */
+      out.u = sign | ((exp + 112u) << 23) | (mant << 13);
+    }
+    else
+    {
+      /* Zero and subnormal values, mant * 2^-24 */
+      out.f = (float32_t) mant * 5.9604644775390625e-8f;
+      out.u |= sign;
+    }
+
+#endif /* #ifdef ARM_MATH_F16_HW */
+
+    return (out.f);
+  }
+
+  /**
+   * @brief  Converts a floating-point value to half-precision, rounded to nearest even.
+   * @param[in]  in  floating-point value.
+   * @return half-precision value: infinity above 65504, zero or subnormal below 2^-14.
+   */
+  static __INLINE float16_t arm_f32_to_f16_scalar(
+  float32_t in)
+  {
+#ifdef ARM_MATH_F16_HW
+    uint32_t out;
+    float32_t tmp;
+
+    __ASM volatile ("vcvtb.f16.f32 %1, %2\n\tvmov %0, %1":"=r" (out), "=&t" (tmp):"t" (in));
+
+    return ((float16_t) out);
+
+#else
+    union
+    {
+      float32_t f;
+      uint32_t u;
+    } val;
+    uint32_t sign, mant, shift, rem, half, out;
+
+    val.f = in;
+    sign = (val.u >> 16) & 0x8000u;
+    val.u &= 0x7FFFFFFFu;
+
+    if(val.u >= 0x7F800000u)
+    {
+      /* Infinity and NaN, kept quiet */
+      return ((float16_t) (sign | 0x7C00u | ((val.u > 0x7F800000u) ? 0x200u : 0u)));
+    }
+
+    if(val.u >= 0x477FF000u)
+    {
+      /* 65520 and above round to infinity */
+      return ((float16_t) (sign | 0x7C00u));
+    }
+
+    if(val.u >= 0x38800000u)
+    {
+      /* Normal value: exponent rebiased from 127 to 15, 13 fraction bits rounded off */
+      out = (val.u >> 13) - (112u << 10);
+      rem = val.u & 0x1FFFu;
+
+      if((rem > 0x1000u) || ((rem == 0x1000u) && ((out & 1u) != 0u)))
+      {
+        out++;
+      }
+    }
+    else if(val.u > 0x33000000u)
+    {
+      /* Subnormal value, in units of 2^-24 */
+      mant = (val.u & 0x7FFFFFu) | 0x800000u;
+      shift = 126u - (val.u >> 23);
+      out = mant >> shift;
+      rem = mant & ((1u << shift) - 1u);
+      half = 1u << (shift - 1u);
+
+      if((rem > half) || ((rem == half) && ((out & 1u) != 0u)))
+      {
+        out++;
+      }
+    }
+    else
+    {
+      /* 2^-25 and below round to zero */
+      out = 0u;
+    }
+
+    return ((float16_t) (sign | out));
+
+#endif /* #ifdef ARM_MATH_F16_HW */
+  }
+
+  /**
+   * @brief  Converts the elements of a half-precision vector to floating-point.
+   * @param[in]  *pSrc     points to the half-precision input vector
+   * @param[out] *pDst     points to the floating-point output vector
+   * @param[in]  blockSize length of the input vector
+   * @return none.
+   */
+  void arm_f16_to_f32(
+		       float16_t * pSrc,
+		      float32_t * pDst,
+		      uint32_t blockSize);
+
+  /**
+   * @brief  Converts the elements of a floating-point vector to half-precision.
+   * @param[in]  *pSrc     points to the floating-point input vector
+   * @param[out] *pDst     points to the half-precision output vector
+   * @param[in]  blockSize length of the input vector
+   * @return none.
+   */
+  void arm_f32_to_f16(
+		       float32_t * pSrc,
+		      float16_t * pDst,
+		      uint32_t blockSize);
+
 
   /**
    * @brief  Converts the elements of the Q31 vector to Q15 vector.
@@ -6622,48 +13597,266 @@ extern "C"
    * @param[in]  blockSize is the number of samples to process
    * @return none.
    */
-  void arm_q31_to_q7(
-		      q31_t * pSrc,
-		     q7_t * pDst,
-		     uint32_t blockSize);
+  void arm_q31_to_q7(
+		      q31_t * pSrc,
+		     q7_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief  Converts the elements of the Q15 vector to floating-point vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void arm_q15_to_float(
+			 q15_t * pSrc,
+			float32_t * pDst,
+			uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts the elements of the Q15 vector to Q31 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void arm_q15_to_q31(
+		       q15_t * pSrc,
+		      q31_t * pDst,
+		      uint32_t blockSize);
+
+
+  /**
+   * @brief  Converts the elements of the Q15 vector to Q7 vector.
+   * @param[in]  *pSrc is input pointer
+   * @param[out]  *pDst is output pointer
+   * @param[in]  blockSize is the number of samples to process
+   * @return none.
+   */
+  void arm_q15_to_q7(
+		      q15_t * pSrc,
+		     q7_t * pDst,
+		     uint32_t blockSize);
+
+  /**
+   * @brief Converts a floating-point vector to Q15 with a gain and an offset.
+   * @param[in]       *pSrc points to the floating-point input vector
+   * @param[in]       gain gain applied to the inputs
+   * @param[in]       offset offset added after the gain
+   * @param[out]      *pDst points to the Q15 output vector, which may be pSrc
+   * @param[in]       blockSize length of the input vector
+   * @return none.
+   */
+  void arm_float_to_q15_scaled(
+			       float32_t * pSrc,
+			       float32_t gain,
+			       float32_t offset,
+			       q15_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Converts a floating-point vector to Q31 with a gain and an offset.
+   * @param[in]       *pSrc points to the floating-point input vector
+   * @param[in]       gain gain applied to the inputs
+   * @param[in]       offset offset added after the gain
+   * @param[out]      *pDst points to the Q31 output vector, which may be pSrc
+   * @param[in]       blockSize length of the input vector
+   * @return none.
+   */
+  void arm_float_to_q31_scaled(
+			       float32_t * pSrc,
+			       float32_t gain,
+			       float32_t offset,
+			       q31_t * pDst,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Converts a Q31 vector to Q15 with a gain and an offset.
+   * @param[in]       *pSrc points to the Q31 input vector
+   * @param[in]       scaleFract fractional portion of the gain
+   * @param[in]       shift number of bits to shift the result by, in the range [-15 15]
+   * @param[in]       offset Q15 offset added after the gain
+   * @param[out]      *pDst points to the Q15 output vector, which may be pSrc
+   * @param[in]       blockSize length of the input vector
+   * @return none.
+   */
+  void arm_q31_to_q15_scaled(
+			     q31_t * pSrc,
+			     q31_t scaleFract,
+			     int8_t shift,
+			     q15_t offset,
+			     q15_t * pDst,
+			     uint32_t blockSize);
+
+  /**
+   * @brief Converts a floating-point vector to Q15 with a gain, an offset and a TPDF dither.
+   * @param[in]       *pSrc points to the floating-point input vector
+   * @param[in]       gain gain applied to the inputs
+   * @param[in]       offset offset added after the gain
+   * @param[out]      *pDst points to the Q15 output vector, which may be pSrc
+   * @param[in,out]   *pSeed points to the state of the random generator
+   * @param[in]       blockSize length of the input vector
+   * @return none.
+   */
+  void arm_float_to_q15_dither(
+			       float32_t * pSrc,
+			       float32_t gain,
+			       float32_t offset,
+			       q15_t * pDst,
+			       uint32_t * pSeed,
+			       uint32_t blockSize);
+
+  /**
+   * @brief Copies a floating-point vector between two strides.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       srcStride distance in samples between two inputs
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       dstStride distance in samples between two outputs
+   * @param[in]       blockSize number of samples to copy
+   * @return none.
+   */
+  void arm_copy_strided_f32(
+			  float32_t * pSrc,
+			  uint32_t srcStride,
+			  float32_t * pDst,
+			  uint32_t dstStride,
+			  uint32_t blockSize);
+
+  /**
+   * @brief Splits interleaved floating-point frames into planar channels.
+   * @param[in]       *pSrc points to the interleaved samples
+   * @param[out]      **ppDst points to an array of pointers to the output channels
+   * @param[in]       numChannels number of channels of a frame
+   * @param[in]       numFrames number of frames
+   * @return none.
+   */
+  void arm_deinterleave_f32(
+			  float32_t * pSrc,
+			  float32_t ** ppDst,
+			  uint16_t numChannels,
+			  uint32_t numFrames);
+
+  /**
+   * @brief Merges planar floating-point channels into interleaved frames.
+   * @param[in]       **ppSrc points to an array of pointers to the input channels
+   * @param[out]      *pDst points to the interleaved samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[in]       numFrames number of frames
+   * @return none.
+   */
+  void arm_interleave_f32(
+			float32_t ** ppSrc,
+			float32_t * pDst,
+			uint16_t numChannels,
+			uint32_t numFrames);
+
+  /**
+   * @brief Copies a Q31 vector between two strides.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       srcStride distance in samples between two inputs
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       dstStride distance in samples between two outputs
+   * @param[in]       blockSize number of samples to copy
+   * @return none.
+   */
+  void arm_copy_strided_q31(
+			  q31_t * pSrc,
+			  uint32_t srcStride,
+			  q31_t * pDst,
+			  uint32_t dstStride,
+			  uint32_t blockSize);
+
+  /**
+   * @brief Splits interleaved Q31 frames into planar channels.
+   * @param[in]       *pSrc points to the interleaved samples
+   * @param[out]      **ppDst points to an array of pointers to the output channels
+   * @param[in]       numChannels number of channels of a frame
+   * @param[in]       numFrames number of frames
+   * @return none.
+   */
+  void arm_deinterleave_q31(
+			  q31_t * pSrc,
+			  q31_t ** ppDst,
+			  uint16_t numChannels,
+			  uint32_t numFrames);
+
+  /**
+   * @brief Merges planar Q31 channels into interleaved frames.
+   * @param[in]       **ppSrc points to an array of pointers to the input channels
+   * @param[out]      *pDst points to the interleaved samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[in]       numFrames number of frames
+   * @return none.
+   */
+  void arm_interleave_q31(
+			q31_t ** ppSrc,
+			q31_t * pDst,
+			uint16_t numChannels,
+			uint32_t numFrames);
+
+  /**
+   * @brief Copies a Q15 vector between two strides.
+   * @param[in]       *pSrc points to the input vector
+   * @param[in]       srcStride distance in samples between two inputs
+   * @param[out]      *pDst points to the output vector
+   * @param[in]       dstStride distance in samples between two outputs
+   * @param[in]       blockSize number of samples to copy
+   * @return none.
+   */
+  void arm_copy_strided_q15(
+			  q15_t * pSrc,
+			  uint32_t srcStride,
+			  q15_t * pDst,
+			  uint32_t dstStride,
+			  uint32_t blockSize);
 
   /**
-   * @brief  Converts the elements of the Q15 vector to floating-point vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
+   * @brief Splits interleaved Q15 frames into planar channels.
+   * @param[in]       *pSrc points to the interleaved samples
+   * @param[out]      **ppDst points to an array of pointers to the output channels
+   * @param[in]       numChannels number of channels of a frame
+   * @param[in]       numFrames number of frames
    * @return none.
    */
-  void arm_q15_to_float(
-			 q15_t * pSrc,
-			float32_t * pDst,
-			uint32_t blockSize);
-
+  void arm_deinterleave_q15(
+			  q15_t * pSrc,
+			  q15_t ** ppDst,
+			  uint16_t numChannels,
+			  uint32_t numFrames);
 
   /**
-   * @brief  Converts the elements of the Q15 vector to Q31 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
+   * @brief Merges planar Q15 channels into interleaved frames.
+   * @param[in]       **ppSrc points to an array of pointers to the input channels
+   * @param[out]      *pDst points to the interleaved samples
+   * @param[in]       numChannels number of channels of a frame
+   * @param[in]       numFrames number of frames
    * @return none.
    */
-  void arm_q15_to_q31(
-		       q15_t * pSrc,
-		      q31_t * pDst,
-		      uint32_t blockSize);
-
+  void arm_interleave_q15(
+			q15_t ** ppSrc,
+			q15_t * pDst,
+			uint16_t numChannels,
+			uint32_t numFrames);
 
   /**
-   * @brief  Converts the elements of the Q15 vector to Q7 vector.
-   * @param[in]  *pSrc is input pointer
-   * @param[out]  *pDst is output pointer
-   * @param[in]  blockSize is the number of samples to process
+   * @brief Splits interleaved 16-bit frames into planar floating-point channels.
+   * @param[in]       *pSrc points to the interleaved samples
+   * @param[in]       scale scale applied to the samples
+   * @param[in]       offset offset added after the scale
+   * @param[out]      **ppDst points to an array of pointers to the output channels
+   * @param[in]       numChannels number of channels of a frame
+   * @param[in]       numFrames number of frames
    * @return none.
    */
-  void arm_q15_to_q7(
-		      q15_t * pSrc,
-		     q7_t * pDst,
-		     uint32_t blockSize);
+  void arm_deinterleave_q15_to_float(
+				     q15_t * pSrc,
+				     float32_t scale,
+				     float32_t offset,
+				     float32_t ** ppDst,
+				     uint16_t numChannels,
+				     uint32_t numFrames);
 
 
   /**
@@ -6720,6 +13913,16 @@ extern "C"
    *
    * \par
    * if (x,y) are outside of the table boundary, Bilinear interpolation returns zero output. 
+   *
+   * \par Non-uniform tables:
+   * arm_bilinear_interp_nu_f32() interpolates a table sampled on a non-uniform grid, such
+   * as a calibration map indexed by engine speed and load. The <code>numCols</code> X
+   * breakpoints <code>pXData</code> and the <code>numRows</code> Y breakpoints
+   * <code>pYData</code> are increasing, and the value at <code>(pXData[c], pYData[r])</code>
+   * is <code>pData[c + r*numCols]</code>. The cell of <code>(x, y)</code> is searched on
+   * each axis from the cell of the previous call, as by arm_linear_interp_nu_f32(), and
+   * the coordinates are clamped to the table, so the edge values are extended outside of
+   * it. arm_bilinear_interp_nu_block_f32() processes arrays of coordinates.
    */
 
   /**
@@ -6795,6 +13998,38 @@ extern "C"
 
   }
 
+  /**
+  *
+  * @brief  Floating-point non-uniform bilinear interpolation.
+  * @param[in,out] *S points to an instance of the non-uniform interpolation structure.
+  * @param[in] X interpolation coordinate, on the scale of the X breakpoints.
+  * @param[in] Y interpolation coordinate, on the scale of the Y breakpoints.
+  * @return out interpolated value.
+  */
+
+  static __INLINE float32_t arm_bilinear_interp_nu_f32(
+						       arm_bilinear_interp_nu_instance_f32 * S,
+						       float32_t X,
+						       float32_t Y)
+  {
+    float32_t *pCell;                            /* Lower left corner of the cell */
+    uint32_t nCols = S->numCols;                 /* Number of columns */
+    uint32_t cI, rI;                             /* Column and row of the cell */
+    float32_t xfract, yfract;                    /* Position in the cell */
+    float32_t f0, f1;                            /* Interpolated rows */
+
+    cI = arm_interp_nu_index_f32(S->pXData, nCols, X, &S->lastCol, &xfract);
+    rI = arm_interp_nu_index_f32(S->pYData, S->numRows, Y, &S->lastRow, &yfract);
+
+    pCell = S->pData + (rI * nCols) + cI;
+
+    /* Interpolation along X in the two rows of the cell, then along Y */
+    f0 = pCell[0] + xfract * (pCell[1] - pCell[0]);
+    f1 = pCell[nCols] + xfract * (pCell[nCols + 1u] - pCell[nCols]);
+
+    return (f0 + yfract * (f1 - f0));
+  }
+
   /**
   *
   * @brief  Q31 bilinear interpolation.
@@ -7032,6 +14267,575 @@ extern "C"
    * @} end of BilinearInterpolate group
    */
 
+  /**
+   * @ingroup groupMatrix
+   */
+
+  /**
+   * @defgroup MatrixSmall Fixed-Size Matrix Functions
+   *
+   * Multiplication, multiplication by a transpose, determinant and inverse of 2x2, 3x3,
+   * 4x4 and 6x6 floating-point matrices, as met in attitude estimation and sensor fusion.
+   * For these sizes the generic functions spend more cycles on the size checks and the
+   * setup of their loops than on the arithmetic. These functions operate on row-major
+   * arrays of a fixed size, such as the <code>pData</code> member of an
+   * <code>arm_matrix_instance_f32</code>, without size checking. The 2x2, 3x3 and 4x4
+   * functions are fully unrolled and inline; the 6x6 products are inline with loops of
+   * constant bounds, which the compiler unrolls, and the 6x6 determinant and inverse are
+   * library functions.
+   *
+   * The output array must not be one of the input arrays.
+   */
+
+  /**
+   * @addtogroup MatrixSmall
+   * @{
+   */
+
+  /**
+   * @brief  Floating-point 2x2 matrix multiplication.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_2x2_f32(
+					    const float32_t * pA,
+					    const float32_t * pB,
+					    float32_t * pDst)
+  {
+    pDst[0] = (pA[0] * pB[0]) + (pA[1] * pB[2]);
+    pDst[1] = (pA[0] * pB[1]) + (pA[1] * pB[3]);
+    pDst[2] = (pA[2] * pB[0]) + (pA[3] * pB[2]);
+    pDst[3] = (pA[2] * pB[1]) + (pA[3] * pB[3]);
+  }
+
+  /**
+   * @brief  Floating-point 2x2 matrix multiplication by a transpose.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B^T.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_trans_2x2_f32(
+						  const float32_t * pA,
+						  const float32_t * pB,
+						  float32_t * pDst)
+  {
+    pDst[0] = (pA[0] * pB[0]) + (pA[1] * pB[1]);
+    pDst[1] = (pA[0] * pB[2]) + (pA[1] * pB[3]);
+    pDst[2] = (pA[2] * pB[0]) + (pA[3] * pB[1]);
+    pDst[3] = (pA[2] * pB[2]) + (pA[3] * pB[3]);
+  }
+
+  /**
+   * @brief  Floating-point 2x2 matrix determinant.
+   * @param[in]  *pA    points to the input matrix.
+   * @return determinant of the matrix.
+   */
+
+  static __INLINE float32_t arm_mat_det_2x2_f32(
+						const float32_t * pA)
+  {
+    return ((pA[0] * pA[3]) - (pA[1] * pA[2]));
+  }
+
+  /**
+   * @brief  Floating-point 2x2 matrix inverse.
+   * @param[in]  *pA    points to the input matrix.
+   * @param[out] *pDst  points to the output inverse matrix.
+   * @return The function returns ARM_MATH_SINGULAR if the determinant is zero, and
+   * ARM_MATH_SUCCESS otherwise.
+   */
+
+  static __INLINE arm_status arm_mat_inverse_2x2_f32(
+						     const float32_t * pA,
+						     float32_t * pDst)
+  {
+    float32_t det = arm_mat_det_2x2_f32(pA);
+
+    if(det == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    det = 1.0f / det;
+
+    pDst[0] = pA[3] * det;
+    pDst[1] = -pA[1] * det;
+    pDst[2] = -pA[2] * det;
+    pDst[3] = pA[0] * det;
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  /**
+   * @brief  Floating-point 3x3 matrix multiplication.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_3x3_f32(
+					    const float32_t * pA,
+					    const float32_t * pB,
+					    float32_t * pDst)
+  {
+    pDst[0] = (pA[0] * pB[0]) + (pA[1] * pB[3]) + (pA[2] * pB[6]);
+    pDst[1] = (pA[0] * pB[1]) + (pA[1] * pB[4]) + (pA[2] * pB[7]);
+    pDst[2] = (pA[0] * pB[2]) + (pA[1] * pB[5]) + (pA[2] * pB[8]);
+    pDst[3] = (pA[3] * pB[0]) + (pA[4] * pB[3]) + (pA[5] * pB[6]);
+    pDst[4] = (pA[3] * pB[1]) + (pA[4] * pB[4]) + (pA[5] * pB[7]);
+    pDst[5] = (pA[3] * pB[2]) + (pA[4] * pB[5]) + (pA[5] * pB[8]);
+    pDst[6] = (pA[6] * pB[0]) + (pA[7] * pB[3]) + (pA[8] * pB[6]);
+    pDst[7] = (pA[6] * pB[1]) + (pA[7] * pB[4]) + (pA[8] * pB[7]);
+    pDst[8] = (pA[6] * pB[2]) + (pA[7] * pB[5]) + (pA[8] * pB[8]);
+  }
+
+  /**
+   * @brief  Floating-point 3x3 matrix multiplication by a transpose.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B^T.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_trans_3x3_f32(
+						  const float32_t * pA,
+						  const float32_t * pB,
+						  float32_t * pDst)
+  {
+    pDst[0] = (pA[0] * pB[0]) + (pA[1] * pB[1]) + (pA[2] * pB[2]);
+    pDst[1] = (pA[0] * pB[3]) + (pA[1] * pB[4]) + (pA[2] * pB[5]);
+    pDst[2] = (pA[0] * pB[6]) + (pA[1] * pB[7]) + (pA[2] * pB[8]);
+    pDst[3] = (pA[3] * pB[0]) + (pA[4] * pB[1]) + (pA[5] * pB[2]);
+    pDst[4] = (pA[3] * pB[3]) + (pA[4] * pB[4]) + (pA[5] * pB[5]);
+    pDst[5] = (pA[3] * pB[6]) + (pA[4] * pB[7]) + (pA[5] * pB[8]);
+    pDst[6] = (pA[6] * pB[0]) + (pA[7] * pB[1]) + (pA[8] * pB[2]);
+    pDst[7] = (pA[6] * pB[3]) + (pA[7] * pB[4]) + (pA[8] * pB[5]);
+    pDst[8] = (pA[6] * pB[6]) + (pA[7] * pB[7]) + (pA[8] * pB[8]);
+  }
+
+  /**
+   * @brief  Floating-point 3x3 matrix by vector multiplication.
+   * @param[in]  *pA    points to the input matrix.
+   * @param[in]  *pV    points to the input vector of 3 elements.
+   * @param[out] *pDst  points to the output vector A * v.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_vec_mult_3x3_f32(
+						const float32_t * pA,
+						const float32_t * pV,
+						float32_t * pDst)
+  {
+    pDst[0] = (pA[0] * pV[0]) + (pA[1] * pV[1]) + (pA[2] * pV[2]);
+    pDst[1] = (pA[3] * pV[0]) + (pA[4] * pV[1]) + (pA[5] * pV[2]);
+    pDst[2] = (pA[6] * pV[0]) + (pA[7] * pV[1]) + (pA[8] * pV[2]);
+  }
+
+  /**
+   * @brief  Floating-point 3x3 matrix determinant.
+   * @param[in]  *pA    points to the input matrix.
+   * @return determinant of the matrix.
+   */
+
+  static __INLINE float32_t arm_mat_det_3x3_f32(
+						const float32_t * pA)
+  {
+    return ((pA[0] * ((pA[4] * pA[8]) - (pA[5] * pA[7]))) -
+	    (pA[1] * ((pA[3] * pA[8]) - (pA[5] * pA[6]))) +
+	    (pA[2] * ((pA[3] * pA[7]) - (pA[4] * pA[6]))));
+  }
+
+  /**
+   * @brief  Floating-point 3x3 matrix inverse.
+   * @param[in]  *pA    points to the input matrix.
+   * @param[out] *pDst  points to the output inverse matrix.
+   * @return The function returns ARM_MATH_SINGULAR if the determinant is zero, and
+   * ARM_MATH_SUCCESS otherwise.
+   */
+
+  static __INLINE arm_status arm_mat_inverse_3x3_f32(
+						     const float32_t * pA,
+						     float32_t * pDst)
+  {
+    float32_t c0, c1, c2, det;
+
+    /* Cofactors of the first row */
+    c0 = (pA[4] * pA[8]) - (pA[5] * pA[7]);
+    c1 = (pA[5] * pA[6]) - (pA[3] * pA[8]);
+    c2 = (pA[3] * pA[7]) - (pA[4] * pA[6]);
+
+    det = (pA[0] * c0) + (pA[1] * c1) + (pA[2] * c2);
+
+    if(det == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    det = 1.0f / det;
+
+    /* Transpose of the cofactor matrix, divided by the determinant */
+    pDst[0] = c0 * det;
+    pDst[1] = ((pA[2] * pA[7]) - (pA[1] * pA[8])) * det;
+    pDst[2] = ((pA[1] * pA[5]) - (pA[2] * pA[4])) * det;
+    pDst[3] = c1 * det;
+    pDst[4] = ((pA[0] * pA[8]) - (pA[2] * pA[6])) * det;
+    pDst[5] = ((pA[2] * pA[3]) - (pA[0] * pA[5])) * det;
+    pDst[6] = c2 * det;
+    pDst[7] = ((pA[1] * pA[6]) - (pA[0] * pA[7])) * det;
+    pDst[8] = ((pA[0] * pA[4]) - (pA[1] * pA[3])) * det;
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  /**
+   * @brief  Floating-point 4x4 matrix multiplication.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_4x4_f32(
+					    const float32_t * pA,
+					    const float32_t * pB,
+					    float32_t * pDst)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < 16u; i += 4u)
+    {
+      pDst[i] = (pA[i] * pB[0]) + (pA[i + 1u] * pB[4]) + (pA[i + 2u] * pB[8]) + (pA[i + 3u] * pB[12]);
+      pDst[i + 1u] = (pA[i] * pB[1]) + (pA[i + 1u] * pB[5]) + (pA[i + 2u] * pB[9]) + (pA[i + 3u] * pB[13]);
+      pDst[i + 2u] = (pA[i] * pB[2]) + (pA[i + 1u] * pB[6]) + (pA[i + 2u] * pB[10]) + (pA[i + 3u] * pB[14]);
+      pDst[i + 3u] = (pA[i] * pB[3]) + (pA[i + 1u] * pB[7]) + (pA[i + 2u] * pB[11]) + (pA[i + 3u] * pB[15]);
+    }
+  }
+
+  /**
+   * @brief  Floating-point 4x4 matrix multiplication by a transpose.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B^T.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_trans_4x4_f32(
+						  const float32_t * pA,
+						  const float32_t * pB,
+						  float32_t * pDst)
+  {
+    uint32_t i;
+
+    for (i = 0u; i < 16u; i += 4u)
+    {
+      pDst[i] = (pA[i] * pB[0]) + (pA[i + 1u] * pB[1]) + (pA[i + 2u] * pB[2]) + (pA[i + 3u] * pB[3]);
+      pDst[i + 1u] = (pA[i] * pB[4]) + (pA[i + 1u] * pB[5]) + (pA[i + 2u] * pB[6]) + (pA[i + 3u] * pB[7]);
+      pDst[i + 2u] = (pA[i] * pB[8]) + (pA[i + 1u] * pB[9]) + (pA[i + 2u] * pB[10]) + (pA[i + 3u] * pB[11]);
+      pDst[i + 3u] = (pA[i] * pB[12]) + (pA[i + 1u] * pB[13]) + (pA[i + 2u] * pB[14]) + (pA[i + 3u] * pB[15]);
+    }
+  }
+
+  /**
+   * @brief  Floating-point 4x4 matrix determinant.
+   * @param[in]  *pA    points to the input matrix.
+   * @return determinant of the matrix.
+   */
+
+  static __INLINE float32_t arm_mat_det_4x4_f32(
+						const float32_t * pA)
+  {
+    /* Products of the 2x2 minors of the first two rows and of the last two rows */
+    return (((((pA[0] * pA[5]) - (pA[4] * pA[1])) * ((pA[10] * pA[15]) - (pA[14] * pA[11]))) -
+	     (((pA[0] * pA[6]) - (pA[4] * pA[2])) * ((pA[9] * pA[15]) - (pA[13] * pA[11])))) +
+	    ((((pA[0] * pA[7]) - (pA[4] * pA[3])) * ((pA[9] * pA[14]) - (pA[13] * pA[10]))) +
+	     (((pA[1] * pA[6]) - (pA[5] * pA[2])) * ((pA[8] * pA[15]) - (pA[12] * pA[11])))) -
+	    ((((pA[1] * pA[7]) - (pA[5] * pA[3])) * ((pA[8] * pA[14]) - (pA[12] * pA[10]))) -
+	     (((pA[2] * pA[7]) - (pA[6] * pA[3])) * ((pA[8] * pA[13]) - (pA[12] * pA[9])))));
+  }
+
+  /**
+   * @brief  Floating-point 4x4 matrix inverse.
+   * @param[in]  *pA    points to the input matrix.
+   * @param[out] *pDst  points to the output inverse matrix.
+   * @return The function returns ARM_MATH_SINGULAR if the determinant is zero, and
+   * ARM_MATH_SUCCESS otherwise.
+   */
+
+  static __INLINE arm_status arm_mat_inverse_4x4_f32(
+						     const float32_t * pA,
+						     float32_t * pDst)
+  {
+    float32_t s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5, det;
+
+    /* 2x2 minors of the first two rows */
+    s0 = (pA[0] * pA[5]) - (pA[4] * pA[1]);
+    s1 = (pA[0] * pA[6]) - (pA[4] * pA[2]);
+    s2 = (pA[0] * pA[7]) - (pA[4] * pA[3]);
+    s3 = (pA[1] * pA[6]) - (pA[5] * pA[2]);
+    s4 = (pA[1] * pA[7]) - (pA[5] * pA[3]);
+    s5 = (pA[2] * pA[7]) - (pA[6] * pA[3]);
+
+    /* 2x2 minors of the last two rows */
+    c5 = (pA[10] * pA[15]) - (pA[14] * pA[11]);
+    c4 = (pA[9] * pA[15]) - (pA[13] * pA[11]);
+    c3 = (pA[9] * pA[14]) - (pA[13] * pA[10]);
+    c2 = (pA[8] * pA[15]) - (pA[12] * pA[11]);
+    c1 = (pA[8] * pA[14]) - (pA[12] * pA[10]);
+    c0 = (pA[8] * pA[13]) - (pA[12] * pA[9]);
+
+    det = (s0 * c5) - (s1 * c4) + (s2 * c3) + (s3 * c2) - (s4 * c1) + (s5 * c0);
+
+    if(det == 0.0f)
+    {
+      return (ARM_MATH_SINGULAR);
+    }
+
+    det = 1.0f / det;
+
+    pDst[0] = ((pA[5] * c5) - (pA[6] * c4) + (pA[7] * c3)) * det;
+    pDst[1] = ((-pA[1] * c5) + (pA[2] * c4) - (pA[3] * c3)) * det;
+    pDst[2] = ((pA[13] * s5) - (pA[14] * s4) + (pA[15] * s3)) * det;
+    pDst[3] = ((-pA[9] * s5) + (pA[10] * s4) - (pA[11] * s3)) * det;
+
+    pDst[4] = ((-pA[4] * c5) + (pA[6] * c2) - (pA[7] * c1)) * det;
+    pDst[5] = ((pA[0] * c5) - (pA[2] * c2) + (pA[3] * c1)) * det;
+    pDst[6] = ((-pA[12] * s5) + (pA[14] * s2) - (pA[15] * s1)) * det;
+    pDst[7] = ((pA[8] * s5) - (pA[10] * s2) + (pA[11] * s1)) * det;
+
+    pDst[8] = ((pA[4] * c4) - (pA[5] * c2) + (pA[7] * c0)) * det;
+    pDst[9] = ((-pA[0] * c4) + (pA[1] * c2) - (pA[3] * c0)) * det;
+    pDst[10] = ((pA[12] * s4) - (pA[13] * s2) + (pA[15] * s0)) * det;
+    pDst[11] = ((-pA[8] * s4) + (pA[9] * s2) - (pA[11] * s0)) * det;
+
+    pDst[12] = ((-pA[4] * c3) + (pA[5] * c1) - (pA[6] * c0)) * det;
+    pDst[13] = ((pA[0] * c3) - (pA[1] * c1) + (pA[2] * c0)) * det;
+    pDst[14] = ((-pA[12] * s3) + (pA[13] * s1) - (pA[14] * s0)) * det;
+    pDst[15] = ((pA[8] * s3) - (pA[9] * s1) + (pA[10] * s0)) * det;
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  /**
+   * @brief  Floating-point 6x6 matrix multiplication.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_6x6_f32(
+					    const float32_t * pA,
+					    const float32_t * pB,
+					    float32_t * pDst)
+  {
+    uint32_t i, j;
+
+    for (i = 0u; i < 36u; i += 6u)
+    {
+      for (j = 0u; j < 6u; j++)
+      {
+	pDst[i + j] = (pA[i] * pB[j]) + (pA[i + 1u] * pB[6u + j]) + (pA[i + 2u] * pB[12u + j]) +
+	  (pA[i + 3u] * pB[18u + j]) + (pA[i + 4u] * pB[24u + j]) + (pA[i + 5u] * pB[30u + j]);
+      }
+    }
+  }
+
+  /**
+   * @brief  Floating-point 6x6 matrix multiplication by a transpose.
+   * @param[in]  *pA    points to the first input matrix.
+   * @param[in]  *pB    points to the second input matrix.
+   * @param[out] *pDst  points to the output matrix A * B^T.
+   * @return none.
+   */
+
+  static __INLINE void arm_mat_mult_trans_6x6_f32(
+						  const float32_t * pA,
+						  const float32_t * pB,
+						  float32_t * pDst)
+  {
+    uint32_t i, j;
+
+    for (i = 0u; i < 36u; i += 6u)
+    {
+      for (j = 0u; j < 36u; j += 6u)
+      {
+	pDst[i + (j / 6u)] = (pA[i] * pB[j]) + (pA[i + 1u] * pB[j + 1u]) + (pA[i + 2u] * pB[j + 2u]) +
+	  (pA[i + 3u] * pB[j + 3u]) + (pA[i + 4u] * pB[j + 4u]) + (pA[i + 5u] * pB[j + 5u]);
+      }
+    }
+  }
+
+  /**
+   * @brief  Floating-point 6x6 matrix determinant.
+   * @param[in]  *pA    points to the input matrix.
+   * @return determinant of the matrix.
+   */
+
+  float32_t arm_mat_det_6x6_f32(
+				const float32_t * pA);
+
+  /**
+   * @brief  Floating-point 6x6 matrix inverse.
+   * @param[in]  *pA    points to the input matrix.
+   * @param[out] *pDst  points to the output inverse matrix.
+   * @return The function returns ARM_MATH_SINGULAR if the matrix is singular, and
+   * ARM_MATH_SUCCESS otherwise.
+   */
+
+  arm_status arm_mat_inverse_6x6_f32(
+				     const float32_t * pA,
+				     float32_t * pDst);
+
+  /**
+   * @} end of MatrixSmall group
+   */
+
+  /**
+   * @ingroup groupMatrix
+   */
+
+  /**
+   * @defgroup Quaternion Quaternion Functions
+   *
+   * Functions on the quaternions <code>q = w + x*i + y*j + z*k</code> representing
+   * rotations in attitude estimation, stored as arrays of 4 floating-point values
+   * <code>{w, x, y, z}</code>. A rotation is applied to a vector through the rotation matrix
+   * of the quaternion and arm_mat_vec_mult_3x3_f32(), and rotations are composed by
+   * arm_quaternion_product_f32(), the product <code>q1*q2</code> applying <code>q2</code>
+   * first.
+   */
+
+  /**
+   * @addtogroup Quaternion
+   * @{
+   */
+
+  /**
+   * @brief  Floating-point quaternion product.
+   * @param[in]  *pQ1   points to the first quaternion.
+   * @param[in]  *pQ2   points to the second quaternion.
+   * @param[out] *pDst  points to the output quaternion q1 * q2.
+   * @return none.
+   */
+
+  static __INLINE void arm_quaternion_product_f32(
+						  const float32_t * pQ1,
+						  const float32_t * pQ2,
+						  float32_t * pDst)
+  {
+    float32_t w, x, y, z;
+
+    w = (pQ1[0] * pQ2[0]) - (pQ1[1] * pQ2[1]) - (pQ1[2] * pQ2[2]) - (pQ1[3] * pQ2[3]);
+    x = (pQ1[0] * pQ2[1]) + (pQ1[1] * pQ2[0]) + (pQ1[2] * pQ2[3]) - (pQ1[3] * pQ2[2]);
+    y = (pQ1[0] * pQ2[2]) - (pQ1[1] * pQ2[3]) + (pQ1[2] * pQ2[0]) + (pQ1[3] * pQ2[1]);
+    z = (pQ1[0] * pQ2[3]) + (pQ1[1] * pQ2[2]) - (pQ1[2] * pQ2[1]) + (pQ1[3] * pQ2[0]);
+
+    pDst[0] = w;
+    pDst[1] = x;
+    pDst[2] = y;
+    pDst[3] = z;
+  }
+
+  /**
+   * @brief  Floating-point quaternion conjugate, the inverse rotation of a unit quaternion.
+   * @param[in]  *pQ    points to the input quaternion.
+   * @param[out] *pDst  points to the output quaternion.
+   * @return none.
+   */
+
+  static __INLINE void arm_quaternion_conjugate_f32(
+						    const float32_t * pQ,
+						    float32_t * pDst)
+  {
+    pDst[0] = pQ[0];
+    pDst[1] = -pQ[1];
+    pDst[2] = -pQ[2];
+    pDst[3] = -pQ[3];
+  }
+
+  /**
+   * @brief  Floating-point quaternion normalization.
+   * @param[in]  *pQ    points to the input quaternion.
+   * @param[out] *pDst  points to the output unit quaternion.
+   * @return The function returns ARM_MATH_ARGUMENT_ERROR if the quaternion is zero, and
+   * ARM_MATH_SUCCESS otherwise.
+   */
+
+  static __INLINE arm_status arm_quaternion_normalize_f32(
+							  const float32_t * pQ,
+							  float32_t * pDst)
+  {
+    float32_t norm;
+
+    if(arm_sqrt_f32((pQ[0] * pQ[0]) + (pQ[1] * pQ[1]) + (pQ[2] * pQ[2]) + (pQ[3] * pQ[3]),
+		    &norm) != ARM_MATH_SUCCESS)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    norm = 1.0f / norm;
+
+    pDst[0] = pQ[0] * norm;
+    pDst[1] = pQ[1] * norm;
+    pDst[2] = pQ[2] * norm;
+    pDst[3] = pQ[3] * norm;
+
+    return (ARM_MATH_SUCCESS);
+  }
+
+  /**
+   * @brief  Rotation matrix of a floating-point unit quaternion.
+   * @param[in]  *pQ    points to the input unit quaternion.
+   * @param[out] *pDst  points to the output 3x3 rotation matrix.
+   * @return none.
+   */
+
+  static __INLINE void arm_quaternion_to_rotation_f32(
+						      const float32_t * pQ,
+						      float32_t * pDst)
+  {
+    float32_t w = pQ[0], x = pQ[1], y = pQ[2], z = pQ[3];
+
+    pDst[0] = 1.0f - (2.0f * ((y * y) + (z * z)));
+    pDst[1] = 2.0f * ((x * y) - (w * z));
+    pDst[2] = 2.0f * ((x * z) + (w * y));
+    pDst[3] = 2.0f * ((x * y) + (w * z));
+    pDst[4] = 1.0f - (2.0f * ((x * x) + (z * z)));
+    pDst[5] = 2.0f * ((y * z) - (w * x));
+    pDst[6] = 2.0f * ((x * z) - (w * y));
+    pDst[7] = 2.0f * ((y * z) + (w * x));
+    pDst[8] = 1.0f - (2.0f * ((x * x) + (y * y)));
+  }
+
+  /**
+   * @brief  Rotates a vector by a floating-point unit quaternion.
+   * @param[in]  *pQ    points to the input unit quaternion.
+   * @param[in]  *pV    points to the input vector of 3 elements.
+   * @param[out] *pDst  points to the output rotated vector.
+   * @return none.
+   */
+
+  static __INLINE void arm_quaternion_rotate_f32(
+						 const float32_t * pQ,
+						 const float32_t * pV,
+						 float32_t * pDst)
+  {
+    float32_t rot[9];
+
+    arm_quaternion_to_rotation_f32(pQ, rot);
+    arm_mat_vec_mult_3x3_f32(rot, pV, pDst);
+  }
+
+  /**
+   * @} end of Quaternion group
+   */
+
 
 
 
@@ -0,0 +1,1339 @@
+/* ----------------------------------------------------------------------
+ * $Date:        5. March 2012
+ * $Revision:    V0.03
+ *
+ * Project:      CMSIS-RTOS API
+ * Title:        cmsis_os.c reference kernel for Cortex-M3 and Cortex-M4
+ *
+ * The kernel is a compact implementation of the cmsis_os.h API:
+ *  - ready threads are kept in one list per priority and a bitmap of the
+ *    non-empty lists: the highest priority ready thread is found with CLZ,
+ *    in a constant time
+ *  - the context switch is done by PendSV, at the lowest priority. On
+ *    Cortex-M4 with FPU, the registers S16-S31 are only saved for the
+ *    threads that used the FPU, and the lazy stacking of the hardware
+ *    saves S0-S15 only when an exception uses the FPU
+ *  - osPool and osMail blocks are allocated and freed in a constant time
+ *    from a free list (os_pool.c, to build with this file); all the kernel
+ *    objects are allocated statically by the osXxxDef macros
+ *  - osSemaphoreRelease, osSignalSet, osMessagePut, osPoolAlloc/Free and
+ *    the osMail functions can be called from ISRs
+ *  - with osKernelTickless, the idle thread stops the periodic SysTick
+ *    interrupt until the next timeout
+ *
+ * The kernel uses the SysTick_Handler and PendSV_Handler exception
+ * handlers. The application must not define them.
+ * -------------------------------------------------------------------- */
+
+#if defined (STM32F4XX) || defined (STM32F40XX) || defined (STM32F427X)
+ #include "stm32f4xx.h"
+#elif defined (STM32F2XX)
+ #include "stm32f2xx.h"
+#else
+ #include "stm32f10x.h"
+#endif
+#include "cmsis_os.h"
+#include <string.h>
+
+
+// ==== Kernel definitions ====
+
+// Thread states
+#define os_INACTIVE         0          ///< not created or terminated
+#define os_READY            1          ///< in the ready list of its priority
+#define os_WAIT_DELAY       2          ///< osDelay
+#define os_WAIT_SIGNAL      3          ///< osSignalWait
+#define os_WAIT_OBJECT      4          ///< mutex, semaphore, message, mail
+#define os_WAIT_TIMER       5          ///< timer thread waiting for an expiry
+
+#define os_PRIORITIES       (osPriorityRealtime - osPriorityIdle + 1)
+#define os_prio_idx(prio)   ((uint8_t)((int32_t)(prio) - osPriorityIdle))
+#define os_prio_valid(prio) (((prio) >= osPriorityIdle) && ((prio) <= osPriorityRealtime))
+
+#define os_SIGNAL_MASK      ((int32_t)((1U << osFeature_Signals) - 1))
+#define os_EXC_RETURN       0xFFFFFFFD ///< thread mode, PSP, no FPU context
+#define os_XPSR_T           0x01000000 ///< Thumb state
+
+/// Running thread and thread to run, read by PendSV_Handler.
+struct os_sched_info  {
+  struct os_thread_cb         *run;    ///< running thread (offset 0)
+  struct os_thread_cb        *next;    ///< highest priority ready thread (offset 4)
+};
+
+struct os_sched_info   os_sched_info;
+
+static struct os_thread_cb    *os_rdy[os_PRIORITIES];  ///< ready threads, running thread first
+static uint32_t                os_rdy_map;   ///< bit n set when os_rdy[n] is not empty
+static struct os_thread_cb    *os_dly;       ///< waiting threads with a timeout, sorted by wake-up tick
+static struct os_timer_cb     *os_tmr;       ///< running timers, sorted by expiry tick
+static volatile uint32_t       os_time;      ///< ticks since osKernelStart
+static uint32_t                os_tick_reload;  ///< SysTick cycles per tick
+static int32_t                 os_running;
+static struct os_thread_cb    *os_idle_id;
+static struct os_thread_cb    *os_timer_id;
+
+static void os_idle_thread (void const *argument);
+static void os_timer_thread (void const *argument);
+
+osThreadDef(os_idle_thread, osPriorityIdle, 1, osKernelIdleStackSize);
+osThreadDef(os_timer_thread, osKernelTimerPriority, 1, osKernelTimerStackSize);
+
+
+// ==== Critical sections ====
+
+/// Mask the interrupts that can call the kernel.
+/// \return state to restore with \ref os_unlock.
+static __INLINE uint32_t os_lock (void)  {
+  uint32_t state;
+
+#if (osKernelBasePri != 0)
+  state = __get_BASEPRI();
+  // only raise the masking level: BASEPRI = 0 masks nothing
+  if ((state == 0) || (state > osKernelBasePri))  {
+    __set_BASEPRI(osKernelBasePri);
+  }
+#else
+  state = __get_PRIMASK();
+  __disable_irq();
+#endif
+  return state;
+}
+
+/// Restore the interrupt masking. A pending context switch is done here.
+static __INLINE void os_unlock (uint32_t state)  {
+#if (osKernelBasePri != 0)
+  __set_BASEPRI(state);
+#else
+  __set_PRIMASK(state);
+#endif
+}
+
+/// Check if the caller is an interrupt service routine.
+static __INLINE int32_t os_in_isr (void)  {
+  return (__get_IPSR() != 0);
+}
+
+
+// ==== Thread lists ====
+
+/// Add a thread at the end of a circular list.
+static void os_list_add (struct os_thread_cb **head, struct os_thread_cb *thread)  {
+  struct os_thread_cb *first = *head;
+
+  if (first == NULL)  {
+    thread->next = thread;
+    thread->prev = thread;
+    *head = thread;
+  }
+  else  {
+    thread->next = first;
+    thread->prev = first->prev;
+    first->prev->next = thread;
+    first->prev = thread;
+  }
+}
+
+/// Remove a thread from a circular list.
+static void os_list_remove (struct os_thread_cb **head, struct os_thread_cb *thread)  {
+  if (thread->next == thread)  {
+    *head = NULL;
+  }
+  else  {
+    thread->prev->next = thread->next;
+    thread->next->prev = thread->prev;
+    if (*head == thread)  {
+      *head = thread->next;
+    }
+  }
+}
+
+/// Add a thread to a wait list, after the threads of the same or a higher priority.
+static void os_wlist_add (os_wlist *wlist, struct os_thread_cb *thread)  {
+  struct os_thread_cb *first = wlist->first;
+  struct os_thread_cb *p = first;
+
+  if (first == NULL)  {
+    os_list_add(&wlist->first, thread);
+    return;
+  }
+  do  {
+    if (p->prio < thread->prio)  {
+      break;
+    }
+    p = p->next;
+  } while (p != first);
+
+  // insert before p
+  thread->next = p;
+  thread->prev = p->prev;
+  p->prev->next = thread;
+  p->prev = thread;
+  if ((p == first) && (first->prio < thread->prio))  {
+    wlist->first = thread;
+  }
+}
+
+/// Add a thread to the ready list of its priority.
+static void os_rdy_add (struct os_thread_cb *thread)  {
+  os_list_add(&os_rdy[thread->prio], thread);
+  os_rdy_map |= (1U << thread->prio);
+  thread->state = os_READY;
+}
+
+/// Remove a thread from the ready list of its priority.
+static void os_rdy_remove (struct os_thread_cb *thread)  {
+  os_list_remove(&os_rdy[thread->prio], thread);
+  if (os_rdy[thread->prio] == NULL)  {
+    os_rdy_map &= ~(1U << thread->prio);
+  }
+}
+
+/// Insert a thread in the delay list.
+static void os_dly_add (struct os_thread_cb *thread, uint32_t ticks)  {
+  struct os_thread_cb *p = os_dly;
+  struct os_thread_cb *prev = NULL;
+
+  thread->wake = os_time + ticks;
+  while ((p != NULL) && ((int32_t)(p->wake - thread->wake) <= 0))  {
+    prev = p;
+    p = p->dnext;
+  }
+  thread->dnext = p;
+  thread->dprev = prev;
+  if (p != NULL)  {
+    p->dprev = thread;
+  }
+  if (prev != NULL)  {
+    prev->dnext = thread;
+  }
+  else  {
+    os_dly = thread;
+  }
+}
+
+/// Remove a thread from the delay list, if it is in.
+static void os_dly_remove (struct os_thread_cb *thread)  {
+  if ((thread->dprev == NULL) && (os_dly != thread))  {
+    return;
+  }
+  if (thread->dprev != NULL)  {
+    thread->dprev->dnext = thread->dnext;
+  }
+  else  {
+    os_dly = thread->dnext;
+  }
+  if (thread->dnext != NULL)  {
+    thread->dnext->dprev = thread->dprev;
+  }
+  thread->dnext = NULL;
+  thread->dprev = NULL;
+}
+
+
+// ==== Scheduler ====
+
+/// Convert milliseconds to ticks: at least 1, at most half the tick range.
+static uint32_t os_ms2ticks (uint32_t millisec)  {
+  uint32_t ticks;
+
+#if (osKernelTickFreq == 1000)
+  ticks = millisec;
+#else
+  uint64_t t = (((uint64_t)millisec * osKernelTickFreq) + 999) / 1000;
+  ticks = (t > 0x7FFFFFFF) ? 0x7FFFFFFF : (uint32_t)t;
+#endif
+  if (ticks == 0)  {
+    ticks = 1;
+  }
+  if (ticks > 0x7FFFFFFF)  {
+    ticks = 0x7FFFFFFF;
+  }
+  return ticks;
+}
+
+/// Select the highest priority ready thread, and request PendSV to switch to it.
+static void os_sched (void)  {
+  struct os_thread_cb *next;
+
+  if (os_running == 0)  {
+    return;
+  }
+  next = os_rdy[31 - __CLZ(os_rdy_map)];
+  if (next != os_sched_info.next)  {
+    os_sched_info.next = next;
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+  }
+}
+
+/// Block the running thread. The switch is done by \ref os_unlock.
+static void os_block (os_wlist *wlist, uint32_t millisec, uint8_t state)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+
+  os_rdy_remove(thread);
+  thread->state = state;
+  thread->wlist = wlist;
+  if (wlist != NULL)  {
+    os_wlist_add(wlist, thread);
+  }
+  if (millisec != osWaitForever)  {
+    os_dly_add(thread, os_ms2ticks(millisec));
+  }
+  os_sched();
+}
+
+/// Make a waiting thread ready, with the status and value of its wait.
+static void os_wake (struct os_thread_cb *thread, osStatus status, uint32_t ret)  {
+  if (thread->wlist != NULL)  {
+    os_list_remove(&thread->wlist->first, thread);
+    thread->wlist = NULL;
+  }
+  os_dly_remove(thread);
+  thread->status = status;
+  thread->ret = ret;
+  os_rdy_add(thread);
+}
+
+/// Change the current priority of a thread, keeping its list sorted.
+static void os_prio_set (struct os_thread_cb *thread, uint8_t prio)  {
+  if (thread->prio == prio)  {
+    return;
+  }
+  if (thread->state == os_READY)  {
+    os_rdy_remove(thread);
+    thread->prio = prio;
+    os_rdy_add(thread);
+  }
+  else if (thread->wlist != NULL)  {
+    os_list_remove(&thread->wlist->first, thread);
+    thread->prio = prio;
+    os_wlist_add(thread->wlist, thread);
+  }
+  else  {
+    thread->prio = prio;
+  }
+}
+
+
+// ==== Exception handlers ====
+
+/// Context switch from os_sched_info.run to os_sched_info.next.
+#if defined (__CC_ARM)
+__asm void PendSV_Handler (void)  {
+  IMPORT  os_sched_info
+  PRESERVE8
+
+  CPSID   I
+  LDR     R3, =os_sched_info
+  LDM     R3, {R1, R2}                 ; R1 = running thread, R2 = next thread
+  CBZ     R1, PendSV_Restore           ; no thread to save at the first switch
+  MRS     R0, PSP
+#if (defined (__FPU_USED) && (__FPU_USED == 1))
+  TST     LR, #0x10                    ; EXC_RETURN bit 4 clear: FPU context
+  IT      EQ
+  VSTMDBEQ R0!, {S16-S31}
+#endif
+  STMDB   R0!, {R4-R11}
+  STRD    R0, LR, [R1]                 ; save SP and EXC_RETURN
+PendSV_Restore
+  STR     R2, [R3]                     ; run = next
+  LDRD    R0, LR, [R2]
+  LDMIA   R0!, {R4-R11}
+#if (defined (__FPU_USED) && (__FPU_USED == 1))
+  TST     LR, #0x10
+  IT      EQ
+  VLDMIAEQ R0!, {S16-S31}
+#endif
+  MSR     PSP, R0
+  CPSIE   I
+  BX      LR
+  ALIGN
+}
+#elif defined (__GNUC__)
+void PendSV_Handler (void) __attribute__ ((naked));
+void PendSV_Handler (void)  {
+  __ASM volatile (
+  "  cpsid   i                    \n"
+  "  ldr     r3, =os_sched_info   \n"
+  "  ldm     r3, {r1, r2}         \n"  // r1 = running thread, r2 = next thread
+  "  cbz     r1, 1f               \n"  // no thread to save at the first switch
+  "  mrs     r0, psp              \n"
+#if (defined (__FPU_USED) && (__FPU_USED == 1))
+  "  tst     lr, #0x10            \n"  // EXC_RETURN bit 4 clear: FPU context
+  "  it      eq                   \n"
+  "  vstmdbeq r0!, {s16-s31}      \n"
+#endif
+  "  stmdb   r0!, {r4-r11}        \n"
+  "  strd    r0, lr, [r1]         \n"  // save SP and EXC_RETURN
+  "1:                             \n"
+  "  str     r2, [r3]             \n"  // run = next
+  "  ldrd    r0, lr, [r2]         \n"
+  "  ldmia   r0!, {r4-r11}        \n"
+#if (defined (__FPU_USED) && (__FPU_USED == 1))
+  "  tst     lr, #0x10            \n"
+  "  it      eq                   \n"
+  "  vldmiaeq r0!, {s16-s31}      \n"
+#endif
+  "  msr     psp, r0              \n"
+  "  cpsie   i                    \n"
+  "  bx      lr                   \n"
+  "  .ltorg                       \n"
+  );
+}
+#else
+ #error "cmsis_os.c: PendSV_Handler is only provided for the ARM and GNU compilers"
+#endif
+
+/// Periodic tick: wake up the threads whose timeout elapsed and the timer thread.
+void SysTick_Handler (void)  {
+  uint32_t state = os_lock();
+
+  os_time++;
+  while ((os_dly != NULL) && ((int32_t)(os_dly->wake - os_time) <= 0))  {
+    os_wake(os_dly, osEventTimeout, 0);
+  }
+  if ((os_tmr != NULL) && ((int32_t)(os_tmr->expiry - os_time) <= 0) &&
+      (os_timer_id->state == os_WAIT_TIMER))  {
+    os_wake(os_timer_id, osOK, 0);
+  }
+  os_sched();
+  os_unlock(state);
+}
+
+
+// ==== Kernel Control Functions ====
+
+/// Start the RTOS Kernel with executing the specified thread.
+osStatus osKernelStart (osThreadDef_t *thread_def, void *argument)  {
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+  if (os_running != 0)  {
+    return osErrorOS;
+  }
+
+  // PendSV and SysTick at the lowest priority: the switch is done after all the ISRs
+  NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+  NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
+
+  os_idle_id = osThreadCreate(osThread(os_idle_thread), NULL);
+  os_timer_id = osThreadCreate(osThread(os_timer_thread), NULL);
+  if ((os_idle_id == NULL) || (os_timer_id == NULL) ||
+      (osThreadCreate(thread_def, argument) == NULL))  {
+    return osErrorParameter;
+  }
+
+  os_tick_reload = SystemCoreClock / osKernelTickFreq;
+  SysTick->LOAD = os_tick_reload - 1;
+  SysTick->VAL  = 0;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+  // The first switch does not save the context of main: it never runs again
+  state = os_lock();
+  os_running = 1;
+  os_sched_info.run = NULL;
+  os_sched_info.next = NULL;
+  os_sched();
+  os_unlock(state);
+
+  for (;;);
+}
+
+/// Check if the RTOS kernel is already started.
+int32_t osKernelRunning (void)  {
+  return os_running;
+}
+
+
+// ==== Thread Management ====
+
+/// Called when a thread function returns.
+static void os_thread_exit (void)  {
+  osThreadTerminate(osThreadGetId());
+  for (;;);
+}
+
+/// Create a thread and add it to Active Threads and set it to state READY.
+osThreadId osThreadCreate (osThreadDef_t *thread_def, void *argument)  {
+  struct os_thread_cb *thread = NULL;
+  uint32_t *sp;
+  uint32_t i, state;
+
+  if (os_in_isr() || (thread_def == NULL) || !os_prio_valid(thread_def->tpriority))  {
+    return NULL;
+  }
+
+  state = os_lock();
+  for (i = 0; i < thread_def->instances; i++)  {
+    if (thread_def->cb[i].state == os_INACTIVE)  {
+      thread = &thread_def->cb[i];
+      break;
+    }
+  }
+  if (thread == NULL)  {
+    os_unlock(state);
+    return NULL;
+  }
+  memset(thread, 0, sizeof(struct os_thread_cb));
+
+  // Exception frame returning to the thread function, then R4-R11
+  sp = (uint32_t *)&thread_def->stack[(i + 1) * os_stack_sz(thread_def->stacksize)];
+  *(--sp) = os_XPSR_T;
+  *(--sp) = (uint32_t)thread_def->pthread & ~1U;       // PC
+  *(--sp) = (uint32_t)os_thread_exit;                  // LR
+  *(--sp) = 0;                                         // R12
+  *(--sp) = 0;                                         // R3
+  *(--sp) = 0;                                         // R2
+  *(--sp) = 0;                                         // R1
+  *(--sp) = (uint32_t)argument;                        // R0
+  for (i = 0; i < 8; i++)  {
+    *(--sp) = 0;                                       // R11-R4
+  }
+  thread->sp = (uint32_t)sp;
+  thread->exc_return = os_EXC_RETURN;
+  thread->prio = os_prio_idx(thread_def->tpriority);
+  thread->bprio = thread->prio;
+
+  os_rdy_add(thread);
+  os_sched();
+  os_unlock(state);
+  return thread;
+}
+
+/// Return the thread ID of the current running thread.
+osThreadId osThreadGetId (void)  {
+  return os_sched_info.run;
+}
+
+/// Terminate execution of a thread and remove it from Active Threads.
+/// \note The mutexes owned by the thread are not released.
+osStatus osThreadTerminate (osThreadId thread_id)  {
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+  if ((thread_id == NULL) || (thread_id->state == os_INACTIVE) ||
+      (thread_id == os_idle_id) || (thread_id == os_timer_id))  {
+    return osErrorParameter;
+  }
+
+  state = os_lock();
+  if (thread_id->state == os_READY)  {
+    os_rdy_remove(thread_id);
+  }
+  else  {
+    if (thread_id->wlist != NULL)  {
+      os_list_remove(&thread_id->wlist->first, thread_id);
+      thread_id->wlist = NULL;
+    }
+    os_dly_remove(thread_id);
+  }
+  thread_id->state = os_INACTIVE;
+  os_sched();
+  os_unlock(state);
+  return osOK;
+}
+
+/// Pass control to next thread that is in state \b READY.
+osStatus osThreadYield (void)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+
+  state = os_lock();
+  os_rdy_remove(thread);
+  os_rdy_add(thread);
+  os_sched();
+  os_unlock(state);
+  return osOK;
+}
+
+/// Change priority of an active thread.
+osStatus osThreadSetPriority (osThreadId thread_id, osPriority priority)  {
+  uint8_t prio;
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+  if ((thread_id == NULL) || (thread_id->state == os_INACTIVE))  {
+    return osErrorParameter;
+  }
+  if (!os_prio_valid(priority))  {
+    return osErrorValue;
+  }
+
+  state = os_lock();
+  prio = os_prio_idx(priority);
+  thread_id->bprio = prio;
+  // keep a priority inherited from a mutex
+  if ((thread_id->mutexes != 0) && (thread_id->prio > prio))  {
+    prio = thread_id->prio;
+  }
+  os_prio_set(thread_id, prio);
+  os_sched();
+  os_unlock(state);
+  return osOK;
+}
+
+/// Get current priority of an active thread.
+osPriority osThreadGetPriority (osThreadId thread_id)  {
+  if ((thread_id == NULL) || (thread_id->state == os_INACTIVE))  {
+    return osPriorityError;
+  }
+  return (osPriority)((int32_t)thread_id->bprio + osPriorityIdle);
+}
+
+
+// ==== Generic Wait Functions ====
+
+/// Wait for Timeout (Time Delay)
+osStatus osDelay (uint32_t millisec)  {
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+
+  state = os_lock();
+  os_block(NULL, millisec, os_WAIT_DELAY);
+  os_unlock(state);
+  return osEventTimeout;
+}
+
+
+// ==== Idle thread ====
+
+#if (osKernelTickless != 0)
+/// Ticks until the next timeout of a thread or timer, 0xFFFFFFFF when none.
+static uint32_t os_idle_ticks (void)  {
+  uint32_t ticks = 0xFFFFFFFF;
+  int32_t  delta;
+
+  if (os_dly != NULL)  {
+    delta = (int32_t)(os_dly->wake - os_time);
+    ticks = (delta > 0) ? (uint32_t)delta : 0;
+  }
+  if (os_tmr != NULL)  {
+    delta = (int32_t)(os_tmr->expiry - os_time);
+    if (delta <= 0)  {
+      ticks = 0;
+    }
+    else if ((uint32_t)delta < ticks)  {
+      ticks = (uint32_t)delta;
+    }
+  }
+  return ticks;
+}
+
+/// Sleep with the SysTick reloaded to expire at the next timeout, then
+/// account the ticks elapsed and restart the periodic tick.
+/// \note PRIMASK is used so that a pending interrupt of any priority ends WFI.
+static void os_tickless_sleep (void)  {
+  uint32_t reload = os_tick_reload;
+  uint32_t idle, load, ctrl, val, next, elapsed;
+
+  __disable_irq();
+
+  idle = os_idle_ticks();
+  if (idle > ((SysTick_LOAD_RELOAD_Msk + 1) / reload))  {
+    idle = (SysTick_LOAD_RELOAD_Msk + 1) / reload;
+  }
+
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+  val = SysTick->VAL;                          // cycles to the next tick
+  if ((idle < 2) || (val == 0) || ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0))  {
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    __WFI();
+    __enable_irq();
+    return;
+  }
+
+  // Expire on the tick of the next timeout
+  load = val + ((idle - 1) * reload);
+  SysTick->LOAD = load - 1;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+  __DSB();
+  __WFI();
+  __ISB();
+
+  ctrl = SysTick->CTRL;                        // reading clears COUNTFLAG
+  SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+  val = SysTick->VAL;
+
+  if (((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0) || (val == 0))  {
+    // Slept until the timeout: the pending SysTick interrupt counts the last tick
+    elapsed = idle - 1;
+    val = (load - 1) - val;                    // cycles since the expiry
+    next = (val < (reload - 1)) ? (reload - val) : reload;
+  }
+  else  {
+    // Woken up by another interrupt: val cycles remain until the timeout tick
+    elapsed = idle - ((val + reload - 1) / reload);
+    next = ((val - 1) % reload) + 1;
+    if (next < 2)  {
+      elapsed++;
+      next += reload;
+    }
+  }
+
+  // Next tick after 'next' cycles, then the periodic tick again
+  SysTick->LOAD = next - 1;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  SysTick->LOAD = reload - 1;
+
+  os_time += elapsed;
+  __enable_irq();
+}
+#endif
+
+/// Idle thread: runs when no other thread is ready.
+static void os_idle_thread (void const *argument)  {
+  (void)argument;
+
+  for (;;)  {
+    if (os_idle_id->next != os_idle_id)  {
+      // other threads of the idle priority are ready
+      osThreadYield();
+    }
+    else  {
+#if (osKernelTickless != 0)
+      os_tickless_sleep();
+#else
+      __WFI();
+#endif
+    }
+  }
+}
+
+
+// ==== Timer Management Functions ====
+
+/// Insert a timer in the list of the running timers.
+static void os_tmr_add (struct os_timer_cb *timer)  {
+  struct os_timer_cb *p = os_tmr;
+  struct os_timer_cb *prev = NULL;
+
+  while ((p != NULL) && ((int32_t)(p->expiry - timer->expiry) <= 0))  {
+    prev = p;
+    p = p->next;
+  }
+  timer->next = p;
+  timer->prev = prev;
+  if (p != NULL)  {
+    p->prev = timer;
+  }
+  if (prev != NULL)  {
+    prev->next = timer;
+  }
+  else  {
+    os_tmr = timer;
+  }
+  timer->running = 1;
+}
+
+/// Remove a timer from the list of the running timers.
+static void os_tmr_remove (struct os_timer_cb *timer)  {
+  if (timer->prev != NULL)  {
+    timer->prev->next = timer->next;
+  }
+  else  {
+    os_tmr = timer->next;
+  }
+  if (timer->next != NULL)  {
+    timer->next->prev = timer->prev;
+  }
+  timer->next = NULL;
+  timer->prev = NULL;
+  timer->running = 0;
+}
+
+/// Timer thread: runs the call backs of the timers expired.
+static void os_timer_thread (void const *argument)  {
+  struct os_timer_cb *timer;
+  os_ptimer ptimer;
+  void *timer_argument;
+  uint32_t state;
+
+  (void)argument;
+
+  for (;;)  {
+    state = os_lock();
+    timer = os_tmr;
+    if ((timer != NULL) && ((int32_t)(timer->expiry - os_time) <= 0))  {
+      os_tmr_remove(timer);
+      if (timer->type == osTimerPeriodic)  {
+        // keep the phase of the period
+        timer->expiry += timer->period;
+        os_tmr_add(timer);
+      }
+      ptimer = timer->ptimer;
+      timer_argument = timer->argument;
+      os_unlock(state);
+      ptimer(timer_argument);
+    }
+    else  {
+      os_block(NULL, osWaitForever, os_WAIT_TIMER);
+      os_unlock(state);
+    }
+  }
+}
+
+/// Create a timer.
+/// \note A timer definition holds one timer: creating it again stops and reinitializes it.
+osTimerId osTimerCreate (osTimerDef_t *timer_def, os_timer_type type, void *argument)  {
+  struct os_timer_cb *timer;
+  uint32_t state;
+
+  if (os_in_isr() || (timer_def == NULL) || (timer_def->ptimer == NULL))  {
+    return NULL;
+  }
+
+  timer = timer_def->cb;
+  state = os_lock();
+  if (timer->running != 0)  {
+    os_tmr_remove(timer);
+  }
+  timer->ptimer = timer_def->ptimer;
+  timer->type = (uint32_t)type;
+  timer->argument = argument;
+  timer->period = 0;
+  os_unlock(state);
+  return timer;
+}
+
+/// Start or restart a timer.
+osStatus osTimerStart (osTimerId timer_id, uint32_t millisec)  {
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+  if ((timer_id == NULL) || (timer_id->ptimer == NULL))  {
+    return osErrorParameter;
+  }
+  if (millisec == 0)  {
+    return osErrorValue;
+  }
+
+  state = os_lock();
+  if (timer_id->running != 0)  {
+    os_tmr_remove(timer_id);
+  }
+  timer_id->period = os_ms2ticks(millisec);
+  timer_id->expiry = os_time + timer_id->period;
+  os_tmr_add(timer_id);
+  os_unlock(state);
+  return osOK;
+}
+
+/// Stop the timer.
+osStatus osTimerStop (osTimerId timer_id)  {
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+  if (timer_id == NULL)  {
+    return osErrorParameter;
+  }
+
+  state = os_lock();
+  if (timer_id->running == 0)  {
+    os_unlock(state);
+    return osErrorResource;
+  }
+  os_tmr_remove(timer_id);
+  os_unlock(state);
+  return osOK;
+}
+
+
+// ==== Signal Management ====
+
+/// Signal flags satisfying a wait for 'signals' (0: any flag), or 0.
+static int32_t os_signal_match (int32_t flags, int32_t signals)  {
+  if (signals == 0)  {
+    return flags;
+  }
+  return ((flags & signals) == signals) ? signals : 0;
+}
+
+/// Set the specified Signal Flags of an active thread.
+int32_t osSignalSet (osThreadId thread_id, int32_t signal)  {
+  int32_t prev, match;
+  uint32_t state;
+
+  if ((thread_id == NULL) || (thread_id->state == os_INACTIVE) || ((signal & ~os_SIGNAL_MASK) != 0))  {
+    return (int32_t)0x80000000;
+  }
+
+  state = os_lock();
+  prev = thread_id->signals;
+  thread_id->signals |= signal;
+  if (thread_id->state == os_WAIT_SIGNAL)  {
+    match = os_signal_match(thread_id->signals, thread_id->waits);
+    if (match != 0)  {
+      thread_id->signals &= ~match;
+      os_wake(thread_id, osEventSignal, (uint32_t)match);
+      os_sched();
+    }
+  }
+  os_unlock(state);
+  return prev;
+}
+
+/// Clear the specified Signal Flags of an active thread.
+int32_t osSignalClear (osThreadId thread_id, int32_t signal)  {
+  int32_t prev;
+  uint32_t state;
+
+  if ((thread_id == NULL) || (thread_id->state == os_INACTIVE) || ((signal & ~os_SIGNAL_MASK) != 0))  {
+    return (int32_t)0x80000000;
+  }
+
+  state = os_lock();
+  prev = thread_id->signals;
+  thread_id->signals &= ~signal;
+  os_unlock(state);
+  return prev;
+}
+
+/// Get Signal Flags status of an active thread.
+int32_t osSignalGet (osThreadId thread_id)  {
+  if ((thread_id == NULL) || (thread_id->state == os_INACTIVE))  {
+    return (int32_t)0x80000000;
+  }
+  return thread_id->signals;
+}
+
+/// Wait for one or more Signal Flags to become signaled for the current \b RUNNING thread.
+osEvent osSignalWait (int32_t signals, uint32_t millisec)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  osEvent event;
+  int32_t match;
+  uint32_t state;
+
+  event.value.signals = 0;
+  event.def.message_id = NULL;
+  if (os_in_isr())  {
+    event.status = osErrorISR;
+    return event;
+  }
+  if ((signals & ~os_SIGNAL_MASK) != 0)  {
+    event.status = osErrorValue;
+    return event;
+  }
+
+  state = os_lock();
+  match = os_signal_match(thread->signals, signals);
+  if (match != 0)  {
+    thread->signals &= ~match;
+    os_unlock(state);
+    event.status = osEventSignal;
+    event.value.signals = match;
+    return event;
+  }
+  if (millisec == 0)  {
+    os_unlock(state);
+    event.status = osOK;
+    return event;
+  }
+  thread->waits = signals;
+  os_block(NULL, millisec, os_WAIT_SIGNAL);
+  os_unlock(state);
+
+  event.status = (osStatus)thread->status;
+  event.value.signals = (int32_t)thread->ret;
+  return event;
+}
+
+
+// ==== Mutex Management ====
+
+/// Create and Initialize a Mutex object
+osMutexId osMutexCreate (osMutexDef_t *mutex_def)  {
+  if (os_in_isr() || (mutex_def == NULL))  {
+    return NULL;
+  }
+  memset(mutex_def->cb, 0, sizeof(struct os_mutex_cb));
+  return mutex_def->cb;
+}
+
+/// Wait until a Mutex becomes available.
+/// \note The owner inherits the priority of the waiting threads.
+osStatus osMutexWait (osMutexId mutex_id, uint32_t millisec)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+  if (mutex_id == NULL)  {
+    return osErrorParameter;
+  }
+
+  state = os_lock();
+  if (mutex_id->owner == NULL)  {
+    mutex_id->owner = thread;
+    mutex_id->count = 1;
+    thread->mutexes++;
+    os_unlock(state);
+    return osOK;
+  }
+  if (mutex_id->owner == thread)  {
+    mutex_id->count++;
+    os_unlock(state);
+    return osOK;
+  }
+  if (millisec == 0)  {
+    os_unlock(state);
+    return osErrorResource;
+  }
+  if (mutex_id->owner->prio < thread->prio)  {
+    os_prio_set(mutex_id->owner, thread->prio);
+  }
+  os_block(&mutex_id->wlist, millisec, os_WAIT_OBJECT);
+  os_unlock(state);
+
+  return (thread->status == osOK) ? osOK : osErrorTimeoutResource;
+}
+
+/// Release a Mutex that was obtained by \ref osMutexWait
+osStatus osMutexRelease (osMutexId mutex_id)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  struct os_thread_cb *next;
+  uint32_t state;
+
+  if (os_in_isr())  {
+    return osErrorISR;
+  }
+  if (mutex_id == NULL)  {
+    return osErrorParameter;
+  }
+
+  state = os_lock();
+  if (mutex_id->owner != thread)  {
+    os_unlock(state);
+    return osErrorResource;
+  }
+  if (--mutex_id->count == 0)  {
+    // the inherited priority is kept until the last mutex is released
+    thread->mutexes--;
+    if (thread->mutexes == 0)  {
+      os_prio_set(thread, thread->bprio);
+    }
+    next = mutex_id->wlist.first;
+    mutex_id->owner = next;
+    if (next != NULL)  {
+      mutex_id->count = 1;
+      next->mutexes++;
+      os_wake(next, osOK, 0);
+    }
+    os_sched();
+  }
+  os_unlock(state);
+  return osOK;
+}
+
+
+// ==== Semaphore Management Functions ====
+
+/// Create and Initialize a Semaphore object used for managing resources
+osSemaphoreId osSemaphoreCreate (osSemaphoreDef_t *semaphore_def, int32_t count)  {
+  if (os_in_isr() || (semaphore_def == NULL) || (count < 0) || (count > osFeature_Semaphore))  {
+    return NULL;
+  }
+  semaphore_def->cb->wlist.first = NULL;
+  semaphore_def->cb->count = (uint32_t)count;
+  return semaphore_def->cb;
+}
+
+/// Wait until a Semaphore token becomes available
+/// \return tokens available before the call (> 0) when a token is taken, 0 on timeout.
+int32_t osSemaphoreWait (osSemaphoreId semaphore_id, uint32_t millisec)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  uint32_t state, count;
+
+  if (os_in_isr() || (semaphore_id == NULL))  {
+    return -1;
+  }
+
+  state = os_lock();
+  count = semaphore_id->count;
+  if (count != 0)  {
+    semaphore_id->count = count - 1;
+    os_unlock(state);
+    return (int32_t)count;
+  }
+  if (millisec == 0)  {
+    os_unlock(state);
+    return 0;
+  }
+  os_block(&semaphore_id->wlist, millisec, os_WAIT_OBJECT);
+  os_unlock(state);
+
+  return (thread->status == osOK) ? (int32_t)thread->ret : 0;
+}
+
+/// Release a Semaphore token
+osStatus osSemaphoreRelease (osSemaphoreId semaphore_id)  {
+  uint32_t state;
+  osStatus status = osOK;
+
+  if (semaphore_id == NULL)  {
+    return osErrorParameter;
+  }
+
+  state = os_lock();
+  if (semaphore_id->wlist.first != NULL)  {
+    // the token goes to the waiting thread of the highest priority
+    os_wake(semaphore_id->wlist.first, osOK, 1);
+    os_sched();
+  }
+  else if (semaphore_id->count < osFeature_Semaphore)  {
+    semaphore_id->count++;
+  }
+  else  {
+    status = osErrorResource;
+  }
+  os_unlock(state);
+  return status;
+}
+
+
+// ==== Memory Pool Management Functions ====
+
+// The osPool functions and the block lists are in os_pool.c
+
+/// Give a mail block to the first waiting thread, or put it back in the free list.
+static void os_pool_put (struct os_pool_cb *pool, void *block)  {
+  if (pool->wlist.first != NULL)  {
+    os_wake(pool->wlist.first, osOK, (uint32_t)block);
+    os_sched();
+  }
+  else  {
+    os_pool_release(pool, block);
+  }
+}
+
+
+// ==== Message Queue Management Functions ====
+
+/// Initialize an empty queue.
+static void os_queue_init (struct os_messageQ_cb *queue, uint32_t *ring, uint32_t size)  {
+  queue->wlist.first = NULL;
+  queue->ring = ring;
+  queue->size = size;
+  queue->count = 0;
+  queue->in = 0;
+  queue->out = 0;
+}
+
+/// Put a value in a queue, or give it to the waiting thread.
+/// \param[in]     event         status passed to the waiting thread.
+static osStatus os_queue_put (struct os_messageQ_cb *queue, uint32_t info, uint32_t millisec, osStatus event)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  uint32_t state;
+
+  state = os_lock();
+  if ((queue->count == 0) && (queue->wlist.first != NULL))  {
+    // threads waiting on an empty queue are receivers
+    os_wake(queue->wlist.first, event, info);
+    os_sched();
+  }
+  else if (queue->count < queue->size)  {
+    queue->ring[queue->in] = info;
+    queue->in = (queue->in + 1 == queue->size) ? 0 : queue->in + 1;
+    queue->count++;
+  }
+  else if ((millisec == 0) || os_in_isr())  {
+    os_unlock(state);
+    return osErrorResource;
+  }
+  else  {
+    // wait for room; the receiver takes 'ret'
+    thread->ret = info;
+    os_block(&queue->wlist, millisec, os_WAIT_OBJECT);
+    os_unlock(state);
+    return (thread->status == osOK) ? osOK : osErrorTimeoutResource;
+  }
+  os_unlock(state);
+  return osOK;
+}
+
+/// Get a value from a queue, or wait for it.
+/// \param[in]     event         status of the event returned with a value.
+static osEvent os_queue_get (struct os_messageQ_cb *queue, uint32_t millisec, osStatus event)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  struct os_thread_cb *sender;
+  osEvent result;
+  uint32_t state;
+
+  result.value.v = 0;
+  state = os_lock();
+  if (queue->count != 0)  {
+    result.value.v = queue->ring[queue->out];
+    queue->out = (queue->out + 1 == queue->size) ? 0 : queue->out + 1;
+    queue->count--;
+    result.status = event;
+
+    // threads waiting on a full queue are senders: take the message of the first one
+    sender = queue->wlist.first;
+    if (sender != NULL)  {
+      queue->ring[queue->in] = sender->ret;
+      queue->in = (queue->in + 1 == queue->size) ? 0 : queue->in + 1;
+      queue->count++;
+      os_wake(sender, osOK, 0);
+      os_sched();
+    }
+  }
+  else if ((millisec == 0) || os_in_isr())  {
+    result.status = osOK;
+  }
+  else  {
+    os_block(&queue->wlist, millisec, os_WAIT_OBJECT);
+    os_unlock(state);
+    result.status = (osStatus)thread->status;
+    result.value.v = thread->ret;
+    return result;
+  }
+  os_unlock(state);
+  return result;
+}
+
+/// Create and Initialize a Message Queue.
+/// \note \a thread_id is not used.
+osMessageQId osMessageCreate (osMessageQDef_t *queue_def, osThreadId thread_id)  {
+  (void)thread_id;
+
+  if (os_in_isr() || (queue_def == NULL) || (queue_def->queue_sz == 0))  {
+    return NULL;
+  }
+  os_queue_init(queue_def->cb, (uint32_t *)queue_def->pool, queue_def->queue_sz);
+  return queue_def->cb;
+}
+
+/// Put a Message to a Queue.
+/// \note From an ISR, the call never waits: osErrorResource is returned when the queue is full.
+osStatus osMessagePut (osMessageQId queue_id, uint32_t info, uint32_t millisec)  {
+  if (queue_id == NULL)  {
+    return osErrorParameter;
+  }
+  return os_queue_put(queue_id, info, millisec, osEventMessage);
+}
+
+/// Get a Message or Wait for a Message from a Queue.
+osEvent osMessageGet (osMessageQId queue_id, uint32_t millisec)  {
+  osEvent event;
+
+  if (queue_id == NULL)  {
+    event.status = osErrorParameter;
+    event.value.v = 0;
+  }
+  else  {
+    event = os_queue_get(queue_id, millisec, osEventMessage);
+  }
+  event.def.message_id = queue_id;
+  return event;
+}
+
+
+// ==== Mail Queue Management Functions ====
+
+/// Create and Initialize mail queue
+/// \note \a thread_id is not used.
+osMailQId osMailCreate (osMailQDef_t *queue_def, osThreadId thread_id)  {
+  (void)thread_id;
+
+  if (os_in_isr() || (queue_def == NULL) || (queue_def->queue_sz == 0) || (queue_def->item_sz == 0))  {
+    return NULL;
+  }
+  os_pool_init(&queue_def->cb->pool, queue_def->pool, queue_def->queue_sz, queue_def->item_sz);
+  os_queue_init(&queue_def->cb->queue, queue_def->ring, queue_def->queue_sz);
+  return queue_def->cb;
+}
+
+/// Allocate a memory block from a mail
+void *osMailAlloc (osMailQId queue_id, uint32_t millisec)  {
+  struct os_thread_cb *thread = os_sched_info.run;
+  void *block;
+  uint32_t state;
+
+  if (queue_id == NULL)  {
+    return NULL;
+  }
+
+  state = os_lock();
+  block = os_pool_get(&queue_id->pool);
+  if ((block == NULL) && (millisec != 0) && !os_in_isr())  {
+    // osMailFree gives the block to the waiting thread
+    os_block(&queue_id->pool.wlist, millisec, os_WAIT_OBJECT);
+    os_unlock(state);
+    return (thread->status == osOK) ? (void *)thread->ret : NULL;
+  }
+  os_unlock(state);
+  return block;
+}
+
+/// Allocate a memory block from a mail and set memory block to zero
+void *osMailCAlloc (osMailQId queue_id, uint32_t millisec)  {
+  void *block = osMailAlloc(queue_id, millisec);
+
+  if (block != NULL)  {
+    memset(block, 0, queue_id->pool.blk_sz * sizeof(uint32_t));
+  }
+  return block;
+}
+
+/// Put a mail to a queue
+osStatus osMailPut (osMailQId queue_id, void *mail)  {
+  if (queue_id == NULL)  {
+    return osErrorParameter;
+  }
+  if (!os_pool_valid(&queue_id->pool, mail))  {
+    return osErrorValue;
+  }
+  // the queue has room for all the blocks of the pool
+  return os_queue_put(&queue_id->queue, (uint32_t)mail, 0, osEventMail);
+}
+
+/// Get a mail from a queue
+osEvent osMailGet (osMailQId queue_id, uint32_t millisec)  {
+  osEvent event;
+
+  if (queue_id == NULL)  {
+    event.status = osErrorParameter;
+    event.value.v = 0;
+  }
+  else  {
+    event = os_queue_get(&queue_id->queue, millisec, osEventMail);
+  }
+  event.def.mail_id = queue_id;
+  return event;
+}
+
+/// Free a memory block from a mail
+osStatus osMailFree (osMailQId queue_id, void *mail)  {
+  uint32_t state;
+
+  if (queue_id == NULL)  {
+    return osErrorParameter;
+  }
+  if (!os_pool_valid(&queue_id->pool, mail))  {
+    return osErrorValue;
+  }
+
+  state = os_lock();
+  os_pool_put(&queue_id->pool, mail);
+  os_unlock(state);
+  return osOK;
+}
@@ -111,12 +111,37 @@ used throughout the whole project.
 #define osFeature_MailQ        1       ///< Mail Queues:     1=available, 0=not available
 #define osFeature_MessageQ     1       ///< Message Queues:  1=available, 0=not available
 #define osFeature_Signals      8       ///< maximum number of Signal Flags available per thread
-#define osFeature_Semaphore    30      ///< maximum count for SemaphoreInit function
-#define osFeature_Wait         1       ///< osWait function: 1=available, 0=not available
+#define osFeature_Semaphore    65535   ///< maximum count for SemaphoreInit function
+#define osFeature_Wait         0       ///< osWait function: 1=available, 0=not available
                                     
 #include <stdint.h>
 #include <stddef.h>
 
+/// \note CAN BE CHANGED: configuration of the reference kernel in cmsis_os.c. The values
+///       can be defined in the compiler preprocessor.
+#ifndef osKernelTickFreq
+#define osKernelTickFreq       1000    ///< SysTick frequency in Hz
+#endif
+#ifndef osKernelStackSize
+#define osKernelStackSize      512     ///< stack size in bytes of the threads defined with stacksz = 0
+#endif
+#ifndef osKernelIdleStackSize
+#define osKernelIdleStackSize  256     ///< stack size in bytes of the idle thread
+#endif
+#ifndef osKernelTimerStackSize
+#define osKernelTimerStackSize 512     ///< stack size in bytes of the thread running the timer call backs
+#endif
+#ifndef osKernelTimerPriority
+#define osKernelTimerPriority  osPriorityHigh  ///< priority of the thread running the timer call backs
+#endif
+#ifndef osKernelTickless
+#define osKernelTickless       1       ///< 1=the idle thread stops the periodic tick until the next timeout
+#endif
+#ifndef osKernelBasePri
+#define osKernelBasePri        0       ///< BASEPRI value of the kernel critical sections, 0=PRIMASK is used.
+                                       ///< The ISRs of a higher priority must not call the kernel.
+#endif
+
 #ifdef  __cplusplus
 extern "C"
 {
@@ -209,6 +234,116 @@ typedef struct os_messageQ_cb *osMessageQId;
 typedef struct os_mailQ_cb *osMailQId;
 
 
+// >>> control blocks of the reference kernel in cmsis_os.c, not to be accessed by the application
+
+/// Threads waiting for an object, sorted by priority.
+typedef struct os_wlist  {
+  struct os_thread_cb       *first;    ///< waiting thread of the highest priority, or NULL
+} os_wlist;
+
+/// Thread control block.
+struct os_thread_cb  {
+  uint32_t                      sp;    ///< saved stack pointer (offset 0, used by PendSV)
+  uint32_t              exc_return;    ///< saved EXC_RETURN (offset 4, bit 4 clear with a FPU context)
+  struct os_thread_cb        *next;    ///< ready list or wait list
+  struct os_thread_cb        *prev;
+  struct os_thread_cb       *dnext;    ///< delay list, sorted by wake-up tick
+  struct os_thread_cb       *dprev;
+  os_wlist                  *wlist;    ///< wait list of the object the thread waits for, or NULL
+  uint32_t                    wake;    ///< wake-up tick of the timeout
+  uint8_t                    state;    ///< thread state
+  uint8_t                     prio;    ///< current priority, raised by the mutexes owned
+  uint8_t                    bprio;    ///< base priority
+  uint8_t                  mutexes;    ///< number of mutexes owned
+  int32_t                  signals;    ///< signal flags
+  int32_t                    waits;    ///< signal flags waited for
+  uint32_t                     ret;    ///< value passed to the waiting thread
+  int32_t                   status;    ///< status passed to the waiting thread
+};
+
+/// Timer control block.
+struct os_timer_cb  {
+  struct os_timer_cb         *next;    ///< running timers, sorted by expiry tick
+  struct os_timer_cb         *prev;
+  uint32_t                  expiry;    ///< tick of the next expiry
+  uint32_t                  period;    ///< period in ticks
+  uint32_t                    type;    ///< osTimerOnce or osTimerPeriodic
+  uint32_t                 running;    ///< 1=in the list of the running timers
+  void                   *argument;    ///< argument of the call back function
+  os_ptimer                 ptimer;    ///< call back function
+};
+
+/// Mutex control block.
+struct os_mutex_cb  {
+  os_wlist                   wlist;    ///< waiting threads
+  struct os_thread_cb       *owner;    ///< owner thread, or NULL
+  uint32_t                   count;    ///< nested acquisitions by the owner
+};
+
+/// Semaphore control block.
+struct os_semaphore_cb  {
+  os_wlist                   wlist;    ///< waiting threads
+  uint32_t                   count;    ///< available tokens
+};
+
+/// Memory pool control block.
+struct os_pool_cb  {
+  os_wlist                   wlist;    ///< threads waiting for a block (mail queues)
+  void                       *free;    ///< first free block, linked by their first word
+  uint32_t                   *base;    ///< first block
+  uint32_t                    *end;    ///< end of the blocks
+  uint32_t                  blk_sz;    ///< size of a block in words
+};
+
+/// Message queue control block.
+struct os_messageQ_cb  {
+  os_wlist                   wlist;    ///< threads waiting for a message when empty, or for room when full
+  uint32_t                   *ring;    ///< messages
+  uint32_t                    size;    ///< number of elements in the queue
+  uint32_t                   count;    ///< messages in the queue
+  uint32_t                      in;    ///< next element written
+  uint32_t                     out;    ///< next element read
+};
+
+/// Mail queue control block.
+struct os_mailQ_cb  {
+  struct os_pool_cb           pool;    ///< mail blocks
+  struct os_messageQ_cb      queue;    ///< addresses of the mails put
+};
+
+/// Stack size of a thread in 64-bit words.
+#define os_stack_sz(stacksz)   (((((stacksz) != 0) ? (stacksz) : osKernelStackSize) + 7) / 8)
+
+/// Size of a memory pool block in 32-bit words.
+#define os_pool_blk_sz(item_sz)  (((item_sz) + 3) / 4)
+
+/// Size of a memory pool item rounded up to an alignment in bytes (a power of 2, at least 4).
+#define os_pool_item_sz(item_sz, align)  (((item_sz) + (align) - 1) & ~((uint32_t)(align) - 1))
+
+/// Placement of the memory of a pool defined with \ref osPoolDefEx: the alignment
+/// of the first block, and the region os_region_SRAM or os_region_CCM.
+/// The CCM data RAM of STM32F4xx is zeroed by the startup code in the .ccmbss section.
+/// Where the compiler has no section placement, os_region_CCM keeps the pool in SRAM.
+#if defined (__CC_ARM)
+#define os_align(n)            __attribute__((aligned(n)))
+#define os_region_SRAM
+#define os_region_CCM          __attribute__((section(".ccmbss"), zero_init))
+#elif defined (__GNUC__)
+#define os_align(n)            __attribute__((aligned(n)))
+#define os_region_SRAM
+#define os_region_CCM          __attribute__((section(".ccmbss")))
+#elif defined (__ICCARM__)
+#define os_pragma(x)           _Pragma(#x)
+#define os_align(n)            os_pragma(data_alignment = n)
+#define os_region_SRAM
+#define os_region_CCM          os_pragma(location = ".ccmbss")
+#elif defined (__TASKING__)
+#define os_align(n)            __align(n)
+#define os_region_SRAM
+#define os_region_CCM
+#endif
+
+
 /// Thread Definition structure contains startup information of a thread.
 /// \note CAN BE CHANGED: \b os_thread_def is implementation specific in every CMSIS-RTOS.
 typedef const struct os_thread_def  {
@@ -216,24 +351,27 @@ typedef const struct os_thread_def  {
   osPriority             tpriority;    ///< initial thread priority
   uint32_t               instances;    ///< maximum number of instances of that thread function
   uint32_t               stacksize;    ///< stack size requirements in bytes; 0 is default stack size
+  struct os_thread_cb          *cb;    ///< control blocks of the instances
+  uint64_t                  *stack;    ///< stacks of the instances
 } osThreadDef_t;
 
 /// Timer Definition structure contains timer parameters.
 /// \note CAN BE CHANGED: \b os_timer_def is implementation specific in every CMSIS-RTOS.
 typedef const struct os_timer_def  {
   os_ptimer                 ptimer;    ///< start address of a timer function
+  struct os_timer_cb           *cb;    ///< control block
 } osTimerDef_t;
 
 /// Mutex Definition structure contains setup information for a mutex.
 /// \note CAN BE CHANGED: \b os_mutex_def is implementation specific in every CMSIS-RTOS.
 typedef const struct os_mutex_def  {
-  uint32_t                   dummy;    ///< dummy value.
+  struct os_mutex_cb           *cb;    ///< control block
 } osMutexDef_t;
 
 /// Semaphore Definition structure contains setup information for a semaphore.
 /// \note CAN BE CHANGED: \b os_semaphore_def is implementation specific in every CMSIS-RTOS.
 typedef const struct os_semaphore_def  {
-  uint32_t                   dummy;    ///< dummy value.
+  struct os_semaphore_cb       *cb;    ///< control block
 } osSemaphoreDef_t;
 
 /// Definition structure for memory block allocation
@@ -242,6 +380,7 @@ typedef const struct os_pool_def  {
   uint32_t                 pool_sz;    ///< number of items (elements) in the pool
   uint32_t                 item_sz;    ///< size of an item 
   void                       *pool;    ///< pointer to memory for pool
+  struct os_pool_cb            *cb;    ///< control block
 } osPoolDef_t;
 
 /// Definition structure for message queue
@@ -250,6 +389,7 @@ typedef const struct os_messageQ_def  {
   uint32_t                queue_sz;    ///< number of elements in the queue
   uint32_t                 item_sz;    ///< size of an item 
   void                       *pool;    ///< memory array for messages
+  struct os_messageQ_cb        *cb;    ///< control block
 } osMessageQDef_t;
 
 /// Definition structure for mail queue
@@ -258,6 +398,8 @@ typedef const struct os_mailQ_def  {
   uint32_t                queue_sz;    ///< number of elements in the queue
   uint32_t                 item_sz;    ///< size of an item 
   void                       *pool;    ///< memory array for mail
+  uint32_t                   *ring;    ///< memory array for the addresses of the mails put
+  struct os_mailQ_cb           *cb;    ///< control block
 } osMailQDef_t;
 
 /// Event structure contains detailed information about an event. 
@@ -306,8 +448,10 @@ int32_t osKernelRunning(void);
 extern osThreadDef_t os_thread_def_##name
 #else                            // define the object
 #define osThreadDef(name, priority, instances, stacksz)  \
+static struct os_thread_cb os_thread_cb_##name[instances]; \
+static uint64_t os_thread_stack_##name[(instances) * os_stack_sz(stacksz)]; \
 osThreadDef_t os_thread_def_##name = \
-{ (name), (priority), (instances), (stacksz)  }
+{ (name), (priority), (instances), (stacksz), os_thread_cb_##name, os_thread_stack_##name }
 #endif
 
 /// Access a Thread defintion.
@@ -385,8 +529,9 @@ osEvent osWait (uint32_t millisec);
 extern osTimerDef_t os_timer_def_##name
 #else                            // define the object
 #define osTimerDef(name, function)  \
+static struct os_timer_cb os_timer_cb_##name; \
 osTimerDef_t os_timer_def_##name = \
-{ (function) }
+{ (function), &os_timer_cb_##name }
 #endif
 
 /// Access a Timer definition.
@@ -459,7 +604,8 @@ osEvent osSignalWait (int32_t signals, uint32_t millisec);
 extern osMutexDef_t os_mutex_def_##name
 #else                            // define the object
 #define osMutexDef(name)  \
-osMutexDef_t os_mutex_def_##name = { 0 }
+static struct os_mutex_cb os_mutex_cb_##name; \
+osMutexDef_t os_mutex_def_##name = { &os_mutex_cb_##name }
 #endif
 
 /// Access a Mutex defintion.
@@ -502,7 +648,8 @@ osStatus osMutexRelease (osMutexId mutex_id);
 extern osSemaphoreDef_t os_semaphore_def_##name
 #else                            // define the object
 #define osSemaphoreDef(name)  \
-osSemaphoreDef_t os_semaphore_def_##name = { 0 }
+static struct os_semaphore_cb os_semaphore_cb_##name; \
+osSemaphoreDef_t os_semaphore_def_##name = { &os_semaphore_cb_##name }
 #endif
 
 /// Access a Semaphore definition.
@@ -549,8 +696,51 @@ osStatus osSemaphoreRelease (osSemaphoreId semaphore_id);
 extern osPoolDef_t os_pool_def_##name
 #else                            // define the object
 #define osPoolDef(name, no, type)   \
+static uint32_t os_pool_m_##name[(no) * os_pool_blk_sz(sizeof(type))]; \
+static struct os_pool_cb os_pool_cb_##name; \
+osPoolDef_t os_pool_def_##name = \
+{ (no), sizeof(type), os_pool_m_##name, &os_pool_cb_##name }
+#endif
+
+/// \brief Define a Memory Pool with aligned blocks in a given memory region.
+/// \param         name          name of the memory pool.
+/// \param         no            maximum number of objects (elements) in the memory pool.
+/// \param         type          data type of a single object (element).
+/// \param         align         alignment in bytes of every block: a power of 2, at least 4.
+///                              Use 16 for DMA buffers read or written in bursts of 4 words.
+/// \param         region        SRAM, or CCM for the CCM data RAM of STM32F4xx.
+/// \note The DMA and the USB OTG cannot access the CCM data RAM: CCM is only for the
+///       buffers used by the CPU, such as the state buffers of the DSP instances.
+/// \note Implementation specific: \b osPoolDefEx is an extension of this CMSIS-RTOS.
+#if defined (osObjectsExternal)  // object is external
+#define osPoolDefEx(name, no, type, align, region)   \
+extern osPoolDef_t os_pool_def_##name
+#else                            // define the object
+#define osPoolDefEx(name, no, type, align, region)   \
+os_align(align) os_region_##region \
+static uint32_t os_pool_m_##name[(no) * os_pool_blk_sz(os_pool_item_sz(sizeof(type), align))]; \
+static struct os_pool_cb os_pool_cb_##name; \
 osPoolDef_t os_pool_def_##name = \
-{ (no), sizeof(type), NULL }
+{ (no), os_pool_item_sz(sizeof(type), align), os_pool_m_##name, &os_pool_cb_##name }
+#endif
+
+/// \brief Define a Memory Pool in a memory not allocated by the compiler, such as an external
+///        SRAM of the FSMC.
+/// \param         name          name of the memory pool.
+/// \param         no            maximum number of objects (elements) in the memory pool.
+/// \param         type          data type of a single object (element).
+/// \param         address       constant address of the pool memory, aligned on 4 bytes, with room
+///                              for no * os_pool_blk_sz(sizeof(type)) words.
+/// \note The memory must be accessible when \ref osPoolCreate is called.
+/// \note Implementation specific: \b osPoolDefAt is an extension of this CMSIS-RTOS.
+#if defined (osObjectsExternal)  // object is external
+#define osPoolDefAt(name, no, type, address)   \
+extern osPoolDef_t os_pool_def_##name
+#else                            // define the object
+#define osPoolDefAt(name, no, type, address)   \
+static struct os_pool_cb os_pool_cb_##name; \
+osPoolDef_t os_pool_def_##name = \
+{ (no), sizeof(type), (void *)(address), &os_pool_cb_##name }
 #endif
 
 /// \brief Access a Memory Pool definition.
@@ -585,6 +775,12 @@ void *osPoolCAlloc (osPoolId pool_id);
 /// \note MUST REMAIN UNCHANGED: \b osPoolFree shall be consistent in every CMSIS-RTOS.
 osStatus osPoolFree (osPoolId pool_id, void *block);
 
+/// \note CAN BE CHANGED: block lists of os_pool.c, shared with the mail queues of the kernel.
+void os_pool_init (struct os_pool_cb *pool, void *memory, uint32_t blocks, uint32_t item_sz);
+void *os_pool_get (struct os_pool_cb *pool);
+void os_pool_release (struct os_pool_cb *pool, void *block);
+int32_t os_pool_valid (struct os_pool_cb *pool, void *block);
+
 #endif   // Memory Pool Management available
 
 
@@ -603,8 +799,10 @@ osStatus osPoolFree (osPoolId pool_id, void *block);
 extern osMessageQDef_t os_messageQ_def_##name
 #else                            // define the object
 #define osMessageQDef(name, queue_sz, type)   \
+static uint32_t os_messageQ_m_##name[queue_sz]; \
+static struct os_messageQ_cb os_messageQ_cb_##name; \
 osMessageQDef_t os_messageQ_def_##name = \
-{ (queue_sz), sizeof (type)  }
+{ (queue_sz), sizeof (type), os_messageQ_m_##name, &os_messageQ_cb_##name }
 #endif
 
 /// \brief Access a Message Queue Definition.
@@ -654,8 +852,11 @@ osEvent osMessageGet (osMessageQId queue_id, uint32_t millisec);
 extern osMailQDef_t os_mailQ_def_##name
 #else                            // define the object
 #define osMailQDef(name, queue_sz, type) \
+static uint32_t os_mailQ_m_##name[(queue_sz) * os_pool_blk_sz(sizeof(type))]; \
+static uint32_t os_mailQ_q_##name[queue_sz]; \
+static struct os_mailQ_cb os_mailQ_cb_##name; \
 osMailQDef_t os_mailQ_def_##name =  \
-{ (queue_sz), sizeof (type) }
+{ (queue_sz), sizeof (type), os_mailQ_m_##name, os_mailQ_q_##name, &os_mailQ_cb_##name }
 #endif
      
 /// \brief Access a Mail Queue Definition
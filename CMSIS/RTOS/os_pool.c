@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------
+ * $Date:        5. March 2012
+ * $Revision:    V0.03
+ *
+ * Project:      CMSIS-RTOS API
+ * Title:        os_pool.c fixed-block memory pools
+ *
+ * The osPool functions of cmsis_os.h, usable with the reference kernel
+ * of cmsis_os.c or alone, in an application without RTOS:
+ *  - the blocks are linked in a free list by their first word: a block
+ *    is allocated and freed in a constant time
+ *  - the memory and the control block of a pool are allocated statically
+ *    by osPoolDef, or by osPoolDefEx to align the blocks for the DMA or
+ *    to place them in the CCM data RAM
+ *  - osPoolAlloc, osPoolCAlloc and osPoolFree can be called from ISRs.
+ *    They mask the interrupts with PRIMASK for a few instructions only
+ *
+ * Peripheral drivers, USB classes and DSP instances take their buffers
+ * from a pool at their initialization and give them back at their
+ * de-initialization, instead of keeping static buffers for their whole
+ * life.
+ * -------------------------------------------------------------------- */
+
+#if defined (STM32F4XX) || defined (STM32F40XX) || defined (STM32F427X)
+ #include "stm32f4xx.h"
+#elif defined (STM32F2XX)
+ #include "stm32f2xx.h"
+#else
+ #include "stm32f10x.h"
+#endif
+#include "cmsis_os.h"
+#include <string.h>
+
+
+// ==== Memory Pool Management Functions ====
+
+/// Link all the blocks of a pool in its free list.
+void os_pool_init (struct os_pool_cb *pool, void *memory, uint32_t blocks, uint32_t item_sz)  {
+  uint32_t *block = (uint32_t *)memory;
+  uint32_t blk_sz = os_pool_blk_sz(item_sz);
+  uint32_t i;
+
+  pool->wlist.first = NULL;
+  pool->blk_sz = blk_sz;
+  pool->base = block;
+  pool->end = block + (blocks * blk_sz);
+  pool->free = (blocks != 0) ? block : NULL;
+  for (i = 1; i < blocks; i++)  {
+    *(uint32_t **)block = block + blk_sz;
+    block += blk_sz;
+  }
+  if (blocks != 0)  {
+    *(uint32_t **)block = NULL;
+  }
+}
+
+/// Take the first free block, or NULL.
+void *os_pool_get (struct os_pool_cb *pool)  {
+  uint32_t *block = (uint32_t *)pool->free;
+
+  if (block != NULL)  {
+    pool->free = *(uint32_t **)block;
+  }
+  return block;
+}
+
+/// Put a block back in the free list.
+void os_pool_release (struct os_pool_cb *pool, void *block)  {
+  *(void **)block = pool->free;
+  pool->free = block;
+}
+
+/// Check that an address is a block of a pool.
+int32_t os_pool_valid (struct os_pool_cb *pool, void *block)  {
+  uint32_t *p = (uint32_t *)block;
+
+  return (p >= pool->base) && (p < pool->end) &&
+         (((uint32_t)(p - pool->base) % pool->blk_sz) == 0);
+}
+
+/// Create and Initialize a memory pool
+osPoolId osPoolCreate (osPoolDef_t *pool_def)  {
+  if ((__get_IPSR() != 0) || (pool_def == NULL) || (pool_def->pool_sz == 0) || (pool_def->item_sz == 0))  {
+    return NULL;
+  }
+  os_pool_init(pool_def->cb, pool_def->pool, pool_def->pool_sz, pool_def->item_sz);
+  return pool_def->cb;
+}
+
+/// Allocate a memory block from a memory pool
+void *osPoolAlloc (osPoolId pool_id)  {
+  void *block;
+  uint32_t primask;
+
+  if (pool_id == NULL)  {
+    return NULL;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  block = os_pool_get(pool_id);
+  __set_PRIMASK(primask);
+  return block;
+}
+
+/// Allocate a memory block from a memory pool and set memory block to zero
+void *osPoolCAlloc (osPoolId pool_id)  {
+  void *block = osPoolAlloc(pool_id);
+
+  if (block != NULL)  {
+    memset(block, 0, pool_id->blk_sz * sizeof(uint32_t));
+  }
+  return block;
+}
+
+/// Return an allocated memory block back to a specific memory pool
+osStatus osPoolFree (osPoolId pool_id, void *block)  {
+  uint32_t primask;
+
+  if (pool_id == NULL)  {
+    return osErrorParameter;
+  }
+  if (!os_pool_valid(pool_id, block))  {
+    return osErrorValue;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  os_pool_release(pool_id, block);
+  __set_PRIMASK(primask);
+  return osOK;
+}
@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------
+ * $Date:        5. March 2012
+ * $Revision:    V0.01
+ *
+ * Project:      CMSIS Trace
+ * Title:        cmsis_prof.c sampling profiler
+ *
+ * Prof_Handler is entered directly from the vector table: it selects the
+ * stack of the interrupted code with bit 2 of EXC_RETURN, and branches to
+ * prof_sample with the address of the exception frame. The stacked PC is
+ * the word 6 of the frame, with or without FPU context.
+ * -------------------------------------------------------------------- */
+
+#include "cmsis_prof.h"
+#include <string.h>
+
+#define PROF_FRAME_PC          6       ///< index of the PC in the exception frame
+#define PROF_LINE_MAX          80      ///< longest line of Prof_Format
+
+static uint32_t          prof_base;
+static uint32_t          prof_shift;
+static uint16_t         *prof_bins;
+static uint32_t          prof_count;
+static TIM_TypeDef      *prof_tim;
+static void            (*prof_chain)(void);
+static volatile uint32_t prof_running;
+static volatile uint32_t prof_samples;
+static volatile uint32_t prof_outside;
+
+void prof_sample (uint32_t *frame);
+
+
+/// Count the PC of the exception frame, acknowledge the timer and call the chained handler.
+void prof_sample (uint32_t *frame)  {
+  uint32_t bin;
+
+  if (prof_tim != NULL)  {
+    prof_tim->SR = (uint16_t)~TIM_SR_UIF;
+  }
+  if (prof_running)  {
+    bin = (frame[PROF_FRAME_PC] - prof_base) >> prof_shift;
+    if (bin < prof_count)  {
+      if (prof_bins[bin] != 0xFFFF)  {
+        prof_bins[bin]++;
+      }
+    }
+    else  {
+      prof_outside++;
+    }
+    prof_samples++;
+  }
+  if (prof_chain != NULL)  {
+    prof_chain();
+  }
+}
+
+/// Take a sample from the stack of the interrupted code.
+#if defined (__CC_ARM)
+__asm void Prof_Handler (void)  {
+  IMPORT  prof_sample
+
+  TST     LR, #0x04                    ; EXC_RETURN bit 2: 0=MSP, 1=PSP
+  ITE     EQ
+  MRSEQ   R0, MSP
+  MRSNE   R0, PSP
+  B       prof_sample                  ; returns from the exception with LR
+}
+#elif defined (__GNUC__)
+void Prof_Handler (void) __attribute__ ((naked));
+void Prof_Handler (void)  {
+  __ASM volatile (
+  "  tst     lr, #0x04            \n"  // EXC_RETURN bit 2: 0=MSP, 1=PSP
+  "  ite     eq                   \n"
+  "  mrseq   r0, msp              \n"
+  "  mrsne   r0, psp              \n"
+  "  b       prof_sample          \n"  // returns from the exception with LR
+  );
+}
+#elif defined (__ICCARM__)
+__stackless void Prof_Handler (void)  {
+  __ASM ("tst     lr, #0x04\n"
+         "ite     eq\n"
+         "mrseq   r0, msp\n"
+         "mrsne   r0, psp\n"
+         "b       prof_sample");
+}
+#else
+ #error "cmsis_prof.c: Prof_Handler is only provided for the ARM, GNU and IAR compilers"
+#endif
+
+/// Set up the profiler.
+void Prof_Init (uint32_t base, uint32_t shift, uint16_t *bins, uint32_t count,
+                TIM_TypeDef *TIMx, void (*chain)(void))  {
+  prof_running = 0;
+  prof_base = base;
+  prof_shift = shift;
+  prof_bins = bins;
+  prof_count = (bins != NULL) ? count : 0;
+  prof_tim = TIMx;
+  prof_chain = chain;
+  Prof_Reset();
+}
+
+/// Enable the sampling.
+void Prof_Start (void)  {
+  prof_running = 1;
+}
+
+/// Disable the sampling.
+void Prof_Stop (void)  {
+  prof_running = 0;
+}
+
+/// Zero the bins and the sample counters.
+void Prof_Reset (void)  {
+  uint32_t running = prof_running;
+
+  prof_running = 0;
+  if (prof_count != 0)  {
+    memset(prof_bins, 0, prof_count * sizeof(uint16_t));
+  }
+  prof_samples = 0;
+  prof_outside = 0;
+  prof_running = running;
+}
+
+/// Number of samples taken since Prof_Init or Prof_Reset.
+uint32_t Prof_GetSamples (void)  {
+  return prof_samples;
+}
+
+/// Append a text.
+static char *prof_str (char *p, const char *str)  {
+  while (*str != '\0')  {
+    *p++ = *str++;
+  }
+  return p;
+}
+
+/// Append a number in hexadecimal with 8 digits and the 0x prefix.
+static char *prof_hex (char *p, uint32_t value)  {
+  int32_t i;
+
+  *p++ = '0';
+  *p++ = 'x';
+  for (i = 28; i >= 0; i -= 4)  {
+    *p++ = "0123456789ABCDEF"[(value >> i) & 0xF];
+  }
+  return p;
+}
+
+/// Append a number in decimal.
+static char *prof_dec (char *p, uint32_t value)  {
+  char digits[10];
+  uint32_t n = 0;
+
+  do  {
+    digits[n++] = (char)('0' + (value % 10));
+    value /= 10;
+  } while (value != 0);
+  while (n != 0)  {
+    *p++ = digits[--n];
+  }
+  return p;
+}
+
+/// Write the next complete lines of the profile text in a buffer.
+/// The cursor is 0 for the header, 1 + the index of the next bin to scan,
+/// prof_count + 1 for the end line, and prof_count + 2 at the end.
+uint32_t Prof_Format (char *buf, uint32_t size, uint32_t *cursor)  {
+  char *p = buf;
+  uint32_t bin;
+
+  while ((uint32_t)(p - buf) + PROF_LINE_MAX <= size)  {
+    if (*cursor == 0)  {
+      p = prof_str(p, "# prof base=");
+      p = prof_hex(p, prof_base);
+      p = prof_str(p, " shift=");
+      p = prof_dec(p, prof_shift);
+      p = prof_str(p, " bins=");
+      p = prof_dec(p, prof_count);
+      p = prof_str(p, " samples=");
+      p = prof_dec(p, prof_samples);
+      p = prof_str(p, " outside=");
+      p = prof_dec(p, prof_outside);
+      *p++ = '\n';
+      *cursor = 1;
+    }
+    else if (*cursor <= prof_count)  {
+      bin = *cursor - 1;
+      while ((bin < prof_count) && (prof_bins[bin] == 0))  {
+        bin++;
+      }
+      if (bin < prof_count)  {
+        p = prof_hex(p, prof_base + (bin << prof_shift));
+        *p++ = ' ';
+        p = prof_dec(p, prof_bins[bin]);
+        *p++ = '\n';
+        *cursor = bin + 2;
+      }
+      else  {
+        *cursor = prof_count + 1;
+      }
+    }
+    else if (*cursor == prof_count + 1)  {
+      p = prof_str(p, "# end\n");
+      *cursor = prof_count + 2;
+    }
+    else  {
+      break;
+    }
+  }
+  return (uint32_t)(p - buf);
+}
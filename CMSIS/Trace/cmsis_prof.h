@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * $Date:        5. March 2012
+ * $Revision:    V0.01
+ *
+ * Project:      CMSIS Trace
+ * Title:        cmsis_prof.h sampling profiler
+ *
+ * Statistical profiler for Cortex-M3 and Cortex-M4 devices, running on
+ * the target without debugger. A periodic interrupt reads the PC stacked
+ * in the exception frame of the interrupted code, thread or ISR, and
+ * counts it in a histogram of fixed-size address ranges (bins).
+ *
+ * Usage:
+ *  - configure a timer for a periodic update interrupt, at a rate which is
+ *    not a multiple of the other periodic interrupts (for example 997 Hz),
+ *    with a priority above all the code to profile
+ *  - install Prof_Handler as the handler of this interrupt: name it in the
+ *    vector table of the startup file, or call NVIC_SetHandler() of misc.h
+ *    after NVIC_RelocateVectorTable(). The handler must not be called from
+ *    another handler: it reads EXC_RETURN in LR
+ *  - call Prof_Init with the bins, the timer, and 0 as chained handler
+ *  - for SysTick, call Prof_Init with NULL as timer and SysTick_Handler as
+ *    chained handler: the application tick is served after each sample
+ *  - Prof_Start and Prof_Stop enable and disable the sampling
+ *  - send the result with Prof_Format over the CDC class (CDC_Write) or
+ *    a USART (USART_StreamSend on STM32F4xx)
+ * -------------------------------------------------------------------- */
+
+/**
+\page cmsis_prof_format Profile text format
+
+Prof_Format writes text lines:
+
+\code
+# prof base=0x08000000 shift=5 bins=16384 samples=120000 outside=57
+0x08000140 12
+0x08000460 5310
+# end
+\endcode
+
+- the header gives the address of the first bin, the bin size as a power
+  of 2, the number of bins, the number of samples, and the number of
+  samples outside the bins (code in RAM, or out of the range profiled)
+- one line per bin with samples: the start address of the bin and its
+  count, saturated at 65535
+- the host maps each address to its function with the symbol table of
+  the firmware, for example `arm-none-eabi-addr2line -f -e fw.elf`, or
+  with the sorted output of `arm-none-eabi-nm -n fw.elf`
+*/
+
+#ifndef _CMSIS_PROF_H
+#define _CMSIS_PROF_H
+
+#if defined (STM32F4XX) || defined (STM32F40XX) || defined (STM32F427X)
+ #include "stm32f4xx.h"
+#elif defined (STM32F2XX)
+ #include "stm32f2xx.h"
+#else
+ #include "stm32f10x.h"
+#endif
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Number of bins for a code region of size bytes, with bins of 2^shift bytes.
+#define PROF_BINS(size, shift)   (((size) + (1UL << (shift)) - 1) >> (shift))
+
+/// Set up the profiler. The sampling starts with Prof_Start.
+/// \param[in]     base          address of the first bin, usually the flash start 0x08000000.
+/// \param[in]     shift         log2 of the bin size in bytes, at least 1.
+/// \param[in]     bins          counters of the bins, zeroed by this function.
+/// \param[in]     count         number of bins.
+/// \param[in]     TIMx          timer whose update flag is cleared at each sample, or NULL (SysTick).
+/// \param[in]     chain         handler called after each sample, or NULL.
+void Prof_Init (uint32_t base, uint32_t shift, uint16_t *bins, uint32_t count,
+                TIM_TypeDef *TIMx, void (*chain)(void));
+
+/// Enable the sampling.
+void Prof_Start (void);
+
+/// Disable the sampling. Prof_Handler still clears the timer flag and calls the chained handler.
+void Prof_Stop (void);
+
+/// Zero the bins and the sample counters.
+void Prof_Reset (void);
+
+/// Number of samples taken since Prof_Init or Prof_Reset.
+uint32_t Prof_GetSamples (void);
+
+/// Write the next complete lines of the profile text in a buffer.
+/// \param[out]    buf           text buffer, not terminated by a null character.
+/// \param[in]     size          size of buf, at least 80 bytes.
+/// \param[in,out] cursor        0 for the header line, then updated by this function.
+/// \return number of characters written, 0 when the profile is complete.
+/// \note Call Prof_Stop first, so that the counts do not change during the dump.
+uint32_t Prof_Format (char *buf, uint32_t size, uint32_t *cursor);
+
+/// Interrupt handler taking a sample: install it in the vector table.
+void Prof_Handler (void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // _CMSIS_PROF_H
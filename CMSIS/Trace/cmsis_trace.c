@@ -0,0 +1,154 @@
+/* ----------------------------------------------------------------------
+ * $Date:        5. March 2012
+ * $Revision:    V0.01
+ *
+ * Project:      CMSIS Trace
+ * Title:        cmsis_trace.c event trace through the DWT and the ITM
+ *
+ * See cmsis_trace.h for the record format. A record is written with the
+ * interrupts masked by PRIMASK, for 2 to 4 stimulus port writes. The
+ * functions return at once when the ITM or the ports are not enabled,
+ * so a traced firmware runs without debugger at almost full speed.
+ * -------------------------------------------------------------------- */
+
+#if defined (STM32F4XX) || defined (STM32F40XX) || defined (STM32F427X)
+ #include "stm32f4xx.h"
+#elif defined (STM32F2XX)
+ #include "stm32f2xx.h"
+#else
+ #include "stm32f10x.h"
+#endif
+#include "cmsis_trace.h"
+
+
+// ==== Registers not described by the CMSIS core header ====
+
+#define TRACE_DWT_CTRL         (*(volatile uint32_t *)0xE0001000)
+#define TRACE_DWT_CYCCNT       (*(volatile uint32_t *)0xE0001004)
+#define TRACE_DWT_CTRL_CYCCNTENA 0x00000001
+
+#define TRACE_ITM_LAR          (*(volatile uint32_t *)0xE0000FB0)
+#define TRACE_ITM_UNLOCK       0xC5ACCE55
+
+#define TRACE_TPIU_ACPR        (*(volatile uint32_t *)0xE0040010)  ///< SWO prescaler
+#define TRACE_TPIU_SPPR        (*(volatile uint32_t *)0xE00400F0)  ///< pin protocol
+#define TRACE_TPIU_FFCR        (*(volatile uint32_t *)0xE0040304)  ///< formatter control
+#define TRACE_TPIU_SPPR_NRZ    0x00000002
+#define TRACE_TPIU_FFCR_TRIGIN 0x00000100  ///< formatter off, continuous mode
+
+#define TRACE_PORTS_MSK        ((1UL << TRACE_PORT_TEXT) | (1UL << TRACE_PORT_EVENT) | \
+                                (1UL << TRACE_PORT_TIME) | (1UL << TRACE_PORT_ARG))
+#define TRACE_RECORD_MSK       ((1UL << TRACE_PORT_EVENT) | (1UL << TRACE_PORT_TIME) | \
+                                (1UL << TRACE_PORT_ARG))
+
+static uint32_t trace_time_hi = 0xFFFFFFFF;  ///< CYCCNT[31:24] of the last time packet
+static uint32_t trace_dropped;               ///< records dropped since Trace_Init
+static uint32_t trace_pending;               ///< dropped records not reported yet
+
+
+/// Write a word on a stimulus port, waiting for room in the ITM FIFO.
+static void trace_write (uint32_t port, uint32_t value)  {
+  while (ITM->PORT[port].u32 == 0);
+  ITM->PORT[port].u32 = value;
+}
+
+/// Write an argument packet: 16-bit when the value fits.
+static void trace_write_arg (uint32_t value)  {
+  while (ITM->PORT[TRACE_PORT_ARG].u32 == 0);
+  if (value <= 0xFFFF)  {
+    ITM->PORT[TRACE_PORT_ARG].u16 = (uint16_t)value;
+  }
+  else  {
+    ITM->PORT[TRACE_PORT_ARG].u32 = value;
+  }
+}
+
+/// Write a record, with the interrupts masked. has_arg selects the argument packet.
+static void trace_record (uint32_t id, uint32_t arg, uint32_t has_arg)  {
+  uint32_t primask;
+  uint32_t time;
+
+  if (((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0) ||
+      ((ITM->TER & TRACE_RECORD_MSK) != TRACE_RECORD_MSK))  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (ITM->PORT[TRACE_PORT_EVENT].u32 == 0)  {
+    // ITM FIFO full: drop the record rather than stall the traced code
+    trace_dropped++;
+    trace_pending++;
+    __set_PRIMASK(primask);
+    return;
+  }
+  time = TRACE_DWT_CYCCNT;
+  if (trace_pending != 0)  {
+    trace_write_arg(trace_pending);
+    trace_write(TRACE_PORT_EVENT, ((uint32_t)TRACE_EV_OVERFLOW << 24) | (time & 0x00FFFFFF));
+    trace_pending = 0;
+  }
+  if ((time >> 24) != trace_time_hi)  {
+    trace_time_hi = time >> 24;
+    trace_write(TRACE_PORT_TIME, time);
+  }
+  if (has_arg)  {
+    trace_write_arg(arg);
+  }
+  trace_write(TRACE_PORT_EVENT, (id << 24) | (time & 0x00FFFFFF));
+  __set_PRIMASK(primask);
+}
+
+/// Start the DWT cycle counter, and set up the SWO output when swo_hz is not 0.
+void Trace_Init (uint32_t cpu_hz, uint32_t swo_hz)  {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  TRACE_DWT_CYCCNT = 0;
+  TRACE_DWT_CTRL |= TRACE_DWT_CTRL_CYCCNTENA;
+
+  if ((swo_hz != 0) && (cpu_hz >= swo_hz))  {
+    DBGMCU->CR |= DBGMCU_CR_TRACE_IOEN;          // TRACESWO pin, asynchronous mode
+    TRACE_TPIU_SPPR = TRACE_TPIU_SPPR_NRZ;
+    TRACE_TPIU_ACPR = (cpu_hz / swo_hz) - 1;
+    TRACE_TPIU_FFCR = TRACE_TPIU_FFCR_TRIGIN;
+    TRACE_ITM_LAR = TRACE_ITM_UNLOCK;
+    ITM->TCR = (1UL << ITM_TCR_TraceBusID_Pos) | ITM_TCR_SYNCENA_Msk | ITM_TCR_ITMENA_Msk;
+    ITM->TPR = 0;                                // ports usable in unprivileged mode
+    ITM->TER |= TRACE_PORTS_MSK;
+  }
+
+  trace_time_hi = 0xFFFFFFFF;
+  trace_dropped = 0;
+  trace_pending = 0;
+}
+
+/// Send an event record without argument.
+void Trace_Event (uint32_t id)  {
+  trace_record(id, 0, 0);
+}
+
+/// Send an event record with an argument.
+void Trace_EventArg (uint32_t id, uint32_t arg)  {
+  trace_record(id, arg, 1);
+}
+
+/// Send an event record with the current exception number as argument.
+void Trace_EventISR (uint32_t id)  {
+  trace_record(id, __get_IPSR(), 1);
+}
+
+/// Send a text on the port 0.
+void Trace_Puts (const char *str)  {
+  if (((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0) ||
+      ((ITM->TER & (1UL << TRACE_PORT_TEXT)) == 0))  {
+    return;
+  }
+  while (*str != '\0')  {
+    while (ITM->PORT[TRACE_PORT_TEXT].u32 == 0);
+    ITM->PORT[TRACE_PORT_TEXT].u8 = (uint8_t)*str++;
+  }
+}
+
+/// Number of records dropped since Trace_Init.
+uint32_t Trace_GetDropped (void)  {
+  return trace_dropped;
+}
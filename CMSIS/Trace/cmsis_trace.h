@@ -0,0 +1,180 @@
+/* ----------------------------------------------------------------------
+ * $Date:        5. March 2012
+ * $Revision:    V0.01
+ *
+ * Project:      CMSIS Trace
+ * Title:        cmsis_trace.h event trace through the DWT and the ITM
+ *
+ * Binary event records timestamped by the DWT cycle counter and sent on
+ * ITM stimulus ports, for Cortex-M3 and Cortex-M4 devices. A record costs
+ * 2 to 4 stimulus port writes, so ISRs, the USB stack, the DMA drivers and
+ * the DSP processing can be traced on deployed boards with the SWO pin.
+ *
+ * The trace is compiled in by defining TRACE_LEVEL in the preprocessor of
+ * the project, and by including this file in the configuration headers of
+ * the libraries (stm32f4xx_conf.h, stm32f2xx_conf.h, stm32f10x_conf.h and
+ * usb_conf.h). The libraries only use the TRACE_xxx macros, which are
+ * defined empty when TRACE_LEVEL is 0 or not defined.
+ * -------------------------------------------------------------------- */
+
+/**
+\page cmsis_trace_format Trace record format
+
+The records are sent on the stimulus ports 1 to 3. The ITM emits each
+write as a software source (SWIT) packet of 1, 2 or 4 bytes, after a
+header byte with the port number and the size. A host decoder (SWO viewer,
+OpenOCD or pyOCD ITM output) demultiplexes the ports and rebuilds the
+records:
+
+Port | Write   | Contents
+-----|---------|-----------------------------------------------------------
+0    | 8-bit   | text of \ref Trace_Puts, as ITM_SendChar
+1    | 32-bit  | event: bits 31..24 event ID, bits 23..0 low 24 bits of CYCCNT
+2    | 32-bit  | time: the full CYCCNT, sent before an event when CYCCNT[31:24] changed
+3    | 16/32   | argument of the next event: 16-bit write when it fits, else 32-bit
+
+- the decoder keeps the last time word; the time of an event is
+  (time & 0xFF000000) | (event & 0x00FFFFFF), in CPU cycles
+- an argument packet always precedes its event packet; an event without
+  a preceding argument packet has no argument
+- the packets of one record are written with the interrupts masked, so
+  the records of an ISR never split the records of the interrupted code
+- a record is dropped when the ITM FIFO is full at its first write. The
+  next record sent is preceded by a \ref TRACE_EV_OVERFLOW record with the
+  number of dropped records
+- two events separated by an exact multiple of 2^32 cycles are not told
+  apart: at 168 MHz, 25.5 seconds without any record
+
+Event IDs, with their argument:
+
+ID        | Level | Event                      | Argument
+----------|-------|----------------------------|----------------------------
+0x00      | -     | TRACE_EV_OVERFLOW          | number of dropped records
+0x01      | 3     | TRACE_EV_ISR_ENTER         | exception number (IPSR)
+0x02      | 3     | TRACE_EV_ISR_EXIT          | exception number (IPSR)
+0x10-0x1F | 2     | TRACE_EV_USB_xxx           | endpoint or channel number
+0x20-0x27 | 2     | TRACE_EV_DMA_xxx           | DMA stream or channel address
+0x30      | 1     | TRACE_EV_DSP_START         | kernel ID
+0x31      | 1     | TRACE_EV_DSP_STOP          | kernel ID
+0x80-0xFF | 1     | application events         | application defined
+*/
+
+#ifndef _CMSIS_TRACE_H
+#define _CMSIS_TRACE_H
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Compile-time trace level: 0=off, 1=application and DSP events,
+/// 2=1 + driver events (USB, DMA), 3=2 + ISR enter and exit.
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL            0
+#endif
+
+#define TRACE_LEVEL_APP        1       ///< application and DSP events
+#define TRACE_LEVEL_DRIVER     2       ///< USB and DMA driver events
+#define TRACE_LEVEL_ISR        3       ///< ISR enter and exit
+
+/// ITM stimulus ports of the records.
+#define TRACE_PORT_TEXT        0       ///< Trace_Puts text
+#define TRACE_PORT_EVENT       1       ///< event ID and low 24 bits of the timestamp
+#define TRACE_PORT_TIME        2       ///< full timestamp
+#define TRACE_PORT_ARG         3       ///< argument of the next event
+
+
+// ==== Event IDs ====
+
+#define TRACE_EV_OVERFLOW      0x00    ///< records dropped: ITM FIFO full
+#define TRACE_EV_ISR_ENTER     0x01    ///< exception handler entered
+#define TRACE_EV_ISR_EXIT      0x02    ///< exception handler left
+
+#define TRACE_EV_USB_RESET     0x10    ///< device: USB reset
+#define TRACE_EV_USB_SUSPEND   0x11    ///< device: suspend
+#define TRACE_EV_USB_RESUME    0x12    ///< device: resume
+#define TRACE_EV_USB_SETUP     0x13    ///< device: SETUP packet received on endpoint 0
+#define TRACE_EV_USB_OUT       0x14    ///< device: OUT transfer complete, argument endpoint
+#define TRACE_EV_USB_IN        0x15    ///< device: IN transfer complete, argument endpoint
+#define TRACE_EV_USB_SOF       0x16    ///< device or host: start of frame
+#define TRACE_EV_USB_CONNECT   0x18    ///< host: device connected
+#define TRACE_EV_USB_DISCONNECT 0x19   ///< host: device disconnected
+#define TRACE_EV_USB_URB       0x1A    ///< host: URB state change, argument channel
+
+#define TRACE_EV_DMA_HALF      0x20    ///< DMA half transfer, argument stream or channel address
+#define TRACE_EV_DMA_TC        0x21    ///< DMA transfer complete
+#define TRACE_EV_DMA_ERROR     0x22    ///< DMA transfer error
+
+#define TRACE_EV_DSP_START     0x30    ///< DSP kernel started, argument kernel ID
+#define TRACE_EV_DSP_STOP      0x31    ///< DSP kernel done, argument kernel ID
+
+#define TRACE_EV_USER          0x80    ///< first application event ID
+
+
+// ==== Trace functions ====
+
+/// Start the DWT cycle counter and, when swo_hz is not 0, set up the ITM,
+/// the TPIU and the SWO pin without debugger (NRZ encoding, at swo_hz).
+/// When swo_hz is 0, the debugger sets up the ITM and the SWO.
+/// \param[in]     cpu_hz        frequency of the CPU clock in Hz.
+/// \param[in]     swo_hz        bit rate of the SWO pin, or 0.
+void Trace_Init (uint32_t cpu_hz, uint32_t swo_hz);
+
+/// Send an event record without argument.
+/// \param[in]     id            event ID.
+void Trace_Event (uint32_t id);
+
+/// Send an event record with an argument.
+/// \param[in]     id            event ID.
+/// \param[in]     arg           argument of the event.
+void Trace_EventArg (uint32_t id, uint32_t arg);
+
+/// Send an event record with the current exception number as argument.
+/// \param[in]     id            event ID.
+void Trace_EventISR (uint32_t id);
+
+/// Send a text on the port 0, as ITM_SendChar: the debugger console output.
+/// \param[in]     str           text terminated by a null character.
+void Trace_Puts (const char *str);
+
+/// Number of records dropped since Trace_Init.
+uint32_t Trace_GetDropped (void);
+
+
+// ==== Instrumentation macros ====
+
+#if (TRACE_LEVEL >= TRACE_LEVEL_APP)
+#define TRACE_EVENT(id)            Trace_Event(id)
+#define TRACE_EVENT_ARG(id, arg)   Trace_EventArg((id), (uint32_t)(arg))
+#define TRACE_DSP_START(kernel)    Trace_EventArg(TRACE_EV_DSP_START, (kernel))
+#define TRACE_DSP_STOP(kernel)     Trace_EventArg(TRACE_EV_DSP_STOP, (kernel))
+#else
+#define TRACE_EVENT(id)
+#define TRACE_EVENT_ARG(id, arg)
+#define TRACE_DSP_START(kernel)
+#define TRACE_DSP_STOP(kernel)
+#endif
+
+#if (TRACE_LEVEL >= TRACE_LEVEL_DRIVER)
+#define TRACE_USB(ev, arg)         Trace_EventArg((ev), (uint32_t)(arg))
+#define TRACE_DMA(ev, instance)    Trace_EventArg((ev), (uint32_t)(instance))
+#else
+#define TRACE_USB(ev, arg)
+#define TRACE_DMA(ev, instance)
+#endif
+
+#if (TRACE_LEVEL >= TRACE_LEVEL_ISR)
+#define TRACE_ISR_ENTER()          Trace_EventISR(TRACE_EV_ISR_ENTER)
+#define TRACE_ISR_EXIT()           Trace_EventISR(TRACE_EV_ISR_EXIT)
+#else
+#define TRACE_ISR_ENTER()
+#define TRACE_ISR_EXIT()
+#endif
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // _CMSIS_TRACE_H
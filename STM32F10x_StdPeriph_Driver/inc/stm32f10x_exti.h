@@ -94,6 +94,14 @@ typedef struct
                                          This parameter can be set either to ENABLE or DISABLE */ 
 }EXTI_InitTypeDef;
 
+/** 
+  * @brief  EXTI line callback: called by EXTI_Dispatch() with the EXTI_Linex
+  *         of the pending line and the DWT cycle counter read at the entry
+  *         of the dispatch.
+  */
+
+typedef void (*EXTI_CallbackTypeDef)(uint32_t EXTI_Line, uint32_t Timestamp);
+
 /**
   * @}
   */
@@ -141,6 +149,12 @@ typedef struct
                             ((LINE) == EXTI_Line18) || ((LINE) == EXTI_Line19))
 
                     
+#define EXTI_LINE_NUMBER    20                     /*!< Number of EXTI lines */
+
+/* Lines sharing an interrupt vector, for EXTI_Dispatch() */
+#define EXTI_Lines_9_5      ((uint32_t)0x003E0)   /*!< Lines of EXTI9_5_IRQHandler */
+#define EXTI_Lines_15_10    ((uint32_t)0x0FC00)   /*!< Lines of EXTI15_10_IRQHandler */
+
 /**
   * @}
   */
@@ -169,6 +183,9 @@ FlagStatus EXTI_GetFlagStatus(uint32_t EXTI_Line);
 void EXTI_ClearFlag(uint32_t EXTI_Line);
 ITStatus EXTI_GetITStatus(uint32_t EXTI_Line);
 void EXTI_ClearITPendingBit(uint32_t EXTI_Line);
+void EXTI_SetCallback(uint32_t EXTI_Line, EXTI_CallbackTypeDef Callback);
+void EXTI_TimestampCmd(FunctionalState NewState);
+void EXTI_Dispatch(uint32_t EXTI_Lines);
 
 #ifdef __cplusplus
 }
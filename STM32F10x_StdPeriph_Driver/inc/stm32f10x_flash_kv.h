@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * @file    stm32f10x_flash_kv.h
+  * @author  MCD Application Team
+  * @version V3.6.1
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the key/value
+  *          and log store on FLASH pages.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F10x_FLASH_KV_H
+#define __STM32F10x_FLASH_KV_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f10x_flash.h"
+
+/** @addtogroup STM32F10x_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup FLASH
+  * @{
+  */
+
+/** @defgroup FLASH_KV_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief  FLASH area of the store: consecutive pages
+  */
+
+typedef struct
+{
+  uint32_t Address;              /*!< First address of the first page. */
+
+  uint32_t Size;                 /*!< Size of the area in bytes, a multiple of FLASH_KV_PAGE_SIZE. */
+}FLASH_KVAreaTypeDef;
+
+/**
+  * @brief  Entry of the RAM index of the store
+  */
+
+typedef struct
+{
+  uint32_t Key;                  /*!< Reserved: the key, FLASH_KV_KEY_NONE when the entry is free. */
+
+  uint32_t Address;              /*!< Reserved: address of the last record of the key. */
+}FLASH_KVEntryTypeDef;
+
+/**
+  * @brief  Key/value and log store definition
+  */
+
+typedef struct
+{
+  const FLASH_KVAreaTypeDef* Areas; /*!< Reserved: the areas, in the order of use. */
+
+  uint32_t NbAreas;              /*!< Reserved: number of areas, at least 2. */
+
+  FLASH_KVEntryTypeDef* Index;   /*!< Reserved: hash table of the keys. */
+
+  uint32_t IndexMask;            /*!< Reserved: number of entries of Index minus 1. */
+
+  uint32_t Count;                /*!< Reserved: number of keys in Index. */
+
+  uint32_t Head;                 /*!< Reserved: area being written. */
+
+  uint32_t WriteAddress;         /*!< Reserved: address of the next record. */
+
+  uint32_t Sequence;             /*!< Reserved: sequence number of the head area. */
+
+  uint32_t LogSequence;          /*!< Reserved: sequence number of the last log record. */
+}FLASH_KVTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup FLASH_KV_Exported_Constants
+  * @{
+  */
+
+#if defined (STM32F10X_HD) || defined (STM32F10X_HD_VL) || defined (STM32F10X_CL) || defined (STM32F10X_XL)
+ #define FLASH_KV_PAGE_SIZE        ((uint32_t)0x800)
+#else
+ #define FLASH_KV_PAGE_SIZE        ((uint32_t)0x400)
+#endif
+
+#define FLASH_KV_KEY_NONE          ((uint32_t)0xFFFFFFFF)  /*!< Not a valid key */
+#define FLASH_KV_MAX_LENGTH        ((uint32_t)0xFFFF)      /*!< Maximum length of a value */
+
+#define IS_FLASH_KV_KEY(KEY)       ((KEY) != FLASH_KV_KEY_NONE)
+#define IS_FLASH_KV_INDEX_SIZE(SIZE) (((SIZE) >= 2) && (((SIZE) & ((SIZE) - 1)) == 0))
+/**
+  * @}
+  */
+
+/** @defgroup FLASH_KV_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup FLASH_KV_Exported_Functions
+  * @{
+  */
+
+ErrorStatus FLASH_KVInit(FLASH_KVTypeDef* KV, const FLASH_KVAreaTypeDef* Areas, uint32_t NbAreas,
+                         FLASH_KVEntryTypeDef* Index, uint32_t IndexSize);
+ErrorStatus FLASH_KVRead(FLASH_KVTypeDef* KV, uint32_t Key, const uint8_t** Data, uint16_t* Length);
+ErrorStatus FLASH_KVWrite(FLASH_KVTypeDef* KV, uint32_t Key, const uint8_t* Data, uint16_t Length);
+ErrorStatus FLASH_KVDelete(FLASH_KVTypeDef* KV, uint32_t Key);
+ErrorStatus FLASH_KVLogAppend(FLASH_KVTypeDef* KV, const uint8_t* Data, uint16_t Length);
+uint32_t FLASH_KVLogRead(FLASH_KVTypeDef* KV, uint32_t Sequence, const uint8_t** Data, uint16_t* Length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F10x_FLASH_KV_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -51,6 +51,7 @@
   */
 
 #define AIRCR_VECTKEY_MASK    ((uint32_t)0x05FA0000)
+#define NVIC_PLAN_CLASSES     (NVIC_LatencyClass_Low + 1)
 /**
   * @}
   */
@@ -59,6 +60,9 @@
   * @{
   */
 
+/* Pre-emption priority of a latency class: the classes share the range equally */
+#define NVIC_PLAN_PREEMPTION(CLASS)  ((CLASS) << (NVIC_PlanPreemptionBits - 2))
+
 /**
   * @}
   */
@@ -67,6 +71,27 @@
   * @{
   */
 
+/* Vector table in SRAM, aligned on its size (512 bytes) for SCB->VTOR */
+#if defined ( __CC_ARM   )
+__align(512) static uint32_t NVIC_RAMVectorTable[NVIC_VECTOR_TABLE_SIZE];
+#elif defined ( __ICCARM__ )
+#pragma data_alignment=512
+static uint32_t NVIC_RAMVectorTable[NVIC_VECTOR_TABLE_SIZE];
+#elif defined   (  __GNUC__  )
+static uint32_t NVIC_RAMVectorTable[NVIC_VECTOR_TABLE_SIZE] __attribute__ ((aligned (512)));
+#elif defined  (  __TASKING__  )
+static uint32_t NVIC_RAMVectorTable[NVIC_VECTOR_TABLE_SIZE] __align(512);
+#endif
+
+/* BASEPRI value of the critical sections, 0 until NVIC_PlanConfig() is called */
+uint32_t NVIC_CriticalBasePri = 0;
+
+/* Pre-emption priority bits of the priority plan */
+static uint32_t NVIC_PlanPreemptionBits = 0;
+
+/* Next subpriority of each latency class */
+static uint8_t NVIC_PlanSubPriority[NVIC_PLAN_CLASSES];
+
 /**
   * @}
   */
@@ -168,6 +193,123 @@ void NVIC_SetVectorTable(uint32_t NVIC_VectTab, uint32_t Offset)
   SCB->VTOR = NVIC_VectTab | (Offset & (uint32_t)0x1FFFFF80);
 }
 
+/**
+  * @brief  Copies the vector table to SRAM and relocates it there, so that the
+  *         handlers can be changed using NVIC_SetHandler().
+  * @note   The vector table in use, given by SCB->VTOR, is copied at the first
+  *         call only. The vector fetches from SRAM do not wait for the FLASH.
+  * @param  None
+  * @retval None
+  */
+void NVIC_RelocateVectorTable(void)
+{
+  const uint32_t* table = (const uint32_t*)SCB->VTOR;
+  uint32_t index = 0;
+
+  if (table != NVIC_RAMVectorTable)
+  {
+    for (index = 0; index < NVIC_VECTOR_TABLE_SIZE; index++)
+    {
+      NVIC_RAMVectorTable[index] = table[index];
+    }
+
+    /* The copy is complete before the first vector fetch from SRAM */
+    __DSB();
+    SCB->VTOR = (uint32_t)NVIC_RAMVectorTable;
+    __DSB();
+  }
+}
+
+/**
+  * @brief  Sets the handler of an IRQ Channel or of a system exception.
+  * @param  IRQn: specifies the IRQ Channel, an enumerator of @ref IRQn_Type
+  *         enumeration, from NonMaskableInt_IRQn.
+  * @param  Handler: the new handler.
+  * @note   The vector table is relocated to SRAM at the first call, using
+  *         NVIC_RelocateVectorTable(). The new handler is used from the next
+  *         interrupt of the IRQ Channel.
+  * @retval None
+  */
+void NVIC_SetHandler(IRQn_Type IRQn, void (*Handler)(void))
+{
+  /* Check the parameters */
+  assert_param(IS_NVIC_HANDLER_IRQ(IRQn));
+
+  NVIC_RelocateVectorTable();
+
+  NVIC_RAMVectorTable[(int32_t)IRQn + 16] = (uint32_t)Handler;
+  __DSB();
+}
+
+/**
+  * @brief  Configures the priority grouping of the priority plan.
+  * @param  NVIC_PriorityGroup: specifies the priority grouping bits length.
+  *   This parameter can be one of the following values:
+  *     @arg NVIC_PriorityGroup_2: 4 pre-emption priorities, 1 per latency class,
+  *                                and 4 subpriorities inside each class
+  *     @arg NVIC_PriorityGroup_3: 2 pre-emption priorities per class,
+  *                                and 2 subpriorities inside each class
+  *     @arg NVIC_PriorityGroup_4: 4 pre-emption priorities per class,
+  *                                no subpriority
+  * @note   From this call, NVIC_EnterCritical() masks the interrupts with BASEPRI
+  *         instead of PRIMASK, so the drivers never delay the
+  *         NVIC_LatencyClass_ZeroLatency interrupts. Call this function before
+  *         enabling the interrupts.
+  * @note   An RTOS masking the interrupts with BASEPRI should use
+  *         NVIC_CriticalBasePri as its ceiling, so that the zero-latency
+  *         interrupts are also kept above the kernel.
+  * @retval None
+  */
+void NVIC_PlanConfig(uint32_t NVIC_PriorityGroup)
+{
+  uint32_t latencyclass = 0;
+
+  /* Check the parameters */
+  assert_param(IS_NVIC_PLAN_PRIORITY_GROUP(NVIC_PriorityGroup));
+
+  NVIC_PriorityGroupConfig(NVIC_PriorityGroup);
+  NVIC_PlanPreemptionBits = (0x700 - NVIC_PriorityGroup) >> 0x08;
+
+  for (latencyclass = 0; latencyclass < NVIC_PLAN_CLASSES; latencyclass++)
+  {
+    NVIC_PlanSubPriority[latencyclass] = 0;
+  }
+
+  /* Mask the NVIC_LatencyClass_High pre-emption priority and the lower ones.
+     The pre-emption priority is in the upper bits of BASEPRI */
+  NVIC_CriticalBasePri = NVIC_PLAN_PREEMPTION(NVIC_LatencyClass_High) << (0x08 - NVIC_PlanPreemptionBits);
+}
+
+/**
+  * @brief  Sets the priority of an IRQ Channel from the latency class of its
+  *         module.
+  * @param  IRQn: the IRQ Channel, or a system exception like SysTick_IRQn.
+  * @param  NVIC_LatencyClass: a value of @ref Latency_Class.
+  * @note   The IRQ Channels of a class have the same pre-emption priority: they
+  *         do not preempt each other. Their subpriorities follow the order of
+  *         the calls, the last ones sharing the lowest subpriority of the class.
+  * @note   NVIC_PlanConfig() must be called first. The IRQ Channel is not
+  *         enabled.
+  * @retval None
+  */
+void NVIC_PlanIRQ(IRQn_Type IRQn, uint32_t NVIC_LatencyClass)
+{
+  uint32_t subbits = 0x04 - NVIC_PlanPreemptionBits;
+  uint32_t subpriority = 0;
+
+  /* Check the parameters */
+  assert_param(IS_NVIC_LATENCY_CLASS(NVIC_LatencyClass));
+  assert_param(NVIC_CriticalBasePri != 0);
+
+  subpriority = NVIC_PlanSubPriority[NVIC_LatencyClass];
+  if (subpriority < (((uint32_t)0x01 << subbits) - 1))
+  {
+    NVIC_PlanSubPriority[NVIC_LatencyClass]++;
+  }
+
+  NVIC_SetPriority(IRQn, (NVIC_PLAN_PREEMPTION(NVIC_LatencyClass) << subbits) | subpriority);
+}
+
 /**
   * @brief  Selects the condition for the system to enter low power mode.
   * @param  LowPowerMode: Specifies the new mode for the system to enter low power mode.
@@ -0,0 +1,418 @@
+/**
+  ******************************************************************************
+  * @file    stm32f10x_dma_xfer.c
+  * @author  MCD Application Team
+  * @version V3.6.1
+  * @date    05-March-2012
+  * @brief   This file provides DMA transfer functions with the same API on the
+  *          STM32F10x channels and on the STM32F2xx/STM32F4xx streams:
+  *           - Peripheral to memory and memory to peripheral transfers
+  *           - Circular mode with half transfer and transfer complete callbacks
+  *           - Memory-to-memory copy
+  *          It uses the stm32f10x_dma.c/.h drivers to access the DMA channels.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the DMA controller clock using
+  *             RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE) for DMA1 or
+  *             RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA2, ENABLE) for DMA2.
+  *
+  *          2. Fill a DMA_XferInitTypeDef structure, starting from the default
+  *             values of DMA_XferStructInit(), and call DMA_XferInit() with a
+  *             DMA_XferHandleTypeDef structure and the channel of the request.
+  *
+  *          3. Set the HalfCallback, CompleteCallback and ErrorCallback members
+  *             of the handle.
+  *
+  *          4. Enable the channel interrupt in the NVIC and call
+  *             DMA_XferIRQHandler() from its interrupt handler, for example:
+  *               void DMA1_Channel1_IRQHandler(void)
+  *               {
+  *                 DMA_XferIRQHandler(&AdcXfer);
+  *               }
+  *             When DMA2 Channel4 and Channel5 share their interrupt, call
+  *             DMA_XferIRQHandler() for the handles of both channels.
+  *
+  *          5. Start a transfer using DMA_XferStart(), or a memory-to-memory
+  *             copy using DMA_XferCopy(), then activate the Channel Request
+  *             using PPP_DMACmd() function of the peripheral driver.
+  *             In normal mode the State of the handle goes back to
+  *             DMA_XFER_STATE_READY when the transfer is complete. In circular
+  *             mode the transfer restarts at the beginning of the buffer and
+  *             runs until DMA_XferStop() is called.
+  *
+  *          The stm32f2xx_dma_xfer.c and stm32f4xx_dma_xfer.c drivers provide
+  *          the same API. On STM32F2xx and STM32F4xx the instance is a stream
+  *          and the Request member selects the channel of the request.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f10x_dma_xfer.h"
+
+/** @addtogroup STM32F10x_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup DMA
+  * @brief DMA driver modules
+  * @{
+  */
+
+/** @defgroup DMA_Xfer_Private_TypesDefinitions
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Xfer_Private_Defines
+  * @{
+  */
+
+#define DMA_XFER_CHANNEL_OFFSET   ((uint32_t)0x08)        /* Offset of the channel 1 registers */
+#define DMA_XFER_CHANNEL_SIZE     ((uint32_t)0x14)        /* Size of the registers of a channel */
+#define DMA_XFER_DMA2             ((uint32_t)0x10000000)  /* DMA2 bit of the flags */
+#define DMA_XFER_SHIFT_MASK       ((uint32_t)0x0000001F)  /* Position of the flags of the channel */
+
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Xfer_Private_Macros
+  * @{
+  */
+
+/* Event records of cmsis_trace.h, when it is included by stm32f10x_conf.h */
+#ifndef TRACE_DMA
+ #define TRACE_DMA(EVENT, INSTANCE)
+#endif
+
+/* Flag of the channel of the handle, from the flag of DMA1 Channel1 */
+#define DMA_XFER_IT(HANDLE, IT)   (((IT) << ((HANDLE)->Flags & DMA_XFER_SHIFT_MASK)) | \
+                                   ((HANDLE)->Flags & DMA_XFER_DMA2))
+
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Xfer_Private_Variables
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Xfer_Private_FunctionPrototypes
+  * @{
+  */
+
+static void DMA_XferDisable(DMA_XferHandleTypeDef* Handle);
+
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Xfer_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Fills each DMA_XferInitTypeDef member with its default value: memory
+  *         to peripheral transfer of bytes, in normal mode, with the memory
+  *         address incremented.
+  * @param  Init: pointer to a DMA_XferInitTypeDef structure to initialize.
+  * @retval None
+  */
+void DMA_XferStructInit(DMA_XferInitTypeDef* Init)
+{
+  Init->Request = 0;
+  Init->PeriphAddress = 0;
+  Init->Direction = DMA_XFER_MEMORY_TO_PERIPH;
+  Init->PeriphDataSize = DMA_PeripheralDataSize_Byte;
+  Init->MemoryDataSize = DMA_MemoryDataSize_Byte;
+  Init->PeriphInc = DMA_PeripheralInc_Disable;
+  Init->MemoryInc = DMA_MemoryInc_Enable;
+  Init->Mode = DMA_Mode_Normal;
+  Init->Priority = DMA_Priority_Low;
+}
+
+/**
+  * @brief  Initializes a DMA transfer handle and configures its channel.
+  * @param  Handle: pointer to the DMA_XferHandleTypeDef structure to initialize.
+  *         The callbacks are cleared.
+  * @param  Instance: the channel, where y can be 1 or 2 to select the DMA and x
+  *         can be 1 to 7 for DMA1 and 1 to 5 for DMA2 to select the DMA Channel.
+  * @param  Init: pointer to a DMA_XferInitTypeDef structure that contains the
+  *         configuration of the transfers.
+  * @note   The channel is stopped and its interrupts are disabled.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the handle is ready
+  *          - ERROR: circular mode for a memory-to-memory copy
+  */
+ErrorStatus DMA_XferInit(DMA_XferHandleTypeDef* Handle, DMA_XferInstanceTypeDef* Instance,
+                         DMA_XferInitTypeDef* Init)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  uint32_t index = 0;
+
+  /* Check the parameters */
+  assert_param(IS_DMA_ALL_PERIPH(Instance));
+  assert_param(IS_DMA_XFER_DIRECTION(Init->Direction));
+  assert_param(IS_DMA_MODE(Init->Mode));
+
+  Handle->State = DMA_XFER_STATE_RESET;
+
+  if ((Init->Direction == DMA_XFER_MEMORY_TO_MEMORY) && (Init->Mode == DMA_Mode_Circular))
+  {
+    return ERROR;
+  }
+
+  /* The flags of a channel are 4 bits, at the position of the channel */
+  index = ((((uint32_t)Instance) & 0xFF) - DMA_XFER_CHANNEL_OFFSET) / DMA_XFER_CHANNEL_SIZE;
+
+  Handle->Instance = Instance;
+  Handle->HalfCallback = 0;
+  Handle->CompleteCallback = 0;
+  Handle->ErrorCallback = 0;
+  Handle->Mode = Init->Mode;
+  Handle->Flags = index * 4;
+  if ((uint32_t)Instance >= DMA2_BASE)
+  {
+    Handle->Flags |= DMA_XFER_DMA2;
+  }
+
+  DMA_XferDisable(Handle);
+  DMA_DeInit(Instance);
+
+  DMA_InitStructure.DMA_PeripheralBaseAddr = Init->PeriphAddress;
+  DMA_InitStructure.DMA_MemoryBaseAddr = 0;
+  /* The peripheral port is the source of the memory-to-memory transfers */
+  if (Init->Direction == DMA_XFER_MEMORY_TO_MEMORY)
+  {
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Enable;
+  }
+  else
+  {
+    DMA_InitStructure.DMA_DIR = Init->Direction;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+  }
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_PeripheralInc = Init->PeriphInc;
+  DMA_InitStructure.DMA_MemoryInc = Init->MemoryInc;
+  DMA_InitStructure.DMA_PeripheralDataSize = Init->PeriphDataSize;
+  DMA_InitStructure.DMA_MemoryDataSize = Init->MemoryDataSize;
+  DMA_InitStructure.DMA_Mode = Init->Mode;
+  DMA_InitStructure.DMA_Priority = Init->Priority;
+  DMA_Init(Instance, &DMA_InitStructure);
+
+  Handle->State = DMA_XFER_STATE_READY;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts a transfer between the peripheral and a memory buffer.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @param  MemoryAddress: address of the buffer, or of the destination for a
+  *         memory-to-memory copy.
+  * @param  Count: number of data items to transfer, from 1 to 65535.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the transfer is started
+  *          - ERROR: a transfer is in progress
+  */
+ErrorStatus DMA_XferStart(DMA_XferHandleTypeDef* Handle, uint32_t MemoryAddress, uint16_t Count)
+{
+  uint32_t it = DMA_IT_TC | DMA_IT_TE;
+
+  /* Check the parameters */
+  assert_param(Count != 0);
+
+  if ((Handle->State == DMA_XFER_STATE_RESET) || (Handle->State == DMA_XFER_STATE_BUSY))
+  {
+    return ERROR;
+  }
+
+  /* The address and the counter are written while the channel is disabled */
+  DMA_XferDisable(Handle);
+
+  Handle->Instance->CMAR = MemoryAddress;
+  DMA_SetCurrDataCounter(Handle->Instance, Count);
+
+  if (Handle->HalfCallback != 0)
+  {
+    it |= DMA_IT_HT;
+  }
+  DMA_ITConfig(Handle->Instance, it, ENABLE);
+
+  Handle->State = DMA_XFER_STATE_BUSY;
+  DMA_Cmd(Handle->Instance, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts a memory-to-memory copy.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit() with the DMA_XFER_MEMORY_TO_MEMORY direction.
+  * @param  DstAddress: address of the destination.
+  * @param  SrcAddress: address of the source.
+  * @param  Count: number of data items to copy, from 1 to 65535.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the copy is started
+  *          - ERROR: a transfer is in progress
+  */
+ErrorStatus DMA_XferCopy(DMA_XferHandleTypeDef* Handle, uint32_t DstAddress, uint32_t SrcAddress,
+                         uint16_t Count)
+{
+  if (Handle->State == DMA_XFER_STATE_BUSY)
+  {
+    return ERROR;
+  }
+
+  /* The peripheral port is the source of the memory-to-memory transfers */
+  DMA_XferDisable(Handle);
+  Handle->Instance->CPAR = SrcAddress;
+
+  return DMA_XferStart(Handle, DstAddress, Count);
+}
+
+/**
+  * @brief  Stops the transfer in progress. The callbacks are not called.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @retval None
+  */
+void DMA_XferStop(DMA_XferHandleTypeDef* Handle)
+{
+  DMA_XferDisable(Handle);
+
+  if (Handle->State != DMA_XFER_STATE_RESET)
+  {
+    Handle->State = DMA_XFER_STATE_READY;
+  }
+}
+
+/**
+  * @brief  Returns the number of data items which remain to be transferred.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @retval The number of remaining data items. In circular mode, the position
+  *         in the buffer is the Count of DMA_XferStart() minus this value.
+  */
+uint16_t DMA_XferGetCount(DMA_XferHandleTypeDef* Handle)
+{
+  return DMA_GetCurrDataCounter(Handle->Instance);
+}
+
+/**
+  * @brief  Handles the interrupts of the channel of a transfer handle.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @note   This function must be called from the interrupt handler of the
+  *         channel. The callbacks may start a new transfer.
+  * @retval None
+  */
+void DMA_XferIRQHandler(DMA_XferHandleTypeDef* Handle)
+{
+  if (Handle->State != DMA_XFER_STATE_BUSY)
+  {
+    return;
+  }
+
+  if (DMA_GetITStatus(DMA_XFER_IT(Handle, DMA1_IT_TE1)) != RESET)
+  {
+    DMA_XferDisable(Handle);
+    Handle->State = DMA_XFER_STATE_ERROR;
+    TRACE_DMA(TRACE_EV_DMA_ERROR, Handle->Instance);
+
+    if (Handle->ErrorCallback != 0)
+    {
+      Handle->ErrorCallback(Handle);
+    }
+    return;
+  }
+
+  /* The flags are set even when their interrupt is disabled */
+  if ((Handle->HalfCallback != 0) && (DMA_GetITStatus(DMA_XFER_IT(Handle, DMA1_IT_HT1)) != RESET))
+  {
+    DMA_ClearITPendingBit(DMA_XFER_IT(Handle, DMA1_IT_HT1));
+    TRACE_DMA(TRACE_EV_DMA_HALF, Handle->Instance);
+    Handle->HalfCallback(Handle);
+  }
+
+  if (DMA_GetITStatus(DMA_XFER_IT(Handle, DMA1_IT_TC1)) != RESET)
+  {
+    DMA_ClearITPendingBit(DMA_XFER_IT(Handle, DMA1_IT_TC1));
+    TRACE_DMA(TRACE_EV_DMA_TC, Handle->Instance);
+
+    if (Handle->Mode != DMA_Mode_Circular)
+    {
+      /* The channel stays enabled at the end of a normal transfer */
+      DMA_XferDisable(Handle);
+      Handle->State = DMA_XFER_STATE_READY;
+    }
+
+    if (Handle->CompleteCallback != 0)
+    {
+      Handle->CompleteCallback(Handle);
+    }
+  }
+}
+
+/**
+  * @brief  Disables the channel and its interrupts, and clears its flags.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure.
+  * @retval None
+  */
+static void DMA_XferDisable(DMA_XferHandleTypeDef* Handle)
+{
+  DMA_ITConfig(Handle->Instance, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE, DISABLE);
+  DMA_Cmd(Handle->Instance, DISABLE);
+  DMA_ClearITPendingBit(DMA_XFER_IT(Handle, DMA1_IT_GL1));
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
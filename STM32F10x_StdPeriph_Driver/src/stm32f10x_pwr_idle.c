@@ -0,0 +1,482 @@
+/**
+  ******************************************************************************
+  * @file    stm32f10x_pwr_idle.c
+  * @author  MCD Application Team
+  * @version V3.6.1
+  * @date    05-March-2012
+  * @brief   This file provides a low power idle manager:
+  *           - Clients with a maximum wake-up latency and an activity state
+  *           - Choice of the SLEEP or STOP mode for each idle period
+  *           - Restart of the system clock after STOP
+  *           - Residency statistics of the modes
+  *          It uses the stm32f10x_pwr.c/.h and stm32f10x_rcc.c/.h drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Configure the system clock, then call PWR_IdleInit() with a
+  *             counter which keeps running in STOP mode, or with 0 when the
+  *             residency is not needed.
+  *
+  *          2. Each driver which limits the low power modes registers using
+  *             PWR_IdleRegister() with the longest wake-up latency it accepts,
+  *             changes it using PWR_IdleSetLatency(), and reports its
+  *             activity (DMA transfer in progress, USB not suspended...)
+  *             using PWR_IdleBusy().
+  *
+  *          3. Call PWR_IdleEnter() from the idle loop of the application,
+  *             in thread mode and with the interrupts enabled.
+  *
+  *          4. When the sleep-on-exit mode is enabled by
+  *             PWR_IdleSleepOnExitCmd(), the interrupt which has work for the
+  *             idle loop calls PWR_IdleResume().
+  *
+  *          ===================================================================
+  *                                   Mode selection
+  *          ===================================================================
+  *          PWR_IdleEnter() chooses the mode of each idle period, with the
+  *          interrupts masked so that no client changes its state in between:
+  *            - When no client is busy and all the latencies are at least
+  *              PWR_IDLE_STOPLP_LATENCY: STOP mode with the low power
+  *              regulator.
+  *            - When no client is busy and all the latencies are at least
+  *              PWR_IDLE_STOP_LATENCY: STOP mode with the main regulator ON.
+  *            - Else the sleep-on-exit mode when enabled, or the SLEEP mode.
+  *
+  *          The PLL configuration, the bus prescalers and the FLASH latency
+  *          are kept in STOP mode, but the device wakes up on the HSI with the
+  *          HSE and the PLLs off. Before the interrupt which woke the device
+  *          up is taken, the HSE and the PLLs which were ON are started again
+  *          and the system clock source is restored: the SetSysClock()
+  *          sequence of the startup is not run again.
+  *
+  *          In sleep-on-exit mode, the CPU goes back to SLEEP at the end of
+  *          each interrupt and only returns from PWR_IdleEnter() after an
+  *          interrupt called PWR_IdleResume(): the residency of this mode
+  *          includes the interrupts.
+  *
+  * @note   The SysTick and the other peripheral clocks stop in STOP mode:
+  *         the drivers which rely on them must stay busy or register a
+  *         latency lower than PWR_IDLE_STOP_LATENCY.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f10x_pwr_idle.h"
+
+/** @addtogroup STM32F10x_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup PWR
+  * @brief PWR driver modules
+  * @{
+  */
+
+/** @defgroup PWR_Idle_Private_TypesDefinitions
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup PWR_Idle_Private_Defines
+  * @{
+  */
+
+#define PWR_IDLE_TIMEOUT          ((uint32_t)0x00010000)
+
+/**
+  * @}
+  */
+
+/** @defgroup PWR_Idle_Private_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup PWR_Idle_Private_Variables
+  * @{
+  */
+
+static PWR_IdleTimeBase PWR_IdleTimeBaseFn = 0;
+static uint32_t PWR_IdleLatency[PWR_IDLE_MAX_CLIENTS];
+static uint32_t PWR_IdleNbClients = 0;
+static volatile uint32_t PWR_IdleBusyMask = 0;
+static FunctionalState PWR_IdleSleepOnExit = DISABLE;
+static volatile uint8_t PWR_IdleWake = 0;
+static PWR_IdleStatsTypeDef PWR_IdleStats;
+
+/* RCC state saved before STOP */
+static uint32_t PWR_IdleRCC_CR = 0;
+static uint32_t PWR_IdleRCC_SW = 0;
+
+/**
+  * @}
+  */
+
+/** @defgroup PWR_Idle_Private_FunctionPrototypes
+  * @{
+  */
+
+static ErrorStatus PWR_IdleRestore(void);
+
+/**
+  * @}
+  */
+
+/** @defgroup PWR_Idle_Private_Functions
+  * @{
+  */
+
+
+/**
+  * @brief  Initializes the low power idle manager.
+  * @note   The clients and the statistics are reset.
+  * @param  TimeBase: counter used for the residency, which keeps running in
+  *         STOP mode, or 0 to count the entries only.
+  * @retval None
+  */
+void PWR_IdleInit(PWR_IdleTimeBase TimeBase)
+{
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+
+  PWR_IdleTimeBaseFn = TimeBase;
+  PWR_IdleNbClients = 0;
+  PWR_IdleBusyMask = 0;
+  PWR_IdleSleepOnExit = DISABLE;
+
+  PWR_IdleResetStats();
+}
+
+/**
+  * @brief  Registers a client of the idle manager, not busy.
+  * @param  MaxLatency: longest wake-up latency accepted by the client in us,
+  *         or PWR_IDLE_NO_LATENCY.
+  * @param  Id: receives the identifier of the client.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the client is registered
+  *          - ERROR: PWR_IDLE_MAX_CLIENTS clients are already registered
+  */
+ErrorStatus PWR_IdleRegister(uint32_t MaxLatency, uint8_t* Id)
+{
+  if (PWR_IdleNbClients == PWR_IDLE_MAX_CLIENTS)
+  {
+    return ERROR;
+  }
+
+  PWR_IdleLatency[PWR_IdleNbClients] = MaxLatency;
+  *Id = (uint8_t)PWR_IdleNbClients++;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Changes the longest wake-up latency accepted by a client.
+  * @param  Id: identifier of the client.
+  * @param  MaxLatency: the latency in us, or PWR_IDLE_NO_LATENCY.
+  * @retval None
+  */
+void PWR_IdleSetLatency(uint8_t Id, uint32_t MaxLatency)
+{
+  /* Check the parameters */
+  assert_param(Id < PWR_IdleNbClients);
+
+  PWR_IdleLatency[Id] = MaxLatency;
+}
+
+/**
+  * @brief  Reports the activity of a client: a busy client forbids STOP.
+  * @note   This function can be called from an interrupt.
+  * @param  Id: identifier of the client.
+  * @param  NewState: new state of the client.
+  *          This parameter can be: ENABLE (busy) or DISABLE (idle).
+  * @retval None
+  */
+void PWR_IdleBusy(uint8_t Id, FunctionalState NewState)
+{
+  uint32_t primask = 0;
+
+  /* Check the parameters */
+  assert_param(Id < PWR_IdleNbClients);
+  assert_param(IS_FUNCTIONAL_STATE(NewState));
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (NewState != DISABLE)
+  {
+    PWR_IdleBusyMask |= (uint32_t)1 << Id;
+  }
+  else
+  {
+    PWR_IdleBusyMask &= ~((uint32_t)1 << Id);
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Enables or disables the sleep-on-exit mode, used instead of the
+  *         SLEEP mode.
+  * @param  NewState: new state of the sleep-on-exit mode.
+  *          This parameter can be: ENABLE or DISABLE.
+  * @retval None
+  */
+void PWR_IdleSleepOnExitCmd(FunctionalState NewState)
+{
+  /* Check the parameters */
+  assert_param(IS_FUNCTIONAL_STATE(NewState));
+
+  PWR_IdleSleepOnExit = NewState;
+}
+
+/**
+  * @brief  Enters the deepest low power mode allowed by the clients, until
+  *         an interrupt.
+  * @note   On return, the interrupt which woke the device up has been taken
+  *         with the system clock restored.
+  * @param  None
+  * @retval The mode entered: a value of @ref PWR_Idle_Modes.
+  */
+uint8_t PWR_IdleEnter(void)
+{
+  uint32_t latency = PWR_IDLE_NO_LATENCY, start = 0, n = 0;
+  uint8_t mode = PWR_IdleMode_Sleep;
+
+  __disable_irq();
+
+  for (n = 0; n < PWR_IdleNbClients; n++)
+  {
+    if (PWR_IdleLatency[n] < latency)
+    {
+      latency = PWR_IdleLatency[n];
+    }
+  }
+
+  if ((PWR_IdleBusyMask == 0) && (latency >= PWR_IDLE_STOP_LATENCY))
+  {
+    mode = (latency >= PWR_IDLE_STOPLP_LATENCY) ? PWR_IdleMode_StopLowPower : PWR_IdleMode_Stop;
+  }
+  else
+  {
+    if (latency >= PWR_IDLE_STOP_LATENCY)
+    {
+      PWR_IdleStats.BusyDenied++;
+    }
+    else if (PWR_IdleBusyMask == 0)
+    {
+      PWR_IdleStats.LatencyDenied++;
+    }
+    mode = (PWR_IdleSleepOnExit != DISABLE) ? PWR_IdleMode_SleepOnExit : PWR_IdleMode_Sleep;
+  }
+
+  if (PWR_IdleTimeBaseFn != 0)
+  {
+    start = PWR_IdleTimeBaseFn();
+  }
+
+  switch (mode)
+  {
+    case PWR_IdleMode_Stop:
+    case PWR_IdleMode_StopLowPower:
+      PWR_IdleRCC_CR = RCC->CR;
+      PWR_IdleRCC_SW = RCC->CFGR & RCC_CFGR_SW;
+
+      PWR_EnterSTOPMode((mode == PWR_IdleMode_StopLowPower) ? PWR_Regulator_LowPower : PWR_Regulator_ON,
+                        PWR_STOPEntry_WFI);
+
+      if (PWR_IdleRestore() != SUCCESS)
+      {
+        /* Keep running on the clock which started */
+        PWR_IdleStats.RestoreFail++;
+        SystemCoreClockUpdate();
+      }
+      break;
+
+    case PWR_IdleMode_SleepOnExit:
+      PWR_IdleWake = 0;
+      SCB->SCR |= SCB_SCR_SLEEPONEXIT_Msk;
+      __enable_irq();
+
+      /* Only an interrupt calling PWR_IdleResume() returns to this loop */
+      while (PWR_IdleWake == 0)
+      {
+        __WFI();
+      }
+
+      __disable_irq();
+      break;
+
+    default:
+      __WFI();
+      break;
+  }
+
+  if (PWR_IdleTimeBaseFn != 0)
+  {
+    PWR_IdleStats.Residency[mode] += PWR_IdleTimeBaseFn() - start;
+  }
+  PWR_IdleStats.Count[mode]++;
+
+  __enable_irq();
+
+  return mode;
+}
+
+/**
+  * @brief  Ends the sleep-on-exit mode: PWR_IdleEnter() returns after the
+  *         interrupt.
+  * @note   This function is called from an interrupt.
+  * @param  None
+  * @retval None
+  */
+void PWR_IdleResume(void)
+{
+  SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+  PWR_IdleWake = 1;
+}
+
+/**
+  * @brief  Returns the idle statistics.
+  * @param  Stats: receives the statistics.
+  * @retval None
+  */
+void PWR_IdleGetStats(PWR_IdleStatsTypeDef* Stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *Stats = PWR_IdleStats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Resets the idle statistics.
+  * @param  None
+  * @retval None
+  */
+void PWR_IdleResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK(), n = 0;
+
+  __disable_irq();
+  for (n = 0; n < 4; n++)
+  {
+    PWR_IdleStats.Count[n] = 0;
+    PWR_IdleStats.Residency[n] = 0;
+  }
+  PWR_IdleStats.BusyDenied = 0;
+  PWR_IdleStats.LatencyDenied = 0;
+  PWR_IdleStats.RestoreFail = 0;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Starts again the HSE and the PLLs which were ON before STOP, and
+  *         restores the system clock source.
+  * @param  None
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the system clock is restored
+  *          - ERROR: the HSE or a PLL did not start
+  */
+static ErrorStatus PWR_IdleRestore(void)
+{
+  uint32_t timeout = 0;
+
+  if ((PWR_IdleRCC_CR & RCC_CR_HSEON) != 0)
+  {
+    RCC_HSEConfig(((PWR_IdleRCC_CR & RCC_CR_HSEBYP) != 0) ? RCC_HSE_Bypass : RCC_HSE_ON);
+    if (RCC_WaitForHSEStartUp() != SUCCESS)
+    {
+      return ERROR;
+    }
+  }
+
+#ifdef STM32F10X_CL
+  /* PLL2 may feed the PLL */
+  if ((PWR_IdleRCC_CR & RCC_CR_PLL2ON) != 0)
+  {
+    RCC_PLL2Cmd(ENABLE);
+    for (timeout = 0; (RCC_GetFlagStatus(RCC_FLAG_PLL2RDY) == RESET) && (timeout < PWR_IDLE_TIMEOUT); timeout++)
+    {
+    }
+    if (timeout == PWR_IDLE_TIMEOUT)
+    {
+      return ERROR;
+    }
+  }
+
+  if ((PWR_IdleRCC_CR & RCC_CR_PLL3ON) != 0)
+  {
+    RCC_PLL3Cmd(ENABLE);
+    for (timeout = 0; (RCC_GetFlagStatus(RCC_FLAG_PLL3RDY) == RESET) && (timeout < PWR_IDLE_TIMEOUT); timeout++)
+    {
+    }
+    if (timeout == PWR_IDLE_TIMEOUT)
+    {
+      return ERROR;
+    }
+  }
+#endif /* STM32F10X_CL */
+
+  if ((PWR_IdleRCC_CR & RCC_CR_PLLON) != 0)
+  {
+    RCC_PLLCmd(ENABLE);
+    for (timeout = 0; (RCC_GetFlagStatus(RCC_FLAG_PLLRDY) == RESET) && (timeout < PWR_IDLE_TIMEOUT); timeout++)
+    {
+    }
+    if (timeout == PWR_IDLE_TIMEOUT)
+    {
+      return ERROR;
+    }
+  }
+
+  /* The SWS bits are the SW bits shifted by 2 */
+  RCC_SYSCLKConfig(PWR_IdleRCC_SW);
+  while (RCC_GetSYSCLKSource() != (uint8_t)(PWR_IdleRCC_SW << 2))
+  {
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
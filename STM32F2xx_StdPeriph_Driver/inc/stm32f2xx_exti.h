@@ -92,6 +92,14 @@ typedef struct
                                          This parameter can be set either to ENABLE or DISABLE */ 
 }EXTI_InitTypeDef;
 
+/** 
+  * @brief  EXTI line callback: called by EXTI_Dispatch() with the EXTI_Linex
+  *         of the pending line and the DWT cycle counter read at the entry
+  *         of the dispatch.
+  */
+
+typedef void (*EXTI_CallbackTypeDef)(uint32_t EXTI_Line, uint32_t Timestamp);
+
 /* Exported constants --------------------------------------------------------*/
 
 /** @defgroup EXTI_Exported_Constants
@@ -141,6 +149,12 @@ typedef struct
                                 ((LINE) == EXTI_Line20) || ((LINE) == EXTI_Line21) ||\
                                 ((LINE) == EXTI_Line22))
                     
+#define EXTI_LINE_NUMBER    23                     /*!< Number of EXTI lines */
+
+/* Lines sharing an interrupt vector, for EXTI_Dispatch() */
+#define EXTI_Lines_9_5      ((uint32_t)0x003E0)   /*!< Lines of EXTI9_5_IRQHandler */
+#define EXTI_Lines_15_10    ((uint32_t)0x0FC00)   /*!< Lines of EXTI15_10_IRQHandler */
+
 /**
   * @}
   */
@@ -166,6 +180,11 @@ void EXTI_ClearFlag(uint32_t EXTI_Line);
 ITStatus EXTI_GetITStatus(uint32_t EXTI_Line);
 void EXTI_ClearITPendingBit(uint32_t EXTI_Line);
 
+/* Fast dispatch functions ****************************************************/
+void EXTI_SetCallback(uint32_t EXTI_Line, EXTI_CallbackTypeDef Callback);
+void EXTI_TimestampCmd(FunctionalState NewState);
+void EXTI_Dispatch(uint32_t EXTI_Lines);
+
 #ifdef __cplusplus
 }
 #endif
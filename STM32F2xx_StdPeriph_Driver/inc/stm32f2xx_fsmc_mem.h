@@ -0,0 +1,170 @@
+/**
+  ******************************************************************************
+  * @file    stm32f2xx_fsmc_mem.h
+  * @author  MCD Application Team
+  * @version V1.1.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the FSMC
+  *          external SRAM/PSRAM memory service.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F2xx_FSMC_MEM_H
+#define __STM32F2xx_FSMC_MEM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_fsmc.h"
+
+/** @addtogroup STM32F2xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup FSMC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  FSMC external memory Init structure definition: the parameters
+  *         of the memory datasheet, from which the FSMC timings are computed
+  */
+
+typedef struct
+{
+  uint32_t Bank;                 /*!< This parameter can be a value of @ref FSMC_NORSRAM_Bank */
+
+  uint32_t MemoryType;           /*!< FSMC_MemoryType_SRAM or FSMC_MemoryType_PSRAM */
+
+  uint32_t DataWidth;            /*!< This parameter can be a value of @ref FSMC_Data_Width */
+
+  uint32_t Size;                 /*!< Size of the memory in bytes, up to 64 Mbytes. */
+
+  uint32_t Mode;                 /*!< This parameter can be a value of @ref FSMC_Mem_Mode */
+
+  uint32_t AddressSetup;         /*!< Asynchronous mode: address setup time before the
+                                      write enable (tAS), in ns. */
+
+  uint32_t AccessTime;           /*!< Asynchronous mode: address access time (tAA), in ns. */
+
+  uint32_t ReadCycle;            /*!< Asynchronous mode: read cycle time (tRC), in ns. */
+
+  uint32_t WritePulse;           /*!< Asynchronous mode: write pulse width (tWP), in ns. */
+
+  uint32_t WriteCycle;           /*!< Asynchronous mode: write cycle time (tWC), in ns. */
+
+  uint32_t BusTurnAround;        /*!< Output disable to high impedance time (tHZ), in ns. */
+
+  uint32_t MaxClock;             /*!< Synchronous burst mode: highest clock frequency of the
+                                      memory, in Hz. */
+
+  uint32_t Latency;              /*!< Synchronous burst mode: clock cycles before the first
+                                      data, from 2 to 17. Not used with the wait signal. */
+
+  uint32_t WaitSignal;           /*!< Synchronous burst mode: FSMC_WaitSignal_Enable to let the
+                                      memory insert the wait states, or FSMC_WaitSignal_Disable. */
+}FSMC_MemInitTypeDef;
+
+/**
+  * @brief  FSMC external memory region definition
+  */
+
+typedef struct
+{
+  uint32_t Base;                 /*!< Address of the memory, set by FSMC_MemInit(). */
+
+  uint32_t Size;                 /*!< Size of the memory in bytes, set by FSMC_MemInit(). */
+
+  uint32_t Free;                 /*!< Reserved: offset of the space not given by FSMC_MemAlloc(). */
+}FSMC_MemTypeDef;
+
+/**
+  * @brief  FSMC external memory bandwidth, in Kbytes per second. The second
+  *         index is 0 for 8-bit, 1 for 16-bit and 2 for 32-bit accesses.
+  */
+
+typedef struct
+{
+  uint32_t SeqRead[3];           /*!< Sequential reads */
+
+  uint32_t SeqWrite[3];          /*!< Sequential writes */
+
+  uint32_t RandRead[3];          /*!< Reads at pseudo-random addresses */
+
+  uint32_t RandWrite[3];         /*!< Writes at pseudo-random addresses */
+}FSMC_MemBenchTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup FSMC_Mem_Mode
+  * @{
+  */
+#define FSMC_MEM_ASYNC                 ((uint32_t)0x00000000)  /*!< Asynchronous accesses, mode A */
+#define FSMC_MEM_SYNC_BURST            ((uint32_t)0x00000001)  /*!< Synchronous burst reads and writes */
+#define IS_FSMC_MEM_MODE(MODE)         (((MODE) == FSMC_MEM_ASYNC) || \
+                                        ((MODE) == FSMC_MEM_SYNC_BURST))
+/**
+  * @}
+  */
+
+#define IS_FSMC_MEM_TYPE(TYPE)         (((TYPE) == FSMC_MemoryType_SRAM) || \
+                                        ((TYPE) == FSMC_MemoryType_PSRAM))
+#define IS_FSMC_MEM_SIZE(SIZE)         (((SIZE) != 0) && ((SIZE) <= 0x04000000))
+#define IS_FSMC_MEM_ALIGN(ALIGN)       (((ALIGN) != 0) && (((ALIGN) & ((ALIGN) - 1)) == 0))
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Address of a NOR/SRAM bank: 0x60000000, 0x64000000, 0x68000000 or 0x6C000000 */
+#define FSMC_MEM_BANK_ADDR(BANK)       ((uint32_t)0x60000000 + ((uint32_t)(BANK) << 25))
+
+/* Exported functions --------------------------------------------------------*/
+
+/* External memory functions **************************************************/
+void FSMC_MemStructInit(FSMC_MemInitTypeDef* Init);
+void FSMC_MemComputeTiming(const FSMC_MemInitTypeDef* Init, uint32_t HCLK_Frequency,
+                           FSMC_NORSRAMTimingInitTypeDef* ReadTiming,
+                           FSMC_NORSRAMTimingInitTypeDef* WriteTiming);
+ErrorStatus FSMC_MemInit(FSMC_MemTypeDef* Mem, const FSMC_MemInitTypeDef* Init);
+void* FSMC_MemAlloc(FSMC_MemTypeDef* Mem, uint32_t Size, uint32_t Align);
+uint32_t FSMC_MemGetFree(FSMC_MemTypeDef* Mem);
+
+/* Bandwidth benchmark function ***********************************************/
+ErrorStatus FSMC_MemBenchmark(FSMC_MemTypeDef* Mem, uint32_t Length, FSMC_MemBenchTypeDef* Result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F2xx_FSMC_MEM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
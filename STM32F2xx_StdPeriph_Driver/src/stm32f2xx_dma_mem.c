@@ -0,0 +1,595 @@
+/**
+  ******************************************************************************
+  * @file    stm32f2xx_dma_mem.c
+  * @author  MCD Application Team
+  * @version V1.1.2
+  * @date    05-March-2012
+  * @brief   This file provides memory copy and fill functions running on a DMA2
+  *          stream, in memory-to-memory mode:
+  *           - Asynchronous copy and fill, with polling or completion callback
+  *           - Queue of the requests
+  *           - Copy and fill by the CPU below a size threshold
+  *          It uses the stm32f2xx_dma_xfer.c/.h drivers to access the DMA stream.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the DMA2 controller clock using
+  *             RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE) function.
+  *
+  *          2. Call DMA_MemInit() once, with a free DMA2 stream. The stream
+  *             interrupt is enabled in the NVIC: set its priority using
+  *             NVIC_SetPriority() and call DMA_MemIRQHandler() from its
+  *             interrupt handler, for example:
+  *               void DMA2_Stream1_IRQHandler(void)
+  *               {
+  *                 DMA_MemIRQHandler();
+  *               }
+  *
+  *          3. Start a copy using DMA_MemCopy(), or a fill using DMA_MemSet().
+  *             The requests are run in order, one after the other. The request
+  *             structure belongs to the driver until its Callback is called or
+  *             its Status is DMA_MEM_DONE or DMA_MEM_ERROR:
+  *               while (Request.Status < DMA_MEM_DONE)
+  *               {
+  *                 Other computation...
+  *               }
+  *
+  * @note   A request shorter than DMA_MEM_THRESHOLD bytes, given while no other
+  *         request is queued, is run by the CPU before DMA_MemCopy() or
+  *         DMA_MemSet() returns, and its Callback is called from there.
+  *         The other requests end in the interrupt handler, which calls their
+  *         Callback. The Callback may queue a new request.
+  *
+  * @note   The bytes before the first word of the destination and after its
+  *         last word are written by the CPU when the request starts. When the
+  *         source and the destination do not have the same alignment, the DMA
+  *         reads the source by bytes and writes the destination by words.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_dma_mem.h"
+
+/** @addtogroup STM32F2xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup DMA
+  * @brief DMA driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define DMA_MEM_TYPE_COPY       ((uint32_t)0x00000000)
+#define DMA_MEM_TYPE_SET        ((uint32_t)0x00000001)
+
+/* Configurations of the stream: source read by words or by bytes, source
+   address incremented (copy) or fixed (fill) */
+#define DMA_MEM_CONFIG_NONE     ((uint32_t)0xFFFFFFFF)
+#define DMA_MEM_CONFIG_BYTE     ((uint32_t)0x00000001)
+#define DMA_MEM_CONFIG_FIXED    ((uint32_t)0x00000002)
+
+/* Data items of a transfer: a multiple of 4 for the bytes to words packing */
+#define DMA_MEM_MAX_COUNT       ((uint32_t)0xFFFC)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Interrupt of each DMA2 stream */
+static const IRQn_Type DMA_MemIRQnTable[8] =
+{
+  DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+  DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn
+};
+
+static DMA_XferHandleTypeDef DMA_MemHandle;
+static DMA_XferInitTypeDef DMA_MemXferInit;
+static uint32_t DMA_MemConfig = DMA_MEM_CONFIG_NONE;
+static IRQn_Type DMA_MemIRQn;
+static DMA_MemRequestTypeDef* DMA_MemHead = 0;
+static DMA_MemRequestTypeDef* DMA_MemTail = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static ErrorStatus DMA_MemSubmit(DMA_MemRequestTypeDef* Request);
+static void DMA_MemStart(void);
+static void DMA_MemPrepare(DMA_MemRequestTypeDef* Request);
+static void DMA_MemNext(DMA_MemRequestTypeDef* Request);
+static void DMA_MemConfigure(uint32_t Config);
+static void DMA_MemEnd(uint32_t Status);
+static void DMA_MemComplete(DMA_XferHandleTypeDef* Handle);
+static void DMA_MemError(DMA_XferHandleTypeDef* Handle);
+static void DMA_MemCpuCopy(uint32_t Dst, uint32_t Src, uint32_t Length);
+static void DMA_MemCpuSet(uint32_t Dst, uint32_t Pattern, uint32_t Length);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup DMA_Private_Functions
+  * @{
+  */
+
+/** @defgroup DMA_Group6 DMA memory copy and fill functions
+ *  @brief   DMA memory copy and fill functions
+ *
+@verbatim
+ ===============================================================================
+                       DMA memory copy and fill functions
+ ===============================================================================
+
+  This subsection provides functions allowing to copy and fill memory buffers
+  with a DMA2 stream, while the CPU goes on with its computation. The stream
+  moves words through its FIFO: the CPU only writes the unaligned bytes at both
+  ends of the destination.
+
+  A fill reads a word holding the value, with the source address fixed. The
+  transfers are limited to DMA_MEM_MAX_COUNT data items: longer requests are run
+  as several transfers, started by the interrupt handler.
+
+  Below DMA_MEM_THRESHOLD bytes, the time to set up the stream and to handle its
+  interrupt is longer than the copy itself, which is then done by the CPU, by
+  words when the source and the destination have the same alignment.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the DMA memory copy and fill functions.
+  * @param  DMAy_Streamx: the DMA2 stream used for the requests, where x can be
+  *         0 to 7. It must not be used by another driver.
+  * @param  Priority: the software priority of the stream.
+  *          This parameter can be a value of @ref DMA_priority_level.
+  * @note   The stream interrupt is enabled in the NVIC.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the functions are ready
+  *          - ERROR: the stream is not a DMA2 stream
+  */
+ErrorStatus DMA_MemInit(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t Priority)
+{
+  /* Check the parameters */
+  assert_param(IS_DMA_PRIORITY(Priority));
+
+  DMA_XferStructInit(&DMA_MemXferInit);
+  DMA_MemXferInit.Direction = DMA_XFER_MEMORY_TO_MEMORY;
+  DMA_MemXferInit.MemoryDataSize = DMA_MemoryDataSize_Word;
+  DMA_MemXferInit.Priority = Priority;
+
+  DMA_MemHead = 0;
+  DMA_MemTail = 0;
+  DMA_MemConfig = DMA_MEM_CONFIG_NONE;
+  DMA_MemHandle.Instance = DMAy_Streamx;
+  DMA_MemConfigure(0);
+
+  if (DMA_MemHandle.State == DMA_XFER_STATE_RESET)
+  {
+    return ERROR;
+  }
+
+  DMA_MemIRQn = DMA_MemIRQnTable[DMA_MemHandle.Flags];
+  NVIC_ClearPendingIRQ(DMA_MemIRQn);
+  NVIC_EnableIRQ(DMA_MemIRQn);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Copies a memory buffer.
+  * @param  Request: pointer to the request structure. Its Callback and Context
+  *         members must be set.
+  * @param  Dst: address of the destination.
+  * @param  Src: address of the source. The buffers must not overlap.
+  * @param  Length: number of bytes to copy.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the copy is queued, or done
+  *          - ERROR: DMA_MemInit() has not been called
+  */
+ErrorStatus DMA_MemCopy(DMA_MemRequestTypeDef* Request, void* Dst, const void* Src, uint32_t Length)
+{
+  Request->Type = DMA_MEM_TYPE_COPY;
+  Request->Dst = (uint32_t)Dst;
+  Request->Src = (uint32_t)Src;
+  Request->Length = Length;
+
+  return DMA_MemSubmit(Request);
+}
+
+/**
+  * @brief  Fills a memory buffer with a value.
+  * @param  Request: pointer to the request structure. Its Callback and Context
+  *         members must be set.
+  * @param  Dst: address of the destination.
+  * @param  Value: the value of the bytes.
+  * @param  Length: number of bytes to fill.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the fill is queued, or done
+  *          - ERROR: DMA_MemInit() has not been called
+  */
+ErrorStatus DMA_MemSet(DMA_MemRequestTypeDef* Request, void* Dst, uint8_t Value, uint32_t Length)
+{
+  Request->Type = DMA_MEM_TYPE_SET;
+  Request->Dst = (uint32_t)Dst;
+  Request->Pattern = (uint32_t)Value * (uint32_t)0x01010101;
+  Request->Src = (uint32_t)&Request->Pattern;
+  Request->Length = Length;
+
+  return DMA_MemSubmit(Request);
+}
+
+/**
+  * @brief  Handles the interrupt of the stream of the copy and fill functions.
+  * @note   This function must be called from the interrupt handler of the
+  *         stream given to DMA_MemInit().
+  * @retval None
+  */
+void DMA_MemIRQHandler(void)
+{
+  DMA_XferIRQHandler(&DMA_MemHandle);
+}
+
+/**
+  * @brief  Queues a request, or runs it by the CPU when it is short and no
+  *         other request is queued.
+  * @param  Request: pointer to the request structure.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the request is queued, or done
+  *          - ERROR: DMA_MemInit() has not been called
+  */
+static ErrorStatus DMA_MemSubmit(DMA_MemRequestTypeDef* Request)
+{
+  if (DMA_MemHandle.State == DMA_XFER_STATE_RESET)
+  {
+    return ERROR;
+  }
+
+  Request->Status = DMA_MEM_QUEUED;
+  Request->Next = 0;
+
+  /* The interrupt handler of the stream updates the queue too */
+  NVIC_DisableIRQ(DMA_MemIRQn);
+
+  if ((DMA_MemHead == 0) && (Request->Length < DMA_MEM_THRESHOLD))
+  {
+    NVIC_EnableIRQ(DMA_MemIRQn);
+
+    if (Request->Type == DMA_MEM_TYPE_COPY)
+    {
+      DMA_MemCpuCopy(Request->Dst, Request->Src, Request->Length);
+    }
+    else
+    {
+      DMA_MemCpuSet(Request->Dst, Request->Pattern, Request->Length);
+    }
+    Request->Status = DMA_MEM_DONE;
+
+    if (Request->Callback != 0)
+    {
+      Request->Callback(Request);
+    }
+    return SUCCESS;
+  }
+
+  if (DMA_MemTail != 0)
+  {
+    DMA_MemTail->Next = Request;
+  }
+  else
+  {
+    DMA_MemHead = Request;
+  }
+  DMA_MemTail = Request;
+
+  DMA_MemStart();
+
+  NVIC_EnableIRQ(DMA_MemIRQn);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts the first queued request when the stream is idle. The requests
+  *         left without data for the DMA are completed.
+  * @param  None
+  * @retval None
+  */
+static void DMA_MemStart(void)
+{
+  DMA_MemRequestTypeDef* request;
+
+  while ((DMA_MemHead != 0) && (DMA_MemHandle.State != DMA_XFER_STATE_BUSY))
+  {
+    request = DMA_MemHead;
+
+    if (request->Status == DMA_MEM_QUEUED)
+    {
+      request->Status = DMA_MEM_ACTIVE;
+      DMA_MemPrepare(request);
+    }
+
+    if (request->Length != 0)
+    {
+      DMA_MemNext(request);
+    }
+    else
+    {
+      DMA_MemEnd(DMA_MEM_DONE);
+    }
+  }
+}
+
+/**
+  * @brief  Writes the unaligned bytes at both ends of the destination with the
+  *         CPU, and selects the configuration of the stream for the words.
+  * @param  Request: pointer to the request structure.
+  * @retval None
+  */
+static void DMA_MemPrepare(DMA_MemRequestTypeDef* Request)
+{
+  uint32_t head = (0 - Request->Dst) & 3;
+  uint32_t body = 0;
+
+  if (head > Request->Length)
+  {
+    head = Request->Length;
+  }
+  body = (Request->Length - head) & ~(uint32_t)3;
+
+  if (Request->Type == DMA_MEM_TYPE_COPY)
+  {
+    DMA_MemCpuCopy(Request->Dst, Request->Src, head);
+    DMA_MemCpuCopy(Request->Dst + head + body, Request->Src + head + body,
+                   Request->Length - head - body);
+    Request->Src += head;
+  }
+  else
+  {
+    DMA_MemCpuSet(Request->Dst, Request->Pattern, head);
+    DMA_MemCpuSet(Request->Dst + head + body, Request->Pattern, Request->Length - head - body);
+  }
+
+  Request->Dst += head;
+  Request->Length = body;
+}
+
+/**
+  * @brief  Starts the transfer of the next part of a request.
+  * @param  Request: pointer to the request structure.
+  * @retval None
+  */
+static void DMA_MemNext(DMA_MemRequestTypeDef* Request)
+{
+  uint32_t config = 0, count = 0;
+
+  if (Request->Type == DMA_MEM_TYPE_SET)
+  {
+    config = DMA_MEM_CONFIG_FIXED;
+  }
+  else if ((Request->Src & 3) != 0)
+  {
+    config = DMA_MEM_CONFIG_BYTE;
+  }
+  DMA_MemConfigure(config);
+
+  count = (config == DMA_MEM_CONFIG_BYTE) ? Request->Length : (Request->Length >> 2);
+  if (count > DMA_MEM_MAX_COUNT)
+  {
+    count = DMA_MEM_MAX_COUNT;
+  }
+
+  DMA_XferCopy(&DMA_MemHandle, Request->Dst, Request->Src, (uint16_t)count);
+}
+
+/**
+  * @brief  Configures the stream, if its configuration changes.
+  * @param  Config: the configuration of the stream, a combination of
+  *         DMA_MEM_CONFIG_BYTE and DMA_MEM_CONFIG_FIXED.
+  * @retval None
+  */
+static void DMA_MemConfigure(uint32_t Config)
+{
+  if (Config != DMA_MemConfig)
+  {
+    DMA_MemXferInit.PeriphDataSize = ((Config & DMA_MEM_CONFIG_BYTE) != 0) ?
+                                     DMA_PeripheralDataSize_Byte : DMA_PeripheralDataSize_Word;
+    DMA_MemXferInit.PeriphInc = ((Config & DMA_MEM_CONFIG_FIXED) != 0) ?
+                                DMA_PeripheralInc_Disable : DMA_PeripheralInc_Enable;
+
+    if (DMA_XferInit(&DMA_MemHandle, DMA_MemHandle.Instance, &DMA_MemXferInit) == SUCCESS)
+    {
+      DMA_MemHandle.CompleteCallback = DMA_MemComplete;
+      DMA_MemHandle.ErrorCallback = DMA_MemError;
+      DMA_MemConfig = Config;
+    }
+  }
+}
+
+/**
+  * @brief  Removes the first request from the queue, starts the next one and
+  *         calls the Callback of the removed request.
+  * @param  Status: the final Status of the request.
+  * @retval None
+  */
+static void DMA_MemEnd(uint32_t Status)
+{
+  DMA_MemRequestTypeDef* request = DMA_MemHead;
+
+  DMA_MemHead = request->Next;
+  if (DMA_MemHead == 0)
+  {
+    DMA_MemTail = 0;
+  }
+  request->Status = Status;
+
+  DMA_MemStart();
+
+  if (request->Callback != 0)
+  {
+    request->Callback(request);
+  }
+}
+
+/**
+  * @brief  Ends a transfer: starts the next part of the request, or ends it.
+  * @param  Handle: pointer to the DMA_XferHandleTypeDef structure of the stream.
+  * @retval None
+  */
+static void DMA_MemComplete(DMA_XferHandleTypeDef* Handle)
+{
+  DMA_MemRequestTypeDef* request = DMA_MemHead;
+  uint32_t length = 0;
+
+  (void)Handle;
+
+  length = (DMA_MemConfig == DMA_MEM_CONFIG_BYTE) ? DMA_MEM_MAX_COUNT : (DMA_MEM_MAX_COUNT << 2);
+  if (length > request->Length)
+  {
+    length = request->Length;
+  }
+
+  request->Dst += length;
+  if (request->Type == DMA_MEM_TYPE_COPY)
+  {
+    request->Src += length;
+  }
+  request->Length -= length;
+
+  if (request->Length != 0)
+  {
+    DMA_MemNext(request);
+  }
+  else
+  {
+    DMA_MemEnd(DMA_MEM_DONE);
+  }
+}
+
+/**
+  * @brief  Ends a request on a transfer error.
+  * @param  Handle: pointer to the DMA_XferHandleTypeDef structure of the stream.
+  * @retval None
+  */
+static void DMA_MemError(DMA_XferHandleTypeDef* Handle)
+{
+  (void)Handle;
+
+  DMA_MemEnd(DMA_MEM_ERROR);
+}
+
+/**
+  * @brief  Copies bytes with the CPU, by words when the source and the
+  *         destination have the same alignment.
+  * @param  Dst: address of the destination.
+  * @param  Src: address of the source.
+  * @param  Length: number of bytes.
+  * @retval None
+  */
+static void DMA_MemCpuCopy(uint32_t Dst, uint32_t Src, uint32_t Length)
+{
+  uint8_t* dst = (uint8_t*)Dst;
+  const uint8_t* src = (const uint8_t*)Src;
+
+  if (((Dst ^ Src) & 3) == 0)
+  {
+    while ((((uint32_t)dst & 3) != 0) && (Length != 0))
+    {
+      *dst++ = *src++;
+      Length--;
+    }
+
+    while (Length >= 16)
+    {
+      ((uint32_t*)dst)[0] = ((const uint32_t*)src)[0];
+      ((uint32_t*)dst)[1] = ((const uint32_t*)src)[1];
+      ((uint32_t*)dst)[2] = ((const uint32_t*)src)[2];
+      ((uint32_t*)dst)[3] = ((const uint32_t*)src)[3];
+      dst += 16;
+      src += 16;
+      Length -= 16;
+    }
+
+    while (Length >= 4)
+    {
+      *(uint32_t*)dst = *(const uint32_t*)src;
+      dst += 4;
+      src += 4;
+      Length -= 4;
+    }
+  }
+
+  while (Length != 0)
+  {
+    *dst++ = *src++;
+    Length--;
+  }
+}
+
+/**
+  * @brief  Fills bytes with the CPU, by words.
+  * @param  Dst: address of the destination.
+  * @param  Pattern: the value of the bytes, repeated in the 4 bytes.
+  * @param  Length: number of bytes.
+  * @retval None
+  */
+static void DMA_MemCpuSet(uint32_t Dst, uint32_t Pattern, uint32_t Length)
+{
+  uint8_t* dst = (uint8_t*)Dst;
+
+  while ((((uint32_t)dst & 3) != 0) && (Length != 0))
+  {
+    *dst++ = (uint8_t)Pattern;
+    Length--;
+  }
+
+  while (Length >= 4)
+  {
+    *(uint32_t*)dst = Pattern;
+    dst += 4;
+    Length -= 4;
+  }
+
+  while (Length != 0)
+  {
+    *dst++ = (uint8_t)Pattern;
+    Length--;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,442 @@
+/**
+  ******************************************************************************
+  * @file    stm32f2xx_dma_xfer.c
+  * @author  MCD Application Team
+  * @version V1.1.2
+  * @date    05-March-2012
+  * @brief   This file provides DMA transfer functions with the same API on the
+  *          STM32F10x channels and on the STM32F2xx/STM32F4xx streams:
+  *           - Peripheral to memory and memory to peripheral transfers
+  *           - Circular mode with half transfer and transfer complete callbacks
+  *           - Memory-to-memory copy
+  *          It uses the stm32f2xx_dma.c/.h drivers to access the DMA streams.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the DMA controller clock using
+  *             RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA1, ENABLE) for DMA1 or
+  *             RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE) for DMA2.
+  *
+  *          2. Fill a DMA_XferInitTypeDef structure, starting from the default
+  *             values of DMA_XferStructInit(), and call DMA_XferInit() with a
+  *             DMA_XferHandleTypeDef structure and the stream of the request.
+  *             The Request member is the channel of the request on the stream.
+  *
+  *          3. Set the HalfCallback, CompleteCallback and ErrorCallback members
+  *             of the handle.
+  *
+  *          4. Enable the stream interrupt in the NVIC and call
+  *             DMA_XferIRQHandler() from its interrupt handler, for example:
+  *               void DMA2_Stream0_IRQHandler(void)
+  *               {
+  *                 DMA_XferIRQHandler(&AdcXfer);
+  *               }
+  *
+  *          5. Start a transfer using DMA_XferStart(), or a memory-to-memory
+  *             copy using DMA_XferCopy(), then activate the Stream Request
+  *             using PPP_DMACmd() function of the peripheral driver.
+  *             In normal mode the State of the handle goes back to
+  *             DMA_XFER_STATE_READY when the transfer is complete. In circular
+  *             mode the transfer restarts at the beginning of the buffer and
+  *             runs until DMA_XferStop() is called.
+  *
+  *          The stm32f10x_dma_xfer.c and stm32f4xx_dma_xfer.c drivers provide
+  *          the same API. On STM32F10x the instance is a channel and the
+  *          Request member is not used.
+  *
+  * @note   Memory-to-memory copies are possible on the DMA2 streams only.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_dma_xfer.h"
+
+/** @addtogroup STM32F2xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup DMA
+  * @brief DMA driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define DMA_XFER_STREAM_OFFSET  ((uint32_t)0x10)  /* Offset of the stream 0 registers */
+#define DMA_XFER_STREAM_SIZE    ((uint32_t)0x18)  /* Size of the registers of a stream */
+
+/* Private macro -------------------------------------------------------------*/
+/* Event records of cmsis_trace.h, when it is included by stm32f2xx_conf.h */
+#ifndef TRACE_DMA
+ #define TRACE_DMA(EVENT, INSTANCE)
+#endif
+/* Private variables ---------------------------------------------------------*/
+
+/* Flags of the stream number x, the same for DMA1 and DMA2 */
+static const uint32_t DMA_XferTCIF[8] =
+{
+  DMA_IT_TCIF0, DMA_IT_TCIF1, DMA_IT_TCIF2, DMA_IT_TCIF3,
+  DMA_IT_TCIF4, DMA_IT_TCIF5, DMA_IT_TCIF6, DMA_IT_TCIF7
+};
+
+static const uint32_t DMA_XferHTIF[8] =
+{
+  DMA_IT_HTIF0, DMA_IT_HTIF1, DMA_IT_HTIF2, DMA_IT_HTIF3,
+  DMA_IT_HTIF4, DMA_IT_HTIF5, DMA_IT_HTIF6, DMA_IT_HTIF7
+};
+
+static const uint32_t DMA_XferTEIF[8] =
+{
+  DMA_IT_TEIF0, DMA_IT_TEIF1, DMA_IT_TEIF2, DMA_IT_TEIF3,
+  DMA_IT_TEIF4, DMA_IT_TEIF5, DMA_IT_TEIF6, DMA_IT_TEIF7
+};
+
+static const uint32_t DMA_XferDMEIF[8] =
+{
+  DMA_IT_DMEIF0, DMA_IT_DMEIF1, DMA_IT_DMEIF2, DMA_IT_DMEIF3,
+  DMA_IT_DMEIF4, DMA_IT_DMEIF5, DMA_IT_DMEIF6, DMA_IT_DMEIF7
+};
+
+static const uint32_t DMA_XferAllIF[8] =
+{
+  DMA_IT_TCIF0 | DMA_IT_HTIF0 | DMA_IT_TEIF0 | DMA_IT_DMEIF0 | DMA_IT_FEIF0,
+  DMA_IT_TCIF1 | DMA_IT_HTIF1 | DMA_IT_TEIF1 | DMA_IT_DMEIF1 | DMA_IT_FEIF1,
+  DMA_IT_TCIF2 | DMA_IT_HTIF2 | DMA_IT_TEIF2 | DMA_IT_DMEIF2 | DMA_IT_FEIF2,
+  DMA_IT_TCIF3 | DMA_IT_HTIF3 | DMA_IT_TEIF3 | DMA_IT_DMEIF3 | DMA_IT_FEIF3,
+  DMA_IT_TCIF4 | DMA_IT_HTIF4 | DMA_IT_TEIF4 | DMA_IT_DMEIF4 | DMA_IT_FEIF4,
+  DMA_IT_TCIF5 | DMA_IT_HTIF5 | DMA_IT_TEIF5 | DMA_IT_DMEIF5 | DMA_IT_FEIF5,
+  DMA_IT_TCIF6 | DMA_IT_HTIF6 | DMA_IT_TEIF6 | DMA_IT_DMEIF6 | DMA_IT_FEIF6,
+  DMA_IT_TCIF7 | DMA_IT_HTIF7 | DMA_IT_TEIF7 | DMA_IT_DMEIF7 | DMA_IT_FEIF7
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void DMA_XferDisable(DMA_XferHandleTypeDef* Handle);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup DMA_Private_Functions
+  * @{
+  */
+
+/** @defgroup DMA_Group5 DMA transfer functions
+ *  @brief   DMA transfer functions
+ *
+@verbatim
+ ===============================================================================
+                            DMA transfer functions
+ ===============================================================================
+
+  This subsection provides functions allowing to write the drivers using the DMA
+  once for the STM32F10x, STM32F2xx and STM32F4xx families. The handle hides the
+  stream or channel, its interrupt flags and the differences of the DMA
+  controllers:
+   - On STM32F2xx and STM32F4xx the transfers to and from the peripherals use
+     the direct mode, and the memory-to-memory copies use the FIFO, with the
+     threshold at full FIFO.
+   - The Half Transfer interrupt is enabled only if the HalfCallback member of
+     the handle is set.
+
+  In circular mode the stream restarts at the beginning of the buffer after each
+  Transfer Complete: HalfCallback and CompleteCallback are called alternately and
+  each one may process the half of the buffer which is not being written (double
+  buffering with a single buffer).
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Fills each DMA_XferInitTypeDef member with its default value: memory
+  *         to peripheral transfer of bytes, in normal mode, with the memory
+  *         address incremented.
+  * @param  Init: pointer to a DMA_XferInitTypeDef structure to initialize.
+  * @retval None
+  */
+void DMA_XferStructInit(DMA_XferInitTypeDef* Init)
+{
+  Init->Request = DMA_Channel_0;
+  Init->PeriphAddress = 0;
+  Init->Direction = DMA_XFER_MEMORY_TO_PERIPH;
+  Init->PeriphDataSize = DMA_PeripheralDataSize_Byte;
+  Init->MemoryDataSize = DMA_MemoryDataSize_Byte;
+  Init->PeriphInc = DMA_PeripheralInc_Disable;
+  Init->MemoryInc = DMA_MemoryInc_Enable;
+  Init->Mode = DMA_Mode_Normal;
+  Init->Priority = DMA_Priority_Low;
+}
+
+/**
+  * @brief  Initializes a DMA transfer handle and configures its stream.
+  * @param  Handle: pointer to the DMA_XferHandleTypeDef structure to initialize.
+  *         The callbacks are cleared.
+  * @param  Instance: the stream, where x can be 1 or 2 to select the DMA and y
+  *         can be 0 to 7 to select the DMA Stream.
+  * @param  Init: pointer to a DMA_XferInitTypeDef structure that contains the
+  *         configuration of the transfers.
+  * @note   The stream is stopped and its interrupts are disabled.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the handle is ready
+  *          - ERROR: circular mode or DMA1 stream for a memory-to-memory copy
+  */
+ErrorStatus DMA_XferInit(DMA_XferHandleTypeDef* Handle, DMA_XferInstanceTypeDef* Instance,
+                         DMA_XferInitTypeDef* Init)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+
+  /* Check the parameters */
+  assert_param(IS_DMA_ALL_PERIPH(Instance));
+  assert_param(IS_DMA_XFER_DIRECTION(Init->Direction));
+  assert_param(IS_DMA_MODE(Init->Mode));
+
+  Handle->State = DMA_XFER_STATE_RESET;
+
+  if ((Init->Direction == DMA_XFER_MEMORY_TO_MEMORY) &&
+      ((Init->Mode == DMA_Mode_Circular) || !IS_DMA_XFER_M2M_INSTANCE(Instance)))
+  {
+    return ERROR;
+  }
+
+  Handle->Instance = Instance;
+  Handle->HalfCallback = 0;
+  Handle->CompleteCallback = 0;
+  Handle->ErrorCallback = 0;
+  Handle->Mode = Init->Mode;
+  Handle->Flags = ((((uint32_t)Instance) & 0xFF) - DMA_XFER_STREAM_OFFSET) / DMA_XFER_STREAM_SIZE;
+
+  DMA_XferDisable(Handle);
+  DMA_DeInit(Instance);
+
+  DMA_InitStructure.DMA_Channel = Init->Request;
+  DMA_InitStructure.DMA_PeripheralBaseAddr = Init->PeriphAddress;
+  DMA_InitStructure.DMA_Memory0BaseAddr = 0;
+  DMA_InitStructure.DMA_DIR = Init->Direction;
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_PeripheralInc = Init->PeriphInc;
+  DMA_InitStructure.DMA_MemoryInc = Init->MemoryInc;
+  DMA_InitStructure.DMA_PeripheralDataSize = Init->PeriphDataSize;
+  DMA_InitStructure.DMA_MemoryDataSize = Init->MemoryDataSize;
+  DMA_InitStructure.DMA_Mode = Init->Mode;
+  DMA_InitStructure.DMA_Priority = Init->Priority;
+  /* The direct mode is not possible for memory-to-memory transfers */
+  DMA_InitStructure.DMA_FIFOMode = (Init->Direction == DMA_XFER_MEMORY_TO_MEMORY) ?
+                                   DMA_FIFOMode_Enable : DMA_FIFOMode_Disable;
+  DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+  DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+  DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+  DMA_Init(Instance, &DMA_InitStructure);
+
+  Handle->State = DMA_XFER_STATE_READY;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts a transfer between the peripheral and a memory buffer.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @param  MemoryAddress: address of the buffer, or of the destination for a
+  *         memory-to-memory copy.
+  * @param  Count: number of data items to transfer, from 1 to 65535.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the transfer is started
+  *          - ERROR: a transfer is in progress
+  */
+ErrorStatus DMA_XferStart(DMA_XferHandleTypeDef* Handle, uint32_t MemoryAddress, uint16_t Count)
+{
+  uint32_t it = DMA_IT_TC | DMA_IT_TE | DMA_IT_DME;
+
+  /* Check the parameters */
+  assert_param(Count != 0);
+
+  if ((Handle->State == DMA_XFER_STATE_RESET) || (Handle->State == DMA_XFER_STATE_BUSY))
+  {
+    return ERROR;
+  }
+
+  /* The stream is disabled by the hardware at the end of a normal transfer */
+  DMA_XferDisable(Handle);
+
+  DMA_MemoryTargetConfig(Handle->Instance, MemoryAddress, DMA_Memory_0);
+  DMA_SetCurrDataCounter(Handle->Instance, Count);
+
+  if (Handle->HalfCallback != 0)
+  {
+    it |= DMA_IT_HT;
+  }
+  DMA_ITConfig(Handle->Instance, it, ENABLE);
+
+  Handle->State = DMA_XFER_STATE_BUSY;
+  DMA_Cmd(Handle->Instance, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts a memory-to-memory copy.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit() with the DMA_XFER_MEMORY_TO_MEMORY direction.
+  * @param  DstAddress: address of the destination.
+  * @param  SrcAddress: address of the source.
+  * @param  Count: number of data items to copy, from 1 to 65535.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the copy is started
+  *          - ERROR: a transfer is in progress
+  */
+ErrorStatus DMA_XferCopy(DMA_XferHandleTypeDef* Handle, uint32_t DstAddress, uint32_t SrcAddress,
+                         uint16_t Count)
+{
+  if (Handle->State == DMA_XFER_STATE_BUSY)
+  {
+    return ERROR;
+  }
+
+  /* The peripheral port is the source of the memory-to-memory transfers */
+  DMA_XferDisable(Handle);
+  Handle->Instance->PAR = SrcAddress;
+
+  return DMA_XferStart(Handle, DstAddress, Count);
+}
+
+/**
+  * @brief  Stops the transfer in progress. The callbacks are not called.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @retval None
+  */
+void DMA_XferStop(DMA_XferHandleTypeDef* Handle)
+{
+  DMA_XferDisable(Handle);
+
+  if (Handle->State != DMA_XFER_STATE_RESET)
+  {
+    Handle->State = DMA_XFER_STATE_READY;
+  }
+}
+
+/**
+  * @brief  Returns the number of data items which remain to be transferred.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @retval The number of remaining data items. In circular mode, the position
+  *         in the buffer is the Count of DMA_XferStart() minus this value.
+  */
+uint16_t DMA_XferGetCount(DMA_XferHandleTypeDef* Handle)
+{
+  return DMA_GetCurrDataCounter(Handle->Instance);
+}
+
+/**
+  * @brief  Handles the interrupts of the stream of a transfer handle.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure initialized by
+  *         DMA_XferInit().
+  * @note   This function must be called from the interrupt handler of the
+  *         stream. The callbacks may start a new transfer.
+  * @retval None
+  */
+void DMA_XferIRQHandler(DMA_XferHandleTypeDef* Handle)
+{
+  DMA_Stream_TypeDef* stream = Handle->Instance;
+  uint32_t index = Handle->Flags;
+
+  if ((DMA_GetITStatus(stream, DMA_XferTEIF[index]) != RESET) ||
+      (DMA_GetITStatus(stream, DMA_XferDMEIF[index]) != RESET))
+  {
+    DMA_XferDisable(Handle);
+    Handle->State = DMA_XFER_STATE_ERROR;
+    TRACE_DMA(TRACE_EV_DMA_ERROR, stream);
+
+    if (Handle->ErrorCallback != 0)
+    {
+      Handle->ErrorCallback(Handle);
+    }
+    return;
+  }
+
+  if (DMA_GetITStatus(stream, DMA_XferHTIF[index]) != RESET)
+  {
+    DMA_ClearITPendingBit(stream, DMA_XferHTIF[index]);
+    TRACE_DMA(TRACE_EV_DMA_HALF, stream);
+
+    if (Handle->HalfCallback != 0)
+    {
+      Handle->HalfCallback(Handle);
+    }
+  }
+
+  if (DMA_GetITStatus(stream, DMA_XferTCIF[index]) != RESET)
+  {
+    DMA_ClearITPendingBit(stream, DMA_XferTCIF[index]);
+    TRACE_DMA(TRACE_EV_DMA_TC, stream);
+
+    if (Handle->Mode != DMA_Mode_Circular)
+    {
+      /* The stream is already disabled by the hardware */
+      DMA_ITConfig(stream, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME, DISABLE);
+      Handle->State = DMA_XFER_STATE_READY;
+    }
+
+    if (Handle->CompleteCallback != 0)
+    {
+      Handle->CompleteCallback(Handle);
+    }
+  }
+}
+
+/**
+  * @brief  Disables the stream and its interrupts, and clears its flags.
+  * @param  Handle: pointer to a DMA_XferHandleTypeDef structure.
+  * @retval None
+  */
+static void DMA_XferDisable(DMA_XferHandleTypeDef* Handle)
+{
+  DMA_ITConfig(Handle->Instance, DMA_IT_TC | DMA_IT_HT | DMA_IT_TE | DMA_IT_DME, DISABLE);
+  DMA_Cmd(Handle->Instance, DISABLE);
+
+  /* The stream is disabled at the end of the current data item */
+  while (DMA_GetCmdStatus(Handle->Instance) != DISABLE)
+  {
+  }
+
+  DMA_ClearITPendingBit(Handle->Instance, DMA_XferAllIF[Handle->Flags]);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -8,6 +8,7 @@
   *          functionalities of the EXTI peripheral:           
   *           - Initialization and Configuration
   *           - Interrupts and flags management
+  *           - Fast dispatch of the shared interrupt vectors
   *
   *  @verbatim  
   *  
@@ -37,6 +38,9 @@
   *            3- Select the mode(interrupt, event) and configure the trigger 
   *               selection (Rising, falling or both) using EXTI_Init()
   *            4- Configure NVIC IRQ channel mapped to the EXTI line using NVIC_Init()
+  *            5- Optionally, register a callback with EXTI_SetCallback() and
+  *               call EXTI_Dispatch() from the interrupt handler, and enable
+  *               the edge timestamps with EXTI_TimestampCmd()
   *   
   *  @note  SYSCFG APB clock must be enabled to get write access to SYSCFG_EXTICRx
   *         registers using RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
@@ -80,8 +84,17 @@
 
 #define EXTI_LINENONE    ((uint32_t)0x00000)  /* No interrupt selected */
 
+/* DWT cycle counter (not described by the CMSIS core header) */
+#define EXTI_DWT_CTRL       (*(__IO uint32_t *)0xE0001000)
+#define EXTI_DWT_CYCCNT     (*(__IO uint32_t *)0xE0001004)
+#define EXTI_DWT_CYCCNTENA  ((uint32_t)0x00000001)
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+
+/* Callbacks of EXTI_Dispatch(), indexed by line number */
+static EXTI_CallbackTypeDef EXTI_Callbacks[EXTI_LINE_NUMBER];
+
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -293,6 +306,103 @@ void EXTI_ClearITPendingBit(uint32_t EXTI_Line)
   EXTI->PR = EXTI_Line;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup EXTI_Group3 Fast dispatch functions
+ *  @brief   Fast dispatch functions
+ *
+@verbatim
+ ===============================================================================
+                          Fast dispatch functions
+ ===============================================================================
+
+  The lines 5 to 9 and 10 to 15 share the EXTI9_5 and EXTI15_10 interrupt
+  vectors. EXTI_Dispatch() finds their pending lines with one read of the
+  pending register masked by the interrupt mask register, and the CLZ
+  instruction, instead of one EXTI_GetITStatus() call per line.
+
+  The timestamp passed to the callbacks is the DWT cycle counter, in HCLK
+  cycles: the difference of two timestamps gives the time between two edges,
+  for encoder or trigger inputs, without the jitter of the callback order.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Registers the callback of an EXTI line, called by EXTI_Dispatch().
+  * @param  EXTI_Line: specifies the EXTI line.
+  *          This parameter can be EXTI_Linex where x can be (0..22)
+  * @param  Callback: function called when the line is pending, or 0 to only
+  *         clear the pending bit.
+  * @retval None
+  */
+void EXTI_SetCallback(uint32_t EXTI_Line, EXTI_CallbackTypeDef Callback)
+{
+  /* Check the parameters */
+  assert_param(IS_GET_EXTI_LINE(EXTI_Line));
+
+  EXTI_Callbacks[31 - __CLZ(EXTI_Line)] = Callback;
+}
+
+/**
+  * @brief  Enables or disables the DWT cycle counter giving the timestamp of
+  *         EXTI_Dispatch(). The counter is shared with the debugger and the
+  *         other users of the DWT: disabling it stops it for all of them.
+  * @param  NewState: new state of the cycle counter.
+  *          This parameter can be: ENABLE or DISABLE.
+  * @retval None
+  */
+void EXTI_TimestampCmd(FunctionalState NewState)
+{
+  /* Check the parameters */
+  assert_param(IS_FUNCTIONAL_STATE(NewState));
+
+  if (NewState != DISABLE)
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    EXTI_DWT_CTRL |= EXTI_DWT_CYCCNTENA;
+  }
+  else
+  {
+    EXTI_DWT_CTRL &= ~EXTI_DWT_CYCCNTENA;
+  }
+}
+
+/**
+  * @brief  Serves the pending lines of an interrupt vector: reads the pending
+  *         register once, clears the pending lines in one write, then calls
+  *         their callbacks from the highest line to the lowest.
+  * @note   Call it from the EXTI interrupt handlers, for example:
+  *           void EXTI9_5_IRQHandler(void) { EXTI_Dispatch(EXTI_Lines_9_5); }
+  *         The timestamp is read first, so that it gives the time of the
+  *         edge to the interrupt latency, the same for all the lines served.
+  * @param  EXTI_Lines: lines of the vector: EXTI_Lines_9_5, EXTI_Lines_15_10,
+  *         or a single EXTI_Linex.
+  * @retval None
+  */
+void EXTI_Dispatch(uint32_t EXTI_Lines)
+{
+  uint32_t timestamp = EXTI_DWT_CYCCNT;
+  uint32_t pending;
+  uint32_t line;
+
+  pending = EXTI->PR & EXTI->IMR & EXTI_Lines;
+  EXTI->PR = pending;
+
+  while (pending != 0)
+  {
+    line = 31 - __CLZ(pending);
+    pending &= ~((uint32_t)1 << line);
+    if (EXTI_Callbacks[line] != 0)
+    {
+      EXTI_Callbacks[line]((uint32_t)1 << line, timestamp);
+    }
+  }
+}
+
 /**
   * @}
   */
@@ -0,0 +1,818 @@
+/**
+  ******************************************************************************
+  * @file    stm32f2xx_flash_kv.c
+  * @author  MCD Application Team
+  * @version V1.1.2
+  * @date    05-March-2012
+  * @brief   This file provides a key/value and log store on FLASH sectors:
+  *           - Append-only records in a ring of two or more sectors
+  *           - RAM index of the keys built at initialization
+  *           - Garbage collection of the oldest sector into the new one
+  *          It uses the stm32f2xx_flash.c/.h drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Reserve two or more sectors for the store, preferably of the
+  *             same size, and describe them in a table of FLASH_KVAreaTypeDef.
+  *
+  *          2. Call FLASH_KVInit() with the table, and a RAM table of
+  *             FLASH_KVEntryTypeDef with a power of 2 entries, more than the
+  *             number of keys.
+  *
+  *          3. Store values using FLASH_KVWrite() and FLASH_KVDelete(), and
+  *             get them using FLASH_KVRead(): the value is read in place, in
+  *             the FLASH.
+  *
+  *          4. Store events using FLASH_KVLogAppend(), and read them back in
+  *             order using FLASH_KVLogRead().
+  *
+  * @note   A write may erase a sector: the CPU stalls during the erase when
+  *         it runs from the same bank.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_flash_kv.h"
+
+/** @addtogroup STM32F2xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup FLASH
+  * @brief FLASH driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Area header: magic word, then sequence number of the area */
+#define FLASH_KV_MAGIC            ((uint32_t)0x3153564B)
+#define FLASH_KV_HEADER_SIZE      ((uint32_t)8)
+
+/* Record: key, type and length, value padded to a word, checksum */
+#define FLASH_KV_RECORD_SIZE(LENGTH) (((uint32_t)12) + (((uint32_t)(LENGTH) + 3) & ~(uint32_t)3))
+
+/* Record types */
+#define FLASH_KV_TYPE_VALUE       ((uint32_t)0x5A01)
+#define FLASH_KV_TYPE_DELETE      ((uint32_t)0x5A02)
+#define FLASH_KV_TYPE_LOG         ((uint32_t)0x5A03)
+
+/* Private macro -------------------------------------------------------------*/
+#define FLASH_KV_WORD(ADDRESS)    (*(__IO uint32_t*)(ADDRESS))
+#define FLASH_KV_AREA_END(KV, AREA) ((KV)->Areas[(AREA)].Address + (KV)->Areas[(AREA)].Size)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static FLASH_Status FLASH_KVProgram(FLASH_KVTypeDef* KV, uint32_t Address, const uint8_t* Data,
+                                    uint32_t Length);
+static FLASH_Status FLASH_KVErase(FLASH_KVTypeDef* KV, uint32_t Area);
+static uint32_t FLASH_KVChecksum(uint32_t Sum, const uint8_t* Data, uint32_t Length);
+static uint32_t FLASH_KVRecordSize(uint32_t Address, uint32_t End);
+static uint8_t FLASH_KVRecordValid(uint32_t Address, uint32_t Size);
+static FLASH_KVEntryTypeDef* FLASH_KVLookup(FLASH_KVTypeDef* KV, uint32_t Key);
+static void FLASH_KVRemove(FLASH_KVTypeDef* KV, FLASH_KVEntryTypeDef* Entry);
+static uint8_t FLASH_KVBlank(FLASH_KVTypeDef* KV, uint32_t Area);
+static ErrorStatus FLASH_KVReclaim(FLASH_KVTypeDef* KV, uint32_t Area);
+static ErrorStatus FLASH_KVOpen(FLASH_KVTypeDef* KV);
+static uint32_t FLASH_KVAppend(FLASH_KVTypeDef* KV, uint32_t Key, uint32_t Type,
+                               const uint8_t* Data, uint16_t Length);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup FLASH_Private_Functions
+  * @{
+  */
+
+/** @defgroup FLASH_Group5 Key/value and log store functions
+ *  @brief   Key/value and log store functions
+ *
+@verbatim
+ ===============================================================================
+                     Key/value and log store functions
+ ===============================================================================
+
+  The store appends records to the sectors, which are used one after the
+  other as a ring. A sector starts with a header holding a sequence number,
+  so that the order of the sectors is known at initialization. A record holds
+  a key, a type and a length, the value and a checksum, which is written last:
+  a record cut by a reset is not used.
+
+  FLASH_KVInit() reads the records from the oldest sector to the newest one,
+  and keeps the address of the last value of each key in the RAM index: a
+  read does not search the FLASH.
+
+  One sector of the ring is always erased. When the newest sector is full,
+  the erased sector becomes the newest one, and the values of the oldest
+  sector which are still the last ones of their key are copied into it. The
+  oldest sector is then erased. The log records of the oldest sector are
+  dropped: the log holds the events of the other sectors.
+
+  The values which are still valid must fit in one sector, with the records
+  written between two collections.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the store and builds the index of the keys.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Areas: the sectors of the store, which must not change once the
+  *         store is written.
+  * @param  NbAreas: number of sectors, at least 2.
+  * @param  Index: RAM table of the index.
+  * @param  IndexSize: number of entries of Index, a power of 2.
+  * @param  VoltageRange: The device voltage range which defines the program
+  *         and erase parallelism. This parameter can be a value of
+  *         @ref FLASH_Voltage_Range.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the store is ready
+  *          - ERROR: FLASH error, or too many keys for the index
+  */
+ErrorStatus FLASH_KVInit(FLASH_KVTypeDef* KV, const FLASH_KVAreaTypeDef* Areas, uint32_t NbAreas,
+                         FLASH_KVEntryTypeDef* Index, uint32_t IndexSize, uint8_t VoltageRange)
+{
+  ErrorStatus status = SUCCESS;
+  FLASH_KVEntryTypeDef* entry = 0;
+  uint32_t area = 0, n = 0, address = 0, end = 0, size = 0, type = 0;
+  uint32_t lock = 0;
+  uint8_t found = 0;
+
+  /* Check the parameters */
+  assert_param(NbAreas >= 2);
+  assert_param(IS_FLASH_KV_INDEX_SIZE(IndexSize));
+  assert_param(IS_VOLTAGERANGE(VoltageRange));
+
+  KV->Areas = Areas;
+  KV->NbAreas = NbAreas;
+  KV->Index = Index;
+  KV->IndexMask = IndexSize - 1;
+  KV->Count = 0;
+  KV->Sequence = 0;
+  KV->LogSequence = 0;
+  KV->VoltageRange = VoltageRange;
+
+  for (n = 0; n < IndexSize; n++)
+  {
+    Index[n].Key = FLASH_KV_KEY_NONE;
+  }
+
+  /* The newest sector has the highest sequence number */
+  KV->Head = NbAreas - 1;
+  for (area = 0; area < NbAreas; area++)
+  {
+    address = Areas[area].Address;
+    if ((FLASH_KV_WORD(address) == FLASH_KV_MAGIC) &&
+        ((found == 0) || ((int32_t)(FLASH_KV_WORD(address + 4) - KV->Sequence) > 0)))
+    {
+      KV->Head = area;
+      KV->Sequence = FLASH_KV_WORD(address + 4);
+      found = 1;
+    }
+  }
+  KV->WriteAddress = FLASH_KV_AREA_END(KV, KV->Head);
+
+  /* Read the records from the oldest sector to the newest one */
+  for (n = 1; (n <= NbAreas) && (found != 0) && (status == SUCCESS); n++)
+  {
+    area = (KV->Head + n) % NbAreas;
+    address = Areas[area].Address;
+    end = FLASH_KV_AREA_END(KV, area);
+    if (FLASH_KV_WORD(address) != FLASH_KV_MAGIC)
+    {
+      continue;
+    }
+
+    address += FLASH_KV_HEADER_SIZE;
+    while ((status == SUCCESS) && ((size = FLASH_KVRecordSize(address, end)) != 0))
+    {
+      if (FLASH_KVRecordValid(address, size) != 0)
+      {
+        type = FLASH_KV_WORD(address + 4) >> 16;
+        entry = FLASH_KVLookup(KV, FLASH_KV_WORD(address));
+        if (type == FLASH_KV_TYPE_LOG)
+        {
+          KV->LogSequence = FLASH_KV_WORD(address);
+        }
+        else if (type == FLASH_KV_TYPE_DELETE)
+        {
+          if (entry->Key != FLASH_KV_KEY_NONE)
+          {
+            FLASH_KVRemove(KV, entry);
+          }
+        }
+        else if ((entry->Key == FLASH_KV_KEY_NONE) && (KV->Count == KV->IndexMask))
+        {
+          /* One entry of the index is always free */
+          status = ERROR;
+        }
+        else
+        {
+          if (entry->Key == FLASH_KV_KEY_NONE)
+          {
+            entry->Key = FLASH_KV_WORD(address);
+            KV->Count++;
+          }
+          entry->Address = address;
+        }
+      }
+      address += size;
+    }
+
+    /* A record cut in its header closes the sector */
+    if ((area == KV->Head) && (end - address >= 8) &&
+        (FLASH_KV_WORD(address) == 0xFFFFFFFF) && (FLASH_KV_WORD(address + 4) == 0xFFFFFFFF))
+    {
+      KV->WriteAddress = address;
+    }
+  }
+
+  /* The sector after the newest one must be erased */
+  area = (KV->Head + 1) % NbAreas;
+  if ((status == SUCCESS) && (FLASH_KVBlank(KV, area) == 0))
+  {
+    lock = FLASH->CR & FLASH_CR_LOCK;
+    FLASH_Unlock();
+    if (FLASH_KV_WORD(Areas[area].Address) == FLASH_KV_MAGIC)
+    {
+      status = FLASH_KVReclaim(KV, area);
+    }
+    if ((status == SUCCESS) && (FLASH_KVErase(KV, area) != FLASH_COMPLETE))
+    {
+      status = ERROR;
+    }
+    if (lock != 0)
+    {
+      FLASH_Lock();
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Gets the value of a key.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Key: the key, any value but FLASH_KV_KEY_NONE.
+  * @param  Data: returns the address of the value in the FLASH.
+  * @param  Length: returns the length of the value in bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the key has a value
+  *          - ERROR: the key has no value
+  */
+ErrorStatus FLASH_KVRead(FLASH_KVTypeDef* KV, uint32_t Key, const uint8_t** Data, uint16_t* Length)
+{
+  FLASH_KVEntryTypeDef* entry = FLASH_KVLookup(KV, Key);
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_KV_KEY(Key));
+
+  if (entry->Key == FLASH_KV_KEY_NONE)
+  {
+    return ERROR;
+  }
+
+  *Data = (const uint8_t*)(entry->Address + 8);
+  *Length = (uint16_t)FLASH_KV_WORD(entry->Address + 4);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Writes the value of a key. Nothing is written when the value is
+  *         the same as the last one.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Key: the key, any value but FLASH_KV_KEY_NONE.
+  * @param  Data: pointer to the value.
+  * @param  Length: length of the value in bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the value is written
+  *          - ERROR: FLASH error, the store or the index is full
+  */
+ErrorStatus FLASH_KVWrite(FLASH_KVTypeDef* KV, uint32_t Key, const uint8_t* Data, uint16_t Length)
+{
+  FLASH_KVEntryTypeDef* entry = FLASH_KVLookup(KV, Key);
+  uint32_t address = 0, n = 0;
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_KV_KEY(Key));
+
+  if (entry->Key != FLASH_KV_KEY_NONE)
+  {
+    address = entry->Address;
+    if ((uint16_t)FLASH_KV_WORD(address + 4) == Length)
+    {
+      for (n = 0; (n < Length) && (*(__IO uint8_t*)(address + 8 + n) == Data[n]); n++)
+      {
+      }
+      if (n == Length)
+      {
+        return SUCCESS;
+      }
+    }
+  }
+  else if (KV->Count == KV->IndexMask)
+  {
+    return ERROR;
+  }
+
+  address = FLASH_KVAppend(KV, Key, FLASH_KV_TYPE_VALUE, Data, Length);
+  if (address == 0)
+  {
+    return ERROR;
+  }
+
+  /* The index may have moved during a collection */
+  entry = FLASH_KVLookup(KV, Key);
+  if (entry->Key == FLASH_KV_KEY_NONE)
+  {
+    entry->Key = Key;
+    KV->Count++;
+  }
+  entry->Address = address;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Deletes the value of a key.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Key: the key, any value but FLASH_KV_KEY_NONE.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the key has no value
+  *          - ERROR: FLASH error or the store is full
+  */
+ErrorStatus FLASH_KVDelete(FLASH_KVTypeDef* KV, uint32_t Key)
+{
+  FLASH_KVEntryTypeDef* entry = FLASH_KVLookup(KV, Key);
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_KV_KEY(Key));
+
+  if (entry->Key == FLASH_KV_KEY_NONE)
+  {
+    return SUCCESS;
+  }
+
+  if (FLASH_KVAppend(KV, Key, FLASH_KV_TYPE_DELETE, 0, 0) == 0)
+  {
+    return ERROR;
+  }
+
+  FLASH_KVRemove(KV, FLASH_KVLookup(KV, Key));
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Appends a record to the log.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Data: pointer to the record.
+  * @param  Length: length of the record in bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the record is written
+  *          - ERROR: FLASH error or the store is full
+  */
+ErrorStatus FLASH_KVLogAppend(FLASH_KVTypeDef* KV, const uint8_t* Data, uint16_t Length)
+{
+  if (FLASH_KVAppend(KV, KV->LogSequence + 1, FLASH_KV_TYPE_LOG, Data, Length) == 0)
+  {
+    return ERROR;
+  }
+
+  KV->LogSequence++;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Gets a record of the log.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Sequence: sequence number of the record: 1 for the first record
+  *         written, then incremented for each record.
+  * @param  Data: returns the address of the record in the FLASH.
+  * @param  Length: returns the length of the record in bytes.
+  * @retval The sequence number of the first record in the log from Sequence,
+  *         or 0 when there is none. Pass it incremented by 1 to get the next
+  *         record.
+  */
+uint32_t FLASH_KVLogRead(FLASH_KVTypeDef* KV, uint32_t Sequence, const uint8_t** Data, uint16_t* Length)
+{
+  uint32_t area = 0, n = 0, address = 0, end = 0, size = 0;
+
+  for (n = 1; n <= KV->NbAreas; n++)
+  {
+    area = (KV->Head + n) % KV->NbAreas;
+    address = KV->Areas[area].Address;
+    end = (area == KV->Head) ? KV->WriteAddress : FLASH_KV_AREA_END(KV, area);
+    if (FLASH_KV_WORD(address) != FLASH_KV_MAGIC)
+    {
+      continue;
+    }
+
+    address += FLASH_KV_HEADER_SIZE;
+    while ((size = FLASH_KVRecordSize(address, end)) != 0)
+    {
+      if (((FLASH_KV_WORD(address + 4) >> 16) == FLASH_KV_TYPE_LOG) &&
+          (FLASH_KV_WORD(address) >= Sequence) && (FLASH_KVRecordValid(address, size) != 0))
+      {
+        *Data = (const uint8_t*)(address + 8);
+        *Length = (uint16_t)FLASH_KV_WORD(address + 4);
+        return FLASH_KV_WORD(address);
+      }
+      address += size;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Programs bytes in the FLASH.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Address: the first address to program.
+  * @param  Data: pointer to the data.
+  * @param  Length: number of bytes.
+  * @retval FLASH Status
+  */
+static FLASH_Status FLASH_KVProgram(FLASH_KVTypeDef* KV, uint32_t Address, const uint8_t* Data,
+                                    uint32_t Length)
+{
+  FLASH_Status status = FLASH_COMPLETE;
+  uint32_t word = 0;
+
+  while ((Length != 0) && (status == FLASH_COMPLETE))
+  {
+    /* By word from 2.7V, by byte else */
+    if ((KV->VoltageRange >= VoltageRange_3) && (Length >= 4) && ((Address & 3) == 0))
+    {
+      word = (uint32_t)Data[0] | ((uint32_t)Data[1] << 8) | ((uint32_t)Data[2] << 16) |
+             ((uint32_t)Data[3] << 24);
+      status = FLASH_ProgramWord(Address, word);
+      Address += 4;
+      Data += 4;
+      Length -= 4;
+    }
+    else
+    {
+      status = FLASH_ProgramByte(Address, *Data);
+      Address++;
+      Data++;
+      Length--;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Erases a sector of the store.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Area: the sector.
+  * @retval FLASH Status
+  */
+static FLASH_Status FLASH_KVErase(FLASH_KVTypeDef* KV, uint32_t Area)
+{
+  FLASH_Status status = FLASH_EraseSector(KV->Areas[Area].Sector, KV->VoltageRange);
+
+  /* The data cache may hold the content of the sector before the erase */
+  if ((FLASH->ACR & FLASH_ACR_DCEN) != 0)
+  {
+    FLASH_DataCacheCmd(DISABLE);
+    FLASH_DataCacheReset();
+    FLASH_DataCacheCmd(ENABLE);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Adds bytes to the checksum of a record. The bytes are padded with
+  *         0xFF up to a word.
+  * @param  Sum: the checksum of the previous bytes.
+  * @param  Data: pointer to the bytes.
+  * @param  Length: number of bytes.
+  * @retval The checksum
+  */
+static uint32_t FLASH_KVChecksum(uint32_t Sum, const uint8_t* Data, uint32_t Length)
+{
+  uint32_t word = 0, n = 0;
+
+  for (n = 0; n < ((Length + 3) & ~(uint32_t)3); n++)
+  {
+    word = (word >> 8) | ((uint32_t)((n < Length) ? Data[n] : 0xFF) << 24);
+    if ((n & 3) == 3)
+    {
+      Sum = ((Sum << 1) | (Sum >> 31)) + word;
+    }
+  }
+
+  return Sum;
+}
+
+/**
+  * @brief  Returns the size of the record at an address.
+  * @param  Address: address of the record.
+  * @param  End: end of the sector.
+  * @retval The size of the record in bytes, or 0 after the last record of
+  *         the sector.
+  */
+static uint32_t FLASH_KVRecordSize(uint32_t Address, uint32_t End)
+{
+  uint32_t info = 0, type = 0, size = 0;
+
+  if (End - Address < FLASH_KV_RECORD_SIZE(0))
+  {
+    return 0;
+  }
+
+  info = FLASH_KV_WORD(Address + 4);
+  type = info >> 16;
+  size = FLASH_KV_RECORD_SIZE(info & 0xFFFF);
+  if (((type != FLASH_KV_TYPE_VALUE) && (type != FLASH_KV_TYPE_DELETE) &&
+       (type != FLASH_KV_TYPE_LOG)) || (size > End - Address))
+  {
+    return 0;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Checks the checksum of a record.
+  * @param  Address: address of the record.
+  * @param  Size: size of the record in bytes.
+  * @retval 1 when the record is valid, 0 else.
+  */
+static uint8_t FLASH_KVRecordValid(uint32_t Address, uint32_t Size)
+{
+  uint32_t sum = FLASH_KVChecksum(0, (const uint8_t*)Address, Size - 4);
+
+  if (sum == 0xFFFFFFFF)
+  {
+    sum = 0;
+  }
+
+  return (uint8_t)(FLASH_KV_WORD(Address + Size - 4) == sum);
+}
+
+/**
+  * @brief  Finds the entry of a key in the index.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Key: the key.
+  * @retval The entry of the key, or the free entry where to add it.
+  */
+static FLASH_KVEntryTypeDef* FLASH_KVLookup(FLASH_KVTypeDef* KV, uint32_t Key)
+{
+  uint32_t n = ((Key * (uint32_t)0x9E3779B1) >> 8) & KV->IndexMask;
+
+  while ((KV->Index[n].Key != Key) && (KV->Index[n].Key != FLASH_KV_KEY_NONE))
+  {
+    n = (n + 1) & KV->IndexMask;
+  }
+
+  return &KV->Index[n];
+}
+
+/**
+  * @brief  Removes an entry of the index, and moves back the entries which
+  *         follow it to keep them reachable.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Entry: the entry to remove.
+  * @retval None
+  */
+static void FLASH_KVRemove(FLASH_KVTypeDef* KV, FLASH_KVEntryTypeDef* Entry)
+{
+  uint32_t hole = Entry - KV->Index;
+  uint32_t n = hole, home = 0;
+
+  for (;;)
+  {
+    n = (n + 1) & KV->IndexMask;
+    if (KV->Index[n].Key == FLASH_KV_KEY_NONE)
+    {
+      break;
+    }
+
+    /* The entry stays when its home is between the hole and itself */
+    home = ((KV->Index[n].Key * (uint32_t)0x9E3779B1) >> 8) & KV->IndexMask;
+    if (((n - home) & KV->IndexMask) < ((n - hole) & KV->IndexMask))
+    {
+      continue;
+    }
+
+    KV->Index[hole] = KV->Index[n];
+    hole = n;
+  }
+
+  KV->Index[hole].Key = FLASH_KV_KEY_NONE;
+  KV->Count--;
+}
+
+/**
+  * @brief  Checks that a sector of the store is erased.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Area: the sector.
+  * @retval 1 when the sector is erased, 0 else.
+  */
+static uint8_t FLASH_KVBlank(FLASH_KVTypeDef* KV, uint32_t Area)
+{
+  uint32_t address = KV->Areas[Area].Address;
+  uint32_t end = FLASH_KV_AREA_END(KV, Area);
+
+  while ((address < end) && (FLASH_KV_WORD(address) == 0xFFFFFFFF))
+  {
+    address += 4;
+  }
+
+  return (uint8_t)(address >= end);
+}
+
+/**
+  * @brief  Copies the values of a sector which are the last ones of their
+  *         key to the newest sector.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Area: the oldest sector.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the sector can be erased
+  *          - ERROR: FLASH error or the newest sector is full
+  */
+static ErrorStatus FLASH_KVReclaim(FLASH_KVTypeDef* KV, uint32_t Area)
+{
+  FLASH_KVEntryTypeDef* entry = 0;
+  uint32_t address = KV->Areas[Area].Address + FLASH_KV_HEADER_SIZE;
+  uint32_t end = FLASH_KV_AREA_END(KV, Area);
+  uint32_t size = 0;
+
+  while ((size = FLASH_KVRecordSize(address, end)) != 0)
+  {
+    entry = FLASH_KVLookup(KV, FLASH_KV_WORD(address));
+    if ((entry->Key != FLASH_KV_KEY_NONE) && (entry->Address == address))
+    {
+      if ((FLASH_KV_AREA_END(KV, KV->Head) - KV->WriteAddress < size) ||
+          (FLASH_KVProgram(KV, KV->WriteAddress, (const uint8_t*)address, size) != FLASH_COMPLETE))
+      {
+        return ERROR;
+      }
+      entry->Address = KV->WriteAddress;
+      KV->WriteAddress += size;
+    }
+    address += size;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts the next sector, and collects the oldest sector.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the newest sector has changed
+  *          - ERROR: FLASH error or the newest sector is full
+  */
+static ErrorStatus FLASH_KVOpen(FLASH_KVTypeDef* KV)
+{
+  uint32_t area = (KV->Head + 1) % KV->NbAreas;
+  uint32_t address = KV->Areas[area].Address;
+  uint32_t header[2];
+
+  /* The magic word is written last */
+  header[0] = FLASH_KV_MAGIC;
+  header[1] = KV->Sequence + 1;
+  if ((FLASH_KVProgram(KV, address + 4, (const uint8_t*)&header[1], 4) != FLASH_COMPLETE) ||
+      (FLASH_KVProgram(KV, address, (const uint8_t*)&header[0], 4) != FLASH_COMPLETE))
+  {
+    return ERROR;
+  }
+
+  KV->Head = area;
+  KV->Sequence++;
+  KV->WriteAddress = address + FLASH_KV_HEADER_SIZE;
+
+  /* Keep the sector after the newest one erased */
+  area = (area + 1) % KV->NbAreas;
+  if (FLASH_KVBlank(KV, area) == 0)
+  {
+    if ((FLASH_KV_WORD(KV->Areas[area].Address) == FLASH_KV_MAGIC) &&
+        (FLASH_KVReclaim(KV, area) != SUCCESS))
+    {
+      return ERROR;
+    }
+    if (FLASH_KVErase(KV, area) != FLASH_COMPLETE)
+    {
+      return ERROR;
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Appends a record to the newest sector, starting the next sector
+  *         when it is full.
+  * @param  KV: pointer to a FLASH_KVTypeDef structure.
+  * @param  Key: the key, or the sequence number of a log record.
+  * @param  Type: the type of the record.
+  * @param  Data: pointer to the value.
+  * @param  Length: length of the value in bytes.
+  * @retval The address of the record, or 0 on error.
+  */
+static uint32_t FLASH_KVAppend(FLASH_KVTypeDef* KV, uint32_t Key, uint32_t Type,
+                               const uint8_t* Data, uint16_t Length)
+{
+  uint32_t size = FLASH_KV_RECORD_SIZE(Length);
+  uint32_t address = 0, n = 0, sum = 0, lock = 0;
+  uint32_t header[2];
+
+  /* The record must fit in any sector */
+  for (n = 0; n < KV->NbAreas; n++)
+  {
+    if (size > KV->Areas[n].Size - FLASH_KV_HEADER_SIZE)
+    {
+      return 0;
+    }
+  }
+
+  header[0] = Key;
+  header[1] = (Type << 16) | Length;
+  sum = FLASH_KVChecksum(FLASH_KVChecksum(0, (const uint8_t*)header, 8), Data, Length);
+  if (sum == 0xFFFFFFFF)
+  {
+    sum = 0;
+  }
+
+  lock = FLASH->CR & FLASH_CR_LOCK;
+  FLASH_Unlock();
+
+  /* Each new sector collects one sector: give up after the whole ring */
+  for (n = 0; (n <= KV->NbAreas) && (FLASH_KV_AREA_END(KV, KV->Head) - KV->WriteAddress < size); n++)
+  {
+    if ((n == KV->NbAreas) || (FLASH_KVOpen(KV) != SUCCESS))
+    {
+      break;
+    }
+  }
+
+  if (FLASH_KV_AREA_END(KV, KV->Head) - KV->WriteAddress >= size)
+  {
+    address = KV->WriteAddress;
+    KV->WriteAddress += size;
+    if ((FLASH_KVProgram(KV, address, (const uint8_t*)header, 8) != FLASH_COMPLETE) ||
+        (FLASH_KVProgram(KV, address + 8, Data, Length) != FLASH_COMPLETE) ||
+        (FLASH_KVProgram(KV, address + size - 4, (const uint8_t*)&sum, 4) != FLASH_COMPLETE))
+    {
+      /* Do not write after a bad record */
+      KV->WriteAddress = FLASH_KV_AREA_END(KV, KV->Head);
+      address = 0;
+    }
+  }
+
+  if (lock != 0)
+  {
+    FLASH_Lock();
+  }
+
+  return address;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
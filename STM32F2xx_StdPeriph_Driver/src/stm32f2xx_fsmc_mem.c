@@ -0,0 +1,531 @@
+/**
+  ******************************************************************************
+  * @file    stm32f2xx_fsmc_mem.c
+  * @author  MCD Application Team
+  * @version V1.1.2
+  * @date    05-March-2012
+  * @brief   This file provides an external memory service on the NOR/SRAM
+  *          banks of the FSMC:
+  *           - FSMC timings computed from HCLK and the memory datasheet
+  *           - Asynchronous SRAM/PSRAM with separate read and write timings,
+  *             or synchronous burst PSRAM (CellularRAM)
+  *           - Allocation of the buffers placed in the external memory
+  *           - Bandwidth benchmark
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the FSMC clock using
+  *             RCC_AHB3PeriphClockCmd(RCC_AHB3Periph_FSMC, ENABLE) function,
+  *             and configure the address, data and control pins of the
+  *             memory in alternate function FSMC mode, using GPIO_Init() and
+  *             GPIO_PinAFConfig().
+  *
+  *          2. Fill a FSMC_MemInitTypeDef structure with the parameters of the
+  *             memory datasheet, after FSMC_MemStructInit(), for example for a
+  *             10 ns asynchronous SRAM:
+  *               Init.Bank = FSMC_Bank1_NORSRAM3;
+  *               Init.MemoryType = FSMC_MemoryType_SRAM;
+  *               Init.DataWidth = FSMC_MemoryDataWidth_16b;
+  *               Init.Size = 0x100000;
+  *               Init.AccessTime = 10;
+  *               Init.ReadCycle = 10;
+  *               Init.WritePulse = 8;
+  *               Init.WriteCycle = 10;
+  *
+  *          3. Call FSMC_MemInit(): it computes the timings for the current
+  *             HCLK frequency, configures and enables the bank. Call it again
+  *             after a change of the HCLK frequency.
+  *
+  *          4. Take the large buffers (frame buffers, DSP buffers) from the
+  *             memory with FSMC_MemAlloc(), at the initialization: they are
+  *             never freed. For buffers taken and given back at run time,
+  *             put a memory pool in the external memory with osPoolDefAt()
+  *             of cmsis_os.h, on an address range not given by FSMC_MemAlloc().
+  *
+  *          5. FSMC_MemBenchmark() measures the bandwidth of sequential and
+  *             random 8-bit, 16-bit and 32-bit accesses. It overwrites the
+  *             tested range.
+  *
+  * @note   The FSMC has no write FIFO to enable on STM32F2xx: the writes
+  *         are buffered by the AHB write buffer only. The synchronous burst
+  *         mode needs a PSRAM with a clock input; with an asynchronous SRAM,
+  *         the 32-bit accesses of a 16-bit memory are the fastest path.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f2xx_fsmc_mem.h"
+#include "stm32f2xx_rcc.h"
+
+/** @addtogroup STM32F2xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup FSMC
+  * @brief FSMC driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* DWT cycle counter (not described by the CMSIS core header) */
+#define FSMC_MEM_DWT_CTRL       (*(__IO uint32_t *)0xE0001000)
+#define FSMC_MEM_DWT_CYCCNT     (*(__IO uint32_t *)0xE0001004)
+#define FSMC_MEM_DWT_CYCCNTENA  ((uint32_t)0x00000001)
+
+/* Largest values of the timing fields */
+#define FSMC_MEM_ADDSET_MAX     ((uint32_t)0x0F)
+#define FSMC_MEM_DATAST_MAX     ((uint32_t)0xFF)
+#define FSMC_MEM_BUSTURN_MAX    ((uint32_t)0x0F)
+#define FSMC_MEM_CLKDIV_MAX     ((uint32_t)0x10)
+#define FSMC_MEM_DATLAT_MAX     ((uint32_t)0x0F)
+
+/* Private macro -------------------------------------------------------------*/
+
+/* HCLK cycles covering a time in ns, rounded up, with HCLK in kHz */
+#define FSMC_MEM_CYCLES(NS, KHZ)  ((((NS) * (KHZ)) + 999999) / 1000000)
+
+/* Next address of the pseudo-random sequence, in a range of 2^n bytes */
+#define FSMC_MEM_RAND_NEXT(X)     (((X) * 1664525) + 1013904223)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t FSMC_MemMax(uint32_t A, uint32_t B);
+static uint32_t FSMC_MemMin(uint32_t A, uint32_t B);
+static uint32_t FSMC_MemBench(uint32_t Base, uint32_t Length, uint32_t Width,
+                              uint32_t Write, uint32_t Random);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup FSMC_Private_Functions
+  * @{
+  */
+
+/** @defgroup FSMC_Group5 External memory functions
+ *  @brief   External memory functions
+ *
+@verbatim
+ ===============================================================================
+                         External memory functions
+ ===============================================================================
+
+  The asynchronous timings use the mode A, with separate read and write
+  timings (FSMC_ExtendedMode_Enable):
+   - ADDSET covers the address setup time tAS
+   - read:  ADDSET + DATAST + 2 HCLK cycles cover the read cycle tRC, and
+            DATAST - 1 + ADDSET cycles cover the access time tAA
+   - write: DATAST cycles cover the write pulse tWP, and ADDSET + DATAST + 2
+            cycles cover the write cycle tWC
+   - BUSTURN covers the output disable time tHZ
+
+  The synchronous burst timings divide HCLK to the highest clock of the
+  memory, at least by 2, and set the data latency from the latency of the
+  memory, or let the memory insert the wait states with its WAIT signal.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Fills each Init member with its default value: a 16-bit
+  *         asynchronous SRAM of 1 Mbyte on bank 1, with 70 ns timings.
+  * @param  Init: pointer to a FSMC_MemInitTypeDef structure which will be
+  *         initialized.
+  * @retval None
+  */
+void FSMC_MemStructInit(FSMC_MemInitTypeDef* Init)
+{
+  Init->Bank = FSMC_Bank1_NORSRAM1;
+  Init->MemoryType = FSMC_MemoryType_SRAM;
+  Init->DataWidth = FSMC_MemoryDataWidth_16b;
+  Init->Size = 0x100000;
+  Init->Mode = FSMC_MEM_ASYNC;
+  Init->AddressSetup = 0;
+  Init->AccessTime = 70;
+  Init->ReadCycle = 70;
+  Init->WritePulse = 55;
+  Init->WriteCycle = 70;
+  Init->BusTurnAround = 25;
+  Init->MaxClock = 0;
+  Init->Latency = 0;
+  Init->WaitSignal = FSMC_WaitSignal_Disable;
+}
+
+/**
+  * @brief  Computes the FSMC read and write timings of a memory.
+  * @param  Init: pointer to a FSMC_MemInitTypeDef structure with the
+  *         parameters of the memory.
+  * @param  HCLK_Frequency: frequency of HCLK in Hz.
+  * @param  ReadTiming: pointer to the read (or read/write) timings.
+  * @param  WriteTiming: pointer to the write timings.
+  * @retval None
+  */
+void FSMC_MemComputeTiming(const FSMC_MemInitTypeDef* Init, uint32_t HCLK_Frequency,
+                           FSMC_NORSRAMTimingInitTypeDef* ReadTiming,
+                           FSMC_NORSRAMTimingInitTypeDef* WriteTiming)
+{
+  uint32_t khz = HCLK_Frequency / 1000;
+  uint32_t addset = 0;
+  uint32_t datast = 0;
+  uint32_t clkdiv = 0;
+
+  /* Check the parameters */
+  assert_param(IS_FSMC_MEM_MODE(Init->Mode));
+
+  ReadTiming->FSMC_AddressHoldTime = 0;
+  ReadTiming->FSMC_BusTurnAroundDuration =
+    FSMC_MemMin(FSMC_MEM_CYCLES(Init->BusTurnAround, khz), FSMC_MEM_BUSTURN_MAX);
+  ReadTiming->FSMC_AccessMode = FSMC_AccessMode_A;
+
+  if (Init->Mode == FSMC_MEM_SYNC_BURST)
+  {
+    /* CLK = HCLK / clkdiv, clkdiv from 2 to 16 */
+    if (Init->MaxClock != 0)
+    {
+      clkdiv = (HCLK_Frequency + Init->MaxClock - 1) / Init->MaxClock;
+    }
+    clkdiv = FSMC_MemMin(FSMC_MemMax(clkdiv, 2), FSMC_MEM_CLKDIV_MAX);
+
+    ReadTiming->FSMC_AddressSetupTime = 0;
+    ReadTiming->FSMC_DataSetupTime = 1;
+    ReadTiming->FSMC_CLKDivision = clkdiv - 1;
+
+    /* DATLAT = 0 gives 2 clock cycles; with the wait signal it must be 0 */
+    if ((Init->WaitSignal == FSMC_WaitSignal_Enable) || (Init->Latency <= 2))
+    {
+      ReadTiming->FSMC_DataLatency = 0;
+    }
+    else
+    {
+      ReadTiming->FSMC_DataLatency = FSMC_MemMin(Init->Latency - 2, FSMC_MEM_DATLAT_MAX);
+    }
+    *WriteTiming = *ReadTiming;
+  }
+  else
+  {
+    addset = FSMC_MemMin(FSMC_MEM_CYCLES(Init->AddressSetup, khz), FSMC_MEM_ADDSET_MAX);
+
+    /* Read: tRC and tAA */
+    datast = FSMC_MEM_CYCLES(Init->ReadCycle, khz);
+    datast = (datast > (addset + 2)) ? (datast - addset - 2) : 1;
+    if ((FSMC_MEM_CYCLES(Init->AccessTime, khz) + 1) > (datast + addset))
+    {
+      datast = FSMC_MEM_CYCLES(Init->AccessTime, khz) + 1 - addset;
+    }
+    ReadTiming->FSMC_AddressSetupTime = addset;
+    ReadTiming->FSMC_DataSetupTime = FSMC_MemMin(FSMC_MemMax(datast, 1), FSMC_MEM_DATAST_MAX);
+    ReadTiming->FSMC_CLKDivision = 1;
+    ReadTiming->FSMC_DataLatency = 0;
+
+    /* Write: tWP and tWC */
+    *WriteTiming = *ReadTiming;
+    datast = FSMC_MEM_CYCLES(Init->WriteCycle, khz);
+    datast = (datast > (addset + 2)) ? (datast - addset - 2) : 1;
+    datast = FSMC_MemMax(datast, FSMC_MEM_CYCLES(Init->WritePulse, khz));
+    WriteTiming->FSMC_DataSetupTime = FSMC_MemMin(FSMC_MemMax(datast, 1), FSMC_MEM_DATAST_MAX);
+  }
+}
+
+/**
+  * @brief  Configures and enables a NOR/SRAM bank for an external memory,
+  *         with the timings computed for the current HCLK frequency.
+  * @param  Mem: pointer to a FSMC_MemTypeDef structure, initialized by this
+  *         function.
+  * @param  Init: pointer to a FSMC_MemInitTypeDef structure with the
+  *         parameters of the memory.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the bank is enabled
+  *          - ERROR: invalid parameters
+  */
+ErrorStatus FSMC_MemInit(FSMC_MemTypeDef* Mem, const FSMC_MemInitTypeDef* Init)
+{
+  FSMC_NORSRAMInitTypeDef  FSMC_NORSRAMInitStructure;
+  FSMC_NORSRAMTimingInitTypeDef  readTiming;
+  FSMC_NORSRAMTimingInitTypeDef  writeTiming;
+  RCC_ClocksTypeDef  clocks;
+
+  /* Check the parameters */
+  assert_param(IS_FSMC_NORSRAM_BANK(Init->Bank));
+  assert_param(IS_FSMC_MEM_TYPE(Init->MemoryType));
+  assert_param(IS_FSMC_MEMORY_WIDTH(Init->DataWidth));
+  assert_param(IS_FSMC_MEM_SIZE(Init->Size));
+  assert_param(IS_FSMC_MEM_MODE(Init->Mode));
+
+  if (!IS_FSMC_MEM_SIZE(Init->Size) ||
+      ((Init->Mode == FSMC_MEM_SYNC_BURST) && (Init->MemoryType != FSMC_MemoryType_PSRAM)))
+  {
+    return ERROR;
+  }
+
+  RCC_GetClocksFreq(&clocks);
+  FSMC_MemComputeTiming(Init, clocks.HCLK_Frequency, &readTiming, &writeTiming);
+
+  FSMC_NORSRAMStructInit(&FSMC_NORSRAMInitStructure);
+  FSMC_NORSRAMInitStructure.FSMC_Bank = Init->Bank;
+  FSMC_NORSRAMInitStructure.FSMC_DataAddressMux = FSMC_DataAddressMux_Disable;
+  FSMC_NORSRAMInitStructure.FSMC_MemoryType = Init->MemoryType;
+  FSMC_NORSRAMInitStructure.FSMC_MemoryDataWidth = Init->DataWidth;
+  FSMC_NORSRAMInitStructure.FSMC_WriteOperation = FSMC_WriteOperation_Enable;
+  FSMC_NORSRAMInitStructure.FSMC_ReadWriteTimingStruct = &readTiming;
+  FSMC_NORSRAMInitStructure.FSMC_WriteTimingStruct = &writeTiming;
+
+  if (Init->Mode == FSMC_MEM_SYNC_BURST)
+  {
+    FSMC_NORSRAMInitStructure.FSMC_BurstAccessMode = FSMC_BurstAccessMode_Enable;
+    FSMC_NORSRAMInitStructure.FSMC_WriteBurst = FSMC_WriteBurst_Enable;
+    FSMC_NORSRAMInitStructure.FSMC_WaitSignal = Init->WaitSignal;
+    FSMC_NORSRAMInitStructure.FSMC_ExtendedMode = FSMC_ExtendedMode_Disable;
+  }
+  else
+  {
+    FSMC_NORSRAMInitStructure.FSMC_BurstAccessMode = FSMC_BurstAccessMode_Disable;
+    FSMC_NORSRAMInitStructure.FSMC_WriteBurst = FSMC_WriteBurst_Disable;
+    FSMC_NORSRAMInitStructure.FSMC_WaitSignal = FSMC_WaitSignal_Disable;
+    FSMC_NORSRAMInitStructure.FSMC_ExtendedMode = FSMC_ExtendedMode_Enable;
+  }
+
+  FSMC_NORSRAMCmd(Init->Bank, DISABLE);
+  FSMC_NORSRAMInit(&FSMC_NORSRAMInitStructure);
+  FSMC_NORSRAMCmd(Init->Bank, ENABLE);
+
+  Mem->Base = FSMC_MEM_BANK_ADDR(Init->Bank);
+  Mem->Size = Init->Size;
+  Mem->Free = 0;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Takes a buffer from an external memory. The buffers are not freed.
+  * @param  Mem: pointer to a FSMC_MemTypeDef structure initialized by
+  *         FSMC_MemInit().
+  * @param  Size: size of the buffer in bytes.
+  * @param  Align: alignment of the buffer in bytes, a power of 2. Use 4 or
+  *         more for 32-bit accesses and DMA transfers by words.
+  * @retval Address of the buffer, or 0 when the memory is full.
+  */
+void* FSMC_MemAlloc(FSMC_MemTypeDef* Mem, uint32_t Size, uint32_t Align)
+{
+  uint32_t offset;
+
+  /* Check the parameters */
+  assert_param(IS_FSMC_MEM_ALIGN(Align));
+
+  offset = (Mem->Free + Align - 1) & ~(Align - 1);
+  if ((offset < Mem->Free) || (offset > Mem->Size) || (Size > (Mem->Size - offset)))
+  {
+    return 0;
+  }
+  Mem->Free = offset + Size;
+
+  return (void*)(Mem->Base + offset);
+}
+
+/**
+  * @brief  Returns the bytes of an external memory not given by FSMC_MemAlloc().
+  * @param  Mem: pointer to a FSMC_MemTypeDef structure initialized by
+  *         FSMC_MemInit().
+  * @retval Number of free bytes.
+  */
+uint32_t FSMC_MemGetFree(FSMC_MemTypeDef* Mem)
+{
+  return Mem->Size - Mem->Free;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup FSMC_Group6 Bandwidth benchmark function
+ *  @brief   Bandwidth benchmark function
+ *
+@verbatim
+ ===============================================================================
+                        Bandwidth benchmark function
+ ===============================================================================
+
+  FSMC_MemBenchmark() times the accesses with the DWT cycle counter. The
+  random accesses follow a linear congruential sequence of addresses, whose
+  computation is part of the measured time as in a real random access loop.
+  Run it with the interrupts disabled, or at least without other traffic on
+  the external memory, for stable results.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Measures the bandwidth of an external memory, and overwrites the
+  *         first Length bytes of the buffers not given by FSMC_MemAlloc().
+  * @param  Mem: pointer to a FSMC_MemTypeDef structure initialized by
+  *         FSMC_MemInit().
+  * @param  Length: bytes accessed by each test, a power of 2 from 64 bytes.
+  * @param  Result: pointer to a FSMC_MemBenchTypeDef structure receiving the
+  *         bandwidths.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the results are valid
+  *          - ERROR: the free space of the memory is shorter than Length
+  */
+ErrorStatus FSMC_MemBenchmark(FSMC_MemTypeDef* Mem, uint32_t Length, FSMC_MemBenchTypeDef* Result)
+{
+  uint32_t base;
+  uint32_t width;
+  uint32_t i;
+
+  /* Check the parameters */
+  assert_param(IS_FSMC_MEM_ALIGN(Length));
+
+  base = (Mem->Free + 3) & ~(uint32_t)3;
+  if ((Length < 64) || ((Length & (Length - 1)) != 0) ||
+      (base > Mem->Size) || (Length > (Mem->Size - base)))
+  {
+    return ERROR;
+  }
+  base += Mem->Base;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  FSMC_MEM_DWT_CTRL |= FSMC_MEM_DWT_CYCCNTENA;
+
+  for (i = 0, width = 1; i < 3; i++, width <<= 1)
+  {
+    Result->SeqWrite[i] = FSMC_MemBench(base, Length, width, 1, 0);
+    Result->SeqRead[i] = FSMC_MemBench(base, Length, width, 0, 0);
+    Result->RandWrite[i] = FSMC_MemBench(base, Length, width, 1, 1);
+    Result->RandRead[i] = FSMC_MemBench(base, Length, width, 0, 1);
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @brief  Runs one benchmark test.
+  * @param  Base: address of the tested range.
+  * @param  Length: size of the range in bytes, a power of 2.
+  * @param  Width: size of the accesses, 1, 2 or 4 bytes.
+  * @param  Write: 1 for writes, 0 for reads.
+  * @param  Random: 1 for pseudo-random addresses, 0 for sequential addresses.
+  * @retval Bandwidth in Kbytes per second.
+  */
+static uint32_t FSMC_MemBench(uint32_t Base, uint32_t Length, uint32_t Width,
+                              uint32_t Write, uint32_t Random)
+{
+  uint32_t mask = (Length - 1) & ~(Width - 1);
+  uint32_t count = Length / Width;
+  uint32_t offset = 0;
+  uint32_t sink = 0;
+  uint32_t cycles;
+  uint32_t n;
+
+  cycles = FSMC_MEM_DWT_CYCCNT;
+  for (n = 0; n < count; n++)
+  {
+    if (Random != 0)
+    {
+      offset = FSMC_MEM_RAND_NEXT(offset);
+    }
+    else
+    {
+      offset += Width;
+    }
+
+    if (Width == 4)
+    {
+      if (Write != 0)
+      {
+        *(__IO uint32_t*)(Base + (offset & mask)) = n;
+      }
+      else
+      {
+        sink += *(__IO uint32_t*)(Base + (offset & mask));
+      }
+    }
+    else if (Width == 2)
+    {
+      if (Write != 0)
+      {
+        *(__IO uint16_t*)(Base + (offset & mask)) = (uint16_t)n;
+      }
+      else
+      {
+        sink += *(__IO uint16_t*)(Base + (offset & mask));
+      }
+    }
+    else
+    {
+      if (Write != 0)
+      {
+        *(__IO uint8_t*)(Base + (offset & mask)) = (uint8_t)n;
+      }
+      else
+      {
+        sink += *(__IO uint8_t*)(Base + (offset & mask));
+      }
+    }
+  }
+  cycles = FSMC_MEM_DWT_CYCCNT - cycles;
+  (void)sink;
+
+  if (cycles == 0)
+  {
+    return 0;
+  }
+  return (uint32_t)(((uint64_t)Length * SystemCoreClock) / ((uint64_t)cycles * 1024));
+}
+
+/**
+  * @brief  Returns the larger of two values.
+  */
+static uint32_t FSMC_MemMax(uint32_t A, uint32_t B)
+{
+  return (A > B) ? A : B;
+}
+
+/**
+  * @brief  Returns the smaller of two values.
+  */
+static uint32_t FSMC_MemMin(uint32_t A, uint32_t B)
+{
+  return (A < B) ? A : B;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -91,6 +91,17 @@ typedef struct
   * @}
   */
 
+/** @defgroup MISC_Vector_Table_RAM 
+  * @{
+  */
+
+#define NVIC_VECTOR_TABLE_SIZE       ((uint32_t)128) /*!< Entries of the vector table copied to SRAM */
+#define IS_NVIC_HANDLER_IRQ(IRQ) (((int32_t)(IRQ) >= -14) && \
+                                  ((int32_t)(IRQ) < ((int32_t)NVIC_VECTOR_TABLE_SIZE - 16)))
+/**
+  * @}
+  */
+
 /** @defgroup MISC_System_Low_Power 
   * @{
   */
@@ -136,6 +147,24 @@ typedef struct
   * @}
   */
 
+/** @defgroup MISC_Latency_Class 
+  * @{
+  */
+
+#define NVIC_LatencyClass_ZeroLatency  ((uint32_t)0x00) /*!< Never masked by NVIC_EnterCritical(): the handler
+                                                              must not call the drivers nor the RTOS */
+#define NVIC_LatencyClass_High         ((uint32_t)0x01) /*!< Short deadlines: control loops, PWM update */
+#define NVIC_LatencyClass_Normal       ((uint32_t)0x02) /*!< Communication peripherals, DMA, USB */
+#define NVIC_LatencyClass_Low          ((uint32_t)0x03) /*!< Background processing */
+#define IS_NVIC_LATENCY_CLASS(CLASS) ((CLASS) <= NVIC_LatencyClass_Low)
+
+#define IS_NVIC_PLAN_PRIORITY_GROUP(GROUP) (((GROUP) == NVIC_PriorityGroup_2) || \
+                                            ((GROUP) == NVIC_PriorityGroup_3) || \
+                                            ((GROUP) == NVIC_PriorityGroup_4))
+/**
+  * @}
+  */
+
 /** @defgroup MISC_SysTick_clock_source 
   * @{
   */
@@ -155,12 +184,67 @@ typedef struct
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
+extern uint32_t NVIC_CriticalBasePri;
+
 void NVIC_PriorityGroupConfig(uint32_t NVIC_PriorityGroup);
 void NVIC_Init(NVIC_InitTypeDef* NVIC_InitStruct);
 void NVIC_SetVectorTable(uint32_t NVIC_VectTab, uint32_t Offset);
+void NVIC_RelocateVectorTable(void);
+void NVIC_SetHandler(IRQn_Type IRQn, void (*Handler)(void));
+void NVIC_PlanConfig(uint32_t NVIC_PriorityGroup);
+void NVIC_PlanIRQ(IRQn_Type IRQn, uint32_t NVIC_LatencyClass);
 void NVIC_SystemLPConfig(uint8_t LowPowerMode, FunctionalState NewState);
 void SysTick_CLKSourceConfig(uint32_t SysTick_CLKSource);
 
+/* Inline critical section functions ******************************************/
+
+/**
+  * @brief  Enters a critical section of the drivers.
+  * @note   Once NVIC_PlanConfig() is called, BASEPRI masks the interrupts up to
+  *         the NVIC_LatencyClass_High ones: the NVIC_LatencyClass_ZeroLatency
+  *         interrupts are still served. Before, PRIMASK masks all the interrupts.
+  * @note   The critical sections can be nested.
+  * @retval The state to restore with NVIC_ExitCritical().
+  */
+static __INLINE uint32_t NVIC_EnterCritical(void)
+{
+  uint32_t state = 0;
+
+  if (NVIC_CriticalBasePri != 0)
+  {
+    state = __get_BASEPRI();
+
+    /* Only raise the masking level: BASEPRI = 0 masks nothing */
+    if ((state == 0) || (state > NVIC_CriticalBasePri))
+    {
+      __set_BASEPRI(NVIC_CriticalBasePri);
+    }
+  }
+  else
+  {
+    state = __get_PRIMASK();
+    __disable_irq();
+  }
+  return state;
+}
+
+/**
+  * @brief  Exits a critical section of the drivers.
+  * @param  State: the value returned by NVIC_EnterCritical().
+  * @retval None
+  */
+static __INLINE void NVIC_ExitCritical(uint32_t State)
+{
+  if (NVIC_CriticalBasePri != 0)
+  {
+    __set_BASEPRI(State);
+  }
+  else
+  {
+    __set_PRIMASK(State);
+  }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,170 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_adc_acq.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the ADC
+  *          continuous acquisition engine.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_ADC_ACQ_H
+#define __STM32F4xx_ADC_ACQ_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_adc.h"
+#include "stm32f4xx_dma.h"
+#include "stm32f4xx_tim.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup ADC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  ADC acquisition block definition
+  */
+
+typedef struct ADC_AcqBlock
+{
+  DMA_MgrXferTypeDef Xfer;         /*!< Reserved: DMA transfer of the block. */
+
+  uint16_t* pData;                 /*!< Points to the samples of the block, right aligned, in the
+                                        order of the conversions. */
+
+  uint32_t Sequence;               /*!< Number of the block since ADC_AcqStart(). */
+
+  uint32_t Timestamp;              /*!< Time of the end of the block given by the GetTime function,
+                                        or index of the first sample of the block since ADC_AcqStart()
+                                        if there is no GetTime function. */
+
+  uint32_t State;                  /*!< Reserved: owner of the block. */
+
+  struct ADC_AcqBlock* Next;       /*!< Reserved: queue of the filled blocks. */
+}ADC_AcqBlockTypeDef;
+
+/**
+  * @brief  ADC acquisition Init structure definition
+  */
+
+typedef struct
+{
+  uint32_t ADC_Mode;               /*!< Specifies the ADCs used.
+                                        This parameter can be ADC_Mode_Independent (ADC1 only),
+                                        ADC_DualMode_Interl (ADC1 and ADC2) or ADC_TripleMode_Interl
+                                        (ADC1, ADC2 and ADC3) */
+
+  uint32_t ADC_Prescaler;          /*!< Select the frequency of the clock of the ADCs.
+                                        This parameter can be a value of @ref ADC_Prescaler */
+
+  uint32_t ADC_TwoSamplingDelay;   /*!< Configures the delay between the conversions of two ADCs.
+                                        This parameter can be a value of @ref ADC_delay_between_2_sampling_phases */
+
+  uint8_t ADC_Channel;             /*!< Specifies the channel sampled by all the ADCs.
+                                        This parameter can be a value of @ref ADC_channels */
+
+  uint8_t ADC_SampleTime;          /*!< Specifies the sample time of the channel.
+                                        This parameter can be a value of @ref ADC_sampling_times */
+
+  TIM_TypeDef* TIMx;               /*!< TIM2, TIM3 or TIM8, whose update event triggers one conversion
+                                        of each ADC, or 0 for continuous conversions at the rate of
+                                        the ADC clock. The clock of the timer must be enabled. */
+
+  uint16_t TIM_Prescaler;          /*!< Prescaler of the timer. */
+
+  uint32_t TIM_Period;             /*!< Period of the timer. */
+
+  uint16_t* Buffer;                /*!< Points to NumBlocks * BlockSize samples, 4-byte aligned in
+                                        dual and triple mode. */
+
+  uint16_t BlockSize;              /*!< Number of samples per block, even in dual and triple mode. */
+
+  uint16_t NumBlocks;              /*!< Number of blocks, from 2 to ADC_ACQ_MAX_BLOCKS. */
+
+  void (*Callback)(ADC_AcqBlockTypeDef* Block); /*!< Called from the DMA interrupt for each filled
+                                        block, which is reused when it returns. If 0, the filled
+                                        blocks are read using ADC_AcqGetBlock(). */
+
+  uint32_t (*GetTime)(void);       /*!< Returns the Timestamp of the blocks, or 0. */
+}ADC_AcqInitTypeDef;
+
+/**
+  * @brief  ADC acquisition statistics definition
+  */
+
+typedef struct
+{
+  uint32_t Blocks;                 /*!< Number of filled blocks. */
+
+  uint32_t Overruns;               /*!< Number of ADC overruns. The acquisition is restarted and the
+                                        samples converted during the restart are lost. */
+
+  uint32_t Underruns;              /*!< Number of times all the blocks were held by the consumer when
+                                        the DMA needed the next one. */
+}ADC_AcqStatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup ADC_acquisition_blocks
+  * @{
+  */
+#define ADC_ACQ_MAX_BLOCKS                         ((uint16_t)8)
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* ADC acquisition engine functions *******************************************/
+ErrorStatus ADC_AcqInit(ADC_AcqInitTypeDef* ADC_AcqInitStruct);
+void ADC_AcqStart(void);
+void ADC_AcqStop(void);
+ADC_AcqBlockTypeDef* ADC_AcqGetBlock(void);
+void ADC_AcqReleaseBlock(ADC_AcqBlockTypeDef* Block);
+void ADC_AcqGetStats(ADC_AcqStatsTypeDef* Stats);
+void ADC_AcqIRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_ADC_ACQ_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
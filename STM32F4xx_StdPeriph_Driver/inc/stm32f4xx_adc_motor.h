@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_adc_motor.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the motor
+  *          current sampling engine.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_ADC_MOTOR_H
+#define __STM32F4xx_ADC_MOTOR_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_adc.h"
+#include "stm32f4xx_tim.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup ADC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Motor sampling engine Init structure definition
+  */
+
+typedef struct
+{
+  TIM_TypeDef* TIMx;               /*!< TIM1 or TIM8, running the PWM of the phases on channels 1
+                                        to 3 in center-aligned mode 1. Its channel 4 triggers the
+                                        conversions. */
+
+  uint16_t SamplePoint;            /*!< Compare value of channel 4: the conversions start when the
+                                        counter reaches it counting down. ARR - 1 samples at the
+                                        center of the low side on time. */
+
+  uint8_t NumPhases;               /*!< Number of phase currents: 2 (ADC1 and ADC2 in dual mode)
+                                        or 3 (ADC1, ADC2 and ADC3 in triple mode). */
+
+  uint8_t ADC_Channel[3];          /*!< Channels of the phases a, b and c, converted by ADC1, ADC2
+                                        and ADC3.
+                                        This parameter can be a value of @ref ADC_channels */
+
+  uint8_t ADC_SampleTime;          /*!< Sample time of the channels.
+                                        This parameter can be a value of @ref ADC_sampling_times */
+
+  uint32_t ADC_Prescaler;          /*!< Select the frequency of the clock of the ADCs.
+                                        This parameter can be a value of @ref ADC_Prescaler */
+
+  FunctionalState Inverted;        /*!< ENABLE when the current sense amplifiers are inverting:
+                                        the currents are negated. */
+
+  void (*Callback)(const int32_t* pCurrents);
+                                   /*!< Called from the ADC interrupt with the NumPhases currents
+                                        of the period in q31 format, full scale for +/- half the
+                                        ADC range around the calibrated offset. */
+}ADC_MotorInitTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup ADC_Motor_phases
+  * @{
+  */
+#define IS_ADC_MOTOR_PHASES(PHASES) (((PHASES) == 2) || ((PHASES) == 3))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* ADC motor sampling engine functions ****************************************/
+ErrorStatus ADC_MotorInit(ADC_MotorInitTypeDef* ADC_MotorInitStruct);
+ErrorStatus ADC_MotorCalibrate(uint16_t Samples);
+void ADC_MotorStart(void);
+void ADC_MotorStop(void);
+void ADC_MotorSetDuty(const uint32_t* pDuty);
+uint32_t ADC_MotorGetOverruns(void);
+void ADC_MotorIRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_ADC_MOTOR_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
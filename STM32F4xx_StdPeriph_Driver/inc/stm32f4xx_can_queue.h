@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_can_queue.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the CAN
+  *          queued driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_CAN_QUEUE_H
+#define __STM32F4xx_CAN_QUEUE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_can.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup CAN
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  CAN RX ring definition, one per filter
+  */
+
+typedef struct
+{
+  CanRxMsg* Buffer;                /*!< Storage of the received frames. */
+
+  uint16_t Size;                   /*!< Number of frames of Buffer, a power of 2. */
+
+  __IO uint16_t Head;              /*!< Reserved: frames written by the interrupt handler. */
+
+  __IO uint16_t Tail;              /*!< Reserved: frames read by CAN_QueueRingRead(). */
+
+  __IO uint32_t Overruns;          /*!< Frames lost because the ring was full. */
+}CAN_QueueRingTypeDef;
+
+/**
+  * @brief  CAN TX queue entry definition
+  */
+
+typedef struct
+{
+  CanTxMsg Msg;                    /*!< Reserved: the frame. */
+
+  uint32_t Key;                    /*!< Reserved: arbitration field of the frame. */
+
+  uint32_t Seq;                    /*!< Reserved: order of submission of the frame. */
+}CAN_QueueTxEntryTypeDef;
+
+/**
+  * @brief  CAN queue statistics definition
+  */
+
+typedef struct
+{
+  uint32_t TxFrames;               /*!< Frames transmitted. */
+
+  uint32_t TxPreempted;            /*!< Frames taken back from a mailbox for a frame of higher
+                                        priority, and queued again. */
+
+  uint32_t TxErrors;               /*!< Frames not transmitted, in no automatic retransmission
+                                        mode. */
+
+  uint32_t TxQueueFull;            /*!< Frames refused by CAN_QueueTransmit(). */
+
+  uint32_t RxFrames;               /*!< Frames read from the hardware FIFOs. */
+
+  uint32_t RxDropped;              /*!< Frames lost because their ring was full. */
+
+  uint32_t RxUnmatched;            /*!< Frames of a filter without ring. */
+
+  uint32_t RxFifoOverruns;         /*!< Overruns of the hardware FIFOs. */
+}CAN_QueueStatsTypeDef;
+
+/**
+  * @brief  CAN queue definition, one per CAN
+  */
+
+typedef struct
+{
+  CAN_TypeDef* CANx;               /*!< Reserved: CAN1 or CAN2. */
+
+  CAN_QueueTxEntryTypeDef* TxQueue; /*!< Reserved: heap of the frames to transmit. */
+
+  uint16_t TxQueueSize;            /*!< Reserved: number of entries of TxQueue. */
+
+  uint16_t TxCount;                /*!< Reserved: frames in TxQueue. */
+
+  uint32_t TxSeq;                  /*!< Reserved: order of the next submitted frame. */
+
+  CAN_QueueTxEntryTypeDef Mailbox[3]; /*!< Reserved: frames in the TX mailboxes. */
+
+  uint8_t MailboxState[3];         /*!< Reserved: state of the TX mailboxes. */
+
+  CAN_QueueRingTypeDef* RxRings[2][28]; /*!< Reserved: ring of each FIFO and filter match index. */
+
+  CAN_QueueStatsTypeDef Stats;     /*!< Reserved: statistics returned by CAN_QueueGetStats(). */
+}CAN_QueueTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup CAN_Queue_filter_bank
+  * @{
+  */
+#define CAN_QUEUE_NO_BANK               ((uint8_t)0xFF)  /*!< No free filter bank */
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* CAN queued functions *******************************************************/
+void CAN_QueueFilterReset(void);
+ErrorStatus CAN_QueueInit(CAN_QueueTypeDef* Queue, CAN_TypeDef* CANx, CAN_QueueTxEntryTypeDef* TxQueue, uint16_t TxQueueSize);
+void CAN_QueueDeInit(CAN_QueueTypeDef* Queue);
+ErrorStatus CAN_QueueRingInit(CAN_QueueRingTypeDef* Ring, CanRxMsg* Buffer, uint16_t Size);
+uint16_t CAN_QueueRingCount(CAN_QueueRingTypeDef* Ring);
+ErrorStatus CAN_QueueRingRead(CAN_QueueRingTypeDef* Ring, CanRxMsg* RxMessage);
+uint8_t CAN_QueueFilterAdd(CAN_QueueTypeDef* Queue, uint32_t Id, uint32_t Mask, uint32_t IDE, uint8_t FIFONumber, CAN_QueueRingTypeDef* Ring);
+void CAN_QueueFilterRemove(uint8_t Bank);
+ErrorStatus CAN_QueueTransmit(CAN_QueueTypeDef* Queue, CanTxMsg* TxMessage);
+void CAN_QueueGetStats(CAN_QueueTypeDef* Queue, CAN_QueueStatsTypeDef* Stats);
+void CAN_QueueTxIRQHandler(CAN_QueueTypeDef* Queue);
+void CAN_QueueRxIRQHandler(CAN_QueueTypeDef* Queue, uint8_t FIFONumber);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_CAN_QUEUE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,198 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_can_tt.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the CAN
+  *          time-triggered schedule driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_CAN_TT_H
+#define __STM32F4xx_CAN_TT_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_can.h"
+#include "stm32f4xx_tim_wheel.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup CAN
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  CAN time-triggered slot definition, one per frame of the schedule
+  */
+
+typedef struct
+{
+  uint32_t Offset;                 /*!< Microseconds from the end of the reference message to the
+                                        transmission request, increasing along the schedule and
+                                        below CycleTime. */
+
+  uint8_t Repeat;                  /*!< Basic cycles between two transmissions of the frame: 1, 2,
+                                        4, ... up to CycleCount. */
+
+  uint8_t BaseCycle;               /*!< First basic cycle of the frame, below Repeat. */
+
+  CanTxMsg Msg;                    /*!< The frame. Its data are changed using CAN_TTSlotUpdate(). */
+
+  uint32_t Sent;                   /*!< Frames transmitted. */
+
+  uint32_t Missed;                 /*!< Slots without transmission: the mailbox was not free at
+                                        the slot, or the frame lost the arbitration until the next
+                                        reference message. */
+
+  uint16_t Last;                   /*!< Start of frame of the last frame after the start of frame of
+                                        the reference message, in CAN bit times. */
+
+  uint16_t Min;                    /*!< Smallest Last. */
+
+  uint16_t Max;                    /*!< Largest Last: Max - Min is the jitter of the slot. */
+}CAN_TTSlotTypeDef;
+
+/**
+  * @brief  CAN time-triggered schedule Init structure definition
+  */
+
+typedef struct
+{
+  CAN_TypeDef* CANx;               /*!< CAN1 or CAN2, initialized by CAN_Init(). */
+
+  uint32_t RefId;                  /*!< Identifier of the reference message. */
+
+  uint32_t RefIDE;                 /*!< Type of identifier of the reference message.
+                                        This parameter can be a value of @ref CAN_identifier_type */
+
+  uint8_t RefFIFO;                 /*!< FIFO of the reference message, not used by other filters.
+                                        This parameter can be a value of @ref CAN_receive_FIFO_number_constants */
+
+  uint8_t RefFilterNumber;         /*!< Filter bank of the reference message, from 0 to 27, not used
+                                        by other filters. */
+
+  FunctionalState Master;          /*!< ENABLE: this node is the time master and sends the
+                                        reference message every CycleTime. */
+
+  uint32_t CycleTime;              /*!< Microseconds of a basic cycle. */
+
+  uint8_t CycleCount;              /*!< Basic cycles of the schedule matrix: 1, 2, 4, ... up to
+                                        CAN_TT_MAX_CYCLES. The number of the basic cycle is the
+                                        first data byte of the reference message. */
+
+  CAN_TTSlotTypeDef* Slots;        /*!< Frames sent by this node. */
+
+  uint16_t SlotCount;              /*!< Number of Slots. */
+}CAN_TTInitTypeDef;
+
+/**
+  * @brief  CAN time-triggered schedule statistics definition
+  */
+
+typedef struct
+{
+  uint32_t Cycles;                 /*!< Reference messages sent or received. */
+
+  uint32_t RefErrors;              /*!< Reference messages not sent by the time master. */
+
+  uint32_t CycleErrors;            /*!< Reference messages with an unexpected cycle number. */
+}CAN_TTStatsTypeDef;
+
+/**
+  * @brief  CAN time-triggered schedule definition, one per CAN
+  */
+
+typedef struct
+{
+  CAN_TTInitTypeDef Init;          /*!< Reserved: configuration given to CAN_TTInit(). */
+
+  TIM_TimerTypeDef SlotTimer;      /*!< Reserved: transmission request of the next slot. */
+
+  TIM_TimerTypeDef RefTimer;       /*!< Reserved: reference message of the time master. */
+
+  uint32_t Base;                   /*!< Reserved: time of the end of the reference message, in
+                                        microseconds of the timer wheel. */
+
+  uint16_t RefStamp;               /*!< Reserved: start of frame of the reference message, in CAN
+                                        bit times. */
+
+  uint8_t Cycle;                   /*!< Reserved: number of the basic cycle. */
+
+  uint8_t Running;                 /*!< Reserved: the schedule runs. */
+
+  uint16_t Next;                   /*!< Reserved: next slot to request. */
+
+  uint16_t Preload;                /*!< Reserved: next slot to load into a mailbox. */
+
+  uint16_t Mailbox[2];             /*!< Reserved: slot loaded into mailboxes 0 and 1. */
+
+  CAN_TTStatsTypeDef Stats;        /*!< Reserved: statistics returned by CAN_TTGetStats(). */
+}CAN_TTTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup CAN_TT_Constants
+  * @{
+  */
+#define CAN_TT_MAX_CYCLES               ((uint8_t)64)      /*!< Basic cycles of a schedule matrix */
+#define CAN_TT_REF_MAILBOX              ((uint8_t)2)       /*!< Mailbox of the reference message */
+#define CAN_TT_NO_SLOT                  ((uint16_t)0xFFFF)
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* CAN time-triggered functions ***********************************************/
+ErrorStatus CAN_TTInit(CAN_TTTypeDef* TT, const CAN_TTInitTypeDef* CAN_TTInitStruct);
+void CAN_TTStart(CAN_TTTypeDef* TT);
+void CAN_TTStop(CAN_TTTypeDef* TT);
+ErrorStatus CAN_TTSlotUpdate(CAN_TTTypeDef* TT, uint16_t Slot, const uint8_t* Data, uint8_t DLC);
+void CAN_TTSlotResetStats(CAN_TTTypeDef* TT, uint16_t Slot);
+void CAN_TTGetStats(CAN_TTTypeDef* TT, CAN_TTStatsTypeDef* Stats);
+void CAN_TTTxIRQHandler(CAN_TTTypeDef* TT);
+void CAN_TTRxIRQHandler(CAN_TTTypeDef* TT);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_CAN_TT_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
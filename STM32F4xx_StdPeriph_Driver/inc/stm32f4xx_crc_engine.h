@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_crc_engine.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the generic
+  *          CRC engine.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_CRC_ENGINE_H
+#define __STM32F4xx_CRC_ENGINE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_crc.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup CRC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  CRC parameters definition
+  */
+
+typedef struct
+{
+  uint32_t Polynomial;             /*!< Specifies the polynomial in the normal form, without
+                                        the x^Width term: 0x04C11DB7 for CRC-32. */
+
+  uint32_t Init;                   /*!< Specifies the initial value of the CRC register. */
+
+  uint32_t XorOut;                 /*!< Specifies the value XORed to the final CRC register. */
+
+  uint8_t Width;                   /*!< Specifies the width of the CRC, from 8 to 32 bits. */
+
+  FunctionalState Reflected;       /*!< Specifies whether the input bytes and the output are
+                                        reflected (least significant bit first). */
+}CRC_ParamTypeDef;
+
+/**
+  * @brief  Slicing-by-8 table of a software CRC, 8 Kbytes
+  */
+
+typedef struct
+{
+  uint32_t Table[8][256];          /*!< Built by CRC_TableInit(), in RAM or copied to a
+                                        constant table. */
+}CRC_TableTypeDef;
+
+/**
+  * @brief  CRC engine definition: a CRC being computed
+  */
+
+typedef struct
+{
+  const CRC_TableTypeDef* Table;   /*!< Reserved: table of the software CRC, or 0. */
+
+  uint32_t Polynomial;             /*!< Reserved: polynomial in the form of Register. */
+
+  uint32_t Register;               /*!< Reserved: CRC register, reflected or aligned on the
+                                        most significant bit. */
+
+  uint32_t XorOut;                 /*!< Reserved: value XORed to the final CRC register. */
+
+  uint8_t Width;                   /*!< Reserved: width of the CRC. */
+
+  uint8_t Reflected;               /*!< Reserved: the input and output are reflected. */
+
+  uint8_t Hardware;                /*!< Reserved: the CRC unit computes the CRC. */
+}CRC_EngineTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup CRC_Engine_Parameters
+  * @{
+  */
+extern const CRC_ParamTypeDef CRC_Param_CRC32;        /*!< Ethernet, zip: reflected 0x04C11DB7 */
+extern const CRC_ParamTypeDef CRC_Param_CRC32_MPEG2;  /*!< 0x04C11DB7, as CRC_CalcBlockCRC() */
+extern const CRC_ParamTypeDef CRC_Param_CRC16_CCITT;  /*!< 0x1021, initial value 0xFFFF */
+extern const CRC_ParamTypeDef CRC_Param_CRC16_XMODEM; /*!< 0x1021, initial value 0 */
+extern const CRC_ParamTypeDef CRC_Param_CRC16_MODBUS; /*!< Reflected 0x8005, initial value 0xFFFF */
+
+#define IS_CRC_WIDTH(WIDTH) (((WIDTH) >= 8) && ((WIDTH) <= 32))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Generic CRC engine functions ***********************************************/
+void CRC_TableInit(const CRC_ParamTypeDef* Param, CRC_TableTypeDef* Table);
+void CRC_EngineInit(CRC_EngineTypeDef* Engine, const CRC_ParamTypeDef* Param,
+                    const CRC_TableTypeDef* Table);
+void CRC_EngineUpdate(CRC_EngineTypeDef* Engine, const uint8_t* Data, uint32_t Length);
+uint32_t CRC_EngineFinal(CRC_EngineTypeDef* Engine);
+uint32_t CRC_Compute(const CRC_ParamTypeDef* Param, const CRC_TableTypeDef* Table,
+                     const uint8_t* Data, uint32_t Length);
+
+/* DMA CRC functions **********************************************************/
+ErrorStatus CRC_CalcBlockCRCDMA(uint32_t pBuffer[], uint32_t BufferLength, uint32_t* CRCValue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_CRC_ENGINE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,165 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_cryp_aead.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the AES-GCM
+  *          and AES-CCM authenticated encryption.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_CRYP_AEAD_H
+#define __STM32F4xx_CRYP_AEAD_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_cryp_stream.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup CRYP
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup CRYP_AEAD_chunk
+  * @{
+  */
+#define CRYP_AEAD_CHUNK                 512  /*!< Bytes per DMA job, a multiple of 16 */
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  AES-GCM context definition
+  */
+
+typedef struct
+{
+  CRYP_StreamTypeDef* Stream;      /*!< Reserved: the streaming engine. */
+
+  CRYP_StreamSessionTypeDef Session; /*!< Reserved: AES-CTR session of the counter blocks. */
+
+  CRYP_StreamJobTypeDef Job;       /*!< Reserved: DMA job of the CTR session. */
+
+  uint32_t Table[16][4];           /*!< Reserved: multiples of the hash key for the 4-bit GHASH. */
+
+  uint32_t Hash[4];                /*!< Reserved: GHASH accumulator. */
+
+  uint32_t Mask[4];                /*!< Reserved: E(K, J0), mask of the tag. */
+
+  uint32_t Buffer[8];              /*!< Reserved: a block aligned on 16 bytes for the DMA. */
+
+  uint8_t Partial[16];             /*!< Reserved: AAD bytes waiting for a complete block. */
+
+  uint32_t PartialLength;          /*!< Reserved: number of bytes in Partial. */
+
+  uint32_t AADLength;              /*!< Reserved: AAD bytes hashed. */
+
+  uint32_t DataLength;             /*!< Reserved: data bytes processed. */
+
+  uint8_t Mode;                    /*!< Reserved: MODE_ENCRYPT or MODE_DECRYPT. */
+
+  uint8_t State;                   /*!< Reserved: AAD, data or final phase. */
+}CRYP_GCMTypeDef;
+
+/**
+  * @brief  AES-CCM context definition
+  */
+
+typedef struct
+{
+  CRYP_StreamTypeDef* Stream;      /*!< Reserved: the streaming engine. */
+
+  CRYP_StreamSessionTypeDef SessionCTR; /*!< Reserved: AES-CTR session of the counter blocks. */
+
+  CRYP_StreamSessionTypeDef SessionMAC; /*!< Reserved: AES-CBC session of the CBC-MAC. */
+
+  CRYP_StreamJobTypeDef Job[2];    /*!< Reserved: DMA jobs of the two sessions. */
+
+  uint32_t Stage[(CRYP_AEAD_CHUNK / 4) + 4]; /*!< Reserved: formatted blocks of the CBC-MAC,
+                                        from the first address aligned on 16 bytes. */
+
+  uint32_t StageLength;            /*!< Reserved: number of bytes in Stage. */
+
+  uint32_t Buffer[8];              /*!< Reserved: a block aligned on 16 bytes for the DMA. */
+
+  uint32_t Mac[4];                 /*!< Reserved: last block of the CBC-MAC. */
+
+  uint32_t Mask[4];                /*!< Reserved: E(K, A0), mask of the tag. */
+
+  uint32_t AADLength;              /*!< Reserved: AAD bytes of the message. */
+
+  uint32_t PayloadLength;          /*!< Reserved: payload bytes of the message. */
+
+  uint32_t AADCount;               /*!< Reserved: AAD bytes processed. */
+
+  uint32_t PayloadCount;           /*!< Reserved: payload bytes processed. */
+
+  uint8_t TagLength;               /*!< Reserved: bytes of the tag. */
+
+  uint8_t Mode;                    /*!< Reserved: MODE_ENCRYPT or MODE_DECRYPT. */
+
+  uint8_t State;                   /*!< Reserved: AAD, data or final phase. */
+}CRYP_CCMTypeDef;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* AES-GCM functions **********************************************************/
+ErrorStatus CRYP_GCMInit(CRYP_GCMTypeDef* GCM, CRYP_StreamTypeDef* Stream, uint8_t Mode,
+                         uint8_t* Key, uint16_t Keysize, uint8_t* IV, uint32_t IVLength);
+ErrorStatus CRYP_GCMUpdateAAD(CRYP_GCMTypeDef* GCM, uint8_t* AAD, uint32_t Length);
+ErrorStatus CRYP_GCMUpdate(CRYP_GCMTypeDef* GCM, uint8_t* Input, uint32_t Length, uint8_t* Output);
+ErrorStatus CRYP_GCMFinish(CRYP_GCMTypeDef* GCM, uint8_t* Tag, uint32_t TagLength);
+
+/* AES-CCM functions **********************************************************/
+ErrorStatus CRYP_CCMInit(CRYP_CCMTypeDef* CCM, CRYP_StreamTypeDef* Stream, uint8_t Mode,
+                         uint8_t* Key, uint16_t Keysize, uint8_t* Nonce, uint32_t NonceLength,
+                         uint32_t AADLength, uint32_t PayloadLength, uint8_t TagLength);
+ErrorStatus CRYP_CCMUpdateAAD(CRYP_CCMTypeDef* CCM, uint8_t* AAD, uint32_t Length);
+ErrorStatus CRYP_CCMUpdate(CRYP_CCMTypeDef* CCM, uint8_t* Input, uint32_t Length, uint8_t* Output);
+ErrorStatus CRYP_CCMFinish(CRYP_CCMTypeDef* CCM, uint8_t* Tag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_CRYP_AEAD_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,209 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_cryp_stream.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the CRYP
+  *          AES streaming engine.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_CRYP_STREAM_H
+#define __STM32F4xx_CRYP_STREAM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_cryp.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup CRYP
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup CRYP_Stream_job_length
+  * @{
+  */
+#define CRYP_STREAM_MAX_LENGTH          ((uint32_t)262128)  /*!< Bytes per job: 65532 words, one DMA transfer */
+#define IS_CRYP_STREAM_LENGTH(LENGTH)   (((LENGTH) != 0) && (((LENGTH) & 0xF) == 0) && \
+                                         ((LENGTH) <= CRYP_STREAM_MAX_LENGTH))
+/**
+  * @}
+  */
+
+/** @defgroup CRYP_Stream_job_status
+  * @{
+  */
+#define CRYP_STREAM_JOB_DONE            ((uint32_t)0x00000000)  /*!< Output written */
+#define CRYP_STREAM_JOB_QUEUED          ((uint32_t)0x00000001)  /*!< Waiting for the engine */
+#define CRYP_STREAM_JOB_ACTIVE          ((uint32_t)0x00000002)  /*!< Being processed */
+#define CRYP_STREAM_JOB_ERROR           ((uint32_t)0x00000003)  /*!< DMA error or key preparation timeout */
+#define CRYP_STREAM_JOB_ABORTED         ((uint32_t)0x00000004)  /*!< Aborted by CRYP_StreamAbort() */
+/**
+  * @}
+  */
+
+/** @defgroup CRYP_Stream_AES_mode
+  * @{
+  */
+#define IS_CRYP_STREAM_ALGOMODE(ALGOMODE) (((ALGOMODE) == CRYP_AlgoMode_AES_ECB) || \
+                                           ((ALGOMODE) == CRYP_AlgoMode_AES_CBC) || \
+                                           ((ALGOMODE) == CRYP_AlgoMode_AES_CTR))
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct CRYP_Stream;
+struct CRYP_StreamJob;
+
+/**
+  * @brief  CRYP stream session Init structure definition
+  */
+
+typedef struct
+{
+  uint16_t CRYP_AlgoDir;           /*!< CRYP_AlgoDir_Encrypt or CRYP_AlgoDir_Decrypt. */
+
+  uint16_t CRYP_AlgoMode;          /*!< CRYP_AlgoMode_AES_ECB, CRYP_AlgoMode_AES_CBC or
+                                        CRYP_AlgoMode_AES_CTR. */
+
+  uint16_t CRYP_DataType;          /*!< Swapping of the data, CRYP_DataType_8b for byte strings.
+                                        This parameter can be a value of @ref CRYP_Data_Type */
+
+  uint16_t KeySize;                /*!< Length of Key in bits: 128, 192 or 256. */
+
+  uint8_t* Key;                    /*!< The key, as a byte string. */
+
+  uint8_t* IV;                     /*!< The 16-byte initialization vector, or counter block
+                                        in CTR mode. Not used in ECB mode. */
+}CRYP_StreamSessionInitTypeDef;
+
+/**
+  * @brief  CRYP stream session definition: a key, a mode and the chaining
+  *         state of a sequence of jobs.
+  */
+
+typedef struct
+{
+  CRYP_KeyInitTypeDef Key;         /*!< Reserved: key words in the order of the key registers. */
+
+  CRYP_Context Context;            /*!< Reserved: configuration, key and initialization vector
+                                        of the session, saved by CRYP_SaveContext() when the
+                                        engine switches to another session. */
+
+  uint8_t Prepare;                 /*!< Reserved: the session needs the AES key preparation,
+                                        ECB or CBC decryption. */
+}CRYP_StreamSessionTypeDef;
+
+/**
+  * @brief  CRYP stream job definition
+  */
+
+typedef struct CRYP_StreamJob
+{
+  CRYP_StreamSessionTypeDef* Session; /*!< Session of the job. */
+
+  uint32_t* pInput;                /*!< Input data, aligned on 16 bytes. */
+
+  uint32_t* pOutput;               /*!< Output data, aligned on 16 bytes. May be pInput. */
+
+  uint32_t Length;                 /*!< Bytes to process, a multiple of 16 up to
+                                        CRYP_STREAM_MAX_LENGTH. */
+
+  void (*Callback)(struct CRYP_StreamJob* Job); /*!< Called from the DMA interrupt when the job
+                                        ends, or 0. */
+
+  void* Context;                   /*!< Free for the application. */
+
+  __IO uint32_t Status;            /*!< Status of the job.
+                                        This member is a value of @ref CRYP_Stream_job_status */
+
+  DMA_MgrXferTypeDef XferIn;       /*!< Reserved: DMA transfer to the IN FIFO. */
+
+  DMA_MgrXferTypeDef XferOut;      /*!< Reserved: DMA transfer from the OUT FIFO. */
+
+  struct CRYP_Stream* Stream;      /*!< Reserved: the engine of the job. */
+
+  struct CRYP_StreamJob* Next;     /*!< Reserved: next job of the queue. */
+}CRYP_StreamJobTypeDef;
+
+/**
+  * @brief  CRYP streaming engine definition
+  */
+
+typedef struct CRYP_Stream
+{
+  DMA_Stream_TypeDef* StreamIn;    /*!< Reserved: DMA stream of the CRYP_IN request. */
+
+  DMA_Stream_TypeDef* StreamOut;   /*!< Reserved: DMA stream of the CRYP_OUT request. */
+
+  CRYP_StreamJobTypeDef* Head;     /*!< Reserved: first queued job. */
+
+  CRYP_StreamJobTypeDef* Tail;     /*!< Reserved: last queued job. */
+
+  CRYP_StreamJobTypeDef* Active;   /*!< Reserved: job being processed. */
+
+  CRYP_StreamSessionTypeDef* Current; /*!< Reserved: session loaded in the CRYP, or 0. */
+
+  uint32_t Jobs;                   /*!< Jobs processed. */
+
+  uint32_t Switches;               /*!< Session loads. */
+
+  uint32_t KeyPreparations;        /*!< AES key preparations. */
+}CRYP_StreamTypeDef;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* CRYP streaming functions ***************************************************/
+ErrorStatus CRYP_StreamInit(CRYP_StreamTypeDef* Stream);
+void CRYP_StreamDeInit(CRYP_StreamTypeDef* Stream);
+ErrorStatus CRYP_StreamSessionInit(CRYP_StreamTypeDef* Stream, CRYP_StreamSessionTypeDef* Session,
+                                   const CRYP_StreamSessionInitTypeDef* CRYP_StreamSessionInitStruct);
+ErrorStatus CRYP_StreamSubmit(CRYP_StreamTypeDef* Stream, CRYP_StreamJobTypeDef* Job);
+void CRYP_StreamAbort(CRYP_StreamTypeDef* Stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_CRYP_STREAM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
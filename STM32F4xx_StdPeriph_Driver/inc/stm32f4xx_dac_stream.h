@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_dac_stream.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the DAC
+  *          streaming driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_DAC_STREAM_H
+#define __STM32F4xx_DAC_STREAM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_dac.h"
+#include "stm32f4xx_tim.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup DAC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct DAC_Stream;
+
+/**
+  * @brief  DAC stream Init structure definition
+  */
+
+typedef struct
+{
+  uint32_t Channels;               /*!< Channels of the stream.
+                                        This parameter can be a value of @ref DAC_Stream_channels */
+
+  TIM_TypeDef* TIMx;               /*!< Timer of the sample clock, TIM6 or TIM7. */
+
+  uint32_t SampleRate;             /*!< Samples per second. */
+
+  uint32_t DAC_OutputBuffer;       /*!< DAC_OutputBuffer_Enable or DAC_OutputBuffer_Disable. */
+
+  void* Buffer;                    /*!< Samples played in a loop, uint16_t for one channel
+                                        or uint32_t packed by DAC_STREAM_PACK() for the two. */
+
+  uint16_t BufferSamples;          /*!< Number of samples of Buffer, even, from 2 to 65534. */
+
+  void (*Fill)(struct DAC_Stream* Stream, void* pSamples, uint16_t Samples);
+                                   /*!< Called to write the next samples of a half of Buffer:
+                                        twice by DAC_StreamInit(), then from the DMA interrupt
+                                        each time a half has been played. */
+}DAC_StreamInitTypeDef;
+
+/**
+  * @brief  DAC stream definition
+  */
+
+typedef struct DAC_Stream
+{
+  DAC_StreamInitTypeDef Init;      /*!< Reserved: configuration given to DAC_StreamInit(). */
+
+  DMA_Stream_TypeDef* Stream;      /*!< Reserved: DMA stream of the DAC request. */
+
+  DMA_MgrXferTypeDef Xfer[2];      /*!< Reserved: the two halves of Buffer. */
+
+  uint32_t SampleRate;             /*!< Sample rate obtained from the timer clock. */
+
+  uint32_t Underruns;              /*!< Halves not filled in time: a half was played again,
+                                        or the DAC missed a DMA request. */
+
+  void* Context;                   /*!< Free for the application. */
+}DAC_StreamTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup DAC_Stream_channels
+  * @{
+  */
+#define DAC_STREAM_CHANNEL1             ((uint32_t)0x00000001)  /*!< Channel 1, 12-bit samples */
+#define DAC_STREAM_CHANNEL2             ((uint32_t)0x00000002)  /*!< Channel 2, 12-bit samples */
+#define DAC_STREAM_DUAL                 ((uint32_t)0x00000003)  /*!< Both channels, packed samples */
+#define IS_DAC_STREAM_CHANNELS(CHANNELS) (((CHANNELS) == DAC_STREAM_CHANNEL1) || \
+                                          ((CHANNELS) == DAC_STREAM_CHANNEL2) || \
+                                          ((CHANNELS) == DAC_STREAM_DUAL))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+
+/** @brief  Packs the 12-bit samples of the two channels for DAC_STREAM_DUAL.
+  */
+#define DAC_STREAM_PACK(CH1, CH2)  ((((uint32_t)(CH2) & 0xFFF) << 16) | ((uint32_t)(CH1) & 0xFFF))
+
+/* Exported functions --------------------------------------------------------*/
+
+/* DAC streaming functions ****************************************************/
+ErrorStatus DAC_StreamInit(DAC_StreamTypeDef* Stream, const DAC_StreamInitTypeDef* DAC_StreamInitStruct);
+void DAC_StreamDeInit(DAC_StreamTypeDef* Stream);
+void DAC_StreamStart(DAC_StreamTypeDef* Stream);
+void DAC_StreamStop(DAC_StreamTypeDef* Stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_DAC_STREAM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_dcmi_capture.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the DCMI
+  *          capture pipeline.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_DCMI_CAPTURE_H
+#define __STM32F4xx_DCMI_CAPTURE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_dcmi.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup DCMI
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup DCMI_Capture_segments
+  * @{
+  */
+#define DCMI_CAPTURE_MAX_SEGMENTS       16  /*!< DMA transfers per frame, at most 65532 words each */
+/**
+  * @}
+  */
+
+/** @defgroup DCMI_Capture_frame_status
+  * @{
+  */
+#define DCMI_CAPTURE_FRAME_FREE         ((uint32_t)0x00000000)  /*!< In the pool */
+#define DCMI_CAPTURE_FRAME_QUEUED       ((uint32_t)0x00000001)  /*!< Queued on the DMA */
+#define DCMI_CAPTURE_FRAME_READY        ((uint32_t)0x00000002)  /*!< Given to the application */
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct DCMI_Capture;
+
+/**
+  * @brief  DCMI capture frame buffer definition
+  */
+
+typedef struct DCMI_CaptureFrame
+{
+  uint32_t* pData;                 /*!< Frame buffer of FrameSize bytes, aligned on 16 bytes,
+                                        in the SRAM or in an external memory on the FSMC. */
+
+  void* Context;                   /*!< Free for the application. */
+
+  uint32_t Number;                 /*!< Number of the frame since DCMI_CaptureStart(), set
+                                        when the frame is ready. */
+
+  __IO uint32_t Status;            /*!< Status of the frame buffer.
+                                        This parameter is a value of @ref DCMI_Capture_frame_status */
+
+  DMA_MgrXferTypeDef Xfer[DCMI_CAPTURE_MAX_SEGMENTS]; /*!< Reserved: DMA transfers of the segments
+                                        of the frame. */
+
+  struct DCMI_Capture* Capture;    /*!< Reserved: the pipeline of the frame buffer. */
+
+  struct DCMI_CaptureFrame* Next;  /*!< Reserved: next frame buffer of the free or capture list. */
+}DCMI_CaptureFrameTypeDef;
+
+/**
+  * @brief  DCMI capture pipeline Init structure definition
+  */
+
+typedef struct
+{
+  DCMI_InitTypeDef DCMI_InitStruct; /*!< Configuration of the DCMI. The capture mode is set to
+                                        DCMI_CaptureMode_Continuous. */
+
+  uint32_t FrameSize;              /*!< Bytes per frame, a multiple of 16. */
+
+  DCMI_CaptureFrameTypeDef* Frames; /*!< Pool of frame buffers, with their pData member set. */
+
+  uint8_t NumFrames;               /*!< Number of frame buffers of the pool, at least 2. */
+
+  void (*FrameCallback)(struct DCMI_Capture* Capture, DCMI_CaptureFrameTypeDef* Frame);
+                                   /*!< Called from the DMA interrupt with each captured frame,
+                                        given back by DCMI_CaptureRelease(). */
+
+  void (*LineCallback)(struct DCMI_Capture* Capture, uint32_t Line);
+                                   /*!< Called from the DCMI interrupt at the end of each line,
+                                        or 0. */
+  void (*SegmentCallback)(struct DCMI_Capture* Capture, DCMI_CaptureFrameTypeDef* Frame, uint32_t Segment);
+                                   /*!< Called from the DMA interrupt at the end of each DMA
+                                        transfer of a frame, with the index of the segment
+                                        received in Frame->pData, or 0. */
+}DCMI_CaptureInitTypeDef;
+
+/**
+  * @brief  DCMI capture pipeline definition
+  */
+
+typedef struct DCMI_Capture
+{
+  DCMI_CaptureInitTypeDef Init;    /*!< Reserved: configuration given to DCMI_CaptureInit(). */
+
+  DMA_Stream_TypeDef* Stream;      /*!< Reserved: DMA stream of the DCMI request. */
+
+  uint32_t Segments;               /*!< Reserved: DMA transfers per frame. */
+
+  uint32_t SegmentWords;           /*!< Reserved: words per DMA transfer. */
+
+  DCMI_CaptureFrameTypeDef* FreeHead; /*!< Reserved: first free frame buffer. */
+
+  DCMI_CaptureFrameTypeDef* FreeTail; /*!< Reserved: last free frame buffer. */
+
+  DCMI_CaptureFrameTypeDef* QueuedHead; /*!< Reserved: frame buffer being captured. */
+
+  DCMI_CaptureFrameTypeDef* QueuedTail; /*!< Reserved: last frame buffer queued on the DMA. */
+
+  uint32_t Queued;                 /*!< Reserved: frame buffers queued on the DMA. */
+
+  uint32_t Line;                   /*!< Reserved: lines received in the current frame. */
+
+  uint8_t Running;                 /*!< Reserved: the capture is started. */
+
+  uint8_t Stalled;                 /*!< Reserved: the capture waits for a free frame buffer. */
+
+  uint32_t FrameCount;             /*!< Frames captured since DCMI_CaptureStart(). */
+
+  uint32_t Dropped;                /*!< Frames lost by overrun, synchronization or DMA error. */
+
+  uint32_t Stalls;                 /*!< Times the capture stopped with no free frame buffer. */
+
+  void* Context;                   /*!< Free for the application. */
+}DCMI_CaptureTypeDef;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* DCMI capture functions *****************************************************/
+ErrorStatus DCMI_CaptureInit(DCMI_CaptureTypeDef* Capture, const DCMI_CaptureInitTypeDef* DCMI_CaptureInitStruct);
+void DCMI_CaptureDeInit(DCMI_CaptureTypeDef* Capture);
+void DCMI_CaptureStart(DCMI_CaptureTypeDef* Capture);
+void DCMI_CaptureStop(DCMI_CaptureTypeDef* Capture);
+void DCMI_CaptureRelease(DCMI_CaptureTypeDef* Capture, DCMI_CaptureFrameTypeDef* Frame);
+uint32_t DCMI_CaptureGetSegmentSize(DCMI_CaptureTypeDef* Capture);
+void DCMI_CaptureIRQHandler(DCMI_CaptureTypeDef* Capture);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_DCMI_CAPTURE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -109,6 +109,43 @@ typedef struct
                                         @note The burst mode is possible only if the address Increment mode is enabled. */  
 }DMA_InitTypeDef;
 
+/** 
+  * @brief  DMA Manager transfer descriptor definition
+  */
+
+typedef struct DMA_MgrXfer
+{
+  uint32_t MemoryBaseAddr;         /*!< Specifies the memory address of the transfer. */
+
+  uint16_t Count;                  /*!< Specifies the number of data items of the transfer.
+                                        @note In streaming mode all the transfers have the DMA_BufferSize
+                                              given to DMA_MgrAlloc() and this member is not used. */
+
+  void (*Callback)(struct DMA_MgrXfer* Xfer); /*!< Called by DMA_MgrIRQHandler() when the transfer ends, or 0. */
+
+  void* Context;                   /*!< Free for the caller, not used by the manager. */
+
+  __IO uint32_t Status;            /*!< State of the transfer, updated by the manager.
+                                        This member is a value of @ref DMA_Manager_transfer_status */
+
+  struct DMA_MgrXfer* Next;        /*!< Reserved for the queue of the stream. */
+}DMA_MgrXferTypeDef;
+
+/** 
+  * @brief  DMA Manager request table entry definition
+  */
+
+typedef struct
+{
+  uint32_t Request;                /*!< Specifies the peripheral request.
+                                        This parameter can be a value of @ref DMA_Manager_requests */
+
+  DMA_Stream_TypeDef* Stream;      /*!< Specifies a stream connected to the request. */
+
+  uint32_t Channel;                /*!< Specifies the channel of the request on this stream.
+                                        This parameter can be a value of @ref DMA_channel */
+}DMA_MgrRequestTypeDef;
+
 /* Exported constants --------------------------------------------------------*/
 
 /** @defgroup DMA_Exported_Constants
@@ -551,6 +588,84 @@ typedef struct
   * @}
   */ 
 
+
+/** @defgroup DMA_Manager_requests 
+  * @{
+  */ 
+#define DMA_MGR_REQ_MEM2MEM               ((uint32_t)0x00000000)
+#define DMA_MGR_REQ_SPI1_RX               ((uint32_t)0x00000001)
+#define DMA_MGR_REQ_SPI1_TX               ((uint32_t)0x00000002)
+#define DMA_MGR_REQ_SPI2_RX               ((uint32_t)0x00000003)
+#define DMA_MGR_REQ_SPI2_TX               ((uint32_t)0x00000004)
+#define DMA_MGR_REQ_SPI3_RX               ((uint32_t)0x00000005)
+#define DMA_MGR_REQ_SPI3_TX               ((uint32_t)0x00000006)
+#define DMA_MGR_REQ_USART1_RX             ((uint32_t)0x00000007)
+#define DMA_MGR_REQ_USART1_TX             ((uint32_t)0x00000008)
+#define DMA_MGR_REQ_USART2_RX             ((uint32_t)0x00000009)
+#define DMA_MGR_REQ_USART2_TX             ((uint32_t)0x0000000A)
+#define DMA_MGR_REQ_USART3_RX             ((uint32_t)0x0000000B)
+#define DMA_MGR_REQ_USART3_TX             ((uint32_t)0x0000000C)
+#define DMA_MGR_REQ_UART4_RX              ((uint32_t)0x0000000D)
+#define DMA_MGR_REQ_UART4_TX              ((uint32_t)0x0000000E)
+#define DMA_MGR_REQ_UART5_RX              ((uint32_t)0x0000000F)
+#define DMA_MGR_REQ_UART5_TX              ((uint32_t)0x00000010)
+#define DMA_MGR_REQ_USART6_RX             ((uint32_t)0x00000011)
+#define DMA_MGR_REQ_USART6_TX             ((uint32_t)0x00000012)
+#define DMA_MGR_REQ_ADC1                  ((uint32_t)0x00000013)
+#define DMA_MGR_REQ_ADC2                  ((uint32_t)0x00000014)
+#define DMA_MGR_REQ_ADC3                  ((uint32_t)0x00000015)
+#define DMA_MGR_REQ_SDIO                  ((uint32_t)0x00000016)
+#define DMA_MGR_REQ_DAC1                  ((uint32_t)0x00000017)
+#define DMA_MGR_REQ_DAC2                  ((uint32_t)0x00000018)
+#define DMA_MGR_REQ_I2C1_RX               ((uint32_t)0x00000019)
+#define DMA_MGR_REQ_I2C1_TX               ((uint32_t)0x0000001A)
+#define DMA_MGR_REQ_I2C2_RX               ((uint32_t)0x0000001B)
+#define DMA_MGR_REQ_I2C2_TX               ((uint32_t)0x0000001C)
+#define DMA_MGR_REQ_I2C3_RX               ((uint32_t)0x0000001D)
+#define DMA_MGR_REQ_I2C3_TX               ((uint32_t)0x0000001E)
+#define DMA_MGR_REQ_TIM1_UP               ((uint32_t)0x0000001F)
+#define DMA_MGR_REQ_TIM2_UP               ((uint32_t)0x00000020)
+#define DMA_MGR_REQ_TIM3_UP               ((uint32_t)0x00000021)
+#define DMA_MGR_REQ_TIM4_UP               ((uint32_t)0x00000022)
+#define DMA_MGR_REQ_TIM5_UP               ((uint32_t)0x00000023)
+#define DMA_MGR_REQ_TIM8_UP               ((uint32_t)0x00000024)
+#define DMA_MGR_REQ_DCMI                  ((uint32_t)0x00000025)
+#define DMA_MGR_REQ_CRYP_IN               ((uint32_t)0x00000026)
+#define DMA_MGR_REQ_CRYP_OUT              ((uint32_t)0x00000027)
+#define DMA_MGR_REQ_HASH_IN               ((uint32_t)0x00000028)
+#define DMA_MGR_REQ_I2S2EXT_RX            ((uint32_t)0x00000029)
+#define DMA_MGR_REQ_I2S2EXT_TX            ((uint32_t)0x0000002A)
+#define DMA_MGR_REQ_I2S3EXT_RX            ((uint32_t)0x0000002B)
+#define DMA_MGR_REQ_I2S3EXT_TX            ((uint32_t)0x0000002C)
+#define DMA_MGR_REQ_TIM1_CC1              ((uint32_t)0x0000002D)
+#define DMA_MGR_REQ_TIM1_CC2              ((uint32_t)0x0000002E)
+#define DMA_MGR_REQ_TIM2_CC1              ((uint32_t)0x0000002F)
+#define DMA_MGR_REQ_TIM2_CC2              ((uint32_t)0x00000030)
+#define DMA_MGR_REQ_TIM3_CC1              ((uint32_t)0x00000031)
+#define DMA_MGR_REQ_TIM3_CC2              ((uint32_t)0x00000032)
+#define DMA_MGR_REQ_TIM4_CC1              ((uint32_t)0x00000033)
+#define DMA_MGR_REQ_TIM4_CC2              ((uint32_t)0x00000034)
+#define DMA_MGR_REQ_TIM5_CC1              ((uint32_t)0x00000035)
+#define DMA_MGR_REQ_TIM5_CC2              ((uint32_t)0x00000036)
+#define DMA_MGR_REQ_TIM8_CC1              ((uint32_t)0x00000037)
+#define DMA_MGR_REQ_TIM8_CC2              ((uint32_t)0x00000038)
+/**
+  * @}
+  */ 
+
+
+/** @defgroup DMA_Manager_transfer_status 
+  * @{
+  */ 
+#define DMA_MGR_XFER_DONE                 ((uint32_t)0x00000000)
+#define DMA_MGR_XFER_QUEUED               ((uint32_t)0x00000001)
+#define DMA_MGR_XFER_ACTIVE               ((uint32_t)0x00000002)
+#define DMA_MGR_XFER_ERROR                ((uint32_t)0x00000003)
+#define DMA_MGR_XFER_ABORTED              ((uint32_t)0x00000004)
+/**
+  * @}
+  */ 
+
 /**
   * @}
   */ 
@@ -591,6 +706,14 @@ void DMA_ITConfig(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_IT, FunctionalS
 ITStatus DMA_GetITStatus(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_IT);
 void DMA_ClearITPendingBit(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_IT);
 
+/* DMA Manager functions ******************************************************/
+void DMA_MgrInit(const DMA_MgrRequestTypeDef* RequestTable, uint32_t RequestTableSize);
+DMA_Stream_TypeDef* DMA_MgrAlloc(uint32_t Request, DMA_InitTypeDef* DMA_InitStruct);
+void DMA_MgrFree(DMA_Stream_TypeDef* DMAy_Streamx);
+ErrorStatus DMA_MgrSubmit(DMA_Stream_TypeDef* DMAy_Streamx, DMA_MgrXferTypeDef* Xfer);
+void DMA_MgrAbort(DMA_Stream_TypeDef* DMAy_Streamx);
+void DMA_MgrIRQHandler(DMA_Stream_TypeDef* DMAy_Streamx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_dma_mem.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the DMA memory
+  *          copy and fill functions.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_DMA_MEM_H
+#define __STM32F4xx_DMA_MEM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_dma_xfer.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup DMA
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  DMA memory copy or fill request definition
+  */
+
+typedef struct DMA_MemRequest
+{
+  void (*Callback)(struct DMA_MemRequest* Request); /*!< Called when the request ends, or 0. */
+
+  void* Context;                   /*!< Free for the caller, not used by the driver. */
+
+  __IO uint32_t Status;            /*!< State of the request, updated by the driver.
+                                        This member is a value of @ref DMA_Mem_request_status */
+
+  uint32_t Dst;                    /*!< Reserved: destination of the remaining data. */
+
+  uint32_t Src;                    /*!< Reserved: source of the remaining data. */
+
+  uint32_t Length;                 /*!< Reserved: number of remaining bytes. */
+
+  uint32_t Pattern;                /*!< Reserved: fill value, repeated in the 4 bytes. */
+
+  uint32_t Type;                   /*!< Reserved: copy or fill. */
+
+  struct DMA_MemRequest* Next;     /*!< Reserved for the queue of the requests. */
+}DMA_MemRequestTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup DMA_Mem_request_status
+  * @{
+  */
+#define DMA_MEM_QUEUED                 ((uint32_t)0x00000001)  /*!< Waiting in the queue */
+#define DMA_MEM_ACTIVE                 ((uint32_t)0x00000002)  /*!< Copy or fill in progress */
+#define DMA_MEM_DONE                   ((uint32_t)0x00000003)  /*!< Copy or fill complete */
+#define DMA_MEM_ERROR                  ((uint32_t)0x00000004)  /*!< Transfer error: the destination
+                                                                    is partly written */
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Mem_Threshold
+  * @brief  Requests shorter than DMA_MEM_THRESHOLD bytes are run by the CPU when
+  *         no request is queued. It may be defined in stm32f4xx_conf.h, to at
+  *         least 16 bytes.
+  * @{
+  */
+#ifndef DMA_MEM_THRESHOLD
+ #define DMA_MEM_THRESHOLD             ((uint32_t)256)
+#endif
+/**
+  * @}
+  */
+
+/* The DMA cannot access the CCM data RAM */
+#define IS_DMA_MEM_ADDRESS(ADDRESS)    (((uint32_t)(ADDRESS) & 0xFFFF0000) != CCMDATARAM_BASE)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* DMA memory copy and fill functions *****************************************/
+ErrorStatus DMA_MemInit(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t Priority);
+ErrorStatus DMA_MemCopy(DMA_MemRequestTypeDef* Request, void* Dst, const void* Src, uint32_t Length);
+ErrorStatus DMA_MemSet(DMA_MemRequestTypeDef* Request, void* Dst, uint8_t Value, uint32_t Length);
+void DMA_MemIRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_DMA_MEM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_dma_xfer.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the DMA
+  *          transfer functions, common to the STM32F10x, STM32F2xx and
+  *          STM32F4xx families.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_DMA_XFER_H
+#define __STM32F4xx_DMA_XFER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup DMA
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  DMA transfer instance: a stream on STM32F2xx and STM32F4xx, a
+  *         channel on STM32F10x
+  */
+
+typedef DMA_Stream_TypeDef DMA_XferInstanceTypeDef;
+
+/**
+  * @brief  DMA transfer Init structure definition
+  */
+
+typedef struct
+{
+  uint32_t Request;              /*!< Channel of the peripheral request on the stream.
+                                      This parameter can be a value of @ref DMA_channel.
+                                      It is not used on STM32F10x. */
+
+  uint32_t PeriphAddress;        /*!< Address of the peripheral data register, or of the
+                                      source for a memory-to-memory copy. */
+
+  uint32_t Direction;            /*!< This parameter can be a value of @ref DMA_Xfer_Direction */
+
+  uint32_t PeriphDataSize;       /*!< This parameter can be a value of @ref DMA_peripheral_data_size */
+
+  uint32_t MemoryDataSize;       /*!< This parameter can be a value of @ref DMA_memory_data_size */
+
+  uint32_t PeriphInc;            /*!< This parameter can be a value of @ref DMA_peripheral_incremented_mode */
+
+  uint32_t MemoryInc;            /*!< This parameter can be a value of @ref DMA_memory_incremented_mode */
+
+  uint32_t Mode;                 /*!< DMA_Mode_Normal or DMA_Mode_Circular.
+                                      @note The circular mode cannot be used for a memory-to-memory copy. */
+
+  uint32_t Priority;             /*!< This parameter can be a value of @ref DMA_priority_level */
+}DMA_XferInitTypeDef;
+
+/**
+  * @brief  DMA transfer handle definition
+  */
+
+typedef struct DMA_XferHandle
+{
+  DMA_XferInstanceTypeDef* Instance;   /*!< Stream of the transfers, set by DMA_XferInit(). */
+
+  void (*HalfCallback)(struct DMA_XferHandle* Handle);     /*!< Called when the first half of the
+                                                                 buffer is transferred, or 0. */
+
+  void (*CompleteCallback)(struct DMA_XferHandle* Handle); /*!< Called when the buffer is transferred, or 0. */
+
+  void (*ErrorCallback)(struct DMA_XferHandle* Handle);    /*!< Called on a transfer error, or 0. */
+
+  void* Context;                       /*!< Free for the caller, not used by the driver. */
+
+  __IO uint32_t State;                 /*!< This member is a value of @ref DMA_Xfer_State */
+
+  uint32_t Mode;                       /*!< Reserved: mode of the transfers. */
+
+  uint32_t Flags;                      /*!< Reserved: interrupt flags of the stream. */
+}DMA_XferHandleTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup DMA_Xfer_Direction
+  * @{
+  */
+#define DMA_XFER_PERIPH_TO_MEMORY      DMA_DIR_PeripheralToMemory
+#define DMA_XFER_MEMORY_TO_PERIPH      DMA_DIR_MemoryToPeripheral
+#define DMA_XFER_MEMORY_TO_MEMORY      DMA_DIR_MemoryToMemory
+#define IS_DMA_XFER_DIRECTION(DIRECTION) (((DIRECTION) == DMA_XFER_PERIPH_TO_MEMORY) || \
+                                          ((DIRECTION) == DMA_XFER_MEMORY_TO_PERIPH) || \
+                                          ((DIRECTION) == DMA_XFER_MEMORY_TO_MEMORY))
+/**
+  * @}
+  */
+
+/** @defgroup DMA_Xfer_State
+  * @{
+  */
+#define DMA_XFER_STATE_RESET           ((uint32_t)0x00000000)  /*!< DMA_XferInit() not called */
+#define DMA_XFER_STATE_READY           ((uint32_t)0x00000001)  /*!< No transfer in progress */
+#define DMA_XFER_STATE_BUSY            ((uint32_t)0x00000002)  /*!< Transfer in progress */
+#define DMA_XFER_STATE_ERROR           ((uint32_t)0x00000003)  /*!< Last transfer stopped on an error */
+/**
+  * @}
+  */
+
+/* Memory-to-memory copies are possible on the DMA2 streams only */
+#define IS_DMA_XFER_M2M_INSTANCE(INSTANCE) ((uint32_t)(INSTANCE) >= DMA2_Stream0_BASE)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* DMA transfer functions *****************************************************/
+void DMA_XferStructInit(DMA_XferInitTypeDef* Init);
+ErrorStatus DMA_XferInit(DMA_XferHandleTypeDef* Handle, DMA_XferInstanceTypeDef* Instance,
+                         DMA_XferInitTypeDef* Init);
+ErrorStatus DMA_XferStart(DMA_XferHandleTypeDef* Handle, uint32_t MemoryAddress, uint16_t Count);
+ErrorStatus DMA_XferCopy(DMA_XferHandleTypeDef* Handle, uint32_t DstAddress, uint32_t SrcAddress,
+                         uint16_t Count);
+void DMA_XferStop(DMA_XferHandleTypeDef* Handle);
+uint16_t DMA_XferGetCount(DMA_XferHandleTypeDef* Handle);
+void DMA_XferIRQHandler(DMA_XferHandleTypeDef* Handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_DMA_XFER_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -330,6 +330,33 @@ typedef enum
   */ 
 
 /* Exported macro ------------------------------------------------------------*/
+
+/** @defgroup FLASH_Code_Placement
+  * @brief  __RAM_FUNC places a function in the ".RamFunc" section, to be run
+  *         from SRAM without FLASH wait states; __CCM_DATA places data in the
+  *         ".ccmram" section, in the CCM data RAM. The linker script maps the
+  *         sections, and the startup code copies ".RamFunc" to SRAM.
+  * @note   The CCM data RAM is not connected to the I-bus nor to the DMA:
+  *         it holds data and stacks, not code.
+  * @{
+  */
+#if defined ( __CC_ARM )
+ #define __RAM_FUNC        __attribute__((section("RamFunc")))
+ #define __CCM_DATA        __attribute__((section("ccmram"), zero_init))
+#elif defined ( __ICCARM__ )
+ #define __RAM_FUNC        __ramfunc
+ #define __CCM_DATA        _Pragma("location=\".ccmram\"")
+#elif defined ( __GNUC__ )
+ #define __RAM_FUNC        __attribute__((section(".RamFunc"), noinline, long_call))
+ #define __CCM_DATA        __attribute__((section(".ccmram")))
+#else
+ #define __RAM_FUNC
+ #define __CCM_DATA
+#endif
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/ 
  
 /* FLASH Interface configuration functions ************************************/
@@ -339,6 +366,9 @@ void FLASH_InstructionCacheCmd(FunctionalState NewState);
 void FLASH_DataCacheCmd(FunctionalState NewState);
 void FLASH_InstructionCacheReset(void);
 void FLASH_DataCacheReset(void);
+uint32_t FLASH_GetMinLatency(uint32_t HCLK_Frequency, uint8_t VoltageRange);
+void FLASH_AccessConfig(uint32_t HCLK_Frequency, uint8_t VoltageRange);
+void FLASH_AccessAutoConfig(uint8_t VoltageRange);
 
 /* FLASH Memory Programming functions *****************************************/   
 void FLASH_Unlock(void);
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_flash_bulk.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the FLASH
+  *          bulk programming and asynchronous erase functions.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_FLASH_BULK_H
+#define __STM32F4xx_FLASH_BULK_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_flash.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup FLASH
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Bulk programming and asynchronous erase functions **************************/
+FLASH_Status FLASH_ProgramBuffer(uint32_t Address, const uint8_t* Data, uint32_t Length,
+                                 uint8_t VoltageRange);
+FLASH_Status FLASH_EraseSectorAsync(uint32_t FLASH_Sector, uint8_t VoltageRange,
+                                    void (*Callback)(FLASH_Status Status));
+FLASH_Status FLASH_GetEraseAsyncStatus(void);
+void FLASH_AsyncIRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_FLASH_BULK_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,210 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_gpio_fast.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides inline GPIO access functions and bit-band
+  *          macros, for bit-banged protocols and parallel buses:
+  *           - Set, reset, write and toggle of pins through BSRR
+  *           - Write of a group of pins of a port in one access
+  *           - Bit-band aliases of the input and output data bits
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          These functions do not check their parameters: with constant
+  *          parameters, each one compiles to one or two load/store
+  *          instructions. Use stm32f4xx_gpio.c/.h to configure the pins.
+  *
+  *          1. GPIO_FastSetBits(), GPIO_FastResetBits(), GPIO_FastWriteBit()
+  *             and GPIO_FastToggleBits() drive pins. Only the given pins
+  *             change, even when an interrupt drives other pins of the port.
+  *
+  *          2. GPIO_FastWriteBus() drives a group of pins, for example the 8
+  *             or 16 data lines of an LCD, in one write to BSRR.
+  *             GPIO_FastWrite() writes the whole port.
+  *
+  *          3. GPIO_BB_ODR() and GPIO_BB_IDR() are the bit-band aliases of a
+  *             pin, given by its number: GPIO_BB_ODR(GPIOA, 5) = 1;
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_GPIO_FAST_H
+#define __STM32F4xx_GPIO_FAST_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_gpio.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup GPIO
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+
+/** @defgroup GPIO_Bit_Band
+  * @brief  Bit-band aliases of the bit PIN (0 to 15) of the output and input
+  *         data registers of GPIOx
+  * @{
+  */
+#define GPIO_BB_ODR(GPIOx, PIN)   (*(__IO uint32_t *)(PERIPH_BB_BASE + \
+                                     (((uint32_t)&(GPIOx)->ODR - PERIPH_BASE) * 32) + ((PIN) * 4)))
+#define GPIO_BB_IDR(GPIOx, PIN)   (*(__I uint32_t *)(PERIPH_BB_BASE + \
+                                     (((uint32_t)&(GPIOx)->IDR - PERIPH_BASE) * 32) + ((PIN) * 4)))
+/**
+  * @}
+  */
+
+/* 32-bit access to BSRRL and BSRRH: set bits 0 to 15, reset bits 16 to 31 */
+#define GPIO_FAST_BSRR(GPIOx)     (*(__IO uint32_t *)&(GPIOx)->BSRRL)
+
+/* Exported functions --------------------------------------------------------*/
+
+/* Inline GPIO access functions ***********************************************/
+
+/**
+  * @brief  Sets the selected data port bits.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  GPIO_Pin: specifies the port bits to be written.
+  * @retval None
+  */
+static __INLINE void GPIO_FastSetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+  GPIOx->BSRRL = GPIO_Pin;
+}
+
+/**
+  * @brief  Clears the selected data port bits.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  GPIO_Pin: specifies the port bits to be written.
+  * @retval None
+  */
+static __INLINE void GPIO_FastResetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+  GPIOx->BSRRH = GPIO_Pin;
+}
+
+/**
+  * @brief  Sets or clears the selected data port bits.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  GPIO_Pin: specifies the port bits to be written.
+  * @param  BitVal: Bit_RESET to clear the bits, Bit_SET to set them.
+  * @retval None
+  */
+static __INLINE void GPIO_FastWriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal)
+{
+  if (BitVal != Bit_RESET)
+  {
+    GPIOx->BSRRL = GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->BSRRH = GPIO_Pin;
+  }
+}
+
+/**
+  * @brief  Toggles the selected data port bits, without changing the others.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  GPIO_Pin: specifies the port bits to be toggled.
+  * @retval None
+  */
+static __INLINE void GPIO_FastToggleBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+  uint32_t odr = GPIOx->ODR;
+
+  GPIO_FAST_BSRR(GPIOx) = ((odr & GPIO_Pin) << 16) | (~odr & GPIO_Pin);
+}
+
+/**
+  * @brief  Writes a group of data port bits in one access.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  Mask: specifies the port bits to be written.
+  * @param  Data: the value of the bits of Mask. The other bits are ignored.
+  * @retval None
+  */
+static __INLINE void GPIO_FastWriteBus(GPIO_TypeDef* GPIOx, uint16_t Mask, uint16_t Data)
+{
+  GPIO_FAST_BSRR(GPIOx) = ((uint32_t)(~Data & Mask) << 16) | (uint32_t)(Data & Mask);
+}
+
+/**
+  * @brief  Writes data to the whole data port.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  PortVal: specifies the value to be written to the port output data register.
+  * @retval None
+  */
+static __INLINE void GPIO_FastWrite(GPIO_TypeDef* GPIOx, uint16_t PortVal)
+{
+  GPIOx->ODR = PortVal;
+}
+
+/**
+  * @brief  Reads the specified input port pin.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  GPIO_Pin: specifies the port bit to read.
+  * @retval The input port pin value: Bit_SET or Bit_RESET.
+  */
+static __INLINE uint8_t GPIO_FastReadInputDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+  return (uint8_t)((GPIOx->IDR & GPIO_Pin) != 0);
+}
+
+/**
+  * @brief  Reads the specified GPIO input data port.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @retval GPIO input data port value.
+  */
+static __INLINE uint16_t GPIO_FastReadInputData(GPIO_TypeDef* GPIOx)
+{
+  return (uint16_t)GPIOx->IDR;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_GPIO_FAST_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hash_stream.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the
+  *          incremental HASH and HMAC functions and the SHA256 functions.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_HASH_STREAM_H
+#define __STM32F4xx_HASH_STREAM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hash.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup HASH
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  HASH stream session definition: the state of a message being
+  *         hashed.
+  */
+
+typedef struct
+{
+  HASH_Context Context;            /*!< Reserved: registers of the session while another
+                                        session uses the HASH. */
+
+  uint32_t Digest[8];              /*!< Reserved: chaining value of a digest computed by software. */
+
+  uint32_t Buffer[16];             /*!< Reserved: bytes not yet written to the HASH. */
+
+  uint32_t BufferLength;           /*!< Reserved: number of bytes in Buffer. */
+
+  uint32_t Written;                /*!< Reserved: words of the message written to the HASH, or
+                                        blocks processed by software. */
+
+  uint32_t HASH_AlgoSelection;     /*!< Reserved: a value of @ref HASH_Stream_Algo_Selection. */
+
+  uint8_t* Key;                    /*!< Reserved: HMAC key, or 0. */
+
+  uint32_t Keylen;                 /*!< Reserved: length of the HMAC key. */
+
+  uint8_t State;                   /*!< Reserved: new, started or ended. */
+}HASH_StreamSessionTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup HASH_Stream_Algo_Selection
+  * @{
+  */
+#define HASH_AlgoSelection_SHA256  ((uint32_t)0x00040080) /*!< HASH function is SHA256, computed by software */
+
+#define IS_HASH_STREAM_ALGOSELECTION(ALGOSELECTION) (IS_HASH_ALGOSELECTION(ALGOSELECTION) || \
+                                                     ((ALGOSELECTION) == HASH_AlgoSelection_SHA256))
+/**
+  * @}
+  */
+
+/** @defgroup HASH_Stream_DMA_threshold
+  * @{
+  */
+#define HASH_STREAM_DMA_THRESHOLD       256  /*!< Smallest last part of a message given to the DMA */
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Incremental HASH functions *************************************************/
+void HASH_StreamInit(HASH_StreamSessionTypeDef* Session, uint32_t HASH_AlgoSelection,
+                     uint8_t* Key, uint32_t Keylen);
+void HASH_StreamDeInit(HASH_StreamSessionTypeDef* Session);
+ErrorStatus HASH_StreamUpdate(HASH_StreamSessionTypeDef* Session, uint8_t* Input, uint32_t Ilen);
+ErrorStatus HASH_StreamFinish(HASH_StreamSessionTypeDef* Session, uint8_t* Input, uint32_t Ilen,
+                              uint8_t* Output);
+
+/* SHA256 functions ***********************************************************/
+void HASH_SHA256Process(uint32_t State[8], const uint8_t* Input, uint32_t Blocks);
+ErrorStatus HASH_SHA256(uint8_t *Input, uint32_t Ilen, uint8_t Output[32]);
+ErrorStatus HMAC_SHA256(uint8_t *Key, uint32_t Keylen, uint8_t *Input,
+                        uint32_t Ilen, uint8_t Output[32]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_HASH_STREAM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
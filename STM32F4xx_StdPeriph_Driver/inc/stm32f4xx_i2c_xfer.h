@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_i2c_xfer.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the I2C
+  *          interrupt and DMA driven master engine.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_I2C_XFER_H
+#define __STM32F4xx_I2C_XFER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_i2c.h"
+#include "stm32f4xx_dma.h"
+#include "stm32f4xx_gpio.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup I2C
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  I2C transaction definition
+  */
+
+typedef struct I2C_Xfer
+{
+  uint8_t Address;                 /*!< Address of the slave, shifted as for I2C_Send7bitAddress():
+                                        the 7-bit address is in bits 7:1. */
+
+  uint8_t RegSize;                 /*!< Number of bytes of Reg sent first, from 0 to 2. */
+
+  uint16_t Reg;                    /*!< Register address in the slave, sent MSB first. */
+
+  const uint8_t* pWrData;          /*!< Bytes written after the register address. */
+
+  uint16_t WrLength;               /*!< Number of bytes of pWrData, or 0. */
+
+  uint16_t RdLength;               /*!< Number of bytes read after a repeated start, or 0. */
+
+  uint8_t* pRdData;                /*!< Receives the bytes read. */
+
+  uint32_t Timeout;                /*!< Timeout of the transaction in calls of I2C_XferTick(),
+                                        or 0 for no timeout. */
+
+  void (*Callback)(struct I2C_Xfer* Xfer); /*!< Called at the end of the transaction, or 0. */
+
+  void* Context;                   /*!< Free for the application. */
+
+  __IO uint32_t Status;            /*!< Status of the transaction.
+                                        This parameter is a value of @ref I2C_transaction_status */
+
+  struct I2C_Xfer* Next;           /*!< Reserved: next transaction of the queue. */
+}I2C_XferTypeDef;
+
+/**
+  * @brief  I2C master engine Init structure definition
+  */
+
+typedef struct
+{
+  I2C_TypeDef* I2Cx;               /*!< I2C1, I2C2 or I2C3. */
+
+  I2C_InitTypeDef I2C_InitStruct;  /*!< Configuration of the I2C, in I2C_Mode_I2C with 7-bit
+                                        addresses. */
+
+  GPIO_TypeDef* SCL_GPIOx;         /*!< GPIO port of SCL, used by the bus recovery, or 0. */
+
+  uint16_t SCL_Pin;                /*!< GPIO pin of SCL.
+                                        This parameter can be a value of @ref GPIO_pins_define */
+
+  GPIO_TypeDef* SDA_GPIOx;         /*!< GPIO port of SDA. */
+
+  uint16_t SDA_Pin;                /*!< GPIO pin of SDA.
+                                        This parameter can be a value of @ref GPIO_pins_define */
+}I2C_XferInitTypeDef;
+
+/**
+  * @brief  I2C master engine definition, one per I2C
+  */
+
+typedef struct
+{
+  I2C_XferInitTypeDef Init;        /*!< Reserved: configuration given to I2C_XferInit(). */
+
+  DMA_Stream_TypeDef* RxStream;    /*!< Reserved: DMA stream of the I2C RX request. */
+
+  DMA_Stream_TypeDef* TxStream;    /*!< Reserved: DMA stream of the I2C TX request. */
+
+  DMA_MgrXferTypeDef RxXfer;       /*!< Reserved: DMA transfer of the bytes read. */
+
+  DMA_MgrXferTypeDef TxXfer;       /*!< Reserved: DMA transfer of the bytes written. */
+
+  I2C_XferTypeDef* Active;         /*!< Reserved: transaction in progress. */
+
+  I2C_XferTypeDef* Head;           /*!< Reserved: first queued transaction. */
+
+  I2C_XferTypeDef* Tail;           /*!< Reserved: last queued transaction. */
+
+  __IO uint32_t State;             /*!< Reserved: step of the transaction in progress. */
+
+  uint32_t Index;                  /*!< Reserved: bytes of Reg sent. */
+
+  uint32_t Ticks;                  /*!< Reserved: remaining time of the transaction in progress. */
+
+  uint32_t Recoveries;             /*!< Number of bus recoveries since I2C_XferInit(). */
+}I2C_XferEngineTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup I2C_transaction_status
+  * @{
+  */
+#define I2C_XFER_DONE                   ((uint32_t)0x00000000)
+#define I2C_XFER_QUEUED                 ((uint32_t)0x00000001)
+#define I2C_XFER_ACTIVE                 ((uint32_t)0x00000002)
+#define I2C_XFER_NACK                   ((uint32_t)0x00000003)  /*!< The slave did not acknowledge */
+#define I2C_XFER_ERROR                  ((uint32_t)0x00000004)  /*!< Bus error, arbitration lost,
+                                                                     overrun or DMA error */
+#define I2C_XFER_TIMEOUT                ((uint32_t)0x00000005)
+#define I2C_XFER_ABORTED                ((uint32_t)0x00000006)
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* I2C master engine functions ************************************************/
+ErrorStatus I2C_XferInit(I2C_XferEngineTypeDef* Engine, const I2C_XferInitTypeDef* I2C_XferInitStruct);
+void I2C_XferDeInit(I2C_XferEngineTypeDef* Engine);
+ErrorStatus I2C_XferSubmit(I2C_XferEngineTypeDef* Engine, I2C_XferTypeDef* Xfer);
+void I2C_XferAbort(I2C_XferEngineTypeDef* Engine);
+FlagStatus I2C_XferBusy(I2C_XferEngineTypeDef* Engine);
+void I2C_XferTick(I2C_XferEngineTypeDef* Engine);
+void I2C_XferEvIRQHandler(I2C_XferEngineTypeDef* Engine);
+void I2C_XferErIRQHandler(I2C_XferEngineTypeDef* Engine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_I2C_XFER_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,130 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_i2s_stream.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the I2S full
+  *          duplex streaming layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_I2S_STREAM_H
+#define __STM32F4xx_I2S_STREAM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_spi.h"
+#include "stm32f4xx_dma.h"
+#include "stm32f4xx_rcc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup SPI
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct I2S_Stream;
+
+/**
+  * @brief  I2S stream Init structure definition
+  */
+
+typedef struct
+{
+  SPI_TypeDef* SPIx;               /*!< SPI2 or SPI3: its I2S extension runs the other direction. */
+
+  I2S_InitTypeDef I2S;             /*!< Configuration of SPIx in I2S mode. I2S_Mode gives the
+                                        direction of SPIx, the extension is the slave of the
+                                        other direction. */
+
+  uint16_t* TxBuffer;              /*!< Two blocks of output data, sent in a loop. */
+
+  uint16_t* RxBuffer;              /*!< Two blocks of input data, received in a loop. */
+
+  uint16_t BlockSize;              /*!< Number of 16-bit data of a block, even: a 24 or 32-bit
+                                        sample takes two 16-bit data. */
+
+  void (*Process)(struct I2S_Stream* Stream, const uint16_t* pIn, uint16_t* pOut, uint16_t Size);
+                                   /*!< Called from the DMA interrupt each time a block has been
+                                        received and the block of the same index sent: reads the
+                                        input block and writes the next output block. */
+}I2S_StreamInitTypeDef;
+
+/**
+  * @brief  I2S stream definition
+  */
+
+typedef struct I2S_Stream
+{
+  I2S_StreamInitTypeDef Init;      /*!< Reserved: configuration given to I2S_StreamInit(). */
+
+  SPI_TypeDef* I2Sxext;            /*!< Reserved: the I2S extension of SPIx. */
+
+  DMA_Stream_TypeDef* TxStream;    /*!< Reserved: DMA stream of the transmitter. */
+
+  DMA_Stream_TypeDef* RxStream;    /*!< Reserved: DMA stream of the receiver. */
+
+  DMA_MgrXferTypeDef TxXfer[2];    /*!< Reserved: the two output blocks. */
+
+  DMA_MgrXferTypeDef RxXfer[2];    /*!< Reserved: the two input blocks. */
+
+  __IO uint8_t Done[2];            /*!< Reserved: directions done for each block. */
+
+  uint32_t Overruns;               /*!< Blocks not processed in time: a DMA stream restarted on
+                                        an old block, or the I2S missed a data. */
+
+  void* Context;                   /*!< Free for the application. */
+}I2S_StreamTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* I2S streaming functions ****************************************************/
+ErrorStatus I2S_StreamClockConfig(uint32_t AudioFreq);
+ErrorStatus I2S_StreamInit(I2S_StreamTypeDef* Stream, const I2S_StreamInitTypeDef* I2S_StreamInitStruct);
+void I2S_StreamDeInit(I2S_StreamTypeDef* Stream);
+void I2S_StreamStart(I2S_StreamTypeDef* Stream);
+void I2S_StreamStop(I2S_StreamTypeDef* Stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_I2S_STREAM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
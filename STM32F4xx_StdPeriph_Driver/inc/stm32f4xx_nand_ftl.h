@@ -0,0 +1,231 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_nand_ftl.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the NAND
+  *          flash translation layer on the FSMC.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_NAND_FTL_H
+#define __STM32F4xx_NAND_FTL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_fsmc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup FSMC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  NAND FTL Init structure definition: the geometry of the 8-bit
+  *         large page NAND memory and the RAM given to the FTL
+  */
+
+typedef struct
+{
+  uint32_t Bank;                 /*!< FSMC_Bank2_NAND or FSMC_Bank3_NAND */
+
+  uint32_t PageSize;             /*!< Data bytes per page: 2048, 4096 or 8192 */
+
+  uint32_t SpareSize;            /*!< Spare bytes per page, at least NAND_FTL_SPARE_MIN(PageSize) */
+
+  uint32_t PagesPerBlock;        /*!< Pages per erase block, up to 256 */
+
+  uint32_t RowCycles;            /*!< Row address cycles of the memory: 2 or 3 */
+
+  uint32_t FirstBlock;           /*!< First block managed by the FTL: the blocks before
+                                      it are left to the application (boot code) */
+
+  uint32_t BlockCount;           /*!< Number of blocks managed by the FTL. BlockCount
+                                      * PagesPerBlock must not exceed 65535. */
+
+  uint32_t ReserveBlocks;        /*!< Blocks not counted in the capacity: they hold the
+                                      stale pages, and replace the blocks going bad.
+                                      At least 2, about 3% of BlockCount is usual. */
+
+  uint16_t* Map;                 /*!< Logical to physical page map: NAND_FTL_PAGES(BlockCount,
+                                      ReserveBlocks, PagesPerBlock) entries */
+
+  struct NAND_FTL_Block* Blocks; /*!< Block table: BlockCount entries */
+
+  uint8_t* PageBuffer;           /*!< Write cache: PageSize bytes, word aligned */
+
+  uint8_t* CopyBuffer;           /*!< Garbage collection buffer: PageSize bytes, word aligned */
+}NAND_FTL_InitTypeDef;
+
+/**
+  * @brief  NAND FTL block table entry
+  */
+
+typedef struct NAND_FTL_Block
+{
+  uint16_t EraseCount;           /*!< Erase cycles of the block */
+
+  uint16_t Valid;                /*!< Pages holding the current copy of a logical page */
+
+  uint16_t Used;                 /*!< Programmed pages */
+
+  uint8_t  State;                /*!< Reserved: state of the block */
+
+  uint8_t  Retire;               /*!< Reserved: the block is marked bad once collected */
+}NAND_FTL_BlockTypeDef;
+
+/**
+  * @brief  NAND FTL statistics
+  */
+
+typedef struct
+{
+  uint32_t Corrected;            /*!< Single bit errors corrected by the ECC */
+
+  uint32_t Uncorrectable;        /*!< Reads with an uncorrectable error */
+
+  uint32_t BadBlocks;            /*!< Factory and grown bad blocks */
+
+  uint32_t Collections;          /*!< Blocks reclaimed by the garbage collection */
+
+  uint32_t Copies;               /*!< Pages moved by the garbage collection */
+
+  uint32_t FreeBlocks;           /*!< Erased or erasable blocks */
+
+  uint32_t MinErase;             /*!< Lowest erase count of the good blocks */
+
+  uint32_t MaxErase;             /*!< Highest erase count of the good blocks */
+}NAND_FTL_StatTypeDef;
+
+/**
+  * @brief  NAND FTL instance
+  */
+
+typedef struct
+{
+  NAND_FTL_InitTypeDef Init;     /*!< Geometry and RAM, copied by NAND_FTL_Init() */
+
+  uint32_t Base;                 /*!< Reserved: address of the NAND bank */
+
+  uint32_t Pages;                /*!< Logical pages */
+
+  uint32_t Mounted;              /*!< 1 after a successful NAND_FTL_Mount() or NAND_FTL_Format() */
+
+  uint32_t Sequence;             /*!< Reserved: sequence number of the next programmed page */
+
+  uint32_t Active;               /*!< Reserved: block being programmed */
+
+  uint32_t CachePage;            /*!< Reserved: logical page held by the write cache */
+
+  uint32_t CacheDirty;           /*!< Reserved: the write cache differs from the memory */
+
+  NAND_FTL_StatTypeDef Stat;     /*!< Statistics */
+}NAND_FTL_TypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup NAND_FTL_Constants
+  * @{
+  */
+#define NAND_FTL_SECTOR_SIZE           ((uint32_t)512)         /*!< Block device sector, also the ECC step */
+#define NAND_FTL_NO_PAGE               ((uint16_t)0xFFFF)      /*!< Unmapped logical page */
+#define NAND_FTL_ECC_OFFSET            ((uint32_t)16)          /*!< ECC bytes in the spare area */
+
+/* Offsets of the command and address latches in the bank (A16 = CLE, A17 = ALE) */
+#ifndef NAND_FTL_CMD_AREA
+ #define NAND_FTL_CMD_AREA             ((uint32_t)0x00010000)
+#endif
+#ifndef NAND_FTL_ADDR_AREA
+ #define NAND_FTL_ADDR_AREA            ((uint32_t)0x00020000)
+#endif
+
+/* Garbage collection: NAND_FTL_Idle() collects a block below NAND_FTL_GC_SOFT
+   free blocks, the writes collect blocks below NAND_FTL_GC_HARD free blocks */
+#ifndef NAND_FTL_GC_SOFT
+ #define NAND_FTL_GC_SOFT              ((uint32_t)4)
+#endif
+#ifndef NAND_FTL_GC_HARD
+ #define NAND_FTL_GC_HARD              ((uint32_t)2)
+#endif
+
+/* Static wear levelling: NAND_FTL_Idle() moves the data of the least erased
+   block when the erase counts differ by more than NAND_FTL_WEAR_DELTA */
+#ifndef NAND_FTL_WEAR_DELTA
+ #define NAND_FTL_WEAR_DELTA           ((uint32_t)256)
+#endif
+
+#define IS_NAND_FTL_PAGE_SIZE(SIZE)    (((SIZE) == 2048) || ((SIZE) == 4096) || ((SIZE) == 8192))
+#define IS_NAND_FTL_ROW_CYCLES(CYCLES) (((CYCLES) == 2) || ((CYCLES) == 3))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+
+/* Smallest spare area: metadata and 3 ECC bytes per 512-byte step */
+#define NAND_FTL_SPARE_MIN(PAGESIZE)   (NAND_FTL_ECC_OFFSET + (3 * ((PAGESIZE) / NAND_FTL_SECTOR_SIZE)))
+
+/* Logical pages of a geometry: entries of the Map array */
+#define NAND_FTL_PAGES(BLOCKS, RESERVE, PPB)  (((BLOCKS) - (RESERVE)) * (PPB))
+
+/* Exported functions --------------------------------------------------------*/
+
+/* Initialization and mount functions *****************************************/
+void NAND_FTL_StructInit(NAND_FTL_InitTypeDef* Init);
+ErrorStatus NAND_FTL_Init(NAND_FTL_TypeDef* Ftl, const NAND_FTL_InitTypeDef* Init);
+ErrorStatus NAND_FTL_Mount(NAND_FTL_TypeDef* Ftl);
+ErrorStatus NAND_FTL_Format(NAND_FTL_TypeDef* Ftl);
+
+/* Block device functions *****************************************************/
+ErrorStatus NAND_FTL_Read(NAND_FTL_TypeDef* Ftl, uint8_t* Buffer, uint32_t Sector, uint32_t Count);
+ErrorStatus NAND_FTL_Write(NAND_FTL_TypeDef* Ftl, const uint8_t* Buffer, uint32_t Sector, uint32_t Count);
+ErrorStatus NAND_FTL_Flush(NAND_FTL_TypeDef* Ftl);
+uint32_t NAND_FTL_GetSectorCount(NAND_FTL_TypeDef* Ftl);
+uint32_t NAND_FTL_GetEraseSectors(NAND_FTL_TypeDef* Ftl);
+
+/* Maintenance functions ******************************************************/
+ErrorStatus NAND_FTL_Idle(NAND_FTL_TypeDef* Ftl);
+void NAND_FTL_GetStat(NAND_FTL_TypeDef* Ftl, NAND_FTL_StatTypeDef* Stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_NAND_FTL_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_pwr_bkplog.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the log in
+  *          the backup SRAM.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_PWR_BKPLOG_H
+#define __STM32F4xx_PWR_BKPLOG_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_pwr.h"
+#include "stm32f4xx_rcc.h"
+#include "stm32f4xx_crc.h"
+#include "stm32f4xx_flash_kv.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup PWR
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Header of the log in the backup SRAM, followed by the ring
+  */
+
+typedef struct
+{
+  __IO uint32_t Magic;           /*!< Reserved: PWR_BKPLOG_MAGIC once the log is formatted. */
+
+  __IO uint32_t Size;            /*!< Reserved: size of the ring in bytes. */
+
+  __IO uint32_t Head;            /*!< Reserved: free running byte offset of the end of the last record. */
+
+  __IO uint32_t Tail;            /*!< Reserved: free running byte offset of the oldest record. */
+}PWR_BkpLogHeaderTypeDef;
+
+/**
+  * @brief  Backup SRAM log definition
+  */
+
+typedef struct
+{
+  PWR_BkpLogHeaderTypeDef* Header; /*!< Reserved: the header in the backup SRAM. */
+
+  __IO uint32_t* Ring;           /*!< Reserved: the ring in the backup SRAM. */
+
+  uint32_t Mask;                 /*!< Reserved: number of words of the ring minus 1. */
+
+  uint32_t Dropped;              /*!< Oldest records dropped to make room since the initialization. */
+
+  uint32_t Corrupted;            /*!< 1 when the initialization cut the log at a corrupted record. */
+}PWR_BkpLogTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup PWR_BkpLog_Constants
+  * @{
+  */
+#ifndef PWR_BKPLOG_MAX_LENGTH
+ #define PWR_BKPLOG_MAX_LENGTH     256              /*!< Maximum length of a record in bytes */
+#endif
+
+#define PWR_BKPLOG_HEADER_SIZE     ((uint32_t)sizeof(PWR_BkpLogHeaderTypeDef))
+#define PWR_BKPLOG_SRAM_SIZE       ((uint32_t)0x1000)  /*!< 4 Kbytes of backup SRAM */
+
+#define IS_PWR_BKPLOG_SIZE(SIZE)   (((SIZE) >= 64) && (((SIZE) & ((SIZE) - 1)) == 0))
+#define IS_PWR_BKPLOG_AREA(ADDRESS, SIZE) (((ADDRESS) >= BKPSRAM_BASE) && (((ADDRESS) & 3) == 0) && \
+                                           ((ADDRESS) + PWR_BKPLOG_HEADER_SIZE + (SIZE) <= \
+                                            BKPSRAM_BASE + PWR_BKPLOG_SRAM_SIZE))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Backup SRAM log functions **************************************************/
+ErrorStatus PWR_BkpLogInit(PWR_BkpLogTypeDef* Log, uint32_t Address, uint32_t Size);
+ErrorStatus PWR_BkpLogAppend(PWR_BkpLogTypeDef* Log, const uint8_t* Data, uint16_t Length);
+ErrorStatus PWR_BkpLogRead(PWR_BkpLogTypeDef* Log, uint8_t* Data, uint16_t* Length);
+uint32_t PWR_BkpLogDrain(PWR_BkpLogTypeDef* Log, FLASH_KVTypeDef* KV, uint32_t MaxRecords);
+void PWR_BkpLogClear(PWR_BkpLogTypeDef* Log);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_PWR_BKPLOG_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
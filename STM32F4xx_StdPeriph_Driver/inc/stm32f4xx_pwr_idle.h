@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_pwr_idle.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the low power
+  *          idle manager.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_PWR_IDLE_H
+#define __STM32F4xx_PWR_IDLE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_pwr.h"
+#include "stm32f4xx_rcc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup PWR
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Free running counter which keeps counting in STOP mode (RTC
+  *         sub-seconds, timer clocked by the LSE...), used for the residency.
+  */
+
+typedef uint32_t (*PWR_IdleTimeBase)(void);
+
+/**
+  * @brief  Idle statistics, indexed by @ref PWR_Idle_Modes
+  */
+
+typedef struct
+{
+  uint32_t Count[4];             /*!< Number of entries in each mode. */
+
+  uint32_t Residency[4];         /*!< Time spent in each mode, in ticks of the time base. */
+
+  uint32_t BusyDenied;           /*!< Entries in which the latency allowed STOP but a client was busy. */
+
+  uint32_t LatencyDenied;        /*!< Entries in which no client was busy but a latency forbade STOP. */
+
+  uint32_t RestoreFail;          /*!< Wake-ups from STOP where the HSE or a PLL did not start again. */
+}PWR_IdleStatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup PWR_Idle_Modes
+  * @{
+  */
+#define PWR_IdleMode_Sleep         ((uint8_t)0x00)  /*!< SLEEP mode, back to the caller after the interrupt */
+#define PWR_IdleMode_SleepOnExit   ((uint8_t)0x01)  /*!< SLEEP mode until an interrupt calls PWR_IdleResume() */
+#define PWR_IdleMode_Stop          ((uint8_t)0x02)  /*!< STOP mode with the main regulator ON */
+#define PWR_IdleMode_StopLowPower  ((uint8_t)0x03)  /*!< STOP mode with the low power regulator and FLASH power down */
+/**
+  * @}
+  */
+
+/** @defgroup PWR_Idle_Constants
+  * @{
+  */
+#ifndef PWR_IDLE_MAX_CLIENTS
+ #define PWR_IDLE_MAX_CLIENTS      8                /*!< Clients of PWR_IdleRegister(), at most 32 */
+#endif
+
+#define PWR_IDLE_NO_LATENCY        ((uint32_t)0xFFFFFFFF) /*!< The client accepts any wake-up latency */
+
+/* Wake-up latencies in us, including the restart of the HSE and the PLL */
+#ifndef PWR_IDLE_RESTORE_LATENCY
+ #define PWR_IDLE_RESTORE_LATENCY  2000             /*!< HSE startup and PLL lock */
+#endif
+#ifndef PWR_IDLE_STOP_LATENCY
+ #define PWR_IDLE_STOP_LATENCY     (20 + PWR_IDLE_RESTORE_LATENCY)
+#endif
+#ifndef PWR_IDLE_STOPLP_LATENCY
+ #define PWR_IDLE_STOPLP_LATENCY   (130 + PWR_IDLE_RESTORE_LATENCY)
+#endif
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Low power idle manager functions *******************************************/
+void PWR_IdleInit(PWR_IdleTimeBase TimeBase);
+ErrorStatus PWR_IdleRegister(uint32_t MaxLatency, uint8_t* Id);
+void PWR_IdleSetLatency(uint8_t Id, uint32_t MaxLatency);
+void PWR_IdleBusy(uint8_t Id, FunctionalState NewState);
+void PWR_IdleSleepOnExitCmd(FunctionalState NewState);
+uint8_t PWR_IdleEnter(void);
+void PWR_IdleResume(void);
+void PWR_IdleGetStats(PWR_IdleStatsTypeDef* Stats);
+void PWR_IdleResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_PWR_IDLE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
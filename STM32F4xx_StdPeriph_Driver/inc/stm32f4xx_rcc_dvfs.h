@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_rcc_dvfs.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the dynamic
+  *          voltage and frequency scaling functions.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_RCC_DVFS_H
+#define __STM32F4xx_RCC_DVFS_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_rcc.h"
+#include "stm32f4xx_pwr.h"
+#include "stm32f4xx_flash.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup RCC
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Operating point definition: the PLL is fed by the HSE
+  */
+
+typedef struct
+{
+  uint32_t HCLK_Frequency;       /*!< HCLK frequency of the operating point in Hz. */
+
+  uint32_t PLLM;                 /*!< Division factor of the PLL input clock, between 2 and 63. */
+
+  uint32_t PLLN;                 /*!< Multiplication factor of the PLL VCO, between 192 and 432. */
+
+  uint32_t PLLP;                 /*!< Division factor of the main system clock: 2, 4, 6 or 8. */
+
+  uint32_t PLLQ;                 /*!< Division factor of the 48 MHz clock, between 4 and 15. */
+
+  uint32_t AHBPrescaler;         /*!< The AHB clock divider: a value of @ref RCC_AHB_Clock_Source. */
+
+  uint32_t APB1Prescaler;        /*!< The APB1 clock divider: a value of @ref RCC_APB1_APB2_Clock_Source. */
+
+  uint32_t APB2Prescaler;        /*!< The APB2 clock divider: a value of @ref RCC_APB1_APB2_Clock_Source. */
+
+  uint32_t RegulatorVoltage;     /*!< The regulator voltage scale: a value of @ref PWR_Regulator_Voltage_Scale. */
+}RCC_OperatingPointTypeDef;
+
+/**
+  * @brief  Function called after a change of operating point, with the new
+  *         clock frequencies, to set the baud rates and prescalers.
+  */
+
+typedef void (*RCC_DVFSCallback)(const RCC_ClocksTypeDef* Clocks);
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup RCC_DVFS_Constants
+  * @{
+  */
+#define RCC_DVFS_PLLM              (HSE_VALUE / 1000000)  /*!< 1 MHz at the PLL input */
+#define RCC_DVFS_MAX_CALLBACKS     8                      /*!< Callbacks of RCC_DVFSRegisterCallback() */
+#define RCC_DVFS_TARGET_LOAD       80                     /*!< Load in % aimed at by RCC_DVFSUpdateLoad() */
+#define RCC_DVFS_DOWN_DELAY        4                      /*!< Low load reports before scaling down */
+/**
+  * @}
+  */
+
+/** @defgroup RCC_DVFS_Operating_Points
+  * @brief  168 MHz and 84 MHz share the PLL: the switch between them does not
+  *         wait for the PLL. The 48 MHz clock of USB, SDIO and RNG is kept.
+  * @{
+  */
+extern const RCC_OperatingPointTypeDef RCC_OperatingPoint_168MHz;
+extern const RCC_OperatingPointTypeDef RCC_OperatingPoint_120MHz;
+extern const RCC_OperatingPointTypeDef RCC_OperatingPoint_84MHz;
+extern const RCC_OperatingPointTypeDef RCC_OperatingPoint_48MHz;
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Dynamic voltage and frequency scaling functions ****************************/
+void RCC_DVFSInit(const RCC_OperatingPointTypeDef* const* Points, uint32_t NbPoints, uint8_t VoltageRange);
+ErrorStatus RCC_DVFSRegisterCallback(RCC_DVFSCallback Callback);
+ErrorStatus RCC_DVFSSetOperatingPoint(const RCC_OperatingPointTypeDef* Point);
+const RCC_OperatingPointTypeDef* RCC_DVFSGetOperatingPoint(void);
+ErrorStatus RCC_DVFSUpdateLoad(uint8_t Load);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_RCC_DVFS_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
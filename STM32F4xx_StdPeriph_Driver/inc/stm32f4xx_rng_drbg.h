@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_rng_drbg.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the AES
+  *          CTR_DRBG seeded by the RNG entropy pool.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_RNG_DRBG_H
+#define __STM32F4xx_RNG_DRBG_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_rng_pool.h"
+#include "stm32f4xx_cryp_stream.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup RNG
+  * @{
+  */
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup RNG_DRBG_limits
+  * @{
+  */
+#define RNG_DRBG_MAX_REQUEST        ((uint32_t)65536)    /*!< Bytes of a generate request, 2^19 bits */
+#define RNG_DRBG_RESEED_INTERVAL    ((uint32_t)0x10000)  /*!< Requests between two reseeds from the pool */
+
+#define IS_RNG_DRBG_KEYSIZE(KEYSIZE) (((KEYSIZE) == 128) || ((KEYSIZE) == 256))
+/**
+  * @}
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  CTR_DRBG definition
+  */
+
+typedef struct
+{
+  CRYP_StreamTypeDef* Stream;      /*!< Reserved: the streaming engine. */
+
+  CRYP_StreamSessionTypeDef Session; /*!< Reserved: AES-CTR session of the key. */
+
+  CRYP_StreamJobTypeDef Job;       /*!< Reserved: DMA job of the session. */
+
+  uint32_t Key[8];                 /*!< Reserved: the key K. */
+
+  uint32_t V[4];                   /*!< Reserved: the counter block V. */
+
+  uint32_t Buffer[20];             /*!< Reserved: 64 bytes aligned on 16 bytes for the DMA. */
+
+  uint32_t ReseedCounter;          /*!< Reserved: requests since the last reseed. */
+
+  uint16_t KeySize;                /*!< Reserved: 128 or 256. */
+}RNG_DRBGTypeDef;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* CTR_DRBG functions *********************************************************/
+ErrorStatus RNG_DRBGInit(RNG_DRBGTypeDef* DRBG, CRYP_StreamTypeDef* Stream, uint16_t KeySize,
+                         const uint8_t* Personalization, uint32_t Length);
+ErrorStatus RNG_DRBGReseed(RNG_DRBGTypeDef* DRBG, const uint8_t* AdditionalInput, uint32_t Length);
+ErrorStatus RNG_DRBGGenerate(RNG_DRBGTypeDef* DRBG, uint8_t* Output, uint32_t Length);
+void RNG_DRBGDeInit(RNG_DRBGTypeDef* DRBG);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_RNG_DRBG_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_rng_pool.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the RNG
+  *          entropy pool.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_RNG_POOL_H
+#define __STM32F4xx_RNG_POOL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_rng.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup RNG
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup RNG_Pool_errors
+  * @{
+  */
+#define RNG_POOL_ERROR_SEED         ((uint8_t)0x00) /*!< Seed errors: the RNG was restarted */
+#define RNG_POOL_ERROR_CLOCK        ((uint8_t)0x01) /*!< Clock errors */
+#define RNG_POOL_ERROR_REPEAT       ((uint8_t)0x02) /*!< Words equal to the previous word, not used */
+
+#define IS_RNG_POOL_ERROR(ERROR) (((ERROR) == RNG_POOL_ERROR_SEED) || \
+                                  ((ERROR) == RNG_POOL_ERROR_CLOCK) || \
+                                  ((ERROR) == RNG_POOL_ERROR_REPEAT))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Entropy pool functions *****************************************************/
+void RNG_PoolInit(uint32_t* Buffer, uint32_t Size);
+void RNG_PoolDeInit(void);
+uint32_t RNG_Read(uint8_t* Buffer, uint32_t Length);
+uint32_t RNG_PoolAvailable(void);
+uint32_t RNG_PoolGetErrors(uint8_t RNG_POOL_ERROR);
+void RNG_PoolIRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_RNG_POOL_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -775,6 +775,13 @@ typedef struct
   */ 
 
 /* Exported macro ------------------------------------------------------------*/
+
+/* Fields of an epoch time of RTC_GetEpoch(): seconds since 1970-01-01 00:00:00
+   in the high word, binary fraction of the second in the low word */
+#define RTC_EPOCH_SECONDS(EPOCH)       ((uint32_t)((EPOCH) >> 32))
+#define RTC_EPOCH_FRACTION(EPOCH)      ((uint32_t)(EPOCH))
+#define RTC_EPOCH_MICROSECONDS(EPOCH)  ((uint32_t)(((uint64_t)(uint32_t)(EPOCH) * 1000000) >> 32))
+
 /* Exported functions --------------------------------------------------------*/ 
 
 /*  Function used to set the RTC configuration to the default reset state *****/
@@ -864,6 +871,11 @@ void RTC_ClearFlag(uint32_t RTC_FLAG);
 ITStatus RTC_GetITStatus(uint32_t RTC_IT);
 void RTC_ClearITPendingBit(uint32_t RTC_IT);
 
+/* Epoch time functions *******************************************************/
+ErrorStatus RTC_EpochInit(uint32_t HCLK_Frequency);
+uint64_t RTC_GetEpoch(void);
+uint64_t RTC_GetEpochFine(void);
+
 #ifdef __cplusplus
 }
 #endif
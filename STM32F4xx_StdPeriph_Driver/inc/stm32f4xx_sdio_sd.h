@@ -0,0 +1,158 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_sdio_sd.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the SD/MMC
+  *          card block driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_SDIO_SD_H
+#define __STM32F4xx_SDIO_SD_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_sdio.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup SDIO
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  SD driver status
+  */
+
+typedef enum
+{
+  SD_OK = 0,
+  SD_CMD_CRC_FAIL,         /*!< Command response received, CRC check failed */
+  SD_CMD_RSP_TIMEOUT,      /*!< Command response timeout */
+  SD_DATA_CRC_FAIL,        /*!< Data block sent/received, CRC check failed */
+  SD_DATA_TIMEOUT,         /*!< Data timeout */
+  SD_TX_UNDERRUN,          /*!< Transmit FIFO underrun */
+  SD_RX_OVERRUN,           /*!< Receive FIFO overrun */
+  SD_START_BIT_ERR,        /*!< Start bit not detected on all data signals */
+  SD_CARD_ERROR,           /*!< Error bits set in the card status */
+  SD_UNSUPPORTED_CARD,     /*!< The card did not answer the identification */
+  SD_INVALID_PARAMETER,    /*!< Invalid block count or buffer alignment */
+  SD_DMA_ERROR,            /*!< No DMA stream or DMA transfer error */
+  SD_BUSY,                 /*!< A transfer is in progress */
+  SD_TIMEOUT               /*!< The card stayed busy */
+}SD_Error;
+
+/**
+  * @brief  SD card information
+  */
+
+typedef struct
+{
+  uint32_t CardType;       /*!< Type of the card.
+                                This member is a value of @ref SD_card_types */
+
+  uint32_t RCA;            /*!< Relative card address, in the 16 upper bits. */
+
+  uint32_t BlockCount;     /*!< Capacity of the card in 512-byte blocks. */
+
+  uint32_t CID[4];         /*!< Card identification register, bits 127:96 first. */
+
+  uint32_t CSD[4];         /*!< Card specific data register, bits 127:96 first. */
+
+  uint8_t BusWide;         /*!< 4 if the 4-bit bus is used, otherwise 1. */
+
+  uint8_t HighSpeed;       /*!< 1 if the card runs in high speed mode. */
+}SD_CardInfoTypeDef;
+
+/**
+  * @brief  SD transfer completion callback, called from the interrupt handlers
+  */
+
+typedef void (*SD_CallbackTypeDef)(SD_Error Status, void* Context);
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup SD_card_types
+  * @{
+  */
+#define SD_CARD_SDSC_V1                   ((uint32_t)0x00000000)
+#define SD_CARD_SDSC_V2                   ((uint32_t)0x00000001)
+#define SD_CARD_SDHC                      ((uint32_t)0x00000002)
+#define SD_CARD_MMC                       ((uint32_t)0x00000003)
+#define SD_CARD_MMC_HC                    ((uint32_t)0x00000004)
+/**
+  * @}
+  */
+
+/** @defgroup SD_block_size
+  * @{
+  */
+#define SD_BLOCK_SIZE                     ((uint32_t)512)
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Initialization and Configuration functions *********************************/
+SD_Error SD_Init(void);
+void SD_DeInit(void);
+void SD_GetCardInfo(SD_CardInfoTypeDef* CardInfo);
+
+/* Block transfer functions ***************************************************/
+SD_Error SD_ReadBlocks(uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks);
+SD_Error SD_WriteBlocks(const uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks);
+SD_Error SD_ReadBlocksAsync(uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks,
+                            SD_CallbackTypeDef Callback, void* Context);
+SD_Error SD_WriteBlocksAsync(const uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks,
+                             SD_CallbackTypeDef Callback, void* Context);
+SD_Error SD_GetTransferStatus(void);
+SD_Error SD_WaitReady(void);
+
+/* Interrupt management functions *********************************************/
+void SD_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_SDIO_SD_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
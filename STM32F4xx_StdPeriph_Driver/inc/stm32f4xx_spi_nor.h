@@ -0,0 +1,250 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_spi_nor.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the SPI NOR
+  *          flash driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_SPI_NOR_H
+#define __STM32F4xx_SPI_NOR_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_spi_xfer.h"
+#include "stm32f4xx_tim_wheel.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup SPI
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct SPI_NOR;
+
+/**
+  * @brief  SPI NOR Init structure definition
+  */
+
+typedef struct
+{
+  SPI_XferEngineTypeDef* Engine;   /*!< SPI transaction engine of the SPI of the memory. */
+
+  GPIO_TypeDef* CS_GPIOx;          /*!< GPIO port of the chip select of the memory. */
+
+  uint16_t CS_Pin;                 /*!< GPIO pin of the chip select of the memory.
+                                        This parameter can be a value of @ref GPIO_pins_define */
+
+  uint16_t SPI_BaudRatePrescaler;  /*!< SPI clock of all the commands, Fast Read included.
+                                        This parameter can be a value of @ref SPI_BaudRate_Prescaler */
+
+  uint32_t BlockBase;              /*!< Address of the block device in the memory, a multiple of
+                                        SPI_NOR_ERASE_SIZE: the bytes before it are left to the
+                                        application (firmware images, logs). */
+
+  uint32_t BlockSize;              /*!< Bytes of the block device, a multiple of SPI_NOR_ERASE_SIZE,
+                                        or 0 without block device. BlockBase + BlockSize must not
+                                        exceed 16 MB (3-byte addresses). */
+
+  uint8_t SuspendCmd;              /*!< Erase suspend command: 0x75 (Winbond, GigaDevice, Micron),
+                                        0xB0 (Macronix), or 0 if the memory has none. */
+
+  uint8_t ResumeCmd;               /*!< Erase resume command: 0x7A (Winbond, GigaDevice, Micron)
+                                        or 0x30 (Macronix). */
+
+  uint32_t ProgramPoll;            /*!< Microseconds between two reads of the status register while
+                                        a page is programmed, about the typical page program time. */
+
+  uint32_t ErasePoll;              /*!< Microseconds between two reads of the status register while
+                                        a sector is erased: the longest wait of a read for the erase
+                                        suspend, and the shortest time the erase runs between two
+                                        suspends. */
+
+  uint8_t* SectorBuffer;           /*!< Read-modify-write cache of the block device:
+                                        SPI_NOR_ERASE_SIZE bytes, or 0 without block device. */
+}SPI_NOR_InitTypeDef;
+
+/**
+  * @brief  SPI NOR statistics
+  */
+
+typedef struct
+{
+  uint32_t Pages;                  /*!< Pages programmed */
+  uint32_t Erases;                 /*!< Sectors and blocks erased */
+  uint32_t Polls;                  /*!< Reads of the status register */
+  uint32_t Suspends;               /*!< Erases suspended for a read */
+  uint32_t Waits;                  /*!< Reads that waited for the end of a page or of an erase */
+  uint32_t Errors;                 /*!< SPI transaction errors */
+}SPI_NOR_StatTypeDef;
+
+/**
+  * @brief  SPI NOR instance
+  */
+
+typedef struct SPI_NOR
+{
+  SPI_NOR_InitTypeDef Init;        /*!< Configuration, copied by SPI_NOR_Init(). */
+
+  uint32_t JedecId;                /*!< Manufacturer and device identification read by
+                                        SPI_NOR_Init(). */
+
+  void (*Callback)(struct SPI_NOR* Nor, ErrorStatus Status);
+                                   /*!< Reserved: end of the background operation. */
+
+  __IO uint32_t State;             /*!< Reserved: background operation. */
+
+  __IO uint32_t Hold;              /*!< Reserved: a read waits for the background operation to
+                                        stop between two pages or to suspend the erase. */
+
+  __IO uint32_t Parked;            /*!< Reserved: the background operation is stopped for a read. */
+
+  __IO uint32_t Suspended;         /*!< Reserved: the erase is suspended. */
+
+  __IO uint32_t Failed;            /*!< Reserved: the last background operation failed. */
+
+  uint32_t Address;                /*!< Reserved: next address of the background operation. */
+
+  uint32_t Remaining;              /*!< Reserved: bytes left to the background operation. */
+
+  uint32_t Step;                   /*!< Reserved: bytes of the page or sector in progress. */
+
+  const uint8_t* pData;            /*!< Reserved: next data to program. */
+
+  uint32_t CacheSector;            /*!< Reserved: erase sector held by SectorBuffer. */
+
+  uint32_t CacheDirty;             /*!< Reserved: SectorBuffer differs from the memory. */
+
+  SPI_JobTypeDef BgWren;           /*!< Reserved: write enable of the background operation. */
+
+  SPI_JobTypeDef BgCmd;            /*!< Reserved: command and address of the background operation. */
+
+  SPI_JobTypeDef BgData;           /*!< Reserved: data of the page being programmed. */
+
+  SPI_JobTypeDef BgStatus;         /*!< Reserved: read of the status register. */
+
+  SPI_JobTypeDef FgCmd;            /*!< Reserved: command of a read. */
+
+  SPI_JobTypeDef FgData;           /*!< Reserved: data of a read. */
+
+  TIM_TimerTypeDef Timer;          /*!< Reserved: polling of the status register. */
+
+  uint8_t BgCmdBuf[4];             /*!< Reserved: command and address bytes. */
+
+  uint8_t FgCmdBuf[8];             /*!< Reserved: command and address bytes. */
+
+  uint8_t StatusBuf[2];            /*!< Reserved: received status register. */
+
+  SPI_NOR_StatTypeDef Stat;        /*!< Statistics */
+}SPI_NOR_TypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup SPI_NOR_Constants
+  * @{
+  */
+#define SPI_NOR_PAGE_SIZE              ((uint32_t)256)     /*!< Program page */
+#define SPI_NOR_ERASE_SIZE             ((uint32_t)4096)    /*!< Smallest erase sector */
+#define SPI_NOR_BLOCK_SIZE             ((uint32_t)65536)   /*!< Erase block */
+#define SPI_NOR_SECTOR_SIZE            ((uint32_t)512)     /*!< Block device sector */
+#define SPI_NOR_MAX_SIZE               ((uint32_t)0x01000000) /*!< Largest memory, 3-byte addresses */
+
+/* Largest read of one Fast Read job */
+#define SPI_NOR_MAX_READ               ((uint32_t)32768)
+
+/* Commands */
+#define SPI_NOR_CMD_WREN               ((uint8_t)0x06)     /*!< Write enable */
+#define SPI_NOR_CMD_RDSR               ((uint8_t)0x05)     /*!< Read status register */
+#define SPI_NOR_CMD_FAST_READ          ((uint8_t)0x0B)     /*!< Fast read, one dummy byte */
+#define SPI_NOR_CMD_PP                 ((uint8_t)0x02)     /*!< Page program */
+#define SPI_NOR_CMD_SE                 ((uint8_t)0x20)     /*!< 4 KB sector erase */
+#define SPI_NOR_CMD_BE                 ((uint8_t)0xD8)     /*!< 64 KB block erase */
+#define SPI_NOR_CMD_RDID               ((uint8_t)0x9F)     /*!< JEDEC identification */
+#define SPI_NOR_CMD_RES                ((uint8_t)0xAB)     /*!< Release from deep power-down */
+
+#define SPI_NOR_SR_WIP                 ((uint8_t)0x01)     /*!< Write in progress */
+
+#define IS_SPI_NOR_ALIGNED(ADDRESS)    (((ADDRESS) & (SPI_NOR_ERASE_SIZE - 1)) == 0)
+/**
+  * @}
+  */
+
+/** @defgroup SPI_NOR_state
+  * @{
+  */
+#define SPI_NOR_IDLE                   ((uint32_t)0x00000000)
+#define SPI_NOR_PROGRAM                ((uint32_t)0x00000001)
+#define SPI_NOR_ERASE                  ((uint32_t)0x00000002)
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Initialization functions ***************************************************/
+void SPI_NOR_StructInit(SPI_NOR_InitTypeDef* Init);
+ErrorStatus SPI_NOR_Init(SPI_NOR_TypeDef* Nor, const SPI_NOR_InitTypeDef* Init);
+
+/* Memory functions ***********************************************************/
+ErrorStatus SPI_NOR_Read(SPI_NOR_TypeDef* Nor, uint32_t Address, uint8_t* Buffer, uint32_t Length);
+ErrorStatus SPI_NOR_ProgramAsync(SPI_NOR_TypeDef* Nor, uint32_t Address, const uint8_t* Data, uint32_t Length,
+                                 void (*Callback)(SPI_NOR_TypeDef* Nor, ErrorStatus Status));
+ErrorStatus SPI_NOR_EraseAsync(SPI_NOR_TypeDef* Nor, uint32_t Address, uint32_t Length,
+                               void (*Callback)(SPI_NOR_TypeDef* Nor, ErrorStatus Status));
+ErrorStatus SPI_NOR_Program(SPI_NOR_TypeDef* Nor, uint32_t Address, const uint8_t* Data, uint32_t Length);
+ErrorStatus SPI_NOR_Erase(SPI_NOR_TypeDef* Nor, uint32_t Address, uint32_t Length);
+FlagStatus SPI_NOR_Busy(SPI_NOR_TypeDef* Nor);
+
+/* Block device functions *****************************************************/
+ErrorStatus SPI_NOR_ReadSectors(SPI_NOR_TypeDef* Nor, uint8_t* Buffer, uint32_t Sector, uint32_t Count);
+ErrorStatus SPI_NOR_WriteSectors(SPI_NOR_TypeDef* Nor, const uint8_t* Buffer, uint32_t Sector, uint32_t Count);
+ErrorStatus SPI_NOR_Flush(SPI_NOR_TypeDef* Nor);
+uint32_t SPI_NOR_GetSectorCount(SPI_NOR_TypeDef* Nor);
+
+/* Statistics functions *******************************************************/
+void SPI_NOR_GetStat(SPI_NOR_TypeDef* Nor, SPI_NOR_StatTypeDef* Stat);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_SPI_NOR_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,192 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_spi_xfer.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the SPI DMA
+  *          transaction engine.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_SPI_XFER_H
+#define __STM32F4xx_SPI_XFER_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_spi.h"
+#include "stm32f4xx_dma.h"
+#include "stm32f4xx_gpio.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup SPI
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  SPI job definition
+  */
+
+typedef struct SPI_Job
+{
+  GPIO_TypeDef* CS_GPIOx;          /*!< GPIO port of the chip select, driven low during the job,
+                                        or 0 if the job has no chip select. */
+
+  uint16_t CS_Pin;                 /*!< GPIO pin of the chip select.
+                                        This parameter can be a value of @ref GPIO_pins_define */
+
+  uint16_t SPI_CPOL;               /*!< Specifies the serial clock steady state.
+                                        This parameter can be a value of @ref SPI_Clock_Polarity */
+
+  uint16_t SPI_CPHA;               /*!< Specifies the clock active edge for the bit capture.
+                                        This parameter can be a value of @ref SPI_Clock_Phase */
+
+  uint16_t SPI_DataSize;           /*!< Specifies the SPI data size.
+                                        This parameter can be a value of @ref SPI_data_size */
+
+  uint16_t SPI_BaudRatePrescaler;  /*!< Specifies the Baud Rate prescaler value.
+                                        This parameter can be a value of @ref SPI_BaudRate_Prescaler */
+
+  uint16_t SPI_FirstBit;           /*!< Specifies whether data transfers start from MSB or LSB bit.
+                                        This parameter can be a value of @ref SPI_MSB_LSB_transmission */
+
+  uint16_t Flags;                  /*!< Options of the job.
+                                        This parameter can be a combination of @ref SPI_job_flags */
+
+  uint16_t Length;                 /*!< Number of frames, from 1 to 65535. */
+
+  const void* pTxData;             /*!< Frames to send, or 0 to send 0xFF/0xFFFF. */
+
+  void* pRxData;                   /*!< Receives the frames, or 0 to discard them. */
+
+  void (*Callback)(struct SPI_Job* Job); /*!< Called from the DMA interrupt at the end of the job,
+                                        or 0. */
+
+  void* Context;                   /*!< Free for the application. */
+
+  __IO uint32_t Status;            /*!< Status of the job.
+                                        This parameter is a value of @ref SPI_job_status */
+
+  struct SPI_Job* Next;            /*!< Next job of a chain given to SPI_XferSubmitChain(), or 0. */
+
+  uint16_t CR1;                    /*!< Reserved: SPI configuration computed by SPI_XferPrepare(). */
+
+  struct SPI_Job* Link;            /*!< Reserved: next job of the queue. */
+}SPI_JobTypeDef;
+
+/**
+  * @brief  SPI transaction engine definition, one per SPI
+  */
+
+typedef struct
+{
+  SPI_TypeDef* SPIx;               /*!< Reserved: the SPI. */
+
+  DMA_Stream_TypeDef* RxStream;    /*!< Reserved: DMA stream of the SPI RX request. */
+
+  DMA_Stream_TypeDef* TxStream;    /*!< Reserved: DMA stream of the SPI TX request. */
+
+  DMA_MgrXferTypeDef RxXfer;       /*!< Reserved: DMA transfer of the received frames. */
+
+  DMA_MgrXferTypeDef TxXfer[2];    /*!< Reserved: DMA transfers of the sent frames, used in turn:
+                                        the next job may be queued before the interrupt of the TX
+                                        stream ended the previous one. */
+
+  uint32_t TxIndex;                /*!< Reserved: TxXfer of the next job. */
+
+  SPI_JobTypeDef* Active;          /*!< Reserved: job in progress. */
+
+  SPI_JobTypeDef* Head;            /*!< Reserved: first queued job. */
+
+  SPI_JobTypeDef* Tail;            /*!< Reserved: last queued job. */
+
+  GPIO_TypeDef* CS_GPIOx;          /*!< Reserved: chip select held low between two jobs. */
+
+  uint16_t CS_Pin;                 /*!< Reserved: pin of the held chip select. */
+
+  uint16_t CR1;                    /*!< Reserved: current SPI configuration. */
+
+  uint16_t TxDummy;                /*!< Reserved: frame sent when pTxData is 0. */
+
+  uint16_t RxSink;                 /*!< Reserved: receives the frames when pRxData is 0. */
+}SPI_XferEngineTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup SPI_job_flags
+  * @{
+  */
+#define SPI_JOB_CS_HOLD                 ((uint16_t)0x0001)  /*!< Keep the chip select low at the end of
+                                                                 the job, until a job with another chip
+                                                                 select or without this flag ends */
+#define IS_SPI_JOB_FLAGS(FLAGS) (((FLAGS) & (uint16_t)0xFFFE) == 0x00)
+/**
+  * @}
+  */
+
+/** @defgroup SPI_job_status
+  * @{
+  */
+#define SPI_JOB_DONE                    ((uint32_t)0x00000000)
+#define SPI_JOB_QUEUED                  ((uint32_t)0x00000001)
+#define SPI_JOB_ACTIVE                  ((uint32_t)0x00000002)
+#define SPI_JOB_ERROR                   ((uint32_t)0x00000003)
+#define SPI_JOB_ABORTED                 ((uint32_t)0x00000004)
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* SPI transaction engine functions *******************************************/
+ErrorStatus SPI_XferInit(SPI_XferEngineTypeDef* Engine, SPI_TypeDef* SPIx);
+void SPI_XferDeInit(SPI_XferEngineTypeDef* Engine);
+void SPI_XferJobStructInit(SPI_JobTypeDef* Job);
+void SPI_XferPrepare(SPI_JobTypeDef* Job);
+ErrorStatus SPI_XferSubmit(SPI_XferEngineTypeDef* Engine, SPI_JobTypeDef* Job);
+ErrorStatus SPI_XferSubmitChain(SPI_XferEngineTypeDef* Engine, SPI_JobTypeDef* First);
+void SPI_XferAbort(SPI_XferEngineTypeDef* Engine);
+FlagStatus SPI_XferBusy(SPI_XferEngineTypeDef* Engine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_SPI_XFER_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_tim_burst.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the TIM DMA
+  *          burst engine.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_TIM_BURST_H
+#define __STM32F4xx_TIM_BURST_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_tim.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup TIM
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct TIM_Burst;
+
+/**
+  * @brief  TIM burst waveform segment definition
+  */
+
+typedef struct TIM_BurstSegment
+{
+  DMA_MgrXferTypeDef Xfer;         /*!< Reserved: DMA transfer of the segment. */
+
+  const void* pData;               /*!< Frames of the segment, Registers values per frame,
+                                        read in place by the DMA. */
+
+  uint8_t Loop;                    /*!< If not 0, the segment is queued again each time it
+                                        is played, after its Callback, until TIM_BurstStop(). */
+
+  void (*Callback)(struct TIM_BurstSegment* Segment); /*!< Called from the DMA interrupt each
+                                        time the segment is played, or 0. */
+
+  void* Context;                   /*!< Free for the application. */
+
+  __IO uint32_t Status;            /*!< Status of the segment.
+                                        This parameter is a value of @ref DMA_Manager_transfer_status */
+
+  struct TIM_Burst* Burst;         /*!< Reserved: the engine of the segment. */
+}TIM_BurstSegmentTypeDef;
+
+/**
+  * @brief  TIM burst engine Init structure definition
+  */
+
+typedef struct
+{
+  TIM_TypeDef* TIMx;               /*!< TIM1, TIM2, TIM3, TIM4, TIM5 or TIM8. */
+
+  uint16_t TIM_DMABase;            /*!< First register written at each update event.
+                                        This parameter can be a value of @ref TIM_DMA_Base_address */
+
+  uint8_t Registers;               /*!< Number of registers written at each update event,
+                                        from 1 to 18. */
+
+  uint32_t DMA_MemoryDataSize;     /*!< Size of the values: DMA_MemoryDataSize_HalfWord, or
+                                        DMA_MemoryDataSize_Word for the 32-bit registers of
+                                        TIM2 and TIM5. */
+
+  uint16_t Frames;                 /*!< Number of frames of the waveform segments, or 0 to
+                                        update the registers with TIM_BurstWrite(). */
+}TIM_BurstInitTypeDef;
+
+/**
+  * @brief  TIM burst engine definition, one per timer
+  */
+
+typedef struct TIM_Burst
+{
+  TIM_BurstInitTypeDef Init;       /*!< Reserved: configuration given to TIM_BurstInit(). */
+
+  DMA_Stream_TypeDef* Stream;      /*!< Reserved: DMA stream of the update request. */
+
+  DMA_MgrXferTypeDef Xfer[2];      /*!< Reserved: transfers of TIM_BurstWrite(). */
+
+  uint32_t Frame[2][18];           /*!< Reserved: values of TIM_BurstWrite(). */
+
+  uint8_t Index;                   /*!< Reserved: next entry of Xfer and Frame. */
+
+  __IO uint8_t Stopping;           /*!< Reserved: the looping segments are not queued again. */
+
+  uint32_t Underruns;              /*!< Waveform segments that ended with no segment queued
+                                        after them. */
+}TIM_BurstTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* TIM DMA burst functions ****************************************************/
+ErrorStatus TIM_BurstInit(TIM_BurstTypeDef* Burst, const TIM_BurstInitTypeDef* TIM_BurstInitStruct);
+void TIM_BurstDeInit(TIM_BurstTypeDef* Burst);
+ErrorStatus TIM_BurstWrite(TIM_BurstTypeDef* Burst, const void* pValues);
+ErrorStatus TIM_BurstQueue(TIM_BurstTypeDef* Burst, TIM_BurstSegmentTypeDef* Segment);
+void TIM_BurstStart(TIM_BurstTypeDef* Burst);
+void TIM_BurstStop(TIM_BurstTypeDef* Burst);
+ErrorStatus TIM_BurstSync(TIM_TypeDef* Master, TIM_TypeDef* Slave, uint32_t Phase);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_TIM_BURST_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
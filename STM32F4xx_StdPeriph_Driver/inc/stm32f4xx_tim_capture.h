@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_tim_capture.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the TIM
+  *          capture engine and counter extension.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_TIM_CAPTURE_H
+#define __STM32F4xx_TIM_CAPTURE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_tim.h"
+#include "stm32f4xx_dma.h"
+#include "stm32f4xx_rcc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup TIM
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct TIM_Capture;
+
+/**
+  * @brief  Measures of a block of captures
+  */
+
+typedef struct
+{
+  uint32_t Periods;                /*!< Number of periods measured in the block. */
+
+  uint32_t Period;                 /*!< Average period in counter ticks, 0 when no period was
+                                        measured. */
+
+  uint32_t Frequency;              /*!< Average frequency of the edges in Hz. */
+
+  uint16_t Duty;                   /*!< TIM_CAPTURE_PWM mode: average high time in 0.01 % of the
+                                        period. */
+}TIM_CaptureStatsTypeDef;
+
+/**
+  * @brief  TIM capture engine Init structure definition
+  */
+
+typedef struct
+{
+  TIM_TypeDef* TIMx;               /*!< TIM1, TIM2, TIM3, TIM4, TIM5 or TIM8. The counters of
+                                        TIM2 and TIM5 and their captures are 32-bit. */
+
+  uint16_t TIM_Channel;            /*!< TIM_Channel_1 or TIM_Channel_2. */
+
+  uint16_t TIM_ICPolarity;         /*!< Edges captured, or edge starting the period in
+                                        TIM_CAPTURE_PWM mode.
+                                        This parameter can be a value of @ref TIM_Input_Capture_Polarity */
+
+  uint16_t TIM_ICFilter;           /*!< Input capture filter, between 0x0 and 0xF. */
+
+  uint16_t TIM_Prescaler;          /*!< Prescaler of the counter clock, between 0x0000 and 0xFFFF. */
+
+  uint8_t Mode;                    /*!< Captures of the engine.
+                                        This parameter can be a value of @ref TIM_Capture_modes */
+
+  void* Buffer;                    /*!< Captures of two blocks: BlockPeriods captures (one value)
+                                        or pairs of captures (TIM_CAPTURE_PWM mode) per block,
+                                        uint16_t, or uint32_t for TIM2 and TIM5. */
+
+  uint16_t BlockPeriods;           /*!< Number of captures or pairs of captures of a block. */
+
+  void (*Block)(struct TIM_Capture* Capture, const void* pData, uint16_t Count,
+                const TIM_CaptureStatsTypeDef* Stats);
+                                   /*!< Called from the DMA interrupt each time a block is full,
+                                        with its captures and measures, or 0. */
+}TIM_CaptureInitTypeDef;
+
+/**
+  * @brief  TIM capture engine definition
+  */
+
+typedef struct TIM_Capture
+{
+  TIM_CaptureInitTypeDef Init;     /*!< Reserved: configuration given to TIM_CaptureInit(). */
+
+  DMA_Stream_TypeDef* Stream;      /*!< Reserved: DMA stream of the capture request. */
+
+  DMA_MgrXferTypeDef Xfer[2];      /*!< Reserved: the two blocks of Buffer. */
+
+  uint32_t Last;                   /*!< Reserved: last capture of the previous block. */
+
+  uint8_t Started;                 /*!< Reserved: Last is valid. */
+
+  uint32_t Clock;                  /*!< Counter clock in Hz. */
+
+  uint32_t Overruns;               /*!< Blocks not queued again in time: captures were lost. */
+
+  TIM_CaptureStatsTypeDef Stats;   /*!< Measures of the last block. */
+
+  void* Context;                   /*!< Free for the application. */
+}TIM_CaptureTypeDef;
+
+/**
+  * @brief  Counter extended to 64 bits, for free running counters and
+  *         encoders
+  */
+
+typedef struct
+{
+  TIM_TypeDef* TIMx;               /*!< Reserved: the timer. */
+
+  __IO int32_t High;               /*!< Reserved: counter overflows minus underflows. */
+
+  int64_t Last;                    /*!< Reserved: value read by the last TIM_CounterExtSpeed(). */
+}TIM_CounterExtTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup TIM_Capture_modes
+  * @{
+  */
+#define TIM_CAPTURE_EDGES               ((uint8_t)0x00)  /*!< Counter value at each edge */
+#define TIM_CAPTURE_PWM                 ((uint8_t)0x01)  /*!< Period and high time of each period,
+                                                              the counter is reset at each period */
+#define IS_TIM_CAPTURE_MODE(MODE) (((MODE) == TIM_CAPTURE_EDGES) || ((MODE) == TIM_CAPTURE_PWM))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* TIM capture engine functions ***********************************************/
+ErrorStatus TIM_CaptureInit(TIM_CaptureTypeDef* Capture, const TIM_CaptureInitTypeDef* TIM_CaptureInitStruct);
+void TIM_CaptureDeInit(TIM_CaptureTypeDef* Capture);
+void TIM_CaptureStart(TIM_CaptureTypeDef* Capture);
+void TIM_CaptureStop(TIM_CaptureTypeDef* Capture);
+
+/* TIM counter extension functions ********************************************/
+void TIM_CounterExtInit(TIM_CounterExtTypeDef* Ext, TIM_TypeDef* TIMx);
+void TIM_CounterExtIRQHandler(TIM_CounterExtTypeDef* Ext);
+int64_t TIM_CounterExtRead(TIM_CounterExtTypeDef* Ext);
+int32_t TIM_CounterExtSpeed(TIM_CounterExtTypeDef* Ext, uint32_t SampleRate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_TIM_CAPTURE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
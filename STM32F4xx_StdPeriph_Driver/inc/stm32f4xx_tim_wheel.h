@@ -0,0 +1,119 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_tim_wheel.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the software
+  *          timers service.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_TIM_WHEEL_H
+#define __STM32F4xx_TIM_WHEEL_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_tim.h"
+#include "stm32f4xx_rcc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup TIM
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+  * @brief  Software timer definition
+  */
+
+typedef struct TIM_Timer
+{
+  struct TIM_Timer* Next;          /*!< Reserved: next timer of the slot. */
+
+  struct TIM_Timer* Prev;          /*!< Reserved: previous timer of the slot. */
+
+  uint32_t Expiry;                 /*!< Reserved: expiry time in microseconds. */
+
+  uint32_t Period;                 /*!< Reserved: period in microseconds, 0 for a one-shot timer. */
+
+  uint8_t Level;                   /*!< Reserved: level of the wheel, TIM_WHEEL_IDLE when the timer
+                                        is not running. */
+
+  uint8_t Slot;                    /*!< Reserved: slot in the level. */
+
+  void (*Callback)(struct TIM_Timer* Timer);
+                                   /*!< Called from the timer interrupt when the timer expires.
+                                        It may start and stop any timer, itself included. */
+
+  void* Context;                   /*!< Free for the application. */
+}TIM_TimerTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup TIM_Wheel_Constants
+  * @{
+  */
+#define TIM_WHEEL_LEVELS          7                /*!< Levels of 32 slots: 5 bits of the time each */
+#define TIM_WHEEL_IDLE            ((uint8_t)0xFF)  /*!< Level of a timer not running */
+#define TIM_WHEEL_MAX_DELAY       ((uint32_t)0x40000000) /*!< 2^30 us, about 17 minutes */
+
+#define IS_TIM_WHEEL_DELAY(DELAY) (((DELAY) != 0) && ((DELAY) <= TIM_WHEEL_MAX_DELAY))
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* Software timers service functions ******************************************/
+ErrorStatus TIM_WheelInit(TIM_TypeDef* TIMx);
+uint32_t TIM_WheelGetTime(void);
+void TIM_WheelIRQHandler(void);
+
+/* Software timers functions **************************************************/
+void TIM_TimerInit(TIM_TimerTypeDef* Timer, void (*Callback)(TIM_TimerTypeDef* Timer), void* Context);
+ErrorStatus TIM_TimerStart(TIM_TimerTypeDef* Timer, uint32_t Delay, uint32_t Period);
+void TIM_TimerStop(TIM_TimerTypeDef* Timer);
+FlagStatus TIM_TimerIsRunning(const TIM_TimerTypeDef* Timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_TIM_WHEEL_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,203 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_usart_frame.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the USART
+  *          framed protocol driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_USART_FRAME_H
+#define __STM32F4xx_USART_FRAME_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_usart_stream.h"
+#include "stm32f4xx_crc_engine.h"
+#include "stm32f4xx_tim_wheel.h"
+#include "stm32f4xx_gpio.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup USART
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct USART_Frame;
+
+/**
+  * @brief  USART frame Init structure definition
+  */
+
+typedef struct
+{
+  USART_TypeDef* USARTx;           /*!< USART1, USART2, USART3, UART4, UART5 or USART6. */
+
+  uint32_t USART_BaudRate;         /*!< Baud rate, 8 data bits. */
+
+  uint16_t USART_Parity;           /*!< Parity bit: USART_Parity_Even for Modbus RTU.
+                                        This parameter can be a value of @ref USART_Parity */
+
+  uint16_t USART_StopBits;         /*!< USART_StopBits_1, or USART_StopBits_2 with USART_Parity_No
+                                        for Modbus RTU. */
+
+  GPIO_TypeDef* DE_GPIOx;          /*!< GPIO port of the driver enable of the RS-485 transceiver,
+                                        in output push-pull mode and set low, or 0. */
+
+  uint16_t DE_Pin;                 /*!< GPIO pin of the driver enable, high while sending.
+                                        This parameter can be a value of @ref GPIO_pins_define */
+
+  uint32_t SilentInterval;         /*!< Microseconds of silent line ending a frame, at least one
+                                        character, or 0 for the Modbus RTU t3.5: 3.5 characters up
+                                        to 19200 baud, 1750 us above. */
+
+  FunctionalState Crc;             /*!< ENABLE: CRC-16/MODBUS checked and removed at the end of
+                                        the received frames, added to the sent ones. */
+
+  const CRC_TableTypeDef* CrcTable; /*!< Table built by CRC_TableInit() with
+                                        CRC_Param_CRC16_MODBUS, or 0 for the bitwise CRC. */
+
+  uint16_t RxBufferSize;           /*!< Size of RxBuffer, even, from 2 to 65534. */
+
+  uint8_t* RxBuffer;               /*!< Circular buffer of the DMA of the receiver. */
+
+  uint16_t FrameBufferSize;        /*!< Size of FrameBuffer: the longest frame, CRC included,
+                                        256 bytes for Modbus RTU. */
+
+  uint8_t* FrameBuffer;            /*!< 2 * FrameBufferSize bytes: the next frame is received into
+                                        one half while FrameCallback reads the other. */
+
+  void (*FrameCallback)(struct USART_Frame* Frame, const uint8_t* pData, uint16_t Length);
+                                   /*!< Called with each frame received without error, in place in
+                                        FrameBuffer and without its CRC, from the interrupt of the
+                                        software timers or of the USART. */
+
+  void (*TxCallback)(struct USART_Frame* Frame);
+                                   /*!< Called from the USART interrupt once the last stop bit of
+                                        a frame is sent and the driver enable is low, or 0. */
+}USART_FrameInitTypeDef;
+
+/**
+  * @brief  USART frame statistics definition
+  */
+
+typedef struct
+{
+  uint32_t RxFrames;               /*!< Frames given to FrameCallback. */
+
+  uint32_t CrcErrors;              /*!< Frames dropped for a wrong CRC or shorter than the CRC. */
+
+  uint32_t LineErrors;             /*!< Frames dropped for a parity, framing, noise or overrun
+                                        error on one of their bytes. */
+
+  uint32_t Overflows;              /*!< Frames dropped for being longer than FrameBuffer. */
+
+  uint32_t Gaps;                   /*!< Silences longer than one character but shorter than
+                                        SilentInterval inside a frame. */
+
+  uint32_t Missed;                 /*!< Frames dropped because FrameCallback still ran with the
+                                        previous one. */
+
+  uint32_t TxFrames;               /*!< Frames sent. */
+}USART_FrameStatsTypeDef;
+
+/**
+  * @brief  USART frame definition, one per USART
+  */
+
+typedef struct USART_Frame
+{
+  USART_FrameInitTypeDef Init;     /*!< Reserved: configuration given to USART_FrameInit(). */
+
+  USART_StreamTypeDef Stream;      /*!< Reserved: DMA reception and transmission. */
+
+  USART_StreamTxBufferTypeDef TxBuffer; /*!< Reserved: frame being sent. */
+
+  TIM_TimerTypeDef Timer;          /*!< Reserved: silent interval after the idle line. */
+
+  uint32_t Received;               /*!< Reserved: bytes of the frame in progress. */
+
+  uint32_t Mark;                   /*!< Reserved: bytes of the frame at the idle line. */
+
+  uint32_t Wait;                   /*!< Reserved: microseconds from the idle line to the end of
+                                        the silent interval, 0 to end the frame at the idle line. */
+
+  uint32_t Errors;                 /*!< Reserved: a byte of the frame had a line error. */
+
+  uint32_t Fill;                   /*!< Reserved: half of FrameBuffer receiving the frame. */
+
+  __IO uint32_t Delivering;        /*!< Reserved: FrameCallback runs with the other half. */
+
+  __IO uint32_t TxBusy;            /*!< Reserved: a frame is being sent. */
+
+  USART_FrameStatsTypeDef Stats;   /*!< Reserved: statistics returned by USART_FrameGetStats(). */
+
+  void* Context;                   /*!< Free for the application. */
+}USART_FrameTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+
+/** @defgroup USART_Frame_Constants
+  * @{
+  */
+#define USART_FRAME_CRC_SIZE           ((uint16_t)2)        /*!< CRC bytes, least significant first */
+#define USART_FRAME_MODBUS_T35_MAX     ((uint32_t)1750)     /*!< t3.5 above 19200 baud, us */
+#define USART_FRAME_MODBUS_FAST_BAUD   ((uint32_t)19200)
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* USART framed protocol functions ********************************************/
+void USART_FrameStructInit(USART_FrameInitTypeDef* USART_FrameInitStruct);
+ErrorStatus USART_FrameInit(USART_FrameTypeDef* Frame, const USART_FrameInitTypeDef* USART_FrameInitStruct);
+void USART_FrameDeInit(USART_FrameTypeDef* Frame);
+ErrorStatus USART_FrameSend(USART_FrameTypeDef* Frame, uint8_t* Data, uint16_t Length);
+FlagStatus USART_FrameTxBusy(USART_FrameTypeDef* Frame);
+void USART_FrameGetStats(USART_FrameTypeDef* Frame, USART_FrameStatsTypeDef* Stats);
+void USART_FrameIRQHandler(USART_FrameTypeDef* Frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_USART_FRAME_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_usart_stream.h
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file contains all the functions prototypes for the USART
+  *          streaming driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_USART_STREAM_H
+#define __STM32F4xx_USART_STREAM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_usart.h"
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @addtogroup USART
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+
+struct USART_Stream;
+
+/**
+  * @brief  USART stream TX buffer definition
+  */
+
+typedef struct USART_StreamTxBuffer
+{
+  DMA_MgrXferTypeDef Xfer;         /*!< Reserved: DMA transfer of the buffer. */
+
+  const uint8_t* pData;            /*!< Bytes to send, read in place by the DMA. */
+
+  uint16_t Length;                 /*!< Number of bytes, from 1 to 65535. */
+
+  void (*Callback)(struct USART_StreamTxBuffer* Buffer); /*!< Called from the DMA interrupt once
+                                        the bytes are written to the USART, or 0. */
+
+  void* Context;                   /*!< Free for the application. */
+
+  __IO uint32_t Status;            /*!< Status of the buffer.
+                                        This parameter is a value of @ref DMA_Manager_transfer_status */
+
+  struct USART_Stream* Stream;     /*!< Reserved: the stream of the buffer. */
+}USART_StreamTxBufferTypeDef;
+
+/**
+  * @brief  USART stream Init structure definition
+  */
+
+typedef struct
+{
+  USART_TypeDef* USARTx;           /*!< USART1, USART2, USART3, UART4, UART5 or USART6. */
+
+  uint32_t USART_BaudRate;         /*!< Baud rate, 8 data bits, no parity, 1 stop bit. */
+
+  uint16_t USART_HardwareFlowControl; /*!< USART_HardwareFlowControl_None or
+                                        USART_HardwareFlowControl_RTS_CTS. */
+
+  uint16_t RxBufferSize;           /*!< Size of RxBuffer, even, from 2 to 65534. */
+
+  uint8_t* RxBuffer;               /*!< Circular buffer of the received bytes. */
+
+  void (*RxCallback)(struct USART_Stream* Stream, const uint8_t* pData, uint16_t Length);
+                                   /*!< Called with the bytes received, in place in RxBuffer, when
+                                        the line becomes idle and at each half of RxBuffer. If 0,
+                                        the bytes are read using USART_StreamRead(). */
+}USART_StreamInitTypeDef;
+
+/**
+  * @brief  USART stream statistics definition
+  */
+
+typedef struct
+{
+  uint32_t RxBytes;                /*!< Bytes received. */
+
+  uint32_t TxBytes;                /*!< Bytes of the completed TX buffers. */
+
+  uint32_t RxIdle;                 /*!< Idle line events. */
+
+  uint32_t RxOverruns;             /*!< USART overruns: a byte was lost before the DMA read it. */
+
+  uint32_t RxLost;                 /*!< Bytes overwritten in RxBuffer before USART_StreamRead(). */
+
+  uint32_t FramingErrors;          /*!< Bytes received with a framing error. */
+
+  uint32_t NoiseErrors;            /*!< Bytes received with noise. */
+}USART_StreamStatsTypeDef;
+
+/**
+  * @brief  USART stream definition, one per USART
+  */
+
+typedef struct USART_Stream
+{
+  USART_StreamInitTypeDef Init;    /*!< Reserved: configuration given to USART_StreamInit(). */
+
+  DMA_Stream_TypeDef* RxStream;    /*!< Reserved: DMA stream of the USART RX request. */
+
+  DMA_Stream_TypeDef* TxStream;    /*!< Reserved: DMA stream of the USART TX request. */
+
+  DMA_MgrXferTypeDef RxXfer[2];    /*!< Reserved: the two halves of RxBuffer. */
+
+  uint32_t WrIndex;                /*!< Reserved: position of the DMA at the last event. */
+
+  uint32_t RdIndex;                /*!< Reserved: first byte not read. */
+
+  uint32_t Unread;                 /*!< Reserved: bytes not read, without RxCallback. */
+
+  uint8_t Paused;                  /*!< Reserved: 1 while the DMA requests are stopped to hold RTS. */
+
+  USART_StreamStatsTypeDef Stats;  /*!< Reserved: statistics returned by USART_StreamGetStats(). */
+
+  void* Context;                   /*!< Free for the application. */
+}USART_StreamTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+
+/* USART streaming functions **************************************************/
+ErrorStatus USART_StreamInit(USART_StreamTypeDef* Stream, const USART_StreamInitTypeDef* USART_StreamInitStruct);
+void USART_StreamDeInit(USART_StreamTypeDef* Stream);
+uint16_t USART_StreamAvailable(USART_StreamTypeDef* Stream);
+uint16_t USART_StreamRead(USART_StreamTypeDef* Stream, uint8_t* Buffer, uint16_t Length);
+ErrorStatus USART_StreamSend(USART_StreamTypeDef* Stream, USART_StreamTxBufferTypeDef* Buffer);
+void USART_StreamGetStats(USART_StreamTypeDef* Stream, USART_StreamStatsTypeDef* Stats);
+void USART_StreamIRQHandler(USART_StreamTypeDef* Stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*__STM32F4xx_USART_STREAM_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
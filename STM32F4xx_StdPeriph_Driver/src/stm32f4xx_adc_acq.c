@@ -0,0 +1,637 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_adc_acq.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a continuous acquisition engine for the ADCs:
+  *           - Independent, dual interleaved or triple interleaved mode
+  *           - Timer or continuous triggering
+  *           - Ring of blocks filled by the DMA in double buffer mode
+  *           - Delivery of the filled blocks, without copy, to a callback or
+  *             to the application
+  *           - Overrun statistics
+  *          It uses the stm32f4xx_adc.c, stm32f4xx_tim.c and stm32f4xx_dma_mgr.c
+  *          drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the clocks of the ADCs, of the GPIO of the channel, of DMA2
+  *             and of the timer, configure the GPIO in analog mode and call
+  *             DMA_MgrInit().
+  *
+  *          2. Fill an ADC_AcqInitTypeDef structure and call ADC_AcqInit(). The
+  *             stream of the ADC1 request is allocated from the DMA manager.
+  *
+  *          3. Call ADC_AcqIRQHandler() from ADC_IRQHandler and DMA_MgrIRQHandler()
+  *             from the interrupt handler of the allocated stream. Give both
+  *             interrupts the same preemption priority and enable ADC_IRQn using
+  *             the NVIC_Init() function.
+  *
+  *          4. Start the acquisition using ADC_AcqStart().
+  *
+  *          5. Each filled block is passed to the Callback, and reused when the
+  *             Callback returns; without Callback, get the filled blocks using
+  *             ADC_AcqGetBlock() and give them back using ADC_AcqReleaseBlock().
+  *
+  *          6. Read the statistics using ADC_AcqGetStats() and stop the acquisition
+  *             using ADC_AcqStop().
+  *
+  * @note   In dual and triple interleaved mode the DMA reads the common data
+  *         register in DMA mode 2: each word holds two conversions and the
+  *         halfwords of the blocks follow the order of the conversions,
+  *         ADC1, ADC2 (, ADC3), ADC1, ... The blocks are a single stream of
+  *         samples at 2 or 3 times the rate of one ADC: with a 36 MHz ADC clock,
+  *         3 sampling cycles and 12-bit resolution, one ADC converts in 15 cycles
+  *         and the triple mode with a 5 cycle delay reaches 7.2 Msamples/s.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_adc_acq.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup ADC
+  * @brief ADC driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Owner of a block */
+#define ADC_ACQ_BLOCK_FREE      ((uint32_t)0x00000000)  /* Idle, owned by the engine */
+#define ADC_ACQ_BLOCK_DMA       ((uint32_t)0x00000001)  /* Queued on the DMA stream */
+#define ADC_ACQ_BLOCK_READY     ((uint32_t)0x00000002)  /* Filled, not yet read */
+#define ADC_ACQ_BLOCK_USER      ((uint32_t)0x00000003)  /* Held by the consumer */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static ADC_TypeDef* const ADC_AcqADCs[3] = {ADC1, ADC2, ADC3};
+
+static ADC_AcqInitTypeDef ADC_AcqConfig;
+static ADC_CommonInitTypeDef ADC_AcqCommon;
+static DMA_Stream_TypeDef* ADC_AcqStream = 0;
+static ADC_AcqBlockTypeDef ADC_AcqBlocks[ADC_ACQ_MAX_BLOCKS];
+static ADC_AcqBlockTypeDef* ADC_AcqReadyHead = 0;
+static ADC_AcqBlockTypeDef* ADC_AcqReadyTail = 0;
+static ADC_AcqStatsTypeDef ADC_AcqStatistics;
+static uint32_t ADC_AcqNumADCs = 1;
+static uint32_t ADC_AcqInFlight = 0;
+static uint32_t ADC_AcqSequence = 0;
+static uint8_t ADC_AcqRunning = 0;
+static uint8_t ADC_AcqStarved = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void ADC_AcqRun(void);
+static void ADC_AcqHalt(void);
+static void ADC_AcqXferDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup ADC_Private_Functions
+  * @{
+  */
+
+/** @defgroup ADC_Group8 ADC acquisition engine functions
+ *  @brief   ADC acquisition engine functions
+ *
+@verbatim
+ ===============================================================================
+                      ADC acquisition engine functions
+ ===============================================================================
+
+  This subsection provides functions allowing to acquire a channel continuously
+  into a ring of blocks.
+
+  The DMA stream of ADC1 runs in circular double buffer mode through the DMA
+  manager: while the DMA fills one block, the next one is already programmed in
+  the other memory target, and a block is queued again as soon as the consumer
+  releases it. The consumer works in place on the blocks.
+
+  An ADC overrun stops the DMA requests of the ADCs: the interrupt handler
+  counts it, then restarts the ADCs and the DMA stream. When the consumer holds
+  all the blocks, the ADCs are stopped until a block is released.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configures the ADCs, the timer and the DMA stream of the acquisition.
+  * @param  ADC_AcqInitStruct: pointer to an ADC_AcqInitTypeDef structure that
+  *         contains the configuration of the acquisition.
+  * @note   A previous acquisition is stopped and its DMA stream released.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the acquisition is configured
+  *          - ERROR: invalid configuration or no free DMA stream
+  */
+ErrorStatus ADC_AcqInit(ADC_AcqInitTypeDef* ADC_AcqInitStruct)
+{
+  ADC_InitTypeDef ADC_InitStructure;
+  DMA_InitTypeDef DMA_InitStructure;
+  TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+  uint32_t trigger = ADC_ExternalTrigConv_T1_CC1;
+  uint32_t index = 0, numADCs = 1;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_PRESCALER(ADC_AcqInitStruct->ADC_Prescaler));
+  assert_param(IS_ADC_SAMPLING_DELAY(ADC_AcqInitStruct->ADC_TwoSamplingDelay));
+  assert_param(IS_ADC_CHANNEL(ADC_AcqInitStruct->ADC_Channel));
+  assert_param(IS_ADC_SAMPLE_TIME(ADC_AcqInitStruct->ADC_SampleTime));
+
+  if ((ADC_AcqInitStruct->NumBlocks < 2) || (ADC_AcqInitStruct->NumBlocks > ADC_ACQ_MAX_BLOCKS) ||
+      (ADC_AcqInitStruct->BlockSize == 0))
+  {
+    return ERROR;
+  }
+
+  if (ADC_AcqInitStruct->ADC_Mode == ADC_Mode_Independent)
+  {
+    numADCs = 1;
+  }
+  else if ((ADC_AcqInitStruct->ADC_Mode == ADC_DualMode_Interl) ||
+           (ADC_AcqInitStruct->ADC_Mode == ADC_TripleMode_Interl))
+  {
+    /* One DMA word holds two conversions */
+    if (((ADC_AcqInitStruct->BlockSize & 0x1) != 0) ||
+        (((uint32_t)ADC_AcqInitStruct->Buffer & 0x3) != 0))
+    {
+      return ERROR;
+    }
+    numADCs = (ADC_AcqInitStruct->ADC_Mode == ADC_DualMode_Interl) ? 2 : 3;
+  }
+  else
+  {
+    return ERROR;
+  }
+
+  if (ADC_AcqInitStruct->TIMx == TIM2)
+  {
+    trigger = ADC_ExternalTrigConv_T2_TRGO;
+  }
+  else if (ADC_AcqInitStruct->TIMx == TIM3)
+  {
+    trigger = ADC_ExternalTrigConv_T3_TRGO;
+  }
+  else if (ADC_AcqInitStruct->TIMx == TIM8)
+  {
+    trigger = ADC_ExternalTrigConv_T8_TRGO;
+  }
+  else if (ADC_AcqInitStruct->TIMx != 0)
+  {
+    return ERROR;
+  }
+
+  /* Release the previous acquisition */
+  if (ADC_AcqStream != 0)
+  {
+    ADC_AcqStop();
+    DMA_MgrFree(ADC_AcqStream);
+    ADC_AcqStream = 0;
+  }
+
+  ADC_AcqConfig = *ADC_AcqInitStruct;
+  ADC_AcqNumADCs = numADCs;
+
+  /* ADC Common configuration -----------------------------------------------*/
+  ADC_AcqCommon.ADC_Mode = ADC_AcqConfig.ADC_Mode;
+  ADC_AcqCommon.ADC_Prescaler = ADC_AcqConfig.ADC_Prescaler;
+  ADC_AcqCommon.ADC_DMAAccessMode = (ADC_AcqNumADCs == 1) ? ADC_DMAAccessMode_Disabled :
+                                                            ADC_DMAAccessMode_2;
+  ADC_AcqCommon.ADC_TwoSamplingDelay = ADC_AcqConfig.ADC_TwoSamplingDelay;
+  ADC_CommonInit(&ADC_AcqCommon);
+
+  /* Timer configuration: one trigger on each update event -----------------*/
+  if (ADC_AcqConfig.TIMx != 0)
+  {
+    TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+    TIM_TimeBaseStructure.TIM_Prescaler = ADC_AcqConfig.TIM_Prescaler;
+    TIM_TimeBaseStructure.TIM_Period = ADC_AcqConfig.TIM_Period;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseInit(ADC_AcqConfig.TIMx, &TIM_TimeBaseStructure);
+    TIM_SelectOutputTrigger(ADC_AcqConfig.TIMx, TIM_TRGOSource_Update);
+  }
+
+  /* ADCs configuration: the slaves follow ADC1 in interleaved mode --------*/
+  ADC_InitStructure.ADC_Resolution = ADC_Resolution_12b;
+  ADC_InitStructure.ADC_ScanConvMode = DISABLE;
+  ADC_InitStructure.ADC_ContinuousConvMode = (ADC_AcqConfig.TIMx == 0) ? ENABLE : DISABLE;
+  ADC_InitStructure.ADC_ExternalTrigConv = trigger;
+  ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;
+  ADC_InitStructure.ADC_NbrOfConversion = 1;
+
+  for (index = 0; index < ADC_AcqNumADCs; index++)
+  {
+    ADC_InitStructure.ADC_ExternalTrigConvEdge = ((index == 0) && (ADC_AcqConfig.TIMx != 0)) ?
+                                                 ADC_ExternalTrigConvEdge_Rising :
+                                                 ADC_ExternalTrigConvEdge_None;
+    ADC_Init(ADC_AcqADCs[index], &ADC_InitStructure);
+    ADC_RegularChannelConfig(ADC_AcqADCs[index], ADC_AcqConfig.ADC_Channel, 1,
+                             ADC_AcqConfig.ADC_SampleTime);
+    ADC_ClearITPendingBit(ADC_AcqADCs[index], ADC_IT_OVR);
+    ADC_ITConfig(ADC_AcqADCs[index], ADC_IT_OVR, ENABLE);
+  }
+
+  /* Keep the DMA requests after the last transfer: the DMA is circular */
+  if (ADC_AcqNumADCs == 1)
+  {
+    ADC_DMARequestAfterLastTransferCmd(ADC1, ENABLE);
+  }
+  else
+  {
+    ADC_MultiModeDMARequestAfterLastTransferCmd(ENABLE);
+  }
+
+  /* DMA stream of the ADC1 request, in streaming mode ---------------------*/
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+  DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+  DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+  DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+
+  if (ADC_AcqNumADCs == 1)
+  {
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&ADC1->DR;
+    DMA_InitStructure.DMA_BufferSize = ADC_AcqConfig.BlockSize;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+  }
+  else
+  {
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&ADC->CDR;
+    DMA_InitStructure.DMA_BufferSize = (uint32_t)ADC_AcqConfig.BlockSize >> 1;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  }
+
+  ADC_AcqStream = DMA_MgrAlloc(DMA_MGR_REQ_ADC1, &DMA_InitStructure);
+  if (ADC_AcqStream == 0)
+  {
+    return ERROR;
+  }
+
+  /* Blocks of the ring -----------------------------------------------------*/
+  for (index = 0; index < ADC_AcqConfig.NumBlocks; index++)
+  {
+    ADC_AcqBlocks[index].pData = ADC_AcqConfig.Buffer + (index * ADC_AcqConfig.BlockSize);
+    ADC_AcqBlocks[index].Sequence = 0;
+    ADC_AcqBlocks[index].Timestamp = 0;
+    ADC_AcqBlocks[index].State = ADC_ACQ_BLOCK_FREE;
+    ADC_AcqBlocks[index].Next = 0;
+    ADC_AcqBlocks[index].Xfer.MemoryBaseAddr = (uint32_t)ADC_AcqBlocks[index].pData;
+    ADC_AcqBlocks[index].Xfer.Count = (uint16_t)DMA_InitStructure.DMA_BufferSize;
+    ADC_AcqBlocks[index].Xfer.Callback = ADC_AcqXferDone;
+    ADC_AcqBlocks[index].Xfer.Context = &ADC_AcqBlocks[index];
+  }
+
+  ADC_AcqReadyHead = 0;
+  ADC_AcqReadyTail = 0;
+  ADC_AcqInFlight = 0;
+  ADC_AcqRunning = 0;
+  ADC_AcqStarved = 0;
+  ADC_AcqStatistics.Blocks = 0;
+  ADC_AcqStatistics.Overruns = 0;
+  ADC_AcqStatistics.Underruns = 0;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts the acquisition configured by ADC_AcqInit().
+  * @param  None
+  * @retval None
+  */
+void ADC_AcqStart(void)
+{
+  if ((ADC_AcqStream != 0) && (ADC_AcqRunning == 0))
+  {
+    ADC_AcqRunning = 1;
+    ADC_AcqSequence = 0;
+    ADC_AcqRun();
+  }
+}
+
+/**
+  * @brief  Stops the acquisition.
+  * @note   The filled blocks not yet read stay available to ADC_AcqGetBlock().
+  * @param  None
+  * @retval None
+  */
+void ADC_AcqStop(void)
+{
+  if (ADC_AcqRunning != 0)
+  {
+    ADC_AcqRunning = 0;
+    ADC_AcqStarved = 0;
+    ADC_AcqHalt();
+  }
+}
+
+/**
+  * @brief  Returns the oldest filled block, when there is no Callback.
+  * @param  None
+  * @retval The block, held by the application until ADC_AcqReleaseBlock(), or 0
+  *         if no block is filled.
+  */
+ADC_AcqBlockTypeDef* ADC_AcqGetBlock(void)
+{
+  ADC_AcqBlockTypeDef* block;
+  uint32_t primask = NVIC_EnterCritical();
+
+  block = ADC_AcqReadyHead;
+  if (block != 0)
+  {
+    ADC_AcqReadyHead = block->Next;
+    if (ADC_AcqReadyHead == 0)
+    {
+      ADC_AcqReadyTail = 0;
+    }
+    block->State = ADC_ACQ_BLOCK_USER;
+  }
+
+  NVIC_ExitCritical(primask);
+
+  return block;
+}
+
+/**
+  * @brief  Gives back a block returned by ADC_AcqGetBlock() to the acquisition.
+  * @param  Block: the block.
+  * @retval None
+  */
+void ADC_AcqReleaseBlock(ADC_AcqBlockTypeDef* Block)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  Block->State = ADC_ACQ_BLOCK_FREE;
+
+  if (ADC_AcqRunning != 0)
+  {
+    if (ADC_AcqStarved != 0)
+    {
+      /* The ADCs were stopped for want of a block */
+      ADC_AcqRun();
+    }
+    else
+    {
+      Block->State = ADC_ACQ_BLOCK_DMA;
+      ADC_AcqInFlight++;
+      DMA_MgrSubmit(ADC_AcqStream, &Block->Xfer);
+    }
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Returns the statistics of the acquisition since ADC_AcqInit().
+  * @param  Stats: pointer to an ADC_AcqStatsTypeDef structure which receives the
+  *         statistics.
+  * @retval None
+  */
+void ADC_AcqGetStats(ADC_AcqStatsTypeDef* Stats)
+{
+  *Stats = ADC_AcqStatistics;
+}
+
+/**
+  * @brief  Handles the overrun interrupts of the ADCs of the acquisition.
+  * @note   This function must be called from ADC_IRQHandler.
+  * @param  None
+  * @retval None
+  */
+void ADC_AcqIRQHandler(void)
+{
+  uint32_t index = 0, overrun = 0;
+
+  for (index = 0; index < ADC_AcqNumADCs; index++)
+  {
+    if (ADC_GetITStatus(ADC_AcqADCs[index], ADC_IT_OVR) != RESET)
+    {
+      ADC_ClearITPendingBit(ADC_AcqADCs[index], ADC_IT_OVR);
+      overrun = 1;
+    }
+  }
+
+  if ((overrun != 0) && (ADC_AcqRunning != 0))
+  {
+    ADC_AcqStatistics.Overruns++;
+
+    /* The DMA requests are stopped: restart the ADCs and the DMA stream */
+    ADC_AcqHalt();
+    ADC_AcqRun();
+  }
+}
+
+/**
+  * @brief  Queues the free blocks on the DMA stream and starts the ADCs.
+  * @param  None
+  * @retval None
+  */
+static void ADC_AcqRun(void)
+{
+  ADC_CommonInitTypeDef ADC_CommonInitStructure;
+  uint32_t index = 0;
+
+  for (index = 0; index < ADC_AcqConfig.NumBlocks; index++)
+  {
+    if (ADC_AcqBlocks[index].State == ADC_ACQ_BLOCK_FREE)
+    {
+      ADC_AcqBlocks[index].State = ADC_ACQ_BLOCK_DMA;
+      ADC_AcqInFlight++;
+      DMA_MgrSubmit(ADC_AcqStream, &ADC_AcqBlocks[index].Xfer);
+    }
+  }
+
+  if (ADC_AcqInFlight == 0)
+  {
+    /* All the blocks are held by the consumer */
+    ADC_AcqStarved = 1;
+    return;
+  }
+  ADC_AcqStarved = 0;
+
+  /* Enable the DMA requests of the ADCs */
+  if (ADC_AcqNumADCs == 1)
+  {
+    ADC_DMACmd(ADC1, ENABLE);
+  }
+  else
+  {
+    ADC_CommonInitStructure = ADC_AcqCommon;
+    ADC_CommonInit(&ADC_CommonInitStructure);
+  }
+
+  /* Enable the slaves, then the master */
+  for (index = ADC_AcqNumADCs; index > 0; index--)
+  {
+    ADC_Cmd(ADC_AcqADCs[index - 1], ENABLE);
+  }
+
+  if (ADC_AcqConfig.TIMx != 0)
+  {
+    TIM_Cmd(ADC_AcqConfig.TIMx, ENABLE);
+  }
+  else
+  {
+    ADC_SoftwareStartConv(ADC1);
+  }
+}
+
+/**
+  * @brief  Stops the ADCs and aborts the blocks queued on the DMA stream.
+  * @param  None
+  * @retval None
+  */
+static void ADC_AcqHalt(void)
+{
+  ADC_CommonInitTypeDef ADC_CommonInitStructure;
+  uint32_t index = 0;
+
+  if (ADC_AcqConfig.TIMx != 0)
+  {
+    TIM_Cmd(ADC_AcqConfig.TIMx, DISABLE);
+  }
+
+  for (index = 0; index < ADC_AcqNumADCs; index++)
+  {
+    ADC_Cmd(ADC_AcqADCs[index], DISABLE);
+  }
+
+  /* Disable the DMA requests: they are enabled again to leave an overrun */
+  if (ADC_AcqNumADCs == 1)
+  {
+    ADC_DMACmd(ADC1, DISABLE);
+  }
+  else
+  {
+    ADC_CommonInitStructure = ADC_AcqCommon;
+    ADC_CommonInitStructure.ADC_DMAAccessMode = ADC_DMAAccessMode_Disabled;
+    ADC_CommonInit(&ADC_CommonInitStructure);
+  }
+
+  for (index = 0; index < ADC_AcqNumADCs; index++)
+  {
+    ADC_ClearFlag(ADC_AcqADCs[index], ADC_FLAG_OVR);
+  }
+
+  /* The callback of the aborted blocks makes them free */
+  DMA_MgrAbort(ADC_AcqStream);
+}
+
+/**
+  * @brief  Callback of the DMA transfer of a block.
+  * @param  Xfer: the DMA transfer of the block.
+  * @retval None
+  */
+static void ADC_AcqXferDone(DMA_MgrXferTypeDef* Xfer)
+{
+  ADC_AcqBlockTypeDef* block = (ADC_AcqBlockTypeDef*)Xfer->Context;
+
+  ADC_AcqInFlight--;
+
+  if (Xfer->Status != DMA_MGR_XFER_DONE)
+  {
+    /* Aborted by ADC_AcqHalt(), or lost on a transfer error */
+    block->State = ADC_ACQ_BLOCK_FREE;
+    if ((Xfer->Status == DMA_MGR_XFER_ERROR) && (ADC_AcqRunning != 0))
+    {
+      block->State = ADC_ACQ_BLOCK_DMA;
+      ADC_AcqInFlight++;
+      DMA_MgrSubmit(ADC_AcqStream, Xfer);
+    }
+    return;
+  }
+
+  block->Sequence = ADC_AcqSequence++;
+  if (ADC_AcqConfig.GetTime != 0)
+  {
+    block->Timestamp = ADC_AcqConfig.GetTime();
+  }
+  else
+  {
+    block->Timestamp = block->Sequence * ADC_AcqConfig.BlockSize;
+  }
+  ADC_AcqStatistics.Blocks++;
+
+  if ((ADC_AcqInFlight == 0) && (ADC_AcqRunning != 0))
+  {
+    /* No block was queued behind this one: the DMA manager stopped the stream,
+       stop the ADCs before they overrun */
+    ADC_AcqStatistics.Underruns++;
+    ADC_AcqHalt();
+    ADC_AcqStarved = 1;
+  }
+
+  if (ADC_AcqConfig.Callback != 0)
+  {
+    block->State = ADC_ACQ_BLOCK_USER;
+    ADC_AcqConfig.Callback(block);
+    ADC_AcqReleaseBlock(block);
+  }
+  else
+  {
+    block->State = ADC_ACQ_BLOCK_READY;
+    block->Next = 0;
+    if (ADC_AcqReadyTail != 0)
+    {
+      ADC_AcqReadyTail->Next = block;
+    }
+    else
+    {
+      ADC_AcqReadyHead = block;
+    }
+    ADC_AcqReadyTail = block;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
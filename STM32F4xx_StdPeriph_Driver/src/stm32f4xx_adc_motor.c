@@ -0,0 +1,365 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_adc_motor.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a current sampling engine for motor control,
+  *          synchronized with the PWM:
+  *           - Dual or triple simultaneous injected conversions of the phase
+  *             currents, triggered by channel 4 of TIM1 or TIM8
+  *           - Offset calibration stored in the injected offset registers
+  *           - All the phase currents in q31 format in one interrupt
+  *           - Update of the phase duty cycles for the next period
+  *          It uses the stm32f4xx_adc.c and stm32f4xx_tim.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the clocks of the ADCs, of the GPIO of the channels and
+  *             of the timer, configure the GPIO in analog mode. Configure the
+  *             PWM of the phases on channels 1 to 3 of TIM1 or TIM8, in
+  *             center-aligned mode 1.
+  *
+  *          2. Fill an ADC_MotorInitTypeDef structure and call ADC_MotorInit().
+  *
+  *          3. With the power stage off (zero current), start the timer and
+  *             call ADC_MotorCalibrate().
+  *
+  *          4. Call ADC_MotorIRQHandler() from ADC_IRQHandler, enable ADC_IRQn
+  *             using the NVIC_Init() function, and start the sampling using
+  *             ADC_MotorStart().
+  *
+  *          5. The Callback receives the phase currents of each PWM period. A
+  *             field oriented control loop runs the fused CMSIS DSP kernel on
+  *             them and applies its duty cycles:
+  *               arm_foc_q31(&Foc, pCurrents[0], pCurrents[1], Theta,
+  *                           IdRef, IqRef, Duty);
+  *               ADC_MotorSetDuty(Duty);
+  *
+  *          6. Stop the sampling using ADC_MotorStop().
+  *
+  * @note   The Callback must return within one PWM period: the periods it
+  *         overruns are counted, see ADC_MotorGetOverruns().
+  *
+  * @note   The engine uses the ADCs in injected simultaneous mode: their
+  *         regular groups can only run in the matching simultaneous mode,
+  *         not the interleaved modes of the acquisition engine.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_adc_motor.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup ADC
+  * @brief ADC driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define ADC_MOTOR_TIMEOUT       ((uint32_t)0x00010000)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static ADC_TypeDef* const ADC_MotorADCs[3] = {ADC1, ADC2, ADC3};
+
+static ADC_MotorInitTypeDef ADC_MotorConfig;
+static int32_t ADC_MotorCurrents[3];
+static uint32_t ADC_MotorOverruns = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup ADC_Private_Functions
+  * @{
+  */
+
+/** @defgroup ADC_Group9 ADC motor sampling engine functions
+ *  @brief   ADC motor sampling engine functions
+ *
+@verbatim
+ ===============================================================================
+                    ADC motor sampling engine functions
+ ===============================================================================
+
+  This subsection provides functions allowing to sample the phase currents of
+  a motor once per PWM period, at a fixed point of the period.
+
+  ADC1 is the master of ADC2 (and ADC3) in injected simultaneous mode: the
+  compare event of channel 4 of the PWM timer starts the injected conversion
+  of the phase a current on ADC1, b on ADC2 (and c on ADC3) at the same time.
+  The end of the conversions raises a single JEOC interrupt.
+
+  The data are left aligned, and the offset measured by ADC_MotorCalibrate()
+  is subtracted by the ADCs: the injected data registers hold signed 16-bit
+  values, turned into q31 by a shift. No sample is processed by the CPU
+  between the interrupts.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configures the ADCs and channel 4 of the timer for the sampling.
+  * @param  ADC_MotorInitStruct: pointer to an ADC_MotorInitTypeDef structure
+  *         that contains the configuration of the engine.
+  * @note   The preload of the compare registers of channels 1 to 3 is
+  *         enabled: the duty cycles set by ADC_MotorSetDuty() apply from the
+  *         next period. The offsets are reset to 0.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the engine is configured
+  *          - ERROR: invalid configuration
+  */
+ErrorStatus ADC_MotorInit(ADC_MotorInitTypeDef* ADC_MotorInitStruct)
+{
+  ADC_CommonInitTypeDef ADC_CommonInitStructure;
+  ADC_InitTypeDef ADC_InitStructure;
+  TIM_OCInitTypeDef TIM_OCInitStructure;
+  uint32_t index = 0;
+
+  /* Check the parameters */
+  assert_param(IS_ADC_MOTOR_PHASES(ADC_MotorInitStruct->NumPhases));
+  assert_param(IS_ADC_PRESCALER(ADC_MotorInitStruct->ADC_Prescaler));
+  assert_param(IS_ADC_SAMPLE_TIME(ADC_MotorInitStruct->ADC_SampleTime));
+  assert_param(IS_FUNCTIONAL_STATE(ADC_MotorInitStruct->Inverted));
+
+  if (((ADC_MotorInitStruct->TIMx != TIM1) && (ADC_MotorInitStruct->TIMx != TIM8)) ||
+      !IS_ADC_MOTOR_PHASES(ADC_MotorInitStruct->NumPhases) || (ADC_MotorInitStruct->Callback == 0))
+  {
+    return ERROR;
+  }
+
+  ADC_MotorStop();
+  ADC_MotorConfig = *ADC_MotorInitStruct;
+  ADC_MotorOverruns = 0;
+
+  /* ADC Common configuration -----------------------------------------------*/
+  ADC_CommonStructInit(&ADC_CommonInitStructure);
+  ADC_CommonInitStructure.ADC_Mode = (ADC_MotorConfig.NumPhases == 2) ? ADC_DualMode_InjecSimult :
+                                                                         ADC_TripleMode_InjecSimult;
+  ADC_CommonInitStructure.ADC_Prescaler = ADC_MotorConfig.ADC_Prescaler;
+  ADC_CommonInit(&ADC_CommonInitStructure);
+
+  /* ADCs configuration: one injected conversion each, triggered on ADC1 ---*/
+  ADC_StructInit(&ADC_InitStructure);
+  ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Left;
+
+  for (index = 0; index < ADC_MotorConfig.NumPhases; index++)
+  {
+    ADC_Init(ADC_MotorADCs[index], &ADC_InitStructure);
+    ADC_InjectedSequencerLengthConfig(ADC_MotorADCs[index], 1);
+    ADC_InjectedChannelConfig(ADC_MotorADCs[index], ADC_MotorConfig.ADC_Channel[index], 1,
+                              ADC_MotorConfig.ADC_SampleTime);
+    ADC_SetInjectedOffset(ADC_MotorADCs[index], ADC_InjectedChannel_1, 0);
+    ADC_ExternalTrigInjectedConvEdgeConfig(ADC_MotorADCs[index], ADC_ExternalTrigInjecConvEdge_None);
+    ADC_Cmd(ADC_MotorADCs[index], ENABLE);
+  }
+  ADC_ExternalTrigInjectedConvConfig(ADC1, (ADC_MotorConfig.TIMx == TIM1) ?
+                                           ADC_ExternalTrigInjecConv_T1_CC4 :
+                                           ADC_ExternalTrigInjecConv_T8_CC4);
+
+  /* Timer channel 4: compare event at the sampling point ------------------*/
+  TIM_OCStructInit(&TIM_OCInitStructure);
+  TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+  TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+  TIM_OCInitStructure.TIM_Pulse = ADC_MotorConfig.SamplePoint;
+  TIM_OC4Init(ADC_MotorConfig.TIMx, &TIM_OCInitStructure);
+
+  TIM_OC1PreloadConfig(ADC_MotorConfig.TIMx, TIM_OCPreload_Enable);
+  TIM_OC2PreloadConfig(ADC_MotorConfig.TIMx, TIM_OCPreload_Enable);
+  TIM_OC3PreloadConfig(ADC_MotorConfig.TIMx, TIM_OCPreload_Enable);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Measures the offsets of the current channels, and stores them in
+  *         the injected offset registers.
+  * @param  Samples: number of conversions averaged for each channel.
+  * @note   The phase currents must be zero: power stage off. The sampling
+  *         must be stopped.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the offsets are stored
+  *          - ERROR: Samples is 0 or a conversion did not end
+  */
+ErrorStatus ADC_MotorCalibrate(uint16_t Samples)
+{
+  uint32_t sum[3] = {0, 0, 0};
+  uint32_t count = 0, index = 0, timeout = 0;
+
+  if (Samples == 0)
+  {
+    return ERROR;
+  }
+
+  for (index = 0; index < ADC_MotorConfig.NumPhases; index++)
+  {
+    ADC_SetInjectedOffset(ADC_MotorADCs[index], ADC_InjectedChannel_1, 0);
+  }
+
+  for (count = 0; count < Samples; count++)
+  {
+    for (index = 0; index < ADC_MotorConfig.NumPhases; index++)
+    {
+      ADC_ClearFlag(ADC_MotorADCs[index], ADC_FLAG_JEOC);
+    }
+
+    /* The software start of the master starts the slaves */
+    ADC_SoftwareStartInjectedConv(ADC1);
+
+    for (index = 0; index < ADC_MotorConfig.NumPhases; index++)
+    {
+      for (timeout = 0; (ADC_GetFlagStatus(ADC_MotorADCs[index], ADC_FLAG_JEOC) == RESET) &&
+                        (timeout < ADC_MOTOR_TIMEOUT); timeout++)
+      {
+      }
+      if (timeout == ADC_MOTOR_TIMEOUT)
+      {
+        return ERROR;
+      }
+
+      /* Left aligned injected data without offset: 12-bit data << 3 */
+      sum[index] += (uint32_t)(ADC_MotorADCs[index]->JDR1 & 0xFFFF) >> 3;
+    }
+  }
+
+  for (index = 0; index < ADC_MotorConfig.NumPhases; index++)
+  {
+    ADC_SetInjectedOffset(ADC_MotorADCs[index], ADC_InjectedChannel_1,
+                          (uint16_t)((sum[index] + (Samples >> 1)) / Samples));
+    ADC_ClearFlag(ADC_MotorADCs[index], ADC_FLAG_JEOC | ADC_FLAG_JSTRT);
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts the sampling: the conversions follow the timer.
+  * @param  None
+  * @retval None
+  */
+void ADC_MotorStart(void)
+{
+  ADC_ClearITPendingBit(ADC1, ADC_IT_JEOC);
+  ADC_ITConfig(ADC1, ADC_IT_JEOC, ENABLE);
+  ADC_ExternalTrigInjectedConvEdgeConfig(ADC1, ADC_ExternalTrigInjecConvEdge_Rising);
+}
+
+/**
+  * @brief  Stops the sampling.
+  * @param  None
+  * @retval None
+  */
+void ADC_MotorStop(void)
+{
+  ADC_ExternalTrigInjectedConvEdgeConfig(ADC1, ADC_ExternalTrigInjecConvEdge_None);
+  ADC_ITConfig(ADC1, ADC_IT_JEOC, DISABLE);
+}
+
+/**
+  * @brief  Sets the duty cycles of the phases, applied from the next period.
+  * @param  pDuty: the compare values of channels 1, 2 and 3, as computed by
+  *         arm_foc_q31().
+  * @retval None
+  */
+void ADC_MotorSetDuty(const uint32_t* pDuty)
+{
+  TIM_TypeDef* tim = ADC_MotorConfig.TIMx;
+
+  tim->CCR1 = pDuty[0];
+  tim->CCR2 = pDuty[1];
+  tim->CCR3 = pDuty[2];
+}
+
+/**
+  * @brief  Returns the number of periods whose conversions ended before the
+  *         Callback of the previous period returned.
+  * @param  None
+  * @retval The number of overruns since ADC_MotorInit().
+  */
+uint32_t ADC_MotorGetOverruns(void)
+{
+  return ADC_MotorOverruns;
+}
+
+/**
+  * @brief  Reads the phase currents and passes them to the Callback. To be
+  *         called from ADC_IRQHandler.
+  * @param  None
+  * @retval None
+  */
+void ADC_MotorIRQHandler(void)
+{
+  uint32_t index = 0;
+  int32_t current = 0;
+
+  if (ADC_GetITStatus(ADC1, ADC_IT_JEOC) == RESET)
+  {
+    return;
+  }
+  ADC_ClearITPendingBit(ADC1, ADC_IT_JEOC);
+
+  for (index = 0; index < ADC_MotorConfig.NumPhases; index++)
+  {
+    /* Signed 16-bit data: 12-bit difference to the offset << 3 */
+    current = (int32_t)(int16_t)ADC_MotorADCs[index]->JDR1 * 65536;
+    if (ADC_MotorConfig.Inverted != DISABLE)
+    {
+      current = (current == (int32_t)0x80000000) ? 0x7FFFFFFF : -current;
+    }
+    ADC_MotorCurrents[index] = current;
+  }
+
+  ADC_MotorConfig.Callback(ADC_MotorCurrents);
+
+  /* The conversions of the next period already ended */
+  if (ADC_GetFlagStatus(ADC1, ADC_FLAG_JEOC) != RESET)
+  {
+    ADC_MotorOverruns++;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
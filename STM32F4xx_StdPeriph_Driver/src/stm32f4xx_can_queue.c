@@ -0,0 +1,894 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_can_queue.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a queued layer for the CAN, for the buses where
+  *          the 3 frames of the hardware FIFOs and the 3 TX mailboxes are not
+  *          enough:
+  *           - Reception into software rings, one per filter, drained from the
+  *             FIFO message pending interrupts
+  *           - Allocation of the filter banks shared between CAN1 and CAN2
+  *           - Transmission queue sorted by identifier, the frames of higher
+  *             priority taking the mailboxes of the frames of lower priority
+  *           - Frame counts and overrun statistics
+  *          It uses the stm32f4xx_can.c/.h driver.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the CAN and GPIO clocks, configure the CAN pins in
+  *             alternate function and configure the bit timing using CAN_Init(),
+  *             with the automatic retransmission. CAN1 clock must be enabled to
+  *             use CAN2, as the filter banks are in CAN1.
+  *
+  *          2. Call CAN_QueueFilterReset() once, then CAN_QueueInit() with a
+  *             CAN_QueueTypeDef structure and a TX queue for each CAN used.
+  *             Call CAN_QueueTxIRQHandler() from the TX interrupt handler of the
+  *             CAN, CAN_QueueRxIRQHandler() from its RX0 and RX1 interrupt
+  *             handlers, and enable these interrupts using NVIC_Init().
+  *
+  *          3. For each group of identifiers received, give a ring of frames to
+  *             CAN_QueueRingInit() and add a filter using CAN_QueueFilterAdd().
+  *             The frames are read from the ring using CAN_QueueRingRead().
+  *
+  *          4. Transmit the frames using CAN_QueueTransmit().
+  *
+  *          5. Read the statistics using CAN_QueueGetStats().
+  *
+  * @note   Adding or removing a filter may renumber the filters of the same
+  *         CAN, and move the start bank of CAN2. The frames already in the
+  *         hardware FIFOs keep the old filter match index: change the filters
+  *         while the bus is quiet.
+  *
+  * @note   Each ring has one writer, the RX interrupt handler, and one reader,
+  *         the caller of CAN_QueueRingRead(), and needs no lock.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_can_queue.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup CAN
+  * @brief CAN driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Number of filter banks, shared between CAN1 and CAN2 */
+#define CAN_QUEUE_BANKS           ((uint8_t)28)
+
+/* Default start bank of CAN2 */
+#define CAN_QUEUE_START_BANK      ((uint8_t)14)
+
+/* State of the TX mailboxes */
+#define CAN_QUEUE_MAILBOX_FREE     ((uint8_t)0x00)
+#define CAN_QUEUE_MAILBOX_BUSY     ((uint8_t)0x01)
+#define CAN_QUEUE_MAILBOX_ABORTING ((uint8_t)0x02)
+
+#define CAN_QUEUE_NO_MAILBOX       ((uint8_t)0xFF)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Owner of each filter bank: 0 when free, 1 for CAN1, 2 for CAN2 */
+static uint8_t CAN_QueueBankOwner[CAN_QUEUE_BANKS];
+
+/* FIFO assignment of each filter bank */
+static uint8_t CAN_QueueBankFIFO[CAN_QUEUE_BANKS];
+
+/* Ring of each filter bank */
+static CAN_QueueRingTypeDef* CAN_QueueBankRing[CAN_QUEUE_BANKS];
+
+/* First filter bank of CAN2 */
+static uint8_t CAN_QueueStartBank = CAN_QUEUE_START_BANK;
+
+/* Queues of CAN1 and CAN2 */
+static CAN_QueueTypeDef* CAN_QueueQueues[2];
+
+static const uint32_t CAN_QueueRQCP[3] =
+{
+  CAN_TSR_RQCP0, CAN_TSR_RQCP1, CAN_TSR_RQCP2
+};
+
+static const uint32_t CAN_QueueTXOK[3] =
+{
+  CAN_TSR_TXOK0, CAN_TSR_TXOK1, CAN_TSR_TXOK2
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t CAN_QueueKey(const CanTxMsg* TxMessage);
+static uint8_t CAN_QueueBefore(const CAN_QueueTxEntryTypeDef* Entry1, const CAN_QueueTxEntryTypeDef* Entry2);
+static void CAN_QueuePush(CAN_QueueTypeDef* Queue, const CAN_QueueTxEntryTypeDef* Entry);
+static void CAN_QueuePop(CAN_QueueTypeDef* Queue, CAN_QueueTxEntryTypeDef* Entry);
+static void CAN_QueueService(CAN_QueueTypeDef* Queue);
+static void CAN_QueueBankConfig(uint8_t Bank, uint32_t Id, uint32_t Mask, uint8_t FIFONumber, FunctionalState NewState);
+static void CAN_QueueSplitBanks(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup CAN_Private_Functions
+  * @{
+  */
+
+/** @defgroup CAN_Group7 CAN queued functions
+ *  @brief   CAN queued functions
+ *
+@verbatim
+ ===============================================================================
+                         CAN queued functions
+ ===============================================================================
+
+  This subsection provides functions allowing to receive and transmit CAN
+  frames through software queues, sized by the application.
+
+  Reception: each filter of this driver is one filter bank in 32-bit identifier
+  mask mode, and owns one ring. The hardware gives the filter match index (FMI)
+  of each frame: the index of the filter among the filters of the same CAN and
+  FIFO, counted in the order of the banks, active or not. The RX interrupt
+  handler drains the FIFO and stores each frame into the ring of its FMI, using
+  a table rebuilt each time a filter is added or removed.
+
+  Filter banks: the 28 banks are split between CAN1, from bank 0 up, and CAN2,
+  from bank 27 down. The start bank of CAN2 is moved using CAN_SlaveStartBank()
+  to the first bank of CAN2, so that either CAN can use all the banks the other
+  one leaves free.
+
+  Transmission: the frames wait in a heap sorted by arbitration field, the
+  lowest first, then by order of submission. The mailboxes are loaded with the
+  first frames of the heap, and transmitted by the CAN in identifier order.
+  When all the mailboxes are busy and the first frame of the heap has a higher
+  priority than a frame in a mailbox, the transmission of the frame of lowest
+  priority is aborted and this frame goes back to the heap. A frame is not
+  loaded while a frame with the same identifier is in a mailbox, so that the
+  frames of one identifier are sent in order.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Deactivates all the filter banks and gives half of them to each CAN.
+  * @note   This function must be called once before CAN_QueueInit().
+  * @param  None
+  * @retval None
+  */
+void CAN_QueueFilterReset(void)
+{
+  uint8_t bank = 0;
+
+  for (bank = 0; bank < CAN_QUEUE_BANKS; bank++)
+  {
+    CAN_QueueBankOwner[bank] = 0;
+    CAN_QueueBankFIFO[bank] = CAN_FIFO0;
+    CAN_QueueBankRing[bank] = 0;
+    CAN_QueueBankConfig(bank, 0, 0, CAN_FIFO0, DISABLE);
+  }
+
+  CAN_QueueStartBank = CAN_QUEUE_START_BANK;
+  CAN_SlaveStartBank(CAN_QUEUE_START_BANK);
+}
+
+/**
+  * @brief  Initializes the queue of a CAN and enables its interrupts.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @param  CANx: where x can be 1 or 2 to select the CAN peripheral.
+  * @param  TxQueue: storage of the TX queue.
+  * @param  TxQueueSize: number of entries of TxQueue, from 1 to 65535. It
+  *         includes the frames in the TX mailboxes.
+  * @note   The CAN must be initialized using CAN_Init(). The transmit FIFO
+  *         priority is disabled, so that the CAN sends the mailboxes in
+  *         identifier order.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the queue is running
+  *          - ERROR: invalid TX queue
+  */
+ErrorStatus CAN_QueueInit(CAN_QueueTypeDef* Queue, CAN_TypeDef* CANx, CAN_QueueTxEntryTypeDef* TxQueue, uint16_t TxQueueSize)
+{
+  uint32_t primask = 0, index = 0;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_ALL_PERIPH(CANx));
+
+  if ((TxQueue == 0) || (TxQueueSize == 0))
+  {
+    return ERROR;
+  }
+
+  Queue->CANx = CANx;
+  Queue->TxQueue = TxQueue;
+  Queue->TxQueueSize = TxQueueSize;
+  Queue->TxCount = 0;
+  Queue->TxSeq = 0;
+  for (index = 0; index < 3; index++)
+  {
+    Queue->MailboxState[index] = CAN_QUEUE_MAILBOX_FREE;
+  }
+  for (index = 0; index < CAN_QUEUE_BANKS; index++)
+  {
+    Queue->RxRings[0][index] = 0;
+    Queue->RxRings[1][index] = 0;
+  }
+  Queue->Stats.TxFrames = 0;
+  Queue->Stats.TxPreempted = 0;
+  Queue->Stats.TxErrors = 0;
+  Queue->Stats.TxQueueFull = 0;
+  Queue->Stats.RxFrames = 0;
+  Queue->Stats.RxDropped = 0;
+  Queue->Stats.RxUnmatched = 0;
+  Queue->Stats.RxFifoOverruns = 0;
+
+  /* Tables of the rings of the filters already added */
+  primask = NVIC_EnterCritical();
+  CAN_QueueQueues[(CANx == CAN1) ? 0 : 1] = Queue;
+  CAN_QueueSplitBanks();
+  NVIC_ExitCritical(primask);
+
+  /* Mailboxes sent in identifier order */
+  CANx->MCR &= ~CAN_MCR_TXFP;
+
+  CAN_ITConfig(CANx, CAN_IT_TME | CAN_IT_FMP0 | CAN_IT_FMP1 | CAN_IT_FOV0 | CAN_IT_FOV1, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops the queue of a CAN and removes its filters.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @note   The frames in the TX queue and mailboxes are dropped.
+  * @retval None
+  */
+void CAN_QueueDeInit(CAN_QueueTypeDef* Queue)
+{
+  uint32_t primask = 0;
+  uint8_t owner = (Queue->CANx == CAN1) ? 1 : 2;
+  uint8_t index = 0;
+
+  CAN_ITConfig(Queue->CANx, CAN_IT_TME | CAN_IT_FMP0 | CAN_IT_FMP1 | CAN_IT_FOV0 | CAN_IT_FOV1, DISABLE);
+
+  primask = NVIC_EnterCritical();
+
+  for (index = 0; index < 3; index++)
+  {
+    if (Queue->MailboxState[index] != CAN_QUEUE_MAILBOX_FREE)
+    {
+      CAN_CancelTransmit(Queue->CANx, index);
+      Queue->MailboxState[index] = CAN_QUEUE_MAILBOX_FREE;
+    }
+  }
+  Queue->TxCount = 0;
+
+  for (index = 0; index < CAN_QUEUE_BANKS; index++)
+  {
+    if (CAN_QueueBankOwner[index] == owner)
+    {
+      CAN_QueueBankOwner[index] = 0;
+      CAN_QueueBankFIFO[index] = CAN_FIFO0;
+      CAN_QueueBankRing[index] = 0;
+      CAN_QueueBankConfig(index, 0, 0, CAN_FIFO0, DISABLE);
+    }
+  }
+  CAN_QueueQueues[owner - 1] = 0;
+  CAN_QueueSplitBanks();
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Initializes a ring of received frames.
+  * @param  Ring: pointer to the CAN_QueueRingTypeDef structure of the ring.
+  * @param  Buffer: storage of the frames.
+  * @param  Size: number of frames of Buffer, a power of 2 from 1 to 32768.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the ring is empty
+  *          - ERROR: Size is not a power of 2
+  */
+ErrorStatus CAN_QueueRingInit(CAN_QueueRingTypeDef* Ring, CanRxMsg* Buffer, uint16_t Size)
+{
+  if ((Buffer == 0) || (Size == 0) || ((Size & (Size - 1)) != 0))
+  {
+    return ERROR;
+  }
+
+  Ring->Buffer = Buffer;
+  Ring->Size = Size;
+  Ring->Head = 0;
+  Ring->Tail = 0;
+  Ring->Overruns = 0;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the number of frames waiting in a ring.
+  * @param  Ring: pointer to the CAN_QueueRingTypeDef structure of the ring.
+  * @retval The number of frames.
+  */
+uint16_t CAN_QueueRingCount(CAN_QueueRingTypeDef* Ring)
+{
+  return (uint16_t)(Ring->Head - Ring->Tail);
+}
+
+/**
+  * @brief  Reads the oldest frame of a ring.
+  * @param  Ring: pointer to the CAN_QueueRingTypeDef structure of the ring.
+  * @param  RxMessage: pointer to a structure receiving the frame.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: a frame was read
+  *          - ERROR: the ring is empty
+  */
+ErrorStatus CAN_QueueRingRead(CAN_QueueRingTypeDef* Ring, CanRxMsg* RxMessage)
+{
+  uint16_t tail = Ring->Tail;
+
+  if (tail == Ring->Head)
+  {
+    return ERROR;
+  }
+
+  *RxMessage = Ring->Buffer[tail & (Ring->Size - 1)];
+
+  /* The frame is copied before its slot is given back to the writer */
+  __DMB();
+  Ring->Tail = (uint16_t)(tail + 1);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Adds a filter to a CAN, on a free filter bank.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @param  Id: identifier of the frames received, standard or extended.
+  * @param  Mask: bits of Id compared, the other bits are ignored.
+  * @param  IDE: type of identifier of Id.
+  *          This parameter can be CAN_Id_Standard or CAN_Id_Extended.
+  * @param  FIFONumber: FIFO of the frames, CAN_FIFO0 or CAN_FIFO1.
+  * @param  Ring: ring receiving the frames, initialized by CAN_QueueRingInit().
+  * @note   The remote and data frames are both received.
+  * @retval The filter bank used, or CAN_QUEUE_NO_BANK when no bank is free for
+  *         this CAN.
+  */
+uint8_t CAN_QueueFilterAdd(CAN_QueueTypeDef* Queue, uint32_t Id, uint32_t Mask, uint32_t IDE, uint8_t FIFONumber, CAN_QueueRingTypeDef* Ring)
+{
+  uint32_t primask = 0, id = 0, mask = 0;
+  uint8_t owner = (Queue->CANx == CAN1) ? 1 : 2;
+  uint8_t bank = 0, first2 = CAN_QUEUE_BANKS, last1 = 0, found = CAN_QUEUE_NO_BANK;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_IDTYPE(IDE));
+  assert_param(IS_CAN_FIFO(FIFONumber));
+
+  /* Filter register layout: STID in bits 31:21 or EXID in bits 31:3, IDE in
+     bit 2. IDE is always compared. */
+  if (IDE == CAN_Id_Standard)
+  {
+    id = (Id & 0x7FF) << 21;
+    mask = ((Mask & 0x7FF) << 21) | CAN_Id_Extended;
+  }
+  else
+  {
+    id = ((Id & 0x1FFFFFFF) << 3) | CAN_Id_Extended;
+    mask = ((Mask & 0x1FFFFFFF) << 3) | CAN_Id_Extended;
+  }
+
+  primask = NVIC_EnterCritical();
+
+  /* CAN1 banks from 0 up, below the first bank of CAN2; CAN2 banks from 27
+     down, above the last bank of CAN1 */
+  for (bank = 0; bank < CAN_QUEUE_BANKS; bank++)
+  {
+    if (CAN_QueueBankOwner[bank] == 1)
+    {
+      last1 = bank + 1;
+    }
+    else if ((CAN_QueueBankOwner[bank] == 2) && (first2 == CAN_QUEUE_BANKS))
+    {
+      first2 = bank;
+    }
+  }
+
+  if (owner == 1)
+  {
+    for (bank = 0; (bank < first2) && (bank < CAN_QUEUE_BANKS - 1); bank++)
+    {
+      if (CAN_QueueBankOwner[bank] == 0)
+      {
+        found = bank;
+        break;
+      }
+    }
+  }
+  else
+  {
+    for (bank = CAN_QUEUE_BANKS - 1; (bank >= last1) && (bank >= 1); bank--)
+    {
+      if (CAN_QueueBankOwner[bank] == 0)
+      {
+        found = bank;
+        break;
+      }
+    }
+  }
+
+  if (found != CAN_QUEUE_NO_BANK)
+  {
+    CAN_QueueBankOwner[found] = owner;
+    CAN_QueueBankFIFO[found] = FIFONumber;
+    CAN_QueueBankRing[found] = Ring;
+    CAN_QueueBankConfig(found, id, mask, FIFONumber, ENABLE);
+    CAN_QueueSplitBanks();
+  }
+
+  NVIC_ExitCritical(primask);
+
+  return found;
+}
+
+/**
+  * @brief  Removes a filter and frees its filter bank.
+  * @param  Bank: filter bank returned by CAN_QueueFilterAdd().
+  * @retval None
+  */
+void CAN_QueueFilterRemove(uint8_t Bank)
+{
+  uint32_t primask = 0;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_FILTER_NUMBER(Bank));
+
+  primask = NVIC_EnterCritical();
+
+  CAN_QueueBankOwner[Bank] = 0;
+  CAN_QueueBankFIFO[Bank] = CAN_FIFO0;
+  CAN_QueueBankRing[Bank] = 0;
+  CAN_QueueBankConfig(Bank, 0, 0, CAN_FIFO0, DISABLE);
+  CAN_QueueSplitBanks();
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Queues a frame for transmission.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @param  TxMessage: pointer to the frame, copied into the TX queue.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the frame is queued
+  *          - ERROR: the TX queue is full
+  */
+ErrorStatus CAN_QueueTransmit(CAN_QueueTypeDef* Queue, CanTxMsg* TxMessage)
+{
+  CAN_QueueTxEntryTypeDef entry;
+  uint32_t primask = 0, used = 0, index = 0;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_IDTYPE(TxMessage->IDE));
+  assert_param(IS_CAN_RTR(TxMessage->RTR));
+  assert_param(IS_CAN_DLC(TxMessage->DLC));
+
+  entry.Msg = *TxMessage;
+  entry.Key = CAN_QueueKey(TxMessage);
+
+  primask = NVIC_EnterCritical();
+
+  /* A frame of a mailbox goes back to the heap when it is preempted: keep an
+     entry for each busy mailbox */
+  used = Queue->TxCount;
+  for (index = 0; index < 3; index++)
+  {
+    if (Queue->MailboxState[index] != CAN_QUEUE_MAILBOX_FREE)
+    {
+      used++;
+    }
+  }
+
+  if (used >= Queue->TxQueueSize)
+  {
+    Queue->Stats.TxQueueFull++;
+    NVIC_ExitCritical(primask);
+    return ERROR;
+  }
+
+  entry.Seq = Queue->TxSeq++;
+  CAN_QueuePush(Queue, &entry);
+  CAN_QueueService(Queue);
+
+  NVIC_ExitCritical(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the statistics of the queue of a CAN.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @param  Stats: pointer to a CAN_QueueStatsTypeDef structure receiving the
+  *         statistics.
+  * @retval None
+  */
+void CAN_QueueGetStats(CAN_QueueTypeDef* Queue, CAN_QueueStatsTypeDef* Stats)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  *Stats = Queue->Stats;
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Handles the TX interrupt of a CAN: completes the mailboxes and loads
+  *         them with the next frames.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @retval None
+  */
+void CAN_QueueTxIRQHandler(CAN_QueueTypeDef* Queue)
+{
+  CAN_QueueService(Queue);
+}
+
+/**
+  * @brief  Handles the RX0 or RX1 interrupt of a CAN: moves the frames of the
+  *         FIFO into the rings of their filters.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @param  FIFONumber: CAN_FIFO0 or CAN_FIFO1.
+  * @retval None
+  */
+void CAN_QueueRxIRQHandler(CAN_QueueTypeDef* Queue, uint8_t FIFONumber)
+{
+  CanRxMsg message;
+  CAN_QueueRingTypeDef* ring = 0;
+  uint32_t overrun = (FIFONumber == CAN_FIFO0) ? CAN_FLAG_FOV0 : CAN_FLAG_FOV1;
+  uint16_t head = 0;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_FIFO(FIFONumber));
+
+  if (CAN_GetFlagStatus(Queue->CANx, overrun) != RESET)
+  {
+    Queue->Stats.RxFifoOverruns++;
+    CAN_ClearFlag(Queue->CANx, overrun);
+  }
+
+  while (CAN_MessagePending(Queue->CANx, FIFONumber) != 0)
+  {
+    CAN_Receive(Queue->CANx, FIFONumber, &message);
+    Queue->Stats.RxFrames++;
+
+    ring = (message.FMI < CAN_QUEUE_BANKS) ? Queue->RxRings[FIFONumber][message.FMI] : 0;
+    if (ring == 0)
+    {
+      Queue->Stats.RxUnmatched++;
+      continue;
+    }
+
+    head = ring->Head;
+    if ((uint16_t)(head - ring->Tail) >= ring->Size)
+    {
+      ring->Overruns++;
+      Queue->Stats.RxDropped++;
+      continue;
+    }
+
+    ring->Buffer[head & (ring->Size - 1)] = message;
+
+    /* The frame is written before it is given to the reader */
+    __DMB();
+    ring->Head = (uint16_t)(head + 1);
+  }
+}
+
+/**
+  * @brief  Returns the arbitration field of a frame as a 32-bit key: the frame
+  *         with the lowest key wins the arbitration.
+  * @param  TxMessage: pointer to the frame.
+  * @retval The key: base identifier in bits 31:21, RTR (standard) or SRR
+  *         (extended) in bit 20, IDE in bit 19, extended identifier in bits
+  *         18:1 and RTR (extended) in bit 0.
+  */
+static uint32_t CAN_QueueKey(const CanTxMsg* TxMessage)
+{
+  uint32_t rtr = (TxMessage->RTR != CAN_RTR_Data) ? 1 : 0;
+
+  if (TxMessage->IDE == CAN_Id_Standard)
+  {
+    return ((TxMessage->StdId & 0x7FF) << 21) | (rtr << 20);
+  }
+
+  return ((TxMessage->ExtId & 0x1FFC0000) << 3) | ((uint32_t)3 << 19) |
+         ((TxMessage->ExtId & 0x0003FFFF) << 1) | rtr;
+}
+
+/**
+  * @brief  Compares two entries of the TX queue.
+  * @param  Entry1: pointer to the first entry.
+  * @param  Entry2: pointer to the second entry.
+  * @retval 1 if Entry1 must be sent before Entry2, 0 otherwise.
+  */
+static uint8_t CAN_QueueBefore(const CAN_QueueTxEntryTypeDef* Entry1, const CAN_QueueTxEntryTypeDef* Entry2)
+{
+  if (Entry1->Key != Entry2->Key)
+  {
+    return (Entry1->Key < Entry2->Key) ? 1 : 0;
+  }
+
+  return ((int32_t)(Entry1->Seq - Entry2->Seq) < 0) ? 1 : 0;
+}
+
+/**
+  * @brief  Inserts an entry into the heap of the TX queue.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @param  Entry: pointer to the entry, copied.
+  * @retval None
+  */
+static void CAN_QueuePush(CAN_QueueTypeDef* Queue, const CAN_QueueTxEntryTypeDef* Entry)
+{
+  uint32_t index = Queue->TxCount++, parent = 0;
+
+  while (index > 0)
+  {
+    parent = (index - 1) / 2;
+    if (CAN_QueueBefore(Entry, &Queue->TxQueue[parent]) == 0)
+    {
+      break;
+    }
+    Queue->TxQueue[index] = Queue->TxQueue[parent];
+    index = parent;
+  }
+  Queue->TxQueue[index] = *Entry;
+}
+
+/**
+  * @brief  Removes the first entry of the heap of the TX queue.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @param  Entry: pointer to a structure receiving the entry.
+  * @retval None
+  */
+static void CAN_QueuePop(CAN_QueueTypeDef* Queue, CAN_QueueTxEntryTypeDef* Entry)
+{
+  CAN_QueueTxEntryTypeDef* last = 0;
+  uint32_t index = 0, child = 0, count = 0;
+
+  *Entry = Queue->TxQueue[0];
+  count = --Queue->TxCount;
+  last = &Queue->TxQueue[count];
+
+  while ((child = (2 * index) + 1) < count)
+  {
+    if (((child + 1) < count) && (CAN_QueueBefore(&Queue->TxQueue[child + 1], &Queue->TxQueue[child]) != 0))
+    {
+      child++;
+    }
+    if (CAN_QueueBefore(&Queue->TxQueue[child], last) == 0)
+    {
+      break;
+    }
+    Queue->TxQueue[index] = Queue->TxQueue[child];
+    index = child;
+  }
+  Queue->TxQueue[index] = *last;
+}
+
+/**
+  * @brief  Completes the TX mailboxes, then loads the free ones with the first
+  *         frames of the heap, or preempts the mailbox of lowest priority.
+  * @note   This function is called with the interrupts disabled or from the TX
+  *         interrupt handler.
+  * @param  Queue: pointer to the CAN_QueueTypeDef structure of the CAN.
+  * @retval None
+  */
+static void CAN_QueueService(CAN_QueueTypeDef* Queue)
+{
+  CAN_QueueTxEntryTypeDef entry;
+  uint32_t tsr = Queue->CANx->TSR;
+  uint8_t mailbox = 0, lowest = CAN_QUEUE_NO_MAILBOX;
+
+  /* Completed mailboxes: the frames taken back go to the heap again */
+  for (mailbox = 0; mailbox < 3; mailbox++)
+  {
+    if ((tsr & CAN_QueueRQCP[mailbox]) == 0)
+    {
+      continue;
+    }
+
+    /* Writing RQCP clears TXOK, ALST and TERR too */
+    Queue->CANx->TSR = CAN_QueueRQCP[mailbox];
+
+    if (Queue->MailboxState[mailbox] == CAN_QUEUE_MAILBOX_FREE)
+    {
+      continue;
+    }
+    if ((tsr & CAN_QueueTXOK[mailbox]) != 0)
+    {
+      Queue->Stats.TxFrames++;
+    }
+    else if (Queue->MailboxState[mailbox] == CAN_QUEUE_MAILBOX_ABORTING)
+    {
+      Queue->Stats.TxPreempted++;
+      CAN_QueuePush(Queue, &Queue->Mailbox[mailbox]);
+    }
+    else
+    {
+      Queue->Stats.TxErrors++;
+    }
+    Queue->MailboxState[mailbox] = CAN_QUEUE_MAILBOX_FREE;
+  }
+
+  while (Queue->TxCount != 0)
+  {
+    lowest = CAN_QUEUE_NO_MAILBOX;
+    for (mailbox = 0; mailbox < 3; mailbox++)
+    {
+      if (Queue->MailboxState[mailbox] == CAN_QUEUE_MAILBOX_FREE)
+      {
+        continue;
+      }
+      /* Frames of one identifier in order */
+      if (Queue->Mailbox[mailbox].Key == Queue->TxQueue[0].Key)
+      {
+        return;
+      }
+      if ((Queue->MailboxState[mailbox] == CAN_QUEUE_MAILBOX_BUSY) &&
+          ((lowest == CAN_QUEUE_NO_MAILBOX) ||
+           (CAN_QueueBefore(&Queue->Mailbox[lowest], &Queue->Mailbox[mailbox]) != 0)))
+      {
+        lowest = mailbox;
+      }
+    }
+
+    if ((Queue->CANx->TSR & (CAN_TSR_TME0 | CAN_TSR_TME1 | CAN_TSR_TME2)) == 0)
+    {
+      /* No free mailbox: abort the frame of lowest priority if the first frame
+         of the heap wins over it. Its RQCP interrupt brings it back. */
+      if ((lowest != CAN_QUEUE_NO_MAILBOX) &&
+          (CAN_QueueBefore(&Queue->TxQueue[0], &Queue->Mailbox[lowest]) != 0))
+      {
+        Queue->MailboxState[lowest] = CAN_QUEUE_MAILBOX_ABORTING;
+        CAN_CancelTransmit(Queue->CANx, lowest);
+      }
+      return;
+    }
+
+    CAN_QueuePop(Queue, &entry);
+    mailbox = CAN_Transmit(Queue->CANx, &entry.Msg);
+    Queue->Mailbox[mailbox] = entry;
+    Queue->MailboxState[mailbox] = CAN_QUEUE_MAILBOX_BUSY;
+  }
+}
+
+/**
+  * @brief  Configures a filter bank in 32-bit identifier mask mode.
+  * @param  Bank: filter bank, from 0 to 27.
+  * @param  Id: filter register value of the identifier.
+  * @param  Mask: filter register value of the mask.
+  * @param  FIFONumber: FIFO assigned to the bank.
+  * @param  NewState: activation of the bank.
+  * @retval None
+  */
+static void CAN_QueueBankConfig(uint8_t Bank, uint32_t Id, uint32_t Mask, uint8_t FIFONumber, FunctionalState NewState)
+{
+  CAN_FilterInitTypeDef CAN_FilterInitStructure;
+
+  CAN_FilterInitStructure.CAN_FilterNumber = Bank;
+  CAN_FilterInitStructure.CAN_FilterMode = CAN_FilterMode_IdMask;
+  CAN_FilterInitStructure.CAN_FilterScale = CAN_FilterScale_32bit;
+  CAN_FilterInitStructure.CAN_FilterIdHigh = (uint16_t)(Id >> 16);
+  CAN_FilterInitStructure.CAN_FilterIdLow = (uint16_t)Id;
+  CAN_FilterInitStructure.CAN_FilterMaskIdHigh = (uint16_t)(Mask >> 16);
+  CAN_FilterInitStructure.CAN_FilterMaskIdLow = (uint16_t)Mask;
+  CAN_FilterInitStructure.CAN_FilterFIFOAssignment = FIFONumber;
+  CAN_FilterInitStructure.CAN_FilterActivation = NewState;
+  CAN_FilterInit(&CAN_FilterInitStructure);
+}
+
+/**
+  * @brief  Moves the start bank of CAN2 to its first bank and rebuilds the
+  *         tables of the rings of both CANs.
+  * @note   All the banks are one filter, so that the filter match index of a
+  *         bank is the number of banks of the same CAN and FIFO before it.
+  * @param  None
+  * @retval None
+  */
+static void CAN_QueueSplitBanks(void)
+{
+  CAN_QueueTypeDef* queue = 0;
+  uint8_t bank = 0, first2 = CAN_QUEUE_BANKS, last1 = 0, start = 0, side = 0;
+  uint8_t fmi[2];
+
+  for (bank = 0; bank < CAN_QUEUE_BANKS; bank++)
+  {
+    if (CAN_QueueBankOwner[bank] == 1)
+    {
+      last1 = bank + 1;
+    }
+    else if ((CAN_QueueBankOwner[bank] == 2) && (first2 == CAN_QUEUE_BANKS))
+    {
+      first2 = bank;
+    }
+  }
+
+  if (first2 != CAN_QUEUE_BANKS)
+  {
+    start = first2;
+  }
+  else
+  {
+    start = (last1 > CAN_QUEUE_START_BANK) ? last1 : CAN_QUEUE_START_BANK;
+  }
+
+  if (start != CAN_QueueStartBank)
+  {
+    CAN_QueueStartBank = start;
+    CAN_SlaveStartBank(start);
+  }
+
+  for (side = 0; side < 2; side++)
+  {
+    queue = CAN_QueueQueues[side];
+    if (queue == 0)
+    {
+      continue;
+    }
+
+    for (bank = 0; bank < CAN_QUEUE_BANKS; bank++)
+    {
+      queue->RxRings[0][bank] = 0;
+      queue->RxRings[1][bank] = 0;
+    }
+
+    fmi[0] = 0;
+    fmi[1] = 0;
+    for (bank = (side == 0) ? 0 : start; bank < ((side == 0) ? start : CAN_QUEUE_BANKS); bank++)
+    {
+      if (CAN_QueueBankOwner[bank] == (side + 1))
+      {
+        queue->RxRings[CAN_QueueBankFIFO[bank]][fmi[CAN_QueueBankFIFO[bank]]] = CAN_QueueBankRing[bank];
+      }
+      fmi[CAN_QueueBankFIFO[bank]]++;
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,756 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_can_tt.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a time-triggered schedule for the bxCAN, in the
+  *          manner of TTCAN level 1:
+  *           - Cycles started by a reference message, sent by the time master
+  *             and received by the other nodes
+  *           - Schedule matrix of frame slots, each at an offset of the basic
+  *             cycle and repeated every 1, 2, 4, ... basic cycles
+  *           - Frames loaded into the mailboxes ahead of their slot, the slot
+  *             only setting the transmission request
+  *           - Jitter of each slot measured by the time stamps of the time
+  *             triggered communication mode
+  *          It uses the stm32f4xx_can.c/.h and stm32f4xx_tim_wheel.c/.h
+  *          drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Initialize the CAN using CAN_Init() and TIM_WheelInit(). Enable
+  *             the TX interrupt and the RX interrupt of the FIFO of the
+  *             reference message in the NVIC, and call CAN_TTTxIRQHandler() and
+  *             CAN_TTRxIRQHandler() from their handlers.
+  *
+  *          2. Fill the table of CAN_TTSlotTypeDef structures of the frames of
+  *             the node, sorted by offset, and a CAN_TTInitTypeDef structure,
+  *             then call CAN_TTInit(): it enables the time triggered
+  *             communication mode with CAN_TTComModeCmd() and the filter of the
+  *             reference message.
+  *
+  *          3. Call CAN_TTStart(). The time master sends the reference message
+  *             every CycleTime; the other nodes follow its reference messages.
+  *
+  *          4. Change the data of a frame using CAN_TTSlotUpdate(), for example
+  *             from the control loop: the new data go out at the next slot of
+  *             the frame.
+  *
+  *          5. Read the jitter of each slot in its Min and Max members, and the
+  *             statistics of the schedule using CAN_TTGetStats().
+  *
+  * @note   The schedule owns the three TX mailboxes of its CAN: frames are not
+  *         sent with CAN_Transmit() or CAN_QueueTransmit() meanwhile. The
+  *         other FIFO remains available, for example to CAN_QueueRxIRQHandler().
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_can_tt.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup CAN
+  * @brief CAN driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Mailbox status bits of TSR, mailbox 1 and 2 being 8 and 16 bits above */
+#define CAN_TT_TSR_SHIFT(MAILBOX)   ((uint32_t)(MAILBOX) * 8)
+
+/* Time stamp of TDTxR and RDTxR */
+#define CAN_TT_TIME_SHIFT           16
+
+/* Mailbox of a frame of the previous cycle being aborted */
+#define CAN_TT_STALE                ((uint16_t)0x8000)
+
+/* Private macro -------------------------------------------------------------*/
+#define IS_CAN_TT_POWER_OF_2(N)     (((N) != 0) && (((N) & ((N) - 1)) == 0))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t CAN_TTNextSlot(CAN_TTTypeDef* TT, uint16_t Slot);
+static void CAN_TTLoad(CAN_TTTypeDef* TT, uint8_t Mailbox, const CanTxMsg* Msg);
+static void CAN_TTSync(CAN_TTTypeDef* TT, uint8_t Cycle, uint16_t Stamp);
+static void CAN_TTStartSlotTimer(CAN_TTTypeDef* TT);
+static void CAN_TTSlotExpired(TIM_TimerTypeDef* Timer);
+static void CAN_TTRefExpired(TIM_TimerTypeDef* Timer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup CAN_Private_Functions
+  * @{
+  */
+
+/** @defgroup CAN_Group8 CAN time-triggered functions
+ *  @brief   CAN time-triggered functions
+ *
+@verbatim
+ ===============================================================================
+                        CAN time-triggered functions
+ ===============================================================================
+
+  This subsection provides functions allowing to send periodic frames at fixed
+  offsets of a cycle common to all the nodes of the bus.
+
+  The cycle starts at the end of the reference message: the time master takes
+  it from the Transmission Complete interrupt of its mailbox 2, the other
+  nodes from the interrupt of the FIFO which receives it, so that all the
+  nodes see the same event. The number of the basic cycle is the first data
+  byte of the reference message.
+
+  The bxCAN starts a transmission as soon as its request is set: it cannot
+  wait for a time. The frames of the next slots are thus written into the
+  mailboxes 0 and 1 ahead of their slot, from the Transmission Complete
+  interrupt of the previous frame of the mailbox, and the software timer of
+  the slot only sets the transmission request, one register write. The
+  jitter of a slot is the jitter of the timer interrupt, not of the code
+  which builds the frame.
+
+  In the time triggered communication mode, the bxCAN stamps the start of
+  frame of each frame sent or received with its 16-bit counter of CAN bit
+  times. The time between the start of frame of the reference message and of
+  each frame of the node, in bit times, is the position of the slot on the
+  bus: its spread, Max - Min, is the jitter of the slot, arbitration delays
+  included, measured without CPU time.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a time-triggered schedule.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @param  CAN_TTInitStruct: pointer to a CAN_TTInitTypeDef structure that
+  *         contains the configuration of the schedule.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the schedule is ready to start
+  *          - ERROR: invalid schedule, or the CAN did not enter the
+  *            initialization mode
+  */
+ErrorStatus CAN_TTInit(CAN_TTTypeDef* TT, const CAN_TTInitTypeDef* CAN_TTInitStruct)
+{
+  CAN_FilterInitTypeDef CAN_FilterInitStructure;
+  const CAN_TTSlotTypeDef* slot;
+  CAN_TypeDef* can = CAN_TTInitStruct->CANx;
+  uint32_t id = 0, mask = 0;
+  uint16_t index = 0;
+
+  /* Check the parameters */
+  assert_param(IS_CAN_ALL_PERIPH(can));
+  assert_param(IS_CAN_IDTYPE(CAN_TTInitStruct->RefIDE));
+  assert_param(IS_CAN_FIFO(CAN_TTInitStruct->RefFIFO));
+
+  if ((CAN_TTInitStruct->CycleTime == 0) || (CAN_TTInitStruct->CycleTime > TIM_WHEEL_MAX_DELAY) ||
+      !IS_CAN_TT_POWER_OF_2(CAN_TTInitStruct->CycleCount) ||
+      (CAN_TTInitStruct->CycleCount > CAN_TT_MAX_CYCLES) || (CAN_TTInitStruct->RefFilterNumber > 27) ||
+      (CAN_TTInitStruct->SlotCount >= CAN_TT_STALE) ||
+      ((CAN_TTInitStruct->SlotCount != 0) && (CAN_TTInitStruct->Slots == 0)))
+  {
+    return ERROR;
+  }
+
+  for (index = 0; index < CAN_TTInitStruct->SlotCount; index++)
+  {
+    slot = &CAN_TTInitStruct->Slots[index];
+    if (!IS_CAN_TT_POWER_OF_2(slot->Repeat) || (slot->Repeat > CAN_TTInitStruct->CycleCount) ||
+        (slot->BaseCycle >= slot->Repeat) || (slot->Offset >= CAN_TTInitStruct->CycleTime) ||
+        (slot->Msg.DLC > 8) ||
+        ((index != 0) && (slot->Offset <= CAN_TTInitStruct->Slots[index - 1].Offset)))
+    {
+      return ERROR;
+    }
+  }
+
+  TT->Init = *CAN_TTInitStruct;
+  TT->Base = 0;
+  TT->RefStamp = 0;
+  TT->Cycle = 0;
+  TT->Running = 0;
+  TT->Next = CAN_TT_NO_SLOT;
+  TT->Preload = CAN_TT_NO_SLOT;
+  TT->Mailbox[0] = CAN_TT_NO_SLOT;
+  TT->Mailbox[1] = CAN_TT_NO_SLOT;
+  TT->Stats.Cycles = 0;
+  TT->Stats.RefErrors = 0;
+  TT->Stats.CycleErrors = 0;
+
+  for (index = 0; index < CAN_TTInitStruct->SlotCount; index++)
+  {
+    CAN_TTSlotResetStats(TT, index);
+  }
+
+  TIM_TimerInit(&TT->SlotTimer, CAN_TTSlotExpired, TT);
+  TIM_TimerInit(&TT->RefTimer, CAN_TTRefExpired, TT);
+
+  /* The time triggered communication mode is set in initialization mode */
+  if ((can->MCR & CAN_MCR_TTCM) == 0)
+  {
+    if (CAN_OperatingModeRequest(can, CAN_OperatingMode_Initialization) != CAN_ModeStatus_Success)
+    {
+      return ERROR;
+    }
+    CAN_TTComModeCmd(can, ENABLE);
+    if (CAN_OperatingModeRequest(can, CAN_OperatingMode_Normal) != CAN_ModeStatus_Success)
+    {
+      return ERROR;
+    }
+  }
+
+  /* Filter of the reference message: STID in bits 31:21 or EXID in bits 31:3,
+     IDE in bit 2 */
+  if (CAN_TTInitStruct->RefIDE == CAN_Id_Standard)
+  {
+    id = (CAN_TTInitStruct->RefId & 0x7FF) << 21;
+    mask = (0x7FF << 21) | CAN_Id_Extended;
+  }
+  else
+  {
+    id = ((CAN_TTInitStruct->RefId & 0x1FFFFFFF) << 3) | CAN_Id_Extended;
+    mask = (0x1FFFFFFF << 3) | CAN_Id_Extended;
+  }
+  CAN_FilterInitStructure.CAN_FilterNumber = CAN_TTInitStruct->RefFilterNumber;
+  CAN_FilterInitStructure.CAN_FilterMode = CAN_FilterMode_IdMask;
+  CAN_FilterInitStructure.CAN_FilterScale = CAN_FilterScale_32bit;
+  CAN_FilterInitStructure.CAN_FilterIdHigh = (uint16_t)(id >> 16);
+  CAN_FilterInitStructure.CAN_FilterIdLow = (uint16_t)id;
+  CAN_FilterInitStructure.CAN_FilterMaskIdHigh = (uint16_t)(mask >> 16);
+  CAN_FilterInitStructure.CAN_FilterMaskIdLow = (uint16_t)mask;
+  CAN_FilterInitStructure.CAN_FilterFIFOAssignment = CAN_TTInitStruct->RefFIFO;
+  CAN_FilterInitStructure.CAN_FilterActivation = ENABLE;
+  CAN_FilterInit(&CAN_FilterInitStructure);
+
+  CAN_ITConfig(can, CAN_IT_TME | ((CAN_TTInitStruct->RefFIFO == CAN_FIFO0) ? CAN_IT_FMP0 : CAN_IT_FMP1),
+               ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts a time-triggered schedule.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @note   The time master sends its first reference message at once, with the
+  *         basic cycle 0. The other nodes wait for a reference message.
+  * @retval None
+  */
+void CAN_TTStart(CAN_TTTypeDef* TT)
+{
+  CanTxMsg ref;
+  uint32_t primask = NVIC_EnterCritical();
+
+  TT->Running = 1;
+
+  if (TT->Init.Master != DISABLE)
+  {
+    ref.StdId = TT->Init.RefId;
+    ref.ExtId = TT->Init.RefId;
+    ref.IDE = (uint8_t)TT->Init.RefIDE;
+    ref.RTR = CAN_RTR_Data;
+    ref.DLC = 1;
+    ref.Data[0] = 0;
+    CAN_TTLoad(TT, CAN_TT_REF_MAILBOX, &ref);
+    (void)TIM_TimerStart(&TT->RefTimer, 1, TT->Init.CycleTime);
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Stops a time-triggered schedule: the frames waiting in the mailboxes
+  *         are aborted.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @retval None
+  */
+void CAN_TTStop(CAN_TTTypeDef* TT)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  TT->Running = 0;
+  TIM_TimerStop(&TT->SlotTimer);
+  TIM_TimerStop(&TT->RefTimer);
+  TT->Init.CANx->TSR = CAN_TSR_ABRQ0 | CAN_TSR_ABRQ1 | CAN_TSR_ABRQ2;
+  TT->Next = CAN_TT_NO_SLOT;
+  TT->Preload = CAN_TT_NO_SLOT;
+  TT->Mailbox[0] = CAN_TT_NO_SLOT;
+  TT->Mailbox[1] = CAN_TT_NO_SLOT;
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Changes the data of the frame of a slot.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @param  Slot: index of the slot in Slots.
+  * @param  Data: the new data.
+  * @param  DLC: number of data bytes, from 0 to 8.
+  * @note   A frame already loaded into a mailbox is updated there as long as
+  *         its slot has not come.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the data go out at the next slot of the frame
+  *          - ERROR: invalid slot or length
+  */
+ErrorStatus CAN_TTSlotUpdate(CAN_TTTypeDef* TT, uint16_t Slot, const uint8_t* Data, uint8_t DLC)
+{
+  CanTxMsg* msg;
+  uint32_t primask = 0;
+  uint8_t index = 0;
+
+  if ((Slot >= TT->Init.SlotCount) || (DLC > 8))
+  {
+    return ERROR;
+  }
+
+  msg = &TT->Init.Slots[Slot].Msg;
+
+  primask = NVIC_EnterCritical();
+
+  msg->DLC = DLC;
+  for (index = 0; index < DLC; index++)
+  {
+    msg->Data[index] = Data[index];
+  }
+
+  for (index = 0; index < 2; index++)
+  {
+    if ((TT->Mailbox[index] == Slot) &&
+        ((TT->Init.CANx->sTxMailBox[index].TIR & CAN_TI0R_TXRQ) == 0))
+    {
+      CAN_TTLoad(TT, index, msg);
+    }
+  }
+
+  NVIC_ExitCritical(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Resets the jitter and the counters of a slot.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @param  Slot: index of the slot in Slots.
+  * @retval None
+  */
+void CAN_TTSlotResetStats(CAN_TTTypeDef* TT, uint16_t Slot)
+{
+  CAN_TTSlotTypeDef* slot = &TT->Init.Slots[Slot];
+  uint32_t primask = NVIC_EnterCritical();
+
+  slot->Sent = 0;
+  slot->Missed = 0;
+  slot->Last = 0;
+  slot->Min = 0xFFFF;
+  slot->Max = 0;
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Returns the statistics of a time-triggered schedule.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @param  Stats: pointer to a CAN_TTStatsTypeDef structure which receives the
+  *         statistics.
+  * @retval None
+  */
+void CAN_TTGetStats(CAN_TTTypeDef* TT, CAN_TTStatsTypeDef* Stats)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  *Stats = TT->Stats;
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Handles the Transmission Complete interrupts of the mailboxes.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @note   This function must be called from the TX interrupt handler of the
+  *         CAN.
+  * @retval None
+  */
+void CAN_TTTxIRQHandler(CAN_TTTypeDef* TT)
+{
+  CAN_TypeDef* can = TT->Init.CANx;
+  CAN_TTSlotTypeDef* slot;
+  CanTxMsg ref;
+  uint32_t primask = 0, tsr = 0, ok = 0;
+  uint16_t delta = 0;
+  uint8_t mailbox = 0;
+
+  primask = NVIC_EnterCritical();
+
+  tsr = can->TSR;
+  for (mailbox = 0; mailbox < 3; mailbox++)
+  {
+    if ((tsr & (CAN_TSR_RQCP0 << CAN_TT_TSR_SHIFT(mailbox))) == 0)
+    {
+      continue;
+    }
+
+    /* Writing RQCP clears RQCP, TXOK, ALST and TERR */
+    ok = tsr & (CAN_TSR_TXOK0 << CAN_TT_TSR_SHIFT(mailbox));
+    can->TSR = CAN_TSR_RQCP0 << CAN_TT_TSR_SHIFT(mailbox);
+
+    if (mailbox == CAN_TT_REF_MAILBOX)
+    {
+      if (ok == 0)
+      {
+        TT->Stats.RefErrors++;
+        continue;
+      }
+
+      /* The cycle starts: the reference message of the next one waits in the
+         mailbox */
+      ref.StdId = TT->Init.RefId;
+      ref.ExtId = TT->Init.RefId;
+      ref.IDE = (uint8_t)TT->Init.RefIDE;
+      ref.RTR = CAN_RTR_Data;
+      ref.DLC = 1;
+      ref.Data[0] = (uint8_t)(can->sTxMailBox[mailbox].TDLR + 1) & (TT->Init.CycleCount - 1);
+      CAN_TTSync(TT, (uint8_t)can->sTxMailBox[mailbox].TDLR,
+                 (uint16_t)(can->sTxMailBox[mailbox].TDTR >> CAN_TT_TIME_SHIFT));
+      if (TT->Running != 0)
+      {
+        CAN_TTLoad(TT, mailbox, &ref);
+      }
+      continue;
+    }
+
+    if (TT->Mailbox[mailbox] == CAN_TT_NO_SLOT)
+    {
+      continue;
+    }
+
+    slot = &TT->Init.Slots[TT->Mailbox[mailbox] & (uint16_t)~CAN_TT_STALE];
+    if ((TT->Mailbox[mailbox] & CAN_TT_STALE) != 0)
+    {
+      /* Sent before the abort took effect: too late for a position */
+      if (ok != 0)
+      {
+        slot->Sent++;
+      }
+      else
+      {
+        slot->Missed++;
+      }
+    }
+    else if (ok != 0)
+    {
+      delta = (uint16_t)((can->sTxMailBox[mailbox].TDTR >> CAN_TT_TIME_SHIFT) - TT->RefStamp);
+      slot->Last = delta;
+      if (delta < slot->Min)
+      {
+        slot->Min = delta;
+      }
+      if (delta > slot->Max)
+      {
+        slot->Max = delta;
+      }
+      slot->Sent++;
+    }
+    else
+    {
+      slot->Missed++;
+    }
+
+    /* Load the next frame of the cycle ahead of its slot */
+    TT->Mailbox[mailbox] = CAN_TT_NO_SLOT;
+    if ((TT->Running != 0) && (TT->Preload < TT->Init.SlotCount))
+    {
+      TT->Mailbox[mailbox] = TT->Preload;
+      CAN_TTLoad(TT, mailbox, &TT->Init.Slots[TT->Preload].Msg);
+      TT->Preload = CAN_TTNextSlot(TT, TT->Preload + 1);
+    }
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Handles the reference messages received by the FIFO of the
+  *         reference message.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @note   This function must be called from the RX interrupt handler of the
+  *         FIFO RefFIFO.
+  * @retval None
+  */
+void CAN_TTRxIRQHandler(CAN_TTTypeDef* TT)
+{
+  CAN_TypeDef* can = TT->Init.CANx;
+  __IO uint32_t* rfr = (TT->Init.RefFIFO == CAN_FIFO0) ? &can->RF0R : &can->RF1R;
+  uint32_t primask = 0, rdtr = 0, rdlr = 0;
+  uint8_t cycle = 0, mask = TT->Init.CycleCount - 1;
+
+  primask = NVIC_EnterCritical();
+
+  while ((*rfr & CAN_RF0R_FMP0) != 0)
+  {
+    rdtr = can->sFIFOMailBox[TT->Init.RefFIFO].RDTR;
+    rdlr = can->sFIFOMailBox[TT->Init.RefFIFO].RDLR;
+    *rfr = CAN_RF0R_RFOM0;
+
+    /* A node of the bus became time master too: this node stays master */
+    if (TT->Init.Master != DISABLE)
+    {
+      continue;
+    }
+
+    cycle = ((rdtr & CAN_RDT0R_DLC) != 0) ? ((uint8_t)rdlr & mask) : 0;
+    if ((TT->Stats.Cycles != 0) && (cycle != ((TT->Cycle + 1) & mask)))
+    {
+      TT->Stats.CycleErrors++;
+    }
+    CAN_TTSync(TT, cycle, (uint16_t)(rdtr >> CAN_TT_TIME_SHIFT));
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Returns the first slot of the current basic cycle from Slot.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @param  Slot: index of the first slot to check.
+  * @retval The index of the slot, or CAN_TT_NO_SLOT.
+  */
+static uint16_t CAN_TTNextSlot(CAN_TTTypeDef* TT, uint16_t Slot)
+{
+  const CAN_TTSlotTypeDef* slot;
+
+  for (; Slot < TT->Init.SlotCount; Slot++)
+  {
+    slot = &TT->Init.Slots[Slot];
+    if ((TT->Cycle & (slot->Repeat - 1)) == slot->BaseCycle)
+    {
+      return Slot;
+    }
+  }
+
+  return CAN_TT_NO_SLOT;
+}
+
+/**
+  * @brief  Writes a frame into a mailbox, without transmission request.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @param  Mailbox: mailbox, empty or not requested.
+  * @param  Msg: the frame.
+  * @retval None
+  */
+static void CAN_TTLoad(CAN_TTTypeDef* TT, uint8_t Mailbox, const CanTxMsg* Msg)
+{
+  CAN_TxMailBox_TypeDef* mb = &TT->Init.CANx->sTxMailBox[Mailbox];
+
+  if (Msg->IDE == CAN_Id_Standard)
+  {
+    mb->TIR = (Msg->StdId << 21) | Msg->RTR;
+  }
+  else
+  {
+    mb->TIR = (Msg->ExtId << 3) | Msg->IDE | Msg->RTR;
+  }
+
+  /* TGT cleared: the data bytes 6 and 7 are not replaced by the time stamp */
+  mb->TDTR = Msg->DLC & (uint32_t)0x0F;
+  mb->TDLR = ((uint32_t)Msg->Data[3] << 24) | ((uint32_t)Msg->Data[2] << 16) |
+             ((uint32_t)Msg->Data[1] << 8) | (uint32_t)Msg->Data[0];
+  mb->TDHR = ((uint32_t)Msg->Data[7] << 24) | ((uint32_t)Msg->Data[6] << 16) |
+             ((uint32_t)Msg->Data[5] << 8) | (uint32_t)Msg->Data[4];
+}
+
+/**
+  * @brief  Starts a basic cycle at the end of its reference message.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @param  Cycle: number of the basic cycle.
+  * @param  Stamp: start of frame of the reference message, in CAN bit times.
+  * @note   This function is called with the interrupts disabled.
+  * @retval None
+  */
+static void CAN_TTSync(CAN_TTTypeDef* TT, uint8_t Cycle, uint16_t Stamp)
+{
+  CAN_TypeDef* can = TT->Init.CANx;
+  uint8_t mailbox = 0;
+
+  TT->Base = TIM_WheelGetTime();
+  TT->RefStamp = Stamp;
+  TT->Cycle = Cycle;
+  TT->Stats.Cycles++;
+
+  if (TT->Running == 0)
+  {
+    return;
+  }
+
+  /* The frames of the previous cycle still waiting missed their slot */
+  for (mailbox = 0; mailbox < 2; mailbox++)
+  {
+    if ((TT->Mailbox[mailbox] == CAN_TT_NO_SLOT) || ((TT->Mailbox[mailbox] & CAN_TT_STALE) != 0))
+    {
+      continue;
+    }
+    if ((can->sTxMailBox[mailbox].TIR & CAN_TI0R_TXRQ) != 0)
+    {
+      /* The Transmission Complete interrupt of the abort frees the mailbox */
+      TT->Mailbox[mailbox] |= CAN_TT_STALE;
+      can->TSR = CAN_TSR_ABRQ0 << CAN_TT_TSR_SHIFT(mailbox);
+    }
+    else
+    {
+      TT->Init.Slots[TT->Mailbox[mailbox]].Missed++;
+      TT->Mailbox[mailbox] = CAN_TT_NO_SLOT;
+    }
+  }
+
+  TT->Next = CAN_TTNextSlot(TT, 0);
+  TT->Preload = TT->Next;
+
+  for (mailbox = 0; (mailbox < 2) && (TT->Preload != CAN_TT_NO_SLOT); mailbox++)
+  {
+    if (TT->Mailbox[mailbox] == CAN_TT_NO_SLOT)
+    {
+      TT->Mailbox[mailbox] = TT->Preload;
+      CAN_TTLoad(TT, mailbox, &TT->Init.Slots[TT->Preload].Msg);
+      TT->Preload = CAN_TTNextSlot(TT, TT->Preload + 1);
+    }
+  }
+
+  CAN_TTStartSlotTimer(TT);
+}
+
+/**
+  * @brief  Starts the timer of the next slot, or stops it at the end of the
+  *         cycle.
+  * @param  TT: pointer to the CAN_TTTypeDef structure of the CAN.
+  * @note   This function is called with the interrupts disabled.
+  * @retval None
+  */
+static void CAN_TTStartSlotTimer(CAN_TTTypeDef* TT)
+{
+  uint32_t elapsed = 0, offset = 0;
+
+  if (TT->Next == CAN_TT_NO_SLOT)
+  {
+    TIM_TimerStop(&TT->SlotTimer);
+    return;
+  }
+
+  elapsed = TIM_WheelGetTime() - TT->Base;
+  offset = TT->Init.Slots[TT->Next].Offset;
+  (void)TIM_TimerStart(&TT->SlotTimer, (offset > elapsed) ? (offset - elapsed) : 1, 0);
+}
+
+/**
+  * @brief  Slot of the frame TT->Next: requests its transmission.
+  * @param  Timer: the slot timer.
+  * @retval None
+  */
+static void CAN_TTSlotExpired(TIM_TimerTypeDef* Timer)
+{
+  CAN_TTTypeDef* tt = (CAN_TTTypeDef*)Timer->Context;
+  uint32_t primask = 0;
+  uint16_t slot = 0;
+  uint8_t mailbox = 0;
+
+  primask = NVIC_EnterCritical();
+
+  slot = tt->Next;
+  if ((tt->Running == 0) || (slot == CAN_TT_NO_SLOT))
+  {
+    NVIC_ExitCritical(primask);
+    return;
+  }
+
+  while ((mailbox < 2) && (tt->Mailbox[mailbox] != slot))
+  {
+    mailbox++;
+  }
+
+  if (mailbox < 2)
+  {
+    tt->Init.CANx->sTxMailBox[mailbox].TIR |= CAN_TI0R_TXRQ;
+  }
+  else
+  {
+    /* Both mailboxes still hold earlier frames */
+    tt->Init.Slots[slot].Missed++;
+    if (tt->Preload == slot)
+    {
+      tt->Preload = CAN_TTNextSlot(tt, slot + 1);
+    }
+  }
+
+  tt->Next = CAN_TTNextSlot(tt, slot + 1);
+  CAN_TTStartSlotTimer(tt);
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Start of a basic cycle of the time master: requests the
+  *         transmission of the reference message.
+  * @param  Timer: the reference timer.
+  * @retval None
+  */
+static void CAN_TTRefExpired(TIM_TimerTypeDef* Timer)
+{
+  CAN_TTTypeDef* tt = (CAN_TTTypeDef*)Timer->Context;
+  CAN_TypeDef* can = tt->Init.CANx;
+  uint32_t primask = NVIC_EnterCritical();
+
+  if ((can->TSR & CAN_TSR_TME2) != 0)
+  {
+    can->sTxMailBox[CAN_TT_REF_MAILBOX].TIR |= CAN_TI0R_TXRQ;
+  }
+  else
+  {
+    /* The previous reference message is still waiting for the bus */
+    tt->Stats.RefErrors++;
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
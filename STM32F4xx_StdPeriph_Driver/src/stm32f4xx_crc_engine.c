@@ -0,0 +1,585 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_crc_engine.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a generic CRC engine on top of the CRC unit:
+  *           - CRC-32 of byte buffers of any length and alignment, in the
+  *             reflected (Ethernet) or normal (MPEG-2) bit order, computed by
+  *             the CRC calculation unit
+  *           - Slicing-by-8 software CRC of 8 to 32 bits for the other
+  *             polynomials (CRC-16/CCITT, Modbus...)
+  *           - DMA feeding of the CRC calculation unit for large memory areas
+  *          It uses the stm32f4xx_crc.c/.h and stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable The CRC controller clock using
+  *             RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_CRC, ENABLE); function.
+  *
+  *          2. For the CRCs other than CRC-32, build the slicing-by-8 table of
+  *             the parameters once using CRC_TableInit(). Without a table, the
+  *             CRC is computed bit by bit.
+  *
+  *          3. Compute the CRC of a buffer using CRC_Compute(), or of a message
+  *             given in parts using CRC_EngineInit(), CRC_EngineUpdate() and
+  *             CRC_EngineFinal().
+  *
+  *          4. To compute the CRC of a large memory area by DMA, enable the DMA2
+  *             clock, call DMA_MgrInit() and DMA_MgrIRQHandler() from the
+  *             interrupt handlers of the memory to memory streams, then call
+  *             CRC_CalcBlockCRCDMA().
+  *
+  * @note   CRC_EngineUpdate() and CRC_CalcBlockCRCDMA() use the CRC_DR
+  *         register: they must not interrupt or be interrupted by another
+  *         user of the CRC calculation unit.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_crc_engine.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup CRC
+  * @brief CRC driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Polynomial of the CRC calculation unit */
+#define CRC_HW_POLYNOMIAL   ((uint32_t)0x04C11DB7)
+
+/* Largest DMA transfer, in words */
+#define CRC_DMA_MAX_COUNT   ((uint32_t)0xFFFF)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+const CRC_ParamTypeDef CRC_Param_CRC32        = {0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 32, ENABLE};
+const CRC_ParamTypeDef CRC_Param_CRC32_MPEG2  = {0x04C11DB7, 0xFFFFFFFF, 0x00000000, 32, DISABLE};
+const CRC_ParamTypeDef CRC_Param_CRC16_CCITT  = {0x00001021, 0x0000FFFF, 0x00000000, 16, DISABLE};
+const CRC_ParamTypeDef CRC_Param_CRC16_XMODEM = {0x00001021, 0x00000000, 0x00000000, 16, DISABLE};
+const CRC_ParamTypeDef CRC_Param_CRC16_MODBUS = {0x00008005, 0x0000FFFF, 0x00000000, 16, ENABLE};
+
+/* 4-bit tables of the CRC-32 bytes which are not in a whole word */
+static const uint32_t CRC_NibbleTable[16] =
+{
+  0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+  0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD
+};
+
+static const uint32_t CRC_NibbleTableReflected[16] =
+{
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void CRC_HardwareUpdate(CRC_EngineTypeDef* Engine, const uint8_t* Data, uint32_t Length);
+static void CRC_SoftwareUpdate(CRC_EngineTypeDef* Engine, const uint8_t* Data, uint32_t Length);
+static uint32_t CRC_ByteStep(CRC_EngineTypeDef* Engine, uint32_t Register, uint8_t Data);
+static uint32_t CRC_HardwareSeed(uint32_t Register);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup CRC_Private_Functions
+  * @{
+  */
+
+/** @defgroup CRC_Group1 Generic CRC engine functions
+ *  @brief   Generic CRC engine functions
+ *
+@verbatim
+ ===============================================================================
+                          Generic CRC engine functions
+ ===============================================================================
+
+  The CRC calculation unit computes the CRC-32 polynomial 0x04C11DB7 on 32-bit
+  words, most significant bit first, from the value of CRC_DR. The engine
+  computes the CRC-32 of byte buffers with it:
+    - The words of a normal CRC are byte swapped with REV, so that the first
+      byte of the buffer is processed first.
+    - The words of a reflected CRC are bit reversed with RBIT: the register of
+      the unit is then the bit reversal of the CRC register, and the result is
+      bit reversed again with RBIT.
+    - The CRC_DR register can only be reset to 0xFFFFFFFF. The first word
+      written after the reset is chosen so that CRC_DR takes the value of the
+      CRC register of the engine: any initial value is supported, and several
+      CRCs can be computed in turn.
+    - The bytes before the first word boundary and after the last one are
+      processed with a 16-entry table.
+
+  The other CRCs are computed by software, 8 bytes at a time, with 8 tables of
+  256 words built by CRC_TableInit(). The tables of a CRC can be built at
+  startup in RAM, or printed once and kept in Flash as a constant.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Builds the slicing-by-8 table of a software CRC.
+  * @param  Param: pointer to the CRC_ParamTypeDef structure of the CRC.
+  * @param  Table: pointer to the CRC_TableTypeDef structure to build.
+  * @retval None
+  */
+void CRC_TableInit(const CRC_ParamTypeDef* Param, CRC_TableTypeDef* Table)
+{
+  uint32_t i = 0, j = 0, crc = 0, poly = 0;
+
+  /* Check the parameters */
+  assert_param(IS_CRC_WIDTH(Param->Width));
+  assert_param(IS_FUNCTIONAL_STATE(Param->Reflected));
+
+  if (Param->Reflected != DISABLE)
+  {
+    poly = __RBIT(Param->Polynomial) >> (32 - Param->Width);
+    for (i = 0; i < 256; i++)
+    {
+      crc = i;
+      for (j = 0; j < 8; j++)
+      {
+        crc = (crc & 1) ? ((crc >> 1) ^ poly) : (crc >> 1);
+      }
+      Table->Table[0][i] = crc;
+    }
+    for (j = 1; j < 8; j++)
+    {
+      for (i = 0; i < 256; i++)
+      {
+        crc = Table->Table[j - 1][i];
+        Table->Table[j][i] = (crc >> 8) ^ Table->Table[0][crc & 0xFF];
+      }
+    }
+  }
+  else
+  {
+    poly = Param->Polynomial << (32 - Param->Width);
+    for (i = 0; i < 256; i++)
+    {
+      crc = i << 24;
+      for (j = 0; j < 8; j++)
+      {
+        crc = (crc & 0x80000000) ? ((crc << 1) ^ poly) : (crc << 1);
+      }
+      Table->Table[0][i] = crc;
+    }
+    for (j = 1; j < 8; j++)
+    {
+      for (i = 0; i < 256; i++)
+      {
+        crc = Table->Table[j - 1][i];
+        Table->Table[j][i] = (crc << 8) ^ Table->Table[0][crc >> 24];
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Starts a CRC.
+  * @param  Engine: pointer to the CRC_EngineTypeDef structure of the CRC.
+  * @param  Param: pointer to the CRC_ParamTypeDef structure of the CRC.
+  * @param  Table: pointer to the table built by CRC_TableInit() with Param, or 0.
+  *         It is not used by the CRC-32 computed by the CRC calculation unit.
+  * @retval None
+  */
+void CRC_EngineInit(CRC_EngineTypeDef* Engine, const CRC_ParamTypeDef* Param,
+                    const CRC_TableTypeDef* Table)
+{
+  /* Check the parameters */
+  assert_param(IS_CRC_WIDTH(Param->Width));
+  assert_param(IS_FUNCTIONAL_STATE(Param->Reflected));
+
+  Engine->Table = Table;
+  Engine->XorOut = Param->XorOut;
+  Engine->Width = Param->Width;
+  Engine->Reflected = (Param->Reflected != DISABLE);
+  Engine->Hardware = (Param->Width == 32) && (Param->Polynomial == CRC_HW_POLYNOMIAL);
+
+  /* The register is kept reflected, or aligned on the most significant bit */
+  if (Engine->Reflected != 0)
+  {
+    Engine->Polynomial = __RBIT(Param->Polynomial) >> (32 - Param->Width);
+    Engine->Register = __RBIT(Param->Init) >> (32 - Param->Width);
+  }
+  else
+  {
+    Engine->Polynomial = Param->Polynomial << (32 - Param->Width);
+    Engine->Register = Param->Init << (32 - Param->Width);
+  }
+}
+
+/**
+  * @brief  Computes the CRC of a part of a message.
+  * @param  Engine: pointer to the CRC_EngineTypeDef structure of the CRC.
+  * @param  Data: pointer to the bytes, any alignment.
+  * @param  Length: number of bytes.
+  * @retval None
+  */
+void CRC_EngineUpdate(CRC_EngineTypeDef* Engine, const uint8_t* Data, uint32_t Length)
+{
+  if (Engine->Hardware != 0)
+  {
+    CRC_HardwareUpdate(Engine, Data, Length);
+  }
+  else
+  {
+    CRC_SoftwareUpdate(Engine, Data, Length);
+  }
+}
+
+/**
+  * @brief  Returns the CRC of a message.
+  * @param  Engine: pointer to the CRC_EngineTypeDef structure of the CRC.
+  * @retval The CRC, on Width bits
+  */
+uint32_t CRC_EngineFinal(CRC_EngineTypeDef* Engine)
+{
+  if (Engine->Reflected != 0)
+  {
+    return Engine->Register ^ Engine->XorOut;
+  }
+  else
+  {
+    return (Engine->Register >> (32 - Engine->Width)) ^ Engine->XorOut;
+  }
+}
+
+/**
+  * @brief  Computes the CRC of a buffer.
+  * @param  Param: pointer to the CRC_ParamTypeDef structure of the CRC.
+  * @param  Table: pointer to the table built by CRC_TableInit() with Param, or 0.
+  * @param  Data: pointer to the bytes, any alignment.
+  * @param  Length: number of bytes.
+  * @retval The CRC, on Width bits
+  */
+uint32_t CRC_Compute(const CRC_ParamTypeDef* Param, const CRC_TableTypeDef* Table,
+                     const uint8_t* Data, uint32_t Length)
+{
+  CRC_EngineTypeDef engine;
+
+  CRC_EngineInit(&engine, Param, Table);
+  CRC_EngineUpdate(&engine, Data, Length);
+
+  return CRC_EngineFinal(&engine);
+}
+
+/**
+  * @brief  Computes the 32-bit CRC of a buffer of data words by DMA, from the
+  *         current value of CRC_DR as CRC_CalcBlockCRC().
+  * @param  pBuffer: pointer to the buffer containing the data to be computed
+  * @param  BufferLength: length of the buffer to be computed, in words
+  * @param  CRCValue: the returned 32-bit CRC
+  * @note   The words are computed as they are in memory, like CRC_CalcBlockCRC():
+  *         the DMA cannot byte swap or bit reverse them. The CPU computes the
+  *         CRC when no memory to memory stream is free.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the CRC is computed
+  *          - ERROR: a DMA transfer failed
+  */
+ErrorStatus CRC_CalcBlockCRCDMA(uint32_t pBuffer[], uint32_t BufferLength, uint32_t* CRCValue)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  DMA_MgrXferTypeDef xfer;
+  DMA_Stream_TypeDef* stream = 0;
+  uint32_t inputaddr = (uint32_t)pBuffer;
+  uint32_t count = 0;
+
+  /* The source is on the peripheral port, CRC_DR on the memory port */
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToMemory;
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Disable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
+  DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+
+  while (BufferLength != 0)
+  {
+    count = (BufferLength > CRC_DMA_MAX_COUNT) ? CRC_DMA_MAX_COUNT : BufferLength;
+
+    /* The source address of a memory to memory stream is set at allocation */
+    DMA_InitStructure.DMA_PeripheralBaseAddr = inputaddr;
+    stream = DMA_MgrAlloc(DMA_MGR_REQ_MEM2MEM, &DMA_InitStructure);
+    if (stream == 0)
+    {
+      break;
+    }
+
+    xfer.MemoryBaseAddr = (uint32_t)&CRC->DR;
+    xfer.Count = (uint16_t)count;
+    xfer.Callback = 0;
+    if (DMA_MgrSubmit(stream, &xfer) != SUCCESS)
+    {
+      xfer.Status = DMA_MGR_XFER_ERROR;
+    }
+    while ((xfer.Status == DMA_MGR_XFER_QUEUED) || (xfer.Status == DMA_MGR_XFER_ACTIVE))
+    {
+    }
+    DMA_MgrFree(stream);
+
+    if (xfer.Status != DMA_MGR_XFER_DONE)
+    {
+      return ERROR;
+    }
+    inputaddr += count * 4;
+    BufferLength -= count;
+  }
+
+  /* No free stream: the rest of the buffer is computed by the CPU */
+  *CRCValue = CRC_CalcBlockCRC((uint32_t*)inputaddr, BufferLength);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Computes the CRC-32 of a part of a message with the CRC
+  *         calculation unit.
+  * @param  Engine: pointer to the CRC_EngineTypeDef structure of the CRC.
+  * @param  Data: pointer to the bytes, any alignment.
+  * @param  Length: number of bytes.
+  * @retval None
+  */
+static void CRC_HardwareUpdate(CRC_EngineTypeDef* Engine, const uint8_t* Data, uint32_t Length)
+{
+  uint32_t inputaddr = (uint32_t)Data;
+  uint32_t crc = Engine->Register;
+  uint32_t words = 0;
+
+  /* Bytes before the first word boundary */
+  while ((Length != 0) && ((inputaddr & 0x3) != 0))
+  {
+    crc = CRC_ByteStep(Engine, crc, *(uint8_t*)inputaddr);
+    inputaddr++;
+    Length--;
+  }
+
+  words = Length / 4;
+  if (words != 0)
+  {
+    CRC_ResetDR();
+
+    if (Engine->Reflected != 0)
+    {
+      CRC->DR = CRC_HardwareSeed(__RBIT(crc));
+      while (words != 0)
+      {
+        CRC->DR = __RBIT(*(uint32_t*)inputaddr);
+        inputaddr += 4;
+        words--;
+      }
+      crc = __RBIT(CRC->DR);
+    }
+    else
+    {
+      CRC->DR = CRC_HardwareSeed(crc);
+      while (words != 0)
+      {
+        CRC->DR = __REV(*(uint32_t*)inputaddr);
+        inputaddr += 4;
+        words--;
+      }
+      crc = CRC->DR;
+    }
+  }
+
+  /* Bytes after the last word boundary */
+  Length &= 0x3;
+  while (Length != 0)
+  {
+    crc = CRC_ByteStep(Engine, crc, *(uint8_t*)inputaddr);
+    inputaddr++;
+    Length--;
+  }
+
+  Engine->Register = crc;
+}
+
+/**
+  * @brief  Computes the CRC of a part of a message by software.
+  * @param  Engine: pointer to the CRC_EngineTypeDef structure of the CRC.
+  * @param  Data: pointer to the bytes, any alignment.
+  * @param  Length: number of bytes.
+  * @retval None
+  */
+static void CRC_SoftwareUpdate(CRC_EngineTypeDef* Engine, const uint8_t* Data, uint32_t Length)
+{
+  const uint32_t (*T)[256] = 0;
+  uint32_t inputaddr = (uint32_t)Data;
+  uint32_t crc = Engine->Register;
+  uint32_t lo = 0, hi = 0;
+
+  if (Engine->Table != 0)
+  {
+    T = Engine->Table->Table;
+
+    /* Bytes before the first word boundary */
+    while ((Length != 0) && ((inputaddr & 0x3) != 0))
+    {
+      crc = CRC_ByteStep(Engine, crc, *(uint8_t*)inputaddr);
+      inputaddr++;
+      Length--;
+    }
+
+    /* 8 bytes at a time */
+    if (Engine->Reflected != 0)
+    {
+      while (Length >= 8)
+      {
+        lo = crc ^ *(uint32_t*)inputaddr;
+        hi = *(uint32_t*)(inputaddr + 4);
+        crc = T[7][lo & 0xFF] ^ T[6][(lo >> 8) & 0xFF] ^ T[5][(lo >> 16) & 0xFF] ^ T[4][lo >> 24] ^
+              T[3][hi & 0xFF] ^ T[2][(hi >> 8) & 0xFF] ^ T[1][(hi >> 16) & 0xFF] ^ T[0][hi >> 24];
+        inputaddr += 8;
+        Length -= 8;
+      }
+    }
+    else
+    {
+      while (Length >= 8)
+      {
+        lo = crc ^ __REV(*(uint32_t*)inputaddr);
+        hi = __REV(*(uint32_t*)(inputaddr + 4));
+        crc = T[7][lo >> 24] ^ T[6][(lo >> 16) & 0xFF] ^ T[5][(lo >> 8) & 0xFF] ^ T[4][lo & 0xFF] ^
+              T[3][hi >> 24] ^ T[2][(hi >> 16) & 0xFF] ^ T[1][(hi >> 8) & 0xFF] ^ T[0][hi & 0xFF];
+        inputaddr += 8;
+        Length -= 8;
+      }
+    }
+  }
+
+  while (Length != 0)
+  {
+    crc = CRC_ByteStep(Engine, crc, *(uint8_t*)inputaddr);
+    inputaddr++;
+    Length--;
+  }
+
+  Engine->Register = crc;
+}
+
+/**
+  * @brief  Computes the CRC of one byte: with the table of the software CRC,
+  *         the 4-bit table of the CRC-32, or bit by bit.
+  * @param  Engine: pointer to the CRC_EngineTypeDef structure of the CRC.
+  * @param  Register: the CRC register.
+  * @param  Data: the byte.
+  * @retval The CRC register
+  */
+static uint32_t CRC_ByteStep(CRC_EngineTypeDef* Engine, uint32_t Register, uint8_t Data)
+{
+  uint32_t i = 0;
+
+  if (Engine->Reflected != 0)
+  {
+    Register ^= Data;
+    if (Engine->Hardware != 0)
+    {
+      Register = (Register >> 4) ^ CRC_NibbleTableReflected[Register & 0xF];
+      Register = (Register >> 4) ^ CRC_NibbleTableReflected[Register & 0xF];
+    }
+    else if (Engine->Table != 0)
+    {
+      Register = (Register >> 8) ^ Engine->Table->Table[0][Register & 0xFF];
+    }
+    else
+    {
+      for (i = 0; i < 8; i++)
+      {
+        Register = (Register & 1) ? ((Register >> 1) ^ Engine->Polynomial) : (Register >> 1);
+      }
+    }
+  }
+  else
+  {
+    Register ^= (uint32_t)Data << 24;
+    if (Engine->Hardware != 0)
+    {
+      Register = (Register << 4) ^ CRC_NibbleTable[Register >> 28];
+      Register = (Register << 4) ^ CRC_NibbleTable[Register >> 28];
+    }
+    else if (Engine->Table != 0)
+    {
+      Register = (Register << 8) ^ Engine->Table->Table[0][Register >> 24];
+    }
+    else
+    {
+      for (i = 0; i < 8; i++)
+      {
+        Register = (Register & 0x80000000) ? ((Register << 1) ^ Engine->Polynomial) : (Register << 1);
+      }
+    }
+  }
+
+  return Register;
+}
+
+/**
+  * @brief  Returns the word which sets CRC_DR to a given value when it is
+  *         written after a reset of the CRC calculation unit.
+  * @param  Register: the value of CRC_DR to set.
+  * @retval The word to write in CRC_DR
+  */
+static uint32_t CRC_HardwareSeed(uint32_t Register)
+{
+  uint32_t i = 0;
+
+  /* Run the 32 shifts of the unit backwards: the polynomial has its bit 0
+     set, so that bit 0 of the register tells whether it was XORed in */
+  for (i = 0; i < 32; i++)
+  {
+    Register = (Register & 1) ? (((Register ^ CRC_HW_POLYNOMIAL) >> 1) | 0x80000000) : (Register >> 1);
+  }
+
+  /* CRC_DR holds 0xFFFFFFFF after the reset */
+  return Register ^ 0xFFFFFFFF;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
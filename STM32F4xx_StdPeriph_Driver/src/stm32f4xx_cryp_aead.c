@@ -0,0 +1,1028 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_cryp_aead.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides functions to encrypt and decrypt a message with
+  *          AES-GCM and AES-CCM authenticated encryption:
+  *           - Init, update and finish functions for messages given in parts
+  *           - AES computed by the CRYP through the DMA
+  *           - GHASH computed by the CPU while the DMA runs
+  *          It uses the stm32f4xx_cryp_stream.c/.h driver.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Initialize a CRYP streaming engine using CRYP_StreamInit().
+  *
+  *          2. AES-GCM: call CRYP_GCMInit() with the key and the IV, then
+  *             CRYP_GCMUpdateAAD() for the additional authenticated data, then
+  *             CRYP_GCMUpdate() for the plaintext or ciphertext. Finally
+  *             CRYP_GCMFinish() writes the tag, or checks it for a decryption.
+  *
+  *          3. AES-CCM: call CRYP_CCMInit() with the key, the nonce, the tag
+  *             length and the lengths of the message, then CRYP_CCMUpdateAAD(),
+  *             CRYP_CCMUpdate() and CRYP_CCMFinish() the same way.
+  *
+  * @note   The data of CRYP_GCMUpdate() and CRYP_CCMUpdate() are aligned on 16
+  *         bytes, and their length is a multiple of 16 except at the last call.
+  *         Input and Output may be the same buffer.
+  *
+  * @note   These functions wait for the DMA jobs they queue: they must not be
+  *         called from an interrupt handler which masks the DMA interrupts of
+  *         the streaming engine.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_cryp_aead.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup CRYP
+  * @brief CRYP driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Phases of a message */
+#define CRYP_AEAD_STATE_AAD       ((uint8_t)0x00)
+#define CRYP_AEAD_STATE_DATA      ((uint8_t)0x01)
+#define CRYP_AEAD_STATE_FINAL     ((uint8_t)0x02)
+
+/* Private macro -------------------------------------------------------------*/
+
+/* First address aligned on 16 bytes of a buffer */
+#define CRYP_AEAD_ALIGN(BUFFER)   ((uint32_t*)(((uint32_t)(BUFFER) + 15) & ~(uint32_t)15))
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Reduction of the 4 bits shifted out of the GHASH product */
+static const uint16_t CRYP_GHASHLast4[16] =
+{
+  0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+  0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void CRYP_GHASHTable(uint32_t Table[16][4], const uint32_t H[4]);
+static void CRYP_GHASHMult(uint32_t Table[16][4], uint32_t X[4]);
+static void CRYP_GHASHUpdate(uint32_t Table[16][4], uint32_t Hash[4], const uint8_t* Data, uint32_t Length);
+static void CRYP_AEADSubmit(CRYP_StreamTypeDef* Stream, CRYP_StreamJobTypeDef* Job,
+                            CRYP_StreamSessionTypeDef* Session, uint32_t* Input,
+                            uint32_t* Output, uint32_t Length);
+static ErrorStatus CRYP_AEADWait(CRYP_StreamJobTypeDef* Job);
+static ErrorStatus CRYP_CCMAbsorb(CRYP_CCMTypeDef* CCM, const uint8_t* Data, uint32_t Length);
+static ErrorStatus CRYP_CCMFlush(CRYP_CCMTypeDef* CCM);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup CRYP_Private_Functions
+  * @{
+  */
+
+/** @defgroup CRYP_Group10 AES-GCM and AES-CCM functions
+ *  @brief   AES-GCM and AES-CCM functions
+ *
+@verbatim
+ ===============================================================================
+                       AES-GCM and AES-CCM functions
+ ===============================================================================
+
+  This subsection provides functions allowing to encrypt and authenticate a
+  message in a single pass over the data, with the CRYP modes of the STM32F40x
+  and STM32F41x devices.
+
+  AES-GCM: the counter blocks are encrypted by the CRYP in AES-CTR mode, which
+  increments the last 32 bits of the counter block: the inc32 function of GCM.
+  GHASH is computed by the CPU with a table of the 16 multiples of the hash key
+  by 4-bit values (Shoup's method, 256 bytes in the context), 32 multiply steps
+  of table lookups, shifts and XORs per block. The data are processed by DMA
+  jobs of CRYP_AEAD_CHUNK bytes, and GHASH runs on the ciphertext of the
+  previous job (encryption) or of the next job (decryption) while the DMA
+  processes the current job.
+
+  AES-CCM: the CBC-MAC is computed by the CRYP in AES-CBC mode with a zero IV,
+  and the payload is encrypted in AES-CTR mode. The two sessions of the
+  streaming engine are switched by context swapping for each job, without any
+  key preparation.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes an AES-GCM context: computes the hash key, the tag mask
+  *         and the first counter block.
+  * @param  GCM: pointer to the CRYP_GCMTypeDef structure of the message.
+  * @param  Stream: pointer to an initialized CRYP_StreamTypeDef structure.
+  * @param  Mode: encryption or decryption Mode.
+  *          This parameter can be one of the following values:
+  *            @arg MODE_ENCRYPT: Encryption
+  *            @arg MODE_DECRYPT: Decryption
+  * @param  Key: Key used for AES algorithm.
+  * @param  Keysize: length of the Key, must be a 128, 192 or 256.
+  * @param  IV: Initialisation Vector.
+  * @param  IVLength: length of IV in bytes, 12 for the fastest initialization.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+ErrorStatus CRYP_GCMInit(CRYP_GCMTypeDef* GCM, CRYP_StreamTypeDef* Stream, uint8_t Mode,
+                         uint8_t* Key, uint16_t Keysize, uint8_t* IV, uint32_t IVLength)
+{
+  CRYP_StreamSessionInitTypeDef CRYP_StreamSessionInitStructure;
+  uint32_t* block = CRYP_AEAD_ALIGN(GCM->Buffer);
+  uint32_t H[4];
+  uint32_t i = 0;
+
+  if ((IV == 0) || (IVLength == 0))
+  {
+    return ERROR;
+  }
+
+  GCM->Stream = Stream;
+  GCM->Mode = Mode;
+
+  /* H = E(K, 0): the zero counter block applied to a zero block */
+  for (i = 0; i < 4; i++)
+  {
+    block[i] = 0;
+  }
+  CRYP_StreamSessionInitStructure.CRYP_AlgoDir = CRYP_AlgoDir_Encrypt;
+  CRYP_StreamSessionInitStructure.CRYP_AlgoMode = CRYP_AlgoMode_AES_CTR;
+  CRYP_StreamSessionInitStructure.CRYP_DataType = CRYP_DataType_8b;
+  CRYP_StreamSessionInitStructure.KeySize = Keysize;
+  CRYP_StreamSessionInitStructure.Key = Key;
+  CRYP_StreamSessionInitStructure.IV = (uint8_t*)block;
+  if (CRYP_StreamSessionInit(Stream, &GCM->Session, &CRYP_StreamSessionInitStructure) != SUCCESS)
+  {
+    return ERROR;
+  }
+  CRYP_AEADSubmit(Stream, &GCM->Job, &GCM->Session, block, block, 16);
+  if (CRYP_AEADWait(&GCM->Job) != SUCCESS)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    H[i] = __REV(block[i]);
+    GCM->Hash[i] = 0;
+  }
+  CRYP_GHASHTable(GCM->Table, H);
+
+  /* J0 = IV || 0^31 || 1, or GHASH(IV || 0^s || 0^64 || [len(IV)]64) */
+  if (IVLength == 12)
+  {
+    for (i = 0; i < 12; i++)
+    {
+      ((uint8_t*)block)[i] = IV[i];
+    }
+    block[3] = __REV(1);
+  }
+  else
+  {
+    CRYP_GHASHUpdate(GCM->Table, GCM->Hash, IV, IVLength);
+    GCM->Hash[2] ^= IVLength >> 29;
+    GCM->Hash[3] ^= IVLength << 3;
+    CRYP_GHASHMult(GCM->Table, GCM->Hash);
+    for (i = 0; i < 4; i++)
+    {
+      block[i] = __REV(GCM->Hash[i]);
+      GCM->Hash[i] = 0;
+    }
+  }
+
+  /* E(K, J0) masks the tag, and the payload starts at inc32(J0) */
+  CRYP_StreamSessionInitStructure.IV = (uint8_t*)block;
+  if (CRYP_StreamSessionInit(Stream, &GCM->Session, &CRYP_StreamSessionInitStructure) != SUCCESS)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    block[i] = 0;
+  }
+  CRYP_AEADSubmit(Stream, &GCM->Job, &GCM->Session, block, block, 16);
+  if (CRYP_AEADWait(&GCM->Job) != SUCCESS)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    GCM->Mask[i] = __REV(block[i]);
+  }
+
+  GCM->PartialLength = 0;
+  GCM->AADLength = 0;
+  GCM->DataLength = 0;
+  GCM->State = CRYP_AEAD_STATE_AAD;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Hashes additional authenticated data of an AES-GCM message.
+  * @param  GCM: pointer to the CRYP_GCMTypeDef structure of the message.
+  * @param  AAD: pointer to the additional authenticated data.
+  * @param  Length: length of AAD in bytes, any value.
+  * @note   This function must be called before CRYP_GCMUpdate().
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+ErrorStatus CRYP_GCMUpdateAAD(CRYP_GCMTypeDef* GCM, uint8_t* AAD, uint32_t Length)
+{
+  uint32_t full = 0;
+
+  if (GCM->State != CRYP_AEAD_STATE_AAD)
+  {
+    return ERROR;
+  }
+  GCM->AADLength += Length;
+
+  /* Complete the pending block first */
+  while ((GCM->PartialLength != 0) && (Length != 0))
+  {
+    GCM->Partial[GCM->PartialLength++] = *AAD++;
+    Length--;
+    if (GCM->PartialLength == 16)
+    {
+      CRYP_GHASHUpdate(GCM->Table, GCM->Hash, GCM->Partial, 16);
+      GCM->PartialLength = 0;
+    }
+  }
+
+  full = Length & ~(uint32_t)0xF;
+  CRYP_GHASHUpdate(GCM->Table, GCM->Hash, AAD, full);
+  AAD += full;
+  Length -= full;
+
+  while (Length != 0)
+  {
+    GCM->Partial[GCM->PartialLength++] = *AAD++;
+    Length--;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Encrypts or decrypts a part of an AES-GCM message.
+  * @param  GCM: pointer to the CRYP_GCMTypeDef structure of the message.
+  * @param  Input: pointer to the Input buffer, aligned on 16 bytes.
+  * @param  Length: length of the Input buffer, a multiple of 16 except for the
+  *         last part of the message.
+  * @param  Output: pointer to the returned buffer, aligned on 16 bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+ErrorStatus CRYP_GCMUpdate(CRYP_GCMTypeDef* GCM, uint8_t* Input, uint32_t Length, uint8_t* Output)
+{
+  uint32_t* block = CRYP_AEAD_ALIGN(GCM->Buffer);
+  uint32_t full = Length & ~(uint32_t)0xF;
+  uint32_t tail = Length & 0xF;
+  uint32_t offset = 0, n = 0, next = 0, i = 0;
+
+  if ((GCM->State == CRYP_AEAD_STATE_FINAL) ||
+      ((((uint32_t)Input | (uint32_t)Output) & 0xF) != 0))
+  {
+    return ERROR;
+  }
+
+  /* The AAD end with a zero padded block */
+  if (GCM->State == CRYP_AEAD_STATE_AAD)
+  {
+    CRYP_GHASHUpdate(GCM->Table, GCM->Hash, GCM->Partial, GCM->PartialLength);
+    GCM->PartialLength = 0;
+    GCM->State = CRYP_AEAD_STATE_DATA;
+  }
+
+  if ((GCM->Mode == MODE_DECRYPT) && (full != 0))
+  {
+    CRYP_GHASHUpdate(GCM->Table, GCM->Hash, Input, (full < CRYP_AEAD_CHUNK) ? full : CRYP_AEAD_CHUNK);
+  }
+
+  for (offset = 0; offset < full; offset += n)
+  {
+    n = full - offset;
+    if (n > CRYP_AEAD_CHUNK)
+    {
+      n = CRYP_AEAD_CHUNK;
+    }
+    CRYP_AEADSubmit(GCM->Stream, &GCM->Job, &GCM->Session, (uint32_t*)(Input + offset),
+                    (uint32_t*)(Output + offset), n);
+
+    /* GHASH of the ciphertext out of the DMA: the previous chunk of the output,
+       or the next chunk of the input, not yet overwritten when in place */
+    if (GCM->Mode == MODE_ENCRYPT)
+    {
+      if (offset != 0)
+      {
+        CRYP_GHASHUpdate(GCM->Table, GCM->Hash, Output + offset - CRYP_AEAD_CHUNK, CRYP_AEAD_CHUNK);
+      }
+    }
+    else
+    {
+      next = offset + n;
+      if (next < full)
+      {
+        CRYP_GHASHUpdate(GCM->Table, GCM->Hash, Input + next,
+                         ((full - next) < CRYP_AEAD_CHUNK) ? (full - next) : CRYP_AEAD_CHUNK);
+      }
+    }
+
+    if (CRYP_AEADWait(&GCM->Job) != SUCCESS)
+    {
+      return ERROR;
+    }
+  }
+  if ((GCM->Mode == MODE_ENCRYPT) && (full != 0))
+  {
+    CRYP_GHASHUpdate(GCM->Table, GCM->Hash, Output + full - n, n);
+  }
+
+  /* Last partial block through the aligned buffer */
+  if (tail != 0)
+  {
+    for (i = 0; i < 4; i++)
+    {
+      block[i] = 0;
+    }
+    for (i = 0; i < tail; i++)
+    {
+      ((uint8_t*)block)[i] = Input[full + i];
+    }
+    if (GCM->Mode == MODE_DECRYPT)
+    {
+      CRYP_GHASHUpdate(GCM->Table, GCM->Hash, (uint8_t*)block, tail);
+    }
+    CRYP_AEADSubmit(GCM->Stream, &GCM->Job, &GCM->Session, block, block, 16);
+    if (CRYP_AEADWait(&GCM->Job) != SUCCESS)
+    {
+      return ERROR;
+    }
+    if (GCM->Mode == MODE_ENCRYPT)
+    {
+      CRYP_GHASHUpdate(GCM->Table, GCM->Hash, (uint8_t*)block, tail);
+    }
+    for (i = 0; i < tail; i++)
+    {
+      Output[full + i] = ((uint8_t*)block)[i];
+    }
+    GCM->State = CRYP_AEAD_STATE_FINAL;
+  }
+
+  GCM->DataLength += Length;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Ends an AES-GCM message: writes the tag of an encryption, or checks
+  *         the tag of a decryption.
+  * @param  GCM: pointer to the CRYP_GCMTypeDef structure of the message.
+  * @param  Tag: the tag, written or checked.
+  * @param  TagLength: length of the tag in bytes, from 4 to 16.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done, and the tag matches for a decryption
+  *          - ERROR: Operation failed, or the tag does not match
+  */
+ErrorStatus CRYP_GCMFinish(CRYP_GCMTypeDef* GCM, uint8_t* Tag, uint32_t TagLength)
+{
+  uint8_t byte = 0, diff = 0;
+  uint32_t i = 0;
+
+  if ((TagLength < 4) || (TagLength > 16))
+  {
+    return ERROR;
+  }
+
+  if (GCM->State == CRYP_AEAD_STATE_AAD)
+  {
+    CRYP_GHASHUpdate(GCM->Table, GCM->Hash, GCM->Partial, GCM->PartialLength);
+    GCM->PartialLength = 0;
+  }
+  GCM->State = CRYP_AEAD_STATE_FINAL;
+
+  /* [len(A)]64 || [len(C)]64 */
+  GCM->Hash[0] ^= GCM->AADLength >> 29;
+  GCM->Hash[1] ^= GCM->AADLength << 3;
+  GCM->Hash[2] ^= GCM->DataLength >> 29;
+  GCM->Hash[3] ^= GCM->DataLength << 3;
+  CRYP_GHASHMult(GCM->Table, GCM->Hash);
+
+  for (i = 0; i < TagLength; i++)
+  {
+    byte = (uint8_t)((GCM->Hash[i >> 2] ^ GCM->Mask[i >> 2]) >> (24 - ((i & 3) << 3)));
+    if (GCM->Mode == MODE_ENCRYPT)
+    {
+      Tag[i] = byte;
+    }
+    else
+    {
+      diff |= (uint8_t)(Tag[i] ^ byte);
+    }
+  }
+
+  return (diff == 0) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Initializes an AES-CCM context: formats the first block and the AAD
+  *         length of the CBC-MAC and computes the tag mask.
+  * @param  CCM: pointer to the CRYP_CCMTypeDef structure of the message.
+  * @param  Stream: pointer to an initialized CRYP_StreamTypeDef structure.
+  * @param  Mode: encryption or decryption Mode.
+  *          This parameter can be one of the following values:
+  *            @arg MODE_ENCRYPT: Encryption
+  *            @arg MODE_DECRYPT: Decryption
+  * @param  Key: Key used for AES algorithm.
+  * @param  Keysize: length of the Key, must be a 128, 192 or 256.
+  * @param  Nonce: the nonce.
+  * @param  NonceLength: length of Nonce in bytes, from 7 to 13.
+  * @param  AADLength: total length of the additional authenticated data.
+  * @param  PayloadLength: total length of the payload.
+  * @param  TagLength: length of the tag in bytes: 4, 6, 8, 10, 12, 14 or 16.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+ErrorStatus CRYP_CCMInit(CRYP_CCMTypeDef* CCM, CRYP_StreamTypeDef* Stream, uint8_t Mode,
+                         uint8_t* Key, uint16_t Keysize, uint8_t* Nonce, uint32_t NonceLength,
+                         uint32_t AADLength, uint32_t PayloadLength, uint8_t TagLength)
+{
+  CRYP_StreamSessionInitTypeDef CRYP_StreamSessionInitStructure;
+  uint32_t* block = CRYP_AEAD_ALIGN(CCM->Buffer);
+  uint8_t* counter = (uint8_t*)block;
+  uint8_t header[16];
+  uint32_t q = 15 - NonceLength;
+  uint32_t i = 0;
+
+  if ((Nonce == 0) || (NonceLength < 7) || (NonceLength > 13) ||
+      (TagLength < 4) || (TagLength > 16) || ((TagLength & 1) != 0) ||
+      ((q < 4) && ((PayloadLength >> (q * 8)) != 0)))
+  {
+    return ERROR;
+  }
+
+  CCM->Stream = Stream;
+  CCM->Mode = Mode;
+  CCM->TagLength = TagLength;
+  CCM->AADLength = AADLength;
+  CCM->PayloadLength = PayloadLength;
+  CCM->AADCount = 0;
+  CCM->PayloadCount = 0;
+  CCM->StageLength = 0;
+  CCM->State = CRYP_AEAD_STATE_AAD;
+
+  /* CBC-MAC: AES-CBC encryption with a zero IV */
+  for (i = 0; i < 4; i++)
+  {
+    block[i] = 0;
+  }
+  CRYP_StreamSessionInitStructure.CRYP_AlgoDir = CRYP_AlgoDir_Encrypt;
+  CRYP_StreamSessionInitStructure.CRYP_AlgoMode = CRYP_AlgoMode_AES_CBC;
+  CRYP_StreamSessionInitStructure.CRYP_DataType = CRYP_DataType_8b;
+  CRYP_StreamSessionInitStructure.KeySize = Keysize;
+  CRYP_StreamSessionInitStructure.Key = Key;
+  CRYP_StreamSessionInitStructure.IV = (uint8_t*)block;
+  if (CRYP_StreamSessionInit(Stream, &CCM->SessionMAC, &CRYP_StreamSessionInitStructure) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* Counter blocks: flags || nonce || i, from A0 */
+  counter[0] = (uint8_t)(q - 1);
+  for (i = 0; i < NonceLength; i++)
+  {
+    counter[1 + i] = Nonce[i];
+  }
+  CRYP_StreamSessionInitStructure.CRYP_AlgoMode = CRYP_AlgoMode_AES_CTR;
+  if (CRYP_StreamSessionInit(Stream, &CCM->SessionCTR, &CRYP_StreamSessionInitStructure) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* S0 = E(K, A0) masks the tag, and the payload starts at A1 */
+  for (i = 0; i < 4; i++)
+  {
+    block[i] = 0;
+  }
+  CRYP_AEADSubmit(Stream, &CCM->Job[0], &CCM->SessionCTR, block, block, 16);
+  if (CRYP_AEADWait(&CCM->Job[0]) != SUCCESS)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    CCM->Mask[i] = block[i];
+  }
+
+  /* B0 = flags || nonce || [payload length]q */
+  header[0] = (uint8_t)(((AADLength != 0) ? 0x40 : 0x00) | (((TagLength - 2) / 2) << 3) | (q - 1));
+  for (i = 0; i < NonceLength; i++)
+  {
+    header[1 + i] = Nonce[i];
+  }
+  for (i = 0; i < q; i++)
+  {
+    header[15 - i] = (uint8_t)((i < 4) ? (PayloadLength >> (i * 8)) : 0);
+  }
+  if (CRYP_CCMAbsorb(CCM, header, 16) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* Encoding of the AAD length */
+  if (AADLength != 0)
+  {
+    if (AADLength < 0xFF00)
+    {
+      header[0] = (uint8_t)(AADLength >> 8);
+      header[1] = (uint8_t)AADLength;
+      i = 2;
+    }
+    else
+    {
+      header[0] = 0xFF;
+      header[1] = 0xFE;
+      header[2] = (uint8_t)(AADLength >> 24);
+      header[3] = (uint8_t)(AADLength >> 16);
+      header[4] = (uint8_t)(AADLength >> 8);
+      header[5] = (uint8_t)AADLength;
+      i = 6;
+    }
+    if (CRYP_CCMAbsorb(CCM, header, i) != SUCCESS)
+    {
+      return ERROR;
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Authenticates additional data of an AES-CCM message.
+  * @param  CCM: pointer to the CRYP_CCMTypeDef structure of the message.
+  * @param  AAD: pointer to the additional authenticated data.
+  * @param  Length: length of AAD in bytes, any value.
+  * @note   This function must be called before CRYP_CCMUpdate(), for AADLength
+  *         bytes in total.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+ErrorStatus CRYP_CCMUpdateAAD(CRYP_CCMTypeDef* CCM, uint8_t* AAD, uint32_t Length)
+{
+  if ((CCM->State != CRYP_AEAD_STATE_AAD) || (Length > (CCM->AADLength - CCM->AADCount)))
+  {
+    return ERROR;
+  }
+  CCM->AADCount += Length;
+
+  return CRYP_CCMAbsorb(CCM, AAD, Length);
+}
+
+/**
+  * @brief  Encrypts or decrypts a part of an AES-CCM payload.
+  * @param  CCM: pointer to the CRYP_CCMTypeDef structure of the message.
+  * @param  Input: pointer to the Input buffer, aligned on 16 bytes.
+  * @param  Length: length of the Input buffer, a multiple of 16 except for the
+  *         last part of the payload.
+  * @param  Output: pointer to the returned buffer, aligned on 16 bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+ErrorStatus CRYP_CCMUpdate(CRYP_CCMTypeDef* CCM, uint8_t* Input, uint32_t Length, uint8_t* Output)
+{
+  uint32_t* block = CRYP_AEAD_ALIGN(CCM->Buffer);
+  uint32_t* stage = CRYP_AEAD_ALIGN(CCM->Stage);
+  uint32_t full = Length & ~(uint32_t)0xF;
+  uint32_t tail = Length & 0xF;
+  uint32_t offset = 0, n = 0, i = 0;
+  ErrorStatus status = SUCCESS;
+
+  if ((CCM->State == CRYP_AEAD_STATE_FINAL) ||
+      (Length > (CCM->PayloadLength - CCM->PayloadCount)) ||
+      ((((uint32_t)Input | (uint32_t)Output) & 0xF) != 0))
+  {
+    return ERROR;
+  }
+
+  /* The AAD end with a zero padded block */
+  if (CCM->State == CRYP_AEAD_STATE_AAD)
+  {
+    if ((CCM->AADCount != CCM->AADLength) || (CRYP_CCMFlush(CCM) != SUCCESS))
+    {
+      return ERROR;
+    }
+    CCM->State = CRYP_AEAD_STATE_DATA;
+  }
+
+  /* The CBC-MAC runs on the plaintext: before the CTR job in place for an
+     encryption, after it for a decryption */
+  for (offset = 0; offset < full; offset += n)
+  {
+    n = full - offset;
+    if (n > CRYP_AEAD_CHUNK)
+    {
+      n = CRYP_AEAD_CHUNK;
+    }
+    if (CCM->Mode == MODE_ENCRYPT)
+    {
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[0], &CCM->SessionMAC, (uint32_t*)(Input + offset), stage, n);
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[1], &CCM->SessionCTR, (uint32_t*)(Input + offset),
+                      (uint32_t*)(Output + offset), n);
+    }
+    else
+    {
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[1], &CCM->SessionCTR, (uint32_t*)(Input + offset),
+                      (uint32_t*)(Output + offset), n);
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[0], &CCM->SessionMAC, (uint32_t*)(Output + offset), stage, n);
+    }
+    status = CRYP_AEADWait(&CCM->Job[0]);
+    if ((CRYP_AEADWait(&CCM->Job[1]) != SUCCESS) || (status != SUCCESS))
+    {
+      return ERROR;
+    }
+    for (i = 0; i < 4; i++)
+    {
+      CCM->Mac[i] = stage[(n / 4) - 4 + i];
+    }
+  }
+
+  /* Last partial block through the aligned buffer */
+  if (tail != 0)
+  {
+    for (i = 0; i < 4; i++)
+    {
+      block[i] = 0;
+    }
+    for (i = 0; i < tail; i++)
+    {
+      ((uint8_t*)block)[i] = Input[full + i];
+    }
+    if (CCM->Mode == MODE_ENCRYPT)
+    {
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[0], &CCM->SessionMAC, block, stage, 16);
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[1], &CCM->SessionCTR, block, block, 16);
+      status = CRYP_AEADWait(&CCM->Job[0]);
+      if ((CRYP_AEADWait(&CCM->Job[1]) != SUCCESS) || (status != SUCCESS))
+      {
+        return ERROR;
+      }
+    }
+    else
+    {
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[1], &CCM->SessionCTR, block, block, 16);
+      if (CRYP_AEADWait(&CCM->Job[1]) != SUCCESS)
+      {
+        return ERROR;
+      }
+      /* The padding of the plaintext block is zero */
+      for (i = tail; i < 16; i++)
+      {
+        ((uint8_t*)block)[i] = 0;
+      }
+      CRYP_AEADSubmit(CCM->Stream, &CCM->Job[0], &CCM->SessionMAC, block, stage, 16);
+      if (CRYP_AEADWait(&CCM->Job[0]) != SUCCESS)
+      {
+        return ERROR;
+      }
+    }
+    for (i = 0; i < 4; i++)
+    {
+      CCM->Mac[i] = stage[i];
+    }
+    for (i = 0; i < tail; i++)
+    {
+      Output[full + i] = ((uint8_t*)block)[i];
+    }
+    CCM->State = CRYP_AEAD_STATE_FINAL;
+  }
+
+  CCM->PayloadCount += Length;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Ends an AES-CCM message: writes the tag of an encryption, or checks
+  *         the tag of a decryption.
+  * @param  CCM: pointer to the CRYP_CCMTypeDef structure of the message.
+  * @param  Tag: the tag of TagLength bytes, written or checked.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done, and the tag matches for a decryption
+  *          - ERROR: Operation failed, or the tag does not match
+  */
+ErrorStatus CRYP_CCMFinish(CRYP_CCMTypeDef* CCM, uint8_t* Tag)
+{
+  uint8_t byte = 0, diff = 0;
+  uint32_t i = 0;
+
+  if (CCM->State == CRYP_AEAD_STATE_AAD)
+  {
+    if ((CCM->AADCount != CCM->AADLength) || (CRYP_CCMFlush(CCM) != SUCCESS))
+    {
+      return ERROR;
+    }
+  }
+  CCM->State = CRYP_AEAD_STATE_FINAL;
+
+  if (CCM->PayloadCount != CCM->PayloadLength)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < CCM->TagLength; i++)
+  {
+    byte = (uint8_t)(((uint8_t*)CCM->Mac)[i] ^ ((uint8_t*)CCM->Mask)[i]);
+    if (CCM->Mode == MODE_ENCRYPT)
+    {
+      Tag[i] = byte;
+    }
+    else
+    {
+      diff |= (uint8_t)(Tag[i] ^ byte);
+    }
+  }
+
+  return (diff == 0) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Computes the multiples of the hash key by the 4-bit values.
+  * @param  Table: the table of the 16 multiples.
+  * @param  H: the hash key, most significant word first.
+  * @retval None
+  */
+static void CRYP_GHASHTable(uint32_t Table[16][4], const uint32_t H[4])
+{
+  uint32_t i = 0, j = 0, k = 0;
+  uint32_t* v;
+
+  for (k = 0; k < 4; k++)
+  {
+    Table[0][k] = 0;
+    Table[8][k] = H[k];
+  }
+
+  /* H.x, H.x^2 and H.x^3 in the bit reflected order of GCM */
+  for (i = 4; i > 0; i >>= 1)
+  {
+    v = Table[i << 1];
+    Table[i][3] = (v[2] << 31) | (v[3] >> 1);
+    Table[i][2] = (v[1] << 31) | (v[2] >> 1);
+    Table[i][1] = (v[0] << 31) | (v[1] >> 1);
+    Table[i][0] = (v[0] >> 1) ^ (((v[3] & 1) != 0) ? 0xE1000000 : 0);
+  }
+
+  for (i = 2; i < 16; i <<= 1)
+  {
+    for (j = 1; j < i; j++)
+    {
+      for (k = 0; k < 4; k++)
+      {
+        Table[i + j][k] = Table[i][k] ^ Table[j][k];
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Multiplies a value by the hash key, 4 bits at a time.
+  * @param  Table: the table of the 16 multiples of the hash key.
+  * @param  X: the value, most significant word first, replaced by the product.
+  * @retval None
+  */
+static void CRYP_GHASHMult(uint32_t Table[16][4], uint32_t X[4])
+{
+  uint32_t z0, z1, z2, z3, rem, byte, nibble;
+  int32_t i = 0;
+
+  nibble = X[3] & 0xF;
+  z0 = Table[nibble][0];
+  z1 = Table[nibble][1];
+  z2 = Table[nibble][2];
+  z3 = Table[nibble][3];
+
+  for (i = 15; i >= 0; i--)
+  {
+    byte = (X[i >> 2] >> (24 - ((i & 3) << 3))) & 0xFF;
+
+    if (i != 15)
+    {
+      rem = z3 & 0xF;
+      z3 = (z2 << 28) | (z3 >> 4);
+      z2 = (z1 << 28) | (z2 >> 4);
+      z1 = (z0 << 28) | (z1 >> 4);
+      z0 = (z0 >> 4) ^ ((uint32_t)CRYP_GHASHLast4[rem] << 16);
+      nibble = byte & 0xF;
+      z0 ^= Table[nibble][0];
+      z1 ^= Table[nibble][1];
+      z2 ^= Table[nibble][2];
+      z3 ^= Table[nibble][3];
+    }
+
+    rem = z3 & 0xF;
+    z3 = (z2 << 28) | (z3 >> 4);
+    z2 = (z1 << 28) | (z2 >> 4);
+    z1 = (z0 << 28) | (z1 >> 4);
+    z0 = (z0 >> 4) ^ ((uint32_t)CRYP_GHASHLast4[rem] << 16);
+    nibble = byte >> 4;
+    z0 ^= Table[nibble][0];
+    z1 ^= Table[nibble][1];
+    z2 ^= Table[nibble][2];
+    z3 ^= Table[nibble][3];
+  }
+
+  X[0] = z0;
+  X[1] = z1;
+  X[2] = z2;
+  X[3] = z3;
+}
+
+/**
+  * @brief  Hashes data into a GHASH accumulator.
+  * @param  Table: the table of the 16 multiples of the hash key.
+  * @param  Hash: the GHASH accumulator.
+  * @param  Data: the data, any alignment.
+  * @param  Length: the length of Data; a last partial block is zero padded.
+  * @retval None
+  */
+static void CRYP_GHASHUpdate(uint32_t Table[16][4], uint32_t Hash[4], const uint8_t* Data, uint32_t Length)
+{
+  uint8_t pad[16];
+  uint32_t i = 0;
+
+  for (; Length >= 16; Length -= 16)
+  {
+    Hash[0] ^= __REV(*(uint32_t*)(Data));
+    Hash[1] ^= __REV(*(uint32_t*)(Data + 4));
+    Hash[2] ^= __REV(*(uint32_t*)(Data + 8));
+    Hash[3] ^= __REV(*(uint32_t*)(Data + 12));
+    CRYP_GHASHMult(Table, Hash);
+    Data += 16;
+  }
+
+  if (Length != 0)
+  {
+    for (i = 0; i < 16; i++)
+    {
+      pad[i] = (uint8_t)((i < Length) ? Data[i] : 0);
+    }
+    CRYP_GHASHUpdate(Table, Hash, pad, 16);
+  }
+}
+
+/**
+  * @brief  Queues a job of a session on the streaming engine.
+  * @param  Stream: the streaming engine.
+  * @param  Job: the job.
+  * @param  Session: the session of the job.
+  * @param  Input: the input, aligned on 16 bytes.
+  * @param  Output: the output, aligned on 16 bytes.
+  * @param  Length: the length, a multiple of 16.
+  * @retval None
+  */
+static void CRYP_AEADSubmit(CRYP_StreamTypeDef* Stream, CRYP_StreamJobTypeDef* Job,
+                            CRYP_StreamSessionTypeDef* Session, uint32_t* Input,
+                            uint32_t* Output, uint32_t Length)
+{
+  Job->Session = Session;
+  Job->pInput = Input;
+  Job->pOutput = Output;
+  Job->Length = Length;
+  Job->Callback = 0;
+
+  if (CRYP_StreamSubmit(Stream, Job) != SUCCESS)
+  {
+    Job->Status = CRYP_STREAM_JOB_ERROR;
+  }
+}
+
+/**
+  * @brief  Waits for the end of a job.
+  * @param  Job: the job.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the output of the job is written
+  *          - ERROR: the job failed
+  */
+static ErrorStatus CRYP_AEADWait(CRYP_StreamJobTypeDef* Job)
+{
+  while ((Job->Status == CRYP_STREAM_JOB_QUEUED) || (Job->Status == CRYP_STREAM_JOB_ACTIVE))
+  {
+  }
+
+  return (Job->Status == CRYP_STREAM_JOB_DONE) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Appends bytes to the CBC-MAC blocks of an AES-CCM message.
+  * @param  CCM: pointer to the CRYP_CCMTypeDef structure of the message.
+  * @param  Data: the bytes.
+  * @param  Length: the number of bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+static ErrorStatus CRYP_CCMAbsorb(CRYP_CCMTypeDef* CCM, const uint8_t* Data, uint32_t Length)
+{
+  uint8_t* stage = (uint8_t*)CRYP_AEAD_ALIGN(CCM->Stage);
+
+  while (Length != 0)
+  {
+    stage[CCM->StageLength++] = *Data++;
+    Length--;
+    if ((CCM->StageLength == CRYP_AEAD_CHUNK) && (CRYP_CCMFlush(CCM) != SUCCESS))
+    {
+      return ERROR;
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Runs the CBC-MAC on the blocks of an AES-CCM message, the last one
+  *         zero padded.
+  * @param  CCM: pointer to the CRYP_CCMTypeDef structure of the message.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: Operation done
+  *          - ERROR: Operation failed
+  */
+static ErrorStatus CRYP_CCMFlush(CRYP_CCMTypeDef* CCM)
+{
+  uint32_t* stage = CRYP_AEAD_ALIGN(CCM->Stage);
+  uint32_t i = 0;
+
+  if (CCM->StageLength == 0)
+  {
+    return SUCCESS;
+  }
+  while ((CCM->StageLength & 0xF) != 0)
+  {
+    ((uint8_t*)stage)[CCM->StageLength++] = 0;
+  }
+
+  CRYP_AEADSubmit(CCM->Stream, &CCM->Job[0], &CCM->SessionMAC, stage, stage, CCM->StageLength);
+  if (CRYP_AEADWait(&CCM->Job[0]) != SUCCESS)
+  {
+    return ERROR;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    CCM->Mac[i] = stage[(CCM->StageLength / 4) - 4 + i];
+  }
+  CCM->StageLength = 0;
+
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,609 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_cryp_stream.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a DMA driven AES streaming engine for the CRYP:
+  *           - Sessions holding a key, a mode and the chaining state
+  *           - Queue of jobs processed by the DMA, with completion callbacks
+  *           - AES key preparation once per session load, not per buffer
+  *           - Context swapping between sessions
+  *          It uses the stm32f4xx_cryp.c/.h and stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the CRYP clock using
+  *             RCC_AHB2PeriphClockCmd(RCC_AHB2Periph_CRYP, ENABLE); and the
+  *             DMA2 clock, and call DMA_MgrInit().
+  *
+  *          2. Call CRYP_StreamInit() with a CRYP_StreamTypeDef structure, and
+  *             DMA_MgrIRQHandler() from the interrupt handlers of the streams of
+  *             the CRYP_IN and CRYP_OUT requests.
+  *
+  *          3. Create a session for each key and direction using
+  *             CRYP_StreamSessionInit().
+  *
+  *          4. Queue the buffers to encrypt or decrypt with CRYP_StreamSubmit().
+  *             The Callback of each job is called when its output is written.
+  *             The jobs of a session are chained: in CBC and CTR modes a
+  *             message may be given in several jobs.
+  *
+  *          5. Abort the jobs with CRYP_StreamAbort(), and release the DMA
+  *             streams with CRYP_StreamDeInit().
+  *
+  * @note   After a job ended with an error or aborted, the chaining state of
+  *         its session is lost: initialize the session again.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_cryp_stream.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup CRYP
+  * @brief CRYP driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define AESBUSY_TIMEOUT    ((uint32_t) 0x00010000)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static ErrorStatus CRYP_StreamLoad(CRYP_StreamTypeDef* Stream, CRYP_StreamSessionTypeDef* Session);
+static void CRYP_StreamNext(CRYP_StreamTypeDef* Stream);
+static void CRYP_StreamEnd(CRYP_StreamTypeDef* Stream, CRYP_StreamJobTypeDef* Job, uint32_t Status);
+static void CRYP_StreamInDone(DMA_MgrXferTypeDef* Xfer);
+static void CRYP_StreamOutDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup CRYP_Private_Functions
+  * @{
+  */
+
+/** @defgroup CRYP_Group9 AES streaming functions
+ *  @brief   AES streaming functions
+ *
+@verbatim
+ ===============================================================================
+                          AES streaming functions
+ ===============================================================================
+
+  This subsection provides functions allowing to encrypt and decrypt buffers in
+  the background, the DMA feeding the IN FIFO and emptying the OUT FIFO of the
+  CRYP.
+
+  The high level functions CRYP_AES_ECB(), CRYP_AES_CBC() and CRYP_AES_CTR()
+  convert the key, run the key preparation for a decryption and poll the CRYP
+  for each call. Here this work is done once:
+   - CRYP_StreamSessionInit() converts the key and the initialization vector
+     into the order of the registers.
+   - The engine loads a session only when a job of another session starts.
+     For ECB and CBC decryptions, the key preparation runs at this load and
+     the prepared key stays in the key registers for the following jobs of
+     the session. The key registers are write only: switching back to a
+     decryption session prepares its key again.
+   - The chaining state of the session in the CRYP (the initialization vector
+     registers) is saved by CRYP_SaveContext() when another session is loaded,
+     and restored with the session.
+
+  Each job is one DMA transfer on each side, with 4-word bursts from the FIFO
+  of the streams. The output stream has the higher priority so that the OUT
+  FIFO never stalls the CRYP. The next job starts from the interrupt of the
+  end of the previous one, before its Callback is called.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a CRYP streaming engine: allocates the streams of the
+  *         CRYP DMA requests.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the engine is ready
+  *          - ERROR: no free DMA stream
+  */
+ErrorStatus CRYP_StreamInit(CRYP_StreamTypeDef* Stream)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+
+  Stream->Head = 0;
+  Stream->Tail = 0;
+  Stream->Active = 0;
+  Stream->Current = 0;
+  Stream->Jobs = 0;
+  Stream->Switches = 0;
+  Stream->KeyPreparations = 0;
+
+  /* IN FIFO: memory to CRYP_DR, bursts of 4 words */
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&CRYP->DR;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+  DMA_InitStructure.DMA_BufferSize = 4;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
+  DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+  DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
+  Stream->StreamIn = DMA_MgrAlloc(DMA_MGR_REQ_CRYP_IN, &DMA_InitStructure);
+  if (Stream->StreamIn == 0)
+  {
+    return ERROR;
+  }
+
+  /* OUT FIFO: CRYP_DOUT to memory */
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&CRYP->DOUT;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
+  Stream->StreamOut = DMA_MgrAlloc(DMA_MGR_REQ_CRYP_OUT, &DMA_InitStructure);
+  if (Stream->StreamOut == 0)
+  {
+    DMA_MgrFree(Stream->StreamIn);
+    Stream->StreamIn = 0;
+    return ERROR;
+  }
+
+  CRYP_DMACmd(CRYP_DMAReq_DataIN | CRYP_DMAReq_DataOUT, DISABLE);
+  CRYP_Cmd(DISABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Aborts the jobs of a CRYP streaming engine and releases its DMA
+  *         streams.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @retval None
+  */
+void CRYP_StreamDeInit(CRYP_StreamTypeDef* Stream)
+{
+  CRYP_StreamAbort(Stream);
+  DMA_MgrFree(Stream->StreamIn);
+  DMA_MgrFree(Stream->StreamOut);
+  Stream->StreamIn = 0;
+  Stream->StreamOut = 0;
+}
+
+/**
+  * @brief  Initializes a session: converts the key and the initialization
+  *         vector into the order of the CRYP registers.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @param  Session: pointer to the CRYP_StreamSessionTypeDef structure of the
+  *         session.
+  * @param  CRYP_StreamSessionInitStruct: pointer to a
+  *         CRYP_StreamSessionInitTypeDef structure that contains the key and
+  *         the mode of the session.
+  * @note   No job of the session may be queued. The Key and IV buffers are no
+  *         longer used after this function returns.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the session is ready
+  *          - ERROR: invalid key size, mode or initialization vector
+  */
+ErrorStatus CRYP_StreamSessionInit(CRYP_StreamTypeDef* Stream, CRYP_StreamSessionTypeDef* Session,
+                                   const CRYP_StreamSessionInitTypeDef* CRYP_StreamSessionInitStruct)
+{
+  uint32_t* key = &Session->Key.CRYP_Key0Left;
+  uint32_t keyaddr = (uint32_t)CRYP_StreamSessionInitStruct->Key;
+  uint32_t ivaddr = (uint32_t)CRYP_StreamSessionInitStruct->IV;
+  uint32_t keysize = 0, index = 0;
+  uint32_t primask = 0;
+
+  /* Check the parameters */
+  assert_param(IS_CRYP_ALGODIR(CRYP_StreamSessionInitStruct->CRYP_AlgoDir));
+  assert_param(IS_CRYP_DATATYPE(CRYP_StreamSessionInitStruct->CRYP_DataType));
+
+  switch (CRYP_StreamSessionInitStruct->KeySize)
+  {
+    case 128:
+      keysize = CRYP_KeySize_128b;
+      break;
+    case 192:
+      keysize = CRYP_KeySize_192b;
+      break;
+    case 256:
+      keysize = CRYP_KeySize_256b;
+      break;
+    default:
+      return ERROR;
+  }
+  if ((CRYP_StreamSessionInitStruct->Key == 0) ||
+      !IS_CRYP_STREAM_ALGOMODE(CRYP_StreamSessionInitStruct->CRYP_AlgoMode) ||
+      ((CRYP_StreamSessionInitStruct->CRYP_AlgoMode != CRYP_AlgoMode_AES_ECB) &&
+       (CRYP_StreamSessionInitStruct->IV == 0)))
+  {
+    return ERROR;
+  }
+
+  /* The session may be the one loaded in the CRYP */
+  primask = NVIC_EnterCritical();
+  if (Stream->Current == Session)
+  {
+    Stream->Current = 0;
+  }
+  NVIC_ExitCritical(primask);
+
+  /* The key fills the key registers from the last one */
+  CRYP_KeyStructInit(&Session->Key);
+  for (index = 8 - (CRYP_StreamSessionInitStruct->KeySize / 32); index < 8; index++)
+  {
+    key[index] = __REV(*(uint32_t*)(keyaddr));
+    keyaddr += 4;
+  }
+
+  Session->Context.CR_bits9to2 = keysize | CRYP_StreamSessionInitStruct->CRYP_DataType |
+                                 CRYP_StreamSessionInitStruct->CRYP_AlgoMode |
+                                 CRYP_StreamSessionInitStruct->CRYP_AlgoDir;
+  Session->Context.CRYP_K0LR = Session->Key.CRYP_Key0Left;
+  Session->Context.CRYP_K0RR = Session->Key.CRYP_Key0Right;
+  Session->Context.CRYP_K1LR = Session->Key.CRYP_Key1Left;
+  Session->Context.CRYP_K1RR = Session->Key.CRYP_Key1Right;
+  Session->Context.CRYP_K2LR = Session->Key.CRYP_Key2Left;
+  Session->Context.CRYP_K2RR = Session->Key.CRYP_Key2Right;
+  Session->Context.CRYP_K3LR = Session->Key.CRYP_Key3Left;
+  Session->Context.CRYP_K3RR = Session->Key.CRYP_Key3Right;
+
+  if (CRYP_StreamSessionInitStruct->CRYP_AlgoMode != CRYP_AlgoMode_AES_ECB)
+  {
+    Session->Context.CRYP_IV0LR = __REV(*(uint32_t*)(ivaddr));
+    ivaddr += 4;
+    Session->Context.CRYP_IV0RR = __REV(*(uint32_t*)(ivaddr));
+    ivaddr += 4;
+    Session->Context.CRYP_IV1LR = __REV(*(uint32_t*)(ivaddr));
+    ivaddr += 4;
+    Session->Context.CRYP_IV1RR = __REV(*(uint32_t*)(ivaddr));
+  }
+  else
+  {
+    Session->Context.CRYP_IV0LR = 0;
+    Session->Context.CRYP_IV0RR = 0;
+    Session->Context.CRYP_IV1LR = 0;
+    Session->Context.CRYP_IV1RR = 0;
+  }
+
+  /* The CTR mode decrypts with the encryption key */
+  Session->Prepare = (uint8_t)((CRYP_StreamSessionInitStruct->CRYP_AlgoDir == CRYP_AlgoDir_Decrypt) &&
+                               (CRYP_StreamSessionInitStruct->CRYP_AlgoMode != CRYP_AlgoMode_AES_CTR));
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Queues a job on a CRYP streaming engine.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @param  Job: pointer to the CRYP_StreamJobTypeDef structure of the job, with
+  *         its Session, pInput, pOutput, Length and Callback members set. It
+  *         must stay valid until the job ends.
+  * @note   This function may be called from a job Callback.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the job is queued
+  *          - ERROR: invalid length or buffer alignment
+  */
+ErrorStatus CRYP_StreamSubmit(CRYP_StreamTypeDef* Stream, CRYP_StreamJobTypeDef* Job)
+{
+  uint32_t primask = 0;
+
+  if ((Job->Session == 0) || !IS_CRYP_STREAM_LENGTH(Job->Length) ||
+      (((uint32_t)Job->pInput & 0xF) != 0) || (((uint32_t)Job->pOutput & 0xF) != 0))
+  {
+    return ERROR;
+  }
+
+  Job->XferIn.MemoryBaseAddr = (uint32_t)Job->pInput;
+  Job->XferIn.Count = (uint16_t)(Job->Length / 4);
+  Job->XferIn.Callback = CRYP_StreamInDone;
+  Job->XferIn.Context = Job;
+  Job->XferOut.MemoryBaseAddr = (uint32_t)Job->pOutput;
+  Job->XferOut.Count = (uint16_t)(Job->Length / 4);
+  Job->XferOut.Callback = CRYP_StreamOutDone;
+  Job->XferOut.Context = Job;
+  Job->Stream = Stream;
+  Job->Status = CRYP_STREAM_JOB_QUEUED;
+  Job->Next = 0;
+
+  primask = NVIC_EnterCritical();
+
+  if (Stream->Tail != 0)
+  {
+    Stream->Tail->Next = Job;
+  }
+  else
+  {
+    Stream->Head = Job;
+  }
+  Stream->Tail = Job;
+
+  CRYP_StreamNext(Stream);
+
+  NVIC_ExitCritical(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Aborts the job in progress and the queued jobs.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @note   The Callback of the jobs is called with their Status set to
+  *         CRYP_STREAM_JOB_ABORTED.
+  * @retval None
+  */
+void CRYP_StreamAbort(CRYP_StreamTypeDef* Stream)
+{
+  CRYP_StreamJobTypeDef* queued = 0;
+  CRYP_StreamJobTypeDef* job = 0;
+  uint32_t primask = NVIC_EnterCritical();
+
+  queued = Stream->Head;
+  Stream->Head = 0;
+  Stream->Tail = 0;
+
+  /* The job in progress ends in the callback of its output transfer */
+  if (Stream->Active != 0)
+  {
+    Stream->Active->Status = CRYP_STREAM_JOB_ABORTED;
+    DMA_MgrAbort(Stream->StreamIn);
+    DMA_MgrAbort(Stream->StreamOut);
+  }
+
+  while (queued != 0)
+  {
+    job = queued;
+    queued = job->Next;
+    job->Status = CRYP_STREAM_JOB_ABORTED;
+    if (job->Callback != 0)
+    {
+      job->Callback(job);
+    }
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Loads a session in the CRYP: saves the chaining state of the
+  *         session it replaces, then writes the key, running the key
+  *         preparation if needed, the configuration and the initialization
+  *         vector.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @param  Session: the session to load.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the session is loaded
+  *          - ERROR: the key preparation timed out
+  */
+static ErrorStatus CRYP_StreamLoad(CRYP_StreamTypeDef* Stream, CRYP_StreamSessionTypeDef* Session)
+{
+  CRYP_InitTypeDef CRYP_InitStructure;
+  CRYP_IVInitTypeDef CRYP_IVInitStructure;
+  __IO uint32_t counter = 0;
+  uint32_t busystatus = 0;
+
+  if ((Stream->Current != 0) &&
+      ((Stream->Current->Context.CR_bits9to2 & CRYP_CR_ALGOMODE) != CRYP_AlgoMode_AES_ECB))
+  {
+    CRYP_SaveContext(&Stream->Current->Context, &Stream->Current->Key);
+  }
+  Stream->Current = 0;
+  Stream->Switches++;
+
+  CRYP_Cmd(DISABLE);
+
+  if (Session->Prepare == 0)
+  {
+    CRYP_RestoreContext(&Session->Context);
+    CRYP_Cmd(DISABLE);
+  }
+  else
+  {
+    /* Key preparation for the decryption */
+    CRYP_InitStructure.CRYP_AlgoDir = CRYP_AlgoDir_Decrypt;
+    CRYP_InitStructure.CRYP_AlgoMode = CRYP_AlgoMode_AES_Key;
+    CRYP_InitStructure.CRYP_DataType = CRYP_DataType_32b;
+    CRYP_InitStructure.CRYP_KeySize = (uint16_t)(Session->Context.CR_bits9to2 & CRYP_CR_KEYSIZE);
+    CRYP_Init(&CRYP_InitStructure);
+    CRYP_KeyInit(&Session->Key);
+    CRYP_Cmd(ENABLE);
+
+    do
+    {
+      busystatus = CRYP_GetFlagStatus(CRYP_FLAG_BUSY);
+      counter++;
+    }while ((counter != AESBUSY_TIMEOUT) && (busystatus != RESET));
+
+    CRYP_Cmd(DISABLE);
+    Stream->KeyPreparations++;
+
+    if (busystatus != RESET)
+    {
+      return ERROR;
+    }
+
+    /* The prepared key stays in the key registers */
+    CRYP->CR = Session->Context.CR_bits9to2;
+    CRYP_IVInitStructure.CRYP_IV0Left = Session->Context.CRYP_IV0LR;
+    CRYP_IVInitStructure.CRYP_IV0Right = Session->Context.CRYP_IV0RR;
+    CRYP_IVInitStructure.CRYP_IV1Left = Session->Context.CRYP_IV1LR;
+    CRYP_IVInitStructure.CRYP_IV1Right = Session->Context.CRYP_IV1RR;
+    CRYP_IVInit(&CRYP_IVInitStructure);
+  }
+
+  Stream->Current = Session;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts the next queued job if the engine is idle.
+  * @note   This function is called with the interrupts disabled or from the
+  *         DMA interrupt of the engine.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @retval None
+  */
+static void CRYP_StreamNext(CRYP_StreamTypeDef* Stream)
+{
+  CRYP_StreamJobTypeDef* job = 0;
+
+  while ((Stream->Active == 0) && (Stream->Head != 0))
+  {
+    job = Stream->Head;
+    Stream->Head = job->Next;
+    if (Stream->Head == 0)
+    {
+      Stream->Tail = 0;
+    }
+    job->Next = 0;
+
+    if ((job->Session != Stream->Current) && (CRYP_StreamLoad(Stream, job->Session) != SUCCESS))
+    {
+      job->Status = CRYP_STREAM_JOB_ERROR;
+      if (job->Callback != 0)
+      {
+        job->Callback(job);
+      }
+      continue;
+    }
+
+    Stream->Active = job;
+    job->Status = CRYP_STREAM_JOB_ACTIVE;
+
+    /* The FIFOs are flushed while the CRYP is disabled */
+    CRYP_FIFOFlush();
+    CRYP_Cmd(ENABLE);
+
+    DMA_MgrSubmit(Stream->StreamOut, &job->XferOut);
+    DMA_MgrSubmit(Stream->StreamIn, &job->XferIn);
+    CRYP_DMACmd(CRYP_DMAReq_DataIN | CRYP_DMAReq_DataOUT, ENABLE);
+  }
+}
+
+/**
+  * @brief  Ends the job in progress, starts the next one and calls the
+  *         Callback of the job.
+  * @param  Stream: pointer to the CRYP_StreamTypeDef structure of the engine.
+  * @param  Job: the job in progress.
+  * @param  Status: the final status of the job.
+  * @retval None
+  */
+static void CRYP_StreamEnd(CRYP_StreamTypeDef* Stream, CRYP_StreamJobTypeDef* Job, uint32_t Status)
+{
+  CRYP_DMACmd(CRYP_DMAReq_DataIN | CRYP_DMAReq_DataOUT, DISABLE);
+  CRYP_Cmd(DISABLE);
+
+  if (Status == CRYP_STREAM_JOB_DONE)
+  {
+    Stream->Jobs++;
+  }
+  else
+  {
+    /* The chaining state of the session is unknown */
+    Stream->Current = 0;
+  }
+
+  Stream->Active = 0;
+  Job->Status = Status;
+  CRYP_StreamNext(Stream);
+
+  if (Job->Callback != 0)
+  {
+    Job->Callback(Job);
+  }
+}
+
+/**
+  * @brief  Ends the input transfer of a job: on an error, aborts the output
+  *         transfer, which ends the job.
+  * @param  Xfer: the input DMA transfer of the job.
+  * @retval None
+  */
+static void CRYP_StreamInDone(DMA_MgrXferTypeDef* Xfer)
+{
+  CRYP_StreamJobTypeDef* job = (CRYP_StreamJobTypeDef*)Xfer->Context;
+  CRYP_StreamTypeDef* stream = job->Stream;
+
+  if ((Xfer->Status == DMA_MGR_XFER_ERROR) && (stream->Active == job))
+  {
+    job->Status = CRYP_STREAM_JOB_ERROR;
+    DMA_MgrAbort(stream->StreamOut);
+  }
+}
+
+/**
+  * @brief  Ends the output transfer of a job, and the job.
+  * @param  Xfer: the output DMA transfer of the job.
+  * @retval None
+  */
+static void CRYP_StreamOutDone(DMA_MgrXferTypeDef* Xfer)
+{
+  CRYP_StreamJobTypeDef* job = (CRYP_StreamJobTypeDef*)Xfer->Context;
+  CRYP_StreamTypeDef* stream = job->Stream;
+  uint32_t status = CRYP_STREAM_JOB_DONE;
+
+  if (stream->Active != job)
+  {
+    return;
+  }
+
+  if (Xfer->Status == DMA_MGR_XFER_ERROR)
+  {
+    status = CRYP_STREAM_JOB_ERROR;
+    DMA_MgrAbort(stream->StreamIn);
+  }
+  else if (Xfer->Status == DMA_MGR_XFER_ABORTED)
+  {
+    /* Aborted by CRYP_StreamAbort() or after an error of the input transfer */
+    status = job->Status;
+  }
+
+  CRYP_StreamEnd(stream, job, status);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
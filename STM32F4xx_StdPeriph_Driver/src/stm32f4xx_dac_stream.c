@@ -0,0 +1,320 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_dac_stream.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a streaming layer for the DAC, to output
+  *          continuous waveforms without CPU per sample:
+  *           - Sample clock from TIM6 or TIM7, computed from the sample rate
+  *           - One channel, or both channels with packed 12-bit samples
+  *           - Double buffering by DMA, with a producer callback per half
+  *             buffer
+  *          It uses the stm32f4xx_dac.c/.h, stm32f4xx_tim.c/.h and
+  *          stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the DAC, TIM6 or TIM7, GPIO and DMA1 clocks, configure the
+  *             DAC pins (PA4, PA5) in analog mode and call DMA_MgrInit().
+  *
+  *          2. Call DAC_StreamInit() with a DAC_StreamTypeDef structure, and call
+  *             DMA_MgrIRQHandler() from the interrupt handler of the stream of the
+  *             DAC request (DMA1 Stream5 for channel 1 and both channels, DMA1
+  *             Stream6 for channel 2 alone in the default table).
+  *
+  *          3. Start the output with DAC_StreamStart(). The Fill callback writes
+  *             the next samples each time a half of the buffer has been played,
+  *             for example from the signal generators of the CMSIS DSP library.
+  *
+  *          4. Pause the output with DAC_StreamStop(), and release the DMA stream
+  *             with DAC_StreamDeInit().
+  *
+  * @note   The Fill callback has the time of half the buffer to write its
+  *         samples: BufferSamples / (2 * SampleRate) seconds.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_dac_stream.h"
+#include "stm32f4xx_rcc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup DAC
+  * @brief DAC driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void DAC_StreamHalfDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup DAC_Private_Functions
+  * @{
+  */
+
+/** @defgroup DAC_Group4 DAC streaming functions
+ *  @brief   DAC streaming functions
+ *
+@verbatim
+ ===============================================================================
+                         DAC streaming functions
+ ===============================================================================
+
+  This subsection provides functions allowing to output a continuous stream of
+  samples on the DAC, at a sample rate given by a basic timer.
+
+  The update event of TIM6 or TIM7 is the trigger output of the timer and the
+  conversion trigger of the DAC channels. At each trigger the DAC moves its data
+  holding register to its output and requests the next sample from the DMA. For
+  both channels, the DMA writes the packed samples to the dual 12-bit right
+  aligned register, on the request of channel 1.
+
+  The DMA stream runs in the streaming mode of the DMA manager on the two halves
+  of Buffer. When a half has been played, the stream runs on the other one: the
+  Fill callback writes the next samples into the half just played, and the half
+  is queued again.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a DAC stream: configures the timer, the DAC channels and
+  *         the DMA, and fills the buffer.
+  * @param  Stream: pointer to the DAC_StreamTypeDef structure of the stream.
+  * @param  DAC_StreamInitStruct: pointer to a DAC_StreamInitTypeDef structure
+  *         that contains the configuration of the stream.
+  * @note   The timer clock is 2 x PCLK1 when the APB1 prescaler is not 1. The
+  *         sample rate obtained is returned in the SampleRate member of Stream.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the stream is ready to start
+  *          - ERROR: invalid configuration or no free DMA stream
+  */
+ErrorStatus DAC_StreamInit(DAC_StreamTypeDef* Stream, const DAC_StreamInitTypeDef* DAC_StreamInitStruct)
+{
+  DAC_InitTypeDef DAC_InitStructure;
+  TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+  DMA_InitTypeDef DMA_InitStructure;
+  RCC_ClocksTypeDef RCC_Clocks;
+  TIM_TypeDef* tim = DAC_StreamInitStruct->TIMx;
+  uint32_t channels = DAC_StreamInitStruct->Channels;
+  uint32_t half = DAC_StreamInitStruct->BufferSamples / 2;
+  uint32_t size = (channels == DAC_STREAM_DUAL) ? 4 : 2;
+  uint32_t clock = 0, ticks = 0, prescaler = 0, period = 0, index = 0;
+
+  /* Check the parameters */
+  assert_param(IS_DAC_STREAM_CHANNELS(channels));
+  assert_param(IS_DAC_OUTPUT_BUFFER_STATE(DAC_StreamInitStruct->DAC_OutputBuffer));
+
+  if (((tim != TIM6) && (tim != TIM7)) || (DAC_StreamInitStruct->SampleRate == 0) ||
+      (DAC_StreamInitStruct->Buffer == 0) || (DAC_StreamInitStruct->Fill == 0) ||
+      (half == 0) || ((DAC_StreamInitStruct->BufferSamples & 0x1) != 0))
+  {
+    return ERROR;
+  }
+
+  Stream->Init = *DAC_StreamInitStruct;
+  Stream->Underruns = 0;
+
+  /* Sample clock: prescaler and period of the timer, the period as long as
+     possible for the best accuracy */
+  RCC_GetClocksFreq(&RCC_Clocks);
+  clock = RCC_Clocks.PCLK1_Frequency;
+  if (RCC_Clocks.PCLK1_Frequency != RCC_Clocks.HCLK_Frequency)
+  {
+    clock *= 2;
+  }
+  ticks = (clock + (DAC_StreamInitStruct->SampleRate / 2)) / DAC_StreamInitStruct->SampleRate;
+  if (ticks == 0)
+  {
+    ticks = 1;
+  }
+  prescaler = ((ticks - 1) / 0x10000) + 1;
+  period = (ticks + (prescaler / 2)) / prescaler;
+  if (period == 0)
+  {
+    period = 1;
+  }
+  Stream->SampleRate = clock / (prescaler * period);
+
+  TIM_Cmd(tim, DISABLE);
+  TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+  TIM_TimeBaseStructure.TIM_Prescaler = (uint16_t)(prescaler - 1);
+  TIM_TimeBaseStructure.TIM_Period = period - 1;
+  TIM_TimeBaseInit(tim, &TIM_TimeBaseStructure);
+  TIM_SelectOutputTrigger(tim, TIM_TRGOSource_Update);
+
+  /* DMA: streaming mode on the two halves of Buffer */
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+  DMA_InitStructure.DMA_BufferSize = half;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  if (channels == DAC_STREAM_DUAL)
+  {
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&DAC->DHR12RD;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  }
+  else
+  {
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (channels == DAC_STREAM_CHANNEL1) ?
+                                               (uint32_t)&DAC->DHR12R1 : (uint32_t)&DAC->DHR12R2;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+  }
+  Stream->Stream = DMA_MgrAlloc((channels == DAC_STREAM_CHANNEL2) ? DMA_MGR_REQ_DAC2 : DMA_MGR_REQ_DAC1,
+                                &DMA_InitStructure);
+  if (Stream->Stream == 0)
+  {
+    return ERROR;
+  }
+
+  /* DAC channels triggered by the timer */
+  DAC_StructInit(&DAC_InitStructure);
+  DAC_InitStructure.DAC_Trigger = (tim == TIM6) ? DAC_Trigger_T6_TRGO : DAC_Trigger_T7_TRGO;
+  DAC_InitStructure.DAC_WaveGeneration = DAC_WaveGeneration_None;
+  DAC_InitStructure.DAC_OutputBuffer = DAC_StreamInitStruct->DAC_OutputBuffer;
+  if ((channels & DAC_STREAM_CHANNEL1) != 0)
+  {
+    DAC_Init(DAC_Channel_1, &DAC_InitStructure);
+    DAC_Cmd(DAC_Channel_1, ENABLE);
+  }
+  if ((channels & DAC_STREAM_CHANNEL2) != 0)
+  {
+    DAC_Init(DAC_Channel_2, &DAC_InitStructure);
+    DAC_Cmd(DAC_Channel_2, ENABLE);
+  }
+
+  for (index = 0; index < 2; index++)
+  {
+    Stream->Xfer[index].MemoryBaseAddr = (uint32_t)DAC_StreamInitStruct->Buffer + (index * half * size);
+    Stream->Xfer[index].Count = (uint16_t)half;
+    Stream->Xfer[index].Callback = DAC_StreamHalfDone;
+    Stream->Xfer[index].Context = Stream;
+    DAC_StreamInitStruct->Fill(Stream, (void*)Stream->Xfer[index].MemoryBaseAddr, (uint16_t)half);
+    DMA_MgrSubmit(Stream->Stream, &Stream->Xfer[index]);
+  }
+
+  /* The DMA request of channel 1 serves both channels */
+  DAC_DMACmd((channels == DAC_STREAM_CHANNEL2) ? DAC_Channel_2 : DAC_Channel_1, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a DAC stream and releases its DMA stream.
+  * @param  Stream: pointer to the DAC_StreamTypeDef structure of the stream.
+  * @note   The DAC channels keep the last sample.
+  * @retval None
+  */
+void DAC_StreamDeInit(DAC_StreamTypeDef* Stream)
+{
+  TIM_Cmd(Stream->Init.TIMx, DISABLE);
+  DAC_DMACmd((Stream->Init.Channels == DAC_STREAM_CHANNEL2) ? DAC_Channel_2 : DAC_Channel_1, DISABLE);
+  DMA_MgrFree(Stream->Stream);
+  Stream->Stream = 0;
+}
+
+/**
+  * @brief  Starts or resumes the output of a DAC stream.
+  * @param  Stream: pointer to the DAC_StreamTypeDef structure of the stream.
+  * @retval None
+  */
+void DAC_StreamStart(DAC_StreamTypeDef* Stream)
+{
+  TIM_Cmd(Stream->Init.TIMx, ENABLE);
+}
+
+/**
+  * @brief  Pauses the output of a DAC stream.
+  * @param  Stream: pointer to the DAC_StreamTypeDef structure of the stream.
+  * @note   The sample clock is stopped: the DAC channels keep the last sample,
+  *         and DAC_StreamStart() goes on with the next one.
+  * @retval None
+  */
+void DAC_StreamStop(DAC_StreamTypeDef* Stream)
+{
+  TIM_Cmd(Stream->Init.TIMx, DISABLE);
+}
+
+/**
+  * @brief  Fills a half of the buffer again once it has been played.
+  * @param  Xfer: the DMA transfer of the half.
+  * @retval None
+  */
+static void DAC_StreamHalfDone(DMA_MgrXferTypeDef* Xfer)
+{
+  DAC_StreamTypeDef* stream = (DAC_StreamTypeDef*)Xfer->Context;
+  uint32_t channel = (stream->Init.Channels == DAC_STREAM_CHANNEL2) ? DAC_Channel_2 : DAC_Channel_1;
+
+  if (Xfer->Status != DMA_MGR_XFER_DONE)
+  {
+    return;
+  }
+
+  /* The DMA manager stops the stream when the other half was not queued */
+  if (DMA_GetCmdStatus(stream->Stream) == DISABLE)
+  {
+    stream->Underruns++;
+  }
+  if (DAC_GetFlagStatus(channel, DAC_FLAG_DMAUDR) != RESET)
+  {
+    stream->Underruns++;
+    DAC_ClearFlag(channel, DAC_FLAG_DMAUDR);
+  }
+
+  stream->Init.Fill(stream, (void*)Xfer->MemoryBaseAddr, Xfer->Count);
+  DMA_MgrSubmit(stream->Stream, Xfer);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,540 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_dcmi_capture.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a continuous capture pipeline for the DCMI:
+  *           - Frames larger than one DMA transfer, split into segments
+  *             chained by the double buffer mode of the DMA
+  *           - Pool of frame buffers, in the SRAM or in an external memory
+  *             on the FSMC
+  *           - Frame, line and segment callbacks
+  *           - Resynchronization on overrun and synchronization errors
+  *          It uses the stm32f4xx_dcmi.c/.h and stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the DCMI, GPIO and DMA2 clocks, configure the DCMI pins in
+  *             alternate function and call DMA_MgrInit(). For frame buffers in
+  *             an external memory, configure the FSMC bank with
+  *             FSMC_NORSRAMInit() and enable it first.
+  *
+  *          2. Call DCMI_CaptureInit() with a DCMI_CaptureTypeDef structure and a
+  *             pool of frame buffers. Call DCMI_CaptureIRQHandler() from the DCMI
+  *             interrupt handler and DMA_MgrIRQHandler() from the interrupt
+  *             handler of the stream of the DCMI request, and enable the DCMI
+  *             interrupt using NVIC_Init().
+  *
+  *          3. Start the capture with DCMI_CaptureStart(). Each frame is given
+  *             to FrameCallback, and back to the pool with DCMI_CaptureRelease()
+  *             once the application has used it.
+  *             To process a frame while it is being captured, such as converting
+  *             its pixels with the CMSIS DSP library, set SegmentCallback: it is
+  *             given each segment of DCMI_CaptureGetSegmentSize() bytes as soon
+  *             as the DMA has written it.
+  *
+  *          4. Stop the capture with DCMI_CaptureStop(), and release the DMA
+  *             stream with DCMI_CaptureDeInit().
+  *
+  * @note   Two frame buffers are queued on the DMA at all times: the one being
+  *         captured and the next one. When the pool has no free frame buffer at
+  *         the end of a frame, the capture stops and restarts at the first frame
+  *         after DCMI_CaptureRelease().
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_dcmi_capture.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup DCMI
+  * @brief DCMI driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Largest DMA transfer in words, a multiple of the 4-word bursts */
+#define DCMI_CAPTURE_MAX_WORDS    ((uint32_t)65532)
+
+/* Frame buffers queued on the DMA */
+#define DCMI_CAPTURE_DEPTH        ((uint32_t)2)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void DCMI_CaptureFill(DCMI_CaptureTypeDef* Capture);
+static void DCMI_CaptureResync(DCMI_CaptureTypeDef* Capture);
+static void DCMI_CaptureSegmentDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup DCMI_Private_Functions
+  * @{
+  */
+
+/** @defgroup DCMI_Group4 DCMI capture functions
+ *  @brief   DCMI capture functions
+ *
+@verbatim
+ ===============================================================================
+                         DCMI capture functions
+ ===============================================================================
+
+  This subsection provides functions allowing to capture the frames of a camera
+  continuously into a pool of frame buffers.
+
+  A DMA transfer is at most 65535 data items, less than a VGA frame. The frame
+  is split into Segments transfers of SegmentWords words, the smallest number of
+  equal segments with a multiple of 4 words. The DMA stream runs in the
+  streaming mode of the DMA manager, with 4-word bursts from its FIFO: the
+  segments of a frame, then of the next frame, are chained by swapping the
+  memory targets of the double buffer mode, without stopping the stream.
+
+  The frame buffers go from the pool to the DMA, two at a time, then to the
+  application by FrameCallback at the end of their last segment, and back to
+  the pool by DCMI_CaptureRelease().
+
+  On a DCMI overrun, a synchronization error or a DMA error, the data of the
+  frame in progress are lost and the DMA no longer matches the frame: the
+  capture and the DMA are stopped, the frame buffers queued on the DMA go back
+  to the pool, and the capture restarts at the next frame.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a DCMI capture pipeline: configures the DCMI and
+  *         allocates the stream of its DMA request.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @param  DCMI_CaptureInitStruct: pointer to a DCMI_CaptureInitTypeDef
+  *         structure that contains the configuration of the pipeline.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the pipeline is ready to start
+  *          - ERROR: invalid configuration, frame larger than
+  *            DCMI_CAPTURE_MAX_SEGMENTS transfers, or no free DMA stream
+  */
+ErrorStatus DCMI_CaptureInit(DCMI_CaptureTypeDef* Capture, const DCMI_CaptureInitTypeDef* DCMI_CaptureInitStruct)
+{
+  DCMI_InitTypeDef DCMI_InitStructure;
+  DMA_InitTypeDef DMA_InitStructure;
+  DCMI_CaptureFrameTypeDef* frame = 0;
+  uint32_t words = DCMI_CaptureInitStruct->FrameSize / 4;
+  uint32_t segments = 1, index = 0, segment = 0;
+
+  if ((DCMI_CaptureInitStruct->Frames == 0) || (DCMI_CaptureInitStruct->NumFrames < 2) ||
+      (DCMI_CaptureInitStruct->FrameCallback == 0) || (words == 0) ||
+      ((DCMI_CaptureInitStruct->FrameSize & 0xF) != 0))
+  {
+    return ERROR;
+  }
+
+  /* Smallest number of equal segments of a multiple of 4 words */
+  while ((segments <= DCMI_CAPTURE_MAX_SEGMENTS) &&
+         (((words % segments) != 0) || (((words / segments) & 0x3) != 0) ||
+          ((words / segments) > DCMI_CAPTURE_MAX_WORDS)))
+  {
+    segments++;
+  }
+  if (segments > DCMI_CAPTURE_MAX_SEGMENTS)
+  {
+    return ERROR;
+  }
+
+  Capture->Init = *DCMI_CaptureInitStruct;
+  Capture->Segments = segments;
+  Capture->SegmentWords = words / segments;
+  Capture->FreeHead = 0;
+  Capture->FreeTail = 0;
+  Capture->QueuedHead = 0;
+  Capture->QueuedTail = 0;
+  Capture->Queued = 0;
+  Capture->Line = 0;
+  Capture->Running = 0;
+  Capture->Stalled = 0;
+  Capture->FrameCount = 0;
+  Capture->Dropped = 0;
+  Capture->Stalls = 0;
+
+  /* DMA: streaming mode, one segment per transfer, bursts of 4 words */
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&DCMI->DR;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  DMA_InitStructure.DMA_BufferSize = Capture->SegmentWords;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
+  DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
+  DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+  DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
+  Capture->Stream = DMA_MgrAlloc(DMA_MGR_REQ_DCMI, &DMA_InitStructure);
+  if (Capture->Stream == 0)
+  {
+    return ERROR;
+  }
+
+  /* Pool: the segments of each frame buffer */
+  for (index = 0; index < DCMI_CaptureInitStruct->NumFrames; index++)
+  {
+    frame = &DCMI_CaptureInitStruct->Frames[index];
+    for (segment = 0; segment < segments; segment++)
+    {
+      frame->Xfer[segment].MemoryBaseAddr = (uint32_t)(frame->pData + (segment * Capture->SegmentWords));
+      frame->Xfer[segment].Count = (uint16_t)Capture->SegmentWords;
+      frame->Xfer[segment].Callback = DCMI_CaptureSegmentDone;
+      frame->Xfer[segment].Context = frame;
+    }
+    frame->Capture = Capture;
+    frame->Status = DCMI_CAPTURE_FRAME_FREE;
+    frame->Next = 0;
+    if (Capture->FreeTail != 0)
+    {
+      Capture->FreeTail->Next = frame;
+    }
+    else
+    {
+      Capture->FreeHead = frame;
+    }
+    Capture->FreeTail = frame;
+  }
+
+  DCMI_InitStructure = DCMI_CaptureInitStruct->DCMI_InitStruct;
+  DCMI_InitStructure.DCMI_CaptureMode = DCMI_CaptureMode_Continuous;
+  DCMI_Init(&DCMI_InitStructure);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a DCMI capture pipeline and releases its DMA stream.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @retval None
+  */
+void DCMI_CaptureDeInit(DCMI_CaptureTypeDef* Capture)
+{
+  DCMI_CaptureStop(Capture);
+  DMA_MgrFree(Capture->Stream);
+  Capture->Stream = 0;
+}
+
+/**
+  * @brief  Starts the capture at the next frame.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @retval None
+  */
+void DCMI_CaptureStart(DCMI_CaptureTypeDef* Capture)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  Capture->Running = 1;
+  Capture->FrameCount = 0;
+  Capture->Line = 0;
+
+  DCMI_ClearITPendingBit(DCMI_IT_FRAME | DCMI_IT_OVF | DCMI_IT_ERR | DCMI_IT_VSYNC | DCMI_IT_LINE);
+  DCMI_ITConfig(DCMI_IT_OVF | DCMI_IT_ERR | DCMI_IT_VSYNC, ENABLE);
+  if (Capture->Init.LineCallback != 0)
+  {
+    DCMI_ITConfig(DCMI_IT_LINE, ENABLE);
+  }
+
+  DCMI_CaptureResync(Capture);
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Stops the capture.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @note   The frame in progress is lost. The frames given to the application
+  *         stay with it until DCMI_CaptureRelease().
+  * @retval None
+  */
+void DCMI_CaptureStop(DCMI_CaptureTypeDef* Capture)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  Capture->Running = 0;
+  DCMI_ITConfig(DCMI_IT_OVF | DCMI_IT_ERR | DCMI_IT_VSYNC | DCMI_IT_LINE, DISABLE);
+  DCMI_CaptureResync(Capture);
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Gives a frame buffer back to the pool.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @param  Frame: a frame buffer given to FrameCallback.
+  * @note   This function may be called from FrameCallback.
+  * @retval None
+  */
+void DCMI_CaptureRelease(DCMI_CaptureTypeDef* Capture, DCMI_CaptureFrameTypeDef* Frame)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  Frame->Status = DCMI_CAPTURE_FRAME_FREE;
+  Frame->Next = 0;
+  if (Capture->FreeTail != 0)
+  {
+    Capture->FreeTail->Next = Frame;
+  }
+  else
+  {
+    Capture->FreeHead = Frame;
+  }
+  Capture->FreeTail = Frame;
+
+  if (Capture->Running != 0)
+  {
+    if (Capture->Stalled != 0)
+    {
+      DCMI_CaptureResync(Capture);
+    }
+    else
+    {
+      DCMI_CaptureFill(Capture);
+    }
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Returns the size of the segments given to SegmentCallback.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @retval Bytes per segment, a multiple of 16: segment n of a frame starts at
+  *         byte n times this size of its pData.
+  */
+uint32_t DCMI_CaptureGetSegmentSize(DCMI_CaptureTypeDef* Capture)
+{
+  return (Capture->SegmentWords * 4);
+}
+
+/**
+  * @brief  Handles the DCMI interrupt: line count, overrun and synchronization
+  *         errors.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @retval None
+  */
+void DCMI_CaptureIRQHandler(DCMI_CaptureTypeDef* Capture)
+{
+  if (DCMI_GetITStatus(DCMI_IT_LINE) != RESET)
+  {
+    DCMI_ClearITPendingBit(DCMI_IT_LINE);
+    Capture->Line++;
+    if (Capture->Init.LineCallback != 0)
+    {
+      Capture->Init.LineCallback(Capture, Capture->Line);
+    }
+  }
+
+  if (DCMI_GetITStatus(DCMI_IT_VSYNC) != RESET)
+  {
+    DCMI_ClearITPendingBit(DCMI_IT_VSYNC);
+    Capture->Line = 0;
+  }
+
+  if ((DCMI_GetITStatus(DCMI_IT_OVF) != RESET) || (DCMI_GetITStatus(DCMI_IT_ERR) != RESET))
+  {
+    DCMI_ClearITPendingBit(DCMI_IT_OVF | DCMI_IT_ERR);
+    Capture->Dropped++;
+    DCMI_CaptureResync(Capture);
+  }
+}
+
+/**
+  * @brief  Queues free frame buffers on the DMA, up to DCMI_CAPTURE_DEPTH.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @retval None
+  */
+static void DCMI_CaptureFill(DCMI_CaptureTypeDef* Capture)
+{
+  DCMI_CaptureFrameTypeDef* frame = 0;
+  uint32_t segment = 0;
+
+  while ((Capture->Queued < DCMI_CAPTURE_DEPTH) && (Capture->FreeHead != 0))
+  {
+    frame = Capture->FreeHead;
+    Capture->FreeHead = frame->Next;
+    if (Capture->FreeHead == 0)
+    {
+      Capture->FreeTail = 0;
+    }
+
+    frame->Status = DCMI_CAPTURE_FRAME_QUEUED;
+    frame->Next = 0;
+    if (Capture->QueuedTail != 0)
+    {
+      Capture->QueuedTail->Next = frame;
+    }
+    else
+    {
+      Capture->QueuedHead = frame;
+    }
+    Capture->QueuedTail = frame;
+    Capture->Queued++;
+
+    for (segment = 0; segment < Capture->Segments; segment++)
+    {
+      DMA_MgrSubmit(Capture->Stream, &frame->Xfer[segment]);
+    }
+  }
+}
+
+/**
+  * @brief  Stops the capture and the DMA, gives the queued frame buffers back
+  *         to the pool, and restarts the capture at the next frame if the
+  *         pipeline is running and a frame buffer is free.
+  * @note   This function is called with the interrupts disabled or from the
+  *         interrupt handlers of the pipeline.
+  * @param  Capture: pointer to the DCMI_CaptureTypeDef structure of the pipeline.
+  * @retval None
+  */
+static void DCMI_CaptureResync(DCMI_CaptureTypeDef* Capture)
+{
+  DCMI_CaptureFrameTypeDef* frame = 0;
+
+  /* Disabling the DCMI stops the capture at once, not at the end of the frame */
+  DCMI_CaptureCmd(DISABLE);
+  DCMI_Cmd(DISABLE);
+  DMA_MgrAbort(Capture->Stream);
+
+  /* The queued frame buffers go first, in order */
+  if (Capture->QueuedHead != 0)
+  {
+    for (frame = Capture->QueuedHead; frame != 0; frame = frame->Next)
+    {
+      frame->Status = DCMI_CAPTURE_FRAME_FREE;
+    }
+    Capture->QueuedTail->Next = Capture->FreeHead;
+    if (Capture->FreeHead == 0)
+    {
+      Capture->FreeTail = Capture->QueuedTail;
+    }
+    Capture->FreeHead = Capture->QueuedHead;
+    Capture->QueuedHead = 0;
+    Capture->QueuedTail = 0;
+    Capture->Queued = 0;
+  }
+  Capture->Line = 0;
+  Capture->Stalled = 0;
+
+  if (Capture->Running == 0)
+  {
+    return;
+  }
+
+  DCMI_CaptureFill(Capture);
+  if (Capture->Queued == 0)
+  {
+    Capture->Stalled = 1;
+    Capture->Stalls++;
+    return;
+  }
+
+  /* The capture starts at the next frame start */
+  DCMI_ClearITPendingBit(DCMI_IT_FRAME | DCMI_IT_OVF | DCMI_IT_ERR | DCMI_IT_VSYNC | DCMI_IT_LINE);
+  DCMI_Cmd(ENABLE);
+  DCMI_CaptureCmd(ENABLE);
+}
+
+/**
+  * @brief  Ends a segment: gives it to SegmentCallback and, at the last
+  *         segment of a frame, queues the next free frame buffer and gives the
+  *         frame to FrameCallback.
+  * @param  Xfer: the DMA transfer of the segment.
+  * @retval None
+  */
+static void DCMI_CaptureSegmentDone(DMA_MgrXferTypeDef* Xfer)
+{
+  DCMI_CaptureFrameTypeDef* frame = (DCMI_CaptureFrameTypeDef*)Xfer->Context;
+  DCMI_CaptureTypeDef* capture = frame->Capture;
+
+  if (Xfer->Status == DMA_MGR_XFER_ERROR)
+  {
+    capture->Dropped++;
+    DCMI_CaptureResync(capture);
+    return;
+  }
+  if (Xfer->Status != DMA_MGR_XFER_DONE)
+  {
+    return;
+  }
+  if (capture->Init.SegmentCallback != 0)
+  {
+    capture->Init.SegmentCallback(capture, frame, (uint32_t)(Xfer - frame->Xfer));
+  }
+  if (Xfer != &frame->Xfer[capture->Segments - 1])
+  {
+    return;
+  }
+
+  capture->QueuedHead = frame->Next;
+  if (capture->QueuedHead == 0)
+  {
+    capture->QueuedTail = 0;
+  }
+  capture->Queued--;
+
+  frame->Next = 0;
+  frame->Number = capture->FrameCount++;
+  frame->Status = DCMI_CAPTURE_FRAME_READY;
+
+  /* The next frame buffer must be on the DMA before the next frame starts */
+  DCMI_CaptureFill(capture);
+  if (capture->Queued == 0)
+  {
+    DCMI_CaptureResync(capture);
+  }
+
+  capture->Init.FrameCallback(capture, frame);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,793 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_dma_mgr.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a descriptor based transfer manager on top of the
+  *          DMA driver:
+  *           - Allocation of the streams from a table of the peripheral requests
+  *           - Queues of transfer descriptors per stream
+  *           - Chaining of the transfers on Transfer Complete, with the double
+  *             buffer mode in streaming mode
+  *           - Completion callbacks
+  *          It uses the stm32f4xx_dma.c/.h drivers to access the DMA streams.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the DMA1 and DMA2 controller clocks using
+  *             RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA1 | RCC_AHB1Periph_DMA2, ENABLE);
+  *             function.
+  *
+  *          2. Call DMA_MgrInit() once, with the request table of the application
+  *             or with 0 to use the default table of the SPI, USART, ADC, SDIO,
+  *             DAC, I2C, timer update and capture/compare, DCMI, CRYP, HASH and I2S
+  *             extension requests.
+  *
+  *          3. Get a stream for a peripheral request using DMA_MgrAlloc(). The
+  *             DMA_InitTypeDef structure gives the peripheral address, the direction,
+  *             the data sizes, the mode, the priority and the FIFO configuration; the
+  *             channel and the memory address are set by the manager.
+  *              - DMA_Mode_Normal: the transfers are run one at a time, each with
+  *                its own Count. The next one is started by the Transfer Complete
+  *                interrupt.
+  *              - DMA_Mode_Circular: streaming mode. The stream runs in double buffer
+  *                mode and the next transfer is written in the memory target which
+  *                is not in use, so that the stream goes on without stopping. All
+  *                the transfers have DMA_BufferSize data items.
+  *
+  *          4. Set the priority of the stream interrupt using NVIC_SetPriority() and
+  *             call DMA_MgrIRQHandler() from its interrupt handler, for example:
+  *               void DMA2_Stream0_IRQHandler(void)
+  *               {
+  *                 DMA_MgrIRQHandler(DMA2_Stream0);
+  *               }
+  *
+  *          5. Queue the transfers using DMA_MgrSubmit(). The descriptors belong to
+  *             the manager until their callback is called or their Status is no
+  *             longer DMA_MGR_XFER_QUEUED or DMA_MGR_XFER_ACTIVE.
+  *
+  *          6. Activate the Stream Request using PPP_DMACmd() function of the
+  *             peripheral driver (ie. SPI_DMACmd for SPI peripheral).
+  *
+  *          7. Stop a stream using DMA_MgrAbort(), and give it back using
+  *             DMA_MgrFree().
+  *
+  * @note   In streaming mode the transfers must be queued ahead: when the
+  *         transfer in progress completes and no other transfer is queued, the
+  *         stream has already restarted on the last memory target. The manager
+  *         then stops the stream and restarts it on the next queued transfer.
+  *
+  * @note   The Callback is called from the interrupt handler of the stream, or
+  *         from DMA_MgrAbort() and DMA_MgrFree() for the aborted transfers. It may
+  *         queue a new transfer on the stream.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_dma.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup DMA
+  * @brief DMA driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  DMA_MgrXferTypeDef* Active;      /* Transfer of the current memory target */
+  DMA_MgrXferTypeDef* Pending;     /* Transfer of the other memory target (streaming mode) */
+  DMA_MgrXferTypeDef* Head;        /* First queued transfer */
+  DMA_MgrXferTypeDef* Tail;        /* Last queued transfer */
+  uint16_t BufferSize;             /* Size of the transfers (streaming mode) */
+  uint8_t Allocated;               /* The stream is in use */
+  uint8_t Streaming;               /* The stream runs in double buffer mode */
+}DMA_MgrStreamTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define DMA_MGR_STREAMS         ((uint32_t)16)
+#define DMA_MGR_NO_STREAM       ((uint32_t)0xFFFFFFFF)
+
+#define DMA_MGR_DEFAULT_REQUESTS (sizeof(DMA_MgrDefaultRequests) / sizeof(DMA_MgrDefaultRequests[0]))
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Streams, in the order of the manager contexts */
+static DMA_Stream_TypeDef* const DMA_MgrStreamTable[DMA_MGR_STREAMS] =
+{
+  DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3,
+  DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7,
+  DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3,
+  DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7
+};
+
+/* Interrupt of each stream */
+static const IRQn_Type DMA_MgrIRQnTable[DMA_MGR_STREAMS] =
+{
+  DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn,
+  DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn,
+  DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn,
+  DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn
+};
+
+/* Flags of the stream number x, the same for DMA1 and DMA2 */
+static const uint32_t DMA_MgrTCIF[8] =
+{
+  DMA_IT_TCIF0, DMA_IT_TCIF1, DMA_IT_TCIF2, DMA_IT_TCIF3,
+  DMA_IT_TCIF4, DMA_IT_TCIF5, DMA_IT_TCIF6, DMA_IT_TCIF7
+};
+
+static const uint32_t DMA_MgrTEIF[8] =
+{
+  DMA_IT_TEIF0, DMA_IT_TEIF1, DMA_IT_TEIF2, DMA_IT_TEIF3,
+  DMA_IT_TEIF4, DMA_IT_TEIF5, DMA_IT_TEIF6, DMA_IT_TEIF7
+};
+
+static const uint32_t DMA_MgrDMEIF[8] =
+{
+  DMA_IT_DMEIF0, DMA_IT_DMEIF1, DMA_IT_DMEIF2, DMA_IT_DMEIF3,
+  DMA_IT_DMEIF4, DMA_IT_DMEIF5, DMA_IT_DMEIF6, DMA_IT_DMEIF7
+};
+
+static const uint32_t DMA_MgrAllIF[8] =
+{
+  DMA_IT_TCIF0 | DMA_IT_HTIF0 | DMA_IT_TEIF0 | DMA_IT_DMEIF0 | DMA_IT_FEIF0,
+  DMA_IT_TCIF1 | DMA_IT_HTIF1 | DMA_IT_TEIF1 | DMA_IT_DMEIF1 | DMA_IT_FEIF1,
+  DMA_IT_TCIF2 | DMA_IT_HTIF2 | DMA_IT_TEIF2 | DMA_IT_DMEIF2 | DMA_IT_FEIF2,
+  DMA_IT_TCIF3 | DMA_IT_HTIF3 | DMA_IT_TEIF3 | DMA_IT_DMEIF3 | DMA_IT_FEIF3,
+  DMA_IT_TCIF4 | DMA_IT_HTIF4 | DMA_IT_TEIF4 | DMA_IT_DMEIF4 | DMA_IT_FEIF4,
+  DMA_IT_TCIF5 | DMA_IT_HTIF5 | DMA_IT_TEIF5 | DMA_IT_DMEIF5 | DMA_IT_FEIF5,
+  DMA_IT_TCIF6 | DMA_IT_HTIF6 | DMA_IT_TEIF6 | DMA_IT_DMEIF6 | DMA_IT_FEIF6,
+  DMA_IT_TCIF7 | DMA_IT_HTIF7 | DMA_IT_TEIF7 | DMA_IT_DMEIF7 | DMA_IT_FEIF7
+};
+
+/* Stream and channel of the requests (RM0090, DMA1 and DMA2 request mapping).
+   The streams of a request are tried in the order of the table. */
+static const DMA_MgrRequestTypeDef DMA_MgrDefaultRequests[] =
+{
+  {DMA_MGR_REQ_SPI1_RX,   DMA2_Stream0, DMA_Channel_3},
+  {DMA_MGR_REQ_SPI1_RX,   DMA2_Stream2, DMA_Channel_3},
+  {DMA_MGR_REQ_SPI1_TX,   DMA2_Stream3, DMA_Channel_3},
+  {DMA_MGR_REQ_SPI1_TX,   DMA2_Stream5, DMA_Channel_3},
+  {DMA_MGR_REQ_SPI2_RX,   DMA1_Stream3, DMA_Channel_0},
+  {DMA_MGR_REQ_SPI2_TX,   DMA1_Stream4, DMA_Channel_0},
+  {DMA_MGR_REQ_SPI3_RX,   DMA1_Stream0, DMA_Channel_0},
+  {DMA_MGR_REQ_SPI3_RX,   DMA1_Stream2, DMA_Channel_0},
+  {DMA_MGR_REQ_SPI3_TX,   DMA1_Stream5, DMA_Channel_0},
+  {DMA_MGR_REQ_SPI3_TX,   DMA1_Stream7, DMA_Channel_0},
+  {DMA_MGR_REQ_USART1_RX, DMA2_Stream2, DMA_Channel_4},
+  {DMA_MGR_REQ_USART1_RX, DMA2_Stream5, DMA_Channel_4},
+  {DMA_MGR_REQ_USART1_TX, DMA2_Stream7, DMA_Channel_4},
+  {DMA_MGR_REQ_USART2_RX, DMA1_Stream5, DMA_Channel_4},
+  {DMA_MGR_REQ_USART2_TX, DMA1_Stream6, DMA_Channel_4},
+  {DMA_MGR_REQ_USART3_RX, DMA1_Stream1, DMA_Channel_4},
+  {DMA_MGR_REQ_USART3_TX, DMA1_Stream3, DMA_Channel_4},
+  {DMA_MGR_REQ_USART3_TX, DMA1_Stream4, DMA_Channel_7},
+  {DMA_MGR_REQ_UART4_RX,  DMA1_Stream2, DMA_Channel_4},
+  {DMA_MGR_REQ_UART4_TX,  DMA1_Stream4, DMA_Channel_4},
+  {DMA_MGR_REQ_UART5_RX,  DMA1_Stream0, DMA_Channel_4},
+  {DMA_MGR_REQ_UART5_TX,  DMA1_Stream7, DMA_Channel_4},
+  {DMA_MGR_REQ_USART6_RX, DMA2_Stream1, DMA_Channel_5},
+  {DMA_MGR_REQ_USART6_RX, DMA2_Stream2, DMA_Channel_5},
+  {DMA_MGR_REQ_USART6_TX, DMA2_Stream6, DMA_Channel_5},
+  {DMA_MGR_REQ_USART6_TX, DMA2_Stream7, DMA_Channel_5},
+  {DMA_MGR_REQ_ADC1,      DMA2_Stream0, DMA_Channel_0},
+  {DMA_MGR_REQ_ADC1,      DMA2_Stream4, DMA_Channel_0},
+  {DMA_MGR_REQ_ADC2,      DMA2_Stream2, DMA_Channel_1},
+  {DMA_MGR_REQ_ADC2,      DMA2_Stream3, DMA_Channel_1},
+  {DMA_MGR_REQ_ADC3,      DMA2_Stream0, DMA_Channel_2},
+  {DMA_MGR_REQ_ADC3,      DMA2_Stream1, DMA_Channel_2},
+  {DMA_MGR_REQ_SDIO,      DMA2_Stream3, DMA_Channel_4},
+  {DMA_MGR_REQ_SDIO,      DMA2_Stream6, DMA_Channel_4},
+  {DMA_MGR_REQ_DAC1,      DMA1_Stream5, DMA_Channel_7},
+  {DMA_MGR_REQ_DAC2,      DMA1_Stream6, DMA_Channel_7},
+  {DMA_MGR_REQ_I2C1_RX,   DMA1_Stream0, DMA_Channel_1},
+  {DMA_MGR_REQ_I2C1_RX,   DMA1_Stream5, DMA_Channel_1},
+  {DMA_MGR_REQ_I2C1_TX,   DMA1_Stream6, DMA_Channel_1},
+  {DMA_MGR_REQ_I2C1_TX,   DMA1_Stream7, DMA_Channel_1},
+  {DMA_MGR_REQ_I2C2_RX,   DMA1_Stream2, DMA_Channel_7},
+  {DMA_MGR_REQ_I2C2_RX,   DMA1_Stream3, DMA_Channel_7},
+  {DMA_MGR_REQ_I2C2_TX,   DMA1_Stream7, DMA_Channel_7},
+  {DMA_MGR_REQ_I2C3_RX,   DMA1_Stream2, DMA_Channel_3},
+  {DMA_MGR_REQ_I2C3_TX,   DMA1_Stream4, DMA_Channel_3},
+  {DMA_MGR_REQ_TIM1_UP,   DMA2_Stream5, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM2_UP,   DMA1_Stream1, DMA_Channel_3},
+  {DMA_MGR_REQ_TIM2_UP,   DMA1_Stream7, DMA_Channel_3},
+  {DMA_MGR_REQ_TIM3_UP,   DMA1_Stream2, DMA_Channel_5},
+  {DMA_MGR_REQ_TIM4_UP,   DMA1_Stream6, DMA_Channel_2},
+  {DMA_MGR_REQ_TIM5_UP,   DMA1_Stream0, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM5_UP,   DMA1_Stream6, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM8_UP,   DMA2_Stream1, DMA_Channel_7},
+  {DMA_MGR_REQ_DCMI,      DMA2_Stream1, DMA_Channel_1},
+  {DMA_MGR_REQ_DCMI,      DMA2_Stream7, DMA_Channel_1},
+  {DMA_MGR_REQ_CRYP_IN,   DMA2_Stream6, DMA_Channel_2},
+  {DMA_MGR_REQ_CRYP_OUT,  DMA2_Stream5, DMA_Channel_2},
+  {DMA_MGR_REQ_HASH_IN,   DMA2_Stream7, DMA_Channel_2},
+  {DMA_MGR_REQ_I2S2EXT_RX, DMA1_Stream3, DMA_Channel_3},
+  {DMA_MGR_REQ_I2S2EXT_TX, DMA1_Stream4, DMA_Channel_2},
+  {DMA_MGR_REQ_I2S3EXT_RX, DMA1_Stream0, DMA_Channel_3},
+  {DMA_MGR_REQ_I2S3EXT_RX, DMA1_Stream2, DMA_Channel_2},
+  {DMA_MGR_REQ_I2S3EXT_TX, DMA1_Stream5, DMA_Channel_2},
+  {DMA_MGR_REQ_TIM1_CC1,  DMA2_Stream1, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM1_CC1,  DMA2_Stream3, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM1_CC2,  DMA2_Stream2, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM2_CC1,  DMA1_Stream5, DMA_Channel_3},
+  {DMA_MGR_REQ_TIM2_CC2,  DMA1_Stream6, DMA_Channel_3},
+  {DMA_MGR_REQ_TIM3_CC1,  DMA1_Stream4, DMA_Channel_5},
+  {DMA_MGR_REQ_TIM3_CC2,  DMA1_Stream5, DMA_Channel_5},
+  {DMA_MGR_REQ_TIM4_CC1,  DMA1_Stream0, DMA_Channel_2},
+  {DMA_MGR_REQ_TIM4_CC2,  DMA1_Stream3, DMA_Channel_2},
+  {DMA_MGR_REQ_TIM5_CC1,  DMA1_Stream2, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM5_CC2,  DMA1_Stream4, DMA_Channel_6},
+  {DMA_MGR_REQ_TIM8_CC1,  DMA2_Stream2, DMA_Channel_7},
+  {DMA_MGR_REQ_TIM8_CC2,  DMA2_Stream3, DMA_Channel_7},
+  /* Memory to memory transfers are possible on DMA2 only */
+  {DMA_MGR_REQ_MEM2MEM,   DMA2_Stream7, DMA_Channel_0},
+  {DMA_MGR_REQ_MEM2MEM,   DMA2_Stream6, DMA_Channel_0},
+  {DMA_MGR_REQ_MEM2MEM,   DMA2_Stream4, DMA_Channel_0},
+  {DMA_MGR_REQ_MEM2MEM,   DMA2_Stream1, DMA_Channel_0}
+};
+
+static const DMA_MgrRequestTypeDef* DMA_MgrRequests = DMA_MgrDefaultRequests;
+static uint32_t DMA_MgrNumRequests = DMA_MGR_DEFAULT_REQUESTS;
+static DMA_MgrStreamTypeDef DMA_MgrContext[DMA_MGR_STREAMS];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t DMA_MgrGetIndex(DMA_Stream_TypeDef* DMAy_Streamx);
+static void DMA_MgrStop(DMA_Stream_TypeDef* DMAy_Streamx);
+static void DMA_MgrStart(uint32_t Index);
+static void DMA_MgrFlush(uint32_t Index);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup DMA_Private_Functions
+  * @{
+  */
+
+/** @defgroup DMA_Group5 DMA Manager functions
+ *  @brief   DMA Manager functions
+ *
+@verbatim
+ ===============================================================================
+                            DMA Manager functions
+ ===============================================================================
+
+  This subsection provides functions allowing to share the DMA streams between
+  the peripheral drivers and to chain their transfers without reprogramming the
+  stream from the application.
+
+  A stream is allocated for a peripheral request by DMA_MgrAlloc(), which selects
+  the first free stream of the request in the request table and configures its
+  channel. DMA_MgrSubmit() then queues transfer descriptors on the stream.
+
+  DMA_MgrIRQHandler() clears the flags of the stream, ends the transfer in progress
+  and calls its Callback. In normal mode it starts the next queued transfer. In
+  streaming mode (circular mode) the stream has already switched to the other
+  memory target, which holds the next transfer, and the manager writes the
+  transfer after it in the memory target just released: the stream never stops
+  while transfers are queued ahead.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the DMA manager.
+  * @param  RequestTable: the table of the requests, or 0 to use the default table
+  *         of the SPI1 to SPI3, USART1 to USART6, ADC1 to ADC3, SDIO, DAC,
+  *         I2C1 to I2C3, TIM1 to TIM5 and TIM8 update, DCMI, CRYP, HASH and
+  *         memory to memory requests.
+  * @param  RequestTableSize: the number of entries of RequestTable.
+  * @note   All the streams are released: this function must be called before
+  *         any other DMA manager function, while no stream is running.
+  * @retval None
+  */
+void DMA_MgrInit(const DMA_MgrRequestTypeDef* RequestTable, uint32_t RequestTableSize)
+{
+  uint32_t index = 0;
+
+  if (RequestTable != 0)
+  {
+    DMA_MgrRequests = RequestTable;
+    DMA_MgrNumRequests = RequestTableSize;
+  }
+  else
+  {
+    DMA_MgrRequests = DMA_MgrDefaultRequests;
+    DMA_MgrNumRequests = DMA_MGR_DEFAULT_REQUESTS;
+  }
+
+  for (index = 0; index < DMA_MGR_STREAMS; index++)
+  {
+    DMA_MgrContext[index].Active = 0;
+    DMA_MgrContext[index].Pending = 0;
+    DMA_MgrContext[index].Head = 0;
+    DMA_MgrContext[index].Tail = 0;
+    DMA_MgrContext[index].BufferSize = 0;
+    DMA_MgrContext[index].Allocated = 0;
+    DMA_MgrContext[index].Streaming = 0;
+  }
+}
+
+/**
+  * @brief  Allocates and configures a stream for a peripheral request.
+  * @param  Request: the peripheral request.
+  *          This parameter can be a value of @ref DMA_Manager_requests, or of the
+  *          request table given to DMA_MgrInit().
+  * @param  DMA_InitStruct: pointer to a DMA_InitTypeDef structure that contains
+  *         the configuration of the stream. The DMA_Channel and DMA_Memory0BaseAddr
+  *         members are not used. With DMA_Mode_Circular the stream runs in streaming
+  *         mode and DMA_BufferSize is the size of all the transfers.
+  * @note   The Transfer Complete, Transfer Error and Direct Mode Error interrupts of
+  *         the stream are enabled, in the stream and in the NVIC.
+  * @retval The allocated stream, or 0 if all the streams of the request are in use.
+  */
+DMA_Stream_TypeDef* DMA_MgrAlloc(uint32_t Request, DMA_InitTypeDef* DMA_InitStruct)
+{
+  DMA_Stream_TypeDef* stream = 0;
+  uint32_t entry = 0, index = DMA_MGR_NO_STREAM;
+
+  /* Check the parameters */
+  assert_param(IS_DMA_MODE(DMA_InitStruct->DMA_Mode));
+
+  /* Select the first free stream of the request */
+  for (entry = 0; entry < DMA_MgrNumRequests; entry++)
+  {
+    if (DMA_MgrRequests[entry].Request == Request)
+    {
+      index = DMA_MgrGetIndex(DMA_MgrRequests[entry].Stream);
+
+      if ((index != DMA_MGR_NO_STREAM) && (DMA_MgrContext[index].Allocated == 0))
+      {
+        break;
+      }
+      index = DMA_MGR_NO_STREAM;
+    }
+  }
+
+  if (index != DMA_MGR_NO_STREAM)
+  {
+    stream = DMA_MgrStreamTable[index];
+
+    DMA_MgrContext[index].Active = 0;
+    DMA_MgrContext[index].Pending = 0;
+    DMA_MgrContext[index].Head = 0;
+    DMA_MgrContext[index].Tail = 0;
+    DMA_MgrContext[index].BufferSize = (uint16_t)DMA_InitStruct->DMA_BufferSize;
+    DMA_MgrContext[index].Allocated = 1;
+    DMA_MgrContext[index].Streaming = (DMA_InitStruct->DMA_Mode == DMA_Mode_Circular) &&
+                                      (DMA_InitStruct->DMA_DIR != DMA_DIR_MemoryToMemory);
+
+    /* Configure the stream, disabled, on the channel of the request */
+    DMA_MgrStop(stream);
+    DMA_DeInit(stream);
+    DMA_InitStruct->DMA_Channel = DMA_MgrRequests[entry].Channel;
+    DMA_Init(stream, DMA_InitStruct);
+
+    if (DMA_MgrContext[index].Streaming != 0)
+    {
+      DMA_DoubleBufferModeCmd(stream, ENABLE);
+    }
+
+    DMA_ClearITPendingBit(stream, DMA_MgrAllIF[index & 0x7]);
+    DMA_ITConfig(stream, DMA_IT_TC | DMA_IT_TE | DMA_IT_DME, ENABLE);
+    NVIC_EnableIRQ(DMA_MgrIRQnTable[index]);
+  }
+
+  return stream;
+}
+
+/**
+  * @brief  Aborts the transfers of a stream and releases it.
+  * @param  DMAy_Streamx: a stream returned by DMA_MgrAlloc().
+  * @retval None
+  */
+void DMA_MgrFree(DMA_Stream_TypeDef* DMAy_Streamx)
+{
+  uint32_t index = DMA_MgrGetIndex(DMAy_Streamx);
+
+  /* Check the parameters */
+  assert_param(IS_DMA_ALL_PERIPH(DMAy_Streamx));
+
+  if ((index != DMA_MGR_NO_STREAM) && (DMA_MgrContext[index].Allocated != 0))
+  {
+    NVIC_DisableIRQ(DMA_MgrIRQnTable[index]);
+
+    DMA_MgrStop(DMAy_Streamx);
+    DMA_DeInit(DMAy_Streamx);
+    DMA_MgrContext[index].Allocated = 0;
+
+    /* Call the callbacks last: they may allocate the stream again */
+    DMA_MgrFlush(index);
+  }
+}
+
+/**
+  * @brief  Queues a transfer on a stream, and starts the stream if it is idle.
+  * @param  DMAy_Streamx: a stream returned by DMA_MgrAlloc().
+  * @param  Xfer: pointer to the transfer descriptor. Its MemoryBaseAddr, Count,
+  *         Callback and Context members must be set.
+  * @note   This function may be called from the Callback of a transfer.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the transfer is queued
+  *          - ERROR: the stream is not allocated
+  */
+ErrorStatus DMA_MgrSubmit(DMA_Stream_TypeDef* DMAy_Streamx, DMA_MgrXferTypeDef* Xfer)
+{
+  DMA_MgrStreamTypeDef* context;
+  uint32_t index = DMA_MgrGetIndex(DMAy_Streamx);
+  uint32_t target = DMA_Memory_0;
+
+  /* Check the parameters */
+  assert_param(IS_DMA_ALL_PERIPH(DMAy_Streamx));
+
+  if ((index == DMA_MGR_NO_STREAM) || (DMA_MgrContext[index].Allocated == 0))
+  {
+    return ERROR;
+  }
+  context = &DMA_MgrContext[index];
+
+  Xfer->Status = DMA_MGR_XFER_QUEUED;
+  Xfer->Next = 0;
+
+  /* The interrupt handler of the stream updates the queue too */
+  NVIC_DisableIRQ(DMA_MgrIRQnTable[index]);
+
+  if ((context->Streaming != 0) && (context->Active != 0) && (context->Pending == 0) &&
+      (DMA_GetITStatus(DMAy_Streamx, DMA_MgrTCIF[index & 0x7]) == RESET))
+  {
+    /* Write the transfer in the memory target which is not in use: the stream
+       switches to it at the end of the transfer in progress */
+    if (DMA_GetCurrentMemoryTarget(DMAy_Streamx) == 0)
+    {
+      target = DMA_Memory_1;
+    }
+    DMA_MemoryTargetConfig(DMAy_Streamx, Xfer->MemoryBaseAddr, target);
+
+    Xfer->Status = DMA_MGR_XFER_ACTIVE;
+    context->Pending = Xfer;
+  }
+  else
+  {
+    if (context->Tail != 0)
+    {
+      context->Tail->Next = Xfer;
+    }
+    else
+    {
+      context->Head = Xfer;
+    }
+    context->Tail = Xfer;
+
+    if (context->Active == 0)
+    {
+      DMA_MgrStart(index);
+    }
+  }
+
+  NVIC_EnableIRQ(DMA_MgrIRQnTable[index]);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a stream and aborts all its transfers.
+  * @param  DMAy_Streamx: a stream returned by DMA_MgrAlloc().
+  * @note   The Callback of the aborted transfers is called with their Status set
+  *         to DMA_MGR_XFER_ABORTED. The stream stays allocated.
+  * @retval None
+  */
+void DMA_MgrAbort(DMA_Stream_TypeDef* DMAy_Streamx)
+{
+  uint32_t index = DMA_MgrGetIndex(DMAy_Streamx);
+
+  /* Check the parameters */
+  assert_param(IS_DMA_ALL_PERIPH(DMAy_Streamx));
+
+  if ((index != DMA_MGR_NO_STREAM) && (DMA_MgrContext[index].Allocated != 0))
+  {
+    NVIC_DisableIRQ(DMA_MgrIRQnTable[index]);
+
+    DMA_MgrStop(DMAy_Streamx);
+    DMA_ClearITPendingBit(DMAy_Streamx, DMA_MgrAllIF[index & 0x7]);
+    NVIC_ClearPendingIRQ(DMA_MgrIRQnTable[index]);
+
+    NVIC_EnableIRQ(DMA_MgrIRQnTable[index]);
+
+    DMA_MgrFlush(index);
+  }
+}
+
+/**
+  * @brief  Handles the interrupts of a stream allocated by the DMA manager.
+  * @param  DMAy_Streamx: a stream returned by DMA_MgrAlloc().
+  * @note   This function must be called from the interrupt handler of the stream.
+  * @retval None
+  */
+void DMA_MgrIRQHandler(DMA_Stream_TypeDef* DMAy_Streamx)
+{
+  DMA_MgrStreamTypeDef* context;
+  DMA_MgrXferTypeDef* xfer;
+  uint32_t index = DMA_MgrGetIndex(DMAy_Streamx);
+  uint32_t stream = index & 0x7;
+  uint32_t target = DMA_Memory_0;
+
+  /* Check the parameters */
+  assert_param(IS_DMA_ALL_PERIPH(DMAy_Streamx));
+
+  if (index == DMA_MGR_NO_STREAM)
+  {
+    return;
+  }
+  context = &DMA_MgrContext[index];
+
+  if ((DMA_GetITStatus(DMAy_Streamx, DMA_MgrTEIF[stream]) != RESET) ||
+      (DMA_GetITStatus(DMAy_Streamx, DMA_MgrDMEIF[stream]) != RESET))
+  {
+    /* The transfer in progress failed: stop the stream and go on with the
+       following transfers */
+    DMA_MgrStop(DMAy_Streamx);
+    DMA_ClearITPendingBit(DMAy_Streamx, DMA_MgrAllIF[stream]);
+
+    xfer = context->Active;
+    context->Active = 0;
+
+    /* The transfer of the other memory target has not started yet */
+    if (context->Pending != 0)
+    {
+      context->Pending->Status = DMA_MGR_XFER_QUEUED;
+      context->Pending->Next = context->Head;
+      if (context->Head == 0)
+      {
+        context->Tail = context->Pending;
+      }
+      context->Head = context->Pending;
+      context->Pending = 0;
+    }
+
+    DMA_MgrStart(index);
+
+    if (xfer != 0)
+    {
+      xfer->Status = DMA_MGR_XFER_ERROR;
+      if (xfer->Callback != 0)
+      {
+        xfer->Callback(xfer);
+      }
+    }
+  }
+  else if (DMA_GetITStatus(DMAy_Streamx, DMA_MgrTCIF[stream]) != RESET)
+  {
+    DMA_ClearITPendingBit(DMAy_Streamx, DMA_MgrTCIF[stream]);
+
+    xfer = context->Active;
+
+    if (context->Streaming != 0)
+    {
+      /* The stream runs on the other memory target */
+      context->Active = context->Pending;
+      context->Pending = 0;
+
+      if (context->Active == 0)
+      {
+        /* No transfer was queued in time: the stream restarted on the memory
+           target of the completed transfer */
+        DMA_MgrStop(DMAy_Streamx);
+        DMA_ClearITPendingBit(DMAy_Streamx, DMA_MgrAllIF[stream]);
+        DMA_MgrStart(index);
+      }
+      else if (context->Head != 0)
+      {
+        /* Write the next transfer in the memory target just released */
+        context->Pending = context->Head;
+        context->Head = context->Head->Next;
+        if (context->Head == 0)
+        {
+          context->Tail = 0;
+        }
+
+        if (DMA_GetCurrentMemoryTarget(DMAy_Streamx) == 0)
+        {
+          target = DMA_Memory_1;
+        }
+        DMA_MemoryTargetConfig(DMAy_Streamx, context->Pending->MemoryBaseAddr, target);
+        context->Pending->Status = DMA_MGR_XFER_ACTIVE;
+      }
+    }
+    else
+    {
+      /* The stream is disabled at the end of a transfer in normal mode */
+      context->Active = 0;
+      DMA_MgrStart(index);
+    }
+
+    if (xfer != 0)
+    {
+      xfer->Status = DMA_MGR_XFER_DONE;
+      if (xfer->Callback != 0)
+      {
+        xfer->Callback(xfer);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Returns the index of the manager context of a stream.
+  * @param  DMAy_Streamx: where y can be 1 or 2 to select the DMA and x can be 0
+  *         to 7 to select the DMA Stream.
+  * @retval The index, or DMA_MGR_NO_STREAM.
+  */
+static uint32_t DMA_MgrGetIndex(DMA_Stream_TypeDef* DMAy_Streamx)
+{
+  uint32_t index = 0;
+
+  for (index = 0; index < DMA_MGR_STREAMS; index++)
+  {
+    if (DMA_MgrStreamTable[index] == DMAy_Streamx)
+    {
+      return index;
+    }
+  }
+
+  return DMA_MGR_NO_STREAM;
+}
+
+/**
+  * @brief  Disables a stream and waits for the end of its current data transfer.
+  * @param  DMAy_Streamx: where y can be 1 or 2 to select the DMA and x can be 0
+  *         to 7 to select the DMA Stream.
+  * @retval None
+  */
+static void DMA_MgrStop(DMA_Stream_TypeDef* DMAy_Streamx)
+{
+  DMA_Cmd(DMAy_Streamx, DISABLE);
+
+  while (DMA_GetCmdStatus(DMAy_Streamx) != DISABLE)
+  {
+  }
+}
+
+/**
+  * @brief  Starts the first queued transfer on an idle stream.
+  * @param  Index: the index of the manager context of the stream.
+  * @note   In streaming mode the second queued transfer, if any, is written in
+  *         memory target 1. Otherwise both memory targets are set to the first
+  *         transfer until a next one is queued.
+  * @retval None
+  */
+static void DMA_MgrStart(uint32_t Index)
+{
+  DMA_MgrStreamTypeDef* context = &DMA_MgrContext[Index];
+  DMA_Stream_TypeDef* stream = DMA_MgrStreamTable[Index];
+  DMA_MgrXferTypeDef* xfer = context->Head;
+
+  if (xfer == 0)
+  {
+    return;
+  }
+
+  context->Head = xfer->Next;
+  context->Active = xfer;
+  xfer->Status = DMA_MGR_XFER_ACTIVE;
+
+  /* The flags of the stream must be cleared before it is enabled */
+  DMA_ClearITPendingBit(stream, DMA_MgrAllIF[Index & 0x7]);
+  DMA_MemoryTargetConfig(stream, xfer->MemoryBaseAddr, DMA_Memory_0);
+
+  if (context->Streaming != 0)
+  {
+    context->Pending = context->Head;
+
+    if (context->Pending != 0)
+    {
+      context->Head = context->Pending->Next;
+      context->Pending->Status = DMA_MGR_XFER_ACTIVE;
+      DMA_DoubleBufferModeConfig(stream, context->Pending->MemoryBaseAddr, DMA_Memory_0);
+    }
+    else
+    {
+      DMA_DoubleBufferModeConfig(stream, xfer->MemoryBaseAddr, DMA_Memory_0);
+    }
+
+    DMA_SetCurrDataCounter(stream, context->BufferSize);
+  }
+  else
+  {
+    DMA_SetCurrDataCounter(stream, xfer->Count);
+  }
+
+  if (context->Head == 0)
+  {
+    context->Tail = 0;
+  }
+
+  DMA_Cmd(stream, ENABLE);
+}
+
+/**
+  * @brief  Aborts all the transfers of a stopped stream and calls their Callback.
+  * @param  Index: the index of the manager context of the stream.
+  * @retval None
+  */
+static void DMA_MgrFlush(uint32_t Index)
+{
+  DMA_MgrStreamTypeDef* context = &DMA_MgrContext[Index];
+  DMA_MgrXferTypeDef* xfer;
+  DMA_MgrXferTypeDef* next;
+
+  /* Chain the transfers in the order they were queued */
+  xfer = context->Head;
+  if (context->Pending != 0)
+  {
+    context->Pending->Next = xfer;
+    xfer = context->Pending;
+  }
+  if (context->Active != 0)
+  {
+    context->Active->Next = xfer;
+    xfer = context->Active;
+  }
+
+  context->Active = 0;
+  context->Pending = 0;
+  context->Head = 0;
+  context->Tail = 0;
+
+  while (xfer != 0)
+  {
+    next = xfer->Next;
+    xfer->Status = DMA_MGR_XFER_ABORTED;
+    if (xfer->Callback != 0)
+    {
+      xfer->Callback(xfer);
+    }
+    xfer = next;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -27,6 +27,8 @@
   *                    - Enable/Disable the prefetch buffer
   *                    - Enable/Disable the Instruction cache and the Data cache
   *                    - Reset the Instruction cache and the Data cache
+  *                    - Set the minimum latency, the prefetch buffer and the
+  *                      caches from the HCLK frequency
   *  
   *           2. FLASH Memory Programming functions: this group includes all needed
   *              functions to erase and program the main memory:
@@ -74,6 +76,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f4xx_flash.h"
+#include "stm32f4xx_rcc.h"
 
 /** @addtogroup STM32F4xx_StdPeriph_Driver
   * @{
@@ -88,6 +91,12 @@
 /* Private define ------------------------------------------------------------*/ 
 #define SECTOR_MASK               ((uint32_t)0xFFFFFF07)
 
+/* HCLK frequency of each wait state, per voltage range (see the table of
+   FLASH_Group1) */
+#define FLASH_WS_STEP_RANGE_1     ((uint32_t)16000000)
+#define FLASH_WS_STEP_RANGE_2     ((uint32_t)18000000)
+#define FLASH_WS_STEP_RANGE_3     ((uint32_t)30000000)
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -148,6 +157,18 @@
     - void FLASH_DataCacheCmd(FunctionalState NewState)
     - void FLASH_InstructionCacheReset(void)
     - void FLASH_DataCacheReset(void)
+
+   FLASH_AccessConfig() sets all of them from the HCLK frequency: the minimum
+   latency of the voltage range, the prefetch buffer (which is not used below
+   2.1 V), and the Instruction and Data caches, reset before they are
+   enabled. VoltageRange_2 covers 2.1 V to 2.7 V: the 2.1 V - 2.4 V column
+   is used.
+   
+   The latency must be increased before HCLK, and decreased after it:
+    - Before increasing HCLK, call FLASH_AccessConfig() with the new
+      frequency.
+    - After decreasing HCLK, call FLASH_AccessAutoConfig(), which gets HCLK
+      from RCC_GetClocksFreq().
    
    The unlock sequence is not needed for these functions.
  
@@ -264,6 +285,100 @@ void FLASH_DataCacheReset(void)
   FLASH->ACR |= FLASH_ACR_DCRST;
 }
 
+/**
+  * @brief  Returns the minimum latency for a HCLK frequency.
+  * @param  HCLK_Frequency: the HCLK frequency in Hz.
+  * @param  VoltageRange: The device voltage range.
+  *          This parameter can be one of the following values:
+  *            @arg VoltageRange_1: when the device voltage range is 1.8V to 2.1V
+  *            @arg VoltageRange_2: when the device voltage range is 2.1V to 2.7V
+  *            @arg VoltageRange_3: when the device voltage range is 2.7V to 3.6V
+  *            @arg VoltageRange_4: when the device voltage range is 2.7V to 3.6V + External Vpp
+  * @retval The latency: a value between FLASH_Latency_0 and FLASH_Latency_7
+  */
+uint32_t FLASH_GetMinLatency(uint32_t HCLK_Frequency, uint8_t VoltageRange)
+{
+  uint32_t step = FLASH_WS_STEP_RANGE_3;
+  uint32_t latency = 0;
+
+  /* Check the parameters */
+  assert_param(IS_VOLTAGERANGE(VoltageRange));
+
+  if (VoltageRange == VoltageRange_1)
+  {
+    step = FLASH_WS_STEP_RANGE_1;
+  }
+  else if (VoltageRange == VoltageRange_2)
+  {
+    step = FLASH_WS_STEP_RANGE_2;
+  }
+
+  if (HCLK_Frequency != 0)
+  {
+    latency = (HCLK_Frequency - 1) / step;
+  }
+  if (latency > FLASH_Latency_7)
+  {
+    latency = FLASH_Latency_7;
+  }
+
+  return latency;
+}
+
+/**
+  * @brief  Sets the minimum latency for a HCLK frequency, and enables the
+  *         prefetch buffer and the Instruction and Data caches.
+  * @note   Call this function before increasing HCLK, with the new frequency,
+  *         or after decreasing it.
+  * @param  HCLK_Frequency: the HCLK frequency in Hz.
+  * @param  VoltageRange: The device voltage range.
+  *          This parameter can be a value of @ref FLASH_Voltage_Range.
+  * @retval None
+  */
+void FLASH_AccessConfig(uint32_t HCLK_Frequency, uint8_t VoltageRange)
+{
+  uint32_t latency = FLASH_GetMinLatency(HCLK_Frequency, VoltageRange);
+
+  FLASH_SetLatency(latency);
+
+  /* Wait until the new latency is taken into account */
+  while ((FLASH->ACR & FLASH_ACR_LATENCY) != latency)
+  {
+  }
+
+  /* The caches are reset while they are disabled */
+  FLASH->ACR &= ~(FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+  FLASH->ACR |= FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+  FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+
+  /* The prefetch buffer is not used below 2.1 V */
+  if (VoltageRange == VoltageRange_1)
+  {
+    FLASH->ACR = (FLASH->ACR & ~FLASH_ACR_PRFTEN) | FLASH_ACR_ICEN | FLASH_ACR_DCEN;
+  }
+  else
+  {
+    FLASH->ACR |= FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN;
+  }
+}
+
+/**
+  * @brief  Sets the minimum latency for the current HCLK frequency, and
+  *         enables the prefetch buffer and the Instruction and Data caches.
+  * @note   Call this function after a change of the system clock or of the
+  *         AHB prescaler which decreased HCLK.
+  * @param  VoltageRange: The device voltage range.
+  *          This parameter can be a value of @ref FLASH_Voltage_Range.
+  * @retval None
+  */
+void FLASH_AccessAutoConfig(uint8_t VoltageRange)
+{
+  RCC_ClocksTypeDef clocks;
+
+  RCC_GetClocksFreq(&clocks);
+  FLASH_AccessConfig(clocks.HCLK_Frequency, VoltageRange);
+}
+
 /**
   * @}
   */
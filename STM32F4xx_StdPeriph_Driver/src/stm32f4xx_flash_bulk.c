@@ -0,0 +1,360 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_flash_bulk.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides functions to program buffers in the FLASH and
+  *          to erase sectors without blocking the CPU:
+  *           - Programming of a whole buffer in one program sequence, with the
+  *             widest parallelism of the voltage range
+  *           - Sector erase ended by the FLASH interrupt
+  *          It uses the stm32f4xx_flash.c/.h drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Call FLASH_Unlock() to enable the FLASH control register access.
+  *
+  *          2. Program a buffer using FLASH_ProgramBuffer().
+  *
+  *          3. To erase a sector without waiting, call FLASH_AsyncIRQHandler()
+  *             from FLASH_IRQHandler() and start the erase using
+  *             FLASH_EraseSectorAsync(). The Callback is called from the
+  *             interrupt when the erase ends; FLASH_GetEraseAsyncStatus()
+  *             returns FLASH_BUSY until then.
+  *
+  *          4. Call FLASH_Lock() to disable the FLASH control register access.
+  *
+  * @note   A read of the FLASH bank being erased stalls the bus until the end
+  *         of the erase. During an asynchronous erase, the code which runs and
+  *         the interrupt vectors and handlers must be in RAM, or in the other
+  *         bank on the STM32F42x/43x devices.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_flash_bulk.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup FLASH
+  * @brief FLASH driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SECTOR_MASK               ((uint32_t)0xFFFFFF07)
+
+/* Error flags of a program or erase operation */
+#define FLASH_FLAG_ERRORS         (FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | \
+                                   FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Asynchronous erase in progress */
+static __IO FLASH_Status FLASH_AsyncStatus = FLASH_COMPLETE;
+static void (*FLASH_AsyncCallback)(FLASH_Status Status) = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t FLASH_GetPSize(uint8_t VoltageRange);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup FLASH_Private_Functions
+  * @{
+  */
+
+/** @defgroup FLASH_Group5 Bulk programming and asynchronous erase functions
+ *  @brief   Bulk programming and asynchronous erase functions
+ *
+@verbatim
+ ===============================================================================
+              Bulk programming and asynchronous erase functions
+ ===============================================================================
+
+  FLASH_ProgramBuffer() sets the parallelism (PSIZE) and the PG bit once for
+  the whole buffer, and then writes the data items one after the other,
+  polling the BSY flag between them:
+    - VoltageRange_1: by byte
+    - VoltageRange_2: by half word
+    - VoltageRange_3: by word
+    - VoltageRange_4: by double word, with the external Vpp
+  The bytes before the first address aligned on the parallelism and after
+  the last one are programmed by byte.
+
+  FLASH_EraseSectorAsync() starts the erase of a sector with the end of
+  operation and error interrupts enabled, and returns at once. The erase of
+  a 128 Kbytes sector lasts 1 to 4 seconds, during which the CPU can run from
+  RAM or from the other bank.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Programs a buffer in the FLASH.
+  * @param  Address: the first address to program, any alignment.
+  * @param  Data: pointer to the data to program.
+  * @param  Length: number of bytes.
+  * @param  VoltageRange: The device voltage range which defines the program
+  *         parallelism.
+  *          This parameter can be one of the following values:
+  *            @arg VoltageRange_1: 1.8V to 2.1V, by byte (8-bit)
+  *            @arg VoltageRange_2: 2.1V to 2.7V, by half word (16-bit)
+  *            @arg VoltageRange_3: 2.7V to 3.6V, by word (32-bit)
+  *            @arg VoltageRange_4: 2.7V to 3.6V + External Vpp, by double word (64-bit)
+  * @retval FLASH Status: The returned value can be: FLASH_ERROR_PROGRAM,
+  *                       FLASH_ERROR_WRP, FLASH_ERROR_OPERATION or FLASH_COMPLETE.
+  */
+FLASH_Status FLASH_ProgramBuffer(uint32_t Address, const uint8_t* Data, uint32_t Length,
+                                 uint8_t VoltageRange)
+{
+  FLASH_Status status = FLASH_COMPLETE;
+  uint32_t psize = FLASH_GetPSize(VoltageRange);
+  uint32_t width = (uint32_t)1 << (psize >> 8);
+  uint32_t inputaddr = (uint32_t)Data;
+  uint32_t count = 0;
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_ADDRESS(Address));
+  assert_param(IS_VOLTAGERANGE(VoltageRange));
+
+  /* Wait for last operation to be completed */
+  status = FLASH_WaitForLastOperation();
+  if (status != FLASH_COMPLETE)
+  {
+    return status;
+  }
+
+  /* Bytes before the first aligned address, and the whole buffer when it is
+     shorter than a data item */
+  count = ((width - (Address & (width - 1))) & (width - 1));
+  if ((count > Length) || (Length < width))
+  {
+    count = Length;
+  }
+
+  FLASH->CR &= CR_PSIZE_MASK;
+  FLASH->CR |= FLASH_PSIZE_BYTE | FLASH_CR_PG;
+  for (; count != 0; count--)
+  {
+    *(__IO uint8_t*)Address = *(uint8_t*)inputaddr;
+    Address++;
+    inputaddr++;
+    Length--;
+    while ((FLASH->SR & FLASH_FLAG_BSY) != 0)
+    {
+    }
+  }
+
+  /* Aligned data items, with the parallelism of the voltage range */
+  FLASH->CR &= CR_PSIZE_MASK;
+  FLASH->CR |= psize;
+  while ((Length >= width) && ((FLASH->SR & FLASH_FLAG_ERRORS) == 0))
+  {
+    if (width == 8)
+    {
+      *(__IO uint64_t*)Address = (uint64_t)*(uint32_t*)inputaddr |
+                                 ((uint64_t)*(uint32_t*)(inputaddr + 4) << 32);
+    }
+    else if (width == 4)
+    {
+      *(__IO uint32_t*)Address = *(uint32_t*)inputaddr;
+    }
+    else if (width == 2)
+    {
+      *(__IO uint16_t*)Address = *(uint16_t*)inputaddr;
+    }
+    else
+    {
+      *(__IO uint8_t*)Address = *(uint8_t*)inputaddr;
+    }
+    Address += width;
+    inputaddr += width;
+    Length -= width;
+    while ((FLASH->SR & FLASH_FLAG_BSY) != 0)
+    {
+    }
+  }
+
+  /* Bytes after the last aligned address */
+  FLASH->CR &= CR_PSIZE_MASK;
+  while ((Length != 0) && ((FLASH->SR & FLASH_FLAG_ERRORS) == 0))
+  {
+    *(__IO uint8_t*)Address = *(uint8_t*)inputaddr;
+    Address++;
+    inputaddr++;
+    Length--;
+    while ((FLASH->SR & FLASH_FLAG_BSY) != 0)
+    {
+    }
+  }
+
+  /* Disable the PG Bit */
+  FLASH->CR &= (~FLASH_CR_PG);
+
+  return FLASH_GetStatus();
+}
+
+/**
+  * @brief  Starts the erase of a FLASH Sector, ended by the FLASH interrupt.
+  * @param  FLASH_Sector: The Sector number to be erased.
+  *          This parameter can be a value between FLASH_Sector_0 and FLASH_Sector_23
+  * @param  VoltageRange: The device voltage range which defines the erase parallelism.
+  *          This parameter can be a value of @ref FLASH_Voltage_Range.
+  * @param  Callback: function called from FLASH_AsyncIRQHandler() with the status
+  *         of the erase, or 0.
+  * @retval FLASH Status: FLASH_COMPLETE when the erase is started, FLASH_BUSY when
+  *         another operation is in progress, or the error of the last operation.
+  */
+FLASH_Status FLASH_EraseSectorAsync(uint32_t FLASH_Sector, uint8_t VoltageRange,
+                                    void (*Callback)(FLASH_Status Status))
+{
+  FLASH_Status status = FLASH_GetStatus();
+
+  /* Check the parameters */
+  assert_param(IS_FLASH_SECTOR(FLASH_Sector));
+  assert_param(IS_VOLTAGERANGE(VoltageRange));
+
+  if (status != FLASH_COMPLETE)
+  {
+    return status;
+  }
+
+  FLASH_AsyncCallback = Callback;
+  FLASH_AsyncStatus = FLASH_BUSY;
+
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_ERRORS);
+  FLASH_ITConfig(FLASH_IT_EOP | FLASH_IT_ERR, ENABLE);
+  NVIC_EnableIRQ(FLASH_IRQn);
+
+  FLASH->CR &= CR_PSIZE_MASK;
+  FLASH->CR |= FLASH_GetPSize(VoltageRange);
+  FLASH->CR &= SECTOR_MASK;
+  FLASH->CR |= FLASH_CR_SER | FLASH_Sector;
+  FLASH->CR |= FLASH_CR_STRT;
+
+  return FLASH_COMPLETE;
+}
+
+/**
+  * @brief  Returns the status of the last asynchronous erase.
+  * @param  None
+  * @retval FLASH Status: FLASH_BUSY while the erase is in progress, then
+  *         FLASH_ERROR_PROGRAM, FLASH_ERROR_WRP, FLASH_ERROR_OPERATION or
+  *         FLASH_COMPLETE.
+  */
+FLASH_Status FLASH_GetEraseAsyncStatus(void)
+{
+  return FLASH_AsyncStatus;
+}
+
+/**
+  * @brief  Handles the FLASH interrupt at the end of an asynchronous erase.
+  * @param  None
+  * @note   This function must be called from FLASH_IRQHandler().
+  * @retval None
+  */
+void FLASH_AsyncIRQHandler(void)
+{
+  FLASH_Status status = FLASH_COMPLETE;
+  uint32_t dcache = 0;
+
+  if ((FLASH_AsyncStatus != FLASH_BUSY) || ((FLASH->SR & FLASH_FLAG_BSY) != 0))
+  {
+    return;
+  }
+
+  status = FLASH_GetStatus();
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_ERRORS);
+  FLASH_ITConfig(FLASH_IT_EOP | FLASH_IT_ERR, DISABLE);
+
+  /* Disable the SER Bit */
+  FLASH->CR &= (~FLASH_CR_SER);
+  FLASH->CR &= SECTOR_MASK;
+
+  /* The data cache may hold the content of the sector before the erase */
+  dcache = FLASH->ACR & FLASH_ACR_DCEN;
+  if (dcache != 0)
+  {
+    FLASH_DataCacheCmd(DISABLE);
+    FLASH_DataCacheReset();
+    FLASH_DataCacheCmd(ENABLE);
+  }
+
+  FLASH_AsyncStatus = status;
+  if (FLASH_AsyncCallback != 0)
+  {
+    FLASH_AsyncCallback(status);
+  }
+}
+
+/**
+  * @brief  Returns the parallelism of a voltage range.
+  * @param  VoltageRange: The device voltage range.
+  * @retval The PSIZE bits of FLASH_CR
+  */
+static uint32_t FLASH_GetPSize(uint8_t VoltageRange)
+{
+  uint32_t psize = FLASH_PSIZE_DOUBLE_WORD;
+
+  if (VoltageRange == VoltageRange_1)
+  {
+    psize = FLASH_PSIZE_BYTE;
+  }
+  else if (VoltageRange == VoltageRange_2)
+  {
+    psize = FLASH_PSIZE_HALF_WORD;
+  }
+  else if (VoltageRange == VoltageRange_3)
+  {
+    psize = FLASH_PSIZE_WORD;
+  }
+
+  return psize;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,709 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hash_stream.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides incremental functions to compute the SHA1, MD5,
+  *          HMAC SHA1 and HMAC MD5 digests of messages given in parts:
+  *           - Update calls of any length
+  *           - DMA feeding of the last part of a message
+  *           - Several messages hashed at the same time, by context swapping
+  *          It uses the stm32f4xx_hash.c/.h and stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable The HASH controller clock using
+  *             RCC_AHB2PeriphClockCmd(RCC_AHB2Periph_HASH, ENABLE); function.
+  *             To feed the last part of the messages by DMA, enable the DMA2
+  *             clock, call DMA_MgrInit() and DMA_MgrIRQHandler() from the
+  *             interrupt handler of the stream of the HASH_IN request.
+  *
+  *          2. Start a message with HASH_StreamInit(), with an HMAC key or 0.
+  *
+  *          3. Give the parts of the message with HASH_StreamUpdate().
+  *
+  *          4. Get the digest with HASH_StreamFinish(), which also takes the
+  *             last part of the message.
+  *
+  *          5. Call HASH_StreamDeInit() for a session which is dropped before
+  *             HASH_StreamFinish().
+  *
+  * @note   The HMAC key is used again by HASH_StreamFinish(): it must stay
+  *         valid until then.
+  *
+  * @note   The functions of all the sessions must be called from the same
+  *         priority level.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_hash_stream.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup HASH
+  * @brief HASH driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define HASHBUSY_TIMEOUT    ((uint32_t) 0x00010000)
+
+/* States of a session */
+#define HASH_STREAM_STATE_NEW     ((uint8_t)0x00)
+#define HASH_STREAM_STATE_STARTED ((uint8_t)0x01)
+#define HASH_STREAM_STATE_ENDED   ((uint8_t)0x02)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Session whose message is in the HASH */
+static HASH_StreamSessionTypeDef* HASH_StreamCurrent = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static ErrorStatus HASH_StreamSelect(HASH_StreamSessionTypeDef* Session);
+static ErrorStatus HASH_StreamWrite(const uint8_t* Data, uint32_t Words, uint32_t* Written);
+static ErrorStatus HASH_StreamWaitBusy(void);
+static ErrorStatus HASH_StreamKey(HASH_StreamSessionTypeDef* Session);
+static void HASH_StreamSoftStart(HASH_StreamSessionTypeDef* Session, uint8_t Pad);
+static void HASH_StreamSoftUpdate(HASH_StreamSessionTypeDef* Session, const uint8_t* Input,
+                                  uint32_t Ilen);
+static void HASH_StreamSoftFinal(HASH_StreamSessionTypeDef* Session, uint32_t Digest[8]);
+static void HASH_StreamSoftPad(HASH_StreamSessionTypeDef* Session, uint8_t Pad, uint32_t Block[16]);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup HASH_Private_Functions
+  * @{
+  */
+
+/** @defgroup HASH_Group8 Incremental HASH and HMAC functions
+ *  @brief   Incremental HASH and HMAC functions
+ *
+@verbatim
+ ===============================================================================
+                     Incremental HASH and HMAC functions
+ ===============================================================================
+
+  This subsection provides functions allowing to hash messages which are not
+  in memory at once, such as a firmware image received over USB.
+
+  The HASH processes a block when its 16 words are in the IN FIFO and the next
+  word is written in HASH_DIN. The words of a message are written to the HASH
+  by blocks after its first word, and the bytes of an incomplete block are
+  kept in the session until the next update. Between two updates, the HASH
+  holds one word in HASH_DIN and no other data: this is the state in which the
+  context can be saved.
+
+  The HASH is given to one session at a time. When a session needs the HASH
+  while another session owns it, the context of the owner is saved with
+  HASH_SaveContext() into its session, and the context of the new session is
+  restored with HASH_RestoreContext(), or initialized for a new message.
+
+  Each DMA transfer to the HASH ends the message: the HASH starts the final
+  digest calculation at the end of the transfer. The DMA is therefore used
+  for the last part of the message given to HASH_StreamFinish(), when it is
+  at least HASH_STREAM_DMA_THRESHOLD bytes long, no more than 65535 words,
+  aligned on a word, and the bytes kept in the session are whole words.
+
+  The algorithms which the HASH does not support, i.e. SHA256 on the F40x,
+  are dispatched to the software of stm32f4xx_hash_sha256.c with the same
+  functions. Such sessions do not use the HASH and are not multiplexed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Starts a message.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @param  HASH_AlgoSelection: HASH_AlgoSelection_SHA1, HASH_AlgoSelection_MD5
+  *         or HASH_AlgoSelection_SHA256.
+  * @param  Key: pointer to the Key used for HMAC, or 0 for a HASH digest.
+  * @param  Keylen: length of the Key used for HMAC.
+  * @retval None
+  */
+void HASH_StreamInit(HASH_StreamSessionTypeDef* Session, uint32_t HASH_AlgoSelection,
+                     uint8_t* Key, uint32_t Keylen)
+{
+  /* Check the parameters */
+  assert_param(IS_HASH_STREAM_ALGOSELECTION(HASH_AlgoSelection));
+
+  HASH_StreamDeInit(Session);
+
+  Session->BufferLength = 0;
+  Session->Written = 0;
+  Session->HASH_AlgoSelection = HASH_AlgoSelection;
+  Session->Key = Key;
+  Session->Keylen = (Key != 0) ? Keylen : 0;
+  Session->State = HASH_STREAM_STATE_NEW;
+
+  if (HASH_AlgoSelection == HASH_AlgoSelection_SHA256)
+  {
+    HASH_StreamSoftStart(Session, 0x36);
+  }
+}
+
+/**
+  * @brief  Drops the message of a session.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @retval None
+  */
+void HASH_StreamDeInit(HASH_StreamSessionTypeDef* Session)
+{
+  if (HASH_StreamCurrent == Session)
+  {
+    HASH_StreamCurrent = 0;
+  }
+  Session->State = HASH_STREAM_STATE_ENDED;
+}
+
+/**
+  * @brief  Hashes a part of a message.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @param  Input: pointer to the Input buffer to be treated.
+  * @param  Ilen: length of the Input buffer, any value.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the part is hashed or kept in the session
+  *          - ERROR: the message is ended, or the HASH timed out
+  */
+ErrorStatus HASH_StreamUpdate(HASH_StreamSessionTypeDef* Session, uint8_t* Input, uint32_t Ilen)
+{
+  uint8_t* buffer = (uint8_t*)Session->Buffer;
+  uint32_t need = 0, words = 0;
+
+  if (Session->State == HASH_STREAM_STATE_ENDED)
+  {
+    return ERROR;
+  }
+
+  if (Session->HASH_AlgoSelection == HASH_AlgoSelection_SHA256)
+  {
+    HASH_StreamSoftUpdate(Session, Input, Ilen);
+    return SUCCESS;
+  }
+
+  while (Ilen != 0)
+  {
+    /* The first word, then whole blocks */
+    need = (Session->Written == 0) ? 4 : 64;
+
+    if ((Session->BufferLength == 0) && (Ilen >= need))
+    {
+      words = (Session->Written == 0) ? 1 : ((Ilen / 64) * 16);
+      if ((HASH_StreamSelect(Session) != SUCCESS) ||
+          (HASH_StreamWrite(Input, words, &Session->Written) != SUCCESS))
+      {
+        return ERROR;
+      }
+      Input += words * 4;
+      Ilen -= words * 4;
+    }
+    else
+    {
+      while ((Session->BufferLength < need) && (Ilen != 0))
+      {
+        buffer[Session->BufferLength++] = *Input++;
+        Ilen--;
+      }
+      if (Session->BufferLength == need)
+      {
+        if ((HASH_StreamSelect(Session) != SUCCESS) ||
+            (HASH_StreamWrite(buffer, need / 4, &Session->Written) != SUCCESS))
+        {
+          return ERROR;
+        }
+        Session->BufferLength = 0;
+      }
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Hashes the last part of a message and returns its digest.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @param  Input: pointer to the last part of the message, or 0.
+  * @param  Ilen: length of the Input buffer.
+  * @param  Output: the returned digest, 20 bytes for SHA1, 16 bytes for MD5,
+  *         32 bytes for SHA256.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: digest computation done
+  *          - ERROR: digest computation failed
+  */
+ErrorStatus HASH_StreamFinish(HASH_StreamSessionTypeDef* Session, uint8_t* Input, uint32_t Ilen,
+                              uint8_t* Output)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  DMA_MgrXferTypeDef xfer;
+  HASH_MsgDigest HASH_MessageDigest;
+  uint32_t digest[8];
+  DMA_Stream_TypeDef* stream = 0;
+  uint32_t outputaddr = (uint32_t)Output;
+  uint32_t last = 0, i = 0;
+  ErrorStatus status = SUCCESS;
+
+  if (Session->State == HASH_STREAM_STATE_ENDED)
+  {
+    return ERROR;
+  }
+
+  if (Session->HASH_AlgoSelection == HASH_AlgoSelection_SHA256)
+  {
+    HASH_StreamSoftUpdate(Session, Input, Ilen);
+    HASH_StreamSoftFinal(Session, digest);
+
+    /* Outer hash of an HMAC */
+    if (Session->Key != 0)
+    {
+      HASH_StreamSoftStart(Session, 0x5C);
+      HASH_StreamSoftUpdate(Session, (uint8_t*)digest, 32);
+      HASH_StreamSoftFinal(Session, digest);
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+      *(uint32_t*)(outputaddr) = digest[i];
+      outputaddr += 4;
+    }
+    HASH_StreamDeInit(Session);
+
+    return SUCCESS;
+  }
+
+  /* A long last part goes to the DMA */
+  if ((Input != 0) && (Ilen >= HASH_STREAM_DMA_THRESHOLD) && (Ilen <= (0xFFFF * 4)) &&
+      ((Session->BufferLength & 0x3) == 0) && (((uint32_t)Input & 0x3) == 0))
+  {
+    DMA_StructInit(&DMA_InitStructure);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&HASH->DIN;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+    DMA_InitStructure.DMA_BufferSize = 1;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+    stream = DMA_MgrAlloc(DMA_MGR_REQ_HASH_IN, &DMA_InitStructure);
+  }
+  if ((stream == 0) && (Input != 0) && (HASH_StreamUpdate(Session, Input, Ilen) != SUCCESS))
+  {
+    return ERROR;
+  }
+
+  if (HASH_StreamSelect(Session) != SUCCESS)
+  {
+    DMA_MgrFree(stream);
+    return ERROR;
+  }
+
+  /* The bytes kept in the session, the last word zero padded */
+  last = (stream != 0) ? Ilen : Session->BufferLength;
+  HASH_SetLastWordValidBitsNbr(8 * (last % 4));
+  for (i = Session->BufferLength; (i & 0x3) != 0; i++)
+  {
+    ((uint8_t*)Session->Buffer)[i] = 0;
+  }
+  status = HASH_StreamWrite((uint8_t*)Session->Buffer, i / 4, &Session->Written);
+
+  if (stream != 0)
+  {
+    if (status == SUCCESS)
+    {
+      /* The HASH starts the digest calculation at the end of the transfer */
+      xfer.MemoryBaseAddr = (uint32_t)Input;
+      xfer.Count = (uint16_t)((Ilen + 3) / 4);
+      xfer.Callback = 0;
+      HASH_DMACmd(ENABLE);
+      if (DMA_MgrSubmit(stream, &xfer) != SUCCESS)
+      {
+        xfer.Status = DMA_MGR_XFER_ERROR;
+      }
+      while ((xfer.Status == DMA_MGR_XFER_QUEUED) || (xfer.Status == DMA_MGR_XFER_ACTIVE))
+      {
+      }
+      if (xfer.Status != DMA_MGR_XFER_DONE)
+      {
+        status = ERROR;
+      }
+      HASH_DMACmd(DISABLE);
+    }
+    DMA_MgrFree(stream);
+  }
+  else if (status == SUCCESS)
+  {
+    HASH_StartDigest();
+  }
+
+  if ((status == SUCCESS) && (HASH_StreamWaitBusy() == SUCCESS) &&
+      ((Session->Key == 0) || (HASH_StreamKey(Session) == SUCCESS)))
+  {
+    HASH_GetDigest(&HASH_MessageDigest);
+    for (i = 0; i < ((Session->HASH_AlgoSelection == HASH_AlgoSelection_SHA1) ? 5 : 4); i++)
+    {
+      *(uint32_t*)(outputaddr) = __REV(HASH_MessageDigest.Data[i]);
+      outputaddr += 4;
+    }
+  }
+  else
+  {
+    status = ERROR;
+  }
+
+  HASH_StreamDeInit(Session);
+
+  return status;
+}
+
+/**
+  * @brief  Gives the HASH to a session: saves the context of the session
+  *         which owns the HASH, then restores or starts the message of the
+  *         new session.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the HASH holds the message of the session
+  *          - ERROR: the HASH timed out
+  */
+static ErrorStatus HASH_StreamSelect(HASH_StreamSessionTypeDef* Session)
+{
+  HASH_InitTypeDef HASH_InitStructure;
+  __IO uint32_t counter = 0;
+  uint32_t busystatus = 0;
+
+  if (HASH_StreamCurrent == Session)
+  {
+    return SUCCESS;
+  }
+
+  if (HASH_StreamCurrent != 0)
+  {
+    /* The context is saved when the FIFO is free and the core idle */
+    do
+    {
+      busystatus = ((HASH_GetFlagStatus(HASH_FLAG_DINIS) == RESET) ||
+                    (HASH_GetFlagStatus(HASH_FLAG_BUSY) != RESET));
+      counter++;
+    }while ((counter != HASHBUSY_TIMEOUT) && (busystatus != 0));
+
+    if (busystatus != 0)
+    {
+      return ERROR;
+    }
+    HASH_SaveContext(&HASH_StreamCurrent->Context);
+    HASH_StreamCurrent = 0;
+  }
+
+  if (Session->State == HASH_STREAM_STATE_STARTED)
+  {
+    HASH_RestoreContext(&Session->Context);
+  }
+  else
+  {
+    HASH_DMACmd(DISABLE);
+    HASH_InitStructure.HASH_AlgoSelection = Session->HASH_AlgoSelection;
+    HASH_InitStructure.HASH_AlgoMode = (Session->Key != 0) ? HASH_AlgoMode_HMAC : HASH_AlgoMode_HASH;
+    HASH_InitStructure.HASH_DataType = HASH_DataType_8b;
+    HASH_InitStructure.HASH_HMACKeyType = (Session->Keylen > 64) ? HASH_HMACKeyType_LongKey :
+                                                                   HASH_HMACKeyType_ShortKey;
+    HASH_Init(&HASH_InitStructure);
+
+    /* The inner hash of an HMAC starts with the key */
+    if ((Session->Key != 0) && (HASH_StreamKey(Session) != SUCCESS))
+    {
+      return ERROR;
+    }
+    Session->State = HASH_STREAM_STATE_STARTED;
+  }
+
+  HASH_StreamCurrent = Session;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Writes words to the HASH, a block at a time.
+  * @param  Data: the bytes of the words, any alignment.
+  * @param  Words: the number of words.
+  * @param  Written: the number of words written since the start of the
+  *         message or key, updated.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the words are written
+  *          - ERROR: the HASH timed out
+  */
+static ErrorStatus HASH_StreamWrite(const uint8_t* Data, uint32_t Words, uint32_t* Written)
+{
+  __IO uint32_t counter = 0;
+  uint32_t inputaddr = (uint32_t)Data;
+
+  while (Words != 0)
+  {
+    /* A block is in the FIFO: wait until the core takes it */
+    if ((*Written & 0xF) == 1)
+    {
+      counter = 0;
+      while ((counter != HASHBUSY_TIMEOUT) && (HASH_GetFlagStatus(HASH_FLAG_DINIS) == RESET))
+      {
+        counter++;
+      }
+      if (HASH_GetFlagStatus(HASH_FLAG_DINIS) == RESET)
+      {
+        return ERROR;
+      }
+    }
+
+    HASH_DataIn(*(uint32_t*)inputaddr);
+    inputaddr += 4;
+    (*Written)++;
+    Words--;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Waits until the HASH has computed the digest.
+  * @param  None
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: digest computation done
+  *          - ERROR: the HASH timed out
+  */
+static ErrorStatus HASH_StreamWaitBusy(void)
+{
+  __IO uint32_t counter = 0;
+  uint32_t busystatus = 0;
+
+  do
+  {
+    busystatus = HASH_GetFlagStatus(HASH_FLAG_BUSY);
+    counter++;
+  }while ((counter != HASHBUSY_TIMEOUT) && (busystatus != RESET));
+
+  return (busystatus != RESET) ? ERROR : SUCCESS;
+}
+
+/**
+  * @brief  Writes the HMAC key and runs its digest calculation, at the start
+  *         of the inner hash and for the outer hash.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the key is hashed
+  *          - ERROR: the HASH timed out
+  */
+static ErrorStatus HASH_StreamKey(HASH_StreamSessionTypeDef* Session)
+{
+  uint32_t written = 0;
+
+  HASH_SetLastWordValidBitsNbr(8 * (Session->Keylen % 4));
+  if (HASH_StreamWrite(Session->Key, (Session->Keylen + 3) / 4, &written) != SUCCESS)
+  {
+    return ERROR;
+  }
+  HASH_StartDigest();
+
+  return HASH_StreamWaitBusy();
+}
+
+/**
+  * @brief  Starts a message computed by software: sets the initial chaining
+  *         value and, for an HMAC, processes the padded key.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @param  Pad: 0x36 for the inner hash, 0x5C for the outer hash of an HMAC.
+  * @retval None
+  */
+static void HASH_StreamSoftStart(HASH_StreamSessionTypeDef* Session, uint8_t Pad)
+{
+  Session->Digest[0] = 0x6A09E667;
+  Session->Digest[1] = 0xBB67AE85;
+  Session->Digest[2] = 0x3C6EF372;
+  Session->Digest[3] = 0xA54FF53A;
+  Session->Digest[4] = 0x510E527F;
+  Session->Digest[5] = 0x9B05688C;
+  Session->Digest[6] = 0x1F83D9AB;
+  Session->Digest[7] = 0x5BE0CD19;
+  Session->BufferLength = 0;
+  Session->Written = 0;
+
+  if (Session->Key != 0)
+  {
+    HASH_StreamSoftPad(Session, Pad, Session->Buffer);
+    HASH_SHA256Process(Session->Digest, (uint8_t*)Session->Buffer, 1);
+    Session->Written = 1;
+  }
+  Session->State = HASH_STREAM_STATE_STARTED;
+}
+
+/**
+  * @brief  Processes a part of a message computed by software.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @param  Input: pointer to the Input buffer to be treated.
+  * @param  Ilen: length of the Input buffer.
+  * @retval None
+  */
+static void HASH_StreamSoftUpdate(HASH_StreamSessionTypeDef* Session, const uint8_t* Input,
+                                  uint32_t Ilen)
+{
+  uint8_t* buffer = (uint8_t*)Session->Buffer;
+  uint32_t blocks = 0;
+
+  /* Complete the kept block */
+  if (Session->BufferLength != 0)
+  {
+    while ((Session->BufferLength < 64) && (Ilen != 0))
+    {
+      buffer[Session->BufferLength++] = *Input++;
+      Ilen--;
+    }
+    if (Session->BufferLength < 64)
+    {
+      return;
+    }
+    HASH_SHA256Process(Session->Digest, buffer, 1);
+    Session->Written++;
+    Session->BufferLength = 0;
+  }
+
+  /* Whole blocks straight from the Input buffer */
+  blocks = Ilen / 64;
+  if (blocks != 0)
+  {
+    HASH_SHA256Process(Session->Digest, Input, blocks);
+    Session->Written += blocks;
+    Input += blocks * 64;
+    Ilen -= blocks * 64;
+  }
+
+  while (Ilen != 0)
+  {
+    buffer[Session->BufferLength++] = *Input++;
+    Ilen--;
+  }
+}
+
+/**
+  * @brief  Pads a message computed by software and returns its digest.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @param  Digest: the returned digest, in the byte order of the output.
+  * @retval None
+  */
+static void HASH_StreamSoftFinal(HASH_StreamSessionTypeDef* Session, uint32_t Digest[8])
+{
+  uint8_t* buffer = (uint8_t*)Session->Buffer;
+  uint32_t high = Session->Written >> 23;
+  uint32_t low = (Session->Written << 9) + (Session->BufferLength << 3);
+  uint32_t i = 0;
+
+  buffer[Session->BufferLength++] = 0x80;
+  if (Session->BufferLength > 56)
+  {
+    while (Session->BufferLength < 64)
+    {
+      buffer[Session->BufferLength++] = 0;
+    }
+    HASH_SHA256Process(Session->Digest, buffer, 1);
+    Session->BufferLength = 0;
+  }
+  while (Session->BufferLength < 56)
+  {
+    buffer[Session->BufferLength++] = 0;
+  }
+  Session->Buffer[14] = __REV(high);
+  Session->Buffer[15] = __REV(low);
+  HASH_SHA256Process(Session->Digest, buffer, 1);
+
+  for (i = 0; i < 8; i++)
+  {
+    Digest[i] = __REV(Session->Digest[i]);
+  }
+}
+
+/**
+  * @brief  Builds the padded HMAC key block of a message computed by
+  *         software. A key longer than a block is replaced by its digest.
+  * @param  Session: pointer to the HASH_StreamSessionTypeDef structure of the
+  *         message.
+  * @param  Pad: 0x36 for the inner hash, 0x5C for the outer hash.
+  * @param  Block: the returned 64-byte block.
+  * @retval None
+  */
+static void HASH_StreamSoftPad(HASH_StreamSessionTypeDef* Session, uint8_t Pad, uint32_t Block[16])
+{
+  HASH_StreamSessionTypeDef keysession;
+  uint8_t* block = (uint8_t*)Block;
+  uint32_t i = 0;
+
+  if (Session->Keylen > 64)
+  {
+    HASH_StreamInit(&keysession, HASH_AlgoSelection_SHA256, 0, 0);
+    HASH_StreamFinish(&keysession, Session->Key, Session->Keylen, block);
+    i = 32;
+  }
+  else
+  {
+    for (i = 0; i < Session->Keylen; i++)
+    {
+      block[i] = Session->Key[i];
+    }
+  }
+  while (i < 64)
+  {
+    block[i++] = 0;
+  }
+  for (i = 0; i < 64; i++)
+  {
+    block[i] ^= Pad;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
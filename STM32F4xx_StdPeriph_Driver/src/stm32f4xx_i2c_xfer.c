@@ -0,0 +1,873 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_i2c_xfer.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a non-blocking I2C master engine driven by the
+  *          I2C event and error interrupts, with DMA for the payloads:
+  *           - Queue of register read, register write and combined
+  *             write-then-read transactions
+  *           - Timeout of the transactions and recovery of a stuck bus
+  *           - Sequences of the 1-byte and DMA receptions which avoid the
+  *             timing critical software events of the I2C
+  *          It uses the stm32f4xx_i2c.c/.h, stm32f4xx_gpio.c/.h and
+  *          stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the I2C, GPIO and DMA1 clocks, configure the SCL and SDA
+  *             pins in alternate function open-drain and call DMA_MgrInit().
+  *
+  *          2. Call I2C_XferInit() with an I2C_XferEngineTypeDef structure for the
+  *             I2C. Call I2C_XferEvIRQHandler() and I2C_XferErIRQHandler() from the
+  *             event and error interrupt handlers of the I2C, DMA_MgrIRQHandler()
+  *             from the interrupt handlers of the two streams of the I2C RX and
+  *             TX requests, and enable the I2C interrupts using NVIC_Init().
+  *
+  *          3. Optionally call I2C_XferTick() periodically, for example from the
+  *             SysTick interrupt every millisecond, to enable the Timeout of the
+  *             transactions.
+  *
+  *          4. Queue the transactions using I2C_XferSubmit():
+  *              - register write: RegSize and Reg, then WrLength bytes of pWrData
+  *              - register read: RegSize and Reg, then a repeated start and
+  *                RdLength bytes read into pRdData
+  *              - plain read or write: RegSize set to 0
+  *             The Callback is called from the interrupt handlers at the end of
+  *             each transaction. The transaction belongs to the engine until its
+  *             Status is no longer I2C_XFER_QUEUED or I2C_XFER_ACTIVE.
+  *
+  * @note   The STOP ending a DMA reception is generated from the Transfer
+  *         Complete interrupt of the RX stream: give this interrupt a priority
+  *         at least as high as the I2C event interrupt.
+  *
+  * @note   The bus recovery assumes the I2C is the only master of the bus: SCL
+  *         is clocked until the slave releases SDA, then a STOP is sent and the
+  *         I2C is reset.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_i2c_xfer.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup I2C
+  * @brief I2C driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Steps of a transaction */
+#define I2C_XFER_STATE_IDLE       ((uint32_t)0x00000000)
+#define I2C_XFER_STATE_START_TX   ((uint32_t)0x00000001)  /* Waiting for SB, write phase */
+#define I2C_XFER_STATE_ADDR_TX    ((uint32_t)0x00000002)  /* Waiting for ADDR, write phase */
+#define I2C_XFER_STATE_TX_REG     ((uint32_t)0x00000003)  /* Sending Reg on TXE */
+#define I2C_XFER_STATE_TX_DMA     ((uint32_t)0x00000004)  /* Sending pWrData by DMA */
+#define I2C_XFER_STATE_TX_BTF     ((uint32_t)0x00000005)  /* Waiting for the last byte sent */
+#define I2C_XFER_STATE_START_RX   ((uint32_t)0x00000006)  /* Waiting for SB, read phase */
+#define I2C_XFER_STATE_ADDR_RX    ((uint32_t)0x00000007)  /* Waiting for ADDR, read phase */
+#define I2C_XFER_STATE_RX_ONE     ((uint32_t)0x00000008)  /* Receiving a single byte on RXNE */
+#define I2C_XFER_STATE_RX_DMA     ((uint32_t)0x00000009)  /* Receiving pRdData by DMA */
+
+#define I2C_XFER_ERROR_FLAGS      (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR | \
+                                   I2C_SR1_PECERR | I2C_SR1_TIMEOUT | I2C_SR1_SMBALERT)
+
+#define I2C_XFER_STOP_TIMEOUT     ((uint32_t)0x00010000)
+#define I2C_XFER_RECOVERY_CLOCKS  ((uint32_t)9)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void I2C_XferStart(I2C_XferEngineTypeDef* Engine);
+static void I2C_XferStartTxDma(I2C_XferEngineTypeDef* Engine);
+static void I2C_XferComplete(I2C_XferEngineTypeDef* Engine, uint32_t Status);
+static void I2C_XferFail(I2C_XferEngineTypeDef* Engine, uint32_t Status, uint8_t Recover);
+static void I2C_XferRecover(I2C_XferEngineTypeDef* Engine);
+static void I2C_XferPinMode(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIOMode_TypeDef GPIO_Mode);
+static void I2C_XferDelay(void);
+static void I2C_XferRxDone(DMA_MgrXferTypeDef* Xfer);
+static void I2C_XferTxDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup I2C_Private_Functions
+  * @{
+  */
+
+/** @defgroup I2C_Group6 I2C master engine functions
+ *  @brief   I2C master engine functions
+ *
+@verbatim
+ ===============================================================================
+                         I2C master engine functions
+ ===============================================================================
+
+  This subsection provides functions allowing to run queues of I2C master
+  transactions from the interrupts, instead of polling the events with
+  I2C_CheckEvent().
+
+  The start, address and register address steps are driven by the event
+  interrupt. The payload is transferred by DMA: pWrData on the TX stream, then
+  the end of the last byte is given by BTF; pRdData on the RX stream with the
+  DMA last transfer bit set, so that the I2C itself NACKs the last byte, and the
+  STOP is generated from the Transfer Complete interrupt.
+
+  The software steps which the I2C requires at a precise time are arranged to
+  stay out of the critical windows of the receiver:
+   - a single byte is received with ACK cleared before ADDR is cleared, and the
+     STOP is programmed just after ADDR is cleared with the interrupts masked;
+   - 2 bytes or more are received by DMA, which reads every byte in time.
+  The event interrupt is disabled during the DMA transfers, so that a BTF event
+  does not keep it pending.
+
+  A NACK ends the transaction with a STOP. A bus error, a timeout or a bus
+  found busy before a START runs the bus recovery: SCL is toggled until SDA is
+  released, a STOP is sent by software and the I2C is reset and configured
+  again. This also clears the BUSY flag when the analog filter of the I2C
+  locked it.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes an I2C master engine and allocates its DMA streams.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @param  I2C_XferInitStruct: pointer to an I2C_XferInitTypeDef structure that
+  *         contains the configuration of the I2C and of its pins.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the engine is ready
+  *          - ERROR: no free DMA stream for the I2C requests
+  */
+ErrorStatus I2C_XferInit(I2C_XferEngineTypeDef* Engine, const I2C_XferInitTypeDef* I2C_XferInitStruct)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  I2C_TypeDef* i2c = I2C_XferInitStruct->I2Cx;
+  uint32_t rxrequest = DMA_MGR_REQ_I2C1_RX, txrequest = DMA_MGR_REQ_I2C1_TX;
+
+  /* Check the parameters */
+  assert_param(IS_I2C_ALL_PERIPH(i2c));
+  assert_param(I2C_XferInitStruct->I2C_InitStruct.I2C_Mode == I2C_Mode_I2C);
+
+  if (i2c == I2C2)
+  {
+    rxrequest = DMA_MGR_REQ_I2C2_RX;
+    txrequest = DMA_MGR_REQ_I2C2_TX;
+  }
+  else if (i2c == I2C3)
+  {
+    rxrequest = DMA_MGR_REQ_I2C3_RX;
+    txrequest = DMA_MGR_REQ_I2C3_TX;
+  }
+
+  Engine->Init = *I2C_XferInitStruct;
+  Engine->Active = 0;
+  Engine->Head = 0;
+  Engine->Tail = 0;
+  Engine->State = I2C_XFER_STATE_IDLE;
+  Engine->Index = 0;
+  Engine->Ticks = 0;
+  Engine->Recoveries = 0;
+
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&i2c->DR;
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  Engine->RxStream = DMA_MgrAlloc(rxrequest, &DMA_InitStructure);
+  if (Engine->RxStream == 0)
+  {
+    return ERROR;
+  }
+
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+  Engine->TxStream = DMA_MgrAlloc(txrequest, &DMA_InitStructure);
+  if (Engine->TxStream == 0)
+  {
+    DMA_MgrFree(Engine->RxStream);
+    Engine->RxStream = 0;
+    return ERROR;
+  }
+
+  Engine->RxXfer.Callback = I2C_XferRxDone;
+  Engine->RxXfer.Context = Engine;
+  Engine->TxXfer.Callback = I2C_XferTxDone;
+  Engine->TxXfer.Context = Engine;
+
+  I2C_Init(i2c, &Engine->Init.I2C_InitStruct);
+  I2C_ITConfig(i2c, I2C_IT_ERR, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Aborts the transactions of an engine and releases its DMA streams.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @retval None
+  */
+void I2C_XferDeInit(I2C_XferEngineTypeDef* Engine)
+{
+  I2C_XferAbort(Engine);
+
+  I2C_ITConfig(Engine->Init.I2Cx, I2C_IT_ERR | I2C_IT_EVT | I2C_IT_BUF, DISABLE);
+  I2C_Cmd(Engine->Init.I2Cx, DISABLE);
+
+  if (Engine->RxStream != 0)
+  {
+    DMA_MgrFree(Engine->RxStream);
+    Engine->RxStream = 0;
+  }
+  if (Engine->TxStream != 0)
+  {
+    DMA_MgrFree(Engine->TxStream);
+    Engine->TxStream = 0;
+  }
+}
+
+/**
+  * @brief  Queues a transaction.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @param  Xfer: pointer to the I2C_XferTypeDef structure of the transaction.
+  * @note   A transaction without any byte only checks that the slave
+  *         acknowledges its address.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the transaction is queued
+  *          - ERROR: invalid transaction
+  */
+ErrorStatus I2C_XferSubmit(I2C_XferEngineTypeDef* Engine, I2C_XferTypeDef* Xfer)
+{
+  uint32_t primask;
+
+  if ((Xfer->RegSize > 2) || ((Xfer->WrLength != 0) && (Xfer->pWrData == 0)) ||
+      ((Xfer->RdLength != 0) && (Xfer->pRdData == 0)))
+  {
+    return ERROR;
+  }
+
+  Xfer->Status = I2C_XFER_QUEUED;
+  Xfer->Next = 0;
+
+  primask = NVIC_EnterCritical();
+
+  if (Engine->Tail != 0)
+  {
+    Engine->Tail->Next = Xfer;
+  }
+  else
+  {
+    Engine->Head = Xfer;
+  }
+  Engine->Tail = Xfer;
+
+  if (Engine->Active == 0)
+  {
+    I2C_XferStart(Engine);
+  }
+
+  NVIC_ExitCritical(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops the transaction in progress and aborts all the queued ones.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @note   The Callback of the aborted transactions is called with their Status
+  *         set to I2C_XFER_ABORTED. A STOP is sent if a transaction was in
+  *         progress.
+  * @retval None
+  */
+void I2C_XferAbort(I2C_XferEngineTypeDef* Engine)
+{
+  I2C_XferTypeDef* xfer;
+  I2C_XferTypeDef* next;
+  uint32_t primask = NVIC_EnterCritical();
+
+  xfer = Engine->Head;
+  Engine->Head = 0;
+  Engine->Tail = 0;
+
+  if (Engine->Active != 0)
+  {
+    Engine->Active->Next = xfer;
+    xfer = Engine->Active;
+    Engine->Active = 0;
+
+    Engine->State = I2C_XFER_STATE_IDLE;
+    I2C_ITConfig(Engine->Init.I2Cx, I2C_IT_EVT | I2C_IT_BUF, DISABLE);
+    I2C_DMACmd(Engine->Init.I2Cx, DISABLE);
+    I2C_DMALastTransferCmd(Engine->Init.I2Cx, DISABLE);
+    DMA_MgrAbort(Engine->RxStream);
+    DMA_MgrAbort(Engine->TxStream);
+    I2C_GenerateSTOP(Engine->Init.I2Cx, ENABLE);
+  }
+
+  NVIC_ExitCritical(primask);
+
+  while (xfer != 0)
+  {
+    next = xfer->Next;
+    xfer->Status = I2C_XFER_ABORTED;
+    if (xfer->Callback != 0)
+    {
+      xfer->Callback(xfer);
+    }
+    xfer = next;
+  }
+}
+
+/**
+  * @brief  Checks whether an engine has a transaction in progress or queued.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @retval The new state of the engine (SET or RESET).
+  */
+FlagStatus I2C_XferBusy(I2C_XferEngineTypeDef* Engine)
+{
+  if ((Engine->Active != 0) || (Engine->Head != 0))
+  {
+    return SET;
+  }
+  return RESET;
+}
+
+/**
+  * @brief  Counts the time of the transaction in progress.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @note   When the Timeout of the transaction elapses, the bus is recovered and
+  *         the transaction ends with the I2C_XFER_TIMEOUT status: its Callback
+  *         is called from this function.
+  * @retval None
+  */
+void I2C_XferTick(I2C_XferEngineTypeDef* Engine)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  if ((Engine->Active != 0) && (Engine->Ticks != 0))
+  {
+    Engine->Ticks--;
+    if (Engine->Ticks == 0)
+    {
+      I2C_XferFail(Engine, I2C_XFER_TIMEOUT, 1);
+    }
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Handles the event interrupt of the I2C.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @note   This function must be called from the I2Cx_EV_IRQHandler.
+  * @retval None
+  */
+void I2C_XferEvIRQHandler(I2C_XferEngineTypeDef* Engine)
+{
+  I2C_TypeDef* i2c = Engine->Init.I2Cx;
+  I2C_XferTypeDef* xfer = Engine->Active;
+  uint16_t sr1 = i2c->SR1;
+  uint32_t primask;
+
+  if (xfer == 0)
+  {
+    I2C_ITConfig(i2c, I2C_IT_EVT | I2C_IT_BUF, DISABLE);
+    return;
+  }
+
+  switch (Engine->State)
+  {
+    case I2C_XFER_STATE_START_TX:
+      if ((sr1 & I2C_SR1_SB) != 0)
+      {
+        Engine->State = I2C_XFER_STATE_ADDR_TX;
+        I2C_Send7bitAddress(i2c, xfer->Address, I2C_Direction_Transmitter);
+      }
+      break;
+
+    case I2C_XFER_STATE_ADDR_TX:
+      if ((sr1 & I2C_SR1_ADDR) != 0)
+      {
+        if (xfer->RegSize != 0)
+        {
+          Engine->State = I2C_XFER_STATE_TX_REG;
+          I2C_ITConfig(i2c, I2C_IT_BUF, ENABLE);
+          (void)i2c->SR2;
+        }
+        else if (xfer->WrLength != 0)
+        {
+          I2C_XferStartTxDma(Engine);
+          (void)i2c->SR2;
+        }
+        else
+        {
+          /* Address only */
+          (void)i2c->SR2;
+          I2C_GenerateSTOP(i2c, ENABLE);
+          I2C_XferComplete(Engine, I2C_XFER_DONE);
+        }
+      }
+      break;
+
+    case I2C_XFER_STATE_TX_REG:
+      if ((sr1 & I2C_SR1_TXE) != 0)
+      {
+        Engine->Index++;
+        if (Engine->Index < xfer->RegSize)
+        {
+          I2C_SendData(i2c, (uint8_t)(xfer->Reg >> 8));
+        }
+        else
+        {
+          I2C_SendData(i2c, (uint8_t)xfer->Reg);
+          I2C_ITConfig(i2c, I2C_IT_BUF, DISABLE);
+
+          if (xfer->WrLength != 0)
+          {
+            I2C_XferStartTxDma(Engine);
+          }
+          else
+          {
+            Engine->State = I2C_XFER_STATE_TX_BTF;
+          }
+        }
+      }
+      break;
+
+    case I2C_XFER_STATE_TX_BTF:
+      if ((sr1 & I2C_SR1_BTF) != 0)
+      {
+        if (xfer->RdLength != 0)
+        {
+          /* Repeated start: BTF is cleared by the START condition */
+          Engine->State = I2C_XFER_STATE_START_RX;
+          I2C_GenerateSTART(i2c, ENABLE);
+        }
+        else
+        {
+          I2C_GenerateSTOP(i2c, ENABLE);
+          I2C_XferComplete(Engine, I2C_XFER_DONE);
+        }
+      }
+      break;
+
+    case I2C_XFER_STATE_START_RX:
+      if ((sr1 & I2C_SR1_SB) != 0)
+      {
+        Engine->State = I2C_XFER_STATE_ADDR_RX;
+        I2C_Send7bitAddress(i2c, xfer->Address, I2C_Direction_Receiver);
+      }
+      break;
+
+    case I2C_XFER_STATE_ADDR_RX:
+      if ((sr1 & I2C_SR1_ADDR) != 0)
+      {
+        if (xfer->RdLength == 1)
+        {
+          /* NACK the byte, and program the STOP as soon as ADDR is cleared,
+             before the byte is received */
+          I2C_AcknowledgeConfig(i2c, DISABLE);
+          Engine->State = I2C_XFER_STATE_RX_ONE;
+
+          /* Not even a zero-latency interrupt may delay the STOP */
+          primask = __get_PRIMASK();
+          __disable_irq();
+          (void)i2c->SR2;
+          I2C_GenerateSTOP(i2c, ENABLE);
+          __set_PRIMASK(primask);
+
+          I2C_ITConfig(i2c, I2C_IT_BUF, ENABLE);
+        }
+        else
+        {
+          /* The I2C NACKs the byte after the end of transfer of the DMA */
+          Engine->State = I2C_XFER_STATE_RX_DMA;
+          I2C_ITConfig(i2c, I2C_IT_EVT, DISABLE);
+          I2C_DMALastTransferCmd(i2c, ENABLE);
+          I2C_DMACmd(i2c, ENABLE);
+
+          Engine->RxXfer.MemoryBaseAddr = (uint32_t)xfer->pRdData;
+          Engine->RxXfer.Count = xfer->RdLength;
+          DMA_MgrSubmit(Engine->RxStream, &Engine->RxXfer);
+
+          (void)i2c->SR2;
+        }
+      }
+      break;
+
+    case I2C_XFER_STATE_RX_ONE:
+      if ((sr1 & I2C_SR1_RXNE) != 0)
+      {
+        xfer->pRdData[0] = I2C_ReceiveData(i2c);
+        I2C_XferComplete(Engine, I2C_XFER_DONE);
+      }
+      break;
+
+    default:
+      I2C_ITConfig(i2c, I2C_IT_EVT | I2C_IT_BUF, DISABLE);
+      break;
+  }
+}
+
+/**
+  * @brief  Handles the error interrupt of the I2C.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @note   This function must be called from the I2Cx_ER_IRQHandler.
+  * @retval None
+  */
+void I2C_XferErIRQHandler(I2C_XferEngineTypeDef* Engine)
+{
+  I2C_TypeDef* i2c = Engine->Init.I2Cx;
+  uint16_t sr1 = i2c->SR1;
+  uint32_t status = I2C_XFER_ERROR;
+  uint8_t recover = 0;
+
+  /* The error flags are cleared by writing 0 */
+  i2c->SR1 = (uint16_t)~(sr1 & I2C_XFER_ERROR_FLAGS);
+
+  if (Engine->Active == 0)
+  {
+    return;
+  }
+
+  if ((sr1 & I2C_SR1_BERR) != 0)
+  {
+    recover = 1;
+  }
+  else if ((sr1 & I2C_SR1_ARLO) != 0)
+  {
+    /* The I2C is back in slave mode and released the bus */
+  }
+  else if ((sr1 & I2C_SR1_AF) != 0)
+  {
+    status = I2C_XFER_NACK;
+    I2C_GenerateSTOP(i2c, ENABLE);
+  }
+  else if ((sr1 & I2C_SR1_OVR) != 0)
+  {
+    I2C_GenerateSTOP(i2c, ENABLE);
+  }
+  else
+  {
+    /* SMBus flags: not used in I2C mode */
+    return;
+  }
+
+  I2C_XferFail(Engine, status, recover);
+}
+
+/**
+  * @brief  Starts the first queued transaction.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @retval None
+  */
+static void I2C_XferStart(I2C_XferEngineTypeDef* Engine)
+{
+  I2C_TypeDef* i2c = Engine->Init.I2Cx;
+  I2C_XferTypeDef* xfer = Engine->Head;
+  uint32_t timeout = I2C_XFER_STOP_TIMEOUT;
+
+  if (xfer == 0)
+  {
+    return;
+  }
+
+  Engine->Head = xfer->Next;
+  if (Engine->Head == 0)
+  {
+    Engine->Tail = 0;
+  }
+  Engine->Active = xfer;
+  xfer->Status = I2C_XFER_ACTIVE;
+  Engine->Index = 0;
+  Engine->Ticks = xfer->Timeout;
+
+  /* The STOP of the previous transaction is sent in a few bit times */
+  while (((i2c->CR1 & I2C_CR1_STOP) != 0) && (--timeout != 0))
+  {
+  }
+
+  if ((timeout == 0) || (I2C_GetFlagStatus(i2c, I2C_FLAG_BUSY) != RESET))
+  {
+    I2C_XferRecover(Engine);
+  }
+
+  if ((xfer->RegSize != 0) || (xfer->WrLength != 0) || (xfer->RdLength == 0))
+  {
+    Engine->State = I2C_XFER_STATE_START_TX;
+  }
+  else
+  {
+    Engine->State = I2C_XFER_STATE_START_RX;
+  }
+
+  I2C_AcknowledgeConfig(i2c, ENABLE);
+  I2C_ITConfig(i2c, I2C_IT_EVT, ENABLE);
+  I2C_GenerateSTART(i2c, ENABLE);
+}
+
+/**
+  * @brief  Sends pWrData by DMA.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @note   The event interrupt is enabled again by the end of the DMA transfer,
+  *         to wait for BTF.
+  * @retval None
+  */
+static void I2C_XferStartTxDma(I2C_XferEngineTypeDef* Engine)
+{
+  I2C_TypeDef* i2c = Engine->Init.I2Cx;
+
+  Engine->State = I2C_XFER_STATE_TX_DMA;
+  I2C_ITConfig(i2c, I2C_IT_EVT, DISABLE);
+
+  Engine->TxXfer.MemoryBaseAddr = (uint32_t)Engine->Active->pWrData;
+  Engine->TxXfer.Count = Engine->Active->WrLength;
+  DMA_MgrSubmit(Engine->TxStream, &Engine->TxXfer);
+
+  I2C_DMACmd(i2c, ENABLE);
+}
+
+/**
+  * @brief  Ends the transaction in progress, starts the next one and calls the
+  *         Callback.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @param  Status: the status of the transaction.
+  * @retval None
+  */
+static void I2C_XferComplete(I2C_XferEngineTypeDef* Engine, uint32_t Status)
+{
+  I2C_TypeDef* i2c = Engine->Init.I2Cx;
+  I2C_XferTypeDef* xfer = Engine->Active;
+
+  Engine->State = I2C_XFER_STATE_IDLE;
+  Engine->Active = 0;
+  I2C_ITConfig(i2c, I2C_IT_EVT | I2C_IT_BUF, DISABLE);
+  I2C_DMACmd(i2c, DISABLE);
+  I2C_DMALastTransferCmd(i2c, DISABLE);
+
+  I2C_XferStart(Engine);
+
+  if (xfer != 0)
+  {
+    xfer->Status = Status;
+    if (xfer->Callback != 0)
+    {
+      xfer->Callback(xfer);
+    }
+  }
+}
+
+/**
+  * @brief  Ends the transaction in progress on an error.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @param  Status: the status of the transaction.
+  * @param  Recover: 1 to run the bus recovery.
+  * @retval None
+  */
+static void I2C_XferFail(I2C_XferEngineTypeDef* Engine, uint32_t Status, uint8_t Recover)
+{
+  /* The DMA callbacks of the aborted transfers return at once */
+  Engine->State = I2C_XFER_STATE_IDLE;
+  I2C_DMACmd(Engine->Init.I2Cx, DISABLE);
+  DMA_MgrAbort(Engine->RxStream);
+  DMA_MgrAbort(Engine->TxStream);
+
+  if (Recover != 0)
+  {
+    I2C_XferRecover(Engine);
+  }
+
+  I2C_XferComplete(Engine, Status);
+}
+
+/**
+  * @brief  Releases a stuck bus and resets the I2C.
+  * @param  Engine: pointer to the I2C_XferEngineTypeDef structure of the I2C.
+  * @retval None
+  */
+static void I2C_XferRecover(I2C_XferEngineTypeDef* Engine)
+{
+  I2C_XferInitTypeDef* init = &Engine->Init;
+  uint32_t count = 0;
+
+  I2C_Cmd(init->I2Cx, DISABLE);
+
+  if ((init->SCL_GPIOx != 0) && (init->SDA_GPIOx != 0))
+  {
+    GPIO_SetBits(init->SCL_GPIOx, init->SCL_Pin);
+    GPIO_SetBits(init->SDA_GPIOx, init->SDA_Pin);
+    I2C_XferPinMode(init->SCL_GPIOx, init->SCL_Pin, GPIO_Mode_OUT);
+    I2C_XferPinMode(init->SDA_GPIOx, init->SDA_Pin, GPIO_Mode_OUT);
+    I2C_XferDelay();
+
+    /* Clock out the byte the slave is sending */
+    while ((GPIO_ReadInputDataBit(init->SDA_GPIOx, init->SDA_Pin) == Bit_RESET) &&
+           (count < I2C_XFER_RECOVERY_CLOCKS))
+    {
+      GPIO_ResetBits(init->SCL_GPIOx, init->SCL_Pin);
+      I2C_XferDelay();
+      GPIO_SetBits(init->SCL_GPIOx, init->SCL_Pin);
+      I2C_XferDelay();
+      count++;
+    }
+
+    /* STOP condition: SDA rises while SCL is high */
+    GPIO_ResetBits(init->SCL_GPIOx, init->SCL_Pin);
+    I2C_XferDelay();
+    GPIO_ResetBits(init->SDA_GPIOx, init->SDA_Pin);
+    I2C_XferDelay();
+    GPIO_SetBits(init->SCL_GPIOx, init->SCL_Pin);
+    I2C_XferDelay();
+    GPIO_SetBits(init->SDA_GPIOx, init->SDA_Pin);
+    I2C_XferDelay();
+
+    I2C_XferPinMode(init->SCL_GPIOx, init->SCL_Pin, GPIO_Mode_AF);
+    I2C_XferPinMode(init->SDA_GPIOx, init->SDA_Pin, GPIO_Mode_AF);
+  }
+
+  /* The reset clears BUSY and the state of the I2C, and its configuration */
+  I2C_SoftwareResetCmd(init->I2Cx, ENABLE);
+  I2C_SoftwareResetCmd(init->I2Cx, DISABLE);
+  I2C_Init(init->I2Cx, &init->I2C_InitStruct);
+  I2C_ITConfig(init->I2Cx, I2C_IT_ERR, ENABLE);
+
+  Engine->Recoveries++;
+}
+
+/**
+  * @brief  Changes the mode of GPIO pins, keeping their output type and pull.
+  * @param  GPIOx: where x can be (A..I) to select the GPIO peripheral.
+  * @param  GPIO_Pin: the pins.
+  * @param  GPIO_Mode: GPIO_Mode_OUT or GPIO_Mode_AF.
+  * @retval None
+  */
+static void I2C_XferPinMode(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIOMode_TypeDef GPIO_Mode)
+{
+  uint32_t pinpos = 0;
+
+  for (pinpos = 0; pinpos < 16; pinpos++)
+  {
+    if ((GPIO_Pin & (1 << pinpos)) != 0)
+    {
+      GPIOx->MODER = (GPIOx->MODER & ~(GPIO_MODER_MODER0 << (pinpos * 2))) |
+                     ((uint32_t)GPIO_Mode << (pinpos * 2));
+    }
+  }
+}
+
+/**
+  * @brief  Waits for half a period of a 100 kHz clock.
+  * @param  None
+  * @retval None
+  */
+static void I2C_XferDelay(void)
+{
+  __IO uint32_t count = SystemCoreClock / 1000000 * 5 / 4;
+
+  while (count != 0)
+  {
+    count--;
+  }
+}
+
+/**
+  * @brief  Callback of the RX DMA transfer: ends the reception with a STOP.
+  * @param  Xfer: the RX DMA transfer.
+  * @retval None
+  */
+static void I2C_XferRxDone(DMA_MgrXferTypeDef* Xfer)
+{
+  I2C_XferEngineTypeDef* engine = (I2C_XferEngineTypeDef*)Xfer->Context;
+
+  if (engine->State != I2C_XFER_STATE_RX_DMA)
+  {
+    return;
+  }
+
+  if (Xfer->Status == DMA_MGR_XFER_DONE)
+  {
+    I2C_GenerateSTOP(engine->Init.I2Cx, ENABLE);
+    I2C_XferComplete(engine, I2C_XFER_DONE);
+  }
+  else
+  {
+    I2C_GenerateSTOP(engine->Init.I2Cx, ENABLE);
+    I2C_XferFail(engine, I2C_XFER_ERROR, 0);
+  }
+}
+
+/**
+  * @brief  Callback of the TX DMA transfer: waits for the last byte sent.
+  * @param  Xfer: the TX DMA transfer.
+  * @retval None
+  */
+static void I2C_XferTxDone(DMA_MgrXferTypeDef* Xfer)
+{
+  I2C_XferEngineTypeDef* engine = (I2C_XferEngineTypeDef*)Xfer->Context;
+
+  if (engine->State != I2C_XFER_STATE_TX_DMA)
+  {
+    return;
+  }
+
+  if (Xfer->Status == DMA_MGR_XFER_DONE)
+  {
+    I2C_DMACmd(engine->Init.I2Cx, DISABLE);
+    engine->State = I2C_XFER_STATE_TX_BTF;
+    I2C_ITConfig(engine->Init.I2Cx, I2C_IT_EVT, ENABLE);
+  }
+  else
+  {
+    I2C_GenerateSTOP(engine->Init.I2Cx, ENABLE);
+    I2C_XferFail(engine, I2C_XFER_ERROR, 0);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
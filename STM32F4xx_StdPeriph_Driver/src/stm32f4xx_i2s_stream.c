@@ -0,0 +1,416 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_i2s_stream.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a full duplex streaming layer for the I2S, to
+  *          process audio blocks without CPU per sample:
+  *           - PLLI2S configuration for the standard audio frequencies
+  *           - I2S2 or I2S3 with its extension in full duplex
+  *           - Double buffering by DMA of the input and output, in lock-step
+  *           - One processing callback per pair of input and output blocks
+  *          It uses the stm32f4xx_spi.c/.h, stm32f4xx_rcc.c/.h and
+  *          stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Call I2S_StreamClockConfig() with the audio frequency, enable
+  *             the SPI, GPIO and DMA1 clocks, configure the CK, WS, SD, extSD
+  *             (and MCK) pins in alternate function and call DMA_MgrInit().
+  *
+  *          2. Call I2S_StreamInit() with a I2S_StreamTypeDef structure, and
+  *             call DMA_MgrIRQHandler() from the interrupt handlers of the two
+  *             DMA streams, set to the same priority:
+  *               - SPI2 transmitter: DMA1 Stream4 and Stream3
+  *               - SPI2 receiver: DMA1 Stream3 and Stream4
+  *               - SPI3 transmitter: DMA1 Stream5 (or Stream7) and Stream0
+  *               - SPI3 receiver: DMA1 Stream0 (or Stream2) and Stream5
+  *             in the default table.
+  *
+  *          3. Start the stream with I2S_StreamStart(). The Process callback
+  *             reads each input block and writes the output block of the same
+  *             index, for example through the filters of the CMSIS DSP
+  *             library.
+  *
+  *          4. Stop the stream with I2S_StreamStop(), and release the DMA
+  *             streams with I2S_StreamDeInit().
+  *
+  * @note   The Process callback has the time of one block to run:
+  *         BlockSize / (2 * AudioFreq) seconds for 16-bit stereo data. The
+  *         latency from the input to the output is two blocks.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_i2s_stream.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup SPI
+  * @brief SPI driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define I2S_STREAM_TIMEOUT        ((uint32_t)0x00010000)
+
+/* Bits of I2S_StreamTypeDef.Done */
+#define I2S_STREAM_TX_DONE        ((uint8_t)0x01)
+#define I2S_STREAM_RX_DONE        ((uint8_t)0x02)
+
+#define I2S_STREAM_CLOCKS         (sizeof(I2S_StreamClockTable) / sizeof(I2S_StreamClockTable[0]))
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* PLLI2SN and PLLI2SR of each audio frequency, for a 1 MHz PLL input: the I2S
+   clock is a multiple of 256 x AudioFreq within 0.02 %, with or without the
+   master clock output */
+static const uint32_t I2S_StreamClockTable[][3] =
+{
+  {I2S_AudioFreq_8k,  256, 5},
+  {I2S_AudioFreq_11k, 429, 4},
+  {I2S_AudioFreq_16k, 213, 2},
+  {I2S_AudioFreq_22k, 429, 4},
+  {I2S_AudioFreq_32k, 213, 2},
+  {I2S_AudioFreq_44k, 271, 6},
+  {I2S_AudioFreq_48k, 258, 3},
+  {I2S_AudioFreq_96k, 344, 2}
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void I2S_StreamBlockDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup SPI_Private_Functions
+  * @{
+  */
+
+/** @defgroup SPI_Group7 I2S streaming functions
+ *  @brief   I2S streaming functions
+ *
+@verbatim
+ ===============================================================================
+                         I2S streaming functions
+ ===============================================================================
+
+  This subsection provides functions allowing to receive and send continuous
+  audio streams on I2S2 or I2S3 in full duplex, and to process them by blocks.
+
+  SPIx runs in the direction given by the I2S configuration, and its extension
+  I2Sxext runs in the other direction, as a slave sharing the CK and WS
+  signals: the input and the output data are clocked together.
+
+  The two DMA streams run in the streaming mode of the DMA manager, on the two
+  blocks of TxBuffer and of RxBuffer. Both start on block 0 and move to block 1
+  on the same audio frame. Once block n has been received and block n of the
+  output sent, the Process callback reads the input block n and writes the
+  output block n, and both blocks are queued again.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Configures the PLLI2S for an audio frequency, and selects it as
+  *         the I2S clock.
+  * @note   The PLL input (HSE or HSI divided by PLLM) must be 1 MHz. The
+  *         PLLI2S is stopped during the configuration: the I2S must be
+  *         disabled.
+  * @param  AudioFreq: the audio frequency, a value of @ref I2S_Audio_Frequency
+  *         except I2S_AudioFreq_192k and I2S_AudioFreq_Default.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the PLLI2S is locked
+  *          - ERROR: not supported frequency, or the PLLI2S did not lock
+  */
+ErrorStatus I2S_StreamClockConfig(uint32_t AudioFreq)
+{
+  uint32_t index = 0, timeout = 0;
+
+  for (index = 0; (index < I2S_STREAM_CLOCKS) && (I2S_StreamClockTable[index][0] != AudioFreq); index++)
+  {
+  }
+  if (index == I2S_STREAM_CLOCKS)
+  {
+    return ERROR;
+  }
+
+  RCC_PLLI2SCmd(DISABLE);
+  RCC_I2SCLKConfig(RCC_I2S2CLKSource_PLLI2S);
+  RCC_PLLI2SConfig(I2S_StreamClockTable[index][1], I2S_StreamClockTable[index][2]);
+  RCC_PLLI2SCmd(ENABLE);
+
+  for (; (RCC_GetFlagStatus(RCC_FLAG_PLLI2SRDY) == RESET) && (timeout < I2S_STREAM_TIMEOUT); timeout++)
+  {
+  }
+  if (timeout == I2S_STREAM_TIMEOUT)
+  {
+    return ERROR;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Initializes an I2S stream: configures SPIx and its extension in
+  *         full duplex, and the DMA. The output blocks are cleared.
+  * @param  Stream: pointer to the I2S_StreamTypeDef structure of the stream.
+  * @param  I2S_StreamInitStruct: pointer to a I2S_StreamInitTypeDef structure
+  *         that contains the configuration of the stream.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the stream is ready to start
+  *          - ERROR: invalid configuration or no free DMA stream
+  */
+ErrorStatus I2S_StreamInit(I2S_StreamTypeDef* Stream, const I2S_StreamInitTypeDef* I2S_StreamInitStruct)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  I2S_InitTypeDef I2S_InitStructure = I2S_StreamInitStruct->I2S;
+  SPI_TypeDef* spi = I2S_StreamInitStruct->SPIx;
+  SPI_TypeDef* ext = (spi == SPI2) ? I2S2ext : I2S3ext;
+  uint32_t size = I2S_StreamInitStruct->BlockSize;
+  uint32_t txreq = 0, rxreq = 0, index = 0, n = 0;
+  uint8_t tx = 0;
+
+  /* Check the parameters */
+  assert_param(IS_I2S_MODE(I2S_InitStructure.I2S_Mode));
+
+  if (((spi != SPI2) && (spi != SPI3)) || (I2S_StreamInitStruct->TxBuffer == 0) ||
+      (I2S_StreamInitStruct->RxBuffer == 0) || (I2S_StreamInitStruct->Process == 0) ||
+      (size == 0) || ((size & 0x1) != 0))
+  {
+    return ERROR;
+  }
+
+  Stream->Init = *I2S_StreamInitStruct;
+  Stream->I2Sxext = ext;
+  Stream->Done[0] = 0;
+  Stream->Done[1] = 0;
+  Stream->Overruns = 0;
+
+  /* SPIx transmits in the I2S_Mode_SlaveTx and I2S_Mode_MasterTx modes */
+  tx = (uint8_t)((I2S_InitStructure.I2S_Mode & I2S_Mode_SlaveRx) == 0);
+  if (spi == SPI2)
+  {
+    txreq = (tx != 0) ? DMA_MGR_REQ_SPI2_TX : DMA_MGR_REQ_I2S2EXT_TX;
+    rxreq = (tx != 0) ? DMA_MGR_REQ_I2S2EXT_RX : DMA_MGR_REQ_SPI2_RX;
+  }
+  else
+  {
+    txreq = (tx != 0) ? DMA_MGR_REQ_SPI3_TX : DMA_MGR_REQ_I2S3EXT_TX;
+    rxreq = (tx != 0) ? DMA_MGR_REQ_I2S3EXT_RX : DMA_MGR_REQ_SPI3_RX;
+  }
+
+  I2S_Cmd(spi, DISABLE);
+  I2S_Cmd(ext, DISABLE);
+  I2S_Init(spi, &I2S_InitStructure);
+  I2S_FullDuplexConfig(ext, &I2S_InitStructure);
+
+  /* DMA: streaming mode on the two blocks of each buffer */
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_BufferSize = size;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&((tx != 0) ? spi : ext)->DR;
+  Stream->TxStream = DMA_MgrAlloc(txreq, &DMA_InitStructure);
+  if (Stream->TxStream == 0)
+  {
+    return ERROR;
+  }
+
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&((tx != 0) ? ext : spi)->DR;
+  Stream->RxStream = DMA_MgrAlloc(rxreq, &DMA_InitStructure);
+  if (Stream->RxStream == 0)
+  {
+    DMA_MgrFree(Stream->TxStream);
+    Stream->TxStream = 0;
+    return ERROR;
+  }
+
+  for (index = 0; index < 2; index++)
+  {
+    for (n = 0; n < size; n++)
+    {
+      I2S_StreamInitStruct->TxBuffer[(index * size) + n] = 0;
+    }
+
+    Stream->TxXfer[index].MemoryBaseAddr = (uint32_t)(I2S_StreamInitStruct->TxBuffer + (index * size));
+    Stream->TxXfer[index].Count = (uint16_t)size;
+    Stream->TxXfer[index].Callback = I2S_StreamBlockDone;
+    Stream->TxXfer[index].Context = Stream;
+    DMA_MgrSubmit(Stream->TxStream, &Stream->TxXfer[index]);
+
+    Stream->RxXfer[index].MemoryBaseAddr = (uint32_t)(I2S_StreamInitStruct->RxBuffer + (index * size));
+    Stream->RxXfer[index].Count = (uint16_t)size;
+    Stream->RxXfer[index].Callback = I2S_StreamBlockDone;
+    Stream->RxXfer[index].Context = Stream;
+    DMA_MgrSubmit(Stream->RxStream, &Stream->RxXfer[index]);
+  }
+
+  SPI_I2S_DMACmd((tx != 0) ? spi : ext, SPI_I2S_DMAReq_Tx, ENABLE);
+  SPI_I2S_DMACmd((tx != 0) ? ext : spi, SPI_I2S_DMAReq_Rx, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops an I2S stream and releases its DMA streams.
+  * @param  Stream: pointer to the I2S_StreamTypeDef structure of the stream.
+  * @retval None
+  */
+void I2S_StreamDeInit(I2S_StreamTypeDef* Stream)
+{
+  I2S_StreamStop(Stream);
+  SPI_I2S_DMACmd(Stream->Init.SPIx, SPI_I2S_DMAReq_Tx | SPI_I2S_DMAReq_Rx, DISABLE);
+  SPI_I2S_DMACmd(Stream->I2Sxext, SPI_I2S_DMAReq_Tx | SPI_I2S_DMAReq_Rx, DISABLE);
+  DMA_MgrFree(Stream->TxStream);
+  DMA_MgrFree(Stream->RxStream);
+  Stream->TxStream = 0;
+  Stream->RxStream = 0;
+}
+
+/**
+  * @brief  Starts an I2S stream.
+  * @param  Stream: pointer to the I2S_StreamTypeDef structure of the stream.
+  * @retval None
+  */
+void I2S_StreamStart(I2S_StreamTypeDef* Stream)
+{
+  /* The slave extension is enabled before SPIx, which may be the master */
+  I2S_Cmd(Stream->I2Sxext, ENABLE);
+  I2S_Cmd(Stream->Init.SPIx, ENABLE);
+}
+
+/**
+  * @brief  Stops an I2S stream.
+  * @param  Stream: pointer to the I2S_StreamTypeDef structure of the stream.
+  * @note   The DMA streams keep their position: I2S_StreamStart() goes on
+  *         with the next data.
+  * @retval None
+  */
+void I2S_StreamStop(I2S_StreamTypeDef* Stream)
+{
+  I2S_Cmd(Stream->Init.SPIx, DISABLE);
+  I2S_Cmd(Stream->I2Sxext, DISABLE);
+}
+
+/**
+  * @brief  Processes a pair of blocks once both directions are done with
+  *         them, and queues them again.
+  * @param  Xfer: the DMA transfer of the block.
+  * @retval None
+  */
+static void I2S_StreamBlockDone(DMA_MgrXferTypeDef* Xfer)
+{
+  I2S_StreamTypeDef* stream = (I2S_StreamTypeDef*)Xfer->Context;
+  SPI_TypeDef* txp = 0;
+  SPI_TypeDef* rxp = 0;
+  uint32_t index = 0;
+
+  if (Xfer->Status != DMA_MGR_XFER_DONE)
+  {
+    return;
+  }
+
+  if ((Xfer == &stream->TxXfer[0]) || (Xfer == &stream->TxXfer[1]))
+  {
+    index = (uint32_t)(Xfer - stream->TxXfer);
+    stream->Done[index] |= I2S_STREAM_TX_DONE;
+  }
+  else
+  {
+    index = (uint32_t)(Xfer - stream->RxXfer);
+    stream->Done[index] |= I2S_STREAM_RX_DONE;
+  }
+
+  if (stream->Done[index] != (I2S_STREAM_TX_DONE | I2S_STREAM_RX_DONE))
+  {
+    return;
+  }
+  stream->Done[index] = 0;
+
+  /* The DMA manager stops a stream when the other block was not queued */
+  if ((DMA_GetCmdStatus(stream->TxStream) == DISABLE) || (DMA_GetCmdStatus(stream->RxStream) == DISABLE))
+  {
+    stream->Overruns++;
+  }
+
+  if ((stream->Init.I2S.I2S_Mode & I2S_Mode_SlaveRx) == 0)
+  {
+    txp = stream->Init.SPIx;
+    rxp = stream->I2Sxext;
+  }
+  else
+  {
+    txp = stream->I2Sxext;
+    rxp = stream->Init.SPIx;
+  }
+  /* Reading SR clears UDR; OVR is cleared by reading DR then SR */
+  if (SPI_I2S_GetFlagStatus(txp, I2S_FLAG_UDR) != RESET)
+  {
+    stream->Overruns++;
+  }
+  if (SPI_I2S_GetFlagStatus(rxp, SPI_I2S_FLAG_OVR) != RESET)
+  {
+    stream->Overruns++;
+    (void)SPI_I2S_ReceiveData(rxp);
+    (void)SPI_I2S_GetFlagStatus(rxp, SPI_I2S_FLAG_OVR);
+  }
+
+  stream->Init.Process(stream, (const uint16_t*)stream->RxXfer[index].MemoryBaseAddr,
+                       (uint16_t*)stream->TxXfer[index].MemoryBaseAddr, stream->Init.BlockSize);
+
+  DMA_MgrSubmit(stream->TxStream, &stream->TxXfer[index]);
+  DMA_MgrSubmit(stream->RxStream, &stream->RxXfer[index]);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
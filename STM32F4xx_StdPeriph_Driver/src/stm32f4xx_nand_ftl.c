@@ -0,0 +1,1292 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_nand_ftl.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a flash translation layer for the 8-bit large
+  *          page NAND memories on the FSMC NAND banks:
+  *           - Page-level logical to physical mapping, held in RAM and
+  *             rebuilt from the spare areas at mount
+  *           - Single bit error correction per 512 bytes from the syndrome
+  *             of the FSMC hardware ECC
+  *           - Factory and grown bad block management
+  *           - Garbage collection in the writes and in the idle time, and
+  *             static wear levelling
+  *           - Block device interface with 512-byte sectors, for the USB
+  *             mass storage class and FatFs
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the FSMC clock, configure the NAND pins in alternate
+  *             function FSMC mode, and configure the bank with
+  *             FSMC_NANDInit(): 8-bit data, ECC disabled, and the timings
+  *             of the memory. The FTL sets the ECC page size to 512 bytes.
+  *
+  *          2. Give the RAM of the FTL in a NAND_FTL_InitTypeDef structure,
+  *             after NAND_FTL_StructInit(), for example for a 1 Gbit memory
+  *             with 1024 blocks of 64 pages of 2048 + 64 bytes:
+  *               #define PAGES NAND_FTL_PAGES(1024, 32, 64)
+  *               uint16_t Map[PAGES];
+  *               NAND_FTL_BlockTypeDef Blocks[1024];
+  *               uint32_t Cache[2048 / 4], Copy[2048 / 4];
+  *               Init.BlockCount = 1024;  Init.ReserveBlocks = 32;
+  *               Init.Map = Map;  Init.Blocks = Blocks;
+  *               Init.PageBuffer = (uint8_t*)Cache;  Init.CopyBuffer = (uint8_t*)Copy;
+  *             and call NAND_FTL_Init().
+  *
+  *          3. Call NAND_FTL_Mount() at each start: it reads the spare area
+  *             of the programmed pages to rebuild the map. Call
+  *             NAND_FTL_Format() once on a new memory, or when the mount
+  *             fails: it erases all the good blocks.
+  *
+  *          4. Read and write the sectors with NAND_FTL_Read() and
+  *             NAND_FTL_Write(). The last partial page written is kept in
+  *             the write cache: call NAND_FTL_Flush() before a power down.
+  *
+  *          5. Call NAND_FTL_Idle() from the idle loop or a low priority
+  *             task: it collects one block at a time when the free blocks
+  *             run low, so that the writes seldom wait for a collection.
+  *
+  *          6. USB device: define MSC_NAND_ENABLED and build
+  *             usbd_storage_nand.c with the mass storage class.
+  *
+  *          7. FatFs: call the FTL from the diskio.c of the application:
+  *               disk_read()  -> NAND_FTL_Read(&Ftl, buff, sector, count)
+  *               disk_write() -> NAND_FTL_Write(&Ftl, buff, sector, count)
+  *               CTRL_SYNC -> NAND_FTL_Flush(),
+  *               GET_SECTOR_COUNT -> NAND_FTL_GetSectorCount(),
+  *               GET_BLOCK_SIZE -> NAND_FTL_GetEraseSectors()
+  *             and return RES_ERROR when they return ERROR.
+  *
+  * @note   The FTL functions are not reentrant: call them from one task,
+  *         or under a mutex. The FSMC NAND bank is not used by interrupts.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_nand_ftl.h"
+#include <string.h>
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup FSMC
+  * @brief FSMC driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* NAND commands */
+#define NAND_FTL_CMD_READ0        ((uint8_t)0x00)
+#define NAND_FTL_CMD_READ1        ((uint8_t)0x30)
+#define NAND_FTL_CMD_RNDOUT0      ((uint8_t)0x05)
+#define NAND_FTL_CMD_RNDOUT1      ((uint8_t)0xE0)
+#define NAND_FTL_CMD_PROGRAM0     ((uint8_t)0x80)
+#define NAND_FTL_CMD_PROGRAM1     ((uint8_t)0x10)
+#define NAND_FTL_CMD_ERASE0       ((uint8_t)0x60)
+#define NAND_FTL_CMD_ERASE1       ((uint8_t)0xD0)
+#define NAND_FTL_CMD_STATUS       ((uint8_t)0x70)
+
+/* Status register bits */
+#define NAND_FTL_STATUS_FAIL      ((uint8_t)0x01)
+#define NAND_FTL_STATUS_READY     ((uint8_t)0x40)
+
+/* Status polls before a time out */
+#define NAND_FTL_TIMEOUT          ((uint32_t)0x00100000)
+
+/* Spare area: bad block marker, check word, logical page, sequence number
+   and erase count of the block, then 3 ECC bytes per 512-byte step */
+#define NAND_FTL_SPARE_BAD        0
+#define NAND_FTL_SPARE_CHECK      2
+#define NAND_FTL_SPARE_PAGE       4
+#define NAND_FTL_SPARE_SEQ        8
+#define NAND_FTL_SPARE_ERASE      12
+#define NAND_FTL_SPARE_MAX        NAND_FTL_SPARE_MIN(8192)
+#define NAND_FTL_STEPS_MAX        (8192 / 512)
+
+/* 24-bit ECC of 512 bytes: a single bit error flips one bit of each of the
+   12 parity pairs, the odd bits giving the bit position */
+#define NAND_FTL_ECC_MASK         ((uint32_t)0x00FFFFFF)
+#define NAND_FTL_ECC_PAIRS        ((uint32_t)0x00555555)
+#define NAND_FTL_ECC_PS_MASK      ((uint32_t)0x000E0000)
+
+/* Block states */
+#define NAND_FTL_FREE             ((uint8_t)0)   /* erased */
+#define NAND_FTL_ACTIVE           ((uint8_t)1)   /* being programmed */
+#define NAND_FTL_FULL             ((uint8_t)2)   /* programmed, may hold stale pages */
+#define NAND_FTL_BAD              ((uint8_t)3)
+
+#define NAND_FTL_NO_BLOCK         ((uint32_t)0xFFFFFFFF)
+#define NAND_FTL_NO_LPN           ((uint32_t)0xFFFFFFFF)
+
+/* Read results */
+#define NAND_FTL_READ_OK          0
+#define NAND_FTL_READ_CORRECTED   1
+#define NAND_FTL_READ_FAILED      2
+
+/* Private macro -------------------------------------------------------------*/
+#define NAND_FTL_DATA(FTL)        (*(__IO uint8_t *)((FTL)->Base))
+#define NAND_FTL_CMD(FTL)         (*(__IO uint8_t *)((FTL)->Base | NAND_FTL_CMD_AREA))
+#define NAND_FTL_ADDR(FTL)        (*(__IO uint8_t *)((FTL)->Base | NAND_FTL_ADDR_AREA))
+
+/* Row address of a page: the blocks are numbered from FirstBlock */
+#define NAND_FTL_ROW(FTL, PPN)    (((FTL)->Init.FirstBlock * (FTL)->Init.PagesPerBlock) + (PPN))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void NAND_FTL_Address(NAND_FTL_TypeDef* Ftl, uint32_t Column, uint32_t Row);
+static uint8_t NAND_FTL_WaitReady(NAND_FTL_TypeDef* Ftl);
+static void NAND_FTL_ReadSpare(NAND_FTL_TypeDef* Ftl, uint32_t Row, uint8_t* Spare, uint32_t Length);
+static uint32_t NAND_FTL_ReadData(NAND_FTL_TypeDef* Ftl, uint32_t Ppn, uint32_t Step,
+                                  uint32_t Steps, uint8_t* Buffer);
+static uint32_t NAND_FTL_Correct(uint8_t* Data, uint32_t Stored, uint32_t Computed);
+static ErrorStatus NAND_FTL_Program(NAND_FTL_TypeDef* Ftl, uint32_t Ppn, uint32_t Lpn, const uint8_t* Data);
+static ErrorStatus NAND_FTL_Erase(NAND_FTL_TypeDef* Ftl, uint32_t Block);
+static void NAND_FTL_MarkBad(NAND_FTL_TypeDef* Ftl, uint32_t Block);
+static uint32_t NAND_FTL_GetMeta(NAND_FTL_TypeDef* Ftl, uint32_t Ppn, uint32_t* Seq, uint32_t* Erase);
+static uint32_t NAND_FTL_NewBlock(NAND_FTL_TypeDef* Ftl, uint32_t Worn);
+static ErrorStatus NAND_FTL_PutPage(NAND_FTL_TypeDef* Ftl, uint32_t Lpn, const uint8_t* Data, uint32_t Worn);
+static uint32_t NAND_FTL_Victim(NAND_FTL_TypeDef* Ftl);
+static ErrorStatus NAND_FTL_Collect(NAND_FTL_TypeDef* Ftl, uint32_t Block, uint32_t Worn);
+static uint32_t NAND_FTL_Get32(const uint8_t* Buffer);
+static void NAND_FTL_Put32(uint8_t* Buffer, uint32_t Value);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup FSMC_Private_Functions
+  * @{
+  */
+
+/** @defgroup FSMC_Group7 NAND FTL initialization and mount functions
+ *  @brief   NAND FTL initialization and mount functions
+ *
+@verbatim
+ ===============================================================================
+                 NAND FTL initialization and mount functions
+ ===============================================================================
+
+  Each programmed page holds in its spare area the logical page it stores,
+  a sequence number incremented at each program, and the erase count of its
+  block. The mount reads the spare area of the programmed pages: the copy of
+  a logical page with the highest sequence number is the current one, so a
+  power loss during a write or a garbage collection leaves either the old
+  or the new copy. The free blocks are always erased, and the pages of a
+  block are programmed in order from the page 0.
+
+  The blocks marked bad by the manufacturer have a byte other than 0xFF at
+  the offset 0 of the spare area of their page 0 or 1. The FTL marks the
+  blocks failing a program or an erase the same way, after moving their data.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Fills each NAND_FTL_InitTypeDef member with its default value:
+  *         a 1 Gbit memory with 1024 blocks of 64 pages of 2048 + 64 bytes
+  *         on the FSMC bank 2. The RAM pointers are cleared.
+  * @param  Init: pointer to a NAND_FTL_InitTypeDef structure
+  * @retval None
+  */
+void NAND_FTL_StructInit(NAND_FTL_InitTypeDef* Init)
+{
+  Init->Bank = FSMC_Bank2_NAND;
+  Init->PageSize = 2048;
+  Init->SpareSize = 64;
+  Init->PagesPerBlock = 64;
+  Init->RowCycles = 2;
+  Init->FirstBlock = 0;
+  Init->BlockCount = 1024;
+  Init->ReserveBlocks = 32;
+  Init->Map = 0;
+  Init->Blocks = 0;
+  Init->PageBuffer = 0;
+  Init->CopyBuffer = 0;
+}
+
+/**
+  * @brief  Initializes a NAND FTL instance and sets the ECC page size of
+  *         the FSMC bank to 512 bytes. The memory is not accessed.
+  * @param  Ftl: NAND FTL instance
+  * @param  Init: geometry and RAM of the FTL
+  * @retval SUCCESS, or ERROR if the geometry is not supported
+  */
+ErrorStatus NAND_FTL_Init(NAND_FTL_TypeDef* Ftl, const NAND_FTL_InitTypeDef* Init)
+{
+  /* Check the parameters */
+  assert_param(IS_FSMC_NAND_BANK(Init->Bank));
+  assert_param(IS_NAND_FTL_PAGE_SIZE(Init->PageSize));
+  assert_param(IS_NAND_FTL_ROW_CYCLES(Init->RowCycles));
+
+  memset(Ftl, 0, sizeof(*Ftl));
+  Ftl->Active = NAND_FTL_NO_BLOCK;
+  Ftl->CachePage = NAND_FTL_NO_LPN;
+
+  if ((Init->SpareSize < NAND_FTL_SPARE_MIN(Init->PageSize)) ||
+      (Init->PagesPerBlock == 0) || (Init->PagesPerBlock > 256) ||
+      (Init->ReserveBlocks < 2) || (Init->BlockCount <= Init->ReserveBlocks) ||
+      ((Init->BlockCount * Init->PagesPerBlock) > NAND_FTL_NO_PAGE) ||
+      (Init->Map == 0) || (Init->Blocks == 0) ||
+      (Init->PageBuffer == 0) || (Init->CopyBuffer == 0))
+  {
+    return ERROR;
+  }
+
+  Ftl->Init = *Init;
+  Ftl->Pages = NAND_FTL_PAGES(Init->BlockCount, Init->ReserveBlocks, Init->PagesPerBlock);
+
+  if (Init->Bank == FSMC_Bank2_NAND)
+  {
+    Ftl->Base = (uint32_t)0x70000000;
+    FSMC_Bank2->PCR2 = (FSMC_Bank2->PCR2 & ~NAND_FTL_ECC_PS_MASK) | FSMC_ECCPageSize_512Bytes;
+  }
+  else
+  {
+    Ftl->Base = (uint32_t)0x80000000;
+    FSMC_Bank3->PCR3 = (FSMC_Bank3->PCR3 & ~NAND_FTL_ECC_PS_MASK) | FSMC_ECCPageSize_512Bytes;
+  }
+  FSMC_NANDECCCmd(Init->Bank, DISABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Rebuilds the page map and the block table from the memory.
+  * @param  Ftl: NAND FTL instance
+  * @retval SUCCESS, or ERROR if the FTL has no free block: format the memory
+  */
+ErrorStatus NAND_FTL_Mount(NAND_FTL_TypeDef* Ftl)
+{
+  NAND_FTL_BlockTypeDef* blk;
+  uint32_t ppb = Ftl->Init.PagesPerBlock;
+  uint32_t b, p, lpn, seq, erase, old, oldseq;
+  uint32_t maxseq = 0, sum = 0, known = 0;
+  uint8_t spare[2];
+
+  Ftl->Mounted = 0;
+  Ftl->Active = NAND_FTL_NO_BLOCK;
+  Ftl->CachePage = NAND_FTL_NO_LPN;
+  Ftl->CacheDirty = 0;
+  memset(&Ftl->Stat, 0, sizeof(Ftl->Stat));
+  memset(Ftl->Init.Map, 0xFF, Ftl->Pages * sizeof(uint16_t));
+
+  for (b = 0; b < Ftl->Init.BlockCount; b++)
+  {
+    blk = &Ftl->Init.Blocks[b];
+    memset(blk, 0, sizeof(*blk));
+
+    /* The FTL programs 0xFF at the offset of the bad block marker */
+    NAND_FTL_ReadSpare(Ftl, NAND_FTL_ROW(Ftl, b * ppb), &spare[0], 1);
+    NAND_FTL_ReadSpare(Ftl, NAND_FTL_ROW(Ftl, (b * ppb) + 1), &spare[1], 1);
+    if ((spare[0] != 0xFF) || (spare[1] != 0xFF))
+    {
+      blk->State = NAND_FTL_BAD;
+      Ftl->Stat.BadBlocks++;
+      continue;
+    }
+
+    blk->EraseCount = 0xFFFF;
+    for (p = 0; p < ppb; p++)
+    {
+      lpn = NAND_FTL_GetMeta(Ftl, (b * ppb) + p, &seq, &erase);
+      if (seq == NAND_FTL_NO_LPN)
+      {
+        /* Erased page: the next pages are erased too */
+        break;
+      }
+      blk->Used = (uint16_t)(p + 1);
+      if (lpn == NAND_FTL_NO_LPN)
+      {
+        /* Page programmed partly, or with a corrupted spare area */
+        continue;
+      }
+      blk->EraseCount = (uint16_t)erase;
+      if (seq >= maxseq)
+      {
+        maxseq = seq + 1;
+      }
+      if (lpn < Ftl->Pages)
+      {
+        old = Ftl->Init.Map[lpn];
+        if ((old == NAND_FTL_NO_PAGE) ||
+            ((NAND_FTL_GetMeta(Ftl, old, &oldseq, &erase) == lpn) && (oldseq < seq)))
+        {
+          Ftl->Init.Map[lpn] = (uint16_t)((b * ppb) + p);
+        }
+      }
+    }
+
+    if (blk->Used == 0)
+    {
+      blk->State = NAND_FTL_FREE;
+      Ftl->Stat.FreeBlocks++;
+    }
+    else
+    {
+      blk->State = NAND_FTL_FULL;
+    }
+    if (blk->EraseCount != 0xFFFF)
+    {
+      sum += blk->EraseCount;
+      known++;
+    }
+  }
+
+  /* The erase count of the erased blocks is lost: take the mean */
+  for (b = 0; b < Ftl->Init.BlockCount; b++)
+  {
+    blk = &Ftl->Init.Blocks[b];
+    if ((blk->State != NAND_FTL_BAD) && (blk->EraseCount == 0xFFFF))
+    {
+      blk->EraseCount = (uint16_t)((known != 0) ? (sum / known) : 0);
+    }
+  }
+
+  for (lpn = 0; lpn < Ftl->Pages; lpn++)
+  {
+    if (Ftl->Init.Map[lpn] != NAND_FTL_NO_PAGE)
+    {
+      Ftl->Init.Blocks[Ftl->Init.Map[lpn] / ppb].Valid++;
+    }
+  }
+
+  Ftl->Sequence = maxseq;
+  if (Ftl->Stat.FreeBlocks == 0)
+  {
+    return ERROR;
+  }
+  Ftl->Mounted = 1;
+  return SUCCESS;
+}
+
+/**
+  * @brief  Erases all the good blocks: the content of the memory is lost.
+  * @param  Ftl: NAND FTL instance
+  * @retval SUCCESS, or ERROR if less than ReserveBlocks good blocks are left
+  */
+ErrorStatus NAND_FTL_Format(NAND_FTL_TypeDef* Ftl)
+{
+  NAND_FTL_BlockTypeDef* blk;
+  uint32_t ppb = Ftl->Init.PagesPerBlock;
+  uint32_t b, seq, erase;
+  uint8_t spare[2];
+
+  Ftl->Mounted = 0;
+  Ftl->Active = NAND_FTL_NO_BLOCK;
+  Ftl->CachePage = NAND_FTL_NO_LPN;
+  Ftl->CacheDirty = 0;
+  Ftl->Sequence = 0;
+  memset(&Ftl->Stat, 0, sizeof(Ftl->Stat));
+  memset(Ftl->Init.Map, 0xFF, Ftl->Pages * sizeof(uint16_t));
+
+  for (b = 0; b < Ftl->Init.BlockCount; b++)
+  {
+    blk = &Ftl->Init.Blocks[b];
+    memset(blk, 0, sizeof(*blk));
+
+    /* Keep the bad block markers, and the erase count of the FTL blocks */
+    NAND_FTL_ReadSpare(Ftl, NAND_FTL_ROW(Ftl, b * ppb), &spare[0], 1);
+    NAND_FTL_ReadSpare(Ftl, NAND_FTL_ROW(Ftl, (b * ppb) + 1), &spare[1], 1);
+    if ((spare[0] != 0xFF) || (spare[1] != 0xFF))
+    {
+      blk->State = NAND_FTL_BAD;
+    }
+    else if (NAND_FTL_GetMeta(Ftl, b * ppb, &seq, &erase) != NAND_FTL_NO_LPN)
+    {
+      blk->EraseCount = (uint16_t)erase;
+    }
+    if (blk->State == NAND_FTL_BAD)
+    {
+      Ftl->Stat.BadBlocks++;
+      continue;
+    }
+
+    if (NAND_FTL_Erase(Ftl, b) == SUCCESS)
+    {
+      blk->State = NAND_FTL_FREE;
+      Ftl->Stat.FreeBlocks++;
+    }
+    else
+    {
+      NAND_FTL_MarkBad(Ftl, b);
+    }
+  }
+
+  if (Ftl->Stat.BadBlocks > (Ftl->Init.ReserveBlocks - NAND_FTL_GC_HARD))
+  {
+    return ERROR;
+  }
+  Ftl->Mounted = 1;
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup FSMC_Group8 NAND FTL block device functions
+ *  @brief   NAND FTL block device functions
+ *
+@verbatim
+ ===============================================================================
+                     NAND FTL block device functions
+ ===============================================================================
+
+  The sectors of 512 bytes are the ECC steps of the FSMC: a sector read
+  transfers only its 512 bytes and its 3 ECC bytes. A write programs a new
+  copy of the page, in the active block, and the previous copy becomes
+  stale. The partial pages are merged in the write cache, which is
+  programmed when the page is complete, when another page is written, or
+  by NAND_FTL_Flush().
+
+  Below NAND_FTL_GC_HARD free blocks, a write first collects the block with
+  the fewest valid pages: its valid pages are moved to the active block and
+  it is erased. The blocks failing a program are collected first, then
+  marked bad.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Reads sectors.
+  * @param  Ftl: NAND FTL instance
+  * @param  Buffer: data read
+  * @param  Sector: first sector
+  * @param  Count: number of sectors
+  * @retval SUCCESS, or ERROR if a sector has an uncorrectable error or is
+  *         out of the capacity
+  */
+ErrorStatus NAND_FTL_Read(NAND_FTL_TypeDef* Ftl, uint8_t* Buffer, uint32_t Sector, uint32_t Count)
+{
+  ErrorStatus status = SUCCESS;
+  uint32_t spp = Ftl->Init.PageSize / NAND_FTL_SECTOR_SIZE;
+  uint32_t lpn, step, n;
+
+  if ((Ftl->Mounted == 0) || (Sector >= NAND_FTL_GetSectorCount(Ftl)) ||
+      (Count > (NAND_FTL_GetSectorCount(Ftl) - Sector)))
+  {
+    return ERROR;
+  }
+
+  while (Count != 0)
+  {
+    lpn = Sector / spp;
+    step = Sector % spp;
+    n = spp - step;
+    if (n > Count)
+    {
+      n = Count;
+    }
+
+    if (lpn == Ftl->CachePage)
+    {
+      memcpy(Buffer, &Ftl->Init.PageBuffer[step * NAND_FTL_SECTOR_SIZE], n * NAND_FTL_SECTOR_SIZE);
+    }
+    else if (Ftl->Init.Map[lpn] == NAND_FTL_NO_PAGE)
+    {
+      memset(Buffer, 0xFF, n * NAND_FTL_SECTOR_SIZE);
+    }
+    else if (NAND_FTL_ReadData(Ftl, Ftl->Init.Map[lpn], step, n, Buffer) == NAND_FTL_READ_FAILED)
+    {
+      status = ERROR;
+    }
+
+    Buffer += n * NAND_FTL_SECTOR_SIZE;
+    Sector += n;
+    Count -= n;
+  }
+  return status;
+}
+
+/**
+  * @brief  Writes sectors.
+  * @param  Ftl: NAND FTL instance
+  * @param  Buffer: data to write
+  * @param  Sector: first sector
+  * @param  Count: number of sectors
+  * @retval SUCCESS, or ERROR if the memory is full or worn out, or the
+  *         sectors are out of the capacity
+  */
+ErrorStatus NAND_FTL_Write(NAND_FTL_TypeDef* Ftl, const uint8_t* Buffer, uint32_t Sector, uint32_t Count)
+{
+  ErrorStatus status = SUCCESS;
+  uint32_t spp = Ftl->Init.PageSize / NAND_FTL_SECTOR_SIZE;
+  uint32_t lpn, step, n;
+
+  if ((Ftl->Mounted == 0) || (Sector >= NAND_FTL_GetSectorCount(Ftl)) ||
+      (Count > (NAND_FTL_GetSectorCount(Ftl) - Sector)))
+  {
+    return ERROR;
+  }
+
+  while (Count != 0)
+  {
+    lpn = Sector / spp;
+    step = Sector % spp;
+    n = spp - step;
+    if (n > Count)
+    {
+      n = Count;
+    }
+
+    if (lpn != Ftl->CachePage)
+    {
+      if (NAND_FTL_Flush(Ftl) != SUCCESS)
+      {
+        return ERROR;
+      }
+      /* Load the sectors of the page not written */
+      if (n != spp)
+      {
+        if (Ftl->Init.Map[lpn] == NAND_FTL_NO_PAGE)
+        {
+          memset(Ftl->Init.PageBuffer, 0xFF, Ftl->Init.PageSize);
+        }
+        else if (NAND_FTL_ReadData(Ftl, Ftl->Init.Map[lpn], 0, spp,
+                                   Ftl->Init.PageBuffer) == NAND_FTL_READ_FAILED)
+        {
+          status = ERROR;
+        }
+      }
+      Ftl->CachePage = lpn;
+    }
+
+    memcpy(&Ftl->Init.PageBuffer[step * NAND_FTL_SECTOR_SIZE], Buffer, n * NAND_FTL_SECTOR_SIZE);
+    Ftl->CacheDirty = 1;
+    if ((step + n) == spp)
+    {
+      if (NAND_FTL_Flush(Ftl) != SUCCESS)
+      {
+        return ERROR;
+      }
+    }
+
+    Buffer += n * NAND_FTL_SECTOR_SIZE;
+    Sector += n;
+    Count -= n;
+  }
+  return status;
+}
+
+/**
+  * @brief  Programs the write cache if it holds data not written yet.
+  * @param  Ftl: NAND FTL instance
+  * @retval SUCCESS, or ERROR if the memory is full or worn out
+  */
+ErrorStatus NAND_FTL_Flush(NAND_FTL_TypeDef* Ftl)
+{
+  uint32_t victim, n;
+
+  if (Ftl->CacheDirty == 0)
+  {
+    return SUCCESS;
+  }
+
+  for (n = 0; (Ftl->Stat.FreeBlocks < NAND_FTL_GC_HARD) && (n < Ftl->Init.BlockCount); n++)
+  {
+    victim = NAND_FTL_Victim(Ftl);
+    if ((victim == NAND_FTL_NO_BLOCK) || (NAND_FTL_Collect(Ftl, victim, 0) != SUCCESS))
+    {
+      break;
+    }
+  }
+
+  if (NAND_FTL_PutPage(Ftl, Ftl->CachePage, Ftl->Init.PageBuffer, 0) != SUCCESS)
+  {
+    return ERROR;
+  }
+  Ftl->CacheDirty = 0;
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the capacity of the block device.
+  * @param  Ftl: NAND FTL instance
+  * @retval Number of sectors
+  */
+uint32_t NAND_FTL_GetSectorCount(NAND_FTL_TypeDef* Ftl)
+{
+  return Ftl->Pages * (Ftl->Init.PageSize / NAND_FTL_SECTOR_SIZE);
+}
+
+/**
+  * @brief  Returns the size of an erase block, to align the file system
+  *         clusters on it.
+  * @param  Ftl: NAND FTL instance
+  * @retval Number of sectors
+  */
+uint32_t NAND_FTL_GetEraseSectors(NAND_FTL_TypeDef* Ftl)
+{
+  return Ftl->Init.PagesPerBlock * (Ftl->Init.PageSize / NAND_FTL_SECTOR_SIZE);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup FSMC_Group9 NAND FTL maintenance functions
+ *  @brief   NAND FTL maintenance functions
+ *
+@verbatim
+ ===============================================================================
+                       NAND FTL maintenance functions
+ ===============================================================================
+
+  NAND_FTL_Idle() does at most one block collection per call, so that its
+  duration is bounded by PagesPerBlock page copies and one block erase:
+   - when the erase counts of the good blocks differ by more than
+     NAND_FTL_WEAR_DELTA, it moves the data of the least erased block
+     (static data) to the most erased free blocks, so that this block takes
+     its share of the writes
+   - otherwise, below NAND_FTL_GC_SOFT free blocks, it collects the block
+     with the fewest valid pages
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Does one step of the background garbage collection or of the
+  *         static wear levelling.
+  * @param  Ftl: NAND FTL instance
+  * @retval SUCCESS, or ERROR if a collection failed
+  */
+ErrorStatus NAND_FTL_Idle(NAND_FTL_TypeDef* Ftl)
+{
+  NAND_FTL_BlockTypeDef* blk;
+  uint32_t b, victim = NAND_FTL_NO_BLOCK;
+  uint32_t min = 0xFFFF, max = 0;
+
+  if (Ftl->Mounted == 0)
+  {
+    return ERROR;
+  }
+
+  for (b = 0; b < Ftl->Init.BlockCount; b++)
+  {
+    blk = &Ftl->Init.Blocks[b];
+    if (blk->State == NAND_FTL_BAD)
+    {
+      continue;
+    }
+    if (blk->EraseCount > max)
+    {
+      max = blk->EraseCount;
+    }
+    if ((blk->State == NAND_FTL_FULL) && (blk->EraseCount < min))
+    {
+      min = blk->EraseCount;
+      victim = b;
+    }
+  }
+
+  /* Static wear levelling first, while a free block takes the copies */
+  if ((victim != NAND_FTL_NO_BLOCK) && ((max - min) > NAND_FTL_WEAR_DELTA) &&
+      (Ftl->Stat.FreeBlocks != 0))
+  {
+    return NAND_FTL_Collect(Ftl, victim, 1);
+  }
+
+  if (Ftl->Stat.FreeBlocks >= NAND_FTL_GC_SOFT)
+  {
+    return SUCCESS;
+  }
+  victim = NAND_FTL_Victim(Ftl);
+  if (victim == NAND_FTL_NO_BLOCK)
+  {
+    return SUCCESS;
+  }
+  return NAND_FTL_Collect(Ftl, victim, 0);
+}
+
+/**
+  * @brief  Returns the statistics of the FTL.
+  * @param  Ftl: NAND FTL instance
+  * @param  Stat: statistics
+  * @retval None
+  */
+void NAND_FTL_GetStat(NAND_FTL_TypeDef* Ftl, NAND_FTL_StatTypeDef* Stat)
+{
+  NAND_FTL_BlockTypeDef* blk;
+  uint32_t b;
+
+  Ftl->Stat.MinErase = 0xFFFF;
+  Ftl->Stat.MaxErase = 0;
+  for (b = 0; b < Ftl->Init.BlockCount; b++)
+  {
+    blk = &Ftl->Init.Blocks[b];
+    if (blk->State != NAND_FTL_BAD)
+    {
+      if (blk->EraseCount < Ftl->Stat.MinErase)
+      {
+        Ftl->Stat.MinErase = blk->EraseCount;
+      }
+      if (blk->EraseCount > Ftl->Stat.MaxErase)
+      {
+        Ftl->Stat.MaxErase = blk->EraseCount;
+      }
+    }
+  }
+  *Stat = Ftl->Stat;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @brief  Sends the column and row address cycles.
+  * @param  Ftl: NAND FTL instance
+  * @param  Column: byte in the page
+  * @param  Row: page number
+  * @retval None
+  */
+static void NAND_FTL_Address(NAND_FTL_TypeDef* Ftl, uint32_t Column, uint32_t Row)
+{
+  uint32_t i;
+
+  NAND_FTL_ADDR(Ftl) = (uint8_t)Column;
+  NAND_FTL_ADDR(Ftl) = (uint8_t)(Column >> 8);
+  for (i = 0; i < Ftl->Init.RowCycles; i++)
+  {
+    NAND_FTL_ADDR(Ftl) = (uint8_t)Row;
+    Row >>= 8;
+  }
+}
+
+/**
+  * @brief  Waits for the end of an operation by polling the status register.
+  *         The memory is left in the status output mode.
+  * @param  Ftl: NAND FTL instance
+  * @retval Status register, with the fail bit set on a time out
+  */
+static uint8_t NAND_FTL_WaitReady(NAND_FTL_TypeDef* Ftl)
+{
+  uint32_t timeout = NAND_FTL_TIMEOUT;
+  uint8_t status;
+
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_STATUS;
+  do
+  {
+    status = NAND_FTL_DATA(Ftl);
+  }
+  while (((status & NAND_FTL_STATUS_READY) == 0) && (--timeout != 0));
+
+  if (timeout == 0)
+  {
+    status |= NAND_FTL_STATUS_FAIL;
+  }
+  return status;
+}
+
+/**
+  * @brief  Reads the first bytes of the spare area of a page.
+  * @param  Ftl: NAND FTL instance
+  * @param  Row: page number in the memory
+  * @param  Spare: bytes read
+  * @param  Length: number of bytes
+  * @retval None
+  */
+static void NAND_FTL_ReadSpare(NAND_FTL_TypeDef* Ftl, uint32_t Row, uint8_t* Spare, uint32_t Length)
+{
+  uint32_t i;
+
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_READ0;
+  NAND_FTL_Address(Ftl, Ftl->Init.PageSize, Row);
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_READ1;
+  NAND_FTL_WaitReady(Ftl);
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_READ0;
+
+  for (i = 0; i < Length; i++)
+  {
+    Spare[i] = NAND_FTL_DATA(Ftl);
+  }
+}
+
+/**
+  * @brief  Reads consecutive 512-byte steps of a page and corrects them with
+  *         the ECC stored in the spare area.
+  * @param  Ftl: NAND FTL instance
+  * @param  Ppn: physical page
+  * @param  Step: first step
+  * @param  Steps: number of steps
+  * @param  Buffer: data read
+  * @retval NAND_FTL_READ_OK, NAND_FTL_READ_CORRECTED or NAND_FTL_READ_FAILED
+  */
+static uint32_t NAND_FTL_ReadData(NAND_FTL_TypeDef* Ftl, uint32_t Ppn, uint32_t Step,
+                                  uint32_t Steps, uint8_t* Buffer)
+{
+  uint32_t ecc[NAND_FTL_STEPS_MAX];
+  uint32_t column = Ftl->Init.PageSize + NAND_FTL_ECC_OFFSET + (3 * Step);
+  uint32_t s, i, stored, result = NAND_FTL_READ_OK;
+
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_READ0;
+  NAND_FTL_Address(Ftl, Step * NAND_FTL_SECTOR_SIZE, NAND_FTL_ROW(Ftl, Ppn));
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_READ1;
+  NAND_FTL_WaitReady(Ftl);
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_READ0;
+
+  for (s = 0; s < Steps; s++)
+  {
+    FSMC_NANDECCCmd(Ftl->Init.Bank, ENABLE);
+    for (i = 0; i < NAND_FTL_SECTOR_SIZE; i++)
+    {
+      Buffer[(s * NAND_FTL_SECTOR_SIZE) + i] = NAND_FTL_DATA(Ftl);
+    }
+    ecc[s] = FSMC_GetECC(Ftl->Init.Bank) & NAND_FTL_ECC_MASK;
+    FSMC_NANDECCCmd(Ftl->Init.Bank, DISABLE);
+  }
+
+  /* Random data output to the ECC bytes of the steps read */
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_RNDOUT0;
+  NAND_FTL_ADDR(Ftl) = (uint8_t)column;
+  NAND_FTL_ADDR(Ftl) = (uint8_t)(column >> 8);
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_RNDOUT1;
+
+  for (s = 0; s < Steps; s++)
+  {
+    stored = NAND_FTL_DATA(Ftl);
+    stored |= (uint32_t)NAND_FTL_DATA(Ftl) << 8;
+    stored |= (uint32_t)NAND_FTL_DATA(Ftl) << 16;
+
+    switch (NAND_FTL_Correct(&Buffer[s * NAND_FTL_SECTOR_SIZE], stored, ecc[s]))
+    {
+    case NAND_FTL_READ_OK:
+      break;
+
+    case NAND_FTL_READ_CORRECTED:
+      Ftl->Stat.Corrected++;
+      if (result == NAND_FTL_READ_OK)
+      {
+        result = NAND_FTL_READ_CORRECTED;
+      }
+      break;
+
+    default:
+      Ftl->Stat.Uncorrectable++;
+      result = NAND_FTL_READ_FAILED;
+      break;
+    }
+  }
+  return result;
+}
+
+/**
+  * @brief  Corrects a 512-byte step from its stored and computed ECC.
+  * @param  Data: step read
+  * @param  Stored: ECC computed at the program
+  * @param  Computed: ECC computed at the read
+  * @retval NAND_FTL_READ_OK, NAND_FTL_READ_CORRECTED or NAND_FTL_READ_FAILED
+  */
+static uint32_t NAND_FTL_Correct(uint8_t* Data, uint32_t Stored, uint32_t Computed)
+{
+  uint32_t syndrome = (Stored ^ Computed) & NAND_FTL_ECC_MASK;
+  uint32_t position = 0;
+  uint32_t i;
+
+  if (syndrome == 0)
+  {
+    return NAND_FTL_READ_OK;
+  }
+
+  if (((syndrome ^ (syndrome >> 1)) & NAND_FTL_ECC_PAIRS) == NAND_FTL_ECC_PAIRS)
+  {
+    /* Single bit error in the data: the odd bits give its position */
+    for (i = 0; i < 12; i++)
+    {
+      position |= ((syndrome >> ((2 * i) + 1)) & 0x1) << i;
+    }
+    Data[position >> 3] ^= (uint8_t)(1 << (position & 0x7));
+    return NAND_FTL_READ_CORRECTED;
+  }
+
+  if ((syndrome & (syndrome - 1)) == 0)
+  {
+    /* Single bit error in the stored ECC: the data is right */
+    return NAND_FTL_READ_CORRECTED;
+  }
+  return NAND_FTL_READ_FAILED;
+}
+
+/**
+  * @brief  Programs a page with its spare area.
+  * @param  Ftl: NAND FTL instance
+  * @param  Ppn: physical page
+  * @param  Lpn: logical page stored
+  * @param  Data: PageSize bytes
+  * @retval SUCCESS, or ERROR if the program failed
+  */
+static ErrorStatus NAND_FTL_Program(NAND_FTL_TypeDef* Ftl, uint32_t Ppn, uint32_t Lpn, const uint8_t* Data)
+{
+  uint8_t spare[NAND_FTL_SPARE_MAX];
+  uint32_t steps = Ftl->Init.PageSize / NAND_FTL_SECTOR_SIZE;
+  uint32_t length = NAND_FTL_SPARE_MIN(Ftl->Init.PageSize);
+  uint32_t s, i, ecc, check = 0;
+
+  memset(spare, 0xFF, sizeof(spare));
+  NAND_FTL_Put32(&spare[NAND_FTL_SPARE_PAGE], Lpn);
+  NAND_FTL_Put32(&spare[NAND_FTL_SPARE_SEQ], Ftl->Sequence++);
+  NAND_FTL_Put32(&spare[NAND_FTL_SPARE_ERASE], Ftl->Init.Blocks[Ppn / Ftl->Init.PagesPerBlock].EraseCount);
+  for (i = NAND_FTL_SPARE_PAGE; i < NAND_FTL_ECC_OFFSET; i++)
+  {
+    check += spare[i];
+  }
+  spare[NAND_FTL_SPARE_CHECK] = (uint8_t)~check;
+  spare[NAND_FTL_SPARE_CHECK + 1] = (uint8_t)(~check >> 8);
+
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_PROGRAM0;
+  NAND_FTL_Address(Ftl, 0, NAND_FTL_ROW(Ftl, Ppn));
+
+  for (s = 0; s < steps; s++)
+  {
+    FSMC_NANDECCCmd(Ftl->Init.Bank, ENABLE);
+    for (i = 0; i < NAND_FTL_SECTOR_SIZE; i++)
+    {
+      NAND_FTL_DATA(Ftl) = Data[(s * NAND_FTL_SECTOR_SIZE) + i];
+    }
+    /* The ECC is valid once the FIFO has written the last byte */
+    while (FSMC_GetFlagStatus(Ftl->Init.Bank, FSMC_FLAG_FEMPT) == RESET)
+    {
+    }
+    ecc = FSMC_GetECC(Ftl->Init.Bank);
+    FSMC_NANDECCCmd(Ftl->Init.Bank, DISABLE);
+
+    spare[NAND_FTL_ECC_OFFSET + (3 * s)] = (uint8_t)ecc;
+    spare[NAND_FTL_ECC_OFFSET + (3 * s) + 1] = (uint8_t)(ecc >> 8);
+    spare[NAND_FTL_ECC_OFFSET + (3 * s) + 2] = (uint8_t)(ecc >> 16);
+  }
+
+  for (i = 0; i < length; i++)
+  {
+    NAND_FTL_DATA(Ftl) = spare[i];
+  }
+
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_PROGRAM1;
+  if ((NAND_FTL_WaitReady(Ftl) & NAND_FTL_STATUS_FAIL) != 0)
+  {
+    return ERROR;
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Erases a block and counts the erase cycle.
+  * @param  Ftl: NAND FTL instance
+  * @param  Block: block of the FTL
+  * @retval SUCCESS, or ERROR if the erase failed
+  */
+static ErrorStatus NAND_FTL_Erase(NAND_FTL_TypeDef* Ftl, uint32_t Block)
+{
+  uint32_t row = NAND_FTL_ROW(Ftl, Block * Ftl->Init.PagesPerBlock);
+  uint32_t i;
+
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_ERASE0;
+  for (i = 0; i < Ftl->Init.RowCycles; i++)
+  {
+    NAND_FTL_ADDR(Ftl) = (uint8_t)row;
+    row >>= 8;
+  }
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_ERASE1;
+
+  if (Ftl->Init.Blocks[Block].EraseCount < 0xFFFE)
+  {
+    Ftl->Init.Blocks[Block].EraseCount++;
+  }
+  if ((NAND_FTL_WaitReady(Ftl) & NAND_FTL_STATUS_FAIL) != 0)
+  {
+    return ERROR;
+  }
+  return SUCCESS;
+}
+
+/**
+  * @brief  Writes the bad block marker in the spare area of the page 0.
+  * @param  Ftl: NAND FTL instance
+  * @param  Block: block of the FTL
+  * @retval None
+  */
+static void NAND_FTL_MarkBad(NAND_FTL_TypeDef* Ftl, uint32_t Block)
+{
+  NAND_FTL_Erase(Ftl, Block);
+
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_PROGRAM0;
+  NAND_FTL_Address(Ftl, Ftl->Init.PageSize, NAND_FTL_ROW(Ftl, Block * Ftl->Init.PagesPerBlock));
+  NAND_FTL_DATA(Ftl) = 0x00;
+  NAND_FTL_CMD(Ftl) = NAND_FTL_CMD_PROGRAM1;
+  NAND_FTL_WaitReady(Ftl);
+
+  Ftl->Init.Blocks[Block].State = NAND_FTL_BAD;
+  Ftl->Init.Blocks[Block].Valid = 0;
+  Ftl->Init.Blocks[Block].Used = 0;
+  Ftl->Stat.BadBlocks++;
+}
+
+/**
+  * @brief  Reads the metadata of a page from its spare area.
+  * @param  Ftl: NAND FTL instance
+  * @param  Ppn: physical page
+  * @param  Seq: sequence number, NAND_FTL_NO_LPN if the page is erased,
+  *         0 if the metadata is corrupted
+  * @param  Erase: erase count of the block
+  * @retval Logical page, or NAND_FTL_NO_LPN if the page holds no valid metadata
+  */
+static uint32_t NAND_FTL_GetMeta(NAND_FTL_TypeDef* Ftl, uint32_t Ppn, uint32_t* Seq, uint32_t* Erase)
+{
+  uint8_t spare[NAND_FTL_ECC_OFFSET];
+  uint32_t i, check = 0, erased = 0xFF;
+
+  NAND_FTL_ReadSpare(Ftl, NAND_FTL_ROW(Ftl, Ppn), spare, sizeof(spare));
+  for (i = 0; i < NAND_FTL_ECC_OFFSET; i++)
+  {
+    erased &= spare[i];
+  }
+  for (i = NAND_FTL_SPARE_PAGE; i < NAND_FTL_ECC_OFFSET; i++)
+  {
+    check += spare[i];
+  }
+
+  *Erase = NAND_FTL_Get32(&spare[NAND_FTL_SPARE_ERASE]);
+  if (erased == 0xFF)
+  {
+    *Seq = NAND_FTL_NO_LPN;
+    return NAND_FTL_NO_LPN;
+  }
+  *Seq = NAND_FTL_Get32(&spare[NAND_FTL_SPARE_SEQ]);
+  if ((spare[NAND_FTL_SPARE_BAD] != 0xFF) || (*Seq == NAND_FTL_NO_LPN) ||
+      (spare[NAND_FTL_SPARE_CHECK] != (uint8_t)~check) ||
+      (spare[NAND_FTL_SPARE_CHECK + 1] != (uint8_t)(~check >> 8)))
+  {
+    if (*Seq == NAND_FTL_NO_LPN)
+    {
+      *Seq = 0;
+    }
+    return NAND_FTL_NO_LPN;
+  }
+  return NAND_FTL_Get32(&spare[NAND_FTL_SPARE_PAGE]);
+}
+
+/**
+  * @brief  Takes the free block with the lowest erase count as active block,
+  *         or with the highest erase count for the static data.
+  * @param  Ftl: NAND FTL instance
+  * @param  Worn: 1 to take the most erased block
+  * @retval Block, or NAND_FTL_NO_BLOCK if no block is free
+  */
+static uint32_t NAND_FTL_NewBlock(NAND_FTL_TypeDef* Ftl, uint32_t Worn)
+{
+  NAND_FTL_BlockTypeDef* blk;
+  uint32_t b, best = NAND_FTL_NO_BLOCK;
+
+  for (b = 0; b < Ftl->Init.BlockCount; b++)
+  {
+    blk = &Ftl->Init.Blocks[b];
+    if ((blk->State == NAND_FTL_FREE) &&
+        ((best == NAND_FTL_NO_BLOCK) ||
+         ((Worn == 0) && (blk->EraseCount < Ftl->Init.Blocks[best].EraseCount)) ||
+         ((Worn != 0) && (blk->EraseCount > Ftl->Init.Blocks[best].EraseCount))))
+    {
+      best = b;
+    }
+  }
+
+  if (best != NAND_FTL_NO_BLOCK)
+  {
+    Ftl->Init.Blocks[best].State = NAND_FTL_ACTIVE;
+    Ftl->Stat.FreeBlocks--;
+  }
+  return best;
+}
+
+/**
+  * @brief  Programs a logical page in the next page of the active block.
+  * @param  Ftl: NAND FTL instance
+  * @param  Lpn: logical page
+  * @param  Data: PageSize bytes
+  * @param  Worn: 1 to take the most erased block when the active block is full
+  * @retval SUCCESS, or ERROR if no block is free
+  */
+static ErrorStatus NAND_FTL_PutPage(NAND_FTL_TypeDef* Ftl, uint32_t Lpn, const uint8_t* Data, uint32_t Worn)
+{
+  NAND_FTL_BlockTypeDef* blk;
+  uint32_t ppn, old;
+
+  for (;;)
+  {
+    if ((Ftl->Active == NAND_FTL_NO_BLOCK) ||
+        (Ftl->Init.Blocks[Ftl->Active].Used == Ftl->Init.PagesPerBlock))
+    {
+      if (Ftl->Active != NAND_FTL_NO_BLOCK)
+      {
+        Ftl->Init.Blocks[Ftl->Active].State = NAND_FTL_FULL;
+      }
+      Ftl->Active = NAND_FTL_NewBlock(Ftl, Worn);
+      if (Ftl->Active == NAND_FTL_NO_BLOCK)
+      {
+        return ERROR;
+      }
+    }
+
+    blk = &Ftl->Init.Blocks[Ftl->Active];
+    ppn = (Ftl->Active * Ftl->Init.PagesPerBlock) + blk->Used;
+    blk->Used++;
+
+    if (NAND_FTL_Program(Ftl, ppn, Lpn, Data) == SUCCESS)
+    {
+      old = Ftl->Init.Map[Lpn];
+      if (old != NAND_FTL_NO_PAGE)
+      {
+        Ftl->Init.Blocks[old / Ftl->Init.PagesPerBlock].Valid--;
+      }
+      Ftl->Init.Map[Lpn] = (uint16_t)ppn;
+      blk->Valid++;
+      return SUCCESS;
+    }
+
+    /* Program failure: retire the block once its valid pages are moved */
+    blk->Retire = 1;
+    blk->State = NAND_FTL_FULL;
+    Ftl->Active = NAND_FTL_NO_BLOCK;
+  }
+}
+
+/**
+  * @brief  Selects the block to collect: a block to retire, or else the
+  *         programmed block with the fewest valid pages.
+  * @param  Ftl: NAND FTL instance
+  * @retval Block, or NAND_FTL_NO_BLOCK if no block holds stale pages
+  */
+static uint32_t NAND_FTL_Victim(NAND_FTL_TypeDef* Ftl)
+{
+  NAND_FTL_BlockTypeDef* blk;
+  uint32_t b, best = NAND_FTL_NO_BLOCK;
+  uint32_t valid = Ftl->Init.PagesPerBlock;
+
+  for (b = 0; b < Ftl->Init.BlockCount; b++)
+  {
+    blk = &Ftl->Init.Blocks[b];
+    if (blk->State != NAND_FTL_FULL)
+    {
+      continue;
+    }
+    if (blk->Retire != 0)
+    {
+      return b;
+    }
+    if (blk->Valid < valid)
+    {
+      valid = blk->Valid;
+      best = b;
+    }
+  }
+  return best;
+}
+
+/**
+  * @brief  Moves the valid pages of a block to the active block, and erases
+  *         the block or marks it bad.
+  * @param  Ftl: NAND FTL instance
+  * @param  Block: programmed block
+  * @param  Worn: 1 to move static data to the most erased blocks
+  * @retval SUCCESS, or ERROR if no block is free for the copies
+  */
+static ErrorStatus NAND_FTL_Collect(NAND_FTL_TypeDef* Ftl, uint32_t Block, uint32_t Worn)
+{
+  NAND_FTL_BlockTypeDef* blk = &Ftl->Init.Blocks[Block];
+  uint32_t ppb = Ftl->Init.PagesPerBlock;
+  uint32_t p, ppn, lpn, seq, erase;
+
+  for (p = 0; (p < blk->Used) && (blk->Valid != 0); p++)
+  {
+    ppn = (Block * ppb) + p;
+    lpn = NAND_FTL_GetMeta(Ftl, ppn, &seq, &erase);
+    if ((lpn < Ftl->Pages) && (Ftl->Init.Map[lpn] == ppn))
+    {
+      /* An uncorrectable page is moved as read: it is counted in the statistics */
+      NAND_FTL_ReadData(Ftl, ppn, 0, Ftl->Init.PageSize / NAND_FTL_SECTOR_SIZE, Ftl->Init.CopyBuffer);
+      if (NAND_FTL_PutPage(Ftl, lpn, Ftl->Init.CopyBuffer, Worn) != SUCCESS)
+      {
+        return ERROR;
+      }
+      Ftl->Stat.Copies++;
+    }
+  }
+
+  Ftl->Stat.Collections++;
+  if ((blk->Retire != 0) || (NAND_FTL_Erase(Ftl, Block) != SUCCESS))
+  {
+    NAND_FTL_MarkBad(Ftl, Block);
+    return SUCCESS;
+  }
+  blk->State = NAND_FTL_FREE;
+  blk->Valid = 0;
+  blk->Used = 0;
+  Ftl->Stat.FreeBlocks++;
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reads a 32-bit little endian value.
+  * @param  Buffer: 4 bytes
+  * @retval Value
+  */
+static uint32_t NAND_FTL_Get32(const uint8_t* Buffer)
+{
+  return (uint32_t)Buffer[0] | ((uint32_t)Buffer[1] << 8) |
+         ((uint32_t)Buffer[2] << 16) | ((uint32_t)Buffer[3] << 24);
+}
+
+/**
+  * @brief  Writes a 32-bit little endian value.
+  * @param  Buffer: 4 bytes
+  * @param  Value: value
+  * @retval None
+  */
+static void NAND_FTL_Put32(uint8_t* Buffer, uint32_t Value)
+{
+  Buffer[0] = (uint8_t)Value;
+  Buffer[1] = (uint8_t)(Value >> 8);
+  Buffer[2] = (uint8_t)(Value >> 16);
+  Buffer[3] = (uint8_t)(Value >> 24);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,424 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_pwr_bkplog.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a log in the backup SRAM:
+  *           - Append-only records in a ring, kept through the resets and
+  *             the STANDBY mode
+  *           - CRC of each record computed by the CRC unit
+  *           - Check of the log after a reset
+  *           - Copy of the records into the log of the FLASH store
+  *          It uses the stm32f4xx_pwr.c/.h, stm32f4xx_rcc.c/.h,
+  *          stm32f4xx_crc.c/.h and stm32f4xx_flash_kv.c/.h drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Call PWR_BkpLogInit() at each startup with the same area of
+  *             the backup SRAM: the records written before the reset are
+  *             kept.
+  *
+  *          2. Store events using PWR_BkpLogAppend(), from the thread mode
+  *             or from an interrupt (fault handler...).
+  *
+  *          3. Read the records back in order using PWR_BkpLogRead(), or
+  *             copy them into the log of the FLASH store using
+  *             PWR_BkpLogDrain() when the application is idle.
+  *
+  * @note   An append resets and uses the CRC unit: the code which uses the
+  *         CRC unit must not be interrupted by an append.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_pwr_bkplog.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup PWR
+  * @brief PWR driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define PWR_BKPLOG_MAGIC          ((uint32_t)0x474C4B42)
+#define PWR_BKPLOG_TIMEOUT        ((uint32_t)0x00010000)
+
+/* Record: length, data padded to a word, CRC of both */
+#define PWR_BKPLOG_RECORD_SIZE(LENGTH) (((uint32_t)8) + (((uint32_t)(LENGTH) + 3) & ~(uint32_t)3))
+
+/* Private macro -------------------------------------------------------------*/
+#define PWR_BKPLOG_WORD(LOG, OFFSET) ((LOG)->Ring[((OFFSET) >> 2) & (LOG)->Mask])
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t PWR_BkpLogRecordCRC(PWR_BkpLogTypeDef* Log, uint32_t Offset, uint32_t Length);
+static uint32_t PWR_BkpLogPeek(PWR_BkpLogTypeDef* Log, uint8_t* Data, uint16_t* Length);
+static void PWR_BkpLogRemove(PWR_BkpLogTypeDef* Log, uint32_t Tail, uint16_t Length);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup PWR_Private_Functions
+  * @{
+  */
+
+/** @defgroup PWR_Group9 Backup SRAM log functions
+ *  @brief   Backup SRAM log functions
+ *
+@verbatim
+ ===============================================================================
+                         Backup SRAM log functions
+ ===============================================================================
+
+  The backup SRAM keeps its content through the resets and the STANDBY mode,
+  and on VBAT when VDD is off, once the backup regulator is enabled.
+
+  The log is a header followed by a ring whose size is a power of 2. The
+  header holds the offsets of the oldest record and of the end of the last
+  one, which count the bytes written since the log was formatted. A record
+  holds its length, the data and the CRC of both. The record is written
+  first, then the head offset is updated by a single word write: a record cut
+  by a reset is not in the log.
+
+  PWR_BkpLogInit() formats the log when the header is not valid (first
+  power-on, VBAT lost...), else checks the CRC of the records from the oldest
+  one, and cuts the log at the first corrupted record.
+
+  An append takes the time to copy the data and to feed it to the CRC unit,
+  with the interrupts masked. When the ring is full, the oldest records are
+  dropped: the log keeps the last events.
+
+  PWR_BkpLogDrain() copies the oldest records into the log of the FLASH
+  store, then removes them from the ring. A reset between the two may copy a
+  record twice.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the log, and checks the records kept in the backup
+  *         SRAM.
+  * @note   The PWR, backup SRAM and CRC clocks, the access to the backup
+  *         domain and the backup regulator are enabled.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @param  Address: address of the log in the backup SRAM, a multiple of 4.
+  * @param  Size: size of the ring in bytes, a power of 2. The log uses
+  *         PWR_BKPLOG_HEADER_SIZE more bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the log is ready
+  *          - ERROR: the backup regulator is not ready
+  */
+ErrorStatus PWR_BkpLogInit(PWR_BkpLogTypeDef* Log, uint32_t Address, uint32_t Size)
+{
+  PWR_BkpLogHeaderTypeDef* header = (PWR_BkpLogHeaderTypeDef*)Address;
+  uint32_t timeout = 0, offset = 0, length = 0, size = 0;
+
+  /* Check the parameters */
+  assert_param(IS_PWR_BKPLOG_SIZE(Size));
+  assert_param(IS_PWR_BKPLOG_AREA(Address, Size));
+
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+  PWR_BackupAccessCmd(ENABLE);
+  RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_BKPSRAM | RCC_AHB1Periph_CRC, ENABLE);
+
+  PWR_BackupRegulatorCmd(ENABLE);
+  for (; (PWR_GetFlagStatus(PWR_FLAG_BRR) == RESET) && (timeout < PWR_BKPLOG_TIMEOUT); timeout++)
+  {
+  }
+  if (timeout == PWR_BKPLOG_TIMEOUT)
+  {
+    return ERROR;
+  }
+
+  Log->Header = header;
+  Log->Ring = (__IO uint32_t*)(Address + PWR_BKPLOG_HEADER_SIZE);
+  Log->Mask = (Size >> 2) - 1;
+  Log->Dropped = 0;
+  Log->Corrupted = 0;
+
+  if ((header->Magic != PWR_BKPLOG_MAGIC) || (header->Size != Size) ||
+      (((header->Head | header->Tail) & 3) != 0) || ((header->Head - header->Tail) > Size))
+  {
+    PWR_BkpLogClear(Log);
+    return SUCCESS;
+  }
+
+  /* Check the records from the oldest one */
+  for (offset = header->Tail; offset != header->Head; offset += size)
+  {
+    length = PWR_BKPLOG_WORD(Log, offset);
+    size = PWR_BKPLOG_RECORD_SIZE(length);
+
+    if ((length > PWR_BKPLOG_MAX_LENGTH) || (size > (header->Head - offset)) ||
+        (PWR_BKPLOG_WORD(Log, offset + size - 4) != PWR_BkpLogRecordCRC(Log, offset, length)))
+    {
+      header->Head = offset;
+      Log->Corrupted = 1;
+      break;
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Appends a record to the log.
+  * @note   This function can be called from an interrupt.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @param  Data: the data of the record.
+  * @param  Length: length of the data in bytes, at most PWR_BKPLOG_MAX_LENGTH.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the record is in the log
+  *          - ERROR: the record is longer than PWR_BKPLOG_MAX_LENGTH or than
+  *            the ring
+  */
+ErrorStatus PWR_BkpLogAppend(PWR_BkpLogTypeDef* Log, const uint8_t* Data, uint16_t Length)
+{
+  PWR_BkpLogHeaderTypeDef* header = Log->Header;
+  uint32_t primask = 0, head = 0, size = 0, word = 0, n = 0;
+
+  size = PWR_BKPLOG_RECORD_SIZE(Length);
+  if ((Length > PWR_BKPLOG_MAX_LENGTH) || (size > ((Log->Mask + 1) << 2)))
+  {
+    return ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  head = header->Head;
+
+  /* Drop the oldest records to make room */
+  while ((head + size - header->Tail) > ((Log->Mask + 1) << 2))
+  {
+    header->Tail += PWR_BKPLOG_RECORD_SIZE(PWR_BKPLOG_WORD(Log, header->Tail));
+    Log->Dropped++;
+  }
+
+  CRC_ResetDR();
+  PWR_BKPLOG_WORD(Log, head) = Length;
+  CRC->DR = Length;
+  head += 4;
+
+  for (n = 0; n < Length; n += 4, head += 4)
+  {
+    if (((((uint32_t)Data) & 3) == 0) && ((Length - n) >= 4))
+    {
+      word = *(const uint32_t*)(Data + n);
+    }
+    else
+    {
+      word = Data[n];
+      if ((n + 1) < Length) word |= (uint32_t)Data[n + 1] << 8;
+      if ((n + 2) < Length) word |= (uint32_t)Data[n + 2] << 16;
+      if ((n + 3) < Length) word |= (uint32_t)Data[n + 3] << 24;
+    }
+    PWR_BKPLOG_WORD(Log, head) = word;
+    CRC->DR = word;
+  }
+
+  PWR_BKPLOG_WORD(Log, head) = CRC->DR;
+  head += 4;
+
+  /* The record is in the log once the head is updated */
+  header->Head = head;
+
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reads and removes the oldest record of the log.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @param  Data: receives the data of the record, at least
+  *         PWR_BKPLOG_MAX_LENGTH bytes.
+  * @param  Length: returns the length of the record in bytes.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: a record is read
+  *          - ERROR: the log is empty
+  */
+ErrorStatus PWR_BkpLogRead(PWR_BkpLogTypeDef* Log, uint8_t* Data, uint16_t* Length)
+{
+  uint32_t tail = 0;
+
+  if (Log->Header->Head == Log->Header->Tail)
+  {
+    return ERROR;
+  }
+
+  tail = PWR_BkpLogPeek(Log, Data, Length);
+  PWR_BkpLogRemove(Log, tail, *Length);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Copies the oldest records into the log of the FLASH store, and
+  *         removes them from the log.
+  * @note   Each record takes a FLASH write: call this function when the
+  *         application is idle, with a small number of records.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @param  KV: pointer to the FLASH store, initialized by FLASH_KVInit().
+  * @param  MaxRecords: maximum number of records copied.
+  * @retval The number of records copied: less than MaxRecords when the log
+  *         is empty or after a FLASH error.
+  */
+uint32_t PWR_BkpLogDrain(PWR_BkpLogTypeDef* Log, FLASH_KVTypeDef* KV, uint32_t MaxRecords)
+{
+  uint32_t buffer[(PWR_BKPLOG_MAX_LENGTH + 3) / 4];
+  uint32_t count = 0, tail = 0;
+  uint16_t length = 0;
+
+  for (count = 0; (count < MaxRecords) && (Log->Header->Head != Log->Header->Tail); count++)
+  {
+    tail = PWR_BkpLogPeek(Log, (uint8_t*)buffer, &length);
+
+    if (FLASH_KVLogAppend(KV, (const uint8_t*)buffer, length) != SUCCESS)
+    {
+      break;
+    }
+
+    PWR_BkpLogRemove(Log, tail, length);
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Removes all the records and formats the log.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @retval None
+  */
+void PWR_BkpLogClear(PWR_BkpLogTypeDef* Log)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  Log->Header->Magic = 0;
+  Log->Header->Size = (Log->Mask + 1) << 2;
+  Log->Header->Head = 0;
+  Log->Header->Tail = 0;
+  Log->Header->Magic = PWR_BKPLOG_MAGIC;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Computes the CRC of a record with the CRC unit.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @param  Offset: offset of the record.
+  * @param  Length: length of the data of the record.
+  * @retval The CRC.
+  */
+static uint32_t PWR_BkpLogRecordCRC(PWR_BkpLogTypeDef* Log, uint32_t Offset, uint32_t Length)
+{
+  uint32_t end = Offset + PWR_BKPLOG_RECORD_SIZE(Length) - 4;
+
+  CRC_ResetDR();
+  for (; Offset != end; Offset += 4)
+  {
+    CRC->DR = PWR_BKPLOG_WORD(Log, Offset);
+  }
+
+  return CRC->DR;
+}
+
+/**
+  * @brief  Copies the oldest record of a log which is not empty.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @param  Data: receives the data of the record.
+  * @param  Length: returns the length of the record in bytes.
+  * @retval The offset of the record, for PWR_BkpLogRemove().
+  */
+static uint32_t PWR_BkpLogPeek(PWR_BkpLogTypeDef* Log, uint8_t* Data, uint16_t* Length)
+{
+  uint32_t primask = 0, tail = 0, offset = 0, word = 0, n = 0;
+
+  /* An append may drop the record in the meantime */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  tail = Log->Header->Tail;
+  *Length = (uint16_t)PWR_BKPLOG_WORD(Log, tail);
+
+  for (n = 0, offset = tail + 4; n < *Length; n++)
+  {
+    if ((n & 3) == 0)
+    {
+      word = PWR_BKPLOG_WORD(Log, offset);
+      offset += 4;
+    }
+    Data[n] = (uint8_t)word;
+    word >>= 8;
+  }
+
+  __set_PRIMASK(primask);
+
+  return tail;
+}
+
+/**
+  * @brief  Removes a record read by PWR_BkpLogPeek(), unless an append
+  *         already dropped it.
+  * @param  Log: pointer to a PWR_BkpLogTypeDef structure.
+  * @param  Tail: the offset of the record.
+  * @param  Length: the length of the record.
+  * @retval None
+  */
+static void PWR_BkpLogRemove(PWR_BkpLogTypeDef* Log, uint32_t Tail, uint16_t Length)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (Log->Header->Tail == Tail)
+  {
+    Log->Header->Tail = Tail + PWR_BKPLOG_RECORD_SIZE(Length);
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,431 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_rcc_dvfs.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides dynamic voltage and frequency scaling of the
+  *          system clock:
+  *           - Operating points with the PLL, bus prescalers and regulator
+  *             voltage scale
+  *           - Change of operating point with the FLASH latency and caches
+  *           - Callbacks of the peripherals which depend on the clocks
+  *           - Choice of the operating point from the CPU load
+  *          It uses the stm32f4xx_rcc.c/.h, stm32f4xx_pwr.c/.h and
+  *          stm32f4xx_flash.c/.h drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Call RCC_DVFSInit() with the operating points sorted by
+  *             increasing HCLK frequency, or with none to use the predefined
+  *             48, 84, 120 and 168 MHz points, and the device voltage range.
+  *
+  *          2. Register the functions which set the baud rates and the
+  *             prescalers of the peripherals using RCC_DVFSRegisterCallback().
+  *
+  *          3. Change the operating point using RCC_DVFSSetOperatingPoint(),
+  *             or report the CPU load periodically using RCC_DVFSUpdateLoad().
+  *
+  * @note   The operating points use the HSE as PLL input. The clocks of the
+  *         peripherals are not stable during a change of operating point
+  *         which relocks the PLL: their transfers must be stopped.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_rcc_dvfs.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup RCC
+  * @brief RCC driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define RCC_DVFS_TIMEOUT          ((uint32_t)0x00010000)
+
+/* RCC_GetSYSCLKSource() values */
+#define RCC_DVFS_SWS_HSE          ((uint8_t)0x04)
+#define RCC_DVFS_SWS_PLL          ((uint8_t)0x08)
+
+#define RCC_DVFS_PLLCFGR_MASK     (RCC_PLLCFGR_PLLM | RCC_PLLCFGR_PLLN | RCC_PLLCFGR_PLLP | \
+                                   RCC_PLLCFGR_PLLSRC | RCC_PLLCFGR_PLLQ)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+const RCC_OperatingPointTypeDef RCC_OperatingPoint_168MHz =
+{
+  168000000, RCC_DVFS_PLLM, 336, 2, 7,
+  RCC_SYSCLK_Div1, RCC_HCLK_Div4, RCC_HCLK_Div2, PWR_Regulator_Voltage_Scale1
+};
+
+const RCC_OperatingPointTypeDef RCC_OperatingPoint_120MHz =
+{
+  120000000, RCC_DVFS_PLLM, 240, 2, 5,
+  RCC_SYSCLK_Div1, RCC_HCLK_Div4, RCC_HCLK_Div2, PWR_Regulator_Voltage_Scale2
+};
+
+const RCC_OperatingPointTypeDef RCC_OperatingPoint_84MHz =
+{
+  84000000, RCC_DVFS_PLLM, 336, 2, 7,
+  RCC_SYSCLK_Div2, RCC_HCLK_Div2, RCC_HCLK_Div1, PWR_Regulator_Voltage_Scale1
+};
+
+const RCC_OperatingPointTypeDef RCC_OperatingPoint_48MHz =
+{
+  48000000, RCC_DVFS_PLLM, 192, 4, 4,
+  RCC_SYSCLK_Div1, RCC_HCLK_Div2, RCC_HCLK_Div1, PWR_Regulator_Voltage_Scale2
+};
+
+static const RCC_OperatingPointTypeDef* const RCC_DVFSDefaultPoints[4] =
+{
+  &RCC_OperatingPoint_48MHz, &RCC_OperatingPoint_84MHz,
+  &RCC_OperatingPoint_120MHz, &RCC_OperatingPoint_168MHz
+};
+
+static const RCC_OperatingPointTypeDef* const* RCC_DVFSPoints = RCC_DVFSDefaultPoints;
+static uint32_t RCC_DVFSNbPoints = 4;
+static const RCC_OperatingPointTypeDef* RCC_DVFSCurrent = 0;
+static uint8_t RCC_DVFSVoltageRange = VoltageRange_3;
+static uint8_t RCC_DVFSDownCount = 0;
+
+static RCC_DVFSCallback RCC_DVFSCallbacks[RCC_DVFS_MAX_CALLBACKS];
+static uint32_t RCC_DVFSNbCallbacks = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void RCC_DVFSSetPrescalers(const RCC_OperatingPointTypeDef* Point, uint8_t Increase);
+static ErrorStatus RCC_DVFSRelock(const RCC_OperatingPointTypeDef* Point);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup RCC_Private_Functions
+  * @{
+  */
+
+/** @defgroup RCC_Group5 Dynamic voltage and frequency scaling functions
+ *  @brief   Dynamic voltage and frequency scaling functions
+ *
+@verbatim
+ ===============================================================================
+              Dynamic voltage and frequency scaling functions
+ ===============================================================================
+
+  A change of operating point is done in the following order:
+    - The FLASH latency is increased for the new HCLK frequency.
+    - When the PLL and the regulator voltage scale of the new point are the
+      ones in use, only the AHB and APB prescalers change: the change takes
+      a few cycles.
+    - Else, the system clock is switched to the HSE, the PLL is stopped, the
+      regulator voltage scale is set, and the PLL is configured and started
+      again. The change takes the PLL lock time, about 100 us, and the HSE
+      startup time when the HSE is off.
+    - The FLASH latency is decreased for the new HCLK frequency, and the
+      caches are reset and enabled.
+    - SystemCoreClock is updated, and the registered callbacks are called
+      with the new clock frequencies.
+
+  RCC_DVFSUpdateLoad() chooses the slowest operating point which runs the
+  reported load at RCC_DVFS_TARGET_LOAD percent of the CPU. It scales up at
+  once, and scales down after RCC_DVFS_DOWN_DELAY reports of a lower load.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the dynamic voltage and frequency scaling.
+  * @param  Points: the operating points sorted by increasing HCLK frequency,
+  *         or 0 for the predefined points.
+  * @param  NbPoints: number of operating points.
+  * @param  VoltageRange: The device voltage range, which defines the FLASH
+  *         latency. This parameter can be a value of @ref FLASH_Voltage_Range.
+  * @retval None
+  */
+void RCC_DVFSInit(const RCC_OperatingPointTypeDef* const* Points, uint32_t NbPoints, uint8_t VoltageRange)
+{
+  /* Check the parameters */
+  assert_param(IS_VOLTAGERANGE(VoltageRange));
+
+  if (Points != 0)
+  {
+    assert_param(NbPoints != 0);
+    RCC_DVFSPoints = Points;
+    RCC_DVFSNbPoints = NbPoints;
+  }
+  else
+  {
+    RCC_DVFSPoints = RCC_DVFSDefaultPoints;
+    RCC_DVFSNbPoints = 4;
+  }
+
+  RCC_DVFSVoltageRange = VoltageRange;
+  RCC_DVFSCurrent = 0;
+  RCC_DVFSDownCount = 0;
+  RCC_DVFSNbCallbacks = 0;
+}
+
+/**
+  * @brief  Registers a function called after each change of operating point.
+  * @param  Callback: the function.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the function is registered
+  *          - ERROR: RCC_DVFS_MAX_CALLBACKS functions are already registered
+  */
+ErrorStatus RCC_DVFSRegisterCallback(RCC_DVFSCallback Callback)
+{
+  if (RCC_DVFSNbCallbacks == RCC_DVFS_MAX_CALLBACKS)
+  {
+    return ERROR;
+  }
+
+  RCC_DVFSCallbacks[RCC_DVFSNbCallbacks++] = Callback;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Changes the operating point.
+  * @param  Point: the new operating point.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the operating point is in use
+  *          - ERROR: the HSE or the PLL did not start: the system clock is
+  *            the HSE or the clock in use before
+  */
+ErrorStatus RCC_DVFSSetOperatingPoint(const RCC_OperatingPointTypeDef* Point)
+{
+  ErrorStatus status = SUCCESS;
+  RCC_ClocksTypeDef clocks;
+  uint32_t pllcfgr = 0, n = 0;
+  uint8_t increase = 0;
+
+  /* Check the parameters */
+  assert_param(IS_RCC_HCLK(Point->AHBPrescaler));
+  assert_param(IS_RCC_PCLK(Point->APB1Prescaler));
+  assert_param(IS_RCC_PCLK(Point->APB2Prescaler));
+  assert_param(IS_PWR_REGULATOR_VOLTAGE(Point->RegulatorVoltage));
+
+  RCC_GetClocksFreq(&clocks);
+  increase = (uint8_t)(Point->HCLK_Frequency > clocks.HCLK_Frequency);
+
+  /* The latency is increased before HCLK */
+  if (increase != 0)
+  {
+    FLASH_AccessConfig(Point->HCLK_Frequency, RCC_DVFSVoltageRange);
+  }
+
+  pllcfgr = Point->PLLM | (Point->PLLN << 6) | (((Point->PLLP >> 1) - 1) << 16) |
+            RCC_PLLSource_HSE | (Point->PLLQ << 24);
+  if ((RCC_GetSYSCLKSource() == RCC_DVFS_SWS_PLL) &&
+      ((RCC->PLLCFGR & RCC_DVFS_PLLCFGR_MASK) == pllcfgr) &&
+      ((PWR->CR & PWR_Regulator_Voltage_Scale1) == Point->RegulatorVoltage))
+  {
+    RCC_DVFSSetPrescalers(Point, increase);
+  }
+  else
+  {
+    status = RCC_DVFSRelock(Point);
+  }
+
+  /* The latency is decreased after HCLK */
+  RCC_GetClocksFreq(&clocks);
+  FLASH_AccessConfig(clocks.HCLK_Frequency, RCC_DVFSVoltageRange);
+  SystemCoreClockUpdate();
+
+  RCC_DVFSCurrent = (status == SUCCESS) ? Point : 0;
+  for (n = 0; n < RCC_DVFSNbCallbacks; n++)
+  {
+    RCC_DVFSCallbacks[n](&clocks);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Returns the operating point in use.
+  * @param  None
+  * @retval The operating point, or 0 before the first change of operating
+  *         point or after an error.
+  */
+const RCC_OperatingPointTypeDef* RCC_DVFSGetOperatingPoint(void)
+{
+  return RCC_DVFSCurrent;
+}
+
+/**
+  * @brief  Reports the CPU load, and changes the operating point when it is
+  *         too high or too low for the load.
+  * @param  Load: the CPU load in percent of the time at the current operating
+  *         point, between 0 and 100.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the operating point is the one of the load
+  *          - ERROR: the change of operating point failed
+  */
+ErrorStatus RCC_DVFSUpdateLoad(uint8_t Load)
+{
+  const RCC_OperatingPointTypeDef* point = 0;
+  uint32_t hclk = SystemCoreClock;
+  uint32_t needed = 0, n = 0;
+
+  /* Check the parameters */
+  assert_param(Load <= 100);
+
+  if (RCC_DVFSCurrent != 0)
+  {
+    hclk = RCC_DVFSCurrent->HCLK_Frequency;
+  }
+  needed = (hclk / RCC_DVFS_TARGET_LOAD) * Load;
+
+  /* The slowest operating point which runs the load */
+  for (n = 0; (n < RCC_DVFSNbPoints - 1) && (RCC_DVFSPoints[n]->HCLK_Frequency < needed); n++)
+  {
+  }
+  point = RCC_DVFSPoints[n];
+
+  if (point->HCLK_Frequency > hclk)
+  {
+    RCC_DVFSDownCount = 0;
+    return RCC_DVFSSetOperatingPoint(point);
+  }
+
+  if (point->HCLK_Frequency < hclk)
+  {
+    if (++RCC_DVFSDownCount >= RCC_DVFS_DOWN_DELAY)
+    {
+      RCC_DVFSDownCount = 0;
+      return RCC_DVFSSetOperatingPoint(point);
+    }
+  }
+  else
+  {
+    RCC_DVFSDownCount = 0;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Sets the AHB and APB prescalers of an operating point, keeping the
+  *         APB clocks within their limits.
+  * @param  Point: the operating point.
+  * @param  Increase: 1 when HCLK increases, 0 else.
+  * @retval None
+  */
+static void RCC_DVFSSetPrescalers(const RCC_OperatingPointTypeDef* Point, uint8_t Increase)
+{
+  if (Increase != 0)
+  {
+    RCC_PCLK1Config(Point->APB1Prescaler);
+    RCC_PCLK2Config(Point->APB2Prescaler);
+    RCC_HCLKConfig(Point->AHBPrescaler);
+  }
+  else
+  {
+    RCC_HCLKConfig(Point->AHBPrescaler);
+    RCC_PCLK1Config(Point->APB1Prescaler);
+    RCC_PCLK2Config(Point->APB2Prescaler);
+  }
+}
+
+/**
+  * @brief  Configures and starts the PLL and the regulator voltage scale of an
+  *         operating point, running from the HSE meanwhile.
+  * @param  Point: the operating point.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the system clock is the PLL
+  *          - ERROR: the HSE or the PLL did not start
+  */
+static ErrorStatus RCC_DVFSRelock(const RCC_OperatingPointTypeDef* Point)
+{
+  uint32_t timeout = 0;
+
+  RCC_HSEConfig(RCC_HSE_ON);
+  if (RCC_WaitForHSEStartUp() != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  RCC_SYSCLKConfig(RCC_SYSCLKSource_HSE);
+  while (RCC_GetSYSCLKSource() != RCC_DVFS_SWS_HSE)
+  {
+  }
+
+  RCC_PLLCmd(DISABLE);
+  while (RCC_GetFlagStatus(RCC_FLAG_PLLRDY) != RESET)
+  {
+  }
+
+  /* The regulator voltage scale is changed while the PLL is off */
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+  PWR_MainRegulatorModeConfig(Point->RegulatorVoltage);
+
+  RCC_PLLConfig(RCC_PLLSource_HSE, Point->PLLM, Point->PLLN, Point->PLLP, Point->PLLQ);
+  RCC_PLLCmd(ENABLE);
+  for (timeout = 0; (RCC_GetFlagStatus(RCC_FLAG_PLLRDY) == RESET) && (timeout < RCC_DVFS_TIMEOUT); timeout++)
+  {
+  }
+  for (; (PWR_GetFlagStatus(PWR_FLAG_VOSRDY) == RESET) && (timeout < RCC_DVFS_TIMEOUT); timeout++)
+  {
+  }
+  if (timeout == RCC_DVFS_TIMEOUT)
+  {
+    return ERROR;
+  }
+
+  /* HCLK is at most the HSE frequency until the switch to the PLL */
+  RCC_HCLKConfig(Point->AHBPrescaler);
+  RCC_PCLK1Config(Point->APB1Prescaler);
+  RCC_PCLK2Config(Point->APB2Prescaler);
+
+  RCC_SYSCLKConfig(RCC_SYSCLKSource_PLLCLK);
+  while (RCC_GetSYSCLKSource() != RCC_DVFS_SWS_PLL)
+  {
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,392 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_rng_drbg.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a CTR_DRBG (NIST SP 800-90A) with AES-128 or
+  *          AES-256, computed by the CRYP and seeded by the RNG entropy pool,
+  *          for high rate random output.
+  *          It uses the stm32f4xx_cryp_stream.c/.h and stm32f4xx_rng_pool.c/.h
+  *          drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Start the entropy pool using RNG_PoolInit() and the CRYP
+  *             streaming engine using CRYP_StreamInit().
+  *
+  *          2. Instantiate the DRBG using RNG_DRBGInit(), with an optional
+  *             personalization string. It takes 32 bytes (AES-128) or 48
+  *             bytes (AES-256) from the pool: it fails when the pool does not
+  *             hold them yet.
+  *
+  *          3. Get random bytes using RNG_DRBGGenerate(). The DRBG reseeds
+  *             itself from the pool every RNG_DRBG_RESEED_INTERVAL requests,
+  *             and RNG_DRBGReseed() reseeds it at once.
+  *
+  *          4. Erase the state of the DRBG using RNG_DRBGDeInit().
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_rng_drbg.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup RNG
+  * @brief RNG driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define RNG_DRBG_STAGE      ((uint32_t)64)  /* Bytes of the staging buffer */
+
+/* Private macro -------------------------------------------------------------*/
+#define RNG_DRBG_ALIGN(BUFFER)   ((uint32_t*)(((uint32_t)(BUFFER) + 15) & ~(uint32_t)15))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static ErrorStatus RNG_DRBGBlocks(RNG_DRBGTypeDef* DRBG, uint32_t* Output, uint32_t Length);
+static ErrorStatus RNG_DRBGUpdate(RNG_DRBGTypeDef* DRBG, const uint8_t* Provided);
+static ErrorStatus RNG_DRBGSeed(RNG_DRBGTypeDef* DRBG, const uint8_t* Input, uint32_t Length);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup RNG_Private_Functions
+  * @{
+  */
+
+/** @defgroup RNG_Group5 CTR_DRBG functions
+ *  @brief   CTR_DRBG functions
+ *
+@verbatim
+ ===============================================================================
+                              CTR_DRBG functions
+ ===============================================================================
+
+  The DRBG is the CTR_DRBG of NIST SP 800-90A without derivation function:
+  the seed material is the entropy input from the pool, XORed with the
+  personalization string or the additional input. The RNG words are used as
+  full entropy input.
+
+  The output blocks E(K, V+1), E(K, V+2)... are the AES-CTR encryption of
+  zero blocks with the counter block V+1, computed by DMA from and to the
+  output buffer when it is aligned on 16 bytes. The CRYP increments the 32
+  least significant bits of the counter block: the counter field of the DRBG
+  is 32 bits long (ctr_len = 32).
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Instantiates a DRBG.
+  * @param  DRBG: pointer to the RNG_DRBGTypeDef structure of the DRBG.
+  * @param  Stream: the CRYP streaming engine.
+  * @param  KeySize: length of the AES key in bits, 128 or 256.
+  * @param  Personalization: the personalization string, or 0.
+  * @param  Length: length of the personalization string, up to 32 bytes for
+  *         AES-128 and 48 bytes for AES-256.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the DRBG is instantiated
+  *          - ERROR: the pool lacks entropy, or the CRYP failed
+  */
+ErrorStatus RNG_DRBGInit(RNG_DRBGTypeDef* DRBG, CRYP_StreamTypeDef* Stream, uint16_t KeySize,
+                         const uint8_t* Personalization, uint32_t Length)
+{
+  uint32_t i = 0;
+
+  /* Check the parameters */
+  assert_param(IS_RNG_DRBG_KEYSIZE(KeySize));
+
+  DRBG->Stream = Stream;
+  DRBG->KeySize = KeySize;
+  for (i = 0; i < 8; i++)
+  {
+    DRBG->Key[i] = 0;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    DRBG->V[i] = 0;
+  }
+
+  return RNG_DRBGSeed(DRBG, Personalization, Length);
+}
+
+/**
+  * @brief  Reseeds a DRBG with entropy from the pool.
+  * @param  DRBG: pointer to the RNG_DRBGTypeDef structure of the DRBG.
+  * @param  AdditionalInput: the additional input, or 0.
+  * @param  Length: length of the additional input, up to 32 bytes for
+  *         AES-128 and 48 bytes for AES-256.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the DRBG is reseeded
+  *          - ERROR: the pool lacks entropy, or the CRYP failed
+  */
+ErrorStatus RNG_DRBGReseed(RNG_DRBGTypeDef* DRBG, const uint8_t* AdditionalInput, uint32_t Length)
+{
+  return RNG_DRBGSeed(DRBG, AdditionalInput, Length);
+}
+
+/**
+  * @brief  Generates random bytes.
+  * @param  DRBG: pointer to the RNG_DRBGTypeDef structure of the DRBG.
+  * @param  Output: pointer to the buffer of the random bytes. When it is
+  *         aligned on 16 bytes, the CRYP writes its blocks directly.
+  * @param  Length: number of bytes, up to RNG_DRBG_MAX_REQUEST.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the bytes are generated
+  *          - ERROR: the reseed or the CRYP failed
+  */
+ErrorStatus RNG_DRBGGenerate(RNG_DRBGTypeDef* DRBG, uint8_t* Output, uint32_t Length)
+{
+  uint32_t* stage = RNG_DRBG_ALIGN(DRBG->Buffer);
+  uint32_t done = 0, chunk = 0, i = 0;
+
+  if (Length > RNG_DRBG_MAX_REQUEST)
+  {
+    return ERROR;
+  }
+
+  if ((DRBG->ReseedCounter > RNG_DRBG_RESEED_INTERVAL) &&
+      (RNG_DRBGSeed(DRBG, 0, 0) != SUCCESS))
+  {
+    return ERROR;
+  }
+
+  /* Whole blocks straight to an aligned output */
+  if (((uint32_t)Output & 0xF) == 0)
+  {
+    done = Length & ~(uint32_t)0xF;
+    if ((done != 0) && (RNG_DRBGBlocks(DRBG, (uint32_t*)Output, done) != SUCCESS))
+    {
+      return ERROR;
+    }
+  }
+
+  /* The other bytes through the staging buffer */
+  while (done < Length)
+  {
+    chunk = ((Length - done) > RNG_DRBG_STAGE) ? RNG_DRBG_STAGE : ((Length - done + 15) & ~(uint32_t)0xF);
+    if (RNG_DRBGBlocks(DRBG, stage, chunk) != SUCCESS)
+    {
+      return ERROR;
+    }
+    for (i = 0; (i < chunk) && (done < Length); i++)
+    {
+      Output[done++] = ((uint8_t*)stage)[i];
+    }
+  }
+
+  /* Backtracking resistance: new K and V */
+  if (RNG_DRBGUpdate(DRBG, 0) != SUCCESS)
+  {
+    return ERROR;
+  }
+  DRBG->ReseedCounter++;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Erases the state of a DRBG.
+  * @param  DRBG: pointer to the RNG_DRBGTypeDef structure of the DRBG.
+  * @retval None
+  */
+void RNG_DRBGDeInit(RNG_DRBGTypeDef* DRBG)
+{
+  uint32_t i = 0;
+
+  for (i = 0; i < 8; i++)
+  {
+    DRBG->Key[i] = 0;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    DRBG->V[i] = 0;
+  }
+  for (i = 0; i < 20; i++)
+  {
+    DRBG->Buffer[i] = 0;
+  }
+  DRBG->ReseedCounter = RNG_DRBG_RESEED_INTERVAL + 1;
+}
+
+/**
+  * @brief  Computes the output blocks E(K, V+1), E(K, V+2)... and advances V.
+  * @param  DRBG: pointer to the RNG_DRBGTypeDef structure of the DRBG.
+  * @param  Output: the output, aligned on 16 bytes.
+  * @param  Length: the length, a multiple of 16.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the blocks are written
+  *          - ERROR: the CRYP failed
+  */
+static ErrorStatus RNG_DRBGBlocks(RNG_DRBGTypeDef* DRBG, uint32_t* Output, uint32_t Length)
+{
+  CRYP_StreamSessionInitTypeDef CRYP_StreamSessionInitStructure;
+  CRYP_StreamJobTypeDef* job = &DRBG->Job;
+  uint32_t counter[4];
+  uint32_t i = 0;
+
+  /* The counter block of the first output block is V+1 */
+  counter[0] = DRBG->V[0];
+  counter[1] = DRBG->V[1];
+  counter[2] = DRBG->V[2];
+  counter[3] = __REV(__REV(DRBG->V[3]) + 1);
+  DRBG->V[3] = __REV(__REV(DRBG->V[3]) + (Length / 16));
+
+  CRYP_StreamSessionInitStructure.CRYP_AlgoDir = CRYP_AlgoDir_Encrypt;
+  CRYP_StreamSessionInitStructure.CRYP_AlgoMode = CRYP_AlgoMode_AES_CTR;
+  CRYP_StreamSessionInitStructure.CRYP_DataType = CRYP_DataType_8b;
+  CRYP_StreamSessionInitStructure.KeySize = DRBG->KeySize;
+  CRYP_StreamSessionInitStructure.Key = (uint8_t*)DRBG->Key;
+  CRYP_StreamSessionInitStructure.IV = (uint8_t*)counter;
+  if (CRYP_StreamSessionInit(DRBG->Stream, &DRBG->Session, &CRYP_StreamSessionInitStructure) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* The keystream is the encryption of zero blocks */
+  for (i = 0; i < (Length / 4); i++)
+  {
+    Output[i] = 0;
+  }
+  job->Session = &DRBG->Session;
+  job->pInput = Output;
+  job->pOutput = Output;
+  job->Length = Length;
+  job->Callback = 0;
+  if (CRYP_StreamSubmit(DRBG->Stream, job) != SUCCESS)
+  {
+    return ERROR;
+  }
+  while ((job->Status == CRYP_STREAM_JOB_QUEUED) || (job->Status == CRYP_STREAM_JOB_ACTIVE))
+  {
+  }
+
+  return (job->Status == CRYP_STREAM_JOB_DONE) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Updates K and V with the provided data (CTR_DRBG_Update).
+  * @param  DRBG: pointer to the RNG_DRBGTypeDef structure of the DRBG.
+  * @param  Provided: the seedlen bytes of provided data, or 0 for zeros.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: K and V are updated
+  *          - ERROR: the CRYP failed
+  */
+static ErrorStatus RNG_DRBGUpdate(RNG_DRBGTypeDef* DRBG, const uint8_t* Provided)
+{
+  uint32_t* temp = RNG_DRBG_ALIGN(DRBG->Buffer);
+  uint32_t keywords = DRBG->KeySize / 32;
+  uint32_t seedlen = (DRBG->KeySize / 8) + 16;
+  uint32_t i = 0;
+
+  if (RNG_DRBGBlocks(DRBG, temp, seedlen) != SUCCESS)
+  {
+    return ERROR;
+  }
+  if (Provided != 0)
+  {
+    for (i = 0; i < seedlen; i++)
+    {
+      ((uint8_t*)temp)[i] ^= Provided[i];
+    }
+  }
+
+  /* K = leftmost keylen bits, V = rightmost 128 bits */
+  for (i = 0; i < keywords; i++)
+  {
+    DRBG->Key[i] = temp[i];
+    temp[i] = 0;
+  }
+  for (i = 0; i < 4; i++)
+  {
+    DRBG->V[i] = temp[keywords + i];
+    temp[keywords + i] = 0;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Seeds a DRBG with entropy from the pool XORed with an input.
+  * @param  DRBG: pointer to the RNG_DRBGTypeDef structure of the DRBG.
+  * @param  Input: the personalization string or additional input, or 0.
+  * @param  Length: length of Input, up to seedlen.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the DRBG is seeded
+  *          - ERROR: the pool lacks entropy, or the CRYP failed
+  */
+static ErrorStatus RNG_DRBGSeed(RNG_DRBGTypeDef* DRBG, const uint8_t* Input, uint32_t Length)
+{
+  uint8_t seed[48];
+  uint32_t seedlen = (DRBG->KeySize / 8) + 16;
+  ErrorStatus status = ERROR;
+  uint32_t i = 0;
+
+  if (((Input == 0) || (Length <= seedlen)) &&
+      (RNG_PoolAvailable() >= seedlen) && (RNG_Read(seed, seedlen) == seedlen))
+  {
+    for (i = 0; (Input != 0) && (i < Length); i++)
+    {
+      seed[i] ^= Input[i];
+    }
+    status = RNG_DRBGUpdate(DRBG, seed);
+    if (status == SUCCESS)
+    {
+      DRBG->ReseedCounter = 1;
+    }
+
+    for (i = 0; i < seedlen; i++)
+    {
+      seed[i] = 0;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
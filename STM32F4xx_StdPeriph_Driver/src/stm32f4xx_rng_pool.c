@@ -0,0 +1,301 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_rng_pool.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides an entropy pool on top of the RNG:
+  *           - Ring buffer of random words filled from the RNG interrupt
+  *           - Seed error recovery and clock error accounting
+  *           - Non-blocking batch read of random bytes
+  *          It uses the stm32f4xx_rng.c/.h drivers to access the RNG.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable The RNG controller clock using
+  *             RCC_AHB2PeriphClockCmd(RCC_AHB2Periph_RNG, ENABLE); function,
+  *             with the 48 MHz PLL output (PLL48CLK) configured.
+  *
+  *          2. Call RNG_PoolInit() with the buffer of the pool, and call
+  *             RNG_PoolIRQHandler() from HASH_RNG_IRQHandler().
+  *
+  *          3. Get random bytes using RNG_Read(): it copies the bytes which
+  *             are in the pool and returns at once. RNG_PoolAvailable() gives
+  *             the number of bytes in the pool.
+  *
+  *          4. Check the errors of the RNG using RNG_PoolGetErrors().
+  *
+  * @note   The RNG interrupt is disabled while the pool is full, and enabled
+  *         again by RNG_Read().
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_rng_pool.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup RNG
+  * @brief RNG driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Ring buffer of the pool: Head is written by the interrupt, Tail by RNG_Read() */
+static uint32_t* RNG_PoolBuffer = 0;
+static uint32_t RNG_PoolSize = 0;
+static __IO uint32_t RNG_PoolHead = 0;
+static __IO uint32_t RNG_PoolTail = 0;
+
+/* Last word read from the RNG, and whether it is valid */
+static uint32_t RNG_PoolLast = 0;
+static uint8_t RNG_PoolPrimed = 0;
+
+/* Error counters, indexed by RNG_POOL_ERROR_xxx */
+static __IO uint32_t RNG_PoolErrors[3];
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup RNG_Private_Functions
+  * @{
+  */
+
+/** @defgroup RNG_Group4 Entropy pool functions
+ *  @brief   Entropy pool functions
+ *
+@verbatim
+ ===============================================================================
+                          Entropy pool functions
+ ===============================================================================
+
+  The RNG computes a 32-bit word every 40 periods of PLL48CLK. The pool reads
+  the words from the RNG interrupt into a ring buffer, so that the
+  application gets random bytes without waiting for the DRDY flag.
+
+  The words are checked as they are read:
+    - The first word after the RNG is enabled is not used, but kept to be
+      compared with the next word.
+    - A word equal to the previous word is not used (continuous test).
+    - On a seed error, the word in RNG_DR is not used: the SEIS flag is
+      cleared and the RNG is disabled and enabled to restart it.
+    - A clock error is counted: the words computed before it are valid.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Starts the entropy pool.
+  * @param  Buffer: the ring buffer of the pool.
+  * @param  Size: the number of words of Buffer, at least 2. The pool holds
+  *         up to Size - 1 words.
+  * @retval None
+  */
+void RNG_PoolInit(uint32_t* Buffer, uint32_t Size)
+{
+  /* Check the parameters */
+  assert_param(Size >= 2);
+
+  RNG_ITConfig(DISABLE);
+
+  RNG_PoolBuffer = Buffer;
+  RNG_PoolSize = Size;
+  RNG_PoolHead = 0;
+  RNG_PoolTail = 0;
+  RNG_PoolPrimed = 0;
+  RNG_PoolErrors[RNG_POOL_ERROR_SEED] = 0;
+  RNG_PoolErrors[RNG_POOL_ERROR_CLOCK] = 0;
+  RNG_PoolErrors[RNG_POOL_ERROR_REPEAT] = 0;
+
+  RNG_ClearITPendingBit(RNG_IT_CEI | RNG_IT_SEI);
+  RNG_Cmd(ENABLE);
+  RNG_ITConfig(ENABLE);
+  NVIC_EnableIRQ(HASH_RNG_IRQn);
+}
+
+/**
+  * @brief  Stops the entropy pool and the RNG.
+  * @param  None
+  * @retval None
+  */
+void RNG_PoolDeInit(void)
+{
+  RNG_ITConfig(DISABLE);
+  RNG_Cmd(DISABLE);
+
+  RNG_PoolHead = 0;
+  RNG_PoolTail = 0;
+  RNG_PoolPrimed = 0;
+}
+
+/**
+  * @brief  Copies random bytes from the pool, without waiting.
+  * @param  Buffer: pointer to the buffer of the random bytes.
+  * @param  Length: number of bytes to copy.
+  * @retval The number of bytes copied, up to Length.
+  */
+uint32_t RNG_Read(uint8_t* Buffer, uint32_t Length)
+{
+  uint32_t tail = RNG_PoolTail;
+  uint32_t count = 0, word = 0, i = 0;
+  uint32_t primask = 0;
+
+  while ((count < Length) && (tail != RNG_PoolHead))
+  {
+    word = RNG_PoolBuffer[tail];
+    for (i = 0; (i < 4) && (count < Length); i++)
+    {
+      Buffer[count++] = (uint8_t)word;
+      word >>= 8;
+    }
+    tail = (tail + 1 == RNG_PoolSize) ? 0 : tail + 1;
+  }
+
+  if (tail != RNG_PoolTail)
+  {
+    RNG_PoolTail = tail;
+
+    /* The interrupt stops when the pool is full; RNG_CR is also written by
+       the interrupt handler on seed errors */
+    primask = NVIC_EnterCritical();
+    RNG_ITConfig(ENABLE);
+    NVIC_ExitCritical(primask);
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Returns the number of random bytes in the pool.
+  * @param  None
+  * @retval The number of bytes
+  */
+uint32_t RNG_PoolAvailable(void)
+{
+  uint32_t head = RNG_PoolHead;
+  uint32_t tail = RNG_PoolTail;
+
+  return 4 * ((head >= tail) ? (head - tail) : (head + RNG_PoolSize - tail));
+}
+
+/**
+  * @brief  Returns the number of errors of the RNG since RNG_PoolInit().
+  * @param  RNG_POOL_ERROR: the error to count.
+  *          This parameter can be one of the following values:
+  *            @arg RNG_POOL_ERROR_SEED: seed errors
+  *            @arg RNG_POOL_ERROR_CLOCK: clock errors
+  *            @arg RNG_POOL_ERROR_REPEAT: words equal to the previous word
+  * @retval The number of errors
+  */
+uint32_t RNG_PoolGetErrors(uint8_t RNG_POOL_ERROR)
+{
+  /* Check the parameters */
+  assert_param(IS_RNG_POOL_ERROR(RNG_POOL_ERROR));
+
+  return RNG_PoolErrors[RNG_POOL_ERROR];
+}
+
+/**
+  * @brief  Handles the RNG interrupt: reads the random word in the pool and
+  *         handles the seed and clock errors.
+  * @param  None
+  * @note   This function must be called from HASH_RNG_IRQHandler().
+  * @retval None
+  */
+void RNG_PoolIRQHandler(void)
+{
+  uint32_t data = 0, next = 0;
+
+  if (RNG_GetITStatus(RNG_IT_SEI) != RESET)
+  {
+    /* The word in RNG_DR may lack entropy: restart the RNG */
+    RNG_ClearITPendingBit(RNG_IT_SEI);
+    RNG_Cmd(DISABLE);
+    RNG_Cmd(ENABLE);
+    RNG_PoolPrimed = 0;
+    RNG_PoolErrors[RNG_POOL_ERROR_SEED]++;
+    return;
+  }
+
+  if (RNG_GetITStatus(RNG_IT_CEI) != RESET)
+  {
+    RNG_ClearITPendingBit(RNG_IT_CEI);
+    RNG_PoolErrors[RNG_POOL_ERROR_CLOCK]++;
+  }
+
+  if (RNG_GetFlagStatus(RNG_FLAG_DRDY) != RESET)
+  {
+    data = RNG_GetRandomNumber();
+
+    if ((RNG_PoolPrimed != 0) && (data != RNG_PoolLast))
+    {
+      next = (RNG_PoolHead + 1 == RNG_PoolSize) ? 0 : RNG_PoolHead + 1;
+      if (next != RNG_PoolTail)
+      {
+        RNG_PoolBuffer[RNG_PoolHead] = data;
+        RNG_PoolHead = next;
+      }
+      else
+      {
+        /* The pool is full: stop until RNG_Read() */
+        RNG_ITConfig(DISABLE);
+      }
+    }
+    else if (RNG_PoolPrimed != 0)
+    {
+      RNG_PoolErrors[RNG_POOL_ERROR_REPEAT]++;
+    }
+
+    RNG_PoolLast = data;
+    RNG_PoolPrimed = 1;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
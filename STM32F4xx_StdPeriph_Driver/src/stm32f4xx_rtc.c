@@ -20,6 +20,7 @@
   *           - Shift control synchronisation    
   *           - RTC Tamper and TimeStamp Pins Selection and Output Type Config configuration
   *           - Interrupts and flags management
+  *           - Epoch time for time stamping
   *
   *  @verbatim
   *
@@ -309,9 +310,38 @@
 #define SYNCHRO_TIMEOUT          ((uint32_t) 0x00020000)
 #define RECALPF_TIMEOUT          ((uint32_t) 0x00020000)
 #define SHPF_TIMEOUT             ((uint32_t) 0x00001000)
+#define EPOCH_TIMEOUT            ((uint32_t) 0x00100000)
+
+/* DWT cycle counter (not described by the CMSIS core header) */
+#define RTC_DWT_CTRL             (*(__IO uint32_t *)0xE0001000)
+#define RTC_DWT_CYCCNT           (*(__IO uint32_t *)0xE0001004)
+#define RTC_DWT_CYCCNTENA        ((uint32_t)0x00000001)
+
+/* Days from 1970-01-01 to 2000-01-01, the year 00 of the calendar */
+#define RTC_EPOCH_DAYS_2000      ((uint32_t)10957)
 
 /* Private macro -------------------------------------------------------------*/
+
+/* Two BCD digits to binary, without the range checks of RTC_Bcd2ToByte() */
+#define RTC_BCD2BIN(BCD)         ((((BCD) >> 4) * 10) + ((BCD) & 0x0F))
+
 /* Private variables ---------------------------------------------------------*/
+
+/* Days before each month of a common year */
+static const uint16_t RTC_MonthDays[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+/* Epoch time state: date register and its days since 1970, fraction of
+   second per sub second tick, fraction per HCLK cycle (16.16), and the
+   anchor of the interpolation between two RTC ticks */
+static uint32_t RTC_EpochDR = 0xFFFFFFFF;
+static uint32_t RTC_EpochDays;
+static uint32_t RTC_EpochPrediv;
+static uint32_t RTC_EpochTick;
+static uint32_t RTC_EpochCycle;
+static uint32_t RTC_EpochHclk;
+static uint64_t RTC_EpochAnchor;
+static uint32_t RTC_EpochAnchorCyc;
+static uint64_t RTC_EpochLast;
 /* Private function prototypes -----------------------------------------------*/
 static uint8_t RTC_ByteToBcd2(uint8_t Value);
 static uint8_t RTC_Bcd2ToByte(uint8_t Value);
@@ -2710,6 +2740,187 @@ void RTC_ClearITPendingBit(uint32_t RTC_IT)
   RTC->ISR = (uint32_t)((uint32_t)(~((tmpreg | RTC_ISR_INIT)& 0x0000FFFF) | (uint32_t)(RTC->ISR & RTC_ISR_INIT))); 
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup RTC_Group14 Epoch time functions
+ *  @brief   Epoch time functions
+ *
+@verbatim
+ ===============================================================================
+                             Epoch time functions
+ ===============================================================================
+
+  RTC_GetEpoch() returns the calendar as a 64-bit epoch time: the seconds
+  since 1970-01-01 00:00:00 in the high word, and the binary fraction of the
+  second from the sub second register in the low word. The calendar must
+  be in 24-hour or 12-hour format, with the year 00 being 2000.
+
+  The shadow registers are bypassed, so that no RTC_WaitForSynchro() is
+  needed: the sub second, time and date registers are read until two reads
+  give the same values, and the date is converted only when it changes.
+  RTC_GetTime() and RTC_GetDate() then read the running counters: call
+  RTC_BypassShadowCmd(DISABLE) before using them again.
+
+  The resolution of RTC_GetEpoch() is one sub second tick, 1/(PREDIV_S + 1)
+  second (1/256 s with the LSE and the default prescalers). RTC_GetEpochFine()
+  interpolates between the ticks with the DWT cycle counter: the time is the
+  time of an anchor plus the cycles elapsed since, kept within the current
+  RTC tick and never going backward. The anchor is moved every quarter of
+  second, so that the HCLK accuracy does not matter, and the function must be
+  called at least once every 2^32 HCLK cycles (25 s at 168 MHz) to stay
+  interpolated.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Enables the bypass of the shadow registers and the DWT cycle
+  *         counter, and anchors the interpolation of RTC_GetEpochFine() on
+  *         the next RTC tick.
+  * @note   Call it again after RTC_Init() or a change of the HCLK frequency.
+  * @param  HCLK_Frequency: HCLK frequency in Hz.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the calendar runs and the anchor is taken
+  *          - ERROR: the calendar is not initialized, or does not run
+  */
+ErrorStatus RTC_EpochInit(uint32_t HCLK_Frequency)
+{
+  __IO uint32_t timeout = 0;
+  uint32_t ssr;
+
+  if (((RTC->ISR & RTC_ISR_INITS) == 0) || (HCLK_Frequency == 0))
+  {
+    return ERROR;
+  }
+
+  RTC_BypassShadowCmd(ENABLE);
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  RTC_DWT_CTRL |= RTC_DWT_CYCCNTENA;
+
+  RTC_EpochDR = 0xFFFFFFFF;
+  RTC_EpochPrediv = RTC->PRER & RTC_PRER_PREDIV_S;
+  RTC_EpochTick = (uint32_t)(((uint64_t)1 << 32) / (RTC_EpochPrediv + 1));
+  RTC_EpochCycle = (uint32_t)(((uint64_t)1 << 48) / HCLK_Frequency);
+  RTC_EpochHclk = HCLK_Frequency;
+
+  /* Wait for the next sub second tick */
+  ssr = RTC->SSR;
+  while ((RTC->SSR == ssr) && (timeout++ != EPOCH_TIMEOUT))
+  {
+  }
+  if (timeout >= EPOCH_TIMEOUT)
+  {
+    return ERROR;
+  }
+
+  RTC_EpochAnchorCyc = RTC_DWT_CYCCNT;
+  RTC_EpochAnchor = RTC_GetEpoch();
+  RTC_EpochLast = RTC_EpochAnchor;
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the calendar as an epoch time, with the resolution of the
+  *         sub second register.
+  * @note   RTC_EpochInit() must have been called.
+  * @param  None
+  * @retval Seconds since 1970-01-01 in the high word, fraction of second in
+  *         the low word: see RTC_EPOCH_SECONDS() and RTC_EPOCH_FRACTION()
+  */
+uint64_t RTC_GetEpoch(void)
+{
+  uint32_t ssr, tr, dr;
+  uint32_t year, month, days, hours, seconds, fraction = 0;
+
+  do
+  {
+    ssr = RTC->SSR;
+    tr = RTC->TR;
+    dr = RTC->DR;
+  }
+  while ((ssr != RTC->SSR) || (tr != RTC->TR) || (dr != RTC->DR));
+
+  if (dr != RTC_EpochDR)
+  {
+    year = RTC_BCD2BIN((dr & (RTC_DR_YT | RTC_DR_YU)) >> 16);
+    month = RTC_BCD2BIN((dr & (RTC_DR_MT | RTC_DR_MU)) >> 8);
+    days = (year * 365) + ((year + 3) / 4) + RTC_MonthDays[(month - 1) % 12] +
+           RTC_BCD2BIN(dr & (RTC_DR_DT | RTC_DR_DU)) - 1;
+    if (((year & 0x3) == 0) && (month > 2))
+    {
+      days++;
+    }
+    RTC_EpochDays = RTC_EPOCH_DAYS_2000 + days;
+    RTC_EpochDR = dr;
+  }
+
+  hours = RTC_BCD2BIN((tr & (RTC_TR_HT | RTC_TR_HU)) >> 16);
+  if ((RTC->CR & RTC_CR_FMT) != 0)
+  {
+    hours = (hours % 12) + (((tr & RTC_TR_PM) != 0) ? 12 : 0);
+  }
+  seconds = (((RTC_EpochDays * 24) + hours) * 3600) +
+            (RTC_BCD2BIN((tr & (RTC_TR_MNT | RTC_TR_MNU)) >> 8) * 60) +
+            RTC_BCD2BIN(tr & (RTC_TR_ST | RTC_TR_SU));
+
+  /* The sub second counter counts down from PREDIV_S; above PREDIV_S after
+     a shift operation, the second is not complete yet */
+  if (ssr <= RTC_EpochPrediv)
+  {
+    fraction = (RTC_EpochPrediv - ssr) * RTC_EpochTick;
+  }
+  return ((uint64_t)seconds << 32) | fraction;
+}
+
+/**
+  * @brief  Returns the calendar as an epoch time interpolated with the DWT
+  *         cycle counter between the RTC ticks.
+  * @note   RTC_EpochInit() must have been called. The function may be called
+  *         from the interrupt handlers.
+  * @param  None
+  * @retval Seconds since 1970-01-01 in the high word, fraction of second in
+  *         the low word
+  */
+uint64_t RTC_GetEpochFine(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t cycles;
+  uint64_t coarse;
+  uint64_t fine;
+
+  __disable_irq();
+  cycles = RTC_DWT_CYCCNT;
+  coarse = RTC_GetEpoch();
+  cycles -= RTC_EpochAnchorCyc;
+
+  fine = RTC_EpochAnchor + (((uint64_t)cycles * RTC_EpochCycle) >> 16);
+  if (fine < coarse)
+  {
+    fine = coarse;
+  }
+  else if (fine >= (coarse + RTC_EpochTick))
+  {
+    fine = coarse + RTC_EpochTick - 1;
+  }
+  if (fine < RTC_EpochLast)
+  {
+    fine = RTC_EpochLast;
+  }
+  RTC_EpochLast = fine;
+
+  if (cycles > (RTC_EpochHclk / 4))
+  {
+    RTC_EpochAnchor = fine;
+    RTC_EpochAnchorCyc += cycles;
+  }
+  __set_PRIMASK(primask);
+
+  return fine;
+}
+
 /**
   * @}
   */
@@ -0,0 +1,1077 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_sdio_sd.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a block driver for the SD and MMC cards on top of
+  *          the SDIO driver:
+  *           - Identification of SDSC, SDHC/SDXC, MMC and high capacity MMC cards
+  *           - 4-bit bus and high speed (48 MHz) switching
+  *           - Single and multiple block transfers (CMD17/18, CMD24/25) by DMA,
+  *             with the pre-erase hint (ACMD23) before the SD multiple block writes
+  *           - Asynchronous transfers with a completion callback
+  *          It uses the stm32f4xx_sdio.c/.h and stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the SDIO, DMA2 and GPIO clocks, configure the SDIO pins
+  *             (CK, CMD and D0 to D3) in alternate function and call DMA_MgrInit().
+  *             SDIOCLK must be 48 MHz.
+  *
+  *          2. Call SD_IRQHandler() from SDIO_IRQHandler, and DMA_MgrIRQHandler()
+  *             from the interrupt handlers of DMA2 Stream3 and DMA2 Stream6, the
+  *             streams of the SDIO request. Give the three interrupts the same
+  *             preemption priority and enable SDIO_IRQn using NVIC_Init().
+  *
+  *          3. Identify and configure the card using SD_Init(). The capacity and
+  *             the bus configuration are returned by SD_GetCardInfo().
+  *
+  *          4. Transfer 512-byte blocks from or to a word aligned buffer:
+  *              - SD_ReadBlocks() and SD_WriteBlocks() wait for the end of the
+  *                transfer.
+  *              - SD_ReadBlocksAsync() and SD_WriteBlocksAsync() return once the
+  *                transfer is started. The Callback is called from the interrupt
+  *                handlers at the end of the transfer, and SD_GetTransferStatus()
+  *                returns SD_BUSY until then.
+  *
+  * @note   A DMA stream of the SDIO request is allocated from the DMA manager
+  *         for each transfer and released at its end.
+  *
+  * @note   The card may still be programming a written block when the write
+  *         completes: the next transfer, or SD_WaitReady(), waits for it.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_sdio_sd.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup SDIO
+  * @brief SDIO driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Commands */
+#define SD_CMD_GO_IDLE_STATE            ((uint32_t)0)
+#define SD_CMD_SEND_OP_COND             ((uint32_t)1)   /* MMC only */
+#define SD_CMD_ALL_SEND_CID             ((uint32_t)2)
+#define SD_CMD_SET_REL_ADDR             ((uint32_t)3)
+#define SD_CMD_SWITCH                   ((uint32_t)6)   /* SD: SWITCH_FUNC, MMC: SWITCH */
+#define SD_CMD_SEL_DESEL_CARD           ((uint32_t)7)
+#define SD_CMD_SEND_IF_COND             ((uint32_t)8)   /* SD only */
+#define SD_CMD_SEND_EXT_CSD             ((uint32_t)8)   /* MMC only */
+#define SD_CMD_SEND_CSD                 ((uint32_t)9)
+#define SD_CMD_STOP_TRANSMISSION        ((uint32_t)12)
+#define SD_CMD_SEND_STATUS              ((uint32_t)13)
+#define SD_CMD_SET_BLOCKLEN             ((uint32_t)16)
+#define SD_CMD_READ_SINGLE_BLOCK        ((uint32_t)17)
+#define SD_CMD_READ_MULT_BLOCK          ((uint32_t)18)
+#define SD_CMD_WRITE_SINGLE_BLOCK       ((uint32_t)24)
+#define SD_CMD_WRITE_MULT_BLOCK         ((uint32_t)25)
+#define SD_CMD_APP_CMD                  ((uint32_t)55)
+
+/* Application specific commands, after SD_CMD_APP_CMD */
+#define SD_ACMD_SET_BUS_WIDTH           ((uint32_t)6)
+#define SD_ACMD_SET_WR_BLK_ERASE_COUNT  ((uint32_t)23)
+#define SD_ACMD_SD_APP_OP_COND          ((uint32_t)41)
+#define SD_ACMD_SEND_SCR                ((uint32_t)51)
+
+/* Arguments */
+#define SD_CHECK_PATTERN                ((uint32_t)0x000001AA)
+#define SD_VOLTAGE_WINDOW_SD            ((uint32_t)0x80100000)
+#define SD_VOLTAGE_WINDOW_MMC           ((uint32_t)0x40FF8000)  /* 2.7-3.6 V, sector mode */
+#define SD_HIGH_CAPACITY                ((uint32_t)0x40000000)
+#define SD_BUS_WIDE_4B                  ((uint32_t)0x00000002)
+#define SD_SWITCH_HIGH_SPEED            ((uint32_t)0x80FFFFF1)  /* Mode 1, group 1 function 1 */
+#define MMC_SWITCH_BUS_WIDTH_4B         ((uint32_t)0x03B70100)  /* EXT_CSD[183] = 1 */
+#define MMC_SWITCH_HS_TIMING            ((uint32_t)0x03B90100)  /* EXT_CSD[185] = 1 */
+
+/* Responses */
+#define SD_OCR_POWERUP                  ((uint32_t)0x80000000)
+#define SD_OCR_ERRORBITS                ((uint32_t)0xFDFFE008)
+#define SD_R6_ERRORBITS                 ((uint32_t)0x0000E000)
+#define SD_STATUS_READY_FOR_DATA        ((uint32_t)0x00000100)
+#define SD_STATE_TRAN                   ((uint32_t)0x00000004)
+
+/* SDIO_CK = SDIOCLK / (CLKDIV + 2) */
+#define SD_INIT_CLK_DIV                 ((uint8_t)0x76)  /* 400 kHz */
+#define SD_TRANSFER_CLK_DIV             ((uint8_t)0x00)  /* 24 MHz */
+#define MMC_TRANSFER_CLK_DIV            ((uint8_t)0x01)  /* 16 MHz */
+
+#define SD_STATIC_FLAGS                 ((uint32_t)0x000005FF)
+#define SD_XFER_ITS                     (SDIO_IT_DCRCFAIL | SDIO_IT_DTIMEOUT | SDIO_IT_DATAEND | \
+                                         SDIO_IT_TXUNDERR | SDIO_IT_RXOVERR | SDIO_IT_STBITERR)
+#define SD_DATA_ERRORS                  (SDIO_FLAG_DCRCFAIL | SDIO_FLAG_DTIMEOUT | \
+                                         SDIO_FLAG_RXOVERR | SDIO_FLAG_STBITERR)
+
+#define SD_CMD_TIMEOUT                  ((uint32_t)0x00010000)
+#define SD_DATATIMEOUT                  ((uint32_t)0xFFFFFFFF)
+#define SD_READY_TIMEOUT                ((uint32_t)0x000FFFFF)
+#define SD_MAX_VOLT_TRIAL               ((uint32_t)0x00001000)
+#define SD_MAX_BLOCKS                   ((uint32_t)0x0000FFFF)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static SD_CardInfoTypeDef SD_Card;
+static uint32_t SD_Scratch[128];
+static DMA_Stream_TypeDef* SD_DmaStream = 0;
+static DMA_MgrXferTypeDef SD_DmaXfer;
+static SD_CallbackTypeDef SD_XferCallback = 0;
+static void* SD_XferContext = 0;
+static __IO SD_Error SD_XferStatus = SD_OK;
+static __IO uint8_t SD_XferBusy = 0;
+static __IO uint8_t SD_XferDataEnd = 0;
+static __IO uint8_t SD_XferDmaEnd = 0;
+static uint8_t SD_XferStop = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void SD_SetClock(uint8_t ClockDiv, uint32_t ClockBypass, uint32_t BusWide);
+static SD_Error SD_SendCmd(uint32_t CmdIndex, uint32_t Argument, uint32_t Response);
+static SD_Error SD_SendCmdR1(uint32_t CmdIndex, uint32_t Argument);
+static SD_Error SD_ReadPolled(uint32_t CmdIndex, uint32_t Argument, uint8_t App,
+                              uint8_t* Buffer, uint32_t Length, uint32_t BlockSize);
+static SD_Error SD_WaitCardReady(void);
+static SD_Error SD_StartTransfer(uint32_t Buffer, uint32_t BlockAddr, uint32_t NumBlocks,
+                                 uint32_t TransferDir, SD_CallbackTypeDef Callback, void* Context);
+static void SD_EndTransfer(SD_Error Status);
+static void SD_DmaCallback(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup SDIO_Private_Functions
+  * @{
+  */
+
+/** @defgroup SDIO_Group8 SD card block driver functions
+ *  @brief   SD card block driver functions
+ *
+@verbatim
+ ===============================================================================
+                      SD card block driver functions
+ ===============================================================================
+
+  This subsection provides functions allowing to identify an SD or MMC card and
+  to transfer blocks.
+
+  The identification runs at 400 kHz on a 1-bit bus, then the card is switched
+  to the 4-bit bus and to high speed when it supports them.
+
+  The blocks are transferred by DMA with the SDIO as flow controller, in burst
+  of 4 words. Several blocks are transferred with one multiple block command,
+  stopped by CMD12 at the end of the data. Before a multiple block write on an
+  SD card, ACMD23 tells the card the number of blocks to pre-erase.
+
+  A transfer ends when both the SDIO DATAEND interrupt and the DMA Transfer
+  Complete interrupt occurred: the DMA writes the last words received after
+  DATAEND, and reads the last words to send before it.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Identifies the card and configures the bus.
+  * @param  None
+  * @retval SD_Error: SD_OK if the card is ready for the transfers.
+  */
+SD_Error SD_Init(void)
+{
+  SD_Error errorstatus = SD_OK;
+  uint8_t* buffer = (uint8_t*)SD_Scratch;
+  uint32_t response = 0, count = 0, version2 = 0, csize = 0;
+  uint8_t clockdiv = SD_TRANSFER_CLK_DIV;
+  uint32_t buswide = SDIO_BusWide_1b;
+
+  SD_DeInit();
+
+  SD_Card.CardType = SD_CARD_SDSC_V1;
+  SD_Card.RCA = 0;
+  SD_Card.BlockCount = 0;
+  SD_Card.BusWide = 1;
+  SD_Card.HighSpeed = 0;
+
+  /* Power on the card at 400 kHz on a 1-bit bus --------------------------*/
+  SD_SetClock(SD_INIT_CLK_DIV, SDIO_ClockBypass_Disable, SDIO_BusWide_1b);
+  SDIO_SetPowerState(SDIO_PowerState_ON);
+  SDIO_ClockCmd(ENABLE);
+
+  errorstatus = SD_SendCmd(SD_CMD_GO_IDLE_STATE, 0, SDIO_Response_No);
+  if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+
+  /* Version 2 SD cards answer CMD8 with the check pattern */
+  if ((SD_SendCmd(SD_CMD_SEND_IF_COND, SD_CHECK_PATTERN, SDIO_Response_Short) == SD_OK) &&
+      ((SDIO_GetResponse(SDIO_RESP1) & 0xFF) == (SD_CHECK_PATTERN & 0xFF)))
+  {
+    version2 = 1;
+  }
+
+  /* SD cards: ACMD41 until the end of the power up ------------------------*/
+  do
+  {
+    errorstatus = SD_SendCmdR1(SD_CMD_APP_CMD, 0);
+    if (errorstatus != SD_OK)
+    {
+      break;
+    }
+    errorstatus = SD_SendCmd(SD_ACMD_SD_APP_OP_COND,
+                             SD_VOLTAGE_WINDOW_SD | (version2 ? SD_HIGH_CAPACITY : 0),
+                             SDIO_Response_Short);
+    if (errorstatus != SD_OK)
+    {
+      break;
+    }
+    response = SDIO_GetResponse(SDIO_RESP1);
+    count++;
+  }
+  while (((response & SD_OCR_POWERUP) == 0) && (count < SD_MAX_VOLT_TRIAL));
+
+  if (errorstatus == SD_CMD_RSP_TIMEOUT)
+  {
+    /* No answer to CMD55: MMC card, CMD1 until the end of the power up ----*/
+    SD_SendCmd(SD_CMD_GO_IDLE_STATE, 0, SDIO_Response_No);
+    count = 0;
+    do
+    {
+      errorstatus = SD_SendCmd(SD_CMD_SEND_OP_COND, SD_VOLTAGE_WINDOW_MMC, SDIO_Response_Short);
+      if (errorstatus != SD_OK)
+      {
+        return SD_UNSUPPORTED_CARD;
+      }
+      response = SDIO_GetResponse(SDIO_RESP1);
+      count++;
+    }
+    while (((response & SD_OCR_POWERUP) == 0) && (count < SD_MAX_VOLT_TRIAL));
+
+    /* Access mode bits 30:29 set to sector mode */
+    SD_Card.CardType = (((response >> 29) & 0x3) == 0x2) ? SD_CARD_MMC_HC : SD_CARD_MMC;
+  }
+  else if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+  else
+  {
+    SD_Card.CardType = ((response & SD_HIGH_CAPACITY) != 0) ? SD_CARD_SDHC :
+                       (version2 ? SD_CARD_SDSC_V2 : SD_CARD_SDSC_V1);
+  }
+
+  if ((response & SD_OCR_POWERUP) == 0)
+  {
+    return SD_TIMEOUT;
+  }
+
+  /* Identification: CID, RCA and CSD --------------------------------------*/
+  errorstatus = SD_SendCmd(SD_CMD_ALL_SEND_CID, 0, SDIO_Response_Long);
+  if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+  SD_Card.CID[0] = SDIO_GetResponse(SDIO_RESP1);
+  SD_Card.CID[1] = SDIO_GetResponse(SDIO_RESP2);
+  SD_Card.CID[2] = SDIO_GetResponse(SDIO_RESP3);
+  SD_Card.CID[3] = SDIO_GetResponse(SDIO_RESP4);
+
+  if ((SD_Card.CardType == SD_CARD_MMC) || (SD_Card.CardType == SD_CARD_MMC_HC))
+  {
+    /* The host gives the address of an MMC card */
+    SD_Card.RCA = 0x00010000;
+    errorstatus = SD_SendCmdR1(SD_CMD_SET_REL_ADDR, SD_Card.RCA);
+  }
+  else
+  {
+    errorstatus = SD_SendCmd(SD_CMD_SET_REL_ADDR, 0, SDIO_Response_Short);
+    response = SDIO_GetResponse(SDIO_RESP1);
+    if ((errorstatus == SD_OK) && ((response & SD_R6_ERRORBITS) != 0))
+    {
+      errorstatus = SD_CARD_ERROR;
+    }
+    SD_Card.RCA = response & 0xFFFF0000;
+  }
+  if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+
+  errorstatus = SD_SendCmd(SD_CMD_SEND_CSD, SD_Card.RCA, SDIO_Response_Long);
+  if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+  SD_Card.CSD[0] = SDIO_GetResponse(SDIO_RESP1);
+  SD_Card.CSD[1] = SDIO_GetResponse(SDIO_RESP2);
+  SD_Card.CSD[2] = SDIO_GetResponse(SDIO_RESP3);
+  SD_Card.CSD[3] = SDIO_GetResponse(SDIO_RESP4);
+
+  if (SD_Card.CardType == SD_CARD_SDHC)
+  {
+    /* CSD version 2.0: C_SIZE[69:48] in units of 512 KB */
+    csize = ((SD_Card.CSD[1] & 0x0000003F) << 16) | (SD_Card.CSD[2] >> 16);
+    SD_Card.BlockCount = (csize + 1) << 10;
+  }
+  else
+  {
+    /* CSD version 1.0: (C_SIZE[73:62] + 1) << (C_SIZE_MULT[49:47] + 2 + READ_BL_LEN[83:80]) bytes */
+    csize = ((SD_Card.CSD[1] & 0x000003FF) << 2) | (SD_Card.CSD[2] >> 30);
+    SD_Card.BlockCount = ((csize + 1) << (((SD_Card.CSD[2] >> 15) & 0x7) + 2 +
+                                         ((SD_Card.CSD[1] >> 16) & 0xF))) >> 9;
+  }
+
+  /* Select the card and set the block length ------------------------------*/
+  errorstatus = SD_SendCmdR1(SD_CMD_SEL_DESEL_CARD, SD_Card.RCA);
+  if (errorstatus == SD_OK)
+  {
+    errorstatus = SD_WaitCardReady();
+  }
+  if (errorstatus == SD_OK)
+  {
+    errorstatus = SD_SendCmdR1(SD_CMD_SET_BLOCKLEN, SD_BLOCK_SIZE);
+  }
+  if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+
+  if ((SD_Card.CardType == SD_CARD_MMC) || (SD_Card.CardType == SD_CARD_MMC_HC))
+  {
+    clockdiv = MMC_TRANSFER_CLK_DIV;
+    SD_SetClock(clockdiv, SDIO_ClockBypass_Disable, buswide);
+
+    /* 4-bit bus and high speed from SPEC_VERS 4 */
+    if (((SD_Card.CSD[0] >> 26) & 0xF) >= 4)
+    {
+      errorstatus = SD_ReadPolled(SD_CMD_SEND_EXT_CSD, 0, 0, buffer, 512, SDIO_DataBlockSize_512b);
+      if (errorstatus != SD_OK)
+      {
+        return errorstatus;
+      }
+
+      if (SD_Card.CardType == SD_CARD_MMC_HC)
+      {
+        /* SEC_COUNT[215:212] */
+        SD_Card.BlockCount = (uint32_t)buffer[212] | ((uint32_t)buffer[213] << 8) |
+                             ((uint32_t)buffer[214] << 16) | ((uint32_t)buffer[215] << 24);
+      }
+
+      if ((SD_SendCmdR1(SD_CMD_SWITCH, MMC_SWITCH_BUS_WIDTH_4B) == SD_OK) &&
+          (SD_WaitCardReady() == SD_OK))
+      {
+        buswide = SDIO_BusWide_4b;
+        SD_Card.BusWide = 4;
+        SD_SetClock(clockdiv, SDIO_ClockBypass_Disable, buswide);
+      }
+
+      /* CARD_TYPE[196]: 26 MHz and 52 MHz high speed */
+      if (((buffer[196] & 0x03) != 0) &&
+          (SD_SendCmdR1(SD_CMD_SWITCH, MMC_SWITCH_HS_TIMING) == SD_OK) &&
+          (SD_WaitCardReady() == SD_OK))
+      {
+        SD_Card.HighSpeed = 1;
+        if ((buffer[196] & 0x02) != 0)
+        {
+          SD_SetClock(0, SDIO_ClockBypass_Enable, buswide);
+        }
+        else
+        {
+          SD_SetClock(SD_TRANSFER_CLK_DIV, SDIO_ClockBypass_Disable, buswide);
+        }
+      }
+    }
+  }
+  else
+  {
+    SD_SetClock(clockdiv, SDIO_ClockBypass_Disable, buswide);
+
+    /* SCR: SD_SPEC[59:56] and SD_BUS_WIDTHS[51:48] */
+    errorstatus = SD_ReadPolled(SD_ACMD_SEND_SCR, 0, 1, buffer, 8, SDIO_DataBlockSize_8b);
+    if (errorstatus != SD_OK)
+    {
+      return errorstatus;
+    }
+
+    if ((buffer[1] & 0x04) != 0)
+    {
+      errorstatus = SD_SendCmdR1(SD_CMD_APP_CMD, SD_Card.RCA);
+      if (errorstatus == SD_OK)
+      {
+        errorstatus = SD_SendCmdR1(SD_ACMD_SET_BUS_WIDTH, SD_BUS_WIDE_4B);
+      }
+      if (errorstatus != SD_OK)
+      {
+        return errorstatus;
+      }
+      buswide = SDIO_BusWide_4b;
+      SD_Card.BusWide = 4;
+      SD_SetClock(clockdiv, SDIO_ClockBypass_Disable, buswide);
+    }
+
+    /* CMD6 from SD_SPEC 1.10: the function selected in group 1 is in
+       bits 379:376 of the switch status */
+    if (((buffer[0] & 0x0F) >= 1) &&
+        (SD_ReadPolled(SD_CMD_SWITCH, SD_SWITCH_HIGH_SPEED, 0, buffer, 64,
+                       SDIO_DataBlockSize_64b) == SD_OK) &&
+        ((buffer[16] & 0x0F) == 0x01))
+    {
+      SD_Card.HighSpeed = 1;
+      SD_SetClock(0, SDIO_ClockBypass_Enable, buswide);
+    }
+  }
+
+  return SD_OK;
+}
+
+/**
+  * @brief  Aborts the transfer in progress and powers the card off.
+  * @param  None
+  * @retval None
+  */
+void SD_DeInit(void)
+{
+  if (SD_XferBusy != 0)
+  {
+    SD_XferStop = 0;
+    SD_EndTransfer(SD_CARD_ERROR);
+  }
+
+  SDIO_ClockCmd(DISABLE);
+  SDIO_SetPowerState(SDIO_PowerState_OFF);
+  SDIO_DeInit();
+}
+
+/**
+  * @brief  Returns the information of the card identified by SD_Init().
+  * @param  CardInfo: pointer to an SD_CardInfoTypeDef structure which receives
+  *         the information.
+  * @retval None
+  */
+void SD_GetCardInfo(SD_CardInfoTypeDef* CardInfo)
+{
+  *CardInfo = SD_Card;
+}
+
+/**
+  * @brief  Reads blocks and waits for the end of the transfer.
+  * @param  Buffer: word aligned buffer of NumBlocks * 512 bytes.
+  * @param  BlockAddr: number of the first block.
+  * @param  NumBlocks: number of blocks, from 1 to 65535.
+  * @retval SD_Error: SD_OK if the blocks are read.
+  */
+SD_Error SD_ReadBlocks(uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks)
+{
+  SD_Error errorstatus = SD_ReadBlocksAsync(Buffer, BlockAddr, NumBlocks, 0, 0);
+
+  if (errorstatus == SD_OK)
+  {
+    while (SD_XferBusy != 0)
+    {
+    }
+    errorstatus = SD_XferStatus;
+  }
+
+  return errorstatus;
+}
+
+/**
+  * @brief  Writes blocks and waits for the end of the transfer.
+  * @param  Buffer: word aligned buffer of NumBlocks * 512 bytes.
+  * @param  BlockAddr: number of the first block.
+  * @param  NumBlocks: number of blocks, from 1 to 65535.
+  * @retval SD_Error: SD_OK if the blocks are sent to the card.
+  */
+SD_Error SD_WriteBlocks(const uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks)
+{
+  SD_Error errorstatus = SD_WriteBlocksAsync(Buffer, BlockAddr, NumBlocks, 0, 0);
+
+  if (errorstatus == SD_OK)
+  {
+    while (SD_XferBusy != 0)
+    {
+    }
+    errorstatus = SD_XferStatus;
+  }
+
+  return errorstatus;
+}
+
+/**
+  * @brief  Starts reading blocks.
+  * @param  Buffer: word aligned buffer of NumBlocks * 512 bytes.
+  * @param  BlockAddr: number of the first block.
+  * @param  NumBlocks: number of blocks, from 1 to 65535.
+  * @param  Callback: called at the end of the transfer, or 0.
+  * @param  Context: passed to the Callback.
+  * @retval SD_Error: SD_OK if the transfer is started. The Callback is only
+  *         called in this case.
+  */
+SD_Error SD_ReadBlocksAsync(uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks,
+                            SD_CallbackTypeDef Callback, void* Context)
+{
+  return SD_StartTransfer((uint32_t)Buffer, BlockAddr, NumBlocks, SDIO_TransferDir_ToSDIO,
+                          Callback, Context);
+}
+
+/**
+  * @brief  Starts writing blocks.
+  * @param  Buffer: word aligned buffer of NumBlocks * 512 bytes.
+  * @param  BlockAddr: number of the first block.
+  * @param  NumBlocks: number of blocks, from 1 to 65535.
+  * @param  Callback: called at the end of the transfer, or 0.
+  * @param  Context: passed to the Callback.
+  * @retval SD_Error: SD_OK if the transfer is started. The Callback is only
+  *         called in this case.
+  */
+SD_Error SD_WriteBlocksAsync(const uint8_t* Buffer, uint32_t BlockAddr, uint32_t NumBlocks,
+                             SD_CallbackTypeDef Callback, void* Context)
+{
+  return SD_StartTransfer((uint32_t)Buffer, BlockAddr, NumBlocks, SDIO_TransferDir_ToCard,
+                          Callback, Context);
+}
+
+/**
+  * @brief  Returns the status of the last transfer.
+  * @param  None
+  * @retval SD_Error: SD_BUSY while the transfer is in progress, then its result.
+  */
+SD_Error SD_GetTransferStatus(void)
+{
+  if (SD_XferBusy != 0)
+  {
+    return SD_BUSY;
+  }
+  return SD_XferStatus;
+}
+
+/**
+  * @brief  Waits for the end of the transfer in progress and for the card to be
+  *         ready for the next one.
+  * @param  None
+  * @retval SD_Error: SD_OK if the card is ready.
+  */
+SD_Error SD_WaitReady(void)
+{
+  while (SD_XferBusy != 0)
+  {
+  }
+
+  return SD_WaitCardReady();
+}
+
+/**
+  * @brief  Handles the SDIO interrupts of the transfers.
+  * @note   This function must be called from SDIO_IRQHandler.
+  * @param  None
+  * @retval None
+  */
+void SD_IRQHandler(void)
+{
+  SD_Error errorstatus = SD_OK;
+
+  if (SD_XferBusy == 0)
+  {
+    SDIO_ClearITPendingBit(SD_STATIC_FLAGS);
+    return;
+  }
+
+  if (SDIO_GetITStatus(SDIO_IT_DCRCFAIL) != RESET)
+  {
+    errorstatus = SD_DATA_CRC_FAIL;
+  }
+  else if (SDIO_GetITStatus(SDIO_IT_DTIMEOUT) != RESET)
+  {
+    errorstatus = SD_DATA_TIMEOUT;
+  }
+  else if (SDIO_GetITStatus(SDIO_IT_RXOVERR) != RESET)
+  {
+    errorstatus = SD_RX_OVERRUN;
+  }
+  else if (SDIO_GetITStatus(SDIO_IT_TXUNDERR) != RESET)
+  {
+    errorstatus = SD_TX_UNDERRUN;
+  }
+  else if (SDIO_GetITStatus(SDIO_IT_STBITERR) != RESET)
+  {
+    errorstatus = SD_START_BIT_ERR;
+  }
+  else if (SDIO_GetITStatus(SDIO_IT_DATAEND) != RESET)
+  {
+    SDIO_ClearITPendingBit(SDIO_IT_DATAEND);
+    SD_XferDataEnd = 1;
+  }
+
+  if (errorstatus != SD_OK)
+  {
+    SD_EndTransfer(errorstatus);
+  }
+  else if ((SD_XferDataEnd != 0) && (SD_XferDmaEnd != 0))
+  {
+    SD_EndTransfer(SD_OK);
+  }
+}
+
+/**
+  * @brief  Configures the clock and the bus width of the SDIO.
+  * @param  ClockDiv: SDIO_CK = SDIOCLK / (ClockDiv + 2).
+  * @param  ClockBypass: SDIO_ClockBypass_Enable for SDIO_CK = SDIOCLK.
+  * @param  BusWide: SDIO_BusWide_1b or SDIO_BusWide_4b.
+  * @retval None
+  */
+static void SD_SetClock(uint8_t ClockDiv, uint32_t ClockBypass, uint32_t BusWide)
+{
+  SDIO_InitTypeDef SDIO_InitStructure;
+
+  SDIO_InitStructure.SDIO_ClockDiv = ClockDiv;
+  SDIO_InitStructure.SDIO_ClockEdge = SDIO_ClockEdge_Rising;
+  SDIO_InitStructure.SDIO_ClockBypass = ClockBypass;
+  SDIO_InitStructure.SDIO_ClockPowerSave = SDIO_ClockPowerSave_Disable;
+  SDIO_InitStructure.SDIO_BusWide = BusWide;
+  /* The DMA keeps the FIFO from underrun and overrun */
+  SDIO_InitStructure.SDIO_HardwareFlowControl = SDIO_HardwareFlowControl_Disable;
+  SDIO_Init(&SDIO_InitStructure);
+}
+
+/**
+  * @brief  Sends a command and waits for its response.
+  * @param  CmdIndex: the command.
+  * @param  Argument: the argument of the command.
+  * @param  Response: SDIO_Response_No, SDIO_Response_Short or SDIO_Response_Long.
+  * @retval SD_Error: SD_OK if the response is received.
+  */
+static SD_Error SD_SendCmd(uint32_t CmdIndex, uint32_t Argument, uint32_t Response)
+{
+  SDIO_CmdInitTypeDef SDIO_CmdInitStructure;
+  uint32_t flags = SDIO_FLAG_CCRCFAIL | SDIO_FLAG_CMDREND | SDIO_FLAG_CTIMEOUT;
+  uint32_t timeout = SD_CMD_TIMEOUT;
+
+  SDIO_CmdInitStructure.SDIO_Argument = Argument;
+  SDIO_CmdInitStructure.SDIO_CmdIndex = CmdIndex;
+  SDIO_CmdInitStructure.SDIO_Response = Response;
+  SDIO_CmdInitStructure.SDIO_Wait = SDIO_Wait_No;
+  SDIO_CmdInitStructure.SDIO_CPSM = SDIO_CPSM_Enable;
+  SDIO_SendCommand(&SDIO_CmdInitStructure);
+
+  if (Response == SDIO_Response_No)
+  {
+    flags = SDIO_FLAG_CMDSENT | SDIO_FLAG_CTIMEOUT;
+  }
+
+  while ((SDIO->STA & flags) == 0)
+  {
+    if (--timeout == 0)
+    {
+      SDIO_ClearFlag(SD_STATIC_FLAGS);
+      return SD_CMD_RSP_TIMEOUT;
+    }
+  }
+
+  if (SDIO_GetFlagStatus(SDIO_FLAG_CTIMEOUT) != RESET)
+  {
+    SDIO_ClearFlag(SD_STATIC_FLAGS);
+    return SD_CMD_RSP_TIMEOUT;
+  }
+
+  /* The R3 response of the operating conditions has no CRC */
+  if ((SDIO_GetFlagStatus(SDIO_FLAG_CCRCFAIL) != RESET) &&
+      (CmdIndex != SD_CMD_SEND_OP_COND) && (CmdIndex != SD_ACMD_SD_APP_OP_COND))
+  {
+    SDIO_ClearFlag(SD_STATIC_FLAGS);
+    return SD_CMD_CRC_FAIL;
+  }
+
+  SDIO_ClearFlag(SD_STATIC_FLAGS);
+  return SD_OK;
+}
+
+/**
+  * @brief  Sends a command with an R1 response and checks the card status.
+  * @param  CmdIndex: the command.
+  * @param  Argument: the argument of the command.
+  * @retval SD_Error: SD_OK if the card status has no error.
+  */
+static SD_Error SD_SendCmdR1(uint32_t CmdIndex, uint32_t Argument)
+{
+  SD_Error errorstatus = SD_SendCmd(CmdIndex, Argument, SDIO_Response_Short);
+
+  if ((errorstatus == SD_OK) && ((SDIO_GetResponse(SDIO_RESP1) & SD_OCR_ERRORBITS) != 0))
+  {
+    errorstatus = SD_CARD_ERROR;
+  }
+
+  return errorstatus;
+}
+
+/**
+  * @brief  Reads a register of the card (SCR, switch status, EXT_CSD) by polling.
+  * @param  CmdIndex: the command.
+  * @param  Argument: the argument of the command.
+  * @param  App: 1 if CmdIndex is an application specific command.
+  * @param  Buffer: receives the bytes in the order they are sent by the card.
+  * @param  Length: number of bytes, a multiple of 4.
+  * @param  BlockSize: a value of @ref SDIO_Data_Block_Size equal to Length.
+  * @retval SD_Error: SD_OK if the data is received.
+  */
+static SD_Error SD_ReadPolled(uint32_t CmdIndex, uint32_t Argument, uint8_t App,
+                              uint8_t* Buffer, uint32_t Length, uint32_t BlockSize)
+{
+  SDIO_DataInitTypeDef SDIO_DataInitStructure;
+  SD_Error errorstatus = SD_OK;
+  uint32_t count = 0, data = 0;
+
+  if (App != 0)
+  {
+    errorstatus = SD_SendCmdR1(SD_CMD_APP_CMD, SD_Card.RCA);
+    if (errorstatus != SD_OK)
+    {
+      return errorstatus;
+    }
+  }
+
+  SDIO_DMACmd(DISABLE);
+  SDIO_DataInitStructure.SDIO_DataTimeOut = SD_DATATIMEOUT;
+  SDIO_DataInitStructure.SDIO_DataLength = Length;
+  SDIO_DataInitStructure.SDIO_DataBlockSize = BlockSize;
+  SDIO_DataInitStructure.SDIO_TransferDir = SDIO_TransferDir_ToSDIO;
+  SDIO_DataInitStructure.SDIO_TransferMode = SDIO_TransferMode_Block;
+  SDIO_DataInitStructure.SDIO_DPSM = SDIO_DPSM_Enable;
+  SDIO_DataConfig(&SDIO_DataInitStructure);
+
+  errorstatus = SD_SendCmdR1(CmdIndex, Argument);
+  if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+
+  /* The first byte received is the low byte of the first word */
+  while ((SDIO->STA & (SD_DATA_ERRORS | SDIO_FLAG_DATAEND)) == 0)
+  {
+    if (SDIO_GetFlagStatus(SDIO_FLAG_RXDAVL) != RESET)
+    {
+      data = SDIO_ReadData();
+      if (count < Length)
+      {
+        Buffer[count] = (uint8_t)data;
+        Buffer[count + 1] = (uint8_t)(data >> 8);
+        Buffer[count + 2] = (uint8_t)(data >> 16);
+        Buffer[count + 3] = (uint8_t)(data >> 24);
+        count += 4;
+      }
+    }
+  }
+
+  if (SDIO_GetFlagStatus(SDIO_FLAG_DTIMEOUT) != RESET)
+  {
+    errorstatus = SD_DATA_TIMEOUT;
+  }
+  else if (SDIO_GetFlagStatus(SDIO_FLAG_DCRCFAIL) != RESET)
+  {
+    errorstatus = SD_DATA_CRC_FAIL;
+  }
+  else if (SDIO_GetFlagStatus(SDIO_FLAG_RXOVERR) != RESET)
+  {
+    errorstatus = SD_RX_OVERRUN;
+  }
+  else if (SDIO_GetFlagStatus(SDIO_FLAG_STBITERR) != RESET)
+  {
+    errorstatus = SD_START_BIT_ERR;
+  }
+
+  /* Words left in the FIFO at DATAEND */
+  while (SDIO_GetFlagStatus(SDIO_FLAG_RXDAVL) != RESET)
+  {
+    data = SDIO_ReadData();
+    if (count < Length)
+    {
+      Buffer[count] = (uint8_t)data;
+      Buffer[count + 1] = (uint8_t)(data >> 8);
+      Buffer[count + 2] = (uint8_t)(data >> 16);
+      Buffer[count + 3] = (uint8_t)(data >> 24);
+      count += 4;
+    }
+  }
+
+  SDIO_ClearFlag(SD_STATIC_FLAGS);
+
+  return errorstatus;
+}
+
+/**
+  * @brief  Waits for the card to be in transfer state and ready for data.
+  * @param  None
+  * @retval SD_Error: SD_OK if the card is ready, SD_TIMEOUT if it stayed busy.
+  */
+static SD_Error SD_WaitCardReady(void)
+{
+  SD_Error errorstatus = SD_OK;
+  uint32_t response = 0, timeout = SD_READY_TIMEOUT;
+
+  do
+  {
+    errorstatus = SD_SendCmdR1(SD_CMD_SEND_STATUS, SD_Card.RCA);
+    if (errorstatus != SD_OK)
+    {
+      return errorstatus;
+    }
+
+    response = SDIO_GetResponse(SDIO_RESP1);
+    if ((((response >> 9) & 0xF) == SD_STATE_TRAN) && ((response & SD_STATUS_READY_FOR_DATA) != 0))
+    {
+      return SD_OK;
+    }
+  }
+  while (--timeout != 0);
+
+  return SD_TIMEOUT;
+}
+
+/**
+  * @brief  Starts a block transfer by DMA.
+  * @param  Buffer: word aligned address of the data.
+  * @param  BlockAddr: number of the first block.
+  * @param  NumBlocks: number of blocks, from 1 to 65535.
+  * @param  TransferDir: SDIO_TransferDir_ToSDIO to read, SDIO_TransferDir_ToCard
+  *         to write.
+  * @param  Callback: called at the end of the transfer, or 0.
+  * @param  Context: passed to the Callback.
+  * @retval SD_Error: SD_OK if the transfer is started.
+  */
+static SD_Error SD_StartTransfer(uint32_t Buffer, uint32_t BlockAddr, uint32_t NumBlocks,
+                                 uint32_t TransferDir, SD_CallbackTypeDef Callback, void* Context)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  SDIO_DataInitTypeDef SDIO_DataInitStructure;
+  SD_Error errorstatus = SD_OK;
+  uint32_t address = BlockAddr;
+  uint8_t sdcard = (SD_Card.CardType != SD_CARD_MMC) && (SD_Card.CardType != SD_CARD_MMC_HC);
+
+  if (SD_XferBusy != 0)
+  {
+    return SD_BUSY;
+  }
+
+  if ((NumBlocks == 0) || (NumBlocks > SD_MAX_BLOCKS) || ((Buffer & 0x3) != 0) ||
+      (BlockAddr >= SD_Card.BlockCount) || (NumBlocks > (SD_Card.BlockCount - BlockAddr)))
+  {
+    return SD_INVALID_PARAMETER;
+  }
+
+  /* The card may still be programming the previous write */
+  errorstatus = SD_WaitCardReady();
+  if (errorstatus != SD_OK)
+  {
+    return errorstatus;
+  }
+
+  /* Standard capacity cards are addressed in bytes */
+  if ((SD_Card.CardType != SD_CARD_SDHC) && (SD_Card.CardType != SD_CARD_MMC_HC))
+  {
+    address = BlockAddr * SD_BLOCK_SIZE;
+  }
+
+  /* DMA stream of the SDIO request, the SDIO being the flow controller ----*/
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&SDIO->FIFO;
+  DMA_InitStructure.DMA_DIR = (TransferDir == SDIO_TransferDir_ToSDIO) ?
+                              DMA_DIR_PeripheralToMemory : DMA_DIR_MemoryToPeripheral;
+  DMA_InitStructure.DMA_BufferSize = 0xFFFF;
+  DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_VeryHigh;
+  DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
+  DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+  DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_INC4;
+  DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_INC4;
+
+  SD_DmaStream = DMA_MgrAlloc(DMA_MGR_REQ_SDIO, &DMA_InitStructure);
+  if (SD_DmaStream == 0)
+  {
+    return SD_DMA_ERROR;
+  }
+  DMA_FlowControllerConfig(SD_DmaStream, DMA_FlowCtrl_Peripheral);
+
+  SD_XferCallback = Callback;
+  SD_XferContext = Context;
+  SD_XferStatus = SD_BUSY;
+  SD_XferDataEnd = 0;
+  SD_XferDmaEnd = 0;
+  SD_XferStop = 0;
+  SD_XferBusy = 1;
+
+  SDIO_ClearFlag(SD_STATIC_FLAGS);
+  SDIO_ITConfig(SD_XFER_ITS, ENABLE);
+  SDIO_DMACmd(ENABLE);
+
+  SD_DmaXfer.MemoryBaseAddr = Buffer;
+  SD_DmaXfer.Count = 0xFFFF;
+  SD_DmaXfer.Callback = SD_DmaCallback;
+  SD_DmaXfer.Context = 0;
+  DMA_MgrSubmit(SD_DmaStream, &SD_DmaXfer);
+
+  SDIO_DataInitStructure.SDIO_DataTimeOut = SD_DATATIMEOUT;
+  SDIO_DataInitStructure.SDIO_DataLength = NumBlocks * SD_BLOCK_SIZE;
+  SDIO_DataInitStructure.SDIO_DataBlockSize = SDIO_DataBlockSize_512b;
+  SDIO_DataInitStructure.SDIO_TransferDir = TransferDir;
+  SDIO_DataInitStructure.SDIO_TransferMode = SDIO_TransferMode_Block;
+  SDIO_DataInitStructure.SDIO_DPSM = SDIO_DPSM_Enable;
+
+  if (TransferDir == SDIO_TransferDir_ToSDIO)
+  {
+    /* The data path waits for the start bit of the first block */
+    SDIO_DataConfig(&SDIO_DataInitStructure);
+    errorstatus = SD_SendCmdR1((NumBlocks > 1) ? SD_CMD_READ_MULT_BLOCK : SD_CMD_READ_SINGLE_BLOCK,
+                               address);
+  }
+  else
+  {
+    if ((NumBlocks > 1) && (sdcard != 0))
+    {
+      /* Pre-erase hint: the card erases the NumBlocks blocks ahead */
+      errorstatus = SD_SendCmdR1(SD_CMD_APP_CMD, SD_Card.RCA);
+      if (errorstatus == SD_OK)
+      {
+        errorstatus = SD_SendCmdR1(SD_ACMD_SET_WR_BLK_ERASE_COUNT, NumBlocks);
+      }
+    }
+    if (errorstatus == SD_OK)
+    {
+      errorstatus = SD_SendCmdR1((NumBlocks > 1) ? SD_CMD_WRITE_MULT_BLOCK : SD_CMD_WRITE_SINGLE_BLOCK,
+                                 address);
+    }
+    if (errorstatus == SD_OK)
+    {
+      SDIO_DataConfig(&SDIO_DataInitStructure);
+    }
+  }
+
+  if (errorstatus != SD_OK)
+  {
+    /* The card did not accept the transfer: no callback */
+    SD_XferCallback = 0;
+    SD_EndTransfer(errorstatus);
+    return errorstatus;
+  }
+
+  /* A multiple block transfer is stopped by CMD12 */
+  SD_XferStop = (NumBlocks > 1);
+
+  return SD_OK;
+}
+
+/**
+  * @brief  Ends the transfer in progress and calls its Callback.
+  * @param  Status: the result of the transfer.
+  * @retval None
+  */
+static void SD_EndTransfer(SD_Error Status)
+{
+  SD_CallbackTypeDef callback = SD_XferCallback;
+  DMA_Stream_TypeDef* stream = SD_DmaStream;
+  SD_Error errorstatus = SD_OK;
+
+  SDIO_ITConfig(SD_XFER_ITS, DISABLE);
+  SDIO_DMACmd(DISABLE);
+  SDIO_ClearFlag(SD_STATIC_FLAGS);
+
+  /* Release the DMA stream: a DMA transfer still queued is aborted */
+  SD_DmaStream = 0;
+  if (stream != 0)
+  {
+    DMA_MgrFree(stream);
+  }
+
+  if (SD_XferStop != 0)
+  {
+    SD_XferStop = 0;
+    errorstatus = SD_SendCmdR1(SD_CMD_STOP_TRANSMISSION, 0);
+    if (Status == SD_OK)
+    {
+      Status = errorstatus;
+    }
+  }
+
+  SD_XferCallback = 0;
+  SD_XferStatus = Status;
+  SD_XferBusy = 0;
+
+  if (callback != 0)
+  {
+    callback(Status, SD_XferContext);
+  }
+}
+
+/**
+  * @brief  Callback of the DMA transfer of the blocks.
+  * @param  Xfer: the DMA transfer.
+  * @retval None
+  */
+static void SD_DmaCallback(DMA_MgrXferTypeDef* Xfer)
+{
+  if ((SD_XferBusy == 0) || (Xfer->Status == DMA_MGR_XFER_ABORTED))
+  {
+    return;
+  }
+
+  if (Xfer->Status == DMA_MGR_XFER_DONE)
+  {
+    SD_XferDmaEnd = 1;
+    if (SD_XferDataEnd != 0)
+    {
+      SD_EndTransfer(SD_OK);
+    }
+  }
+  else
+  {
+    SD_EndTransfer(SD_DMA_ERROR);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
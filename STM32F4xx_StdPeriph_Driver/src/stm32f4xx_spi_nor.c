@@ -0,0 +1,1040 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_spi_nor.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a driver for the SPI NOR flash memories of up to
+  *          16 MB (3-byte addresses, 4 KB sectors, 256-byte pages):
+  *           - Fast Read by DMA, at the full clock of the SPI
+  *           - Programming and erasing in the background, the status
+  *             register being polled from a software timer
+  *           - Erase suspend for the reads issued during an erase
+  *           - Block device of 512-byte sectors for FatFs and the USB mass
+  *             storage class
+  *          It uses the stm32f4xx_spi_xfer.c/.h and stm32f4xx_tim_wheel.c/.h
+  *          drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Initialize the SPI transaction engine of the SPI of the memory
+  *             using SPI_XferInit(), with the chip select pin in output
+  *             push-pull mode, set high, and the software timers service using
+  *             TIM_WheelInit().
+  *
+  *          2. Fill an SPI_NOR_InitTypeDef structure, starting from
+  *             SPI_NOR_StructInit(), and call SPI_NOR_Init(): it wakes the
+  *             memory up and reads its JEDEC identification.
+  *
+  *          3. Read with SPI_NOR_Read(). Program and erase in the background
+  *             with SPI_NOR_ProgramAsync() and SPI_NOR_EraseAsync(), whose
+  *             Callback is called from an interrupt at the end, or wait for
+  *             the end with SPI_NOR_Program() and SPI_NOR_Erase().
+  *
+  *          4. Give the block device, BlockSize bytes from BlockBase, to the
+  *             disk I/O layer of FatFs or to the mass storage class with
+  *             SPI_NOR_ReadSectors(), SPI_NOR_WriteSectors(), SPI_NOR_Flush()
+  *             and SPI_NOR_GetSectorCount().
+  *
+  * @note   The SPI of the STM32F4xx has a single data line in each direction:
+  *         the Dual and Quad Output reads, which need the memory to drive
+  *         its IO0 pin, are not available. The Fast Read command runs at any
+  *         SPI clock, up to fPCLK/2.
+  *
+  * @note   The functions other than the callbacks are called from a single
+  *         context, not from interrupts.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_spi_nor.h"
+#include "misc.h"
+#include <string.h>
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup SPI
+  * @brief SPI driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Block device sectors per erase sector */
+#define SPI_NOR_SECTORS_PER_ERASE  (SPI_NOR_ERASE_SIZE / SPI_NOR_SECTOR_SIZE)
+
+/* No erase sector in the cache */
+#define SPI_NOR_NO_SECTOR          ((uint32_t)0xFFFFFFFF)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t SPI_NOR_WrenCmd = SPI_NOR_CMD_WREN;
+static const uint8_t SPI_NOR_StatusCmd[2] = {SPI_NOR_CMD_RDSR, 0xFF};
+
+/* Private function prototypes -----------------------------------------------*/
+static void SPI_NOR_JobInit(SPI_NOR_TypeDef* Nor, SPI_JobTypeDef* Job);
+static ErrorStatus SPI_NOR_Wait(SPI_JobTypeDef* Job);
+static ErrorStatus SPI_NOR_Command(SPI_NOR_TypeDef* Nor, uint32_t Length, uint8_t* Data, uint32_t DataLength);
+static void SPI_NOR_Acquire(SPI_NOR_TypeDef* Nor);
+static void SPI_NOR_Release(SPI_NOR_TypeDef* Nor);
+static ErrorStatus SPI_NOR_Start(SPI_NOR_TypeDef* Nor, uint32_t State, uint32_t Address, const uint8_t* Data,
+                                 uint32_t Length, void (*Callback)(SPI_NOR_TypeDef* Nor, ErrorStatus Status));
+static void SPI_NOR_Next(SPI_NOR_TypeDef* Nor);
+static void SPI_NOR_Finish(SPI_NOR_TypeDef* Nor, ErrorStatus Status);
+static void SPI_NOR_Issued(SPI_JobTypeDef* Job);
+static void SPI_NOR_Poll(TIM_TimerTypeDef* Timer);
+static void SPI_NOR_StatusDone(SPI_JobTypeDef* Job);
+static void SPI_NOR_SuspendDone(SPI_JobTypeDef* Job);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup SPI_Private_Functions
+  * @{
+  */
+
+/** @defgroup SPI_Group7 SPI NOR flash functions
+ *  @brief   SPI NOR flash functions
+ *
+@verbatim
+ ===============================================================================
+                          SPI NOR flash functions
+ ===============================================================================
+
+  This subsection provides functions allowing to read, program and erase an SPI
+  NOR flash memory without the CPU waiting for the memory.
+
+  The reads use the Fast Read command: the command, the address and the dummy
+  byte are one job of the SPI transaction engine, the data one or more jobs
+  received by DMA under the same chip select.
+
+  A background operation programs pages or erases sectors one after the other.
+  Each page or sector is a chain of two or three jobs: Write Enable, then the
+  command and its address, then the data of the page. When the chain ends, a
+  software timer reads the status register every ProgramPoll or ErasePoll
+  microseconds until the Write In Progress bit clears, and the next page or
+  sector is started from the interrupt of that read: the pages are programmed
+  back to back without the CPU polling the memory.
+
+  A read issued during a background operation holds it: a program operation
+  stops after the page in progress, an erase is suspended at the next poll of
+  the status register when the memory has the Erase Suspend command, or stops
+  after the sector in progress otherwise. The read then runs, and the operation
+  resumes where it stopped. A suspended erase runs ErasePoll microseconds at
+  least before the next suspend, so that it always progresses.
+
+  The block device holds one erase sector in SectorBuffer: the writes of its
+  512-byte sectors modify the buffer, which is programmed when another erase
+  sector is written or by SPI_NOR_Flush(). The pages left blank by the writes
+  are not programmed.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Fills each SPI_NOR_InitTypeDef member with its default value.
+  * @param  Init: pointer to an SPI_NOR_InitTypeDef structure which will be
+  *         initialized.
+  * @note   The default is a Winbond type memory at fPCLK/2, without block
+  *         device.
+  * @retval None
+  */
+void SPI_NOR_StructInit(SPI_NOR_InitTypeDef* Init)
+{
+  Init->Engine = 0;
+  Init->CS_GPIOx = 0;
+  Init->CS_Pin = 0;
+  Init->SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_2;
+  Init->BlockBase = 0;
+  Init->BlockSize = 0;
+  Init->SuspendCmd = 0x75;
+  Init->ResumeCmd = 0x7A;
+  Init->ProgramPoll = 200;
+  Init->ErasePoll = 2000;
+  Init->SectorBuffer = 0;
+}
+
+/**
+  * @brief  Initializes an SPI NOR flash memory.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Init: pointer to an SPI_NOR_InitTypeDef structure that contains
+  *         the configuration of the memory.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the memory answered its JEDEC identification
+  *          - ERROR: invalid configuration or no memory
+  */
+ErrorStatus SPI_NOR_Init(SPI_NOR_TypeDef* Nor, const SPI_NOR_InitTypeDef* Init)
+{
+  uint8_t id[3];
+
+  if ((Init->Engine == 0) || (Init->CS_GPIOx == 0) || (Init->ProgramPoll == 0) ||
+      (Init->ErasePoll == 0) || !IS_SPI_NOR_ALIGNED(Init->BlockBase) ||
+      !IS_SPI_NOR_ALIGNED(Init->BlockSize) ||
+      ((Init->BlockBase + Init->BlockSize) > SPI_NOR_MAX_SIZE) ||
+      ((Init->BlockSize != 0) && (Init->SectorBuffer == 0)))
+  {
+    return ERROR;
+  }
+
+  Nor->Init = *Init;
+  Nor->JedecId = 0;
+  Nor->Callback = 0;
+  Nor->State = SPI_NOR_IDLE;
+  Nor->Hold = 0;
+  Nor->Parked = 0;
+  Nor->Suspended = 0;
+  Nor->Failed = 0;
+  Nor->Address = 0;
+  Nor->Remaining = 0;
+  Nor->Step = 0;
+  Nor->pData = 0;
+  Nor->CacheSector = SPI_NOR_NO_SECTOR;
+  Nor->CacheDirty = 0;
+  memset(&Nor->Stat, 0, sizeof(Nor->Stat));
+
+  SPI_NOR_JobInit(Nor, &Nor->BgWren);
+  SPI_NOR_JobInit(Nor, &Nor->BgCmd);
+  SPI_NOR_JobInit(Nor, &Nor->BgData);
+  SPI_NOR_JobInit(Nor, &Nor->BgStatus);
+  SPI_NOR_JobInit(Nor, &Nor->FgCmd);
+  SPI_NOR_JobInit(Nor, &Nor->FgData);
+
+  Nor->BgWren.pTxData = &SPI_NOR_WrenCmd;
+  Nor->BgWren.Length = 1;
+  Nor->BgWren.Next = &Nor->BgCmd;
+  Nor->BgCmd.pTxData = Nor->BgCmdBuf;
+  Nor->BgStatus.pTxData = SPI_NOR_StatusCmd;
+  Nor->BgStatus.pRxData = Nor->StatusBuf;
+  Nor->BgStatus.Length = 2;
+  Nor->BgStatus.Callback = SPI_NOR_StatusDone;
+  Nor->FgCmd.pTxData = Nor->FgCmdBuf;
+
+  TIM_TimerInit(&Nor->Timer, SPI_NOR_Poll, Nor);
+
+  /* Release from deep power-down, then JEDEC identification */
+  Nor->FgCmdBuf[0] = SPI_NOR_CMD_RES;
+  if (SPI_NOR_Command(Nor, 1, 0, 0) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  Nor->FgCmdBuf[0] = SPI_NOR_CMD_RDID;
+  if (SPI_NOR_Command(Nor, 1, id, 3) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  Nor->JedecId = ((uint32_t)id[0] << 16) | ((uint32_t)id[1] << 8) | id[2];
+  if ((Nor->JedecId == 0) || (Nor->JedecId == 0xFFFFFF))
+  {
+    return ERROR;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reads the memory with the Fast Read command.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Address: first byte to read.
+  * @param  Buffer: receives the bytes.
+  * @param  Length: number of bytes.
+  * @note   A background operation is held during the read: the erase in
+  *         progress is suspended, or the read waits for the end of the page
+  *         or of the sector in progress.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the bytes are read
+  *          - ERROR: out of the memory, or SPI error
+  */
+ErrorStatus SPI_NOR_Read(SPI_NOR_TypeDef* Nor, uint32_t Address, uint8_t* Buffer, uint32_t Length)
+{
+  ErrorStatus status = SUCCESS;
+  uint32_t chunk = 0;
+
+  if ((Address >= SPI_NOR_MAX_SIZE) || (Length > (SPI_NOR_MAX_SIZE - Address)))
+  {
+    return ERROR;
+  }
+
+  SPI_NOR_Acquire(Nor);
+
+  while ((Length > 0) && (status == SUCCESS))
+  {
+    chunk = (Length > SPI_NOR_MAX_READ) ? SPI_NOR_MAX_READ : Length;
+
+    /* Command, 3-byte address and dummy byte */
+    Nor->FgCmdBuf[0] = SPI_NOR_CMD_FAST_READ;
+    Nor->FgCmdBuf[1] = (uint8_t)(Address >> 16);
+    Nor->FgCmdBuf[2] = (uint8_t)(Address >> 8);
+    Nor->FgCmdBuf[3] = (uint8_t)Address;
+    Nor->FgCmdBuf[4] = 0xFF;
+    status = SPI_NOR_Command(Nor, 5, Buffer, chunk);
+
+    Address += chunk;
+    Buffer += chunk;
+    Length -= chunk;
+  }
+
+  SPI_NOR_Release(Nor);
+
+  return status;
+}
+
+/**
+  * @brief  Starts programming the memory in the background.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Address: first byte to program, in an erased area.
+  * @param  Data: bytes to program, kept by the application until the end.
+  * @param  Length: number of bytes.
+  * @param  Callback: called from an interrupt at the end of the operation with
+  *         its status, or 0.
+  * @note   The bytes are programmed page after page, the first and the last
+  *         pages being partial if Address or Address + Length are not on a
+  *         page boundary.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the operation is started
+  *          - ERROR: out of the memory, or a background operation is running
+  */
+ErrorStatus SPI_NOR_ProgramAsync(SPI_NOR_TypeDef* Nor, uint32_t Address, const uint8_t* Data, uint32_t Length,
+                                 void (*Callback)(SPI_NOR_TypeDef* Nor, ErrorStatus Status))
+{
+  return SPI_NOR_Start(Nor, SPI_NOR_PROGRAM, Address, Data, Length, Callback);
+}
+
+/**
+  * @brief  Starts erasing the memory in the background.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Address: first byte to erase, a multiple of SPI_NOR_ERASE_SIZE.
+  * @param  Length: number of bytes, a multiple of SPI_NOR_ERASE_SIZE.
+  * @param  Callback: called from an interrupt at the end of the operation with
+  *         its status, or 0.
+  * @note   The aligned 64 KB blocks of the area are erased by the Block Erase
+  *         command, the other sectors by the Sector Erase command.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the operation is started
+  *          - ERROR: unaligned area or out of the memory, or a background
+  *            operation is running
+  */
+ErrorStatus SPI_NOR_EraseAsync(SPI_NOR_TypeDef* Nor, uint32_t Address, uint32_t Length,
+                               void (*Callback)(SPI_NOR_TypeDef* Nor, ErrorStatus Status))
+{
+  if (!IS_SPI_NOR_ALIGNED(Address) || !IS_SPI_NOR_ALIGNED(Length))
+  {
+    return ERROR;
+  }
+
+  return SPI_NOR_Start(Nor, SPI_NOR_ERASE, Address, 0, Length, Callback);
+}
+
+/**
+  * @brief  Programs the memory and waits for the end.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Address: first byte to program, in an erased area.
+  * @param  Data: bytes to program.
+  * @param  Length: number of bytes.
+  * @note   The background operation in progress, if any, ends first.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the bytes are programmed
+  *          - ERROR: out of the memory, or SPI error
+  */
+ErrorStatus SPI_NOR_Program(SPI_NOR_TypeDef* Nor, uint32_t Address, const uint8_t* Data, uint32_t Length)
+{
+  while (Nor->State != SPI_NOR_IDLE)
+  {
+  }
+
+  if (SPI_NOR_ProgramAsync(Nor, Address, Data, Length, 0) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  while (Nor->State != SPI_NOR_IDLE)
+  {
+  }
+
+  return (Nor->Failed != 0) ? ERROR : SUCCESS;
+}
+
+/**
+  * @brief  Erases the memory and waits for the end.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Address: first byte to erase, a multiple of SPI_NOR_ERASE_SIZE.
+  * @param  Length: number of bytes, a multiple of SPI_NOR_ERASE_SIZE.
+  * @note   The background operation in progress, if any, ends first.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the area is erased
+  *          - ERROR: unaligned area or out of the memory, or SPI error
+  */
+ErrorStatus SPI_NOR_Erase(SPI_NOR_TypeDef* Nor, uint32_t Address, uint32_t Length)
+{
+  while (Nor->State != SPI_NOR_IDLE)
+  {
+  }
+
+  if (SPI_NOR_EraseAsync(Nor, Address, Length, 0) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  while (Nor->State != SPI_NOR_IDLE)
+  {
+  }
+
+  return (Nor->Failed != 0) ? ERROR : SUCCESS;
+}
+
+/**
+  * @brief  Checks whether a background operation is running.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @retval The new state of the background operation (SET or RESET).
+  */
+FlagStatus SPI_NOR_Busy(SPI_NOR_TypeDef* Nor)
+{
+  return (Nor->State != SPI_NOR_IDLE) ? SET : RESET;
+}
+
+/**
+  * @brief  Reads sectors of the block device.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Buffer: receives Count * SPI_NOR_SECTOR_SIZE bytes.
+  * @param  Sector: first sector.
+  * @param  Count: number of sectors.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the sectors are read
+  *          - ERROR: out of the block device, or SPI error
+  */
+ErrorStatus SPI_NOR_ReadSectors(SPI_NOR_TypeDef* Nor, uint8_t* Buffer, uint32_t Sector, uint32_t Count)
+{
+  uint32_t run = 0;
+
+  if ((Sector > SPI_NOR_GetSectorCount(Nor)) || (Count > (SPI_NOR_GetSectorCount(Nor) - Sector)))
+  {
+    return ERROR;
+  }
+
+  while (Count > 0)
+  {
+    /* The modified sectors are read from the cache */
+    if ((Nor->CacheDirty != 0) && ((Sector / SPI_NOR_SECTORS_PER_ERASE) == Nor->CacheSector))
+    {
+      memcpy(Buffer, Nor->Init.SectorBuffer + ((Sector % SPI_NOR_SECTORS_PER_ERASE) * SPI_NOR_SECTOR_SIZE),
+             SPI_NOR_SECTOR_SIZE);
+      run = 1;
+    }
+    else
+    {
+      /* The others are read in one run up to the cached erase sector */
+      run = 1;
+      while ((run < Count) &&
+             ((Nor->CacheDirty == 0) || (((Sector + run) / SPI_NOR_SECTORS_PER_ERASE) != Nor->CacheSector)))
+      {
+        run++;
+      }
+
+      if (SPI_NOR_Read(Nor, Nor->Init.BlockBase + (Sector * SPI_NOR_SECTOR_SIZE), Buffer,
+                       run * SPI_NOR_SECTOR_SIZE) != SUCCESS)
+      {
+        return ERROR;
+      }
+    }
+
+    Sector += run;
+    Buffer += run * SPI_NOR_SECTOR_SIZE;
+    Count -= run;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Writes sectors of the block device.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Buffer: Count * SPI_NOR_SECTOR_SIZE bytes to write.
+  * @param  Sector: first sector.
+  * @param  Count: number of sectors.
+  * @note   The last erase sector written stays in SectorBuffer until
+  *         SPI_NOR_Flush() or the write of another erase sector.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the sectors are written
+  *          - ERROR: out of the block device, or SPI error
+  */
+ErrorStatus SPI_NOR_WriteSectors(SPI_NOR_TypeDef* Nor, const uint8_t* Buffer, uint32_t Sector, uint32_t Count)
+{
+  uint32_t erase = 0;
+
+  if ((Sector > SPI_NOR_GetSectorCount(Nor)) || (Count > (SPI_NOR_GetSectorCount(Nor) - Sector)))
+  {
+    return ERROR;
+  }
+
+  while (Count > 0)
+  {
+    erase = Sector / SPI_NOR_SECTORS_PER_ERASE;
+
+    if (erase != Nor->CacheSector)
+    {
+      if (SPI_NOR_Flush(Nor) != SUCCESS)
+      {
+        return ERROR;
+      }
+
+      /* The erase sector is read first unless it is entirely written */
+      Nor->CacheSector = SPI_NOR_NO_SECTOR;
+      if (((Sector % SPI_NOR_SECTORS_PER_ERASE) != 0) || (Count < SPI_NOR_SECTORS_PER_ERASE))
+      {
+        if (SPI_NOR_Read(Nor, Nor->Init.BlockBase + (erase * SPI_NOR_ERASE_SIZE), Nor->Init.SectorBuffer,
+                         SPI_NOR_ERASE_SIZE) != SUCCESS)
+        {
+          return ERROR;
+        }
+      }
+      Nor->CacheSector = erase;
+    }
+
+    memcpy(Nor->Init.SectorBuffer + ((Sector % SPI_NOR_SECTORS_PER_ERASE) * SPI_NOR_SECTOR_SIZE), Buffer,
+           SPI_NOR_SECTOR_SIZE);
+    Nor->CacheDirty = 1;
+
+    Sector++;
+    Buffer += SPI_NOR_SECTOR_SIZE;
+    Count--;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Programs the modified erase sector of the block device.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the block device is up to date in the memory
+  *          - ERROR: SPI error, the sector stays in the cache
+  */
+ErrorStatus SPI_NOR_Flush(SPI_NOR_TypeDef* Nor)
+{
+  uint32_t address = 0, first = 0, page = 0, i = 0;
+  const uint32_t* word;
+  uint32_t blank[SPI_NOR_ERASE_SIZE / SPI_NOR_PAGE_SIZE];
+
+  if (Nor->CacheDirty == 0)
+  {
+    return SUCCESS;
+  }
+
+  address = Nor->Init.BlockBase + (Nor->CacheSector * SPI_NOR_ERASE_SIZE);
+  if (SPI_NOR_Erase(Nor, address, SPI_NOR_ERASE_SIZE) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* Pages left erased by the writes */
+  for (page = 0; page < (SPI_NOR_ERASE_SIZE / SPI_NOR_PAGE_SIZE); page++)
+  {
+    word = (const uint32_t*)(Nor->Init.SectorBuffer + (page * SPI_NOR_PAGE_SIZE));
+    blank[page] = 1;
+    for (i = 0; i < (SPI_NOR_PAGE_SIZE / 4); i++)
+    {
+      if (word[i] != 0xFFFFFFFF)
+      {
+        blank[page] = 0;
+        break;
+      }
+    }
+  }
+
+  /* Each run of programmed pages in one background operation */
+  page = 0;
+  while (page < (SPI_NOR_ERASE_SIZE / SPI_NOR_PAGE_SIZE))
+  {
+    if (blank[page] != 0)
+    {
+      page++;
+      continue;
+    }
+
+    first = page;
+    while ((page < (SPI_NOR_ERASE_SIZE / SPI_NOR_PAGE_SIZE)) && (blank[page] == 0))
+    {
+      page++;
+    }
+
+    if (SPI_NOR_Program(Nor, address + (first * SPI_NOR_PAGE_SIZE),
+                        Nor->Init.SectorBuffer + (first * SPI_NOR_PAGE_SIZE),
+                        (page - first) * SPI_NOR_PAGE_SIZE) != SUCCESS)
+    {
+      return ERROR;
+    }
+  }
+
+  Nor->CacheDirty = 0;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the number of sectors of the block device.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @retval BlockSize / SPI_NOR_SECTOR_SIZE.
+  */
+uint32_t SPI_NOR_GetSectorCount(SPI_NOR_TypeDef* Nor)
+{
+  return (Nor->Init.BlockSize / SPI_NOR_SECTOR_SIZE);
+}
+
+/**
+  * @brief  Returns the statistics of the memory.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Stat: pointer to an SPI_NOR_StatTypeDef structure which receives
+  *         the statistics.
+  * @retval None
+  */
+void SPI_NOR_GetStat(SPI_NOR_TypeDef* Nor, SPI_NOR_StatTypeDef* Stat)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  *Stat = Nor->Stat;
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Fills a job of the memory.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Job: the job.
+  * @retval None
+  */
+static void SPI_NOR_JobInit(SPI_NOR_TypeDef* Nor, SPI_JobTypeDef* Job)
+{
+  SPI_XferJobStructInit(Job);
+  Job->CS_GPIOx = Nor->Init.CS_GPIOx;
+  Job->CS_Pin = Nor->Init.CS_Pin;
+  Job->SPI_BaudRatePrescaler = Nor->Init.SPI_BaudRatePrescaler;
+  Job->Context = Nor;
+  SPI_XferPrepare(Job);
+}
+
+/**
+  * @brief  Waits for the end of a job.
+  * @param  Job: the job.
+  * @retval SUCCESS if the job is done, ERROR if it failed or was aborted.
+  */
+static ErrorStatus SPI_NOR_Wait(SPI_JobTypeDef* Job)
+{
+  while ((Job->Status == SPI_JOB_QUEUED) || (Job->Status == SPI_JOB_ACTIVE))
+  {
+  }
+
+  return (Job->Status == SPI_JOB_DONE) ? SUCCESS : ERROR;
+}
+
+/**
+  * @brief  Sends the command held by FgCmdBuf, followed by the reception of
+  *         data under the same chip select, and waits for the end.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Length: bytes of the command.
+  * @param  Data: receives the data, or 0.
+  * @param  DataLength: bytes of data, up to 65535.
+  * @retval SUCCESS, or ERROR on an SPI error.
+  */
+static ErrorStatus SPI_NOR_Command(SPI_NOR_TypeDef* Nor, uint32_t Length, uint8_t* Data, uint32_t DataLength)
+{
+  ErrorStatus status = ERROR;
+
+  Nor->FgCmd.Length = (uint16_t)Length;
+  Nor->FgCmd.Flags = 0;
+  Nor->FgCmd.Next = 0;
+
+  if (DataLength != 0)
+  {
+    Nor->FgCmd.Flags = SPI_JOB_CS_HOLD;
+    Nor->FgCmd.Next = &Nor->FgData;
+    Nor->FgData.pRxData = Data;
+    Nor->FgData.Length = (uint16_t)DataLength;
+  }
+
+  if (SPI_XferSubmitChain(Nor->Init.Engine, &Nor->FgCmd) == SUCCESS)
+  {
+    status = SPI_NOR_Wait((DataLength != 0) ? &Nor->FgData : &Nor->FgCmd);
+  }
+  if (status != SUCCESS)
+  {
+    Nor->Stat.Errors++;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Holds the background operation for a read, and waits until it is
+  *         stopped or its erase suspended.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @retval None
+  */
+static void SPI_NOR_Acquire(SPI_NOR_TypeDef* Nor)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  Nor->Hold = 1;
+  if (Nor->State == SPI_NOR_IDLE)
+  {
+    Nor->Parked = 1;
+  }
+  else
+  {
+    Nor->Stat.Waits++;
+  }
+
+  NVIC_ExitCritical(primask);
+
+  while (Nor->Parked == 0)
+  {
+  }
+}
+
+/**
+  * @brief  Resumes the background operation held by SPI_NOR_Acquire().
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @retval None
+  */
+static void SPI_NOR_Release(SPI_NOR_TypeDef* Nor)
+{
+  uint32_t primask = 0;
+
+  if (Nor->Suspended != 0)
+  {
+    /* The erase goes on for ErasePoll before the next suspend */
+    Nor->FgCmdBuf[0] = Nor->Init.ResumeCmd;
+    (void)SPI_NOR_Command(Nor, 1, 0, 0);
+    Nor->Suspended = 0;
+
+    primask = NVIC_EnterCritical();
+    Nor->Hold = 0;
+    Nor->Parked = 0;
+    (void)TIM_TimerStart(&Nor->Timer, Nor->Init.ErasePoll, 0);
+    NVIC_ExitCritical(primask);
+    return;
+  }
+
+  primask = NVIC_EnterCritical();
+
+  Nor->Hold = 0;
+  Nor->Parked = 0;
+  if (Nor->State != SPI_NOR_IDLE)
+  {
+    SPI_NOR_Next(Nor);
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Starts a background operation.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  State: SPI_NOR_PROGRAM or SPI_NOR_ERASE.
+  * @param  Address: first byte.
+  * @param  Data: bytes to program, or 0.
+  * @param  Length: number of bytes.
+  * @param  Callback: called at the end of the operation, or 0.
+  * @retval SUCCESS, or ERROR if out of the memory or if a background
+  *         operation is running.
+  */
+static ErrorStatus SPI_NOR_Start(SPI_NOR_TypeDef* Nor, uint32_t State, uint32_t Address, const uint8_t* Data,
+                                 uint32_t Length, void (*Callback)(SPI_NOR_TypeDef* Nor, ErrorStatus Status))
+{
+  uint32_t primask = 0;
+
+  if ((Address >= SPI_NOR_MAX_SIZE) || (Length > (SPI_NOR_MAX_SIZE - Address)))
+  {
+    return ERROR;
+  }
+
+  primask = NVIC_EnterCritical();
+
+  if (Nor->State != SPI_NOR_IDLE)
+  {
+    NVIC_ExitCritical(primask);
+    return ERROR;
+  }
+
+  Nor->State = State;
+  Nor->Address = Address;
+  Nor->pData = Data;
+  Nor->Remaining = Length;
+  Nor->Callback = Callback;
+  Nor->Failed = 0;
+
+  /* Started at once, or when the read in progress ends */
+  if (Nor->Hold == 0)
+  {
+    SPI_NOR_Next(Nor);
+  }
+
+  NVIC_ExitCritical(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Starts the next page or sector of the background operation, or
+  *         ends it.
+  * @note   This function is called with the interrupts disabled or from the
+  *         interrupts of the background operation.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @retval None
+  */
+static void SPI_NOR_Next(SPI_NOR_TypeDef* Nor)
+{
+  uint8_t cmd = SPI_NOR_CMD_SE;
+
+  if (Nor->Remaining == 0)
+  {
+    SPI_NOR_Finish(Nor, SUCCESS);
+    return;
+  }
+
+  /* A read is waiting: it runs before the next page or sector */
+  if (Nor->Hold != 0)
+  {
+    Nor->Parked = 1;
+    return;
+  }
+
+  if (Nor->State == SPI_NOR_PROGRAM)
+  {
+    /* Up to the end of the page */
+    Nor->Step = SPI_NOR_PAGE_SIZE - (Nor->Address & (SPI_NOR_PAGE_SIZE - 1));
+    if (Nor->Step > Nor->Remaining)
+    {
+      Nor->Step = Nor->Remaining;
+    }
+    cmd = SPI_NOR_CMD_PP;
+
+    Nor->BgCmd.Flags = SPI_JOB_CS_HOLD;
+    Nor->BgCmd.Next = &Nor->BgData;
+    Nor->BgCmd.Callback = 0;
+    Nor->BgData.pTxData = Nor->pData;
+    Nor->BgData.Length = (uint16_t)Nor->Step;
+    Nor->BgData.Callback = SPI_NOR_Issued;
+  }
+  else
+  {
+    /* 64 KB blocks where aligned, 4 KB sectors elsewhere */
+    Nor->Step = SPI_NOR_ERASE_SIZE;
+    if (((Nor->Address & (SPI_NOR_BLOCK_SIZE - 1)) == 0) && (Nor->Remaining >= SPI_NOR_BLOCK_SIZE))
+    {
+      Nor->Step = SPI_NOR_BLOCK_SIZE;
+      cmd = SPI_NOR_CMD_BE;
+    }
+
+    Nor->BgCmd.Flags = 0;
+    Nor->BgCmd.Next = 0;
+    Nor->BgCmd.Callback = SPI_NOR_Issued;
+  }
+
+  Nor->BgCmdBuf[0] = cmd;
+  Nor->BgCmdBuf[1] = (uint8_t)(Nor->Address >> 16);
+  Nor->BgCmdBuf[2] = (uint8_t)(Nor->Address >> 8);
+  Nor->BgCmdBuf[3] = (uint8_t)Nor->Address;
+  Nor->BgCmd.Length = 4;
+
+  if (SPI_XferSubmitChain(Nor->Init.Engine, &Nor->BgWren) != SUCCESS)
+  {
+    Nor->Stat.Errors++;
+    SPI_NOR_Finish(Nor, ERROR);
+  }
+}
+
+/**
+  * @brief  Ends the background operation and calls its Callback.
+  * @param  Nor: pointer to the SPI_NOR_TypeDef structure of the memory.
+  * @param  Status: status of the operation.
+  * @retval None
+  */
+static void SPI_NOR_Finish(SPI_NOR_TypeDef* Nor, ErrorStatus Status)
+{
+  void (*callback)(SPI_NOR_TypeDef* Nor, ErrorStatus Status) = Nor->Callback;
+
+  Nor->Callback = 0;
+  Nor->Remaining = 0;
+  Nor->Suspended = 0;
+  Nor->Failed = (Status != SUCCESS) ? 1 : 0;
+  Nor->State = SPI_NOR_IDLE;
+
+  /* A waiting read may go */
+  if (Nor->Hold != 0)
+  {
+    Nor->Parked = 1;
+  }
+
+  if (callback != 0)
+  {
+    callback(Nor, Status);
+  }
+}
+
+/**
+  * @brief  End of the chain of a page or a sector: the memory is busy until
+  *         the Write In Progress bit clears.
+  * @param  Job: the last job of the chain.
+  * @retval None
+  */
+static void SPI_NOR_Issued(SPI_JobTypeDef* Job)
+{
+  SPI_NOR_TypeDef* nor = (SPI_NOR_TypeDef*)Job->Context;
+
+  if (Job->Status != SPI_JOB_DONE)
+  {
+    nor->Stat.Errors++;
+    SPI_NOR_Finish(nor, ERROR);
+    return;
+  }
+
+  nor->Address += nor->Step;
+  nor->Remaining -= nor->Step;
+  if (nor->State == SPI_NOR_PROGRAM)
+  {
+    nor->pData += nor->Step;
+    nor->Stat.Pages++;
+  }
+  else
+  {
+    nor->Stat.Erases++;
+  }
+
+  (void)TIM_TimerStart(&nor->Timer, (nor->State == SPI_NOR_PROGRAM) ? nor->Init.ProgramPoll :
+                       nor->Init.ErasePoll, 0);
+}
+
+/**
+  * @brief  Reads the status register when the polling timer expires.
+  * @param  Timer: the polling timer.
+  * @retval None
+  */
+static void SPI_NOR_Poll(TIM_TimerTypeDef* Timer)
+{
+  SPI_NOR_TypeDef* nor = (SPI_NOR_TypeDef*)Timer->Context;
+
+  nor->Stat.Polls++;
+  if (SPI_XferSubmit(nor->Init.Engine, &nor->BgStatus) != SUCCESS)
+  {
+    nor->Stat.Errors++;
+    SPI_NOR_Finish(nor, ERROR);
+  }
+}
+
+/**
+  * @brief  End of a read of the status register: goes on with the background
+  *         operation, suspends the erase for a waiting read, or polls again.
+  * @param  Job: the status register job.
+  * @retval None
+  */
+static void SPI_NOR_StatusDone(SPI_JobTypeDef* Job)
+{
+  SPI_NOR_TypeDef* nor = (SPI_NOR_TypeDef*)Job->Context;
+
+  if (Job->Status != SPI_JOB_DONE)
+  {
+    nor->Stat.Errors++;
+    SPI_NOR_Finish(nor, ERROR);
+    return;
+  }
+
+  if ((nor->StatusBuf[1] & SPI_NOR_SR_WIP) != 0)
+  {
+    if ((nor->State == SPI_NOR_ERASE) && (nor->Hold != 0) && (nor->Suspended == 0) &&
+        (nor->Init.SuspendCmd != 0))
+    {
+      /* A read is waiting: suspend the erase */
+      nor->BgCmdBuf[0] = nor->Init.SuspendCmd;
+      nor->BgCmd.Length = 1;
+      nor->BgCmd.Flags = 0;
+      nor->BgCmd.Next = 0;
+      nor->BgCmd.Callback = SPI_NOR_SuspendDone;
+      if (SPI_XferSubmit(nor->Init.Engine, &nor->BgCmd) != SUCCESS)
+      {
+        nor->Stat.Errors++;
+        SPI_NOR_Finish(nor, ERROR);
+      }
+      return;
+    }
+
+    (void)TIM_TimerStart(&nor->Timer, ((nor->State == SPI_NOR_ERASE) && (nor->Suspended == 0)) ?
+                         nor->Init.ErasePoll : nor->Init.ProgramPoll, 0);
+    return;
+  }
+
+  if (nor->Suspended != 0)
+  {
+    /* The erase is suspended: the read may go */
+    nor->Parked = 1;
+    return;
+  }
+
+  SPI_NOR_Next(nor);
+}
+
+/**
+  * @brief  End of the Erase Suspend command: the memory stays busy until the
+  *         erase is suspended.
+  * @param  Job: the command job.
+  * @retval None
+  */
+static void SPI_NOR_SuspendDone(SPI_JobTypeDef* Job)
+{
+  SPI_NOR_TypeDef* nor = (SPI_NOR_TypeDef*)Job->Context;
+
+  if (Job->Status != SPI_JOB_DONE)
+  {
+    nor->Stat.Errors++;
+    SPI_NOR_Finish(nor, ERROR);
+    return;
+  }
+
+  nor->Suspended = 1;
+  nor->Stat.Suspends++;
+  (void)TIM_TimerStart(&nor->Timer, nor->Init.ProgramPoll, 0);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,644 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_spi_xfer.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a DMA transaction engine for the SPI in master
+  *          mode:
+  *           - Queue of jobs, each with its chip select, clock mode, data size,
+  *             baud rate and TX/RX buffers
+  *           - Chaining of the jobs from the DMA Transfer Complete interrupt
+  *           - Prepared chains of jobs for the repeated sequences
+  *          It uses the stm32f4xx_spi.c/.h, stm32f4xx_gpio.c/.h and
+  *          stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the SPI, GPIO and DMA clocks, configure the SCK, MISO and
+  *             MOSI pins in alternate function and the chip select pins in output
+  *             push-pull mode, set high. Call DMA_MgrInit().
+  *
+  *          2. Call SPI_XferInit() with an SPI_XferEngineTypeDef structure for the
+  *             SPI, then call DMA_MgrIRQHandler() from the interrupt handlers of
+  *             the two streams of the SPI RX and TX requests.
+  *
+  *          3. Fill SPI_JobTypeDef structures, starting from SPI_XferJobStructInit(),
+  *             and queue them using SPI_XferSubmit(). The jobs run in the order
+  *             they are queued, and the Callback of each job is called from the
+  *             DMA interrupt at its end. The job belongs to the engine until its
+  *             Status is no longer SPI_JOB_QUEUED or SPI_JOB_ACTIVE.
+  *
+  *          4. For a sequence queued again and again, for example the reading
+  *             of a set of sensors from a timer interrupt, link the jobs through
+  *             their Next member, call SPI_XferPrepare() once for each job and
+  *             queue the whole chain using SPI_XferSubmitChain().
+  *
+  *          5. Stop the engine using SPI_XferAbort(), and release the DMA streams
+  *             using SPI_XferDeInit().
+  *
+  * @note   A job whose pTxData is 0 sends 0xFF (0xFFFF in 16-bit), a job whose
+  *         pRxData is 0 discards the received frames: the same job structure
+  *         covers the write, read and full duplex transactions.
+  *
+  * @note   With SPI_JOB_CS_HOLD the chip select stays low at the end of the job,
+  *         so that a command and its data may be given as two jobs. It is
+  *         released at the end of the next job of the same chip select without
+  *         this flag, or when a job of another chip select starts.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_spi_xfer.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup SPI
+  * @brief SPI driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SPI_XFER_DMA_CR_MASK    (DMA_SxCR_PSIZE | DMA_SxCR_MSIZE | DMA_SxCR_MINC)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void SPI_XferQueue(SPI_XferEngineTypeDef* Engine, SPI_JobTypeDef* First, SPI_JobTypeDef* Last);
+static void SPI_XferStart(SPI_XferEngineTypeDef* Engine);
+static void SPI_XferDrain(SPI_TypeDef* SPIx);
+static void SPI_XferRxDone(DMA_MgrXferTypeDef* Xfer);
+static void SPI_XferTxDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup SPI_Private_Functions
+  * @{
+  */
+
+/** @defgroup SPI_Group6 SPI transaction engine functions
+ *  @brief   SPI transaction engine functions
+ *
+@verbatim
+ ===============================================================================
+                      SPI transaction engine functions
+ ===============================================================================
+
+  This subsection provides functions allowing to run queues of SPI transactions
+  by DMA, without the CPU polling the flags of the SPI.
+
+  Each job is one DMA transfer on the RX stream and one on the TX stream. The
+  end of a job is given by the Transfer Complete interrupt of the RX stream,
+  which comes after the last frame is received. From this interrupt the engine
+  releases the chip select, then starts the next queued job before calling the
+  Callback of the completed one: the gap between two jobs is the time to
+  reprogram the SPI and the two streams.
+
+  The SPI is only disabled to change the configuration (CPOL, CPHA, data size,
+  baud rate or bit order) between two jobs. SPI_XferPrepare() computes the
+  configuration of a job once: SPI_XferSubmitChain() queues prepared jobs
+  without computing it again.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes an SPI transaction engine and allocates its DMA streams.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @param  SPIx: where x can be 1, 2 or 3 to select the SPI peripheral.
+  * @note   The SPI runs in master mode, full duplex, with a software NSS.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the engine is ready
+  *          - ERROR: no free DMA stream for the SPI requests
+  */
+ErrorStatus SPI_XferInit(SPI_XferEngineTypeDef* Engine, SPI_TypeDef* SPIx)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  uint32_t rxrequest = DMA_MGR_REQ_SPI1_RX, txrequest = DMA_MGR_REQ_SPI1_TX;
+
+  /* Check the parameters */
+  assert_param(IS_SPI_ALL_PERIPH(SPIx));
+
+  if (SPIx == SPI2)
+  {
+    rxrequest = DMA_MGR_REQ_SPI2_RX;
+    txrequest = DMA_MGR_REQ_SPI2_TX;
+  }
+  else if (SPIx == SPI3)
+  {
+    rxrequest = DMA_MGR_REQ_SPI3_RX;
+    txrequest = DMA_MGR_REQ_SPI3_TX;
+  }
+
+  Engine->SPIx = SPIx;
+  Engine->Active = 0;
+  Engine->Head = 0;
+  Engine->Tail = 0;
+  Engine->CS_GPIOx = 0;
+  Engine->CS_Pin = 0;
+  Engine->CR1 = 0;
+  Engine->TxIndex = 0;
+  Engine->TxDummy = 0xFFFF;
+  Engine->RxSink = 0;
+
+  /* The data sizes and the memory increment are set for each job */
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&SPIx->DR;
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+
+  /* The RX stream has the higher priority so that the SPI never overruns */
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  Engine->RxStream = DMA_MgrAlloc(rxrequest, &DMA_InitStructure);
+  if (Engine->RxStream == 0)
+  {
+    return ERROR;
+  }
+
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+  Engine->TxStream = DMA_MgrAlloc(txrequest, &DMA_InitStructure);
+  if (Engine->TxStream == 0)
+  {
+    DMA_MgrFree(Engine->RxStream);
+    Engine->RxStream = 0;
+    return ERROR;
+  }
+
+  Engine->RxXfer.Callback = SPI_XferRxDone;
+  Engine->RxXfer.Context = Engine;
+  Engine->TxXfer[0].Callback = SPI_XferTxDone;
+  Engine->TxXfer[0].Context = Engine;
+  Engine->TxXfer[1].Callback = SPI_XferTxDone;
+  Engine->TxXfer[1].Context = Engine;
+
+  /* The SPI is configured by the first job */
+  SPI_Cmd(SPIx, DISABLE);
+  SPI_I2S_DMACmd(SPIx, SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Aborts the jobs of an engine and releases its DMA streams.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @retval None
+  */
+void SPI_XferDeInit(SPI_XferEngineTypeDef* Engine)
+{
+  SPI_XferAbort(Engine);
+
+  SPI_I2S_DMACmd(Engine->SPIx, SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, DISABLE);
+  SPI_Cmd(Engine->SPIx, DISABLE);
+  Engine->CR1 = 0;
+
+  if (Engine->RxStream != 0)
+  {
+    DMA_MgrFree(Engine->RxStream);
+    Engine->RxStream = 0;
+  }
+  if (Engine->TxStream != 0)
+  {
+    DMA_MgrFree(Engine->TxStream);
+    Engine->TxStream = 0;
+  }
+}
+
+/**
+  * @brief  Fills each SPI_JobTypeDef member with its default value.
+  * @param  Job: pointer to an SPI_JobTypeDef structure which will be initialized.
+  * @note   The default job is an 8-bit, mode 0, MSB first transaction at
+  *         fPCLK/256 without chip select.
+  * @retval None
+  */
+void SPI_XferJobStructInit(SPI_JobTypeDef* Job)
+{
+  Job->CS_GPIOx = 0;
+  Job->CS_Pin = 0;
+  Job->SPI_CPOL = SPI_CPOL_Low;
+  Job->SPI_CPHA = SPI_CPHA_1Edge;
+  Job->SPI_DataSize = SPI_DataSize_8b;
+  Job->SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_256;
+  Job->SPI_FirstBit = SPI_FirstBit_MSB;
+  Job->Flags = 0;
+  Job->Length = 0;
+  Job->pTxData = 0;
+  Job->pRxData = 0;
+  Job->Callback = 0;
+  Job->Context = 0;
+  Job->Status = SPI_JOB_DONE;
+  Job->Next = 0;
+  Job->CR1 = 0;
+  Job->Link = 0;
+}
+
+/**
+  * @brief  Computes the SPI configuration of a job.
+  * @param  Job: pointer to the SPI_JobTypeDef structure of the job.
+  * @note   This function must be called again when the clock mode, the data
+  *         size, the baud rate or the bit order of a prepared job is changed.
+  * @retval None
+  */
+void SPI_XferPrepare(SPI_JobTypeDef* Job)
+{
+  /* Check the parameters */
+  assert_param(IS_SPI_CPOL(Job->SPI_CPOL));
+  assert_param(IS_SPI_CPHA(Job->SPI_CPHA));
+  assert_param(IS_SPI_DATASIZE(Job->SPI_DataSize));
+  assert_param(IS_SPI_BAUDRATE_PRESCALER(Job->SPI_BaudRatePrescaler));
+  assert_param(IS_SPI_FIRST_BIT(Job->SPI_FirstBit));
+  assert_param(IS_SPI_JOB_FLAGS(Job->Flags));
+
+  Job->CR1 = (uint16_t)(SPI_Direction_2Lines_FullDuplex | SPI_Mode_Master | SPI_NSS_Soft |
+                        Job->SPI_CPOL | Job->SPI_CPHA | Job->SPI_DataSize |
+                        Job->SPI_BaudRatePrescaler | Job->SPI_FirstBit);
+}
+
+/**
+  * @brief  Queues a job.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @param  Job: pointer to the SPI_JobTypeDef structure of the job. Its Next
+  *         member is not used.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the job is queued
+  *          - ERROR: the job has no frame
+  */
+ErrorStatus SPI_XferSubmit(SPI_XferEngineTypeDef* Engine, SPI_JobTypeDef* Job)
+{
+  if (Job->Length == 0)
+  {
+    return ERROR;
+  }
+
+  SPI_XferPrepare(Job);
+  Job->Status = SPI_JOB_QUEUED;
+  SPI_XferQueue(Engine, Job, Job);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Queues a chain of prepared jobs.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @param  First: the first job of the chain. The jobs are linked through their
+  *         Next member, the Next member of the last one is 0.
+  * @note   SPI_XferPrepare() must have been called for each job. The chain is
+  *         kept, so that it may be queued again once its jobs are done.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the jobs are queued
+  *          - ERROR: a job has no frame or is not prepared, no job is queued
+  */
+ErrorStatus SPI_XferSubmitChain(SPI_XferEngineTypeDef* Engine, SPI_JobTypeDef* First)
+{
+  SPI_JobTypeDef* job;
+  SPI_JobTypeDef* last = First;
+
+  if (First == 0)
+  {
+    return ERROR;
+  }
+
+  for (job = First; job != 0; job = job->Next)
+  {
+    if ((job->Length == 0) || (job->CR1 == 0))
+    {
+      return ERROR;
+    }
+  }
+
+  for (job = First; job != 0; job = job->Next)
+  {
+    job->Status = SPI_JOB_QUEUED;
+    job->Link = job->Next;
+    last = job;
+  }
+
+  SPI_XferQueue(Engine, First, last);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops the job in progress and aborts all the queued jobs.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @note   The Callback of the aborted jobs is called with their Status set to
+  *         SPI_JOB_ABORTED, and the chip selects are released.
+  * @retval None
+  */
+void SPI_XferAbort(SPI_XferEngineTypeDef* Engine)
+{
+  SPI_JobTypeDef* job;
+  SPI_JobTypeDef* next;
+  uint32_t primask = NVIC_EnterCritical();
+
+  /* Chain the job in progress before the queued jobs */
+  job = Engine->Head;
+  if (Engine->Active != 0)
+  {
+    Engine->Active->Link = job;
+    job = Engine->Active;
+
+    if (Engine->Active->CS_GPIOx != 0)
+    {
+      GPIO_SetBits(Engine->Active->CS_GPIOx, Engine->Active->CS_Pin);
+    }
+  }
+  Engine->Active = 0;
+  Engine->Head = 0;
+  Engine->Tail = 0;
+
+  if (Engine->CS_GPIOx != 0)
+  {
+    GPIO_SetBits(Engine->CS_GPIOx, Engine->CS_Pin);
+    Engine->CS_GPIOx = 0;
+  }
+
+  /* No job is active: the callbacks of the DMA transfers return at once */
+  if (Engine->RxStream != 0)
+  {
+    DMA_MgrAbort(Engine->RxStream);
+  }
+  if (Engine->TxStream != 0)
+  {
+    DMA_MgrAbort(Engine->TxStream);
+  }
+
+  /* The SPI is disabled in the middle of a frame: it is configured again by
+     the next job */
+  SPI_Cmd(Engine->SPIx, DISABLE);
+  Engine->CR1 = 0;
+  SPI_XferDrain(Engine->SPIx);
+
+  NVIC_ExitCritical(primask);
+
+  while (job != 0)
+  {
+    next = job->Link;
+    job->Status = SPI_JOB_ABORTED;
+    if (job->Callback != 0)
+    {
+      job->Callback(job);
+    }
+    job = next;
+  }
+}
+
+/**
+  * @brief  Checks whether an engine has a job in progress or queued.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @retval The new state of the engine (SET or RESET).
+  */
+FlagStatus SPI_XferBusy(SPI_XferEngineTypeDef* Engine)
+{
+  if ((Engine->Active != 0) || (Engine->Head != 0))
+  {
+    return SET;
+  }
+  return RESET;
+}
+
+/**
+  * @brief  Appends jobs to the queue and starts the first one if the engine is
+  *         idle.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @param  First: the first job, linked to the others through their Link member.
+  * @param  Last: the last job.
+  * @retval None
+  */
+static void SPI_XferQueue(SPI_XferEngineTypeDef* Engine, SPI_JobTypeDef* First, SPI_JobTypeDef* Last)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  Last->Link = 0;
+  if (Engine->Tail != 0)
+  {
+    Engine->Tail->Link = First;
+  }
+  else
+  {
+    Engine->Head = First;
+  }
+  Engine->Tail = Last;
+
+  if (Engine->Active == 0)
+  {
+    SPI_XferStart(Engine);
+  }
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Starts the first queued job.
+  * @param  Engine: pointer to the SPI_XferEngineTypeDef structure of the SPI.
+  * @note   The two DMA streams are disabled: the RX stream by the end of the
+  *         previous job, the TX stream by the end of its last transfer, which
+  *         comes before.
+  * @retval None
+  */
+static void SPI_XferStart(SPI_XferEngineTypeDef* Engine)
+{
+  SPI_JobTypeDef* job = Engine->Head;
+  DMA_MgrXferTypeDef* txxfer;
+  uint32_t size = 0;
+
+  if (job == 0)
+  {
+    return;
+  }
+
+  Engine->Head = job->Link;
+  if (Engine->Head == 0)
+  {
+    Engine->Tail = 0;
+  }
+  Engine->Active = job;
+  job->Status = SPI_JOB_ACTIVE;
+
+  /* Release a chip select held for another device */
+  if ((Engine->CS_GPIOx != 0) &&
+      ((Engine->CS_GPIOx != job->CS_GPIOx) || (Engine->CS_Pin != job->CS_Pin)))
+  {
+    GPIO_SetBits(Engine->CS_GPIOx, Engine->CS_Pin);
+  }
+  Engine->CS_GPIOx = 0;
+
+  /* CPOL, CPHA, DFF, BR and LSBFIRST are written while the SPI is disabled */
+  if (job->CR1 != Engine->CR1)
+  {
+    Engine->SPIx->CR1 = job->CR1;
+    Engine->SPIx->CR1 = job->CR1 | SPI_CR1_SPE;
+    Engine->CR1 = job->CR1;
+  }
+
+  if (job->CS_GPIOx != 0)
+  {
+    GPIO_ResetBits(job->CS_GPIOx, job->CS_Pin);
+  }
+
+  if (job->SPI_DataSize == SPI_DataSize_16b)
+  {
+    size = DMA_PeripheralDataSize_HalfWord | DMA_MemoryDataSize_HalfWord;
+  }
+
+  Engine->RxStream->CR = (Engine->RxStream->CR & ~SPI_XFER_DMA_CR_MASK) | size |
+                         ((job->pRxData != 0) ? DMA_MemoryInc_Enable : DMA_MemoryInc_Disable);
+  Engine->TxStream->CR = (Engine->TxStream->CR & ~SPI_XFER_DMA_CR_MASK) | size |
+                         ((job->pTxData != 0) ? DMA_MemoryInc_Enable : DMA_MemoryInc_Disable);
+
+  Engine->RxXfer.MemoryBaseAddr = (job->pRxData != 0) ? (uint32_t)job->pRxData :
+                                                        (uint32_t)&Engine->RxSink;
+  Engine->RxXfer.Count = job->Length;
+
+  txxfer = &Engine->TxXfer[Engine->TxIndex];
+  Engine->TxIndex ^= 1;
+  txxfer->MemoryBaseAddr = (job->pTxData != 0) ? (uint32_t)job->pTxData :
+                                                 (uint32_t)&Engine->TxDummy;
+  txxfer->Count = job->Length;
+
+  /* The RX stream runs before the first frame is sent */
+  DMA_MgrSubmit(Engine->RxStream, &Engine->RxXfer);
+  DMA_MgrSubmit(Engine->TxStream, txxfer);
+}
+
+/**
+  * @brief  Empties the receive buffer of the SPI and clears its overrun flag.
+  * @param  SPIx: where x can be 1, 2 or 3 to select the SPI peripheral.
+  * @retval None
+  */
+static void SPI_XferDrain(SPI_TypeDef* SPIx)
+{
+  while (SPI_I2S_GetFlagStatus(SPIx, SPI_I2S_FLAG_RXNE) != RESET)
+  {
+    SPI_I2S_ReceiveData(SPIx);
+  }
+
+  /* OVR is cleared by a read of DR followed by a read of SR */
+  SPI_I2S_ReceiveData(SPIx);
+  SPI_I2S_GetFlagStatus(SPIx, SPI_I2S_FLAG_OVR);
+}
+
+/**
+  * @brief  Callback of the RX DMA transfer: ends the job in progress and starts
+  *         the next one.
+  * @param  Xfer: the RX DMA transfer.
+  * @retval None
+  */
+static void SPI_XferRxDone(DMA_MgrXferTypeDef* Xfer)
+{
+  SPI_XferEngineTypeDef* engine = (SPI_XferEngineTypeDef*)Xfer->Context;
+  SPI_JobTypeDef* job = engine->Active;
+  uint32_t status = SPI_JOB_DONE;
+
+  /* Aborted by SPI_XferAbort() */
+  if (job == 0)
+  {
+    return;
+  }
+  engine->Active = 0;
+
+  if (Xfer->Status != DMA_MGR_XFER_DONE)
+  {
+    /* RX stream error, or TX stream error reported by SPI_XferTxDone() */
+    status = SPI_JOB_ERROR;
+    if (Xfer->Status == DMA_MGR_XFER_ERROR)
+    {
+      DMA_MgrAbort(engine->TxStream);
+    }
+    SPI_Cmd(engine->SPIx, DISABLE);
+    engine->CR1 = 0;
+    SPI_XferDrain(engine->SPIx);
+  }
+
+  /* The last frame is received: wait for the end of its last clock edge */
+  while (SPI_I2S_GetFlagStatus(engine->SPIx, SPI_I2S_FLAG_BSY) != RESET)
+  {
+  }
+
+  if (job->CS_GPIOx != 0)
+  {
+    if (((job->Flags & SPI_JOB_CS_HOLD) != 0) && (status == SPI_JOB_DONE))
+    {
+      engine->CS_GPIOx = job->CS_GPIOx;
+      engine->CS_Pin = job->CS_Pin;
+    }
+    else
+    {
+      GPIO_SetBits(job->CS_GPIOx, job->CS_Pin);
+    }
+  }
+
+  /* Start the next job before the callback of this one */
+  SPI_XferStart(engine);
+
+  job->Status = status;
+  if (job->Callback != 0)
+  {
+    job->Callback(job);
+  }
+}
+
+/**
+  * @brief  Callback of the TX DMA transfers.
+  * @param  Xfer: the TX DMA transfer.
+  * @note   The job ends with its RX transfer: a TX error aborts the RX transfer,
+  *         which ends the job in error.
+  * @retval None
+  */
+static void SPI_XferTxDone(DMA_MgrXferTypeDef* Xfer)
+{
+  SPI_XferEngineTypeDef* engine = (SPI_XferEngineTypeDef*)Xfer->Context;
+
+  if ((Xfer->Status == DMA_MGR_XFER_ERROR) && (engine->Active != 0))
+  {
+    DMA_MgrAbort(engine->RxStream);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
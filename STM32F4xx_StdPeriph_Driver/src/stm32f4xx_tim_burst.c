@@ -0,0 +1,489 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_tim_burst.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a DMA burst engine for the timers, to write
+  *          several registers of a timer at each update event without CPU:
+  *           - Update of all the compare registers at once, applied at the
+  *             same update event
+  *           - Playback of waveform tables, one frame per update event
+  *           - Synchronized start of master and slave timers with a phase
+  *             offset
+  *          It uses the stm32f4xx_tim.c/.h and stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the TIM, GPIO and DMA clocks, configure the output pins in
+  *             alternate function, the time base using TIM_TimeBaseInit() and the
+  *             channels using TIM_OCxInit(), and call DMA_MgrInit().
+  *
+  *          2. For multi-phase outputs, call TIM_BurstSync() for each slave timer
+  *             with its phase offset.
+  *
+  *          3. Call TIM_BurstInit() with a TIM_BurstTypeDef structure for each
+  *             timer, and call DMA_MgrIRQHandler() from the interrupt handler of
+  *             the stream of the update request of the timer.
+  *              - Frames = 0: the registers are written with TIM_BurstWrite(),
+  *                for example from a control loop.
+  *              - Frames > 0: the registers are written from waveform segments
+  *                of Frames frames queued with TIM_BurstQueue().
+  *
+  *          4. Start the engine with TIM_BurstStart(): the timer counter is
+  *             enabled, except for the slaves started by their master.
+  *
+  *          5. Stop the engine with TIM_BurstStop() and release its DMA stream
+  *             with TIM_BurstDeInit().
+  *
+  * @note   The preload of the compare and auto-reload registers written by the
+  *         burst is enabled: the values written after an update event take
+  *         effect together at the next update event.
+  *
+  * @note   For a seamless waveform, at least two segments must be queued: the
+  *         engine uses the streaming mode of the DMA manager. A table played
+  *         forever is given as two looping segments, one per half.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_tim_burst.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup TIM
+  * @brief TIM driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TIM_BURST_TIMERS          ((uint32_t)6)
+#define TIM_BURST_MAX_REGISTERS   ((uint8_t)18)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* Timers with a DMA burst and an update DMA request */
+static TIM_TypeDef* const TIM_BurstTimers[TIM_BURST_TIMERS] =
+{
+  TIM1, TIM2, TIM3, TIM4, TIM5, TIM8
+};
+
+static const uint32_t TIM_BurstRequests[TIM_BURST_TIMERS] =
+{
+  DMA_MGR_REQ_TIM1_UP, DMA_MGR_REQ_TIM2_UP, DMA_MGR_REQ_TIM3_UP,
+  DMA_MGR_REQ_TIM4_UP, DMA_MGR_REQ_TIM5_UP, DMA_MGR_REQ_TIM8_UP
+};
+
+/* Master of the internal triggers ITR0 to ITR3 of each timer (RM0090, TIMx
+   internal trigger connection) */
+static TIM_TypeDef* const TIM_BurstTriggers[TIM_BURST_TIMERS][4] =
+{
+  {TIM5, TIM2, TIM3, TIM4},
+  {TIM1, TIM8, TIM3, TIM4},
+  {TIM1, TIM2, TIM5, TIM4},
+  {TIM1, TIM2, TIM3, TIM8},
+  {TIM2, TIM3, TIM4, TIM8},
+  {TIM1, TIM2, TIM4, TIM5}
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t TIM_BurstGetIndex(TIM_TypeDef* TIMx);
+static void TIM_BurstSegmentDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup TIM_Private_Functions
+  * @{
+  */
+
+/** @defgroup TIM_Group10 TIM DMA burst functions
+ *  @brief   TIM DMA burst functions
+ *
+@verbatim
+ ===============================================================================
+                         TIM DMA burst functions
+ ===============================================================================
+
+  This subsection provides functions allowing to write a block of registers of
+  a timer at each update event, using the DMA burst of the timer.
+
+  At each update event, the timer makes Registers DMA requests, and the DMA
+  writes the values to the TIMx_DMAR register, which the timer forwards to the
+  registers from TIM_DMABase on. The written compare and auto-reload registers
+  are preloaded, so that a frame of values takes effect as a whole at the next
+  update event, whatever the time taken by the DMA.
+
+  With Frames = 0, the stream runs in normal mode: each TIM_BurstWrite() copies
+  the values into one of two frames of the engine and queues it, to be written
+  at the next update event.
+
+  With Frames > 0, the stream runs in the streaming mode of the DMA manager:
+  the segments are played one after the other without stopping, one frame per
+  update event. A looping segment is queued again as soon as it is played and
+  its Callback returns.
+
+  TIM_BurstSync() connects the trigger output of a master timer to a slave
+  timer in trigger mode: enabling the master starts the slave at the same
+  clock. The counter of the slave starts at Phase, which gives the phase offset
+  of its outputs.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a TIM burst engine: configures the DMA burst of the
+  *         timer and allocates the stream of its update request.
+  * @param  Burst: pointer to the TIM_BurstTypeDef structure of the timer.
+  * @param  TIM_BurstInitStruct: pointer to a TIM_BurstInitTypeDef structure
+  *         that contains the configuration of the engine.
+  * @note   The update DMA request of the timer is enabled by TIM_BurstStart().
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the engine is ready
+  *          - ERROR: invalid configuration or no free DMA stream
+  */
+ErrorStatus TIM_BurstInit(TIM_BurstTypeDef* Burst, const TIM_BurstInitTypeDef* TIM_BurstInitStruct)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+  TIM_TypeDef* tim = TIM_BurstInitStruct->TIMx;
+  uint32_t index = TIM_BurstGetIndex(tim);
+  uint32_t first = TIM_BurstInitStruct->TIM_DMABase;
+  uint32_t last = first + TIM_BurstInitStruct->Registers;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_LIST3_PERIPH(tim));
+  assert_param(IS_TIM_DMA_BASE(TIM_BurstInitStruct->TIM_DMABase));
+
+  if ((index == TIM_BURST_TIMERS) || (TIM_BurstInitStruct->Registers == 0) ||
+      (TIM_BurstInitStruct->Registers > TIM_BURST_MAX_REGISTERS) ||
+      (((uint32_t)TIM_BurstInitStruct->Frames * TIM_BurstInitStruct->Registers) > 0xFFFF) ||
+      ((TIM_BurstInitStruct->DMA_MemoryDataSize != DMA_MemoryDataSize_HalfWord) &&
+       (TIM_BurstInitStruct->DMA_MemoryDataSize != DMA_MemoryDataSize_Word)))
+  {
+    return ERROR;
+  }
+
+  Burst->Init = *TIM_BurstInitStruct;
+  Burst->Index = 0;
+  Burst->Stopping = 0;
+  Burst->Underruns = 0;
+
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&tim->DMAR;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_MemoryDataSize = TIM_BurstInitStruct->DMA_MemoryDataSize;
+  DMA_InitStructure.DMA_PeripheralDataSize =
+    (TIM_BurstInitStruct->DMA_MemoryDataSize == DMA_MemoryDataSize_Word) ?
+    DMA_PeripheralDataSize_Word : DMA_PeripheralDataSize_HalfWord;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  if (TIM_BurstInitStruct->Frames != 0)
+  {
+    DMA_InitStructure.DMA_BufferSize = (uint32_t)TIM_BurstInitStruct->Frames * TIM_BurstInitStruct->Registers;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  }
+  else
+  {
+    DMA_InitStructure.DMA_BufferSize = TIM_BurstInitStruct->Registers;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  }
+  Burst->Stream = DMA_MgrAlloc(TIM_BurstRequests[index], &DMA_InitStructure);
+  if (Burst->Stream == 0)
+  {
+    return ERROR;
+  }
+
+  for (index = 0; index < 2; index++)
+  {
+    Burst->Xfer[index].MemoryBaseAddr = (uint32_t)Burst->Frame[index];
+    Burst->Xfer[index].Count = TIM_BurstInitStruct->Registers;
+    Burst->Xfer[index].Callback = 0;
+    Burst->Xfer[index].Context = Burst;
+    Burst->Xfer[index].Status = DMA_MGR_XFER_DONE;
+  }
+
+  TIM_DMAConfig(tim, TIM_BurstInitStruct->TIM_DMABase,
+                (uint16_t)((TIM_BurstInitStruct->Registers - 1) << 8));
+
+  /* Preload of the registers written by the burst */
+  if ((first <= TIM_DMABase_ARR) && (last > TIM_DMABase_ARR))
+  {
+    TIM_ARRPreloadConfig(tim, ENABLE);
+  }
+  if ((first <= TIM_DMABase_CCR1) && (last > TIM_DMABase_CCR1))
+  {
+    TIM_OC1PreloadConfig(tim, TIM_OCPreload_Enable);
+  }
+  if ((first <= TIM_DMABase_CCR2) && (last > TIM_DMABase_CCR2))
+  {
+    TIM_OC2PreloadConfig(tim, TIM_OCPreload_Enable);
+  }
+  if ((first <= TIM_DMABase_CCR3) && (last > TIM_DMABase_CCR3))
+  {
+    TIM_OC3PreloadConfig(tim, TIM_OCPreload_Enable);
+  }
+  if ((first <= TIM_DMABase_CCR4) && (last > TIM_DMABase_CCR4))
+  {
+    TIM_OC4PreloadConfig(tim, TIM_OCPreload_Enable);
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a TIM burst engine and releases its DMA stream.
+  * @param  Burst: pointer to the TIM_BurstTypeDef structure of the timer.
+  * @retval None
+  */
+void TIM_BurstDeInit(TIM_BurstTypeDef* Burst)
+{
+  TIM_BurstStop(Burst);
+  DMA_MgrFree(Burst->Stream);
+  Burst->Stream = 0;
+}
+
+/**
+  * @brief  Writes the registers of the burst at the next update event.
+  * @param  Burst: pointer to the TIM_BurstTypeDef structure of the timer.
+  * @param  pValues: Registers values, of the size given by DMA_MemoryDataSize,
+  *         copied by this function.
+  * @note   The values take effect together at the update event after the one
+  *         that writes them.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the values are queued
+  *          - ERROR: the engine plays waveforms, or two writes are already
+  *            waiting for their update event
+  */
+ErrorStatus TIM_BurstWrite(TIM_BurstTypeDef* Burst, const void* pValues)
+{
+  DMA_MgrXferTypeDef* xfer = &Burst->Xfer[Burst->Index];
+  uint32_t index = 0;
+
+  if ((Burst->Init.Frames != 0) ||
+      (xfer->Status == DMA_MGR_XFER_QUEUED) || (xfer->Status == DMA_MGR_XFER_ACTIVE))
+  {
+    return ERROR;
+  }
+
+  if (Burst->Init.DMA_MemoryDataSize == DMA_MemoryDataSize_Word)
+  {
+    for (index = 0; index < Burst->Init.Registers; index++)
+    {
+      Burst->Frame[Burst->Index][index] = ((const uint32_t*)pValues)[index];
+    }
+  }
+  else
+  {
+    for (index = 0; index < Burst->Init.Registers; index++)
+    {
+      ((uint16_t*)Burst->Frame[Burst->Index])[index] = ((const uint16_t*)pValues)[index];
+    }
+  }
+
+  Burst->Index ^= 1;
+
+  return DMA_MgrSubmit(Burst->Stream, xfer);
+}
+
+/**
+  * @brief  Queues a waveform segment.
+  * @param  Burst: pointer to the TIM_BurstTypeDef structure of the timer.
+  * @param  Segment: pointer to the segment. Its pData, Loop, Callback and
+  *         Context members must be set.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the segment is queued
+  *          - ERROR: the engine is in write mode (Frames = 0)
+  */
+ErrorStatus TIM_BurstQueue(TIM_BurstTypeDef* Burst, TIM_BurstSegmentTypeDef* Segment)
+{
+  if (Burst->Init.Frames == 0)
+  {
+    return ERROR;
+  }
+
+  Segment->Burst = Burst;
+  Segment->Status = DMA_MGR_XFER_QUEUED;
+  Segment->Xfer.MemoryBaseAddr = (uint32_t)Segment->pData;
+  Segment->Xfer.Count = (uint16_t)(Burst->Init.Frames * Burst->Init.Registers);
+  Segment->Xfer.Callback = TIM_BurstSegmentDone;
+  Segment->Xfer.Context = Segment;
+
+  return DMA_MgrSubmit(Burst->Stream, &Segment->Xfer);
+}
+
+/**
+  * @brief  Enables the update DMA request of the timer and its counter.
+  * @param  Burst: pointer to the TIM_BurstTypeDef structure of the timer.
+  * @note   The counter of a timer in trigger slave mode is not enabled: it is
+  *         started by its master.
+  * @retval None
+  */
+void TIM_BurstStart(TIM_BurstTypeDef* Burst)
+{
+  TIM_TypeDef* tim = Burst->Init.TIMx;
+
+  Burst->Stopping = 0;
+  TIM_DMACmd(tim, TIM_DMA_Update, ENABLE);
+
+  if ((tim->SMCR & TIM_SMCR_SMS) != TIM_SlaveMode_Trigger)
+  {
+    TIM_Cmd(tim, ENABLE);
+  }
+}
+
+/**
+  * @brief  Stops the DMA burst of the timer.
+  * @param  Burst: pointer to the TIM_BurstTypeDef structure of the timer.
+  * @note   The queued writes and segments are given back with their Status set
+  *         to DMA_MGR_XFER_ABORTED. The counter is not stopped, and the
+  *         outputs keep the last written values.
+  * @retval None
+  */
+void TIM_BurstStop(TIM_BurstTypeDef* Burst)
+{
+  Burst->Stopping = 1;
+  TIM_DMACmd(Burst->Init.TIMx, TIM_DMA_Update, DISABLE);
+  DMA_MgrAbort(Burst->Stream);
+}
+
+/**
+  * @brief  Makes a timer the slave of a master timer, started by it with a
+  *         phase offset.
+  * @param  Master: TIM1, TIM2, TIM3, TIM4, TIM5 or TIM8.
+  * @param  Slave: TIM1, TIM2, TIM3, TIM4, TIM5 or TIM8, connected to Master by
+  *         an internal trigger.
+  * @param  Phase: value of the counter of the slave when it is started.
+  * @note   The slave is stopped: it starts when the counter of the master is
+  *         enabled. A slave can be the master of another timer.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the timers are connected
+  *          - ERROR: no internal trigger connects Master to Slave
+  */
+ErrorStatus TIM_BurstSync(TIM_TypeDef* Master, TIM_TypeDef* Slave, uint32_t Phase)
+{
+  uint32_t index = TIM_BurstGetIndex(Slave), itr = 0;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_LIST3_PERIPH(Master));
+  assert_param(IS_TIM_LIST3_PERIPH(Slave));
+
+  if (index == TIM_BURST_TIMERS)
+  {
+    return ERROR;
+  }
+  while ((itr < 4) && (TIM_BurstTriggers[index][itr] != Master))
+  {
+    itr++;
+  }
+  if (itr == 4)
+  {
+    return ERROR;
+  }
+
+  /* Master: trigger output on counter enable, delayed to start its slaves at
+     the same clock */
+  TIM_SelectOutputTrigger(Master, TIM_TRGOSource_Enable);
+  TIM_SelectMasterSlaveMode(Master, TIM_MasterSlaveMode_Enable);
+
+  /* Slave: started by ITRx, from Phase */
+  TIM_Cmd(Slave, DISABLE);
+  TIM_SelectInputTrigger(Slave, (uint16_t)(TIM_TS_ITR0 + (itr << 4)));
+  TIM_SelectSlaveMode(Slave, TIM_SlaveMode_Trigger);
+  TIM_SetCounter(Slave, Phase);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the index of a timer in the tables of the engine.
+  * @param  TIMx: the timer.
+  * @retval The index, or TIM_BURST_TIMERS for a timer without DMA burst.
+  */
+static uint32_t TIM_BurstGetIndex(TIM_TypeDef* TIMx)
+{
+  uint32_t index = 0;
+
+  while ((index < TIM_BURST_TIMERS) && (TIM_BurstTimers[index] != TIMx))
+  {
+    index++;
+  }
+
+  return index;
+}
+
+/**
+  * @brief  Ends the playback of a waveform segment.
+  * @param  Xfer: the DMA transfer of the segment.
+  * @retval None
+  */
+static void TIM_BurstSegmentDone(DMA_MgrXferTypeDef* Xfer)
+{
+  TIM_BurstSegmentTypeDef* segment = (TIM_BurstSegmentTypeDef*)Xfer->Context;
+  TIM_BurstTypeDef* burst = segment->Burst;
+
+  segment->Status = Xfer->Status;
+
+  /* The DMA manager stops the stream when no segment follows */
+  if ((Xfer->Status == DMA_MGR_XFER_DONE) && (burst->Stopping == 0) &&
+      (DMA_GetCmdStatus(burst->Stream) == DISABLE))
+  {
+    burst->Underruns++;
+  }
+
+  if (segment->Callback != 0)
+  {
+    segment->Callback(segment);
+  }
+
+  /* The Callback may clear Loop to end the loop */
+  if ((Xfer->Status == DMA_MGR_XFER_DONE) && (burst->Stopping == 0) && (segment->Loop != 0))
+  {
+    segment->Status = DMA_MGR_XFER_QUEUED;
+    DMA_MgrSubmit(burst->Stream, Xfer);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,558 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_tim_capture.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a capture engine and a counter extension for
+  *          the timers, to measure pulse trains and positions without CPU per
+  *          edge:
+  *           - Capture of the counter at each edge into a ring of two blocks
+  *             by DMA
+  *           - Period and high time of each period in PWM input mode, read by
+  *             a DMA burst
+  *           - Frequency and duty cycle computed per block
+  *           - Extension of the counters and encoders to 64 bits, and speed
+  *          It uses the stm32f4xx_tim.c/.h, stm32f4xx_rcc.c/.h and
+  *          stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          Capture engine
+  *          --------------
+  *          1. Enable the TIM, GPIO and DMA clocks, configure the input pin of
+  *             channel 1 or 2 in alternate function, and call DMA_MgrInit().
+  *
+  *          2. Call TIM_CaptureInit() with a TIM_CaptureTypeDef structure: it
+  *             configures the time base and the channel. Call
+  *             DMA_MgrIRQHandler() from the interrupt handler of the stream
+  *             of the capture/compare request of the channel.
+  *
+  *          3. Start the engine with TIM_CaptureStart(). The Block callback
+  *             is called with each full block of captures and its measures,
+  *             also kept in the Stats member.
+  *
+  *          4. Stop the engine with TIM_CaptureStop() and release its DMA
+  *             stream with TIM_CaptureDeInit().
+  *
+  *          Counter extension
+  *          -----------------
+  *          1. Configure the timer, for example as an encoder with
+  *             TIM_EncoderInterfaceConfig(), and enable its counter.
+  *
+  *          2. Call TIM_CounterExtInit() with a TIM_CounterExtTypeDef
+  *             structure, enable the update interrupt of the timer in the
+  *             NVIC and call TIM_CounterExtIRQHandler() from its handler.
+  *
+  *          3. Read the 64-bit counter with TIM_CounterExtRead(), and the
+  *             speed in counts per second with TIM_CounterExtSpeed() called
+  *             at a fixed rate, for example from a control loop.
+  *
+  * @note   In TIM_CAPTURE_EDGES mode the counter runs free: a period must be
+  *         shorter than the counter range (65536 ticks, 2^32 ticks for TIM2
+  *         and TIM5). Choose TIM_Prescaler accordingly.
+  *
+  * @note   At low speed, an encoder gives few counts per call of
+  *         TIM_CounterExtSpeed(): the period of one encoder channel measured
+  *         by a capture engine on another timer is then more accurate.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_tim_capture.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup TIM
+  * @brief TIM driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TIM_CAPTURE_TIMERS        ((uint32_t)6)
+
+/* Private macro -------------------------------------------------------------*/
+#define TIM_CAPTURE_IS_32BIT(TIMx) (((TIMx) == TIM2) || ((TIMx) == TIM5))
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Timers with capture/compare DMA requests on channels 1 and 2 */
+static TIM_TypeDef* const TIM_CaptureTimers[TIM_CAPTURE_TIMERS] =
+{
+  TIM1, TIM2, TIM3, TIM4, TIM5, TIM8
+};
+
+static const uint32_t TIM_CaptureRequests[TIM_CAPTURE_TIMERS][2] =
+{
+  {DMA_MGR_REQ_TIM1_CC1, DMA_MGR_REQ_TIM1_CC2},
+  {DMA_MGR_REQ_TIM2_CC1, DMA_MGR_REQ_TIM2_CC2},
+  {DMA_MGR_REQ_TIM3_CC1, DMA_MGR_REQ_TIM3_CC2},
+  {DMA_MGR_REQ_TIM4_CC1, DMA_MGR_REQ_TIM4_CC2},
+  {DMA_MGR_REQ_TIM5_CC1, DMA_MGR_REQ_TIM5_CC2},
+  {DMA_MGR_REQ_TIM8_CC1, DMA_MGR_REQ_TIM8_CC2}
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t TIM_CaptureGetIndex(TIM_TypeDef* TIMx);
+static uint32_t TIM_CaptureGetClock(TIM_TypeDef* TIMx);
+static void TIM_CaptureBlockDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup TIM_Private_Functions
+  * @{
+  */
+
+/** @defgroup TIM_Group11 TIM capture engine and counter extension functions
+ *  @brief   TIM capture engine and counter extension functions
+ *
+@verbatim
+ ===============================================================================
+             TIM capture engine and counter extension functions
+ ===============================================================================
+
+  This subsection provides functions allowing to measure pulse trains at the
+  full rate of the timer, and to extend the counters to 64 bits.
+
+  The capture engine uses the capture/compare DMA request of channel 1 or 2:
+   - TIM_CAPTURE_EDGES: at each selected edge the DMA copies CCRx into the
+     buffer. The periods are the differences between consecutive captures,
+     across the blocks.
+   - TIM_CAPTURE_PWM: the channel and its pair run in PWM input mode, and the
+     counter is reset at each period by the slave reset mode. At each period
+     a DMA burst copies CCR1 and CCR2: the period and the high time (channel
+     1), or the high time and the period (channel 2).
+  The stream runs in the streaming mode of the DMA manager on the two blocks
+  of Buffer. Once a block is full, its average period, frequency and duty
+  cycle are computed from the DMA interrupt, the Block callback is called and
+  the block is queued again: the CPU works once per block, not per edge.
+
+  The counter extension counts the overflows and underflows of a 16-bit
+  counter in the update interrupt, which happens once per counter range. The
+  direction of a wrap is given by the counter value in the interrupt, so that
+  an encoder oscillating around the wrap is counted right. TIM_CounterExtRead()
+  takes into account a wrap not yet seen by the interrupt.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a TIM capture engine: configures the time base, the
+  *         input channel and the DMA.
+  * @param  Capture: pointer to the TIM_CaptureTypeDef structure of the engine.
+  * @param  TIM_CaptureInitStruct: pointer to a TIM_CaptureInitTypeDef structure
+  *         that contains the configuration of the engine.
+  * @note   The time base counts up over the full counter range, at the timer
+  *         clock divided by TIM_Prescaler + 1.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the engine is ready to start
+  *          - ERROR: invalid configuration or no free DMA stream
+  */
+ErrorStatus TIM_CaptureInit(TIM_CaptureTypeDef* Capture, const TIM_CaptureInitTypeDef* TIM_CaptureInitStruct)
+{
+  TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+  TIM_ICInitTypeDef TIM_ICInitStructure;
+  DMA_InitTypeDef DMA_InitStructure;
+  TIM_TypeDef* tim = TIM_CaptureInitStruct->TIMx;
+  uint32_t index = TIM_CaptureGetIndex(tim);
+  uint32_t channel = (TIM_CaptureInitStruct->TIM_Channel == TIM_Channel_2) ? 1 : 0;
+  uint32_t count = TIM_CaptureInitStruct->BlockPeriods;
+  uint32_t size = TIM_CAPTURE_IS_32BIT(tim) ? 4 : 2;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_LIST3_PERIPH(tim));
+  assert_param(IS_TIM_IC_POLARITY(TIM_CaptureInitStruct->TIM_ICPolarity));
+  assert_param(IS_TIM_IC_FILTER(TIM_CaptureInitStruct->TIM_ICFilter));
+  assert_param(IS_TIM_CAPTURE_MODE(TIM_CaptureInitStruct->Mode));
+
+  if (TIM_CaptureInitStruct->Mode == TIM_CAPTURE_PWM)
+  {
+    count *= 2;
+  }
+  if ((index == TIM_CAPTURE_TIMERS) ||
+      ((TIM_CaptureInitStruct->TIM_Channel != TIM_Channel_1) &&
+       (TIM_CaptureInitStruct->TIM_Channel != TIM_Channel_2)) ||
+      (TIM_CaptureInitStruct->Buffer == 0) || (count == 0) || (count > 0xFFFF))
+  {
+    return ERROR;
+  }
+
+  Capture->Init = *TIM_CaptureInitStruct;
+  Capture->Last = 0;
+  Capture->Started = 0;
+  Capture->Overruns = 0;
+  Capture->Stats.Periods = 0;
+  Capture->Stats.Period = 0;
+  Capture->Stats.Frequency = 0;
+  Capture->Stats.Duty = 0;
+
+  TIM_Cmd(tim, DISABLE);
+  TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+  TIM_TimeBaseStructure.TIM_Prescaler = TIM_CaptureInitStruct->TIM_Prescaler;
+  TIM_TimeBaseStructure.TIM_Period = TIM_CAPTURE_IS_32BIT(tim) ? 0xFFFFFFFF : 0xFFFF;
+  TIM_TimeBaseInit(tim, &TIM_TimeBaseStructure);
+  Capture->Clock = TIM_CaptureGetClock(tim) / ((uint32_t)TIM_CaptureInitStruct->TIM_Prescaler + 1);
+
+  TIM_ICStructInit(&TIM_ICInitStructure);
+  TIM_ICInitStructure.TIM_Channel = TIM_CaptureInitStruct->TIM_Channel;
+  TIM_ICInitStructure.TIM_ICPolarity = TIM_CaptureInitStruct->TIM_ICPolarity;
+  TIM_ICInitStructure.TIM_ICSelection = TIM_ICSelection_DirectTI;
+  TIM_ICInitStructure.TIM_ICPrescaler = TIM_ICPSC_DIV1;
+  TIM_ICInitStructure.TIM_ICFilter = TIM_CaptureInitStruct->TIM_ICFilter;
+
+  DMA_StructInit(&DMA_InitStructure);
+  if (TIM_CaptureInitStruct->Mode == TIM_CAPTURE_PWM)
+  {
+    TIM_PWMIConfig(tim, &TIM_ICInitStructure);
+    TIM_SelectInputTrigger(tim, (channel == 0) ? TIM_TS_TI1FP1 : TIM_TS_TI2FP2);
+    TIM_SelectSlaveMode(tim, TIM_SlaveMode_Reset);
+    TIM_SelectMasterSlaveMode(tim, TIM_MasterSlaveMode_Enable);
+    TIM_DMAConfig(tim, TIM_DMABase_CCR1, TIM_DMABurstLength_2Transfers);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&tim->DMAR;
+  }
+  else
+  {
+    TIM_ICInit(tim, &TIM_ICInitStructure);
+    tim->SMCR &= (uint16_t)~TIM_SMCR_SMS;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (channel == 0) ? (uint32_t)&tim->CCR1 : (uint32_t)&tim->CCR2;
+  }
+
+  /* DMA: streaming mode on the two blocks of Buffer */
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  DMA_InitStructure.DMA_BufferSize = count;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = (size == 4) ? DMA_PeripheralDataSize_Word : DMA_PeripheralDataSize_HalfWord;
+  DMA_InitStructure.DMA_MemoryDataSize = (size == 4) ? DMA_MemoryDataSize_Word : DMA_MemoryDataSize_HalfWord;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  Capture->Stream = DMA_MgrAlloc(TIM_CaptureRequests[index][channel], &DMA_InitStructure);
+  if (Capture->Stream == 0)
+  {
+    return ERROR;
+  }
+
+  for (index = 0; index < 2; index++)
+  {
+    Capture->Xfer[index].MemoryBaseAddr = (uint32_t)TIM_CaptureInitStruct->Buffer + (index * count * size);
+    Capture->Xfer[index].Count = (uint16_t)count;
+    Capture->Xfer[index].Callback = TIM_CaptureBlockDone;
+    Capture->Xfer[index].Context = Capture;
+    DMA_MgrSubmit(Capture->Stream, &Capture->Xfer[index]);
+  }
+
+  TIM_DMACmd(tim, (channel == 0) ? TIM_DMA_CC1 : TIM_DMA_CC2, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a TIM capture engine and releases its DMA stream.
+  * @param  Capture: pointer to the TIM_CaptureTypeDef structure of the engine.
+  * @retval None
+  */
+void TIM_CaptureDeInit(TIM_CaptureTypeDef* Capture)
+{
+  TIM_CaptureStop(Capture);
+  TIM_DMACmd(Capture->Init.TIMx, TIM_DMA_CC1 | TIM_DMA_CC2, DISABLE);
+  DMA_MgrFree(Capture->Stream);
+  Capture->Stream = 0;
+}
+
+/**
+  * @brief  Starts a TIM capture engine: enables the counter.
+  * @param  Capture: pointer to the TIM_CaptureTypeDef structure of the engine.
+  * @retval None
+  */
+void TIM_CaptureStart(TIM_CaptureTypeDef* Capture)
+{
+  /* The first capture after a stop does not end a period */
+  Capture->Started = 0;
+  TIM_ClearFlag(Capture->Init.TIMx, TIM_FLAG_CC1OF | TIM_FLAG_CC2OF);
+  TIM_Cmd(Capture->Init.TIMx, ENABLE);
+}
+
+/**
+  * @brief  Stops a TIM capture engine: disables the counter.
+  * @param  Capture: pointer to the TIM_CaptureTypeDef structure of the engine.
+  * @note   The DMA stream keeps its position: TIM_CaptureStart() goes on
+  *         with the next captures.
+  * @retval None
+  */
+void TIM_CaptureStop(TIM_CaptureTypeDef* Capture)
+{
+  TIM_Cmd(Capture->Init.TIMx, DISABLE);
+}
+
+/**
+  * @brief  Initializes the extension of the counter of a timer to 64 bits.
+  * @param  Ext: pointer to the TIM_CounterExtTypeDef structure of the timer.
+  * @param  TIMx: where x can be 1 to 5 or 8 to select the TIM peripheral,
+  *         configured and running.
+  * @note   Only the counter overflows and underflows make update events once
+  *         this function is called. The update interrupt is enabled in the
+  *         timer: it must also be enabled in the NVIC.
+  * @retval None
+  */
+void TIM_CounterExtInit(TIM_CounterExtTypeDef* Ext, TIM_TypeDef* TIMx)
+{
+  /* Check the parameters */
+  assert_param(IS_TIM_LIST3_PERIPH(TIMx));
+
+  Ext->TIMx = TIMx;
+  Ext->High = 0;
+
+  TIM_UpdateRequestConfig(TIMx, TIM_UpdateSource_Regular);
+  TIM_ClearITPendingBit(TIMx, TIM_IT_Update);
+  TIM_ITConfig(TIMx, TIM_IT_Update, ENABLE);
+
+  Ext->Last = TIM_CounterExtRead(Ext);
+}
+
+/**
+  * @brief  Counts a wrap of the counter. To be called from the update
+  *         interrupt handler of the timer.
+  * @param  Ext: pointer to the TIM_CounterExtTypeDef structure of the timer.
+  * @note   The handler must run within half a counter range of the wrap.
+  * @retval None
+  */
+void TIM_CounterExtIRQHandler(TIM_CounterExtTypeDef* Ext)
+{
+  TIM_TypeDef* tim = Ext->TIMx;
+
+  if (TIM_GetITStatus(tim, TIM_IT_Update) != RESET)
+  {
+    TIM_ClearITPendingBit(tim, TIM_IT_Update);
+
+    /* Just after an overflow the counter is near 0, after an underflow near
+       the auto-reload value */
+    if (tim->CNT <= (tim->ARR >> 1))
+    {
+      Ext->High++;
+    }
+    else
+    {
+      Ext->High--;
+    }
+  }
+}
+
+/**
+  * @brief  Reads the 64-bit counter.
+  * @param  Ext: pointer to the TIM_CounterExtTypeDef structure of the timer.
+  * @note   The interrupts are disabled during the read.
+  * @retval The counter, (wraps x (ARR + 1)) + CNT.
+  */
+int64_t TIM_CounterExtRead(TIM_CounterExtTypeDef* Ext)
+{
+  TIM_TypeDef* tim = Ext->TIMx;
+  uint32_t primask = 0, cnt = 0, arr = 0;
+  int32_t high = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  high = Ext->High;
+  cnt = tim->CNT;
+  arr = tim->ARR;
+  /* A wrap not yet counted by the interrupt: read the counter after it */
+  if ((tim->SR & TIM_SR_UIF) != 0)
+  {
+    cnt = tim->CNT;
+    high += (cnt <= (arr >> 1)) ? 1 : -1;
+  }
+
+  __set_PRIMASK(primask);
+
+  return ((int64_t)high * ((int64_t)arr + 1)) + cnt;
+}
+
+/**
+  * @brief  Returns the speed of the counter since the previous call.
+  * @param  Ext: pointer to the TIM_CounterExtTypeDef structure of the timer.
+  * @param  SampleRate: rate of the calls in Hz.
+  * @retval The speed in counts per second, negative when counting down.
+  */
+int32_t TIM_CounterExtSpeed(TIM_CounterExtTypeDef* Ext, uint32_t SampleRate)
+{
+  int64_t position = TIM_CounterExtRead(Ext);
+  int64_t delta = position - Ext->Last;
+
+  Ext->Last = position;
+
+  return (int32_t)(delta * (int64_t)SampleRate);
+}
+
+/**
+  * @brief  Returns the clock of the counter of a timer, before its prescaler.
+  * @param  TIMx: where x can be 1 to 5 or 8 to select the TIM peripheral.
+  * @retval The clock in Hz: twice the APB clock when the APB is divided.
+  */
+static uint32_t TIM_CaptureGetClock(TIM_TypeDef* TIMx)
+{
+  RCC_ClocksTypeDef RCC_Clocks;
+  uint32_t pclk = 0;
+
+  RCC_GetClocksFreq(&RCC_Clocks);
+  pclk = ((TIMx == TIM1) || (TIMx == TIM8)) ? RCC_Clocks.PCLK2_Frequency : RCC_Clocks.PCLK1_Frequency;
+
+  return (pclk == RCC_Clocks.HCLK_Frequency) ? pclk : (pclk * 2);
+}
+
+/**
+  * @brief  Returns the index of a timer in the tables of the engine.
+  * @param  TIMx: the timer.
+  * @retval The index, or TIM_CAPTURE_TIMERS for a timer without capture DMA.
+  */
+static uint32_t TIM_CaptureGetIndex(TIM_TypeDef* TIMx)
+{
+  uint32_t index = 0;
+
+  for (index = 0; (index < TIM_CAPTURE_TIMERS) && (TIM_CaptureTimers[index] != TIMx); index++)
+  {
+  }
+
+  return index;
+}
+
+/**
+  * @brief  Measures a full block of captures, passes it to the Block callback
+  *         and queues it again.
+  * @param  Xfer: the DMA transfer of the block.
+  * @retval None
+  */
+static void TIM_CaptureBlockDone(DMA_MgrXferTypeDef* Xfer)
+{
+  TIM_CaptureTypeDef* capture = (TIM_CaptureTypeDef*)Xfer->Context;
+  TIM_TypeDef* tim = capture->Init.TIMx;
+  uint32_t wide = TIM_CAPTURE_IS_32BIT(tim);
+  uint32_t mask = (wide != 0) ? 0xFFFFFFFF : 0xFFFF;
+  uint32_t index = 0, value = 0, first = 0, high = 0, periods = 0;
+  uint64_t sum = 0, sumhigh = 0;
+
+  if (Xfer->Status != DMA_MGR_XFER_DONE)
+  {
+    return;
+  }
+
+  /* The DMA manager stops the stream when the other block was not queued, and
+     the timer sets CCxOF when a capture was not read by the DMA */
+  if ((DMA_GetCmdStatus(capture->Stream) == DISABLE) ||
+      (TIM_GetFlagStatus(tim, TIM_FLAG_CC1OF | TIM_FLAG_CC2OF) != RESET))
+  {
+    TIM_ClearFlag(tim, TIM_FLAG_CC1OF | TIM_FLAG_CC2OF);
+    capture->Overruns++;
+    capture->Started = 0;
+  }
+
+  for (index = 0; index < Xfer->Count; index++)
+  {
+    value = (wide != 0) ? ((const uint32_t*)Xfer->MemoryBaseAddr)[index] :
+                          ((const uint16_t*)Xfer->MemoryBaseAddr)[index];
+
+    if (capture->Init.Mode == TIM_CAPTURE_PWM)
+    {
+      /* Pairs of CCR1 and CCR2: the period is captured on the channel of the
+         engine, the high time on its pair */
+      if ((index & 0x1) == 0)
+      {
+        first = value;
+        continue;
+      }
+      if (capture->Init.TIM_Channel == TIM_Channel_1)
+      {
+        high = value;
+        value = first;
+      }
+      else
+      {
+        high = first;
+      }
+      /* The first capture after the start measures a partial period */
+      if ((value != 0) && (capture->Started != 0))
+      {
+        sum += value;
+        sumhigh += high;
+        periods++;
+      }
+      capture->Started = 1;
+    }
+    else
+    {
+      if (capture->Started != 0)
+      {
+        sum += (value - capture->Last) & mask;
+        periods++;
+      }
+      capture->Last = value;
+      capture->Started = 1;
+    }
+  }
+
+  capture->Stats.Periods = periods;
+  if ((periods != 0) && (sum != 0))
+  {
+    capture->Stats.Period = (uint32_t)(sum / periods);
+    capture->Stats.Frequency = (uint32_t)((((uint64_t)capture->Clock * periods) + (sum >> 1)) / sum);
+    capture->Stats.Duty = (uint16_t)((sumhigh * 10000) / sum);
+  }
+  else
+  {
+    capture->Stats.Period = 0;
+    capture->Stats.Frequency = 0;
+    capture->Stats.Duty = 0;
+  }
+
+  if (capture->Init.Block != 0)
+  {
+    capture->Init.Block(capture, (const void*)Xfer->MemoryBaseAddr,
+                        (capture->Init.Mode == TIM_CAPTURE_PWM) ? (uint16_t)(Xfer->Count >> 1) : Xfer->Count,
+                        &capture->Stats);
+  }
+
+  DMA_MgrSubmit(capture->Stream, Xfer);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,550 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_tim_wheel.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a software timers service on a 32-bit timer,
+  *          for the timeouts of the drivers and of the application:
+  *           - Free running microsecond time base on TIM2 or TIM5
+  *           - One-shot and periodic timers with microsecond resolution
+  *           - Hierarchical timing wheel: start and stop in constant time
+  *           - One compare interrupt per expiry, no periodic tick
+  *          It uses the stm32f4xx_tim.c/.h and stm32f4xx_rcc.c/.h drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the TIM2 or TIM5 clock and call TIM_WheelInit(). Enable
+  *             the timer interrupt in the NVIC and call TIM_WheelIRQHandler()
+  *             from its handler.
+  *
+  *          2. Call TIM_TimerInit() once for each TIM_TimerTypeDef structure,
+  *             with its callback.
+  *
+  *          3. Start a timer with TIM_TimerStart(): one-shot with Period = 0,
+  *             periodic otherwise. Stop it with TIM_TimerStop(), for example
+  *             when the awaited event comes before the timeout.
+  *
+  *          4. Polling loops compare the elapsed time with
+  *             (TIM_WheelGetTime() - Start), which wraps around safely.
+  *
+  * @note   The callbacks run in the timer interrupt: a timeout callback
+  *         typically sets a flag or an error state of its driver.
+  *
+  * @note   Without running timers, the compare interrupt still happens every
+  *         2^29 microseconds (about 9 minutes) to follow the counter.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_tim_wheel.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup TIM
+  * @brief TIM driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TIM_WHEEL_BITS            5
+#define TIM_WHEEL_SLOTS           ((uint32_t)1 << TIM_WHEEL_BITS)
+#define TIM_WHEEL_MASK            (TIM_WHEEL_SLOTS - 1)
+
+/* Longest step of the wheel time, so that it never lags the counter by more
+   than 2^29 us: the expiries stay within 2^31 us of the wheel time */
+#define TIM_WHEEL_KEEPALIVE       ((uint32_t)0x20000000)
+
+#define TIM_WHEEL_TICK_HZ         ((uint32_t)1000000)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static TIM_TypeDef* TIM_WheelTIMx = 0;
+
+/* Time up to which the timers have expired */
+static uint32_t TIM_WheelNow = 0;
+
+/* Level k holds the timers whose expiry differs from TIM_WheelNow in bits
+   5k to 5k+4 at most, in the slot given by these bits of the expiry */
+static TIM_TimerTypeDef* TIM_WheelSlots[TIM_WHEEL_LEVELS][TIM_WHEEL_SLOTS];
+
+/* Non empty slots of each level */
+static uint32_t TIM_WheelPending[TIM_WHEEL_LEVELS];
+
+/* Private function prototypes -----------------------------------------------*/
+static void TIM_WheelInsert(TIM_TimerTypeDef* Timer);
+static void TIM_WheelRemove(TIM_TimerTypeDef* Timer);
+static uint32_t TIM_WheelNext(uint8_t* Level, uint8_t* Slot);
+static void TIM_WheelProgram(void);
+static void TIM_WheelExpire(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup TIM_Private_Functions
+  * @{
+  */
+
+/** @defgroup TIM_Group12 Software timers functions
+ *  @brief   Software timers functions
+ *
+@verbatim
+ ===============================================================================
+                         Software timers functions
+ ===============================================================================
+
+  This subsection provides functions allowing to run any number of one-shot
+  and periodic software timers on a single 32-bit hardware timer, counting
+  microseconds.
+
+  The timers are kept in a hierarchical timing wheel of TIM_WHEEL_LEVELS
+  levels of 32 slots. A timer goes to the level of the highest 5-bit group
+  where its expiry differs from the wheel time, in the slot given by this
+  group of its expiry: starting and stopping a timer take a constant time,
+  whatever the number of timers.
+
+  The compare channel 1 of the timer is set to the next event of the wheel,
+  found from the bitmaps of the non empty slots: the expiry of the timers of
+  level 0, or the start of a slot of an upper level, whose timers then move
+  to the lower levels. The CPU is only woken up by these events, never by a
+  periodic tick.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes the software timers service: configures the timer as
+  *         a free running microsecond counter, with the compare interrupt of
+  *         channel 1.
+  * @param  TIMx: TIM2 or TIM5, with its clock enabled.
+  * @note   The timer clock must be a multiple of 1 MHz. The running timers are
+  *         forgotten.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the service runs
+  *          - ERROR: not a 32-bit timer, or the timer clock is not a multiple
+  *            of 1 MHz
+  */
+ErrorStatus TIM_WheelInit(TIM_TypeDef* TIMx)
+{
+  TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+  TIM_OCInitTypeDef TIM_OCInitStructure;
+  RCC_ClocksTypeDef RCC_Clocks;
+  uint32_t clock = 0, level = 0, slot = 0;
+
+  /* Check the parameters */
+  assert_param(IS_TIM_LIST3_PERIPH(TIMx));
+
+  /* Timers clock: twice the APB1 clock when the APB1 is divided */
+  RCC_GetClocksFreq(&RCC_Clocks);
+  clock = RCC_Clocks.PCLK1_Frequency;
+  if (clock != RCC_Clocks.HCLK_Frequency)
+  {
+    clock *= 2;
+  }
+
+  if (((TIMx != TIM2) && (TIMx != TIM5)) || (clock < TIM_WHEEL_TICK_HZ) ||
+      ((clock % TIM_WHEEL_TICK_HZ) != 0))
+  {
+    return ERROR;
+  }
+
+  for (level = 0; level < TIM_WHEEL_LEVELS; level++)
+  {
+    TIM_WheelPending[level] = 0;
+    for (slot = 0; slot < TIM_WHEEL_SLOTS; slot++)
+    {
+      TIM_WheelSlots[level][slot] = 0;
+    }
+  }
+  TIM_WheelTIMx = TIMx;
+  TIM_WheelNow = 0;
+
+  TIM_Cmd(TIMx, DISABLE);
+  TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+  TIM_TimeBaseStructure.TIM_Prescaler = (uint16_t)((clock / TIM_WHEEL_TICK_HZ) - 1);
+  TIM_TimeBaseStructure.TIM_Period = 0xFFFFFFFF;
+  TIM_TimeBaseInit(TIMx, &TIM_TimeBaseStructure);
+
+  TIM_OCStructInit(&TIM_OCInitStructure);
+  TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+  TIM_OCInitStructure.TIM_Pulse = TIM_WHEEL_KEEPALIVE;
+  TIM_OC1Init(TIMx, &TIM_OCInitStructure);
+  TIM_OC1PreloadConfig(TIMx, TIM_OCPreload_Disable);
+
+  TIM_ClearITPendingBit(TIMx, TIM_IT_CC1);
+  TIM_ITConfig(TIMx, TIM_IT_CC1, ENABLE);
+  TIM_Cmd(TIMx, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the time of the service.
+  * @param  None
+  * @retval The time in microseconds, wrapping around every 2^32 us.
+  */
+uint32_t TIM_WheelGetTime(void)
+{
+  return TIM_WheelTIMx->CNT;
+}
+
+/**
+  * @brief  Moves the wheel to its due events and runs the expired timers. To
+  *         be called from the interrupt handler of the timer.
+  * @param  None
+  * @retval None
+  */
+void TIM_WheelIRQHandler(void)
+{
+  TIM_TypeDef* tim = TIM_WheelTIMx;
+  TIM_TimerTypeDef* timer = 0;
+  uint32_t primask = 0, next = 0;
+  uint8_t level = 0, slot = 0;
+
+  if (TIM_GetITStatus(tim, TIM_IT_CC1) == RESET)
+  {
+    return;
+  }
+  TIM_ClearITPendingBit(tim, TIM_IT_CC1);
+
+  for (;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    next = TIM_WheelNext(&level, &slot);
+    if ((int32_t)(next - tim->CNT) > 0)
+    {
+      tim->CCR1 = next;
+      /* Still in the future once set: wait for the compare */
+      if ((int32_t)(next - tim->CNT) > 0)
+      {
+        __set_PRIMASK(primask);
+        break;
+      }
+    }
+
+    TIM_WheelNow = next;
+
+    /* Start of a slot of an upper level: move its timers down */
+    if ((level != TIM_WHEEL_IDLE) && (level != 0))
+    {
+      while ((timer = TIM_WheelSlots[level][slot]) != 0)
+      {
+        TIM_WheelRemove(timer);
+        TIM_WheelInsert(timer);
+      }
+    }
+
+    __set_PRIMASK(primask);
+
+    TIM_WheelExpire();
+  }
+}
+
+/**
+  * @brief  Initializes a software timer.
+  * @param  Timer: pointer to the TIM_TimerTypeDef structure of the timer.
+  * @param  Callback: function called when the timer expires.
+  * @param  Context: free for the application.
+  * @retval None
+  */
+void TIM_TimerInit(TIM_TimerTypeDef* Timer, void (*Callback)(TIM_TimerTypeDef* Timer), void* Context)
+{
+  Timer->Next = 0;
+  Timer->Prev = 0;
+  Timer->Expiry = 0;
+  Timer->Period = 0;
+  Timer->Level = TIM_WHEEL_IDLE;
+  Timer->Slot = 0;
+  Timer->Callback = Callback;
+  Timer->Context = Context;
+}
+
+/**
+  * @brief  Starts a software timer, or restarts it when it runs.
+  * @param  Timer: pointer to the TIM_TimerTypeDef structure of the timer.
+  * @param  Delay: time to the first expiry in microseconds, between 1 and
+  *         TIM_WHEEL_MAX_DELAY.
+  * @param  Period: time between the next expiries in microseconds, up to
+  *         TIM_WHEEL_MAX_DELAY, or 0 for a one-shot timer.
+  * @note   This function can be called from any context, the callbacks
+  *         included.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the timer runs
+  *          - ERROR: Delay or Period out of range
+  */
+ErrorStatus TIM_TimerStart(TIM_TimerTypeDef* Timer, uint32_t Delay, uint32_t Period)
+{
+  uint32_t primask = 0;
+
+  if (!IS_TIM_WHEEL_DELAY(Delay) || (Period > TIM_WHEEL_MAX_DELAY))
+  {
+    return ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (Timer->Level != TIM_WHEEL_IDLE)
+  {
+    TIM_WheelRemove(Timer);
+  }
+  Timer->Expiry = TIM_WheelTIMx->CNT + Delay;
+  Timer->Period = Period;
+  TIM_WheelInsert(Timer);
+  TIM_WheelProgram();
+
+  __set_PRIMASK(primask);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a software timer.
+  * @param  Timer: pointer to the TIM_TimerTypeDef structure of the timer.
+  * @note   Nothing is done for a stopped timer. This function can be called
+  *         from any context, the callbacks included.
+  * @retval None
+  */
+void TIM_TimerStop(TIM_TimerTypeDef* Timer)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (Timer->Level != TIM_WHEEL_IDLE)
+  {
+    TIM_WheelRemove(Timer);
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Checks whether a software timer runs.
+  * @param  Timer: pointer to the TIM_TimerTypeDef structure of the timer.
+  * @retval SET for a started timer not yet expired, or a periodic timer not
+  *         stopped, RESET otherwise.
+  */
+FlagStatus TIM_TimerIsRunning(const TIM_TimerTypeDef* Timer)
+{
+  return (Timer->Level != TIM_WHEEL_IDLE) ? SET : RESET;
+}
+
+/**
+  * @brief  Links a timer into the slot of its expiry.
+  * @param  Timer: the timer, not linked.
+  * @note   Called with the interrupts disabled.
+  * @retval None
+  */
+static void TIM_WheelInsert(TIM_TimerTypeDef* Timer)
+{
+  uint32_t diff = Timer->Expiry ^ TIM_WheelNow;
+  uint32_t level = 0, slot = 0;
+
+  /* Highest group of 5 bits where the expiry differs from the wheel time */
+  if (diff != 0)
+  {
+    level = (31 - __CLZ(diff)) / TIM_WHEEL_BITS;
+  }
+  slot = (Timer->Expiry >> (level * TIM_WHEEL_BITS)) & TIM_WHEEL_MASK;
+
+  Timer->Level = (uint8_t)level;
+  Timer->Slot = (uint8_t)slot;
+  Timer->Prev = 0;
+  Timer->Next = TIM_WheelSlots[level][slot];
+  if (Timer->Next != 0)
+  {
+    Timer->Next->Prev = Timer;
+  }
+  TIM_WheelSlots[level][slot] = Timer;
+  TIM_WheelPending[level] |= (uint32_t)1 << slot;
+}
+
+/**
+  * @brief  Unlinks a timer from its slot.
+  * @param  Timer: the timer, linked.
+  * @note   Called with the interrupts disabled.
+  * @retval None
+  */
+static void TIM_WheelRemove(TIM_TimerTypeDef* Timer)
+{
+  if (Timer->Prev != 0)
+  {
+    Timer->Prev->Next = Timer->Next;
+  }
+  else
+  {
+    TIM_WheelSlots[Timer->Level][Timer->Slot] = Timer->Next;
+    if (Timer->Next == 0)
+    {
+      TIM_WheelPending[Timer->Level] &= ~((uint32_t)1 << Timer->Slot);
+    }
+  }
+  if (Timer->Next != 0)
+  {
+    Timer->Next->Prev = Timer->Prev;
+  }
+
+  Timer->Next = 0;
+  Timer->Prev = 0;
+  Timer->Level = TIM_WHEEL_IDLE;
+}
+
+/**
+  * @brief  Returns the next event of the wheel.
+  * @param  Level: the level of the event, TIM_WHEEL_IDLE for a keepalive
+  *         step of the wheel time.
+  * @param  Slot: the slot of the event.
+  * @note   The first non empty slot after the wheel time is searched from
+  *         level 0 up: the slots of a level all come before the next slot of
+  *         the level above. The top level wraps around with the time.
+  * @retval The time of the event.
+  */
+static uint32_t TIM_WheelNext(uint8_t* Level, uint8_t* Slot)
+{
+  uint32_t level = 0, shift = 0, index = 0, bits = 0, slot = 0, next = 0;
+
+  *Level = TIM_WHEEL_IDLE;
+  *Slot = 0;
+  next = TIM_WheelNow + TIM_WHEEL_KEEPALIVE;
+
+  for (level = 0; level < TIM_WHEEL_LEVELS; level++)
+  {
+    shift = level * TIM_WHEEL_BITS;
+    index = (TIM_WheelNow >> shift) & TIM_WHEEL_MASK;
+    bits = TIM_WheelPending[level] & ~((((uint32_t)2) << index) - 1);
+    if ((bits == 0) && (level == (TIM_WHEEL_LEVELS - 1)))
+    {
+      bits = TIM_WheelPending[level];
+    }
+
+    if (bits != 0)
+    {
+      slot = __CLZ(__RBIT(bits));
+      if (level == (TIM_WHEEL_LEVELS - 1))
+      {
+        next = slot << shift;
+      }
+      else
+      {
+        next = (TIM_WheelNow & ~((((uint32_t)1) << (shift + TIM_WHEEL_BITS)) - 1)) | (slot << shift);
+      }
+
+      if ((next - TIM_WheelNow) <= TIM_WHEEL_KEEPALIVE)
+      {
+        *Level = (uint8_t)level;
+        *Slot = (uint8_t)slot;
+      }
+      else
+      {
+        next = TIM_WheelNow + TIM_WHEEL_KEEPALIVE;
+      }
+      break;
+    }
+  }
+
+  return next;
+}
+
+/**
+  * @brief  Sets the compare of channel 1 to the next event of the wheel.
+  * @note   Called with the interrupts disabled. An event already passed
+  *         raises the compare interrupt by software.
+  * @param  None
+  * @retval None
+  */
+static void TIM_WheelProgram(void)
+{
+  TIM_TypeDef* tim = TIM_WheelTIMx;
+  uint32_t next = 0;
+  uint8_t level = 0, slot = 0;
+
+  next = TIM_WheelNext(&level, &slot);
+  tim->CCR1 = next;
+  if ((int32_t)(next - tim->CNT) <= 0)
+  {
+    TIM_GenerateEvent(tim, TIM_EventSource_CC1);
+  }
+}
+
+/**
+  * @brief  Runs the timers expiring at the wheel time, and starts the
+  *         periodic ones again.
+  * @param  None
+  * @retval None
+  */
+static void TIM_WheelExpire(void)
+{
+  TIM_TimerTypeDef* timer = 0;
+  uint32_t primask = 0;
+
+  for (;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    timer = TIM_WheelSlots[0][TIM_WheelNow & TIM_WHEEL_MASK];
+    if (timer == 0)
+    {
+      __set_PRIMASK(primask);
+      break;
+    }
+    TIM_WheelRemove(timer);
+    if (timer->Period != 0)
+    {
+      timer->Expiry += timer->Period;
+      TIM_WheelInsert(timer);
+    }
+
+    __set_PRIMASK(primask);
+
+    if (timer->Callback != 0)
+    {
+      timer->Callback(timer);
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
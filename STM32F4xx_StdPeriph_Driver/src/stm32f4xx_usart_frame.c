@@ -0,0 +1,633 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_usart_frame.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a framed protocol layer for the USART, for the
+  *          protocols whose frames are delimited by a silent line, such as
+  *          Modbus RTU on RS-485:
+  *           - Reception by DMA, the end of the frame detected by the idle
+  *             line of the USART and timed by a software timer
+  *           - CRC-16/MODBUS checked on the received frames and added to the
+  *             sent ones by the table driven CRC engine
+  *           - Driver enable of the RS-485 transceiver released at the end of
+  *             the last stop bit
+  *          It uses the stm32f4xx_usart_stream.c/.h, stm32f4xx_crc_engine.c/.h
+  *          and stm32f4xx_tim_wheel.c/.h drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the USART, GPIO and DMA clocks, configure the TX and RX
+  *             pins in alternate function and the driver enable pin in output,
+  *             and call DMA_MgrInit() and TIM_WheelInit(). For a table driven
+  *             CRC, build the table of CRC_Param_CRC16_MODBUS using
+  *             CRC_TableInit().
+  *
+  *          2. Fill a USART_FrameInitTypeDef structure, starting from
+  *             USART_FrameStructInit(), and call USART_FrameInit() with a
+  *             USART_FrameTypeDef structure for the USART. Call
+  *             USART_FrameIRQHandler() from the interrupt handler of the USART,
+  *             DMA_MgrIRQHandler() from the interrupt handlers of the two streams
+  *             of the USART RX and TX requests, and enable the USART interrupt
+  *             using NVIC_Init().
+  *
+  *          3. The frames received are given to FrameCallback, without their
+  *             CRC. The frames with a wrong CRC or a line error are dropped and
+  *             counted.
+  *
+  *          4. Send a frame using USART_FrameSend(). With the CRC, the buffer
+  *             has two more bytes after the frame, which receive the CRC. The
+  *             buffer is read in place until TxCallback is called.
+  *
+  *          5. Read the statistics using USART_FrameGetStats().
+  *
+  * @note   The priority of the interrupts of the software timers must not be
+  *         higher than the priority of the USART and DMA interrupts.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_usart_frame.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup USART
+  * @brief USART driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+
+/* Line errors of a received byte */
+#define USART_FRAME_SR_ERRORS      (USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void USART_FrameRxBytes(USART_StreamTypeDef* Stream, const uint8_t* pData, uint16_t Length);
+static void USART_FrameSilence(TIM_TimerTypeDef* Timer);
+static void USART_FrameEnd(USART_FrameTypeDef* Frame);
+static void USART_FrameTxDone(USART_StreamTxBufferTypeDef* Buffer);
+static void USART_FrameTxEnd(USART_FrameTypeDef* Frame);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup USART_Private_Functions
+  * @{
+  */
+
+/** @defgroup USART_Group11 USART framed protocol functions
+ *  @brief   USART framed protocol functions
+ *
+@verbatim
+ ===============================================================================
+                      USART framed protocol functions
+ ===============================================================================
+
+  This subsection provides functions allowing to receive and send the frames
+  of a protocol delimited by a silent line, without one interrupt per byte.
+
+  The bytes are received by the USART stream into its circular buffer, and
+  copied into FrameBuffer when the line becomes idle and at each half of the
+  circular buffer. The USART detects the idle line one character after the
+  last stop bit: a software timer then measures the rest of SilentInterval.
+  If no byte came meanwhile, the frame ends; otherwise the silence was a gap
+  inside the frame, and the next idle line starts the timer again. The end of
+  a frame thus costs one USART interrupt and one timer interrupt, at any baud
+  rate; a SilentInterval of one character ends the frames at the idle line.
+
+  FrameBuffer has two halves: the frame given to FrameCallback stays in its
+  half while the next frame is received into the other one.
+
+  A frame is sent by DMA from the buffer of the caller. The driver enable of
+  the transceiver is set before the first byte and reset by the Transmission
+  Complete interrupt of the USART, at the end of the last stop bit; the
+  receiver of the USART is disabled meanwhile, so that the frame sent is not
+  received back.
+
+  The STM32F4xx USART has no receiver timeout: the idle line detection and
+  the software timer give the inter frame silence instead.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Fills each USART_FrameInitStruct member with its default value.
+  * @param  USART_FrameInitStruct: pointer to a USART_FrameInitTypeDef structure
+  *         which will be initialized.
+  * @note   The default is Modbus RTU at 19200 baud, 8E1, without driver enable.
+  * @retval None
+  */
+void USART_FrameStructInit(USART_FrameInitTypeDef* USART_FrameInitStruct)
+{
+  USART_FrameInitStruct->USARTx = 0;
+  USART_FrameInitStruct->USART_BaudRate = 19200;
+  USART_FrameInitStruct->USART_Parity = USART_Parity_Even;
+  USART_FrameInitStruct->USART_StopBits = USART_StopBits_1;
+  USART_FrameInitStruct->DE_GPIOx = 0;
+  USART_FrameInitStruct->DE_Pin = 0;
+  USART_FrameInitStruct->SilentInterval = 0;
+  USART_FrameInitStruct->Crc = ENABLE;
+  USART_FrameInitStruct->CrcTable = 0;
+  USART_FrameInitStruct->RxBufferSize = 0;
+  USART_FrameInitStruct->RxBuffer = 0;
+  USART_FrameInitStruct->FrameBufferSize = 256;
+  USART_FrameInitStruct->FrameBuffer = 0;
+  USART_FrameInitStruct->FrameCallback = 0;
+  USART_FrameInitStruct->TxCallback = 0;
+}
+
+/**
+  * @brief  Initializes a USART framed protocol: configures the USART and
+  *         starts the reception.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @param  USART_FrameInitStruct: pointer to a USART_FrameInitTypeDef structure
+  *         that contains the configuration of the protocol.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the USART is receiving
+  *          - ERROR: invalid configuration or no free DMA stream
+  */
+ErrorStatus USART_FrameInit(USART_FrameTypeDef* Frame, const USART_FrameInitTypeDef* USART_FrameInitStruct)
+{
+  USART_StreamInitTypeDef USART_StreamInitStructure;
+  USART_TypeDef* usart = USART_FrameInitStruct->USARTx;
+  uint32_t bits = 10, character = 0, silent = 0;
+
+  /* Check the parameters */
+  assert_param(IS_USART_ALL_PERIPH(usart));
+  assert_param(IS_USART_PARITY(USART_FrameInitStruct->USART_Parity));
+
+  if ((USART_FrameInitStruct->USART_BaudRate == 0) || (USART_FrameInitStruct->FrameBuffer == 0) ||
+      (USART_FrameInitStruct->FrameCallback == 0) ||
+      (USART_FrameInitStruct->FrameBufferSize <= USART_FRAME_CRC_SIZE) ||
+      ((USART_FrameInitStruct->USART_StopBits != USART_StopBits_1) &&
+       (USART_FrameInitStruct->USART_StopBits != USART_StopBits_2)))
+  {
+    return ERROR;
+  }
+
+  /* Bits of a character: start, 8 data bits, parity and stop bits */
+  if (USART_FrameInitStruct->USART_Parity != USART_Parity_No)
+  {
+    bits++;
+  }
+  if (USART_FrameInitStruct->USART_StopBits == USART_StopBits_2)
+  {
+    bits++;
+  }
+  character = ((bits * 1000000) + USART_FrameInitStruct->USART_BaudRate - 1) /
+              USART_FrameInitStruct->USART_BaudRate;
+
+  silent = USART_FrameInitStruct->SilentInterval;
+  if (silent == 0)
+  {
+    silent = USART_FRAME_MODBUS_T35_MAX;
+    if (USART_FrameInitStruct->USART_BaudRate <= USART_FRAME_MODBUS_FAST_BAUD)
+    {
+      silent = ((bits * 3500000) + USART_FrameInitStruct->USART_BaudRate - 1) /
+               USART_FrameInitStruct->USART_BaudRate;
+    }
+  }
+
+  Frame->Init = *USART_FrameInitStruct;
+  Frame->Received = 0;
+  Frame->Mark = 0;
+  Frame->Wait = (silent > character) ? (silent - character) : 0;
+  Frame->Errors = 0;
+  Frame->Fill = 0;
+  Frame->Delivering = 0;
+  Frame->TxBusy = 0;
+  Frame->Stats.RxFrames = 0;
+  Frame->Stats.CrcErrors = 0;
+  Frame->Stats.LineErrors = 0;
+  Frame->Stats.Overflows = 0;
+  Frame->Stats.Gaps = 0;
+  Frame->Stats.Missed = 0;
+  Frame->Stats.TxFrames = 0;
+
+  TIM_TimerInit(&Frame->Timer, USART_FrameSilence, Frame);
+
+  if (USART_FrameInitStruct->DE_GPIOx != 0)
+  {
+    GPIO_ResetBits(USART_FrameInitStruct->DE_GPIOx, USART_FrameInitStruct->DE_Pin);
+  }
+
+  USART_StreamInitStructure.USARTx = usart;
+  USART_StreamInitStructure.USART_BaudRate = USART_FrameInitStruct->USART_BaudRate;
+  USART_StreamInitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+  USART_StreamInitStructure.RxBufferSize = USART_FrameInitStruct->RxBufferSize;
+  USART_StreamInitStructure.RxBuffer = USART_FrameInitStruct->RxBuffer;
+  USART_StreamInitStructure.RxCallback = USART_FrameRxBytes;
+  Frame->Stream.Context = Frame;
+  if (USART_StreamInit(&Frame->Stream, &USART_StreamInitStructure) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  /* The stream runs in 8N1: set the parity and the stop bits. The parity bit
+     is the ninth bit of the word */
+  USART_Cmd(usart, DISABLE);
+  usart->CR1 &= (uint16_t)~(USART_CR1_M | USART_CR1_PCE | USART_CR1_PS);
+  if (USART_FrameInitStruct->USART_Parity != USART_Parity_No)
+  {
+    usart->CR1 |= USART_WordLength_9b | USART_FrameInitStruct->USART_Parity;
+  }
+  usart->CR2 = (uint16_t)((usart->CR2 & (uint16_t)~USART_CR2_STOP) | USART_FrameInitStruct->USART_StopBits);
+  USART_Cmd(usart, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a USART framed protocol and releases its DMA streams.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @retval None
+  */
+void USART_FrameDeInit(USART_FrameTypeDef* Frame)
+{
+  TIM_TimerStop(&Frame->Timer);
+  USART_ITConfig(Frame->Init.USARTx, USART_IT_TC, DISABLE);
+  USART_StreamDeInit(&Frame->Stream);
+
+  if (Frame->Init.DE_GPIOx != 0)
+  {
+    GPIO_ResetBits(Frame->Init.DE_GPIOx, Frame->Init.DE_Pin);
+  }
+  Frame->TxBusy = 0;
+}
+
+/**
+  * @brief  Sends a frame.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @param  Data: the bytes of the frame, followed by USART_FRAME_CRC_SIZE free
+  *         bytes which receive the CRC when it is enabled. Read in place until
+  *         TxCallback is called.
+  * @param  Length: number of bytes of the frame, without the CRC.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the frame is being sent
+  *          - ERROR: empty frame, or a frame is being sent
+  */
+ErrorStatus USART_FrameSend(USART_FrameTypeDef* Frame, uint8_t* Data, uint16_t Length)
+{
+  USART_TypeDef* usart = Frame->Init.USARTx;
+  uint32_t crc = 0, primask = 0;
+
+  if ((Data == 0) || (Length == 0) ||
+      ((Frame->Init.Crc != DISABLE) && (Length > (0xFFFF - USART_FRAME_CRC_SIZE))))
+  {
+    return ERROR;
+  }
+
+  primask = NVIC_EnterCritical();
+  if (Frame->TxBusy != 0)
+  {
+    NVIC_ExitCritical(primask);
+    return ERROR;
+  }
+  Frame->TxBusy = 1;
+  NVIC_ExitCritical(primask);
+
+  if (Frame->Init.Crc != DISABLE)
+  {
+    crc = CRC_Compute(&CRC_Param_CRC16_MODBUS, Frame->Init.CrcTable, Data, Length);
+    Data[Length] = (uint8_t)crc;
+    Data[Length + 1] = (uint8_t)(crc >> 8);
+    Length += USART_FRAME_CRC_SIZE;
+  }
+
+  if (Frame->Init.DE_GPIOx != 0)
+  {
+    GPIO_SetBits(Frame->Init.DE_GPIOx, Frame->Init.DE_Pin);
+
+    /* The receiver of the transceiver echoes the frame or floats */
+    primask = NVIC_EnterCritical();
+    usart->CR1 &= (uint16_t)~USART_CR1_RE;
+    NVIC_ExitCritical(primask);
+  }
+
+  /* TC is set since the last frame: clear it before the DMA writes DR */
+  USART_ClearFlag(usart, USART_FLAG_TC);
+
+  Frame->TxBuffer.pData = Data;
+  Frame->TxBuffer.Length = Length;
+  Frame->TxBuffer.Callback = USART_FrameTxDone;
+  Frame->TxBuffer.Context = Frame;
+  if (USART_StreamSend(&Frame->Stream, &Frame->TxBuffer) != SUCCESS)
+  {
+    USART_FrameTxEnd(Frame);
+    return ERROR;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Checks whether a frame is being sent.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @retval The new state of the transmission (SET or RESET).
+  */
+FlagStatus USART_FrameTxBusy(USART_FrameTypeDef* Frame)
+{
+  return (Frame->TxBusy != 0) ? SET : RESET;
+}
+
+/**
+  * @brief  Returns the statistics of a USART framed protocol.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @param  Stats: pointer to a USART_FrameStatsTypeDef structure which receives
+  *         the statistics.
+  * @retval None
+  */
+void USART_FrameGetStats(USART_FrameTypeDef* Frame, USART_FrameStatsTypeDef* Stats)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  *Stats = Frame->Stats;
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Handles the idle line, error and transmission complete interrupts
+  *         of the USART.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @note   This function must be called from the interrupt handler of the USART,
+  *         instead of USART_StreamIRQHandler().
+  * @retval None
+  */
+void USART_FrameIRQHandler(USART_FrameTypeDef* Frame)
+{
+  USART_TypeDef* usart = Frame->Init.USARTx;
+  uint16_t sr = usart->SR;
+  uint32_t primask = 0, end = 0;
+
+  /* The last stop bit of the frame sent is on the line */
+  if (((sr & USART_SR_TC) != 0) && ((usart->CR1 & USART_CR1_TCIE) != 0))
+  {
+    USART_ITConfig(usart, USART_IT_TC, DISABLE);
+    USART_ClearITPendingBit(usart, USART_IT_TC);
+    Frame->Stats.TxFrames++;
+    USART_FrameTxEnd(Frame);
+  }
+
+  /* The error flags stay set until the stream handler reads DR below: they
+     belong to a byte of the frame in progress */
+  if ((sr & USART_FRAME_SR_ERRORS) != 0)
+  {
+    Frame->Errors = 1;
+  }
+
+  USART_StreamIRQHandler(&Frame->Stream);
+
+  if ((sr & USART_SR_IDLE) != 0)
+  {
+    primask = NVIC_EnterCritical();
+
+    if (Frame->Received != 0)
+    {
+      Frame->Mark = Frame->Received;
+      if (Frame->Wait == 0)
+      {
+        end = 1;
+      }
+      else
+      {
+        (void)TIM_TimerStart(&Frame->Timer, Frame->Wait, 0);
+      }
+    }
+
+    NVIC_ExitCritical(primask);
+
+    if (end != 0)
+    {
+      USART_FrameEnd(Frame);
+    }
+  }
+}
+
+/**
+  * @brief  Receives the bytes delivered by the USART stream.
+  * @param  Stream: the USART stream of the frame.
+  * @param  pData: the bytes, in place in RxBuffer.
+  * @param  Length: number of bytes.
+  * @note   This function is called with the interrupts disabled.
+  * @retval None
+  */
+static void USART_FrameRxBytes(USART_StreamTypeDef* Stream, const uint8_t* pData, uint16_t Length)
+{
+  USART_FrameTypeDef* frame = (USART_FrameTypeDef*)Stream->Context;
+  uint8_t* buffer = frame->Init.FrameBuffer + (frame->Fill * frame->Init.FrameBufferSize);
+  uint32_t index = 0;
+
+  /* The bytes beyond FrameBuffer are counted only: the frame is dropped */
+  for (index = 0; index < Length; index++)
+  {
+    if (frame->Received < frame->Init.FrameBufferSize)
+    {
+      buffer[frame->Received] = pData[index];
+    }
+    frame->Received++;
+  }
+}
+
+/**
+  * @brief  End of the silent interval after the idle line.
+  * @param  Timer: the timer of the frame.
+  * @retval None
+  */
+static void USART_FrameSilence(TIM_TimerTypeDef* Timer)
+{
+  USART_FrameTypeDef* frame = (USART_FrameTypeDef*)Timer->Context;
+
+  /* Deliver the bytes received since the idle line, if any */
+  (void)USART_StreamAvailable(&frame->Stream);
+
+  USART_FrameEnd(frame);
+}
+
+/**
+  * @brief  Ends the frame in progress if the line stayed silent since the idle
+  *         line, and gives it to FrameCallback.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @retval None
+  */
+static void USART_FrameEnd(USART_FrameTypeDef* Frame)
+{
+  const uint8_t* buffer;
+  uint32_t primask = 0, length = 0, errors = 0, crc = 1;
+
+  primask = NVIC_EnterCritical();
+
+  if (Frame->Received != Frame->Mark)
+  {
+    /* Bytes came before the end of the silent interval: the frame goes on
+       until the next idle line */
+    Frame->Stats.Gaps++;
+    NVIC_ExitCritical(primask);
+    return;
+  }
+  if (Frame->Received == 0)
+  {
+    NVIC_ExitCritical(primask);
+    return;
+  }
+
+  length = Frame->Received;
+  errors = Frame->Errors;
+  buffer = Frame->Init.FrameBuffer + (Frame->Fill * Frame->Init.FrameBufferSize);
+  Frame->Received = 0;
+  Frame->Mark = 0;
+  Frame->Errors = 0;
+
+  if (Frame->Delivering != 0)
+  {
+    /* The next frame goes to the same half */
+    Frame->Stats.Missed++;
+    NVIC_ExitCritical(primask);
+    return;
+  }
+
+  if (errors != 0)
+  {
+    Frame->Stats.LineErrors++;
+    length = 0;
+  }
+  else if (length > Frame->Init.FrameBufferSize)
+  {
+    Frame->Stats.Overflows++;
+    length = 0;
+  }
+  else if (Frame->Init.Crc == DISABLE)
+  {
+    crc = 0;
+  }
+
+  if (length != 0)
+  {
+    /* The received half is delivered, the next frame fills the other one */
+    Frame->Fill ^= 1;
+    Frame->Delivering = 1;
+  }
+
+  NVIC_ExitCritical(primask);
+
+  if (length == 0)
+  {
+    return;
+  }
+
+  /* The CRC of a frame followed by its CRC is 0 */
+  if (crc != 0)
+  {
+    if ((length > USART_FRAME_CRC_SIZE) &&
+        (CRC_Compute(&CRC_Param_CRC16_MODBUS, Frame->Init.CrcTable, buffer, length) == 0))
+    {
+      length -= USART_FRAME_CRC_SIZE;
+      crc = 0;
+    }
+    else
+    {
+      Frame->Stats.CrcErrors++;
+    }
+  }
+
+  if (crc == 0)
+  {
+    Frame->Stats.RxFrames++;
+    Frame->Init.FrameCallback(Frame, buffer, (uint16_t)length);
+  }
+
+  Frame->Delivering = 0;
+}
+
+/**
+  * @brief  Callback of the DMA transfer of the frame sent: the last byte is
+  *         written to the USART.
+  * @param  Buffer: the TX buffer of the frame.
+  * @retval None
+  */
+static void USART_FrameTxDone(USART_StreamTxBufferTypeDef* Buffer)
+{
+  USART_FrameTypeDef* frame = (USART_FrameTypeDef*)Buffer->Context;
+
+  if (Buffer->Status != DMA_MGR_XFER_DONE)
+  {
+    USART_FrameTxEnd(frame);
+    return;
+  }
+
+  /* The driver enable is released at the end of the last stop bit */
+  USART_ITConfig(frame->Init.USARTx, USART_IT_TC, ENABLE);
+}
+
+/**
+  * @brief  Releases the driver enable and enables the receiver again.
+  * @param  Frame: pointer to the USART_FrameTypeDef structure of the USART.
+  * @retval None
+  */
+static void USART_FrameTxEnd(USART_FrameTypeDef* Frame)
+{
+  uint32_t primask = 0;
+
+  if (Frame->Init.DE_GPIOx != 0)
+  {
+    GPIO_ResetBits(Frame->Init.DE_GPIOx, Frame->Init.DE_Pin);
+
+    primask = NVIC_EnterCritical();
+    Frame->Init.USARTx->CR1 |= USART_CR1_RE;
+    NVIC_ExitCritical(primask);
+  }
+
+  Frame->TxBusy = 0;
+  if (Frame->Init.TxCallback != 0)
+  {
+    Frame->Init.TxCallback(Frame);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
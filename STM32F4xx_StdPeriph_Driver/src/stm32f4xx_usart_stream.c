@@ -0,0 +1,592 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_usart_stream.c
+  * @author  MCD Application Team
+  * @version V1.0.2
+  * @date    05-March-2012
+  * @brief   This file provides a streaming layer for the USART, for the links
+  *          where one interrupt per byte is too much:
+  *           - Reception into a circular buffer by DMA, delivered when the line
+  *             becomes idle and at each half of the buffer
+  *           - Transmission of a chain of caller buffers by DMA, without copy
+  *           - RTS/CTS flow control
+  *           - Byte counts and overrun statistics
+  *          It uses the stm32f4xx_usart.c/.h and stm32f4xx_dma_mgr.c drivers.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                   How to use this driver
+  *          ===================================================================
+  *          1. Enable the USART, GPIO and DMA clocks, configure the TX and RX
+  *             pins (and RTS and CTS with the flow control) in alternate function
+  *             and call DMA_MgrInit().
+  *
+  *          2. Call USART_StreamInit() with a USART_StreamTypeDef structure for the
+  *             USART. Call USART_StreamIRQHandler() from the interrupt handler of
+  *             the USART, DMA_MgrIRQHandler() from the interrupt handlers of the two
+  *             streams of the USART RX and TX requests, and enable the USART
+  *             interrupt using NVIC_Init().
+  *
+  *          3. Receive the bytes:
+  *              - with an RxCallback: the callback gets the bytes in place in
+  *                RxBuffer, at most two calls per event when the received bytes
+  *                wrap around the end of RxBuffer. They are overwritten once the
+  *                DMA comes back to them, one RxBufferSize later.
+  *              - without RxCallback: the bytes are copied out of RxBuffer using
+  *                USART_StreamRead(), and USART_StreamAvailable() returns how many
+  *                are waiting.
+  *
+  *          4. Send buffers using USART_StreamSend(). The buffers are sent in the
+  *             order they are queued, from the memory of the caller, which must
+  *             not change them until their Callback is called.
+  *
+  *          5. Read the statistics using USART_StreamGetStats().
+  *
+  * @note   With RTS/CTS flow control and without RxCallback, the DMA requests of
+  *         the receiver are stopped when the next bytes would overwrite unread
+  *         ones: the USART then holds the next byte and deasserts RTS until
+  *         USART_StreamRead() frees enough of RxBuffer.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx_usart_stream.h"
+#include "misc.h"
+
+/** @addtogroup STM32F4xx_StdPeriph_Driver
+  * @{
+  */
+
+/** @defgroup USART
+  * @brief USART driver modules
+  * @{
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+
+/* DMA manager requests of the USARTs */
+static USART_TypeDef* const USART_StreamPeriphs[6] =
+{
+  USART1, USART2, USART3, UART4, UART5, USART6
+};
+
+static const uint32_t USART_StreamRxRequests[6] =
+{
+  DMA_MGR_REQ_USART1_RX, DMA_MGR_REQ_USART2_RX, DMA_MGR_REQ_USART3_RX,
+  DMA_MGR_REQ_UART4_RX, DMA_MGR_REQ_UART5_RX, DMA_MGR_REQ_USART6_RX
+};
+
+static const uint32_t USART_StreamTxRequests[6] =
+{
+  DMA_MGR_REQ_USART1_TX, DMA_MGR_REQ_USART2_TX, DMA_MGR_REQ_USART3_TX,
+  DMA_MGR_REQ_UART4_TX, DMA_MGR_REQ_UART5_TX, DMA_MGR_REQ_USART6_TX
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t USART_StreamWriteIndex(USART_StreamTypeDef* Stream, uint32_t* Remaining);
+static void USART_StreamRxEvent(USART_StreamTypeDef* Stream);
+static void USART_StreamRxDone(DMA_MgrXferTypeDef* Xfer);
+static void USART_StreamTxDone(DMA_MgrXferTypeDef* Xfer);
+
+/* Private functions ---------------------------------------------------------*/
+
+/** @defgroup USART_Private_Functions
+  * @{
+  */
+
+/** @defgroup USART_Group10 USART streaming functions
+ *  @brief   USART streaming functions
+ *
+@verbatim
+ ===============================================================================
+                         USART streaming functions
+ ===============================================================================
+
+  This subsection provides functions allowing to stream data through a USART
+  by DMA, with interrupts per block of data instead of per byte.
+
+  The RX stream runs in the streaming mode of the DMA manager on the two halves
+  of RxBuffer: each half is queued again as soon as it is filled, so that the
+  DMA never stops. The position of the DMA in RxBuffer is given by its current
+  memory target and its data counter. The received bytes are delivered at each
+  half of RxBuffer, and when the USART detects an idle line, so that the end of
+  a frame shorter than RxBuffer is not delayed.
+
+  The TX buffers are the transfer descriptors of the DMA manager: they are
+  chained by the Transfer Complete interrupt of the TX stream, and sent from
+  the memory of the caller.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initializes a USART stream: configures the USART and starts the
+  *         reception.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @param  USART_StreamInitStruct: pointer to a USART_StreamInitTypeDef structure
+  *         that contains the configuration of the stream.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the stream is receiving
+  *          - ERROR: invalid configuration or no free DMA stream
+  */
+ErrorStatus USART_StreamInit(USART_StreamTypeDef* Stream, const USART_StreamInitTypeDef* USART_StreamInitStruct)
+{
+  USART_InitTypeDef USART_InitStructure;
+  DMA_InitTypeDef DMA_InitStructure;
+  USART_TypeDef* usart = USART_StreamInitStruct->USARTx;
+  uint32_t index = 0, half = USART_StreamInitStruct->RxBufferSize / 2;
+
+  /* Check the parameters */
+  assert_param(IS_USART_ALL_PERIPH(usart));
+  assert_param(IS_USART_HARDWARE_FLOW_CONTROL(USART_StreamInitStruct->USART_HardwareFlowControl));
+
+  if ((USART_StreamInitStruct->RxBuffer == 0) || (half == 0) ||
+      ((USART_StreamInitStruct->RxBufferSize & 0x1) != 0))
+  {
+    return ERROR;
+  }
+
+  while ((index < 6) && (USART_StreamPeriphs[index] != usart))
+  {
+    index++;
+  }
+  if (index == 6)
+  {
+    return ERROR;
+  }
+
+  Stream->Init = *USART_StreamInitStruct;
+  Stream->WrIndex = 0;
+  Stream->RdIndex = 0;
+  Stream->Unread = 0;
+  Stream->Paused = 0;
+  Stream->Stats.RxBytes = 0;
+  Stream->Stats.TxBytes = 0;
+  Stream->Stats.RxIdle = 0;
+  Stream->Stats.RxOverruns = 0;
+  Stream->Stats.RxLost = 0;
+  Stream->Stats.FramingErrors = 0;
+  Stream->Stats.NoiseErrors = 0;
+
+  /* RX stream: streaming mode on the two halves of RxBuffer */
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&usart->DR;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+  DMA_InitStructure.DMA_BufferSize = half;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  Stream->RxStream = DMA_MgrAlloc(USART_StreamRxRequests[index], &DMA_InitStructure);
+  if (Stream->RxStream == 0)
+  {
+    return ERROR;
+  }
+
+  /* TX stream: one transfer per TX buffer */
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+  Stream->TxStream = DMA_MgrAlloc(USART_StreamTxRequests[index], &DMA_InitStructure);
+  if (Stream->TxStream == 0)
+  {
+    DMA_MgrFree(Stream->RxStream);
+    Stream->RxStream = 0;
+    return ERROR;
+  }
+
+  USART_InitStructure.USART_BaudRate = USART_StreamInitStruct->USART_BaudRate;
+  USART_InitStructure.USART_WordLength = USART_WordLength_8b;
+  USART_InitStructure.USART_StopBits = USART_StopBits_1;
+  USART_InitStructure.USART_Parity = USART_Parity_No;
+  USART_InitStructure.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
+  USART_InitStructure.USART_HardwareFlowControl = USART_StreamInitStruct->USART_HardwareFlowControl;
+  USART_Init(usart, &USART_InitStructure);
+
+  Stream->RxXfer[0].MemoryBaseAddr = (uint32_t)USART_StreamInitStruct->RxBuffer;
+  Stream->RxXfer[1].MemoryBaseAddr = (uint32_t)USART_StreamInitStruct->RxBuffer + half;
+  for (index = 0; index < 2; index++)
+  {
+    Stream->RxXfer[index].Count = (uint16_t)half;
+    Stream->RxXfer[index].Callback = USART_StreamRxDone;
+    Stream->RxXfer[index].Context = Stream;
+    DMA_MgrSubmit(Stream->RxStream, &Stream->RxXfer[index]);
+  }
+
+  USART_DMACmd(usart, USART_DMAReq_Rx | USART_DMAReq_Tx, ENABLE);
+  USART_ITConfig(usart, USART_IT_IDLE, ENABLE);
+  USART_ITConfig(usart, USART_IT_ERR, ENABLE);
+  USART_Cmd(usart, ENABLE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Stops a USART stream and releases its DMA streams.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @note   The TX buffers not sent yet are given back with their Status set to
+  *         DMA_MGR_XFER_ABORTED.
+  * @retval None
+  */
+void USART_StreamDeInit(USART_StreamTypeDef* Stream)
+{
+  USART_TypeDef* usart = Stream->Init.USARTx;
+
+  USART_ITConfig(usart, USART_IT_IDLE, DISABLE);
+  USART_ITConfig(usart, USART_IT_ERR, DISABLE);
+  USART_DMACmd(usart, USART_DMAReq_Rx | USART_DMAReq_Tx, DISABLE);
+  USART_Cmd(usart, DISABLE);
+
+  if (Stream->RxStream != 0)
+  {
+    DMA_MgrFree(Stream->RxStream);
+    Stream->RxStream = 0;
+  }
+  if (Stream->TxStream != 0)
+  {
+    DMA_MgrFree(Stream->TxStream);
+    Stream->TxStream = 0;
+  }
+}
+
+/**
+  * @brief  Returns the number of received bytes waiting for USART_StreamRead().
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @retval The number of bytes.
+  */
+uint16_t USART_StreamAvailable(USART_StreamTypeDef* Stream)
+{
+  uint32_t primask = 0;
+  uint16_t available = 0;
+
+  primask = NVIC_EnterCritical();
+
+  USART_StreamRxEvent(Stream);
+  available = (uint16_t)Stream->Unread;
+
+  NVIC_ExitCritical(primask);
+
+  return available;
+}
+
+/**
+  * @brief  Copies received bytes out of RxBuffer.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART,
+  *         initialized without RxCallback.
+  * @param  Buffer: receives the bytes.
+  * @param  Length: the size of Buffer.
+  * @retval The number of bytes copied.
+  */
+uint16_t USART_StreamRead(USART_StreamTypeDef* Stream, uint8_t* Buffer, uint16_t Length)
+{
+  const uint8_t* rxbuffer = Stream->Init.RxBuffer;
+  uint32_t size = Stream->Init.RxBufferSize;
+  uint32_t primask = 0;
+  uint32_t count = 0, first = 0, index = 0, remaining = 0;
+
+  primask = NVIC_EnterCritical();
+  USART_StreamRxEvent(Stream);
+  count = (Length < Stream->Unread) ? Length : Stream->Unread;
+  index = Stream->RdIndex;
+  NVIC_ExitCritical(primask);
+
+  /* With the flow control, the DMA does not write over these bytes until they
+     are released below */
+  first = size - index;
+  if (first > count)
+  {
+    first = count;
+  }
+  for (remaining = 0; remaining < first; remaining++)
+  {
+    Buffer[remaining] = rxbuffer[index + remaining];
+  }
+  for (remaining = first; remaining < count; remaining++)
+  {
+    Buffer[remaining] = rxbuffer[remaining - first];
+  }
+
+  primask = NVIC_EnterCritical();
+
+  /* Release the bytes copied, unless the DMA wrapped over them meanwhile */
+  if (Stream->RdIndex == index)
+  {
+    Stream->RdIndex = (index + count) % size;
+    Stream->Unread -= count;
+  }
+
+  if (Stream->Paused != 0)
+  {
+    USART_StreamWriteIndex(Stream, &remaining);
+    if ((size - Stream->Unread) > remaining)
+    {
+      /* The rest of the half of the DMA is free again */
+      Stream->Paused = 0;
+      USART_DMACmd(Stream->Init.USARTx, USART_DMAReq_Rx, ENABLE);
+    }
+  }
+
+  NVIC_ExitCritical(primask);
+
+  return (uint16_t)count;
+}
+
+/**
+  * @brief  Queues a buffer to send.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @param  Buffer: pointer to a USART_StreamTxBufferTypeDef structure whose pData
+  *         and Length give the bytes to send.
+  * @retval An ErrorStatus enumeration value:
+  *          - SUCCESS: the buffer is queued
+  *          - ERROR: the buffer is empty
+  */
+ErrorStatus USART_StreamSend(USART_StreamTypeDef* Stream, USART_StreamTxBufferTypeDef* Buffer)
+{
+  if ((Buffer->Length == 0) || (Buffer->pData == 0))
+  {
+    return ERROR;
+  }
+
+  Buffer->Stream = Stream;
+  Buffer->Status = DMA_MGR_XFER_QUEUED;
+  Buffer->Xfer.MemoryBaseAddr = (uint32_t)Buffer->pData;
+  Buffer->Xfer.Count = Buffer->Length;
+  Buffer->Xfer.Callback = USART_StreamTxDone;
+  Buffer->Xfer.Context = Buffer;
+
+  return DMA_MgrSubmit(Stream->TxStream, &Buffer->Xfer);
+}
+
+/**
+  * @brief  Returns the statistics of a USART stream.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @param  Stats: pointer to a USART_StreamStatsTypeDef structure which receives
+  *         the statistics.
+  * @retval None
+  */
+void USART_StreamGetStats(USART_StreamTypeDef* Stream, USART_StreamStatsTypeDef* Stats)
+{
+  uint32_t primask = NVIC_EnterCritical();
+
+  USART_StreamRxEvent(Stream);
+  *Stats = Stream->Stats;
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Handles the idle line and error interrupts of the USART.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @note   This function must be called from the interrupt handler of the USART.
+  * @retval None
+  */
+void USART_StreamIRQHandler(USART_StreamTypeDef* Stream)
+{
+  USART_TypeDef* usart = Stream->Init.USARTx;
+  uint16_t sr = usart->SR;
+  uint32_t primask;
+
+  if ((sr & (USART_SR_IDLE | USART_SR_ORE | USART_SR_FE | USART_SR_NE)) == 0)
+  {
+    return;
+  }
+
+  /* IDLE, ORE, FE and NE are cleared by a read of SR followed by a read of DR.
+     The received bytes are read by the DMA: DR holds no new byte here */
+  (void)usart->DR;
+
+  if ((sr & USART_SR_ORE) != 0)
+  {
+    Stream->Stats.RxOverruns++;
+  }
+  if ((sr & USART_SR_FE) != 0)
+  {
+    Stream->Stats.FramingErrors++;
+  }
+  if ((sr & USART_SR_NE) != 0)
+  {
+    Stream->Stats.NoiseErrors++;
+  }
+
+  if ((sr & USART_SR_IDLE) != 0)
+  {
+    primask = NVIC_EnterCritical();
+
+    Stream->Stats.RxIdle++;
+    USART_StreamRxEvent(Stream);
+
+    NVIC_ExitCritical(primask);
+  }
+}
+
+/**
+  * @brief  Returns the position of the RX DMA in RxBuffer.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @param  Remaining: receives the number of bytes to the end of the half of
+  *         RxBuffer being filled.
+  * @retval The index of the next byte written by the DMA.
+  */
+static uint32_t USART_StreamWriteIndex(USART_StreamTypeDef* Stream, uint32_t* Remaining)
+{
+  DMA_Stream_TypeDef* rx = Stream->RxStream;
+  uint32_t target = 0, ndtr = 0, address = 0;
+  uint32_t half = Stream->Init.RxBufferSize / 2;
+
+  /* Read a data counter which belongs to the memory target */
+  do
+  {
+    target = DMA_GetCurrentMemoryTarget(rx);
+    ndtr = DMA_GetCurrDataCounter(rx);
+  }
+  while (target != DMA_GetCurrentMemoryTarget(rx));
+
+  address = (target != 0) ? rx->M1AR : rx->M0AR;
+  *Remaining = ndtr;
+
+  return ((address - (uint32_t)Stream->Init.RxBuffer) + half - ndtr) % Stream->Init.RxBufferSize;
+}
+
+/**
+  * @brief  Accounts for the bytes received since the last event and delivers
+  *         them.
+  * @param  Stream: pointer to the USART_StreamTypeDef structure of the USART.
+  * @note   This function is called with the interrupts disabled.
+  * @retval None
+  */
+static void USART_StreamRxEvent(USART_StreamTypeDef* Stream)
+{
+  const uint8_t* rxbuffer = Stream->Init.RxBuffer;
+  uint32_t size = Stream->Init.RxBufferSize;
+  uint32_t wr = 0, count = 0, remaining = 0, rd = Stream->RdIndex;
+
+  if (Stream->RxStream == 0)
+  {
+    return;
+  }
+
+  wr = USART_StreamWriteIndex(Stream, &remaining);
+  count = (wr + size - Stream->WrIndex) % size;
+  Stream->WrIndex = wr;
+  Stream->Stats.RxBytes += count;
+
+  if (Stream->Init.RxCallback != 0)
+  {
+    Stream->RdIndex = wr;
+    if (wr < rd)
+    {
+      Stream->Init.RxCallback(Stream, &rxbuffer[rd], (uint16_t)(size - rd));
+      rd = 0;
+    }
+    if (wr > rd)
+    {
+      Stream->Init.RxCallback(Stream, &rxbuffer[rd], (uint16_t)(wr - rd));
+    }
+    return;
+  }
+
+  Stream->Unread += count;
+  if (Stream->Unread > size)
+  {
+    /* The DMA wrapped over unread bytes: the oldest bytes are at the DMA */
+    Stream->Stats.RxLost += Stream->Unread - size;
+    Stream->Unread = size;
+    Stream->RdIndex = wr;
+  }
+
+  /* Stop the DMA before it writes over unread bytes: the USART deasserts RTS */
+  if ((Stream->Init.USART_HardwareFlowControl == USART_HardwareFlowControl_RTS_CTS) &&
+      (Stream->Paused == 0) && ((size - Stream->Unread) <= remaining))
+  {
+    Stream->Paused = 1;
+    USART_DMACmd(Stream->Init.USARTx, USART_DMAReq_Rx, DISABLE);
+  }
+}
+
+/**
+  * @brief  Callback of the RX DMA transfers: a half of RxBuffer is filled.
+  * @param  Xfer: the RX DMA transfer of the half.
+  * @retval None
+  */
+static void USART_StreamRxDone(DMA_MgrXferTypeDef* Xfer)
+{
+  USART_StreamTypeDef* stream = (USART_StreamTypeDef*)Xfer->Context;
+  uint32_t primask;
+
+  if (Xfer->Status == DMA_MGR_XFER_ABORTED)
+  {
+    return;
+  }
+
+  primask = NVIC_EnterCritical();
+
+  USART_StreamRxEvent(stream);
+
+  /* Queue the half again behind the other one */
+  DMA_MgrSubmit(stream->RxStream, Xfer);
+
+  NVIC_ExitCritical(primask);
+}
+
+/**
+  * @brief  Callback of the TX DMA transfers.
+  * @param  Xfer: the DMA transfer of a TX buffer.
+  * @retval None
+  */
+static void USART_StreamTxDone(DMA_MgrXferTypeDef* Xfer)
+{
+  USART_StreamTxBufferTypeDef* buffer = (USART_StreamTxBufferTypeDef*)Xfer->Context;
+
+  if (Xfer->Status == DMA_MGR_XFER_DONE)
+  {
+    buffer->Stream->Stats.TxBytes += buffer->Length;
+  }
+
+  buffer->Status = Xfer->Status;
+  if (buffer->Callback != 0)
+  {
+    buffer->Callback(buffer);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -56,11 +56,135 @@
 
 /* Number of sub-packets in the audio transfer buffer. You can modify this value but always make sure
   that it is an even number and higher than 3 */
-#define OUT_PACKET_NUM                                   4
+#ifndef OUT_PACKET_NUM
+ #define OUT_PACKET_NUM                                  4
+#endif
 /* Total size of the audio transfer buffer */
 #define TOTAL_OUT_BUF_SIZE                           ((uint32_t)(AUDIO_OUT_PACKET * OUT_PACKET_NUM))
 
-#define AUDIO_CONFIG_DESC_SIZE                        109
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+/* Sampling frequencies of each alternate setting (USBD_AUDIO_FREQ is the
+   one used until the host sets another), the highest one last */
+#ifndef AUDIO_FREQ_1
+ #define AUDIO_FREQ_1                                 44100
+#endif
+#ifndef AUDIO_FREQ_2
+ #define AUDIO_FREQ_2                                 48000
+#endif
+#ifndef AUDIO_FREQ_3
+ #define AUDIO_FREQ_3                                 96000
+#endif
+#define AUDIO_FREQ_NUM                                3
+#define AUDIO_FREQ_MAX                                AUDIO_FREQ_3
+
+/* Alternate settings of the streaming interface */
+#define AUDIO_ALT_16BIT                               1
+#define AUDIO_ALT_24BIT                               2
+
+/* Largest packet for a subframe size (2 or 3 bytes): two more samples per
+   frame than the highest frequency */
+#define AUDIO_PACKET_MAX(sub)                         (((AUDIO_FREQ_MAX / 1000) + 2) * 2 * (sub))
+#define AUDIO_OUT_PACKET_MAX                          AUDIO_PACKET_MAX(2)
+#define AUDIO_OUT_PACKET_MAX_24                       AUDIO_PACKET_MAX(3)
+#endif /* AUDIO_MULTI_FORMAT_ENABLED */
+
+#ifdef AUDIO_FEEDBACK_ENABLED
+/* Isochronous IN endpoint reporting the codec rate to the host */
+#ifndef AUDIO_FB_EP
+ #define AUDIO_FB_EP                                  0x81
+#endif
+#define AUDIO_FB_PACKET                               3
+
+/* Feedback period: 2^AUDIO_FB_REFRESH frames (bRefresh, 1 to 9) */
+#ifndef AUDIO_FB_REFRESH
+ #define AUDIO_FB_REFRESH                             5
+#endif
+
+/* Fill level kept in the ring: starts at AUDIO_FB_MIN_PACKETS packets,
+   raised by half a packet on each underrun (up to half the ring) and
+   lowered by one sample after every AUDIO_FB_DECAY frames played without
+   underrun */
+#ifndef AUDIO_FB_MIN_PACKETS
+ #define AUDIO_FB_MIN_PACKETS                         2
+#endif
+#ifndef AUDIO_FB_DECAY
+ #define AUDIO_FB_DECAY                               1024
+#endif
+
+/* Correction of 2^-AUDIO_FB_GAIN sample per frame for each sample of fill
+   level error, and smoothing of the measured rate (2^AUDIO_FB_FILTER
+   periods) */
+#define AUDIO_FB_GAIN                                 6
+#define AUDIO_FB_FILTER                               3
+
+#ifndef AUDIO_OUT_PACKET_MAX
+/* The host may send up to two more samples per frame to catch up */
+ #define AUDIO_OUT_PACKET_MAX                         (AUDIO_OUT_PACKET + 8)
+#endif
+#define AUDIO_OUT_EP_ATTRIBUTES                       (USB_ENDPOINT_TYPE_ISOCHRONOUS | USB_ENDPOINT_SYNC_ASYNCHRONOUS)
+#define AUDIO_OUT_EP_SYNCH                            AUDIO_FB_EP
+#else
+#define AUDIO_OUT_EP_ATTRIBUTES                       USB_ENDPOINT_TYPE_ISOCHRONOUS
+#define AUDIO_OUT_EP_SYNCH                            0x00
+#endif /* AUDIO_FEEDBACK_ENABLED */
+
+#if defined (AUDIO_FEEDBACK_ENABLED) || defined (AUDIO_MULTI_FORMAT_ENABLED)
+/* IsocOutBuff is a pool holding the packet buffer and a byte ring, carved
+   for the format selected on SET_INTERFACE */
+#ifndef AUDIO_POOL_SIZE
+ #ifdef AUDIO_MULTI_FORMAT_ENABLED
+  #define AUDIO_POOL_SIZE                             4096
+ #else
+  #define AUDIO_POOL_SIZE                             (TOTAL_OUT_BUF_SIZE * 3)
+ #endif
+#endif
+#endif
+
+#ifdef AUDIO_IN_ENABLED
+/* Microphone: isochronous IN endpoint fed from a DMA double buffer */
+#ifndef AUDIO_IN_EP
+ #define AUDIO_IN_EP                                  0x82
+#endif
+#ifndef AUDIO_IN_FREQ
+ #define AUDIO_IN_FREQ                                48000
+#endif
+#ifndef AUDIO_IN_CHANNELS
+ #define AUDIO_IN_CHANNELS                            2
+#endif
+
+/* Frames captured in each of the two DMA memory targets: the capture
+   latency is about AUDIO_IN_FRAMES + 1 ms */
+#ifndef AUDIO_IN_FRAMES
+ #define AUDIO_IN_FRAMES                              2
+#endif
+
+#define AUDIO_IN_STREAMING_ITF                        0x02
+#define AUDIO_IN_SAMPLE_SIZE                          (AUDIO_IN_CHANNELS * 2)
+#define AUDIO_IN_PACKET                               ((AUDIO_IN_FREQ / 1000) * AUDIO_IN_SAMPLE_SIZE)
+/* One sample more than a frame, to catch up with the ADC clock */
+#define AUDIO_IN_PACKET_MAX                           (((AUDIO_IN_FREQ + 999) / 1000 + 1) * AUDIO_IN_SAMPLE_SIZE)
+/* Size of a DMA memory target */
+#define AUDIO_IN_BUF_SIZE                             (((AUDIO_IN_FREQ * AUDIO_IN_FRAMES) / 1000) * AUDIO_IN_SAMPLE_SIZE)
+
+/* Microphone terminals, streaming interface and the AudioControl header
+   entry, added to the configuration descriptor */
+#define AUDIO_IN_DESC_SIZE                            74
+#else
+#define AUDIO_IN_DESC_SIZE                            0
+#endif /* AUDIO_IN_ENABLED */
+
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+ #ifdef AUDIO_FEEDBACK_ENABLED
+  #define AUDIO_OUT_CONFIG_DESC_SIZE                  182
+ #else
+  #define AUDIO_OUT_CONFIG_DESC_SIZE                  164
+ #endif
+#elif defined (AUDIO_FEEDBACK_ENABLED)
+ #define AUDIO_OUT_CONFIG_DESC_SIZE                   118
+#else
+ #define AUDIO_OUT_CONFIG_DESC_SIZE                   109
+#endif
+#define AUDIO_CONFIG_DESC_SIZE                        (AUDIO_OUT_CONFIG_DESC_SIZE + AUDIO_IN_DESC_SIZE)
 #define AUDIO_INTERFACE_DESC_SIZE                     9
 #define USB_AUDIO_DESC_SIZ                            0x09
 #define AUDIO_STANDARD_ENDPOINT_DESC_SIZE             0x09
@@ -94,7 +218,10 @@
 #define AUDIO_FORMAT_TYPE_III                         0x03
 
 #define USB_ENDPOINT_TYPE_ISOCHRONOUS                 0x01
+#define USB_ENDPOINT_SYNC_ASYNCHRONOUS                0x04
+#define USB_ENDPOINT_USAGE_FEEDBACK                   0x10
 #define AUDIO_ENDPOINT_GENERAL                        0x01
+#define AUDIO_SAMPLING_FREQ_CONTROL                   0x01
 
 #define AUDIO_REQ_GET_CUR                             0x81
 #define AUDIO_REQ_SET_CUR                             0x01
@@ -148,6 +275,12 @@ extern USBD_Class_cb_TypeDef  AUDIO_cb;
 /** @defgroup USB_CORE_Exported_Functions
   * @{
   */
+#if defined (AUDIO_FEEDBACK_ENABLED) && !defined (AUDIO_OUT_CIRCULAR_ENABLED)
+void USBD_AUDIO_TransferComplete (void);
+#endif
+#ifdef AUDIO_IN_ENABLED
+void USBD_AUDIO_InComplete       (uint8_t *pbuf);
+#endif
 /**
   * @}
   */ 
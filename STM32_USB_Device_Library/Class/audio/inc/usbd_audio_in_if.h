@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio_in_if.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   header file for the usbd_audio_in_if.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+
+#ifndef __USB_AUDIO_IN_IF_H_
+#define __USB_AUDIO_IN_IF_H_
+
+#ifdef STM32F2XX
+ #include "stm32f2xx.h"
+#elif defined(STM32F4XX)
+ #include "stm32f4xx.h"
+#elif defined(STM32F10X_CL)
+ #error "The microphone path needs the DMA double buffer mode of the STM32F2xx/F4xx"
+#endif /* STM32F2XX */
+
+#include "usbd_audio_out_if.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+  
+/** @defgroup usbd_audio
+  * @brief This file is the Header file for USBD_audio.c
+  * @{
+  */ 
+
+
+/** @defgroup usbd_audio_in_if_Exported_Defines
+  * @{
+  */ 
+/* I2S (or ADC) receive DMA stream of the microphone. The default is
+   I2S2 RX: DMA1 Stream3 Channel0. The GPIO, the I2S clock (PLLI2S) and
+   I2S_Init are left to the board code */
+#ifndef AUDIO_IN_I2S
+ #define AUDIO_IN_I2S                   SPI2
+#endif
+#ifndef AUDIO_IN_DMA_CLOCK
+ #define AUDIO_IN_DMA_CLOCK             RCC_AHB1Periph_DMA1
+#endif
+#ifndef AUDIO_IN_DMA_STREAM
+ #define AUDIO_IN_DMA_STREAM            DMA1_Stream3
+ #define AUDIO_IN_DMA_CHANNEL           DMA_Channel_0
+ #define AUDIO_IN_DMA_IT_TC             DMA_IT_TCIF3
+ #define AUDIO_IN_DMA_IRQ               DMA1_Stream3_IRQn
+ #define AUDIO_IN_DMA_IRQHandler        DMA1_Stream3_IRQHandler
+#endif
+#ifndef AUDIO_IN_DMA_PERIPH_ADDR
+ #define AUDIO_IN_DMA_PERIPH_ADDR       ((uint32_t)&AUDIO_IN_I2S->DR)
+#endif
+#ifndef AUDIO_IN_IRQ_PREPRIO
+ #define AUDIO_IN_IRQ_PREPRIO           1
+#endif
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_in_if_Exported_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */ 
+
+
+
+/** @defgroup usbd_audio_in_if_Exported_Macros
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_in_if_Exported_Variables
+  * @{
+  */ 
+
+extern AUDIO_FOPS_TypeDef  AUDIO_IN_fops;
+
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_in_if_Exported_Functions
+  * @{
+  */
+void AUDIO_IN_DMA_IRQHandler (void);
+/**
+  * @}
+  */ 
+
+#endif  /* __USB_AUDIO_IN_IF_H_ */
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+  
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
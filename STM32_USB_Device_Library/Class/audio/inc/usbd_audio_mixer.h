@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio_mixer.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   header file for the usbd_audio_mixer.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+
+#ifndef __USB_AUDIO_MIXER_H_
+#define __USB_AUDIO_MIXER_H_
+
+#include "usbd_conf.h"
+#include "arm_math.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+  
+/** @defgroup usbd_audio
+  * @brief This file is the Header file for USBD_audio.c
+  * @{
+  */ 
+
+
+/** @defgroup usbd_audio_mixer_Exported_Defines
+  * @{
+  */ 
+/* Mixer inputs: source 0 is the host stream, mixed in place in the ring,
+   sources 1 to AUDIO_MIXER_SOURCES - 1 are local streams pulled from the
+   application */
+#ifndef AUDIO_MIXER_SOURCES
+ #define AUDIO_MIXER_SOURCES            4
+#endif
+#define AUDIO_MIXER_USB                 0
+
+/* Samples (half-words, both channels) processed with one gain: the ramp
+   advances once per chunk. Even, and the size of the buffer passed to the
+   local sources */
+#ifndef AUDIO_MIXER_CHUNK
+ #define AUDIO_MIXER_CHUNK              32
+#endif
+
+/* Gain change per chunk while ramping: 0x7FFF / AUDIO_MIXER_RAMP_STEP
+   chunks from silence to full scale, 5 ms at 48 kHz with the defaults */
+#ifndef AUDIO_MIXER_RAMP_STEP
+ #define AUDIO_MIXER_RAMP_STEP          0x0400
+#endif
+
+/* Full scale gain (0.99997) passes the host stream unchanged */
+#define AUDIO_MIXER_UNITY               ((q15_t)0x7FFF)
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_mixer_Exported_TypesDefinitions
+  * @{
+  */
+/* Local source: writes up to size interleaved stereo q15 samples to pbuf
+   and returns the number written, fewer at the end of the stream. Called
+   from the USB interrupt for each chunk of a received packet */
+typedef uint32_t (*AUDIO_MixerFill_TypeDef)(q15_t *pbuf, uint32_t size);
+/**
+  * @}
+  */ 
+
+
+
+/** @defgroup usbd_audio_mixer_Exported_Macros
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_mixer_Exported_Variables
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_mixer_Exported_Functions
+  * @{
+  */
+uint8_t AUDIO_Mixer_Attach  (uint8_t src, AUDIO_MixerFill_TypeDef fill, q15_t gain);
+uint8_t AUDIO_Mixer_Detach  (uint8_t src);
+uint8_t AUDIO_Mixer_SetGain (uint8_t src, q15_t gain);
+uint8_t AUDIO_Mixer_Mute    (uint8_t src, uint8_t cmd);
+uint8_t AUDIO_Mixer_IsActive(uint8_t src);
+void    AUDIO_Mixer_Process (q15_t *pbuf, uint32_t size);
+/**
+  * @}
+  */ 
+
+#endif  /* __USB_AUDIO_MIXER_H_ */
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+  
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -75,6 +75,28 @@ typedef enum
 #define AUDIO_STATE_STOPPED             0x04
 #define AUDIO_STATE_ERROR               0x05
 
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+#ifdef STM32F10X_CL
+ #error "The circular playback needs the DMA streams of the STM32F2xx/F4xx"
+#endif
+/* I2S transmit DMA stream of the codec, run in circular mode over the ring.
+   The default is the I2S3 TX of the evaluation boards: DMA1 Stream7
+   Channel0 */
+#ifndef AUDIO_OUT_I2S
+ #define AUDIO_OUT_I2S                  SPI3
+#endif
+#ifndef AUDIO_OUT_DMA_CLOCK
+ #define AUDIO_OUT_DMA_CLOCK            RCC_AHB1Periph_DMA1
+#endif
+#ifndef AUDIO_OUT_DMA_STREAM
+ #define AUDIO_OUT_DMA_STREAM           DMA1_Stream7
+ #define AUDIO_OUT_DMA_CHANNEL          DMA_Channel_0
+#endif
+#ifndef AUDIO_OUT_DMA_PERIPH_ADDR
+ #define AUDIO_OUT_DMA_PERIPH_ADDR      ((uint32_t)&AUDIO_OUT_I2S->DR)
+#endif
+#endif /* AUDIO_OUT_CIRCULAR_ENABLED */
+
 /**
   * @}
   */ 
@@ -109,6 +131,9 @@ extern AUDIO_FOPS_TypeDef  AUDIO_OUT_fops;
 /** @defgroup USB_CORE_Exported_Functions
   * @{
   */
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+uint32_t AUDIO_OUT_GetPosition (void);
+#endif
 /**
   * @}
   */ 
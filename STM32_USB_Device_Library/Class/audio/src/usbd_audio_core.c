@@ -32,6 +32,14 @@
   *             - Audio Feature Unit (limited to Mute control)
   *             - Audio Synchronization type: Asynchronous
   *             - Single fixed audio sampling rate (configurable in usbd_conf.h file)
+  *             - With AUDIO_FEEDBACK_ENABLED: explicit feedback endpoint reporting
+  *               the rate at which the codec consumes the samples (10.14 format)
+  *             - With AUDIO_OUT_CIRCULAR_ENABLED: the I2S DMA plays the ring in
+  *               circular mode, its position is the consumer of the ring
+  *             - With AUDIO_IN_ENABLED: microphone streaming interface, sent on
+  *               an isochronous IN endpoint from an I2S/ADC DMA double buffer
+  *             - With AUDIO_MIXER_ENABLED: the 16-bit packets are mixed in place
+  *               with local sources, with ramped gains (usbd_audio_mixer.c)
   *          
   *           @note
   *            The Audio Class 1.0 is based on USB Specification 1.0 and thus supports only
@@ -52,7 +60,7 @@
   *             - Mixer/Selector/Processing/Extension Units (Feature unit is limited to Mute control)
   *             - Any other application-specific modules
   *             - Multiple and Variable audio sampling rates
-  *             - Out Streaming Endpoint/Interface (microphone)
+  *             - Out Streaming Endpoint/Interface (microphone), unless AUDIO_IN_ENABLED
   *      
   *  @endverbatim
   *                                  
@@ -80,6 +88,12 @@
 
 #include "usbd_audio_core.h"
 #include "usbd_audio_out_if.h"
+#ifdef AUDIO_IN_ENABLED
+#include "usbd_audio_in_if.h"
+#endif
+#ifdef AUDIO_MIXER_ENABLED
+#include "usbd_audio_mixer.h"
+#endif
 
 /** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
   * @{
@@ -102,6 +116,20 @@
 /** @defgroup usbd_audio_Private_Defines
   * @{
   */ 
+#if defined (AUDIO_FEEDBACK_ENABLED) || defined (AUDIO_MULTI_FORMAT_ENABLED)
+/* Received packets are copied to a byte ring in IsocOutBuff */
+ #define AUDIO_RING_STREAM
+#endif
+
+#if defined (AUDIO_OUT_CIRCULAR_ENABLED) && !defined (AUDIO_FEEDBACK_ENABLED)
+ #error "AUDIO_OUT_CIRCULAR_ENABLED needs AUDIO_FEEDBACK_ENABLED: the host follows the codec clock"
+#endif
+
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+ #define AUDIO_SILENCE_SIZE             ((AUDIO_FREQ_MAX / 1000) * 8)
+#else
+ #define AUDIO_SILENCE_SIZE             AUDIO_OUT_PACKET
+#endif
 /**
   * @}
   */ 
@@ -130,12 +158,34 @@ static uint8_t  usbd_audio_DataIn     (void *pdev, uint8_t epnum);
 static uint8_t  usbd_audio_DataOut    (void *pdev, uint8_t epnum);
 static uint8_t  usbd_audio_SOF        (void *pdev);
 static uint8_t  usbd_audio_OUT_Incplt (void  *pdev);
+#if defined (AUDIO_FEEDBACK_ENABLED) || defined (AUDIO_IN_ENABLED)
+static uint8_t  usbd_audio_IN_Incplt  (void  *pdev);
+#endif
+#ifdef AUDIO_FEEDBACK_ENABLED
+static void AUDIO_Feedback_Update (void);
+#endif
+#ifdef AUDIO_IN_ENABLED
+static void AUDIO_In_Send         (void *pdev);
+#endif
+#ifdef AUDIO_RING_STREAM
+static void AUDIO_Stream_Format   (uint32_t freq, uint32_t subframe);
+static void AUDIO_Stream_Start    (void);
+static void AUDIO_Stream_Stop     (void);
+static void AUDIO_Ring_Write      (uint8_t *pbuf, uint32_t len);
+static void AUDIO_Ring_Release    (uint32_t len);
+#endif
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+static void AUDIO_Ring_Sync       (void);
+#endif
 
 /*********************************************
    AUDIO Requests management functions
  *********************************************/
 static void AUDIO_Req_GetCurrent(void *pdev, USB_SETUP_REQ *req);
 static void AUDIO_Req_SetCurrent(void *pdev, USB_SETUP_REQ *req);
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+static void AUDIO_Req_SetFrequency(uint32_t freq);
+#endif
 static uint8_t  *USBD_audio_GetCfgDesc (uint8_t speed, uint16_t *length);
 /**
   * @}
@@ -144,18 +194,110 @@ static uint8_t  *USBD_audio_GetCfgDesc (uint8_t speed, uint16_t *length);
 /** @defgroup usbd_audio_Private_Variables
   * @{
   */ 
+#ifdef AUDIO_RING_STREAM
+/* Pool of the packet buffer and the ring */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN uint8_t IsocOutBuff [AUDIO_POOL_SIZE] __ALIGN_END ;
+#else
 /* Main Buffer for Audio Data Out transfers and its relative pointers */
+#ifdef AUDIO_MIXER_ENABLED
+/* Packets are mixed as half-words */
+__ALIGN_BEGIN uint8_t IsocOutBuff [TOTAL_OUT_BUF_SIZE * 2] __ALIGN_END ;
+#else
 uint8_t  IsocOutBuff [TOTAL_OUT_BUF_SIZE * 2];
+#endif
 uint8_t* IsocOutWrPtr = IsocOutBuff;
 uint8_t* IsocOutRdPtr = IsocOutBuff;
+#endif
 
 /* Main Buffer for Audio Control Rrequests transfers and its relative variables */
 uint8_t  AudioCtl[64];
 uint8_t  AudioCtlCmd = 0;
 uint32_t AudioCtlLen = 0;
 uint8_t  AudioCtlUnit = 0;
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+uint8_t  AudioCtlEp = 0;
+#endif
+
+static __IO uint32_t PlayFlag = 0;
+
+#ifdef AUDIO_RING_STREAM
+/* Current format */
+static uint32_t AudioFreq = USBD_AUDIO_FREQ;
+static uint32_t AudioSubframe = 2;        /* Bytes per sample in the packets */
+static uint32_t AudioFrameBytes = 4;      /* Bytes per stereo sample in the ring */
+static uint32_t AudioPacket;              /* Ring bytes of a nominal frame */
+static uint32_t AudioPacketMax;           /* Largest packet from the host */
+static uint32_t AudioFrameAcc = 0;        /* Fraction of sample carried over */
 
-static uint32_t PlayFlag = 0;
+/* Packet being received, copied to the ring once complete */
+static uint8_t  *AudioPkt;
+
+/* The ring is followed by a copy of its first AudioTail bytes, so that any
+   read of up to AudioTail bytes is contiguous for the codec DMA */
+static uint8_t  *AudioRing;
+static uint32_t AudioRingSize;
+static uint32_t AudioTail;
+
+/* Ring positions, and byte counts written by the host and consumed by the
+   codec (the level is their difference) */
+static uint32_t AudioWrIdx = 0;
+static uint32_t AudioRdIdx = 0;
+static __IO uint32_t AudioWrCnt = 0;
+static __IO uint32_t AudioRdCnt = 0;
+static uint32_t AudioTarget;
+#endif /* AUDIO_RING_STREAM */
+
+#if defined (AUDIO_FEEDBACK_ENABLED) && !defined (AUDIO_OUT_CIRCULAR_ENABLED)
+/* Played by the codec while the ring is refilled after an underrun */
+static uint8_t AudioSilence[AUDIO_SILENCE_SIZE];
+#endif
+
+#ifdef AUDIO_FEEDBACK_ENABLED
+
+/* Samples played, silence included: the codec clock */
+static __IO uint32_t AudioPlayed = 0;
+static __IO uint32_t AudioMuted = 0;
+static uint32_t AudioStable = 0;
+
+/* Feedback value sent on AUDIO_FB_EP and its measurement */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t FbBuf[4] __ALIGN_END ;
+static __IO uint32_t FbBusy = 0;
+static uint32_t FbFrames = 0;
+static uint32_t FbLevelSum = 0;
+static uint32_t FbLastPlayed = 0;
+static uint32_t FbValid = 0;
+static uint32_t FbNominal;
+static int32_t  FbRate;
+#endif /* AUDIO_FEEDBACK_ENABLED */
+
+#ifdef AUDIO_IN_ENABLED
+/* Capture buffer: the two DMA memory targets back to back. Packets are
+   sent from it, at most up to its end */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t AudioInBuf[2 * AUDIO_IN_BUF_SIZE] __ALIGN_END ;
+
+/* Byte counts captured by the DMA and sent to the host */
+static __IO uint32_t AudioInDone = 0;
+static uint32_t AudioInRd = 0;
+static uint32_t AudioInLen = 0;           /* Packet in flight */
+static uint32_t AudioInAcc = 0;           /* Fraction of sample carried over */
+static __IO uint32_t AudioInBusy = 0;
+static __IO uint32_t usbd_audio_InAltSet = 0;
+#endif /* AUDIO_IN_ENABLED */
 
 static __IO uint32_t  usbd_audio_AltSet = 0;
 static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE];
@@ -171,7 +313,11 @@ USBD_Class_cb_TypeDef  AUDIO_cb =
   usbd_audio_DataIn,
   usbd_audio_DataOut,
   usbd_audio_SOF,
+#if defined (AUDIO_FEEDBACK_ENABLED) || defined (AUDIO_IN_ENABLED)
+  usbd_audio_IN_Incplt,
+#else
   NULL,
+#endif
   usbd_audio_OUT_Incplt,   
   USBD_audio_GetCfgDesc,
 #ifdef USB_OTG_HS_CORE  
@@ -187,7 +333,11 @@ static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE] =
   USB_CONFIGURATION_DESCRIPTOR_TYPE,    /* bDescriptorType */
   LOBYTE(AUDIO_CONFIG_DESC_SIZE),       /* wTotalLength  109 bytes*/
   HIBYTE(AUDIO_CONFIG_DESC_SIZE),      
+#ifdef AUDIO_IN_ENABLED
+  0x03,                                 /* bNumInterfaces */
+#else
   0x02,                                 /* bNumInterfaces */
+#endif
   0x01,                                 /* bConfigurationValue */
   0x00,                                 /* iConfiguration */
   0xC0,                                 /* bmAttributes  BUS Powred*/
@@ -207,16 +357,29 @@ static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE] =
   /* 09 byte*/
   
   /* USB Speaker Class-specific AC Interface Descriptor */
+#ifdef AUDIO_IN_ENABLED
+  0x0A,                                 /* bLength */
+#else
   AUDIO_INTERFACE_DESC_SIZE,            /* bLength */
+#endif
   AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
   AUDIO_CONTROL_HEADER,                 /* bDescriptorSubtype */
   0x00,          /* 1.00 */             /* bcdADC */
   0x01,
+#ifdef AUDIO_IN_ENABLED
+  0x3D,                                 /* wTotalLength = 61*/
+  0x00,
+  0x02,                                 /* bInCollection */
+  0x01,                                 /* baInterfaceNr(1) */
+  AUDIO_IN_STREAMING_ITF,               /* baInterfaceNr(2) */
+  /* 10 byte*/
+#else
   0x27,                                 /* wTotalLength = 39*/
   0x00,
   0x01,                                 /* bInCollection */
   0x01,                                 /* baInterfaceNr */
   /* 09 byte*/
+#endif
   
   /* USB Speaker Input Terminal Descriptor */
   AUDIO_INPUT_TERMINAL_DESC_SIZE,       /* bLength */
@@ -256,6 +419,35 @@ static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE] =
   0x02,                                 /* bSourceID */
   0x00,                                 /* iTerminal */
   /* 09 byte*/
+#ifdef AUDIO_IN_ENABLED
+  
+  /* USB Microphone Input Terminal Descriptor */
+  AUDIO_INPUT_TERMINAL_DESC_SIZE,       /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_CONTROL_INPUT_TERMINAL,         /* bDescriptorSubtype */
+  0x04,                                 /* bTerminalID */
+  0x01,                                 /* wTerminalType Microphone 0x0201 */
+  0x02,
+  0x00,                                 /* bAssocTerminal */
+  AUDIO_IN_CHANNELS,                    /* bNrChannels */
+  0x00,                                 /* wChannelConfig */
+  0x00,
+  0x00,                                 /* iChannelNames */
+  0x00,                                 /* iTerminal */
+  /* 12 byte*/
+  
+  /* USB Microphone Output Terminal Descriptor */
+  0x09,                                 /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_CONTROL_OUTPUT_TERMINAL,        /* bDescriptorSubtype */
+  0x05,                                 /* bTerminalID */
+  0x01,                                 /* wTerminalType AUDIO_TERMINAL_USB_STREAMING 0x0101 */
+  0x01,
+  0x00,                                 /* bAssocTerminal */
+  0x04,                                 /* bSourceID */
+  0x00,                                 /* iTerminal */
+  /* 09 byte*/
+#endif
   
   /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Zero Bandwith */
   /* Interface 1, Alternate Setting 0                                             */
@@ -270,13 +462,172 @@ static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE] =
   0x00,                                 /* iInterface */
   /* 09 byte*/
   
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Operational */
+  /* Interface 1, Alternate Setting 1                                           */
+  AUDIO_INTERFACE_DESC_SIZE,  /* bLength */
+  USB_INTERFACE_DESCRIPTOR_TYPE,        /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+#ifdef AUDIO_FEEDBACK_ENABLED
+  0x02,                                 /* bNumEndpoints */
+#else
+  0x01,                                 /* bNumEndpoints */
+#endif
+  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
+  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
+  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+  
+  /* USB Speaker Audio Streaming Interface Descriptor */
+  AUDIO_STREAMING_INTERFACE_DESC_SIZE,  /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_STREAMING_GENERAL,              /* bDescriptorSubtype */
+  0x01,                                 /* bTerminalLink */
+  0x01,                                 /* bDelay */
+  0x01,                                 /* wFormatTag AUDIO_FORMAT_PCM  0x0001*/
+  0x00,
+  /* 07 byte*/
+  
+  /* USB Speaker Audio Type I Format Interface Descriptor */
+  0x11,                                 /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_STREAMING_FORMAT_TYPE,          /* bDescriptorSubtype */
+  AUDIO_FORMAT_TYPE_I,                  /* bFormatType */ 
+  0x02,                                 /* bNrChannels */
+  0x02,                                 /* bSubFrameSize :  2 Bytes per frame (16bits) */
+  16,                                   /* bBitResolution (16-bits per sample) */ 
+  AUDIO_FREQ_NUM,                       /* bSamFreqType */ 
+  SAMPLE_FREQ(AUDIO_FREQ_1),            /* Audio sampling frequencies coded on 3 bytes */
+  SAMPLE_FREQ(AUDIO_FREQ_2),
+  SAMPLE_FREQ(AUDIO_FREQ_3),
+  /* 17 byte*/
+  
+  /* Endpoint 1 - Standard Descriptor */
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,         /* bDescriptorType */
+  AUDIO_OUT_EP,                         /* bEndpointAddress 1 out endpoint*/
+  AUDIO_OUT_EP_ATTRIBUTES,              /* bmAttributes */
+  LOBYTE(AUDIO_OUT_PACKET_MAX),          /* wMaxPacketSize in Bytes (highest frequency + 2 samples) */
+  HIBYTE(AUDIO_OUT_PACKET_MAX),
+  0x01,                                 /* bInterval */
+  0x00,                                 /* bRefresh */
+  AUDIO_OUT_EP_SYNCH,                   /* bSynchAddress */
+  /* 09 byte*/
+  
+  /* Endpoint - Audio Streaming Descriptor*/
+  AUDIO_STREAMING_ENDPOINT_DESC_SIZE,   /* bLength */
+  AUDIO_ENDPOINT_DESCRIPTOR_TYPE,       /* bDescriptorType */
+  AUDIO_ENDPOINT_GENERAL,               /* bDescriptor */
+  AUDIO_SAMPLING_FREQ_CONTROL,          /* bmAttributes */
+  0x00,                                 /* bLockDelayUnits */
+  0x00,                                 /* wLockDelay */
+  0x00,
+  /* 07 byte*/
+#ifdef AUDIO_FEEDBACK_ENABLED
+
+  /* Endpoint 1 IN - Feedback Standard Descriptor */
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,         /* bDescriptorType */
+  AUDIO_FB_EP,                          /* bEndpointAddress */
+  USB_ENDPOINT_TYPE_ISOCHRONOUS | USB_ENDPOINT_USAGE_FEEDBACK, /* bmAttributes */
+  AUDIO_FB_PACKET,                      /* wMaxPacketSize: 10.14 value on 3 bytes */
+  0x00,
+  0x01,                                 /* bInterval */
+  AUDIO_FB_REFRESH,                     /* bRefresh */
+  0x00,                                 /* bSynchAddress */
+  /* 09 byte*/
+#endif
+  
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Operational */
+  /* Interface 1, Alternate Setting 2                                           */
+  AUDIO_INTERFACE_DESC_SIZE,  /* bLength */
+  USB_INTERFACE_DESCRIPTOR_TYPE,        /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x02,                                 /* bAlternateSetting */
+#ifdef AUDIO_FEEDBACK_ENABLED
+  0x02,                                 /* bNumEndpoints */
+#else
+  0x01,                                 /* bNumEndpoints */
+#endif
+  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
+  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
+  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+  
+  /* USB Speaker Audio Streaming Interface Descriptor */
+  AUDIO_STREAMING_INTERFACE_DESC_SIZE,  /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_STREAMING_GENERAL,              /* bDescriptorSubtype */
+  0x01,                                 /* bTerminalLink */
+  0x01,                                 /* bDelay */
+  0x01,                                 /* wFormatTag AUDIO_FORMAT_PCM  0x0001*/
+  0x00,
+  /* 07 byte*/
+  
+  /* USB Speaker Audio Type I Format Interface Descriptor */
+  0x11,                                 /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_STREAMING_FORMAT_TYPE,          /* bDescriptorSubtype */
+  AUDIO_FORMAT_TYPE_I,                  /* bFormatType */ 
+  0x02,                                 /* bNrChannels */
+  0x03,                                 /* bSubFrameSize :  3 Bytes per frame (24bits) */
+  24,                                   /* bBitResolution (24-bits per sample) */ 
+  AUDIO_FREQ_NUM,                       /* bSamFreqType */ 
+  SAMPLE_FREQ(AUDIO_FREQ_1),            /* Audio sampling frequencies coded on 3 bytes */
+  SAMPLE_FREQ(AUDIO_FREQ_2),
+  SAMPLE_FREQ(AUDIO_FREQ_3),
+  /* 17 byte*/
+  
+  /* Endpoint 1 - Standard Descriptor */
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,         /* bDescriptorType */
+  AUDIO_OUT_EP,                         /* bEndpointAddress 1 out endpoint*/
+  AUDIO_OUT_EP_ATTRIBUTES,              /* bmAttributes */
+  LOBYTE(AUDIO_OUT_PACKET_MAX_24),       /* wMaxPacketSize in Bytes (highest frequency + 2 samples) */
+  HIBYTE(AUDIO_OUT_PACKET_MAX_24),
+  0x01,                                 /* bInterval */
+  0x00,                                 /* bRefresh */
+  AUDIO_OUT_EP_SYNCH,                   /* bSynchAddress */
+  /* 09 byte*/
+  
+  /* Endpoint - Audio Streaming Descriptor*/
+  AUDIO_STREAMING_ENDPOINT_DESC_SIZE,   /* bLength */
+  AUDIO_ENDPOINT_DESCRIPTOR_TYPE,       /* bDescriptorType */
+  AUDIO_ENDPOINT_GENERAL,               /* bDescriptor */
+  AUDIO_SAMPLING_FREQ_CONTROL,          /* bmAttributes */
+  0x00,                                 /* bLockDelayUnits */
+  0x00,                                 /* wLockDelay */
+  0x00,
+  /* 07 byte*/
+#ifdef AUDIO_FEEDBACK_ENABLED
+
+  /* Endpoint 1 IN - Feedback Standard Descriptor */
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,         /* bDescriptorType */
+  AUDIO_FB_EP,                          /* bEndpointAddress */
+  USB_ENDPOINT_TYPE_ISOCHRONOUS | USB_ENDPOINT_USAGE_FEEDBACK, /* bmAttributes */
+  AUDIO_FB_PACKET,                      /* wMaxPacketSize: 10.14 value on 3 bytes */
+  0x00,
+  0x01,                                 /* bInterval */
+  AUDIO_FB_REFRESH,                     /* bRefresh */
+  0x00,                                 /* bSynchAddress */
+  /* 09 byte*/
+#endif
+#else
   /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Operational */
   /* Interface 1, Alternate Setting 1                                           */
   AUDIO_INTERFACE_DESC_SIZE,  /* bLength */
   USB_INTERFACE_DESCRIPTOR_TYPE,        /* bDescriptorType */
   0x01,                                 /* bInterfaceNumber */
   0x01,                                 /* bAlternateSetting */
+#ifdef AUDIO_FEEDBACK_ENABLED
+  0x02,                                 /* bNumEndpoints */
+#else
   0x01,                                 /* bNumEndpoints */
+#endif
   USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
   AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
   AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
@@ -309,11 +660,20 @@ static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE] =
   AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
   USB_ENDPOINT_DESCRIPTOR_TYPE,         /* bDescriptorType */
   AUDIO_OUT_EP,                         /* bEndpointAddress 1 out endpoint*/
+#ifdef AUDIO_FEEDBACK_ENABLED
+  AUDIO_OUT_EP_ATTRIBUTES,              /* bmAttributes */
+  LOBYTE(AUDIO_OUT_PACKET_MAX),         /* wMaxPacketSize in Bytes (nominal packet + 2 samples) */
+  HIBYTE(AUDIO_OUT_PACKET_MAX),
+  0x01,                                 /* bInterval */
+  0x00,                                 /* bRefresh */
+  AUDIO_OUT_EP_SYNCH,                   /* bSynchAddress */
+#else
   USB_ENDPOINT_TYPE_ISOCHRONOUS,        /* bmAttributes */
   AUDIO_PACKET_SZE(USBD_AUDIO_FREQ),    /* wMaxPacketSize in Bytes (Freq(Samples)*2(Stereo)*2(HalfWord)) */
   0x01,                                 /* bInterval */
   0x00,                                 /* bRefresh */
   0x00,                                 /* bSynchAddress */
+#endif
   /* 09 byte*/
   
   /* Endpoint - Audio Streaming Descriptor*/
@@ -325,6 +685,93 @@ static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE] =
   0x00,                                 /* wLockDelay */
   0x00,
   /* 07 byte*/
+#ifdef AUDIO_FEEDBACK_ENABLED
+
+  /* Endpoint 1 IN - Feedback Standard Descriptor */
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,         /* bDescriptorType */
+  AUDIO_FB_EP,                          /* bEndpointAddress */
+  USB_ENDPOINT_TYPE_ISOCHRONOUS | USB_ENDPOINT_USAGE_FEEDBACK, /* bmAttributes */
+  AUDIO_FB_PACKET,                      /* wMaxPacketSize: 10.14 value on 3 bytes */
+  0x00,
+  0x01,                                 /* bInterval */
+  AUDIO_FB_REFRESH,                     /* bRefresh */
+  0x00,                                 /* bSynchAddress */
+  /* 09 byte*/
+#endif
+#endif /* AUDIO_MULTI_FORMAT_ENABLED */
+#ifdef AUDIO_IN_ENABLED
+  
+  /* USB Microphone Standard AS Interface Descriptor - Audio Streaming Zero Bandwith */
+  /* Interface 2, Alternate Setting 0                                             */
+  AUDIO_INTERFACE_DESC_SIZE,            /* bLength */
+  USB_INTERFACE_DESCRIPTOR_TYPE,        /* bDescriptorType */
+  AUDIO_IN_STREAMING_ITF,               /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
+  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
+  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+  
+  /* USB Microphone Standard AS Interface Descriptor - Audio Streaming Operational */
+  /* Interface 2, Alternate Setting 1                                              */
+  AUDIO_INTERFACE_DESC_SIZE,            /* bLength */
+  USB_INTERFACE_DESCRIPTOR_TYPE,        /* bDescriptorType */
+  AUDIO_IN_STREAMING_ITF,               /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+  0x01,                                 /* bNumEndpoints */
+  USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
+  AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
+  AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+  
+  /* USB Microphone Audio Streaming Interface Descriptor */
+  AUDIO_STREAMING_INTERFACE_DESC_SIZE,  /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_STREAMING_GENERAL,              /* bDescriptorSubtype */
+  0x05,                                 /* bTerminalLink */
+  0x01,                                 /* bDelay */
+  0x01,                                 /* wFormatTag AUDIO_FORMAT_PCM  0x0001*/
+  0x00,
+  /* 07 byte*/
+  
+  /* USB Microphone Audio Type I Format Interface Descriptor */
+  0x0B,                                 /* bLength */
+  AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
+  AUDIO_STREAMING_FORMAT_TYPE,          /* bDescriptorSubtype */
+  AUDIO_FORMAT_TYPE_I,                  /* bFormatType */ 
+  AUDIO_IN_CHANNELS,                    /* bNrChannels */
+  0x02,                                 /* bSubFrameSize :  2 Bytes per sample (16bits) */
+  16,                                   /* bBitResolution (16-bits per sample) */ 
+  0x01,                                 /* bSamFreqType only one frequency supported */ 
+  SAMPLE_FREQ(AUDIO_IN_FREQ),           /* Audio sampling frequency coded on 3 bytes */
+  /* 11 byte*/
+  
+  /* Endpoint 2 IN - Standard Descriptor */
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,         /* bDescriptorType */
+  AUDIO_IN_EP,                          /* bEndpointAddress 2 in endpoint*/
+  USB_ENDPOINT_TYPE_ISOCHRONOUS | USB_ENDPOINT_SYNC_ASYNCHRONOUS, /* bmAttributes */
+  LOBYTE(AUDIO_IN_PACKET_MAX),          /* wMaxPacketSize in Bytes (nominal packet + 1 sample) */
+  HIBYTE(AUDIO_IN_PACKET_MAX),
+  0x01,                                 /* bInterval */
+  0x00,                                 /* bRefresh */
+  0x00,                                 /* bSynchAddress */
+  /* 09 byte*/
+  
+  /* Endpoint - Audio Streaming Descriptor*/
+  AUDIO_STREAMING_ENDPOINT_DESC_SIZE,   /* bLength */
+  AUDIO_ENDPOINT_DESCRIPTOR_TYPE,       /* bDescriptorType */
+  AUDIO_ENDPOINT_GENERAL,               /* bDescriptor */
+  0x00,                                 /* bmAttributes */
+  0x00,                                 /* bLockDelayUnits */
+  0x00,                                 /* wLockDelay */
+  0x00,
+  /* 07 byte*/
+#endif /* AUDIO_IN_ENABLED */
 } ;
 
 /**
@@ -345,23 +792,74 @@ static uint8_t usbd_audio_CfgDesc[AUDIO_CONFIG_DESC_SIZE] =
 static uint8_t  usbd_audio_Init (void  *pdev, 
                                  uint8_t cfgidx)
 {  
+#ifdef AUDIO_RING_STREAM
+  /* Open EP OUT, sized for the largest packet of all the settings */
+  DCD_EP_Open(pdev,
+              AUDIO_OUT_EP,
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+              AUDIO_OUT_PACKET_MAX_24,
+#else
+              AUDIO_OUT_PACKET_MAX,
+#endif
+              USB_OTG_EP_ISOC);
+
+#ifdef AUDIO_FEEDBACK_ENABLED
+  /* Open the feedback EP IN */
+  DCD_EP_Open(pdev,
+              AUDIO_FB_EP,
+              AUDIO_FB_PACKET,
+              USB_OTG_EP_ISOC);
+#endif
+
+  AUDIO_Stream_Stop();
+  AUDIO_Stream_Format(AudioFreq, AudioSubframe);
+#else
   /* Open EP OUT */
   DCD_EP_Open(pdev,
               AUDIO_OUT_EP,
               AUDIO_OUT_PACKET,
               USB_OTG_EP_ISOC);
+#endif
 
   /* Initialize the Audio output Hardware layer */
+#ifdef AUDIO_RING_STREAM
+  if (AUDIO_OUT_fops.Init(AudioFreq, DEFAULT_VOLUME, AudioSubframe * 8) != USBD_OK)
+#else
   if (AUDIO_OUT_fops.Init(USBD_AUDIO_FREQ, DEFAULT_VOLUME, 0) != USBD_OK)
+#endif
   {
     return USBD_FAIL;
   }
     
   /* Prepare Out endpoint to receive audio data */
+#ifdef AUDIO_RING_STREAM
+  DCD_EP_PrepareRx(pdev,
+                   AUDIO_OUT_EP,
+                   AudioPkt,
+                   AudioPacketMax);
+#else
   DCD_EP_PrepareRx(pdev,
                    AUDIO_OUT_EP,
                    (uint8_t*)IsocOutBuff,                        
                    AUDIO_OUT_PACKET);  
+#endif
+
+#ifdef AUDIO_IN_ENABLED
+  /* Open EP IN of the microphone */
+  DCD_EP_Open(pdev,
+              AUDIO_IN_EP,
+              AUDIO_IN_PACKET_MAX,
+              USB_OTG_EP_ISOC);
+
+  /* Initialize the Audio input Hardware layer: capture starts with the
+     streaming interface */
+  usbd_audio_InAltSet = 0;
+  AudioInBusy = 0;
+  if (AUDIO_IN_fops.Init(AUDIO_IN_FREQ, 0, 16) != USBD_OK)
+  {
+    return USBD_FAIL;
+  }
+#endif
   
   return USBD_OK;
 }
@@ -377,6 +875,22 @@ static uint8_t  usbd_audio_DeInit (void  *pdev,
                                    uint8_t cfgidx)
 { 
   DCD_EP_Close (pdev , AUDIO_OUT_EP);
+#ifdef AUDIO_FEEDBACK_ENABLED
+  DCD_EP_Close (pdev , AUDIO_FB_EP);
+#endif
+#ifdef AUDIO_RING_STREAM
+  PlayFlag = 0;
+#endif
+#ifdef AUDIO_IN_ENABLED
+  DCD_EP_Close (pdev , AUDIO_IN_EP);
+  usbd_audio_InAltSet = 0;
+
+  /* DeInitialize the Audio input Hardware layer */
+  if (AUDIO_IN_fops.DeInit(0) != USBD_OK)
+  {
+    return USBD_FAIL;
+  }
+#endif
   
   /* DeInitialize the Audio output Hardware layer */
   if (AUDIO_OUT_fops.DeInit(0) != USBD_OK)
@@ -441,15 +955,76 @@ static uint8_t  usbd_audio_Setup (void  *pdev,
       break;
       
     case USB_REQ_GET_INTERFACE :
+#ifdef AUDIO_IN_ENABLED
+      if (LOBYTE(req->wIndex) == AUDIO_IN_STREAMING_ITF)
+      {
+        USBD_CtlSendData (pdev,
+                          (uint8_t *)&usbd_audio_InAltSet,
+                          1);
+        break;
+      }
+#endif
       USBD_CtlSendData (pdev,
                         (uint8_t *)&usbd_audio_AltSet,
                         1);
       break;
       
     case USB_REQ_SET_INTERFACE :
+#ifdef AUDIO_IN_ENABLED
+      /* Microphone streaming interface: start or stop the capture */
+      if (LOBYTE(req->wIndex) == AUDIO_IN_STREAMING_ITF)
+      {
+        if ((uint8_t)(req->wValue) > 1)
+        {
+          USBD_CtlError (pdev, req);
+        }
+        else if ((uint8_t)(req->wValue) != usbd_audio_InAltSet)
+        {
+          usbd_audio_InAltSet = (uint8_t)(req->wValue);
+          if (usbd_audio_InAltSet != 0)
+          {
+            AudioInDone = 0;
+            AudioInRd = 0;
+            AudioInAcc = 0;
+            AUDIO_IN_fops.AudioCmd(AudioInBuf,
+                                   AUDIO_IN_BUF_SIZE,
+                                   AUDIO_CMD_PLAY);
+          }
+          else
+          {
+            AUDIO_IN_fops.AudioCmd(AudioInBuf,
+                                   AUDIO_IN_BUF_SIZE,
+                                   AUDIO_CMD_STOP);
+            DCD_EP_Flush(pdev, AUDIO_IN_EP);
+            AudioInBusy = 0;
+          }
+        }
+        break;
+      }
+#endif
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+      if ((uint8_t)(req->wValue) <= AUDIO_ALT_24BIT)
+#else
       if ((uint8_t)(req->wValue) < AUDIO_TOTAL_IF_NUM)
+#endif
       {
         usbd_audio_AltSet = (uint8_t)(req->wValue);
+#ifdef AUDIO_RING_STREAM
+        /* Zero bandwidth setting of the streaming interface: stop playing,
+           else carve the buffers for the format of the setting */
+        if (LOBYTE(req->wIndex) == 0x01)
+        {
+          AUDIO_Stream_Stop();
+          if (usbd_audio_AltSet != 0)
+          {
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+            AUDIO_Stream_Format(AudioFreq,
+                                (usbd_audio_AltSet == AUDIO_ALT_24BIT) ? 3 : 2);
+#endif
+            AUDIO_Stream_Start();
+          }
+        }
+#endif
       }
       else
       {
@@ -483,6 +1058,16 @@ static uint8_t  usbd_audio_EP0_RxReady (void  *pdev)
       AudioCtlCmd = 0;
       AudioCtlLen = 0;
     }
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+    /* Sampling frequency of the streaming endpoint */
+    else if (AudioCtlEp == AUDIO_OUT_EP)
+    {
+      AUDIO_Req_SetFrequency(AudioCtl[0] | (AudioCtl[1] << 8) | (AudioCtl[2] << 16));
+
+      AudioCtlCmd = 0;
+      AudioCtlLen = 0;
+    }
+#endif
   } 
   
   return USBD_OK;
@@ -497,6 +1082,25 @@ static uint8_t  usbd_audio_EP0_RxReady (void  *pdev)
   */
 static uint8_t  usbd_audio_DataIn (void *pdev, uint8_t epnum)
 {
+#ifdef AUDIO_FEEDBACK_ENABLED
+  if (epnum == (AUDIO_FB_EP & 0x7F))
+  {
+    /* Feedback value read by the host: the next one is loaded on SOF */
+    FbBusy = 0;
+  }
+#endif
+#ifdef AUDIO_IN_ENABLED
+  if (epnum == (AUDIO_IN_EP & 0x7F))
+  {
+    /* Packet read by the host: queue the next one for the next frame */
+    AudioInRd += AudioInLen;
+    AudioInBusy = 0;
+    if (usbd_audio_InAltSet != 0)
+    {
+      AUDIO_In_Send(pdev);
+    }
+  }
+#endif
   return USBD_OK;
 }
 
@@ -509,8 +1113,69 @@ static uint8_t  usbd_audio_DataIn (void *pdev, uint8_t epnum)
   */
 static uint8_t  usbd_audio_DataOut (void *pdev, uint8_t epnum)
 {     
+#ifdef AUDIO_RING_STREAM
+  uint32_t len;
+
+  if (epnum == AUDIO_OUT_EP)
+  {
+    /* Whole stereo samples only */
+    len = ((USB_OTG_CORE_HANDLE*)pdev)->dev.out_ep[epnum].xfer_count;
+    len -= len % (AudioSubframe * 2);
+
+    if (usbd_audio_AltSet != 0)
+    {
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+      /* Free the space already played */
+      AUDIO_Ring_Sync();
+#endif
+#ifdef AUDIO_MIXER_ENABLED
+      if (AudioSubframe == 2)
+      {
+        AUDIO_Mixer_Process((q15_t*)AudioPkt, len / 2);
+      }
+#endif
+      AUDIO_Ring_Write(AudioPkt, len);
+    }
+
+    /* Toggle the frame index */  
+    ((USB_OTG_CORE_HANDLE*)pdev)->dev.out_ep[epnum].even_odd_frame = 
+      (((USB_OTG_CORE_HANDLE*)pdev)->dev.out_ep[epnum].even_odd_frame)? 0:1;
+
+    /* Prepare Out endpoint to receive next audio packet */
+    DCD_EP_PrepareRx(pdev,
+                     AUDIO_OUT_EP,
+                     AudioPkt,
+                     AudioPacketMax);
+
+    /* Start playing once the ring holds the target level */
+    if ((PlayFlag == 0) && (AudioWrCnt - AudioRdCnt >= AudioTarget))
+    {
+      PlayFlag = 1;
+#ifdef AUDIO_FEEDBACK_ENABLED
+      AudioMuted = 0;
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+      /* The DMA loops over the whole ring, from its start: the ring is
+         filled from index 0 after each stop */
+      AUDIO_OUT_fops.AudioCmd(AudioRing,
+                              AudioRingSize,
+                              AUDIO_CMD_PLAY);
+#else
+      /* From then on the codec transfer complete events pull the data */
+      AUDIO_OUT_fops.AudioCmd(AudioRing + AudioRdIdx,
+                              AudioPacket,
+                              AUDIO_CMD_PLAY);
+#endif
+#endif
+    }
+  }
+#else
   if (epnum == AUDIO_OUT_EP)
   {    
+#ifdef AUDIO_MIXER_ENABLED
+    /* Mix the packet just received, before the codec plays it */
+    AUDIO_Mixer_Process((q15_t*)IsocOutWrPtr, AUDIO_OUT_PACKET / 2);
+#endif
+
     /* Increment the Buffer pointer or roll it back when all buffers are full */
     if (IsocOutWrPtr >= (IsocOutBuff + (AUDIO_OUT_PACKET * OUT_PACKET_NUM)))
     {/* All buffers are full: roll back */
@@ -538,6 +1203,7 @@ static uint8_t  usbd_audio_DataOut (void *pdev, uint8_t epnum)
       PlayFlag = 1;
     }
   }
+#endif /* AUDIO_RING_STREAM */
   
   return USBD_OK;
 }
@@ -551,6 +1217,46 @@ static uint8_t  usbd_audio_DataOut (void *pdev, uint8_t epnum)
   */
 static uint8_t  usbd_audio_SOF (void *pdev)
 {     
+#ifdef AUDIO_FEEDBACK_ENABLED
+  if (usbd_audio_AltSet != 0)
+  {
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+    AUDIO_Ring_Sync();
+#endif
+    AUDIO_Feedback_Update();
+
+    /* Keep a feedback value loaded for the next frame */
+    if (FbBusy == 0)
+    {
+      FbBusy = 1;
+      DCD_EP_Tx (pdev, AUDIO_FB_EP, FbBuf, AUDIO_FB_PACKET);
+    }
+  }
+#elif defined (AUDIO_MULTI_FORMAT_ENABLED)
+  uint32_t len;
+
+  /* One frame of samples per SOF: at 44.1 kHz, nine frames of 44 samples
+     then one of 45 */
+  if (PlayFlag)
+  {
+    AudioFrameAcc += AudioFreq;
+    len = (AudioFrameAcc / 1000) * AudioFrameBytes;
+    AudioFrameAcc %= 1000;
+
+    if (AudioWrCnt - AudioRdCnt >= len)
+    {
+      AUDIO_OUT_fops.AudioCmd(AudioRing + AudioRdIdx,
+                              len,
+                              AUDIO_CMD_PLAY);
+      AUDIO_Ring_Release(len);
+    }
+    else
+    {
+      /* All the data has been consumed: pause until the ring is refilled */
+      AUDIO_Stream_Stop();
+    }
+  }
+#else
   /* Check if there are available data in stream buffer.
     In this function, a single variable (PlayFlag) is used to avoid software delays.
     The play operation must be executed as soon as possible after the SOF detection. */
@@ -587,6 +1293,15 @@ static uint8_t  usbd_audio_SOF (void *pdev)
       IsocOutWrPtr = IsocOutBuff;
     }
   }
+#endif /* AUDIO_FEEDBACK_ENABLED */
+
+#ifdef AUDIO_IN_ENABLED
+  /* Start the chain of microphone packets, DataIn keeps it going */
+  if ((usbd_audio_InAltSet != 0) && (AudioInBusy == 0))
+  {
+    AUDIO_In_Send(pdev);
+  }
+#endif
   
   return USBD_OK;
 }
@@ -602,6 +1317,487 @@ static uint8_t  usbd_audio_OUT_Incplt (void  *pdev)
   return USBD_OK;
 }
 
+#if defined (AUDIO_FEEDBACK_ENABLED) || defined (AUDIO_IN_ENABLED)
+/**
+  * @brief  usbd_audio_IN_Incplt
+  *         Handles the iso in incomplete event: the host did not read the
+  *         feedback value in this frame (it polls every 2^bRefresh frames),
+  *         or a microphone packet missed its frame.
+  * @param  pdev: instance
+  * @retval status
+  */
+static uint8_t  usbd_audio_IN_Incplt (void  *pdev)
+{
+#ifdef AUDIO_IN_ENABLED
+  USB_OTG_DEPCTL_TypeDef  depctl;
+  USB_OTG_DSTS_TypeDef    dsts;
+#endif
+
+#ifdef AUDIO_FEEDBACK_ENABLED
+  DCD_EP_Flush(pdev, AUDIO_FB_EP);
+  FbBusy = 1;
+  DCD_EP_Tx (pdev, AUDIO_FB_EP, FbBuf, AUDIO_FB_PACKET);
+#endif
+
+#ifdef AUDIO_IN_ENABLED
+  /* The microphone packet is stale if it is still enabled for the frame
+     that just ended; one armed by DataIn for the next frame is kept */
+  if ((usbd_audio_InAltSet != 0) && (AudioInBusy != 0))
+  {
+    depctl.d32 = USB_OTG_READ_REG32(&((USB_OTG_CORE_HANDLE*)pdev)->regs.INEP_REGS[AUDIO_IN_EP & 0x7F]->DIEPCTL);
+    dsts.d32 = USB_OTG_READ_REG32(&((USB_OTG_CORE_HANDLE*)pdev)->regs.DREGS->DSTS);
+
+    if ((depctl.b.epena) && (depctl.b.dpid == (dsts.b.soffn & 0x1)))
+    {
+      /* Send the same samples again in the next frame */
+      DCD_EP_Flush(pdev, AUDIO_IN_EP);
+      AudioInBusy = 0;
+      AUDIO_In_Send(pdev);
+    }
+  }
+#endif
+
+  return USBD_OK;
+}
+
+#endif /* AUDIO_FEEDBACK_ENABLED || AUDIO_IN_ENABLED */
+
+#ifdef AUDIO_IN_ENABLED
+/******************************************************************************
+     AUDIO microphone streaming
+******************************************************************************/
+/**
+  * @brief  USBD_AUDIO_InComplete
+  *         DMA transfer complete of the capture (from the DMA interrupt): a
+  *         memory target is full and can be sent while the DMA fills the
+  *         other one.
+  * @param  pbuf: memory target just completed
+  * @retval None
+  */
+void USBD_AUDIO_InComplete (uint8_t *pbuf)
+{
+  if (usbd_audio_InAltSet == 0)
+  {
+    return;
+  }
+
+  /* Not the expected target: an interrupt was missed, count both */
+  if (pbuf != AudioInBuf + (AudioInDone % (2 * AUDIO_IN_BUF_SIZE)))
+  {
+    AudioInDone += AUDIO_IN_BUF_SIZE;
+  }
+  AudioInDone += AUDIO_IN_BUF_SIZE;
+}
+
+/**
+  * @brief  AUDIO_In_Send
+  *         Queue the next microphone packet, straight from the completed
+  *         DMA memory target: one frame of samples, one more when a whole
+  *         target is waiting (the ADC clock runs faster than the USB one),
+  *         less when the capture is late.
+  * @param  pdev: instance
+  * @retval None
+  */
+static void AUDIO_In_Send (void *pdev)
+{
+  uint32_t avail = AudioInDone - AudioInRd;
+  uint32_t idx;
+  uint32_t len;
+
+  if (avail > 2 * AUDIO_IN_BUF_SIZE)
+  {
+    /* The host has not read for a while and the data has been overwritten:
+       resume from the last completed target */
+    AudioInRd = AudioInDone - AUDIO_IN_BUF_SIZE;
+    avail = AUDIO_IN_BUF_SIZE;
+  }
+
+  AudioInAcc += AUDIO_IN_FREQ;
+  len = (AudioInAcc / 1000) * AUDIO_IN_SAMPLE_SIZE;
+  AudioInAcc %= 1000;
+
+  if (avail > AUDIO_IN_BUF_SIZE)
+  {
+    len += AUDIO_IN_SAMPLE_SIZE;
+  }
+  if (len > avail)
+  {
+    len = avail;
+  }
+
+  /* The packet does not wrap to the first target */
+  idx = AudioInRd % (2 * AUDIO_IN_BUF_SIZE);
+  if (idx + len > 2 * AUDIO_IN_BUF_SIZE)
+  {
+    len = 2 * AUDIO_IN_BUF_SIZE - idx;
+  }
+
+  AudioInLen = len;
+  AudioInBusy = 1;
+  DCD_EP_Tx (pdev, AUDIO_IN_EP, AudioInBuf + idx, len);
+}
+#endif /* AUDIO_IN_ENABLED */
+
+#ifdef AUDIO_RING_STREAM
+/******************************************************************************
+     AUDIO ring streaming
+******************************************************************************/
+/**
+  * @brief  AUDIO_Stream_Format
+  *         Carve the packet buffer and the ring out of IsocOutBuff for a
+  *         format, and set the codec to it.
+  * @param  freq: sampling frequency (Hz)
+  * @param  subframe: bytes per sample in the packets (2 or 3)
+  * @retval None
+  */
+static void AUDIO_Stream_Format (uint32_t freq, uint32_t subframe)
+{
+  uint32_t samples = (freq + 999) / 1000 + 2;
+
+  if ((freq != AudioFreq) || (subframe != AudioSubframe))
+  {
+    AUDIO_OUT_fops.Init(freq, DEFAULT_VOLUME, subframe * 8);
+  }
+
+  AudioFreq = freq;
+  AudioSubframe = subframe;
+
+  /* 24-bit samples are played from 32-bit I2S frames */
+  AudioFrameBytes = (subframe == 3) ? 8 : 4;
+  AudioPacket = (freq / 1000) * AudioFrameBytes;
+  AudioPacketMax = samples * 2 * subframe;
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+  /* The DMA wraps around by itself: no copy of the start of the ring */
+  AudioTail = 0;
+#else
+  AudioTail = samples * AudioFrameBytes;
+#endif
+
+  AudioPkt = IsocOutBuff;
+  AudioRing = IsocOutBuff + ((AudioPacketMax + 3) & ~3);
+  AudioRingSize = AUDIO_POOL_SIZE - (AudioRing - IsocOutBuff) - AudioTail;
+  AudioRingSize -= AudioRingSize % AudioPacket;
+
+#ifdef AUDIO_FEEDBACK_ENABLED
+  FbNominal = (freq * 16384) / 1000;
+  AudioTarget = AUDIO_FB_MIN_PACKETS * AudioPacket;
+#else
+  AudioTarget = (OUT_PACKET_NUM / 2) * AudioPacket;
+#endif
+}
+
+/**
+  * @brief  AUDIO_Stream_Start
+  *         Streaming interface selected: playing starts once the ring is
+  *         filled to the target level.
+  * @param  None
+  * @retval None
+  */
+static void AUDIO_Stream_Start (void)
+{
+  AudioFrameAcc = 0;
+#ifdef AUDIO_FEEDBACK_ENABLED
+  FbFrames = 0;
+  FbLevelSum = 0;
+  FbValid = 0;
+  FbBusy = 0;
+#endif
+}
+
+/**
+  * @brief  AUDIO_Stream_Stop
+  *         Streaming interface deselected or underrun: pause the codec and
+  *         empty the ring.
+  * @param  None
+  * @retval None
+  */
+static void AUDIO_Stream_Stop (void)
+{
+  if (PlayFlag)
+  {
+    PlayFlag = 0;
+    AUDIO_OUT_fops.AudioCmd(IsocOutBuff,
+                            AudioPacket,
+                            AUDIO_CMD_PAUSE);
+  }
+
+  AudioWrIdx = 0;
+  AudioRdIdx = 0;
+  AudioWrCnt = 0;
+  AudioRdCnt = 0;
+#ifdef AUDIO_FEEDBACK_ENABLED
+  AudioMuted = 0;
+  AudioStable = 0;
+  FbRate = FbNominal;
+  FbValid = 0;
+  FbBuf[0] = (uint8_t)(FbNominal);
+  FbBuf[1] = (uint8_t)(FbNominal >> 8);
+  FbBuf[2] = (uint8_t)(FbNominal >> 16);
+#endif
+}
+
+/**
+  * @brief  AUDIO_Ring_Write
+  *         Copy a received packet to the ring, or drop it if the ring is
+  *         full. 24-bit samples are stored as I2S 32-bit frames, high
+  *         half-word first.
+  * @param  pbuf: packet
+  * @param  len: packet length, whole stereo samples
+  * @retval None
+  */
+static void AUDIO_Ring_Write (uint8_t *pbuf, uint32_t len)
+{
+  uint32_t size = (len / AudioSubframe) * (AudioFrameBytes / 2);
+  uint32_t idx = AudioWrIdx;
+  uint32_t i;
+  uint8_t  b[4];
+  uint32_t n;
+  uint32_t k;
+
+  if (AudioWrCnt - AudioRdCnt + size > AudioRingSize)
+  {
+    return;
+  }
+
+  for (i = 0; i < len; i += AudioSubframe)
+  {
+    if (AudioSubframe == 3)
+    {
+      b[0] = pbuf[i + 1];
+      b[1] = pbuf[i + 2];
+      b[2] = 0;
+      b[3] = pbuf[i];
+      n = 4;
+    }
+    else
+    {
+      b[0] = pbuf[i];
+      b[1] = pbuf[i + 1];
+      n = 2;
+    }
+
+    for (k = 0; k < n; k++)
+    {
+      AudioRing[idx] = b[k];
+      if (idx < AudioTail)
+      {
+        AudioRing[AudioRingSize + idx] = b[k];
+      }
+      if (++idx == AudioRingSize)
+      {
+        idx = 0;
+      }
+    }
+  }
+
+  AudioWrIdx = idx;
+  AudioWrCnt += size;
+}
+
+/**
+  * @brief  AUDIO_Ring_Release
+  *         Release data passed to the codec.
+  * @param  len: number of bytes
+  * @retval None
+  */
+static void AUDIO_Ring_Release (uint32_t len)
+{
+  AudioRdIdx += len;
+  if (AudioRdIdx >= AudioRingSize)
+  {
+    AudioRdIdx -= AudioRingSize;
+  }
+  AudioRdCnt += len;
+}
+
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+/**
+  * @brief  AUDIO_Ring_Sync
+  *         Release the data read by the I2S DMA since the last call, and
+  *         count it as played. If the DMA went past the data written by the
+  *         host, stop it and refill the ring to a higher target level.
+  * @param  None
+  * @retval None
+  */
+static void AUDIO_Ring_Sync (void)
+{
+  uint32_t pos;
+  uint32_t len;
+
+  if (PlayFlag == 0)
+  {
+    return;
+  }
+
+  /* Whole samples only */
+  pos = AUDIO_OUT_GetPosition();
+  pos -= pos % AudioFrameBytes;
+  len = (pos >= AudioRdIdx) ? (pos - AudioRdIdx) : (pos + AudioRingSize - AudioRdIdx);
+
+  AudioPlayed += len / AudioFrameBytes;
+  AUDIO_Ring_Release(len);
+
+  if ((int32_t)(AudioWrCnt - AudioRdCnt) <= 0)
+  {
+    /* Underrun: keep more data in the ring from now on */
+    AudioTarget += (AudioPacket / (2 * AudioFrameBytes)) * AudioFrameBytes;
+    if (AudioTarget > AudioRingSize / 2)
+    {
+      AudioTarget = AudioRingSize / 2;
+    }
+    AudioStable = 0;
+
+    PlayFlag = 0;
+    AUDIO_OUT_fops.AudioCmd(AudioRing,
+                            AudioRingSize,
+                            AUDIO_CMD_PAUSE);
+
+    AudioWrIdx = 0;
+    AudioRdIdx = 0;
+    AudioWrCnt = 0;
+    AudioRdCnt = 0;
+  }
+}
+#endif /* AUDIO_OUT_CIRCULAR_ENABLED */
+#endif /* AUDIO_RING_STREAM */
+
+#ifdef AUDIO_FEEDBACK_ENABLED
+/******************************************************************************
+     AUDIO asynchronous playback
+******************************************************************************/
+#ifndef AUDIO_OUT_CIRCULAR_ENABLED
+/**
+  * @brief  USBD_AUDIO_TransferComplete
+  *         Codec transfer complete (from the codec DMA interrupt): release the
+  *         packet just played and pass the next one, or silence while the
+  *         ring is refilled after an underrun. The codec clock paces the
+  *         stream; SOF only measures it.
+  * @param  None
+  * @retval None
+  */
+void USBD_AUDIO_TransferComplete (void)
+{
+  uint32_t level;
+  uint8_t  *pbuf;
+
+  if (PlayFlag == 0)
+  {
+    return;
+  }
+
+  AudioPlayed += AudioPacket / AudioFrameBytes;
+
+  if (AudioMuted == 0)
+  {
+    AUDIO_Ring_Release(AudioPacket);
+  }
+
+  level = AudioWrCnt - AudioRdCnt;
+
+  if (((AudioMuted == 0) && (level >= AudioPacket)) ||
+      ((AudioMuted != 0) && (level >= AudioTarget)))
+  {
+    AudioMuted = 0;
+    pbuf = AudioRing + AudioRdIdx;
+  }
+  else
+  {
+    if (AudioMuted == 0)
+    {
+      /* Underrun: keep more data in the ring from now on */
+      AudioTarget += (AudioPacket / (2 * AudioFrameBytes)) * AudioFrameBytes;
+      if (AudioTarget > AudioRingSize / 2)
+      {
+        AudioTarget = AudioRingSize / 2;
+      }
+      AudioStable = 0;
+      AudioMuted = 1;
+    }
+    pbuf = AudioSilence;
+  }
+
+  AUDIO_OUT_fops.AudioCmd(pbuf,
+                          AudioPacket,
+                          AUDIO_CMD_PLAY);
+}
+#endif /* AUDIO_OUT_CIRCULAR_ENABLED */
+
+/**
+  * @brief  AUDIO_Feedback_Update
+  *         Called on each SOF. Every 2^AUDIO_FB_REFRESH frames, computes the
+  *         samples per frame played by the codec (10.14), corrected so that
+  *         the average ring level converges to the target level.
+  * @param  None
+  * @retval None
+  */
+static void AUDIO_Feedback_Update (void)
+{
+  uint32_t played;
+  uint32_t level;
+  int32_t  rate;
+  int32_t  fb;
+
+  FbLevelSum += AudioWrCnt - AudioRdCnt;
+
+  if (++FbFrames < (1 << AUDIO_FB_REFRESH))
+  {
+    return;
+  }
+
+  played = AudioPlayed;
+  level  = FbLevelSum >> AUDIO_FB_REFRESH;
+
+  if (PlayFlag == 0)
+  {
+    FbValid = 0;
+  }
+  else if (FbValid == 0)
+  {
+    /* First period played partially: no measurement */
+    FbValid = 1;
+  }
+  else
+  {
+    rate = (int32_t)((played - FbLastPlayed) << (14 - AUDIO_FB_REFRESH));
+    FbRate += (rate - FbRate) / (1 << AUDIO_FB_FILTER);
+
+    /* Lower the target level slowly while there is no underrun */
+    if (AudioMuted == 0)
+    {
+      AudioStable += FbFrames;
+      if (AudioStable >= AUDIO_FB_DECAY)
+      {
+        AudioStable = 0;
+        if (AudioTarget > AUDIO_FB_MIN_PACKETS * AudioPacket)
+        {
+          AudioTarget -= AudioFrameBytes;
+        }
+      }
+    }
+  }
+
+  /* Ask for more samples below the target level, fewer above */
+  fb = FbRate + ((((int32_t)AudioTarget - (int32_t)level) / (int32_t)AudioFrameBytes) * (1 << (14 - AUDIO_FB_GAIN)));
+
+  if (fb > (int32_t)(FbNominal + (1 << 14)))
+  {
+    fb = FbNominal + (1 << 14);
+  }
+  else if (fb < (int32_t)(FbNominal - (1 << 14)))
+  {
+    fb = FbNominal - (1 << 14);
+  }
+
+  FbBuf[0] = (uint8_t)(fb);
+  FbBuf[1] = (uint8_t)(fb >> 8);
+  FbBuf[2] = (uint8_t)(fb >> 16);
+
+  FbFrames = 0;
+  FbLevelSum = 0;
+  FbLastPlayed = played;
+}
+#endif /* AUDIO_FEEDBACK_ENABLED */
+
 /******************************************************************************
      AUDIO Class requests management
 ******************************************************************************/
@@ -614,6 +1810,21 @@ static uint8_t  usbd_audio_OUT_Incplt (void  *pdev)
   */
 static void AUDIO_Req_GetCurrent(void *pdev, USB_SETUP_REQ *req)
 {  
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+  /* Sampling frequency of the streaming endpoint */
+  if (((req->bmRequest & USB_REQ_RECIPIENT_MASK) == USB_REQ_RECIPIENT_ENDPOINT) &&
+      (LOBYTE(req->wIndex) == AUDIO_OUT_EP))
+  {
+    AudioCtl[0] = (uint8_t)(AudioFreq);
+    AudioCtl[1] = (uint8_t)(AudioFreq >> 8);
+    AudioCtl[2] = (uint8_t)(AudioFreq >> 16);
+    USBD_CtlSendData (pdev, 
+                      AudioCtl,
+                      MIN(req->wLength, 3));
+    return;
+  }
+#endif
+
   /* Send the current mute state */
   USBD_CtlSendData (pdev, 
                     AudioCtl,
@@ -641,8 +1852,36 @@ static void AUDIO_Req_SetCurrent(void *pdev, USB_SETUP_REQ *req)
     AudioCtlCmd = AUDIO_REQ_SET_CUR;     /* Set the request value */
     AudioCtlLen = req->wLength;          /* Set the request data length */
     AudioCtlUnit = HIBYTE(req->wIndex);  /* Set the request target unit */
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+    AudioCtlEp = ((req->bmRequest & USB_REQ_RECIPIENT_MASK) == USB_REQ_RECIPIENT_ENDPOINT) ?
+                 LOBYTE(req->wIndex) : 0;
+#endif
+  }
+}
+
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+/**
+  * @brief  AUDIO_Req_SetFrequency
+  *         Handles the SET_CUR sampling frequency endpoint request: restart
+  *         the stream at one of the frequencies of the descriptor.
+  * @param  freq: sampling frequency (Hz)
+  * @retval None
+  */
+static void AUDIO_Req_SetFrequency(uint32_t freq)
+{
+  if ((freq != AUDIO_FREQ_1) && (freq != AUDIO_FREQ_2) && (freq != AUDIO_FREQ_3))
+  {
+    return;
+  }
+
+  AUDIO_Stream_Stop();
+  AUDIO_Stream_Format(freq, AudioSubframe);
+  if (usbd_audio_AltSet != 0)
+  {
+    AUDIO_Stream_Start();
   }
 }
+#endif
 
 /**
   * @brief  USBD_audio_GetCfgDesc 
@@ -0,0 +1,290 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio_in_if.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   This file provides the Audio In (capture) interface API.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_audio_core.h"
+
+#ifdef AUDIO_IN_ENABLED
+#include "usbd_audio_in_if.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup usbd_audio_in_if 
+  * @brief usbd in interface module
+  * @{
+  */ 
+
+/** @defgroup usbd_audio_in_if_Private_TypesDefinitions
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_in_if_Private_Defines
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_in_if_Private_Macros
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_in_if_Private_FunctionPrototypes
+  * @{
+  */
+static uint8_t  Init         (uint32_t  AudioFreq, uint32_t Volume, uint32_t options);
+static uint8_t  DeInit       (uint32_t options);
+static uint8_t  AudioCmd     (uint8_t* pbuf, uint32_t size, uint8_t cmd);
+static uint8_t  GetState     (void);
+
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_in_if_Private_Variables
+  * @{
+  */ 
+AUDIO_FOPS_TypeDef  AUDIO_IN_fops = 
+{
+  Init,
+  DeInit,
+  AudioCmd,
+  NULL, /* VolumeCtl */
+  NULL, /* MuteCtl */
+  NULL, /* PeriodicTC */
+  GetState
+};
+
+static uint8_t AudioState = AUDIO_STATE_INACTIVE;
+
+/* The two memory targets of the double buffer */
+static uint8_t *AudioInTarget[2];
+
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_in_if_Private_Functions
+  * @{
+  */ 
+
+/**
+  * @brief  Init
+  *         Initialize the resources of the capture: DMA clock and interrupt.
+  * @param  AudioFreq: sampling frequency, set by the I2S configuration.
+  * @param  Volume: not used.
+  * @param  options: bit resolution (16).
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+static uint8_t  Init         (uint32_t AudioFreq, 
+                              uint32_t Volume, 
+                              uint32_t options)
+{
+  NVIC_InitTypeDef NVIC_InitStructure;
+
+  if (options != 16)
+  {
+    AudioState = AUDIO_STATE_ERROR;
+    return AUDIO_FAIL;
+  }
+
+  RCC_AHB1PeriphClockCmd(AUDIO_IN_DMA_CLOCK, ENABLE);
+
+  NVIC_InitStructure.NVIC_IRQChannel = AUDIO_IN_DMA_IRQ;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = AUDIO_IN_IRQ_PREPRIO;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+  NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&NVIC_InitStructure);
+
+  AudioState = AUDIO_STATE_ACTIVE;
+
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  DeInit
+  *         Stop the capture and free the DMA stream.
+  * @param  options: not used.
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+static uint8_t  DeInit       (uint32_t options)
+{
+  if (AudioState == AUDIO_STATE_PLAYING)
+  {
+    AudioCmd(NULL, 0, AUDIO_CMD_STOP);
+  }
+  DMA_DeInit(AUDIO_IN_DMA_STREAM);
+
+  AudioState = AUDIO_STATE_INACTIVE;
+
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  AudioCmd 
+  *         Start or stop the capture.
+  * @param  pbuf: first memory target, the second one follows it.
+  * @param  size: size of a memory target (in bytes).
+  * @param  cmd: AUDIO_CMD_PLAY to start, AUDIO_CMD_STOP to stop.
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+static uint8_t  AudioCmd(uint8_t* pbuf, 
+                         uint32_t size,
+                         uint8_t cmd)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+
+  if ((AudioState == AUDIO_STATE_INACTIVE) || (AudioState == AUDIO_STATE_ERROR))
+  {
+    return AUDIO_FAIL;
+  }
+
+  switch (cmd)
+  {
+  case AUDIO_CMD_PLAY:
+    if (AudioState == AUDIO_STATE_PLAYING)
+    {
+      return AUDIO_OK;
+    }
+
+    AudioInTarget[0] = pbuf;
+    AudioInTarget[1] = pbuf + size;
+
+    DMA_Cmd(AUDIO_IN_DMA_STREAM, DISABLE);
+    while (DMA_GetCmdStatus(AUDIO_IN_DMA_STREAM) != DISABLE)
+    {
+    }
+    DMA_DeInit(AUDIO_IN_DMA_STREAM);
+
+    DMA_InitStructure.DMA_Channel = AUDIO_IN_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = AUDIO_IN_DMA_PERIPH_ADDR;
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)AudioInTarget[0];
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+    DMA_InitStructure.DMA_BufferSize = size / 2;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+    DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
+    DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+    DMA_Init(AUDIO_IN_DMA_STREAM, &DMA_InitStructure);
+
+    /* The DMA switches target on each transfer complete */
+    DMA_DoubleBufferModeConfig(AUDIO_IN_DMA_STREAM,
+                               (uint32_t)AudioInTarget[1],
+                               DMA_Memory_0);
+    DMA_DoubleBufferModeCmd(AUDIO_IN_DMA_STREAM, ENABLE);
+
+    DMA_ITConfig(AUDIO_IN_DMA_STREAM, DMA_IT_TC, ENABLE);
+    DMA_Cmd(AUDIO_IN_DMA_STREAM, ENABLE);
+
+    SPI_I2S_DMACmd(AUDIO_IN_I2S, SPI_I2S_DMAReq_Rx, ENABLE);
+    I2S_Cmd(AUDIO_IN_I2S, ENABLE);
+
+    AudioState = AUDIO_STATE_PLAYING;
+    return AUDIO_OK;
+
+  case AUDIO_CMD_STOP:
+    I2S_Cmd(AUDIO_IN_I2S, DISABLE);
+    SPI_I2S_DMACmd(AUDIO_IN_I2S, SPI_I2S_DMAReq_Rx, DISABLE);
+    DMA_ITConfig(AUDIO_IN_DMA_STREAM, DMA_IT_TC, DISABLE);
+    DMA_Cmd(AUDIO_IN_DMA_STREAM, DISABLE);
+
+    AudioState = AUDIO_STATE_STOPPED;
+    return AUDIO_OK;
+
+  default:
+    return AUDIO_FAIL;
+  }
+}
+
+/**
+  * @brief  GetState
+  *         Return the current state of the capture
+  * @param  None
+  * @retval Current State.
+  */
+static uint8_t  GetState   (void)
+{
+  return AudioState;
+}
+
+/**
+  * @brief  AUDIO_IN_DMA_IRQHandler
+  *         Transfer complete of the capture DMA: the stream now fills the
+  *         other target, pass the completed one to the core.
+  * @param  None
+  * @retval None
+  */
+void AUDIO_IN_DMA_IRQHandler (void)
+{
+  if (DMA_GetITStatus(AUDIO_IN_DMA_STREAM, AUDIO_IN_DMA_IT_TC) != RESET)
+  {
+    DMA_ClearITPendingBit(AUDIO_IN_DMA_STREAM, AUDIO_IN_DMA_IT_TC);
+
+    if (DMA_GetCurrentMemoryTarget(AUDIO_IN_DMA_STREAM) != 0)
+    {
+      USBD_AUDIO_InComplete(AudioInTarget[0]);
+    }
+    else
+    {
+      USBD_AUDIO_InComplete(AudioInTarget[1]);
+    }
+  }
+}
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+#endif /* AUDIO_IN_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,375 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio_mixer.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   This file provides the mixer of the Audio Out (playback) path.
+  *
+  *  @verbatim
+  *      
+  *          ===================================================================      
+  *                                Audio mixer
+  *          =================================================================== 
+  *           Each packet received from the host is mixed in place, in the
+  *           packet buffer, before it joins the ring played by the codec:
+  *             - Source 0 is the host stream, scaled by its gain
+  *             - Sources 1 to AUDIO_MIXER_SOURCES - 1 are local streams
+  *               (prompts, tones) pulled chunk by chunk from the application,
+  *               scaled and added with saturation
+  *           Gains ramp by AUDIO_MIXER_RAMP_STEP per chunk of AUDIO_MIXER_CHUNK
+  *           samples, so volume, mute and detach changes do not click.
+  *           Only 16-bit streams are mixed: 24-bit streams pass unchanged.
+  *           Local sources are heard while the host streams.
+  *           The CMSIS DSP library is needed (ARM_MATH_CM4, ARM_MATH_CM3 or
+  *           ARM_MATH_CM0 defined for the core).
+  *      
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_audio_core.h"
+
+#ifdef AUDIO_MIXER_ENABLED
+#include "usbd_audio_out_if.h"
+#include "usbd_audio_mixer.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup usbd_audio_mixer 
+  * @brief usbd audio mixer module
+  * @{
+  */ 
+
+/** @defgroup usbd_audio_mixer_Private_TypesDefinitions
+  * @{
+  */ 
+typedef struct
+{
+  __IO AUDIO_MixerFill_TypeDef Fill;  /* 0: source free */
+  __IO q15_t   Volume;                  /* Gain set by the application */
+  __IO uint8_t Muted;
+  __IO uint8_t Detach;                  /* Released once ramped down to 0 */
+  q15_t        Gain;                    /* Gain applied, ramping to the target */
+}
+AUDIO_MixerSource_TypeDef;
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_mixer_Private_Defines
+  * @{
+  */ 
+#if (AUDIO_MIXER_CHUNK % 2) != 0
+ #error "AUDIO_MIXER_CHUNK must hold whole stereo samples"
+#endif
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_mixer_Private_Macros
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+
+/** @defgroup usbd_audio_mixer_Private_FunctionPrototypes
+  * @{
+  */
+static q15_t AUDIO_Mixer_Ramp (AUDIO_MixerSource_TypeDef *s);
+static void  AUDIO_Mixer_Add  (q15_t *pDst, q15_t *pSrc, uint32_t size);
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_mixer_Private_Variables
+  * @{
+  */ 
+/* The host stream starts at full scale */
+static AUDIO_MixerSource_TypeDef MixSource[AUDIO_MIXER_SOURCES] =
+{
+  {0, AUDIO_MIXER_UNITY, 0, 0, AUDIO_MIXER_UNITY}
+};
+
+/* Chunk of a local source */
+static q15_t MixChunk[AUDIO_MIXER_CHUNK];
+/**
+  * @}
+  */ 
+
+/** @defgroup usbd_audio_mixer_Private_Functions
+  * @{
+  */ 
+
+/**
+  * @brief  AUDIO_Mixer_Attach
+  *         Start mixing a local source, its gain ramping up from 0.
+  * @param  src: source, from 1 to AUDIO_MIXER_SOURCES - 1
+  * @param  fill: function writing the samples of the source
+  * @param  gain: gain of the source (q15)
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+uint8_t AUDIO_Mixer_Attach (uint8_t src, AUDIO_MixerFill_TypeDef fill, q15_t gain)
+{
+  AUDIO_MixerSource_TypeDef *s;
+
+  if ((src == AUDIO_MIXER_USB) || (src >= AUDIO_MIXER_SOURCES) || (fill == 0) || (gain < 0))
+  {
+    return AUDIO_FAIL;
+  }
+
+  s = &MixSource[src];
+  s->Fill = 0;
+  s->Gain = 0;
+  s->Volume = gain;
+  s->Muted = 0;
+  s->Detach = 0;
+
+  /* Last: the mixer may run between two calls */
+  s->Fill = fill;
+
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  AUDIO_Mixer_Detach
+  *         Ramp a local source down to 0, then stop calling it: it is free
+  *         once AUDIO_Mixer_IsActive returns 0.
+  * @param  src: source, from 1 to AUDIO_MIXER_SOURCES - 1
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+uint8_t AUDIO_Mixer_Detach (uint8_t src)
+{
+  if ((src == AUDIO_MIXER_USB) || (src >= AUDIO_MIXER_SOURCES))
+  {
+    return AUDIO_FAIL;
+  }
+
+  MixSource[src].Detach = 1;
+
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  AUDIO_Mixer_SetGain
+  *         Set the gain of a source, reached through the ramp.
+  * @param  src: source, AUDIO_MIXER_USB for the host stream
+  * @param  gain: gain (q15), from 0 to AUDIO_MIXER_UNITY
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+uint8_t AUDIO_Mixer_SetGain (uint8_t src, q15_t gain)
+{
+  if ((src >= AUDIO_MIXER_SOURCES) || (gain < 0))
+  {
+    return AUDIO_FAIL;
+  }
+
+  MixSource[src].Volume = gain;
+
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  AUDIO_Mixer_Mute
+  *         Ramp a source down to 0, or back to its gain.
+  * @param  src: source, AUDIO_MIXER_USB for the host stream
+  * @param  cmd: AUDIO_MUTE or AUDIO_UNMUTE
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+uint8_t AUDIO_Mixer_Mute (uint8_t src, uint8_t cmd)
+{
+  if (src >= AUDIO_MIXER_SOURCES)
+  {
+    return AUDIO_FAIL;
+  }
+
+  MixSource[src].Muted = (cmd == AUDIO_MUTE) ? 1 : 0;
+
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  AUDIO_Mixer_IsActive
+  *         Tell whether a source is mixed.
+  * @param  src: source, AUDIO_MIXER_USB for the host stream
+  * @retval 1 while the source is attached or ramping down, 0 else.
+  */
+uint8_t AUDIO_Mixer_IsActive (uint8_t src)
+{
+  if (src == AUDIO_MIXER_USB)
+  {
+    return 1;
+  }
+
+  return ((src < AUDIO_MIXER_SOURCES) && (MixSource[src].Fill != 0)) ? 1 : 0;
+}
+
+/**
+  * @brief  AUDIO_Mixer_Process
+  *         Mix the sources into a block of the host stream, in place: each
+  *         sample is read and written once.
+  * @param  pbuf: interleaved stereo 16-bit samples received from the host
+  * @param  size: number of samples (half-words, both channels)
+  * @retval None
+  */
+void AUDIO_Mixer_Process (q15_t *pbuf, uint32_t size)
+{
+  AUDIO_MixerSource_TypeDef *s;
+  AUDIO_MixerFill_TypeDef fill;
+  uint32_t src;
+  uint32_t n;
+  uint32_t got;
+  q15_t gain;
+
+  while (size > 0)
+  {
+    n = (size < AUDIO_MIXER_CHUNK) ? size : AUDIO_MIXER_CHUNK;
+
+    /* Host stream: left as is at full scale */
+    gain = AUDIO_Mixer_Ramp(&MixSource[AUDIO_MIXER_USB]);
+    if (gain != AUDIO_MIXER_UNITY)
+    {
+      arm_scale_q15(pbuf, gain, 0, pbuf, n);
+    }
+
+    for (src = 1; src < AUDIO_MIXER_SOURCES; src++)
+    {
+      s = &MixSource[src];
+      fill = s->Fill;
+      if (fill == 0)
+      {
+        continue;
+      }
+
+      gain = AUDIO_Mixer_Ramp(s);
+      if ((s->Detach != 0) && (gain == 0))
+      {
+        s->Fill = 0;
+        continue;
+      }
+
+      /* A muted source keeps running, so that it resumes in step */
+      got = fill(MixChunk, n);
+      got = (got > n) ? n : (got & ~1UL);
+
+      if ((got != 0) && (gain != 0))
+      {
+        if (gain != AUDIO_MIXER_UNITY)
+        {
+          arm_scale_q15(MixChunk, gain, 0, MixChunk, got);
+        }
+        AUDIO_Mixer_Add(pbuf, MixChunk, got);
+      }
+    }
+
+    pbuf += n;
+    size -= n;
+  }
+}
+
+/**
+  * @brief  AUDIO_Mixer_Ramp
+  *         Move the gain of a source one step towards its target.
+  * @param  s: source
+  * @retval Gain to apply to the chunk.
+  */
+static q15_t AUDIO_Mixer_Ramp (AUDIO_MixerSource_TypeDef *s)
+{
+  int32_t target = ((s->Muted != 0) || (s->Detach != 0)) ? 0 : s->Volume;
+  int32_t gain = s->Gain;
+
+  if (gain < target)
+  {
+    gain += AUDIO_MIXER_RAMP_STEP;
+    if (gain > target)
+    {
+      gain = target;
+    }
+  }
+  else if (gain > target)
+  {
+    gain -= AUDIO_MIXER_RAMP_STEP;
+    if (gain < target)
+    {
+      gain = target;
+    }
+  }
+
+  s->Gain = (q15_t)gain;
+  return s->Gain;
+}
+
+/**
+  * @brief  AUDIO_Mixer_Add
+  *         Add a chunk to the block with saturation, two samples at a time
+  *         with __QADD16.
+  * @param  pDst: block, updated in place
+  * @param  pSrc: chunk
+  * @param  size: number of samples, even
+  * @retval None
+  */
+static void AUDIO_Mixer_Add (q15_t *pDst, q15_t *pSrc, uint32_t size)
+{
+#ifndef ARM_MATH_CM0
+  q31_t inA;
+  q31_t inB;
+
+  size >>= 1;
+  while (size > 0)
+  {
+    inA = *__SIMD32(pDst);
+    inB = *__SIMD32(pSrc)++;
+    *__SIMD32(pDst)++ = __QADD16(inA, inB);
+    size--;
+  }
+#else
+  while (size > 0)
+  {
+    *pDst = (q15_t) __SSAT(((q31_t) *pDst + *pSrc++), 16);
+    pDst++;
+    size--;
+  }
+#endif /* ARM_MATH_CM0 */
+}
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+#endif /* AUDIO_MIXER_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -28,6 +28,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "usbd_audio_core.h"
 #include "usbd_audio_out_if.h"
+#ifdef AUDIO_MIXER_ENABLED
+#include "usbd_audio_mixer.h"
+#endif
 
 /** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
   * @{
@@ -73,6 +76,9 @@ static uint8_t  VolumeCtl    (uint8_t vol);
 static uint8_t  MuteCtl      (uint8_t cmd);
 static uint8_t  PeriodicTC   (uint8_t cmd);
 static uint8_t  GetState     (void);
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+static uint8_t  CircularCmd  (uint8_t* pbuf, uint32_t size, uint8_t cmd);
+#endif
 
 /**
   * @}
@@ -94,6 +100,11 @@ AUDIO_FOPS_TypeDef  AUDIO_OUT_fops =
 
 static uint8_t AudioState = AUDIO_STATE_INACTIVE;
 
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+/* Size of the ring played by the DMA, in bytes */
+static uint32_t AudioOutSize = 0;
+#endif
+
 /**
   * @}
   */ 
@@ -117,6 +128,18 @@ static uint8_t  Init         (uint32_t AudioFreq,
   static uint32_t Initialized = 0;
   
   /* Check if the low layer has already been initialized */
+#ifdef AUDIO_MULTI_FORMAT_ENABLED
+  static uint32_t InitFreq = 0;
+  static uint32_t InitRes = 0;
+
+  /* options: bit resolution. The codec is set again on a format change */
+  if ((AudioFreq != InitFreq) || (options != InitRes))
+  {
+    Initialized = 0;
+    InitFreq = AudioFreq;
+    InitRes = options;
+  }
+#endif
   if (Initialized == 0)
   {
     /* Call low layer function */
@@ -170,6 +193,9 @@ static uint8_t  AudioCmd(uint8_t* pbuf,
     return AUDIO_FAIL;
   }
   
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+  return CircularCmd(pbuf, size, cmd);
+#else
   switch (cmd)
   {
     /* Process the PLAY command ----------------------------*/
@@ -242,6 +268,7 @@ static uint8_t  AudioCmd(uint8_t* pbuf,
   default:
     return AUDIO_FAIL;
   }  
+#endif /* AUDIO_OUT_CIRCULAR_ENABLED */
 }
 
 /**
@@ -252,6 +279,15 @@ static uint8_t  AudioCmd(uint8_t* pbuf,
   */
 static uint8_t  VolumeCtl    (uint8_t vol)
 {
+#ifdef AUDIO_MIXER_ENABLED
+  /* Gain of the host stream in the mixer: the codec stays at its startup
+     volume, and the local sources keep their own gains */
+  if (vol > 100)
+  {
+    vol = 100;
+  }
+  return AUDIO_Mixer_SetGain(AUDIO_MIXER_USB, (q15_t)((vol * AUDIO_MIXER_UNITY) / 100));
+#else
   /* Call low layer volume setting function */  
   if (EVAL_AUDIO_VolumeCtl(vol) != 0)
   {
@@ -260,6 +296,7 @@ static uint8_t  VolumeCtl    (uint8_t vol)
   }
   
   return AUDIO_OK;
+#endif /* AUDIO_MIXER_ENABLED */
 }
 
 /**
@@ -270,6 +307,10 @@ static uint8_t  VolumeCtl    (uint8_t vol)
   */
 static uint8_t  MuteCtl      (uint8_t cmd)
 {
+#ifdef AUDIO_MIXER_ENABLED
+  /* Ramped down in the mixer: no click, and the local sources are heard */
+  return AUDIO_Mixer_Mute(AUDIO_MIXER_USB, cmd);
+#else
   /* Call low layer mute setting function */  
   if (EVAL_AUDIO_Mute(cmd) != 0)
   {
@@ -278,6 +319,7 @@ static uint8_t  MuteCtl      (uint8_t cmd)
   }
   
   return AUDIO_OK;
+#endif /* AUDIO_MIXER_ENABLED */
 }
 
 /**
@@ -306,6 +348,119 @@ static uint8_t  GetState   (void)
   return AudioState;
 }
 
+#ifdef AUDIO_OUT_CIRCULAR_ENABLED
+/**
+  * @brief  CircularCmd 
+  *         Play, Pause or Stop the ring, played in a loop by the I2S DMA.
+  *         The codec driver is only used for the codec power down.
+  * @param  pbuf: start of the ring.
+  * @param  size: size of the ring (in bytes).
+  * @param  cmd: AUDIO_CMD_PLAY (re)starts the DMA from the start of the ring,
+  *              AUDIO_CMD_PAUSE or AUDIO_CMD_STOP stop it.
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+static uint8_t  CircularCmd(uint8_t* pbuf, 
+                            uint32_t size,
+                            uint8_t cmd)
+{
+  DMA_InitTypeDef DMA_InitStructure;
+
+  switch (cmd)
+  {
+  case AUDIO_CMD_PLAY:
+    RCC_AHB1PeriphClockCmd(AUDIO_OUT_DMA_CLOCK, ENABLE);
+
+    DMA_Cmd(AUDIO_OUT_DMA_STREAM, DISABLE);
+    while (DMA_GetCmdStatus(AUDIO_OUT_DMA_STREAM) != DISABLE)
+    {
+    }
+    DMA_DeInit(AUDIO_OUT_DMA_STREAM);
+
+    DMA_InitStructure.DMA_Channel = AUDIO_OUT_DMA_CHANNEL;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = AUDIO_OUT_DMA_PERIPH_ADDR;
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)pbuf;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+    DMA_InitStructure.DMA_BufferSize = size / 2;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+    DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+    DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_1QuarterFull;
+    DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+    DMA_Init(AUDIO_OUT_DMA_STREAM, &DMA_InitStructure);
+
+    /* No interrupt: the core reads the DMA position on each SOF */
+    AudioOutSize = size;
+    DMA_Cmd(AUDIO_OUT_DMA_STREAM, ENABLE);
+
+    SPI_I2S_DMACmd(AUDIO_OUT_I2S, SPI_I2S_DMAReq_Tx, ENABLE);
+    I2S_Cmd(AUDIO_OUT_I2S, ENABLE);
+
+    AudioState = AUDIO_STATE_PLAYING;
+    return AUDIO_OK;
+
+  case AUDIO_CMD_PAUSE:
+  case AUDIO_CMD_STOP:
+    if (AudioState != AUDIO_STATE_PLAYING)
+    {
+      /* Unsupported command */
+      return AUDIO_FAIL;
+    }
+
+    SPI_I2S_DMACmd(AUDIO_OUT_I2S, SPI_I2S_DMAReq_Tx, DISABLE);
+    DMA_Cmd(AUDIO_OUT_DMA_STREAM, DISABLE);
+
+    if (cmd == AUDIO_CMD_PAUSE)
+    {
+      AudioState = AUDIO_STATE_PAUSED;
+    }
+    else if (EVAL_AUDIO_Stop(CODEC_PDWN_SW) != 0)
+    {
+      AudioState = AUDIO_STATE_ERROR;
+      return AUDIO_FAIL;
+    }
+    else
+    {
+      AudioState = AUDIO_STATE_STOPPED;
+    }
+    return AUDIO_OK;
+
+  default:
+    return AUDIO_FAIL;
+  }
+}
+
+/**
+  * @brief  AUDIO_OUT_GetPosition
+  *         Return the position of the DMA in the ring: the data before it
+  *         has been read by the I2S.
+  * @param  None
+  * @retval Byte offset in the ring.
+  */
+uint32_t AUDIO_OUT_GetPosition (void)
+{
+  return AudioOutSize - (DMA_GetCurrDataCounter(AUDIO_OUT_DMA_STREAM) * 2);
+}
+
+#elif defined (AUDIO_FEEDBACK_ENABLED)
+/**
+  * @brief  EVAL_AUDIO_TransferComplete_CallBack
+  *         Called by the codec driver when the buffer passed to
+  *         Audio_MAL_Play has been played: the core passes the next one.
+  * @param  pBuffer: buffer played
+  * @param  Size: size of the buffer
+  * @retval None
+  */
+void EVAL_AUDIO_TransferComplete_CallBack(uint32_t pBuffer, uint32_t Size)
+{
+  USBD_AUDIO_TransferComplete();
+}
+#endif /* AUDIO_OUT_CIRCULAR_ENABLED */
+
 /**
   * @}
   */ 
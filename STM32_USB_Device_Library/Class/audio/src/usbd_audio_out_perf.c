@@ -0,0 +1,286 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio_out_perf.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Throughput test sink of the audio class, linked instead of
+  *          usbd_audio_out_if.c: the played buffers are checked against the
+  *          test pattern instead of going to the codec.
+  *
+  *          The host streams the pattern as PCM data. An isochronous packet
+  *          lost on the bus shows as a jump of the stream offset held by the
+  *          pattern words: the sink follows it and counts the skipped bytes
+  *          with USBD_Perf_Lost. With AUDIO_FEEDBACK_ENABLED there is no
+  *          codec DMA to pace the playback: the application calls
+  *          USBD_AUDIO_TransferComplete from a timer, once per played packet.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_audio_core.h"
+#include "usbd_audio_out_if.h"
+#include "usbd_perf.h"
+
+#ifdef USBD_PERF_ENABLED
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup usbd_audio_out_perf
+  * @brief audio throughput test sink
+  * @{
+  */
+
+/** @defgroup usbd_audio_out_perf_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_audio_out_perf_Private_Defines
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_audio_out_perf_Private_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_audio_out_perf_Private_FunctionPrototypes
+  * @{
+  */
+static uint8_t  Init         (uint32_t  AudioFreq, uint32_t Volume, uint32_t options);
+static uint8_t  DeInit       (uint32_t options);
+static uint8_t  AudioCmd     (uint8_t* pbuf, uint32_t size, uint8_t cmd);
+static uint8_t  VolumeCtl    (uint8_t vol);
+static uint8_t  MuteCtl      (uint8_t cmd);
+static uint8_t  PeriodicTC   (uint8_t cmd);
+static uint8_t  GetState     (void);
+static void     PerfSink     (uint8_t* pbuf, uint32_t size);
+
+/**
+  * @}
+  */
+
+/** @defgroup usbd_audio_out_perf_Private_Variables
+  * @{
+  */
+AUDIO_FOPS_TypeDef  AUDIO_OUT_fops =
+{
+  Init,
+  DeInit,
+  AudioCmd,
+  VolumeCtl,
+  MuteCtl,
+  PeriodicTC,
+  GetState
+};
+
+static uint8_t  AudioState = AUDIO_STATE_INACTIVE;
+
+/* Stream offset of the next byte, valid once PerfSync is set */
+static uint32_t PerfOff;
+static uint8_t  PerfSync = 0;
+
+/**
+  * @}
+  */
+
+/** @defgroup usbd_audio_out_perf_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Init
+  *         Nothing to set up: the data is not played
+  * @param  AudioFreq: Startup audio frequency.
+  * @param  Volume: Startup volume to be set.
+  * @param  options: specific options passed to low layer function.
+  * @retval AUDIO_OK
+  */
+static uint8_t  Init         (uint32_t AudioFreq,
+                              uint32_t Volume,
+                              uint32_t options)
+{
+  AudioState = AUDIO_STATE_ACTIVE;
+  PerfSync = 0;
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  DeInit
+  *         Stop the sink
+  * @param  options: options passed to low layer function.
+  * @retval AUDIO_OK
+  */
+static uint8_t  DeInit       (uint32_t options)
+{
+  AudioState = AUDIO_STATE_INACTIVE;
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  AudioCmd
+  *         Check the buffers to play against the test pattern
+  * @param  pbuf: samples
+  * @param  size: size of the buffer in bytes
+  * @param  cmd: AUDIO_CMD_PLAY, AUDIO_CMD_PAUSE or AUDIO_CMD_STOP
+  * @retval AUDIO_OK if all operations succeed, AUDIO_FAIL else.
+  */
+static uint8_t  AudioCmd(uint8_t* pbuf,
+                         uint32_t size,
+                         uint8_t cmd)
+{
+  if ((AudioState == AUDIO_STATE_INACTIVE) || (AudioState == AUDIO_STATE_ERROR))
+  {
+    AudioState = AUDIO_STATE_ERROR;
+    return AUDIO_FAIL;
+  }
+
+  switch (cmd)
+  {
+  case AUDIO_CMD_PLAY:
+    PerfSink(pbuf, size);
+    AudioState = AUDIO_STATE_PLAYING;
+    return AUDIO_OK;
+
+  case AUDIO_CMD_PAUSE:
+    AudioState = AUDIO_STATE_PAUSED;
+    return AUDIO_OK;
+
+  case AUDIO_CMD_STOP:
+    AudioState = AUDIO_STATE_STOPPED;
+    return AUDIO_OK;
+
+  default:
+    return AUDIO_FAIL;
+  }
+}
+
+/**
+  * @brief  VolumeCtl
+  *         Ignored
+  * @param  vol: volume level in %
+  * @retval AUDIO_OK
+  */
+static uint8_t  VolumeCtl    (uint8_t vol)
+{
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  MuteCtl
+  *         Ignored
+  * @param  cmd: 0 to unmute, 1 to mute
+  * @retval AUDIO_OK
+  */
+static uint8_t  MuteCtl      (uint8_t cmd)
+{
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  PeriodicTC
+  *         Ignored
+  * @param  cmd: command
+  * @retval AUDIO_OK
+  */
+static uint8_t  PeriodicTC   (uint8_t cmd)
+{
+  return AUDIO_OK;
+}
+
+/**
+  * @brief  GetState
+  *         Return the current state of the audio machine
+  * @param  None
+  * @retval Current State.
+  */
+static uint8_t  GetState   (void)
+{
+  return AudioState;
+}
+
+/**
+  * @brief  PerfSink
+  *         Follow the stream offset from the first whole pattern word of the
+  *         buffer, then check the buffer
+  * @param  pbuf: samples
+  * @param  size: size of the buffer in bytes
+  * @retval None
+  */
+static void     PerfSink     (uint8_t* pbuf, uint32_t size)
+{
+  uint32_t skip = PerfSync ? ((4 - (PerfOff & 3)) & 3) : 0;
+  uint32_t word;
+
+  if (size >= skip + 4)
+  {
+    word = pbuf[skip] | (pbuf[skip + 1] << 8) |
+           (pbuf[skip + 2] << 16) | ((uint32_t)pbuf[skip + 3] << 24);
+
+    if (PerfSync == 0)
+    {
+      /* First buffer: offset 0 of the buffer is taken as word aligned */
+      PerfOff = word;
+      PerfSync = 1;
+    }
+    else if (((word & 3) == 0) && (word > PerfOff + skip))
+    {
+      /* Packets lost on the bus */
+      USBD_Perf_Lost(word - (PerfOff + skip));
+      PerfOff = word - skip;
+    }
+  }
+
+  if (PerfSync)
+  {
+    USBD_Perf_Check(pbuf, size, PerfOff);
+    PerfOff += size;
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#endif /* USBD_PERF_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -66,6 +66,16 @@
         
 #define CDC_DATA_OUT_PACKET_SIZE               CDC_DATA_MAX_PACKET_SIZE
 
+/* Largest transfer of APP_Rx_Buffer data in CDC_TX_BLOCK_ENABLED mode */
+#ifndef CDC_TX_BLOCK_MAX
+ #define CDC_TX_BLOCK_MAX                      APP_RX_DATA_SIZE
+#endif
+
+/* Buffer of the OUT data read with CDC_Read in CDC_RING_ENABLED mode */
+#ifndef CDC_RX_RING_SIZE
+ #define CDC_RX_RING_SIZE                      (4 * CDC_DATA_MAX_PACKET_SIZE)
+#endif
+
 /*---------------------------------------------------------------------*/
 /*  CDC definitions                                                    */
 /*---------------------------------------------------------------------*/
@@ -127,6 +137,11 @@ extern USBD_Class_cb_TypeDef  USBD_CDC_cb;
 /** @defgroup USB_CORE_Exported_Functions
   * @{
   */
+void USBD_CDC_SetInFrameInterval (uint32_t interval);
+#ifdef CDC_RING_ENABLED
+uint32_t CDC_Write (const uint8_t *buf, uint32_t len);
+uint32_t CDC_Read (uint8_t *buf, uint32_t len);
+#endif
 /**
   * @}
   */ 
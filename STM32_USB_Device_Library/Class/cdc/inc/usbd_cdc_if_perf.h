@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file    usbd_cdc_if_perf.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Header for usbd_cdc_if_perf.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_CDC_IF_PERF_H
+#define __USBD_CDC_IF_PERF_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_conf.h"
+#include "usbd_conf.h"
+#include "usbd_cdc_core.h"
+#include "usbd_perf.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+#ifdef USBD_PERF_ENABLED
+
+/* Bytes generated or checked per CDC_Write / CDC_Read call */
+#ifndef CDC_PERF_CHUNK
+ #define CDC_PERF_CHUNK               256
+#endif
+
+extern CDC_IF_Prop_TypeDef  PERF_fops;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void CDC_Perf_Pump (USB_OTG_CORE_HANDLE *pdev);
+
+#endif /* USBD_PERF_ENABLED */
+
+#endif /* __USBD_CDC_IF_PERF_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -122,6 +122,13 @@ static uint8_t  usbd_cdc_SOF         (void *pdev);
    CDC specific management functions
  *********************************************/
 static void Handle_USBAsynchXfer  (void *pdev);
+#ifdef CDC_TX_BLOCK_ENABLED
+static uint8_t  CDC_TxBlock        (void *pdev);
+#endif
+#ifdef CDC_RING_ENABLED
+static void     CDC_TxPublish      (void);
+static uint32_t CDC_RxFree         (void);
+#endif
 static uint8_t  *USBD_cdc_GetCfgDesc (uint8_t speed, uint16_t *length);
 #ifdef USE_USB_OTG_HS  
 static uint8_t  *USBD_cdc_GetOtherCfgDesc (uint8_t speed, uint16_t *length);
@@ -185,6 +192,40 @@ uint32_t APP_Rx_length  = 0;
 
 uint8_t  USB_Tx_State = 0;
 
+#ifdef CDC_TX_BLOCK_ENABLED
+/* Length of the last block sent, to terminate it with a ZLP */
+static uint32_t USB_Tx_Last = 0;
+#endif
+
+/* Number of frames between two checks of APP_Rx_Buffer */
+static uint32_t cdcInFrameInterval = CDC_IN_FRAME_INTERVAL;
+
+/* Oldest byte of APP_Rx_Buffer not sent yet: start of the transfer in
+   progress, APP_Rx_ptr_out otherwise */
+static __IO uint32_t cdcTxTail = 0;
+
+#ifdef CDC_RING_ENABLED
+ #if (APP_RX_DATA_SIZE > 0x10000)
+  #error "CDC_RING_ENABLED needs APP_RX_DATA_SIZE <= 0x10000"
+ #endif
+/* Producers of CDC_Write: number of copies in progress (bits 31:16) and
+   end of the reserved data (bits 15:0). APP_Rx_ptr_in follows the end once
+   no copy is in progress. */
+static __IO uint32_t cdcTxResv = 0;
+
+/* OUT data waiting for CDC_Read */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t USB_Rx_Ring[CDC_RX_RING_SIZE] __ALIGN_END ;
+
+static __IO uint32_t USB_Rx_ring_in  = 0;
+static __IO uint32_t USB_Rx_ring_out = 0;
+static __IO uint8_t  USB_Rx_Paused   = 0;
+#endif /* CDC_RING_ENABLED */
+
 static uint32_t cdcCmd = 0xFF;
 static uint32_t cdcLen = 0;
 
@@ -623,6 +664,32 @@ static uint8_t  usbd_cdc_EP0_RxReady (void  *pdev)
   */
 static uint8_t  usbd_cdc_DataIn (void *pdev, uint8_t epnum)
 {
+#ifdef CDC_RING_ENABLED
+  CDC_TxPublish();
+#endif
+#ifdef CDC_TX_BLOCK_ENABLED
+  if (USB_Tx_State == 1)
+  {
+    /* Chain the wrapped remainder or the data queued meanwhile */
+    if (CDC_TxBlock(pdev) == 0)
+    {
+      if ((USB_Tx_Last != 0) && ((USB_Tx_Last % CDC_DATA_IN_PACKET_SIZE) == 0))
+      {
+        /* End the host transfer on a packet boundary */
+        USB_Tx_Last = 0;
+        DCD_EP_Tx (pdev,
+                   CDC_IN_EP,
+                   APP_Rx_Buffer,
+                   0);
+      }
+      else
+      {
+        USB_Tx_State = 0;
+        cdcTxTail = APP_Rx_ptr_out;
+      }
+    }
+  }
+#else
   uint16_t USB_Tx_ptr;
   uint16_t USB_Tx_length;
 
@@ -631,6 +698,7 @@ static uint8_t  usbd_cdc_DataIn (void *pdev, uint8_t epnum)
     if (APP_Rx_length == 0) 
     {
       USB_Tx_State = 0;
+      cdcTxTail = APP_Rx_ptr_out;
     }
     else 
     {
@@ -651,12 +719,14 @@ static uint8_t  usbd_cdc_DataIn (void *pdev, uint8_t epnum)
       }
       
       /* Prepare the available data buffer to be sent on IN endpoint */
+      cdcTxTail = USB_Tx_ptr;
       DCD_EP_Tx (pdev,
                  CDC_IN_EP,
                  (uint8_t*)&APP_Rx_Buffer[USB_Tx_ptr],
                  USB_Tx_length);
     }
   }  
+#endif /* CDC_TX_BLOCK_ENABLED */
   
   return USBD_OK;
 }
@@ -675,9 +745,32 @@ static uint8_t  usbd_cdc_DataOut (void *pdev, uint8_t epnum)
   /* Get the received data buffer and update the counter */
   USB_Rx_Cnt = ((USB_OTG_CORE_HANDLE*)pdev)->dev.out_ep[epnum].xfer_count;
   
+#ifdef CDC_RING_ENABLED
+  {
+    uint32_t in = USB_Rx_ring_in;
+    uint16_t i;
+    
+    /* Room for the packet was checked before the endpoint was armed */
+    for (i = 0; i < USB_Rx_Cnt; i++)
+    {
+      USB_Rx_Ring[in] = USB_Rx_Buffer[i];
+      in = (in + 1) % CDC_RX_RING_SIZE;
+    }
+    __DMB();
+    USB_Rx_ring_in = in;
+  }
+  
+  if (CDC_RxFree() < CDC_DATA_OUT_PACKET_SIZE)
+  {
+    /* NAK until CDC_Read makes room, the SOF handler resumes */
+    USB_Rx_Paused = 1;
+    return USBD_OK;
+  }
+#else
   /* USB data will be immediately processed, this allow next USB traffic being 
      NAKed till the end of the application Xfer */
   APP_FOPS.pIf_DataRx(USB_Rx_Buffer, USB_Rx_Cnt);
+#endif /* CDC_RING_ENABLED */
   
   /* Prepare Out endpoint to receive next packet */
   DCD_EP_PrepareRx(pdev,
@@ -699,12 +792,26 @@ static uint8_t  usbd_cdc_SOF (void *pdev)
 {      
   static uint32_t FrameCount = 0;
   
-  if (FrameCount++ == CDC_IN_FRAME_INTERVAL)
+#ifdef CDC_RING_ENABLED
+  if (USB_Rx_Paused && (CDC_RxFree() >= CDC_DATA_OUT_PACKET_SIZE))
+  {
+    USB_Rx_Paused = 0;
+    DCD_EP_PrepareRx(pdev,
+                     CDC_OUT_EP,
+                     (uint8_t*)(USB_Rx_Buffer),
+                     CDC_DATA_OUT_PACKET_SIZE);
+  }
+#endif
+  
+  if (FrameCount++ >= cdcInFrameInterval)
   {
     /* Reset the frame counter */
     FrameCount = 0;
     
     /* Check the data to be sent through IN pipe */
+#ifdef CDC_RING_ENABLED
+    CDC_TxPublish();
+#endif
     Handle_USBAsynchXfer(pdev);
   }
   
@@ -719,6 +826,12 @@ static uint8_t  usbd_cdc_SOF (void *pdev)
   */
 static void Handle_USBAsynchXfer (void *pdev)
 {
+#ifdef CDC_TX_BLOCK_ENABLED
+  if(USB_Tx_State != 1)
+  {
+    USB_Tx_State = CDC_TxBlock(pdev);
+  }
+#else
   uint16_t USB_Tx_ptr;
   uint16_t USB_Tx_length;
   
@@ -766,13 +879,200 @@ static void Handle_USBAsynchXfer (void *pdev)
       APP_Rx_length = 0;
     }
     USB_Tx_State = 1; 
+    cdcTxTail = USB_Tx_ptr;
 
     DCD_EP_Tx (pdev,
                CDC_IN_EP,
                (uint8_t*)&APP_Rx_Buffer[USB_Tx_ptr],
                USB_Tx_length);
   }  
+#endif /* CDC_TX_BLOCK_ENABLED */
+  
+}
+
+#ifdef CDC_TX_BLOCK_ENABLED
+/**
+  * @brief  CDC_TxBlock
+  *         Send the contiguous data of APP_Rx_Buffer, up to its end or to
+  *         CDC_TX_BLOCK_MAX bytes, in one multi-packet transfer
+  * @param  pdev: instance
+  * @retval 1 when a transfer was started, 0 when there is nothing to send
+  */
+static uint8_t CDC_TxBlock (void *pdev)
+{
+  uint32_t ptr_in = APP_Rx_ptr_in;
+  uint32_t USB_Tx_ptr;
+  uint32_t USB_Tx_length;
+  
+  if (APP_Rx_ptr_out == APP_RX_DATA_SIZE)
+  {
+    APP_Rx_ptr_out = 0;
+  }
+  
+  if (APP_Rx_ptr_out > ptr_in) /* rollback: the remainder follows */
+  {
+    USB_Tx_length = APP_RX_DATA_SIZE - APP_Rx_ptr_out;
+  }
+  else
+  {
+    USB_Tx_length = ptr_in - APP_Rx_ptr_out;
+  }
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  USB_Tx_length &= ~0x03;
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+  
+  if (USB_Tx_length > CDC_TX_BLOCK_MAX)
+  {
+    USB_Tx_length = CDC_TX_BLOCK_MAX;
+  }
+  
+  if (USB_Tx_length == 0)
+  {
+    return 0;
+  }
+  
+  USB_Tx_ptr = APP_Rx_ptr_out;
+  APP_Rx_ptr_out += USB_Tx_length;
+  USB_Tx_Last = USB_Tx_length;
+  cdcTxTail = USB_Tx_ptr;
+  
+  DCD_EP_Tx (pdev,
+             CDC_IN_EP,
+             (uint8_t*)&APP_Rx_Buffer[USB_Tx_ptr],
+             USB_Tx_length);
+  return 1;
+}
+#endif /* CDC_TX_BLOCK_ENABLED */
+
+#ifdef CDC_RING_ENABLED
+/**
+  * @brief  CDC_Write
+  *         Queue data to be sent on the IN endpoint. Safe against the USB
+  *         interrupt and other producers (threads or interrupts) without
+  *         masking interrupts: the space is reserved with LDREX/STREX, then
+  *         the data is copied. The data is sent once no copy is in progress.
+  * @param  buf: data
+  * @param  len: number of bytes
+  * @retval len, or 0 when APP_Rx_Buffer has no room for all of it
+  */
+uint32_t CDC_Write (const uint8_t *buf, uint32_t len)
+{
+  uint32_t resv;
+  uint32_t start;
+  uint32_t tail;
+  uint32_t used;
+  uint32_t pos;
+  uint32_t i;
+  
+  if ((len == 0) || (len >= APP_RX_DATA_SIZE))
+  {
+    return 0;
+  }
+  
+  /* Reserve [start, start + len) and count this copy */
+  do
+  {
+    resv  = __LDREXW((uint32_t *)&cdcTxResv);
+    start = resv & 0xFFFF;
+    tail  = cdcTxTail;
+    if (tail >= APP_RX_DATA_SIZE)
+    {
+      tail -= APP_RX_DATA_SIZE;
+    }
+    used = (start + APP_RX_DATA_SIZE - tail) % APP_RX_DATA_SIZE;
+    if ((used + len) >= APP_RX_DATA_SIZE)
+    {
+      __CLREX();
+      return 0;
+    }
+  }
+  while (__STREXW(((resv & 0xFFFF0000) + 0x10000) | ((start + len) % APP_RX_DATA_SIZE),
+                  (uint32_t *)&cdcTxResv) != 0);
+  
+  pos = start;
+  for (i = 0; i < len; i++)
+  {
+    APP_Rx_Buffer[pos] = buf[i];
+    pos = (pos + 1) % APP_RX_DATA_SIZE;
+  }
+  __DMB();
+  
+  /* Commit: the reserved data is published with the last copy */
+  do
+  {
+    resv = __LDREXW((uint32_t *)&cdcTxResv);
+  }
+  while (__STREXW(resv - 0x10000, (uint32_t *)&cdcTxResv) != 0);
   
+  return len;
+}
+
+/**
+  * @brief  CDC_TxPublish
+  *         Let the IN transfers see the data of CDC_Write once no copy is
+  *         in progress
+  * @param  None
+  * @retval None
+  */
+static void CDC_TxPublish (void)
+{
+  uint32_t resv = cdcTxResv;
+  
+  if ((resv >> 16) == 0)
+  {
+    APP_Rx_ptr_in = resv & 0xFFFF;
+  }
+}
+
+/**
+  * @brief  CDC_Read
+  *         Get the data received on the OUT endpoint (single consumer)
+  * @param  buf: destination
+  * @param  len: size of buf
+  * @retval number of bytes copied
+  */
+uint32_t CDC_Read (uint8_t *buf, uint32_t len)
+{
+  uint32_t in  = USB_Rx_ring_in;
+  uint32_t out = USB_Rx_ring_out;
+  uint32_t cnt = 0;
+  
+  __DMB();
+  while ((cnt < len) && (out != in))
+  {
+    buf[cnt++] = USB_Rx_Ring[out];
+    out = (out + 1) % CDC_RX_RING_SIZE;
+  }
+  __DMB();
+  USB_Rx_ring_out = out;
+  
+  return cnt;
+}
+
+/**
+  * @brief  CDC_RxFree
+  *         Room left in USB_Rx_Ring
+  * @param  None
+  * @retval number of bytes
+  */
+static uint32_t CDC_RxFree (void)
+{
+  uint32_t used;
+  
+  used = (USB_Rx_ring_in + CDC_RX_RING_SIZE - USB_Rx_ring_out) % CDC_RX_RING_SIZE;
+  return CDC_RX_RING_SIZE - 1 - used;
+}
+#endif /* CDC_RING_ENABLED */
+
+/**
+  * @brief  USBD_CDC_SetInFrameInterval
+  *         Set the number of frames between two checks of APP_Rx_Buffer
+  * @param  interval: number of SOF (0 checks at each SOF)
+  * @retval None
+  */
+void USBD_CDC_SetInFrameInterval (uint32_t interval)
+{
+  cdcInFrameInterval = interval;
 }
 
 /**
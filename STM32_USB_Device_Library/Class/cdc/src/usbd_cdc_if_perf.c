@@ -0,0 +1,212 @@
+/**
+  ******************************************************************************
+  * @file    usbd_cdc_if_perf.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Throughput test interface of the CDC class: once the host opens
+  *          the port, the IN endpoint streams the test pattern and the OUT
+  *          data is checked against it. Each SET_CONTROL_LINE_STATE request
+  *          (port opened or closed) starts a new run at stream offset 0.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_cdc_if_perf.h"
+
+#ifdef USBD_PERF_ENABLED
+
+#ifndef CDC_RING_ENABLED
+ #error "usbd_cdc_if_perf.c needs CDC_RING_ENABLED"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t  PerfBuf[CDC_PERF_CHUNK];
+
+/* Line coding returned to GET_LINE_CODING: 115200 bauds, 8N1 (unused) */
+static uint8_t  PerfLineCoding[7] = {0x00, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x08};
+
+/* Runs requested by the host and run in progress in CDC_Perf_Pump */
+static __IO uint8_t PerfReq = 0;
+static uint8_t  PerfRun = 0;
+static uint8_t  PerfActive = 0;
+
+/* Stream offsets of the next IN and OUT bytes */
+static uint32_t PerfTxOff;
+static uint32_t PerfRxOff;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t PERF_Init     (void);
+static uint16_t PERF_DeInit   (void);
+static uint16_t PERF_Ctrl     (uint32_t Cmd, uint8_t* Buf, uint32_t Len);
+static uint16_t PERF_DataTx   (uint8_t* Buf, uint32_t Len);
+static uint16_t PERF_DataRx   (uint8_t* Buf, uint32_t Len);
+
+CDC_IF_Prop_TypeDef PERF_fops =
+{
+  PERF_Init,
+  PERF_DeInit,
+  PERF_Ctrl,
+  PERF_DataTx,
+  PERF_DataRx
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  PERF_Init
+  *         Initializes the test interface
+  * @param  None
+  * @retval USBD_OK
+  */
+static uint16_t PERF_Init(void)
+{
+  return USBD_OK;
+}
+
+/**
+  * @brief  PERF_DeInit
+  *         DeInitializes the test interface
+  * @param  None
+  * @retval USBD_OK
+  */
+static uint16_t PERF_DeInit(void)
+{
+  return USBD_OK;
+}
+
+/**
+  * @brief  PERF_Ctrl
+  *         Manage the CDC class requests: SET_CONTROL_LINE_STATE starts a
+  *         new run
+  * @param  Cmd: Command code
+  * @param  Buf: Buffer containing command data (request parameters)
+  * @param  Len: Number of data to be sent (in bytes)
+  * @retval USBD_OK
+  */
+static uint16_t PERF_Ctrl (uint32_t Cmd, uint8_t* Buf, uint32_t Len)
+{
+  uint32_t i;
+
+  switch (Cmd)
+  {
+  case SET_LINE_CODING:
+    for (i = 0; (i < Len) && (i < sizeof(PerfLineCoding)); i++)
+    {
+      PerfLineCoding[i] = Buf[i];
+    }
+    break;
+
+  case GET_LINE_CODING:
+    for (i = 0; (i < Len) && (i < sizeof(PerfLineCoding)); i++)
+    {
+      Buf[i] = PerfLineCoding[i];
+    }
+    break;
+
+  case SET_CONTROL_LINE_STATE:
+    /* wValue (DTR, RTS) is not forwarded by the core */
+    PerfReq++;
+    break;
+
+  default:
+    break;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  PERF_DataTx
+  *         Not used: CDC_Perf_Pump queues the IN data
+  * @param  Buf: Buffer of data to be sent
+  * @param  Len: Number of data to be sent (in bytes)
+  * @retval USBD_OK
+  */
+static uint16_t PERF_DataTx (uint8_t* Buf, uint32_t Len)
+{
+  return USBD_OK;
+}
+
+/**
+  * @brief  PERF_DataRx
+  *         Not used with CDC_RING_ENABLED: CDC_Perf_Pump reads the OUT data
+  * @param  Buf: Buffer of data received
+  * @param  Len: Number of data received (in bytes)
+  * @retval USBD_OK
+  */
+static uint16_t PERF_DataRx (uint8_t* Buf, uint32_t Len)
+{
+  return USBD_OK;
+}
+
+/**
+  * @brief  CDC_Perf_Pump
+  *         Move the test streams, called from the main loop: USBD_Perf_Idle
+  *         is called when there is nothing to do
+  * @param  pdev: device instance
+  * @retval None
+  */
+void CDC_Perf_Pump (USB_OTG_CORE_HANDLE *pdev)
+{
+  uint32_t len;
+  uint8_t  busy = 0;
+
+  if (PerfReq != PerfRun)
+  {
+    PerfRun = PerfReq;
+    PerfActive = 1;
+    PerfTxOff = 0;
+    PerfRxOff = 0;
+    USBD_Perf_Start(pdev);
+  }
+
+  /* OUT: check what the host sent */
+  len = CDC_Read(PerfBuf, sizeof(PerfBuf));
+  if (len != 0)
+  {
+    USBD_Perf_Check(PerfBuf, len, PerfRxOff);
+    PerfRxOff += len;
+    busy = 1;
+  }
+
+  /* IN: queue the pattern while the ring has room */
+  if (PerfActive)
+  {
+    USBD_Perf_Fill(PerfBuf, sizeof(PerfBuf), PerfTxOff);
+    if (CDC_Write(PerfBuf, sizeof(PerfBuf)) != 0)
+    {
+      PerfTxOff += sizeof(PerfBuf);
+      busy = 1;
+    }
+  }
+
+  if (!busy)
+  {
+    USBD_Perf_Idle();
+  }
+}
+
+#endif /* USBD_PERF_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
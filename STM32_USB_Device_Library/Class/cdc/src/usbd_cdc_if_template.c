@@ -44,6 +44,8 @@ extern uint8_t  APP_Rx_Buffer []; /* Write CDC received data in this buffer.
 extern uint32_t APP_Rx_ptr_in;    /* Increment this pointer or roll it back to
                                      start address when writing received data
                                      in the buffer APP_Rx_Buffer. */
+/* With CDC_RING_ENABLED, use CDC_Write and CDC_Read (usbd_cdc_core.h)
+   instead: they are safe for several producers and interrupts. */
 
 /* Private function prototypes -----------------------------------------------*/
 static uint16_t TEMPLATE_Init     (void);
@@ -157,6 +159,10 @@ static uint16_t TEMPLATE_Ctrl (uint32_t Cmd, uint8_t* Buf, uint32_t Len)
   */
 static uint16_t TEMPLATE_DataTx (uint8_t* Buf, uint32_t Len)
 {
+#ifdef CDC_RING_ENABLED
+  /* APP_Rx_Buffer is owned by the ring: queue through CDC_Write */
+  return (CDC_Write(Buf, Len) == Len) ? USBD_OK : USBD_FAIL;
+#endif
 
   /* Get the data to be sent */
   for (i = 0; i < Len; i++)
@@ -111,6 +111,17 @@
 #define CMD_GETCOMMANDS              0x00
 #define CMD_SETADDRESSPOINTER        0x21
 #define CMD_ERASE                    0x41
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+/* Address, length and CRC (4 bytes each, see MAL_GetCRC) of a range of the
+   image: its erase and write operations are skipped if the memory already
+   holds it. The range must cover whole erase sectors */
+ #define CMD_CHECKCRC                0x43
+#endif
+#ifdef DFU_COMPRESSION_ENABLED
+/* 1: the blocks which follow are LZ4 blocks, each one decompressing to at
+   most XFERSIZE bytes programmed after the previous one. 0: plain blocks */
+ #define CMD_COMPRESSION             0x44
+#endif
 
 /**************************************************/
 /* Other defines                                  */
@@ -177,6 +188,9 @@ extern USBD_Class_cb_TypeDef  DFU_cb;
 /** @defgroup USB_CORE_Exported_Functions
   * @{
   */
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+void USBD_DFU_Process (void);
+#endif
 /**
   * @}
   */ 
@@ -47,6 +47,14 @@ typedef struct _DFU_MAL_PROP
   uint16_t (*pMAL_CheckAdd) (uint32_t Add);
   const uint32_t EraseTiming;
   const uint32_t WriteTiming;
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+  /* Write from a given buffer, NULL if the memory only supports pMAL_Write */
+  uint16_t (*pMAL_WriteBuf) (uint32_t Add, uint8_t *pbuf, uint32_t Len);
+#endif
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+  /* CRC of a word aligned area (see MAL_GetCRC), NULL if not supported */
+  uint32_t (*pMAL_CRC)      (uint32_t Add, uint32_t Len);
+#endif
 }
 DFU_MAL_Prop_TypeDef;
 
@@ -72,7 +80,13 @@ uint16_t MAL_Init (void);
 uint16_t MAL_DeInit (void);
 uint16_t MAL_Erase (uint32_t SectorAddress);
 uint16_t MAL_Write (uint32_t SectorAddress, uint32_t DataLength);
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+uint16_t MAL_WriteBuf (uint32_t SectorAddress, uint8_t *pbuf, uint32_t DataLength);
+#endif
 uint8_t *MAL_Read  (uint32_t SectorAddress, uint32_t DataLength);
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+uint16_t MAL_GetCRC (uint32_t SectorAddress, uint32_t DataLength, uint32_t *pCrc);
+#endif
 uint16_t MAL_GetStatus(uint32_t SectorAddress ,uint8_t Cmd, uint8_t *buffer);
 
 extern uint8_t  MAL_Buffer[XFERSIZE]; /* RAM Buffer for Downloaded Data */
@@ -40,13 +40,37 @@
  #define FLASH_END_ADD                   0x08100000
  #define FLASH_IF_STRING                 "@Internal Flash   /0x08000000/03*016Ka,01*016Kg,01*064Kg,07*128Kg"
 #elif defined(STM32F4XX)
- #define FLASH_END_ADD                   0x08100000
- #define FLASH_IF_STRING                 "@Internal Flash   /0x08000000/03*016Ka,01*016Kg,01*064Kg,07*128Kg"
+ #if defined (STM32F427X) || defined (STM32F427_437xx) || defined (STM32F429_439xx)
+  /* 2 Mbytes, two banks of 12 sectors */
+  #define FLASH_END_ADD                  0x08200000
+  #define FLASH_IF_STRING                "@Internal Flash   /0x08000000/03*016Ka,01*016Kg,01*064Kg,07*128Kg,04*016Kg,01*064Kg,07*128Kg"
+ #else
+  #define FLASH_END_ADD                  0x08100000
+  #define FLASH_IF_STRING                "@Internal Flash   /0x08000000/03*016Ka,01*016Kg,01*064Kg,07*128Kg"
+ #endif
 #elif defined(STM32F10X_CL)
  #define FLASH_END_ADD                   0x08040000
  #define FLASH_IF_STRING                 "@Internal Flash   /0x08000000/06*002Ka,122*002Kg"  
 #endif /* STM32F2XX */
 
+#if defined (STM32F2XX) || defined (STM32F4XX)
+/* Supply voltage range: sets the erase and programming parallelism, x8
+   (VoltageRange_1) up to x64 with FLASH_ProgramDoubleWord (VoltageRange_4,
+   external Vpp) */
+#ifndef FLASH_IF_VOLTAGE_RANGE
+ #define FLASH_IF_VOLTAGE_RANGE          VoltageRange_3
+#endif
+#endif /* STM32F2XX || STM32F4XX */
+
+/* Polling time reported for a XFERSIZE block, in ms (about 16 us per
+   program operation on STM32F2xx/F4xx, x32 in voltage range 3) */
+#ifndef FLASH_IF_WRITE_TIME
+ #if defined (STM32F2XX) || defined (STM32F4XX)
+  #define FLASH_IF_WRITE_TIME            ((XFERSIZE / 4) * 16 / 1000 + 1)
+ #else
+  #define FLASH_IF_WRITE_TIME            50
+ #endif
+#endif
 
 extern DFU_MAL_Prop_TypeDef DFU_Flash_cb;
 
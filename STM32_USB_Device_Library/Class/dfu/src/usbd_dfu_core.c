@@ -33,6 +33,11 @@
   *            As required by the DFU specification, only endpoint 0 is used in this application.
   *            Other endpoints and functions may be added to the application (ie. DFU ...)
   * 
+  *           With DFU_DOUBLE_BUFFER_ENABLED, the blocks are programmed by USBD_DFU_Process
+  *           (called from the application loop) while the next one is received.
+  *           DFU_SKIP_UNCHANGED_ENABLED and DFU_COMPRESSION_ENABLED add the
+  *           CMD_CHECKCRC and CMD_COMPRESSION special commands.
+  *
   *           These aspects may be enriched or modified for a specific user application.
   *          
   *           This driver doesn't implement the following aspects of the specification 
@@ -81,6 +86,19 @@
 /** @defgroup usbd_dfu_Private_TypesDefinitions
   * @{
   */ 
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+/* Erase command or block received, left to USBD_DFU_Process */
+typedef struct _DFU_Job
+{
+  uint32_t Add;
+  uint32_t Len;
+  uint8_t  Cmd;         /* CMD_ERASE, CMD_CHECKCRC, else write */
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+  uint32_t Crc;
+#endif
+}
+DFU_Job_TypeDef;
+#endif
 /**
   * @}
   */ 
@@ -89,6 +107,10 @@
 /** @defgroup usbd_dfu_Private_Defines
   * @{
   */ 
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+ #define DFU_JOB_NUM                  2
+ #define DFU_JOB_WRITE                0xFF
+#endif
 /**
   * @}
   */ 
@@ -97,6 +119,14 @@
 /** @defgroup usbd_dfu_Private_Macros
   * @{
   */ 
+/* Little endian word of a special command */
+#define DFU_LE32(p)   ((p)[0] | ((p)[1] << 8) | ((p)[2] << 16) | ((uint32_t)(p)[3] << 24))
+
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+ #define DFU_SKIPPED(a, l)            (((a) >= DFU_SkipStart) && (((a) + (l)) <= DFU_SkipEnd))
+#else
+ #define DFU_SKIPPED(a, l)            0
+#endif
 /**
   * @}
   */ 
@@ -158,6 +188,21 @@ static void DFU_Req_ABORT     (void *pdev);
 
 static void DFU_LeaveDFUMode  (void *pdev); 
 
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+static uint8_t DFU_QueueBlock (void);
+static uint8_t DFU_JobStatus  (uint32_t pending);
+#endif
+
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+static void DFU_CheckCRC      (uint32_t Add, uint32_t Len, uint32_t Crc);
+#endif
+
+#ifdef DFU_COMPRESSION_ENABLED
+static uint8_t  DFU_Inflate   (uint8_t *pbuf, uint32_t *Add);
+static uint32_t DFU_LZ4_Decode(const uint8_t *src, uint32_t srclen,
+                               uint8_t *dst, uint32_t dstlen);
+#endif
+
 /**
   * @}
   */ 
@@ -195,6 +240,43 @@ static __IO uint32_t  usbd_dfu_AltSet = 0;
 
 extern uint8_t MAL_Buffer[];
 
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+/* Download buffers: a block is received in DFU_Buffer[DFU_JobIn] while
+   the previous one is programmed from DFU_Buffer[DFU_JobOut] */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t DFU_Buffer[DFU_JOB_NUM][XFERSIZE] __ALIGN_END ;
+static DFU_Job_TypeDef DFU_Job[DFU_JOB_NUM];
+static __IO uint32_t DFU_JobIn = 0;
+static __IO uint32_t DFU_JobOut = 0;
+/* First erase or programming error, reported by GETSTATUS */
+static __IO uint8_t  DFU_JobError = STATUS_OK;
+
+ #define DFU_RX_BUFFER                DFU_Buffer[DFU_JobIn % DFU_JOB_NUM]
+#else
+ #define DFU_RX_BUFFER                MAL_Buffer
+#endif /* DFU_DOUBLE_BUFFER_ENABLED */
+
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+/* Range of the image found unchanged by CMD_CHECKCRC */
+static uint32_t DFU_SkipStart = 0;
+static uint32_t DFU_SkipEnd = 0;
+#endif
+
+#ifdef DFU_COMPRESSION_ENABLED
+static uint8_t  DFU_Compressed = 0;
+static uint32_t DFU_LzPointer = 0;  /* Address of the next decompressed block */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t DFU_LzBuffer[XFERSIZE] __ALIGN_END ;
+#endif
+
 /* DFU interface class callbacks structure */
 USBD_Class_cb_TypeDef  DFU_cb = 
 {
@@ -410,6 +492,14 @@ static uint8_t  usbd_dfu_Init (void  *pdev,
   /* Initilialize the MAL(Media Access Layer) */
   MAL_Init();
   
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+  DFU_SkipStart = 0;
+  DFU_SkipEnd = 0;
+#endif
+#ifdef DFU_COMPRESSION_ENABLED
+  DFU_Compressed = 0;
+#endif
+
   /* Initialize the state of the DFU interface */
   DeviceState = STATE_dfuIDLE;
   DeviceStatus[0] = STATUS_OK;
@@ -544,11 +634,23 @@ static uint8_t  usbd_dfu_Setup (void  *pdev,
   */
 static uint8_t  EP0_TxSent (void  *pdev)
 {
+#ifndef DFU_DOUBLE_BUFFER_ENABLED
   uint32_t Addr;
   USB_SETUP_REQ req;  
+#endif
   
   if (DeviceState == STATE_dfuDNBUSY)
   {
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+    /* The block has been queued by GETSTATUS: poll again once the
+       buffers are released */
+    DeviceState =  STATE_dfuDNLOAD_SYNC;
+    DeviceStatus[4] = DeviceState;
+    DeviceStatus[1] = 0;
+    DeviceStatus[2] = 0;
+    DeviceStatus[3] = 0;
+    return USBD_OK;
+#else
     /* Decode the Special Command*/
     if (wBlockNum == 0)   
     {
@@ -567,8 +669,24 @@ static uint8_t  EP0_TxSent (void  *pdev)
         Pointer += MAL_Buffer[2] << 8;
         Pointer += MAL_Buffer[3] << 16;
         Pointer += MAL_Buffer[4] << 24;
-        MAL_Erase(Pointer);
+        if (!DFU_SKIPPED(Pointer, 1))
+        {
+          MAL_Erase(Pointer);
+        }
+      }
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+      else if (( MAL_Buffer[0] ==  CMD_CHECKCRC ) && (wlength == 13))
+      {
+        DFU_CheckCRC(DFU_LE32(&MAL_Buffer[1]), DFU_LE32(&MAL_Buffer[5]),
+                     DFU_LE32(&MAL_Buffer[9]));
       }
+#endif
+#ifdef DFU_COMPRESSION_ENABLED
+      else if (( MAL_Buffer[0] ==  CMD_COMPRESSION ) && (wlength == 2))
+      {
+        DFU_Compressed = MAL_Buffer[1];
+      }
+#endif
       else
       {
         /* Reset the global length and block number */
@@ -586,8 +704,23 @@ static uint8_t  EP0_TxSent (void  *pdev)
       /* Decode the required address */
       Addr = ((wBlockNum - 2) * XFERSIZE) + Pointer;
       
+#ifdef DFU_COMPRESSION_ENABLED
+      if (DFU_Compressed && (DFU_Inflate(MAL_Buffer, &Addr) != USBD_OK))
+      {
+        wlength = 0;
+        wBlockNum = 0;
+        DeviceState = STATE_dfuERROR;
+        DeviceStatus[0] = STATUS_ERRFILE;
+        DeviceStatus[4] = DeviceState;
+        return USBD_OK;
+      }
+#endif
+      
       /* Preform the write operation */
-      MAL_Write(Addr, wlength);
+      if (!DFU_SKIPPED(Addr, wlength))
+      {
+        MAL_Write(Addr, wlength);
+      }
     }
     /* Reset the global lenght and block number */
     wlength = 0;
@@ -600,6 +733,7 @@ static uint8_t  EP0_TxSent (void  *pdev)
     DeviceStatus[2] = 0;
     DeviceStatus[3] = 0;
     return USBD_OK;
+#endif /* DFU_DOUBLE_BUFFER_ENABLED */
   }
   else if (DeviceState == STATE_dfuMANIFEST)/* Manifestation in progress*/
   {
@@ -676,6 +810,14 @@ static void DFU_Req_DNLOAD(void *pdev, USB_SETUP_REQ *req)
   /* Data setup request */
   if (req->wLength > 0)
   {
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+    /* No free buffer (ABORT while both were in use) */
+    if ((DFU_JobIn - DFU_JobOut) >= DFU_JOB_NUM)
+    {
+      USBD_CtlError (pdev, req);
+    }
+    else
+#endif
     if ((DeviceState == STATE_dfuIDLE) || (DeviceState == STATE_dfuDNLOAD_IDLE))
     {
       /* Update the global length and block number */
@@ -688,7 +830,7 @@ static void DFU_Req_DNLOAD(void *pdev, USB_SETUP_REQ *req)
       
       /* Prepare the reception of the buffer over EP0 */
       USBD_CtlPrepareRx (pdev,
-                         (uint8_t*)MAL_Buffer,                                  
+                         (uint8_t*)DFU_RX_BUFFER,                                  
                          wlength);
     }
     /* Unsupported state */
@@ -751,14 +893,21 @@ static void DFU_Req_UPLOAD(void *pdev, USB_SETUP_REQ *req)
         DeviceStatus[3] = 0;
         
         /* Store the values of all supported commands */
-        MAL_Buffer[0] = CMD_GETCOMMANDS;
-        MAL_Buffer[1] = CMD_SETADDRESSPOINTER;
-        MAL_Buffer[2] = CMD_ERASE;
+        Addr = 0;
+        MAL_Buffer[Addr++] = CMD_GETCOMMANDS;
+        MAL_Buffer[Addr++] = CMD_SETADDRESSPOINTER;
+        MAL_Buffer[Addr++] = CMD_ERASE;
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+        MAL_Buffer[Addr++] = CMD_CHECKCRC;
+#endif
+#ifdef DFU_COMPRESSION_ENABLED
+        MAL_Buffer[Addr++] = CMD_COMPRESSION;
+#endif
         
         /* Send the status data over EP0 */
         USBD_CtlSendData (pdev,
                           (uint8_t *)(&(MAL_Buffer[0])),
-                          3);
+                          MIN(Addr, wlength));
       }
       else if (wBlockNum > 1)
       {
@@ -817,9 +966,47 @@ static void DFU_Req_UPLOAD(void *pdev, USB_SETUP_REQ *req)
   */
 static void DFU_Req_GETSTATUS(void *pdev)
 {
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+  USB_SETUP_REQ req;  
+  uint8_t status;
+#endif
+
   switch (DeviceState)
   {
   case   STATE_dfuDNLOAD_SYNC:
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+    /* Queue the block received, then answer busy only while both
+       buffers are in use */
+    if ((wlength != 0) && ((status = DFU_QueueBlock()) != STATUS_OK))
+    {
+      DeviceState = STATE_dfuERROR;
+      DeviceStatus[0] = status;
+      DeviceStatus[4] = DeviceState;
+      req.bmRequest = 0;
+      req.wLength = 1;
+      USBD_CtlError (pdev, &req);
+      return;
+    }
+
+    switch (DFU_JobStatus(DFU_JOB_NUM - 1))
+    {
+    case USBD_BUSY:
+      DeviceState = STATE_dfuDNBUSY;
+      DeviceStatus[4] = DeviceState;
+      break;
+
+    case USBD_OK:
+      DeviceState = STATE_dfuDNLOAD_IDLE;
+      DeviceStatus[4] = DeviceState;
+      DeviceStatus[1] = 0;
+      DeviceStatus[2] = 0;
+      DeviceStatus[3] = 0;
+      break;
+
+    default:
+      break;
+    }
+#else
     if (wlength != 0)
     {
       DeviceState = STATE_dfuDNBUSY;
@@ -841,9 +1028,18 @@ static void DFU_Req_GETSTATUS(void *pdev)
       DeviceStatus[2] = 0;
       DeviceStatus[3] = 0;
     }
+#endif /* DFU_DOUBLE_BUFFER_ENABLED */
     break;
     
   case   STATE_dfuMANIFEST_SYNC :
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+    /* Manifestation starts once the last blocks are programmed */
+    if ((Manifest_State == Manifest_In_Progress) &&
+        (DFU_JobStatus(0) != USBD_OK))
+    {
+      break;
+    }
+#endif
     if (Manifest_State == Manifest_In_Progress)
     {
       DeviceState = STATE_dfuMANIFEST;
@@ -885,6 +1081,9 @@ static void DFU_Req_CLRSTATUS(void *pdev)
 {
   if (DeviceState == STATE_dfuERROR)
   {
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+    DFU_JobError = STATUS_OK;
+#endif
     DeviceState = STATE_dfuIDLE;
     DeviceStatus[0] = STATUS_OK;/*bStatus*/
     DeviceStatus[1] = 0;
@@ -985,6 +1184,329 @@ void DFU_LeaveDFUMode(void *pdev)
   }  
 }
 
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+/**
+  * @brief  DFU_QueueBlock
+  *         Decode the block received: the special commands are processed,
+  *         the erase commands and the data blocks queued for
+  *         USBD_DFU_Process.
+  * @param  None
+  * @retval STATUS_OK, STATUS_ERRSTALLEDPKT for an unknown command,
+  *         STATUS_ERRFILE for a corrupted compressed block
+  */
+static uint8_t DFU_QueueBlock (void)
+{
+  uint8_t *pbuf = DFU_RX_BUFFER;
+  DFU_Job_TypeDef *job = &DFU_Job[DFU_JobIn % DFU_JOB_NUM];
+  uint8_t status = STATUS_OK;
+
+  /* Decode the Special Command*/
+  if (wBlockNum == 0)   
+  {
+    if ((pbuf[0] ==  CMD_GETCOMMANDS) && (wlength == 1))
+    {}
+    else if (((pbuf[0] ==  CMD_SETADDRESSPOINTER) || (pbuf[0] ==  CMD_ERASE)) &&
+             (wlength == 5))
+    {
+      Pointer  = pbuf[1];
+      Pointer += pbuf[2] << 8;
+      Pointer += pbuf[3] << 16;
+      Pointer += pbuf[4] << 24;
+
+      if (pbuf[0] ==  CMD_ERASE)
+      {
+        job->Add = Pointer;
+        job->Len = 0;
+        job->Cmd = CMD_ERASE;
+        DFU_JobIn++;
+      }
+    }
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+    else if ((pbuf[0] ==  CMD_CHECKCRC) && (wlength == 13))
+    {
+      /* Checked in order with the erase and write operations */
+      job->Add = DFU_LE32(&pbuf[1]);
+      job->Len = DFU_LE32(&pbuf[5]);
+      job->Crc = DFU_LE32(&pbuf[9]);
+      job->Cmd = CMD_CHECKCRC;
+      DFU_JobIn++;
+    }
+#endif
+#ifdef DFU_COMPRESSION_ENABLED
+    else if ((pbuf[0] ==  CMD_COMPRESSION) && (wlength == 2))
+    {
+      DFU_Compressed = pbuf[1];
+    }
+#endif
+    else
+    {
+      status = STATUS_ERRSTALLEDPKT;
+    }
+  }
+  /* Regular Download Command */
+  else if (wBlockNum > 1)  
+  {
+    job->Add = ((wBlockNum - 2) * XFERSIZE) + Pointer;
+#ifdef DFU_COMPRESSION_ENABLED
+    if (DFU_Compressed && (DFU_Inflate(pbuf, &job->Add) != USBD_OK))
+    {
+      status = STATUS_ERRFILE;
+    }
+    else
+#endif
+    {
+      job->Len = wlength;
+      job->Cmd = DFU_JOB_WRITE;
+      DFU_JobIn++;
+    }
+  }
+
+  /* Reset the global lenght and block number */
+  wlength = 0;
+  wBlockNum = 0;
+
+  return status;
+}
+
+/**
+  * @brief  DFU_JobStatus
+  *         Status of the queued operations for GETSTATUS: the error of a
+  *         failed one, or the polling time while it is in progress.
+  * @param  pending: number of operations which may stay queued
+  * @retval USBD_BUSY while more operations are queued, USBD_FAIL on error
+  */
+static uint8_t DFU_JobStatus (uint32_t pending)
+{
+  DFU_Job_TypeDef *job = &DFU_Job[DFU_JobOut % DFU_JOB_NUM];
+
+  if (DFU_JobError != STATUS_OK)
+  {
+    DeviceState = STATE_dfuERROR;
+    DeviceStatus[0] = DFU_JobError;
+    DeviceStatus[1] = 0;
+    DeviceStatus[2] = 0;
+    DeviceStatus[3] = 0;
+    DeviceStatus[4] = DeviceState;
+    return USBD_FAIL;
+  }
+
+  if ((DFU_JobIn - DFU_JobOut) > pending)
+  {
+    MAL_GetStatus(job->Add, (job->Cmd == CMD_ERASE) ? 0 : 1, DeviceStatus);
+    return USBD_BUSY;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_DFU_Process
+  *         Erase and program the blocks queued by the DFU requests. To be
+  *         called from the application loop, at a lower priority than the
+  *         USB interrupt which receives the next block meanwhile.
+  * @param  None
+  * @retval None
+  */
+void USBD_DFU_Process (void)
+{
+  DFU_Job_TypeDef *job;
+  uint32_t out;
+
+  while ((out = DFU_JobOut) != DFU_JobIn)
+  {
+    job = &DFU_Job[out % DFU_JOB_NUM];
+
+    /* After an error, the pending operations are dropped */
+    if (DFU_JobError == STATUS_OK)
+    {
+      if (job->Cmd == CMD_ERASE)
+      {
+        if (!DFU_SKIPPED(job->Add, 1) && (MAL_Erase(job->Add) != MAL_OK))
+        {
+          DFU_JobError = STATUS_ERRERASE;
+        }
+      }
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+      else if (job->Cmd == CMD_CHECKCRC)
+      {
+        DFU_CheckCRC(job->Add, job->Len, job->Crc);
+      }
+#endif
+      else if (!DFU_SKIPPED(job->Add, job->Len) &&
+               (MAL_WriteBuf(job->Add, DFU_Buffer[out % DFU_JOB_NUM], job->Len) != MAL_OK))
+      {
+        DFU_JobError = STATUS_ERRPROG;
+      }
+    }
+
+    /* Release the buffer */
+    DFU_JobOut = out + 1;
+  }
+}
+#endif /* DFU_DOUBLE_BUFFER_ENABLED */
+
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+/**
+  * @brief  DFU_CheckCRC
+  *         Compare the CRC of a memory range with the one of the image: if
+  *         they match, the erase and write operations of the range are
+  *         skipped.
+  * @param  Add: Start address of the range
+  * @param  Len: Size of the range (in bytes)
+  * @param  Crc: CRC of the image for this range
+  * @retval None
+  */
+static void DFU_CheckCRC (uint32_t Add, uint32_t Len, uint32_t Crc)
+{
+  uint32_t crc;
+  
+  if ((MAL_GetCRC(Add, Len, &crc) == MAL_OK) && (crc == Crc))
+  {
+    DFU_SkipStart = Add;
+    DFU_SkipEnd = Add + Len;
+  }
+  else
+  {
+    /* Memory without CRC support or range changed: program it */
+    DFU_SkipStart = 0;
+    DFU_SkipEnd = 0;
+  }
+}
+#endif /* DFU_SKIP_UNCHANGED_ENABLED */
+
+#ifdef DFU_COMPRESSION_ENABLED
+/**
+  * @brief  DFU_Inflate
+  *         Decompress a block in place, at the address following the
+  *         previous block (the address pointer for block 2).
+  * @param  pbuf: block received, wlength bytes
+  * @param  Add: pointer to the address where the block is programmed
+  * @retval USBD_OK, USBD_FAIL if the block is corrupted
+  */
+static uint8_t DFU_Inflate (uint8_t *pbuf, uint32_t *Add)
+{
+  uint32_t len, idx;
+  
+  if (wBlockNum == 2)
+  {
+    DFU_LzPointer = Pointer;
+  }
+  
+  len = DFU_LZ4_Decode(pbuf, wlength, DFU_LzBuffer, XFERSIZE);
+  if (len == 0)
+  {
+    return USBD_FAIL;
+  }
+  
+  for (idx = 0; idx < len; idx++)
+  {
+    pbuf[idx] = DFU_LzBuffer[idx];
+  }
+  
+  *Add = DFU_LzPointer;
+  DFU_LzPointer += len;
+  wlength = len;
+  
+  return USBD_OK;
+}
+
+/**
+  * @brief  DFU_LZ4_Decode
+  *         Decode a LZ4 block (as LZ4_compress_default output): sequences
+  *         of a token, literals and a match copied from the data already
+  *         decoded in this block.
+  * @param  src: compressed block
+  * @param  srclen: size of the compressed block
+  * @param  dst: output buffer
+  * @param  dstlen: size of the output buffer
+  * @retval Number of bytes decoded, 0 if the block is corrupted
+  */
+static uint32_t DFU_LZ4_Decode(const uint8_t *src, uint32_t srclen,
+                               uint8_t *dst, uint32_t dstlen)
+{
+  const uint8_t *end = src + srclen;
+  uint32_t out = 0;
+  uint32_t len, offset;
+  uint8_t token, byte;
+  
+  while (src < end)
+  {
+    token = *src++;
+    
+    /* Literals */
+    len = token >> 4;
+    if (len == 15)
+    {
+      do
+      {
+        if (src >= end)
+        {
+          return 0;
+        }
+        byte = *src++;
+        len += byte;
+      }
+      while (byte == 255);
+    }
+    
+    if ((len > (uint32_t)(end - src)) || (len > (dstlen - out)))
+    {
+      return 0;
+    }
+    while (len--)
+    {
+      dst[out++] = *src++;
+    }
+    
+    /* The last sequence has no match */
+    if (src == end)
+    {
+      break;
+    }
+    
+    /* Match */
+    if ((end - src) < 2)
+    {
+      return 0;
+    }
+    offset = src[0] | (src[1] << 8);
+    src += 2;
+    if ((offset == 0) || (offset > out))
+    {
+      return 0;
+    }
+    
+    len = (token & 0x0F) + 4;
+    if ((token & 0x0F) == 15)
+    {
+      do
+      {
+        if (src >= end)
+        {
+          return 0;
+        }
+        byte = *src++;
+        len += byte;
+      }
+      while (byte == 255);
+    }
+    
+    if (len > (dstlen - out))
+    {
+      return 0;
+    }
+    /* Byte copy: the match may overlap the output */
+    while (len--)
+    {
+      dst[out] = dst[out - offset];
+      out++;
+    }
+  }
+  
+  return out;
+}
+#endif /* DFU_COMPRESSION_ENABLED */
+
 /**
   * @brief  USBD_DFU_GetCfgDesc 
   *         Returns configuration descriptor
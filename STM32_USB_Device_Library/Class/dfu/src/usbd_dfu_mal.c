@@ -201,6 +201,97 @@ uint16_t MAL_Write (uint32_t Add, uint32_t Len)
   }
 }
 
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+/**
+  * @brief  MAL_WriteBuf
+  *         Write sectors of memory from a buffer other than MAL_Buffer.
+  * @param  Add: Sector address/code
+  * @param  pbuf: Data to be written (XFERSIZE bytes buffer)
+  * @param  Len: Number of data to be written (in bytes)
+  * @retval Result of the opeartion: MAL_OK if all operations are OK else MAL_FAIL
+  */
+uint16_t MAL_WriteBuf (uint32_t Add, uint8_t *pbuf, uint32_t Len)
+{
+  uint32_t memIdx = MAL_CheckAdd(Add);
+  uint32_t idx;
+ 
+  /* Check if the area is protected */
+  if (DFU_MAL_IS_PROTECTED_AREA(Add))
+  {
+    return MAL_FAIL;
+  }   
+  
+  if (memIdx < MAX_USED_MEDIA)
+  {
+    if (tMALTab[memIdx]->pMAL_WriteBuf != NULL)
+    {
+      return tMALTab[memIdx]->pMAL_WriteBuf(Add, pbuf, Len);
+    }
+    else if (tMALTab[memIdx]->pMAL_Write != NULL)
+    {
+      /* The memory programs MAL_Buffer only */
+      if (pbuf != MAL_Buffer)
+      {
+        for (idx = 0; idx < Len; idx++)
+        {
+          MAL_Buffer[idx] = pbuf[idx];
+        }
+      }
+      return tMALTab[memIdx]->pMAL_Write(Add, Len);
+    }
+    else
+    {
+      return MAL_FAIL;
+    }    
+  }
+  else
+  {
+    return MAL_FAIL;
+  }
+}
+#endif /* DFU_DOUBLE_BUFFER_ENABLED */
+
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+/**
+  * @brief  MAL_GetCRC
+  *         CRC-32 of a memory area, as computed by the STM32 CRC unit:
+  *         polynomial 0x04C11DB7, initial value 0xFFFFFFFF, over the little
+  *         endian words of the area, no reflection nor final xor.
+  * @param  Add: Start address of the area
+  * @param  Len: Size of the area (in bytes, multiple of 4)
+  * @param  pCrc: pointer to the CRC returned
+  * @retval Result of the opeartion: MAL_OK if all operations are OK else MAL_FAIL
+  */
+uint16_t MAL_GetCRC (uint32_t Add, uint32_t Len, uint32_t *pCrc)
+{
+  uint32_t memIdx = MAL_CheckAdd(Add);
+  
+  /* The whole area must be in the same memory */
+  if ((Len == 0) || (Len & 3) || (MAL_CheckAdd(Add + Len - 1) != memIdx))
+  {
+    return MAL_FAIL;
+  }
+  
+  if (memIdx < MAX_USED_MEDIA)
+  {
+    /* Check if the command is supported */
+    if (tMALTab[memIdx]->pMAL_CRC != NULL)
+    {
+      *pCrc = tMALTab[memIdx]->pMAL_CRC(Add, Len);
+      return MAL_OK;
+    }
+    else
+    {
+      return MAL_FAIL;
+    }
+  }
+  else
+  {
+    return MAL_FAIL;
+  }
+}
+#endif /* DFU_SKIP_UNCHANGED_ENABLED */
+
 /**
   * @brief  MAL_Read
   *         Read sectors of memory.
@@ -246,11 +337,11 @@ uint16_t MAL_GetStatus(uint32_t Add , uint8_t Cmd, uint8_t *buffer)
   {
     if (Cmd & 0x01)
     {
-      SET_POLLING_TIMING(tMALTab[memIdx]->EraseTiming);
+      SET_POLLING_TIMING(tMALTab[memIdx]->WriteTiming);
     }
     else
     {
-      SET_POLLING_TIMING(tMALTab[memIdx]->WriteTiming);
+      SET_POLLING_TIMING(tMALTab[memIdx]->EraseTiming);
     }
     
     return MAL_OK;
@@ -28,8 +28,20 @@
 /* Includes ------------------------------------------------------------------*/
 #include "usbd_flash_if.h"
 #include "usbd_dfu_mal.h"
+#if defined (STM32F4XX)
+#include "stm32f4xx_flash_bulk.h"
+#endif
 
 /* Private typedef -----------------------------------------------------------*/
+#if defined (STM32F2XX) || defined (STM32F4XX)
+typedef struct
+{
+  uint32_t End;         /* First address after the sector */
+  uint16_t Sector;      /* FLASH_Sector_x */
+}
+FLASH_If_Sector_TypeDef;
+#endif
+
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 
@@ -37,9 +49,11 @@
 uint16_t FLASH_If_Init(void);
 uint16_t FLASH_If_Erase (uint32_t Add);
 uint16_t FLASH_If_Write (uint32_t Add, uint32_t Len);
+uint16_t FLASH_If_WriteBuf (uint32_t Add, uint8_t *pbuf, uint32_t Len);
 uint8_t *FLASH_If_Read  (uint32_t Add, uint32_t Len);
 uint16_t FLASH_If_DeInit(void);
 uint16_t FLASH_If_CheckAdd(uint32_t Add);
+uint32_t FLASH_If_CRC (uint32_t Add, uint32_t Len);
 
 
 /* Private variables ---------------------------------------------------------*/
@@ -53,9 +67,51 @@ DFU_MAL_Prop_TypeDef DFU_Flash_cb =
     FLASH_If_Read,
     FLASH_If_CheckAdd,
     50, /* Erase Time in ms */
-    50  /* Programming Time in ms */
+    FLASH_IF_WRITE_TIME  /* Programming Time in ms */
+#ifdef DFU_DOUBLE_BUFFER_ENABLED
+    ,FLASH_If_WriteBuf
+#endif
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+    ,FLASH_If_CRC
+#endif
   };
 
+#if defined (STM32F2XX) || defined (STM32F4XX)
+/* Sector map: 4 x 16 Kbytes, 64 Kbytes and 128 Kbytes sectors for each
+   Mbyte bank */
+static const FLASH_If_Sector_TypeDef FLASH_If_Sectors[] =
+{
+  {0x08004000, FLASH_Sector_0},
+  {0x08008000, FLASH_Sector_1},
+  {0x0800C000, FLASH_Sector_2},
+  {0x08010000, FLASH_Sector_3},
+  {0x08020000, FLASH_Sector_4},
+  {0x08040000, FLASH_Sector_5},
+  {0x08060000, FLASH_Sector_6},
+  {0x08080000, FLASH_Sector_7},
+  {0x080A0000, FLASH_Sector_8},
+  {0x080C0000, FLASH_Sector_9},
+  {0x080E0000, FLASH_Sector_10},
+  {0x08100000, FLASH_Sector_11},
+#if (FLASH_END_ADD > 0x08100000)
+  {0x08104000, FLASH_Sector_12},
+  {0x08108000, FLASH_Sector_13},
+  {0x0810C000, FLASH_Sector_14},
+  {0x08110000, FLASH_Sector_15},
+  {0x08120000, FLASH_Sector_16},
+  {0x08140000, FLASH_Sector_17},
+  {0x08160000, FLASH_Sector_18},
+  {0x08180000, FLASH_Sector_19},
+  {0x081A0000, FLASH_Sector_20},
+  {0x081C0000, FLASH_Sector_21},
+  {0x081E0000, FLASH_Sector_22},
+  {0x08200000, FLASH_Sector_23},
+#endif
+};
+
+#define FLASH_IF_SECTOR_NUM   (sizeof(FLASH_If_Sectors) / sizeof(FLASH_If_Sectors[0]))
+#endif /* STM32F2XX || STM32F4XX */
+
 /* Private functions ---------------------------------------------------------*/
 
 /**
@@ -69,6 +125,15 @@ uint16_t FLASH_If_Init(void)
   /* Unlock the internal flash */
   FLASH_Unlock();
   
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+  /* Enable the CRC unit used by FLASH_If_CRC */
+ #if defined (STM32F2XX) || defined (STM32F4XX)
+  RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_CRC, ENABLE);
+ #elif defined(STM32F10X_CL)
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+ #endif
+#endif
+  
   return MAL_OK;
 }
 
@@ -96,59 +161,26 @@ uint16_t FLASH_If_DeInit(void)
 uint16_t FLASH_If_Erase(uint32_t Add)
 {
 #if defined (STM32F2XX) || defined (STM32F4XX)
-  /* Check which sector has to be erased */
-  if (Add < 0x08004000)
-  {
-    FLASH_EraseSector(FLASH_Sector_0, VoltageRange_3);
-  }
-  else if (Add < 0x08008000)
-  {
-    FLASH_EraseSector(FLASH_Sector_1, VoltageRange_3);
-  }
-  else if (Add < 0x0800C000)
-  {
-    FLASH_EraseSector(FLASH_Sector_2, VoltageRange_3);
-  }
-  else if (Add < 0x08010000)
-  {
-    FLASH_EraseSector(FLASH_Sector_3, VoltageRange_3);
-  }
-  else if (Add < 0x08020000)
-  {
-    FLASH_EraseSector(FLASH_Sector_4, VoltageRange_3);
-  }
-  else if (Add < 0x08040000)
-  {
-    FLASH_EraseSector(FLASH_Sector_5, VoltageRange_3);
-  }
-  else if (Add < 0x08060000)
-  {
-    FLASH_EraseSector(FLASH_Sector_6, VoltageRange_3);
-  }
-  else if (Add < 0x08080000)
-  {
-    FLASH_EraseSector(FLASH_Sector_7, VoltageRange_3);
-  }
-  else if (Add < 0x080A0000)
-  {
-    FLASH_EraseSector(FLASH_Sector_8, VoltageRange_3);
-  }
-  else if (Add < 0x080C0000)
-  {
-    FLASH_EraseSector(FLASH_Sector_9, VoltageRange_3);
-  }
-  else if (Add < 0x080E0000)
-  {
-    FLASH_EraseSector(FLASH_Sector_10, VoltageRange_3);
-  }
-  else if (Add < 0x08100000)
+  uint32_t idx;
+
+  if (Add < FLASH_START_ADD)
   {
-    FLASH_EraseSector(FLASH_Sector_11, VoltageRange_3);
+    return MAL_FAIL;
   }
-  else
+
+  /* Look for the sector holding the address */
+  for (idx = 0; idx < FLASH_IF_SECTOR_NUM; idx++)
   {
-    return MAL_FAIL;    
+    if (Add < FLASH_If_Sectors[idx].End)
+    {
+      if (FLASH_EraseSector(FLASH_If_Sectors[idx].Sector, FLASH_IF_VOLTAGE_RANGE) != FLASH_COMPLETE)
+      {
+        return MAL_FAIL;
+      }
+      return MAL_OK;
+    }
   }
+  return MAL_FAIL;
 #elif defined(STM32F10X_CL)
   /* Call the standard Flash erase function */
   FLASH_ErasePage(Add);  
@@ -165,24 +197,84 @@ uint16_t FLASH_If_Erase(uint32_t Add)
   * @retval MAL_OK if operation is successeful, MAL_FAIL else.
   */
 uint16_t FLASH_If_Write(uint32_t Add, uint32_t Len)
+{
+  return FLASH_If_WriteBuf(Add, MAL_Buffer, Len);
+}
+
+/**
+  * @brief  FLASH_If_WriteBuf
+  *         Program a buffer, with the parallelism of FLASH_IF_VOLTAGE_RANGE.
+  *         The end of the buffer is padded with 0xFF up to a whole program
+  *         operation.
+  * @param  Add: Address to be written to.
+  * @param  pbuf: Data to be written (XFERSIZE bytes buffer).
+  * @param  Len: Number of data to be written (in bytes).
+  * @retval MAL_OK if operation is successeful, MAL_FAIL else.
+  */
+uint16_t FLASH_If_WriteBuf(uint32_t Add, uint8_t *pbuf, uint32_t Len)
 {
   uint32_t idx = 0;
+  uint32_t step;
+  FLASH_Status status = FLASH_COMPLETE;
   
-  if  (Len & 0x3) /* Not an aligned data */
+#if defined (STM32F2XX) || defined (STM32F4XX)
+  if (FLASH_IF_VOLTAGE_RANGE == VoltageRange_4)
   {
-    for (idx = Len; idx < ((Len & 0xFFFC) + 4); idx++)
-    {
-      MAL_Buffer[idx] = 0xFF;
-    }
+    step = 8;
+  }
+  else if (FLASH_IF_VOLTAGE_RANGE == VoltageRange_3)
+  {
+    step = 4;
+  }
+  else if (FLASH_IF_VOLTAGE_RANGE == VoltageRange_2)
+  {
+    step = 2;
+  }
+  else
+  {
+    step = 1;
+  }
+#else
+  step = 4;
+#endif
+
+  /* Not an aligned data */
+  for (idx = Len; idx % step; idx++)
+  {
+    pbuf[idx] = 0xFF;
   }
   
-  /* Data received are Word multiple */
-  for (idx = 0; idx <  Len; idx = idx + 4)
+#if defined (STM32F4XX)
+  /* One program sequence for the whole buffer */
+  status = FLASH_ProgramBuffer(Add, pbuf, idx, FLASH_IF_VOLTAGE_RANGE);
+#else
+  for (idx = 0; (idx < Len) && (status == FLASH_COMPLETE); idx += step)
   {
-    FLASH_ProgramWord(Add, *(uint32_t *)(MAL_Buffer + idx));
-    Add += 4;
+#if defined (STM32F2XX) || defined (STM32F4XX)
+    if (step == 8)
+    {
+      /* The buffer is only word aligned */
+      status = FLASH_ProgramDoubleWord(Add, *(uint32_t *)(pbuf + idx) |
+                                          ((uint64_t)*(uint32_t *)(pbuf + idx + 4) << 32));
+    }
+    else if (step == 2)
+    {
+      status = FLASH_ProgramHalfWord(Add, *(uint16_t *)(pbuf + idx));
+    }
+    else if (step == 1)
+    {
+      status = FLASH_ProgramByte(Add, pbuf[idx]);
+    }
+    else
+#endif
+    {
+      status = FLASH_ProgramWord(Add, *(uint32_t *)(pbuf + idx));
+    }
+    Add += step;
   }
-  return MAL_OK;
+#endif /* STM32F4XX */
+
+  return (status == FLASH_COMPLETE) ? MAL_OK : MAL_FAIL;
 }
 
 /**
@@ -224,4 +316,20 @@ uint16_t FLASH_If_CheckAdd(uint32_t Add)
     return MAL_FAIL;
   }
 }
+
+#ifdef DFU_SKIP_UNCHANGED_ENABLED
+/**
+  * @brief  FLASH_If_CRC
+  *         CRC of a flash area, computed by the CRC unit.
+  * @param  Add: Start address of the area (word aligned).
+  * @param  Len: Size of the area (in bytes, multiple of 4).
+  * @retval CRC-32 of the area.
+  */
+uint32_t FLASH_If_CRC (uint32_t Add, uint32_t Len)
+{
+  CRC_ResetDR();
+  
+  return CRC_CalcBlockCRC((uint32_t *)Add, Len / 4);
+}
+#endif /* DFU_SKIP_UNCHANGED_ENABLED */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -61,6 +61,45 @@
 
 #define HID_REQ_SET_REPORT            0x09
 #define HID_REQ_GET_REPORT            0x01
+
+#ifdef HID_REPORT_FIFO_ENABLED
+/* Vendor report FIFO: USBD_HID_SendReport queues reports of up to
+   HID_FIFO_REPORT_SIZE bytes and each input report of HID_FIFO_PACKET_SIZE
+   bytes sent every (micro)frame carries HID_FIFO_BATCH of them */
+#ifndef HID_FIFO_REPORT_SIZE
+ #define HID_FIFO_REPORT_SIZE         16
+#endif
+#ifndef HID_FIFO_DEPTH
+ #define HID_FIFO_DEPTH               64
+#endif
+#ifndef HID_FIFO_PACKET_SIZE
+ #ifdef USE_USB_OTG_HS
+  #define HID_FIFO_PACKET_SIZE        1024
+ #else
+  #define HID_FIFO_PACKET_SIZE        64
+ #endif
+#endif
+
+#if (HID_FIFO_REPORT_SIZE > HID_FIFO_PACKET_SIZE)
+ #error "HID_FIFO_REPORT_SIZE must not exceed HID_FIFO_PACKET_SIZE"
+#elif (HID_FIFO_REPORT_SIZE == HID_FIFO_PACKET_SIZE)
+ /* One report per input report, sent from the FIFO */
+ #define HID_FIFO_BATCH               1
+#else
+ /* Input report: number of reports, then the reports */
+ #define HID_FIFO_BATCH               ((HID_FIFO_PACKET_SIZE - 1) / HID_FIFO_REPORT_SIZE)
+#endif
+
+/* wMaxPacketSize of the IN endpoint: a packet per (micro)frame with
+   bInterval 1, 1 ms at full speed and 125 us at high speed */
+#define HID_FIFO_EP_SIZE_FS           ((HID_FIFO_PACKET_SIZE > 64) ? 64 : HID_FIFO_PACKET_SIZE)
+#define HID_FIFO_EP_SIZE_HS           ((HID_FIFO_PACKET_SIZE > 1024) ? 1024 : HID_FIFO_PACKET_SIZE)
+
+#define HID_VENDOR_REPORT_DESC_SIZE   29
+#define HID_REPORT_DESC_SIZE          HID_VENDOR_REPORT_DESC_SIZE
+#else
+#define HID_REPORT_DESC_SIZE          HID_MOUSE_REPORT_DESC_SIZE
+#endif /* HID_REPORT_FIFO_ENABLED */
 /**
   * @}
   */ 
@@ -19,6 +19,8 @@
   *             - Usage Page : Generic Desktop
   *             - Usage : Joystick)
   *             - Collection : Application 
+  *             - With HID_REPORT_FIFO_ENABLED: a vendor defined input report
+  *               fed from a report FIFO, sent every (micro)frame
   *      
   * @note     In HS mode and when the DMA is used, all variables and data structures
   *           dealing with the DMA during the transaction process should be 32-bit aligned.
@@ -106,6 +108,16 @@ static uint8_t  USBD_HID_Setup (void  *pdev,
 static uint8_t  *USBD_HID_GetCfgDesc (uint8_t speed, uint16_t *length);
 
 static uint8_t  USBD_HID_DataIn (void  *pdev, uint8_t epnum);
+
+#ifdef HID_REPORT_FIFO_ENABLED
+static uint8_t  USBD_HID_SOF (void  *pdev);
+
+#ifdef USB_OTG_HS_CORE
+static uint8_t  *USBD_HID_GetOtherCfgDesc (uint8_t speed, uint16_t *length);
+#endif
+
+static void     USBD_HID_FifoSend (void  *pdev);
+#endif
 /**
   * @}
   */ 
@@ -123,12 +135,20 @@ USBD_Class_cb_TypeDef  USBD_HID_cb =
   NULL, /*EP0_RxReady*/
   USBD_HID_DataIn, /*DataIn*/
   NULL, /*DataOut*/
+#ifdef HID_REPORT_FIFO_ENABLED
+  USBD_HID_SOF, /*SOF */
+#else
   NULL, /*SOF */
+#endif
   NULL,
   NULL,      
   USBD_HID_GetCfgDesc,
 #ifdef USB_OTG_HS_CORE  
+#ifdef HID_REPORT_FIFO_ENABLED
+  USBD_HID_GetOtherCfgDesc, /* full speed endpoint size */
+#else
   USBD_HID_GetCfgDesc, /* use same config as per FS */
+#endif
 #endif  
 };
 
@@ -153,6 +173,32 @@ __ALIGN_BEGIN static uint32_t  USBD_HID_Protocol  __ALIGN_END = 0;
 #endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */  
 __ALIGN_BEGIN static uint32_t  USBD_HID_IdleState __ALIGN_END = 0;
 
+#ifdef HID_REPORT_FIFO_ENABLED
+/* Reports queued by USBD_HID_SendReport. A slot is released once the
+   input report carrying it has been read by the host */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */  
+__ALIGN_BEGIN static uint8_t  HID_Fifo[HID_FIFO_DEPTH][(HID_FIFO_REPORT_SIZE + 3) & ~3] __ALIGN_END ;
+static __IO uint32_t HID_FifoIn = 0;
+static __IO uint32_t HID_FifoOut = 0;
+
+#if (HID_FIFO_BATCH > 1)
+/* Input report being sent: count byte, then the reports */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */  
+__ALIGN_BEGIN static uint8_t  HID_FifoPacket[HID_FIFO_PACKET_SIZE] __ALIGN_END ;
+#endif
+
+/* Reports carried by the input report in flight, 0 when the EP is idle */
+static __IO uint32_t HID_FifoTxCount = 0;
+#endif /* HID_REPORT_FIFO_ENABLED */
+
 #ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
   #if defined ( __ICCARM__ ) /*!< IAR Compiler */
     #pragma data_alignment=4   
@@ -181,8 +227,13 @@ __ALIGN_BEGIN static uint8_t USBD_HID_CfgDesc[USB_HID_CONFIG_DESC_SIZ] __ALIGN_E
   0x00,         /*bAlternateSetting: Alternate setting*/
   0x01,         /*bNumEndpoints*/
   0x03,         /*bInterfaceClass: HID*/
+#ifdef HID_REPORT_FIFO_ENABLED
+  0x00,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
+  0x00,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
+#else
   0x01,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
   0x02,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
+#endif
   0,            /*iInterface: Index of string descriptor*/
   /******************** Descriptor of Joystick Mouse HID ********************/
   /* 18 */
@@ -193,7 +244,7 @@ __ALIGN_BEGIN static uint8_t USBD_HID_CfgDesc[USB_HID_CONFIG_DESC_SIZ] __ALIGN_E
   0x00,         /*bCountryCode: Hardware target country*/
   0x01,         /*bNumDescriptors: Number of HID class descriptors to follow*/
   0x22,         /*bDescriptorType*/
-  HID_MOUSE_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
+  HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
   0x00,
   /******************** Descriptor of Mouse endpoint ********************/
   /* 27 */
@@ -202,9 +253,15 @@ __ALIGN_BEGIN static uint8_t USBD_HID_CfgDesc[USB_HID_CONFIG_DESC_SIZ] __ALIGN_E
   
   HID_IN_EP,     /*bEndpointAddress: Endpoint Address (IN)*/
   0x03,          /*bmAttributes: Interrupt endpoint*/
+#ifdef HID_REPORT_FIFO_ENABLED
+  LOBYTE(HID_FIFO_EP_SIZE_FS), /*wMaxPacketSize: set for the speed by USBD_HID_GetCfgDesc */
+  HIBYTE(HID_FIFO_EP_SIZE_FS),
+  0x01,          /*bInterval: Polling Interval (1 ms FS, 125 us HS)*/
+#else
   HID_IN_PACKET, /*wMaxPacketSize: 4 Byte max */
   0x00,
   0x0A,          /*bInterval: Polling Interval (10 ms)*/
+#endif
   /* 34 */
 } ;
 
@@ -223,7 +280,7 @@ __ALIGN_BEGIN static uint8_t USBD_HID_Desc[USB_HID_DESC_SIZ] __ALIGN_END=
   0x00,         /*bCountryCode: Hardware target country*/
   0x01,         /*bNumDescriptors: Number of HID class descriptors to follow*/
   0x22,         /*bDescriptorType*/
-  HID_MOUSE_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
+  HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
   0x00,
 };
 #endif 
@@ -284,6 +341,30 @@ __ALIGN_BEGIN static uint8_t HID_MOUSE_ReportDesc[HID_MOUSE_REPORT_DESC_SIZE] __
   0x01,   0xc0
 }; 
 
+#ifdef HID_REPORT_FIFO_ENABLED
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */  
+__ALIGN_BEGIN static uint8_t HID_VENDOR_ReportDesc[HID_VENDOR_REPORT_DESC_SIZE] __ALIGN_END =
+{
+  0x06,   0x00,   0xFF,         /* Usage Page (Vendor Defined 0xFF00) */
+  0x09,   0x01,                 /* Usage (0x01) */
+  0xA1,   0x01,                 /* Collection (Application) */
+  0x09,   0x02,                 /*   Usage (0x02) */
+  0x15,   0x00,                 /*   Logical Minimum (0) */
+  0x26,   0xFF,   0x00,         /*   Logical Maximum (255) */
+  0x75,   0x08,                 /*   Report Size (8) */
+  0x96,   LOBYTE(HID_FIFO_PACKET_SIZE), HIBYTE(HID_FIFO_PACKET_SIZE), /* Report Count */
+  0x81,   0x02,                 /*   Input (Data, Variable, Absolute) */
+  0x09,   0x03,                 /*   Usage (0x03) */
+  0x96,   LOBYTE(HID_OUT_PACKET), HIBYTE(HID_OUT_PACKET), /* Report Count */
+  0x91,   0x02,                 /*   Output (Data, Variable, Absolute) */
+  0xC0                          /* End Collection */
+};
+#endif /* HID_REPORT_FIFO_ENABLED */
+
 /**
   * @}
   */ 
@@ -304,10 +385,22 @@ static uint8_t  USBD_HID_Init (void  *pdev,
 {
   
   /* Open EP IN */
+#ifdef HID_REPORT_FIFO_ENABLED
+  DCD_EP_Open(pdev,
+              HID_IN_EP,
+              (((USB_OTG_CORE_HANDLE*)pdev)->cfg.speed == USB_OTG_SPEED_HIGH) ?
+                HID_FIFO_EP_SIZE_HS : HID_FIFO_EP_SIZE_FS,
+              USB_OTG_EP_INT);
+
+  /* Reports queued before the configuration are dropped */
+  HID_FifoOut = HID_FifoIn;
+  HID_FifoTxCount = 0;
+#else
   DCD_EP_Open(pdev,
               HID_IN_EP,
               HID_IN_PACKET,
               USB_OTG_EP_INT);
+#endif
   
   /* Open EP OUT */
   DCD_EP_Open(pdev,
@@ -331,6 +424,9 @@ static uint8_t  USBD_HID_DeInit (void  *pdev,
   /* Close HID EPs */
   DCD_EP_Close (pdev , HID_IN_EP);
   DCD_EP_Close (pdev , HID_OUT_EP);
+#ifdef HID_REPORT_FIFO_ENABLED
+  HID_FifoTxCount = 0;
+#endif
   
   
   return USBD_OK;
@@ -388,8 +484,12 @@ static uint8_t  USBD_HID_Setup (void  *pdev,
     case USB_REQ_GET_DESCRIPTOR: 
       if( req->wValue >> 8 == HID_REPORT_DESC)
       {
-        len = MIN(HID_MOUSE_REPORT_DESC_SIZE , req->wLength);
+        len = MIN(HID_REPORT_DESC_SIZE , req->wLength);
+#ifdef HID_REPORT_FIFO_ENABLED
+        pbuf = HID_VENDOR_ReportDesc;
+#else
         pbuf = HID_MOUSE_ReportDesc;
+#endif
       }
       else if( req->wValue >> 8 == HID_DESCRIPTOR_TYPE)
       {
@@ -422,6 +522,121 @@ static uint8_t  USBD_HID_Setup (void  *pdev,
   return USBD_OK;
 }
 
+#ifdef HID_REPORT_FIFO_ENABLED
+/**
+  * @brief  USBD_HID_SendReport 
+  *         Queue a HID Report, sent with the next input reports. The FIFO
+  *         has a single producer: call it from one context only.
+  * @param  pdev: device instance
+  * @param  buff: pointer to report
+  * @param  len: report length, up to HID_FIFO_REPORT_SIZE (zero padded)
+  * @retval USBD_OK if queued, USBD_BUSY if the FIFO is full, USBD_FAIL if
+  *         the device is not configured or the report is too long
+  */
+uint8_t USBD_HID_SendReport     (USB_OTG_CORE_HANDLE  *pdev, 
+                                 uint8_t *report,
+                                 uint16_t len)
+{
+  uint32_t in = HID_FifoIn;
+  uint8_t  *slot;
+  uint32_t i;
+
+  if ((pdev->dev.device_status != USB_OTG_CONFIGURED) ||
+      (len > HID_FIFO_REPORT_SIZE))
+  {
+    return USBD_FAIL;
+  }
+
+  if (in - HID_FifoOut >= HID_FIFO_DEPTH)
+  {
+    return USBD_BUSY;
+  }
+
+  slot = HID_Fifo[in % HID_FIFO_DEPTH];
+  for (i = 0; i < len; i++)
+  {
+    slot[i] = report[i];
+  }
+  for (; i < HID_FIFO_REPORT_SIZE; i++)
+  {
+    slot[i] = 0;
+  }
+
+  /* Published to the IN transfers, started on the next SOF */
+  HID_FifoIn = in + 1;
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_HID_FifoSend 
+  *         Send the next input report if reports are queued: the oldest
+  *         one, or up to HID_FIFO_BATCH of them after a count byte.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void USBD_HID_FifoSend (void  *pdev)
+{
+  uint32_t out = HID_FifoOut;
+  uint32_t n = HID_FifoIn - out;
+#if (HID_FIFO_BATCH > 1)
+  uint8_t  *dst;
+  uint8_t  *src;
+  uint32_t i;
+  uint32_t k;
+#endif
+
+  if (n == 0)
+  {
+    return;
+  }
+
+#if (HID_FIFO_BATCH > 1)
+  if (n > HID_FIFO_BATCH)
+  {
+    n = HID_FIFO_BATCH;
+  }
+
+  HID_FifoPacket[0] = (uint8_t)n;
+  dst = HID_FifoPacket + 1;
+  for (k = 0; k < n; k++)
+  {
+    src = HID_Fifo[(out + k) % HID_FIFO_DEPTH];
+    for (i = 0; i < HID_FIFO_REPORT_SIZE; i++)
+    {
+      *dst++ = src[i];
+    }
+  }
+  while (dst < HID_FifoPacket + HID_FIFO_PACKET_SIZE)
+  {
+    *dst++ = 0;
+  }
+
+  HID_FifoTxCount = n;
+  DCD_EP_Tx (pdev, HID_IN_EP, HID_FifoPacket, HID_FIFO_PACKET_SIZE);
+#else
+  HID_FifoTxCount = 1;
+  DCD_EP_Tx (pdev, HID_IN_EP, HID_Fifo[out % HID_FIFO_DEPTH], HID_FIFO_PACKET_SIZE);
+#endif
+}
+
+/**
+  * @brief  USBD_HID_SOF 
+  *         Start the input reports when the endpoint is idle, DataIn
+  *         chains them while reports are queued
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_HID_SOF (void  *pdev)
+{
+  if ((HID_FifoTxCount == 0) &&
+      (((USB_OTG_CORE_HANDLE*)pdev)->dev.device_status == USB_OTG_CONFIGURED))
+  {
+    USBD_HID_FifoSend(pdev);
+  }
+  return USBD_OK;
+}
+#else
 /**
   * @brief  USBD_HID_SendReport 
   *         Send HID Report
@@ -439,6 +654,7 @@ uint8_t USBD_HID_SendReport     (USB_OTG_CORE_HANDLE  *pdev,
   }
   return USBD_OK;
 }
+#endif /* HID_REPORT_FIFO_ENABLED */
 
 /**
   * @brief  USBD_HID_GetCfgDesc 
@@ -449,10 +665,31 @@ uint8_t USBD_HID_SendReport     (USB_OTG_CORE_HANDLE  *pdev,
   */
 static uint8_t  *USBD_HID_GetCfgDesc (uint8_t speed, uint16_t *length)
 {
+#ifdef HID_REPORT_FIFO_ENABLED
+  /* Endpoint size for the speed: wMaxPacketSize at offset 31 */
+  uint16_t size = (speed == USB_OTG_SPEED_HIGH) ? HID_FIFO_EP_SIZE_HS : HID_FIFO_EP_SIZE_FS;
+
+  USBD_HID_CfgDesc[31] = LOBYTE(size);
+  USBD_HID_CfgDesc[32] = HIBYTE(size);
+#endif
   *length = sizeof (USBD_HID_CfgDesc);
   return USBD_HID_CfgDesc;
 }
 
+#if defined (HID_REPORT_FIFO_ENABLED) && defined (USB_OTG_HS_CORE)
+/**
+  * @brief  USBD_HID_GetOtherCfgDesc 
+  *         return the full speed configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_HID_GetOtherCfgDesc (uint8_t speed, uint16_t *length)
+{
+  return USBD_HID_GetCfgDesc (USB_OTG_SPEED_FULL, length);
+}
+#endif
+
 /**
   * @brief  USBD_HID_DataIn
   *         handle data IN Stage
@@ -467,6 +704,13 @@ static uint8_t  USBD_HID_DataIn (void  *pdev,
   /* Ensure that the FIFO is empty before a new transfer, this condition could 
   be caused by  a new transfer before the end of the previous transfer */
   DCD_EP_Flush(pdev, HID_IN_EP);
+
+#ifdef HID_REPORT_FIFO_ENABLED
+  /* Release the reports read by the host and send the next ones */
+  HID_FifoOut += HID_FifoTxCount;
+  HID_FifoTxCount = 0;
+  USBD_HID_FifoSend(pdev);
+#endif
   return USBD_OK;
 }
 
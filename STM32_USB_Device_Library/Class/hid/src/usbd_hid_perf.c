@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    usbd_hid_perf.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Throughput test of the HID class: the report FIFO is kept full
+  *          of HID_FIFO_REPORT_SIZE byte reports carrying the test pattern.
+  *          A run starts each time the device gets configured. The host
+  *          removes the count byte of the batched input reports (when
+  *          HID_FIFO_BATCH > 1) before checking the stream.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_hid_perf.h"
+
+#ifdef USBD_PERF_ENABLED
+
+#ifndef HID_REPORT_FIFO_ENABLED
+ #error "usbd_hid_perf.c needs HID_REPORT_FIFO_ENABLED"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t  PerfReport[HID_FIFO_REPORT_SIZE];
+static uint8_t  PerfConfigured = 0;
+
+/* Stream offset of the next report */
+static uint32_t PerfOff;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  HID_Perf_Pump
+  *         Queue pattern reports while the FIFO has room, called from the
+  *         main loop: USBD_Perf_Idle is called when the FIFO is full
+  * @param  pdev: device instance
+  * @retval None
+  */
+void HID_Perf_Pump (USB_OTG_CORE_HANDLE *pdev)
+{
+  uint8_t configured = (pdev->dev.device_status == USB_OTG_CONFIGURED);
+
+  if (configured != PerfConfigured)
+  {
+    PerfConfigured = configured;
+    if (configured)
+    {
+      PerfOff = 0;
+      USBD_Perf_Start(pdev);
+    }
+  }
+
+  if (configured)
+  {
+    USBD_Perf_Fill(PerfReport, sizeof(PerfReport), PerfOff);
+    if (USBD_HID_SendReport(pdev, PerfReport, sizeof(PerfReport)) == USBD_OK)
+    {
+      PerfOff += sizeof(PerfReport);
+      return;
+    }
+  }
+  USBD_Perf_Idle();
+}
+
+#endif /* USBD_PERF_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,188 @@
+/**
+  ******************************************************************************
+  * @file    usbd_midi_core.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   header file for the usbd_midi_core.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+
+#ifndef __USB_MIDI_CORE_H_
+#define __USB_MIDI_CORE_H_
+
+#include  "usbd_ioreq.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup usbd_midi
+  * @brief This file is the Header file for usbd_midi_core.c
+  * @{
+  */
+
+
+/** @defgroup usbd_midi_Exported_Defines
+  * @{
+  */
+#define USB_MIDI_CONFIG_DESC_SIZ               101
+#define USB_MIDI_MS_DESC_SIZ                   65
+
+/* Interfaces and endpoints */
+#ifndef MIDI_AC_ITF
+ #define MIDI_AC_ITF                           0x00
+#endif
+#ifndef MIDI_MS_ITF
+ #define MIDI_MS_ITF                           0x01
+#endif
+
+#ifndef MIDI_IN_EP
+ #define MIDI_IN_EP                            0x81
+#endif
+#ifndef MIDI_OUT_EP
+ #define MIDI_OUT_EP                           0x01
+#endif
+
+#ifndef MIDI_DATA_MAX_PACKET_SIZE
+ #ifdef USE_USB_OTG_HS
+  #define MIDI_DATA_MAX_PACKET_SIZE            512
+ #else
+  #define MIDI_DATA_MAX_PACKET_SIZE            64
+ #endif
+#endif
+
+/* Event packets queued for the IN endpoint, a power of 2 */
+#ifndef MIDI_TX_RING_SIZE
+ #define MIDI_TX_RING_SIZE                     512
+#endif
+
+/* Event packets sent in one IN transfer, at most MIDI_TX_RING_SIZE */
+#ifndef MIDI_TX_BATCH
+ #define MIDI_TX_BATCH                         (2 * MIDI_DATA_MAX_PACKET_SIZE / 4)
+#endif
+
+/* Latency bound: SOFs (frames, or microframes in high speed) an event packet
+   waits for more packets while the IN endpoint is idle */
+#ifndef MIDI_IN_LATENCY
+ #define MIDI_IN_LATENCY                       1
+#endif
+
+/*---------------------------------------------------------------------*/
+/*  MIDI definitions                                                   */
+/*---------------------------------------------------------------------*/
+#define MIDI_PACKET_SIZE                       4
+
+/* Code Index Numbers, low nibble of the first byte of an event packet */
+#define MIDI_CIN_MISC                          0x00
+#define MIDI_CIN_CABLE_EVENT                   0x01
+#define MIDI_CIN_SYSCOM_2                      0x02
+#define MIDI_CIN_SYSCOM_3                      0x03
+#define MIDI_CIN_SYSEX_START                   0x04
+#define MIDI_CIN_SYSEX_END_1                   0x05
+#define MIDI_CIN_SYSEX_END_2                   0x06
+#define MIDI_CIN_SYSEX_END_3                   0x07
+#define MIDI_CIN_NOTE_OFF                      0x08
+#define MIDI_CIN_NOTE_ON                       0x09
+#define MIDI_CIN_POLY_KEYPRESS                 0x0A
+#define MIDI_CIN_CONTROL_CHANGE                0x0B
+#define MIDI_CIN_PROGRAM_CHANGE                0x0C
+#define MIDI_CIN_CHANNEL_PRESSURE              0x0D
+#define MIDI_CIN_PITCH_BEND                    0x0E
+#define MIDI_CIN_SINGLE_BYTE                   0x0F
+
+/* Class-specific descriptor types and subtypes */
+#define MIDI_CS_INTERFACE                      0x24
+#define MIDI_CS_ENDPOINT                       0x25
+#define MIDI_MS_HEADER                         0x01
+#define MIDI_IN_JACK                           0x02
+#define MIDI_OUT_JACK                          0x03
+#define MIDI_MS_GENERAL                        0x01
+#define MIDI_JACK_EMBEDDED                     0x01
+#define MIDI_JACK_EXTERNAL                     0x02
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_midi_Exported_TypesDefinitions
+  * @{
+  */
+typedef struct _MIDI_IF_PROP
+{
+  uint16_t (*pIf_Init)     (void);
+  uint16_t (*pIf_DeInit)   (void);
+  /* Event packets received from the host (4 bytes each, padding removed),
+     called from the interrupt; the buffer is reused once it returns */
+  uint16_t (*pIf_Recv)     (uint8_t* Buf, uint32_t Count);
+}
+MIDI_IF_Prop_TypeDef;
+/**
+  * @}
+  */
+
+
+
+/** @defgroup usbd_midi_Exported_Macros
+  * @{
+  */
+/* First byte of an event packet */
+#define MIDI_HEADER(CABLE, CIN)                ((uint8_t)(((CABLE) << 4) | ((CIN) & 0x0F)))
+/**
+  * @}
+  */
+
+/** @defgroup usbd_midi_Exported_Variables
+  * @{
+  */
+
+extern USBD_Class_cb_TypeDef  USBD_MIDI_cb;
+/**
+  * @}
+  */
+
+/** @defgroup usbd_midi_Exported_Functions
+  * @{
+  */
+uint32_t USBD_MIDI_SendPackets (USB_OTG_CORE_HANDLE  *pdev,
+                                const uint8_t *pkts,
+                                uint32_t count);
+uint8_t  USBD_MIDI_SendMsg     (USB_OTG_CORE_HANDLE  *pdev,
+                                uint8_t cable,
+                                uint8_t status,
+                                uint8_t data1,
+                                uint8_t data2);
+uint32_t USBD_MIDI_TxFree      (void);
+/**
+  * @}
+  */
+
+#endif  // __USB_MIDI_CORE_H_
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
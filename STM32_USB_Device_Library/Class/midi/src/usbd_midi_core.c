@@ -0,0 +1,764 @@
+/**
+  ******************************************************************************
+  * @file    usbd_midi_core.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   This file provides the high layer firmware functions to manage the
+  *          following functionalities of the USB MIDI Class:
+  *           - Initialization and Configuration of high and low layer
+  *           - Enumeration as MIDI Streaming Device
+  *           - Event packet IN/OUT transfer, several packets per transfer
+  *           - Error management
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                MIDI Class Driver Description
+  *          ===================================================================
+  *           This driver manages the "Universal Serial Bus Device Class
+  *           Definition for MIDI Devices Release 1.0 November 1, 1999"
+  *           This driver implements the following aspects of the specification:
+  *             - Device descriptor management
+  *             - Configuration descriptor management
+  *             - Enumeration as MIDI device with one embedded IN jack and one
+  *               embedded OUT jack (one cable), each linked to an external
+  *               jack, on 2 bulk endpoints (IN and OUT)
+  *             - Event packets batched in the bulk transfers
+  *
+  *           @note
+  *             The event packets given to USBD_MIDI_SendPackets are queued in
+  *             a ring and sent straight from it: from the SOF handler, like
+  *             the CDC class, once MIDI_IN_LATENCY SOFs have elapsed or
+  *             MIDI_TX_BATCH packets are waiting, and back to back from the
+  *             transfer complete interrupt while the ring stays full. Event
+  *             rates far above the one packet per frame of an interrupt
+  *             endpoint (e.g. HID reports) go through in few transfers.
+  *             The same event packets can carry non MIDI sensor samples,
+  *             e.g. in SysEx packets or with a vendor specific cable.
+  *
+  *            This driver doesn't implement the following aspects of the specification:
+  *             - Several cables and element descriptors
+  *             - Transfer endpoints (bulk or interrupt) for the external jacks
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_midi_core.h"
+#include "usbd_desc.h"
+#include "usbd_req.h"
+
+#if ((MIDI_TX_RING_SIZE & (MIDI_TX_RING_SIZE - 1)) != 0)
+ #error "MIDI_TX_RING_SIZE must be a power of 2"
+#endif
+
+#if (MIDI_TX_BATCH > MIDI_TX_RING_SIZE)
+ #error "MIDI_TX_BATCH must not exceed MIDI_TX_RING_SIZE"
+#endif
+
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup usbd_midi
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup usbd_midi_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_midi_Private_Defines
+  * @{
+  */
+/* Jack IDs */
+#define MIDI_JACK_IN_EMB              0x01
+#define MIDI_JACK_IN_EXT              0x02
+#define MIDI_JACK_OUT_EMB             0x03
+#define MIDI_JACK_OUT_EXT             0x04
+
+/* IN endpoint state */
+#define MIDI_TX_IDLE                  0
+#define MIDI_TX_BUSY                  1
+#define MIDI_TX_ZLP                   2
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_midi_Private_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_midi_Private_FunctionPrototypes
+  * @{
+  */
+
+/*********************************************
+   MIDI Device library callbacks
+ *********************************************/
+static uint8_t  usbd_midi_Init        (void  *pdev, uint8_t cfgidx);
+static uint8_t  usbd_midi_DeInit      (void  *pdev, uint8_t cfgidx);
+static uint8_t  usbd_midi_Setup       (void  *pdev, USB_SETUP_REQ *req);
+static uint8_t  usbd_midi_DataIn      (void *pdev, uint8_t epnum);
+static uint8_t  usbd_midi_DataOut     (void *pdev, uint8_t epnum);
+static uint8_t  usbd_midi_SOF         (void *pdev);
+
+/*********************************************
+   MIDI specific management functions
+ *********************************************/
+static void     MIDI_TxStart          (void *pdev);
+static uint8_t  *USBD_midi_GetCfgDesc (uint8_t speed, uint16_t *length);
+#ifdef USB_OTG_HS_CORE
+static uint8_t  *USBD_midi_GetOtherCfgDesc (uint8_t speed, uint16_t *length);
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup usbd_midi_Private_Variables
+  * @{
+  */
+extern MIDI_IF_Prop_TypeDef  MIDI_APP_FOPS;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+/* Event packets sent straight from the ring: word aligned for the DMA */
+__ALIGN_BEGIN static uint32_t midiTxRing [MIDI_TX_RING_SIZE] __ALIGN_END ;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t midiRxBuff [MIDI_DATA_MAX_PACKET_SIZE] __ALIGN_END ;
+
+/* Free running counts of packets queued (application) and sent (USB) */
+static __IO uint32_t midiTxIn  = 0;
+static __IO uint32_t midiTxOut = 0;
+static uint32_t      midiTxLen = 0;     /* Packets on the bus */
+static uint32_t      midiTxAge = 0;     /* SOFs with packets waiting */
+static __IO uint8_t  midiTxState = MIDI_TX_IDLE;
+
+/* MIDI interface class callbacks structure */
+USBD_Class_cb_TypeDef  USBD_MIDI_cb =
+{
+  usbd_midi_Init,
+  usbd_midi_DeInit,
+  usbd_midi_Setup,
+  NULL,                 /* EP0_TxSent, */
+  NULL,                 /* EP0_RxReady, */
+  usbd_midi_DataIn,
+  usbd_midi_DataOut,
+  usbd_midi_SOF,
+  NULL,
+  NULL,
+  USBD_midi_GetCfgDesc,
+#ifdef USB_OTG_HS_CORE
+  USBD_midi_GetOtherCfgDesc,
+#endif /* USB_OTG_HS_CORE */
+};
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+/* USB MIDI device Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t usbd_midi_CfgDesc[USB_MIDI_CONFIG_DESC_SIZ]  __ALIGN_END =
+{
+  /*Configuration Descriptor*/
+  0x09,   /* bLength: Configuration Descriptor size */
+  USB_CONFIGURATION_DESCRIPTOR_TYPE,      /* bDescriptorType: Configuration */
+  USB_MIDI_CONFIG_DESC_SIZ,               /* wTotalLength:no of returned bytes */
+  0x00,
+  0x02,   /* bNumInterfaces: 2 interfaces */
+  0x01,   /* bConfigurationValue: Configuration value */
+  0x00,   /* iConfiguration: Index of string descriptor describing the configuration */
+  0xC0,   /* bmAttributes: self powered */
+  0x32,   /* MaxPower 100 mA */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Audio Control Interface Descriptor*/
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: Interface */
+  MIDI_AC_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x00,   /* bNumEndpoints: No endpoint */
+  0x01,   /* bInterfaceClass: Audio */
+  0x01,   /* bInterfaceSubClass: Audio Control */
+  0x00,   /* bInterfaceProtocol: */
+  0x00,   /* iInterface: */
+
+  /*Class-specific AC Interface Header Descriptor*/
+  0x09,   /* bLength */
+  MIDI_CS_INTERFACE,   /* bDescriptorType: CS_INTERFACE */
+  0x01,   /* bDescriptorSubtype: Header */
+  0x00,   /* bcdADC: 1.00 */
+  0x01,
+  0x09,   /* wTotalLength: this descriptor only */
+  0x00,
+  0x01,   /* bInCollection: 1 streaming interface */
+  MIDI_MS_ITF,   /* baInterfaceNr(1) */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*MIDI Streaming Interface Descriptor*/
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: Interface */
+  MIDI_MS_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x02,   /* bNumEndpoints: Two endpoints used */
+  0x01,   /* bInterfaceClass: Audio */
+  0x03,   /* bInterfaceSubClass: MIDI Streaming */
+  0x00,   /* bInterfaceProtocol: */
+  0x00,   /* iInterface: */
+
+  /*Class-specific MS Interface Header Descriptor*/
+  0x07,   /* bLength */
+  MIDI_CS_INTERFACE,   /* bDescriptorType: CS_INTERFACE */
+  MIDI_MS_HEADER,      /* bDescriptorSubtype: MS_HEADER */
+  0x00,   /* bcdMSC: 1.00 */
+  0x01,
+  LOBYTE(USB_MIDI_MS_DESC_SIZ),   /* wTotalLength: class-specific MS descriptors */
+  HIBYTE(USB_MIDI_MS_DESC_SIZ),
+
+  /*MIDI IN Jack Descriptor: embedded, fed by the OUT endpoint*/
+  0x06,   /* bLength */
+  MIDI_CS_INTERFACE,   /* bDescriptorType: CS_INTERFACE */
+  MIDI_IN_JACK,        /* bDescriptorSubtype: MIDI_IN_JACK */
+  MIDI_JACK_EMBEDDED,  /* bJackType */
+  MIDI_JACK_IN_EMB,    /* bJackID */
+  0x00,   /* iJack */
+
+  /*MIDI IN Jack Descriptor: external*/
+  0x06,   /* bLength */
+  MIDI_CS_INTERFACE,   /* bDescriptorType: CS_INTERFACE */
+  MIDI_IN_JACK,        /* bDescriptorSubtype: MIDI_IN_JACK */
+  MIDI_JACK_EXTERNAL,  /* bJackType */
+  MIDI_JACK_IN_EXT,    /* bJackID */
+  0x00,   /* iJack */
+
+  /*MIDI OUT Jack Descriptor: embedded, feeding the IN endpoint*/
+  0x09,   /* bLength */
+  MIDI_CS_INTERFACE,   /* bDescriptorType: CS_INTERFACE */
+  MIDI_OUT_JACK,       /* bDescriptorSubtype: MIDI_OUT_JACK */
+  MIDI_JACK_EMBEDDED,  /* bJackType */
+  MIDI_JACK_OUT_EMB,   /* bJackID */
+  0x01,   /* bNrInputPins */
+  MIDI_JACK_IN_EXT,    /* baSourceID(1) */
+  0x01,   /* baSourcePin(1) */
+  0x00,   /* iJack */
+
+  /*MIDI OUT Jack Descriptor: external*/
+  0x09,   /* bLength */
+  MIDI_CS_INTERFACE,   /* bDescriptorType: CS_INTERFACE */
+  MIDI_OUT_JACK,       /* bDescriptorSubtype: MIDI_OUT_JACK */
+  MIDI_JACK_EXTERNAL,  /* bJackType */
+  MIDI_JACK_OUT_EXT,   /* bJackID */
+  0x01,   /* bNrInputPins */
+  MIDI_JACK_IN_EMB,    /* baSourceID(1) */
+  0x01,   /* baSourcePin(1) */
+  0x00,   /* iJack */
+
+  /*Endpoint OUT Descriptor*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,       /* bDescriptorType: Endpoint */
+  MIDI_OUT_EP,                        /* bEndpointAddress */
+  0x02,                               /* bmAttributes: Bulk */
+  LOBYTE(MIDI_DATA_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(MIDI_DATA_MAX_PACKET_SIZE),
+  0x00,                               /* bInterval: ignore for Bulk transfer */
+  0x00,                               /* bRefresh */
+  0x00,                               /* bSynchAddress */
+
+  /*Class-specific MS Bulk OUT Endpoint Descriptor*/
+  0x05,   /* bLength */
+  MIDI_CS_ENDPOINT,    /* bDescriptorType: CS_ENDPOINT */
+  MIDI_MS_GENERAL,     /* bDescriptorSubtype: MS_GENERAL */
+  0x01,   /* bNumEmbMIDIJack */
+  MIDI_JACK_IN_EMB,    /* baAssocJackID(1) */
+
+  /*Endpoint IN Descriptor*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,       /* bDescriptorType: Endpoint */
+  MIDI_IN_EP,                         /* bEndpointAddress */
+  0x02,                               /* bmAttributes: Bulk */
+  LOBYTE(MIDI_DATA_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(MIDI_DATA_MAX_PACKET_SIZE),
+  0x00,                               /* bInterval: ignore for Bulk transfer */
+  0x00,                               /* bRefresh */
+  0x00,                               /* bSynchAddress */
+
+  /*Class-specific MS Bulk IN Endpoint Descriptor*/
+  0x05,   /* bLength */
+  MIDI_CS_ENDPOINT,    /* bDescriptorType: CS_ENDPOINT */
+  MIDI_MS_GENERAL,     /* bDescriptorSubtype: MS_GENERAL */
+  0x01,   /* bNumEmbMIDIJack */
+  MIDI_JACK_OUT_EMB    /* baAssocJackID(1) */
+} ;
+
+#ifdef USB_OTG_HS_CORE
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+/* Filled from usbd_midi_CfgDesc with full speed packets */
+__ALIGN_BEGIN static uint8_t usbd_midi_OtherCfgDesc[USB_MIDI_CONFIG_DESC_SIZ]  __ALIGN_END ;
+#endif /* USB_OTG_HS_CORE */
+
+/**
+  * @}
+  */
+
+/** @defgroup usbd_midi_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  usbd_midi_Init
+  *         Initilaize the MIDI interface
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  usbd_midi_Init (void  *pdev,
+                                uint8_t cfgidx)
+{
+  /* Open EP IN */
+  DCD_EP_Open(pdev,
+              MIDI_IN_EP,
+              MIDI_DATA_MAX_PACKET_SIZE,
+              USB_OTG_EP_BULK);
+
+  /* Open EP OUT */
+  DCD_EP_Open(pdev,
+              MIDI_OUT_EP,
+              MIDI_DATA_MAX_PACKET_SIZE,
+              USB_OTG_EP_BULK);
+
+  /* Nothing on the bus: packets queued before the configuration go first */
+  midiTxLen   = 0;
+  midiTxAge   = 0;
+  midiTxState = MIDI_TX_IDLE;
+
+  /* Initialize the Interface physical components */
+  MIDI_APP_FOPS.pIf_Init();
+
+  /* Prepare Out endpoint to receive next packet */
+  DCD_EP_PrepareRx(pdev,
+                   MIDI_OUT_EP,
+                   (uint8_t*)(midiRxBuff),
+                   MIDI_DATA_MAX_PACKET_SIZE);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_midi_DeInit
+  *         DeInitialize the MIDI layer
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  usbd_midi_DeInit (void  *pdev,
+                                  uint8_t cfgidx)
+{
+  /* Close EP IN */
+  DCD_EP_Close(pdev,
+              MIDI_IN_EP);
+
+  /* Close EP OUT */
+  DCD_EP_Close(pdev,
+              MIDI_OUT_EP);
+
+  /* The packets on the bus are lost, the queued ones are kept */
+  midiTxLen   = 0;
+  midiTxState = MIDI_TX_IDLE;
+
+  /* Restore default state of the Interface physical components */
+  MIDI_APP_FOPS.pIf_DeInit();
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_midi_Setup
+  *         Handle the MIDI specific requests
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  usbd_midi_Setup (void  *pdev,
+                                 USB_SETUP_REQ *req)
+{
+  static uint8_t midiAltSet = 0;
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
+  {
+    /* Standard Requests -------------------------------*/
+  case USB_REQ_TYPE_STANDARD:
+    switch (req->bRequest)
+    {
+    case USB_REQ_GET_INTERFACE :
+      USBD_CtlSendData (pdev,
+                        &midiAltSet,
+                        1);
+      break;
+
+    case USB_REQ_SET_INTERFACE :
+      if ((uint8_t)(req->wValue) != 0)
+      {
+        /* Call the error management function (command will be nacked */
+        USBD_CtlError (pdev, req);
+      }
+      break;
+    }
+    return USBD_OK;
+
+    /* No class request: the audio control interface has no unit */
+  default:
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
+  }
+}
+
+/**
+  * @brief  usbd_midi_DataIn
+  *         Data sent on non-control IN endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  usbd_midi_DataIn (void *pdev, uint8_t epnum)
+{
+  uint32_t pending;
+
+  if (midiTxState == MIDI_TX_BUSY)
+  {
+    midiTxOut += midiTxLen;
+
+    /* A transfer of full packets is ended by a short packet or a ZLP */
+    if (((midiTxLen * MIDI_PACKET_SIZE) %
+         ((USB_OTG_CORE_HANDLE*)pdev)->dev.in_ep[MIDI_IN_EP & 0x7F].maxpacket) == 0)
+    {
+      midiTxLen   = 0;
+      midiTxState = MIDI_TX_ZLP;
+      DCD_EP_Tx (pdev, MIDI_IN_EP, NULL, 0);
+      return USBD_OK;
+    }
+  }
+
+  midiTxLen   = 0;
+  midiTxState = MIDI_TX_IDLE;
+
+  /* Back to back transfers while a batch is waiting, or once the packets
+     left over by the last transfer are late */
+  pending = midiTxIn - midiTxOut;
+  if ((pending >= MIDI_TX_BATCH) ||
+      ((pending != 0) && (midiTxAge >= MIDI_IN_LATENCY)))
+  {
+    MIDI_TxStart(pdev);
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_midi_DataOut
+  *         Data received on non-control Out endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  usbd_midi_DataOut (void *pdev, uint8_t epnum)
+{
+  uint32_t count, idx, kept = 0;
+
+  /* Get the received data buffer and update the counter */
+  count = ((USB_OTG_CORE_HANDLE*)pdev)->dev.out_ep[epnum].xfer_count / MIDI_PACKET_SIZE;
+
+  /* Drop the zero padding packets some hosts add */
+  for (idx = 0; idx < count; idx++)
+  {
+    if (((uint32_t *)midiRxBuff)[idx] != 0)
+    {
+      ((uint32_t *)midiRxBuff)[kept++] = ((uint32_t *)midiRxBuff)[idx];
+    }
+  }
+
+  if (kept != 0)
+  {
+    MIDI_APP_FOPS.pIf_Recv(midiRxBuff, kept);
+  }
+
+  /* Prepare Out endpoint to receive next packet */
+  DCD_EP_PrepareRx(pdev,
+                   MIDI_OUT_EP,
+                   (uint8_t*)(midiRxBuff),
+                   MIDI_DATA_MAX_PACKET_SIZE);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_midi_SOF
+  *         Start Of Frame event management: age of the waiting packets and
+  *         start of the IN transfers
+  * @param  pdev: instance
+  * @retval status
+  */
+static uint8_t  usbd_midi_SOF (void *pdev)
+{
+  uint32_t pending;
+
+  pending = midiTxIn - midiTxOut;
+  if (pending == 0)
+  {
+    midiTxAge = 0;
+    return USBD_OK;
+  }
+
+  if (midiTxAge < MIDI_IN_LATENCY)
+  {
+    midiTxAge++;
+  }
+
+  if ((midiTxState == MIDI_TX_IDLE) &&
+      ((pending >= MIDI_TX_BATCH) || (midiTxAge >= MIDI_IN_LATENCY)))
+  {
+    MIDI_TxStart(pdev);
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  MIDI_TxStart
+  *         Send the waiting packets, up to MIDI_TX_BATCH and to the end of
+  *         the ring, straight from the ring
+  * @param  pdev: instance
+  * @retval None
+  */
+static void  MIDI_TxStart (void *pdev)
+{
+  uint32_t out = midiTxOut;
+  uint32_t len;
+
+  len = midiTxIn - out;
+  if (len > MIDI_TX_BATCH)
+  {
+    len = MIDI_TX_BATCH;
+  }
+  if (len > (MIDI_TX_RING_SIZE - (out % MIDI_TX_RING_SIZE)))
+  {
+    /* Rollback: the remainder follows */
+    len = MIDI_TX_RING_SIZE - (out % MIDI_TX_RING_SIZE);
+  }
+
+  /* The packets left behind keep their age */
+  if ((midiTxIn - out) == len)
+  {
+    midiTxAge = 0;
+  }
+
+  midiTxLen   = len;
+  midiTxState = MIDI_TX_BUSY;
+
+  DCD_EP_Tx (pdev,
+             MIDI_IN_EP,
+             (uint8_t*)&midiTxRing[out % MIDI_TX_RING_SIZE],
+             len * MIDI_PACKET_SIZE);
+}
+
+/**
+  * @brief  USBD_MIDI_SendPackets
+  *         Queue event packets for the IN endpoint. To be called from a
+  *         single thread or interrupt; the packets are sent within
+  *         MIDI_IN_LATENCY SOFs.
+  * @param  pdev: device instance
+  * @param  pkts: event packets, 4 bytes each
+  * @param  count: number of packets
+  * @retval number of packets queued, less than count when the ring is full
+  */
+uint32_t  USBD_MIDI_SendPackets (USB_OTG_CORE_HANDLE  *pdev,
+                                 const uint8_t *pkts,
+                                 uint32_t count)
+{
+  uint32_t in = midiTxIn;
+  uint32_t idx;
+
+  if (pdev->dev.device_status != USB_OTG_CONFIGURED)
+  {
+    return 0;
+  }
+
+  if (count > (MIDI_TX_RING_SIZE - (in - midiTxOut)))
+  {
+    count = MIDI_TX_RING_SIZE - (in - midiTxOut);
+  }
+
+  for (idx = 0; idx < count; idx++, pkts += MIDI_PACKET_SIZE)
+  {
+    midiTxRing[(in + idx) % MIDI_TX_RING_SIZE] = (uint32_t)pkts[0] |
+                                                 ((uint32_t)pkts[1] << 8) |
+                                                 ((uint32_t)pkts[2] << 16) |
+                                                 ((uint32_t)pkts[3] << 24);
+  }
+
+  /* Published to the SOF handler once written */
+  __DMB();
+  midiTxIn = in + count;
+
+  return count;
+}
+
+/**
+  * @brief  USBD_MIDI_SendMsg
+  *         Queue a channel voice or system real-time message, the code
+  *         index number is taken from the status byte
+  * @param  pdev: device instance
+  * @param  cable: cable number
+  * @param  status: status byte (0x80 to 0xEF, or 0xF8 to 0xFF)
+  * @param  data1: first data byte
+  * @param  data2: second data byte
+  * @retval USBD_OK if queued, USBD_BUSY if the ring is full, USBD_FAIL for
+  *         other status bytes (to be sent with USBD_MIDI_SendPackets)
+  */
+uint8_t  USBD_MIDI_SendMsg (USB_OTG_CORE_HANDLE  *pdev,
+                            uint8_t cable,
+                            uint8_t status,
+                            uint8_t data1,
+                            uint8_t data2)
+{
+  uint8_t pkt[MIDI_PACKET_SIZE];
+
+  if ((status >= 0x80) && (status < 0xF0))
+  {
+    pkt[0] = MIDI_HEADER(cable, status >> 4);
+  }
+  else if (status >= 0xF8)
+  {
+    pkt[0] = MIDI_HEADER(cable, MIDI_CIN_SINGLE_BYTE);
+    data1  = 0;
+    data2  = 0;
+  }
+  else
+  {
+    return USBD_FAIL;
+  }
+
+  pkt[1] = status;
+  pkt[2] = data1;
+  pkt[3] = data2;
+
+  return (USBD_MIDI_SendPackets(pdev, pkt, 1) == 1) ? USBD_OK : USBD_BUSY;
+}
+
+/**
+  * @brief  USBD_MIDI_TxFree
+  *         Room left in the IN ring
+  * @param  None
+  * @retval number of event packets USBD_MIDI_SendPackets can queue
+  */
+uint32_t  USBD_MIDI_TxFree (void)
+{
+  return MIDI_TX_RING_SIZE - (midiTxIn - midiTxOut);
+}
+
+/**
+  * @brief  USBD_midi_GetCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_midi_GetCfgDesc (uint8_t speed, uint16_t *length)
+{
+  *length = sizeof (usbd_midi_CfgDesc);
+  return usbd_midi_CfgDesc;
+}
+
+#ifdef USB_OTG_HS_CORE
+/**
+  * @brief  USBD_midi_GetOtherCfgDesc
+  *         Return other speed configuration descriptor: the configuration
+  *         descriptor with full speed packets
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_midi_GetOtherCfgDesc (uint8_t speed, uint16_t *length)
+{
+  uint32_t idx;
+
+  for (idx = 0; idx < USB_MIDI_CONFIG_DESC_SIZ; idx++)
+  {
+    usbd_midi_OtherCfgDesc[idx] = usbd_midi_CfgDesc[idx];
+  }
+  usbd_midi_OtherCfgDesc[1] = USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION;
+
+  /* wMaxPacketSize of each endpoint descriptor */
+  for (idx = 0; idx < USB_MIDI_CONFIG_DESC_SIZ; idx += usbd_midi_OtherCfgDesc[idx])
+  {
+    if (usbd_midi_OtherCfgDesc[idx + 1] == USB_ENDPOINT_DESCRIPTOR_TYPE)
+    {
+      usbd_midi_OtherCfgDesc[idx + 4] = 0x40;
+      usbd_midi_OtherCfgDesc[idx + 5] = 0x00;
+    }
+  }
+
+  *length = sizeof (usbd_midi_OtherCfgDesc);
+  return usbd_midi_OtherCfgDesc;
+}
+#endif
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * @file    usbd_midi_if_template.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Application interface layer of the MIDI class.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_midi_if_template.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t TEMPLATE_Init     (void);
+static uint16_t TEMPLATE_DeInit   (void);
+static uint16_t TEMPLATE_Recv     (uint8_t* Buf, uint32_t Count);
+
+MIDI_IF_Prop_TypeDef TEMPLATE_fops =
+{
+  TEMPLATE_Init,
+  TEMPLATE_DeInit,
+  TEMPLATE_Recv
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  TEMPLATE_Init
+  *         Initializes the MIDI interface
+  * @param  None
+  * @retval Result of the opeartion: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static uint16_t TEMPLATE_Init(void)
+{
+  /*
+     Add your initialization code here
+  */
+  return USBD_OK;
+}
+
+/**
+  * @brief  TEMPLATE_DeInit
+  *         DeInitializes the MIDI interface
+  * @param  None
+  * @retval Result of the opeartion: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static uint16_t TEMPLATE_DeInit(void)
+{
+  /*
+     Add your deinitialization code here
+  */
+  return USBD_OK;
+}
+
+/**
+  * @brief  TEMPLATE_Recv
+  *         Event packets received from the host, from the interrupt
+  * @param  Buf: event packets, 4 bytes each
+  * @param  Count: number of packets
+  * @retval Result of the opeartion: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static uint16_t TEMPLATE_Recv (uint8_t* Buf, uint32_t Count)
+{
+  uint32_t idx;
+
+  for (idx = 0; idx < Count; idx++, Buf += MIDI_PACKET_SIZE)
+  {
+    switch (Buf[0] & 0x0F)
+    {
+    case MIDI_CIN_NOTE_ON:
+      /* Channel: Buf[1] & 0x0F, note: Buf[2], velocity: Buf[3] */
+      break;
+
+    case MIDI_CIN_NOTE_OFF:
+      /* Add your code here */
+      break;
+
+    case MIDI_CIN_CONTROL_CHANGE:
+      /* Controller: Buf[2], value: Buf[3] */
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  return USBD_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
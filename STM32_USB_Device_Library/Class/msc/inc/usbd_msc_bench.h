@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    usbd_msc_bench.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Header file for the usbd_storage_bench.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_MSC_BENCH_H
+#define __USBD_MSC_BENCH_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc_mem.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup MSC_BENCH
+  * @brief Header file for the usbd_storage_bench.c file
+  * @{
+  */
+
+
+/** @defgroup MSC_BENCH_Exported_Defines
+  * @{
+  */
+#ifdef MSC_BENCH_ENABLED
+
+/* Geometry of the synthetic medium */
+#ifndef MSC_BENCH_BLK_SIZE
+ #define MSC_BENCH_BLK_SIZE           512
+#endif
+
+#ifndef MSC_BENCH_BLK_NBR
+ #define MSC_BENCH_BLK_NBR            0x200000          /* 1 GB */
+#endif
+
+/* Histogram bins: bin n counts the commands of 2^n to 2^(n+1)-1 cycles */
+#ifndef MSC_BENCH_HIST_BINS
+ #define MSC_BENCH_HIST_BINS          32
+#endif
+
+/* Command classes */
+#define MSC_BENCH_READ                0
+#define MSC_BENCH_WRITE               1
+#define MSC_BENCH_OTHER               2
+#define MSC_BENCH_CLASSES             3
+
+#endif /* MSC_BENCH_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup MSC_BENCH_Exported_TypesDefinitions
+  * @{
+  */
+#ifdef MSC_BENCH_ENABLED
+/* Statistics of a command class, in DWT cycles. The USB time of a command
+   is its total time minus its media time. */
+typedef struct _MSC_Bench_Stat
+{
+  uint32_t count;
+  uint32_t bytes;
+  uint64_t total;
+  uint64_t media;
+  uint32_t min;
+  uint32_t max;
+  uint32_t hist[MSC_BENCH_HIST_BINS];
+}
+MSC_Bench_Stat_TypeDef;
+#endif
+/**
+  * @}
+  */
+
+
+/** @defgroup MSC_BENCH_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup MSC_BENCH_Exported_Variables
+  * @{
+  */
+#ifdef MSC_BENCH_ENABLED
+extern USBD_STORAGE_cb_TypeDef  USBD_BENCH_fops;
+extern MSC_Bench_Stat_TypeDef   MSC_Bench_Stat[MSC_BENCH_CLASSES];
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup MSC_BENCH_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef MSC_BENCH_ENABLED
+void MSC_Bench_Reset (void);
+void MSC_Bench_CmdStart (uint8_t opcode);
+void MSC_Bench_CmdEnd (void);
+void MSC_Bench_Report (void (*Write)(uint8_t *buf, uint32_t len));
+#endif
+/**
+  * @}
+  */
+
+#endif /* __USBD_MSC_BENCH_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
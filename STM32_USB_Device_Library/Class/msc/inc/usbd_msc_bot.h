@@ -72,6 +72,14 @@
 #define DIR_OUT                       1
 #define BOTH_DIR                      2
 
+/* Number of MSC_MEDIA_PACKET buffers of MSC_BOT_Data: with two or more, the
+   READ10/WRITE10 data stages overlap the media accesses with the USB
+   transfers. 1 keeps a single buffer. MSC_BOT_Data is the pool of the
+   logical units without their own (see SCSI_SetLunPool). */
+#ifndef MSC_BOT_DATA_BUF_NUM
+ #define MSC_BOT_DATA_BUF_NUM         2
+#endif
+
 /**
   * @}
   */ 
@@ -126,6 +134,9 @@ extern MSC_BOT_CSW_TypeDef  MSC_BOT_csw;
 void MSC_BOT_Init (USB_OTG_CORE_HANDLE  *pdev);
 void MSC_BOT_Reset (USB_OTG_CORE_HANDLE  *pdev);
 void MSC_BOT_DeInit (USB_OTG_CORE_HANDLE  *pdev);
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+void MSC_BOT_Resume (USB_OTG_CORE_HANDLE  *pdev);
+#endif
 void MSC_BOT_DataIn (USB_OTG_CORE_HANDLE  *pdev, 
                      uint8_t epnum);
 
@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    usbd_msc_cache.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Header file for the usbd_msc_cache.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_MSC_CACHE_H
+#define __USBD_MSC_CACHE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc_mem.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+  
+/** @defgroup MSC_CACHE
+  * @brief Header file for the usbd_msc_cache.c file
+  * @{
+  */ 
+
+
+/** @defgroup MSC_CACHE_Exported_Defines
+  * @{
+  */ 
+#ifdef MSC_CACHE_ENABLED
+
+/* Size of a cache line: the erase block of the media. A line holds at most
+   32 media blocks. */
+#ifndef MSC_CACHE_LINE_SIZE
+ #define MSC_CACHE_LINE_SIZE          4096
+#endif
+
+#ifndef MSC_CACHE_LINES
+ #define MSC_CACHE_LINES              4
+#endif
+
+/* Dirty lines are written back after this number of SOF without command
+   (1 ms periods at full speed, 125 us at high speed) */
+#ifndef MSC_CACHE_IDLE_SOF
+ #define MSC_CACHE_IDLE_SOF           1000
+#endif
+
+#endif /* MSC_CACHE_ENABLED */
+/**
+  * @}
+  */ 
+
+
+/** @defgroup MSC_CACHE_Exported_TypesDefinitions
+  * @{
+  */
+#ifdef MSC_CACHE_ENABLED
+typedef struct _MSC_Cache_Line
+{
+  uint32_t blk_addr;            /* first block of the line */
+  uint32_t valid;               /* one bit per block */
+  uint32_t dirty;
+  uint32_t stamp;               /* last access, for the LRU replacement */
+  uint32_t blk_size;
+  uint8_t  lun;
+  uint8_t  used;
+}
+MSC_Cache_Line_TypeDef;
+#endif
+/**
+  * @}
+  */ 
+
+
+/** @defgroup MSC_CACHE_Exported_Macros
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+/** @defgroup MSC_CACHE_Exported_Variables
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+/** @defgroup MSC_CACHE_Exported_FunctionsPrototype
+  * @{
+  */ 
+#ifdef MSC_CACHE_ENABLED
+void   MSC_Cache_Init (void);
+int8_t MSC_Cache_Read (uint8_t lun, 
+                       uint8_t *buf, 
+                       uint32_t blk_addr, 
+                       uint16_t blk_len,
+                       uint32_t blk_size);
+int8_t MSC_Cache_Write (uint8_t lun, 
+                        uint8_t *buf, 
+                        uint32_t blk_addr, 
+                        uint16_t blk_len,
+                        uint32_t blk_size);
+int8_t MSC_Cache_Flush (void);
+void   MSC_Cache_Discard (uint8_t lun, uint32_t blk_addr, uint32_t blk_len);
+void   MSC_Cache_SOF (void);
+#endif
+/**
+  * @}
+  */ 
+
+#endif /* __USBD_MSC_CACHE_H */
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
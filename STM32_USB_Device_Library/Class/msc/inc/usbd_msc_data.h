@@ -48,6 +48,7 @@
 #define MODE_SENSE6_LEN			 8
 #define MODE_SENSE10_LEN		 8
 #define LENGTH_INQUIRY_PAGE00		 7
+#define LENGTH_INQUIRY_PAGE00_UNMAP	 9
 #define LENGTH_FORMAT_CAPACITIES    	20
 
 /**
@@ -76,6 +77,7 @@
   * @{
   */ 
 extern const uint8_t MSC_Page00_Inquiry_Data[];  
+extern const uint8_t MSC_Page00_Unmap_Inquiry_Data[];
 extern const uint8_t MSC_Mode_Sense6_data[];
 extern const uint8_t MSC_Mode_Sense10_data[] ;
 
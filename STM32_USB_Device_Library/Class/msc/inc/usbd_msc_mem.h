@@ -65,6 +65,17 @@ typedef struct _USBD_STORAGE
   int8_t (* Write)(uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len);
   int8_t (* GetMaxLun)(void);
   int8_t *pInquiry;
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  /* Optional: start the access and return, USBD_STORAGE_Complete is called
+     at the end. NULL uses Read/Write. */
+  int8_t (* ReadAsync) (uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len);
+  int8_t (* WriteAsync)(uint8_t lun, uint8_t *buf, uint32_t blk_addr, uint16_t blk_len);
+#endif
+#ifdef MSC_UNMAP_ENABLED
+  /* Optional: release blk_len blocks (UNMAP, WRITE SAME of zeros), which
+     read back as zeros until written again. NULL: not supported. */
+  int8_t (* Unmap)(uint8_t lun, uint32_t blk_addr, uint32_t blk_len);
+#endif
   
 }USBD_STORAGE_cb_TypeDef;
 /**
@@ -93,6 +104,10 @@ typedef struct _USBD_STORAGE
   * @{
   */ 
 extern USBD_STORAGE_cb_TypeDef *USBD_STORAGE_fops;
+
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+void USBD_STORAGE_Complete (uint8_t lun, int8_t status);
+#endif
 /**
   * @}
   */ 
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    usbd_msc_nand.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Header file for the usbd_storage_nand.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_MSC_NAND_H
+#define __USBD_MSC_NAND_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc_mem.h"
+
+#ifdef MSC_NAND_ENABLED
+#ifdef STM32F2XX
+ #include "stm32f2xx_nand_ftl.h"
+#elif defined(STM32F4XX)
+ #include "stm32f4xx_nand_ftl.h"
+#else
+ #error "The NAND FTL needs the FSMC NAND banks of the STM32F2xx/F4xx"
+#endif /* STM32F2XX */
+#endif /* MSC_NAND_ENABLED */
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup MSC_NAND
+  * @brief Header file for the usbd_storage_nand.c file
+  * @{
+  */
+
+
+/** @defgroup MSC_NAND_Exported_Defines
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup MSC_NAND_Exported_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup MSC_NAND_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup MSC_NAND_Exported_Variables
+  * @{
+  */
+#ifdef MSC_NAND_ENABLED
+extern USBD_STORAGE_cb_TypeDef  USBD_NAND_fops;
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup MSC_NAND_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef MSC_NAND_ENABLED
+void MSC_NAND_Attach (NAND_FTL_TypeDef *ftl);
+#endif
+/**
+  * @}
+  */
+
+#endif /* __USBD_MSC_NAND_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -47,6 +47,11 @@
 
 #define SENSE_LIST_DEEPTH                          4
 
+/* Number of logical units handled by the SCSI layer */
+#ifndef MSC_MAX_LUN
+ #define MSC_MAX_LUN                               2
+#endif
+
 /* SCSI Commands */
 #define SCSI_FORMAT_UNIT                            0x04
 #define SCSI_INQUIRY                                0x12
@@ -70,13 +75,19 @@
 #define SCSI_WRITE10                                0x2A
 #define SCSI_WRITE12                                0xAA
 #define SCSI_WRITE16                                0x8A
+#define SCSI_WRITE_SAME10                           0x41
+#define SCSI_WRITE_SAME16                           0x93
+#define SCSI_UNMAP                                  0x42
 
 #define SCSI_VERIFY10                               0x2F
 #define SCSI_VERIFY12                               0xAF
 #define SCSI_VERIFY16                               0x8F
 
 #define SCSI_SEND_DIAGNOSTIC                        0x1D
+#define SCSI_SYNCHRONIZE_CACHE10                    0x35
+#define SCSI_SYNCHRONIZE_CACHE16                    0x91
 #define SCSI_READ_FORMAT_CAPACITIES                 0x23
+#define SCSI_REPORT_LUNS                            0xA0
 
 #define NO_SENSE                                    0
 #define RECOVERED_ERROR                             1
@@ -107,12 +118,20 @@
 
 #define READ_FORMAT_CAPACITY_DATA_LEN               0x0C
 #define READ_CAPACITY10_DATA_LEN                    0x08
+#define READ_CAPACITY16_DATA_LEN                    0x20
 #define MODE_SENSE10_DATA_LEN                       0x08
 #define MODE_SENSE6_DATA_LEN                        0x04
 #define REQUEST_SENSE_DATA_LEN                      0x12
 #define STANDARD_INQUIRY_DATA_LEN                   0x24
+#define INQUIRY_BLOCK_LIMITS_DATA_LEN               0x40
+#define INQUIRY_PROVISIONING_DATA_LEN               0x08
 #define BLKVFY                                      0x04
 
+/* Max. number of blocks of a WRITE SAME command */
+#ifndef MSC_WRITE_SAME_MAX_BLKS
+ #define MSC_WRITE_SAME_MAX_BLKS                    0xFFFF
+#endif
+
 extern  uint8_t Page00_Inquiry_Data[];
 extern  uint8_t Standard_Inquiry_Data[];
 extern  uint8_t Standard_Inquiry_Data2[];
@@ -141,6 +160,17 @@ typedef struct _SENSE_ITEM {
     char *pData;
   } w;
 } SCSI_Sense_TypeDef; 
+
+/* Logical unit context: geometry reported by GetCapacity and pool of
+   buf_num data stage buffers of packet bytes each */
+typedef struct _SCSI_LUN
+{
+  uint8_t   *buf;
+  uint32_t  packet;
+  uint8_t   buf_num;
+  uint32_t  blk_size;
+  uint32_t  blk_nbr;
+} SCSI_Lun_TypeDef;
 /**
   * @}
   */ 
@@ -159,6 +189,9 @@ typedef struct _SENSE_ITEM {
 extern SCSI_Sense_TypeDef     SCSI_Sense [SENSE_LIST_DEEPTH]; 
 extern uint8_t   SCSI_Sense_Head;
 extern uint8_t   SCSI_Sense_Tail;
+extern SCSI_Lun_TypeDef  SCSI_Lun[MSC_MAX_LUN];
+
+extern void (*SCSI_StatusCb)(USB_OTG_CORE_HANDLE  *pdev, uint8_t status);
 
 /**
   * @}
@@ -170,10 +203,18 @@ int8_t SCSI_ProcessCmd(USB_OTG_CORE_HANDLE  *pdev,
                            uint8_t lun, 
                            uint8_t *cmd);
 
+#ifdef MSC_READ_AHEAD_ENABLED
+void   SCSI_ReadAhead(void);
+#endif
 void   SCSI_SenseCode(uint8_t lun, 
                     uint8_t sKey, 
                     uint8_t ASC);
 
+int8_t SCSI_SetLunPool(uint8_t lun, 
+                       uint8_t *buf, 
+                       uint32_t packet, 
+                       uint8_t buf_num);
+
 /**
   * @}
   */ 
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    usbd_msc_spinor.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Header file for the usbd_storage_spinor.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_MSC_SPINOR_H
+#define __USBD_MSC_SPINOR_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc_mem.h"
+
+#ifdef MSC_SPI_NOR_ENABLED
+#ifdef STM32F4XX
+ #include "stm32f4xx_spi_nor.h"
+#else
+ #error "The SPI NOR flash driver is part of the STM32F4xx standard peripheral library"
+#endif /* STM32F4XX */
+#endif /* MSC_SPI_NOR_ENABLED */
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup MSC_SPI_NOR
+  * @brief Header file for the usbd_storage_spinor.c file
+  * @{
+  */
+
+
+/** @defgroup MSC_SPI_NOR_Exported_Defines
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup MSC_SPI_NOR_Exported_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup MSC_SPI_NOR_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup MSC_SPI_NOR_Exported_Variables
+  * @{
+  */
+#ifdef MSC_SPI_NOR_ENABLED
+extern USBD_STORAGE_cb_TypeDef  USBD_SPI_NOR_fops;
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup MSC_SPI_NOR_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef MSC_SPI_NOR_ENABLED
+void MSC_SPI_NOR_Attach (SPI_NOR_TypeDef *nor);
+#endif
+/**
+  * @}
+  */
+
+#endif /* __USBD_MSC_SPINOR_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -30,6 +30,8 @@
 #include "usbd_msc_scsi.h"
 #include "usbd_ioreq.h"
 #include "usbd_msc_mem.h"
+#include "usbd_msc_cache.h"
+#include "usbd_msc_bench.h"
 
 /** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
   * @{
@@ -78,7 +80,7 @@ uint8_t              MSC_BOT_Status;
     #pragma data_alignment=4   
   #endif
 #endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
-__ALIGN_BEGIN uint8_t              MSC_BOT_Data[MSC_MEDIA_PACKET] __ALIGN_END ;
+__ALIGN_BEGIN uint8_t              MSC_BOT_Data[MSC_MEDIA_PACKET * MSC_BOT_DATA_BUF_NUM] __ALIGN_END ;
 
 #ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
   #if defined ( __ICCARM__ ) /*!< IAR Compiler */
@@ -129,7 +131,11 @@ void MSC_BOT_Init (USB_OTG_CORE_HANDLE  *pdev)
 {
   MSC_BOT_State = BOT_IDLE;
   MSC_BOT_Status = BOT_STATE_NORMAL;
+  SCSI_StatusCb = MSC_BOT_SendCSW;
   USBD_STORAGE_fops->Init(0);
+#ifdef MSC_CACHE_ENABLED
+  MSC_Cache_Init();
+#endif
   
   DCD_EP_Flush(pdev, MSC_OUT_EP);
   DCD_EP_Flush(pdev, MSC_IN_EP);
@@ -150,6 +156,9 @@ void MSC_BOT_Reset (USB_OTG_CORE_HANDLE  *pdev)
 {
   MSC_BOT_State = BOT_IDLE;
   MSC_BOT_Status = BOT_STATE_RECOVERY;
+#ifdef MSC_CACHE_ENABLED
+  MSC_Cache_Flush();
+#endif
   /* Prapare EP to Receive First BOT Cmd */
   DCD_EP_PrepareRx (pdev,
                     MSC_OUT_EP,
@@ -157,6 +166,29 @@ void MSC_BOT_Reset (USB_OTG_CORE_HANDLE  *pdev)
                     BOT_CBW_LENGTH);    
 }
 
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+/**
+* @brief  MSC_BOT_Resume
+*         Restart the BOT Machine after a host role session, without the
+*         storage and cache initialization of MSC_BOT_Init
+* @param  pdev: device instance
+* @retval None
+*/
+void MSC_BOT_Resume (USB_OTG_CORE_HANDLE  *pdev)
+{
+  MSC_BOT_State = BOT_IDLE;
+  MSC_BOT_Status = BOT_STATE_NORMAL;
+  
+  DCD_EP_Flush(pdev, MSC_OUT_EP);
+  DCD_EP_Flush(pdev, MSC_IN_EP);
+  /* Prapare EP to Receive First BOT Cmd */
+  DCD_EP_PrepareRx (pdev,
+                    MSC_OUT_EP,
+                    (uint8_t *)&MSC_BOT_cbw,
+                    BOT_CBW_LENGTH);    
+}
+#endif
+
 /**
 * @brief  MSC_BOT_DeInit
 *         Uninitialize the BOT Machine
@@ -166,6 +198,9 @@ void MSC_BOT_Reset (USB_OTG_CORE_HANDLE  *pdev)
 void MSC_BOT_DeInit (USB_OTG_CORE_HANDLE  *pdev)
 {
   MSC_BOT_State = BOT_IDLE;
+#ifdef MSC_CACHE_ENABLED
+  MSC_Cache_Flush();
+#endif
 }
 
 /**
@@ -191,8 +226,15 @@ void MSC_BOT_DataIn (USB_OTG_CORE_HANDLE  *pdev,
     break;
     
   case BOT_SEND_DATA:
+    MSC_BOT_SendCSW (pdev, CSW_CMD_PASSED);
+    
+    break;
+    
   case BOT_LAST_DATA_IN:
     MSC_BOT_SendCSW (pdev, CSW_CMD_PASSED);
+#ifdef MSC_READ_AHEAD_ENABLED
+    SCSI_ReadAhead();
+#endif
     
     break;
     
@@ -241,13 +283,16 @@ void MSC_BOT_DataOut (USB_OTG_CORE_HANDLE  *pdev,
 */
 static void  MSC_BOT_CBW_Decode (USB_OTG_CORE_HANDLE  *pdev)
 {
+#ifdef MSC_BENCH_ENABLED
+  MSC_Bench_CmdStart(MSC_BOT_cbw.CB[0]);
+#endif
 
   MSC_BOT_csw.dTag = MSC_BOT_cbw.dTag;
   MSC_BOT_csw.dDataResidue = MSC_BOT_cbw.dDataLength;
   
   if ((USBD_GetRxCount (pdev ,MSC_OUT_EP) != BOT_CBW_LENGTH) ||
       (MSC_BOT_cbw.dSignature != BOT_CBW_SIGNATURE)||
-        (MSC_BOT_cbw.bLUN > 1) || 
+        (MSC_BOT_cbw.bLUN >= MSC_MAX_LUN) || 
           (MSC_BOT_cbw.bCBLength < 1) || 
             (MSC_BOT_cbw.bCBLength > 16))
   {
@@ -321,6 +366,9 @@ void  MSC_BOT_SendCSW (USB_OTG_CORE_HANDLE  *pdev,
   MSC_BOT_csw.dSignature = BOT_CSW_SIGNATURE;
   MSC_BOT_csw.bStatus = CSW_Status;
   MSC_BOT_State = BOT_IDLE;
+#ifdef MSC_BENCH_ENABLED
+  MSC_Bench_CmdEnd();
+#endif
   
   DCD_EP_Tx (pdev, 
              MSC_IN_EP, 
@@ -0,0 +1,525 @@
+/**
+  ******************************************************************************
+  * @file    usbd_msc_cache.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Write-back sector cache of the MSC storage layer
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc_cache.h"
+
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup MSC_CACHE 
+  * @brief Write-back cache between the SCSI layer and the storage
+  *        callbacks. The media blocks are grouped in erase block sized
+  *        lines: the blocks written by the host are merged in their line,
+  *        which is programmed in one piece when it is evicted (LRU) or
+  *        flushed, after the missing blocks have been read from the media.
+  *        The lines are flushed on SYNCHRONIZE CACHE, START STOP UNIT, BOT
+  *        reset and after MSC_CACHE_IDLE_SOF frames without command.
+  * @{
+  */ 
+
+#ifdef MSC_CACHE_ENABLED
+
+/** @defgroup MSC_CACHE_Private_TypesDefinitions
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+
+/** @defgroup MSC_CACHE_Private_Defines
+  * @{
+  */ 
+/**
+  * @}
+  */ 
+
+
+/** @defgroup MSC_CACHE_Private_Macros
+  * @{
+  */ 
+#define MSC_CACHE_BLK_PER_LINE(size)  (MSC_CACHE_LINE_SIZE / (size))
+#define MSC_CACHE_FULL(size)          ((MSC_CACHE_BLK_PER_LINE(size) == 32) ? \
+                                       0xFFFFFFFF : \
+                                       ((1UL << MSC_CACHE_BLK_PER_LINE(size)) - 1))
+/**
+  * @}
+  */ 
+
+
+/** @defgroup MSC_CACHE_Private_Variables
+  * @{
+  */ 
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t MSC_Cache_Data[MSC_CACHE_LINES][MSC_CACHE_LINE_SIZE] __ALIGN_END ;
+
+static MSC_Cache_Line_TypeDef  MSC_Cache_Line[MSC_CACHE_LINES];
+static uint32_t                MSC_Cache_Clock;
+static uint32_t                MSC_Cache_Idle;
+/**
+  * @}
+  */ 
+
+
+/** @defgroup MSC_CACHE_Private_FunctionPrototypes
+  * @{
+  */ 
+static uint8_t MSC_Cache_Fits (uint32_t blk_size);
+static int8_t  MSC_Cache_Find (uint8_t lun, uint32_t blk_addr);
+static int8_t  MSC_Cache_Alloc (uint8_t lun, uint32_t blk_addr, uint32_t blk_size);
+static int8_t  MSC_Cache_FlushLine (uint8_t idx);
+static int8_t  MSC_Cache_Runs (uint8_t idx, uint32_t mask, uint8_t write);
+static void    MSC_Cache_Copy (uint8_t *dst, uint8_t *src, uint32_t len);
+/**
+  * @}
+  */ 
+
+
+/** @defgroup MSC_CACHE_Private_Functions
+  * @{
+  */ 
+
+/**
+* @brief  MSC_Cache_Init
+*         Empty the cache
+* @param  None
+* @retval None
+*/
+void MSC_Cache_Init (void)
+{
+  uint8_t i;
+  
+  for (i = 0; i < MSC_CACHE_LINES; i++)
+  {
+    MSC_Cache_Line[i].used = 0;
+    MSC_Cache_Line[i].valid = 0;
+    MSC_Cache_Line[i].dirty = 0;
+  }
+  MSC_Cache_Clock = 0;
+  MSC_Cache_Idle = 0;
+}
+
+/**
+* @brief  MSC_Cache_Read
+*         Read blocks, from the cache when they are present
+* @param  lun: Logical unit number
+* @param  buf: destination
+* @param  blk_addr: first block
+* @param  blk_len: number of blocks
+* @param  blk_size: block size of the lun
+* @retval status
+*/
+int8_t MSC_Cache_Read (uint8_t lun, 
+                       uint8_t *buf, 
+                       uint32_t blk_addr, 
+                       uint16_t blk_len,
+                       uint32_t blk_size)
+{
+  uint32_t off;
+  uint16_t run;
+  int8_t   idx;
+  
+  MSC_Cache_Idle = 0;
+  
+  if (!MSC_Cache_Fits(blk_size))
+  {
+    return USBD_STORAGE_fops->Read(lun, buf, blk_addr, blk_len);
+  }
+  
+  while (blk_len > 0)
+  {
+    off = blk_addr % MSC_CACHE_BLK_PER_LINE(blk_size);
+    idx = MSC_Cache_Find(lun, blk_addr - off);
+    
+    if ((idx >= 0) && (MSC_Cache_Line[idx].valid & (1UL << off)))
+    {
+      MSC_Cache_Copy(buf, &MSC_Cache_Data[idx][off * blk_size], blk_size);
+      MSC_Cache_Line[idx].stamp = ++MSC_Cache_Clock;
+      run = 1;
+    }
+    else
+    {
+      /* Read the blocks which are not cached in one access */
+      run = 1;
+      while (run < blk_len)
+      {
+        off = (blk_addr + run) % MSC_CACHE_BLK_PER_LINE(blk_size);
+        idx = MSC_Cache_Find(lun, blk_addr + run - off);
+        if ((idx >= 0) && (MSC_Cache_Line[idx].valid & (1UL << off)))
+        {
+          break;
+        }
+        run++;
+      }
+      if (USBD_STORAGE_fops->Read(lun, buf, blk_addr, run) < 0)
+      {
+        return -1;
+      }
+    }
+    buf      += run * blk_size;
+    blk_addr += run;
+    blk_len  -= run;
+  }
+  return 0;
+}
+
+/**
+* @brief  MSC_Cache_Write
+*         Write blocks into the cache
+* @param  lun: Logical unit number
+* @param  buf: source
+* @param  blk_addr: first block
+* @param  blk_len: number of blocks
+* @param  blk_size: block size of the lun
+* @retval status: -1 when the eviction of a line has failed
+*/
+int8_t MSC_Cache_Write (uint8_t lun, 
+                        uint8_t *buf, 
+                        uint32_t blk_addr, 
+                        uint16_t blk_len,
+                        uint32_t blk_size)
+{
+  uint32_t off;
+  int8_t   idx;
+  
+  MSC_Cache_Idle = 0;
+  
+  if (!MSC_Cache_Fits(blk_size))
+  {
+    return USBD_STORAGE_fops->Write(lun, buf, blk_addr, blk_len);
+  }
+  
+  while (blk_len > 0)
+  {
+    off = blk_addr % MSC_CACHE_BLK_PER_LINE(blk_size);
+    idx = MSC_Cache_Find(lun, blk_addr - off);
+    if (idx < 0)
+    {
+      idx = MSC_Cache_Alloc(lun, blk_addr - off, blk_size);
+      if (idx < 0)
+      {
+        return -1;
+      }
+    }
+    
+    MSC_Cache_Copy(&MSC_Cache_Data[idx][off * blk_size], buf, blk_size);
+    MSC_Cache_Line[idx].valid |= (1UL << off);
+    MSC_Cache_Line[idx].dirty |= (1UL << off);
+    MSC_Cache_Line[idx].stamp = ++MSC_Cache_Clock;
+    
+    buf += blk_size;
+    blk_addr++;
+    blk_len--;
+  }
+  return 0;
+}
+
+/**
+* @brief  MSC_Cache_Flush
+*         Write back all the dirty lines
+* @param  None
+* @retval status: -1 when a line could not be written
+*/
+int8_t MSC_Cache_Flush (void)
+{
+  int8_t  status = 0;
+  uint8_t i;
+  
+  for (i = 0; i < MSC_CACHE_LINES; i++)
+  {
+    if (MSC_Cache_FlushLine(i) < 0)
+    {
+      status = -1;
+    }
+  }
+  MSC_Cache_Idle = 0;
+  return status;
+}
+
+/**
+* @brief  MSC_Cache_SOF
+*         Idle timer, called on each SOF while no command is in progress
+* @param  None
+* @retval None
+*/
+void MSC_Cache_SOF (void)
+{
+  if (++MSC_Cache_Idle >= MSC_CACHE_IDLE_SOF)
+  {
+    MSC_Cache_Flush();
+  }
+}
+
+/**
+* @brief  MSC_Cache_Discard
+*         Drop the cached copies of unmapped blocks, dirty or not, so that
+*         neither a write back nor a hit returns their old data
+* @param  lun: Logical unit number
+* @param  blk_addr: first block
+* @param  blk_len: No. of blocks
+* @retval None
+*/
+void MSC_Cache_Discard (uint8_t lun, uint32_t blk_addr, uint32_t blk_len)
+{
+  MSC_Cache_Line_TypeDef *line;
+  uint32_t mask;
+  uint32_t blk;
+  uint8_t  i;
+  
+  for (i = 0; i < MSC_CACHE_LINES; i++)
+  {
+    line = &MSC_Cache_Line[i];
+    if ((!line->used) || (line->lun != lun))
+    {
+      continue;
+    }
+    
+    mask = 0;
+    for (blk = 0; blk < MSC_CACHE_BLK_PER_LINE(line->blk_size); blk++)
+    {
+      if ((line->blk_addr + blk - blk_addr) < blk_len)
+      {
+        mask |= (uint32_t)1 << blk;
+      }
+    }
+    line->valid &= ~mask;
+    line->dirty &= ~mask;
+  }
+}
+
+/**
+* @brief  MSC_Cache_Fits
+*         Check that the blocks of a lun can be grouped in lines
+* @param  blk_size: block size of the lun
+* @retval 1 when the lun can be cached
+*/
+static uint8_t MSC_Cache_Fits (uint32_t blk_size)
+{
+  return ((blk_size != 0) &&
+          ((MSC_CACHE_LINE_SIZE % blk_size) == 0) &&
+          (MSC_CACHE_BLK_PER_LINE(blk_size) <= 32));
+}
+
+/**
+* @brief  MSC_Cache_Find
+*         Look for the line holding a block
+* @param  lun: Logical unit number
+* @param  blk_addr: first block of the line
+* @retval line index, -1 when the line is not cached
+*/
+static int8_t MSC_Cache_Find (uint8_t lun, uint32_t blk_addr)
+{
+  uint8_t i;
+  
+  for (i = 0; i < MSC_CACHE_LINES; i++)
+  {
+    if ((MSC_Cache_Line[i].used) &&
+        (MSC_Cache_Line[i].lun == lun) &&
+        (MSC_Cache_Line[i].blk_addr == blk_addr))
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+* @brief  MSC_Cache_Alloc
+*         Get a line for a new block range, evicting the least recently
+*         used one
+* @param  lun: Logical unit number
+* @param  blk_addr: first block of the line
+* @param  blk_size: block size of the lun
+* @retval line index, -1 when the evicted line could not be written
+*/
+static int8_t MSC_Cache_Alloc (uint8_t lun, uint32_t blk_addr, uint32_t blk_size)
+{
+  uint8_t i;
+  uint8_t idx = 0;
+  
+  for (i = 0; i < MSC_CACHE_LINES; i++)
+  {
+    if (!MSC_Cache_Line[i].used)
+    {
+      idx = i;
+      break;
+    }
+    if (MSC_Cache_Line[i].stamp < MSC_Cache_Line[idx].stamp)
+    {
+      idx = i;
+    }
+  }
+  
+  if (MSC_Cache_FlushLine(idx) < 0)
+  {
+    return -1;
+  }
+  
+  MSC_Cache_Line[idx].used = 1;
+  MSC_Cache_Line[idx].lun = lun;
+  MSC_Cache_Line[idx].blk_addr = blk_addr;
+  MSC_Cache_Line[idx].blk_size = blk_size;
+  MSC_Cache_Line[idx].valid = 0;
+  MSC_Cache_Line[idx].dirty = 0;
+  return idx;
+}
+
+/**
+* @brief  MSC_Cache_FlushLine
+*         Write back a dirty line: the missing blocks are read first so that
+*         the line is programmed with a single access. When they cannot be
+*         read (e.g. line beyond the end of the media), the dirty blocks are
+*         written alone.
+* @param  idx: line index
+* @retval status
+*/
+static int8_t MSC_Cache_FlushLine (uint8_t idx)
+{
+  MSC_Cache_Line_TypeDef *line = &MSC_Cache_Line[idx];
+  uint32_t full;
+  
+  if ((!line->used) || (line->dirty == 0))
+  {
+    return 0;
+  }
+  
+  full = MSC_CACHE_FULL(line->blk_size);
+  
+  if (MSC_Cache_Runs(idx, full & ~line->valid, 0) == 0)
+  {
+    line->valid = full;
+    if (USBD_STORAGE_fops->Write(line->lun, 
+                                 MSC_Cache_Data[idx], 
+                                 line->blk_addr, 
+                                 MSC_CACHE_BLK_PER_LINE(line->blk_size)) < 0)
+    {
+      return -1;
+    }
+  }
+  else if (MSC_Cache_Runs(idx, line->dirty, 1) < 0)
+  {
+    return -1;
+  }
+  
+  line->dirty = 0;
+  return 0;
+}
+
+/**
+* @brief  MSC_Cache_Runs
+*         Access the media for each run of consecutive blocks of a line
+* @param  idx: line index
+* @param  mask: blocks to access
+* @param  write: 1 to write the blocks, 0 to read them
+* @retval status
+*/
+static int8_t MSC_Cache_Runs (uint8_t idx, uint32_t mask, uint8_t write)
+{
+  MSC_Cache_Line_TypeDef *line = &MSC_Cache_Line[idx];
+  uint8_t  *buf;
+  uint32_t first;
+  uint32_t run;
+  int8_t   status;
+  
+  first = 0;
+  while (mask >> first)
+  {
+    if (((mask >> first) & 0x1) == 0)
+    {
+      first++;
+      continue;
+    }
+    
+    run = 1;
+    while ((first + run < 32) && ((mask >> (first + run)) & 0x1))
+    {
+      run++;
+    }
+    
+    buf = &MSC_Cache_Data[idx][first * line->blk_size];
+    if (write)
+    {
+      status = USBD_STORAGE_fops->Write(line->lun, buf, line->blk_addr + first, run);
+    }
+    else
+    {
+      status = USBD_STORAGE_fops->Read(line->lun, buf, line->blk_addr + first, run);
+    }
+    if (status < 0)
+    {
+      return -1;
+    }
+    
+    first += run;
+    if (first == 32)
+    {
+      break;
+    }
+  }
+  return 0;
+}
+
+/**
+* @brief  MSC_Cache_Copy
+*         Copy a block
+* @param  dst: destination
+* @param  src: source
+* @param  len: No. of bytes
+* @retval None
+*/
+static void MSC_Cache_Copy (uint8_t *dst, uint8_t *src, uint32_t len)
+{
+  while (len--)
+  {
+    *dst++ = *src++;
+  }
+}
+
+/**
+  * @}
+  */ 
+
+#endif /* MSC_CACHE_ENABLED */
+
+/**
+  * @}
+  */ 
+
+
+/**
+  * @}
+  */ 
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -45,6 +45,7 @@
 #include "usbd_msc_core.h"
 #include "usbd_msc_bot.h"
 #include "usbd_req.h"
+#include "usbd_msc_cache.h"
 
 
 /** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
@@ -91,6 +92,11 @@ uint8_t  USBD_MSC_Init (void  *pdev,
 uint8_t  USBD_MSC_DeInit (void  *pdev, 
                               uint8_t cfgidx);
 
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+uint8_t  USBD_MSC_Resume (void  *pdev, 
+                              uint8_t cfgidx);
+#endif
+
 uint8_t  USBD_MSC_Setup (void  *pdev, 
                              USB_SETUP_REQ *req);
 
@@ -101,6 +107,10 @@ uint8_t  USBD_MSC_DataIn (void  *pdev,
 uint8_t  USBD_MSC_DataOut (void  *pdev, 
                                uint8_t epnum);
 
+#ifdef MSC_CACHE_ENABLED
+uint8_t  USBD_MSC_SOF (void  *pdev);
+#endif
+
 uint8_t  *USBD_MSC_GetCfgDesc (uint8_t speed, 
                                       uint16_t *length);
 
@@ -134,13 +144,24 @@ USBD_Class_cb_TypeDef  USBD_MSC_cb =
   NULL, /*EP0_RxReady*/
   USBD_MSC_DataIn,
   USBD_MSC_DataOut,
+#ifdef MSC_CACHE_ENABLED
+  USBD_MSC_SOF,
+#else
   NULL, /*SOF */ 
+#endif
   NULL,  
   NULL,     
   USBD_MSC_GetCfgDesc,
 #ifdef USB_OTG_HS_CORE  
   USBD_MSC_GetOtherCfgDesc,
 #endif
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+#ifdef USB_SUPPORT_USER_STRING_DESC 
+  NULL,
+#endif
+  USBD_MSC_DeInit, /* Suspend: closes the EPs, flushes the cache */
+  USBD_MSC_Resume,
+#endif
 };
 
 #ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
@@ -311,6 +332,35 @@ uint8_t  USBD_MSC_DeInit (void  *pdev,
   MSC_BOT_DeInit(pdev);   
   return USBD_OK;
 }
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+/**
+* @brief  USBD_MSC_Resume
+*         Restart the mass storage configuration after a host role session:
+*         the storage stays initialized
+* @param  pdev: device instance
+* @param  cfgidx: configuration index
+* @retval status
+*/
+uint8_t  USBD_MSC_Resume (void  *pdev, 
+                              uint8_t cfgidx)
+{
+  /* Open EP IN */
+  DCD_EP_Open(pdev,
+              MSC_IN_EP,
+              MSC_EPIN_SIZE,
+              USB_OTG_EP_BULK);
+  
+  /* Open EP OUT */
+  DCD_EP_Open(pdev,
+              MSC_OUT_EP,
+              MSC_EPOUT_SIZE,
+              USB_OTG_EP_BULK);
+  
+  MSC_BOT_Resume(pdev);
+  return USBD_OK;
+}
+#endif
+
 /**
 * @brief  USBD_MSC_Setup
 *         Handle the MSC specific requests
@@ -451,6 +501,23 @@ uint8_t  USBD_MSC_DataOut (void  *pdev,
   return USBD_OK;
 }
 
+#ifdef MSC_CACHE_ENABLED
+/**
+* @brief  USBD_MSC_SOF
+*         Run the idle timer of the cache between two commands
+* @param  pdev: device instance
+* @retval status
+*/
+uint8_t  USBD_MSC_SOF (void  *pdev)
+{
+  if (MSC_BOT_State == BOT_IDLE)
+  {
+    MSC_Cache_SOF();
+  }
+  return USBD_OK;
+}
+#endif
+
 /**
 * @brief  USBD_MSC_GetCfgDesc 
 *         return configuration descriptor
@@ -78,6 +78,19 @@ const uint8_t  MSC_Page00_Inquiry_Data[] = {//7
 	0x80, 
 	0x83 
 };  
+/* USB Mass storage Page 0 Inquiry Data, with the Block Limits and Logical
+   Block Provisioning pages of a unit supporting UNMAP */
+const uint8_t  MSC_Page00_Unmap_Inquiry_Data[] = {//9
+	0x00,
+	0x00,
+	0x00,
+	(LENGTH_INQUIRY_PAGE00_UNMAP - 4),
+	0x00,
+	0x80,
+	0x83,
+	0xB0,
+	0xB2
+};
 /* USB Mass storage sense 6  Data */
 const uint8_t  MSC_Mode_Sense6_data[] = {
 	0x00,
@@ -30,6 +30,7 @@
 #include "usbd_msc_scsi.h"
 #include "usbd_msc_mem.h"
 #include "usbd_msc_data.h"
+#include "usbd_msc_cache.h"
 
 
 
@@ -63,6 +64,19 @@
 /** @defgroup MSC_SCSI_Private_Macros
   * @{
   */ 
+#define SCSI_BUF(idx)           (&SCSI_cur->buf[(idx) * SCSI_cur->packet])
+#define SCSI_BUF_NEXT(idx)      (((idx) + 1) % SCSI_cur->buf_num)
+
+#ifdef MSC_READ_AHEAD_ENABLED
+/* The replies of the other commands are built in the first buffer of
+   MSC_BOT_Data */
+ #define SCSI_RA_BUF            (SCSI_cur->buf_num - 1)
+#endif
+
+/* Big endian fields of the command blocks */
+#define SCSI_BE16(p)            (((uint32_t)(p)[0] <<  8) | (uint32_t)(p)[1])
+#define SCSI_BE32(p)            (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | \
+                                 ((uint32_t)(p)[2] <<  8) | (uint32_t)(p)[3])
 /**
   * @}
   */ 
@@ -76,13 +90,36 @@ SCSI_Sense_TypeDef     SCSI_Sense [SENSE_LIST_DEEPTH];
 uint8_t   SCSI_Sense_Head;
 uint8_t   SCSI_Sense_Tail;
 
-uint32_t  SCSI_blk_size;
-uint32_t  SCSI_blk_nbr;
+/* Logical units, SCSI_cur being the one of the current command */
+SCSI_Lun_TypeDef   SCSI_Lun[MSC_MAX_LUN];
+SCSI_Lun_TypeDef  *SCSI_cur;
+
+uint32_t  SCSI_blk_addr;   /* next block of the media */
+uint32_t  SCSI_blk_len;    /* bytes left to the media */
+
+/* Data stage buffers: SCSI_buf_ready buffers holding data from
+   SCSI_buf_idx on, a USB transfer and a media access in progress */
+uint8_t   SCSI_buf_idx;
+uint8_t   SCSI_buf_ready;
+uint8_t   SCSI_usb_busy;
+uint8_t   SCSI_media_busy;
+uint32_t  SCSI_media_len;
+uint32_t  SCSI_rx_len;
 
-uint32_t  SCSI_blk_addr;
-uint32_t  SCSI_blk_len;
+#ifdef MSC_READ_AHEAD_ENABLED
+/* Block following the last READ, set when that READ continued the previous
+   one, and bytes prefetched from there into SCSI_RA_BUF */
+uint32_t  SCSI_ra_next;
+uint8_t   SCSI_ra_lun;
+uint8_t   SCSI_ra_seq;
+uint32_t  SCSI_ra_len;
+#endif
 
 USB_OTG_CORE_HANDLE  *cdev;
+
+/* Status stage of the READ/WRITE data stages: the CSW of the bulk-only
+   transport unless another transport installs its own */
+void (*SCSI_StatusCb)(USB_OTG_CORE_HANDLE  *pdev, uint8_t status) = MSC_BOT_SendCSW;
 /**
   * @}
   */ 
@@ -95,19 +132,37 @@ static int8_t SCSI_TestUnitReady(uint8_t lun, uint8_t *params);
 static int8_t SCSI_Inquiry(uint8_t lun, uint8_t *params);
 static int8_t SCSI_ReadFormatCapacity(uint8_t lun, uint8_t *params);
 static int8_t SCSI_ReadCapacity10(uint8_t lun, uint8_t *params);
+static int8_t SCSI_ReadCapacity16(uint8_t lun, uint8_t *params);
 static int8_t SCSI_RequestSense (uint8_t lun, uint8_t *params);
 static int8_t SCSI_StartStopUnit(uint8_t lun, uint8_t *params);
 static int8_t SCSI_ModeSense6 (uint8_t lun, uint8_t *params);
 static int8_t SCSI_ModeSense10 (uint8_t lun, uint8_t *params);
-static int8_t SCSI_Write10(uint8_t lun , uint8_t *params);
-static int8_t SCSI_Read10(uint8_t lun , uint8_t *params);
+static int8_t SCSI_Write(uint8_t lun , uint8_t *params);
+static int8_t SCSI_Read(uint8_t lun , uint8_t *params);
 static int8_t SCSI_Verify10(uint8_t lun, uint8_t *params);
+static int8_t SCSI_SynchronizeCache(uint8_t lun, uint8_t *params);
+static int8_t SCSI_ReportLuns(uint8_t lun, uint8_t *params);
+#ifdef MSC_UNMAP_ENABLED
+static int8_t SCSI_InquiryVpd(uint8_t lun, uint8_t *params);
+static int8_t SCSI_Unmap(uint8_t lun, uint8_t *params);
+static int8_t SCSI_WriteSame(uint8_t lun, uint8_t *params);
+static int8_t SCSI_WriteSameBlocks(uint8_t lun, uint8_t unmap);
+static int8_t SCSI_CheckWritable(uint8_t lun);
+static int8_t SCSI_ParamOut(uint8_t lun, uint32_t len);
+#endif
+static int8_t SCSI_DecodeRW (uint8_t lun , uint8_t *params);
 static int8_t SCSI_CheckAddressRange (uint8_t lun , 
                                       uint32_t blk_offset , 
-                                      uint16_t blk_nbr);
+                                      uint32_t blk_nbr);
 static int8_t SCSI_ProcessRead (uint8_t lun);
+static int8_t SCSI_ReadPump (uint8_t lun);
+static int8_t SCSI_MediaRead (uint8_t lun, uint8_t *buf, uint32_t len);
+static void   SCSI_ReadDone (uint32_t len);
 
 static int8_t SCSI_ProcessWrite (uint8_t lun);
+static int8_t SCSI_WritePump (uint8_t lun);
+static int8_t SCSI_MediaWrite (uint8_t lun, uint8_t *buf, uint32_t len);
+static void   SCSI_WriteDone (uint32_t len);
 /**
   * @}
   */ 
@@ -131,6 +186,15 @@ int8_t SCSI_ProcessCmd(USB_OTG_CORE_HANDLE  *pdev,
                            uint8_t *params)
 {
   cdev = pdev;
+  SCSI_cur = &SCSI_Lun[lun];
+  
+  if (SCSI_cur->buf == NULL)
+  {
+    /* No pool assigned: share MSC_BOT_Data */
+    SCSI_cur->buf     = MSC_BOT_Data;
+    SCSI_cur->packet  = MSC_MEDIA_PACKET;
+    SCSI_cur->buf_num = MSC_BOT_DATA_BUF_NUM;
+  }
   
   switch (params[0])
   {
@@ -160,15 +224,38 @@ int8_t SCSI_ProcessCmd(USB_OTG_CORE_HANDLE  *pdev,
   case SCSI_READ_CAPACITY10:
     return SCSI_ReadCapacity10(lun, params);
     
+  case SCSI_READ_CAPACITY16:
+    return SCSI_ReadCapacity16(lun, params);
+    
   case SCSI_READ10:
-    return SCSI_Read10(lun, params); 
+  case SCSI_READ12:
+  case SCSI_READ16:
+    return SCSI_Read(lun, params); 
     
   case SCSI_WRITE10:
-    return SCSI_Write10(lun, params);
+  case SCSI_WRITE12:
+  case SCSI_WRITE16:
+    return SCSI_Write(lun, params);
     
   case SCSI_VERIFY10:
     return SCSI_Verify10(lun, params);
     
+  case SCSI_SYNCHRONIZE_CACHE10:
+  case SCSI_SYNCHRONIZE_CACHE16:
+    return SCSI_SynchronizeCache(lun, params);
+    
+  case SCSI_REPORT_LUNS:
+    return SCSI_ReportLuns(lun, params);
+    
+#ifdef MSC_UNMAP_ENABLED
+  case SCSI_UNMAP:
+    return SCSI_Unmap(lun, params);
+    
+  case SCSI_WRITE_SAME10:
+  case SCSI_WRITE_SAME16:
+    return SCSI_WriteSame(lun, params);
+#endif
+    
   default:
     SCSI_SenseCode(lun,
                    ILLEGAL_REQUEST, 
@@ -178,6 +265,34 @@ int8_t SCSI_ProcessCmd(USB_OTG_CORE_HANDLE  *pdev,
 }
 
 
+/**
+* @brief  SCSI_SetLunPool
+*         Assign a pool of data stage buffers to a logical unit, to be called
+*         before the device is connected. The packet size must be a multiple
+*         of the block size and of the bulk max packet size. A logical unit
+*         without pool uses MSC_BOT_Data.
+* @param  lun: Logical unit number
+* @param  buf: buf_num * packet bytes, aligned as MSC_BOT_Data
+* @param  packet: size of one buffer
+* @param  buf_num: number of buffers
+* @retval status
+*/
+int8_t SCSI_SetLunPool(uint8_t lun, 
+                       uint8_t *buf, 
+                       uint32_t packet, 
+                       uint8_t buf_num)
+{
+  if ((lun >= MSC_MAX_LUN) || (buf == NULL) || (packet == 0) || (buf_num == 0))
+  {
+    return -1;
+  }
+  
+  SCSI_Lun[lun].buf     = buf;
+  SCSI_Lun[lun].packet  = packet;
+  SCSI_Lun[lun].buf_num = buf_num;
+  return 0;
+}
+
 /**
 * @brief  SCSI_TestUnitReady
 *         Process SCSI Test Unit Ready Command
@@ -222,6 +337,12 @@ static int8_t  SCSI_Inquiry(uint8_t lun, uint8_t *params)
   
   if (params[1] & 0x01)/*Evpd is set*/
   {
+#ifdef MSC_UNMAP_ENABLED
+    if (USBD_STORAGE_fops->Unmap != NULL)
+    {
+      return SCSI_InquiryVpd(lun, params);
+    }
+#endif
     pPage = (uint8_t *)MSC_Page00_Inquiry_Data;
     len = LENGTH_INQUIRY_PAGE00;
   }
@@ -256,7 +377,7 @@ static int8_t  SCSI_Inquiry(uint8_t lun, uint8_t *params)
 static int8_t SCSI_ReadCapacity10(uint8_t lun, uint8_t *params)
 {
   
-  if(USBD_STORAGE_fops->GetCapacity(lun, &SCSI_blk_nbr, &SCSI_blk_size) != 0)
+  if(USBD_STORAGE_fops->GetCapacity(lun, &SCSI_cur->blk_nbr, &SCSI_cur->blk_size) != 0)
   {
     SCSI_SenseCode(lun,
                    NOT_READY, 
@@ -266,20 +387,77 @@ static int8_t SCSI_ReadCapacity10(uint8_t lun, uint8_t *params)
   else
   {
     
-    MSC_BOT_Data[0] = (uint8_t)(SCSI_blk_nbr - 1 >> 24);
-    MSC_BOT_Data[1] = (uint8_t)(SCSI_blk_nbr - 1 >> 16);
-    MSC_BOT_Data[2] = (uint8_t)(SCSI_blk_nbr - 1 >>  8);
-    MSC_BOT_Data[3] = (uint8_t)(SCSI_blk_nbr - 1);
+    MSC_BOT_Data[0] = (uint8_t)(SCSI_cur->blk_nbr - 1 >> 24);
+    MSC_BOT_Data[1] = (uint8_t)(SCSI_cur->blk_nbr - 1 >> 16);
+    MSC_BOT_Data[2] = (uint8_t)(SCSI_cur->blk_nbr - 1 >>  8);
+    MSC_BOT_Data[3] = (uint8_t)(SCSI_cur->blk_nbr - 1);
     
-    MSC_BOT_Data[4] = (uint8_t)(SCSI_blk_size >>  24);
-    MSC_BOT_Data[5] = (uint8_t)(SCSI_blk_size >>  16);
-    MSC_BOT_Data[6] = (uint8_t)(SCSI_blk_size >>  8);
-    MSC_BOT_Data[7] = (uint8_t)(SCSI_blk_size);
+    MSC_BOT_Data[4] = (uint8_t)(SCSI_cur->blk_size >>  24);
+    MSC_BOT_Data[5] = (uint8_t)(SCSI_cur->blk_size >>  16);
+    MSC_BOT_Data[6] = (uint8_t)(SCSI_cur->blk_size >>  8);
+    MSC_BOT_Data[7] = (uint8_t)(SCSI_cur->blk_size);
     
     MSC_BOT_DataLen = 8;
     return 0;
   }
 }
+
+/**
+* @brief  SCSI_ReadCapacity16
+*         Process Read Capacity 16 command (service action of SERVICE
+*         ACTION IN(16))
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_ReadCapacity16(uint8_t lun, uint8_t *params)
+{
+  uint32_t len;
+  uint8_t  i;
+  
+  if ((params[1] & 0x1F) != 0x10)
+  {
+    SCSI_SenseCode(lun,
+                   ILLEGAL_REQUEST, 
+                   INVALID_CDB);
+    return -1;
+  }
+  
+  if(USBD_STORAGE_fops->GetCapacity(lun, &SCSI_cur->blk_nbr, &SCSI_cur->blk_size) != 0)
+  {
+    SCSI_SenseCode(lun,
+                   NOT_READY, 
+                   MEDIUM_NOT_PRESENT);
+    return -1;
+  } 
+  
+  for(i=0 ; i < READ_CAPACITY16_DATA_LEN ; i++) 
+  {
+    MSC_BOT_Data[i] = 0;
+  }
+  
+  /* The storage interface addresses 32-bit LBAs: upper bytes stay 0 */
+  MSC_BOT_Data[4] = (uint8_t)((SCSI_cur->blk_nbr - 1) >> 24);
+  MSC_BOT_Data[5] = (uint8_t)((SCSI_cur->blk_nbr - 1) >> 16);
+  MSC_BOT_Data[6] = (uint8_t)((SCSI_cur->blk_nbr - 1) >>  8);
+  MSC_BOT_Data[7] = (uint8_t)(SCSI_cur->blk_nbr - 1);
+  
+  MSC_BOT_Data[8]  = (uint8_t)(SCSI_cur->blk_size >>  24);
+  MSC_BOT_Data[9]  = (uint8_t)(SCSI_cur->blk_size >>  16);
+  MSC_BOT_Data[10] = (uint8_t)(SCSI_cur->blk_size >>  8);
+  MSC_BOT_Data[11] = (uint8_t)(SCSI_cur->blk_size);
+  
+#ifdef MSC_UNMAP_ENABLED
+  if (USBD_STORAGE_fops->Unmap != NULL)
+  {
+    MSC_BOT_Data[14] = 0xC0;    /* LBPME, LBPRZ: unmapped blocks read as 0 */
+  }
+#endif
+  
+  len = SCSI_BE32(&params[10]);
+  MSC_BOT_DataLen = MIN(len, READ_CAPACITY16_DATA_LEN);
+  return 0;
+}
 /**
 * @brief  SCSI_ReadFormatCapacity
 *         Process Read Format Capacity command
@@ -435,18 +613,448 @@ void SCSI_SenseCode(uint8_t lun, uint8_t sKey, uint8_t ASC)
 static int8_t SCSI_StartStopUnit(uint8_t lun, uint8_t *params)
 {
   MSC_BOT_DataLen = 0;
+#ifdef MSC_READ_AHEAD_ENABLED
+  SCSI_ra_len = 0;
+#endif
+#ifdef MSC_CACHE_ENABLED
+  /* The medium may be ejected or powered down next */
+  if (MSC_Cache_Flush() < 0)
+  {
+    SCSI_SenseCode(lun, MEDIUM_ERROR, WRITE_FAULT);
+    return -1;
+  }
+#endif
+  return 0;
+}
+
+/**
+* @brief  SCSI_SynchronizeCache
+*         Process Synchronize Cache 10/16 commands: the whole cache is
+*         written back, whatever the block range
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_SynchronizeCache(uint8_t lun, uint8_t *params)
+{
+  MSC_BOT_DataLen = 0;
+#ifdef MSC_CACHE_ENABLED
+  if (MSC_Cache_Flush() < 0)
+  {
+    SCSI_SenseCode(lun, MEDIUM_ERROR, WRITE_FAULT);
+    return -1;
+  }
+#endif
+  return 0;
+}
+
+/**
+* @brief  SCSI_ReportLuns
+*         Process Report Luns command: single level LUN addresses of the
+*         logical units reported by GetMaxLun
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_ReportLuns(uint8_t lun, uint8_t *params)
+{
+  uint32_t len;
+  uint8_t  nbr;
+  uint8_t  i;
+  
+  nbr = USBD_STORAGE_fops->GetMaxLun() + 1;
+  if (nbr > MSC_MAX_LUN)
+  {
+    nbr = MSC_MAX_LUN;
+  }
+  
+  len = 8 + (uint32_t)nbr * 8;
+  for(i=0 ; i < len ; i++) 
+  {
+    MSC_BOT_Data[i] = 0;
+  }
+  
+  MSC_BOT_Data[3] = (uint8_t)(nbr * 8);
+  for(i=0 ; i < nbr ; i++) 
+  {
+    MSC_BOT_Data[8 + i * 8 + 1] = i;
+  }
+  
+  MSC_BOT_DataLen = MIN(len, SCSI_BE32(&params[6]));
   return 0;
 }
 
+#ifdef MSC_UNMAP_ENABLED
 /**
-* @brief  SCSI_Read10
-*         Process Read10 command
+* @brief  SCSI_InquiryVpd
+*         Process Inquiry command with EVPD set for a unit supporting UNMAP:
+*         Block Limits and Logical Block Provisioning pages, the supported
+*         pages list otherwise
 * @param  lun: Logical unit number
 * @param  params: Command parameters
 * @retval status
 */
-static int8_t SCSI_Read10(uint8_t lun , uint8_t *params)
+static int8_t SCSI_InquiryVpd(uint8_t lun, uint8_t *params)
 {
+  uint32_t nbr;
+  uint16_t len;
+  uint16_t i;
+  
+  switch (params[2])
+  {
+  case 0xB0:
+    len = INQUIRY_BLOCK_LIMITS_DATA_LEN;
+    for(i=0 ; i < len ; i++) 
+    {
+      MSC_BOT_Data[i] = 0;
+    }
+    MSC_BOT_Data[1] = 0xB0;
+    MSC_BOT_Data[3] = (uint8_t)(len - 4);
+    MSC_BOT_Data[4] = 0x01;     /* WSNZ: WRITE SAME of 0 blocks rejected */
+    
+    /* Max. unmap LBA count: unlimited */
+    MSC_BOT_Data[20] = 0xFF;
+    MSC_BOT_Data[21] = 0xFF;
+    MSC_BOT_Data[22] = 0xFF;
+    MSC_BOT_Data[23] = 0xFF;
+    
+    /* Max. unmap block descriptors: the parameter list fits in a packet */
+    nbr = (SCSI_cur->packet - 8) / 16;
+    MSC_BOT_Data[24] = (uint8_t)(nbr >> 24);
+    MSC_BOT_Data[25] = (uint8_t)(nbr >> 16);
+    MSC_BOT_Data[26] = (uint8_t)(nbr >>  8);
+    MSC_BOT_Data[27] = (uint8_t)(nbr);
+    
+    nbr = MSC_WRITE_SAME_MAX_BLKS;
+    MSC_BOT_Data[40] = (uint8_t)(nbr >> 24);
+    MSC_BOT_Data[41] = (uint8_t)(nbr >> 16);
+    MSC_BOT_Data[42] = (uint8_t)(nbr >>  8);
+    MSC_BOT_Data[43] = (uint8_t)(nbr);
+    break;
+    
+  case 0xB2:
+    len = INQUIRY_PROVISIONING_DATA_LEN;
+    for(i=0 ; i < len ; i++) 
+    {
+      MSC_BOT_Data[i] = 0;
+    }
+    MSC_BOT_Data[1] = 0xB2;
+    MSC_BOT_Data[3] = (uint8_t)(len - 4);
+    MSC_BOT_Data[5] = 0xE4;     /* LBPU, LBPWS, LBPWS10, LBPRZ */
+    MSC_BOT_Data[6] = 0x01;     /* resource provisioned */
+    break;
+    
+  default:
+    len = LENGTH_INQUIRY_PAGE00_UNMAP;
+    for(i=0 ; i < len ; i++) 
+    {
+      MSC_BOT_Data[i] = MSC_Page00_Unmap_Inquiry_Data[i];
+    }
+    break;
+  }
+  
+  MSC_BOT_DataLen = MIN(len, SCSI_BE16(&params[3]));
+  return 0;
+}
+
+/**
+* @brief  SCSI_Unmap
+*         Process Unmap command: the parameter list is received in the first
+*         buffer, all its block descriptors are checked before any of them
+*         is applied
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_Unmap(uint8_t lun, uint8_t *params)
+{
+  uint8_t  *desc;
+  uint32_t len;
+  uint32_t nbr;
+  uint32_t i;
+  
+  len = SCSI_BE16(&params[7]);
+  
+  if (MSC_BOT_State == BOT_IDLE) /* Idle */
+  {
+    if (USBD_STORAGE_fops->Unmap == NULL)
+    {
+      SCSI_SenseCode(lun, ILLEGAL_REQUEST, INVALID_CDB);
+      return -1;
+    }
+    
+    /* Anchored blocks not supported */
+    if (params[1] & 0x01)
+    {
+      SCSI_SenseCode(lun, ILLEGAL_REQUEST, INVALID_FIELED_IN_COMMAND);
+      return -1;
+    }
+    
+    if (SCSI_CheckWritable(lun) < 0)
+    {
+      return -1;
+    }
+    
+    if ((len > 0) && (len < 8))
+    {
+      SCSI_SenseCode(lun, ILLEGAL_REQUEST, PARAMETER_LIST_LENGTH_ERROR);
+      return -1;
+    }
+    return SCSI_ParamOut(lun, len);
+  }
+  
+  /* Parameter list received: complete descriptors only */
+  MSC_BOT_csw.dDataResidue -= len;
+  desc = SCSI_BUF(0);
+  nbr = MIN(SCSI_BE16(&desc[2]), len - 8) / 16;
+  
+  for (i = 0; i < nbr; i++)
+  {
+    desc = SCSI_BUF(0) + 8 + i * 16;
+    
+    /* 64-bit LBA: the storage interface addresses 32-bit LBAs only */
+    if (SCSI_BE32(&desc[0]) != 0)
+    {
+      SCSI_SenseCode(lun, ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE);
+      return -1;
+    }
+    if (SCSI_CheckAddressRange(lun, SCSI_BE32(&desc[4]), SCSI_BE32(&desc[8])) < 0)
+    {
+      return -1;
+    }
+  }
+  
+  for (i = 0; i < nbr; i++)
+  {
+    desc = SCSI_BUF(0) + 8 + i * 16;
+    if (SCSI_BE32(&desc[8]) == 0)
+    {
+      continue;
+    }
+    
+#ifdef MSC_CACHE_ENABLED
+    MSC_Cache_Discard(lun, SCSI_BE32(&desc[4]), SCSI_BE32(&desc[8]));
+#endif
+    if (USBD_STORAGE_fops->Unmap(lun, SCSI_BE32(&desc[4]), SCSI_BE32(&desc[8])) < 0)
+    {
+      SCSI_SenseCode(lun, HARDWARE_ERROR, WRITE_FAULT);
+      return -1;
+    }
+  }
+  
+  SCSI_StatusCb(cdev, CSW_CMD_PASSED);
+  return 0;
+}
+
+/**
+* @brief  SCSI_WriteSame
+*         Process Write Same 10/16 commands: a single block is received
+*         and written to the whole range, or the range is unmapped when the
+*         UNMAP bit is set and the block is zeroed. SCSI_blk_len counts
+*         blocks here.
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_WriteSame(uint8_t lun, uint8_t *params)
+{
+  if (MSC_BOT_State == BOT_IDLE) /* Idle */
+  {
+    /* ANCHOR, PBDATA and LBDATA not supported, nor NDOB */
+    if ((params[1] & 0x16) ||
+        ((params[0] == SCSI_WRITE_SAME16) && (params[1] & 0x01)))
+    {
+      SCSI_SenseCode(lun, ILLEGAL_REQUEST, INVALID_FIELED_IN_COMMAND);
+      return -1;
+    }
+    
+    if (SCSI_CheckWritable(lun) < 0)
+    {
+      return -1;
+    }
+    
+    if (params[0] == SCSI_WRITE_SAME10)
+    {
+      SCSI_blk_addr = SCSI_BE32(&params[2]);
+      SCSI_blk_len  = SCSI_BE16(&params[7]);
+    }
+    else
+    {
+      if (SCSI_BE32(&params[2]) != 0)
+      {
+        SCSI_SenseCode(lun, ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE);
+        return -1;
+      }
+      SCSI_blk_addr = SCSI_BE32(&params[6]);
+      SCSI_blk_len  = SCSI_BE32(&params[10]);
+    }
+    
+    if ((SCSI_blk_len == 0) || (SCSI_blk_len > MSC_WRITE_SAME_MAX_BLKS))
+    {
+      SCSI_SenseCode(lun, ILLEGAL_REQUEST, INVALID_FIELED_IN_COMMAND);
+      return -1;
+    }
+    
+    if (SCSI_CheckAddressRange(lun, SCSI_blk_addr, SCSI_blk_len) < 0)
+    {
+      return -1;
+    }
+    return SCSI_ParamOut(lun, SCSI_cur->blk_size);
+  }
+  
+  /* Block received */
+  MSC_BOT_csw.dDataResidue -= SCSI_cur->blk_size;
+  if (SCSI_WriteSameBlocks(lun, params[1] & 0x08) < 0)
+  {
+    SCSI_SenseCode(lun, HARDWARE_ERROR, WRITE_FAULT);
+    return -1;
+  }
+  
+  SCSI_StatusCb(cdev, CSW_CMD_PASSED);
+  return 0;
+}
+
+/**
+* @brief  SCSI_WriteSameBlocks
+*         Write the block of the first buffer SCSI_blk_len times from
+*         SCSI_blk_addr on: the buffer is filled with copies of it and
+*         written packet by packet
+* @param  lun: Logical unit number
+* @param  unmap: unmap the range instead when the block is zeroed
+* @retval status
+*/
+static int8_t SCSI_WriteSameBlocks(uint8_t lun, uint8_t unmap)
+{
+  uint8_t  *buf = SCSI_BUF(0);
+  uint32_t blk_size = SCSI_cur->blk_size;
+  uint32_t blk_per_buf = SCSI_cur->packet / blk_size;
+  uint32_t i;
+  uint16_t n;
+  int8_t   status;
+  
+  if (unmap && (USBD_STORAGE_fops->Unmap != NULL))
+  {
+    for (i = 0; (i < blk_size) && (buf[i] == 0); i++)
+    {
+    }
+    
+    /* Unmapped blocks read back as zeros */
+    if (i == blk_size)
+    {
+#ifdef MSC_CACHE_ENABLED
+      MSC_Cache_Discard(lun, SCSI_blk_addr, SCSI_blk_len);
+#endif
+      return USBD_STORAGE_fops->Unmap(lun, SCSI_blk_addr, SCSI_blk_len);
+    }
+  }
+  
+  for (i = blk_size; i < blk_per_buf * blk_size; i++)
+  {
+    buf[i] = buf[i - blk_size];
+  }
+  
+  while (SCSI_blk_len > 0)
+  {
+    n = (uint16_t)MIN(SCSI_blk_len, blk_per_buf);
+#ifdef MSC_CACHE_ENABLED
+    status = MSC_Cache_Write(lun, buf, SCSI_blk_addr, n, blk_size);
+#else
+    status = USBD_STORAGE_fops->Write(lun, buf, SCSI_blk_addr, n);
+#endif
+    if (status < 0)
+    {
+      return -1;
+    }
+    SCSI_blk_addr += n;
+    SCSI_blk_len  -= n;
+  }
+  return 0;
+}
+
+/**
+* @brief  SCSI_CheckWritable
+*         Check that the media is ready and not write-protected before a
+*         command changing its content
+* @param  lun: Logical unit number
+* @retval status
+*/
+static int8_t SCSI_CheckWritable(uint8_t lun)
+{
+  if((USBD_STORAGE_fops->IsReady(lun) !=0 ) || SCSI_media_busy)
+  {
+    SCSI_SenseCode(lun,
+                   NOT_READY, 
+                   MEDIUM_NOT_PRESENT);
+    return -1;
+  } 
+  
+  if(USBD_STORAGE_fops->IsWriteProtected(lun) !=0 )
+  {
+    SCSI_SenseCode(lun,
+                   NOT_READY, 
+                   WRITE_PROTECTED);
+    return -1;
+  } 
+  
+#ifdef MSC_READ_AHEAD_ENABLED
+  SCSI_ra_len = 0;
+#endif
+  return 0;
+}
+
+/**
+* @brief  SCSI_ParamOut
+*         Start the data stage of a command receiving a parameter list or a
+*         single block in the first buffer: the command is called again
+*         once it is received
+* @param  lun: Logical unit number
+* @param  len: No. of bytes expected, 0 for no data stage
+* @retval status
+*/
+static int8_t SCSI_ParamOut(uint8_t lun, uint32_t len)
+{
+  /* cases 3,8,9,11,13 : Hn,Hi,Ho <> Do */
+  if ((MSC_BOT_cbw.dDataLength != len) ||
+      ((len > 0) && ((MSC_BOT_cbw.bmFlags & 0x80) == 0x80)))
+  {
+    SCSI_SenseCode(MSC_BOT_cbw.bLUN, 
+                   ILLEGAL_REQUEST, 
+                   INVALID_CDB);
+    return -1;
+  }
+  
+  if (len > SCSI_cur->packet)
+  {
+    SCSI_SenseCode(lun, ILLEGAL_REQUEST, PARAMETER_LIST_LENGTH_ERROR);
+    return -1;
+  }
+  
+  MSC_BOT_DataLen = 0;
+  if (len > 0)
+  {
+    MSC_BOT_State = BOT_DATA_OUT;
+    DCD_EP_PrepareRx (cdev,
+                      MSC_OUT_EP,
+                      SCSI_BUF(0),
+                      len);
+  }
+  return 0;
+}
+#endif /* MSC_UNMAP_ENABLED */
+
+/**
+* @brief  SCSI_Read
+*         Process Read10/Read12/Read16 commands
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_Read(uint8_t lun , uint8_t *params)
+{
+#ifdef MSC_READ_AHEAD_ENABLED
+  uint32_t ra_len;
+#endif
+  
   if(MSC_BOT_State == BOT_IDLE)  /* Idle */
   {
     
@@ -460,7 +1068,13 @@ static int8_t SCSI_Read10(uint8_t lun , uint8_t *params)
       return -1;
     }    
     
-    if(USBD_STORAGE_fops->IsReady(lun) !=0 )
+#ifdef MSC_READ_AHEAD_ENABLED
+    /* Either used now or overwritten by the data stage */
+    ra_len = SCSI_ra_len;
+    SCSI_ra_len = 0;
+#endif
+    
+    if((USBD_STORAGE_fops->IsReady(lun) !=0 ) || SCSI_media_busy)
     {
       SCSI_SenseCode(lun,
                      NOT_READY, 
@@ -468,48 +1082,59 @@ static int8_t SCSI_Read10(uint8_t lun , uint8_t *params)
       return -1;
     } 
     
-    SCSI_blk_addr = (params[2] << 24) | \
-      (params[3] << 16) | \
-        (params[4] <<  8) | \
-          params[5];
-    
-    SCSI_blk_len =  (params[7] <<  8) | \
-      params[8];  
-    
-    
-    
-    if( SCSI_CheckAddressRange(lun, SCSI_blk_addr, SCSI_blk_len) < 0)
+    if( SCSI_DecodeRW(lun, params) < 0)
     {
       return -1; /* error */
     }
     
     MSC_BOT_State = BOT_DATA_IN;
-    SCSI_blk_addr *= SCSI_blk_size;
-    SCSI_blk_len  *= SCSI_blk_size;
+    SCSI_buf_idx   = 0;
+    SCSI_buf_ready = 0;
+    SCSI_usb_busy  = 0;
     
     /* cases 4,5 : Hi <> Dn */
-    if (MSC_BOT_cbw.dDataLength != SCSI_blk_len)
+    if ((SCSI_blk_len > (0xFFFFFFFF / SCSI_cur->blk_size)) ||
+        (MSC_BOT_cbw.dDataLength != SCSI_blk_len * SCSI_cur->blk_size))
     {
       SCSI_SenseCode(MSC_BOT_cbw.bLUN, 
                      ILLEGAL_REQUEST, 
                      INVALID_CDB);
       return -1;
     }
+    
+#ifdef MSC_READ_AHEAD_ENABLED
+    SCSI_ra_seq = ((lun == SCSI_ra_lun) && (SCSI_blk_addr == SCSI_ra_next));
+    SCSI_ra_lun = lun;
+    SCSI_ra_next = SCSI_blk_addr + SCSI_blk_len;
+#endif
+    SCSI_blk_len *= SCSI_cur->blk_size;
+    
+#ifdef MSC_READ_AHEAD_ENABLED
+    if (SCSI_ra_seq && (ra_len > 0) && (SCSI_cur->buf_num >= 2))
+    {
+      /* The first packet is already there */
+      ra_len = MIN(SCSI_blk_len, ra_len);
+      SCSI_buf_idx   = SCSI_RA_BUF;
+      SCSI_buf_ready = 1;
+      SCSI_blk_addr += ra_len / SCSI_cur->blk_size; 
+      SCSI_blk_len  -= ra_len;
+    }
+#endif
   }
-  MSC_BOT_DataLen = MSC_MEDIA_PACKET;  
+  MSC_BOT_DataLen = SCSI_cur->packet;  
   
   return SCSI_ProcessRead(lun);
 }
 
 /**
-* @brief  SCSI_Write10
-*         Process Write10 command
+* @brief  SCSI_Write
+*         Process Write10/Write12/Write16 commands
 * @param  lun: Logical unit number
 * @param  params: Command parameters
 * @retval status
 */
 
-static int8_t SCSI_Write10 (uint8_t lun , uint8_t *params)
+static int8_t SCSI_Write (uint8_t lun , uint8_t *params)
 {
   if (MSC_BOT_State == BOT_IDLE) /* Idle */
   {
@@ -525,7 +1150,7 @@ static int8_t SCSI_Write10 (uint8_t lun , uint8_t *params)
     }
     
     /* Check whether Media is ready */
-    if(USBD_STORAGE_fops->IsReady(lun) !=0 )
+    if((USBD_STORAGE_fops->IsReady(lun) !=0 ) || SCSI_media_busy)
     {
       SCSI_SenseCode(lun,
                      NOT_READY, 
@@ -543,37 +1168,34 @@ static int8_t SCSI_Write10 (uint8_t lun , uint8_t *params)
     } 
     
     
-    SCSI_blk_addr = (params[2] << 24) | \
-      (params[3] << 16) | \
-        (params[4] <<  8) | \
-          params[5];
-    SCSI_blk_len = (params[7] <<  8) | \
-      params[8];  
-    
     /* check if LBA address is in the right range */
-    if(SCSI_CheckAddressRange(lun, SCSI_blk_addr, SCSI_blk_len) < 0)
+    if(SCSI_DecodeRW(lun, params) < 0)
     {
       return -1; /* error */      
     }
     
-    SCSI_blk_addr *= SCSI_blk_size;
-    SCSI_blk_len  *= SCSI_blk_size;
-    
     /* cases 3,11,13 : Hn,Ho <> D0 */
-    if (MSC_BOT_cbw.dDataLength != SCSI_blk_len)
+    if ((SCSI_blk_len > (0xFFFFFFFF / SCSI_cur->blk_size)) ||
+        (MSC_BOT_cbw.dDataLength != SCSI_blk_len * SCSI_cur->blk_size))
     {
       SCSI_SenseCode(MSC_BOT_cbw.bLUN, 
                      ILLEGAL_REQUEST, 
                      INVALID_CDB);
       return -1;
     }
+    SCSI_blk_len *= SCSI_cur->blk_size;
+    
+#ifdef MSC_READ_AHEAD_ENABLED
+    SCSI_ra_len = 0;
+#endif
     
     /* Prepare EP to receive first data packet */
     MSC_BOT_State = BOT_DATA_OUT;  
-    DCD_EP_PrepareRx (cdev,
-                      MSC_OUT_EP,
-                      MSC_BOT_Data, 
-                      MIN (SCSI_blk_len, MSC_MEDIA_PACKET));  
+    SCSI_buf_idx   = 0;
+    SCSI_buf_ready = 0;
+    SCSI_usb_busy  = 0;
+    SCSI_rx_len    = SCSI_blk_len;
+    return SCSI_WritePump(lun);
   }
   else /* Write Process ongoing */
   {
@@ -606,6 +1228,45 @@ static int8_t SCSI_Verify10(uint8_t lun , uint8_t *params){
   return 0;
 }
 
+/**
+* @brief  SCSI_DecodeRW
+*         Get the block address and the number of blocks of a Read/Write
+*         command into SCSI_blk_addr and SCSI_blk_len, and check the range
+* @param  lun: Logical unit number
+* @param  params: Command parameters
+* @retval status
+*/
+static int8_t SCSI_DecodeRW (uint8_t lun , uint8_t *params)
+{
+  switch (params[0])
+  {
+  case SCSI_READ10:
+  case SCSI_WRITE10:
+    SCSI_blk_addr = SCSI_BE32(&params[2]);
+    SCSI_blk_len  = SCSI_BE16(&params[7]);
+    break;
+    
+  case SCSI_READ12:
+  case SCSI_WRITE12:
+    SCSI_blk_addr = SCSI_BE32(&params[2]);
+    SCSI_blk_len  = SCSI_BE32(&params[6]);
+    break;
+    
+  default:
+    /* 64-bit LBA: the storage interface addresses 32-bit LBAs only */
+    if (SCSI_BE32(&params[2]) != 0)
+    {
+      SCSI_SenseCode(lun, ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE);
+      return -1;
+    }
+    SCSI_blk_addr = SCSI_BE32(&params[6]);
+    SCSI_blk_len  = SCSI_BE32(&params[10]);
+    break;
+  }
+  
+  return SCSI_CheckAddressRange(lun, SCSI_blk_addr, SCSI_blk_len);
+}
+
 /**
 * @brief  SCSI_CheckAddressRange
 *         Check address range
@@ -614,10 +1275,10 @@ static int8_t SCSI_Verify10(uint8_t lun , uint8_t *params){
 * @param  blk_nbr: number of block to be processed
 * @retval status
 */
-static int8_t SCSI_CheckAddressRange (uint8_t lun , uint32_t blk_offset , uint16_t blk_nbr)
+static int8_t SCSI_CheckAddressRange (uint8_t lun , uint32_t blk_offset , uint32_t blk_nbr)
 {
   
-  if ((blk_offset + blk_nbr) > SCSI_blk_nbr )
+  if ((blk_nbr > SCSI_cur->blk_nbr) || (blk_offset > (SCSI_cur->blk_nbr - blk_nbr)))
   {
     SCSI_SenseCode(lun, ILLEGAL_REQUEST, ADDRESS_OUT_OF_RANGE);
     return -1;
@@ -627,90 +1288,383 @@ static int8_t SCSI_CheckAddressRange (uint8_t lun , uint32_t blk_offset , uint16
 
 /**
 * @brief  SCSI_ProcessRead
-*         Handle Read Process
+*         Handle Read Process: called when a Read command starts and each time a
+*         buffer has been sent
 * @param  lun: Logical unit number
 * @retval status
 */
 static int8_t SCSI_ProcessRead (uint8_t lun)
+{
+  SCSI_usb_busy = 0;
+  return SCSI_ReadPump(lun);
+}
+
+/**
+* @brief  SCSI_ReadPump
+*         Send the next buffer read from the media, and read ahead into the
+*         free ones while it is on the wire. The IN endpoint NAKs while no
+*         buffer is ready.
+* @param  lun: Logical unit number
+* @retval status
+*/
+static int8_t SCSI_ReadPump (uint8_t lun)
 {
   uint32_t len;
+  int8_t   status;
   
-  len = MIN(SCSI_blk_len , MSC_MEDIA_PACKET); 
-  
-  if( USBD_STORAGE_fops->Read(lun ,
-                              MSC_BOT_Data, 
-                              SCSI_blk_addr / SCSI_blk_size, 
-                              len / SCSI_blk_size) < 0)
+  while (1)
   {
-    
-    SCSI_SenseCode(lun, HARDWARE_ERROR, UNRECOVERED_READ_ERROR);
-    return -1; 
+    if ((SCSI_usb_busy == 0) && (SCSI_buf_ready > 0))
+    {
+      len = MIN(MSC_BOT_csw.dDataResidue , SCSI_cur->packet); 
+      
+      DCD_EP_Tx (cdev, 
+                 MSC_IN_EP,
+                 SCSI_BUF(SCSI_buf_idx),
+                 len);
+      
+      SCSI_usb_busy = 1;
+      SCSI_buf_idx = SCSI_BUF_NEXT(SCSI_buf_idx);
+      SCSI_buf_ready--;
+      
+      /* case 6 : Hi = Di */
+      MSC_BOT_csw.dDataResidue -= len;
+      
+      if (MSC_BOT_csw.dDataResidue == 0)
+      {
+        MSC_BOT_State = BOT_LAST_DATA_IN;
+        return 0;
+      }
+    }
+    else if ((SCSI_media_busy == 0) && (SCSI_blk_len > 0) &&
+             (SCSI_usb_busy + SCSI_buf_ready < SCSI_cur->buf_num))
+    {
+      len = MIN(SCSI_blk_len , SCSI_cur->packet); 
+      status = SCSI_MediaRead(lun, 
+                              SCSI_BUF((SCSI_buf_idx + SCSI_buf_ready) % SCSI_cur->buf_num),
+                              len);
+      if (status < 0)
+      {
+        if ((SCSI_usb_busy == 0) && (SCSI_buf_ready == 0))
+        {
+          SCSI_SenseCode(lun, HARDWARE_ERROR, UNRECOVERED_READ_ERROR);
+          return -1; 
+        }
+        /* Read ahead: tried again once the current buffer is sent */
+        return 0;
+      }
+      if (status > 0)
+      {
+        /* Resumed by USBD_STORAGE_Complete */
+        return 0;
+      }
+      SCSI_ReadDone(len);
+    }
+    else
+    {
+      return 0;
+    }
   }
+}
+
+#ifdef MSC_READ_AHEAD_ENABLED
+/**
+* @brief  SCSI_ReadAhead
+*         Prefetch the packet following the last READ when it continued the
+*         previous one. Called once its CSW is armed, so that the media access
+*         overlaps the CSW and the next CBW.
+* @param  None
+* @retval None
+*/
+void SCSI_ReadAhead (void)
+{
+  uint32_t len;
+  int8_t   status;
   
+  if ((SCSI_ra_seq == 0) || (SCSI_media_busy) || (SCSI_cur->buf_num < 2) ||
+      (SCSI_cur->blk_size == 0) || (SCSI_ra_next >= SCSI_cur->blk_nbr))
+  {
+    return;
+  }
   
-  DCD_EP_Tx (cdev, 
-             MSC_IN_EP,
-             MSC_BOT_Data,
-             len);
-  
+  len = SCSI_cur->packet;
+  if ((SCSI_cur->blk_nbr - SCSI_ra_next) < (SCSI_cur->packet / SCSI_cur->blk_size))
+  {
+    len = (SCSI_cur->blk_nbr - SCSI_ra_next) * SCSI_cur->blk_size;
+  }
   
-  SCSI_blk_addr   += len; 
-  SCSI_blk_len    -= len;  
+#ifdef MSC_CACHE_ENABLED
+  status = MSC_Cache_Read(SCSI_ra_lun, 
+                          SCSI_BUF(SCSI_RA_BUF), 
+                          SCSI_ra_next, 
+                          len / SCSI_cur->blk_size, 
+                          SCSI_cur->blk_size);
+#else
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  if (USBD_STORAGE_fops->ReadAsync != NULL)
+  {
+    /* No blocking access in the interrupt path of an asynchronous media */
+    return;
+  }
+#endif
+  status = USBD_STORAGE_fops->Read(SCSI_ra_lun, 
+                                   SCSI_BUF(SCSI_RA_BUF), 
+                                   SCSI_ra_next, 
+                                   len / SCSI_cur->blk_size);
+#endif
   
-  /* case 6 : Hi = Di */
-  MSC_BOT_csw.dDataResidue -= len;
+  if (status == 0)
+  {
+    SCSI_ra_len = len;
+  }
+}
+#endif /* MSC_READ_AHEAD_ENABLED */
+
+/**
+* @brief  SCSI_MediaRead
+*         Read a chunk from the media
+* @param  lun: Logical unit number
+* @param  buf: data stage buffer
+* @param  len: No. of bytes
+* @retval 0 when done, 1 when started in the background, -1 on error
+*/
+static int8_t SCSI_MediaRead (uint8_t lun, uint8_t *buf, uint32_t len)
+{
+#ifdef MSC_CACHE_ENABLED
+  return MSC_Cache_Read(lun, 
+                        buf, 
+                        SCSI_blk_addr, 
+                        len / SCSI_cur->blk_size, 
+                        SCSI_cur->blk_size);
+#else
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  if (USBD_STORAGE_fops->ReadAsync != NULL)
+  {
+    if (USBD_STORAGE_fops->ReadAsync(lun ,
+                                     buf, 
+                                     SCSI_blk_addr, 
+                                     len / SCSI_cur->blk_size) < 0)
+    {
+      return -1;
+    }
+    SCSI_media_busy = 1;
+    SCSI_media_len = len;
+    return 1;
+  }
+#endif
   
-  if (SCSI_blk_len == 0)
+  if( USBD_STORAGE_fops->Read(lun ,
+                              buf, 
+                              SCSI_blk_addr, 
+                              len / SCSI_cur->blk_size) < 0)
   {
-    MSC_BOT_State = BOT_LAST_DATA_IN;
+    return -1; 
   }
   return 0;
+#endif /* MSC_CACHE_ENABLED */
+}
+
+/**
+* @brief  SCSI_ReadDone
+*         Account a chunk read from the media
+* @param  len: No. of bytes
+* @retval None
+*/
+static void SCSI_ReadDone (uint32_t len)
+{
+  SCSI_blk_addr   += len / SCSI_cur->blk_size; 
+  SCSI_blk_len    -= len;  
+  SCSI_buf_ready++;
 }
 
 /**
 * @brief  SCSI_ProcessWrite
-*         Handle Write Process
+*         Handle Write Process: called each time a packet has been received
 * @param  lun: Logical unit number
 * @retval status
 */
 
 static int8_t SCSI_ProcessWrite (uint8_t lun)
+{
+  SCSI_usb_busy = 0;
+  SCSI_buf_ready++;
+  return SCSI_WritePump(lun);
+}
+
+/**
+* @brief  SCSI_WritePump
+*         Receive the next packet into a free buffer while the received ones
+*         are written to the media. The OUT endpoint NAKs while no buffer is
+*         free.
+* @param  lun: Logical unit number
+* @retval status
+*/
+static int8_t SCSI_WritePump (uint8_t lun)
 {
   uint32_t len;
+  int8_t   status;
   
-  len = MIN(SCSI_blk_len , MSC_MEDIA_PACKET); 
+  while (1)
+  {
+    if ((SCSI_usb_busy == 0) && (SCSI_rx_len > 0) &&
+        (SCSI_buf_ready < SCSI_cur->buf_num))
+    {
+      len = MIN(SCSI_rx_len , SCSI_cur->packet); 
+      
+      /* Prapare EP to Receive next packet */
+      DCD_EP_PrepareRx (cdev,
+                        MSC_OUT_EP,
+                        SCSI_BUF((SCSI_buf_idx + SCSI_buf_ready) % SCSI_cur->buf_num), 
+                        len); 
+      SCSI_usb_busy = 1;
+      SCSI_rx_len -= len;
+    }
+    else if ((SCSI_media_busy == 0) && (SCSI_buf_ready > 0))
+    {
+      len = MIN(SCSI_blk_len , SCSI_cur->packet); 
+      status = SCSI_MediaWrite(lun, SCSI_BUF(SCSI_buf_idx), len);
+      if (status < 0)
+      {
+        SCSI_SenseCode(lun, HARDWARE_ERROR, WRITE_FAULT);     
+        return -1; 
+      }
+      if (status > 0)
+      {
+        /* Resumed by USBD_STORAGE_Complete */
+        return 0;
+      }
+      SCSI_WriteDone(len);
+      
+      if (SCSI_blk_len == 0)
+      {
+        SCSI_StatusCb (cdev, CSW_CMD_PASSED);
+        return 0;
+      }
+    }
+    else
+    {
+      return 0;
+    }
+  }
+}
+
+/**
+* @brief  SCSI_MediaWrite
+*         Write a received packet to the media
+* @param  lun: Logical unit number
+* @param  buf: data stage buffer
+* @param  len: No. of bytes
+* @retval 0 when done, 1 when started in the background, -1 on error
+*/
+static int8_t SCSI_MediaWrite (uint8_t lun, uint8_t *buf, uint32_t len)
+{
+#ifdef MSC_CACHE_ENABLED
+  return MSC_Cache_Write(lun, 
+                         buf, 
+                         SCSI_blk_addr, 
+                         len / SCSI_cur->blk_size, 
+                         SCSI_cur->blk_size);
+#else
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  if (USBD_STORAGE_fops->WriteAsync != NULL)
+  {
+    if (USBD_STORAGE_fops->WriteAsync(lun ,
+                                      buf, 
+                                      SCSI_blk_addr, 
+                                      len / SCSI_cur->blk_size) < 0)
+    {
+      return -1;
+    }
+    SCSI_media_busy = 1;
+    SCSI_media_len = len;
+    return 1;
+  }
+#endif
   
   if(USBD_STORAGE_fops->Write(lun ,
-                              MSC_BOT_Data, 
-                              SCSI_blk_addr / SCSI_blk_size, 
-                              len / SCSI_blk_size) < 0)
+                              buf, 
+                              SCSI_blk_addr, 
+                              len / SCSI_cur->blk_size) < 0)
   {
-    SCSI_SenseCode(lun, HARDWARE_ERROR, WRITE_FAULT);     
     return -1; 
   }
-  
-  
-  SCSI_blk_addr  += len; 
+  return 0;
+#endif /* MSC_CACHE_ENABLED */
+}
+
+/**
+* @brief  SCSI_WriteDone
+*         Account a packet written to the media
+* @param  len: No. of bytes
+* @retval None
+*/
+static void SCSI_WriteDone (uint32_t len)
+{
+  SCSI_blk_addr  += len / SCSI_cur->blk_size; 
   SCSI_blk_len   -= len; 
+  SCSI_buf_idx = SCSI_BUF_NEXT(SCSI_buf_idx);
+  SCSI_buf_ready--;
   
   /* case 12 : Ho = Do */
   MSC_BOT_csw.dDataResidue -= len;
+}
+
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+/**
+* @brief  USBD_STORAGE_Complete
+*         Resume the data stage at the end of a ReadAsync/WriteAsync access.
+*         Must be called with the same priority as the OTG interrupt.
+* @param  lun: Logical unit number
+* @param  status: 0 when the access succeeded, -1 otherwise
+* @retval None
+*/
+void USBD_STORAGE_Complete (uint8_t lun, int8_t status)
+{
+  if (SCSI_media_busy == 0)
+  {
+    return;
+  }
+  SCSI_media_busy = 0;
   
-  if (SCSI_blk_len == 0)
+  if (MSC_BOT_State == BOT_DATA_IN)
   {
-    MSC_BOT_SendCSW (cdev, CSW_CMD_PASSED);
+    if (status == 0)
+    {
+      SCSI_ReadDone(SCSI_media_len);
+    }
+    else if ((SCSI_usb_busy == 0) && (SCSI_buf_ready == 0))
+    {
+      SCSI_SenseCode(lun, HARDWARE_ERROR, UNRECOVERED_READ_ERROR);
+      SCSI_StatusCb (cdev, CSW_CMD_FAILED);
+      return;
+    }
+    
+    if (SCSI_ReadPump(lun) < 0)
+    {
+      SCSI_StatusCb (cdev, CSW_CMD_FAILED);
+    }
   }
-  else
+  else if (MSC_BOT_State == BOT_DATA_OUT)
   {
-    /* Prapare EP to Receive next packet */
-    DCD_EP_PrepareRx (cdev,
-                      MSC_OUT_EP,
-                      MSC_BOT_Data, 
-                      MIN (SCSI_blk_len, MSC_MEDIA_PACKET)); 
+    if (status != 0)
+    {
+      SCSI_SenseCode(lun, HARDWARE_ERROR, WRITE_FAULT);     
+      SCSI_StatusCb (cdev, CSW_CMD_FAILED);
+      return;
+    }
+    
+    SCSI_WriteDone(SCSI_media_len);
+    if (SCSI_blk_len == 0)
+    {
+      SCSI_StatusCb (cdev, CSW_CMD_PASSED);
+    }
+    else if (SCSI_WritePump(lun) < 0)
+    {
+      SCSI_StatusCb (cdev, CSW_CMD_FAILED);
+    }
   }
-  
-  return 0;
 }
+#endif
 /**
   * @}
   */ 
@@ -0,0 +1,435 @@
+/**
+  ******************************************************************************
+  * @file    usbd_storage_bench.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Synthetic storage backend measuring the BOT/SCSI path: reads
+  *          return a pattern generated on the fly, writes are dropped, and
+  *          every command is timed with the DWT cycle counter from its CBW
+  *          to its CSW.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_core.h"
+#include "usbd_msc_bench.h"
+#include "usbd_msc_scsi.h"
+#ifdef USBD_PERF_ENABLED
+#include "usbd_perf.h"
+#endif
+
+#ifdef MSC_BENCH_ENABLED
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define STORAGE_LUN_NBR                  1
+
+/* DWT registers (not described by this CMSIS version) */
+#define BENCH_DWT_CTRL                   (*(__IO uint32_t *)0xE0001000)
+#define BENCH_DWT_CYCCNT                 (*(__IO uint32_t *)0xE0001004)
+#define BENCH_DWT_CYCCNTENA              0x00000001
+
+/* Private macro -------------------------------------------------------------*/
+#define BENCH_CYCLES()                   (BENCH_DWT_CYCCNT)
+
+/* Private variables ---------------------------------------------------------*/
+MSC_Bench_Stat_TypeDef  MSC_Bench_Stat[MSC_BENCH_CLASSES];
+
+/* Command being timed */
+static uint8_t   Bench_class;
+static uint8_t   Bench_running;
+static uint32_t  Bench_start;
+static uint32_t  Bench_media;
+static uint32_t  Bench_bytes;
+
+/* Private function prototypes -----------------------------------------------*/
+int8_t BENCH_Init (uint8_t lun);
+
+int8_t BENCH_GetCapacity (uint8_t lun,
+                          uint32_t *block_num,
+                          uint32_t *block_size);
+
+int8_t  BENCH_IsReady (uint8_t lun);
+
+int8_t  BENCH_IsWriteProtected (uint8_t lun);
+
+int8_t BENCH_Read (uint8_t lun,
+                   uint8_t *buf,
+                   uint32_t blk_addr,
+                   uint16_t blk_len);
+
+int8_t BENCH_Write (uint8_t lun,
+                    uint8_t *buf,
+                    uint32_t blk_addr,
+                    uint16_t blk_len);
+
+int8_t BENCH_GetMaxLun (void);
+
+static void Bench_PutNumber (void (*Write)(uint8_t *buf, uint32_t len),
+                             const char *label,
+                             uint32_t value);
+static void Bench_PutString (void (*Write)(uint8_t *buf, uint32_t len),
+                             const char *str);
+
+/* USB Mass storage Standard Inquiry Data */
+const int8_t  BENCH_Inquirydata[] = {//36
+
+  /* LUN 0 */
+  0x00,
+  0x80,
+  0x02,
+  0x02,
+  (USBD_STD_INQUIRY_LENGTH - 5),
+  0x00,
+  0x00,
+  0x00,
+  'S', 'T', 'M', ' ', ' ', ' ', ' ', ' ', /* Manufacturer : 8 bytes */
+  'M', 'S', 'C', ' ', 'B', 'e', 'n', 'c', /* Product      : 16 Bytes */
+  'h', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+  '0', '.', '0' ,'1',                     /* Version      : 4 Bytes */
+};
+
+USBD_STORAGE_cb_TypeDef USBD_BENCH_fops =
+{
+  BENCH_Init,
+  BENCH_GetCapacity,
+  BENCH_IsReady,
+  BENCH_IsWriteProtected,
+  BENCH_Read,
+  BENCH_Write,
+  BENCH_GetMaxLun,
+  (int8_t *)BENCH_Inquirydata,
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  NULL,                 /* ReadAsync: Read is used */
+  NULL,                 /* WriteAsync: Write is used */
+#endif
+#ifdef MSC_UNMAP_ENABLED
+  NULL,                 /* Unmap: not supported */
+#endif
+
+};
+
+USBD_STORAGE_cb_TypeDef  *USBD_STORAGE_fops = &USBD_BENCH_fops;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+* @brief  BENCH_Init
+*         Start the DWT cycle counter
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t BENCH_Init (uint8_t lun)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  BENCH_DWT_CTRL |= BENCH_DWT_CYCCNTENA;
+  return (0);
+}
+
+/**
+* @brief  BENCH_GetCapacity
+*         Geometry of the synthetic medium
+* @param  lun: Logical unit number
+* @param  block_num: number of blocks
+* @param  block_size: block size
+* @retval status
+*/
+int8_t BENCH_GetCapacity (uint8_t lun, uint32_t *block_num, uint32_t *block_size)
+{
+  *block_num  = MSC_BENCH_BLK_NBR;
+  *block_size = MSC_BENCH_BLK_SIZE;
+  return (0);
+}
+
+/**
+* @brief  BENCH_IsReady
+*         The medium is always present
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t  BENCH_IsReady (uint8_t lun)
+{
+  return (0);
+}
+
+/**
+* @brief  BENCH_IsWriteProtected
+*         The medium accepts writes
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t  BENCH_IsWriteProtected (uint8_t lun)
+{
+  return  0;
+}
+
+/**
+* @brief  BENCH_Read
+*         Generate the pattern of the blocks: each word holds its byte
+*         address on the medium, so the host can check what it reads
+* @param  lun: Logical unit number
+* @param  buf: data buffer
+* @param  blk_addr: first block
+* @param  blk_len: number of blocks
+* @retval status
+*/
+int8_t BENCH_Read (uint8_t lun,
+                   uint8_t *buf,
+                   uint32_t blk_addr,
+                   uint16_t blk_len)
+{
+  uint32_t start = BENCH_CYCLES();
+  uint32_t addr  = blk_addr * MSC_BENCH_BLK_SIZE;
+  uint32_t len   = (uint32_t)blk_len * MSC_BENCH_BLK_SIZE;
+  uint32_t i;
+
+  for (i = 0; i < len; i += 4)
+  {
+    buf[i]     = (uint8_t)(addr + i);
+    buf[i + 1] = (uint8_t)((addr + i) >> 8);
+    buf[i + 2] = (uint8_t)((addr + i) >> 16);
+    buf[i + 3] = (uint8_t)((addr + i) >> 24);
+  }
+
+  Bench_media += BENCH_CYCLES() - start;
+  Bench_bytes += len;
+  return 0;
+}
+
+/**
+* @brief  BENCH_Write
+*         Drop the written blocks; with USBD_PERF_ENABLED they are first
+*         checked against the pattern of BENCH_Read
+* @param  lun: Logical unit number
+* @param  buf: data buffer
+* @param  blk_addr: first block
+* @param  blk_len: number of blocks
+* @retval status
+*/
+int8_t BENCH_Write (uint8_t lun,
+                    uint8_t *buf,
+                    uint32_t blk_addr,
+                    uint16_t blk_len)
+{
+#ifdef USBD_PERF_ENABLED
+  uint32_t start = BENCH_CYCLES();
+
+  USBD_Perf_Check(buf, (uint32_t)blk_len * MSC_BENCH_BLK_SIZE,
+                  blk_addr * MSC_BENCH_BLK_SIZE);
+  Bench_media += BENCH_CYCLES() - start;
+#endif
+  Bench_bytes += (uint32_t)blk_len * MSC_BENCH_BLK_SIZE;
+  return (0);
+}
+
+/**
+* @brief  BENCH_GetMaxLun
+*         Return the highest logical unit number
+* @param  None
+* @retval Max. LUN
+*/
+int8_t BENCH_GetMaxLun (void)
+{
+  return (STORAGE_LUN_NBR - 1);
+}
+
+/**
+* @brief  MSC_Bench_Reset
+*         Clear the statistics
+* @param  None
+* @retval None
+*/
+void MSC_Bench_Reset (void)
+{
+  uint32_t i;
+  uint8_t *p = (uint8_t *)MSC_Bench_Stat;
+
+  for (i = 0; i < sizeof(MSC_Bench_Stat); i++)
+  {
+    p[i] = 0;
+  }
+  Bench_running = 0;
+}
+
+/**
+* @brief  MSC_Bench_CmdStart
+*         Start timing a command, called when its CBW arrives
+* @param  opcode: SCSI operation code
+* @retval None
+*/
+void MSC_Bench_CmdStart (uint8_t opcode)
+{
+  switch (opcode)
+  {
+  case SCSI_READ10:
+  case SCSI_READ12:
+  case SCSI_READ16:
+    Bench_class = MSC_BENCH_READ;
+    break;
+
+  case SCSI_WRITE10:
+  case SCSI_WRITE12:
+  case SCSI_WRITE16:
+    Bench_class = MSC_BENCH_WRITE;
+    break;
+
+  default:
+    Bench_class = MSC_BENCH_OTHER;
+    break;
+  }
+
+  Bench_media   = 0;
+  Bench_bytes   = 0;
+  Bench_running = 1;
+  Bench_start   = BENCH_CYCLES();
+}
+
+/**
+* @brief  MSC_Bench_CmdEnd
+*         Account the command, called when its CSW is sent
+* @param  None
+* @retval None
+*/
+void MSC_Bench_CmdEnd (void)
+{
+  MSC_Bench_Stat_TypeDef *st;
+  uint32_t cycles;
+  uint8_t  bin = 0;
+
+  if (Bench_running == 0)
+  {
+    return;
+  }
+  cycles = BENCH_CYCLES() - Bench_start;
+  Bench_running = 0;
+
+  st = &MSC_Bench_Stat[Bench_class];
+  if ((st->count == 0) || (cycles < st->min))
+  {
+    st->min = cycles;
+  }
+  if (cycles > st->max)
+  {
+    st->max = cycles;
+  }
+  st->count++;
+  st->bytes += Bench_bytes;
+  st->total += cycles;
+  st->media += Bench_media;
+
+  while ((cycles >> 1) && (bin < MSC_BENCH_HIST_BINS - 1))
+  {
+    cycles >>= 1;
+    bin++;
+  }
+  st->hist[bin]++;
+}
+
+/**
+* @brief  MSC_Bench_Report
+*         Print the statistics as text lines, e.g. through the CDC class or
+*         ITM/SWO
+* @param  Write: output function
+* @retval None
+*/
+void MSC_Bench_Report (void (*Write)(uint8_t *buf, uint32_t len))
+{
+  static const char * const name[MSC_BENCH_CLASSES] = {"READ", "WRITE", "OTHER"};
+  MSC_Bench_Stat_TypeDef *st;
+  uint8_t c;
+  uint8_t bin;
+
+  for (c = 0; c < MSC_BENCH_CLASSES; c++)
+  {
+    st = &MSC_Bench_Stat[c];
+    Bench_PutString(Write, name[c]);
+    Bench_PutNumber(Write, " n=", st->count);
+    if (st->count > 0)
+    {
+      Bench_PutNumber(Write, " bytes=", st->bytes);
+      Bench_PutNumber(Write, " min=", st->min);
+      Bench_PutNumber(Write, " max=", st->max);
+      Bench_PutNumber(Write, " avg=", (uint32_t)(st->total / st->count));
+      Bench_PutNumber(Write, " media=", (uint32_t)(st->media / st->count));
+      Bench_PutNumber(Write, " usb=", (uint32_t)((st->total - st->media) / st->count));
+    }
+    Bench_PutString(Write, "\r\n");
+
+    for (bin = 0; bin < MSC_BENCH_HIST_BINS; bin++)
+    {
+      if (st->hist[bin] != 0)
+      {
+        Bench_PutNumber(Write, "  2^", bin);
+        Bench_PutNumber(Write, ": ", st->hist[bin]);
+        Bench_PutString(Write, "\r\n");
+      }
+    }
+  }
+}
+
+/**
+* @brief  Bench_PutNumber
+*         Print a label and a decimal number
+* @param  Write: output function
+* @param  label: text printed first
+* @param  value: number
+* @retval None
+*/
+static void Bench_PutNumber (void (*Write)(uint8_t *buf, uint32_t len),
+                             const char *label,
+                             uint32_t value)
+{
+  uint8_t buf[10];
+  uint8_t i = sizeof(buf);
+
+  Bench_PutString(Write, label);
+  do
+  {
+    buf[--i] = '0' + (value % 10);
+    value /= 10;
+  }
+  while (value != 0);
+  Write(&buf[i], sizeof(buf) - i);
+}
+
+/**
+* @brief  Bench_PutString
+*         Print a string
+* @param  Write: output function
+* @param  str: string
+* @retval None
+*/
+static void Bench_PutString (void (*Write)(uint8_t *buf, uint32_t len),
+                             const char *str)
+{
+  uint32_t len = 0;
+
+  while (str[len] != 0)
+  {
+    len++;
+  }
+  Write((uint8_t *)str, len);
+}
+
+#endif /* MSC_BENCH_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,240 @@
+/**
+  ******************************************************************************
+  * @file    usbd_storage_nand.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Storage backend of a NAND memory on the FSMC, through the NAND
+  *          flash translation layer of the standard peripheral library
+  *          (stm32f2xx_nand_ftl.c / stm32f4xx_nand_ftl.c). The application
+  *          initializes and mounts the FTL, then gives it with
+  *          MSC_NAND_Attach() before connecting the device.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc_nand.h"
+
+#ifdef MSC_NAND_ENABLED
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define STORAGE_LUN_NBR                  1
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static NAND_FTL_TypeDef *NAND_Ftl = NULL;
+
+/* Private function prototypes -----------------------------------------------*/
+int8_t NAND_Init (uint8_t lun);
+
+int8_t NAND_GetCapacity (uint8_t lun,
+                         uint32_t *block_num,
+                         uint32_t *block_size);
+
+int8_t  NAND_IsReady (uint8_t lun);
+
+int8_t  NAND_IsWriteProtected (uint8_t lun);
+
+int8_t NAND_Read (uint8_t lun,
+                  uint8_t *buf,
+                  uint32_t blk_addr,
+                  uint16_t blk_len);
+
+int8_t NAND_Write (uint8_t lun,
+                   uint8_t *buf,
+                   uint32_t blk_addr,
+                   uint16_t blk_len);
+
+int8_t NAND_GetMaxLun (void);
+
+/* USB Mass storage Standard Inquiry Data */
+const int8_t  NAND_Inquirydata[] = {//36
+
+  /* LUN 0 */
+  0x00,
+  0x80,
+  0x02,
+  0x02,
+  (USBD_STD_INQUIRY_LENGTH - 5),
+  0x00,
+  0x00,
+  0x00,
+  'S', 'T', 'M', ' ', ' ', ' ', ' ', ' ', /* Manufacturer : 8 bytes */
+  'N', 'A', 'N', 'D', ' ', 'F', 'l', 'a', /* Product      : 16 Bytes */
+  's', 'h', ' ', ' ', ' ', ' ', ' ', ' ',
+  '1', '.', '0' ,'0',                     /* Version      : 4 Bytes */
+};
+
+USBD_STORAGE_cb_TypeDef USBD_NAND_fops =
+{
+  NAND_Init,
+  NAND_GetCapacity,
+  NAND_IsReady,
+  NAND_IsWriteProtected,
+  NAND_Read,
+  NAND_Write,
+  NAND_GetMaxLun,
+  (int8_t *)NAND_Inquirydata,
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  NULL,                 /* ReadAsync: Read is used */
+  NULL,                 /* WriteAsync: Write is used */
+#endif
+#ifdef MSC_UNMAP_ENABLED
+  NULL,                 /* Unmap: not supported */
+#endif
+
+};
+
+USBD_STORAGE_cb_TypeDef  *USBD_STORAGE_fops = &USBD_NAND_fops;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+* @brief  MSC_NAND_Attach
+*         Give the mounted FTL to the storage backend
+* @param  ftl: NAND FTL instance, or NULL to report the medium as absent
+* @retval None
+*/
+void MSC_NAND_Attach (NAND_FTL_TypeDef *ftl)
+{
+  NAND_Ftl = ftl;
+}
+
+/**
+* @brief  NAND_Init
+*         The FTL is initialized by the application
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t NAND_Init (uint8_t lun)
+{
+  return (0);
+}
+
+/**
+* @brief  NAND_GetCapacity
+*         Return the capacity of the FTL, in 512-byte sectors
+* @param  lun: Logical unit number
+* @param  block_num: number of blocks
+* @param  block_size: block size
+* @retval status
+*/
+int8_t NAND_GetCapacity (uint8_t lun, uint32_t *block_num, uint32_t *block_size)
+{
+  if ((NAND_Ftl == NULL) || (NAND_Ftl->Mounted == 0))
+  {
+    return (-1);
+  }
+  *block_num  = NAND_FTL_GetSectorCount(NAND_Ftl);
+  *block_size = NAND_FTL_SECTOR_SIZE;
+  return (0);
+}
+
+/**
+* @brief  NAND_IsReady
+*         The medium is present once the FTL is attached and mounted. The
+*         write cache of the FTL is programmed here: the hosts poll TEST
+*         UNIT READY, and the next command checks the medium first
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t  NAND_IsReady (uint8_t lun)
+{
+  if ((NAND_Ftl == NULL) || (NAND_Ftl->Mounted == 0) ||
+      (NAND_FTL_Flush(NAND_Ftl) != SUCCESS))
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+/**
+* @brief  NAND_IsWriteProtected
+*         The medium accepts writes
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t  NAND_IsWriteProtected (uint8_t lun)
+{
+  return  0;
+}
+
+/**
+* @brief  NAND_Read
+*         Read sectors through the FTL
+* @param  lun: Logical unit number
+* @param  buf: data buffer
+* @param  blk_addr: first sector
+* @param  blk_len: number of sectors
+* @retval status
+*/
+int8_t NAND_Read (uint8_t lun,
+                  uint8_t *buf,
+                  uint32_t blk_addr,
+                  uint16_t blk_len)
+{
+  if ((NAND_Ftl == NULL) || (NAND_Ftl->Mounted == 0) ||
+      (NAND_FTL_Read(NAND_Ftl, buf, blk_addr, blk_len) != SUCCESS))
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+/**
+* @brief  NAND_Write
+*         Write sectors through the FTL. The last partial page stays in the
+*         write cache, so that a data stage packet smaller than a page does
+*         not program the page several times
+* @param  lun: Logical unit number
+* @param  buf: data buffer
+* @param  blk_addr: first sector
+* @param  blk_len: number of sectors
+* @retval status
+*/
+int8_t NAND_Write (uint8_t lun,
+                   uint8_t *buf,
+                   uint32_t blk_addr,
+                   uint16_t blk_len)
+{
+  if ((NAND_Ftl == NULL) || (NAND_Ftl->Mounted == 0) ||
+      (NAND_FTL_Write(NAND_Ftl, buf, blk_addr, blk_len) != SUCCESS))
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+/**
+* @brief  NAND_GetMaxLun
+*         Return the highest logical unit number
+* @param  None
+* @retval Max. LUN
+*/
+int8_t NAND_GetMaxLun (void)
+{
+  return (STORAGE_LUN_NBR - 1);
+}
+
+#endif /* MSC_NAND_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,241 @@
+/**
+  ******************************************************************************
+  * @file    usbd_storage_spinor.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Storage backend of an SPI NOR flash, through the block device of
+  *          the SPI NOR flash driver of the STM32F4xx standard peripheral
+  *          library (stm32f4xx_spi_nor.c). The application initializes the
+  *          driver with a block device, then gives it with
+  *          MSC_SPI_NOR_Attach() before connecting the device.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_msc_spinor.h"
+
+#ifdef MSC_SPI_NOR_ENABLED
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define STORAGE_LUN_NBR                  1
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static SPI_NOR_TypeDef *SPI_NOR_Mem = NULL;
+
+/* Private function prototypes -----------------------------------------------*/
+int8_t SPI_NOR_STORAGE_Init (uint8_t lun);
+
+int8_t SPI_NOR_STORAGE_GetCapacity (uint8_t lun,
+                                    uint32_t *block_num,
+                                    uint32_t *block_size);
+
+int8_t  SPI_NOR_STORAGE_IsReady (uint8_t lun);
+
+int8_t  SPI_NOR_STORAGE_IsWriteProtected (uint8_t lun);
+
+int8_t SPI_NOR_STORAGE_Read (uint8_t lun,
+                             uint8_t *buf,
+                             uint32_t blk_addr,
+                             uint16_t blk_len);
+
+int8_t SPI_NOR_STORAGE_Write (uint8_t lun,
+                              uint8_t *buf,
+                              uint32_t blk_addr,
+                              uint16_t blk_len);
+
+int8_t SPI_NOR_STORAGE_GetMaxLun (void);
+
+/* USB Mass storage Standard Inquiry Data */
+const int8_t  SPI_NOR_Inquirydata[] = {//36
+
+  /* LUN 0 */
+  0x00,
+  0x80,
+  0x02,
+  0x02,
+  (USBD_STD_INQUIRY_LENGTH - 5),
+  0x00,
+  0x00,
+  0x00,
+  'S', 'T', 'M', ' ', ' ', ' ', ' ', ' ', /* Manufacturer : 8 bytes */
+  'S', 'P', 'I', ' ', 'N', 'O', 'R', ' ', /* Product      : 16 Bytes */
+  'F', 'l', 'a', 's', 'h', ' ', ' ', ' ',
+  '1', '.', '0' ,'0',                     /* Version      : 4 Bytes */
+};
+
+USBD_STORAGE_cb_TypeDef USBD_SPI_NOR_fops =
+{
+  SPI_NOR_STORAGE_Init,
+  SPI_NOR_STORAGE_GetCapacity,
+  SPI_NOR_STORAGE_IsReady,
+  SPI_NOR_STORAGE_IsWriteProtected,
+  SPI_NOR_STORAGE_Read,
+  SPI_NOR_STORAGE_Write,
+  SPI_NOR_STORAGE_GetMaxLun,
+  (int8_t *)SPI_NOR_Inquirydata,
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  NULL,                 /* ReadAsync: Read is used */
+  NULL,                 /* WriteAsync: Write is used */
+#endif
+#ifdef MSC_UNMAP_ENABLED
+  NULL,                 /* Unmap: not supported */
+#endif
+
+};
+
+USBD_STORAGE_cb_TypeDef  *USBD_STORAGE_fops = &USBD_SPI_NOR_fops;
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+* @brief  MSC_SPI_NOR_Attach
+*         Give the initialized SPI NOR flash to the storage backend
+* @param  nor: SPI NOR flash with a block device, or NULL to report the medium
+*         as absent
+* @retval None
+*/
+void MSC_SPI_NOR_Attach (SPI_NOR_TypeDef *nor)
+{
+  SPI_NOR_Mem = nor;
+}
+
+/**
+* @brief  SPI_NOR_STORAGE_Init
+*         The SPI NOR flash is initialized by the application
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t SPI_NOR_STORAGE_Init (uint8_t lun)
+{
+  return (0);
+}
+
+/**
+* @brief  SPI_NOR_STORAGE_GetCapacity
+*         Return the capacity of the block device, in 512-byte sectors
+* @param  lun: Logical unit number
+* @param  block_num: number of blocks
+* @param  block_size: block size
+* @retval status
+*/
+int8_t SPI_NOR_STORAGE_GetCapacity (uint8_t lun, uint32_t *block_num, uint32_t *block_size)
+{
+  if ((SPI_NOR_Mem == NULL) || (SPI_NOR_GetSectorCount(SPI_NOR_Mem) == 0))
+  {
+    return (-1);
+  }
+  *block_num  = SPI_NOR_GetSectorCount(SPI_NOR_Mem);
+  *block_size = SPI_NOR_SECTOR_SIZE;
+  return (0);
+}
+
+/**
+* @brief  SPI_NOR_STORAGE_IsReady
+*         The medium is present once the SPI NOR flash is attached. The
+*         erase sector held by the driver is programmed here: the hosts poll
+*         TEST UNIT READY, and the next command checks the medium first
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t  SPI_NOR_STORAGE_IsReady (uint8_t lun)
+{
+  if ((SPI_NOR_Mem == NULL) || (SPI_NOR_GetSectorCount(SPI_NOR_Mem) == 0) ||
+      (SPI_NOR_Flush(SPI_NOR_Mem) != SUCCESS))
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+/**
+* @brief  SPI_NOR_STORAGE_IsWriteProtected
+*         The medium accepts writes
+* @param  lun: Logical unit number
+* @retval status
+*/
+int8_t  SPI_NOR_STORAGE_IsWriteProtected (uint8_t lun)
+{
+  return  0;
+}
+
+/**
+* @brief  SPI_NOR_STORAGE_Read
+*         Read sectors of the block device
+* @param  lun: Logical unit number
+* @param  buf: data buffer
+* @param  blk_addr: first sector
+* @param  blk_len: number of sectors
+* @retval status
+*/
+int8_t SPI_NOR_STORAGE_Read (uint8_t lun,
+                             uint8_t *buf,
+                             uint32_t blk_addr,
+                             uint16_t blk_len)
+{
+  if ((SPI_NOR_Mem == NULL) ||
+      (SPI_NOR_ReadSectors(SPI_NOR_Mem, buf, blk_addr, blk_len) != SUCCESS))
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+/**
+* @brief  SPI_NOR_STORAGE_Write
+*         Write sectors of the block device. The sectors of one erase sector
+*         are gathered in the cache of the driver, so that the 4 KB sector is
+*         erased and programmed once
+* @param  lun: Logical unit number
+* @param  buf: data buffer
+* @param  blk_addr: first sector
+* @param  blk_len: number of sectors
+* @retval status
+*/
+int8_t SPI_NOR_STORAGE_Write (uint8_t lun,
+                              uint8_t *buf,
+                              uint32_t blk_addr,
+                              uint16_t blk_len)
+{
+  if ((SPI_NOR_Mem == NULL) ||
+      (SPI_NOR_WriteSectors(SPI_NOR_Mem, buf, blk_addr, blk_len) != SUCCESS))
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+/**
+* @brief  SPI_NOR_STORAGE_GetMaxLun
+*         Return the highest logical unit number
+* @param  None
+* @retval Max. LUN
+*/
+int8_t SPI_NOR_STORAGE_GetMaxLun (void)
+{
+  return (STORAGE_LUN_NBR - 1);
+}
+
+#endif /* MSC_SPI_NOR_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
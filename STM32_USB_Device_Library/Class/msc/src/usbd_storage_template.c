@@ -61,6 +61,12 @@ int8_t STORAGE_Write (uint8_t lun,
 
 int8_t STORAGE_GetMaxLun (void);
 
+#ifdef MSC_UNMAP_ENABLED
+int8_t STORAGE_Unmap (uint8_t lun, 
+                      uint32_t blk_addr,
+                      uint32_t blk_len);
+#endif
+
 /* USB Mass storage Standard Inquiry Data */
 const int8_t  STORAGE_Inquirydata[] = {//36
   
@@ -89,6 +95,13 @@ USBD_STORAGE_cb_TypeDef USBD_MICRO_SDIO_fops =
   STORAGE_Write,
   STORAGE_GetMaxLun,
   STORAGE_Inquirydata,
+#ifdef MSC_STORAGE_ASYNC_ENABLED
+  NULL,                 /* ReadAsync: Read is used */
+  NULL,                 /* WriteAsync: Write is used */
+#endif
+#ifdef MSC_UNMAP_ENABLED
+  STORAGE_Unmap,
+#endif
   
 };
 
@@ -181,5 +194,22 @@ int8_t STORAGE_GetMaxLun (void)
   return (STORAGE_LUN_NBR - 1);
 }
 
+#ifdef MSC_UNMAP_ENABLED
+/*******************************************************************************
+* Function Name  : STORAGE_Unmap
+* Description    : Release blocks of the STORAGE card: they read back as zeros
+*                  until written again.
+* Input          : None.
+* Output         : None.
+* Return         : None.
+*******************************************************************************/
+int8_t STORAGE_Unmap (uint8_t lun, 
+                      uint32_t blk_addr,
+                      uint32_t blk_len)
+{
+  return (0);
+}
+#endif
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -0,0 +1,216 @@
+/**
+  ******************************************************************************
+  * @file    usbd_ncm_core.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   header file for the usbd_ncm_core.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+
+#ifndef __USB_NCM_CORE_H_
+#define __USB_NCM_CORE_H_
+
+#include  "usbd_cdc_core.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup usbd_ncm
+  * @brief This file is the Header file for usbd_ncm_core.c
+  * @{
+  */
+
+
+/** @defgroup usbd_ncm_Exported_Defines
+  * @{
+  */
+#define USB_NCM_CONFIG_DESC_SIZ                (86)
+
+#define DEVICE_CLASS_NCM                        0x02
+#define DEVICE_SUBCLASS_NCM                     0x00
+
+/* Interfaces and endpoints */
+#ifndef NCM_COMM_ITF
+ #define NCM_COMM_ITF                           0x00
+#endif
+#ifndef NCM_DATA_ITF
+ #define NCM_DATA_ITF                           0x01
+#endif
+
+#ifndef NCM_IN_EP
+ #define NCM_IN_EP                              0x81
+#endif
+#ifndef NCM_OUT_EP
+ #define NCM_OUT_EP                             0x01
+#endif
+#ifndef NCM_CMD_EP
+ #define NCM_CMD_EP                             0x82
+#endif
+
+#ifndef NCM_DATA_MAX_PACKET_SIZE
+ #ifdef USE_USB_OTG_HS
+  #define NCM_DATA_MAX_PACKET_SIZE              512
+ #else
+  #define NCM_DATA_MAX_PACKET_SIZE              64
+ #endif
+#endif
+#define NCM_CMD_PACKET_SIZE                     16
+
+/* Size of each of the two IN and the two OUT NTB buffers */
+#ifndef NCM_NTB_IN_SIZE
+ #define NCM_NTB_IN_SIZE                        2048
+#endif
+#ifndef NCM_NTB_OUT_SIZE
+ #define NCM_NTB_OUT_SIZE                       2048
+#endif
+
+/* Datagrams aggregated in an IN NTB */
+#ifndef NCM_MAX_DATAGRAMS
+ #define NCM_MAX_DATAGRAMS                      16
+#endif
+
+/* Frames an IN NTB is left open for more datagrams while the pipe is idle */
+#ifndef NCM_IN_FRAME_INTERVAL
+ #define NCM_IN_FRAME_INTERVAL                  1
+#endif
+
+#ifndef NCM_MAX_SEGMENT_SIZE
+ #define NCM_MAX_SEGMENT_SIZE                   1514
+#endif
+
+/* MAC address of the host side, as 12 hexadecimal digits */
+#ifndef NCM_MAC_ADDRESS
+ #define NCM_MAC_ADDRESS                        "0280E1000000"
+#endif
+#define NCM_MAC_STR_IDX                         (USBD_IDX_INTERFACE_STR + 1)
+
+/* Bit rate reported in the connection speed change notification */
+#ifndef NCM_LINK_SPEED
+ #define NCM_LINK_SPEED                         100000000
+#endif
+
+/*---------------------------------------------------------------------*/
+/*  NCM definitions                                                    */
+/*---------------------------------------------------------------------*/
+
+/**************************************************/
+/* NCM Requests                                   */
+/**************************************************/
+#define SET_ETHERNET_MULTICAST_FILTERS          0x40
+#define SET_ETHERNET_PACKET_FILTER              0x43
+#define GET_ETHERNET_STATISTIC                  0x44
+#define GET_NTB_PARAMETERS                      0x80
+#define GET_NET_ADDRESS                         0x81
+#define SET_NET_ADDRESS                         0x82
+#define GET_NTB_FORMAT                          0x83
+#define SET_NTB_FORMAT                          0x84
+#define GET_NTB_INPUT_SIZE                      0x85
+#define SET_NTB_INPUT_SIZE                      0x86
+#define GET_MAX_DATAGRAM_SIZE                   0x87
+#define SET_MAX_DATAGRAM_SIZE                   0x88
+#define GET_CRC_MODE                            0x89
+#define SET_CRC_MODE                            0x8A
+#define NCM_NO_CMD                              0xFF
+
+/**************************************************/
+/* NCM Notifications                              */
+/**************************************************/
+#define NCM_NETWORK_CONNECTION                  0x00
+#define NCM_CONNECTION_SPEED_CHANGE             0x2A
+
+/**************************************************/
+/* NTB16 format                                   */
+/**************************************************/
+#define NCM_NTH16_SIGNATURE                     0x484D434E    /* "NCMH" */
+#define NCM_NDP16_SIGNATURE                     0x304D434E    /* "NCM0" */
+#define NCM_NTH16_LENGTH                        12
+#define NCM_NDP16_LENGTH(n)                     (8 + (4 * ((n) + 1)))
+#define NCM_NTB_PARAMETERS_LENGTH               28
+
+/* Alignment of the datagrams and NDPs in an IN NTB */
+#define NCM_IN_DIVISOR                          4
+#define NCM_OUT_DIVISOR                         4
+
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_ncm_Exported_TypesDefinitions
+  * @{
+  */
+typedef struct _NCM_IF_PROP
+{
+  uint16_t (*pIf_Init)     (void);
+  uint16_t (*pIf_DeInit)   (void);
+  uint16_t (*pIf_Ctrl)     (uint32_t Cmd, uint8_t* Buf, uint32_t Len);
+  /* Datagram received, in place in the OUT NTB. USBD_OK: done with it,
+     USBD_BUSY: kept until USBD_NCM_RxRelease */
+  uint16_t (*pIf_Recv)     (uint8_t* Buf, uint32_t Len);
+}
+NCM_IF_Prop_TypeDef;
+/**
+  * @}
+  */
+
+
+
+/** @defgroup usbd_ncm_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup usbd_ncm_Exported_Variables
+  * @{
+  */
+
+extern USBD_Class_cb_TypeDef  USBD_NCM_cb;
+/**
+  * @}
+  */
+
+/** @defgroup usbd_ncm_Exported_Functions
+  * @{
+  */
+uint8_t *USBD_NCM_TxAlloc   (uint32_t len);
+void     USBD_NCM_TxCommit  (uint32_t len);
+void     USBD_NCM_RxRelease (uint8_t *buf);
+void     USBD_NCM_SetLink   (uint8_t up, uint32_t speed);
+/**
+  * @}
+  */
+
+#endif  // __USB_NCM_CORE_H_
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
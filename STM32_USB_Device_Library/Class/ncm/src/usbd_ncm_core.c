@@ -0,0 +1,1299 @@
+/**
+  ******************************************************************************
+  * @file    usbd_ncm_core.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   This file provides the high layer firmware functions to manage the
+  *          following functionalities of the USB CDC NCM Class:
+  *           - Initialization and Configuration of high and low layer
+  *           - Enumeration as CDC NCM Device
+  *           - NTB (network transfer block) IN/OUT transfer
+  *           - Command IN transfer (class requests and notifications)
+  *           - Error management
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                NCM Class Driver Description
+  *          ===================================================================
+  *           This driver manages the "Universal Serial Bus Communications Class
+  *           Subclass Specification for Network Control Model Devices
+  *           Revision 1.0 (Errata 1) November 24, 2010"
+  *           This driver implements the following aspects of the specification:
+  *             - Device descriptor management
+  *             - Configuration descriptor management
+  *             - Enumeration as NCM device with 2 data endpoints (IN and OUT)
+  *               and 1 notification endpoint (IN)
+  *             - Requests management (as described in section 6.2 in specification)
+  *             - NTB16 transfer blocks, with several datagrams per block in
+  *               both directions
+  *             - Network connection and connection speed change notifications
+  *
+  *           @note
+  *             The datagrams received are handed to the network interface in
+  *             place in the OUT NTB buffer (usbd_ncm_if_template.c). The
+  *             network interface builds the datagrams to send in place in the
+  *             IN NTB buffer with USBD_NCM_TxAlloc and USBD_NCM_TxCommit.
+  *             Two buffers are used in each direction: one is on the bus while
+  *             the other one is filled or waiting for its datagrams to be freed.
+  *
+  *            This driver doesn't implement the following aspects of the specification
+  *            (but it is possible to manage these features with some modifications on this driver):
+  *             - NTB32 transfer blocks
+  *             - CRC of the datagrams (NDP16 with "NCM1" signature)
+  *             - Multicast and power management filters, Ethernet statistics
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_ncm_core.h"
+#include "usbd_desc.h"
+#include "usbd_req.h"
+#ifdef USBD_COMPOSITE_ENABLED
+#include "usbd_composite.h"
+#endif
+
+#ifndef USB_SUPPORT_USER_STRING_DESC
+ #error "The NCM class needs USB_SUPPORT_USER_STRING_DESC for its MAC address string"
+#endif
+
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup usbd_ncm
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup usbd_ncm_Private_TypesDefinitions
+  * @{
+  */
+/* IN NTB being filled */
+typedef struct _NCM_Ntb
+{
+  uint32_t len;                               /* End of the last datagram */
+  uint32_t count;                             /* Datagrams in the NTB */
+  uint16_t dgram[NCM_MAX_DATAGRAMS][2];       /* Index and length of each one */
+}
+NCM_Ntb_TypeDef;
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_ncm_Private_Defines
+  * @{
+  */
+#define NCM_CTL_BUFF_SIZE             USB_OTG_MAX_EP0_SIZE
+
+/* NDPs followed in an OUT NTB */
+#define NCM_MAX_NDP                   8
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_ncm_Private_Macros
+  * @{
+  */
+#define NCM_ALIGN(x, n)               (((x) + ((n) - 1)) & ~((n) - 1))
+
+#define NCM_GET16(p)                  ((uint16_t)((p)[0] | ((p)[1] << 8)))
+#define NCM_GET32(p)                  ((uint32_t)(NCM_GET16(p) | \
+                                       ((uint32_t)NCM_GET16((p) + 2) << 16)))
+
+#define NCM_PUT16(p, v)               do { (p)[0] = LOBYTE((v)); \
+                                           (p)[1] = HIBYTE((v)); } while (0)
+#define NCM_PUT32(p, v)               do { NCM_PUT16((p), (v) & 0xFFFF); \
+                                           NCM_PUT16((p) + 2, (v) >> 16); } while (0)
+/**
+  * @}
+  */
+
+
+/** @defgroup usbd_ncm_Private_FunctionPrototypes
+  * @{
+  */
+
+/*********************************************
+   NCM Device library callbacks
+ *********************************************/
+static uint8_t  usbd_ncm_Init        (void  *pdev, uint8_t cfgidx);
+static uint8_t  usbd_ncm_DeInit      (void  *pdev, uint8_t cfgidx);
+static uint8_t  usbd_ncm_Setup       (void  *pdev, USB_SETUP_REQ *req);
+static uint8_t  usbd_ncm_EP0_RxReady (void *pdev);
+static uint8_t  usbd_ncm_DataIn      (void *pdev, uint8_t epnum);
+static uint8_t  usbd_ncm_DataOut     (void *pdev, uint8_t epnum);
+static uint8_t  usbd_ncm_SOF         (void *pdev);
+
+/*********************************************
+   NCM specific management functions
+ *********************************************/
+static void     NCM_Reset            (void);
+static void     NCM_Start            (void *pdev);
+static void     NCM_RxArm            (void *pdev);
+static void     NCM_RxParse          (uint8_t idx, uint32_t len);
+static void     NCM_TxFlush          (void *pdev);
+static void     NCM_Notify           (void *pdev);
+static uint8_t  *USBD_ncm_GetCfgDesc (uint8_t speed, uint16_t *length);
+#ifdef USB_OTG_HS_CORE
+static uint8_t  *USBD_ncm_GetOtherCfgDesc (uint8_t speed, uint16_t *length);
+#endif
+static uint8_t  *USBD_ncm_GetUsrStrDesc (uint8_t speed, uint8_t index, uint16_t *length);
+/**
+  * @}
+  */
+
+/** @defgroup usbd_ncm_Private_Variables
+  * @{
+  */
+extern NCM_IF_Prop_TypeDef  NCM_APP_FOPS;
+extern uint8_t USBD_DeviceDesc   [USB_SIZ_DEVICE_DESC];
+extern uint8_t USBD_StrDesc      [USB_MAX_STR_DESC_SIZ];
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN uint8_t usbd_ncm_CfgDesc  [USB_NCM_CONFIG_DESC_SIZ] __ALIGN_END ;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN uint8_t usbd_ncm_OtherCfgDesc  [USB_NCM_CONFIG_DESC_SIZ] __ALIGN_END ;
+
+#ifdef USBD_COMPOSITE_ENABLED
+/* NTB buffers taken from the composite arena in usbd_ncm_Init */
+static uint8_t (*ncmRxNtb)[NCM_NTB_OUT_SIZE];
+static uint8_t (*ncmTxNtb)[NCM_NTB_IN_SIZE];
+#else
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t ncmRxNtb [2][NCM_NTB_OUT_SIZE] __ALIGN_END ;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t ncmTxNtb [2][NCM_NTB_IN_SIZE] __ALIGN_END ;
+#endif /* USBD_COMPOSITE_ENABLED */
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t ncmCtlBuff [NCM_CTL_BUFF_SIZE] __ALIGN_END ;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t ncmNotifyBuff [NCM_CMD_PACKET_SIZE] __ALIGN_END ;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+/* NTB parameter structure returned to GET_NTB_PARAMETERS */
+__ALIGN_BEGIN static uint8_t ncmNtbParams [NCM_NTB_PARAMETERS_LENGTH] __ALIGN_END =
+{
+  LOBYTE(NCM_NTB_PARAMETERS_LENGTH),   /* wLength */
+  HIBYTE(NCM_NTB_PARAMETERS_LENGTH),
+  0x01,                                /* bmNtbFormatsSupported: NTB16 */
+  0x00,
+  LOBYTE(NCM_NTB_IN_SIZE),             /* dwNtbInMaxSize */
+  HIBYTE(NCM_NTB_IN_SIZE),
+  0x00,
+  0x00,
+  LOBYTE(NCM_IN_DIVISOR),              /* wNdpInDivisor */
+  HIBYTE(NCM_IN_DIVISOR),
+  0x00,                                /* wNdpInPayloadRemainder */
+  0x00,
+  LOBYTE(NCM_IN_DIVISOR),              /* wNdpInAlignment */
+  HIBYTE(NCM_IN_DIVISOR),
+  0x00,                                /* wReserved */
+  0x00,
+  LOBYTE(NCM_NTB_OUT_SIZE),            /* dwNtbOutMaxSize */
+  HIBYTE(NCM_NTB_OUT_SIZE),
+  0x00,
+  0x00,
+  LOBYTE(NCM_OUT_DIVISOR),             /* wNdpOutDivisor */
+  HIBYTE(NCM_OUT_DIVISOR),
+  0x00,                                /* wNdpOutPayloadRemainder */
+  0x00,
+  LOBYTE(NCM_OUT_DIVISOR),             /* wNdpOutAlignment */
+  HIBYTE(NCM_OUT_DIVISOR),
+  0x00,                                /* wNtbOutMaxDatagrams: no limit */
+  0x00
+};
+
+static __IO uint32_t ncmAltSet = 0;
+
+static uint32_t ncmCmd = NCM_NO_CMD;
+static uint32_t ncmLen = 0;
+
+/* IN NTBs: ncmTxFill is filled while the other one is on the bus */
+static NCM_Ntb_TypeDef ncmTx[2];
+static __IO uint8_t  ncmTxFill  = 0;
+static __IO uint8_t  ncmTxLock  = 0;   /* Datagram being built in ncmTxFill */
+static __IO uint8_t  ncmTxState = 0;   /* NTB on the bus */
+static uint8_t       ncmTxZlp   = 0;
+static uint16_t      ncmTxSeq   = 0;
+static uint32_t      ncmTxMax   = NCM_NTB_IN_SIZE;
+
+/* OUT NTBs: datagrams still held by the network interface in each one */
+static __IO uint8_t  ncmRxRef[2];
+static uint8_t       ncmRxCur    = 0;
+static __IO uint8_t  ncmRxPaused = 0;
+
+/* Notifications waiting for the command endpoint */
+static __IO uint8_t  ncmNotifySpeed = 0;
+static __IO uint8_t  ncmNotifyConn  = 0;
+static uint8_t       ncmNotifyBusy  = 0;
+static __IO uint8_t  ncmLinkUp      = 1;
+static __IO uint32_t ncmLinkSpeed   = NCM_LINK_SPEED;
+
+/* NCM interface class callbacks structure */
+USBD_Class_cb_TypeDef  USBD_NCM_cb =
+{
+  usbd_ncm_Init,
+  usbd_ncm_DeInit,
+  usbd_ncm_Setup,
+  NULL,                 /* EP0_TxSent, */
+  usbd_ncm_EP0_RxReady,
+  usbd_ncm_DataIn,
+  usbd_ncm_DataOut,
+  usbd_ncm_SOF,
+  NULL,
+  NULL,
+  USBD_ncm_GetCfgDesc,
+#ifdef USB_OTG_HS_CORE
+  USBD_ncm_GetOtherCfgDesc,
+#endif /* USB_OTG_HS_CORE */
+  USBD_ncm_GetUsrStrDesc,
+};
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+/* USB NCM device Configuration Descriptor */
+__ALIGN_BEGIN uint8_t usbd_ncm_CfgDesc[USB_NCM_CONFIG_DESC_SIZ]  __ALIGN_END =
+{
+  /*Configuration Descriptor*/
+  0x09,   /* bLength: Configuration Descriptor size */
+  USB_CONFIGURATION_DESCRIPTOR_TYPE,      /* bDescriptorType: Configuration */
+  USB_NCM_CONFIG_DESC_SIZ,                /* wTotalLength:no of returned bytes */
+  0x00,
+  0x02,   /* bNumInterfaces: 2 interface */
+  0x01,   /* bConfigurationValue: Configuration value */
+  0x00,   /* iConfiguration: Index of string descriptor describing the configuration */
+  0xC0,   /* bmAttributes: self powered */
+  0x32,   /* MaxPower 100 mA */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Interface Descriptor */
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: Interface */
+  NCM_COMM_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x01,   /* bNumEndpoints: One endpoints used */
+  0x02,   /* bInterfaceClass: Communication Interface Class */
+  0x0D,   /* bInterfaceSubClass: Network Control Model */
+  0x00,   /* bInterfaceProtocol: No encapsulated commands */
+  0x00,   /* iInterface: */
+
+  /*Header Functional Descriptor*/
+  0x05,   /* bLength: Endpoint Descriptor size */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x00,   /* bDescriptorSubtype: Header Func Desc */
+  0x10,   /* bcdCDC: spec release number */
+  0x01,
+
+  /*Union Functional Descriptor*/
+  0x05,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x06,   /* bDescriptorSubtype: Union func desc */
+  NCM_COMM_ITF,   /* bMasterInterface: Communication class interface */
+  NCM_DATA_ITF,   /* bSlaveInterface0: Data Class Interface */
+
+  /*Ethernet Networking Functional Descriptor*/
+  0x0D,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x0F,   /* bDescriptorSubtype: Ethernet Networking func desc */
+  NCM_MAC_STR_IDX,   /* iMACAddress */
+  0x00,   /* bmEthernetStatistics: none */
+  0x00,
+  0x00,
+  0x00,
+  LOBYTE(NCM_MAX_SEGMENT_SIZE),   /* wMaxSegmentSize */
+  HIBYTE(NCM_MAX_SEGMENT_SIZE),
+  0x00,   /* wNumberMCFilters: none */
+  0x00,
+  0x00,   /* bNumberPowerFilters: none */
+
+  /*NCM Functional Descriptor*/
+  0x06,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x1A,   /* bDescriptorSubtype: NCM func desc */
+  0x00,   /* bcdNcmVersion: 1.00 */
+  0x01,
+  0x01,   /* bmNetworkCapabilities: SetEthernetPacketFilter */
+
+  /*Notification Endpoint Descriptor*/
+  0x07,                           /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,   /* bDescriptorType: Endpoint */
+  NCM_CMD_EP,                     /* bEndpointAddress */
+  0x03,                           /* bmAttributes: Interrupt */
+  LOBYTE(NCM_CMD_PACKET_SIZE),    /* wMaxPacketSize: */
+  HIBYTE(NCM_CMD_PACKET_SIZE),
+#ifdef USE_USB_OTG_HS
+  0x08,                           /* bInterval: 16 ms */
+#else
+  0x10,                           /* bInterval: 16 ms */
+#endif /* USE_USB_OTG_HS */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Data class interface descriptor: no endpoint while the function is idle*/
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: */
+  NCM_DATA_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x00,   /* bNumEndpoints: No endpoint */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Data class interface descriptor: data transfer*/
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: */
+  NCM_DATA_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x01,   /* bAlternateSetting: Alternate setting */
+  0x02,   /* bNumEndpoints: Two endpoints used */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Endpoint OUT Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,      /* bDescriptorType: Endpoint */
+  NCM_OUT_EP,                        /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint IN Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,      /* bDescriptorType: Endpoint */
+  NCM_IN_EP,                         /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_MAX_PACKET_SIZE),
+  0x00                               /* bInterval: ignore for Bulk transfer */
+} ;
+
+#ifdef USB_OTG_HS_CORE
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN uint8_t usbd_ncm_OtherCfgDesc[USB_NCM_CONFIG_DESC_SIZ]  __ALIGN_END =
+{
+  0x09,   /* bLength: Configuation Descriptor size */
+  USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION,
+  USB_NCM_CONFIG_DESC_SIZ,
+  0x00,
+  0x02,   /* bNumInterfaces: 2 interfaces */
+  0x01,   /* bConfigurationValue: */
+  0x04,   /* iConfiguration: */
+  0xC0,   /* bmAttributes: */
+  0x32,   /* MaxPower 100 mA */
+
+  /*Interface Descriptor */
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: Interface */
+  NCM_COMM_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x01,   /* bNumEndpoints: One endpoints used */
+  0x02,   /* bInterfaceClass: Communication Interface Class */
+  0x0D,   /* bInterfaceSubClass: Network Control Model */
+  0x00,   /* bInterfaceProtocol: No encapsulated commands */
+  0x00,   /* iInterface: */
+
+  /*Header Functional Descriptor*/
+  0x05,   /* bLength: Endpoint Descriptor size */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x00,   /* bDescriptorSubtype: Header Func Desc */
+  0x10,   /* bcdCDC: spec release number */
+  0x01,
+
+  /*Union Functional Descriptor*/
+  0x05,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x06,   /* bDescriptorSubtype: Union func desc */
+  NCM_COMM_ITF,   /* bMasterInterface: Communication class interface */
+  NCM_DATA_ITF,   /* bSlaveInterface0: Data Class Interface */
+
+  /*Ethernet Networking Functional Descriptor*/
+  0x0D,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x0F,   /* bDescriptorSubtype: Ethernet Networking func desc */
+  NCM_MAC_STR_IDX,   /* iMACAddress */
+  0x00,   /* bmEthernetStatistics: none */
+  0x00,
+  0x00,
+  0x00,
+  LOBYTE(NCM_MAX_SEGMENT_SIZE),   /* wMaxSegmentSize */
+  HIBYTE(NCM_MAX_SEGMENT_SIZE),
+  0x00,   /* wNumberMCFilters: none */
+  0x00,
+  0x00,   /* bNumberPowerFilters: none */
+
+  /*NCM Functional Descriptor*/
+  0x06,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x1A,   /* bDescriptorSubtype: NCM func desc */
+  0x00,   /* bcdNcmVersion: 1.00 */
+  0x01,
+  0x01,   /* bmNetworkCapabilities: SetEthernetPacketFilter */
+
+  /*Notification Endpoint Descriptor*/
+  0x07,                           /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,   /* bDescriptorType: Endpoint */
+  NCM_CMD_EP,                     /* bEndpointAddress */
+  0x03,                           /* bmAttributes: Interrupt */
+  LOBYTE(NCM_CMD_PACKET_SIZE),    /* wMaxPacketSize: */
+  HIBYTE(NCM_CMD_PACKET_SIZE),
+  0x10,                           /* bInterval: */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Data class interface descriptor: no endpoint while the function is idle*/
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: */
+  NCM_DATA_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x00,   /* bNumEndpoints: No endpoint */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Data class interface descriptor: data transfer*/
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_INTERFACE_DESCRIPTOR_TYPE,  /* bDescriptorType: */
+  NCM_DATA_ITF,   /* bInterfaceNumber: Number of Interface */
+  0x01,   /* bAlternateSetting: Alternate setting */
+  0x02,   /* bNumEndpoints: Two endpoints used */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Endpoint OUT Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,      /* bDescriptorType: Endpoint */
+  NCM_OUT_EP,                        /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  0x40,                              /* wMaxPacketSize: */
+  0x00,
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint IN Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_ENDPOINT_DESCRIPTOR_TYPE,     /* bDescriptorType: Endpoint */
+  NCM_IN_EP,                        /* bEndpointAddress */
+  0x02,                             /* bmAttributes: Bulk */
+  0x40,                             /* wMaxPacketSize: */
+  0x00,
+  0x00                              /* bInterval */
+};
+#endif /* USB_OTG_HS_CORE */
+
+/**
+  * @}
+  */
+
+/** @defgroup usbd_ncm_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  usbd_ncm_Init
+  *         Initilaize the NCM interface
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  usbd_ncm_Init (void  *pdev,
+                               uint8_t cfgidx)
+{
+  uint8_t *pbuf;
+
+#ifdef USBD_COMPOSITE_ENABLED
+  ncmRxNtb = (uint8_t (*)[NCM_NTB_OUT_SIZE])USBD_Composite_Alloc(2 * NCM_NTB_OUT_SIZE);
+  ncmTxNtb = (uint8_t (*)[NCM_NTB_IN_SIZE])USBD_Composite_Alloc(2 * NCM_NTB_IN_SIZE);
+  if ((ncmRxNtb == NULL) || (ncmTxNtb == NULL))
+  {
+    return USBD_FAIL;
+  }
+#endif
+
+  /* Open EP IN */
+  DCD_EP_Open(pdev,
+              NCM_IN_EP,
+              NCM_DATA_MAX_PACKET_SIZE,
+              USB_OTG_EP_BULK);
+
+  /* Open EP OUT */
+  DCD_EP_Open(pdev,
+              NCM_OUT_EP,
+              NCM_DATA_MAX_PACKET_SIZE,
+              USB_OTG_EP_BULK);
+
+  /* Open Command IN EP */
+  DCD_EP_Open(pdev,
+              NCM_CMD_EP,
+              NCM_CMD_PACKET_SIZE,
+              USB_OTG_EP_INT);
+
+  pbuf = (uint8_t *)USBD_DeviceDesc;
+  pbuf[4] = DEVICE_CLASS_NCM;
+  pbuf[5] = DEVICE_SUBCLASS_NCM;
+
+  /* The data interface starts in the alternate setting without endpoints */
+  ncmAltSet = 0;
+  ncmTxMax  = NCM_NTB_IN_SIZE;
+  NCM_Reset();
+
+  /* Initialize the Interface physical components */
+  NCM_APP_FOPS.pIf_Init();
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_ncm_DeInit
+  *         DeInitialize the NCM layer
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  usbd_ncm_DeInit (void  *pdev,
+                                 uint8_t cfgidx)
+{
+  /* Close EP IN */
+  DCD_EP_Close(pdev,
+              NCM_IN_EP);
+
+  /* Close EP OUT */
+  DCD_EP_Close(pdev,
+              NCM_OUT_EP);
+
+  /* Close Command IN EP */
+  DCD_EP_Close(pdev,
+              NCM_CMD_EP);
+
+  ncmAltSet = 0;
+
+  /* Restore default state of the Interface physical components */
+  NCM_APP_FOPS.pIf_DeInit();
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_ncm_Setup
+  *         Handle the NCM specific requests
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  usbd_ncm_Setup (void  *pdev,
+                                USB_SETUP_REQ *req)
+{
+  uint16_t len = 0;
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
+  {
+    /* NCM Class Requests -------------------------------*/
+  case USB_REQ_TYPE_CLASS :
+    switch (req->bRequest)
+    {
+    case GET_NTB_PARAMETERS:
+      USBD_CtlSendData (pdev,
+                        ncmNtbParams,
+                        MIN(NCM_NTB_PARAMETERS_LENGTH, req->wLength));
+      return USBD_OK;
+
+    case GET_NTB_INPUT_SIZE:
+      NCM_PUT32(ncmCtlBuff, ncmTxMax);
+      len = 4;
+      break;
+
+    case GET_NTB_FORMAT:
+    case GET_CRC_MODE:
+      /* NTB16 and no CRC are the only modes */
+      NCM_PUT16(ncmCtlBuff, 0);
+      len = 2;
+      break;
+
+    case GET_MAX_DATAGRAM_SIZE:
+      NCM_PUT16(ncmCtlBuff, NCM_MAX_SEGMENT_SIZE);
+      len = 2;
+      break;
+
+    case SET_NTB_FORMAT:
+    case SET_CRC_MODE:
+      if (req->wValue != 0)
+      {
+        USBD_CtlError (pdev, req);
+        return USBD_FAIL;
+      }
+      return USBD_OK;
+
+    case SET_ETHERNET_PACKET_FILTER:
+      /* The filter is in wValue */
+      NCM_PUT16(ncmCtlBuff, req->wValue);
+      NCM_APP_FOPS.pIf_Ctrl(req->bRequest, ncmCtlBuff, 2);
+      return USBD_OK;
+
+    default:
+      if (req->wLength > NCM_CTL_BUFF_SIZE)
+      {
+        USBD_CtlError (pdev, req);
+        return USBD_FAIL;
+      }
+
+      if (req->wLength == 0)
+      {
+        /* Transfer the command to the interface layer */
+        NCM_APP_FOPS.pIf_Ctrl(req->bRequest, NULL, 0);
+      }
+      else if (req->bmRequest & 0x80)
+      {
+        /* Get the data to be sent to Host from interface layer */
+        NCM_APP_FOPS.pIf_Ctrl(req->bRequest, ncmCtlBuff, req->wLength);
+        USBD_CtlSendData (pdev,
+                          ncmCtlBuff,
+                          req->wLength);
+      }
+      else
+      {
+        /* Set the value of the current command to be processed, the data
+           are managed in usbd_ncm_EP0_RxReady() */
+        ncmCmd = req->bRequest;
+        ncmLen = req->wLength;
+        USBD_CtlPrepareRx (pdev,
+                           ncmCtlBuff,
+                           req->wLength);
+      }
+      return USBD_OK;
+    }
+
+    /* Parameter read from the core */
+    USBD_CtlSendData (pdev,
+                      ncmCtlBuff,
+                      MIN(len, req->wLength));
+    return USBD_OK;
+
+    /* Standard Requests -------------------------------*/
+  case USB_REQ_TYPE_STANDARD:
+    switch (req->bRequest)
+    {
+    case USB_REQ_GET_INTERFACE :
+      ncmCtlBuff[0] = (LOBYTE(req->wIndex) == NCM_DATA_ITF) ? ncmAltSet : 0;
+      USBD_CtlSendData (pdev,
+                        ncmCtlBuff,
+                        1);
+      break;
+
+    case USB_REQ_SET_INTERFACE :
+      if ((LOBYTE(req->wIndex) == NCM_DATA_ITF) && ((uint8_t)(req->wValue) <= 1))
+      {
+        /* Selecting either setting resets the function */
+        DCD_EP_Flush(pdev, NCM_IN_EP);
+        DCD_EP_Flush(pdev, NCM_OUT_EP);
+        NCM_Reset();
+
+        ncmAltSet = (uint8_t)(req->wValue);
+        if (ncmAltSet == 1)
+        {
+          NCM_Start(pdev);
+        }
+      }
+      else if ((LOBYTE(req->wIndex) != NCM_COMM_ITF) || ((uint8_t)(req->wValue) != 0))
+      {
+        /* Call the error management function (command will be nacked */
+        USBD_CtlError (pdev, req);
+      }
+      break;
+    }
+    return USBD_OK;
+
+  default:
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
+  }
+}
+
+/**
+  * @brief  usbd_ncm_EP0_RxReady
+  *         Data received on control endpoint
+  * @param  pdev: device device instance
+  * @retval status
+  */
+static uint8_t  usbd_ncm_EP0_RxReady (void  *pdev)
+{
+  uint32_t size;
+
+  if (ncmCmd == SET_NTB_INPUT_SIZE)
+  {
+    /* dwNtbInMaxSize, followed by wNtbInMaxDatagrams in the 8-byte form */
+    size = NCM_GET32(ncmCtlBuff);
+    if ((size >= (NCM_NTH16_LENGTH + NCM_NDP16_LENGTH(1))) && (size <= NCM_NTB_IN_SIZE))
+    {
+      ncmTxMax = size;
+    }
+  }
+  else if (ncmCmd != NCM_NO_CMD)
+  {
+    /* Process the data */
+    NCM_APP_FOPS.pIf_Ctrl(ncmCmd, ncmCtlBuff, ncmLen);
+  }
+
+  /* Reset the command variable to default value */
+  ncmCmd = NCM_NO_CMD;
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_ncm_DataIn
+  *         Data sent on non-control IN endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  usbd_ncm_DataIn (void *pdev, uint8_t epnum)
+{
+  if (epnum == (NCM_CMD_EP & 0x7F))
+  {
+    ncmNotifyBusy = 0;
+    NCM_Notify(pdev);
+  }
+  else if (epnum == (NCM_IN_EP & 0x7F))
+  {
+    if (ncmTxZlp)
+    {
+      /* End the NTB shorter than dwNtbInMaxSize on a packet boundary */
+      ncmTxZlp = 0;
+      DCD_EP_Tx (pdev,
+                 NCM_IN_EP,
+                 ncmTxNtb[0],
+                 0);
+    }
+    else
+    {
+      ncmTxState = 0;
+
+      /* Send the datagrams queued meanwhile without waiting for a frame */
+      NCM_TxFlush(pdev);
+    }
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_ncm_DataOut
+  *         Data received on non-control Out endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  usbd_ncm_DataOut (void *pdev, uint8_t epnum)
+{
+  uint16_t USB_Rx_Cnt;
+
+  /* Get the received NTB length */
+  USB_Rx_Cnt = ((USB_OTG_CORE_HANDLE*)pdev)->dev.out_ep[epnum].xfer_count;
+
+  if (ncmAltSet == 1)
+  {
+    NCM_RxParse(ncmRxCur, USB_Rx_Cnt);
+    NCM_RxArm(pdev);
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  usbd_ncm_SOF
+  *         Start Of Frame event management
+  * @param  pdev: instance
+  * @retval status
+  */
+static uint8_t  usbd_ncm_SOF (void *pdev)
+{
+  static uint32_t FrameCount = 0;
+
+  if (ncmAltSet == 1)
+  {
+    if (ncmRxPaused && ((ncmRxRef[0] == 0) || (ncmRxRef[1] == 0)))
+    {
+      /* USBD_NCM_RxRelease freed a buffer */
+      NCM_RxArm(pdev);
+    }
+
+    NCM_Notify(pdev);
+
+    if (++FrameCount >= NCM_IN_FRAME_INTERVAL)
+    {
+      FrameCount = 0;
+
+      /* Close the NTB being filled if the pipe is idle */
+      NCM_TxFlush(pdev);
+    }
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  NCM_Reset
+  *         Drop the NTBs in progress. The OUT datagrams still held by the
+  *         network interface remain valid until they are released.
+  * @param  None
+  * @retval None
+  */
+static void NCM_Reset (void)
+{
+  ncmTx[0].len   = NCM_NTH16_LENGTH;
+  ncmTx[0].count = 0;
+  ncmTx[1].len   = NCM_NTH16_LENGTH;
+  ncmTx[1].count = 0;
+  ncmTxFill  = 0;
+  ncmTxState = 0;
+  ncmTxZlp   = 0;
+  ncmTxSeq   = 0;
+
+  ncmRxPaused    = 0;
+  ncmNotifySpeed = 0;
+  ncmNotifyConn  = 0;
+  ncmNotifyBusy  = 0;
+}
+
+/**
+  * @brief  NCM_Start
+  *         Start the data transfers once the host selected the data setting
+  * @param  pdev: instance
+  * @retval None
+  */
+static void NCM_Start (void *pdev)
+{
+  ncmRxCur = 0;
+  NCM_RxArm(pdev);
+
+  /* Report the link to the host */
+  ncmNotifySpeed = 1;
+  ncmNotifyConn  = 1;
+  NCM_Notify(pdev);
+}
+
+/**
+  * @brief  NCM_RxArm
+  *         Receive the next NTB in a buffer with no datagram held, the
+  *         other buffer first, or NAK until USBD_NCM_RxRelease frees one
+  * @param  pdev: instance
+  * @retval None
+  */
+static void NCM_RxArm (void *pdev)
+{
+  uint8_t idx = ncmRxCur ^ 1;
+
+  if (ncmRxRef[idx] != 0)
+  {
+    idx = ncmRxCur;
+  }
+
+  if (ncmRxRef[idx] != 0)
+  {
+    ncmRxPaused = 1;
+    return;
+  }
+
+  ncmRxPaused = 0;
+  ncmRxCur = idx;
+  DCD_EP_PrepareRx(pdev,
+                   NCM_OUT_EP,
+                   ncmRxNtb[idx],
+                   NCM_NTB_OUT_SIZE);
+}
+
+/**
+  * @brief  NCM_RxParse
+  *         Hand the datagrams of a received NTB to the network interface
+  * @param  idx: OUT NTB buffer
+  * @param  len: length received
+  * @retval None
+  */
+static void NCM_RxParse (uint8_t idx, uint32_t len)
+{
+  uint8_t  *ntb = ncmRxNtb[idx];
+  uint32_t block;
+  uint32_t ndp;
+  uint32_t ndplen;
+  uint32_t entry;
+  uint32_t index;
+  uint32_t dlen;
+  uint32_t count = 0;
+
+  if ((len < NCM_NTH16_LENGTH) ||
+      (NCM_GET32(ntb) != NCM_NTH16_SIGNATURE) ||
+      (NCM_GET16(ntb + 4) != NCM_NTH16_LENGTH))
+  {
+    return;
+  }
+
+  block = NCM_GET16(ntb + 8);
+  if (block > len)
+  {
+    return;
+  }
+
+  ndp = NCM_GET16(ntb + 10);
+  while ((ndp != 0) && (count++ < NCM_MAX_NDP))
+  {
+    if ((ndp + NCM_NDP16_LENGTH(1) > block) ||
+        (NCM_GET32(ntb + ndp) != NCM_NDP16_SIGNATURE))
+    {
+      return;
+    }
+
+    ndplen = NCM_GET16(ntb + ndp + 4);
+    if ((ndplen < NCM_NDP16_LENGTH(1)) || (ndp + ndplen > block))
+    {
+      return;
+    }
+
+    for (entry = ndp + 8; entry + 4 <= ndp + ndplen; entry += 4)
+    {
+      index = NCM_GET16(ntb + entry);
+      dlen  = NCM_GET16(ntb + entry + 2);
+
+      if ((index == 0) || (dlen == 0))
+      {
+        break;
+      }
+
+      if ((index < NCM_NTH16_LENGTH) || (index + dlen > block))
+      {
+        continue;
+      }
+
+      /* Count the datagram before the interface can release it */
+      ncmRxRef[idx]++;
+      if (NCM_APP_FOPS.pIf_Recv(ntb + index, dlen) != USBD_BUSY)
+      {
+        ncmRxRef[idx]--;
+      }
+    }
+
+    ndp = NCM_GET16(ntb + ndp + 6);
+  }
+}
+
+/**
+  * @brief  NCM_TxFlush
+  *         Close the NTB being filled and send it if the IN pipe is idle
+  * @param  pdev: instance
+  * @retval None
+  */
+static void NCM_TxFlush (void *pdev)
+{
+  NCM_Ntb_TypeDef *ntb;
+  uint8_t  *buf;
+  uint32_t ndp;
+  uint32_t block;
+  uint32_t i;
+
+  if ((ncmTxState != 0) || (ncmTxLock != 0))
+  {
+    return;
+  }
+
+  ntb = &ncmTx[ncmTxFill];
+  if (ntb->count == 0)
+  {
+    return;
+  }
+  buf = ncmTxNtb[ncmTxFill];
+
+  /* NDP16 after the last datagram */
+  ndp = NCM_ALIGN(ntb->len, NCM_IN_DIVISOR);
+  NCM_PUT32(buf + ndp, NCM_NDP16_SIGNATURE);
+  NCM_PUT16(buf + ndp + 4, NCM_NDP16_LENGTH(ntb->count));
+  NCM_PUT16(buf + ndp + 6, 0);
+  for (i = 0; i < ntb->count; i++)
+  {
+    NCM_PUT16(buf + ndp + 8 + (4 * i), ntb->dgram[i][0]);
+    NCM_PUT16(buf + ndp + 10 + (4 * i), ntb->dgram[i][1]);
+  }
+  NCM_PUT32(buf + ndp + 8 + (4 * i), 0);
+  block = ndp + NCM_NDP16_LENGTH(ntb->count);
+
+  /* NTH16 */
+  NCM_PUT32(buf, NCM_NTH16_SIGNATURE);
+  NCM_PUT16(buf + 4, NCM_NTH16_LENGTH);
+  NCM_PUT16(buf + 6, ncmTxSeq);
+  NCM_PUT16(buf + 8, block);
+  NCM_PUT16(buf + 10, ndp);
+  ncmTxSeq++;
+
+  ncmTxZlp = ((block < ncmTxMax) && ((block % NCM_DATA_MAX_PACKET_SIZE) == 0));
+  ncmTxState = 1;
+
+  /* Fill the other buffer while this one is on the bus */
+  ncmTxFill ^= 1;
+  ncmTx[ncmTxFill].len   = NCM_NTH16_LENGTH;
+  ncmTx[ncmTxFill].count = 0;
+
+  DCD_EP_Tx (pdev,
+             NCM_IN_EP,
+             buf,
+             block);
+}
+
+/**
+  * @brief  NCM_Notify
+  *         Send the next notification waiting for the command endpoint
+  * @param  pdev: instance
+  * @retval None
+  */
+static void NCM_Notify (void *pdev)
+{
+  uint32_t speed;
+
+  if ((ncmNotifyBusy != 0) || (ncmAltSet != 1))
+  {
+    return;
+  }
+
+  ncmNotifyBuff[0] = 0xA1;
+  NCM_PUT16(ncmNotifyBuff + 4, NCM_COMM_ITF);
+
+  if (ncmNotifySpeed)
+  {
+    ncmNotifySpeed = 0;
+    speed = ncmLinkUp ? ncmLinkSpeed : 0;
+    ncmNotifyBuff[1] = NCM_CONNECTION_SPEED_CHANGE;
+    NCM_PUT16(ncmNotifyBuff + 2, 0);
+    NCM_PUT16(ncmNotifyBuff + 6, 8);
+    NCM_PUT32(ncmNotifyBuff + 8, speed);      /* DLBitRate */
+    NCM_PUT32(ncmNotifyBuff + 12, speed);     /* ULBitRate */
+    ncmNotifyBusy = 1;
+    DCD_EP_Tx (pdev, NCM_CMD_EP, ncmNotifyBuff, 16);
+  }
+  else if (ncmNotifyConn)
+  {
+    ncmNotifyConn = 0;
+    ncmNotifyBuff[1] = NCM_NETWORK_CONNECTION;
+    NCM_PUT16(ncmNotifyBuff + 2, ncmLinkUp);
+    NCM_PUT16(ncmNotifyBuff + 6, 0);
+    ncmNotifyBusy = 1;
+    DCD_EP_Tx (pdev, NCM_CMD_EP, ncmNotifyBuff, 8);
+  }
+}
+
+/**
+  * @brief  USBD_NCM_TxAlloc
+  *         Get room for a datagram in the IN NTB being filled. It is called
+  *         from a single context and followed by USBD_NCM_TxCommit.
+  * @param  len: largest length of the datagram
+  * @retval pointer where to build the datagram, NULL if the NTB is full
+  */
+uint8_t *USBD_NCM_TxAlloc (uint32_t len)
+{
+  NCM_Ntb_TypeDef *ntb;
+  uint32_t index;
+
+  if ((ncmAltSet != 1) || (len > NCM_MAX_SEGMENT_SIZE))
+  {
+    return NULL;
+  }
+
+  /* Keep the SOF from closing the NTB until USBD_NCM_TxCommit */
+  ncmTxLock = 1;
+
+  ntb = &ncmTx[ncmTxFill];
+  index = NCM_ALIGN(ntb->len, NCM_IN_DIVISOR);
+  if ((ntb->count >= NCM_MAX_DATAGRAMS) ||
+      (NCM_ALIGN(index + len, NCM_IN_DIVISOR) + NCM_NDP16_LENGTH(ntb->count + 1) > ncmTxMax))
+  {
+    /* Wait for the NTB to be sent */
+    ncmTxLock = 0;
+    return NULL;
+  }
+
+  return &ncmTxNtb[ncmTxFill][index];
+}
+
+/**
+  * @brief  USBD_NCM_TxCommit
+  *         Queue the datagram built since USBD_NCM_TxAlloc
+  * @param  len: length of the datagram, 0 to drop it
+  * @retval None
+  */
+void USBD_NCM_TxCommit (uint32_t len)
+{
+  NCM_Ntb_TypeDef *ntb = &ncmTx[ncmTxFill];
+  uint32_t index = NCM_ALIGN(ntb->len, NCM_IN_DIVISOR);
+
+  if (len != 0)
+  {
+    ntb->dgram[ntb->count][0] = index;
+    ntb->dgram[ntb->count][1] = len;
+    ntb->count++;
+    ntb->len = index + len;
+  }
+
+  ncmTxLock = 0;
+}
+
+/**
+  * @brief  USBD_NCM_RxRelease
+  *         Release a datagram kept by pIf_Recv
+  * @param  buf: datagram passed to pIf_Recv
+  * @retval None
+  */
+void USBD_NCM_RxRelease (uint8_t *buf)
+{
+  uint8_t idx = (buf >= ncmRxNtb[1]) ? 1 : 0;
+
+  if (ncmRxRef[idx] != 0)
+  {
+    /* The SOF handler resumes the reception if it was paused */
+    ncmRxRef[idx]--;
+  }
+}
+
+/**
+  * @brief  USBD_NCM_SetLink
+  *         Report a change of the network connection to the host
+  * @param  up: 1 if connected, else 0
+  * @param  speed: bit rate of the connection
+  * @retval None
+  */
+void USBD_NCM_SetLink (uint8_t up, uint32_t speed)
+{
+  ncmLinkUp = up;
+  ncmLinkSpeed = speed;
+
+  /* Sent from the SOF handler */
+  ncmNotifySpeed = 1;
+  ncmNotifyConn  = 1;
+}
+
+/**
+  * @brief  USBD_ncm_GetCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_ncm_GetCfgDesc (uint8_t speed, uint16_t *length)
+{
+  *length = sizeof (usbd_ncm_CfgDesc);
+  return usbd_ncm_CfgDesc;
+}
+
+/**
+  * @brief  USBD_ncm_GetOtherCfgDesc
+  *         Return other speed configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+#ifdef USB_OTG_HS_CORE
+static uint8_t  *USBD_ncm_GetOtherCfgDesc (uint8_t speed, uint16_t *length)
+{
+  *length = sizeof (usbd_ncm_OtherCfgDesc);
+  return usbd_ncm_OtherCfgDesc;
+}
+#endif
+
+/**
+  * @brief  USBD_ncm_GetUsrStrDesc
+  *         Return the MAC address string descriptor
+  * @param  speed : current device speed
+  * @param  index: desciptor index
+  * @param  length : pointer data length
+  * @retval pointer to the descriptor table or NULL if the descriptor is not supported.
+  */
+static uint8_t  *USBD_ncm_GetUsrStrDesc (uint8_t speed, uint8_t index, uint16_t *length)
+{
+  if (index == NCM_MAC_STR_IDX)
+  {
+    USBD_GetString ((uint8_t *)NCM_MAC_ADDRESS, USBD_StrDesc, length);
+    return USBD_StrDesc;
+  }
+
+  /* Not supported string descriptor index */
+  return NULL;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
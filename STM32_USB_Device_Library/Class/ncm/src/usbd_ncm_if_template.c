@@ -0,0 +1,195 @@
+/**
+  ******************************************************************************
+  * @file    usbd_ncm_if_template.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   Network interface layer of the NCM class.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_ncm_if_template.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Datagrams received and not yet taken by the network stack */
+#define TEMPLATE_RX_QUEUE_SIZE    16
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* The datagrams stay in the OUT NTB buffer of the NCM core until they are
+   released: with lwIP, TEMPLATE_Poll wraps each one in a PBUF_REF custom
+   pbuf (pbuf_alloced_custom) whose free function calls USBD_NCM_RxRelease,
+   and passes it to netif->input. */
+static uint8_t  *RxQueueBuf [TEMPLATE_RX_QUEUE_SIZE];
+static uint16_t  RxQueueLen [TEMPLATE_RX_QUEUE_SIZE];
+static __IO uint32_t RxQueueIn  = 0;
+static __IO uint32_t RxQueueOut = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t TEMPLATE_Init     (void);
+static uint16_t TEMPLATE_DeInit   (void);
+static uint16_t TEMPLATE_Ctrl     (uint32_t Cmd, uint8_t* Buf, uint32_t Len);
+static uint16_t TEMPLATE_Recv     (uint8_t* Buf, uint32_t Len);
+
+NCM_IF_Prop_TypeDef TEMPLATE_fops =
+{
+  TEMPLATE_Init,
+  TEMPLATE_DeInit,
+  TEMPLATE_Ctrl,
+  TEMPLATE_Recv
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  TEMPLATE_Init
+  *         Initializes the network interface
+  * @param  None
+  * @retval Result of the opeartion: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static uint16_t TEMPLATE_Init(void)
+{
+  /*
+     Add your initialization code here
+  */
+  return USBD_OK;
+}
+
+/**
+  * @brief  TEMPLATE_DeInit
+  *         DeInitializes the network interface
+  * @param  None
+  * @retval Result of the opeartion: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static uint16_t TEMPLATE_DeInit(void)
+{
+  /*
+     Add your deinitialization code here
+  */
+  return USBD_OK;
+}
+
+
+/**
+  * @brief  TEMPLATE_Ctrl
+  *         Manage the NCM class requests
+  * @param  Cmd: Command code
+  * @param  Buf: Buffer containing command data (request parameters)
+  * @param  Len: Number of data to be sent (in bytes)
+  * @retval Result of the opeartion: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static uint16_t TEMPLATE_Ctrl (uint32_t Cmd, uint8_t* Buf, uint32_t Len)
+{
+  switch (Cmd)
+  {
+  case SET_ETHERNET_PACKET_FILTER:
+    /* Add your code here */
+    break;
+
+  case SET_ETHERNET_MULTICAST_FILTERS:
+    /* Add your code here */
+    break;
+
+  default:
+    break;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  TEMPLATE_Recv
+  *         Datagram received from the host. It is queued for TEMPLATE_Poll
+  *         and stays in the NTB buffer until USBD_NCM_RxRelease.
+  * @param  Buf: Ethernet frame
+  * @param  Len: Length of the frame (in bytes)
+  * @retval USBD_BUSY if the frame is kept, USBD_OK if it was dropped
+  */
+static uint16_t TEMPLATE_Recv (uint8_t* Buf, uint32_t Len)
+{
+  uint32_t in = RxQueueIn;
+
+  if (((in + 1) % TEMPLATE_RX_QUEUE_SIZE) == RxQueueOut)
+  {
+    /* Queue full: drop the frame */
+    return USBD_OK;
+  }
+
+  RxQueueBuf[in] = Buf;
+  RxQueueLen[in] = Len;
+  RxQueueIn = (in + 1) % TEMPLATE_RX_QUEUE_SIZE;
+
+  return USBD_BUSY;
+}
+
+/**
+  * @brief  TEMPLATE_Poll
+  *         Pass the received datagrams to the network stack, from the
+  *         application loop or the stack thread.
+  * @param  None
+  * @retval None
+  */
+void TEMPLATE_Poll (void)
+{
+  uint32_t out;
+
+  while ((out = RxQueueOut) != RxQueueIn)
+  {
+    /* XXX_Input(RxQueueBuf[out], RxQueueLen[out]); */
+
+    /* Release the frame once the stack is done with it */
+    USBD_NCM_RxRelease(RxQueueBuf[out]);
+    RxQueueOut = (out + 1) % TEMPLATE_RX_QUEUE_SIZE;
+  }
+}
+
+/**
+  * @brief  TEMPLATE_Output
+  *         Send a datagram to the host. With lwIP this is the netif
+  *         linkoutput function, copying the pbuf chain (pbuf_copy_partial)
+  *         straight into the IN NTB.
+  * @param  Buf: Ethernet frame
+  * @param  Len: Length of the frame (in bytes)
+  * @retval USBD_OK if the frame is queued, USBD_BUSY if the NTBs are full
+  */
+uint16_t TEMPLATE_Output (uint8_t* Buf, uint32_t Len)
+{
+  uint8_t  *frame;
+  uint32_t i;
+
+  frame = USBD_NCM_TxAlloc(Len);
+  if (frame == NULL)
+  {
+    return USBD_BUSY;
+  }
+
+  for (i = 0; i < Len; i++)
+  {
+    frame[i] = Buf[i];
+  }
+
+  USBD_NCM_TxCommit(Len);
+
+  return USBD_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,153 @@
+/**
+  ******************************************************************************
+  * @file    usbd_uas_core.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   header for the usbd_uas_core.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _USB_UAS_CORE_H_
+#define _USB_UAS_CORE_H_
+
+#include  "usbd_ioreq.h"
+
+/** @addtogroup USBD_MSC_BOT
+  * @{
+  */
+
+/** @defgroup USBD_UAS
+  * @brief This file is the Header file for usbd_uas_core.c
+  * @{
+  */
+
+
+/** @defgroup USBD_UAS_Exported_Defines
+  * @{
+  */
+
+/* Command and status pipes. The data pipes are MSC_IN_EP and MSC_OUT_EP,
+   used by the SCSI layer. */
+#ifndef UAS_CMD_EP
+ #define UAS_CMD_EP                  0x02
+#endif
+#ifndef UAS_STATUS_EP
+ #define UAS_STATUS_EP               0x82
+#endif
+#define UAS_DATA_IN_EP               MSC_IN_EP
+#define UAS_DATA_OUT_EP              MSC_OUT_EP
+
+/* Number of tagged commands queued by the device */
+#ifndef UAS_QUEUE_DEPTH
+ #define UAS_QUEUE_DEPTH             8
+#endif
+
+#define USB_UAS_CONFIG_DESC_SIZ      62
+
+/* Information units */
+#define UAS_IU_COMMAND               0x01
+#define UAS_IU_SENSE                 0x03
+#define UAS_IU_RESPONSE              0x04
+#define UAS_IU_TASK_MGMT             0x05
+#define UAS_IU_READ_READY            0x06
+#define UAS_IU_WRITE_READY           0x07
+
+#define UAS_CMD_IU_LENGTH            32
+#define UAS_TASK_MGMT_IU_LENGTH      16
+#define UAS_SENSE_IU_LENGTH          16
+#define UAS_RESPONSE_IU_LENGTH       8
+#define UAS_READY_IU_LENGTH          4
+
+/* Pipe usage descriptor */
+#define UAS_PIPE_USAGE_DESC          0x24
+#define UAS_PIPE_CMD                 0x01
+#define UAS_PIPE_STATUS              0x02
+#define UAS_PIPE_DATA_IN             0x03
+#define UAS_PIPE_DATA_OUT            0x04
+
+/* Task management functions */
+#define UAS_TMF_ABORT_TASK           0x01
+#define UAS_TMF_ABORT_TASK_SET       0x02
+#define UAS_TMF_CLEAR_TASK_SET       0x04
+#define UAS_TMF_LUN_RESET            0x08
+#define UAS_TMF_IT_NEXUS_RESET       0x10
+#define UAS_TMF_QUERY_TASK           0x80
+
+/* Response codes */
+#define UAS_RC_TMF_COMPLETE          0x00
+#define UAS_RC_INVALID_IU            0x02
+#define UAS_RC_TMF_NOT_SUPPORTED     0x04
+#define UAS_RC_TMF_FAILED            0x05
+#define UAS_RC_TMF_SUCCEEDED         0x08
+#define UAS_RC_INCORRECT_LUN         0x09
+#define UAS_RC_OVERLAPPED_TAG        0x0A
+
+/* SCSI status of the sense IU */
+#define UAS_STATUS_GOOD              0x00
+#define UAS_STATUS_CHECK_CONDITION   0x02
+
+/* Command states */
+#define UAS_IDLE                     0       /* No command running */
+#define UAS_DATA                     1       /* Data stage of the head command */
+#define UAS_STATUS                   2       /* Sense IU of the head command */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_UAS_Exported_TypesDefinitions
+  * @{
+  */
+
+/* Queued command: tag, logical unit and CDB of a command IU */
+typedef struct _UAS_CMD
+{
+  uint16_t tag;
+  uint8_t  lun;
+  uint8_t  aborted;
+  uint8_t  cdb[16];
+}
+UAS_Cmd_TypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_UAS_Exported_Variables
+  * @{
+  */
+
+extern USBD_Class_cb_TypeDef  USBD_UAS_cb;
+extern uint8_t                UAS_State;
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+#endif  // _USB_UAS_CORE_H_
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,1142 @@
+/**
+  ******************************************************************************
+  * @file    usbd_uas_core.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   This file provides all the UAS core functions.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                UAS Class  Description
+  *          ===================================================================
+  *           This module manages the USB Attached SCSI protocol (UAS, USB 2.0
+  *           mode) over four bulk pipes: command, status, data-in and
+  *           data-out.
+  *           This driver implements the following aspects of the specification:
+  *             - Command, sense, response, read/write ready and task
+  *               management information units
+  *             - Up to UAS_QUEUE_DEPTH tagged commands queued by the host,
+  *               executed in order by the SCSI layer of the MSC class
+  *             - Subclass : SCSI transparent command set (ref. SCSI Primary Commands - 3 (SPC-3))
+  *
+  *           The SCSI commands are served by usbd_msc_scsi.c, which moves the
+  *           data on MSC_IN_EP and MSC_OUT_EP: these are the data-in and
+  *           data-out pipes. usbd_msc_bot.c and usbd_msc_data.c are linked
+  *           for the buffers they hold.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_uas_core.h"
+#include "usbd_msc_core.h"
+#include "usbd_msc_bot.h"
+#include "usbd_msc_scsi.h"
+#include "usbd_msc_mem.h"
+#include "usbd_msc_cache.h"
+#include "usbd_msc_bench.h"
+#include "usbd_req.h"
+
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup UAS_CORE
+  * @brief USB Attached SCSI core module
+  * @{
+  */
+
+/** @defgroup UAS_CORE_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup UAS_CORE_Private_Defines
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+
+/** @defgroup UAS_CORE_Private_Macros
+  * @{
+  */
+#define UAS_BE16(p)             (((uint32_t)(p)[0] <<  8) | (uint32_t)(p)[1])
+#define UAS_BE32(p)             (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | \
+                                 ((uint32_t)(p)[2] <<  8) | (uint32_t)(p)[3])
+
+#define UAS_QUEUE_IDX(n)        ((UAS_QHead + (n)) % UAS_QUEUE_DEPTH)
+/**
+  * @}
+  */
+
+
+/** @defgroup UAS_CORE_Private_FunctionPrototypes
+  * @{
+  */
+uint8_t  USBD_UAS_Init (void  *pdev,
+                            uint8_t cfgidx);
+
+uint8_t  USBD_UAS_DeInit (void  *pdev,
+                              uint8_t cfgidx);
+
+uint8_t  USBD_UAS_Setup (void  *pdev,
+                             USB_SETUP_REQ *req);
+
+uint8_t  USBD_UAS_DataIn (void  *pdev,
+                              uint8_t epnum);
+
+
+uint8_t  USBD_UAS_DataOut (void  *pdev,
+                               uint8_t epnum);
+
+#ifdef MSC_CACHE_ENABLED
+uint8_t  USBD_UAS_SOF (void  *pdev);
+#endif
+
+uint8_t  *USBD_UAS_GetCfgDesc (uint8_t speed,
+                                      uint16_t *length);
+
+#ifdef USB_OTG_HS_CORE
+uint8_t  *USBD_UAS_GetOtherCfgDesc (uint8_t speed,
+                                      uint16_t *length);
+#endif
+
+static void     UAS_CmdReceived (USB_OTG_CORE_HANDLE  *pdev);
+static void     UAS_TaskMgmt (uint8_t function,
+                              uint16_t task_tag,
+                              uint8_t lun);
+static int8_t   UAS_FindTag (uint16_t tag);
+static uint8_t  UAS_LunValid (uint8_t lun);
+static uint32_t UAS_DataLength (uint8_t lun, uint8_t *cdb);
+static void     UAS_Start (USB_OTG_CORE_HANDLE  *pdev);
+static void     UAS_SendStatus (USB_OTG_CORE_HANDLE  *pdev, uint8_t status);
+static void     UAS_StatusKick (USB_OTG_CORE_HANDLE  *pdev);
+static void     UAS_Kick (USB_OTG_CORE_HANDLE  *pdev);
+
+
+uint8_t USBD_UAS_CfgDesc[USB_UAS_CONFIG_DESC_SIZ];
+
+/**
+  * @}
+  */
+
+
+/** @defgroup UAS_CORE_Private_Variables
+  * @{
+  */
+
+
+USBD_Class_cb_TypeDef  USBD_UAS_cb =
+{
+  USBD_UAS_Init,
+  USBD_UAS_DeInit,
+  USBD_UAS_Setup,
+  NULL, /*EP0_TxSent*/
+  NULL, /*EP0_RxReady*/
+  USBD_UAS_DataIn,
+  USBD_UAS_DataOut,
+#ifdef MSC_CACHE_ENABLED
+  USBD_UAS_SOF,
+#else
+  NULL, /*SOF */
+#endif
+  NULL,
+  NULL,
+  USBD_UAS_GetCfgDesc,
+#ifdef USB_OTG_HS_CORE
+  USBD_UAS_GetOtherCfgDesc,
+#endif
+};
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+/* USB Attached SCSI device Configuration Descriptor */
+/*   All Descriptors (Configuration, Interface, Endpoint, Class, Vendor */
+__ALIGN_BEGIN uint8_t USBD_UAS_CfgDesc[USB_UAS_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+
+  0x09,   /* bLength: Configuation Descriptor size */
+  USB_DESC_TYPE_CONFIGURATION,   /* bDescriptorType: Configuration */
+  USB_UAS_CONFIG_DESC_SIZ,
+
+  0x00,
+  0x01,   /* bNumInterfaces: 1 interface */
+  0x01,   /* bConfigurationValue: */
+  0x04,   /* iConfiguration: */
+  0xC0,   /* bmAttributes: */
+  0x32,   /* MaxPower 100 mA */
+
+  /********************  Mass Storage interface ********************/
+  0x09,   /* bLength: Interface Descriptor size */
+  0x04,   /* bDescriptorType: */
+  0x00,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x04,   /* bNumEndpoints*/
+  0x08,   /* bInterfaceClass: MSC Class */
+  0x06,   /* bInterfaceSubClass : SCSI transparent*/
+  0x62,   /* nInterfaceProtocol: UAS */
+  0x05,          /* iInterface: */
+  /********************  UAS Endpoints ********************/
+  0x07,   /*Endpoint descriptor length = 7 */
+  0x05,   /*Endpoint descriptor type */
+  UAS_CMD_EP,   /*Endpoint address (OUT) */
+  0x02,   /*Bulk endpoint type */
+  LOBYTE(MSC_MAX_PACKET),
+  HIBYTE(MSC_MAX_PACKET),
+  0x00,   /*Polling interval in milliseconds*/
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_CMD,   /*bPipeID: command pipe */
+  0x00,
+
+  0x07,   /*Endpoint descriptor length = 7*/
+  0x05,   /*Endpoint descriptor type */
+  UAS_STATUS_EP,   /*Endpoint address (IN) */
+  0x02,   /*Bulk endpoint type */
+  LOBYTE(MSC_MAX_PACKET),
+  HIBYTE(MSC_MAX_PACKET),
+  0x00,   /*Polling interval in milliseconds */
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_STATUS,   /*bPipeID: status pipe */
+  0x00,
+
+  0x07,   /*Endpoint descriptor length = 7*/
+  0x05,   /*Endpoint descriptor type */
+  UAS_DATA_IN_EP,   /*Endpoint address (IN) */
+  0x02,   /*Bulk endpoint type */
+  LOBYTE(MSC_MAX_PACKET),
+  HIBYTE(MSC_MAX_PACKET),
+  0x00,   /*Polling interval in milliseconds */
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_DATA_IN,   /*bPipeID: data-in pipe */
+  0x00,
+
+  0x07,   /*Endpoint descriptor length = 7 */
+  0x05,   /*Endpoint descriptor type */
+  UAS_DATA_OUT_EP,   /*Endpoint address (OUT) */
+  0x02,   /*Bulk endpoint type */
+  LOBYTE(MSC_MAX_PACKET),
+  HIBYTE(MSC_MAX_PACKET),
+  0x00,   /*Polling interval in milliseconds*/
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_DATA_OUT,   /*bPipeID: data-out pipe */
+  0x00
+};
+#ifdef USB_OTG_HS_CORE
+ #ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+   #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+     #pragma data_alignment=4
+   #endif
+ #endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN uint8_t USBD_UAS_OtherCfgDesc[USB_UAS_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+
+  0x09,   /* bLength: Configuation Descriptor size */
+  USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION,
+  USB_UAS_CONFIG_DESC_SIZ,
+
+  0x00,
+  0x01,   /* bNumInterfaces: 1 interface */
+  0x01,   /* bConfigurationValue: */
+  0x04,   /* iConfiguration: */
+  0xC0,   /* bmAttributes: */
+  0x32,   /* MaxPower 100 mA */
+
+  /********************  Mass Storage interface ********************/
+  0x09,   /* bLength: Interface Descriptor size */
+  0x04,   /* bDescriptorType: */
+  0x00,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x04,   /* bNumEndpoints*/
+  0x08,   /* bInterfaceClass: MSC Class */
+  0x06,   /* bInterfaceSubClass : SCSI transparent command set*/
+  0x62,   /* nInterfaceProtocol: UAS */
+  0x05,          /* iInterface: */
+  /********************  UAS Endpoints ********************/
+  0x07,   /*Endpoint descriptor length = 7 */
+  0x05,   /*Endpoint descriptor type */
+  UAS_CMD_EP,   /*Endpoint address (OUT) */
+  0x02,   /*Bulk endpoint type */
+  0x40,
+  0x00,
+  0x00,   /*Polling interval in milliseconds*/
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_CMD,   /*bPipeID: command pipe */
+  0x00,
+
+  0x07,   /*Endpoint descriptor length = 7*/
+  0x05,   /*Endpoint descriptor type */
+  UAS_STATUS_EP,   /*Endpoint address (IN) */
+  0x02,   /*Bulk endpoint type */
+  0x40,
+  0x00,
+  0x00,   /*Polling interval in milliseconds */
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_STATUS,   /*bPipeID: status pipe */
+  0x00,
+
+  0x07,   /*Endpoint descriptor length = 7*/
+  0x05,   /*Endpoint descriptor type */
+  UAS_DATA_IN_EP,   /*Endpoint address (IN) */
+  0x02,   /*Bulk endpoint type */
+  0x40,
+  0x00,
+  0x00,   /*Polling interval in milliseconds */
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_DATA_IN,   /*bPipeID: data-in pipe */
+  0x00,
+
+  0x07,   /*Endpoint descriptor length = 7 */
+  0x05,   /*Endpoint descriptor type */
+  UAS_DATA_OUT_EP,   /*Endpoint address (OUT) */
+  0x02,   /*Bulk endpoint type */
+  0x40,
+  0x00,
+  0x00,   /*Polling interval in milliseconds*/
+
+  0x04,   /*Pipe usage descriptor length = 4 */
+  UAS_PIPE_USAGE_DESC,
+  UAS_PIPE_DATA_OUT,   /*bPipeID: data-out pipe */
+  0x00
+};
+#endif
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t  USBD_UAS_AltSet  __ALIGN_END = 0;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t  UAS_CmdBuf[UAS_CMD_IU_LENGTH] __ALIGN_END;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t  UAS_StatusBuf[UAS_SENSE_IU_LENGTH + REQUEST_SENSE_DATA_LEN] __ALIGN_END;
+
+uint8_t                 UAS_State;
+
+/* Commands queued by the host, UAS_QHead being the one of the SCSI layer
+   while UAS_State is not UAS_IDLE */
+static UAS_Cmd_TypeDef  UAS_Queue[UAS_QUEUE_DEPTH];
+static uint8_t          UAS_QHead;
+static uint8_t          UAS_QCount;
+static uint8_t          UAS_CmdArmed;
+
+/* Status pipe: IU in flight and IUs waiting for it */
+static uint8_t          UAS_StatusBusy;
+static uint8_t          UAS_StatusIU;
+static uint8_t          UAS_ReadyPending;
+static uint8_t          UAS_SensePending;
+static uint8_t          UAS_SenseStatus;
+static uint8_t          UAS_RespPending;
+static uint8_t          UAS_RespCode;
+static uint16_t         UAS_RespTag;
+
+/**
+  * @}
+  */
+
+
+/** @defgroup UAS_CORE_Private_Functions
+  * @{
+  */
+
+/**
+* @brief  USBD_UAS_Init
+*         Initialize  the UAS configuration
+* @param  pdev: device instance
+* @param  cfgidx: configuration index
+* @retval status
+*/
+uint8_t  USBD_UAS_Init (void  *pdev,
+                            uint8_t cfgidx)
+{
+  USBD_UAS_DeInit(pdev , cfgidx );
+
+  DCD_EP_Open(pdev,
+              UAS_CMD_EP,
+              MSC_EPOUT_SIZE,
+              USB_OTG_EP_BULK);
+
+  DCD_EP_Open(pdev,
+              UAS_STATUS_EP,
+              MSC_EPIN_SIZE,
+              USB_OTG_EP_BULK);
+
+  DCD_EP_Open(pdev,
+              UAS_DATA_IN_EP,
+              MSC_EPIN_SIZE,
+              USB_OTG_EP_BULK);
+
+  DCD_EP_Open(pdev,
+              UAS_DATA_OUT_EP,
+              MSC_EPOUT_SIZE,
+              USB_OTG_EP_BULK);
+
+  UAS_QHead        = 0;
+  UAS_QCount       = 0;
+  UAS_CmdArmed     = 0;
+  UAS_StatusBusy   = 0;
+  UAS_ReadyPending = 0;
+  UAS_SensePending = 0;
+  UAS_RespPending  = 0;
+
+  /* The data stages of the SCSI layer end with a sense IU */
+  SCSI_StatusCb = UAS_SendStatus;
+  MSC_BOT_State = BOT_IDLE;
+  USBD_STORAGE_fops->Init(0);
+#ifdef MSC_CACHE_ENABLED
+  MSC_Cache_Init();
+#endif
+
+  DCD_EP_Flush(pdev, UAS_CMD_EP);
+  DCD_EP_Flush(pdev, UAS_STATUS_EP);
+  DCD_EP_Flush(pdev, UAS_DATA_IN_EP);
+  DCD_EP_Flush(pdev, UAS_DATA_OUT_EP);
+
+  UAS_Kick(pdev);
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UAS_DeInit
+*         DeInitilaize  the UAS configuration
+* @param  pdev: device instance
+* @param  cfgidx: configuration index
+* @retval status
+*/
+uint8_t  USBD_UAS_DeInit (void  *pdev,
+                              uint8_t cfgidx)
+{
+  DCD_EP_Close (pdev , UAS_CMD_EP);
+  DCD_EP_Close (pdev , UAS_STATUS_EP);
+  DCD_EP_Close (pdev , UAS_DATA_IN_EP);
+  DCD_EP_Close (pdev , UAS_DATA_OUT_EP);
+
+  UAS_State     = UAS_IDLE;
+  MSC_BOT_State = BOT_IDLE;
+#ifdef MSC_CACHE_ENABLED
+  MSC_Cache_Flush();
+#endif
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UAS_Setup
+*         Handle the UAS specific requests: UAS defines no class request
+* @param  pdev: device instance
+* @param  req: USB request
+* @retval status
+*/
+uint8_t  USBD_UAS_Setup (void  *pdev, USB_SETUP_REQ *req)
+{
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
+  {
+
+  /* Class request */
+  case USB_REQ_TYPE_CLASS :
+    USBD_CtlError(pdev , req);
+    return USBD_FAIL;
+
+  /* Interface & Endpoint request */
+  case USB_REQ_TYPE_STANDARD:
+    switch (req->bRequest)
+    {
+    case USB_REQ_GET_INTERFACE :
+      USBD_CtlSendData (pdev,
+                        &USBD_UAS_AltSet,
+                        1);
+      break;
+
+    case USB_REQ_SET_INTERFACE :
+      USBD_UAS_AltSet = (uint8_t)(req->wValue);
+      break;
+
+    case USB_REQ_CLEAR_FEATURE:
+
+      /* Flush the FIFO and Clear the stall status */
+      DCD_EP_Flush(pdev, (uint8_t)req->wIndex);
+
+      /* Re-activate the EP */
+      DCD_EP_Close (pdev , (uint8_t)req->wIndex);
+      if((((uint8_t)req->wIndex) & 0x80) == 0x80)
+      {
+        DCD_EP_Open(pdev,
+                    ((uint8_t)req->wIndex),
+                    MSC_EPIN_SIZE,
+                    USB_OTG_EP_BULK);
+      }
+      else
+      {
+        DCD_EP_Open(pdev,
+                    ((uint8_t)req->wIndex),
+                    MSC_EPOUT_SIZE,
+                    USB_OTG_EP_BULK);
+      }
+
+      if ((uint8_t)req->wIndex == UAS_CMD_EP)
+      {
+        UAS_CmdArmed = 0;
+        UAS_Kick(pdev);
+      }
+      break;
+
+    }
+    break;
+
+  default:
+    break;
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UAS_DataIn
+*         handle data IN Stage: end of a status IU or of a data-in transfer
+* @param  pdev: device instance
+* @param  epnum: endpoint index
+* @retval status
+*/
+uint8_t  USBD_UAS_DataIn (void  *pdev,
+                              uint8_t epnum)
+{
+  if ((epnum & 0x7F) == (UAS_STATUS_EP & 0x7F))
+  {
+    UAS_StatusBusy = 0;
+    if (UAS_StatusIU == UAS_IU_SENSE)
+    {
+      /* The head command is over */
+      UAS_QHead = UAS_QUEUE_IDX(1);
+      UAS_QCount--;
+      UAS_State = UAS_IDLE;
+    }
+    UAS_Kick(pdev);
+    return USBD_OK;
+  }
+
+  switch (MSC_BOT_State)
+  {
+  case BOT_DATA_IN:
+    if(SCSI_ProcessCmd(pdev,
+                       MSC_BOT_cbw.bLUN,
+                       &MSC_BOT_cbw.CB[0]) < 0)
+    {
+      UAS_SendStatus (pdev, CSW_CMD_FAILED);
+    }
+    break;
+
+  case BOT_SEND_DATA:
+    UAS_SendStatus (pdev, CSW_CMD_PASSED);
+    break;
+
+  case BOT_LAST_DATA_IN:
+    UAS_SendStatus (pdev, CSW_CMD_PASSED);
+#ifdef MSC_READ_AHEAD_ENABLED
+    SCSI_ReadAhead();
+#endif
+    break;
+
+  default:
+    break;
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_UAS_DataOut
+*         handle data OUT Stage: command IU or data-out packet received
+* @param  pdev: device instance
+* @param  epnum: endpoint index
+* @retval status
+*/
+uint8_t  USBD_UAS_DataOut (void  *pdev,
+                               uint8_t epnum)
+{
+  if (epnum == (UAS_CMD_EP & 0x7F))
+  {
+    UAS_CmdReceived(pdev);
+  }
+  else if (MSC_BOT_State == BOT_DATA_OUT)
+  {
+    if(SCSI_ProcessCmd(pdev,
+                       MSC_BOT_cbw.bLUN,
+                       &MSC_BOT_cbw.CB[0]) < 0)
+    {
+      UAS_SendStatus (pdev, CSW_CMD_FAILED);
+    }
+  }
+  return USBD_OK;
+}
+
+#ifdef MSC_CACHE_ENABLED
+/**
+* @brief  USBD_UAS_SOF
+*         Run the idle timer of the cache while no command runs
+* @param  pdev: device instance
+* @retval status
+*/
+uint8_t  USBD_UAS_SOF (void  *pdev)
+{
+  if (UAS_State == UAS_IDLE)
+  {
+    MSC_Cache_SOF();
+  }
+  return USBD_OK;
+}
+#endif
+
+/**
+* @brief  USBD_UAS_GetCfgDesc
+*         return configuration descriptor
+* @param  speed : current device speed
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+uint8_t  *USBD_UAS_GetCfgDesc (uint8_t speed, uint16_t *length)
+{
+  *length = sizeof (USBD_UAS_CfgDesc);
+  return USBD_UAS_CfgDesc;
+}
+
+/**
+* @brief  USBD_UAS_GetOtherCfgDesc
+*         return other speed configuration descriptor
+* @param  speed : current device speed
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+#ifdef USB_OTG_HS_CORE
+uint8_t  *USBD_UAS_GetOtherCfgDesc (uint8_t speed,
+                                      uint16_t *length)
+{
+  *length = sizeof (USBD_UAS_OtherCfgDesc);
+  return USBD_UAS_OtherCfgDesc;
+}
+#endif
+
+/**
+* @brief  UAS_CmdReceived
+*         Queue a command IU or serve a task management IU. A rejected IU
+*         is answered with a response IU.
+* @param  pdev: device instance
+* @retval None
+*/
+static void UAS_CmdReceived (USB_OTG_CORE_HANDLE  *pdev)
+{
+  UAS_Cmd_TypeDef *cmd;
+  uint16_t len;
+  uint16_t tag;
+  uint8_t  lun;
+  uint8_t  i;
+
+  UAS_CmdArmed = 0;
+  len = USBD_GetRxCount (pdev, UAS_CMD_EP);
+  tag = UAS_BE16(&UAS_CmdBuf[2]);
+
+  /* Single level LUN addressing */
+  lun = (UAS_CmdBuf[8] == 0) ? UAS_CmdBuf[9] : 0xFF;
+
+  UAS_RespTag  = tag;
+  UAS_RespCode = UAS_RC_INVALID_IU;
+
+  if ((UAS_CmdBuf[0] == UAS_IU_COMMAND) && (len >= UAS_CMD_IU_LENGTH) &&
+      ((UAS_CmdBuf[6] & 0xFC) == 0))
+  {
+    if (UAS_LunValid(lun) == 0)
+    {
+      UAS_RespCode = UAS_RC_INCORRECT_LUN;
+    }
+    else if (UAS_FindTag(tag) >= 0)
+    {
+      UAS_RespCode = UAS_RC_OVERLAPPED_TAG;
+    }
+    else
+    {
+      cmd = &UAS_Queue[UAS_QUEUE_IDX(UAS_QCount)];
+      cmd->tag     = tag;
+      cmd->lun     = lun;
+      cmd->aborted = 0;
+      for (i = 0; i < 16; i++)
+      {
+        cmd->cdb[i] = UAS_CmdBuf[16 + i];
+      }
+      UAS_QCount++;
+      UAS_Kick(pdev);
+      return;
+    }
+  }
+  else if ((UAS_CmdBuf[0] == UAS_IU_TASK_MGMT) && (len >= UAS_TASK_MGMT_IU_LENGTH))
+  {
+    UAS_TaskMgmt(UAS_CmdBuf[4], UAS_BE16(&UAS_CmdBuf[6]), lun);
+  }
+
+  UAS_RespPending = 1;
+  UAS_Kick(pdev);
+}
+
+/**
+* @brief  UAS_TaskMgmt
+*         Serve a task management function into UAS_RespCode. The commands
+*         not started yet are aborted, the running one completes.
+* @param  function: task management function
+* @param  task_tag: tag of the managed task
+* @param  lun: Logical unit number
+* @retval None
+*/
+static void UAS_TaskMgmt (uint8_t function,
+                          uint16_t task_tag,
+                          uint8_t lun)
+{
+  int8_t  n;
+  uint8_t i;
+
+  if ((function != UAS_TMF_IT_NEXUS_RESET) && (UAS_LunValid(lun) == 0))
+  {
+    UAS_RespCode = UAS_RC_INCORRECT_LUN;
+    return;
+  }
+
+  switch (function)
+  {
+  case UAS_TMF_ABORT_TASK:
+    n = UAS_FindTag(task_tag);
+    if ((n == 0) && (UAS_State != UAS_IDLE))
+    {
+      UAS_RespCode = UAS_RC_TMF_FAILED;
+      return;
+    }
+    if (n >= 0)
+    {
+      UAS_Queue[UAS_QUEUE_IDX(n)].aborted = 1;
+    }
+    UAS_RespCode = UAS_RC_TMF_COMPLETE;
+    break;
+
+  case UAS_TMF_ABORT_TASK_SET:
+  case UAS_TMF_CLEAR_TASK_SET:
+  case UAS_TMF_LUN_RESET:
+  case UAS_TMF_IT_NEXUS_RESET:
+    for (i = (UAS_State != UAS_IDLE) ? 1 : 0; i < UAS_QCount; i++)
+    {
+      if ((function == UAS_TMF_IT_NEXUS_RESET) ||
+          (UAS_Queue[UAS_QUEUE_IDX(i)].lun == lun))
+      {
+        UAS_Queue[UAS_QUEUE_IDX(i)].aborted = 1;
+      }
+    }
+    UAS_RespCode = UAS_RC_TMF_COMPLETE;
+    break;
+
+  case UAS_TMF_QUERY_TASK:
+    UAS_RespCode = (UAS_FindTag(task_tag) >= 0) ? UAS_RC_TMF_SUCCEEDED : UAS_RC_TMF_COMPLETE;
+    break;
+
+  default:
+    UAS_RespCode = UAS_RC_TMF_NOT_SUPPORTED;
+    break;
+  }
+}
+
+/**
+* @brief  UAS_FindTag
+*         Look for a queued command
+* @param  tag: command tag
+* @retval position in the queue, -1 when not queued
+*/
+static int8_t UAS_FindTag (uint16_t tag)
+{
+  uint8_t n;
+
+  for (n = 0; n < UAS_QCount; n++)
+  {
+    if ((UAS_Queue[UAS_QUEUE_IDX(n)].aborted == 0) &&
+        (UAS_Queue[UAS_QUEUE_IDX(n)].tag == tag))
+    {
+      return n;
+    }
+  }
+  return -1;
+}
+
+/**
+* @brief  UAS_LunValid
+*         Check a logical unit number
+* @param  lun: Logical unit number
+* @retval 1 when the logical unit exists
+*/
+static uint8_t UAS_LunValid (uint8_t lun)
+{
+  return ((lun < MSC_MAX_LUN) && ((int8_t)lun <= USBD_STORAGE_fops->GetMaxLun()));
+}
+
+/**
+* @brief  UAS_DataLength
+*         Length of the data stage implied by a CDB: UAS carries no length
+*         in the command IU, the SCSI layer checks against dDataLength
+* @param  lun: Logical unit number
+* @param  cdb: Command descriptor block
+* @retval No. of bytes
+*/
+static uint32_t UAS_DataLength (uint8_t lun, uint8_t *cdb)
+{
+  uint32_t blk_nbr;
+  SCSI_Lun_TypeDef *plun = &SCSI_Lun[lun];
+
+  switch (cdb[0])
+  {
+  case SCSI_READ10:
+  case SCSI_WRITE10:
+    blk_nbr = UAS_BE16(&cdb[7]);
+    break;
+
+  case SCSI_READ12:
+  case SCSI_WRITE12:
+    blk_nbr = UAS_BE32(&cdb[6]);
+    break;
+
+  case SCSI_READ16:
+  case SCSI_WRITE16:
+    blk_nbr = UAS_BE32(&cdb[10]);
+    break;
+
+  case SCSI_WRITE_SAME10:
+  case SCSI_WRITE_SAME16:
+    /* A single block, written to the whole range */
+    blk_nbr = 1;
+    break;
+
+  case SCSI_UNMAP:
+    return UAS_BE16(&cdb[7]);
+
+  case SCSI_INQUIRY:
+    return UAS_BE16(&cdb[3]);
+
+  case SCSI_REQUEST_SENSE:
+  case SCSI_MODE_SENSE6:
+    return cdb[4];
+
+  case SCSI_MODE_SENSE10:
+  case SCSI_READ_FORMAT_CAPACITIES:
+    return UAS_BE16(&cdb[7]);
+
+  case SCSI_READ_CAPACITY10:
+    return READ_CAPACITY10_DATA_LEN;
+
+  case SCSI_READ_CAPACITY16:
+    return UAS_BE32(&cdb[10]);
+
+  case SCSI_REPORT_LUNS:
+    return UAS_BE32(&cdb[6]);
+
+  default:
+    return 0;
+  }
+
+  /* Hosts may stream before READ CAPACITY */
+  if (plun->blk_size == 0)
+  {
+    if (USBD_STORAGE_fops->GetCapacity(lun, &plun->blk_nbr, &plun->blk_size) != 0)
+    {
+      return 0;
+    }
+  }
+
+  if (blk_nbr > (0xFFFFFFFF / plun->blk_size))
+  {
+    return 0xFFFFFFFF;
+  }
+  return blk_nbr * plun->blk_size;
+}
+
+/**
+* @brief  UAS_Start
+*         Run the command at the head of the queue through the SCSI layer,
+*         as the CBW of the bulk-only transport would
+* @param  pdev: device instance
+* @retval None
+*/
+static void UAS_Start (USB_OTG_CORE_HANDLE  *pdev)
+{
+  UAS_Cmd_TypeDef *cmd = &UAS_Queue[UAS_QHead];
+  uint32_t len;
+  uint8_t  i;
+
+  UAS_State = UAS_DATA;
+#ifdef MSC_BENCH_ENABLED
+  MSC_Bench_CmdStart(cmd->cdb[0]);
+#endif
+
+  MSC_BOT_cbw.dSignature  = BOT_CBW_SIGNATURE;
+  MSC_BOT_cbw.dTag        = cmd->tag;
+  MSC_BOT_cbw.bLUN        = cmd->lun;
+  MSC_BOT_cbw.bCBLength   = 16;
+  for (i = 0; i < 16; i++)
+  {
+    MSC_BOT_cbw.CB[i] = cmd->cdb[i];
+  }
+
+  switch (cmd->cdb[0])
+  {
+  case SCSI_WRITE6:
+  case SCSI_WRITE10:
+  case SCSI_WRITE12:
+  case SCSI_WRITE16:
+  case SCSI_WRITE_SAME10:
+  case SCSI_WRITE_SAME16:
+  case SCSI_UNMAP:
+  case SCSI_MODE_SELECT6:
+  case SCSI_MODE_SELECT10:
+    MSC_BOT_cbw.bmFlags = 0x00;
+    break;
+
+  default:
+    MSC_BOT_cbw.bmFlags = 0x80;
+    break;
+  }
+  MSC_BOT_cbw.dDataLength = UAS_DataLength(cmd->lun, cmd->cdb);
+
+  MSC_BOT_csw.dTag         = cmd->tag;
+  MSC_BOT_csw.dDataResidue = MSC_BOT_cbw.dDataLength;
+  MSC_BOT_State   = BOT_IDLE;
+  MSC_BOT_DataLen = 0;
+
+  if (SCSI_ProcessCmd(pdev, cmd->lun, &MSC_BOT_cbw.CB[0]) < 0)
+  {
+    UAS_SendStatus(pdev, CSW_CMD_FAILED);
+    return;
+  }
+
+  switch (MSC_BOT_State)
+  {
+  case BOT_DATA_IN:
+  case BOT_LAST_DATA_IN:
+  case BOT_DATA_OUT:
+    /* Data stage started by the SCSI layer */
+    if (MSC_BOT_cbw.dDataLength == 0)
+    {
+      UAS_SendStatus(pdev, CSW_CMD_PASSED);
+    }
+    else
+    {
+      UAS_ReadyPending = 1;
+    }
+    break;
+
+  default:
+    len = MIN(MSC_BOT_cbw.dDataLength, MSC_BOT_DataLen);
+    if (len > 0)
+    {
+      MSC_BOT_State = BOT_SEND_DATA;
+      DCD_EP_Tx (pdev, UAS_DATA_IN_EP, MSC_BOT_Data, len);
+      UAS_ReadyPending = 1;
+    }
+    else
+    {
+      UAS_SendStatus(pdev, CSW_CMD_PASSED);
+    }
+    break;
+  }
+}
+
+/**
+* @brief  UAS_SendStatus
+*         End the head command with a sense IU (SCSI_StatusCb)
+* @param  pdev: device instance
+* @param  status : CSW status
+* @retval None
+*/
+static void UAS_SendStatus (USB_OTG_CORE_HANDLE  *pdev, uint8_t status)
+{
+  MSC_BOT_State    = BOT_IDLE;
+  UAS_State        = UAS_STATUS;
+  UAS_SenseStatus  = status;
+  UAS_SensePending = 1;
+#ifdef MSC_BENCH_ENABLED
+  MSC_Bench_CmdEnd();
+#endif
+  UAS_StatusKick(pdev);
+}
+
+/**
+* @brief  UAS_StatusKick
+*         Send the next IU waiting for the status pipe
+* @param  pdev: device instance
+* @retval None
+*/
+static void UAS_StatusKick (USB_OTG_CORE_HANDLE  *pdev)
+{
+  uint16_t tag = UAS_Queue[UAS_QHead].tag;
+  uint16_t len;
+  uint8_t  i;
+
+  if (UAS_StatusBusy)
+  {
+    return;
+  }
+
+  for (i = 0; i < UAS_SENSE_IU_LENGTH + REQUEST_SENSE_DATA_LEN; i++)
+  {
+    UAS_StatusBuf[i] = 0;
+  }
+
+  if (UAS_RespPending)
+  {
+    UAS_RespPending = 0;
+    UAS_StatusIU = UAS_IU_RESPONSE;
+    tag = UAS_RespTag;
+    UAS_StatusBuf[7] = UAS_RespCode;
+    len = UAS_RESPONSE_IU_LENGTH;
+  }
+  else if (UAS_ReadyPending)
+  {
+    UAS_ReadyPending = 0;
+    UAS_StatusIU = (MSC_BOT_cbw.bmFlags & 0x80) ? UAS_IU_READ_READY : UAS_IU_WRITE_READY;
+    len = UAS_READY_IU_LENGTH;
+  }
+  else if (UAS_SensePending)
+  {
+    UAS_SensePending = 0;
+    UAS_StatusIU = UAS_IU_SENSE;
+    len = UAS_SENSE_IU_LENGTH;
+
+    if (UAS_SenseStatus != CSW_CMD_PASSED)
+    {
+      UAS_StatusBuf[6]  = UAS_STATUS_CHECK_CONDITION;
+      UAS_StatusBuf[15] = REQUEST_SENSE_DATA_LEN;
+
+      /* Fixed format sense data, as returned by REQUEST SENSE */
+      UAS_StatusBuf[16] = 0x70;
+      UAS_StatusBuf[16 + 7] = REQUEST_SENSE_DATA_LEN - 6;
+      if (SCSI_Sense_Head != SCSI_Sense_Tail)
+      {
+        UAS_StatusBuf[16 + 2]  = SCSI_Sense[SCSI_Sense_Head].Skey;
+        UAS_StatusBuf[16 + 12] = SCSI_Sense[SCSI_Sense_Head].w.b.ASCQ;
+        UAS_StatusBuf[16 + 13] = SCSI_Sense[SCSI_Sense_Head].w.b.ASC;
+        SCSI_Sense_Head++;
+        if (SCSI_Sense_Head == SENSE_LIST_DEEPTH)
+        {
+          SCSI_Sense_Head = 0;
+        }
+      }
+      len += REQUEST_SENSE_DATA_LEN;
+    }
+  }
+  else
+  {
+    return;
+  }
+
+  UAS_StatusBuf[0] = UAS_StatusIU;
+  UAS_StatusBuf[2] = (uint8_t)(tag >> 8);
+  UAS_StatusBuf[3] = (uint8_t)tag;
+
+  UAS_StatusBusy = 1;
+  DCD_EP_Tx (pdev, UAS_STATUS_EP, UAS_StatusBuf, len);
+}
+
+/**
+* @brief  UAS_Kick
+*         Start the next queued command, feed the status pipe and receive
+*         the next IU while the queue has room
+* @param  pdev: device instance
+* @retval None
+*/
+static void UAS_Kick (USB_OTG_CORE_HANDLE  *pdev)
+{
+  if (UAS_State == UAS_IDLE)
+  {
+    /* Aborted commands are dropped without status */
+    while ((UAS_QCount > 0) && UAS_Queue[UAS_QHead].aborted)
+    {
+      UAS_QHead = UAS_QUEUE_IDX(1);
+      UAS_QCount--;
+    }
+    if (UAS_QCount > 0)
+    {
+      UAS_Start(pdev);
+    }
+  }
+
+  UAS_StatusKick(pdev);
+
+  /* The command pipe NAKs while the queue is full or a response waits */
+  if ((UAS_CmdArmed == 0) && (UAS_RespPending == 0) &&
+      (UAS_QCount < UAS_QUEUE_DEPTH))
+  {
+    UAS_CmdArmed = 1;
+    DCD_EP_PrepareRx (pdev,
+                      UAS_CMD_EP,
+                      UAS_CmdBuf,
+                      UAS_CMD_IU_LENGTH);
+  }
+}
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
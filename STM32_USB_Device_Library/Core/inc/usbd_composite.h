@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    usbd_composite.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   header file for the usbd_composite.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+
+#ifndef __USBD_COMPOSITE_H_
+#define __USBD_COMPOSITE_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_def.h"
+#include  "usbd_core.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE
+  * @brief header file for the usbd_composite.c file
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Defines
+  * @{
+  */
+#ifdef USBD_COMPOSITE_ENABLED
+
+/* Classes registered with USBD_Composite_Add */
+#ifndef USBD_COMPOSITE_MAX_CLASS
+ #define USBD_COMPOSITE_MAX_CLASS          4
+#endif
+
+/* Room for the merged configuration descriptor */
+#ifndef USBD_COMPOSITE_CFG_DESC_SIZ
+ #define USBD_COMPOSITE_CFG_DESC_SIZ       256
+#endif
+
+/* Packet buffers shared by the classes, see USBD_Composite_Alloc */
+#ifndef USBD_COMPOSITE_ARENA_SIZE
+ #define USBD_COMPOSITE_ARENA_SIZE         8192
+#endif
+
+#define USB_IAD_DESCRIPTOR_TYPE            0x0B
+#define USB_IAD_DESC_SIZ                   0x08
+
+/* Device class of a device with interface associations */
+#define DEVICE_CLASS_MISC                  0xEF
+#define DEVICE_SUBCLASS_COMMON             0x02
+#define DEVICE_PROTOCOL_IAD                0x01
+
+#endif /* USBD_COMPOSITE_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Exported_Types
+  * @{
+  */
+#ifdef USBD_COMPOSITE_ENABLED
+/* Registered class: interfaces and endpoints it owns in the configuration */
+typedef struct _USBD_Composite_Class
+{
+  USBD_Class_cb_TypeDef  *cb;
+  uint8_t                first_itf;     /* First interface, renumbered from 0 */
+  uint8_t                num_itf;
+  uint16_t               ep_in;         /* Bit n: IN endpoint n */
+  uint16_t               ep_out;        /* Bit n: OUT endpoint n */
+}
+USBD_Composite_Class_TypeDef;
+#endif
+/**
+  * @}
+  */
+
+
+
+/** @defgroup USBD_COMPOSITE_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Variables
+  * @{
+  */
+#ifdef USBD_COMPOSITE_ENABLED
+extern USBD_Class_cb_TypeDef  USBD_Composite_cb;
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef USBD_COMPOSITE_ENABLED
+USBD_Status  USBD_Composite_Add   (USBD_Class_cb_TypeDef *class_cb);
+uint8_t      *USBD_Composite_Alloc (uint32_t size);
+#endif
+/**
+  * @}
+  */
+
+#endif /* __USBD_COMPOSITE_H_ */
+
+/**
+  * @}
+  */
+
+/**
+* @}
+*/
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -41,6 +41,167 @@
 #define USB_MAX_STR_DESC_SIZ       64 
 #define USBD_EP0_MAX_PACKET_SIZE   64
 
+/* Size the Rx/Tx FIFOs from the configuration descriptor on SET_CONFIGURATION
+   instead of using the fixed RX/TXn_FIFO_xx_SIZE values of usb_conf.h */
+/* #define USBD_DYNAMIC_FIFO_ENABLED */
+/* Max. number of packets buffered in the Tx FIFO of a bulk IN endpoint when
+   there is room left */
+/* #define USBD_FIFO_BULK_DEPTH       4 */
+
+/* MSC: the storage backend may provide ReadAsync/WriteAsync, completed
+   through USBD_STORAGE_Complete */
+/* #define MSC_STORAGE_ASYNC_ENABLED */
+
+/* MSC: write-back cache of erase block sized lines in front of the storage
+   callbacks (see usbd_msc_cache.h for MSC_CACHE_LINE_SIZE/MSC_CACHE_LINES) */
+/* #define MSC_CACHE_ENABLED */
+
+/* MSC: prefetch the packet following a sequential READ stream while the CSW
+   is sent (needs MSC_BOT_DATA_BUF_NUM >= 2) */
+/* #define MSC_READ_AHEAD_ENABLED */
+
+/* MSC: UNMAP, WRITE SAME and the provisioning VPD pages, for a storage
+   backend providing the Unmap callback (see usbd_msc_scsi.h for
+   MSC_WRITE_SAME_MAX_BLKS) */
+/* #define MSC_UNMAP_ENABLED */
+
+/* CDC: send all the contiguous data of APP_Rx_Buffer in one multi-packet
+   transfer (up to CDC_TX_BLOCK_MAX bytes) and chain the next one from the
+   IN completion */
+/* #define CDC_TX_BLOCK_ENABLED */
+
+/* CDC: CDC_Write/CDC_Read replace the direct accesses to APP_Rx_Buffer and
+   the pIf_DataRx callback, with lock-free rings safe for several producers */
+/* #define CDC_RING_ENABLED */
+
+/* MSC: time every command from CBW to CSW with the DWT cycle counter, see
+   usbd_storage_bench.c for the synthetic medium and MSC_Bench_Report */
+/* #define MSC_BENCH_ENABLED */
+
+/* End to end throughput test (usbd_perf.c, needs USB_OTG_STATS_ENABLED):
+   pattern streams of the CDC (usbd_cdc_if_perf.c), HID (usbd_hid_perf.c),
+   audio (usbd_audio_out_perf.c) and MSC bench interfaces, reported with
+   USBD_Perf_Report */
+/* #define USBD_PERF_ENABLED */
+
+/* MSC: storage backend on a NAND memory through the NAND FTL of the
+   STM32F2xx/F4xx standard peripheral library, see usbd_storage_nand.c */
+/* #define MSC_NAND_ENABLED */
+
+/* MSC: storage backend on an SPI NOR flash through the block device of
+   stm32f4xx_spi_nor.c, see usbd_storage_spinor.c (not with MSC_NAND_ENABLED) */
+/* #define MSC_SPI_NOR_ENABLED */
+
+/* UAS: command and status pipes of USBD_UAS_cb (data pipes: MSC_IN_EP and
+   MSC_OUT_EP) and number of tagged commands queued */
+/* #define UAS_CMD_EP                 0x02 */
+/* #define UAS_STATUS_EP              0x82 */
+/* #define UAS_QUEUE_DEPTH            8 */
+
+/* NCM: network interface of USBD_NCM_cb (usbd_ncm_if_template.c), which
+   needs USB_SUPPORT_USER_STRING_DESC for the MAC address string, and size
+   of each of the two IN and the two OUT NTB buffers */
+/* #define NCM_APP_FOPS               TEMPLATE_fops */
+/* #define NCM_NTB_IN_SIZE            2048 */
+/* #define NCM_NTB_OUT_SIZE           2048 */
+
+/* Vendor: application interface of USBD_VENDOR_cb (usbd_vendor_if_template.c)
+   and number of bulk IN/OUT pipes (1 to 3). Needs USB_OTG_EP_QUEUE_ENABLED
+   and USB_OTG_EP_RX_POOL_ENABLED; with USB_SUPPORT_BOS_DESC and
+   USBD_VENDOR_GetBOSDesc as GetBOSDescriptor, Windows binds WinUSB to the
+   interface from the MS OS 2.0 descriptors (bRequest VENDOR_MS_VENDOR_CODE)
+   and registers VENDOR_INTERFACE_GUID */
+/* #define VENDOR_APP_FOPS            TEMPLATE_fops */
+/* #define VENDOR_PIPES               1 */
+/* #define VENDOR_MS_VENDOR_CODE      0x20 */
+/* #define VENDOR_INTERFACE_GUID      "{6E5A3C10-1F4B-4D2A-9B7E-3C8F5A2D9E41}" */
+
+/* MIDI: application interface of USBD_MIDI_cb (usbd_midi_if_template.c),
+   IN ring of event packets (a power of 2), packets per IN transfer and
+   SOFs an event may wait for more before the IN transfer starts */
+/* #define MIDI_APP_FOPS              TEMPLATE_fops */
+/* #define MIDI_TX_RING_SIZE          512 */
+/* #define MIDI_TX_BATCH              32 */
+/* #define MIDI_IN_LATENCY            1 */
+
+/* Composite device: pass USBD_Composite_cb to USBD_Init after registering
+   the classes with USBD_Composite_Add. USBD_ITF_MAX_NUM must cover all the
+   interfaces and the endpoint addresses of the classes must differ. The NCM
+   NTB buffers come from the USBD_COMPOSITE_ARENA_SIZE byte arena. */
+/* #define USBD_COMPOSITE_ENABLED */
+/* #define USBD_COMPOSITE_MAX_CLASS   4 */
+/* #define USBD_COMPOSITE_ARENA_SIZE  8192 */
+
+/* Audio: asynchronous streaming endpoint with an explicit feedback endpoint.
+   The codec transfer complete callback (EVAL_AUDIO_TransferComplete_CallBack,
+   defined in usbd_audio_out_if.c) paces the playback, and the ring target
+   level adapts from AUDIO_FB_MIN_PACKETS packets up to half the ring */
+/* #define AUDIO_FEEDBACK_ENABLED */
+/* #define AUDIO_FB_EP                0x81 */
+/* #define AUDIO_FB_REFRESH           5 */
+
+/* Audio: with AUDIO_FEEDBACK_ENABLED, the I2S TX DMA stream plays the ring
+   in circular mode (AUDIO_OUT_DMA_xxx in usbd_audio_out_if.h): no copy and
+   no DMA restart per packet. The DMA position is the consumer of the ring,
+   read on each SOF; the codec driver only sets up the codec and the I2S */
+/* #define AUDIO_OUT_CIRCULAR_ENABLED */
+
+/* Audio: 16-bit (alternate setting 1) and 24-bit (alternate setting 2)
+   streaming at AUDIO_FREQ_1/2/3, selected with SET_CUR on the endpoint.
+   The packet buffer and the ring are carved out of an AUDIO_POOL_SIZE
+   byte pool for the selected format */
+/* #define AUDIO_MULTI_FORMAT_ENABLED */
+/* #define AUDIO_POOL_SIZE            4096 */
+
+/* Audio: microphone streaming interface (interface 2) on AUDIO_IN_EP. The
+   I2S RX DMA stream fills two targets of AUDIO_IN_FRAMES ms in double
+   buffer mode (AUDIO_IN_DMA_xxx in usbd_audio_in_if.h); the board code
+   sets up the I2S pins, clock and I2S_Init, and routes the stream
+   interrupt to AUDIO_IN_DMA_IRQHandler */
+/* #define AUDIO_IN_ENABLED */
+/* #define AUDIO_IN_EP                0x82 */
+/* #define AUDIO_IN_FREQ              48000 */
+/* #define AUDIO_IN_CHANNELS          2 */
+/* #define AUDIO_IN_FRAMES            2 */
+
+/* Audio: mixer of the 16-bit host stream with AUDIO_MIXER_SOURCES - 1 local
+   sources (usbd_audio_mixer.c, needs the CMSIS DSP library). VolumeCtl and
+   MuteCtl set the host stream gain in the mixer instead of the codec; the
+   gains ramp by AUDIO_MIXER_RAMP_STEP per AUDIO_MIXER_CHUNK samples */
+/* #define AUDIO_MIXER_ENABLED */
+/* #define AUDIO_MIXER_SOURCES        4 */
+/* #define AUDIO_MIXER_CHUNK          32 */
+/* #define AUDIO_MIXER_RAMP_STEP      0x0400 */
+
+/* HID: vendor defined input reports fed from a FIFO of HID_FIFO_DEPTH
+   reports (USBD_HID_SendReport returns USBD_BUSY when it is full), each
+   input report of HID_FIFO_PACKET_SIZE bytes carrying a count byte and as
+   many HID_FIFO_REPORT_SIZE reports as fit. bInterval 1: 1 ms at full
+   speed, 125 us at high speed */
+/* #define HID_REPORT_FIFO_ENABLED */
+/* #define HID_FIFO_REPORT_SIZE       16 */
+/* #define HID_FIFO_DEPTH             64 */
+/* #define HID_FIFO_PACKET_SIZE       64 */
+
+/* DFU: a block is programmed while the next one is received. The erase and
+   write operations run in USBD_DFU_Process, to be called from the main
+   loop. FLASH_IF_VOLTAGE_RANGE (VoltageRange_1..4) sets the programming
+   width of the internal flash: 8 bits at 1.8 V up to 64 bits with VPP */
+/* #define DFU_DOUBLE_BUFFER_ENABLED */
+/* #define FLASH_IF_VOLTAGE_RANGE     VoltageRange_3 */
+
+/* DFU: CMD_CHECKCRC skips the erase and programming of the sectors already
+   holding the image (CRC unit of the flash interface), CMD_COMPRESSION
+   selects LZ4 compressed blocks */
+/* #define DFU_SKIP_UNCHANGED_ENABLED */
+/* #define DFU_COMPRESSION_ENABLED */
+
+/* Copy the device, configuration and standard string descriptors of both
+   speeds at USBD_Init (USBD_DescCacheInit) instead of calling the class and
+   user callbacks on each GET_DESCRIPTOR */
+/* #define USBD_DESC_CACHE_ENABLED */
+/* #define USBD_DESC_CACHE_SIZE       1024 */
+
 /**
   * @}
   */ 
@@ -96,6 +96,10 @@ void USBD_Init(USB_OTG_CORE_HANDLE *pdev,
 
 USBD_Status USBD_DeInit(USB_OTG_CORE_HANDLE *pdev);
 
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+uint32_t USBD_Process(USB_OTG_CORE_HANDLE  *pdev);
+#endif
+
 USBD_Status USBD_ClrCfg(USB_OTG_CORE_HANDLE  *pdev, uint8_t cfgidx);
 
 USBD_Status USBD_SetCfg(USB_OTG_CORE_HANDLE  *pdev, uint8_t cfgidx);
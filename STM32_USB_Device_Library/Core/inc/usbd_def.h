@@ -56,6 +56,7 @@
 #define  USB_LEN_IF_DESC                                0x09
 #define  USB_LEN_EP_DESC                                0x07
 #define  USB_LEN_OTG_DESC                               0x03
+#define  USB_LEN_BOS_DESC                               0x0C
 
 #define  USBD_IDX_LANGID_STR                            0x00 
 #define  USBD_IDX_MFC_STR                               0x01 
@@ -93,6 +94,10 @@
 #define  USB_DESC_TYPE_ENDPOINT                            5
 #define  USB_DESC_TYPE_DEVICE_QUALIFIER                    6
 #define  USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION           7
+#define  USB_DESC_TYPE_BOS                                 0x0F
+#define  USB_DESC_TYPE_DEVICE_CAPABILITY                   0x10
+
+#define  USB_DEVICE_CAPABILITY_USB20_EXT                   0x02
 
 
 #define USB_CONFIG_REMOTE_WAKEUP                           2
@@ -98,6 +98,13 @@ USBD_Status  USBD_CtlContinueRx (USB_OTG_CORE_HANDLE  *pdev,
                               uint8_t *pbuf,                                          
                               uint16_t len);
 
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+USBD_Status  USBD_CtlPrepareRxStream (USB_OTG_CORE_HANDLE  *pdev,
+                                      uint16_t len);
+
+USBD_Status  USBD_CtlContinueRxStream (USB_OTG_CORE_HANDLE  *pdev);
+#endif
+
 USBD_Status  USBD_CtlSendStatus (USB_OTG_CORE_HANDLE  *pdev);
 
 USBD_Status  USBD_CtlReceiveStatus (USB_OTG_CORE_HANDLE  *pdev);
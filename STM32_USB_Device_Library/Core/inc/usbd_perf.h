@@ -0,0 +1,142 @@
+/**
+  ******************************************************************************
+  * @file    usbd_perf.h
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   header file for the usbd_perf.c file
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+
+#ifndef __USBD_PERF_H_
+#define __USBD_PERF_H_
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_def.h"
+#include  "usbd_core.h"
+#include  "usb_stats.h"
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_PERF
+  * @brief header file for the usbd_perf.c file
+  * @{
+  */
+
+/** @defgroup USBD_PERF_Exported_Defines
+  * @{
+  */
+#ifdef USBD_PERF_ENABLED
+
+#ifndef USB_OTG_STATS_ENABLED
+ #error "USBD_PERF_ENABLED needs USB_OTG_STATS_ENABLED"
+#endif
+
+/* Stream directions, as seen from the host */
+#define USBD_PERF_IN                      USB_OTG_XFER_IN
+#define USBD_PERF_OUT                     USB_OTG_XFER_OUT
+
+/* Latency percentiles of USBD_Perf_Result_TypeDef.lat_us */
+#define USBD_PERF_P50                     0
+#define USBD_PERF_P90                     1
+#define USBD_PERF_P99                     2
+#define USBD_PERF_MAX                     3
+
+#endif /* USBD_PERF_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_PERF_Exported_TypesDefinitions
+  * @{
+  */
+#ifdef USBD_PERF_ENABLED
+/* Figures of a run, from USBD_Perf_Start to USBD_Perf_GetResult */
+typedef struct _USBD_Perf_Result
+{
+  uint32_t ms;                  /* duration of the run */
+  uint32_t bytes[2];            /* data of the non control endpoints */
+  uint32_t kbps[2];             /* throughput, in 1000 bytes/s */
+  uint32_t xfers[2];            /* completed transfers */
+  uint32_t lat_us[2][4];        /* transfer latency percentiles, in us */
+  uint32_t cpu_load;            /* in 0.1 %, 0 without USBD_Perf_Calibrate */
+  uint32_t isr_load;            /* time in the OTG interrupt, in 0.1 % */
+  uint32_t isr_max_us;          /* longest OTG interrupt */
+  uint32_t errors;              /* bytes not matching the pattern */
+  uint32_t lost;                /* bytes skipped by an isochronous stream */
+}
+USBD_Perf_Result_TypeDef;
+#endif
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_PERF_Exported_Macros
+  * @{
+  */
+/* Byte k of the test pattern: each little endian word holds the offset of
+   its first byte in the stream, as the MSC bench medium does */
+#define USBD_PERF_PATTERN(k)              ((uint8_t)(((k) & ~3UL) >> (8 * ((k) & 3))))
+/**
+  * @}
+  */
+
+/** @defgroup USBD_PERF_Exported_Variables
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USBD_PERF_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef USBD_PERF_ENABLED
+void     USBD_Perf_Calibrate  (uint32_t ms);
+void     USBD_Perf_Start      (USB_OTG_CORE_HANDLE *pdev);
+void     USBD_Perf_Idle       (void);
+void     USBD_Perf_Fill       (uint8_t *buf, uint32_t len, uint32_t offset);
+uint32_t USBD_Perf_Check      (const uint8_t *buf, uint32_t len, uint32_t offset);
+void     USBD_Perf_Lost       (uint32_t len);
+void     USBD_Perf_GetResult  (USB_OTG_CORE_HANDLE *pdev,
+                               USBD_Perf_Result_TypeDef *res);
+void     USBD_Perf_Report     (USB_OTG_CORE_HANDLE *pdev,
+                               void (*Write)(uint8_t *buf, uint32_t len));
+#endif
+/**
+  * @}
+  */
+
+#endif /* __USBD_PERF_H_ */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
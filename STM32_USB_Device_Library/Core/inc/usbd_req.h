@@ -48,6 +48,12 @@
 /** @defgroup USBD_REQ_Exported_Defines
   * @{
   */ 
+#ifdef USBD_DESC_CACHE_ENABLED
+/* Room for the descriptors copied by USBD_DescCacheInit, for both speeds */
+#ifndef USBD_DESC_CACHE_SIZE
+ #define USBD_DESC_CACHE_SIZE         1024
+#endif
+#endif
 /**
   * @}
   */ 
@@ -90,6 +96,10 @@ void USBD_CtlError( USB_OTG_CORE_HANDLE  *pdev,
                             USB_SETUP_REQ *req);
 
 void USBD_GetString(uint8_t *desc, uint8_t *unicode, uint16_t *len);
+
+#ifdef USBD_DESC_CACHE_ENABLED
+void USBD_DescCacheInit(USB_OTG_CORE_HANDLE  *pdev);
+#endif
 /**
   * @}
   */ 
@@ -0,0 +1,758 @@
+/**
+  ******************************************************************************
+  * @file    usbd_composite.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   This file provides the composite device dispatcher: several
+  *          classes are registered with USBD_Composite_Add and share one
+  *          configuration through the USBD_Composite_cb class callbacks.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                Composite Device Description
+  *          ===================================================================
+  *           - The configuration descriptor is the concatenation of the
+  *             interfaces of the classes, in registration order. The interface
+  *             numbers of each class are shifted after the ones of the
+  *             previous classes, including the CDC union / call management
+  *             and audio control header references, and an interface
+  *             association descriptor groups the classes with several
+  *             interfaces.
+  *           - The classes see their own interface numbers starting from 0 in
+  *             the requests they receive.
+  *           - The endpoints are routed to the class that declares them in its
+  *             descriptor: the endpoint addresses of the classes (CDC_IN_EP,
+  *             MSC_IN_EP...) must differ.
+  *           - SOF and isochronous incomplete events go to every class.
+  *           - USBD_Composite_Alloc carves the packet buffers of the classes
+  *             out of one arena, reset at each SET_CONFIGURATION.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_composite.h"
+#include "usbd_req.h"
+#include "usbd_desc.h"
+
+#ifdef USBD_COMPOSITE_ENABLED
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_COMPOSITE
+  * @brief composite device dispatcher module
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_Defines
+  * @{
+  */
+#define COMPOSITE_NO_CLASS             0xFF
+
+/* Class specific descriptors holding interface numbers */
+#define CS_INTERFACE                   0x24
+#define CDC_CALL_MANAGEMENT            0x01
+#define CDC_UNION                      0x06
+#define AUDIO_AC_HEADER                0x01
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_Variables
+  * @{
+  */
+extern uint8_t USBD_DeviceDesc   [USB_SIZ_DEVICE_DESC];
+
+static USBD_Composite_Class_TypeDef  COMPOSITE_Class[USBD_COMPOSITE_MAX_CLASS];
+static uint8_t  COMPOSITE_ClassNum = 0;
+static uint8_t  COMPOSITE_ItfNum   = 0;
+
+/* Class of the control transfer in progress */
+static uint8_t  COMPOSITE_Ep0Class = COMPOSITE_NO_CLASS;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t COMPOSITE_CfgDesc [USBD_COMPOSITE_CFG_DESC_SIZ] __ALIGN_END ;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint32_t COMPOSITE_Arena [USBD_COMPOSITE_ARENA_SIZE / 4] __ALIGN_END ;
+static uint32_t COMPOSITE_ArenaUsed = 0;
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_FunctionPrototypes
+  * @{
+  */
+static uint8_t  USBD_Composite_Init         (void *pdev, uint8_t cfgidx);
+static uint8_t  USBD_Composite_DeInit       (void *pdev, uint8_t cfgidx);
+static uint8_t  USBD_Composite_Setup        (void *pdev, USB_SETUP_REQ *req);
+static uint8_t  USBD_Composite_EP0_TxSent   (void *pdev);
+static uint8_t  USBD_Composite_EP0_RxReady  (void *pdev);
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+static uint8_t  *USBD_Composite_EP0_RxBuffer (void *pdev, uint16_t offset, uint16_t len);
+#endif
+static uint8_t  USBD_Composite_DataIn       (void *pdev, uint8_t epnum);
+static uint8_t  USBD_Composite_DataOut      (void *pdev, uint8_t epnum);
+static uint8_t  USBD_Composite_SOF          (void *pdev);
+static uint8_t  USBD_Composite_IsoINIncomplete  (void *pdev);
+static uint8_t  USBD_Composite_IsoOUTIncomplete (void *pdev);
+static uint8_t  *USBD_Composite_GetCfgDesc  (uint8_t speed, uint16_t *length);
+#ifdef USB_OTG_HS_CORE
+static uint8_t  *USBD_Composite_GetOtherCfgDesc (uint8_t speed, uint16_t *length);
+#endif
+#ifdef USB_SUPPORT_USER_STRING_DESC
+static uint8_t  *USBD_Composite_GetUsrStrDesc (uint8_t speed, uint8_t index, uint16_t *length);
+#endif
+
+static uint16_t COMPOSITE_Build   (uint8_t speed, uint8_t other);
+static uint8_t  COMPOSITE_ItfClass (uint8_t itf);
+static uint8_t  COMPOSITE_EpClass  (uint8_t ep_addr);
+/**
+  * @}
+  */
+
+/* Composite device class callbacks structure */
+USBD_Class_cb_TypeDef  USBD_Composite_cb =
+{
+  USBD_Composite_Init,
+  USBD_Composite_DeInit,
+  USBD_Composite_Setup,
+  USBD_Composite_EP0_TxSent,
+  USBD_Composite_EP0_RxReady,
+  USBD_Composite_DataIn,
+  USBD_Composite_DataOut,
+  USBD_Composite_SOF,
+  USBD_Composite_IsoINIncomplete,
+  USBD_Composite_IsoOUTIncomplete,
+  USBD_Composite_GetCfgDesc,
+#ifdef USB_OTG_HS_CORE
+  USBD_Composite_GetOtherCfgDesc,
+#endif
+#ifdef USB_SUPPORT_USER_STRING_DESC
+  USBD_Composite_GetUsrStrDesc,
+#endif
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  NULL,
+  NULL,
+#endif
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+  USBD_Composite_EP0_RxBuffer,
+#endif
+};
+
+
+/** @defgroup USBD_COMPOSITE_Private_Functions
+  * @{
+  */
+
+/**
+* @brief  USBD_Composite_Add
+*         Register a class of the composite device, before USBD_Init
+* @param  class_cb: class callbacks
+* @retval status
+*/
+USBD_Status  USBD_Composite_Add (USBD_Class_cb_TypeDef *class_cb)
+{
+  USBD_Composite_Class_TypeDef *c;
+  uint8_t  *desc;
+  uint16_t len;
+  uint16_t idx;
+
+  if (COMPOSITE_ClassNum >= USBD_COMPOSITE_MAX_CLASS)
+  {
+    return USBD_FAIL;
+  }
+
+  c = &COMPOSITE_Class[COMPOSITE_ClassNum];
+  c->cb        = class_cb;
+  c->first_itf = COMPOSITE_ItfNum;
+  c->num_itf   = 0;
+  c->ep_in     = 0;
+  c->ep_out    = 0;
+
+  /* Interfaces and endpoints declared by the class */
+  desc = class_cb->GetConfigDescriptor(USB_OTG_SPEED_FULL, &len);
+  for (idx = desc[0]; (idx + 1) < len; idx += desc[idx])
+  {
+    if (desc[idx] == 0)
+    {
+      break;
+    }
+
+    if ((desc[idx + 1] == USB_DESC_TYPE_INTERFACE) && (desc[idx + 3] == 0))
+    {
+      c->num_itf++;
+    }
+    else if (desc[idx + 1] == USB_DESC_TYPE_ENDPOINT)
+    {
+      if (desc[idx + 2] & 0x80)
+      {
+        c->ep_in  |= 1 << (desc[idx + 2] & 0x0F);
+      }
+      else
+      {
+        c->ep_out |= 1 << (desc[idx + 2] & 0x0F);
+      }
+    }
+  }
+
+  COMPOSITE_ItfNum += c->num_itf;
+  COMPOSITE_ClassNum++;
+
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_Alloc
+*         Get a packet buffer from the arena shared by the classes. The
+*         classes call it from their Init callback: the arena is reset
+*         before each configuration.
+* @param  size: buffer size
+* @retval buffer, 32-bit aligned, or NULL if the arena is exhausted
+*/
+uint8_t *USBD_Composite_Alloc (uint32_t size)
+{
+  uint8_t *buf;
+
+  size = (size + 3) & ~3;
+  if (size > (USBD_COMPOSITE_ARENA_SIZE - COMPOSITE_ArenaUsed))
+  {
+    return NULL;
+  }
+
+  buf = (uint8_t *)COMPOSITE_Arena + COMPOSITE_ArenaUsed;
+  COMPOSITE_ArenaUsed += size;
+  return buf;
+}
+
+/**
+* @brief  USBD_Composite_Init
+*         Initialize the classes of the configuration
+* @param  pdev: device instance
+* @param  cfgidx: Configuration index
+* @retval status
+*/
+static uint8_t  USBD_Composite_Init (void *pdev, uint8_t cfgidx)
+{
+  uint8_t  ret = USBD_OK;
+  uint8_t  i;
+
+  COMPOSITE_ArenaUsed = 0;
+  COMPOSITE_Ep0Class  = COMPOSITE_NO_CLASS;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    if (COMPOSITE_Class[i].cb->Init(pdev, cfgidx) != USBD_OK)
+    {
+      ret = USBD_FAIL;
+    }
+  }
+
+  /* The classes set their own device class: a composite device uses the
+     interface association class codes */
+  USBD_DeviceDesc[4] = DEVICE_CLASS_MISC;
+  USBD_DeviceDesc[5] = DEVICE_SUBCLASS_COMMON;
+  USBD_DeviceDesc[6] = DEVICE_PROTOCOL_IAD;
+
+  return ret;
+}
+
+/**
+* @brief  USBD_Composite_DeInit
+*         DeInitialize the classes of the configuration
+* @param  pdev: device instance
+* @param  cfgidx: Configuration index
+* @retval status
+*/
+static uint8_t  USBD_Composite_DeInit (void *pdev, uint8_t cfgidx)
+{
+  uint8_t  i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    COMPOSITE_Class[i].cb->DeInit(pdev, cfgidx);
+  }
+
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_Setup
+*         Route a request to the class of its interface or endpoint
+* @param  pdev: device instance
+* @param  req: usb request
+* @retval status
+*/
+static uint8_t  USBD_Composite_Setup (void *pdev, USB_SETUP_REQ *req)
+{
+  USB_SETUP_REQ local = *req;
+  uint8_t  idx;
+
+  switch (req->bmRequest & USB_REQ_RECIPIENT_MASK)
+  {
+  case USB_REQ_RECIPIENT_INTERFACE:
+    idx = COMPOSITE_ItfClass(LOBYTE(req->wIndex));
+    if (idx != COMPOSITE_NO_CLASS)
+    {
+      /* The class sees its own interface numbers */
+      local.wIndex = req->wIndex - COMPOSITE_Class[idx].first_itf;
+    }
+    break;
+
+  case USB_REQ_RECIPIENT_ENDPOINT:
+    idx = COMPOSITE_EpClass(LOBYTE(req->wIndex));
+    break;
+
+  default:
+    /* Class and vendor device requests go to the first class */
+    idx = (COMPOSITE_ClassNum != 0) ? 0 : COMPOSITE_NO_CLASS;
+    break;
+  }
+
+  if (idx == COMPOSITE_NO_CLASS)
+  {
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
+  }
+
+  COMPOSITE_Ep0Class = idx;
+  return COMPOSITE_Class[idx].cb->Setup(pdev, &local);
+}
+
+/**
+* @brief  USBD_Composite_EP0_TxSent
+*         Data stage of the control transfer sent
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t  USBD_Composite_EP0_TxSent (void *pdev)
+{
+  if ((COMPOSITE_Ep0Class != COMPOSITE_NO_CLASS) &&
+      (COMPOSITE_Class[COMPOSITE_Ep0Class].cb->EP0_TxSent != NULL))
+  {
+    return COMPOSITE_Class[COMPOSITE_Ep0Class].cb->EP0_TxSent(pdev);
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_EP0_RxReady
+*         Data stage of the control transfer received
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t  USBD_Composite_EP0_RxReady (void *pdev)
+{
+  if ((COMPOSITE_Ep0Class != COMPOSITE_NO_CLASS) &&
+      (COMPOSITE_Class[COMPOSITE_Ep0Class].cb->EP0_RxReady != NULL))
+  {
+    return COMPOSITE_Class[COMPOSITE_Ep0Class].cb->EP0_RxReady(pdev);
+  }
+  return USBD_OK;
+}
+
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+/**
+* @brief  USBD_Composite_EP0_RxBuffer
+*         Destination of the next packet of a streamed data stage
+* @param  pdev: device instance
+* @param  offset: offset in the data stage
+* @param  len: length of the packet
+* @retval buffer, NULL to stall the request
+*/
+static uint8_t  *USBD_Composite_EP0_RxBuffer (void *pdev, uint16_t offset, uint16_t len)
+{
+  if ((COMPOSITE_Ep0Class != COMPOSITE_NO_CLASS) &&
+      (COMPOSITE_Class[COMPOSITE_Ep0Class].cb->EP0_RxBuffer != NULL))
+  {
+    return COMPOSITE_Class[COMPOSITE_Ep0Class].cb->EP0_RxBuffer(pdev, offset, len);
+  }
+  return NULL;
+}
+#endif
+
+/**
+* @brief  USBD_Composite_DataIn
+*         Route the IN completion to the class of the endpoint
+* @param  pdev: device instance
+* @param  epnum: endpoint number
+* @retval status
+*/
+static uint8_t  USBD_Composite_DataIn (void *pdev, uint8_t epnum)
+{
+  uint8_t idx = COMPOSITE_EpClass(epnum | 0x80);
+
+  if ((idx != COMPOSITE_NO_CLASS) && (COMPOSITE_Class[idx].cb->DataIn != NULL))
+  {
+    return COMPOSITE_Class[idx].cb->DataIn(pdev, epnum);
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_DataOut
+*         Route the OUT completion to the class of the endpoint
+* @param  pdev: device instance
+* @param  epnum: endpoint number
+* @retval status
+*/
+static uint8_t  USBD_Composite_DataOut (void *pdev, uint8_t epnum)
+{
+  uint8_t idx = COMPOSITE_EpClass(epnum);
+
+  if ((idx != COMPOSITE_NO_CLASS) && (COMPOSITE_Class[idx].cb->DataOut != NULL))
+  {
+    return COMPOSITE_Class[idx].cb->DataOut(pdev, epnum);
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_SOF
+*         Start Of Frame event for every class
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t  USBD_Composite_SOF (void *pdev)
+{
+  uint8_t i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    if (COMPOSITE_Class[i].cb->SOF != NULL)
+    {
+      COMPOSITE_Class[i].cb->SOF(pdev);
+    }
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_IsoINIncomplete
+*         Incomplete isochronous IN transfer event for every class
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t  USBD_Composite_IsoINIncomplete (void *pdev)
+{
+  uint8_t i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    if (COMPOSITE_Class[i].cb->IsoINIncomplete != NULL)
+    {
+      COMPOSITE_Class[i].cb->IsoINIncomplete(pdev);
+    }
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_IsoOUTIncomplete
+*         Incomplete isochronous OUT transfer event for every class
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t  USBD_Composite_IsoOUTIncomplete (void *pdev)
+{
+  uint8_t i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    if (COMPOSITE_Class[i].cb->IsoOUTIncomplete != NULL)
+    {
+      COMPOSITE_Class[i].cb->IsoOUTIncomplete(pdev);
+    }
+  }
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_Composite_GetCfgDesc
+*         Return the merged configuration descriptor
+* @param  speed : current device speed
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+static uint8_t  *USBD_Composite_GetCfgDesc (uint8_t speed, uint16_t *length)
+{
+  *length = COMPOSITE_Build(speed, 0);
+  return COMPOSITE_CfgDesc;
+}
+
+#ifdef USB_OTG_HS_CORE
+/**
+* @brief  USBD_Composite_GetOtherCfgDesc
+*         Return the merged other speed configuration descriptor
+* @param  speed : current device speed
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+static uint8_t  *USBD_Composite_GetOtherCfgDesc (uint8_t speed, uint16_t *length)
+{
+  *length = COMPOSITE_Build(speed, 1);
+  return COMPOSITE_CfgDesc;
+}
+#endif
+
+#ifdef USB_SUPPORT_USER_STRING_DESC
+/**
+* @brief  USBD_Composite_GetUsrStrDesc
+*         Return the string descriptor of the first class providing it
+* @param  speed : current device speed
+* @param  index: desciptor index
+* @param  length : pointer data length
+* @retval pointer to the descriptor table or NULL if the descriptor is not supported.
+*/
+static uint8_t  *USBD_Composite_GetUsrStrDesc (uint8_t speed, uint8_t index, uint16_t *length)
+{
+  uint8_t *pbuf;
+  uint8_t i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    if (COMPOSITE_Class[i].cb->GetUsrStrDescriptor != NULL)
+    {
+      pbuf = COMPOSITE_Class[i].cb->GetUsrStrDescriptor(speed, index, length);
+      if (pbuf != NULL)
+      {
+        return pbuf;
+      }
+    }
+  }
+  return NULL;
+}
+#endif
+
+/**
+* @brief  COMPOSITE_Build
+*         Merge the configuration descriptors of the classes
+* @param  speed : current device speed
+* @param  other : 1 for the other speed configuration
+* @retval length of the descriptor
+*/
+static uint16_t COMPOSITE_Build (uint8_t speed, uint8_t other)
+{
+  USBD_Composite_Class_TypeDef *c;
+  uint8_t  *desc;
+  uint8_t  *d;
+  uint16_t len;
+  uint16_t total = USB_LEN_CFG_DESC;
+  uint16_t idx;
+  uint16_t k;
+  uint8_t  itf_class = 0;
+  uint8_t  itf_subclass = 0;
+  uint8_t  i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    c = &COMPOSITE_Class[i];
+#ifdef USB_OTG_HS_CORE
+    if (other && (c->cb->GetOtherConfigDescriptor != NULL))
+    {
+      desc = c->cb->GetOtherConfigDescriptor(speed, &len);
+    }
+    else
+#endif
+    {
+      desc = c->cb->GetConfigDescriptor(speed, &len);
+    }
+
+    if (i == 0)
+    {
+      /* Configuration attributes of the first class */
+      for (k = 0; k < USB_LEN_CFG_DESC; k++)
+      {
+        COMPOSITE_CfgDesc[k] = desc[k];
+      }
+    }
+
+    for (idx = desc[0]; (idx + 1) < len; idx += desc[idx])
+    {
+      if ((desc[idx] == 0) || (total + desc[idx] + USB_IAD_DESC_SIZ > USBD_COMPOSITE_CFG_DESC_SIZ))
+      {
+        break;
+      }
+
+      if ((desc[idx + 1] == USB_DESC_TYPE_INTERFACE) &&
+          (desc[idx + 2] == 0) && (desc[idx + 3] == 0) && (c->num_itf > 1))
+      {
+        /* Group the interfaces of the class */
+        d = &COMPOSITE_CfgDesc[total];
+        d[0] = USB_IAD_DESC_SIZ;
+        d[1] = USB_IAD_DESCRIPTOR_TYPE;
+        d[2] = c->first_itf;       /* bFirstInterface */
+        d[3] = c->num_itf;         /* bInterfaceCount */
+        d[4] = desc[idx + 5];      /* bFunctionClass */
+        d[5] = desc[idx + 6];      /* bFunctionSubClass */
+        d[6] = desc[idx + 7];      /* bFunctionProtocol */
+        d[7] = desc[idx + 8];      /* iFunction */
+        total += USB_IAD_DESC_SIZ;
+      }
+
+      d = &COMPOSITE_CfgDesc[total];
+      for (k = 0; k < desc[idx]; k++)
+      {
+        d[k] = desc[idx + k];
+      }
+      total += desc[idx];
+
+      /* Shift the interface numbers */
+      switch (d[1])
+      {
+      case USB_DESC_TYPE_INTERFACE:
+        itf_class    = d[5];
+        itf_subclass = d[6];
+        d[2] += c->first_itf;
+        break;
+
+      case USB_IAD_DESCRIPTOR_TYPE:
+        d[2] += c->first_itf;
+        break;
+
+      case CS_INTERFACE:
+        if ((itf_class == 0x02) && (d[2] == CDC_UNION))
+        {
+          for (k = 3; k < d[0]; k++)
+          {
+            d[k] += c->first_itf;
+          }
+        }
+        else if ((itf_class == 0x02) && (d[2] == CDC_CALL_MANAGEMENT) && (d[0] >= 5))
+        {
+          d[4] += c->first_itf;
+        }
+        else if ((itf_class == 0x01) && (itf_subclass == 0x01) && (d[2] == AUDIO_AC_HEADER))
+        {
+          for (k = 8; k < d[0]; k++)
+          {
+            d[k] += c->first_itf;
+          }
+        }
+        break;
+
+      default:
+        break;
+      }
+    }
+  }
+
+#ifdef USB_OTG_HS_CORE
+  COMPOSITE_CfgDesc[1] = other ? USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION : USB_DESC_TYPE_CONFIGURATION;
+#endif
+  COMPOSITE_CfgDesc[2] = LOBYTE(total);
+  COMPOSITE_CfgDesc[3] = HIBYTE(total);
+  COMPOSITE_CfgDesc[4] = COMPOSITE_ItfNum;
+
+  return total;
+}
+
+/**
+* @brief  COMPOSITE_ItfClass
+*         Find the class of an interface
+* @param  itf: interface number
+* @retval class index
+*/
+static uint8_t COMPOSITE_ItfClass (uint8_t itf)
+{
+  uint8_t i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    if ((itf >= COMPOSITE_Class[i].first_itf) &&
+        (itf < COMPOSITE_Class[i].first_itf + COMPOSITE_Class[i].num_itf))
+    {
+      return i;
+    }
+  }
+  return COMPOSITE_NO_CLASS;
+}
+
+/**
+* @brief  COMPOSITE_EpClass
+*         Find the class of an endpoint
+* @param  ep_addr: endpoint address
+* @retval class index
+*/
+static uint8_t COMPOSITE_EpClass (uint8_t ep_addr)
+{
+  uint16_t mask = 1 << (ep_addr & 0x0F);
+  uint8_t  i;
+
+  for (i = 0; i < COMPOSITE_ClassNum; i++)
+  {
+    if (((ep_addr & 0x80) ? COMPOSITE_Class[i].ep_in : COMPOSITE_Class[i].ep_out) & mask)
+    {
+      return i;
+    }
+  }
+  return COMPOSITE_NO_CLASS;
+}
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+#endif /* USBD_COMPOSITE_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
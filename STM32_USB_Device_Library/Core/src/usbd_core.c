@@ -31,6 +31,7 @@
 #include "usbd_ioreq.h"
 #include "usb_dcd_int.h"
 #include "usb_bsp.h"
+#include "usb_event.h"
 
 /** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
 * @{
@@ -86,10 +87,35 @@ static uint8_t USBD_DevDisconnected(USB_OTG_CORE_HANDLE  *pdev);
 static uint8_t USBD_IsoINIncomplete(USB_OTG_CORE_HANDLE  *pdev);
 static uint8_t USBD_IsoOUTIncomplete(USB_OTG_CORE_HANDLE  *pdev);
 static uint8_t  USBD_RunTestMode (USB_OTG_CORE_HANDLE  *pdev) ;
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+static uint8_t USBD_RoleSuspend(USB_OTG_CORE_HANDLE  *pdev);
+#endif
+#ifdef USBD_DYNAMIC_FIFO_ENABLED
+static void USBD_PlanFifos(USB_OTG_CORE_HANDLE  *pdev);
+#endif
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+static uint8_t USBD_DataOutStage_Evt(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum);
+static uint8_t USBD_DataInStage_Evt(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum);
+static uint8_t USBD_SOF_Evt(USB_OTG_CORE_HANDLE  *pdev);
+static uint8_t USBD_IsoINIncomplete_Evt(USB_OTG_CORE_HANDLE  *pdev);
+static uint8_t USBD_IsoOUTIncomplete_Evt(USB_OTG_CORE_HANDLE  *pdev);
+#ifdef VBUS_SENSING_ENABLED
+static uint8_t USBD_DevConnected_Evt(USB_OTG_CORE_HANDLE  *pdev);
+static uint8_t USBD_DevDisconnected_Evt(USB_OTG_CORE_HANDLE  *pdev);
+#endif
+#endif
 /**
 * @}
 */ 
 
+#ifdef USBD_DYNAMIC_FIFO_ENABLED
+#ifndef USBD_FIFO_BULK_DEPTH
+ #define USBD_FIFO_BULK_DEPTH       4
+#endif
+/* Minimum depth of a Tx FIFO in words */
+#define USBD_FIFO_MIN_DEPTH         16
+#endif
+
 /** @defgroup USBD_CORE_Private_Variables
 * @{
 */ 
@@ -111,9 +137,47 @@ USBD_DCD_INT_cb_TypeDef USBD_DCD_INT_cb =
 USBD_DevConnected, 
 USBD_DevDisconnected,    
 #endif  
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+#ifndef VBUS_SENSING_ENABLED
+  NULL,
+  NULL,
+#endif
+  USBD_RoleSuspend,
+#endif
 };
 
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+/* Interrupt side: the class callbacks are queued for USBD_Process. EP0,
+   reset and power events stay in the interrupt: they drive the core
+   (e.g. EP0 DMA restart after the status stage) */
+USBD_DCD_INT_cb_TypeDef USBD_DCD_INT_evt_cb = 
+{
+  USBD_DataOutStage_Evt,
+  USBD_DataInStage_Evt,
+  USBD_SetupStage,
+  USBD_SOF_Evt,
+  USBD_Reset,
+  USBD_Suspend,
+  USBD_Resume,
+  USBD_IsoINIncomplete_Evt,
+  USBD_IsoOUTIncomplete_Evt,
+#ifdef VBUS_SENSING_ENABLED
+USBD_DevConnected_Evt, 
+USBD_DevDisconnected_Evt,    
+#endif  
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+#ifndef VBUS_SENSING_ENABLED
+  NULL,
+  NULL,
+#endif
+  USBD_RoleSuspend,
+#endif
+};
+
+USBD_DCD_INT_cb_TypeDef  *USBD_DCD_INT_fops = &USBD_DCD_INT_evt_cb;
+#else
 USBD_DCD_INT_cb_TypeDef  *USBD_DCD_INT_fops = &USBD_DCD_INT_cb;
+#endif
 /**
 * @}
 */ 
@@ -147,9 +211,18 @@ void USBD_Init(USB_OTG_CORE_HANDLE *pdev,
   pdev->dev.usr_cb = usr_cb;  
   pdev->dev.usr_device = pDevice;    
   
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+  USB_OTG_EventInit(pdev);
+#endif
+  
   /* set USB OTG core params */
   DCD_Init(pdev , coreID);
   
+#ifdef USBD_DESC_CACHE_ENABLED
+  /* Build the descriptors once the PHY interface is known */
+  USBD_DescCacheInit(pdev);
+#endif
+  
   /* Upon Init call usr callback */
   pdev->dev.usr_cb->Init();
   
@@ -182,6 +255,11 @@ static uint8_t USBD_SetupStage(USB_OTG_CORE_HANDLE *pdev)
   
   USBD_ParseSetupRequest(pdev , &req);
   
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+  /* A new request ends the data stage of the previous one */
+  pdev->dev.ctl_rx_stream = 0;
+#endif
+  
   switch (req.bmRequest & 0x1F) 
   {
   case USB_REQ_RECIPIENT_DEVICE:   
@@ -223,6 +301,13 @@ static uint8_t USBD_DataOutStage(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum)
       {
         ep->rem_data_len -=  ep->maxpacket;
         
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+        if (pdev->dev.ctl_rx_stream)
+        {
+          USBD_CtlContinueRxStream(pdev);
+          return USBD_OK;
+        }
+#endif
         if(pdev->cfg.dma_enable == 1)
         {
           /* in slave mode this, is handled by the RxSTSQLvl ISR */
@@ -234,6 +319,9 @@ static uint8_t USBD_DataOutStage(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum)
       }
       else
       {
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+        pdev->dev.ctl_rx_stream = 0;
+#endif
         if((pdev->dev.class_cb->EP0_RxReady != NULL)&&
            (pdev->dev.device_status == USB_OTG_CONFIGURED))
         {
@@ -261,19 +349,27 @@ static uint8_t USBD_DataOutStage(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum)
 static uint8_t USBD_DataInStage(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum)
 {
   USB_OTG_EP *ep;
+  uint32_t   sent;
   
   if(epnum == 0) 
   {
     ep = &pdev->dev.in_ep[0];
     if ( pdev->dev.device_state == USB_OTG_EP0_DATA_IN)
     {
-      if(ep->rem_data_len > ep->maxpacket)
+#ifdef USB_OTG_EP0_MULTI_PACKET_ENABLED
+      /* Bytes of the transfer just completed: up to 3 packets, 0 for the
+         ZLP ending the data stage */
+      sent = ep->xfer_len;
+#else
+      sent = ep->maxpacket;
+#endif
+      if((sent > 0) && (ep->rem_data_len > sent))
       {
-        ep->rem_data_len -=  ep->maxpacket;
+        ep->rem_data_len -=  sent;
         if(pdev->cfg.dma_enable == 1)
         {
           /* in slave mode this, is handled by the TxFifoEmpty ISR */
-          ep->xfer_buff += ep->maxpacket;
+          ep->xfer_buff += sent;
         }
         USBD_CtlContinueSendData (pdev, 
                                   ep->xfer_buff, 
@@ -368,8 +464,11 @@ static uint8_t USBD_Resume(USB_OTG_CORE_HANDLE  *pdev)
 {
   /* Upon Resume call usr call back */
   pdev->dev.usr_cb->DeviceResumed(); 
-  pdev->dev.device_status = pdev->dev.device_old_status;  
-  pdev->dev.device_status = USB_OTG_CONFIGURED;  
+  /* Back to the state before suspend (possibly not yet configured) */
+  if (pdev->dev.device_status == USB_OTG_SUSPENDED)
+  {
+    pdev->dev.device_status = pdev->dev.device_old_status;  
+  }
   return USBD_OK;
 }
 
@@ -416,13 +515,159 @@ static uint8_t USBD_SOF(USB_OTG_CORE_HANDLE  *pdev)
 
 USBD_Status USBD_SetCfg(USB_OTG_CORE_HANDLE  *pdev, uint8_t cfgidx)
 {
-  pdev->dev.class_cb->Init(pdev, cfgidx); 
+#ifdef USBD_DYNAMIC_FIFO_ENABLED
+  /* The endpoints are not opened yet: the FIFOs can be moved */
+  USBD_PlanFifos(pdev);
+#endif
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  if (pdev->dev.role_suspended)
+  {
+    /* Back from the host role: the class restarts on its kept state */
+    pdev->dev.role_suspended = 0;
+    pdev->dev.class_cb->Resume(pdev, cfgidx);
+  }
+  else
+#endif
+  {
+    pdev->dev.class_cb->Init(pdev, cfgidx); 
+  }
   
   /* Upon set config call usr call back */
   pdev->dev.usr_cb->DeviceConfigured();
   return USBD_OK; 
 }
 
+#ifdef USBD_DYNAMIC_FIFO_ENABLED
+/**
+* @brief  USBD_PlanFifos 
+*         Size the Rx FIFO and the Tx FIFOs from the endpoints of the current
+*         configuration descriptor: each IN endpoint gets one max packet (at
+*         least 16 words), the bulk IN endpoints then share the free space up
+*         to USBD_FIFO_BULK_DEPTH packets and what is left goes to the Rx FIFO.
+*         The compile time layout is kept when the plan does not fit.
+* @param  pdev: device instance
+* @retval None
+*/
+static void USBD_PlanFifos(USB_OTG_CORE_HANDLE  *pdev)
+{
+  uint16_t tx_size[USB_OTG_MAX_TX_FIFOS];
+  uint16_t tx_mps[USB_OTG_MAX_TX_FIFOS];
+  uint8_t  tx_bulk[USB_OTG_MAX_TX_FIFOS];
+  uint16_t len, idx, mps, max_out = USBD_EP0_MAX_PACKET_SIZE;
+  uint16_t used, free_space, rx_size;
+  uint8_t  *pdesc, ep, last = 0, num_out = 1, grown;
+  
+  for (ep = 0; ep < USB_OTG_MAX_TX_FIFOS; ep++)
+  {
+    tx_size[ep] = 0;
+    tx_mps[ep] = 0;
+    tx_bulk[ep] = 0;
+  }
+  
+  pdesc = pdev->dev.class_cb->GetConfigDescriptor(pdev->cfg.speed, &len);
+  
+  /* Walk the descriptors: an endpoint may appear in several alternate
+     settings, keep its largest packet */
+  for (idx = 0; (idx + 1) < len; idx += pdesc[idx])
+  {
+    if (pdesc[idx] == 0)
+    {
+      return; /* malformed descriptor */
+    }
+    if ((pdesc[idx + 1] != USB_DESC_TYPE_ENDPOINT) || ((idx + 7) > len))
+    {
+      continue;
+    }
+    ep  = pdesc[idx + 2] & 0x7F;
+    mps = pdesc[idx + 4] | (pdesc[idx + 5] << 8);
+    if ((pdesc[idx + 3] & 0x01) != 0)
+    {
+      /* iso/int high bandwidth: up to 3 transactions per microframe */
+      mps = (mps & 0x7FF) * (((mps >> 11) & 0x3) + 1);
+    }
+    else
+    {
+      mps &= 0x7FF;
+    }
+    
+    if (ep >= pdev->cfg.dev_endpoints)
+    {
+      return; /* the core has not that many endpoints */
+    }
+    if ((pdesc[idx + 2] & 0x80) != 0)
+    {
+      if (mps > tx_mps[ep])
+      {
+        tx_mps[ep] = mps;
+      }
+      tx_bulk[ep] = ((pdesc[idx + 3] & 0x03) == USB_OTG_EP_BULK);
+      if (ep > last)
+      {
+        last = ep;
+      }
+    }
+    else
+    {
+      num_out++;
+      if (mps > max_out)
+      {
+        max_out = mps;
+      }
+    }
+  }
+  
+  /* Rx: setup packets, one max OUT packet (+ status word) twice, and one
+     transfer complete word per OUT endpoint */
+  rx_size = 10 + 1 + (2 * ((max_out / 4) + 1)) + num_out;
+  tx_size[0] = USBD_FIFO_MIN_DEPTH;
+  if ((USBD_EP0_MAX_PACKET_SIZE / 4) > tx_size[0])
+  {
+    tx_size[0] = USBD_EP0_MAX_PACKET_SIZE / 4;
+  }
+  used = rx_size + tx_size[0];
+  
+  /* The unused FIFOs below the last IN endpoint still need a minimum depth */
+  for (ep = 1; ep <= last; ep++)
+  {
+    tx_size[ep] = (tx_mps[ep] + 3) / 4;
+    if (tx_size[ep] < USBD_FIFO_MIN_DEPTH)
+    {
+      tx_size[ep] = USBD_FIFO_MIN_DEPTH;
+    }
+    used += tx_size[ep];
+  }
+  
+  if (used > pdev->cfg.TotalFifoSize)
+  {
+    return;
+  }
+  free_space = pdev->cfg.TotalFifoSize - used;
+  
+  /* Deeper bulk IN FIFOs, one packet at a time for each endpoint in turn */
+  do
+  {
+    grown = 0;
+    for (ep = 1; ep <= last; ep++)
+    {
+      mps = (tx_mps[ep] + 3) / 4;
+      if ((tx_bulk[ep] != 0) && (mps != 0) &&
+          ((tx_size[ep] + mps) <= (mps * USBD_FIFO_BULK_DEPTH)) &&
+          (mps <= free_space))
+      {
+        tx_size[ep] += mps;
+        free_space -= mps;
+        grown = 1;
+      }
+    }
+  }
+  while (grown != 0);
+  
+  rx_size += free_space;
+  
+  USB_OTG_SetFifoPlan(pdev, rx_size, tx_size);
+}
+#endif /* USBD_DYNAMIC_FIFO_ENABLED */
+
 /**
 * @brief  USBD_ClrCfg 
 *         Clear current configuration
@@ -433,9 +678,47 @@ USBD_Status USBD_SetCfg(USB_OTG_CORE_HANDLE  *pdev, uint8_t cfgidx)
 USBD_Status USBD_ClrCfg(USB_OTG_CORE_HANDLE  *pdev, uint8_t cfgidx)
 {
   pdev->dev.class_cb->DeInit(pdev, cfgidx);   
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  pdev->dev.role_suspended = 0;
+#endif
   return USBD_OK;
 }
 
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+/**
+* @brief  USBD_RoleSuspend 
+*         Park the class when the core switches to the host role: a class
+*         with Suspend/Resume callbacks keeps its state until the next
+*         SET_CONFIGURATION, the others are de-initialized
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t USBD_RoleSuspend(USB_OTG_CORE_HANDLE  *pdev)
+{
+  uint8_t status = pdev->dev.device_status;
+  
+  if (status == USB_OTG_SUSPENDED)
+  {
+    status = pdev->dev.device_old_status;
+  }
+  if ((status == USB_OTG_CONFIGURED) && (pdev->dev.role_suspended == 0))
+  {
+    if ((pdev->dev.class_cb->Suspend != NULL) &&
+        (pdev->dev.class_cb->Resume != NULL))
+    {
+      pdev->dev.class_cb->Suspend(pdev, pdev->dev.device_config);
+      pdev->dev.role_suspended = 1;
+    }
+    else
+    {
+      pdev->dev.class_cb->DeInit(pdev, pdev->dev.device_config);
+    }
+  }
+  pdev->dev.device_status = USB_OTG_DEFAULT;
+  return USBD_OK;
+}
+#endif
+
 /**
 * @brief  USBD_IsoINIncomplete 
 *         Handle iso in incomplete event
@@ -483,11 +766,162 @@ static uint8_t USBD_DevConnected(USB_OTG_CORE_HANDLE  *pdev)
 static uint8_t USBD_DevDisconnected(USB_OTG_CORE_HANDLE  *pdev)
 {
   pdev->dev.usr_cb->DeviceDisconnected();
-  pdev->dev.class_cb->DeInit(pdev, 0);
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  /* A parked class stays parked */
+  if (pdev->dev.role_suspended == 0)
+#endif
+  {
+    pdev->dev.class_cb->DeInit(pdev, 0);
+  }
   pdev->dev.connection_status = 0;    
   return USBD_OK;
 }
 #endif
+
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+/**
+* @brief  USBD_Process 
+*         Dispatch the queued interrupt events to the class; to be called
+*         from the application thread (e.g. when USB_OTG_EVENT_NOTIFY fires)
+* @param  pdev: device instance
+* @retval number of events dispatched
+*/
+uint32_t USBD_Process(USB_OTG_CORE_HANDLE  *pdev)
+{
+  USB_OTG_EVENT evt;
+  uint32_t count = 0;
+  
+  while (USB_OTG_EventPop(pdev, &evt))
+  {
+    count++;
+    switch (evt.type)
+    {
+    case USB_OTG_EVT_DATA_OUT:
+      USBD_DataOutStage(pdev, evt.num);
+      break;
+    case USB_OTG_EVT_DATA_IN:
+      USBD_DataInStage(pdev, evt.num);
+      break;
+    case USB_OTG_EVT_SOF:
+      USBD_SOF(pdev);
+      break;
+    case USB_OTG_EVT_ISO_IN_INCOMPLETE:
+      USBD_IsoINIncomplete(pdev);
+      break;
+    case USB_OTG_EVT_ISO_OUT_INCOMPLETE:
+      USBD_IsoOUTIncomplete(pdev);
+      break;
+#ifdef VBUS_SENSING_ENABLED
+    case USB_OTG_EVT_CONNECT:
+      USBD_DevConnected(pdev);
+      break;
+    case USB_OTG_EVT_DISCONNECT:
+      USBD_DevDisconnected(pdev);
+      break;
+#endif
+    default:
+      break;
+    }
+  }
+  return count;
+}
+
+/**
+* @brief  USBD_DataOutStage_Evt 
+*         Queue the data out stage of a non control endpoint
+* @param  pdev: device instance
+* @param  epnum: endpoint index
+* @retval status
+*/
+static uint8_t USBD_DataOutStage_Evt(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum)
+{
+  if (epnum == 0)
+  {
+    return USBD_DataOutStage(pdev, epnum);
+  }
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_DATA_OUT, epnum, 0);
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_DataInStage_Evt 
+*         Queue the data in stage of a non control endpoint
+* @param  pdev: device instance
+* @param  epnum: endpoint index
+* @retval status
+*/
+static uint8_t USBD_DataInStage_Evt(USB_OTG_CORE_HANDLE *pdev , uint8_t epnum)
+{
+  if (epnum == 0)
+  {
+    return USBD_DataInStage(pdev, epnum);
+  }
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_DATA_IN, epnum, 0);
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_SOF_Evt 
+*         Queue the SOF event
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t USBD_SOF_Evt(USB_OTG_CORE_HANDLE  *pdev)
+{
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_SOF, 0, 0);
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_IsoINIncomplete_Evt 
+*         Queue the iso in incomplete event
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t USBD_IsoINIncomplete_Evt(USB_OTG_CORE_HANDLE  *pdev)
+{
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_ISO_IN_INCOMPLETE, 0, 0);
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_IsoOUTIncomplete_Evt 
+*         Queue the iso out incomplete event
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t USBD_IsoOUTIncomplete_Evt(USB_OTG_CORE_HANDLE  *pdev)
+{
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_ISO_OUT_INCOMPLETE, 0, 0);
+  return USBD_OK;
+}
+
+#ifdef VBUS_SENSING_ENABLED
+/**
+* @brief  USBD_DevConnected_Evt 
+*         Queue the device connection event
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t USBD_DevConnected_Evt(USB_OTG_CORE_HANDLE  *pdev)
+{
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_CONNECT, 0, 0);
+  return USBD_OK;
+}
+
+/**
+* @brief  USBD_DevDisconnected_Evt 
+*         Queue the device disconnection event
+* @param  pdev: device instance
+* @retval status
+*/
+static uint8_t USBD_DevDisconnected_Evt(USB_OTG_CORE_HANDLE  *pdev)
+{
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_DISCONNECT, 0, 0);
+  return USBD_OK;
+}
+#endif
+#endif /* USB_OTG_EVENT_QUEUE_ENABLED */
 /**
 * @}
 */ 
@@ -174,6 +174,66 @@ USBD_Status  USBD_CtlContinueRx (USB_OTG_CORE_HANDLE  *pdev,
                     len);
   return ret;
 }
+
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+/**
+* @brief  USBD_CtlPrepareRxStream
+*         receive data on the ctl pipe, each packet where the EP0_RxBuffer
+*         callback of the class says: no buffer of the whole data stage and
+*         no copy
+* @param  pdev: USB OTG device instance
+* @param  len: length of data to be received
+* @retval status
+*/
+USBD_Status  USBD_CtlPrepareRxStream (USB_OTG_CORE_HANDLE  *pdev,
+                                      uint16_t len)
+{
+  pdev->dev.out_ep[0].total_data_len = len;
+  pdev->dev.out_ep[0].rem_data_len   = len;
+  pdev->dev.device_state = USB_OTG_EP0_DATA_OUT;
+  pdev->dev.ctl_rx_stream = 1;
+  
+  return USBD_CtlContinueRxStream(pdev);
+}
+
+/**
+* @brief  USBD_CtlContinueRxStream
+*         receive the next packet of a USBD_CtlPrepareRxStream data stage
+* @param  pdev: USB OTG device instance
+* @retval status
+*/
+USBD_Status  USBD_CtlContinueRxStream (USB_OTG_CORE_HANDLE  *pdev)
+{
+  USB_OTG_EP *ep = &pdev->dev.out_ep[0];
+  uint8_t    *pbuf = NULL;
+  uint16_t   len;
+  
+  len = MIN(ep->rem_data_len, ep->maxpacket);
+  
+  if (pdev->dev.class_cb->EP0_RxBuffer != NULL)
+  {
+    pbuf = pdev->dev.class_cb->EP0_RxBuffer(pdev,
+                                            ep->total_data_len - ep->rem_data_len,
+                                            len);
+  }
+  
+  if (pbuf == NULL)
+  {
+    pdev->dev.ctl_rx_stream = 0;
+    DCD_EP_Stall(pdev , 0x80);
+    DCD_EP_Stall(pdev , 0);
+    USB_OTG_EP0_OutStart(pdev);
+    return USBD_FAIL;
+  }
+  
+  DCD_EP_PrepareRx (pdev,
+                    0,
+                    pbuf,
+                    len);
+  return USBD_OK;
+}
+#endif
+
 /**
 * @brief  USBD_CtlSendStatus
 *         send zero lzngth packet on the ctl pipe
@@ -0,0 +1,483 @@
+/**
+  ******************************************************************************
+  * @file    usbd_perf.c
+  * @author  MCD Application Team
+  * @version V1.1.0
+  * @date    19-March-2012
+  * @brief   This file provides the end to end throughput test of the device
+  *          classes: test pattern, idle loop counter and report of a run.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                Throughput Test Description
+  *          ===================================================================
+  *           - The host streams the test pattern (USBD_PERF_PATTERN: each
+  *             little endian word holds the offset of its first byte) to the
+  *             OUT endpoints and reads it from the IN endpoints. The class
+  *             interfaces use USBD_Perf_Fill and USBD_Perf_Check:
+  *               CDC   : usbd_cdc_if_perf.c (PERF_fops and CDC_Perf_Pump)
+  *               MSC   : usbd_storage_bench.c (the medium holds the pattern,
+  *                       the written blocks are checked)
+  *               HID   : usbd_hid_perf.c (HID_Perf_Pump, report FIFO)
+  *               Audio : usbd_audio_out_perf.c (AUDIO_OUT_fops sink, linked
+  *                       instead of usbd_audio_out_if.c)
+  *           - Byte and transfer counts and the transfer latencies come from
+  *             the OTG statistics (USB_OTG_STATS_ENABLED): the latency of a
+  *             transfer runs from USB_OTG_EPStartXfer to its transfer complete
+  *             interrupt.
+  *           - The CPU load is derived from the idle loop: the main loop calls
+  *             USBD_Perf_Idle when it has nothing to do, and the rate of the
+  *             calls is compared with the rate measured by USBD_Perf_Calibrate
+  *             without USB traffic. The main loop work of the test (e.g. the
+  *             pattern generation) counts as load.
+  *           - USBD_Perf_Report prints one line per direction, e.g.
+  *               PERF ms=10000 cpu=412 isr=287 isr_max_us=9 errors=0 lost=0
+  *               IN bytes=... kBps=38912 xfers=... p50=... p90=... p99=... max=...
+  *               OUT bytes=... kBps=... xfers=... p50=... p90=... p99=... max=...
+  *             loads in 0.1 %, latencies in us, for the host tool to compare
+  *             with a baseline. A run must not exceed 2^32 CPU cycles between
+  *             two USBD_Perf_Idle calls.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_perf.h"
+
+#ifdef USBD_PERF_ENABLED
+
+/** @addtogroup STM32_USB_OTG_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_PERF
+  * @brief throughput test module
+  * @{
+  */
+
+/** @defgroup USBD_PERF_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_PERF_Private_Defines
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_PERF_Private_Macros
+  * @{
+  */
+#define PERF_CYC_PER_MS()              (SystemCoreClock / 1000)
+#define PERF_CYC_PER_US()              (SystemCoreClock / 1000000)
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_PERF_Private_Variables
+  * @{
+  */
+static const uint8_t Perf_Percent[3] = {50, 90, 99};
+
+/* Time base, extended beyond the 32-bit cycle counter */
+static uint32_t Perf_last;
+static uint64_t Perf_cycles;
+
+/* Idle loop counts of the run and of the calibration */
+static uint32_t Perf_idle;
+static uint32_t Perf_calIdle;
+static uint64_t Perf_calCycles;
+
+static uint32_t Perf_errors;
+static uint32_t Perf_lost;
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_PERF_Private_FunctionPrototypes
+  * @{
+  */
+static void     Perf_Tick       (void);
+static uint32_t Perf_Percentile (USB_OTG_XFER_STATS *xs, uint8_t percent);
+static void     Perf_PutNumber  (void (*Write)(uint8_t *buf, uint32_t len),
+                                 const char *label,
+                                 uint32_t value);
+static void     Perf_PutString  (void (*Write)(uint8_t *buf, uint32_t len),
+                                 const char *str);
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_PERF_Private_Functions
+  * @{
+  */
+
+/**
+* @brief  USBD_Perf_Calibrate
+*         Measure the idle loop rate of an idle CPU, to be called before
+*         USBD_Init or with the device disconnected
+* @param  ms: duration of the measure (below 2^32 CPU cycles)
+* @retval None
+*/
+void USBD_Perf_Calibrate(uint32_t ms)
+{
+  uint64_t cycles = (uint64_t)PERF_CYC_PER_MS() * ms;
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  USB_OTG_DWT_CTRL |= USB_OTG_DWT_CTRL_CYCCNTENA;
+
+  Perf_idle = 0;
+  Perf_cycles = 0;
+  Perf_last = USB_OTG_DWT_CYCCNT;
+  while (Perf_cycles < cycles)
+  {
+    USBD_Perf_Idle();
+  }
+  Perf_calIdle = Perf_idle;
+  Perf_calCycles = Perf_cycles;
+}
+
+/**
+* @brief  USBD_Perf_Start
+*         Start a run: clear the OTG statistics and the counters of the test
+* @param  pdev: device instance
+* @retval None
+*/
+void USBD_Perf_Start(USB_OTG_CORE_HANDLE *pdev)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  USB_OTG_Stats_Init(pdev);
+
+  __disable_irq();
+  Perf_idle = 0;
+  Perf_cycles = 0;
+  Perf_errors = 0;
+  Perf_lost = 0;
+  Perf_last = USB_OTG_DWT_CYCCNT;
+  __set_PRIMASK(primask);
+}
+
+/**
+* @brief  USBD_Perf_Idle
+*         Count one pass of the idle loop, called by the main loop when it
+*         has nothing else to do
+* @param  None
+* @retval None
+*/
+void USBD_Perf_Idle(void)
+{
+  Perf_Tick();
+  Perf_idle++;
+}
+
+/**
+* @brief  USBD_Perf_Fill
+*         Write the test pattern of a stream
+* @param  buf: destination
+* @param  len: number of bytes
+* @param  offset: offset of buf[0] in the stream
+* @retval None
+*/
+void USBD_Perf_Fill(uint8_t *buf, uint32_t len, uint32_t offset)
+{
+  uint32_t i = 0;
+
+  /* Bytes up to a word boundary of the stream, then whole words when the
+     buffer is aligned too */
+  while ((i < len) && (((offset + i) & 3) != 0))
+  {
+    buf[i] = USBD_PERF_PATTERN(offset + i);
+    i++;
+  }
+  if ((((uint32_t)buf + i) & 3) == 0)
+  {
+    for (; (i + 4) <= len; i += 4)
+    {
+      *(uint32_t *)(buf + i) = offset + i;
+    }
+  }
+  for (; i < len; i++)
+  {
+    buf[i] = USBD_PERF_PATTERN(offset + i);
+  }
+}
+
+/**
+* @brief  USBD_Perf_Check
+*         Compare received data with the test pattern; the mismatches are
+*         added to the errors of the run
+* @param  buf: received data
+* @param  len: number of bytes
+* @param  offset: offset of buf[0] in the stream
+* @retval number of bytes not matching the pattern
+*/
+uint32_t USBD_Perf_Check(const uint8_t *buf, uint32_t len, uint32_t offset)
+{
+  uint32_t err = 0;
+  uint32_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    if (buf[i] != USBD_PERF_PATTERN(offset + i))
+    {
+      err++;
+    }
+  }
+  Perf_errors += err;
+  return err;
+}
+
+/**
+* @brief  USBD_Perf_Lost
+*         Account the data skipped by a stream without retry (isochronous)
+* @param  len: number of bytes
+* @retval None
+*/
+void USBD_Perf_Lost(uint32_t len)
+{
+  Perf_lost += len;
+}
+
+/**
+* @brief  USBD_Perf_GetResult
+*         Compute the figures of the run so far
+* @param  pdev: device instance
+* @param  res: destination
+* @retval None
+*/
+void USBD_Perf_GetResult(USB_OTG_CORE_HANDLE *pdev,
+                         USBD_Perf_Result_TypeDef *res)
+{
+  USB_OTG_EP_STATS   eps;
+  USB_OTG_XFER_STATS xs;
+  USB_OTG_ISR_STATS  isr;
+  uint64_t cycles;
+  uint64_t idle;
+  uint8_t  dir, ep, p;
+
+  Perf_Tick();
+  cycles = Perf_cycles;
+  if (cycles == 0)
+  {
+    cycles = 1;
+  }
+  res->ms = (uint32_t)(cycles / PERF_CYC_PER_MS());
+
+  for (dir = 0; dir < 2; dir++)
+  {
+    res->bytes[dir] = 0;
+    for (ep = 1; ep < pdev->cfg.dev_endpoints; ep++)
+    {
+      if (USB_OTG_Stats_GetEP(pdev,
+                              (dir == USBD_PERF_IN) ? (ep | 0x80) : ep,
+                              &eps) == USB_OTG_OK)
+      {
+        res->bytes[dir] += eps.bytes;
+      }
+    }
+    res->kbps[dir] = (uint32_t)(((uint64_t)res->bytes[dir] * SystemCoreClock) /
+                                (cycles * 1000));
+
+    USB_OTG_Stats_GetXfer(pdev, dir, &xs);
+    res->xfers[dir] = xs.count;
+    for (p = 0; p < 3; p++)
+    {
+      res->lat_us[dir][p] = Perf_Percentile(&xs, Perf_Percent[p]) / PERF_CYC_PER_US();
+    }
+    res->lat_us[dir][USBD_PERF_MAX] = xs.cyc_max / PERF_CYC_PER_US();
+  }
+
+  /* Free CPU share: idle rate of the run over the idle rate of the
+     calibration */
+  res->cpu_load = 0;
+  if ((Perf_calIdle != 0) && (Perf_calCycles != 0))
+  {
+    idle = ((uint64_t)Perf_idle * Perf_calCycles * 1000) / (cycles * Perf_calIdle);
+    res->cpu_load = (idle >= 1000) ? 0 : (uint32_t)(1000 - idle);
+  }
+
+  USB_OTG_Stats_GetISR(pdev, &isr);
+  res->isr_load = (uint32_t)(((uint64_t)isr.cyc_sum * 1000) / cycles);
+  res->isr_max_us = isr.cyc_max / PERF_CYC_PER_US();
+
+  res->errors = Perf_errors;
+  res->lost = Perf_lost;
+}
+
+/**
+* @brief  USBD_Perf_Report
+*         Print the figures of the run as text lines, e.g. through the CDC
+*         class or ITM/SWO
+* @param  pdev: device instance
+* @param  Write: output function
+* @retval None
+*/
+void USBD_Perf_Report(USB_OTG_CORE_HANDLE *pdev,
+                      void (*Write)(uint8_t *buf, uint32_t len))
+{
+  static const char * const name[2] = {"IN", "OUT"};
+  USBD_Perf_Result_TypeDef res;
+  uint8_t dir;
+
+  USBD_Perf_GetResult(pdev, &res);
+
+  Perf_PutNumber(Write, "PERF ms=", res.ms);
+  Perf_PutNumber(Write, " cpu=", res.cpu_load);
+  Perf_PutNumber(Write, " isr=", res.isr_load);
+  Perf_PutNumber(Write, " isr_max_us=", res.isr_max_us);
+  Perf_PutNumber(Write, " errors=", res.errors);
+  Perf_PutNumber(Write, " lost=", res.lost);
+  Perf_PutString(Write, "\r\n");
+
+  for (dir = 0; dir < 2; dir++)
+  {
+    Perf_PutString(Write, name[dir]);
+    Perf_PutNumber(Write, " bytes=", res.bytes[dir]);
+    Perf_PutNumber(Write, " kBps=", res.kbps[dir]);
+    Perf_PutNumber(Write, " xfers=", res.xfers[dir]);
+    Perf_PutNumber(Write, " p50=", res.lat_us[dir][USBD_PERF_P50]);
+    Perf_PutNumber(Write, " p90=", res.lat_us[dir][USBD_PERF_P90]);
+    Perf_PutNumber(Write, " p99=", res.lat_us[dir][USBD_PERF_P99]);
+    Perf_PutNumber(Write, " max=", res.lat_us[dir][USBD_PERF_MAX]);
+    Perf_PutString(Write, "\r\n");
+  }
+}
+
+/**
+* @brief  Perf_Tick
+*         Extend the cycle counter into the 64-bit time base of the run
+* @param  None
+* @retval None
+*/
+static void Perf_Tick(void)
+{
+  uint32_t now = USB_OTG_DWT_CYCCNT;
+
+  Perf_cycles += now - Perf_last;
+  Perf_last = now;
+}
+
+/**
+* @brief  Perf_Percentile
+*         Latency under which a share of the transfers completed
+* @param  xs: transfer latency histogram
+* @param  percent: share of the transfers
+* @retval lower bound of the histogram bin, in CPU cycles
+*/
+static uint32_t Perf_Percentile(USB_OTG_XFER_STATS *xs, uint8_t percent)
+{
+  uint32_t target = (uint32_t)(((uint64_t)xs->count * percent + 99) / 100);
+  uint32_t sum = 0;
+  uint32_t bin;
+
+  if (xs->count == 0)
+  {
+    return 0;
+  }
+  for (bin = 0; bin < USB_OTG_XFER_HIST_BINS; bin++)
+  {
+    sum += xs->hist[bin];
+    if (sum >= target)
+    {
+      break;
+    }
+  }
+  if (bin >= USB_OTG_XFER_HIST_BINS)
+  {
+    bin = USB_OTG_XFER_HIST_BINS - 1;
+  }
+  return USB_OTG_Stats_XferBinLow(bin);
+}
+
+/**
+* @brief  Perf_PutNumber
+*         Print a label and a decimal number
+* @param  Write: output function
+* @param  label: text printed first
+* @param  value: number
+* @retval None
+*/
+static void Perf_PutNumber(void (*Write)(uint8_t *buf, uint32_t len),
+                           const char *label,
+                           uint32_t value)
+{
+  uint8_t buf[10];
+  uint8_t i = sizeof(buf);
+
+  Perf_PutString(Write, label);
+  do
+  {
+    buf[--i] = '0' + (value % 10);
+    value /= 10;
+  }
+  while (value != 0);
+  Write(&buf[i], sizeof(buf) - i);
+}
+
+/**
+* @brief  Perf_PutString
+*         Print a string
+* @param  Write: output function
+* @param  str: string
+* @retval None
+*/
+static void Perf_PutString(void (*Write)(uint8_t *buf, uint32_t len),
+                           const char *str)
+{
+  uint32_t len = 0;
+
+  while (str[len] != 0)
+  {
+    len++;
+  }
+  Write((uint8_t *)str, len);
+}
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+#endif /* USBD_PERF_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -44,6 +44,19 @@
 /** @defgroup USBD_REQ_Private_TypesDefinitions
   * @{
   */ 
+/* Handler of a standard device request */
+typedef void (*USBD_StdReq_TypeDef) (USB_OTG_CORE_HANDLE  *pdev, 
+                                     USB_SETUP_REQ *req);
+
+#ifdef USBD_DESC_CACHE_ENABLED
+/* Descriptor copied in USBD_DescCache, not cached if len is 0 */
+typedef struct _USBD_DescCache_Entry
+{
+  uint16_t  ofs;
+  uint16_t  len;
+}
+USBD_DescCache_Entry_TypeDef;
+#endif
 /**
   * @}
   */ 
@@ -52,7 +65,15 @@
 /** @defgroup USBD_REQ_Private_Defines
   * @{
   */ 
-
+#ifdef USBD_DESC_CACHE_ENABLED
+/* Cached descriptors: device, configuration and the standard strings
+   (USBD_IDX_LANGID_STR to USBD_IDX_INTERFACE_STR), for each speed */
+ #define USBD_CACHE_DEVICE            0
+ #define USBD_CACHE_CONFIG            1
+ #define USBD_CACHE_STRING            2
+ #define USBD_CACHE_NUM               (USBD_CACHE_STRING + USBD_IDX_INTERFACE_STR + 1)
+ #define USBD_CACHE_SPEEDS            2   /* USB_OTG_SPEED_HIGH, USB_OTG_SPEED_FULL */
+#endif
 /**
   * @}
   */ 
@@ -98,6 +119,42 @@ __ALIGN_BEGIN uint32_t  USBD_cfg_status __ALIGN_END  = 0;
   #endif
 #endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
 __ALIGN_BEGIN uint8_t USBD_StrDesc[USB_MAX_STR_DESC_SIZ] __ALIGN_END ;
+
+#ifdef USB_OTG_LPM_ENABLED
+/* BOS with a USB 2.0 extension capability declaring LPM; the host asks for
+   it when the device descriptor has bcdUSB 0x0201 */
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t USBD_BOSDesc[USB_LEN_BOS_DESC] __ALIGN_END =
+{
+  0x05,                       /* bLength */
+  USB_DESC_TYPE_BOS,          /* bDescriptorType */
+  USB_LEN_BOS_DESC,           /* wTotalLength */
+  0x00,
+  0x01,                       /* bNumDeviceCaps */
+  
+  0x07,                       /* bLength */
+  USB_DESC_TYPE_DEVICE_CAPABILITY,  /* bDescriptorType */
+  USB_DEVICE_CAPABILITY_USB20_EXT,  /* bDevCapabilityType */
+  0x02,                       /* bmAttributes: LPM */
+  0x00,
+  0x00,
+  0x00
+};
+#endif
+
+#ifdef USBD_DESC_CACHE_ENABLED
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t USBD_DescCache[USBD_DESC_CACHE_SIZE] __ALIGN_END ;
+static USBD_DescCache_Entry_TypeDef USBD_DescCacheTab[USBD_CACHE_SPEEDS][USBD_CACHE_NUM];
+#endif
 /**
   * @}
   */ 
@@ -128,6 +185,46 @@ static void USBD_ClrFeature(USB_OTG_CORE_HANDLE  *pdev,
                             USB_SETUP_REQ *req);
 
 static uint8_t USBD_GetLen(uint8_t *buf);
+
+static void USBD_SendDescriptor(USB_OTG_CORE_HANDLE  *pdev, 
+                                USB_SETUP_REQ *req,
+                                uint8_t *pbuf,
+                                uint16_t len);
+
+#ifdef USBD_DESC_CACHE_ENABLED
+static uint8_t *USBD_DescCacheGet(USB_OTG_CORE_HANDLE  *pdev, 
+                                  USB_SETUP_REQ *req,
+                                  uint16_t *len);
+
+static uint8_t *USBD_DescSource(USB_OTG_CORE_HANDLE  *pdev, 
+                                uint8_t speed,
+                                uint8_t entry,
+                                uint16_t *len);
+#endif
+/**
+  * @}
+  */ 
+
+/** @defgroup USBD_REQ_Private_Constants
+  * @{
+  */ 
+/* Standard device requests, indexed by bRequest */
+static const USBD_StdReq_TypeDef USBD_StdDevReqTab[USB_REQ_SYNCH_FRAME + 1] =
+{
+  USBD_GetStatus,       /* USB_REQ_GET_STATUS */
+  USBD_ClrFeature,      /* USB_REQ_CLEAR_FEATURE */
+  NULL,                 /* Reserved */
+  USBD_SetFeature,      /* USB_REQ_SET_FEATURE */
+  NULL,                 /* Reserved */
+  USBD_SetAddress,      /* USB_REQ_SET_ADDRESS */
+  USBD_GetDescriptor,   /* USB_REQ_GET_DESCRIPTOR */
+  NULL,                 /* USB_REQ_SET_DESCRIPTOR */
+  USBD_GetConfig,       /* USB_REQ_GET_CONFIGURATION */
+  USBD_SetConfig,       /* USB_REQ_SET_CONFIGURATION */
+  NULL,                 /* USB_REQ_GET_INTERFACE */
+  NULL,                 /* USB_REQ_SET_INTERFACE */
+  NULL                  /* USB_REQ_SYNCH_FRAME */
+};
 /**
   * @}
   */ 
@@ -149,41 +246,28 @@ USBD_Status  USBD_StdDevReq (USB_OTG_CORE_HANDLE  *pdev, USB_SETUP_REQ  *req)
 {
   USBD_Status ret = USBD_OK;  
   
-  switch (req->bRequest) 
+#ifdef USB_SUPPORT_BOS_DESC
+  if ((req->bmRequest & USB_REQ_TYPE_MASK) == USB_REQ_TYPE_VENDOR)
+  {
+    /* Vendor requests announced by a BOS platform capability (e.g. the
+       MS OS 2.0 descriptor set), valid from the addressed state on */
+    if ((pdev->dev.class_cb->Setup (pdev, req) == USBD_OK) &&
+        (req->wLength == 0))
+    {
+      USBD_CtlSendStatus(pdev);
+    }
+    return ret;
+  }
+#endif
+  
+  if ((req->bRequest <= USB_REQ_SYNCH_FRAME) &&
+      (USBD_StdDevReqTab[req->bRequest] != NULL))
+  {
+    USBD_StdDevReqTab[req->bRequest] (pdev, req);
+  }
+  else
   {
-  case USB_REQ_GET_DESCRIPTOR: 
-    
-    USBD_GetDescriptor (pdev, req) ;
-    break;
-    
-  case USB_REQ_SET_ADDRESS:                      
-    USBD_SetAddress(pdev, req);
-    break;
-    
-  case USB_REQ_SET_CONFIGURATION:                    
-    USBD_SetConfig (pdev , req);
-    break;
-    
-  case USB_REQ_GET_CONFIGURATION:                 
-    USBD_GetConfig (pdev , req);
-    break;
-    
-  case USB_REQ_GET_STATUS:                                  
-    USBD_GetStatus (pdev , req);
-    break;
-    
-    
-  case USB_REQ_SET_FEATURE:   
-    USBD_SetFeature (pdev , req);    
-    break;
-    
-  case USB_REQ_CLEAR_FEATURE:                                   
-    USBD_ClrFeature (pdev , req);
-    break;
-    
-  default:  
     USBD_CtlError(pdev , req);
-    break;
   }
   
   return ret;
@@ -241,6 +325,13 @@ USBD_Status  USBD_StdEPReq (USB_OTG_CORE_HANDLE  *pdev, USB_SETUP_REQ  *req)
   
   ep_addr  = LOBYTE(req->wIndex);   
   
+  /* Class requests to an endpoint (e.g. audio sampling frequency) */
+  if ((req->bmRequest & USB_REQ_TYPE_MASK) == USB_REQ_TYPE_CLASS)
+  {
+    pdev->dev.class_cb->Setup (pdev, req);
+    return ret;
+  }
+  
   switch (req->bRequest) 
   {
     
@@ -369,6 +460,14 @@ static void USBD_GetDescriptor(USB_OTG_CORE_HANDLE  *pdev,
   uint16_t len;
   uint8_t *pbuf;
   
+#ifdef USBD_DESC_CACHE_ENABLED
+  pbuf = USBD_DescCacheGet(pdev, req, &len);
+  if (pbuf != NULL)
+  {
+    USBD_SendDescriptor(pdev, req, pbuf, len);
+    return;
+  }
+#endif
     
   switch (req->wValue >> 8)
   {
@@ -474,12 +573,47 @@ static void USBD_GetDescriptor(USB_OTG_CORE_HANDLE  *pdev,
       return;
 #endif     
 
+#if defined (USB_OTG_LPM_ENABLED) || defined (USB_SUPPORT_BOS_DESC)
+  case USB_DESC_TYPE_BOS:
+#ifdef USB_SUPPORT_BOS_DESC
+    if (pdev->dev.usr_device->GetBOSDescriptor != NULL)
+    {
+      pbuf = pdev->dev.usr_device->GetBOSDescriptor(pdev->cfg.speed, &len);
+      break;
+    }
+#endif
+#ifdef USB_OTG_LPM_ENABLED
+    pbuf = USBD_BOSDesc;
+    len  = USB_LEN_BOS_DESC;
+    break;
+#else
+    USBD_CtlError(pdev , req);
+    return;
+#endif
+#endif
     
   default: 
      USBD_CtlError(pdev , req);
     return;
   }
   
+  USBD_SendDescriptor(pdev, req, pbuf, len);
+}
+
+/**
+* @brief  USBD_SendDescriptor
+*         Send the descriptor requested, up to wLength bytes
+* @param  pdev: device instance
+* @param  req: usb request
+* @param  pbuf: descriptor
+* @param  len: descriptor length
+* @retval None
+*/
+static void USBD_SendDescriptor(USB_OTG_CORE_HANDLE  *pdev, 
+                                USB_SETUP_REQ *req,
+                                uint8_t *pbuf,
+                                uint16_t len)
+{
   if((len != 0)&& (req->wLength != 0))
   {
     
@@ -489,8 +623,184 @@ static void USBD_GetDescriptor(USB_OTG_CORE_HANDLE  *pdev,
                       pbuf,
                       len);
   }
+}
+
+#ifdef USBD_DESC_CACHE_ENABLED
+/**
+* @brief  USBD_DescCacheInit
+*         Copy the device, configuration and standard string descriptors of
+*         both speeds, so that the requests are answered without calling the
+*         class and user callbacks. Called by USBD_Init, and again by the
+*         application if it changes a descriptor (e.g. the serial number).
+*         The descriptors which do not fit in USBD_DESC_CACHE_SIZE are
+*         still requested from the callbacks.
+* @param  pdev: device instance
+* @retval None
+*/
+void USBD_DescCacheInit(USB_OTG_CORE_HANDLE  *pdev)
+{
+  uint32_t used = 0;
+  uint32_t idx;
+  uint8_t  speed, entry;
+  uint16_t len;
+  uint8_t  *pbuf;
+  
+  for (speed = 0; speed < USBD_CACHE_SPEEDS; speed++)
+  {
+    for (entry = 0; entry < USBD_CACHE_NUM; entry++)
+    {
+      len = 0;
+      pbuf = USBD_DescSource(pdev, speed, entry, &len);
+      USBD_DescCacheTab[speed][entry].len = 0;
+      
+      if ((pbuf != NULL) && (len != 0) && ((used + len) <= USBD_DESC_CACHE_SIZE))
+      {
+        for (idx = 0; idx < len; idx++)
+        {
+          USBD_DescCache[used + idx] = pbuf[idx];
+        }
+        USBD_DescCacheTab[speed][entry].ofs = used;
+        USBD_DescCacheTab[speed][entry].len = len;
+        
+        /* Keep the next descriptor word aligned for the DMA */
+        used += (len + 3) & ~3;
+      }
+    }
+  }
+}
+
+/**
+* @brief  USBD_DescSource
+*         Descriptor returned by the class and user callbacks
+* @param  pdev: device instance
+* @param  speed: USB_OTG_SPEED_HIGH or USB_OTG_SPEED_FULL
+* @param  entry: USBD_CACHE_xxx
+* @param  len: descriptor length
+* @retval descriptor, NULL if not provided
+*/
+static uint8_t *USBD_DescSource(USB_OTG_CORE_HANDLE  *pdev, 
+                                uint8_t speed,
+                                uint8_t entry,
+                                uint16_t *len)
+{
+  switch (entry)
+  {
+  case USBD_CACHE_DEVICE:
+    return pdev->dev.usr_device->GetDeviceDescriptor(speed, len);
+    
+  case USBD_CACHE_CONFIG:
+#ifdef USB_OTG_HS_CORE
+    if((speed == USB_OTG_SPEED_FULL )&&
+       (pdev->cfg.phy_itface  == USB_OTG_ULPI_PHY))
+    {
+      return pdev->dev.class_cb->GetOtherConfigDescriptor(speed, len);
+    }
+#endif
+    return pdev->dev.class_cb->GetConfigDescriptor(speed, len);
+    
+  case USBD_CACHE_STRING + USBD_IDX_LANGID_STR:
+    return pdev->dev.usr_device->GetLangIDStrDescriptor(speed, len);
+    
+  case USBD_CACHE_STRING + USBD_IDX_MFC_STR:
+    return pdev->dev.usr_device->GetManufacturerStrDescriptor(speed, len);
+    
+  case USBD_CACHE_STRING + USBD_IDX_PRODUCT_STR:
+    return pdev->dev.usr_device->GetProductStrDescriptor(speed, len);
+    
+  case USBD_CACHE_STRING + USBD_IDX_SERIAL_STR:
+    return pdev->dev.usr_device->GetSerialStrDescriptor(speed, len);
+    
+  case USBD_CACHE_STRING + USBD_IDX_CONFIG_STR:
+    return pdev->dev.usr_device->GetConfigurationStrDescriptor(speed, len);
+    
+  case USBD_CACHE_STRING + USBD_IDX_INTERFACE_STR:
+    return pdev->dev.usr_device->GetInterfaceStrDescriptor(speed, len);
+    
+  default:
+    return NULL;
+  }
+}
+
+/**
+* @brief  USBD_DescCacheGet
+*         Cached copy of the descriptor requested
+* @param  pdev: device instance
+* @param  req: usb request
+* @param  len: descriptor length
+* @retval descriptor, NULL if it is not cached
+*/
+static uint8_t *USBD_DescCacheGet(USB_OTG_CORE_HANDLE  *pdev, 
+                                  USB_SETUP_REQ *req,
+                                  uint16_t *len)
+{
+  USBD_DescCache_Entry_TypeDef *pentry;
+  uint8_t speed = pdev->cfg.speed;
+  uint8_t *pbuf;
+  
+  switch (req->wValue >> 8)
+  {
+  case USB_DESC_TYPE_DEVICE:
+    pentry = &USBD_DescCacheTab[speed][USBD_CACHE_DEVICE];
+    break;
+    
+  case USB_DESC_TYPE_CONFIGURATION:
+    pentry = &USBD_DescCacheTab[speed][USBD_CACHE_CONFIG];
+    break;
+    
+  case USB_DESC_TYPE_STRING:
+    if ((uint8_t)(req->wValue) > USBD_IDX_INTERFACE_STR)
+    {
+      return NULL;
+    }
+    pentry = &USBD_DescCacheTab[speed][USBD_CACHE_STRING + (uint8_t)(req->wValue)];
+    break;
+    
+#ifdef USB_OTG_HS_CORE
+  case USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION:
+    if(pdev->cfg.speed != USB_OTG_SPEED_HIGH)
+    {
+      return NULL;
+    }
+    /* Full speed configuration */
+    pentry = &USBD_DescCacheTab[USB_OTG_SPEED_FULL][USBD_CACHE_CONFIG];
+    break;
+#endif
+    
+  default:
+    return NULL;
+  }
+  
+  if (pentry->len == 0)
+  {
+    return NULL;
+  }
+  
+  pbuf = &USBD_DescCache[pentry->ofs];
+  *len = pentry->len;
+  
+  switch (req->wValue >> 8)
+  {
+  case USB_DESC_TYPE_DEVICE:
+    if ((req->wLength == 64) ||( pdev->dev.device_status == USB_OTG_DEFAULT))  
+    {                  
+      *len = 8;
+    }
+    break;
+    
+  case USB_DESC_TYPE_CONFIGURATION:
+    pbuf[1] = USB_DESC_TYPE_CONFIGURATION;
+    pdev->dev.pConfig_descriptor = pbuf;    
+    break;
+    
+  case USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION:
+    /* The full speed copy is both configuration and other speed one */
+    pbuf[1] = USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION;
+    break;
+  }
   
+  return pbuf;
 }
+#endif /* USBD_DESC_CACHE_ENABLED */
 
 /**
 * @brief  USBD_SetAddress
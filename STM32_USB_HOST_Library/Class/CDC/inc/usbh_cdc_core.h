@@ -0,0 +1,227 @@
+/**
+  ******************************************************************************
+  * @file    usbh_cdc_core.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   This file contains all the prototypes for the usbh_cdc_core.c
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive  ----------------------------------------------*/
+#ifndef __USBH_CDC_CORE_H
+#define __USBH_CDC_CORE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbh_core.h"
+#include "usbh_stdreq.h"
+#include "usb_bsp.h"
+#include "usbh_ioreq.h"
+#include "usbh_hcs.h"
+
+/** @addtogroup USBH_LIB
+  * @{
+  */
+
+/** @addtogroup USBH_CLASS
+  * @{
+  */
+
+/** @addtogroup USBH_CDC_CLASS
+  * @{
+  */
+
+/** @defgroup USBH_CDC_CORE
+  * @brief This file is the Header file for USBH_CDC_CORE.c
+  * @{
+  */
+
+
+/** @defgroup USBH_CDC_CORE_Exported_Defines
+  * @{
+  */
+
+#define CDC_COMM_CLASS                    0x02
+#define CDC_DATA_CLASS                    0x0A
+#define CDC_VENDOR_CLASS                  0xFF
+#define CDC_ACM_SUBCLASS                  0x02
+
+/* Class requests */
+#define CDC_SET_LINE_CODING               0x20
+#define CDC_GET_LINE_CODING               0x21
+#define CDC_SET_CONTROL_LINE_STATE        0x22
+#define CDC_SEND_BREAK                    0x23
+
+#define CDC_LINE_CODING_SIZE              7
+
+/* CDC_Machine.req_pending */
+#define CDC_PENDING_LINE_CODING           0x01
+#define CDC_PENDING_LINE_STATE            0x02
+
+/* SET_CONTROL_LINE_STATE wValue */
+#define CDC_LINE_STATE_DTR                0x0001
+#define CDC_LINE_STATE_RTS                0x0002
+
+/* Largest bulk URB, whole HS packets: the IN URBs span several packets,
+   the OUT ones too with the DMA */
+#ifndef USBH_CDC_URB_SIZE
+ #ifdef USE_USB_OTG_FS
+  #define USBH_CDC_URB_SIZE               512
+ #else
+  #define USBH_CDC_URB_SIZE               2048
+ #endif
+#endif
+
+#if ((USBH_CDC_URB_SIZE % 512) != 0) || (USBH_CDC_URB_SIZE > 0xFE00)
+ #error "USBH_CDC_URB_SIZE: a multiple of 512 fitting a 16-bit URB length"
+#endif
+/**
+  * @}
+  */
+
+
+/** @defgroup USBH_CDC_CORE_Exported_Types
+  * @{
+  */
+
+typedef enum
+{
+  CDC_REQ_IDLE = 0,
+  CDC_REQ_SET_LINE_CODING,
+  CDC_REQ_SET_CONTROL_LINE_STATE,
+}
+CDC_CtlState;
+
+/* States of a bulk pipe */
+typedef enum
+{
+  CDC_PIPE_IDLE = 0,          /* No URB, started by the next poll */
+  CDC_PIPE_BUSY,              /* URB in progress */
+  CDC_PIPE_RETRY,             /* OUT URB to be sent again */
+  CDC_PIPE_STALL,             /* Endpoint halt to be cleared */
+}
+CDC_PipeState;
+
+typedef struct _CDC_LineCoding
+{
+  uint32_t             dwDTERate;     /* bits per second */
+  uint8_t              bCharFormat;   /* 0: 1 stop bit, 1: 1.5, 2: 2 */
+  uint8_t              bParityType;   /* 0: none, 1: odd, 2: even... */
+  uint8_t              bDataBits;     /* 5, 6, 7, 8 or 16 */
+}
+CDC_LineCoding_TypeDef;
+
+/* Byte ring, head written by the producer only and tail by the consumer
+   only: the URB interrupt and the application share it without locks */
+typedef struct _CDC_Ring
+{
+  uint8_t              *buff;
+  uint32_t             size;          /* Power of two */
+  __IO uint32_t        head;          /* Free running */
+  __IO uint32_t        tail;          /* Free running */
+}
+CDC_Ring_TypeDef;
+
+/* Structure for CDC process */
+typedef struct _CDC_Process
+{
+  uint8_t              rx_buff[USBH_CDC_URB_SIZE];
+  uint8_t              tx_buff[USBH_CDC_URB_SIZE];
+  uint8_t              ctl_buff[8];
+  uint8_t              hc_num_in;
+  uint8_t              hc_num_out;
+  uint8_t              BulkInEp;
+  uint8_t              BulkOutEp;
+  uint16_t             BulkInEpSize;
+  uint16_t             BulkOutEpSize;
+  uint8_t              itf;           /* Communication interface number */
+  uint8_t              acm;           /* 0 for a vendor bulk interface */
+  CDC_CtlState         ctl_state;
+  __IO uint8_t         req_pending;   /* CDC_PENDING_xxx requests to send */
+  __IO CDC_PipeState   rx_state;
+  __IO CDC_PipeState   tx_state;
+  uint8_t              *tx_ptr;       /* Rest of the OUT URB */
+  uint16_t             tx_len;
+  CDC_Ring_TypeDef     rx;
+  CDC_Ring_TypeDef     tx;
+  CDC_LineCoding_TypeDef line;
+  uint16_t             line_state;
+  uint8_t              ready;         /* Pipes open, class requests done */
+}
+CDC_Machine_TypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup USBH_CDC_CORE_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USBH_CDC_CORE_Exported_Variables
+  * @{
+  */
+extern USBH_Class_cb_TypeDef  USBH_CDC_cb;
+extern CDC_Machine_TypeDef    CDC_Machine;
+/**
+  * @}
+  */
+
+/** @defgroup USBH_CDC_CORE_Exported_FunctionsPrototype
+  * @{
+  */
+USBH_Status USBH_CDC_SetRxBuffer (uint8_t *buff, uint32_t size);
+USBH_Status USBH_CDC_SetTxBuffer (uint8_t *buff, uint32_t size);
+uint32_t USBH_CDC_Read (uint8_t *buff, uint32_t length);
+uint32_t USBH_CDC_Write (const uint8_t *buff, uint32_t length);
+uint32_t USBH_CDC_RxCount (void);
+uint32_t USBH_CDC_TxSpace (void);
+uint8_t  USBH_CDC_IsReady (void);
+void USBH_CDC_SetLineCoding (const CDC_LineCoding_TypeDef *line);
+void USBH_CDC_SetControlLineState (uint16_t state);
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+void USBH_CDC_URBNotify (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
+#endif
+/**
+  * @}
+  */
+
+
+#endif /* __USBH_CDC_CORE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
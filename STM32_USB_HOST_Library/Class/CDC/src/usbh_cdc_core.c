@@ -0,0 +1,932 @@
+/**
+  ******************************************************************************
+  * @file    usbh_cdc_core.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   This file is the CDC Layer Handlers for USB Host CDC class.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                CDC Class  Description
+  *          ===================================================================
+  *           This module manages the CDC class V1.2 following the "Universal
+  *           Serial Bus Class Definitions for Communication Devices V1.2".
+  *           This driver implements the following aspects of the specification:
+  *             - The Abstract Control Model (ACM) data interface with the
+  *               SET_LINE_CODING and SET_CONTROL_LINE_STATE requests
+  *             - Vendor specific interfaces with a bulk IN/OUT pair
+  *
+  *           The bulk IN pipe is polled without a break into a ring given
+  *           by USBH_CDC_SetRxBuffer, and the bulk OUT pipe drains the ring
+  *           filled by USBH_CDC_Write. With USB_OTG_URB_NOTIFY_ENABLED the
+  *           next URB is sent from the URB interrupt, else from the class
+  *           handler. The notification endpoint is not polled.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "usbh_cdc_core.h"
+
+/** @addtogroup USBH_LIB
+* @{
+*/
+
+/** @addtogroup USBH_CLASS
+* @{
+*/
+
+/** @addtogroup USBH_CDC_CLASS
+* @{
+*/
+
+/** @defgroup USBH_CDC_CORE
+* @brief    This file includes CDC Layer Handlers for USB Host CDC class.
+* @{
+*/
+
+/** @defgroup USBH_CDC_CORE_Private_TypesDefinitions
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_CDC_CORE_Private_Defines
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_CDC_CORE_Private_Macros
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_CDC_CORE_Private_Variables
+* @{
+*/
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN CDC_Machine_TypeDef        CDC_Machine __ALIGN_END ;
+
+#ifdef USBH_HC_POOL_ENABLED
+/* Bulk channels kept for CDC across re-plugs */
+static uint32_t CDC_HC_Pool = 0;
+#endif
+
+/* Line coding and line state set by the application, else defaulted */
+static uint8_t CDC_LineSet = 0;
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_CDC_CORE_Private_FunctionPrototypes
+* @{
+*/
+
+static USBH_Status USBH_CDC_InterfaceInit  (USB_OTG_CORE_HANDLE *pdev ,
+                                            void *phost);
+
+static void USBH_CDC_InterfaceDeInit  (USB_OTG_CORE_HANDLE *pdev ,
+                                       void *phost);
+
+static USBH_Status USBH_CDC_Handle(USB_OTG_CORE_HANDLE *pdev ,
+                                   void *phost);
+
+static USBH_Status USBH_CDC_ClassRequest(USB_OTG_CORE_HANDLE *pdev ,
+                                         void *phost);
+
+static USBH_Status USBH_CDC_CtlProcess (USB_OTG_CORE_HANDLE *pdev,
+                                        USBH_HOST *phost);
+
+static uint32_t CDC_RingPut (CDC_Ring_TypeDef *ring,
+                             const uint8_t *buff,
+                             uint32_t length);
+
+static uint32_t CDC_RingGet (CDC_Ring_TypeDef *ring,
+                             uint8_t *buff,
+                             uint32_t length);
+
+static void CDC_StartRx (USB_OTG_CORE_HANDLE *pdev);
+static void CDC_StartTx (USB_OTG_CORE_HANDLE *pdev);
+static void CDC_ProcessRx (USB_OTG_CORE_HANDLE *pdev);
+static void CDC_ProcessTx (USB_OTG_CORE_HANDLE *pdev);
+
+
+USBH_Class_cb_TypeDef  USBH_CDC_cb =
+{
+  USBH_CDC_InterfaceInit,
+  USBH_CDC_InterfaceDeInit,
+  USBH_CDC_ClassRequest,
+  USBH_CDC_Handle
+};
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_CDC_CORE_Private_Functions
+* @{
+*/
+
+/**
+* @brief  USBH_CDC_InterfaceInit
+*         The function init the CDC class: an ACM data interface or the
+*         first vendor interface with a bulk IN/OUT pair
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval  USBH_Status :Response for USB CDC driver intialization
+*/
+static USBH_Status USBH_CDC_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
+                                           void *phost)
+{
+  USBH_HOST *pphost = phost;
+  USBH_InterfaceDesc_TypeDef *pitf;
+  USBH_EpDesc_TypeDef *pep;
+  uint8_t itf, num, maxItf, maxEP;
+  uint8_t data_itf = 0xFF;
+
+  CDC_Machine.acm = 0;
+  CDC_Machine.itf = 0;
+
+  maxItf = ((pphost->device_prop.Cfg_Desc.bNumInterfaces <= USBH_MAX_NUM_INTERFACES) ?
+            pphost->device_prop.Cfg_Desc.bNumInterfaces :
+              USBH_MAX_NUM_INTERFACES);
+
+  for (itf = 0; itf < maxItf; itf++)
+  {
+    pitf = &pphost->device_prop.Itf_Desc[itf];
+
+    if ((pitf->bInterfaceClass == CDC_COMM_CLASS) &&
+        (pitf->bInterfaceSubClass == CDC_ACM_SUBCLASS))
+    {
+      /* Class requests go to the communication interface */
+      CDC_Machine.acm = 1;
+      CDC_Machine.itf = pitf->bInterfaceNumber;
+    }
+    else if (((pitf->bInterfaceClass == CDC_DATA_CLASS) ||
+              (pitf->bInterfaceClass == CDC_VENDOR_CLASS)) &&
+             (data_itf == 0xFF))
+    {
+      CDC_Machine.BulkInEp  = 0;
+      CDC_Machine.BulkOutEp = 0;
+
+      maxEP = ((pitf->bNumEndpoints <= USBH_MAX_NUM_ENDPOINTS) ?
+               pitf->bNumEndpoints :
+                 USBH_MAX_NUM_ENDPOINTS);
+
+      for (num = 0; num < maxEP; num++)
+      {
+        pep = &pphost->device_prop.Ep_Desc[itf][num];
+
+        if ((pep->bmAttributes & 0x03) != USB_EP_TYPE_BULK)
+        {
+          continue;
+        }
+        if (pep->bEndpointAddress & 0x80)
+        {
+          CDC_Machine.BulkInEp     = pep->bEndpointAddress;
+          CDC_Machine.BulkInEpSize = pep->wMaxPacketSize;
+        }
+        else
+        {
+          CDC_Machine.BulkOutEp     = pep->bEndpointAddress;
+          CDC_Machine.BulkOutEpSize = pep->wMaxPacketSize;
+        }
+      }
+
+      if ((CDC_Machine.BulkInEp != 0) && (CDC_Machine.BulkOutEp != 0))
+      {
+        data_itf = itf;
+      }
+    }
+  }
+
+  if (data_itf == 0xFF)
+  {
+    pphost->usr_cb->DeviceNotSupported();
+    return USBH_NOT_SUPPORTED;
+  }
+
+#ifdef USBH_HC_POOL_ENABLED
+  USBH_Reserve_Channels(pdev, &CDC_HC_Pool, 2);
+  CDC_Machine.hc_num_out = USBH_Alloc_PoolChannel(pdev, &CDC_HC_Pool,
+                                                  CDC_Machine.BulkOutEp);
+  CDC_Machine.hc_num_in = USBH_Alloc_PoolChannel(pdev, &CDC_HC_Pool,
+                                                 CDC_Machine.BulkInEp);
+#else
+  CDC_Machine.hc_num_out = USBH_Alloc_Channel(pdev,
+                                              CDC_Machine.BulkOutEp);
+  CDC_Machine.hc_num_in = USBH_Alloc_Channel(pdev,
+                                             CDC_Machine.BulkInEp);
+#endif
+
+  /* Open the new channels */
+  USBH_Open_Channel  (pdev,
+                      CDC_Machine.hc_num_out,
+                      pphost->device_prop.address,
+                      pphost->device_prop.speed,
+                      EP_TYPE_BULK,
+                      CDC_Machine.BulkOutEpSize);
+
+  USBH_Open_Channel  (pdev,
+                      CDC_Machine.hc_num_in,
+                      pphost->device_prop.address,
+                      pphost->device_prop.speed,
+                      EP_TYPE_BULK,
+                      CDC_Machine.BulkInEpSize);
+
+  CDC_Machine.rx_state  = CDC_PIPE_IDLE;
+  CDC_Machine.tx_state  = CDC_PIPE_IDLE;
+  CDC_Machine.ctl_state = CDC_REQ_IDLE;
+  CDC_Machine.req_pending = 0;
+  CDC_Machine.ready     = 0;
+
+  if (CDC_Machine.acm)
+  {
+    /* 115200 bauds 8N1, DTR and RTS on, unless set beforehand */
+    if ((CDC_LineSet & CDC_PENDING_LINE_CODING) == 0)
+    {
+      CDC_Machine.line.dwDTERate   = 115200;
+      CDC_Machine.line.bCharFormat = 0;
+      CDC_Machine.line.bParityType = 0;
+      CDC_Machine.line.bDataBits   = 8;
+    }
+    if ((CDC_LineSet & CDC_PENDING_LINE_STATE) == 0)
+    {
+      CDC_Machine.line_state = CDC_LINE_STATE_DTR | CDC_LINE_STATE_RTS;
+    }
+    CDC_Machine.req_pending = CDC_PENDING_LINE_CODING | CDC_PENDING_LINE_STATE;
+  }
+
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+  USBH_SetURBNotify(USBH_CDC_URBNotify);
+#endif
+
+  return USBH_OK;
+}
+
+
+/**
+* @brief  USBH_CDC_InterfaceDeInit
+*         The function DeInit the Host Channels used for the CDC class.
+*         The unread data stays in the Rx ring, the data not sent yet is
+*         dropped
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval None
+*/
+static void USBH_CDC_InterfaceDeInit ( USB_OTG_CORE_HANDLE *pdev,
+                                      void *phost)
+{
+  CDC_Machine.ready = 0;
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+  USBH_SetURBNotify(0);
+#endif
+
+  if ( CDC_Machine.hc_num_out)
+  {
+    USB_OTG_HC_Halt(pdev, CDC_Machine.hc_num_out);
+    USBH_Free_Channel  (pdev, CDC_Machine.hc_num_out);
+    CDC_Machine.hc_num_out = 0;     /* Reset the Channel as Free */
+  }
+
+  if ( CDC_Machine.hc_num_in)
+  {
+    USB_OTG_HC_Halt(pdev, CDC_Machine.hc_num_in);
+    USBH_Free_Channel  (pdev, CDC_Machine.hc_num_in);
+    CDC_Machine.hc_num_in = 0;     /* Reset the Channel as Free */
+  }
+
+  CDC_Machine.rx_state = CDC_PIPE_IDLE;
+  CDC_Machine.tx_state = CDC_PIPE_IDLE;
+  CDC_Machine.tx.tail  = CDC_Machine.tx.head;
+}
+
+/**
+* @brief  USBH_CDC_ClassRequest
+*         The function is responsible for handling CDC Class requests
+*         for CDC class: line coding and control line state of an ACM
+*         device, none for a vendor interface
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval  USBH_Status :Response for USB CDC class requests
+*/
+static USBH_Status USBH_CDC_ClassRequest(USB_OTG_CORE_HANDLE *pdev ,
+                                         void *phost)
+{
+  USBH_Status status;
+
+  status = USBH_CDC_CtlProcess(pdev, phost);
+
+  if ((status == USBH_OK) && (CDC_Machine.req_pending == 0))
+  {
+    CDC_Machine.ready = 1;
+    return USBH_OK;
+  }
+
+  return USBH_BUSY;
+}
+
+/**
+* @brief  USBH_CDC_CtlProcess
+*         Sends the pending class requests one after the other
+* @param  pdev: Selected device
+* @param  phost: Selected device property
+* @retval USBH_OK when no request is in progress
+*/
+static USBH_Status USBH_CDC_CtlProcess (USB_OTG_CORE_HANDLE *pdev,
+                                        USBH_HOST *phost)
+{
+  USBH_Status status = USBH_BUSY;
+
+  switch (CDC_Machine.ctl_state)
+  {
+  case CDC_REQ_IDLE:
+    if (CDC_Machine.req_pending & CDC_PENDING_LINE_CODING)
+    {
+      CDC_Machine.req_pending &= ~CDC_PENDING_LINE_CODING;
+
+      CDC_Machine.ctl_buff[0] = (uint8_t)(CDC_Machine.line.dwDTERate);
+      CDC_Machine.ctl_buff[1] = (uint8_t)(CDC_Machine.line.dwDTERate >> 8);
+      CDC_Machine.ctl_buff[2] = (uint8_t)(CDC_Machine.line.dwDTERate >> 16);
+      CDC_Machine.ctl_buff[3] = (uint8_t)(CDC_Machine.line.dwDTERate >> 24);
+      CDC_Machine.ctl_buff[4] = CDC_Machine.line.bCharFormat;
+      CDC_Machine.ctl_buff[5] = CDC_Machine.line.bParityType;
+      CDC_Machine.ctl_buff[6] = CDC_Machine.line.bDataBits;
+
+      phost->Control.setup.b.bmRequestType = USB_H2D | USB_REQ_RECIPIENT_INTERFACE |\
+        USB_REQ_TYPE_CLASS;
+      phost->Control.setup.b.bRequest = CDC_SET_LINE_CODING;
+      phost->Control.setup.b.wValue.w = 0;
+      phost->Control.setup.b.wIndex.w = CDC_Machine.itf;
+      phost->Control.setup.b.wLength.w = CDC_LINE_CODING_SIZE;
+
+      CDC_Machine.ctl_state = CDC_REQ_SET_LINE_CODING;
+    }
+    else if (CDC_Machine.req_pending & CDC_PENDING_LINE_STATE)
+    {
+      CDC_Machine.req_pending &= ~CDC_PENDING_LINE_STATE;
+
+      phost->Control.setup.b.bmRequestType = USB_H2D | USB_REQ_RECIPIENT_INTERFACE |\
+        USB_REQ_TYPE_CLASS;
+      phost->Control.setup.b.bRequest = CDC_SET_CONTROL_LINE_STATE;
+      phost->Control.setup.b.wValue.w = CDC_Machine.line_state;
+      phost->Control.setup.b.wIndex.w = CDC_Machine.itf;
+      phost->Control.setup.b.wLength.w = 0;
+
+      CDC_Machine.ctl_state = CDC_REQ_SET_CONTROL_LINE_STATE;
+    }
+    else
+    {
+      status = USBH_OK;
+    }
+    break;
+
+  case CDC_REQ_SET_LINE_CODING:
+    status = USBH_CtlReq(pdev, phost, CDC_Machine.ctl_buff, CDC_LINE_CODING_SIZE);
+    /* A device stalling the request keeps its own line settings */
+    if ((status == USBH_OK) || (status == USBH_NOT_SUPPORTED))
+    {
+      CDC_Machine.ctl_state = CDC_REQ_IDLE;
+    }
+    status = USBH_BUSY;
+    break;
+
+  case CDC_REQ_SET_CONTROL_LINE_STATE:
+    status = USBH_CtlReq(pdev, phost, 0, 0);
+    if ((status == USBH_OK) || (status == USBH_NOT_SUPPORTED))
+    {
+      CDC_Machine.ctl_state = CDC_REQ_IDLE;
+    }
+    status = USBH_BUSY;
+    break;
+
+  default:
+    break;
+  }
+
+  return status;
+}
+
+
+/**
+* @brief  USBH_CDC_Handle
+*         The function is for managing state machine for CDC data transfers:
+*         starts the idle pipes, clears the endpoint halts and sends the
+*         class requests asked by the application
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval USBH_Status
+*/
+static USBH_Status USBH_CDC_Handle(USB_OTG_CORE_HANDLE *pdev ,
+                                   void   *phost)
+{
+  USBH_HOST *pphost = phost;
+  USBH_Status status = USBH_OK;
+
+  if (CDC_Machine.ready == 0)
+  {
+    return status;
+  }
+
+#ifndef USB_OTG_URB_NOTIFY_ENABLED
+  CDC_ProcessRx(pdev);
+  CDC_ProcessTx(pdev);
+#endif
+
+  if (USBH_CDC_CtlProcess(pdev, pphost) != USBH_OK)
+  {
+    /* Control pipe in use */
+    return status;
+  }
+
+  if (CDC_Machine.rx_state == CDC_PIPE_STALL)
+  {
+    if (USBH_ClrFeature(pdev,
+                        pphost,
+                        CDC_Machine.BulkInEp,
+                        CDC_Machine.hc_num_in) == USBH_OK)
+    {
+      CDC_Machine.rx_state = CDC_PIPE_IDLE;
+    }
+    return status;
+  }
+
+  if (CDC_Machine.tx_state == CDC_PIPE_STALL)
+  {
+    if (USBH_ClrFeature(pdev,
+                        pphost,
+                        CDC_Machine.BulkOutEp,
+                        CDC_Machine.hc_num_out) == USBH_OK)
+    {
+      /* The URB halted is sent again */
+      CDC_Machine.tx_state = CDC_PIPE_RETRY;
+    }
+    return status;
+  }
+
+  if (CDC_Machine.tx_state == CDC_PIPE_RETRY)
+  {
+    CDC_Machine.tx_state = CDC_PIPE_BUSY;
+    USBH_BulkSendData (pdev,
+                       CDC_Machine.tx_ptr,
+                       CDC_Machine.tx_len,
+                       CDC_Machine.hc_num_out);
+  }
+
+  CDC_StartRx(pdev);
+  CDC_StartTx(pdev);
+
+  return status;
+}
+
+/**
+* @brief  CDC_StartRx
+*         Starts an IN URB of whole packets if the Rx ring has room for them
+* @param  pdev: Selected device
+* @retval None
+*/
+static void CDC_StartRx (USB_OTG_CORE_HANDLE *pdev)
+{
+  uint32_t length;
+
+  if ((CDC_Machine.rx_state != CDC_PIPE_IDLE) || (CDC_Machine.rx.buff == 0))
+  {
+    return;
+  }
+
+  length = CDC_Machine.rx.size - (CDC_Machine.rx.head - CDC_Machine.rx.tail);
+  if (length > USBH_CDC_URB_SIZE)
+  {
+    length = USBH_CDC_URB_SIZE;
+  }
+  length -= length % CDC_Machine.BulkInEpSize;
+
+  /* Ring full: the device is NAKed until USBH_CDC_Read makes room */
+  if (length != 0)
+  {
+    CDC_Machine.rx_state = CDC_PIPE_BUSY;
+    USBH_BulkReceiveData (pdev,
+                          CDC_Machine.rx_buff,
+                          length,
+                          CDC_Machine.hc_num_in);
+  }
+}
+
+/**
+* @brief  CDC_StartTx
+*         Starts an OUT URB with the next bytes of the Tx ring. The URB only
+*         spans several packets with the DMA: in slave mode the whole URB
+*         would have to be written in the Tx FIFO at once
+* @param  pdev: Selected device
+* @retval None
+*/
+static void CDC_StartTx (USB_OTG_CORE_HANDLE *pdev)
+{
+  uint32_t length;
+
+  if ((CDC_Machine.tx_state != CDC_PIPE_IDLE) || (CDC_Machine.tx.buff == 0))
+  {
+    return;
+  }
+
+  length = (pdev->cfg.dma_enable == 1) ? USBH_CDC_URB_SIZE : CDC_Machine.BulkOutEpSize;
+  length = CDC_RingGet(&CDC_Machine.tx, CDC_Machine.tx_buff, length);
+
+  if (length != 0)
+  {
+    CDC_Machine.tx_ptr   = CDC_Machine.tx_buff;
+    CDC_Machine.tx_len   = length;
+    CDC_Machine.tx_state = CDC_PIPE_BUSY;
+    USBH_BulkSendData (pdev,
+                       CDC_Machine.tx_ptr,
+                       CDC_Machine.tx_len,
+                       CDC_Machine.hc_num_out);
+  }
+}
+
+/**
+* @brief  CDC_ProcessRx
+*         Moves the data of a completed IN URB to the Rx ring and starts
+*         the next one
+* @param  pdev: Selected device
+* @retval None
+*/
+static void CDC_ProcessRx (USB_OTG_CORE_HANDLE *pdev)
+{
+  URB_STATE URB_Status;
+
+  if (CDC_Machine.rx_state != CDC_PIPE_BUSY)
+  {
+    return;
+  }
+
+  URB_Status = HCD_GetURB_State(pdev, CDC_Machine.hc_num_in);
+
+  if (URB_Status == URB_DONE)
+  {
+    CDC_RingPut(&CDC_Machine.rx, CDC_Machine.rx_buff,
+                HCD_GetXferCnt(pdev, CDC_Machine.hc_num_in));
+    CDC_Machine.rx_state = CDC_PIPE_IDLE;
+    CDC_StartRx(pdev);
+  }
+  else if (URB_Status == URB_STALL)
+  {
+    CDC_Machine.rx_state = CDC_PIPE_STALL;
+  }
+  else if (URB_Status == URB_ERROR)
+  {
+    /* Started again by the next poll */
+    CDC_Machine.rx_state = CDC_PIPE_IDLE;
+  }
+}
+
+/**
+* @brief  CDC_ProcessTx
+*         Handles the end of an OUT URB: the next bytes of the Tx ring are
+*         sent when it is done, the packets not ACKed yet on a NAK
+* @param  pdev: Selected device
+* @retval None
+*/
+static void CDC_ProcessTx (USB_OTG_CORE_HANDLE *pdev)
+{
+  URB_STATE URB_Status;
+  uint32_t count;
+
+  if (CDC_Machine.tx_state != CDC_PIPE_BUSY)
+  {
+    return;
+  }
+
+  URB_Status = HCD_GetURB_State(pdev, CDC_Machine.hc_num_out);
+
+  if (URB_Status == URB_DONE)
+  {
+    CDC_Machine.tx_state = CDC_PIPE_IDLE;
+    CDC_StartTx(pdev);
+  }
+  else if (URB_Status == URB_NOTREADY)
+  {
+    if (pdev->cfg.dma_enable == 1)
+    {
+      /* Resume the multi-packet URB after the packets already ACKed */
+      count = HCD_GetXferCnt(pdev, CDC_Machine.hc_num_out);
+      CDC_Machine.tx_ptr += count;
+      CDC_Machine.tx_len -= count;
+    }
+    USBH_BulkSendData (pdev,
+                       CDC_Machine.tx_ptr,
+                       CDC_Machine.tx_len,
+                       CDC_Machine.hc_num_out);
+  }
+  else if (URB_Status == URB_STALL)
+  {
+    CDC_Machine.tx_state = CDC_PIPE_STALL;
+  }
+  else if (URB_Status == URB_ERROR)
+  {
+    CDC_Machine.tx_state = CDC_PIPE_RETRY;
+  }
+}
+
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+/**
+* @brief  USBH_CDC_URBNotify
+*         Called from the interrupt on a URB state change: the bulk pipes
+*         go on with the next URB at once, without waiting for the class
+*         handler
+* @param  pdev: Selected device
+* @param  hc_num: Channel number
+* @retval None
+*/
+void USBH_CDC_URBNotify (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+  if (CDC_Machine.ready == 0)
+  {
+    return;
+  }
+
+  if (hc_num == CDC_Machine.hc_num_in)
+  {
+    CDC_ProcessRx(pdev);
+  }
+  else if (hc_num == CDC_Machine.hc_num_out)
+  {
+    CDC_ProcessTx(pdev);
+  }
+}
+#endif
+
+/**
+* @brief  CDC_RingPut
+*         Copies data to a ring, as much as it has room for
+* @param  ring: Ring written
+* @param  buff: Data
+* @param  length: Data length
+* @retval Bytes copied
+*/
+static uint32_t CDC_RingPut (CDC_Ring_TypeDef *ring,
+                             const uint8_t *buff,
+                             uint32_t length)
+{
+  uint32_t head = ring->head;
+  uint32_t idx, part;
+
+  if (length > (ring->size - (head - ring->tail)))
+  {
+    length = ring->size - (head - ring->tail);
+  }
+  if (length == 0)
+  {
+    return 0;
+  }
+
+  idx  = head & (ring->size - 1);
+  part = ring->size - idx;
+  if (part > length)
+  {
+    part = length;
+  }
+  memcpy(ring->buff + idx, buff, part);
+  memcpy(ring->buff, buff + part, length - part);
+
+  ring->head = head + length;
+  return length;
+}
+
+/**
+* @brief  CDC_RingGet
+*         Copies data out of a ring, as much as it holds
+* @param  ring: Ring read
+* @param  buff: Destination
+* @param  length: Largest length to copy
+* @retval Bytes copied
+*/
+static uint32_t CDC_RingGet (CDC_Ring_TypeDef *ring,
+                             uint8_t *buff,
+                             uint32_t length)
+{
+  uint32_t tail = ring->tail;
+  uint32_t idx, part;
+
+  if (length > (ring->head - tail))
+  {
+    length = ring->head - tail;
+  }
+  if (length == 0)
+  {
+    return 0;
+  }
+
+  idx  = tail & (ring->size - 1);
+  part = ring->size - idx;
+  if (part > length)
+  {
+    part = length;
+  }
+  memcpy(buff, ring->buff + idx, part);
+  memcpy(buff + part, ring->buff, length - part);
+
+  ring->tail = tail + length;
+  return length;
+}
+/**
+* @}
+*/
+
+/** @defgroup USBH_CDC_CORE_Exported_Functions
+* @{
+*/
+
+/**
+* @brief  USBH_CDC_SetRxBuffer
+*         Sets the ring the bulk IN data is received in. To be called
+*         before the device is attached: its content is dropped
+* @param  buff: Ring buffer
+* @param  size: Ring size, a power of two
+* @retval USBH_OK, USBH_FAIL if size is not a power of two
+*/
+USBH_Status USBH_CDC_SetRxBuffer (uint8_t *buff, uint32_t size)
+{
+  if ((size == 0) || ((size & (size - 1)) != 0))
+  {
+    return USBH_FAIL;
+  }
+
+  CDC_Machine.rx.buff = 0;
+  CDC_Machine.rx.size = size;
+  CDC_Machine.rx.head = 0;
+  CDC_Machine.rx.tail = 0;
+  CDC_Machine.rx.buff = buff;
+  return USBH_OK;
+}
+
+/**
+* @brief  USBH_CDC_SetTxBuffer
+*         Sets the ring queuing the data of USBH_CDC_Write. To be called
+*         before the device is attached: its content is dropped
+* @param  buff: Ring buffer
+* @param  size: Ring size, a power of two
+* @retval USBH_OK, USBH_FAIL if size is not a power of two
+*/
+USBH_Status USBH_CDC_SetTxBuffer (uint8_t *buff, uint32_t size)
+{
+  if ((size == 0) || ((size & (size - 1)) != 0))
+  {
+    return USBH_FAIL;
+  }
+
+  CDC_Machine.tx.buff = 0;
+  CDC_Machine.tx.size = size;
+  CDC_Machine.tx.head = 0;
+  CDC_Machine.tx.tail = 0;
+  CDC_Machine.tx.buff = buff;
+  return USBH_OK;
+}
+
+/**
+* @brief  USBH_CDC_Read
+*         Takes received data out of the Rx ring, never waits
+* @param  buff: Destination
+* @param  length: Largest length to read
+* @retval Bytes read
+*/
+uint32_t USBH_CDC_Read (uint8_t *buff, uint32_t length)
+{
+  return CDC_RingGet(&CDC_Machine.rx, buff, length);
+}
+
+/**
+* @brief  USBH_CDC_Write
+*         Queues data in the Tx ring, never waits. The data is sent by the
+*         bulk OUT pipe once the device is ready
+* @param  buff: Data
+* @param  length: Data length
+* @retval Bytes queued, less than length when the ring is full
+*/
+uint32_t USBH_CDC_Write (const uint8_t *buff, uint32_t length)
+{
+  return CDC_RingPut(&CDC_Machine.tx, buff, length);
+}
+
+/**
+* @brief  USBH_CDC_RxCount
+*         Bytes waiting in the Rx ring
+* @param  None
+* @retval Byte count
+*/
+uint32_t USBH_CDC_RxCount (void)
+{
+  return CDC_Machine.rx.head - CDC_Machine.rx.tail;
+}
+
+/**
+* @brief  USBH_CDC_TxSpace
+*         Room left in the Tx ring
+* @param  None
+* @retval Byte count
+*/
+uint32_t USBH_CDC_TxSpace (void)
+{
+  return CDC_Machine.tx.size - (CDC_Machine.tx.head - CDC_Machine.tx.tail);
+}
+
+/**
+* @brief  USBH_CDC_IsReady
+*         Tells whether a device is enumerated and its pipes running
+* @param  None
+* @retval 1 if ready, else 0
+*/
+uint8_t USBH_CDC_IsReady (void)
+{
+  return CDC_Machine.ready;
+}
+
+/**
+* @brief  USBH_CDC_SetLineCoding
+*         Sets the line coding of an ACM device, sent to it by the class
+*         handler (at enumeration if no device is attached yet)
+* @param  line: Line coding
+* @retval None
+*/
+void USBH_CDC_SetLineCoding (const CDC_LineCoding_TypeDef *line)
+{
+  CDC_Machine.line = *line;
+  CDC_LineSet |= CDC_PENDING_LINE_CODING;
+  if (CDC_Machine.ready && CDC_Machine.acm)
+  {
+    CDC_Machine.req_pending |= CDC_PENDING_LINE_CODING;
+  }
+}
+
+/**
+* @brief  USBH_CDC_SetControlLineState
+*         Sets DTR/RTS of an ACM device, sent to it by the class handler
+*         (at enumeration if no device is attached yet)
+* @param  state: CDC_LINE_STATE_DTR | CDC_LINE_STATE_RTS
+* @retval None
+*/
+void USBH_CDC_SetControlLineState (uint16_t state)
+{
+  CDC_Machine.line_state = state;
+  CDC_LineSet |= CDC_PENDING_LINE_STATE;
+  if (CDC_Machine.ready && CDC_Machine.acm)
+  {
+    CDC_Machine.req_pending |= CDC_PENDING_LINE_STATE;
+  }
+}
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -58,7 +58,9 @@
   * @{
   */ 
 
-#define HID_MIN_POLL          10
+#ifndef HID_MIN_POLL
+ #define HID_MIN_POLL          10
+#endif
 
 /* States for HID State Machine */
 typedef enum
@@ -163,6 +165,7 @@ HID_Machine_TypeDef;
   * @{
   */ 
 extern USBH_Class_cb_TypeDef  HID_cb;
+extern HID_Machine_TypeDef    HID_Machine;
 /**
   * @}
   */ 
@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file    usbh_hid_parser.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   This file contains all the prototypes for the usbh_hid_parser.c
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive  ----------------------------------------------*/
+#ifndef __USBH_HID_PARSER_H
+#define __USBH_HID_PARSER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbh_hid_core.h"
+
+/** @addtogroup USBH_LIB
+  * @{
+  */
+
+/** @addtogroup USBH_CLASS
+  * @{
+  */
+
+/** @addtogroup USBH_HID_CLASS
+  * @{
+  */
+
+/** @defgroup USBH_HID_PARSER
+  * @brief This file is the Header file for USBH_HID_PARSER.c
+  * @{
+  */
+
+
+/** @defgroup USBH_HID_PARSER_Exported_Defines
+  * @{
+  */
+
+/* Input fields kept from the report descriptor */
+#ifndef USBH_HID_MAX_FIELDS
+ #define USBH_HID_MAX_FIELDS              32
+#endif
+
+/* Report IDs whose layout is tracked */
+#ifndef USBH_HID_MAX_REPORTS
+ #define USBH_HID_MAX_REPORTS             4
+#endif
+
+/* Usages of one main item kept from the local items */
+#ifndef USBH_HID_MAX_USAGES
+ #define USBH_HID_MAX_USAGES              16
+#endif
+
+/* HID_Field_TypeDef flags */
+#define HID_FIELD_SIGNED                  0x01  /* Logical minimum < 0 */
+#define HID_FIELD_ARRAY                   0x02  /* Value is a usage index */
+#define HID_FIELD_RELATIVE                0x04
+
+/* Usage pages */
+#define HID_USAGE_PAGE_GEN_DESKTOP        0x01
+#define HID_USAGE_PAGE_SIMULATION         0x02
+#define HID_USAGE_PAGE_KEYBOARD           0x07
+#define HID_USAGE_PAGE_BUTTON             0x09
+
+/* Generic Desktop usages */
+#define HID_USAGE_X                       0x30
+#define HID_USAGE_Y                       0x31
+#define HID_USAGE_Z                       0x32
+#define HID_USAGE_RX                      0x33
+#define HID_USAGE_RY                      0x34
+#define HID_USAGE_RZ                      0x35
+#define HID_USAGE_SLIDER                  0x36
+#define HID_USAGE_DIAL                    0x37
+#define HID_USAGE_WHEEL                   0x38
+#define HID_USAGE_HAT_SWITCH              0x39
+/**
+  * @}
+  */
+
+
+/** @defgroup USBH_HID_PARSER_Exported_Types
+  * @{
+  */
+
+/* One input value, compiled from the report descriptor */
+typedef struct _HID_Field
+{
+  uint16_t             byte;          /* First byte, after the report ID */
+  uint8_t              shift;         /* Bit of the value in that byte */
+  uint8_t              size;          /* Bits, 1 to 32 */
+  uint8_t              nbytes;        /* Bytes spanned by the value */
+  uint8_t              report_id;     /* 0 if the device uses no IDs */
+  uint8_t              flags;
+  uint16_t             usage_page;
+  uint16_t             usage;         /* First usage for an array */
+  int32_t              log_min;
+  int32_t              log_max;
+}
+HID_Field_TypeDef;
+
+typedef struct _HID_ReportMap
+{
+  HID_Field_TypeDef    field[USBH_HID_MAX_FIELDS];
+  uint8_t              num_fields;
+  uint8_t              has_id;        /* Reports start with their ID */
+  uint8_t              truncated;     /* Fields left out for lack of room */
+}
+HID_ReportMap_TypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HID_PARSER_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HID_PARSER_Exported_Variables
+  * @{
+  */
+
+extern HID_cb_TypeDef          HID_GENERIC_cb;
+extern HID_ReportMap_TypeDef   HID_ReportMap;
+extern int32_t                 HID_Values[USBH_HID_MAX_FIELDS];
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HID_PARSER_Exported_FunctionsPrototype
+  * @{
+  */
+uint8_t  HID_ParseReportDesc (HID_ReportMap_TypeDef *map,
+                              const uint8_t *desc,
+                              uint16_t length);
+uint8_t  HID_DecodeReport    (const HID_ReportMap_TypeDef *map,
+                              const uint8_t *report,
+                              uint16_t length,
+                              int32_t *values);
+void  USR_HID_GENERIC_Init (void);
+void  USR_HID_GENERIC_ProcessData (HID_ReportMap_TypeDef *map,
+                                   int32_t *values,
+                                   uint8_t report_id);
+/**
+  * @}
+  */
+
+#endif /* __USBH_HID_PARSER_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
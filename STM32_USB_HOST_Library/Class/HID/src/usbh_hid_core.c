@@ -43,6 +43,9 @@
 #include "usbh_hid_core.h"
 #include "usbh_hid_mouse.h"
 #include "usbh_hid_keybd.h"
+#ifdef USBH_HID_PARSER_ENABLED
+#include "usbh_hid_parser.h"
+#endif
 
 /** @addtogroup USBH_LIB
 * @{
@@ -117,6 +120,17 @@ __ALIGN_BEGIN USB_Setup_TypeDef          HID_Setup __ALIGN_END ;
 __ALIGN_BEGIN USBH_HIDDesc_TypeDef       HID_Desc __ALIGN_END ; 
 
 __IO uint8_t start_toggle = 0;
+
+#ifdef USBH_HC_POOL_ENABLED
+/* Interrupt channels kept for HID across re-plugs */
+static uint32_t HID_HC_Pool = 0;
+#endif
+
+#ifdef USBH_CTL_PIPELINE_ENABLED
+/* Report descriptor, SET_IDLE and SET_PROTOCOL sent back-to-back */
+static USBH_CtlBatch_TypeDef HID_CtlBatch[3];
+static uint8_t HID_CtlCount = 0;
+#endif
 /**
 * @}
 */ 
@@ -157,6 +171,11 @@ static USBH_Status USBH_Set_Protocol (USB_OTG_CORE_HANDLE *pdev,
                                       USBH_HOST *phost,
                                       uint8_t protocol);
 
+#ifdef USBH_CTL_PIPELINE_ENABLED
+static USBH_Status USBH_HID_BatchRequests (USB_OTG_CORE_HANDLE *pdev, 
+                                           USBH_HOST *phost);
+#endif
+
 
 USBH_Class_cb_TypeDef  HID_cb = 
 {
@@ -192,9 +211,24 @@ static USBH_Status USBH_HID_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
   HID_Machine.state = HID_ERROR;
   
   
+#ifdef USBH_HID_PARSER_ENABLED
+  /* Any HID interface: the reports are decoded through the fields compiled
+     from the report descriptor, the boot keyboard and mouse keep their
+     boot protocol decoders */
+  HID_Machine.cb = &HID_GENERIC_cb;
+  if(pphost->device_prop.Itf_Desc[0].bInterfaceClass == USB_HID_CLASS)
+#else
   if(pphost->device_prop.Itf_Desc[0].bInterfaceSubClass  == HID_BOOT_CODE)
+#endif
   {
     /*Decode Bootclass Protocl: Mouse or Keyboard*/
+#ifdef USBH_HID_PARSER_ENABLED
+    if(pphost->device_prop.Itf_Desc[0].bInterfaceSubClass != HID_BOOT_CODE)
+    {
+      /* Report protocol device: HID_GENERIC_cb */
+    }
+    else
+#endif
     if(pphost->device_prop.Itf_Desc[0].bInterfaceProtocol == HID_KEYBRD_BOOT_CODE)
     {
       HID_Machine.cb = &HID_KEYBRD_cb;
@@ -230,9 +264,16 @@ static USBH_Status USBH_HID_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
       if(pphost->device_prop.Ep_Desc[0][num].bEndpointAddress & 0x80)
       {
         HID_Machine.HIDIntInEp = (pphost->device_prop.Ep_Desc[0][num].bEndpointAddress);
+#ifdef USBH_HC_POOL_ENABLED
+        USBH_Reserve_Channels(pdev, &HID_HC_Pool, maxEP);
+        HID_Machine.hc_num_in  =\
+               USBH_Alloc_PoolChannel(pdev, &HID_HC_Pool,
+                                      pphost->device_prop.Ep_Desc[0][num].bEndpointAddress);
+#else
         HID_Machine.hc_num_in  =\
                USBH_Alloc_Channel(pdev, 
                                   pphost->device_prop.Ep_Desc[0][num].bEndpointAddress);
+#endif
         
         /* Open channel for IN endpoint */
         USBH_Open_Channel  (pdev,
@@ -241,13 +282,24 @@ static USBH_Status USBH_HID_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
                             pphost->device_prop.speed,
                             EP_TYPE_INTR,
                             HID_Machine.length); 
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+        /* Keep the reports on time when bulk pipes share the port */
+        HCD_Sched_Reserve(pdev, HID_Machine.hc_num_in, HID_Machine.poll);
+#endif
       }
       else
       {
         HID_Machine.HIDIntOutEp = (pphost->device_prop.Ep_Desc[0][num].bEndpointAddress);
+#ifdef USBH_HC_POOL_ENABLED
+        USBH_Reserve_Channels(pdev, &HID_HC_Pool, maxEP);
+        HID_Machine.hc_num_out  =\
+                USBH_Alloc_PoolChannel(pdev, &HID_HC_Pool,
+                                       pphost->device_prop.Ep_Desc[0][num].bEndpointAddress);
+#else
         HID_Machine.hc_num_out  =\
                 USBH_Alloc_Channel(pdev, 
                                    pphost->device_prop.Ep_Desc[0][num].bEndpointAddress);
+#endif
         
         /* Open channel for OUT endpoint */
         USBH_Open_Channel  (pdev,
@@ -289,6 +341,9 @@ void USBH_HID_InterfaceDeInit ( USB_OTG_CORE_HANDLE *pdev,
   if(HID_Machine.hc_num_in != 0x00)
   {   
     USB_OTG_HC_Halt(pdev, HID_Machine.hc_num_in);
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+    HCD_Sched_Release(pdev, HID_Machine.hc_num_in);
+#endif
     USBH_Free_Channel  (pdev, HID_Machine.hc_num_in);
     HID_Machine.hc_num_in = 0;     /* Reset the Channel as Free */  
   }
@@ -339,9 +394,28 @@ static USBH_Status USBH_HID_ClassRequest(USB_OTG_CORE_HANDLE *pdev ,
     
     
     /* Get Report Desc */ 
+#ifdef USBH_CTL_PIPELINE_ENABLED
+    /* With SET_IDLE and SET_PROTOCOL, see USBH_HID_BatchRequests */
+    if (USBH_HID_BatchRequests(pdev, pphost) == USBH_OK)
+#else
     if (USBH_Get_HID_ReportDescriptor(pdev , pphost, HID_Desc.wItemLength) == USBH_OK)
+#endif
     {
+#ifdef USBH_HID_PARSER_ENABLED
+      if (HID_Machine.cb == &HID_GENERIC_cb)
+      {
+        HID_ParseReportDesc(&HID_ReportMap, pdev->host.Rx_Buffer,
+                            (HID_Desc.wItemLength < MAX_DATA_LENGTH) ?
+                              HID_Desc.wItemLength : MAX_DATA_LENGTH);
+      }
+#endif
+#ifdef USBH_CTL_PIPELINE_ENABLED
+      /* all requests performed*/
+      HID_Machine.ctl_state = HID_REQ_IDLE;
+      status = USBH_OK;
+#else
       HID_Machine.ctl_state = HID_REQ_SET_IDLE;
+#endif
     }
     
     break;
@@ -359,6 +433,16 @@ static USBH_Status USBH_HID_ClassRequest(USB_OTG_CORE_HANDLE *pdev ,
     {
       HID_Machine.ctl_state = HID_REQ_SET_PROTOCOL;        
     } 
+#ifdef USBH_HID_PARSER_ENABLED
+    /* SET_PROTOCOL is for boot devices only, the others send reports as
+       described */
+    if ((HID_Machine.ctl_state == HID_REQ_SET_PROTOCOL) &&
+        (HID_Machine.cb == &HID_GENERIC_cb))
+    {
+      HID_Machine.ctl_state = HID_REQ_IDLE;
+      status = USBH_OK;
+    }
+#endif
     break; 
     
   case HID_REQ_SET_PROTOCOL:
@@ -545,6 +629,77 @@ static USBH_Status USBH_Set_Idle (USB_OTG_CORE_HANDLE *pdev,
 }
 
 
+#ifdef USBH_CTL_PIPELINE_ENABLED
+/**
+* @brief  USBH_HID_BatchRequests
+*         Issue the Get Report Descriptor, Set Idle and Set Protocol requests
+*         back-to-back. A stalled Set Idle is accepted, the batch is sent
+*         again when another request did not complete.
+* @param  pdev: Selected device
+* @retval USBH_Status : USBH_OK once the requests completed, else USBH_BUSY
+*/
+static USBH_Status USBH_HID_BatchRequests (USB_OTG_CORE_HANDLE *pdev, 
+                                           USBH_HOST *phost)
+{
+  USB_Setup_TypeDef *setup;
+  
+  if (phost->RequestState == CMD_SEND)
+  {
+    /* Report descriptor, in pdev->host.Rx_Buffer */
+    setup = &HID_CtlBatch[0].setup;
+    setup->b.bmRequestType = USB_D2H | USB_REQ_RECIPIENT_INTERFACE |\
+      USB_REQ_TYPE_STANDARD;
+    setup->b.bRequest = USB_REQ_GET_DESCRIPTOR;
+    setup->b.wValue.w = USB_DESC_HID_REPORT;
+    setup->b.wIndex.w = 0;
+    setup->b.wLength.w = HID_Desc.wItemLength;
+    HID_CtlBatch[0].buff = pdev->host.Rx_Buffer;
+    
+    /* Set Idle, no duration, all reports */
+    setup = &HID_CtlBatch[1].setup;
+    setup->b.bmRequestType = USB_H2D | USB_REQ_RECIPIENT_INTERFACE |\
+      USB_REQ_TYPE_CLASS;
+    setup->b.bRequest = USB_HID_SET_IDLE;
+    setup->b.wValue.w = 0;
+    setup->b.wIndex.w = 0;
+    setup->b.wLength.w = 0;
+    HID_CtlBatch[1].buff = 0;
+    
+    /* Set Protocol as USBH_Set_Protocol(pdev, phost, 0) */
+    setup = &HID_CtlBatch[2].setup;
+    setup->b.bmRequestType = USB_H2D | USB_REQ_RECIPIENT_INTERFACE |\
+      USB_REQ_TYPE_CLASS;
+    setup->b.bRequest = USB_HID_SET_PROTOCOL;
+    setup->b.wValue.w = 1;
+    setup->b.wIndex.w = 0;
+    setup->b.wLength.w = 0;
+    HID_CtlBatch[2].buff = 0;
+    
+    HID_CtlCount = 3;
+#ifdef USBH_HID_PARSER_ENABLED
+    /* SET_PROTOCOL is for boot devices only */
+    if (HID_Machine.cb == &HID_GENERIC_cb)
+    {
+      HID_CtlCount = 2;
+    }
+#endif
+  }
+  
+  if (USBH_CtlReqBatch(pdev, phost, HID_CtlBatch, HID_CtlCount) == USBH_BUSY)
+  {
+    return USBH_BUSY;
+  }
+  
+  if ((HID_CtlBatch[0].status != USBH_OK) ||
+      ((HID_CtlCount == 3) && (HID_CtlBatch[2].status != USBH_OK)))
+  {
+    /* Sent again on the next call */
+    return USBH_BUSY;
+  }
+  return USBH_OK;
+}
+#endif
+
 /**
 * @brief  USBH_Set_Report
 *         Issues Set Report 
@@ -0,0 +1,582 @@
+/**
+  ******************************************************************************
+  * @file    usbh_hid_parser.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   This file is the HID report descriptor parser: the input items
+  *          are compiled once into a field table so that a report is decoded
+  *          by a walk over the table
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbh_hid_parser.h"
+#include <string.h>
+
+#ifndef USBH_HID_PARSER_ENABLED
+ #error "usbh_hid_parser.c needs USBH_HID_PARSER_ENABLED in usbh_conf.h"
+#endif
+
+/** @addtogroup USBH_LIB
+  * @{
+  */
+
+/** @addtogroup USBH_CLASS
+  * @{
+  */
+
+/** @addtogroup USBH_HID_CLASS
+  * @{
+  */
+
+/** @defgroup USBH_HID_PARSER
+  * @brief    This file includes the HID report descriptor parser.
+  * @{
+  */
+
+/** @defgroup USBH_HID_PARSER_Private_TypesDefinitions
+  * @{
+  */
+
+/* Global items, saved by PUSH */
+typedef struct _HID_Globals
+{
+  uint16_t             usage_page;
+  int32_t              log_min;
+  int32_t              log_max;
+  uint32_t             report_size;
+  uint32_t             report_count;
+  uint8_t              report_id;
+}
+HID_Globals_TypeDef;
+
+/* Local items of the next main item, usages with their page (page << 16) */
+typedef struct _HID_Locals
+{
+  uint32_t             usage[USBH_HID_MAX_USAGES];
+  uint8_t              num_usage;
+  uint32_t             usage_min;
+  uint32_t             usage_max;
+  uint8_t              has_range;
+}
+HID_Locals_TypeDef;
+
+/* Input bits already laid out in a report */
+typedef struct _HID_ReportBits
+{
+  uint8_t              id;
+  uint16_t             bits;
+}
+HID_ReportBits_TypeDef;
+/**
+  * @}
+  */
+
+
+/** @defgroup USBH_HID_PARSER_Private_Defines
+  * @{
+  */
+
+/* Item types */
+#define HID_ITEM_TYPE_MAIN                0
+#define HID_ITEM_TYPE_GLOBAL              1
+#define HID_ITEM_TYPE_LOCAL               2
+
+#define HID_ITEM_LONG                     0xFE
+
+/* Main items */
+#define HID_MAIN_INPUT                    0x08
+#define HID_MAIN_OUTPUT                   0x09
+#define HID_MAIN_COLLECTION               0x0A
+#define HID_MAIN_FEATURE                  0x0B
+#define HID_MAIN_END_COLLECTION           0x0C
+
+/* Global items */
+#define HID_GLOBAL_USAGE_PAGE             0x00
+#define HID_GLOBAL_LOG_MIN                0x01
+#define HID_GLOBAL_LOG_MAX                0x02
+#define HID_GLOBAL_REPORT_SIZE            0x07
+#define HID_GLOBAL_REPORT_ID              0x08
+#define HID_GLOBAL_REPORT_COUNT           0x09
+#define HID_GLOBAL_PUSH                   0x0A
+#define HID_GLOBAL_POP                    0x0B
+
+/* Local items */
+#define HID_LOCAL_USAGE                   0x00
+#define HID_LOCAL_USAGE_MIN               0x01
+#define HID_LOCAL_USAGE_MAX               0x02
+
+/* Input item data */
+#define HID_INPUT_CONSTANT                0x01
+#define HID_INPUT_VARIABLE                0x02
+#define HID_INPUT_RELATIVE                0x04
+
+/* Depth of the PUSH/POP stack */
+#define HID_GLOBAL_STACK                  2
+/**
+  * @}
+  */
+
+
+/** @defgroup USBH_HID_PARSER_Private_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HID_PARSER_Private_FunctionPrototypes
+  * @{
+  */
+static void  HID_GENERIC_Init (void);
+static void  HID_GENERIC_Decode (uint8_t *data);
+static void  HID_AddInput (HID_ReportMap_TypeDef *map,
+                           HID_ReportBits_TypeDef *report,
+                           const HID_Globals_TypeDef *glob,
+                           const HID_Locals_TypeDef *loc,
+                           uint32_t data);
+/**
+  * @}
+  */
+
+
+/** @defgroup USBH_HID_PARSER_Private_Variables
+  * @{
+  */
+HID_ReportMap_TypeDef HID_ReportMap;
+int32_t HID_Values[USBH_HID_MAX_FIELDS];
+
+HID_cb_TypeDef HID_GENERIC_cb =
+{
+  HID_GENERIC_Init,
+  HID_GENERIC_Decode,
+};
+/**
+  * @}
+  */
+
+
+/** @defgroup USBH_HID_PARSER_Private_Functions
+  * @{
+  */
+
+/**
+* @brief  HID_ParseReportDesc
+*         Compile the input items of a report descriptor into a field table,
+*         one field per value of each report
+* @param  map : Field table to fill
+* @param  desc : Report descriptor
+* @param  length : Report descriptor length
+* @retval Number of fields
+*/
+uint8_t HID_ParseReportDesc (HID_ReportMap_TypeDef *map,
+                             const uint8_t *desc,
+                             uint16_t length)
+{
+  HID_Globals_TypeDef    glob;
+  HID_Globals_TypeDef    stack[HID_GLOBAL_STACK];
+  HID_Locals_TypeDef     loc;
+  HID_ReportBits_TypeDef report[USBH_HID_MAX_REPORTS];
+  uint8_t                num_report = 0;
+  uint8_t                depth = 0;
+  uint8_t                prefix, size, type, tag, i;
+  uint32_t               udata;
+  int32_t                sdata;
+  uint16_t               pos = 0;
+
+  map->num_fields = 0;
+  map->has_id = 0;
+  map->truncated = 0;
+  memset(&glob, 0, sizeof(glob));
+  memset(&loc, 0, sizeof(loc));
+
+  while (pos < length)
+  {
+    prefix = desc[pos++];
+
+    if (prefix == HID_ITEM_LONG)
+    {
+      /* Long items (none defined yet): bDataSize, bLongItemTag, data */
+      if (pos >= length)
+      {
+        break;
+      }
+      pos += 2 + desc[pos];
+      continue;
+    }
+
+    size = prefix & 0x03;
+    if (size == 3)
+    {
+      size = 4;
+    }
+    if ((pos + size) > length)
+    {
+      break;
+    }
+
+    udata = 0;
+    for (i = 0; i < size; i++)
+    {
+      udata |= (uint32_t)desc[pos + i] << (8 * i);
+    }
+    pos += size;
+
+    switch (size)
+    {
+    case 1:
+      sdata = (int8_t)udata;
+      break;
+    case 2:
+      sdata = (int16_t)udata;
+      break;
+    default:
+      sdata = (int32_t)udata;
+      break;
+    }
+
+    type = (prefix >> 2) & 0x03;
+    tag  = prefix >> 4;
+
+    switch (type)
+    {
+    case HID_ITEM_TYPE_MAIN:
+      if (tag == HID_MAIN_INPUT)
+      {
+        /* Bits are laid out per report ID */
+        for (i = 0; i < num_report; i++)
+        {
+          if (report[i].id == glob.report_id)
+          {
+            break;
+          }
+        }
+        if (i == num_report)
+        {
+          if (num_report < USBH_HID_MAX_REPORTS)
+          {
+            report[i].id = glob.report_id;
+            report[i].bits = 0;
+            num_report++;
+          }
+          else
+          {
+            map->truncated = 1;
+          }
+        }
+        if (i < num_report)
+        {
+          HID_AddInput(map, &report[i], &glob, &loc, udata);
+        }
+      }
+      /* Output, feature and collection items only end the local items */
+      memset(&loc, 0, sizeof(loc));
+      break;
+
+    case HID_ITEM_TYPE_GLOBAL:
+      switch (tag)
+      {
+      case HID_GLOBAL_USAGE_PAGE:
+        glob.usage_page = (uint16_t)udata;
+        break;
+      case HID_GLOBAL_LOG_MIN:
+        glob.log_min = sdata;
+        break;
+      case HID_GLOBAL_LOG_MAX:
+        /* Some devices give 0..255 as 0x00..0xFF on one byte */
+        glob.log_max = ((glob.log_min >= 0) && (sdata < 0)) ? (int32_t)udata : sdata;
+        break;
+      case HID_GLOBAL_REPORT_SIZE:
+        glob.report_size = udata;
+        break;
+      case HID_GLOBAL_REPORT_ID:
+        glob.report_id = (uint8_t)udata;
+        map->has_id = 1;
+        break;
+      case HID_GLOBAL_REPORT_COUNT:
+        glob.report_count = udata;
+        break;
+      case HID_GLOBAL_PUSH:
+        if (depth < HID_GLOBAL_STACK)
+        {
+          stack[depth++] = glob;
+        }
+        break;
+      case HID_GLOBAL_POP:
+        if (depth > 0)
+        {
+          glob = stack[--depth];
+        }
+        break;
+      default:
+        /* Physical range and units do not change the layout */
+        break;
+      }
+      break;
+
+    case HID_ITEM_TYPE_LOCAL:
+      switch (tag)
+      {
+      case HID_LOCAL_USAGE:
+      case HID_LOCAL_USAGE_MIN:
+      case HID_LOCAL_USAGE_MAX:
+        /* Extended (4 byte) usages carry their page */
+        if (size != 4)
+        {
+          udata |= (uint32_t)glob.usage_page << 16;
+        }
+        if (tag == HID_LOCAL_USAGE)
+        {
+          if (loc.num_usage < USBH_HID_MAX_USAGES)
+          {
+            loc.usage[loc.num_usage++] = udata;
+          }
+        }
+        else
+        {
+          if (tag == HID_LOCAL_USAGE_MIN)
+          {
+            loc.usage_min = udata;
+          }
+          else
+          {
+            loc.usage_max = udata;
+          }
+          loc.has_range = 1;
+        }
+        break;
+      default:
+        break;
+      }
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  return map->num_fields;
+}
+
+/**
+* @brief  HID_DecodeReport
+*         Extract the values of a report through the field table: values[n]
+*         is updated for each field n of the report ID received
+* @param  map : Field table from HID_ParseReportDesc
+* @param  report : Report, with its ID first if the device uses IDs
+* @param  length : Report length
+* @param  values : One value per field of the table
+* @retval Number of values updated
+*/
+uint8_t HID_DecodeReport (const HID_ReportMap_TypeDef *map,
+                          const uint8_t *report,
+                          uint16_t length,
+                          int32_t *values)
+{
+  const HID_Field_TypeDef *f = map->field;
+  const uint8_t *data = report;
+  uint8_t  id = 0;
+  uint8_t  i, n;
+  uint8_t  count = 0;
+  uint32_t v, mask;
+
+  if (map->has_id)
+  {
+    if (length == 0)
+    {
+      return 0;
+    }
+    id = *data++;
+    length--;
+  }
+
+  for (i = 0; i < map->num_fields; i++, f++)
+  {
+    if ((f->report_id != id) || ((f->byte + f->nbytes) > length))
+    {
+      continue;
+    }
+
+    v = 0;
+    for (n = 0; (n < f->nbytes) && (n < 4); n++)
+    {
+      v |= (uint32_t)data[f->byte + n] << (8 * n);
+    }
+    v >>= f->shift;
+    if (f->nbytes > 4)
+    {
+      v |= (uint32_t)data[f->byte + 4] << (32 - f->shift);
+    }
+
+    if (f->size < 32)
+    {
+      mask = (1UL << f->size) - 1;
+      v &= mask;
+      if ((f->flags & HID_FIELD_SIGNED) && (v & (1UL << (f->size - 1))))
+      {
+        v |= ~mask;
+      }
+    }
+
+    values[i] = (int32_t)v;
+    count++;
+  }
+
+  return count;
+}
+
+/**
+* @brief  HID_AddInput
+*         Add the fields of an input item to the table
+* @param  map : Field table
+* @param  report : Bits laid out in the report of the item
+* @param  glob : Global items
+* @param  loc : Local items
+* @param  data : Input item data
+* @retval None
+*/
+static void HID_AddInput (HID_ReportMap_TypeDef *map,
+                          HID_ReportBits_TypeDef *report,
+                          const HID_Globals_TypeDef *glob,
+                          const HID_Locals_TypeDef *loc,
+                          uint32_t data)
+{
+  HID_Field_TypeDef *f;
+  uint32_t usage;
+  uint32_t i;
+
+  for (i = 0; i < glob->report_count; i++)
+  {
+    if (!(data & HID_INPUT_CONSTANT) &&
+        (glob->report_size > 0) && (glob->report_size <= 32))
+    {
+      if (map->num_fields == USBH_HID_MAX_FIELDS)
+      {
+        map->truncated = 1;
+      }
+      else
+      {
+        f = &map->field[map->num_fields++];
+        f->byte   = report->bits >> 3;
+        f->shift  = report->bits & 0x07;
+        f->size   = (uint8_t)glob->report_size;
+        f->nbytes = (f->shift + f->size + 7) >> 3;
+        f->report_id = glob->report_id;
+        f->log_min = glob->log_min;
+        f->log_max = glob->log_max;
+        f->flags = 0;
+        if (glob->log_min < 0)
+        {
+          f->flags |= HID_FIELD_SIGNED;
+        }
+        if (data & HID_INPUT_RELATIVE)
+        {
+          f->flags |= HID_FIELD_RELATIVE;
+        }
+
+        /* A variable gets the i-th usage, an array its first usage */
+        if (!(data & HID_INPUT_VARIABLE))
+        {
+          f->flags |= HID_FIELD_ARRAY;
+          usage = loc->has_range ? loc->usage_min :
+            ((loc->num_usage != 0) ? loc->usage[0] : 0);
+        }
+        else if (loc->has_range)
+        {
+          usage = loc->usage_min + i;
+          if (usage > loc->usage_max)
+          {
+            usage = loc->usage_max;
+          }
+        }
+        else if (loc->num_usage != 0)
+        {
+          usage = loc->usage[(i < loc->num_usage) ? i : (loc->num_usage - 1)];
+        }
+        else
+        {
+          usage = (uint32_t)glob->usage_page << 16;
+        }
+        f->usage_page = (uint16_t)(usage >> 16);
+        f->usage = (uint16_t)usage;
+      }
+    }
+    report->bits += glob->report_size;
+  }
+}
+
+/**
+* @brief  HID_GENERIC_Init
+*         Init the generic HID device.
+* @param  None
+* @retval None
+*/
+static void  HID_GENERIC_Init (void)
+{
+  memset(HID_Values, 0, sizeof(HID_Values));
+
+  /* Call User Init*/
+  USR_HID_GENERIC_Init();
+}
+
+/**
+* @brief  HID_GENERIC_Decode
+*         Decode a report through the table compiled at enumeration
+* @param  data : Pointer to the HID report
+* @retval None
+*/
+static void  HID_GENERIC_Decode (uint8_t *data)
+{
+  uint16_t length = HID_Machine.length;
+
+  if (length > sizeof(HID_Machine.buff))
+  {
+    length = sizeof(HID_Machine.buff);
+  }
+
+  if (HID_DecodeReport(&HID_ReportMap, data, length, HID_Values) != 0)
+  {
+    USR_HID_GENERIC_ProcessData(&HID_ReportMap, HID_Values,
+                                HID_ReportMap.has_id ? data[0] : 0);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
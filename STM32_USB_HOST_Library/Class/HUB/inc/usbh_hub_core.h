@@ -0,0 +1,226 @@
+/**
+  ******************************************************************************
+  * @file    usbh_hub_core.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   This file contains all the prototypes for the usbh_hub_core.c
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive  ----------------------------------------------*/
+#ifndef __USBH_HUB_CORE_H
+#define __USBH_HUB_CORE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbh_core.h"
+#include "usbh_stdreq.h"
+#include "usb_bsp.h"
+#include "usbh_ioreq.h"
+#include "usbh_hcs.h"
+
+/** @addtogroup USBH_LIB
+  * @{
+  */
+
+/** @addtogroup USBH_CLASS
+  * @{
+  */
+
+/** @addtogroup USBH_HUB_CLASS
+  * @{
+  */
+
+/** @defgroup USBH_HUB_CORE
+  * @brief This file is the Header file for USBH_HUB_CORE.c
+  * @{
+  */
+
+
+/** @defgroup USBH_HUB_CORE_Exported_Defines
+  * @{
+  */
+
+#define HUB_CLASS                         0x09
+
+/* Devices served behind the hub, one USBH_HOST each */
+#ifndef USBH_HUB_MAX_PORTS
+ #define USBH_HUB_MAX_PORTS               4
+#endif
+
+#if (USBH_HUB_MAX_PORTS > 15)
+ #error "USBH_HUB_MAX_PORTS: the port change bitmap holds 15 at most"
+#endif
+
+/* Class drivers registered with USBH_HUB_RegisterClass */
+#ifndef USBH_HUB_MAX_CLASS
+ #define USBH_HUB_MAX_CLASS               4
+#endif
+
+#define HUB_MIN_POLL                      10
+#define HUB_DEBOUNCE_TIME                 100   /* ms, connection stable */
+#define HUB_RESET_TIMEOUT                 500   /* ms, port reset done */
+#define HUB_RESET_RECOVERY                10    /* ms, before SET_ADDRESS */
+
+#define USB_DESC_TYPE_HUB                 0x29
+#define USB_DESC_HUB                      ((USB_DESC_TYPE_HUB << 8) & 0xFF00)
+#define USB_HUB_DESC_SIZE                 9
+
+/* Port features */
+#define HUB_FEAT_PORT_RESET               4
+#define HUB_FEAT_PORT_POWER               8
+#define HUB_FEAT_C_PORT_CONNECTION        16
+
+/* wPortStatus */
+#define HUB_PORT_STS_CONNECTION           0x0001
+#define HUB_PORT_STS_ENABLE               0x0002
+#define HUB_PORT_STS_OVER_CURRENT         0x0008
+#define HUB_PORT_STS_RESET                0x0010
+#define HUB_PORT_STS_LOW_SPEED            0x0200
+#define HUB_PORT_STS_HIGH_SPEED           0x0400
+
+/* wPortChange: bit n cleared with feature HUB_FEAT_C_PORT_CONNECTION + n */
+#define HUB_PORT_CHG_CONNECTION           0x0001
+#define HUB_PORT_CHG_MASK                 0x001F
+/**
+  * @}
+  */
+
+
+/** @defgroup USBH_HUB_CORE_Exported_Types
+  * @{
+  */
+
+/* States for HUB State Machine */
+typedef enum
+{
+  HUB_IDLE= 0,
+  HUB_GET_DATA,
+  HUB_POLL,
+  HUB_PORT_STATUS,
+  HUB_PORT_CLEAR,
+  HUB_PORT_RESET,
+}
+HUB_State;
+
+typedef enum
+{
+  HUB_REQ_IDLE = 0,
+  HUB_REQ_GET_HUB_DESC,
+  HUB_REQ_SET_PORT_POWER,
+  HUB_REQ_POWER_WAIT,
+}
+HUB_CtlState;
+
+/* States of a downstream port */
+typedef enum
+{
+  HUB_PORT_IDLE = 0,          /* Nothing connected */
+  HUB_PORT_DEBOUNCE,          /* Connected, waiting for it to be stable */
+  HUB_PORT_WAIT_LOCK,         /* Waiting for the address 0 device slot */
+  HUB_PORT_RESET_PENDING,     /* SetPortFeature(PORT_RESET) to be sent */
+  HUB_PORT_RESET_WAIT,        /* Waiting for C_PORT_RESET */
+  HUB_PORT_RECOVERY,          /* Reset recovery time */
+  HUB_PORT_ENABLED,           /* Device served by its USBH_HOST */
+  HUB_PORT_DISABLED,          /* Not served until disconnected */
+}
+HUB_PortState;
+
+typedef struct _HUB_Port
+{
+  HUB_PortState        state;
+  uint16_t             status;        /* Last wPortStatus */
+  uint16_t             timer;
+  USBH_HOST            host;          /* Host state of the device */
+}
+HUB_Port_TypeDef;
+
+/* Structure for HUB process */
+typedef struct _HUB_Process
+{
+  uint8_t              buff[8];       /* Status change bitmap */
+  uint8_t              ctl_buff[USB_HUB_DESC_SIZE + 3];
+  uint8_t              hc_num_in;
+  HUB_State            state;
+  HUB_CtlState         ctl_state;
+  uint8_t              ep_addr;
+  uint16_t             length;
+  uint16_t             poll;
+  __IO uint16_t        timer;
+  uint8_t              num_ports;
+  uint8_t              hs;            /* HS hub: split for FS/LS ports */
+  uint16_t             pwr_good;      /* ms */
+  uint8_t              port_num;      /* Port of the pending request */
+  uint16_t             port_change;   /* wPortChange not cleared yet */
+  uint16_t             changed;       /* Bit n: port n to be read */
+  uint8_t              lock;          /* Port owning address 0, 0 if none */
+  HUB_Port_TypeDef     port[USBH_HUB_MAX_PORTS];
+}
+HUB_Machine_TypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HUB_CORE_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HUB_CORE_Exported_Variables
+  * @{
+  */
+extern USBH_Class_cb_TypeDef  USBH_HUB_cb;
+extern HUB_Machine_TypeDef    HUB_Machine;
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HUB_CORE_Exported_FunctionsPrototype
+  * @{
+  */
+USBH_Status USBH_HUB_RegisterClass (uint8_t itf_class,
+                                    USBH_Class_cb_TypeDef *class_cb);
+void USBH_HUB_Process (USB_OTG_CORE_HANDLE *pdev);
+/**
+  * @}
+  */
+
+
+#endif /* __USBH_HUB_CORE_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,976 @@
+/**
+  ******************************************************************************
+  * @file    usbh_hub_core.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   This file is the HUB Layer Handlers for USB Host HUB class.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                HUB Class  Description
+  *          ===================================================================
+  *           This module manages a hub attached to the root port, following
+  *           chapter 11 of the "Universal Serial Bus Specification Rev 2.0".
+  *           This driver implements the following aspects of the specification:
+  *             - The hub descriptor and the port power switching
+  *             - The status change endpoint and the per-port connect,
+  *               reset and enable sequence
+  *             - One USBH_HOST per downstream device, enumerated one at a
+  *               time on address 0 and then served by the class driver
+  *               registered for its interface class
+  *           Hubs behind the hub are not supported. The devices are run by
+  *           USBH_HUB_Process, to be called next to USBH_Process.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbh_hub_core.h"
+
+#ifndef USBH_HUB_ENABLED
+ #error "usbh_hub_core.c needs USBH_HUB_ENABLED"
+#endif
+
+/** @addtogroup USBH_LIB
+* @{
+*/
+
+/** @addtogroup USBH_CLASS
+* @{
+*/
+
+/** @addtogroup USBH_HUB_CLASS
+* @{
+*/
+
+/** @defgroup USBH_HUB_CORE
+* @brief    This file includes HUB Layer Handlers for USB Host HUB class.
+* @{
+*/
+
+/** @defgroup USBH_HUB_CORE_Private_TypesDefinitions
+* @{
+*/
+/* Class driver for the devices of an interface class, one device at a time */
+typedef struct _HUB_Class
+{
+  uint8_t                  itf_class;
+  USBH_Class_cb_TypeDef    *cb;
+  uint8_t                  port;        /* Port of the device using it */
+}
+HUB_Class_TypeDef;
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Defines
+* @{
+*/
+#define HUB_ROOT_PORT             0xFF  /* HUB_Class[].port of the root device */
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Macros
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Variables
+* @{
+*/
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN HUB_Machine_TypeDef        HUB_Machine __ALIGN_END ;
+
+static HUB_Class_TypeDef HUB_Class[USBH_HUB_MAX_CLASS];
+static USBH_HOST *HUB_Host = 0;
+
+/* Class driver of a device on the root port that is not a hub */
+static USBH_Class_cb_TypeDef *HUB_RootClass = 0;
+
+static __IO uint8_t hub_start_toggle = 0;
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_FunctionPrototypes
+* @{
+*/
+
+static USBH_Status USBH_HUB_InterfaceInit  (USB_OTG_CORE_HANDLE *pdev ,
+                                            void *phost);
+
+static void USBH_HUB_InterfaceDeInit  (USB_OTG_CORE_HANDLE *pdev ,
+                                       void *phost);
+
+static USBH_Status USBH_HUB_Handle(USB_OTG_CORE_HANDLE *pdev ,
+                                   void *phost);
+
+static USBH_Status USBH_HUB_ClassRequest(USB_OTG_CORE_HANDLE *pdev ,
+                                         void *phost);
+
+static USBH_Status USBH_HUB_ChildInit (USB_OTG_CORE_HANDLE *pdev ,
+                                       void *phost);
+
+static void USBH_HUB_ChildDeInit (USB_OTG_CORE_HANDLE *pdev ,
+                                  void *phost);
+
+static USBH_Status USBH_HUB_ChildNop (USB_OTG_CORE_HANDLE *pdev ,
+                                      void *phost);
+
+static USBH_Status USBH_HUB_PortRequest (USB_OTG_CORE_HANDLE *pdev,
+                                         USBH_HOST *phost,
+                                         uint8_t request,
+                                         uint16_t feature,
+                                         uint8_t port);
+
+static uint16_t HUB_Elapsed (USB_OTG_CORE_HANDLE *pdev, uint16_t start);
+
+static void HUB_PortEvent (USB_OTG_CORE_HANDLE *pdev, uint8_t port_num);
+
+static void HUB_PortTimers (USB_OTG_CORE_HANDLE *pdev);
+
+static void HUB_PortStart (USB_OTG_CORE_HANDLE *pdev, uint8_t port_num);
+
+static void HUB_PortStop (USB_OTG_CORE_HANDLE *pdev, uint8_t port_num);
+
+static USBH_Class_cb_TypeDef *HUB_TakeClass (uint8_t itf_class, uint8_t port);
+
+static void HUB_ReleaseClass (uint8_t port);
+
+
+USBH_Class_cb_TypeDef  USBH_HUB_cb =
+{
+  USBH_HUB_InterfaceInit,
+  USBH_HUB_InterfaceDeInit,
+  USBH_HUB_ClassRequest,
+  USBH_HUB_Handle,
+#ifdef USBH_FAST_ENUM_ENABLED
+  0,
+#endif
+};
+
+/* Class of a device behind the hub until its interface class is known:
+   the Init picks the registered class driver and hands over to it */
+static USBH_Class_cb_TypeDef  USBH_HUB_Child_cb =
+{
+  USBH_HUB_ChildInit,
+  USBH_HUB_ChildDeInit,
+  USBH_HUB_ChildNop,
+  USBH_HUB_ChildNop,
+#ifdef USBH_FAST_ENUM_ENABLED
+  1,
+#endif
+};
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Functions
+* @{
+*/
+
+/**
+* @brief  USBH_HUB_InterfaceInit
+*         The function init the HUB class. Another device on the root port
+*         is handed to the class driver registered for it.
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval  USBH_Status :Response for USB HUB driver intialization
+*/
+static USBH_Status USBH_HUB_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
+                                           void *phost)
+{
+  USBH_HOST *pphost = phost;
+  uint8_t i;
+
+  if(pphost->device_prop.Itf_Desc[0].bInterfaceClass != HUB_CLASS)
+  {
+    HUB_RootClass = HUB_TakeClass(pphost->device_prop.Itf_Desc[0].bInterfaceClass,
+                                  HUB_ROOT_PORT);
+    if (HUB_RootClass != 0)
+    {
+      return HUB_RootClass->Init(pdev, phost);
+    }
+    pphost->usr_cb->DeviceNotSupported();
+    return USBH_BUSY;
+  }
+  if((pphost->device_prop.Ep_Desc[0][0].bEndpointAddress & 0x80) == 0)
+  {
+    pphost->usr_cb->DeviceNotSupported();
+    return USBH_BUSY;
+  }
+
+  HUB_Host = pphost;
+  HUB_Machine.state     = HUB_IDLE;
+  HUB_Machine.ctl_state = HUB_REQ_IDLE;
+  HUB_Machine.ep_addr   = pphost->device_prop.Ep_Desc[0][0].bEndpointAddress;
+  HUB_Machine.length    = pphost->device_prop.Ep_Desc[0][0].wMaxPacketSize;
+  HUB_Machine.poll      = pphost->device_prop.Ep_Desc[0][0].bInterval;
+  HUB_Machine.hs        = (pphost->device_prop.speed == HPRT0_PRTSPD_HIGH_SPEED);
+  HUB_Machine.changed   = 0;
+  HUB_Machine.lock      = 0;
+
+  if (HUB_Machine.poll < HUB_MIN_POLL)
+  {
+    HUB_Machine.poll = HUB_MIN_POLL;
+  }
+  if (HUB_Machine.length > sizeof(HUB_Machine.buff))
+  {
+    HUB_Machine.length = sizeof(HUB_Machine.buff);
+  }
+
+  for (i = 0; i < USBH_HUB_MAX_PORTS; i++)
+  {
+    HUB_Machine.port[i].state = HUB_PORT_IDLE;
+    /* No channel yet: USBH_DeInit must not free the ones of the hub */
+    HUB_Machine.port[i].host.Control.hc_num_in = (uint8_t)HC_ERROR;
+    HUB_Machine.port[i].host.Control.hc_num_out = (uint8_t)HC_ERROR;
+    HUB_Machine.port[i].host.Address = 0;
+  }
+
+  HUB_Machine.hc_num_in = USBH_Alloc_Channel(pdev, HUB_Machine.ep_addr);
+
+  /* Open channel for the status change endpoint */
+  USBH_Open_Channel  (pdev,
+                      HUB_Machine.hc_num_in,
+                      pphost->device_prop.address,
+                      pphost->device_prop.speed,
+                      EP_TYPE_INTR,
+                      HUB_Machine.length);
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+  HCD_Sched_Reserve(pdev, HUB_Machine.hc_num_in, HUB_Machine.poll);
+#endif
+
+  hub_start_toggle = 0;
+  return USBH_OK;
+}
+
+
+/**
+* @brief  USBH_HUB_InterfaceDeInit
+*         The function DeInit the hub channel and the devices behind it.
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval None
+*/
+static void USBH_HUB_InterfaceDeInit ( USB_OTG_CORE_HANDLE *pdev,
+                                      void *phost)
+{
+  uint8_t i;
+
+  if (HUB_RootClass != 0)
+  {
+    HUB_RootClass->DeInit(pdev, phost);
+    HUB_ReleaseClass(HUB_ROOT_PORT);
+    HUB_RootClass = 0;
+    return;
+  }
+
+  for (i = 0; i < HUB_Machine.num_ports; i++)
+  {
+    HUB_PortStop(pdev, i + 1);
+  }
+
+  if(HUB_Machine.hc_num_in != 0x00)
+  {
+    USB_OTG_HC_Halt(pdev, HUB_Machine.hc_num_in);
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+    HCD_Sched_Release(pdev, HUB_Machine.hc_num_in);
+#endif
+    USBH_Free_Channel  (pdev, HUB_Machine.hc_num_in);
+    HUB_Machine.hc_num_in = 0;     /* Reset the Channel as Free */
+  }
+
+  HUB_Machine.num_ports = 0;
+  HUB_Host = 0;
+  hub_start_toggle = 0;
+}
+
+/**
+* @brief  USBH_HUB_ClassRequest
+*         The function reads the hub descriptor and powers the ports.
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval  USBH_Status : OK once the ports are powered
+*/
+static USBH_Status USBH_HUB_ClassRequest(USB_OTG_CORE_HANDLE *pdev ,
+                                         void *phost)
+{
+  USBH_HOST *pphost = phost;
+  USBH_Status status = USBH_BUSY;
+
+  if (HUB_RootClass != 0)
+  {
+    return HUB_RootClass->Requests(pdev, phost);
+  }
+
+  switch (HUB_Machine.ctl_state)
+  {
+  case HUB_REQ_IDLE:
+  case HUB_REQ_GET_HUB_DESC:
+    HUB_Machine.ctl_state = HUB_REQ_GET_HUB_DESC;
+    if (USBH_GetDescriptor(pdev,
+                           pphost,
+                           USB_REQ_RECIPIENT_DEVICE | USB_REQ_TYPE_CLASS,
+                           USB_DESC_HUB,
+                           HUB_Machine.ctl_buff,
+                           USB_HUB_DESC_SIZE) == USBH_OK)
+    {
+      HUB_Machine.num_ports = HUB_Machine.ctl_buff[2];
+      if (HUB_Machine.num_ports > USBH_HUB_MAX_PORTS)
+      {
+        HUB_Machine.num_ports = USBH_HUB_MAX_PORTS;
+      }
+      HUB_Machine.pwr_good = HUB_Machine.ctl_buff[5] * 2;
+      HUB_Machine.port_num = 1;
+      HUB_Machine.ctl_state = HUB_REQ_SET_PORT_POWER;
+    }
+    break;
+
+  case HUB_REQ_SET_PORT_POWER:
+    if (HUB_Machine.port_num > HUB_Machine.num_ports)
+    {
+      HUB_Machine.timer = HCD_GetCurrentFrame(pdev);
+      HUB_Machine.ctl_state = HUB_REQ_POWER_WAIT;
+    }
+    else if (USBH_HUB_PortRequest(pdev,
+                                  pphost,
+                                  USB_REQ_SET_FEATURE,
+                                  HUB_FEAT_PORT_POWER,
+                                  HUB_Machine.port_num) == USBH_OK)
+    {
+      HUB_Machine.port_num++;
+    }
+    break;
+
+  case HUB_REQ_POWER_WAIT:
+    if (HUB_Elapsed(pdev, HUB_Machine.timer) >= HUB_Machine.pwr_good)
+    {
+      /* Read every port once: devices present at power up */
+      HUB_Machine.changed = ((1 << (HUB_Machine.num_ports + 1)) - 1) & ~1;
+      HUB_Machine.ctl_state = HUB_REQ_IDLE;
+      status = USBH_OK;
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  return status;
+}
+
+
+/**
+* @brief  USBH_HUB_Handle
+*         The function is for managing state machine for HUB data transfers
+* @param  pdev: Selected device
+* @param  hdev: Selected device property
+* @retval USBH_Status
+*/
+static USBH_Status USBH_HUB_Handle(USB_OTG_CORE_HANDLE *pdev ,
+                                   void   *phost)
+{
+  USBH_HOST *pphost = phost;
+  USBH_Status status = USBH_OK;
+  uint8_t port;
+  uint8_t bit;
+
+  if (HUB_RootClass != 0)
+  {
+    return HUB_RootClass->Machine(pdev, phost);
+  }
+
+  switch (HUB_Machine.state)
+  {
+
+  case HUB_IDLE:
+  case HUB_GET_DATA:
+
+    USBH_InterruptReceiveData(pdev,
+                              HUB_Machine.buff,
+                              HUB_Machine.length,
+                              HUB_Machine.hc_num_in);
+    hub_start_toggle = 1;
+
+    HUB_Machine.state = HUB_POLL;
+    HUB_Machine.timer = HCD_GetCurrentFrame(pdev);
+    break;
+
+  case HUB_POLL:
+    if(HCD_GetURB_State(pdev, HUB_Machine.hc_num_in) == URB_DONE)
+    {
+      if(hub_start_toggle == 1) /* handle data once */
+      {
+        hub_start_toggle = 0;
+        /* Bit 0 is the hub itself, bit n port n */
+        HUB_Machine.changed |= (HUB_Machine.buff[0] | (HUB_Machine.buff[1] << 8)) &
+          (((1 << (HUB_Machine.num_ports + 1)) - 1) & ~1);
+      }
+    }
+    else if(HCD_GetURB_State(pdev, HUB_Machine.hc_num_in) == URB_STALL)
+    {
+      /* Issue Clear Feature on interrupt IN endpoint */
+      if( (USBH_ClrFeature(pdev,
+                           pphost,
+                           HUB_Machine.ep_addr,
+                           HUB_Machine.hc_num_in)) == USBH_OK)
+      {
+        HUB_Machine.state = HUB_GET_DATA;
+      }
+      break;
+    }
+
+    HUB_PortTimers(pdev);
+
+    /* Port status changes first, then the pending port resets */
+    for (port = 1; port <= HUB_Machine.num_ports; port++)
+    {
+      if (HUB_Machine.changed & (1 << port))
+      {
+        HUB_Machine.port_num = port;
+        HUB_Machine.state = HUB_PORT_STATUS;
+        return status;
+      }
+    }
+    for (port = 1; port <= HUB_Machine.num_ports; port++)
+    {
+      if (HUB_Machine.port[port - 1].state == HUB_PORT_RESET_PENDING)
+      {
+        HUB_Machine.port_num = port;
+        HUB_Machine.state = HUB_PORT_RESET;
+        return status;
+      }
+    }
+
+    if (HUB_Elapsed(pdev, HUB_Machine.timer) >= HUB_Machine.poll)
+    {
+      HUB_Machine.state = HUB_GET_DATA;
+    }
+    break;
+
+  case HUB_PORT_STATUS:
+    if (USBH_HUB_PortRequest(pdev,
+                             pphost,
+                             USB_REQ_GET_STATUS,
+                             0,
+                             HUB_Machine.port_num) == USBH_OK)
+    {
+      HUB_Machine.port[HUB_Machine.port_num - 1].status = LE16(HUB_Machine.ctl_buff);
+      HUB_Machine.port_change = LE16(HUB_Machine.ctl_buff + 2) & HUB_PORT_CHG_MASK;
+      HUB_Machine.state = HUB_PORT_CLEAR;
+
+      if ((HUB_Machine.port_change & HUB_PORT_CHG_CONNECTION) &&
+          (HUB_Machine.port[HUB_Machine.port_num - 1].state != HUB_PORT_IDLE))
+      {
+        /* Removed, or replaced between two polls */
+        HUB_PortStop(pdev, HUB_Machine.port_num);
+      }
+    }
+    break;
+
+  case HUB_PORT_CLEAR:
+    if (HUB_Machine.port_change == 0)
+    {
+      HUB_Machine.changed &= ~(1 << HUB_Machine.port_num);
+      HUB_PortEvent(pdev, HUB_Machine.port_num);
+      HUB_Machine.state = HUB_POLL;
+      break;
+    }
+
+    /* Acknowledge the lowest change bit */
+    bit = 0;
+    while ((HUB_Machine.port_change & (1 << bit)) == 0)
+    {
+      bit++;
+    }
+    if (USBH_HUB_PortRequest(pdev,
+                             pphost,
+                             USB_REQ_CLEAR_FEATURE,
+                             HUB_FEAT_C_PORT_CONNECTION + bit,
+                             HUB_Machine.port_num) == USBH_OK)
+    {
+      HUB_Machine.port_change &= ~(1 << bit);
+    }
+    break;
+
+  case HUB_PORT_RESET:
+    if (USBH_HUB_PortRequest(pdev,
+                             pphost,
+                             USB_REQ_SET_FEATURE,
+                             HUB_FEAT_PORT_RESET,
+                             HUB_Machine.port_num) == USBH_OK)
+    {
+      HUB_Machine.port[HUB_Machine.port_num - 1].state = HUB_PORT_RESET_WAIT;
+      HUB_Machine.port[HUB_Machine.port_num - 1].timer = HCD_GetCurrentFrame(pdev);
+      HUB_Machine.state = HUB_POLL;
+    }
+    break;
+
+  default:
+    break;
+  }
+  return status;
+}
+
+/**
+* @brief  USBH_HUB_PortRequest
+*         Issues a hub class request on a port: GET_STATUS (4 bytes in
+*         ctl_buff), SET_FEATURE or CLEAR_FEATURE
+* @param  pdev: Selected device
+* @param  request: USB_REQ_GET_STATUS, USB_REQ_SET_FEATURE or
+*         USB_REQ_CLEAR_FEATURE
+* @param  feature: Port feature selector
+* @param  port: Port number, from 1
+* @retval USBH_Status : Response of the request
+*/
+static USBH_Status USBH_HUB_PortRequest (USB_OTG_CORE_HANDLE *pdev,
+                                         USBH_HOST *phost,
+                                         uint8_t request,
+                                         uint16_t feature,
+                                         uint8_t port)
+{
+  phost->Control.setup.b.bmRequestType = USB_REQ_RECIPIENT_OTHER | \
+    USB_REQ_TYPE_CLASS;
+  phost->Control.setup.b.bRequest = request;
+  phost->Control.setup.b.wIndex.w = port;
+
+  if (request == USB_REQ_GET_STATUS)
+  {
+    phost->Control.setup.b.bmRequestType |= USB_D2H;
+    phost->Control.setup.b.wValue.w = 0;
+    phost->Control.setup.b.wLength.w = 4;
+    return USBH_CtlReq(pdev, phost, HUB_Machine.ctl_buff, 4);
+  }
+
+  phost->Control.setup.b.wValue.w = feature;
+  phost->Control.setup.b.wLength.w = 0;
+  return USBH_CtlReq(pdev, phost, 0, 0);
+}
+
+/**
+* @brief  HUB_Elapsed
+*         Time since a frame number read with HCD_GetCurrentFrame
+* @param  pdev: Selected device
+* @param  start: Frame number
+* @retval Elapsed time in ms
+*/
+static uint16_t HUB_Elapsed (USB_OTG_CORE_HANDLE *pdev, uint16_t start)
+{
+  uint16_t frames = (HCD_GetCurrentFrame(pdev) - start) & 0x3FFF;
+
+  /* The frame number counts the micro-frames at high speed */
+  if (HUB_Machine.hs)
+  {
+    frames >>= 3;
+  }
+  return frames;
+}
+
+/**
+* @brief  HUB_PortEvent
+*         Port status read after a change: starts the connection sequence,
+*         or the device once the port reset is over
+* @param  pdev: Selected device
+* @param  port_num: Port number, from 1
+* @retval None
+*/
+static void HUB_PortEvent (USB_OTG_CORE_HANDLE *pdev, uint8_t port_num)
+{
+  HUB_Port_TypeDef *port = &HUB_Machine.port[port_num - 1];
+
+  if (port->status & HUB_PORT_STS_OVER_CURRENT)
+  {
+    HUB_Host->usr_cb->OverCurrentDetected();
+  }
+
+  if ((port->status & HUB_PORT_STS_CONNECTION) == 0)
+  {
+    HUB_PortStop(pdev, port_num);
+    return;
+  }
+
+  switch (port->state)
+  {
+  case HUB_PORT_IDLE:
+    port->state = HUB_PORT_DEBOUNCE;
+    port->timer = HCD_GetCurrentFrame(pdev);
+    break;
+
+  case HUB_PORT_RESET_WAIT:
+    if ((port->status & (HUB_PORT_STS_ENABLE | HUB_PORT_STS_RESET)) ==
+        HUB_PORT_STS_ENABLE)
+    {
+      port->state = HUB_PORT_RECOVERY;
+      port->timer = HCD_GetCurrentFrame(pdev);
+    }
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+* @brief  HUB_PortTimers
+*         Time driven steps of the port state machines
+* @param  pdev: Selected device
+* @retval None
+*/
+static void HUB_PortTimers (USB_OTG_CORE_HANDLE *pdev)
+{
+  HUB_Port_TypeDef *port;
+  uint8_t i;
+
+  for (i = 0; i < HUB_Machine.num_ports; i++)
+  {
+    port = &HUB_Machine.port[i];
+
+    switch (port->state)
+    {
+    case HUB_PORT_DEBOUNCE:
+      if (HUB_Elapsed(pdev, port->timer) >= HUB_DEBOUNCE_TIME)
+      {
+        port->state = HUB_PORT_WAIT_LOCK;
+      }
+      break;
+
+    case HUB_PORT_WAIT_LOCK:
+      /* One device at a time on address 0 and in enumeration */
+      if (HUB_Machine.lock == 0)
+      {
+        HUB_Machine.lock = i + 1;
+        port->state = HUB_PORT_RESET_PENDING;
+      }
+      break;
+
+    case HUB_PORT_RESET_WAIT:
+      if (HUB_Elapsed(pdev, port->timer) >= HUB_RESET_TIMEOUT)
+      {
+        HUB_Host->usr_cb->DeviceNotSupported();
+        HUB_Machine.lock = 0;
+        port->state = HUB_PORT_DISABLED;
+      }
+      break;
+
+    case HUB_PORT_RECOVERY:
+      if (HUB_Elapsed(pdev, port->timer) >= HUB_RESET_RECOVERY)
+      {
+        HUB_PortStart(pdev, i + 1);
+      }
+      break;
+
+    default:
+      break;
+    }
+  }
+}
+
+/**
+* @brief  HUB_PortStart
+*         Hand the device of a port, reset and enabled, to its USBH_HOST
+* @param  pdev: Selected device
+* @param  port_num: Port number, from 1
+* @retval None
+*/
+static void HUB_PortStart (USB_OTG_CORE_HANDLE *pdev, uint8_t port_num)
+{
+  HUB_Port_TypeDef *port = &HUB_Machine.port[port_num - 1];
+  USBH_HOST *child = &port->host;
+  uint8_t split;
+
+  if (child->Address == 0)
+  {
+    child->Address = USBH_AllocAddress();
+  }
+  if (child->Address == 0)
+  {
+    /* USBH_MAX_DEVICES reached */
+    HUB_Host->usr_cb->DeviceNotSupported();
+    HUB_Machine.lock = 0;
+    port->state = HUB_PORT_DISABLED;
+    return;
+  }
+
+  USBH_DeInit(pdev, child);
+  child->usr_cb = HUB_Host->usr_cb;
+  child->class_cb = &USBH_HUB_Child_cb;
+  child->HubPort = port_num;
+  child->PortConnected = 1;
+
+  if (port->status & HUB_PORT_STS_LOW_SPEED)
+  {
+    child->device_prop.speed = HPRT0_PRTSPD_LOW_SPEED;
+  }
+  else if (port->status & HUB_PORT_STS_HIGH_SPEED)
+  {
+    child->device_prop.speed = HPRT0_PRTSPD_HIGH_SPEED;
+  }
+  else
+  {
+    child->device_prop.speed = HPRT0_PRTSPD_FULL_SPEED;
+  }
+
+  /* FS/LS device behind a HS hub: split transactions through its TT */
+  split = (HUB_Machine.hs &&
+           (child->device_prop.speed != HPRT0_PRTSPD_HIGH_SPEED)) ? 1 : 0;
+  USBH_SetDeviceRoute(USBH_DEVICE_ADDRESS_DEFAULT,
+                      HUB_Host->device_prop.address, port_num, split);
+  USBH_SetDeviceRoute(child->Address,
+                      HUB_Host->device_prop.address, port_num, split);
+
+  port->state = HUB_PORT_ENABLED;
+  child->gState = HOST_DEV_ATTACHED;
+}
+
+/**
+* @brief  HUB_PortStop
+*         Tear down the device of a port, removed or not served
+* @param  pdev: Selected device
+* @param  port_num: Port number, from 1
+* @retval None
+*/
+static void HUB_PortStop (USB_OTG_CORE_HANDLE *pdev, uint8_t port_num)
+{
+  HUB_Port_TypeDef *port = &HUB_Machine.port[port_num - 1];
+  USBH_HOST *child = &port->host;
+
+  child->PortConnected = 0;
+  if (port->state == HUB_PORT_ENABLED)
+  {
+    /* Runs the disconnection of the device: class DeInit, channels and
+       address freed */
+    USBH_Process(pdev, child);
+    HUB_ReleaseClass(port_num);
+    child->class_cb = &USBH_HUB_Child_cb;
+  }
+
+  USBH_FreeAddress(child->Address);
+  child->Address = 0;
+
+  if (HUB_Machine.lock == port_num)
+  {
+    HUB_Machine.lock = 0;
+  }
+  port->state = HUB_PORT_IDLE;
+}
+
+/**
+* @brief  HUB_TakeClass
+*         Find a free class driver registered for an interface class
+* @param  itf_class: bInterfaceClass of the device
+* @param  port: Port of the device, HUB_ROOT_PORT for the root port
+* @retval Class callback structure, 0 if none is free
+*/
+static USBH_Class_cb_TypeDef *HUB_TakeClass (uint8_t itf_class, uint8_t port)
+{
+  uint8_t i;
+
+  for (i = 0; i < USBH_HUB_MAX_CLASS; i++)
+  {
+    if ((HUB_Class[i].cb != 0) && (HUB_Class[i].itf_class == itf_class) &&
+        (HUB_Class[i].port == 0))
+    {
+      HUB_Class[i].port = port;
+      return HUB_Class[i].cb;
+    }
+  }
+  return 0;
+}
+
+/**
+* @brief  HUB_ReleaseClass
+*         Give back the class driver used by a device
+* @param  port: Port of the device, HUB_ROOT_PORT for the root port
+* @retval None
+*/
+static void HUB_ReleaseClass (uint8_t port)
+{
+  uint8_t i;
+
+  for (i = 0; i < USBH_HUB_MAX_CLASS; i++)
+  {
+    if ((HUB_Class[i].cb != 0) && (HUB_Class[i].port == port))
+    {
+      HUB_Class[i].port = 0;
+    }
+  }
+}
+
+/**
+* @brief  USBH_HUB_ChildInit
+*         Class of an enumerated device behind the hub: the first free
+*         class driver registered for its interface class takes over
+* @param  pdev: Selected device
+* @param  phost: Host state of the device
+* @retval USBH_Status : Init of the class driver
+*/
+static USBH_Status USBH_HUB_ChildInit (USB_OTG_CORE_HANDLE *pdev ,
+                                       void *phost)
+{
+  USBH_HOST *child = phost;
+  USBH_Class_cb_TypeDef *class_cb;
+
+  class_cb = HUB_TakeClass(child->device_prop.Itf_Desc[0].bInterfaceClass,
+                           child->HubPort);
+  if (class_cb != 0)
+  {
+    child->class_cb = class_cb;
+    return class_cb->Init(pdev, phost);
+  }
+
+  /* No class driver, or its single instance is in use by another device */
+  child->usr_cb->DeviceNotSupported();
+  child->gState = HOST_SUSPENDED;
+  return USBH_BUSY;
+}
+
+/**
+* @brief  USBH_HUB_ChildDeInit
+*         Nothing to free before a class driver is chosen
+* @param  pdev: Selected device
+* @param  phost: Host state of the device
+* @retval None
+*/
+static void USBH_HUB_ChildDeInit (USB_OTG_CORE_HANDLE *pdev ,
+                                  void *phost)
+{
+}
+
+/**
+* @brief  USBH_HUB_ChildNop
+*         Class requests and machine before a class driver is chosen
+* @param  pdev: Selected device
+* @param  phost: Host state of the device
+* @retval USBH_OK
+*/
+static USBH_Status USBH_HUB_ChildNop (USB_OTG_CORE_HANDLE *pdev ,
+                                      void *phost)
+{
+  return USBH_OK;
+}
+
+/**
+* @brief  USBH_HUB_RegisterClass
+*         Register the class driver for the devices of an interface class
+*         behind the hub. The class drivers keep a single device state:
+*         register one callback structure per device to serve at a time
+* @param  itf_class: bInterfaceClass of the first interface
+* @param  class_cb: Class callback structure
+* @retval USBH_Status : USBH_FAIL if USBH_HUB_MAX_CLASS are registered
+*/
+USBH_Status USBH_HUB_RegisterClass (uint8_t itf_class,
+                                    USBH_Class_cb_TypeDef *class_cb)
+{
+  uint8_t i;
+
+  for (i = 0; i < USBH_HUB_MAX_CLASS; i++)
+  {
+    if (HUB_Class[i].cb == 0)
+    {
+      HUB_Class[i].itf_class = itf_class;
+      HUB_Class[i].cb = class_cb;
+      HUB_Class[i].port = 0;
+      return USBH_OK;
+    }
+  }
+  return USBH_FAIL;
+}
+
+/**
+* @brief  USBH_HUB_Process
+*         Run the host state machines of the devices behind the hub, to be
+*         called with USBH_Process from the application loop
+* @param  pdev: Selected device
+* @retval None
+*/
+void USBH_HUB_Process (USB_OTG_CORE_HANDLE *pdev)
+{
+  HUB_Port_TypeDef *port;
+  uint8_t i;
+
+  for (i = 0; i < HUB_Machine.num_ports; i++)
+  {
+    port = &HUB_Machine.port[i];
+    if (port->state != HUB_PORT_ENABLED)
+    {
+      continue;
+    }
+
+    USBH_Process(pdev, &port->host);
+
+    if (port->host.gState == HOST_IDLE)
+    {
+      /* Error state gone through: enumerate again after a port reset */
+      HUB_ReleaseClass(i + 1);
+      port->host.class_cb = &USBH_HUB_Child_cb;
+      if (HUB_Machine.lock == i + 1)
+      {
+        HUB_Machine.lock = 0;
+      }
+      port->state = HUB_PORT_WAIT_LOCK;
+    }
+    else if ((HUB_Machine.lock == i + 1) &&
+             ((port->host.gState == HOST_CLASS) ||
+              (port->host.gState == HOST_SUSPENDED)))
+    {
+      /* Enumerated: the next port can use address 0 */
+      HUB_Machine.lock = 0;
+    }
+  }
+}
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
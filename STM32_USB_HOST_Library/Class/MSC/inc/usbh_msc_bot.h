@@ -99,8 +99,16 @@ uint8_t* pRxTxBuff;
 uint16_t DataLength;
 uint8_t BOTXferErrorCount;
 uint8_t BOTXferStatus;
+#ifdef USBH_MSC_STREAM_ENABLED
+uint8_t StreamMode;       /* Data stage in multi-packet URBs */
+#endif
 } USBH_BOTXfer_TypeDef;
 
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+/* Prepares the CBW of the next command, see USBH_MSC_BOTSetQueue */
+typedef uint8_t (*USBH_MSC_BOTQueue_TypeDef)(void);
+#endif
+
 
 typedef union _USBH_CSW_Block
 {
@@ -201,6 +209,11 @@ void USBH_MSC_Init(USB_OTG_CORE_HANDLE *pdev);
 USBH_Status USBH_MSC_BOT_Abort(USB_OTG_CORE_HANDLE *pdev, 
                                USBH_HOST *phost,
                                uint8_t direction);
+uint8_t USBH_MSC_BOTXferWaiting(USB_OTG_CORE_HANDLE *pdev);
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+void USBH_MSC_BOTURBNotify(USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
+void USBH_MSC_BOTSetQueue(USBH_MSC_BOTQueue_TypeDef next);
+#endif
 /**
   * @}
   */ 
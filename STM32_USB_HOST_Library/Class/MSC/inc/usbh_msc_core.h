@@ -73,6 +73,9 @@ typedef struct _MSC_Process
   uint16_t             MSBulkOutEpSize;
   uint8_t              buff[USBH_MSC_MPS_SIZE];
   uint8_t              maxLun;
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+  uint8_t              lun;           /* LUN of the next commands */
+#endif
 }
 MSC_Machine_TypeDef; 
 
@@ -89,6 +92,13 @@ MSC_Machine_TypeDef;
 
 #define USB_REQ_BOT_RESET                0xFF
 #define USB_REQ_GET_MAX_LUN              0xFE
+
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+/* LUNs handled, the next ones are ignored */
+#ifndef USBH_MSC_MAX_LUN
+ #define USBH_MSC_MAX_LUN                2
+#endif
+#endif
     
 
 /**
@@ -108,6 +118,9 @@ MSC_Machine_TypeDef;
 extern USBH_Class_cb_TypeDef  USBH_MSC_cb;
 extern MSC_Machine_TypeDef    MSC_Machine;
 extern uint8_t MSCErrorCount;
+#ifdef USBH_HUB_ENABLED
+extern USBH_HOST *USBH_MSC_Host;
+#endif
 
 /**
   * @}
@@ -116,7 +129,9 @@ extern uint8_t MSCErrorCount;
 /** @defgroup USBH_MSC_CORE_Exported_FunctionsPrototype
   * @{
   */ 
-
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+void USBH_MSC_SelectLUN(uint8_t lun);
+#endif
 
 
 /**
@@ -106,6 +106,16 @@ typedef struct __MassStorageParameter
 #define MODE_SENSE_PAGE_CONTROL_FIELD     0x00
 #define MODE_SENSE_PAGE_CODE              0x3F
 #define DISK_WRITE_PROTECTED              0x01
+
+#ifdef USBH_MSC_STREAM_ENABLED
+/* Sectors of the bounce buffer used for the buffers the DMA cannot reach
+   (not 32-bit aligned) */
+#ifndef USBH_MSC_STREAM_BOUNCE_SECTORS
+ #define USBH_MSC_STREAM_BOUNCE_SECTORS   8
+#endif
+/* Largest Read10/Write10 transfer length */
+#define USBH_MSC_STREAM_MAX_SECTORS       0xFFFF
+#endif /* USBH_MSC_STREAM_ENABLED */
 /**
   * @}
   */ 
@@ -140,6 +150,16 @@ uint8_t USBH_MSC_Read10(USB_OTG_CORE_HANDLE *pdev,
                         uint8_t *,
                         uint32_t ,
                         uint32_t );
+#ifdef USBH_MSC_STREAM_ENABLED
+uint8_t USBH_MSC_ReadStream(USB_OTG_CORE_HANDLE *pdev,
+                            uint8_t *buf,
+                            uint32_t lba,
+                            uint32_t nbSectors);
+uint8_t USBH_MSC_WriteStream(USB_OTG_CORE_HANDLE *pdev,
+                             uint8_t *buf,
+                             uint32_t lba,
+                             uint32_t nbSectors);
+#endif
 void USBH_MSC_StateMachine(USB_OTG_CORE_HANDLE *pdev);
 
 /**
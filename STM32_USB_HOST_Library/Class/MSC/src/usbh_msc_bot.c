@@ -33,6 +33,10 @@
 #include "usbh_def.h"
 #include "usb_hcd_int.h"
 
+#if defined (USBH_MSC_BOT_PIPELINE_ENABLED) && !defined (USB_OTG_URB_NOTIFY_ENABLED)
+ #error "USBH_MSC_BOT_PIPELINE_ENABLED needs USB_OTG_URB_NOTIFY_ENABLED"
+#endif
+
 
 /** @addtogroup USBH_LIB
 * @{
@@ -95,6 +99,18 @@ __ALIGN_BEGIN HostCSWPkt_TypeDef USBH_MSC_CSWData __ALIGN_END ;
 
 static uint32_t BOTStallErrorCount;   /* Keeps count of STALL Error Cases*/
 
+#ifdef USBH_MSC_STREAM_ENABLED
+static uint8_t  *chunk_ptr;   /* OUT URB in progress, resumed after a NAK */
+static uint32_t chunk_len;
+#endif
+
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+static USBH_HOST *BOTHost;                  /* Host of the last foreground call */
+static __IO uint8_t BOTLock;                /* Foreground in the state machine */
+static __IO uint8_t BOTPending;             /* URB event left to the foreground */
+static USBH_MSC_BOTQueue_TypeDef BOTQueue;  /* Source of the next CBW */
+#endif
+
 /**
 * @}
 */ 
@@ -103,6 +119,11 @@ static uint32_t BOTStallErrorCount;   /* Keeps count of STALL Error Cases*/
 /** @defgroup USBH_MSC_BOT_Private_FunctionPrototypes
 * @{
 */ 
+static uint32_t USBH_MSC_BOTChunk(USB_OTG_CORE_HANDLE *pdev, 
+                                  uint16_t mps,
+                                  uint8_t is_out);
+static void USBH_MSC_BOTProcess(USB_OTG_CORE_HANDLE *pdev,
+                                USBH_HOST *phost);
 /**
 * @}
 */ 
@@ -140,6 +161,10 @@ void USBH_MSC_Init(USB_OTG_CORE_HANDLE *pdev )
   
   BOTStallErrorCount = 0;
   MSCErrorCount = 0;
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+  BOTQueue = 0;
+  USBH_SetURBNotify(USBH_MSC_BOTURBNotify);
+#endif
 }
 
 /**
@@ -151,8 +176,95 @@ void USBH_MSC_Init(USB_OTG_CORE_HANDLE *pdev )
 * 
 */
 void USBH_MSC_HandleBOTXfer (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
+{
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+  BOTHost = phost;
+  BOTLock = 1;
+  do
+  {
+    BOTPending = 0;
+    USBH_MSC_BOTProcess(pdev, phost);
+  }
+  while (BOTPending);
+  BOTLock = 0;
+#else
+  USBH_MSC_BOTProcess(pdev, phost);
+#endif
+}
+
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+/**
+* @brief  USBH_MSC_BOTURBNotify 
+*         URB state change of a channel, from the interrupt: the bulk phases
+*         of the BOT transfer follow each other from here without waiting
+*         for the next poll. The error recovery (control requests) stays in
+*         the foreground.
+* @param  pdev: Selected device
+* @param  hc_num: Channel number
+* @retval None
+*/
+void USBH_MSC_BOTURBNotify(USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+  uint8_t state;
+  
+  if (((hc_num != MSC_Machine.hc_num_in) && (hc_num != MSC_Machine.hc_num_out)) ||
+      (BOTHost == 0) ||
+      (USBH_MSC_BOTXferParam.MSCState != USBH_MSC_BOT_USB_TRANSFERS))
+  {
+    return;
+  }
+  
+  if (BOTLock)
+  {
+    /* The foreground runs the state machine again before leaving it */
+    BOTPending = 1;
+    return;
+  }
+  
+  do
+  {
+    state = USBH_MSC_BOTXferParam.BOTState;
+    if ((state != USBH_MSC_SEND_CBW) &&
+        (state != USBH_MSC_SENT_CBW) &&
+        (state != USBH_MSC_BOT_DATAIN_STATE) &&
+        (state != USBH_MSC_BOT_DATAOUT_STATE) &&
+        (state != USBH_MSC_RECEIVE_CSW_STATE) &&
+        (state != USBH_MSC_DECODE_CSW))
+    {
+      break;
+    }
+    USBH_MSC_BOTProcess(pdev, BOTHost);
+  }
+  /* Go on while the phases complete, stop on a URB in progress */
+  while ((state != USBH_MSC_BOTXferParam.BOTState) &&
+         (USBH_MSC_BOTXferParam.MSCState == USBH_MSC_BOT_USB_TRANSFERS));
+}
+
+/**
+* @brief  USBH_MSC_BOTSetQueue 
+*         Set the function preparing the CBW of the next command once a
+*         command completed with a good CSW. It returns 1 when it set up a
+*         CBW, which is sent at once in the same transfer, else 0.
+* @param  next: Queue function, 0 for none
+* @retval None
+*/
+void USBH_MSC_BOTSetQueue(USBH_MSC_BOTQueue_TypeDef next)
+{
+  BOTQueue = next;
+}
+#endif /* USBH_MSC_BOT_PIPELINE_ENABLED */
+
+/**
+* @brief  USBH_MSC_BOTProcess 
+*         One step of the BOT transfer state machine
+* @param  pdev: Selected device
+* @param  phost: Selected host
+* @retval None
+*/
+static void USBH_MSC_BOTProcess (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
 {
   uint8_t xferDirection, index;
+  uint32_t chunk;
   static uint32_t remainingDataLength;
   static uint8_t *datapointer , *datapointer_prev;
   static uint8_t error_direction;
@@ -233,15 +345,16 @@ void USBH_MSC_HandleBOTXfer (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
         BOTStallErrorCount = 0;
         USBH_MSC_BOTXferParam.BOTStateBkp = USBH_MSC_BOT_DATAIN_STATE;    
         
-        if(remainingDataLength > MSC_Machine.MSBulkInEpSize)
+        chunk = USBH_MSC_BOTChunk(pdev, MSC_Machine.MSBulkInEpSize, 0);
+        if(remainingDataLength > chunk)
         {
           USBH_BulkReceiveData (pdev,
 	                        datapointer, 
-			        MSC_Machine.MSBulkInEpSize , 
+			        chunk , 
 			        MSC_Machine.hc_num_in);
           
-          remainingDataLength -= MSC_Machine.MSBulkInEpSize;
-          datapointer = datapointer + MSC_Machine.MSBulkInEpSize;
+          remainingDataLength -= chunk;
+          datapointer = datapointer + chunk;
         }
         else if ( remainingDataLength == 0)
         {
@@ -288,16 +401,21 @@ void USBH_MSC_HandleBOTXfer (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
       {
         BOTStallErrorCount = 0;
         USBH_MSC_BOTXferParam.BOTStateBkp = USBH_MSC_BOT_DATAOUT_STATE;    
-        if(remainingDataLength > MSC_Machine.MSBulkOutEpSize)
+        chunk = USBH_MSC_BOTChunk(pdev, MSC_Machine.MSBulkOutEpSize, 1);
+        if(remainingDataLength > chunk)
         {
           USBH_BulkSendData (pdev,
                              datapointer, 
-                             MSC_Machine.MSBulkOutEpSize , 
+                             chunk , 
                              MSC_Machine.hc_num_out);
           datapointer_prev = datapointer;
-          datapointer = datapointer + MSC_Machine.MSBulkOutEpSize;
+          datapointer = datapointer + chunk;
+#ifdef USBH_MSC_STREAM_ENABLED
+          chunk_ptr = datapointer_prev;
+          chunk_len = chunk;
+#endif
           
-          remainingDataLength = remainingDataLength - MSC_Machine.MSBulkOutEpSize;
+          remainingDataLength = remainingDataLength - chunk;
         }
         else if ( remainingDataLength == 0)
         {
@@ -310,6 +428,10 @@ void USBH_MSC_HandleBOTXfer (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
 	                     datapointer, 
 			     remainingDataLength , 
 			     MSC_Machine.hc_num_out);
+#ifdef USBH_MSC_STREAM_ENABLED
+          chunk_ptr = datapointer;
+          chunk_len = remainingDataLength;
+#endif
           
           remainingDataLength = 0; /* Reset this value and keep in same state */   
         }      
@@ -317,6 +439,20 @@ void USBH_MSC_HandleBOTXfer (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
       
       else if(URB_Status == URB_NOTREADY)
       {
+#ifdef USBH_MSC_STREAM_ENABLED
+        if((USBH_MSC_BOTXferParam.StreamMode) && (pdev->cfg.dma_enable == 1))
+        {
+          /* Resume the multi-packet URB after the packets already ACKed */
+          chunk = HCD_GetXferCnt(pdev, MSC_Machine.hc_num_out);
+          chunk_ptr += chunk;
+          chunk_len -= chunk;
+          USBH_BulkSendData (pdev,
+                             chunk_ptr, 
+                             chunk_len , 
+                             MSC_Machine.hc_num_out);
+        }
+        else
+#endif
         if(datapointer != datapointer_prev)
         {
           USBH_BulkSendData (pdev,
@@ -392,6 +528,16 @@ void USBH_MSC_HandleBOTXfer (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
         USBH_MSC_BOTXferParam.MSCState = USBH_MSC_BOTXferParam.MSCStateCurrent ;
         
         USBH_MSC_BOTXferParam.BOTXferStatus = USBH_MSC_DecodeCSW(pdev , phost);
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+        if ((USBH_MSC_BOTXferParam.BOTXferStatus == USBH_MSC_OK) &&
+            (BOTQueue != 0) && (BOTQueue() != 0))
+        {
+          /* Next command queued: its CBW goes out right away */
+          USBH_MSC_BOTXferParam.MSCState = USBH_MSC_BOT_USB_TRANSFERS;
+          USBH_MSC_BOTXferParam.BOTXferStatus = USBH_MSC_BUSY;
+          USBH_MSC_BOTXferParam.BOTState = USBH_MSC_SEND_CBW;
+        }
+#endif
       }
       else if(URB_Status == URB_STALL)     
       {
@@ -442,6 +588,78 @@ void USBH_MSC_HandleBOTXfer (USB_OTG_CORE_HANDLE *pdev ,USBH_HOST *phost)
   }
 }
 
+/**
+* @brief  USBH_MSC_BOTChunk 
+*         Length of the next data stage URB: one packet, or in stream mode
+*         as many packets as one channel transfer can carry. OUT URBs only
+*         span several packets with the DMA: in slave mode the whole URB
+*         would have to be written in the Tx FIFO at once
+* @param  pdev: Selected device
+* @param  mps: Bulk endpoint max packet size
+* @param  is_out: 1 for the bulk OUT endpoint
+* @retval URB length (multiple of mps)
+*/
+static uint32_t USBH_MSC_BOTChunk(USB_OTG_CORE_HANDLE *pdev, 
+                                  uint16_t mps,
+                                  uint8_t is_out)
+{
+#ifdef USBH_MSC_STREAM_ENABLED
+  uint32_t chunk;
+  
+  if ((USBH_MSC_BOTXferParam.StreamMode) && 
+      ((is_out == 0) || (pdev->cfg.dma_enable == 1)))
+  {
+    /* URB length is 16-bit, the channel packet count 256 at most */
+    chunk = (0xFFFF / mps) * mps;
+    if (chunk > (256 * (uint32_t)mps))
+    {
+      chunk = 256 * (uint32_t)mps;
+    }
+    return chunk;
+  }
+#endif
+  return mps;
+}
+
+/**
+* @brief  USBH_MSC_BOTXferWaiting 
+*         Tells whether the BOT state machine waits for a bulk URB still in
+*         progress: USBH_MSC_HandleBOTXfer has then nothing to do until the
+*         URB state of that channel changes
+* @param  pdev: Selected device
+* @retval 1 if waiting for the URB, else 0
+*/
+uint8_t USBH_MSC_BOTXferWaiting(USB_OTG_CORE_HANDLE *pdev)
+{
+  uint8_t hc_num;
+  
+  switch (USBH_MSC_BOTXferParam.BOTState)
+  {
+  case USBH_MSC_SENT_CBW:
+  case USBH_MSC_BOT_DATAOUT_STATE:
+    hc_num = MSC_Machine.hc_num_out;
+    break;
+    
+  case USBH_MSC_BOT_DATAIN_STATE:
+    if (USBH_MSC_BOTXferParam.BOTStateBkp != USBH_MSC_BOT_DATAIN_STATE)
+    {
+      /* First data packet not requested yet */
+      return 0;
+    }
+    hc_num = MSC_Machine.hc_num_in;
+    break;
+    
+  case USBH_MSC_DECODE_CSW:
+    hc_num = MSC_Machine.hc_num_in;
+    break;
+    
+  default:
+    return 0;
+  }
+  
+  return (HCD_GetURB_State(pdev, hc_num) == URB_IDLE);
+}
+
 /**
 * @brief  USBH_MSC_BOT_Abort 
 *         This function manages the different Error handling for STALL
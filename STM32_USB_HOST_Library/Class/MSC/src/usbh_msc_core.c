@@ -104,6 +104,23 @@ __ALIGN_BEGIN MSC_Machine_TypeDef         MSC_Machine __ALIGN_END ;
 __ALIGN_BEGIN USB_Setup_TypeDef           MSC_Setup __ALIGN_END ;
 uint8_t MSCErrorCount = 0;
 
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+/* Parameters of the LUNs not selected; USBH_MSC_Param holds the selected one */
+static MassStorageParameter_TypeDef USBH_MSC_LUNParam[USBH_MSC_MAX_LUN];
+/* The LUNs are being probed after GetMaxLUN */
+static uint8_t USBH_MSC_Probing = FALSE;
+#endif
+
+#ifdef USBH_HUB_ENABLED
+/* Host state of the MSC device, which may sit behind a hub */
+USBH_HOST *USBH_MSC_Host = 0;
+#endif
+
+#ifdef USBH_HC_POOL_ENABLED
+/* Bulk channels kept for MSC across re-plugs */
+static uint32_t MSC_HC_Pool = 0;
+#endif
+
 
 /**
   * @}
@@ -128,6 +145,9 @@ static USBH_Status USBH_MSC_ClassRequest(USB_OTG_CORE_HANDLE *pdev ,
 
 static USBH_Status USBH_MSC_BOTReset(USB_OTG_CORE_HANDLE *pdev,
                               USBH_HOST *phost);
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+static void USBH_MSC_NextLUN(void);
+#endif
 static USBH_Status USBH_MSC_GETMaxLUN(USB_OTG_CORE_HANDLE *pdev,
                                USBH_HOST *phost);
 
@@ -198,10 +218,18 @@ static USBH_Status USBH_MSC_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
       MSC_Machine.MSBulkOutEpSize  = pphost->device_prop.Ep_Desc[0][1].wMaxPacketSize;      
     }
     
+#ifdef USBH_HC_POOL_ENABLED
+    USBH_Reserve_Channels(pdev, &MSC_HC_Pool, 2);
+    MSC_Machine.hc_num_out = USBH_Alloc_PoolChannel(pdev, &MSC_HC_Pool,
+                                                    MSC_Machine.MSBulkOutEp);
+    MSC_Machine.hc_num_in = USBH_Alloc_PoolChannel(pdev, &MSC_HC_Pool,
+                                                   MSC_Machine.MSBulkInEp);
+#else
     MSC_Machine.hc_num_out = USBH_Alloc_Channel(pdev, 
                                                 MSC_Machine.MSBulkOutEp);
     MSC_Machine.hc_num_in = USBH_Alloc_Channel(pdev,
                                                 MSC_Machine.MSBulkInEp);  
+#endif
     
     /* Open the new channels */
     USBH_Open_Channel  (pdev,
@@ -217,7 +245,9 @@ static USBH_Status USBH_MSC_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
                         pphost->device_prop.speed,
                         EP_TYPE_BULK,
                         MSC_Machine.MSBulkInEpSize);    
-    
+#ifdef USBH_HUB_ENABLED
+    USBH_MSC_Host = pphost;
+#endif
   }
   
   else
@@ -240,6 +270,9 @@ static USBH_Status USBH_MSC_InterfaceInit ( USB_OTG_CORE_HANDLE *pdev,
 void USBH_MSC_InterfaceDeInit ( USB_OTG_CORE_HANDLE *pdev,
                                 void *phost)
 {	
+#ifdef USBH_HUB_ENABLED
+  USBH_MSC_Host = 0;
+#endif
   if ( MSC_Machine.hc_num_out)
   {
     USB_OTG_HC_Halt(pdev, MSC_Machine.hc_num_out);
@@ -291,7 +324,9 @@ static USBH_Status USBH_MSC_Handle(USB_OTG_CORE_HANDLE *pdev ,
   uint8_t mscStatus = USBH_MSC_BUSY;
   uint8_t appliStatus = 0;
   
+#ifndef USBH_MSC_MULTI_LUN_ENABLED
   static uint8_t maxLunExceed = FALSE;
+#endif
   
     
   if(HCD_IsDeviceConnected(pdev))
@@ -300,6 +335,9 @@ static USBH_Status USBH_MSC_Handle(USB_OTG_CORE_HANDLE *pdev ,
     {
     case USBH_MSC_BOT_INIT_STATE:
       USBH_MSC_Init(pdev);
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+      MSC_Machine.lun = 0;
+#endif
       USBH_MSC_BOTXferParam.MSCState = USBH_MSC_BOT_RESET;  
       break;
       
@@ -330,6 +368,16 @@ static USBH_Status USBH_MSC_Handle(USB_OTG_CORE_HANDLE *pdev ,
       {
         MSC_Machine.maxLun = *(MSC_Machine.buff) ;
         
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+        /* Probe each LUN in turn, from LUN 0 */
+        if(MSC_Machine.maxLun >= USBH_MSC_MAX_LUN)
+        {
+          MSC_Machine.maxLun = USBH_MSC_MAX_LUN - 1;
+        }
+        MSC_Machine.lun = 0;
+        USBH_MSC_CBWData.field.CBWLUN = 0;
+        USBH_MSC_Probing = TRUE;
+#else
         /* If device has more that one logical unit then it is not supported */
         if((MSC_Machine.maxLun > 0) && (maxLunExceed == FALSE))
         {
@@ -338,6 +386,7 @@ static USBH_Status USBH_MSC_Handle(USB_OTG_CORE_HANDLE *pdev ,
           
           break;
         }
+#endif
         USBH_MSC_BOTXferParam.MSCState = USBH_MSC_TEST_UNIT_READY;
       }
       
@@ -403,7 +452,11 @@ static USBH_Status USBH_MSC_Handle(USB_OTG_CORE_HANDLE *pdev ,
       mscStatus = USBH_MSC_ModeSense6(pdev);
       if(mscStatus == USBH_MSC_OK )
       {
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+        USBH_MSC_NextLUN();
+#else
         USBH_MSC_BOTXferParam.MSCState = USBH_MSC_DEFAULT_APPLI_STATE;
+#endif
         MSCErrorCount = 0;
         status = USBH_OK;
       }
@@ -526,6 +579,17 @@ void USBH_MSC_ErrorHandle(uint8_t status)
         USBH_MSC_BOTXferParam.MSCState = USBH_MSC_REQUEST_SENSE;
         USBH_MSC_BOTXferParam.CmdStateMachine = CMD_SEND_STATE;
       }
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+      else if(USBH_MSC_Probing == TRUE)
+      {
+        /* LUN not ready (e.g. card reader slot without media): left with
+           a null capacity, go on with the next LUN */
+        USBH_MSC_Param.MSCapacity = 0;
+        USBH_MSC_BOTXferParam.CmdStateMachine = CMD_SEND_STATE;
+        MSCErrorCount = 0;
+        USBH_MSC_NextLUN();
+      }
+#endif
       else
       {
         /* Error trials exceeded the limit, go to unrecovered state */
@@ -543,6 +607,48 @@ void USBH_MSC_ErrorHandle(uint8_t status)
     }
 }
 
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+/**
+  * @brief  USBH_MSC_SelectLUN
+  *         Select the LUN addressed by the next SCSI commands, and swap its
+  *         parameters into USBH_MSC_Param. To be called between commands
+  *         only, when no BOT transfer is in progress.
+  * @param  lun: logical unit number, up to MSC_Machine.maxLun
+  * @retval None
+  */
+void USBH_MSC_SelectLUN(uint8_t lun)
+{
+  if(lun != MSC_Machine.lun)
+  {
+    USBH_MSC_LUNParam[MSC_Machine.lun] = USBH_MSC_Param;
+    USBH_MSC_Param = USBH_MSC_LUNParam[lun];
+    MSC_Machine.lun = lun;
+  }
+  USBH_MSC_CBWData.field.CBWLUN = lun;
+}
+
+/**
+  * @brief  USBH_MSC_NextLUN
+  *         Probe the next LUN, or end the probing back on LUN 0
+  * @param  None
+  * @retval None
+  */
+static void USBH_MSC_NextLUN(void)
+{
+  if(MSC_Machine.lun < MSC_Machine.maxLun)
+  {
+    USBH_MSC_SelectLUN(MSC_Machine.lun + 1);
+    USBH_MSC_BOTXferParam.MSCState = USBH_MSC_TEST_UNIT_READY;
+  }
+  else
+  {
+    USBH_MSC_SelectLUN(0);
+    USBH_MSC_Probing = FALSE;
+    USBH_MSC_BOTXferParam.MSCState = USBH_MSC_DEFAULT_APPLI_STATE;
+  }
+}
+#endif
+
 /**
   * @}
   */ 
@@ -2,32 +2,276 @@
 #include "usb_conf.h"
 #include "diskio.h"
 #include "usbh_msc_core.h"
+#include "usbh_msc_bot.h"
+#include "usbh_msc_scsi.h"
+#include <string.h>
+#ifdef USBH_MSC_FATFS_USE_OS
+#include "cmsis_os.h"
+#endif
 /*--------------------------------------------------------------------------
 
 Module Private Functions and Variables
 
 ---------------------------------------------------------------------------*/
 
-static volatile DSTATUS Stat = STA_NOINIT;	/* Disk status */
+/* One FatFs drive per LUN of the device */
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+ #define MSC_DRIVES                       USBH_MSC_MAX_LUN
+ #define MSC_SELECT(drv)                  USBH_MSC_SelectLUN(drv)
+#else
+ #define MSC_DRIVES                       1
+ #define MSC_SELECT(drv)
+#endif
+
+#define MSC_SECTOR_SIZE                   512
+
+static volatile DWORD DrvReady = 0;	/* Bit n: drive n initialized */
+
+#define MSC_STAT(drv)   ((DrvReady & (1UL << (drv))) ? 0 : STA_NOINIT)
 
 extern USB_OTG_CORE_HANDLE          USB_OTG_Core;
 extern USBH_HOST                     USB_Host;
 
+#ifdef USBH_HUB_ENABLED
+ #define MSC_HOST                         USBH_MSC_Host
+#else
+ #define MSC_HOST                         (&USB_Host)
+#endif
+
+#ifdef USBH_MSC_FATFS_WAIT_ENABLED
+#ifndef USBH_MSC_FATFS_WAIT_TIMEOUT
+ #define USBH_MSC_FATFS_WAIT_TIMEOUT      10
+#endif
+
+#ifdef USBH_MSC_FATFS_USE_OS
+#ifndef USB_OTG_URB_NOTIFY_ENABLED
+ #error "USBH_MSC_FATFS_USE_OS needs USB_OTG_URB_NOTIFY_ENABLED"
+#endif
+osSemaphoreDef(MSC_URB);
+static osSemaphoreId MSC_URBSem = NULL;
+
+/* URB state change, from the OTG interrupt */
+static void MSC_URBNotify (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+  /* Replaces the BOT notification set by USBH_MSC_Init */
+  USBH_MSC_BOTURBNotify(pdev, hc_num);
+#endif
+  if ((hc_num == MSC_Machine.hc_num_in) || (hc_num == MSC_Machine.hc_num_out))
+  {
+    osSemaphoreRelease(MSC_URBSem);
+  }
+}
+#endif
+
+/* Wait for the bulk URB of the BOT state machine to complete */
+static void MSC_WaitURB (void)
+{
+  while (USBH_MSC_BOTXferWaiting(&USB_OTG_Core) &&
+         HCD_IsDeviceConnected(&USB_OTG_Core))
+  {
+#ifdef USBH_MSC_FATFS_USE_OS
+    osSemaphoreWait(MSC_URBSem, USBH_MSC_FATFS_WAIT_TIMEOUT);
+#else
+    /* WFI wakes up on the pending interrupt even when masked: no event can
+       be lost between the test and the sleep */
+    __disable_irq();
+    if (USBH_MSC_BOTXferWaiting(&USB_OTG_Core))
+    {
+      __WFI();
+    }
+    __enable_irq();
+#endif
+  }
+}
+#endif /* USBH_MSC_FATFS_WAIT_ENABLED */
+
+#ifdef USBH_MSC_FATFS_CACHE_ENABLED
+/* Write-through cache of the single sector reads, which are the FAT and
+   directory accesses of FatFs: they stay resident instead of being read
+   again over USB by each f_open/f_lseek. Multi-sector data reads bypass it,
+   writes update the cached copies. */
+#ifndef USBH_MSC_FATFS_CACHE_SECTORS
+ #define USBH_MSC_FATFS_CACHE_SECTORS     4
+#endif
+
+typedef struct
+{
+  DWORD sector;
+  DWORD age;                            /* Last use, for the LRU replacement */
+  BYTE  valid;
+}
+MSC_CacheTag_TypeDef;
+
+static MSC_CacheTag_TypeDef CacheTag[MSC_DRIVES][USBH_MSC_FATFS_CACHE_SECTORS];
+static DWORD CacheClock = 0;
+
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static BYTE CacheBuf[MSC_DRIVES][USBH_MSC_FATFS_CACHE_SECTORS][MSC_SECTOR_SIZE] __ALIGN_END;
+
+/* Cached copy of the sector, NULL on a miss */
+static BYTE *MSC_CacheFind (BYTE drv, DWORD sector)
+{
+  BYTE i;
+  
+  for (i = 0; i < USBH_MSC_FATFS_CACHE_SECTORS; i++)
+  {
+    if (CacheTag[drv][i].valid && (CacheTag[drv][i].sector == sector))
+    {
+      CacheTag[drv][i].age = ++CacheClock;
+      return CacheBuf[drv][i];
+    }
+  }
+  return NULL;
+}
+
+/* Least recently used slot, to be filled with the sector */
+static BYTE MSC_CacheAlloc (BYTE drv)
+{
+  BYTE i, lru = 0;
+  
+  for (i = 0; i < USBH_MSC_FATFS_CACHE_SECTORS; i++)
+  {
+    if (!CacheTag[drv][i].valid)
+    {
+      return i;
+    }
+    if (CacheTag[drv][i].age < CacheTag[drv][lru].age)
+    {
+      lru = i;
+    }
+  }
+  return lru;
+}
+
+/* Keep the cached copies of written sectors up to date */
+static void MSC_CacheWrite (BYTE drv, const BYTE *buff, DWORD sector, BYTE count)
+{
+  BYTE i;
+  
+  for (i = 0; i < USBH_MSC_FATFS_CACHE_SECTORS; i++)
+  {
+    if (CacheTag[drv][i].valid && 
+        (CacheTag[drv][i].sector >= sector) &&
+        (CacheTag[drv][i].sector < sector + count))
+    {
+      memcpy(CacheBuf[drv][i], 
+             buff + (CacheTag[drv][i].sector - sector) * MSC_SECTOR_SIZE,
+             MSC_SECTOR_SIZE);
+    }
+  }
+}
+
+/* Drop the cached sectors, the media may have changed */
+static void MSC_CacheInvalidate (BYTE drv)
+{
+  BYTE i;
+  
+  for (i = 0; i < USBH_MSC_FATFS_CACHE_SECTORS; i++)
+  {
+    CacheTag[drv][i].valid = 0;
+  }
+}
+#endif /* USBH_MSC_FATFS_CACHE_ENABLED */
+
+/* READ10/WRITE10 on the LUN of the drive, until the BOT transfer ends */
+static DRESULT MSC_Xfer (BYTE drv, BYTE *buff, DWORD sector, BYTE count, BYTE write)
+{
+  BYTE status = USBH_MSC_OK;
+  
+  if(!HCD_IsDeviceConnected(&USB_OTG_Core))
+  { 
+    return RES_NOTRDY;
+  }
+  
+  MSC_SELECT(drv);
+  
+  do
+  {
+#ifdef USBH_MSC_STREAM_ENABLED
+    if (count > 1)
+    {
+      /* Multi-packet data stage, unaligned buffers bounced for the DMA */
+      if (write)
+      {
+        status = USBH_MSC_WriteStream(&USB_OTG_Core, buff, sector, count);
+      }
+      else
+      {
+        status = USBH_MSC_ReadStream(&USB_OTG_Core, buff, sector, count);
+      }
+    }
+    else
+#endif
+    if (write)
+    {
+      status = USBH_MSC_Write10(&USB_OTG_Core, buff, sector, MSC_SECTOR_SIZE * count);
+    }
+    else
+    {
+      status = USBH_MSC_Read10(&USB_OTG_Core, buff, sector, MSC_SECTOR_SIZE * count);
+    }
+#ifdef USBH_HUB_ENABLED
+    if(MSC_HOST == 0)
+    {
+      return RES_NOTRDY;
+    }
+#endif
+    USBH_MSC_HandleBOTXfer(&USB_OTG_Core ,MSC_HOST);
+    
+    if(!HCD_IsDeviceConnected(&USB_OTG_Core))
+    { 
+      return RES_ERROR;
+    }      
+#ifdef USBH_MSC_FATFS_WAIT_ENABLED
+    if(status == USBH_MSC_BUSY)
+    {
+      MSC_WaitURB();
+    }
+#endif
+  }
+  while(status == USBH_MSC_BUSY );
+  
+  if(status == USBH_MSC_OK)
+    return RES_OK;
+  return RES_ERROR;
+}
+
 /*-----------------------------------------------------------------------*/
 /* Initialize Disk Drive                                                 */
 /*-----------------------------------------------------------------------*/
 
 DSTATUS disk_initialize (
-                         BYTE drv		/* Physical drive number (0) */
+                         BYTE drv		/* Physical drive number (LUN) */
                            )
 {
+  if (drv >= MSC_DRIVES) return STA_NOINIT;
   
-  if(HCD_IsDeviceConnected(&USB_OTG_Core))
+  if(HCD_IsDeviceConnected(&USB_OTG_Core) && (drv <= MSC_Machine.maxLun))
   {  
-    Stat &= ~STA_NOINIT;
+#ifdef USBH_MSC_FATFS_USE_OS
+    if (MSC_URBSem == NULL)
+    {
+      MSC_URBSem = osSemaphoreCreate(osSemaphore(MSC_URB), 1);
+    }
+    USBH_SetURBNotify(MSC_URBNotify);
+#endif
+#ifdef USBH_MSC_FATFS_CACHE_ENABLED
+    MSC_CacheInvalidate(drv);
+#endif
+    MSC_SELECT(drv);
+#ifdef USBH_MSC_MULTI_LUN_ENABLED
+    /* LUN found not ready when the device was probed */
+    if (USBH_MSC_Param.MSCapacity == 0) return STA_NOINIT;
+#endif
+    DrvReady |= (1UL << drv);
   }
   
-  return Stat;
+  return MSC_STAT(drv);
   
   
 }
@@ -39,11 +283,11 @@ DSTATUS disk_initialize (
 /*-----------------------------------------------------------------------*/
 
 DSTATUS disk_status (
-                     BYTE drv		/* Physical drive number (0) */
+                     BYTE drv		/* Physical drive number (LUN) */
                        )
 {
-  if (drv) return STA_NOINIT;		/* Supports only single drive */
-  return Stat;
+  if (drv >= MSC_DRIVES) return STA_NOINIT;
+  return MSC_STAT(drv);
 }
 
 
@@ -53,38 +297,45 @@ DSTATUS disk_status (
 /*-----------------------------------------------------------------------*/
 
 DRESULT disk_read (
-                   BYTE drv,			/* Physical drive number (0) */
+                   BYTE drv,			/* Physical drive number (LUN) */
                    BYTE *buff,			/* Pointer to the data buffer to store read data */
                    DWORD sector,		/* Start sector number (LBA) */
                    BYTE count			/* Sector count (1..255) */
                      )
 {
-  BYTE status = USBH_MSC_OK;
-  
-  if (drv || !count) return RES_PARERR;
-  if (Stat & STA_NOINIT) return RES_NOTRDY;
+#ifdef USBH_MSC_FATFS_CACHE_ENABLED
+  BYTE *cached;
+  BYTE slot;
+  DRESULT res;
+#endif
   
+  if ((drv >= MSC_DRIVES) || !count) return RES_PARERR;
+  if (MSC_STAT(drv) & STA_NOINIT) return RES_NOTRDY;
   
-  if(HCD_IsDeviceConnected(&USB_OTG_Core))
-  {  
-    
-    do
+#ifdef USBH_MSC_FATFS_CACHE_ENABLED
+  if (count == 1)
+  {
+    cached = MSC_CacheFind(drv, sector);
+    if (cached == NULL)
     {
-      status = USBH_MSC_Read10(&USB_OTG_Core, buff,sector,512 * count);
-      USBH_MSC_HandleBOTXfer(&USB_OTG_Core ,&USB_Host);
-      
-      if(!HCD_IsDeviceConnected(&USB_OTG_Core))
-      { 
-        return RES_ERROR;
-      }      
+      slot = MSC_CacheAlloc(drv);
+      CacheTag[drv][slot].valid = 0;
+      res = MSC_Xfer(drv, CacheBuf[drv][slot], sector, 1, 0);
+      if (res != RES_OK)
+      {
+        return res;
+      }
+      CacheTag[drv][slot].sector = sector;
+      CacheTag[drv][slot].age = ++CacheClock;
+      CacheTag[drv][slot].valid = 1;
+      cached = CacheBuf[drv][slot];
     }
-    while(status == USBH_MSC_BUSY );
-  }
-  
-  if(status == USBH_MSC_OK)
+    memcpy(buff, cached, MSC_SECTOR_SIZE);
     return RES_OK;
-  return RES_ERROR;
+  }
+#endif
   
+  return MSC_Xfer(drv, buff, sector, count, 0);
 }
 
 
@@ -95,38 +346,34 @@ DRESULT disk_read (
 
 #if _READONLY == 0
 DRESULT disk_write (
-                    BYTE drv,			/* Physical drive number (0) */
+                    BYTE drv,			/* Physical drive number (LUN) */
                     const BYTE *buff,	/* Pointer to the data to be written */
                     DWORD sector,		/* Start sector number (LBA) */
                     BYTE count			/* Sector count (1..255) */
                       )
 {
-  BYTE status = USBH_MSC_OK;
-  if (drv || !count) return RES_PARERR;
-  if (Stat & STA_NOINIT) return RES_NOTRDY;
-  if (Stat & STA_PROTECT) return RES_WRPRT;
+  DRESULT res;
   
+  if ((drv >= MSC_DRIVES) || !count) return RES_PARERR;
+  if (MSC_STAT(drv) & STA_NOINIT) return RES_NOTRDY;
   
-  if(HCD_IsDeviceConnected(&USB_OTG_Core))
-  {  
-    do
-    {
-      status = USBH_MSC_Write10(&USB_OTG_Core,(BYTE*)buff,sector,512 * count);
-      USBH_MSC_HandleBOTXfer(&USB_OTG_Core, &USB_Host);
-      
-      if(!HCD_IsDeviceConnected(&USB_OTG_Core))
-      { 
-        return RES_ERROR;
-      }
-    }
-    
-    while(status == USBH_MSC_BUSY );
-    
-  }
+  MSC_SELECT(drv);
+  if (USBH_MSC_Param.MSWriteProtect) return RES_WRPRT;
   
-  if(status == USBH_MSC_OK)
-    return RES_OK;
-  return RES_ERROR;
+  res = MSC_Xfer(drv, (BYTE*)buff, sector, count, 1);
+  
+#ifdef USBH_MSC_FATFS_CACHE_ENABLED
+  if (res == RES_OK)
+  {
+    MSC_CacheWrite(drv, buff, sector, count);
+  }
+  else
+  {
+    /* Unknown media content for the sectors written */
+    MSC_CacheInvalidate(drv);
+  }
+#endif
+  return res;
 }
 #endif /* _READONLY == 0 */
 
@@ -138,18 +385,20 @@ DRESULT disk_write (
 
 #if _USE_IOCTL != 0
 DRESULT disk_ioctl (
-                    BYTE drv,		/* Physical drive number (0) */
+                    BYTE drv,		/* Physical drive number (LUN) */
                     BYTE ctrl,		/* Control code */
                     void *buff		/* Buffer to send/receive control data */
                       )
 {
   DRESULT res = RES_OK;
   
-  if (drv) return RES_PARERR;
+  if (drv >= MSC_DRIVES) return RES_PARERR;
   
   res = RES_ERROR;
   
-  if (Stat & STA_NOINIT) return RES_NOTRDY;
+  if (MSC_STAT(drv) & STA_NOINIT) return RES_NOTRDY;
+  
+  MSC_SELECT(drv);
   
   switch (ctrl) {
   case CTRL_SYNC :		/* Make sure that no pending write process */
@@ -164,7 +413,7 @@ DRESULT disk_ioctl (
     break;
     
   case GET_SECTOR_SIZE :	/* Get R/W sector size (WORD) */
-    *(WORD*)buff = 512;
+    *(WORD*)buff = MSC_SECTOR_SIZE;
     res = RES_OK;
     break;
     
@@ -31,6 +31,9 @@
 #include "usbh_msc_bot.h"
 #include "usbh_ioreq.h"
 #include "usbh_def.h"
+#ifdef USBH_MSC_STREAM_ENABLED
+#include <string.h>
+#endif
 
 
 /** @addtogroup USBH_LIB
@@ -56,6 +59,20 @@
   */ 
 
 MassStorageParameter_TypeDef USBH_MSC_Param; 
+
+#ifdef USBH_MSC_STREAM_ENABLED
+/* Stream transfer split in Read10/Write10 commands */
+typedef struct _MSC_Stream
+{
+  uint8_t  *buf;
+  uint32_t lba;
+  uint32_t remaining;     /* Sectors still to transfer */
+  uint32_t cur;           /* Sectors of the command in progress, 0 if none */
+  uint8_t  active;
+  uint8_t  bounce;        /* Data copied through USBH_StreamBounce */
+}
+MSC_Stream_TypeDef;
+#endif
 /**
   * @}
   */ 
@@ -92,6 +109,17 @@ __ALIGN_BEGIN uint8_t USBH_DataInBuffer[512] __ALIGN_END ;
   #endif
 #endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
 __ALIGN_BEGIN uint8_t USBH_DataOutBuffer[512] __ALIGN_END ;
+
+#ifdef USBH_MSC_STREAM_ENABLED
+#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
+  #if defined ( __ICCARM__ ) /*!< IAR Compiler */
+    #pragma data_alignment=4   
+  #endif
+#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
+__ALIGN_BEGIN static uint8_t USBH_StreamBounce[USBH_MSC_STREAM_BOUNCE_SECTORS * USBH_MSC_PAGE_LENGTH] __ALIGN_END ;
+
+static MSC_Stream_TypeDef USBH_MSC_Stream;
+#endif
 /**
   * @}
   */ 
@@ -100,6 +128,16 @@ __ALIGN_BEGIN uint8_t USBH_DataOutBuffer[512] __ALIGN_END ;
 /** @defgroup USBH_MSC_SCSI_Private_FunctionPrototypes
   * @{
   */ 
+#ifdef USBH_MSC_STREAM_ENABLED
+static uint8_t USBH_MSC_StreamXfer(USB_OTG_CORE_HANDLE *pdev,
+                                   uint8_t *buf,
+                                   uint32_t lba,
+                                   uint32_t nbSectors,
+                                   uint8_t write);
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+static uint8_t USBH_MSC_StreamQueue(void);
+#endif
+#endif
 /**
   * @}
   */ 
@@ -653,6 +691,202 @@ uint8_t USBH_MSC_Read10(USB_OTG_CORE_HANDLE *pdev,
   return status;
 }
 
+#ifdef USBH_MSC_STREAM_ENABLED
+/**
+  * @brief  USBH_MSC_ReadStream 
+  *         Read any number of sectors, in Read10 commands of up to 65535
+  *         sectors whose data stage runs in multi-packet URBs. Called until
+  *         it returns something else than USBH_MSC_BUSY, like USBH_MSC_Read10
+  * @param  buf : Buffer receiving the data
+  * @param  lba : First sector
+  * @param  nbSectors : Number of sectors to read
+  * @retval Status
+  */
+uint8_t USBH_MSC_ReadStream(USB_OTG_CORE_HANDLE *pdev,
+                            uint8_t *buf,
+                            uint32_t lba,
+                            uint32_t nbSectors)
+{
+  return USBH_MSC_StreamXfer(pdev, buf, lba, nbSectors, 0);
+}
+
+/**
+  * @brief  USBH_MSC_WriteStream 
+  *         Write any number of sectors, see USBH_MSC_ReadStream
+  * @param  buf : Data to write
+  * @param  lba : First sector
+  * @param  nbSectors : Number of sectors to write
+  * @retval Status
+  */
+uint8_t USBH_MSC_WriteStream(USB_OTG_CORE_HANDLE *pdev,
+                             uint8_t *buf,
+                             uint32_t lba,
+                             uint32_t nbSectors)
+{
+  return USBH_MSC_StreamXfer(pdev, buf, lba, nbSectors, 1);
+}
+
+/**
+  * @brief  USBH_MSC_StreamXfer 
+  *         Split a stream transfer in Read10/Write10 commands. The DMA only
+  *         moves words, so a buffer that is not 32-bit aligned goes through
+  *         the bounce buffer, one bounce buffer per command
+  * @param  buf : Data buffer
+  * @param  lba : First sector
+  * @param  nbSectors : Number of sectors
+  * @param  write : 1 to write, 0 to read
+  * @retval Status
+  */
+static uint8_t USBH_MSC_StreamXfer(USB_OTG_CORE_HANDLE *pdev,
+                                   uint8_t *buf,
+                                   uint32_t lba,
+                                   uint32_t nbSectors,
+                                   uint8_t write)
+{
+  MSC_Stream_TypeDef *s = &USBH_MSC_Stream;
+  uint8_t *data;
+  uint8_t status;
+  
+  if(!HCD_IsDeviceConnected(pdev))
+  {
+    s->active = 0;
+    USBH_MSC_BOTXferParam.StreamMode = 0;
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+    USBH_MSC_BOTSetQueue(0);
+#endif
+    return USBH_MSC_FAIL;
+  }
+  
+  if (s->active == 0)
+  {
+    if (nbSectors == 0)
+    {
+      return USBH_MSC_OK;
+    }
+    s->buf = buf;
+    s->lba = lba;
+    s->remaining = nbSectors;
+    s->cur = 0;
+    s->bounce = ((pdev->cfg.dma_enable == 1) && (((uint32_t)buf & 3) != 0));
+    s->active = 1;
+    USBH_MSC_BOTXferParam.StreamMode = 1;
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+    if (s->bounce == 0)
+    {
+      /* The commands follow each other from the interrupt */
+      USBH_MSC_BOTSetQueue(USBH_MSC_StreamQueue);
+    }
+#endif
+  }
+  
+  if (s->cur == 0)
+  {
+    /* Next command */
+    s->cur = s->remaining;
+    if (s->bounce)
+    {
+      if (s->cur > USBH_MSC_STREAM_BOUNCE_SECTORS)
+      {
+        s->cur = USBH_MSC_STREAM_BOUNCE_SECTORS;
+      }
+      if (write)
+      {
+        memcpy(USBH_StreamBounce, s->buf, s->cur * USBH_MSC_PAGE_LENGTH);
+      }
+    }
+    else if (s->cur > USBH_MSC_STREAM_MAX_SECTORS)
+    {
+      s->cur = USBH_MSC_STREAM_MAX_SECTORS;
+    }
+  }
+  
+  data = (s->bounce) ? USBH_StreamBounce : s->buf;
+  
+  if (write)
+  {
+    status = USBH_MSC_Write10(pdev, data, s->lba, s->cur * USBH_MSC_PAGE_LENGTH);
+  }
+  else
+  {
+    status = USBH_MSC_Read10(pdev, data, s->lba, s->cur * USBH_MSC_PAGE_LENGTH);
+  }
+  
+  if (status == USBH_MSC_OK)
+  {
+    if ((s->bounce) && (write == 0))
+    {
+      memcpy(s->buf, USBH_StreamBounce, s->cur * USBH_MSC_PAGE_LENGTH);
+    }
+    s->buf += s->cur * USBH_MSC_PAGE_LENGTH;
+    s->lba += s->cur;
+    s->remaining -= s->cur;
+    s->cur = 0;
+    
+    if (s->remaining != 0)
+    {
+      return USBH_MSC_BUSY;
+    }
+  }
+  else if (status == USBH_MSC_BUSY)
+  {
+    return USBH_MSC_BUSY;
+  }
+  
+  s->active = 0;
+  USBH_MSC_BOTXferParam.StreamMode = 0;
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+  USBH_MSC_BOTSetQueue(0);
+#endif
+  return status;
+}
+
+#ifdef USBH_MSC_BOT_PIPELINE_ENABLED
+/**
+  * @brief  USBH_MSC_StreamQueue 
+  *         Called by the BOT layer when a command of the stream completed:
+  *         accounts for it and prepares the CBW of the next one, so that
+  *         the whole stream is one BOT transfer for USBH_MSC_Read10/Write10
+  * @param  None
+  * @retval 1 if a CBW was prepared, 0 at the end of the stream
+  */
+static uint8_t USBH_MSC_StreamQueue(void)
+{
+  MSC_Stream_TypeDef *s = &USBH_MSC_Stream;
+  uint32_t cur;
+  uint16_t nbOfPages;
+  
+  s->buf += s->cur * USBH_MSC_PAGE_LENGTH;
+  s->lba += s->cur;
+  s->remaining -= s->cur;
+  
+  cur = s->remaining;
+  if (cur > USBH_MSC_STREAM_MAX_SECTORS)
+  {
+    cur = USBH_MSC_STREAM_MAX_SECTORS;
+  }
+  s->cur = cur;
+  if (cur == 0)
+  {
+    return 0;
+  }
+  
+  /* Same command as the previous one, other block range */
+  USBH_MSC_CBWData.field.CBWTransferLength = cur * USBH_MSC_PAGE_LENGTH;
+  USBH_MSC_BOTXferParam.pRxTxBuff = s->buf;
+  
+  USBH_MSC_CBWData.field.CBWCB[2]  = (((uint8_t*)&s->lba)[3]);
+  USBH_MSC_CBWData.field.CBWCB[3]  = (((uint8_t*)&s->lba)[2]);
+  USBH_MSC_CBWData.field.CBWCB[4]  = (((uint8_t*)&s->lba)[1]);
+  USBH_MSC_CBWData.field.CBWCB[5]  = (((uint8_t*)&s->lba)[0]);
+  
+  nbOfPages = cur;
+  USBH_MSC_CBWData.field.CBWCB[7]  = (((uint8_t *)&nbOfPages)[1]) ; 
+  USBH_MSC_CBWData.field.CBWCB[8]  = (((uint8_t *)&nbOfPages)[0]) ; 
+  
+  return 1;
+}
+#endif /* USBH_MSC_BOT_PIPELINE_ENABLED */
+#endif /* USBH_MSC_STREAM_ENABLED */
 
 /**
   * @}
@@ -52,6 +52,78 @@
 #define USBH_MSC_MPS_SIZE                 0x200
 #endif
 
+/* disk_read/disk_write sleep until the next bulk URB event instead of spinning
+   on USBH_MSC_HandleBOTXfer: WFI, or with USBH_MSC_FATFS_USE_OS a CMSIS-RTOS
+   semaphore given from the URB change interrupt (needs
+   USB_OTG_URB_NOTIFY_ENABLED). The timeout (ms) bounds the wait when the
+   device is unplugged */
+// #define USBH_MSC_FATFS_WAIT_ENABLED
+// #define USBH_MSC_FATFS_USE_OS
+// #define USBH_MSC_FATFS_WAIT_TIMEOUT      10
+
+/* One FatFs drive per LUN (drive n = LUN n), up to USBH_MSC_MAX_LUN */
+// #define USBH_MSC_MULTI_LUN_ENABLED
+// #define USBH_MSC_MAX_LUN                 2
+
+/* Per drive write-through cache of the single sector reads (FAT and
+   directory sectors), USBH_MSC_FATFS_CACHE_SECTORS x 512 bytes per drive */
+// #define USBH_MSC_FATFS_CACHE_ENABLED
+// #define USBH_MSC_FATFS_CACHE_SECTORS     4
+
+/* Multi-packet bulk URBs for the MSC data stage and USBH_MSC_ReadStream /
+   USBH_MSC_WriteStream for transfers of any length. Buffers that are not
+   32-bit aligned go through a bounce buffer of USBH_MSC_STREAM_BOUNCE_SECTORS
+   sectors when the DMA is used */
+// #define USBH_MSC_STREAM_ENABLED
+// #define USBH_MSC_STREAM_BOUNCE_SECTORS   8
+
+/* The MSC bulk phases (CBW, data, CSW and the CBW of a queued stream
+   command) follow each other from the URB interrupt instead of one phase
+   per poll (needs USB_OTG_URB_NOTIFY_ENABLED) */
+// #define USBH_MSC_BOT_PIPELINE_ENABLED
+
+/* Control transfers: the data and status stages (and the next request of a
+   USBH_CtlReqBatch batch) are started from the URB interrupt as the
+   previous stage completes, and USBH_CtlReq sends the SETUP at once instead
+   of one stage per USBH_Process poll (needs USB_OTG_URB_NOTIFY_ENABLED) */
+// #define USBH_CTL_PIPELINE_ENABLED
+
+/* Shorter enumeration: the string descriptors are only read for a class
+   setting StringDesc in its USBH_Class_cb_TypeDef, the configuration
+   descriptor is parsed in one walk, and the parsed configurations of the
+   last USBH_ENUM_CACHE_SIZE devices (VID/PID/bcdDevice) are kept so that a
+   known device is not asked for it again */
+// #define USBH_FAST_ENUM_ENABLED
+// #define USBH_ENUM_CACHE_SIZE             2
+
+/* Hub class (Class/HUB): up to USBH_HUB_MAX_PORTS devices behind one hub,
+   each with its own USBH_HOST and address (USBH_MAX_DEVICES addresses in
+   all, the hub included). FS/LS devices behind a HS hub need
+   USB_OTG_SPLIT_ENABLED. Every device takes two control channels besides
+   its class ones: HC_MAX can be raised to 12 on the OTG_HS core */
+// #define USBH_HUB_ENABLED
+// #define USBH_HUB_MAX_PORTS               4
+// #define USBH_MAX_DEVICES                 5
+// #define HC_MAX                           12
+
+/* Host channels allocated from a bitmap, a freed channel going back to the
+   endpoint it served last; MSC and HID keep their channels in a class pool
+   (USBH_Reserve_Channels) so that a re-plug reuses them at once */
+// #define USBH_HC_POOL_ENABLED
+
+/* HID host: report descriptors parsed at enumeration into a field table
+   (usbh_hid_parser.c), so that any HID device (gamepads, joysticks...) is
+   decoded by HID_GENERIC_cb. HID_MIN_POLL (frames) bounds the polling
+   interval of the interrupt IN endpoint, 1 to follow bInterval */
+// #define USBH_HID_PARSER_ENABLED
+// #define USBH_HID_MAX_FIELDS              32
+// #define HID_MIN_POLL                     1
+
+/* CDC host (Class/CDC): largest bulk URB of the ACM / vendor bulk pipes,
+   a multiple of 512. The next URB is started from the URB interrupt with
+   USB_OTG_URB_NOTIFY_ENABLED, else from the class handler */
+// #define USBH_CDC_URB_SIZE                2048
+
 /**
   * @}
   */ 
@@ -62,6 +62,23 @@
 #define USBH_DEVICE_ADDRESS_DEFAULT                     0
 #define USBH_DEVICE_ADDRESS                             1
 
+#ifdef USBH_FAST_ENUM_ENABLED
+/* Devices whose parsed configuration is kept across attachments */
+#ifndef USBH_ENUM_CACHE_SIZE
+ #define USBH_ENUM_CACHE_SIZE                           2
+#endif
+#endif
+
+#ifdef USBH_HUB_ENABLED
+/* Addresses 1 to USBH_MAX_DEVICES, given by USBH_AllocAddress */
+#ifndef USBH_MAX_DEVICES
+ #define USBH_MAX_DEVICES                               5
+#endif
+#if (USBH_MAX_DEVICES > 31)
+ #error "USBH_MAX_DEVICES should be 31 at most"
+#endif
+#endif
+
 
 /**
   * @}
@@ -146,6 +163,17 @@ typedef enum {
 } CMD_State;  
 
 
+#ifdef USBH_CTL_PIPELINE_ENABLED
+/* Control request of a batch, see USBH_CtlReqBatch */
+typedef struct _CtlBatch
+{
+  USB_Setup_TypeDef     setup;          /* wLength: length of the data stage */
+  uint8_t               *buff;          /* data stage buffer */
+  USBH_Status           status;         /* set on completion: USBH_OK,
+                                           USBH_NOT_SUPPORTED (stalled) or
+                                           USBH_FAIL */
+} USBH_CtlBatch_TypeDef;
+#endif
 
 typedef struct _Ctrl
 {
@@ -159,6 +187,12 @@ typedef struct _Ctrl
   CTRL_STATUS           status;
   USB_Setup_TypeDef     setup;
   CTRL_State            state;  
+#ifdef USBH_CTL_PIPELINE_ENABLED
+  USBH_CtlBatch_TypeDef *batch;         /* requests of USBH_CtlReqBatch */
+  uint8_t               batch_count;
+  uint8_t               batch_idx;      /* request on the pipe */
+  __IO USBH_Status      batch_status;   /* USBH_BUSY until the batch ends */
+#endif
 
 } USBH_Ctrl_TypeDef;
 
@@ -187,6 +221,9 @@ typedef struct _USBH_Class_cb
     (USB_OTG_CORE_HANDLE *pdev , void *phost);  
   USBH_Status  (*Machine)\
     (USB_OTG_CORE_HANDLE *pdev , void *phost);     
+#ifdef USBH_FAST_ENUM_ENABLED
+  uint8_t      StringDesc;  /* 1 to read the string descriptors on enumeration */
+#endif
   
 } USBH_Class_cb_TypeDef;
 
@@ -231,9 +268,20 @@ typedef struct _Host_TypeDef
   USBH_Class_cb_TypeDef               *class_cb;  
   USBH_Usr_cb_TypeDef  	              *usr_cb;
 
+#ifdef USBH_HUB_ENABLED
+  uint8_t               Address;        /* Given by SET_ADDRESS */
+  uint8_t               HubPort;        /* 0: root port, else hub port */
+  __IO uint8_t          PortConnected;  /* Hub port status (HubPort != 0) */
+#endif
   
 } USBH_HOST, *pUSBH_HOST;
 
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+/* Called from the interrupt on a URB state change of channel hc_num */
+typedef void (*USBH_URB_Notify_TypeDef)(USB_OTG_CORE_HANDLE *pdev,
+                                        uint8_t hc_num);
+#endif
+
 /**
   * @}
   */ 
@@ -269,8 +317,19 @@ USBH_Status USBH_DeInit(USB_OTG_CORE_HANDLE *pdev,
                         USBH_HOST *phost);
 void USBH_Process(USB_OTG_CORE_HANDLE *pdev , 
                   USBH_HOST *phost);
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+uint32_t USBH_ProcessEvents(USB_OTG_CORE_HANDLE *pdev , 
+                            USBH_HOST *phost);
+#endif
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+void USBH_SetURBNotify (USBH_URB_Notify_TypeDef notify);
+#endif
 void USBH_ErrorHandle(USBH_HOST *phost, 
                       USBH_Status errType);
+#ifdef USBH_HUB_ENABLED
+uint8_t USBH_AllocAddress(void);
+void USBH_FreeAddress(uint8_t address);
+#endif
 
 /**
   * @}
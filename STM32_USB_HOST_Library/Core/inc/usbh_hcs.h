@@ -48,12 +48,18 @@
 /** @defgroup USBH_HCS_Exported_Defines
   * @{
   */
+#ifndef HC_MAX
 #define HC_MAX           8
+#endif
 
 #define HC_OK            0x0000
 #define HC_USED          0x8000
 #define HC_ERROR         0xFFFF
 #define HC_USED_MASK     0x7FFF
+
+#if defined (USBH_HC_POOL_ENABLED) && (HC_MAX > 16)
+ #error "HC_MAX: 16 host channels at most"
+#endif
 /**
   * @}
   */ 
@@ -103,6 +109,23 @@ uint8_t USBH_Modify_Channel (USB_OTG_CORE_HANDLE *pdev,
                             uint8_t speed,
                             uint8_t ep_type,
                             uint16_t mps);
+#ifdef USBH_HC_POOL_ENABLED
+uint8_t USBH_Reserve_Channels (USB_OTG_CORE_HANDLE *pdev,
+                               uint32_t *pool,
+                               uint8_t count);
+
+void USBH_Release_Channels (USB_OTG_CORE_HANDLE *pdev, uint32_t *pool);
+
+uint8_t USBH_Alloc_PoolChannel (USB_OTG_CORE_HANDLE *pdev,
+                                uint32_t *pool,
+                                uint8_t ep_addr);
+#endif
+#ifdef USBH_HUB_ENABLED
+void USBH_SetDeviceRoute (uint8_t dev_address,
+                          uint8_t hub_addr,
+                          uint8_t hub_port,
+                          uint8_t split);
+#endif
 /**
   * @}
   */ 
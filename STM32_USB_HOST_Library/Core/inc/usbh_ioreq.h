@@ -133,6 +133,37 @@ USBH_Status USBH_IsocSendData( USB_OTG_CORE_HANDLE *pdev,
                                 uint8_t *buff, 
                                 uint32_t length,
                                 uint8_t hc_num);
+
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+USBH_Status USBH_IsocStartStream( USB_OTG_CORE_HANDLE *pdev, 
+                                  uint8_t *buff0, 
+                                  uint8_t *buff1, 
+                                  uint32_t length,
+                                  uint8_t hc_num,
+                                  void (*BufferDone) (void *pdev,
+                                                      uint8_t hc_num,
+                                                      uint8_t *buff,
+                                                      uint32_t count));
+
+void USBH_IsocStopStream( USB_OTG_CORE_HANDLE *pdev, 
+                          uint8_t hc_num);
+#endif
+
+#ifdef USBH_CTL_PIPELINE_ENABLED
+USBH_Status USBH_CtlReqBatch (USB_OTG_CORE_HANDLE *pdev,
+                              USBH_HOST *phost, 
+                              USBH_CtlBatch_TypeDef *batch,
+                              uint8_t count);
+
+void USBH_CtlProcess (USB_OTG_CORE_HANDLE *pdev,
+                      USBH_HOST *phost);
+
+void USBH_CtlURBNotify (USB_OTG_CORE_HANDLE *pdev,
+                        uint8_t hc_num);
+
+USBH_Status USBH_HandleControl (USB_OTG_CORE_HANDLE *pdev,
+                                USBH_HOST *phost);
+#endif
 /**
   * @}
   */ 
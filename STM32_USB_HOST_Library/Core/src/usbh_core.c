@@ -33,6 +33,7 @@
 #include "usbh_stdreq.h"
 #include "usbh_core.h"
 #include "usb_hcd_int.h"
+#include "usb_event.h"
 
 
 /** @addtogroup USBH_LIB
@@ -55,12 +56,20 @@
 uint8_t USBH_Disconnected (USB_OTG_CORE_HANDLE *pdev); 
 uint8_t USBH_Connected (USB_OTG_CORE_HANDLE *pdev); 
 uint8_t USBH_SOF (USB_OTG_CORE_HANDLE *pdev); 
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+uint8_t USBH_URBChange (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num); 
+
+static USBH_URB_Notify_TypeDef USBH_URB_Notify = 0;
+#endif
 
 USBH_HCD_INT_cb_TypeDef USBH_HCD_INT_cb = 
 {
   USBH_SOF,
   USBH_Connected, 
   USBH_Disconnected,    
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+  USBH_URBChange,
+#endif
 };
 
 USBH_HCD_INT_cb_TypeDef  *USBH_HCD_INT_fops = &USBH_HCD_INT_cb;
@@ -88,6 +97,29 @@ USBH_HCD_INT_cb_TypeDef  *USBH_HCD_INT_fops = &USBH_HCD_INT_cb;
 /** @defgroup USBH_CORE_Private_Variables
   * @{
   */ 
+#ifdef USBH_FAST_ENUM_ENABLED
+/* Parsed configuration of a device seen before, found again from its
+   device descriptor instead of reading the configuration descriptor */
+typedef struct _EnumCache
+{
+  uint16_t                      idVendor;
+  uint16_t                      idProduct;
+  uint16_t                      bcdDevice;
+  uint8_t                       valid;
+  USBH_CfgDesc_TypeDef          Cfg_Desc;
+  USBH_InterfaceDesc_TypeDef    Itf_Desc[USBH_MAX_NUM_INTERFACES];
+  USBH_EpDesc_TypeDef           Ep_Desc[USBH_MAX_NUM_INTERFACES][USBH_MAX_NUM_ENDPOINTS];
+}
+USBH_EnumCache_TypeDef;
+
+static USBH_EnumCache_TypeDef USBH_EnumCache[USBH_ENUM_CACHE_SIZE];
+static uint8_t USBH_EnumCacheNext = 0;
+#endif
+
+#ifdef USBH_HUB_ENABLED
+/* Bit n: address n given to a device */
+static uint32_t USBH_AddressUsed = 0;
+#endif
 /**
   * @}
   */ 
@@ -97,6 +129,12 @@ USBH_HCD_INT_cb_TypeDef  *USBH_HCD_INT_fops = &USBH_HCD_INT_cb;
   * @{
   */
 static USBH_Status USBH_HandleEnum(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost);
+static uint8_t USBH_IsConnected(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost);
+#ifdef USBH_FAST_ENUM_ENABLED
+static USBH_EnumCache_TypeDef *USBH_EnumCacheFind(USBH_HOST *phost);
+static uint8_t USBH_EnumCacheLoad(USBH_HOST *phost);
+static void USBH_EnumCacheStore(USBH_HOST *phost);
+#endif
 USBH_Status USBH_HandleControl (USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost);
 
 /**
@@ -118,6 +156,9 @@ USBH_Status USBH_HandleControl (USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost);
 uint8_t USBH_Connected (USB_OTG_CORE_HANDLE *pdev)
 {
   pdev->host.ConnSts = 1;
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_CONNECT, 0, 0);
+#endif
   return 0;
 }
 
@@ -131,6 +172,9 @@ uint8_t USBH_Connected (USB_OTG_CORE_HANDLE *pdev)
 uint8_t USBH_Disconnected (USB_OTG_CORE_HANDLE *pdev)
 {
   pdev->host.ConnSts = 0;
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_DISCONNECT, 0, 0);
+#endif
   return 0;  
 }
 
@@ -144,8 +188,45 @@ uint8_t USBH_Disconnected (USB_OTG_CORE_HANDLE *pdev)
 uint8_t USBH_SOF (USB_OTG_CORE_HANDLE *pdev)
 {
   /* This callback could be used to implement a scheduler process */
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+  /* Tick for the class timers (HID poll, MSC timeouts) */
+  USB_OTG_EventPush(pdev, USB_OTG_EVT_SOF, 0, 0);
+#endif
+  return 0;  
+}
+
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+/**
+  * @brief  USBH_URBChange
+  *         URB state change callback function from the Interrupt. 
+  * @param  selected device
+  * @param  hc_num: channel number
+  * @retval Status
+  */
+uint8_t USBH_URBChange (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+#ifdef USBH_CTL_PIPELINE_ENABLED
+  USBH_CtlURBNotify(pdev, hc_num);
+#endif
+  if (USBH_URB_Notify != 0)
+  {
+    USBH_URB_Notify(pdev, hc_num);
+  }
   return 0;  
 }
+
+/**
+  * @brief  USBH_SetURBNotify
+  *         Set the function called from the interrupt on each URB state
+  *         change, e.g. a class driver waking the task blocked on it
+  * @param  notify: function to call, 0 to remove it
+  * @retval None
+  */
+void USBH_SetURBNotify (USBH_URB_Notify_TypeDef notify)
+{
+  USBH_URB_Notify = notify;
+}
+#endif
 /**
   * @brief  USBH_Init
   *         Host hardware and stack initializations 
@@ -170,6 +251,10 @@ void USBH_Init(USB_OTG_CORE_HANDLE *pdev,
   /* Host de-initializations */
   USBH_DeInit(pdev, phost);
   
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+  USB_OTG_EventInit(pdev);
+#endif
+  
   /*Register class and user callbacks */
   phost->class_cb = class_cb;
   phost->usr_cb = usr_cb;  
@@ -201,15 +286,111 @@ USBH_Status USBH_DeInit(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
   
   phost->Control.state = CTRL_SETUP;
   phost->Control.ep0size = USB_OTG_MAX_EP0_SIZE;  
+#ifdef USBH_CTL_PIPELINE_ENABLED
+  /* A batch cut by a disconnection is dropped */
+  phost->Control.batch_status = USBH_OK;
+#endif
   
   phost->device_prop.address = USBH_DEVICE_ADDRESS_DEFAULT;
   phost->device_prop.speed = HPRT0_PRTSPD_FULL_SPEED;
   
   USBH_Free_Channel  (pdev, phost->Control.hc_num_in);
   USBH_Free_Channel  (pdev, phost->Control.hc_num_out);  
+#ifdef USBH_HUB_ENABLED
+  /* Freed once: the channels may go to another device meanwhile */
+  phost->Control.hc_num_in = (uint8_t)HC_ERROR;
+  phost->Control.hc_num_out = (uint8_t)HC_ERROR;
+#endif
   return USBH_OK;
 }
 
+#ifdef USBH_HUB_ENABLED
+/**
+  * @brief  USBH_AllocAddress
+  *         Get a free device address
+  * @param  None
+  * @retval Address, 0 if all of them are used
+  */
+uint8_t USBH_AllocAddress(void)
+{
+  uint8_t address;
+  
+  for (address = 1; address <= USBH_MAX_DEVICES; address++)
+  {
+    if ((USBH_AddressUsed & (1UL << address)) == 0)
+    {
+      USBH_AddressUsed |= (1UL << address);
+      return address;
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  USBH_FreeAddress
+  *         Give back the address of a removed device
+  * @param  address: Device address
+  * @retval None
+  */
+void USBH_FreeAddress(uint8_t address)
+{
+  if ((address != 0) && (address <= USBH_MAX_DEVICES))
+  {
+    USBH_AddressUsed &= ~(1UL << address);
+  }
+}
+#endif
+
+/**
+  * @brief  USBH_IsConnected
+  *         Connection status of the device of a host structure: the root
+  *         port, or for a device behind a hub the status of its hub port
+  * @param  pdev : Selected device
+  * @param  phost : Host state structure
+  * @retval 1 if the device is connected
+  */
+static uint8_t USBH_IsConnected(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
+{
+#ifdef USBH_HUB_ENABLED
+  if (phost->HubPort != 0)
+  {
+    return (HCD_IsDeviceConnected(pdev) && phost->PortConnected) ? 1 : 0;
+  }
+#endif
+  return HCD_IsDeviceConnected(pdev) ? 1 : 0;
+}
+
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+/**
+* @brief  USBH_ProcessEvents
+*         Drain the interrupt events (URB state changes, connection, SOF
+*         tick) and run the host state machine once if there was any, so
+*         that the application thread only runs the stack when something
+*         happened instead of polling it
+* @param  pdev : Selected device
+* @param  phost : Host state structure
+* @retval number of events drained
+*/
+uint32_t USBH_ProcessEvents(USB_OTG_CORE_HANDLE *pdev , USBH_HOST *phost)
+{
+  USB_OTG_EVENT evt;
+  uint32_t count = 0;
+  
+  /* The state machine reads the URB states and the connection status
+     itself: the events only tell it when to run */
+  while (USB_OTG_EventPop(pdev, &evt))
+  {
+    count++;
+  }
+  
+  if (count != 0)
+  {
+    USBH_Process(pdev, phost);
+  }
+  return count;
+}
+#endif
+
 /**
 * @brief  USBH_Process
 *         USB Host core main state machine process
@@ -222,7 +403,7 @@ void USBH_Process(USB_OTG_CORE_HANDLE *pdev , USBH_HOST *phost)
   
   
   /* check for Host port events */
-  if ((HCD_IsDeviceConnected(pdev) == 0)&& (phost->gState != HOST_IDLE)) 
+  if ((USBH_IsConnected(pdev, phost) == 0)&& (phost->gState != HOST_IDLE)) 
   {
     if(phost->gState != HOST_DEV_DISCONNECTED) 
     {
@@ -235,6 +416,13 @@ void USBH_Process(USB_OTG_CORE_HANDLE *pdev , USBH_HOST *phost)
   
   case HOST_IDLE :
     
+#ifdef USBH_HUB_ENABLED
+    if (phost->HubPort != 0)
+    {
+      /* Restarted by the hub class through a port reset */
+      break;
+    }
+#endif
     if (HCD_IsDeviceConnected(pdev))  
     {
       phost->gState = HOST_DEV_ATTACHED;
@@ -248,15 +436,45 @@ void USBH_Process(USB_OTG_CORE_HANDLE *pdev , USBH_HOST *phost)
     phost->Control.hc_num_out = USBH_Alloc_Channel(pdev, 0x00);
     phost->Control.hc_num_in = USBH_Alloc_Channel(pdev, 0x80);  
   
+#ifdef USBH_HUB_ENABLED
+    if ((phost->Control.hc_num_out >= HC_MAX) ||
+        (phost->Control.hc_num_in >= HC_MAX))
+    {
+      /* Out of channels: the device is left unused until it is removed */
+      phost->usr_cb->DeviceNotSupported();
+      phost->gState = HOST_SUSPENDED;
+      break;
+    }
+    if (phost->HubPort == 0)
+    {
+      /* Root device: first in enumeration, no transaction translator */
+      if (phost->Address == 0)
+      {
+        phost->Address = USBH_AllocAddress();
+      }
+      USBH_SetDeviceRoute(USBH_DEVICE_ADDRESS_DEFAULT, 0, 0, 0);
+      USBH_SetDeviceRoute(phost->Address, 0, 0, 0);
+    }
+    
+    /* Behind a hub, the port is reset by the hub class and the speed taken
+       from the port status */
+    if ((phost->HubPort != 0) || (HCD_ResetPort(pdev) == 0))
+#else
     /* Reset USB Device */
     if ( HCD_ResetPort(pdev) == 0)
+#endif
     {
       phost->usr_cb->ResetDevice();
       /*  Wait for USB USBH_ISR_PrtEnDisableChange()  
       Host is Now ready to start the Enumeration 
       */
       
-      phost->device_prop.speed = HCD_GetCurrentSpeed(pdev);
+#ifdef USBH_HUB_ENABLED
+      if (phost->HubPort == 0)
+#endif
+      {
+        phost->device_prop.speed = HCD_GetCurrentSpeed(pdev);
+      }
       
       phost->gState = HOST_ENUMERATION;
       phost->usr_cb->DeviceSpeedDetected(phost->device_prop.speed);
@@ -328,13 +546,27 @@ void USBH_Process(USB_OTG_CORE_HANDLE *pdev , USBH_HOST *phost)
     
   case HOST_CTRL_XFER:
     /* process control transfer state machine */
+#ifdef USBH_CTL_PIPELINE_ENABLED
+    USBH_CtlProcess(pdev, phost);
+#else
     USBH_HandleControl(pdev, phost);    
+#endif
     break;
     
   case HOST_SUSPENDED:
     break;
   
   case HOST_ERROR_STATE:
+#ifdef USBH_FAST_ENUM_ENABLED
+    /* Read the configuration again at the next attachment */
+    {
+      USBH_EnumCache_TypeDef *entry = USBH_EnumCacheFind(phost);
+      if (entry != 0)
+      {
+        entry->valid = 0;
+      }
+    }
+#endif
     /* Re-Initilaize Host for new Enumeration */
     USBH_DeInit(pdev, phost);
     phost->usr_cb->DeInit();
@@ -350,7 +582,17 @@ void USBH_Process(USB_OTG_CORE_HANDLE *pdev , USBH_HOST *phost)
     USBH_DeInit(pdev, phost);
     phost->usr_cb->DeInit();
     phost->class_cb->DeInit(pdev, &phost->device_prop); 
+#ifdef USBH_HUB_ENABLED
+    USBH_FreeAddress(phost->Address);
+    phost->Address = 0;
+    if (phost->HubPort == 0)
+    {
+      /* The channels of the other devices stay open behind a hub */
+      USBH_DeAllocate_AllChannel(pdev);  
+    }
+#else
     USBH_DeAllocate_AllChannel(pdev);  
+#endif
     phost->gState = HOST_IDLE;
     
     break;
@@ -397,6 +639,11 @@ static USBH_Status USBH_HandleEnum(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
 {
   USBH_Status Status = USBH_BUSY;  
   uint8_t Local_Buffer[64];
+  uint8_t dev_address = USBH_DEVICE_ADDRESS;
+  
+#ifdef USBH_HUB_ENABLED
+  dev_address = phost->Address;
+#endif
   
   switch (phost->EnumState)
   {
@@ -407,7 +654,12 @@ static USBH_Status USBH_HandleEnum(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
       phost->Control.ep0size = phost->device_prop.Dev_Desc.bMaxPacketSize;
       
       /* Issue Reset  */
-      HCD_ResetPort(pdev);
+#ifdef USBH_HUB_ENABLED
+      if (phost->HubPort == 0)
+#endif
+      {
+        HCD_ResetPort(pdev);
+      }
       phost->EnumState = ENUM_GET_FULL_DEV_DESC;
       
       /* modify control channels configuration for MaxPacket size */
@@ -440,14 +692,24 @@ static USBH_Status USBH_HandleEnum(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
    
   case ENUM_SET_ADDR: 
     /* set address */
-    if ( USBH_SetAddress(pdev, phost, USBH_DEVICE_ADDRESS) == USBH_OK)
+    if ( USBH_SetAddress(pdev, phost, dev_address) == USBH_OK)
     {
       USB_OTG_BSP_mDelay(2);
-      phost->device_prop.address = USBH_DEVICE_ADDRESS;
+      phost->device_prop.address = dev_address;
       
       /* user callback for device address assigned */
       phost->usr_cb->DeviceAddressAssigned();
       phost->EnumState = ENUM_GET_CFG_DESC;
+#ifdef USBH_FAST_ENUM_ENABLED
+      if (USBH_EnumCacheLoad(phost))
+      {
+        /* Known device: configuration descriptor requests skipped */
+        phost->usr_cb->ConfigurationDescAvailable(&phost->device_prop.Cfg_Desc,
+                                                  phost->device_prop.Itf_Desc,
+                                                  phost->device_prop.Ep_Desc[0]);
+        phost->EnumState = ENUM_GET_MFC_STRING_DESC;
+      }
+#endif
       
       /* modify control channels to update device address */
       USBH_Modify_Channel (pdev,
@@ -482,6 +744,9 @@ static USBH_Status USBH_HandleEnum(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
                          phost,
                          phost->device_prop.Cfg_Desc.wTotalLength) == USBH_OK)
     {
+#ifdef USBH_FAST_ENUM_ENABLED
+      USBH_EnumCacheStore(phost);
+#endif
       /* User callback for configuration descriptors available */
       phost->usr_cb->ConfigurationDescAvailable(&phost->device_prop.Cfg_Desc,
                                                       phost->device_prop.Itf_Desc,
@@ -492,6 +757,17 @@ static USBH_Status USBH_HandleEnum(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
     break;
     
   case ENUM_GET_MFC_STRING_DESC:  
+#ifdef USBH_FAST_ENUM_ENABLED
+    if (phost->class_cb->StringDesc == 0)
+    {
+      /* The class does not use the strings: three requests less */
+      phost->usr_cb->ManufacturerString("N/A");
+      phost->usr_cb->ProductString("N/A");
+      phost->usr_cb->SerialNumString("N/A");
+      phost->EnumState = ENUM_SET_CONFIGURATION;
+      break;
+    }
+#endif
     if (phost->device_prop.Dev_Desc.iManufacturer != 0)
     { /* Check that Manufacturer String is available */
       
@@ -577,6 +853,92 @@ static USBH_Status USBH_HandleEnum(USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
   return Status;
 }
 
+#ifdef USBH_FAST_ENUM_ENABLED
+/**
+  * @brief  USBH_EnumCacheFind
+  *         Look for the attached device in the enumeration cache
+  * @param  phost: Host state structure
+  * @retval Cache entry, 0 if the device is not known
+  */
+static USBH_EnumCache_TypeDef *USBH_EnumCacheFind(USBH_HOST *phost)
+{
+  uint8_t i;
+  
+  for (i = 0; i < USBH_ENUM_CACHE_SIZE; i++)
+  {
+    if ((USBH_EnumCache[i].valid) &&
+        (USBH_EnumCache[i].idVendor == phost->device_prop.Dev_Desc.idVendor) &&
+        (USBH_EnumCache[i].idProduct == phost->device_prop.Dev_Desc.idProduct) &&
+        (USBH_EnumCache[i].bcdDevice == phost->device_prop.Dev_Desc.bcdDevice))
+    {
+      return &USBH_EnumCache[i];
+    }
+  }
+  return 0;
+}
+
+/**
+  * @brief  USBH_EnumCacheLoad
+  *         Restore the parsed configuration of a known device
+  * @param  phost: Host state structure
+  * @retval 1 if the device was in the cache, else 0
+  */
+static uint8_t USBH_EnumCacheLoad(USBH_HOST *phost)
+{
+  USBH_EnumCache_TypeDef *entry = USBH_EnumCacheFind(phost);
+  uint8_t i, j;
+  
+  if (entry == 0)
+  {
+    return 0;
+  }
+  
+  phost->device_prop.Cfg_Desc = entry->Cfg_Desc;
+  for (i = 0; i < USBH_MAX_NUM_INTERFACES; i++)
+  {
+    phost->device_prop.Itf_Desc[i] = entry->Itf_Desc[i];
+    for (j = 0; j < USBH_MAX_NUM_ENDPOINTS; j++)
+    {
+      phost->device_prop.Ep_Desc[i][j] = entry->Ep_Desc[i][j];
+    }
+  }
+  return 1;
+}
+
+/**
+  * @brief  USBH_EnumCacheStore
+  *         Keep the parsed configuration of the attached device, replacing
+  *         the oldest entry
+  * @param  phost: Host state structure
+  * @retval None
+  */
+static void USBH_EnumCacheStore(USBH_HOST *phost)
+{
+  USBH_EnumCache_TypeDef *entry = USBH_EnumCacheFind(phost);
+  uint8_t i, j;
+  
+  if (entry == 0)
+  {
+    entry = &USBH_EnumCache[USBH_EnumCacheNext];
+    USBH_EnumCacheNext = (USBH_EnumCacheNext + 1) % USBH_ENUM_CACHE_SIZE;
+  }
+  
+  entry->idVendor  = phost->device_prop.Dev_Desc.idVendor;
+  entry->idProduct = phost->device_prop.Dev_Desc.idProduct;
+  entry->bcdDevice = phost->device_prop.Dev_Desc.bcdDevice;
+  entry->Cfg_Desc  = phost->device_prop.Cfg_Desc;
+  for (i = 0; i < USBH_MAX_NUM_INTERFACES; i++)
+  {
+    entry->Itf_Desc[i] = phost->device_prop.Itf_Desc[i];
+    for (j = 0; j < USBH_MAX_NUM_ENDPOINTS; j++)
+    {
+      entry->Ep_Desc[i][j] = phost->device_prop.Ep_Desc[i][j];
+    }
+  }
+  entry->valid = 1;
+}
+#endif /* USBH_FAST_ENUM_ENABLED */
+
 
 /**
   * @brief  USBH_HandleControl
@@ -679,6 +1041,7 @@ USBH_Status USBH_HandleControl (USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
     { 
       /* In stall case, return to previous machine state*/
       phost->gState =   phost->gStateBkp;
+      phost->Control.state = CTRL_STALLED;
     }   
     else if (URB_Status == URB_ERROR)
     {
@@ -771,6 +1134,7 @@ USBH_Status USBH_HandleControl (USB_OTG_CORE_HANDLE *pdev, USBH_HOST *phost)
     {
       /* Control transfers completed, Exit the State Machine */
       phost->gState =   phost->gStateBkp;
+      phost->Control.state = CTRL_STALLED;
       phost->Control.status = CTRL_STALL;
       status = USBH_NOT_SUPPORTED;
     }
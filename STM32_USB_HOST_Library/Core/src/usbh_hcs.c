@@ -51,6 +51,28 @@
 /** @defgroup USBH_HCS_Private_TypesDefinitions
   * @{
   */ 
+#ifdef USBH_HUB_ENABLED
+/* Where a device sits in the tree: hub and port of its transaction
+   translator when the channels need split transactions */
+typedef struct _DeviceRoute
+{
+  uint8_t  hub_addr;
+  uint8_t  hub_port;
+  uint8_t  split;
+}
+USBH_DeviceRoute_TypeDef;
+#endif
+
+#ifdef USBH_HC_POOL_ENABLED
+/* Channel allocation of one core, bit n standing for channel n */
+typedef struct _HC_Alloc
+{
+  uint32_t  used;
+  uint32_t  reserved;           /* held by the class pools */
+  uint8_t   bind[32];           /* endpoint -> last channel + 1, 0 if none */
+}
+USBH_HC_Alloc_TypeDef;
+#endif
 /**
   * @}
   */ 
@@ -59,6 +81,14 @@
 /** @defgroup USBH_HCS_Private_Macros
   * @{
   */ 
+#ifdef USBH_HC_POOL_ENABLED
+#define HC_BIT(n)                 (0x1UL << (n))
+/* Channels past HC_MAX are never free */
+#define HC_INVALID_MSK            (~(HC_BIT(HC_MAX) - 1))
+/* Endpoint number and direction on 5 bits */
+#define HC_EP_INDEX(ep_addr)      (((ep_addr) & 0x0F) | (((ep_addr) & 0x80) >> 3))
+#define HC_ALLOC(pdev)            (&USBH_HC_Alloc[(pdev)->cfg.coreID])
+#endif
 /**
   * @}
   */ 
@@ -67,6 +97,15 @@
 /** @defgroup USBH_HCS_Private_Variables
   * @{
   */ 
+#ifdef USBH_HUB_ENABLED
+/* Indexed by device address, address 0 being the device in enumeration */
+static USBH_DeviceRoute_TypeDef USBH_DeviceRoute[USBH_MAX_DEVICES + 1];
+#endif
+
+#ifdef USBH_HC_POOL_ENABLED
+/* Indexed by core ID, OTG_HS and OTG_FS */
+static USBH_HC_Alloc_TypeDef USBH_HC_Alloc[2];
+#endif
 
 /**
   * @}
@@ -76,7 +115,16 @@
 /** @defgroup USBH_HCS_Private_FunctionPrototypes
   * @{
   */ 
+#ifdef USBH_HC_POOL_ENABLED
+static uint16_t USBH_GetFreeChannel (USB_OTG_CORE_HANDLE *pdev,
+                                     uint32_t free,
+                                     uint8_t ep_addr);
+#else
 static uint16_t USBH_GetFreeChannel (USB_OTG_CORE_HANDLE *pdev);
+#endif
+#ifdef USBH_HUB_ENABLED
+static void USBH_RouteChannel (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
+#endif
 /**
   * @}
   */ 
@@ -115,10 +163,17 @@ uint8_t USBH_Open_Channel  (USB_OTG_CORE_HANDLE *pdev,
   pdev->host.hc[hc_num].speed = speed; 
   pdev->host.hc[hc_num].toggle_in = 0; 
   pdev->host.hc[hc_num].toggle_out = 0;   
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  /* Set again by USB_OTG_HC_Init from the bits 12:11 of mps */
+  pdev->host.hc[hc_num].multi = 1;
+#endif
   if(speed == HPRT0_PRTSPD_HIGH_SPEED)
   {
     pdev->host.hc[hc_num].do_ping = 1;
   }
+#ifdef USBH_HUB_ENABLED
+  USBH_RouteChannel(pdev, hc_num);
+#endif
   
   USB_OTG_HC_Init(pdev, hc_num) ;
   
@@ -159,6 +214,9 @@ uint8_t USBH_Modify_Channel (USB_OTG_CORE_HANDLE *pdev,
   {
     pdev->host.hc[hc_num].speed = speed; 
   }
+#ifdef USBH_HUB_ENABLED
+  USBH_RouteChannel(pdev, hc_num);
+#endif
   
   USB_OTG_HC_Init(pdev, hc_num);
   return HC_OK; 
@@ -175,7 +233,13 @@ uint8_t USBH_Alloc_Channel  (USB_OTG_CORE_HANDLE *pdev, uint8_t ep_addr)
 {
   uint16_t hc_num;
   
+#ifdef USBH_HC_POOL_ENABLED
+  USBH_HC_Alloc_TypeDef *alloc = HC_ALLOC(pdev);
+  
+  hc_num =  USBH_GetFreeChannel(pdev, ~(alloc->used | alloc->reserved), ep_addr);
+#else
   hc_num =  USBH_GetFreeChannel(pdev);
+#endif
 
   if (hc_num != HC_ERROR)
   {
@@ -195,6 +259,10 @@ uint8_t USBH_Free_Channel  (USB_OTG_CORE_HANDLE *pdev, uint8_t idx)
    if(idx < HC_MAX)
    {
 	 pdev->host.channel[idx] &= HC_USED_MASK;
+#ifdef USBH_HC_POOL_ENABLED
+     /* A pool channel goes back to its pool */
+     HC_ALLOC(pdev)->used &= ~HC_BIT(idx);
+#endif
    }
    return USBH_OK;
 }
@@ -214,9 +282,190 @@ uint8_t USBH_DeAllocate_AllChannel  (USB_OTG_CORE_HANDLE *pdev)
    {
 	 pdev->host.channel[idx] = 0;
    }
+#ifdef USBH_HC_POOL_ENABLED
+   /* The pools and the endpoint bindings are kept for the next device */
+   HC_ALLOC(pdev)->used &= HC_BIT(0) | HC_BIT(1);
+#endif
    return USBH_OK;
 }
 
+#ifdef USBH_HC_POOL_ENABLED
+/**
+  * @brief  USBH_Reserve_Channels
+  *         Top up a class pool to count channels, taken out of the common
+  *         allocation until USBH_Release_Channels. The class allocates from
+  *         it with USBH_Alloc_PoolChannel and frees with USBH_Free_Channel,
+  *         so that a re-plugged device finds its channels at once
+  * @param  pdev : Selected device
+  * @param  pool: Class pool, 0 when empty
+  * @param  count: Channels wanted in the pool
+  * @retval Channels in the pool
+  */
+uint8_t USBH_Reserve_Channels (USB_OTG_CORE_HANDLE *pdev,
+                               uint32_t *pool,
+                               uint8_t count)
+{
+  USBH_HC_Alloc_TypeDef *alloc = HC_ALLOC(pdev);
+  uint32_t free;
+  uint8_t  held = 0;
+  uint8_t  idx;
+  
+  for (idx = 0; idx < HC_MAX; idx++)
+  {
+    if (*pool & HC_BIT(idx))
+    {
+      held++;
+    }
+  }
+  
+  /* Channels 0 and 1 are left for the control pipes */
+  free = ~(alloc->used | alloc->reserved | HC_INVALID_MSK | HC_BIT(0) | HC_BIT(1));
+  while ((held < count) && (free != 0))
+  {
+    idx = __CLZ(__RBIT(free));
+    free &= ~HC_BIT(idx);
+    alloc->reserved |= HC_BIT(idx);
+    *pool |= HC_BIT(idx);
+    held++;
+  }
+  return held;
+}
+
+/**
+  * @brief  USBH_Release_Channels
+  *         Give the channels of a class pool back to the common allocation
+  * @param  pdev : Selected device
+  * @param  pool: Class pool, emptied
+  * @retval None
+  */
+void USBH_Release_Channels (USB_OTG_CORE_HANDLE *pdev, uint32_t *pool)
+{
+  HC_ALLOC(pdev)->reserved &= ~(*pool);
+  *pool = 0;
+}
+
+/**
+  * @brief  USBH_Alloc_PoolChannel
+  *         Allocate a channel of a class pool for the pipe, the channel last
+  *         bound to the endpoint first; from the common allocation when the
+  *         pool is exhausted
+  * @param  pdev : Selected device
+  * @param  pool: Class pool
+  * @param  ep_addr: End point for which the channel to be allocated
+  * @retval hc_num: Host channel number
+  */
+uint8_t USBH_Alloc_PoolChannel (USB_OTG_CORE_HANDLE *pdev,
+                                uint32_t *pool,
+                                uint8_t ep_addr)
+{
+  uint16_t hc_num;
+  
+  hc_num = USBH_GetFreeChannel(pdev, *pool & ~HC_ALLOC(pdev)->used, ep_addr);
+  if (hc_num == HC_ERROR)
+  {
+    return USBH_Alloc_Channel(pdev, ep_addr);
+  }
+  
+  pdev->host.channel[hc_num] = HC_USED | ep_addr;
+  return hc_num;
+}
+#endif
+
+#ifdef USBH_HUB_ENABLED
+/**
+  * @brief  USBH_SetDeviceRoute
+  *         Record the hub port of a device, applied to the channels opened
+  *         for its address. Set by the hub class for address 0 before the
+  *         port reset and for the address the device gets
+  * @param  dev_address: Device address
+  * @param  hub_addr: Address of the hub with the transaction translator
+  * @param  hub_port: Port of that hub
+  * @param  split: 1 for a FS/LS device behind a HS hub
+  * @retval None
+  */
+void USBH_SetDeviceRoute (uint8_t dev_address,
+                          uint8_t hub_addr,
+                          uint8_t hub_port,
+                          uint8_t split)
+{
+  if (dev_address <= USBH_MAX_DEVICES)
+  {
+    USBH_DeviceRoute[dev_address].hub_addr = hub_addr;
+    USBH_DeviceRoute[dev_address].hub_port = hub_port;
+    USBH_DeviceRoute[dev_address].split = split;
+  }
+}
+
+/**
+  * @brief  USBH_RouteChannel
+  *         Set the split parameters of a channel from the route of its
+  *         device address, a channel number being reused across devices
+  * @param  pdev : Selected device
+  * @param  hc_num: Host channel Number
+  * @retval None
+  */
+static void USBH_RouteChannel (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+  uint8_t dev_address = pdev->host.hc[hc_num].dev_addr;
+  
+  if (pdev->host.hc[hc_num].speed != HPRT0_PRTSPD_HIGH_SPEED)
+  {
+    pdev->host.hc[hc_num].do_ping = 0;
+  }
+  
+#ifdef USB_OTG_SPLIT_ENABLED
+  if (dev_address <= USBH_MAX_DEVICES)
+  {
+    pdev->host.hc[hc_num].do_split = USBH_DeviceRoute[dev_address].split;
+    pdev->host.hc[hc_num].hub_addr = USBH_DeviceRoute[dev_address].hub_addr;
+    pdev->host.hc[hc_num].hub_port = USBH_DeviceRoute[dev_address].hub_port;
+  }
+#else
+  /* No transaction translator: only FS/LS hubs on the FS core */
+  (void)dev_address;
+#endif
+}
+#endif
+
+#ifdef USBH_HC_POOL_ENABLED
+/**
+  * @brief  USBH_GetFreeChannel
+  *         Take a channel among the free ones: the channel the endpoint had
+  *         last if it is free, else the lowest one
+  * @param  pdev : Selected device
+  * @param  free: candidate channels, bit n for channel n
+  * @param  ep_addr: End point for which the channel to be allocated
+  * @retval idx: Free Channel number
+  */
+static uint16_t USBH_GetFreeChannel (USB_OTG_CORE_HANDLE *pdev,
+                                     uint32_t free,
+                                     uint8_t ep_addr)
+{
+  USBH_HC_Alloc_TypeDef *alloc = HC_ALLOC(pdev);
+  uint8_t *bind = &alloc->bind[HC_EP_INDEX(ep_addr)];
+  uint8_t idx;
+  
+  free &= ~HC_INVALID_MSK;
+  
+  /* Control pipes are per device, they are not bound */
+  if (((ep_addr & 0x7F) != 0) && (*bind != 0) && (free & HC_BIT(*bind - 1)))
+  {
+    idx = *bind - 1;
+  }
+  else if (free != 0)
+  {
+    idx = __CLZ(__RBIT(free));
+  }
+  else
+  {
+    return HC_ERROR;
+  }
+  
+  alloc->used |= HC_BIT(idx);
+  *bind = idx + 1;
+  return idx;
+}
+#else
 /**
   * @brief  USBH_GetFreeChannel
   *         Get a free channel number for allocation to a device endpoint
@@ -236,6 +485,7 @@ static uint16_t USBH_GetFreeChannel (USB_OTG_CORE_HANDLE *pdev)
   }
   return HC_ERROR;
 }
+#endif
 
 
 /**
@@ -28,6 +28,10 @@
 
 #include "usbh_ioreq.h"
 
+#if defined (USBH_CTL_PIPELINE_ENABLED) && !defined (USB_OTG_URB_NOTIFY_ENABLED)
+ #error "USBH_CTL_PIPELINE_ENABLED needs USB_OTG_URB_NOTIFY_ENABLED"
+#endif
+
 /** @addtogroup USBH_LIB
   * @{
   */
@@ -70,6 +74,11 @@
 /** @defgroup USBH_IOREQ_Private_Variables
   * @{
   */ 
+#ifdef USBH_CTL_PIPELINE_ENABLED
+static USBH_HOST *CtlHost;                  /* Host of the last SETUP submitted */
+static __IO uint8_t CtlLock;                /* Foreground in the state machine */
+static __IO uint8_t CtlPending;             /* URB event left to the foreground */
+#endif
 /**
   * @}
   */ 
@@ -81,6 +90,11 @@
 static USBH_Status USBH_SubmitSetupRequest(USBH_HOST *phost,
                                            uint8_t* buff, 
                                            uint16_t length);
+#ifdef USBH_CTL_PIPELINE_ENABLED
+static void USBH_CtlAdvance(USB_OTG_CORE_HANDLE *pdev,
+                            USBH_HOST *phost);
+static void USBH_CtlBatchNext(USBH_HOST *phost);
+#endif
 
 /**
   * @}
@@ -117,6 +131,10 @@ USBH_Status USBH_CtlReq     (USB_OTG_CORE_HANDLE *pdev,
     USBH_SubmitSetupRequest(phost, buff, length);
     phost->RequestState = CMD_WAIT;
     status = USBH_BUSY;
+#ifdef USBH_CTL_PIPELINE_ENABLED
+    /* SETUP sent now, the next stages from the URB interrupt */
+    USBH_CtlProcess(pdev, phost);
+#endif
     break;
     
   case CMD_WAIT:
@@ -147,6 +165,189 @@ USBH_Status USBH_CtlReq     (USB_OTG_CORE_HANDLE *pdev,
   return status;
 }
 
+#ifdef USBH_CTL_PIPELINE_ENABLED
+/**
+  * @brief  USBH_CtlReqBatch
+  *         Sends several control requests back-to-back: the SETUP of each
+  *         request goes out from the URB interrupt as the previous one
+  *         completes. A stalled request does not stop the batch, a failed
+  *         one does. Called until it returns another status than USBH_BUSY,
+  *         like USBH_CtlReq
+  * @param  pdev: Selected device
+  * @param  phost: Selected host
+  * @param  batch: Requests, each status set on its completion. The array
+  *         must stay valid until the batch ends
+  * @param  count: Number of requests
+  * @retval Status: USBH_OK when all the requests ran (see their status),
+  *         USBH_FAIL when one of them failed
+  */
+USBH_Status USBH_CtlReqBatch (USB_OTG_CORE_HANDLE *pdev,
+                              USBH_HOST *phost, 
+                              USBH_CtlBatch_TypeDef *batch,
+                              uint8_t count)
+{
+  USBH_Status status = USBH_BUSY;
+  
+  switch (phost->RequestState)
+  {
+  case CMD_SEND:
+    if (count == 0)
+    {
+      status = USBH_OK;
+      break;
+    }
+    
+    phost->Control.batch = batch;
+    phost->Control.batch_count = count;
+    phost->Control.batch_idx = 0;
+    phost->Control.batch_status = USBH_BUSY;
+    phost->Control.setup = batch[0].setup;
+    
+    /* Start the SETUP transfer of the first request */
+    USBH_SubmitSetupRequest(phost, batch[0].buff, batch[0].setup.b.wLength.w);
+    phost->RequestState = CMD_WAIT;
+    USBH_CtlProcess(pdev, phost);
+    break;
+    
+  case CMD_WAIT:
+    if (phost->Control.batch_status != USBH_BUSY)
+    {
+      phost->RequestState = CMD_SEND;
+      phost->Control.state = CTRL_IDLE;
+      status = phost->Control.batch_status;
+    }
+    break;
+    
+  default:
+    break;
+  }
+  return status;
+}
+
+/**
+  * @brief  USBH_CtlProcess
+  *         Runs the control transfer state machine from the foreground. The
+  *         URB events of the control channels arriving meanwhile are left
+  *         to it by the interrupt and handled before leaving
+  * @param  pdev: Selected device
+  * @param  phost: Selected host
+  * @retval None
+  */
+void USBH_CtlProcess (USB_OTG_CORE_HANDLE *pdev,
+                      USBH_HOST *phost)
+{
+  CtlLock = 1;
+  do
+  {
+    CtlPending = 0;
+    USBH_CtlAdvance(pdev, phost);
+  }
+  while (CtlPending);
+  CtlLock = 0;
+}
+
+/**
+  * @brief  USBH_CtlURBNotify
+  *         URB state change of a channel, from the interrupt: the stages of
+  *         the control transfer of the host which submitted the last SETUP
+  *         follow each other from here without waiting for the next poll.
+  *         The timeouts are still checked by the polls
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number
+  * @retval None
+  */
+void USBH_CtlURBNotify (USB_OTG_CORE_HANDLE *pdev,
+                        uint8_t hc_num)
+{
+  USBH_HOST *phost = CtlHost;
+  
+  if ((phost == 0) ||
+      ((hc_num != phost->Control.hc_num_in) && (hc_num != phost->Control.hc_num_out)) ||
+      (phost->gState != HOST_CTRL_XFER))
+  {
+    return;
+  }
+  
+  if (CtlLock)
+  {
+    /* The foreground runs the state machine again before leaving it */
+    CtlPending = 1;
+    return;
+  }
+  
+  USBH_CtlAdvance(pdev, phost);
+}
+
+/**
+  * @brief  USBH_CtlAdvance
+  *         Runs the control transfer state machine while its stages
+  *         complete, and goes on with the next request of a batch
+  * @param  pdev: Selected device
+  * @param  phost: Selected host
+  * @retval None
+  */
+static void USBH_CtlAdvance(USB_OTG_CORE_HANDLE *pdev,
+                            USBH_HOST *phost)
+{
+  CTRL_State state;
+  
+  do
+  {
+    state = phost->Control.state;
+    USBH_HandleControl(pdev, phost);
+    
+    if ((phost->gState != HOST_CTRL_XFER) &&
+        (phost->Control.batch_status == USBH_BUSY))
+    {
+      USBH_CtlBatchNext(phost);
+    }
+  }
+  /* Stop on a URB in progress or at the end of the transfer */
+  while ((state != phost->Control.state) &&
+         (phost->gState == HOST_CTRL_XFER));
+}
+
+/**
+  * @brief  USBH_CtlBatchNext
+  *         Records the result of the request of the batch just ended and
+  *         prepares the SETUP of the next one
+  * @param  phost: Selected host
+  * @retval None
+  */
+static void USBH_CtlBatchNext(USBH_HOST *phost)
+{
+  USBH_CtlBatch_TypeDef *req = &phost->Control.batch[phost->Control.batch_idx];
+  
+  if (phost->Control.state == CTRL_COMPLETE)
+  {
+    req->status = USBH_OK;
+  }
+  else if (phost->Control.state == CTRL_ERROR)
+  {
+    req->status = USBH_FAIL;
+  }
+  else
+  {
+    req->status = USBH_NOT_SUPPORTED;
+  }
+  
+  if ((req->status == USBH_FAIL) ||
+      (++phost->Control.batch_idx >= phost->Control.batch_count))
+  {
+    phost->Control.batch_status = (req->status == USBH_FAIL) ? USBH_FAIL : USBH_OK;
+    return;
+  }
+  
+  /* Same state as after USBH_SubmitSetupRequest, gStateBkp kept */
+  req++;
+  phost->Control.setup = req->setup;
+  phost->Control.buff = req->buff;
+  phost->Control.length = req->setup.b.wLength.w;
+  phost->Control.state = CTRL_SETUP;
+  phost->gState = HOST_CTRL_XFER;
+}
+#endif /* USBH_CTL_PIPELINE_ENABLED */
+
 /**
   * @brief  USBH_CtlSendSetup
   *         Sends the Setup Packet to the Device
@@ -390,6 +591,9 @@ static USBH_Status USBH_SubmitSetupRequest(USBH_HOST *phost,
   
   /* Save Global State */
   phost->gStateBkp =   phost->gState; 
+#ifdef USBH_CTL_PIPELINE_ENABLED
+  CtlHost = phost;
+#endif
   
   /* Prepare the Transactions */
   phost->gState = HOST_CTRL_XFER;
@@ -452,6 +656,53 @@ USBH_Status USBH_IsocSendData( USB_OTG_CORE_HANDLE *pdev,
   return USBH_OK;
 }
 
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+/**
+  * @brief  USBH_IsocStartStream
+  *         Streams an Isochronous Endpoint on two buffers, one per frame:
+  *         the channel is re-armed from the interrupt and BufferDone is
+  *         called (in interrupt context) with each buffer filled (IN) or
+  *         sent (OUT). The direction is the one the channel was opened with
+  * @param  pdev: Selected device
+  * @param  buff0: First buffer
+  * @param  buff1: Second buffer
+  * @param  length: Length of one buffer, at most one frame of packets
+  * @param  hc_num: Host channel Number
+  * @param  BufferDone: Buffer completion callback
+  * @retval Status. 
+  */
+USBH_Status USBH_IsocStartStream( USB_OTG_CORE_HANDLE *pdev, 
+                                  uint8_t *buff0, 
+                                  uint8_t *buff1, 
+                                  uint32_t length,
+                                  uint8_t hc_num,
+                                  void (*BufferDone) (void *pdev,
+                                                      uint8_t hc_num,
+                                                      uint8_t *buff,
+                                                      uint32_t count))
+{
+  if (HCD_IsocStream_Start(pdev, hc_num, buff0, buff1, length, BufferDone) != 0)
+  {
+    return USBH_FAIL;
+  }
+  
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_IsocStopStream
+  *         Stops the stream started by USBH_IsocStartStream
+  * @param  pdev: Selected device
+  * @param  hc_num: Host channel Number
+  * @retval None
+  */
+void USBH_IsocStopStream( USB_OTG_CORE_HANDLE *pdev, 
+                          uint8_t hc_num)
+{
+  HCD_IsocStream_Stop(pdev, hc_num);
+}
+#endif
+
 /**
 * @}
 */ 
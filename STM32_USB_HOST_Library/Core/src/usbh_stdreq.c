@@ -408,8 +408,12 @@ static void  USBH_ParseCfgDesc (USBH_CfgDesc_TypeDef* cfg_desc,
   uint16_t                      ptr;
   int8_t                        if_ix = 0;
   int8_t                        ep_ix = 0;  
+#ifdef USBH_FAST_ENUM_ENABLED
+  uint8_t                       index;
+#else
   static uint16_t               prev_ep_size = 0;
   static uint8_t                prev_itf = 0;  
+#endif
   
   
   pdesc   = (USBH_DescHeader_t *)buf;
@@ -425,6 +429,83 @@ static void  USBH_ParseCfgDesc (USBH_CfgDesc_TypeDef* cfg_desc,
   cfg_desc->bMaxPower           = *(uint8_t  *) (buf + 8);    
   
   
+#ifdef USBH_FAST_ENUM_ENABLED
+  if (length > cfg_desc->wTotalLength)
+  {
+    length = cfg_desc->wTotalLength;
+  }
+  
+  if ((length > USB_CONFIGURATION_DESC_SIZE) &&
+      (cfg_desc->bNumInterfaces <= USBH_MAX_NUM_INTERFACES))
+  {
+    /* Single walk: each endpoint goes to the interface descriptor it
+       follows. Of the alternate settings 0 to 2 of an interface, a later
+       one replaces the kept one when its first endpoint is not smaller. */
+    uint8_t  take = 0;     /* 0: skip, 1: kept, 2: alternate, undecided */
+    uint32_t seen = 0;
+    
+    pif = (USBH_InterfaceDesc_TypeDef *)0;
+    ptr = USB_LEN_CFG_DESC;
+    
+    while (((ptr + 2) <= length) && (buf[ptr] >= 2) && 
+           ((ptr + buf[ptr]) <= length))
+    {
+      pdesc = (USBH_DescHeader_t *)(buf + ptr);
+      
+      if ((pdesc->bDescriptorType == USB_DESC_TYPE_INTERFACE) &&
+          (pdesc->bLength >= USB_INTERFACE_DESC_SIZE))
+      {
+        take  = 0;
+        if ((buf[ptr + 2] < USBH_MAX_NUM_INTERFACES) && (buf[ptr + 3] < 3))
+        {
+          if_ix = buf[ptr + 2];
+          USBH_ParseInterfaceDesc (&temp_pif, (uint8_t *)pdesc);
+          pif   = &itf_desc[if_ix];
+          ep_ix = 0;
+          if ((seen & (1 << if_ix)) == 0)
+          {
+            seen |= (1 << if_ix);
+            USBH_ParseInterfaceDesc (pif, (uint8_t *)&temp_pif);
+            for (index = 0; index < USBH_MAX_NUM_ENDPOINTS; index++)
+            {
+              ep_desc[if_ix][index].wMaxPacketSize = 0;
+            }
+            take = 1;
+          }
+          else
+          {
+            take = 2;
+          }
+        }
+      }
+      else if ((pdesc->bDescriptorType == USB_DESC_TYPE_ENDPOINT) &&
+               (pdesc->bLength >= USB_ENDPOINT_DESC_SIZE) && (take != 0))
+      {
+        if (take == 2)
+        {
+          /* First endpoint of an alternate setting */
+          if (LE16((uint8_t *)pdesc + 4) < ep_desc[if_ix][0].wMaxPacketSize)
+          {
+            take = 0;
+          }
+          else
+          {
+            USBH_ParseInterfaceDesc (pif, (uint8_t *)&temp_pif);
+            take = 1;
+          }
+        }
+        if ((take == 1) && (ep_ix < temp_pif.bNumEndpoints) &&
+            (ep_ix < USBH_MAX_NUM_ENDPOINTS))
+        {
+          pep = &ep_desc[if_ix][ep_ix];
+          USBH_ParseEPDesc (pep, (uint8_t *)pdesc);
+          ep_ix++;
+        }
+      }
+      ptr += pdesc->bLength;
+    }
+  }
+#else
   if (length > USB_CONFIGURATION_DESC_SIZE)
   {
     ptr = USB_LEN_CFG_DESC;
@@ -485,6 +566,7 @@ static void  USBH_ParseCfgDesc (USBH_CfgDesc_TypeDef* cfg_desc,
     prev_ep_size = 0;
     prev_itf = 0; 
   }  
+#endif /* USBH_FAST_ENUM_ENABLED */
 }
 
 
@@ -176,6 +176,12 @@
  #endif
  #define USB_OTG_HS_INTERNAL_DMA_ENABLED
  #define USB_OTG_HS_DEDICATED_EP1_ENABLED
+
+/* High-bandwidth isochronous endpoints and channels: bits 12:11 of the
+   wMaxPacketSize given to DCD_EP_Open/USBH_Open_Channel add 1 or 2
+   transactions per microframe (up to 3 x 1024 bytes). The Tx FIFO of such
+   an IN endpoint (or TXH_P_HS_FIFOSIZ) must hold all the transactions */
+// #define USB_OTG_HS_HIGH_BW_ENABLED
 #endif
 
 /****************** USB OTG FS CONFIGURATION **********************************/
@@ -190,11 +196,96 @@
 
 // #define USB_OTG_FS_LOW_PWR_MGMT_SUPPORT
 // #define USB_OTG_FS_SOF_OUTPUT_ENABLED
+
+/* FIFO data moved by a DMA2 memory to memory stream (see usb_fifo_dma.h) */
+// #define USB_OTG_FS_DMA_FIFO_ENABLED
 #endif
 
 /****************** USB OTG MISC CONFIGURATION ********************************/
 //#define VBUS_SENSING_ENABLED
 
+/* Per-endpoint IN transfer queue: DCD_EP_QueueTx() buffers are chained from
+   the transfer complete interrupt without a round trip through the class */
+// #define USB_OTG_EP_QUEUE_ENABLED
+// #define USB_OTG_EP_QUEUE_DEPTH                  4
+
+/* OUT endpoints filled straight into application buffers posted with
+   DCD_EP_PostRx(), without the class buffer copy */
+// #define USB_OTG_EP_RX_POOL_ENABLED
+// #define USB_OTG_EP_RX_POOL_DEPTH                4
+
+/* DCD_EP_TxSG()/DCD_EP_PrepareRxSG() scatter/gather transfers, re-armed
+   segment by segment from the transfer complete interrupt */
+// #define USB_OTG_EP_SG_ENABLED
+
+/* EP0 IN data stages moved as many packets per transfer as DIEPTSIZ0 holds
+   (3 packets, 127 bytes) instead of one packet per interrupt */
+// #define USB_OTG_EP0_MULTI_PACKET_ENABLED
+
+/* Device: USBD_CtlPrepareRxStream() data stages, each EP0 OUT packet being
+   received where the EP0_RxBuffer class callback says */
+// #define USB_OTG_EP0_RX_STREAM_ENABLED
+
+/* Host: start the non control transfers from the SOF interrupt, periodic
+   channels reserved with HCD_Sched_Reserve() first */
+// #define USB_OTG_HCD_SCHED_ENABLED
+
+/* Host: HCD_IsocStream_Start() keeps an isochronous channel running on two
+   buffers, re-armed for the next frame from the channel halted interrupt */
+// #define USB_OTG_HCD_ISOC_STREAM_ENABLED
+
+/* Interrupt events are queued and dispatched by USBD_Process() or
+   USBH_ProcessEvents() from the application thread */
+// #define USB_OTG_EVENT_QUEUE_ENABLED
+// #define USB_OTG_EVENT_QUEUE_SIZE                32
+
+/* Max. number of GINTSTS snapshots served by one USBD_OTG_ISR_Handler call:
+   events raised while the handler runs are served without a new exception
+   entry */
+// #define USB_OTG_ISR_MAX_LOOPS                   4
+
+/* Per endpoint / per channel traffic counters, OTG interrupt timing and
+   device transfer latency histograms from the DWT cycle counter, read
+   through the USB_OTG_Stats_xx functions */
+// #define USB_OTG_STATS_ENABLED
+
+/* Device: TIM2 sampling timebase phase locked to the SOF through the SOF
+   output of the core and the ITR1 input of TIM2 (see usb_timebase.h) */
+// #define USB_OTG_SOF_TIMEBASE_ENABLED
+
+/* Host: USBH_HCD_INT_fops->URBChange is called from the interrupt when the
+   URB state of a channel changes, e.g. to wake a task waiting for it */
+// #define USB_OTG_URB_NOTIFY_ENABLED
+
+/* Suspend/resume without busy waits: the core and PHY clocks are kept during
+   suspend (sleep instead of stop) so that the resume needs no clock restart,
+   and the remote wakeup signalling is stopped by USB_OTG_PowerTick, to be
+   called every 1 ms */
+// #define USB_OTG_FAST_RESUME_ENABLED
+// #define USB_OTG_RMTWKUP_TIME                    5
+
+/* Device: USBD_DEVICE gets a GetBOSDescriptor member serving the BOS
+   descriptor (e.g. USBD_VENDOR_GetBOSDesc for the MS OS 2.0 descriptors),
+   and the vendor requests to the device are passed to the class Setup; the
+   device descriptor must declare bcdUSB 0x0201 or above */
+// #define USB_SUPPORT_BOS_DESC
+
+/* USB 2.0 LPM (L1 sleep) on the OTG cores with a GLPMCFG register (not the
+   STM32F2xx/F4xx OTG_FS/OTG_HS). Implies USB_OTG_FAST_RESUME_ENABLED; the
+   device descriptor must declare bcdUSB 0x0201 */
+// #define USB_OTG_LPM_ENABLED
+
+/* Host: split transactions for FS/LS devices behind a HS hub, one packet
+   per SSPLIT/CSPLIT pair (needed by the host hub class on OTG_HS) */
+// #define USB_OTG_SPLIT_ENABLED
+
+/* OTG dual role (USE_OTG_MODE with USE_DEVICE_MODE and USE_HOST_MODE): a
+   connector ID change reprograms only the mode registers and the FIFOs, the
+   device and host contexts are kept, and the device class is parked with its
+   Suspend callback and restarted with its Resume callback at the next
+   SET_CONFIGURATION instead of DeInit/Init */
+// #define USB_OTG_DUAL_ROLE_ENABLED
+
 /****************** USB OTG MODE CONFIGURATION ********************************/
 //#define USE_HOST_MODE
 #define USE_DEVICE_MODE
@@ -71,6 +71,42 @@
   */ 
 #define   MAX_DATA_LENGTH                        0x200
 
+#ifdef USB_OTG_EP_QUEUE_ENABLED
+ #ifndef USB_OTG_EP_QUEUE_DEPTH
+  #define USB_OTG_EP_QUEUE_DEPTH                 4
+ #endif
+#endif
+
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+ #ifndef USB_OTG_EVENT_QUEUE_SIZE
+  #define USB_OTG_EVENT_QUEUE_SIZE               32
+ #endif
+#endif
+
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+ #ifndef USB_OTG_EP_RX_POOL_DEPTH
+  #define USB_OTG_EP_RX_POOL_DEPTH               4
+ #endif
+#endif
+
+/* L1 is left through the fast resume path */
+#if defined (USB_OTG_LPM_ENABLED) && !defined (USB_OTG_FAST_RESUME_ENABLED)
+ #define USB_OTG_FAST_RESUME_ENABLED
+#endif
+
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+ /* Remote wakeup signalling time, in USB_OTG_PowerTick periods (1 ms) */
+ #ifndef USB_OTG_RMTWKUP_TIME
+  #define USB_OTG_RMTWKUP_TIME                   5
+ #endif
+
+ /* Link power states, dev.power_state */
+ #define USB_OTG_PWR_L0                          0
+ #define USB_OTG_PWR_L1                          1
+ #define USB_OTG_PWR_L2                          2
+ #define USB_OTG_PWR_RESUMING                    3
+#endif
+
 /** @defgroup USB_CORE_Exported_Types
   * @{
   */ 
@@ -91,6 +127,9 @@ typedef enum {
   HC_XACTERR,  
   HC_BBLERR,   
   HC_DATATGLERR,  
+#ifdef USB_OTG_SPLIT_ENABLED
+  HC_SPLIT,       /* Halted to issue the next split transaction */
+#endif
 }HC_STATUS;
 
 typedef enum {
@@ -130,9 +169,78 @@ typedef struct USB_OTG_hc
   uint8_t       toggle_in;
   uint8_t       toggle_out;
   uint32_t       dma_addr;  
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  uint8_t       multi;          /* Transactions per microframe, 1 to 3 */
+#endif
+#ifdef USB_OTG_SPLIT_ENABLED
+  uint8_t       do_split;       /* FS/LS device behind a HS hub */
+  uint8_t       hub_addr;
+  uint8_t       hub_port;
+  uint8_t       comp_split;     /* Next transaction is the CSPLIT */
+  uint32_t      split_len;      /* Length of the URB being split */
+  uint32_t      split_count;    /* Bytes done by the finished splits */
+#endif
 }
 USB_OTG_HC , *PUSB_OTG_HC;
 
+#ifdef USB_OTG_STATS_ENABLED
+/* Traffic counters, updated from the interrupt handlers */
+typedef struct USB_OTG_ep_stats
+{
+  uint32_t       bytes;
+  uint32_t       packets;
+  uint32_t       nak;           /* IN token with an empty FIFO (device) */
+  uint32_t       nyet;
+  uint32_t       txfifo_wait;   /* packet left for lack of Tx FIFO space */
+  uint32_t       xfer_start;    /* cycle counter when the transfer started */
+}
+USB_OTG_EP_STATS , *PUSB_OTG_EP_STATS;
+
+/* Latency of the non control transfers of one direction, from the start of
+   the transfer to its transfer complete interrupt, in CPU cycles: log2
+   histogram with 4 bins per octave (see USB_OTG_Stats_XferBin) */
+#define USB_OTG_XFER_HIST_BINS                  96
+
+typedef struct USB_OTG_xfer_stats
+{
+  uint32_t       count;
+  uint32_t       cyc_max;
+  uint32_t       hist[USB_OTG_XFER_HIST_BINS];
+}
+USB_OTG_XFER_STATS , *PUSB_OTG_XFER_STATS;
+
+/* Time spent in the OTG interrupt handler, in CPU cycles */
+typedef struct USB_OTG_isr_stats
+{
+  uint32_t       count;
+  uint32_t       cyc_min;
+  uint32_t       cyc_max;
+  uint32_t       cyc_sum;
+  uint32_t       cyc_start;
+}
+USB_OTG_ISR_STATS , *PUSB_OTG_ISR_STATS;
+#endif
+
+#if defined (USB_OTG_EP_QUEUE_ENABLED) || defined (USB_OTG_EP_RX_POOL_ENABLED) || \
+    defined (USB_OTG_EP_SG_ENABLED)
+typedef struct USB_OTG_ep_xfer
+{
+  uint8_t        *buf;
+  uint32_t       len;
+}
+USB_OTG_EP_XFER , *PUSB_OTG_EP_XFER;
+#endif
+
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+struct USB_OTG_handle;
+
+/* Called from the interrupt with a filled application buffer */
+typedef void (*USB_OTG_EP_RXDONE)(struct USB_OTG_handle *pdev,
+                                  uint8_t epnum,
+                                  uint8_t *buf,
+                                  uint32_t len);
+#endif
+
 typedef struct USB_OTG_ep
 {
   uint8_t        num;
@@ -143,6 +251,9 @@ typedef struct USB_OTG_ep
   uint8_t        even_odd_frame;
   uint16_t       tx_fifo_num;
   uint32_t       maxpacket;
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  uint8_t        mult;          /* Transactions per microframe, 1 to 3 */
+#endif
   /* transaction level variables*/
   uint8_t        *xfer_buff;
   uint32_t       dma_addr;  
@@ -152,6 +263,33 @@ typedef struct USB_OTG_ep
   uint32_t       rem_data_len;
   uint32_t       total_data_len;
   uint32_t       ctl_data_len;  
+#ifdef USB_OTG_EP_QUEUE_ENABLED
+  /* Queued transfers, started from the transfer complete interrupt */
+  USB_OTG_EP_XFER xfer_queue[USB_OTG_EP_QUEUE_DEPTH];
+  __IO uint8_t   queue_head;
+  __IO uint8_t   queue_tail;
+  __IO uint8_t   queue_busy;
+#endif
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+  /* Application receive buffers, filled in turn by the OUT transfers */
+  USB_OTG_EP_XFER rx_pool[USB_OTG_EP_RX_POOL_DEPTH];
+  __IO uint8_t   rx_head;
+  __IO uint8_t   rx_tail;
+  __IO uint8_t   rx_busy;
+  USB_OTG_EP_RXDONE RxDone;
+#endif
+#ifdef USB_OTG_EP_SG_ENABLED
+  /* Scatter/gather list, one segment (or segment chunk) per transfer */
+  const USB_OTG_EP_XFER *sg_list;
+  uint32_t       sg_offset;
+  uint32_t       sg_chunk;
+  uint32_t       sg_done;
+  uint8_t        sg_count;
+  uint8_t        sg_index;
+#endif
+#ifdef USB_OTG_STATS_ENABLED
+  USB_OTG_EP_STATS stats;
+#endif
 
 }
 
@@ -195,6 +333,9 @@ typedef struct _Device_TypeDef
   uint8_t  *(*GetSerialStrDescriptor)( uint8_t speed , uint16_t *length);  
   uint8_t  *(*GetConfigurationStrDescriptor)( uint8_t speed , uint16_t *length);  
   uint8_t  *(*GetInterfaceStrDescriptor)( uint8_t speed , uint16_t *length);   
+#ifdef USB_SUPPORT_BOS_DESC
+  uint8_t  *(*GetBOSDescriptor)( uint8_t speed , uint16_t *length);
+#endif
 } USBD_DEVICE, *pUSBD_DEVICE;
 
 //typedef struct USB_OTG_hPort
@@ -230,6 +371,18 @@ typedef struct _Device_cb
 #ifdef USB_SUPPORT_USER_STRING_DESC 
   uint8_t  *(*GetUsrStrDescriptor)( uint8_t speed ,uint8_t index,  uint16_t *length);   
 #endif  
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  /* Optional: used instead of DeInit/Init around a host role session, the
+     class keeps its buffers and state */
+  uint8_t  (*Suspend)      (void *pdev , uint8_t cfgidx);
+  uint8_t  (*Resume)       (void *pdev , uint8_t cfgidx);
+#endif
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+  /* Optional: destination of the len bytes at offset of a data stage
+     started with USBD_CtlPrepareRxStream, called before each packet. NULL
+     stalls the request. */
+  uint8_t  *(*EP0_RxBuffer) (void *pdev , uint16_t offset , uint16_t len);
+#endif
   
 } USBD_Class_cb_TypeDef;
 
@@ -266,10 +419,52 @@ typedef struct _DCD
   USBD_Usr_cb_TypeDef           *usr_cb;
   USBD_DEVICE                   *usr_device;  
   uint8_t        *pConfig_descriptor;
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+  __IO uint8_t   power_state;
+  __IO uint8_t   rmtwkup_timer;     /* ms of remote wakeup signalling left */
+#endif
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  uint8_t        role_suspended;    /* class parked by a switch to host */
+#endif
+#ifdef USB_OTG_EP0_RX_STREAM_ENABLED
+  uint8_t        ctl_rx_stream;     /* data stage through EP0_RxBuffer */
+#endif
  }
 DCD_DEV , *DCD_PDEV;
 
 
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+typedef struct USB_OTG_hc_sched
+{
+  uint16_t       interval;      /* frames between periodic starts, 0 = none */
+  uint16_t       budget;        /* reserved bus time, bytes per frame */
+  uint16_t       next_frame;
+  uint16_t       submit_frame;
+  __IO uint8_t   pending;
+  /* Submit to start latency, in frames */
+  uint16_t       lat_max;
+  uint32_t       lat_sum;
+  uint32_t       xfer_num;
+}
+USB_OTG_HC_SCHED , *PUSB_OTG_HC_SCHED;
+#endif
+
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+/* Isochronous stream: one buffer on the channel, the other with the app */
+typedef struct USB_OTG_hc_isoc
+{
+  uint8_t        *buff[2];
+  uint32_t       length;        /* bytes per buffer, one (micro)frame */
+  uint32_t       missed;        /* frames lost to overruns or errors */
+  /* Called from the interrupt with the buffer just filled (IN) or sent (OUT) */
+  void           (*BufferDone) (void *pdev, uint8_t hc_num,
+                                uint8_t *buff, uint32_t count);
+  __IO uint8_t   active;
+  uint8_t        idx;           /* buffer armed on the channel */
+}
+USB_OTG_HC_ISOC , *PUSB_OTG_HC_ISOC;
+#endif
+
 typedef struct _HCD
 {
   uint8_t                  Rx_Buffer [MAX_DATA_LENGTH];  
@@ -280,16 +475,52 @@ typedef struct _HCD
   __IO URB_STATE           URB_State[USB_OTG_MAX_TX_FIFOS];
   USB_OTG_HC               hc [USB_OTG_MAX_TX_FIFOS];
   uint16_t                 channel [USB_OTG_MAX_TX_FIFOS];
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+  USB_OTG_HC_SCHED         sched [USB_OTG_MAX_TX_FIFOS];
+  uint16_t                 periodic_budget;
+  __IO int32_t             frame_left;
+  uint8_t                  sched_next;
+#endif
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+  USB_OTG_HC_ISOC          isoc [USB_OTG_MAX_TX_FIFOS];
+#endif
+#ifdef USB_OTG_STATS_ENABLED
+  USB_OTG_EP_STATS         hc_stats [USB_OTG_MAX_TX_FIFOS];
+#endif
 //  USB_OTG_hPort_TypeDef    *port_cb;  
 }
 HCD_DEV , *USB_OTG_USBH_PDEV;
 
 
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+typedef struct USB_OTG_event
+{
+  uint8_t        type;
+  uint8_t        num;
+  uint16_t       data;
+}
+USB_OTG_EVENT , *PUSB_OTG_EVENT;
+
+typedef struct USB_OTG_event_queue
+{
+  USB_OTG_EVENT  ring [USB_OTG_EVENT_QUEUE_SIZE];
+  __IO uint16_t  head;          /* written by the interrupt only */
+  __IO uint16_t  tail;          /* written by the stack thread only */
+  __IO uint8_t   sof_queued;
+  __IO uint32_t  overflow;
+}
+USB_OTG_EVENT_QUEUE , *PUSB_OTG_EVENT_QUEUE;
+#endif
+
 typedef struct _OTG
 {
   uint8_t    OTG_State;
   uint8_t    OTG_PrevState;  
   uint8_t    OTG_Mode;    
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  uint32_t   SwitchCount;       /* role switches done */
+  uint32_t   SwitchFail;        /* switches where the core kept its mode */
+#endif
 }
 OTG_DEV , *USB_OTG_USBO_PDEV;
 
@@ -306,6 +537,15 @@ typedef struct USB_OTG_handle
 #ifdef USE_OTG_MODE
   OTG_DEV     otg;
 #endif
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+  USB_OTG_EVENT_QUEUE evq;
+#endif
+#ifdef USB_OTG_STATS_ENABLED
+  USB_OTG_ISR_STATS isr_stats;
+#ifdef USE_DEVICE_MODE
+  USB_OTG_XFER_STATS xfer_stats[2];   /* 0: IN, 1: OUT */
+#endif
+#endif
 }
 USB_OTG_CORE_HANDLE , *PUSB_OTG_CORE_HANDLE;
 
@@ -365,6 +605,9 @@ USB_OTG_STS  USB_OTG_EnableHostInt   (USB_OTG_CORE_HANDLE *pdev);
 USB_OTG_STS  USB_OTG_HC_Init         (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
 USB_OTG_STS  USB_OTG_HC_Halt         (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
 USB_OTG_STS  USB_OTG_HC_StartXfer    (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
+#ifdef USB_OTG_SPLIT_ENABLED
+USB_OTG_STS  USB_OTG_HC_SplitXfer    (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
+#endif
 USB_OTG_STS  USB_OTG_HC_DoPing       (USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num);
 uint32_t     USB_OTG_ReadHostAllChannels_intr    (USB_OTG_CORE_HANDLE *pdev);
 uint32_t     USB_OTG_ResetPort       (USB_OTG_CORE_HANDLE *pdev);
@@ -373,6 +616,9 @@ void         USB_OTG_DriveVbus       (USB_OTG_CORE_HANDLE *pdev, uint8_t state);
 void         USB_OTG_InitFSLSPClkSel (USB_OTG_CORE_HANDLE *pdev ,uint8_t freq);
 uint8_t      USB_OTG_IsEvenFrame     (USB_OTG_CORE_HANDLE *pdev) ;
 void         USB_OTG_StopHost        (USB_OTG_CORE_HANDLE *pdev);
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+USB_OTG_STS  USB_OTG_CoreSwitchHost  (USB_OTG_CORE_HANDLE *pdev);
+#endif
 #endif
 /********************* DEVICE APIs ********************************************/
 #ifdef USE_DEVICE_MODE
@@ -395,9 +641,15 @@ uint8_t      USBH_IsEvenFrame (USB_OTG_CORE_HANDLE *pdev);
 void         USB_OTG_EP0_OutStart(USB_OTG_CORE_HANDLE *pdev);
 void         USB_OTG_ActiveRemoteWakeup(USB_OTG_CORE_HANDLE *pdev);
 void         USB_OTG_UngateClock(USB_OTG_CORE_HANDLE *pdev);
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+void         USB_OTG_PowerTick(USB_OTG_CORE_HANDLE *pdev);
+#endif
 void         USB_OTG_StopDevice(USB_OTG_CORE_HANDLE *pdev);
 void         USB_OTG_SetEPStatus (USB_OTG_CORE_HANDLE *pdev , USB_OTG_EP *ep , uint32_t Status);
 uint32_t     USB_OTG_GetEPStatus(USB_OTG_CORE_HANDLE *pdev ,USB_OTG_EP *ep);
+USB_OTG_STS  USB_OTG_SetFifoPlan (USB_OTG_CORE_HANDLE *pdev ,
+                                  uint16_t rx_size ,
+                                  uint16_t *tx_size);
 #endif
 /**
   * @}
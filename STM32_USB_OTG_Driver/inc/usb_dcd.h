@@ -145,6 +145,46 @@ void DCD_SetEPStatus (USB_OTG_CORE_HANDLE *pdev ,
                       uint8_t epnum , 
                       uint32_t Status);
 
+#ifdef USB_OTG_EP_QUEUE_ENABLED
+uint32_t    DCD_EP_QueueTx (USB_OTG_CORE_HANDLE *pdev,
+                            uint8_t  ep_addr,
+                            uint8_t  *pbuf,
+                            uint32_t   buf_len);
+uint32_t    DCD_EP_QueueTxNext (USB_OTG_CORE_HANDLE *pdev,
+                                uint8_t epnum);
+uint32_t    DCD_EP_QueueCount (USB_OTG_CORE_HANDLE *pdev,
+                               uint8_t ep_addr);
+void        DCD_EP_QueueFlush (USB_OTG_CORE_HANDLE *pdev,
+                               uint8_t ep_addr);
+#endif
+
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+void        DCD_EP_RxPoolOpen (USB_OTG_CORE_HANDLE *pdev,
+                               uint8_t ep_addr,
+                               USB_OTG_EP_RXDONE RxDone);
+uint32_t    DCD_EP_PostRx (USB_OTG_CORE_HANDLE *pdev,
+                           uint8_t  ep_addr,
+                           uint8_t  *pbuf,
+                           uint16_t  buf_len);
+uint32_t    DCD_EP_RxPoolNext (USB_OTG_CORE_HANDLE *pdev,
+                               uint8_t epnum);
+void        DCD_EP_RxPoolClose (USB_OTG_CORE_HANDLE *pdev,
+                                uint8_t ep_addr);
+#endif
+
+#ifdef USB_OTG_EP_SG_ENABLED
+uint32_t    DCD_EP_TxSG (USB_OTG_CORE_HANDLE *pdev,
+                         uint8_t  ep_addr,
+                         const USB_OTG_EP_XFER *segs,
+                         uint8_t  nseg);
+uint32_t    DCD_EP_PrepareRxSG (USB_OTG_CORE_HANDLE *pdev,
+                                uint8_t  ep_addr,
+                                const USB_OTG_EP_XFER *segs,
+                                uint8_t  nseg);
+uint32_t    DCD_EP_SGNext (USB_OTG_CORE_HANDLE *pdev,
+                           uint8_t ep_addr);
+#endif
+
 /**
 * @}
 */ 
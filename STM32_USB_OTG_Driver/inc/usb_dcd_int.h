@@ -62,6 +62,9 @@ typedef struct _USBD_DCD_INT
   
   uint8_t (* DevConnected) (USB_OTG_CORE_HANDLE *pdev);
   uint8_t (* DevDisconnected) (USB_OTG_CORE_HANDLE *pdev);   
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  uint8_t (* RoleSuspend) (USB_OTG_CORE_HANDLE *pdev);
+#endif
   
 }USBD_DCD_INT_cb_TypeDef;
 
@@ -64,6 +64,10 @@
 #define USB_OTG_ULPI_PHY      1
 #define USB_OTG_EMBEDDED_PHY  2
 
+/* wMaxPacketSize: packet size and transactions per microframe */
+#define USB_OTG_MPS_SIZE(mps)   ((mps) & 0x07FF)
+#define USB_OTG_MPS_MULT(mps)   ((((mps) >> 11) & 0x03) + 1)
+
 /**
   * @}
   */
@@ -160,6 +164,7 @@
 #define HC_PID_DATA2                           1
 #define HC_PID_DATA1                           2
 #define HC_PID_SETUP                           3
+#define HC_PID_MDATA                           3
 
 #define HPRT0_PRTSPD_HIGH_SPEED                0
 #define HPRT0_PRTSPD_FULL_SPEED                1
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    usb_event.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   Header of the OTG interrupt to stack event ring
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_EVENT_H__
+#define __USB_EVENT_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_core.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+  * @{
+  */
+
+/** @defgroup USB_EVENT
+  * @brief Single producer / single consumer event ring between the OTG
+  *        interrupt and the thread running the host or device stack
+  * @{
+  */
+
+
+/** @defgroup USB_EVENT_Exported_Defines
+  * @{
+  */
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+
+/* Event types */
+#define USB_OTG_EVT_DATA_OUT                    1   /* num: endpoint        */
+#define USB_OTG_EVT_DATA_IN                     2   /* num: endpoint        */
+#define USB_OTG_EVT_SETUP                       3
+#define USB_OTG_EVT_SOF                         4
+#define USB_OTG_EVT_ISO_IN_INCOMPLETE           5
+#define USB_OTG_EVT_ISO_OUT_INCOMPLETE          6
+#define USB_OTG_EVT_CONNECT                     7
+#define USB_OTG_EVT_DISCONNECT                  8
+#define USB_OTG_EVT_URB                         9   /* num: channel, data: URB_STATE */
+
+/* Hook called by the interrupt after each event, e.g. to give a semaphore
+   to the task running the stack */
+#ifndef USB_OTG_EVENT_NOTIFY
+ #define USB_OTG_EVENT_NOTIFY(pdev)
+#endif
+
+#endif /* USB_OTG_EVENT_QUEUE_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_EVENT_Exported_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_EVENT_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USB_EVENT_Exported_Variables
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USB_EVENT_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+void         USB_OTG_EventInit          (USB_OTG_CORE_HANDLE *pdev);
+USB_OTG_STS  USB_OTG_EventPush          (USB_OTG_CORE_HANDLE *pdev,
+                                         uint8_t type,
+                                         uint8_t num,
+                                         uint16_t data);
+uint8_t      USB_OTG_EventPop           (USB_OTG_CORE_HANDLE *pdev,
+                                         USB_OTG_EVENT *evt);
+uint32_t     USB_OTG_EventPending       (USB_OTG_CORE_HANDLE *pdev);
+#endif
+/**
+  * @}
+  */
+
+
+#endif /* __USB_EVENT_H__ */
+
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,130 @@
+/**
+  ******************************************************************************
+  * @file    usb_fifo_dma.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   Header of the FS core FIFO DMA layer
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_FIFO_DMA_H__
+#define __USB_FIFO_DMA_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_core.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+  * @{
+  */
+
+/** @defgroup USB_FIFO_DMA
+  * @brief FIFO data transfers of the FS core through a DMA2 memory to memory
+  *        stream
+  * @{
+  */
+
+
+/** @defgroup USB_FIFO_DMA_Exported_Defines
+  * @{
+  */
+#ifdef USB_OTG_FS_DMA_FIFO_ENABLED
+
+/* DMA2 is the only controller able to perform memory to memory transfers */
+#ifndef USB_OTG_FS_DMA_STREAM
+ #define USB_OTG_FS_DMA_STREAM                  DMA2_Stream0
+ #define USB_OTG_FS_DMA_CHANNEL                 DMA_Channel_0
+ #define USB_OTG_FS_DMA_IT_TC                   DMA_IT_TCIF0
+ #define USB_OTG_FS_DMA_IT_TE                   DMA_IT_TEIF0
+ #define USB_OTG_FS_DMA_IRQn                    DMA2_Stream0_IRQn
+#endif
+
+/* Packets shorter than this are still copied by the CPU: below this size the
+   stream setup costs more than the copy itself */
+#ifndef USB_OTG_FS_DMA_MIN_LEN
+ #define USB_OTG_FS_DMA_MIN_LEN                 32
+#endif
+
+#define USB_OTG_FIFO_DMA_IDLE                   0
+#define USB_OTG_FIFO_DMA_RX                     1
+#define USB_OTG_FIFO_DMA_TX                     2
+
+#endif /* USB_OTG_FS_DMA_FIFO_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_FIFO_DMA_Exported_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_FIFO_DMA_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USB_FIFO_DMA_Exported_Variables
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USB_FIFO_DMA_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef USB_OTG_FS_DMA_FIFO_ENABLED
+void         USB_OTG_FifoDMA_Init       (USB_OTG_CORE_HANDLE *pdev);
+uint8_t      USB_OTG_FifoDMA_Busy       (void);
+USB_OTG_STS  USB_OTG_FifoDMA_Read       (USB_OTG_CORE_HANDLE *pdev,
+                                         uint8_t *dest,
+                                         uint16_t len);
+USB_OTG_STS  USB_OTG_FifoDMA_Write      (USB_OTG_CORE_HANDLE *pdev,
+                                         uint8_t *src,
+                                         uint8_t ep_num,
+                                         uint16_t len);
+uint32_t     USB_OTG_FifoDMA_IRQHandler (USB_OTG_CORE_HANDLE *pdev);
+#endif
+/**
+  * @}
+  */
+
+
+#endif /* __USB_FIFO_DMA_H__ */
+
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -47,6 +47,16 @@
 /** @defgroup USB_HCD_Exported_Defines
   * @{
   */ 
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+/* Bus time of a (micro)frame, in bytes */
+#define HCD_SCHED_FS_FRAME_BYTES            1500
+#define HCD_SCHED_HS_FRAME_BYTES            7500
+/* Part of it that may be reserved for the periodic transfers (USB 2.0 5.6.4) */
+#define HCD_SCHED_FS_PERIODIC_BYTES         ((HCD_SCHED_FS_FRAME_BYTES * 9) / 10)
+#define HCD_SCHED_HS_PERIODIC_BYTES         ((HCD_SCHED_HS_FRAME_BYTES * 8) / 10)
+/* Frame numbers are compared on 14 bits */
+#define HCD_SCHED_FRAME_MSK                 0x3FFF
+#endif
 /**
   * @}
   */ 
@@ -90,6 +100,31 @@ uint32_t  HCD_GetCurrentFrame      (USB_OTG_CORE_HANDLE *pdev) ;
 URB_STATE HCD_GetURB_State         (USB_OTG_CORE_HANDLE *pdev,  uint8_t ch_num); 
 uint32_t  HCD_GetXferCnt           (USB_OTG_CORE_HANDLE *pdev,  uint8_t ch_num); 
 HC_STATUS HCD_GetHCState           (USB_OTG_CORE_HANDLE *pdev,  uint8_t ch_num) ;
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+void      HCD_Sched_Reset          (USB_OTG_CORE_HANDLE *pdev);
+uint32_t  HCD_Sched_Reserve        (USB_OTG_CORE_HANDLE *pdev,
+                                    uint8_t hc_num,
+                                    uint16_t interval);
+void      HCD_Sched_Release        (USB_OTG_CORE_HANDLE *pdev,  uint8_t hc_num);
+void      HCD_Sched_SOF            (USB_OTG_CORE_HANDLE *pdev);
+void      HCD_Sched_GetLatency     (USB_OTG_CORE_HANDLE *pdev,
+                                    uint8_t hc_num,
+                                    uint16_t *lat_max,
+                                    uint16_t *lat_avg);
+#endif
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+uint32_t  HCD_IsocStream_Start     (USB_OTG_CORE_HANDLE *pdev,
+                                    uint8_t hc_num,
+                                    uint8_t *buff0,
+                                    uint8_t *buff1,
+                                    uint32_t length,
+                                    void (*BufferDone) (void *pdev,
+                                                        uint8_t hc_num,
+                                                        uint8_t *buff,
+                                                        uint32_t count));
+void      HCD_IsocStream_Stop      (USB_OTG_CORE_HANDLE *pdev,  uint8_t hc_num);
+void      HCD_IsocStream_Reset     (USB_OTG_CORE_HANDLE *pdev);
+#endif
 /**
   * @}
   */ 
@@ -60,6 +60,9 @@ typedef struct _USBH_HCD_INT
   uint8_t (* SOF) (USB_OTG_CORE_HANDLE *pdev);
   uint8_t (* DevConnected) (USB_OTG_CORE_HANDLE *pdev);
   uint8_t (* DevDisconnected) (USB_OTG_CORE_HANDLE *pdev);   
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+  uint8_t (* URBChange) (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
+#endif
   
 }USBH_HCD_INT_cb_TypeDef;
 
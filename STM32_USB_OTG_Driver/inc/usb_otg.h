@@ -45,10 +45,13 @@
   */ 
 
 
-void USB_OTG_InitiateSRP(void);
-void USB_OTG_InitiateHNP(uint8_t state , uint8_t mode);
-void USB_OTG_Switchback (USB_OTG_CORE_DEVICE *pdev);
-uint32_t  USB_OTG_GetCurrentState (USB_OTG_CORE_DEVICE *pdev);
+uint32_t STM32_USBO_OTG_ISR_Handler(USB_OTG_CORE_HANDLE *pdev);
+void USB_OTG_InitiateSRP(USB_OTG_CORE_HANDLE *pdev);
+void USB_OTG_InitiateHNP(USB_OTG_CORE_HANDLE *pdev , uint8_t state , uint8_t mode);
+uint32_t  USB_OTG_GetCurrentState (USB_OTG_CORE_HANDLE *pdev);
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+USB_OTG_STS USB_OTG_SwitchRole (USB_OTG_CORE_HANDLE *pdev , uint8_t mode);
+#endif
 
 /**
   * @}
@@ -97,7 +97,13 @@ typedef struct _USB_OTG_GREGS  //000h
   uint32_t Reserved30[2];     /* Reserved                           030h*/
   __IO uint32_t GCCFG;        /* General Purpose IO Register        038h*/
   __IO uint32_t CID;          /* User ID Register                   03Ch*/
+#ifdef USB_OTG_LPM_ENABLED
+  uint32_t  Reserved40[5];    /* Reserved                      040h-053h*/
+  __IO uint32_t GLPMCFG;      /* LPM Configuration Register         054h*/
+  uint32_t  Reserved58[42];   /* Reserved                      058h-0FFh*/
+#else
   uint32_t  Reserved40[48];   /* Reserved                      040h-0FFh*/
+#endif
   __IO uint32_t HPTXFSIZ; /* Host Periodic Tx FIFO Size Reg     100h*/
   __IO uint32_t DIEPTXF[USB_OTG_MAX_TX_FIFOS];/* dev Periodic Transmit FIFO */
 }
@@ -454,7 +460,7 @@ uint32_t hcintr :
     1;
 uint32_t ptxfempty :
     1;
-uint32_t Reserved27 :
+uint32_t lpmint :
     1;
 uint32_t conidstschng :
     1;
@@ -520,7 +526,7 @@ uint32_t hcintr :
     1;
 uint32_t ptxfempty :
     1;
-uint32_t Reserved27 :
+uint32_t lpmint :
     1;
 uint32_t conidstschng :
     1;
@@ -1147,6 +1153,49 @@ uint32_t Reserved5_31 :
   b;
 } USB_OTG_PCGCCTL_TypeDef ;
 
+#ifdef USB_OTG_LPM_ENABLED
+typedef union _USB_OTG_GLPMCFG_TypeDef 
+{
+  uint32_t d32;
+  struct
+  {
+uint32_t lpmen :
+    1;
+uint32_t lpmack :
+    1;
+uint32_t besl :
+    4;
+uint32_t remwake :
+    1;
+uint32_t l1ssen :
+    1;
+uint32_t beslthrs :
+    4;
+uint32_t l1dsen :
+    1;
+uint32_t lpmrsp :
+    2;
+uint32_t slpsts :
+    1;
+uint32_t l1rsmok :
+    1;
+uint32_t lpmchidx :
+    4;
+uint32_t lpmrcnt :
+    3;
+uint32_t sndlpm :
+    1;
+uint32_t lpmrcntsts :
+    3;
+uint32_t enbesl :
+    1;
+uint32_t Reserved29_31 :
+    3;
+  }
+  b;
+} USB_OTG_GLPMCFG_TypeDef ;
+#endif
+
 /**
   * @}
   */ 
@@ -0,0 +1,152 @@
+/**
+  ******************************************************************************
+  * @file    usb_stats.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   Header of the OTG traffic and interrupt timing statistics
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_STATS_H__
+#define __USB_STATS_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_core.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+  * @{
+  */
+
+/** @defgroup USB_STATS
+  * @brief Per endpoint / per channel traffic counters and OTG interrupt
+  *        timing, compiled out unless USB_OTG_STATS_ENABLED is defined
+  * @{
+  */
+
+
+/** @defgroup USB_STATS_Exported_Defines
+  * @{
+  */
+#ifdef USB_OTG_STATS_ENABLED
+
+/* DWT cycle counter (not described by the CMSIS core header of this tree) */
+#define USB_OTG_DWT_CTRL                        (*(__IO uint32_t *)0xE0001000)
+#define USB_OTG_DWT_CYCCNT                      (*(__IO uint32_t *)0xE0001004)
+#define USB_OTG_DWT_CTRL_CYCCNTENA              0x00000001
+
+/* Index of USB_OTG_CORE_HANDLE.xfer_stats */
+#define USB_OTG_XFER_IN                         0
+#define USB_OTG_XFER_OUT                        1
+
+#endif /* USB_OTG_STATS_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_STATS_Exported_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_STATS_Exported_Macros
+  * @{
+  */
+#ifdef USB_OTG_STATS_ENABLED
+
+#define USB_OTG_STATS_ADD(st, field, n)         ((st).field += (n))
+#define USB_OTG_STATS_ISR_ENTER(pdev)           ((pdev)->isr_stats.cyc_start = USB_OTG_DWT_CYCCNT)
+#define USB_OTG_STATS_ISR_EXIT(pdev)            USB_OTG_Stats_ISRDone(pdev)
+#define USB_OTG_STATS_XFER_START(ep)            ((ep)->stats.xfer_start = USB_OTG_DWT_CYCCNT)
+
+#else
+
+#define USB_OTG_STATS_ADD(st, field, n)
+#define USB_OTG_STATS_ISR_ENTER(pdev)
+#define USB_OTG_STATS_ISR_EXIT(pdev)
+#define USB_OTG_STATS_XFER_START(ep)
+
+#endif /* USB_OTG_STATS_ENABLED */
+
+/* Event records of cmsis_trace.h, when it is included by usb_conf.h */
+#ifndef TRACE_USB
+ #define TRACE_USB(event, arg)
+#endif
+#ifndef TRACE_ISR_ENTER
+ #define TRACE_ISR_ENTER()
+ #define TRACE_ISR_EXIT()
+#endif
+/**
+  * @}
+  */
+
+/** @defgroup USB_STATS_Exported_Variables
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USB_STATS_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef USB_OTG_STATS_ENABLED
+void         USB_OTG_Stats_Init         (USB_OTG_CORE_HANDLE *pdev);
+void         USB_OTG_Stats_Reset        (USB_OTG_CORE_HANDLE *pdev);
+void         USB_OTG_Stats_ISRDone      (USB_OTG_CORE_HANDLE *pdev);
+USB_OTG_STS  USB_OTG_Stats_GetEP        (USB_OTG_CORE_HANDLE *pdev,
+                                         uint8_t ep_addr,
+                                         USB_OTG_EP_STATS *stats);
+USB_OTG_STS  USB_OTG_Stats_GetHC        (USB_OTG_CORE_HANDLE *pdev,
+                                         uint8_t hc_num,
+                                         USB_OTG_EP_STATS *stats);
+void         USB_OTG_Stats_GetISR       (USB_OTG_CORE_HANDLE *pdev,
+                                         USB_OTG_ISR_STATS *stats);
+void         USB_OTG_Stats_XferDone     (USB_OTG_CORE_HANDLE *pdev,
+                                         USB_OTG_EP *ep);
+void         USB_OTG_Stats_GetXfer      (USB_OTG_CORE_HANDLE *pdev,
+                                         uint8_t dir,
+                                         USB_OTG_XFER_STATS *stats);
+uint32_t     USB_OTG_Stats_XferBin      (uint32_t cyc);
+uint32_t     USB_OTG_Stats_XferBinLow   (uint32_t bin);
+#endif
+/**
+  * @}
+  */
+
+
+#endif /* __USB_STATS_H__ */
+
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
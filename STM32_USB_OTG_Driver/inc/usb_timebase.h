@@ -0,0 +1,161 @@
+/**
+  ******************************************************************************
+  * @file    usb_timebase.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   Header of the SOF locked sampling timebase
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_TIMEBASE_H__
+#define __USB_TIMEBASE_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_core.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+  * @{
+  */
+
+/** @defgroup USB_TIMEBASE
+  * @brief TIM2 sampling timebase phase locked to the SOF of the host
+  * @{
+  */
+
+
+/** @defgroup USB_TIMEBASE_Exported_Defines
+  * @{
+  */
+#ifdef USB_OTG_SOF_TIMEBASE_ENABLED
+
+#if !defined (USB_OTG_FS_SOF_OUTPUT_ENABLED) && !defined (USB_OTG_HS_SOF_OUTPUT_ENABLED)
+ #error "USB_OTG_SOF_TIMEBASE_ENABLED needs the SOF output of the core (USB_OTG_xx_SOF_OUTPUT_ENABLED)"
+#endif
+
+/* Default loop gains: the period correction applied for the next frame is
+   (error >> KP_SHIFT) + (sum of the errors >> KI_SHIFT), in ticks per frame */
+#ifndef USB_OTG_TIMEBASE_KP_SHIFT
+ #define USB_OTG_TIMEBASE_KP_SHIFT              2
+#endif
+#ifndef USB_OTG_TIMEBASE_KI_SHIFT
+ #define USB_OTG_TIMEBASE_KI_SHIFT              6
+#endif
+
+/* The loop is locked after LOCK_FRAMES consecutive SOFs within LOCK_TICKS
+   of the phase, and unlocked by an error above 4 x LOCK_TICKS */
+#ifndef USB_OTG_TIMEBASE_LOCK_TICKS
+ #define USB_OTG_TIMEBASE_LOCK_TICKS            4
+#endif
+#ifndef USB_OTG_TIMEBASE_LOCK_FRAMES
+ #define USB_OTG_TIMEBASE_LOCK_FRAMES           16
+#endif
+
+#define USB_OTG_TIMEBASE_IDLE                   0
+#define USB_OTG_TIMEBASE_WAIT_SOF               1
+#define USB_OTG_TIMEBASE_RUN                    2
+
+#endif /* USB_OTG_SOF_TIMEBASE_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_TIMEBASE_Exported_Types
+  * @{
+  */
+#ifdef USB_OTG_SOF_TIMEBASE_ENABLED
+
+typedef struct _USB_OTG_TIMEBASE_CFG
+{
+  uint16_t  prescaler;        /* TIM2 prescaler (PSC register value)          */
+  uint16_t  samples;          /* sampling timer periods per (micro)frame      */
+  uint32_t  period;           /* nominal period in ticks, below 65536: one
+                                 frame of the local clock is samples x period */
+  uint32_t  phase;            /* target counter value at the SOF, i.e. ticks
+                                 from the sampling trigger to the SOF         */
+  void      (*Sof)(uint32_t frame, int32_t error);
+                              /* optional, called from USB_OTG_Timebase_
+                                 IRQHandler at each SOF                       */
+}
+USB_OTG_TIMEBASE_CFG;
+
+typedef struct _USB_OTG_TIMESTAMP
+{
+  uint32_t  frame;            /* frame number of the last SOF, extended to
+                                 32 bits (microframes on a HS bus)            */
+  uint32_t  sample;           /* trigger count of the sampling timer at that
+                                 SOF, from USB_OTG_Timebase_Start             */
+  int32_t   error;            /* phase error at that SOF in ticks             */
+  uint32_t  period;           /* trimmed period in 1/65536 ticks              */
+  uint8_t   locked;
+}
+USB_OTG_TIMESTAMP;
+
+#endif /* USB_OTG_SOF_TIMEBASE_ENABLED */
+/**
+  * @}
+  */
+
+
+/** @defgroup USB_TIMEBASE_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USB_TIMEBASE_Exported_Variables
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USB_TIMEBASE_Exported_FunctionsPrototype
+  * @{
+  */
+#ifdef USB_OTG_SOF_TIMEBASE_ENABLED
+void         USB_OTG_Timebase_Init       (USB_OTG_CORE_HANDLE *pdev,
+                                          USB_OTG_TIMEBASE_CFG *cfg);
+void         USB_OTG_Timebase_Start      (void);
+void         USB_OTG_Timebase_Stop       (void);
+uint8_t      USB_OTG_Timebase_GetTimestamp (USB_OTG_TIMESTAMP *ts);
+uint32_t     USB_OTG_Timebase_IRQHandler (USB_OTG_CORE_HANDLE *pdev);
+#endif
+/**
+  * @}
+  */
+
+
+#endif /* __USB_TIMEBASE_H__ */
+
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
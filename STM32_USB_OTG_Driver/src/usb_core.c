@@ -28,6 +28,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "usb_core.h"
 #include "usb_bsp.h"
+#include "usb_stats.h"
 
 
 /** @addtogroup USB_OTG_DRIVER
@@ -175,12 +176,37 @@ USB_OTG_STS USB_OTG_WritePacket(USB_OTG_CORE_HANDLE *pdev,
   {
     uint32_t count32b= 0 , i= 0;
     __IO uint32_t *fifo;
-    
+
     count32b =  (len + 3) / 4;
     fifo = pdev->regs.DFIFO[ch_ep_num];
-    for (i = 0; i < count32b; i++, src+=4)
+
+    if (((uint32_t)src & 0x3) == 0)
+    {
+      /* Word aligned source: burst 8 words per iteration with plain
+         word loads, the packed (unaligned) access is not needed */
+      uint32_t *src32 = (uint32_t *)src;
+      uint32_t w0, w1, w2, w3;
+
+      for (i = count32b >> 3; i > 0; i--)
+      {
+        w0 = src32[0]; w1 = src32[1]; w2 = src32[2]; w3 = src32[3];
+        fifo[0] = w0; fifo[1] = w1; fifo[2] = w2; fifo[3] = w3;
+        w0 = src32[4]; w1 = src32[5]; w2 = src32[6]; w3 = src32[7];
+        fifo[4] = w0; fifo[5] = w1; fifo[6] = w2; fifo[7] = w3;
+        src32 += 8;
+      }
+      /* Remaining tail words */
+      for (i = count32b & 0x7; i > 0; i--)
+      {
+        USB_OTG_WRITE_REG32( fifo, *src32++ );
+      }
+    }
+    else
     {
-      USB_OTG_WRITE_REG32( fifo, *((__packed uint32_t *)src) );
+      for (i = 0; i < count32b; i++, src+=4)
+      {
+        USB_OTG_WRITE_REG32( fifo, *((__packed uint32_t *)src) );
+      }
     }
   }
   return status;
@@ -202,11 +228,36 @@ void *USB_OTG_ReadPacket(USB_OTG_CORE_HANDLE *pdev,
   uint32_t count32b = (len + 3) / 4;
   
   __IO uint32_t *fifo = pdev->regs.DFIFO[0];
-  
-  for ( i = 0; i < count32b; i++, dest += 4 )
+
+  if (((uint32_t)dest & 0x3) == 0)
   {
-    *(__packed uint32_t *)dest = USB_OTG_READ_REG32(fifo);
-    
+    /* Word aligned destination: burst 8 words per iteration with plain
+       word stores, the packed (unaligned) access is not needed */
+    uint32_t *dest32 = (uint32_t *)dest;
+    uint32_t w0, w1, w2, w3;
+
+    for (i = count32b >> 3; i > 0; i--)
+    {
+      w0 = fifo[0]; w1 = fifo[1]; w2 = fifo[2]; w3 = fifo[3];
+      dest32[0] = w0; dest32[1] = w1; dest32[2] = w2; dest32[3] = w3;
+      w0 = fifo[4]; w1 = fifo[5]; w2 = fifo[6]; w3 = fifo[7];
+      dest32[4] = w0; dest32[5] = w1; dest32[6] = w2; dest32[7] = w3;
+      dest32 += 8;
+    }
+    /* Remaining tail words */
+    for (i = count32b & 0x7; i > 0; i--)
+    {
+      *dest32++ = USB_OTG_READ_REG32(fifo);
+    }
+    dest = (uint8_t *)dest32;
+  }
+  else
+  {
+    for ( i = 0; i < count32b; i++, dest += 4 )
+    {
+      *(__packed uint32_t *)dest = USB_OTG_READ_REG32(fifo);
+
+    }
   }
   return ((void *)dest);
 }
@@ -605,21 +656,18 @@ uint32_t USB_OTG_ReadOtgItr (USB_OTG_CORE_HANDLE *pdev)
 
 #ifdef USE_HOST_MODE
 /**
-* @brief  USB_OTG_CoreInitHost : Initializes USB_OTG controller for host mode
+* @brief  USB_OTG_InitHostFifos : Sets the host FIFO sizes, flushes the FIFOs
+*         and clears the channel interrupts
 * @param  pdev : Selected device
-* @retval status
+* @retval None
 */
-USB_OTG_STS USB_OTG_CoreInitHost(USB_OTG_CORE_HANDLE *pdev)
+static void USB_OTG_InitHostFifos(USB_OTG_CORE_HANDLE *pdev)
 {
-  USB_OTG_STS                     status = USB_OTG_OK;
   USB_OTG_FSIZ_TypeDef            nptxfifosize;
   USB_OTG_FSIZ_TypeDef            ptxfifosize;  
-  USB_OTG_HCFG_TypeDef            hcfg;
-  
 #ifdef USE_OTG_MODE
-  USB_OTG_OTGCTL_TypeDef          gotgctl;
+  USB_OTG_GOTGCTL_TypeDef         gotgctl;
 #endif
-  
   uint32_t                        i = 0;
   
   nptxfifosize.d32 = 0;  
@@ -627,29 +675,6 @@ USB_OTG_STS USB_OTG_CoreInitHost(USB_OTG_CORE_HANDLE *pdev)
 #ifdef USE_OTG_MODE
   gotgctl.d32 = 0;
 #endif
-  hcfg.d32 = 0;
-  
-  
-  /* configure charge pump IO */
-  USB_OTG_BSP_ConfigVBUS(pdev);
-  
-  /* Restart the Phy Clock */
-  USB_OTG_WRITE_REG32(pdev->regs.PCGCCTL, 0);
-  
-  /* Initialize Host Configuration Register */
-  if (pdev->cfg.phy_itface == USB_OTG_ULPI_PHY)
-  {
-    USB_OTG_InitFSLSPClkSel(pdev , HCFG_30_60_MHZ); 
-  }
-  else
-  {
-    USB_OTG_InitFSLSPClkSel(pdev , HCFG_48_MHZ); 
-  }
-  USB_OTG_ResetPort(pdev);
-  
-  hcfg.d32 = USB_OTG_READ_REG32(&pdev->regs.HREGS->HCFG);
-  hcfg.b.fslssupp = 0;
-  USB_OTG_WRITE_REG32(&pdev->regs.HREGS->HCFG, hcfg.d32);
   
   /* Configure data FIFO sizes */
   /* Rx FIFO */
@@ -699,6 +724,44 @@ USB_OTG_STS USB_OTG_CoreInitHost(USB_OTG_CORE_HANDLE *pdev)
     USB_OTG_WRITE_REG32( &pdev->regs.HC_REGS[i]->HCINT, 0xFFFFFFFF );
     USB_OTG_WRITE_REG32( &pdev->regs.HC_REGS[i]->HCINTMSK, 0 );
   }
+}
+
+/**
+* @brief  USB_OTG_CoreInitHost : Initializes USB_OTG controller for host mode
+* @param  pdev : Selected device
+* @retval status
+*/
+USB_OTG_STS USB_OTG_CoreInitHost(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_STS                     status = USB_OTG_OK;
+  USB_OTG_HCFG_TypeDef            hcfg;
+  
+  hcfg.d32 = 0;
+  
+  
+  /* configure charge pump IO */
+  USB_OTG_BSP_ConfigVBUS(pdev);
+  
+  /* Restart the Phy Clock */
+  USB_OTG_WRITE_REG32(pdev->regs.PCGCCTL, 0);
+  
+  /* Initialize Host Configuration Register */
+  if (pdev->cfg.phy_itface == USB_OTG_ULPI_PHY)
+  {
+    USB_OTG_InitFSLSPClkSel(pdev , HCFG_30_60_MHZ); 
+  }
+  else
+  {
+    USB_OTG_InitFSLSPClkSel(pdev , HCFG_48_MHZ); 
+  }
+  USB_OTG_ResetPort(pdev);
+  
+  hcfg.d32 = USB_OTG_READ_REG32(&pdev->regs.HREGS->HCFG);
+  hcfg.b.fslssupp = 0;
+  USB_OTG_WRITE_REG32(&pdev->regs.HREGS->HCFG, hcfg.d32);
+  
+  USB_OTG_InitHostFifos(pdev);
+  
 #ifndef USE_OTG_MODE
   USB_OTG_DriveVbus(pdev, 1);
 #endif
@@ -707,6 +770,48 @@ USB_OTG_STS USB_OTG_CoreInitHost(USB_OTG_CORE_HANDLE *pdev)
   return status;
 }
 
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+/**
+* @brief  USB_OTG_CoreSwitchHost : Sets up the host mode after a connector ID
+*         change, without the port reset and the VBUS settling delay of
+*         USB_OTG_CoreInitHost: the port is reset by the host library once a
+*         device is attached
+* @param  pdev : Selected device
+* @retval status
+*/
+USB_OTG_STS USB_OTG_CoreSwitchHost(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_HCFG_TypeDef            hcfg;
+  USB_OTG_HPRT0_TypeDef           hprt0;
+  
+  /* Restart the Phy Clock */
+  USB_OTG_WRITE_REG32(pdev->regs.PCGCCTL, 0);
+  
+  if (pdev->cfg.phy_itface == USB_OTG_ULPI_PHY)
+  {
+    USB_OTG_InitFSLSPClkSel(pdev , HCFG_30_60_MHZ); 
+  }
+  else
+  {
+    USB_OTG_InitFSLSPClkSel(pdev , HCFG_48_MHZ); 
+  }
+  hcfg.d32 = USB_OTG_READ_REG32(&pdev->regs.HREGS->HCFG);
+  hcfg.b.fslssupp = 0;
+  USB_OTG_WRITE_REG32(&pdev->regs.HREGS->HCFG, hcfg.d32);
+  
+  USB_OTG_InitHostFifos(pdev);
+  
+  /* A-device: power the port, the attachment debounce covers VBUS rise */
+  USB_OTG_BSP_DriveVBUS(pdev, 1);
+  hprt0.d32 = USB_OTG_ReadHPRT0(pdev);
+  hprt0.b.prtpwr = 1;
+  USB_OTG_WRITE_REG32(pdev->regs.HPRT0, hprt0.d32);
+  
+  USB_OTG_EnableHostInt(pdev);
+  return USB_OTG_OK;
+}
+#endif
+
 /**
 * @brief  USB_OTG_IsEvenFrame 
 *         This function returns the frame number for sof packet
@@ -929,6 +1034,16 @@ USB_OTG_STS USB_OTG_HC_Init(USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
     break;
   }
   
+#ifdef USB_OTG_SPLIT_ENABLED
+  if (pdev->host.hc[hc_num].do_split)
+  {
+    /* ACK ends the SSPLIT, NYET asks to repeat the CSPLIT */
+    hcintmsk.b.ack = 1;
+    hcintmsk.b.nyet = 1;
+  }
+  /* HCSPLT is programmed per transaction by USB_OTG_HC_SplitXfer */
+  USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[hc_num]->HCSPLT, 0);
+#endif
   
   USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[hc_num]->HCINTMSK, hcintmsk.d32);
   
@@ -941,6 +1056,22 @@ USB_OTG_STS USB_OTG_HC_Init(USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
   gintmsk.b.hcintr = 1;
   USB_OTG_MODIFY_REG32(&pdev->regs.GREGS->GINTMSK, 0, gintmsk.d32);
   
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  /* Additional transactions given in the wMaxPacketSize of a high speed
+     isochronous endpoint */
+  if (pdev->host.hc[hc_num].max_packet > 0x7FF)
+  {
+    pdev->host.hc[hc_num].multi = USB_OTG_MPS_MULT(pdev->host.hc[hc_num].max_packet);
+    pdev->host.hc[hc_num].max_packet = USB_OTG_MPS_SIZE(pdev->host.hc[hc_num].max_packet);
+  }
+  if ((pdev->host.hc[hc_num].ep_type != EP_TYPE_ISOC) ||
+      (pdev->host.hc[hc_num].speed != HPRT0_PRTSPD_HIGH_SPEED) ||
+      (pdev->host.hc[hc_num].multi == 0))
+  {
+    pdev->host.hc[hc_num].multi = 1;
+  }
+#endif
+  
   /* Program the HCCHAR register */
   hcchar.d32 = 0;
   hcchar.b.devaddr = pdev->host.hc[hc_num].dev_addr;
@@ -949,6 +1080,9 @@ USB_OTG_STS USB_OTG_HC_Init(USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
   hcchar.b.lspddev = (pdev->host.hc[hc_num].speed == HPRT0_PRTSPD_LOW_SPEED);
   hcchar.b.eptype  = pdev->host.hc[hc_num].ep_type;
   hcchar.b.mps     = pdev->host.hc[hc_num].max_packet;
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  hcchar.b.multicnt = pdev->host.hc[hc_num].multi;
+#endif
   if (pdev->host.hc[hc_num].ep_type == HCCHAR_INTR)
   {
     hcchar.b.oddfrm  = 1;
@@ -982,6 +1116,17 @@ USB_OTG_STS USB_OTG_HC_StartXfer(USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
   hcchar.d32 = 0;
   intmsk.d32 = 0;
   
+#ifdef USB_OTG_SPLIT_ENABLED
+  if (pdev->host.hc[hc_num].do_split)
+  {
+    /* The transfer goes packet by packet, see USB_OTG_HC_SplitXfer */
+    pdev->host.hc[hc_num].split_len   = pdev->host.hc[hc_num].xfer_len;
+    pdev->host.hc[hc_num].split_count = 0;
+    pdev->host.hc[hc_num].comp_split  = 0;
+    return USB_OTG_HC_SplitXfer(pdev, hc_num);
+  }
+#endif
+  
   /* Compute the expected number of packets associated to the transfer */
   if (pdev->host.hc[hc_num].xfer_len > 0)
   {
@@ -1008,6 +1153,22 @@ USB_OTG_STS USB_OTG_HC_StartXfer(USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
   hctsiz.b.xfersize = pdev->host.hc[hc_num].xfer_len;
   hctsiz.b.pktcnt = num_packets;
   hctsiz.b.pid = pdev->host.hc[hc_num].data_pid;
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  if ((pdev->host.hc[hc_num].ep_type == EP_TYPE_ISOC) &&
+      (pdev->host.hc[hc_num].multi > 1))
+  {
+    /* First PID of a high-bandwidth microframe: DATA2/DATA1 announce the
+       packets coming (IN), MDATA the ones following (OUT) */
+    if (pdev->host.hc[hc_num].ep_is_in)
+    {
+      hctsiz.b.pid = (pdev->host.hc[hc_num].multi == 3) ? HC_PID_DATA2 : HC_PID_DATA1;
+    }
+    else
+    {
+      hctsiz.b.pid = (num_packets > 1) ? HC_PID_MDATA : HC_PID_DATA0;
+    }
+  }
+#endif
   USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[hc_num]->HCTSIZ, hctsiz.d32);
   
   if (pdev->cfg.dma_enable == 1)
@@ -1074,6 +1235,77 @@ USB_OTG_STS USB_OTG_HC_StartXfer(USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
   return status;
 }
 
+#ifdef USB_OTG_SPLIT_ENABLED
+/**
+* @brief  USB_OTG_HC_SplitXfer : Start the next start split (SSPLIT) or
+*         complete split (CSPLIT) transaction of a channel behind a HS hub.
+*         One packet is moved per SSPLIT/CSPLIT pair; the channel interrupt
+*         calls this again until the packet count or a short packet ends
+*         the transfer. xfer_buff points to the current packet.
+* @param  pdev : Selected device
+* @param  hc_num : channel number
+* @retval USB_OTG_STS : status
+*/
+USB_OTG_STS USB_OTG_HC_SplitXfer(USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
+{
+  USB_OTG_HCSPLT_TypeDef   hcsplt;
+  USB_OTG_HCTSIZn_TypeDef  hctsiz;
+  USB_OTG_HCCHAR_TypeDef   hcchar;
+  USB_OTG_HC               *hc = &pdev->host.hc[hc_num];
+  uint32_t                 len;
+  
+  if (hc->ep_is_in)
+  {
+    len = hc->max_packet;
+  }
+  else if (hc->comp_split)
+  {
+    /* No data is sent with the CSPLIT of an OUT transaction */
+    len = 0;
+  }
+  else
+  {
+    len = hc->split_len - hc->split_count;
+    if (len > hc->max_packet)
+    {
+      len = hc->max_packet;
+    }
+  }
+  
+  hcsplt.d32 = 0;
+  hcsplt.b.prtaddr  = hc->hub_port;
+  hcsplt.b.hubaddr  = hc->hub_addr;
+  hcsplt.b.xactpos  = 3;  /* All: the payload fits in one microframe */
+  hcsplt.b.compsplt = hc->comp_split;
+  hcsplt.b.spltena  = 1;
+  USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[hc_num]->HCSPLT, hcsplt.d32);
+  
+  hctsiz.d32 = 0;
+  hctsiz.b.xfersize = len;
+  hctsiz.b.pktcnt = 1;
+  hctsiz.b.pid = hc->data_pid;
+  USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[hc_num]->HCTSIZ, hctsiz.d32);
+  
+  if (pdev->cfg.dma_enable == 1)
+  {
+    USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[hc_num]->HCDMA, (unsigned int)hc->xfer_buff);
+  }
+  
+  hcchar.d32 = USB_OTG_READ_REG32(&pdev->regs.HC_REGS[hc_num]->HCCHAR);
+  hcchar.b.oddfrm = USB_OTG_IsEvenFrame(pdev);
+  hcchar.b.chen = 1;
+  hcchar.b.chdis = 0;
+  USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[hc_num]->HCCHAR, hcchar.d32);
+  
+  if ((pdev->cfg.dma_enable == 0) && (hc->ep_is_in == 0) && (len > 0))
+  {
+    /* A single packet of at most 64 bytes: the FIFO has room for it */
+    USB_OTG_WritePacket(pdev, hc->xfer_buff, hc_num, len);
+  }
+  return USB_OTG_OK;
+}
+#endif
+
 
 /**
 * @brief  USB_OTG_HC_Halt : Halt channel
@@ -1201,6 +1433,9 @@ USB_OTG_STS USB_OTG_CoreInitDev (USB_OTG_CORE_HANDLE *pdev)
   USB_OTG_FSIZ_TypeDef    txfifosize;
   USB_OTG_DIEPMSK_TypeDef msk;
   USB_OTG_DTHRCTL_TypeDef dthrctl;  
+#ifdef USB_OTG_LPM_ENABLED
+  USB_OTG_GLPMCFG_TypeDef glpmcfg;
+#endif
   
   depctl.d32 = 0;
   dcfg.d32 = 0;
@@ -1215,6 +1450,18 @@ USB_OTG_STS USB_OTG_CoreInitDev (USB_OTG_CORE_HANDLE *pdev)
   dcfg.b.perfrint = DCFG_FRAME_INTERVAL_80;
   USB_OTG_WRITE_REG32( &pdev->regs.DREGS->DCFG, dcfg.d32 );
   
+#ifdef USB_OTG_LPM_ENABLED
+  /* ACK the LPM tokens; the PHY clock keeps running in L1 (l1ssen = 0) */
+  glpmcfg.d32 = 0;
+  glpmcfg.b.lpmen  = 1;
+  glpmcfg.b.lpmack = 1;
+  USB_OTG_WRITE_REG32( &pdev->regs.GREGS->GLPMCFG, glpmcfg.d32 );
+#endif
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+  pdev->dev.power_state   = USB_OTG_PWR_L0;
+  pdev->dev.rmtwkup_timer = 0;
+#endif
+  
 #ifdef USB_OTG_FS_CORE
   if(pdev->cfg.coreID == USB_OTG_FS_CORE_ID  )
   {  
@@ -1403,6 +1650,9 @@ USB_OTG_STS USB_OTG_EnableDevInt(USB_OTG_CORE_HANDLE *pdev)
   intmsk.b.sessreqintr    = 1; 
   intmsk.b.otgintr    = 1;    
 #endif  
+#ifdef USB_OTG_LPM_ENABLED
+  intmsk.b.lpmint    = 1;
+#endif
   USB_OTG_MODIFY_REG32( &pdev->regs.GREGS->GINTMSK, intmsk.d32, intmsk.d32);
   return status;
 }
@@ -1439,6 +1689,64 @@ enum USB_OTG_SPEED USB_OTG_GetDeviceSpeed (USB_OTG_CORE_HANDLE *pdev)
   
   return speed;
 }
+
+/**
+* @brief  USB_OTG_SetFifoPlan : Re-program the Rx FIFO and the Tx FIFOs split
+*         at run time, in place of the compile time RX/TXn_FIFO_xx_SIZE values.
+*         Must be called while no IN transfer is pending (e.g. on
+*         SET_CONFIGURATION, before the class opens its endpoints).
+* @param  pdev : Selected device
+* @param  rx_size : Rx FIFO depth in 32-bits words
+* @param  tx_size : Tx FIFOs depths in 32-bits words, one per device endpoint
+*         (tx_size[0] is the EP0 Tx FIFO)
+* @retval USB_OTG_STS : status
+*/
+USB_OTG_STS USB_OTG_SetFifoPlan (USB_OTG_CORE_HANDLE *pdev ,
+                                 uint16_t rx_size ,
+                                 uint16_t *tx_size)
+{
+  USB_OTG_FSIZ_TypeDef    nptxfifosize;
+  USB_OTG_FSIZ_TypeDef    txfifosize;
+  uint32_t total = rx_size;
+  uint32_t i;
+  
+  for (i = 0; i < pdev->cfg.dev_endpoints; i++)
+  {
+    total += tx_size[i];
+  }
+  /* The Rx FIFO must at least hold the setup packets, the EP0 Tx FIFO
+     the minimum depth of 16 words */
+  if ((total > pdev->cfg.TotalFifoSize) || (rx_size < 16) || (tx_size[0] < 16))
+  {
+    return USB_OTG_FAIL;
+  }
+  
+  /* set Rx FIFO size */
+  USB_OTG_WRITE_REG32(&pdev->regs.GREGS->GRXFSIZ, rx_size);
+  
+  /* EP0 TX*/
+  nptxfifosize.d32 = 0;
+  nptxfifosize.b.depth     = tx_size[0];
+  nptxfifosize.b.startaddr = rx_size;
+  USB_OTG_WRITE_REG32( &pdev->regs.GREGS->DIEPTXF0_HNPTXFSIZ, nptxfifosize.d32 );
+  
+  /* EPn TX */
+  txfifosize.d32 = 0;
+  txfifosize.b.startaddr = nptxfifosize.b.startaddr + nptxfifosize.b.depth;
+  for (i = 1; i < pdev->cfg.dev_endpoints; i++)
+  {
+    txfifosize.b.depth = tx_size[i];
+    USB_OTG_WRITE_REG32( &pdev->regs.GREGS->DIEPTXF[i - 1], txfifosize.d32 );
+    txfifosize.b.startaddr += txfifosize.b.depth;
+  }
+  
+  /* Reload the Tx FIFOs pointers; the Rx FIFO is left alone so that a
+     pending setup packet is not lost */
+  USB_OTG_FlushTxFifo(pdev , 0x10); /* all Tx FIFOs */
+  
+  return USB_OTG_OK;
+}
+
 /**
 * @brief  enables EP0 OUT to receive SETUP packets and configures EP0
 *   for transmitting packets
@@ -1583,6 +1891,7 @@ USB_OTG_STS USB_OTG_EPStartXfer(USB_OTG_CORE_HANDLE *pdev , USB_OTG_EP *ep)
   
   depctl.d32 = 0;
   deptsiz.d32 = 0;
+  USB_OTG_STATS_XFER_START(ep);
   /* IN endpoint */
   if (ep->is_in == 1)
   {
@@ -1607,6 +1916,11 @@ USB_OTG_STS USB_OTG_EPStartXfer(USB_OTG_CORE_HANDLE *pdev , USB_OTG_EP *ep)
       if (ep->type == EP_TYPE_ISOC)
       {
         deptsiz.b.mc = 1;
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+        /* Packets sent in the microframe: the core sends them with the
+           DATA2/DATA1/DATA0 PIDs */
+        deptsiz.b.mc = (deptsiz.b.pktcnt < ep->mult) ? deptsiz.b.pktcnt : ep->mult;
+#endif
       }       
     }
     USB_OTG_WRITE_REG32(&pdev->regs.INEP_REGS[ep->num]->DIEPTSIZ, deptsiz.d32);
@@ -1730,6 +2044,20 @@ USB_OTG_STS USB_OTG_EP0StartXfer(USB_OTG_CORE_HANDLE *pdev , USB_OTG_EP *ep)
     }
     else
     {
+#ifdef USB_OTG_EP0_MULTI_PACKET_ENABLED
+      /* The whole rest when DIEPTSIZ0 holds it (3 packets, 127 bytes),
+         else as many max packets as it holds */
+      if ((ep->xfer_len > 127) || (ep->xfer_len > 3 * ep->maxpacket))
+      {
+        ep->xfer_len = 3 * ep->maxpacket;
+        if (ep->xfer_len > 127)
+        {
+          ep->xfer_len = (127 / ep->maxpacket) * ep->maxpacket;
+        }
+      }
+      deptsiz.b.xfersize = ep->xfer_len;
+      deptsiz.b.pktcnt = (ep->xfer_len + ep->maxpacket - 1) / ep->maxpacket;
+#else
       if (ep->xfer_len > ep->maxpacket)
       {
         ep->xfer_len = ep->maxpacket;
@@ -1740,6 +2068,7 @@ USB_OTG_STS USB_OTG_EP0StartXfer(USB_OTG_CORE_HANDLE *pdev , USB_OTG_EP *ep)
         deptsiz.b.xfersize = ep->xfer_len;
       }
       deptsiz.b.pktcnt = 1;
+#endif
     }
     USB_OTG_WRITE_REG32(&in_regs->DIEPTSIZ, deptsiz.d32);
     
@@ -1943,6 +2272,8 @@ void USB_OTG_EP0_OutStart(USB_OTG_CORE_HANDLE *pdev)
 
 /**
 * @brief  USB_OTG_RemoteWakeup : active remote wakeup signalling
+*         With USB_OTG_FAST_RESUME_ENABLED the signalling is only started
+*         here and stopped by USB_OTG_PowerTick
 * @param  None
 * @retval : None
 */
@@ -1952,6 +2283,24 @@ void USB_OTG_ActiveRemoteWakeup(USB_OTG_CORE_HANDLE *pdev)
   USB_OTG_DCTL_TypeDef     dctl;
   USB_OTG_DSTS_TypeDef     dsts;
   USB_OTG_PCGCCTL_TypeDef  power;  
+#ifdef USB_OTG_LPM_ENABLED
+  USB_OTG_GLPMCFG_TypeDef  glpmcfg;
+  
+  if (pdev->dev.power_state == USB_OTG_PWR_L1)
+  {
+    /* L1 remote wakeup, when allowed by the host in the LPM token: the core
+       clears rmtwkupsig itself after TL1DevDrvResume (50 us) */
+    glpmcfg.d32 = USB_OTG_READ_REG32(&pdev->regs.GREGS->GLPMCFG);
+    if (glpmcfg.b.remwake)
+    {
+      dctl.d32 = 0;
+      dctl.b.rmtwkupsig = 1;
+      USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DCTL, 0, dctl.d32);
+      pdev->dev.power_state = USB_OTG_PWR_RESUMING;
+    }
+    return;
+  }
+#endif
   
   if (pdev->dev.DevRemoteWakeup) 
   {
@@ -1970,11 +2319,40 @@ void USB_OTG_ActiveRemoteWakeup(USB_OTG_CORE_HANDLE *pdev)
       dctl.d32 = 0;
       dctl.b.rmtwkupsig = 1;
       USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DCTL, 0, dctl.d32);
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+      pdev->dev.power_state   = USB_OTG_PWR_RESUMING;
+      pdev->dev.rmtwkup_timer = USB_OTG_RMTWKUP_TIME;
+#else
       USB_OTG_BSP_mDelay(5);
       USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DCTL, dctl.d32, 0 );
+#endif
+    }
+  }
+}
+
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+/**
+* @brief  USB_OTG_PowerTick : stops the remote wakeup signalling once
+*         USB_OTG_RMTWKUP_TIME has elapsed. To be called every 1 ms, from
+*         the SysTick or a timer interrupt
+* @param  None
+* @retval : None
+*/
+void USB_OTG_PowerTick(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_DCTL_TypeDef     dctl;
+  
+  if (pdev->dev.rmtwkup_timer != 0)
+  {
+    if (--pdev->dev.rmtwkup_timer == 0)
+    {
+      dctl.d32 = 0;
+      dctl.b.rmtwkupsig = 1;
+      USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DCTL, dctl.d32, 0 );
     }
   }
 }
+#endif
 
 
 /**
@@ -28,6 +28,8 @@
 /* Includes ------------------------------------------------------------------*/
 #include "usb_dcd.h"
 #include "usb_bsp.h"
+#include "usb_fifo_dma.h"
+#include "usb_stats.h"
 
 
 /** @addtogroup USB_OTG_DRIVER
@@ -43,6 +45,10 @@
 /** @defgroup USB_DCD_Private_Defines
 * @{
 */ 
+#ifdef USB_OTG_EP_SG_ENABLED
+/* Largest packet count of the DIEPTSIZ/DOEPTSIZ registers */
+#define USB_OTG_SG_MAX_PKTCNT          1023
+#endif
 /**
 * @}
 */ 
@@ -76,6 +82,9 @@
 /** @defgroup USB_DCD_Private_FunctionPrototypes
 * @{
 */ 
+#ifdef USB_OTG_EP_SG_ENABLED
+static void DCD_EP_SGStart (USB_OTG_CORE_HANDLE *pdev, USB_OTG_EP *ep);
+#endif
 
 /**
 * @}
@@ -140,6 +149,16 @@ void DCD_Init(USB_OTG_CORE_HANDLE *pdev ,
   /* Init Device */
   USB_OTG_CoreInitDev(pdev);
   
+#ifdef USB_OTG_FS_DMA_FIFO_ENABLED
+  if (coreID == USB_OTG_FS_CORE_ID)
+  {
+    USB_OTG_FifoDMA_Init(pdev);
+  }
+#endif
+#ifdef USB_OTG_STATS_ENABLED
+  USB_OTG_Stats_Init(pdev);
+#endif
+  
   
   /* Enable USB Global interrupt */
   USB_OTG_EnableGlobalInt(pdev);
@@ -170,8 +189,18 @@ uint32_t DCD_EP_Open(USB_OTG_CORE_HANDLE *pdev ,
   ep->num   = ep_addr & 0x7F;
   
   ep->is_in = (0x80 & ep_addr) != 0;
-  ep->maxpacket = ep_mps;
+  ep->maxpacket = USB_OTG_MPS_SIZE(ep_mps);
   ep->type = ep_type;
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  /* Additional transactions: high speed isochronous endpoints only */
+  ep->mult = 1;
+  if ((ep_type == USB_OTG_EP_ISOC) &&
+      (pdev->cfg.coreID == USB_OTG_HS_CORE_ID) &&
+      (pdev->cfg.speed == USB_OTG_SPEED_HIGH))
+  {
+    ep->mult = USB_OTG_MPS_MULT(ep_mps);
+  }
+#endif
   if (ep->is_in)
   {
     /* Assign a Tx FIFO */
@@ -206,6 +235,21 @@ uint32_t DCD_EP_Close(USB_OTG_CORE_HANDLE *pdev , uint8_t  ep_addr)
   ep->num   = ep_addr & 0x7F;
   ep->is_in = (0x80 & ep_addr) != 0;
   USB_OTG_EPDeactivate(pdev , ep );
+#ifdef USB_OTG_EP_QUEUE_ENABLED
+  if (ep->is_in)
+  {
+    DCD_EP_QueueFlush(pdev, ep_addr);
+  }
+#endif
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+  if (!ep->is_in)
+  {
+    DCD_EP_RxPoolClose(pdev, ep_addr);
+  }
+#endif
+#ifdef USB_OTG_EP_SG_ENABLED
+  ep->sg_list = 0;
+#endif
   return 0;
 }
 
@@ -463,6 +507,454 @@ void DCD_SetEPStatus (USB_OTG_CORE_HANDLE *pdev , uint8_t epnum , uint32_t Statu
    USB_OTG_SetEPStatus(pdev ,ep , Status);
 }
 
+#ifdef USB_OTG_EP_QUEUE_ENABLED
+/**
+* @brief  Queue a buffer for transmission on an IN endpoint.
+*         The transfer is started at once if the endpoint is idle, otherwise
+*         it is started from the transfer complete interrupt of the previous
+*         one. The class DataIn callback is still called for each buffer.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @param pbuf: pointer to Tx buffer
+* @param buf_len: data length
+* @retval : 0 when the buffer is accepted, 1 when the queue is full
+*/
+uint32_t  DCD_EP_QueueTx ( USB_OTG_CORE_HANDLE *pdev,
+                          uint8_t   ep_addr,
+                          uint8_t   *pbuf,
+                          uint32_t   buf_len)
+{
+  USB_OTG_EP *ep;
+  uint32_t primask;
+  uint8_t next;
+  
+  ep = &pdev->dev.in_ep[ep_addr & 0x7F];
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  
+  if (ep->queue_busy == 0)
+  {
+    /* Endpoint idle: start the transfer right now */
+    ep->queue_busy = 1;
+    __set_PRIMASK(primask);
+    DCD_EP_Tx (pdev, ep_addr, pbuf, buf_len);
+    return 0;
+  }
+  
+  next = (ep->queue_tail + 1) % USB_OTG_EP_QUEUE_DEPTH;
+  if (next == ep->queue_head)
+  {
+    /* Queue full */
+    __set_PRIMASK(primask);
+    return 1;
+  }
+  
+  ep->xfer_queue[ep->queue_tail].buf = pbuf;
+  ep->xfer_queue[ep->queue_tail].len = buf_len;
+  ep->queue_tail = next;
+  
+  __set_PRIMASK(primask);
+  return 0;
+}
+
+/**
+* @brief  Start the next queued transfer of an IN endpoint.
+*         Called from the IN transfer complete interrupt.
+* @param pdev: device instance
+* @param epnum: endpoint number
+* @retval : 1 if a queued transfer was started, 0 if the endpoint is now idle
+*/
+uint32_t  DCD_EP_QueueTxNext (USB_OTG_CORE_HANDLE *pdev, uint8_t epnum)
+{
+  USB_OTG_EP *ep;
+  USB_OTG_EP_XFER *xfer;
+  
+  ep = &pdev->dev.in_ep[epnum];
+  
+  if (ep->queue_busy == 0)
+  {
+    return 0;
+  }
+  
+  if (ep->queue_head == ep->queue_tail)
+  {
+    ep->queue_busy = 0;
+    return 0;
+  }
+  
+  xfer = &ep->xfer_queue[ep->queue_head];
+  ep->queue_head = (ep->queue_head + 1) % USB_OTG_EP_QUEUE_DEPTH;
+  
+  DCD_EP_Tx (pdev, epnum | 0x80, xfer->buf, xfer->len);
+  return 1;
+}
+
+/**
+* @brief  Returns the number of transfers owned by the endpoint queue,
+*         including the one in progress.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @retval : number of pending transfers
+*/
+uint32_t  DCD_EP_QueueCount (USB_OTG_CORE_HANDLE *pdev, uint8_t ep_addr)
+{
+  USB_OTG_EP *ep;
+  uint32_t count;
+  
+  ep = &pdev->dev.in_ep[ep_addr & 0x7F];
+  
+  count = (ep->queue_tail + USB_OTG_EP_QUEUE_DEPTH - ep->queue_head) % \
+    USB_OTG_EP_QUEUE_DEPTH;
+  
+  return count + ep->queue_busy;
+}
+
+/**
+* @brief  Drop all the queued transfers of an IN endpoint.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @retval : None
+*/
+void  DCD_EP_QueueFlush (USB_OTG_CORE_HANDLE *pdev, uint8_t ep_addr)
+{
+  USB_OTG_EP *ep;
+  uint32_t primask;
+  
+  ep = &pdev->dev.in_ep[ep_addr & 0x7F];
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  ep->queue_head = 0;
+  ep->queue_tail = 0;
+  ep->queue_busy = 0;
+  __set_PRIMASK(primask);
+}
+#endif
+
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+/**
+* @brief  Switch an opened OUT endpoint to application buffers: the data is
+*         copied (or DMAed) once, straight into the buffers posted with
+*         DCD_EP_PostRx, and each filled buffer is given back to RxDone from
+*         the interrupt. The class DataOut callback is no longer called for
+*         this endpoint, so the class must not prepare its own reception.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @param RxDone: filled buffer callback
+* @retval : None
+*/
+void  DCD_EP_RxPoolOpen (USB_OTG_CORE_HANDLE *pdev,
+                         uint8_t ep_addr,
+                         USB_OTG_EP_RXDONE RxDone)
+{
+  USB_OTG_EP *ep;
+  
+  ep = &pdev->dev.out_ep[ep_addr & 0x7F];
+  
+  DCD_EP_RxPoolClose(pdev, ep_addr);
+  ep->RxDone = RxDone;
+}
+
+/**
+* @brief  Give a receive buffer to an OUT endpoint opened with
+*         DCD_EP_RxPoolOpen. The reception is started at once if the
+*         endpoint was waiting for a buffer (it NAKs meanwhile).
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @param pbuf: pointer to Rx buffer (4-bytes aligned in DMA mode)
+* @param buf_len: buffer length, a multiple of the max packet size
+* @retval : 0 when the buffer is accepted, 1 when the pool is full
+*/
+uint32_t  DCD_EP_PostRx ( USB_OTG_CORE_HANDLE *pdev,
+                         uint8_t   ep_addr,
+                         uint8_t   *pbuf,
+                         uint16_t   buf_len)
+{
+  USB_OTG_EP *ep;
+  uint32_t primask;
+  uint8_t next;
+  
+  ep = &pdev->dev.out_ep[ep_addr & 0x7F];
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  
+  next = (ep->rx_tail + 1) % USB_OTG_EP_RX_POOL_DEPTH;
+  if (next == ep->rx_head)
+  {
+    /* Pool full */
+    __set_PRIMASK(primask);
+    return 1;
+  }
+  
+  ep->rx_pool[ep->rx_tail].buf = pbuf;
+  ep->rx_pool[ep->rx_tail].len = buf_len;
+  ep->rx_tail = next;
+  
+  if (ep->rx_busy == 0)
+  {
+    ep->rx_busy = 1;
+    DCD_EP_PrepareRx (pdev, ep_addr & 0x7F, pbuf, buf_len);
+  }
+  
+  __set_PRIMASK(primask);
+  return 0;
+}
+
+/**
+* @brief  Hand the filled buffer back to the application and start the
+*         reception in the next posted one. Called from the OUT transfer
+*         complete interrupt.
+* @param pdev: device instance
+* @param epnum: endpoint number
+* @retval : 1 if the transfer was for a pool buffer, 0 otherwise
+*/
+uint32_t  DCD_EP_RxPoolNext (USB_OTG_CORE_HANDLE *pdev, uint8_t epnum)
+{
+  USB_OTG_EP *ep;
+  USB_OTG_EP_XFER *xfer;
+  USB_OTG_DEPXFRSIZ_TypeDef  deptsiz;
+  uint32_t count, pktcnt;
+  uint8_t  *buf;
+  
+  ep = &pdev->dev.out_ep[epnum];
+  
+  if ((ep->RxDone == 0) || (ep->rx_busy == 0))
+  {
+    return 0;
+  }
+  
+  xfer = &ep->rx_pool[ep->rx_head];
+  buf = xfer->buf;
+  if (pdev->cfg.dma_enable == 1)
+  {
+    /* What was received is what the core did not count down */
+    deptsiz.d32 = USB_OTG_READ_REG32(&(pdev->regs.OUTEP_REGS[epnum]->DOEPTSIZ));
+    pktcnt = (xfer->len + ep->maxpacket - 1) / ep->maxpacket;
+    if (pktcnt == 0)
+    {
+      pktcnt = 1;
+    }
+    count = (pktcnt * ep->maxpacket) - deptsiz.b.xfersize;
+  }
+  else
+  {
+    count = ep->xfer_count;
+  }
+  ep->rx_head = (ep->rx_head + 1) % USB_OTG_EP_RX_POOL_DEPTH;
+  
+  if (ep->rx_head != ep->rx_tail)
+  {
+    xfer = &ep->rx_pool[ep->rx_head];
+    DCD_EP_PrepareRx (pdev, epnum, xfer->buf, xfer->len);
+  }
+  else
+  {
+    /* No more buffer: the endpoint NAKs until the next DCD_EP_PostRx */
+    ep->rx_busy = 0;
+  }
+  
+  ep->RxDone(pdev, epnum, buf, count);
+  return 1;
+}
+
+/**
+* @brief  Give the application buffers of an OUT endpoint back (they are
+*         not reported through RxDone) and detach the callback.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @retval : None
+*/
+void  DCD_EP_RxPoolClose (USB_OTG_CORE_HANDLE *pdev, uint8_t ep_addr)
+{
+  USB_OTG_EP *ep;
+  uint32_t primask;
+  
+  ep = &pdev->dev.out_ep[ep_addr & 0x7F];
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  ep->rx_head = 0;
+  ep->rx_tail = 0;
+  ep->rx_busy = 0;
+  ep->RxDone = 0;
+  __set_PRIMASK(primask);
+}
+#endif
+
+#ifdef USB_OTG_EP_SG_ENABLED
+/**
+* @brief  Transmit a list of segments as one transfer over an IN endpoint.
+*         Each segment is started from the transfer complete interrupt of
+*         the previous one (the segments larger than the packet count limit
+*         are split), the class DataIn callback is called once at the end.
+*         All the segments but the last must be a multiple of the max packet
+*         size, and 4-bytes aligned when the internal DMA is used.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @param segs: segment list, must stay valid until DataIn
+* @param nseg: number of segments
+* @retval : status
+*/
+uint32_t  DCD_EP_TxSG ( USB_OTG_CORE_HANDLE *pdev,
+                       uint8_t   ep_addr,
+                       const USB_OTG_EP_XFER *segs,
+                       uint8_t   nseg)
+{
+  USB_OTG_EP *ep;
+  
+  ep = &pdev->dev.in_ep[ep_addr & 0x7F];
+  
+  if ((ep_addr & 0x7F) == 0 || nseg == 0)
+  {
+    return 1;
+  }
+  
+  ep->is_in = 1;
+  ep->num = ep_addr & 0x7F;
+  ep->sg_list = segs;
+  ep->sg_count = nseg;
+  ep->sg_index = 0;
+  ep->sg_offset = 0;
+  ep->sg_done = 0;
+  
+  DCD_EP_SGStart(pdev, ep);
+  return 0;
+}
+
+/**
+* @brief  Receive a transfer into a list of segments over an OUT endpoint.
+*         The reception ends with the last segment or on a short packet;
+*         the class DataOut callback is then called once with xfer_count
+*         set to the total received length. All the segments must be a
+*         multiple of the max packet size, and 4-bytes aligned when the
+*         internal DMA is used.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @param segs: segment list, must stay valid until DataOut
+* @param nseg: number of segments
+* @retval : status
+*/
+uint32_t  DCD_EP_PrepareRxSG ( USB_OTG_CORE_HANDLE *pdev,
+                              uint8_t   ep_addr,
+                              const USB_OTG_EP_XFER *segs,
+                              uint8_t   nseg)
+{
+  USB_OTG_EP *ep;
+  
+  ep = &pdev->dev.out_ep[ep_addr & 0x7F];
+  
+  if ((ep_addr & 0x7F) == 0 || nseg == 0)
+  {
+    return 1;
+  }
+  
+  ep->is_in = 0;
+  ep->num = ep_addr & 0x7F;
+  ep->sg_list = segs;
+  ep->sg_count = nseg;
+  ep->sg_index = 0;
+  ep->sg_offset = 0;
+  ep->sg_done = 0;
+  
+  DCD_EP_SGStart(pdev, ep);
+  return 0;
+}
+
+/**
+* @brief  Account for the chunk just transferred and start the next one.
+*         Called from the transfer complete interrupt.
+* @param pdev: device instance
+* @param ep_addr: endpoint address
+* @retval : 1 when a new chunk was started, 0 when the class has to be told
+*/
+uint32_t  DCD_EP_SGNext (USB_OTG_CORE_HANDLE *pdev, uint8_t ep_addr)
+{
+  USB_OTG_EP *ep;
+  USB_OTG_DEPXFRSIZ_TypeDef  deptsiz;
+  uint32_t count = 0;
+  uint32_t pktcnt;
+  
+  if ((ep_addr & 0x80) == 0x80)
+  {
+    ep = &pdev->dev.in_ep[ep_addr & 0x7F];
+  }
+  else
+  {
+    ep = &pdev->dev.out_ep[ep_addr & 0x7F];
+  }
+  
+  if (ep->sg_list == 0)
+  {
+    return 0;
+  }
+  
+  if (ep->is_in)
+  {
+    count = ep->sg_chunk;
+  }
+  else if (pdev->cfg.dma_enable == 1)
+  {
+    /* What was received is what the core did not count down */
+    deptsiz.d32 = USB_OTG_READ_REG32(&(pdev->regs.OUTEP_REGS[ep->num]->DOEPTSIZ));
+    pktcnt = (ep->sg_chunk + ep->maxpacket - 1) / ep->maxpacket;
+    count = (pktcnt * ep->maxpacket) - deptsiz.b.xfersize;
+  }
+  else
+  {
+    count = ep->xfer_count;
+  }
+  
+  ep->sg_done += count;
+  ep->sg_offset += count;
+  if (ep->sg_offset >= ep->sg_list[ep->sg_index].len)
+  {
+    ep->sg_offset = 0;
+    ep->sg_index++;
+  }
+  
+  /* Short packet: the host ended the OUT transfer */
+  if ((ep->sg_index < ep->sg_count) && ((ep->is_in) || (count == ep->sg_chunk)))
+  {
+    DCD_EP_SGStart(pdev, ep);
+    return 1;
+  }
+  
+  /* End of the list: report the whole transfer to the class */
+  ep->sg_list = 0;
+  ep->xfer_count = ep->sg_done;
+  return 0;
+}
+
+/**
+* @brief  Start the transfer of the current segment chunk
+* @param pdev: device instance
+* @param ep: endpoint
+* @retval : None
+*/
+static void DCD_EP_SGStart (USB_OTG_CORE_HANDLE *pdev, USB_OTG_EP *ep)
+{
+  const USB_OTG_EP_XFER *seg;
+  uint32_t chunk;
+  
+  seg = &ep->sg_list[ep->sg_index];
+  chunk = seg->len - ep->sg_offset;
+  if (chunk > (USB_OTG_SG_MAX_PKTCNT * ep->maxpacket))
+  {
+    chunk = USB_OTG_SG_MAX_PKTCNT * ep->maxpacket;
+  }
+  
+  ep->sg_chunk = chunk;
+  ep->xfer_buff = seg->buf + ep->sg_offset;
+  ep->dma_addr = (uint32_t)ep->xfer_buff;
+  ep->xfer_count = 0;
+  ep->xfer_len = chunk;
+  
+  USB_OTG_EPStartXfer(pdev, ep);
+}
+#endif
+
 /**
 * @}
 */ 
@@ -27,6 +27,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "usb_dcd_int.h"
+#include "usb_fifo_dma.h"
+#include "usb_stats.h"
 /** @addtogroup USB_OTG_DRIVER
 * @{
 */
@@ -40,6 +42,9 @@
 /** @defgroup USB_DCD_INT_Private_Defines
 * @{
 */ 
+#ifndef USB_OTG_ISR_MAX_LOOPS
+ #define USB_OTG_ISR_MAX_LOOPS         4
+#endif
 /**
 * @}
 */ 
@@ -48,6 +53,7 @@
 /** @defgroup USB_DCD_INT_Private_TypesDefinitions
 * @{
 */ 
+typedef uint32_t (*DCD_ISR_Handler_TypeDef)(USB_OTG_CORE_HANDLE *pdev);
 /**
 * @}
 */ 
@@ -74,7 +80,10 @@
 * @{
 */ 
 /* static functions */
-static uint32_t DCD_ReadDevInEP (USB_OTG_CORE_HANDLE *pdev, uint8_t epnum);
+static uint32_t DCD_ReadDevInEP (USB_OTG_CORE_HANDLE *pdev,
+                                 uint8_t epnum,
+                                 uint32_t msk,
+                                 uint32_t emp);
 
 /* Interrupt Handlers */
 static uint32_t DCD_HandleInEP_ISR(USB_OTG_CORE_HANDLE *pdev);
@@ -88,9 +97,16 @@ static uint32_t DCD_HandleUsbReset_ISR(USB_OTG_CORE_HANDLE *pdev);
 static uint32_t DCD_HandleEnumDone_ISR(USB_OTG_CORE_HANDLE *pdev);
 static uint32_t DCD_HandleResume_ISR(USB_OTG_CORE_HANDLE *pdev);
 static uint32_t DCD_HandleUSBSuspend_ISR(USB_OTG_CORE_HANDLE *pdev);
+#ifdef USB_OTG_LPM_ENABLED
+static uint32_t DCD_HandleLPM_ISR(USB_OTG_CORE_HANDLE *pdev);
+#endif
 
 static uint32_t DCD_IsoINIncomplete_ISR(USB_OTG_CORE_HANDLE *pdev);
 static uint32_t DCD_IsoOUTIncomplete_ISR(USB_OTG_CORE_HANDLE *pdev);
+static uint32_t DCD_HandleModeMismatch_ISR(USB_OTG_CORE_HANDLE *pdev);
+#ifdef USB_OTG_STATS_ENABLED
+static void DCD_Stats_DMAXfer(USB_OTG_EP *ep, uint32_t len);
+#endif
 #ifdef VBUS_SENSING_ENABLED
 static uint32_t DCD_SessionRequest_ISR(USB_OTG_CORE_HANDLE *pdev);
 static uint32_t DCD_OTG_ISR(USB_OTG_CORE_HANDLE *pdev);
@@ -105,6 +121,54 @@ static uint32_t DCD_OTG_ISR(USB_OTG_CORE_HANDLE *pdev);
 * @{
 */ 
 
+/* GINTSTS bit number -> handler; the bits without handler are not served */
+static const DCD_ISR_Handler_TypeDef DCD_ISR_Table[32] =
+{
+  0,                                  /*  0 curmode       */
+  DCD_HandleModeMismatch_ISR,         /*  1 modemismatch  */
+#ifdef VBUS_SENSING_ENABLED
+  DCD_OTG_ISR,                        /*  2 otgintr       */
+#else
+  0,
+#endif
+  DCD_HandleSof_ISR,                  /*  3 sofintr       */
+  DCD_HandleRxStatusQueueLevel_ISR,   /*  4 rxstsqlvl     */
+  0, 0, 0, 0, 0, 0,                   /*  5..10          */
+  DCD_HandleUSBSuspend_ISR,           /* 11 usbsuspend    */
+  DCD_HandleUsbReset_ISR,             /* 12 usbreset      */
+  DCD_HandleEnumDone_ISR,             /* 13 enumdone      */
+  0, 0, 0, 0,                         /* 14..17          */
+  DCD_HandleInEP_ISR,                 /* 18 inepint       */
+  DCD_HandleOutEP_ISR,                /* 19 outepintr     */
+  DCD_IsoINIncomplete_ISR,            /* 20 incomplisoin  */
+  DCD_IsoOUTIncomplete_ISR,           /* 21 incomplisoout */
+  0, 0, 0, 0, 0,                      /* 22..26          */
+#ifdef USB_OTG_LPM_ENABLED
+  DCD_HandleLPM_ISR,                  /* 27 lpmint        */
+#else
+  0,
+#endif
+  0, 0,                               /* 28..29          */
+#ifdef VBUS_SENSING_ENABLED
+  DCD_SessionRequest_ISR,             /* 30 sessreqintr   */
+#else
+  0,
+#endif
+  DCD_HandleResume_ISR,               /* 31 wkupintr      */
+};
+
+/* Bits of DCD_ISR_Table with a handler */
+#ifdef VBUS_SENSING_ENABLED
+ #define DCD_ISR_VBUS_MSK              0xC03C381EU
+#else
+ #define DCD_ISR_VBUS_MSK              0x803C381AU
+#endif
+#ifdef USB_OTG_LPM_ENABLED
+ #define DCD_ISR_SERVED_MSK            (DCD_ISR_VBUS_MSK | 0x08000000U)
+#else
+ #define DCD_ISR_SERVED_MSK            DCD_ISR_VBUS_MSK
+#endif
+
 
 #ifdef USB_OTG_HS_DEDICATED_EP1_ENABLED  
 /**
@@ -127,17 +191,39 @@ uint32_t USBD_OTG_EP1OUT_ISR_Handler (USB_OTG_CORE_HANDLE *pdev)
   {
     /* Clear the bit in DOEPINTn for this interrupt */
     CLEAR_OUT_EP_INTR(1, xfercompl);
-    if (pdev->cfg.dma_enable == 1)
+#ifdef USB_OTG_STATS_ENABLED
+    USB_OTG_Stats_XferDone(pdev, &pdev->dev.out_ep[1]);
+#endif
+#ifdef USB_OTG_EP_SG_ENABLED
+    if (DCD_EP_SGNext(pdev , 1))
     {
-      deptsiz.d32 = USB_OTG_READ_REG32(&(pdev->regs.OUTEP_REGS[1]->DOEPTSIZ));
-      /*ToDo : handle more than one single MPS size packet */
-      pdev->dev.out_ep[1].xfer_count = pdev->dev.out_ep[1].maxpacket - \
-        deptsiz.b.xfersize;
-    }    
-    /* Inform upper layer: data ready */
-    /* RX COMPLETE */
-    USBD_DCD_INT_fops->DataOutStage(pdev , 1);
-    
+      /* Next segment started, the class is told at the end of the list */
+    }
+    else
+#endif
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+    if (DCD_EP_RxPoolNext(pdev , 1))
+    {
+      /* Application buffer: the class is not involved */
+    }
+    else
+#endif
+    {
+      if (pdev->cfg.dma_enable == 1)
+      {
+        deptsiz.d32 = USB_OTG_READ_REG32(&(pdev->regs.OUTEP_REGS[1]->DOEPTSIZ));
+        /*ToDo : handle more than one single MPS size packet */
+        pdev->dev.out_ep[1].xfer_count = pdev->dev.out_ep[1].maxpacket - \
+          deptsiz.b.xfersize;
+#ifdef USB_OTG_STATS_ENABLED
+        DCD_Stats_DMAXfer(&pdev->dev.out_ep[1], pdev->dev.out_ep[1].xfer_count);
+#endif
+      }    
+      /* Inform upper layer: data ready */
+      /* RX COMPLETE */
+      TRACE_USB(TRACE_EV_USB_OUT, 1);
+      USBD_DCD_INT_fops->DataOutStage(pdev , 1);
+    }
   }
   
   /* Endpoint disable  */
@@ -172,8 +258,29 @@ uint32_t USBD_OTG_EP1IN_ISR_Handler (USB_OTG_CORE_HANDLE *pdev)
     fifoemptymsk = 0x1 << 1;
     USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DIEPEMPMSK, fifoemptymsk, 0);
     CLEAR_IN_EP_INTR(1, xfercompl);
-    /* TX COMPLETE */
-    USBD_DCD_INT_fops->DataInStage(pdev , 1);
+#ifdef USB_OTG_STATS_ENABLED
+    USB_OTG_Stats_XferDone(pdev, &pdev->dev.in_ep[1]);
+    if (pdev->cfg.dma_enable == 1)
+    {
+      DCD_Stats_DMAXfer(&pdev->dev.in_ep[1], pdev->dev.in_ep[1].xfer_len);
+    }
+#endif
+#ifdef USB_OTG_EP_SG_ENABLED
+    if (DCD_EP_SGNext(pdev , 0x81))
+    {
+      /* Next segment started, the class is told at the end of the list */
+    }
+    else
+#endif
+    {
+#ifdef USB_OTG_EP_QUEUE_ENABLED
+      /* Chain the next queued transfer before informing the class */
+      DCD_EP_QueueTxNext(pdev , 1);
+#endif
+      /* TX COMPLETE */
+      TRACE_USB(TRACE_EV_USB_IN, 1);
+      USBD_DCD_INT_fops->DataInStage(pdev , 1);
+    }
   }
   if ( diepint.b.epdisabled )
   {
@@ -185,6 +292,7 @@ uint32_t USBD_OTG_EP1IN_ISR_Handler (USB_OTG_CORE_HANDLE *pdev)
   }
   if (diepint.b.intktxfemp)
   {
+    USB_OTG_STATS_ADD(pdev->dev.in_ep[1].stats, nak, 1);
     CLEAR_IN_EP_INTR(1, intktxfemp);
   }
   if (diepint.b.inepnakeff)
@@ -208,91 +316,78 @@ uint32_t USBD_OTG_EP1IN_ISR_Handler (USB_OTG_CORE_HANDLE *pdev)
 */
 uint32_t USBD_OTG_ISR_Handler (USB_OTG_CORE_HANDLE *pdev)
 {
-  USB_OTG_GINTSTS_TypeDef  gintr_status;
+  uint32_t pending;
+  uint32_t loops = USB_OTG_ISR_MAX_LOOPS;
   uint32_t retval = 0;
+  uint8_t  bit;
   
   if (USB_OTG_IsDeviceMode(pdev)) /* ensure that we are in device mode */
   {
-    gintr_status.d32 = USB_OTG_ReadCoreItr(pdev);
-    if (!gintr_status.d32) /* avoid spurious interrupt */
-    {
-      return 0;
-    }
-    
-    if (gintr_status.b.outepintr)
+    TRACE_ISR_ENTER();
+    USB_OTG_STATS_ISR_ENTER(pdev);
+    /* Serve the pending and unmasked events, then take a new snapshot so that
+       the events raised meanwhile do not need another exception entry */
+    do
     {
-      retval |= DCD_HandleOutEP_ISR(pdev);
-    }    
-    
-    if (gintr_status.b.inepint)
-    {
-      retval |= DCD_HandleInEP_ISR(pdev);
-    }
-    
-    if (gintr_status.b.modemismatch)
-    {
-      USB_OTG_GINTSTS_TypeDef  gintsts;
-      
-      /* Clear interrupt */
-      gintsts.d32 = 0;
-      gintsts.b.modemismatch = 1;
-      USB_OTG_WRITE_REG32(&pdev->regs.GREGS->GINTSTS, gintsts.d32);
-    }
-    
-    if (gintr_status.b.wkupintr)
-    {
-      retval |= DCD_HandleResume_ISR(pdev);
-    }
-    
-    if (gintr_status.b.usbsuspend)
-    {
-      retval |= DCD_HandleUSBSuspend_ISR(pdev);
-    }
-    if (gintr_status.b.sofintr)
-    {
-      retval |= DCD_HandleSof_ISR(pdev);
-      
-    }
-    
-    if (gintr_status.b.rxstsqlvl)
-    {
-      retval |= DCD_HandleRxStatusQueueLevel_ISR(pdev);
-      
-    }
-    
-    if (gintr_status.b.usbreset)
-    {
-      retval |= DCD_HandleUsbReset_ISR(pdev);
+      pending = USB_OTG_ReadCoreItr(pdev) & DCD_ISR_SERVED_MSK;
+      if (!pending) /* avoid spurious interrupt */
+      {
+        break;
+      }
       
+      /* Lowest bit first: usbreset is served before enumdone */
+      while (pending)
+      {
+        bit = __CLZ(__RBIT(pending));
+        pending &= ~(0x1U << bit);
+        retval |= DCD_ISR_Table[bit](pdev);
+      }
     }
-    if (gintr_status.b.enumdone)
-    {
-      retval |= DCD_HandleEnumDone_ISR(pdev);
-    }
-    
-    if (gintr_status.b.incomplisoin)
-    {
-      retval |= DCD_IsoINIncomplete_ISR(pdev);
-    }
+    while (--loops);
+    USB_OTG_STATS_ISR_EXIT(pdev);
+    TRACE_ISR_EXIT();
+  }
+  return retval;
+}
 
-    if (gintr_status.b.incomplisoout)
-    {
-      retval |= DCD_IsoOUTIncomplete_ISR(pdev);
-    }    
-#ifdef VBUS_SENSING_ENABLED
-    if (gintr_status.b.sessreqintr)
-    {
-      retval |= DCD_SessionRequest_ISR(pdev);
-    }
+/**
+* @brief  DCD_HandleModeMismatch_ISR
+*         Indicates an access to a host mode register in device mode
+* @param  pdev: device instance
+* @retval status
+*/
+static uint32_t DCD_HandleModeMismatch_ISR(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_GINTSTS_TypeDef  gintsts;
+  
+  /* Clear interrupt */
+  gintsts.d32 = 0;
+  gintsts.b.modemismatch = 1;
+  USB_OTG_WRITE_REG32(&pdev->regs.GREGS->GINTSTS, gintsts.d32);
+  return 0;
+}
 
-    if (gintr_status.b.otgintr)
-    {
-      retval |= DCD_OTG_ISR(pdev);
-    }   
-#endif    
+#ifdef USB_OTG_STATS_ENABLED
+/**
+* @brief  DCD_Stats_DMAXfer
+*         Account a transfer completed by the internal DMA
+* @param  ep: endpoint
+* @param  len: transferred bytes
+* @retval None
+*/
+static void DCD_Stats_DMAXfer(USB_OTG_EP *ep, uint32_t len)
+{
+  ep->stats.bytes += len;
+  if (len == 0)
+  {
+    ep->stats.packets++;
+  }
+  else
+  {
+    ep->stats.packets += (len + ep->maxpacket - 1) / ep->maxpacket;
   }
-  return retval;
 }
+#endif
 
 #ifdef VBUS_SENSING_ENABLED
 /**
@@ -347,8 +442,19 @@ static uint32_t DCD_HandleResume_ISR(USB_OTG_CORE_HANDLE *pdev)
 {
   USB_OTG_GINTSTS_TypeDef  gintsts;
   USB_OTG_DCTL_TypeDef     devctl;
+#ifndef USB_OTG_FAST_RESUME_ENABLED
   USB_OTG_PCGCCTL_TypeDef  power;
+#endif
   
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+  /* The clocks were kept running: only leave the sleep-on-exit mode */
+  if(pdev->cfg.low_power)
+  {
+    SCB->SCR &= ~SCB_SCR_SLEEPONEXIT_Msk;
+  }
+  pdev->dev.rmtwkup_timer = 0;
+  pdev->dev.power_state   = USB_OTG_PWR_L0;
+#else
   if(pdev->cfg.low_power)
   {
     /* un-gate USB Core clock */
@@ -357,6 +463,7 @@ static uint32_t DCD_HandleResume_ISR(USB_OTG_CORE_HANDLE *pdev)
     power.b.stoppclk = 0;
     USB_OTG_WRITE_REG32(pdev->regs.PCGCCTL, power.d32);
   }
+#endif
   
   /* Clear the Remote Wake-up Signaling */
   devctl.d32 = 0;
@@ -364,6 +471,7 @@ static uint32_t DCD_HandleResume_ISR(USB_OTG_CORE_HANDLE *pdev)
   USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DCTL, devctl.d32, 0);
   
   /* Inform upper layer by the Resume Event */
+  TRACE_USB(TRACE_EV_USB_RESUME, 0);
   USBD_DCD_INT_fops->Resume (pdev);
   
   /* Clear interrupt */
@@ -382,12 +490,25 @@ static uint32_t DCD_HandleResume_ISR(USB_OTG_CORE_HANDLE *pdev)
 static uint32_t DCD_HandleUSBSuspend_ISR(USB_OTG_CORE_HANDLE *pdev)
 {
   USB_OTG_GINTSTS_TypeDef  gintsts;
+#ifndef USB_OTG_FAST_RESUME_ENABLED
   USB_OTG_PCGCCTL_TypeDef  power;
+#endif
   USB_OTG_DSTS_TypeDef     dsts;
   __IO uint8_t prev_status = 0;
   
   prev_status = pdev->dev.device_status;
-  USBD_DCD_INT_fops->Suspend (pdev);      
+#ifdef USB_OTG_LPM_ENABLED
+  if (pdev->dev.power_state == USB_OTG_PWR_L1)
+  {
+    /* L1 then L2: the suspend was already reported on entry in L1 */
+    prev_status = pdev->dev.device_old_status;
+  }
+  else
+#endif
+  {
+    TRACE_USB(TRACE_EV_USB_SUSPEND, 0);
+    USBD_DCD_INT_fops->Suspend (pdev);      
+  }
   
   dsts.d32 = USB_OTG_READ_REG32(&pdev->regs.DREGS->DSTS);
     
@@ -396,6 +517,20 @@ static uint32_t DCD_HandleUSBSuspend_ISR(USB_OTG_CORE_HANDLE *pdev)
   gintsts.b.usbsuspend = 1;
   USB_OTG_WRITE_REG32(&pdev->regs.GREGS->GINTSTS, gintsts.d32);
   
+#ifdef USB_OTG_FAST_RESUME_ENABLED
+  if((dsts.b.suspsts == 1) && (pdev->dev.connection_status == 1) && 
+    (prev_status  == USB_OTG_CONFIGURED))
+  {
+    pdev->dev.power_state = USB_OTG_PWR_L2;
+    
+    /* Keep the PHY and core clocks, so that the resume needs no clock
+       restart, and sleep (not stop) after exit from current ISR */
+    if(pdev->cfg.low_power)
+    {
+      SCB->SCR |= SCB_SCR_SLEEPONEXIT_Msk;
+    }
+  }
+#else
   if((pdev->cfg.low_power) && (dsts.b.suspsts == 1)  && 
     (pdev->dev.connection_status == 1) && 
     (prev_status  == USB_OTG_CONFIGURED))
@@ -411,9 +546,43 @@ static uint32_t DCD_HandleUSBSuspend_ISR(USB_OTG_CORE_HANDLE *pdev)
     /* Request to enter Sleep mode after exit from current ISR */
     SCB->SCR |= (SCB_SCR_SLEEPDEEP_Msk | SCB_SCR_SLEEPONEXIT_Msk);
   }
+#endif
   return 1;
 }
 
+#ifdef USB_OTG_LPM_ENABLED
+/**
+* @brief  DCD_HandleLPM_ISR
+*         Indicates that an LPM transaction was ACKed: the link enters L1
+*         and leaves it through the resume interrupt
+* @param  pdev: device instance
+* @retval status
+*/
+static uint32_t DCD_HandleLPM_ISR(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_GINTSTS_TypeDef  gintsts;
+  
+  /* Clear interrupt */
+  gintsts.d32 = 0;
+  gintsts.b.lpmint = 1;
+  USB_OTG_WRITE_REG32(&pdev->regs.GREGS->GINTSTS, gintsts.d32);
+  
+  if ((pdev->dev.power_state == USB_OTG_PWR_L0) &&
+      (pdev->dev.device_status == USB_OTG_CONFIGURED))
+  {
+    pdev->dev.power_state = USB_OTG_PWR_L1;
+    TRACE_USB(TRACE_EV_USB_SUSPEND, 0);
+    USBD_DCD_INT_fops->Suspend (pdev);
+    
+    if(pdev->cfg.low_power)
+    {
+      SCB->SCR |= SCB_SCR_SLEEPONEXIT_Msk;
+    }
+  }
+  return 1;
+}
+#endif
+
 /**
 * @brief  DCD_HandleInEP_ISR
 *         Indicates that an IN EP has a pending Interrupt
@@ -427,30 +596,64 @@ static uint32_t DCD_HandleInEP_ISR(USB_OTG_CORE_HANDLE *pdev)
   uint32_t ep_intr;
   uint32_t epnum = 0;
   uint32_t fifoemptymsk;
+  uint32_t msk, emp;
   diepint.d32 = 0;
   ep_intr = USB_OTG_ReadDevAllInEPItr(pdev);
   
+  /* The masks are read once for all the endpoints: serving an endpoint only
+     changes its own DIEPEMPMSK bit */
+  msk = USB_OTG_READ_REG32(&pdev->regs.DREGS->DIEPMSK);
+  emp = USB_OTG_READ_REG32(&pdev->regs.DREGS->DIEPEMPMSK);
+  
   while ( ep_intr )
   {
     if (ep_intr&0x1) /* In ITR */
     {
-      diepint.d32 = DCD_ReadDevInEP(pdev , epnum); /* Get In ITR status */
+      diepint.d32 = DCD_ReadDevInEP(pdev , epnum, msk, emp); /* Get In ITR status */
       if ( diepint.b.xfercompl )
       {
         fifoemptymsk = 0x1 << epnum;
         USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DIEPEMPMSK, fifoemptymsk, 0);
         CLEAR_IN_EP_INTR(epnum, xfercompl);
-        /* TX COMPLETE */
-        USBD_DCD_INT_fops->DataInStage(pdev , epnum);
-        
+#ifdef USB_OTG_STATS_ENABLED
+        if (epnum != 0)
+        {
+          USB_OTG_Stats_XferDone(pdev, &pdev->dev.in_ep[epnum]);
+        }
         if (pdev->cfg.dma_enable == 1)
         {
-          if((epnum == 0) && (pdev->dev.device_state == USB_OTG_EP0_STATUS_IN))
+          /* The core moved the whole transfer, no FIFO empty interrupt */
+          DCD_Stats_DMAXfer(&pdev->dev.in_ep[epnum], pdev->dev.in_ep[epnum].xfer_len);
+        }
+#endif
+#ifdef USB_OTG_EP_SG_ENABLED
+        if ((epnum != 0) && DCD_EP_SGNext(pdev , epnum | 0x80))
+        {
+          /* Next segment started, the class is told at the end of the list */
+        }
+        else
+#endif
+        {
+#ifdef USB_OTG_EP_QUEUE_ENABLED
+          if (epnum != 0)
           {
-            /* prepare to rx more setup packets */
-            USB_OTG_EP0_OutStart(pdev);
+            /* Chain the next queued transfer before informing the class */
+            DCD_EP_QueueTxNext(pdev , epnum);
           }
-        }           
+#endif
+          /* TX COMPLETE */
+          TRACE_USB(TRACE_EV_USB_IN, epnum);
+          USBD_DCD_INT_fops->DataInStage(pdev , epnum);
+          
+          if (pdev->cfg.dma_enable == 1)
+          {
+            if((epnum == 0) && (pdev->dev.device_state == USB_OTG_EP0_STATUS_IN))
+            {
+              /* prepare to rx more setup packets */
+              USB_OTG_EP0_OutStart(pdev);
+            }
+          }
+        }
       }
       if ( diepint.b.timeout )
       {
@@ -458,6 +661,8 @@ static uint32_t DCD_HandleInEP_ISR(USB_OTG_CORE_HANDLE *pdev)
       }
       if (diepint.b.intktxfemp)
       {
+        /* IN token answered with a NAK: nothing in the FIFO */
+        USB_OTG_STATS_ADD(pdev->dev.in_ep[epnum].stats, nak, 1);
         CLEAR_IN_EP_INTR(epnum, intktxfemp);
       }
       if (diepint.b.inepnakeff)
@@ -513,25 +718,51 @@ static uint32_t DCD_HandleOutEP_ISR(USB_OTG_CORE_HANDLE *pdev)
       {
         /* Clear the bit in DOEPINTn for this interrupt */
         CLEAR_OUT_EP_INTR(epnum, xfercompl);
-        if (pdev->cfg.dma_enable == 1)
+#ifdef USB_OTG_STATS_ENABLED
+        if (epnum != 0)
         {
-          deptsiz.d32 = USB_OTG_READ_REG32(&(pdev->regs.OUTEP_REGS[epnum]->DOEPTSIZ));
-          /*ToDo : handle more than one single MPS size packet */
-          pdev->dev.out_ep[epnum].xfer_count = pdev->dev.out_ep[epnum].maxpacket - \
-            deptsiz.b.xfersize;
+          USB_OTG_Stats_XferDone(pdev, &pdev->dev.out_ep[epnum]);
         }
-        /* Inform upper layer: data ready */
-        /* RX COMPLETE */
-        USBD_DCD_INT_fops->DataOutStage(pdev , epnum);
-        
-        if (pdev->cfg.dma_enable == 1)
+#endif
+#ifdef USB_OTG_EP_SG_ENABLED
+        if ((epnum != 0) && DCD_EP_SGNext(pdev , epnum))
+        {
+          /* Next segment started, the class is told at the end of the list */
+        }
+        else
+#endif
+#ifdef USB_OTG_EP_RX_POOL_ENABLED
+        if ((epnum != 0) && DCD_EP_RxPoolNext(pdev , epnum))
         {
-          if((epnum == 0) && (pdev->dev.device_state == USB_OTG_EP0_STATUS_OUT))
+          /* Application buffer: the class is not involved */
+        }
+        else
+#endif
+        {
+          if (pdev->cfg.dma_enable == 1)
           {
-            /* prepare to rx more setup packets */
-            USB_OTG_EP0_OutStart(pdev);
+            deptsiz.d32 = USB_OTG_READ_REG32(&(pdev->regs.OUTEP_REGS[epnum]->DOEPTSIZ));
+            /*ToDo : handle more than one single MPS size packet */
+            pdev->dev.out_ep[epnum].xfer_count = pdev->dev.out_ep[epnum].maxpacket - \
+              deptsiz.b.xfersize;
+#ifdef USB_OTG_STATS_ENABLED
+            DCD_Stats_DMAXfer(&pdev->dev.out_ep[epnum], pdev->dev.out_ep[epnum].xfer_count);
+#endif
           }
-        }        
+          /* Inform upper layer: data ready */
+          /* RX COMPLETE */
+          TRACE_USB(TRACE_EV_USB_OUT, epnum);
+          USBD_DCD_INT_fops->DataOutStage(pdev , epnum);
+          
+          if (pdev->cfg.dma_enable == 1)
+          {
+            if((epnum == 0) && (pdev->dev.device_state == USB_OTG_EP0_STATUS_OUT))
+            {
+              /* prepare to rx more setup packets */
+              USB_OTG_EP0_OutStart(pdev);
+            }
+          }
+        }
       }
       /* Endpoint disable  */
       if ( doepint.b.epdisabled )
@@ -545,6 +776,7 @@ static uint32_t DCD_HandleOutEP_ISR(USB_OTG_CORE_HANDLE *pdev)
         
         /* inform the upper layer that a setup packet is available */
         /* SETUP COMPLETE */
+        TRACE_USB(TRACE_EV_USB_SETUP, 0);
         USBD_DCD_INT_fops->SetupStage(pdev);
         CLEAR_OUT_EP_INTR(epnum, setup);
       }
@@ -566,6 +798,7 @@ static uint32_t DCD_HandleSof_ISR(USB_OTG_CORE_HANDLE *pdev)
   USB_OTG_GINTSTS_TypeDef  GINTSTS;
   
   
+  TRACE_USB(TRACE_EV_USB_SOF, 0);
   USBD_DCD_INT_fops->SOF(pdev);
   
   /* Clear interrupt */
@@ -605,6 +838,17 @@ static uint32_t DCD_HandleRxStatusQueueLevel_ISR(USB_OTG_CORE_HANDLE *pdev)
   case STS_DATA_UPDT:
     if (status.b.bcnt)
     {
+      USB_OTG_STATS_ADD(ep->stats, bytes, status.b.bcnt);
+      USB_OTG_STATS_ADD(ep->stats, packets, 1);
+#ifdef USB_OTG_FS_DMA_FIFO_ENABLED
+      if (USB_OTG_FifoDMA_Read(pdev, ep->xfer_buff, status.b.bcnt) == USB_OTG_OK)
+      {
+        ep->xfer_buff += status.b.bcnt;
+        ep->xfer_count += status.b.bcnt;
+        /* The interrupt is enabled again at the end of the DMA transfer */
+        return 1;
+      }
+#endif
       USB_OTG_ReadPacket(pdev,ep->xfer_buff, status.b.bcnt);
       ep->xfer_buff += status.b.bcnt;
       ep->xfer_count += status.b.bcnt;
@@ -669,7 +913,18 @@ static uint32_t DCD_WriteEmptyTxFifo(USB_OTG_CORE_HANDLE *pdev, uint32_t epnum)
       len = ep->maxpacket;
     }
     len32b = (len + 3) / 4;
+    USB_OTG_STATS_ADD(ep->stats, bytes, len);
+    USB_OTG_STATS_ADD(ep->stats, packets, 1);
     
+#ifdef USB_OTG_FS_DMA_FIFO_ENABLED
+    if (USB_OTG_FifoDMA_Write(pdev, ep->xfer_buff, epnum, len) == USB_OTG_OK)
+    {
+      ep->xfer_buff  += len;
+      ep->xfer_count += len;
+      /* The next packet is loaded once the DMA transfer is over */
+      break;
+    }
+#endif
     USB_OTG_WritePacket (pdev , ep->xfer_buff, epnum, len);
     
     ep->xfer_buff  += len;
@@ -678,6 +933,13 @@ static uint32_t DCD_WriteEmptyTxFifo(USB_OTG_CORE_HANDLE *pdev, uint32_t epnum)
     txstatus.d32 = USB_OTG_READ_REG32(&pdev->regs.INEP_REGS[epnum]->DTXFSTS);
   }
   
+#ifdef USB_OTG_STATS_ENABLED
+  if ((txstatus.b.txfspcavail <= len32b) && (ep->xfer_count < ep->xfer_len))
+  {
+    /* The next packet waits for the next Tx FIFO empty interrupt */
+    ep->stats.txfifo_wait++;
+  }
+#endif
   return 1;
 }
 
@@ -752,6 +1014,7 @@ static uint32_t DCD_HandleUsbReset_ISR(USB_OTG_CORE_HANDLE *pdev)
   USB_OTG_WRITE_REG32 (&pdev->regs.GREGS->GINTSTS, gintsts.d32);
   
   /*Reset internal state machine */
+  TRACE_USB(TRACE_EV_USB_RESET, 0);
   USBD_DCD_INT_fops->Reset(pdev);
   return 1;
 }
@@ -840,13 +1103,17 @@ static uint32_t DCD_IsoOUTIncomplete_ISR(USB_OTG_CORE_HANDLE *pdev)
 * @brief  DCD_ReadDevInEP
 *         Reads ep flags
 * @param  pdev: device instance
+* @param  epnum: end point number
+* @param  msk: DIEPMSK value
+* @param  emp: DIEPEMPMSK value
 * @retval status
 */
-static uint32_t DCD_ReadDevInEP (USB_OTG_CORE_HANDLE *pdev, uint8_t epnum)
+static uint32_t DCD_ReadDevInEP (USB_OTG_CORE_HANDLE *pdev,
+                                 uint8_t epnum,
+                                 uint32_t msk,
+                                 uint32_t emp)
 {
-  uint32_t v, msk, emp;
-  msk = USB_OTG_READ_REG32(&pdev->regs.DREGS->DIEPMSK);
-  emp = USB_OTG_READ_REG32(&pdev->regs.DREGS->DIEPEMPMSK);
+  uint32_t v;
   msk |= ((emp >> epnum) & 0x1) << 7;
   v = USB_OTG_READ_REG32(&pdev->regs.INEP_REGS[epnum]->DIEPINT) & msk;
   return v;
@@ -0,0 +1,218 @@
+/**
+  ******************************************************************************
+  * @file    usb_event.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   Lock-free event ring between the OTG interrupt and the stack
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_event.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+* @{
+*/
+
+/** @defgroup USB_EVENT
+* @brief The interrupt is the only producer: it writes the event, then
+*        publishes it by moving the head index. The stack thread is the only
+*        consumer: it reads the event, then releases the slot by moving the
+*        tail index. Each index has a single writer, so no lock is needed; a
+*        memory barrier orders the slot access against the index update.
+*
+*        SOF events are coalesced: at most one is queued at a time, so that a
+*        slow consumer cannot be flooded by the 1 ms tick.
+* @{
+*/
+
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+
+/** @defgroup USB_EVENT_Private_Defines
+* @{
+*/
+#if (USB_OTG_EVENT_QUEUE_SIZE & (USB_OTG_EVENT_QUEUE_SIZE - 1)) != 0
+ #error "USB_OTG_EVENT_QUEUE_SIZE must be a power of 2"
+#endif
+
+#define USB_OTG_EVENT_MSK               (USB_OTG_EVENT_QUEUE_SIZE - 1)
+/**
+* @}
+*/
+
+
+/** @defgroup USB_EVENT_Private_TypesDefinitions
+* @{
+*/
+/**
+* @}
+*/
+
+
+
+/** @defgroup USB_EVENT_Private_Macros
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_EVENT_Private_Variables
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_EVENT_Private_FunctionPrototypes
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_EVENT_Private_Functions
+* @{
+*/
+
+/**
+* @brief  USB_OTG_EventInit
+*         Empty the event ring
+* @param  pdev : Selected device
+* @retval None
+*/
+void USB_OTG_EventInit(USB_OTG_CORE_HANDLE *pdev)
+{
+  pdev->evq.head = 0;
+  pdev->evq.tail = 0;
+  pdev->evq.sof_queued = 0;
+  pdev->evq.overflow = 0;
+}
+
+/**
+* @brief  USB_OTG_EventPush
+*         Queue an event. Must only be called from the OTG interrupt.
+* @param  pdev : Selected device
+* @param  type : event type (USB_OTG_EVT_xx)
+* @param  num : endpoint or channel number
+* @param  data : event data
+* @retval USB_OTG_FAIL when the ring is full (the event is counted in
+*         evq.overflow and dropped)
+*/
+USB_OTG_STS USB_OTG_EventPush(USB_OTG_CORE_HANDLE *pdev,
+                              uint8_t type,
+                              uint8_t num,
+                              uint16_t data)
+{
+  USB_OTG_EVENT_QUEUE *evq = &pdev->evq;
+  uint16_t head = evq->head;
+  
+  if (type == USB_OTG_EVT_SOF)
+  {
+    if (evq->sof_queued)
+    {
+      return USB_OTG_OK;
+    }
+  }
+  
+  if (((head + 1) & USB_OTG_EVENT_MSK) == evq->tail)
+  {
+    evq->overflow++;
+    return USB_OTG_FAIL;
+  }
+  
+  evq->ring[head].type = type;
+  evq->ring[head].num  = num;
+  evq->ring[head].data = data;
+  if (type == USB_OTG_EVT_SOF)
+  {
+    evq->sof_queued = 1;
+  }
+  
+  /* The slot must be written before it is published */
+  __DMB();
+  evq->head = (head + 1) & USB_OTG_EVENT_MSK;
+  
+  USB_OTG_EVENT_NOTIFY(pdev);
+  return USB_OTG_OK;
+}
+
+/**
+* @brief  USB_OTG_EventPop
+*         Take the oldest event. Must only be called from the stack thread.
+* @param  pdev : Selected device
+* @param  evt : event read
+* @retval 1 when an event was read, 0 when the ring is empty
+*/
+uint8_t USB_OTG_EventPop(USB_OTG_CORE_HANDLE *pdev, USB_OTG_EVENT *evt)
+{
+  USB_OTG_EVENT_QUEUE *evq = &pdev->evq;
+  uint16_t tail = evq->tail;
+  
+  if (tail == evq->head)
+  {
+    return 0;
+  }
+  
+  /* The head must be read before the slot it publishes */
+  __DMB();
+  *evt = evq->ring[tail];
+  if (evt->type == USB_OTG_EVT_SOF)
+  {
+    evq->sof_queued = 0;
+  }
+  
+  /* The slot must be read before it is released */
+  __DMB();
+  evq->tail = (tail + 1) & USB_OTG_EVENT_MSK;
+  return 1;
+}
+
+/**
+* @brief  USB_OTG_EventPending
+*         Number of queued events
+* @param  pdev : Selected device
+* @retval count
+*/
+uint32_t USB_OTG_EventPending(USB_OTG_CORE_HANDLE *pdev)
+{
+  return (pdev->evq.head - pdev->evq.tail) & USB_OTG_EVENT_MSK;
+}
+
+/**
+* @}
+*/
+
+#endif /* USB_OTG_EVENT_QUEUE_ENABLED */
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
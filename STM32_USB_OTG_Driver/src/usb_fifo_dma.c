@@ -0,0 +1,300 @@
+/**
+  ******************************************************************************
+  * @file    usb_fifo_dma.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   FS core FIFO accesses through a DMA2 memory to memory stream
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_fifo_dma.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+* @{
+*/
+
+/** @defgroup USB_FIFO_DMA
+* @brief The FS core has no internal DMA: this layer lets a DMA2 memory to
+*        memory stream move the packet data between the RAM buffers and the
+*        FS core FIFO window, so that the CPU does not run the copy loops of
+*        USB_OTG_ReadPacket/USB_OTG_WritePacket.
+*
+*        One stream is shared by the Rx and Tx directions: when it is busy
+*        the caller falls back to the CPU copy. While a Rx packet is being
+*        drained the Rx status queue level interrupt stays masked, while a Tx
+*        packet is being pushed the Tx FIFO empty interrupt of that endpoint
+*        stays masked; both are restored from USB_OTG_FifoDMA_IRQHandler,
+*        which must be called from the IRQ handler of USB_OTG_FS_DMA_STREAM
+*        (the NVIC channel USB_OTG_FS_DMA_IRQn is enabled by the BSP with
+*        the same priority as the OTG FS interrupt).
+*
+*        The double buffer mode of the stream cannot be used here: it is not
+*        available for memory to memory transfers.
+* @{
+*/
+
+#ifdef USB_OTG_FS_DMA_FIFO_ENABLED
+
+/** @defgroup USB_FIFO_DMA_Private_Defines
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_FIFO_DMA_Private_TypesDefinitions
+* @{
+*/
+/**
+* @}
+*/
+
+
+
+/** @defgroup USB_FIFO_DMA_Private_Macros
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_FIFO_DMA_Private_Variables
+* @{
+*/
+static __IO uint8_t  FifoDMA_State = USB_OTG_FIFO_DMA_IDLE;
+static uint8_t       FifoDMA_EpNum = 0;
+/**
+* @}
+*/
+
+
+/** @defgroup USB_FIFO_DMA_Private_FunctionPrototypes
+* @{
+*/
+static void USB_OTG_FifoDMA_Start(uint32_t src, uint32_t dst, uint32_t count32b);
+/**
+* @}
+*/
+
+
+/** @defgroup USB_FIFO_DMA_Private_Functions
+* @{
+*/
+
+/**
+* @brief  USB_OTG_FifoDMA_Init
+*         Configure the memory to memory stream used for the FIFO accesses
+* @param  pdev : Selected device
+* @retval None
+*/
+void USB_OTG_FifoDMA_Init(USB_OTG_CORE_HANDLE *pdev)
+{
+  DMA_InitTypeDef  DMA_InitStructure;
+
+  RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+
+  DMA_DeInit(USB_OTG_FS_DMA_STREAM);
+  DMA_StructInit(&DMA_InitStructure);
+
+  /* Word transfers; the addresses are programmed for each packet */
+  DMA_InitStructure.DMA_Channel = USB_OTG_FS_DMA_CHANNEL;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToMemory;
+  DMA_InitStructure.DMA_BufferSize = 1;
+  DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  /* Direct mode is not allowed for memory to memory transfers */
+  DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Enable;
+  DMA_InitStructure.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+  DMA_InitStructure.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+  DMA_InitStructure.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+  DMA_Init(USB_OTG_FS_DMA_STREAM, &DMA_InitStructure);
+
+  DMA_ITConfig(USB_OTG_FS_DMA_STREAM, DMA_IT_TC | DMA_IT_TE, ENABLE);
+
+  FifoDMA_State = USB_OTG_FIFO_DMA_IDLE;
+}
+
+/**
+* @brief  USB_OTG_FifoDMA_Busy
+*         Check if a FIFO transfer is in progress
+* @param  None
+* @retval 1 when the stream is busy
+*/
+uint8_t USB_OTG_FifoDMA_Busy(void)
+{
+  return (FifoDMA_State != USB_OTG_FIFO_DMA_IDLE);
+}
+
+/**
+* @brief  USB_OTG_FifoDMA_Read
+*         Start draining a packet from the Rx FIFO. The Rx status queue level
+*         interrupt must be masked by the caller and is re-enabled when the
+*         transfer completes.
+* @param  pdev : Selected device
+* @param  dest : Destination buffer (4-bytes aligned)
+* @param  len : No. of bytes
+* @retval USB_OTG_OK when the DMA took the packet, USB_OTG_FAIL when the
+*         caller has to copy it
+*/
+USB_OTG_STS USB_OTG_FifoDMA_Read(USB_OTG_CORE_HANDLE *pdev,
+                                 uint8_t *dest,
+                                 uint16_t len)
+{
+  if ((pdev->cfg.coreID != USB_OTG_FS_CORE_ID) ||
+      (FifoDMA_State != USB_OTG_FIFO_DMA_IDLE) ||
+      (len < USB_OTG_FS_DMA_MIN_LEN) ||
+      (((uint32_t)dest & 0x3) != 0))
+  {
+    return USB_OTG_FAIL;
+  }
+
+  FifoDMA_State = USB_OTG_FIFO_DMA_RX;
+  USB_OTG_FifoDMA_Start((uint32_t)pdev->regs.DFIFO[0],
+                        (uint32_t)dest,
+                        (len + 3) / 4);
+  return USB_OTG_OK;
+}
+
+/**
+* @brief  USB_OTG_FifoDMA_Write
+*         Start pushing a packet into the Tx FIFO of an IN endpoint. The Tx
+*         FIFO empty interrupt of the endpoint is masked until the transfer
+*         completes.
+* @param  pdev : Selected device
+* @param  src : Source buffer (4-bytes aligned)
+* @param  ep_num : end point number
+* @param  len : No. of bytes
+* @retval USB_OTG_OK when the DMA took the packet, USB_OTG_FAIL when the
+*         caller has to copy it
+*/
+USB_OTG_STS USB_OTG_FifoDMA_Write(USB_OTG_CORE_HANDLE *pdev,
+                                  uint8_t *src,
+                                  uint8_t ep_num,
+                                  uint16_t len)
+{
+  uint32_t fifoemptymsk;
+
+  if ((pdev->cfg.coreID != USB_OTG_FS_CORE_ID) ||
+      (FifoDMA_State != USB_OTG_FIFO_DMA_IDLE) ||
+      (len < USB_OTG_FS_DMA_MIN_LEN) ||
+      (((uint32_t)src & 0x3) != 0))
+  {
+    return USB_OTG_FAIL;
+  }
+
+  FifoDMA_State = USB_OTG_FIFO_DMA_TX;
+  FifoDMA_EpNum = ep_num;
+
+  /* No more Tx FIFO empty interrupt for this EP until the packet is in */
+  fifoemptymsk = 0x1 << ep_num;
+  USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DIEPEMPMSK, fifoemptymsk, 0);
+
+  USB_OTG_FifoDMA_Start((uint32_t)src,
+                        (uint32_t)pdev->regs.DFIFO[ep_num],
+                        (len + 3) / 4);
+  return USB_OTG_OK;
+}
+
+/**
+* @brief  USB_OTG_FifoDMA_IRQHandler
+*         Handle the end of a FIFO transfer
+* @param  pdev : Selected device
+* @retval status
+*/
+uint32_t USB_OTG_FifoDMA_IRQHandler(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_GINTMSK_TypeDef  int_mask;
+  uint8_t state = FifoDMA_State;
+
+  if ((DMA_GetITStatus(USB_OTG_FS_DMA_STREAM, USB_OTG_FS_DMA_IT_TC) == RESET) &&
+      (DMA_GetITStatus(USB_OTG_FS_DMA_STREAM, USB_OTG_FS_DMA_IT_TE) == RESET))
+  {
+    return 0;
+  }
+
+  /* A transfer error leaves a corrupted packet, but the interrupt sources
+     are released anyway so that the core keeps running */
+  DMA_ClearITPendingBit(USB_OTG_FS_DMA_STREAM,
+                        USB_OTG_FS_DMA_IT_TC | USB_OTG_FS_DMA_IT_TE);
+
+  FifoDMA_State = USB_OTG_FIFO_DMA_IDLE;
+
+  if (state == USB_OTG_FIFO_DMA_RX)
+  {
+    /* Enable the Rx Status Queue Level interrupt */
+    int_mask.d32 = 0;
+    int_mask.b.rxstsqlvl = 1;
+    USB_OTG_MODIFY_REG32( &pdev->regs.GREGS->GINTMSK, 0, int_mask.d32);
+  }
+  else if (state == USB_OTG_FIFO_DMA_TX)
+  {
+    /* Let the Tx FIFO empty interrupt load the next packet */
+    USB_OTG_MODIFY_REG32(&pdev->regs.DREGS->DIEPEMPMSK, 0, 0x1 << FifoDMA_EpNum);
+  }
+  return 1;
+}
+
+/**
+* @brief  USB_OTG_FifoDMA_Start
+*         Program the addresses and the size of the transfer, then enable
+*         the stream
+* @param  src : source address
+* @param  dst : destination address
+* @param  count32b : No. of words
+* @retval None
+*/
+static void USB_OTG_FifoDMA_Start(uint32_t src, uint32_t dst, uint32_t count32b)
+{
+  DMA_Cmd(USB_OTG_FS_DMA_STREAM, DISABLE);
+  while (DMA_GetCmdStatus(USB_OTG_FS_DMA_STREAM) != DISABLE)
+  {
+  }
+
+  USB_OTG_FS_DMA_STREAM->PAR = src;
+  DMA_MemoryTargetConfig(USB_OTG_FS_DMA_STREAM, dst, DMA_Memory_0);
+  DMA_SetCurrDataCounter(USB_OTG_FS_DMA_STREAM, (uint16_t)count32b);
+
+  DMA_Cmd(USB_OTG_FS_DMA_STREAM, ENABLE);
+}
+
+/**
+* @}
+*/
+
+#endif /* USB_OTG_FS_DMA_FIFO_ENABLED */
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -30,6 +30,7 @@
 #include "usb_hcd.h"
 #include "usb_conf.h"
 #include "usb_bsp.h"
+#include "usb_stats.h"
 
 
 /** @addtogroup USB_OTG_DRIVER
@@ -62,6 +63,11 @@
 /** @defgroup USB_HCD_Private_Macros
   * @{
   */ 
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+/* The frame 'next' is now or already past (half of the frame number range) */
+#define HCD_SCHED_IS_DUE(next, frame) \
+  ((((frame) - (next)) & HCD_SCHED_FRAME_MSK) < ((HCD_SCHED_FRAME_MSK + 1) / 2))
+#endif
 /**
   * @}
   */ 
@@ -78,6 +84,12 @@
 /** @defgroup USB_HCD_Private_FunctionPrototypes
   * @{
   */ 
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+static uint16_t HCD_Sched_Cost  (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num);
+static void     HCD_Sched_Start (USB_OTG_CORE_HANDLE *pdev,
+                                 uint8_t hc_num,
+                                 uint16_t frame);
+#endif
 /**
   * @}
   */ 
@@ -107,6 +119,15 @@ uint32_t HCD_Init(USB_OTG_CORE_HANDLE *pdev ,
   pdev->host.HC_Status[i]   = HC_IDLE;
   }
   pdev->host.hc[0].max_packet  = 8; 
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+  HCD_Sched_Reset(pdev);
+#endif
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+  HCD_IsocStream_Reset(pdev);
+#endif
+#ifdef USB_OTG_STATS_ENABLED
+  USB_OTG_Stats_Init(pdev);
+#endif
 
   USB_OTG_SelectCore(pdev, coreID);
 #ifndef DUAL_ROLE_MODE_ENABLED
@@ -240,12 +261,358 @@ uint32_t HCD_HC_Init (USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num)
   */
 uint32_t HCD_SubmitRequest (USB_OTG_CORE_HANDLE *pdev , uint8_t hc_num) 
 {
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+  USB_OTG_HC_SCHED *sched = &pdev->host.sched[hc_num];
+  uint32_t primask;
+  uint16_t frame;
+#endif
   
   pdev->host.URB_State[hc_num] =   URB_IDLE;  
   pdev->host.hc[hc_num].xfer_count = 0 ;
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+  /* Control transfers (enumeration) are never delayed */
+  if (pdev->host.hc[hc_num].ep_type != EP_TYPE_CTRL)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    
+    frame = HCD_GetCurrentFrame(pdev) & HCD_SCHED_FRAME_MSK;
+    sched->submit_frame = frame;
+    sched->pending = 1;
+    
+    /* Start at once when the channel is due, or when the current frame still
+       has room; otherwise it is started from the SOF interrupt */
+    if (sched->interval != 0)
+    {
+      if (HCD_SCHED_IS_DUE(sched->next_frame, frame))
+      {
+        HCD_Sched_Start(pdev, hc_num, frame);
+      }
+    }
+    else if (pdev->host.frame_left >= HCD_Sched_Cost(pdev, hc_num))
+    {
+      HCD_Sched_Start(pdev, hc_num, frame);
+    }
+    
+    __set_PRIMASK(primask);
+    return USB_OTG_OK;
+  }
+#endif
   return USB_OTG_HC_StartXfer(pdev, hc_num);
 }
 
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+/**
+  * @brief  HCD_Sched_Reset 
+  *         Drop all the reservations and the pending transfers
+  * @param  pdev: Selected device
+  * @retval None
+  */
+void HCD_Sched_Reset (USB_OTG_CORE_HANDLE *pdev)
+{
+  uint8_t i;
+  
+  for (i = 0; i < USB_OTG_MAX_TX_FIFOS; i++)
+  {
+    pdev->host.sched[i].interval = 0;
+    pdev->host.sched[i].budget = 0;
+    pdev->host.sched[i].pending = 0;
+    pdev->host.sched[i].lat_max = 0;
+    pdev->host.sched[i].lat_sum = 0;
+    pdev->host.sched[i].xfer_num = 0;
+  }
+  pdev->host.periodic_budget = 0;
+  pdev->host.frame_left = 0;
+  pdev->host.sched_next = 0;
+}
+
+/**
+  * @brief  HCD_Sched_Reserve 
+  *         Reserve bus time for an interrupt or isochronous channel, one max
+  *         packet every interval frames. The channel is then started in its
+  *         frames, ahead of the bulk transfers.
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number 
+  * @param  interval: polling interval, in frames (or microframes at HS)
+  * @retval status: USB_OTG_FAIL when the periodic bus time is exhausted
+  */
+uint32_t HCD_Sched_Reserve (USB_OTG_CORE_HANDLE *pdev,
+                            uint8_t hc_num,
+                            uint16_t interval)
+{
+  USB_OTG_HC_SCHED *sched = &pdev->host.sched[hc_num];
+  uint16_t cost, limit;
+  
+  HCD_Sched_Release(pdev, hc_num);
+  
+  limit = (HCD_GetCurrentSpeed(pdev) == HPRT0_PRTSPD_HIGH_SPEED) ?
+    HCD_SCHED_HS_PERIODIC_BYTES : HCD_SCHED_FS_PERIODIC_BYTES;
+  cost = HCD_Sched_Cost(pdev, hc_num);
+#ifdef USB_OTG_HS_HIGH_BW_ENABLED
+  cost *= pdev->host.hc[hc_num].multi;
+#endif
+  
+  /* Worst case: all the periodic channels due in the same frame */
+  if ((pdev->host.periodic_budget + cost) > limit)
+  {
+    return USB_OTG_FAIL;
+  }
+  
+  pdev->host.periodic_budget += cost;
+  sched->budget = cost;
+  sched->interval = (interval != 0) ? interval : 1;
+  sched->next_frame = HCD_GetCurrentFrame(pdev) & HCD_SCHED_FRAME_MSK;
+  return USB_OTG_OK;
+}
+
+/**
+  * @brief  HCD_Sched_Release 
+  *         Give the bus time of a periodic channel back
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number 
+  * @retval None
+  */
+void HCD_Sched_Release (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+  USB_OTG_HC_SCHED *sched = &pdev->host.sched[hc_num];
+  
+  pdev->host.periodic_budget -= sched->budget;
+  sched->budget = 0;
+  sched->interval = 0;
+  sched->pending = 0;
+}
+
+/**
+  * @brief  HCD_Sched_SOF 
+  *         Plan the new frame: start the periodic channels that are due, then
+  *         the pending bulk (and unreserved interrupt) transfers, in turn,
+  *         while the frame has room. Called from the SOF interrupt.
+  * @param  pdev: Selected device
+  * @retval None
+  */
+void HCD_Sched_SOF (USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_HC_SCHED *sched;
+  uint16_t frame;
+  uint8_t i, hc_num;
+  
+  frame = HCD_GetCurrentFrame(pdev) & HCD_SCHED_FRAME_MSK;
+  pdev->host.frame_left = 
+    (HCD_GetCurrentSpeed(pdev) == HPRT0_PRTSPD_HIGH_SPEED) ?
+      HCD_SCHED_HS_FRAME_BYTES : HCD_SCHED_FS_FRAME_BYTES;
+  
+  /* Periodic channels: their reserved time is kept out of the frame even
+     when they have nothing to send */
+  for (i = 0; i < USB_OTG_MAX_TX_FIFOS; i++)
+  {
+    sched = &pdev->host.sched[i];
+    /* A frame missed because of the interrupt latency is served now */
+    if ((sched->interval != 0) && HCD_SCHED_IS_DUE(sched->next_frame, frame))
+    {
+      pdev->host.frame_left -= sched->budget;
+      if (sched->pending)
+      {
+        HCD_Sched_Start(pdev, i, frame);
+      }
+      else
+      {
+        sched->next_frame = (frame + sched->interval) & HCD_SCHED_FRAME_MSK;
+      }
+    }
+  }
+  
+  /* Non periodic transfers, round robin from the last channel served */
+  for (i = 0; i < USB_OTG_MAX_TX_FIFOS; i++)
+  {
+    hc_num = (pdev->host.sched_next + i) % USB_OTG_MAX_TX_FIFOS;
+    sched = &pdev->host.sched[hc_num];
+    if ((sched->interval == 0) && sched->pending)
+    {
+      if (pdev->host.frame_left < HCD_Sched_Cost(pdev, hc_num))
+      {
+        pdev->host.sched_next = hc_num;
+        break;
+      }
+      HCD_Sched_Start(pdev, hc_num, frame);
+    }
+  }
+}
+
+/**
+  * @brief  HCD_Sched_GetLatency 
+  *         Submit to start latency of a channel, in frames
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number 
+  * @param  lat_max: worst latency
+  * @param  lat_avg: average latency
+  * @retval None
+  */
+void HCD_Sched_GetLatency (USB_OTG_CORE_HANDLE *pdev,
+                           uint8_t hc_num,
+                           uint16_t *lat_max,
+                           uint16_t *lat_avg)
+{
+  USB_OTG_HC_SCHED *sched = &pdev->host.sched[hc_num];
+  
+  *lat_max = sched->lat_max;
+  *lat_avg = (sched->xfer_num != 0) ? 
+    (uint16_t)(sched->lat_sum / sched->xfer_num) : 0;
+}
+
+/**
+  * @brief  HCD_Sched_Cost 
+  *         Bus time of one packet of a channel (bit stuffing and protocol
+  *         overhead included), in full/high speed bytes
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number 
+  * @retval cost
+  */
+static uint16_t HCD_Sched_Cost (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+  uint16_t cost;
+  
+  cost = ((pdev->host.hc[hc_num].max_packet * 7) / 6) + 13;
+  if (pdev->host.hc[hc_num].speed == HPRT0_PRTSPD_LOW_SPEED)
+  {
+    /* Low speed packets take 8 times longer on a full speed bus */
+    cost *= 8;
+  }
+  return cost;
+}
+
+/**
+  * @brief  HCD_Sched_Start 
+  *         Start a pending transfer and update the latency statistics
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number 
+  * @param  frame: current frame number
+  * @retval None
+  */
+static void HCD_Sched_Start (USB_OTG_CORE_HANDLE *pdev,
+                             uint8_t hc_num,
+                             uint16_t frame)
+{
+  USB_OTG_HC_SCHED *sched = &pdev->host.sched[hc_num];
+  uint16_t latency;
+  uint32_t cost;
+  
+  sched->pending = 0;
+  
+  latency = (frame - sched->submit_frame) & HCD_SCHED_FRAME_MSK;
+  if (latency > sched->lat_max)
+  {
+    sched->lat_max = latency;
+  }
+  sched->lat_sum += latency;
+  sched->xfer_num++;
+  
+  if (sched->interval != 0)
+  {
+    sched->next_frame = (frame + sched->interval) & HCD_SCHED_FRAME_MSK;
+  }
+  else
+  {
+    /* A long bulk transfer only takes what is left of this frame */
+    cost = ((pdev->host.hc[hc_num].xfer_len + pdev->host.hc[hc_num].max_packet - 1) /
+            pdev->host.hc[hc_num].max_packet) * HCD_Sched_Cost(pdev, hc_num);
+    pdev->host.frame_left -= (cost < pdev->host.frame_left) ? cost : pdev->host.frame_left;
+  }
+  
+  USB_OTG_HC_StartXfer(pdev, hc_num);
+}
+#endif
+
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+/**
+  * @brief  HCD_IsocStream_Start 
+  *         Start an isochronous stream on an open ISOC channel. The channel
+  *         is re-armed on the other buffer at each frame from the interrupt,
+  *         BufferDone handing back the buffer just completed; the app has
+  *         one frame to consume (IN) or refill (OUT) it
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number 
+  * @param  buff0: first buffer
+  * @param  buff1: second buffer
+  * @param  length: bytes per buffer, at most the packets of one frame
+  * @param  BufferDone: completion callback, called from the interrupt
+  * @retval status
+  */
+uint32_t HCD_IsocStream_Start (USB_OTG_CORE_HANDLE *pdev,
+                               uint8_t hc_num,
+                               uint8_t *buff0,
+                               uint8_t *buff1,
+                               uint32_t length,
+                               void (*BufferDone) (void *pdev,
+                                                   uint8_t hc_num,
+                                                   uint8_t *buff,
+                                                   uint32_t count))
+{
+  USB_OTG_HC_ISOC *isoc = &pdev->host.isoc[hc_num];
+  
+  if ((pdev->host.hc[hc_num].ep_type != EP_TYPE_ISOC) || (BufferDone == 0))
+  {
+    return USB_OTG_FAIL;
+  }
+#ifdef USB_OTG_SPLIT_ENABLED
+  if (pdev->host.hc[hc_num].do_split)
+  {
+    /* Isochronous splits are not scheduled */
+    return USB_OTG_FAIL;
+  }
+#endif
+  
+  isoc->buff[0] = buff0;
+  isoc->buff[1] = buff1;
+  isoc->length = length;
+  isoc->missed = 0;
+  isoc->BufferDone = BufferDone;
+  isoc->idx = 0;
+  
+  pdev->host.hc[hc_num].xfer_buff = buff0;
+  pdev->host.hc[hc_num].xfer_len = length;
+  pdev->host.hc[hc_num].xfer_count = 0;
+  pdev->host.hc[hc_num].data_pid = HC_PID_DATA0;
+  pdev->host.URB_State[hc_num] = URB_IDLE;
+  pdev->host.HC_Status[hc_num] = HC_IDLE;
+  isoc->active = 1;
+  
+  /* Not left to the scheduler: the stream runs every frame */
+  return USB_OTG_HC_StartXfer(pdev, hc_num);
+}
+
+/**
+  * @brief  HCD_IsocStream_Stop 
+  *         Stop an isochronous stream, the buffers are released on return
+  * @param  pdev: Selected device
+  * @param  hc_num: Channel number 
+  * @retval None
+  */
+void HCD_IsocStream_Stop (USB_OTG_CORE_HANDLE *pdev, uint8_t hc_num)
+{
+  if (pdev->host.isoc[hc_num].active)
+  {
+    pdev->host.isoc[hc_num].active = 0;
+    USB_OTG_HC_Halt(pdev, hc_num);
+  }
+}
+
+/**
+  * @brief  HCD_IsocStream_Reset 
+  *         Drop all the streams (device disconnected)
+  * @param  pdev: Selected device
+  * @retval None
+  */
+void HCD_IsocStream_Reset (USB_OTG_CORE_HANDLE *pdev)
+{
+  uint8_t i;
+  
+  for (i = 0; i < USB_OTG_MAX_TX_FIFOS; i++)
+  {
+    pdev->host.isoc[i].active = 0;
+  }
+}
+#endif
+
 
 /**
 * @}
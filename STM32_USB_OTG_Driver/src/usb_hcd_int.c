@@ -29,6 +29,8 @@
 #include "usb_core.h"
 #include "usb_defines.h"
 #include "usb_hcd_int.h"
+#include "usb_event.h"
+#include "usb_stats.h"
 
 #if defined   (__CC_ARM) /*!< ARM Compiler */
 #pragma O0
@@ -98,6 +100,19 @@ static uint32_t USB_OTG_USBH_handle_nptxfempty_ISR (USB_OTG_CORE_HANDLE *pdev);
 static uint32_t USB_OTG_USBH_handle_ptxfempty_ISR (USB_OTG_CORE_HANDLE *pdev);
 static uint32_t USB_OTG_USBH_handle_Disconnect_ISR (USB_OTG_CORE_HANDLE *pdev);
 static uint32_t USB_OTG_USBH_handle_IncompletePeriodicXfer_ISR (USB_OTG_CORE_HANDLE *pdev);
+#ifdef USB_OTG_STATS_ENABLED
+static void USB_OTG_USBH_Stats_Xfer (USB_OTG_CORE_HANDLE *pdev,
+                                     uint32_t num,
+                                     uint32_t len);
+#endif
+#ifdef USB_OTG_SPLIT_ENABLED
+static uint8_t USB_OTG_USBH_SplitNext (USB_OTG_CORE_HANDLE *pdev,
+                                       uint32_t num);
+#endif
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+static void USB_OTG_USBH_IsocNext (USB_OTG_CORE_HANDLE *pdev,
+                                   uint32_t num);
+#endif
 
 /**
 * @}
@@ -130,6 +145,8 @@ uint32_t USBH_OTG_ISR_Handler (USB_OTG_CORE_HANDLE *pdev)
     {
       return 0;
     }
+    TRACE_ISR_ENTER();
+    USB_OTG_STATS_ISR_ENTER(pdev);
     
     if (gintsts.b.sofintr)
     {
@@ -172,11 +189,144 @@ uint32_t USBH_OTG_ISR_Handler (USB_OTG_CORE_HANDLE *pdev)
       retval |= USB_OTG_USBH_handle_IncompletePeriodicXfer_ISR (pdev);
     }
     
-    
+    USB_OTG_STATS_ISR_EXIT(pdev);
+    TRACE_ISR_EXIT();
   }
   return retval;
 }
 
+#ifdef USB_OTG_STATS_ENABLED
+/**
+* @brief  USB_OTG_USBH_Stats_Xfer 
+*         Account the data moved through the FIFO of a channel
+* @param  pdev: Selected device
+* @param  num: Channel number
+* @param  len: No. of bytes
+* @retval None
+*/
+static void USB_OTG_USBH_Stats_Xfer (USB_OTG_CORE_HANDLE *pdev,
+                                     uint32_t num,
+                                     uint32_t len)
+{
+  uint32_t mps = pdev->host.hc[num].max_packet;
+  
+  pdev->host.hc_stats[num].bytes += len;
+  if ((len == 0) || (mps == 0))
+  {
+    pdev->host.hc_stats[num].packets++;
+  }
+  else
+  {
+    pdev->host.hc_stats[num].packets += (len + mps - 1) / mps;
+  }
+}
+#endif
+
+#ifdef USB_OTG_SPLIT_ENABLED
+/**
+* @brief  USB_OTG_USBH_SplitNext 
+*         Account the packet moved by a finished CSPLIT and step to the
+*         next one
+* @param  pdev: Selected device
+* @param  num: Channel number
+* @retval 1 if more packets are left in the transfer
+*/
+static uint8_t USB_OTG_USBH_SplitNext (USB_OTG_CORE_HANDLE *pdev,
+                                       uint32_t num)
+{
+  USB_OTG_HCTSIZn_TypeDef  hctsiz;
+  USB_OTG_HC               *hc = &pdev->host.hc[num];
+  uint32_t                 len;
+  
+  hctsiz.d32 = USB_OTG_READ_REG32(&pdev->regs.HC_REGS[num]->HCTSIZ);
+  
+  if (hc->ep_is_in)
+  {
+    if (pdev->cfg.dma_enable == 1)
+    {
+      len = hc->max_packet - hctsiz.b.xfersize;
+      hc->xfer_buff += len;
+    }
+    else
+    {
+      /* The Rx FIFO handler has already moved xfer_buff on */
+      len = hc->xfer_count - hc->split_count;
+    }
+    hc->toggle_in = (hctsiz.b.pid == HC_PID_DATA1) ? 1 : 0;
+  }
+  else
+  {
+    len = hc->split_len - hc->split_count;
+    if (len > hc->max_packet)
+    {
+      len = hc->max_packet;
+    }
+    hc->xfer_buff += len;
+    hc->toggle_out = (hctsiz.b.pid == HC_PID_DATA1) ? 1 : 0;
+  }
+  
+  hc->data_pid = hctsiz.b.pid;
+  hc->comp_split = 0;
+  hc->split_count += len;
+  pdev->host.XferCnt[num] = hc->split_count;
+  
+  return ((len == hc->max_packet) && (hc->split_count < hc->split_len)) ? 1 : 0;
+}
+#endif
+
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+/**
+* @brief  USB_OTG_USBH_IsocNext 
+*         Re-arm a halted isochronous stream channel on the other buffer for
+*         the next frame, then hand the completed buffer to the app. A lost
+*         frame re-arms the same buffer
+* @param  pdev: Selected device
+* @param  num: Channel number
+* @retval None
+*/
+static void USB_OTG_USBH_IsocNext (USB_OTG_CORE_HANDLE *pdev,
+                                   uint32_t num)
+{
+  USB_OTG_HC_ISOC  *isoc = &pdev->host.isoc[num];
+  USB_OTG_HC       *hc = &pdev->host.hc[num];
+  uint8_t          *done = 0;
+  uint32_t         count = 0;
+  
+  if (pdev->host.HC_Status[num] == HC_XFRC)
+  {
+    done = isoc->buff[isoc->idx];
+    if (hc->ep_is_in)
+    {
+      count = (pdev->cfg.dma_enable == 1) ? pdev->host.XferCnt[num] : hc->xfer_count;
+    }
+    else
+    {
+      count = isoc->length;
+    }
+    isoc->idx ^= 1;
+  }
+  else
+  {
+    isoc->missed++;
+  }
+  
+  pdev->host.HC_Status[num] = HC_IDLE;
+  pdev->host.ErrCnt[num] = 0;
+  hc->xfer_buff = isoc->buff[isoc->idx];
+  hc->xfer_len = isoc->length;
+  hc->xfer_count = 0;
+  hc->data_pid = HC_PID_DATA0;
+  /* odd/even frame set from the current frame: the packet goes out in the
+     next one */
+  USB_OTG_HC_StartXfer(pdev, num);
+  
+  if (done != 0)
+  {
+    isoc->BufferDone(pdev, num, done, count);
+  }
+}
+#endif
+
 /**
 * @brief  USB_OTG_USBH_handle_hc_ISR 
 *         This function indicates that one or more host channels has a pending
@@ -189,6 +339,9 @@ static uint32_t USB_OTG_USBH_handle_hc_ISR (USB_OTG_CORE_HANDLE *pdev)
   USB_OTG_HCCHAR_TypeDef       hcchar;
   uint32_t i = 0;
   uint32_t retval = 0;
+#if defined (USB_OTG_EVENT_QUEUE_ENABLED) || defined (USB_OTG_URB_NOTIFY_ENABLED)
+  URB_STATE urb;
+#endif
   
   /* Clear appropriate bits in HCINTn to clear the interrupt bit in
   * GINTSTS */
@@ -200,6 +353,9 @@ static uint32_t USB_OTG_USBH_handle_hc_ISR (USB_OTG_CORE_HANDLE *pdev)
     if (haint.b.chint & (1 << i))
     {
       hcchar.d32 = USB_OTG_READ_REG32(&pdev->regs.HC_REGS[i]->HCCHAR);
+#if defined (USB_OTG_EVENT_QUEUE_ENABLED) || defined (USB_OTG_URB_NOTIFY_ENABLED)
+      urb = pdev->host.URB_State[i];
+#endif
       
       if (hcchar.b.epdir)
       {
@@ -209,6 +365,19 @@ static uint32_t USB_OTG_USBH_handle_hc_ISR (USB_OTG_CORE_HANDLE *pdev)
       {
         retval |=  USB_OTG_USBH_handle_hc_n_Out_ISR (pdev, i);
       }
+#ifdef USB_OTG_EVENT_QUEUE_ENABLED
+      if (pdev->host.URB_State[i] != urb)
+      {
+        USB_OTG_EventPush(pdev, USB_OTG_EVT_URB, i, pdev->host.URB_State[i]);
+      }
+#endif
+#ifdef USB_OTG_URB_NOTIFY_ENABLED
+      if (pdev->host.URB_State[i] != urb)
+      {
+        TRACE_USB(TRACE_EV_USB_URB, i);
+        USBH_HCD_INT_fops->URBChange(pdev, i);
+      }
+#endif
     }
   }
   
@@ -226,6 +395,10 @@ static uint32_t USB_OTG_USBH_handle_sof_ISR (USB_OTG_CORE_HANDLE *pdev)
   USB_OTG_GINTSTS_TypeDef      gintsts;
   gintsts.d32 = 0;
   
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+  HCD_Sched_SOF(pdev);
+#endif
+  TRACE_USB(TRACE_EV_USB_SOF, 0);
   USBH_HCD_INT_fops->SOF(pdev);
   
   /* Clear interrupt */
@@ -247,6 +420,13 @@ static uint32_t USB_OTG_USBH_handle_Disconnect_ISR (USB_OTG_CORE_HANDLE *pdev)
   
   gintsts.d32 = 0;
   
+#ifdef USB_OTG_HCD_SCHED_ENABLED
+  HCD_Sched_Reset(pdev);
+#endif
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+  HCD_IsocStream_Reset(pdev);
+#endif
+  TRACE_USB(TRACE_EV_USB_DISCONNECT, 0);
   USBH_HCD_INT_fops->DevDisconnected(pdev);
   
   /* Clear interrupt */
@@ -293,6 +473,9 @@ static uint32_t USB_OTG_USBH_handle_nptxfempty_ISR (USB_OTG_CORE_HANDLE *pdev)
     len_words = (pdev->host.hc[hnptxsts.b.nptxqtop.chnum].xfer_len + 3) / 4;
     
     USB_OTG_WritePacket (pdev , pdev->host.hc[hnptxsts.b.nptxqtop.chnum].xfer_buff, hnptxsts.b.nptxqtop.chnum, len);
+#ifdef USB_OTG_STATS_ENABLED
+    USB_OTG_USBH_Stats_Xfer(pdev, hnptxsts.b.nptxqtop.chnum, len);
+#endif
     
     pdev->host.hc[hnptxsts.b.nptxqtop.chnum].xfer_buff  += len;
     pdev->host.hc[hnptxsts.b.nptxqtop.chnum].xfer_len   -= len;
@@ -301,6 +484,13 @@ static uint32_t USB_OTG_USBH_handle_nptxfempty_ISR (USB_OTG_CORE_HANDLE *pdev)
     hnptxsts.d32 = USB_OTG_READ_REG32(&pdev->regs.GREGS->HNPTXSTS);
   }  
   
+#ifdef USB_OTG_STATS_ENABLED
+  if (pdev->host.hc[hnptxsts.b.nptxqtop.chnum].xfer_len != 0)
+  {
+    /* Not enough room: wait for the next Tx FIFO empty interrupt */
+    pdev->host.hc_stats[hnptxsts.b.nptxqtop.chnum].txfifo_wait++;
+  }
+#endif
   return 1;
 }
 #if defined ( __ICCARM__ ) /*!< IAR Compiler */
@@ -340,6 +530,9 @@ static uint32_t USB_OTG_USBH_handle_ptxfempty_ISR (USB_OTG_CORE_HANDLE *pdev)
     len_words = (pdev->host.hc[hptxsts.b.ptxqtop.chnum].xfer_len + 3) / 4;
     
     USB_OTG_WritePacket (pdev , pdev->host.hc[hptxsts.b.ptxqtop.chnum].xfer_buff, hptxsts.b.ptxqtop.chnum, len);
+#ifdef USB_OTG_STATS_ENABLED
+    USB_OTG_USBH_Stats_Xfer(pdev, hptxsts.b.ptxqtop.chnum, len);
+#endif
     
     pdev->host.hc[hptxsts.b.ptxqtop.chnum].xfer_buff  += len;
     pdev->host.hc[hptxsts.b.ptxqtop.chnum].xfer_len   -= len;
@@ -348,6 +541,13 @@ static uint32_t USB_OTG_USBH_handle_ptxfempty_ISR (USB_OTG_CORE_HANDLE *pdev)
     hptxsts.d32 = USB_OTG_READ_REG32(&pdev->regs.HREGS->HPTXSTS);
   }  
   
+#ifdef USB_OTG_STATS_ENABLED
+  if (pdev->host.hc[hptxsts.b.ptxqtop.chnum].xfer_len != 0)
+  {
+    /* Not enough room: wait for the next Tx FIFO empty interrupt */
+    pdev->host.hc_stats[hptxsts.b.ptxqtop.chnum].txfifo_wait++;
+  }
+#endif
   return 1;
 }
 
@@ -387,6 +587,7 @@ static uint32_t USB_OTG_USBH_handle_port_ISR (USB_OTG_CORE_HANDLE *pdev)
   {
 
     hprt0_dup.b.prtconndet = 1;
+    TRACE_USB(TRACE_EV_USB_CONNECT, 0);
     USBH_HCD_INT_fops->DevConnected(pdev);
     retval |= 1;
   }
@@ -399,6 +600,7 @@ static uint32_t USB_OTG_USBH_handle_port_ISR (USB_OTG_CORE_HANDLE *pdev)
     if (hprt0.b.prtena == 1)
     {
       
+      TRACE_USB(TRACE_EV_USB_CONNECT, 0);
       USBH_HCD_INT_fops->DevConnected(pdev);
       
       if ((hprt0.b.prtspd == HPRT0_PRTSPD_LOW_SPEED) ||
@@ -468,6 +670,8 @@ uint32_t USB_OTG_USBH_handle_hc_n_Out_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t
   USB_OTG_HCINTMSK_TypeDef  hcintmsk;
   USB_OTG_HC_REGS *hcreg;
   USB_OTG_HCCHAR_TypeDef     hcchar; 
+  USB_OTG_HCTSIZn_TypeDef    hctsiz;
+  uint32_t                   num_packets;
   
   hcreg = pdev->regs.HC_REGS[num];
   hcint.d32 = USB_OTG_READ_REG32(&hcreg->HCINT);
@@ -484,6 +688,16 @@ uint32_t USB_OTG_USBH_handle_hc_n_Out_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t
   else if (hcint.b.ack)
   {
     CLEAR_HC_INT(hcreg , ack);
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.hc[num].do_split && (pdev->host.hc[num].comp_split == 0))
+    {
+      /* SSPLIT accepted by the hub: the CSPLIT follows */
+      pdev->host.hc[num].comp_split = 1;
+      pdev->host.HC_Status[num] = HC_SPLIT;
+      UNMASK_HOST_INT_CHH (num);
+      USB_OTG_HC_Halt(pdev, num);
+    }
+#endif
   }
   else if (hcint.b.frmovrun)
   {
@@ -498,6 +712,18 @@ uint32_t USB_OTG_USBH_handle_hc_n_Out_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t
     USB_OTG_HC_Halt(pdev, num);
     CLEAR_HC_INT(hcreg , xfercompl);
     pdev->host.HC_Status[num] = HC_XFRC;            
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.hc[num].do_split && USB_OTG_USBH_SplitNext(pdev, num))
+    {
+      pdev->host.HC_Status[num] = HC_SPLIT;
+    }
+#endif
+#ifdef USB_OTG_STATS_ENABLED
+    if (pdev->cfg.dma_enable == 1)
+    {
+      USB_OTG_USBH_Stats_Xfer(pdev, num, pdev->host.hc[num].xfer_len);
+    }
+#endif
   }
   
   else if (hcint.b.stall)
@@ -510,11 +736,20 @@ uint32_t USB_OTG_USBH_handle_hc_n_Out_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t
   
   else if (hcint.b.nak)
   {
+    USB_OTG_STATS_ADD(pdev->host.hc_stats[num], nak, 1);
     pdev->host.ErrCnt[num] = 0;
     UNMASK_HOST_INT_CHH (num);
     USB_OTG_HC_Halt(pdev, num);
     CLEAR_HC_INT(hcreg , nak);
     pdev->host.HC_Status[num] = HC_NAK;      
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.hc[num].do_split && (hcchar.b.eptype != EP_TYPE_INTR))
+    {
+      /* Hub or device busy: start over with the SSPLIT */
+      pdev->host.hc[num].comp_split = 0;
+      pdev->host.HC_Status[num] = HC_SPLIT;
+    }
+#endif
   }
   
   else if (hcint.b.xacterr)
@@ -527,11 +762,19 @@ uint32_t USB_OTG_USBH_handle_hc_n_Out_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t
   }
   else if (hcint.b.nyet)
   {
+    USB_OTG_STATS_ADD(pdev->host.hc_stats[num], nyet, 1);
     pdev->host.ErrCnt[num] = 0;
     UNMASK_HOST_INT_CHH (num);
     USB_OTG_HC_Halt(pdev, num);
     CLEAR_HC_INT(hcreg , nyet);
     pdev->host.HC_Status[num] = HC_NYET;    
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.hc[num].do_split)
+    {
+      /* Hub not done with the transaction: repeat the CSPLIT */
+      pdev->host.HC_Status[num] = HC_SPLIT;
+    }
+#endif
   }
   else if (hcint.b.datatglerr)
   {
@@ -547,15 +790,55 @@ uint32_t USB_OTG_USBH_handle_hc_n_Out_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t
   {
     MASK_HOST_INT_CHH (num);
     
-    if(pdev->host.HC_Status[num] == HC_XFRC)
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.HC_Status[num] == HC_SPLIT)
     {
-      pdev->host.URB_State[num] = URB_DONE;  
+      CLEAR_HC_INT(hcreg , chhltd);
+      USB_OTG_HC_SplitXfer(pdev, num);
+      return 1;
+    }
+#endif
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+    if (pdev->host.isoc[num].active)
+    {
+      CLEAR_HC_INT(hcreg , chhltd);
+      USB_OTG_USBH_IsocNext(pdev, num);
+      return 1;
+    }
+#endif
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.hc[num].do_split)
+    {
+      /* Toggle kept by USB_OTG_USBH_SplitNext */
+      pdev->host.XferCnt[num] = pdev->host.hc[num].split_count;
+    }
+    else
+#endif
+    if (hcchar.b.eptype == EP_TYPE_BULK)
+    {
+      /* The core leaves the next PID in HCTSIZ, which keeps the toggle right
+         for multi-packet URBs; the packets ACKed before a NAK/NYET are
+         reported in XferCnt so that the URB can be resumed after them */
+      hctsiz.d32 = USB_OTG_READ_REG32(&hcreg->HCTSIZ);
+      pdev->host.hc[num].toggle_out = (hctsiz.b.pid == HC_PID_DATA1) ? 1 : 0;
       
-      if (hcchar.b.eptype == EP_TYPE_BULK)
+      num_packets = (pdev->host.hc[num].xfer_len + pdev->host.hc[num].max_packet - 1) /
+        pdev->host.hc[num].max_packet;
+      if (num_packets == 0)
+      {
+        num_packets = 1;
+      }
+      pdev->host.XferCnt[num] = (num_packets - hctsiz.b.pktcnt) * pdev->host.hc[num].max_packet;
+      if (pdev->host.XferCnt[num] > pdev->host.hc[num].xfer_len)
       {
-        pdev->host.hc[num].toggle_out ^= 1; 
+        pdev->host.XferCnt[num] = pdev->host.hc[num].xfer_len;
       }
     }
+    
+    if(pdev->host.HC_Status[num] == HC_XFRC)
+    {
+      pdev->host.URB_State[num] = URB_DONE;  
+    }
     else if(pdev->host.HC_Status[num] == HC_NAK)
     {
       pdev->host.URB_State[num] = URB_NOTREADY;      
@@ -621,6 +904,16 @@ uint32_t USB_OTG_USBH_handle_hc_n_In_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t n
   else if (hcint.b.ack)
   {
     CLEAR_HC_INT(hcreg ,ack);
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.hc[num].do_split && (pdev->host.hc[num].comp_split == 0))
+    {
+      /* SSPLIT accepted by the hub: the CSPLIT follows */
+      pdev->host.hc[num].comp_split = 1;
+      pdev->host.HC_Status[num] = HC_SPLIT;
+      UNMASK_HOST_INT_CHH (num);
+      USB_OTG_HC_Halt(pdev, num);
+    }
+#endif
   }
   
   else if (hcint.b.stall)  
@@ -658,7 +951,25 @@ uint32_t USB_OTG_USBH_handle_hc_n_In_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t n
     {
       hctsiz.d32 = USB_OTG_READ_REG32(&pdev->regs.HC_REGS[num]->HCTSIZ);
       pdev->host.XferCnt[num] =  pdev->host.hc[num].xfer_len - hctsiz.b.xfersize;
+#ifdef USB_OTG_STATS_ENABLED
+      USB_OTG_USBH_Stats_Xfer(pdev, num, pdev->host.XferCnt[num]);
+#endif
+    }
+    
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.hc[num].do_split)
+    {
+      /* One packet per CSPLIT: the URB is done on the halt unless more
+         packets are left */
+      pdev->host.HC_Status[num] = USB_OTG_USBH_SplitNext(pdev, num) ? HC_SPLIT : HC_XFRC;
+      pdev->host.ErrCnt [num]= 0;
+      CLEAR_HC_INT(hcreg , xfercompl);
+      UNMASK_HOST_INT_CHH (num);
+      USB_OTG_HC_Halt(pdev, num);
+      CLEAR_HC_INT(hcreg , nak); 
+      return 1;
     }
+#endif
     
     pdev->host.HC_Status[num] = HC_XFRC;     
     pdev->host.ErrCnt [num]= 0;
@@ -670,8 +981,16 @@ uint32_t USB_OTG_USBH_handle_hc_n_In_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t n
       UNMASK_HOST_INT_CHH (num);
       USB_OTG_HC_Halt(pdev, num);
       CLEAR_HC_INT(hcreg , nak); 
-      pdev->host.hc[num].toggle_in ^= 1;
-      
+      if (hcchar.b.eptype == EP_TYPE_BULK)
+      {
+        /* Next PID left by the core, right for multi-packet URBs too */
+        hctsiz.d32 = USB_OTG_READ_REG32(&pdev->regs.HC_REGS[num]->HCTSIZ);
+        pdev->host.hc[num].toggle_in = (hctsiz.b.pid == HC_PID_DATA1) ? 1 : 0;
+      }
+      else
+      {
+        pdev->host.hc[num].toggle_in ^= 1;
+      }
     }
     else if(hcchar.b.eptype == EP_TYPE_INTR)
     {
@@ -679,12 +998,37 @@ uint32_t USB_OTG_USBH_handle_hc_n_In_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t n
       USB_OTG_WRITE_REG32(&pdev->regs.HC_REGS[num]->HCCHAR, hcchar.d32); 
       pdev->host.URB_State[num] = URB_DONE;  
     }
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+    else if (pdev->host.isoc[num].active)
+    {
+      /* Re-armed on the halt, see USB_OTG_USBH_IsocNext */
+      UNMASK_HOST_INT_CHH (num);
+      USB_OTG_HC_Halt(pdev, num);
+    }
+#endif
     
   }
   else if (hcint.b.chhltd)
   {
     MASK_HOST_INT_CHH (num);
     
+#ifdef USB_OTG_SPLIT_ENABLED
+    if (pdev->host.HC_Status[num] == HC_SPLIT)
+    {
+      CLEAR_HC_INT(hcreg , chhltd);
+      USB_OTG_HC_SplitXfer(pdev, num);
+      return 1;
+    }
+#endif
+#ifdef USB_OTG_HCD_ISOC_STREAM_ENABLED
+    if (pdev->host.isoc[num].active)
+    {
+      CLEAR_HC_INT(hcreg , chhltd);
+      USB_OTG_USBH_IsocNext(pdev, num);
+      return 1;
+    }
+#endif
+    
     if(pdev->host.HC_Status[num] == HC_XFRC)
     {
       pdev->host.URB_State[num] = URB_DONE;      
@@ -719,8 +1063,32 @@ uint32_t USB_OTG_USBH_handle_hc_n_In_ISR (USB_OTG_CORE_HANDLE *pdev , uint32_t n
     CLEAR_HC_INT(hcreg , xacterr);    
     
   }
+#ifdef USB_OTG_SPLIT_ENABLED
+  else if (hcint.b.nyet)
+  {
+    /* Only unmasked for split channels: the hub has no data yet, repeat
+       the CSPLIT */
+    USB_OTG_STATS_ADD(pdev->host.hc_stats[num], nyet, 1);
+    UNMASK_HOST_INT_CHH (num);
+    pdev->host.HC_Status[num] = HC_SPLIT;
+    USB_OTG_HC_Halt(pdev, num);
+    CLEAR_HC_INT(hcreg , nyet);
+  }
+  else if (hcint.b.nak && pdev->host.hc[num].do_split &&
+           (hcchar.b.eptype != EP_TYPE_INTR))
+  {
+    /* Hub or device busy: start over with the SSPLIT */
+    USB_OTG_STATS_ADD(pdev->host.hc_stats[num], nak, 1);
+    pdev->host.hc[num].comp_split = 0;
+    UNMASK_HOST_INT_CHH (num);
+    pdev->host.HC_Status[num] = HC_SPLIT;
+    USB_OTG_HC_Halt(pdev, num);
+    CLEAR_HC_INT(hcreg , nak);
+  }
+#endif
   else if (hcint.b.nak)  
   {  
+    USB_OTG_STATS_ADD(pdev->host.hc_stats[num], nak, 1);
     if(hcchar.b.eptype == EP_TYPE_INTR)
     {
       UNMASK_HOST_INT_CHH (num);
@@ -778,6 +1146,8 @@ static uint32_t USB_OTG_USBH_handle_rx_qlvl_ISR (USB_OTG_CORE_HANDLE *pdev)
     {  
       
       USB_OTG_ReadPacket(pdev, pdev->host.hc[channelnum].xfer_buff, grxsts.b.bcnt);
+      USB_OTG_STATS_ADD(pdev->host.hc_stats[channelnum], bytes, grxsts.b.bcnt);
+      USB_OTG_STATS_ADD(pdev->host.hc_stats[channelnum], packets, 1);
       /*manage multiple Xfer */
       pdev->host.hc[grxsts.b.chnum].xfer_buff += grxsts.b.bcnt;           
       pdev->host.hc[grxsts.b.chnum].xfer_count  += grxsts.b.bcnt;
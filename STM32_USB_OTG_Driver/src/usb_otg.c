@@ -30,6 +30,11 @@
 #include "usb_regs.h"
 #include "usb_core.h"
 #include "usb_otg.h"
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+#include "usb_bsp.h"
+#include "usb_dcd_int.h"
+#include "usb_hcd_int.h"
+#endif
 
 /** @addtogroup USB_OTG_DRIVER
   * @{
@@ -44,6 +49,10 @@
 /** @defgroup USB_OTG_Private_Defines
   * @{
   */ 
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+/* Polls of GINTSTS for the mode change after a connector ID change */
+ #define USB_OTG_SWITCH_TIMEOUT        100000
+#endif
 /**
   * @}
   */ 
@@ -78,7 +87,7 @@
   * @{
   */ 
 
-uint32_t USB_OTG_HandleOTG_ISR(USB_OTG_CORE_HANDLE *pdev);
+static uint32_t USB_OTG_HandleOTG_ISR(USB_OTG_CORE_HANDLE *pdev);
 
 static uint32_t USB_OTG_HandleConnectorIDStatusChange_ISR(USB_OTG_CORE_HANDLE *pdev);
 static uint32_t USB_OTG_HandleSessionRequest_ISR(USB_OTG_CORE_HANDLE *pdev);
@@ -276,6 +285,9 @@ static uint32_t USB_OTG_HandleConnectorIDStatusChange_ISR(USB_OTG_CORE_HANDLE *p
   USB_OTG_MODIFY_REG32(&pdev->regs.GREGS->GINTMSK, gintmsk.d32, 0);
   gotgctl.d32 = USB_OTG_READ_REG32(&pdev->regs.GREGS->GOTGCTL);
   
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+  USB_OTG_SwitchRole(pdev, gotgctl.b.conidsts ? DEVICE_MODE : HOST_MODE);
+#else
   /* B-Device connector (Device Mode) */
   if (gotgctl.b.conidsts)
   {
@@ -291,6 +303,7 @@ static uint32_t USB_OTG_HandleConnectorIDStatusChange_ISR(USB_OTG_CORE_HANDLE *p
     USB_OTG_EnableGlobalInt(pdev);
     pdev->otg.OTG_State = A_HOST;
   }
+#endif
   /* Set flag and clear interrupt */
   gintsts.b.conidstschng = 1;
   USB_OTG_WRITE_REG32 (&pdev->regs.GREGS->GINTSTS, gintsts.d32);
@@ -298,6 +311,80 @@ static uint32_t USB_OTG_HandleConnectorIDStatusChange_ISR(USB_OTG_CORE_HANDLE *p
 }
 
 
+#ifdef USB_OTG_DUAL_ROLE_ENABLED
+/**
+  * @brief  USB_OTG_SwitchRole
+  *         Moves the core to the device or host role without a core reset:
+  *         the role being left is stopped (the device class parked, the host
+  *         told of the disconnection), then only the registers and FIFOs of
+  *         the new mode are programmed. The device and host contexts stay
+  *         allocated. No millisecond delay is spent on the way.
+  * @param  mode : DEVICE_MODE or HOST_MODE, as given by the ID pin
+  * @retval : USB_OTG_FAIL if the core did not reach the mode
+  */
+USB_OTG_STS USB_OTG_SwitchRole(USB_OTG_CORE_HANDLE *pdev , uint8_t mode)
+{
+  USB_OTG_DCTL_TypeDef     dctl;
+  USB_OTG_HPRT0_TypeDef    hprt0;
+  uint32_t                 timeout = 0;
+  
+  USB_OTG_DisableGlobalInt(pdev);
+  
+  /* Leave the current role */
+  if (pdev->otg.OTG_State == A_HOST)
+  {
+    USB_OTG_StopHost(pdev);
+    USB_OTG_BSP_DriveVBUS(pdev, 0);
+    hprt0.d32 = USB_OTG_ReadHPRT0(pdev);
+    hprt0.b.prtpwr = 0;
+    USB_OTG_WRITE_REG32(pdev->regs.HPRT0, hprt0.d32);
+    USBH_HCD_INT_fops->DevDisconnected(pdev);
+  }
+  else if (pdev->otg.OTG_State == B_PERIPHERAL)
+  {
+    dctl.d32 = USB_OTG_READ_REG32(&pdev->regs.DREGS->DCTL);
+    dctl.b.sftdiscon = 1;
+    USB_OTG_WRITE_REG32(&pdev->regs.DREGS->DCTL, dctl.d32);
+    /* Before USB_OTG_StopDevice, which drops the device status */
+    USBD_DCD_INT_fops->RoleSuspend(pdev);
+    USB_OTG_StopDevice(pdev);
+  }
+  pdev->otg.OTG_PrevState = pdev->otg.OTG_State;
+  
+  /* The core follows the ID pin after the debounce: wait for the mode */
+  while ((USB_OTG_GetMode(pdev) != mode) && (++timeout < USB_OTG_SWITCH_TIMEOUT))
+  {
+  }
+  if (USB_OTG_GetMode(pdev) != mode)
+  {
+    pdev->otg.OTG_State = A_SUSPEND;
+    pdev->otg.SwitchFail++;
+    USB_OTG_EnableGlobalInt(pdev);
+    return USB_OTG_FAIL;
+  }
+  
+  /* Enter the new role */
+  if (mode == HOST_MODE)
+  {
+    USB_OTG_CoreSwitchHost(pdev);
+    pdev->otg.OTG_State = A_HOST;
+  }
+  else
+  {
+    USB_OTG_CoreInitDev(pdev);
+    dctl.d32 = USB_OTG_READ_REG32(&pdev->regs.DREGS->DCTL);
+    dctl.b.sftdiscon = 0;
+    USB_OTG_WRITE_REG32(&pdev->regs.DREGS->DCTL, dctl.d32);
+    pdev->otg.OTG_State = B_PERIPHERAL;
+  }
+  pdev->otg.SwitchCount++;
+  
+  USB_OTG_EnableGlobalInt(pdev);
+  return USB_OTG_OK;
+}
+#endif
+
+
 /**
   * @brief  USB_OTG_HandleSessionRequest_ISR 
   *           Initiating the Session Request Protocol
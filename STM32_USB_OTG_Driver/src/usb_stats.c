@@ -0,0 +1,354 @@
+/**
+  ******************************************************************************
+  * @file    usb_stats.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   OTG traffic counters and interrupt timing statistics
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software 
+  * distributed under the License is distributed on an "AS IS" BASIS, 
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_stats.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+* @{
+*/
+
+/** @defgroup USB_STATS
+* @brief The counters are updated by the device and host interrupt handlers
+*        through the USB_OTG_STATS_xx macros, which expand to nothing when
+*        USB_OTG_STATS_ENABLED is not defined.
+*
+*        The interrupt timing is read from the DWT cycle counter, enabled by
+*        USB_OTG_Stats_Init. It covers the dispatch of the core interrupt
+*        sources, not the exception entry and exit.
+*
+*        The transfer latency of the device endpoints other than 0 is the
+*        time from USB_OTG_EPStartXfer to the transfer complete interrupt:
+*        it includes the wait for the host tokens, so it measures the whole
+*        path (bus, FIFO, DMA and interrupt) of one transfer.
+* @{
+*/
+
+#ifdef USB_OTG_STATS_ENABLED
+
+/** @defgroup USB_STATS_Private_Defines
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_STATS_Private_TypesDefinitions
+* @{
+*/
+/**
+* @}
+*/
+
+
+
+/** @defgroup USB_STATS_Private_Macros
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_STATS_Private_Variables
+* @{
+*/
+static const USB_OTG_EP_STATS USB_OTG_Stats_Zero = {0, 0, 0, 0, 0, 0};
+/**
+* @}
+*/
+
+
+/** @defgroup USB_STATS_Private_FunctionPrototypes
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_STATS_Private_Functions
+* @{
+*/
+
+/**
+* @brief  USB_OTG_Stats_Init
+*         Start the DWT cycle counter and clear the statistics
+* @param  pdev : Selected device
+* @retval None
+*/
+void USB_OTG_Stats_Init(USB_OTG_CORE_HANDLE *pdev)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  USB_OTG_DWT_CTRL |= USB_OTG_DWT_CTRL_CYCCNTENA;
+
+  USB_OTG_Stats_Reset(pdev);
+}
+
+/**
+* @brief  USB_OTG_Stats_Reset
+*         Clear all the counters
+* @param  pdev : Selected device
+* @retval None
+*/
+void USB_OTG_Stats_Reset(USB_OTG_CORE_HANDLE *pdev)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t i;
+
+  __disable_irq();
+  for (i = 0; i < USB_OTG_MAX_TX_FIFOS; i++)
+  {
+#ifdef USE_DEVICE_MODE
+    pdev->dev.in_ep[i].stats = USB_OTG_Stats_Zero;
+    pdev->dev.out_ep[i].stats = USB_OTG_Stats_Zero;
+#endif
+#ifdef USE_HOST_MODE
+    pdev->host.hc_stats[i] = USB_OTG_Stats_Zero;
+#endif
+  }
+  pdev->isr_stats.count = 0;
+  pdev->isr_stats.cyc_min = 0xFFFFFFFF;
+  pdev->isr_stats.cyc_max = 0;
+  pdev->isr_stats.cyc_sum = 0;
+#ifdef USE_DEVICE_MODE
+  for (i = 0; i < 2; i++)
+  {
+    USB_OTG_XFER_STATS *xs = &pdev->xfer_stats[i];
+    uint32_t bin;
+
+    xs->count = 0;
+    xs->cyc_max = 0;
+    for (bin = 0; bin < USB_OTG_XFER_HIST_BINS; bin++)
+    {
+      xs->hist[bin] = 0;
+    }
+  }
+#endif
+  __set_PRIMASK(primask);
+}
+
+/**
+* @brief  USB_OTG_Stats_ISRDone
+*         Account the time spent since USB_OTG_STATS_ISR_ENTER
+* @param  pdev : Selected device
+* @retval None
+*/
+void USB_OTG_Stats_ISRDone(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_ISR_STATS *st = &pdev->isr_stats;
+  uint32_t cyc = USB_OTG_DWT_CYCCNT - st->cyc_start;
+
+  st->count++;
+  st->cyc_sum += cyc;
+  if (cyc < st->cyc_min)
+  {
+    st->cyc_min = cyc;
+  }
+  if (cyc > st->cyc_max)
+  {
+    st->cyc_max = cyc;
+  }
+}
+
+#ifdef USE_DEVICE_MODE
+/**
+* @brief  USB_OTG_Stats_GetEP
+*         Take a coherent copy of the counters of an endpoint
+* @param  pdev : Selected device
+* @param  ep_addr : endpoint address
+* @param  stats : destination
+* @retval USB_OTG_FAIL for an out of range endpoint
+*/
+USB_OTG_STS USB_OTG_Stats_GetEP(USB_OTG_CORE_HANDLE *pdev,
+                                uint8_t ep_addr,
+                                USB_OTG_EP_STATS *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+  USB_OTG_EP *ep;
+
+  if ((ep_addr & 0x7F) >= pdev->cfg.dev_endpoints)
+  {
+    return USB_OTG_FAIL;
+  }
+
+  if ((ep_addr & 0x80) == 0x80)
+  {
+    ep = &pdev->dev.in_ep[ep_addr & 0x7F];
+  }
+  else
+  {
+    ep = &pdev->dev.out_ep[ep_addr & 0x7F];
+  }
+  __disable_irq();
+  *stats = ep->stats;
+  __set_PRIMASK(primask);
+  return USB_OTG_OK;
+}
+#endif
+
+#ifdef USE_HOST_MODE
+/**
+* @brief  USB_OTG_Stats_GetHC
+*         Take a coherent copy of the counters of a host channel
+* @param  pdev : Selected device
+* @param  hc_num : channel number
+* @param  stats : destination
+* @retval USB_OTG_FAIL for an out of range channel
+*/
+USB_OTG_STS USB_OTG_Stats_GetHC(USB_OTG_CORE_HANDLE *pdev,
+                                uint8_t hc_num,
+                                USB_OTG_EP_STATS *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  if (hc_num >= pdev->cfg.host_channels)
+  {
+    return USB_OTG_FAIL;
+  }
+  __disable_irq();
+  *stats = pdev->host.hc_stats[hc_num];
+  __set_PRIMASK(primask);
+  return USB_OTG_OK;
+}
+#endif
+
+/**
+* @brief  USB_OTG_Stats_GetISR
+*         Take a coherent copy of the interrupt timing
+* @param  pdev : Selected device
+* @param  stats : destination, the average is cyc_sum / count
+* @retval None
+*/
+void USB_OTG_Stats_GetISR(USB_OTG_CORE_HANDLE *pdev,
+                          USB_OTG_ISR_STATS *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = pdev->isr_stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+* @brief  USB_OTG_Stats_XferBin
+*         Histogram bin of a latency: exact below 4 cycles, then 4 bins per
+*         power of 2 (relative error below 25 %)
+* @param  cyc : latency in CPU cycles
+* @retval bin, the last one collects the latencies above 2^25 cycles
+*/
+uint32_t USB_OTG_Stats_XferBin(uint32_t cyc)
+{
+  uint32_t oct, bin;
+
+  if (cyc < 4)
+  {
+    return cyc;
+  }
+  oct = 31 - __CLZ(cyc);
+  bin = (4 * (oct - 1)) + ((cyc >> (oct - 2)) & 0x03);
+  if (bin >= USB_OTG_XFER_HIST_BINS)
+  {
+    bin = USB_OTG_XFER_HIST_BINS - 1;
+  }
+  return bin;
+}
+
+/**
+* @brief  USB_OTG_Stats_XferBinLow
+*         Lowest latency falling in a histogram bin
+* @param  bin : histogram bin
+* @retval latency in CPU cycles
+*/
+uint32_t USB_OTG_Stats_XferBinLow(uint32_t bin)
+{
+  if (bin < 4)
+  {
+    return bin;
+  }
+  return (4 + (bin & 0x03)) << ((bin / 4) - 1);
+}
+
+#ifdef USE_DEVICE_MODE
+/**
+* @brief  USB_OTG_Stats_XferDone
+*         Account the latency of a transfer, from the transfer complete
+*         interrupt of a non control endpoint, before the next one starts
+* @param  pdev : Selected device
+* @param  ep : endpoint
+* @retval None
+*/
+void USB_OTG_Stats_XferDone(USB_OTG_CORE_HANDLE *pdev, USB_OTG_EP *ep)
+{
+  USB_OTG_XFER_STATS *xs = &pdev->xfer_stats[ep->is_in ? USB_OTG_XFER_IN : USB_OTG_XFER_OUT];
+  uint32_t cyc = USB_OTG_DWT_CYCCNT - ep->stats.xfer_start;
+
+  xs->count++;
+  xs->hist[USB_OTG_Stats_XferBin(cyc)]++;
+  if (cyc > xs->cyc_max)
+  {
+    xs->cyc_max = cyc;
+  }
+}
+
+/**
+* @brief  USB_OTG_Stats_GetXfer
+*         Take a coherent copy of the transfer latency of one direction
+* @param  pdev : Selected device
+* @param  dir : USB_OTG_XFER_IN or USB_OTG_XFER_OUT
+* @param  stats : destination
+* @retval None
+*/
+void USB_OTG_Stats_GetXfer(USB_OTG_CORE_HANDLE *pdev,
+                           uint8_t dir,
+                           USB_OTG_XFER_STATS *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *stats = pdev->xfer_stats[dir & 0x01];
+  __set_PRIMASK(primask);
+}
+#endif
+
+/**
+* @}
+*/
+
+#endif /* USB_OTG_STATS_ENABLED */
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
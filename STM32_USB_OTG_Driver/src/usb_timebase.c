@@ -0,0 +1,358 @@
+/**
+  ******************************************************************************
+  * @file    usb_timebase.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    19-March-2012
+  * @brief   Sampling timebase phase locked to the SOF of the host
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2012 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usb_timebase.h"
+
+
+/** @addtogroup USB_OTG_DRIVER
+* @{
+*/
+
+/** @defgroup USB_TIMEBASE
+* @brief The SOF output of the core (USB_OTG_xx_SOF_OUTPUT_ENABLED) is
+*        routed to the ITR1 trigger input of TIM2, the sampling timer: its
+*        update event, selected as TRGO, triggers the ADC/DAC conversions of
+*        the application. The channel 1 of TIM2 captures the counter at each
+*        SOF, which is the phase of the sampling triggers relative to the
+*        frames of the host.
+*
+*        USB_OTG_Timebase_Start arms TIM2 in trigger mode: the counter
+*        starts on the next SOF. From then on a PI loop trims the auto-reload
+*        value once per frame so that the counter reads cfg->phase at each
+*        SOF; the fractional part of the trimmed period is carried from frame
+*        to frame. Boards attached to the same host and started with the
+*        same configuration sample in phase once they are locked, and the
+*        trigger count reported with each extended frame number gives a
+*        timestamp common to all of them.
+*
+*        USB_OTG_Timebase_IRQHandler must be called from TIM2_IRQHandler,
+*        with a priority that lets it run within a frame of the SOF (the
+*        frame number is read from DSTS). On the STM32F105/107 the SOF is
+*        routed with the TIM2ITR1 AFIO remap, on the STM32F2xx/F4xx with the
+*        TIM2 option register (OTG_FS or OTG_HS SOF).
+* @{
+*/
+
+#ifdef USB_OTG_SOF_TIMEBASE_ENABLED
+
+/** @defgroup USB_TIMEBASE_Private_Defines
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_TIMEBASE_Private_TypesDefinitions
+* @{
+*/
+/**
+* @}
+*/
+
+
+
+/** @defgroup USB_TIMEBASE_Private_Macros
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_TIMEBASE_Private_Variables
+* @{
+*/
+static USB_OTG_TIMEBASE_CFG  Timebase_Cfg;
+static __IO uint8_t          Timebase_State = USB_OTG_TIMEBASE_IDLE;
+static USB_OTG_TIMESTAMP     Timebase_Ts;
+static uint32_t              Timebase_Frame0;
+static uint32_t              Timebase_LastFn;
+static int32_t               Timebase_Integral;
+static uint32_t              Timebase_Fraction;
+static uint8_t               Timebase_LockCount;
+/**
+* @}
+*/
+
+
+/** @defgroup USB_TIMEBASE_Private_FunctionPrototypes
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USB_TIMEBASE_Private_Functions
+* @{
+*/
+
+/**
+* @brief  USB_OTG_Timebase_Init
+*         Route the SOF of the core to TIM2 and configure the sampling
+*         timer, left stopped
+* @param  pdev : Selected device
+* @param  cfg : timebase configuration, copied
+* @retval None
+*/
+void USB_OTG_Timebase_Init(USB_OTG_CORE_HANDLE *pdev,
+                           USB_OTG_TIMEBASE_CFG *cfg)
+{
+  TIM_TimeBaseInitTypeDef  TIM_TimeBaseStructure;
+  TIM_ICInitTypeDef        TIM_ICInitStructure;
+
+  Timebase_Cfg = *cfg;
+  Timebase_State = USB_OTG_TIMEBASE_IDLE;
+
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+#ifdef STM32F10X_CL
+  RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
+  GPIO_PinRemapConfig(GPIO_Remap_TIM2ITR1_PTP_SOF, ENABLE);
+#else
+  if (pdev->cfg.coreID == USB_OTG_HS_CORE_ID)
+  {
+    TIM_RemapConfig(TIM2, TIM2_USBHS_SOF);
+  }
+  else
+  {
+    TIM_RemapConfig(TIM2, TIM2_USBFS_SOF);
+  }
+#endif
+
+  TIM_DeInit(TIM2);
+  TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+  TIM_TimeBaseStructure.TIM_Prescaler = cfg->prescaler;
+  TIM_TimeBaseStructure.TIM_Period = cfg->period - 1;
+  TIM_TimeBaseInit(TIM2, &TIM_TimeBaseStructure);
+  TIM_ARRPreloadConfig(TIM2, ENABLE);
+
+  /* The update event (the end of each sampling period) is the trigger of
+     the conversions; selected after the UG event of TIM_TimeBaseInit */
+  TIM_SelectOutputTrigger(TIM2, TIM_TRGOSource_Update);
+
+  /* Channel 1 captures the counter on the trigger input, i.e. on the SOF */
+  TIM_SelectInputTrigger(TIM2, TIM_TS_ITR1);
+  TIM_ICStructInit(&TIM_ICInitStructure);
+  TIM_ICInitStructure.TIM_Channel = TIM_Channel_1;
+  TIM_ICInitStructure.TIM_ICSelection = TIM_ICSelection_TRC;
+  TIM_ICInit(TIM2, &TIM_ICInitStructure);
+}
+
+/**
+* @brief  USB_OTG_Timebase_Start
+*         Start the sampling timer on the next SOF and the phase loop
+* @param  None
+* @retval None
+*/
+void USB_OTG_Timebase_Start(void)
+{
+  TIM_Cmd(TIM2, DISABLE);
+  TIM_ITConfig(TIM2, TIM_IT_CC1, DISABLE);
+
+  TIM2->CNT = 0;
+  TIM2->ARR = Timebase_Cfg.period - 1;
+
+  Timebase_Integral = 0;
+  Timebase_Fraction = 0;
+  Timebase_LockCount = 0;
+  Timebase_Ts.error = 0;
+  Timebase_Ts.period = Timebase_Cfg.period << 16;
+  Timebase_Ts.locked = 0;
+  Timebase_State = USB_OTG_TIMEBASE_WAIT_SOF;
+
+  /* The trigger mode sets CEN on the next SOF */
+  TIM_ClearFlag(TIM2, TIM_FLAG_CC1 | TIM_FLAG_CC1OF);
+  TIM_SelectSlaveMode(TIM2, TIM_SlaveMode_Trigger);
+  TIM_ITConfig(TIM2, TIM_IT_CC1, ENABLE);
+}
+
+/**
+* @brief  USB_OTG_Timebase_Stop
+*         Stop the sampling timer
+* @param  None
+* @retval None
+*/
+void USB_OTG_Timebase_Stop(void)
+{
+  TIM_ITConfig(TIM2, TIM_IT_CC1, DISABLE);
+  TIM_Cmd(TIM2, DISABLE);
+  TIM2->SMCR &= (uint16_t)~TIM_SMCR_SMS;
+
+  Timebase_State = USB_OTG_TIMEBASE_IDLE;
+  Timebase_Ts.locked = 0;
+}
+
+/**
+* @brief  USB_OTG_Timebase_GetTimestamp
+*         Get the frame number and trigger count of the last SOF
+* @param  ts : timestamp
+* @retval 1 when the loop is locked
+*/
+uint8_t USB_OTG_Timebase_GetTimestamp(USB_OTG_TIMESTAMP *ts)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *ts = Timebase_Ts;
+  __set_PRIMASK(primask);
+
+  return ts->locked;
+}
+
+/**
+* @brief  USB_OTG_Timebase_IRQHandler
+*         Handle the capture of the counter at the SOF: update the frame
+*         number and trim the period of the next frame
+* @param  pdev : Selected device
+* @retval status
+*/
+uint32_t USB_OTG_Timebase_IRQHandler(USB_OTG_CORE_HANDLE *pdev)
+{
+  USB_OTG_DSTS_TypeDef  dsts;
+  uint32_t fn_mask;
+  uint32_t capture;
+  int32_t  period;
+  int32_t  error;
+  int32_t  half;
+  int64_t  corr;
+  int32_t  limit;
+  uint32_t whole;
+
+  if ((TIM2->SR & TIM_SR_CC1IF) == 0)
+  {
+    return 0;
+  }
+  /* Reading CCR1 clears CC1IF; an overcapture only means missed frames,
+     accounted for by the frame number */
+  capture = TIM2->CCR1;
+  TIM2->SR = (uint16_t)~TIM_SR_CC1OF;
+
+  /* Frame number of the SOF, with the microframe in bits 2:0 on a HS bus */
+  dsts.d32 = USB_OTG_READ_REG32(&pdev->regs.DREGS->DSTS);
+  fn_mask = (dsts.b.enumspd == DSTS_ENUMSPD_HS_PHY_30MHZ_OR_60MHZ) ? 0x3FFF : 0x7FF;
+
+  if (Timebase_State == USB_OTG_TIMEBASE_WAIT_SOF)
+  {
+    /* The counter has just been started by this SOF: leave the trigger
+       mode, CEN stays set */
+    TIM2->SMCR &= (uint16_t)~TIM_SMCR_SMS;
+    Timebase_State = USB_OTG_TIMEBASE_RUN;
+    Timebase_LastFn = dsts.b.soffn & fn_mask;
+    Timebase_Frame0 = Timebase_LastFn;
+    Timebase_Ts.frame = Timebase_LastFn;
+    capture = 0;
+  }
+  else if (Timebase_State == USB_OTG_TIMEBASE_RUN)
+  {
+    Timebase_Ts.frame += ((dsts.b.soffn & fn_mask) - Timebase_LastFn) & fn_mask;
+    Timebase_LastFn = dsts.b.soffn & fn_mask;
+  }
+  else
+  {
+    return 1;
+  }
+  Timebase_Ts.sample = (Timebase_Ts.frame - Timebase_Frame0) * Timebase_Cfg.samples;
+
+  /* Phase error in ticks, within +/- half a period: positive when the
+     triggers are early, i.e. the local clock is fast */
+  period = (int32_t)Timebase_Cfg.period;
+  half = period / 2;
+  error = (int32_t)capture - (int32_t)Timebase_Cfg.phase;
+  if (error >= half)
+  {
+    error -= period;
+  }
+  else if (error < -half)
+  {
+    error += period;
+  }
+  Timebase_Ts.error = error;
+
+  /* PI correction of the frame length, spread over its periods and bounded
+     to 1/64 of the nominal period; the integral stops while saturated */
+  Timebase_Integral += error;
+  corr = (((int64_t)error << 16) >> USB_OTG_TIMEBASE_KP_SHIFT) +
+         (((int64_t)Timebase_Integral << 16) >> USB_OTG_TIMEBASE_KI_SHIFT);
+  corr /= Timebase_Cfg.samples;
+  limit = (int32_t)(((uint32_t)period << 16) >> 6);
+  if ((corr > limit) || (corr < -limit))
+  {
+    Timebase_Integral -= error;
+    corr = (corr > 0) ? limit : -limit;
+  }
+  Timebase_Ts.period = ((uint32_t)period << 16) + (uint32_t)(int32_t)corr;
+
+  whole = Timebase_Ts.period + Timebase_Fraction;
+  Timebase_Fraction = whole & 0xFFFF;
+  TIM2->ARR = (whole >> 16) - 1;
+
+  if ((error <= USB_OTG_TIMEBASE_LOCK_TICKS) &&
+      (error >= -USB_OTG_TIMEBASE_LOCK_TICKS))
+  {
+    if (Timebase_LockCount < USB_OTG_TIMEBASE_LOCK_FRAMES)
+    {
+      Timebase_LockCount++;
+    }
+    else
+    {
+      Timebase_Ts.locked = 1;
+    }
+  }
+  else
+  {
+    Timebase_LockCount = 0;
+    if ((error > 4 * USB_OTG_TIMEBASE_LOCK_TICKS) ||
+        (error < -4 * USB_OTG_TIMEBASE_LOCK_TICKS))
+    {
+      Timebase_Ts.locked = 0;
+    }
+  }
+
+  if (Timebase_Cfg.Sof != 0)
+  {
+    Timebase_Cfg.Sof(Timebase_Ts.frame, error);
+  }
+  return 1;
+}
+
+/**
+* @}
+*/
+
+#endif /* USB_OTG_SOF_TIMEBASE_ENABLED */
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/